@@ -175,6 +175,7 @@ LOCAL_SRC_FILES += \
     utils/minixpm.c \
     utils/pow2.c \
     utils/resources.c \
+    utils/rowwriter.c \
     utils/spline.c \
     utils/textclient-mobile.c \
     utils/thread_util.c \
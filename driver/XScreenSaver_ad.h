@@ -23,6 +23,7 @@
 "*unfade:		True",
 "*fadeSeconds:		0:00:03",
 "*fadeTicks:		20",
+"*useThreads:		True",
 "*splash:		True",
 "*splashDuration:	0:00:05",
 "*visualID:		default",
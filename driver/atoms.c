@@ -26,6 +26,7 @@ Atom XA_SCREENSAVER, XA_SCREENSAVER_VERSION, XA_SCREENSAVER_RESPONSE,
      XA_SCREENSAVER_ID, XA_SCREENSAVER_STATUS, XA_SELECT, XA_DEMO, XA_EXIT,
      XA_BLANK, XA_LOCK, XA_ACTIVATE, XA_SUSPEND, XA_NEXT, XA_PREV,
      XA_DEACTIVATE, XA_CYCLE, XA_RESTART, XA_PREFS,
+     XA_SCREENSAVER_FIRST_FRAME, XA_SCREENSAVER_HACK_STATS,
      XA_NET_WM_PID, XA_NET_WM_STATE, XA_NET_WM_STATE_ABOVE,
      XA_NET_WM_STATE_FULLSCREEN, XA_NET_WM_BYPASS_COMPOSITOR,
      XA_NET_WM_STATE_STAYS_ON_TOP, XA_KDE_NET_WM_WINDOW_TYPE_OVERRIDE,
@@ -42,6 +43,8 @@ init_xscreensaver_atoms (Display *dpy)
   XA_SCREENSAVER_VERSION  = A("_SCREENSAVER_VERSION");
   XA_SCREENSAVER_STATUS   = A("_SCREENSAVER_STATUS");
   XA_SCREENSAVER_RESPONSE = A("_SCREENSAVER_RESPONSE");
+  XA_SCREENSAVER_FIRST_FRAME = A("_SCREENSAVER_FIRST_FRAME");
+  XA_SCREENSAVER_HACK_STATS = A("_SCREENSAVER_HACK_STATS");
 
   XA_ACTIVATE   = A("ACTIVATE");
   XA_DEACTIVATE = A("DEACTIVATE");
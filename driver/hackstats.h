@@ -0,0 +1,40 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or 
+ * implied warranty.
+ */
+
+#ifndef __HACKSTATS_H__
+#define __HACKSTATS_H__
+
+/* Rolling per-hack statistics, so that slow starters and CPU hogs can be
+   found and taken out of the rotation.  xscreensaver-gfx keeps them as
+   text on the _SCREENSAVER_HACK_STATS property of the root window, so that
+   they outlive each xscreensaver-gfx process, and "xscreensaver-command
+   -stats" prints them.  Each line is:
+
+     NAME RUNS RUN-MS CPU-MS MAX-RSS-KB STARTS EXEC-MS FIRST-FRAME-MS
+
+   where the times are totals over RUNS or STARTS.  The run of a hack that
+   was launched ahead of time, in standby, begins when it is continued.
+ */
+struct hack_stats {
+  char name[100];
+  long runs;		/* How many runs have ended */
+  long run_ms;		/* Wall-clock time of those */
+  long cpu_ms;		/* User plus system time of those */
+  long max_rss;		/* Biggest resident set size, in KB */
+  long starts;		/* How many first frames we have heard about */
+  long exec_ms;		/* Time from fork to main() */
+  long first_frame_ms;	/* Time from fork to the first frame */
+};
+
+#define HACK_STATS_SCAN_FORMAT  "%99s %ld %ld %ld %ld %ld %ld %ld"
+#define HACK_STATS_PRINT_FORMAT "%s %ld %ld %ld %ld %ld %ld %ld\n"
+
+#endif /* __HACKSTATS_H__ */
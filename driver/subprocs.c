@@ -53,6 +53,7 @@
 #include "yarandom.h"
 #include "visual.h"		/* for id_to_visual() */
 #include "atoms.h"
+#include "hackstats.h"
 #include "screenshot.h"
 
 
@@ -68,17 +69,39 @@ enum job_status {
 
 #define EXEC_FAILED_EXIT_STATUS -33
 
+/* How long before the cycle timer fires to launch the next hack, in
+   milliseconds.  See warm_timer(). */
+#define STANDBY_LEAD (10 * 1000)
+
 struct screenhack_job {
   char *name;
   pid_t pid;
   int screen;
   enum job_status status;
   time_t launched, killed;
+  double start_time;	/* When it was forked, as double_time() */
+  double exec_time;	/* Seconds until it reached main() */
+  double first_frame;	/* Seconds until its first frame; 0 until then */
+  double run_start;	/* When its run began: when it was forked, or when
+                           it was continued as the standby hack; 0 while
+                           it is stopped in standby */
+  long run_start_cpu;	/* CPU milliseconds it had used before run_start */
   struct screenhack_job *next;
 };
 
 static struct screenhack_job *jobs = 0;
 
+
+/* The per-hack statistics; see hackstats.h.  Once a hack has more than
+   HACK_STATS_WINDOW runs or starts, its totals are scaled back, so that
+   they average over roughly that many of its most recent runs.
+ */
+#define HACK_STATS_WINDOW 20
+
+static struct hack_stats *hack_stats = 0;
+static int hack_stats_count = 0;
+static Bool hack_stats_loaded_p = False;
+
 static void clean_job_list (void);
 static void await_dying_children (saver_info *si);
 static void describe_dead_child (saver_info *, pid_t, int wait_status,
@@ -168,6 +191,20 @@ signal_name (int signal)
 /* Management of child processes, and de-zombification.
  */
 
+static double
+double_time (void)
+{
+  struct timeval now;
+# ifdef GETTIMEOFDAY_TWO_ARGS
+  struct timezone tzp;
+  gettimeofday(&now, &tzp);
+# else
+  gettimeofday(&now);
+# endif
+
+  return (now.tv_sec + ((double) now.tv_usec * 0.000001));
+}
+
 static char *
 timestring (time_t when)
 {
@@ -239,6 +276,11 @@ make_job (pid_t pid, int screen, const char *cmd)
   job->status = job_running;
   job->launched = time ((time_t *) 0);
   job->killed = 0;
+  job->start_time = double_time();
+  job->exec_time = 0;
+  job->first_frame = 0;
+  job->run_start = job->start_time;
+  job->run_start_cpu = 0;
   job->next = jobs;
   jobs = job;
 }
@@ -383,6 +425,177 @@ kill_job (saver_info *si, pid_t pid, int signal)
 }
 
 
+/* Reads the statistics left by previous xscreensaver-gfx processes.
+ */
+static void
+load_hack_stats (saver_info *si)
+{
+  Atom type = 0;
+  int format = 0;
+  unsigned long nitems = 0, bytesafter = 0;
+  unsigned char *dataP = 0;
+
+  hack_stats_loaded_p = True;
+
+  if (XGetWindowProperty (si->dpy, RootWindow (si->dpy, 0),
+                          XA_SCREENSAVER_HACK_STATS,
+                          0, 1024 * 1024, False, XA_STRING,
+                          &type, &format, &nitems, &bytesafter, &dataP)
+      == Success
+      && dataP && type == XA_STRING && format == 8)
+    {
+      char *line = (char *) dataP;
+      while (*line)
+        {
+          struct hack_stats hs;
+          char *nl = strchr (line, '\n');
+          if (nl) *nl = 0;
+          memset (&hs, 0, sizeof(hs));
+          if (8 == sscanf (line, HACK_STATS_SCAN_FORMAT,
+                           hs.name, &hs.runs, &hs.run_ms, &hs.cpu_ms,
+                           &hs.max_rss, &hs.starts, &hs.exec_ms,
+                           &hs.first_frame_ms))
+            {
+              hack_stats = (struct hack_stats *)
+                realloc (hack_stats, (hack_stats_count + 1) *
+                         sizeof (*hack_stats));
+              if (! hack_stats) abort();
+              hack_stats[hack_stats_count++] = hs;
+            }
+          if (!nl) break;
+          line = nl + 1;
+        }
+    }
+  if (dataP) XFree (dataP);
+}
+
+
+static void
+store_hack_stats (saver_info *si)
+{
+  char *text = (char *) malloc (hack_stats_count * 256 + 1);
+  char *out = text;
+  int i;
+  if (! text) abort();
+  *out = 0;
+  for (i = 0; i < hack_stats_count; i++)
+    {
+      struct hack_stats *hs = &hack_stats[i];
+      sprintf (out, HACK_STATS_PRINT_FORMAT,
+               hs->name, hs->runs, hs->run_ms, hs->cpu_ms, hs->max_rss,
+               hs->starts, hs->exec_ms, hs->first_frame_ms);
+      out += strlen (out);
+    }
+  XChangeProperty (si->dpy, RootWindow (si->dpy, 0),
+                   XA_SCREENSAVER_HACK_STATS, XA_STRING, 8, PropModeReplace,
+                   (unsigned char *) text, out - text);
+  free (text);
+}
+
+
+static struct hack_stats *
+find_hack_stats (saver_info *si, const char *name)
+{
+  int i;
+  if (! hack_stats_loaded_p)
+    load_hack_stats (si);
+  for (i = 0; i < hack_stats_count; i++)
+    if (!strcmp (hack_stats[i].name, name))
+      return &hack_stats[i];
+
+  hack_stats = (struct hack_stats *)
+    realloc (hack_stats, (hack_stats_count + 1) * sizeof (*hack_stats));
+  if (! hack_stats) abort();
+  memset (&hack_stats[hack_stats_count], 0, sizeof (*hack_stats));
+  strncpy (hack_stats[hack_stats_count].name, name,
+           sizeof (hack_stats->name) - 1);
+  return &hack_stats[hack_stats_count++];
+}
+
+
+/* Called when a hack has drawn its first frame. */
+static void
+record_hack_start (saver_info *si, struct screenhack_job *job)
+{
+  struct hack_stats *hs = find_hack_stats (si, job->name);
+  hs->starts++;
+  hs->exec_ms += job->exec_time * 1000;
+  hs->first_frame_ms += job->first_frame * 1000;
+  if (hs->starts > HACK_STATS_WINDOW)
+    {
+      hs->exec_ms        = hs->exec_ms * HACK_STATS_WINDOW / hs->starts;
+      hs->first_frame_ms = hs->first_frame_ms * HACK_STATS_WINDOW / hs->starts;
+      hs->starts = HACK_STATS_WINDOW;
+    }
+  store_hack_stats (si);
+}
+
+
+/* How many milliseconds of CPU the running or stopped job has used so
+   far.  Only Linux tells us that before it exits; elsewhere, guess that it
+   was busy for as long as it took to draw its first frame.
+ */
+static long
+job_cpu_ms (struct screenhack_job *job)
+{
+# ifdef __linux__
+  char fn[100], buf[1024];
+  long hz = sysconf (_SC_CLK_TCK);
+  FILE *f;
+  sprintf (fn, "/proc/%lu/stat", (unsigned long) job->pid);
+  f = fopen (fn, "r");
+  if (f)
+    {
+      size_t n = fread (buf, 1, sizeof(buf) - 1, f);
+      char *s;
+      unsigned long ut = 0, st = 0;
+      fclose (f);
+      buf[n] = 0;
+      s = strrchr (buf, ')');	/* after the command name */
+      if (s && hz > 0 &&
+          2 == sscanf (s + 1, " %*c %*d %*d %*d %*d %*d"
+                       " %*u %*u %*u %*u %*u %lu %lu", &ut, &st))
+        return (long) ((ut + st) * 1000 / hz);
+    }
+# endif /* __linux__ */
+  return job->first_frame * 1000;
+}
+
+
+/* Called when a hack has been reaped.  ru_maxrss is in KB on Linux and
+   the BSDs.  For a standby hack, only the time since it was continued
+   counts towards its CPU usage. */
+static void
+record_hack_exit (saver_info *si, struct screenhack_job *job,
+                  struct rusage *rus)
+{
+  struct hack_stats *hs = find_hack_stats (si, job->name);
+  long cpu = (rus->ru_utime.tv_sec  * 1000 + rus->ru_utime.tv_usec / 1000 +
+              rus->ru_stime.tv_sec  * 1000 + rus->ru_stime.tv_usec / 1000);
+  if (rus->ru_maxrss > hs->max_rss)
+    hs->max_rss = rus->ru_maxrss;
+
+  /* A standby hack that was never swapped in had no run to speak of. */
+  if (! job->run_start)
+    {
+      store_hack_stats (si);
+      return;
+    }
+
+  cpu -= job->run_start_cpu;
+  hs->runs++;
+  hs->run_ms += (double_time() - job->run_start) * 1000;
+  hs->cpu_ms += (cpu > 0 ? cpu : 0);
+  if (hs->runs > HACK_STATS_WINDOW)
+    {
+      hs->run_ms = hs->run_ms * HACK_STATS_WINDOW / hs->runs;
+      hs->cpu_ms = hs->cpu_ms * HACK_STATS_WINDOW / hs->runs;
+      hs->runs = HACK_STATS_WINDOW;
+    }
+  store_hack_stats (si);
+}
+
+
 /* We use Xt-style signal handling.  A Unix signal fires, and we inform Xt of
    that.  Then after we return to the top-level command loop on the main
    stack, Xt runs our callback function for that signal.  Just like Xt timers.
@@ -484,10 +697,20 @@ xt_sigterm_handler (XtPointer data, XtSignalId *id)
               ssi->cycle_id = 0;
               ssi->cycle_at = 0;
             }
+          if (ssi->warm_id)
+            {
+              XtRemoveTimeOut (ssi->warm_id);
+              ssi->warm_id = 0;
+            }
+          kill_standby_screenhack (ssi);
           kill_screenhack (ssi);
         }
       unblank_screen (si);
 
+      /* By now, after the fade, the hacks have probably exited, so this
+         gets their resource usage into the stats before we go. */
+      await_dying_children (si);
+
       if (p->verbose_p)
         fprintf (stderr, "%s: %s: exiting\n", blurb(), 
                  signal_name (sigterm_received));
@@ -640,6 +863,9 @@ describe_dead_child (saver_info *si, pid_t kid, int wait_status,
 	job->status = job_dead;
     }
 
+  if (job && job->status == job_dead)
+    record_hack_exit (si, job, &rus);
+
 # ifdef LOG_CPU_TIME
   if (p->verbose_p && job && job->status == job_dead)
     {
@@ -663,6 +889,13 @@ describe_dead_child (saver_info *si, pid_t kid, int wait_status,
               if (*msg)
                 screenhack_obituary (ssi, name, msg);
             }
+          else if (kid == ssi->standby_pid)
+            {
+              /* Don't post an obituary over the running hack; the cycle
+                 timer will just launch something else from scratch. */
+              ssi->standby_pid = 0;
+              destroy_standby_window (ssi);
+            }
         }
     }
 }
@@ -760,7 +993,7 @@ abort_debug_timer (XtPointer closure, XtIntervalId *id)
    printed to stderr.
  */
 static pid_t
-fork_and_exec (saver_screen_info *ssi, const char *command)
+fork_and_exec (saver_screen_info *ssi, Window window, const char *command)
 {
   saver_info *si = ssi->global;
   saver_preferences *p = &si->prefs;
@@ -779,7 +1012,7 @@ fork_and_exec (saver_screen_info *ssi, const char *command)
     case 0:
       close (ConnectionNumber (si->dpy));	/* close display fd */
       if (ssi)
-        hack_subproc_environment (ssi->screen, ssi->screensaver_window);
+        hack_subproc_environment (ssi->screen, window);
 
       exec_command (p->shell, command, p->nice_inferior);
       /* If that returned, we were unable to exec the subprocess. */
@@ -793,7 +1026,7 @@ fork_and_exec (saver_screen_info *ssi, const char *command)
                  " on window 0x%lx\n",
                  blurb(), (ssi ? ssi->number : 0), command,
                  (unsigned long) forked,
-                 (unsigned long) ssi->screensaver_window);
+                 (unsigned long) window);
       break;
     }
 
@@ -807,17 +1040,22 @@ fork_and_exec (saver_screen_info *ssi, const char *command)
 }
 
 
+/* Sets up a window with the visual that the hack wants: the saver window
+   itself, or if standby_p, a new standby window.
+ */
 static Bool
-select_visual_of_hack (saver_screen_info *ssi, screenhack *hack)
+select_visual_of_hack (saver_screen_info *ssi, screenhack *hack,
+                       Bool standby_p)
 {
   saver_info *si = ssi->global;
   saver_preferences *p = &si->prefs;
+  const char *visual = (hack->visual && *hack->visual ? hack->visual : 0);
   Bool selected;
 
-  if (hack->visual && *hack->visual)
-    selected = select_visual(ssi, hack->visual);
+  if (standby_p)
+    selected = create_standby_window (ssi, visual);
   else
-    selected = select_visual(ssi, 0);
+    selected = select_visual (ssi, visual);
 
   if (!selected && (p->verbose_p || si->demoing_p))
     fprintf (stderr,
@@ -832,6 +1070,199 @@ select_visual_of_hack (saver_screen_info *ssi, screenhack *hack)
 }
 
 
+/* Picks the hack to run next on this screen, and sets up a window for it
+   with select_visual_of_hack().  Returns an index into `prefs.screenhacks',
+   or -1 if no hack should be run, or -2 if none of them can be.
+ */
+static int
+choose_screenhack (saver_screen_info *ssi, Bool standby_p)
+{
+  saver_info *si = ssi->global;
+  saver_preferences *p = &si->prefs;
+  screenhack *hack;
+  int current_hack = ssi->current_hack;
+  int new_hack = -1;
+  int retry_count = 0;
+  Bool force = False;
+
+ AGAIN:
+
+  if (p->screenhacks_count < 1)
+    {
+      /* No hacks at all */
+      new_hack = -1;
+    }
+  else if (p->screenhacks_count == 1)
+    {
+      /* Exactly one hack in the list */
+      new_hack = 0;
+    }
+  else if (si->selection_mode == -1)
+    {
+      /* Select the next hack, wrapping. */
+      new_hack = (current_hack + 1) % p->screenhacks_count;
+    }
+  else if (si->selection_mode == -2)
+    {
+      /* Select the previous hack, wrapping. */
+      if (current_hack < 0)
+        new_hack = p->screenhacks_count - 1;
+      else
+        new_hack = ((current_hack + p->screenhacks_count - 1)
+                    % p->screenhacks_count);
+    }
+  else if (si->selection_mode > 0)
+    {
+      /* Select a specific hack, by number (via the ACTIVATE command.) */
+      new_hack = ((si->selection_mode - 1) % p->screenhacks_count);
+      force = True;
+    }
+  else if (p->mode == ONE_HACK &&
+           p->selected_hack >= 0)
+    {
+      /* Select a specific hack, by number (via "One Saver" mode.) */
+      new_hack = p->selected_hack;
+      force = True;
+    }
+  else if (p->mode == BLANK_ONLY || p->mode == DONT_BLANK)
+    {
+      new_hack = -1;
+    }
+  else if (p->mode == RANDOM_HACKS_SAME &&
+           ssi->number != 0)
+    {
+      /* Use the same hack that's running on screen 0.
+         (Assumes this function was called on screen 0 first.)
+       */
+      new_hack = si->screens[0].current_hack;
+    }
+  else  /* (p->mode == RANDOM_HACKS) */
+    {
+      /* Select a random hack (but not the one we just ran.) */
+      while ((new_hack = random () % p->screenhacks_count)
+             == current_hack)
+        ;
+    }
+
+  if (new_hack < 0)   /* don't run a hack */
+    return -1;
+
+  current_hack = new_hack;
+  hack = p->screenhacks[new_hack];
+
+  /* If the hack is disabled, or there is no visual for this hack,
+     then try again (move forward, or backward, or re-randomize.)
+     Unless this hack was specified explicitly, in which case,
+     use it regardless.
+   */
+  if (force)
+    select_visual_of_hack (ssi, hack, standby_p);
+
+  if (!force &&
+      (!hack->enabled_p ||
+       !on_path_p (hack->command) ||
+       !select_visual_of_hack (ssi, hack, standby_p)))
+    {
+      if (++retry_count > (p->screenhacks_count*4))
+        {
+          /* Uh, oops.  Odds are, there are no suitable visuals,
+             and we're looping.  Give up.  (This is totally lame,
+             what we should do is make a list of suitable hacks at
+             the beginning, then only loop over them.)
+          */
+          if (p->verbose_p)
+            fprintf(stderr,
+                    "%s: %d: no programs enabled, or no suitable visuals\n",
+                    blurb(), ssi->number);
+          return -2;
+        }
+      else
+        goto AGAIN;
+    }
+
+  return new_hack;
+}
+
+
+/* Fires STANDBY_LEAD before the cycle timer: launches the hack that the
+   cycle timer will switch to, on a standby window underneath the current
+   one.  By the time the cycle timer fires, it has loaded its images,
+   compiled its shaders and so on, and screenhack_first_frame() has
+   suspended it until spawn_screenhack() swaps it in.
+ */
+static void
+warm_timer (XtPointer closure, XtIntervalId *id)
+{
+  saver_screen_info *ssi = (saver_screen_info *) closure;
+  saver_info *si = ssi->global;
+  saver_preferences *p = &si->prefs;
+  screenhack *hack;
+  pid_t forked;
+  int new_hack;
+
+  ssi->warm_id = 0;
+
+  if (ssi->standby_pid ||
+      si->demoing_p ||
+      si->terminating_p ||
+      /* spawn_screenhack() picks screen 0's hack for the others. */
+      p->mode == RANDOM_HACKS_SAME ||
+      !monitor_powered_on_p (si->dpy) ||
+      getuid() == (uid_t) 0 || geteuid() == (uid_t) 0)
+    return;
+
+  maybe_reload_init_file (si);
+
+  new_hack = choose_screenhack (ssi, True);
+  if (new_hack < 0 || !ssi->standby_window)
+    {
+      destroy_standby_window (ssi);
+      return;
+    }
+
+  hack = p->screenhacks[new_hack];
+  if (ssi->screenshot)
+    screenshot_save (si->dpy, ssi->standby_window, ssi->screenshot);
+
+  forked = fork_and_exec (ssi, ssi->standby_window, hack->command);
+  if (forked <= 0)
+    {
+      destroy_standby_window (ssi);
+      return;
+    }
+
+  ssi->standby_hack = new_hack;
+  ssi->standby_selection = si->selection_mode;
+  ssi->standby_pid = forked;
+
+  XChangeProperty (si->dpy, ssi->standby_window, XA_WM_COMMAND,
+                   XA_STRING, 8, PropModeReplace,
+                   (unsigned char *) hack->command,
+                   strlen (hack->command));
+  XChangeProperty (si->dpy, ssi->standby_window, XA_NET_WM_PID,
+                   XA_CARDINAL, 32, PropModeReplace,
+                   (unsigned char *) &ssi->standby_pid, 1);
+}
+
+
+/* Queues warm_timer to fire a little before the cycle timer, which is
+   how_long milliseconds away; or cancels it, if how_long is 0.
+ */
+static void
+schedule_warm_timer (saver_screen_info *ssi, Time how_long)
+{
+  saver_info *si = ssi->global;
+  Time lead = how_long / 4;
+  if (ssi->warm_id)
+    XtRemoveTimeOut (ssi->warm_id);
+  ssi->warm_id = 0;
+  if (lead > STANDBY_LEAD) lead = STANDBY_LEAD;
+  if (lead >= 1000)
+    ssi->warm_id = XtAppAddTimeOut (si->app, how_long - lead,
+                                    warm_timer, (XtPointer) ssi);
+}
+
+
 void
 spawn_screenhack (saver_screen_info *ssi)
 {
@@ -846,6 +1277,7 @@ spawn_screenhack (saver_screen_info *ssi)
                  "%s: %d: X says monitor has powered down; "
                  "not launching a hack\n", blurb(), ssi->number);
       ssi->current_hack = -1;
+      kill_standby_screenhack (ssi);
 
       /* Hooray, this doesn't actually clear the window if it was OpenGL.
          And some X servers apparently ignore XClearWindow if the monitor is
@@ -860,113 +1292,51 @@ spawn_screenhack (saver_screen_info *ssi)
       goto DONE;
     }
 
+  /* If the hack that was launched ahead of time is still the one we would
+     have picked (nobody has asked for "next" or a particular hack since
+     then) just bring its window to the front and let it run. */
+  if (ssi->standby_pid &&
+      ssi->standby_selection == si->selection_mode &&
+      ssi->standby_hack < p->screenhacks_count)
+    {
+      struct screenhack_job *job = find_job (ssi->standby_pid);
+
+      swap_standby_window (ssi);
+      ssi->current_hack = ssi->standby_hack;
+      ssi->pid = ssi->standby_pid;
+      ssi->standby_pid = 0;
+
+      if (job && job->status == job_stopped)
+        {
+          job->run_start = double_time();
+          job->run_start_cpu = job_cpu_ms (job);
+          kill_job (si, ssi->pid, SIGCONT);
+        }
+      if (p->verbose_p)
+        fprintf (stderr, "%s: %d: switched to standby pid %lu (%s)\n",
+                 blurb(), ssi->number, (unsigned long) ssi->pid,
+                 (job ? job->name : "???"));
+      goto DONE;
+    }
+
+  kill_standby_screenhack (ssi);
+
   if (p->screenhacks_count)
     {
       screenhack *hack;
       pid_t forked;
       char buf [255];
-      int new_hack = -1;
-      int retry_count = 0;
-      Bool force = False;
-
-    AGAIN:
+      int new_hack = choose_screenhack (ssi, False);
 
-      if (p->screenhacks_count < 1)
-        {
-          /* No hacks at all */
-          new_hack = -1;
-        }
-      else if (p->screenhacks_count == 1)
-        {
-          /* Exactly one hack in the list */
-          new_hack = 0;
-        }
-      else if (si->selection_mode == -1)
-        {
-          /* Select the next hack, wrapping. */
-          new_hack = (ssi->current_hack + 1) % p->screenhacks_count;
-        }
-      else if (si->selection_mode == -2)
-        {
-          /* Select the previous hack, wrapping. */
-          if (ssi->current_hack < 0)
-            new_hack = p->screenhacks_count - 1;
-          else
-            new_hack = ((ssi->current_hack + p->screenhacks_count - 1)
-                        % p->screenhacks_count);
-        }
-      else if (si->selection_mode > 0)
-	{
-          /* Select a specific hack, by number (via the ACTIVATE command.) */
-	  new_hack = ((si->selection_mode - 1) % p->screenhacks_count);
-	  force = True;
-	}
-      else if (p->mode == ONE_HACK &&
-               p->selected_hack >= 0)
-	{
-          /* Select a specific hack, by number (via "One Saver" mode.) */
-          new_hack = p->selected_hack;
-	  force = True;
-	}
-      else if (p->mode == BLANK_ONLY || p->mode == DONT_BLANK)
-        {
-          new_hack = -1;
-        }
-      else if (p->mode == RANDOM_HACKS_SAME &&
-               ssi->number != 0)
-	{
-	  /* Use the same hack that's running on screen 0.
-             (Assumes this function was called on screen 0 first.)
-           */
-          new_hack = si->screens[0].current_hack;
-	}
-      else  /* (p->mode == RANDOM_HACKS) */
-	{
-	  /* Select a random hack (but not the one we just ran.) */
-	  while ((new_hack = random () % p->screenhacks_count)
-		 == ssi->current_hack)
-	    ;
-	}
+      if (new_hack == -2)
+        return;
 
+      ssi->current_hack = new_hack;
       if (new_hack < 0)   /* don't run a hack */
-        {
-          ssi->current_hack = -1;
-          goto DONE;
-        }
+        goto DONE;
 
-      ssi->current_hack = new_hack;
       hack = p->screenhacks[ssi->current_hack];
 
-      /* If the hack is disabled, or there is no visual for this hack,
-	 then try again (move forward, or backward, or re-randomize.)
-	 Unless this hack was specified explicitly, in which case,
-	 use it regardless.
-       */
-      if (force)
-        select_visual_of_hack (ssi, hack);
-        
-      if (!force &&
-	  (!hack->enabled_p ||
-	   !on_path_p (hack->command) ||
-	   !select_visual_of_hack (ssi, hack)))
-	{
-	  if (++retry_count > (p->screenhacks_count*4))
-	    {
-	      /* Uh, oops.  Odds are, there are no suitable visuals,
-		 and we're looping.  Give up.  (This is totally lame,
-		 what we should do is make a list of suitable hacks at
-		 the beginning, then only loop over them.)
-	      */
-	      if (p->verbose_p)
-		fprintf(stderr,
-		      "%s: %d: no programs enabled, or no suitable visuals\n",
-			blurb(), ssi->number);
-	      return;
-	    }
-	  else
-	    goto AGAIN;
-	}
-
       /* Install screenshot property on window. Must be after
          select_visual_of_hack() which might replace the window. */
       if (ssi->screenshot)
@@ -984,7 +1354,7 @@ spawn_screenhack (saver_screen_info *ssi)
           goto DONE;
         }
 
-      forked = fork_and_exec (ssi, hack->command);
+      forked = fork_and_exec (ssi, ssi->screensaver_window, hack->command);
       switch ((int) forked)
 	{
 	case -1: /* fork failed */
@@ -1086,6 +1456,9 @@ spawn_screenhack (saver_screen_info *ssi)
           fprintf (stderr, "%s: %d: next cycle in %lu sec at %s\n",
                    blurb(), ssi->number, how_long/1000, timestring(t));
         }
+
+      /* And a timer to launch the next hack a little before that. */
+      schedule_warm_timer (ssi, how_long);
     }
 }
 
@@ -1109,6 +1482,128 @@ kill_screenhack (saver_screen_info *ssi)
 }
 
 
+/* Kills the hack that was launched ahead of the cycle timer, if any, and
+   gets rid of its window.
+ */
+void
+kill_standby_screenhack (saver_screen_info *ssi)
+{
+  saver_info *si = ssi->global;
+  if (ssi->standby_pid)
+    {
+      /* A stopped process does not act on SIGTERM until it is continued. */
+      struct screenhack_job *job = find_job (ssi->standby_pid);
+      if (job && job->status == job_stopped)
+        kill_job (si, ssi->standby_pid, SIGCONT);
+      kill_job (si, ssi->standby_pid, SIGTERM);
+    }
+  ssi->standby_pid = 0;
+  destroy_standby_window (ssi);
+}
+
+
+/* Kills the standby hack, if any, because it no longer fits the screen,
+   and queues warm_timer to launch another one before the cycle timer
+   fires.  With less than a few seconds to go, the next hack just starts
+   cold instead.
+ */
+void
+restart_standby_screenhack (saver_screen_info *ssi)
+{
+  time_t now = time ((time_t *) 0);
+  kill_standby_screenhack (ssi);
+  schedule_warm_timer (ssi, (ssi->cycle_id && ssi->cycle_at > now
+                             ? (ssi->cycle_at - now) * 1000
+                             : 0));
+}
+
+
+/* hacks/screenhack.c sets the _SCREENSAVER_FIRST_FRAME property on its
+   window once it has drawn its first frame, with the times at which its
+   main() started and at which the frame was done.  Record how long the
+   hack took to get that far; and if it is a standby hack, suspend it until
+   it is swapped in.
+ */
+void
+screenhack_first_frame (saver_info *si, Window window)
+{
+  saver_preferences *p = &si->prefs;
+  saver_screen_info *ssi = 0;
+  struct screenhack_job *job;
+  Bool standby_p = False;
+  double started = 0, when = 0;
+  pid_t pid = 0;
+  int i;
+
+  for (i = 0; i < si->nscreens; i++)
+    {
+      ssi = &si->screens[i];
+      if (window == ssi->screensaver_window)
+        {
+          pid = ssi->pid;
+          break;
+        }
+      else if (window == ssi->standby_window)
+        {
+          pid = ssi->standby_pid;
+          standby_p = True;
+          break;
+        }
+    }
+
+  job = (pid ? find_job (pid) : 0);
+  if (!job || job->first_frame > 0)
+    return;
+
+  {
+    Atom type = 0;
+    int format = 0;
+    unsigned long nitems = 0, bytesafter = 0;
+    unsigned char *dataP = 0;
+
+    if (XGetWindowProperty (si->dpy, window, XA_SCREENSAVER_FIRST_FRAME,
+                            0, 4, False, XA_INTEGER, &type, &format,
+                            &nitems, &bytesafter, &dataP)
+        == Success
+        && dataP && type == XA_INTEGER && format == 32 && nitems == 4)
+      {
+        PROP32 *data = (PROP32 *) dataP;
+        started = data[0] + data[1] * 0.000001;
+        when    = data[2] + data[3] * 0.000001;
+      }
+    if (dataP) XFree (dataP);
+  }
+
+  /* If the property was missing or garbled, it's about now. */
+  if (when < job->start_time)
+    when = double_time();
+  if (started < job->start_time || started > when)
+    started = job->start_time;
+
+  job->exec_time   = started - job->start_time;
+  job->first_frame = when - job->start_time;
+  if (job->first_frame <= 0)
+    job->first_frame = 0.000001;
+
+  if (p->verbose_p)
+    fprintf (stderr, "%s: %d: pid %lu (%s) drew its first frame"
+             " in %.2f sec (%.2f sec to start)%s\n",
+             blurb(), ssi->number, (unsigned long) pid, job->name,
+             job->first_frame, job->exec_time,
+             (standby_p ? " (standby)" : ""));
+
+  record_hack_start (si, job);
+
+# ifdef SIGSTOP
+  if (standby_p && job->status == job_running)
+    {
+      job->run_start = 0;
+      kill_job (si, pid, SIGSTOP);
+    }
+# endif
+}
+
+
 Bool
 any_screenhacks_running_p (saver_info *si)
 {
@@ -197,6 +197,20 @@ struct saver_screen_info {
   time_t cycle_at;		/* When cycle_id will fire */
   int current_hack;		/* Index into `prefs.screenhacks' */
   pid_t pid;
+
+  /* The hack that the cycle timer will switch to.  It is launched a few
+     seconds early on a window stacked directly below the saver window, and
+     suspended once it has drawn its first frame, so that it is already
+     up and running when it is swapped in.  See warm_timer(). */
+  XtIntervalId warm_id;		/* Timer to launch the standby hack */
+  Window standby_window;	/* Not yet visible; 0 if none. */
+  Colormap standby_cmap;
+  unsigned long standby_black_pixel;
+  Visual *standby_visual;
+  Bool standby_install_cmap_p;
+  int standby_hack;		/* Index into `prefs.screenhacks' */
+  int standby_selection;	/* What si->selection_mode was then */
+  pid_t standby_pid;
 };
 
 
@@ -187,7 +187,8 @@ initialize_screensaver_window_1 (saver_screen_info *ssi)
 
   attrs.event_mask = (KeyPressMask | KeyReleaseMask |
 		      ButtonPressMask | ButtonReleaseMask |
-		      PointerMotionMask);
+		      PointerMotionMask |
+		      PropertyChangeMask);  /* See screenhack_first_frame() */
 
   attrs.backing_store = Always;
   attrs.colormap = ssi->cmap;
@@ -381,6 +382,9 @@ resize_screensaver_window (saver_info *si)
             fprintf (stderr, "%s: %d: someone horked our saver window"
                      " (0x%lx)!  Unable to resize it!\n",
                      blurb(), i, (unsigned long) ssi->screensaver_window);
+
+          /* The standby window is the old size too; start over. */
+          restart_standby_screenhack (ssi);
         }
 
       /* Now (if blanked) make sure that it's mapped and running a hack --
@@ -402,6 +406,12 @@ resize_screensaver_window (saver_info *si)
   for (; i < si->ssi_count; i++)
     {
       saver_screen_info *ssi = &si->screens[i];
+      if (ssi->warm_id)
+        {
+          XtRemoveTimeOut (ssi->warm_id);
+          ssi->warm_id = 0;
+        }
+      kill_standby_screenhack (ssi);
       if (ssi->pid)
         kill_screenhack (ssi);
       if (ssi->screensaver_window)
@@ -601,34 +611,17 @@ get_screen_gl_visual (saver_info *si, int real_screen_number)
 }
 
 
-Bool
-select_visual (saver_screen_info *ssi, const char *visual_name)
+/* Returns the visual that a hack asked for on this screen, or 0 if there
+   isn't one; and whether it needs a colormap of its own.
+ */
+static Visual *
+hack_visual (saver_screen_info *ssi, const char *visual_name,
+             Bool *install_cmap_p_ret)
 {
-  XWindowAttributes xgwa;
   saver_info *si = ssi->global;
   saver_preferences *p = &si->prefs;
   Bool install_cmap_p = p->install_cmap_p;
-  Bool was_installed_p = (ssi->cmap != DefaultColormapOfScreen(ssi->screen));
   Visual *new_v = 0;
-  Bool got_it;
-
-  /* On some systems (most recently, MacOS X) OpenGL programs get confused
-     when you kill one and re-start another on the same window.  So maybe
-     it's best to just always destroy and recreate the xscreensaver window
-     when changing hacks, instead of trying to reuse the old one?
-   */
-  Bool always_recreate_window_p = True;
-
-  get_screen_gl_visual (si, 0);   /* let's probe all the GL visuals early */
-
-  /* We make sure the existing window is actually on ssi->screen before
-     trying to use it, in case things moved around radically when monitors
-     were added or deleted.  If we don't do this we could get a BadMatch
-     even though the depths match.  I think.
-   */
-  memset (&xgwa, 0, sizeof(xgwa));
-  if (ssi->screensaver_window)
-    XGetWindowAttributes (si->dpy, ssi->screensaver_window, &xgwa);
 
   if (visual_name && *visual_name)
     {
@@ -657,12 +650,47 @@ select_visual (saver_screen_info *ssi, const char *visual_name)
       new_v = ssi->default_visual;
     }
 
-  got_it = !!new_v;
-
   if (new_v && new_v != DefaultVisualOfScreen(ssi->screen))
     /* It's not the default visual, so we have no choice but to install. */
     install_cmap_p = True;
 
+  *install_cmap_p_ret = install_cmap_p;
+  return new_v;
+}
+
+
+Bool
+select_visual (saver_screen_info *ssi, const char *visual_name)
+{
+  XWindowAttributes xgwa;
+  saver_info *si = ssi->global;
+  saver_preferences *p = &si->prefs;
+  Bool install_cmap_p;
+  Bool was_installed_p = (ssi->cmap != DefaultColormapOfScreen(ssi->screen));
+  Visual *new_v;
+  Bool got_it;
+
+  /* On some systems (most recently, MacOS X) OpenGL programs get confused
+     when you kill one and re-start another on the same window.  So maybe
+     it's best to just always destroy and recreate the xscreensaver window
+     when changing hacks, instead of trying to reuse the old one?
+   */
+  Bool always_recreate_window_p = True;
+
+  get_screen_gl_visual (si, 0);   /* let's probe all the GL visuals early */
+
+  /* We make sure the existing window is actually on ssi->screen before
+     trying to use it, in case things moved around radically when monitors
+     were added or deleted.  If we don't do this we could get a BadMatch
+     even though the depths match.  I think.
+   */
+  memset (&xgwa, 0, sizeof(xgwa));
+  if (ssi->screensaver_window)
+    XGetWindowAttributes (si->dpy, ssi->screensaver_window, &xgwa);
+
+  new_v = hack_visual (ssi, visual_name, &install_cmap_p);
+  got_it = !!new_v;
+
   ssi->install_cmap_p = install_cmap_p;
 
   if ((ssi->screen != xgwa.screen) ||
@@ -713,6 +741,141 @@ select_visual (saver_screen_info *ssi, const char *visual_name)
 }
 
 
+/* Creates the window on which the next hack will be launched ahead of the
+   cycle timer.  It is mapped directly below the saver window, so it can't
+   be seen, but it is viewable: with backing store, whatever the hack draws
+   while it warms up is kept, and is there when swap_standby_window() raises
+   it.  Returns False if there is no such visual.
+ */
+Bool
+create_standby_window (saver_screen_info *ssi, const char *visual_name)
+{
+  saver_info *si = ssi->global;
+  saver_preferences *p = &si->prefs;
+  XSetWindowAttributes attrs;
+  unsigned long attrmask;
+  Window windows[2];
+  Bool install_cmap_p;
+  Colormap cmap;
+  unsigned long black_pixel;
+  Visual *v;
+
+  get_screen_gl_visual (si, 0);
+  v = hack_visual (ssi, visual_name, &install_cmap_p);
+  if (!v) return False;
+
+  if (install_cmap_p)
+    {
+      XColor black;
+      black.red = black.green = black.blue = 0;
+      cmap = XCreateColormap (si->dpy, RootWindowOfScreen (ssi->screen),
+                              v, AllocNone);
+      if (! XAllocColor (si->dpy, cmap, &black)) abort ();
+      black_pixel = black.pixel;
+    }
+  else
+    {
+      cmap = DefaultColormapOfScreen (ssi->screen);
+      black_pixel = BlackPixelOfScreen (ssi->screen);
+    }
+
+  /* The rest of the attributes are set by initialize_screensaver_window_1()
+     once it is swapped in.  Until then we only want to hear about the
+     hack's first frame. */
+  attrmask = (CWOverrideRedirect | CWEventMask | CWBackingStore | CWColormap |
+	      CWBackPixel | CWBackingPixel | CWBorderPixel);
+  attrs.override_redirect = True;
+  attrs.event_mask = PropertyChangeMask;
+  attrs.backing_store = Always;
+  attrs.colormap = cmap;
+  attrs.background_pixel = black_pixel;
+  attrs.backing_pixel = black_pixel;
+  attrs.border_pixel = black_pixel;
+
+  ssi->standby_window =
+    XCreateWindow (si->dpy, RootWindowOfScreen (ssi->screen),
+                   ssi->x, ssi->y, ssi->width, ssi->height,
+                   0, visual_depth (ssi->screen, v), InputOutput,
+                   v, attrmask, &attrs);
+  xscreensaver_set_wm_atoms (si->dpy, ssi->standby_window,
+                             ssi->width, ssi->height, 0);
+  if (ssi->cursor)
+    XDefineCursor (si->dpy, ssi->standby_window, ssi->cursor);
+
+  windows[0] = ssi->screensaver_window;
+  windows[1] = ssi->standby_window;
+  XRestackWindows (si->dpy, windows, countof(windows));
+  XMapWindow (si->dpy, ssi->standby_window);
+
+  ssi->standby_cmap = cmap;
+  ssi->standby_black_pixel = black_pixel;
+  ssi->standby_visual = v;
+  ssi->standby_install_cmap_p = install_cmap_p;
+
+  if (p->verbose_p > 1)
+    fprintf (stderr, "%s: %d: standby window is 0x%lx\n",
+             blurb(), ssi->number, (unsigned long) ssi->standby_window);
+  return True;
+}
+
+
+/* The standby window becomes the saver window, and the old saver window
+   goes away.
+ */
+void
+swap_standby_window (saver_screen_info *ssi)
+{
+  saver_info *si = ssi->global;
+  saver_preferences *p = &si->prefs;
+  Colormap old_c = ssi->cmap;
+  Window old_w = ssi->screensaver_window;
+
+  if (! ssi->standby_window) abort();
+
+  ssi->screensaver_window = ssi->standby_window;
+  ssi->cmap           = ssi->standby_cmap;
+  ssi->black_pixel    = ssi->standby_black_pixel;
+  ssi->current_visual = ssi->standby_visual;
+  ssi->current_depth  = visual_depth (ssi->screen, ssi->current_visual);
+  ssi->install_cmap_p = ssi->standby_install_cmap_p;
+  ssi->standby_window = 0;
+  ssi->standby_cmap   = 0;
+
+  initialize_screensaver_window_1 (ssi);
+  raise_window (ssi);
+
+  defer_XDestroyWindow (si->app, si->dpy, old_w);
+
+  if (p->verbose_p > 1)
+    fprintf (stderr, "%s: %d: destroyed old saver window 0x%lx\n",
+             blurb(), ssi->number, (unsigned long) old_w);
+
+  if (old_c &&
+      old_c != DefaultColormapOfScreen (ssi->screen))
+    XFreeColormap (si->dpy, old_c);
+}
+
+
+void
+destroy_standby_window (saver_screen_info *ssi)
+{
+  saver_info *si = ssi->global;
+
+  if (! ssi->standby_window) return;
+
+  /* Unmap it now, in case we are about to unblank. */
+  XUnmapWindow (si->dpy, ssi->standby_window);
+  defer_XDestroyWindow (si->app, si->dpy, ssi->standby_window);
+
+  if (ssi->standby_cmap &&
+      ssi->standby_cmap != DefaultColormapOfScreen (ssi->screen))
+    XFreeColormap (si->dpy, ssi->standby_cmap);
+
+  ssi->standby_window = 0;
+  ssi->standby_cmap = 0;
+}
+
+
 /* Synchronize the contents of si->ssi to the current state of the monitors.
    Doesn't change anything if nothing has changed; otherwise, alters and
    reuses existing saver_screen_info structs as much as possible.
@@ -992,7 +1155,10 @@ watchdog_timer (XtPointer closure, XtIntervalId *id)
                  "%s: monitor has powered down; killing running hacks\n",
                  blurb());
       for (i = 0; i < si->nscreens; i++)
-        kill_screenhack (&si->screens[i]);
+        {
+          kill_standby_screenhack (&si->screens[i]);
+          kill_screenhack (&si->screens[i]);
+        }
       /* Do not clear current_hack here. */
     }
   else if (terminating_p)
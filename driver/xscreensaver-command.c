@@ -35,6 +35,7 @@
 #include "remote.h"
 #include "version.h"
 #include "atoms.h"
+#include "hackstats.h"
 
 #ifdef _VROOT_H_
 ERROR! you must not include vroot.h in this file
@@ -114,6 +115,11 @@ usage: %s -<option>\n\
                 is changed.  This option never returns; it is intended for\n\
                 use by shell scripts that want to react to the screensaver\n\
                 in some way.\n\
+\n\
+  -stats        Prints how expensive each graphics demo has been in its\n\
+                recent runs: how long it took to start and to draw its\n\
+                first frame, what fraction of a CPU it used, and its peak\n\
+                memory use.  The worst ones are listed first.\n\
 \n\
   -version      Prints the version of xscreensaver that is currently running\n\
                 on the display -- that is, the actual version number of the\n\
@@ -131,6 +137,7 @@ usage: %s -<option>\n\
  } while(0)
 
 static int watch (Display *);
+static int print_hack_stats (Display *);
 
 int
 main (int argc, char **argv)
@@ -192,6 +199,7 @@ main (int argc, char **argv)
       else if (!strncmp (s, "-version", L))    cmd = &XA_SCREENSAVER_VERSION;
       else if (!strncmp (s, "-time", L))       cmd = &XA_SCREENSAVER_STATUS;
       else if (!strncmp (s, "-watch", L))      cmd = &XA_WATCH;
+      else if (!strncmp (s, "-stats", L))      cmd = &XA_SCREENSAVER_HACK_STATS;
       else if (!strncmp (s, "-help", L))
         {
           fprintf (stderr, usage, progname, screensaver_version, year);
@@ -292,6 +300,12 @@ main (int argc, char **argv)
       exit (i);
     }
 
+  if (cmd == &XA_SCREENSAVER_HACK_STATS)
+    {
+      i = print_hack_stats (dpy);
+      exit (i);
+    }
+
   if (*cmd == XA_ACTIVATE || *cmd == XA_LOCK || *cmd == XA_SUSPEND || 
       *cmd == XA_NEXT || *cmd == XA_PREV || *cmd == XA_SELECT)
     /* People never guess that KeyRelease deactivates the screen saver too,
@@ -419,3 +433,106 @@ watch (Display *dpy)
         }
     }
 }
+
+
+/* Percent of one CPU, over the hack's runs. */
+static double
+hack_stats_cpu (const struct hack_stats *hs)
+{
+  return (hs->run_ms > 0 ? 100.0 * hs->cpu_ms / hs->run_ms : 0);
+}
+
+static int
+cmp_hack_stats (const void *aa, const void *bb)
+{
+  const struct hack_stats *a = (const struct hack_stats *) aa;
+  const struct hack_stats *b = (const struct hack_stats *) bb;
+  double ca = hack_stats_cpu (a), cb = hack_stats_cpu (b);
+  return (ca < cb ? 1 : ca > cb ? -1 : strcmp (a->name, b->name));
+}
+
+static int
+print_hack_stats (Display *dpy)
+{
+  Atom type;
+  int format;
+  unsigned long nitems, bytesafter;
+  unsigned char *dataP = 0;
+  struct hack_stats *stats = 0;
+  int count = 0;
+  char *line;
+  int i;
+
+  if (! (XGetWindowProperty (dpy,
+                             RootWindow (dpy, 0),  /* always screen #0 */
+                             XA_SCREENSAVER_HACK_STATS,
+                             0, 1024 * 1024, False, XA_STRING,
+                             &type, &format, &nitems, &bytesafter,
+                             &dataP)
+         == Success
+         && type == XA_STRING
+         && dataP))
+    {
+      if (dataP) XFree (dataP);
+      fprintf (stderr, "%s: no hack statistics on root window\n", progname);
+      return -1;
+    }
+
+  line = (char *) dataP;
+  while (*line)
+    {
+      struct hack_stats hs;
+      char *nl = strchr (line, '\n');
+      if (nl) *nl = 0;
+      memset (&hs, 0, sizeof(hs));
+      if (8 == sscanf (line, HACK_STATS_SCAN_FORMAT,
+                       hs.name, &hs.runs, &hs.run_ms, &hs.cpu_ms,
+                       &hs.max_rss, &hs.starts, &hs.exec_ms,
+                       &hs.first_frame_ms))
+        {
+          stats = (struct hack_stats *)
+            realloc (stats, (count + 1) * sizeof (*stats));
+          if (! stats) abort();
+          stats[count++] = hs;
+        }
+      if (!nl) break;
+      line = nl + 1;
+    }
+  XFree (dataP);
+
+  qsort (stats, count, sizeof (*stats), cmp_hack_stats);
+
+  fprintf (stdout, "%-24s %5s %7s %9s %8s %9s\n",
+           "hack", "runs", "CPU", "max RSS", "start", "1st frame");
+  for (i = 0; i < count; i++)
+    {
+      struct hack_stats *hs = &stats[i];
+      char cpu[20], rss[20], start[20], frame[20];
+      if (hs->runs)
+        {
+          sprintf (cpu, "%.1f%%", hack_stats_cpu (hs));
+          sprintf (rss, "%.1f MB", hs->max_rss / 1024.0);
+        }
+      else
+        {
+          strcpy (cpu, "-");
+          strcpy (rss, "-");
+        }
+      if (hs->starts)
+        {
+          sprintf (start, "%.2fs", hs->exec_ms / 1000.0 / hs->starts);
+          sprintf (frame, "%.2fs", hs->first_frame_ms / 1000.0 / hs->starts);
+        }
+      else
+        {
+          strcpy (start, "-");
+          strcpy (frame, "-");
+        }
+      fprintf (stdout, "%-24s %5ld %7s %9s %8s %9s\n",
+               hs->name, (hs->runs > hs->starts ? hs->runs : hs->starts),
+               cpu, rss, start, frame);
+    }
+
+  free (stats);
+  return 0;
+}
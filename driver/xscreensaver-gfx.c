@@ -91,12 +91,17 @@ maybe_reload_init_file (saver_info *si)
   if (init_file_changed_p (p))
     {
       Bool ov = p->verbose_p;
+      int i;
       if (p->verbose_p)
 	fprintf (stderr, "%s: file \"%s\" has changed, reloading\n",
 		 blurb(), init_file_name());
 
       load_init_file (si->dpy, p);
 
+      /* The standby hacks were picked from the old list. */
+      for (i = 0; i < si->nscreens; i++)
+        kill_standby_screenhack (&si->screens[i]);
+
       if (ov)
         p->verbose_p = True;
 
@@ -391,6 +396,10 @@ main_loop (saver_info *si, Bool init_p)
 
       if (event.x_event.xany.type == ClientMessage)
         handle_clientmessage (si, &event.x_event);
+      else if (event.x_event.xany.type == PropertyNotify &&
+               event.x_event.xproperty.state == PropertyNewValue &&
+               event.x_event.xproperty.atom == XA_SCREENSAVER_FIRST_FRAME)
+        screenhack_first_frame (si, event.x_event.xproperty.window);
 # ifdef HAVE_RANDR
       else if (si->using_randr_extension &&
                (event.x_event.type == 
@@ -53,6 +53,10 @@ extern void initialize_screensaver_window (saver_info *si);
 extern void blank_screen (saver_info *si);
 extern void unblank_screen (saver_info *si);
 extern void resize_screensaver_window (saver_info *si);
+extern Bool create_standby_window (saver_screen_info *ssi,
+                                   const char *visual_name);
+extern void swap_standby_window (saver_screen_info *ssi);
+extern void destroy_standby_window (saver_screen_info *ssi);
 
 extern void get_screen_viewport (saver_screen_info *ssi,
                                  int *x_ret, int *y_ret,
@@ -83,6 +87,9 @@ extern void hack_environment (saver_info *si);
 extern void init_sigchld (saver_info *si);
 extern void spawn_screenhack (saver_screen_info *ssi);
 extern void kill_screenhack (saver_screen_info *ssi);
+extern void kill_standby_screenhack (saver_screen_info *ssi);
+extern void restart_standby_screenhack (saver_screen_info *ssi);
+extern void screenhack_first_frame (saver_info *si, Window window);
 extern Bool any_screenhacks_running_p (saver_info *si);
 extern Bool select_visual (saver_screen_info *ssi, const char *visual_name);
 extern void store_saver_status (saver_info *si);
@@ -17,274 +17,443 @@
 
    http://paulbourke.net/papers/triangulate/
    http://paulbourke.net/papers/triangulate/triangulate.c
+
+   Bourke's version tested each new point against every triangle built
+   so far, which is O(n^2): fine for a few hundred points, minutes for
+   tessellimage's tens of thousands.  This is the same idea (Bowyer-Watson:
+   remove the triangles whose circumcircles contain the new point, then
+   fan the hole out from it) done in O(n log n):
+
+   - Points are inserted in the order of a Hilbert curve through them, so
+     that each one lands near the previous one.
+
+   - The triangle containing a new point is found by walking towards it
+     from the last triangle made, and the triangles to remove are found
+     by flooding out from there, instead of by looking at all of them.
+
+   - Triangles know their neighbours (as half-edges; see delaunay.h), and
+     the outside of the convex hull is covered by "ghost" triangles with a
+     vertex at infinity, instead of by a giant supertriangle.  That keeps
+     all the arithmetic on the input coordinates, where it is exact for
+     integer coordinates up to about 2^16, as tessellimage's are, and it
+     triangulates right up to the hull.
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "delaunay.h"
 
 typedef struct {
-   int p1,p2;
-} IEDGE;
+  const XYZ *p;
+  int ghost;			/* Index of the point at infinity: nv. */
+  int *vertex, *twin;
+  int ntri;
+  int last;			/* Where to start the next walk from. */
 
-#define TRUE 1
-#define FALSE 0
-#define EPSILON 0.000001
+  int *mark, stamp;		/* Scratch for one insertion. */
+  int *cavity, *bound, *spoke;
+  int *ba, *bb;
+} builder;
 
-/*
-   Return TRUE if a point (xp,yp) is inside the circumcircle made up
-   of the points (x1,y1), (x2,y2), (x3,y3)
-   The circumcircle centre is returned in (xc,yc) and the radius r
-   NOTE: A point on the edge is inside the circumcircle
-*/
+typedef struct {
+  unsigned key;
+  int i;
+} hilbert_point;
+
+
+/* Twice the signed area of a, b, c: positive if c is left of a->b. */
+static double
+orient (const XYZ *a, const XYZ *b, const XYZ *c)
+{
+  return (b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x);
+}
+
+/* Positive if d is inside the circumcircle of counterclockwise a, b, c. */
+static double
+incircle (const XYZ *a, const XYZ *b, const XYZ *c, const XYZ *d)
+{
+  double adx = a->x - d->x, ady = a->y - d->y;
+  double bdx = b->x - d->x, bdy = b->y - d->y;
+  double cdx = c->x - d->x, cdy = c->y - d->y;
+  return ((adx * adx + ady * ady) * (bdx * cdy - cdx * bdy) +
+          (bdx * bdx + bdy * bdy) * (cdx * ady - adx * cdy) +
+          (cdx * cdx + cdy * cdy) * (adx * bdy - bdx * ady));
+}
+
+
+/* Whether point p is in the circumcircle of triangle t.  For a ghost
+   triangle, that's the open half-plane outside its hull edge, plus the
+   inside of the edge itself.
+ */
+static int
+in_circle (const builder *b, int t, const XYZ *p)
+{
+  const int *v = b->vertex + 3 * t;
+  int k;
+  for (k = 0; k < 3; k++)
+    if (v[k] == b->ghost)
+      {
+        const XYZ *u = &b->p[v[(k + 1) % 3]];
+        const XYZ *w = &b->p[v[(k + 2) % 3]];
+        double o = orient (u, w, p);
+        if (o != 0) return o > 0;
+        return ((p->x - u->x) * (w->x - u->x) +
+                (p->y - u->y) * (w->y - u->y) > 0 &&
+                (p->x - w->x) * (u->x - w->x) +
+                (p->y - w->y) * (u->y - w->y) > 0);
+      }
+  return incircle (&b->p[v[0]], &b->p[v[1]], &b->p[v[2]], p) > 0;
+}
+
+
+static int
+ghost_p (const builder *b, int t)
+{
+  const int *v = b->vertex + 3 * t;
+  return v[0] == b->ghost || v[1] == b->ghost || v[2] == b->ghost;
+}
+
+
+/* Returns the real triangle containing p (perhaps on an edge), or the
+   ghost triangle beyond a hull edge that p is outside of.
+ */
 static int
-circumcircle (double xp,double yp,
-              double x1,double y1,double x2,double y2,double x3,double y3,
-              double *xc,double *yc,double *rsqr)
+locate (const builder *b, const XYZ *p)
 {
-  double m1,m2,mx1,mx2,my1,my2;
-  double dx,dy,drsqr;
-  double fabsy1y2 = fabs(y1-y2);
-  double fabsy2y3 = fabs(y2-y3);
-
-  /* Check for coincident points */
-  if (fabsy1y2 < EPSILON && fabsy2y3 < EPSILON)
-    return(FALSE);
-
-  if (fabsy1y2 < EPSILON) {
-    m2 = - (x3-x2) / (y3-y2);
-    mx2 = (x2 + x3) / 2.0;
-    my2 = (y2 + y3) / 2.0;
-    *xc = (x2 + x1) / 2.0;
-    *yc = m2 * (*xc - mx2) + my2;
-  } else if (fabsy2y3 < EPSILON) {
-    m1 = - (x2-x1) / (y2-y1);
-    mx1 = (x1 + x2) / 2.0;
-    my1 = (y1 + y2) / 2.0;
-    *xc = (x3 + x2) / 2.0;
-    *yc = m1 * (*xc - mx1) + my1;
-  } else {
-    m1 = - (x2-x1) / (y2-y1);
-    m2 = - (x3-x2) / (y3-y2);
-    mx1 = (x1 + x2) / 2.0;
-    mx2 = (x2 + x3) / 2.0;
-    my1 = (y1 + y2) / 2.0;
-    my2 = (y2 + y3) / 2.0;
-    *xc = (m1 * mx1 - m2 * mx2 + my2 - my1) / (m1 - m2);
-    if (fabsy1y2 > fabsy2y3) {
-      *yc = m1 * (*xc - mx1) + my1;
-    } else {
-      *yc = m2 * (*xc - mx2) + my2;
+  int t = b->last;
+  int steps = 0;
+
+  for (;;)
+    {
+      int k, e = 3 * t;
+      if (ghost_p (b, t))
+        return t;
+      for (k = 0; k < 3; k++)
+        if (orient (&b->p[b->vertex[e + k]],
+                    &b->p[b->vertex[DELAUNAY_NEXT (e + k)]], p) < 0)
+          break;
+      if (k == 3)
+        return t;
+      t = b->twin[e + k] / 3;
+
+      /* A walk through a Delaunay triangulation always gets there, but
+         just in case rounding says otherwise, don't go around forever. */
+      if (++steps > b->ntri)
+        break;
     }
-  }
 
-  dx = x2 - *xc;
-  dy = y2 - *yc;
-  *rsqr = dx*dx + dy*dy;
+  for (t = 0; t < b->ntri; t++)
+    if (in_circle (b, t, p))
+      return t;
+  return b->last;
+}
+
 
-  dx = xp - *xc;
-  dy = yp - *yc;
-  drsqr = dx*dx + dy*dy;
+/* Adds point i to the triangulation.  Returns 0 if it was skipped. */
+static int
+insert (builder *b, int i)
+{
+  const XYZ *p = &b->p[i];
+  int t = locate (b, p);
+  int ncavity = 0, nbound = 0;
+  int j, k;
+
+  if (! ghost_p (b, t))
+    for (k = 0; k < 3; k++)
+      {
+        const XYZ *q = &b->p[b->vertex[3 * t + k]];
+        if (q->x == p->x && q->y == p->y)
+          return 0;
+      }
 
-  /* Original
-     return((drsqr <= *rsqr) ? TRUE : FALSE);
-     Proposed by Chuck Morris */
-  return((drsqr - *rsqr) <= EPSILON ? TRUE : FALSE);
+  /* Flood out from t through every triangle whose circumcircle contains
+     p.  Those make a star-shaped hole around p; remember its edges. */
+  b->stamp++;
+  b->mark[t] = b->stamp;
+  b->cavity[ncavity++] = t;
+  for (j = 0; j < ncavity; j++)
+    for (k = 0; k < 3; k++)
+      {
+        int e = 3 * b->cavity[j] + k;
+        int n = b->twin[e] / 3;
+        if (b->mark[n] == b->stamp)
+          continue;
+        if (in_circle (b, n, p))
+          {
+            b->mark[n] = b->stamp;
+            b->cavity[ncavity++] = n;
+          }
+        else
+          {
+            b->bound[nbound] = b->twin[e];
+            b->ba[nbound] = b->vertex[e];
+            b->bb[nbound] = b->vertex[DELAUNAY_NEXT (e)];
+            nbound++;
+          }
+      }
+
+  /* A hole that isn't a disc means the arithmetic let us down; leave the
+     point out rather than make a mess. */
+  if (nbound != ncavity + 2)
+    return 0;
+
+  /* One new triangle per edge of the hole: the old triangles' slots, and
+     two more. */
+  b->cavity[ncavity++] = b->ntri++;
+  b->cavity[ncavity++] = b->ntri++;
+
+  for (j = 0; j < nbound; j++)
+    {
+      int e = 3 * b->cavity[j];
+      b->vertex[e]     = b->ba[j];
+      b->vertex[e + 1] = b->bb[j];
+      b->vertex[e + 2] = i;
+      b->twin[e] = b->bound[j];
+      b->twin[b->bound[j]] = e;
+      b->spoke[b->bb[j]] = e + 1;		/* bb -> i */
+    }
+  for (j = 0; j < nbound; j++)
+    {
+      int e = 3 * b->cavity[j] + 2;		/* i -> ba */
+      b->twin[e] = b->spoke[b->ba[j]];
+      b->twin[b->spoke[b->ba[j]]] = e;
+    }
+
+  for (j = 0; j < nbound; j++)
+    if (b->ba[j] != b->ghost && b->bb[j] != b->ghost)
+      {
+        b->last = b->cavity[j];
+        break;
+      }
+  return 1;
+}
+
+
+/* Position of x,y along a Hilbert curve filling an n x n square. */
+static unsigned
+hilbert (unsigned n, unsigned x, unsigned y)
+{
+  unsigned s, d = 0;
+  for (s = n / 2; s > 0; s /= 2)
+    {
+      unsigned rx = (x & s) != 0;
+      unsigned ry = (y & s) != 0;
+      d += s * s * ((3 * rx) ^ ry);
+      if (! ry)
+        {
+          unsigned t;
+          if (rx)
+            {
+              x = s - 1 - x;
+              y = s - 1 - y;
+            }
+          t = x; x = y; y = t;
+        }
+    }
+  return d;
+}
+
+static int
+hilbert_compare (const void *v1, const void *v2)
+{
+  const hilbert_point *h1 = v1, *h2 = v2;
+  if (h1->key < h2->key) return -1;
+  if (h1->key > h2->key) return 1;
+  return h1->i - h2->i;
 }
 
 
-/*
-   Triangulation subroutine
-   Takes as input NV vertices in array pxyz
-   Returned is a list of ntri triangular faces in the array v
-   These triangles are arranged in a consistent clockwise order.
-   The triangle array 'v' should be malloced to 3 * nv
-   The vertex array pxyz must be big enough to hold 3 more points
-   The vertex array must be sorted in increasing x values say
-   qsort(p,nv,sizeof(XYZ),XYZCompare);
-*/
 int
-delaunay (int nv,XYZ *pxyz,ITRIANGLE *v,int *ntri)
+delaunay_mesh (int nv, const XYZ *pxyz, DELAUNAY_MESH *m)
 {
-  int *complete = NULL;
-  IEDGE *edges = NULL;
-  int nedge = 0;
-  int trimax,emax = 200;
+  builder b;
+  hilbert_point *order = NULL;
+  int *map = NULL;
+  int maxtri = 2 * nv + 2;
   int status = 0;
+  int i, j, a, c, d;
+  double xmin, xmax, ymin, ymax, scale;
 
-  int inside;
-  int i,j,k;
-  double xp,yp,x1,y1,x2,y2,x3,y3,xc=0,yc=0,r=0;
-  double xmin,xmax,ymin,ymax,xmid,ymid;
-  double dx,dy,dmax;
+  m->ntri = 0;
+  m->vertex = m->twin = NULL;
+  m->edge = NULL;
+  memset (&b, 0, sizeof(b));
+  b.p = pxyz;
+  b.ghost = nv;
 
-  /* Allocate memory for the completeness list, flag for each triangle */
-  trimax = 4 * nv;
-  if ((complete = malloc(trimax*sizeof(int))) == NULL) {
-    status = 1;
-    goto skip;
-  }
+  if (maxtri < 4) maxtri = 4;
+  if (! (m->edge    = malloc (nv * sizeof(*m->edge) + 1)) ||
+      ! (order      = malloc (nv * sizeof(*order) + 1)) ||
+      ! (b.vertex   = malloc (3 * maxtri * sizeof(*b.vertex))) ||
+      ! (b.twin     = malloc (3 * maxtri * sizeof(*b.twin))) ||
+      ! (b.mark     = calloc (maxtri, sizeof(*b.mark))) ||
+      ! (b.cavity   = malloc ((maxtri + 2) * sizeof(*b.cavity))) ||
+      ! (b.bound    = malloc ((maxtri + 2) * sizeof(*b.bound))) ||
+      ! (b.ba       = malloc ((maxtri + 2) * sizeof(*b.ba))) ||
+      ! (b.bb       = malloc ((maxtri + 2) * sizeof(*b.bb))) ||
+      ! (b.spoke    = malloc ((nv + 1) * sizeof(*b.spoke))))
+    {
+      status = 1;
+      goto skip;
+    }
 
-  /* Allocate memory for the edge list */
-  if ((edges = malloc(emax*(long)sizeof(IEDGE))) == NULL) {
-    status = 2;
+  for (i = 0; i < nv; i++)
+    m->edge[i] = -1;
+  if (nv < 3)
     goto skip;
-  }
 
-  /*
-    Find the maximum and minimum vertex bounds.
-    This is to allow calculation of the bounding triangle
-  */
-  xmin = pxyz[0].x;
-  ymin = pxyz[0].y;
-  xmax = xmin;
-  ymax = ymin;
-  for (i=1;i<nv;i++) {
-    if (pxyz[i].x < xmin) xmin = pxyz[i].x;
-    if (pxyz[i].x > xmax) xmax = pxyz[i].x;
-    if (pxyz[i].y < ymin) ymin = pxyz[i].y;
-    if (pxyz[i].y > ymax) ymax = pxyz[i].y;
-  }
-  dx = xmax - xmin;
-  dy = ymax - ymin;
-  dmax = (dx > dy) ? dx : dy;
-  xmid = (xmax + xmin) / 2.0;
-  ymid = (ymax + ymin) / 2.0;
-
-  /*
-    Set up the supertriangle
-    This is a triangle which encompasses all the sample points.
-    The supertriangle coordinates are added to the end of the
-    vertex list. The supertriangle is the first triangle in
-    the triangle list.
-  */
-  pxyz[nv+0].x = xmid - 20 * dmax;
-  pxyz[nv+0].y = ymid - dmax;
-  pxyz[nv+0].z = 0.0;
-  pxyz[nv+1].x = xmid;
-  pxyz[nv+1].y = ymid + 20 * dmax;
-  pxyz[nv+1].z = 0.0;
-  pxyz[nv+2].x = xmid + 20 * dmax;
-  pxyz[nv+2].y = ymid - dmax;
-  pxyz[nv+2].z = 0.0;
-  v[0].p1 = nv;
-  v[0].p2 = nv+1;
-  v[0].p3 = nv+2;
-  complete[0] = FALSE;
-  *ntri = 1;
-
-  /*
-    Include each point one at a time into the existing mesh
-  */
-  for (i=0;i<nv;i++) {
-
-    xp = pxyz[i].x;
-    yp = pxyz[i].y;
-    nedge = 0;
-
-    /*
-      Set up the edge buffer.
-      If the point (xp,yp) lies inside the circumcircle then the
-      three edges of that triangle are added to the edge buffer
-      and that triangle is removed.
-    */
-    for (j=0;j<(*ntri);j++) {
-      if (complete[j])
-        continue;
-      x1 = pxyz[v[j].p1].x;
-      y1 = pxyz[v[j].p1].y;
-      x2 = pxyz[v[j].p2].x;
-      y2 = pxyz[v[j].p2].y;
-      x3 = pxyz[v[j].p3].x;
-      y3 = pxyz[v[j].p3].y;
-      inside = circumcircle(xp,yp,x1,y1,x2,y2,x3,y3,&xc,&yc,&r);
-      if (xc < xp && ((xp-xc)*(xp-xc)) > r)
-        complete[j] = TRUE;
-      if (inside) {
-        /* Check that we haven't exceeded the edge list size */
-        if (nedge+3 >= emax) {
-          IEDGE *edges_old = edges;
-          emax += 100;
-          if ((edges = realloc(edges,emax*(long)sizeof(IEDGE))) == NULL) {
-            edges = edges_old;
-            status = 3;
-            goto skip;
-          }
-        }
-        edges[nedge+0].p1 = v[j].p1;
-        edges[nedge+0].p2 = v[j].p2;
-        edges[nedge+1].p1 = v[j].p2;
-        edges[nedge+1].p2 = v[j].p3;
-        edges[nedge+2].p1 = v[j].p3;
-        edges[nedge+2].p2 = v[j].p1;
-        nedge += 3;
-        v[j] = v[(*ntri)-1];
-        complete[j] = complete[(*ntri)-1];
-        (*ntri)--;
-        j--;
-      }
+  /* Sort the points along a Hilbert curve through their bounding box. */
+  xmin = xmax = pxyz[0].x;
+  ymin = ymax = pxyz[0].y;
+  for (i = 1; i < nv; i++)
+    {
+      if (pxyz[i].x < xmin) xmin = pxyz[i].x;
+      if (pxyz[i].x > xmax) xmax = pxyz[i].x;
+      if (pxyz[i].y < ymin) ymin = pxyz[i].y;
+      if (pxyz[i].y > ymax) ymax = pxyz[i].y;
     }
-
-    /*
-      Tag multiple edges
-      Note: if all triangles are specified anticlockwise then all
-      interior edges are opposite pointing in direction.
-    */
-    for (j=0;j<nedge-1;j++) {
-      for (k=j+1;k<nedge;k++) {
-        if ((edges[j].p1 == edges[k].p2) && (edges[j].p2 == edges[k].p1)) {
-          edges[j].p1 = -1;
-          edges[j].p2 = -1;
-          edges[k].p1 = -1;
-          edges[k].p2 = -1;
-        }
-        /* Shouldn't need the following, see note above */
-        if ((edges[j].p1 == edges[k].p1) && (edges[j].p2 == edges[k].p2)) {
-          edges[j].p1 = -1;
-          edges[j].p2 = -1;
-          edges[k].p1 = -1;
-          edges[k].p2 = -1;
-        }
-      }
+  scale = (xmax - xmin > ymax - ymin ? xmax - xmin : ymax - ymin);
+  scale = (scale > 0 ? 65535 / scale : 0);
+  for (i = 0; i < nv; i++)
+    {
+      order[i].key = hilbert (65536,
+                              (unsigned) ((pxyz[i].x - xmin) * scale),
+                              (unsigned) ((pxyz[i].y - ymin) * scale));
+      order[i].i = i;
     }
+  qsort (order, nv, sizeof(*order), hilbert_compare);
 
-    /*
-      Form new triangles for the current point
-      Skipping over any tagged edges.
-      All edges are arranged in clockwise order.
-    */
-    for (j=0;j<nedge;j++) {
-      if (edges[j].p1 < 0 || edges[j].p2 < 0)
-        continue;
-      if ((*ntri) >= trimax) {
-        status = 4;
-        goto skip;
+  /* Start with the first three points that make a proper triangle. */
+  a = order[0].i;
+  for (c = 1; c < nv; c++)
+    if (pxyz[order[c].i].x != pxyz[a].x || pxyz[order[c].i].y != pxyz[a].y)
+      break;
+  for (d = c + 1; d < nv; d++)
+    if (orient (&pxyz[a], &pxyz[order[c].i], &pxyz[order[d].i]) != 0)
+      break;
+  if (d >= nv)
+    goto skip;		/* All on one line: no triangles. */
+
+  {
+    int p0 = a, p1 = order[c].i, p2 = order[d].i, g = b.ghost;
+    static const int twins[12] = { 3, 6, 9, 0, 11, 7, 1, 5, 10, 2, 8, 4 };
+    int verts[12];
+
+    if (orient (&pxyz[p0], &pxyz[p1], &pxyz[p2]) < 0)
+      {
+        int t = p1; p1 = p2; p2 = t;
       }
-      v[*ntri].p1 = edges[j].p1;
-      v[*ntri].p2 = edges[j].p2;
-      v[*ntri].p3 = i;
-      complete[*ntri] = FALSE;
-      (*ntri)++;
-    }
+    /* The triangle, and a ghost beyond each of its edges. */
+    verts[0] = p0; verts[1]  = p1; verts[2]  = p2;
+    verts[3] = p1; verts[4]  = p0; verts[5]  = g;
+    verts[6] = p2; verts[7]  = p1; verts[8]  = g;
+    verts[9] = p0; verts[10] = p2; verts[11] = g;
+    for (i = 0; i < 12; i++)
+      {
+        b.vertex[i] = verts[i];
+        b.twin[i] = twins[i];
+      }
+    b.ntri = 4;
+    b.last = 0;
+    m->edge[p0] = m->edge[p1] = m->edge[p2] = 0;
   }
 
-  /*
-    Remove triangles with supertriangle vertices
-    These are triangles which have a vertex number greater than nv
-  */
-  for (i=0;i<(*ntri);i++) {
-    if (v[i].p1 >= nv || v[i].p2 >= nv || v[i].p3 >= nv) {
-      v[i] = v[(*ntri)-1];
-      (*ntri)--;
-      i--;
+  for (i = 1; i < nv; i++)
+    if (i != c && i != d)
+      if (insert (&b, order[i].i))
+        m->edge[order[i].i] = 0;
+
+  /* Drop the ghosts, and renumber. */
+  if (! (map = malloc (b.ntri * sizeof(*map))))
+    {
+      status = 1;
+      goto skip;
     }
-  }
+  for (i = j = 0; i < b.ntri; i++)
+    map[i] = ghost_p (&b, i) ? -1 : j++;
+  for (i = 0; i < b.ntri; i++)
+    if (map[i] >= 0)
+      for (a = 0; a < 3; a++)
+        {
+          int e = 3 * map[i] + a;
+          int t = b.twin[3 * i + a];
+          b.vertex[e] = b.vertex[3 * i + a];
+          b.twin[e] = (map[t / 3] < 0 ? -1 : 3 * map[t / 3] + t % 3);
+        }
+  m->ntri = j;
+
+  for (i = 0; i < nv; i++)
+    if (m->edge[i] == 0)
+      m->edge[i] = -2;		/* In the mesh; not yet found. */
+  for (i = 0; i < 3 * m->ntri; i++)
+    {
+      int v = b.vertex[i];
+      if (b.twin[i] < 0 || m->edge[v] == -2)
+        m->edge[v] = i;
+    }
+  for (i = 0; i < nv; i++)
+    if (m->edge[i] == -2)
+      m->edge[i] = -1;
+
+  m->vertex = b.vertex;
+  m->twin = b.twin;
+  b.vertex = b.twin = NULL;
 
  skip:
-  free(edges);
-  free(complete);
-  return(status);
+  free (map);
+  free (order);
+  free (b.vertex);
+  free (b.twin);
+  free (b.mark);
+  free (b.cavity);
+  free (b.bound);
+  free (b.ba);
+  free (b.bb);
+  free (b.spoke);
+  if (status)
+    delaunay_mesh_free (m);
+  return status;
+}
+
+
+void
+delaunay_mesh_free (DELAUNAY_MESH *m)
+{
+  free (m->vertex);
+  free (m->twin);
+  free (m->edge);
+  m->vertex = m->twin = m->edge = NULL;
+  m->ntri = 0;
+}
+
+
+/*
+   Triangulation subroutine
+   Takes as input NV vertices in array pxyz
+   Returned is a list of ntri triangular faces in the array v
+   These triangles are arranged in a consistent clockwise order.
+   The triangle array 'v' should be malloced to 3 * nv
+*/
+int
+delaunay (int nv,XYZ *pxyz,ITRIANGLE *v,int *ntri)
+{
+  DELAUNAY_MESH m;
+  int i;
+
+  *ntri = 0;
+  if (delaunay_mesh (nv, pxyz, &m))
+    return 1;
+  for (i = 0; i < m.ntri; i++)
+    {
+      v[i].p1 = m.vertex[3 * i];
+      v[i].p2 = m.vertex[3 * i + 1];
+      v[i].p3 = m.vertex[3 * i + 2];
+    }
+  *ntri = m.ntri;
+  delaunay_mesh_free (&m);
+  return 0;
 }
 
 
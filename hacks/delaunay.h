@@ -17,6 +17,9 @@
 
    http://paulbourke.net/papers/triangulate/
    http://paulbourke.net/papers/triangulate/triangulate.c
+
+   The triangulation itself is no longer Bourke's code, which compared
+   every new point against every triangle so far; see delaunay.c.
  */
 
 #ifndef __DELAUNAY_H__
@@ -30,6 +33,37 @@ typedef struct {
    int p1,p2,p3;
 } ITRIANGLE;
 
+/* A triangulation as an array of half-edges.  Half-edge e belongs to
+   triangle e/3 and runs from point vertex[e] to point vertex[next(e)];
+   the three half-edges of a triangle go counterclockwise (with y up, or
+   clockwise on the screen).  twin[e] is the same edge running the other
+   way in the neighbouring triangle, or -1 if e is on the convex hull.
+
+   edge[i] is a half-edge leaving point i, or -1 if point i is not part
+   of the triangulation (it was a duplicate).  For a point on the hull,
+   it is the hull half-edge, so that the loop
+
+     e = edge[i];
+     do e = twin[DELAUNAY_PREV(e)]; while (e >= 0 && e != edge[i]);
+
+   visits every triangle around point i, counterclockwise, in one go.
+   That's the Voronoi cell of point i, in order, without any sorting.
+ */
+typedef struct {
+   int ntri;
+   int *vertex, *twin, *edge;
+} DELAUNAY_MESH;
+
+#define DELAUNAY_NEXT(e) ((e) % 3 == 2 ? (e) - 2 : (e) + 1)
+#define DELAUNAY_PREV(e) ((e) % 3 == 0 ? (e) + 2 : (e) - 1)
+
+/* Triangulates the NV points in pxyz, in any order, into *m.
+   Returns non-zero if it ran out of memory.
+   Free the result with delaunay_mesh_free().
+ */
+extern int delaunay_mesh (int nv, const XYZ *pxyz, DELAUNAY_MESH *m);
+extern void delaunay_mesh_free (DELAUNAY_MESH *m);
+
 /*
    Takes as input NV vertices in array pxyz
    Returned is a list of ntri triangular faces in the array v
@@ -37,6 +71,7 @@ typedef struct {
    The triangle array 'v' should be malloced to 3 * nv
    The vertex array pxyz must be big enough to hold 3 more points
    The vertex array must be sorted in increasing x values
+   (The last two are no longer necessary, but don't hurt.)
  */
 extern int delaunay (int nv, XYZ *pxyz, ITRIANGLE *v, int *ntri);
 
@@ -45,4 +80,3 @@ extern int delaunay_xyzcompare (const void *v1, const void *v2);
 
 
 #endif /* __DELAUNAY_H__ */
-
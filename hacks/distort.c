@@ -39,6 +39,7 @@
 #include <math.h>
 #include <time.h>
 #include "screenhack.h"
+#include "rowwriter.h"
 /*#include <X11/Xmd.h>*/
 # include "xshm.h"
 
@@ -70,6 +71,9 @@ struct state {
 
   XImage *orig_map, *buffer_map;
   unsigned long *buffer_map_cache;
+  row_writer orig_writer, buffer_writer;
+  int *row_xs, *row_ys, *row_blacks;	/* one row of the lense */
+  unsigned long *row_pixels;
 
   int ***from;
   int ****from_array;
@@ -327,6 +331,22 @@ distort_finish_loading (struct state *st)
 	                                   ZPixmap, &st->shm_info,
 	                                   2*st->radius + st->speed + 2,
 	                                   2*st->radius + st->speed + 2);
+	init_row_writer (&st->orig_writer, st->orig_map);
+	init_row_writer (&st->buffer_writer, st->buffer_map);
+
+    if (st->row_xs) free (st->row_xs);
+    if (st->row_ys) free (st->row_ys);
+    if (st->row_blacks) free (st->row_blacks);
+    if (st->row_pixels) free (st->row_pixels);
+	st->row_xs = malloc (sizeof(int) * (2*st->radius + st->speed + 2));
+	st->row_ys = malloc (sizeof(int) * (2*st->radius + st->speed + 2));
+	st->row_blacks = malloc (sizeof(int) * (2*st->radius + st->speed + 2));
+	st->row_pixels = malloc (sizeof(unsigned long) *
+	                         (2*st->radius + st->speed + 2));
+	if (!st->row_xs || !st->row_ys || !st->row_blacks || !st->row_pixels) {
+		perror("distort");
+		exit(EXIT_FAILURE);
+	}
 
 	if ((st->buffer_map->byte_order == st->orig_map->byte_order)
 			&& (st->buffer_map->depth == st->orig_map->depth)
@@ -582,19 +602,32 @@ static void fast_draw_32(struct state *st, XImage *src, XImage *dest, int x, int
 	}
 }
 
+/* Pixels whose source is off the image are left alone, so each row goes
+ * out as the runs of pixels between those.
+ */
 static void generic_draw(struct state *st, XImage *src, XImage *dest, int x, int y, int *distort_matrix)
 {
-	int i, j;
-	for (i = 0; i < dest->width; i++)
-		for (j = 0; j < dest->height; j++)
-			if (st->from[i][j][0] + x >= 0 &&
+	int i, j, n;
+	for (j = 0; j < dest->height; j++) {
+		n = 0;
+		for (i = 0; i <= dest->width; i++) {
+			if (i < dest->width &&
+					st->from[i][j][0] + x >= 0 &&
 					st->from[i][j][0] + x < src->width &&
 					st->from[i][j][1] + y >= 0 &&
-					st->from[i][j][1] + y < src->height)
-				XPutPixel(dest, i, j,
-						XGetPixel(src,
-							st->from[i][j][0] + x,
-							st->from[i][j][1] + y));
+					st->from[i][j][1] + y < src->height) {
+				st->row_xs[n] = st->from[i][j][0] + x;
+				st->row_ys[n] = st->from[i][j][1] + y;
+				n++;
+			} else if (n) {
+				st->orig_writer.gather (&st->orig_writer, n,
+						st->row_xs, st->row_ys, st->row_pixels);
+				st->buffer_writer.pixels (&st->buffer_writer, i - n, j, n,
+						st->row_pixels);
+				n = 0;
+			}
+		}
+	}
 }
 
 /* generate an XImage of from[][][] and draw it on the screen */
@@ -629,32 +662,43 @@ static void reflect_draw(struct state *st, int k)
 	if (st->xy_coo[k].xmove > 0)
 		cx += st->speed;
 
+	/* Each row is gathered from orig_map in one go.  Black pixels gather
+	 * the pixel underneath as a placeholder, and are blacked afterwards. */
 	for(i = 0 ; i < 2*st->radius+st->speed+2; i++) {
+		int nblacks = 0;
 		ly = i - cy;
 		lysq = ly * ly;
 		ny = st->xy_coo[k].y + i;
 		if (ny >= st->orig_map->height) ny = st->orig_map->height-1;
 		for(j = 0 ; j < 2*st->radius+st->speed+2 ; j++) {
+			st->row_xs[j] = st->xy_coo[k].x + j;
+			st->row_ys[j] = ny;
 			lx = j - cx;
 			dist = lx * lx + lysq;
 			if (dist > rsq ||
 				ly < -st->radius || ly > st->radius ||
 				lx < -st->radius || lx > st->radius)
-				XPutPixel( st->buffer_map, j, i,
-						   XGetPixel( st->orig_map, st->xy_coo[k].x + j, ny ));
+				;
 			else if (dist == 0)
-				XPutPixel( st->buffer_map, j, i, st->black_pixel );
+				st->row_blacks[nblacks++] = j;
 			else {
 				int	x = st->xy_coo[k].x + cx + (lx * rsq / dist);
 				int	y = st->xy_coo[k].y + cy + (ly * rsq / dist);
 				if (x < 0 || x >= st->xgwa.width ||
 					y < 0 || y >= st->xgwa.height)
-					XPutPixel( st->buffer_map, j, i, st->black_pixel );
-				else
-					XPutPixel( st->buffer_map, j, i,
-							   XGetPixel( st->orig_map, x, y ));
+					st->row_blacks[nblacks++] = j;
+				else {
+					st->row_xs[j] = x;
+					st->row_ys[j] = y;
+				}
 			}
 		}
+
+		st->orig_writer.gather (&st->orig_writer, j,
+				st->row_xs, st->row_ys, st->row_pixels);
+		while (nblacks--)
+			st->row_pixels[st->row_blacks[nblacks]] = st->black_pixel;
+		st->buffer_writer.pixels (&st->buffer_writer, 0, i, j, st->row_pixels);
 	}
 
 	XPutImage(st->dpy, st->window, st->gc, st->buffer_map, 0, 0, st->xy_coo[k].x, st->xy_coo[k].y,
@@ -824,6 +868,10 @@ distort_free (Display *dpy, Window window, void *closure)
   if (st->fast_from) free (st->fast_from);
   if (st->from_array) free (st->from_array);
   if (st->buffer_map_cache) free (st->buffer_map_cache);
+  if (st->row_xs) free (st->row_xs);
+  if (st->row_ys) free (st->row_ys);
+  if (st->row_blacks) free (st->row_blacks);
+  if (st->row_pixels) free (st->row_pixels);
 
   if (st->from) {
     for (i = 0; i < st->from_size; i++)
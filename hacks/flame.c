@@ -50,10 +50,11 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "pointcloud.h"
 
 #include <signal.h>		/* so we can ignore SIGFPE */
 
-#define POINT_BUFFER_SIZE 10
+#define POINT_BUFFER_SIZE 1024
 #define MAXLEV 4
 #define MAXKINDS  10
 
@@ -74,7 +75,10 @@ struct state {
   int pixcol;
   int ncolors;
   XColor *colors;
-  XRectangle points [POINT_BUFFER_SIZE];
+  unsigned long *pixels;	/* of colors, or just the foreground */
+  unsigned long bg;
+  int xs [POINT_BUFFER_SIZE], ys [POINT_BUFFER_SIZE];
+  pointcloud *cloud;
   GC gc;
 
   int delay, delay2;
@@ -106,6 +110,9 @@ halfrandom (struct state *st, int mv)
   return (r % mv);
 }
 
+static void flame_reshape (Display *, Window, void *,
+                           unsigned int, unsigned int);
+
 static void *
 flame_init (Display *dpy, Window window)
 {
@@ -113,6 +120,7 @@ flame_init (Display *dpy, Window window)
   XGCValues gcv;
   XWindowAttributes xgwa;
   Colormap cmap;
+  int i;
 
   st->dpy = dpy;
   st->window = window;
@@ -173,6 +181,16 @@ flame_init (Display *dpy, Window window)
     }
 
   st->gc = XCreateGC (st->dpy, st->window, GCForeground | GCBackground, &gcv);
+
+  st->bg = gcv.background;
+  st->pixels = (unsigned long *)
+    malloc ((mono_p ? 1 : st->ncolors) * sizeof (*st->pixels));
+  if (mono_p)
+    st->pixels[0] = gcv.foreground;
+  else
+    for (i = 0; i < st->ncolors; i++)
+      st->pixels[i] = st->colors[i].pixel;
+  flame_reshape (st->dpy, st->window, st, st->width, st->height);
   return st;
 }
 
@@ -190,15 +208,13 @@ recurse (struct state *st, double x, double y, int l, Display *dpy, Window win)
 
       if (x > -1.0 && x < 1.0 && y > -1.0 && y < 1.0)
 	{
-	  st->points[st->num_points].x = (int) ((st->width / 2) * (x + 1.0));
-	  st->points[st->num_points].y = (int) ((st->height / 2) * (y + 1.0));
-          st->points[st->num_points].width = 
-            st->points[st->num_points].height = st->scale;
+	  st->xs[st->num_points] = (int) ((st->width / 2) * (x + 1.0));
+	  st->ys[st->num_points] = (int) ((st->height / 2) * (y + 1.0));
 	  st->num_points++;
 	  if (st->num_points >= POINT_BUFFER_SIZE)
 	    {
-	      XFillRectangles (st->dpy, win, st->gc, st->points,
-                               st->num_points);
+	      pointcloud_add (st->cloud, st->num_points, st->xs, st->ys,
+                              st->ncolors > 2 ? st->pixcol : 0);
 	      st->num_points = 0;
 	    }
 	}
@@ -353,7 +369,7 @@ flame_draw (Display *dpy, Window window, void *closure)
   if (st->do_reset)
     {
       st->do_reset = 0;
-      XClearWindow (st->dpy, st->window);
+      pointcloud_clear (st->cloud);
     }
 
   if (!(st->cur_level++ % st->max_levels))
@@ -367,7 +383,6 @@ flame_draw (Display *dpy, Window window, void *closure)
     {
       if (st->ncolors > 2)
 	{
-	  XSetForeground (st->dpy, st->gc, st->colors [st->pixcol].pixel);
 	  if (--st->pixcol < 0)
 	    st->pixcol = st->ncolors - 1;
 	}
@@ -392,7 +407,9 @@ flame_draw (Display *dpy, Window window, void *closure)
   st->num_points = 0;
   st->total_points = 0;
   recurse (st, 0.0, 0.0, 0, st->dpy, st->window);
-  XFillRectangles (st->dpy, st->window, st->gc, st->points, st->num_points);
+  pointcloud_add (st->cloud, st->num_points, st->xs, st->ys,
+                  st->ncolors > 2 ? st->pixcol : 0);
+  pointcloud_render (st->cloud, st->window, st->gc);
 
   return this_delay;
 }
@@ -427,6 +444,8 @@ static const char *flame_defaults [] = {
   "*delay:	50000",
   "*delay2:	2000000",
   "*points:	10000",
+  "*useSHM:	True",
+  POINTCLOUD_DEFAULTS
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
@@ -439,6 +458,7 @@ static XrmOptionDescRec flame_options [] = {
   { "-delay",		".delay",	XrmoptionSepArg, 0 },
   { "-delay2",		".delay2",	XrmoptionSepArg, 0 },
   { "-points",		".points",	XrmoptionSepArg, 0 },
+  POINTCLOUD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -449,6 +469,12 @@ flame_reshape (Display *dpy, Window window, void *closure,
   struct state *st = (struct state *) closure;
   st->width = w;
   st->height = h;
+
+  /* Frames accumulate until the next reset, so a new window starts over. */
+  if (st->cloud) pointcloud_free (st->cloud);
+  st->cloud = pointcloud_new (st->dpy, st->window, st->scale);
+  pointcloud_colors (st->cloud, mono_p ? 1 : st->ncolors, st->pixels, st->bg);
+  XClearWindow (st->dpy, st->window);
 }
 
 static Bool
@@ -468,6 +494,8 @@ flame_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
   XFreeGC (dpy, st->gc);
+  pointcloud_free (st->cloud);
+  free (st->pixels);
   free (st->colors);
   free (st);
 }
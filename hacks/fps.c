@@ -214,6 +214,11 @@ fps_compute (fps_state *st, unsigned long polys, double depth)
                 st->string[L-2] = 0;
             }
         }
+
+# ifdef HAVE_GLPROF
+      glprof_fps_string (st->string + strlen(st->string),
+                         sizeof(st->string) - strlen(st->string));
+# endif
     }
 
   return st->last_fps;
@@ -36,11 +36,30 @@
 
 #include "gllist.h"
 
-extern struct gllist
- *cow_face, *cow_hide, *cow_hoofs, *cow_horns, *cow_tail, *cow_udder;
+/* Binary mesh containers, see gllist.h. */
+extern const unsigned char
+ cow_face[], cow_hide[], cow_hoofs[], cow_horns[], cow_tail[], cow_udder[];
+extern const unsigned long
+ cow_face_size, cow_hide_size, cow_hoofs_size, cow_horns_size,
+ cow_tail_size, cow_udder_size;
+
+static const struct {
+  const unsigned char *data;
+  const unsigned long *size;
+} all_models[] = {
+ { cow_face,  &cow_face_size },  { cow_hide,  &cow_hide_size },
+ { cow_hoofs, &cow_hoofs_size }, { cow_horns, &cow_horns_size },
+ { cow_tail,  &cow_tail_size },  { cow_udder, &cow_udder_size },
+};
+
+/* Loaded from all_models on first use. */
+static const struct gllist
+ *cow_face_list, *cow_hide_list, *cow_hoofs_list, *cow_horns_list,
+ *cow_tail_list, *cow_udder_list;
 
-static struct gllist **all_objs[] = {
- &cow_face, &cow_hide, &cow_hoofs, &cow_horns, &cow_tail, &cow_udder
+static const struct gllist **all_objs[] = {
+ &cow_face_list, &cow_hide_list, &cow_hoofs_list,
+ &cow_horns_list, &cow_tail_list, &cow_udder_list
 };
 
 #define FACE	0
@@ -68,6 +87,7 @@ typedef struct {
   GLuint texture;
   enum { BOUNCE, INFLATE, DEFLATE } mode;
   GLfloat ratio;
+  Bool morphed_p;	/* whether the dlists hold the geometry too */
 
   int nfloaters;
   floater *floaters;
@@ -336,9 +356,9 @@ render_cow (ModeInfo *mi, GLfloat ratio)
           glMaterialf  (GL_FRONT_AND_BACK, GL_SHININESS,           shiny);
         }
 
-      if (ratio == 0)
-        renderList (gll, wire);
-      else
+      /* The undeformed cow is not compiled in: draw_part draws it from
+         buffer objects. */
+      if (ratio != 0)
         {
           /* Transition between a physics cow (cow-shaped) and a 
              mathematical cow (spherical).
@@ -346,7 +366,7 @@ render_cow (ModeInfo *mi, GLfloat ratio)
           struct gllist *gll2 = (struct gllist *) malloc (sizeof(*gll2));
           GLfloat *p = (GLfloat *) malloc (gll->points * 6 * sizeof(*p));
           GLfloat scale2 = 0.5 + (0.5 * (1-ratio));
-          const GLfloat *pin  = (GLfloat *) gll->data;
+          const GLfloat *pin  = gllist_floats (gll);
           GLfloat *pout = p;
           int j;
           GLfloat scale = 10.46;
@@ -354,6 +374,7 @@ render_cow (ModeInfo *mi, GLfloat ratio)
           memcpy (gll2, gll, sizeof(*gll2));
           gll2->next = 0;
           gll2->data = p;
+          gll2->packed = 0;
 
           for (j = 0; j < gll2->points; j++)
             {
@@ -400,6 +421,7 @@ render_cow (ModeInfo *mi, GLfloat ratio)
 
       glEndList ();
     }
+  bp->morphed_p = (ratio != 0);
 }
 
 
@@ -445,6 +467,18 @@ init_cow (ModeInfo *mi)
 
   bp->trackball = gltrackball_init (False);
 
+  for (i = 0; i < countof(all_objs); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (all_models[i].data,
+                                         *all_models[i].size, "all");
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model %d\n", progname, i);
+            exit (1);
+          }
+      }
+
   load_texture (mi, do_texture);
 
   bp->ratio = 0;
@@ -480,6 +514,17 @@ init_cow (ModeInfo *mi)
 }
 
 
+static void
+draw_part (ModeInfo *mi, int i)
+{
+  cow_configuration *bp = &bps[MI_SCREEN(mi)];
+  glCallList (bp->dlists[i]);
+  if (! bp->morphed_p)
+    renderList (*all_objs[i], MI_IS_WIREFRAME(mi));
+  mi->polygon_count += (*all_objs[i])->points / 3;
+}
+
+
 static void
 draw_floater (ModeInfo *mi, floater *f)
 {
@@ -508,23 +553,12 @@ draw_floater (ModeInfo *mi, floater *f)
   else if (bp->nfloaters > 1)  n *= 0.7;
   glScalef(n, n, n);
 
-  glCallList (bp->dlists[FACE]);
-  mi->polygon_count += (*all_objs[FACE])->points / 3;
-
-  glCallList (bp->dlists[HIDE]);
-  mi->polygon_count += (*all_objs[HIDE])->points / 3;
-
-  glCallList (bp->dlists[HOOFS]);
-  mi->polygon_count += (*all_objs[HOOFS])->points / 3;
-
-  glCallList (bp->dlists[HORNS]);
-  mi->polygon_count += (*all_objs[HORNS])->points / 3;
-
-  glCallList (bp->dlists[TAIL]);
-  mi->polygon_count += (*all_objs[TAIL])->points / 3;
-
-  glCallList (bp->dlists[UDDER]);
-  mi->polygon_count += (*all_objs[UDDER])->points / 3;
+  draw_part (mi, FACE);
+  draw_part (mi, HIDE);
+  draw_part (mi, HOOFS);
+  draw_part (mi, HORNS);
+  draw_part (mi, TAIL);
+  draw_part (mi, UDDER);
 
   glPopMatrix();
 }
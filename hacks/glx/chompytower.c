@@ -45,11 +45,21 @@
 #include "gllist.h"
 #include <ctype.h>
 
-extern const struct gllist
+/* A binary mesh container, see "teeth_dxf" in Makefile.in. */
+extern const unsigned char teeth_model[];
+extern const unsigned long teeth_model_size;
+
+/* Loaded from teeth_model on first use. */
+static const struct gllist
   *teeth_model_jaw_upper_half,   *teeth_model_jaw_lower_half,
   *teeth_model_teeth_upper_half, *teeth_model_teeth_lower_half;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "jaw_upper_half",   "jaw_lower_half",
+  "teeth_upper_half", "teeth_lower_half",
+};
+
+static const struct gllist **all_objs[] = {
   &teeth_model_jaw_upper_half,   &teeth_model_jaw_lower_half,
   &teeth_model_teeth_upper_half, &teeth_model_teeth_lower_half,
 };
@@ -815,6 +825,19 @@ init_chompytower (ModeInfo *mi)
     bp->trackball = gltrackball_init (False);
   }
 
+  for (i = 0; i < countof(all_objs); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (teeth_model, teeth_model_size,
+                                         all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
   bp->component_dlists = (GLuint *)
     calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
@@ -822,21 +845,14 @@ init_chompytower (ModeInfo *mi)
 
   for (i = 0; i < countof(all_objs); i++)
     {
-      const struct gllist *gll = *all_objs[i];
       char *key = 0;
       GLfloat spec[4] = {0.4, 0.4, 0.4, 1.0};
       GLfloat shiny = 80; /* 0-128 */
 
+      /* Only the material goes in the display list: the model itself is
+         drawn by render_component, so that it comes from buffer objects. */
       glNewList (bp->component_dlists[i], GL_COMPILE);
 
-      glMatrixMode(GL_MODELVIEW);
-      glPushMatrix();
-      glMatrixMode(GL_TEXTURE);
-      glPushMatrix();
-      glMatrixMode(GL_MODELVIEW);
-
-      glRotatef (-90, 1, 0, 0);
-
       glBindTexture (GL_TEXTURE_2D, 0);
 
       switch (i) {
@@ -856,12 +872,6 @@ init_chompytower (ModeInfo *mi)
 
       glMaterialfv (GL_FRONT_AND_BACK, GL_SPECULAR,  spec);
       glMaterialf  (GL_FRONT_AND_BACK, GL_SHININESS, shiny);
-      renderList (gll, wire);
-
-      glMatrixMode(GL_TEXTURE);
-      glPopMatrix();
-      glMatrixMode(GL_MODELVIEW);
-      glPopMatrix();
 
       glEndList ();
     }
@@ -876,6 +886,18 @@ init_chompytower (ModeInfo *mi)
 }
 
 
+static void
+render_component (ModeInfo *mi, int i)
+{
+  chompytower_configuration *bp = &bps[MI_SCREEN(mi)];
+  glPushMatrix();
+  glRotatef (-90, 1, 0, 0);
+  glCallList (bp->component_dlists[i]);
+  renderList (*all_objs[i], MI_IS_WIREFRAME(mi));
+  glPopMatrix();
+}
+
+
 static int
 draw_component (ModeInfo *mi, int i)
 {
@@ -884,12 +906,12 @@ draw_component (ModeInfo *mi, int i)
                 bp->component_colors[i]);
 
   glFrontFace (GL_CCW);
-  glCallList (bp->component_dlists[i]);
+  render_component (mi, i);
 
   glPushMatrix();
   glScalef (-1, 1, 1);
   glFrontFace (GL_CW);
-  glCallList (bp->component_dlists[i]);
+  render_component (mi, i);
   glPopMatrix();
 
   return 2 * (*all_objs[i])->points / 3;
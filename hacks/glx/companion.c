@@ -46,14 +46,30 @@
 
 #include "gllist.h"
 
-extern const struct gllist *companion_quad, *companion_disc, *companion_heart;
-static const struct gllist * const *all_objs[] = {
-  &companion_quad, &companion_disc, &companion_heart
+/* Binary mesh containers, see gllist.h. */
+extern const unsigned char companion_quad[], companion_disc[],
+  companion_heart[];
+extern const unsigned long companion_quad_size, companion_disc_size,
+  companion_heart_size;
+
+static const struct {
+  const unsigned char *data;
+  const unsigned long *size;
+} all_models[] = {
+  { companion_quad,  &companion_quad_size },
+  { companion_disc,  &companion_disc_size },
+  { companion_heart, &companion_heart_size },
+};
+
+/* Loaded from all_models on first use. */
+static const struct gllist *companion_quad_list, *companion_disc_list,
+  *companion_heart_list;
+static const struct gllist **all_objs[] = {
+  &companion_quad_list, &companion_disc_list, &companion_heart_list
 };
 #define BASE_QUAD  0
 #define BASE_DISC  1
 #define BASE_HEART 2
-#define FULL_CUBE  3
 
 #define SPEED_SCALE 0.2
 
@@ -72,9 +88,6 @@ typedef struct {
   trackball_state *trackball;
   Bool button_down_p;
 
-  GLuint *dlists;
-  int cube_polys;
-
   int nfloaters;
   floater *floaters;
 
@@ -178,7 +191,6 @@ tick_floater (ModeInfo *mi, floater *f)
 static int
 build_corner (ModeInfo *mi)
 {
-  cube_configuration *bp = &bps[MI_SCREEN(mi)];
   GLfloat s;
   const struct gllist *gll = *all_objs[BASE_QUAD];
 
@@ -190,7 +202,7 @@ build_corner (ModeInfo *mi)
   glRotatef (180, 0, 1, 0);
   glRotatef (180, 0, 0, 1);
   glTranslatef (-0.12, -1.64, 0.12);
-  glCallList (bp->dlists[BASE_QUAD]);
+  renderList (gll, MI_IS_WIREFRAME(mi));
   glPopMatrix();
 
   return gll->points / 3;
@@ -201,7 +213,6 @@ static int
 build_face (ModeInfo *mi)
 {
   int polys = 0;
-  cube_configuration *bp = &bps[MI_SCREEN(mi)];
   int wire = MI_IS_WIREFRAME(mi);
   GLfloat s;
   const struct gllist *gll;
@@ -308,13 +319,13 @@ build_face (ModeInfo *mi)
     {
       gll = *all_objs[BASE_HEART];
       glMaterialfv (GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, heart_color);
-      glCallList (bp->dlists[BASE_HEART]);
+      renderList (gll, wire);
       polys += gll->points / 3;
     }
 
   gll = *all_objs[BASE_DISC];
   glMaterialfv (GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, disc_color);
-  glCallList (bp->dlists[BASE_DISC]);
+  renderList (gll, wire);
   polys += gll->points / 3;
 
   glPopMatrix();
@@ -431,22 +442,17 @@ init_cube (ModeInfo *mi)
 
   bp->trackball = gltrackball_init (False);
 
-  bp->dlists = (GLuint *) calloc (countof(all_objs)+2, sizeof(GLuint));
-  for (i = 0; i < countof(all_objs)+1; i++)
-    bp->dlists[i] = glGenLists (1);
-
   for (i = 0; i < countof(all_objs); i++)
-    {
-      const struct gllist *gll = *all_objs[i];
-      glNewList (bp->dlists[i], GL_COMPILE);
-      renderList (gll, wire);
-      glEndList ();
-    }
-
-  glNewList (bp->dlists[i], GL_COMPILE);
-  bp->cube_polys = build_cube (mi);
-  glEndList ();
-
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (all_models[i].data,
+                                         *all_models[i].size, "all");
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model %d\n", progname, i);
+            exit (1);
+          }
+      }
 
   bp->nfloaters = MI_COUNT (mi);
   bp->floaters = (floater *) calloc (bp->nfloaters, sizeof (floater));
@@ -523,9 +529,9 @@ draw_floater (ModeInfo *mi, floater *f)
 
   glScalef(n, n, n);
 
-  glCallList (bp->dlists[FULL_CUBE]);
-  mi->polygon_count += bp->cube_polys;
-/*  build_cube (mi);*/
+  /* Not a display list, so that renderList can draw the parts from
+     buffer objects. */
+  mi->polygon_count += build_cube (mi);
 
   glPopMatrix();
 }
@@ -592,11 +598,8 @@ free_cube (ModeInfo *mi)
   glXMakeCurrent(MI_DISPLAY(mi), MI_WINDOW(mi), *bp->glx_context);
   for (i = 0; i < bp->nfloaters; i++)
     if (bp->floaters[i].rot) free_rotator (bp->floaters[i].rot);
-  for (i = 0; i < countof(all_objs)+1; i++)
-    if (glIsList(bp->dlists[i])) glDeleteLists(bp->dlists[i], 1);
   if (bp->floaters) free (bp->floaters);
   if (bp->trackball) gltrackball_free (bp->trackball);
-  if (bp->dlists) free (bp->dlists);
 }
 
 XSCREENSAVER_MODULE_2 ("CompanionCube", companioncube, cube)
@@ -1,9593 +1,2631 @@
+/* Generated from "companion_disc.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.07324,-0.997287,0.007402,0.054796,0.038576,-0.006167,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	-0.07324,-0.997287,0.007402,0.054796,0.038576,-0.006167,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	0,-0.999938,0.011104,0.055885,0.038542,-0.006167,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	0,-0.999938,0.011104,0.055885,0.038542,-0.006167,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	-0.07324,-0.997287,0.007402,0.054796,0.038576,-0.006167,
-	0.07324,-0.997287,0.007402,0.056974,0.038576,-0.006167,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	0.07324,-0.997287,0.007402,0.056974,0.038576,-0.006167,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	0,-0.999938,0.011104,0.055885,0.038542,-0.006167,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0.07324,-0.997287,0.007402,0.056974,0.038576,-0.006167,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.997287,-0.07324,0.007402,0.073195,0.054796,-0.006167,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.997287,-0.07324,0.007402,0.073195,0.054796,-0.006167,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.999938,0,0.011104,0.073229,0.055885,-0.006167,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.999938,0,0.011104,0.073229,0.055885,-0.006167,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.997287,-0.07324,0.007402,0.073195,0.054796,-0.006167,
-	0.997287,0.07324,0.007402,0.073195,0.056974,-0.006167,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.997287,0.07324,0.007402,0.073195,0.056974,-0.006167,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.999938,0,0.011104,0.073229,0.055885,-0.006167,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.997287,0.07324,0.007402,0.073195,0.056974,-0.006167,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.07324,0.997287,0.007402,0.056974,0.073195,-0.006167,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0.07324,0.997287,0.007402,0.056974,0.073195,-0.006167,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0,0.999938,0.011104,0.055885,0.073229,-0.006167,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	0,0.999938,0.011104,0.055885,0.073229,-0.006167,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	0.07324,0.997287,0.007402,0.056974,0.073195,-0.006167,
-	-0.07324,0.997287,0.007402,0.054796,0.073195,-0.006167,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	-0.07324,0.997287,0.007402,0.054796,0.073195,-0.006167,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	0,0.999938,0.011104,0.055885,0.073229,-0.006167,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	-0.07324,0.997287,0.007402,0.054796,0.073195,-0.006167,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.997287,0.07324,0.007402,0.038576,0.056974,-0.006167,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.997287,0.07324,0.007402,0.038576,0.056974,-0.006167,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.999938,0,0.011104,0.038542,0.055885,-0.006167,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.999938,0,0.011104,0.038542,0.055885,-0.006167,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.997287,0.07324,0.007402,0.038576,0.056974,-0.006167,
-	-0.997287,-0.07324,0.007402,0.038576,0.054796,-0.006167,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.997287,-0.07324,0.007402,0.038576,0.054796,-0.006167,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.999938,0,0.011104,0.038542,0.055885,-0.006167,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.997287,-0.07324,0.007402,0.038576,0.054796,-0.006167,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.927456,-0.367206,0.070606,0.039761,0.049501,-0.006013,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.902569,-0.424717,0.070606,0.040194,0.048502,-0.006013,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.87412,-0.480551,0.070606,0.040688,0.047531,-0.006013,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.842221,-0.53449,0.070606,0.041243,0.046593,-0.006013,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.806998,-0.586318,0.070606,0.041855,0.045692,-0.006013,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.76859,-0.635833,0.070606,0.042523,0.044831,-0.006013,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.727149,-0.682839,0.070606,0.043243,0.044014,-0.006013,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.682839,-0.727149,0.070606,0.044014,0.043243,-0.006013,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.635833,-0.76859,0.070606,0.044831,0.042523,-0.006013,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.586318,-0.806998,0.070606,0.045692,0.041855,-0.006013,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.53449,-0.842221,0.070606,0.046593,0.041243,-0.006013,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.480551,-0.87412,0.070606,0.047531,0.040688,-0.006013,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.424717,-0.902569,0.070606,0.048502,0.040194,-0.006013,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.367206,-0.927456,0.070606,0.049501,0.039761,-0.006013,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.308246,-0.948683,0.070606,0.050526,0.039392,-0.006013,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.248069,-0.966166,0.070606,0.051572,0.039088,-0.006013,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.186914,-0.979836,0.070606,0.052636,0.03885,-0.006013,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	-0.12502,-0.989639,0.070606,0.053712,0.03868,-0.006013,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	-0.062634,-0.995536,0.070606,0.054796,0.038577,-0.006013,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	0,-0.997504,0.070606,0.055885,0.038543,-0.006013,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0.062634,-0.995536,0.070606,0.056974,0.038577,-0.006013,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.12502,-0.989639,0.070606,0.058059,0.03868,-0.006013,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.186914,-0.979836,0.070606,0.059135,0.03885,-0.006013,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.248069,-0.966166,0.070606,0.060198,0.039088,-0.006013,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.308246,-0.948683,0.070606,0.061244,0.039392,-0.006013,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.367206,-0.927456,0.070606,0.062269,0.039761,-0.006013,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.424717,-0.902569,0.070606,0.063269,0.040194,-0.006013,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.480551,-0.87412,0.070606,0.06424,0.040688,-0.006013,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.53449,-0.842221,0.070606,0.065178,0.041243,-0.006013,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.586318,-0.806998,0.070606,0.066079,0.041855,-0.006013,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.635833,-0.76859,0.070606,0.06694,0.042523,-0.006013,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.682839,-0.727149,0.070606,0.067757,0.043243,-0.006013,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.727149,-0.682839,0.070606,0.068527,0.044014,-0.006013,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.76859,-0.635833,0.070606,0.069247,0.044831,-0.006013,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.806998,-0.586318,0.070606,0.069915,0.045692,-0.006013,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.842221,-0.53449,0.070606,0.070528,0.046593,-0.006013,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.87412,-0.480551,0.070606,0.071082,0.047531,-0.006013,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.902569,-0.424717,0.070606,0.071577,0.048502,-0.006013,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.927456,-0.367206,0.070606,0.07201,0.049501,-0.006013,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.948683,-0.308246,0.070606,0.072379,0.050526,-0.006013,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.966166,-0.248069,0.070606,0.072682,0.051572,-0.006013,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.979836,-0.186914,0.070606,0.07292,0.052636,-0.006013,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.989639,-0.12502,0.070606,0.073091,0.053712,-0.006013,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.995536,-0.062634,0.070606,0.073193,0.054796,-0.006013,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.997504,0,0.070606,0.073227,0.055885,-0.006013,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.995536,0.062634,0.070606,0.073193,0.056974,-0.006013,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.989639,0.12502,0.070606,0.073091,0.058059,-0.006013,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.979836,0.186914,0.070606,0.07292,0.059135,-0.006013,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.966166,0.248069,0.070606,0.072682,0.060198,-0.006013,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.948683,0.308246,0.070606,0.072379,0.061244,-0.006013,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.927456,0.367206,0.070606,0.07201,0.062269,-0.006013,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.902569,0.424717,0.070606,0.071577,0.063269,-0.006013,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.87412,0.480551,0.070606,0.071082,0.06424,-0.006013,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.842221,0.53449,0.070606,0.070528,0.065178,-0.006013,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.806998,0.586318,0.070606,0.069915,0.066079,-0.006013,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.76859,0.635833,0.070606,0.069247,0.06694,-0.006013,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.727149,0.682839,0.070606,0.068527,0.067757,-0.006013,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.682839,0.727149,0.070606,0.067757,0.068527,-0.006013,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.635833,0.76859,0.070606,0.06694,0.069247,-0.006013,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.586318,0.806998,0.070606,0.066079,0.069915,-0.006013,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.53449,0.842221,0.070606,0.065178,0.070528,-0.006013,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.480551,0.87412,0.070606,0.06424,0.071082,-0.006013,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.424717,0.902569,0.070606,0.063269,0.071577,-0.006013,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.367206,0.927456,0.070606,0.062269,0.07201,-0.006013,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.308246,0.948683,0.070606,0.061244,0.072379,-0.006013,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.248069,0.966166,0.070606,0.060198,0.072682,-0.006013,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.186914,0.979836,0.070606,0.059135,0.07292,-0.006013,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0.12502,0.989639,0.070606,0.058059,0.073091,-0.006013,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	0.062634,0.995536,0.070606,0.056974,0.073193,-0.006013,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	0,0.997504,0.070606,0.055885,0.073227,-0.006013,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	-0.062634,0.995536,0.070606,0.054796,0.073193,-0.006013,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.12502,0.989639,0.070606,0.053712,0.073091,-0.006013,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.186914,0.979836,0.070606,0.052636,0.07292,-0.006013,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.248069,0.966166,0.070606,0.051572,0.072682,-0.006013,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.308246,0.948683,0.070606,0.050526,0.072379,-0.006013,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.367206,0.927456,0.070606,0.049501,0.07201,-0.006013,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.424717,0.902569,0.070606,0.048502,0.071577,-0.006013,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.480551,0.87412,0.070606,0.047531,0.071082,-0.006013,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.53449,0.842221,0.070606,0.046593,0.070528,-0.006013,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.586318,0.806998,0.070606,0.045692,0.069915,-0.006013,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.635833,0.76859,0.070606,0.044831,0.069247,-0.006013,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.682839,0.727149,0.070606,0.044014,0.068527,-0.006013,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.727149,0.682839,0.070606,0.043243,0.067757,-0.006013,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.76859,0.635833,0.070606,0.042523,0.06694,-0.006013,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.806998,0.586318,0.070606,0.041855,0.066079,-0.006013,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.842221,0.53449,0.070606,0.041243,0.065178,-0.006013,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.87412,0.480551,0.070606,0.040688,0.06424,-0.006013,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.902569,0.424717,0.070606,0.040194,0.063269,-0.006013,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.927456,0.367206,0.070606,0.039761,0.062269,-0.006013,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.948683,0.308246,0.070606,0.039392,0.061244,-0.006013,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.966166,0.248069,0.070606,0.039088,0.060198,-0.006013,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.979836,0.186914,0.070606,0.03885,0.059135,-0.006013,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.989639,0.12502,0.070606,0.03868,0.058059,-0.006013,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.995536,0.062634,0.070606,0.038577,0.056974,-0.006013,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.997504,0,0.070606,0.038543,0.055885,-0.006013,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.995536,-0.062634,0.070606,0.038577,0.054796,-0.006013,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.989639,-0.12502,0.070606,0.03868,0.053712,-0.006013,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.979836,-0.186914,0.070606,0.03885,0.052636,-0.006013,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.948683,-0.308246,0.070606,0.039392,0.050526,-0.006013,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.966166,-0.248069,0.070606,0.039088,0.051572,-0.006013,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.93398,-0.303468,0.18865,0.039411,0.050532,-0.005861,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.913082,-0.361515,0.18865,0.03978,0.049509,-0.005861,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.88858,-0.418134,0.18865,0.040212,0.04851,-0.005861,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.860572,-0.473103,0.18865,0.040706,0.04754,-0.005861,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.829167,-0.526206,0.18865,0.04126,0.046604,-0.005861,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.794491,-0.577231,0.18865,0.041871,0.045704,-0.005861,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.756678,-0.625979,0.18865,0.042538,0.044844,-0.005861,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.715879,-0.672256,0.18865,0.043258,0.044028,-0.005861,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.672256,-0.715879,0.18865,0.044028,0.043258,-0.005861,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.625979,-0.756678,0.18865,0.044844,0.042538,-0.005861,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.577231,-0.794491,0.18865,0.045704,0.041871,-0.005861,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.526206,-0.829167,0.18865,0.046604,0.04126,-0.005861,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.473103,-0.860572,0.18865,0.04754,0.040706,-0.005861,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.418134,-0.88858,0.18865,0.04851,0.040212,-0.005861,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.361515,-0.913082,0.18865,0.049509,0.03978,-0.005861,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.303468,-0.93398,0.18865,0.050532,0.039411,-0.005861,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.244224,-0.951192,0.18865,0.051578,0.039107,-0.005861,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.184017,-0.96465,0.18865,0.05264,0.03887,-0.005861,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	-0.123083,-0.974301,0.18865,0.053714,0.0387,-0.005861,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	-0.061663,-0.980106,0.18865,0.054798,0.038597,-0.005861,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	0,-0.982044,0.18865,0.055885,0.038563,-0.005861,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0.061663,-0.980106,0.18865,0.056973,0.038597,-0.005861,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.123083,-0.974301,0.18865,0.058056,0.0387,-0.005861,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.184017,-0.96465,0.18865,0.059131,0.03887,-0.005861,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.244224,-0.951192,0.18865,0.060193,0.039107,-0.005861,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.303468,-0.93398,0.18865,0.061238,0.039411,-0.005861,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.361515,-0.913082,0.18865,0.062262,0.03978,-0.005861,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.418134,-0.88858,0.18865,0.063261,0.040212,-0.005861,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.473103,-0.860572,0.18865,0.06423,0.040706,-0.005861,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.526206,-0.829167,0.18865,0.065167,0.04126,-0.005861,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.577231,-0.794491,0.18865,0.066067,0.041871,-0.005861,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.625979,-0.756678,0.18865,0.066927,0.042538,-0.005861,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.672256,-0.715879,0.18865,0.067743,0.043258,-0.005861,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.715879,-0.672256,0.18865,0.068512,0.044028,-0.005861,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.756678,-0.625979,0.18865,0.069232,0.044844,-0.005861,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.794491,-0.577231,0.18865,0.069899,0.045704,-0.005861,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.829167,-0.526206,0.18865,0.070511,0.046604,-0.005861,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.860572,-0.473103,0.18865,0.071065,0.04754,-0.005861,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.88858,-0.418134,0.18865,0.071559,0.04851,-0.005861,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.913082,-0.361515,0.18865,0.071991,0.049509,-0.005861,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.93398,-0.303468,0.18865,0.07236,0.050532,-0.005861,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.951192,-0.244224,0.18865,0.072663,0.051578,-0.005861,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.96465,-0.184017,0.18865,0.072901,0.05264,-0.005861,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.974301,-0.123083,0.18865,0.073071,0.053714,-0.005861,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.980106,-0.061663,0.18865,0.073173,0.054798,-0.005861,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.982044,0,0.18865,0.073207,0.055885,-0.005861,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.980106,0.061663,0.18865,0.073173,0.056973,-0.005861,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.974301,0.123083,0.18865,0.073071,0.058056,-0.005861,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.96465,0.184017,0.18865,0.072901,0.059131,-0.005861,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.951192,0.244224,0.18865,0.072663,0.060193,-0.005861,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.93398,0.303468,0.18865,0.07236,0.061238,-0.005861,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.913082,0.361515,0.18865,0.071991,0.062262,-0.005861,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.88858,0.418134,0.18865,0.071559,0.063261,-0.005861,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.860572,0.473103,0.18865,0.071065,0.06423,-0.005861,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.829167,0.526206,0.18865,0.070511,0.065167,-0.005861,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.794491,0.577231,0.18865,0.069899,0.066067,-0.005861,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.756678,0.625979,0.18865,0.069232,0.066927,-0.005861,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.715879,0.672256,0.18865,0.068512,0.067743,-0.005861,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.672256,0.715879,0.18865,0.067743,0.068512,-0.005861,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.625979,0.756678,0.18865,0.066927,0.069232,-0.005861,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.577231,0.794491,0.18865,0.066067,0.069899,-0.005861,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.526206,0.829167,0.18865,0.065167,0.070511,-0.005861,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.473103,0.860572,0.18865,0.06423,0.071065,-0.005861,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.418134,0.88858,0.18865,0.063261,0.071559,-0.005861,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.361515,0.913082,0.18865,0.062262,0.071991,-0.005861,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.303468,0.93398,0.18865,0.061238,0.07236,-0.005861,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.244224,0.951192,0.18865,0.060193,0.072663,-0.005861,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.184017,0.96465,0.18865,0.059131,0.072901,-0.005861,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0.123083,0.974301,0.18865,0.058056,0.073071,-0.005861,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	0.061663,0.980106,0.18865,0.056973,0.073173,-0.005861,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	0,0.982044,0.18865,0.055885,0.073207,-0.005861,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	-0.061663,0.980106,0.18865,0.054798,0.073173,-0.005861,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.123083,0.974301,0.18865,0.053714,0.073071,-0.005861,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.184017,0.96465,0.18865,0.05264,0.072901,-0.005861,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.244224,0.951192,0.18865,0.051578,0.072663,-0.005861,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.303468,0.93398,0.18865,0.050532,0.07236,-0.005861,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.361515,0.913082,0.18865,0.049509,0.071991,-0.005861,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.418134,0.88858,0.18865,0.04851,0.071559,-0.005861,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.473103,0.860572,0.18865,0.04754,0.071065,-0.005861,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.526206,0.829167,0.18865,0.046604,0.070511,-0.005861,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.577231,0.794491,0.18865,0.045704,0.069899,-0.005861,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.625979,0.756678,0.18865,0.044844,0.069232,-0.005861,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.672256,0.715879,0.18865,0.044028,0.068512,-0.005861,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.715879,0.672256,0.18865,0.043258,0.067743,-0.005861,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.756678,0.625979,0.18865,0.042538,0.066927,-0.005861,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.794491,0.577231,0.18865,0.041871,0.066067,-0.005861,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.829167,0.526206,0.18865,0.04126,0.065167,-0.005861,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.860572,0.473103,0.18865,0.040706,0.06423,-0.005861,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.88858,0.418134,0.18865,0.040212,0.063261,-0.005861,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.913082,0.361515,0.18865,0.03978,0.062262,-0.005861,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.93398,0.303468,0.18865,0.039411,0.061238,-0.005861,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.951192,0.244224,0.18865,0.039107,0.060193,-0.005861,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.96465,0.184017,0.18865,0.03887,0.059131,-0.005861,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.974301,0.123083,0.18865,0.0387,0.058056,-0.005861,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.980106,0.061663,0.18865,0.038597,0.056973,-0.005861,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.982044,0,0.18865,0.038563,0.055885,-0.005861,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.980106,-0.061663,0.18865,0.038597,0.054798,-0.005861,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.974301,-0.123083,0.18865,0.0387,0.053714,-0.005861,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.951192,-0.244224,0.18865,0.039107,0.051578,-0.005861,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.96465,-0.184017,0.18865,0.03887,0.05264,-0.005861,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.922736,-0.236918,0.304021,0.039144,0.051587,-0.005713,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.906039,-0.29439,0.304021,0.039447,0.050544,-0.005713,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.885766,-0.3507,0.304021,0.039815,0.049522,-0.005713,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.861997,-0.405625,0.304021,0.040246,0.048526,-0.005713,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.834827,-0.45895,0.304021,0.040739,0.047559,-0.005713,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.804362,-0.510464,0.304021,0.041292,0.046624,-0.005713,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.770723,-0.559963,0.304021,0.041902,0.045726,-0.005713,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.734041,-0.607252,0.304021,0.042568,0.044868,-0.005713,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.694463,-0.652144,0.304021,0.043286,0.044053,-0.005713,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.652144,-0.694463,0.304021,0.044053,0.043286,-0.005713,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.607252,-0.734041,0.304021,0.044868,0.042568,-0.005713,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.559963,-0.770723,0.304021,0.045726,0.041902,-0.005713,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.510464,-0.804362,0.304021,0.046624,0.041292,-0.005713,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.45895,-0.834827,0.304021,0.047559,0.040739,-0.005713,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.405625,-0.861997,0.304021,0.048526,0.040246,-0.005713,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.3507,-0.885766,0.304021,0.049522,0.039815,-0.005713,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.29439,-0.906039,0.304021,0.050544,0.039447,-0.005713,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.236918,-0.922736,0.304021,0.051587,0.039144,-0.005713,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.178512,-0.935791,0.304021,0.052646,0.038907,-0.005713,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	-0.119401,-0.945153,0.304021,0.053719,0.038737,-0.005713,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	-0.059818,-0.950786,0.304021,0.0548,0.038635,-0.005713,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	0,-0.952665,0.304021,0.055885,0.038601,-0.005713,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0.059818,-0.950786,0.304021,0.056971,0.038635,-0.005713,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.119401,-0.945153,0.304021,0.058052,0.038737,-0.005713,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.178512,-0.935791,0.304021,0.059124,0.038907,-0.005713,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.236918,-0.922736,0.304021,0.060184,0.039144,-0.005713,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.29439,-0.906039,0.304021,0.061226,0.039447,-0.005713,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.3507,-0.885766,0.304021,0.062248,0.039815,-0.005713,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.405625,-0.861997,0.304021,0.063245,0.040246,-0.005713,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.45895,-0.834827,0.304021,0.064212,0.040739,-0.005713,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.510464,-0.804362,0.304021,0.065147,0.041292,-0.005713,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.559963,-0.770723,0.304021,0.066045,0.041902,-0.005713,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.607252,-0.734041,0.304021,0.066903,0.042568,-0.005713,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.652144,-0.694463,0.304021,0.067717,0.043286,-0.005713,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.694463,-0.652144,0.304021,0.068485,0.044053,-0.005713,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.734041,-0.607252,0.304021,0.069203,0.044868,-0.005713,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.770723,-0.559963,0.304021,0.069869,0.045726,-0.005713,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.804362,-0.510464,0.304021,0.070479,0.046624,-0.005713,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.834827,-0.45895,0.304021,0.071032,0.047559,-0.005713,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.861997,-0.405625,0.304021,0.071525,0.048526,-0.005713,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.885766,-0.3507,0.304021,0.071956,0.049522,-0.005713,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.906039,-0.29439,0.304021,0.072324,0.050544,-0.005713,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.922736,-0.236918,0.304021,0.072627,0.051587,-0.005713,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.935791,-0.178512,0.304021,0.072863,0.052646,-0.005713,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.945153,-0.119401,0.304021,0.073033,0.053719,-0.005713,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.950786,-0.059818,0.304021,0.073135,0.0548,-0.005713,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.952665,0,0.304021,0.073169,0.055885,-0.005713,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.950786,0.059818,0.304021,0.073135,0.056971,-0.005713,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.945153,0.119401,0.304021,0.073033,0.058052,-0.005713,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.935791,0.178512,0.304021,0.072863,0.059124,-0.005713,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.922736,0.236918,0.304021,0.072627,0.060184,-0.005713,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.906039,0.29439,0.304021,0.072324,0.061226,-0.005713,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.885766,0.3507,0.304021,0.071956,0.062248,-0.005713,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.861997,0.405625,0.304021,0.071525,0.063245,-0.005713,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.834827,0.45895,0.304021,0.071032,0.064212,-0.005713,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.804362,0.510464,0.304021,0.070479,0.065147,-0.005713,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.770723,0.559963,0.304021,0.069869,0.066045,-0.005713,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.734041,0.607252,0.304021,0.069203,0.066903,-0.005713,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.694463,0.652144,0.304021,0.068485,0.067717,-0.005713,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.652144,0.694463,0.304021,0.067717,0.068485,-0.005713,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.607252,0.734041,0.304021,0.066903,0.069203,-0.005713,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.559963,0.770723,0.304021,0.066045,0.069869,-0.005713,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.510464,0.804362,0.304021,0.065147,0.070479,-0.005713,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.45895,0.834827,0.304021,0.064212,0.071032,-0.005713,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.405625,0.861997,0.304021,0.063245,0.071525,-0.005713,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.3507,0.885766,0.304021,0.062248,0.071956,-0.005713,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.29439,0.906039,0.304021,0.061226,0.072324,-0.005713,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.236918,0.922736,0.304021,0.060184,0.072627,-0.005713,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.178512,0.935791,0.304021,0.059124,0.072863,-0.005713,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0.119401,0.945153,0.304021,0.058052,0.073033,-0.005713,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	0.059818,0.950786,0.304021,0.056971,0.073135,-0.005713,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	0,0.952665,0.304021,0.055885,0.073169,-0.005713,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	-0.059818,0.950786,0.304021,0.0548,0.073135,-0.005713,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.119401,0.945153,0.304021,0.053719,0.073033,-0.005713,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.178512,0.935791,0.304021,0.052646,0.072863,-0.005713,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.236918,0.922736,0.304021,0.051587,0.072627,-0.005713,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.29439,0.906039,0.304021,0.050544,0.072324,-0.005713,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.3507,0.885766,0.304021,0.049522,0.071956,-0.005713,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.405625,0.861997,0.304021,0.048526,0.071525,-0.005713,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.45895,0.834827,0.304021,0.047559,0.071032,-0.005713,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.510464,0.804362,0.304021,0.046624,0.070479,-0.005713,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.559963,0.770723,0.304021,0.045726,0.069869,-0.005713,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.607252,0.734041,0.304021,0.044868,0.069203,-0.005713,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.652144,0.694463,0.304021,0.044053,0.068485,-0.005713,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.694463,0.652144,0.304021,0.043286,0.067717,-0.005713,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.734041,0.607252,0.304021,0.042568,0.066903,-0.005713,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.770723,0.559963,0.304021,0.041902,0.066045,-0.005713,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.804362,0.510464,0.304021,0.041292,0.065147,-0.005713,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.834827,0.45895,0.304021,0.040739,0.064212,-0.005713,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.861997,0.405625,0.304021,0.040246,0.063245,-0.005713,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.885766,0.3507,0.304021,0.039815,0.062248,-0.005713,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.906039,0.29439,0.304021,0.039447,0.061226,-0.005713,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.922736,0.236918,0.304021,0.039144,0.060184,-0.005713,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.935791,0.178512,0.304021,0.038907,0.059124,-0.005713,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.945153,0.119401,0.304021,0.038737,0.058052,-0.005713,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.950786,0.059818,0.304021,0.038635,0.056971,-0.005713,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.952665,0,0.304021,0.038601,0.055885,-0.005713,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.950786,-0.059818,0.304021,0.038635,0.0548,-0.005713,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.935791,-0.178512,0.304021,0.038907,0.052646,-0.005713,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.945153,-0.119401,0.304021,0.038737,0.053719,-0.005713,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.893669,-0.170477,0.415082,0.038961,0.052657,-0.00557,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.881202,-0.226254,0.415082,0.039198,0.051601,-0.00557,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.865256,-0.281139,0.415082,0.0395,0.050561,-0.00557,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.845896,-0.334914,0.415082,0.039866,0.049543,-0.00557,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.823197,-0.387367,0.415082,0.040296,0.048549,-0.00557,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.79725,-0.438292,0.415082,0.040787,0.047585,-0.00557,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.768156,-0.487487,0.415082,0.041338,0.046653,-0.00557,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.736031,-0.534758,0.415082,0.041947,0.045758,-0.00557,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.701001,-0.579918,0.415082,0.04261,0.044903,-0.00557,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.663204,-0.62279,0.415082,0.043326,0.044091,-0.00557,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.62279,-0.663204,0.415082,0.044091,0.043326,-0.00557,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.579918,-0.701001,0.415082,0.044903,0.04261,-0.00557,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.534758,-0.736031,0.415082,0.045758,0.041947,-0.00557,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.487487,-0.768156,0.415082,0.046653,0.041338,-0.00557,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.438292,-0.79725,0.415082,0.047585,0.040787,-0.00557,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.387367,-0.823197,0.415082,0.048549,0.040296,-0.00557,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.334914,-0.845896,0.415082,0.049543,0.039866,-0.00557,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.281139,-0.865256,0.415082,0.050561,0.0395,-0.00557,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.226254,-0.881202,0.415082,0.051601,0.039198,-0.00557,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.170477,-0.893669,0.415082,0.052657,0.038961,-0.00557,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	-0.114026,-0.90261,0.415082,0.053726,0.038792,-0.00557,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	-0.057126,-0.907989,0.415082,0.054803,0.03869,-0.00557,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	0,-0.909784,0.415082,0.055885,0.038656,-0.00557,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0.057126,-0.907989,0.415082,0.056967,0.03869,-0.00557,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.114026,-0.90261,0.415082,0.058045,0.038792,-0.00557,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.170477,-0.893669,0.415082,0.059114,0.038961,-0.00557,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.226254,-0.881202,0.415082,0.06017,0.039198,-0.00557,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.281139,-0.865256,0.415082,0.061209,0.0395,-0.00557,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.334914,-0.845896,0.415082,0.062228,0.039866,-0.00557,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.387367,-0.823197,0.415082,0.063221,0.040296,-0.00557,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.438292,-0.79725,0.415082,0.064185,0.040787,-0.00557,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.487487,-0.768156,0.415082,0.065117,0.041338,-0.00557,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.534758,-0.736031,0.415082,0.066012,0.041947,-0.00557,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.579918,-0.701001,0.415082,0.066868,0.04261,-0.00557,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.62279,-0.663204,0.415082,0.067679,0.043326,-0.00557,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.663204,-0.62279,0.415082,0.068445,0.044091,-0.00557,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.701001,-0.579918,0.415082,0.069161,0.044903,-0.00557,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.736031,-0.534758,0.415082,0.069824,0.045758,-0.00557,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.768156,-0.487487,0.415082,0.070432,0.046653,-0.00557,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.79725,-0.438292,0.415082,0.070983,0.047585,-0.00557,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.823197,-0.387367,0.415082,0.071475,0.048549,-0.00557,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.845896,-0.334914,0.415082,0.071905,0.049543,-0.00557,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.865256,-0.281139,0.415082,0.072271,0.050561,-0.00557,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.881202,-0.226254,0.415082,0.072573,0.051601,-0.00557,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.893669,-0.170477,0.415082,0.072809,0.052657,-0.00557,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.90261,-0.114026,0.415082,0.072978,0.053726,-0.00557,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.907989,-0.057126,0.415082,0.07308,0.054803,-0.00557,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.909784,0,0.415082,0.073114,0.055885,-0.00557,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.907989,0.057126,0.415082,0.07308,0.056967,-0.00557,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.90261,0.114026,0.415082,0.072978,0.058045,-0.00557,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.893669,0.170477,0.415082,0.072809,0.059114,-0.00557,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.881202,0.226254,0.415082,0.072573,0.06017,-0.00557,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.865256,0.281139,0.415082,0.072271,0.061209,-0.00557,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.845896,0.334914,0.415082,0.071905,0.062228,-0.00557,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.823197,0.387367,0.415082,0.071475,0.063221,-0.00557,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.79725,0.438292,0.415082,0.070983,0.064185,-0.00557,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.768156,0.487487,0.415082,0.070432,0.065117,-0.00557,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.736031,0.534758,0.415082,0.069824,0.066012,-0.00557,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.701001,0.579918,0.415082,0.069161,0.066868,-0.00557,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.663204,0.62279,0.415082,0.068445,0.067679,-0.00557,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.62279,0.663204,0.415082,0.067679,0.068445,-0.00557,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.579918,0.701001,0.415082,0.066868,0.069161,-0.00557,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.534758,0.736031,0.415082,0.066012,0.069824,-0.00557,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.487487,0.768156,0.415082,0.065117,0.070432,-0.00557,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.438292,0.79725,0.415082,0.064185,0.070983,-0.00557,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.387367,0.823197,0.415082,0.063221,0.071475,-0.00557,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.334914,0.845896,0.415082,0.062228,0.071905,-0.00557,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.281139,0.865256,0.415082,0.061209,0.072271,-0.00557,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.226254,0.881202,0.415082,0.06017,0.072573,-0.00557,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.170477,0.893669,0.415082,0.059114,0.072809,-0.00557,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0.114026,0.90261,0.415082,0.058045,0.072978,-0.00557,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	0.057126,0.907989,0.415082,0.056967,0.07308,-0.00557,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	0,0.909784,0.415082,0.055885,0.073114,-0.00557,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	-0.057126,0.907989,0.415082,0.054803,0.07308,-0.00557,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.114026,0.90261,0.415082,0.053726,0.072978,-0.00557,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.170477,0.893669,0.415082,0.052657,0.072809,-0.00557,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.226254,0.881202,0.415082,0.051601,0.072573,-0.00557,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.281139,0.865256,0.415082,0.050561,0.072271,-0.00557,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.334914,0.845896,0.415082,0.049543,0.071905,-0.00557,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.387367,0.823197,0.415082,0.048549,0.071475,-0.00557,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.438292,0.79725,0.415082,0.047585,0.070983,-0.00557,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.487487,0.768156,0.415082,0.046653,0.070432,-0.00557,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.534758,0.736031,0.415082,0.045758,0.069824,-0.00557,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.579918,0.701001,0.415082,0.044903,0.069161,-0.00557,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.62279,0.663204,0.415082,0.044091,0.068445,-0.00557,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.663204,0.62279,0.415082,0.043326,0.067679,-0.00557,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.701001,0.579918,0.415082,0.04261,0.066868,-0.00557,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.736031,0.534758,0.415082,0.041947,0.066012,-0.00557,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.768156,0.487487,0.415082,0.041338,0.065117,-0.00557,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.79725,0.438292,0.415082,0.040787,0.064185,-0.00557,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.823197,0.387367,0.415082,0.040296,0.063221,-0.00557,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.845896,0.334914,0.415082,0.039866,0.062228,-0.00557,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.865256,0.281139,0.415082,0.0395,0.061209,-0.00557,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.881202,0.226254,0.415082,0.039198,0.06017,-0.00557,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.893669,0.170477,0.415082,0.038961,0.059114,-0.00557,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.90261,0.114026,0.415082,0.038792,0.058045,-0.00557,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.907989,0.057126,0.415082,0.03869,0.056967,-0.00557,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.909784,0,0.415082,0.038656,0.055885,-0.00557,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.90261,-0.114026,0.415082,0.038792,0.053726,-0.00557,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.907989,-0.057126,0.415082,0.03869,0.054803,-0.00557,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.847274,-0.107036,0.52026,0.038863,0.053735,-0.005434,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.838881,-0.160025,0.52026,0.039032,0.05267,-0.005434,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.827178,-0.212383,0.52026,0.039267,0.051619,-0.005434,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.81221,-0.263903,0.52026,0.039568,0.050584,-0.005434,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.794037,-0.314381,0.52026,0.039933,0.049569,-0.005434,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.77273,-0.363619,0.52026,0.040361,0.04858,-0.005434,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.748373,-0.411421,0.52026,0.04085,0.04762,-0.005434,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.721063,-0.4576,0.52026,0.041399,0.046692,-0.005434,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.690907,-0.501973,0.52026,0.042005,0.045801,-0.005434,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.658024,-0.544365,0.52026,0.042666,0.044949,-0.005434,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.622545,-0.584609,0.52026,0.043378,0.04414,-0.005434,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.584609,-0.622545,0.52026,0.04414,0.043378,-0.005434,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.544365,-0.658024,0.52026,0.044949,0.042666,-0.005434,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.501973,-0.690907,0.52026,0.045801,0.042005,-0.005434,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.4576,-0.721063,0.52026,0.046692,0.041399,-0.005434,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.411421,-0.748373,0.52026,0.04762,0.04085,-0.005434,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.363619,-0.77273,0.52026,0.04858,0.040361,-0.005434,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.314381,-0.794037,0.52026,0.049569,0.039933,-0.005434,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.263903,-0.81221,0.52026,0.050584,0.039568,-0.005434,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.212383,-0.827178,0.52026,0.051619,0.039267,-0.005434,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.160025,-0.838881,0.52026,0.05267,0.039032,-0.005434,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	-0.107036,-0.847274,0.52026,0.053735,0.038863,-0.005434,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	-0.053624,-0.852323,0.52026,0.054808,0.038762,-0.005434,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	0,-0.854008,0.52026,0.055885,0.038728,-0.005434,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0.053624,-0.852323,0.52026,0.056963,0.038762,-0.005434,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.107036,-0.847274,0.52026,0.058036,0.038863,-0.005434,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.160025,-0.838881,0.52026,0.0591,0.039032,-0.005434,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.212383,-0.827178,0.52026,0.060152,0.039267,-0.005434,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.263903,-0.81221,0.52026,0.061187,0.039568,-0.005434,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.314381,-0.794037,0.52026,0.062201,0.039933,-0.005434,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.363619,-0.77273,0.52026,0.06319,0.040361,-0.005434,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.411421,-0.748373,0.52026,0.064151,0.04085,-0.005434,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.4576,-0.721063,0.52026,0.065079,0.041399,-0.005434,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.501973,-0.690907,0.52026,0.06597,0.042005,-0.005434,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.544365,-0.658024,0.52026,0.066822,0.042666,-0.005434,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.584609,-0.622545,0.52026,0.06763,0.043378,-0.005434,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.622545,-0.584609,0.52026,0.068392,0.04414,-0.005434,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.658024,-0.544365,0.52026,0.069105,0.044949,-0.005434,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.690907,-0.501973,0.52026,0.069766,0.045801,-0.005434,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.721063,-0.4576,0.52026,0.070372,0.046692,-0.005434,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.748373,-0.411421,0.52026,0.07092,0.04762,-0.005434,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.77273,-0.363619,0.52026,0.07141,0.04858,-0.005434,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.794037,-0.314381,0.52026,0.071838,0.049569,-0.005434,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.81221,-0.263903,0.52026,0.072203,0.050584,-0.005434,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.827178,-0.212383,0.52026,0.072503,0.051619,-0.005434,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.838881,-0.160025,0.52026,0.072739,0.05267,-0.005434,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.847274,-0.107036,0.52026,0.072907,0.053735,-0.005434,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.852323,-0.053624,0.52026,0.073009,0.054808,-0.005434,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.854008,0,0.52026,0.073042,0.055885,-0.005434,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.852323,0.053624,0.52026,0.073009,0.056963,-0.005434,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.847274,0.107036,0.52026,0.072907,0.058036,-0.005434,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.838881,0.160025,0.52026,0.072739,0.0591,-0.005434,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.827178,0.212383,0.52026,0.072503,0.060152,-0.005434,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.81221,0.263903,0.52026,0.072203,0.061187,-0.005434,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.794037,0.314381,0.52026,0.071838,0.062201,-0.005434,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.77273,0.363619,0.52026,0.07141,0.06319,-0.005434,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.748373,0.411421,0.52026,0.07092,0.064151,-0.005434,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.721063,0.4576,0.52026,0.070372,0.065079,-0.005434,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.690907,0.501973,0.52026,0.069766,0.06597,-0.005434,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.658024,0.544365,0.52026,0.069105,0.066822,-0.005434,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.622545,0.584609,0.52026,0.068392,0.06763,-0.005434,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.584609,0.622545,0.52026,0.06763,0.068392,-0.005434,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.544365,0.658024,0.52026,0.066822,0.069105,-0.005434,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.501973,0.690907,0.52026,0.06597,0.069766,-0.005434,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.4576,0.721063,0.52026,0.065079,0.070372,-0.005434,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.411421,0.748373,0.52026,0.064151,0.07092,-0.005434,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.363619,0.77273,0.52026,0.06319,0.07141,-0.005434,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.314381,0.794037,0.52026,0.062201,0.071838,-0.005434,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.263903,0.81221,0.52026,0.061187,0.072203,-0.005434,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.212383,0.827178,0.52026,0.060152,0.072503,-0.005434,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.160025,0.838881,0.52026,0.0591,0.072739,-0.005434,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0.107036,0.847274,0.52026,0.058036,0.072907,-0.005434,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	0.053624,0.852323,0.52026,0.056963,0.073009,-0.005434,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	0,0.854008,0.52026,0.055885,0.073042,-0.005434,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	-0.053624,0.852323,0.52026,0.054808,0.073009,-0.005434,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.107036,0.847274,0.52026,0.053735,0.072907,-0.005434,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.160025,0.838881,0.52026,0.05267,0.072739,-0.005434,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.212383,0.827178,0.52026,0.051619,0.072503,-0.005434,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.263903,0.81221,0.52026,0.050584,0.072203,-0.005434,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.314381,0.794037,0.52026,0.049569,0.071838,-0.005434,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.363619,0.77273,0.52026,0.04858,0.07141,-0.005434,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.411421,0.748373,0.52026,0.04762,0.07092,-0.005434,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.4576,0.721063,0.52026,0.046692,0.070372,-0.005434,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.501973,0.690907,0.52026,0.045801,0.069766,-0.005434,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.544365,0.658024,0.52026,0.044949,0.069105,-0.005434,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.584609,0.622545,0.52026,0.04414,0.068392,-0.005434,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.622545,0.584609,0.52026,0.043378,0.06763,-0.005434,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.658024,0.544365,0.52026,0.042666,0.066822,-0.005434,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.690907,0.501973,0.52026,0.042005,0.06597,-0.005434,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.721063,0.4576,0.52026,0.041399,0.065079,-0.005434,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.748373,0.411421,0.52026,0.04085,0.064151,-0.005434,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.77273,0.363619,0.52026,0.040361,0.06319,-0.005434,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.794037,0.314381,0.52026,0.039933,0.062201,-0.005434,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.81221,0.263903,0.52026,0.039568,0.061187,-0.005434,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.827178,0.212383,0.52026,0.039267,0.060152,-0.005434,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.838881,0.160025,0.52026,0.039032,0.0591,-0.005434,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.847274,0.107036,0.52026,0.038863,0.058036,-0.005434,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.852323,0.053624,0.52026,0.038762,0.056963,-0.005434,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.852323,-0.053624,0.52026,0.038762,0.054808,-0.005434,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.854008,0,0.52026,0.038728,0.055885,-0.005434,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.784577,-0.049361,0.618064,0.038849,0.054813,-0.005308,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.779929,-0.098528,0.618064,0.03895,0.053746,-0.005308,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.772203,-0.147306,0.618064,0.039118,0.052687,-0.005308,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.76143,-0.195502,0.618064,0.039352,0.05164,-0.005308,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.747652,-0.242927,0.618064,0.039651,0.05061,-0.005308,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.730923,-0.289393,0.618064,0.040014,0.049601,-0.005308,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.71131,-0.334717,0.618064,0.04044,0.048617,-0.005308,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.688889,-0.37872,0.618064,0.040927,0.047662,-0.005308,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.66375,-0.421228,0.618064,0.041473,0.046739,-0.005308,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.635991,-0.462074,0.618064,0.042076,0.045852,-0.005308,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.605722,-0.501097,0.618064,0.042733,0.045005,-0.005308,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.573062,-0.538141,0.618064,0.043442,0.0442,-0.005308,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.538141,-0.573062,0.618064,0.0442,0.043442,-0.005308,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.501097,-0.605722,0.618064,0.045005,0.042733,-0.005308,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.462074,-0.635991,0.618064,0.045852,0.042076,-0.005308,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.421228,-0.66375,0.618064,0.046739,0.041473,-0.005308,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.37872,-0.688889,0.618064,0.047662,0.040927,-0.005308,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.334717,-0.71131,0.618064,0.048617,0.04044,-0.005308,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.289393,-0.730923,0.618064,0.049601,0.040014,-0.005308,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.242927,-0.747652,0.618064,0.05061,0.039651,-0.005308,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.195502,-0.76143,0.618064,0.05164,0.039352,-0.005308,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.147306,-0.772203,0.618064,0.052687,0.039118,-0.005308,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	-0.098528,-0.779929,0.618064,0.053746,0.03895,-0.005308,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	-0.049361,-0.784577,0.618064,0.054813,0.038849,-0.005308,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	0,-0.786128,0.618064,0.055885,0.038816,-0.005308,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0.049361,-0.784577,0.618064,0.056957,0.038849,-0.005308,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.098528,-0.779929,0.618064,0.058025,0.03895,-0.005308,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.147306,-0.772203,0.618064,0.059084,0.039118,-0.005308,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.195502,-0.76143,0.618064,0.06013,0.039352,-0.005308,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.242927,-0.747652,0.618064,0.06116,0.039651,-0.005308,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.289393,-0.730923,0.618064,0.062169,0.040014,-0.005308,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.334717,-0.71131,0.618064,0.063153,0.04044,-0.005308,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.37872,-0.688889,0.618064,0.064109,0.040927,-0.005308,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.421228,-0.66375,0.618064,0.065032,0.041473,-0.005308,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.462074,-0.635991,0.618064,0.065919,0.042076,-0.005308,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.501097,-0.605722,0.618064,0.066766,0.042733,-0.005308,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.538141,-0.573062,0.618064,0.06757,0.043442,-0.005308,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.573062,-0.538141,0.618064,0.068329,0.0442,-0.005308,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.605722,-0.501097,0.618064,0.069038,0.045005,-0.005308,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.635991,-0.462074,0.618064,0.069695,0.045852,-0.005308,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.66375,-0.421228,0.618064,0.070298,0.046739,-0.005308,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.688889,-0.37872,0.618064,0.070844,0.047662,-0.005308,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.71131,-0.334717,0.618064,0.07133,0.048617,-0.005308,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.730923,-0.289393,0.618064,0.071756,0.049601,-0.005308,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.747652,-0.242927,0.618064,0.07212,0.05061,-0.005308,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.76143,-0.195502,0.618064,0.072419,0.05164,-0.005308,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.772203,-0.147306,0.618064,0.072653,0.052687,-0.005308,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.779929,-0.098528,0.618064,0.07282,0.053746,-0.005308,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.784577,-0.049361,0.618064,0.072921,0.054813,-0.005308,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.786128,0,0.618064,0.072955,0.055885,-0.005308,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.784577,0.049361,0.618064,0.072921,0.056957,-0.005308,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.779929,0.098528,0.618064,0.07282,0.058025,-0.005308,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.772203,0.147306,0.618064,0.072653,0.059084,-0.005308,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.76143,0.195502,0.618064,0.072419,0.06013,-0.005308,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.747652,0.242927,0.618064,0.07212,0.06116,-0.005308,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.730923,0.289393,0.618064,0.071756,0.062169,-0.005308,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.71131,0.334717,0.618064,0.07133,0.063153,-0.005308,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.688889,0.37872,0.618064,0.070844,0.064109,-0.005308,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.66375,0.421228,0.618064,0.070298,0.065032,-0.005308,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.635991,0.462074,0.618064,0.069695,0.065919,-0.005308,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.605722,0.501097,0.618064,0.069038,0.066766,-0.005308,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.573062,0.538141,0.618064,0.068329,0.06757,-0.005308,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.538141,0.573062,0.618064,0.06757,0.068329,-0.005308,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.501097,0.605722,0.618064,0.066766,0.069038,-0.005308,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.462074,0.635991,0.618064,0.065919,0.069695,-0.005308,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.421228,0.66375,0.618064,0.065032,0.070298,-0.005308,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.37872,0.688889,0.618064,0.064109,0.070844,-0.005308,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.334717,0.71131,0.618064,0.063153,0.07133,-0.005308,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.289393,0.730923,0.618064,0.062169,0.071756,-0.005308,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.242927,0.747652,0.618064,0.06116,0.07212,-0.005308,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.195502,0.76143,0.618064,0.06013,0.072419,-0.005308,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.147306,0.772203,0.618064,0.059084,0.072653,-0.005308,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0.098528,0.779929,0.618064,0.058025,0.07282,-0.005308,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	0.049361,0.784577,0.618064,0.056957,0.072921,-0.005308,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	0,0.786128,0.618064,0.055885,0.072955,-0.005308,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	-0.049361,0.784577,0.618064,0.054813,0.072921,-0.005308,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.098528,0.779929,0.618064,0.053746,0.07282,-0.005308,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.147306,0.772203,0.618064,0.052687,0.072653,-0.005308,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.195502,0.76143,0.618064,0.05164,0.072419,-0.005308,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.242927,0.747652,0.618064,0.05061,0.07212,-0.005308,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.289393,0.730923,0.618064,0.049601,0.071756,-0.005308,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.334717,0.71131,0.618064,0.048617,0.07133,-0.005308,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.37872,0.688889,0.618064,0.047662,0.070844,-0.005308,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.421228,0.66375,0.618064,0.046739,0.070298,-0.005308,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.462074,0.635991,0.618064,0.045852,0.069695,-0.005308,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.501097,0.605722,0.618064,0.045005,0.069038,-0.005308,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.538141,0.573062,0.618064,0.0442,0.068329,-0.005308,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.573062,0.538141,0.618064,0.043442,0.06757,-0.005308,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.605722,0.501097,0.618064,0.042733,0.066766,-0.005308,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.635991,0.462074,0.618064,0.042076,0.065919,-0.005308,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.66375,0.421228,0.618064,0.041473,0.065032,-0.005308,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.688889,0.37872,0.618064,0.040927,0.064109,-0.005308,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.71131,0.334717,0.618064,0.04044,0.063153,-0.005308,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.730923,0.289393,0.618064,0.040014,0.062169,-0.005308,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.747652,0.242927,0.618064,0.039651,0.06116,-0.005308,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.76143,0.195502,0.618064,0.039352,0.06013,-0.005308,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.772203,0.147306,0.618064,0.039118,0.059084,-0.005308,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.779929,0.098528,0.618064,0.03895,0.058025,-0.005308,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.786128,0,0.618064,0.038816,0.055885,-0.005308,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.784577,0.049361,0.618064,0.038849,0.056957,-0.005308,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.707106,0,0.707108,0.038917,0.055885,-0.005193,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.70571,-0.0444,0.707108,0.038951,0.05482,-0.005193,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.70153,-0.088624,0.707108,0.039051,0.053759,-0.005193,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.694581,-0.132498,0.707108,0.039218,0.052706,-0.005193,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.684891,-0.17585,0.707108,0.03945,0.051666,-0.005193,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.672497,-0.218508,0.707108,0.039748,0.050642,-0.005193,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.65745,-0.260303,0.707108,0.040109,0.049639,-0.005193,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.639808,-0.301071,0.707108,0.040532,0.048661,-0.005193,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.619641,-0.340651,0.707108,0.041016,0.047711,-0.005193,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.597029,-0.378886,0.707108,0.041559,0.046793,-0.005193,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.57206,-0.415626,0.707108,0.042158,0.045912,-0.005193,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.544834,-0.450726,0.707108,0.042811,0.04507,-0.005193,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.515458,-0.484047,0.707108,0.043516,0.04427,-0.005193,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.484047,-0.515458,0.707108,0.04427,0.043516,-0.005193,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.450726,-0.544834,0.707108,0.04507,0.042811,-0.005193,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.415626,-0.57206,0.707108,0.045912,0.042158,-0.005193,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.378886,-0.597029,0.707108,0.046793,0.041559,-0.005193,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.340651,-0.619641,0.707108,0.047711,0.041016,-0.005193,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.301071,-0.639808,0.707108,0.048661,0.040532,-0.005193,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.260303,-0.65745,0.707108,0.049639,0.040109,-0.005193,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.218508,-0.672497,0.707108,0.050642,0.039748,-0.005193,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.17585,-0.684891,0.707108,0.051666,0.03945,-0.005193,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.132498,-0.694581,0.707108,0.052706,0.039218,-0.005193,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	-0.088624,-0.70153,0.707108,0.053759,0.039051,-0.005193,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	-0.0444,-0.70571,0.707108,0.05482,0.038951,-0.005193,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	0,-0.707106,0.707108,0.055885,0.038917,-0.005193,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0.0444,-0.70571,0.707108,0.056951,0.038951,-0.005193,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.088624,-0.70153,0.707108,0.058012,0.039051,-0.005193,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.132498,-0.694581,0.707108,0.059065,0.039218,-0.005193,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.17585,-0.684891,0.707108,0.060105,0.03945,-0.005193,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.218508,-0.672497,0.707108,0.061129,0.039748,-0.005193,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.260303,-0.65745,0.707108,0.062132,0.040109,-0.005193,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.301071,-0.639808,0.707108,0.06311,0.040532,-0.005193,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.340651,-0.619641,0.707108,0.06406,0.041016,-0.005193,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.378886,-0.597029,0.707108,0.064977,0.041559,-0.005193,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.415626,-0.57206,0.707108,0.065859,0.042158,-0.005193,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.450726,-0.544834,0.707108,0.066701,0.042811,-0.005193,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.484047,-0.515458,0.707108,0.067501,0.043516,-0.005193,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.515458,-0.484047,0.707108,0.068254,0.04427,-0.005193,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.544834,-0.450726,0.707108,0.068959,0.04507,-0.005193,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.57206,-0.415626,0.707108,0.069613,0.045912,-0.005193,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.597029,-0.378886,0.707108,0.070212,0.046793,-0.005193,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.619641,-0.340651,0.707108,0.070754,0.047711,-0.005193,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.639808,-0.301071,0.707108,0.071238,0.048661,-0.005193,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.65745,-0.260303,0.707108,0.071662,0.049639,-0.005193,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.672497,-0.218508,0.707108,0.072023,0.050642,-0.005193,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.684891,-0.17585,0.707108,0.07232,0.051666,-0.005193,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.694581,-0.132498,0.707108,0.072553,0.052706,-0.005193,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.70153,-0.088624,0.707108,0.072719,0.053759,-0.005193,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.70571,-0.0444,0.707108,0.07282,0.05482,-0.005193,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.707106,0,0.707108,0.072853,0.055885,-0.005193,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.70571,0.0444,0.707108,0.07282,0.056951,-0.005193,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.70153,0.088624,0.707108,0.072719,0.058012,-0.005193,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.694581,0.132498,0.707108,0.072553,0.059065,-0.005193,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.684891,0.17585,0.707108,0.07232,0.060105,-0.005193,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.672497,0.218508,0.707108,0.072023,0.061129,-0.005193,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.65745,0.260303,0.707108,0.071662,0.062132,-0.005193,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.639808,0.301071,0.707108,0.071238,0.06311,-0.005193,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.619641,0.340651,0.707108,0.070754,0.06406,-0.005193,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.597029,0.378886,0.707108,0.070212,0.064977,-0.005193,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.57206,0.415626,0.707108,0.069613,0.065859,-0.005193,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.544834,0.450726,0.707108,0.068959,0.066701,-0.005193,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.515458,0.484047,0.707108,0.068254,0.067501,-0.005193,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.484047,0.515458,0.707108,0.067501,0.068254,-0.005193,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.450726,0.544834,0.707108,0.066701,0.068959,-0.005193,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.415626,0.57206,0.707108,0.065859,0.069613,-0.005193,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.378886,0.597029,0.707108,0.064977,0.070212,-0.005193,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.340651,0.619641,0.707108,0.06406,0.070754,-0.005193,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.301071,0.639808,0.707108,0.06311,0.071238,-0.005193,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.260303,0.65745,0.707108,0.062132,0.071662,-0.005193,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.218508,0.672497,0.707108,0.061129,0.072023,-0.005193,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.17585,0.684891,0.707108,0.060105,0.07232,-0.005193,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.132498,0.694581,0.707108,0.059065,0.072553,-0.005193,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0.088624,0.70153,0.707108,0.058012,0.072719,-0.005193,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	0.0444,0.70571,0.707108,0.056951,0.07282,-0.005193,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	0,0.707106,0.707108,0.055885,0.072853,-0.005193,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	-0.0444,0.70571,0.707108,0.05482,0.07282,-0.005193,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.088624,0.70153,0.707108,0.053759,0.072719,-0.005193,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.132498,0.694581,0.707108,0.052706,0.072553,-0.005193,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.17585,0.684891,0.707108,0.051666,0.07232,-0.005193,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.218508,0.672497,0.707108,0.050642,0.072023,-0.005193,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.260303,0.65745,0.707108,0.049639,0.071662,-0.005193,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.301071,0.639808,0.707108,0.048661,0.071238,-0.005193,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.340651,0.619641,0.707108,0.047711,0.070754,-0.005193,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.378886,0.597029,0.707108,0.046793,0.070212,-0.005193,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.415626,0.57206,0.707108,0.045912,0.069613,-0.005193,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.450726,0.544834,0.707108,0.04507,0.068959,-0.005193,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.484047,0.515458,0.707108,0.04427,0.068254,-0.005193,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.515458,0.484047,0.707108,0.043516,0.067501,-0.005193,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.544834,0.450726,0.707108,0.042811,0.066701,-0.005193,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.57206,0.415626,0.707108,0.042158,0.065859,-0.005193,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.597029,0.378886,0.707108,0.041559,0.064977,-0.005193,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.619641,0.340651,0.707108,0.041016,0.06406,-0.005193,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.639808,0.301071,0.707108,0.040532,0.06311,-0.005193,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.65745,0.260303,0.707108,0.040109,0.062132,-0.005193,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.672497,0.218508,0.707108,0.039748,0.061129,-0.005193,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.684891,0.17585,0.707108,0.03945,0.060105,-0.005193,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.694581,0.132498,0.707108,0.039218,0.059065,-0.005193,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.70571,0.0444,0.707108,0.038951,0.056951,-0.005193,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.70153,0.088624,0.707108,0.039051,0.058012,-0.005193,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.616842,0.038808,0.78613,0.039065,0.056943,-0.005092,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.618061,0,0.78613,0.039032,0.055885,-0.005092,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.616842,-0.038808,0.78613,0.039065,0.054827,-0.005092,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.613188,-0.077464,0.78613,0.039165,0.053773,-0.005092,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.607114,-0.115813,0.78613,0.039331,0.052727,-0.005092,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.598644,-0.153706,0.78613,0.039562,0.051694,-0.005092,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.587811,-0.190991,0.78613,0.039857,0.050677,-0.005092,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.574659,-0.227524,0.78613,0.040215,0.049681,-0.005092,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.559239,-0.263158,0.78613,0.040636,0.048709,-0.005092,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.541611,-0.297753,0.78613,0.041117,0.047766,-0.005092,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.521846,-0.331174,0.78613,0.041656,0.046855,-0.005092,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.500022,-0.363287,0.78613,0.042251,0.045979,-0.005092,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.476224,-0.393967,0.78613,0.0429,0.045143,-0.005092,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.450547,-0.423092,0.78613,0.0436,0.044348,-0.005092,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.423092,-0.450547,0.78613,0.044348,0.0436,-0.005092,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.393967,-0.476224,0.78613,0.045143,0.0429,-0.005092,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.363287,-0.500022,0.78613,0.045979,0.042251,-0.005092,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.331174,-0.521846,0.78613,0.046855,0.041656,-0.005092,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.297753,-0.541611,0.78613,0.047766,0.041117,-0.005092,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.263158,-0.559239,0.78613,0.048709,0.040636,-0.005092,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.227524,-0.574659,0.78613,0.049681,0.040215,-0.005092,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.190991,-0.587811,0.78613,0.050677,0.039857,-0.005092,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.153706,-0.598644,0.78613,0.051694,0.039562,-0.005092,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.115813,-0.607114,0.78613,0.052727,0.039331,-0.005092,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	-0.077464,-0.613188,0.78613,0.053773,0.039165,-0.005092,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	-0.038808,-0.616842,0.78613,0.054827,0.039065,-0.005092,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	0,-0.618061,0.78613,0.055885,0.039032,-0.005092,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0.038808,-0.616842,0.78613,0.056943,0.039065,-0.005092,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.077464,-0.613188,0.78613,0.057998,0.039165,-0.005092,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.115813,-0.607114,0.78613,0.059043,0.039331,-0.005092,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.153706,-0.598644,0.78613,0.060077,0.039562,-0.005092,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.190991,-0.587811,0.78613,0.061093,0.039857,-0.005092,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.227524,-0.574659,0.78613,0.062089,0.040215,-0.005092,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.263158,-0.559239,0.78613,0.063061,0.040636,-0.005092,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.297753,-0.541611,0.78613,0.064004,0.041117,-0.005092,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.331174,-0.521846,0.78613,0.064916,0.041656,-0.005092,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.363287,-0.500022,0.78613,0.065791,0.042251,-0.005092,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.393967,-0.476224,0.78613,0.066628,0.0429,-0.005092,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.423092,-0.450547,0.78613,0.067422,0.0436,-0.005092,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.450547,-0.423092,0.78613,0.068171,0.044348,-0.005092,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.476224,-0.393967,0.78613,0.068871,0.045143,-0.005092,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.500022,-0.363287,0.78613,0.06952,0.045979,-0.005092,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.521846,-0.331174,0.78613,0.070115,0.046855,-0.005092,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.541611,-0.297753,0.78613,0.070654,0.047766,-0.005092,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.559239,-0.263158,0.78613,0.071135,0.048709,-0.005092,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.574659,-0.227524,0.78613,0.071555,0.049681,-0.005092,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.587811,-0.190991,0.78613,0.071914,0.050677,-0.005092,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.598644,-0.153706,0.78613,0.072209,0.051694,-0.005092,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.607114,-0.115813,0.78613,0.07244,0.052727,-0.005092,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.613188,-0.077464,0.78613,0.072606,0.053773,-0.005092,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.616842,-0.038808,0.78613,0.072705,0.054827,-0.005092,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.618061,0,0.78613,0.072739,0.055885,-0.005092,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.616842,0.038808,0.78613,0.072705,0.056943,-0.005092,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.613188,0.077464,0.78613,0.072606,0.057998,-0.005092,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.607114,0.115813,0.78613,0.07244,0.059043,-0.005092,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.598644,0.153706,0.78613,0.072209,0.060077,-0.005092,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.587811,0.190991,0.78613,0.071914,0.061093,-0.005092,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.574659,0.227524,0.78613,0.071555,0.062089,-0.005092,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.559239,0.263158,0.78613,0.071135,0.063061,-0.005092,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.541611,0.297753,0.78613,0.070654,0.064004,-0.005092,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.521846,0.331174,0.78613,0.070115,0.064916,-0.005092,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.500022,0.363287,0.78613,0.06952,0.065791,-0.005092,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.476224,0.393967,0.78613,0.068871,0.066628,-0.005092,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.450547,0.423092,0.78613,0.068171,0.067422,-0.005092,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.423092,0.450547,0.78613,0.067422,0.068171,-0.005092,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.393967,0.476224,0.78613,0.066628,0.068871,-0.005092,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.363287,0.500022,0.78613,0.065791,0.06952,-0.005092,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.331174,0.521846,0.78613,0.064916,0.070115,-0.005092,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.297753,0.541611,0.78613,0.064004,0.070654,-0.005092,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.263158,0.559239,0.78613,0.063061,0.071135,-0.005092,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.227524,0.574659,0.78613,0.062089,0.071555,-0.005092,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.190991,0.587811,0.78613,0.061093,0.071914,-0.005092,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.153706,0.598644,0.78613,0.060077,0.072209,-0.005092,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.115813,0.607114,0.78613,0.059043,0.07244,-0.005092,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0.077464,0.613188,0.78613,0.057998,0.072606,-0.005092,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	0.038808,0.616842,0.78613,0.056943,0.072705,-0.005092,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	0,0.618061,0.78613,0.055885,0.072739,-0.005092,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	-0.038808,0.616842,0.78613,0.054827,0.072705,-0.005092,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.077464,0.613188,0.78613,0.053773,0.072606,-0.005092,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.115813,0.607114,0.78613,0.052727,0.07244,-0.005092,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.153706,0.598644,0.78613,0.051694,0.072209,-0.005092,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.190991,0.587811,0.78613,0.050677,0.071914,-0.005092,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.227524,0.574659,0.78613,0.049681,0.071555,-0.005092,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.263158,0.559239,0.78613,0.048709,0.071135,-0.005092,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.297753,0.541611,0.78613,0.047766,0.070654,-0.005092,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.331174,0.521846,0.78613,0.046855,0.070115,-0.005092,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.363287,0.500022,0.78613,0.045979,0.06952,-0.005092,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.393967,0.476224,0.78613,0.045143,0.068871,-0.005092,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.423092,0.450547,0.78613,0.044348,0.068171,-0.005092,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.450547,0.423092,0.78613,0.0436,0.067422,-0.005092,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.476224,0.393967,0.78613,0.0429,0.066628,-0.005092,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.500022,0.363287,0.78613,0.042251,0.065791,-0.005092,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.521846,0.331174,0.78613,0.041656,0.064916,-0.005092,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.541611,0.297753,0.78613,0.041117,0.064004,-0.005092,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.559239,0.263158,0.78613,0.040636,0.063061,-0.005092,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.574659,0.227524,0.78613,0.040215,0.062089,-0.005092,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.587811,0.190991,0.78613,0.039857,0.061093,-0.005092,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.598644,0.153706,0.78613,0.039562,0.060077,-0.005092,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.613188,0.077464,0.78613,0.039165,0.057998,-0.005092,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.607114,0.115813,0.78613,0.039331,0.059043,-0.005092,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.516155,0.065205,0.85401,0.03929,0.057982,-0.005004,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.519231,0.032667,0.85401,0.039191,0.056936,-0.005004,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.520257,0,0.85401,0.039158,0.055885,-0.005004,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.519231,-0.032667,0.85401,0.039191,0.054835,-0.005004,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.516155,-0.065205,0.85401,0.03929,0.053789,-0.005004,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.511042,-0.097487,0.85401,0.039454,0.052751,-0.005004,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.503912,-0.129383,0.85401,0.039684,0.051725,-0.005004,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.494794,-0.160768,0.85401,0.039977,0.050716,-0.005004,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.483723,-0.191519,0.85401,0.040333,0.049728,-0.005004,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.470743,-0.221515,0.85401,0.04075,0.048763,-0.005004,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.455905,-0.250636,0.85401,0.041227,0.047827,-0.005004,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.439268,-0.278768,0.85401,0.041762,0.046922,-0.005004,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.420897,-0.3058,0.85401,0.042353,0.046053,-0.005004,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.400865,-0.331624,0.85401,0.042997,0.045223,-0.005004,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.379251,-0.356141,0.85401,0.043692,0.044435,-0.005004,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.356141,-0.379251,0.85401,0.044435,0.043692,-0.005004,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.331624,-0.400865,0.85401,0.045223,0.042997,-0.005004,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.3058,-0.420897,0.85401,0.046053,0.042353,-0.005004,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.278768,-0.439268,0.85401,0.046922,0.041762,-0.005004,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.250636,-0.455905,0.85401,0.047827,0.041227,-0.005004,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.221515,-0.470743,0.85401,0.048763,0.04075,-0.005004,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.191519,-0.483723,0.85401,0.049728,0.040333,-0.005004,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.160768,-0.494794,0.85401,0.050716,0.039977,-0.005004,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.129383,-0.503912,0.85401,0.051725,0.039684,-0.005004,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.097487,-0.511042,0.85401,0.052751,0.039454,-0.005004,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	-0.065205,-0.516155,0.85401,0.053789,0.03929,-0.005004,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	-0.032667,-0.519231,0.85401,0.054835,0.039191,-0.005004,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	0,-0.520257,0.85401,0.055885,0.039158,-0.005004,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0.032667,-0.519231,0.85401,0.056936,0.039191,-0.005004,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.065205,-0.516155,0.85401,0.057982,0.03929,-0.005004,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.097487,-0.511042,0.85401,0.05902,0.039454,-0.005004,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.129383,-0.503912,0.85401,0.060045,0.039684,-0.005004,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.160768,-0.494794,0.85401,0.061054,0.039977,-0.005004,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.191519,-0.483723,0.85401,0.062043,0.040333,-0.005004,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.221515,-0.470743,0.85401,0.063007,0.04075,-0.005004,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.250636,-0.455905,0.85401,0.063944,0.041227,-0.005004,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.278768,-0.439268,0.85401,0.064848,0.041762,-0.005004,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.3058,-0.420897,0.85401,0.065717,0.042353,-0.005004,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.331624,-0.400865,0.85401,0.066548,0.042997,-0.005004,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.356141,-0.379251,0.85401,0.067336,0.043692,-0.005004,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.379251,-0.356141,0.85401,0.068079,0.044435,-0.005004,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.400865,-0.331624,0.85401,0.068774,0.045223,-0.005004,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.420897,-0.3058,0.85401,0.069418,0.046053,-0.005004,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.439268,-0.278768,0.85401,0.070009,0.046922,-0.005004,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.455905,-0.250636,0.85401,0.070543,0.047827,-0.005004,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.470743,-0.221515,0.85401,0.071021,0.048763,-0.005004,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.483723,-0.191519,0.85401,0.071438,0.049728,-0.005004,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.494794,-0.160768,0.85401,0.071794,0.050716,-0.005004,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.503912,-0.129383,0.85401,0.072087,0.051725,-0.005004,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.511042,-0.097487,0.85401,0.072316,0.052751,-0.005004,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.516155,-0.065205,0.85401,0.072481,0.053789,-0.005004,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.519231,-0.032667,0.85401,0.07258,0.054835,-0.005004,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.520257,0,0.85401,0.072613,0.055885,-0.005004,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.519231,0.032667,0.85401,0.07258,0.056936,-0.005004,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.516155,0.065205,0.85401,0.072481,0.057982,-0.005004,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.511042,0.097487,0.85401,0.072316,0.05902,-0.005004,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.503912,0.129383,0.85401,0.072087,0.060045,-0.005004,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.494794,0.160768,0.85401,0.071794,0.061054,-0.005004,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.483723,0.191519,0.85401,0.071438,0.062043,-0.005004,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.470743,0.221515,0.85401,0.071021,0.063007,-0.005004,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.455905,0.250636,0.85401,0.070543,0.063944,-0.005004,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.439268,0.278768,0.85401,0.070009,0.064848,-0.005004,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.420897,0.3058,0.85401,0.069418,0.065717,-0.005004,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.400865,0.331624,0.85401,0.068774,0.066548,-0.005004,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.379251,0.356141,0.85401,0.068079,0.067336,-0.005004,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.356141,0.379251,0.85401,0.067336,0.068079,-0.005004,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.331624,0.400865,0.85401,0.066548,0.068774,-0.005004,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.3058,0.420897,0.85401,0.065717,0.069418,-0.005004,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.278768,0.439268,0.85401,0.064848,0.070009,-0.005004,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.250636,0.455905,0.85401,0.063944,0.070543,-0.005004,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.221515,0.470743,0.85401,0.063007,0.071021,-0.005004,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.191519,0.483723,0.85401,0.062043,0.071438,-0.005004,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.160768,0.494794,0.85401,0.061054,0.071794,-0.005004,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.129383,0.503912,0.85401,0.060045,0.072087,-0.005004,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.097487,0.511042,0.85401,0.05902,0.072316,-0.005004,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0.065205,0.516155,0.85401,0.057982,0.072481,-0.005004,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	0.032667,0.519231,0.85401,0.056936,0.07258,-0.005004,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	0,0.520257,0.85401,0.055885,0.072613,-0.005004,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	-0.032667,0.519231,0.85401,0.054835,0.07258,-0.005004,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.065205,0.516155,0.85401,0.053789,0.072481,-0.005004,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.097487,0.511042,0.85401,0.052751,0.072316,-0.005004,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.129383,0.503912,0.85401,0.051725,0.072087,-0.005004,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.160768,0.494794,0.85401,0.050716,0.071794,-0.005004,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.191519,0.483723,0.85401,0.049728,0.071438,-0.005004,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.221515,0.470743,0.85401,0.048763,0.071021,-0.005004,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.250636,0.455905,0.85401,0.047827,0.070543,-0.005004,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.278768,0.439268,0.85401,0.046922,0.070009,-0.005004,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.3058,0.420897,0.85401,0.046053,0.069418,-0.005004,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.331624,0.400865,0.85401,0.045223,0.068774,-0.005004,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.356141,0.379251,0.85401,0.044435,0.068079,-0.005004,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.379251,0.356141,0.85401,0.043692,0.067336,-0.005004,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.400865,0.331624,0.85401,0.042997,0.066548,-0.005004,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.420897,0.3058,0.85401,0.042353,0.065717,-0.005004,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.439268,0.278768,0.85401,0.041762,0.064848,-0.005004,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.455905,0.250636,0.85401,0.041227,0.063944,-0.005004,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.470743,0.221515,0.85401,0.04075,0.063007,-0.005004,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.483723,0.191519,0.85401,0.040333,0.062043,-0.005004,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.494794,0.160768,0.85401,0.039977,0.061054,-0.005004,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.511042,0.097487,0.85401,0.039454,0.05902,-0.005004,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.503912,0.129383,0.85401,0.039684,0.060045,-0.005004,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.407727,0.077778,0.909785,0.039587,0.058994,-0.004932,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.411806,0.052023,0.909785,0.039424,0.057965,-0.004932,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.41426,0.026063,0.909785,0.039326,0.056927,-0.004932,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.415079,0,0.909785,0.039294,0.055885,-0.004932,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.41426,-0.026063,0.909785,0.039326,0.054844,-0.004932,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.411806,-0.052023,0.909785,0.039424,0.053806,-0.004932,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.407727,-0.077778,0.909785,0.039587,0.052776,-0.004932,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.402039,-0.103226,0.909785,0.039815,0.051759,-0.004932,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.394764,-0.128267,0.909785,0.040106,0.050758,-0.004932,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.385931,-0.152801,0.909785,0.040459,0.049777,-0.004932,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.375575,-0.176732,0.909785,0.040873,0.048821,-0.004932,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.363737,-0.199966,0.909785,0.041346,0.047892,-0.004932,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.350463,-0.222411,0.909785,0.041876,0.046995,-0.004932,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.335806,-0.243978,0.909785,0.042462,0.046133,-0.004932,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.319824,-0.264582,0.909785,0.043101,0.045309,-0.004932,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.30258,-0.284141,0.909785,0.04379,0.044527,-0.004932,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.284141,-0.30258,0.909785,0.044527,0.04379,-0.004932,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.264582,-0.319824,0.909785,0.045309,0.043101,-0.004932,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.243978,-0.335806,0.909785,0.046133,0.042462,-0.004932,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.222411,-0.350463,0.909785,0.046995,0.041876,-0.004932,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.199966,-0.363737,0.909785,0.047892,0.041346,-0.004932,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.176732,-0.375575,0.909785,0.048821,0.040873,-0.004932,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.152801,-0.385931,0.909785,0.049777,0.040459,-0.004932,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.128267,-0.394764,0.909785,0.050758,0.040106,-0.004932,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.103226,-0.402039,0.909785,0.051759,0.039815,-0.004932,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.077778,-0.407727,0.909785,0.052776,0.039587,-0.004932,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	-0.052023,-0.411806,0.909785,0.053806,0.039424,-0.004932,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	-0.026063,-0.41426,0.909785,0.054844,0.039326,-0.004932,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	0,-0.415079,0.909785,0.055885,0.039294,-0.004932,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0.026063,-0.41426,0.909785,0.056927,0.039326,-0.004932,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.052023,-0.411806,0.909785,0.057965,0.039424,-0.004932,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.077778,-0.407727,0.909785,0.058994,0.039587,-0.004932,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.103226,-0.402039,0.909785,0.060012,0.039815,-0.004932,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.128267,-0.394764,0.909785,0.061012,0.040106,-0.004932,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.152801,-0.385931,0.909785,0.061993,0.040459,-0.004932,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.176732,-0.375575,0.909785,0.06295,0.040873,-0.004932,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.199966,-0.363737,0.909785,0.063878,0.041346,-0.004932,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.222411,-0.350463,0.909785,0.064776,0.041876,-0.004932,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.243978,-0.335806,0.909785,0.065638,0.042462,-0.004932,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.264582,-0.319824,0.909785,0.066461,0.043101,-0.004932,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.284141,-0.30258,0.909785,0.067243,0.04379,-0.004932,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.30258,-0.284141,0.909785,0.06798,0.044527,-0.004932,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.319824,-0.264582,0.909785,0.06867,0.045309,-0.004932,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.335806,-0.243978,0.909785,0.069308,0.046133,-0.004932,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.350463,-0.222411,0.909785,0.069894,0.046995,-0.004932,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.363737,-0.199966,0.909785,0.070425,0.047892,-0.004932,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.375575,-0.176732,0.909785,0.070898,0.048821,-0.004932,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.385931,-0.152801,0.909785,0.071312,0.049777,-0.004932,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.394764,-0.128267,0.909785,0.071665,0.050758,-0.004932,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.402039,-0.103226,0.909785,0.071956,0.051759,-0.004932,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.407727,-0.077778,0.909785,0.072183,0.052776,-0.004932,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.411806,-0.052023,0.909785,0.072346,0.053806,-0.004932,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.41426,-0.026063,0.909785,0.072444,0.054844,-0.004932,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.415079,0,0.909785,0.072477,0.055885,-0.004932,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.41426,0.026063,0.909785,0.072444,0.056927,-0.004932,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.411806,0.052023,0.909785,0.072346,0.057965,-0.004932,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.407727,0.077778,0.909785,0.072183,0.058994,-0.004932,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.402039,0.103226,0.909785,0.071956,0.060012,-0.004932,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.394764,0.128267,0.909785,0.071665,0.061012,-0.004932,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.385931,0.152801,0.909785,0.071312,0.061993,-0.004932,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.375575,0.176732,0.909785,0.070898,0.06295,-0.004932,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.363737,0.199966,0.909785,0.070425,0.063878,-0.004932,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.350463,0.222411,0.909785,0.069894,0.064776,-0.004932,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.335806,0.243978,0.909785,0.069308,0.065638,-0.004932,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.319824,0.264582,0.909785,0.06867,0.066461,-0.004932,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.30258,0.284141,0.909785,0.06798,0.067243,-0.004932,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.284141,0.30258,0.909785,0.067243,0.06798,-0.004932,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.264582,0.319824,0.909785,0.066461,0.06867,-0.004932,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.243978,0.335806,0.909785,0.065638,0.069308,-0.004932,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.222411,0.350463,0.909785,0.064776,0.069894,-0.004932,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.199966,0.363737,0.909785,0.063878,0.070425,-0.004932,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.176732,0.375575,0.909785,0.06295,0.070898,-0.004932,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.152801,0.385931,0.909785,0.061993,0.071312,-0.004932,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.128267,0.394764,0.909785,0.061012,0.071665,-0.004932,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.103226,0.402039,0.909785,0.060012,0.071956,-0.004932,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.077778,0.407727,0.909785,0.058994,0.072183,-0.004932,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0.052023,0.411806,0.909785,0.057965,0.072346,-0.004932,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	0.026063,0.41426,0.909785,0.056927,0.072444,-0.004932,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	0,0.415079,0.909785,0.055885,0.072477,-0.004932,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	-0.026063,0.41426,0.909785,0.054844,0.072444,-0.004932,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.052023,0.411806,0.909785,0.053806,0.072346,-0.004932,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.077778,0.407727,0.909785,0.052776,0.072183,-0.004932,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.103226,0.402039,0.909785,0.051759,0.071956,-0.004932,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.128267,0.394764,0.909785,0.050758,0.071665,-0.004932,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.152801,0.385931,0.909785,0.049777,0.071312,-0.004932,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.176732,0.375575,0.909785,0.048821,0.070898,-0.004932,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.199966,0.363737,0.909785,0.047892,0.070425,-0.004932,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.222411,0.350463,0.909785,0.046995,0.069894,-0.004932,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.243978,0.335806,0.909785,0.046133,0.069308,-0.004932,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.264582,0.319824,0.909785,0.045309,0.06867,-0.004932,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.284141,0.30258,0.909785,0.044527,0.06798,-0.004932,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.30258,0.284141,0.909785,0.04379,0.067243,-0.004932,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.319824,0.264582,0.909785,0.043101,0.066461,-0.004932,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.335806,0.243978,0.909785,0.042462,0.065638,-0.004932,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.350463,0.222411,0.909785,0.041876,0.064776,-0.004932,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.363737,0.199966,0.909785,0.041346,0.063878,-0.004932,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.375575,0.176732,0.909785,0.040873,0.06295,-0.004932,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.385931,0.152801,0.909785,0.040459,0.061993,-0.004932,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.402039,0.103226,0.909785,0.039815,0.060012,-0.004932,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.394764,0.128267,0.909785,0.040106,0.061012,-0.004932,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.294467,0.075606,0.952666,0.039953,0.059976,-0.004877,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.298634,0.056967,0.952666,0.039728,0.058967,-0.004877,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.301621,0.038104,0.952666,0.039566,0.057947,-0.004877,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.303419,0.019089,0.952666,0.039469,0.056918,-0.004877,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.304019,0,0.952666,0.039437,0.055885,-0.004877,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.303419,-0.019089,0.952666,0.039469,0.054852,-0.004877,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.301621,-0.038104,0.952666,0.039566,0.053824,-0.004877,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.298634,-0.056967,0.952666,0.039728,0.052803,-0.004877,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.294467,-0.075606,0.952666,0.039953,0.051795,-0.004877,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.289139,-0.093947,0.952666,0.040242,0.050802,-0.004877,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.282669,-0.111917,0.952666,0.040592,0.04983,-0.004877,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.275084,-0.129445,0.952666,0.041002,0.048882,-0.004877,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.266414,-0.146462,0.952666,0.041471,0.047961,-0.004877,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.256692,-0.162901,0.952666,0.041997,0.047072,-0.004877,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.245956,-0.178698,0.952666,0.042578,0.046217,-0.004877,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.23425,-0.193789,0.952666,0.043211,0.0454,-0.004877,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.22162,-0.208115,0.952666,0.043895,0.044625,-0.004877,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.208115,-0.22162,0.952666,0.044625,0.043895,-0.004877,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.193789,-0.23425,0.952666,0.0454,0.043211,-0.004877,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.178698,-0.245956,0.952666,0.046217,0.042578,-0.004877,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.162901,-0.256692,0.952666,0.047072,0.041997,-0.004877,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.146462,-0.266414,0.952666,0.047961,0.041471,-0.004877,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.129445,-0.275084,0.952666,0.048882,0.041002,-0.004877,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.111917,-0.282669,0.952666,0.04983,0.040592,-0.004877,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.093947,-0.289139,0.952666,0.050802,0.040242,-0.004877,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.075606,-0.294467,0.952666,0.051795,0.039953,-0.004877,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.056967,-0.298634,0.952666,0.052803,0.039728,-0.004877,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	-0.038104,-0.301621,0.952666,0.053824,0.039566,-0.004877,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	-0.019089,-0.303419,0.952666,0.054852,0.039469,-0.004877,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	0,-0.304019,0.952666,0.055885,0.039437,-0.004877,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0.019089,-0.303419,0.952666,0.056918,0.039469,-0.004877,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.038104,-0.301621,0.952666,0.057947,0.039566,-0.004877,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.056967,-0.298634,0.952666,0.058967,0.039728,-0.004877,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.075606,-0.294467,0.952666,0.059976,0.039953,-0.004877,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.093947,-0.289139,0.952666,0.060968,0.040242,-0.004877,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.111917,-0.282669,0.952666,0.061941,0.040592,-0.004877,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.129445,-0.275084,0.952666,0.062889,0.041002,-0.004877,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.146462,-0.266414,0.952666,0.063809,0.041471,-0.004877,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.162901,-0.256692,0.952666,0.064699,0.041997,-0.004877,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.178698,-0.245956,0.952666,0.065554,0.042578,-0.004877,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.193789,-0.23425,0.952666,0.06637,0.043211,-0.004877,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.208115,-0.22162,0.952666,0.067145,0.043895,-0.004877,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.22162,-0.208115,0.952666,0.067876,0.044625,-0.004877,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.23425,-0.193789,0.952666,0.068559,0.0454,-0.004877,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.245956,-0.178698,0.952666,0.069193,0.046217,-0.004877,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.256692,-0.162901,0.952666,0.069773,0.047072,-0.004877,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.266414,-0.146462,0.952666,0.070299,0.047961,-0.004877,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.275084,-0.129445,0.952666,0.070769,0.048882,-0.004877,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.282669,-0.111917,0.952666,0.071179,0.04983,-0.004877,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.289139,-0.093947,0.952666,0.071529,0.050802,-0.004877,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.294467,-0.075606,0.952666,0.071817,0.051795,-0.004877,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.298634,-0.056967,0.952666,0.072043,0.052803,-0.004877,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.301621,-0.038104,0.952666,0.072204,0.053824,-0.004877,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.303419,-0.019089,0.952666,0.072302,0.054852,-0.004877,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.304019,0,0.952666,0.072334,0.055885,-0.004877,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.303419,0.019089,0.952666,0.072302,0.056918,-0.004877,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.301621,0.038104,0.952666,0.072204,0.057947,-0.004877,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.298634,0.056967,0.952666,0.072043,0.058967,-0.004877,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.294467,0.075606,0.952666,0.071817,0.059976,-0.004877,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.289139,0.093947,0.952666,0.071529,0.060968,-0.004877,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.282669,0.111917,0.952666,0.071179,0.061941,-0.004877,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.275084,0.129445,0.952666,0.070769,0.062889,-0.004877,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.266414,0.146462,0.952666,0.070299,0.063809,-0.004877,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.256692,0.162901,0.952666,0.069773,0.064699,-0.004877,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.245956,0.178698,0.952666,0.069193,0.065554,-0.004877,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.23425,0.193789,0.952666,0.068559,0.06637,-0.004877,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.22162,0.208115,0.952666,0.067876,0.067145,-0.004877,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.208115,0.22162,0.952666,0.067145,0.067876,-0.004877,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.193789,0.23425,0.952666,0.06637,0.068559,-0.004877,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.178698,0.245956,0.952666,0.065554,0.069193,-0.004877,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.162901,0.256692,0.952666,0.064699,0.069773,-0.004877,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.146462,0.266414,0.952666,0.063809,0.070299,-0.004877,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.129445,0.275084,0.952666,0.062889,0.070769,-0.004877,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.111917,0.282669,0.952666,0.061941,0.071179,-0.004877,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.093947,0.289139,0.952666,0.060968,0.071529,-0.004877,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.075606,0.294467,0.952666,0.059976,0.071817,-0.004877,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.056967,0.298634,0.952666,0.058967,0.072043,-0.004877,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0.038104,0.301621,0.952666,0.057947,0.072204,-0.004877,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	0.019089,0.303419,0.952666,0.056918,0.072302,-0.004877,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	0,0.304019,0.952666,0.055885,0.072334,-0.004877,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	-0.019089,0.303419,0.952666,0.054852,0.072302,-0.004877,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.038104,0.301621,0.952666,0.053824,0.072204,-0.004877,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.056967,0.298634,0.952666,0.052803,0.072043,-0.004877,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.075606,0.294467,0.952666,0.051795,0.071817,-0.004877,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.093947,0.289139,0.952666,0.050802,0.071529,-0.004877,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.111917,0.282669,0.952666,0.04983,0.071179,-0.004877,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.129445,0.275084,0.952666,0.048882,0.070769,-0.004877,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.146462,0.266414,0.952666,0.047961,0.070299,-0.004877,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.162901,0.256692,0.952666,0.047072,0.069773,-0.004877,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.178698,0.245956,0.952666,0.046217,0.069193,-0.004877,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.193789,0.23425,0.952666,0.0454,0.068559,-0.004877,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.208115,0.22162,0.952666,0.044625,0.067876,-0.004877,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.22162,0.208115,0.952666,0.043895,0.067145,-0.004877,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.23425,0.193789,0.952666,0.043211,0.06637,-0.004877,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.245956,0.178698,0.952666,0.042578,0.065554,-0.004877,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.256692,0.162901,0.952666,0.041997,0.064699,-0.004877,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.266414,0.146462,0.952666,0.041471,0.063809,-0.004877,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.275084,0.129445,0.952666,0.041002,0.062889,-0.004877,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.289139,0.093947,0.952666,0.040242,0.060968,-0.004877,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.282669,0.111917,0.952666,0.040592,0.061941,-0.004877,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.179416,0.058296,0.982045,0.040383,0.060922,-0.004839,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.182722,0.046915,0.982045,0.040097,0.059939,-0.004839,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.185308,0.035349,0.982045,0.039874,0.05894,-0.004839,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.187162,0.023644,0.982045,0.039714,0.057928,-0.004839,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.188277,0.011845,0.982045,0.039617,0.056909,-0.004839,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.188649,0,0.982045,0.039585,0.055885,-0.004839,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.188277,-0.011845,0.982045,0.039617,0.054862,-0.004839,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.187162,-0.023644,0.982045,0.039714,0.053842,-0.004839,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.185308,-0.035349,0.982045,0.039874,0.052831,-0.004839,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.182722,-0.046915,0.982045,0.040097,0.051832,-0.004839,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.179416,-0.058296,0.982045,0.040383,0.050848,-0.004839,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.175402,-0.069446,0.982045,0.04073,0.049885,-0.004839,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.170695,-0.080323,0.982045,0.041136,0.048945,-0.004839,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.165314,-0.090882,0.982045,0.041601,0.048033,-0.004839,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.159282,-0.101083,0.982045,0.042123,0.047151,-0.004839,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.15262,-0.110885,0.982045,0.042698,0.046304,-0.004839,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.145357,-0.120249,0.982045,0.043326,0.045495,-0.004839,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.137519,-0.129139,0.982045,0.044003,0.044727,-0.004839,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.129139,-0.137519,0.982045,0.044727,0.044003,-0.004839,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.120249,-0.145357,0.982045,0.045495,0.043326,-0.004839,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.110885,-0.15262,0.982045,0.046304,0.042698,-0.004839,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.101083,-0.159282,0.982045,0.047151,0.042123,-0.004839,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.090882,-0.165314,0.982045,0.048033,0.041601,-0.004839,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.080323,-0.170695,0.982045,0.048945,0.041136,-0.004839,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.069446,-0.175402,0.982045,0.049885,0.04073,-0.004839,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.058296,-0.179416,0.982045,0.050848,0.040383,-0.004839,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.046915,-0.182722,0.982045,0.051832,0.040097,-0.004839,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.035349,-0.185308,0.982045,0.052831,0.039874,-0.004839,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	-0.023644,-0.187162,0.982045,0.053842,0.039714,-0.004839,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	-0.011845,-0.188277,0.982045,0.054862,0.039617,-0.004839,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	0,-0.188649,0.982045,0.055885,0.039585,-0.004839,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0.011845,-0.188277,0.982045,0.056909,0.039617,-0.004839,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.023644,-0.187162,0.982045,0.057928,0.039714,-0.004839,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.035349,-0.185308,0.982045,0.05894,0.039874,-0.004839,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.046915,-0.182722,0.982045,0.059939,0.040097,-0.004839,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.058296,-0.179416,0.982045,0.060922,0.040383,-0.004839,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.069446,-0.175402,0.982045,0.061886,0.04073,-0.004839,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.080323,-0.170695,0.982045,0.062825,0.041136,-0.004839,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.090882,-0.165314,0.982045,0.063738,0.041601,-0.004839,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.101083,-0.159282,0.982045,0.064619,0.042123,-0.004839,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.110885,-0.15262,0.982045,0.065466,0.042698,-0.004839,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.120249,-0.145357,0.982045,0.066275,0.043326,-0.004839,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.129139,-0.137519,0.982045,0.067043,0.044003,-0.004839,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.137519,-0.129139,0.982045,0.067768,0.044727,-0.004839,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.145357,-0.120249,0.982045,0.068445,0.045495,-0.004839,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.15262,-0.110885,0.982045,0.069072,0.046304,-0.004839,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.159282,-0.101083,0.982045,0.069648,0.047151,-0.004839,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.165314,-0.090882,0.982045,0.070169,0.048033,-0.004839,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.170695,-0.080323,0.982045,0.070634,0.048945,-0.004839,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.175402,-0.069446,0.982045,0.071041,0.049885,-0.004839,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.179416,-0.058296,0.982045,0.071388,0.050848,-0.004839,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.182722,-0.046915,0.982045,0.071673,0.051832,-0.004839,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.185308,-0.035349,0.982045,0.071897,0.052831,-0.004839,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.187162,-0.023644,0.982045,0.072057,0.053842,-0.004839,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.188277,-0.011845,0.982045,0.072153,0.054862,-0.004839,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.188649,0,0.982045,0.072186,0.055885,-0.004839,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.188277,0.011845,0.982045,0.072153,0.056909,-0.004839,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.187162,0.023644,0.982045,0.072057,0.057928,-0.004839,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.185308,0.035349,0.982045,0.071897,0.05894,-0.004839,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.182722,0.046915,0.982045,0.071673,0.059939,-0.004839,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.179416,0.058296,0.982045,0.071388,0.060922,-0.004839,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.175402,0.069446,0.982045,0.071041,0.061886,-0.004839,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.170695,0.080323,0.982045,0.070634,0.062825,-0.004839,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.165314,0.090882,0.982045,0.070169,0.063738,-0.004839,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.159282,0.101083,0.982045,0.069648,0.064619,-0.004839,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.15262,0.110885,0.982045,0.069072,0.065466,-0.004839,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.145357,0.120249,0.982045,0.068445,0.066275,-0.004839,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.137519,0.129139,0.982045,0.067768,0.067043,-0.004839,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.129139,0.137519,0.982045,0.067043,0.067768,-0.004839,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.120249,0.145357,0.982045,0.066275,0.068445,-0.004839,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.110885,0.15262,0.982045,0.065466,0.069072,-0.004839,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.101083,0.159282,0.982045,0.064619,0.069648,-0.004839,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.090882,0.165314,0.982045,0.063738,0.070169,-0.004839,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.080323,0.170695,0.982045,0.062825,0.070634,-0.004839,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.069446,0.175402,0.982045,0.061886,0.071041,-0.004839,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.058296,0.179416,0.982045,0.060922,0.071388,-0.004839,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.046915,0.182722,0.982045,0.059939,0.071673,-0.004839,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.035349,0.185308,0.982045,0.05894,0.071897,-0.004839,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0.023644,0.187162,0.982045,0.057928,0.072057,-0.004839,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	0.011845,0.188277,0.982045,0.056909,0.072153,-0.004839,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	0,0.188649,0.982045,0.055885,0.072186,-0.004839,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	-0.011845,0.188277,0.982045,0.054862,0.072153,-0.004839,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.023644,0.187162,0.982045,0.053842,0.072057,-0.004839,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.035349,0.185308,0.982045,0.052831,0.071897,-0.004839,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.046915,0.182722,0.982045,0.051832,0.071673,-0.004839,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.058296,0.179416,0.982045,0.050848,0.071388,-0.004839,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.069446,0.175402,0.982045,0.049885,0.071041,-0.004839,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.080323,0.170695,0.982045,0.048945,0.070634,-0.004839,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.090882,0.165314,0.982045,0.048033,0.070169,-0.004839,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.101083,0.159282,0.982045,0.047151,0.069648,-0.004839,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.110885,0.15262,0.982045,0.046304,0.069072,-0.004839,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.120249,0.145357,0.982045,0.045495,0.068445,-0.004839,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.129139,0.137519,0.982045,0.044727,0.067768,-0.004839,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.137519,0.129139,0.982045,0.044003,0.067043,-0.004839,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.145357,0.120249,0.982045,0.043326,0.066275,-0.004839,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.15262,0.110885,0.982045,0.042698,0.065466,-0.004839,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.159282,0.101083,0.982045,0.042123,0.064619,-0.004839,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.165314,0.090882,0.982045,0.041601,0.063738,-0.004839,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.175402,0.069446,0.982045,0.04073,0.061886,-0.004839,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.170695,0.080323,0.982045,0.041136,0.062825,-0.004839,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.00704,0.002287,0.999973,0.040673,0.060828,-0.004818,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	-0.065648,0.025992,0.997504,0.040871,0.06183,-0.004819,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	-0.00704,0.002287,0.999973,0.040673,0.060828,-0.004818,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.00704,0.002287,0.999973,0.040673,0.060828,-0.004818,
-	-0.06715,0.021818,0.997504,0.040528,0.060875,-0.004819,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	-0.068388,0.017559,0.997504,0.040245,0.059901,-0.004819,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	-0.069355,0.01323,0.997504,0.040023,0.058911,-0.004819,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	-0.070049,0.008849,0.997504,0.039865,0.057909,-0.004819,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	-0.070467,0.004433,0.997504,0.039769,0.056899,-0.004819,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	-0.070606,0,0.997504,0.039737,0.055885,-0.004819,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	-0.070467,-0.004433,0.997504,0.039769,0.054871,-0.004819,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	-0.070049,-0.008849,0.997504,0.039865,0.053861,-0.004819,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	-0.069355,-0.01323,0.997504,0.040023,0.052859,-0.004819,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	-0.068388,-0.017559,0.997504,0.040245,0.051869,-0.004819,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	-0.06715,-0.021818,0.997504,0.040528,0.050895,-0.004819,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	-0.065648,-0.025992,0.997504,0.040871,0.049941,-0.004819,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	-0.063886,-0.030062,0.997504,0.041274,0.04901,-0.004819,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	-0.061872,-0.034015,0.997504,0.041735,0.048106,-0.004819,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	-0.059614,-0.037832,0.997504,0.042251,0.047233,-0.004819,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	-0.057121,-0.041501,0.997504,0.042821,0.046394,-0.004819,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	-0.054403,-0.045006,0.997504,0.043443,0.045592,-0.004819,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	-0.051469,-0.048333,0.997504,0.044114,0.044831,-0.004819,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	-0.048333,-0.051469,0.997504,0.044831,0.044114,-0.004819,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	-0.045006,-0.054403,0.997504,0.045592,0.043443,-0.004819,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	-0.041501,-0.057121,0.997504,0.046394,0.042821,-0.004819,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	-0.037832,-0.059614,0.997504,0.047233,0.042251,-0.004819,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	-0.034015,-0.061872,0.997504,0.048106,0.041735,-0.004819,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	-0.030062,-0.063886,0.997504,0.04901,0.041274,-0.004819,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	-0.025992,-0.065648,0.997504,0.049941,0.040871,-0.004819,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	-0.021818,-0.06715,0.997504,0.050895,0.040528,-0.004819,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	-0.017559,-0.068388,0.997504,0.051869,0.040245,-0.004819,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	-0.01323,-0.069355,0.997504,0.052859,0.040023,-0.004819,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	-0.000465,-0.007388,0.999973,0.054881,0.039922,-0.004818,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	-0.008849,-0.070049,0.997504,0.053861,0.039865,-0.004819,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	0,-0.007402,0.999973,0.055885,0.039891,-0.004818,
-	-0.000465,-0.007388,0.999973,0.054881,0.039922,-0.004818,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	-0.000465,-0.007388,0.999973,0.054881,0.039922,-0.004818,
-	-0.004433,-0.070467,0.997504,0.054871,0.039769,-0.004819,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	0,-0.007402,0.999973,0.055885,0.039891,-0.004818,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0,-0.007402,0.999973,0.055885,0.039891,-0.004818,
-	0,-0.070606,0.997504,0.055885,0.039737,-0.004819,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	0.004433,-0.070467,0.997504,0.056899,0.039769,-0.004819,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	0.008849,-0.070049,0.997504,0.057909,0.039865,-0.004819,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	0.01323,-0.069355,0.997504,0.058911,0.040023,-0.004819,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	0.017559,-0.068388,0.997504,0.059901,0.040245,-0.004819,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	0.021818,-0.06715,0.997504,0.060875,0.040528,-0.004819,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	0.025992,-0.065648,0.997504,0.06183,0.040871,-0.004819,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	0.030062,-0.063886,0.997504,0.062761,0.041274,-0.004819,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	0.034015,-0.061872,0.997504,0.063665,0.041735,-0.004819,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	0.037832,-0.059614,0.997504,0.064538,0.042251,-0.004819,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	0.041501,-0.057121,0.997504,0.065377,0.042821,-0.004819,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0.045006,-0.054403,0.997504,0.066178,0.043443,-0.004819,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0.048333,-0.051469,0.997504,0.066939,0.044114,-0.004819,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0.051469,-0.048333,0.997504,0.067657,0.044831,-0.004819,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0.054403,-0.045006,0.997504,0.068328,0.045592,-0.004819,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0.057121,-0.041501,0.997504,0.068949,0.046394,-0.004819,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0.059614,-0.037832,0.997504,0.06952,0.047233,-0.004819,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0.061872,-0.034015,0.997504,0.070036,0.048106,-0.004819,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0.063886,-0.030062,0.997504,0.070497,0.04901,-0.004819,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0.065648,-0.025992,0.997504,0.070899,0.049941,-0.004819,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0.06715,-0.021818,0.997504,0.071243,0.050895,-0.004819,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0.068388,-0.017559,0.997504,0.071526,0.051869,-0.004819,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0.069355,-0.01323,0.997504,0.071747,0.052859,-0.004819,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0.070049,-0.008849,0.997504,0.071906,0.053861,-0.004819,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0.070467,-0.004433,0.997504,0.072001,0.054871,-0.004819,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0.070606,0,0.997504,0.072033,0.055885,-0.004819,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0.070467,0.004433,0.997504,0.072001,0.056899,-0.004819,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0.070049,0.008849,0.997504,0.071906,0.057909,-0.004819,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0.069355,0.01323,0.997504,0.071747,0.058911,-0.004819,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.00704,0.002287,0.999973,0.071097,0.060828,-0.004818,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0.068388,0.017559,0.997504,0.071526,0.059901,-0.004819,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0.00704,0.002287,0.999973,0.071097,0.060828,-0.004818,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.00704,0.002287,0.999973,0.071097,0.060828,-0.004818,
-	0.06715,0.021818,0.997504,0.071243,0.060875,-0.004819,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0.065648,0.025992,0.997504,0.070899,0.06183,-0.004819,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.006487,0.003566,0.999973,0.069902,0.063591,-0.004818,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0.063886,0.030062,0.997504,0.070497,0.062761,-0.004819,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0.006487,0.003566,0.999973,0.069902,0.063591,-0.004818,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.006487,0.003566,0.999973,0.069902,0.063591,-0.004818,
-	0.061872,0.034015,0.997504,0.070036,0.063665,-0.004819,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0.059614,0.037832,0.997504,0.06952,0.064538,-0.004819,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0.057121,0.041501,0.997504,0.068949,0.065377,-0.004819,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0.054403,0.045006,0.997504,0.068328,0.066178,-0.004819,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0.051469,0.048333,0.997504,0.067657,0.066939,-0.004819,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	0.048333,0.051469,0.997504,0.066939,0.067657,-0.004819,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	0.045006,0.054403,0.997504,0.066178,0.068328,-0.004819,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	0.041501,0.057121,0.997504,0.065377,0.068949,-0.004819,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.003566,0.006487,0.999973,0.063591,0.069902,-0.004818,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	0.037832,0.059614,0.997504,0.064538,0.06952,-0.004819,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	0.003566,0.006487,0.999973,0.063591,0.069902,-0.004818,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.003566,0.006487,0.999973,0.063591,0.069902,-0.004818,
-	0.034015,0.061872,0.997504,0.063665,0.070036,-0.004819,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	0.030062,0.063886,0.997504,0.062761,0.070497,-0.004819,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	0.025992,0.065648,0.997504,0.06183,0.070899,-0.004819,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.001841,0.00717,0.999973,0.059863,0.071377,-0.004818,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	0.021818,0.06715,0.997504,0.060875,0.071243,-0.004819,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	0.001841,0.00717,0.999973,0.059863,0.071377,-0.004818,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.001841,0.00717,0.999973,0.059863,0.071377,-0.004818,
-	0.017559,0.068388,0.997504,0.059901,0.071526,-0.004819,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	0.01323,0.069355,0.997504,0.058911,0.071747,-0.004819,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	0.000465,0.007388,0.999973,0.05689,0.071848,-0.004818,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	0.008849,0.070049,0.997504,0.057909,0.071906,-0.004819,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	0,0.007402,0.999973,0.055885,0.07188,-0.004818,
-	0.000465,0.007388,0.999973,0.05689,0.071848,-0.004818,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	0.000465,0.007388,0.999973,0.05689,0.071848,-0.004818,
-	0.004433,0.070467,0.997504,0.056899,0.072001,-0.004819,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	0,0.007402,0.999973,0.055885,0.07188,-0.004818,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	0,0.007402,0.999973,0.055885,0.07188,-0.004818,
-	0,0.070606,0.997504,0.055885,0.072033,-0.004819,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	-0.004433,0.070467,0.997504,0.054871,0.072001,-0.004819,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.001387,0.007271,0.999973,0.052888,0.071597,-0.004818,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	-0.008849,0.070049,0.997504,0.053861,0.071906,-0.004819,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	-0.001387,0.007271,0.999973,0.052888,0.071597,-0.004818,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.001387,0.007271,0.999973,0.052888,0.071597,-0.004818,
-	-0.01323,0.069355,0.997504,0.052859,0.071747,-0.004819,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	-0.017559,0.068388,0.997504,0.051869,0.071526,-0.004819,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	-0.021818,0.06715,0.997504,0.050895,0.071243,-0.004819,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.003152,0.006698,0.999973,0.049075,0.070358,-0.004818,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	-0.025992,0.065648,0.997504,0.049941,0.070899,-0.004819,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	-0.003152,0.006698,0.999973,0.049075,0.070358,-0.004818,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.003152,0.006698,0.999973,0.049075,0.070358,-0.004818,
-	-0.030062,0.063886,0.997504,0.04901,0.070497,-0.004819,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	-0.034015,0.061872,0.997504,0.048106,0.070036,-0.004819,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	-0.037832,0.059614,0.997504,0.047233,0.06952,-0.004819,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	-0.041501,0.057121,0.997504,0.046394,0.068949,-0.004819,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	-0.045006,0.054403,0.997504,0.045592,0.068328,-0.004819,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	-0.048333,0.051469,0.997504,0.044831,0.067657,-0.004819,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	-0.051469,0.048333,0.997504,0.044114,0.066939,-0.004819,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	-0.054403,0.045006,0.997504,0.043443,0.066178,-0.004819,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	-0.057121,0.041501,0.997504,0.042821,0.065377,-0.004819,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.006487,0.003566,0.999973,0.041869,0.063591,-0.004818,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	-0.059614,0.037832,0.997504,0.042251,0.064538,-0.004819,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	-0.006487,0.003566,0.999973,0.041869,0.063591,-0.004818,
-	-0.063886,0.030062,0.997504,0.041274,0.062761,-0.004819,
-	-0.006487,0.003566,0.999973,0.041869,0.063591,-0.004818,
-	-0.061872,0.034015,0.997504,0.041735,0.063665,-0.004819,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	0,0,1,0.044613,0.063997,-0.004818,
-	-0.006487,0.003566,0.999973,0.041869,0.063591,-0.004818,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	0,0,1,0.043898,0.062655,-0.004818,
-	0,0,1,0.044613,0.063997,-0.004818,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	0,0,1,0.043898,0.062655,-0.004818,
-	-0.006698,0.003152,0.999973,0.041413,0.062696,-0.004818,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	0,0,1,0.043489,0.061186,-0.004818,
-	0,0,1,0.043898,0.062655,-0.004818,
-	-0.00704,0.002287,0.999973,0.040673,0.060828,-0.004818,
-	0,0,1,0.043489,0.061186,-0.004818,
-	-0.006883,0.002725,0.999973,0.041014,0.061773,-0.004818,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	0,0,1,0.043489,0.061186,-0.004818,
-	-0.00704,0.002287,0.999973,0.040673,0.060828,-0.004818,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	0,0,1,0.043409,0.05966,-0.004818,
-	0,0,1,0.043489,0.061186,-0.004818,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	0,0,1,0.043409,0.05966,-0.004818,
-	-0.00717,0.001841,0.999973,0.040393,0.059863,-0.004818,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	0,0,1,0.043472,0.058741,-0.004818,
-	0,0,1,0.043409,0.05966,-0.004818,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	0,0,1,0.043472,0.058741,-0.004818,
-	-0.007271,0.001387,0.999973,0.040174,0.058882,-0.004818,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	0,0,1,0.04361,0.057831,-0.004818,
-	0,0,1,0.043472,0.058741,-0.004818,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	0,0,1,0.043821,0.056936,-0.004818,
-	0,0,1,0.04361,0.057831,-0.004818,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	0,0,1,0.043821,0.056936,-0.004818,
-	-0.007344,0.000928,0.999973,0.040017,0.05789,-0.004818,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	0,0,1,0.044105,0.056061,-0.004818,
-	0,0,1,0.043821,0.056936,-0.004818,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	0,0,1,0.044105,0.056061,-0.004818,
-	-0.007388,0.000465,0.999973,0.039922,0.05689,-0.004818,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	0,0,1,0.044458,0.055214,-0.004818,
-	0,0,1,0.044105,0.056061,-0.004818,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	0,0,1,0.044458,0.055214,-0.004818,
-	-0.007402,0,0.999973,0.039891,0.055885,-0.004818,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	0,0,1,0.044879,0.054399,-0.004818,
-	0,0,1,0.044458,0.055214,-0.004818,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	0,0,1,0.044879,0.054399,-0.004818,
-	-0.007388,-0.000465,0.999973,0.039922,0.054881,-0.004818,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	0,0,1,0.045365,0.053623,-0.004818,
-	0,0,1,0.044879,0.054399,-0.004818,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	0,0,1,0.045912,0.05289,-0.004818,
-	0,0,1,0.045365,0.053623,-0.004818,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	0,0,1,0.045912,0.05289,-0.004818,
-	-0.007344,-0.000928,0.999973,0.040017,0.053881,-0.004818,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	0,0,1,0.046517,0.052206,-0.004818,
-	0,0,1,0.045912,0.05289,-0.004818,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	0,0,1,0.046517,0.052206,-0.004818,
-	-0.007271,-0.001387,0.999973,0.040174,0.052888,-0.004818,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	0,0,1,0.047175,0.051576,-0.004818,
-	0,0,1,0.046517,0.052206,-0.004818,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	0,0,1,0.047882,0.051003,-0.004818,
-	0,0,1,0.047175,0.051576,-0.004818,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	0,0,1,0.047882,0.051003,-0.004818,
-	-0.00717,-0.001841,0.999973,0.040393,0.051908,-0.004818,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	0,0,1,0.048634,0.050493,-0.004818,
-	0,0,1,0.047882,0.051003,-0.004818,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	0,0,1,0.049354,0.050026,-0.004818,
-	0,0,1,0.048634,0.050493,-0.004818,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	0,0,1,0.049354,0.050026,-0.004818,
-	-0.00704,-0.002287,0.999973,0.040673,0.050943,-0.004818,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	0,0,1,0.050057,0.049532,-0.004818,
-	0,0,1,0.049354,0.050026,-0.004818,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	0,0,1,0.050057,0.049532,-0.004818,
-	-0.006883,-0.002725,0.999973,0.041014,0.049997,-0.004818,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	0,0,1,0.050741,0.049011,-0.004818,
-	0,0,1,0.050057,0.049532,-0.004818,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	0,0,1,0.051404,0.048464,-0.004818,
-	0,0,1,0.050741,0.049011,-0.004818,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	0,0,1,0.051404,0.048464,-0.004818,
-	-0.006698,-0.003152,0.999973,0.041413,0.049075,-0.004818,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	0,0,1,0.052047,0.047891,-0.004818,
-	0,0,1,0.051404,0.048464,-0.004818,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	0,0,1,0.052047,0.047891,-0.004818,
-	-0.006487,-0.003566,0.999973,0.041869,0.04818,-0.004818,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	0,0,1,0.052668,0.047293,-0.004818,
-	0,0,1,0.052047,0.047891,-0.004818,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	0,0,1,0.053266,0.046673,-0.004818,
-	0,0,1,0.052668,0.047293,-0.004818,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	0,0,1,0.053266,0.046673,-0.004818,
-	-0.00625,-0.003966,0.999973,0.042381,0.047315,-0.004818,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	0,0,1,0.05384,0.046029,-0.004818,
-	0,0,1,0.053266,0.046673,-0.004818,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	0,0,1,0.05384,0.046029,-0.004818,
-	-0.005989,-0.004351,0.999973,0.042945,0.046484,-0.004818,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	0,0,1,0.05439,0.045363,-0.004818,
-	0,0,1,0.05384,0.046029,-0.004818,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	0,0,1,0.05439,0.045363,-0.004818,
-	-0.005704,-0.004718,0.999973,0.043561,0.04569,-0.004818,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	0,0,1,0.054915,0.044676,-0.004818,
-	0,0,1,0.05439,0.045363,-0.004818,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	0,0,1,0.054915,0.044676,-0.004818,
-	-0.005396,-0.005067,0.999973,0.044226,0.044936,-0.004818,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	0,0,1,0.055414,0.04397,-0.004818,
-	0,0,1,0.054915,0.044676,-0.004818,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	0,0,1,0.055414,0.04397,-0.004818,
-	-0.005067,-0.005396,0.999973,0.044936,0.044226,-0.004818,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	0,0,1,0.055885,0.043244,-0.004818,
-	0,0,1,0.055414,0.04397,-0.004818,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	0,0,1,0.055885,0.043244,-0.004818,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	-0.004718,-0.005704,0.999973,0.04569,0.043561,-0.004818,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	-0.004351,-0.005989,0.999973,0.046484,0.042945,-0.004818,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	0.003966,-0.00625,0.999973,0.064456,0.042381,-0.004818,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	-0.003966,-0.00625,0.999973,0.047315,0.042381,-0.004818,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	0.003566,-0.006487,0.999973,0.063591,0.041869,-0.004818,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	-0.003566,-0.006487,0.999973,0.04818,0.041869,-0.004818,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	0.003152,-0.006698,0.999973,0.062696,0.041413,-0.004818,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	-0.003152,-0.006698,0.999973,0.049075,0.041413,-0.004818,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	0.002725,-0.006883,0.999973,0.061773,0.041014,-0.004818,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	-0.002725,-0.006883,0.999973,0.049997,0.041014,-0.004818,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	0.002287,-0.00704,0.999973,0.060828,0.040673,-0.004818,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	-0.002287,-0.00704,0.999973,0.050943,0.040673,-0.004818,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	0.001841,-0.00717,0.999973,0.059863,0.040393,-0.004818,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	-0.001841,-0.00717,0.999973,0.051908,0.040393,-0.004818,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	0.001387,-0.007271,0.999973,0.058882,0.040174,-0.004818,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	-0.001387,-0.007271,0.999973,0.052888,0.040174,-0.004818,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	0.000928,-0.007344,0.999973,0.05789,0.040017,-0.004818,
-	-0.000465,-0.007388,0.999973,0.054881,0.039922,-0.004818,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	-0.000928,-0.007344,0.999973,0.053881,0.040017,-0.004818,
-	0.000465,-0.007388,0.999973,0.05689,0.039922,-0.004818,
-	-0.000465,-0.007388,0.999973,0.054881,0.039922,-0.004818,
-	0,-0.007402,0.999973,0.055885,0.039891,-0.004818,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0,0,1,0.055885,0.043244,-0.004818,
-	0.004351,-0.005989,0.999973,0.065287,0.042945,-0.004818,
-	0,0,1,0.055885,0.043244,-0.004818,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0,0,1,0.056357,0.04397,-0.004818,
-	0,0,1,0.056357,0.04397,-0.004818,
-	0.004718,-0.005704,0.999973,0.066081,0.043561,-0.004818,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0,0,1,0.056357,0.04397,-0.004818,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0,0,1,0.056856,0.044676,-0.004818,
-	0,0,1,0.056856,0.044676,-0.004818,
-	0.005067,-0.005396,0.999973,0.066834,0.044226,-0.004818,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0,0,1,0.056856,0.044676,-0.004818,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0,0,1,0.05738,0.045363,-0.004818,
-	0,0,1,0.05738,0.045363,-0.004818,
-	0.005396,-0.005067,0.999973,0.067545,0.044936,-0.004818,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0,0,1,0.05738,0.045363,-0.004818,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0,0,1,0.05793,0.046029,-0.004818,
-	0,0,1,0.05793,0.046029,-0.004818,
-	0.005704,-0.004718,0.999973,0.06821,0.04569,-0.004818,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0,0,1,0.05793,0.046029,-0.004818,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0,0,1,0.058505,0.046673,-0.004818,
-	0,0,1,0.058505,0.046673,-0.004818,
-	0.005989,-0.004351,0.999973,0.068825,0.046484,-0.004818,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0,0,1,0.058505,0.046673,-0.004818,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0,0,1,0.059103,0.047293,-0.004818,
-	0,0,1,0.059103,0.047293,-0.004818,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0,0,1,0.059724,0.047891,-0.004818,
-	0,0,1,0.059724,0.047891,-0.004818,
-	0.00625,-0.003966,0.999973,0.06939,0.047315,-0.004818,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0,0,1,0.059724,0.047891,-0.004818,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0,0,1,0.060366,0.048464,-0.004818,
-	0,0,1,0.060366,0.048464,-0.004818,
-	0.006487,-0.003566,0.999973,0.069902,0.04818,-0.004818,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0,0,1,0.060366,0.048464,-0.004818,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0,0,1,0.06103,0.049011,-0.004818,
-	0,0,1,0.06103,0.049011,-0.004818,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0,0,1,0.061714,0.049532,-0.004818,
-	0,0,1,0.061714,0.049532,-0.004818,
-	0.006698,-0.003152,0.999973,0.070358,0.049075,-0.004818,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0,0,1,0.061714,0.049532,-0.004818,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0,0,1,0.062416,0.050026,-0.004818,
-	0,0,1,0.062416,0.050026,-0.004818,
-	0.006883,-0.002725,0.999973,0.070757,0.049997,-0.004818,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0,0,1,0.062416,0.050026,-0.004818,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0,0,1,0.063137,0.050493,-0.004818,
-	0,0,1,0.063137,0.050493,-0.004818,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0,0,1,0.063888,0.051003,-0.004818,
-	0,0,1,0.063888,0.051003,-0.004818,
-	0.00704,-0.002287,0.999973,0.071097,0.050943,-0.004818,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0,0,1,0.063888,0.051003,-0.004818,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0,0,1,0.064596,0.051576,-0.004818,
-	0,0,1,0.064596,0.051576,-0.004818,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0,0,1,0.065254,0.052206,-0.004818,
-	0,0,1,0.065254,0.052206,-0.004818,
-	0.00717,-0.001841,0.999973,0.071377,0.051908,-0.004818,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0,0,1,0.065254,0.052206,-0.004818,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0,0,1,0.065859,0.05289,-0.004818,
-	0,0,1,0.065859,0.05289,-0.004818,
-	0.007271,-0.001387,0.999973,0.071597,0.052888,-0.004818,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0,0,1,0.065859,0.05289,-0.004818,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0,0,1,0.066406,0.053623,-0.004818,
-	0,0,1,0.066406,0.053623,-0.004818,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0,0,1,0.066892,0.054399,-0.004818,
-	0,0,1,0.066892,0.054399,-0.004818,
-	0.007344,-0.000928,0.999973,0.071754,0.053881,-0.004818,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0,0,1,0.066892,0.054399,-0.004818,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0,0,1,0.067313,0.055214,-0.004818,
-	0,0,1,0.067313,0.055214,-0.004818,
-	0.007388,-0.000465,0.999973,0.071848,0.054881,-0.004818,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0,0,1,0.067313,0.055214,-0.004818,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0,0,1,0.067666,0.056061,-0.004818,
-	0,0,1,0.067666,0.056061,-0.004818,
-	0.007402,0,0.999973,0.07188,0.055885,-0.004818,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0,0,1,0.067666,0.056061,-0.004818,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0,0,1,0.067949,0.056936,-0.004818,
-	0,0,1,0.067949,0.056936,-0.004818,
-	0.007388,0.000465,0.999973,0.071848,0.05689,-0.004818,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0,0,1,0.067949,0.056936,-0.004818,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0,0,1,0.068161,0.057831,-0.004818,
-	0,0,1,0.068161,0.057831,-0.004818,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0,0,1,0.068298,0.058741,-0.004818,
-	0,0,1,0.068298,0.058741,-0.004818,
-	0.007344,0.000928,0.999973,0.071754,0.05789,-0.004818,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0,0,1,0.068298,0.058741,-0.004818,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0,0,1,0.068362,0.05966,-0.004818,
-	0,0,1,0.068362,0.05966,-0.004818,
-	0.007271,0.001387,0.999973,0.071597,0.058882,-0.004818,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0,0,1,0.068362,0.05966,-0.004818,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0,0,1,0.068281,0.061186,-0.004818,
-	0,0,1,0.068281,0.061186,-0.004818,
-	0.00717,0.001841,0.999973,0.071377,0.059863,-0.004818,
-	0.00704,0.002287,0.999973,0.071097,0.060828,-0.004818,
-	0,0,1,0.068281,0.061186,-0.004818,
-	0.00704,0.002287,0.999973,0.071097,0.060828,-0.004818,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0,0,1,0.068281,0.061186,-0.004818,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0,0,1,0.067873,0.062655,-0.004818,
-	0,0,1,0.067873,0.062655,-0.004818,
-	0.006883,0.002725,0.999973,0.070757,0.061773,-0.004818,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0,0,1,0.067873,0.062655,-0.004818,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0,0,1,0.067158,0.063997,-0.004818,
-	0,0,1,0.067158,0.063997,-0.004818,
-	0.006698,0.003152,0.999973,0.070358,0.062696,-0.004818,
-	0.006487,0.003566,0.999973,0.069902,0.063591,-0.004818,
-	0,0,1,0.067158,0.063997,-0.004818,
-	0.006487,0.003566,0.999973,0.069902,0.063591,-0.004818,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0,0,1,0.067158,0.063997,-0.004818,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0,0,1,0.06617,0.065145,-0.004818,
-	0,0,1,0.06617,0.065145,-0.004818,
-	0.00625,0.003966,0.999973,0.06939,0.064456,-0.004818,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0,0,1,0.06617,0.065145,-0.004818,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0,0,1,0.064959,0.066043,-0.004818,
-	0,0,1,0.064959,0.066043,-0.004818,
-	0.005989,0.004351,0.999973,0.068825,0.065287,-0.004818,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0,0,1,0.064959,0.066043,-0.004818,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0,0,1,0.063583,0.066646,-0.004818,
-	0,0,1,0.063583,0.066646,-0.004818,
-	0.005704,0.004718,0.999973,0.06821,0.066081,-0.004818,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0,0,1,0.063583,0.066646,-0.004818,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0,0,1,0.06211,0.066926,-0.004818,
-	0,0,1,0.06211,0.066926,-0.004818,
-	0.005396,0.005067,0.999973,0.067545,0.066834,-0.004818,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	0,0,1,0.06211,0.066926,-0.004818,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	0.005067,0.005396,0.999973,0.066834,0.067545,-0.004818,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	-0.004718,0.005704,0.999973,0.04569,0.06821,-0.004818,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	0.004718,0.005704,0.999973,0.066081,0.06821,-0.004818,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	-0.004351,0.005989,0.999973,0.046484,0.068825,-0.004818,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	0.004351,0.005989,0.999973,0.065287,0.068825,-0.004818,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	-0.003966,0.00625,0.999973,0.047315,0.06939,-0.004818,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	0.003966,0.00625,0.999973,0.064456,0.06939,-0.004818,
-	0.003566,0.006487,0.999973,0.063591,0.069902,-0.004818,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	0.003566,0.006487,0.999973,0.063591,0.069902,-0.004818,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	-0.003566,0.006487,0.999973,0.04818,0.069902,-0.004818,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	-0.003152,0.006698,0.999973,0.049075,0.070358,-0.004818,
-	-0.003152,0.006698,0.999973,0.049075,0.070358,-0.004818,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	0.003152,0.006698,0.999973,0.062696,0.070358,-0.004818,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	-0.002725,0.006883,0.999973,0.049997,0.070757,-0.004818,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	0.002725,0.006883,0.999973,0.061773,0.070757,-0.004818,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	-0.002287,0.00704,0.999973,0.050943,0.071097,-0.004818,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	0.002287,0.00704,0.999973,0.060828,0.071097,-0.004818,
-	0.001841,0.00717,0.999973,0.059863,0.071377,-0.004818,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	0.001841,0.00717,0.999973,0.059863,0.071377,-0.004818,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	-0.001841,0.00717,0.999973,0.051908,0.071377,-0.004818,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	-0.001387,0.007271,0.999973,0.052888,0.071597,-0.004818,
-	-0.001387,0.007271,0.999973,0.052888,0.071597,-0.004818,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	0.001387,0.007271,0.999973,0.058882,0.071597,-0.004818,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	-0.000928,0.007344,0.999973,0.053881,0.071754,-0.004818,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	0.000928,0.007344,0.999973,0.05789,0.071754,-0.004818,
-	0.000465,0.007388,0.999973,0.05689,0.071848,-0.004818,
-	-0.000465,0.007388,0.999973,0.054881,0.071848,-0.004818,
-	0.000465,0.007388,0.999973,0.05689,0.071848,-0.004818,
-	0,0.007402,0.999973,0.055885,0.07188,-0.004818,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	0,0,1,0.04966,0.066926,-0.004818,
-	0,0,1,0.06211,0.066926,-0.004818,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	0,0,1,0.04966,0.066926,-0.004818,
-	-0.005067,0.005396,0.999973,0.044936,0.067545,-0.004818,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	0,0,1,0.048188,0.066646,-0.004818,
-	0,0,1,0.04966,0.066926,-0.004818,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	0,0,1,0.048188,0.066646,-0.004818,
-	-0.005396,0.005067,0.999973,0.044226,0.066834,-0.004818,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	0,0,1,0.046812,0.066043,-0.004818,
-	0,0,1,0.048188,0.066646,-0.004818,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	0,0,1,0.046812,0.066043,-0.004818,
-	-0.005704,0.004718,0.999973,0.043561,0.066081,-0.004818,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	0,0,1,0.0456,0.065145,-0.004818,
-	0,0,1,0.046812,0.066043,-0.004818,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	0,0,1,0.0456,0.065145,-0.004818,
-	-0.005989,0.004351,0.999973,0.042945,0.065287,-0.004818,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	0,0,1,0.044613,0.063997,-0.004818,
-	0,0,1,0.0456,0.065145,-0.004818,
-	-0.006487,0.003566,0.999973,0.041869,0.063591,-0.004818,
-	0,0,1,0.044613,0.063997,-0.004818,
-	-0.00625,0.003966,0.999973,0.042381,0.064456,-0.004818,
-	0,0,1,0.04966,0.066926,-0.004818,
-	0,0,1,0.060613,0.066867,-0.004818,
-	0,0,1,0.06211,0.066926,-0.004818,
-	0,0,1,0.051157,0.066867,-0.004818,
-	0,0,1,0.060613,0.066867,-0.004818,
-	0,0,1,0.04966,0.066926,-0.004818,
-	0,0,1,0.051157,0.066867,-0.004818,
-	0,0,1,0.059165,0.066474,-0.004818,
-	0,0,1,0.060613,0.066867,-0.004818,
-	0,0,1,0.052605,0.066474,-0.004818,
-	0,0,1,0.059165,0.066474,-0.004818,
-	0,0,1,0.051157,0.066867,-0.004818,
-	0,0,1,0.052605,0.066474,-0.004818,
-	0,0,1,0.057837,0.065766,-0.004818,
-	0,0,1,0.059165,0.066474,-0.004818,
-	0,0,1,0.053934,0.065766,-0.004818,
-	0,0,1,0.057837,0.065766,-0.004818,
-	0,0,1,0.052605,0.066474,-0.004818,
-	0,0,1,0.053934,0.065766,-0.004818,
-	0,0,1,0.056739,0.064761,-0.004818,
-	0,0,1,0.057837,0.065766,-0.004818,
-	0,0,1,0.055031,0.064761,-0.004818,
-	0,0,1,0.056739,0.064761,-0.004818,
-	0,0,1,0.053934,0.065766,-0.004818,
-	0,0,1,0.056739,0.064761,-0.004818,
-	0,0,1,0.055031,0.064761,-0.004818,
-	0,0,1,0.055885,0.063727,-0.004818,
-	-0.929776,-0.368125,0,0.03976,0.049501,-0.007708,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.929776,-0.368125,0,0.03976,0.049501,-0.007708,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.951057,-0.309017,0,0.03939,0.050526,-0.007708,
-	-0.904827,-0.425779,0,0.040192,0.048501,-0.007708,
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.904827,-0.425779,0,0.040192,0.048501,-0.007708,
-	-0.929762,-0.368119,0.005552,0.03976,0.049501,-0.006167,
-	-0.929776,-0.368125,0,0.03976,0.049501,-0.007708,
-	-0.876307,-0.481754,0,0.040687,0.04753,-0.007708,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.876307,-0.481754,0,0.040687,0.04753,-0.007708,
-	-0.904813,-0.425773,0.005552,0.040192,0.048501,-0.006167,
-	-0.904827,-0.425779,0,0.040192,0.048501,-0.007708,
-	-0.844328,-0.535827,0,0.041241,0.046592,-0.007708,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.844328,-0.535827,0,0.041241,0.046592,-0.007708,
-	-0.876293,-0.481746,0.005552,0.040687,0.04753,-0.006167,
-	-0.876307,-0.481754,0,0.040687,0.04753,-0.007708,
-	-0.844328,-0.535827,0,0.041241,0.046592,-0.007708,
-	-0.876307,-0.481754,0,0.040687,0.04753,-0.007708,
-	-0.860742,-0.509041,0,0.040845,0.047263,-0.007708,
-	-0.844328,-0.535827,0,0.041241,0.046592,-0.007708,
-	-0.860742,-0.509041,0,0.040845,0.047263,-0.007708,
-	-0.860742,-0.509041,0,0.040904,0.047163,-0.007708,
-	-0.809017,-0.587785,0,0.041854,0.045691,-0.007708,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.809017,-0.587785,0,0.041854,0.045691,-0.007708,
-	-0.844315,-0.535819,0.005552,0.041241,0.046592,-0.006167,
-	-0.844328,-0.535827,0,0.041241,0.046592,-0.007708,
-	-0.770513,-0.637424,0,0.042522,0.04483,-0.007708,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.770513,-0.637424,0,0.042522,0.04483,-0.007708,
-	-0.809005,-0.587776,0.005552,0.041854,0.045691,-0.006167,
-	-0.809017,-0.587785,0,0.041854,0.045691,-0.007708,
-	-0.728969,-0.684547,0,0.043242,0.044013,-0.007708,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.728969,-0.684547,0,0.043242,0.044013,-0.007708,
-	-0.770501,-0.637414,0.005552,0.042522,0.04483,-0.006167,
-	-0.770513,-0.637424,0,0.042522,0.04483,-0.007708,
-	-0.684547,-0.728969,0,0.044013,0.043242,-0.007708,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.684547,-0.728969,0,0.044013,0.043242,-0.007708,
-	-0.728957,-0.684537,0.005552,0.043242,0.044013,-0.006167,
-	-0.728969,-0.684547,0,0.043242,0.044013,-0.007708,
-	-0.684547,-0.728969,0,0.044013,0.043242,-0.007708,
-	-0.728969,-0.684547,0,0.043242,0.044013,-0.007708,
-	-0.707107,-0.707107,0,0.043581,0.043673,-0.007708,
-	-0.684547,-0.728969,0,0.044013,0.043242,-0.007708,
-	-0.707107,-0.707107,0,0.043581,0.043673,-0.007708,
-	-0.707107,-0.707107,0,0.043673,0.043581,-0.007708,
-	-0.637424,-0.770513,0,0.04483,0.042522,-0.007708,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.637424,-0.770513,0,0.04483,0.042522,-0.007708,
-	-0.684537,-0.728957,0.005552,0.044013,0.043242,-0.006167,
-	-0.684547,-0.728969,0,0.044013,0.043242,-0.007708,
-	-0.587785,-0.809017,0,0.045691,0.041854,-0.007708,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.587785,-0.809017,0,0.045691,0.041854,-0.007708,
-	-0.637414,-0.770501,0.005552,0.04483,0.042522,-0.006167,
-	-0.637424,-0.770513,0,0.04483,0.042522,-0.007708,
-	-0.535827,-0.844328,0,0.046592,0.041241,-0.007708,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.535827,-0.844328,0,0.046592,0.041241,-0.007708,
-	-0.587776,-0.809005,0.005552,0.045691,0.041854,-0.006167,
-	-0.587785,-0.809017,0,0.045691,0.041854,-0.007708,
-	-0.481754,-0.876307,0,0.04753,0.040687,-0.007708,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.481754,-0.876307,0,0.04753,0.040687,-0.007708,
-	-0.535819,-0.844315,0.005552,0.046592,0.041241,-0.006167,
-	-0.535827,-0.844328,0,0.046592,0.041241,-0.007708,
-	-0.481754,-0.876307,0,0.04753,0.040687,-0.007708,
-	-0.535827,-0.844328,0,0.046592,0.041241,-0.007708,
-	-0.509041,-0.860742,0,0.047163,0.040904,-0.007708,
-	-0.481754,-0.876307,0,0.04753,0.040687,-0.007708,
-	-0.509041,-0.860742,0,0.047163,0.040904,-0.007708,
-	-0.509041,-0.860742,0,0.047263,0.040845,-0.007708,
-	-0.425779,-0.904827,0,0.048501,0.040192,-0.007708,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.425779,-0.904827,0,0.048501,0.040192,-0.007708,
-	-0.481746,-0.876293,0.005552,0.04753,0.040687,-0.006167,
-	-0.481754,-0.876307,0,0.04753,0.040687,-0.007708,
-	-0.368125,-0.929776,0,0.049501,0.03976,-0.007708,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.368125,-0.929776,0,0.049501,0.03976,-0.007708,
-	-0.425773,-0.904813,0.005552,0.048501,0.040192,-0.006167,
-	-0.425779,-0.904827,0,0.048501,0.040192,-0.007708,
-	-0.309017,-0.951057,0,0.050526,0.03939,-0.007708,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.309017,-0.951057,0,0.050526,0.03939,-0.007708,
-	-0.368119,-0.929762,0.005552,0.049501,0.03976,-0.006167,
-	-0.368125,-0.929776,0,0.049501,0.03976,-0.007708,
-	-0.24869,-0.968583,0,0.051572,0.039087,-0.007708,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.24869,-0.968583,0,0.051572,0.039087,-0.007708,
-	-0.309012,-0.951042,0.005552,0.050526,0.03939,-0.006167,
-	-0.309017,-0.951057,0,0.050526,0.03939,-0.007708,
-	-0.24869,-0.968583,0,0.051572,0.039087,-0.007708,
-	-0.309017,-0.951057,0,0.050526,0.03939,-0.007708,
-	-0.278991,-0.960294,0,0.051356,0.039149,-0.007708,
-	-0.24869,-0.968583,0,0.051572,0.039087,-0.007708,
-	-0.278991,-0.960294,0,0.051356,0.039149,-0.007708,
-	-0.278991,-0.960294,0,0.051428,0.039128,-0.007708,
-	-0.187381,-0.982287,0,0.052635,0.038849,-0.007708,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.187381,-0.982287,0,0.052635,0.038849,-0.007708,
-	-0.248686,-0.968568,0.005552,0.051572,0.039087,-0.006167,
-	-0.24869,-0.968583,0,0.051572,0.039087,-0.007708,
-	-0.125333,-0.992115,0,0.053712,0.038678,-0.007708,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.125333,-0.992115,0,0.053712,0.038678,-0.007708,
-	-0.187378,-0.982272,0.005552,0.052635,0.038849,-0.006167,
-	-0.187381,-0.982287,0,0.052635,0.038849,-0.007708,
-	-0.094108,-0.995562,0,0.054796,0.038576,-0.007708,
-	-0.07324,-0.997287,0.007402,0.054796,0.038576,-0.006167,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	-0.094108,-0.995562,0,0.054796,0.038576,-0.007708,
-	-0.125331,-0.992099,0.005552,0.053712,0.038678,-0.006167,
-	-0.125333,-0.992115,0,0.053712,0.038678,-0.007708,
-	-0.951057,-0.309017,0,0.03939,0.050526,-0.007708,
-	-0.951042,-0.309012,0.005552,0.03939,0.050526,-0.006167,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.951057,-0.309017,0,0.03939,0.050526,-0.007708,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.968583,-0.24869,0,0.039087,0.051572,-0.007708,
-	-0.951057,-0.309017,0,0.03939,0.050526,-0.007708,
-	-0.968583,-0.24869,0,0.039087,0.051572,-0.007708,
-	-0.960294,-0.278991,0,0.039128,0.051428,-0.007708,
-	-0.951057,-0.309017,0,0.03939,0.050526,-0.007708,
-	-0.960294,-0.278991,0,0.039128,0.051428,-0.007708,
-	-0.960294,-0.278991,0,0.039149,0.051356,-0.007708,
-	-0.968583,-0.24869,0,0.039087,0.051572,-0.007708,
-	-0.968568,-0.248686,0.005552,0.039087,0.051572,-0.006167,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.968583,-0.24869,0,0.039087,0.051572,-0.007708,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.982287,-0.187381,0,0.038849,0.052635,-0.007708,
-	-0.982287,-0.187381,0,0.038849,0.052635,-0.007708,
-	-0.982272,-0.187378,0.005552,0.038849,0.052635,-0.006167,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.982287,-0.187381,0,0.038849,0.052635,-0.007708,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.992115,-0.125333,0,0.038678,0.053712,-0.007708,
-	-0.992115,-0.125333,0,0.038678,0.053712,-0.007708,
-	-0.992099,-0.125331,0.005552,0.038678,0.053712,-0.006167,
-	-0.997287,-0.07324,0.007402,0.038576,0.054796,-0.006167,
-	-0.992115,-0.125333,0,0.038678,0.053712,-0.007708,
-	-0.997287,-0.07324,0.007402,0.038576,0.054796,-0.006167,
-	-0.995562,-0.094108,0,0.038576,0.054796,-0.007708,
-	-0.995562,0.094108,0,0.038576,0.056974,-0.007708,
-	-0.997287,0.07324,0.007402,0.038576,0.056974,-0.006167,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.995562,0.094108,0,0.038576,0.056974,-0.007708,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.992115,0.125333,0,0.038678,0.058059,-0.007708,
-	-0.992115,0.125333,0,0.038678,0.058059,-0.007708,
-	-0.992099,0.125331,0.005552,0.038678,0.058059,-0.006167,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.992115,0.125333,0,0.038678,0.058059,-0.007708,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.982287,0.187381,0,0.038849,0.059135,-0.007708,
-	-0.982287,0.187381,0,0.038849,0.059135,-0.007708,
-	-0.982272,0.187378,0.005552,0.038849,0.059135,-0.006167,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.982287,0.187381,0,0.038849,0.059135,-0.007708,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.968583,0.24869,0,0.039087,0.060198,-0.007708,
-	-0.968583,0.24869,0,0.039087,0.060198,-0.007708,
-	-0.968568,0.248686,0.005552,0.039087,0.060198,-0.006167,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.968583,0.24869,0,0.039087,0.060198,-0.007708,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.951057,0.309017,0,0.03939,0.061245,-0.007708,
-	-0.968583,0.24869,0,0.039087,0.060198,-0.007708,
-	-0.951057,0.309017,0,0.03939,0.061245,-0.007708,
-	-0.960294,0.278991,0,0.039149,0.060414,-0.007708,
-	-0.968583,0.24869,0,0.039087,0.060198,-0.007708,
-	-0.960294,0.278991,0,0.039149,0.060414,-0.007708,
-	-0.960294,0.278991,0,0.039128,0.060343,-0.007708,
-	-0.951057,0.309017,0,0.03939,0.061245,-0.007708,
-	-0.951042,0.309012,0.005552,0.03939,0.061245,-0.006167,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.951057,0.309017,0,0.03939,0.061245,-0.007708,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.929776,0.368125,0,0.03976,0.06227,-0.007708,
-	-0.929776,0.368125,0,0.03976,0.06227,-0.007708,
-	-0.929762,0.368119,0.005552,0.03976,0.06227,-0.006167,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.929776,0.368125,0,0.03976,0.06227,-0.007708,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.904827,0.425779,0,0.040192,0.06327,-0.007708,
-	-0.904827,0.425779,0,0.040192,0.06327,-0.007708,
-	-0.904813,0.425773,0.005552,0.040192,0.06327,-0.006167,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.904827,0.425779,0,0.040192,0.06327,-0.007708,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.876307,0.481754,0,0.040687,0.064241,-0.007708,
-	-0.876307,0.481754,0,0.040687,0.064241,-0.007708,
-	-0.876293,0.481746,0.005552,0.040687,0.064241,-0.006167,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.876307,0.481754,0,0.040687,0.064241,-0.007708,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.844328,0.535827,0,0.041241,0.065178,-0.007708,
-	-0.876307,0.481754,0,0.040687,0.064241,-0.007708,
-	-0.844328,0.535827,0,0.041241,0.065178,-0.007708,
-	-0.860742,0.509041,0,0.040904,0.064607,-0.007708,
-	-0.876307,0.481754,0,0.040687,0.064241,-0.007708,
-	-0.860742,0.509041,0,0.040904,0.064607,-0.007708,
-	-0.860742,0.509041,0,0.040845,0.064507,-0.007708,
-	-0.844328,0.535827,0,0.041241,0.065178,-0.007708,
-	-0.844315,0.535819,0.005552,0.041241,0.065178,-0.006167,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.844328,0.535827,0,0.041241,0.065178,-0.007708,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.809017,0.587785,0,0.041854,0.06608,-0.007708,
-	-0.809017,0.587785,0,0.041854,0.06608,-0.007708,
-	-0.809005,0.587776,0.005552,0.041854,0.06608,-0.006167,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.809017,0.587785,0,0.041854,0.06608,-0.007708,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.770513,0.637424,0,0.042522,0.066941,-0.007708,
-	-0.770513,0.637424,0,0.042522,0.066941,-0.007708,
-	-0.770501,0.637414,0.005552,0.042522,0.066941,-0.006167,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.770513,0.637424,0,0.042522,0.066941,-0.007708,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.728969,0.684547,0,0.043242,0.067758,-0.007708,
-	-0.728969,0.684547,0,0.043242,0.067758,-0.007708,
-	-0.728957,0.684537,0.005552,0.043242,0.067758,-0.006167,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.728969,0.684547,0,0.043242,0.067758,-0.007708,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.684547,0.728969,0,0.044013,0.068528,-0.007708,
-	-0.728969,0.684547,0,0.043242,0.067758,-0.007708,
-	-0.684547,0.728969,0,0.044013,0.068528,-0.007708,
-	-0.707107,0.707107,0,0.043673,0.068189,-0.007708,
-	-0.728969,0.684547,0,0.043242,0.067758,-0.007708,
-	-0.707107,0.707107,0,0.043673,0.068189,-0.007708,
-	-0.707107,0.707107,0,0.043581,0.068097,-0.007708,
-	-0.684547,0.728969,0,0.044013,0.068528,-0.007708,
-	-0.684537,0.728957,0.005552,0.044013,0.068528,-0.006167,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.684547,0.728969,0,0.044013,0.068528,-0.007708,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.637424,0.770513,0,0.04483,0.069249,-0.007708,
-	-0.637424,0.770513,0,0.04483,0.069249,-0.007708,
-	-0.637414,0.770501,0.005552,0.04483,0.069249,-0.006167,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.637424,0.770513,0,0.04483,0.069249,-0.007708,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.587785,0.809017,0,0.045691,0.069917,-0.007708,
-	-0.587785,0.809017,0,0.045691,0.069917,-0.007708,
-	-0.587776,0.809005,0.005552,0.045691,0.069917,-0.006167,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.587785,0.809017,0,0.045691,0.069917,-0.007708,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.535827,0.844328,0,0.046592,0.070529,-0.007708,
-	-0.535827,0.844328,0,0.046592,0.070529,-0.007708,
-	-0.535819,0.844315,0.005552,0.046592,0.070529,-0.006167,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.535827,0.844328,0,0.046592,0.070529,-0.007708,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.481754,0.876307,0,0.04753,0.071084,-0.007708,
-	-0.535827,0.844328,0,0.046592,0.070529,-0.007708,
-	-0.481754,0.876307,0,0.04753,0.071084,-0.007708,
-	-0.509041,0.860742,0,0.047263,0.070926,-0.007708,
-	-0.535827,0.844328,0,0.046592,0.070529,-0.007708,
-	-0.509041,0.860742,0,0.047263,0.070926,-0.007708,
-	-0.509041,0.860742,0,0.047163,0.070867,-0.007708,
-	-0.481754,0.876307,0,0.04753,0.071084,-0.007708,
-	-0.481746,0.876293,0.005552,0.04753,0.071084,-0.006167,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.481754,0.876307,0,0.04753,0.071084,-0.007708,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.425779,0.904827,0,0.048501,0.071578,-0.007708,
-	-0.425779,0.904827,0,0.048501,0.071578,-0.007708,
-	-0.425773,0.904813,0.005552,0.048501,0.071578,-0.006167,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.425779,0.904827,0,0.048501,0.071578,-0.007708,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.368125,0.929776,0,0.049501,0.072011,-0.007708,
-	-0.368125,0.929776,0,0.049501,0.072011,-0.007708,
-	-0.368119,0.929762,0.005552,0.049501,0.072011,-0.006167,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.368125,0.929776,0,0.049501,0.072011,-0.007708,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.309017,0.951057,0,0.050526,0.07238,-0.007708,
-	-0.309017,0.951057,0,0.050526,0.07238,-0.007708,
-	-0.309012,0.951042,0.005552,0.050526,0.07238,-0.006167,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.309017,0.951057,0,0.050526,0.07238,-0.007708,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.24869,0.968583,0,0.051572,0.072684,-0.007708,
-	-0.309017,0.951057,0,0.050526,0.07238,-0.007708,
-	-0.24869,0.968583,0,0.051572,0.072684,-0.007708,
-	-0.278991,0.960294,0,0.051428,0.072642,-0.007708,
-	-0.309017,0.951057,0,0.050526,0.07238,-0.007708,
-	-0.278991,0.960294,0,0.051428,0.072642,-0.007708,
-	-0.278991,0.960294,0,0.051356,0.072621,-0.007708,
-	-0.24869,0.968583,0,0.051572,0.072684,-0.007708,
-	-0.248686,0.968568,0.005552,0.051572,0.072684,-0.006167,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.24869,0.968583,0,0.051572,0.072684,-0.007708,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.187381,0.982287,0,0.052635,0.072922,-0.007708,
-	-0.187381,0.982287,0,0.052635,0.072922,-0.007708,
-	-0.187378,0.982272,0.005552,0.052635,0.072922,-0.006167,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.187381,0.982287,0,0.052635,0.072922,-0.007708,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.125333,0.992115,0,0.053712,0.073092,-0.007708,
-	-0.125333,0.992115,0,0.053712,0.073092,-0.007708,
-	-0.125331,0.992099,0.005552,0.053712,0.073092,-0.006167,
-	-0.07324,0.997287,0.007402,0.054796,0.073195,-0.006167,
-	-0.125333,0.992115,0,0.053712,0.073092,-0.007708,
-	-0.07324,0.997287,0.007402,0.054796,0.073195,-0.006167,
-	-0.094108,0.995562,0,0.054796,0.073195,-0.007708,
-	0.094108,0.995562,0,0.056974,0.073195,-0.007708,
-	0.07324,0.997287,0.007402,0.056974,0.073195,-0.006167,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0.094108,0.995562,0,0.056974,0.073195,-0.007708,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0.125333,0.992115,0,0.058059,0.073092,-0.007708,
-	0.125333,0.992115,0,0.058059,0.073092,-0.007708,
-	0.125331,0.992099,0.005552,0.058059,0.073092,-0.006167,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.125333,0.992115,0,0.058059,0.073092,-0.007708,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.187381,0.982287,0,0.059135,0.072922,-0.007708,
-	0.187381,0.982287,0,0.059135,0.072922,-0.007708,
-	0.187378,0.982272,0.005552,0.059135,0.072922,-0.006167,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.187381,0.982287,0,0.059135,0.072922,-0.007708,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.24869,0.968583,0,0.060198,0.072684,-0.007708,
-	0.24869,0.968583,0,0.060198,0.072684,-0.007708,
-	0.248686,0.968568,0.005552,0.060198,0.072684,-0.006167,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.24869,0.968583,0,0.060198,0.072684,-0.007708,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.309017,0.951057,0,0.061245,0.07238,-0.007708,
-	0.24869,0.968583,0,0.060198,0.072684,-0.007708,
-	0.309017,0.951057,0,0.061245,0.07238,-0.007708,
-	0.278991,0.960294,0,0.060414,0.072621,-0.007708,
-	0.24869,0.968583,0,0.060198,0.072684,-0.007708,
-	0.278991,0.960294,0,0.060414,0.072621,-0.007708,
-	0.278991,0.960294,0,0.060343,0.072642,-0.007708,
-	0.309017,0.951057,0,0.061245,0.07238,-0.007708,
-	0.309012,0.951042,0.005552,0.061245,0.07238,-0.006167,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.309017,0.951057,0,0.061245,0.07238,-0.007708,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.368125,0.929776,0,0.06227,0.072011,-0.007708,
-	0.368125,0.929776,0,0.06227,0.072011,-0.007708,
-	0.368119,0.929762,0.005552,0.06227,0.072011,-0.006167,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.368125,0.929776,0,0.06227,0.072011,-0.007708,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.425779,0.904827,0,0.06327,0.071578,-0.007708,
-	0.425779,0.904827,0,0.06327,0.071578,-0.007708,
-	0.425773,0.904813,0.005552,0.06327,0.071578,-0.006167,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.425779,0.904827,0,0.06327,0.071578,-0.007708,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.481754,0.876307,0,0.064241,0.071084,-0.007708,
-	0.481754,0.876307,0,0.064241,0.071084,-0.007708,
-	0.481746,0.876293,0.005552,0.064241,0.071084,-0.006167,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.481754,0.876307,0,0.064241,0.071084,-0.007708,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.535827,0.844328,0,0.065178,0.070529,-0.007708,
-	0.481754,0.876307,0,0.064241,0.071084,-0.007708,
-	0.535827,0.844328,0,0.065178,0.070529,-0.007708,
-	0.509041,0.860742,0,0.064607,0.070867,-0.007708,
-	0.481754,0.876307,0,0.064241,0.071084,-0.007708,
-	0.509041,0.860742,0,0.064607,0.070867,-0.007708,
-	0.509041,0.860742,0,0.064507,0.070926,-0.007708,
-	0.535827,0.844328,0,0.065178,0.070529,-0.007708,
-	0.535819,0.844315,0.005552,0.065178,0.070529,-0.006167,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.535827,0.844328,0,0.065178,0.070529,-0.007708,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.587785,0.809017,0,0.06608,0.069917,-0.007708,
-	0.587785,0.809017,0,0.06608,0.069917,-0.007708,
-	0.587776,0.809005,0.005552,0.06608,0.069917,-0.006167,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.587785,0.809017,0,0.06608,0.069917,-0.007708,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.637424,0.770513,0,0.066941,0.069249,-0.007708,
-	0.637424,0.770513,0,0.066941,0.069249,-0.007708,
-	0.637414,0.770501,0.005552,0.066941,0.069249,-0.006167,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.637424,0.770513,0,0.066941,0.069249,-0.007708,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.684547,0.728969,0,0.067758,0.068528,-0.007708,
-	0.684547,0.728969,0,0.067758,0.068528,-0.007708,
-	0.684537,0.728957,0.005552,0.067758,0.068528,-0.006167,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.684547,0.728969,0,0.067758,0.068528,-0.007708,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.728969,0.684547,0,0.068528,0.067758,-0.007708,
-	0.684547,0.728969,0,0.067758,0.068528,-0.007708,
-	0.728969,0.684547,0,0.068528,0.067758,-0.007708,
-	0.707107,0.707107,0,0.068189,0.068097,-0.007708,
-	0.684547,0.728969,0,0.067758,0.068528,-0.007708,
-	0.707107,0.707107,0,0.068189,0.068097,-0.007708,
-	0.707107,0.707107,0,0.068097,0.068189,-0.007708,
-	0.728969,0.684547,0,0.068528,0.067758,-0.007708,
-	0.728957,0.684537,0.005552,0.068528,0.067758,-0.006167,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.728969,0.684547,0,0.068528,0.067758,-0.007708,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.770513,0.637424,0,0.069249,0.066941,-0.007708,
-	0.770513,0.637424,0,0.069249,0.066941,-0.007708,
-	0.770501,0.637414,0.005552,0.069249,0.066941,-0.006167,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.770513,0.637424,0,0.069249,0.066941,-0.007708,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.809017,0.587785,0,0.069917,0.06608,-0.007708,
-	0.809017,0.587785,0,0.069917,0.06608,-0.007708,
-	0.809005,0.587776,0.005552,0.069917,0.06608,-0.006167,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.809017,0.587785,0,0.069917,0.06608,-0.007708,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.844328,0.535827,0,0.070529,0.065178,-0.007708,
-	0.844328,0.535827,0,0.070529,0.065178,-0.007708,
-	0.844315,0.535819,0.005552,0.070529,0.065178,-0.006167,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.844328,0.535827,0,0.070529,0.065178,-0.007708,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.876307,0.481754,0,0.071084,0.064241,-0.007708,
-	0.844328,0.535827,0,0.070529,0.065178,-0.007708,
-	0.876307,0.481754,0,0.071084,0.064241,-0.007708,
-	0.860742,0.509041,0,0.070926,0.064507,-0.007708,
-	0.844328,0.535827,0,0.070529,0.065178,-0.007708,
-	0.860742,0.509041,0,0.070926,0.064507,-0.007708,
-	0.860742,0.509041,0,0.070867,0.064607,-0.007708,
-	0.876307,0.481754,0,0.071084,0.064241,-0.007708,
-	0.876293,0.481746,0.005552,0.071084,0.064241,-0.006167,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.876307,0.481754,0,0.071084,0.064241,-0.007708,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.904827,0.425779,0,0.071578,0.06327,-0.007708,
-	0.904827,0.425779,0,0.071578,0.06327,-0.007708,
-	0.904813,0.425773,0.005552,0.071578,0.06327,-0.006167,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.904827,0.425779,0,0.071578,0.06327,-0.007708,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.929776,0.368125,0,0.072011,0.06227,-0.007708,
-	0.929776,0.368125,0,0.072011,0.06227,-0.007708,
-	0.929762,0.368119,0.005552,0.072011,0.06227,-0.006167,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.929776,0.368125,0,0.072011,0.06227,-0.007708,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.951057,0.309017,0,0.07238,0.061245,-0.007708,
-	0.951057,0.309017,0,0.07238,0.061245,-0.007708,
-	0.951042,0.309012,0.005552,0.07238,0.061245,-0.006167,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.951057,0.309017,0,0.07238,0.061245,-0.007708,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.968583,0.24869,0,0.072684,0.060198,-0.007708,
-	0.951057,0.309017,0,0.07238,0.061245,-0.007708,
-	0.968583,0.24869,0,0.072684,0.060198,-0.007708,
-	0.960294,0.278991,0,0.072642,0.060343,-0.007708,
-	0.951057,0.309017,0,0.07238,0.061245,-0.007708,
-	0.960294,0.278991,0,0.072642,0.060343,-0.007708,
-	0.960294,0.278991,0,0.072621,0.060414,-0.007708,
-	0.968583,0.24869,0,0.072684,0.060198,-0.007708,
-	0.968568,0.248686,0.005552,0.072684,0.060198,-0.006167,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.968583,0.24869,0,0.072684,0.060198,-0.007708,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.982287,0.187381,0,0.072922,0.059135,-0.007708,
-	0.982287,0.187381,0,0.072922,0.059135,-0.007708,
-	0.982272,0.187378,0.005552,0.072922,0.059135,-0.006167,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.982287,0.187381,0,0.072922,0.059135,-0.007708,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.992115,0.125333,0,0.073092,0.058059,-0.007708,
-	0.992115,0.125333,0,0.073092,0.058059,-0.007708,
-	0.992099,0.125331,0.005552,0.073092,0.058059,-0.006167,
-	0.997287,0.07324,0.007402,0.073195,0.056974,-0.006167,
-	0.992115,0.125333,0,0.073092,0.058059,-0.007708,
-	0.997287,0.07324,0.007402,0.073195,0.056974,-0.006167,
-	0.995562,0.094108,0,0.073195,0.056974,-0.007708,
-	0.995562,-0.094108,0,0.073195,0.054796,-0.007708,
-	0.997287,-0.07324,0.007402,0.073195,0.054796,-0.006167,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.995562,-0.094108,0,0.073195,0.054796,-0.007708,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.992115,-0.125333,0,0.073092,0.053712,-0.007708,
-	0.992115,-0.125333,0,0.073092,0.053712,-0.007708,
-	0.992099,-0.125331,0.005552,0.073092,0.053712,-0.006167,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.992115,-0.125333,0,0.073092,0.053712,-0.007708,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.982287,-0.187381,0,0.072922,0.052635,-0.007708,
-	0.982287,-0.187381,0,0.072922,0.052635,-0.007708,
-	0.982272,-0.187378,0.005552,0.072922,0.052635,-0.006167,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.982287,-0.187381,0,0.072922,0.052635,-0.007708,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.968583,-0.24869,0,0.072684,0.051572,-0.007708,
-	0.968583,-0.24869,0,0.072684,0.051572,-0.007708,
-	0.968568,-0.248686,0.005552,0.072684,0.051572,-0.006167,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.968583,-0.24869,0,0.072684,0.051572,-0.007708,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.951057,-0.309017,0,0.07238,0.050526,-0.007708,
-	0.968583,-0.24869,0,0.072684,0.051572,-0.007708,
-	0.951057,-0.309017,0,0.07238,0.050526,-0.007708,
-	0.960294,-0.278991,0,0.072621,0.051356,-0.007708,
-	0.968583,-0.24869,0,0.072684,0.051572,-0.007708,
-	0.960294,-0.278991,0,0.072621,0.051356,-0.007708,
-	0.960294,-0.278991,0,0.072642,0.051428,-0.007708,
-	0.951057,-0.309017,0,0.07238,0.050526,-0.007708,
-	0.951042,-0.309012,0.005552,0.07238,0.050526,-0.006167,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.951057,-0.309017,0,0.07238,0.050526,-0.007708,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.929776,-0.368125,0,0.072011,0.049501,-0.007708,
-	0.929776,-0.368125,0,0.072011,0.049501,-0.007708,
-	0.929762,-0.368119,0.005552,0.072011,0.049501,-0.006167,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.929776,-0.368125,0,0.072011,0.049501,-0.007708,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.904827,-0.425779,0,0.071578,0.048501,-0.007708,
-	0.904827,-0.425779,0,0.071578,0.048501,-0.007708,
-	0.904813,-0.425773,0.005552,0.071578,0.048501,-0.006167,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.904827,-0.425779,0,0.071578,0.048501,-0.007708,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.876307,-0.481754,0,0.071084,0.04753,-0.007708,
-	0.876307,-0.481754,0,0.071084,0.04753,-0.007708,
-	0.876293,-0.481746,0.005552,0.071084,0.04753,-0.006167,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.876307,-0.481754,0,0.071084,0.04753,-0.007708,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.844328,-0.535827,0,0.070529,0.046592,-0.007708,
-	0.876307,-0.481754,0,0.071084,0.04753,-0.007708,
-	0.844328,-0.535827,0,0.070529,0.046592,-0.007708,
-	0.860742,-0.509041,0,0.070867,0.047163,-0.007708,
-	0.876307,-0.481754,0,0.071084,0.04753,-0.007708,
-	0.860742,-0.509041,0,0.070867,0.047163,-0.007708,
-	0.860742,-0.509041,0,0.070926,0.047263,-0.007708,
-	0.844328,-0.535827,0,0.070529,0.046592,-0.007708,
-	0.844315,-0.535819,0.005552,0.070529,0.046592,-0.006167,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.844328,-0.535827,0,0.070529,0.046592,-0.007708,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.809017,-0.587785,0,0.069917,0.045691,-0.007708,
-	0.809017,-0.587785,0,0.069917,0.045691,-0.007708,
-	0.809005,-0.587776,0.005552,0.069917,0.045691,-0.006167,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.809017,-0.587785,0,0.069917,0.045691,-0.007708,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.770513,-0.637424,0,0.069249,0.04483,-0.007708,
-	0.770513,-0.637424,0,0.069249,0.04483,-0.007708,
-	0.770501,-0.637414,0.005552,0.069249,0.04483,-0.006167,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.770513,-0.637424,0,0.069249,0.04483,-0.007708,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.728969,-0.684547,0,0.068528,0.044013,-0.007708,
-	0.728969,-0.684547,0,0.068528,0.044013,-0.007708,
-	0.728957,-0.684537,0.005552,0.068528,0.044013,-0.006167,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.728969,-0.684547,0,0.068528,0.044013,-0.007708,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.684547,-0.728969,0,0.067758,0.043242,-0.007708,
-	0.728969,-0.684547,0,0.068528,0.044013,-0.007708,
-	0.684547,-0.728969,0,0.067758,0.043242,-0.007708,
-	0.707107,-0.707107,0,0.068097,0.043581,-0.007708,
-	0.728969,-0.684547,0,0.068528,0.044013,-0.007708,
-	0.707107,-0.707107,0,0.068097,0.043581,-0.007708,
-	0.707107,-0.707107,0,0.068189,0.043673,-0.007708,
-	0.684547,-0.728969,0,0.067758,0.043242,-0.007708,
-	0.684537,-0.728957,0.005552,0.067758,0.043242,-0.006167,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.684547,-0.728969,0,0.067758,0.043242,-0.007708,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.637424,-0.770513,0,0.066941,0.042522,-0.007708,
-	0.637424,-0.770513,0,0.066941,0.042522,-0.007708,
-	0.637414,-0.770501,0.005552,0.066941,0.042522,-0.006167,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.637424,-0.770513,0,0.066941,0.042522,-0.007708,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.587785,-0.809017,0,0.06608,0.041854,-0.007708,
-	0.587785,-0.809017,0,0.06608,0.041854,-0.007708,
-	0.587776,-0.809005,0.005552,0.06608,0.041854,-0.006167,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.587785,-0.809017,0,0.06608,0.041854,-0.007708,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.535827,-0.844328,0,0.065178,0.041241,-0.007708,
-	0.535827,-0.844328,0,0.065178,0.041241,-0.007708,
-	0.535819,-0.844315,0.005552,0.065178,0.041241,-0.006167,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.535827,-0.844328,0,0.065178,0.041241,-0.007708,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.481754,-0.876307,0,0.064241,0.040687,-0.007708,
-	0.535827,-0.844328,0,0.065178,0.041241,-0.007708,
-	0.481754,-0.876307,0,0.064241,0.040687,-0.007708,
-	0.509041,-0.860742,0,0.064507,0.040845,-0.007708,
-	0.535827,-0.844328,0,0.065178,0.041241,-0.007708,
-	0.509041,-0.860742,0,0.064507,0.040845,-0.007708,
-	0.509041,-0.860742,0,0.064607,0.040904,-0.007708,
-	0.481754,-0.876307,0,0.064241,0.040687,-0.007708,
-	0.481746,-0.876293,0.005552,0.064241,0.040687,-0.006167,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.481754,-0.876307,0,0.064241,0.040687,-0.007708,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.425779,-0.904827,0,0.06327,0.040192,-0.007708,
-	0.425779,-0.904827,0,0.06327,0.040192,-0.007708,
-	0.425773,-0.904813,0.005552,0.06327,0.040192,-0.006167,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.425779,-0.904827,0,0.06327,0.040192,-0.007708,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.368125,-0.929776,0,0.06227,0.03976,-0.007708,
-	0.368125,-0.929776,0,0.06227,0.03976,-0.007708,
-	0.368119,-0.929762,0.005552,0.06227,0.03976,-0.006167,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.368125,-0.929776,0,0.06227,0.03976,-0.007708,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.309017,-0.951057,0,0.061245,0.03939,-0.007708,
-	0.309017,-0.951057,0,0.061245,0.03939,-0.007708,
-	0.309012,-0.951042,0.005552,0.061245,0.03939,-0.006167,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.309017,-0.951057,0,0.061245,0.03939,-0.007708,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.24869,-0.968583,0,0.060198,0.039087,-0.007708,
-	0.309017,-0.951057,0,0.061245,0.03939,-0.007708,
-	0.24869,-0.968583,0,0.060198,0.039087,-0.007708,
-	0.278991,-0.960294,0,0.060343,0.039128,-0.007708,
-	0.309017,-0.951057,0,0.061245,0.03939,-0.007708,
-	0.278991,-0.960294,0,0.060343,0.039128,-0.007708,
-	0.278991,-0.960294,0,0.060414,0.039149,-0.007708,
-	0.24869,-0.968583,0,0.060198,0.039087,-0.007708,
-	0.248686,-0.968568,0.005552,0.060198,0.039087,-0.006167,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.24869,-0.968583,0,0.060198,0.039087,-0.007708,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.187381,-0.982287,0,0.059135,0.038849,-0.007708,
-	0.187381,-0.982287,0,0.059135,0.038849,-0.007708,
-	0.187378,-0.982272,0.005552,0.059135,0.038849,-0.006167,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.187381,-0.982287,0,0.059135,0.038849,-0.007708,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.125333,-0.992115,0,0.058059,0.038678,-0.007708,
-	0.125333,-0.992115,0,0.058059,0.038678,-0.007708,
-	0.125331,-0.992099,0.005552,0.058059,0.038678,-0.006167,
-	0.07324,-0.997287,0.007402,0.056974,0.038576,-0.006167,
-	0.125333,-0.992115,0,0.058059,0.038678,-0.007708,
-	0.07324,-0.997287,0.007402,0.056974,0.038576,-0.006167,
-	0.094108,-0.995562,0,0.056974,0.038576,-0.007708
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,9588,data,NULL};
-const struct gllist *companion_disc=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char companion_disc[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\254\006\000\000t%\000\000(\023\000\0002\350d=2\350"
+ "d=\3329\315\273\021\025\0165.\214\200\311\265\000\000\0002\214\202\311\330"
+ "\001\000\000\000\211\342\320\330\001\000\000\376\210\342\320\265\000\000"
+ "\000\326\217V\302\265\000\000\000\327\217X\302\330\001\000\000\354\223j\273"
+ "\265\000\000\000\360\223l\273\330\001\000\000r\230\304\264\265\000\000\000"
+ "t\230\305\264\330\001\000\000`\235i\256\265\000\000\000b\235k\256\330\001"
+ "\000\000\261\242a\250\265\000\000\000\263\242c\250\330\001\000\000a\250\261"
+ "\242\265\000\000\000c\250\263\242\330\001\000\000i\256`\235\265\000\000\000"
+ "k\256b\235\330\001\000\000\304\264r\230\265\000\000\000\305\264t\230\330"
+ "\001\000\000j\273\354\223\265\000\000\000l\273\360\223\330\001\000\000V\302"
+ "\326\217\265\000\000\000X\302\327\217\330\001\000\000\200\311.\214\265\000"
+ "\000\000\202\3112\214\330\001\000\000\342\320\376\210\265\000\000\000\342"
+ "\320\000\211\330\001\000\000r\330C\206\265\000\000\000r\330G\206\330\001"
+ "\000\000+\340\007\204\265\000\000\000+\340\011\204\330\001\000\000\003\350"
+ "E\202\265\000\000\000\005\350G\202\330\001\000\000\366\357\002\201\265\000"
+ "\000\000\366\357\006\201\330\001\000\000\366\367A\200\265\000\000\000\366"
+ "\367C\200\330\001\000\000\377\377\001\200\265\000\000\000\377\377\003\200"
+ "\330\001\000\000\010\010A\200\265\000\000\000\010\010C\200\330\001\000\000"
+ "\012\020\002\201\265\000\000\000\012\020\006\201\330\001\000\000\373\027"
+ "E\202\265\000\000\000\373\027G\202\330\001\000\000\324\037\007\204\265\000"
+ "\000\000\324\037\011\204\330\001\000\000\216'C\206\265\000\000\000\214'G"
+ "\206\330\001\000\000\036/\376\210\265\000\000\000\034/\000\211\330\001\000"
+ "\000\2006.\214\265\000\000\000~62\214\330\001\000\000\252=\326\217\265\000"
+ "\000\000\250=\327\217\330\001\000\000\224D\354\223\265\000\000\000\224D\360"
+ "\223\330\001\000\000<Kr\230\265\000\000\000;Kt\230\330\001\000\000\227Q`"
+ "\235\265\000\000\000\225Qb\235\330\001\000\000\237W\261\242\265\000\000\000"
+ "\235W\263\242\330\001\000\000M]a\250\265\000\000\000L]c\250\330\001\000\000"
+ "\240bi\256\265\000\000\000\234bk\256\330\001\000\000\216g\304\264\265\000"
+ "\000\000\212g\305\264\330\001\000\000\022lj\273\265\000\000\000\020ll\273"
+ "\330\001\000\000*pV\302\265\000\000\000'pX\302\330\001\000\000\320s\200\311"
+ "\265\000\000\000\316s\202\311\330\001\000\000\002w\342\320\265\000\000\000"
+ "\000w\342\320\330\001\000\000\273yr\330\265\000\000\000\271yr\330\330\001"
+ "\000\000\371{+\340\265\000\000\000\366{+\340\330\001\000\000\273}\003\350"
+ "\265\000\000\000\267}\005\350\330\001\000\000\374~\366\357\265\000\000\000"
+ "\372~\366\357\330\001\000\000\277\177\366\367\265\000\000\000\273\177\366"
+ "\367\330\001\000\000\377\177\377\377\265\000\000\000\373\177\377\377\330"
+ "\001\000\000\277\177\010\010\265\000\000\000\273\177\010\010\330\001\000"
+ "\000\374~\012\020\265\000\000\000\372~\012\020\330\001\000\000\273}\373\027"
+ "\265\000\000\000\267}\373\027\330\001\000\000\371{\324\037\265\000\000\000"
+ "\366{\324\037\330\001\000\000\273y\216'\265\000\000\000\271y\214'\330\001"
+ "\000\000\002w\036/\265\000\000\000\000w\034/\330\001\000\000\320s\2006\265"
+ "\000\000\000\316s~6\330\001\000\000*p\252=\265\000\000\000'p\250=\330\001"
+ "\000\000\022l\224D\265\000\000\000\020l\224D\330\001\000\000\216g<K\265\000"
+ "\000\000\212g;K\330\001\000\000\240b\227Q\265\000\000\000\234b\225Q\330\001"
+ "\000\000M]\237W\265\000\000\000L]\235W\330\001\000\000\237WM]\265\000\000"
+ "\000\235WL]\330\001\000\000\227Q\240b\265\000\000\000\225Q\234b\330\001\000"
+ "\000<K\216g\265\000\000\000;K\212g\330\001\000\000\224D\022l\265\000\000"
+ "\000\224D\020l\330\001\000\000\252=*p\265\000\000\000\250='p\330\001\000"
+ "\000\2006\320s\265\000\000\000~6\316s\330\001\000\000\036/\002w\265\000\000"
+ "\000\034/\000w\330\001\000\000\216'\273y\265\000\000\000\214'\271y\330\001"
+ "\000\000\324\037\371{\265\000\000\000\324\037\366{\330\001\000\000\373\027"
+ "\273}\265\000\000\000\373\027\267}\330\001\000\000\012\020\374~\265\000\000"
+ "\000\012\020\372~\330\001\000\000\010\010\277\177\265\000\000\000\010\010"
+ "\273\177\330\001\000\000\377\377\377\177\265\000\000\000\377\377\373\177"
+ "\330\001\000\000\366\367\277\177\265\000\000\000\366\367\273\177\330\001"
+ "\000\000\366\357\374~\265\000\000\000\366\357\372~\330\001\000\000\003\350"
+ "\273}\265\000\000\000\005\350\267}\330\001\000\000+\340\371{\265\000\000"
+ "\000+\340\366{\330\001\000\000r\330\273y\265\000\000\000r\330\271y\330\001"
+ "\000\000\342\320\002w\265\000\000\000\342\320\000w\330\001\000\000\200\311"
+ "\320s\265\000\000\000\202\311\316s\330\001\000\000V\302*p\265\000\000\000"
+ "X\302'p\330\001\000\000j\273\022l\265\000\000\000l\273\020l\330\001\000\000"
+ "\304\264\216g\265\000\000\000\305\264\212g\330\001\000\000i\256\240b\265"
+ "\000\000\000k\256\234b\330\001\000\000a\250M]\265\000\000\000c\250L]\330"
+ "\001\000\000\261\242\237W\265\000\000\000\263\242\235W\330\001\000\000`\235"
+ "\227Q\265\000\000\000b\235\225Q\330\001\000\000r\230<K\265\000\000\000t\230"
+ ";K\330\001\000\000\354\223\224D\265\000\000\000\360\223\224D\330\001\000"
+ "\000\326\217\252=\265\000\000\000\327\217\250=\330\001\000\000.\214\2006"
+ "\265\000\000\0002\214~6\330\001\000\000\376\210\036/\265\000\000\000\000"
+ "\211\034/\330\001\000\000C\206\216'\265\000\000\000G\206\214'\330\001\000"
+ "\000\007\204\324\037\265\000\000\000\011\204\324\037\330\001\000\000E\202"
+ "\373\027\265\000\000\000G\202\373\027\330\001\000\000\002\201\012\020\265"
+ "\000\000\000\006\201\012\020\330\001\000\000A\200\010\010\265\000\000\000"
+ "C\200\010\010\330\001\000\000\001\200\377\377\265\000\000\000\003\200\377"
+ "\377\330\001\000\000A\200\366\367\265\000\000\000C\200\366\367\330\001\000"
+ "\000\002\201\366\357\265\000\000\000\006\201\366\357\330\001\000\000E\202"
+ "\003\350\265\000\000\000G\202\005\350\330\001\000\000\007\204+\340\265\000"
+ "\000\000\011\204+\340\330\001\000\000C\206r\330\265\000\000\000G\206r\330"
+ "\330\001\000\000$\211\361\320\367\002\000\000k\206~\330\367\002\000\000T"
+ "\214\221\311\367\002\000\000\371\217i\302\367\002\000\000\020\224\201\273"
+ "\367\002\000\000\222\230\334\264\367\002\000\000\177\235\203\256\367\002"
+ "\000\000\317\242~\250\367\002\000\000~\250\317\242\367\002\000\000\203\256"
+ "\177\235\367\002\000\000\334\264\222\230\367\002\000\000\201\273\020\224"
+ "\367\002\000\000i\302\371\217\367\002\000\000\221\311T\214\367\002\000\000"
+ "\361\320$\211\367\002\000\000~\330k\206\367\002\000\0006\340,\204\367\002"
+ "\000\000\014\350m\202\367\002\000\000\371\357,\201\367\002\000\000\371\367"
+ "i\200\367\002\000\000\377\377)\200\367\002\000\000\007\010i\200\367\002\000"
+ "\000\005\020,\201\367\002\000\000\364\027m\202\367\002\000\000\312\037,\204"
+ "\367\002\000\000\200'k\206\367\002\000\000\017/$\211\367\002\000\000o6T\214"
+ "\367\002\000\000\225=\371\217\367\002\000\000\177D\020\224\367\002\000\000"
+ "$K\222\230\367\002\000\000}Q\177\235\367\002\000\000\202W\317\242\367\002"
+ "\000\000/]~\250\367\002\000\000\177b\203\256\367\002\000\000lg\334\264\367"
+ "\002\000\000\360k\201\273\367\002\000\000\007pi\302\367\002\000\000\254s"
+ "\221\311\367\002\000\000\334v\361\320\367\002\000\000\225y~\330\367\002\000"
+ "\000\322{6\340\367\002\000\000\223}\014\350\367\002\000\000\324~\371\357"
+ "\367\002\000\000\225\177\371\367\367\002\000\000\325\177\377\377\367\002"
+ "\000\000\225\177\007\010\367\002\000\000\324~\005\020\367\002\000\000\223"
+ "}\364\027\367\002\000\000\322{\312\037\367\002\000\000\225y\200'\367\002"
+ "\000\000\334v\017/\367\002\000\000\254so6\367\002\000\000\007p\225=\367\002"
+ "\000\000\360k\177D\367\002\000\000lg$K\367\002\000\000\177b}Q\367\002\000"
+ "\000/]\202W\367\002\000\000\202W/]\367\002\000\000}Q\177b\367\002\000\000"
+ "$Klg\367\002\000\000\177D\360k\367\002\000\000\225=\007p\367\002\000\000"
+ "o6\254s\367\002\000\000\017/\334v\367\002\000\000\200'\225y\367\002\000\000"
+ "\312\037\322{\367\002\000\000\364\027\223}\367\002\000\000\005\020\324~\367"
+ "\002\000\000\007\010\225\177\367\002\000\000\377\377\325\177\367\002\000"
+ "\000\371\367\225\177\367\002\000\000\371\357\324~\367\002\000\000\014\350"
+ "\223}\367\002\000\0006\340\322{\367\002\000\000~\330\225y\367\002\000\000"
+ "\361\320\334v\367\002\000\000\221\311\254s\367\002\000\000i\302\007p\367"
+ "\002\000\000\201\273\360k\367\002\000\000\334\264lg\367\002\000\000\203\256"
+ "\177b\367\002\000\000~\250/]\367\002\000\000\317\242\202W\367\002\000\000"
+ "\177\235}Q\367\002\000\000\222\230$K\367\002\000\000\020\224\177D\367\002"
+ "\000\000\371\217\225=\367\002\000\000T\214o6\367\002\000\000$\211\017/\367"
+ "\002\000\000k\206\200'\367\002\000\000,\204\312\037\367\002\000\000m\202"
+ "\364\027\367\002\000\000,\201\005\020\367\002\000\000i\200\007\010\367\002"
+ "\000\000)\200\377\377\367\002\000\000i\200\371\367\367\002\000\000,\201\371"
+ "\357\367\002\000\000m\202\014\350\367\002\000\000,\2046\340\367\002\000\000"
+ "\257\206\224\330\017\004\000\000r\204G\340\017\004\000\000f\211\011\321\017"
+ "\004\000\000\224\214\260\311\017\004\000\0008\220\215\302\017\004\000\000"
+ "M\224\246\273\017\004\000\000\315\230\006\265\017\004\000\000\267\235\261"
+ "\256\017\004\000\000\004\243\255\250\017\004\000\000\255\250\004\243\017"
+ "\004\000\000\261\256\267\235\017\004\000\000\006\265\315\230\017\004\000"
+ "\000\246\273M\224\017\004\000\000\215\3028\220\017\004\000\000\260\311\224"
+ "\214\017\004\000\000\011\321f\211\017\004\000\000\224\330\257\206\017\004"
+ "\000\000G\340r\204\017\004\000\000\030\350\263\202\017\004\000\000\003\360"
+ "q\201\017\004\000\000\375\367\261\200\017\004\000\000\377\377p\200\017\004"
+ "\000\000\003\010\261\200\017\004\000\000\375\017q\201\017\004\000\000\346"
+ "\027\263\202\017\004\000\000\271\037r\204\017\004\000\000j'\257\206\017\004"
+ "\000\000\365.f\211\017\004\000\000P6\224\214\017\004\000\000s=8\220\017\004"
+ "\000\000ZDM\224\017\004\000\000\372J\315\230\017\004\000\000OQ\267\235\017"
+ "\004\000\000QW\004\243\017\004\000\000\374\134\255\250\017\004\000\000Ib"
+ "\261\256\017\004\000\0003g\006\265\017\004\000\000\263k\246\273\017\004\000"
+ "\000\310o\215\302\017\004\000\000ls\260\311\017\004\000\000\232v\011\321"
+ "\017\004\000\000Qy\224\330\017\004\000\000\216{G\340\017\004\000\000L}\030"
+ "\350\017\004\000\000\215~\003\360\017\004\000\000M\177\375\367\017\004\000"
+ "\000\216\177\377\377\017\004\000\000M\177\003\010\017\004\000\000\215~\375"
+ "\017\017\004\000\000L}\346\027\017\004\000\000\216{\271\037\017\004\000\000"
+ "Qyj'\017\004\000\000\232v\365.\017\004\000\000lsP6\017\004\000\000\310os"
+ "=\017\004\000\000\263kZD\017\004\000\0003g\372J\017\004\000\000IbOQ\017\004"
+ "\000\000\374\134QW\017\004\000\000QW\374\134\017\004\000\000OQIb\017\004"
+ "\000\000\372J3g\017\004\000\000ZD\263k\017\004\000\000s=\310o\017\004\000"
+ "\000P6ls\017\004\000\000\365.\232v\017\004\000\000j'Qy\017\004\000\000\271"
+ "\037\216{\017\004\000\000\346\027L}\017\004\000\000\375\017\215~\017\004"
+ "\000\000\003\010M\177\017\004\000\000\377\377\216\177\017\004\000\000\375"
+ "\367M\177\017\004\000\000\003\360\215~\017\004\000\000\030\350L}\017\004"
+ "\000\000G\340\216{\017\004\000\000\224\330Qy\017\004\000\000\011\321\232"
+ "v\017\004\000\000\260\311ls\017\004\000\000\215\302\310o\017\004\000\000"
+ "\246\273\263k\017\004\000\000\006\2653g\017\004\000\000\261\256Ib\017\004"
+ "\000\000\255\250\374\134\017\004\000\000\004\243QW\017\004\000\000\267\235"
+ "OQ\017\004\000\000\315\230\372J\017\004\000\000M\224ZD\017\004\000\0008\220"
+ "s=\017\004\000\000\224\214P6\017\004\000\000f\211\365.\017\004\000\000\257"
+ "\206j'\017\004\000\000r\204\271\037\017\004\000\000\263\202\346\027\017\004"
+ "\000\000q\201\375\017\017\004\000\000\261\200\003\010\017\004\000\000p\200"
+ "\377\377\017\004\000\000\261\200\375\367\017\004\000\000q\201\003\360\017"
+ "\004\000\000\263\202\030\350\017\004\000\000\330\204a\340\035\005\000\000"
+ "\031\203,\350\035\005\000\000\023\207\264\330\035\005\000\000\306\2111\321"
+ "\035\005\000\000\363\214\333\311\035\005\000\000\222\220\276\302\035\005"
+ "\000\000\243\224\335\273\035\005\000\000\042\231B\265\035\005\000\000\007"
+ "\236\363\256\035\005\000\000O\243\365\250\035\005\000\000\365\250O\243\035"
+ "\005\000\000\363\256\007\236\035\005\000\000B\265\042\231\035\005\000\000"
+ "\335\273\243\224\035\005\000\000\276\302\222\220\035\005\000\000\333\311"
+ "\363\214\035\005\000\0001\321\306\211\035\005\000\000\264\330\023\207\035"
+ "\005\000\000a\340\330\204\035\005\000\000,\350\031\203\035\005\000\000\020"
+ "\360\331\201\035\005\000\000\003\370\031\201\035\005\000\000\377\377\330"
+ "\200\035\005\000\000\373\007\031\201\035\005\000\000\360\017\331\201\035"
+ "\005\000\000\324\027\031\203\035\005\000\000\237\037\330\204\035\005\000"
+ "\000J'\023\207\035\005\000\000\317.\306\211\035\005\000\000#6\363\214\035"
+ "\005\000\000@=\222\220\035\005\000\000!D\243\224\035\005\000\000\274J\042"
+ "\231\035\005\000\000\015Q\007\236\035\005\000\000\011WO\243\035\005\000\000"
+ "\261\134\365\250\035\005\000\000\371a\363\256\035\005\000\000\336fB\265\035"
+ "\005\000\000[k\335\273\035\005\000\000lo\276\302\035\005\000\000\015s\333"
+ "\311\035\005\000\000:v1\321\035\005\000\000\355x\264\330\035\005\000\000"
+ "({a\340\035\005\000\000\345|,\350\035\005\000\000%~\020\360\035\005\000\000"
+ "\345~\003\370\035\005\000\000&\177\377\377\035\005\000\000\345~\373\007\035"
+ "\005\000\000%~\360\017\035\005\000\000\345|\324\027\035\005\000\000({\237"
+ "\037\035\005\000\000\355xJ'\035\005\000\000:v\317.\035\005\000\000\015s#"
+ "6\035\005\000\000lo@=\035\005\000\000[k!D\035\005\000\000\336f\274J\035\005"
+ "\000\000\371a\015Q\035\005\000\000\261\134\011W\035\005\000\000\011W\261"
+ "\134\035\005\000\000\015Q\371a\035\005\000\000\274J\336f\035\005\000\000"
+ "!D[k\035\005\000\000@=lo\035\005\000\000#6\015s\035\005\000\000\317.:v\035"
+ "\005\000\000J'\355x\035\005\000\000\237\037({\035\005\000\000\324\027\345"
+ "|\035\005\000\000\360\017%~\035\005\000\000\373\007\345~\035\005\000\000"
+ "\377\377&\177\035\005\000\000\003\370\345~\035\005\000\000\020\360%~\035"
+ "\005\000\000,\350\345|\035\005\000\000a\340({\035\005\000\000\264\330\355"
+ "x\035\005\000\0001\321:v\035\005\000\000\333\311\015s\035\005\000\000\276"
+ "\302lo\035\005\000\000\335\273[k\035\005\000\000B\265\336f\035\005\000\000"
+ "\363\256\371a\035\005\000\000\365\250\261\134\035\005\000\000O\243\011W\035"
+ "\005\000\000\007\236\015Q\035\005\000\000\042\231\274J\035\005\000\000\243"
+ "\224!D\035\005\000\000\222\220@=\035\005\000\000\363\214#6\035\005\000\000"
+ "\306\211\317.\035\005\000\000\023\207J'\035\005\000\000\330\204\237\037\035"
+ "\005\000\000\031\203\324\027\035\005\000\000\331\201\360\017\035\005\000"
+ "\000\031\201\373\007\035\005\000\000\330\200\377\377\035\005\000\000\031"
+ "\201\003\370\035\005\000\000\331\201\020\360\035\005\000\000\237\203E\350"
+ "\036\006\000\000_\202!\360\036\006\000\000[\205\203\340\036\006\000\000\223"
+ "\207\340\330\036\006\000\000E\212b\321\036\006\000\000n\215\026\312\036\006"
+ "\000\000\011\221\000\303\036\006\000\000\027\225'\274\036\006\000\000\220"
+ "\231\223\265\036\006\000\000p\236J\257\036\006\000\000\262\243Q\251\036\006"
+ "\000\000Q\251\262\243\036\006\000\000J\257p\236\036\006\000\000\223\265\220"
+ "\231\036\006\000\000'\274\027\225\036\006\000\000\000\303\011\221\036\006"
+ "\000\000\026\312n\215\036\006\000\000b\321E\212\036\006\000\000\340\330\223"
+ "\207\036\006\000\000\203\340[\205\036\006\000\000E\350\237\203\036\006\000"
+ "\000!\360_\202\036\006\000\000\014\370\241\201\036\006\000\000\377\377`\201"
+ "\036\006\000\000\364\007\241\201\036\006\000\000\337\017_\202\036\006\000"
+ "\000\271\027\237\203\036\006\000\000}\037[\205\036\006\000\000 '\223\207"
+ "\036\006\000\000\234.E\212\036\006\000\000\3505n\215\036\006\000\000\000"
+ "=\011\221\036\006\000\000\331C\027\225\036\006\000\000mJ\220\231\036\006"
+ "\000\000\266Pp\236\036\006\000\000\255V\262\243\036\006\000\000L\134Q\251"
+ "\036\006\000\000\220aJ\257\036\006\000\000pf\223\265\036\006\000\000\351"
+ "j'\274\036\006\000\000\365n\000\303\036\006\000\000\222r\026\312\036\006"
+ "\000\000\273ub\321\036\006\000\000mx\340\330\036\006\000\000\243z\203\340"
+ "\036\006\000\000a|E\350\036\006\000\000\237}!\360\036\006\000\000_~\014\370"
+ "\036\006\000\000\236~\377\377\036\006\000\000_~\364\007\036\006\000\000\237"
+ "}\337\017\036\006\000\000a|\271\027\036\006\000\000\243z}\037\036\006\000"
+ "\000mx '\036\006\000\000\273u\234.\036\006\000\000\222r\3505\036\006\000"
+ "\000\365n\000=\036\006\000\000\351j\331C\036\006\000\000pfmJ\036\006\000"
+ "\000\220a\266P\036\006\000\000L\134\255V\036\006\000\000\255VL\134\036\006"
+ "\000\000\266P\220a\036\006\000\000mJpf\036\006\000\000\331C\351j\036\006"
+ "\000\000\000=\365n\036\006\000\000\3505\222r\036\006\000\000\234.\273u\036"
+ "\006\000\000 'mx\036\006\000\000}\037\243z\036\006\000\000\271\027a|\036"
+ "\006\000\000\337\017\237}\036\006\000\000\364\007_~\036\006\000\000\377\377"
+ "\236~\036\006\000\000\014\370_~\036\006\000\000!\360\237}\036\006\000\000"
+ "E\350a|\036\006\000\000\203\340\243z\036\006\000\000\340\330mx\036\006\000"
+ "\000b\321\273u\036\006\000\000\026\312\222r\036\006\000\000\000\303\365n"
+ "\036\006\000\000'\274\351j\036\006\000\000\223\265pf\036\006\000\000J\257"
+ "\220a\036\006\000\000Q\251L\134\036\006\000\000\262\243\255V\036\006\000"
+ "\000p\236\266P\036\006\000\000\220\231mJ\036\006\000\000\027\225\331C\036"
+ "\006\000\000\011\221\000=\036\006\000\000n\215\3505\036\006\000\000E\212"
+ "\234.\036\006\000\000\223\207 '\036\006\000\000[\205}\037\036\006\000\000"
+ "\237\203\271\027\036\006\000\000_\202\337\017\036\006\000\000\241\201\364"
+ "\007\036\006\000\000`\201\377\377\036\006\000\000\241\201\014\370\036\006"
+ "\000\000\004\2036\360\014\007\000\000E\202\026\370\014\007\000\000A\204e"
+ "\350\014\007\000\000\373\205\253\340\014\007\000\0000\210\021\331\014\007"
+ "\000\000\336\212\237\321\014\007\000\000\003\216\134\312\014\007\000\000"
+ "\233\221O\303\014\007\000\000\243\225\200\274\014\007\000\000\026\232\364"
+ "\265\014\007\000\000\357\236\264\257\014\007\000\000+\244\303\251\014\007"
+ "\000\000\303\251+\244\014\007\000\000\264\257\357\236\014\007\000\000\364"
+ "\265\026\232\014\007\000\000\200\274\243\225\014\007\000\000O\303\233\221"
+ "\014\007\000\000\134\312\003\216\014\007\000\000\237\321\336\212\014\007"
+ "\000\000\021\3310\210\014\007\000\000\253\340\373\205\014\007\000\000e\350"
+ "A\204\014\007\000\0006\360\004\203\014\007\000\000\026\370E\202\014\007\000"
+ "\000\377\377\007\202\014\007\000\000\350\007E\202\014\007\000\000\312\017"
+ "\004\203\014\007\000\000\233\027A\204\014\007\000\000S\037\373\205\014\007"
+ "\000\000\355&0\210\014\007\000\000_.\336\212\014\007\000\000\2425\003\216"
+ "\014\007\000\000\261<\233\221\014\007\000\000\200C\243\225\014\007\000\000"
+ "\014J\026\232\014\007\000\000LP\357\236\014\007\000\000;V+\244\014\007\000"
+ "\000\325[\303\251\014\007\000\000\021a\264\257\014\007\000\000\352e\364\265"
+ "\014\007\000\000]j\200\274\014\007\000\000enO\303\014\007\000\000\373q\134"
+ "\312\014\007\000\000 u\237\321\014\007\000\000\320w\021\331\014\007\000\000"
+ "\005z\253\340\014\007\000\000\277{e\350\014\007\000\000\372|6\360\014\007"
+ "\000\000\271}\026\370\014\007\000\000\371}\377\377\014\007\000\000\271}\350"
+ "\007\014\007\000\000\372|\312\017\014\007\000\000\277{\233\027\014\007\000"
+ "\000\005zS\037\014\007\000\000\320w\355&\014\007\000\000 u_.\014\007\000"
+ "\000\373q\2425\014\007\000\000en\261<\014\007\000\000]j\200C\014\007\000"
+ "\000\352e\014J\014\007\000\000\021aLP\014\007\000\000\325[;V\014\007\000"
+ "\000;V\325[\014\007\000\000LP\021a\014\007\000\000\014J\352e\014\007\000"
+ "\000\200C]j\014\007\000\000\261<en\014\007\000\000\2425\373q\014\007\000"
+ "\000_. u\014\007\000\000\355&\320w\014\007\000\000S\037\005z\014\007\000"
+ "\000\233\027\277{\014\007\000\000\312\017\372|\014\007\000\000\350\007\271"
+ "}\014\007\000\000\377\377\371}\014\007\000\000\026\370\271}\014\007\000\000"
+ "6\360\372|\014\007\000\000e\350\277{\014\007\000\000\253\340\005z\014\007"
+ "\000\000\021\331\320w\014\007\000\000\237\321 u\014\007\000\000\134\312\373"
+ "q\014\007\000\000O\303en\014\007\000\000\200\274]j\014\007\000\000\364\265"
+ "\352e\014\007\000\000\264\257\021a\014\007\000\000\303\251\325[\014\007\000"
+ "\000+\244;V\014\007\000\000\357\236LP\014\007\000\000\026\232\014J\014\007"
+ "\000\000\243\225\200C\014\007\000\000\233\221\261<\014\007\000\000\003\216"
+ "\2425\014\007\000\000\336\212_.\014\007\000\0000\210\355&\014\007\000\000"
+ "\373\205S\037\014\007\000\000A\204\233\027\014\007\000\000\004\203\312\017"
+ "\014\007\000\000E\202\350\007\014\007\000\000\007\202\377\377\014\007\000"
+ "\000\006\203#\370\346\007\000\000\305\202\377\377\346\007\000\000\303\203"
+ "N\360\346\007\000\000\376\204\211\350\346\007\000\000\264\206\334\340\346"
+ "\007\000\000\347\210M\331\346\007\000\000\222\213\347\321\346\007\000\000"
+ "\261\216\257\312\346\007\000\000C\222\254\303\346\007\000\000E\226\346\274"
+ "\346\007\000\000\261\232e\266\346\007\000\000\202\237.\260\346\007\000\000"
+ "\266\244G\252\346\007\000\000G\252\266\244\346\007\000\000.\260\202\237\346"
+ "\007\000\000e\266\261\232\346\007\000\000\346\274E\226\346\007\000\000\254"
+ "\303C\222\346\007\000\000\257\312\261\216\346\007\000\000\347\321\222\213"
+ "\346\007\000\000M\331\347\210\346\007\000\000\334\340\264\206\346\007\000"
+ "\000\211\350\376\204\346\007\000\000N\360\303\203\346\007\000\000#\370\006"
+ "\203\346\007\000\000\377\377\305\202\346\007\000\000\335\007\006\203\346"
+ "\007\000\000\262\017\303\203\346\007\000\000w\027\376\204\346\007\000\000"
+ "$\037\264\206\346\007\000\000\263&\347\210\346\007\000\000\031.\222\213\346"
+ "\007\000\000Q5\261\216\346\007\000\000T<C\222\346\007\000\000\031CE\226\346"
+ "\007\000\000\233I\261\232\346\007\000\000\322O\202\237\346\007\000\000\271"
+ "U\266\244\346\007\000\000H[G\252\346\007\000\000|`.\260\346\007\000\000O"
+ "ee\266\346\007\000\000\273i\346\274\346\007\000\000\273m\254\303\346\007"
+ "\000\000Mq\257\312\346\007\000\000nt\347\321\346\007\000\000\031wM\331\346"
+ "\007\000\000Jy\334\340\346\007\000\000\002{\211\350\346\007\000\000;|N\360"
+ "\346\007\000\000\372|#\370\346\007\000\0009}\377\377\346\007\000\000\372"
+ "|\335\007\346\007\000\000;|\262\017\346\007\000\000\002{w\027\346\007\000"
+ "\000Jy$\037\346\007\000\000\031w\263&\346\007\000\000nt\031.\346\007\000"
+ "\000MqQ5\346\007\000\000\273mT<\346\007\000\000\273i\031C\346\007\000\000"
+ "Oe\233I\346\007\000\000|`\322O\346\007\000\000H[\271U\346\007\000\000\271"
+ "UH[\346\007\000\000\322O|`\346\007\000\000\233IOe\346\007\000\000\031C\273"
+ "i\346\007\000\000T<\273m\346\007\000\000Q5Mq\346\007\000\000\031.nt\346\007"
+ "\000\000\263&\031w\346\007\000\000$\037Jy\346\007\000\000w\027\002{\346\007"
+ "\000\000\262\017;|\346\007\000\000\335\007\372|\346\007\000\000\377\3779"
+ "}\346\007\000\000#\370\372|\346\007\000\000N\360;|\346\007\000\000\211\350"
+ "\002{\346\007\000\000\334\340Jy\346\007\000\000M\331\031w\346\007\000\000"
+ "\347\321nt\346\007\000\000\257\312Mq\346\007\000\000\254\303\273m\346\007"
+ "\000\000\346\274\273i\346\007\000\000e\266Oe\346\007\000\000.\260|`\346\007"
+ "\000\000G\252H[\346\007\000\000\266\244\271U\346\007\000\000\202\237\322"
+ "O\346\007\000\000\261\232\233I\346\007\000\000E\226\031C\346\007\000\000"
+ "C\222T<\346\007\000\000\261\216Q5\346\007\000\000\222\213\031.\346\007\000"
+ "\000\347\210\263&\346\007\000\000\264\206$\037\346\007\000\000\376\204w\027"
+ "\346\007\000\000\303\203\262\017\346\007\000\000\006\203\335\007\346\007"
+ "\000\000\237\203\377\377\244\010\000\000\335\203\316\007\244\010\000\000"
+ "\335\2030\370\244\010\000\000\232\204i\360\244\010\000\000\324\205\261\350"
+ "\244\010\000\000\210\207\021\341\244\010\000\000\265\211\220\331\244\010"
+ "\000\000Z\2146\322\244\010\000\000u\217\011\313\244\010\000\000\002\223\024"
+ "\304\244\010\000\000\374\226[\275\244\010\000\000`\233\344\266\244\010\000"
+ "\000+\240\270\260\244\010\000\000U\245\332\252\244\010\000\000\332\252U\245"
+ "\244\010\000\000\270\260+\240\244\010\000\000\344\266`\233\244\010\000\000"
+ "[\275\374\226\244\010\000\000\024\304\002\223\244\010\000\000\011\313u\217"
+ "\244\010\000\0006\322Z\214\244\010\000\000\220\331\265\211\244\010\000\000"
+ "\021\341\210\207\244\010\000\000\261\350\324\205\244\010\000\000i\360\232"
+ "\204\244\010\000\0000\370\335\203\244\010\000\000\377\377\237\203\244\010"
+ "\000\000\316\007\335\203\244\010\000\000\227\017\232\204\244\010\000\000"
+ "M\027\324\205\244\010\000\000\357\036\210\207\244\010\000\000o&\265\211\244"
+ "\010\000\000\310-Z\214\244\010\000\000\3654u\217\244\010\000\000\352;\002"
+ "\223\244\010\000\000\245B\374\226\244\010\000\000\032I`\233\244\010\000\000"
+ "HO+\240\244\010\000\000$UU\245\244\010\000\000\253Z\332\252\244\010\000\000"
+ "\325_\270\260\244\010\000\000\240d\344\266\244\010\000\000\004i[\275\244"
+ "\010\000\000\376l\024\304\244\010\000\000\213p\011\313\244\010\000\000\244"
+ "s6\322\244\010\000\000Kv\220\331\244\010\000\000xx\021\341\244\010\000\000"
+ ",z\261\350\244\010\000\000f{i\360\244\010\000\000!|0\370\244\010\000\000"
+ "a|\377\377\244\010\000\000!|\316\007\244\010\000\000f{\227\017\244\010\000"
+ "\000,zM\027\244\010\000\000xx\357\036\244\010\000\000Kvo&\244\010\000\000"
+ "\244s\310-\244\010\000\000\213p\3654\244\010\000\000\376l\352;\244\010\000"
+ "\000\004i\245B\244\010\000\000\240d\032I\244\010\000\000\325_HO\244\010\000"
+ "\000\253Z$U\244\010\000\000$U\253Z\244\010\000\000HO\325_\244\010\000\000"
+ "\032I\240d\244\010\000\000\245B\004i\244\010\000\000\352;\376l\244\010\000"
+ "\000\3654\213p\244\010\000\000\310-\244s\244\010\000\000o&Kv\244\010\000"
+ "\000\357\036xx\244\010\000\000M\027,z\244\010\000\000\227\017f{\244\010\000"
+ "\000\316\007!|\244\010\000\000\377\377a|\244\010\000\0000\370!|\244\010\000"
+ "\000i\360f{\244\010\000\000\261\350,z\244\010\000\000\021\341xx\244\010\000"
+ "\000\220\331Kv\244\010\000\0006\322\244s\244\010\000\000\011\313\213p\244"
+ "\010\000\000\024\304\376l\244\010\000\000[\275\004i\244\010\000\000\344\266"
+ "\240d\244\010\000\000\270\260\325_\244\010\000\000\332\252\253Z\244\010\000"
+ "\000U\245$U\244\010\000\000+\240HO\244\010\000\000`\233\032I\244\010\000"
+ "\000\374\226\245B\244\010\000\000\002\223\352;\244\010\000\000u\217\3654"
+ "\244\010\000\000Z\214\310-\244\010\000\000\265\211o&\244\010\000\000\210"
+ "\207\357\036\244\010\000\000\324\205M\027\244\010\000\000\232\204\227\017"
+ "\244\010\000\000\313\204\301\007K\011\000\000\206\205y\017K\011\000\000\215"
+ "\204\377\377K\011\000\000\313\204\077\370K\011\000\000\206\205\207\360K\011"
+ "\000\000\274\206\336\350K\011\000\000o\210L\341K\011\000\000\230\212\331"
+ "\331K\011\000\0009\215\217\322K\011\000\000M\220o\313K\011\000\000\322\223"
+ "\207\304K\011\000\000\305\227\331\275K\011\000\000!\234p\267K\011\000\000"
+ "\342\240O\261K\011\000\000\003\246\177\253K\011\000\000\177\253\003\246K"
+ "\011\000\000O\261\342\240K\011\000\000p\267!\234K\011\000\000\331\275\305"
+ "\227K\011\000\000\207\304\322\223K\011\000\000o\313M\220K\011\000\000\217"
+ "\3229\215K\011\000\000\331\331\230\212K\011\000\000L\341o\210K\011\000\000"
+ "\336\350\274\206K\011\000\000\207\360\206\205K\011\000\000\077\370\313\204"
+ "K\011\000\000\377\377\215\204K\011\000\000\301\007\313\204K\011\000\000y"
+ "\017\206\205K\011\000\000\042\027\274\206K\011\000\000\263\036o\210K\011"
+ "\000\000%&\230\212K\011\000\000q-9\215K\011\000\000\2174M\220K\011\000\000"
+ "y;\322\223K\011\000\000%B\305\227K\011\000\000\217H!\234K\011\000\000\261"
+ "N\342\240K\011\000\000\201T\003\246K\011\000\000\375Y\177\253K\011\000\000"
+ "\036_O\261K\011\000\000\337cp\267K\011\000\000;h\331\275K\011\000\000,l\207"
+ "\304K\011\000\000\263oo\313K\011\000\000\307r\217\322K\011\000\000hu\331"
+ "\331K\011\000\000\221wL\341K\011\000\000By\336\350K\011\000\000zz\207\360"
+ "K\011\000\0005{\077\370K\011\000\000s{\377\377K\011\000\0005{\301\007K\011"
+ "\000\000zzy\017K\011\000\000By\042\027K\011\000\000\221w\263\036K\011\000"
+ "\000hu%&K\011\000\000\307rq-K\011\000\000\263o\2174K\011\000\000,ly;K\011"
+ "\000\000;h%BK\011\000\000\337c\217HK\011\000\000\036_\261NK\011\000\000\375"
+ "Y\201TK\011\000\000\201T\375YK\011\000\000\261N\036_K\011\000\000\217H\337"
+ "cK\011\000\000%B;hK\011\000\000y;,lK\011\000\000\2174\263oK\011\000\000q"
+ "-\307rK\011\000\000%&huK\011\000\000\263\036\221wK\011\000\000\042\027By"
+ "K\011\000\000y\017zzK\011\000\000\301\0075{K\011\000\000\377\377s{K\011\000"
+ "\000\077\3705{K\011\000\000\207\360zzK\011\000\000\336\350ByK\011\000\000"
+ "L\341\221wK\011\000\000\331\331huK\011\000\000\217\322\307rK\011\000\000"
+ "o\313\263oK\011\000\000\207\304,lK\011\000\000\331\275;hK\011\000\000p\267"
+ "\337cK\011\000\000O\261\036_K\011\000\000\177\253\375YK\011\000\000\003\246"
+ "\201TK\011\000\000\342\240\261NK\011\000\000!\234\217HK\011\000\000\305\227"
+ "%BK\011\000\000\322\223y;K\011\000\000M\220\2174K\011\000\0009\215q-K\011"
+ "\000\000\230\212%&K\011\000\000o\210\263\036K\011\000\000\274\206\042\027"
+ "K\011\000\000\203\206Y\017\323\011\000\000\267\207\361\026\323\011\000\000"
+ "\312\205\260\007\323\011\000\000\216\205\377\377\323\011\000\000\312\205"
+ "P\370\323\011\000\000\203\206\247\360\323\011\000\000\267\207\015\351\323"
+ "\011\000\000f\211\214\341\323\011\000\000\214\213)\332\323\011\000\000'\216"
+ "\353\322\323\011\000\0005\221\335\313\323\011\000\000\263\224\002\305\323"
+ "\011\000\000\234\230c\276\323\011\000\000\357\234\007\270\323\011\000\000"
+ "\246\241\362\261\323\011\000\000\274\246,\254\323\011\000\000,\254\274\246"
+ "\323\011\000\000\362\261\246\241\323\011\000\000\007\270\357\234\323\011"
+ "\000\000c\276\234\230\323\011\000\000\002\305\263\224\323\011\000\000\335"
+ "\3135\221\323\011\000\000\353\322'\216\323\011\000\000)\332\214\213\323\011"
+ "\000\000\214\341f\211\323\011\000\000\015\351\267\207\323\011\000\000\247"
+ "\360\203\206\323\011\000\000P\370\312\205\323\011\000\000\377\377\216\205"
+ "\323\011\000\000\260\007\312\205\323\011\000\000Y\017\203\206\323\011\000"
+ "\000\361\026\267\207\323\011\000\000t\036f\211\323\011\000\000\325%\214\213"
+ "\323\011\000\000\023-'\216\323\011\000\000#45\221\323\011\000\000\374:\263"
+ "\224\323\011\000\000\235A\234\230\323\011\000\000\371G\357\234\323\011\000"
+ "\000\014N\246\241\323\011\000\000\322S\274\246\323\011\000\000BY,\254\323"
+ "\011\000\000Z^\362\261\323\011\000\000\017c\007\270\323\011\000\000bgc\276"
+ "\323\011\000\000Mk\002\305\323\011\000\000\313n\335\313\323\011\000\000\331"
+ "q\353\322\323\011\000\000tt)\332\323\011\000\000\232v\214\341\323\011\000"
+ "\000Gx\015\351\323\011\000\000{y\247\360\323\011\000\0004zP\370\323\011\000"
+ "\000rz\377\377\323\011\000\0004z\260\007\323\011\000\000{yY\017\323\011\000"
+ "\000Gx\361\026\323\011\000\000\232vt\036\323\011\000\000tt\325%\323\011\000"
+ "\000\331q\023-\323\011\000\000\313n#4\323\011\000\000Mk\374:\323\011\000"
+ "\000bg\235A\323\011\000\000\017c\371G\323\011\000\000Z^\014N\323\011\000"
+ "\000BY\322S\323\011\000\000\322SBY\323\011\000\000\014NZ^\323\011\000\000"
+ "\371G\017c\323\011\000\000\235Abg\323\011\000\000\374:Mk\323\011\000\000"
+ "#4\313n\323\011\000\000\023-\331q\323\011\000\000\325%tt\323\011\000\000"
+ "t\036\232v\323\011\000\000\361\026Gx\323\011\000\000Y\017{y\323\011\000\000"
+ "\260\0074z\323\011\000\000\377\377rz\323\011\000\000P\3704z\323\011\000\000"
+ "\247\360{y\323\011\000\000\015\351Gx\323\011\000\000\214\341\232v\323\011"
+ "\000\000)\332tt\323\011\000\000\353\322\331q\323\011\000\000\335\313\313"
+ "n\323\011\000\000\002\305Mk\323\011\000\000c\276bg\323\011\000\000\007\270"
+ "\017c\323\011\000\000\362\261Z^\323\011\000\000,\254BY\323\011\000\000\274"
+ "\246\322S\323\011\000\000\246\241\014N\323\011\000\000\357\234\371G\323\011"
+ "\000\000\234\230\235A\323\011\000\000\263\224\374:\323\011\000\0005\221#"
+ "4\323\011\000\000'\216\023-\323\011\000\000\214\213\325%\323\011\000\000"
+ "f\211t\036\323\011\000\000\302\210\276\026;\012\000\000k\2120\036;\012\000"
+ "\000\220\2077\017;\012\000\000\330\206\237\007;\012\000\000\234\206\377\377"
+ ";\012\000\000\330\206_\370;\012\000\000\220\207\311\360;\012\000\000\302"
+ "\210@\351;\012\000\000k\212\320\341;\012\000\000\215\214|\332;\012\000\000"
+ "\042\217O\323;\012\000\000)\222P\314;\012\000\000\237\225\204\305;\012\000"
+ "\000\201\231\365\276;\012\000\000\312\235\245\270;\012\000\000v\242\236\262"
+ ";\012\000\000\202\247\346\254;\012\000\000\346\254\202\247;\012\000\000\236"
+ "\262v\242;\012\000\000\245\270\312\235;\012\000\000\365\276\201\231;\012"
+ "\000\000\204\305\237\225;\012\000\000P\314)\222;\012\000\000O\323\042\217"
+ ";\012\000\000|\332\215\214;\012\000\000\320\341k\212;\012\000\000@\351\302"
+ "\210;\012\000\000\311\360\220\207;\012\000\000_\370\330\206;\012\000\000"
+ "\377\377\234\206;\012\000\000\237\007\330\206;\012\000\0007\017\220\207;"
+ "\012\000\000\276\026\302\210;\012\000\0000\036k\212;\012\000\000\202%\215"
+ "\214;\012\000\000\261,\042\217;\012\000\000\2603)\222;\012\000\000z:\237"
+ "\225;\012\000\000\013A\201\231;\012\000\000[G\312\235;\012\000\000`Mv\242"
+ ";\012\000\000\031S\202\247;\012\000\000~X\346\254;\012\000\000\210]\236\262"
+ ";\012\000\0006b\245\270;\012\000\000~f\365\276;\012\000\000_j\204\305;\012"
+ "\000\000\327mP\314;\012\000\000\336pO\323;\012\000\000ss|\332;\012\000\000"
+ "\223u\320\341;\012\000\000>w@\351;\012\000\000nx\311\360;\012\000\000(y_"
+ "\370;\012\000\000dy\377\377;\012\000\000(y\237\007;\012\000\000nx7\017;\012"
+ "\000\000>w\276\026;\012\000\000\223u0\036;\012\000\000ss\202%;\012\000\000"
+ "\336p\261,;\012\000\000\327m\2603;\012\000\000_jz:;\012\000\000~f\013A;\012"
+ "\000\0006b[G;\012\000\000\210]`M;\012\000\000~X\031S;\012\000\000\031S~X"
+ ";\012\000\000`M\210];\012\000\000[G6b;\012\000\000\013A~f;\012\000\000z:"
+ "_j;\012\000\000\2603\327m;\012\000\000\261,\336p;\012\000\000\202%ss;\012"
+ "\000\0000\036\223u;\012\000\000\276\026>w;\012\000\0007\017nx;\012\000\000"
+ "\237\007(y;\012\000\000\377\377dy;\012\000\000_\370(y;\012\000\000\311\360"
+ "nx;\012\000\000@\351>w;\012\000\000\320\341\223u;\012\000\000|\332ss;\012"
+ "\000\000O\323\336p;\012\000\000P\314\327m;\012\000\000\204\305_j;\012\000"
+ "\000\365\276~f;\012\000\000\245\2706b;\012\000\000\236\262\210];\012\000"
+ "\000\346\254~X;\012\000\000\202\247\031S;\012\000\000v\242`M;\012\000\000"
+ "\312\235[G;\012\000\000\201\231\013A;\012\000\000\237\225z:;\012\000\000"
+ ")\222\2603;\012\000\000\042\217\261,;\012\000\000\215\214\202%;\012\000\000"
+ "{\213\352\035\202\012\000\000\227\215+%\202\012\000\000\326\211\213\026\202"
+ "\012\000\000\247\210\023\017\202\012\000\000\360\207\216\007\202\012\000"
+ "\000\264\207\377\377\202\012\000\000\360\207r\370\202\012\000\000\247\210"
+ "\353\360\202\012\000\000\326\211u\351\202\012\000\000{\213\026\342\202\012"
+ "\000\000\227\215\323\332\202\012\000\000'\220\267\323\202\012\000\000&\223"
+ "\307\314\202\012\000\000\224\226\014\306\202\012\000\000o\232\212\277\202"
+ "\012\000\000\255\236J\271\202\012\000\000O\243Q\263\202\012\000\000N\250"
+ "\246\255\202\012\000\000\246\255N\250\202\012\000\000Q\263O\243\202\012\000"
+ "\000J\271\255\236\202\012\000\000\212\277o\232\202\012\000\000\014\306\224"
+ "\226\202\012\000\000\307\314&\223\202\012\000\000\267\323'\220\202\012\000"
+ "\000\323\332\227\215\202\012\000\000\026\342{\213\202\012\000\000u\351\326"
+ "\211\202\012\000\000\353\360\247\210\202\012\000\000r\370\360\207\202\012"
+ "\000\000\377\377\264\207\202\012\000\000\216\007\360\207\202\012\000\000"
+ "\023\017\247\210\202\012\000\000\213\026\326\211\202\012\000\000\352\035"
+ "{\213\202\012\000\000+%\227\215\202\012\000\000I,'\220\202\012\000\00073"
+ "&\223\202\012\000\000\3649\224\226\202\012\000\000t@o\232\202\012\000\000"
+ "\264F\255\236\202\012\000\000\255LO\243\202\012\000\000XRN\250\202\012\000"
+ "\000\262W\246\255\202\012\000\000\261\134Q\263\202\012\000\000QaJ\271\202"
+ "\012\000\000\221e\212\277\202\012\000\000ji\014\306\202\012\000\000\330l"
+ "\307\314\202\012\000\000\331o\267\323\202\012\000\000ir\323\332\202\012\000"
+ "\000\203t\026\342\202\012\000\000*vu\351\202\012\000\000Yw\353\360\202\012"
+ "\000\000\016xr\370\202\012\000\000Lx\377\377\202\012\000\000\016x\216\007"
+ "\202\012\000\000Yw\023\017\202\012\000\000*v\213\026\202\012\000\000\203"
+ "t\352\035\202\012\000\000ir+%\202\012\000\000\331oI,\202\012\000\000\330"
+ "l73\202\012\000\000ji\3649\202\012\000\000\221et@\202\012\000\000Qa\264F"
+ "\202\012\000\000\261\134\255L\202\012\000\000\262WXR\202\012\000\000XR\262"
+ "W\202\012\000\000\255L\261\134\202\012\000\000\264FQa\202\012\000\000t@\221"
+ "e\202\012\000\000\3649ji\202\012\000\00073\330l\202\012\000\000I,\331o\202"
+ "\012\000\000+%ir\202\012\000\000\352\035\203t\202\012\000\000\213\026*v\202"
+ "\012\000\000\023\017Yw\202\012\000\000\216\007\016x\202\012\000\000\377\377"
+ "Lx\202\012\000\000r\370\016x\202\012\000\000\353\360Yw\202\012\000\000u\351"
+ "*v\202\012\000\000\026\342\203t\202\012\000\000\323\332ir\202\012\000\000"
+ "\267\323\331o\202\012\000\000\307\314\330l\202\012\000\000\014\306ji\202"
+ "\012\000\000\212\277\221e\202\012\000\000J\271Qa\202\012\000\000Q\263\261"
+ "\134\202\012\000\000\246\255\262W\202\012\000\000N\250XR\202\012\000\000"
+ "O\243\255L\202\012\000\000\255\236\264F\202\012\000\000o\232t@\202\012\000"
+ "\000\224\226\3649\202\012\000\000&\22373\202\012\000\000'\220I,\202\012\000"
+ "\000\251\216\323$\250\012\000\0001\221\337+\250\012\000\000\222\214\242\035"
+ "\250\012\000\000\357\212T\026\250\012\000\000\305\211\357\016\250\012\000"
+ "\000\017\211{\007\250\012\000\000\323\210\377\377\250\012\000\000\017\211"
+ "\203\370\250\012\000\000\305\211\017\361\250\012\000\000\357\212\252\351"
+ "\250\012\000\000\222\214\134\342\250\012\000\000\251\216+\333\250\012\000"
+ "\0001\221!\324\250\012\000\000+\224B\315\250\012\000\000\222\227\226\306"
+ "\250\012\000\000`\233%\300\250\012\000\000\225\237\364\271\250\012\000\000"
+ ",\244\011\264\250\012\000\000 \251k\256\250\012\000\000k\256 \251\250\012"
+ "\000\000\011\264,\244\250\012\000\000\364\271\225\237\250\012\000\000%\300"
+ "`\233\250\012\000\000\226\306\222\227\250\012\000\000B\315+\224\250\012\000"
+ "\000!\3241\221\250\012\000\000+\333\251\216\250\012\000\000\134\342\222\214"
+ "\250\012\000\000\252\351\357\212\250\012\000\000\017\361\305\211\250\012"
+ "\000\000\203\370\017\211\250\012\000\000\377\377\323\210\250\012\000\000"
+ "{\007\017\211\250\012\000\000\357\016\305\211\250\012\000\000T\026\357\212"
+ "\250\012\000\000\242\035\222\214\250\012\000\000\323$\251\216\250\012\000"
+ "\000\337+1\221\250\012\000\000\2762+\224\250\012\000\000j9\222\227\250\012"
+ "\000\000\333\077`\233\250\012\000\000\014F\225\237\250\012\000\000\366K,"
+ "\244\250\012\000\000\223Q \251\250\012\000\000\340Vk\256\250\012\000\000"
+ "\324[\011\264\250\012\000\000i`\364\271\250\012\000\000\240d%\300\250\012"
+ "\000\000nh\226\306\250\012\000\000\325kB\315\250\012\000\000\315n!\324\250"
+ "\012\000\000Wq+\333\250\012\000\000ns\134\342\250\012\000\000\017u\252\351"
+ "\250\012\000\000;v\017\361\250\012\000\000\357v\203\370\250\012\000\000+"
+ "w\377\377\250\012\000\000\357v{\007\250\012\000\000;v\357\016\250\012\000"
+ "\000\017uT\026\250\012\000\000ns\242\035\250\012\000\000Wq\323$\250\012\000"
+ "\000\315n\337+\250\012\000\000\325k\2762\250\012\000\000nhj9\250\012\000"
+ "\000\240d\333\077\250\012\000\000i`\014F\250\012\000\000\324[\366K\250\012"
+ "\000\000\340V\223Q\250\012\000\000\223Q\340V\250\012\000\000\366K\324[\250"
+ "\012\000\000\014Fi`\250\012\000\000\333\077\240d\250\012\000\000j9nh\250"
+ "\012\000\000\2762\325k\250\012\000\000\337+\315n\250\012\000\000\323$Wq\250"
+ "\012\000\000\242\035ns\250\012\000\000T\026\017u\250\012\000\000\357\016"
+ ";v\250\012\000\000{\007\357v\250\012\000\000\377\377+w\250\012\000\000\203"
+ "\370\357v\250\012\000\000\017\361;v\250\012\000\000\252\351\017u\250\012"
+ "\000\000\134\342ns\250\012\000\000+\333Wq\250\012\000\000!\324\315n\250\012"
+ "\000\000B\315\325k\250\012\000\000\226\306nh\250\012\000\000%\300\240d\250"
+ "\012\000\000\364\271i`\250\012\000\000\011\264\324[\250\012\000\000k\256"
+ "\340V\250\012\000\000 \251\223Q\250\012\000\000,\244\366K\250\012\000\000"
+ "\225\237\014F\250\012\000\000`\233\333\077\250\012\000\000\222\227j9\250"
+ "\012\000\000+\224\2762\250\012\000\000\077\222s+\252\012\000\0001\225C2\252"
+ "\012\000\000\273\217z$\252\012\000\000\252\215[\035\252\012\000\000\014\214"
+ "\035\026\252\012\000\000\344\212\313\016\252\012\000\0000\212j\007\252\012"
+ "\000\000\366\211\377\377\252\012\000\0000\212\226\370\252\012\000\000\344"
+ "\2125\361\252\012\000\000\014\214\341\351\252\012\000\000\252\215\245\342"
+ "\252\012\000\000\273\217\206\333\252\012\000\000\077\222\213\324\252\012"
+ "\000\0001\225\275\315\252\012\000\000\217\230\042\307\252\012\000\000V\234"
+ "\300\300\252\012\000\000\200\240\236\272\252\012\000\000\013\245\302\264"
+ "\252\012\000\000\364\2511\257\252\012\000\0001\257\364\251\252\012\000\000"
+ "\302\264\013\245\252\012\000\000\236\272\200\240\252\012\000\000\300\300"
+ "V\234\252\012\000\000\042\307\217\230\252\012\000\000\275\3151\225\252\012"
+ "\000\000\213\324\077\222\252\012\000\000\206\333\273\217\252\012\000\000"
+ "\245\342\252\215\252\012\000\000\341\351\014\214\252\012\000\0005\361\344"
+ "\212\252\012\000\000\226\3700\212\252\012\000\000\377\377\366\211\252\012"
+ "\000\000j\0070\212\252\012\000\000\313\016\344\212\252\012\000\000\035\026"
+ "\014\214\252\012\000\000[\035\252\215\252\012\000\000z$\273\217\252\012\000"
+ "\000s+\077\222\252\012\000\000C21\225\252\012\000\000\3368\217\230\252\012"
+ "\000\000@\077V\234\252\012\000\000bE\200\240\252\012\000\000>K\013\245\252"
+ "\012\000\000\315P\364\251\252\012\000\000\014V1\257\252\012\000\000\365Z"
+ "\302\264\252\012\000\000\177_\236\272\252\012\000\000\252c\300\300\252\012"
+ "\000\000qg\042\307\252\012\000\000\317j\275\315\252\012\000\000\301m\213"
+ "\324\252\012\000\000Cp\206\333\252\012\000\000Tr\245\342\252\012\000\000"
+ "\364s\341\351\252\012\000\000\034u5\361\252\012\000\000\316u\226\370\252"
+ "\012\000\000\012v\377\377\252\012\000\000\316uj\007\252\012\000\000\034u"
+ "\313\016\252\012\000\000\364s\035\026\252\012\000\000Tr[\035\252\012\000"
+ "\000Cpz$\252\012\000\000\301ms+\252\012\000\000\317jC2\252\012\000\000qg"
+ "\3368\252\012\000\000\252c@\077\252\012\000\000\177_bE\252\012\000\000\365"
+ "Z>K\252\012\000\000\014V\315P\252\012\000\000\315P\014V\252\012\000\000>"
+ "K\365Z\252\012\000\000bE\177_\252\012\000\000@\077\252c\252\012\000\000\336"
+ "8qg\252\012\000\000C2\317j\252\012\000\000s+\301m\252\012\000\000z$Cp\252"
+ "\012\000\000[\035Tr\252\012\000\000\035\026\364s\252\012\000\000\313\016"
+ "\034u\252\012\000\000j\007\316u\252\012\000\000\377\377\012v\252\012\000"
+ "\000\226\370\316u\252\012\000\0005\361\034u\252\012\000\000\341\351\364s"
+ "\252\012\000\000\245\342Tr\252\012\000\000\206\333Cp\252\012\000\000\213"
+ "\324\301m\252\012\000\000\275\315\317j\252\012\000\000\042\307qg\252\012"
+ "\000\000\300\300\252c\252\012\000\000\236\272\177_\252\012\000\000\302\264"
+ "\365Z\252\012\000\0001\257\014V\252\012\000\000\364\251\315P\252\012\000"
+ "\000\013\245>K\252\012\000\000\200\240bE\252\012\000\000V\234@\077\252\012"
+ "\000\000\217\230\3368\252\012\000\000\317\254\335;\252\012\000\000\210\247"
+ "\3661\252\012\000\000\203\244\036'\252\012\000\000\354\243\333\033\252\012"
+ "\000\000c\244\023\025\252\012\000\000h\245\134\016\252\012\000\000\367\246"
+ "\301\007\252\012\000\000\017\251L\001\252\012\000\000\252\253\013\373\252"
+ "\012\000\000\305\256\010\365\252\012\000\000\134\262M\357\252\012\000\000"
+ "e\266\345\351\252\012\000\000\334\272\330\344\252\012\000\000\267\2772\340"
+ "\252\012\000\000\357\304\370\333\252\012\000\000|\3124\330\252\012\000\000"
+ "\314\317\302\324\252\012\000\000\374\324\034\321\252\012\000\000\011\332"
+ "D\315\252\012\000\000\355\336;\311\252\012\000\000\254\343\000\305\252\012"
+ "\000\000A\350\226\300\252\012\000\000\253\354\003\274\252\012\000\000\347"
+ "\360B\267\252\012\000\000\367\364X\262\252\012\000\000\326\370F\255\252\012"
+ "\000\000\205\374\020\250\252\012\000\000\377\377\264\242\252\012\000\000"
+ "{\003\020\250\252\012\000\000*\007F\255\252\012\000\000\010\013X\262\252"
+ "\012\000\000\027\017B\267\252\012\000\000U\023\003\274\252\012\000\000\277"
+ "\027\226\300\252\012\000\000T\034\000\305\252\012\000\000\021!;\311\252\012"
+ "\000\000\367%D\315\252\012\000\000\004+\034\321\252\012\000\00020\302\324"
+ "\252\012\000\000\20454\330\252\012\000\000\017;\370\333\252\012\000\000I"
+ "@2\340\252\012\000\000$E\330\344\252\012\000\000\233I\345\351\252\012\000"
+ "\000\244MM\357\252\012\000\000;Q\010\365\252\012\000\000VT\013\373\252\012"
+ "\000\000\361VL\001\252\012\000\000\010Y\301\007\252\012\000\000\230Z\134"
+ "\016\252\012\000\000\233[\023\025\252\012\000\000\024\134\333\033\252\012"
+ "\000\000{[\036'\252\012\000\000xX\3661\252\012\000\0001S\335;\252\012\000"
+ "\000\346KVD\252\012\000\000\367B\367J\252\012\000\000\3178jO\252\012\000"
+ "\000\360-{Q\252\012\000\000\016\322{Q\252\012\000\0001\307jO\252\012\000"
+ "\000\011\275\367J\252\012\000\000\030\264VD\252\012\000\000\344\042\013Q"
+ "\252\012\000\000\032\335\013Q\252\012\000\0004\030%N\252\012\000\000\312"
+ "\347%N\252\012\000\000g\016\353H\252\012\000\000\231\361\353H\252\012\000"
+ "\000M\006\200A\252\012\000\000\262\371\200A\252\012\000\000\377\377\3379"
+ "\252\012\000\000\376\210\342\320V\365\000\000C\206r\330V\365\000\000.\214"
+ "\200\311V\365\000\000\326\217V\302V\365\000\000\354\223j\273V\365\000\000"
+ "\000\221^\300V\365\000\000p\221\241\277V\365\000\000r\230\304\264V\365\000"
+ "\000`\235i\256V\365\000\000\261\242a\250V\365\000\000a\250\261\242V\365\000"
+ "\0001\245\337\245V\365\000\000\337\2451\245V\365\000\000i\256`\235V\365\000"
+ "\000\304\264r\230V\365\000\000j\273\354\223V\365\000\000V\302\326\217V\365"
+ "\000\000\241\277p\221V\365\000\000^\300\000\221V\365\000\000\200\311.\214"
+ "V\365\000\000\342\320\376\210V\365\000\000r\330C\206V\365\000\000+\340\007"
+ "\204V\365\000\000\222\336|\204V\365\000\000\032\337T\204V\365\000\000\003"
+ "\350E\202V\365\000\000\366\357\002\201V\365\000\000\366\367A\200V\365\000"
+ "\000\007\204+\340V\365\000\000T\204\032\337V\365\000\000|\204\222\336V\365"
+ "\000\000E\202\003\350V\365\000\000\002\201\366\357V\365\000\000A\200\366"
+ "\367V\365\000\000A\200\010\010V\365\000\000\002\201\012\020V\365\000\000"
+ "E\202\373\027V\365\000\000\007\204\324\037V\365\000\000C\206\216'V\365\000"
+ "\000|\204l!V\365\000\000T\204\346 V\365\000\000\376\210\036/V\365\000\000"
+ ".\214\2006V\365\000\000\326\217\252=V\365\000\000\354\223\224DV\365\000\000"
+ "p\221]@V\365\000\000\000\221\241\077V\365\000\000r\230<KV\365\000\000`\235"
+ "\227QV\365\000\000\261\242\237WV\365\000\000a\250M]V\365\000\000\337\245"
+ "\315ZV\365\000\0001\245\037ZV\365\000\000i\256\240bV\365\000\000\304\264"
+ "\216gV\365\000\000j\273\022lV\365\000\000V\302*pV\365\000\000^\300\000oV"
+ "\365\000\000\241\277\220nV\365\000\000\200\311\320sV\365\000\000\342\320"
+ "\002wV\365\000\000r\330\273yV\365\000\000+\340\371{V\365\000\000\032\337"
+ "\252{V\365\000\000\222\336\202{V\365\000\000\003\350\273}V\365\000\000\366"
+ "\357\374~V\365\000\000\366\367\277\177V\365\000\000\010\010\277\177V\365"
+ "\000\000\012\020\374~V\365\000\000\373\027\273}V\365\000\000\324\037\371"
+ "{V\365\000\000\216'\273yV\365\000\000l!\202{V\365\000\000\346 \252{V\365"
+ "\000\000\036/\002wV\365\000\000\2006\320sV\365\000\000\252=*pV\365\000\000"
+ "\224D\022lV\365\000\000]@\220nV\365\000\000\241\077\000oV\365\000\000<K\216"
+ "gV\365\000\000\227Q\240bV\365\000\000\237WM]V\365\000\000M]\237WV\365\000"
+ "\000\315Z\037ZV\365\000\000\037Z\315ZV\365\000\000\240b\227QV\365\000\000"
+ "\216g<KV\365\000\000\022l\224DV\365\000\000*p\252=V\365\000\000\000o\241"
+ "\077V\365\000\000\220n]@V\365\000\000\320s\2006V\365\000\000\002w\036/V\365"
+ "\000\000\273y\216'V\365\000\000\371{\324\037V\365\000\000\252{\346 V\365"
+ "\000\000\202{l!V\365\000\000\273}\373\027V\365\000\000\374~\012\020V\365"
+ "\000\000\277\177\010\010V\365\000\000\277\177\366\367V\365\000\000\374~\366"
+ "\357V\365\000\000\273}\003\350V\365\000\000\371{+\340V\365\000\000\273yr"
+ "\330V\365\000\000\202{\222\336V\365\000\000\252{\032\337V\365\000\000\002"
+ "w\342\320V\365\000\000\320s\200\311V\365\000\000*pV\302V\365\000\000\022"
+ "lj\273V\365\000\000\220n\241\277V\365\000\000\000o^\300V\365\000\000\216"
+ "g\304\264V\365\000\000\240bi\256V\365\000\000M]a\250V\365\000\000\237W\261"
+ "\242V\365\000\000\037Z1\245V\365\000\000\315Z\337\245V\365\000\000\227Q`"
+ "\235V\365\000\000<Kr\230V\365\000\000\224D\354\223V\365\000\000\252=\326"
+ "\217V\365\000\000\241\077\000\221V\365\000\000]@p\221V\365\000\000\2006."
+ "\214V\365\000\000\036/\376\210V\365\000\000\216'C\206V\365\000\000\324\037"
+ "\007\204V\365\000\000\346 T\204V\365\000\000l!|\204V\365\000\000\373\027"
+ "E\202V\365\000\000\012\020\002\201V\365\000\000\010\010A\200V\365\000\000"
+ "\252\330\256\331\252\336\245\334\256\323\262\325\263\317\266\321\267\313"
+ "\272\315\273\307\276\311\277\303\302\305\303\277\305\302\307\273\311\276"
+ "\313\267\315\272\317\263\321\266\323\256\325\262\330\252\331\256\334\245"
+ "\336\252\341\241\343\245\346\233\347\240\354\226\355\233\362\220\363\226"
+ "\367\213\371\220\000\202\000\211\011\213\007\220\016\220\015\226\024\226"
+ "\023\233\032\233\031\240\037\241\035\245$\245\042\252(\252'\256-\256+\262"
+ "1\263/\2665\2673\2729\2737\276=\277;\302A\303>\305E\307B\311I\313F\315M\317"
+ "J\321R\323N\325V\330R\331[\334V\336_\341[\343e\346`\347j\354e\355p\362j\363"
+ "u\367p\371~\000w\000u\011p\007p\016j\015j\024e\023e\032`\031_\037[\035[$"
+ "V\042V(R'R-N+M1J/I5F3E9B7A=>;=A;>9E7B5I3F1M/J-R+N(V'R$[\042V\037_\035[\032"
+ "e\031`\024j\023e\016p\015j\011u\007p\000~\000w\367u\371p\362p\363j\354j\355"
+ "e\346e\347`\341_\343[\334[\336V\330V\331R\323R\325N\317M\321J\313I\315F\307"
+ "E\311B\303A\305>\277=\302;\2739\2767\2675\2723\2631\266/\256-\262+\252(\256"
+ "'\245$\252\042\241\037\245\035\233\032\240\031\226\024\233\023\220\016\226"
+ "\015\213\011\220\007\202\000\211\000\213\367\220\371\220\362\226\363\226"
+ "\354\233\355\233\346\240\347\241\341\245\343\261\341\255\345\265\334\270"
+ "\331\274\325\277\321\303\315\306\312\312\306\315\303\321\277\325\274\331"
+ "\270\334\265\341\261\345\255\352\251\357\244\364\240\372\233\000\225\006"
+ "\233\014\240\021\244\026\251\033\255\037\261$\265'\270+\274/\2773\3036\306"
+ ":\312=\315A\321D\325H\331K\334O\341S\345W\352\134\357`\364e\372k\000e\006"
+ "`\014\134\021W\026S\033O\037K$H'D+A/=3:66:3=/A+D'H$K\037O\033S\026W\021\134"
+ "\014`\006e\000k\372e\364`\357\134\352W\345S\341O\334K\331H\325D\321A\315"
+ "=\312:\3066\3033\277/\274+\270'\265$\261\037\255\033\251\026\244\021\240"
+ "\014\233\006\225\000\233\372\240\364\244\357\251\352\264\347\260\353\267"
+ "\343\272\337\276\334\301\330\304\324\307\321\313\316\316\313\321\307\324"
+ "\304\330\301\334\276\337\272\343\267\347\264\353\260\360\254\365\250\372"
+ "\244\000\240\006\244\013\250\020\254\025\260\031\264\035\267!\272$\276(\301"
+ ",\304/\3072\3135\3169\321<\324\077\330B\334F\337I\343L\347P\353T\360X\365"
+ "\134\372`\000\134\006X\013T\020P\025L\031I\035F!B$\077(<,9/5225/9,<(\077"
+ "$B!F\035I\031L\025P\020T\013X\006\134\000`\372\134\365X\360T\353P\347L\343"
+ "I\337F\334B\330\077\324<\3219\3165\3132\307/\304,\301(\276$\272!\267\035"
+ "\264\031\260\025\254\020\250\013\244\006\240\000\244\372\250\365\254\360"
+ "\266\355\263\361\272\351\275\345\300\342\303\336\306\333\311\330\314\325"
+ "\316\322\322\316\325\314\330\311\333\306\336\303\342\300\345\275\351\272"
+ "\355\266\361\263\366\260\373\254\000\251\005\254\012\260\017\263\023\266"
+ "\027\272\033\275\036\300\042\303%\306(\311+\314.\3162\3224\3257\330:\333"
+ "=\336@\342C\345F\351J\355M\361P\366T\373W\000T\005P\012M\017J\023F\027C\033"
+ "@\036=\042:%7(4+2..2+4(7%:\042=\036@\033C\027F\023J\017M\012P\005T\000W\373"
+ "T\366P\361M\355J\351F\345C\342@\336=\333:\3307\3254\3222\316.\314+\311(\306"
+ "%\303\042\300\036\275\033\272\027\266\023\263\017\260\012\254\005\251\000"
+ "\254\373\260\366\272\363\267\367\275\357\277\353\302\347\305\344\307\341"
+ "\312\336\315\333\317\330\322\325\325\322\330\317\333\315\336\312\341\307"
+ "\344\305\347\302\353\277\357\275\363\272\367\267\373\264\000\261\005\264"
+ "\011\267\015\272\021\275\025\277\031\302\034\305\037\307\042\312%\315(\317"
+ "+\322.\3251\3303\3336\3369\341;\344>\347A\353C\357F\363I\367L\373O\000L\005"
+ "I\011F\015C\021A\025>\031;\0349\0376\0423%1(.++.(1%3\0426\0379\034;\031>"
+ "\025A\021C\015F\011I\005L\000O\373L\367I\363F\357C\353A\347>\344;\3419\336"
+ "6\3333\3301\325.\322+\317(\315%\312\042\307\037\305\034\302\031\277\025\275"
+ "\021\272\015\267\011\264\005\261\000\264\373\276\370\273\374\300\364\303"
+ "\360\305\355\307\352\312\346\314\343\317\341\321\336\323\333\326\330\330"
+ "\326\333\323\336\321\341\317\343\314\346\312\352\307\355\305\360\303\364"
+ "\300\370\276\374\273\000\271\004\273\010\276\014\300\020\303\023\305\026"
+ "\307\032\312\035\314\037\317\042\321%\323(\326*\330-\333/\3361\3414\3436"
+ "\3469\352;\355=\360@\364B\370E\374G\000E\004B\010@\014=\020;\0239\0266\032"
+ "4\0351\037/\042-%*((*%-\042/\0371\0354\0326\0269\023;\020=\014@\010B\004"
+ "E\000G\374E\370B\364@\360=\355;\3529\3466\3434\3411\336/\333-\330*\326(\323"
+ "%\321\042\317\037\314\035\312\032\307\026\305\023\303\020\300\014\276\010"
+ "\273\004\271\000\302\374\301\000\304\370\307\365\311\362\313\357\315\354"
+ "\317\351\321\346\323\343\325\341\327\336\332\334\334\332\336\327\341\325"
+ "\343\323\346\321\351\317\354\315\357\313\362\311\365\307\370\304\374\302"
+ "\000\301\004\302\010\304\013\307\016\311\021\313\024\315\027\317\032\321"
+ "\035\323\037\325\042\327$\332&\334)\336+\341-\343/\3461\3513\3545\3577\362"
+ "9\365<\370>\374\077\000>\004<\0109\0137\0165\0213\0241\027/\032-\035+\037"
+ ")\042&$$&\042)\037+\035-\032/\0271\0243\0215\0167\0139\010<\004>\000\077"
+ "\374>\370<\3659\3627\3575\3543\3511\346/\343-\341+\336)\334&\332$\327\042"
+ "\325\037\323\035\321\032\317\027\315\024\313\021\311\016\307\013\304\010"
+ "\302\004\310\000\312\003\312\375\313\371\315\366\317\363\320\361\322\356"
+ "\324\353\326\351\330\346\332\344\333\342\336\340\340\336\342\333\344\332"
+ "\346\330\351\326\353\324\356\322\361\320\363\317\366\315\371\313\375\312"
+ "\000\310\003\312\007\313\012\315\015\317\017\320\022\322\025\324\027\326"
+ "\032\330\034\332\036\333 \336\042\340%\342&\344(\346*\351,\353.\3560\361"
+ "1\3633\3665\3716\3758\0006\0035\0073\0121\0150\017.\022,\025*\027(\032&\034"
+ "%\036\042  \042\036%\034&\032(\027*\025,\022.\0170\0151\0123\0075\0036\000"
+ "8\3756\3715\3663\3631\3610\356.\353,\351*\346(\344&\342%\340\042\336 \333"
+ "\036\332\034\330\032\326\027\324\025\322\022\320\017\317\015\315\012\313"
+ "\007\321\003\322\006\320\000\321\375\322\372\324\370\325\365\326\362\330"
+ "\360\331\356\333\354\335\351\336\347\340\345\342\344\344\342\345\340\347"
+ "\336\351\335\354\333\356\331\360\330\362\326\365\325\370\324\372\322\375"
+ "\321\000\320\003\321\006\322\010\324\013\325\016\326\020\330\022\331\024"
+ "\333\027\335\031\336\033\340\034\342\036\344 \345\042\347#\351%\354'\356"
+ "(\360*\362+\365,\370.\372/\3750\000/\003.\006,\010+\013*\016(\020'\022%\024"
+ "#\027\042\031 \033\036\034\034\036\033 \031\042\027#\024%\022'\020(\016*"
+ "\013+\010,\006.\003/\0000\375/\372.\370,\365+\362*\360(\356'\354%\351#\347"
+ "\042\345 \344\036\342\034\340\033\336\031\335\027\333\024\331\022\330\020"
+ "\326\016\325\013\324\010\332\005\333\007\331\002\330\000\331\376\332\373"
+ "\333\371\334\367\335\365\336\363\337\361\341\357\342\355\343\353\345\352"
+ "\346\350\350\346\352\345\353\343\355\342\357\341\361\337\363\336\365\335"
+ "\367\334\371\333\373\332\376\331\000\330\002\331\005\332\007\333\011\334"
+ "\013\335\015\336\017\337\021\341\023\342\025\343\026\345\030\346\032\350"
+ "\033\352\035\353\036\355\037\357!\361\042\363#\365$\367%\371&\373'\376(\000"
+ "'\002&\005%\007$\011#\013\042\015!\017\037\021\036\023\035\025\033\026\032"
+ "\030\030\032\026\033\025\035\023\036\021\037\017!\015\042\013#\011$\007%"
+ "\005&\002'\000(\376'\373&\371%\367$\365#\363\042\361!\357\037\355\036\353"
+ "\035\352\033\350\032\346\030\345\026\343\025\342\023\341\021\337\017\336"
+ "\015\335\013\334\011\343\006\344\007\342\004\342\002\341\000\342\376\342"
+ "\374\343\372\344\371\345\367\345\365\346\364\347\362\350\361\351\360\352"
+ "\356\354\355\355\354\356\352\360\351\361\350\362\347\364\346\365\345\367"
+ "\345\371\344\372\343\374\342\376\342\000\341\002\342\004\342\006\343\007"
+ "\344\011\345\013\345\014\346\016\347\017\350\020\351\022\352\023\354\024"
+ "\355\026\356\027\360\030\361\031\362\032\364\033\365\033\367\034\371\035"
+ "\372\036\374\036\376\037\000\036\002\036\004\035\006\034\007\033\011\033"
+ "\013\032\014\031\016\030\017\027\020\026\022\024\023\023\024\022\026\020"
+ "\027\017\030\016\031\014\032\013\033\011\033\007\034\006\035\004\036\002"
+ "\036\000\037\376\036\374\036\372\035\371\034\367\033\365\033\364\032\362"
+ "\031\361\030\360\027\356\026\355\024\354\023\352\022\351\020\350\017\347"
+ "\016\346\014\345\013\345\011\355\005\355\006\354\004\354\003\354\001\354"
+ "\000\354\377\354\375\354\374\355\373\355\372\356\371\356\370\357\367\360"
+ "\366\360\365\361\364\362\363\363\362\364\361\365\360\366\360\367\357\370"
+ "\356\371\356\372\355\373\355\374\354\375\354\377\354\000\354\001\354\003"
+ "\354\004\354\005\355\006\355\007\356\010\356\011\357\012\360\013\360\014"
+ "\361\015\362\016\363\017\364\020\365\020\366\021\367\022\370\022\371\023"
+ "\372\023\373\024\374\024\375\024\377\024\000\024\001\024\003\024\004\023"
+ "\005\023\006\022\007\022\010\021\011\020\012\020\013\017\014\016\015\015"
+ "\016\014\017\013\020\012\020\011\021\010\022\007\022\006\023\005\023\004"
+ "\024\003\024\001\024\000\024\377\024\375\024\374\024\373\023\372\023\371"
+ "\022\370\022\367\021\366\020\365\020\364\017\363\016\362\015\361\014\360"
+ "\013\360\012\357\011\356\010\356\007\370\003\370\003\370\002\370\002\370"
+ "\001\370\001\370\000\370\377\370\377\370\376\370\376\370\375\370\375\371"
+ "\375\371\374\371\374\371\373\372\373\372\372\372\372\373\372\373\371\374"
+ "\371\374\371\375\371\375\370\375\370\376\370\376\370\377\370\377\370\000"
+ "\370\001\370\001\370\002\370\002\370\003\370\003\370\003\371\004\371\004"
+ "\371\005\371\005\372\006\372\006\372\006\373\007\373\007\374\007\374\007"
+ "\375\010\375\010\375\010\376\010\376\010\377\010\377\010\000\010\001\010"
+ "\001\010\002\010\002\010\003\010\003\007\003\007\004\007\004\007\005\006"
+ "\005\006\006\006\006\005\006\005\007\004\007\004\007\003\007\003\010\003"
+ "\010\002\010\002\010\001\010\001\010\000\010\377\010\377\010\376\010\376"
+ "\010\375\010\375\010\375\007\374\007\374\007\373\007\373\006\372\006\372"
+ "\006\372\005\371\005\371\004\371\004\371\003\377\000\377\000\377\000\377"
+ "\000\377\000\377\000\377\000\377\000\377\000\377\000\377\000\377\000\377"
+ "\000\377\000\377\000\377\000\377\000\377\377\377\377\377\377\377\377\377"
+ "\377\377\377\000\377\000\377\000\377\000\377\000\377\000\377\000\377\000"
+ "\377\000\377\000\377\000\377\000\377\000\377\000\377\000\377\000\377\000"
+ "\377\000\377\000\377\001\377\001\377\001\377\001\377\001\377\001\377\001"
+ "\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001"
+ "\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001"
+ "\000\001\001\001\001\001\001\001\001\001\001\001\001\000\001\000\001\000"
+ "\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001\000"
+ "\001\000\001\000\001\000\001\000\001\000\001\000\001\000\001\377\001\377"
+ "\001\377\001\377\001\377\001\377\001\377\000\377\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\245\334\240\341\252"
+ "\327\256\323\262\317\260\321\260\321\266\313\272\307\277\302\302\277\300"
+ "\300\300\300\307\272\313\266\317\262\323\256\321\260\321\260\327\252\334"
+ "\245\341\240\346\233\343\236\343\236\354\225\362\217\365\214\233\346\236"
+ "\343\236\343\225\354\217\362\214\365\214\013\217\016\225\024\233\032\240"
+ "\037\236\035\236\035\245$\252)\256-\2621\260/\260/\2665\2729\277>\302A\300"
+ "@\300@\307F\313J\317N\323R\321P\321P\327V\334[\341`\346e\343b\343b\354k\362"
+ "q\365t\013t\016q\024k\032e\037`\035b\035b$[)V-R1N/P/P5J9F>AA>@@@@F9J5N1R"
+ "-P/P/V)[$`\037e\032b\035b\035k\024q\016t\013t\365q\362k\354e\346`\341b\343"
+ "b\343[\334V\327R\323N\317P\321P\321J\313F\307A\302>\277@\300@\3009\2725\266"
+ "1\262-\256/\260/\260)\252$\245\037\240\032\233\035\236\035\236\024\225\016"
+ "\217\013\214\000\000\001\000\002\000\000\000\002\000\003\000\004\000\005"
+ "\000\001\000\004\000\001\000\000\000\006\000\007\000\005\000\006\000\005"
+ "\000\004\000\010\000\011\000\007\000\010\000\007\000\006\000\012\000\013"
+ "\000\011\000\012\000\011\000\010\000\014\000\015\000\013\000\014\000\013"
+ "\000\012\000\016\000\017\000\015\000\016\000\015\000\014\000\020\000\021"
+ "\000\017\000\020\000\017\000\016\000\022\000\023\000\021\000\022\000\021"
+ "\000\020\000\024\000\025\000\023\000\024\000\023\000\022\000\026\000\027"
+ "\000\025\000\026\000\025\000\024\000\030\000\031\000\027\000\030\000\027"
+ "\000\026\000\032\000\033\000\031\000\032\000\031\000\030\000\034\000\035"
+ "\000\033\000\034\000\033\000\032\000\036\000\037\000\035\000\036\000\035"
+ "\000\034\000 \000!\000\037\000 \000\037\000\036\000\042\000#\000!\000\042"
+ "\000!\000 \000$\000%\000#\000$\000#\000\042\000&\000'\000%\000&\000%\000"
+ "$\000(\000)\000'\000(\000'\000&\000*\000+\000)\000*\000)\000(\000,\000-\000"
+ "+\000,\000+\000*\000.\000/\000-\000.\000-\000,\0000\0001\000/\0000\000/\000"
+ ".\0002\0003\0001\0002\0001\0000\0004\0005\0003\0004\0003\0002\0006\0007\000"
+ "5\0006\0005\0004\0008\0009\0007\0008\0007\0006\000:\000;\0009\000:\0009\000"
+ "8\000<\000=\000;\000<\000;\000:\000>\000\077\000=\000>\000=\000<\000@\000"
+ "A\000\077\000@\000\077\000>\000B\000C\000A\000B\000A\000@\000D\000E\000C"
+ "\000D\000C\000B\000F\000G\000E\000F\000E\000D\000H\000I\000G\000H\000G\000"
+ "F\000J\000K\000I\000J\000I\000H\000L\000M\000K\000L\000K\000J\000N\000O\000"
+ "M\000N\000M\000L\000P\000Q\000O\000P\000O\000N\000R\000S\000Q\000R\000Q\000"
+ "P\000T\000U\000S\000T\000S\000R\000V\000W\000U\000V\000U\000T\000X\000Y\000"
+ "W\000X\000W\000V\000Z\000[\000Y\000Z\000Y\000X\000\134\000]\000[\000\134"
+ "\000[\000Z\000^\000_\000]\000^\000]\000\134\000`\000a\000_\000`\000_\000"
+ "^\000b\000c\000a\000b\000a\000`\000d\000e\000c\000d\000c\000b\000f\000g\000"
+ "e\000f\000e\000d\000h\000i\000g\000h\000g\000f\000j\000k\000i\000j\000i\000"
+ "h\000l\000m\000k\000l\000k\000j\000n\000o\000m\000n\000m\000l\000p\000q\000"
+ "o\000p\000o\000n\000r\000s\000q\000r\000q\000p\000t\000u\000s\000t\000s\000"
+ "r\000v\000w\000u\000v\000u\000t\000x\000y\000w\000x\000w\000v\000z\000{\000"
+ "y\000z\000y\000x\000|\000}\000{\000|\000{\000z\000~\000\177\000}\000~\000"
+ "}\000|\000\200\000\201\000\177\000\200\000\177\000~\000\202\000\203\000\201"
+ "\000\202\000\201\000\200\000\204\000\205\000\203\000\204\000\203\000\202"
+ "\000\206\000\207\000\205\000\206\000\205\000\204\000\210\000\211\000\207"
+ "\000\210\000\207\000\206\000\212\000\213\000\211\000\212\000\211\000\210"
+ "\000\214\000\215\000\213\000\214\000\213\000\212\000\216\000\217\000\215"
+ "\000\216\000\215\000\214\000\220\000\221\000\217\000\220\000\217\000\216"
+ "\000\222\000\223\000\221\000\222\000\221\000\220\000\224\000\225\000\223"
+ "\000\224\000\223\000\222\000\226\000\227\000\225\000\226\000\225\000\224"
+ "\000\230\000\231\000\227\000\230\000\227\000\226\000\232\000\233\000\231"
+ "\000\232\000\231\000\230\000\234\000\235\000\233\000\234\000\233\000\232"
+ "\000\236\000\237\000\235\000\236\000\235\000\234\000\240\000\241\000\237"
+ "\000\240\000\237\000\236\000\242\000\243\000\241\000\242\000\241\000\240"
+ "\000\244\000\245\000\243\000\244\000\243\000\242\000\246\000\247\000\245"
+ "\000\246\000\245\000\244\000\250\000\251\000\247\000\250\000\247\000\246"
+ "\000\252\000\253\000\251\000\252\000\251\000\250\000\254\000\255\000\253"
+ "\000\254\000\253\000\252\000\256\000\257\000\255\000\256\000\255\000\254"
+ "\000\260\000\261\000\257\000\260\000\257\000\256\000\262\000\263\000\261"
+ "\000\262\000\261\000\260\000\264\000\265\000\263\000\264\000\263\000\262"
+ "\000\266\000\267\000\265\000\266\000\265\000\264\000\270\000\271\000\267"
+ "\000\270\000\267\000\266\000\272\000\273\000\271\000\272\000\271\000\270"
+ "\000\274\000\275\000\273\000\274\000\273\000\272\000\276\000\277\000\275"
+ "\000\276\000\275\000\274\000\300\000\301\000\277\000\300\000\277\000\276"
+ "\000\302\000\303\000\301\000\302\000\301\000\300\000\304\000\305\000\303"
+ "\000\304\000\303\000\302\000\306\000\307\000\305\000\306\000\305\000\304"
+ "\000\003\000\002\000\307\000\003\000\307\000\306\000\002\000\310\000\311"
+ "\000\002\000\311\000\307\000\001\000\312\000\310\000\001\000\310\000\002"
+ "\000\005\000\313\000\312\000\005\000\312\000\001\000\007\000\314\000\313"
+ "\000\007\000\313\000\005\000\011\000\315\000\314\000\011\000\314\000\007"
+ "\000\013\000\316\000\315\000\013\000\315\000\011\000\015\000\317\000\316"
+ "\000\015\000\316\000\013\000\017\000\320\000\317\000\017\000\317\000\015"
+ "\000\021\000\321\000\320\000\021\000\320\000\017\000\023\000\322\000\321"
+ "\000\023\000\321\000\021\000\025\000\323\000\322\000\025\000\322\000\023"
+ "\000\027\000\324\000\323\000\027\000\323\000\025\000\031\000\325\000\324"
+ "\000\031\000\324\000\027\000\033\000\326\000\325\000\033\000\325\000\031"
+ "\000\035\000\327\000\326\000\035\000\326\000\033\000\037\000\330\000\327"
+ "\000\037\000\327\000\035\000!\000\331\000\330\000!\000\330\000\037\000#\000"
+ "\332\000\331\000#\000\331\000!\000%\000\333\000\332\000%\000\332\000#\000"
+ "'\000\334\000\333\000'\000\333\000%\000)\000\335\000\334\000)\000\334\000"
+ "'\000+\000\336\000\335\000+\000\335\000)\000-\000\337\000\336\000-\000\336"
+ "\000+\000/\000\340\000\337\000/\000\337\000-\0001\000\341\000\340\0001\000"
+ "\340\000/\0003\000\342\000\341\0003\000\341\0001\0005\000\343\000\342\000"
+ "5\000\342\0003\0007\000\344\000\343\0007\000\343\0005\0009\000\345\000\344"
+ "\0009\000\344\0007\000;\000\346\000\345\000;\000\345\0009\000=\000\347\000"
+ "\346\000=\000\346\000;\000\077\000\350\000\347\000\077\000\347\000=\000A"
+ "\000\351\000\350\000A\000\350\000\077\000C\000\352\000\351\000C\000\351\000"
+ "A\000E\000\353\000\352\000E\000\352\000C\000G\000\354\000\353\000G\000\353"
+ "\000E\000I\000\355\000\354\000I\000\354\000G\000K\000\356\000\355\000K\000"
+ "\355\000I\000M\000\357\000\356\000M\000\356\000K\000O\000\360\000\357\000"
+ "O\000\357\000M\000Q\000\361\000\360\000Q\000\360\000O\000S\000\362\000\361"
+ "\000S\000\361\000Q\000U\000\363\000\362\000U\000\362\000S\000W\000\364\000"
+ "\363\000W\000\363\000U\000Y\000\365\000\364\000Y\000\364\000W\000[\000\366"
+ "\000\365\000[\000\365\000Y\000]\000\367\000\366\000]\000\366\000[\000_\000"
+ "\370\000\367\000_\000\367\000]\000a\000\371\000\370\000a\000\370\000_\000"
+ "c\000\372\000\371\000c\000\371\000a\000e\000\373\000\372\000e\000\372\000"
+ "c\000g\000\374\000\373\000g\000\373\000e\000i\000\375\000\374\000i\000\374"
+ "\000g\000k\000\376\000\375\000k\000\375\000i\000m\000\377\000\376\000m\000"
+ "\376\000k\000o\000\000\001\377\000o\000\377\000m\000q\000\001\001\000\001"
+ "q\000\000\001o\000s\000\002\001\001\001s\000\001\001q\000u\000\003\001\002"
+ "\001u\000\002\001s\000w\000\004\001\003\001w\000\003\001u\000y\000\005\001"
+ "\004\001y\000\004\001w\000{\000\006\001\005\001{\000\005\001y\000}\000\007"
+ "\001\006\001}\000\006\001{\000\177\000\010\001\007\001\177\000\007\001}\000"
+ "\201\000\011\001\010\001\201\000\010\001\177\000\203\000\012\001\011\001"
+ "\203\000\011\001\201\000\205\000\013\001\012\001\205\000\012\001\203\000"
+ "\207\000\014\001\013\001\207\000\013\001\205\000\211\000\015\001\014\001"
+ "\211\000\014\001\207\000\213\000\016\001\015\001\213\000\015\001\211\000"
+ "\215\000\017\001\016\001\215\000\016\001\213\000\217\000\020\001\017\001"
+ "\217\000\017\001\215\000\221\000\021\001\020\001\221\000\020\001\217\000"
+ "\223\000\022\001\021\001\223\000\021\001\221\000\225\000\023\001\022\001"
+ "\225\000\022\001\223\000\227\000\024\001\023\001\227\000\023\001\225\000"
+ "\231\000\025\001\024\001\231\000\024\001\227\000\233\000\026\001\025\001"
+ "\233\000\025\001\231\000\235\000\027\001\026\001\235\000\026\001\233\000"
+ "\237\000\030\001\027\001\237\000\027\001\235\000\241\000\031\001\030\001"
+ "\241\000\030\001\237\000\243\000\032\001\031\001\243\000\031\001\241\000"
+ "\245\000\033\001\032\001\245\000\032\001\243\000\247\000\034\001\033\001"
+ "\247\000\033\001\245\000\251\000\035\001\034\001\251\000\034\001\247\000"
+ "\253\000\036\001\035\001\253\000\035\001\251\000\255\000\037\001\036\001"
+ "\255\000\036\001\253\000\257\000 \001\037\001\257\000\037\001\255\000\261"
+ "\000!\001 \001\261\000 \001\257\000\263\000\042\001!\001\263\000!\001\261"
+ "\000\265\000#\001\042\001\265\000\042\001\263\000\267\000$\001#\001\267\000"
+ "#\001\265\000\271\000%\001$\001\271\000$\001\267\000\273\000&\001%\001\273"
+ "\000%\001\271\000\275\000'\001&\001\275\000&\001\273\000\277\000(\001'\001"
+ "\277\000'\001\275\000\301\000)\001(\001\301\000(\001\277\000\303\000*\001"
+ ")\001\303\000)\001\301\000\305\000+\001*\001\305\000*\001\303\000\307\000"
+ "\311\000+\001\307\000+\001\305\000\311\000,\001-\001\311\000-\001+\001\310"
+ "\000.\001,\001\310\000,\001\311\000\312\000/\001.\001\312\000.\001\310\000"
+ "\313\0000\001/\001\313\000/\001\312\000\314\0001\0010\001\314\0000\001\313"
+ "\000\315\0002\0011\001\315\0001\001\314\000\316\0003\0012\001\316\0002\001"
+ "\315\000\317\0004\0013\001\317\0003\001\316\000\320\0005\0014\001\320\000"
+ "4\001\317\000\321\0006\0015\001\321\0005\001\320\000\322\0007\0016\001\322"
+ "\0006\001\321\000\323\0008\0017\001\323\0007\001\322\000\324\0009\0018\001"
+ "\324\0008\001\323\000\325\000:\0019\001\325\0009\001\324\000\326\000;\001"
+ ":\001\326\000:\001\325\000\327\000<\001;\001\327\000;\001\326\000\330\000"
+ "=\001<\001\330\000<\001\327\000\331\000>\001=\001\331\000=\001\330\000\332"
+ "\000\077\001>\001\332\000>\001\331\000\333\000@\001\077\001\333\000\077\001"
+ "\332\000\334\000A\001@\001\334\000@\001\333\000\335\000B\001A\001\335\000"
+ "A\001\334\000\336\000C\001B\001\336\000B\001\335\000\337\000D\001C\001\337"
+ "\000C\001\336\000\340\000E\001D\001\340\000D\001\337\000\341\000F\001E\001"
+ "\341\000E\001\340\000\342\000G\001F\001\342\000F\001\341\000\343\000H\001"
+ "G\001\343\000G\001\342\000\344\000I\001H\001\344\000H\001\343\000\345\000"
+ "J\001I\001\345\000I\001\344\000\346\000K\001J\001\346\000J\001\345\000\347"
+ "\000L\001K\001\347\000K\001\346\000\350\000M\001L\001\350\000L\001\347\000"
+ "\351\000N\001M\001\351\000M\001\350\000\352\000O\001N\001\352\000N\001\351"
+ "\000\353\000P\001O\001\353\000O\001\352\000\354\000Q\001P\001\354\000P\001"
+ "\353\000\355\000R\001Q\001\355\000Q\001\354\000\356\000S\001R\001\356\000"
+ "R\001\355\000\357\000T\001S\001\357\000S\001\356\000\360\000U\001T\001\360"
+ "\000T\001\357\000\361\000V\001U\001\361\000U\001\360\000\362\000W\001V\001"
+ "\362\000V\001\361\000\363\000X\001W\001\363\000W\001\362\000\364\000Y\001"
+ "X\001\364\000X\001\363\000\365\000Z\001Y\001\365\000Y\001\364\000\366\000"
+ "[\001Z\001\366\000Z\001\365\000\367\000\134\001[\001\367\000[\001\366\000"
+ "\370\000]\001\134\001\370\000\134\001\367\000\371\000^\001]\001\371\000]"
+ "\001\370\000\372\000_\001^\001\372\000^\001\371\000\373\000`\001_\001\373"
+ "\000_\001\372\000\374\000a\001`\001\374\000`\001\373\000\375\000b\001a\001"
+ "\375\000a\001\374\000\376\000c\001b\001\376\000b\001\375\000\377\000d\001"
+ "c\001\377\000c\001\376\000\000\001e\001d\001\000\001d\001\377\000\001\001"
+ "f\001e\001\001\001e\001\000\001\002\001g\001f\001\002\001f\001\001\001\003"
+ "\001h\001g\001\003\001g\001\002\001\004\001i\001h\001\004\001h\001\003\001"
+ "\005\001j\001i\001\005\001i\001\004\001\006\001k\001j\001\006\001j\001\005"
+ "\001\007\001l\001k\001\007\001k\001\006\001\010\001m\001l\001\010\001l\001"
+ "\007\001\011\001n\001m\001\011\001m\001\010\001\012\001o\001n\001\012\001"
+ "n\001\011\001\013\001p\001o\001\013\001o\001\012\001\014\001q\001p\001\014"
+ "\001p\001\013\001\015\001r\001q\001\015\001q\001\014\001\016\001s\001r\001"
+ "\016\001r\001\015\001\017\001t\001s\001\017\001s\001\016\001\020\001u\001"
+ "t\001\020\001t\001\017\001\021\001v\001u\001\021\001u\001\020\001\022\001"
+ "w\001v\001\022\001v\001\021\001\023\001x\001w\001\023\001w\001\022\001\024"
+ "\001y\001x\001\024\001x\001\023\001\025\001z\001y\001\025\001y\001\024\001"
+ "\026\001{\001z\001\026\001z\001\025\001\027\001|\001{\001\027\001{\001\026"
+ "\001\030\001}\001|\001\030\001|\001\027\001\031\001~\001}\001\031\001}\001"
+ "\030\001\032\001\177\001~\001\032\001~\001\031\001\033\001\200\001\177\001"
+ "\033\001\177\001\032\001\034\001\201\001\200\001\034\001\200\001\033\001"
+ "\035\001\202\001\201\001\035\001\201\001\034\001\036\001\203\001\202\001"
+ "\036\001\202\001\035\001\037\001\204\001\203\001\037\001\203\001\036\001"
+ " \001\205\001\204\001 \001\204\001\037\001!\001\206\001\205\001!\001\205"
+ "\001 \001\042\001\207\001\206\001\042\001\206\001!\001#\001\210\001\207\001"
+ "#\001\207\001\042\001$\001\211\001\210\001$\001\210\001#\001%\001\212\001"
+ "\211\001%\001\211\001$\001&\001\213\001\212\001&\001\212\001%\001'\001\214"
+ "\001\213\001'\001\213\001&\001(\001\215\001\214\001(\001\214\001'\001)\001"
+ "\216\001\215\001)\001\215\001(\001*\001\217\001\216\001*\001\216\001)\001"
+ "+\001-\001\217\001+\001\217\001*\001-\001\220\001\221\001-\001\221\001\217"
+ "\001,\001\222\001\220\001,\001\220\001-\001.\001\223\001\222\001.\001\222"
+ "\001,\001/\001\224\001\223\001/\001\223\001.\0010\001\225\001\224\0010\001"
+ "\224\001/\0011\001\226\001\225\0011\001\225\0010\0012\001\227\001\226\001"
+ "2\001\226\0011\0013\001\230\001\227\0013\001\227\0012\0014\001\231\001\230"
+ "\0014\001\230\0013\0015\001\232\001\231\0015\001\231\0014\0016\001\233\001"
+ "\232\0016\001\232\0015\0017\001\234\001\233\0017\001\233\0016\0018\001\235"
+ "\001\234\0018\001\234\0017\0019\001\236\001\235\0019\001\235\0018\001:\001"
+ "\237\001\236\001:\001\236\0019\001;\001\240\001\237\001;\001\237\001:\001"
+ "<\001\241\001\240\001<\001\240\001;\001=\001\242\001\241\001=\001\241\001"
+ "<\001>\001\243\001\242\001>\001\242\001=\001\077\001\244\001\243\001\077"
+ "\001\243\001>\001@\001\245\001\244\001@\001\244\001\077\001A\001\246\001"
+ "\245\001A\001\245\001@\001B\001\247\001\246\001B\001\246\001A\001C\001\250"
+ "\001\247\001C\001\247\001B\001D\001\251\001\250\001D\001\250\001C\001E\001"
+ "\252\001\251\001E\001\251\001D\001F\001\253\001\252\001F\001\252\001E\001"
+ "G\001\254\001\253\001G\001\253\001F\001H\001\255\001\254\001H\001\254\001"
+ "G\001I\001\256\001\255\001I\001\255\001H\001J\001\257\001\256\001J\001\256"
+ "\001I\001K\001\260\001\257\001K\001\257\001J\001L\001\261\001\260\001L\001"
+ "\260\001K\001M\001\262\001\261\001M\001\261\001L\001N\001\263\001\262\001"
+ "N\001\262\001M\001O\001\264\001\263\001O\001\263\001N\001P\001\265\001\264"
+ "\001P\001\264\001O\001Q\001\266\001\265\001Q\001\265\001P\001R\001\267\001"
+ "\266\001R\001\266\001Q\001S\001\270\001\267\001S\001\267\001R\001T\001\271"
+ "\001\270\001T\001\270\001S\001U\001\272\001\271\001U\001\271\001T\001V\001"
+ "\273\001\272\001V\001\272\001U\001W\001\274\001\273\001W\001\273\001V\001"
+ "X\001\275\001\274\001X\001\274\001W\001Y\001\276\001\275\001Y\001\275\001"
+ "X\001Z\001\277\001\276\001Z\001\276\001Y\001[\001\300\001\277\001[\001\277"
+ "\001Z\001\134\001\301\001\300\001\134\001\300\001[\001]\001\302\001\301\001"
+ "]\001\301\001\134\001^\001\303\001\302\001^\001\302\001]\001_\001\304\001"
+ "\303\001_\001\303\001^\001`\001\305\001\304\001`\001\304\001_\001a\001\306"
+ "\001\305\001a\001\305\001`\001b\001\307\001\306\001b\001\306\001a\001c\001"
+ "\310\001\307\001c\001\307\001b\001d\001\311\001\310\001d\001\310\001c\001"
+ "e\001\312\001\311\001e\001\311\001d\001f\001\313\001\312\001f\001\312\001"
+ "e\001g\001\314\001\313\001g\001\313\001f\001h\001\315\001\314\001h\001\314"
+ "\001g\001i\001\316\001\315\001i\001\315\001h\001j\001\317\001\316\001j\001"
+ "\316\001i\001k\001\320\001\317\001k\001\317\001j\001l\001\321\001\320\001"
+ "l\001\320\001k\001m\001\322\001\321\001m\001\321\001l\001n\001\323\001\322"
+ "\001n\001\322\001m\001o\001\324\001\323\001o\001\323\001n\001p\001\325\001"
+ "\324\001p\001\324\001o\001q\001\326\001\325\001q\001\325\001p\001r\001\327"
+ "\001\326\001r\001\326\001q\001s\001\330\001\327\001s\001\327\001r\001t\001"
+ "\331\001\330\001t\001\330\001s\001u\001\332\001\331\001u\001\331\001t\001"
+ "v\001\333\001\332\001v\001\332\001u\001w\001\334\001\333\001w\001\333\001"
+ "v\001x\001\335\001\334\001x\001\334\001w\001y\001\336\001\335\001y\001\335"
+ "\001x\001z\001\337\001\336\001z\001\336\001y\001{\001\340\001\337\001{\001"
+ "\337\001z\001|\001\341\001\340\001|\001\340\001{\001}\001\342\001\341\001"
+ "}\001\341\001|\001~\001\343\001\342\001~\001\342\001}\001\177\001\344\001"
+ "\343\001\177\001\343\001~\001\200\001\345\001\344\001\200\001\344\001\177"
+ "\001\201\001\346\001\345\001\201\001\345\001\200\001\202\001\347\001\346"
+ "\001\202\001\346\001\201\001\203\001\350\001\347\001\203\001\347\001\202"
+ "\001\204\001\351\001\350\001\204\001\350\001\203\001\205\001\352\001\351"
+ "\001\205\001\351\001\204\001\206\001\353\001\352\001\206\001\352\001\205"
+ "\001\207\001\354\001\353\001\207\001\353\001\206\001\210\001\355\001\354"
+ "\001\210\001\354\001\207\001\211\001\356\001\355\001\211\001\355\001\210"
+ "\001\212\001\357\001\356\001\212\001\356\001\211\001\213\001\360\001\357"
+ "\001\213\001\357\001\212\001\214\001\361\001\360\001\214\001\360\001\213"
+ "\001\215\001\362\001\361\001\215\001\361\001\214\001\216\001\363\001\362"
+ "\001\216\001\362\001\215\001\217\001\221\001\363\001\217\001\363\001\216"
+ "\001\221\001\364\001\365\001\221\001\365\001\363\001\220\001\366\001\364"
+ "\001\220\001\364\001\221\001\222\001\367\001\366\001\222\001\366\001\220"
+ "\001\223\001\370\001\367\001\223\001\367\001\222\001\224\001\371\001\370"
+ "\001\224\001\370\001\223\001\225\001\372\001\371\001\225\001\371\001\224"
+ "\001\226\001\373\001\372\001\226\001\372\001\225\001\227\001\374\001\373"
+ "\001\227\001\373\001\226\001\230\001\375\001\374\001\230\001\374\001\227"
+ "\001\231\001\376\001\375\001\231\001\375\001\230\001\232\001\377\001\376"
+ "\001\232\001\376\001\231\001\233\001\000\002\377\001\233\001\377\001\232"
+ "\001\234\001\001\002\000\002\234\001\000\002\233\001\235\001\002\002\001"
+ "\002\235\001\001\002\234\001\236\001\003\002\002\002\236\001\002\002\235"
+ "\001\237\001\004\002\003\002\237\001\003\002\236\001\240\001\005\002\004"
+ "\002\240\001\004\002\237\001\241\001\006\002\005\002\241\001\005\002\240"
+ "\001\242\001\007\002\006\002\242\001\006\002\241\001\243\001\010\002\007"
+ "\002\243\001\007\002\242\001\244\001\011\002\010\002\244\001\010\002\243"
+ "\001\245\001\012\002\011\002\245\001\011\002\244\001\246\001\013\002\012"
+ "\002\246\001\012\002\245\001\247\001\014\002\013\002\247\001\013\002\246"
+ "\001\250\001\015\002\014\002\250\001\014\002\247\001\251\001\016\002\015"
+ "\002\251\001\015\002\250\001\252\001\017\002\016\002\252\001\016\002\251"
+ "\001\253\001\020\002\017\002\253\001\017\002\252\001\254\001\021\002\020"
+ "\002\254\001\020\002\253\001\255\001\022\002\021\002\255\001\021\002\254"
+ "\001\256\001\023\002\022\002\256\001\022\002\255\001\257\001\024\002\023"
+ "\002\257\001\023\002\256\001\260\001\025\002\024\002\260\001\024\002\257"
+ "\001\261\001\026\002\025\002\261\001\025\002\260\001\262\001\027\002\026"
+ "\002\262\001\026\002\261\001\263\001\030\002\027\002\263\001\027\002\262"
+ "\001\264\001\031\002\030\002\264\001\030\002\263\001\265\001\032\002\031"
+ "\002\265\001\031\002\264\001\266\001\033\002\032\002\266\001\032\002\265"
+ "\001\267\001\034\002\033\002\267\001\033\002\266\001\270\001\035\002\034"
+ "\002\270\001\034\002\267\001\271\001\036\002\035\002\271\001\035\002\270"
+ "\001\272\001\037\002\036\002\272\001\036\002\271\001\273\001 \002\037\002"
+ "\273\001\037\002\272\001\274\001!\002 \002\274\001 \002\273\001\275\001\042"
+ "\002!\002\275\001!\002\274\001\276\001#\002\042\002\276\001\042\002\275\001"
+ "\277\001$\002#\002\277\001#\002\276\001\300\001%\002$\002\300\001$\002\277"
+ "\001\301\001&\002%\002\301\001%\002\300\001\302\001'\002&\002\302\001&\002"
+ "\301\001\303\001(\002'\002\303\001'\002\302\001\304\001)\002(\002\304\001"
+ "(\002\303\001\305\001*\002)\002\305\001)\002\304\001\306\001+\002*\002\306"
+ "\001*\002\305\001\307\001,\002+\002\307\001+\002\306\001\310\001-\002,\002"
+ "\310\001,\002\307\001\311\001.\002-\002\311\001-\002\310\001\312\001/\002"
+ ".\002\312\001.\002\311\001\313\0010\002/\002\313\001/\002\312\001\314\001"
+ "1\0020\002\314\0010\002\313\001\315\0012\0021\002\315\0011\002\314\001\316"
+ "\0013\0022\002\316\0012\002\315\001\317\0014\0023\002\317\0013\002\316\001"
+ "\320\0015\0024\002\320\0014\002\317\001\321\0016\0025\002\321\0015\002\320"
+ "\001\322\0017\0026\002\322\0016\002\321\001\323\0018\0027\002\323\0017\002"
+ "\322\001\324\0019\0028\002\324\0018\002\323\001\325\001:\0029\002\325\001"
+ "9\002\324\001\326\001;\002:\002\326\001:\002\325\001\327\001<\002;\002\327"
+ "\001;\002\326\001\330\001=\002<\002\330\001<\002\327\001\331\001>\002=\002"
+ "\331\001=\002\330\001\332\001\077\002>\002\332\001>\002\331\001\333\001@"
+ "\002\077\002\333\001\077\002\332\001\334\001A\002@\002\334\001@\002\333\001"
+ "\335\001B\002A\002\335\001A\002\334\001\336\001C\002B\002\336\001B\002\335"
+ "\001\337\001D\002C\002\337\001C\002\336\001\340\001E\002D\002\340\001D\002"
+ "\337\001\341\001F\002E\002\341\001E\002\340\001\342\001G\002F\002\342\001"
+ "F\002\341\001\343\001H\002G\002\343\001G\002\342\001\344\001I\002H\002\344"
+ "\001H\002\343\001\345\001J\002I\002\345\001I\002\344\001\346\001K\002J\002"
+ "\346\001J\002\345\001\347\001L\002K\002\347\001K\002\346\001\350\001M\002"
+ "L\002\350\001L\002\347\001\351\001N\002M\002\351\001M\002\350\001\352\001"
+ "O\002N\002\352\001N\002\351\001\353\001P\002O\002\353\001O\002\352\001\354"
+ "\001Q\002P\002\354\001P\002\353\001\355\001R\002Q\002\355\001Q\002\354\001"
+ "\356\001S\002R\002\356\001R\002\355\001\357\001T\002S\002\357\001S\002\356"
+ "\001\360\001U\002T\002\360\001T\002\357\001\361\001V\002U\002\361\001U\002"
+ "\360\001\362\001W\002V\002\362\001V\002\361\001\363\001\365\001W\002\363"
+ "\001W\002\362\001\365\001X\002Y\002\365\001Y\002W\002\364\001Z\002X\002\364"
+ "\001X\002\365\001\366\001[\002Z\002\366\001Z\002\364\001\367\001\134\002"
+ "[\002\367\001[\002\366\001\370\001]\002\134\002\370\001\134\002\367\001\371"
+ "\001^\002]\002\371\001]\002\370\001\372\001_\002^\002\372\001^\002\371\001"
+ "\373\001`\002_\002\373\001_\002\372\001\374\001a\002`\002\374\001`\002\373"
+ "\001\375\001b\002a\002\375\001a\002\374\001\376\001c\002b\002\376\001b\002"
+ "\375\001\377\001d\002c\002\377\001c\002\376\001\000\002e\002d\002\000\002"
+ "d\002\377\001\001\002f\002e\002\001\002e\002\000\002\002\002g\002f\002\002"
+ "\002f\002\001\002\003\002h\002g\002\003\002g\002\002\002\004\002i\002h\002"
+ "\004\002h\002\003\002\005\002j\002i\002\005\002i\002\004\002\006\002k\002"
+ "j\002\006\002j\002\005\002\007\002l\002k\002\007\002k\002\006\002\010\002"
+ "m\002l\002\010\002l\002\007\002\011\002n\002m\002\011\002m\002\010\002\012"
+ "\002o\002n\002\012\002n\002\011\002\013\002p\002o\002\013\002o\002\012\002"
+ "\014\002q\002p\002\014\002p\002\013\002\015\002r\002q\002\015\002q\002\014"
+ "\002\016\002s\002r\002\016\002r\002\015\002\017\002t\002s\002\017\002s\002"
+ "\016\002\020\002u\002t\002\020\002t\002\017\002\021\002v\002u\002\021\002"
+ "u\002\020\002\022\002w\002v\002\022\002v\002\021\002\023\002x\002w\002\023"
+ "\002w\002\022\002\024\002y\002x\002\024\002x\002\023\002\025\002z\002y\002"
+ "\025\002y\002\024\002\026\002{\002z\002\026\002z\002\025\002\027\002|\002"
+ "{\002\027\002{\002\026\002\030\002}\002|\002\030\002|\002\027\002\031\002"
+ "~\002}\002\031\002}\002\030\002\032\002\177\002~\002\032\002~\002\031\002"
+ "\033\002\200\002\177\002\033\002\177\002\032\002\034\002\201\002\200\002"
+ "\034\002\200\002\033\002\035\002\202\002\201\002\035\002\201\002\034\002"
+ "\036\002\203\002\202\002\036\002\202\002\035\002\037\002\204\002\203\002"
+ "\037\002\203\002\036\002 \002\205\002\204\002 \002\204\002\037\002!\002\206"
+ "\002\205\002!\002\205\002 \002\042\002\207\002\206\002\042\002\206\002!\002"
+ "#\002\210\002\207\002#\002\207\002\042\002$\002\211\002\210\002$\002\210"
+ "\002#\002%\002\212\002\211\002%\002\211\002$\002&\002\213\002\212\002&\002"
+ "\212\002%\002'\002\214\002\213\002'\002\213\002&\002(\002\215\002\214\002"
+ "(\002\214\002'\002)\002\216\002\215\002)\002\215\002(\002*\002\217\002\216"
+ "\002*\002\216\002)\002+\002\220\002\217\002+\002\217\002*\002,\002\221\002"
+ "\220\002,\002\220\002+\002-\002\222\002\221\002-\002\221\002,\002.\002\223"
+ "\002\222\002.\002\222\002-\002/\002\224\002\223\002/\002\223\002.\0020\002"
+ "\225\002\224\0020\002\224\002/\0021\002\226\002\225\0021\002\225\0020\002"
+ "2\002\227\002\226\0022\002\226\0021\0023\002\230\002\227\0023\002\227\002"
+ "2\0024\002\231\002\230\0024\002\230\0023\0025\002\232\002\231\0025\002\231"
+ "\0024\0026\002\233\002\232\0026\002\232\0025\0027\002\234\002\233\0027\002"
+ "\233\0026\0028\002\235\002\234\0028\002\234\0027\0029\002\236\002\235\002"
+ "9\002\235\0028\002:\002\237\002\236\002:\002\236\0029\002;\002\240\002\237"
+ "\002;\002\237\002:\002<\002\241\002\240\002<\002\240\002;\002=\002\242\002"
+ "\241\002=\002\241\002<\002>\002\243\002\242\002>\002\242\002=\002\077\002"
+ "\244\002\243\002\077\002\243\002>\002@\002\245\002\244\002@\002\244\002\077"
+ "\002A\002\246\002\245\002A\002\245\002@\002B\002\247\002\246\002B\002\246"
+ "\002A\002C\002\250\002\247\002C\002\247\002B\002D\002\251\002\250\002D\002"
+ "\250\002C\002E\002\252\002\251\002E\002\251\002D\002F\002\253\002\252\002"
+ "F\002\252\002E\002G\002\254\002\253\002G\002\253\002F\002H\002\255\002\254"
+ "\002H\002\254\002G\002I\002\256\002\255\002I\002\255\002H\002J\002\257\002"
+ "\256\002J\002\256\002I\002K\002\260\002\257\002K\002\257\002J\002L\002\261"
+ "\002\260\002L\002\260\002K\002M\002\262\002\261\002M\002\261\002L\002N\002"
+ "\263\002\262\002N\002\262\002M\002O\002\264\002\263\002O\002\263\002N\002"
+ "P\002\265\002\264\002P\002\264\002O\002Q\002\266\002\265\002Q\002\265\002"
+ "P\002R\002\267\002\266\002R\002\266\002Q\002S\002\270\002\267\002S\002\267"
+ "\002R\002T\002\271\002\270\002T\002\270\002S\002U\002\272\002\271\002U\002"
+ "\271\002T\002V\002\273\002\272\002V\002\272\002U\002W\002Y\002\273\002W\002"
+ "\273\002V\002Y\002\274\002\275\002Y\002\275\002\273\002X\002\276\002\274"
+ "\002X\002\274\002Y\002Z\002\277\002\276\002Z\002\276\002X\002[\002\300\002"
+ "\277\002[\002\277\002Z\002\134\002\301\002\300\002\134\002\300\002[\002]"
+ "\002\302\002\301\002]\002\301\002\134\002^\002\303\002\302\002^\002\302\002"
+ "]\002_\002\304\002\303\002_\002\303\002^\002`\002\305\002\304\002`\002\304"
+ "\002_\002a\002\306\002\305\002a\002\305\002`\002b\002\307\002\306\002b\002"
+ "\306\002a\002c\002\310\002\307\002c\002\307\002b\002d\002\311\002\310\002"
+ "d\002\310\002c\002e\002\312\002\311\002e\002\311\002d\002f\002\313\002\312"
+ "\002f\002\312\002e\002g\002\314\002\313\002g\002\313\002f\002h\002\315\002"
+ "\314\002h\002\314\002g\002i\002\316\002\315\002i\002\315\002h\002j\002\317"
+ "\002\316\002j\002\316\002i\002k\002\320\002\317\002k\002\317\002j\002l\002"
+ "\321\002\320\002l\002\320\002k\002m\002\322\002\321\002m\002\321\002l\002"
+ "n\002\323\002\322\002n\002\322\002m\002o\002\324\002\323\002o\002\323\002"
+ "n\002p\002\325\002\324\002p\002\324\002o\002q\002\326\002\325\002q\002\325"
+ "\002p\002r\002\327\002\326\002r\002\326\002q\002s\002\330\002\327\002s\002"
+ "\327\002r\002t\002\331\002\330\002t\002\330\002s\002u\002\332\002\331\002"
+ "u\002\331\002t\002v\002\333\002\332\002v\002\332\002u\002w\002\334\002\333"
+ "\002w\002\333\002v\002x\002\335\002\334\002x\002\334\002w\002y\002\336\002"
+ "\335\002y\002\335\002x\002z\002\337\002\336\002z\002\336\002y\002{\002\340"
+ "\002\337\002{\002\337\002z\002|\002\341\002\340\002|\002\340\002{\002}\002"
+ "\342\002\341\002}\002\341\002|\002~\002\343\002\342\002~\002\342\002}\002"
+ "\177\002\344\002\343\002\177\002\343\002~\002\200\002\345\002\344\002\200"
+ "\002\344\002\177\002\201\002\346\002\345\002\201\002\345\002\200\002\202"
+ "\002\347\002\346\002\202\002\346\002\201\002\203\002\350\002\347\002\203"
+ "\002\347\002\202\002\204\002\351\002\350\002\204\002\350\002\203\002\205"
+ "\002\352\002\351\002\205\002\351\002\204\002\206\002\353\002\352\002\206"
+ "\002\352\002\205\002\207\002\354\002\353\002\207\002\353\002\206\002\210"
+ "\002\355\002\354\002\210\002\354\002\207\002\211\002\356\002\355\002\211"
+ "\002\355\002\210\002\212\002\357\002\356\002\212\002\356\002\211\002\213"
+ "\002\360\002\357\002\213\002\357\002\212\002\214\002\361\002\360\002\214"
+ "\002\360\002\213\002\215\002\362\002\361\002\215\002\361\002\214\002\216"
+ "\002\363\002\362\002\216\002\362\002\215\002\217\002\364\002\363\002\217"
+ "\002\363\002\216\002\220\002\365\002\364\002\220\002\364\002\217\002\221"
+ "\002\366\002\365\002\221\002\365\002\220\002\222\002\367\002\366\002\222"
+ "\002\366\002\221\002\223\002\370\002\367\002\223\002\367\002\222\002\224"
+ "\002\371\002\370\002\224\002\370\002\223\002\225\002\372\002\371\002\225"
+ "\002\371\002\224\002\226\002\373\002\372\002\226\002\372\002\225\002\227"
+ "\002\374\002\373\002\227\002\373\002\226\002\230\002\375\002\374\002\230"
+ "\002\374\002\227\002\231\002\376\002\375\002\231\002\375\002\230\002\232"
+ "\002\377\002\376\002\232\002\376\002\231\002\233\002\000\003\377\002\233"
+ "\002\377\002\232\002\234\002\001\003\000\003\234\002\000\003\233\002\235"
+ "\002\002\003\001\003\235\002\001\003\234\002\236\002\003\003\002\003\236"
+ "\002\002\003\235\002\237\002\004\003\003\003\237\002\003\003\236\002\240"
+ "\002\005\003\004\003\240\002\004\003\237\002\241\002\006\003\005\003\241"
+ "\002\005\003\240\002\242\002\007\003\006\003\242\002\006\003\241\002\243"
+ "\002\010\003\007\003\243\002\007\003\242\002\244\002\011\003\010\003\244"
+ "\002\010\003\243\002\245\002\012\003\011\003\245\002\011\003\244\002\246"
+ "\002\013\003\012\003\246\002\012\003\245\002\247\002\014\003\013\003\247"
+ "\002\013\003\246\002\250\002\015\003\014\003\250\002\014\003\247\002\251"
+ "\002\016\003\015\003\251\002\015\003\250\002\252\002\017\003\016\003\252"
+ "\002\016\003\251\002\253\002\020\003\017\003\253\002\017\003\252\002\254"
+ "\002\021\003\020\003\254\002\020\003\253\002\255\002\022\003\021\003\255"
+ "\002\021\003\254\002\256\002\023\003\022\003\256\002\022\003\255\002\257"
+ "\002\024\003\023\003\257\002\023\003\256\002\260\002\025\003\024\003\260"
+ "\002\024\003\257\002\261\002\026\003\025\003\261\002\025\003\260\002\262"
+ "\002\027\003\026\003\262\002\026\003\261\002\263\002\030\003\027\003\263"
+ "\002\027\003\262\002\264\002\031\003\030\003\264\002\030\003\263\002\265"
+ "\002\032\003\031\003\265\002\031\003\264\002\266\002\033\003\032\003\266"
+ "\002\032\003\265\002\267\002\034\003\033\003\267\002\033\003\266\002\270"
+ "\002\035\003\034\003\270\002\034\003\267\002\271\002\036\003\035\003\271"
+ "\002\035\003\270\002\272\002\037\003\036\003\272\002\036\003\271\002\273"
+ "\002\275\002\037\003\273\002\037\003\272\002\275\002 \003!\003\275\002!\003"
+ "\037\003\274\002\042\003 \003\274\002 \003\275\002\276\002#\003\042\003\276"
+ "\002\042\003\274\002\277\002$\003#\003\277\002#\003\276\002\300\002%\003"
+ "$\003\300\002$\003\277\002\301\002&\003%\003\301\002%\003\300\002\302\002"
+ "'\003&\003\302\002&\003\301\002\303\002(\003'\003\303\002'\003\302\002\304"
+ "\002)\003(\003\304\002(\003\303\002\305\002*\003)\003\305\002)\003\304\002"
+ "\306\002+\003*\003\306\002*\003\305\002\307\002,\003+\003\307\002+\003\306"
+ "\002\310\002-\003,\003\310\002,\003\307\002\311\002.\003-\003\311\002-\003"
+ "\310\002\312\002/\003.\003\312\002.\003\311\002\313\0020\003/\003\313\002"
+ "/\003\312\002\314\0021\0030\003\314\0020\003\313\002\315\0022\0031\003\315"
+ "\0021\003\314\002\316\0023\0032\003\316\0022\003\315\002\317\0024\0033\003"
+ "\317\0023\003\316\002\320\0025\0034\003\320\0024\003\317\002\321\0026\003"
+ "5\003\321\0025\003\320\002\322\0027\0036\003\322\0026\003\321\002\323\002"
+ "8\0037\003\323\0027\003\322\002\324\0029\0038\003\324\0028\003\323\002\325"
+ "\002:\0039\003\325\0029\003\324\002\326\002;\003:\003\326\002:\003\325\002"
+ "\327\002<\003;\003\327\002;\003\326\002\330\002=\003<\003\330\002<\003\327"
+ "\002\331\002>\003=\003\331\002=\003\330\002\332\002\077\003>\003\332\002"
+ ">\003\331\002\333\002@\003\077\003\333\002\077\003\332\002\334\002A\003@"
+ "\003\334\002@\003\333\002\335\002B\003A\003\335\002A\003\334\002\336\002"
+ "C\003B\003\336\002B\003\335\002\337\002D\003C\003\337\002C\003\336\002\340"
+ "\002E\003D\003\340\002D\003\337\002\341\002F\003E\003\341\002E\003\340\002"
+ "\342\002G\003F\003\342\002F\003\341\002\343\002H\003G\003\343\002G\003\342"
+ "\002\344\002I\003H\003\344\002H\003\343\002\345\002J\003I\003\345\002I\003"
+ "\344\002\346\002K\003J\003\346\002J\003\345\002\347\002L\003K\003\347\002"
+ "K\003\346\002\350\002M\003L\003\350\002L\003\347\002\351\002N\003M\003\351"
+ "\002M\003\350\002\352\002O\003N\003\352\002N\003\351\002\353\002P\003O\003"
+ "\353\002O\003\352\002\354\002Q\003P\003\354\002P\003\353\002\355\002R\003"
+ "Q\003\355\002Q\003\354\002\356\002S\003R\003\356\002R\003\355\002\357\002"
+ "T\003S\003\357\002S\003\356\002\360\002U\003T\003\360\002T\003\357\002\361"
+ "\002V\003U\003\361\002U\003\360\002\362\002W\003V\003\362\002V\003\361\002"
+ "\363\002X\003W\003\363\002W\003\362\002\364\002Y\003X\003\364\002X\003\363"
+ "\002\365\002Z\003Y\003\365\002Y\003\364\002\366\002[\003Z\003\366\002Z\003"
+ "\365\002\367\002\134\003[\003\367\002[\003\366\002\370\002]\003\134\003\370"
+ "\002\134\003\367\002\371\002^\003]\003\371\002]\003\370\002\372\002_\003"
+ "^\003\372\002^\003\371\002\373\002`\003_\003\373\002_\003\372\002\374\002"
+ "a\003`\003\374\002`\003\373\002\375\002b\003a\003\375\002a\003\374\002\376"
+ "\002c\003b\003\376\002b\003\375\002\377\002d\003c\003\377\002c\003\376\002"
+ "\000\003e\003d\003\000\003d\003\377\002\001\003f\003e\003\001\003e\003\000"
+ "\003\002\003g\003f\003\002\003f\003\001\003\003\003h\003g\003\003\003g\003"
+ "\002\003\004\003i\003h\003\004\003h\003\003\003\005\003j\003i\003\005\003"
+ "i\003\004\003\006\003k\003j\003\006\003j\003\005\003\007\003l\003k\003\007"
+ "\003k\003\006\003\010\003m\003l\003\010\003l\003\007\003\011\003n\003m\003"
+ "\011\003m\003\010\003\012\003o\003n\003\012\003n\003\011\003\013\003p\003"
+ "o\003\013\003o\003\012\003\014\003q\003p\003\014\003p\003\013\003\015\003"
+ "r\003q\003\015\003q\003\014\003\016\003s\003r\003\016\003r\003\015\003\017"
+ "\003t\003s\003\017\003s\003\016\003\020\003u\003t\003\020\003t\003\017\003"
+ "\021\003v\003u\003\021\003u\003\020\003\022\003w\003v\003\022\003v\003\021"
+ "\003\023\003x\003w\003\023\003w\003\022\003\024\003y\003x\003\024\003x\003"
+ "\023\003\025\003z\003y\003\025\003y\003\024\003\026\003{\003z\003\026\003"
+ "z\003\025\003\027\003|\003{\003\027\003{\003\026\003\030\003}\003|\003\030"
+ "\003|\003\027\003\031\003~\003}\003\031\003}\003\030\003\032\003\177\003"
+ "~\003\032\003~\003\031\003\033\003\200\003\177\003\033\003\177\003\032\003"
+ "\034\003\201\003\200\003\034\003\200\003\033\003\035\003\202\003\201\003"
+ "\035\003\201\003\034\003\036\003\203\003\202\003\036\003\202\003\035\003"
+ "\037\003!\003\203\003\037\003\203\003\036\003!\003\204\003\205\003!\003\205"
+ "\003\203\003 \003\206\003\204\003 \003\204\003!\003\042\003\207\003\206\003"
+ "\042\003\206\003 \003#\003\210\003\207\003#\003\207\003\042\003$\003\211"
+ "\003\210\003$\003\210\003#\003%\003\212\003\211\003%\003\211\003$\003&\003"
+ "\213\003\212\003&\003\212\003%\003'\003\214\003\213\003'\003\213\003&\003"
+ "(\003\215\003\214\003(\003\214\003'\003)\003\216\003\215\003)\003\215\003"
+ "(\003*\003\217\003\216\003*\003\216\003)\003+\003\220\003\217\003+\003\217"
+ "\003*\003,\003\221\003\220\003,\003\220\003+\003-\003\222\003\221\003-\003"
+ "\221\003,\003.\003\223\003\222\003.\003\222\003-\003/\003\224\003\223\003"
+ "/\003\223\003.\0030\003\225\003\224\0030\003\224\003/\0031\003\226\003\225"
+ "\0031\003\225\0030\0032\003\227\003\226\0032\003\226\0031\0033\003\230\003"
+ "\227\0033\003\227\0032\0034\003\231\003\230\0034\003\230\0033\0035\003\232"
+ "\003\231\0035\003\231\0034\0036\003\233\003\232\0036\003\232\0035\0037\003"
+ "\234\003\233\0037\003\233\0036\0038\003\235\003\234\0038\003\234\0037\003"
+ "9\003\236\003\235\0039\003\235\0038\003:\003\237\003\236\003:\003\236\003"
+ "9\003;\003\240\003\237\003;\003\237\003:\003<\003\241\003\240\003<\003\240"
+ "\003;\003=\003\242\003\241\003=\003\241\003<\003>\003\243\003\242\003>\003"
+ "\242\003=\003\077\003\244\003\243\003\077\003\243\003>\003@\003\245\003\244"
+ "\003@\003\244\003\077\003A\003\246\003\245\003A\003\245\003@\003B\003\247"
+ "\003\246\003B\003\246\003A\003C\003\250\003\247\003C\003\247\003B\003D\003"
+ "\251\003\250\003D\003\250\003C\003E\003\252\003\251\003E\003\251\003D\003"
+ "F\003\253\003\252\003F\003\252\003E\003G\003\254\003\253\003G\003\253\003"
+ "F\003H\003\255\003\254\003H\003\254\003G\003I\003\256\003\255\003I\003\255"
+ "\003H\003J\003\257\003\256\003J\003\256\003I\003K\003\260\003\257\003K\003"
+ "\257\003J\003L\003\261\003\260\003L\003\260\003K\003M\003\262\003\261\003"
+ "M\003\261\003L\003N\003\263\003\262\003N\003\262\003M\003O\003\264\003\263"
+ "\003O\003\263\003N\003P\003\265\003\264\003P\003\264\003O\003Q\003\266\003"
+ "\265\003Q\003\265\003P\003R\003\267\003\266\003R\003\266\003Q\003S\003\270"
+ "\003\267\003S\003\267\003R\003T\003\271\003\270\003T\003\270\003S\003U\003"
+ "\272\003\271\003U\003\271\003T\003V\003\273\003\272\003V\003\272\003U\003"
+ "W\003\274\003\273\003W\003\273\003V\003X\003\275\003\274\003X\003\274\003"
+ "W\003Y\003\276\003\275\003Y\003\275\003X\003Z\003\277\003\276\003Z\003\276"
+ "\003Y\003[\003\300\003\277\003[\003\277\003Z\003\134\003\301\003\300\003"
+ "\134\003\300\003[\003]\003\302\003\301\003]\003\301\003\134\003^\003\303"
+ "\003\302\003^\003\302\003]\003_\003\304\003\303\003_\003\303\003^\003`\003"
+ "\305\003\304\003`\003\304\003_\003a\003\306\003\305\003a\003\305\003`\003"
+ "b\003\307\003\306\003b\003\306\003a\003c\003\310\003\307\003c\003\307\003"
+ "b\003d\003\311\003\310\003d\003\310\003c\003e\003\312\003\311\003e\003\311"
+ "\003d\003f\003\313\003\312\003f\003\312\003e\003g\003\314\003\313\003g\003"
+ "\313\003f\003h\003\315\003\314\003h\003\314\003g\003i\003\316\003\315\003"
+ "i\003\315\003h\003j\003\317\003\316\003j\003\316\003i\003k\003\320\003\317"
+ "\003k\003\317\003j\003l\003\321\003\320\003l\003\320\003k\003m\003\322\003"
+ "\321\003m\003\321\003l\003n\003\323\003\322\003n\003\322\003m\003o\003\324"
+ "\003\323\003o\003\323\003n\003p\003\325\003\324\003p\003\324\003o\003q\003"
+ "\326\003\325\003q\003\325\003p\003r\003\327\003\326\003r\003\326\003q\003"
+ "s\003\330\003\327\003s\003\327\003r\003t\003\331\003\330\003t\003\330\003"
+ "s\003u\003\332\003\331\003u\003\331\003t\003v\003\333\003\332\003v\003\332"
+ "\003u\003w\003\334\003\333\003w\003\333\003v\003x\003\335\003\334\003x\003"
+ "\334\003w\003y\003\336\003\335\003y\003\335\003x\003z\003\337\003\336\003"
+ "z\003\336\003y\003{\003\340\003\337\003{\003\337\003z\003|\003\341\003\340"
+ "\003|\003\340\003{\003}\003\342\003\341\003}\003\341\003|\003~\003\343\003"
+ "\342\003~\003\342\003}\003\177\003\344\003\343\003\177\003\343\003~\003\200"
+ "\003\345\003\344\003\200\003\344\003\177\003\201\003\346\003\345\003\201"
+ "\003\345\003\200\003\202\003\347\003\346\003\202\003\346\003\201\003\203"
+ "\003\205\003\347\003\203\003\347\003\202\003\205\003\350\003\351\003\205"
+ "\003\351\003\347\003\204\003\352\003\350\003\204\003\350\003\205\003\206"
+ "\003\353\003\352\003\206\003\352\003\204\003\207\003\354\003\353\003\207"
+ "\003\353\003\206\003\210\003\355\003\354\003\210\003\354\003\207\003\211"
+ "\003\356\003\355\003\211\003\355\003\210\003\212\003\357\003\356\003\212"
+ "\003\356\003\211\003\213\003\360\003\357\003\213\003\357\003\212\003\214"
+ "\003\361\003\360\003\214\003\360\003\213\003\215\003\362\003\361\003\215"
+ "\003\361\003\214\003\216\003\363\003\362\003\216\003\362\003\215\003\217"
+ "\003\364\003\363\003\217\003\363\003\216\003\220\003\365\003\364\003\220"
+ "\003\364\003\217\003\221\003\366\003\365\003\221\003\365\003\220\003\222"
+ "\003\367\003\366\003\222\003\366\003\221\003\223\003\370\003\367\003\223"
+ "\003\367\003\222\003\224\003\371\003\370\003\224\003\370\003\223\003\225"
+ "\003\372\003\371\003\225\003\371\003\224\003\226\003\373\003\372\003\226"
+ "\003\372\003\225\003\227\003\374\003\373\003\227\003\373\003\226\003\230"
+ "\003\375\003\374\003\230\003\374\003\227\003\231\003\376\003\375\003\231"
+ "\003\375\003\230\003\232\003\377\003\376\003\232\003\376\003\231\003\233"
+ "\003\000\004\377\003\233\003\377\003\232\003\234\003\001\004\000\004\234"
+ "\003\000\004\233\003\235\003\002\004\001\004\235\003\001\004\234\003\236"
+ "\003\003\004\002\004\236\003\002\004\235\003\237\003\004\004\003\004\237"
+ "\003\003\004\236\003\240\003\005\004\004\004\240\003\004\004\237\003\241"
+ "\003\006\004\005\004\241\003\005\004\240\003\242\003\007\004\006\004\242"
+ "\003\006\004\241\003\243\003\010\004\007\004\243\003\007\004\242\003\244"
+ "\003\011\004\010\004\244\003\010\004\243\003\245\003\012\004\011\004\245"
+ "\003\011\004\244\003\246\003\013\004\012\004\246\003\012\004\245\003\247"
+ "\003\014\004\013\004\247\003\013\004\246\003\250\003\015\004\014\004\250"
+ "\003\014\004\247\003\251\003\016\004\015\004\251\003\015\004\250\003\252"
+ "\003\017\004\016\004\252\003\016\004\251\003\253\003\020\004\017\004\253"
+ "\003\017\004\252\003\254\003\021\004\020\004\254\003\020\004\253\003\255"
+ "\003\022\004\021\004\255\003\021\004\254\003\256\003\023\004\022\004\256"
+ "\003\022\004\255\003\257\003\024\004\023\004\257\003\023\004\256\003\260"
+ "\003\025\004\024\004\260\003\024\004\257\003\261\003\026\004\025\004\261"
+ "\003\025\004\260\003\262\003\027\004\026\004\262\003\026\004\261\003\263"
+ "\003\030\004\027\004\263\003\027\004\262\003\264\003\031\004\030\004\264"
+ "\003\030\004\263\003\265\003\032\004\031\004\265\003\031\004\264\003\266"
+ "\003\033\004\032\004\266\003\032\004\265\003\267\003\034\004\033\004\267"
+ "\003\033\004\266\003\270\003\035\004\034\004\270\003\034\004\267\003\271"
+ "\003\036\004\035\004\271\003\035\004\270\003\272\003\037\004\036\004\272"
+ "\003\036\004\271\003\273\003 \004\037\004\273\003\037\004\272\003\274\003"
+ "!\004 \004\274\003 \004\273\003\275\003\042\004!\004\275\003!\004\274\003"
+ "\276\003#\004\042\004\276\003\042\004\275\003\277\003$\004#\004\277\003#"
+ "\004\276\003\300\003%\004$\004\300\003$\004\277\003\301\003&\004%\004\301"
+ "\003%\004\300\003\302\003'\004&\004\302\003&\004\301\003\303\003(\004'\004"
+ "\303\003'\004\302\003\304\003)\004(\004\304\003(\004\303\003\305\003*\004"
+ ")\004\305\003)\004\304\003\306\003+\004*\004\306\003*\004\305\003\307\003"
+ ",\004+\004\307\003+\004\306\003\310\003-\004,\004\310\003,\004\307\003\311"
+ "\003.\004-\004\311\003-\004\310\003\312\003/\004.\004\312\003.\004\311\003"
+ "\313\0030\004/\004\313\003/\004\312\003\314\0031\0040\004\314\0030\004\313"
+ "\003\315\0032\0041\004\315\0031\004\314\003\316\0033\0042\004\316\0032\004"
+ "\315\003\317\0034\0043\004\317\0033\004\316\003\320\0035\0044\004\320\003"
+ "4\004\317\003\321\0036\0045\004\321\0035\004\320\003\322\0037\0046\004\322"
+ "\0036\004\321\003\323\0038\0047\004\323\0037\004\322\003\324\0039\0048\004"
+ "\324\0038\004\323\003\325\003:\0049\004\325\0039\004\324\003\326\003;\004"
+ ":\004\326\003:\004\325\003\327\003<\004;\004\327\003;\004\326\003\330\003"
+ "=\004<\004\330\003<\004\327\003\331\003>\004=\004\331\003=\004\330\003\332"
+ "\003\077\004>\004\332\003>\004\331\003\333\003@\004\077\004\333\003\077\004"
+ "\332\003\334\003A\004@\004\334\003@\004\333\003\335\003B\004A\004\335\003"
+ "A\004\334\003\336\003C\004B\004\336\003B\004\335\003\337\003D\004C\004\337"
+ "\003C\004\336\003\340\003E\004D\004\340\003D\004\337\003\341\003F\004E\004"
+ "\341\003E\004\340\003\342\003G\004F\004\342\003F\004\341\003\343\003H\004"
+ "G\004\343\003G\004\342\003\344\003I\004H\004\344\003H\004\343\003\345\003"
+ "J\004I\004\345\003I\004\344\003\346\003K\004J\004\346\003J\004\345\003\347"
+ "\003\351\003K\004\347\003K\004\346\003\351\003L\004M\004\351\003M\004K\004"
+ "\350\003N\004L\004\350\003L\004\351\003\352\003O\004N\004\352\003N\004\350"
+ "\003\353\003P\004O\004\353\003O\004\352\003\354\003Q\004P\004\354\003P\004"
+ "\353\003\355\003R\004Q\004\355\003Q\004\354\003\356\003S\004R\004\356\003"
+ "R\004\355\003\357\003T\004S\004\357\003S\004\356\003\360\003U\004T\004\360"
+ "\003T\004\357\003\361\003V\004U\004\361\003U\004\360\003\362\003W\004V\004"
+ "\362\003V\004\361\003\363\003X\004W\004\363\003W\004\362\003\364\003Y\004"
+ "X\004\364\003X\004\363\003\365\003Z\004Y\004\365\003Y\004\364\003\366\003"
+ "[\004Z\004\366\003Z\004\365\003\367\003\134\004[\004\367\003[\004\366\003"
+ "\370\003]\004\134\004\370\003\134\004\367\003\371\003^\004]\004\371\003]"
+ "\004\370\003\372\003_\004^\004\372\003^\004\371\003\373\003`\004_\004\373"
+ "\003_\004\372\003\374\003a\004`\004\374\003`\004\373\003\375\003b\004a\004"
+ "\375\003a\004\374\003\376\003c\004b\004\376\003b\004\375\003\377\003d\004"
+ "c\004\377\003c\004\376\003\000\004e\004d\004\000\004d\004\377\003\001\004"
+ "f\004e\004\001\004e\004\000\004\002\004g\004f\004\002\004f\004\001\004\003"
+ "\004h\004g\004\003\004g\004\002\004\004\004i\004h\004\004\004h\004\003\004"
+ "\005\004j\004i\004\005\004i\004\004\004\006\004k\004j\004\006\004j\004\005"
+ "\004\007\004l\004k\004\007\004k\004\006\004\010\004m\004l\004\010\004l\004"
+ "\007\004\011\004n\004m\004\011\004m\004\010\004\012\004o\004n\004\012\004"
+ "n\004\011\004\013\004p\004o\004\013\004o\004\012\004\014\004q\004p\004\014"
+ "\004p\004\013\004\015\004r\004q\004\015\004q\004\014\004\016\004s\004r\004"
+ "\016\004r\004\015\004\017\004t\004s\004\017\004s\004\016\004\020\004u\004"
+ "t\004\020\004t\004\017\004\021\004v\004u\004\021\004u\004\020\004\022\004"
+ "w\004v\004\022\004v\004\021\004\023\004x\004w\004\023\004w\004\022\004\024"
+ "\004y\004x\004\024\004x\004\023\004\025\004z\004y\004\025\004y\004\024\004"
+ "\026\004{\004z\004\026\004z\004\025\004\027\004|\004{\004\027\004{\004\026"
+ "\004\030\004}\004|\004\030\004|\004\027\004\031\004~\004}\004\031\004}\004"
+ "\030\004\032\004\177\004~\004\032\004~\004\031\004\033\004\200\004\177\004"
+ "\033\004\177\004\032\004\034\004\201\004\200\004\034\004\200\004\033\004"
+ "\035\004\202\004\201\004\035\004\201\004\034\004\036\004\203\004\202\004"
+ "\036\004\202\004\035\004\037\004\204\004\203\004\037\004\203\004\036\004"
+ " \004\205\004\204\004 \004\204\004\037\004!\004\206\004\205\004!\004\205"
+ "\004 \004\042\004\207\004\206\004\042\004\206\004!\004#\004\210\004\207\004"
+ "#\004\207\004\042\004$\004\211\004\210\004$\004\210\004#\004%\004\212\004"
+ "\211\004%\004\211\004$\004&\004\213\004\212\004&\004\212\004%\004'\004\214"
+ "\004\213\004'\004\213\004&\004(\004\215\004\214\004(\004\214\004'\004)\004"
+ "\216\004\215\004)\004\215\004(\004*\004\217\004\216\004*\004\216\004)\004"
+ "+\004\220\004\217\004+\004\217\004*\004,\004\221\004\220\004,\004\220\004"
+ "+\004-\004\222\004\221\004-\004\221\004,\004.\004\223\004\222\004.\004\222"
+ "\004-\004/\004\224\004\223\004/\004\223\004.\0040\004\225\004\224\0040\004"
+ "\224\004/\0041\004\226\004\225\0041\004\225\0040\0042\004\227\004\226\004"
+ "2\004\226\0041\0043\004\230\004\227\0043\004\227\0042\0044\004\231\004\230"
+ "\0044\004\230\0043\0045\004\232\004\231\0045\004\231\0044\0046\004\233\004"
+ "\232\0046\004\232\0045\0047\004\234\004\233\0047\004\233\0046\0048\004\235"
+ "\004\234\0048\004\234\0047\0049\004\236\004\235\0049\004\235\0048\004:\004"
+ "\237\004\236\004:\004\236\0049\004;\004\240\004\237\004;\004\237\004:\004"
+ "<\004\241\004\240\004<\004\240\004;\004=\004\242\004\241\004=\004\241\004"
+ "<\004>\004\243\004\242\004>\004\242\004=\004\077\004\244\004\243\004\077"
+ "\004\243\004>\004@\004\245\004\244\004@\004\244\004\077\004A\004\246\004"
+ "\245\004A\004\245\004@\004B\004\247\004\246\004B\004\246\004A\004C\004\250"
+ "\004\247\004C\004\247\004B\004D\004\251\004\250\004D\004\250\004C\004E\004"
+ "\252\004\251\004E\004\251\004D\004F\004\253\004\252\004F\004\252\004E\004"
+ "G\004\254\004\253\004G\004\253\004F\004H\004\255\004\254\004H\004\254\004"
+ "G\004I\004\256\004\255\004I\004\255\004H\004J\004\257\004\256\004J\004\256"
+ "\004I\004K\004M\004\257\004K\004\257\004J\004M\004\260\004\261\004M\004\261"
+ "\004\257\004L\004\262\004\260\004L\004\260\004M\004N\004\263\004\262\004"
+ "N\004\262\004L\004O\004\264\004\263\004O\004\263\004N\004P\004\265\004\264"
+ "\004P\004\264\004O\004Q\004\266\004\265\004Q\004\265\004P\004R\004\267\004"
+ "\266\004R\004\266\004Q\004S\004\270\004\267\004S\004\267\004R\004T\004\271"
+ "\004\270\004T\004\270\004S\004U\004\272\004\271\004U\004\271\004T\004V\004"
+ "\273\004\272\004V\004\272\004U\004W\004\274\004\273\004W\004\273\004V\004"
+ "X\004\275\004\274\004X\004\274\004W\004Y\004\276\004\275\004Y\004\275\004"
+ "X\004Z\004\277\004\276\004Z\004\276\004Y\004[\004\300\004\277\004[\004\277"
+ "\004Z\004\134\004\301\004\300\004\134\004\300\004[\004]\004\302\004\301\004"
+ "]\004\301\004\134\004^\004\303\004\302\004^\004\302\004]\004_\004\304\004"
+ "\303\004_\004\303\004^\004`\004\305\004\304\004`\004\304\004_\004a\004\306"
+ "\004\305\004a\004\305\004`\004b\004\307\004\306\004b\004\306\004a\004c\004"
+ "\310\004\307\004c\004\307\004b\004d\004\311\004\310\004d\004\310\004c\004"
+ "e\004\312\004\311\004e\004\311\004d\004f\004\313\004\312\004f\004\312\004"
+ "e\004g\004\314\004\313\004g\004\313\004f\004h\004\315\004\314\004h\004\314"
+ "\004g\004i\004\316\004\315\004i\004\315\004h\004j\004\317\004\316\004j\004"
+ "\316\004i\004k\004\320\004\317\004k\004\317\004j\004l\004\321\004\320\004"
+ "l\004\320\004k\004m\004\322\004\321\004m\004\321\004l\004n\004\323\004\322"
+ "\004n\004\322\004m\004o\004\324\004\323\004o\004\323\004n\004p\004\325\004"
+ "\324\004p\004\324\004o\004q\004\326\004\325\004q\004\325\004p\004r\004\327"
+ "\004\326\004r\004\326\004q\004s\004\330\004\327\004s\004\327\004r\004t\004"
+ "\331\004\330\004t\004\330\004s\004u\004\332\004\331\004u\004\331\004t\004"
+ "v\004\333\004\332\004v\004\332\004u\004w\004\334\004\333\004w\004\333\004"
+ "v\004x\004\335\004\334\004x\004\334\004w\004y\004\336\004\335\004y\004\335"
+ "\004x\004z\004\337\004\336\004z\004\336\004y\004{\004\340\004\337\004{\004"
+ "\337\004z\004|\004\341\004\340\004|\004\340\004{\004}\004\342\004\341\004"
+ "}\004\341\004|\004~\004\343\004\342\004~\004\342\004}\004\177\004\344\004"
+ "\343\004\177\004\343\004~\004\200\004\345\004\344\004\200\004\344\004\177"
+ "\004\201\004\346\004\345\004\201\004\345\004\200\004\202\004\347\004\346"
+ "\004\202\004\346\004\201\004\203\004\350\004\347\004\203\004\347\004\202"
+ "\004\204\004\351\004\350\004\204\004\350\004\203\004\205\004\352\004\351"
+ "\004\205\004\351\004\204\004\206\004\353\004\352\004\206\004\352\004\205"
+ "\004\207\004\354\004\353\004\207\004\353\004\206\004\210\004\355\004\354"
+ "\004\210\004\354\004\207\004\211\004\356\004\355\004\211\004\355\004\210"
+ "\004\212\004\357\004\356\004\212\004\356\004\211\004\213\004\360\004\357"
+ "\004\213\004\357\004\212\004\214\004\361\004\360\004\214\004\360\004\213"
+ "\004\215\004\362\004\361\004\215\004\361\004\214\004\216\004\363\004\362"
+ "\004\216\004\362\004\215\004\217\004\364\004\363\004\217\004\363\004\216"
+ "\004\220\004\365\004\364\004\220\004\364\004\217\004\221\004\366\004\365"
+ "\004\221\004\365\004\220\004\222\004\367\004\366\004\222\004\366\004\221"
+ "\004\223\004\370\004\367\004\223\004\367\004\222\004\224\004\371\004\370"
+ "\004\224\004\370\004\223\004\225\004\372\004\371\004\225\004\371\004\224"
+ "\004\226\004\373\004\372\004\226\004\372\004\225\004\227\004\374\004\373"
+ "\004\227\004\373\004\226\004\230\004\375\004\374\004\230\004\374\004\227"
+ "\004\231\004\376\004\375\004\231\004\375\004\230\004\232\004\377\004\376"
+ "\004\232\004\376\004\231\004\233\004\000\005\377\004\233\004\377\004\232"
+ "\004\234\004\001\005\000\005\234\004\000\005\233\004\235\004\002\005\001"
+ "\005\235\004\001\005\234\004\236\004\003\005\002\005\236\004\002\005\235"
+ "\004\237\004\004\005\003\005\237\004\003\005\236\004\240\004\005\005\004"
+ "\005\240\004\004\005\237\004\241\004\006\005\005\005\241\004\005\005\240"
+ "\004\242\004\007\005\006\005\242\004\006\005\241\004\243\004\010\005\007"
+ "\005\243\004\007\005\242\004\244\004\011\005\010\005\244\004\010\005\243"
+ "\004\245\004\012\005\011\005\245\004\011\005\244\004\246\004\013\005\012"
+ "\005\246\004\012\005\245\004\247\004\014\005\013\005\247\004\013\005\246"
+ "\004\250\004\015\005\014\005\250\004\014\005\247\004\251\004\016\005\015"
+ "\005\251\004\015\005\250\004\252\004\017\005\016\005\252\004\016\005\251"
+ "\004\253\004\020\005\017\005\253\004\017\005\252\004\254\004\021\005\020"
+ "\005\254\004\020\005\253\004\255\004\022\005\021\005\255\004\021\005\254"
+ "\004\256\004\023\005\022\005\256\004\022\005\255\004\257\004\261\004\023"
+ "\005\257\004\023\005\256\004\261\004\024\005\025\005\261\004\025\005\023"
+ "\005\260\004\026\005\024\005\260\004\024\005\261\004\262\004\027\005\026"
+ "\005\262\004\026\005\260\004\263\004\030\005\027\005\263\004\027\005\262"
+ "\004\264\004\031\005\030\005\264\004\030\005\263\004\265\004\032\005\031"
+ "\005\265\004\031\005\264\004\266\004\033\005\032\005\266\004\032\005\265"
+ "\004\267\004\034\005\033\005\267\004\033\005\266\004\270\004\035\005\034"
+ "\005\270\004\034\005\267\004\271\004\036\005\035\005\271\004\035\005\270"
+ "\004\272\004\037\005\036\005\272\004\036\005\271\004\273\004 \005\037\005"
+ "\273\004\037\005\272\004\274\004!\005 \005\274\004 \005\273\004\275\004\042"
+ "\005!\005\275\004!\005\274\004\276\004#\005\042\005\276\004\042\005\275\004"
+ "\277\004$\005#\005\277\004#\005\276\004\300\004%\005$\005\300\004$\005\277"
+ "\004\301\004&\005%\005\301\004%\005\300\004\302\004'\005&\005\302\004&\005"
+ "\301\004\303\004(\005'\005\303\004'\005\302\004\304\004)\005(\005\304\004"
+ "(\005\303\004\305\004*\005)\005\305\004)\005\304\004\306\004+\005*\005\306"
+ "\004*\005\305\004\307\004,\005+\005\307\004+\005\306\004\310\004-\005,\005"
+ "\310\004,\005\307\004\311\004.\005-\005\311\004-\005\310\004\312\004/\005"
+ ".\005\312\004.\005\311\004\313\0040\005/\005\313\004/\005\312\004\314\004"
+ "1\0050\005\314\0040\005\313\004\315\0042\0051\005\315\0041\005\314\004\316"
+ "\0043\0052\005\316\0042\005\315\004\317\0044\0053\005\317\0043\005\316\004"
+ "\320\0045\0054\005\320\0044\005\317\004\321\0046\0055\005\321\0045\005\320"
+ "\004\322\0047\0056\005\322\0046\005\321\004\323\0048\0057\005\323\0047\005"
+ "\322\004\324\0049\0058\005\324\0048\005\323\004\325\004:\0059\005\325\004"
+ "9\005\324\004\326\004;\005:\005\326\004:\005\325\004\327\004<\005;\005\327"
+ "\004;\005\326\004\330\004=\005<\005\330\004<\005\327\004\331\004>\005=\005"
+ "\331\004=\005\330\004\332\004\077\005>\005\332\004>\005\331\004\333\004@"
+ "\005\077\005\333\004\077\005\332\004\334\004A\005@\005\334\004@\005\333\004"
+ "\335\004B\005A\005\335\004A\005\334\004\336\004C\005B\005\336\004B\005\335"
+ "\004\337\004D\005C\005\337\004C\005\336\004\340\004E\005D\005\340\004D\005"
+ "\337\004\341\004F\005E\005\341\004E\005\340\004\342\004G\005F\005\342\004"
+ "F\005\341\004\343\004H\005G\005\343\004G\005\342\004\344\004I\005H\005\344"
+ "\004H\005\343\004\345\004J\005I\005\345\004I\005\344\004\346\004K\005J\005"
+ "\346\004J\005\345\004\347\004L\005K\005\347\004K\005\346\004\350\004M\005"
+ "L\005\350\004L\005\347\004\351\004N\005M\005\351\004M\005\350\004\352\004"
+ "O\005N\005\352\004N\005\351\004\353\004P\005O\005\353\004O\005\352\004\354"
+ "\004Q\005P\005\354\004P\005\353\004\355\004R\005Q\005\355\004Q\005\354\004"
+ "\356\004S\005R\005\356\004R\005\355\004\357\004T\005S\005\357\004S\005\356"
+ "\004\360\004U\005T\005\360\004T\005\357\004\361\004V\005U\005\361\004U\005"
+ "\360\004\362\004W\005V\005\362\004V\005\361\004\363\004X\005W\005\363\004"
+ "W\005\362\004\364\004Y\005X\005\364\004X\005\363\004\365\004Z\005Y\005\365"
+ "\004Y\005\364\004\366\004[\005Z\005\366\004Z\005\365\004\367\004\134\005"
+ "[\005\367\004[\005\366\004\370\004]\005\134\005\370\004\134\005\367\004\371"
+ "\004^\005]\005\371\004]\005\370\004\372\004_\005^\005\372\004^\005\371\004"
+ "\373\004`\005_\005\373\004_\005\372\004\374\004a\005`\005\374\004`\005\373"
+ "\004\375\004b\005a\005\375\004a\005\374\004\376\004c\005b\005\376\004b\005"
+ "\375\004\377\004d\005c\005\377\004c\005\376\004\000\005e\005d\005\000\005"
+ "d\005\377\004\001\005f\005e\005\001\005e\005\000\005\002\005g\005f\005\002"
+ "\005f\005\001\005\003\005h\005g\005\003\005g\005\002\005\004\005i\005h\005"
+ "\004\005h\005\003\005\005\005j\005i\005\005\005i\005\004\005\006\005k\005"
+ "j\005\006\005j\005\005\005\007\005l\005k\005\007\005k\005\006\005\010\005"
+ "m\005l\005\010\005l\005\007\005\011\005n\005m\005\011\005m\005\010\005\012"
+ "\005o\005n\005\012\005n\005\011\005\013\005p\005o\005\013\005o\005\012\005"
+ "\014\005q\005p\005\014\005p\005\013\005\015\005r\005q\005\015\005q\005\014"
+ "\005\016\005s\005r\005\016\005r\005\015\005\017\005t\005s\005\017\005s\005"
+ "\016\005\020\005u\005t\005\020\005t\005\017\005\021\005v\005u\005\021\005"
+ "u\005\020\005\022\005w\005v\005\022\005v\005\021\005\023\005\025\005w\005"
+ "\023\005w\005\022\005\025\005x\005y\005\025\005y\005w\005\024\005z\005x\005"
+ "\024\005x\005\025\005\026\005{\005z\005\026\005z\005\024\005\027\005|\005"
+ "{\005\027\005{\005\026\005\030\005}\005|\005\030\005|\005\027\005\031\005"
+ "~\005}\005\031\005}\005\030\005\032\005\177\005~\005\032\005~\005\031\005"
+ "\033\005\200\005\177\005\033\005\177\005\032\005\034\005\201\005\200\005"
+ "\034\005\200\005\033\005\035\005\202\005\201\005\035\005\201\005\034\005"
+ "\036\005\203\005\202\005\036\005\202\005\035\005\037\005\204\005\203\005"
+ "\037\005\203\005\036\005 \005\205\005\204\005 \005\204\005\037\005!\005\206"
+ "\005\205\005!\005\205\005 \005\042\005\207\005\206\005\042\005\206\005!\005"
+ "#\005\210\005\207\005#\005\207\005\042\005$\005\211\005\210\005$\005\210"
+ "\005#\005%\005\212\005\211\005%\005\211\005$\005&\005\213\005\212\005&\005"
+ "\212\005%\005'\005\214\005\213\005'\005\213\005&\005(\005\215\005\214\005"
+ "(\005\214\005'\005)\005\216\005\215\005)\005\215\005(\005*\005\217\005\216"
+ "\005*\005\216\005)\005+\005\220\005\217\005+\005\217\005*\005,\005\221\005"
+ "\220\005,\005\220\005+\005-\005\222\005\221\005-\005\221\005,\005.\005\223"
+ "\005\222\005.\005\222\005-\005/\005\224\005\223\005/\005\223\005.\0050\005"
+ "\225\005\224\0050\005\224\005/\0051\005\226\005\225\0051\005\225\0050\005"
+ "2\005\227\005\226\0052\005\226\0051\0053\005\230\005\227\0053\005\227\005"
+ "2\0054\005\231\005\230\0054\005\230\0053\0055\005\232\005\231\0055\005\231"
+ "\0054\0056\005\233\005\232\0056\005\232\0055\0057\005\234\005\233\0057\005"
+ "\233\0056\0058\005\235\005\234\0058\005\234\0057\0059\005\236\005\235\005"
+ "9\005\235\0058\005:\005\237\005\236\005:\005\236\0059\005;\005\240\005\237"
+ "\005;\005\237\005:\005<\005\241\005\240\005<\005\240\005;\005=\005\242\005"
+ "\241\005=\005\241\005<\005>\005\243\005\242\005>\005\242\005=\005\077\005"
+ "\244\005\243\005\077\005\243\005>\005@\005\245\005\244\005@\005\244\005\077"
+ "\005A\005\246\005\245\005A\005\245\005@\005B\005\247\005\246\005B\005\246"
+ "\005A\005C\005\250\005\247\005C\005\247\005B\005D\005\251\005\250\005D\005"
+ "\250\005C\005E\005\252\005\251\005E\005\251\005D\005F\005\253\005\252\005"
+ "F\005\252\005E\005G\005\254\005\253\005G\005\253\005F\005H\005\255\005\254"
+ "\005H\005\254\005G\005I\005\256\005\255\005I\005\255\005H\005J\005\257\005"
+ "\256\005J\005\256\005I\005K\005\260\005\257\005K\005\257\005J\005L\005\261"
+ "\005\260\005L\005\260\005K\005M\005\262\005\261\005M\005\261\005L\005N\005"
+ "\263\005\262\005N\005\262\005M\005O\005\264\005\263\005O\005\263\005N\005"
+ "P\005\265\005\264\005P\005\264\005O\005Q\005\266\005\265\005Q\005\265\005"
+ "P\005R\005\267\005\266\005R\005\266\005Q\005S\005\270\005\267\005S\005\267"
+ "\005R\005T\005\271\005\270\005T\005\270\005S\005U\005\272\005\271\005U\005"
+ "\271\005T\005V\005\273\005\272\005V\005\272\005U\005W\005\274\005\273\005"
+ "W\005\273\005V\005X\005\275\005\274\005X\005\274\005W\005Y\005\276\005\275"
+ "\005Y\005\275\005X\005Z\005\277\005\276\005Z\005\276\005Y\005[\005\300\005"
+ "\277\005[\005\277\005Z\005\134\005\301\005\300\005\134\005\300\005[\005]"
+ "\005\302\005\301\005]\005\301\005\134\005^\005\303\005\302\005^\005\302\005"
+ "]\005_\005\304\005\303\005_\005\303\005^\005`\005\305\005\304\005`\005\304"
+ "\005_\005a\005\306\005\305\005a\005\305\005`\005b\005\307\005\306\005b\005"
+ "\306\005a\005c\005\310\005\307\005c\005\307\005b\005d\005\311\005\310\005"
+ "d\005\310\005c\005e\005\312\005\311\005e\005\311\005d\005f\005\313\005\312"
+ "\005f\005\312\005e\005g\005\314\005\313\005g\005\313\005f\005h\005\315\005"
+ "\314\005h\005\314\005g\005i\005\316\005\315\005i\005\315\005h\005j\005\317"
+ "\005\316\005j\005\316\005i\005k\005\320\005\317\005k\005\317\005j\005l\005"
+ "\321\005\320\005l\005\320\005k\005m\005\322\005\321\005m\005\321\005l\005"
+ "n\005\323\005\322\005n\005\322\005m\005o\005\324\005\323\005o\005\323\005"
+ "n\005p\005\325\005\324\005p\005\324\005o\005q\005\326\005\325\005q\005\325"
+ "\005p\005r\005\327\005\326\005r\005\326\005q\005s\005\330\005\327\005s\005"
+ "\327\005r\005t\005\331\005\330\005t\005\330\005s\005u\005\332\005\331\005"
+ "u\005\331\005t\005v\005\333\005\332\005v\005\332\005u\005w\005y\005\333\005"
+ "w\005\333\005v\005y\005\334\005\333\005y\005\335\005\334\005x\005\335\005"
+ "y\005x\005\336\005\335\005z\005\336\005x\005{\005\336\005z\005{\005\337\005"
+ "\336\005|\005\337\005{\005|\005\340\005\337\005}\005\340\005|\005}\005\341"
+ "\005\340\005}\005\342\005\341\005~\005\342\005}\005~\005\343\005\342\005"
+ "\177\005\343\005~\005\177\005\344\005\343\005\200\005\344\005\177\005\200"
+ "\005\345\005\344\005\201\005\345\005\200\005\201\005\346\005\345\005\201"
+ "\005\347\005\346\005\202\005\347\005\201\005\202\005\350\005\347\005\203"
+ "\005\350\005\202\005\203\005\351\005\350\005\203\005\352\005\351\005\204"
+ "\005\352\005\203\005\204\005\353\005\352\005\204\005\354\005\353\005\205"
+ "\005\354\005\204\005\205\005\355\005\354\005\206\005\355\005\205\005\206"
+ "\005\356\005\355\005\206\005\357\005\356\005\207\005\357\005\206\005\207"
+ "\005\360\005\357\005\210\005\360\005\207\005\210\005\361\005\360\005\210"
+ "\005\362\005\361\005\211\005\362\005\210\005\211\005\363\005\362\005\212"
+ "\005\363\005\211\005\212\005\364\005\363\005\213\005\364\005\212\005\213"
+ "\005\365\005\364\005\214\005\365\005\213\005\214\005\366\005\365\005\215"
+ "\005\366\005\214\005\215\005\367\005\366\005\215\005\242\005\367\005\216"
+ "\005\242\005\215\005\216\005\241\005\242\005\217\005\241\005\216\005\217"
+ "\005\240\005\241\005\220\005\240\005\217\005\220\005\237\005\240\005\221"
+ "\005\237\005\220\005\221\005\236\005\237\005\222\005\236\005\221\005\222"
+ "\005\235\005\236\005\223\005\235\005\222\005\223\005\234\005\235\005\224"
+ "\005\234\005\223\005\224\005\233\005\234\005\225\005\233\005\224\005\225"
+ "\005\232\005\233\005\226\005\232\005\225\005\226\005\231\005\232\005\227"
+ "\005\231\005\226\005\231\005\227\005\230\005\243\005\367\005\242\005\367"
+ "\005\243\005\370\005\370\005\243\005\244\005\370\005\244\005\371\005\371"
+ "\005\244\005\245\005\371\005\245\005\372\005\372\005\245\005\246\005\372"
+ "\005\246\005\373\005\373\005\246\005\247\005\373\005\247\005\374\005\374"
+ "\005\247\005\250\005\374\005\250\005\375\005\375\005\250\005\376\005\376"
+ "\005\250\005\251\005\376\005\251\005\377\005\377\005\251\005\252\005\377"
+ "\005\252\005\000\006\000\006\252\005\001\006\001\006\252\005\253\005\001"
+ "\006\253\005\002\006\002\006\253\005\254\005\002\006\254\005\003\006\003"
+ "\006\254\005\004\006\004\006\254\005\255\005\004\006\255\005\005\006\005"
+ "\006\255\005\006\006\006\006\255\005\256\005\006\006\256\005\007\006\007"
+ "\006\256\005\257\005\007\006\257\005\010\006\010\006\257\005\011\006\011"
+ "\006\257\005\260\005\011\006\260\005\012\006\012\006\260\005\261\005\012"
+ "\006\261\005\013\006\013\006\261\005\262\005\013\006\262\005\014\006\014"
+ "\006\262\005\263\005\014\006\263\005\015\006\015\006\263\005\016\006\016"
+ "\006\263\005\264\005\016\006\264\005\017\006\017\006\264\005\265\005\017"
+ "\006\265\005\020\006\020\006\265\005\266\005\020\006\266\005\267\005\020"
+ "\006\267\005\021\006\021\006\267\005\270\005\021\006\270\005\022\006\022"
+ "\006\270\005\271\005\022\006\271\005\272\005\022\006\272\005\023\006\023"
+ "\006\272\005\273\005\023\006\273\005\024\006\024\006\273\005\274\005\024"
+ "\006\274\005\025\006\025\006\274\005\275\005\025\006\275\005\026\006\026"
+ "\006\275\005\276\005\026\006\276\005\326\005\326\005\276\005\325\005\325"
+ "\005\276\005\277\005\325\005\277\005\324\005\324\005\277\005\300\005\324"
+ "\005\300\005\323\005\323\005\300\005\301\005\323\005\301\005\322\005\322"
+ "\005\301\005\302\005\322\005\302\005\303\005\322\005\303\005\321\005\321"
+ "\005\303\005\320\005\320\005\303\005\304\005\320\005\304\005\317\005\317"
+ "\005\304\005\305\005\317\005\305\005\316\005\316\005\305\005\306\005\316"
+ "\005\306\005\307\005\316\005\307\005\315\005\315\005\307\005\314\005\314"
+ "\005\307\005\310\005\314\005\310\005\313\005\313\005\310\005\311\005\313"
+ "\005\311\005\312\005\326\005\027\006\026\006\327\005\027\006\326\005\327"
+ "\005\030\006\027\006\330\005\030\006\327\005\330\005\031\006\030\006\331"
+ "\005\031\006\330\005\331\005\032\006\031\006\332\005\032\006\331\005\332"
+ "\005\334\005\032\006\333\005\334\005\332\005\027\006\033\006\026\006\034"
+ "\006\033\006\027\006\034\006\035\006\033\006\036\006\035\006\034\006\036"
+ "\006\037\006\035\006 \006\037\006\036\006 \006!\006\037\006\042\006!\006"
+ " \006!\006\042\006#\006$\006\003\000\306\000$\006\306\000%\006&\006\000\000"
+ "\003\000&\006\003\000$\006'\006\004\000\000\000'\006\000\000&\006(\006\006"
+ "\000\004\000(\006\004\000'\006(\006'\006)\006(\006)\006*\006+\006\010\000"
+ "\006\000+\006\006\000(\006,\006\012\000\010\000,\006\010\000+\006-\006\014"
+ "\000\012\000-\006\012\000,\006.\006\016\000\014\000.\006\014\000-\006.\006"
+ "-\006/\006.\006/\0060\0061\006\020\000\016\0001\006\016\000.\0062\006\022"
+ "\000\020\0002\006\020\0001\0063\006\024\000\022\0003\006\022\0002\0064\006"
+ "\026\000\024\0004\006\024\0003\0064\0063\0065\0064\0065\0066\0067\006\030"
+ "\000\026\0007\006\026\0004\0068\006\032\000\030\0008\006\030\0007\0069\006"
+ "\034\000\032\0009\006\032\0008\006:\006\036\000\034\000:\006\034\0009\006"
+ ":\0069\006;\006:\006;\006<\006=\006 \000\036\000=\006\036\000:\006>\006\042"
+ "\000 \000>\006 \000=\006\077\006$\000\042\000\077\006\042\000>\006%\006\306"
+ "\000\304\000%\006\304\000@\006%\006@\006A\006%\006A\006B\006@\006\304\000"
+ "\302\000@\006\302\000C\006C\006\302\000\300\000C\006\300\000D\006D\006\300"
+ "\000\276\000D\006\276\000E\006F\006\272\000\270\000F\006\270\000G\006G\006"
+ "\270\000\266\000G\006\266\000H\006H\006\266\000\264\000H\006\264\000I\006"
+ "I\006\264\000\262\000I\006\262\000J\006I\006J\006K\006I\006K\006L\006J\006"
+ "\262\000\260\000J\006\260\000M\006M\006\260\000\256\000M\006\256\000N\006"
+ "N\006\256\000\254\000N\006\254\000O\006O\006\254\000\252\000O\006\252\000"
+ "P\006O\006P\006Q\006O\006Q\006R\006P\006\252\000\250\000P\006\250\000S\006"
+ "S\006\250\000\246\000S\006\246\000T\006T\006\246\000\244\000T\006\244\000"
+ "U\006U\006\244\000\242\000U\006\242\000V\006U\006V\006W\006U\006W\006X\006"
+ "V\006\242\000\240\000V\006\240\000Y\006Y\006\240\000\236\000Y\006\236\000"
+ "Z\006Z\006\236\000\234\000Z\006\234\000[\006[\006\234\000\232\000[\006\232"
+ "\000\134\006[\006\134\006]\006[\006]\006^\006\134\006\232\000\230\000\134"
+ "\006\230\000_\006_\006\230\000\226\000_\006\226\000`\006`\006\226\000\224"
+ "\000`\006\224\000a\006a\006\224\000\222\000a\006\222\000b\006a\006b\006c"
+ "\006a\006c\006d\006b\006\222\000\220\000b\006\220\000e\006e\006\220\000\216"
+ "\000e\006\216\000f\006f\006\216\000\214\000f\006\214\000g\006h\006\210\000"
+ "\206\000h\006\206\000i\006i\006\206\000\204\000i\006\204\000j\006j\006\204"
+ "\000\202\000j\006\202\000k\006k\006\202\000\200\000k\006\200\000l\006k\006"
+ "l\006m\006k\006m\006n\006l\006\200\000~\000l\006~\000o\006o\006~\000|\000"
+ "o\006|\000p\006p\006|\000z\000p\006z\000q\006q\006z\000x\000q\006x\000r\006"
+ "q\006r\006s\006q\006s\006t\006r\006x\000v\000r\006v\000u\006u\006v\000t\000"
+ "u\006t\000v\006v\006t\000r\000v\006r\000w\006w\006r\000p\000w\006p\000x\006"
+ "w\006x\006y\006w\006y\006z\006x\006p\000n\000x\006n\000{\006{\006n\000l\000"
+ "{\006l\000|\006|\006l\000j\000|\006j\000}\006}\006j\000h\000}\006h\000~\006"
+ "}\006~\006\177\006}\006\177\006\200\006~\006h\000f\000~\006f\000\201\006"
+ "\201\006f\000d\000\201\006d\000\202\006\202\006d\000b\000\202\006b\000\203"
+ "\006\203\006b\000`\000\203\006`\000\204\006\203\006\204\006\205\006\203\006"
+ "\205\006\206\006\204\006`\000^\000\204\006^\000\207\006\207\006^\000\134"
+ "\000\207\006\134\000\210\006\210\006\134\000Z\000\210\006Z\000\211\006\212"
+ "\006V\000T\000\212\006T\000\213\006\213\006T\000R\000\213\006R\000\214\006"
+ "\214\006R\000P\000\214\006P\000\215\006\215\006P\000N\000\215\006N\000\216"
+ "\006\215\006\216\006\217\006\215\006\217\006\220\006\216\006N\000L\000\216"
+ "\006L\000\221\006\221\006L\000J\000\221\006J\000\222\006\222\006J\000H\000"
+ "\222\006H\000\223\006\223\006H\000F\000\223\006F\000\224\006\223\006\224"
+ "\006\225\006\223\006\225\006\226\006\224\006F\000D\000\224\006D\000\227\006"
+ "\227\006D\000B\000\227\006B\000\230\006\230\006B\000@\000\230\006@\000\231"
+ "\006\231\006@\000>\000\231\006>\000\232\006\231\006\232\006\233\006\231\006"
+ "\233\006\234\006\232\006>\000<\000\232\006<\000\235\006\235\006<\000:\000"
+ "\235\006:\000\236\006\236\006:\0008\000\236\0068\000\237\006\237\0068\000"
+ "6\000\237\0066\000\240\006\237\006\240\006\241\006\237\006\241\006\242\006"
+ "\240\0066\0004\000\240\0064\000\243\006\243\0064\0002\000\243\0062\000\244"
+ "\006\244\0062\0000\000\244\0060\000\245\006\245\0060\000.\000\245\006.\000"
+ "\246\006\245\006\246\006\247\006\245\006\247\006\250\006\246\006.\000,\000"
+ "\246\006,\000\251\006\251\006,\000*\000\251\006*\000\252\006\252\006*\000"
+ "(\000\252\006(\000\253\006\000\000\001\000\001\000\002\000\000\000\002\000"
+ "\002\000\003\000\000\000\003\000\004\000\005\000\001\000\005\000\001\000"
+ "\004\000\000\000\004\000\006\000\007\000\005\000\007\000\005\000\006\000"
+ "\004\000\006\000\010\000\011\000\007\000\011\000\007\000\010\000\006\000"
+ "\010\000\012\000\013\000\011\000\013\000\011\000\012\000\010\000\012\000"
+ "\014\000\015\000\013\000\015\000\013\000\014\000\012\000\014\000\016\000"
+ "\017\000\015\000\017\000\015\000\016\000\014\000\016\000\020\000\021\000"
+ "\017\000\021\000\017\000\020\000\016\000\020\000\022\000\023\000\021\000"
+ "\023\000\021\000\022\000\020\000\022\000\024\000\025\000\023\000\025\000"
+ "\023\000\024\000\022\000\024\000\026\000\027\000\025\000\027\000\025\000"
+ "\026\000\024\000\026\000\030\000\031\000\027\000\031\000\027\000\030\000"
+ "\026\000\030\000\032\000\033\000\031\000\033\000\031\000\032\000\030\000"
+ "\032\000\034\000\035\000\033\000\035\000\033\000\034\000\032\000\034\000"
+ "\036\000\037\000\035\000\037\000\035\000\036\000\034\000\036\000 \000!\000"
+ "\037\000!\000\037\000 \000\036\000 \000\042\000#\000!\000#\000!\000\042\000"
+ " \000\042\000$\000%\000#\000%\000#\000$\000\042\000$\000&\000'\000%\000'"
+ "\000%\000&\000$\000&\000(\000)\000'\000)\000'\000(\000&\000(\000*\000+\000"
+ ")\000+\000)\000*\000(\000*\000,\000-\000+\000-\000+\000,\000*\000,\000.\000"
+ "/\000-\000/\000-\000.\000,\000.\0000\0001\000/\0001\000/\0000\000.\0000\000"
+ "2\0003\0001\0003\0001\0002\0000\0002\0004\0005\0003\0005\0003\0004\0002\000"
+ "4\0006\0007\0005\0007\0005\0006\0004\0006\0008\0009\0007\0009\0007\0008\000"
+ "6\0008\000:\000;\0009\000;\0009\000:\0008\000:\000<\000=\000;\000=\000;\000"
+ "<\000:\000<\000>\000\077\000=\000\077\000=\000>\000<\000>\000@\000A\000\077"
+ "\000A\000\077\000@\000>\000@\000B\000C\000A\000C\000A\000B\000@\000B\000"
+ "D\000E\000C\000E\000C\000D\000B\000D\000F\000G\000E\000G\000E\000F\000D\000"
+ "F\000H\000I\000G\000I\000G\000H\000F\000H\000J\000K\000I\000K\000I\000J\000"
+ "H\000J\000L\000M\000K\000M\000K\000L\000J\000L\000N\000O\000M\000O\000M\000"
+ "N\000L\000N\000P\000Q\000O\000Q\000O\000P\000N\000P\000R\000S\000Q\000S\000"
+ "Q\000R\000P\000R\000T\000U\000S\000U\000S\000T\000R\000T\000V\000W\000U\000"
+ "W\000U\000V\000T\000V\000X\000Y\000W\000Y\000W\000X\000V\000X\000Z\000[\000"
+ "Y\000[\000Y\000Z\000X\000Z\000\134\000]\000[\000]\000[\000\134\000Z\000\134"
+ "\000^\000_\000]\000_\000]\000^\000\134\000^\000`\000a\000_\000a\000_\000"
+ "`\000^\000`\000b\000c\000a\000c\000a\000b\000`\000b\000d\000e\000c\000e\000"
+ "c\000d\000b\000d\000f\000g\000e\000g\000e\000f\000d\000f\000h\000i\000g\000"
+ "i\000g\000h\000f\000h\000j\000k\000i\000k\000i\000j\000h\000j\000l\000m\000"
+ "k\000m\000k\000l\000j\000l\000n\000o\000m\000o\000m\000n\000l\000n\000p\000"
+ "q\000o\000q\000o\000p\000n\000p\000r\000s\000q\000s\000q\000r\000p\000r\000"
+ "t\000u\000s\000u\000s\000t\000r\000t\000v\000w\000u\000w\000u\000v\000t\000"
+ "v\000x\000y\000w\000y\000w\000x\000v\000x\000z\000{\000y\000{\000y\000z\000"
+ "x\000z\000|\000}\000{\000}\000{\000|\000z\000|\000~\000\177\000}\000\177"
+ "\000}\000~\000|\000~\000\200\000\201\000\177\000\201\000\177\000\200\000"
+ "~\000\200\000\202\000\203\000\201\000\203\000\201\000\202\000\200\000\202"
+ "\000\204\000\205\000\203\000\205\000\203\000\204\000\202\000\204\000\206"
+ "\000\207\000\205\000\207\000\205\000\206\000\204\000\206\000\210\000\211"
+ "\000\207\000\211\000\207\000\210\000\206\000\210\000\212\000\213\000\211"
+ "\000\213\000\211\000\212\000\210\000\212\000\214\000\215\000\213\000\215"
+ "\000\213\000\214\000\212\000\214\000\216\000\217\000\215\000\217\000\215"
+ "\000\216\000\214\000\216\000\220\000\221\000\217\000\221\000\217\000\220"
+ "\000\216\000\220\000\222\000\223\000\221\000\223\000\221\000\222\000\220"
+ "\000\222\000\224\000\225\000\223\000\225\000\223\000\224\000\222\000\224"
+ "\000\226\000\227\000\225\000\227\000\225\000\226\000\224\000\226\000\230"
+ "\000\231\000\227\000\231\000\227\000\230\000\226\000\230\000\232\000\233"
+ "\000\231\000\233\000\231\000\232\000\230\000\232\000\234\000\235\000\233"
+ "\000\235\000\233\000\234\000\232\000\234\000\236\000\237\000\235\000\237"
+ "\000\235\000\236\000\234\000\236\000\240\000\241\000\237\000\241\000\237"
+ "\000\240\000\236\000\240\000\242\000\243\000\241\000\243\000\241\000\242"
+ "\000\240\000\242\000\244\000\245\000\243\000\245\000\243\000\244\000\242"
+ "\000\244\000\246\000\247\000\245\000\247\000\245\000\246\000\244\000\246"
+ "\000\250\000\251\000\247\000\251\000\247\000\250\000\246\000\250\000\252"
+ "\000\253\000\251\000\253\000\251\000\252\000\250\000\252\000\254\000\255"
+ "\000\253\000\255\000\253\000\254\000\252\000\254\000\256\000\257\000\255"
+ "\000\257\000\255\000\256\000\254\000\256\000\260\000\261\000\257\000\261"
+ "\000\257\000\260\000\256\000\260\000\262\000\263\000\261\000\263\000\261"
+ "\000\262\000\260\000\262\000\264\000\265\000\263\000\265\000\263\000\264"
+ "\000\262\000\264\000\266\000\267\000\265\000\267\000\265\000\266\000\264"
+ "\000\266\000\270\000\271\000\267\000\271\000\267\000\270\000\266\000\270"
+ "\000\272\000\273\000\271\000\273\000\271\000\272\000\270\000\272\000\274"
+ "\000\275\000\273\000\275\000\273\000\274\000\272\000\274\000\276\000\277"
+ "\000\275\000\277\000\275\000\276\000\274\000\276\000\300\000\301\000\277"
+ "\000\301\000\277\000\300\000\276\000\300\000\302\000\303\000\301\000\303"
+ "\000\301\000\302\000\300\000\302\000\304\000\305\000\303\000\305\000\303"
+ "\000\304\000\302\000\304\000\306\000\307\000\305\000\307\000\305\000\306"
+ "\000\304\000\306\000\002\000\307\000\003\000\307\000\003\000\306\000\002"
+ "\000\310\000\310\000\311\000\002\000\311\000\307\000\311\000\001\000\312"
+ "\000\310\000\312\000\001\000\310\000\005\000\313\000\312\000\313\000\005"
+ "\000\312\000\007\000\314\000\313\000\314\000\007\000\313\000\011\000\315"
+ "\000\314\000\315\000\011\000\314\000\013\000\316\000\315\000\316\000\013"
+ "\000\315\000\015\000\317\000\316\000\317\000\015\000\316\000\017\000\320"
+ "\000\317\000\320\000\017\000\317\000\021\000\321\000\320\000\321\000\021"
+ "\000\320\000\023\000\322\000\321\000\322\000\023\000\321\000\025\000\323"
+ "\000\322\000\323\000\025\000\322\000\027\000\324\000\323\000\324\000\027"
+ "\000\323\000\031\000\325\000\324\000\325\000\031\000\324\000\033\000\326"
+ "\000\325\000\326\000\033\000\325\000\035\000\327\000\326\000\327\000\035"
+ "\000\326\000\037\000\330\000\327\000\330\000\037\000\327\000!\000\331\000"
+ "\330\000\331\000!\000\330\000#\000\332\000\331\000\332\000#\000\331\000%"
+ "\000\333\000\332\000\333\000%\000\332\000'\000\334\000\333\000\334\000'\000"
+ "\333\000)\000\335\000\334\000\335\000)\000\334\000+\000\336\000\335\000\336"
+ "\000+\000\335\000-\000\337\000\336\000\337\000-\000\336\000/\000\340\000"
+ "\337\000\340\000/\000\337\0001\000\341\000\340\000\341\0001\000\340\0003"
+ "\000\342\000\341\000\342\0003\000\341\0005\000\343\000\342\000\343\0005\000"
+ "\342\0007\000\344\000\343\000\344\0007\000\343\0009\000\345\000\344\000\345"
+ "\0009\000\344\000;\000\346\000\345\000\346\000;\000\345\000=\000\347\000"
+ "\346\000\347\000=\000\346\000\077\000\350\000\347\000\350\000\077\000\347"
+ "\000A\000\351\000\350\000\351\000A\000\350\000C\000\352\000\351\000\352\000"
+ "C\000\351\000E\000\353\000\352\000\353\000E\000\352\000G\000\354\000\353"
+ "\000\354\000G\000\353\000I\000\355\000\354\000\355\000I\000\354\000K\000"
+ "\356\000\355\000\356\000K\000\355\000M\000\357\000\356\000\357\000M\000\356"
+ "\000O\000\360\000\357\000\360\000O\000\357\000Q\000\361\000\360\000\361\000"
+ "Q\000\360\000S\000\362\000\361\000\362\000S\000\361\000U\000\363\000\362"
+ "\000\363\000U\000\362\000W\000\364\000\363\000\364\000W\000\363\000Y\000"
+ "\365\000\364\000\365\000Y\000\364\000[\000\366\000\365\000\366\000[\000\365"
+ "\000]\000\367\000\366\000\367\000]\000\366\000_\000\370\000\367\000\370\000"
+ "_\000\367\000a\000\371\000\370\000\371\000a\000\370\000c\000\372\000\371"
+ "\000\372\000c\000\371\000e\000\373\000\372\000\373\000e\000\372\000g\000"
+ "\374\000\373\000\374\000g\000\373\000i\000\375\000\374\000\375\000i\000\374"
+ "\000k\000\376\000\375\000\376\000k\000\375\000m\000\377\000\376\000\377\000"
+ "m\000\376\000o\000\000\001\377\000\000\001o\000\377\000q\000\001\001\000"
+ "\001\001\001q\000\000\001s\000\002\001\001\001\002\001s\000\001\001u\000"
+ "\003\001\002\001\003\001u\000\002\001w\000\004\001\003\001\004\001w\000\003"
+ "\001y\000\005\001\004\001\005\001y\000\004\001{\000\006\001\005\001\006\001"
+ "{\000\005\001}\000\007\001\006\001\007\001}\000\006\001\177\000\010\001\007"
+ "\001\010\001\177\000\007\001\201\000\011\001\010\001\011\001\201\000\010"
+ "\001\203\000\012\001\011\001\012\001\203\000\011\001\205\000\013\001\012"
+ "\001\013\001\205\000\012\001\207\000\014\001\013\001\014\001\207\000\013"
+ "\001\211\000\015\001\014\001\015\001\211\000\014\001\213\000\016\001\015"
+ "\001\016\001\213\000\015\001\215\000\017\001\016\001\017\001\215\000\016"
+ "\001\217\000\020\001\017\001\020\001\217\000\017\001\221\000\021\001\020"
+ "\001\021\001\221\000\020\001\223\000\022\001\021\001\022\001\223\000\021"
+ "\001\225\000\023\001\022\001\023\001\225\000\022\001\227\000\024\001\023"
+ "\001\024\001\227\000\023\001\231\000\025\001\024\001\025\001\231\000\024"
+ "\001\233\000\026\001\025\001\026\001\233\000\025\001\235\000\027\001\026"
+ "\001\027\001\235\000\026\001\237\000\030\001\027\001\030\001\237\000\027"
+ "\001\241\000\031\001\030\001\031\001\241\000\030\001\243\000\032\001\031"
+ "\001\032\001\243\000\031\001\245\000\033\001\032\001\033\001\245\000\032"
+ "\001\247\000\034\001\033\001\034\001\247\000\033\001\251\000\035\001\034"
+ "\001\035\001\251\000\034\001\253\000\036\001\035\001\036\001\253\000\035"
+ "\001\255\000\037\001\036\001\037\001\255\000\036\001\257\000 \001\037\001"
+ " \001\257\000\037\001\261\000!\001 \001!\001\261\000 \001\263\000\042\001"
+ "!\001\042\001\263\000!\001\265\000#\001\042\001#\001\265\000\042\001\267"
+ "\000$\001#\001$\001\267\000#\001\271\000%\001$\001%\001\271\000$\001\273"
+ "\000&\001%\001&\001\273\000%\001\275\000'\001&\001'\001\275\000&\001\277"
+ "\000(\001'\001(\001\277\000'\001\301\000)\001(\001)\001\301\000(\001\303"
+ "\000*\001)\001*\001\303\000)\001\305\000+\001*\001+\001\305\000*\001\311"
+ "\000+\001\307\000+\001\311\000,\001,\001-\001\311\000-\001+\001-\001\310"
+ "\000.\001,\001.\001\310\000,\001\312\000/\001.\001/\001\312\000.\001\313"
+ "\0000\001/\0010\001\313\000/\001\314\0001\0010\0011\001\314\0000\001\315"
+ "\0002\0011\0012\001\315\0001\001\316\0003\0012\0013\001\316\0002\001\317"
+ "\0004\0013\0014\001\317\0003\001\320\0005\0014\0015\001\320\0004\001\321"
+ "\0006\0015\0016\001\321\0005\001\322\0007\0016\0017\001\322\0006\001\323"
+ "\0008\0017\0018\001\323\0007\001\324\0009\0018\0019\001\324\0008\001\325"
+ "\000:\0019\001:\001\325\0009\001\326\000;\001:\001;\001\326\000:\001\327"
+ "\000<\001;\001<\001\327\000;\001\330\000=\001<\001=\001\330\000<\001\331"
+ "\000>\001=\001>\001\331\000=\001\332\000\077\001>\001\077\001\332\000>\001"
+ "\333\000@\001\077\001@\001\333\000\077\001\334\000A\001@\001A\001\334\000"
+ "@\001\335\000B\001A\001B\001\335\000A\001\336\000C\001B\001C\001\336\000"
+ "B\001\337\000D\001C\001D\001\337\000C\001\340\000E\001D\001E\001\340\000"
+ "D\001\341\000F\001E\001F\001\341\000E\001\342\000G\001F\001G\001\342\000"
+ "F\001\343\000H\001G\001H\001\343\000G\001\344\000I\001H\001I\001\344\000"
+ "H\001\345\000J\001I\001J\001\345\000I\001\346\000K\001J\001K\001\346\000"
+ "J\001\347\000L\001K\001L\001\347\000K\001\350\000M\001L\001M\001\350\000"
+ "L\001\351\000N\001M\001N\001\351\000M\001\352\000O\001N\001O\001\352\000"
+ "N\001\353\000P\001O\001P\001\353\000O\001\354\000Q\001P\001Q\001\354\000"
+ "P\001\355\000R\001Q\001R\001\355\000Q\001\356\000S\001R\001S\001\356\000"
+ "R\001\357\000T\001S\001T\001\357\000S\001\360\000U\001T\001U\001\360\000"
+ "T\001\361\000V\001U\001V\001\361\000U\001\362\000W\001V\001W\001\362\000"
+ "V\001\363\000X\001W\001X\001\363\000W\001\364\000Y\001X\001Y\001\364\000"
+ "X\001\365\000Z\001Y\001Z\001\365\000Y\001\366\000[\001Z\001[\001\366\000"
+ "Z\001\367\000\134\001[\001\134\001\367\000[\001\370\000]\001\134\001]\001"
+ "\370\000\134\001\371\000^\001]\001^\001\371\000]\001\372\000_\001^\001_\001"
+ "\372\000^\001\373\000`\001_\001`\001\373\000_\001\374\000a\001`\001a\001"
+ "\374\000`\001\375\000b\001a\001b\001\375\000a\001\376\000c\001b\001c\001"
+ "\376\000b\001\377\000d\001c\001d\001\377\000c\001\000\001e\001d\001e\001"
+ "\000\001d\001\001\001f\001e\001f\001\001\001e\001\002\001g\001f\001g\001"
+ "\002\001f\001\003\001h\001g\001h\001\003\001g\001\004\001i\001h\001i\001"
+ "\004\001h\001\005\001j\001i\001j\001\005\001i\001\006\001k\001j\001k\001"
+ "\006\001j\001\007\001l\001k\001l\001\007\001k\001\010\001m\001l\001m\001"
+ "\010\001l\001\011\001n\001m\001n\001\011\001m\001\012\001o\001n\001o\001"
+ "\012\001n\001\013\001p\001o\001p\001\013\001o\001\014\001q\001p\001q\001"
+ "\014\001p\001\015\001r\001q\001r\001\015\001q\001\016\001s\001r\001s\001"
+ "\016\001r\001\017\001t\001s\001t\001\017\001s\001\020\001u\001t\001u\001"
+ "\020\001t\001\021\001v\001u\001v\001\021\001u\001\022\001w\001v\001w\001"
+ "\022\001v\001\023\001x\001w\001x\001\023\001w\001\024\001y\001x\001y\001"
+ "\024\001x\001\025\001z\001y\001z\001\025\001y\001\026\001{\001z\001{\001"
+ "\026\001z\001\027\001|\001{\001|\001\027\001{\001\030\001}\001|\001}\001"
+ "\030\001|\001\031\001~\001}\001~\001\031\001}\001\032\001\177\001~\001\177"
+ "\001\032\001~\001\033\001\200\001\177\001\200\001\033\001\177\001\034\001"
+ "\201\001\200\001\201\001\034\001\200\001\035\001\202\001\201\001\202\001"
+ "\035\001\201\001\036\001\203\001\202\001\203\001\036\001\202\001\037\001"
+ "\204\001\203\001\204\001\037\001\203\001 \001\205\001\204\001\205\001 \001"
+ "\204\001!\001\206\001\205\001\206\001!\001\205\001\042\001\207\001\206\001"
+ "\207\001\042\001\206\001#\001\210\001\207\001\210\001#\001\207\001$\001\211"
+ "\001\210\001\211\001$\001\210\001%\001\212\001\211\001\212\001%\001\211\001"
+ "&\001\213\001\212\001\213\001&\001\212\001'\001\214\001\213\001\214\001'"
+ "\001\213\001(\001\215\001\214\001\215\001(\001\214\001)\001\216\001\215\001"
+ "\216\001)\001\215\001*\001\217\001\216\001\217\001*\001\216\001-\001\217"
+ "\001+\001\217\001-\001\220\001\220\001\221\001-\001\221\001\217\001\221\001"
+ ",\001\222\001\220\001\222\001,\001\220\001.\001\223\001\222\001\223\001."
+ "\001\222\001/\001\224\001\223\001\224\001/\001\223\0010\001\225\001\224\001"
+ "\225\0010\001\224\0011\001\226\001\225\001\226\0011\001\225\0012\001\227"
+ "\001\226\001\227\0012\001\226\0013\001\230\001\227\001\230\0013\001\227\001"
+ "4\001\231\001\230\001\231\0014\001\230\0015\001\232\001\231\001\232\0015"
+ "\001\231\0016\001\233\001\232\001\233\0016\001\232\0017\001\234\001\233\001"
+ "\234\0017\001\233\0018\001\235\001\234\001\235\0018\001\234\0019\001\236"
+ "\001\235\001\236\0019\001\235\001:\001\237\001\236\001\237\001:\001\236\001"
+ ";\001\240\001\237\001\240\001;\001\237\001<\001\241\001\240\001\241\001<"
+ "\001\240\001=\001\242\001\241\001\242\001=\001\241\001>\001\243\001\242\001"
+ "\243\001>\001\242\001\077\001\244\001\243\001\244\001\077\001\243\001@\001"
+ "\245\001\244\001\245\001@\001\244\001A\001\246\001\245\001\246\001A\001\245"
+ "\001B\001\247\001\246\001\247\001B\001\246\001C\001\250\001\247\001\250\001"
+ "C\001\247\001D\001\251\001\250\001\251\001D\001\250\001E\001\252\001\251"
+ "\001\252\001E\001\251\001F\001\253\001\252\001\253\001F\001\252\001G\001"
+ "\254\001\253\001\254\001G\001\253\001H\001\255\001\254\001\255\001H\001\254"
+ "\001I\001\256\001\255\001\256\001I\001\255\001J\001\257\001\256\001\257\001"
+ "J\001\256\001K\001\260\001\257\001\260\001K\001\257\001L\001\261\001\260"
+ "\001\261\001L\001\260\001M\001\262\001\261\001\262\001M\001\261\001N\001"
+ "\263\001\262\001\263\001N\001\262\001O\001\264\001\263\001\264\001O\001\263"
+ "\001P\001\265\001\264\001\265\001P\001\264\001Q\001\266\001\265\001\266\001"
+ "Q\001\265\001R\001\267\001\266\001\267\001R\001\266\001S\001\270\001\267"
+ "\001\270\001S\001\267\001T\001\271\001\270\001\271\001T\001\270\001U\001"
+ "\272\001\271\001\272\001U\001\271\001V\001\273\001\272\001\273\001V\001\272"
+ "\001W\001\274\001\273\001\274\001W\001\273\001X\001\275\001\274\001\275\001"
+ "X\001\274\001Y\001\276\001\275\001\276\001Y\001\275\001Z\001\277\001\276"
+ "\001\277\001Z\001\276\001[\001\300\001\277\001\300\001[\001\277\001\134\001"
+ "\301\001\300\001\301\001\134\001\300\001]\001\302\001\301\001\302\001]\001"
+ "\301\001^\001\303\001\302\001\303\001^\001\302\001_\001\304\001\303\001\304"
+ "\001_\001\303\001`\001\305\001\304\001\305\001`\001\304\001a\001\306\001"
+ "\305\001\306\001a\001\305\001b\001\307\001\306\001\307\001b\001\306\001c"
+ "\001\310\001\307\001\310\001c\001\307\001d\001\311\001\310\001\311\001d\001"
+ "\310\001e\001\312\001\311\001\312\001e\001\311\001f\001\313\001\312\001\313"
+ "\001f\001\312\001g\001\314\001\313\001\314\001g\001\313\001h\001\315\001"
+ "\314\001\315\001h\001\314\001i\001\316\001\315\001\316\001i\001\315\001j"
+ "\001\317\001\316\001\317\001j\001\316\001k\001\320\001\317\001\320\001k\001"
+ "\317\001l\001\321\001\320\001\321\001l\001\320\001m\001\322\001\321\001\322"
+ "\001m\001\321\001n\001\323\001\322\001\323\001n\001\322\001o\001\324\001"
+ "\323\001\324\001o\001\323\001p\001\325\001\324\001\325\001p\001\324\001q"
+ "\001\326\001\325\001\326\001q\001\325\001r\001\327\001\326\001\327\001r\001"
+ "\326\001s\001\330\001\327\001\330\001s\001\327\001t\001\331\001\330\001\331"
+ "\001t\001\330\001u\001\332\001\331\001\332\001u\001\331\001v\001\333\001"
+ "\332\001\333\001v\001\332\001w\001\334\001\333\001\334\001w\001\333\001x"
+ "\001\335\001\334\001\335\001x\001\334\001y\001\336\001\335\001\336\001y\001"
+ "\335\001z\001\337\001\336\001\337\001z\001\336\001{\001\340\001\337\001\340"
+ "\001{\001\337\001|\001\341\001\340\001\341\001|\001\340\001}\001\342\001"
+ "\341\001\342\001}\001\341\001~\001\343\001\342\001\343\001~\001\342\001\177"
+ "\001\344\001\343\001\344\001\177\001\343\001\200\001\345\001\344\001\345"
+ "\001\200\001\344\001\201\001\346\001\345\001\346\001\201\001\345\001\202"
+ "\001\347\001\346\001\347\001\202\001\346\001\203\001\350\001\347\001\350"
+ "\001\203\001\347\001\204\001\351\001\350\001\351\001\204\001\350\001\205"
+ "\001\352\001\351\001\352\001\205\001\351\001\206\001\353\001\352\001\353"
+ "\001\206\001\352\001\207\001\354\001\353\001\354\001\207\001\353\001\210"
+ "\001\355\001\354\001\355\001\210\001\354\001\211\001\356\001\355\001\356"
+ "\001\211\001\355\001\212\001\357\001\356\001\357\001\212\001\356\001\213"
+ "\001\360\001\357\001\360\001\213\001\357\001\214\001\361\001\360\001\361"
+ "\001\214\001\360\001\215\001\362\001\361\001\362\001\215\001\361\001\216"
+ "\001\363\001\362\001\363\001\216\001\362\001\221\001\363\001\217\001\363"
+ "\001\221\001\364\001\364\001\365\001\221\001\365\001\363\001\365\001\220"
+ "\001\366\001\364\001\366\001\220\001\364\001\222\001\367\001\366\001\367"
+ "\001\222\001\366\001\223\001\370\001\367\001\370\001\223\001\367\001\224"
+ "\001\371\001\370\001\371\001\224\001\370\001\225\001\372\001\371\001\372"
+ "\001\225\001\371\001\226\001\373\001\372\001\373\001\226\001\372\001\227"
+ "\001\374\001\373\001\374\001\227\001\373\001\230\001\375\001\374\001\375"
+ "\001\230\001\374\001\231\001\376\001\375\001\376\001\231\001\375\001\232"
+ "\001\377\001\376\001\377\001\232\001\376\001\233\001\000\002\377\001\000"
+ "\002\233\001\377\001\234\001\001\002\000\002\001\002\234\001\000\002\235"
+ "\001\002\002\001\002\002\002\235\001\001\002\236\001\003\002\002\002\003"
+ "\002\236\001\002\002\237\001\004\002\003\002\004\002\237\001\003\002\240"
+ "\001\005\002\004\002\005\002\240\001\004\002\241\001\006\002\005\002\006"
+ "\002\241\001\005\002\242\001\007\002\006\002\007\002\242\001\006\002\243"
+ "\001\010\002\007\002\010\002\243\001\007\002\244\001\011\002\010\002\011"
+ "\002\244\001\010\002\245\001\012\002\011\002\012\002\245\001\011\002\246"
+ "\001\013\002\012\002\013\002\246\001\012\002\247\001\014\002\013\002\014"
+ "\002\247\001\013\002\250\001\015\002\014\002\015\002\250\001\014\002\251"
+ "\001\016\002\015\002\016\002\251\001\015\002\252\001\017\002\016\002\017"
+ "\002\252\001\016\002\253\001\020\002\017\002\020\002\253\001\017\002\254"
+ "\001\021\002\020\002\021\002\254\001\020\002\255\001\022\002\021\002\022"
+ "\002\255\001\021\002\256\001\023\002\022\002\023\002\256\001\022\002\257"
+ "\001\024\002\023\002\024\002\257\001\023\002\260\001\025\002\024\002\025"
+ "\002\260\001\024\002\261\001\026\002\025\002\026\002\261\001\025\002\262"
+ "\001\027\002\026\002\027\002\262\001\026\002\263\001\030\002\027\002\030"
+ "\002\263\001\027\002\264\001\031\002\030\002\031\002\264\001\030\002\265"
+ "\001\032\002\031\002\032\002\265\001\031\002\266\001\033\002\032\002\033"
+ "\002\266\001\032\002\267\001\034\002\033\002\034\002\267\001\033\002\270"
+ "\001\035\002\034\002\035\002\270\001\034\002\271\001\036\002\035\002\036"
+ "\002\271\001\035\002\272\001\037\002\036\002\037\002\272\001\036\002\273"
+ "\001 \002\037\002 \002\273\001\037\002\274\001!\002 \002!\002\274\001 \002"
+ "\275\001\042\002!\002\042\002\275\001!\002\276\001#\002\042\002#\002\276"
+ "\001\042\002\277\001$\002#\002$\002\277\001#\002\300\001%\002$\002%\002\300"
+ "\001$\002\301\001&\002%\002&\002\301\001%\002\302\001'\002&\002'\002\302"
+ "\001&\002\303\001(\002'\002(\002\303\001'\002\304\001)\002(\002)\002\304"
+ "\001(\002\305\001*\002)\002*\002\305\001)\002\306\001+\002*\002+\002\306"
+ "\001*\002\307\001,\002+\002,\002\307\001+\002\310\001-\002,\002-\002\310"
+ "\001,\002\311\001.\002-\002.\002\311\001-\002\312\001/\002.\002/\002\312"
+ "\001.\002\313\0010\002/\0020\002\313\001/\002\314\0011\0020\0021\002\314"
+ "\0010\002\315\0012\0021\0022\002\315\0011\002\316\0013\0022\0023\002\316"
+ "\0012\002\317\0014\0023\0024\002\317\0013\002\320\0015\0024\0025\002\320"
+ "\0014\002\321\0016\0025\0026\002\321\0015\002\322\0017\0026\0027\002\322"
+ "\0016\002\323\0018\0027\0028\002\323\0017\002\324\0019\0028\0029\002\324"
+ "\0018\002\325\001:\0029\002:\002\325\0019\002\326\001;\002:\002;\002\326"
+ "\001:\002\327\001<\002;\002<\002\327\001;\002\330\001=\002<\002=\002\330"
+ "\001<\002\331\001>\002=\002>\002\331\001=\002\332\001\077\002>\002\077\002"
+ "\332\001>\002\333\001@\002\077\002@\002\333\001\077\002\334\001A\002@\002"
+ "A\002\334\001@\002\335\001B\002A\002B\002\335\001A\002\336\001C\002B\002"
+ "C\002\336\001B\002\337\001D\002C\002D\002\337\001C\002\340\001E\002D\002"
+ "E\002\340\001D\002\341\001F\002E\002F\002\341\001E\002\342\001G\002F\002"
+ "G\002\342\001F\002\343\001H\002G\002H\002\343\001G\002\344\001I\002H\002"
+ "I\002\344\001H\002\345\001J\002I\002J\002\345\001I\002\346\001K\002J\002"
+ "K\002\346\001J\002\347\001L\002K\002L\002\347\001K\002\350\001M\002L\002"
+ "M\002\350\001L\002\351\001N\002M\002N\002\351\001M\002\352\001O\002N\002"
+ "O\002\352\001N\002\353\001P\002O\002P\002\353\001O\002\354\001Q\002P\002"
+ "Q\002\354\001P\002\355\001R\002Q\002R\002\355\001Q\002\356\001S\002R\002"
+ "S\002\356\001R\002\357\001T\002S\002T\002\357\001S\002\360\001U\002T\002"
+ "U\002\360\001T\002\361\001V\002U\002V\002\361\001U\002\362\001W\002V\002"
+ "W\002\362\001V\002\365\001W\002\363\001W\002\365\001X\002X\002Y\002\365\001"
+ "Y\002W\002Y\002\364\001Z\002X\002Z\002\364\001X\002\366\001[\002Z\002[\002"
+ "\366\001Z\002\367\001\134\002[\002\134\002\367\001[\002\370\001]\002\134"
+ "\002]\002\370\001\134\002\371\001^\002]\002^\002\371\001]\002\372\001_\002"
+ "^\002_\002\372\001^\002\373\001`\002_\002`\002\373\001_\002\374\001a\002"
+ "`\002a\002\374\001`\002\375\001b\002a\002b\002\375\001a\002\376\001c\002"
+ "b\002c\002\376\001b\002\377\001d\002c\002d\002\377\001c\002\000\002e\002"
+ "d\002e\002\000\002d\002\001\002f\002e\002f\002\001\002e\002\002\002g\002"
+ "f\002g\002\002\002f\002\003\002h\002g\002h\002\003\002g\002\004\002i\002"
+ "h\002i\002\004\002h\002\005\002j\002i\002j\002\005\002i\002\006\002k\002"
+ "j\002k\002\006\002j\002\007\002l\002k\002l\002\007\002k\002\010\002m\002"
+ "l\002m\002\010\002l\002\011\002n\002m\002n\002\011\002m\002\012\002o\002"
+ "n\002o\002\012\002n\002\013\002p\002o\002p\002\013\002o\002\014\002q\002"
+ "p\002q\002\014\002p\002\015\002r\002q\002r\002\015\002q\002\016\002s\002"
+ "r\002s\002\016\002r\002\017\002t\002s\002t\002\017\002s\002\020\002u\002"
+ "t\002u\002\020\002t\002\021\002v\002u\002v\002\021\002u\002\022\002w\002"
+ "v\002w\002\022\002v\002\023\002x\002w\002x\002\023\002w\002\024\002y\002"
+ "x\002y\002\024\002x\002\025\002z\002y\002z\002\025\002y\002\026\002{\002"
+ "z\002{\002\026\002z\002\027\002|\002{\002|\002\027\002{\002\030\002}\002"
+ "|\002}\002\030\002|\002\031\002~\002}\002~\002\031\002}\002\032\002\177\002"
+ "~\002\177\002\032\002~\002\033\002\200\002\177\002\200\002\033\002\177\002"
+ "\034\002\201\002\200\002\201\002\034\002\200\002\035\002\202\002\201\002"
+ "\202\002\035\002\201\002\036\002\203\002\202\002\203\002\036\002\202\002"
+ "\037\002\204\002\203\002\204\002\037\002\203\002 \002\205\002\204\002\205"
+ "\002 \002\204\002!\002\206\002\205\002\206\002!\002\205\002\042\002\207\002"
+ "\206\002\207\002\042\002\206\002#\002\210\002\207\002\210\002#\002\207\002"
+ "$\002\211\002\210\002\211\002$\002\210\002%\002\212\002\211\002\212\002%"
+ "\002\211\002&\002\213\002\212\002\213\002&\002\212\002'\002\214\002\213\002"
+ "\214\002'\002\213\002(\002\215\002\214\002\215\002(\002\214\002)\002\216"
+ "\002\215\002\216\002)\002\215\002*\002\217\002\216\002\217\002*\002\216\002"
+ "+\002\220\002\217\002\220\002+\002\217\002,\002\221\002\220\002\221\002,"
+ "\002\220\002-\002\222\002\221\002\222\002-\002\221\002.\002\223\002\222\002"
+ "\223\002.\002\222\002/\002\224\002\223\002\224\002/\002\223\0020\002\225"
+ "\002\224\002\225\0020\002\224\0021\002\226\002\225\002\226\0021\002\225\002"
+ "2\002\227\002\226\002\227\0022\002\226\0023\002\230\002\227\002\230\0023"
+ "\002\227\0024\002\231\002\230\002\231\0024\002\230\0025\002\232\002\231\002"
+ "\232\0025\002\231\0026\002\233\002\232\002\233\0026\002\232\0027\002\234"
+ "\002\233\002\234\0027\002\233\0028\002\235\002\234\002\235\0028\002\234\002"
+ "9\002\236\002\235\002\236\0029\002\235\002:\002\237\002\236\002\237\002:"
+ "\002\236\002;\002\240\002\237\002\240\002;\002\237\002<\002\241\002\240\002"
+ "\241\002<\002\240\002=\002\242\002\241\002\242\002=\002\241\002>\002\243"
+ "\002\242\002\243\002>\002\242\002\077\002\244\002\243\002\244\002\077\002"
+ "\243\002@\002\245\002\244\002\245\002@\002\244\002A\002\246\002\245\002\246"
+ "\002A\002\245\002B\002\247\002\246\002\247\002B\002\246\002C\002\250\002"
+ "\247\002\250\002C\002\247\002D\002\251\002\250\002\251\002D\002\250\002E"
+ "\002\252\002\251\002\252\002E\002\251\002F\002\253\002\252\002\253\002F\002"
+ "\252\002G\002\254\002\253\002\254\002G\002\253\002H\002\255\002\254\002\255"
+ "\002H\002\254\002I\002\256\002\255\002\256\002I\002\255\002J\002\257\002"
+ "\256\002\257\002J\002\256\002K\002\260\002\257\002\260\002K\002\257\002L"
+ "\002\261\002\260\002\261\002L\002\260\002M\002\262\002\261\002\262\002M\002"
+ "\261\002N\002\263\002\262\002\263\002N\002\262\002O\002\264\002\263\002\264"
+ "\002O\002\263\002P\002\265\002\264\002\265\002P\002\264\002Q\002\266\002"
+ "\265\002\266\002Q\002\265\002R\002\267\002\266\002\267\002R\002\266\002S"
+ "\002\270\002\267\002\270\002S\002\267\002T\002\271\002\270\002\271\002T\002"
+ "\270\002U\002\272\002\271\002\272\002U\002\271\002V\002\273\002\272\002\273"
+ "\002V\002\272\002Y\002\273\002W\002\273\002Y\002\274\002\274\002\275\002"
+ "Y\002\275\002\273\002\275\002X\002\276\002\274\002\276\002X\002\274\002Z"
+ "\002\277\002\276\002\277\002Z\002\276\002[\002\300\002\277\002\300\002[\002"
+ "\277\002\134\002\301\002\300\002\301\002\134\002\300\002]\002\302\002\301"
+ "\002\302\002]\002\301\002^\002\303\002\302\002\303\002^\002\302\002_\002"
+ "\304\002\303\002\304\002_\002\303\002`\002\305\002\304\002\305\002`\002\304"
+ "\002a\002\306\002\305\002\306\002a\002\305\002b\002\307\002\306\002\307\002"
+ "b\002\306\002c\002\310\002\307\002\310\002c\002\307\002d\002\311\002\310"
+ "\002\311\002d\002\310\002e\002\312\002\311\002\312\002e\002\311\002f\002"
+ "\313\002\312\002\313\002f\002\312\002g\002\314\002\313\002\314\002g\002\313"
+ "\002h\002\315\002\314\002\315\002h\002\314\002i\002\316\002\315\002\316\002"
+ "i\002\315\002j\002\317\002\316\002\317\002j\002\316\002k\002\320\002\317"
+ "\002\320\002k\002\317\002l\002\321\002\320\002\321\002l\002\320\002m\002"
+ "\322\002\321\002\322\002m\002\321\002n\002\323\002\322\002\323\002n\002\322"
+ "\002o\002\324\002\323\002\324\002o\002\323\002p\002\325\002\324\002\325\002"
+ "p\002\324\002q\002\326\002\325\002\326\002q\002\325\002r\002\327\002\326"
+ "\002\327\002r\002\326\002s\002\330\002\327\002\330\002s\002\327\002t\002"
+ "\331\002\330\002\331\002t\002\330\002u\002\332\002\331\002\332\002u\002\331"
+ "\002v\002\333\002\332\002\333\002v\002\332\002w\002\334\002\333\002\334\002"
+ "w\002\333\002x\002\335\002\334\002\335\002x\002\334\002y\002\336\002\335"
+ "\002\336\002y\002\335\002z\002\337\002\336\002\337\002z\002\336\002{\002"
+ "\340\002\337\002\340\002{\002\337\002|\002\341\002\340\002\341\002|\002\340"
+ "\002}\002\342\002\341\002\342\002}\002\341\002~\002\343\002\342\002\343\002"
+ "~\002\342\002\177\002\344\002\343\002\344\002\177\002\343\002\200\002\345"
+ "\002\344\002\345\002\200\002\344\002\201\002\346\002\345\002\346\002\201"
+ "\002\345\002\202\002\347\002\346\002\347\002\202\002\346\002\203\002\350"
+ "\002\347\002\350\002\203\002\347\002\204\002\351\002\350\002\351\002\204"
+ "\002\350\002\205\002\352\002\351\002\352\002\205\002\351\002\206\002\353"
+ "\002\352\002\353\002\206\002\352\002\207\002\354\002\353\002\354\002\207"
+ "\002\353\002\210\002\355\002\354\002\355\002\210\002\354\002\211\002\356"
+ "\002\355\002\356\002\211\002\355\002\212\002\357\002\356\002\357\002\212"
+ "\002\356\002\213\002\360\002\357\002\360\002\213\002\357\002\214\002\361"
+ "\002\360\002\361\002\214\002\360\002\215\002\362\002\361\002\362\002\215"
+ "\002\361\002\216\002\363\002\362\002\363\002\216\002\362\002\217\002\364"
+ "\002\363\002\364\002\217\002\363\002\220\002\365\002\364\002\365\002\220"
+ "\002\364\002\221\002\366\002\365\002\366\002\221\002\365\002\222\002\367"
+ "\002\366\002\367\002\222\002\366\002\223\002\370\002\367\002\370\002\223"
+ "\002\367\002\224\002\371\002\370\002\371\002\224\002\370\002\225\002\372"
+ "\002\371\002\372\002\225\002\371\002\226\002\373\002\372\002\373\002\226"
+ "\002\372\002\227\002\374\002\373\002\374\002\227\002\373\002\230\002\375"
+ "\002\374\002\375\002\230\002\374\002\231\002\376\002\375\002\376\002\231"
+ "\002\375\002\232\002\377\002\376\002\377\002\232\002\376\002\233\002\000"
+ "\003\377\002\000\003\233\002\377\002\234\002\001\003\000\003\001\003\234"
+ "\002\000\003\235\002\002\003\001\003\002\003\235\002\001\003\236\002\003"
+ "\003\002\003\003\003\236\002\002\003\237\002\004\003\003\003\004\003\237"
+ "\002\003\003\240\002\005\003\004\003\005\003\240\002\004\003\241\002\006"
+ "\003\005\003\006\003\241\002\005\003\242\002\007\003\006\003\007\003\242"
+ "\002\006\003\243\002\010\003\007\003\010\003\243\002\007\003\244\002\011"
+ "\003\010\003\011\003\244\002\010\003\245\002\012\003\011\003\012\003\245"
+ "\002\011\003\246\002\013\003\012\003\013\003\246\002\012\003\247\002\014"
+ "\003\013\003\014\003\247\002\013\003\250\002\015\003\014\003\015\003\250"
+ "\002\014\003\251\002\016\003\015\003\016\003\251\002\015\003\252\002\017"
+ "\003\016\003\017\003\252\002\016\003\253\002\020\003\017\003\020\003\253"
+ "\002\017\003\254\002\021\003\020\003\021\003\254\002\020\003\255\002\022"
+ "\003\021\003\022\003\255\002\021\003\256\002\023\003\022\003\023\003\256"
+ "\002\022\003\257\002\024\003\023\003\024\003\257\002\023\003\260\002\025"
+ "\003\024\003\025\003\260\002\024\003\261\002\026\003\025\003\026\003\261"
+ "\002\025\003\262\002\027\003\026\003\027\003\262\002\026\003\263\002\030"
+ "\003\027\003\030\003\263\002\027\003\264\002\031\003\030\003\031\003\264"
+ "\002\030\003\265\002\032\003\031\003\032\003\265\002\031\003\266\002\033"
+ "\003\032\003\033\003\266\002\032\003\267\002\034\003\033\003\034\003\267"
+ "\002\033\003\270\002\035\003\034\003\035\003\270\002\034\003\271\002\036"
+ "\003\035\003\036\003\271\002\035\003\272\002\037\003\036\003\037\003\272"
+ "\002\036\003\275\002\037\003\273\002\037\003\275\002 \003 \003!\003\275\002"
+ "!\003\037\003!\003\274\002\042\003 \003\042\003\274\002 \003\276\002#\003"
+ "\042\003#\003\276\002\042\003\277\002$\003#\003$\003\277\002#\003\300\002"
+ "%\003$\003%\003\300\002$\003\301\002&\003%\003&\003\301\002%\003\302\002"
+ "'\003&\003'\003\302\002&\003\303\002(\003'\003(\003\303\002'\003\304\002"
+ ")\003(\003)\003\304\002(\003\305\002*\003)\003*\003\305\002)\003\306\002"
+ "+\003*\003+\003\306\002*\003\307\002,\003+\003,\003\307\002+\003\310\002"
+ "-\003,\003-\003\310\002,\003\311\002.\003-\003.\003\311\002-\003\312\002"
+ "/\003.\003/\003\312\002.\003\313\0020\003/\0030\003\313\002/\003\314\002"
+ "1\0030\0031\003\314\0020\003\315\0022\0031\0032\003\315\0021\003\316\002"
+ "3\0032\0033\003\316\0022\003\317\0024\0033\0034\003\317\0023\003\320\002"
+ "5\0034\0035\003\320\0024\003\321\0026\0035\0036\003\321\0025\003\322\002"
+ "7\0036\0037\003\322\0026\003\323\0028\0037\0038\003\323\0027\003\324\002"
+ "9\0038\0039\003\324\0028\003\325\002:\0039\003:\003\325\0029\003\326\002"
+ ";\003:\003;\003\326\002:\003\327\002<\003;\003<\003\327\002;\003\330\002"
+ "=\003<\003=\003\330\002<\003\331\002>\003=\003>\003\331\002=\003\332\002"
+ "\077\003>\003\077\003\332\002>\003\333\002@\003\077\003@\003\333\002\077"
+ "\003\334\002A\003@\003A\003\334\002@\003\335\002B\003A\003B\003\335\002A"
+ "\003\336\002C\003B\003C\003\336\002B\003\337\002D\003C\003D\003\337\002C"
+ "\003\340\002E\003D\003E\003\340\002D\003\341\002F\003E\003F\003\341\002E"
+ "\003\342\002G\003F\003G\003\342\002F\003\343\002H\003G\003H\003\343\002G"
+ "\003\344\002I\003H\003I\003\344\002H\003\345\002J\003I\003J\003\345\002I"
+ "\003\346\002K\003J\003K\003\346\002J\003\347\002L\003K\003L\003\347\002K"
+ "\003\350\002M\003L\003M\003\350\002L\003\351\002N\003M\003N\003\351\002M"
+ "\003\352\002O\003N\003O\003\352\002N\003\353\002P\003O\003P\003\353\002O"
+ "\003\354\002Q\003P\003Q\003\354\002P\003\355\002R\003Q\003R\003\355\002Q"
+ "\003\356\002S\003R\003S\003\356\002R\003\357\002T\003S\003T\003\357\002S"
+ "\003\360\002U\003T\003U\003\360\002T\003\361\002V\003U\003V\003\361\002U"
+ "\003\362\002W\003V\003W\003\362\002V\003\363\002X\003W\003X\003\363\002W"
+ "\003\364\002Y\003X\003Y\003\364\002X\003\365\002Z\003Y\003Z\003\365\002Y"
+ "\003\366\002[\003Z\003[\003\366\002Z\003\367\002\134\003[\003\134\003\367"
+ "\002[\003\370\002]\003\134\003]\003\370\002\134\003\371\002^\003]\003^\003"
+ "\371\002]\003\372\002_\003^\003_\003\372\002^\003\373\002`\003_\003`\003"
+ "\373\002_\003\374\002a\003`\003a\003\374\002`\003\375\002b\003a\003b\003"
+ "\375\002a\003\376\002c\003b\003c\003\376\002b\003\377\002d\003c\003d\003"
+ "\377\002c\003\000\003e\003d\003e\003\000\003d\003\001\003f\003e\003f\003"
+ "\001\003e\003\002\003g\003f\003g\003\002\003f\003\003\003h\003g\003h\003"
+ "\003\003g\003\004\003i\003h\003i\003\004\003h\003\005\003j\003i\003j\003"
+ "\005\003i\003\006\003k\003j\003k\003\006\003j\003\007\003l\003k\003l\003"
+ "\007\003k\003\010\003m\003l\003m\003\010\003l\003\011\003n\003m\003n\003"
+ "\011\003m\003\012\003o\003n\003o\003\012\003n\003\013\003p\003o\003p\003"
+ "\013\003o\003\014\003q\003p\003q\003\014\003p\003\015\003r\003q\003r\003"
+ "\015\003q\003\016\003s\003r\003s\003\016\003r\003\017\003t\003s\003t\003"
+ "\017\003s\003\020\003u\003t\003u\003\020\003t\003\021\003v\003u\003v\003"
+ "\021\003u\003\022\003w\003v\003w\003\022\003v\003\023\003x\003w\003x\003"
+ "\023\003w\003\024\003y\003x\003y\003\024\003x\003\025\003z\003y\003z\003"
+ "\025\003y\003\026\003{\003z\003{\003\026\003z\003\027\003|\003{\003|\003"
+ "\027\003{\003\030\003}\003|\003}\003\030\003|\003\031\003~\003}\003~\003"
+ "\031\003}\003\032\003\177\003~\003\177\003\032\003~\003\033\003\200\003\177"
+ "\003\200\003\033\003\177\003\034\003\201\003\200\003\201\003\034\003\200"
+ "\003\035\003\202\003\201\003\202\003\035\003\201\003\036\003\203\003\202"
+ "\003\203\003\036\003\202\003!\003\203\003\037\003\203\003!\003\204\003\204"
+ "\003\205\003!\003\205\003\203\003\205\003 \003\206\003\204\003\206\003 \003"
+ "\204\003\042\003\207\003\206\003\207\003\042\003\206\003#\003\210\003\207"
+ "\003\210\003#\003\207\003$\003\211\003\210\003\211\003$\003\210\003%\003"
+ "\212\003\211\003\212\003%\003\211\003&\003\213\003\212\003\213\003&\003\212"
+ "\003'\003\214\003\213\003\214\003'\003\213\003(\003\215\003\214\003\215\003"
+ "(\003\214\003)\003\216\003\215\003\216\003)\003\215\003*\003\217\003\216"
+ "\003\217\003*\003\216\003+\003\220\003\217\003\220\003+\003\217\003,\003"
+ "\221\003\220\003\221\003,\003\220\003-\003\222\003\221\003\222\003-\003\221"
+ "\003.\003\223\003\222\003\223\003.\003\222\003/\003\224\003\223\003\224\003"
+ "/\003\223\0030\003\225\003\224\003\225\0030\003\224\0031\003\226\003\225"
+ "\003\226\0031\003\225\0032\003\227\003\226\003\227\0032\003\226\0033\003"
+ "\230\003\227\003\230\0033\003\227\0034\003\231\003\230\003\231\0034\003\230"
+ "\0035\003\232\003\231\003\232\0035\003\231\0036\003\233\003\232\003\233\003"
+ "6\003\232\0037\003\234\003\233\003\234\0037\003\233\0038\003\235\003\234"
+ "\003\235\0038\003\234\0039\003\236\003\235\003\236\0039\003\235\003:\003"
+ "\237\003\236\003\237\003:\003\236\003;\003\240\003\237\003\240\003;\003\237"
+ "\003<\003\241\003\240\003\241\003<\003\240\003=\003\242\003\241\003\242\003"
+ "=\003\241\003>\003\243\003\242\003\243\003>\003\242\003\077\003\244\003\243"
+ "\003\244\003\077\003\243\003@\003\245\003\244\003\245\003@\003\244\003A\003"
+ "\246\003\245\003\246\003A\003\245\003B\003\247\003\246\003\247\003B\003\246"
+ "\003C\003\250\003\247\003\250\003C\003\247\003D\003\251\003\250\003\251\003"
+ "D\003\250\003E\003\252\003\251\003\252\003E\003\251\003F\003\253\003\252"
+ "\003\253\003F\003\252\003G\003\254\003\253\003\254\003G\003\253\003H\003"
+ "\255\003\254\003\255\003H\003\254\003I\003\256\003\255\003\256\003I\003\255"
+ "\003J\003\257\003\256\003\257\003J\003\256\003K\003\260\003\257\003\260\003"
+ "K\003\257\003L\003\261\003\260\003\261\003L\003\260\003M\003\262\003\261"
+ "\003\262\003M\003\261\003N\003\263\003\262\003\263\003N\003\262\003O\003"
+ "\264\003\263\003\264\003O\003\263\003P\003\265\003\264\003\265\003P\003\264"
+ "\003Q\003\266\003\265\003\266\003Q\003\265\003R\003\267\003\266\003\267\003"
+ "R\003\266\003S\003\270\003\267\003\270\003S\003\267\003T\003\271\003\270"
+ "\003\271\003T\003\270\003U\003\272\003\271\003\272\003U\003\271\003V\003"
+ "\273\003\272\003\273\003V\003\272\003W\003\274\003\273\003\274\003W\003\273"
+ "\003X\003\275\003\274\003\275\003X\003\274\003Y\003\276\003\275\003\276\003"
+ "Y\003\275\003Z\003\277\003\276\003\277\003Z\003\276\003[\003\300\003\277"
+ "\003\300\003[\003\277\003\134\003\301\003\300\003\301\003\134\003\300\003"
+ "]\003\302\003\301\003\302\003]\003\301\003^\003\303\003\302\003\303\003^"
+ "\003\302\003_\003\304\003\303\003\304\003_\003\303\003`\003\305\003\304\003"
+ "\305\003`\003\304\003a\003\306\003\305\003\306\003a\003\305\003b\003\307"
+ "\003\306\003\307\003b\003\306\003c\003\310\003\307\003\310\003c\003\307\003"
+ "d\003\311\003\310\003\311\003d\003\310\003e\003\312\003\311\003\312\003e"
+ "\003\311\003f\003\313\003\312\003\313\003f\003\312\003g\003\314\003\313\003"
+ "\314\003g\003\313\003h\003\315\003\314\003\315\003h\003\314\003i\003\316"
+ "\003\315\003\316\003i\003\315\003j\003\317\003\316\003\317\003j\003\316\003"
+ "k\003\320\003\317\003\320\003k\003\317\003l\003\321\003\320\003\321\003l"
+ "\003\320\003m\003\322\003\321\003\322\003m\003\321\003n\003\323\003\322\003"
+ "\323\003n\003\322\003o\003\324\003\323\003\324\003o\003\323\003p\003\325"
+ "\003\324\003\325\003p\003\324\003q\003\326\003\325\003\326\003q\003\325\003"
+ "r\003\327\003\326\003\327\003r\003\326\003s\003\330\003\327\003\330\003s"
+ "\003\327\003t\003\331\003\330\003\331\003t\003\330\003u\003\332\003\331\003"
+ "\332\003u\003\331\003v\003\333\003\332\003\333\003v\003\332\003w\003\334"
+ "\003\333\003\334\003w\003\333\003x\003\335\003\334\003\335\003x\003\334\003"
+ "y\003\336\003\335\003\336\003y\003\335\003z\003\337\003\336\003\337\003z"
+ "\003\336\003{\003\340\003\337\003\340\003{\003\337\003|\003\341\003\340\003"
+ "\341\003|\003\340\003}\003\342\003\341\003\342\003}\003\341\003~\003\343"
+ "\003\342\003\343\003~\003\342\003\177\003\344\003\343\003\344\003\177\003"
+ "\343\003\200\003\345\003\344\003\345\003\200\003\344\003\201\003\346\003"
+ "\345\003\346\003\201\003\345\003\202\003\347\003\346\003\347\003\202\003"
+ "\346\003\205\003\347\003\203\003\347\003\205\003\350\003\350\003\351\003"
+ "\205\003\351\003\347\003\351\003\204\003\352\003\350\003\352\003\204\003"
+ "\350\003\206\003\353\003\352\003\353\003\206\003\352\003\207\003\354\003"
+ "\353\003\354\003\207\003\353\003\210\003\355\003\354\003\355\003\210\003"
+ "\354\003\211\003\356\003\355\003\356\003\211\003\355\003\212\003\357\003"
+ "\356\003\357\003\212\003\356\003\213\003\360\003\357\003\360\003\213\003"
+ "\357\003\214\003\361\003\360\003\361\003\214\003\360\003\215\003\362\003"
+ "\361\003\362\003\215\003\361\003\216\003\363\003\362\003\363\003\216\003"
+ "\362\003\217\003\364\003\363\003\364\003\217\003\363\003\220\003\365\003"
+ "\364\003\365\003\220\003\364\003\221\003\366\003\365\003\366\003\221\003"
+ "\365\003\222\003\367\003\366\003\367\003\222\003\366\003\223\003\370\003"
+ "\367\003\370\003\223\003\367\003\224\003\371\003\370\003\371\003\224\003"
+ "\370\003\225\003\372\003\371\003\372\003\225\003\371\003\226\003\373\003"
+ "\372\003\373\003\226\003\372\003\227\003\374\003\373\003\374\003\227\003"
+ "\373\003\230\003\375\003\374\003\375\003\230\003\374\003\231\003\376\003"
+ "\375\003\376\003\231\003\375\003\232\003\377\003\376\003\377\003\232\003"
+ "\376\003\233\003\000\004\377\003\000\004\233\003\377\003\234\003\001\004"
+ "\000\004\001\004\234\003\000\004\235\003\002\004\001\004\002\004\235\003"
+ "\001\004\236\003\003\004\002\004\003\004\236\003\002\004\237\003\004\004"
+ "\003\004\004\004\237\003\003\004\240\003\005\004\004\004\005\004\240\003"
+ "\004\004\241\003\006\004\005\004\006\004\241\003\005\004\242\003\007\004"
+ "\006\004\007\004\242\003\006\004\243\003\010\004\007\004\010\004\243\003"
+ "\007\004\244\003\011\004\010\004\011\004\244\003\010\004\245\003\012\004"
+ "\011\004\012\004\245\003\011\004\246\003\013\004\012\004\013\004\246\003"
+ "\012\004\247\003\014\004\013\004\014\004\247\003\013\004\250\003\015\004"
+ "\014\004\015\004\250\003\014\004\251\003\016\004\015\004\016\004\251\003"
+ "\015\004\252\003\017\004\016\004\017\004\252\003\016\004\253\003\020\004"
+ "\017\004\020\004\253\003\017\004\254\003\021\004\020\004\021\004\254\003"
+ "\020\004\255\003\022\004\021\004\022\004\255\003\021\004\256\003\023\004"
+ "\022\004\023\004\256\003\022\004\257\003\024\004\023\004\024\004\257\003"
+ "\023\004\260\003\025\004\024\004\025\004\260\003\024\004\261\003\026\004"
+ "\025\004\026\004\261\003\025\004\262\003\027\004\026\004\027\004\262\003"
+ "\026\004\263\003\030\004\027\004\030\004\263\003\027\004\264\003\031\004"
+ "\030\004\031\004\264\003\030\004\265\003\032\004\031\004\032\004\265\003"
+ "\031\004\266\003\033\004\032\004\033\004\266\003\032\004\267\003\034\004"
+ "\033\004\034\004\267\003\033\004\270\003\035\004\034\004\035\004\270\003"
+ "\034\004\271\003\036\004\035\004\036\004\271\003\035\004\272\003\037\004"
+ "\036\004\037\004\272\003\036\004\273\003 \004\037\004 \004\273\003\037\004"
+ "\274\003!\004 \004!\004\274\003 \004\275\003\042\004!\004\042\004\275\003"
+ "!\004\276\003#\004\042\004#\004\276\003\042\004\277\003$\004#\004$\004\277"
+ "\003#\004\300\003%\004$\004%\004\300\003$\004\301\003&\004%\004&\004\301"
+ "\003%\004\302\003'\004&\004'\004\302\003&\004\303\003(\004'\004(\004\303"
+ "\003'\004\304\003)\004(\004)\004\304\003(\004\305\003*\004)\004*\004\305"
+ "\003)\004\306\003+\004*\004+\004\306\003*\004\307\003,\004+\004,\004\307"
+ "\003+\004\310\003-\004,\004-\004\310\003,\004\311\003.\004-\004.\004\311"
+ "\003-\004\312\003/\004.\004/\004\312\003.\004\313\0030\004/\0040\004\313"
+ "\003/\004\314\0031\0040\0041\004\314\0030\004\315\0032\0041\0042\004\315"
+ "\0031\004\316\0033\0042\0043\004\316\0032\004\317\0034\0043\0044\004\317"
+ "\0033\004\320\0035\0044\0045\004\320\0034\004\321\0036\0045\0046\004\321"
+ "\0035\004\322\0037\0046\0047\004\322\0036\004\323\0038\0047\0048\004\323"
+ "\0037\004\324\0039\0048\0049\004\324\0038\004\325\003:\0049\004:\004\325"
+ "\0039\004\326\003;\004:\004;\004\326\003:\004\327\003<\004;\004<\004\327"
+ "\003;\004\330\003=\004<\004=\004\330\003<\004\331\003>\004=\004>\004\331"
+ "\003=\004\332\003\077\004>\004\077\004\332\003>\004\333\003@\004\077\004"
+ "@\004\333\003\077\004\334\003A\004@\004A\004\334\003@\004\335\003B\004A\004"
+ "B\004\335\003A\004\336\003C\004B\004C\004\336\003B\004\337\003D\004C\004"
+ "D\004\337\003C\004\340\003E\004D\004E\004\340\003D\004\341\003F\004E\004"
+ "F\004\341\003E\004\342\003G\004F\004G\004\342\003F\004\343\003H\004G\004"
+ "H\004\343\003G\004\344\003I\004H\004I\004\344\003H\004\345\003J\004I\004"
+ "J\004\345\003I\004\346\003K\004J\004K\004\346\003J\004\351\003K\004\347\003"
+ "K\004\351\003L\004L\004M\004\351\003M\004K\004M\004\350\003N\004L\004N\004"
+ "\350\003L\004\352\003O\004N\004O\004\352\003N\004\353\003P\004O\004P\004"
+ "\353\003O\004\354\003Q\004P\004Q\004\354\003P\004\355\003R\004Q\004R\004"
+ "\355\003Q\004\356\003S\004R\004S\004\356\003R\004\357\003T\004S\004T\004"
+ "\357\003S\004\360\003U\004T\004U\004\360\003T\004\361\003V\004U\004V\004"
+ "\361\003U\004\362\003W\004V\004W\004\362\003V\004\363\003X\004W\004X\004"
+ "\363\003W\004\364\003Y\004X\004Y\004\364\003X\004\365\003Z\004Y\004Z\004"
+ "\365\003Y\004\366\003[\004Z\004[\004\366\003Z\004\367\003\134\004[\004\134"
+ "\004\367\003[\004\370\003]\004\134\004]\004\370\003\134\004\371\003^\004"
+ "]\004^\004\371\003]\004\372\003_\004^\004_\004\372\003^\004\373\003`\004"
+ "_\004`\004\373\003_\004\374\003a\004`\004a\004\374\003`\004\375\003b\004"
+ "a\004b\004\375\003a\004\376\003c\004b\004c\004\376\003b\004\377\003d\004"
+ "c\004d\004\377\003c\004\000\004e\004d\004e\004\000\004d\004\001\004f\004"
+ "e\004f\004\001\004e\004\002\004g\004f\004g\004\002\004f\004\003\004h\004"
+ "g\004h\004\003\004g\004\004\004i\004h\004i\004\004\004h\004\005\004j\004"
+ "i\004j\004\005\004i\004\006\004k\004j\004k\004\006\004j\004\007\004l\004"
+ "k\004l\004\007\004k\004\010\004m\004l\004m\004\010\004l\004\011\004n\004"
+ "m\004n\004\011\004m\004\012\004o\004n\004o\004\012\004n\004\013\004p\004"
+ "o\004p\004\013\004o\004\014\004q\004p\004q\004\014\004p\004\015\004r\004"
+ "q\004r\004\015\004q\004\016\004s\004r\004s\004\016\004r\004\017\004t\004"
+ "s\004t\004\017\004s\004\020\004u\004t\004u\004\020\004t\004\021\004v\004"
+ "u\004v\004\021\004u\004\022\004w\004v\004w\004\022\004v\004\023\004x\004"
+ "w\004x\004\023\004w\004\024\004y\004x\004y\004\024\004x\004\025\004z\004"
+ "y\004z\004\025\004y\004\026\004{\004z\004{\004\026\004z\004\027\004|\004"
+ "{\004|\004\027\004{\004\030\004}\004|\004}\004\030\004|\004\031\004~\004"
+ "}\004~\004\031\004}\004\032\004\177\004~\004\177\004\032\004~\004\033\004"
+ "\200\004\177\004\200\004\033\004\177\004\034\004\201\004\200\004\201\004"
+ "\034\004\200\004\035\004\202\004\201\004\202\004\035\004\201\004\036\004"
+ "\203\004\202\004\203\004\036\004\202\004\037\004\204\004\203\004\204\004"
+ "\037\004\203\004 \004\205\004\204\004\205\004 \004\204\004!\004\206\004\205"
+ "\004\206\004!\004\205\004\042\004\207\004\206\004\207\004\042\004\206\004"
+ "#\004\210\004\207\004\210\004#\004\207\004$\004\211\004\210\004\211\004$"
+ "\004\210\004%\004\212\004\211\004\212\004%\004\211\004&\004\213\004\212\004"
+ "\213\004&\004\212\004'\004\214\004\213\004\214\004'\004\213\004(\004\215"
+ "\004\214\004\215\004(\004\214\004)\004\216\004\215\004\216\004)\004\215\004"
+ "*\004\217\004\216\004\217\004*\004\216\004+\004\220\004\217\004\220\004+"
+ "\004\217\004,\004\221\004\220\004\221\004,\004\220\004-\004\222\004\221\004"
+ "\222\004-\004\221\004.\004\223\004\222\004\223\004.\004\222\004/\004\224"
+ "\004\223\004\224\004/\004\223\0040\004\225\004\224\004\225\0040\004\224\004"
+ "1\004\226\004\225\004\226\0041\004\225\0042\004\227\004\226\004\227\0042"
+ "\004\226\0043\004\230\004\227\004\230\0043\004\227\0044\004\231\004\230\004"
+ "\231\0044\004\230\0045\004\232\004\231\004\232\0045\004\231\0046\004\233"
+ "\004\232\004\233\0046\004\232\0047\004\234\004\233\004\234\0047\004\233\004"
+ "8\004\235\004\234\004\235\0048\004\234\0049\004\236\004\235\004\236\0049"
+ "\004\235\004:\004\237\004\236\004\237\004:\004\236\004;\004\240\004\237\004"
+ "\240\004;\004\237\004<\004\241\004\240\004\241\004<\004\240\004=\004\242"
+ "\004\241\004\242\004=\004\241\004>\004\243\004\242\004\243\004>\004\242\004"
+ "\077\004\244\004\243\004\244\004\077\004\243\004@\004\245\004\244\004\245"
+ "\004@\004\244\004A\004\246\004\245\004\246\004A\004\245\004B\004\247\004"
+ "\246\004\247\004B\004\246\004C\004\250\004\247\004\250\004C\004\247\004D"
+ "\004\251\004\250\004\251\004D\004\250\004E\004\252\004\251\004\252\004E\004"
+ "\251\004F\004\253\004\252\004\253\004F\004\252\004G\004\254\004\253\004\254"
+ "\004G\004\253\004H\004\255\004\254\004\255\004H\004\254\004I\004\256\004"
+ "\255\004\256\004I\004\255\004J\004\257\004\256\004\257\004J\004\256\004M"
+ "\004\257\004K\004\257\004M\004\260\004\260\004\261\004M\004\261\004\257\004"
+ "\261\004L\004\262\004\260\004\262\004L\004\260\004N\004\263\004\262\004\263"
+ "\004N\004\262\004O\004\264\004\263\004\264\004O\004\263\004P\004\265\004"
+ "\264\004\265\004P\004\264\004Q\004\266\004\265\004\266\004Q\004\265\004R"
+ "\004\267\004\266\004\267\004R\004\266\004S\004\270\004\267\004\270\004S\004"
+ "\267\004T\004\271\004\270\004\271\004T\004\270\004U\004\272\004\271\004\272"
+ "\004U\004\271\004V\004\273\004\272\004\273\004V\004\272\004W\004\274\004"
+ "\273\004\274\004W\004\273\004X\004\275\004\274\004\275\004X\004\274\004Y"
+ "\004\276\004\275\004\276\004Y\004\275\004Z\004\277\004\276\004\277\004Z\004"
+ "\276\004[\004\300\004\277\004\300\004[\004\277\004\134\004\301\004\300\004"
+ "\301\004\134\004\300\004]\004\302\004\301\004\302\004]\004\301\004^\004\303"
+ "\004\302\004\303\004^\004\302\004_\004\304\004\303\004\304\004_\004\303\004"
+ "`\004\305\004\304\004\305\004`\004\304\004a\004\306\004\305\004\306\004a"
+ "\004\305\004b\004\307\004\306\004\307\004b\004\306\004c\004\310\004\307\004"
+ "\310\004c\004\307\004d\004\311\004\310\004\311\004d\004\310\004e\004\312"
+ "\004\311\004\312\004e\004\311\004f\004\313\004\312\004\313\004f\004\312\004"
+ "g\004\314\004\313\004\314\004g\004\313\004h\004\315\004\314\004\315\004h"
+ "\004\314\004i\004\316\004\315\004\316\004i\004\315\004j\004\317\004\316\004"
+ "\317\004j\004\316\004k\004\320\004\317\004\320\004k\004\317\004l\004\321"
+ "\004\320\004\321\004l\004\320\004m\004\322\004\321\004\322\004m\004\321\004"
+ "n\004\323\004\322\004\323\004n\004\322\004o\004\324\004\323\004\324\004o"
+ "\004\323\004p\004\325\004\324\004\325\004p\004\324\004q\004\326\004\325\004"
+ "\326\004q\004\325\004r\004\327\004\326\004\327\004r\004\326\004s\004\330"
+ "\004\327\004\330\004s\004\327\004t\004\331\004\330\004\331\004t\004\330\004"
+ "u\004\332\004\331\004\332\004u\004\331\004v\004\333\004\332\004\333\004v"
+ "\004\332\004w\004\334\004\333\004\334\004w\004\333\004x\004\335\004\334\004"
+ "\335\004x\004\334\004y\004\336\004\335\004\336\004y\004\335\004z\004\337"
+ "\004\336\004\337\004z\004\336\004{\004\340\004\337\004\340\004{\004\337\004"
+ "|\004\341\004\340\004\341\004|\004\340\004}\004\342\004\341\004\342\004}"
+ "\004\341\004~\004\343\004\342\004\343\004~\004\342\004\177\004\344\004\343"
+ "\004\344\004\177\004\343\004\200\004\345\004\344\004\345\004\200\004\344"
+ "\004\201\004\346\004\345\004\346\004\201\004\345\004\202\004\347\004\346"
+ "\004\347\004\202\004\346\004\203\004\350\004\347\004\350\004\203\004\347"
+ "\004\204\004\351\004\350\004\351\004\204\004\350\004\205\004\352\004\351"
+ "\004\352\004\205\004\351\004\206\004\353\004\352\004\353\004\206\004\352"
+ "\004\207\004\354\004\353\004\354\004\207\004\353\004\210\004\355\004\354"
+ "\004\355\004\210\004\354\004\211\004\356\004\355\004\356\004\211\004\355"
+ "\004\212\004\357\004\356\004\357\004\212\004\356\004\213\004\360\004\357"
+ "\004\360\004\213\004\357\004\214\004\361\004\360\004\361\004\214\004\360"
+ "\004\215\004\362\004\361\004\362\004\215\004\361\004\216\004\363\004\362"
+ "\004\363\004\216\004\362\004\217\004\364\004\363\004\364\004\217\004\363"
+ "\004\220\004\365\004\364\004\365\004\220\004\364\004\221\004\366\004\365"
+ "\004\366\004\221\004\365\004\222\004\367\004\366\004\367\004\222\004\366"
+ "\004\223\004\370\004\367\004\370\004\223\004\367\004\224\004\371\004\370"
+ "\004\371\004\224\004\370\004\225\004\372\004\371\004\372\004\225\004\371"
+ "\004\226\004\373\004\372\004\373\004\226\004\372\004\227\004\374\004\373"
+ "\004\374\004\227\004\373\004\230\004\375\004\374\004\375\004\230\004\374"
+ "\004\231\004\376\004\375\004\376\004\231\004\375\004\232\004\377\004\376"
+ "\004\377\004\232\004\376\004\233\004\000\005\377\004\000\005\233\004\377"
+ "\004\234\004\001\005\000\005\001\005\234\004\000\005\235\004\002\005\001"
+ "\005\002\005\235\004\001\005\236\004\003\005\002\005\003\005\236\004\002"
+ "\005\237\004\004\005\003\005\004\005\237\004\003\005\240\004\005\005\004"
+ "\005\005\005\240\004\004\005\241\004\006\005\005\005\006\005\241\004\005"
+ "\005\242\004\007\005\006\005\007\005\242\004\006\005\243\004\010\005\007"
+ "\005\010\005\243\004\007\005\244\004\011\005\010\005\011\005\244\004\010"
+ "\005\245\004\012\005\011\005\012\005\245\004\011\005\246\004\013\005\012"
+ "\005\013\005\246\004\012\005\247\004\014\005\013\005\014\005\247\004\013"
+ "\005\250\004\015\005\014\005\015\005\250\004\014\005\251\004\016\005\015"
+ "\005\016\005\251\004\015\005\252\004\017\005\016\005\017\005\252\004\016"
+ "\005\253\004\020\005\017\005\020\005\253\004\017\005\254\004\021\005\020"
+ "\005\021\005\254\004\020\005\255\004\022\005\021\005\022\005\255\004\021"
+ "\005\256\004\023\005\022\005\023\005\256\004\022\005\261\004\023\005\257"
+ "\004\023\005\261\004\024\005\024\005\025\005\261\004\025\005\023\005\025"
+ "\005\260\004\026\005\024\005\026\005\260\004\024\005\262\004\027\005\026"
+ "\005\027\005\262\004\026\005\263\004\030\005\027\005\030\005\263\004\027"
+ "\005\264\004\031\005\030\005\031\005\264\004\030\005\265\004\032\005\031"
+ "\005\032\005\265\004\031\005\266\004\033\005\032\005\033\005\266\004\032"
+ "\005\267\004\034\005\033\005\034\005\267\004\033\005\270\004\035\005\034"
+ "\005\035\005\270\004\034\005\271\004\036\005\035\005\036\005\271\004\035"
+ "\005\272\004\037\005\036\005\037\005\272\004\036\005\273\004 \005\037\005"
+ " \005\273\004\037\005\274\004!\005 \005!\005\274\004 \005\275\004\042\005"
+ "!\005\042\005\275\004!\005\276\004#\005\042\005#\005\276\004\042\005\277"
+ "\004$\005#\005$\005\277\004#\005\300\004%\005$\005%\005\300\004$\005\301"
+ "\004&\005%\005&\005\301\004%\005\302\004'\005&\005'\005\302\004&\005\303"
+ "\004(\005'\005(\005\303\004'\005\304\004)\005(\005)\005\304\004(\005\305"
+ "\004*\005)\005*\005\305\004)\005\306\004+\005*\005+\005\306\004*\005\307"
+ "\004,\005+\005,\005\307\004+\005\310\004-\005,\005-\005\310\004,\005\311"
+ "\004.\005-\005.\005\311\004-\005\312\004/\005.\005/\005\312\004.\005\313"
+ "\0040\005/\0050\005\313\004/\005\314\0041\0050\0051\005\314\0040\005\315"
+ "\0042\0051\0052\005\315\0041\005\316\0043\0052\0053\005\316\0042\005\317"
+ "\0044\0053\0054\005\317\0043\005\320\0045\0054\0055\005\320\0044\005\321"
+ "\0046\0055\0056\005\321\0045\005\322\0047\0056\0057\005\322\0046\005\323"
+ "\0048\0057\0058\005\323\0047\005\324\0049\0058\0059\005\324\0048\005\325"
+ "\004:\0059\005:\005\325\0049\005\326\004;\005:\005;\005\326\004:\005\327"
+ "\004<\005;\005<\005\327\004;\005\330\004=\005<\005=\005\330\004<\005\331"
+ "\004>\005=\005>\005\331\004=\005\332\004\077\005>\005\077\005\332\004>\005"
+ "\333\004@\005\077\005@\005\333\004\077\005\334\004A\005@\005A\005\334\004"
+ "@\005\335\004B\005A\005B\005\335\004A\005\336\004C\005B\005C\005\336\004"
+ "B\005\337\004D\005C\005D\005\337\004C\005\340\004E\005D\005E\005\340\004"
+ "D\005\341\004F\005E\005F\005\341\004E\005\342\004G\005F\005G\005\342\004"
+ "F\005\343\004H\005G\005H\005\343\004G\005\344\004I\005H\005I\005\344\004"
+ "H\005\345\004J\005I\005J\005\345\004I\005\346\004K\005J\005K\005\346\004"
+ "J\005\347\004L\005K\005L\005\347\004K\005\350\004M\005L\005M\005\350\004"
+ "L\005\351\004N\005M\005N\005\351\004M\005\352\004O\005N\005O\005\352\004"
+ "N\005\353\004P\005O\005P\005\353\004O\005\354\004Q\005P\005Q\005\354\004"
+ "P\005\355\004R\005Q\005R\005\355\004Q\005\356\004S\005R\005S\005\356\004"
+ "R\005\357\004T\005S\005T\005\357\004S\005\360\004U\005T\005U\005\360\004"
+ "T\005\361\004V\005U\005V\005\361\004U\005\362\004W\005V\005W\005\362\004"
+ "V\005\363\004X\005W\005X\005\363\004W\005\364\004Y\005X\005Y\005\364\004"
+ "X\005\365\004Z\005Y\005Z\005\365\004Y\005\366\004[\005Z\005[\005\366\004"
+ "Z\005\367\004\134\005[\005\134\005\367\004[\005\370\004]\005\134\005]\005"
+ "\370\004\134\005\371\004^\005]\005^\005\371\004]\005\372\004_\005^\005_\005"
+ "\372\004^\005\373\004`\005_\005`\005\373\004_\005\374\004a\005`\005a\005"
+ "\374\004`\005\375\004b\005a\005b\005\375\004a\005\376\004c\005b\005c\005"
+ "\376\004b\005\377\004d\005c\005d\005\377\004c\005\000\005e\005d\005e\005"
+ "\000\005d\005\001\005f\005e\005f\005\001\005e\005\002\005g\005f\005g\005"
+ "\002\005f\005\003\005h\005g\005h\005\003\005g\005\004\005i\005h\005i\005"
+ "\004\005h\005\005\005j\005i\005j\005\005\005i\005\006\005k\005j\005k\005"
+ "\006\005j\005\007\005l\005k\005l\005\007\005k\005\010\005m\005l\005m\005"
+ "\010\005l\005\011\005n\005m\005n\005\011\005m\005\012\005o\005n\005o\005"
+ "\012\005n\005\013\005p\005o\005p\005\013\005o\005\014\005q\005p\005q\005"
+ "\014\005p\005\015\005r\005q\005r\005\015\005q\005\016\005s\005r\005s\005"
+ "\016\005r\005\017\005t\005s\005t\005\017\005s\005\020\005u\005t\005u\005"
+ "\020\005t\005\021\005v\005u\005v\005\021\005u\005\022\005w\005v\005w\005"
+ "\022\005v\005\025\005w\005\023\005w\005\025\005x\005x\005y\005\025\005y\005"
+ "w\005y\005\024\005z\005x\005z\005\024\005x\005\026\005{\005z\005{\005\026"
+ "\005z\005\027\005|\005{\005|\005\027\005{\005\030\005}\005|\005}\005\030"
+ "\005|\005\031\005~\005}\005~\005\031\005}\005\032\005\177\005~\005\177\005"
+ "\032\005~\005\033\005\200\005\177\005\200\005\033\005\177\005\034\005\201"
+ "\005\200\005\201\005\034\005\200\005\035\005\202\005\201\005\202\005\035"
+ "\005\201\005\036\005\203\005\202\005\203\005\036\005\202\005\037\005\204"
+ "\005\203\005\204\005\037\005\203\005 \005\205\005\204\005\205\005 \005\204"
+ "\005!\005\206\005\205\005\206\005!\005\205\005\042\005\207\005\206\005\207"
+ "\005\042\005\206\005#\005\210\005\207\005\210\005#\005\207\005$\005\211\005"
+ "\210\005\211\005$\005\210\005%\005\212\005\211\005\212\005%\005\211\005&"
+ "\005\213\005\212\005\213\005&\005\212\005'\005\214\005\213\005\214\005'\005"
+ "\213\005(\005\215\005\214\005\215\005(\005\214\005)\005\216\005\215\005\216"
+ "\005)\005\215\005*\005\217\005\216\005\217\005*\005\216\005+\005\220\005"
+ "\217\005\220\005+\005\217\005,\005\221\005\220\005\221\005,\005\220\005-"
+ "\005\222\005\221\005\222\005-\005\221\005.\005\223\005\222\005\223\005.\005"
+ "\222\005/\005\224\005\223\005\224\005/\005\223\0050\005\225\005\224\005\225"
+ "\0050\005\224\0051\005\226\005\225\005\226\0051\005\225\0052\005\227\005"
+ "\226\005\227\0052\005\226\0053\005\230\005\227\005\230\0053\005\227\0054"
+ "\005\231\005\230\005\231\0054\005\230\0055\005\232\005\231\005\232\0055\005"
+ "\231\0056\005\233\005\232\005\233\0056\005\232\0057\005\234\005\233\005\234"
+ "\0057\005\233\0058\005\235\005\234\005\235\0058\005\234\0059\005\236\005"
+ "\235\005\236\0059\005\235\005:\005\237\005\236\005\237\005:\005\236\005;"
+ "\005\240\005\237\005\240\005;\005\237\005<\005\241\005\240\005\241\005<\005"
+ "\240\005=\005\242\005\241\005\242\005=\005\241\005>\005\243\005\242\005\243"
+ "\005>\005\242\005\077\005\244\005\243\005\244\005\077\005\243\005@\005\245"
+ "\005\244\005\245\005@\005\244\005A\005\246\005\245\005\246\005A\005\245\005"
+ "B\005\247\005\246\005\247\005B\005\246\005C\005\250\005\247\005\250\005C"
+ "\005\247\005D\005\251\005\250\005\251\005D\005\250\005E\005\252\005\251\005"
+ "\252\005E\005\251\005F\005\253\005\252\005\253\005F\005\252\005G\005\254"
+ "\005\253\005\254\005G\005\253\005H\005\255\005\254\005\255\005H\005\254\005"
+ "I\005\256\005\255\005\256\005I\005\255\005J\005\257\005\256\005\257\005J"
+ "\005\256\005K\005\260\005\257\005\260\005K\005\257\005L\005\261\005\260\005"
+ "\261\005L\005\260\005M\005\262\005\261\005\262\005M\005\261\005N\005\263"
+ "\005\262\005\263\005N\005\262\005O\005\264\005\263\005\264\005O\005\263\005"
+ "P\005\265\005\264\005\265\005P\005\264\005Q\005\266\005\265\005\266\005Q"
+ "\005\265\005R\005\267\005\266\005\267\005R\005\266\005S\005\270\005\267\005"
+ "\270\005S\005\267\005T\005\271\005\270\005\271\005T\005\270\005U\005\272"
+ "\005\271\005\272\005U\005\271\005V\005\273\005\272\005\273\005V\005\272\005"
+ "W\005\274\005\273\005\274\005W\005\273\005X\005\275\005\274\005\275\005X"
+ "\005\274\005Y\005\276\005\275\005\276\005Y\005\275\005Z\005\277\005\276\005"
+ "\277\005Z\005\276\005[\005\300\005\277\005\300\005[\005\277\005\134\005\301"
+ "\005\300\005\301\005\134\005\300\005]\005\302\005\301\005\302\005]\005\301"
+ "\005^\005\303\005\302\005\303\005^\005\302\005_\005\304\005\303\005\304\005"
+ "_\005\303\005`\005\305\005\304\005\305\005`\005\304\005a\005\306\005\305"
+ "\005\306\005a\005\305\005b\005\307\005\306\005\307\005b\005\306\005c\005"
+ "\310\005\307\005\310\005c\005\307\005d\005\311\005\310\005\311\005d\005\310"
+ "\005e\005\312\005\311\005\312\005e\005\311\005f\005\313\005\312\005\313\005"
+ "f\005\312\005g\005\314\005\313\005\314\005g\005\313\005h\005\315\005\314"
+ "\005\315\005h\005\314\005i\005\316\005\315\005\316\005i\005\315\005j\005"
+ "\317\005\316\005\317\005j\005\316\005k\005\320\005\317\005\320\005k\005\317"
+ "\005l\005\321\005\320\005\321\005l\005\320\005m\005\322\005\321\005\322\005"
+ "m\005\321\005n\005\323\005\322\005\323\005n\005\322\005o\005\324\005\323"
+ "\005\324\005o\005\323\005p\005\325\005\324\005\325\005p\005\324\005q\005"
+ "\326\005\325\005\326\005q\005\325\005r\005\327\005\326\005\327\005r\005\326"
+ "\005s\005\330\005\327\005\330\005s\005\327\005t\005\331\005\330\005\331\005"
+ "t\005\330\005u\005\332\005\331\005\332\005u\005\331\005v\005\333\005\332"
+ "\005\333\005v\005\332\005y\005\333\005w\005\333\005y\005\334\005\333\005"
+ "\334\005y\005\335\005\334\005\335\005x\005\335\005x\005\336\005\335\005\336"
+ "\005z\005\336\005{\005\336\005{\005\337\005\336\005\337\005|\005\337\005"
+ "|\005\340\005\337\005\340\005}\005\340\005}\005\341\005\340\005\341\005}"
+ "\005\342\005\341\005\342\005~\005\342\005~\005\343\005\342\005\343\005\177"
+ "\005\343\005\177\005\344\005\343\005\344\005\200\005\344\005\200\005\345"
+ "\005\344\005\345\005\201\005\345\005\201\005\346\005\345\005\346\005\201"
+ "\005\347\005\346\005\347\005\202\005\347\005\202\005\350\005\347\005\350"
+ "\005\203\005\350\005\203\005\351\005\350\005\351\005\203\005\352\005\351"
+ "\005\352\005\204\005\352\005\204\005\353\005\352\005\353\005\204\005\354"
+ "\005\353\005\354\005\205\005\354\005\205\005\355\005\354\005\355\005\206"
+ "\005\355\005\206\005\356\005\355\005\356\005\206\005\357\005\356\005\357"
+ "\005\207\005\357\005\207\005\360\005\357\005\360\005\210\005\360\005\210"
+ "\005\361\005\360\005\361\005\210\005\362\005\361\005\362\005\211\005\362"
+ "\005\211\005\363\005\362\005\363\005\212\005\363\005\212\005\364\005\363"
+ "\005\364\005\213\005\364\005\213\005\365\005\364\005\365\005\214\005\365"
+ "\005\214\005\366\005\365\005\366\005\215\005\366\005\215\005\367\005\366"
+ "\005\367\005\215\005\242\005\242\005\367\005\216\005\242\005\216\005\241"
+ "\005\217\005\241\005\217\005\240\005\220\005\240\005\220\005\237\005\221"
+ "\005\237\005\221\005\236\005\222\005\236\005\222\005\235\005\223\005\235"
+ "\005\223\005\234\005\224\005\234\005\224\005\233\005\225\005\233\005\225"
+ "\005\232\005\226\005\232\005\226\005\231\005\227\005\231\005\243\005\367"
+ "\005\243\005\370\005\367\005\370\005\244\005\370\005\244\005\371\005\370"
+ "\005\371\005\245\005\371\005\245\005\372\005\371\005\372\005\246\005\372"
+ "\005\246\005\373\005\372\005\373\005\247\005\373\005\247\005\374\005\373"
+ "\005\374\005\250\005\374\005\250\005\375\005\374\005\375\005\250\005\376"
+ "\005\375\005\376\005\251\005\376\005\251\005\377\005\376\005\377\005\252"
+ "\005\377\005\252\005\000\006\377\005\000\006\252\005\001\006\000\006\001"
+ "\006\253\005\001\006\253\005\002\006\001\006\002\006\254\005\002\006\254"
+ "\005\003\006\002\006\003\006\254\005\004\006\003\006\004\006\255\005\004"
+ "\006\255\005\005\006\004\006\005\006\255\005\006\006\005\006\006\006\256"
+ "\005\006\006\256\005\007\006\006\006\007\006\257\005\007\006\257\005\010"
+ "\006\007\006\010\006\257\005\011\006\010\006\011\006\260\005\011\006\260"
+ "\005\012\006\011\006\012\006\261\005\012\006\261\005\013\006\012\006\013"
+ "\006\262\005\013\006\262\005\014\006\013\006\014\006\263\005\014\006\263"
+ "\005\015\006\014\006\015\006\263\005\016\006\015\006\016\006\264\005\016"
+ "\006\264\005\017\006\016\006\017\006\265\005\017\006\265\005\020\006\017"
+ "\006\020\006\266\005\020\006\267\005\020\006\267\005\021\006\020\006\021"
+ "\006\270\005\021\006\270\005\022\006\021\006\022\006\271\005\022\006\272"
+ "\005\022\006\272\005\023\006\022\006\023\006\273\005\023\006\273\005\024"
+ "\006\023\006\024\006\274\005\024\006\274\005\025\006\024\006\025\006\275"
+ "\005\025\006\275\005\026\006\025\006\026\006\276\005\026\006\276\005\326"
+ "\005\326\005\026\006\276\005\325\005\277\005\325\005\277\005\324\005\300"
+ "\005\324\005\300\005\323\005\301\005\323\005\301\005\322\005\302\005\322"
+ "\005\303\005\322\005\303\005\321\005\303\005\320\005\304\005\320\005\304"
+ "\005\317\005\305\005\317\005\305\005\316\005\306\005\316\005\307\005\316"
+ "\005\307\005\315\005\307\005\314\005\310\005\314\005\310\005\313\005\311"
+ "\005\313\005\326\005\027\006\026\006\027\006\327\005\027\006\327\005\030"
+ "\006\027\006\030\006\330\005\030\006\330\005\031\006\030\006\031\006\331"
+ "\005\031\006\331\005\032\006\031\006\032\006\332\005\032\006\332\005\334"
+ "\005\334\005\032\006\027\006\033\006\026\006\033\006\033\006\034\006\027"
+ "\006\034\006\034\006\035\006\033\006\035\006\035\006\036\006\034\006\036"
+ "\006\036\006\037\006\035\006\037\006\037\006 \006\036\006 \006 \006!\006"
+ "\037\006!\006!\006\042\006 \006\042\006\042\006#\006!\006#\006\003\000$\006"
+ "\306\000$\006\306\000%\006$\006%\006\000\000&\006\003\000&\006$\006&\006"
+ "\004\000'\006\000\000'\006&\006'\006\006\000(\006\004\000(\006'\006(\006"
+ "'\006)\006(\006)\006)\006*\006(\006*\006\010\000+\006\006\000+\006(\006+"
+ "\006\012\000,\006\010\000,\006+\006,\006\014\000-\006\012\000-\006,\006-"
+ "\006\016\000.\006\014\000.\006-\006.\006-\006/\006.\006/\006/\0060\006.\006"
+ "0\006\020\0001\006\016\0001\006.\0061\006\022\0002\006\020\0002\0061\006"
+ "2\006\024\0003\006\022\0003\0062\0063\006\026\0004\006\024\0004\0063\006"
+ "4\0063\0065\0064\0065\0065\0066\0064\0066\006\030\0007\006\026\0007\0064"
+ "\0067\006\032\0008\006\030\0008\0067\0068\006\034\0009\006\032\0009\0068"
+ "\0069\006\036\000:\006\034\000:\0069\006:\0069\006;\006:\006;\006;\006<\006"
+ ":\006<\006 \000=\006\036\000=\006:\006=\006\042\000>\006 \000>\006=\006>"
+ "\006$\000\077\006\042\000\077\006>\006\077\006\304\000%\006\304\000@\006"
+ "%\006@\006@\006A\006%\006A\006A\006B\006%\006B\006\302\000@\006\302\000C"
+ "\006@\006C\006\300\000C\006\300\000D\006C\006D\006\276\000D\006\276\000E"
+ "\006D\006E\006\272\000F\006\270\000F\006\270\000G\006F\006G\006\266\000G"
+ "\006\266\000H\006G\006H\006\264\000H\006\264\000I\006H\006I\006\262\000I"
+ "\006\262\000J\006I\006J\006J\006K\006I\006K\006K\006L\006I\006L\006\260\000"
+ "J\006\260\000M\006J\006M\006\256\000M\006\256\000N\006M\006N\006\254\000"
+ "N\006\254\000O\006N\006O\006\252\000O\006\252\000P\006O\006P\006P\006Q\006"
+ "O\006Q\006Q\006R\006O\006R\006\250\000P\006\250\000S\006P\006S\006\246\000"
+ "S\006\246\000T\006S\006T\006\244\000T\006\244\000U\006T\006U\006\242\000"
+ "U\006\242\000V\006U\006V\006V\006W\006U\006W\006W\006X\006U\006X\006\240"
+ "\000V\006\240\000Y\006V\006Y\006\236\000Y\006\236\000Z\006Y\006Z\006\234"
+ "\000Z\006\234\000[\006Z\006[\006\232\000[\006\232\000\134\006[\006\134\006"
+ "\134\006]\006[\006]\006]\006^\006[\006^\006\230\000\134\006\230\000_\006"
+ "\134\006_\006\226\000_\006\226\000`\006_\006`\006\224\000`\006\224\000a\006"
+ "`\006a\006\222\000a\006\222\000b\006a\006b\006b\006c\006a\006c\006c\006d"
+ "\006a\006d\006\220\000b\006\220\000e\006b\006e\006\216\000e\006\216\000f"
+ "\006e\006f\006\214\000f\006\214\000g\006f\006g\006\210\000h\006\206\000h"
+ "\006\206\000i\006h\006i\006\204\000i\006\204\000j\006i\006j\006\202\000j"
+ "\006\202\000k\006j\006k\006\200\000k\006\200\000l\006k\006l\006l\006m\006"
+ "k\006m\006m\006n\006k\006n\006~\000l\006~\000o\006l\006o\006|\000o\006|\000"
+ "p\006o\006p\006z\000p\006z\000q\006p\006q\006x\000q\006x\000r\006q\006r\006"
+ "r\006s\006q\006s\006s\006t\006q\006t\006v\000r\006v\000u\006r\006u\006t\000"
+ "u\006t\000v\006u\006v\006r\000v\006r\000w\006v\006w\006p\000w\006p\000x\006"
+ "w\006x\006x\006y\006w\006y\006y\006z\006w\006z\006n\000x\006n\000{\006x\006"
+ "{\006l\000{\006l\000|\006{\006|\006j\000|\006j\000}\006|\006}\006h\000}\006"
+ "h\000~\006}\006~\006~\006\177\006}\006\177\006\177\006\200\006}\006\200\006"
+ "f\000~\006f\000\201\006~\006\201\006d\000\201\006d\000\202\006\201\006\202"
+ "\006b\000\202\006b\000\203\006\202\006\203\006`\000\203\006`\000\204\006"
+ "\203\006\204\006\204\006\205\006\203\006\205\006\205\006\206\006\203\006"
+ "\206\006^\000\204\006^\000\207\006\204\006\207\006\134\000\207\006\134\000"
+ "\210\006\207\006\210\006Z\000\210\006Z\000\211\006\210\006\211\006V\000\212"
+ "\006T\000\212\006T\000\213\006\212\006\213\006R\000\213\006R\000\214\006"
+ "\213\006\214\006P\000\214\006P\000\215\006\214\006\215\006N\000\215\006N"
+ "\000\216\006\215\006\216\006\216\006\217\006\215\006\217\006\217\006\220"
+ "\006\215\006\220\006L\000\216\006L\000\221\006\216\006\221\006J\000\221\006"
+ "J\000\222\006\221\006\222\006H\000\222\006H\000\223\006\222\006\223\006F"
+ "\000\223\006F\000\224\006\223\006\224\006\224\006\225\006\223\006\225\006"
+ "\225\006\226\006\223\006\226\006D\000\224\006D\000\227\006\224\006\227\006"
+ "B\000\227\006B\000\230\006\227\006\230\006@\000\230\006@\000\231\006\230"
+ "\006\231\006>\000\231\006>\000\232\006\231\006\232\006\232\006\233\006\231"
+ "\006\233\006\233\006\234\006\231\006\234\006<\000\232\006<\000\235\006\232"
+ "\006\235\006:\000\235\006:\000\236\006\235\006\236\0068\000\236\0068\000"
+ "\237\006\236\006\237\0066\000\237\0066\000\240\006\237\006\240\006\240\006"
+ "\241\006\237\006\241\006\241\006\242\006\237\006\242\0064\000\240\0064\000"
+ "\243\006\240\006\243\0062\000\243\0062\000\244\006\243\006\244\0060\000\244"
+ "\0060\000\245\006\244\006\245\006.\000\245\006.\000\246\006\245\006\246\006"
+ "\246\006\247\006\245\006\247\006\247\006\250\006\245\006\250\006,\000\246"
+ "\006,\000\251\006\246\006\251\006*\000\251\006*\000\252\006\251\006\252\006"
+ "(\000\252\006(\000\253\006\252\006\253\006"
+;
+const unsigned long companion_disc_size = 55952;
@@ -1,653 +1,248 @@
+/* Generated from "companion_heart.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	-0.126112,-0.516835,0.846745,0.062716,0.065295,-0.005781,
-	-0.233173,-0.466563,0.853199,0.063951,0.064804,-0.005781,
-	-0.169323,-0.502195,0.848015,0.063583,0.066646,-0.004818,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055116,0.063504,-0.005781,
-	0,0,1,0.054127,0.064391,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.054127,0.064391,-0.005781,
-	0,0,1,0.052967,0.065039,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.052967,0.065039,-0.005781,
-	0,0,1,0.051693,0.065415,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.051693,0.065415,-0.005781,
-	0,0,1,0.050367,0.065502,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.050367,0.065502,-0.005781,
-	0,0,1,0.049054,0.065295,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.049054,0.065295,-0.005781,
-	0,0,1,0.04782,0.064804,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.04782,0.064804,-0.005781,
-	0,0,1,0.046724,0.064053,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.046724,0.064053,-0.005781,
-	0,0,1,0.04582,0.063079,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.04582,0.063079,-0.005781,
-	0,0,1,0.045152,0.06193,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.045152,0.06193,-0.005781,
-	0,0,1,0.044754,0.060662,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.044754,0.060662,-0.005781,
-	0,0,1,0.044645,0.059338,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.044645,0.059338,-0.005781,
-	0,0,1,0.044702,0.058527,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.044702,0.058527,-0.005781,
-	0,0,1,0.044827,0.057723,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.044827,0.057723,-0.005781,
-	0,0,1,0.045017,0.056932,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.045017,0.056932,-0.005781,
-	0,0,1,0.045272,0.05616,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.045272,0.05616,-0.005781,
-	0,0,1,0.04559,0.055411,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.04559,0.055411,-0.005781,
-	0,0,1,0.04597,0.054691,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.04597,0.054691,-0.005781,
-	0,0,1,0.046407,0.054006,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.046407,0.054006,-0.005781,
-	0,0,1,0.0469,0.053359,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.0469,0.053359,-0.005781,
-	0,0,1,0.047445,0.052755,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.047445,0.052755,-0.005781,
-	0,0,1,0.048038,0.052198,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.048038,0.052198,-0.005781,
-	0,0,1,0.048675,0.051693,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.048675,0.051693,-0.005781,
-	0,0,1,0.049352,0.051241,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.049352,0.051241,-0.005781,
-	0,0,1,0.050001,0.050829,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.050001,0.050829,-0.005781,
-	0,0,1,0.050634,0.050393,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.050634,0.050393,-0.005781,
-	0,0,1,0.05125,0.049933,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.05125,0.049933,-0.005781,
-	0,0,1,0.051848,0.049449,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.051848,0.049449,-0.005781,
-	0,0,1,0.052427,0.048943,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.052427,0.048943,-0.005781,
-	0,0,1,0.052987,0.048416,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.052987,0.048416,-0.005781,
-	0,0,1,0.053525,0.047867,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.053525,0.047867,-0.005781,
-	0,0,1,0.054043,0.047299,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.054043,0.047299,-0.005781,
-	0,0,1,0.054538,0.046711,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.054538,0.046711,-0.005781,
-	0,0,1,0.055011,0.046104,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055011,0.046104,-0.005781,
-	0,0,1,0.05546,0.04548,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.05546,0.04548,-0.005781,
-	0,0,1,0.055885,0.044839,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055885,0.044839,-0.005781,
-	0,0,1,0.05631,0.04548,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.05631,0.04548,-0.005781,
-	0,0,1,0.05676,0.046104,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.05676,0.046104,-0.005781,
-	0,0,1,0.057232,0.046711,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.057232,0.046711,-0.005781,
-	0,0,1,0.057728,0.047299,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.057728,0.047299,-0.005781,
-	0,0,1,0.058245,0.047867,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.058245,0.047867,-0.005781,
-	0,0,1,0.058784,0.048416,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.058784,0.048416,-0.005781,
-	0,0,1,0.059343,0.048943,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.059343,0.048943,-0.005781,
-	0,0,1,0.059922,0.049449,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.059922,0.049449,-0.005781,
-	0,0,1,0.06052,0.049933,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.06052,0.049933,-0.005781,
-	0,0,1,0.061136,0.050393,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.061136,0.050393,-0.005781,
-	0,0,1,0.061769,0.050829,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.061769,0.050829,-0.005781,
-	0,0,1,0.062418,0.051241,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.062418,0.051241,-0.005781,
-	0,0,1,0.063095,0.051693,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.063095,0.051693,-0.005781,
-	0,0,1,0.063732,0.052198,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.063732,0.052198,-0.005781,
-	0,0,1,0.064326,0.052755,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.064326,0.052755,-0.005781,
-	0,0,1,0.06487,0.053359,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.06487,0.053359,-0.005781,
-	0,0,1,0.065363,0.054006,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.065363,0.054006,-0.005781,
-	0,0,1,0.065801,0.054691,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.065801,0.054691,-0.005781,
-	0,0,1,0.06618,0.055411,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.06618,0.055411,-0.005781,
-	0,0,1,0.066498,0.05616,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.066498,0.05616,-0.005781,
-	0,0,1,0.066754,0.056932,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.066754,0.056932,-0.005781,
-	0,0,1,0.066944,0.057723,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.066944,0.057723,-0.005781,
-	0,0,1,0.067068,0.058527,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.067068,0.058527,-0.005781,
-	0,0,1,0.067125,0.059338,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.067125,0.059338,-0.005781,
-	0,0,1,0.067016,0.060662,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.067016,0.060662,-0.005781,
-	0,0,1,0.066618,0.06193,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.066618,0.06193,-0.005781,
-	0,0,1,0.065951,0.063079,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.065951,0.063079,-0.005781,
-	0,0,1,0.065047,0.064053,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.065047,0.064053,-0.005781,
-	0,0,1,0.063951,0.064804,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.063951,0.064804,-0.005781,
-	0,0,1,0.062716,0.065295,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.062716,0.065295,-0.005781,
-	0,0,1,0.061404,0.065502,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.061404,0.065502,-0.005781,
-	0,0,1,0.060078,0.065415,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.060078,0.065415,-0.005781,
-	0,0,1,0.058804,0.065039,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.058804,0.065039,-0.005781,
-	0,0,1,0.057644,0.064391,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.057644,0.064391,-0.005781,
-	0,0,1,0.056655,0.063504,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.056655,0.063504,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055885,0.06242,-0.005781,
-	0,0,1,0.055116,0.063504,-0.005781,
-	0.600355,0.41774,0.681958,0.05546,0.04548,-0.005781,
-	0.611328,0.411243,0.676134,0.055414,0.04397,-0.004818,
-	0.619748,0.407106,0.670953,0.055885,0.044839,-0.005781,
-	0.611328,0.411243,0.676134,0.055414,0.04397,-0.004818,
-	0.600355,0.41774,0.681958,0.05546,0.04548,-0.005781,
-	0.583861,0.425853,0.691199,0.054915,0.044676,-0.004818,
-	0.573435,0.432324,0.695894,0.055011,0.046104,-0.005781,
-	0.583861,0.425853,0.691199,0.054915,0.044676,-0.004818,
-	0.600355,0.41774,0.681958,0.05546,0.04548,-0.005781,
-	0.583861,0.425853,0.691199,0.054915,0.044676,-0.004818,
-	0.573435,0.432324,0.695894,0.055011,0.046104,-0.005781,
-	0.557839,0.440321,0.703515,0.05439,0.045363,-0.004818,
-	0.547914,0.446817,0.707209,0.054538,0.046711,-0.005781,
-	0.557839,0.440321,0.703515,0.05439,0.045363,-0.004818,
-	0.573435,0.432324,0.695894,0.055011,0.046104,-0.005781,
-	0.557839,0.440321,0.703515,0.05439,0.045363,-0.004818,
-	0.547914,0.446817,0.707209,0.054538,0.046711,-0.005781,
-	0.528358,0.458036,0.714871,0.05384,0.046029,-0.004818,
-	0.525024,0.459644,0.716294,0.054043,0.047299,-0.005781,
-	0.528358,0.458036,0.714871,0.05384,0.046029,-0.004818,
-	0.547914,0.446817,0.707209,0.054538,0.046711,-0.005781,
-	0.525024,0.459644,0.716294,0.054043,0.047299,-0.005781,
-	0.507344,0.470385,0.722039,0.053525,0.047867,-0.005781,
-	0.528358,0.458036,0.714871,0.05384,0.046029,-0.004818,
-	0.502587,0.474851,0.722443,0.053266,0.046673,-0.004818,
-	0.528358,0.458036,0.714871,0.05384,0.046029,-0.004818,
-	0.507344,0.470385,0.722039,0.053525,0.047867,-0.005781,
-	0.507344,0.470385,0.722039,0.053525,0.047867,-0.005781,
-	0.484849,0.48521,0.727662,0.052987,0.048416,-0.005781,
-	0.502587,0.474851,0.722443,0.053266,0.046673,-0.004818,
-	0.480277,0.489774,0.727637,0.052668,0.047293,-0.004818,
-	0.502587,0.474851,0.722443,0.053266,0.046673,-0.004818,
-	0.484849,0.48521,0.727662,0.052987,0.048416,-0.005781,
-	0.484849,0.48521,0.727662,0.052987,0.048416,-0.005781,
-	0.463202,0.500363,0.731492,0.052427,0.048943,-0.005781,
-	0.480277,0.489774,0.727637,0.052668,0.047293,-0.004818,
-	0.458764,0.50505,0.731068,0.052047,0.047891,-0.004818,
-	0.480277,0.489774,0.727637,0.052668,0.047293,-0.004818,
-	0.463202,0.500363,0.731492,0.052427,0.048943,-0.005781,
-	0.463202,0.500363,0.731492,0.052427,0.048943,-0.005781,
-	0.442255,0.515933,0.733637,0.051848,0.049449,-0.005781,
-	0.458764,0.50505,0.731068,0.052047,0.047891,-0.004818,
-	0.437903,0.520767,0.732832,0.051404,0.048464,-0.004818,
-	0.458764,0.50505,0.731068,0.052047,0.047891,-0.004818,
-	0.442255,0.515933,0.733637,0.051848,0.049449,-0.005781,
-	0.442255,0.515933,0.733637,0.051848,0.049449,-0.005781,
-	0.419718,0.534563,0.733539,0.05125,0.049933,-0.005781,
-	0.437903,0.520767,0.732832,0.051404,0.048464,-0.004818,
-	0.42249,0.532759,0.73326,0.050741,0.049011,-0.004818,
-	0.437903,0.520767,0.732832,0.051404,0.048464,-0.004818,
-	0.419718,0.534563,0.733539,0.05125,0.049933,-0.005781,
-	0.42249,0.532759,0.73326,0.050741,0.049011,-0.004818,
-	0.419718,0.534563,0.733539,0.05125,0.049933,-0.005781,
-	0.403677,0.547538,0.732971,0.050057,0.049532,-0.004818,
-	0.395847,0.555175,0.731496,0.050634,0.050393,-0.005781,
-	0.403677,0.547538,0.732971,0.050057,0.049532,-0.004818,
-	0.419718,0.534563,0.733539,0.05125,0.049933,-0.005781,
-	0.403677,0.547538,0.732971,0.050057,0.049532,-0.004818,
-	0.395847,0.555175,0.731496,0.050634,0.050393,-0.005781,
-	0.38391,0.564835,0.730462,0.049354,0.050026,-0.004818,
-	0.376177,0.572732,0.728333,0.050001,0.050829,-0.005781,
-	0.38391,0.564835,0.730462,0.049354,0.050026,-0.004818,
-	0.395847,0.555175,0.731496,0.050634,0.050393,-0.005781,
-	0.38391,0.564835,0.730462,0.049354,0.050026,-0.004818,
-	0.376177,0.572732,0.728333,0.050001,0.050829,-0.005781,
-	0.375296,0.574093,0.727715,0.048634,0.050493,-0.004818,
-	0.378691,0.573667,0.726291,0.049352,0.051241,-0.005781,
-	0.375296,0.574093,0.727715,0.048634,0.050493,-0.004818,
-	0.376177,0.572732,0.728333,0.050001,0.050829,-0.005781,
-	0.375296,0.574093,0.727715,0.048634,0.050493,-0.004818,
-	0.378691,0.573667,0.726291,0.049352,0.051241,-0.005781,
-	0.405711,0.551851,0.728601,0.047882,0.051003,-0.004818,
-	0.403275,0.554082,0.72826,0.048675,0.051693,-0.005781,
-	0.405711,0.551851,0.728601,0.047882,0.051003,-0.004818,
-	0.378691,0.573667,0.726291,0.049352,0.051241,-0.005781,
-	0.403275,0.554082,0.72826,0.048675,0.051693,-0.005781,
-	0.439698,0.520339,0.732061,0.048038,0.052198,-0.005781,
-	0.405711,0.551851,0.728601,0.047882,0.051003,-0.004818,
-	0.455156,0.505988,0.732672,0.047175,0.051576,-0.004818,
-	0.405711,0.551851,0.728601,0.047882,0.051003,-0.004818,
-	0.439698,0.520339,0.732061,0.048038,0.052198,-0.005781,
-	0.439698,0.520339,0.732061,0.048038,0.052198,-0.005781,
-	0.478388,0.479119,0.735928,0.047445,0.052755,-0.005781,
-	0.455156,0.505988,0.732672,0.047175,0.051576,-0.004818,
-	0.492434,0.463571,0.736621,0.046517,0.052206,-0.004818,
-	0.455156,0.505988,0.732672,0.047175,0.051576,-0.004818,
-	0.478388,0.479119,0.735928,0.047445,0.052755,-0.005781,
-	0.478388,0.479119,0.735928,0.047445,0.052755,-0.005781,
-	0.513034,0.434953,0.740008,0.0469,0.053359,-0.005781,
-	0.492434,0.463571,0.736621,0.046517,0.052206,-0.004818,
-	0.525496,0.418365,0.740827,0.045912,0.05289,-0.004818,
-	0.492434,0.463571,0.736621,0.046517,0.052206,-0.004818,
-	0.513034,0.434953,0.740008,0.0469,0.053359,-0.005781,
-	0.513034,0.434953,0.740008,0.0469,0.053359,-0.005781,
-	0.543337,0.388194,0.744372,0.046407,0.054006,-0.005781,
-	0.525496,0.418365,0.740827,0.045912,0.05289,-0.004818,
-	0.554068,0.370754,0.745352,0.045365,0.053623,-0.004818,
-	0.525496,0.418365,0.740827,0.045912,0.05289,-0.004818,
-	0.543337,0.388194,0.744372,0.046407,0.054006,-0.005781,
-	0.543337,0.388194,0.744372,0.046407,0.054006,-0.005781,
-	0.569031,0.339242,0.749078,0.04597,0.054691,-0.005781,
-	0.554068,0.370754,0.745352,0.045365,0.053623,-0.004818,
-	0.577912,0.321162,0.750248,0.044879,0.054399,-0.004818,
-	0.554068,0.370754,0.745352,0.045365,0.053623,-0.004818,
-	0.569031,0.339242,0.749078,0.04597,0.054691,-0.005781,
-	0.569031,0.339242,0.749078,0.04597,0.054691,-0.005781,
-	0.589896,0.288542,0.754166,0.04559,0.055411,-0.005781,
-	0.577912,0.321162,0.750248,0.044879,0.054399,-0.004818,
-	0.596848,0.270049,0.755544,0.044458,0.055214,-0.004818,
-	0.577912,0.321162,0.750248,0.044879,0.054399,-0.004818,
-	0.589896,0.288542,0.754166,0.04559,0.055411,-0.005781,
-	0.589896,0.288542,0.754166,0.04559,0.055411,-0.005781,
-	0.60577,0.236571,0.759656,0.045272,0.05616,-0.005781,
-	0.596848,0.270049,0.755544,0.044458,0.055214,-0.004818,
-	0.610753,0.217903,0.761249,0.044105,0.056061,-0.004818,
-	0.596848,0.270049,0.755544,0.044458,0.055214,-0.004818,
-	0.60577,0.236571,0.759656,0.045272,0.05616,-0.005781,
-	0.60577,0.236571,0.759656,0.045272,0.05616,-0.005781,
-	0.616557,0.183837,0.765546,0.045017,0.056932,-0.005781,
-	0.610753,0.217903,0.761249,0.044105,0.056061,-0.004818,
-	0.619574,0.165232,0.767351,0.043821,0.056936,-0.004818,
-	0.610753,0.217903,0.761249,0.044105,0.056061,-0.004818,
-	0.616557,0.183837,0.765546,0.045017,0.056932,-0.005781,
-	0.616557,0.183837,0.765546,0.045017,0.056932,-0.005781,
-	0.622238,0.13086,0.771813,0.044827,0.057723,-0.005781,
-	0.619574,0.165232,0.767351,0.043821,0.056936,-0.004818,
-	0.623333,0.112547,0.773815,0.04361,0.057831,-0.004818,
-	0.619574,0.165232,0.767351,0.043821,0.056936,-0.004818,
-	0.622238,0.13086,0.771813,0.044827,0.057723,-0.005781,
-	0.622238,0.13086,0.771813,0.044827,0.057723,-0.005781,
-	0.622921,0.078006,0.778386,0.044702,0.058527,-0.005781,
-	0.623333,0.112547,0.773815,0.04361,0.057831,-0.004818,
-	0.622674,0.06887,0.779444,0.043472,0.058741,-0.004818,
-	0.623333,0.112547,0.773815,0.04361,0.057831,-0.004818,
-	0.622921,0.078006,0.778386,0.044702,0.058527,-0.005781,
-	0.615482,0.005518,0.788132,0.043409,0.05966,-0.004818,
-	0.622674,0.06887,0.779444,0.043472,0.058741,-0.004818,
-	0.622921,0.078006,0.778386,0.044702,0.058527,-0.005781,
-	0.615482,0.005518,0.788132,0.043409,0.05966,-0.004818,
-	0.622921,0.078006,0.778386,0.044702,0.058527,-0.005781,
-	0.608032,-0.012608,0.793813,0.044645,0.059338,-0.005781,
-	0.615482,0.005518,0.788132,0.043409,0.05966,-0.004818,
-	0.608032,-0.012608,0.793813,0.044645,0.059338,-0.005781,
-	0.587334,-0.078712,0.805508,0.043489,0.061186,-0.004818,
-	0.563271,-0.124273,0.816873,0.044754,0.060662,-0.005781,
-	0.587334,-0.078712,0.805508,0.043489,0.061186,-0.004818,
-	0.608032,-0.012608,0.793813,0.044645,0.059338,-0.005781,
-	0.587334,-0.078712,0.805508,0.043489,0.061186,-0.004818,
-	0.563271,-0.124273,0.816873,0.044754,0.060662,-0.005781,
-	0.528554,-0.194938,0.826214,0.043898,0.062655,-0.004818,
-	0.498136,-0.2337,0.835012,0.045152,0.06193,-0.005781,
-	0.528554,-0.194938,0.826214,0.043898,0.062655,-0.004818,
-	0.563271,-0.124273,0.816873,0.044754,0.060662,-0.005781,
-	0.528554,-0.194938,0.826214,0.043898,0.062655,-0.004818,
-	0.498136,-0.2337,0.835012,0.045152,0.06193,-0.005781,
-	0.454671,-0.294294,0.840634,0.044613,0.063997,-0.004818,
-	0.419714,-0.3263,0.846976,0.04582,0.063079,-0.005781,
-	0.454671,-0.294294,0.840634,0.044613,0.063997,-0.004818,
-	0.498136,-0.2337,0.835012,0.045152,0.06193,-0.005781,
-	0.454671,-0.294294,0.840634,0.044613,0.063997,-0.004818,
-	0.419714,-0.3263,0.846976,0.04582,0.063079,-0.005781,
-	0.369159,-0.377727,0.849143,0.0456,0.065145,-0.004818,
-	0.33096,-0.403408,0.853069,0.046724,0.064053,-0.005781,
-	0.369159,-0.377727,0.849143,0.0456,0.065145,-0.004818,
-	0.419714,-0.3263,0.846976,0.04582,0.063079,-0.005781,
-	0.369159,-0.377727,0.849143,0.0456,0.065145,-0.004818,
-	0.33096,-0.403408,0.853069,0.046724,0.064053,-0.005781,
-	0.273921,-0.44663,0.851756,0.046812,0.066043,-0.004818,
-	0.233173,-0.466563,0.853199,0.04782,0.064804,-0.005781,
-	0.273921,-0.44663,0.851756,0.046812,0.066043,-0.004818,
-	0.33096,-0.403408,0.853069,0.046724,0.064053,-0.005781,
-	0.273921,-0.44663,0.851756,0.046812,0.066043,-0.004818,
-	0.233173,-0.466563,0.853199,0.04782,0.064804,-0.005781,
-	0.169323,-0.502195,0.848015,0.048188,0.066646,-0.004818,
-	0.126112,-0.516835,0.846745,0.049054,0.065295,-0.005781,
-	0.169323,-0.502195,0.848015,0.048188,0.066646,-0.004818,
-	0.233173,-0.466563,0.853199,0.04782,0.064804,-0.005781,
-	0.169323,-0.502195,0.848015,0.048188,0.066646,-0.004818,
-	0.126112,-0.516835,0.846745,0.049054,0.065295,-0.005781,
-	0.054393,-0.544766,0.836822,0.04966,0.066926,-0.004818,
-	0.00829,-0.554159,0.832369,0.050367,0.065502,-0.005781,
-	0.054393,-0.544766,0.836822,0.04966,0.066926,-0.004818,
-	0.126112,-0.516835,0.846745,0.049054,0.065295,-0.005781,
-	0.054393,-0.544766,0.836822,0.04966,0.066926,-0.004818,
-	0.00829,-0.554159,0.832369,0.050367,0.065502,-0.005781,
-	-0.072758,-0.573144,0.816219,0.051157,0.066867,-0.004818,
-	-0.12248,-0.576612,0.807785,0.051693,0.065415,-0.005781,
-	-0.072758,-0.573144,0.816219,0.051157,0.066867,-0.004818,
-	0.00829,-0.554159,0.832369,0.050367,0.065502,-0.005781,
-	-0.072758,-0.573144,0.816219,0.051157,0.066867,-0.004818,
-	-0.12248,-0.576612,0.807785,0.051693,0.065415,-0.005781,
-	-0.241161,-0.582165,0.776482,0.052605,0.066474,-0.004818,
-	-0.248853,-0.582215,0.774014,0.052967,0.065039,-0.005781,
-	-0.241161,-0.582165,0.776482,0.052605,0.066474,-0.004818,
-	-0.12248,-0.576612,0.807785,0.051693,0.065415,-0.005781,
-	-0.248853,-0.582215,0.774014,0.052967,0.065039,-0.005781,
-	-0.375277,-0.56983,0.731068,0.054127,0.064391,-0.005781,
-	-0.241161,-0.582165,0.776482,0.052605,0.066474,-0.004818,
-	-0.434459,-0.558606,0.706544,0.053934,0.065766,-0.004818,
-	-0.241161,-0.582165,0.776482,0.052605,0.066474,-0.004818,
-	-0.375277,-0.56983,0.731068,0.054127,0.064391,-0.005781,
-	-0.375277,-0.56983,0.731068,0.054127,0.064391,-0.005781,
-	-0.563066,-0.515371,0.646025,0.055116,0.063504,-0.005781,
-	-0.434459,-0.558606,0.706544,0.053934,0.065766,-0.004818,
-	-0.558162,-0.527957,0.640091,0.055031,0.064761,-0.004818,
-	-0.434459,-0.558606,0.706544,0.053934,0.065766,-0.004818,
-	-0.563066,-0.515371,0.646025,0.055116,0.063504,-0.005781,
-	-0.558162,-0.527957,0.640091,0.055031,0.064761,-0.004818,
-	-0.563066,-0.515371,0.646025,0.055116,0.063504,-0.005781,
-	-0.627283,-0.480953,0.612536,0.055885,0.063727,-0.004818,
-	-0.641198,-0.455323,0.617694,0.055885,0.06242,-0.005781,
-	-0.627283,-0.480953,0.612536,0.055885,0.063727,-0.004818,
-	-0.563066,-0.515371,0.646025,0.055116,0.063504,-0.005781,
-	0.641198,-0.455323,0.617694,0.055885,0.06242,-0.005781,
-	0.584317,-0.505368,0.634963,0.056655,0.063504,-0.005781,
-	0.627283,-0.480953,0.612536,0.055885,0.063727,-0.004818,
-	0.53575,-0.534369,0.653775,0.056739,0.064761,-0.004818,
-	0.627283,-0.480953,0.612536,0.055885,0.063727,-0.004818,
-	0.584317,-0.505368,0.634963,0.056655,0.063504,-0.005781,
-	0.584317,-0.505368,0.634963,0.056655,0.063504,-0.005781,
-	0.438876,-0.557947,0.704332,0.057644,0.064391,-0.005781,
-	0.53575,-0.534369,0.653775,0.056739,0.064761,-0.004818,
-	0.377865,-0.569077,0.730322,0.057837,0.065766,-0.004818,
-	0.53575,-0.534369,0.653775,0.056739,0.064761,-0.004818,
-	0.438876,-0.557947,0.704332,0.057644,0.064391,-0.005781,
-	0.438876,-0.557947,0.704332,0.057644,0.064391,-0.005781,
-	0.267975,-0.579599,0.769581,0.058804,0.065039,-0.005781,
-	0.377865,-0.569077,0.730322,0.057837,0.065766,-0.004818,
-	0.214084,-0.583805,0.78316,0.059165,0.066474,-0.004818,
-	0.377865,-0.569077,0.730322,0.057837,0.065766,-0.004818,
-	0.267975,-0.579599,0.769581,0.058804,0.065039,-0.005781,
-	0.267975,-0.579599,0.769581,0.058804,0.065039,-0.005781,
-	0.12248,-0.576612,0.807785,0.060078,0.065415,-0.005781,
-	0.214084,-0.583805,0.78316,0.059165,0.066474,-0.004818,
-	0.072758,-0.573144,0.816219,0.060613,0.066867,-0.004818,
-	0.214084,-0.583805,0.78316,0.059165,0.066474,-0.004818,
-	0.12248,-0.576612,0.807785,0.060078,0.065415,-0.005781,
-	0.12248,-0.576612,0.807785,0.060078,0.065415,-0.005781,
-	-0.00829,-0.554159,0.832369,0.061404,0.065502,-0.005781,
-	0.072758,-0.573144,0.816219,0.060613,0.066867,-0.004818,
-	-0.054393,-0.544766,0.836822,0.06211,0.066926,-0.004818,
-	0.072758,-0.573144,0.816219,0.060613,0.066867,-0.004818,
-	-0.00829,-0.554159,0.832369,0.061404,0.065502,-0.005781,
-	-0.00829,-0.554159,0.832369,0.061404,0.065502,-0.005781,
-	-0.126112,-0.516835,0.846745,0.062716,0.065295,-0.005781,
-	-0.054393,-0.544766,0.836822,0.06211,0.066926,-0.004818,
-	-0.169323,-0.502195,0.848015,0.063583,0.066646,-0.004818,
-	-0.054393,-0.544766,0.836822,0.06211,0.066926,-0.004818,
-	-0.126112,-0.516835,0.846745,0.062716,0.065295,-0.005781,
-	0.622274,0.404734,0.670049,0.055885,0.043244,-0.004818,
-	0.619748,0.407106,0.670953,0.055885,0.044839,-0.005781,
-	0.611328,0.411243,0.676134,0.055414,0.04397,-0.004818,
-	-0.622274,0.404734,0.670049,0.055885,0.043244,-0.004818,
-	-0.611328,0.411243,0.676134,0.056357,0.04397,-0.004818,
-	-0.619748,0.407106,0.670953,0.055885,0.044839,-0.005781,
-	-0.600355,0.41774,0.681958,0.05631,0.04548,-0.005781,
-	-0.619748,0.407106,0.670953,0.055885,0.044839,-0.005781,
-	-0.611328,0.411243,0.676134,0.056357,0.04397,-0.004818,
-	-0.611328,0.411243,0.676134,0.056357,0.04397,-0.004818,
-	-0.583861,0.425853,0.691199,0.056856,0.044676,-0.004818,
-	-0.600355,0.41774,0.681958,0.05631,0.04548,-0.005781,
-	-0.573435,0.432324,0.695894,0.05676,0.046104,-0.005781,
-	-0.600355,0.41774,0.681958,0.05631,0.04548,-0.005781,
-	-0.583861,0.425853,0.691199,0.056856,0.044676,-0.004818,
-	-0.583861,0.425853,0.691199,0.056856,0.044676,-0.004818,
-	-0.557839,0.440321,0.703515,0.05738,0.045363,-0.004818,
-	-0.573435,0.432324,0.695894,0.05676,0.046104,-0.005781,
-	-0.547914,0.446817,0.707209,0.057232,0.046711,-0.005781,
-	-0.573435,0.432324,0.695894,0.05676,0.046104,-0.005781,
-	-0.557839,0.440321,0.703515,0.05738,0.045363,-0.004818,
-	-0.557839,0.440321,0.703515,0.05738,0.045363,-0.004818,
-	-0.528358,0.458036,0.714871,0.05793,0.046029,-0.004818,
-	-0.547914,0.446817,0.707209,0.057232,0.046711,-0.005781,
-	-0.525024,0.459644,0.716294,0.057728,0.047299,-0.005781,
-	-0.547914,0.446817,0.707209,0.057232,0.046711,-0.005781,
-	-0.528358,0.458036,0.714871,0.05793,0.046029,-0.004818,
-	-0.525024,0.459644,0.716294,0.057728,0.047299,-0.005781,
-	-0.528358,0.458036,0.714871,0.05793,0.046029,-0.004818,
-	-0.507344,0.470385,0.722039,0.058245,0.047867,-0.005781,
-	-0.502587,0.474851,0.722443,0.058505,0.046673,-0.004818,
-	-0.507344,0.470385,0.722039,0.058245,0.047867,-0.005781,
-	-0.528358,0.458036,0.714871,0.05793,0.046029,-0.004818,
-	-0.507344,0.470385,0.722039,0.058245,0.047867,-0.005781,
-	-0.502587,0.474851,0.722443,0.058505,0.046673,-0.004818,
-	-0.484849,0.48521,0.727662,0.058784,0.048416,-0.005781,
-	-0.480277,0.489774,0.727637,0.059103,0.047293,-0.004818,
-	-0.484849,0.48521,0.727662,0.058784,0.048416,-0.005781,
-	-0.502587,0.474851,0.722443,0.058505,0.046673,-0.004818,
-	-0.484849,0.48521,0.727662,0.058784,0.048416,-0.005781,
-	-0.480277,0.489774,0.727637,0.059103,0.047293,-0.004818,
-	-0.463202,0.500363,0.731492,0.059343,0.048943,-0.005781,
-	-0.458764,0.50505,0.731068,0.059724,0.047891,-0.004818,
-	-0.463202,0.500363,0.731492,0.059343,0.048943,-0.005781,
-	-0.480277,0.489774,0.727637,0.059103,0.047293,-0.004818,
-	-0.463202,0.500363,0.731492,0.059343,0.048943,-0.005781,
-	-0.458764,0.50505,0.731068,0.059724,0.047891,-0.004818,
-	-0.442255,0.515933,0.733637,0.059922,0.049449,-0.005781,
-	-0.437903,0.520767,0.732832,0.060366,0.048464,-0.004818,
-	-0.442255,0.515933,0.733637,0.059922,0.049449,-0.005781,
-	-0.458764,0.50505,0.731068,0.059724,0.047891,-0.004818,
-	-0.442255,0.515933,0.733637,0.059922,0.049449,-0.005781,
-	-0.437903,0.520767,0.732832,0.060366,0.048464,-0.004818,
-	-0.421867,0.532005,0.734165,0.06052,0.049933,-0.005781,
-	-0.417553,0.537009,0.732987,0.06103,0.049011,-0.004818,
-	-0.421867,0.532005,0.734165,0.06052,0.049933,-0.005781,
-	-0.437903,0.520767,0.732832,0.060366,0.048464,-0.004818,
-	-0.421867,0.532005,0.734165,0.06052,0.049933,-0.005781,
-	-0.417553,0.537009,0.732987,0.06103,0.049011,-0.004818,
-	-0.401898,0.548661,0.73311,0.061136,0.050393,-0.005781,
-	-0.397577,0.553859,0.731555,0.061714,0.049532,-0.004818,
-	-0.401898,0.548661,0.73311,0.061136,0.050393,-0.005781,
-	-0.417553,0.537009,0.732987,0.06103,0.049011,-0.004818,
-	-0.401898,0.548661,0.73311,0.061136,0.050393,-0.005781,
-	-0.397577,0.553859,0.731555,0.061714,0.049532,-0.004818,
-	-0.382209,0.565977,0.730469,0.061769,0.050829,-0.005781,
-	-0.377837,0.571394,0.728525,0.062416,0.050026,-0.004818,
-	-0.382209,0.565977,0.730469,0.061769,0.050829,-0.005781,
-	-0.397577,0.553859,0.731555,0.061714,0.049532,-0.004818,
-	-0.382209,0.565977,0.730469,0.061769,0.050829,-0.005781,
-	-0.377837,0.571394,0.728525,0.062416,0.050026,-0.004818,
-	-0.37698,0.573856,0.727032,0.062418,0.051241,-0.005781,
-	-0.379372,0.571846,0.727371,0.063137,0.050493,-0.004818,
-	-0.37698,0.573856,0.727032,0.062418,0.051241,-0.005781,
-	-0.377837,0.571394,0.728525,0.062416,0.050026,-0.004818,
-	-0.379372,0.571846,0.727371,0.063137,0.050493,-0.004818,
-	-0.405711,0.551851,0.728601,0.063888,0.051003,-0.004818,
-	-0.37698,0.573856,0.727032,0.062418,0.051241,-0.005781,
-	-0.403275,0.554082,0.72826,0.063095,0.051693,-0.005781,
-	-0.37698,0.573856,0.727032,0.062418,0.051241,-0.005781,
-	-0.405711,0.551851,0.728601,0.063888,0.051003,-0.004818,
-	-0.403275,0.554082,0.72826,0.063095,0.051693,-0.005781,
-	-0.405711,0.551851,0.728601,0.063888,0.051003,-0.004818,
-	-0.439698,0.520339,0.732061,0.063732,0.052198,-0.005781,
-	-0.455156,0.505988,0.732672,0.064596,0.051576,-0.004818,
-	-0.439698,0.520339,0.732061,0.063732,0.052198,-0.005781,
-	-0.405711,0.551851,0.728601,0.063888,0.051003,-0.004818,
-	-0.439698,0.520339,0.732061,0.063732,0.052198,-0.005781,
-	-0.455156,0.505988,0.732672,0.064596,0.051576,-0.004818,
-	-0.478388,0.479119,0.735928,0.064326,0.052755,-0.005781,
-	-0.492434,0.463571,0.736621,0.065254,0.052206,-0.004818,
-	-0.478388,0.479119,0.735928,0.064326,0.052755,-0.005781,
-	-0.455156,0.505988,0.732672,0.064596,0.051576,-0.004818,
-	-0.478388,0.479119,0.735928,0.064326,0.052755,-0.005781,
-	-0.492434,0.463571,0.736621,0.065254,0.052206,-0.004818,
-	-0.513034,0.434953,0.740008,0.06487,0.053359,-0.005781,
-	-0.525496,0.418365,0.740827,0.065859,0.05289,-0.004818,
-	-0.513034,0.434953,0.740008,0.06487,0.053359,-0.005781,
-	-0.492434,0.463571,0.736621,0.065254,0.052206,-0.004818,
-	-0.513034,0.434953,0.740008,0.06487,0.053359,-0.005781,
-	-0.525496,0.418365,0.740827,0.065859,0.05289,-0.004818,
-	-0.543337,0.388194,0.744372,0.065363,0.054006,-0.005781,
-	-0.554068,0.370754,0.745352,0.066406,0.053623,-0.004818,
-	-0.543337,0.388194,0.744372,0.065363,0.054006,-0.005781,
-	-0.525496,0.418365,0.740827,0.065859,0.05289,-0.004818,
-	-0.543337,0.388194,0.744372,0.065363,0.054006,-0.005781,
-	-0.554068,0.370754,0.745352,0.066406,0.053623,-0.004818,
-	-0.569031,0.339242,0.749078,0.065801,0.054691,-0.005781,
-	-0.577912,0.321162,0.750248,0.066892,0.054399,-0.004818,
-	-0.569031,0.339242,0.749078,0.065801,0.054691,-0.005781,
-	-0.554068,0.370754,0.745352,0.066406,0.053623,-0.004818,
-	-0.569031,0.339242,0.749078,0.065801,0.054691,-0.005781,
-	-0.577912,0.321162,0.750248,0.066892,0.054399,-0.004818,
-	-0.589896,0.288542,0.754166,0.06618,0.055411,-0.005781,
-	-0.596848,0.270049,0.755544,0.067313,0.055214,-0.004818,
-	-0.589896,0.288542,0.754166,0.06618,0.055411,-0.005781,
-	-0.577912,0.321162,0.750248,0.066892,0.054399,-0.004818,
-	-0.589896,0.288542,0.754166,0.06618,0.055411,-0.005781,
-	-0.596848,0.270049,0.755544,0.067313,0.055214,-0.004818,
-	-0.60577,0.236571,0.759656,0.066498,0.05616,-0.005781,
-	-0.610753,0.217903,0.761249,0.067666,0.056061,-0.004818,
-	-0.60577,0.236571,0.759656,0.066498,0.05616,-0.005781,
-	-0.596848,0.270049,0.755544,0.067313,0.055214,-0.004818,
-	-0.60577,0.236571,0.759656,0.066498,0.05616,-0.005781,
-	-0.610753,0.217903,0.761249,0.067666,0.056061,-0.004818,
-	-0.616557,0.183837,0.765546,0.066754,0.056932,-0.005781,
-	-0.619574,0.165232,0.767351,0.067949,0.056936,-0.004818,
-	-0.616557,0.183837,0.765546,0.066754,0.056932,-0.005781,
-	-0.610753,0.217903,0.761249,0.067666,0.056061,-0.004818,
-	-0.616557,0.183837,0.765546,0.066754,0.056932,-0.005781,
-	-0.619574,0.165232,0.767351,0.067949,0.056936,-0.004818,
-	-0.622238,0.13086,0.771813,0.066944,0.057723,-0.005781,
-	-0.623333,0.112547,0.773815,0.068161,0.057831,-0.004818,
-	-0.622238,0.13086,0.771813,0.066944,0.057723,-0.005781,
-	-0.619574,0.165232,0.767351,0.067949,0.056936,-0.004818,
-	-0.622238,0.13086,0.771813,0.066944,0.057723,-0.005781,
-	-0.623333,0.112547,0.773815,0.068161,0.057831,-0.004818,
-	-0.622921,0.078006,0.778386,0.067068,0.058527,-0.005781,
-	-0.622674,0.06887,0.779444,0.068298,0.058741,-0.004818,
-	-0.622921,0.078006,0.778386,0.067068,0.058527,-0.005781,
-	-0.623333,0.112547,0.773815,0.068161,0.057831,-0.004818,
-	-0.622921,0.078006,0.778386,0.067068,0.058527,-0.005781,
-	-0.622674,0.06887,0.779444,0.068298,0.058741,-0.004818,
-	-0.615482,0.005518,0.788132,0.068362,0.05966,-0.004818,
-	-0.622921,0.078006,0.778386,0.067068,0.058527,-0.005781,
-	-0.615482,0.005518,0.788132,0.068362,0.05966,-0.004818,
-	-0.608032,-0.012608,0.793813,0.067125,0.059338,-0.005781,
-	-0.615482,0.005518,0.788132,0.068362,0.05966,-0.004818,
-	-0.587334,-0.078712,0.805508,0.068281,0.061186,-0.004818,
-	-0.608032,-0.012608,0.793813,0.067125,0.059338,-0.005781,
-	-0.563271,-0.124273,0.816873,0.067016,0.060662,-0.005781,
-	-0.608032,-0.012608,0.793813,0.067125,0.059338,-0.005781,
-	-0.587334,-0.078712,0.805508,0.068281,0.061186,-0.004818,
-	-0.587334,-0.078712,0.805508,0.068281,0.061186,-0.004818,
-	-0.528554,-0.194938,0.826214,0.067873,0.062655,-0.004818,
-	-0.563271,-0.124273,0.816873,0.067016,0.060662,-0.005781,
-	-0.498136,-0.2337,0.835012,0.066618,0.06193,-0.005781,
-	-0.563271,-0.124273,0.816873,0.067016,0.060662,-0.005781,
-	-0.528554,-0.194938,0.826214,0.067873,0.062655,-0.004818,
-	-0.528554,-0.194938,0.826214,0.067873,0.062655,-0.004818,
-	-0.454671,-0.294294,0.840634,0.067158,0.063997,-0.004818,
-	-0.498136,-0.2337,0.835012,0.066618,0.06193,-0.005781,
-	-0.419714,-0.3263,0.846976,0.065951,0.063079,-0.005781,
-	-0.498136,-0.2337,0.835012,0.066618,0.06193,-0.005781,
-	-0.454671,-0.294294,0.840634,0.067158,0.063997,-0.004818,
-	-0.454671,-0.294294,0.840634,0.067158,0.063997,-0.004818,
-	-0.369159,-0.377727,0.849143,0.06617,0.065145,-0.004818,
-	-0.419714,-0.3263,0.846976,0.065951,0.063079,-0.005781,
-	-0.33096,-0.403408,0.853069,0.065047,0.064053,-0.005781,
-	-0.419714,-0.3263,0.846976,0.065951,0.063079,-0.005781,
-	-0.369159,-0.377727,0.849143,0.06617,0.065145,-0.004818,
-	-0.369159,-0.377727,0.849143,0.06617,0.065145,-0.004818,
-	-0.273921,-0.44663,0.851756,0.064959,0.066043,-0.004818,
-	-0.33096,-0.403408,0.853069,0.065047,0.064053,-0.005781,
-	-0.233173,-0.466563,0.853199,0.063951,0.064804,-0.005781,
-	-0.33096,-0.403408,0.853069,0.065047,0.064053,-0.005781,
-	-0.273921,-0.44663,0.851756,0.064959,0.066043,-0.004818,
-	-0.273921,-0.44663,0.851756,0.064959,0.066043,-0.004818,
-	-0.169323,-0.502195,0.848015,0.063583,0.066646,-0.004818,
-	-0.233173,-0.466563,0.853199,0.063951,0.064804,-0.005781
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,648,data,NULL};
-const struct gllist *companion_heart=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char companion_heart[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\334\000\000\000\210\002\000\000e\001\000\0002\350"
+ "d=\317\240a=n\247\255\273\325k\3144\023F\276h\017\373\000\000\276R\265c\017"
+ "\373\000\000\370N\233v\361\004\000\000\377\377@K\017\373\000\000\033\370"
+ "_V\017\373\000\000\366\355x_\017\373\000\000\017\342\036f\017\373\000\000"
+ "\375\324\372i\017\373\000\000c\307\336j\017\373\000\000\352\271\276h\017"
+ "\373\000\000B\255\265c\017\373\000\000\003\242\001\134\017\373\000\000\275"
+ "\230\003R\017\373\000\000\343\2219F\017\373\000\000\315\21579\017\373\000"
+ "\000\257\214\242+\017\373\000\000E\215P#\017\373\000\000\215\216\020\033"
+ "\017\373\000\000\200\220\363\022\017\373\000\000\036\223\007\013\017\373"
+ "\000\000a\226X\003\017\373\000\000G\232\365\373\017\373\000\000\303\236\356"
+ "\364\017\373\000\000\321\243K\356\017\373\000\000i\251\031\350\017\373\000"
+ "\000~\257b\342\017\373\000\000\007\2664\335\017\373\000\000\371\274\221\330"
+ "\017\373\000\000\242\303V\324\017\373\000\000 \312\335\317\017\373\000\000"
+ "r\320%\313\017\373\000\000\224\326.\306\017\373\000\000\205\334\375\300\017"
+ "\373\000\000D\342\225\273\017\373\000\000\311\347\363\265\017\373\000\000"
+ "\031\355 \260\017\373\000\000-\362\027\252\017\373\000\000\007\367\335\243"
+ "\017\373\000\000\243\373v\235\017\373\000\000\377\377\343\226\017\373\000"
+ "\000[\004v\235\017\373\000\000\371\010\335\243\017\373\000\000\320\015\027"
+ "\252\017\373\000\000\347\022 \260\017\373\000\0005\030\363\265\017\373\000"
+ "\000\274\035\225\273\017\373\000\000x#\375\300\017\373\000\000i).\306\017"
+ "\373\000\000\214/%\313\017\373\000\000\3355\335\317\017\373\000\000\134<"
+ "V\324\017\373\000\000\004C\221\330\017\373\000\000\366I4\335\017\373\000"
+ "\000\177Pb\342\017\373\000\000\227V\031\350\017\373\000\000,\134K\356\017"
+ "\373\000\000;a\356\364\017\373\000\000\271e\365\373\017\373\000\000\234i"
+ "X\003\017\373\000\000\340l\007\013\017\373\000\000\200o\363\022\017\373\000"
+ "\000sq\020\033\017\373\000\000\271rP#\017\373\000\000Ns\242+\017\373\000"
+ "\0000r79\017\373\000\000\033n9F\017\373\000\000Cg\003R\017\373\000\000\375"
+ "]\001\134\017\373\000\000\276R\265c\017\373\000\000\023F\276h\017\373\000"
+ "\000\2358\336j\017\373\000\000\003+\372i\017\373\000\000\361\035\036f\017"
+ "\373\000\000\012\022x_\017\373\000\000\345\007_V\017\373\000\000\243\373"
+ "v\235\017\373\000\000*\373\371\215\361\004\000\000\377\377\343\226\017\373"
+ "\000\000\013\3667\225\361\004\000\000\007\367\335\243\017\373\000\000\250"
+ "\360C\234\361\004\000\000-\362\027\252\017\373\000\000\004\353\030\243\361"
+ "\004\000\000\031\355 \260\017\373\000\000\311\347\363\265\017\373\000\000"
+ " \345\264\251\361\004\000\000D\342\225\273\017\373\000\000\376\336\020\260"
+ "\361\004\000\000\205\334\375\300\017\373\000\000\237\3302\266\361\004\000"
+ "\000\224\326.\306\017\373\000\000\006\322\023\274\361\004\000\000r\320%\313"
+ "\017\373\000\0009\313\260\301\361\004\000\0005\304\010\307\361\004\000\000"
+ " \312\335\317\017\373\000\000\376\274\032\314\361\004\000\000\242\303V\324"
+ "\017\373\000\000\233\265\344\320\361\004\000\000\371\274\221\330\017\373"
+ "\000\000\344\255\037\326\361\004\000\000\007\2664\335\017\373\000\000~\257"
+ "b\342\017\373\000\000\244\246\000\334\361\004\000\000i\251\031\350\017\373"
+ "\000\000\344\237w\342\361\004\000\000\321\243K\356\017\373\000\000\257\231"
+ "{\351\361\004\000\000\303\236\356\364\017\373\000\000\022\224\000\361\361"
+ "\004\000\000G\232\365\373\017\373\000\000\026\217\366\370\361\004\000\000"
+ "a\226X\003\017\373\000\000\304\212S\001\361\004\000\000\036\223\007\013\017"
+ "\373\000\000%\207\003\012\361\004\000\000\200\220\363\022\017\373\000\000"
+ ";\204\375\022\361\004\000\000\215\216\020\033\017\373\000\000\021\202,\034"
+ "\361\004\000\000E\215P#\017\373\000\000\246\200\202%\361\004\000\000\001"
+ "\200\357.\361\004\000\000\257\214\242+\017\373\000\000\323\200\227>\361\004"
+ "\000\000\315\21579\017\373\000\000\005\205\251M\361\004\000\000\343\2219"
+ "F\017\373\000\000[\214n[\361\004\000\000\275\230\003R\017\373\000\000{\226"
+ "5g\361\004\000\000\003\242\001\134\017\373\000\000\352\242kp\361\004\000"
+ "\000B\255\265c\017\373\000\000\010\261\233v\361\004\000\000\352\271\276h"
+ "\017\373\000\000\042\300zy\361\004\000\000c\307\336j\017\373\000\000~\317"
+ "\337x\361\004\000\000\375\324\372i\017\373\000\000X\336\327t\361\004\000"
+ "\000\017\342\036f\017\373\000\000\366\355x_\017\373\000\000\373\353\223m"
+ "\361\004\000\000\033\370_V\017\373\000\000<\367Dc\361\004\000\000\377\377"
+ "\250X\361\004\000\000\377\377@K\017\373\000\000\377\377@K\017\373\000\000"
+ "\345\007_V\017\373\000\000\377\377\250X\361\004\000\000\302\010Dc\361\004"
+ "\000\000\012\022x_\017\373\000\000\005\024\223m\361\004\000\000\361\035\036"
+ "f\017\373\000\000\245!\327t\361\004\000\000\003+\372i\017\373\000\000\200"
+ "0\337x\361\004\000\000\2358\336j\017\373\000\000\333\077zy\361\004\000\000"
+ "\377\377\206\206\361\004\000\000\377\377\206\206\361\004\000\000\326\004"
+ "\371\215\361\004\000\000\377\377\343\226\017\373\000\000[\004v\235\017\373"
+ "\000\000\365\0117\225\361\004\000\000\371\010\335\243\017\373\000\000U\017"
+ "C\234\361\004\000\000\320\015\027\252\017\373\000\000\371\024\030\243\361"
+ "\004\000\000\347\022 \260\017\373\000\0005\030\363\265\017\373\000\000\340"
+ "\032\264\251\361\004\000\000\274\035\225\273\017\373\000\000\002!\020\260"
+ "\361\004\000\000x#\375\300\017\373\000\000a'2\266\361\004\000\000i).\306"
+ "\017\373\000\000\367-\023\274\361\004\000\000\214/%\313\017\373\000\000\307"
+ "4\260\301\361\004\000\000\3355\335\317\017\373\000\000\313;\010\307\361\004"
+ "\000\000\134<V\324\017\373\000\000\377B\032\314\361\004\000\000\004C\221"
+ "\330\017\373\000\000eJ\344\320\361\004\000\000\031R\037\326\361\004\000\000"
+ "\366I4\335\017\373\000\000\177Pb\342\017\373\000\000\134Y\000\334\361\004"
+ "\000\000\227V\031\350\017\373\000\000\034`w\342\361\004\000\000,\134K\356"
+ "\017\373\000\000Qf{\351\361\004\000\000;a\356\364\017\373\000\000\356k\000"
+ "\361\361\004\000\000\271e\365\373\017\373\000\000\352p\366\370\361\004\000"
+ "\000\234iX\003\017\373\000\000<uS\001\361\004\000\000\340l\007\013\017\373"
+ "\000\000\333x\003\012\361\004\000\000\200o\363\022\017\373\000\000\302{\375"
+ "\022\361\004\000\000sq\020\033\017\373\000\000\357},\034\361\004\000\000"
+ "\271rP#\017\373\000\000W\177\202%\361\004\000\000\377\177\357.\361\004\000"
+ "\000Ns\242+\017\373\000\000*\177\227>\361\004\000\0000r79\017\373\000\000"
+ "\373z\251M\361\004\000\000\033n9F\017\373\000\000\245sn[\361\004\000\000"
+ "Cg\003R\017\373\000\000\202i5g\361\004\000\000\375]\001\134\017\373\000\000"
+ "\026]kp\361\004\000\000\365\324\355\332\362\326\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000-\037.\037.\036, + *!)!'\042"
+ "'\042&#&#$$$%#%\042&!'!' ( (\036)\036*\035+\034+\034+\035+\037*\036*!'\042"
+ "&$$%#'!( )\035*\034,\032,\031.\026/\0250\0231\0212\0173\0164\0134\0115\007"
+ "6\0067\0007\3773\3710\366+\360(\355$\350!\346\035\342\032\340\026\334\023"
+ "\332\016\326\013\324\005\320\001\316\372\316\366\317\355\322\354\322\344"
+ "\325\340\326\327\332\327\331\322\335\320\3360\336+\333.\335'\331!\326\035"
+ "\325\025\322\021\321\012\317\006\316\377\316\373\320/\036\321\036\322\037"
+ "\322\036\323\037\324 \325 \326!\327!\331\042\331\042\332#\332#\334$\334%"
+ "\335%\336&\337'\337'\340(\341(\342)\342*\343+\343+\343+\343+\341*\342*\337"
+ "'\336&\334$\333#\331!\330 \327\035\326\034\324\032\324\031\322\026\321\025"
+ "\320\023\317\021\316\017\315\016\314\013\314\011\313\007\312\006\311\000"
+ "\311\377\315\371\320\366\325\360\330\355\334\350\337\346\343\342\346\340"
+ "\352\334\000\000\001\000\002\000\003\000\004\000\005\000\003\000\005\000"
+ "\006\000\003\000\006\000\007\000\003\000\007\000\010\000\003\000\010\000"
+ "\011\000\003\000\011\000\012\000\003\000\012\000\013\000\003\000\013\000"
+ "\014\000\003\000\014\000\015\000\003\000\015\000\016\000\003\000\016\000"
+ "\017\000\003\000\017\000\020\000\003\000\020\000\021\000\003\000\021\000"
+ "\022\000\003\000\022\000\023\000\003\000\023\000\024\000\003\000\024\000"
+ "\025\000\003\000\025\000\026\000\003\000\026\000\027\000\003\000\027\000"
+ "\030\000\003\000\030\000\031\000\003\000\031\000\032\000\003\000\032\000"
+ "\033\000\003\000\033\000\034\000\003\000\034\000\035\000\003\000\035\000"
+ "\036\000\003\000\036\000\037\000\003\000\037\000 \000\003\000 \000!\000\003"
+ "\000!\000\042\000\003\000\042\000#\000\003\000#\000$\000\003\000$\000%\000"
+ "\003\000%\000&\000\003\000&\000'\000\003\000'\000(\000\003\000(\000)\000"
+ "\003\000)\000*\000\003\000*\000+\000\003\000+\000,\000\003\000,\000-\000"
+ "\003\000-\000.\000\003\000.\000/\000\003\000/\0000\000\003\0000\0001\000"
+ "\003\0001\0002\000\003\0002\0003\000\003\0003\0004\000\003\0004\0005\000"
+ "\003\0005\0006\000\003\0006\0007\000\003\0007\0008\000\003\0008\0009\000"
+ "\003\0009\000:\000\003\000:\000;\000\003\000;\000<\000\003\000<\000=\000"
+ "\003\000=\000>\000\003\000>\000\077\000\003\000\077\000@\000\003\000@\000"
+ "A\000\003\000A\000B\000\003\000B\000C\000\003\000C\000D\000\003\000D\000"
+ "E\000\003\000E\000F\000\003\000F\000G\000\003\000G\000H\000\003\000H\000"
+ "I\000\003\000I\000J\000\003\000J\000\003\000\003\000\003\000\004\000K\000"
+ "L\000M\000L\000K\000N\000O\000N\000K\000N\000O\000P\000Q\000P\000O\000P\000"
+ "Q\000R\000S\000R\000Q\000S\000T\000R\000U\000R\000T\000T\000V\000U\000W\000"
+ "U\000V\000V\000X\000W\000Y\000W\000X\000X\000Z\000Y\000[\000Y\000Z\000Z\000"
+ "\134\000[\000]\000[\000\134\000]\000\134\000^\000_\000^\000\134\000^\000"
+ "_\000`\000a\000`\000_\000`\000a\000b\000c\000b\000a\000b\000c\000d\000e\000"
+ "d\000c\000e\000f\000d\000g\000d\000f\000f\000h\000g\000i\000g\000h\000h\000"
+ "j\000i\000k\000i\000j\000j\000l\000k\000m\000k\000l\000l\000n\000m\000o\000"
+ "m\000n\000n\000p\000o\000q\000o\000p\000p\000r\000q\000s\000q\000r\000r\000"
+ "t\000s\000u\000s\000t\000t\000v\000u\000w\000u\000v\000v\000x\000w\000y\000"
+ "w\000x\000z\000y\000x\000z\000x\000{\000z\000{\000|\000}\000|\000{\000|\000"
+ "}\000~\000\177\000~\000}\000~\000\177\000\200\000\201\000\200\000\177\000"
+ "\200\000\201\000\202\000\203\000\202\000\201\000\202\000\203\000\204\000"
+ "\205\000\204\000\203\000\204\000\205\000\206\000\207\000\206\000\205\000"
+ "\206\000\207\000\210\000\211\000\210\000\207\000\210\000\211\000\212\000"
+ "\213\000\212\000\211\000\212\000\213\000\214\000\215\000\214\000\213\000"
+ "\215\000\216\000\214\000\217\000\214\000\216\000\216\000\220\000\217\000"
+ "\221\000\217\000\220\000\221\000\220\000\222\000\223\000\222\000\220\000"
+ "\224\000\225\000\226\000\227\000\226\000\225\000\225\000\230\000\227\000"
+ "\231\000\227\000\230\000\230\000\232\000\231\000\233\000\231\000\232\000"
+ "\232\000\234\000\233\000\235\000\233\000\234\000\234\000\236\000\235\000"
+ "\237\000\235\000\236\000\236\000\000\000\237\000\002\000\237\000\000\000"
+ "\240\000M\000L\000\241\000\242\000\243\000\244\000\243\000\242\000\242\000"
+ "\245\000\244\000\246\000\244\000\245\000\245\000\247\000\246\000\250\000"
+ "\246\000\247\000\247\000\251\000\250\000\252\000\250\000\251\000\252\000"
+ "\251\000\253\000\254\000\253\000\251\000\253\000\254\000\255\000\256\000"
+ "\255\000\254\000\255\000\256\000\257\000\260\000\257\000\256\000\257\000"
+ "\260\000\261\000\262\000\261\000\260\000\261\000\262\000\263\000\264\000"
+ "\263\000\262\000\263\000\264\000\265\000\266\000\265\000\264\000\265\000"
+ "\266\000\267\000\270\000\267\000\266\000\267\000\270\000\271\000\272\000"
+ "\271\000\270\000\272\000\273\000\271\000\274\000\271\000\273\000\274\000"
+ "\273\000\275\000\276\000\275\000\273\000\275\000\276\000\277\000\300\000"
+ "\277\000\276\000\277\000\300\000\301\000\302\000\301\000\300\000\301\000"
+ "\302\000\303\000\304\000\303\000\302\000\303\000\304\000\305\000\306\000"
+ "\305\000\304\000\305\000\306\000\307\000\310\000\307\000\306\000\307\000"
+ "\310\000\311\000\312\000\311\000\310\000\311\000\312\000\313\000\314\000"
+ "\313\000\312\000\313\000\314\000\315\000\316\000\315\000\314\000\315\000"
+ "\316\000\317\000\320\000\317\000\316\000\317\000\320\000\321\000\317\000"
+ "\321\000\322\000\321\000\323\000\322\000\324\000\322\000\323\000\323\000"
+ "\325\000\324\000\326\000\324\000\325\000\325\000\327\000\326\000\330\000"
+ "\326\000\327\000\327\000\331\000\330\000\332\000\330\000\331\000\331\000"
+ "\333\000\332\000\001\000\332\000\333\000\333\000\002\000\001\000\000\000"
+ "\001\000\001\000\002\000\000\000\002\000\003\000\004\000\004\000\005\000"
+ "\003\000\005\000\005\000\006\000\003\000\006\000\006\000\007\000\003\000"
+ "\007\000\007\000\010\000\003\000\010\000\010\000\011\000\003\000\011\000"
+ "\011\000\012\000\003\000\012\000\012\000\013\000\003\000\013\000\013\000"
+ "\014\000\003\000\014\000\014\000\015\000\003\000\015\000\015\000\016\000"
+ "\003\000\016\000\016\000\017\000\003\000\017\000\017\000\020\000\003\000"
+ "\020\000\020\000\021\000\003\000\021\000\021\000\022\000\003\000\022\000"
+ "\022\000\023\000\003\000\023\000\023\000\024\000\003\000\024\000\024\000"
+ "\025\000\003\000\025\000\025\000\026\000\003\000\026\000\026\000\027\000"
+ "\003\000\027\000\027\000\030\000\003\000\030\000\030\000\031\000\003\000"
+ "\031\000\031\000\032\000\003\000\032\000\032\000\033\000\003\000\033\000"
+ "\033\000\034\000\003\000\034\000\034\000\035\000\003\000\035\000\035\000"
+ "\036\000\003\000\036\000\036\000\037\000\003\000\037\000\037\000 \000\003"
+ "\000 \000 \000!\000\003\000!\000!\000\042\000\003\000\042\000\042\000#\000"
+ "\003\000#\000#\000$\000\003\000$\000$\000%\000\003\000%\000%\000&\000\003"
+ "\000&\000&\000'\000\003\000'\000'\000(\000\003\000(\000(\000)\000\003\000"
+ ")\000)\000*\000\003\000*\000*\000+\000\003\000+\000+\000,\000\003\000,\000"
+ ",\000-\000\003\000-\000-\000.\000\003\000.\000.\000/\000\003\000/\000/\000"
+ "0\000\003\0000\0000\0001\000\003\0001\0001\0002\000\003\0002\0002\0003\000"
+ "\003\0003\0003\0004\000\003\0004\0004\0005\000\003\0005\0005\0006\000\003"
+ "\0006\0006\0007\000\003\0007\0007\0008\000\003\0008\0008\0009\000\003\000"
+ "9\0009\000:\000\003\000:\000:\000;\000\003\000;\000;\000<\000\003\000<\000"
+ "<\000=\000\003\000=\000=\000>\000\003\000>\000>\000\077\000\003\000\077\000"
+ "\077\000@\000\003\000@\000@\000A\000\003\000A\000A\000B\000\003\000B\000"
+ "B\000C\000\003\000C\000\001\000C\000\001\000\003\000\000\000\003\000\000"
+ "\000F\000\003\000F\000F\000G\000\003\000G\000G\000H\000\003\000H\000H\000"
+ "I\000\003\000I\000I\000J\000\003\000J\000&\000L\000'\000L\000&\000N\000L"
+ "\000N\000%\000N\000%\000P\000N\000P\000$\000P\000$\000R\000P\000R\000#\000"
+ "R\000\042\000R\000R\000U\000\042\000U\000!\000U\000U\000W\000!\000W\000 "
+ "\000W\000W\000Y\000 \000Y\000\037\000Y\000Y\000[\000\037\000[\000\036\000"
+ "[\000[\000]\000\036\000]\000\036\000^\000]\000^\000\035\000^\000\035\000"
+ "`\000^\000`\000\034\000`\000\034\000b\000`\000b\000\033\000b\000\033\000"
+ "d\000b\000d\000\032\000d\000\031\000d\000d\000g\000\031\000g\000\030\000"
+ "g\000g\000i\000\030\000i\000\027\000i\000i\000k\000\027\000k\000\026\000"
+ "k\000k\000m\000\026\000m\000\025\000m\000m\000o\000\025\000o\000\024\000"
+ "o\000o\000q\000\024\000q\000\023\000q\000q\000s\000\023\000s\000\022\000"
+ "s\000s\000u\000\022\000u\000\021\000u\000u\000w\000\021\000w\000\020\000"
+ "w\000w\000y\000\020\000y\000y\000z\000\020\000z\000\017\000z\000\017\000"
+ "|\000z\000|\000\016\000|\000\016\000~\000|\000~\000\015\000~\000\015\000"
+ "\200\000~\000\200\000\014\000\200\000\014\000\202\000\200\000\202\000\013"
+ "\000\202\000\013\000\204\000\202\000\204\000\012\000\204\000\012\000\206"
+ "\000\204\000\206\000\011\000\206\000\011\000\210\000\206\000\210\000\010"
+ "\000\210\000\010\000\212\000\210\000\212\000\007\000\212\000\007\000\214"
+ "\000\212\000\214\000\006\000\214\000\005\000\214\000\214\000\217\000\005"
+ "\000\217\000\004\000\217\000\217\000\221\000\004\000\221\000\004\000\222"
+ "\000\221\000\222\000\003\000\222\000J\000\222\000\222\000\227\000J\000\227"
+ "\000I\000\227\000\227\000\231\000I\000\231\000H\000\231\000\231\000\233\000"
+ "H\000\233\000G\000\233\000\233\000\235\000G\000\235\000F\000\235\000\235"
+ "\000\237\000F\000\237\000\000\000\237\000\002\000\237\000'\000\240\000L\000"
+ "\240\000\240\000\242\000'\000\242\000(\000\242\000\242\000\245\000(\000\245"
+ "\000)\000\245\000\245\000\247\000)\000\247\000*\000\247\000\247\000\251\000"
+ "*\000\251\000+\000\251\000,\000\251\000,\000\254\000\251\000\254\000-\000"
+ "\254\000-\000\256\000\254\000\256\000.\000\256\000.\000\260\000\256\000\260"
+ "\000/\000\260\000/\000\262\000\260\000\262\0000\000\262\0000\000\264\000"
+ "\262\000\264\0001\000\264\0001\000\266\000\264\000\266\0002\000\266\0002"
+ "\000\270\000\266\000\270\0003\000\270\0003\000\272\000\270\000\272\000\272"
+ "\000\273\0003\000\273\0004\000\273\0005\000\273\0005\000\276\000\273\000"
+ "\276\0006\000\276\0006\000\300\000\276\000\300\0007\000\300\0007\000\302"
+ "\000\300\000\302\0008\000\302\0008\000\304\000\302\000\304\0009\000\304\000"
+ "9\000\306\000\304\000\306\000:\000\306\000:\000\310\000\306\000\310\000;"
+ "\000\310\000;\000\312\000\310\000\312\000<\000\312\000<\000\314\000\312\000"
+ "\314\000=\000\314\000=\000\316\000\314\000\316\000>\000\316\000>\000\320"
+ "\000\316\000\320\000\320\000\321\000>\000\321\000\077\000\321\000\321\000"
+ "\323\000\077\000\323\000@\000\323\000\323\000\325\000@\000\325\000A\000\325"
+ "\000\325\000\327\000A\000\327\000B\000\327\000\327\000\331\000B\000\331\000"
+ "C\000\331\000\331\000\333\000C\000\333\000\001\000\333\000\002\000\333\000"
+;
+const unsigned long companion_heart_size = 5004;
@@ -1,389 +1,155 @@
+/* Generated from "companion_quad.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.11097,0.464834,-0.878416,0.79903,1.636364,-0.247442,
-	0.138522,0.464654,-0.87459,0.773415,1.636364,-0.251499,
-	0.138522,0.464654,-0.87459,0.775033,1.681818,-0.227094,
-	0.11097,0.464834,-0.878416,0.79903,1.636364,-0.247442,
-	0.138522,0.464654,-0.87459,0.775033,1.681818,-0.227094,
-	0.11097,0.464834,-0.878416,0.796039,1.681818,-0.223767,
-	-0.917485,0.21303,-0.335916,0.757576,1.636364,-0.208242,
-	-0.917485,0.21303,-0.335916,0.757576,1.681818,-0.179415,
-	-0.917485,0.21303,-0.335916,0.775033,1.681818,-0.227094,
-	-0.917485,0.21303,-0.335916,0.757576,1.636364,-0.208242,
-	-0.917485,0.21303,-0.335916,0.775033,1.681818,-0.227094,
-	-0.917485,0.21303,-0.335916,0.773415,1.636364,-0.251499,
-	-1,0,0,0.757576,1.636364,-0.208242,
-	-1,0,0,0.757576,1.636364,-0.121212,
-	-1,0,0,0.757576,1.549333,-0.121212,
-	-1,0,0,0.757576,1.636364,-0.208242,
-	-1,0,0,0.757576,1.549333,-0.121212,
-	-1,0,0,0.757576,1.578161,-0.075758,
-	-1,0,0,0.757576,1.636364,-0.208242,
-	-1,0,0,0.757576,1.578161,-0.075758,
-	-1,0,0,0.757576,1.636364,-0.075758,
-	-1,0,0,0.757576,1.636364,-0.208242,
-	-1,0,0,0.757576,1.636364,-0.075758,
-	-1,0,0,0.757576,1.681818,-0.121212,
-	-1,0,0,0.757576,1.636364,-0.208242,
-	-1,0,0,0.757576,1.681818,-0.121212,
-	-1,0,0,0.757576,1.681818,-0.179415,
-	-0.917485,-0.335916,0.21303,0.757576,1.578161,-0.075758,
-	-0.917485,-0.335916,0.21303,0.757576,1.549333,-0.121212,
-	-0.917485,-0.335916,0.21303,0.773415,1.506076,-0.121212,
-	-0.917485,-0.335916,0.21303,0.757576,1.578161,-0.075758,
-	-0.917485,-0.335916,0.21303,0.773415,1.506076,-0.121212,
-	-0.917485,-0.335916,0.21303,0.775033,1.530482,-0.075758,
-	0.138522,-0.87459,0.464654,0.773415,1.506076,-0.121212,
-	0.11097,-0.878416,0.464834,0.79903,1.510133,-0.121212,
-	0.11097,-0.878416,0.464834,0.796039,1.533809,-0.075758,
-	0.138522,-0.87459,0.464654,0.773415,1.506076,-0.121212,
-	0.11097,-0.878416,0.464834,0.796039,1.533809,-0.075758,
-	0.138522,-0.87459,0.464654,0.775033,1.530482,-0.075758,
-	0.11097,-0.878416,0.464834,0.796039,1.533809,-0.075758,
-	0.11097,-0.878416,0.464834,0.79903,1.510133,-0.121212,
-	0.055595,-0.883651,0.464834,0.83883,1.513897,-0.121212,
-	0.11097,-0.878416,0.464834,0.796039,1.533809,-0.075758,
-	0.055595,-0.883651,0.464834,0.83883,1.513897,-0.121212,
-	0.055595,-0.883651,0.464834,0.837333,1.537712,-0.075758,
-	0.055595,-0.883651,0.464834,0.837333,1.537712,-0.075758,
-	0.055595,-0.883651,0.464834,0.83883,1.513897,-0.121212,
-	0,-0.885398,0.464834,0.878788,1.515152,-0.121212,
-	0.055595,-0.883651,0.464834,0.837333,1.537712,-0.075758,
-	0,-0.885398,0.464834,0.878788,1.515152,-0.121212,
-	0,-0.885398,0.464834,0.878788,1.539015,-0.075758,
-	-0.055595,-0.883651,0.464834,0.918745,1.513897,-0.121212,
-	-0.055595,-0.883651,0.464834,0.920242,1.537712,-0.075758,
-	0,-0.885398,0.464834,0.878788,1.539015,-0.075758,
-	-0.055595,-0.883651,0.464834,0.918745,1.513897,-0.121212,
-	0,-0.885398,0.464834,0.878788,1.539015,-0.075758,
-	0,-0.885398,0.464834,0.878788,1.515152,-0.121212,
-	-0.11097,-0.878416,0.464834,0.958545,1.510133,-0.121212,
-	-0.11097,-0.878416,0.464834,0.961536,1.533809,-0.075758,
-	-0.055595,-0.883651,0.464834,0.920242,1.537712,-0.075758,
-	-0.11097,-0.878416,0.464834,0.958545,1.510133,-0.121212,
-	-0.055595,-0.883651,0.464834,0.920242,1.537712,-0.075758,
-	-0.055595,-0.883651,0.464834,0.918745,1.513897,-0.121212,
-	-0.11097,-0.878416,0.464834,0.958545,1.510133,-0.121212,
-	-0.138522,-0.87459,0.464654,0.984161,1.506076,-0.121212,
-	-0.138522,-0.87459,0.464654,0.982542,1.530482,-0.075758,
-	-0.11097,-0.878416,0.464834,0.958545,1.510133,-0.121212,
-	-0.138522,-0.87459,0.464654,0.982542,1.530482,-0.075758,
-	-0.11097,-0.878416,0.464834,0.961536,1.533809,-0.075758,
-	0.917485,-0.335916,0.21303,1,1.549333,-0.121212,
-	0.917485,-0.335916,0.21303,1,1.578161,-0.075758,
-	0.917485,-0.335916,0.21303,0.982542,1.530482,-0.075758,
-	0.917485,-0.335916,0.21303,1,1.549333,-0.121212,
-	0.917485,-0.335916,0.21303,0.982542,1.530482,-0.075758,
-	0.917485,-0.335916,0.21303,0.984161,1.506076,-0.121212,
-	1,0,0,1,1.636364,-0.121212,
-	1,0,0,1,1.636364,-0.208242,
-	1,0,0,1,1.681818,-0.179415,
-	1,0,0,1,1.636364,-0.121212,
-	1,0,0,1,1.681818,-0.179415,
-	1,0,0,1,1.681818,-0.121212,
-	1,0,0,1,1.636364,-0.121212,
-	1,0,0,1,1.681818,-0.121212,
-	1,0,0,1,1.636364,-0.075758,
-	1,0,0,1,1.636364,-0.121212,
-	1,0,0,1,1.636364,-0.075758,
-	1,0,0,1,1.578161,-0.075758,
-	1,0,0,1,1.636364,-0.121212,
-	1,0,0,1,1.578161,-0.075758,
-	1,0,0,1,1.549333,-0.121212,
-	0.917485,0.21303,-0.335916,1,1.681818,-0.179415,
-	0.917485,0.21303,-0.335916,1,1.636364,-0.208242,
-	0.917485,0.21303,-0.335916,0.984161,1.636364,-0.251499,
-	0.917485,0.21303,-0.335916,1,1.681818,-0.179415,
-	0.917485,0.21303,-0.335916,0.984161,1.636364,-0.251499,
-	0.917485,0.21303,-0.335916,0.982542,1.681818,-0.227094,
-	-0.138522,0.464654,-0.87459,0.984161,1.636364,-0.251499,
-	-0.11097,0.464834,-0.878416,0.958545,1.636364,-0.247442,
-	-0.11097,0.464834,-0.878416,0.961536,1.681818,-0.223767,
-	-0.138522,0.464654,-0.87459,0.984161,1.636364,-0.251499,
-	-0.11097,0.464834,-0.878416,0.961536,1.681818,-0.223767,
-	-0.138522,0.464654,-0.87459,0.982542,1.681818,-0.227094,
-	-0.11097,0.464834,-0.878416,0.961536,1.681818,-0.223767,
-	-0.11097,0.464834,-0.878416,0.958545,1.636364,-0.247442,
-	-0.055595,0.464834,-0.883651,0.918745,1.636364,-0.24368,
-	-0.11097,0.464834,-0.878416,0.961536,1.681818,-0.223767,
-	-0.055595,0.464834,-0.883651,0.918745,1.636364,-0.24368,
-	-0.055595,0.464834,-0.883651,0.920242,1.681818,-0.219863,
-	-0.055595,0.464834,-0.883651,0.920242,1.681818,-0.219863,
-	-0.055595,0.464834,-0.883651,0.918745,1.636364,-0.24368,
-	0,0.464834,-0.885398,0.878788,1.636364,-0.242424,
-	-0.055595,0.464834,-0.883651,0.920242,1.681818,-0.219863,
-	0,0.464834,-0.885398,0.878788,1.636364,-0.242424,
-	0,0.464834,-0.885398,0.878788,1.681818,-0.218561,
-	0.055595,0.464834,-0.883651,0.83883,1.636364,-0.24368,
-	0.055595,0.464834,-0.883651,0.837333,1.681818,-0.219863,
-	0,0.464834,-0.885398,0.878788,1.681818,-0.218561,
-	0.055595,0.464834,-0.883651,0.83883,1.636364,-0.24368,
-	0,0.464834,-0.885398,0.878788,1.681818,-0.218561,
-	0,0.464834,-0.885398,0.878788,1.636364,-0.242424,
-	0.11097,0.464834,-0.878416,0.79903,1.636364,-0.247442,
-	0.11097,0.464834,-0.878416,0.796039,1.681818,-0.223767,
-	0.055595,0.464834,-0.883651,0.837333,1.681818,-0.219863,
-	0.11097,0.464834,-0.878416,0.79903,1.636364,-0.247442,
-	0.055595,0.464834,-0.883651,0.837333,1.681818,-0.219863,
-	0.055595,0.464834,-0.883651,0.83883,1.636364,-0.24368,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.878788,1.681818,-0.218561,
-	0,1,0,0.837333,1.681818,-0.219863,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.837333,1.681818,-0.219863,
-	0,1,0,0.796039,1.681818,-0.223767,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.796039,1.681818,-0.223767,
-	0,1,0,0.775033,1.681818,-0.227094,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.775033,1.681818,-0.227094,
-	0,1,0,0.757576,1.681818,-0.179415,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.757576,1.681818,-0.179415,
-	0,1,0,0.757576,1.681818,-0.121212,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.757576,1.681818,-0.121212,
-	0,1,0,1,1.681818,-0.121212,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,1,1.681818,-0.121212,
-	0,1,0,1,1.681818,-0.179415,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,1,1.681818,-0.179415,
-	0,1,0,0.982542,1.681818,-0.227094,
-	0,1,0,0.920242,1.681818,-0.219863,
-	0,1,0,0.982542,1.681818,-0.227094,
-	0,1,0,0.961536,1.681818,-0.223767,
-	0,0.707107,0.707107,0.757576,1.681818,-0.121212,
-	0,0.707107,0.707107,0.757576,1.636364,-0.075758,
-	0,0.707107,0.707107,1,1.636364,-0.075758,
-	0,0.707107,0.707107,0.757576,1.681818,-0.121212,
-	0,0.707107,0.707107,1,1.636364,-0.075758,
-	0,0.707107,0.707107,1,1.681818,-0.121212,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,1,1.636364,-0.075758,
-	0,0,1,0.757576,1.636364,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.757576,1.636364,-0.075758,
-	0,0,1,0.757576,1.578161,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.757576,1.578161,-0.075758,
-	0,0,1,0.775033,1.530482,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.775033,1.530482,-0.075758,
-	0,0,1,0.796039,1.533809,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.796039,1.533809,-0.075758,
-	0,0,1,0.837333,1.537712,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.837333,1.537712,-0.075758,
-	0,0,1,0.878788,1.539015,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.878788,1.539015,-0.075758,
-	0,0,1,0.920242,1.537712,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.920242,1.537712,-0.075758,
-	0,0,1,0.961536,1.533809,-0.075758,
-	0,0,1,1,1.578161,-0.075758,
-	0,0,1,0.961536,1.533809,-0.075758,
-	0,0,1,0.982542,1.530482,-0.075758,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.121212,1.125055,0,
-	0,0,1,0.223833,1.125055,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.223833,1.125055,0,
-	0,0,1,0.227944,1.136476,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.227944,1.136476,0,
-	0,0,1,0.245409,1.176833,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.245409,1.176833,0,
-	0,0,1,0.265373,1.216015,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.265373,1.216015,0,
-	0,0,1,0.287758,1.253867,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.287758,1.253867,0,
-	0,0,1,0.312476,1.290236,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.312476,1.290236,0,
-	0,0,1,0.339427,1.324985,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.339427,1.324985,0,
-	0,0,1,0.368509,1.35797,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.368509,1.35797,0,
-	0,0,1,0.399606,1.389067,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.399606,1.389067,0,
-	0,0,1,0.432591,1.418148,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.432591,1.418148,0,
-	0,0,1,0.467339,1.4451,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.467339,1.4451,0,
-	0,0,1,0.503709,1.469818,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.503709,1.469818,0,
-	0,0,1,0.541561,1.492203,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.541561,1.492203,0,
-	0,0,1,0.580742,1.512167,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.580742,1.512167,0,
-	0,0,1,0.6211,1.52963,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.6211,1.52963,0,
-	0,0,1,0.632521,1.533742,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.632521,1.533742,0,
-	0,0,1,0.632521,1.636364,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.632521,1.636364,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.121212,1.636364,0,
-	0,0,1,0.121212,1.125055,0,
-	0.645427,-0.606097,0.464834,0.4149,1.314409,-0.121212,
-	0.645427,-0.606097,0.464834,0.368509,1.35797,0,
-	0.682211,-0.564374,0.464834,0.339427,1.324985,0,
-	0.645427,-0.606097,0.464834,0.4149,1.314409,-0.121212,
-	0.682211,-0.564374,0.464834,0.339427,1.324985,0,
-	0.682211,-0.564374,0.464834,0.388461,1.284421,-0.121212,
-	0.645427,-0.606097,0.464834,0.368509,1.35797,0,
-	0.645427,-0.606097,0.464834,0.4149,1.314409,-0.121212,
-	0.606097,-0.645427,0.464834,0.443167,1.342676,-0.121212,
-	0.645427,-0.606097,0.464834,0.368509,1.35797,0,
-	0.606097,-0.645427,0.464834,0.443167,1.342676,-0.121212,
-	0.606097,-0.645427,0.464834,0.399606,1.389067,0,
-	0.606097,-0.645427,0.464834,0.399606,1.389067,0,
-	0.606097,-0.645427,0.464834,0.443167,1.342676,-0.121212,
-	0.564374,-0.682211,0.464834,0.473155,1.369115,-0.121212,
-	0.606097,-0.645427,0.464834,0.399606,1.389067,0,
-	0.564374,-0.682211,0.464834,0.473155,1.369115,-0.121212,
-	0.564374,-0.682211,0.464834,0.432591,1.418148,0,
-	0.564374,-0.682211,0.464834,0.432591,1.418148,0,
-	0.564374,-0.682211,0.464834,0.473155,1.369115,-0.121212,
-	0.520424,-0.716302,0.464834,0.504742,1.393618,-0.121212,
-	0.564374,-0.682211,0.464834,0.432591,1.418148,0,
-	0.520424,-0.716302,0.464834,0.504742,1.393618,-0.121212,
-	0.520424,-0.716302,0.464834,0.467339,1.4451,0,
-	0.520424,-0.716302,0.464834,0.467339,1.4451,0,
-	0.520424,-0.716302,0.464834,0.504742,1.393618,-0.121212,
-	0.47442,-0.747566,0.464834,0.537806,1.416088,-0.121212,
-	0.520424,-0.716302,0.464834,0.467339,1.4451,0,
-	0.47442,-0.747566,0.464834,0.537806,1.416088,-0.121212,
-	0.47442,-0.747566,0.464834,0.503709,1.469818,0,
-	0.47442,-0.747566,0.464834,0.503709,1.469818,0,
-	0.47442,-0.747566,0.464834,0.537806,1.416088,-0.121212,
-	0.426544,-0.77588,0.464834,0.572218,1.436436,-0.121212,
-	0.47442,-0.747566,0.464834,0.503709,1.469818,0,
-	0.426544,-0.77588,0.464834,0.572218,1.436436,-0.121212,
-	0.426544,-0.77588,0.464834,0.541561,1.492203,0,
-	0.426544,-0.77588,0.464834,0.541561,1.492203,0,
-	0.426544,-0.77588,0.464834,0.572218,1.436436,-0.121212,
-	0.376984,-0.801132,0.464834,0.607836,1.454588,-0.121212,
-	0.426544,-0.77588,0.464834,0.541561,1.492203,0,
-	0.376984,-0.801132,0.464834,0.607836,1.454588,-0.121212,
-	0.376984,-0.801132,0.464834,0.580742,1.512167,0,
-	0.376984,-0.801132,0.464834,0.580742,1.512167,0,
-	0.376984,-0.801132,0.464834,0.607836,1.454588,-0.121212,
-	0.325937,-0.823222,0.464834,0.644527,1.470464,-0.121212,
-	0.376984,-0.801132,0.464834,0.580742,1.512167,0,
-	0.325937,-0.823222,0.464834,0.644527,1.470464,-0.121212,
-	0.325937,-0.823222,0.464834,0.6211,1.52963,0,
-	0.29995,-0.833143,0.464654,0.632521,1.533742,0,
-	0.325937,-0.823222,0.464834,0.6211,1.52963,0,
-	0.325937,-0.823222,0.464834,0.644527,1.470464,-0.121212,
-	0.29995,-0.833143,0.464654,0.632521,1.533742,0,
-	0.325937,-0.823222,0.464834,0.644527,1.470464,-0.121212,
-	0.273603,-0.842063,0.464834,0.682139,1.484006,-0.121212,
-	0.29995,-0.833143,0.464654,0.632521,1.533742,0,
-	0.273603,-0.842063,0.464834,0.682139,1.484006,-0.121212,
-	0.273603,-0.842063,0.464834,0.67563,1.504045,-0.081077,
-	0.273603,-0.842063,0.464834,0.67563,1.504045,-0.081077,
-	0.273603,-0.842063,0.464834,0.682139,1.484006,-0.121212,
-	0.247044,-0.850333,0.464654,0.69697,1.488315,-0.121212,
-	0.882948,0,0.469472,0.632521,1.636364,0,
-	0.882948,0,0.469472,0.632521,1.533742,0,
-	0.882948,0,0.469472,0.67563,1.504045,-0.081077,
-	0.882948,0,0.469472,0.632521,1.636364,0,
-	0.882948,0,0.469472,0.67563,1.504045,-0.081077,
-	0.882948,0,0.469472,0.69697,1.488315,-0.121212,
-	0.882948,0,0.469472,0.632521,1.636364,0,
-	0.882948,0,0.469472,0.69697,1.488315,-0.121212,
-	0.882948,0,0.469472,0.69697,1.636364,-0.121212,
-	0.799251,0.424969,0.424969,0.69697,1.636364,-0.121212,
-	0.799251,0.424969,0.424969,0.632521,1.757576,-0.121212,
-	0.799251,0.424969,0.424969,0.632521,1.636364,0,
-	0,0.707107,0.707107,0.632521,1.757576,-0.121212,
-	0,0.707107,0.707107,0.121212,1.757576,-0.121212,
-	0,0.707107,0.707107,0.121212,1.636364,0,
-	0,0.707107,0.707107,0.632521,1.757576,-0.121212,
-	0,0.707107,0.707107,0.121212,1.636364,0,
-	0,0.707107,0.707107,0.632521,1.636364,0,
-	-0.57735,0.57735,0.57735,0.121212,1.757576,-0.121212,
-	-0.57735,0.57735,0.57735,0,1.636364,-0.121212,
-	-0.57735,0.57735,0.57735,0.121212,1.636364,0,
-	-0.707107,0,0.707107,0,1.636364,-0.121212,
-	-0.707107,0,0.707107,0,1.125055,-0.121212,
-	-0.707107,0,0.707107,0.121212,1.125055,0,
-	-0.707107,0,0.707107,0,1.636364,-0.121212,
-	-0.707107,0,0.707107,0.121212,1.125055,0,
-	-0.707107,0,0.707107,0.121212,1.636364,0,
-	-0.424969,-0.799251,0.424969,0,1.125055,-0.121212,
-	-0.424969,-0.799251,0.424969,0.121212,1.060606,-0.121212,
-	-0.424969,-0.799251,0.424969,0.121212,1.125055,0,
-	0,-0.882948,0.469472,0.223833,1.125055,0,
-	0,-0.882948,0.469472,0.121212,1.125055,0,
-	0,-0.882948,0.469472,0.121212,1.060606,-0.121212,
-	0,-0.882948,0.469472,0.223833,1.125055,0,
-	0,-0.882948,0.469472,0.121212,1.060606,-0.121212,
-	0,-0.882948,0.469472,0.269262,1.060606,-0.121212,
-	0,-0.882948,0.469472,0.223833,1.125055,0,
-	0,-0.882948,0.469472,0.269262,1.060606,-0.121212,
-	0,-0.882948,0.469472,0.25353,1.081945,-0.081077,
-	0.842063,-0.273603,0.464834,0.27357,1.075436,-0.121212,
-	0.842063,-0.273603,0.464834,0.25353,1.081945,-0.081077,
-	0.850333,-0.247044,0.464654,0.269262,1.060606,-0.121212,
-	0.823222,-0.325937,0.464834,0.227944,1.136476,0,
-	0.833143,-0.29995,0.464654,0.223833,1.125055,0,
-	0.842063,-0.273603,0.464834,0.25353,1.081945,-0.081077,
-	0.823222,-0.325937,0.464834,0.227944,1.136476,0,
-	0.842063,-0.273603,0.464834,0.25353,1.081945,-0.081077,
-	0.842063,-0.273603,0.464834,0.27357,1.075436,-0.121212,
-	0.823222,-0.325937,0.464834,0.227944,1.136476,0,
-	0.842063,-0.273603,0.464834,0.27357,1.075436,-0.121212,
-	0.823222,-0.325937,0.464834,0.287112,1.113048,-0.121212,
-	0.801132,-0.376984,0.464834,0.302989,1.149739,-0.121212,
-	0.801132,-0.376984,0.464834,0.245409,1.176833,0,
-	0.823222,-0.325937,0.464834,0.227944,1.136476,0,
-	0.801132,-0.376984,0.464834,0.302989,1.149739,-0.121212,
-	0.823222,-0.325937,0.464834,0.227944,1.136476,0,
-	0.823222,-0.325937,0.464834,0.287112,1.113048,-0.121212,
-	0.77588,-0.426544,0.464834,0.321139,1.185358,-0.121212,
-	0.77588,-0.426544,0.464834,0.265373,1.216015,0,
-	0.801132,-0.376984,0.464834,0.245409,1.176833,0,
-	0.77588,-0.426544,0.464834,0.321139,1.185358,-0.121212,
-	0.801132,-0.376984,0.464834,0.245409,1.176833,0,
-	0.801132,-0.376984,0.464834,0.302989,1.149739,-0.121212,
-	0.747566,-0.47442,0.464834,0.341488,1.21977,-0.121212,
-	0.747566,-0.47442,0.464834,0.287758,1.253867,0,
-	0.77588,-0.426544,0.464834,0.265373,1.216015,0,
-	0.747566,-0.47442,0.464834,0.341488,1.21977,-0.121212,
-	0.77588,-0.426544,0.464834,0.265373,1.216015,0,
-	0.77588,-0.426544,0.464834,0.321139,1.185358,-0.121212,
-	0.716302,-0.520424,0.464834,0.363958,1.252833,-0.121212,
-	0.716302,-0.520424,0.464834,0.312476,1.290236,0,
-	0.747566,-0.47442,0.464834,0.287758,1.253867,0,
-	0.716302,-0.520424,0.464834,0.363958,1.252833,-0.121212,
-	0.747566,-0.47442,0.464834,0.287758,1.253867,0,
-	0.747566,-0.47442,0.464834,0.341488,1.21977,-0.121212,
-	0.682211,-0.564374,0.464834,0.388461,1.284421,-0.121212,
-	0.682211,-0.564374,0.464834,0.339427,1.324985,0,
-	0.716302,-0.520424,0.464834,0.312476,1.290236,0,
-	0.682211,-0.564374,0.464834,0.388461,1.284421,-0.121212,
-	0.716302,-0.520424,0.464834,0.312476,1.290236,0,
-	0.716302,-0.520424,0.464834,0.363958,1.252833,-0.121212
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,384,data,NULL};
-const struct gllist *companion_quad=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char companion_quad[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\246\000\000\000\200\001\000\000\323\000\000\000"
+ "\000\000\000\077\030]\264\077z\304\000\276\000\001\2007\215L.:\331\340\000"
+ "\000\376E.:\317\337\000\000hF\321E\016\346\000\000\311K\321E\351\346\000"
+ "\000\360A.:\342\352\000\000\360A\321EC\362\000\000hF\321E\016\346\000\000"
+ "\376E.:\317\337\000\000\360A.:\342\352\000\000\360A.:)\001\000\000\360A\347"
+ "#)\001\000\000\360AH+\314\014\000\000\360A.:\314\014\000\000\360A\321E)\001"
+ "\000\000\360A\321EC\362\000\000\360AH+\314\014\000\000\360A\347#)\001\000"
+ "\000\376E\324\030)\001\000\000hF\023\037\314\014\000\000\376E\324\030)\001"
+ "\000\000\215L\336\031)\001\000\000\311K\355\037\314\014\000\000hF\023\037"
+ "\314\014\000\000\275V\324\032)\001\000\000[V\355 \314\014\000\000\367`'\033"
+ ")\001\000\000\367`B!\314\014\000\0002k\324\032)\001\000\000\224k\355 \314"
+ "\014\000\000bu\336\031)\001\000\000&v\355\037\314\014\000\000\361{\324\030"
+ ")\001\000\000\207{\023\037\314\014\000\000\377\177\347#)\001\000\000\377"
+ "\177H+\314\014\000\000\207{\023\037\314\014\000\000\361{\324\030)\001\000"
+ "\000\377\177.:)\001\000\000\377\177.:\342\352\000\000\377\177\321EC\362\000"
+ "\000\377\177\321E)\001\000\000\377\177.:\314\014\000\000\377\177H+\314\014"
+ "\000\000\377\177\347#)\001\000\000\377\177\321EC\362\000\000\377\177.:\342"
+ "\352\000\000\361{.:\317\337\000\000\207{\321E\016\346\000\000\361{.:\317"
+ "\337\000\000bu.:\331\340\000\000&v\321E\351\346\000\000\207{\321E\016\346"
+ "\000\0002k.:\320\341\000\000\224k\321E\350\347\000\000\367`.:\042\342\000"
+ "\000\367`\321E>\350\000\000\275V.:\320\341\000\000[V\321E\350\347\000\000"
+ "\224k\321E\350\347\000\000\367`\321E>\350\000\000[V\321E\350\347\000\000"
+ "\311K\321E\351\346\000\000hF\321E\016\346\000\000\360A\321EC\362\000\000"
+ "\360A\321E)\001\000\000\377\177\321E)\001\000\000\377\177\321EC\362\000\000"
+ "\207{\321E\016\346\000\000&v\321E\351\346\000\000\360A\321E)\001\000\000"
+ "\360A.:\314\014\000\000\377\177.:\314\014\000\000\377\177\321E)\001\000\000"
+ "\377\177H+\314\014\000\000\377\177.:\314\014\000\000\360A.:\314\014\000\000"
+ "\360AH+\314\014\000\000hF\023\037\314\014\000\000\311K\355\037\314\014\000"
+ "\000[V\355 \314\014\000\000\367`B!\314\014\000\000\224k\355 \314\014\000"
+ "\000&v\355\037\314\014\000\000\207{\023\037\314\014\000\000\011\237.:1 \000"
+ "\000\011\237J\2671 \000\000N\271J\2671 \000\000[\2726\2721 \000\000\324\276"
+ "\213\3041 \000\000\360\303\223\3161 \000\000\253\311D\3301 \000\000\377\317"
+ "\223\3411 \000\000\345\326x\3521 \000\000W\336\352\3621 \000\000M\346\340"
+ "\3721 \000\000\276\356R\0021 \000\000\244\3678\0111 \000\000\363\000\214"
+ "\0171 \000\000\244\012G\0251 \000\000\253\024c\0321 \000\000\000\037\333"
+ "\0361 \000\000\355!\351\0371 \000\000\355!.:1 \000\0007\352\303\347)\001"
+ "\000\000W\336\352\3621 \000\000\345\326x\3521 \000\000r\343\026\340)\001"
+ "\000\000t\361\000\357)\001\000\000M\346\340\3721 \000\000!\371\304\365)\001"
+ "\000\000\276\356R\0021 \000\0007\001\012\374)\001\000\000\244\3678\0111 "
+ "\000\000\256\011\313\001)\001\000\000\363\000\214\0171 \000\000}\022\000"
+ "\007)\001\000\000\244\012G\0251 \000\000\233\033\246\013)\001\000\000\253"
+ "\024c\0321 \000\000\377$\266\017)\001\000\000\000\037\333\0361 \000\000\355"
+ "!\351\0371 \000\000\240.-\023)\001\000\000\366,O\030p\013\000\000l2H\024"
+ ")\001\000\000\355!.:1 \000\000\355!\351\0371 \000\000\366,O\030p\013\000"
+ "\000l2H\024)\001\000\000l2.:)\001\000\000l2.:)\001\000\000\355!6Y)\001\000"
+ "\000\355!.:1 \000\000\355!6Y)\001\000\000\011\2376Y)\001\000\000\011\237"
+ ".:1 \000\000\355!.:1 \000\000\011\2376Y)\001\000\000\001\200.:)\001\000\000"
+ "\011\237.:1 \000\000\001\200.:)\001\000\000\001\200J\267)\001\000\000\011"
+ "\237J\2671 \000\000\011\237.:1 \000\000\001\200J\267)\001\000\000\011\237"
+ "\312\246)\001\000\000\011\237J\2671 \000\000N\271J\2671 \000\000\011\237"
+ "J\2671 \000\000\011\237\312\246)\001\000\000\357\304\312\246)\001\000\000"
+ "\350\300A\254p\013\000\000\011\306\226\252)\001\000\000\350\300A\254p\013"
+ "\000\000\357\304\312\246)\001\000\000[\2726\2721 \000\000N\271J\2671 \000"
+ "\000\201\3117\264)\001\000\000\221\315\234\275)\001\000\000\324\276\213\304"
+ "1 \000\0007\322\272\306)\001\000\000\360\303\223\3161 \000\000l\327\211\317"
+ ")\001\000\000\253\311D\3301 \000\000-\335\000\330)\001\000\000\377\317\223"
+ "\3411 \000\000VuWsWsVu\2230\2230\2230\2230\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\261\343\261\343\261\343\261\343\014\265\012\263"
+ "\012\263\014\265\005\260\005\260\000\255\000\255\373\260\373\260\366\263"
+ "\366\263\364\265\364\265O\343O\343O\343O\343\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000m0m0m0m0\251s\252u\252u\251s\253z\253zS\177S"
+ "\177UzUz\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000@\000@\000@\000@\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\0000\323"
+ "0\3233\3263\326-\320-\320*\315*\315'\313'\313$\310$\310 \305 \305\035\302"
+ "\035\302\032\277\032\277\030\276\026\274\026\274\024\273S\000S\000S\000S"
+ "\000S\000>!>!>!\000@\000@\000@\000@\326*\326*\326*\300\000\300\000\300\000"
+ "\300\000\337\302\337\302\337\302\000\255\000\255\000\255\000\255\000\255"
+ "D\352D\352E\354A\346B\350A\346>\343>\343;\340;\3408\3348\3345\3315\331\000"
+ "\000\001\000\002\000\000\000\002\000\003\000\004\000\005\000\006\000\004"
+ "\000\006\000\007\000\010\000\011\000\012\000\010\000\012\000\013\000\010"
+ "\000\013\000\014\000\010\000\014\000\015\000\010\000\015\000\016\000\017"
+ "\000\020\000\021\000\017\000\021\000\022\000\023\000\024\000\025\000\023"
+ "\000\025\000\026\000\025\000\024\000\027\000\025\000\027\000\030\000\030"
+ "\000\027\000\031\000\030\000\031\000\032\000\033\000\034\000\032\000\033"
+ "\000\032\000\031\000\035\000\036\000\034\000\035\000\034\000\033\000\035"
+ "\000\037\000 \000\035\000 \000\036\000!\000\042\000#\000!\000#\000$\000%"
+ "\000&\000'\000%\000'\000(\000%\000(\000)\000%\000)\000*\000%\000*\000+\000"
+ ",\000-\000.\000,\000.\000/\0000\0001\0002\0000\0002\0003\0002\0001\0004\000"
+ "2\0004\0005\0005\0004\0006\0005\0006\0007\0008\0009\0007\0008\0007\0006\000"
+ "\000\000\003\0009\000\000\0009\0008\000:\000;\000<\000:\000<\000=\000:\000"
+ "=\000>\000:\000>\000\077\000:\000\077\000@\000:\000@\000A\000:\000A\000B"
+ "\000:\000B\000C\000:\000C\000D\000E\000F\000G\000E\000G\000H\000I\000J\000"
+ "K\000I\000K\000L\000I\000L\000M\000I\000M\000N\000I\000N\000O\000I\000O\000"
+ "P\000I\000P\000Q\000I\000Q\000R\000I\000R\000S\000T\000U\000V\000T\000V\000"
+ "W\000T\000W\000X\000T\000X\000Y\000T\000Y\000Z\000T\000Z\000[\000T\000[\000"
+ "\134\000T\000\134\000]\000T\000]\000^\000T\000^\000_\000T\000_\000`\000T"
+ "\000`\000a\000T\000a\000b\000T\000b\000c\000T\000c\000d\000T\000d\000e\000"
+ "T\000e\000f\000T\000f\000T\000T\000T\000U\000g\000h\000i\000g\000i\000j\000"
+ "h\000g\000k\000h\000k\000l\000l\000k\000m\000l\000m\000n\000n\000m\000o\000"
+ "n\000o\000p\000p\000o\000q\000p\000q\000r\000r\000q\000s\000r\000s\000t\000"
+ "t\000s\000u\000t\000u\000v\000v\000u\000w\000v\000w\000x\000y\000x\000w\000"
+ "y\000w\000z\000y\000z\000{\000{\000z\000|\000}\000~\000\177\000}\000\177"
+ "\000\200\000}\000\200\000\201\000\202\000\203\000\204\000\205\000\206\000"
+ "\207\000\205\000\207\000\210\000\211\000\212\000\213\000\214\000\215\000"
+ "\216\000\214\000\216\000\217\000\220\000\221\000\222\000\223\000\224\000"
+ "\225\000\223\000\225\000\226\000\223\000\226\000\227\000\230\000\231\000"
+ "\232\000\233\000\234\000\231\000\233\000\231\000\230\000\233\000\230\000"
+ "\235\000\236\000\237\000\233\000\236\000\233\000\235\000\240\000\241\000"
+ "\237\000\240\000\237\000\236\000\242\000\243\000\241\000\242\000\241\000"
+ "\240\000\244\000\245\000\243\000\244\000\243\000\242\000j\000i\000\245\000"
+ "j\000\245\000\244\000\000\000\001\000\001\000\002\000\000\000\002\000\002"
+ "\000\003\000\000\000\003\000\004\000\005\000\002\000\005\000\002\000\004"
+ "\000\001\000\004\000\004\000\011\000\011\000\012\000\004\000\012\000\012"
+ "\000\013\000\004\000\013\000\013\000\014\000\004\000\014\000\014\000\015"
+ "\000\004\000\015\000\005\000\015\000\012\000\021\000\013\000\021\000\021"
+ "\000\022\000\013\000\022\000\021\000\024\000\024\000\025\000\021\000\025"
+ "\000\022\000\025\000\024\000\027\000\025\000\027\000\027\000\030\000\025"
+ "\000\030\000\027\000\031\000\030\000\031\000\031\000\032\000\030\000\032"
+ "\000\033\000\034\000\032\000\034\000\032\000\033\000\031\000\033\000\035"
+ "\000\036\000\034\000\036\000\034\000\035\000\033\000\035\000\035\000\037"
+ "\000\037\000 \000\035\000 \000\036\000 \000!\000\042\000 \000\042\000 \000"
+ "!\000\037\000!\000%\000&\000&\000'\000%\000'\000'\000(\000%\000(\000(\000"
+ ")\000%\000)\000\042\000)\000\042\000%\000!\000%\000&\000.\000'\000.\000."
+ "\000/\000'\000/\000.\0001\0001\0002\000.\0002\000/\0002\0001\0004\0002\000"
+ "4\0004\0005\0002\0005\0004\0006\0005\0006\0006\0007\0005\0007\0008\0009\000"
+ "7\0009\0007\0008\0006\0008\000\003\0009\000\000\0009\000\000\0008\0005\000"
+ "9\000\003\0005\000\002\0005\000\005\0005\000\015\0005\000\015\000(\000(\000"
+ "5\000'\0005\000/\0005\000\014\000)\000\015\000)\000\014\000\042\000\013\000"
+ "\042\000\022\000\042\000\025\000\042\000\030\000\042\000\032\000\042\000"
+ "\034\000\042\000\036\000\042\000T\000U\000U\000V\000T\000V\000V\000W\000"
+ "T\000W\000W\000X\000T\000X\000X\000Y\000T\000Y\000Y\000Z\000T\000Z\000Z\000"
+ "[\000T\000[\000[\000\134\000T\000\134\000\134\000]\000T\000]\000]\000^\000"
+ "T\000^\000^\000_\000T\000_\000_\000`\000T\000`\000`\000a\000T\000a\000a\000"
+ "b\000T\000b\000b\000c\000T\000c\000c\000d\000T\000d\000d\000e\000T\000e\000"
+ "e\000f\000T\000f\000]\000g\000\134\000g\000\134\000j\000g\000j\000g\000k"
+ "\000]\000k\000^\000k\000k\000m\000^\000m\000_\000m\000m\000o\000_\000o\000"
+ "`\000o\000o\000q\000`\000q\000a\000q\000q\000s\000a\000s\000b\000s\000s\000"
+ "u\000b\000u\000c\000u\000u\000w\000c\000w\000d\000w\000e\000w\000w\000z\000"
+ "e\000z\000z\000{\000e\000{\000z\000|\000{\000|\000f\000{\000f\000|\000|\000"
+ "\201\000f\000\201\000\201\000\203\000f\000\203\000\203\000\206\000T\000\206"
+ "\000T\000\203\000\206\000\212\000T\000\212\000\212\000\215\000U\000\215\000"
+ "U\000\212\000\215\000\221\000U\000\221\000V\000\221\000\221\000\226\000V"
+ "\000\226\000\226\000\227\000V\000\227\000\227\000\230\000\226\000\230\000"
+ "W\000\227\000W\000\230\000\230\000\235\000W\000\235\000X\000\236\000W\000"
+ "\236\000\235\000\236\000Y\000\240\000X\000\240\000\236\000\240\000Z\000\242"
+ "\000Y\000\242\000\240\000\242\000[\000\244\000Z\000\244\000\242\000\244\000"
+ "[\000j\000j\000\244\000"
+;
+const unsigned long companion_quad_size = 3352;
@@ -1,341 +1,116 @@
+/* Generated from "cow_face.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.133638,0.26732,-0.954296,4.925394,1.955229,-0.618837,
-	0.555353,0.50765,-0.658692,4.953739,1.95258,-0.592256,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.555353,0.50765,-0.658692,4.953739,1.95258,-0.592256,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.774925,-0.116115,-0.621296,4.953403,1.907939,-0.605609,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.774925,-0.116115,-0.621296,4.953403,1.907939,-0.605609,
-	0.546619,0.025491,-0.836994,4.925499,1.917814,-0.613413,
-	0.872792,-0.115436,-0.474246,4.973133,1.992779,-0.533466,
-	0.412833,-0.156453,-0.897269,5.001903,1.914398,-0.486724,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.872792,-0.115436,-0.474246,4.973133,1.992779,-0.533466,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.555353,0.50765,-0.658692,4.953739,1.95258,-0.592256,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.412833,-0.156453,-0.897269,5.001903,1.914398,-0.486724,
-	0.108828,-0.182644,-0.977137,4.982364,1.8733,-0.53619,
-	0.823157,0.134624,-0.551625,4.971872,1.924079,-0.586026,
-	0.108828,-0.182644,-0.977137,4.982364,1.8733,-0.53619,
-	0.774925,-0.116115,-0.621296,4.953403,1.907939,-0.605609,
-	0.774925,-0.116115,-0.621296,4.953403,1.907939,-0.605609,
-	0.108828,-0.182644,-0.977137,4.982364,1.8733,-0.53619,
-	0.746476,-0.187741,-0.638379,4.926194,1.859813,-0.582137,
-	0.546619,0.025491,-0.836994,4.925499,1.917814,-0.613413,
-	0.774925,-0.116115,-0.621296,4.953403,1.907939,-0.605609,
-	0.746476,-0.187741,-0.638379,4.926194,1.859813,-0.582137,
-	0.546619,0.025491,-0.836994,4.925499,1.917814,-0.613413,
-	0.746476,-0.187741,-0.638379,4.926194,1.859813,-0.582137,
-	0.897742,-0.15037,-0.414063,4.852578,1.889721,-0.605031,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.546619,0.025491,-0.836994,4.925499,1.917814,-0.613413,
-	0.897742,-0.15037,-0.414063,4.852578,1.889721,-0.605031,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.897742,-0.15037,-0.414063,4.852578,1.889721,-0.605031,
-	0.544735,0.449335,-0.708069,4.824747,1.946835,-0.626358,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.544735,0.449335,-0.708069,4.824747,1.946835,-0.626358,
-	0.721999,0.398917,-0.565316,4.861611,2.001639,-0.621913,
-	0.711192,0.127662,-0.69131,4.935561,2.016016,-0.5857,
-	0.872792,-0.115436,-0.474246,4.973133,1.992779,-0.533466,
-	0.555353,0.50765,-0.658692,4.953739,1.95258,-0.592256,
-	0.711192,0.127662,-0.69131,4.935561,2.016016,-0.5857,
-	0.555353,0.50765,-0.658692,4.953739,1.95258,-0.592256,
-	0.133638,0.26732,-0.954296,4.925394,1.955229,-0.618837,
-	0.909103,0.416568,-0.001454,5.908782,1.066916,0.001121,
-	0.535268,0.844682,0.000171,5.871947,1.021428,0.001102,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	0.909103,0.416568,-0.001454,5.908782,1.066916,0.001121,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	0.054456,-0.320459,-0.945696,5.934596,1.054796,-0.077039,
-	0.054456,-0.320459,-0.945696,5.934596,1.054796,-0.077039,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	0.054456,-0.320459,-0.945696,5.934596,1.054796,-0.077039,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	0.169576,-0.140705,-0.975421,5.923808,1.025283,-0.153084,
-	0.169576,-0.140705,-0.975421,5.923808,1.025283,-0.153084,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	0.169576,-0.140705,-0.975421,5.923808,1.025283,-0.153084,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	0.120494,-0.516376,-0.847843,5.85775,0.997026,-0.236768,
-	0.396941,-0.593504,-0.700137,5.755282,1.004149,-0.307505,
-	0.120494,-0.516376,-0.847843,5.85775,0.997026,-0.236768,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	0.396941,-0.593504,-0.700137,5.755282,1.004149,-0.307505,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	0.485455,-0.874253,0.003847,5.895899,1.18273,-0.164705,
-	0.223936,-0.919046,-0.324355,5.959462,1.157227,-0.187097,
-	0.051115,-0.906355,-0.419414,5.912147,1.117911,-0.254197,
-	0.035706,-0.99787,-0.054588,5.849792,1.19348,-0.181047,
-	0.485455,-0.874253,0.003847,5.895899,1.18273,-0.164705,
-	0.051115,-0.906355,-0.419414,5.912147,1.117911,-0.254197,
-	0.035706,-0.99787,-0.054588,5.849792,1.19348,-0.181047,
-	0.051115,-0.906355,-0.419414,5.912147,1.117911,-0.254197,
-	0.161367,-0.802085,-0.574996,5.837875,1.141493,-0.305184,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.064626,-0.99783,0.012619,5.840665,1.221942,-0.187128,
-	0.218068,-0.756332,-0.616772,5.77341,1.225861,-0.323025,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.218068,-0.756332,-0.616772,5.77341,1.225861,-0.323025,
-	0.725751,-0.657941,-0.200998,5.764774,1.279824,-0.308562,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.725751,-0.657941,-0.200998,5.764774,1.279824,-0.308562,
-	0.188634,-0.17518,-0.966297,5.783731,1.341471,-0.28459,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.188634,-0.17518,-0.966297,5.783731,1.341471,-0.28459,
-	0.244568,-0.04472,-0.9686,5.847989,1.311569,-0.261476,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.244568,-0.04472,-0.9686,5.847989,1.311569,-0.261476,
-	0.193495,-0.385604,-0.902147,5.931474,1.233483,-0.215613,
-	-0.034221,-0.995012,-0.093703,5.803425,1.260787,-0.210002,
-	0.193495,-0.385604,-0.902147,5.931474,1.233483,-0.215613,
-	0.064626,-0.99783,0.012619,5.840665,1.221942,-0.187128,
-	0.064626,-0.99783,0.012619,5.840665,1.221942,-0.187128,
-	0.193495,-0.385604,-0.902147,5.931474,1.233483,-0.215613,
-	0.035706,-0.99787,-0.054588,5.849792,1.19348,-0.181047,
-	0.193495,-0.385604,-0.902147,5.931474,1.233483,-0.215613,
-	-0.026148,0.006311,-0.999638,5.998088,1.231874,-0.107334,
-	0.485455,-0.874253,0.003847,5.895899,1.18273,-0.164705,
-	0.193495,-0.385604,-0.902147,5.931474,1.233483,-0.215613,
-	0.485455,-0.874253,0.003847,5.895899,1.18273,-0.164705,
-	0.035706,-0.99787,-0.054588,5.849792,1.19348,-0.181047,
-	0.173726,-0.983856,0.042973,5.672385,1.007694,-0.341778,
-	0.396941,-0.593504,-0.700137,5.755282,1.004149,-0.307505,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	0.173726,-0.983856,0.042973,5.672385,1.007694,-0.341778,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	0.148862,-0.934725,-0.322692,5.580727,0.99933,-0.349867,
-	0.173726,-0.983856,0.042973,5.672385,1.007694,-0.341778,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	0.148862,-0.934725,-0.322692,5.580727,0.99933,-0.349867,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	0.241652,-0.897637,-0.368581,5.535184,0.98018,-0.341257,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	-0.045194,-0.595739,-0.801906,5.638369,0.904402,-0.222548,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	-0.045194,-0.595739,-0.801906,5.638369,0.904402,-0.222548,
-	-0.016623,-0.697515,-0.716378,5.546347,0.916044,-0.246782,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	-0.105003,-0.636187,-0.764356,5.748613,0.92049,-0.205099,
-	0.204472,-0.587725,-0.782797,5.674999,0.950754,-0.22796,
-	-0.105003,-0.636187,-0.764356,5.748613,0.92049,-0.205099,
-	-0.045194,-0.595739,-0.801906,5.638369,0.904402,-0.222548,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	-0.106359,-0.394397,-0.912764,5.851404,0.929008,-0.105362,
-	-0.105003,-0.636187,-0.764356,5.748613,0.92049,-0.205099,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	-0.105003,-0.636187,-0.764356,5.748613,0.92049,-0.205099,
-	0.256335,-0.2349,-0.937611,5.757506,0.9579,-0.210732,
-	0.535268,0.844682,0.000171,5.871947,1.021428,0.001102,
-	0.997356,-0.072614,-0.002907,5.836005,0.945722,0.001092,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	0.997356,-0.072614,-0.002907,5.836005,0.945722,0.001092,
-	-0.106359,-0.394397,-0.912764,5.851404,0.929008,-0.105362,
-	-0.091049,-0.145989,-0.985087,5.897758,1.009309,-0.080583,
-	-0.106359,-0.394397,-0.912764,5.851404,0.929008,-0.105362,
-	-0.126433,-0.433465,-0.892257,5.87863,0.986485,-0.128292,
-	-0.026148,0.006311,-0.999638,5.998088,1.231874,-0.107334,
-	0.223936,-0.919046,-0.324355,5.959462,1.157227,-0.187097,
-	0.485455,-0.874253,0.003847,5.895899,1.18273,-0.164705,
-	0.161367,-0.802085,-0.574996,5.837875,1.141493,-0.305184,
-	0.218068,-0.756332,-0.616772,5.77341,1.225861,-0.323025,
-	0.064626,-0.99783,0.012619,5.840665,1.221942,-0.187128,
-	0.161367,-0.802085,-0.574996,5.837875,1.141493,-0.305184,
-	0.064626,-0.99783,0.012619,5.840665,1.221942,-0.187128,
-	0.035706,-0.99787,-0.054588,5.849792,1.19348,-0.181047,
-	0.241652,-0.897637,-0.368581,5.535184,0.98018,-0.341257,
-	-0.007021,-0.990239,-0.139206,5.573803,0.952578,-0.243886,
-	-0.016623,-0.697515,-0.716378,5.546347,0.916044,-0.246782,
-	0.241652,-0.897637,-0.368581,5.535184,0.98018,-0.341257,
-	-0.016623,-0.697515,-0.716378,5.546347,0.916044,-0.246782,
-	0.241049,-0.626018,-0.741618,5.480649,0.941387,-0.316248,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.721999,0.398917,-0.565316,4.861611,2.001639,-0.621913,
-	0.711192,0.127662,-0.69131,4.935561,2.016016,-0.5857,
-	0.193291,-0.074799,-0.978286,4.897808,1.946794,-0.628057,
-	0.711192,0.127662,-0.69131,4.935561,2.016016,-0.5857,
-	0.133638,0.26732,-0.954296,4.925394,1.955229,-0.618837,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.444094,0.036127,0.895251,4.971872,1.924079,0.586026,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.444094,0.036127,0.895251,4.971872,1.924079,0.586026,
-	0.328548,0.219459,0.918637,4.953739,1.95258,0.592256,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.328548,0.219459,0.918637,4.953739,1.95258,0.592256,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.561013,0.750789,0.348684,4.897808,1.946794,0.628057,
-	0.328548,0.219459,0.918637,4.953739,1.95258,0.592256,
-	0.444094,0.036127,0.895251,4.971872,1.924079,0.586026,
-	0.380651,0.443224,0.811577,5.001903,1.914398,0.486724,
-	0.328548,0.219459,0.918637,4.953739,1.95258,0.592256,
-	0.380651,0.443224,0.811577,5.001903,1.914398,0.486724,
-	0.282492,0.026081,0.958915,4.973133,1.992779,0.533466,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.362705,0.428702,0.827442,4.982364,1.8733,0.53619,
-	0.380651,0.443224,0.811577,5.001903,1.914398,0.486724,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.380651,0.443224,0.811577,5.001903,1.914398,0.486724,
-	0.444094,0.036127,0.895251,4.971872,1.924079,0.586026,
-	0.332757,0.286207,0.898531,4.926194,1.859813,0.582137,
-	0.362705,0.428702,0.827442,4.982364,1.8733,0.53619,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.302716,0.058971,0.951255,4.852578,1.889721,0.605031,
-	0.332757,0.286207,0.898531,4.926194,1.859813,0.582137,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.302716,0.058971,0.951255,4.852578,1.889721,0.605031,
-	0.458202,0.052175,0.887316,4.953403,1.907939,0.605609,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.347794,0.132396,0.928176,4.824747,1.946835,0.626358,
-	0.302716,0.058971,0.951255,4.852578,1.889721,0.605031,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.347794,0.132396,0.928176,4.824747,1.946835,0.626358,
-	0.347878,0.028988,0.937092,4.925499,1.917814,0.613413,
-	0.561013,0.750789,0.348684,4.897808,1.946794,0.628057,
-	0.36359,0.089346,0.927264,4.861611,2.001639,0.621913,
-	0.347794,0.132396,0.928176,4.824747,1.946835,0.626358,
-	0.561013,0.750789,0.348684,4.897808,1.946794,0.628057,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.328548,0.219459,0.918637,4.953739,1.95258,0.592256,
-	0.282492,0.026081,0.958915,4.973133,1.992779,0.533466,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.282492,0.026081,0.958915,4.973133,1.992779,0.533466,
-	0.361081,-0.056526,0.93082,4.935561,2.016016,0.5857,
-	0.800967,0.453079,-0.391371,5.934596,1.054796,0.077039,
-	0.054059,0.926072,-0.373455,5.897758,1.009309,0.080583,
-	0.535268,0.844682,0.000171,5.871947,1.021428,0.001102,
-	0.800967,0.453079,-0.391371,5.934596,1.054796,0.077039,
-	0.535268,0.844682,0.000171,5.871947,1.021428,0.001102,
-	0.909103,0.416568,-0.001454,5.908782,1.066916,0.001121,
-	0.693689,0.317887,-0.646331,5.923808,1.025283,0.153084,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	0.054059,0.926072,-0.373455,5.897758,1.009309,0.080583,
-	0.693689,0.317887,-0.646331,5.923808,1.025283,0.153084,
-	0.054059,0.926072,-0.373455,5.897758,1.009309,0.080583,
-	0.800967,0.453079,-0.391371,5.934596,1.054796,0.077039,
-	-0.051423,0.948155,-0.31362,5.85775,0.997026,0.236768,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	-0.051423,0.948155,-0.31362,5.85775,0.997026,0.236768,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	0.693689,0.317887,-0.646331,5.923808,1.025283,0.153084,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	-0.051423,0.948155,-0.31362,5.85775,0.997026,0.236768,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	-0.051423,0.948155,-0.31362,5.85775,0.997026,0.236768,
-	0.104327,0.725166,-0.680625,5.755282,1.004149,0.307505,
-	0.811896,0.498733,0.303464,5.912147,1.117911,0.254197,
-	0.969409,0.243854,0.027951,5.959462,1.157227,0.187097,
-	0.169215,-0.167065,-0.971317,5.895899,1.18273,0.164705,
-	0.603382,-0.138832,-0.785275,5.837875,1.141493,0.305184,
-	0.811896,0.498733,0.303464,5.912147,1.117911,0.254197,
-	0.169215,-0.167065,-0.971317,5.895899,1.18273,0.164705,
-	0.603382,-0.138832,-0.785275,5.837875,1.141493,0.305184,
-	0.169215,-0.167065,-0.971317,5.895899,1.18273,0.164705,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	0.104604,0.236958,-0.965872,5.764774,1.279824,0.308562,
-	0.335985,-0.093512,-0.937214,5.77341,1.225861,0.323025,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	0.104604,0.236958,-0.965872,5.764774,1.279824,0.308562,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	-0.026478,0.945923,-0.323309,5.803425,1.260787,0.210002,
-	-0.0511,0.977083,-0.206633,5.783731,1.341471,0.28459,
-	0.104604,0.236958,-0.965872,5.764774,1.279824,0.308562,
-	-0.026478,0.945923,-0.323309,5.803425,1.260787,0.210002,
-	0.481644,0.842268,-0.242082,5.847989,1.311569,0.261476,
-	-0.0511,0.977083,-0.206633,5.783731,1.341471,0.28459,
-	-0.026478,0.945923,-0.323309,5.803425,1.260787,0.210002,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	0.794567,0.588129,-0.15089,5.931474,1.233483,0.215613,
-	0.481644,0.842268,-0.242082,5.847989,1.311569,0.261476,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	0.481644,0.842268,-0.242082,5.847989,1.311569,0.261476,
-	-0.026478,0.945923,-0.323309,5.803425,1.260787,0.210002,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	0.794567,0.588129,-0.15089,5.931474,1.233483,0.215613,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	0.169215,-0.167065,-0.971317,5.895899,1.18273,0.164705,
-	0.04154,0.947538,-0.316933,5.998088,1.231874,0.107334,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	0.04154,0.947538,-0.316933,5.998088,1.231874,0.107334,
-	0.794567,0.588129,-0.15089,5.931474,1.233483,0.215613,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	0.104327,0.725166,-0.680625,5.755282,1.004149,0.307505,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	0.104327,0.725166,-0.680625,5.755282,1.004149,0.307505,
-	-0.011269,-0.268801,-0.96313,5.672385,1.007694,0.341778,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	-0.011269,-0.268801,-0.96313,5.672385,1.007694,0.341778,
-	-0.01139,0.953897,-0.299918,5.580727,0.99933,0.349867,
-	-0.151742,0.274295,-0.949598,5.535184,0.98018,0.341257,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	-0.01139,0.953897,-0.299918,5.580727,0.99933,0.349867,
-	0.176955,-0.903058,0.391373,5.546347,0.916044,0.246782,
-	0.571342,-0.680689,-0.45851,5.638369,0.904402,0.222548,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	0.176955,-0.903058,0.391373,5.546347,0.916044,0.246782,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	0.571342,-0.680689,-0.45851,5.638369,0.904402,0.222548,
-	0.388502,-0.6643,-0.63857,5.748613,0.92049,0.205099,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	0.571342,-0.680689,-0.45851,5.638369,0.904402,0.222548,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	0.850248,-0.122854,-0.511845,5.674999,0.950754,0.22796,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	0.388502,-0.6643,-0.63857,5.748613,0.92049,0.205099,
-	0.20994,-0.930128,0.301309,5.851404,0.929008,0.105362,
-	0.971427,0.045661,-0.232906,5.757506,0.9579,0.210732,
-	0.20994,-0.930128,0.301309,5.851404,0.929008,0.105362,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	0.054059,0.926072,-0.373455,5.897758,1.009309,0.080583,
-	0.997356,-0.072614,-0.002907,5.836005,0.945722,0.001092,
-	0.535268,0.844682,0.000171,5.871947,1.021428,0.001102,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	0.20994,-0.930128,0.301309,5.851404,0.929008,0.105362,
-	0.997356,-0.072614,-0.002907,5.836005,0.945722,0.001092,
-	0.329366,0.742755,-0.582952,5.87863,0.986485,0.128292,
-	0.997356,-0.072614,-0.002907,5.836005,0.945722,0.001092,
-	0.054059,0.926072,-0.373455,5.897758,1.009309,0.080583,
-	0.169215,-0.167065,-0.971317,5.895899,1.18273,0.164705,
-	0.969409,0.243854,0.027951,5.959462,1.157227,0.187097,
-	0.04154,0.947538,-0.316933,5.998088,1.231874,0.107334,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	-0.071389,0.260053,-0.962952,5.840665,1.221942,0.187128,
-	0.335985,-0.093512,-0.937214,5.77341,1.225861,0.323025,
-	0.054838,0.68532,-0.726174,5.849792,1.19348,0.181047,
-	0.335985,-0.093512,-0.937214,5.77341,1.225861,0.323025,
-	0.603382,-0.138832,-0.785275,5.837875,1.141493,0.305184,
-	0.083641,-0.81989,0.566378,5.480649,0.941387,0.316248,
-	0.176955,-0.903058,0.391373,5.546347,0.916044,0.246782,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	0.083641,-0.81989,0.566378,5.480649,0.941387,0.316248,
-	-0.03479,0.696668,-0.716549,5.573803,0.952578,0.243886,
-	-0.151742,0.274295,-0.949598,5.535184,0.98018,0.341257,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.361081,-0.056526,0.93082,4.935561,2.016016,0.5857,
-	0.36359,0.089346,0.927264,4.861611,2.001639,0.621913,
-	0.719268,0.159442,0.676189,4.925394,1.955229,0.618837,
-	0.36359,0.089346,0.927264,4.861611,2.001639,0.621913,
-	0.561013,0.750789,0.348684,4.897808,1.946794,0.628057
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,336,data,NULL};
-const struct gllist *cow_face=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char cow_face[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000[\000\000\000P\001\000\000\306\000\000\000U*\255"
+ "@!\350\272\077\000\000\000\000\232\311\2407T\227*c\001\200\000\000\363\234"
+ "\342d\342\201\000\000\272\242XdM\207\000\000l\246\211^\222\210\000\000\250"
+ "\242\077[\224\204\000\000\371\234B]\375\202\000\000\256\246\211lH\223\000"
+ "\000\213\254\220\134\317\234\000\000\217\2500T\272\222\000\000\035\235pQ"
+ "]\211\000\000\034\216\211W\262\204\000\000p\210,cZ\200\000\000\363\217Wn"
+ "B\201\000\000\006\237Fq\243\210\000\000]e\331\257:\000\000\000\333]\224\246"
+ "9\000\000\000\035c\034\244\224\357\000\000\237ja\255M\360\000\0007_u\237"
+ "\333\345\000\000lh]\247\315\340\000\000\210F\242\231\016\325\000\000\366"
+ "Z\233\241\277\317\000\000\024F\016\243U\301\000\000\2705-\230\213\321\000"
+ "\000\274bs\307o\336\000\000\261oA\302\337\331\000\000\014f>\2722\314\000"
+ "\000WY\244\311\032\333\000\000\351V\014\277\316\301\000\000\344O\134\327"
+ "4\325\000\000{Wq\317\335\331\000\000\306I>\320+\276\000\000\003H=\333\036"
+ "\301\000\000\340K\315\347\000\306\000\000\371X\265\341\266\312\000\000\374"
+ "i\313\321\017\324\000\000\220ww\321 \352\000\000/5\307\243Y\272\000\000\030"
+ "!\214\230L\316\000\000\201\042\023\242\263\270\000\0009\031,\236t\272\000"
+ "\000A.\272\216\245\322\000\000\200\033\032\221\265\315\000\000\270D\002\222"
+ "4\326\000\000\253Y\276\223\207\352\000\000\210V&\2279\000\000\000\034\016"
+ "D\226\215\277\000\000\371\234B]\003}\000\000\250\242\077[l{\000\000l\246"
+ "\211^nw\000\000\272\242Xd\263x\000\000\363\234\342d\036~\000\000T\227*c\377"
+ "\177\000\000\213\254\220\1341c\000\000\256\246\211l\270l\000\000\217\250"
+ "0TFm\000\000\035\235pQ\243v\000\000\034\216\211WN{\000\000p\210,c\246\177"
+ "\000\000\363\217Wn\276~\000\000\006\237Fq]w\000\000\237ja\255\263\017\000"
+ "\000\035c\034\244l\020\000\000lh]\2473\037\000\0007_u\237%\032\000\000\366"
+ "Z\233\241A0\000\000\210F\242\231\362*\000\000\2705-\230u.\000\000\024F\016"
+ "\243\253>\000\000\014f>\272\3163\000\000\261oA\302!&\000\000\274bs\307\221"
+ "!\000\000\351V\014\2772>\000\000WY\244\311\346$\000\000\003H=\333\342>\000"
+ "\000\306I>\320\325A\000\000{Wq\317#&\000\000\344O\134\327\314*\000\000\340"
+ "K\315\347\000:\000\000\371X\265\341J5\000\000\374i\313\321\361+\000\000\220"
+ "ww\321\340\025\000\000\030!\214\230\2641\000\000/5\307\243\247E\000\000\201"
+ "\042\023\242MG\000\0009\031,\236\214E\000\000\200\033\032\221K2\000\000A"
+ ".\272\216[-\000\000\270D\002\222\314)\000\000\253Y\276\223y\025\000\000\034"
+ "\016D\226s@\000\000w\225frZVt:u\302}Nu\315q\245m\214p\275r\317]VaItDW(1N"
+ "\220\212`\206\247\214q\222j\230S\213R\237P\221-\257/\224+\206\013\205=\216"
+ "\362\205\010\212C\222J\273n\223z\232^\222\202|\022\230\360\202+\2163\225"
+ "\265\205\277\202\267\212\244\213v\367N\224\042\003*\005)\003\034\023;\015"
+ "+9\036\042\034\003\034\042\034\030\035\006\037\014!\010\042\373\134A(zgJ"
+ "Ff\335zz\034t\312Bv@'c\031o\221s\263Dzhuv\240\233x\336|\345z;XN=#{\276|\234"
+ "\202\341~\232q\017\262L\253M\236\022\256\007\271\000\000\000\000\001\000"
+ "\002\000\000\000\002\000\003\000\000\000\003\000\004\000\000\000\004\000"
+ "\005\000\006\000\007\000\003\000\006\000\003\000\002\000\003\000\007\000"
+ "\010\000\003\000\010\000\004\000\004\000\010\000\011\000\005\000\004\000"
+ "\011\000\005\000\011\000\012\000\000\000\005\000\012\000\000\000\012\000"
+ "\013\000\000\000\013\000\014\000\015\000\006\000\002\000\015\000\002\000"
+ "\001\000\016\000\017\000\020\000\016\000\020\000\021\000\021\000\020\000"
+ "\022\000\021\000\022\000\023\000\023\000\022\000\024\000\023\000\024\000"
+ "\025\000\026\000\025\000\024\000\026\000\024\000\027\000\030\000\031\000"
+ "\032\000\033\000\030\000\032\000\033\000\032\000\034\000\035\000\036\000"
+ "\037\000\035\000\037\000 \000\035\000 \000!\000\035\000!\000\042\000\035"
+ "\000\042\000#\000\035\000#\000\036\000\036\000#\000\033\000#\000$\000\030"
+ "\000#\000\030\000\033\000%\000\026\000\027\000%\000\027\000&\000'\000%\000"
+ "&\000'\000&\000(\000&\000\027\000)\000&\000)\000*\000\027\000\024\000+\000"
+ "\027\000+\000)\000\022\000,\000+\000\022\000+\000\024\000\017\000-\000\020"
+ "\000\020\000-\000,\000\020\000,\000\022\000$\000\031\000\030\000\034\000"
+ "\037\000\036\000\034\000\036\000\033\000(\000&\000*\000(\000*\000.\000\000"
+ "\000\014\000\015\000\000\000\015\000\001\000/\0000\0001\000/\0001\0002\000"
+ "/\0002\0003\000/\0003\0004\0002\0001\0005\0002\0005\0006\0000\0007\0005\000"
+ "0\0005\0001\0008\0007\0000\0009\0008\0000\0009\0000\000/\000:\0009\000/\000"
+ ":\000/\0004\000;\000:\0004\0003\0002\0006\0003\0006\000<\000=\000>\000\017"
+ "\000=\000\017\000\016\000\077\000@\000>\000\077\000>\000=\000A\000B\000@"
+ "\000A\000@\000\077\000C\000B\000A\000C\000A\000D\000E\000F\000G\000H\000"
+ "E\000G\000H\000G\000I\000J\000K\000L\000J\000L\000M\000N\000J\000M\000O\000"
+ "N\000M\000L\000P\000O\000L\000O\000M\000I\000P\000L\000I\000G\000Q\000I\000"
+ "Q\000P\000R\000C\000D\000R\000D\000S\000R\000S\000T\000U\000R\000T\000V\000"
+ "W\000C\000V\000C\000R\000W\000X\000B\000W\000B\000C\000B\000X\000Y\000B\000"
+ "Y\000@\000>\000-\000\017\000@\000Y\000-\000@\000-\000>\000G\000F\000Q\000"
+ "I\000L\000K\000I\000K\000H\000Z\000V\000R\000Z\000R\000U\0003\000<\000;\000"
+ "3\000;\0004\000\000\000\001\000\001\000\002\000\000\000\002\000\002\000\003"
+ "\000\000\000\003\000\003\000\004\000\000\000\004\000\004\000\005\000\000"
+ "\000\005\000\006\000\007\000\003\000\007\000\003\000\006\000\002\000\006"
+ "\000\007\000\010\000\003\000\010\000\004\000\010\000\010\000\011\000\004"
+ "\000\011\000\005\000\011\000\011\000\012\000\005\000\012\000\000\000\012"
+ "\000\012\000\013\000\000\000\013\000\013\000\014\000\000\000\014\000\006"
+ "\000\015\000\002\000\015\000\001\000\015\000\016\000\017\000\017\000\020"
+ "\000\016\000\020\000\020\000\021\000\016\000\021\000\020\000\022\000\021"
+ "\000\022\000\022\000\023\000\021\000\023\000\022\000\024\000\023\000\024"
+ "\000\024\000\025\000\023\000\025\000\025\000\026\000\024\000\026\000\024"
+ "\000\027\000\026\000\027\000\030\000\031\000\031\000\032\000\030\000\032"
+ "\000\030\000\033\000\032\000\033\000\032\000\034\000\033\000\034\000\035"
+ "\000\036\000\036\000\037\000\035\000\037\000\037\000 \000\035\000 \000 \000"
+ "!\000\035\000!\000!\000\042\000\035\000\042\000\042\000#\000\035\000#\000"
+ "\036\000#\000\033\000#\000\033\000\036\000#\000$\000\030\000$\000\030\000"
+ "#\000\026\000%\000\027\000%\000\027\000&\000%\000&\000%\000'\000&\000'\000"
+ "&\000(\000'\000(\000\027\000)\000&\000)\000)\000*\000&\000*\000\024\000+"
+ "\000\027\000+\000)\000+\000\022\000,\000+\000,\000\022\000+\000\017\000-"
+ "\000\020\000-\000,\000-\000\020\000,\000\031\000$\000\034\000\037\000\034"
+ "\000\036\000(\000*\000*\000.\000(\000.\000\014\000\015\000\000\000\015\000"
+ "/\0000\0000\0001\000/\0001\0001\0002\000/\0002\0002\0003\000/\0003\0003\000"
+ "4\000/\0004\0001\0005\0002\0005\0005\0006\0002\0006\0000\0007\0005\0007\000"
+ "0\0005\0007\0008\0000\0008\0008\0009\0000\0009\000/\0009\0009\000:\000/\000"
+ ":\0004\000:\000:\000;\0004\000;\0003\0006\0006\000<\0003\000<\000=\000>\000"
+ "\017\000>\000\017\000=\000\016\000=\000\077\000@\000>\000@\000>\000\077\000"
+ "=\000\077\000A\000B\000@\000B\000@\000A\000\077\000A\000B\000C\000A\000C"
+ "\000A\000D\000C\000D\000E\000F\000F\000G\000E\000G\000E\000H\000G\000H\000"
+ "G\000I\000H\000I\000J\000K\000K\000L\000J\000L\000L\000M\000J\000M\000J\000"
+ "N\000M\000N\000N\000O\000M\000O\000L\000P\000O\000P\000L\000O\000I\000P\000"
+ "I\000L\000G\000Q\000I\000Q\000P\000Q\000C\000R\000D\000R\000D\000S\000R\000"
+ "S\000S\000T\000R\000T\000R\000U\000T\000U\000V\000W\000C\000W\000C\000V\000"
+ "R\000V\000W\000X\000B\000X\000B\000W\000X\000Y\000B\000Y\000@\000Y\000-\000"
+ ">\000-\000Y\000-\000@\000F\000Q\000I\000K\000H\000K\000V\000Z\000R\000Z\000"
+ "U\000Z\000;\000<\0003\000;\000"
+;
+const unsigned long cow_face_size = 2456;
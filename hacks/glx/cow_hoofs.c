@@ -1,1037 +1,292 @@
+/* Generated from "cow_hoofs.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	0.457854,0.537523,-0.708123,2.343303,-3.507846,-1.195262,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	0.457854,0.537523,-0.708123,2.343303,-3.507846,-1.195262,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	0.444124,0.617475,-0.649214,2.025468,-3.556842,-1.204841,
-	0.010538,0.399391,-0.91672,1.981186,-3.441282,-1.180532,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	0.010538,0.399391,-0.91672,1.981186,-3.441282,-1.180532,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	0.010538,0.399391,-0.91672,1.981186,-3.441282,-1.180532,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.339699,0.626415,-0.701576,2.138771,-3.397683,-1.214726,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.157806,0.230904,-0.960094,2.031262,-3.256709,-1.111122,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	-0.430523,-0.648445,-0.627828,2.281229,-3.33825,-1.043475,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	-0.430523,-0.648445,-0.627828,2.281229,-3.33825,-1.043475,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	-0.562282,-0.328888,-0.75873,2.14888,-3.221616,-1.076203,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	-0.541077,0.245809,-0.804247,2.091539,-3.032437,-0.947029,
-	0.672893,0.661099,-0.331908,2.113587,-3.011851,-0.851648,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	0.672893,0.661099,-0.331908,2.113587,-3.011851,-0.851648,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.52783,0.437826,-0.727807,1.865135,-3.353827,-1.054981,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	0.52783,0.437826,-0.727807,1.865135,-3.353827,-1.054981,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	0.636282,0.100893,-0.764831,1.926176,-3.28888,-1.093746,
-	0.010538,0.399391,-0.91672,1.981186,-3.441282,-1.180532,
-	0.010538,0.399391,-0.91672,1.981186,-3.441282,-1.180532,
-	0.444124,0.617475,-0.649214,2.025468,-3.556842,-1.204841,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	0.872426,0.488735,0.003222,1.980621,-3.043895,-0.964237,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	-0.783521,-0.393963,-0.480508,1.806407,-3.173343,-0.834455,
-	0.926951,0.366239,0.081429,1.811797,-3.135641,-0.933096,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	-0.783521,-0.393963,-0.480508,1.806407,-3.173343,-0.834455,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	0.444124,0.617475,-0.649214,2.025468,-3.556842,-1.204841,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	0.444124,0.617475,-0.649214,2.025468,-3.556842,-1.204841,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	0.52783,0.437826,-0.727807,1.865135,-3.353827,-1.054981,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	0.52783,0.437826,-0.727807,1.865135,-3.353827,-1.054981,
-	-0.955753,-0.169718,0.240275,1.839523,-3.405292,-0.883488,
-	-0.955753,-0.169718,0.240275,1.839523,-3.405292,-0.883488,
-	0.52783,0.437826,-0.727807,1.865135,-3.353827,-1.054981,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	-0.955753,-0.169718,0.240275,1.839523,-3.405292,-0.883488,
-	0.862528,0.499882,0.078511,1.919391,-3.487078,-1.110869,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	-0.150944,-0.987886,0.036011,1.92973,-3.298418,-0.689538,
-	-0.630099,-0.773677,0.066329,1.900481,-3.131932,-0.728621,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	-0.630099,-0.773677,0.066329,1.900481,-3.131932,-0.728621,
-	-0.783521,-0.393963,-0.480508,1.806407,-3.173343,-0.834455,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	-0.955753,-0.169718,0.240275,1.839523,-3.405292,-0.883488,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	0.215809,0.484483,-0.847763,1.83279,-3.296508,-0.865078,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	-0.150944,-0.987886,0.036011,1.92973,-3.298418,-0.689538,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	-0.955753,-0.169718,0.240275,1.839523,-3.405292,-0.883488,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	-0.4909,0.016111,0.871067,2.002745,-3.52342,-0.688103,
-	-0.4909,0.016111,0.871067,2.002745,-3.52342,-0.688103,
-	-0.997638,0.009858,0.067986,1.933899,-3.546253,-0.912438,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	-0.4909,0.016111,0.871067,2.002745,-3.52342,-0.688103,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	-0.184432,-0.109597,0.976716,2.126553,-3.549679,-0.701005,
-	-0.184432,-0.109597,0.976716,2.126553,-3.549679,-0.701005,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	-0.184432,-0.109597,0.976716,2.126553,-3.549679,-0.701005,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	-0.554151,-0.205896,0.806551,2.244147,-3.545557,-0.732888,
-	-0.069765,-0.126006,0.989573,1.898573,-3.068274,-0.994338,
-	0.872426,0.488735,0.003222,1.980621,-3.043895,-0.964237,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	-0.069765,-0.126006,0.989573,1.898573,-3.068274,-0.994338,
-	-0.228294,-0.186048,-0.955651,2.110033,-3.148257,-1.068816,
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	0.383337,-0.601981,0.700479,1.855134,-3.083228,-0.986129,
-	-0.069765,-0.126006,0.989573,1.898573,-3.068274,-0.994338,
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	0.383337,-0.601981,0.700479,1.855134,-3.083228,-0.986129,
-	0.013288,-0.297478,-0.954636,1.970051,-3.141862,-1.065178,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.926951,0.366239,0.081429,1.811797,-3.135641,-0.933096,
-	0.383337,-0.601981,0.700479,1.855134,-3.083228,-0.986129,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.926951,0.366239,0.081429,1.811797,-3.135641,-0.933096,
-	0.213417,-0.547723,-0.808983,1.886443,-3.191742,-1.047318,
-	0.626232,0.565165,-0.53705,1.841888,-3.246003,-1.014774,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	0.672893,0.661099,-0.331908,2.113587,-3.011851,-0.851648,
-	-0.701253,0.091018,0.707079,2.07369,-3.020848,-0.782654,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	-0.701253,0.091018,0.707079,2.07369,-3.020848,-0.782654,
-	-0.706628,-0.050081,0.705811,2.187495,-3.161535,-0.800285,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	-0.430523,-0.648445,-0.627828,2.281229,-3.33825,-1.043475,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	-0.144755,0.439659,-0.886423,2.247981,-3.342804,-1.127459,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	0.457854,0.537523,-0.708123,2.343303,-3.507846,-1.195262,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	-0.430523,-0.648445,-0.627828,2.281229,-3.33825,-1.043475,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	-0.430523,-0.648445,-0.627828,2.281229,-3.33825,-1.043475,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	-0.492627,0.113675,-0.862784,2.201939,-3.226457,-0.996503,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	0.874983,0.217676,-0.43246,2.377814,-3.484109,-0.800332,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	0.743895,0.373896,0.553916,2.327021,-3.352317,-0.958234,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	-0.404532,-0.045989,-0.913367,2.236407,-3.220054,-0.89203,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	0.768072,0.514957,-0.380637,2.217369,-3.156093,-0.888927,
-	-0.706628,-0.050081,0.705811,2.187495,-3.161535,-0.800285,
-	-0.630099,-0.773677,0.066329,1.900481,-3.131932,-0.728621,
-	-0.150944,-0.987886,0.036011,1.92973,-3.298418,-0.689538,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	-0.630099,-0.773677,0.066329,1.900481,-3.131932,-0.728621,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	0.714275,0.465374,0.522723,1.998099,-3.039955,-0.718855,
-	0.714275,0.465374,0.522723,1.998099,-3.039955,-0.718855,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	-0.706628,-0.050081,0.705811,2.187495,-3.161535,-0.800285,
-	0.714275,0.465374,0.522723,1.998099,-3.039955,-0.718855,
-	-0.706628,-0.050081,0.705811,2.187495,-3.161535,-0.800285,
-	-0.701253,0.091018,0.707079,2.07369,-3.020848,-0.782654,
-	-0.150944,-0.987886,0.036011,1.92973,-3.298418,-0.689538,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	-0.150944,-0.987886,0.036011,1.92973,-3.298418,-0.689538,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	0.331575,0.146631,0.931964,2.059222,-3.230076,-0.674936,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	-0.706628,-0.050081,0.705811,2.187495,-3.161535,-0.800285,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	-0.937976,-0.320543,0.132115,1.941325,-3.434803,-0.701314,
-	-0.4909,0.016111,0.871067,2.002745,-3.52342,-0.688103,
-	-0.184432,-0.109597,0.976716,2.126553,-3.549679,-0.701005,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	-0.4909,0.016111,0.871067,2.002745,-3.52342,-0.688103,
-	0.79991,0.598082,-0.049409,2.235942,-3.243103,-0.823955,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	-0.184432,-0.109597,0.976716,2.126553,-3.549679,-0.701005,
-	-0.554151,-0.205896,0.806551,2.244147,-3.545557,-0.732888,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	0.874983,0.217676,-0.43246,2.377814,-3.484109,-0.800332,
-	0.866542,0.493887,-0.071973,2.309358,-3.345468,-0.801508,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	0.874983,0.217676,-0.43246,2.377814,-3.484109,-0.800332,
-	0.43336,0.0979,0.895888,2.107985,-3.363571,-0.677007,
-	-0.554151,-0.205896,0.806551,2.244147,-3.545557,-0.732888,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	0.874983,0.217676,-0.43246,2.377814,-3.484109,-0.800332,
-	-0.554151,-0.205896,0.806551,2.244147,-3.545557,-0.732888,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	-0.554151,-0.205896,0.806551,2.244147,-3.545557,-0.732888,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	0.444124,0.617475,-0.649214,2.025468,-3.556842,-1.204841,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	-0.987313,0.097592,0.125253,2.078928,-3.584991,-0.917088,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	0.872426,0.488735,0.003222,1.980621,-3.043895,-0.964237,
-	-0.541077,0.245809,-0.804247,2.091539,-3.032437,-0.947029,
-	-0.495591,0.225654,-0.838731,2.170039,-3.134504,-0.978866,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	-0.081045,0.409121,-0.908874,2.254361,-3.550931,-1.235118,
-	0.457854,0.537523,-0.708123,2.343303,-3.507846,-1.195262,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	0.457854,0.537523,-0.708123,2.343303,-3.507846,-1.195262,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	-0.554502,-0.046423,0.830886,2.197935,-3.583948,-0.936437,
-	0.717573,0.343682,0.605781,2.386827,-3.462222,-1.13648,
-	0.752232,0.244352,0.611914,2.440236,-3.509564,-1.019417,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	-0.13251,0.440061,-0.888137,-2.631547,-3.559891,-1.33738,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	-0.13251,0.440061,-0.888137,-2.631547,-3.559891,-1.33738,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	0.413011,0.629609,-0.658038,-2.981824,-3.608887,-1.346959,
-	0.009712,0.399549,-0.91666,-3.030627,-3.493327,-1.32265,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	0.009712,0.399549,-0.91666,-3.030627,-3.493327,-1.32265,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	0.009712,0.399549,-0.91666,-3.030627,-3.493327,-1.32265,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	-0.074103,0.409269,-0.909399,-2.856957,-3.449728,-1.356844,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	-0.492859,-0.096405,-0.864752,-2.975439,-3.308754,-1.25324,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	-0.431117,-0.034268,-0.901645,-2.699957,-3.390295,-1.185593,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	-0.431117,-0.034268,-0.901645,-2.699957,-3.390295,-1.185593,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	-0.245482,-0.183395,-0.951896,-2.845816,-3.273661,-1.218321,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	0.637284,0.689194,-0.344791,-2.90901,-3.084482,-1.089147,
-	0.737412,0.542596,-0.402261,-2.884711,-3.063896,-0.993766,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	0.737412,0.542596,-0.402261,-2.884711,-3.063896,-0.993766,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	0.596352,0.583149,-0.551635,-3.158524,-3.405872,-1.197099,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	0.596352,0.583149,-0.551635,-3.158524,-3.405872,-1.197099,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	0.070969,0.266956,-0.961092,-3.091252,-3.340925,-1.235864,
-	0.009712,0.399549,-0.91666,-3.030627,-3.493327,-1.32265,
-	0.009712,0.399549,-0.91666,-3.030627,-3.493327,-1.32265,
-	0.413011,0.629609,-0.658038,-2.981824,-3.608887,-1.346959,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	0.503689,0.453945,-0.735004,-3.03125,-3.09594,-1.106355,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	0.163153,0.19945,-0.96623,-3.223246,-3.225388,-0.976573,
-	0.977763,0.208696,-0.020643,-3.217306,-3.187686,-1.075214,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	0.163153,0.19945,-0.96623,-3.223246,-3.225388,-0.976573,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	0.413011,0.629609,-0.658038,-2.981824,-3.608887,-1.346959,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	0.413011,0.629609,-0.658038,-2.981824,-3.608887,-1.346959,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	0.596352,0.583149,-0.551635,-3.158524,-3.405872,-1.197099,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	0.596352,0.583149,-0.551635,-3.158524,-3.405872,-1.197099,
-	-0.948594,-0.185732,0.256269,-3.18675,-3.457336,-1.025606,
-	-0.948594,-0.185732,0.256269,-3.18675,-3.457336,-1.025606,
-	0.596352,0.583149,-0.551635,-3.158524,-3.405872,-1.197099,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	-0.948594,-0.185732,0.256269,-3.18675,-3.457336,-1.025606,
-	0.840313,0.535537,0.084106,-3.09873,-3.539123,-1.252987,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	-0.471141,0.022027,0.881783,-3.087335,-3.350463,-0.831656,
-	-0.948594,-0.185732,0.256269,-3.11957,-3.183977,-0.870739,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	-0.948594,-0.185732,0.256269,-3.11957,-3.183977,-0.870739,
-	0.163153,0.19945,-0.96623,-3.223246,-3.225388,-0.976573,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	-0.948594,-0.185732,0.256269,-3.18675,-3.457336,-1.025606,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	0.144389,0.231536,-0.962051,-3.19417,-3.348553,-1.007196,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	-0.471141,0.022027,0.881783,-3.087335,-3.350463,-0.831656,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	-0.948594,-0.185732,0.256269,-3.18675,-3.457336,-1.025606,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	-0.11646,-0.017993,0.993032,-3.006867,-3.575464,-0.830221,
-	-0.11646,-0.017993,0.993032,-3.006867,-3.575464,-0.830221,
-	-0.99734,0.010761,0.072093,-3.082741,-3.598298,-1.054556,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	-0.11646,-0.017993,0.993032,-3.006867,-3.575464,-0.830221,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	-0.037581,-0.042039,0.998409,-2.870422,-3.601724,-0.843123,
-	-0.037581,-0.042039,0.998409,-2.870422,-3.601724,-0.843123,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	-0.037581,-0.042039,0.998409,-2.870422,-3.601724,-0.843123,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	0.156207,-0.109405,0.981647,-2.740824,-3.597601,-0.875006,
-	-0.039603,0.339955,-0.939607,-3.121673,-3.120319,-1.136456,
-	0.503689,0.453945,-0.735004,-3.03125,-3.09594,-1.106355,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	-0.039603,0.339955,-0.939607,-3.121673,-3.120319,-1.136456,
-	0.012244,-0.298111,-0.954453,-2.888628,-3.200302,-1.210934,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	-0.377491,-0.043727,-0.92498,-3.169546,-3.135273,-1.128247,
-	-0.039603,0.339955,-0.939607,-3.121673,-3.120319,-1.136456,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	-0.377491,-0.043727,-0.92498,-3.169546,-3.135273,-1.128247,
-	-0.545598,-0.330415,-0.770161,-3.042899,-3.193907,-1.207296,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	0.977763,0.208696,-0.020643,-3.217306,-3.187686,-1.075214,
-	-0.377491,-0.043727,-0.92498,-3.169546,-3.135273,-1.128247,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	0.977763,0.208696,-0.020643,-3.217306,-3.187686,-1.075214,
-	0.405633,0.57823,-0.707893,-3.135041,-3.243787,-1.189436,
-	0.851754,0.52393,0.003494,-3.184143,-3.298048,-1.156892,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.737412,0.542596,-0.402261,-2.884711,-3.063896,-0.993766,
-	0.684558,0.361154,0.633205,-2.928681,-3.072892,-0.924772,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.684558,0.361154,0.633205,-2.928681,-3.072892,-0.924772,
-	0.713402,0.39471,0.579018,-2.80326,-3.21358,-0.942403,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	-0.431117,-0.034268,-0.901645,-2.699957,-3.390295,-1.185593,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	0.430301,0.548598,-0.716855,-2.736599,-3.394849,-1.269577,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	-0.13251,0.440061,-0.888137,-2.631547,-3.559891,-1.33738,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	-0.431117,-0.034268,-0.901645,-2.699957,-3.390295,-1.185593,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	-0.431117,-0.034268,-0.901645,-2.699957,-3.390295,-1.185593,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	-0.461794,0.113692,-0.879671,-2.787341,-3.278502,-1.138621,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	0.712283,0.385667,0.586441,-2.593513,-3.536154,-0.94245,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	0.77125,0.634502,-0.050796,-2.649491,-3.404362,-1.100352,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	0.845209,0.529004,-0.075999,-2.749355,-3.272099,-1.034148,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	-0.508358,0.250892,-0.823787,-2.770335,-3.208138,-1.031045,
-	0.713402,0.39471,0.579018,-2.80326,-3.21358,-0.942403,
-	-0.948594,-0.185732,0.256269,-3.11957,-3.183977,-0.870739,
-	-0.471141,0.022027,0.881783,-3.087335,-3.350463,-0.831656,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	-0.948594,-0.185732,0.256269,-3.11957,-3.183977,-0.870739,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	0.308087,0.149605,0.939521,-3.011987,-3.092,-0.860973,
-	0.308087,0.149605,0.939521,-3.011987,-3.092,-0.860973,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	0.713402,0.39471,0.579018,-2.80326,-3.21358,-0.942403,
-	0.308087,0.149605,0.939521,-3.011987,-3.092,-0.860973,
-	0.713402,0.39471,0.579018,-2.80326,-3.21358,-0.942403,
-	0.684558,0.361154,0.633205,-2.928681,-3.072892,-0.924772,
-	-0.471141,0.022027,0.881783,-3.087335,-3.350463,-0.831656,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	-0.471141,0.022027,0.881783,-3.087335,-3.350463,-0.831656,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	0.225987,0.181605,0.957053,-2.944625,-3.282121,-0.817054,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	0.713402,0.39471,0.579018,-2.80326,-3.21358,-0.942403,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	-0.385346,-0.01874,0.922582,-3.074557,-3.486847,-0.843432,
-	-0.11646,-0.017993,0.993032,-3.006867,-3.575464,-0.830221,
-	-0.037581,-0.042039,0.998409,-2.870422,-3.601724,-0.843123,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	-0.11646,-0.017993,0.993032,-3.006867,-3.575464,-0.830221,
-	0.722848,0.455753,0.519404,-2.749867,-3.295148,-0.966073,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	-0.037581,-0.042039,0.998409,-2.870422,-3.601724,-0.843123,
-	0.156207,-0.109405,0.981647,-2.740824,-3.597601,-0.875006,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.712283,0.385667,0.586441,-2.593513,-3.536154,-0.94245,
-	0.684834,0.490952,0.538488,-2.668957,-3.397513,-0.943626,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.712283,0.385667,0.586441,-2.593513,-3.536154,-0.94245,
-	0.229413,0.089674,0.96919,-2.890885,-3.415616,-0.819125,
-	0.156207,-0.109405,0.981647,-2.740824,-3.597601,-0.875006,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	0.712283,0.385667,0.586441,-2.593513,-3.536154,-0.94245,
-	0.156207,-0.109405,0.981647,-2.740824,-3.597601,-0.875006,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	0.156207,-0.109405,0.981647,-2.740824,-3.597601,-0.875006,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	0.413011,0.629609,-0.658038,-2.981824,-3.608887,-1.346959,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	-0.985013,0.106756,0.135469,-2.922908,-3.637036,-1.059206,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	0.503689,0.453945,-0.735004,-3.03125,-3.09594,-1.106355,
-	0.637284,0.689194,-0.344791,-2.90901,-3.084482,-1.089147,
-	-0.46316,0.228643,-0.856274,-2.822497,-3.186549,-1.120984,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	0.317837,0.631876,-0.706903,-2.729567,-3.602976,-1.377236,
-	-0.13251,0.440061,-0.888137,-2.631547,-3.559891,-1.33738,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	-0.13251,0.440061,-0.888137,-2.631547,-3.559891,-1.33738,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	0.339875,0.026681,0.940092,-2.791754,-3.635993,-1.078555,
-	0.61389,0.702597,-0.359856,-2.58358,-3.514267,-1.278598,
-	0.780958,0.624512,-0.009449,-2.52472,-3.561609,-1.161535,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	0.422569,-0.18743,0.886739,2.110033,-3.148257,1.068816,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	0.422569,-0.18743,0.886739,2.110033,-3.148257,1.068816,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	-0.779685,0.02537,0.625657,2.343303,-3.507846,1.195262,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	0.937141,-0.149709,0.315204,1.926176,-3.28888,1.093746,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	-0.501053,-0.05946,0.863371,2.138771,-3.397683,1.214726,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	0.937141,-0.149709,0.315204,1.926176,-3.28888,1.093746,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	0.937141,-0.149709,0.315204,1.926176,-3.28888,1.093746,
-	-0.35872,0.092902,0.928811,2.031262,-3.256709,1.111122,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	0.422569,-0.18743,0.886739,2.110033,-3.148257,1.068816,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	-0.354049,-0.10839,0.928924,2.14888,-3.221616,1.076203,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	0.789099,-0.039289,-0.613008,2.113587,-3.011851,0.851648,
-	0.773659,-0.235087,-0.588375,2.091539,-3.032437,0.947029,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	0.773659,-0.235087,-0.588375,2.091539,-3.032437,0.947029,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.937141,-0.149709,0.315204,1.926176,-3.28888,1.093746,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	0.937141,-0.149709,0.315204,1.926176,-3.28888,1.093746,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.148388,-0.325205,-0.933929,1.919391,-3.487078,1.110869,
-	0.148388,-0.325205,-0.933929,1.919391,-3.487078,1.110869,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	0.982106,-0.010346,0.188044,1.981186,-3.441282,1.180532,
-	0.422569,-0.18743,0.886739,2.110033,-3.148257,1.068816,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	-0.215783,-0.895808,-0.388544,1.980621,-3.043895,0.964237,
-	-0.085416,-0.081635,-0.992995,1.83279,-3.296508,0.865078,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	-0.156447,-0.088128,0.983747,1.811797,-3.135641,0.933096,
-	-0.085416,-0.081635,-0.992995,1.83279,-3.296508,0.865078,
-	-0.156447,-0.088128,0.983747,1.811797,-3.135641,0.933096,
-	-0.042094,-0.220101,-0.974568,1.806407,-3.173343,0.834455,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	0.148388,-0.325205,-0.933929,1.919391,-3.487078,1.110869,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	0.148388,-0.325205,-0.933929,1.919391,-3.487078,1.110869,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	-0.085416,-0.081635,-0.992995,1.83279,-3.296508,0.865078,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	0.148388,-0.325205,-0.933929,1.919391,-3.487078,1.110869,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	0.257818,-0.230014,-0.938415,1.865135,-3.353827,1.054981,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	-0.042094,-0.220101,-0.974568,1.806407,-3.173343,0.834455,
-	-0.363523,-0.150625,-0.919327,1.900481,-3.131932,0.728621,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.042094,-0.220101,-0.974568,1.806407,-3.173343,0.834455,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.085416,-0.081635,-0.992995,1.83279,-3.296508,0.865078,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.914496,-0.253607,-0.315247,1.941325,-3.434803,0.701314,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	-0.085416,-0.081635,-0.992995,1.83279,-3.296508,0.865078,
-	-0.943599,-0.160394,-0.289646,2.002745,-3.52342,0.688103,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	-0.943599,-0.160394,-0.289646,2.002745,-3.52342,0.688103,
-	-0.401279,-0.250965,-0.880904,1.839523,-3.405292,0.883488,
-	-0.914496,-0.253607,-0.315247,1.941325,-3.434803,0.701314,
-	0.601229,-0.111151,-0.791308,2.126553,-3.549679,0.701005,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	0.601229,-0.111151,-0.791308,2.126553,-3.549679,0.701005,
-	0.255431,-0.055528,-0.965231,1.933899,-3.546253,0.912438,
-	-0.943599,-0.160394,-0.289646,2.002745,-3.52342,0.688103,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	0.601229,-0.111151,-0.791308,2.126553,-3.549679,0.701005,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	0.422569,-0.18743,0.886739,2.110033,-3.148257,1.068816,
-	-0.215783,-0.895808,-0.388544,1.980621,-3.043895,0.964237,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	-0.215783,-0.895808,-0.388544,1.980621,-3.043895,0.964237,
-	0.356923,-0.210291,0.910156,1.898573,-3.068274,0.994338,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	-0.019303,-0.142974,0.989538,1.970051,-3.141862,1.065178,
-	0.356923,-0.210291,0.910156,1.898573,-3.068274,0.994338,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	0.356923,-0.210291,0.910156,1.898573,-3.068274,0.994338,
-	0.517272,-0.552302,0.653753,1.855134,-3.083228,0.986129,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	0.866898,-0.268351,0.420091,1.886443,-3.191742,1.047318,
-	0.517272,-0.552302,0.653753,1.855134,-3.083228,0.986129,
-	0.230893,-0.309688,-0.922378,1.841888,-3.246003,1.014774,
-	0.517272,-0.552302,0.653753,1.855134,-3.083228,0.986129,
-	-0.156447,-0.088128,0.983747,1.811797,-3.135641,0.933096,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	-0.080858,0.024731,0.996419,2.07369,-3.020848,0.782654,
-	0.789099,-0.039289,-0.613008,2.113587,-3.011851,0.851648,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	0.789099,-0.039289,-0.613008,2.113587,-3.011851,0.851648,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	-0.779685,0.02537,0.625657,2.343303,-3.507846,1.195262,
-	0.507452,0.36284,0.781562,2.386827,-3.462222,1.13648,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	-0.779685,0.02537,0.625657,2.343303,-3.507846,1.195262,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	-0.453746,-0.057149,0.889297,2.247981,-3.342804,1.127459,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	0.507452,0.36284,0.781562,2.386827,-3.462222,1.13648,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	0.567579,-0.469834,-0.6761,2.201939,-3.226457,0.996503,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	0.886562,-0.46255,0.007486,2.281229,-3.33825,1.043475,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.913315,0.39776,-0.087428,2.377814,-3.484109,0.800332,
-	0.170703,0.25395,0.952035,2.309358,-3.345468,0.801508,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.913315,0.39776,-0.087428,2.377814,-3.484109,0.800332,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	0.977763,0.208696,0.020643,2.235942,-3.243103,0.823955,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.977763,0.208696,0.020643,2.235942,-3.243103,0.823955,
-	0.484364,0.195735,0.85269,2.327021,-3.352317,0.958234,
-	0.170703,0.25395,0.952035,2.309358,-3.345468,0.801508,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	0.579344,-0.339433,-0.741044,2.217369,-3.156093,0.888927,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	-0.661663,-0.025481,0.749369,2.236407,-3.220054,0.89203,
-	0.977763,0.208696,0.020643,2.235942,-3.243103,0.823955,
-	-0.245482,-0.183394,0.951896,1.998099,-3.039955,0.718855,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.245482,-0.183394,0.951896,1.998099,-3.039955,0.718855,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.363523,-0.150625,-0.919327,1.900481,-3.131932,0.728621,
-	-0.080858,0.024731,0.996419,2.07369,-3.020848,0.782654,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	-0.080858,0.024731,0.996419,2.07369,-3.020848,0.782654,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	-0.245482,-0.183394,0.951896,1.998099,-3.039955,0.718855,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	-0.914496,-0.253607,-0.315247,1.941325,-3.434803,0.701314,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	-0.914496,-0.253607,-0.315247,1.941325,-3.434803,0.701314,
-	-0.924461,-0.213385,-0.315973,1.92973,-3.298418,0.689538,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	0.977763,0.208696,0.020643,2.235942,-3.243103,0.823955,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	-0.156072,0.243426,0.95728,2.187495,-3.161535,0.800285,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	0.430301,0.548598,0.716855,2.059222,-3.230076,0.674936,
-	-0.943599,-0.160394,-0.289646,2.002745,-3.52342,0.688103,
-	-0.914496,-0.253607,-0.315247,1.941325,-3.434803,0.701314,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	-0.943599,-0.160394,-0.289646,2.002745,-3.52342,0.688103,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	0.601229,-0.111151,-0.791308,2.126553,-3.549679,0.701005,
-	0.170703,0.25395,0.952035,2.309358,-3.345468,0.801508,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	0.977763,0.208696,0.020643,2.235942,-3.243103,0.823955,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	0.601229,-0.111151,-0.791308,2.126553,-3.549679,0.701005,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	0.317836,0.631876,0.706903,2.107985,-3.363571,0.677007,
-	0.170703,0.25395,0.952035,2.309358,-3.345468,0.801508,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	0.170703,0.25395,0.952035,2.309358,-3.345468,0.801508,
-	0.913315,0.39776,-0.087428,2.377814,-3.484109,0.800332,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	0.53288,-0.088285,-0.841572,2.244147,-3.545557,0.732888,
-	0.913315,0.39776,-0.087428,2.377814,-3.484109,0.800332,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	0.913315,0.39776,-0.087428,2.377814,-3.484109,0.800332,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	-0.807765,-0.096776,0.581507,2.025468,-3.556842,1.204841,
-	-0.348227,-0.192527,-0.917427,2.078928,-3.584991,0.917088,
-	0.890357,-0.340018,-0.302742,2.170039,-3.134504,0.978866,
-	0.773659,-0.235087,-0.588375,2.091539,-3.032437,0.947029,
-	-0.215783,-0.895808,-0.388544,1.980621,-3.043895,0.964237,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	0.507452,0.36284,0.781562,2.386827,-3.462222,1.13648,
-	-0.779685,0.02537,0.625657,2.343303,-3.507846,1.195262,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	-0.779685,0.02537,0.625657,2.343303,-3.507846,1.195262,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	0.121953,0.140869,0.982488,2.440236,-3.509564,1.019417,
-	-0.765488,-0.115047,0.633082,2.254361,-3.550931,1.235118,
-	0.546571,-0.125171,-0.828005,2.197935,-3.583948,0.936437,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	0.254799,-0.149124,0.955426,-2.888628,-3.200302,1.210934,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	0.254799,-0.149124,0.955426,-2.888628,-3.200302,1.210934,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	-0.026425,0.178249,0.983631,-2.631547,-3.559891,1.33738,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	0.089482,-0.029551,0.99555,-3.091252,-3.340925,1.235864,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	0.580504,-0.526296,0.621312,-2.856957,-3.449728,1.356844,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	0.089482,-0.029551,0.99555,-3.091252,-3.340925,1.235864,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	0.089482,-0.029551,0.99555,-3.091252,-3.340925,1.235864,
-	0.205604,0.070037,0.976126,-2.975439,-3.308754,1.25324,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	0.254799,-0.149124,0.955426,-2.888628,-3.200302,1.210934,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	0.193496,0.00102,0.981101,-2.845816,-3.273661,1.218321,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	-0.161613,0.16539,0.972896,-2.884711,-3.063896,0.993766,
-	0.07463,0.029476,0.996776,-2.90901,-3.084482,1.089147,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	0.07463,0.029476,0.996776,-2.90901,-3.084482,1.089147,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	0.089482,-0.029551,0.99555,-3.091252,-3.340925,1.235864,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	0.089482,-0.029551,0.99555,-3.091252,-3.340925,1.235864,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	-0.498861,0.185917,0.846506,-3.09873,-3.539123,1.252987,
-	-0.498861,0.185917,0.846506,-3.09873,-3.539123,1.252987,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	-0.028076,0.054588,0.998114,-3.030627,-3.493327,1.32265,
-	0.254799,-0.149124,0.955426,-2.888628,-3.200302,1.210934,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	-0.541406,0.227835,0.809302,-3.03125,-3.09594,1.106355,
-	-0.626758,0.377346,0.681751,-3.19417,-3.348553,1.007196,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	0.085126,0.114843,0.98973,-3.217306,-3.187686,1.075214,
-	-0.626758,0.377346,0.681751,-3.19417,-3.348553,1.007196,
-	0.085126,0.114843,0.98973,-3.217306,-3.187686,1.075214,
-	-0.588311,0.26373,0.764419,-3.223246,-3.225388,0.976573,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	-0.498861,0.185917,0.846506,-3.09873,-3.539123,1.252987,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	-0.498861,0.185917,0.846506,-3.09873,-3.539123,1.252987,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	-0.626758,0.377346,0.681751,-3.19417,-3.348553,1.007196,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.498861,0.185917,0.846506,-3.09873,-3.539123,1.252987,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.730585,0.298655,0.614045,-3.158524,-3.405872,1.197099,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.588311,0.26373,0.764419,-3.223246,-3.225388,0.976573,
-	-0.64352,0.086605,-0.760514,-3.11957,-3.183977,0.870739,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.588311,0.26373,0.764419,-3.223246,-3.225388,0.976573,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.626758,0.377346,0.681751,-3.19417,-3.348553,1.007196,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.421241,0.09636,-0.901815,-3.074557,-3.486847,0.843432,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.626758,0.377346,0.681751,-3.19417,-3.348553,1.007196,
-	-0.482826,-0.146891,-0.863309,-3.006867,-3.575464,0.830221,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.482826,-0.146891,-0.863309,-3.006867,-3.575464,0.830221,
-	-0.701121,0.259575,-0.664117,-3.18675,-3.457336,1.025606,
-	-0.421241,0.09636,-0.901815,-3.074557,-3.486847,0.843432,
-	-0.562406,-0.352304,-0.748051,-2.870422,-3.601724,0.843123,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.562406,-0.352304,-0.748051,-2.870422,-3.601724,0.843123,
-	-0.738865,0.325814,-0.589851,-3.082741,-3.598298,1.054556,
-	-0.482826,-0.146891,-0.863309,-3.006867,-3.575464,0.830221,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	-0.562406,-0.352304,-0.748051,-2.870422,-3.601724,0.843123,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	0.254799,-0.149124,0.955426,-2.888628,-3.200302,1.210934,
-	-0.541406,0.227835,0.809302,-3.03125,-3.09594,1.106355,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	-0.541406,0.227835,0.809302,-3.03125,-3.09594,1.106355,
-	-0.125911,-0.68432,-0.718229,-3.121673,-3.120319,1.136456,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	0.405755,-0.293021,0.865737,-3.042899,-3.193907,1.207296,
-	-0.125911,-0.68432,-0.718229,-3.121673,-3.120319,1.136456,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	-0.125911,-0.68432,-0.718229,-3.121673,-3.120319,1.136456,
-	0.535863,0.090315,-0.83946,-3.169546,-3.135273,1.128247,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	0.487947,-0.44627,0.750167,-3.135041,-3.243787,1.189436,
-	0.535863,0.090315,-0.83946,-3.169546,-3.135273,1.128247,
-	-0.059163,0.13391,0.989226,-3.184143,-3.298048,1.156892,
-	0.535863,0.090315,-0.83946,-3.169546,-3.135273,1.128247,
-	0.085126,0.114843,0.98973,-3.217306,-3.187686,1.075214,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	0.236645,-0.06852,-0.969177,-2.928681,-3.072892,0.924772,
-	-0.161613,0.16539,0.972896,-2.884711,-3.063896,0.993766,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	-0.161613,0.16539,0.972896,-2.884711,-3.063896,0.993766,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	-0.026425,0.178249,0.983631,-2.631547,-3.559891,1.33738,
-	0.35124,-0.91474,-0.199704,-2.58358,-3.514267,1.278598,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	-0.026425,0.178249,0.983631,-2.631547,-3.559891,1.33738,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	0.011655,0.055061,0.998415,-2.736599,-3.394849,1.269577,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	0.35124,-0.91474,-0.199704,-2.58358,-3.514267,1.278598,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	0.177373,0.037311,0.983436,-2.787341,-3.278502,1.138621,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	-0.048366,0.138166,0.989227,-2.699957,-3.390295,1.185593,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	-0.999995,0.003039,0.000095,-2.593513,-3.536154,0.94245,
-	-0.830756,0.127038,0.541946,-2.668957,-3.397513,0.943626,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	-0.999995,0.003039,0.000095,-2.593513,-3.536154,0.94245,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	-0.874688,-0.025586,0.48401,-2.749867,-3.295148,0.966073,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	-0.874688,-0.025586,0.48401,-2.749867,-3.295148,0.966073,
-	-0.97518,0.20982,-0.070713,-2.649491,-3.404362,1.100352,
-	-0.830756,0.127038,0.541946,-2.668957,-3.397513,0.943626,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	-0.206994,0.072903,0.975622,-2.770335,-3.208138,1.031045,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	0.159383,-0.507401,-0.846842,-2.749355,-3.272099,1.034148,
-	-0.874688,-0.025586,0.48401,-2.749867,-3.295148,0.966073,
-	-0.860798,0.234294,0.451812,-3.011987,-3.092,0.860973,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.860798,0.234294,0.451812,-3.011987,-3.092,0.860973,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	-0.64352,0.086605,-0.760514,-3.11957,-3.183977,0.870739,
-	0.236645,-0.06852,-0.969177,-2.928681,-3.072892,0.924772,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	0.236645,-0.06852,-0.969177,-2.928681,-3.072892,0.924772,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	-0.860798,0.234294,0.451812,-3.011987,-3.092,0.860973,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.421241,0.09636,-0.901815,-3.074557,-3.486847,0.843432,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	-0.421241,0.09636,-0.901815,-3.074557,-3.486847,0.843432,
-	-0.382827,0.20765,-0.900181,-3.087335,-3.350463,0.831656,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	-0.874688,-0.025586,0.48401,-2.749867,-3.295148,0.966073,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	0.199599,0.097869,-0.974978,-2.80326,-3.21358,0.942403,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.405387,0.054444,0.912522,-2.944625,-3.282121,0.817054,
-	-0.482826,-0.146891,-0.863309,-3.006867,-3.575464,0.830221,
-	-0.421241,0.09636,-0.901815,-3.074557,-3.486847,0.843432,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.482826,-0.146891,-0.863309,-3.006867,-3.575464,0.830221,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.562406,-0.352304,-0.748051,-2.870422,-3.601724,0.843123,
-	-0.830756,0.127038,0.541946,-2.668957,-3.397513,0.943626,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.874688,-0.025586,0.48401,-2.749867,-3.295148,0.966073,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	-0.562406,-0.352304,-0.748051,-2.870422,-3.601724,0.843123,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	-0.51506,-0.054833,0.855398,-2.890885,-3.415616,0.819125,
-	-0.830756,0.127038,0.541946,-2.668957,-3.397513,0.943626,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	-0.830756,0.127038,0.541946,-2.668957,-3.397513,0.943626,
-	-0.999995,0.003039,0.000095,-2.593513,-3.536154,0.94245,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555,
-	0.115225,0.169061,-0.978847,-2.740824,-3.597601,0.875006,
-	-0.999995,0.003039,0.000095,-2.593513,-3.536154,0.94245,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555,
-	-0.999995,0.003039,0.000095,-2.593513,-3.536154,0.94245,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555,
-	-0.057735,0.03099,0.997851,-2.981824,-3.608887,1.346959,
-	-0.670566,0.283017,-0.685743,-2.922908,-3.637036,1.059206,
-	-0.308543,0.191148,0.931807,-2.822497,-3.186549,1.120984,
-	0.07463,0.029476,0.996776,-2.90901,-3.084482,1.089147,
-	-0.541406,0.227835,0.809302,-3.03125,-3.09594,1.106355,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	0.35124,-0.91474,-0.199704,-2.58358,-3.514267,1.278598,
-	-0.026425,0.178249,0.983631,-2.631547,-3.559891,1.33738,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	-0.026425,0.178249,0.983631,-2.631547,-3.559891,1.33738,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	0.285409,-0.933801,-0.215773,-2.52472,-3.561609,1.161535,
-	-0.093334,0.204552,0.974396,-2.729567,-3.602976,1.377236,
-	0.024044,0.175693,-0.984151,-2.791754,-3.635993,1.078555
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1032,data,NULL};
-const struct gllist *cow_hoofs=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char cow_hoofs[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\304\000\000\000\010\004\000\000\030\002\000\000"
+ "Xs\310\276\257\303T\300\000\000\000\000\251<\2658\276jA\010\332\317\000\000"
+ "\022q\367\007\260\317\000\000\324r\246\004[\317\000\000\203m\020\003\307"
+ "\315\000\000Nw,\377\012\315\000\000_r\261\374\030\311\000\000\235{\266\367"
+ "\371\311\000\000\230w\303\365,\310\000\000@m\177\365\212\311\000\000\077"
+ "k\270\372\244\312\000\000\303h\234\001\220\316\000\000\367f\000\006\251\320"
+ "\000\000\317x`\377\326\320\000\000:un\004\365\322\000\000\310s\226\010\301"
+ "\323\000\000<p3\0152\325\000\000;q!\016\201\331\000\000\354u\234\007\322"
+ "\327\000\000\363d\214\003\042\322\000\000\000f\254\376P\320\000\000th\246"
+ "\370\312\315\000\0009k\256\014j\324\000\000Yc\324\006H\332\000\000\227c\211"
+ "\010\323\325\000\000\212dC\001\346\330\000\000\034i\371\365\302\326\000\000"
+ "\252o9\364\214\326\000\000\330dX\374\021\330\000\000\354h-\001\325\340\000"
+ "\000\231g\264\010\021\337\000\000ri\003\373M\340\000\0009l\002\367\346\340"
+ "\000\000\321q\322\365P\340\000\000\013uE\364\254\325\000\000\042w\001\366"
+ "\340\336\000\000\203g\224\013\016\323\000\000\215e\347\012m\323\000\000n"
+ "o\271\015\240\334\000\000\222t]\007\324\333\000\000\310v\270\004\256\327"
+ "\000\000\225}\306\371\241\314\000\000\341z\275\376\260\324\000\000\377\177"
+ "\242\367\354\321\000\000\025z\015\377\305\333\000\000-}\310\370\323\333\000"
+ "\000\303v\255\003\302\332\000\000\306nD\004~\341\000\000\003l\334\014\202"
+ "\337\000\000\372p;\376f\341\000\000(\210\346\005n\311\000\000!\217\234\005"
+ "D\311\000\000\020\221L\002\356\310\000\0004\213\266\000Z\307\000\000\000"
+ "\226\321\374\235\306\000\000\217\220V\372\254\302\000\000\300\232\134\365"
+ "\215\303\000\000R\226i\363\300\301\000\000\353\212%\363\036\303\000\000\266"
+ "\210^\3707\304\000\000\370\205A\377#\310\000\000\376\203\245\003=\312\000"
+ "\000\250\227\006\375i\312\000\000\265\223\024\002\211\314\000\000\036\222"
+ "<\006U\315\000\0005\216\331\012\305\316\000\000N\217\307\013\025\323\000"
+ "\000z\224B\005e\321\000\000\305\2011\001\265\313\000\000\356\202R\374\344"
+ "\311\000\000\242\205L\366]\307\000\000\257\210T\012\376\315\000\000\001\200"
+ "z\004\334\323\000\000F\200.\006f\317\000\000Q\201\351\376y\322\000\000[\206"
+ "\237\363U\320\000\000\224\215\337\361 \320\000\000\247\201\376\371\244\321"
+ "\000\000&\206\323\376i\332\000\000\261\204Y\006\244\330\000\000\272\206\251"
+ "\370\340\331\000\000\311\211\247\364y\332\000\000\364\217w\363\344\331\000"
+ "\000\202\223\353\361@\317\000\000\317\225\247\363s\330\000\000\230\204:\011"
+ "\242\314\000\000n\202\215\010\001\315\000\000R\215_\0133\326\000\000\375"
+ "\222\003\005g\325\000\000m\225^\002B\321\000\000\353\234k\3675\306\000\000"
+ "\360\231c\374C\316\000\000\224\237H\365\177\313\000\000\017\231\262\374Y"
+ "\325\000\000x\234n\366g\325\000\000g\225S\001U\324\000\000\231\214\352\001"
+ "\022\333\000\000\216\211\202\012\025\331\000\000\007\217\341\373\372\332"
+ "\000\000\203m\020\00392\000\000\324r\246\004\2450\000\000\022q\367\007P0"
+ "\000\000\276jA\010&0\000\000_r\261\374\3506\000\000Nw,\377\3662\000\000\230"
+ "w\303\365\3247\000\000\235{\266\367\0076\000\000\077k\270\372\1345\000\000"
+ "@m\177\365v6\000\000\303h\234\001p1\000\000\367f\000\006W/\000\000:un\004"
+ "\013-\000\000\317x`\377*/\000\000\310s\226\010\077,\000\000\354u\234\007"
+ ".(\000\000;q!\016\177&\000\000<p3\015\316*\000\000\000f\254\376\260/\000"
+ "\000\363d\214\003\336-\000\000th\246\37062\000\0009k\256\014\226+\000\000"
+ "\212dC\001\032'\000\000\227c\211\010-*\000\000Yc\324\006\270%\000\000\252"
+ "o9\364t)\000\000\034i\371\365>)\000\000\330dX\374\357'\000\000\231g\264\010"
+ "\357 \000\000\354h-\001+\037\000\000ri\003\373\263\037\000\0009l\002\367"
+ "\032\037\000\000\321q\322\365\260\037\000\000\042w\001\366 !\000\000\013"
+ "uE\364T*\000\000\203g\224\013\362,\000\000\215e\347\012\223,\000\000\222"
+ "t]\007,$\000\000no\271\015`#\000\000\310v\270\004R(\000\000\225}\306\371"
+ "_3\000\000\377\177\242\367\024.\000\000\341z\275\376P+\000\000-}\310\370"
+ "-$\000\000\025z\015\377;$\000\000\303v\255\003>%\000\000\003l\334\014~ \000"
+ "\000\306nD\004\202\036\000\000\372p;\376\232\036\000\0004\213\266\000\246"
+ "8\000\000\020\221L\002\0227\000\000!\217\234\005\2746\000\000(\210\346\005"
+ "\2226\000\000\217\220V\372T=\000\000\000\226\321\374c9\000\000R\226i\363"
+ "@>\000\000\300\232\134\365s<\000\000\266\210^\370\311;\000\000\353\212%\363"
+ "\342<\000\000\370\205A\377\3357\000\000\376\203\245\003\3035\000\000\265"
+ "\223\024\002w3\000\000\250\227\006\375\2275\000\000\036\222<\006\2532\000"
+ "\000z\224B\005\233.\000\000N\217\307\013\353,\000\0005\216\331\012;1\000"
+ "\000\356\202R\374\0346\000\000\305\2011\001K4\000\000\242\205L\366\2438\000"
+ "\000\257\210T\012\0022\000\000Q\201\351\376\207-\000\000F\200.\006\2320\000"
+ "\000\001\200z\004$,\000\000\224\215\337\361\340/\000\000[\206\237\363\253"
+ "/\000\000\247\201\376\371\134.\000\000\261\204Y\006\134'\000\000&\206\323"
+ "\376\227%\000\000\272\206\251\370 &\000\000\311\211\247\364\207%\000\000"
+ "\364\217w\363\034&\000\000\317\225\247\363\215'\000\000\202\223\353\361\300"
+ "0\000\000\230\204:\011^3\000\000n\202\215\010\3772\000\000\375\222\003\005"
+ "\231*\000\000R\215_\013\315)\000\000m\225^\002\276.\000\000\353\234k\367"
+ "\3139\000\000\224\237H\365\2014\000\000\360\231c\374\2751\000\000x\234n\366"
+ "\231*\000\000\017\231\262\374\247*\000\000g\225S\001\253+\000\000\216\211"
+ "\202\012\353&\000\000\231\214\352\001\356$\000\000\007\217\341\373\006%\000"
+ "\000a\202\222\226\232\254ip\247sOeW]\246xQ^Y~vIS\222\261\241\213T\223W\225"
+ "TMLXDUQ^WL,Q-\237\275V\042Wm\212\001\230\012\247\360\360\225\312\275\252"
+ "\343\323\001\356\365\317\374\323\357\371\362\035\323\305\010\303\374\205"
+ "\2477\0329\034;\023S2m6K9\036\0155#'\011\232\253a\202\222\230\211\254V_\246"
+ "x\247sOgP`Y~exTa\204\251\213W\224YKOVG\225VN0TSI/]Yloi\030iq\213\001\232"
+ "\013\251\357\324\002\251\357\333\376\363\376\374\373!\003\020\365\242{\205"
+ "\2454\0336\036Q5JPH<G93$6\0356\042\025\021\034\016\027\011\337\011\340\366"
+ "$\360\376\360\323\373\327\373\300\366\273\002j\377\273\370U\362G\352\134"
+ "\253S\325c\313e\255|\307l\277k\230d\225b\216\315\223\212\212\360\367\230"
+ "\205\222\237y\232\226\242\216\241\224\322\227\317\220\327v\264w\257t\257"
+ "\037\356&\327\361\027\367\003\306\376'\034\014\016(\020[,\020\027g\026\351"
+ "\357 )\0300\025\007\025\000\030\362!\350+\331\001\007\367\024\375\023\375"
+ "\006\371\004\012\375%\336\023\004\373\017\345\021\353\007\360\020\011\003"
+ "\310\027\372\016\327\017\324\022\321\034\011\014\322\025\227K\232F\225H\210"
+ "H\223^\212Y\215\252\234\254nsl|\272\213wQukx\231T\2160\237,\232\226\034\201"
+ "\000\272\013\260\376\271\023\332\005\322\373\000\000\001\000\002\000\000"
+ "\000\002\000\003\000\003\000\002\000\004\000\003\000\004\000\005\000\005"
+ "\000\004\000\006\000\005\000\006\000\007\000\007\000\010\000\011\000\007"
+ "\000\011\000\005\000\005\000\011\000\012\000\005\000\012\000\003\000\003"
+ "\000\012\000\013\000\003\000\013\000\000\000\014\000\004\000\002\000\014"
+ "\000\002\000\015\000\015\000\002\000\001\000\015\000\001\000\016\000\016"
+ "\000\017\000\020\000\016\000\020\000\021\000\022\000\013\000\012\000\022"
+ "\000\012\000\023\000\024\000\023\000\012\000\024\000\012\000\011\000\011"
+ "\000\010\000\024\000\025\000\016\000\001\000\026\000\027\000\022\000\026"
+ "\000\022\000\030\000\031\000\024\000\010\000\031\000\010\000\032\000\030"
+ "\000\022\000\023\000\030\000\023\000\033\000\033\000\023\000\024\000\033"
+ "\000\024\000\031\000\030\000\034\000\035\000\030\000\035\000\026\000\030"
+ "\000\033\000\036\000\030\000\036\000\034\000\036\000\033\000\031\000\036"
+ "\000\031\000\037\000\037\000\031\000\032\000\037\000\032\000 \000 \000\032"
+ "\000!\000 \000!\000\042\000#\000\025\000\001\000#\000\001\000\000\000$\000"
+ "#\000\000\000$\000\000\000\013\000\027\000$\000\013\000\027\000\013\000\022"
+ "\000\021\000\020\000%\000\021\000%\000&\000\016\000\021\000'\000\016\000"
+ "'\000\015\000\004\000\014\000(\000\004\000(\000\006\000(\000\014\000)\000"
+ "(\000)\000*\000)\000\014\000\015\000)\000\015\000'\000*\000)\000+\000*\000"
+ "+\000,\000+\000)\000'\000+\000'\000-\000-\000'\000\021\000-\000\021\000&"
+ "\000\035\000\034\000.\000\035\000.\000/\000/\000.\000&\000/\000&\000%\000"
+ "\034\000\036\0000\000\034\0000\000.\000.\0000\000-\000.\000-\000&\0000\000"
+ "\036\000\037\000 \0000\000\037\000-\0000\000+\000 \000\042\0000\000,\000"
+ "+\0000\000,\0000\000\042\000*\000,\000\042\000*\000\042\000!\000\032\000"
+ "\010\000\007\000\032\000\007\000!\000\025\000\017\000\016\000!\000\007\000"
+ "\006\000!\000\006\000(\000!\000(\000*\0001\0002\0003\0001\0003\0004\0004"
+ "\0003\0005\0004\0005\0006\0006\0005\0007\0006\0007\0008\0008\0009\000:\000"
+ "8\000:\0006\0006\000:\000;\0006\000;\0004\0004\000;\000<\0004\000<\0001\000"
+ "=\0005\0003\000=\0003\000>\000>\0003\0002\000>\0002\000\077\000\077\000@"
+ "\000A\000\077\000A\000B\000C\000<\000;\000C\000;\000D\000E\000D\000;\000"
+ "E\000;\000:\000:\0009\000E\000F\000\077\0002\000G\000H\000C\000G\000C\000"
+ "I\000J\000E\0009\000J\0009\000K\000I\000C\000D\000I\000D\000L\000L\000D\000"
+ "E\000L\000E\000J\000I\000M\000N\000I\000N\000G\000I\000L\000O\000I\000O\000"
+ "M\000O\000L\000J\000O\000J\000P\000P\000J\000K\000P\000K\000Q\000Q\000K\000"
+ "R\000Q\000R\000S\000T\000F\0002\000T\0002\0001\000U\000T\0001\000U\0001\000"
+ "<\000H\000U\000<\000H\000<\000C\000B\000A\000V\000B\000V\000W\000\077\000"
+ "B\000X\000\077\000X\000>\0005\000=\000Y\0005\000Y\0007\000Y\000=\000Z\000"
+ "Y\000Z\000[\000Z\000=\000>\000Z\000>\000X\000[\000Z\000\134\000[\000\134"
+ "\000]\000\134\000Z\000X\000\134\000X\000^\000^\000X\000B\000^\000B\000W\000"
+ "N\000M\000_\000N\000_\000`\000`\000_\000W\000`\000W\000V\000M\000O\000a\000"
+ "M\000a\000_\000_\000a\000^\000_\000^\000W\000a\000O\000P\000Q\000a\000P\000"
+ "^\000a\000\134\000Q\000S\000a\000]\000\134\000a\000]\000a\000S\000[\000]"
+ "\000S\000[\000S\000R\000K\0009\0008\000K\0008\000R\000F\000@\000\077\000"
+ "R\0008\0007\000R\0007\000Y\000R\000Y\000[\000b\000c\000d\000b\000d\000e\000"
+ "f\000g\000c\000f\000c\000b\000h\000i\000g\000h\000g\000f\000f\000j\000k\000"
+ "f\000k\000h\000b\000l\000j\000b\000j\000f\000e\000m\000l\000e\000l\000b\000"
+ "n\000c\000g\000n\000g\000o\000p\000d\000c\000p\000c\000n\000q\000r\000s\000"
+ "q\000s\000p\000t\000l\000m\000t\000m\000u\000j\000l\000t\000j\000t\000v\000"
+ "v\000k\000j\000d\000p\000w\000x\000u\000y\000x\000y\000z\000{\000k\000v\000"
+ "{\000v\000|\000}\000t\000u\000}\000u\000x\000|\000v\000t\000|\000t\000}\000"
+ "z\000~\000\177\000z\000\177\000x\000\177\000\200\000}\000\177\000}\000x\000"
+ "\201\000|\000}\000\201\000}\000\200\000\202\000{\000|\000\202\000|\000\201"
+ "\000\203\000\204\000{\000\203\000{\000\202\000e\000d\000w\000e\000w\000\205"
+ "\000m\000e\000\205\000m\000\205\000\206\000u\000m\000\206\000u\000\206\000"
+ "y\000\207\000\210\000r\000\207\000r\000q\000n\000\211\000q\000n\000q\000"
+ "p\000i\000\212\000o\000i\000o\000g\000\213\000\214\000o\000\213\000o\000"
+ "\212\000\211\000n\000o\000\211\000o\000\214\000\215\000\216\000\214\000\215"
+ "\000\214\000\213\000\217\000\211\000\214\000\217\000\214\000\216\000\207"
+ "\000q\000\211\000\207\000\211\000\217\000\220\000\221\000\177\000\220\000"
+ "\177\000~\000\210\000\207\000\221\000\210\000\221\000\220\000\221\000\222"
+ "\000\200\000\221\000\200\000\177\000\207\000\217\000\222\000\207\000\222"
+ "\000\221\000\201\000\200\000\222\000\201\000\222\000\202\000\216\000\222"
+ "\000\217\000\222\000\203\000\202\000\203\000\222\000\216\000\203\000\216"
+ "\000\215\000\204\000\203\000\215\000\204\000\215\000\213\000\204\000h\000"
+ "k\000\204\000k\000{\000p\000s\000w\000\213\000\212\000i\000\213\000i\000"
+ "h\000\213\000h\000\204\000\223\000\224\000\225\000\223\000\225\000\226\000"
+ "\227\000\230\000\224\000\227\000\224\000\223\000\231\000\232\000\230\000"
+ "\231\000\230\000\227\000\227\000\233\000\234\000\227\000\234\000\231\000"
+ "\223\000\235\000\233\000\223\000\233\000\227\000\226\000\236\000\235\000"
+ "\226\000\235\000\223\000\237\000\224\000\230\000\237\000\230\000\240\000"
+ "\241\000\225\000\224\000\241\000\224\000\237\000\242\000\243\000\244\000"
+ "\242\000\244\000\241\000\245\000\235\000\236\000\245\000\236\000\246\000"
+ "\233\000\235\000\245\000\233\000\245\000\247\000\247\000\234\000\233\000"
+ "\225\000\241\000\250\000\251\000\246\000\252\000\251\000\252\000\253\000"
+ "\254\000\234\000\247\000\254\000\247\000\255\000\256\000\245\000\246\000"
+ "\256\000\246\000\251\000\255\000\247\000\245\000\255\000\245\000\256\000"
+ "\253\000\257\000\260\000\253\000\260\000\251\000\260\000\261\000\256\000"
+ "\260\000\256\000\251\000\262\000\255\000\256\000\262\000\256\000\261\000"
+ "\263\000\254\000\255\000\263\000\255\000\262\000\264\000\265\000\254\000"
+ "\264\000\254\000\263\000\226\000\225\000\250\000\226\000\250\000\266\000"
+ "\236\000\226\000\266\000\236\000\266\000\267\000\246\000\236\000\267\000"
+ "\246\000\267\000\252\000\270\000\271\000\243\000\270\000\243\000\242\000"
+ "\237\000\272\000\242\000\237\000\242\000\241\000\232\000\273\000\240\000"
+ "\232\000\240\000\230\000\274\000\275\000\240\000\274\000\240\000\273\000"
+ "\272\000\237\000\240\000\272\000\240\000\275\000\276\000\277\000\275\000"
+ "\276\000\275\000\274\000\300\000\272\000\275\000\300\000\275\000\277\000"
+ "\270\000\242\000\272\000\270\000\272\000\300\000\301\000\302\000\260\000"
+ "\301\000\260\000\257\000\271\000\270\000\302\000\271\000\302\000\301\000"
+ "\302\000\303\000\261\000\302\000\261\000\260\000\270\000\300\000\303\000"
+ "\270\000\303\000\302\000\262\000\261\000\303\000\262\000\303\000\263\000"
+ "\277\000\303\000\300\000\303\000\264\000\263\000\264\000\303\000\277\000"
+ "\264\000\277\000\276\000\265\000\264\000\276\000\265\000\276\000\274\000"
+ "\265\000\231\000\234\000\265\000\234\000\254\000\241\000\244\000\250\000"
+ "\274\000\273\000\232\000\274\000\232\000\231\000\274\000\231\000\265\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\002\000\003\000\000\000"
+ "\003\000\002\000\004\000\003\000\004\000\004\000\005\000\003\000\005\000"
+ "\004\000\006\000\005\000\006\000\006\000\007\000\005\000\007\000\007\000"
+ "\010\000\010\000\011\000\007\000\011\000\005\000\011\000\011\000\012\000"
+ "\005\000\012\000\003\000\012\000\012\000\013\000\003\000\013\000\000\000"
+ "\013\000\004\000\014\000\002\000\014\000\002\000\015\000\014\000\015\000"
+ "\001\000\015\000\001\000\016\000\015\000\016\000\016\000\017\000\017\000"
+ "\020\000\016\000\020\000\020\000\021\000\016\000\021\000\013\000\022\000"
+ "\012\000\022\000\012\000\023\000\022\000\023\000\023\000\024\000\012\000"
+ "\024\000\011\000\024\000\010\000\024\000\016\000\025\000\001\000\025\000"
+ "\026\000\027\000\022\000\027\000\022\000\026\000\022\000\030\000\026\000"
+ "\030\000\024\000\031\000\010\000\031\000\010\000\032\000\031\000\032\000"
+ "\023\000\030\000\023\000\033\000\030\000\033\000\024\000\033\000\031\000"
+ "\033\000\030\000\034\000\034\000\035\000\030\000\035\000\026\000\035\000"
+ "\033\000\036\000\030\000\036\000\034\000\036\000\031\000\036\000\031\000"
+ "\037\000\036\000\037\000\032\000\037\000\032\000 \000\037\000 \000\032\000"
+ "!\000 \000!\000!\000\042\000 \000\042\000\025\000#\000\001\000#\000\000\000"
+ "#\000#\000$\000\000\000$\000\013\000$\000\027\000$\000\013\000\027\000\020"
+ "\000%\000\021\000%\000%\000&\000\021\000&\000\021\000'\000\016\000'\000\015"
+ "\000'\000\014\000(\000\004\000(\000\006\000(\000\014\000)\000(\000)\000)"
+ "\000*\000(\000*\000\015\000)\000'\000)\000)\000+\000*\000+\000+\000,\000"
+ "*\000,\000'\000+\000'\000-\000+\000-\000\021\000-\000&\000-\000\034\000."
+ "\000\035\000.\000.\000/\000\035\000/\000&\000.\000&\000/\000%\000/\000\036"
+ "\0000\000\034\0000\000.\0000\000-\0000\000-\000.\000\037\0000\000 \0000\000"
+ "+\0000\000\042\0000\000,\0000\000\042\000,\000\042\000*\000!\000*\000\007"
+ "\000\032\000\007\000!\000\017\000\025\000\006\000!\000!\000(\0001\0002\000"
+ "2\0003\0001\0003\0003\0004\0001\0004\0003\0005\0004\0005\0005\0006\0004\000"
+ "6\0005\0007\0006\0007\0007\0008\0006\0008\0008\0009\0009\000:\0008\000:\000"
+ "6\000:\000:\000;\0006\000;\0004\000;\000;\000<\0004\000<\0001\000<\0005\000"
+ "=\0003\000=\0003\000>\000=\000>\0002\000>\0002\000\077\000>\000\077\000\077"
+ "\000@\000@\000A\000\077\000A\000A\000B\000\077\000B\000<\000C\000;\000C\000"
+ ";\000D\000C\000D\000D\000E\000;\000E\000:\000E\0009\000E\000\077\000F\000"
+ "2\000F\000G\000H\000C\000H\000C\000G\000C\000I\000G\000I\000E\000J\0009\000"
+ "J\0009\000K\000J\000K\000D\000I\000D\000L\000I\000L\000E\000L\000J\000L\000"
+ "I\000M\000M\000N\000I\000N\000G\000N\000L\000O\000I\000O\000M\000O\000J\000"
+ "O\000J\000P\000O\000P\000K\000P\000K\000Q\000P\000Q\000K\000R\000Q\000R\000"
+ "R\000S\000Q\000S\000F\000T\0002\000T\0001\000T\000T\000U\0001\000U\000<\000"
+ "U\000H\000U\000<\000H\000A\000V\000B\000V\000V\000W\000B\000W\000B\000X\000"
+ "\077\000X\000>\000X\000=\000Y\0005\000Y\0007\000Y\000=\000Z\000Y\000Z\000"
+ "Z\000[\000Y\000[\000>\000Z\000X\000Z\000Z\000\134\000[\000\134\000\134\000"
+ "]\000[\000]\000X\000\134\000X\000^\000\134\000^\000B\000^\000W\000^\000M"
+ "\000_\000N\000_\000_\000`\000N\000`\000W\000_\000W\000`\000V\000`\000O\000"
+ "a\000M\000a\000_\000a\000^\000a\000^\000_\000P\000a\000Q\000a\000\134\000"
+ "a\000S\000a\000]\000a\000S\000]\000S\000[\000R\000[\0008\000K\0008\000R\000"
+ "@\000F\0007\000R\000R\000Y\000b\000c\000c\000d\000b\000d\000d\000e\000b\000"
+ "e\000f\000g\000c\000g\000c\000f\000b\000f\000h\000i\000g\000i\000g\000h\000"
+ "f\000h\000f\000j\000j\000k\000f\000k\000h\000k\000b\000l\000j\000l\000b\000"
+ "j\000e\000m\000l\000m\000e\000l\000c\000n\000g\000n\000g\000o\000n\000o\000"
+ "d\000p\000c\000p\000n\000p\000q\000r\000r\000s\000q\000s\000p\000s\000p\000"
+ "q\000l\000t\000m\000t\000m\000u\000t\000u\000j\000t\000t\000v\000j\000v\000"
+ "k\000v\000p\000w\000d\000w\000u\000x\000u\000y\000x\000y\000y\000z\000x\000"
+ "z\000k\000{\000v\000{\000v\000|\000{\000|\000t\000}\000u\000}\000x\000}\000"
+ "t\000|\000|\000}\000z\000~\000~\000\177\000z\000\177\000x\000\177\000\177"
+ "\000\200\000}\000\200\000}\000\177\000|\000\201\000}\000\201\000\200\000"
+ "\201\000{\000\202\000|\000\202\000\201\000\202\000\203\000\204\000{\000\204"
+ "\000{\000\203\000\202\000\203\000e\000w\000w\000\205\000e\000\205\000m\000"
+ "\205\000\205\000\206\000m\000\206\000u\000\206\000y\000\206\000\207\000\210"
+ "\000r\000\210\000r\000\207\000q\000\207\000n\000\211\000q\000\211\000n\000"
+ "q\000i\000\212\000o\000\212\000i\000o\000\213\000\214\000o\000\214\000o\000"
+ "\213\000\212\000\213\000o\000\211\000\211\000\214\000\215\000\216\000\214"
+ "\000\216\000\214\000\215\000\213\000\215\000\211\000\217\000\214\000\217"
+ "\000\216\000\217\000\207\000\211\000\207\000\217\000\220\000\221\000\177"
+ "\000\221\000\177\000\220\000~\000\220\000\207\000\221\000\210\000\221\000"
+ "\210\000\220\000\221\000\222\000\200\000\222\000\200\000\221\000\217\000"
+ "\222\000\207\000\222\000\201\000\222\000\202\000\222\000\216\000\222\000"
+ "\203\000\222\000\203\000\216\000\203\000\215\000\204\000\215\000\204\000"
+ "\213\000h\000\204\000k\000\204\000s\000w\000i\000\213\000h\000\213\000\223"
+ "\000\224\000\224\000\225\000\223\000\225\000\225\000\226\000\223\000\226"
+ "\000\227\000\230\000\224\000\230\000\224\000\227\000\223\000\227\000\231"
+ "\000\232\000\230\000\232\000\230\000\231\000\227\000\231\000\227\000\233"
+ "\000\233\000\234\000\227\000\234\000\231\000\234\000\223\000\235\000\233"
+ "\000\235\000\223\000\233\000\226\000\236\000\235\000\236\000\226\000\235"
+ "\000\224\000\237\000\230\000\237\000\230\000\240\000\237\000\240\000\225"
+ "\000\241\000\224\000\241\000\237\000\241\000\242\000\243\000\243\000\244"
+ "\000\242\000\244\000\241\000\244\000\241\000\242\000\235\000\245\000\236"
+ "\000\245\000\236\000\246\000\245\000\246\000\233\000\245\000\245\000\247"
+ "\000\233\000\247\000\234\000\247\000\241\000\250\000\225\000\250\000\246"
+ "\000\251\000\246\000\252\000\251\000\252\000\252\000\253\000\251\000\253"
+ "\000\234\000\254\000\247\000\254\000\247\000\255\000\254\000\255\000\245"
+ "\000\256\000\246\000\256\000\251\000\256\000\245\000\255\000\255\000\256"
+ "\000\253\000\257\000\257\000\260\000\253\000\260\000\251\000\260\000\260"
+ "\000\261\000\256\000\261\000\256\000\260\000\255\000\262\000\256\000\262"
+ "\000\261\000\262\000\254\000\263\000\255\000\263\000\262\000\263\000\264"
+ "\000\265\000\254\000\265\000\254\000\264\000\263\000\264\000\226\000\250"
+ "\000\250\000\266\000\226\000\266\000\236\000\266\000\266\000\267\000\236"
+ "\000\267\000\246\000\267\000\252\000\267\000\270\000\271\000\243\000\271"
+ "\000\243\000\270\000\242\000\270\000\237\000\272\000\242\000\272\000\237"
+ "\000\242\000\232\000\273\000\240\000\273\000\232\000\240\000\274\000\275"
+ "\000\240\000\275\000\240\000\274\000\273\000\274\000\240\000\272\000\272"
+ "\000\275\000\276\000\277\000\275\000\277\000\275\000\276\000\274\000\276"
+ "\000\272\000\300\000\275\000\300\000\277\000\300\000\270\000\272\000\270"
+ "\000\300\000\301\000\302\000\260\000\302\000\260\000\301\000\257\000\301"
+ "\000\270\000\302\000\271\000\302\000\271\000\301\000\302\000\303\000\261"
+ "\000\303\000\261\000\302\000\300\000\303\000\270\000\303\000\262\000\303"
+ "\000\263\000\303\000\277\000\303\000\264\000\303\000\264\000\277\000\264"
+ "\000\276\000\265\000\276\000\265\000\274\000\231\000\265\000\234\000\265"
+ "\000\244\000\250\000\232\000\274\000\231\000\274\000"
+;
+const unsigned long cow_hoofs_size = 6248;
@@ -1,1025 +1,282 @@
+/* Generated from "cow_horns.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	-0.03479,0.69667,0.716547,4.209941,2.600612,-0.337597,
-	-0.01139,0.953897,0.299916,4.328606,2.563996,-0.343892,
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	-0.01139,0.953897,0.299916,4.328606,2.563996,-0.343892,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	-0.01139,0.953897,0.299916,4.328606,2.563996,-0.343892,
-	-0.151742,0.274295,0.949598,4.410844,2.500167,-0.351972,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	-0.151742,0.274295,0.949598,4.410844,2.500167,-0.351972,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	-0.163152,0.69985,0.695407,4.344028,2.585635,-0.470949,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.809878,-0.450757,-0.375386,4.359483,2.615839,-0.596817,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	0.042118,-0.881894,-0.469563,4.47609,2.606654,-0.692301,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.042118,-0.881894,-0.469563,4.47609,2.606654,-0.692301,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.083641,-0.819891,-0.566378,4.411541,2.663824,-0.713132,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.388502,-0.664299,0.638571,4.546655,2.709095,-0.80378,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.086688,-0.887002,-0.453556,4.465268,2.695425,-0.757267,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.388502,-0.664299,0.638571,4.546655,2.709095,-0.80378,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	-0.151742,0.274295,0.949598,4.410844,2.500167,-0.351972,
-	0.288841,-0.745301,0.600914,4.474318,2.418432,-0.361347,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	0.288841,-0.745301,0.600914,4.474318,2.418432,-0.361347,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	-0.090939,0.953562,0.287141,4.407729,2.53164,-0.486692,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	0.157921,-0.851177,0.500558,4.44076,2.490353,-0.629287,
-	0.042118,-0.881894,-0.469563,4.47609,2.606654,-0.692301,
-	0.795507,-0.586003,-0.154171,4.423033,2.561337,-0.603562,
-	0.157921,-0.851177,0.500558,4.44076,2.490353,-0.629287,
-	0.042118,-0.881894,-0.469563,4.47609,2.606654,-0.692301,
-	0.157921,-0.851177,0.500558,4.44076,2.490353,-0.629287,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.042118,-0.881894,-0.469563,4.47609,2.606654,-0.692301,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.571341,-0.68069,0.458509,4.520603,2.639162,-0.745542,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	0.388502,-0.664299,0.638571,4.546655,2.709095,-0.80378,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	0.21141,-0.953268,-0.215838,4.574545,2.669863,-0.780363,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	0.388502,-0.664299,0.638571,4.546655,2.709095,-0.80378,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	0.388502,-0.664299,0.638571,4.546655,2.709095,-0.80378,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	-0.538845,-0.659239,-0.524452,4.728931,2.721892,-0.832625,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	-0.538845,-0.659239,-0.524452,4.728931,2.721892,-0.832625,
-	0.209939,-0.930128,-0.301309,4.656565,2.680542,-0.799684,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	0.287073,-0.905921,-0.311283,4.646703,2.728688,-0.822295,
-	-0.538845,-0.659239,-0.524452,4.728931,2.721892,-0.832625,
-	-0.635876,0.32433,-0.700337,4.821325,2.691794,-0.791887,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	-0.635876,0.32433,-0.700337,4.821325,2.691794,-0.791887,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	-0.376273,-0.14016,-0.915846,4.821336,2.621498,-0.789636,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.538845,-0.659239,-0.524452,4.728931,2.721892,-0.832625,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.290459,-0.499809,-0.815981,4.748031,2.683805,-0.800044,
-	-0.635876,0.32433,-0.700337,4.821325,2.691794,-0.791887,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	-0.538845,-0.659239,-0.524452,4.728931,2.721892,-0.832625,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.724543,-0.128977,-0.677054,4.801436,2.750224,-0.858918,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.724543,-0.128977,-0.677054,4.801436,2.750224,-0.858918,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.508573,-0.111047,-0.853828,4.811798,2.72868,-0.815406,
-	-0.635876,0.32433,-0.700337,4.821325,2.691794,-0.791887,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.635876,0.32433,-0.700337,4.821325,2.691794,-0.791887,
-	-0.376273,-0.14016,-0.915846,4.821336,2.621498,-0.789636,
-	-0.903777,-0.182749,-0.387027,4.442912,2.343263,-0.53322,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	0.288841,-0.745301,0.600914,4.474318,2.418432,-0.361347,
-	-0.903777,-0.182749,-0.387027,4.442912,2.343263,-0.53322,
-	0.288841,-0.745301,0.600914,4.474318,2.418432,-0.361347,
-	0.195545,0.103956,-0.975169,4.472349,2.325133,-0.443764,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	0.157921,-0.851177,0.500558,4.44076,2.490353,-0.629287,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	0.237421,-0.963021,-0.127365,4.44385,2.449921,-0.495432,
-	-0.903777,-0.182749,-0.387027,4.442912,2.343263,-0.53322,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	0.157921,-0.851177,0.500558,4.44076,2.490353,-0.629287,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	-0.903777,-0.182749,-0.387027,4.442912,2.343263,-0.53322,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.903777,-0.182749,-0.387027,4.442912,2.343263,-0.53322,
-	0.195545,0.103956,-0.975169,4.472349,2.325133,-0.443764,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	0.195545,0.103956,-0.975169,4.472349,2.325133,-0.443764,
-	-0.091679,0.768658,-0.633056,4.296769,2.260422,-0.528796,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	-0.911341,0.002265,-0.411646,4.440713,2.398472,-0.629128,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	0.254106,-0.95176,-0.171999,4.484667,2.534451,-0.708888,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	-0.77316,0.344901,-0.532228,4.474625,2.465214,-0.75189,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	-0.895156,0.397807,-0.201111,4.444739,2.475795,-0.860515,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	0.165259,-0.797056,0.580854,4.520165,2.557971,-0.762427,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.931592,0.319003,-0.174277,4.538177,2.513353,-0.776566,
-	-0.895156,0.397807,-0.201111,4.444739,2.475795,-0.860515,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.895156,0.397807,-0.201111,4.444739,2.475795,-0.860515,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	0.243744,-0.944481,-0.220328,4.59262,2.569879,-0.790452,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	-0.885174,0.439903,-0.1515,4.601515,2.533324,-0.794193,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.395723,0.901671,-0.174334,4.829566,2.580797,-0.821827,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.395723,0.901671,-0.174334,4.829566,2.580797,-0.821827,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.476949,0.871028,-0.117606,4.856249,2.593812,-0.867067,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	-0.05208,-0.715695,-0.696469,4.674691,2.598833,-0.808006,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	-0.742898,0.572423,-0.347037,4.683344,2.554221,-0.821927,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	-0.376273,-0.14016,-0.915846,4.821336,2.621498,-0.789636,
-	-0.501597,-0.526154,-0.686704,4.729447,2.606204,-0.807513,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	-0.376273,-0.14016,-0.915846,4.821336,2.621498,-0.789636,
-	0.11638,0.680313,-0.723623,4.737893,2.564648,-0.830389,
-	-0.395723,0.901671,-0.174334,4.829566,2.580797,-0.821827,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.594389,0.803108,-0.041468,4.497719,2.54748,-0.937659,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	-0.659696,0.567803,-0.492342,4.681847,2.551036,-0.886235,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.091114,0.94565,-0.312161,4.883022,2.613658,-0.893163,
-	-0.476949,0.871028,-0.117606,4.856249,2.593812,-0.867067,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.091114,0.94565,-0.312161,4.883022,2.613658,-0.893163,
-	0.206279,0.744918,-0.634466,4.755192,2.568818,-0.876311,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.895156,0.397807,-0.201111,4.444739,2.475795,-0.860515,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.821561,0.369567,-0.434116,4.554459,2.511417,-0.850571,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.594389,0.803108,-0.041468,4.497719,2.54748,-0.937659,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.895156,0.397807,-0.201111,4.444739,2.475795,-0.860515,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.911194,0.285551,-0.296961,4.382053,2.433474,-0.798757,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.383863,0.612068,-0.691392,4.32063,2.385528,-0.682583,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.557881,0.828586,0.047047,4.193959,2.370476,-0.616705,
-	-0.536307,0.710867,-0.45502,4.113935,2.334131,-0.526471,
-	-0.557881,0.828586,0.047047,4.193959,2.370476,-0.616705,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.536307,0.710867,-0.45502,4.113935,2.334131,-0.526471,
-	-0.566117,0.431682,-0.702255,4.314039,2.32946,-0.57751,
-	-0.091679,0.768658,-0.633056,4.296769,2.260422,-0.528796,
-	-0.091114,0.94565,-0.312161,4.883022,2.613658,-0.893163,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.476949,0.871028,-0.117606,4.856249,2.593812,-0.867067,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	0.05537,0.916343,-0.396546,4.854957,2.660227,-0.92431,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	0.05537,0.916343,-0.396546,4.854957,2.660227,-0.92431,
-	-0.091114,0.94565,-0.312161,4.883022,2.613658,-0.893163,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	0.090337,0.942369,-0.32215,4.615662,2.63387,-0.977986,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	-0.610894,0.790229,0.048447,4.763337,2.590834,-0.929248,
-	-0.594389,0.803108,-0.041468,4.497719,2.54748,-0.937659,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	0.090337,0.942369,-0.32215,4.615662,2.63387,-0.977986,
-	-0.594389,0.803108,-0.041468,4.497719,2.54748,-0.937659,
-	0.090337,0.942369,-0.32215,4.615662,2.63387,-0.977986,
-	-0.590366,0.807127,0.003753,4.662221,2.556346,-0.940618,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	-0.594389,0.803108,-0.041468,4.497719,2.54748,-0.937659,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.216454,0.960138,-0.176868,4.352603,2.524888,-0.890532,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.283496,0.953866,-0.098841,4.262798,2.490674,-0.818316,
-	-0.091114,0.94565,-0.312161,4.883022,2.613658,-0.893163,
-	0.05537,0.916343,-0.396546,4.854957,2.660227,-0.92431,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.421167,0.906102,-0.039984,4.192789,2.411967,-0.668016,
-	-0.557881,0.828586,0.047047,4.193959,2.370476,-0.616705,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.557881,0.828586,0.047047,4.193959,2.370476,-0.616705,
-	-0.536307,0.710867,-0.45502,4.113935,2.334131,-0.526471,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.536307,0.710867,-0.45502,4.113935,2.334131,-0.526471,
-	-0.330515,0.821242,-0.465103,4.07851,2.41181,-0.472193,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.929249,-0.009269,-0.369337,4.460786,2.695616,-0.949972,
-	-0.641133,0.599375,-0.479267,4.343217,2.589542,-0.893106,
-	-0.929249,-0.009269,-0.369337,4.460786,2.695616,-0.949972,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	-0.929249,-0.009269,-0.369337,4.460786,2.695616,-0.949972,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	-0.560855,0.735161,-0.380763,4.460582,2.622875,-0.957002,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	0.090337,0.942369,-0.32215,4.615662,2.63387,-0.977986,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.364192,0.890167,-0.2738,4.138494,2.557838,-0.652651,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.760994,0.140162,-0.633436,4.244622,2.554467,-0.811726,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.364192,0.890167,-0.2738,4.138494,2.557838,-0.652651,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.411843,0.771855,-0.484381,4.138687,2.474013,-0.642311,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.904972,-0.026554,-0.424642,4.088356,2.510913,-0.453793,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.904972,-0.026554,-0.424642,4.088356,2.510913,-0.453793,
-	-0.395036,0.74012,-0.544214,4.121994,2.458034,-0.570029,
-	-0.330515,0.821242,-0.465103,4.07851,2.41181,-0.472193,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	0.197027,0.937222,-0.287742,4.753015,2.699695,-0.973279,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	0.090337,0.942369,-0.32215,4.615662,2.63387,-0.977986,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	0.197027,0.937222,-0.287742,4.753015,2.699695,-0.973279,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	-0.678216,0.658343,-0.326508,4.735139,2.645464,-0.95089,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	0.05537,0.916343,-0.396546,4.854957,2.660227,-0.92431,
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	-0.860594,0.405545,-0.308076,4.117367,2.568514,-0.3845,
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	-0.860594,0.405545,-0.308076,4.117367,2.568514,-0.3845,
-	-0.03479,0.69667,0.716547,4.209941,2.600612,-0.337597,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	-0.31499,0.894135,0.318282,4.616626,2.749486,-0.939333,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	0.176955,-0.903058,-0.391373,4.509555,2.719807,-0.819972,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	0.713982,0.301536,-0.631907,4.418954,2.707401,-0.782531,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	-0.000715,-0.295728,0.955272,4.22473,2.624525,-0.491916,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	-0.904972,-0.026554,-0.424642,4.088356,2.510913,-0.453793,
-	-0.860594,0.405545,-0.308076,4.117367,2.568514,-0.3845,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	-0.904972,-0.026554,-0.424642,4.088356,2.510913,-0.453793,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	0.008972,0.708004,0.706152,4.277169,2.652435,-0.591369,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	0.743898,-0.655714,0.129057,4.35668,2.682996,-0.71905,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.162972,0.917259,0.363422,4.151183,2.579059,-0.494606,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	-0.719327,0.568277,-0.399538,4.104292,2.537976,-0.543437,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	-0.364192,0.890167,-0.2738,4.138494,2.557838,-0.652651,
-	-0.364192,0.890167,-0.2738,4.138494,2.557838,-0.652651,
-	-0.816521,0.559553,0.142109,4.176065,2.636883,-0.618384,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	-0.364192,0.890167,-0.2738,4.138494,2.557838,-0.652651,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.940255,0.335069,0.060403,4.273414,2.686575,-0.753674,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	-0.353793,0.870619,-0.341838,4.235494,2.636171,-0.803613,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.900694,0.426849,-0.080936,4.354196,2.711836,-0.826545,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	-0.718934,0.608496,-0.335955,4.342998,2.664049,-0.904347,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	-0.929249,-0.009269,-0.369337,4.460786,2.695616,-0.949972,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	0.267121,-0.895396,-0.356249,4.636909,2.750501,-0.856859,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	-0.31499,0.894135,0.318282,4.616626,2.749486,-0.939333,
-	-0.724543,-0.128977,-0.677054,4.801436,2.750224,-0.858918,
-	-0.145585,0.915338,0.375448,4.827733,2.75439,-0.905049,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	-0.724543,-0.128977,-0.677054,4.801436,2.750224,-0.858918,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	-0.53682,-0.608254,-0.58468,4.719171,2.751091,-0.865965,
-	-0.145585,0.915338,0.375448,4.827733,2.75439,-0.905049,
-	-0.724543,-0.128977,-0.677054,4.801436,2.750224,-0.858918,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	-0.31499,0.894135,0.318282,4.616626,2.749486,-0.939333,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	-0.758791,0.646991,0.075091,4.462368,2.725999,-0.882675,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	-0.929249,-0.009269,-0.369337,4.460786,2.695616,-0.949972,
-	-0.31499,0.894135,0.318282,4.616626,2.749486,-0.939333,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	0.197027,0.937222,-0.287742,4.753015,2.699695,-0.973279,
-	-0.31499,0.894135,0.318282,4.616626,2.749486,-0.939333,
-	0.197027,0.937222,-0.287742,4.753015,2.699695,-0.973279,
-	-0.144656,0.947613,-0.284787,4.6248,2.708372,-0.989445,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	0.197027,0.937222,-0.287742,4.753015,2.699695,-0.973279,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	-0.47673,0.840923,0.25608,4.735445,2.749285,-0.940329,
-	-0.145585,0.915338,0.375448,4.827733,2.75439,-0.905049,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	-0.145585,0.915338,0.375448,4.827733,2.75439,-0.905049,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	0.05537,0.916343,-0.396546,4.854957,2.660227,-0.92431,
-	0.225135,0.965893,-0.127928,4.863709,2.722151,-0.93666,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.376273,-0.14016,-0.915846,4.821336,2.621498,-0.789636,
-	-0.395723,0.901671,-0.174334,4.829566,2.580797,-0.821827,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.395723,0.901671,-0.174334,4.829566,2.580797,-0.821827,
-	-0.476949,0.871028,-0.117606,4.856249,2.593812,-0.867067,
-	-0.86136,-0.239794,-0.447836,5.096148,2.75972,-0.774729,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	-0.130291,0.991051,0.029017,4.328606,2.563996,0.343892,
-	-0.904972,-0.026555,0.424641,4.209941,2.600612,0.337597,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	-0.904972,-0.026555,0.424641,4.209941,2.600612,0.337597,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.501953,0.842502,0.195534,4.410844,2.500167,0.351972,
-	-0.130291,0.991051,0.029017,4.328606,2.563996,0.343892,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.130291,0.991051,0.029017,4.328606,2.563996,0.343892,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	-0.877603,-0.025309,0.478719,4.344028,2.585635,0.470949,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	-0.860595,0.405543,0.308077,4.411541,2.663824,0.713132,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	-0.860595,0.405543,0.308077,4.411541,2.663824,0.713132,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	0.223577,0.97296,-0.057987,4.359483,2.615839,0.596817,
-	-0.860595,0.405543,0.308077,4.411541,2.663824,0.713132,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.860595,0.405543,0.308077,4.411541,2.663824,0.713132,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.860595,0.405543,0.308077,4.411541,2.663824,0.713132,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.683788,0.700764,-0.203383,4.574545,2.669863,0.780363,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.758791,0.646991,-0.075091,4.465268,2.695425,0.757267,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	-0.849668,0.488771,-0.197904,4.474318,2.418432,0.361347,
-	-0.501953,0.842502,0.195534,4.410844,2.500167,0.351972,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	-0.501953,0.842502,0.195534,4.410844,2.500167,0.351972,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	0.197027,0.937222,0.287741,4.407729,2.53164,0.486692,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.247355,0.948391,-0.198417,4.423033,2.561337,0.603562,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	-0.162972,0.917259,-0.363422,4.47609,2.606654,0.692301,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	-0.900694,0.426849,0.080936,4.520603,2.639162,0.745542,
-	-0.683788,0.700764,-0.203383,4.574545,2.669863,0.780363,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	-0.683788,0.700764,-0.203383,4.574545,2.669863,0.780363,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	-0.683788,0.700764,-0.203383,4.574545,2.669863,0.780363,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.683788,0.700764,-0.203383,4.574545,2.669863,0.780363,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.816521,0.559553,-0.142109,4.546655,2.709095,0.80378,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	-0.894795,0.444359,-0.043442,4.636909,2.750501,0.856859,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.892748,0.392127,-0.221893,4.656565,2.680542,0.799684,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.990661,0.056144,-0.124249,4.646703,2.728688,0.822295,
-	-0.894795,0.444359,-0.043442,4.636909,2.750501,0.856859,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.894795,0.444359,-0.043442,4.636909,2.750501,0.856859,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	-0.791764,-0.610494,-0.020171,4.821336,2.621498,0.789636,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.791764,-0.610494,-0.020171,4.821336,2.621498,0.789636,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.64155,-0.578509,0.503727,4.821325,2.691794,0.791887,
-	-0.64155,-0.578509,0.503727,4.821325,2.691794,0.791887,
-	-0.941564,0.056551,0.332054,4.748031,2.683805,0.800044,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.64155,-0.578509,0.503727,4.821325,2.691794,0.791887,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.832539,-0.5495,0.070196,4.811798,2.72868,0.815406,
-	-0.862876,-0.450622,0.228877,4.801436,2.750224,0.858918,
-	-0.832539,-0.5495,0.070196,4.811798,2.72868,0.815406,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.862876,-0.450622,0.228877,4.801436,2.750224,0.858918,
-	-0.978317,0.206989,-0.00716,4.728931,2.721892,0.832625,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	-0.832539,-0.5495,0.070196,4.811798,2.72868,0.815406,
-	-0.862876,-0.450622,0.228877,4.801436,2.750224,0.858918,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.64155,-0.578509,0.503727,4.821325,2.691794,0.791887,
-	-0.832539,-0.5495,0.070196,4.811798,2.72868,0.815406,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.791764,-0.610494,-0.020171,4.821336,2.621498,0.789636,
-	-0.64155,-0.578509,0.503727,4.821325,2.691794,0.791887,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	0.231006,-0.859096,0.456717,4.472349,2.325133,0.443764,
-	-0.849668,0.488771,-0.197904,4.474318,2.418432,0.361347,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	0.231006,-0.859096,0.456717,4.472349,2.325133,0.443764,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.476729,0.840923,-0.25608,4.44385,2.449921,0.495432,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.963659,-0.230665,0.134738,4.440713,2.398472,0.629128,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	-0.963659,-0.230665,0.134738,4.440713,2.398472,0.629128,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	-0.145585,0.915338,-0.375448,4.44076,2.490353,0.629287,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.938303,-0.3372,0.076703,4.314039,2.32946,0.57751,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.963659,-0.230665,0.134738,4.440713,2.398472,0.629128,
-	-0.713872,-0.610821,0.342469,4.296769,2.260422,0.528796,
-	0.231006,-0.859096,0.456717,4.472349,2.325133,0.443764,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.713872,-0.610821,0.342469,4.296769,2.260422,0.528796,
-	-0.975013,-0.179566,0.130791,4.442912,2.343263,0.53322,
-	-0.938303,-0.3372,0.076703,4.314039,2.32946,0.57751,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.963659,-0.230665,0.134738,4.440713,2.398472,0.629128,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	-0.963659,-0.230665,0.134738,4.440713,2.398472,0.629128,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	-0.210882,0.942026,-0.260988,4.484667,2.534451,0.708888,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.990956,-0.062739,0.118613,4.474625,2.465214,0.75189,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	-0.502348,0.838173,-0.212398,4.520165,2.557971,0.762427,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	0.3335,0.232683,0.913584,4.554459,2.511417,0.850571,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	0.3335,0.232683,0.913584,4.554459,2.511417,0.850571,
-	-0.841909,-0.49598,0.212588,4.538177,2.513353,0.776566,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	-0.768362,0.592231,-0.242657,4.59262,2.569879,0.790452,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	0.3335,0.232683,0.913584,4.554459,2.511417,0.850571,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	0.911709,-0.064353,0.405764,4.601515,2.533324,0.794193,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	-0.274209,-0.939323,-0.20611,4.829566,2.580797,0.821827,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	0.245858,0.150988,0.957474,4.683344,2.554221,0.821927,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	-0.981668,0.173926,-0.077954,4.674691,2.598833,0.808006,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.274209,-0.939323,-0.20611,4.829566,2.580797,0.821827,
-	-0.396467,0.225967,0.889805,4.737893,2.564648,0.830389,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.274209,-0.939323,-0.20611,4.829566,2.580797,0.821827,
-	-0.984655,0.15519,0.07981,4.729447,2.606204,0.807513,
-	-0.791764,-0.610494,-0.020171,4.821336,2.621498,0.789636,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	0.3335,0.232683,0.913584,4.554459,2.511417,0.850571,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	0.895851,0.326389,0.301532,4.681847,2.551036,0.886235,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	-0.279333,0.256918,0.925184,4.755192,2.568818,0.876311,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.137011,-0.928676,0.344657,4.883022,2.613658,0.893163,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	-0.250481,-0.945625,-0.207493,4.352603,2.524888,0.890532,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	0.3335,0.232683,0.913584,4.554459,2.511417,0.850571,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	0.760119,-0.003927,0.649772,4.444739,2.475795,0.860515,
-	-0.250481,-0.945625,-0.207493,4.352603,2.524888,0.890532,
-	-0.19553,-0.978064,0.071821,4.192789,2.411967,0.668016,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	-0.19553,-0.978064,0.071821,4.192789,2.411967,0.668016,
-	-0.719395,-0.61545,0.322011,4.382053,2.433474,0.798757,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.938303,-0.3372,0.076703,4.314039,2.32946,0.57751,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.473779,-0.24744,0.845167,4.32063,2.385528,0.682583,
-	-0.19553,-0.978064,0.071821,4.192789,2.411967,0.668016,
-	-0.713872,-0.610821,0.342469,4.296769,2.260422,0.528796,
-	-0.938303,-0.3372,0.076703,4.314039,2.32946,0.57751,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.713872,-0.610821,0.342469,4.296769,2.260422,0.528796,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.124529,-0.930217,0.345238,4.113935,2.334131,0.526471,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.137011,-0.928676,0.344657,4.883022,2.613658,0.893163,
-	-0.137011,-0.928676,0.344657,4.883022,2.613658,0.893163,
-	0.186393,-0.974436,-0.125429,4.854957,2.660227,0.92431,
-	-0.124529,-0.930217,0.345238,4.735139,2.645464,0.95089,
-	-0.137011,-0.928676,0.344657,4.883022,2.613658,0.893163,
-	-0.124529,-0.930217,0.345238,4.735139,2.645464,0.95089,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	-0.124529,-0.930217,0.345238,4.735139,2.645464,0.95089,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.137011,-0.928676,0.344657,4.763337,2.590834,0.929248,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.21443,-0.974064,0.072245,4.662221,2.556346,0.940618,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	-0.21443,-0.974064,0.072245,4.497719,2.54748,0.937659,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	-0.250481,-0.945625,-0.207493,4.352603,2.524888,0.890532,
-	-0.250481,-0.945625,-0.207493,4.352603,2.524888,0.890532,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.250481,-0.945625,-0.207493,4.352603,2.524888,0.890532,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.250481,-0.945625,-0.207493,4.262798,2.490674,0.818316,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.19553,-0.978064,0.071821,4.192789,2.411967,0.668016,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	0.186393,-0.974436,-0.125429,4.854957,2.660227,0.92431,
-	-0.137011,-0.928676,0.344657,4.883022,2.613658,0.893163,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.19553,-0.978064,0.071821,4.192789,2.411967,0.668016,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.973393,-0.128296,0.18986,4.121994,2.458034,0.570029,
-	-0.138401,-0.989733,0.035683,4.07851,2.41181,0.472193,
-	-0.124529,-0.930217,0.345238,4.113935,2.334131,0.526471,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.138401,-0.989733,0.035683,4.07851,2.41181,0.472193,
-	-0.19553,-0.978064,0.071821,4.193959,2.370476,0.616705,
-	-0.973393,-0.128296,0.18986,4.121994,2.458034,0.570029,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	-0.942162,-0.29295,-0.162822,4.343217,2.589542,0.893106,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.822149,-0.367113,0.435086,4.6248,2.708372,0.989445,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	-0.199236,-0.974239,-0.105658,4.460582,2.622875,0.957002,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	-0.982438,-0.108835,-0.151559,4.244622,2.554467,0.811726,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.973393,-0.128296,0.18986,4.121994,2.458034,0.570029,
-	-0.668254,-0.729938,-0.143622,4.138687,2.474013,0.642311,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	-0.973393,-0.128296,0.18986,4.121994,2.458034,0.570029,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	-0.138401,-0.989733,0.035683,4.07851,2.41181,0.472193,
-	-0.973393,-0.128296,0.18986,4.121994,2.458034,0.570029,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	-0.138401,-0.989733,0.035683,4.07851,2.41181,0.472193,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	0.207048,-0.965263,0.159371,4.088356,2.510913,0.453793,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	-0.124529,-0.930217,0.345238,4.735139,2.645464,0.95089,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	0.361848,-0.921221,-0.142892,4.615662,2.63387,0.977986,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	-0.822149,-0.367113,0.435086,4.6248,2.708372,0.989445,
-	0.186393,-0.974436,-0.125429,4.854957,2.660227,0.92431,
-	0.728229,-0.106722,-0.676973,4.863709,2.722151,0.93666,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	0.186393,-0.974436,-0.125429,4.854957,2.660227,0.92431,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	-0.124529,-0.930217,0.345238,4.735139,2.645464,0.95089,
-	-0.904972,-0.026555,0.424641,4.209941,2.600612,0.337597,
-	0.576293,-0.081905,-0.813128,4.117367,2.568514,0.3845,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	-0.904972,-0.026555,0.424641,4.209941,2.600612,0.337597,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	-0.266521,-0.953514,0.14063,4.462368,2.725999,0.882675,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.894795,0.444359,-0.043442,4.636909,2.750501,0.856859,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.266521,-0.953514,0.14063,4.462368,2.725999,0.882675,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	-0.266521,-0.953514,0.14063,4.462368,2.725999,0.882675,
-	-0.940256,0.335069,-0.060403,4.509555,2.719807,0.819972,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.31499,0.894135,-0.318282,4.418954,2.707401,0.782531,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	-0.778386,0.466325,0.420305,4.22473,2.624525,0.491916,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	0.576293,-0.081905,-0.813128,4.117367,2.568514,0.3845,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	0.576293,-0.081905,-0.813128,4.117367,2.568514,0.3845,
-	0.207048,-0.965263,0.159371,4.088356,2.510913,0.453793,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	-0.671788,0.737297,0.07138,4.35668,2.682996,0.71905,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	0.225135,0.965893,0.127928,4.277169,2.652435,0.591369,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	0.42646,-0.865041,0.264264,4.151183,2.579059,0.494606,
-	-0.075112,-0.981815,0.174346,4.104292,2.537976,0.543437,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	0.333262,-0.530645,-0.779328,4.176065,2.636883,0.618384,
-	-0.501842,-0.819591,0.27645,4.138494,2.557838,0.652651,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	-0.180888,-0.792822,-0.58199,4.273414,2.686575,0.753674,
-	-0.601432,-0.796051,0.067694,4.235494,2.636171,0.803613,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	-0.266521,-0.953514,0.14063,4.462368,2.725999,0.882675,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	-0.393317,-0.870591,-0.295589,4.354196,2.711836,0.826545,
-	-0.927379,-0.346541,0.14099,4.342998,2.664049,0.904347,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	0.136995,-0.968757,-0.206741,4.735445,2.749285,0.940329,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	-0.894795,0.444359,-0.043442,4.636909,2.750501,0.856859,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	0.136995,-0.968757,-0.206741,4.735445,2.749285,0.940329,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	-0.463096,-0.149333,0.873637,4.719171,2.751091,0.865965,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	-0.862876,-0.450622,0.228877,4.801436,2.750224,0.858918,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.862876,-0.450622,0.228877,4.801436,2.750224,0.858918,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	-0.822149,-0.367113,0.435086,4.6248,2.708372,0.989445,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.850433,-0.132742,0.509061,4.460786,2.695616,0.949972,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.266521,-0.953514,0.14063,4.462368,2.725999,0.882675,
-	-0.822149,-0.367113,0.435086,4.6248,2.708372,0.989445,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	0.136995,-0.968757,-0.206741,4.735445,2.749285,0.940329,
-	-0.822149,-0.367113,0.435086,4.6248,2.708372,0.989445,
-	0.136995,-0.968757,-0.206741,4.735445,2.749285,0.940329,
-	0.078387,-0.886884,0.455294,4.616626,2.749486,0.939333,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	0.136995,-0.968757,-0.206741,4.735445,2.749285,0.940329,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	0.846486,-0.14409,-0.512541,4.753015,2.699695,0.973279,
-	0.728229,-0.106722,-0.676973,4.863709,2.722151,0.93666,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.460229,-0.015586,-0.887663,4.827733,2.75439,0.905049,
-	0.728229,-0.106722,-0.676973,4.863709,2.722151,0.93666,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	0.728229,-0.106722,-0.676973,4.863709,2.722151,0.93666,
-	0.186393,-0.974436,-0.125429,4.854957,2.660227,0.92431,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.274209,-0.939323,-0.20611,4.829566,2.580797,0.821827,
-	-0.791764,-0.610494,-0.020171,4.821336,2.621498,0.789636,
-	-0.916647,-0.2944,0.270344,5.096148,2.75972,0.774729,
-	-0.274209,-0.939323,-0.20611,4.856249,2.593812,0.867067,
-	-0.274209,-0.939323,-0.20611,4.829566,2.580797,0.821827
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1020,data,NULL};
-const struct gllist *cow_horns=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char cow_horns[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\266\000\000\000\374\003\000\000\010\002\000\000"
+ "f\313\222@\001\245 @\000\000\000\000\077N\3757\030\321\316\016]\300\000\000"
+ ".\317\266\013T\324\000\000\210\336\372\006\203\323\000\000\207\340\306\011"
+ "\024\303\000\000+\351\270\376x\322\000\000\304\350\312\002\012\301\000\000"
+ "\341\327k\022\200\263\000\000\207\342\257\015\313\262\000\000\277\352\242"
+ "\006\354\261\000\000*\342_\026\374\242\000\000C\351\344\023\300\243\000\000"
+ "\234\361~\014q\246\000\0008\352\207\031\305\232\000\0006\360\372\027\012"
+ "\236\000\000^\367\263\020\216\237\000\000\360\365\042\033\355\225\000\000"
+ "\275\372\277\031\006\230\000\000Y\376\254\024\015\233\000\000a\361%\364A"
+ "\321\000\000p\3558\370\351\277\000\000\012\355s\375\230\256\000\000\270\362"
+ "'\003L\244\000\000P\3672\006_\235\000\000\257\000\275\007\277\231\000\000"
+ "\365\010\015\026\215\230\000\000M\013{\013z\227\000\000\256\007H\034\240"
+ "\225\000\000j\006\032\037(\221\000\000\312\024y\026\201\230\000\000b\022"
+ "p\014\212\227\000\000Q\022g\033J\224\000\000\016\021.\037\372\217\000\000"
+ "E\036\202\027\217\231\000\000F\036j\016\332\231\000\000\012\035H\034\205"
+ "\226\000\000\262\033\021\037\344\220\000\000\322AL \310\233\000\000Q\355"
+ "l\352\006\273\000\000 \361\023\350\230\306\000\000\011\355\220\361\235\256"
+ "\000\000l\3612\372\274\236\000\000\246\334\243\350K\265\000\000\200\335\344"
+ "\357\263\247\000\000j\332\264\337\230\273\000\000r\345\027\366\254\230\000"
+ "\000\244\371m\000\213\233\000\000\216\355\221\373\257\220\000\000\326\001"
+ "\002\003C\231\000\000\277\373-\000\370\221\000\000l\014\266\005\255\225\000"
+ "\000:\014M\005[\215\000\000z\023\017\007\224\224\000\000\267\025\231\007"
+ "\244\216\000\000V\037&\011\260\225\000\000\312\042\325\012\326\217\000\000"
+ "\260\011\374\005R\206\000\000h\364\327\004\264\206\000\000\305\026s\012\313"
+ "\207\000\000@&f\015v\214\000\000\243\341\353\001\315\214\000\000\005\326"
+ "~\375$\226\000\000\366\314O\363\226\251\000\000\035\315\361\3559\260\000"
+ "\000\303\302=\351\345\273\000\000\037\023\204\021\376\204\000\000\237\042"
+ "m\023n\210\000\000\252\003\004\020|\201\000\000\233\357\230\0163\204\000"
+ "\000l\340H\012w\214\000\000\253\323\276\005\376\226\000\000\367\305V\373"
+ "\351\254\000\000\316\303E\371C\266\000\000.\276J\363\353\302\000\000|\322"
+ "P\020\013\230\000\000e\340\353\023\003\213\000\000\241\357\001\030\034\205"
+ "\000\000\331\004\247\031\001\200\000\000\360\305.\006\222\253\000\000\203"
+ "\301\234\003\263\271\000\000t\277\034\000L\305\000\000o\025\210\030\030\202"
+ "\000\000\301#o\033\325\206\000\000\224\307\355\010\004\300\000\0004\303\217"
+ "\007C\316\000\000\312\003\371\036}\206\000\000\326\357\357\033\321\215\000"
+ "\000\327\341\032\032\024\225\000\000d\327\325\026\201\236\000\000\314\312"
+ "h\020\001\260\000\000)\023\362\036\134\206\000\000\031\037\233\037\354\212"
+ "\000\000\207\340\306\011\354<\000\000\210\336\372\006},\000\000.\317\266"
+ "\013\254+\000\000\030\321\316\016\243\077\000\000\304\350\312\002\366>\000"
+ "\000+\351\270\376\210-\000\000\207\342\257\0155M\000\000\341\327k\022\200"
+ "L\000\000\277\352\242\006\024N\000\000C\351\344\023@\134\000\000*\342_\026"
+ "\004]\000\000\234\361~\014\217Y\000\0006\360\372\027\366a\000\0008\352\207"
+ "\031;e\000\000^\367\263\020r`\000\000\275\372\277\031\372g\000\000\360\365"
+ "\042\033\023j\000\000Y\376\254\024\363d\000\000p\3558\370\027@\000\000a\361"
+ "%\364\277.\000\000\012\355s\375hQ\000\000\270\362'\003\264[\000\000P\367"
+ "2\006\241b\000\000\257\000\275\007Af\000\000M\013{\013\206h\000\000\365\010"
+ "\015\026sg\000\000\256\007H\034`j\000\000j\006\032\037\330n\000\000b\022"
+ "p\014vh\000\000\312\024y\026\177g\000\000Q\022g\033\266k\000\000\016\021"
+ ".\037\006p\000\000F\036j\016&f\000\000E\036\202\027qf\000\000\012\035H\034"
+ "{i\000\000\262\033\021\037\034o\000\000\322AL 8d\000\000 \361\023\350h9\000"
+ "\000Q\355l\352\372D\000\000\011\355\220\361cQ\000\000l\3612\372Da\000\000"
+ "\200\335\344\357MX\000\000\246\334\243\350\265J\000\000j\332\264\337hD\000"
+ "\000r\345\027\366Tg\000\000\244\371m\000ud\000\000\216\355\221\373Qo\000"
+ "\000\326\001\002\003\275f\000\000\277\373-\000\010n\000\000l\014\266\005"
+ "Sj\000\000:\014M\005\245r\000\000\267\025\231\007\134q\000\000z\023\017\007"
+ "lk\000\000\312\042\325\012*p\000\000V\037&\011Pj\000\000h\364\327\004Ly\000"
+ "\000\260\011\374\005\256y\000\000\305\026s\0125x\000\000@&f\015\212s\000"
+ "\000\243\341\353\0013s\000\000\005\326~\375\334i\000\000\366\314O\363jV\000"
+ "\000\035\315\361\355\307O\000\000\303\302=\351\033D\000\000\237\042m\023"
+ "\222w\000\000\037\023\204\021\002{\000\000\252\003\004\020\204~\000\000\233"
+ "\357\230\016\315{\000\000l\340H\012\211s\000\000\253\323\276\005\002i\000"
+ "\000\367\305V\373\027S\000\000\316\303E\371\275I\000\000.\276J\363\025=\000"
+ "\000e\340\353\023\375t\000\000|\322P\020\365g\000\000\241\357\001\030\344"
+ "z\000\000\331\004\247\031\377\177\000\000\360\305.\006nT\000\000\203\301"
+ "\234\003MF\000\000t\277\034\000\264:\000\000o\025\210\030\350}\000\000\301"
+ "#o\033+y\000\0004\303\217\007\2751\000\000\224\307\355\010\374\077\000\000"
+ "\326\357\357\033/r\000\000\312\003\371\036\203y\000\000\327\341\032\032\354"
+ "j\000\000d\327\325\026\177a\000\000\314\312h\020\377O\000\000)\023\362\036"
+ "\244y\000\000\031\037\233\037\024u\000\000\000\342\375=\377`\3639\362\031"
+ "\367[\001\077\134\300O\303>\3128\210/\205hH0\211*\3151\220\035\316'\224\026"
+ "\306#\230\015\270'\230\016\276*\227-\223\277\2063\2314\227\251\230\250\246"
+ "\262\251\256\250\232N\215\242\213\255\214\275\225\310\221\317ul\201(\234"
+ "D\241U\257b\302w\2312\235,\2433\2473\236\077\255F\253NFuCn\317]\314V\312"
+ "I\310K\312E\332v\333k\334d\325X\317I\266W\263K*z'w\271U\255P\215@\274`\271"
+ "a\302e\310b\257H\202\333\330r\313a\254I\203\326+m\042i\362Q\242:\346J\277"
+ "7\247.\247 \274/\332D\363Q\257\376\362m\253\376\305$\022T\327E\035h\026]"
+ "\327h\273!\306\077\322q\270>\313e\257&\260;\241&\271H\305Y\2519\322r\326"
+ "l\306V\260B\223\032\2424\207\024\252-\231\020\246\005\227\027\330\363\270"
+ "\310\321\325\267\320\271\333\261\347\023\271\240\356\244\352\225\371\332"
+ "\354\250\340\312\321\311\321\273\327D\000T\372\035\024\027\016K\033\350\026"
+ "\337\023\325\232\325\232\352\236\352\236\364\254\364\254\327\230\327\230"
+ "\354\234\354\234\365\254\037\223\365\254-\241\342\225\234\327\214\345\275"
+ "\270\240\363\361\224\255\341\314\273\270\365\300\343\330\277\370\233\024"
+ "\244s\311v\276x\263#\271\347\247\007\261\310\241\302\220V\233!\216\202\254"
+ "\000\000\001\000\002\000\000\000\002\000\003\000\003\000\002\000\004\000"
+ "\003\000\004\000\005\000\006\000\000\000\003\000\006\000\003\000\007\000"
+ "\007\000\003\000\005\000\007\000\005\000\010\000\011\000\006\000\007\000"
+ "\011\000\007\000\012\000\012\000\007\000\010\000\012\000\010\000\013\000"
+ "\014\000\011\000\012\000\014\000\012\000\015\000\012\000\013\000\016\000"
+ "\012\000\016\000\015\000\017\000\014\000\015\000\017\000\015\000\020\000"
+ "\015\000\016\000\021\000\015\000\021\000\020\000\005\000\004\000\022\000"
+ "\005\000\022\000\023\000\010\000\005\000\023\000\010\000\023\000\024\000"
+ "\013\000\010\000\024\000\013\000\024\000\025\000\016\000\013\000\025\000"
+ "\016\000\025\000\026\000\021\000\016\000\026\000\021\000\026\000\027\000"
+ "\030\000\021\000\027\000\030\000\027\000\031\000\032\000\020\000\021\000"
+ "\032\000\021\000\030\000\033\000\017\000\020\000\033\000\020\000\032\000"
+ "\034\000\030\000\031\000\034\000\031\000\035\000\036\000\032\000\030\000"
+ "\036\000\030\000\034\000\037\000\033\000\032\000\037\000\032\000\036\000"
+ " \000\034\000\035\000 \000\035\000!\000\042\000\036\000\034\000\042\000\034"
+ "\000 \000\037\000\036\000\042\000\037\000\042\000#\000$\000#\000\042\000"
+ "$\000\042\000 \000$\000 \000!\000%\000\023\000\022\000%\000\022\000&\000"
+ "'\000\024\000\023\000'\000\023\000%\000\025\000\024\000'\000\025\000'\000"
+ "(\000'\000%\000)\000'\000)\000*\000)\000%\000&\000)\000&\000+\000(\000'\000"
+ "*\000(\000*\000,\000\026\000\025\000(\000\026\000(\000-\000-\000(\000,\000"
+ "-\000,\000.\000\027\000\026\000-\000\027\000-\000/\000/\000-\000.\000/\000"
+ ".\0000\000\031\000\027\000/\000\031\000/\0001\0001\000/\0000\0001\0000\000"
+ "2\0003\0001\0002\0003\0002\0004\0005\0003\0004\0005\0004\0006\000\035\000"
+ "\031\0001\000\035\0001\0003\000!\000\035\0003\000!\0003\0005\0007\0002\000"
+ "0\0007\0000\0008\0002\0007\0009\0002\0009\0004\000:\0006\0004\000:\0004\000"
+ "9\0000\000.\000;\0000\000;\0008\000;\000.\000,\000;\000,\000<\000<\000,\000"
+ "*\000<\000*\000=\000=\000*\000)\000=\000)\000>\000\077\000>\000)\000\077"
+ "\000)\000+\000:\000$\0006\0009\000@\000A\0009\000A\000:\0007\000B\000@\000"
+ "7\000@\0009\0008\000C\000B\0008\000B\0007\000;\000D\000C\000;\000C\0008\000"
+ "<\000E\000D\000<\000D\000;\000=\000F\000E\000=\000E\000<\000:\000A\000$\000"
+ "G\000F\000=\000G\000=\000>\000G\000>\000\077\000G\000\077\000H\000E\000I"
+ "\000J\000E\000J\000D\000D\000J\000K\000D\000K\000C\000C\000K\000L\000C\000"
+ "L\000B\000F\000M\000I\000F\000I\000E\000N\000M\000F\000N\000F\000G\000O\000"
+ "N\000G\000O\000G\000H\000L\000P\000@\000L\000@\000B\000@\000P\000Q\000@\000"
+ "Q\000A\000\000\000R\000S\000\000\000S\000\001\000\033\000T\000U\000\033\000"
+ "U\000\017\000\017\000U\000V\000\017\000V\000\014\000\014\000V\000W\000\014"
+ "\000W\000\011\000R\000\000\000\006\000R\000\006\000X\000O\000S\000R\000O"
+ "\000R\000N\000X\000\006\000\011\000X\000\011\000W\000N\000R\000X\000N\000"
+ "X\000M\000M\000X\000W\000M\000W\000I\000I\000W\000V\000I\000V\000J\000J\000"
+ "V\000U\000J\000U\000K\000\033\000\037\000Y\000\033\000Y\000T\000#\000Z\000"
+ "Y\000#\000Y\000\037\000Z\000#\000$\000U\000T\000L\000U\000L\000K\000T\000"
+ "Y\000P\000T\000P\000L\000Q\000P\000Y\000Q\000Y\000Z\000Q\000Z\000$\000A\000"
+ "Q\000$\000!\0005\000$\0005\0006\000$\000[\000\134\000]\000[\000]\000^\000"
+ "_\000`\000\134\000_\000\134\000[\000a\000[\000^\000a\000^\000b\000c\000_"
+ "\000[\000c\000[\000a\000d\000a\000b\000d\000b\000e\000f\000c\000a\000f\000"
+ "a\000d\000g\000d\000e\000g\000e\000h\000g\000i\000f\000g\000f\000d\000j\000"
+ "g\000h\000j\000h\000k\000j\000l\000i\000j\000i\000g\000m\000n\000`\000m\000"
+ "`\000_\000o\000m\000_\000o\000_\000c\000p\000o\000c\000p\000c\000f\000q\000"
+ "p\000f\000q\000f\000i\000r\000q\000i\000r\000i\000l\000s\000r\000l\000s\000"
+ "l\000t\000t\000l\000j\000t\000j\000u\000u\000j\000k\000u\000k\000v\000w\000"
+ "s\000t\000w\000t\000x\000x\000t\000u\000x\000u\000y\000y\000u\000v\000y\000"
+ "v\000z\000{\000w\000x\000{\000x\000|\000|\000x\000y\000|\000y\000}\000~\000"
+ "}\000y\000~\000y\000z\000}\000~\000\177\000|\000}\000\177\000{\000|\000\177"
+ "\000\200\000n\000m\000\200\000m\000\201\000\201\000m\000o\000\201\000o\000"
+ "\202\000\203\000\202\000o\000\203\000o\000p\000\204\000\205\000\201\000\204"
+ "\000\201\000\202\000\206\000\200\000\201\000\206\000\201\000\205\000\207"
+ "\000\204\000\202\000\207\000\202\000\203\000\210\000\203\000p\000\210\000"
+ "p\000q\000\211\000\207\000\203\000\211\000\203\000\210\000\212\000\210\000"
+ "q\000\212\000q\000r\000\213\000\211\000\210\000\213\000\210\000\212\000\214"
+ "\000\212\000r\000\214\000r\000s\000\215\000\213\000\212\000\215\000\212\000"
+ "\214\000\216\000\215\000\214\000\216\000\214\000\217\000\220\000\216\000"
+ "\217\000\220\000\217\000\221\000\217\000\214\000s\000\217\000s\000w\000\221"
+ "\000\217\000w\000\221\000w\000{\000\222\000\213\000\215\000\222\000\215\000"
+ "\223\000\216\000\224\000\223\000\216\000\223\000\215\000\224\000\216\000"
+ "\220\000\224\000\220\000\225\000\222\000\226\000\211\000\222\000\211\000"
+ "\213\000\227\000\207\000\211\000\227\000\211\000\226\000\230\000\204\000"
+ "\207\000\230\000\207\000\227\000\231\000\205\000\204\000\231\000\204\000"
+ "\230\000\206\000\205\000\231\000\206\000\231\000\232\000\220\000\177\000"
+ "\225\000\225\000\233\000\234\000\225\000\234\000\224\000\224\000\234\000"
+ "\235\000\224\000\235\000\223\000\223\000\235\000\236\000\223\000\236\000"
+ "\222\000\222\000\236\000\237\000\222\000\237\000\226\000\226\000\237\000"
+ "\240\000\226\000\240\000\227\000\227\000\240\000\241\000\227\000\241\000"
+ "\230\000\177\000\233\000\225\000\231\000\230\000\241\000\231\000\241\000"
+ "\242\000\243\000\232\000\231\000\243\000\231\000\242\000\237\000\244\000"
+ "\245\000\237\000\245\000\240\000\236\000\246\000\244\000\236\000\244\000"
+ "\237\000\235\000\247\000\246\000\235\000\246\000\236\000\240\000\245\000"
+ "\250\000\240\000\250\000\241\000\242\000\241\000\250\000\242\000\250\000"
+ "\251\000\243\000\242\000\251\000\243\000\251\000\252\000\235\000\234\000"
+ "\253\000\235\000\253\000\247\000\233\000\254\000\253\000\233\000\253\000"
+ "\234\000]\000\255\000\256\000]\000\256\000^\000k\000\257\000\260\000k\000"
+ "\260\000v\000h\000\261\000\257\000h\000\257\000k\000e\000\262\000\261\000"
+ "e\000\261\000h\000\263\000b\000^\000\263\000^\000\256\000\251\000\256\000"
+ "\255\000\251\000\255\000\252\000\262\000e\000b\000\262\000b\000\263\000\250"
+ "\000\263\000\256\000\250\000\256\000\251\000\245\000\262\000\263\000\245"
+ "\000\263\000\250\000\244\000\261\000\262\000\244\000\262\000\245\000\246"
+ "\000\257\000\261\000\246\000\261\000\244\000\260\000\264\000z\000\260\000"
+ "z\000v\000z\000\264\000\265\000z\000\265\000~\000\177\000~\000\265\000\246"
+ "\000\247\000\260\000\246\000\260\000\257\000\247\000\253\000\264\000\247"
+ "\000\264\000\260\000\265\000\264\000\253\000\265\000\253\000\254\000\177"
+ "\000\265\000\254\000\177\000\254\000\233\000\177\000\221\000{\000\177\000"
+ "\220\000\221\000\000\000\001\000\001\000\002\000\000\000\002\000\002\000"
+ "\003\000\000\000\003\000\002\000\004\000\003\000\004\000\004\000\005\000"
+ "\003\000\005\000\000\000\006\000\003\000\006\000\003\000\007\000\006\000"
+ "\007\000\005\000\007\000\005\000\010\000\007\000\010\000\006\000\011\000"
+ "\007\000\011\000\007\000\012\000\011\000\012\000\010\000\012\000\010\000"
+ "\013\000\012\000\013\000\011\000\014\000\012\000\014\000\012\000\015\000"
+ "\014\000\015\000\013\000\016\000\012\000\016\000\015\000\016\000\014\000"
+ "\017\000\015\000\017\000\015\000\020\000\017\000\020\000\016\000\021\000"
+ "\015\000\021\000\020\000\021\000\004\000\022\000\005\000\022\000\022\000"
+ "\023\000\005\000\023\000\010\000\023\000\023\000\024\000\010\000\024\000"
+ "\013\000\024\000\024\000\025\000\013\000\025\000\016\000\025\000\025\000"
+ "\026\000\016\000\026\000\021\000\026\000\026\000\027\000\021\000\027\000"
+ "\021\000\030\000\027\000\030\000\027\000\031\000\030\000\031\000\020\000"
+ "\032\000\021\000\032\000\030\000\032\000\017\000\033\000\020\000\033\000"
+ "\032\000\033\000\030\000\034\000\031\000\034\000\031\000\035\000\034\000"
+ "\035\000\032\000\036\000\030\000\036\000\034\000\036\000\033\000\037\000"
+ "\032\000\037\000\036\000\037\000\034\000 \000\035\000 \000\035\000!\000 "
+ "\000!\000\036\000\042\000\034\000\042\000 \000\042\000\037\000\042\000\042"
+ "\000#\000\037\000#\000#\000$\000\042\000$\000 \000$\000!\000$\000\023\000"
+ "%\000\022\000%\000\022\000&\000%\000&\000\024\000'\000\023\000'\000%\000"
+ "'\000\025\000'\000'\000(\000\025\000(\000%\000)\000'\000)\000)\000*\000'"
+ "\000*\000&\000)\000&\000+\000)\000+\000(\000*\000*\000,\000(\000,\000\026"
+ "\000(\000(\000-\000\026\000-\000,\000-\000,\000.\000-\000.\000\027\000-\000"
+ "-\000/\000\027\000/\000.\000/\000.\0000\000/\0000\000\031\000/\000/\0001"
+ "\000\031\0001\0000\0001\0000\0002\0001\0002\0001\0003\0002\0003\0002\000"
+ "4\0003\0004\0003\0005\0004\0005\0004\0006\0005\0006\000\035\0001\000\035"
+ "\0003\000!\0003\000!\0005\0002\0007\0000\0007\0000\0008\0007\0008\0007\000"
+ "9\0002\0009\0004\0009\0006\000:\0004\000:\0009\000:\000.\000;\0000\000;\000"
+ "8\000;\000,\000;\000,\000<\000;\000<\000*\000<\000*\000=\000<\000=\000)\000"
+ "=\000)\000>\000=\000>\000>\000\077\000)\000\077\000+\000\077\000$\000:\000"
+ "$\0006\0009\000@\000@\000A\0009\000A\000:\000A\0007\000B\000@\000B\0007\000"
+ "@\0008\000C\000B\000C\0008\000B\000;\000D\000C\000D\000;\000C\000<\000E\000"
+ "D\000E\000<\000D\000=\000F\000E\000F\000=\000E\000$\000A\000F\000G\000=\000"
+ "G\000>\000G\000\077\000G\000\077\000H\000G\000H\000E\000I\000I\000J\000E"
+ "\000J\000D\000J\000J\000K\000D\000K\000C\000K\000K\000L\000C\000L\000B\000"
+ "L\000F\000M\000I\000M\000F\000I\000M\000N\000F\000N\000G\000N\000N\000O\000"
+ "G\000O\000H\000O\000L\000P\000@\000P\000@\000L\000P\000Q\000@\000Q\000A\000"
+ "Q\000\000\000R\000R\000S\000\000\000S\000\001\000S\000\033\000T\000T\000"
+ "U\000\033\000U\000\017\000U\000U\000V\000\017\000V\000\014\000V\000V\000"
+ "W\000\014\000W\000\011\000W\000\006\000R\000\006\000X\000R\000X\000O\000"
+ "S\000O\000R\000N\000R\000\011\000X\000W\000X\000N\000X\000M\000X\000M\000"
+ "W\000I\000W\000I\000V\000J\000V\000J\000U\000K\000U\000\037\000Y\000\033"
+ "\000Y\000T\000Y\000#\000Z\000Y\000Z\000#\000Y\000$\000Z\000L\000T\000L\000"
+ "U\000P\000Y\000P\000T\000Q\000Y\000Q\000Z\000$\000Q\000$\0005\000[\000\134"
+ "\000\134\000]\000[\000]\000]\000^\000[\000^\000_\000`\000\134\000`\000\134"
+ "\000_\000[\000_\000[\000a\000^\000a\000^\000b\000a\000b\000_\000c\000[\000"
+ "c\000a\000c\000a\000d\000b\000d\000b\000e\000d\000e\000c\000f\000a\000f\000"
+ "d\000f\000d\000g\000e\000g\000e\000h\000g\000h\000g\000i\000f\000i\000f\000"
+ "g\000g\000j\000h\000j\000h\000k\000j\000k\000j\000l\000i\000l\000i\000j\000"
+ "m\000n\000`\000n\000`\000m\000_\000m\000m\000o\000_\000o\000c\000o\000o\000"
+ "p\000c\000p\000f\000p\000p\000q\000f\000q\000i\000q\000q\000r\000i\000r\000"
+ "l\000r\000r\000s\000l\000s\000l\000t\000s\000t\000j\000t\000j\000u\000t\000"
+ "u\000k\000u\000k\000v\000u\000v\000s\000w\000t\000w\000t\000x\000w\000x\000"
+ "u\000x\000u\000y\000x\000y\000v\000y\000v\000z\000y\000z\000w\000{\000x\000"
+ "{\000x\000|\000{\000|\000y\000|\000y\000}\000|\000}\000}\000~\000y\000~\000"
+ "z\000~\000~\000\177\000}\000\177\000|\000\177\000{\000\177\000n\000\200\000"
+ "m\000\200\000m\000\201\000\200\000\201\000o\000\201\000o\000\202\000\201"
+ "\000\202\000\202\000\203\000o\000\203\000p\000\203\000\204\000\205\000\201"
+ "\000\205\000\201\000\204\000\202\000\204\000\200\000\206\000\201\000\206"
+ "\000\205\000\206\000\204\000\207\000\202\000\207\000\203\000\207\000\203"
+ "\000\210\000p\000\210\000q\000\210\000\207\000\211\000\203\000\211\000\210"
+ "\000\211\000\210\000\212\000q\000\212\000r\000\212\000\211\000\213\000\210"
+ "\000\213\000\212\000\213\000\212\000\214\000r\000\214\000s\000\214\000\213"
+ "\000\215\000\212\000\215\000\214\000\215\000\215\000\216\000\214\000\216"
+ "\000\214\000\217\000\216\000\217\000\216\000\220\000\217\000\220\000\217"
+ "\000\221\000\220\000\221\000s\000\217\000w\000\217\000w\000\221\000{\000"
+ "\221\000\213\000\222\000\215\000\222\000\215\000\223\000\222\000\223\000"
+ "\216\000\224\000\223\000\224\000\216\000\223\000\220\000\224\000\220\000"
+ "\225\000\224\000\225\000\222\000\226\000\211\000\226\000\211\000\222\000"
+ "\207\000\227\000\211\000\227\000\226\000\227\000\204\000\230\000\207\000"
+ "\230\000\227\000\230\000\205\000\231\000\204\000\231\000\230\000\231\000"
+ "\206\000\231\000\231\000\232\000\206\000\232\000\177\000\220\000\177\000"
+ "\225\000\225\000\233\000\233\000\234\000\225\000\234\000\224\000\234\000"
+ "\234\000\235\000\224\000\235\000\223\000\235\000\235\000\236\000\223\000"
+ "\236\000\222\000\236\000\236\000\237\000\222\000\237\000\226\000\237\000"
+ "\237\000\240\000\226\000\240\000\227\000\240\000\240\000\241\000\227\000"
+ "\241\000\230\000\241\000\177\000\233\000\231\000\241\000\241\000\242\000"
+ "\231\000\242\000\232\000\243\000\231\000\243\000\242\000\243\000\237\000"
+ "\244\000\244\000\245\000\237\000\245\000\240\000\245\000\236\000\246\000"
+ "\244\000\246\000\236\000\244\000\235\000\247\000\246\000\247\000\235\000"
+ "\246\000\245\000\250\000\240\000\250\000\241\000\250\000\242\000\250\000"
+ "\250\000\251\000\242\000\251\000\243\000\251\000\251\000\252\000\243\000"
+ "\252\000\234\000\253\000\235\000\253\000\247\000\253\000\233\000\254\000"
+ "\253\000\254\000\233\000\253\000]\000\255\000\255\000\256\000]\000\256\000"
+ "^\000\256\000k\000\257\000\257\000\260\000k\000\260\000v\000\260\000h\000"
+ "\261\000\257\000\261\000h\000\257\000e\000\262\000\261\000\262\000e\000\261"
+ "\000b\000\263\000^\000\263\000\256\000\263\000\251\000\256\000\251\000\255"
+ "\000\252\000\255\000b\000\262\000\262\000\263\000\250\000\263\000\250\000"
+ "\256\000\245\000\262\000\245\000\263\000\244\000\261\000\244\000\262\000"
+ "\246\000\257\000\246\000\261\000\260\000\264\000z\000\264\000z\000\260\000"
+ "\264\000\265\000z\000\265\000~\000\265\000\177\000\265\000\247\000\260\000"
+ "\246\000\260\000\253\000\264\000\247\000\264\000\253\000\265\000\254\000"
+ "\265\000\177\000\254\000\177\000\221\000"
+;
+const unsigned long cow_horns_size = 6020;
@@ -1,1520 +1,445 @@
+/* Generated from "cow_udder.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.058723,-0.195869,-0.97887,-2.033406,-0.91003,-0.96422,
-	-0.977902,-0.171036,-0.12023,-2.119856,-1.1288,-0.97096,
-	0.07657,0.16758,-0.982881,-2.306662,-1.116976,-0.961238,
-	-0.977902,-0.171036,-0.12023,-2.119856,-1.1288,-0.97096,
-	0.058723,-0.195869,-0.97887,-2.033406,-0.91003,-0.96422,
-	-0.964119,-0.189683,-0.18573,-2.031698,-1.097344,-0.966701,
-	-0.964119,-0.189683,-0.18573,-2.031698,-1.097344,-0.966701,
-	0.058723,-0.195869,-0.97887,-2.033406,-0.91003,-0.96422,
-	-0.30296,-0.137183,-0.943078,-1.782298,-1.020581,-0.943381,
-	-0.955382,-0.23808,-0.174826,-2.462835,-1.3055,-0.966395,
-	0.07657,0.16758,-0.982881,-2.306662,-1.116976,-0.961238,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	0.07657,0.16758,-0.982881,-2.306662,-1.116976,-0.961238,
-	-0.977902,-0.171036,-0.12023,-2.119856,-1.1288,-0.97096,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	-0.977902,-0.171036,-0.12023,-2.119856,-1.1288,-0.97096,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	-0.977902,-0.171036,-0.12023,-2.119856,-1.1288,-0.97096,
-	-0.964119,-0.189683,-0.18573,-2.031698,-1.097344,-0.966701,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	-0.964119,-0.189683,-0.18573,-2.031698,-1.097344,-0.966701,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	-0.964119,-0.189683,-0.18573,-2.031698,-1.097344,-0.966701,
-	-0.30296,-0.137183,-0.943078,-1.782298,-1.020581,-0.943381,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	-0.30296,-0.137183,-0.943078,-1.782298,-1.020581,-0.943381,
-	0.335613,-0.388493,-0.858159,-1.776785,-1.275107,-0.914703,
-	0.335613,-0.388493,-0.858159,-1.776785,-1.275107,-0.914703,
-	-0.30296,-0.137183,-0.943078,-1.782298,-1.020581,-0.943381,
-	-0.004413,-0.170526,-0.985343,-1.709172,-1.283232,-0.897427,
-	-0.004413,-0.170526,-0.985343,-1.709172,-1.283232,-0.897427,
-	-0.30296,-0.137183,-0.943078,-1.782298,-1.020581,-0.943381,
-	0.095733,-0.224552,-0.969748,-1.456655,-1.295527,-0.89424,
-	0.137764,-0.289893,-0.947092,-2.591357,-1.510845,-0.88547,
-	-0.955382,-0.23808,-0.174826,-2.462835,-1.3055,-0.966395,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	0.137764,-0.289893,-0.947092,-2.591357,-1.510845,-0.88547,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	-0.843742,-0.096326,-0.528036,-2.337617,-1.334842,-0.966761,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	0.028952,-0.016247,-0.999449,-2.161843,-1.325837,-0.957465,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	0.093953,-0.049433,-0.994349,-2.042059,-1.312976,-0.940911,
-	0.335613,-0.388493,-0.858159,-1.776785,-1.275107,-0.914703,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	0.335613,-0.388493,-0.858159,-1.776785,-1.275107,-0.914703,
-	-0.004413,-0.170526,-0.985343,-1.709172,-1.283232,-0.897427,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	-0.004413,-0.170526,-0.985343,-1.709172,-1.283232,-0.897427,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	-0.004413,-0.170526,-0.985343,-1.709172,-1.283232,-0.897427,
-	0.095733,-0.224552,-0.969748,-1.456655,-1.295527,-0.89424,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	0.095733,-0.224552,-0.969748,-1.456655,-1.295527,-0.89424,
-	0.155794,-0.590112,-0.792146,-1.592146,-1.408592,-0.838483,
-	0.155794,-0.590112,-0.792146,-1.592146,-1.408592,-0.838483,
-	0.095733,-0.224552,-0.969748,-1.456655,-1.295527,-0.89424,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.161064,-0.731195,-0.662882,-1.659758,-1.544361,-0.788181,
-	0.155794,-0.590112,-0.792146,-1.592146,-1.408592,-0.838483,
-	0.155794,-0.590112,-0.792146,-1.592146,-1.408592,-0.838483,
-	0.161064,-0.731195,-0.662882,-1.659758,-1.544361,-0.788181,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	0.161064,-0.731195,-0.662882,-1.659758,-1.544361,-0.788181,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.106237,-0.558927,-0.822383,-1.686329,-1.414405,-0.869373,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.357021,-0.590654,-0.723646,-1.777628,-1.473076,-0.845827,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.095733,-0.224552,-0.969748,-1.456655,-1.295527,-0.89424,
-	-0.422758,-0.178302,-0.888529,-1.366873,-1.340211,-0.907567,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	-0.422758,-0.178302,-0.888529,-1.366873,-1.340211,-0.907567,
-	-0.504483,-0.438591,-0.743731,-1.376186,-1.661988,-0.718954,
-	-0.504483,-0.438591,-0.743731,-1.376186,-1.661988,-0.718954,
-	-0.422758,-0.178302,-0.888529,-1.366873,-1.340211,-0.907567,
-	0.121987,-0.426326,-0.896306,-1.198513,-1.456102,-0.885435,
-	-0.504483,-0.438591,-0.743731,-1.376186,-1.661988,-0.718954,
-	0.121987,-0.426326,-0.896306,-1.198513,-1.456102,-0.885435,
-	0.215155,-0.464575,-0.858999,-1.200688,-1.577575,-0.799188,
-	0.215155,-0.464575,-0.858999,-1.200688,-1.577575,-0.799188,
-	0.121987,-0.426326,-0.896306,-1.198513,-1.456102,-0.885435,
-	-0.218261,-0.26262,-0.93989,-0.953236,-1.545941,-0.89918,
-	-0.094238,-0.851252,-0.516225,-1.397474,-1.693815,-0.570541,
-	0.152347,-0.821467,-0.549529,-1.480217,-1.6566,-0.606638,
-	-0.504483,-0.438591,-0.743731,-1.376186,-1.661988,-0.718954,
-	-0.504483,-0.438591,-0.743731,-1.376186,-1.661988,-0.718954,
-	0.152347,-0.821467,-0.549529,-1.480217,-1.6566,-0.606638,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.152347,-0.821467,-0.549529,-1.480217,-1.6566,-0.606638,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	0.152347,-0.821467,-0.549529,-1.480217,-1.6566,-0.606638,
-	-0.198045,-0.959194,-0.201804,-1.519339,-1.653776,-0.501741,
-	-0.198045,-0.959194,-0.201804,-1.519339,-1.653776,-0.501741,
-	0.152347,-0.821467,-0.549529,-1.480217,-1.6566,-0.606638,
-	-0.094238,-0.851252,-0.516225,-1.397474,-1.693815,-0.570541,
-	-0.198045,-0.959194,-0.201804,-1.519339,-1.653776,-0.501741,
-	-0.094238,-0.851252,-0.516225,-1.397474,-1.693815,-0.570541,
-	-0.171647,-0.971664,-0.162499,-1.406693,-1.697325,-0.450399,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.198045,-0.959194,-0.201804,-1.519339,-1.653776,-0.501741,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.198045,-0.959194,-0.201804,-1.519339,-1.653776,-0.501741,
-	-0.171647,-0.971664,-0.162499,-1.406693,-1.697325,-0.450399,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.171647,-0.971664,-0.162499,-1.406693,-1.697325,-0.450399,
-	-0.53858,-0.616299,-0.57455,-1.386502,-1.718441,-0.350823,
-	-0.53858,-0.616299,-0.57455,-1.386502,-1.718441,-0.350823,
-	0.011286,0.999936,0,-1.395728,-1.723811,0,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	-0.53858,-0.616299,-0.57455,-1.386502,-1.718441,-0.350823,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	-0.299215,-0.929389,-0.216116,-1.764045,-1.764987,-0.406586,
-	-0.299215,-0.929389,-0.216116,-1.764045,-1.764987,-0.406586,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.299215,-0.929389,-0.216116,-1.764045,-1.764987,-0.406586,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.403877,-0.879274,-0.252509,-1.576196,-1.696317,-0.358146,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.161064,-0.731195,-0.662882,-1.659758,-1.544361,-0.788181,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	-0.279342,-0.940234,-0.19475,-1.601625,-1.593321,-0.605607,
-	0.161064,-0.731195,-0.662882,-1.659758,-1.544361,-0.788181,
-	0.08565,-0.422547,-0.902285,-1.552229,-1.555077,-0.735708,
-	0.048753,-0.975535,-0.21437,-2.734184,-1.717948,-0.749581,
-	0.137764,-0.289893,-0.947092,-2.591357,-1.510845,-0.88547,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	0.048753,-0.975535,-0.21437,-2.734184,-1.717948,-0.749581,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	0.137206,-0.207537,-0.968557,-2.417777,-1.553136,-0.887222,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.094371,-0.230057,-0.968591,-2.223917,-1.541268,-0.87926,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	-0.201818,-0.568242,-0.797728,-2.049879,-1.562369,-0.829319,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	0.008663,-0.516082,-0.856495,-1.778934,-1.550199,-0.776454,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	-0.299215,-0.929389,-0.216116,-1.764045,-1.764987,-0.406586,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.083262,-0.787311,-0.610907,-2.027242,-1.813012,-0.555232,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	-0.18119,-0.970212,-0.160805,-1.74779,-1.667608,-0.60634,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	0.083262,-0.787311,-0.610907,-2.027242,-1.813012,-0.555232,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.35682,-0.781398,-0.511953,-2.037371,-1.73636,-0.656787,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	0.430742,-0.887318,-0.164704,-2.267049,-1.753901,-0.662106,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	-0.177142,-0.976279,-0.124502,-2.508885,-1.719933,-0.721675,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	0.048753,-0.975535,-0.21437,-2.734184,-1.717948,-0.749581,
-	0.048753,-0.975535,-0.21437,-2.734184,-1.717948,-0.749581,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.048753,-0.975535,-0.21437,-2.734184,-1.717948,-0.749581,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.43907,-0.579988,-0.686171,-2.811581,-1.79821,-0.712737,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	0.381337,-0.795981,-0.470102,-2.317557,-1.8742,-0.470587,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	-0.299215,-0.929389,-0.216116,-1.764045,-1.764987,-0.406586,
-	-0.012978,-0.998326,0.056357,-3.139394,-1.687482,-0.638546,
-	0.074429,-0.99521,0.063385,-3.120907,-1.707924,-0.431829,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	-0.012978,-0.998326,0.056357,-3.139394,-1.687482,-0.638546,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	0.515412,-0.714946,0.472444,-3.304804,-1.582192,-0.643445,
-	0.515412,-0.714946,0.472444,-3.304804,-1.582192,-0.643445,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	0.515412,-0.714946,0.472444,-3.304804,-1.582192,-0.643445,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	-0.354058,-0.732075,0.581987,-3.387254,-1.486027,-0.672861,
-	-0.354058,-0.732075,0.581987,-3.387254,-1.486027,-0.672861,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	-0.354058,-0.732075,0.581987,-3.387254,-1.486027,-0.672861,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	-0.581301,-0.608503,0.540197,-3.53391,-1.330455,-0.568246,
-	-0.581301,-0.608503,0.540197,-3.53391,-1.330455,-0.568246,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.581301,-0.608503,0.540197,-3.53391,-1.330455,-0.568246,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	-0.9775,0.159844,-0.137638,-3.535416,0.191408,-0.338478,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.9775,0.159844,-0.137638,-3.535416,0.191408,-0.338478,
-	-0.923845,0.18432,-0.335466,-3.51684,0.149002,-0.430359,
-	-0.923845,0.18432,-0.335466,-3.51684,0.149002,-0.430359,
-	-0.9775,0.159844,-0.137638,-3.535416,0.191408,-0.338478,
-	-0.971344,0.144305,-0.188856,-3.536654,0.442277,-0.322,
-	-0.971344,0.144305,-0.188856,-3.536654,0.442277,-0.322,
-	-0.9775,0.159844,-0.137638,-3.535416,0.191408,-0.338478,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	-0.971344,0.144305,-0.188856,-3.536654,0.442277,-0.322,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	-0.9775,0.159844,-0.137638,-3.535416,0.191408,-0.338478,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	-0.945906,-0.323169,-0.028687,-3.676599,-0.729578,-0.330724,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	-0.84728,-0.52968,-0.039439,-3.686518,-0.955181,-0.320349,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	-0.736087,-0.675142,-0.048562,-3.639586,-1.140102,-0.3338,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	-0.587869,-0.808404,-0.029894,-3.557869,-1.325941,-0.37803,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	-0.454242,-0.890878,0.000928,-3.442085,-1.48412,-0.406377,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	0.249604,-0.855993,0.452741,-3.314868,-1.599081,-0.439626,
-	0.074429,-0.99521,0.063385,-3.120907,-1.707924,-0.431829,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	0.074429,-0.99521,0.063385,-3.120907,-1.707924,-0.431829,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	0.074429,-0.99521,0.063385,-3.120907,-1.707924,-0.431829,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	-0.993498,0.089934,-0.06981,-3.570243,-0.060093,-0.344854,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	-0.99574,-0.082547,-0.041071,-3.616627,-0.350374,-0.338492,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	-0.923845,0.18432,-0.335466,-3.51684,0.149002,-0.430359,
-	-0.908258,0.139498,-0.394471,-3.470778,-0.078218,-0.546398,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.908258,0.139498,-0.394471,-3.470778,-0.078218,-0.546398,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.951862,0.098243,-0.290356,-3.529709,-0.065998,-0.437217,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.950882,-0.075567,-0.300188,-3.595973,-0.346391,-0.426453,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.896964,-0.287307,-0.336022,-3.665774,-0.73408,-0.446286,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.938884,0.007108,-0.344159,-3.492599,-1.180646,-0.692282,
-	-0.815087,-0.388053,-0.430171,-3.667859,-0.964867,-0.464702,
-	-0.938884,0.007108,-0.344159,-3.492599,-1.180646,-0.692282,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.938884,0.007108,-0.344159,-3.492599,-1.180646,-0.692282,
-	-0.782249,0.198377,-0.590536,-3.335942,-1.365685,-0.72459,
-	-0.98615,-0.150918,-0.068783,-3.631179,-1.157838,-0.50561,
-	-0.782249,0.198377,-0.590536,-3.335942,-1.365685,-0.72459,
-	-0.581301,-0.608503,0.540197,-3.53391,-1.330455,-0.568246,
-	-0.581301,-0.608503,0.540197,-3.53391,-1.330455,-0.568246,
-	-0.782249,0.198377,-0.590536,-3.335942,-1.365685,-0.72459,
-	-0.354058,-0.732075,0.581987,-3.387254,-1.486027,-0.672861,
-	-0.743901,0.102645,-0.66036,-3.415655,-0.308965,-0.671045,
-	-0.984416,-0.175855,-0.000915,-3.283698,-0.730967,-0.793898,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.908258,0.139498,-0.394471,-3.470778,-0.078218,-0.546398,
-	-0.743901,0.102645,-0.66036,-3.415655,-0.308965,-0.671045,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.743901,0.102645,-0.66036,-3.415655,-0.308965,-0.671045,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.985615,0.064121,-0.156369,-3.526766,-0.317542,-0.560837,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.605564,-0.17532,-0.776244,-3.355398,-0.969157,-0.766213,
-	-0.982334,-0.04331,-0.182057,-3.569993,-0.731989,-0.649435,
-	-0.605564,-0.17532,-0.776244,-3.355398,-0.969157,-0.766213,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.605564,-0.17532,-0.776244,-3.355398,-0.969157,-0.766213,
-	-0.823768,0.005745,-0.566899,-3.27979,-1.162072,-0.784602,
-	-0.995081,-0.092251,0.036114,-3.55012,-0.984868,-0.675228,
-	-0.823768,0.005745,-0.566899,-3.27979,-1.162072,-0.784602,
-	-0.938884,0.007108,-0.344159,-3.492599,-1.180646,-0.692282,
-	-0.938884,0.007108,-0.344159,-3.492599,-1.180646,-0.692282,
-	-0.823768,0.005745,-0.566899,-3.27979,-1.162072,-0.784602,
-	-0.782249,0.198377,-0.590536,-3.335942,-1.365685,-0.72459,
-	-0.823768,0.005745,-0.566899,-3.27979,-1.162072,-0.784602,
-	-0.605564,-0.17532,-0.776244,-3.355398,-0.969157,-0.766213,
-	-0.838192,0.000365,-0.545375,-3.25121,-0.948205,-0.819868,
-	-0.971344,0.144305,-0.188856,-3.536654,0.442277,-0.322,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.971344,0.144305,-0.188856,-3.536654,0.442277,-0.322,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.472479,0.093412,-0.876377,-3.556552,0.704883,-0.28063,
-	-0.472479,0.093412,-0.876377,-3.556552,0.704883,-0.28063,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.989171,0.146765,0,-3.599077,0.796217,0,
-	-0.472479,0.093412,-0.876377,-3.556552,0.704883,-0.28063,
-	-0.989171,0.146765,0,-3.599077,0.796217,0,
-	-0.43302,-0.02622,-0.901003,-3.57817,0.837714,-0.288502,
-	-0.838192,0.000365,-0.545375,-3.25121,-0.948205,-0.819868,
-	-0.605564,-0.17532,-0.776244,-3.355398,-0.969157,-0.766213,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.838192,0.000365,-0.545375,-3.25121,-0.948205,-0.819868,
-	-0.681141,-0.040116,-0.731052,-3.438226,-0.721479,-0.728141,
-	-0.984416,-0.175855,-0.000915,-3.283698,-0.730967,-0.793898,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.04422,-0.704109,-0.708714,-1.936032,-1.829617,-0.488916,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.083262,-0.787311,-0.610907,-2.027242,-1.813012,-0.555232,
-	0.083262,-0.787311,-0.610907,-2.027242,-1.813012,-0.555232,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	0.083262,-0.787311,-0.610907,-2.027242,-1.813012,-0.555232,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	0.170756,-0.748007,-0.641349,-2.126375,-1.866497,-0.502895,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	0.64791,-0.754869,0.101909,-2.176551,-1.873816,-0.445782,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	-0.393694,-0.919049,0.018795,-2.147113,-1.903198,-0.362462,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	-0.327707,-0.94199,0.072547,-2.062725,-1.884246,-0.307336,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	-0.163041,-0.980692,0.107986,-1.946306,-1.872735,-0.344251,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	0.493535,-0.729115,-0.474147,-1.88316,-1.829718,-0.401567,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	0.018755,-0.837462,-0.546174,-2.466779,-1.857679,-0.570461,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	-0.094688,-0.959937,-0.263734,-2.547737,-1.833025,-0.609321,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	0.059023,-0.965365,-0.25414,-2.64722,-1.84401,-0.594347,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	-0.147229,-0.706225,-0.69251,-2.684452,-1.891207,-0.447388,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	0.328486,-0.940918,0.082286,-2.614084,-1.905005,-0.404925,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	-0.319475,-0.944225,-0.079844,-2.503818,-1.909806,-0.431456,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	0.183908,-0.773381,-0.606679,-2.446375,-1.893261,-0.49411,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	0.10009,-0.380026,-0.919545,-2.065655,-2.124623,-0.36872,
-	-0.227573,-0.361149,-0.904313,-1.985123,-2.116661,-0.394256,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	-0.227573,-0.361149,-0.904313,-1.985123,-2.116661,-0.394256,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	0.547733,-0.470267,-0.691981,-2.12403,-2.137733,-0.406853,
-	0.10009,-0.380026,-0.919545,-2.065655,-2.124623,-0.36872,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	0.10009,-0.380026,-0.919545,-2.065655,-2.124623,-0.36872,
-	-0.276108,-0.088024,-0.957087,-2.060902,-2.031698,-0.372079,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	-0.071182,-0.950841,-0.301389,-2.144393,-2.117408,-0.464489,
-	0.547733,-0.470267,-0.691981,-2.12403,-2.137733,-0.406853,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	0.547733,-0.470267,-0.691981,-2.12403,-2.137733,-0.406853,
-	0.129519,-0.132707,-0.982656,-2.120746,-2.045137,-0.411171,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	0.216748,0.039315,-0.975436,-2.109684,-2.112345,-0.503997,
-	-0.071182,-0.950841,-0.301389,-2.144393,-2.117408,-0.464489,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	-0.071182,-0.950841,-0.301389,-2.144393,-2.117408,-0.464489,
-	0.701057,-0.210559,-0.68131,-2.141621,-2.024301,-0.470257,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.555949,0.246865,-0.793712,-2.04111,-2.075348,-0.540201,
-	0.216748,0.039315,-0.975436,-2.109684,-2.112345,-0.503997,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.216748,0.039315,-0.975436,-2.109684,-2.112345,-0.503997,
-	0.908243,-0.229695,-0.349765,-2.106039,-2.019111,-0.510759,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	0.768311,0.202351,-0.60725,-1.978016,-2.086834,-0.494327,
-	0.555949,0.246865,-0.793712,-2.04111,-2.075348,-0.540201,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	0.555949,0.246865,-0.793712,-2.04111,-2.075348,-0.540201,
-	0.537835,-0.193789,0.820475,-2.03574,-1.981182,-0.547873,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	0.833232,0.046883,-0.550932,-1.941442,-2.086904,-0.433904,
-	0.768311,0.202351,-0.60725,-1.978016,-2.086834,-0.494327,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	0.768311,0.202351,-0.60725,-1.978016,-2.086834,-0.494327,
-	0.313565,-0.18353,0.931662,-1.971059,-1.992958,-0.500845,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	-0.227573,-0.361149,-0.904313,-1.985123,-2.116661,-0.394256,
-	0.833232,0.046883,-0.550932,-1.941442,-2.086904,-0.433904,
-	-0.40904,-0.077842,-0.90919,-1.978344,-2.023535,-0.398257,
-	0.833232,0.046883,-0.550932,-1.941442,-2.086904,-0.433904,
-	0.728068,-0.191899,0.658097,-1.933565,-1.993029,-0.438902,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	0.213243,-0.278119,-0.936578,-2.552923,-2.142304,-0.454579,
-	0.587809,-0.328911,-0.73912,-2.513187,-2.130859,-0.49792,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	0.587809,-0.328911,-0.73912,-2.513187,-2.130859,-0.49792,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	0.794828,0.083381,-0.601079,-2.629199,-2.138983,-0.436227,
-	0.213243,-0.278119,-0.936578,-2.552923,-2.142304,-0.454579,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	0.213243,-0.278119,-0.936578,-2.552923,-2.142304,-0.454579,
-	-0.409829,-0.525605,-0.745506,-2.539874,-2.049824,-0.460098,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	0.873201,-0.04546,-0.485236,-2.677875,-2.129439,-0.4656,
-	0.794828,0.083381,-0.601079,-2.629199,-2.138983,-0.436227,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	0.794828,0.083381,-0.601079,-2.629199,-2.138983,-0.436227,
-	-0.508388,-0.837291,-0.20121,-2.618068,-2.046419,-0.441284,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	0.829377,-0.173624,-0.531026,-2.695135,-2.12165,-0.508064,
-	0.873201,-0.04546,-0.485236,-2.677875,-2.129439,-0.4656,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	0.873201,-0.04546,-0.485236,-2.677875,-2.129439,-0.4656,
-	-0.443612,-0.876487,0.187028,-2.667969,-2.036634,-0.471396,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	0.506864,-0.193035,-0.840135,-2.688607,-2.101208,-0.550465,
-	0.829377,-0.173624,-0.531026,-2.695135,-2.12165,-0.508064,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	0.829377,-0.173624,-0.531026,-2.695135,-2.12165,-0.508064,
-	-0.148191,-0.901516,0.40658,-2.685663,-2.028649,-0.514928,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	0.166377,-0.157108,-0.973466,-2.65212,-2.09679,-0.567258,
-	0.506864,-0.193035,-0.840135,-2.688607,-2.101208,-0.550465,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	0.506864,-0.193035,-0.840135,-2.688607,-2.101208,-0.550465,
-	0.260319,-0.908993,0.325523,-2.678971,-2.007694,-0.558395,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	0.054863,-0.132815,-0.989621,-2.583303,-2.089191,-0.577616,
-	0.166377,-0.157108,-0.973466,-2.65212,-2.09679,-0.567258,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	0.166377,-0.157108,-0.973466,-2.65212,-2.09679,-0.567258,
-	0.687126,-0.68509,-0.241887,-2.641567,-2.003164,-0.575611,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.238844,0.101951,-0.965691,-2.527301,-2.106246,-0.550735,
-	0.054863,-0.132815,-0.989621,-2.583303,-2.089191,-0.577616,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.054863,-0.132815,-0.989621,-2.583303,-2.089191,-0.577616,
-	0.678632,-0.017853,0.734261,-2.571019,-1.995375,-0.58623,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	0.587809,-0.328911,-0.73912,-2.513187,-2.130859,-0.49792,
-	0.238844,0.101951,-0.965691,-2.527301,-2.106246,-0.550735,
-	0.50178,0.000639,0.864995,-2.499138,-2.03809,-0.504529,
-	0.238844,0.101951,-0.965691,-2.527301,-2.106246,-0.550735,
-	0.300485,0.019099,0.953595,-2.513608,-2.012858,-0.558673,
-	0.768311,0.202351,-0.60725,-1.978016,-2.086834,-0.494327,
-	0.833232,0.046883,-0.550932,-1.941442,-2.086904,-0.433904,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.555949,0.246865,-0.793712,-2.04111,-2.075348,-0.540201,
-	0.768311,0.202351,-0.60725,-1.978016,-2.086834,-0.494327,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.216748,0.039315,-0.975436,-2.109684,-2.112345,-0.503997,
-	0.555949,0.246865,-0.793712,-2.04111,-2.075348,-0.540201,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	-0.071182,-0.950841,-0.301389,-2.144393,-2.117408,-0.464489,
-	0.216748,0.039315,-0.975436,-2.109684,-2.112345,-0.503997,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.547733,-0.470267,-0.691981,-2.12403,-2.137733,-0.406853,
-	-0.071182,-0.950841,-0.301389,-2.144393,-2.117408,-0.464489,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.10009,-0.380026,-0.919545,-2.065655,-2.124623,-0.36872,
-	0.547733,-0.470267,-0.691981,-2.12403,-2.137733,-0.406853,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	-0.227573,-0.361149,-0.904313,-1.985123,-2.116661,-0.394256,
-	0.10009,-0.380026,-0.919545,-2.065655,-2.124623,-0.36872,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.833232,0.046883,-0.550932,-1.941442,-2.086904,-0.433904,
-	-0.227573,-0.361149,-0.904313,-1.985123,-2.116661,-0.394256,
-	0.604307,0.204357,-0.770098,-2.048681,-2.165282,-0.450843,
-	0.238844,0.101951,-0.965691,-2.527301,-2.106246,-0.550735,
-	0.587809,-0.328911,-0.73912,-2.513187,-2.130859,-0.49792,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.054863,-0.132815,-0.989621,-2.583303,-2.089191,-0.577616,
-	0.238844,0.101951,-0.965691,-2.527301,-2.106246,-0.550735,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.166377,-0.157108,-0.973466,-2.65212,-2.09679,-0.567258,
-	0.054863,-0.132815,-0.989621,-2.583303,-2.089191,-0.577616,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.506864,-0.193035,-0.840135,-2.688607,-2.101208,-0.550465,
-	0.166377,-0.157108,-0.973466,-2.65212,-2.09679,-0.567258,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.829377,-0.173624,-0.531026,-2.695135,-2.12165,-0.508064,
-	0.506864,-0.193035,-0.840135,-2.688607,-2.101208,-0.550465,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.873201,-0.04546,-0.485236,-2.677875,-2.129439,-0.4656,
-	0.829377,-0.173624,-0.531026,-2.695135,-2.12165,-0.508064,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.794828,0.083381,-0.601079,-2.629199,-2.138983,-0.436227,
-	0.873201,-0.04546,-0.485236,-2.677875,-2.129439,-0.4656,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.213243,-0.278119,-0.936578,-2.552923,-2.142304,-0.454579,
-	0.794828,0.083381,-0.601079,-2.629199,-2.138983,-0.436227,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	0.587809,-0.328911,-0.73912,-2.513187,-2.130859,-0.49792,
-	0.213243,-0.278119,-0.936578,-2.552923,-2.142304,-0.454579,
-	0.02054,-0.128179,-0.991538,-2.603284,-2.176802,-0.510638,
-	-0.012978,-0.998326,0.056357,-3.139394,-1.687482,-0.638546,
-	0.579344,-0.339433,0.741044,-3.008323,-1.759271,-0.655672,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	-0.012978,-0.998326,0.056357,-3.139394,-1.687482,-0.638546,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	0.074429,-0.99521,0.063385,-3.120907,-1.707924,-0.431829,
-	0.579344,-0.339433,0.741044,-3.008323,-1.759271,-0.655672,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	-0.073547,-0.481419,-0.8734,-2.941731,-1.787431,-0.442574,
-	0.579344,-0.339433,0.741044,-3.008323,-1.759271,-0.655672,
-	0.43907,-0.579988,-0.686171,-2.811581,-1.79821,-0.712737,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.579344,-0.339433,0.741044,-3.008323,-1.759271,-0.655672,
-	0.49176,-0.810764,-0.317543,-2.699966,-1.850397,-0.57007,
-	0.099157,-0.476834,-0.873383,-2.709403,-1.879947,-0.508775,
-	-0.822733,0.223687,0.522565,-2.306662,-1.116976,0.961238,
-	-0.950882,-0.075567,0.300188,-2.119856,-1.1288,0.97096,
-	-0.619245,-0.050391,0.783579,-2.033406,-0.91003,0.96422,
-	-0.993498,0.089934,0.06981,-2.031698,-1.097344,0.966701,
-	-0.619245,-0.050391,0.783579,-2.033406,-0.91003,0.96422,
-	-0.950882,-0.075567,0.300188,-2.119856,-1.1288,0.97096,
-	-0.379807,-0.084066,0.921238,-1.782298,-1.020581,0.943381,
-	-0.619245,-0.050391,0.783579,-2.033406,-0.91003,0.96422,
-	-0.993498,0.089934,0.06981,-2.031698,-1.097344,0.966701,
-	-0.9775,0.159844,0.137638,-2.337617,-1.334842,0.966761,
-	-0.822733,0.223687,0.522565,-2.306662,-1.116976,0.961238,
-	-0.951862,0.098243,0.290356,-2.462835,-1.3055,0.966395,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.950882,-0.075567,0.300188,-2.119856,-1.1288,0.97096,
-	-0.822733,0.223687,0.522565,-2.306662,-1.116976,0.961238,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.822733,0.223687,0.522565,-2.306662,-1.116976,0.961238,
-	-0.9775,0.159844,0.137638,-2.337617,-1.334842,0.966761,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.993498,0.089934,0.06981,-2.031698,-1.097344,0.966701,
-	-0.950882,-0.075567,0.300188,-2.119856,-1.1288,0.97096,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.950882,-0.075567,0.300188,-2.119856,-1.1288,0.97096,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.379807,-0.084066,0.921238,-1.782298,-1.020581,0.943381,
-	-0.993498,0.089934,0.06981,-2.031698,-1.097344,0.966701,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.993498,0.089934,0.06981,-2.031698,-1.097344,0.966701,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.985615,0.064121,0.156369,-1.709172,-1.283232,0.897427,
-	-0.379807,-0.084066,0.921238,-1.782298,-1.020581,0.943381,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.982334,-0.04331,0.182057,-1.456655,-1.295527,0.89424,
-	-0.379807,-0.084066,0.921238,-1.782298,-1.020581,0.943381,
-	-0.985615,0.064121,0.156369,-1.709172,-1.283232,0.897427,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	-0.9775,0.159844,0.137638,-2.337617,-1.334842,0.966761,
-	-0.951862,0.098243,0.290356,-2.462835,-1.3055,0.966395,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	-0.951862,0.098243,0.290356,-2.462835,-1.3055,0.966395,
-	-0.995081,-0.092251,-0.036114,-2.591357,-1.510845,0.88547,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.9775,0.159844,0.137638,-2.337617,-1.334842,0.966761,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	-0.9775,0.159844,0.137638,-2.337617,-1.334842,0.966761,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	-0.923845,0.18432,0.335466,-2.161843,-1.325837,0.957465,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.681141,-0.040116,0.731052,-1.777628,-1.473076,0.845827,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.971344,0.144305,0.188856,-2.042059,-1.312976,0.940911,
-	-0.681141,-0.040116,0.731052,-1.777628,-1.473076,0.845827,
-	-0.823768,0.005745,0.566899,-1.686329,-1.414405,0.869373,
-	-0.985615,0.064121,0.156369,-1.709172,-1.283232,0.897427,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.823768,0.005745,0.566899,-1.686329,-1.414405,0.869373,
-	-0.908258,0.139498,0.394471,-1.776785,-1.275107,0.914703,
-	-0.681141,-0.040116,0.731052,-1.777628,-1.473076,0.845827,
-	-0.838192,0.000364,0.545375,-1.592146,-1.408592,0.838483,
-	-0.982334,-0.04331,0.182057,-1.456655,-1.295527,0.89424,
-	-0.985615,0.064121,0.156369,-1.709172,-1.283232,0.897427,
-	-0.838192,0.000364,0.545375,-1.592146,-1.408592,0.838483,
-	-0.985615,0.064121,0.156369,-1.709172,-1.283232,0.897427,
-	-0.823768,0.005745,0.566899,-1.686329,-1.414405,0.869373,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	-0.982334,-0.04331,0.182057,-1.456655,-1.295527,0.89424,
-	-0.838192,0.000364,0.545375,-1.592146,-1.408592,0.838483,
-	-0.838192,0.000364,0.545375,-1.592146,-1.408592,0.838483,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	-0.823768,0.005745,0.566899,-1.686329,-1.414405,0.869373,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	-0.838192,0.000364,0.545375,-1.592146,-1.408592,0.838483,
-	-0.681141,-0.040116,0.731052,-1.777628,-1.473076,0.845827,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	-0.681141,-0.040116,0.731052,-1.777628,-1.473076,0.845827,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	-0.823768,0.005745,0.566899,-1.686329,-1.414405,0.869373,
-	-0.285709,0.130064,0.949449,-1.376186,-1.661988,0.718954,
-	-0.311485,0.082882,0.94663,-1.366873,-1.340211,0.907567,
-	-0.982334,-0.04331,0.182057,-1.456655,-1.295527,0.89424,
-	-0.285709,0.130064,0.949449,-1.376186,-1.661988,0.718954,
-	-0.982334,-0.04331,0.182057,-1.456655,-1.295527,0.89424,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	-0.809154,0.004832,0.587577,-1.200688,-1.577575,0.799188,
-	-0.742985,0.015712,0.669123,-1.198513,-1.456102,0.885435,
-	-0.311485,0.082882,0.94663,-1.366873,-1.340211,0.907567,
-	-0.809154,0.004832,0.587577,-1.200688,-1.577575,0.799188,
-	-0.311485,0.082882,0.94663,-1.366873,-1.340211,0.907567,
-	-0.285709,0.130064,0.949449,-1.376186,-1.661988,0.718954,
-	-0.02449,0.224062,0.974267,-0.953236,-1.545941,0.89918,
-	-0.742985,0.015712,0.669123,-1.198513,-1.456102,0.885435,
-	-0.809154,0.004832,0.587577,-1.200688,-1.577575,0.799188,
-	-0.285709,0.130064,0.949449,-1.376186,-1.661988,0.718954,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	-0.587909,-0.233166,0.774594,-1.397474,-1.693815,0.570541,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	-0.285709,0.130064,0.949449,-1.376186,-1.661988,0.718954,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	0.366416,-0.175098,0.913827,-1.519339,-1.653776,0.501741,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	0.023392,-0.110333,0.993619,-1.406693,-1.697325,0.450399,
-	-0.587909,-0.233166,0.774594,-1.397474,-1.693815,0.570541,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	0.023392,-0.110333,0.993619,-1.406693,-1.697325,0.450399,
-	0.924702,-0.311563,0.218757,-1.480217,-1.6566,0.606638,
-	0.366416,-0.175098,0.913827,-1.519339,-1.653776,0.501741,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	0.366416,-0.175098,0.913827,-1.519339,-1.653776,0.501741,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	-0.279485,0.127803,0.951606,-1.386502,-1.718441,0.350823,
-	0.023392,-0.110333,0.993619,-1.406693,-1.697325,0.450399,
-	0.366416,-0.175098,0.913827,-1.519339,-1.653776,0.501741,
-	-0.279485,0.127803,0.951606,-1.386502,-1.718441,0.350823,
-	0.366416,-0.175098,0.913827,-1.519339,-1.653776,0.501741,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	0.011286,0.999936,0,-1.395728,-1.723811,0,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	0.011286,0.999936,0,-1.395728,-1.723811,0,
-	-0.279485,0.127803,0.951606,-1.386502,-1.718441,0.350823,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	0.106808,0.99428,0,-1.610025,-1.711571,0,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.157802,-0.148625,0.976222,-1.576196,-1.696317,0.358146,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.472479,0.093413,0.876377,-1.552229,-1.555077,0.735708,
-	-0.43302,-0.02622,0.901003,-1.659758,-1.544361,0.788181,
-	0.73827,-0.277136,0.614942,-1.601625,-1.593321,0.605607,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	-0.995081,-0.092251,-0.036114,-2.591357,-1.510845,0.88547,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	-0.995081,-0.092251,-0.036114,-2.591357,-1.510845,0.88547,
-	0.942117,-0.292664,0.163592,-2.734184,-1.717948,0.749581,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	-0.938884,0.007108,0.344159,-2.417777,-1.553136,0.887222,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	0.02992,-0.202031,0.978922,-2.037371,-1.73636,0.656787,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	0.02992,-0.202031,0.978922,-2.037371,-1.73636,0.656787,
-	-0.782249,0.198377,0.590536,-2.223917,-1.541268,0.87926,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.605564,-0.17532,0.776244,-1.778934,-1.550199,0.776454,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.743901,0.102645,0.66036,-2.049879,-1.562369,0.829319,
-	0.02992,-0.202031,0.978922,-2.037371,-1.73636,0.656787,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	-0.239734,-0.173966,0.955125,-1.88316,-1.829718,0.401567,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	0.02992,-0.202031,0.978922,-2.037371,-1.73636,0.656787,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	-0.632119,-0.359381,0.686492,-1.74779,-1.667608,0.60634,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	0.02992,-0.202031,0.978922,-2.037371,-1.73636,0.656787,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	0.38578,-0.259547,0.88533,-2.267049,-1.753901,0.662106,
-	0.942117,-0.292664,0.163592,-2.734184,-1.717948,0.749581,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	0.942117,-0.292664,0.163592,-2.734184,-1.717948,0.749581,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	0.772916,-0.305378,0.556188,-2.508885,-1.719933,0.721675,
-	-0.732521,-0.474279,0.488336,-2.811581,-1.79821,0.712737,
-	-0.845196,-0.27877,0.455994,-2.699966,-1.850397,0.57007,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	-0.732521,-0.474279,0.488336,-2.811581,-1.79821,0.712737,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	0.942117,-0.292664,0.163592,-2.734184,-1.717948,0.749581,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.999491,-0.02584,0.01873,-2.941731,-1.787431,0.442574,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.058013,0.998316,0,-2.656867,-1.853045,0,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	0.80128,-0.303744,0.515451,-2.317557,-1.8742,0.470587,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	0.093777,0.995593,0,-2.348005,-1.869142,0,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	0.149455,0.988769,0,-2.092921,-1.839622,0,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	-0.239734,-0.173966,0.955125,-1.88316,-1.829718,0.401567,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	-0.661097,-0.258238,0.70446,-1.764045,-1.764987,0.406586,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	-0.160087,-0.987103,0,-1.799827,-1.753136,0,
-	0.830793,-0.244757,0.499877,-3.304804,-1.582192,0.643445,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.830793,-0.244757,0.499877,-3.304804,-1.582192,0.643445,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.843062,-0.10517,0.527433,-3.139394,-1.687482,0.638546,
-	0.290478,-0.146424,0.945612,-3.387254,-1.486027,0.672861,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	0.290478,-0.146424,0.945612,-3.387254,-1.486027,0.672861,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	0.830793,-0.244757,0.499877,-3.304804,-1.582192,0.643445,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	0.290478,-0.146424,0.945612,-3.387254,-1.486027,0.672861,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	-0.246054,-0.154918,0.956796,-3.529709,-0.065998,0.437217,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	-0.246054,-0.154918,0.956796,-3.529709,-0.065998,0.437217,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	-0.136917,-0.20176,0.969818,-3.51684,0.149002,0.430359,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	-0.136917,-0.20176,0.969818,-3.51684,0.149002,0.430359,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	-0.246054,-0.154918,0.956796,-3.529709,-0.065998,0.437217,
-	-0.17902,-0.308668,0.934171,-3.536654,0.442277,0.322,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	-0.136917,-0.20176,0.969818,-3.51684,0.149002,0.430359,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	-0.17902,-0.308668,0.934171,-3.536654,0.442277,0.322,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	-0.176356,-0.113876,0.977717,-3.535416,0.191408,0.338478,
-	0.170833,0.9853,0,-3.55232,0.219613,0,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	-0.051713,-0.100833,0.993559,-3.676599,-0.729578,0.330724,
-	0.353735,-0.935346,0,-3.673607,-0.720796,0,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	0.051664,-0.122235,0.991156,-3.686518,-0.955181,0.320349,
-	-0.34926,-0.937026,0,-3.678793,-0.926816,0,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	0.459595,-0.144347,0.87632,-3.639586,-1.140102,0.3338,
-	-0.164,-0.98646,0,-3.650579,-1.142448,0,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	0.407719,-0.190267,0.893064,-3.557869,-1.325941,0.37803,
-	0.030921,-0.999522,0,-3.522115,-1.366623,0,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	0.159615,0.129847,0.978602,-3.442085,-1.48412,0.406377,
-	0.183204,-0.983075,0,-3.417689,-1.494416,0,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	0.846555,-0.103662,0.52211,-3.314868,-1.599081,0.439626,
-	-0.997516,0.070442,0,-3.271035,-1.609292,0,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.999491,-0.02584,0.01873,-2.941731,-1.787431,0.442574,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.0787,0.996898,0,-2.892162,-1.781087,0,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	-0.99928,-0.037933,0,-3.1103,-1.69172,0,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	0.109483,-0.310605,0.944213,-3.616627,-0.350374,0.338492,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	0.098463,-0.995141,0,-3.637643,-0.356271,0,
-	-0.211092,-0.082708,0.973961,-3.570243,-0.060093,0.344854,
-	0.614301,0.789071,-0.000581,-3.583763,-0.052271,0,
-	-0.246054,-0.154918,0.956796,-3.529709,-0.065998,0.437217,
-	-0.739347,0.031953,0.672566,-3.470778,-0.078218,0.546398,
-	-0.136917,-0.20176,0.969818,-3.51684,0.149002,0.430359,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	-0.652584,-0.147678,0.743186,-3.526766,-0.317542,0.560837,
-	-0.739347,0.031953,0.672566,-3.470778,-0.078218,0.546398,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	-0.739347,0.031953,0.672566,-3.470778,-0.078218,0.546398,
-	-0.246054,-0.154918,0.956796,-3.529709,-0.065998,0.437217,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	-0.652584,-0.147678,0.743186,-3.526766,-0.317542,0.560837,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	-0.652584,-0.147678,0.743186,-3.526766,-0.317542,0.560837,
-	-0.09542,0.162222,0.98213,-3.595973,-0.346391,0.426453,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	0.039,-0.185675,0.981837,-3.665774,-0.73408,0.446286,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	-0.069043,-0.157333,0.985129,-3.667859,-0.964867,0.464702,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	-0.521685,-0.261319,0.812131,-3.335942,-1.365685,0.72459,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	0.473622,-0.284001,0.833682,-3.631179,-1.157838,0.50561,
-	0.290478,-0.146424,0.945612,-3.387254,-1.486027,0.672861,
-	-0.521685,-0.261319,0.812131,-3.335942,-1.365685,0.72459,
-	0.431429,-0.109339,0.895497,-3.53391,-1.330455,0.568246,
-	-0.912869,-0.285577,0.291747,-3.438226,-0.721479,0.728141,
-	-0.99574,-0.082547,0.041071,-3.283698,-0.730967,0.793898,
-	-0.970971,-0.219011,0.096178,-3.415655,-0.308965,0.671045,
-	-0.652584,-0.147678,0.743186,-3.526766,-0.317542,0.560837,
-	-0.970971,-0.219011,0.096178,-3.415655,-0.308965,0.671045,
-	-0.739347,0.031953,0.672566,-3.470778,-0.078218,0.546398,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	-0.912869,-0.285577,0.291747,-3.438226,-0.721479,0.728141,
-	-0.970971,-0.219011,0.096178,-3.415655,-0.308965,0.671045,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	-0.970971,-0.219011,0.096178,-3.415655,-0.308965,0.671045,
-	-0.652584,-0.147678,0.743186,-3.526766,-0.317542,0.560837,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.912869,-0.285577,0.291747,-3.438226,-0.721479,0.728141,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	-0.912869,-0.285577,0.291747,-3.438226,-0.721479,0.728141,
-	-0.483189,-0.207332,0.850613,-3.569993,-0.731989,0.649435,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	-0.872722,-0.174901,0.455813,-3.27979,-1.162072,0.784602,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.4008,-0.167777,0.900672,-3.55012,-0.984868,0.675228,
-	-0.521685,-0.261319,0.812131,-3.335942,-1.365685,0.72459,
-	-0.872722,-0.174901,0.455813,-3.27979,-1.162072,0.784602,
-	-0.417424,-0.199203,0.886609,-3.492599,-1.180646,0.692282,
-	-0.874358,-0.225285,0.429819,-3.25121,-0.948205,0.819868,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.872722,-0.174901,0.455813,-3.27979,-1.162072,0.784602,
-	-0.794709,-0.185222,-0.57804,-3.556552,0.704883,0.28063,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	-0.794709,-0.185222,-0.57804,-3.556552,0.704883,0.28063,
-	-0.57342,0.819261,0,-3.544507,0.467147,0,
-	-0.17902,-0.308668,0.934171,-3.536654,0.442277,0.322,
-	-0.845931,-0.255219,-0.468256,-3.57817,0.837714,0.288502,
-	-0.989171,0.146765,0,-3.599077,0.796217,0,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.845931,-0.255219,-0.468256,-3.57817,0.837714,0.288502,
-	-0.989276,0.146061,0,-3.566995,0.656967,0,
-	-0.794709,-0.185222,-0.57804,-3.556552,0.704883,0.28063,
-	-0.99574,-0.082547,0.041071,-3.283698,-0.730967,0.793898,
-	-0.912869,-0.285577,0.291747,-3.438226,-0.721479,0.728141,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.99574,-0.082547,0.041071,-3.283698,-0.730967,0.793898,
-	-0.883057,-0.239959,0.403273,-3.355398,-0.969157,0.766213,
-	-0.874358,-0.225285,0.429819,-3.25121,-0.948205,0.819868,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	-0.239734,-0.173966,0.955125,-1.88316,-1.829718,0.401567,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	-0.498756,-0.224101,0.83727,-1.936032,-1.829617,0.488916,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	-0.759627,-0.28527,0.584455,-2.027242,-1.813012,0.555232,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	-0.672688,-0.442616,0.592944,-2.126375,-1.866497,0.502895,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	0.954473,-0.270031,0.126745,-2.176551,-1.873816,0.445782,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	0.957938,-0.285979,0.023877,-2.147113,-1.903198,0.362462,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	-0.274087,0.000043,-0.961705,-2.062725,-1.884246,0.307336,
-	-0.239734,-0.173966,0.955125,-1.88316,-1.829718,0.401567,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	-0.239734,-0.173966,0.955125,-1.88316,-1.829718,0.401567,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	0.74023,-0.090866,0.666185,-1.946306,-1.872735,0.344251,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	0.080262,-0.270606,0.959339,-2.466779,-1.857679,0.570461,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	-0.247433,-0.24804,0.936618,-2.547737,-1.833025,0.609321,
-	-0.845196,-0.27877,0.455994,-2.699966,-1.850397,0.57007,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	-0.845196,-0.27877,0.455994,-2.699966,-1.850397,0.57007,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	-0.587844,-0.244917,0.771009,-2.64722,-1.84401,0.594347,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	-0.845196,-0.27877,0.455994,-2.699966,-1.850397,0.57007,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.975634,-0.187231,-0.114377,-2.684452,-1.891207,0.447388,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.985192,-0.12583,-0.116459,-2.614084,-1.905005,0.404925,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.441315,-0.29978,0.845797,-2.446375,-1.893261,0.49411,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.996811,-0.048518,-0.063355,-2.503818,-1.909806,0.431456,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	0.122987,-0.006582,0.992387,-1.985123,-2.116661,0.394256,
-	0.041586,0.068165,0.996807,-2.065655,-2.124623,0.36872,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	0.041586,0.068165,0.996807,-2.065655,-2.124623,0.36872,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	0.041586,0.068165,0.996807,-2.065655,-2.124623,0.36872,
-	0.035084,0.005692,0.999368,-2.12403,-2.137733,0.406853,
-	0.332529,0.910491,0.245827,-2.060902,-2.031698,0.372079,
-	0.035084,0.005692,0.999368,-2.12403,-2.137733,0.406853,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	0.035084,0.005692,0.999368,-2.12403,-2.137733,0.406853,
-	-0.01346,-0.014478,0.999805,-2.144393,-2.117408,0.464489,
-	-0.212651,-0.104685,0.971504,-2.120746,-2.045137,0.411171,
-	-0.01346,-0.014478,0.999805,-2.144393,-2.117408,0.464489,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	-0.01346,-0.014478,0.999805,-2.144393,-2.117408,0.464489,
-	-0.114527,0.103064,0.988059,-2.109684,-2.112345,0.503997,
-	0.925586,0.050829,0.375109,-2.141621,-2.024301,0.470257,
-	-0.114527,0.103064,0.988059,-2.109684,-2.112345,0.503997,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	-0.114527,0.103064,0.988059,-2.109684,-2.112345,0.503997,
-	0.2189,0.87846,0.424724,-2.04111,-2.075348,0.540201,
-	0.947044,0.280641,0.156039,-2.106039,-2.019111,0.510759,
-	0.2189,0.87846,0.424724,-2.04111,-2.075348,0.540201,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	0.2189,0.87846,0.424724,-2.04111,-2.075348,0.540201,
-	-0.194126,0.280848,0.939914,-1.978016,-2.086834,0.494327,
-	0.870384,0.492056,0.017698,-2.03574,-1.981182,0.547873,
-	-0.194126,0.280848,0.939914,-1.978016,-2.086834,0.494327,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	-0.194126,0.280848,0.939914,-1.978016,-2.086834,0.494327,
-	0.742615,0.656803,0.130894,-1.941442,-2.086904,0.433904,
-	0.722741,0.690989,-0.01339,-1.971059,-1.992958,0.500845,
-	0.742615,0.656803,0.130894,-1.941442,-2.086904,0.433904,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	0.742615,0.656803,0.130894,-1.941442,-2.086904,0.433904,
-	0.122987,-0.006582,0.992387,-1.985123,-2.116661,0.394256,
-	0.532717,0.840798,0.09629,-1.933565,-1.993029,0.438902,
-	0.122987,-0.006582,0.992387,-1.985123,-2.116661,0.394256,
-	0.530834,0.847416,-0.010102,-1.978344,-2.023535,0.398257,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	0.681964,0.386261,0.621069,-2.513187,-2.130859,0.49792,
-	0.584509,0.341142,0.736187,-2.552923,-2.142304,0.454579,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	0.584509,0.341142,0.736187,-2.552923,-2.142304,0.454579,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.584509,0.341142,0.736187,-2.552923,-2.142304,0.454579,
-	0.519595,0.25029,0.816931,-2.629199,-2.138983,0.436227,
-	0.276212,-0.065585,0.958856,-2.539874,-2.049824,0.460098,
-	0.519595,0.25029,0.816931,-2.629199,-2.138983,0.436227,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.519595,0.25029,0.816931,-2.629199,-2.138983,0.436227,
-	0.237937,0.08172,0.967837,-2.677875,-2.129439,0.4656,
-	0.373808,-0.059429,0.9256,-2.618068,-2.046419,0.441284,
-	0.237937,0.08172,0.967837,-2.677875,-2.129439,0.4656,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.237937,0.08172,0.967837,-2.677875,-2.129439,0.4656,
-	0.198142,0.152918,0.968171,-2.695135,-2.12165,0.508064,
-	0.45571,-0.00339,0.890122,-2.667969,-2.036634,0.471396,
-	0.198142,0.152918,0.968171,-2.695135,-2.12165,0.508064,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.198142,0.152918,0.968171,-2.695135,-2.12165,0.508064,
-	0.198441,0.172024,0.964898,-2.688607,-2.101208,0.550465,
-	0.512523,0.043999,0.857545,-2.685663,-2.028649,0.514928,
-	0.198441,0.172024,0.964898,-2.688607,-2.101208,0.550465,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	0.198441,0.172024,0.964898,-2.688607,-2.101208,0.550465,
-	0.204819,0.130792,0.970022,-2.65212,-2.09679,0.567258,
-	0.754806,0.216246,0.619279,-2.678971,-2.007694,0.558395,
-	0.204819,0.130792,0.970022,-2.65212,-2.09679,0.567258,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	0.204819,0.130792,0.970022,-2.65212,-2.09679,0.567258,
-	0.154029,0.078449,0.984947,-2.583303,-2.089191,0.577616,
-	0.827569,0.284291,0.484054,-2.641567,-2.003164,0.575611,
-	0.154029,0.078449,0.984947,-2.583303,-2.089191,0.577616,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	0.154029,0.078449,0.984947,-2.583303,-2.089191,0.577616,
-	0.032152,0.123743,0.991793,-2.527301,-2.106246,0.550735,
-	0.856604,0.474875,0.201802,-2.571019,-1.995375,0.58623,
-	0.032152,0.123743,0.991793,-2.527301,-2.106246,0.550735,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	0.032152,0.123743,0.991793,-2.527301,-2.106246,0.550735,
-	0.681964,0.386261,0.621069,-2.513187,-2.130859,0.49792,
-	0.78715,0.616449,-0.019656,-2.513608,-2.012858,0.558673,
-	0.681964,0.386261,0.621069,-2.513187,-2.130859,0.49792,
-	0.66813,0.738233,-0.092817,-2.499138,-2.03809,0.504529,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	0.742615,0.656803,0.130894,-1.941442,-2.086904,0.433904,
-	-0.194126,0.280848,0.939914,-1.978016,-2.086834,0.494327,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	-0.194126,0.280848,0.939914,-1.978016,-2.086834,0.494327,
-	0.2189,0.87846,0.424724,-2.04111,-2.075348,0.540201,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	0.2189,0.87846,0.424724,-2.04111,-2.075348,0.540201,
-	-0.114527,0.103064,0.988059,-2.109684,-2.112345,0.503997,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	-0.114527,0.103064,0.988059,-2.109684,-2.112345,0.503997,
-	-0.01346,-0.014478,0.999805,-2.144393,-2.117408,0.464489,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	-0.01346,-0.014478,0.999805,-2.144393,-2.117408,0.464489,
-	0.035084,0.005692,0.999368,-2.12403,-2.137733,0.406853,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	0.035084,0.005692,0.999368,-2.12403,-2.137733,0.406853,
-	0.041586,0.068165,0.996807,-2.065655,-2.124623,0.36872,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	0.041586,0.068165,0.996807,-2.065655,-2.124623,0.36872,
-	0.122987,-0.006582,0.992387,-1.985123,-2.116661,0.394256,
-	-0.077208,0.343417,0.936004,-2.048681,-2.165282,0.450843,
-	0.122987,-0.006582,0.992387,-1.985123,-2.116661,0.394256,
-	0.742615,0.656803,0.130894,-1.941442,-2.086904,0.433904,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.681964,0.386261,0.621069,-2.513187,-2.130859,0.49792,
-	0.032152,0.123743,0.991793,-2.527301,-2.106246,0.550735,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.032152,0.123743,0.991793,-2.527301,-2.106246,0.550735,
-	0.154029,0.078449,0.984947,-2.583303,-2.089191,0.577616,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.154029,0.078449,0.984947,-2.583303,-2.089191,0.577616,
-	0.204819,0.130792,0.970022,-2.65212,-2.09679,0.567258,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.204819,0.130792,0.970022,-2.65212,-2.09679,0.567258,
-	0.198441,0.172024,0.964898,-2.688607,-2.101208,0.550465,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.198441,0.172024,0.964898,-2.688607,-2.101208,0.550465,
-	0.198142,0.152918,0.968171,-2.695135,-2.12165,0.508064,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.198142,0.152918,0.968171,-2.695135,-2.12165,0.508064,
-	0.237937,0.08172,0.967837,-2.677875,-2.129439,0.4656,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.237937,0.08172,0.967837,-2.677875,-2.129439,0.4656,
-	0.519595,0.25029,0.816931,-2.629199,-2.138983,0.436227,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.519595,0.25029,0.816931,-2.629199,-2.138983,0.436227,
-	0.584509,0.341142,0.736187,-2.552923,-2.142304,0.454579,
-	0.510285,0.851048,0.1238,-2.603284,-2.176802,0.510638,
-	0.584509,0.341142,0.736187,-2.552923,-2.142304,0.454579,
-	0.681964,0.386261,0.621069,-2.513187,-2.130859,0.49792,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.999491,-0.02584,0.01873,-2.941731,-1.787431,0.442574,
-	0.713401,0.39471,-0.579019,-3.008323,-1.759271,0.655672,
-	0.820312,-0.193024,0.538358,-3.120907,-1.707924,0.431829,
-	0.713401,0.39471,-0.579019,-3.008323,-1.759271,0.655672,
-	0.843062,-0.10517,0.527433,-3.139394,-1.687482,0.638546,
-	0.999491,-0.02584,0.01873,-2.941731,-1.787431,0.442574,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	0.713401,0.39471,-0.579019,-3.008323,-1.759271,0.655672,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	-0.845196,-0.27877,0.455994,-2.699966,-1.850397,0.57007,
-	-0.732521,-0.474279,0.488336,-2.811581,-1.79821,0.712737,
-	0.972392,0.232654,0.018037,-2.709403,-1.879947,0.508775,
-	-0.732521,-0.474279,0.488336,-2.811581,-1.79821,0.712737,
-	0.713401,0.39471,-0.579019,-3.008323,-1.759271,0.655672,
-	-0.530021,0.13773,0.836724,-3.697889,-0.951955,0.098793,
-	-0.54555,-0.056478,0.836173,-3.67645,-0.551317,0.077574,
-	-0.548359,-0.017804,0.836053,-3.699784,-0.759901,0.088664
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1515,data,NULL};
-const struct gllist *cow_udder=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char cow_udder[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\037\001\000\000\353\005\000\000\026\003\000\000"
+ "\212\345\024\300<g+\277\000\000\000\000V\357@8\344\030\224\353\036\256\000"
+ "\000\215\021\000\331\214\255\000\000\257\001\001\332_\256\000\000\011\031"
+ "\254\333\350\255\000\0007.1\342\343\257\000\000l\364\377\311\357\255\000"
+ "\000\017\377\201\307\347\255\000\000\374\015E\310\261\256\000\000(\030\134"
+ "\311\031\260\000\000\257.\223\314S\262\000\000m4\343\313\312\263\000\000"
+ "\336I\327\312\020\264\000\000\202\351\217\270\316\264\000\000@\370\367\264"
+ "\250\264\000\000\266\010\371\265U\265\000\000~\027.\264\223\271\000\000\234"
+ ".\304\273,\270\000\000\200.7\265\020\276\000\000]6\277\300,\266\000\000]"
+ ">=\301\314\270\000\000\300A\315\264\206\301\000\000\2378\266\265\021\275"
+ "\000\000~Q\014\307\356\262\000\000\264P\271\253\362\302\000\000\312_5\275"
+ "\317\264\000\000\233_\344\262\042\274\000\000\236t\224\265\244\263\000\000"
+ "\345N\005\251\215\317\000\000\336G.\254|\314\000\000\217=\216\261\222\314"
+ "\000\000\213Dk\254d\325\000\000\034N\271\250\301\331\000\000\267\077\316"
+ "\250\226\341\000\000\323O\356\2465\342\000\000\013Oy\246\000\000\000\000"
+ "\330<\203\247\000\000\000\000\272,\373\243\000\000\000\000\304/\372\242y"
+ "\335\000\000%1\077\253\202\314\000\000a\335\370\246Y\300\000\000\203\360"
+ "\315\246\267\302\000\000\015\005\353\243\306\307\000\000\216\030h\245:\310"
+ "\000\000\246%z\235\346\335\000\000)!}\235{\326\000\000j\031\346\236\332\320"
+ "\000\000\377\020[\232K\325\000\000\274\014\274\231%\332\000\000\303\000\263"
+ "\231\012\330\000\000\322\365\025\230\012\326\000\000\027\364\033\233\216"
+ "\317\000\0007\3553\235B\314\000\000\304\344D\234\207\315\000\000I\340\271"
+ "\233\227\317\000\000\317\326'\240y\303\000\000\301\313\022\241k\332\000\000"
+ "|\3376\231\313\324\000\000\233\341B\230\002\332\000\000\367\317\234\241\000"
+ "\000\000\000\224\347\026\227\235\335\000\000\362\343\177\233\000\000\000"
+ "\000\361\360\255\226\134\333\000\000-\376!\232\000\000\000\000<\017=\227"
+ "8\341\000\000g\026\331\230\347\345\000\000\326\023\243\234\000\000\000\000"
+ "I \323\231\304\342\000\000\370\272\217\251\306\311\000\000\212\274\322\247"
+ "T\333\000\000\022\254\020\261\253\332\000\000\354\254\200\262\134\311\000"
+ "\000D\241\324\272~\335\000\000\354\245\252\272\334\306\000\000o\227B\310"
+ "\346\337\000\000x\231\340\307\277\317\000\000~\220\012\330\247\343\000\000"
+ "5\221\211\326\020\325\000\000\202\214\276\347\314\344\000\000\030\216\354"
+ "\346\212\330\000\000Z\215\347\372\352\343\000\000E\216\205\372\032\332\000"
+ "\000r\222\033\033A\343\000\0003\224q\033\311\333\000\000b\226\3013\267\342"
+ "\000\000\323\231A3\337\332\000\000W\231\035IB\343\000\000\353\232\203Et\333"
+ "\000\000<\231j^\250\344\000\000\350\227\202K\000\000\000\000\221\230\207"
+ "`\000\000\000\000<\225k4\000\000\000\000\251\220\232\032\000\000\000\000"
+ "\233\215\246\373\000\000\000\000*\215'\352\000\000\000\000\217\217\327\327"
+ "\000\000\000\000x\232\316\304\000\000\000\000V\243\364\271\000\000\000\000"
+ "\313\2572\260\000\000\000\000q\2752\251\000\000\000\000\324\23672\232\321"
+ "\000\000\023\232\344\035`\320\000\000g\226\262\372\332\310\000\000\027\230"
+ "9\345\251\306\000\000\372\234\231\3246\305\000\000G\252\342\304x\302\000"
+ "\000\203\243\237\036\004\307\000\000\267\256\311\372\225\274\000\000\230"
+ "\241\227\373+\302\000\000\241\250\217\346\357\276\000\000\014\257-\326_\275"
+ "\000\000z\261V\350`\272\000\000\251\226\246p\000\000\000\000\214\227\267"
+ "t+\350\000\000\357\223y|\000\000\000\000\266\225\377\177\200\347\000\000"
+ "^!\234\217\273\332\000\000/\036\236\217x\325\000\000\261\030\236\220z\321"
+ "\000\000\271\022e\215\240\324\000\000\263\017\364\214\021\330\000\000y\021"
+ "/\213\025\335\000\000\216\026S\214g\340\000\000\221\035\005\215.\336\000"
+ "\000W\361\311\213(\325\000\000\035\360\355\215\217\320\000\000=\353i\217"
+ "8\316\000\000\077\345\300\216\037\317\000\000\022\342]\216\225\320\000\000"
+ "\200\341\226\214F\324\000\000\001\343\350\213\370\327\000\000>\347\023\213"
+ "\207\332\000\000\342\355\311\212\356\330\000\000'\026o\204\260\340\000\000"
+ "\376\034\034\205\205\336\000\0002\021R\203s\335\000\000w\017\014\205\216"
+ "\330\000\000j\022z\2053\325\000\000<\030\237\210 \322\000\000\230\035\245"
+ "\207\006\326\000\000\263 \243\207'\333\000\000\306\354\357\202f\331\000\000"
+ "&\360\350\203\267\325\000\000L\3467\203\365\332\000\000*\342\007\204v\330"
+ "\000\000\262\340\260\204\333\324\000\000@\341l\206A\321\000\000Y\344\314"
+ "\206\324\317\000\0001\352r\207\363\316\000\000\363\356\377\205;\321\000\000"
+ "\230\027\373\200\267\331\000\000\177\350\001\200\243\324\000\000\032\306"
+ "v\243R\310\000\000\257\001\001\332\241Q\000\000\215\021\000\331tR\000\000"
+ "\344\030\224\353\342Q\000\000\011\031\254\333\030R\000\0007.1\342\035P\000"
+ "\000\017\377\201\307\031R\000\000l\364\377\311\021R\000\000\374\015E\310"
+ "OQ\000\000(\030\134\311\347O\000\000\257.\223\314\255M\000\000m4\343\313"
+ "6L\000\000\336I\327\312\360K\000\000@\370\367\264XK\000\000\202\351\217\270"
+ "2K\000\000\266\010\371\265\253J\000\000~\027.\264mF\000\000\200.7\265\360"
+ "A\000\000\234.\304\273\324G\000\000]6\277\300\324I\000\000]>=\3014G\000\000"
+ "\300A\315\264z>\000\000\2378\266\265\357B\000\000\264P\271\253\016=\000\000"
+ "~Q\014\307\022M\000\000\233_\344\262\336C\000\000\312_5\2751K\000\000\236"
+ "t\224\265\134L\000\000\336G.\254\2043\000\000\345N\005\251s0\000\000\217"
+ "=\216\261n3\000\000\213Dk\254\234*\000\000\034N\271\250\077&\000\000\267"
+ "\077\316\250j\036\000\000\323O\356\246\313\035\000\000\304/\372\242\207\042"
+ "\000\000%1\077\253~3\000\000\203\360\315\246I=\000\000a\335\370\246\247\077"
+ "\000\000\015\005\353\243:8\000\000\216\030h\245\3067\000\000)!}\235\205)"
+ "\000\000\246%z\235\032\042\000\000j\031\346\236&/\000\000\377\020[\232\265"
+ "*\000\000\303\000\263\231\366'\000\000\274\014\274\231\333%\000\000\027\364"
+ "\033\233r0\000\000\322\365\025\230\366)\000\0007\3553\235\2763\000\000\304"
+ "\344D\234y2\000\000\317\326'\240\207<\000\000I\340\271\233i0\000\000\233"
+ "\341B\230\376%\000\000|\3376\2315+\000\000\301\313\022\241\225%\000\000\224"
+ "\347\026\227c\042\000\000\361\360\255\226\244$\000\000<\017=\227\310\036"
+ "\000\000g\026\331\230\031\032\000\000I \323\231<\035\000\000\354\254\200"
+ "\262\2446\000\000\022\254\020\261U%\000\000\212\274\322\247\254$\000\000"
+ "\370\272\217\251:6\000\000\354\245\252\272$9\000\000D\241\324\272\202\042"
+ "\000\000x\231\340\307A0\000\000o\227B\310\032 \000\0005\221\211\326\360*"
+ "\000\000~\220\012\330Y\034\000\000\030\216\354\346v'\000\000\202\214\276"
+ "\3474\033\000\000E\216\205\372\346%\000\000Z\215\347\372\026\034\000\000"
+ "3\224q\0337$\000\000r\222\033\033\277\034\000\000\323\231A3!%\000\000b\226"
+ "\3013I\035\000\000\353\232\203E\214$\000\000W\231\035I\276\034\000\000<\231"
+ "j^X\033\000\000\324\23672f.\000\000\023\232\344\035\240/\000\000g\226\262"
+ "\372&7\000\000\027\2309\345W9\000\000\372\234\231\324\312:\000\000G\252\342"
+ "\304\210=\000\000\230\241\227\373\325=\000\000\267\256\311\372kC\000\000"
+ "\203\243\237\036\3748\000\000\241\250\217\346\021A\000\000\014\257-\326\241"
+ "B\000\000z\261V\350\240E\000\000\214\227\267t\325\027\000\000\266\225\377"
+ "\177\200\030\000\000/\036\236\217\210*\000\000^!\234\217E%\000\000\261\030"
+ "\236\220\206.\000\000\271\022e\215`+\000\000\263\017\364\214\357'\000\000"
+ "y\021/\213\353\042\000\000\216\026S\214\231\037\000\000\221\035\005\215\322"
+ "!\000\000\035\360\355\215q/\000\000W\361\311\213\330*\000\000=\353i\217\310"
+ "1\000\000\077\345\300\216\3410\000\000\022\342]\216k/\000\000\200\341\226"
+ "\214\272+\000\000\001\343\350\213\010(\000\000>\347\023\213y%\000\000\342"
+ "\355\311\212\022'\000\000\376\034\034\205{!\000\000'\026o\204P\037\000\000"
+ "2\021R\203\215\042\000\000w\017\014\205r'\000\000j\022z\205\315*\000\000"
+ "<\030\237\210\340-\000\000\230\035\245\207\372)\000\000\263 \243\207\331"
+ "$\000\000&\360\350\203I*\000\000\306\354\357\202\232&\000\000L\3467\203\013"
+ "%\000\000*\342\007\204\212'\000\000\262\340\260\204%+\000\000@\341l\206\277"
+ ".\000\000Y\344\314\206,0\000\0001\352r\207\0151\000\000\363\356\377\205\305"
+ ".\000\000\230\027\373\200I&\000\000\177\350\001\200]+\000\000\032\306v\243"
+ "\2567\000\000\213\213\005\350d\010\000\000]\215\012\012\226\006\000\000b"
+ "\213T\370\210\007\000\000k\207\222\343nw\223\334\216\235\227\332\211\312"
+ "}\205y\213`\234\224\201i\212d\216k\216h\212\257\221R\234P\202O\212N\216Y"
+ "\211C\216\220\245\242\247Z\214Y\223\230\225\313\211;\216\325\232\333\224"
+ "\340\222\312\242\256\251\001~\014s\356\223\323\233\337\223\033\206\342\223"
+ "3\246C\234H\246B\205<\210B\2177\300B\236@\2203\203\335\212\037\207\077\250"
+ "T\242\254\210U\212\273\215\011v\037\250\007x\332\237\013t\332\250\341\247"
+ "\021n\357\234\376\211\010\220\024\272&\313\325\254\345\310\311\265\325\323"
+ "\274\301\221\351\260\315\237\300\241\336\231\314\212\362\210\334\213\022"
+ "\212%\221\036\221.\217 \023l\314K8G\013\214#\244\336\243\356\223\004\205"
+ "\024\225\211\010\206\373\215/\210\027\206\350\220\366\202#\221@\212@\224"
+ "\355\205\275\217\262\2024\2012\221\020\211U\221\020\203\251;\361\034\360"
+ ",\360k\317n\271q\216\211\234\210\246/\000\036\002<\376I\267\026\263\363\261"
+ "\333\266\306\253\251\240]\212\240\224\134\252\334\210{ikSoA{5f\224f\256x"
+ ";{\320q\306o\253p\221q\207uhoNq\203,\346\275\022\245\371\312\374\223\012"
+ "\335\370\237\020\246\011\257\020\241\016\260\014\230\007\231\373\244\001"
+ "\213\361\301\020\301\011\317\362\304\374\265\001\263\000\326\010\330\376"
+ "\345\014\343\010\267\000\276\001\375\027Q\345\321\355:\352 \361\003\364\360"
+ "\361\346\014\314\354\320\345<\350V\345 \352\003\353\327\356\352\360\305\352"
+ "\316\337\077\350Z\347\010\346#\350\352\352\321\355\311\334\274\352l\342e"
+ "\030z\375r\347y\363`\343\201c\077\370C\354I\367C\360I\367\033\363\020\015"
+ "&\366#\360&\351'\364\371\360\006\363\004\354\372\365\366\021\012\343\351"
+ "\362\353\370\363\354\356\365\360\344\277\003\312\364\330\357\335\361\335"
+ "\357\326\353\262\350\217\367\240\352\267\354\266\361\267\355\220\302\226"
+ "\305B\077.IP-W\032W\005\353\366\034N1NH9@FG'B\027<\021.\004+\000#\372\033"
+ "\372\016\377\005\010\004\001\376\376\364\013\022I\357\031>73\035-\032*\024"
+ "\027\010\023\017\023\020\024\015\020\010\004\016\371 ,IaI\323\014\320\373"
+ "\316\376\000\000\000\000\001\000\002\000\001\000\000\000\003\000\003\000"
+ "\000\000\004\000\005\000\002\000\006\000\006\000\002\000\001\000\006\000"
+ "\001\000\007\000\007\000\001\000\003\000\007\000\003\000\010\000\010\000"
+ "\003\000\004\000\010\000\004\000\011\000\011\000\004\000\012\000\012\000"
+ "\004\000\013\000\014\000\005\000\006\000\014\000\006\000\015\000\015\000"
+ "\006\000\007\000\015\000\007\000\016\000\016\000\007\000\010\000\016\000"
+ "\010\000\017\000\017\000\010\000\020\000\017\000\020\000\021\000\020\000"
+ "\010\000\011\000\020\000\011\000\012\000\020\000\012\000\022\000\022\000"
+ "\012\000\013\000\022\000\013\000\023\000\023\000\013\000\024\000\024\000"
+ "\025\000\023\000\023\000\025\000\022\000\022\000\025\000\021\000\022\000"
+ "\021\000\020\000\024\000\013\000\026\000\024\000\026\000\027\000\027\000"
+ "\026\000\030\000\027\000\030\000\031\000\031\000\030\000\032\000\033\000"
+ "\034\000\027\000\027\000\034\000\024\000\024\000\034\000\035\000\035\000"
+ "\034\000\036\000\036\000\034\000\033\000\036\000\033\000\037\000\035\000"
+ "\036\000 \000 \000\036\000\037\000 \000\037\000!\000!\000\042\000#\000!\000"
+ "#\000 \000 \000#\000$\000 \000$\000%\000%\000&\000\035\000%\000\035\000 "
+ "\000\035\000&\000\021\000\021\000\025\000\035\000\035\000\025\000\024\000"
+ "'\000\014\000\015\000'\000\015\000(\000(\000\015\000\016\000(\000\016\000"
+ ")\000)\000\016\000\017\000)\000\017\000*\000*\000\017\000\021\000*\000\021"
+ "\000&\000&\000%\000+\000&\000+\000,\000,\000-\000*\000,\000*\000&\000*\000"
+ "-\000.\000*\000.\000)\000)\000.\000/\000)\000/\0000\0000\0001\0002\0000\000"
+ "2\000)\000)\0002\0003\000)\0003\000(\000(\0003\0004\000(\0004\000'\000'\000"
+ "4\0005\000'\0005\0006\0007\0008\0009\0007\0009\000:\000:\0009\000;\000:\000"
+ ";\000<\000<\000;\000=\000<\000=\000>\000>\000=\0001\000>\0001\0000\0000\000"
+ "/\000\077\0000\000\077\000>\000>\000\077\000@\000>\000@\000A\000A\000@\000"
+ "B\000A\000B\000$\000$\000B\000+\000$\000+\000%\000C\000D\000E\000C\000E\000"
+ "F\000F\000E\000G\000F\000G\000H\000H\000G\000I\000H\000I\000J\000J\000I\000"
+ "K\000J\000K\000L\000L\000K\000M\000L\000M\000N\000N\000M\000O\000N\000O\000"
+ "P\000P\000O\000Q\000P\000Q\000R\000R\000Q\000S\000R\000S\000T\000T\000S\000"
+ "U\000T\000U\000V\000V\000U\000W\000W\000U\000X\000W\000X\000Y\000X\000U\000"
+ "S\000X\000S\000Z\000[\000Q\000O\000[\000O\000\134\000\134\000O\000M\000\134"
+ "\000M\000]\000]\000M\000K\000]\000K\000^\000^\000K\000I\000^\000I\000_\000"
+ "_\000I\000G\000_\000G\000`\000`\000G\000E\000`\000E\000a\000a\000E\000D\000"
+ "a\000D\000b\000b\000D\0007\000b\0007\000:\000Z\000S\000Q\000Z\000Q\000[\000"
+ "V\000c\000T\000T\000c\000d\000T\000d\000R\000R\000d\000e\000R\000e\000P\000"
+ "P\000e\000f\000P\000f\000N\000N\000f\000g\000N\000g\000L\000L\000g\000h\000"
+ "L\000h\000J\000J\000h\000H\000i\000j\000k\000c\000i\000d\000d\000i\000k\000"
+ "d\000k\000e\000e\000k\000l\000e\000l\000f\000f\000l\000m\000f\000m\000g\000"
+ "g\000m\000h\000m\000l\000n\000W\000Y\000o\000W\000o\000p\000p\000o\000q\000"
+ "p\000q\000r\000n\000l\000k\000n\000k\000j\000+\000s\000t\000+\000t\000,\000"
+ ",\000t\000u\000,\000u\000-\000-\000u\000v\000-\000v\000.\000.\000v\000w\000"
+ ".\000w\000/\000/\000w\000x\000/\000x\000\077\000\077\000x\000y\000\077\000"
+ "y\000@\000@\000y\000z\000@\000z\000B\000B\000z\000s\000B\000s\000+\0001\000"
+ "{\000|\0001\000|\0002\0002\000|\000}\0002\000}\0003\0003\000}\000~\0003\000"
+ "~\0004\0004\000~\000\177\0004\000\177\0005\0005\000\177\000\200\0005\000"
+ "\200\0008\0008\000\200\000\201\0008\000\201\0009\0009\000\201\000\202\000"
+ "9\000\202\000;\000;\000\202\000\203\000;\000\203\000=\000=\000\203\000{\000"
+ "=\000{\0001\000y\000\204\000\205\000y\000\205\000z\000x\000\206\000\204\000"
+ "x\000\204\000y\000w\000\207\000\206\000w\000\206\000x\000v\000\210\000\207"
+ "\000v\000\207\000w\000u\000\211\000\210\000u\000\210\000v\000t\000\212\000"
+ "\211\000t\000\211\000u\000s\000\213\000\212\000s\000\212\000t\000z\000\205"
+ "\000\213\000z\000\213\000s\000\203\000\214\000\215\000\203\000\215\000{\000"
+ "\202\000\216\000\214\000\202\000\214\000\203\000\201\000\217\000\216\000"
+ "\201\000\216\000\202\000\200\000\220\000\217\000\200\000\217\000\201\000"
+ "\177\000\221\000\220\000\177\000\220\000\200\000~\000\222\000\221\000~\000"
+ "\221\000\177\000}\000\223\000\222\000}\000\222\000~\000|\000\224\000\223"
+ "\000|\000\223\000}\000{\000\215\000\224\000{\000\224\000|\000\212\000\213"
+ "\000\225\000\211\000\212\000\225\000\210\000\211\000\225\000\207\000\210"
+ "\000\225\000\206\000\207\000\225\000\204\000\206\000\225\000\205\000\204"
+ "\000\225\000\213\000\205\000\225\000\224\000\215\000\226\000\223\000\224"
+ "\000\226\000\222\000\223\000\226\000\221\000\222\000\226\000\220\000\221"
+ "\000\226\000\217\000\220\000\226\000\216\000\217\000\226\000\214\000\216"
+ "\000\226\000\215\000\214\000\226\000C\000\227\0007\000C\0007\000D\000\227"
+ "\0008\0007\000\227\0006\0005\000\227\0005\0008\000\230\000\231\000\232\000"
+ "\233\000\232\000\231\000\234\000\232\000\233\000\235\000\230\000\236\000"
+ "\237\000\231\000\230\000\237\000\230\000\235\000\240\000\233\000\231\000"
+ "\240\000\231\000\237\000\241\000\234\000\233\000\241\000\233\000\240\000"
+ "\242\000\234\000\241\000\243\000\234\000\242\000\244\000\235\000\236\000"
+ "\244\000\236\000\245\000\246\000\237\000\235\000\246\000\235\000\244\000"
+ "\247\000\240\000\237\000\247\000\237\000\246\000\250\000\251\000\240\000"
+ "\250\000\240\000\247\000\241\000\240\000\251\000\252\000\242\000\241\000"
+ "\252\000\241\000\251\000\253\000\243\000\242\000\253\000\242\000\252\000"
+ "\254\000\243\000\253\000\253\000\255\000\254\000\252\000\255\000\253\000"
+ "\251\000\250\000\255\000\251\000\255\000\252\000\256\000\257\000\243\000"
+ "\256\000\243\000\254\000\260\000\261\000\257\000\260\000\257\000\256\000"
+ "\262\000\261\000\260\000\256\000\263\000\264\000\254\000\263\000\256\000"
+ "\265\000\263\000\254\000\266\000\263\000\265\000\267\000\264\000\263\000"
+ "\267\000\263\000\266\000\270\000\266\000\265\000\271\000\267\000\266\000"
+ "\271\000\266\000\270\000\270\000#\000\042\000\270\000\042\000\271\000\272"
+ "\000$\000#\000\272\000#\000\270\000\270\000\265\000\273\000\270\000\273\000"
+ "\272\000\250\000\273\000\265\000\265\000\255\000\250\000\254\000\255\000"
+ "\265\000\274\000\244\000\245\000\274\000\245\000\275\000\276\000\246\000"
+ "\244\000\276\000\244\000\274\000\277\000\247\000\246\000\277\000\246\000"
+ "\276\000\273\000\250\000\247\000\273\000\247\000\277\000\300\000\301\000"
+ "\272\000\300\000\272\000\273\000\273\000\277\000\302\000\273\000\302\000"
+ "\300\000\276\000\303\000\302\000\276\000\302\000\277\000\304\000\305\000"
+ "\303\000\304\000\303\000\276\000\276\000\306\000\307\000\276\000\307\000"
+ "\304\000\274\000\310\000\306\000\274\000\306\000\276\000\275\000\311\000"
+ "\310\000\275\000\310\000\274\000\312\000\313\000\311\000\312\000\311\000"
+ "\275\000:\000\314\000\315\000:\000\315\000\316\000<\000\317\000\314\000<"
+ "\000\314\000:\000>\000\320\000\317\000>\000\317\000<\000\304\000\307\000"
+ "\320\000\304\000\320\000>\000>\000\321\000\305\000>\000\305\000\304\000A"
+ "\000\322\000\321\000A\000\321\000>\000$\000\323\000\322\000$\000\322\000"
+ "A\000\272\000\301\000\323\000\272\000\323\000$\000\324\000\325\000\326\000"
+ "\324\000\326\000\327\000\330\000\331\000\325\000\330\000\325\000\324\000"
+ "\332\000\333\000\331\000\332\000\331\000\330\000\334\000\335\000\333\000"
+ "\334\000\333\000\332\000\336\000\337\000\335\000\336\000\335\000\334\000"
+ "\340\000\341\000\337\000\340\000\337\000\336\000\342\000\343\000\341\000"
+ "\342\000\341\000\340\000\344\000\345\000\343\000\344\000\343\000\342\000"
+ "\346\000\347\000\345\000\346\000\345\000\344\000\350\000\347\000\346\000"
+ "Y\000X\000\347\000Y\000\347\000\350\000Z\000\345\000\347\000Z\000\347\000"
+ "X\000\134\000\341\000\343\000\134\000\343\000[\000]\000\337\000\341\000]"
+ "\000\341\000\134\000^\000\335\000\337\000^\000\337\000]\000_\000\333\000"
+ "\335\000_\000\335\000^\000`\000\331\000\333\000`\000\333\000_\000a\000\325"
+ "\000\331\000a\000\331\000`\000b\000\326\000\325\000b\000\325\000a\000:\000"
+ "\316\000\326\000:\000\326\000b\000[\000\343\000\345\000[\000\345\000Z\000"
+ "\344\000\351\000\346\000\342\000\352\000\351\000\342\000\351\000\344\000"
+ "\340\000\353\000\352\000\340\000\352\000\342\000\336\000\354\000\353\000"
+ "\336\000\353\000\340\000\334\000\355\000\354\000\334\000\354\000\336\000"
+ "\332\000\356\000\355\000\332\000\355\000\334\000\330\000\356\000\332\000"
+ "\357\000\360\000\361\000\352\000\361\000\351\000\353\000\357\000\361\000"
+ "\353\000\361\000\352\000\354\000\362\000\357\000\354\000\357\000\353\000"
+ "\355\000\363\000\362\000\355\000\362\000\354\000\356\000\363\000\355\000"
+ "\364\000\362\000\363\000\365\000o\000Y\000\365\000Y\000\350\000\366\000q"
+ "\000o\000\366\000o\000\365\000\360\000\357\000\362\000\360\000\362\000\364"
+ "\000\300\000\367\000\370\000\300\000\370\000\301\000\302\000\371\000\367"
+ "\000\302\000\367\000\300\000\303\000\372\000\371\000\303\000\371\000\302"
+ "\000\305\000\373\000\372\000\305\000\372\000\303\000\321\000\374\000\373"
+ "\000\321\000\373\000\305\000\322\000\375\000\374\000\322\000\374\000\321"
+ "\000\323\000\376\000\375\000\323\000\375\000\322\000\301\000\370\000\376"
+ "\000\301\000\376\000\323\000\306\000\377\000\000\001\306\000\000\001\307"
+ "\000\310\000\001\001\377\000\310\000\377\000\306\000\311\000\002\001\001"
+ "\001\311\000\001\001\310\000\313\000\003\001\002\001\313\000\002\001\311"
+ "\000\315\000\004\001\003\001\315\000\003\001\313\000\314\000\005\001\004"
+ "\001\314\000\004\001\315\000\317\000\006\001\005\001\317\000\005\001\314"
+ "\000\320\000\007\001\006\001\320\000\006\001\317\000\307\000\000\001\007"
+ "\001\307\000\007\001\320\000\376\000\010\001\011\001\376\000\011\001\375"
+ "\000\375\000\011\001\012\001\375\000\012\001\374\000\374\000\012\001\013"
+ "\001\374\000\013\001\373\000\373\000\013\001\014\001\373\000\014\001\372"
+ "\000\372\000\014\001\015\001\372\000\015\001\371\000\371\000\015\001\016"
+ "\001\371\000\016\001\367\000\367\000\016\001\017\001\367\000\017\001\370"
+ "\000\370\000\017\001\010\001\370\000\010\001\376\000\000\001\020\001\021"
+ "\001\000\001\021\001\007\001\007\001\021\001\022\001\007\001\022\001\006"
+ "\001\006\001\022\001\023\001\006\001\023\001\005\001\005\001\023\001\024"
+ "\001\005\001\024\001\004\001\004\001\024\001\025\001\004\001\025\001\003"
+ "\001\003\001\025\001\026\001\003\001\026\001\002\001\002\001\026\001\027"
+ "\001\002\001\027\001\001\001\001\001\027\001\030\001\001\001\030\001\377"
+ "\000\377\000\030\001\020\001\377\000\020\001\000\001\031\001\017\001\016"
+ "\001\031\001\016\001\015\001\031\001\015\001\014\001\031\001\014\001\013"
+ "\001\031\001\013\001\012\001\031\001\012\001\011\001\031\001\011\001\010"
+ "\001\031\001\010\001\017\001\032\001\020\001\030\001\032\001\030\001\027"
+ "\001\032\001\027\001\026\001\032\001\026\001\025\001\032\001\025\001\024"
+ "\001\032\001\024\001\023\001\032\001\023\001\022\001\032\001\022\001\021"
+ "\001\032\001\021\001\020\001\326\000\316\000\033\001\326\000\033\001\327"
+ "\000\316\000\315\000\033\001\315\000\313\000\312\000\315\000\312\000\033"
+ "\001\034\001\035\001\036\001\000\000\000\000\001\000\001\000\002\000\000"
+ "\000\002\000\000\000\003\000\001\000\003\000\000\000\004\000\003\000\004"
+ "\000\002\000\005\000\002\000\006\000\005\000\006\000\001\000\006\000\001"
+ "\000\007\000\006\000\007\000\003\000\007\000\003\000\010\000\007\000\010"
+ "\000\004\000\010\000\004\000\011\000\010\000\011\000\004\000\012\000\011"
+ "\000\012\000\004\000\013\000\012\000\013\000\005\000\014\000\006\000\014"
+ "\000\006\000\015\000\014\000\015\000\007\000\015\000\007\000\016\000\015"
+ "\000\016\000\010\000\016\000\010\000\017\000\016\000\017\000\010\000\020"
+ "\000\017\000\020\000\020\000\021\000\017\000\021\000\011\000\020\000\012"
+ "\000\020\000\012\000\022\000\020\000\022\000\013\000\022\000\013\000\023"
+ "\000\022\000\023\000\013\000\024\000\023\000\024\000\024\000\025\000\023"
+ "\000\025\000\022\000\025\000\021\000\025\000\021\000\022\000\013\000\026"
+ "\000\024\000\026\000\026\000\027\000\024\000\027\000\026\000\030\000\027"
+ "\000\030\000\030\000\031\000\027\000\031\000\030\000\032\000\031\000\032"
+ "\000\033\000\034\000\027\000\034\000\027\000\033\000\024\000\034\000\034"
+ "\000\035\000\024\000\035\000\034\000\036\000\035\000\036\000\033\000\036"
+ "\000\033\000\037\000\036\000\037\000\036\000 \000\035\000 \000\037\000 \000"
+ "\037\000!\000 \000!\000!\000\042\000\042\000#\000!\000#\000 \000#\000#\000"
+ "$\000 \000$\000$\000%\000 \000%\000%\000&\000\035\000&\000\035\000%\000\021"
+ "\000&\000\021\000\035\000\025\000\035\000\014\000'\000\015\000'\000\015\000"
+ "(\000'\000(\000\016\000(\000\016\000)\000(\000)\000\017\000)\000\017\000"
+ "*\000)\000*\000\021\000*\000&\000*\000%\000+\000&\000+\000+\000,\000&\000"
+ ",\000,\000-\000*\000-\000*\000,\000-\000.\000*\000.\000)\000.\000.\000/\000"
+ ")\000/\000/\0000\000)\0000\0000\0001\0001\0002\0000\0002\000)\0002\0002\000"
+ "3\000)\0003\000(\0003\0003\0004\000(\0004\000'\0004\0004\0005\000'\0005\000"
+ "5\0006\000'\0006\0007\0008\0008\0009\0007\0009\0009\000:\0007\000:\0009\000"
+ ";\000:\000;\000;\000<\000:\000<\000;\000=\000<\000=\000=\000>\000<\000>\000"
+ "1\000=\0001\000>\0000\000>\000/\000\077\0000\000\077\000>\000\077\000\077"
+ "\000@\000>\000@\000@\000A\000>\000A\000@\000B\000A\000B\000$\000B\000$\000"
+ "A\000+\000B\000$\000+\000C\000D\000D\000E\000C\000E\000E\000F\000C\000F\000"
+ "E\000G\000F\000G\000G\000H\000F\000H\000G\000I\000H\000I\000I\000J\000H\000"
+ "J\000I\000K\000J\000K\000K\000L\000J\000L\000K\000M\000L\000M\000M\000N\000"
+ "L\000N\000M\000O\000N\000O\000O\000P\000N\000P\000O\000Q\000P\000Q\000Q\000"
+ "R\000P\000R\000Q\000S\000R\000S\000S\000T\000R\000T\000S\000U\000T\000U\000"
+ "U\000V\000T\000V\000U\000W\000V\000W\000U\000X\000W\000X\000X\000Y\000W\000"
+ "Y\000S\000X\000S\000Z\000X\000Z\000Q\000[\000O\000[\000O\000\134\000[\000"
+ "\134\000M\000\134\000M\000]\000\134\000]\000K\000]\000K\000^\000]\000^\000"
+ "I\000^\000I\000_\000^\000_\000G\000_\000G\000`\000_\000`\000E\000`\000E\000"
+ "a\000`\000a\000D\000a\000D\000b\000a\000b\0007\000D\0007\000b\000:\000b\000"
+ "Q\000Z\000Z\000[\000V\000c\000T\000c\000c\000d\000T\000d\000R\000d\000d\000"
+ "e\000R\000e\000P\000e\000e\000f\000P\000f\000N\000f\000f\000g\000N\000g\000"
+ "L\000g\000g\000h\000L\000h\000J\000h\000H\000h\000i\000j\000j\000k\000i\000"
+ "k\000c\000i\000d\000i\000d\000k\000e\000k\000k\000l\000e\000l\000f\000l\000"
+ "l\000m\000f\000m\000g\000m\000h\000m\000l\000n\000m\000n\000Y\000o\000W\000"
+ "o\000o\000p\000W\000p\000o\000q\000p\000q\000q\000r\000p\000r\000k\000n\000"
+ "j\000n\000+\000s\000s\000t\000+\000t\000,\000t\000t\000u\000,\000u\000-\000"
+ "u\000u\000v\000-\000v\000.\000v\000v\000w\000.\000w\000/\000w\000w\000x\000"
+ "/\000x\000\077\000x\000x\000y\000\077\000y\000@\000y\000y\000z\000@\000z"
+ "\000B\000z\000s\000z\000B\000s\0001\000{\000{\000|\0001\000|\0002\000|\000"
+ "|\000}\0002\000}\0003\000}\000}\000~\0003\000~\0004\000~\000~\000\177\000"
+ "4\000\177\0005\000\177\000\177\000\200\0005\000\200\0008\000\200\0005\000"
+ "8\000\200\000\201\0008\000\201\0009\000\201\000\201\000\202\0009\000\202"
+ "\000;\000\202\000\202\000\203\000;\000\203\000=\000\203\000{\000\203\000"
+ "=\000{\000y\000\204\000\204\000\205\000y\000\205\000z\000\205\000x\000\206"
+ "\000\204\000\206\000x\000\204\000w\000\207\000\206\000\207\000w\000\206\000"
+ "v\000\210\000\207\000\210\000v\000\207\000u\000\211\000\210\000\211\000u"
+ "\000\210\000t\000\212\000\211\000\212\000t\000\211\000s\000\213\000\212\000"
+ "\213\000s\000\212\000\205\000\213\000z\000\213\000\203\000\214\000\214\000"
+ "\215\000\203\000\215\000{\000\215\000\202\000\216\000\214\000\216\000\202"
+ "\000\214\000\201\000\217\000\216\000\217\000\201\000\216\000\200\000\220"
+ "\000\217\000\220\000\200\000\217\000\177\000\221\000\220\000\221\000\177"
+ "\000\220\000~\000\222\000\221\000\222\000~\000\221\000}\000\223\000\222\000"
+ "\223\000}\000\222\000|\000\224\000\223\000\224\000|\000\223\000\215\000\224"
+ "\000{\000\224\000\213\000\225\000\212\000\225\000\211\000\225\000\210\000"
+ "\225\000\207\000\225\000\206\000\225\000\204\000\225\000\205\000\225\000"
+ "\215\000\226\000\224\000\226\000\223\000\226\000\222\000\226\000\221\000"
+ "\226\000\220\000\226\000\217\000\226\000\216\000\226\000\214\000\226\000"
+ "C\000\227\0007\000\227\0007\000C\0008\000\227\0006\000\227\0005\000\227\000"
+ "\230\000\231\000\231\000\232\000\230\000\232\000\232\000\233\000\231\000"
+ "\233\000\232\000\234\000\233\000\234\000\230\000\235\000\230\000\236\000"
+ "\235\000\236\000\231\000\237\000\230\000\237\000\235\000\237\000\233\000"
+ "\240\000\231\000\240\000\237\000\240\000\234\000\241\000\233\000\241\000"
+ "\240\000\241\000\234\000\242\000\241\000\242\000\234\000\243\000\242\000"
+ "\243\000\235\000\244\000\236\000\244\000\236\000\245\000\244\000\245\000"
+ "\237\000\246\000\235\000\246\000\244\000\246\000\240\000\247\000\237\000"
+ "\247\000\246\000\247\000\250\000\251\000\240\000\251\000\240\000\250\000"
+ "\247\000\250\000\241\000\251\000\242\000\252\000\241\000\252\000\251\000"
+ "\252\000\243\000\253\000\242\000\253\000\252\000\253\000\243\000\254\000"
+ "\253\000\254\000\253\000\255\000\254\000\255\000\252\000\255\000\250\000"
+ "\255\000\251\000\255\000\256\000\257\000\243\000\257\000\243\000\256\000"
+ "\254\000\256\000\260\000\261\000\257\000\261\000\257\000\260\000\256\000"
+ "\260\000\261\000\262\000\260\000\262\000\256\000\263\000\263\000\264\000"
+ "\256\000\264\000\254\000\263\000\263\000\265\000\254\000\265\000\263\000"
+ "\266\000\265\000\266\000\264\000\267\000\263\000\267\000\266\000\267\000"
+ "\266\000\270\000\265\000\270\000\267\000\271\000\266\000\271\000\270\000"
+ "\271\000#\000\270\000\042\000\270\000\042\000\271\000$\000\272\000#\000\272"
+ "\000\270\000\272\000\265\000\273\000\270\000\273\000\272\000\273\000\250"
+ "\000\273\000\250\000\265\000\255\000\265\000\244\000\274\000\245\000\274"
+ "\000\245\000\275\000\274\000\275\000\246\000\276\000\244\000\276\000\274"
+ "\000\276\000\247\000\277\000\246\000\277\000\276\000\277\000\247\000\273"
+ "\000\273\000\277\000\300\000\301\000\272\000\301\000\272\000\300\000\273"
+ "\000\300\000\277\000\302\000\273\000\302\000\300\000\302\000\276\000\303"
+ "\000\302\000\303\000\276\000\302\000\304\000\305\000\303\000\305\000\303"
+ "\000\304\000\276\000\304\000\276\000\306\000\306\000\307\000\276\000\307"
+ "\000\304\000\307\000\274\000\310\000\306\000\310\000\274\000\306\000\275"
+ "\000\311\000\310\000\311\000\275\000\310\000\312\000\313\000\311\000\313"
+ "\000\311\000\312\000\275\000\312\000:\000\314\000\314\000\315\000:\000\315"
+ "\000\315\000\316\000:\000\316\000<\000\317\000\314\000\317\000<\000\314\000"
+ ">\000\320\000\317\000\320\000>\000\317\000\307\000\320\000\304\000\320\000"
+ ">\000\304\000>\000\321\000\305\000\321\000>\000\305\000A\000\322\000\321"
+ "\000\322\000A\000\321\000$\000\323\000\322\000\323\000$\000\322\000\301\000"
+ "\323\000\272\000\323\000\324\000\325\000\325\000\326\000\324\000\326\000"
+ "\326\000\327\000\324\000\327\000\330\000\331\000\325\000\331\000\325\000"
+ "\330\000\324\000\330\000\332\000\333\000\331\000\333\000\331\000\332\000"
+ "\330\000\332\000\334\000\335\000\333\000\335\000\333\000\334\000\332\000"
+ "\334\000\336\000\337\000\335\000\337\000\335\000\336\000\334\000\336\000"
+ "\340\000\341\000\337\000\341\000\337\000\340\000\336\000\340\000\342\000"
+ "\343\000\341\000\343\000\341\000\342\000\340\000\342\000\344\000\345\000"
+ "\343\000\345\000\343\000\344\000\342\000\344\000\346\000\347\000\345\000"
+ "\347\000\345\000\346\000\344\000\346\000\347\000\350\000\346\000\350\000"
+ "X\000\347\000Y\000\347\000Y\000\350\000Z\000\345\000Z\000\347\000\134\000"
+ "\341\000\134\000\343\000[\000\343\000]\000\337\000]\000\341\000^\000\335"
+ "\000^\000\337\000_\000\333\000_\000\335\000`\000\331\000`\000\333\000a\000"
+ "\325\000a\000\331\000b\000\326\000b\000\325\000\316\000\326\000:\000\326"
+ "\000[\000\345\000\344\000\351\000\346\000\351\000\342\000\352\000\351\000"
+ "\352\000\342\000\351\000\340\000\353\000\352\000\353\000\340\000\352\000"
+ "\336\000\354\000\353\000\354\000\336\000\353\000\334\000\355\000\354\000"
+ "\355\000\334\000\354\000\332\000\356\000\355\000\356\000\332\000\355\000"
+ "\330\000\356\000\357\000\360\000\360\000\361\000\357\000\361\000\352\000"
+ "\361\000\351\000\361\000\353\000\357\000\353\000\361\000\354\000\362\000"
+ "\357\000\362\000\354\000\357\000\355\000\363\000\362\000\363\000\355\000"
+ "\362\000\356\000\363\000\362\000\364\000\363\000\364\000o\000\365\000Y\000"
+ "\365\000\350\000\365\000q\000\366\000o\000\366\000\365\000\366\000\360\000"
+ "\362\000\360\000\364\000\300\000\367\000\367\000\370\000\300\000\370\000"
+ "\301\000\370\000\302\000\371\000\367\000\371\000\302\000\367\000\303\000"
+ "\372\000\371\000\372\000\303\000\371\000\305\000\373\000\372\000\373\000"
+ "\305\000\372\000\321\000\374\000\373\000\374\000\321\000\373\000\322\000"
+ "\375\000\374\000\375\000\322\000\374\000\323\000\376\000\375\000\376\000"
+ "\323\000\375\000\370\000\376\000\301\000\376\000\306\000\377\000\377\000"
+ "\000\001\306\000\000\001\307\000\000\001\310\000\001\001\377\000\001\001"
+ "\310\000\377\000\311\000\002\001\001\001\002\001\311\000\001\001\313\000"
+ "\003\001\002\001\003\001\313\000\002\001\315\000\004\001\003\001\004\001"
+ "\315\000\003\001\313\000\315\000\314\000\005\001\004\001\005\001\314\000"
+ "\004\001\317\000\006\001\005\001\006\001\317\000\005\001\320\000\007\001"
+ "\006\001\007\001\320\000\006\001\000\001\007\001\307\000\007\001\376\000"
+ "\010\001\010\001\011\001\376\000\011\001\375\000\011\001\011\001\012\001"
+ "\375\000\012\001\374\000\012\001\012\001\013\001\374\000\013\001\373\000"
+ "\013\001\013\001\014\001\373\000\014\001\372\000\014\001\014\001\015\001"
+ "\372\000\015\001\371\000\015\001\015\001\016\001\371\000\016\001\367\000"
+ "\016\001\016\001\017\001\367\000\017\001\370\000\017\001\010\001\017\001"
+ "\370\000\010\001\000\001\020\001\020\001\021\001\000\001\021\001\007\001"
+ "\021\001\021\001\022\001\007\001\022\001\006\001\022\001\022\001\023\001"
+ "\006\001\023\001\005\001\023\001\023\001\024\001\005\001\024\001\004\001"
+ "\024\001\024\001\025\001\004\001\025\001\003\001\025\001\025\001\026\001"
+ "\003\001\026\001\002\001\026\001\026\001\027\001\002\001\027\001\001\001"
+ "\027\001\027\001\030\001\001\001\030\001\377\000\030\001\020\001\030\001"
+ "\377\000\020\001\017\001\031\001\016\001\031\001\015\001\031\001\014\001"
+ "\031\001\013\001\031\001\012\001\031\001\011\001\031\001\010\001\031\001"
+ "\020\001\032\001\030\001\032\001\027\001\032\001\026\001\032\001\025\001"
+ "\032\001\024\001\032\001\023\001\032\001\022\001\032\001\021\001\032\001"
+ "\316\000\033\001\326\000\033\001\327\000\033\001\315\000\033\001\312\000"
+ "\315\000\312\000\033\001\034\001\035\001\035\001\036\001\034\001\036\001"
+;
+const unsigned long cow_udder_size = 9144;
@@ -10,7 +10,8 @@
 # implied warranty.
 #
 # Reads a DXF file, and emits C data suitable for use with OpenGL's
-# glInterleavedArrays() and glDrawArrays() routines.
+# glInterleavedArrays() and glDrawArrays() routines; or a compact binary
+# mesh container that gllist.c can use in place.
 #
 # Options:
 #
@@ -28,6 +29,16 @@
 #                     input file, instead of emitting the whole file as a
 #                     single unit.
 #
+#    --binary         Instead of float arrays, write a binary mesh container:
+#                     indexed vertexes with 16-bit quantized positions and
+#                     octahedron-encoded normals.  See gllist.h for the
+#                     layout.  It is written as a C string, for
+#                     gllist_read_mesh().
+#
+#                     With --binary, the input may also be a C file of
+#                     float arrays as written without it, for models
+#                     whose DXF source is lost.  Its own normals are kept.
+#
 # Created:  8-Mar-2003.
 
 require 5;
@@ -457,23 +468,43 @@ sub parse_dxf($$$$$) {
 }
 
 
-sub generate_c_1($$$$$@) {
-  my ($name, $outfile, $smooth, $wireframe_p, $normalize_p, @points) = @_;
+# Returns a normal for each point of each triangle: either the averaged
+# vertex normals, if smoothing, or the face normal repeated three times.
+#
+sub point_normals($@) {
+  my ($smooth, @points) = @_;
 
   my $ccw_p = 1;  # counter-clockwise winding rule for computing normals
 
-  my $npoints = ($#points + 1) / 3;
-  my $nfaces = ($wireframe_p ? $npoints/2 : $npoints/3);
-
-  my @normals;
-  if ($smooth && !$wireframe_p) {
-    @normals = compute_vertex_normals ($smooth, @points);
-
+  if ($smooth) {
+    my @normals = compute_vertex_normals ($smooth, @points);
     if ($#normals != $#points) {
       error ("computed " . (($#normals+1)/3) . " normals for " .
              (($#points+1)/3) . " points?");
     }
+    return @normals;
+  }
+
+  my @normals;
+  my $nfaces = ($#points + 1) / 9;
+  for (my $i = 0; $i < $nfaces; $i++) {
+    my ($ax, $ay, $az,
+        $bx, $by, $bz,
+        $cx, $cy, $cz) = @points[$i*9 .. $i*9+8];
+    my @n = ($ccw_p
+             ? face_normal ($ax, $ay, $az, $bx, $by, $bz, $cx, $cy, $cz)
+             : face_normal ($ax, $ay, $az, $cx, $cy, $cz, $bx, $by, $bz));
+    push @normals, @n, @n, @n;
   }
+  return @normals;
+}
+
+
+sub generate_c_1($$$$$@) {
+  my ($name, $outfile, $smooth, $wireframe_p, $normalize_p, @points) = @_;
+
+  my $npoints = ($#points + 1) / 3;
+  my $nfaces = ($wireframe_p ? $npoints/2 : $npoints/3);
 
   my $code .= "\nstatic const float ${name}_data[] = {\n";
 
@@ -500,49 +531,14 @@ sub generate_c_1($$$$$@) {
     }
 
   } else {
+    my @normals = point_normals ($smooth, @points);
     for (my $i = 0; $i < $nfaces; $i++) {
-      my $ax = $points[$i*9];
-      my $ay = $points[$i*9+1];
-      my $az = $points[$i*9+2];
-
-      my $bx = $points[$i*9+3];
-      my $by = $points[$i*9+4];
-      my $bz = $points[$i*9+5];
-
-      my $cx = $points[$i*9+6];
-      my $cy = $points[$i*9+7];
-      my $cz = $points[$i*9+8];
-
+      my ($ax, $ay, $az,
+          $bx, $by, $bz,
+          $cx, $cy, $cz) = @points[$i*9 .. $i*9+8];
       my ($nax, $nay, $naz,
           $nbx, $nby, $nbz,
-          $ncx, $ncy, $ncz);
-
-      if ($smooth) {
-        $nax = $normals[$i*9];
-        $nay = $normals[$i*9+1];
-        $naz = $normals[$i*9+2];
-
-        $nbx = $normals[$i*9+3];
-        $nby = $normals[$i*9+4];
-        $nbz = $normals[$i*9+5];
-
-        $ncx = $normals[$i*9+6];
-        $ncy = $normals[$i*9+7];
-        $ncz = $normals[$i*9+8];
-
-      } else {
-        if ($ccw_p) {
-          ($nax, $nay, $naz) = face_normal ($ax, $ay, $az,
-                                            $bx, $by, $bz,
-                                            $cx, $cy, $cz);
-        } else {
-          ($nax, $nay, $naz) = face_normal ($ax, $ay, $az,
-                                            $cx, $cy, $cz,
-                                            $bx, $by, $bz);
-        }
-        ($nbx, $nby, $nbz) = ($nax, $nay, $naz);
-        ($ncx, $ncy, $ncz) = ($nax, $nay, $naz);
-      }
+          $ncx, $ncy, $ncz) = @normals[$i*9 .. $i*9+8];
 
       my $lines = sprintf("\t" . "%.6f,%.6f,%.6f," . "%.6f,%.6f,%.6f,\n" .
                           "\t" . "%.6f,%.6f,%.6f," . "%.6f,%.6f,%.6f,\n" .
@@ -574,12 +570,11 @@ sub generate_c_1($$$$$@) {
 }
 
 
-sub generate_c($$$$$$) {
-  my ($infile, $outfile, $smooth, $wireframe_p, $normalize_p, $layers) = @_;
-
-  my $code = '';
-
-  my $token = $outfile;    # guess at a C token from the filename
+# Guess at a C token from the file name.
+#
+sub c_token($) {
+  my ($outfile) = @_;
+  my $token = $outfile;
   $token =~ s/\<[^<>]*\>//;
   $token =~ s@^.*/@@;
   $token =~ s/\.[^.]*$//;
@@ -589,23 +584,43 @@ sub generate_c($$$$$$) {
   $token =~ s/_$//g;
   $token =~ tr [A-Z] [a-z];
   $token = 'foo' if ($token eq '');
+  return $token;
+}
 
-  my @layers = sort (keys %$layers);
 
+sub generated_comment($$$$$@) {
+  my ($infile, $smooth, $wireframe_p, $normalize_p, $binary_p, @layers) = @_;
   $infile =~ s@^.*/@@s;
-  $code .= ("/* Generated from \"$infile\" on " .
-            strftime ("%d-%b-%Y", localtime ()) . ".\n" .
-            "   " . ($wireframe_p
-                     ? "Wireframe."
-                     : ($smooth ? 
-                        "Smoothed vertex normals at $smooth\x{00B0}." :
-                        "Faceted face normals.")) .
-            ($normalize_p ? " Normalized to unit bounding box." : "") .
-            "\n" .
-            (@layers > 1
-             ? wrap ("   ", "     ", "Components: " . join (", ", @layers)) . ".\n"
-             : "") .
-            " */\n\n");
+  return ("/* Generated from \"$infile\" on " .
+          strftime ("%d-%b-%Y", localtime ()) . ".\n" .
+          ($binary_p ? "   Binary mesh container; see gllist.h.\n" : "") .
+          "   " . ($infile =~ m/\.c$/si
+                   ? "Re-packed from its float arrays."
+                   : $wireframe_p
+                   ? "Wireframe."
+                   : ($smooth ?
+                      "Smoothed vertex normals at $smooth\x{00B0}." :
+                      "Faceted face normals.")) .
+          ($normalize_p ? " Normalized to unit bounding box." : "") .
+          "\n" .
+          (@layers > 1
+           ? wrap ("   ", "     ", "Components: " . join (", ", @layers)) . ".\n"
+           : "") .
+          " */\n\n");
+}
+
+
+sub generate_c($$$$$$) {
+  my ($infile, $outfile, $smooth, $wireframe_p, $normalize_p, $layers) = @_;
+
+  my $code = '';
+
+  my $token = c_token ($outfile);
+
+  my @layers = sort (keys %$layers);
+
+  $code .= generated_comment ($infile, $smooth, $wireframe_p, $normalize_p,
+                              0, @layers);
 
   $code .= "#include \"gllist.h\"\n";
 
@@ -630,6 +645,274 @@ sub generate_c($$$$$$) {
 }
 
 
+# Reads the float arrays of a file written by generate_c, or by hand in the
+# same form.  Returns a hash of layer name to primitive, points and normals.
+# A file with a single list has a single layer named "".
+#
+sub parse_gllist_c($$) {
+  my ($filename, $code) = @_;
+
+  $code =~ s@/\*.*?\*/@@gs;
+
+  my %arrays;
+  while ($code =~ m/static\s+const\s+float\s+(\w+)\s*\[\s*\]\s*=\s*
+                    \{([^{}]*)\}/gsx) {
+    my ($name, $body) = ($1, $2);
+    $body =~ s/\s+//gs;
+    $body =~ s/,$//s;
+    $arrays{$name} = [ map { 0 + $_ } split (/,/, $body) ];
+  }
+
+  my %frames;
+  while ($code =~ m/static\s+const\s+struct\s+gllist\s+(\w+)\s*=\s*
+                    \{\s*(GL_\w+)\s*,\s*(GL_\w+)\s*,\s*(\d+)\s*,
+                    \s*(\w+)/gsx) {
+    $frames{$1} = [ $2, $3, $4, $5 ];
+  }
+
+  my %prims = ( GL_POINTS => 0, GL_LINES => 1, GL_TRIANGLES => 4 );
+  my %layers;
+  my @exports = ($code =~ m/\bconst\s+struct\s+gllist\s*\*\s*(\w+)\s*=
+                            \s*&\s*(\w+)\s*;/gsx);
+  my $nlists = @exports / 2;
+  while (@exports) {
+    my $export = shift @exports;
+    my $frame  = shift @exports;
+    my $f = $frames{$frame} || error ("$filename: no gllist \"$frame\"");
+    my ($format, $prim, $count, $array) = @$f;
+    my $a = $arrays{$array} || error ("$filename: no array \"$array\"");
+    my $stride = ($format eq 'GL_N3F_V3F' ? 6 :
+                  $format eq 'GL_V3F'     ? 3 :
+                  error ("$filename: $export: unhandled format $format"));
+    error ("$filename: $export: unhandled primitive $prim")
+      unless defined ($prims{$prim});
+    error ("$filename: $export: $count points, but " .
+           (@$a / $stride) . " in $array")
+      unless ($count * $stride == @$a);
+
+    my (@points, @normals);
+    for (my $i = 0; $i < $count; $i++) {
+      push @normals, @$a[$i*$stride .. $i*$stride+2] if ($stride == 6);
+      push @points,  @$a[$i*$stride+$stride-3 .. $i*$stride+$stride-1];
+    }
+
+    # Layers are named as by --layers: the export minus the file's token.
+    my $token = c_token ($filename);
+    my $layer = $export;
+    $layer = '' if ($nlists == 1);
+    $layer =~ s/^${token}_//s;
+    $layers{$layer} = { prim    => $prims{$prim},
+                        points  => \@points,
+                        normals => ($stride == 6 ? \@normals : undef) };
+  }
+
+  error ("$filename: no gllists") unless (%layers);
+  return \%layers;
+}
+
+
+# Octahedron-encodes a unit vector into two signed bytes.
+#
+sub oct_encode($$$) {
+  my ($x, $y, $z) = @_;
+  my $l = abs($x) + abs($y) + abs($z);
+  $l = 1 if ($l == 0);
+  $x /= $l;
+  $y /= $l;
+  if ($z < 0) {
+    ($x, $y) = ((1 - abs($y)) * ($x >= 0 ? 1 : -1),
+                (1 - abs($x)) * ($y >= 0 ? 1 : -1));
+  }
+  my @e;
+  foreach my $v ($x, $y) {
+    $v = int ($v * 127 + ($v < 0 ? -0.5 : 0.5));
+    $v = 127  if ($v > 127);
+    $v = -127 if ($v < -127);
+    push @e, $v;
+  }
+  return @e;
+}
+
+
+# Packs an array of indexes, 16 bits if possible, padded to 4 bytes.
+#
+sub pack_indexes($@) {
+  my ($wide_p, @idx) = @_;
+  my $b = pack (($wide_p ? 'V*' : 'v*'), @idx);
+  $b .= "\0" x ((4 - (length($b) % 4)) % 4);
+  return $b;
+}
+
+
+# Returns the header record and the data block for one layer.
+# Vertexes that are identical after quantization are shared.
+# The primitive is a GL enum; the normals are computed if not given.
+#
+sub generate_bin_1($$$$$@) {
+  my ($name, $outfile, $smooth, $prim, $normals, @points) = @_;
+
+  my $tri_p = ($prim == 4);   # GL_TRIANGLES
+  my $npoints = ($#points + 1) / 3;
+  my @normals = (!$tri_p ? () :
+                 $normals ? @$normals :
+                 point_normals ($smooth, @points));
+
+  my @min = (9e99, 9e99, 9e99);
+  my @max = (-9e99, -9e99, -9e99);
+  for (my $i = 0; $i < $npoints; $i++) {
+    for (my $j = 0; $j < 3; $j++) {
+      my $v = $points[$i*3+$j];
+      $min[$j] = $v if ($v < $min[$j]);
+      $max[$j] = $v if ($v > $max[$j]);
+    }
+  }
+
+  # A uniform scale, so that normals need no correction beyond
+  # GL_NORMALIZE.
+  my @center;
+  my $extent = 0;
+  for (my $j = 0; $j < 3; $j++) {
+    $center[$j] = ($min[$j] + $max[$j]) / 2;
+    my $e = $max[$j] - $min[$j];
+    $extent = $e if ($e > $extent);
+  }
+  my $scale = ($extent > 0 ? $extent / 65534 : 1);
+
+  my (%verts, %positions, @pos, @oct, @indexes, @edges, %edges);
+  my $nverts = 0;
+  for (my $i = 0; $i < $npoints; $i++) {
+    my @q;
+    for (my $j = 0; $j < 3; $j++) {
+      push @q, int (($points[$i*3+$j] - $center[$j]) / $scale +
+                    ($points[$i*3+$j] < $center[$j] ? -0.5 : 0.5));
+    }
+    my @n = (!$tri_p ? (0, 0) :
+             oct_encode ($normals[$i*3], $normals[$i*3+1], $normals[$i*3+2]));
+    my $pkey = join (',', @q);
+    my $key  = join (',', @q, @n);
+    my $idx  = $verts{$key};
+    if (! defined ($idx)) {
+      $idx = $verts{$key} = $nverts++;
+      push @pos, @q, 0;
+      push @oct, @n;
+    }
+    $positions{$pkey} = $idx unless defined ($positions{$pkey});
+    push @indexes, $idx;
+  }
+
+  # Wireframe edges, keyed on position so that an edge shared by two
+  # faceted triangles is drawn once.
+  if ($tri_p) {
+    for (my $i = 0; $i < $npoints; $i += 3) {
+      for (my $j = 0; $j < 3; $j++) {
+        my @a = @pos[$indexes[$i+$j]*4 .. $indexes[$i+$j]*4+2];
+        my @b = @pos[$indexes[$i+($j+1)%3]*4 .. $indexes[$i+($j+1)%3]*4+2];
+        my $a = $positions{join (',', @a)};
+        my $b = $positions{join (',', @b)};
+        next if ($a == $b);
+        ($a, $b) = ($b, $a) if ($a > $b);
+        next if ($edges{"$a,$b"});
+        $edges{"$a,$b"} = 1;
+        push @edges, $a, $b;
+      }
+    }
+  }
+
+  my $wide_p = ($nverts > 65536);
+  my $data = pack ('s<*', @pos);
+  my $o = pack ('c*', @oct);
+  $o .= "\0" x ((4 - (length($o) % 4)) % 4);
+  $data .= $o;
+  $data .= pack_indexes ($wide_p, @indexes);
+  $data .= pack_indexes ($wide_p, @edges);
+
+  my $nedges = ($#edges + 1) / 2;
+
+  error ("$name: layer name too long") if (length($name) > 27);
+  my $rec = pack ('a28 V V V V V f< f< f< f<',
+                  $name, 0, $prim, $nverts, $npoints, $nedges,
+                  @center, $scale);
+
+  print STDERR "$progname: $outfile: $name: $npoints points, " .
+               "$nverts vertexes, $nedges edges.\n"
+    if ($verbose);
+
+  return ($rec, $data);
+}
+
+
+# The container layout is described in gllist.h.
+#
+sub generate_bin($$$$$$) {
+  my ($infile, $outfile, $smooth, $wireframe_p, $normalize_p, $layers) = @_;
+
+  my @layers = sort (keys %$layers);
+  my @recs;
+  my @datas;
+  foreach my $layer (@layers) {
+    # From parse_gllist_c, each layer has its own primitive and normals.
+    my $l = $layers->{$layer};
+    my ($rec, $data) = (ref ($l) eq 'HASH'
+                        ? generate_bin_1 ($layer || 'all', $outfile, $smooth,
+                                          $l->{prim}, $l->{normals},
+                                          @{$l->{points}})
+                        : generate_bin_1 ($layer || 'all', $outfile, $smooth,
+                                          ($wireframe_p ? 1 : 4), undef,
+                                          @$l));
+    push @recs, $rec;
+    push @datas, $data;
+  }
+
+  my $header = pack ('a8 V V', 'XSGLMSH1', scalar(@layers), 0);
+  my $off = length($header) + 64 * @layers;
+  my $out = $header;
+  for (my $i = 0; $i <= $#recs; $i++) {
+    substr ($recs[$i], 28, 4) = pack ('V', $off);
+    $out .= $recs[$i];
+    $off += length ($datas[$i]);
+  }
+  $out .= join ('', @datas);
+  return $out;
+}
+
+
+# Wraps the binary container in a C string, for linking into the hack.
+#
+sub generate_bin_c($$$$$$) {
+  my ($infile, $outfile, $smooth, $wireframe_p, $normalize_p, $layers) = @_;
+
+  my $bin = generate_bin ($infile, $outfile, $smooth, $wireframe_p,
+                          $normalize_p, $layers);
+  my $token = c_token ($outfile);
+  my @layers = sort (keys %$layers);
+
+  my $code = generated_comment ($infile, $smooth, $wireframe_p, $normalize_p,
+                                1, @layers);
+  $code .= "#include \"gllist.h\"\n\n";
+  $code .= "#ifdef __GNUC__\n__extension__\n#endif\n";
+  $code .= "const unsigned char ${token}[] =\n";
+
+  # Octal escapes are always three digits, so that a following digit
+  # is not taken as part of the escape.
+  my $line = '';
+  foreach my $c (split (//, $bin)) {
+    my $o = ord ($c);
+    $line .= (($o >= 040 && $o < 0177 && $c ne '"' && $c ne '\\' &&
+               $c ne '?')
+              ? $c
+              : sprintf ("\\%03o", $o));
+    if (length ($line) >= 72) {
+      $code .= " \"$line\"\n";
+      $line = '';
+    }
+  }
+  $code .= " \"$line\"\n" if ($line ne '');
+  $code .= ";\n";
+  $code .= "const unsigned long ${token}_size = " . length ($bin) . ";\n";
+  return $code;
+}
+
+
 # Returns true if the two files differ (by running "cmp")
 #
 sub cmp_files($$) {
@@ -650,8 +933,9 @@ sub cmp_files($$) {
 }
 
 
-sub dxf_to_gl($$$$$$) {
-  my ($infile, $outfile, $smooth, $normalize_p, $wireframe_p, $layers_p) = @_;
+sub dxf_to_gl($$$$$$$) {
+  my ($infile, $outfile, $smooth, $normalize_p, $wireframe_p, $layers_p,
+      $binary_p) = @_;
 
   open (my $in, "<$infile") || error ("$infile: $!");
   my $filename = ($infile eq '-' ? "<stdin>" : $infile);
@@ -662,11 +946,20 @@ sub dxf_to_gl($$$$$$) {
   my $dxf = <$in>;
   close $in;
 
-  my $data = parse_dxf ($filename, $dxf, $normalize_p, $wireframe_p, $layers_p);
+  my $data;
+  if ($infile =~ m/\.c$/si) {
+    error ("$filename: C input needs --binary") unless ($binary_p);
+    $data = parse_gllist_c ($filename, $dxf);
+  } else {
+    $data = parse_dxf ($filename, $dxf, $normalize_p, $wireframe_p, $layers_p);
+  }
 
   $filename = ($outfile eq '-' ? "<stdout>" : $outfile);
-  my $code = generate_c ($infile, $filename, $smooth, $wireframe_p,
-                         $normalize_p, $data);
+  my $code = (!$binary_p
+              ? generate_c ($infile, $filename, $smooth, $wireframe_p,
+                            $normalize_p, $data)
+              : generate_bin_c ($infile, $filename, $smooth, $wireframe_p,
+                                $normalize_p, $data));
 
   if ($outfile eq '-') {
     print STDOUT $code;
@@ -698,7 +991,7 @@ sub error() {
 sub usage() {
   print STDERR "usage: $progname " .
         "[--verbose] [--normalize] [--smooth] [--wireframe] [--layers]\n" .
-        "[infile [outfile]]\n";
+        "[--binary] [infile [outfile]]\n";
   exit 1;
 }
 
@@ -708,6 +1001,7 @@ sub main() {
   my $smooth = 0;
   my $wireframe_p = 0;
   my $layers_p = 0;
+  my $binary_p = 0;
   while ($_ = $ARGV[0]) {
     shift @ARGV;
     if ($_ eq "--verbose") { $verbose++; }
@@ -723,6 +1017,7 @@ sub main() {
     }
     elsif ($_ eq "--wireframe") { $wireframe_p = 1; }
     elsif ($_ eq "--layers") { $layers_p = 1; }
+    elsif ($_ eq "--binary") { $binary_p = 1; }
     elsif (m/^-./) { usage; }
     elsif (!defined($infile)) { $infile = $_; }
     elsif (!defined($outfile)) { $outfile = $_; }
@@ -732,7 +1027,8 @@ sub main() {
   $infile  = "-" unless defined ($infile);
   $outfile = "-" unless defined ($outfile);
 
-  dxf_to_gl ($infile, $outfile, $smooth, $normalize_p, $wireframe_p, $layers_p);
+  dxf_to_gl ($infile, $outfile, $smooth, $normalize_p, $wireframe_p, $layers_p,
+             $binary_p);
 }
 
 main;
@@ -20,9 +20,11 @@
                  "*wireframe: False \n" \
                  "*useSHM:    True  \n" \
 		 "*suppressRotationAnimation: True\n" \
+		 THREAD_DEFAULTS_XLOCK
 
 # define release_screenflip 0
 # include "xlockmore.h"                         /* from the xscreensaver distribution */
+# include "thread_util.h"
 # include "gltrackball.h"
 #else  /* !STANDALONE */
 # include "xlock.h"                                     /* from the xlockmore distribution */
@@ -52,6 +54,7 @@ static int rotate;
 static XrmOptionDescRec opts[] = {
   {"+rotate", ".screenflip.rotate", XrmoptionNoArg, "false" },
   {"-rotate", ".screenflip.rotate", XrmoptionNoArg, "true" },
+  THREAD_OPTIONS
 };
 
 
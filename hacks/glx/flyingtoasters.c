@@ -59,13 +59,41 @@
 
 #include "gllist.h"
 
-extern const struct gllist
-  *toaster, *toaster_base, *toaster_handle, *toaster_handle2, *toaster_jet,
-  *toaster_knob, *toaster_slots, *toaster_wing, *toast, *toast2;
+extern const unsigned char
+  toaster[], toaster_base[], toaster_handle[], toaster_handle2[],
+  toaster_jet[], toaster_knob[], toaster_slots[], toaster_wing[],
+  toast[], toast2[];
+extern const unsigned long
+  toaster_size, toaster_base_size, toaster_handle_size, toaster_handle2_size,
+  toaster_jet_size, toaster_knob_size, toaster_slots_size, toaster_wing_size,
+  toast_size, toast2_size;
+
+static const struct {
+  const unsigned char *data;
+  const unsigned long *size;
+} all_models[] = {
+  { toaster,         &toaster_size },
+  { toaster_base,    &toaster_base_size },
+  { toaster_handle,  &toaster_handle_size },
+  { toaster_handle2, &toaster_handle2_size },
+  { toaster_jet,     &toaster_jet_size },
+  { toaster_knob,    &toaster_knob_size },
+  { toaster_slots,   &toaster_slots_size },
+  { toaster_wing,    &toaster_wing_size },
+  { toast,           &toast_size },
+  { toast2,          &toast2_size },
+};
+
+/* Loaded from all_models on first use. */
+static const struct gllist
+  *toaster_list, *toaster_base_list, *toaster_handle_list,
+  *toaster_handle2_list, *toaster_jet_list, *toaster_knob_list,
+  *toaster_slots_list, *toaster_wing_list, *toast_list, *toast2_list;
 
-static const struct gllist * const *all_objs[] = {
-  &toaster, &toaster_base, &toaster_handle, &toaster_handle2, &toaster_jet,
-  &toaster_knob, &toaster_slots, &toaster_wing, &toast, &toast2
+static const struct gllist **all_objs[] = {
+  &toaster_list, &toaster_base_list, &toaster_handle_list,
+  &toaster_handle2_list, &toaster_jet_list, &toaster_knob_list,
+  &toaster_slots_list, &toaster_wing_list, &toast_list, &toast2_list
 };
 
 #define BASE_TOASTER	0
@@ -434,6 +462,18 @@ init_toasters (ModeInfo *mi)
   bp->user_trackball = gltrackball_init (False);
   auto_track_init (mi);
 
+  for (i = 0; i < countof(all_objs); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (all_models[i].data,
+                                         *all_models[i].size, "all");
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model %d\n", progname, i);
+            exit (1);
+          }
+      }
+
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
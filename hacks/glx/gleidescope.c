@@ -76,9 +76,11 @@
 		"*size:			0			\n"	\
 		"*useSHM:		True		\n" \
 		"*suppressRotationAnimation: True\n" \
+		THREAD_DEFAULTS_XLOCK
 
 # define release_gleidescope 0
 # include "xlockmore.h"				/* from the xscreensaver distribution */
+# include "thread_util.h"
 #else  /* !STANDALONE */
 # include "xlock.h"					/* from the xlockmore distribution */
 #endif /* !STANDALONE */
@@ -142,6 +144,7 @@ static XrmOptionDescRec opts[] =
 	{"-no-zoom",	".gleidescope.nozoom",		XrmoptionNoArg,		"true"},
 	{"-image",		".gleidescope.image",		XrmoptionSepArg,	"DEFAULT"},
 	{"-duration",	".gleidescope.duration",	XrmoptionSepArg,	"30"},
+	THREAD_OPTIONS
 };
 
 
@@ -11,11 +11,902 @@
 
 #include "gllist.h"
 
+/* The model data is static and const, so the per-list caches live here
+   rather than in the struct gllist itself.
+
+   The CPU side (de-duplicated vertices, triangle indexes and wireframe
+   edges) is computed once per list and shared by every GL context in the
+   process.  The buffer objects are per-context, since the contexts that
+   init_GL() creates do not share objects.
+
+   jwzgles emulates display lists by recording client-side arrays, so it
+   keeps using the original code path.
+ */
+#if defined(HAVE_GLSL) && !defined(HAVE_JWZGLES) && \
+    !defined(HAVE_COCOA) && !defined(HAVE_ANDROID)
+# define USE_VBO
+#endif
+
+struct gllist_packed {
+  int nverts, nindices, nedges;
+  GLenum index_type;		/* GL_UNSIGNED_SHORT or GL_UNSIGNED_INT */
+  const GLshort *positions;	/* x, y, z, pad; quantized */
+  const GLbyte *normals;	/* x, y, z, pad; decoded at load time */
+  const void *indices;
+  const void *edges;
+  GLfloat center[3], scale;
+  GLfloat *floats;		/* GL_N3F_V3F, from gllist_floats() */
+};
+
+
+#ifndef HAVE_JWZGLES
+
+#define GLLIST_BUCKETS 64
+#define GLLIST_HASH(P) ((((unsigned long) (P)) >> 4) % GLLIST_BUCKETS)
+
+typedef struct gllist_mesh gllist_mesh;
+struct gllist_mesh {
+  const struct gllist *list;
+  int stride;			/* in floats */
+  int voff;			/* offset of the vertex in a tuple, in floats */
+  const GLfloat *verts;		/* either list->data or de-duplicated */
+  int nverts;
+  GLuint *indices;		/* null if verts is list->data */
+  int nindices;
+  GLuint *edges;		/* pairs of indexes into verts, for GL_LINES */
+  int nedges;
+  Bool owns_verts;
+  gllist_mesh *next;
+};
+
+static gllist_mesh *meshes[GLLIST_BUCKETS];
+
+static GLfloat *unpack_floats (const struct gllist_packed *);
+
+
+/* Returns the number of floats per vertex tuple, and the offset of the
+   position within it; or 0 if we don't know how to index this format.
+ */
+static int
+format_layout (GLenum format, int *voff)
+{
+  switch (format) {
+  case GL_V3F:         *voff = 0; return 3;
+  case GL_C3F_V3F:     *voff = 3; return 6;
+  case GL_N3F_V3F:     *voff = 3; return 6;
+  case GL_T2F_V3F:     *voff = 2; return 5;
+  case GL_T2F_N3F_V3F: *voff = 5; return 8;
+  default:             *voff = 0; return 0;
+  }
+}
+
+
+static unsigned long
+hash_floats (const GLfloat *f, int n)
+{
+  const unsigned char *b = (const unsigned char *) f;
+  unsigned long h = 2166136261UL;
+  int i;
+  for (i = 0; i < n * (int) sizeof(*f); i++)
+    h = (h ^ b[i]) * 16777619UL;
+  return h;
+}
+
+
+/* Open-addressed table mapping a run of floats to the first index at
+   which it was seen.  Returns that index, inserting 'idx' if new.
+ */
+static int
+intern_floats (int *table, unsigned long mask,
+               const GLfloat *base, int stride, int off, int len, int idx)
+{
+  const GLfloat *f = base + idx * stride + off;
+  unsigned long h = hash_floats (f, len) & mask;
+  while (table[h] >= 0)
+    {
+      const GLfloat *g = base + table[h] * stride + off;
+      if (!memcmp (f, g, len * sizeof(*f)))
+        return table[h];
+      h = (h + 1) & mask;
+    }
+  table[h] = idx;
+  return idx;
+}
+
+
+/* Set of undirected edges, stored as pairs with the lower index first.
+   Returns true if the edge was not already present.
+ */
+static Bool
+intern_edge (GLuint *table, unsigned long mask, GLuint a, GLuint b)
+{
+  unsigned long h;
+  if (a == b) return False;
+  if (a > b) { GLuint t = a; a = b; b = t; }
+  h = (a * 2654435761UL ^ b * 40503UL) & mask;
+  while (table[h*2] != ~0U)
+    {
+      if (table[h*2] == a && table[h*2+1] == b) return False;
+      h = (h + 1) & mask;
+    }
+  table[h*2]   = a;
+  table[h*2+1] = b;
+  return True;
+}
+
+
+static gllist_mesh *
+make_mesh (const struct gllist *list)
+{
+  gllist_mesh *m;
+  const GLfloat *data = (const GLfloat *) list->data;
+  int n = list->points;
+  int tick, i, j;
+  unsigned long size, mask;
+  int *table, *remap, *pos;
+  GLuint *etable;
+
+  m = (gllist_mesh *) calloc (1, sizeof(*m));
+  if (!m) return 0;
+  m->list = list;
+  m->stride = format_layout (list->format, &m->voff);
+  if (!m->stride || n <= 0)
+    return m;   /* Unsupported: callers fall back to the slow path. */
+
+  switch (list->primitive) {
+  case GL_QUADS:     tick = 4; break;
+  case GL_TRIANGLES: tick = 3; break;
+  default:           tick = 0; break;
+  }
+
+  for (size = 16; size < (unsigned long) n * 2; size <<= 1)
+    ;
+  mask = size - 1;
+  table = (int *) malloc (size * sizeof(*table));
+  remap = (int *) malloc (n * sizeof(*remap));
+  if (!table || !remap) abort();
+
+  /* Collapse identical vertex tuples. */
+  memset (table, -1, size * sizeof(*table));
+  m->nverts = 0;
+  for (i = 0; i < n; i++)
+    {
+      j = intern_floats (table, mask, data, m->stride, 0, m->stride, i);
+      remap[i] = (j == i ? m->nverts++ : remap[j]);
+    }
+
+  if (m->nverts < n * 3 / 4)
+    {
+      GLfloat *v = (GLfloat *) malloc (m->nverts * m->stride * sizeof(*v));
+      m->indices = (GLuint *) malloc (n * sizeof(*m->indices));
+      if (!v || !m->indices) abort();
+      for (i = 0; i < n; i++)
+        {
+          memcpy (v + remap[i] * m->stride, data + i * m->stride,
+                  m->stride * sizeof(*v));
+          m->indices[i] = remap[i];
+        }
+      m->verts = v;
+      m->nindices = n;
+      m->owns_verts = True;
+    }
+  else
+    {
+      /* Not worth an index buffer; draw the original array. */
+      m->verts = data;
+      m->nverts = n;
+      for (i = 0; i < n; i++)
+        remap[i] = i;
+    }
+
+  /* Wireframe edges.  Faceted models repeat each position with a different
+     normal per face, so edges are keyed on position alone, so that an edge
+     shared by two faces is drawn once.
+   */
+  if (tick)
+    {
+      pos = (int *) malloc (m->nverts * sizeof(*pos));
+      etable = (GLuint *) malloc (size * 2 * sizeof(*etable));
+      m->edges = (GLuint *) malloc (n * 2 * sizeof(*m->edges));
+      if (!pos || !etable || !m->edges) abort();
+
+      memset (table, -1, size * sizeof(*table));
+      for (i = 0; i < m->nverts; i++)
+        pos[i] = intern_floats (table, mask, m->verts, m->stride,
+                                m->voff, 3, i);
+
+      memset (etable, 0xFF, size * 2 * sizeof(*etable));
+      for (i = 0; i + tick <= n; i += tick)
+        for (j = 0; j < tick; j++)
+          {
+            GLuint a = pos[remap[i + j]];
+            GLuint b = pos[remap[i + (j + 1) % tick]];
+            if (intern_edge (etable, mask, a, b))
+              {
+                m->edges[m->nedges * 2]     = a;
+                m->edges[m->nedges * 2 + 1] = b;
+                m->nedges++;
+              }
+          }
+      free (pos);
+      free (etable);
+    }
+
+  free (table);
+  free (remap);
+  return m;
+}
+
+
+static void
+free_mesh (gllist_mesh *m)
+{
+  if (m->owns_verts) free ((GLfloat *) m->verts);
+  if (m->indices) free (m->indices);
+  if (m->edges) free (m->edges);
+  free (m);
+}
+
+
+static gllist_mesh *
+find_mesh (const struct gllist *list)
+{
+  gllist_mesh **b = &meshes[GLLIST_HASH (list)];
+  gllist_mesh *m;
+  for (m = *b; m; m = m->next)
+    if (m->list == list)
+      return m;
+  m = make_mesh (list);
+  if (!m) return 0;
+  m->next = *b;
+  *b = m;
+  return m;
+}
+
+
+#ifdef USE_VBO
+
+typedef struct gllist_vbo gllist_vbo;
+struct gllist_vbo {
+  const struct gllist *list;
+  const void *ctx;
+  GLuint vertex_buffer, index_buffer, edge_buffer;
+  gllist_vbo *next;
+};
+
+static gllist_vbo *vbos[GLLIST_BUCKETS];
+
+typedef struct gllist_ctx gllist_ctx;
+struct gllist_ctx {
+  const void *ctx;
+  Bool vbo_p;
+  gllist_ctx *next;
+};
+
+static gllist_ctx *contexts;
+
+
+static const void *
+current_context (void)
+{
+# if defined(HAVE_EGL) || defined(HAVE_WAYLAND)
+  return (const void *) eglGetCurrentContext();
+# else
+  return (const void *) glXGetCurrentContext();
+# endif
+}
+
+
+/* Buffer objects are core as of OpenGL 1.5. */
+static Bool
+vbo_supported_p (const void *ctx)
+{
+  gllist_ctx *c;
+  const char *s;
+  int maj = 0, min = 0;
+
+  for (c = contexts; c; c = c->next)
+    if (c->ctx == ctx)
+      return c->vbo_p;
+
+  c = (gllist_ctx *) calloc (1, sizeof(*c));
+  if (!c) return False;
+  c->ctx = ctx;
+  s = (const char *) glGetString (GL_VERSION);
+  if (s && !strncmp (s, "OpenGL ES", 9))
+    c->vbo_p = True;
+  else if (s && 2 == sscanf (s, "%d.%d", &maj, &min))
+    c->vbo_p = (maj > 1 || (maj == 1 && min >= 5));
+  c->next = contexts;
+  contexts = c;
+  return c->vbo_p;
+}
+
+
+/* Returns the buffers for this list in the current context, creating them
+   from the given arrays the first time.  The vertex buffer holds 'v1'
+   followed by 'v2'.  Null arrays get no buffer.
+ */
+static gllist_vbo *
+find_vbo (const struct gllist *list,
+          const void *v1, unsigned long v1size,
+          const void *v2, unsigned long v2size,
+          const void *idx, unsigned long isize,
+          const void *edges, unsigned long esize)
+{
+  gllist_vbo **b = &vbos[GLLIST_HASH (list)];
+  gllist_vbo *v;
+  const void *ctx = current_context();
+  GLuint bufs[3];
+
+  for (v = *b; v; v = v->next)
+    if (v->list == list && v->ctx == ctx)
+      return v;
+
+  if (!ctx || !vbo_supported_p (ctx))
+    return 0;
+
+  v = (gllist_vbo *) calloc (1, sizeof(*v));
+  if (!v) return 0;
+  v->list = list;
+  v->ctx  = ctx;
+
+  glGenBuffers (3, bufs);
+  v->vertex_buffer = bufs[0];
+  glBindBuffer (GL_ARRAY_BUFFER, v->vertex_buffer);
+  glBufferData (GL_ARRAY_BUFFER, v1size + v2size, 0, GL_STATIC_DRAW);
+  glBufferSubData (GL_ARRAY_BUFFER, 0, v1size, v1);
+  if (v2)
+    glBufferSubData (GL_ARRAY_BUFFER, v1size, v2size, v2);
+  glBindBuffer (GL_ARRAY_BUFFER, 0);
+
+  if (idx)
+    {
+      v->index_buffer = bufs[1];
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, v->index_buffer);
+      glBufferData (GL_ELEMENT_ARRAY_BUFFER, isize, idx, GL_STATIC_DRAW);
+    }
+  else
+    glDeleteBuffers (1, &bufs[1]);
+
+  if (edges)
+    {
+      v->edge_buffer = bufs[2];
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, v->edge_buffer);
+      glBufferData (GL_ELEMENT_ARRAY_BUFFER, esize, edges, GL_STATIC_DRAW);
+    }
+  else
+    glDeleteBuffers (1, &bufs[2]);
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+
+  v->next = *b;
+  *b = v;
+  return v;
+}
+
+#endif /* USE_VBO */
+
+
+/* Returns true if it drew the list. */
+static Bool
+render_mesh (const struct gllist *list, int wire_p)
+{
+  gllist_mesh *m;
+  Bool line_p = (list->primitive == GL_LINES || list->primitive == GL_POINTS);
+  GLint compiling = 0;
+
+  /* Inside glNewList, the data is copied into the display list anyway,
+     so a buffer object would buy nothing.  Callers also build throwaway
+     lists that way (e.g., bouncingcow's morphing cow) whose addresses get
+     re-used, so nothing is cached for them: only the wireframe edges are
+     worth computing. */
+  glGetIntegerv (GL_LIST_INDEX, &compiling);
+  if (compiling)
+    {
+      Bool ok;
+      if (!wire_p || line_p) return False;
+      m = make_mesh (list);
+      if (!m) return False;
+      ok = (m->stride && m->edges);
+      if (ok)
+        {
+          glInterleavedArrays (GL_V3F, m->stride * sizeof(GLfloat),
+                               m->verts + m->voff);
+          glDrawElements (GL_LINES, m->nedges * 2, GL_UNSIGNED_INT,
+                          m->edges);
+        }
+      free_mesh (m);
+      return ok;
+    }
+
+  m = find_mesh (list);
+  if (!m || !m->stride) return False;
+  if (wire_p && !line_p && !m->edges) return False;
+
+# ifdef USE_VBO
+  {
+    gllist_vbo *v =
+      find_vbo (list,
+                m->verts, m->nverts * m->stride * sizeof(GLfloat), 0, 0,
+                m->indices, m->nindices * sizeof(*m->indices),
+                m->edges, m->nedges * 2 * sizeof(*m->edges));
+    if (v)
+      {
+        glBindBuffer (GL_ARRAY_BUFFER, v->vertex_buffer);
+        if (wire_p && !line_p)
+          {
+            glInterleavedArrays (GL_V3F, m->stride * sizeof(GLfloat),
+                                 (const GLfloat *) 0 + m->voff);
+            glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, v->edge_buffer);
+            glDrawElements (GL_LINES, m->nedges * 2, GL_UNSIGNED_INT, 0);
+          }
+        else if (v->index_buffer)
+          {
+            glInterleavedArrays (list->format, 0, 0);
+            glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, v->index_buffer);
+            glDrawElements (list->primitive, m->nindices,
+                            GL_UNSIGNED_INT, 0);
+          }
+        else
+          {
+            glInterleavedArrays (list->format, 0, 0);
+            glDrawArrays (list->primitive, 0, m->nverts);
+          }
+        glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+        glBindBuffer (GL_ARRAY_BUFFER, 0);
+        return True;
+      }
+  }
+# endif /* USE_VBO */
+
+  if (wire_p && !line_p)
+    {
+      /* Only the positions, so that the current color applies, as with
+         the old glBegin (GL_LINE_LOOP) code. */
+      glInterleavedArrays (GL_V3F, m->stride * sizeof(GLfloat),
+                           m->verts + m->voff);
+      glDrawElements (GL_LINES, m->nedges * 2, GL_UNSIGNED_INT, m->edges);
+      return True;
+    }
+
+  return False;
+}
+
+
+/* Object-linear texture coordinates are computed from the vertexes as
+   given, i.e., from the quantized positions before the scale and
+   translation: fold those into the planes instead.  The caller has saved
+   GL_TEXTURE_BIT.
+ */
+static void
+rescale_texgen (const struct gllist_packed *pk)
+{
+  static const GLenum coords[]  = { GL_S, GL_T, GL_R, GL_Q };
+  static const GLenum enables[] = { GL_TEXTURE_GEN_S, GL_TEXTURE_GEN_T,
+                                    GL_TEXTURE_GEN_R, GL_TEXTURE_GEN_Q };
+  int i;
+  for (i = 0; i < sizeof(coords)/sizeof(*coords); i++)
+    {
+      GLint mode = 0;
+      GLfloat p[4];
+      if (!glIsEnabled (enables[i])) continue;
+      glGetTexGeniv (coords[i], GL_TEXTURE_GEN_MODE, &mode);
+      if (mode != GL_OBJECT_LINEAR) continue;
+      glGetTexGenfv (coords[i], GL_OBJECT_PLANE, p);
+      p[3] += p[0] * pk->center[0] + p[1] * pk->center[1] +
+              p[2] * pk->center[2];
+      p[0] *= pk->scale;
+      p[1] *= pk->scale;
+      p[2] *= pk->scale;
+      glTexGenfv (coords[i], GL_OBJECT_PLANE, p);
+    }
+}
+
+
+static void
+render_packed (const struct gllist *list, int wire_p)
+{
+  const struct gllist_packed *pk = list->packed;
+  Bool line_p = (list->primitive == GL_LINES || list->primitive == GL_POINTS);
+  const char *pos = (const char *) pk->positions;
+  const char *nrm = (const char *) pk->normals;
+  const void *idx = pk->indices;
+  const void *edges = pk->edges;
+  Bool bound_p = False;
+  GLint compiling = 0;
+
+  /* Inside glNewList, draw the decoded floats: the data is copied into the
+     display list anyway, and texture generation compiled into the same
+     list must see the model's own coordinates, not the quantized ones. */
+  glGetIntegerv (GL_LIST_INDEX, &compiling);
+  if (compiling)
+    {
+      GLfloat *f = (pk->floats ? pk->floats : unpack_floats (pk));
+      if (wire_p && !line_p)
+        {
+          /* The edges index the packed vertexes, so expand them here. */
+          GLfloat *e = (GLfloat *) malloc (pk->nedges * 2 * 3 * sizeof(*e));
+          int j, m;
+          if (!e) abort();
+          for (j = 0; j < pk->nedges * 2; j++)
+            {
+              int k = (pk->index_type == GL_UNSIGNED_INT
+                       ? ((const GLuint *) pk->edges)[j]
+                       : ((const GLushort *) pk->edges)[j]);
+              if (k >= pk->nverts) k = 0;
+              for (m = 0; m < 3; m++)
+                e[j*3+m] = pk->center[m] + pk->scale * pk->positions[k*4+m];
+            }
+          glInterleavedArrays (GL_V3F, 0, e);
+          glDrawArrays (GL_LINES, 0, pk->nedges * 2);
+          free (e);
+        }
+      else
+        {
+          glInterleavedArrays (GL_N3F_V3F, 0, f);
+          glDrawArrays (list->primitive, 0, pk->nindices);
+        }
+      if (f != pk->floats) free (f);
+      return;
+    }
+
+# ifdef USE_VBO
+    {
+      unsigned long isize = (pk->index_type == GL_UNSIGNED_INT
+                             ? sizeof(GLuint) : sizeof(GLushort));
+      unsigned long psize = pk->nverts * 4 * sizeof(GLshort);
+      gllist_vbo *v =
+        find_vbo (list,
+                  pk->positions, psize,
+                  pk->normals, pk->nverts * 4 * sizeof(GLbyte),
+                  pk->indices, pk->nindices * isize,
+                  (pk->nedges ? pk->edges : 0), pk->nedges * 2 * isize);
+      if (v)
+        {
+          glBindBuffer (GL_ARRAY_BUFFER, v->vertex_buffer);
+          pos = 0;
+          nrm = (const char *) 0 + psize;
+          idx = 0;
+          edges = 0;
+          glBindBuffer (GL_ELEMENT_ARRAY_BUFFER,
+                        (wire_p && !line_p
+                         ? v->edge_buffer
+                         : v->index_buffer));
+          bound_p = True;
+        }
+    }
+# endif /* USE_VBO */
+
+  glPushAttrib (GL_ENABLE_BIT | GL_TEXTURE_BIT);
+  glEnable (GL_NORMALIZE);
+  rescale_texgen (pk);
+  glPushMatrix();
+  glTranslatef (pk->center[0], pk->center[1], pk->center[2]);
+  glScalef (pk->scale, pk->scale, pk->scale);
+
+  glDisableClientState (GL_COLOR_ARRAY);
+  glDisableClientState (GL_TEXTURE_COORD_ARRAY);
+  glEnableClientState (GL_VERTEX_ARRAY);
+  glVertexPointer (3, GL_SHORT, 4 * sizeof(GLshort), pos);
+
+  if (wire_p && !line_p)
+    {
+      glDisableClientState (GL_NORMAL_ARRAY);
+      glDrawElements (GL_LINES, pk->nedges * 2, pk->index_type, edges);
+    }
+  else
+    {
+      if (line_p)
+        glDisableClientState (GL_NORMAL_ARRAY);
+      else
+        {
+          glEnableClientState (GL_NORMAL_ARRAY);
+          glNormalPointer (GL_BYTE, 4 * sizeof(GLbyte), nrm);
+        }
+      glDrawElements (list->primitive, pk->nindices, pk->index_type, idx);
+    }
+
+  glPopMatrix();
+  glPopAttrib();
+
+# ifdef USE_VBO
+  if (bound_p)
+    {
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+      glBindBuffer (GL_ARRAY_BUFFER, 0);
+    }
+# endif /* USE_VBO */
+}
+
+#endif /* !HAVE_JWZGLES */
+
+
+/* Binary mesh containers; the layout is described in gllist.h.
+ */
+
+typedef struct gllist_layer gllist_layer;
+struct gllist_layer {
+  char name[29];
+  struct gllist *list;
+  gllist_layer *next;
+};
+
+typedef struct gllist_container gllist_container;
+struct gllist_container {
+  const void *data;		/* caller's pointer */
+  const unsigned char *bytes;	/* data, or an aligned copy of it */
+  unsigned long size;
+  gllist_layer *layers;		/* loaded so far */
+  gllist_container *next;
+};
+
+static gllist_container *containers;
+
+
+static unsigned long
+rd32 (const unsigned char *p)
+{
+  return ((unsigned long) p[0]       | ((unsigned long) p[1] << 8) |
+          ((unsigned long) p[2] << 16) | ((unsigned long) p[3] << 24));
+}
+
+static float
+rdf32 (const unsigned char *p)
+{
+  union { GLuint i; float f; } u;
+  u.i = rd32 (p);
+  return u.f;
+}
+
+static Bool
+little_endian_p (void)
+{
+  GLuint i = 1;
+  return *(const unsigned char *) &i == 1;
+}
+
+
+static void
+oct_decode (GLbyte ex, GLbyte ey, GLbyte *out)
+{
+  float x = ex / 127.0, y = ey / 127.0;
+  float z = 1 - fabs (x) - fabs (y);
+  float d;
+  if (z < 0)
+    {
+      float ox = x;
+      x = (1 - fabs (y)) * (x >= 0 ? 1 : -1);
+      y = (1 - fabs (ox)) * (y >= 0 ? 1 : -1);
+    }
+  d = sqrt (x*x + y*y + z*z);
+  if (d == 0) d = 1;
+  out[0] = (GLbyte) floor (x / d * 127 + 0.5);
+  out[1] = (GLbyte) floor (y / d * 127 + 0.5);
+  out[2] = (GLbyte) floor (z / d * 127 + 0.5);
+  out[3] = 0;
+}
+
+
+static void
+swap_bytes (void *data, unsigned long count, int width)
+{
+  unsigned char *p = (unsigned char *) data;
+  unsigned long i;
+  for (i = 0; i < count; i++, p += width)
+    {
+      unsigned char t = p[0];
+      if (width == 2)
+        { p[0] = p[1]; p[1] = t; }
+      else
+        { p[0] = p[3]; p[3] = t; t = p[1]; p[1] = p[2]; p[2] = t; }
+    }
+}
+
+
+static unsigned long
+pad4 (unsigned long n)
+{
+  return (n + 3) & ~3UL;
+}
+
+
+/* Expands the indexed vertexes into one GL_N3F_V3F tuple per point. */
+static GLfloat *
+unpack_floats (const struct gllist_packed *pk)
+{
+  GLfloat *f = (GLfloat *) malloc (pk->nindices * 6 * sizeof(*f));
+  int j;
+  if (!f) abort();
+  for (j = 0; j < pk->nindices; j++)
+    {
+      int k = (pk->index_type == GL_UNSIGNED_INT
+               ? ((const GLuint *) pk->indices)[j]
+               : ((const GLushort *) pk->indices)[j]);
+      int m;
+      if (k >= pk->nverts) k = 0;
+      for (m = 0; m < 3; m++)
+        {
+          f[j*6+m]   = pk->normals[k*4+m] / 127.0;
+          f[j*6+3+m] = pk->center[m] + pk->scale * pk->positions[k*4+m];
+        }
+    }
+  return f;
+}
+
+
+static struct gllist *
+parse_layer (gllist_container *c, const char *layer)
+{
+  const unsigned char *b = c->bytes;
+  unsigned long nlayers, i;
+  struct gllist *list;
+  struct gllist_packed *pk;
+
+  if (c->size < 16 || memcmp (b, "XSGLMSH1", 8))
+    return 0;
+  nlayers = rd32 (b + 8);
+  if (nlayers > (c->size - 16) / 64)
+    return 0;
+
+  for (i = 0; i < nlayers; i++)
+    {
+      const unsigned char *r = b + 16 + i * 64;
+      unsigned long off, nverts, nindices, nedges, isize, psize, osize, end;
+      char name[29];
+
+      memcpy (name, r, 28);
+      name[28] = 0;
+      if (strcmp (name, layer)) continue;
+
+      off      = rd32 (r + 28);
+      nverts   = rd32 (r + 36);
+      nindices = rd32 (r + 40);
+      nedges   = rd32 (r + 44);
+      isize    = (nverts > 65536 ? 4 : 2);
+      psize    = nverts * 4 * sizeof(GLshort);
+      osize    = pad4 (nverts * 2);
+      end      = off + psize + osize +
+                 pad4 (nindices * isize) + pad4 (nedges * 2 * isize);
+      if (off & 3 || nverts > c->size || nindices > c->size ||
+          nedges > c->size || end > c->size || end < off)
+        return 0;
+
+      if (rd32 (r + 32) != GL_TRIANGLES && rd32 (r + 32) != GL_LINES &&
+          rd32 (r + 32) != GL_POINTS)
+        return 0;
+
+      list = (struct gllist *) calloc (1, sizeof(*list));
+      pk = (struct gllist_packed *) calloc (1, sizeof(*pk));
+      if (!list || !pk) abort();
+
+      pk->nverts     = nverts;
+      pk->nindices   = nindices;
+      pk->nedges     = nedges;
+      pk->index_type = (isize == 4 ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT);
+      pk->positions  = (const GLshort *) (b + off);
+      pk->indices    = b + off + psize + osize;
+      pk->edges      = (const unsigned char *) pk->indices +
+                       pad4 (nindices * isize);
+      pk->center[0]  = rdf32 (r + 48);
+      pk->center[1]  = rdf32 (r + 52);
+      pk->center[2]  = rdf32 (r + 56);
+      pk->scale      = rdf32 (r + 60);
+
+      if (! little_endian_p())
+        {
+          /* c->bytes is a private copy in this case. */
+          swap_bytes ((void *) pk->positions, nverts * 4, 2);
+          swap_bytes ((void *) pk->indices, nindices, isize);
+          swap_bytes ((void *) pk->edges, nedges * 2, isize);
+        }
+
+      {
+        const GLbyte *oct = (const GLbyte *) (b + off + psize);
+        GLbyte *n = (GLbyte *) malloc (nverts * 4);
+        unsigned long j;
+        if (!n) abort();
+        for (j = 0; j < nverts; j++)
+          oct_decode (oct[j*2], oct[j*2+1], n + j*4);
+        pk->normals = n;
+      }
+
+      list->format    = GL_N3F_V3F;
+      list->primitive = rd32 (r + 32);
+      list->points    = nindices;
+      list->packed    = pk;
+
+# ifdef HAVE_JWZGLES
+      /* The display list emulation wants plain float arrays. */
+      list->data   = unpack_floats (pk);
+      list->packed = 0;
+# endif /* HAVE_JWZGLES */
+
+      return list;
+    }
+
+  return 0;
+}
+
+
+static struct gllist *
+load_layer (gllist_container *c, const char *layer)
+{
+  gllist_layer *l;
+
+  for (l = c->layers; l; l = l->next)
+    if (!strcmp (l->name, layer))
+      return l->list;
+
+  l = (gllist_layer *) calloc (1, sizeof(*l));
+  if (!l) return 0;
+  l->list = parse_layer (c, layer);
+  if (!l->list)
+    {
+      free (l);
+      return 0;
+    }
+  strncpy (l->name, layer, sizeof(l->name)-1);
+  l->next = c->layers;
+  c->layers = l;
+  return l->list;
+}
+
+
+struct gllist *
+gllist_read_mesh (const void *data, unsigned long size, const char *layer)
+{
+  gllist_container *c;
+
+  for (c = containers; c; c = c->next)
+    if (c->data == data && c->size == size)
+      return load_layer (c, layer);
+
+  c = (gllist_container *) calloc (1, sizeof(*c));
+  if (!c) return 0;
+  c->data  = data;
+  c->size  = size;
+  c->bytes = (const unsigned char *) data;
+
+  /* Embedded data (e.g., from bin2c) may not be aligned for GLshort and
+     GLuint, and big-endian hosts need to swap it in place. */
+  if (((unsigned long) data & 3) || !little_endian_p())
+    {
+      unsigned char *copy = (unsigned char *) malloc (size);
+      if (!copy) abort();
+      memcpy (copy, data, size);
+      c->bytes = copy;
+    }
+
+  c->next = containers;
+  containers = c;
+  return load_layer (c, layer);
+}
+
+
+const GLfloat *
+gllist_floats (const struct gllist *list)
+{
+  struct gllist_packed *pk = (struct gllist_packed *) list->packed;
+  if (! pk)
+    return (const GLfloat *) list->data;
+  if (! pk->floats)
+    pk->floats = unpack_floats (pk);
+  return pk->floats;
+}
+
+
 void
 renderList (const struct gllist *list, int wire_p)
 {
   while (list)
     {
+# ifndef HAVE_JWZGLES
+      if (list->packed)
+        render_packed (list, wire_p);
+      else if (render_mesh (list, wire_p))
+        ;
+      else
+# endif
       if (!wire_p || list->primitive == GL_LINES ||
           list->primitive == GL_POINTS)
         {
@@ -60,6 +951,71 @@ renderList (const struct gllist *list, int wire_p)
 }
 
 
+static void
+render_normal (const GLfloat *v, const GLfloat *n, GLfloat length)
+{
+  glPushMatrix();
+  glTranslatef (v[0], v[1], v[2]);
+  glScalef (length, length, length);
+  glBegin (GL_LINES);
+  glVertex3f (0, 0, 0);
+  glVertex3f (n[0], n[1], n[2]);
+  glEnd();
+  glPopMatrix();
+}
+
+
+/* Decodes the position and normal of the Nth vertex, or of the vertex
+   at the Nth index if 'idx_p'. */
+static void
+packed_vertex (const struct gllist_packed *pk, int n, Bool idx_p,
+               GLfloat *v, GLfloat *nrm)
+{
+  int i;
+  if (idx_p)
+    n = (pk->index_type == GL_UNSIGNED_INT
+         ? ((const GLuint *) pk->indices)[n]
+         : ((const GLushort *) pk->indices)[n]);
+  for (i = 0; i < 3; i++)
+    {
+      v[i]   = pk->center[i] + pk->scale * pk->positions[n*4+i];
+      nrm[i] = pk->normals[n*4+i] / 127.0;
+    }
+}
+
+
+static void
+render_packed_normals (const struct gllist_packed *pk, GLfloat length,
+                       int faces_p)
+{
+  GLfloat v[3], n[3], v2[3], n2[3];
+  int i, j, k;
+
+  if (! faces_p)
+    for (i = 0; i < pk->nverts; i++)
+      {
+        packed_vertex (pk, i, False, v, n);
+        render_normal (v, n, length);
+      }
+  else
+    for (i = 0; i + 3 <= pk->nindices; i += 3)
+      {
+        v[0] = v[1] = v[2] = 0;
+        n[0] = n[1] = n[2] = 0;
+        for (j = 0; j < 3; j++)
+          {
+            packed_vertex (pk, i + j, True, v2, n2);
+            for (k = 0; k < 3; k++)
+              {
+                v[k] += v2[k] / 3;
+                n[k] += n2[k] / 3;
+              }
+          }
+        render_normal (v, n, length);
+      }
+}
+
+
 void
 renderListNormals (const struct gllist *list, GLfloat length, int faces_p)
 {
@@ -69,7 +1025,18 @@ renderListNormals (const struct gllist *list, GLfloat length, int faces_p)
       int i, j, tick, skip, stride;
       GLfloat v[3], n[3];
 
-      if (list->primitive == GL_LINES) continue;
+      if (list->primitive == GL_LINES || list->primitive == GL_POINTS)
+        {
+          list = list->next;
+          continue;
+        }
+
+      if (list->packed)
+        {
+          render_packed_normals (list->packed, length, faces_p);
+          list = list->next;
+          continue;
+        }
 
       if (! faces_p)
         tick = 1;
@@ -101,14 +1068,7 @@ renderListNormals (const struct gllist *list, GLfloat length, int faces_p)
               v[0] /= tick;
               v[1] /= tick;
               v[2] /= tick;
-              glPushMatrix();
-              glTranslatef (v[0], v[1], v[2]);
-              glScalef (length, length, length);
-              glBegin (GL_LINES);
-              glVertex3f (0, 0, 0);
-              glVertex3f (n[0], n[1], n[2]);
-              glEnd();
-              glPopMatrix();
+              render_normal (v, n, length);
               v[0] = v[1] = v[2] = 0;
               n[0] = n[1] = n[2] = 0;
             }
@@ -14,6 +14,8 @@
 
 #include "xlockmoreI.h"
 
+struct gllist_packed;
+
 struct gllist 
 {
   GLenum format;
@@ -21,9 +23,68 @@ struct gllist
   int points;
   const void *data;
   struct gllist *next;
+  const struct gllist_packed *packed;	/* From gllist_read_mesh(). */
 };
 
+/* Draws the list.  When buffer objects are available and we are not in the
+   middle of compiling a display list, the vertex data is uploaded into a
+   VBO the first time the list is drawn in a given GL context, and re-used
+   from then on.  In wireframe mode, a de-duplicated edge list is drawn
+   with GL_LINES instead of a line loop per face.
+
+   Those caches are keyed on the address of the list, so only lists that
+   never change should be drawn outside of a display list.  Inside
+   glNewList nothing is cached, and the vertex data is copied into the
+   display list as before: hacks that want the buffer objects should call
+   renderList from their draw routine instead of compiling it.
+ */
 void renderList (const struct gllist *, int wire_p);
 void renderListNormals (const struct gllist *, GLfloat length, int facesp);
 
+/* Returns the named layer of a binary mesh container, as written by
+   "dxf2gl.pl --binary".  The container is used in place (and uploaded from
+   there into buffer objects) so it must not be freed.  Returns 0 if the
+   data is malformed or there is no such layer.  Loading the same layer
+   twice returns the same list.
+
+   The container is linked into the hack as a const array rather than
+   mmapped from a file at run time, so that hacks stay self-contained; it
+   is paged in from the executable as it is read.
+
+   The container is little-endian, and laid out as:
+
+     char   magic[8]        "XSGLMSH1"
+     uint32 nlayers
+     uint32 reserved
+
+   followed by one 64 byte record per layer:
+
+     char   name[28]        NUL-padded
+     uint32 offset          of this layer's data, from the start of file
+     uint32 primitive       GL_TRIANGLES, GL_LINES or GL_POINTS
+     uint32 nverts
+     uint32 nindexes
+     uint32 nedges          pairs of indexes, for wireframe
+     float  center[3]       position = center + scale * quantized
+     float  scale
+
+   and then each layer's data, each array padded to 4 bytes:
+
+     int16  positions[nverts][4]     x, y, z, 0
+     int8   normals[nverts][2]       octahedron-encoded
+     uint16 indexes[nindexes]        uint32 if nverts > 65536
+     uint16 edges[nedges][2]         likewise
+
+   Lists loaded this way are drawn with GL_NORMALIZE enabled.
+ */
+struct gllist *gllist_read_mesh (const void *data, unsigned long size,
+                                 const char *layer);
+
+/* Returns the list's points as floats in its format, for hacks that walk
+   or deform the model themselves.  Lists from gllist_read_mesh() are
+   GL_N3F_V3F, decoded on the first call; the array belongs to the list and
+   must not be freed.
+ */
+const GLfloat *gllist_floats (const struct gllist *);
+
 #endif /* __GLLIST_H__ */
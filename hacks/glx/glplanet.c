@@ -123,7 +123,9 @@ ModStruct   planet_description =
 #include "gltrackball.h"
 #include "gllist.h"
 
-extern const struct gllist *timezones;
+/* A binary mesh container, see "timezones_dxf" in Makefile.in. */
+extern const unsigned char timezones[];
+extern const unsigned long timezones_size;
 
 /*-
  * slices and stacks are used in the sphere parameterization routine.
@@ -566,6 +568,7 @@ init_planet (ModeInfo * mi)
   planetstruct *gp;
   int screen = MI_SCREEN(mi);
   Bool wire = MI_IS_WIREFRAME(mi);
+  const struct gllist *tz;
 
   MI_INIT (mi, planets);
   gp = &planets[screen];
@@ -735,6 +738,13 @@ init_planet (ModeInfo * mi)
      make it curve.  It would be possible to also project these to a tube
      for the Mercator and Equirectangular modes, but I haven't bothered.
    */
+  tz = gllist_read_mesh (timezones, timezones_size, "all");
+  if (!tz)
+    {
+      fprintf (stderr, "%s: unable to load timezones\n", progname);
+      exit (1);
+    }
+
   gp->tzpoints = 0;
   gp->tzlist = glGenLists(1);
   glNewList (gp->tzlist, GL_COMPILE);
@@ -744,18 +754,19 @@ init_planet (ModeInfo * mi)
   glRotatef (180,  0, 1, 0);  /* line up the time zones */
   {
     GLfloat minx = 99999, miny = 99999, maxx = -99999, maxy = -99999;
-    const GLfloat *p = (GLfloat *) timezones->data;
-    int lines = timezones->points / 2;
+    /* Each point is a normal followed by a position. */
+    const GLfloat *p = gllist_floats (tz) + 3;
+    int lines = tz->points / 2;
     GLfloat min_seg = 0.05;
     int i;
-    if (timezones->primitive != GL_LINES) abort();
-    if (timezones->format != GL_V3F) abort();
+    if (tz->primitive != GL_LINES) abort();
+    if (tz->format != GL_N3F_V3F) abort();
 
     /* Find the bounding box. */
-    for (i = 0; i < timezones->points; i++)
+    for (i = 0; i < tz->points; i++)
       {
-        GLfloat x = p[i * 3];
-        GLfloat y = p[i * 3 + 1];
+        GLfloat x = p[i * 6];
+        GLfloat y = p[i * 6 + 1];
         if (x < minx) minx = x;
         if (x > maxx) maxx = x;
         if (y < miny) miny = y;
@@ -766,8 +777,8 @@ init_planet (ModeInfo * mi)
       {
         GLfloat x0 = minx + p[0] / (maxx-minx);
         GLfloat y0 = miny + p[1] / (maxy-miny);
-        GLfloat x1 = minx + p[3] / (maxx-minx);
-        GLfloat y1 = miny + p[4] / (maxy-miny);
+        GLfloat x1 = minx + p[6] / (maxx-minx);
+        GLfloat y1 = miny + p[7] / (maxy-miny);
 
         GLfloat d = sqrt ((x1-x0)*(x1-x0) + (y1-y0)*(y1-y0));
         int steps = d / min_seg;
@@ -789,7 +800,7 @@ init_planet (ModeInfo * mi)
             gp->tzpoints++;
           }
         glEnd();
-        p += 6;
+        p += 12;
       }
   }
   glPopMatrix ();
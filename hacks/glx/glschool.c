@@ -15,6 +15,7 @@
 #define DEFAULTS    "*delay:		20000       \n" \
                     "*showFPS:      False       \n" \
                     "*wireframe:    False       \n" \
+                    THREAD_DEFAULTS_XLOCK
 
 #define release_glschool		(0)
 #define glschool_handle_event	(xlockmore_no_events)
@@ -73,6 +74,7 @@ static XrmOptionDescRec opts[] = {
 	{ "-minradius",	".minradius",	XrmoptionSepArg, 0 },
 	{ "-distcomp",	".distcomp",	XrmoptionSepArg, 0 },
 	{ "-momentum",	".momentum",	XrmoptionSepArg, 0 },
+	THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -137,6 +139,7 @@ init_glschool(ModeInfo *mi)
 	int						height = MI_HEIGHT(mi);
 	Bool					wire = MI_IS_WIREFRAME(mi);
 	glschool_configuration	*sc;
+	int						err;
 
 	MI_INIT (mi, scs);
 	sc = &scs[MI_SCREEN(mi)];
@@ -160,6 +163,10 @@ init_glschool(ModeInfo *mi)
 		fprintf(stderr, "couldn't initialize TheSchool, exiting\n");
 		exit(1);
 	}
+	err = glschool_initThreads(sc->school, MI_DISPLAY(mi));
+	if (err)
+		fprintf(stderr, "%s: couldn't create threads, using one: %s\n",
+				progname, strerror(err));
 
 	reshape_glschool(mi, width, height);
 
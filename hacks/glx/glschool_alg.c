@@ -164,7 +164,7 @@ glschool_initSchool(int nFish, double accLimit, double maxV, double minV, double
 {
 	School	*s = (School *)0;
 
-	if ((s = (School *)malloc(sizeof(School))) == (School *)0) {
+	if ((s = (School *)calloc(1, sizeof(School))) == (School *)0) {
 		perror("initSchool School allocation failed: ");
 		return s;
 	}
@@ -175,6 +175,20 @@ glschool_initSchool(int nFish, double accLimit, double maxV, double minV, double
 		return (School *)0;
 	}
 
+	s->cellOf = (int *)malloc(sizeof(int)*nFish);
+	s->order = (int *)malloc(sizeof(int)*nFish);
+	s->px = (float *)malloc(sizeof(float)*nFish*6);
+	if (!s->cellOf || !s->order || !s->px) {
+		perror("initSchool grid allocation failed: ");
+		glschool_freeSchool(s);
+		return (School *)0;
+	}
+	s->py = s->px + nFish;
+	s->pz = s->py + nFish;
+	s->vx = s->pz + nFish;
+	s->vy = s->vx + nFish;
+	s->vz = s->vy + nFish;
+
 	SCHOOL_NFISH(s) = nFish;
 	SCHOOL_ACCLIMIT(s) = accLimit;
 	SCHOOL_MAXVEL(s) = maxV;
@@ -195,6 +209,11 @@ glschool_initSchool(int nFish, double accLimit, double maxV, double minV, double
 void
 glschool_freeSchool(School *s)
 {
+	if (s->threads.count) threadpool_destroy(&s->threads);
+	free(s->cellStart);
+	free(s->cellOf);
+	free(s->order);
+	free(s->px);
 	free(SCHOOL_FISHES(s));
 	free(s);
 }
@@ -254,38 +273,149 @@ glschool_computeNormalAndThetaToPlusZ(double *v, double *xV)
 }
 
 
-int
+/* A fish only counts another as a neighbour if pow(dist, distExp) is no
+   more than pow(minRadius, distExp), where dist is their distance less
+   distComp; so, for any positive distExp, if they are no further apart
+   than minRadius + distComp.  Grid cells are at least that wide.  With
+   any other distExp, everything is one cell, and every fish is checked
+   against every other, as before.
+ */
+#define MAX_GRID_DIM	64
+
+static int
+cellCoord(School *s, int i, double p)
+{
+	int		c = (int)((p - BBOX_IMIN(&SCHOOL_BBOX(s), i)) * s->cellScale[i]);
+	if (c < 0) c = 0;
+	if (c >= s->gridDims[i]) c = s->gridDims[i] - 1;
+	return c;
+}
+
+
+static void
+buildGrid(School *s)
+{
+	int		i, c;
+	int		nFish = SCHOOL_NFISH(s);
+	double	reach = SCHOOL_MINRADIUS(s) + SCHOOL_DISTCOMP(s);
+	Fish	*fishes = SCHOOL_FISHES(s);
+	Fish	*f;
+
+	for(i = 0; i < 3; i++) {
+		double	range = SCHOOL_IRANGE(s, i);
+		int		n = 1;
+		if (SCHOOL_DISTEXP(s) > 0.0 && reach > 0.0 && range > reach)
+			n = (range / reach < MAX_GRID_DIM ? (int)(range / reach) : MAX_GRID_DIM);
+		s->gridDims[i] = n;
+		s->cellScale[i] = (range > 0.0 ? n / range : 0.0);
+	}
+	s->nCells = s->gridDims[0] * s->gridDims[1] * s->gridDims[2];
+
+	if (s->nCells + 1 > s->cellsAllocated) {
+		free(s->cellStart);
+		s->cellsAllocated = s->nCells + 1;
+		s->cellStart = (int *)malloc(sizeof(int)*s->cellsAllocated);
+		if (s->cellStart == (int *)0) {
+			perror("computeAccelerations grid allocation failed: ");
+			exit(1);
+		}
+	}
+
+	/* Count the fish in each cell, and from that, where each cell starts.
+	   Then sort them in, with cellStart[c] as the next free place in cell
+	   c; that leaves it where cell c+1 starts, so shift it back by one. */
+	for(c = 0; c <= s->nCells; c++)
+		s->cellStart[c] = 0;
+	for(i = 0, f = fishes; i < nFish; i++, f++) {
+		c = ((cellCoord(s, 2, FISH_Z(f)) * s->gridDims[1] +
+			  cellCoord(s, 1, FISH_Y(f))) * s->gridDims[0] +
+			 cellCoord(s, 0, FISH_X(f)));
+		s->cellOf[i] = c;
+		s->cellStart[c+1]++;
+	}
+	for(c = 1; c <= s->nCells; c++)
+		s->cellStart[c] += s->cellStart[c-1];
+	for(i = 0, f = fishes; i < nFish; i++, f++) {
+		int		k = s->cellStart[s->cellOf[i]]++;
+		s->order[k] = i;
+		s->px[k] = FISH_X(f);
+		s->py[k] = FISH_Y(f);
+		s->pz[k] = FISH_Z(f);
+		s->vx[k] = FISH_VX(f);
+		s->vy[k] = FISH_VY(f);
+		s->vz[k] = FISH_VZ(f);
+	}
+	for(c = s->nCells; c > 0; c--)
+		s->cellStart[c] = s->cellStart[c-1];
+	s->cellStart[0] = 0;
+}
+
+
+/* Sums up the fish near ref, which must not have moved since the grid was
+   built.  Only reads the school, so any number of threads can do this at
+   once.
+ */
+static int
 glschool_computeGroupVectors(School *s, Fish *ref, double *avoidance, double *centroid, double *avgVel)
 {
-	int		i;
+	int		i, cx, cy, cz;
 	double	dist;
 	double	adjDist;
 	double	diffVect[3];
 	int		neighborCount = 0;
-	Fish	*test = (Fish *)0;
-	int		nFish = SCHOOL_NFISH(s);
+	int		self = ref - SCHOOL_FISHES(s);
+	int		*dims = s->gridDims;
 	double	distExp = SCHOOL_DISTEXP(s);
 	double	distComp = SCHOOL_DISTCOMP(s);
 	double	minRadiusExp = SCHOOL_MINRADIUSEXP(s);
-	Fish	*fishes = SCHOOL_FISHES(s);
-
-	for(i = 0, test = fishes; i < nFish; i++, test++) {
-		if (test == ref) continue;
-
-		getDifferenceVector(FISH_POS(ref), FISH_POS(test), diffVect);
-
-		dist = norm(diffVect) - distComp;
-		if (dist < 0.0) dist = 0.1;
-
-		adjDist = pow(dist, distExp);
-		if (adjDist > minRadiusExp) continue;
-
-		neighborCount++;
-
-		addVector(avgVel, FISH_VEL(test));
-		addVector(centroid, FISH_POS(test));
-
-		addScaledVector(avoidance, diffVect, 1.0/adjDist);
+	double	reach = SCHOOL_MINRADIUS(s) + distComp;
+	double	reach2 = reach * reach * 1.0001;	/* a little slack for rounding */
+	int		nearOnly = (distExp > 0.0 && reach > 0.0);
+	int		refCell[3];
+
+	refCell[0] = s->cellOf[self] % dims[0];
+	refCell[1] = s->cellOf[self] / dims[0] % dims[1];
+	refCell[2] = s->cellOf[self] / (dims[0] * dims[1]);
+
+	for(cz = refCell[2] - 1; cz <= refCell[2] + 1; cz++) {
+		if (cz < 0 || cz >= dims[2]) continue;
+		for(cy = refCell[1] - 1; cy <= refCell[1] + 1; cy++) {
+			if (cy < 0 || cy >= dims[1]) continue;
+			for(cx = refCell[0] - 1; cx <= refCell[0] + 1; cx++) {
+				int		c = (cz * dims[1] + cy) * dims[0] + cx;
+				int		end;
+				if (cx < 0 || cx >= dims[0]) continue;
+
+				for(i = s->cellStart[c], end = s->cellStart[c+1]; i < end; i++) {
+					double	d2;
+					if (s->order[i] == self) continue;
+
+					diffVect[0] = FISH_X(ref) - s->px[i];
+					diffVect[1] = FISH_Y(ref) - s->py[i];
+					diffVect[2] = FISH_Z(ref) - s->pz[i];
+					d2 = (diffVect[0]*diffVect[0] + diffVect[1]*diffVect[1] +
+						  diffVect[2]*diffVect[2]);
+					if (nearOnly && d2 > reach2) continue;
+
+					dist = sqrt(d2) - distComp;
+					if (dist < 0.0) dist = 0.1;
+
+					adjDist = pow(dist, distExp);
+					if (adjDist > minRadiusExp) continue;
+
+					neighborCount++;
+
+					avgVel[0] += s->vx[i];
+					avgVel[1] += s->vy[i];
+					avgVel[2] += s->vz[i];
+					centroid[0] += s->px[i];
+					centroid[1] += s->py[i];
+					centroid[2] += s->pz[i];
+
+					addScaledVector(avoidance, diffVect, 1.0/adjDist);
+				}
+			}
+		}
 	}
 	if (neighborCount > 0) {
 		scaleVector(avgVel, 1.0/neighborCount);
@@ -295,10 +425,9 @@ glschool_computeGroupVectors(School *s, Fish *ref, double *avoidance, double *ce
 }
 
 
-void
-glschool_computeAccelerations(School *s)
+static void
+computeAcceleration(School *s, Fish *ref)
 {
-	int		i;
 	int		j;
 	int		neighborCount;
 	double	dist;
@@ -308,8 +437,6 @@ glschool_computeAccelerations(School *s)
 	double	diffVect[3];
 	double	centroid[3];
 	double	avoidance[3];
-	Fish	*ref = (Fish *)0;
-	int		nFish = SCHOOL_NFISH(s);
 	double	*goal = SCHOOL_GOAL(s);
 	double	distExp = SCHOOL_DISTEXP(s);
 	double	distComp = SCHOOL_DISTCOMP(s);
@@ -319,46 +446,112 @@ glschool_computeAccelerations(School *s)
 	double	targetFact = SCHOOL_TARGETFACT(s);
 	double	accLimit = SCHOOL_ACCLIMIT(s);
 	double	minRadius = SCHOOL_MINRADIUS(s);
-	Fish	*fishes = SCHOOL_FISHES(s);
 
-	for(i = 0, ref = fishes; i < nFish; i++, ref++) {
-		clearVector(avgVel);
-		clearVector(centroid);
-		clearVector(avoidance);
-		clearVector(FISH_ACC(ref));
-		neighborCount = glschool_computeGroupVectors(s, ref, avoidance, centroid, avgVel);
-
-		/* avoidanceAccel[] = avoidance[] * AvoidFact */
-		scaleVector(avoidance, avoidFact);
-		addVector(FISH_ACC(ref), avoidance);
-
-		accMag = norm(FISH_ACC(ref));
-		if (neighborCount > 0 && accMag < accLimit) {
-			for(j = 0; j < 3; j++) {
-				FISH_IAVGVEL(ref, j) = avgVel[j];
-				FISH_IACC(ref, j) += ((avgVel[j] - FISH_IVEL(ref, j)) * matchFact);
-			}
-
-			accMag = norm(FISH_ACC(ref));
-			if (accMag < accLimit) {
-				for(j = 0; j < 3; j++)
-					FISH_IACC(ref, j) += ((centroid[j] - FISH_IPOS(ref, j)) * centerFact);
-			}
+	clearVector(avgVel);
+	clearVector(centroid);
+	clearVector(avoidance);
+	clearVector(FISH_ACC(ref));
+	neighborCount = glschool_computeGroupVectors(s, ref, avoidance, centroid, avgVel);
+
+	/* avoidanceAccel[] = avoidance[] * AvoidFact */
+	scaleVector(avoidance, avoidFact);
+	addVector(FISH_ACC(ref), avoidance);
+
+	accMag = norm(FISH_ACC(ref));
+	if (neighborCount > 0 && accMag < accLimit) {
+		for(j = 0; j < 3; j++) {
+			FISH_IAVGVEL(ref, j) = avgVel[j];
+			FISH_IACC(ref, j) += ((avgVel[j] - FISH_IVEL(ref, j)) * matchFact);
 		}
 
 		accMag = norm(FISH_ACC(ref));
 		if (accMag < accLimit) {
-			getDifferenceVector(goal, FISH_POS(ref), diffVect);
+			for(j = 0; j < 3; j++)
+				FISH_IACC(ref, j) += ((centroid[j] - FISH_IPOS(ref, j)) * centerFact);
+		}
+	}
 
-			dist = norm(diffVect) - distComp;
-			if (dist < 0.0) dist = 0.1;
+	accMag = norm(FISH_ACC(ref));
+	if (accMag < accLimit) {
+		getDifferenceVector(goal, FISH_POS(ref), diffVect);
 
-			/*adjDist = pow(dist, distExp);*/
-			if (dist > minRadius) {
-				adjDist = pow(dist, distExp);
-				for(j = 0; j < 3; j++)
-					FISH_IACC(ref, j) += (diffVect[j]*targetFact/adjDist);
-			}
+		dist = norm(diffVect) - distComp;
+		if (dist < 0.0) dist = 0.1;
+
+		/*adjDist = pow(dist, distExp);*/
+		if (dist > minRadius) {
+			adjDist = pow(dist, distExp);
+			for(j = 0; j < 3; j++)
+				FISH_IACC(ref, j) += (diffVect[j]*targetFact/adjDist);
 		}
 	}
 }
+
+
+/* Each thread does a share of the fish, in grid order, so that the ones it
+   works on at once are near each other in memory too.
+ */
+struct schoolThread {
+	School		*s;
+	unsigned	id;
+};
+
+static int
+schoolThreadCreate(void *self, struct threadpool *pool, unsigned id)
+{
+	struct schoolThread	*t = (struct schoolThread *)self;
+	t->s = GET_PARENT_OBJ(School, threads, pool);
+	t->id = id;
+	return 0;
+}
+
+static void
+schoolThreadRun(void *self)
+{
+	const struct schoolThread	*t = (const struct schoolThread *)self;
+	School	*s = t->s;
+	int		nFish = SCHOOL_NFISH(s);
+	int		k0 = (int)((long)nFish * t->id / s->threads.count);
+	int		k1 = (int)((long)nFish * (t->id + 1) / s->threads.count);
+	int		k;
+
+	for(k = k0; k < k1; k++)
+		computeAcceleration(s, &SCHOOL_IFISH(s, s->order[k]));
+}
+
+
+int
+glschool_initThreads(School *s, Display *dpy)
+{
+	static const struct threadpool_class cls = {
+		sizeof(struct schoolThread),
+		schoolThreadCreate,
+		0
+	};
+
+	int		err = threadpool_create(&s->threads, &cls, dpy, hardware_concurrency(dpy));
+
+	/* Without threads, glschool_computeAccelerations does the whole school
+	   itself. */
+	if (err)
+		s->threads.count = 0; /* See the note in thread_util.h. */
+	return err;
+}
+
+
+void
+glschool_computeAccelerations(School *s)
+{
+	int		k;
+	int		nFish = SCHOOL_NFISH(s);
+
+	buildGrid(s);
+
+	if (s->threads.count) {
+		threadpool_run(&s->threads, schoolThreadRun);
+		threadpool_wait(&s->threads);
+	} else {
+		for(k = 0; k < nFish; k++)
+			computeAcceleration(s, &SCHOOL_IFISH(s, s->order[k]));
+	}
+}
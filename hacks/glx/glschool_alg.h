@@ -11,6 +11,8 @@
 #ifndef __GLSCHOOL_ALG_H__
 #define __GLSCHOOL_ALG_H__
 
+#include "thread_util.h"
+
 typedef struct {
 	double	mins[3];
 	double	maxs[3];
@@ -80,6 +82,23 @@ typedef struct {
 	double		boxRanges[3];
 	BBox		theBox;
 	Fish		*theFish;
+
+	/* Rebuilt by glschool_computeAccelerations every step: the fish sorted
+	   into a grid of cells at least as wide as the distance at which they
+	   can see each other, so that only the 27 cells around a fish need to
+	   be searched.  Their positions and velocities are copied out in that
+	   order, as separate arrays of floats. */
+	int			gridDims[3];
+	double		cellScale[3];
+	int			nCells, cellsAllocated;
+	int			*cellStart;			/* Fish in cell c: cellStart[c] ... [c+1]-1 */
+	int			*cellOf;			/* Cell of each fish */
+	int			*order;				/* Fish at each position in the grid */
+	float		*px, *py, *pz;
+	float		*vx, *vy, *vz;
+
+	/* Optional; see glschool_initThreads. */
+	struct threadpool	threads;
 } School;
 
 #define SCHOOL_NFISH(s)			((s)->nFish)
@@ -119,8 +138,8 @@ extern School		*glschool_initSchool(int, double, double, double, double, double,
 extern void		glschool_newGoal(School *);
 extern void		glschool_setBBox(School *, double, double, double, double, double, double);
 
+extern int		glschool_initThreads(School *, Display *);
 extern void		glschool_computeAccelerations(School *);
 extern double		glschool_computeNormalAndThetaToPlusZ(double *, double *);
-int			glschool_computeGroupVectors(School *, Fish *, double *, double *, double *);
 
 #endif /* __GLSCHOOL_ALG_H__ */
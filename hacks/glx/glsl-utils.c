@@ -19,6 +19,23 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* A cache of linked programs, so that the shaders are not compiled again
+   every time a hack starts, which can take a while with llvmpipe.  The
+   binaries from glGetProgramBinary are saved in $XDG_CACHE_HOME/xscreensaver/
+   named by a hash of the sources and of the driver's vendor, renderer and
+   version strings.  If the driver rejects a cached binary anyway, the
+   shaders are compiled again and the file is replaced. */
+#if defined(GL_PROGRAM_BINARY_LENGTH) && \
+    (!defined(HAVE_JWXYZ) || defined(HAVE_WAYLAND))
+# define GLSL_PROGRAM_CACHE
+#endif
+
+#ifdef GLSL_PROGRAM_CACHE
+# include <sys/stat.h>
+# include <sys/types.h>
+# include <unistd.h>
+#endif
+
 
 #ifdef HAVE_GLSL
 
@@ -304,12 +321,202 @@ static void print_link_error(GLuint program)
 #endif
 
 
+#ifdef GLSL_PROGRAM_CACHE
+
+#define GLSL_CACHE_MAGIC "XSGLSL01"
+#define GLSL_CACHE_MAX (64 * 1024 * 1024)
+
+/* The header of a cache file, which is followed by the binary. */
+typedef struct {
+  char magic[8];
+  uint64_t hash;
+  GLenum format;
+  GLint length;
+} glsl_cache_header;
+
+
+/* Add a string, and its terminating null as a separator, to a FNV-1a
+   hash. */
+static uint64_t cache_hash_string(uint64_t h, const char *s)
+{
+  if (s == NULL)
+    s = "";
+  do
+  {
+    h ^= (unsigned char) *s;
+    h = h * 0x1b3 + (h << 40);   /* h *= 0x100000001b3 */
+  }
+  while (*s++);
+  return h;
+}
+
+
+/* Hash everything that the program binary depends on. */
+static uint64_t cache_hash(GLsizei vertex_shader_count,
+                           const GLchar **vertex_shader_source,
+                           GLsizei fragment_shader_count,
+                           const GLchar **fragment_shader_source)
+{
+  uint64_t h = ((uint64_t) 0xcbf29ce4 << 32) | 0x84222325;
+  char n[40];
+  int i;
+
+  h = cache_hash_string(h,(const char *)glGetString(GL_VENDOR));
+  h = cache_hash_string(h,(const char *)glGetString(GL_RENDERER));
+  h = cache_hash_string(h,(const char *)glGetString(GL_VERSION));
+  h = cache_hash_string(h,
+                      (const char *)glGetString(GL_SHADING_LANGUAGE_VERSION));
+  sprintf(n,"%d %d",(int)vertex_shader_count,(int)fragment_shader_count);
+  h = cache_hash_string(h,n);
+  for (i=0; i<vertex_shader_count; i++)
+    h = cache_hash_string(h,vertex_shader_source[i]);
+  for (i=0; i<fragment_shader_count; i++)
+    h = cache_hash_string(h,fragment_shader_source[i]);
+  return h;
+}
+
+
+/* Whether the driver can save program binaries at all. */
+static GLboolean cache_supported(void)
+{
+  GLint gl_major, gl_minor, glsl_major, glsl_minor, formats = 0;
+  GLboolean gl_gles3;
+  const char *ext;
+
+  if (!glsl_GetGlAndGlslVersions(&gl_major,&gl_minor,&glsl_major,&glsl_minor,
+                                 &gl_gles3))
+    return GL_FALSE;
+  if (gl_gles3 ? gl_major < 3 : (gl_major < 4 ||
+                                 (gl_major == 4 && gl_minor < 1)))
+  {
+    ext = (const char *)glGetString(GL_EXTENSIONS);
+    if (ext == NULL || strstr(ext,"GL_ARB_get_program_binary") == NULL)
+      return GL_FALSE;
+  }
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS,&formats);
+  return formats > 0;
+}
+
+
+/* The name of the cache file for a hash, creating its directory if
+   necessary, or NULL. */
+static char *cache_file_name(uint64_t hash)
+{
+  const char *xdg = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+  char *file;
+
+  if (xdg != NULL && *xdg)
+    home = NULL;
+  else if (home != NULL && *home)
+    xdg = NULL;
+  else
+    return NULL;
+
+  file = malloc(strlen(xdg ? xdg : home) + 60);
+  if (file == NULL)
+    return NULL;
+  if (xdg)
+    strcpy(file,xdg);
+  else
+    sprintf(file,"%s/.cache",home);
+  mkdir(file,0700);
+  strcat(file,"/xscreensaver");
+  mkdir(file,0700);
+  sprintf(file + strlen(file),"/glsl-%08lx%08lx.bin",
+          (unsigned long) (hash >> 32), (unsigned long) (hash & 0xffffffff));
+  return file;
+}
+
+
+/* Create a program from a cache file, if it is there and still good. */
+static GLboolean cache_load(const char *file, uint64_t hash,
+                            GLuint *shader_program)
+{
+  FILE *in;
+  glsl_cache_header h;
+  void *binary = NULL;
+  GLint status = GL_FALSE;
+
+  in = fopen(file,"rb");
+  if (in == NULL)
+    return GL_FALSE;
+  if (fread(&h,sizeof(h),1,in) == 1 &&
+      !memcmp(h.magic,GLSL_CACHE_MAGIC,sizeof(h.magic)) &&
+      h.hash == hash &&
+      h.length > 0 && h.length <= GLSL_CACHE_MAX &&
+      (binary = malloc(h.length)) != NULL &&
+      fread(binary,1,h.length,in) == (size_t) h.length)
+  {
+    *shader_program = glCreateProgram();
+    if (*shader_program != 0)
+    {
+      glProgramBinary(*shader_program,h.format,binary,h.length);
+      glGetProgramiv(*shader_program,GL_LINK_STATUS,&status);
+      if (status == GL_FALSE)
+      {
+        glDeleteProgram(*shader_program);
+        /* Don't leave GL_INVALID_ENUM from an unknown format around. */
+        while (glGetError() != GL_NO_ERROR)
+          ;
+      }
+    }
+  }
+  free(binary);
+  fclose(in);
+  return (status == GL_FALSE ? GL_FALSE : GL_TRUE);
+}
+
+
+/* Save a linked program to a cache file.  It is written to a temporary
+   file first, since the same hack may be starting on another screen. */
+static void cache_save(const char *file, uint64_t hash, GLuint shader_program)
+{
+  glsl_cache_header h;
+  GLint length = 0;
+  void *binary;
+  char *tmp;
+  FILE *out;
+  int ok;
+
+  glGetProgramiv(shader_program,GL_PROGRAM_BINARY_LENGTH,&length);
+  if (length <= 0 || length > GLSL_CACHE_MAX)
+    return;
+  binary = malloc(length);
+  tmp = malloc(strlen(file) + 20);
+  if (binary != NULL && tmp != NULL)
+  {
+    memset(&h,0,sizeof(h));
+    glGetProgramBinary(shader_program,length,&length,&h.format,binary);
+    memcpy(h.magic,GLSL_CACHE_MAGIC,sizeof(h.magic));
+    h.hash = hash;
+    h.length = length;
+    sprintf(tmp,"%s.%ld",file,(long) getpid());
+    out = (length > 0 ? fopen(tmp,"wb") : NULL);
+    if (out != NULL)
+    {
+      ok = (fwrite(&h,sizeof(h),1,out) == 1 &&
+            fwrite(binary,1,length,out) == (size_t) length);
+      if (fclose(out) != 0)
+        ok = 0;
+      if (!ok || rename(tmp,file) != 0)
+        unlink(tmp);
+    }
+  }
+  free(binary);
+  free(tmp);
+}
+
+#endif /* GLSL_PROGRAM_CACHE */
+
+
 /* Compile and link a vertex and a Fragment shader into a GLSL program. */
-GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
-                                     const GLchar **vertex_shader_source,
-                                     GLsizei fragment_shader_count,
-                                     const GLchar **fragment_shader_source,
-                                     GLuint *shader_program)
+static GLboolean compile_and_link_shaders(GLsizei vertex_shader_count,
+                                          const GLchar **vertex_shader_source,
+                                          GLsizei fragment_shader_count,
+                                          const GLchar **fragment_shader_source,
+                                          GLuint *shader_program,
+                                          GLboolean retrievable)
 {
   GLuint vertex_shader, fragment_shader;
   GLint status;
@@ -360,6 +567,11 @@ GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
   }
   glAttachShader(*shader_program,vertex_shader);
   glAttachShader(*shader_program,fragment_shader);
+#ifdef GLSL_PROGRAM_CACHE
+  if (retrievable)
+    glProgramParameteri(*shader_program,GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                        GL_TRUE);
+#endif
   glLinkProgram(*shader_program);
   glGetProgramiv(*shader_program,GL_LINK_STATUS,&status);
   if (status == GL_FALSE)
@@ -388,4 +600,45 @@ GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
 }
 
 
+/* Compile and link a vertex and a Fragment shader into a GLSL program, or
+   load it from the cache of program binaries. */
+GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
+                                     const GLchar **vertex_shader_source,
+                                     GLsizei fragment_shader_count,
+                                     const GLchar **fragment_shader_source,
+                                     GLuint *shader_program)
+{
+#ifdef GLSL_PROGRAM_CACHE
+  uint64_t hash;
+  char *file;
+  GLboolean ok;
+
+  if (!cache_supported())
+    return compile_and_link_shaders(vertex_shader_count,vertex_shader_source,
+                                    fragment_shader_count,
+                                    fragment_shader_source,shader_program,
+                                    GL_FALSE);
+  hash = cache_hash(vertex_shader_count,vertex_shader_source,
+                    fragment_shader_count,fragment_shader_source);
+  file = cache_file_name(hash);
+  if (file != NULL && cache_load(file,hash,shader_program))
+  {
+    free(file);
+    return GL_TRUE;
+  }
+  ok = compile_and_link_shaders(vertex_shader_count,vertex_shader_source,
+                                fragment_shader_count,fragment_shader_source,
+                                shader_program,GL_TRUE);
+  if (ok && file != NULL)
+    cache_save(file,hash,*shader_program);
+  free(file);
+  return ok;
+#else
+  return compile_and_link_shaders(vertex_shader_count,vertex_shader_source,
+                                  fragment_shader_count,fragment_shader_source,
+                                  shader_program,GL_FALSE);
+#endif
+}
+
+
 #endif /* HAVE_GLSL */
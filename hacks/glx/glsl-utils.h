@@ -59,7 +59,8 @@ extern GLboolean glsl_GetGlAndGlslVersions(GLint *gl_major,
                                            GLint *glsl_minor,
                                            GLboolean *gl_gles3);
 
-/* Compile and link a vertex and a Fragment shader into a GLSL program. */
+/* Compile and link a vertex and a Fragment shader into a GLSL program, or
+   load it from the cache of program binaries in $XDG_CACHE_HOME. */
 extern GLboolean glsl_CompileAndLinkShaders(GLsizei vertex_shader_count,
                                         const GLchar **vertex_shader_source,
                                         GLsizei fragment_shader_count,
@@ -56,10 +56,12 @@
                   "*titleFont: sans-serif 18\n" \
                   "*desktopGrabber:  xscreensaver-getimage -no-desktop %s\n" \
 		  "*grabDesktopImages:   False \n" \
-		  "*chooseRandomImages:  True  \n"
+		  "*chooseRandomImages:  True  \n" \
+		  THREAD_DEFAULTS_XLOCK
 
 # define release_slideshow 0
 # include "xlockmore.h"
+# include "thread_util.h"
 
 #include <sys/time.h>
 
@@ -194,6 +196,7 @@ static XrmOptionDescRec opts[] = {
   {"-v",            ".verbose",       XrmoptionNoArg, "True"  },
   {"-verbose",      ".verbose",       XrmoptionNoArg, "True"  },
   {"-debug",        ".debug",         XrmoptionNoArg, "True"  },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -18,6 +18,7 @@
 #include "pow2.h"
 #include "visual.h"
 #include "xshm.h"
+#include "thread_util.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -108,30 +109,172 @@ spread_bits (unsigned char value, unsigned char width)
 }
 
 
+/* What convert_rows() needs to know to convert each pixel.
+ */
+typedef struct {
+  XImage *from, *to;
+  int y;				/* first row of 'from' to convert */
+  XColor *colors;			/* PseudoColor, or 0 for TrueColor */
+  unsigned long srpos, sgpos, sbpos;	/* source bitfield positions */
+  unsigned long srmsk, sgmsk, sbmsk;
+  unsigned long crpos, cgpos, cbpos, capos;	/* destination positions */
+  Bool spread_p;			/* some channel isn't 8 bits wide */
+  unsigned char spread_map[3][256];
+} rgba32_converter;
+
+
+/* Converts rows [y0, y1) of 'to'.
+
+   Converting a 4K image with XGetPixel/XPutPixel takes hundreds of
+   milliseconds, so the common TrueColor layouts read the rows directly.
+   The 8-bits-per-channel, 32-bits-per-pixel, native-endian case is just
+   masks and shifts by loop-invariant amounts, which the compiler turns
+   into vector code.
+ */
+static void
+convert_rows (const rgba32_converter *c, int y0, int y1)
+{
+  XImage *from = c->from;
+  XImage *to = c->to;
+  int width = to->width;
+  int bpp = from->bits_per_pixel;
+  Bool native_p = (from->byte_order == to->byte_order);
+  const uint32_t srmsk = c->srmsk, sgmsk = c->sgmsk, sbmsk = c->sbmsk;
+  const int srpos = c->srpos, sgpos = c->sgpos, sbpos = c->sbpos;
+  const int crpos = c->crpos, cgpos = c->cgpos, cbpos = c->cbpos;
+  const uint32_t alpha = (uint32_t) 0xFF << c->capos;
+  int x, y;
+
+  for (y = y0; y < y1; y++)
+    {
+      const unsigned char *in = ((const unsigned char *) from->data +
+                                 (c->y + y) * from->bytes_per_line);
+      uint32_t *out = (uint32_t *) (to->data + y * to->bytes_per_line);
+
+      if (c->colors)
+        for (x = 0; x < width; x++)
+          {
+            unsigned long sp = XGetPixel (from, x, c->y + y);
+            out[x] = (((uint32_t) (c->colors[sp].red   & 0xFF) << crpos) |
+                      ((uint32_t) (c->colors[sp].green & 0xFF) << cgpos) |
+                      ((uint32_t) (c->colors[sp].blue  & 0xFF) << cbpos) |
+                      alpha);
+          }
+      else if (bpp == 32 && native_p && !c->spread_p)
+        {
+          const uint32_t *in32 = (const uint32_t *) in;
+          for (x = 0; x < width; x++)
+            {
+              uint32_t p = in32[x];
+              out[x] = ((((p & srmsk) >> srpos) << crpos) |
+                        (((p & sgmsk) >> sgpos) << cgpos) |
+                        (((p & sbmsk) >> sbpos) << cbpos) |
+                        alpha);
+            }
+        }
+      else
+        {
+          int bytes = bpp / 8;
+          Bool direct_p = (bpp == 32 || bpp == 24 || bpp == 16);
+          for (x = 0; x < width; x++, in += bytes)
+            {
+              unsigned long sp;
+              unsigned char sr, sg, sb;
+
+              if (! direct_p)
+                sp = XGetPixel (from, x, c->y + y);
+              else if (from->byte_order == LSBFirst)
+                sp = (bytes == 2 ? in[0] | (in[1] << 8) :
+                      bytes == 3 ? in[0] | (in[1] << 8) | (in[2] << 16) :
+                      in[0] | (in[1] << 8) | (in[2] << 16) |
+                      ((unsigned long) in[3] << 24));
+              else
+                sp = (bytes == 2 ? (in[0] << 8) | in[1] :
+                      bytes == 3 ? (in[0] << 16) | (in[1] << 8) | in[2] :
+                      ((unsigned long) in[0] << 24) | (in[1] << 16) |
+                      (in[2] << 8) | in[3]);
+
+              sr = (sp & srmsk) >> srpos;
+              sg = (sp & sgmsk) >> sgpos;
+              sb = (sp & sbmsk) >> sbpos;
+
+              if (c->spread_p)
+                {
+                  sr = c->spread_map[0][sr];
+                  sg = c->spread_map[1][sg];
+                  sb = c->spread_map[2][sb];
+                }
+
+              out[x] = (((uint32_t) sr << crpos) |
+                        ((uint32_t) sg << cgpos) |
+                        ((uint32_t) sb << cbpos) |
+                        alpha);
+            }
+        }
+    }
+}
+
+
+/* Big images are converted in horizontal bands, one per CPU.  The pool is
+   created the first time it's needed and kept for the life of the process,
+   since an image-loading hack will keep loading images.
+ */
+#define PARALLEL_PIXELS (1 << 18)
+
+static struct {
+  int state;				/* 0 = untried, 1 = running, -1 = failed */
+  struct threadpool pool;
+  const rgba32_converter *job;
+} converter_threads;
+
+struct converter_thread {
+  unsigned id;
+};
+
+static int
+converter_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct converter_thread *t = (struct converter_thread *) self;
+  t->id = id;
+  return 0;
+}
+
+static void
+converter_thread_run (void *self)
+{
+  const struct converter_thread *t = (const struct converter_thread *) self;
+  const rgba32_converter *c = converter_threads.job;
+  unsigned n = converter_threads.pool.count;
+  int h = c->to->height;
+  convert_rows (c, h * t->id / n, h * (t->id + 1) / n);
+}
+
+
+/* Returns a new 32-bit RGBA XImage of rows [y, y+height) of the image.
+ */
 static XImage *
-convert_ximage_to_rgba32 (Screen *screen, XImage *image)
+convert_ximage_rows (Screen *screen, XImage *image, int y, int height)
 {
   Display *dpy = DisplayOfScreen (screen);
   Visual *visual = DefaultVisualOfScreen (screen);
-
-  int x, y;
-  unsigned long crpos=0, cgpos=0, cbpos=0, capos=0; /* bitfield positions */
-  unsigned long srpos=0, sgpos=0, sbpos=0;
-  unsigned long srmsk=0, sgmsk=0, sbmsk=0;
+  rgba32_converter c;
   unsigned long srsiz=0, sgsiz=0, sbsiz=0;
-  XColor *colors = 0;
-  unsigned char spread_map[3][256];
 
   /* Note: height+2 in "to" to work around an array bounds overrun
      in gluBuild2DMipmaps / gluScaleImage.
    */
   XImage *from = image;
   XImage *to = XCreateImage (dpy, visual, 32,  /* depth */
-                             ZPixmap, 0, 0, from->width, from->height,
+                             ZPixmap, 0, 0, from->width, height,
                              32, /* bitmap pad */
                              0);
   to->data = (char *) calloc (to->height + 2, to->bytes_per_line);
 
+  memset (&c, 0, sizeof(c));
+  c.from = from;
+  c.to = to;
+  c.y = y;
+
   /* Set the bit order in the XImage structure to whatever the
      local host's native bit order is.
    */
@@ -145,79 +288,81 @@ convert_ximage_to_rgba32 (Screen *screen, XImage *image)
       Colormap cmap = DefaultColormapOfScreen (screen);
       int ncolors = visual_cells (screen, visual);
       int i;
-      colors = (XColor *) calloc (sizeof (*colors), ncolors+1);
+      c.colors = (XColor *) calloc (sizeof (*c.colors), ncolors+1);
       for (i = 0; i < ncolors; i++)
-        colors[i].pixel = i;
-      XQueryColors (dpy, cmap, colors, ncolors);
+        c.colors[i].pixel = i;
+      XQueryColors (dpy, cmap, c.colors, ncolors);
     }
 
-  if (colors == 0)  /* truecolor */
+  if (c.colors == 0)  /* truecolor */
     {
-      srmsk = to->red_mask;
-      sgmsk = to->green_mask;
-      sbmsk = to->blue_mask;
+      c.srmsk = to->red_mask;
+      c.sgmsk = to->green_mask;
+      c.sbmsk = to->blue_mask;
 
-      decode_mask (srmsk, &srpos, &srsiz);
-      decode_mask (sgmsk, &sgpos, &sgsiz);
-      decode_mask (sbmsk, &sbpos, &sbsiz);
+      decode_mask (c.srmsk, &c.srpos, &srsiz);
+      decode_mask (c.sgmsk, &c.sgpos, &sgsiz);
+      decode_mask (c.sbmsk, &c.sbpos, &sbsiz);
     }
 
   /* Pack things in "RGBA" order in client endianness. */
   if (bigendian())
-    crpos = 24, cgpos = 16, cbpos =  8, capos =  0;
+    c.crpos = 24, c.cgpos = 16, c.cbpos =  8, c.capos =  0;
   else
-    crpos =  0, cgpos =  8, cbpos = 16, capos = 24;
+    c.crpos =  0, c.cgpos =  8, c.cbpos = 16, c.capos = 24;
 
-  if (colors == 0)  /* truecolor */
+  if (c.colors == 0 &&  /* truecolor */
+      (srsiz != 8 || sgsiz != 8 || sbsiz != 8))
     {
       int i;
+      c.spread_p = True;
       for (i = 0; i < 256; i++)
         {
-          spread_map[0][i] = spread_bits (i, srsiz);
-          spread_map[1][i] = spread_bits (i, sgsiz);
-          spread_map[2][i] = spread_bits (i, sbsiz);
+          c.spread_map[0][i] = spread_bits (i, srsiz);
+          c.spread_map[1][i] = spread_bits (i, sgsiz);
+          c.spread_map[2][i] = spread_bits (i, sbsiz);
         }
     }
 
   /* trying to track down an intermittent crash in ximage_putpixel_32 */
   if (to->width  < from->width)  abort();
-  if (to->height < from->height) abort();
-
-  for (y = 0; y < from->height; y++)
-    for (x = 0; x < from->width; x++)
-      {
-        unsigned long sp = XGetPixel (from, x, y);
-        unsigned char sr, sg, sb;
-        unsigned long cp;
+  if (y < 0 || y + to->height > from->height) abort();
 
-        if (colors)
-          {
-            sr = colors[sp].red   & 0xFF;
-            sg = colors[sp].green & 0xFF;
-            sb = colors[sp].blue  & 0xFF;
-          }
-        else
-          {
-            sr = (sp & srmsk) >> srpos;
-            sg = (sp & sgmsk) >> sgpos;
-            sb = (sp & sbmsk) >> sbpos;
+  if (to->width * to->height >= PARALLEL_PIXELS &&
+      converter_threads.state == 0)
+    {
+      static const struct threadpool_class cls = {
+        sizeof (struct converter_thread),
+        converter_thread_create,
+        0
+      };
+      converter_threads.state =
+        (threadpool_create (&converter_threads.pool, &cls, dpy,
+                            hardware_concurrency (dpy))
+         ? -1 : 1);
+    }
 
-            sr = spread_map[0][sr];
-            sg = spread_map[1][sg];
-            sb = spread_map[2][sb];
-          }
+  if (to->width * to->height >= PARALLEL_PIXELS &&
+      converter_threads.state == 1)
+    {
+      converter_threads.job = &c;
+      threadpool_run (&converter_threads.pool, converter_thread_run);
+      threadpool_wait (&converter_threads.pool);
+      converter_threads.job = 0;
+    }
+  else
+    convert_rows (&c, 0, to->height);
 
-        cp = ((sr << crpos) |
-              (sg << cgpos) |
-              (sb << cbpos) |
-              (0xFF << capos));
+  if (c.colors) free (c.colors);
 
-        XPutPixel (to, x, y, cp);
-      }
+  return to;
+}
 
-  if (colors) free (colors);
 
-  return to;
+static XImage *
+convert_ximage_to_rgba32 (Screen *screen, XImage *image)
+{
+  return convert_ximage_rows (screen, image, 0, image->height);
 }
 
 #endif /* REFORMAT_IMAGE_DATA */
@@ -256,9 +401,20 @@ halve_image (XImage *ximage, XRectangle *geom)
       exit (1);
     }
 
-  for (y = 0; y < h2; y++)
-    for (x = 0; x < w2; x++)
-      XPutPixel (ximage2, x, y, XGetPixel (ximage, x*2, y*2));
+  if (ximage->bits_per_pixel == 32)
+    for (y = 0; y < h2; y++)
+      {
+        const uint32_t *in = (const uint32_t *)
+          (ximage->data + y * 2 * ximage->bytes_per_line);
+        uint32_t *out = (uint32_t *)
+          (ximage2->data + y * ximage2->bytes_per_line);
+        for (x = 0; x < w2; x++)
+          out[x] = in[x*2];
+      }
+  else
+    for (y = 0; y < h2; y++)
+      for (x = 0; x < w2; x++)
+        XPutPixel (ximage2, x, y, XGetPixel (ximage, x*2, y*2));
 
   free (ximage->data);
   *ximage = *ximage2;
@@ -477,6 +633,7 @@ struct texture_loader_t {
   XRectangle geometry;
   int y;
   unsigned int stripe_height;
+  Bool gpu_mipmaps_p;
   char *name;
 
   /* debugging */
@@ -503,6 +660,31 @@ double_time (void)
 }
 
 
+/* Whether glGenerateMipmap can build the mipmaps of a texture of any size
+   on the GPU, rather than gluBuild2DMipmaps scaling and filtering every
+   level on the CPU.  That's OpenGL 3.0, or 2.0 plus the FBO extension.
+ */
+static Bool
+gpu_mipmaps_p (void)
+{
+# ifdef GENERATE_MIPMAPS
+  const char *s = (const char *) glGetString (GL_VERSION);
+  int maj = 0, min = 0;
+  if (!s || 2 != sscanf (s, "%d.%d", &maj, &min))
+    return False;
+  if (maj >= 3)
+    return True;
+  if (maj == 2)
+    {
+      s = (const char *) glGetString (GL_EXTENSIONS);
+      return (s && (strstr (s, "GL_ARB_framebuffer_object") ||
+                    strstr (s, "GL_EXT_framebuffer_object")));
+    }
+# endif /* GENERATE_MIPMAPS */
+  return False;
+}
+
+
 /* Loads the given XImage into GL's texture memory.
    The image may be of any size.
    If mipmap_p is true, then make mipmaps instead of just a single texture.
@@ -533,12 +715,30 @@ ximage_to_texture (XImage *ximage,
       tex_height = ximage->height;
 
       if (debug_p)
-        fprintf (stderr, "%s: mipmap %d x %d\n",
-                 progname, ximage->width, ximage->height);
+        fprintf (stderr, "%s: mipmap %d x %d%s\n",
+                 progname, ximage->width, ximage->height,
+                 (gpu_mipmaps_p() ? " (GPU)" : ""));
 
-      gluBuild2DMipmaps (GL_TEXTURE_2D, 3, ximage->width, ximage->height,
-                         format, type, ximage->data);
-      err = glGetError();
+# ifdef GENERATE_MIPMAPS
+      if (gpu_mipmaps_p())
+        {
+          glTexImage2D (GL_TEXTURE_2D, 0, GL_RGB,
+                        ximage->width, ximage->height, 0,
+                        format, type, ximage->data);
+          err = glGetError();
+          if (!err)
+            {
+              glGenerateMipmap (GL_TEXTURE_2D);
+              err = glGetError();
+            }
+        }
+      else
+# endif /* GENERATE_MIPMAPS */
+        {
+          gluBuild2DMipmaps (GL_TEXTURE_2D, 3, ximage->width, ximage->height,
+                             format, type, ximage->data);
+          err = glGetError();
+        }
     }
   else
     {
@@ -981,6 +1181,8 @@ incremental_load_texture_async_cb (Screen *screen, Window window,
     return;
   }
 
+  loader->gpu_mipmaps_p = gpu_mipmaps_p();
+
   /* Capture texture dimensions and name in loader */
   loader->tex_width = tex_width;
   loader->tex_height = tex_height;
@@ -1071,31 +1273,26 @@ advance_texture_loader (texture_loader_t *loader, double allowed_seconds)
   )
   {
     /*
-        * Use XSubImage() to extract a section of the shared image
-          loader->stripe_height tall
-        * Use convert_ximage_to_rgba32() to convert that to the desired format
-        * Use XDestroyImage() to free the extracted section of the shared image
+        * Use convert_ximage_rows() to convert the next
+          loader->stripe_height rows of the shared image to the desired format
         * glBindTexture(GL_TEXTURE_2D, loader->load_closure.texid)
         * Import the data to the next stripe of the texture with glTexSubImage2D()
         * XDestroyImage() to destroy the converted image
         * Increment loader->y by loader->stripe_height
      */
     unsigned int patch_height = texture_loader_next_stripe_height (loader);
-    XImage* patch = XSubImage (loader->ximage,
-                               0, loader->y,
-                               loader->img_width, patch_height);
-    XImage* cvt_patch = convert_ximage_to_rgba32 (loader->screen, patch);
+    XImage* cvt_patch = convert_ximage_rows (loader->screen, loader->ximage,
+                                             loader->y, patch_height);
     Bool use_old_mipmap_p = False;
 # ifdef GENERATE_MIPMAPS
     use_old_mipmap_p = (loader->load_closure.mipmap_p &&
+                        !loader->gpu_mipmaps_p &&
                         (loader->y + loader->stripe_height >=
                          loader->ximage->height));
 # endif
 
     loader->stripes++;
 
-    XDestroyImage (patch);
-
     glBindTexture (GL_TEXTURE_2D, loader->load_closure.texid);
     glPixelStorei (GL_UNPACK_ALIGNMENT, cvt_patch->bitmap_pad / 8);
 
@@ -1169,7 +1366,8 @@ complete_texture_load (texture_loader_t *loader,
     {
       glBindTexture (GL_TEXTURE_2D, loader->load_closure.texid);
 # ifdef GENERATE_MIPMAPS
-      glGenerateMipmap (GL_TEXTURE_2D);
+      if (loader->gpu_mipmaps_p)
+        glGenerateMipmap (GL_TEXTURE_2D);
 # endif
     }
 
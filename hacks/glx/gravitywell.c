@@ -14,20 +14,31 @@
 			"*gridColor:    #00FF00\n" \
 			"*gridColor2:   #FF0000\n" \
 			"*showFPS:      False  \n" \
-			"*wireframe:    False  \n"
+			"*wireframe:    False  \n" \
+			THREAD_DEFAULTS_XLOCK
 
 # define release_gw 0
 
 #define DEF_SPEED      "1.0"
 #define DEF_RESOLUTION "1.0"
 #define DEF_GRID_SIZE  "1.0"
+#define DEF_SHADERS    "True"
 
 #include "xlockmore.h"
 #include "gltrackball.h"
 #include "colors.h"
 #include "hsv.h"
+#include "thread_util.h"
 
 #include <ctype.h>
+#include <errno.h>
+
+/* The vertex shader path needs the compatibility profile's matrices and
+   fog, so not on GLES. */
+#if defined(HAVE_GLSL) && !defined(HAVE_JWZGLES)
+# define USE_SHADERS
+# include "glsl-utils.h"
+#endif
 
 #define ASSERT(x)
 
@@ -48,17 +59,44 @@ typedef struct {
   int nstars;
   star *stars;
   int grid_w, grid_h;
-  GLfloat *grid;
-  char *segs;
-  GLfloat *vtx, *col;
+  int gridmod;
+  int nrows, nrows_h;		/* the lines across the grid, then the ones
+                                   down it */
+  int *row_first, *row_count;	/* each line's vertices */
   GLfloat color[4];
   int ncolors;
   XColor *colors;
+  GLfloat *palette;		/* the colors as RGBA floats */
+  short *color_table;		/* see color_index() */
+  int sample_x, sample_y;
+  GLfloat sample_z;
+
+  struct threadpool threadpool;
+  struct gw_thread **threads;
+
+# ifdef USE_SHADERS
+  Bool use_shaders;
+  GLuint shader_program, position_buffer, palette_texture;
+  GLint position_index, stars_index, nstars_index;
+  GLint palette_index, fog_density_index;
+  GLfloat *star_uniforms;
+# endif
 } gw_configuration;
 
+/* Each thread computes a run of the lines into its own vertex arrays. */
+struct gw_thread {
+  gw_configuration *bp;
+  unsigned id;
+  GLfloat *grid;		/* depth along one line, GRID_SEG per cell */
+  char *segs;			/* which cells of that line are high-res */
+  GLfloat *vtx, *col;
+  int nverts, size;
+};
+
 static gw_configuration *bps = NULL;
 
 static GLfloat speed, resolution, grid_size;
+static Bool shaders_p;
 
 #define RESOLUTION_BASE 512
 #define GRID_SIZE_BASE  7
@@ -67,17 +105,25 @@ static GLfloat speed, resolution, grid_size;
 #define SLOPE_EPSILON   0.06
 #define GRID_SEG        16u /* Power-of-two here is faster. */
 #define MAX_MASS_COLOR  120
+#define FOG_DENSITY     0.005
+#define CALC_M_LANES    8
+#define COLOR_TABLE_RES 16	/* steps per unit of depth */
+#define COLOR_TABLE_SIZE (4 * MAX_MASS_COLOR * COLOR_TABLE_RES)
 
 static XrmOptionDescRec opts[] = {
   { "-speed",      ".speed",      XrmoptionSepArg, 0 },
   { "-resolution", ".resolution", XrmoptionSepArg, 0 },
   { "-grid-size",  ".gridSize",   XrmoptionSepArg, 0 },
+  { "-shaders",    ".shaders",    XrmoptionNoArg, "True"  },
+  { "-no-shaders", ".shaders",    XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
   {&speed,      "speed",      "Speed",      DEF_SPEED,      t_Float},
   {&resolution, "resolution", "Resolution", DEF_RESOLUTION, t_Float},
   {&grid_size,  "gridSize",   "GridSize",   DEF_GRID_SIZE,  t_Float},
+  {&shaders_p,  "shaders",    "Shaders",    DEF_SHADERS,    t_Bool},
 };
 
 ENTRYPOINT ModeSpecOpt gw_opts = {
@@ -208,42 +254,49 @@ move_stars (ModeInfo *mi)
 }
 
 
+/* Adds a straight line from g0 to g1 across one high-res cell.  Like the
+   loops in make_hires() and calc_m_run(), this has a fixed trip count and
+   no running sum, so that it vectorizes.
+ */
+static void
+ramp_add (GLfloat *g, GLfloat g0, GLfloat g1)
+{
+  GLfloat d = (g1 - g0) / GRID_SEG;
+  int i;
+  for (i = 0; i < GRID_SEG; i++)
+    g[i] += g0 + d * i;
+}
+
+
 static void
-calc_o (gw_configuration *bp, GLfloat mass, GLfloat cx, GLfloat y02,
+calc_o (struct gw_thread *t, GLfloat mass, GLfloat cx, GLfloat y02,
         unsigned from, unsigned to)
 {
   GLfloat x0 = cx - from * GRID_SEG;
   GLfloat g0 = mass / (x0*x0 + y02);
   unsigned x;
 
-  ASSERT (to <= bp->grid_w || to <= bp->grid_h);
+  ASSERT (to <= t->bp->grid_w || to <= t->bp->grid_h);
 
   for (x = from; x < to; x++)
     {
-      GLfloat *g = &bp->grid[x * GRID_SEG];
+      GLfloat *g = &t->grid[x * GRID_SEG];
       GLfloat g1;
 
       x0 = cx - (x + 1) * GRID_SEG;
       g1 = mass / (x0*x0 + y02);
 
-      g[0] += g0;
-      if (bp->segs[x])
-        {
-          GLfloat d = (g1 - g0) / GRID_SEG;
-          unsigned i;
-          for(i = 1; i != GRID_SEG; i++)
-            {
-              g0 += d;
-              g[i] += g0;
-            }
-        }
+      if (t->segs[x])
+        ramp_add (g, g0, g1);
+      else
+        g[0] += g0;
       g0 = g1;
     }
 }
 
 
 static void
-make_hires (gw_configuration *bp, unsigned from, unsigned to, unsigned w)
+make_hires (struct gw_thread *t, unsigned from, unsigned to, unsigned w)
 {
   unsigned x;
 
@@ -257,37 +310,50 @@ make_hires (gw_configuration *bp, unsigned from, unsigned to, unsigned w)
   from = MIN(from / GRID_SEG, w - 1);
   to = MIN(to / GRID_SEG + 1, w - 1);
 
-  ASSERT (to <= bp->grid_w - 1 || to <= bp->grid_h - 1);
+  ASSERT (to <= t->bp->grid_w - 1 || to <= t->bp->grid_h - 1);
 
   for (x = from; x < to; x++)
     {
-      if (! bp->segs[x])
+      if (! t->segs[x])
         {
-          GLfloat *g = &bp->grid[x * GRID_SEG];
+          GLfloat *g = &t->grid[x * GRID_SEG];
           GLfloat g0 = g[0], g1 = g[GRID_SEG];
           GLfloat d = (g1 - g0) / GRID_SEG;
-          unsigned i;
-          for (i = 1; i != GRID_SEG; i++)
-            {
-              g0 += d;
-              g[i] = g0;
-            }
-          bp->segs[x] = True;
+          int i;
+          for (i = 0; i < GRID_SEG; i++)
+            g[i] = g0 + d * i;
+          t->segs[x] = True;
         }
     }
 }
 
 
 static void
-calc_m (gw_configuration *bp, GLfloat mass, GLfloat cx, GLfloat y02,
+calc_m_run (GLfloat *g, GLfloat mass, GLfloat cx, GLfloat y02, int x)
+{
+  int i;
+  for (i = 0; i < CALC_M_LANES; i++)
+    {
+      GLfloat x0 = cx - (x + i);
+      g[i] += mass / (x0*x0 + y02);
+    }
+}
+
+
+static void
+calc_m (struct gw_thread *t, GLfloat mass, GLfloat cx, GLfloat y02,
         unsigned from, unsigned to)
 {
-  GLfloat *gridp = bp->grid;
+  GLfloat *gridp = t->grid;
   unsigned x;
 
-  ASSERT (to <= bp->grid_w * GRID_SEG + 1 || to <= bp->grid_h * GRID_SEG + 1);
+  ASSERT (to <= t->bp->grid_w * GRID_SEG + 1 ||
+          to <= t->bp->grid_h * GRID_SEG + 1);
 
-  for (x = from; x < to; x++)
+  for (x = from; x + CALC_M_LANES <= to; x += CALC_M_LANES)
+    calc_m_run (gridp + x, mass, cx, y02, x);
+
+  for (; x < to; x++)
     {
       /* Inverse square of distance from mass as a point source */
       GLfloat x0 = cx - x;
@@ -298,24 +364,52 @@ calc_m (gw_configuration *bp, GLfloat mass, GLfloat cx, GLfloat y02,
 
 #define EASE(r) (sin ((r) * M_PI_2))
 
+static int
+ramp_index (int ncolors, GLfloat z)
+{
+  int ci = EASE (z / MAX_MASS_COLOR) * ncolors;
+  if (ci < 0) ci = 0;
+  if (ci >= ncolors) ci = ncolors - 1;
+  return ci;
+}
+
+
+/* The same as ramp_index(), without a sin() per vertex.  Over one period
+   of the sine the index only goes up or down between its turns at 120
+   and 360, and those land on steps of the table; so where both ends of a
+   step have the same index, so does everything in between.  The other
+   steps are -1.
+ */
+static int
+color_index (const gw_configuration *bp, GLfloat z)
+{
+  if (z >= 0 && z < COLOR_TABLE_SIZE / COLOR_TABLE_RES)
+    {
+      int ci = bp->color_table[(int) (z * COLOR_TABLE_RES)];
+      if (ci >= 0) return ci;
+    }
+  return ramp_index (bp->ncolors, z);
+}
+
+
+/* Computes the depth of the grid along the line at y, or down the column
+   at y if swap, into t->grid.
+ */
 static void
-draw_row (ModeInfo *mi, int w, int y, Bool swap)
+calc_row (struct gw_thread *t, int w, int y, Bool swap)
 {
-  gw_configuration *bp = &bps[MI_SCREEN(mi)];
+  const gw_configuration *bp = t->bp;
   int i;
-  int x;
-  int polys;
+  unsigned x;
   int w2 = w * GRID_SEG;
+  GLfloat *gridp = t->grid;
 
-  GLfloat *vtx_x;
-  GLfloat *vtx_y;
-  GLfloat *gridp = bp->grid;
   memset (gridp, 0, w2 * sizeof(*gridp));
-  memset (bp->segs, 0, w);
+  memset (t->segs, 0, w);
 
   for (i = 0; i < bp->nstars; i++)
     {
-      star *s = &bp->stars[i];
+      const star *s = &bp->stars[i];
       GLfloat cx, cy;
       unsigned olo, ohi, mlo, mhi, ilo, ihi;
       GLfloat mass, max;
@@ -364,125 +458,422 @@ draw_row (ModeInfo *mi, int w, int y, Bool swap)
           mhi -= mhi % GRID_SEG;
 
           /* These go first. */
-          make_hires (bp, mlo, ilo, w);
-          make_hires (bp, ihi, mhi, w);
+          make_hires (t, mlo, ilo, w);
+          make_hires (t, ihi, mhi, w);
 
-          calc_m (bp, mass, cx, y02, mlo, ilo);
-          calc_m (bp, mass, cx, y02, ihi, mhi);
+          calc_m (t, mass, cx, y02, mlo, ilo);
+          calc_m (t, mass, cx, y02, ihi, mhi);
 
           /* This does a bit more work than it needs to. */
           for (x = ilo; x < ihi; x++)
             gridp[x] += max;
         }
 
-      calc_o (bp, mass, cx, y02, olo, mlo / GRID_SEG);
-      calc_o (bp, mass, cx, y02, mhi / GRID_SEG, ohi);
+      calc_o (t, mass, cx, y02, olo, mlo / GRID_SEG);
+      calc_o (t, mass, cx, y02, mhi / GRID_SEG, ohi);
     }
+}
+
+
+/* Appends the vertices and colors of the line that calc_row() just did
+   to the thread's arrays, and returns how many there are.
+ */
+static int
+emit_row (struct gw_thread *t, int w, int y, Bool swap)
+{
+  const gw_configuration *bp = t->bp;
+  const GLfloat *gridp = t->grid;
+  int vx = swap ? 1 : 0;
+  int vy = 1 - vx;
+  GLfloat *vtx, *col;
+  int x, i, polys;
 
-  if (swap)
+  if (t->nverts + w * GRID_SEG > t->size)
     {
-      vtx_y = bp->vtx;
-      vtx_x = bp->vtx + 1;
+      int size = t->size ? t->size : 4096;
+      while (size < t->nverts + w * GRID_SEG)
+        size *= 2;
+      t->vtx = (GLfloat *) realloc (t->vtx, size * 3 * sizeof(*t->vtx));
+      t->col = (GLfloat *) realloc (t->col, size * 4 * sizeof(*t->col));
+      if (! t->vtx || ! t->col) abort();
+      t->size = size;
     }
-  else
+
+  vtx = t->vtx + t->nverts * 3;
+  col = t->col + t->nverts * 4;
+
+  ASSERT (! t->segs[w - 1]);
+
+  polys = 0;
+  for (x = 0; x != w; x++)
     {
-      vtx_x = bp->vtx;
-      vtx_y = bp->vtx + 1;
+      int lo = x * GRID_SEG;
+      int hi = lo + (t->segs[x] ? GRID_SEG : 1);
+      for (i = lo; i < hi; i++)
+        {
+          GLfloat z = gridp[i];
+          memcpy (col, bp->palette + color_index (bp, z) * 4,
+                  4 * sizeof(*col));
+          vtx[vx] = i;
+          vtx[vy] = y; /* + random() * (MASS_EPSILON / (MAXRAND)); */
+          vtx[2] = z;
+          vtx += 3;
+          col += 4;
+        }
+      polys += hi - lo;
     }
 
-# define COLOR_CODE 0
+  t->nverts += polys;
+  return polys;
+}
+
 
-# if COLOR_CODE
-  {
-    unsigned grid_max = bp->grid_w > bp->grid_h ? bp->grid_w : bp->grid_h;
-    GLfloat *color = malloc(sizeof(GLfloat) * 4 * (grid_max * GRID_SEG + 1));
-    glEnableClientState (GL_COLOR_ARRAY);
-    glColorPointer (4, GL_FLOAT, 0, color);
-# endif
+/* Line r is y = r * gridmod across the grid, or after nrows_h of those,
+   x = (r - nrows_h) * gridmod down it.
+ */
+static void
+row_position (const gw_configuration *bp, int r, int *w, int *y, Bool *swap)
+{
+  *swap = (r >= bp->nrows_h);
+  if (*swap) r -= bp->nrows_h;
+  *y = r * bp->gridmod;
+  *w = *swap ? bp->grid_h : bp->grid_w;
+}
 
-  ASSERT (! bp->segs[w - 1]);
 
-  polys = 0;
-  for (x = 0; x != w; x++)
+/* This thread's share of the lines: [*r0, *r1). */
+static void
+gw_thread_rows (const struct gw_thread *t, int *r0, int *r1)
+{
+  unsigned count = t->bp->threadpool.count;
+  *r0 = t->bp->nrows * t->id / count;
+  *r1 = t->bp->nrows * (t->id + 1) / count;
+}
+
+
+static void
+gw_thread_run (void *self)
+{
+  struct gw_thread *t = (struct gw_thread *) self;
+  gw_configuration *bp = t->bp;
+  int r, r0, r1;
+
+  gw_thread_rows (t, &r0, &r1);
+  t->nverts = 0;
+  for (r = r0; r < r1; r++)
     {
-      if (! bp->segs[x])
+      int w, y;
+      Bool swap;
+      row_position (bp, r, &w, &y, &swap);
+      calc_row (t, w, y, swap);
+      if (swap && y == bp->sample_x)
+        bp->sample_z = t->grid[bp->sample_y];
+      bp->row_first[r] = t->nverts;
+      bp->row_count[r] = emit_row (t, w, y, swap);
+    }
+}
+
+
+static int
+gw_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct gw_thread *t = (struct gw_thread *) self;
+  unsigned grid_max;
+  gw_configuration *bp = GET_PARENT_OBJ (gw_configuration, threadpool, pool);
+
+  grid_max = MAX (bp->grid_w, bp->grid_h);
+  memset (t, 0, sizeof(*t));
+  t->bp = bp;
+  t->id = id;
+  t->grid = (GLfloat *) calloc (grid_max * GRID_SEG, sizeof(*t->grid));
+  t->segs = (char *) calloc (grid_max, sizeof(*t->segs));
+  if (! t->grid || ! t->segs)
+    {
+      if (t->grid) free (t->grid);
+      return ENOMEM;
+    }
+  bp->threads[id] = t;
+  return 0;
+}
+
+
+static void
+gw_thread_destroy (void *self)
+{
+  struct gw_thread *t = (struct gw_thread *) self;
+  free (t->grid);
+  free (t->segs);
+  if (t->vtx) free (t->vtx);
+  if (t->col) free (t->col);
+}
+
+
+/* Computes the lines on the threads, then draws them from here.
+ */
+static void
+draw_grid (ModeInfo *mi)
+{
+  gw_configuration *bp = &bps[MI_SCREEN(mi)];
+  unsigned i;
+
+  bp->sample_z = -1;
+  threadpool_run (&bp->threadpool, gw_thread_run);
+  threadpool_wait (&bp->threadpool);
+
+  glEnableClientState (GL_COLOR_ARRAY);
+  glEnableClientState (GL_VERTEX_ARRAY);
+
+  for (i = 0; i < bp->threadpool.count; i++)
+    {
+      const struct gw_thread *t = bp->threads[i];
+      int r, r0, r1;
+      gw_thread_rows (t, &r0, &r1);
+      glColorPointer  (4, GL_FLOAT, 0, t->col);
+      glVertexPointer (3, GL_FLOAT, 0, t->vtx);
+      for (r = r0; r < r1; r++)
         {
-          int ci;
-          size_t vp = polys * 3;
-          size_t cp = polys * 4;
-# if COLOR_CODE
-          GLfloat slope = 0;
-          if (x != 0)
-            slope += fabs(gridp[x * GRID_SEG] - gridp[(x - 1) * GRID_SEG]);
-          if (x != w - 1)
-            slope += fabs(gridp[(x + 1) * GRID_SEG] - gridp[x * GRID_SEG]);
-          slope = 1 - (slope / (SLOPE_EPSILON * 2));
-
-          color[cp]     = slope;
-          color[cp + 1] = slope;
-          color[cp + 2] = 1;
-          color[cp + 3] = 1;
-# endif
-          vtx_x[vp] = x * GRID_SEG;
-          bp->vtx[vp + 2] = gridp[x * GRID_SEG];
-          polys += 1;
-
-          ci = EASE (bp->vtx[vp + 2] / MAX_MASS_COLOR) * bp->ncolors;
-          if (ci < 0) ci = 0;
-          if (ci >= bp->ncolors) ci = bp->ncolors - 1;
-          bp->col[cp]   = bp->colors[ci].red   / 65536.0;
-          bp->col[cp+1] = bp->colors[ci].green / 65536.0;
-          bp->col[cp+2] = bp->colors[ci].blue  / 65536.0;
-          bp->col[cp+3] = 1;
+          mi->polygon_count += bp->row_count[r];
+          glDrawArrays (GL_LINE_STRIP, bp->row_first[r], bp->row_count[r]);
         }
-      else
+    }
+
+  glDisableClientState (GL_COLOR_ARRAY);
+  glDisableClientState (GL_VERTEX_ARRAY);
+}
+
+
+#ifdef USE_SHADERS
+
+/* The shaders draw the same lines from a fixed buffer of (x, y) points,
+   and add up the stars' pull at every one of them on the GPU.  That's
+   every point at full resolution with the exact field, where the CPU
+   skips ahead and interpolates away from the stars; the difference is
+   smaller than the lines are wide.  Stars[] is MAX_SHADER_STARS long.
+ */
+#define MAX_SHADER_STARS 64
+
+static const GLchar *vertex_shader_source =
+  "#version 120\n"
+  "\n"
+  "const float MassEpsilon = 0.03;\n"
+  "const float MaxMassColor = 120.0;\n"
+  "\n"
+  "uniform vec4 Stars[64];\n"	/* x, y, mass, radius squared */
+  "uniform int NStars;\n"
+  "\n"
+  "attribute vec2 Position;\n"
+  "\n"
+  "varying float Ramp;\n"
+  "varying float FogDepth;\n"
+  "\n"
+  "void main (void)\n"
+  "{\n"
+  "  float z = 0.0;\n"
+  "  for (int i = 0; i < 64; i++)\n"
+  "    {\n"
+  "      if (i >= NStars) break;\n"
+  "      vec2 d = Position - Stars[i].xy;\n"
+  "      float d2 = dot (d, d);\n"
+  "      float mass = Stars[i].z;\n"
+  "      if (d2 < Stars[i].w)\n"
+  "        z += mass / Stars[i].w;\n"
+  "      else if (d2 < mass / MassEpsilon)\n"
+  "        z += mass / d2;\n"
+  "    }\n"
+  "  vec4 eye = gl_ModelViewMatrix * vec4 (Position, z, 1.0);\n"
+  "  gl_Position = gl_ProjectionMatrix * eye;\n"
+  "  Ramp = sin (z / MaxMassColor * 1.5707963);\n"
+  "  FogDepth = abs (eye.z);\n"
+  "}\n";
+
+/* The palette is a GL_NEAREST texture, which picks the same color as
+   ramp_index(). */
+static const GLchar *fragment_shader_source =
+  "#version 120\n"
+  "\n"
+  "uniform sampler1D Palette;\n"
+  "uniform float FogDensity;\n"
+  "\n"
+  "varying float Ramp;\n"
+  "varying float FogDepth;\n"
+  "\n"
+  "void main (void)\n"
+  "{\n"
+  "  float f = FogDensity * FogDepth;\n"
+  "  vec3 color = texture1D (Palette, Ramp).rgb;\n"
+  "  gl_FragColor = vec4 (mix (gl_Fog.color.rgb, color,\n"
+  "                            clamp (exp (-f * f), 0.0, 1.0)),\n"
+  "                       1.0);\n"
+  "}\n";
+
+
+static void
+init_shaders (ModeInfo *mi)
+{
+  gw_configuration *bp = &bps[MI_SCREEN(mi)];
+  GLint gl_major, gl_minor, glsl_major, glsl_minor;
+  GLboolean gl_gles3;
+  GLfloat *pts, *p;
+  int r, i, n;
+
+  bp->use_shaders = False;
+  if (! shaders_p || bp->nstars > MAX_SHADER_STARS)
+    return;
+
+  if (!glsl_GetGlAndGlslVersions(&gl_major,&gl_minor,&glsl_major,&glsl_minor,
+                                 &gl_gles3))
+    return;
+  if (gl_gles3 ||
+      (gl_major < 2 || (gl_major == 2 && gl_minor < 1)) ||
+      (glsl_major < 1 || (glsl_major == 1 && glsl_minor < 20)))
+    return;
+
+  if (!glsl_CompileAndLinkShaders(1, &vertex_shader_source,
+                                  1, &fragment_shader_source,
+                                  &bp->shader_program))
+    return;
+  bp->position_index = glGetAttribLocation (bp->shader_program, "Position");
+  bp->stars_index = glGetUniformLocation (bp->shader_program, "Stars");
+  bp->nstars_index = glGetUniformLocation (bp->shader_program, "NStars");
+  bp->palette_index = glGetUniformLocation (bp->shader_program, "Palette");
+  bp->fog_density_index = glGetUniformLocation (bp->shader_program,
+                                                "FogDensity");
+  if (bp->position_index == -1 || bp->stars_index == -1 ||
+      bp->nstars_index == -1 || bp->palette_index == -1 ||
+      bp->fog_density_index == -1)
+    {
+      glDeleteProgram (bp->shader_program);
+      return;
+    }
+
+  bp->star_uniforms = (GLfloat *)
+    calloc (bp->nstars * 4, sizeof(*bp->star_uniforms));
+  if (! bp->star_uniforms) abort();
+
+  glGenTextures (1, &bp->palette_texture);
+  glBindTexture (GL_TEXTURE_1D, bp->palette_texture);
+  glTexParameteri (GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri (GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  glTexParameteri (GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexImage1D (GL_TEXTURE_1D, 0, GL_RGBA, bp->ncolors, 0,
+                GL_RGBA, GL_FLOAT, bp->palette);
+  glBindTexture (GL_TEXTURE_1D, 0);
+
+  /* Every line at full resolution, each from 0 to (w-1) * GRID_SEG
+     inclusive like the CPU's. */
+  n = 0;
+  for (r = 0; r < bp->nrows; r++)
+    {
+      int w, y;
+      Bool swap;
+      row_position (bp, r, &w, &y, &swap);
+      bp->row_first[r] = n;
+      bp->row_count[r] = (w - 1) * GRID_SEG + 1;
+      n += bp->row_count[r];
+    }
+
+  pts = (GLfloat *) malloc (n * 2 * sizeof(*pts));
+  if (! pts) abort();
+  p = pts;
+  for (r = 0; r < bp->nrows; r++)
+    {
+      int w, y;
+      Bool swap;
+      row_position (bp, r, &w, &y, &swap);
+      for (i = 0; i < bp->row_count[r]; i++, p += 2)
         {
-          for(i = 0; i != GRID_SEG; i++)
-            {
-              int ci;
-              size_t vp = (polys + i) * 3;
-              size_t cp = (polys + i) * 4;
-# if COLOR_CODE
-              color[cp] = 1;
-              color[cp + 1] = 0.75;
-              color[cp + 2] = 0;
-              color[cp + 3] = 1;
-# endif
-              vtx_x[vp] = x * GRID_SEG + i;
-              bp->vtx[vp + 2] = gridp[x * GRID_SEG + i];
-
-              ci = EASE (bp->vtx[vp + 2] / MAX_MASS_COLOR) * bp->ncolors;
-              if (ci < 0) ci = 0;
-              if (ci >= bp->ncolors) ci = bp->ncolors - 1;
-              bp->col[cp]   = bp->colors[ci].red   / 65536.0;
-              bp->col[cp+1] = bp->colors[ci].green / 65536.0;
-              bp->col[cp+2] = bp->colors[ci].blue  / 65536.0;
-              bp->col[cp+3] = 1;
-            }
-          polys += GRID_SEG;
+          p[swap ? 1 : 0] = i;
+          p[swap ? 0 : 1] = y;
         }
     }
 
-  for (i = 0; i < polys; i++)
-    vtx_y[i * 3] = y; /* + random() * (MASS_EPSILON / (MAXRAND)); */
+  glGenBuffers (1, &bp->position_buffer);
+  glBindBuffer (GL_ARRAY_BUFFER, bp->position_buffer);
+  glBufferData (GL_ARRAY_BUFFER, n * 2 * sizeof(*pts), pts, GL_STATIC_DRAW);
+  glBindBuffer (GL_ARRAY_BUFFER, 0);
+  free (pts);
 
-  mi->polygon_count += polys;
-  glDrawArrays (GL_LINE_STRIP, 0, polys);
+  bp->use_shaders = True;
+}
 
-# if COLOR_CODE
-    glDisableClientState (GL_COLOR_ARRAY);
-    free (color);
-  }
-# endif
+
+/* What the vertex shader computes at one point. */
+static GLfloat
+shader_depth (const gw_configuration *bp, GLfloat x, GLfloat y)
+{
+  GLfloat z = 0;
+  int i;
+  for (i = 0; i < bp->nstars; i++)
+    {
+      const star *s = &bp->stars[i];
+      GLfloat d2 = (x - s->x) * (x - s->x) + (y - s->y) * (y - s->y);
+      if (d2 < s->ri2)
+        z += s->surface_gravity;
+      else if (d2 < s->mass / MASS_EPSILON)
+        z += s->mass / d2;
+    }
+  return z;
 }
 
 
+static void
+draw_grid_shaders (ModeInfo *mi)
+{
+  gw_configuration *bp = &bps[MI_SCREEN(mi)];
+  int wire = MI_IS_WIREFRAME(mi);
+  int i, r;
+
+  for (i = 0; i < bp->nstars; i++)
+    {
+      const star *s = &bp->stars[i];
+      GLfloat *u = bp->star_uniforms + i * 4;
+      u[0] = s->x;
+      u[1] = s->y;
+      u[2] = s->mass;
+      u[3] = s->ri2;
+    }
+
+  bp->sample_z = shader_depth (bp, bp->sample_x, bp->sample_y);
+
+  glUseProgram (bp->shader_program);
+  glUniform4fv (bp->stars_index, bp->nstars, bp->star_uniforms);
+  glUniform1i (bp->nstars_index, bp->nstars);
+  glUniform1f (bp->fog_density_index, wire ? 0 : FOG_DENSITY);
+
+  glActiveTexture (GL_TEXTURE0);
+  glBindTexture (GL_TEXTURE_1D, bp->palette_texture);
+  glUniform1i (bp->palette_index, 0);
+
+  glBindBuffer (GL_ARRAY_BUFFER, bp->position_buffer);
+  glEnableVertexAttribArray (bp->position_index);
+  glVertexAttribPointer (bp->position_index, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+  for (r = 0; r < bp->nrows; r++)
+    {
+      mi->polygon_count += bp->row_count[r];
+      glDrawArrays (GL_LINE_STRIP, bp->row_first[r], bp->row_count[r]);
+    }
+
+  glDisableVertexAttribArray (bp->position_index);
+  glBindBuffer (GL_ARRAY_BUFFER, 0);
+  glBindTexture (GL_TEXTURE_1D, 0);
+  glUseProgram (0);
+}
+
+#endif /* USE_SHADERS */
+
+
 ENTRYPOINT void 
 init_gw (ModeInfo *mi)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct gw_thread),
+    gw_thread_create,
+    gw_thread_destroy
+  };
   gw_configuration *bp;
-  unsigned grid_max, vtx_max;
-  int i;
+  unsigned count;
+  int i, err;
   MI_INIT (mi, bps);
 
   bp = &bps[MI_SCREEN(mi)];
@@ -517,6 +908,24 @@ init_gw (ModeInfo *mi)
                      h1, s1, v1, h2, s2, v2,
                      bp->colors, &bp->ncolors,
                      False, 0, False);
+
+    bp->palette = (GLfloat *) calloc (bp->ncolors * 4, sizeof(*bp->palette));
+    bp->color_table = (short *)
+      calloc (COLOR_TABLE_SIZE, sizeof(*bp->color_table));
+    if (! bp->palette || ! bp->color_table) abort();
+    for (i = 0; i < bp->ncolors; i++)
+      {
+        bp->palette[i*4]   = bp->colors[i].red   / 65536.0;
+        bp->palette[i*4+1] = bp->colors[i].green / 65536.0;
+        bp->palette[i*4+2] = bp->colors[i].blue  / 65536.0;
+        bp->palette[i*4+3] = 1;
+      }
+    for (i = 0; i < COLOR_TABLE_SIZE; i++)
+      {
+        int lo = ramp_index (bp->ncolors, (GLfloat) i / COLOR_TABLE_RES);
+        int hi = ramp_index (bp->ncolors, (GLfloat) (i+1) / COLOR_TABLE_RES);
+        bp->color_table[i] = (lo == hi ? lo : -1);
+      }
   }
 
   bp->user_trackball = gltrackball_init (False);
@@ -525,13 +934,26 @@ init_gw (ModeInfo *mi)
   if (bp->grid_w < 2) bp->grid_w = 2;
   bp->grid_h = bp->grid_w;
 
-  grid_max = bp->grid_w > bp->grid_h ? bp->grid_w : bp->grid_h;
-  vtx_max = grid_max * GRID_SEG;
-  bp->grid = (GLfloat *) calloc (vtx_max, sizeof(*bp->grid));
-  bp->vtx = (GLfloat *) calloc (vtx_max * 3, sizeof(*bp->vtx));
-  bp->col = (GLfloat *) calloc (vtx_max * 4, sizeof(*bp->col));
-  bp->segs = (char *) calloc (grid_max, sizeof(*bp->segs));
-  if (! bp->grid || ! bp->vtx || ! bp->col || ! bp->segs) abort();
+  bp->gridmod = grid_size * GRID_SIZE_BASE;
+  if (bp->gridmod < 1) bp->gridmod = 1;
+  bp->nrows_h = ((bp->grid_h - 1) * GRID_SEG + bp->gridmod - 1) / bp->gridmod;
+  bp->nrows = (bp->nrows_h +
+               ((bp->grid_w - 1) * GRID_SEG + bp->gridmod - 1) / bp->gridmod);
+  bp->row_first = (int *) calloc (bp->nrows, sizeof(*bp->row_first));
+  bp->row_count = (int *) calloc (bp->nrows, sizeof(*bp->row_count));
+  if (! bp->row_first || ! bp->row_count) abort();
+
+  /* Somewhere near the midpoint of the view */
+  bp->sample_x = ((int) (bp->grid_w * GRID_SEG * 0.5)  / bp->gridmod)
+    * bp->gridmod;
+  bp->sample_y = ((int) (bp->grid_h * GRID_SEG * 0.75) / GRID_SEG) * GRID_SEG;
+
+  count = hardware_concurrency (MI_DISPLAY(mi));
+  bp->threads = (struct gw_thread **) calloc (count, sizeof(*bp->threads));
+  if (! bp->threads) abort();
+  err = threadpool_create (&bp->threadpool, &cls, MI_DISPLAY(mi), count);
+  if (err)
+    threadpool_fatal (progname, err);
 
   bp->nstars = MI_COUNT(mi);
   bp->stars = (star *) calloc (bp->nstars, sizeof (star));
@@ -543,6 +965,10 @@ init_gw (ModeInfo *mi)
       s->y = frand(s->ro * 2 + bp->grid_h * GRID_SEG) - s->ro;
     }
 
+# ifdef USE_SHADERS
+  init_shaders (mi);
+# endif
+
   /* Let's tilt the floor a little. */
   gltrackball_reset (bp->user_trackball,
                      -0.4 + frand(0.8),
@@ -557,10 +983,7 @@ draw_gw (ModeInfo *mi)
   int wire = MI_IS_WIREFRAME(mi);
   Display *dpy = MI_DISPLAY(mi);
   Window window = MI_WINDOW(mi);
-  int gridmod = grid_size * GRID_SIZE_BASE;
-  int x, y, i;
-  int sample_x, sample_y;
-  GLfloat sample_z = -1;
+  int i;
 
   if (!bp->glx_context)
     return;
@@ -618,21 +1041,12 @@ draw_gw (ModeInfo *mi)
 
       glFogi (GL_FOG_MODE, GL_EXP2);
       glFogfv (GL_FOG_COLOR, fog_color);
-      glFogf (GL_FOG_DENSITY, 0.005);
+      glFogf (GL_FOG_DENSITY, FOG_DENSITY);
       glEnable (GL_FOG);
     }
 
-  glEnableClientState (GL_COLOR_ARRAY);
-  glEnableClientState (GL_VERTEX_ARRAY);
-  glColorPointer  (4, GL_FLOAT, 0, bp->col);
-  glVertexPointer (3, GL_FLOAT, 0, bp->vtx);
-
-  /* Somewhere near the midpoint of the view */
-  sample_x = ((int) (bp->grid_w * GRID_SEG * 0.5)  / gridmod) * gridmod;
-  sample_y = ((int) (bp->grid_h * GRID_SEG * 0.75) / GRID_SEG) * GRID_SEG;
-
   /* Find the cumulative gravitational effect at the midpoint of each star,
-     for the depth of the foot-circle.  This duplicates some of the draw_row()
+     for the depth of the foot-circle.  This duplicates some of the calc_row()
      logic. */
   for (i = 0; i < bp->nstars; i++)
     {
@@ -655,28 +1069,26 @@ draw_gw (ModeInfo *mi)
     }
 
   mi->polygon_count = 0;
-  for (y = 0; y < (bp->grid_h - 1) * GRID_SEG; y += gridmod)
-    draw_row (mi, bp->grid_w, y, False);
-  for (x = 0; x < (bp->grid_w - 1) * GRID_SEG; x += gridmod)
-    {
-      draw_row (mi, bp->grid_h, x, True);
-      if (x == sample_x)
-        sample_z = bp->grid[sample_y];
-    }
+# ifdef USE_SHADERS
+  if (bp->use_shaders)
+    draw_grid_shaders (mi);
+  else
+# endif
+    draw_grid (mi);
 
   if (mi->fps_p)
     {
       /* Mass of Sol is 2x10^30kg, or 332 kilo-Earths.
          But I'm not sure what the funniest number to put here is. */
       /* mi->recursion_depth = (int) sample_z/4; */
-      mi->recursion_depth = (int) (sample_z * 30000);
+      mi->recursion_depth = (int) (bp->sample_z * 30000);
       glColor4fv (bp->color);
       glMaterialfv (GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE, bp->color);
       glBegin(GL_LINES);
-      glVertex3f (sample_x-0.15, sample_y-0.15, sample_z);
-      glVertex3f (sample_x+0.15, sample_y+0.15, sample_z);
-      glVertex3f (sample_x-0.15, sample_y+0.15, sample_z);
-      glVertex3f (sample_x+0.15, sample_y-0.15, sample_z);
+      glVertex3f (bp->sample_x-0.15, bp->sample_y-0.15, bp->sample_z);
+      glVertex3f (bp->sample_x+0.15, bp->sample_y+0.15, bp->sample_z);
+      glVertex3f (bp->sample_x-0.15, bp->sample_y+0.15, bp->sample_z);
+      glVertex3f (bp->sample_x+0.15, bp->sample_y-0.15, bp->sample_z);
       glEnd();
     }
 
@@ -687,10 +1099,7 @@ draw_gw (ModeInfo *mi)
       int steps = 16;
       star *s = &bp->stars[i];
       GLfloat th, color[4];
-      int ci;
-      ci = EASE (s->depth / MAX_MASS_COLOR) * bp->ncolors;
-      if (ci < 0) ci = 0;
-      if (ci >= bp->ncolors) ci = bp->ncolors - 1;
+      int ci = ramp_index (bp->ncolors, s->depth);
       color[0] = bp->colors[ci].red   / 65536.0;
       color[1] = bp->colors[ci].green / 65536.0;
       color[2] = bp->colors[ci].blue  / 65536.0;
@@ -755,13 +1164,24 @@ free_gw (ModeInfo *mi)
   if (!bp->glx_context) return;
   glXMakeCurrent(MI_DISPLAY(mi), MI_WINDOW(mi), *bp->glx_context);
 
+  if (bp->threadpool.count) threadpool_destroy (&bp->threadpool);
+  if (bp->threads) free (bp->threads);
   if (bp->user_trackball) gltrackball_free (bp->user_trackball);
   if (bp->stars) free (bp->stars);
-  if (bp->grid) free (bp->grid);
-  if (bp->vtx) free (bp->vtx);
-  if (bp->col) free (bp->col);
-  if (bp->segs) free (bp->segs);
+  if (bp->row_first) free (bp->row_first);
+  if (bp->row_count) free (bp->row_count);
   if (bp->colors) free (bp->colors);
+  if (bp->palette) free (bp->palette);
+  if (bp->color_table) free (bp->color_table);
+# ifdef USE_SHADERS
+  if (bp->use_shaders)
+    {
+      glDeleteProgram (bp->shader_program);
+      glDeleteBuffers (1, &bp->position_buffer);
+      glDeleteTextures (1, &bp->palette_texture);
+      free (bp->star_uniforms);
+    }
+# endif
 }
 
 XSCREENSAVER_MODULE_2 ("GravityWell", gravitywell, gw)
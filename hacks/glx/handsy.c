@@ -35,19 +35,31 @@
 #define DEF_FACE_FRONT  "True"
 #define DEF_DEBUG       "False"
 
-extern const struct gllist
+/* A binary mesh container, see "handsy_dxf" in Makefile.in. */
+extern const unsigned char handsy_model[];
+extern const unsigned long handsy_model_size;
+
+/* Loaded from handsy_model on first use. */
+static const struct gllist
  *handsy_model_finger_distal, *handsy_model_finger_intermediate,
   *handsy_model_finger_proximal, *handsy_model_finger_metacarpal,
   *handsy_model_thumb_distal, *handsy_model_thumb_proximal,
   *handsy_model_thumb_metacarpal, *handsy_model_palm;
 static struct gllist *ground = 0;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "finger_distal", "finger_intermediate",
+  "finger_proximal", "finger_metacarpal",
+  "thumb_distal", "thumb_proximal",
+  "thumb_metacarpal", "palm",
+};
+
+static const struct gllist **all_objs[] = {
   &handsy_model_finger_distal, &handsy_model_finger_intermediate,
   &handsy_model_finger_proximal, &handsy_model_finger_metacarpal,
   &handsy_model_thumb_distal, &handsy_model_thumb_proximal,
   &handsy_model_thumb_metacarpal, &handsy_model_palm,
-  (const struct gllist * const *) &ground
+  (const struct gllist **) &ground
 };
 
 #define FINGER_DISTAL       0
@@ -221,6 +233,20 @@ constrain_joint (double v, double min, double max)
 }
 
 
+/* The bones are drawn directly rather than from display lists, so that
+   renderList can keep them in buffer objects.
+ */
+static void
+draw_bone (ModeInfo *mi, int i)
+{
+  GLfloat s = 0.1;
+  glPushMatrix();
+  glScalef (s, s, s);
+  renderList (*all_objs[i], MI_IS_WIREFRAME(mi));
+  glPopMatrix();
+}
+
+
 static void
 draw_hand (ModeInfo *mi, hand *h)
 {
@@ -253,7 +279,7 @@ draw_hand (ModeInfo *mi, hand *h)
     }
   else
     glFrontFace (GL_CCW);
-  glCallList (bp->dlists[PALM]);
+  draw_bone (mi, PALM);
   glPopMatrix();
 
   for (finger = 0; finger < nfingers; finger++)
@@ -272,11 +298,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[THUMB_METACARPAL]);
+          draw_bone (mi, THUMB_METACARPAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[THUMB_METACARPAL]);
+          draw_bone (mi, THUMB_METACARPAL);
           glPopMatrix();
 
           glTranslatef (0, 0, 0.1497);
@@ -284,11 +310,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[THUMB_PROXIMAL]);
+          draw_bone (mi, THUMB_PROXIMAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[THUMB_PROXIMAL]);
+          draw_bone (mi, THUMB_PROXIMAL);
           glPopMatrix();
 
           glTranslatef (0, 0, 0.1212);
@@ -296,11 +322,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[THUMB_DISTAL]);
+          draw_bone (mi, THUMB_DISTAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[THUMB_DISTAL]);
+          draw_bone (mi, THUMB_DISTAL);
           glPopMatrix();
         }
       else
@@ -328,11 +354,11 @@ draw_hand (ModeInfo *mi, hand *h)
           glRotatef (90, 0, 0, 1);
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[FINGER_METACARPAL]);
+          draw_bone (mi, FINGER_METACARPAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[FINGER_METACARPAL]);
+          draw_bone (mi, FINGER_METACARPAL);
           glPopMatrix();
 
           glTranslatef (0, 0, 0.1155);
@@ -341,11 +367,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[FINGER_PROXIMAL]);
+          draw_bone (mi, FINGER_PROXIMAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[FINGER_PROXIMAL]);
+          draw_bone (mi, FINGER_PROXIMAL);
           glPopMatrix();
 
           glTranslatef (0, 0, 0.1815);
@@ -353,11 +379,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[FINGER_INTERMEDIATE]);
+          draw_bone (mi, FINGER_INTERMEDIATE);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[FINGER_INTERMEDIATE]);
+          draw_bone (mi, FINGER_INTERMEDIATE);
           glPopMatrix();
 
           glTranslatef (0, 0, 0.1003);
@@ -365,11 +391,11 @@ draw_hand (ModeInfo *mi, hand *h)
           bone--;
 
           glFrontFace (GL_CCW);
-          glCallList (bp->dlists[FINGER_DISTAL]);
+          draw_bone (mi, FINGER_DISTAL);
           glPushMatrix();
           glScalef (1, -1, 1);
           glFrontFace (GL_CW);
-          glCallList (bp->dlists[FINGER_DISTAL]);
+          draw_bone (mi, FINGER_DISTAL);
           glPopMatrix();
         }
       glPopMatrix();
@@ -787,31 +813,29 @@ init_hands (ModeInfo *mi)
       bp->hands[i].current = bp->hands[i].to;
     }
 
+  for (i = 0; i < countof(all_layers); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (handsy_model, handsy_model_size,
+                                         all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
   glFrontFace(GL_CW);
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
 
-  for (i = 0; i < countof(all_objs); i++)
-    {
-      const struct gllist *gll = *all_objs[i];
-      GLfloat s = 0.1;
-      glNewList (bp->dlists[i], GL_COMPILE);
-      switch (i) {
-      case GROUND:
-        if (! ground)
-          ground = (struct gllist *) calloc (1, sizeof(*ground));
-        ground->points = draw_ground (mi);
-        break;
-      default:
-        glPushMatrix();
-        glScalef (s, s, s);
-        renderList (gll, wire);
-        glPopMatrix();
-        break;
-      }
-      glEndList ();
-    }
+  glNewList (bp->dlists[GROUND], GL_COMPILE);
+  if (! ground)
+    ground = (struct gllist *) calloc (1, sizeof(*ground));
+  ground->points = draw_ground (mi);
+  glEndList ();
 
   if (!wire)
     {
@@ -1,4 +1,5 @@
-/* Generated from "handsy.dxf" on 25-Oct-2018.
+/* Generated from "handsy.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
    Smoothed vertex normals at 28°.
    Components: finger_distal, finger_intermediate, finger_metacarpal,
      finger_proximal, palm, thumb_distal, thumb_metacarpal, thumb_proximal.
@@ -6,6679 +7,2134 @@
 
 #include "gllist.h"
 
-static const float handsy_model_finger_distal_data[] = {
-	-0.707107,0.707107,0,0.095086,0.180273,1.001864,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.099318,0.184504,1.001864,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.095086,0.180273,1.001864,
-	-0.707107,0.707107,0,0.090393,0.175579,1.058824,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.090393,0.175579,1.058824,
-	-0.707107,0.707107,0,0.084928,0.170115,1.079901,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.084928,0.170115,1.079901,
-	-0.707107,0.707107,0,0.084928,0.170115,1.091226,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.084928,0.170115,1.091226,
-	-0.707107,0.707107,0,0.084928,0.170115,1.135994,
-	-0.707107,0.707107,0,0.099318,0.184504,1.131929,
-	-0.707107,0.707107,0,0.084928,0.170115,1.135994,
-	-0.707107,0.707107,0,0.090962,0.176148,1.142819,
-	-0.707107,0.707107,0,0.090962,0.176148,1.142819,
-	-0.707107,0.707107,0,0.084928,0.170115,1.135994,
-	-0.707107,0.707107,0,0.084928,0.170115,1.147449,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.808758,0.575,0.123638,0.140043,0.160058,0.848974,
-	0.91898,0.370926,0.13375,0.175201,0.114294,0.794628,
-	0.808758,0.575,0.123638,0.140043,0.160058,0.848974,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.630687,0.768681,0.106602,0.095242,0.193568,0.918226,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.630687,0.768681,0.106602,0.095242,0.193568,0.918226,
-	0.808758,0.575,0.123638,0.140043,0.160058,0.848974,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.91898,0.370926,0.13375,0.175201,0.114294,0.794628,
-	0.969671,0.201527,0.138296,0.197659,0.059532,0.759913,
-	0.91898,0.370926,0.13375,0.175201,0.114294,0.794628,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.707095,0.707095,-0.005782,-0.206534,0.206534,0.206534,
-	-0.887099,0.461543,-0.005776,-0.253185,0.146177,0.253185,
-	-0.707095,0.707095,-0.005782,-0.206534,0.206534,0.206534,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.706249,0.706249,0.049244,-0.206951,0.206951,0.308415,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.935393,0.051194,0.349884,0.205383,0,0.747973,
-	0.987543,0.10011,0.121395,0.20782,0,0.730756,
-	0.935393,0.051194,0.349884,0.205383,0,0.747973,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.9306,0.103399,0.35113,0.197659,0.059532,0.759913,
-	-0.461543,0.887099,-0.005776,-0.145866,0.252648,0.145866,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.216218,0.976328,-0.005776,-0.0754,0.281398,0.0754,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.461543,0.887099,-0.005776,-0.145866,0.252648,0.145866,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	0.324287,0.942926,0.075685,0.044468,0.212784,0.996711,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.324287,0.942926,0.075685,0.044468,0.212784,0.996711,
-	0.630687,0.768681,0.106602,0.095242,0.193568,0.918226,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	-0.887099,0.461543,-0.005776,-0.253185,0.146177,0.253185,
-	-0.976328,0.216218,-0.005776,-0.282555,0.07571,0.282555,
-	-0.887099,0.461543,-0.005776,-0.253185,0.146177,0.253185,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.990262,0.130371,0.048824,-0.292672,0,0.308415,
-	-0.976328,0.216218,-0.005776,-0.282555,0.07571,0.282555,
-	-0.991429,0.130524,-0.005732,-0.292581,0,0.292581,
-	-0.976328,0.216218,-0.005776,-0.282555,0.07571,0.282555,
-	-0.990262,0.130371,0.048824,-0.292672,0,0.308415,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	0.020045,0.337373,0.941158,0.166851,0.067533,1.206027,
-	0.019327,0.266418,0.963664,0.145844,0.064475,1.207294,
-	0.003099,0.22022,0.975445,0.146803,0.062161,1.207598,
-	0.035916,0.522579,0.851834,0.140784,0.130464,1.177874,
-	0.036445,0.521909,0.852222,0.11938,0.124556,1.182407,
-	0.04764,0.414629,0.908743,0.122809,0.120086,1.184259,
-	0.866025,0.5,0,0.140784,0.130464,0.847828,
-	0.95365,0.300918,0,0.166851,0.067533,1.206027,
-	0.98084,0.194814,0,0.166851,0.067533,0.807535,
-	0.95365,0.300918,0,0.166851,0.067533,1.206027,
-	0.866025,0.5,0,0.140784,0.130464,0.847828,
-	0.866025,0.5,0,0.140784,0.130464,1.177874,
-	0.020045,0.337373,0.941158,0.166851,0.067533,1.206027,
-	0.04764,0.414629,0.908743,0.122809,0.120086,1.184259,
-	0.019327,0.266418,0.963664,0.145844,0.064475,1.207294,
-	-0.991445,-0.130526,0,0.154986,0,1.215782,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.991445,-0.130526,0,0.154986,0,1.091226,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.991445,-0.130526,0,0.154986,0,1.215782,
-	-0.965926,-0.258819,0,0.146803,0.062161,1.207598,
-	0.035916,0.522579,0.851834,0.140784,0.130464,1.177874,
-	0,0.608761,0.793353,0.084928,0.169454,1.147956,
-	0.036445,0.521909,0.852222,0.11938,0.124556,1.182407,
-	0,0.659134,0.752025,0.10573,0.176148,1.142819,
-	0,0.608761,0.793353,0.084928,0.170115,1.147449,
-	0,0.608761,0.793353,0.084928,0.169454,1.147956,
-	-1,0,0,0.084928,0.170115,1.147449,
-	-0.998017,0.062939,0,0.084928,0.169454,1.136304,
-	-0.992013,0.126132,0,0.084928,0.169454,1.147956,
-	-0.998017,0.062939,0,0.084928,0.169454,1.136304,
-	-1,0,0,0.084928,0.170115,1.147449,
-	-1,0,0,0.084928,0.170115,1.135994,
-	0,0.130526,0.991445,0.154986,0,1.215782,
-	-0.009782,0.215043,0.976556,0.167254,0.064475,1.207294,
-	0.003099,0.22022,0.975445,0.146803,0.062161,1.207598,
-	-0.009782,0.215043,0.976556,0.167254,0.064475,1.207294,
-	0,0.130526,0.991445,0.154986,0,1.215782,
-	0,0.130526,0.991445,0.175742,0,1.215782,
-	-1,0,0,0.084928,0.170115,1.135994,
-	-0.998734,0.050307,0,0.084928,0.169454,1.091226,
-	-0.998017,0.062939,0,0.084928,0.169454,1.136304,
-	-0.998734,0.050307,0,0.084928,0.169454,1.091226,
-	-1,0,0,0.084928,0.170115,1.135994,
-	-1,0,0,0.084928,0.170115,1.091226,
-	0.020045,0.337373,0.941158,0.166851,0.067533,1.206027,
-	0.035916,0.522579,0.851834,0.140784,0.130464,1.177874,
-	0.04764,0.414629,0.908743,0.122809,0.120086,1.184259,
-	0,0.659134,0.752025,0.10573,0.176148,1.142819,
-	0,0.793353,0.608761,0.099318,0.184504,1.131929,
-	0,0.707107,0.707107,0.090962,0.176148,1.142819,
-	0.866025,0.5,0,0.140784,0.130464,0.847828,
-	0.793353,0.608761,0,0.10573,0.176148,1.142819,
-	0.866025,0.5,0,0.140784,0.130464,1.177874,
-	0.793353,0.608761,0,0.10573,0.176148,1.142819,
-	0.866025,0.5,0,0.140784,0.130464,0.847828,
-	0.793353,0.608761,0,0.099318,0.184504,0.911925,
-	0.793353,0.608761,0,0.10573,0.176148,1.142819,
-	0.793353,0.608761,0,0.099318,0.184504,0.911925,
-	0.793353,0.608761,0,0.099318,0.184504,1.001864,
-	0.793353,0.608761,0,0.10573,0.176148,1.142819,
-	0.793353,0.608761,0,0.099318,0.184504,1.001864,
-	0.793353,0.608761,0,0.099318,0.184504,1.131929,
-	-0.92388,-0.382683,0,0.137837,0.083806,1.091226,
-	-0.965926,-0.258819,0,0.146803,0.062161,1.085202,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.009782,0.215043,0.976556,0.167254,0.064475,1.207294,
-	0.020045,0.337373,0.941158,0.166851,0.067533,1.206027,
-	0.003099,0.22022,0.975445,0.146803,0.062161,1.207598,
-	-0.998734,0.050307,0,0.084928,0.169454,1.091226,
-	-1,0,0,0.084928,0.170115,1.079901,
-	-1,0,0,0.084928,0.169454,1.081177,
-	-1,0,0,0.084928,0.170115,1.079901,
-	-0.998734,0.050307,0,0.084928,0.169454,1.091226,
-	-1,0,0,0.084928,0.170115,1.091226,
-	0.035916,0.522579,0.851834,0.140784,0.130464,1.177874,
-	0,0.659134,0.752025,0.10573,0.176148,1.142819,
-	0,0.608761,0.793353,0.084928,0.169454,1.147956,
-	-0.92388,-0.382683,0,0.12778,0.108086,1.091226,
-	-0.92388,-0.382683,0,0.137837,0.083806,1.091226,
-	-0.92388,-0.382683,0,0.13166,0.098719,1.095377,
-	0,0.659134,0.752025,0.10573,0.176148,1.142819,
-	0,0.707107,0.707107,0.090962,0.176148,1.142819,
-	0,0.608761,0.793353,0.084928,0.170115,1.147449,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.866025,-0.5,0,0.122809,0.120086,1.091226,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.793353,-0.608761,0,0.11938,0.124556,1.182407,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.793353,-0.608761,0,0.11938,0.124556,1.182407,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.147956,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.147956,
-	-0.793353,-0.608761,0,0.107664,0.139824,1.094648,
-	-0.793353,-0.608761,0,0.107664,0.139824,1.094648,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.147956,
-	-0.793353,-0.608761,0,0.101889,0.14735,1.091226,
-	-0.793353,-0.608761,0,0.101889,0.14735,1.091226,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.147956,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.091226,
-	-0.998734,0.050307,0,0.084928,0.169454,1.091226,
-	-0.992013,0.126132,0,0.084928,0.169454,1.147956,
-	-0.998017,0.062939,0,0.084928,0.169454,1.136304,
-	0.98084,0.194814,0,0.166851,0.067533,0.807535,
-	0.991445,0.130526,0,0.175742,0,1.215782,
-	0.991445,0.130526,0,0.175742,0,0.793792,
-	0.991445,0.130526,0,0.175742,0,1.215782,
-	0.98084,0.194814,0,0.166851,0.067533,0.807535,
-	0.991445,0.130526,0,0.167254,0.064475,1.207294,
-	0.991445,0.130526,0,0.167254,0.064475,1.207294,
-	0.98084,0.194814,0,0.166851,0.067533,0.807535,
-	0.95365,0.300918,0,0.166851,0.067533,1.206027,
-	0.931595,0.193458,0.307742,0.148197,0.05157,1.090997,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.931595,0.193458,0.307742,0.148197,0.05157,1.090997,
-	0.905776,0.288892,0.310019,0.146803,0.062161,1.085202,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.905776,0.288892,0.310019,0.146803,0.062161,1.085202,
-	0.905776,0.288892,0.310019,0.137837,0.083806,1.091226,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.905776,0.288892,0.310019,0.137837,0.083806,1.091226,
-	0.849124,0.419187,0.321357,0.13166,0.098719,1.095377,
-	0.415157,0.90975,0,0.08473,0.190593,0.934475,
-	0.385197,0.922834,0,0.099318,0.184504,1.001864,
-	0.385197,0.922834,0,0.099318,0.184504,0.911925,
-	0.385197,0.922834,0,0.099318,0.184504,1.001864,
-	0.415157,0.90975,0,0.08473,0.190593,0.934475,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0,0,1,0.099318,0.184504,1.001864,
-	0,0,1,0.08473,0.190593,1.001864,
-	0,0,1,0.095086,0.180273,1.001864,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.091226,
-	-0.793353,-0.608761,0,0.084928,0.169454,1.081177,
-	-0.793353,-0.608761,0,0.101889,0.14735,1.091226,
-	-0.92388,-0.382683,0,0.145844,0.064475,1.207294,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.965926,-0.258819,0,0.146803,0.062161,1.207598,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.92388,-0.382683,0,0.145844,0.064475,1.207294,
-	-0.92388,-0.382683,0,0.137837,0.083806,1.091226,
-	-0.92388,-0.382683,0,0.137837,0.083806,1.091226,
-	-0.92388,-0.382683,0,0.145844,0.064475,1.207294,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.92388,-0.382683,0,0.137837,0.083806,1.091226,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.92388,-0.382683,0,0.13166,0.098719,1.095377,
-	-0.92388,-0.382683,0,0.13166,0.098719,1.095377,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.92388,-0.382683,0,0.12778,0.108086,1.091226,
-	-0.92388,-0.382683,0,0.12778,0.108086,1.091226,
-	-0.887114,-0.461551,0,0.122809,0.120086,1.184259,
-	-0.866025,-0.5,0,0.122809,0.120086,1.091226,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.866025,-0.5,0,0.122809,0.120086,1.085909,
-	-0.866025,-0.5,0,0.122809,0.120086,1.091226,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.701131,0.703574,0.115755,0.095086,0.180273,1.001864,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0.701131,0.703574,0.115755,0.095086,0.180273,1.001864,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.679711,0.682079,0.269744,0.090393,0.175579,1.058824,
-	-0.793353,-0.608761,0,0.101889,0.14735,1.091226,
-	-0.793353,-0.608761,0,0.113594,0.132096,1.091226,
-	-0.793353,-0.608761,0,0.107664,0.139824,1.094648,
-	-0.991445,-0.130526,0,0.154986,0,1.091226,
-	-0.991445,-0.130526,0,0.148197,0.05157,1.090997,
-	-0.991445,-0.130526,0,0.154986,0,1.086101,
-	-0.991445,-0.130526,0,0.148197,0.05157,1.090997,
-	-0.991445,-0.130526,0,0.154986,0,1.091226,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.991445,-0.130526,0,0.148197,0.05157,1.090997,
-	-0.970622,-0.24061,0,0.146803,0.062161,1.091226,
-	-0.965926,-0.258819,0,0.146803,0.062161,1.085202,
-	-0.866025,-0.5,0,0.122809,0.120086,1.085909,
-	-0.92388,-0.382683,0,0.12778,0.108086,1.091226,
-	-0.866025,-0.5,0,0.122809,0.120086,1.091226,
-	0.247221,0.204672,0.947096,0.031013,0.040277,1.214443,
-	0.171497,0.24914,0.953162,0.02193,0.049329,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.304882,0.147067,0.940967,0.037983,0.02848,1.214443,
-	0.247221,0.204672,0.947096,0.031013,0.040277,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.247221,0.204672,0.947096,0.031013,0.040277,1.214443,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.171497,0.24914,0.953162,0.02193,0.049329,1.214443,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.247221,0.204672,0.947096,0.031013,0.040277,1.214443,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.679711,0.682079,0.269744,0.090393,0.175579,1.058824,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.679711,0.682079,0.269744,0.090393,0.175579,1.058824,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.662732,0.66504,0.34425,0.084928,0.170115,1.079901,
-	0.662732,0.66504,0.34425,0.084928,0.170115,1.079901,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.662732,0.66504,0.34425,0.084928,0.169454,1.081177,
-	0.662732,0.66504,0.34425,0.084928,0.169454,1.081177,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.662732,0.66504,0.34425,0.101889,0.14735,1.091226,
-	0.662732,0.66504,0.34425,0.101889,0.14735,1.091226,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.717843,0.607615,0.33986,0.107664,0.139824,1.094648,
-	0.717843,0.607615,0.33986,0.107664,0.139824,1.094648,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.849124,0.419187,0.321357,0.13166,0.098719,1.095377,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.849124,0.419187,0.321357,0.13166,0.098719,1.095377,
-	0.814338,0.481145,0.32458,0.12778,0.108086,1.091226,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.814338,0.481145,0.32458,0.12778,0.108086,1.091226,
-	0.814338,0.481145,0.32458,0.122809,0.120086,1.085909,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.814338,0.481145,0.32458,0.122809,0.120086,1.085909,
-	0.814338,0.481145,0.32458,0.113594,0.132096,1.091226,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.814338,0.481145,0.32458,0.113594,0.132096,1.091226,
-	0.717843,0.607615,0.33986,0.107664,0.139824,1.094648,
-	0.100924,0.993347,0.05547,0,0.292672,0.308415,
-	0.283658,0.958361,0.032903,0.07279,0.281365,0.01023,
-	0,0.999983,-0.005782,0,0.290889,0,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.619313,0.438782,0.651092,0.08473,0.110039,1.157482,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.746149,0.525881,0.408303,0.103773,0.13477,1.111903,
-	0.304882,0.147067,0.940967,0.037983,0.02848,1.214443,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.247221,0.204672,0.947096,0.031013,0.040277,1.214443,
-	0.434893,0.342116,0.832961,0.059913,0.077809,1.192457,
-	0.304882,0.147067,0.940967,0.037983,0.02848,1.214443,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.341624,0.080671,0.936368,0.042365,0.014742,1.214443,
-	0.304882,0.147067,0.940967,0.037983,0.02848,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.341624,0.080671,0.936368,0.042365,0.014742,1.214443,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.304882,0.147067,0.940967,0.037983,0.02848,1.214443,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.341624,0.080671,0.936368,0.042365,0.014742,1.214443,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.524068,0.23846,0.817612,0.073378,0.05502,1.192457,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.757352,0.141892,0.637404,0.115744,0.040277,1.157482,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.757352,0.141892,0.637404,0.115744,0.040277,1.157482,
-	0.720425,0.289908,0.630032,0.103773,0.077809,1.157482,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.848153,0.348489,0.398988,0.127095,0.095297,1.111903,
-	0.376048,0.038121,0.925816,0.04386,0,1.214443,
-	0.341624,0.080671,0.936368,0.042365,0.014742,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.376048,0.038121,0.925816,0.04386,0,1.214443,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.341624,0.080671,0.936368,0.042365,0.014742,1.214443,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.376048,0.038121,0.925816,0.04386,0,1.214443,
-	0.63304,0.064173,0.771454,0.08473,0,1.192457,
-	0.63304,0.064173,0.771454,0.08473,0,1.192457,
-	0.757352,0.141892,0.637404,0.115744,0.040277,1.157482,
-	0.577629,0.123653,0.806879,0.081843,0.02848,1.192457,
-	0.757352,0.141892,0.637404,0.115744,0.040277,1.157482,
-	0.63304,0.064173,0.771454,0.08473,0,1.192457,
-	0.81226,0.082341,0.577454,0.119827,0,1.157482,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.81226,0.082341,0.577454,0.119827,0,1.157482,
-	0.923246,0.093592,0.372635,0.146757,0,1.111903,
-	0.81226,0.082341,0.577454,0.119827,0,1.157482,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.757352,0.141892,0.637404,0.115744,0.040277,1.157482,
-	0.931595,0.193458,0.307742,0.148197,0.05157,1.090997,
-	0.923246,0.093592,0.372635,0.146757,0,1.111903,
-	0.948303,0.096132,0.302456,0.154986,0,1.086101,
-	0.923246,0.093592,0.372635,0.146757,0,1.111903,
-	0.931595,0.193458,0.307742,0.148197,0.05157,1.090997,
-	0.875474,0.181663,0.447821,0.141756,0.049329,1.111903,
-	0.167861,0.981775,0.089114,0.041134,0.213045,1.001864,
-	0.324762,0.943628,0.064002,0.04386,0.212579,1.001864,
-	0.376389,0.926462,0,0.04386,0.212579,0.997651,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0.324762,0.943628,0.064002,0.04386,0.212579,1.001864,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.579702,0.777975,0.242282,0.081843,0.184099,1.058824,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.605362,0.686777,0.402336,0.073378,0.165059,1.111903,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.171508,0.455084,0.873775,0.02193,0.10629,1.192457,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.457499,0.59115,0.664256,0.059913,0.13477,1.157482,
-	0.171497,0.24914,0.953162,0.02193,0.049329,1.214443,
-	0.171508,0.455084,0.873775,0.02193,0.10629,1.192457,
-	0.082478,0.276507,0.957466,0.011352,0.05502,1.214443,
-	0.171508,0.455084,0.873775,0.02193,0.10629,1.192457,
-	0.171497,0.24914,0.953162,0.02193,0.049329,1.214443,
-	0.311652,0.426328,0.849187,0.042365,0.095297,1.192457,
-	0.171497,0.24914,0.953162,0.02193,0.049329,1.214443,
-	0.082478,0.276507,0.957466,0.011352,0.05502,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.048912,0.971204,0.233174,0,0.212579,1.058824,
-	0.167861,0.981775,0.089114,0.041134,0.213045,1.001864,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	0.167861,0.981775,0.089114,0.041134,0.213045,1.001864,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.324762,0.943628,0.064002,0.04386,0.212579,1.001864,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.167861,0.981775,0.089114,0.041134,0.213045,1.001864,
-	0.048912,0.971204,0.233174,0,0.212579,1.058824,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	0.048912,0.971204,0.233174,0,0.212579,1.058824,
-	0.295615,0.925472,0.236882,0.042365,0.205336,1.058824,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	0.301659,0.807294,0.507226,0.037983,0.184099,1.111903,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	0.223446,0.645606,0.73025,0.031013,0.150316,1.157482,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	0.171508,0.455084,0.873775,0.02193,0.10629,1.192457,
-	0.082478,0.276507,0.957466,0.011352,0.05502,1.214443,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	0.005074,0.25872,0.965939,0,0.05696,1.214443,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	0.082478,0.276507,0.957466,0.011352,0.05502,1.214443,
-	0.171508,0.455084,0.873775,0.02193,0.10629,1.192457,
-	0.082478,0.276507,0.957466,0.011352,0.05502,1.214443,
-	0.005074,0.25872,0.965939,0,0.05696,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	0.005074,0.25872,0.965939,0,0.05696,1.214443,
-	-0.063714,0.27702,0.958749,-0.014742,0.05502,1.214443,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.231735,0.965999,0.114651,-0.05696,0.212579,1.001864,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.50048,0.817794,0.284135,-0.10629,0.184099,1.058824,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.50048,0.817794,0.284135,-0.10629,0.184099,1.058824,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.24095,0.817816,0.522609,-0.049329,0.184099,1.111903,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.24095,0.817816,0.522609,-0.049329,0.184099,1.111903,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.24095,0.817816,0.522609,-0.049329,0.184099,1.111903,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	-0.133242,0.25109,0.958749,-0.02848,0.049329,1.214443,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	-0.133242,0.25109,0.958749,-0.02848,0.049329,1.214443,
-	-0.063714,0.27702,0.958749,-0.014742,0.05502,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	-0.063714,0.27702,0.958749,-0.014742,0.05502,1.214443,
-	-0.133242,0.25109,0.958749,-0.02848,0.049329,1.214443,
-	0.935393,0.051194,0.349884,0.205383,0,0.747973,
-	0.83962,0,0.543174,0.166851,0.067533,0.807535,
-	0.83962,0,0.543174,0.175742,0,0.793792,
-	0.83962,0,0.543174,0.166851,0.067533,0.807535,
-	0.935393,0.051194,0.349884,0.205383,0,0.747973,
-	0.90795,0.034033,0.417694,0.197659,0.059532,0.759913,
-	0.83962,0,0.543174,0.166851,0.067533,0.807535,
-	0.90795,0.034033,0.417694,0.197659,0.059532,0.759913,
-	0.83962,0,0.543174,0.175201,0.114294,0.794628,
-	0.83962,0,0.543174,0.166851,0.067533,0.807535,
-	0.83962,0,0.543174,0.175201,0.114294,0.794628,
-	0.83962,0,0.543174,0.140784,0.130464,0.847828,
-	0.83962,0,0.543174,0.140784,0.130464,0.847828,
-	0.83962,0,0.543174,0.175201,0.114294,0.794628,
-	0.83962,0,0.543174,0.140043,0.160058,0.848974,
-	0.83962,0,0.543174,0.140784,0.130464,0.847828,
-	0.83962,0,0.543174,0.140043,0.160058,0.848974,
-	0.83962,0,0.543174,0.099318,0.184504,0.911925,
-	0.83962,0,0.543174,0.099318,0.184504,0.911925,
-	0.83962,0,0.543174,0.140043,0.160058,0.848974,
-	0.83962,0,0.543174,0.095242,0.193568,0.918226,
-	0.83962,0,0.543174,0.099318,0.184504,0.911925,
-	0.83962,0,0.543174,0.095242,0.193568,0.918226,
-	0.83962,0,0.543174,0.08473,0.190593,0.934475,
-	0.83962,0,0.543174,0.08473,0.190593,0.934475,
-	0.83962,0,0.543174,0.095242,0.193568,0.918226,
-	0.83962,0,0.543174,0.04386,0.212579,0.997651,
-	0.83962,0,0.543174,0.04386,0.212579,0.997651,
-	0.83962,0,0.543174,0.095242,0.193568,0.918226,
-	0.83962,0,0.543174,0.044468,0.212784,0.996711,
-	0.83962,0,0.543174,0.04386,0.212579,0.997651,
-	0.83962,0,0.543174,0.044468,0.212784,0.996711,
-	0.83962,0,0.543174,0.041134,0.213045,1.001864,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.50048,0.817794,0.284135,-0.10629,0.184099,1.058824,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.50048,0.817794,0.284135,-0.10629,0.184099,1.058824,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.50048,0.817794,0.284135,-0.10629,0.184099,1.058824,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.430509,0.751368,0.500107,-0.095297,0.165059,1.111903,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.349991,0.614303,0.707204,-0.077809,0.13477,1.157482,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.193688,0.208049,0.958749,-0.040277,0.040277,1.214443,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.245627,0.435403,0.866078,-0.05502,0.095297,1.192457,
-	-0.193688,0.208049,0.958749,-0.040277,0.040277,1.214443,
-	-0.133242,0.25109,0.958749,-0.02848,0.049329,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	-0.133242,0.25109,0.958749,-0.02848,0.049329,1.214443,
-	-0.193688,0.208049,0.958749,-0.040277,0.040277,1.214443,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.69037,0.69037,0.216285,-0.150316,0.150316,1.058824,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.627248,0.627248,0.46165,-0.13477,0.13477,1.111903,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.517383,0.501035,0.693742,-0.110039,0.110039,1.157482,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.240936,0.15083,0.958749,-0.049329,0.02848,1.214443,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.349948,0.356994,0.866078,-0.077809,0.077809,1.192457,
-	-0.240936,0.15083,0.958749,-0.049329,0.02848,1.214443,
-	-0.193688,0.208049,0.958749,-0.040277,0.040277,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	-0.193688,0.208049,0.958749,-0.040277,0.040277,1.214443,
-	-0.240936,0.15083,0.958749,-0.049329,0.02848,1.214443,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.837235,0.481678,0.258889,-0.184099,0.10629,1.058824,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.668799,0.16246,0.725476,-0.150316,0.040277,1.157482,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.751368,0.430509,0.500107,-0.165059,0.095297,1.111903,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.668799,0.16246,0.725476,-0.150316,0.040277,1.157482,
-	-0.627494,0.326475,0.70687,-0.13477,0.077809,1.157482,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.271764,0.083332,0.958749,-0.05502,0.014742,1.214443,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.430421,0.254256,0.866078,-0.095297,0.05502,1.192457,
-	-0.271764,0.083332,0.958749,-0.05502,0.014742,1.214443,
-	-0.240936,0.15083,0.958749,-0.049329,0.02848,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	-0.240936,0.15083,0.958749,-0.049329,0.02848,1.214443,
-	-0.271764,0.083332,0.958749,-0.05502,0.014742,1.214443,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.984196,0.129572,0.120707,-0.220078,0,1.001864,
-	-0.946203,0.12457,0.298635,-0.212579,0,1.058824,
-	-0.984196,0.129572,0.120707,-0.220078,0,1.001864,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.946203,0.12457,0.298635,-0.212579,0,1.058824,
-	-0.860389,0.113272,0.496891,-0.190593,0,1.111903,
-	-0.946203,0.12457,0.298635,-0.212579,0,1.058824,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.933374,0.248573,0.258889,-0.205336,0.05502,1.058824,
-	-0.73389,0.096619,0.672361,-0.155619,0,1.157482,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.860389,0.113272,0.496891,-0.190593,0,1.111903,
-	-0.831628,0.204716,0.516223,-0.184099,0.049329,1.111903,
-	-0.73389,0.096619,0.672361,-0.155619,0,1.157482,
-	-0.668799,0.16246,0.725476,-0.150316,0.040277,1.157482,
-	-0.536052,0.070573,0.84123,-0.110039,0,1.192457,
-	-0.668799,0.16246,0.725476,-0.150316,0.040277,1.157482,
-	-0.73389,0.096619,0.672361,-0.155619,0,1.157482,
-	-0.668799,0.16246,0.725476,-0.150316,0.040277,1.157482,
-	-0.536052,0.070573,0.84123,-0.110039,0,1.192457,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.30062,0.039577,0.952922,-0.05696,0,1.214443,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.536052,0.070573,0.84123,-0.110039,0,1.192457,
-	-0.481561,0.134192,0.866078,-0.10629,0.02848,1.192457,
-	-0.30062,0.039577,0.952922,-0.05696,0,1.214443,
-	-0.271764,0.083332,0.958749,-0.05502,0.014742,1.214443,
-	0.012418,0.084509,0.996345,0,0,1.221942,
-	-0.271764,0.083332,0.958749,-0.05502,0.014742,1.214443,
-	-0.30062,0.039577,0.952922,-0.05696,0,1.214443,
-	0.376389,0.926462,0,0.04386,0.212579,0.997651,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0.415157,0.90975,0,0.08473,0.190593,0.934475,
-	0.500207,0.863755,0.061001,0.08473,0.190593,1.001864,
-	0.376389,0.926462,0,0.04386,0.212579,0.997651,
-	0.324762,0.943628,0.064002,0.04386,0.212579,1.001864,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	0.324287,0.942926,0.075685,0.044468,0.212784,0.996711,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.324287,0.942926,0.075685,0.044468,0.212784,0.996711,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	0.167861,0.981775,0.089114,0.041134,0.213045,1.001864,
-	0.3285,0.942649,0.059162,0,0.292672,0.308415,
-	0.413623,0.907654,0.071272,0.075296,0.280143,0.010582,
-	0.283658,0.958361,0.032903,0.07279,0.281365,0.01023,
-	0.413623,0.907654,0.071272,0.075296,0.280143,0.010582,
-	0.3285,0.942649,0.059162,0,0.292672,0.308415,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.100924,0.993347,0.05547,0,0.292672,0.308415,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.231735,0.965999,0.114651,-0.05696,0.212579,1.001864,
-	-0.608751,0.79334,-0.005732,-0.20569,0.207176,0.20569,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.461543,0.887099,-0.005776,-0.145866,0.252648,0.145866,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.608751,0.79334,-0.005732,-0.20569,0.207176,0.20569,
-	-0.707095,0.707095,-0.005782,-0.206534,0.206534,0.206534,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.707095,0.707095,-0.005782,-0.206534,0.206534,0.206534,
-	-0.706249,0.706249,0.049244,-0.206951,0.206951,0.308415,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.706249,0.706249,0.049244,-0.206951,0.206951,0.308415,
-	-0.547548,0.835754,0.041316,-0.146336,0.253462,0.308415,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.48015,0.86905,0.119198,-0.110039,0.190593,1.001864,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.702583,0.702583,0.112929,-0.155619,0.155619,1.001864,
-	-0.706249,0.706249,0.049244,-0.206951,0.206951,0.308415,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	-0.860077,0.496488,0.117332,-0.190593,0.110039,1.001864,
-	-0.842251,0.536837,0.049197,-0.253462,0.146336,0.308415,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.990262,0.130371,0.048824,-0.292672,0,0.308415,
-	-0.984196,0.129572,0.120707,-0.220078,0,1.001864,
-	-0.990262,0.130371,0.048824,-0.292672,0,0.308415,
-	-0.959271,0.256966,0.117332,-0.212579,0.05696,1.001864,
-	-0.952495,0.300554,0.049197,-0.2827,0.075749,0.308415,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.427508,0.900816,0.075942,0.143524,0.251128,0.020171,
-	0.413623,0.907654,0.071272,0.075296,0.280143,0.010582,
-	-0.216218,0.976328,-0.005776,-0.0754,0.281398,0.0754,
-	-0.013108,0.99872,0.048851,0,0.292672,0.308415,
-	0,0.999983,-0.005782,0,0.290889,0,
-	-0.013108,0.99872,0.048851,0,0.292672,0.308415,
-	-0.216218,0.976328,-0.005776,-0.0754,0.281398,0.0754,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	0.987655,0.110069,0.111458,0.285987,0.003291,0.040193,
-	0.987543,0.10011,0.121395,0.20782,0,0.730756,
-	0.988599,0.100217,0.11238,0.286315,0,0.040239,
-	0.987543,0.10011,0.121395,0.20782,0,0.730756,
-	0.987655,0.110069,0.111458,0.285987,0.003291,0.040193,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	-0.231735,0.965999,0.114651,-0.05696,0.212579,1.001864,
-	-0.013108,0.99872,0.048851,0,0.292672,0.308415,
-	-0.300554,0.952495,0.049197,-0.075749,0.2827,0.308415,
-	-0.013108,0.99872,0.048851,0,0.292672,0.308415,
-	-0.231735,0.965999,0.114651,-0.05696,0.212579,1.001864,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.518618,0.851337,0.079118,0.144703,0.250479,0.020337,
-	0.427508,0.900816,0.075942,0.143524,0.251128,0.020171,
-	0.518618,0.851337,0.079118,0.144703,0.250479,0.020337,
-	0.389382,0.917677,0.079062,0.075865,0.223333,0.730756,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.879378,0.465339,0.100771,0.248668,0.144018,0.034948,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.879378,0.465339,0.100771,0.248668,0.144018,0.034948,
-	0.824908,0.557247,0.094881,0.247339,0.146303,0.034761,
-	0.963188,0.245466,0.109611,0.27676,0.074466,0.038896,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.963188,0.245466,0.109611,0.27676,0.074466,0.038896,
-	0.933915,0.341689,0.105128,0.275831,0.077426,0.038766,
-	0.879378,0.465339,0.100771,0.248668,0.144018,0.034948,
-	0.908054,0.402355,0.116396,0.183968,0.115606,0.730756,
-	0.933915,0.341689,0.105128,0.275831,0.077426,0.038766,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.733544,0.673775,0.089114,0.20373,0.204036,0.028632,
-	0.656362,0.749796,0.083638,0.202309,0.205477,0.028433,
-	0.733544,0.673775,0.089114,0.20373,0.204036,0.028632,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	-0.24095,0.817816,0.522609,-0.049329,0.184099,1.111903,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	-0.179072,0.683956,0.707204,-0.040277,0.150316,1.157482,
-	0.018377,0.706803,0.707171,0,0.155619,1.157482,
-	0.595396,0.798295,0.090708,0.118803,0.200235,0.730756,
-	0.656362,0.749796,0.083638,0.202309,0.205477,0.028433,
-	0.518618,0.851337,0.079118,0.144703,0.250479,0.020337,
-	0.790198,0.60634,0.089097,0.216049,0.187728,0.030364,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.824908,0.557247,0.094881,0.247339,0.146303,0.034761,
-	0.786413,0.608998,0.103325,0.155675,0.163491,0.730756,
-	0.790198,0.60634,0.089097,0.216049,0.187728,0.030364,
-	0.733544,0.673775,0.089114,0.20373,0.204036,0.028632,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	0.048912,0.971204,0.233174,0,0.212579,1.058824,
-	-0.000403,0.875175,0.483806,0,0.190593,1.111903,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	-0.24095,0.817816,0.522609,-0.049329,0.184099,1.111903,
-	0.963188,0.245466,0.109611,0.27676,0.074466,0.038896,
-	0.973303,0.191501,0.126525,0.201753,0.059842,0.730756,
-	0.987655,0.110069,0.111458,0.285987,0.003291,0.040193,
-	-0.063714,0.27702,0.958749,-0.014742,0.05502,1.214443,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	-0.124567,0.48414,0.866078,-0.02848,0.10629,1.192457,
-	0.022695,0.483335,0.875141,0,0.110039,1.192457,
-	-0.063714,0.27702,0.958749,-0.014742,0.05502,1.214443,
-	0.005074,0.25872,0.965939,0,0.05696,1.214443,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	-0.231735,0.965999,0.114651,-0.05696,0.212579,1.001864,
-	0.062068,0.99278,0.102645,0,0.220078,1.001864,
-	-0.249995,0.932995,0.258889,-0.05502,0.205336,1.058824,
-	0.048912,0.971204,0.233174,0,0.212579,1.058824,
-	-0.707107,0,-0.707107,-0.282555,0.07571,0.282555,
-	-0.707107,0,-0.707107,-0.155102,0,0.155102,
-	-0.707107,0,-0.707107,-0.292581,0,0.292581,
-	-0.707107,0,-0.707107,-0.155102,0,0.155102,
-	-0.707107,0,-0.707107,-0.282555,0.07571,0.282555,
-	-0.707107,0,-0.707107,-0.155102,0.158996,0.155102,
-	-0.707107,0,-0.707107,-0.155102,0.158996,0.155102,
-	-0.707107,0,-0.707107,-0.282555,0.07571,0.282555,
-	-0.707107,0,-0.707107,-0.253185,0.146177,0.253185,
-	-0.707107,0,-0.707107,-0.155102,0.158996,0.155102,
-	-0.707107,0,-0.707107,-0.253185,0.146177,0.253185,
-	-0.707107,0,-0.707107,-0.206534,0.206534,0.206534,
-	-0.707107,0,-0.707107,-0.155102,0.158996,0.155102,
-	-0.707107,0,-0.707107,-0.206534,0.206534,0.206534,
-	-0.707107,0,-0.707107,0,0.158996,0,
-	-0.707107,0,-0.707107,0,0.158996,0,
-	-0.707107,0,-0.707107,-0.206534,0.206534,0.206534,
-	-0.707107,0,-0.707107,0,0.290889,0,
-	-0.707107,0,-0.707107,0,0.290889,0,
-	-0.707107,0,-0.707107,-0.206534,0.206534,0.206534,
-	-0.707107,0,-0.707107,-0.20569,0.207176,0.20569,
-	-0.707107,0,-0.707107,0,0.290889,0,
-	-0.707107,0,-0.707107,-0.20569,0.207176,0.20569,
-	-0.707107,0,-0.707107,-0.145866,0.252648,0.145866,
-	-0.707107,0,-0.707107,0,0.290889,0,
-	-0.707107,0,-0.707107,-0.145866,0.252648,0.145866,
-	-0.707107,0,-0.707107,-0.0754,0.281398,0.0754,
-	0.139173,0,-0.990268,0.07279,0.281365,0.01023,
-	0.139173,0,-0.990268,0,0.158996,0,
-	0.139173,0,-0.990268,0,0.290889,0,
-	0.139173,0,-0.990268,0,0.158996,0,
-	0.139173,0,-0.990268,0.07279,0.281365,0.01023,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.07279,0.281365,0.01023,
-	0.139173,0,-0.990268,0.075296,0.280143,0.010582,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.075296,0.280143,0.010582,
-	0.139173,0,-0.990268,0.143524,0.251128,0.020171,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.143524,0.251128,0.020171,
-	0.139173,0,-0.990268,0.144703,0.250479,0.020337,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.144703,0.250479,0.020337,
-	0.139173,0,-0.990268,0.202309,0.205477,0.028433,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.202309,0.205477,0.028433,
-	0.139173,0,-0.990268,0.20373,0.204036,0.028632,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.20373,0.204036,0.028632,
-	0.139173,0,-0.990268,0.216049,0.187728,0.030364,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.216049,0.187728,0.030364,
-	0.139173,0,-0.990268,0.247339,0.146303,0.034761,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.216568,0,0.030437,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.216568,0.158996,0.030437,
-	0.139173,0,-0.990268,0.247339,0.146303,0.034761,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.247339,0.146303,0.034761,
-	0.139173,0,-0.990268,0.248668,0.144018,0.034948,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.248668,0.144018,0.034948,
-	0.139173,0,-0.990268,0.275831,0.077426,0.038766,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.275831,0.077426,0.038766,
-	0.139173,0,-0.990268,0.27676,0.074466,0.038896,
-	0.139173,0,-0.990268,0.286315,0,0.040239,
-	0.139173,0,-0.990268,0.27676,0.074466,0.038896,
-	0.139173,0,-0.990268,0.285987,0.003291,0.040193
-};
-static const struct gllist handsy_model_finger_distal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 876, handsy_model_finger_distal_data, 0
-};
-const struct gllist *handsy_model_finger_distal = &handsy_model_finger_distal_frame;
-
-static const float handsy_model_finger_intermediate_data[] = {
-	0,1,0,-0.191233,0.158996,0.888552,
-	0,1,0,0,0.158996,1.000796,
-	0,1,0,-0.156938,0.158996,0.843858,
-	0,1,0,0,0.158996,1.000796,
-	0,1,0,-0.191233,0.158996,0.888552,
-	0,1,0,-0.213293,0.158996,0.941808,
-	0,1,0,0,0.158996,1.000796,
-	0,1,0,-0.213293,0.158996,0.941808,
-	0,1,0,-0.220817,0.158996,0.99896,
-	0,1,0,0,0.158996,1.000796,
-	0,1,0,-0.220817,0.158996,0.99896,
-	0,1,0,-0.213293,0.158996,1.056112,
-	0,1,0,0,0.158996,1.000796,
-	0,1,0,-0.213293,0.158996,1.056112,
-	0,1,0,0.220575,0.158996,1.000796,
-	0,1,0,0.220575,0.158996,1.000796,
-	0,1,0,-0.213293,0.158996,1.056112,
-	0,1,0,0.213293,0.158996,1.056112,
-	0,1,0,0.213293,0.158996,1.056112,
-	0,1,0,-0.213293,0.158996,1.056112,
-	0,1,0,-0.191233,0.158996,1.109368,
-	0,1,0,0.213293,0.158996,1.056112,
-	0,1,0,-0.191233,0.158996,1.109368,
-	0,1,0,0.191233,0.158996,1.109368,
-	0,1,0,0.191233,0.158996,1.109368,
-	0,1,0,-0.191233,0.158996,1.109368,
-	0,1,0,-0.156141,0.158996,1.155101,
-	0,1,0,0.191233,0.158996,1.109368,
-	0,1,0,-0.156141,0.158996,1.155101,
-	0,1,0,0.156141,0.158996,1.155101,
-	0,1,0,0.156141,0.158996,1.155101,
-	0,1,0,-0.156141,0.158996,1.155101,
-	0,1,0,-0.155102,0.158996,1.155898,
-	0,1,0,0.156141,0.158996,1.155101,
-	0,1,0,-0.155102,0.158996,1.155898,
-	0,1,0,0.110408,0.158996,1.190193,
-	0,1,0,0.110408,0.158996,1.190193,
-	0,1,0,-0.155102,0.158996,1.155898,
-	0,1,0,-0.110408,0.158996,1.190193,
-	0,1,0,0.110408,0.158996,1.190193,
-	0,1,0,-0.110408,0.158996,1.190193,
-	0,1,0,-0.057152,0.158996,1.212253,
-	0,1,0,0.110408,0.158996,1.190193,
-	0,1,0,-0.057152,0.158996,1.212253,
-	0,1,0,0.057152,0.158996,1.212253,
-	0,1,0,0.057152,0.158996,1.212253,
-	0,1,0,-0.057152,0.158996,1.212253,
-	0,1,0,0,0.158996,1.219777,
-	0,1,0,0.220575,0.158996,1.000796,
-	0,1,0,0.216568,0.158996,0.970359,
-	0,1,0,0,0.158996,1.000796,
-	-0.707107,0,0.707107,-0.156938,0,0.843858,
-	-0.707107,0,0.707107,-0.293114,0.07854,0.707681,
-	-0.707107,0,0.707107,-0.303917,0,0.696878,
-	-0.707107,0,0.707107,-0.293114,0.07854,0.707681,
-	-0.707107,0,0.707107,-0.156938,0,0.843858,
-	-0.707107,0,0.707107,-0.26163,0.151052,0.739165,
-	-0.707107,0,0.707107,-0.26163,0.151052,0.739165,
-	-0.707107,0,0.707107,-0.156938,0,0.843858,
-	-0.707107,0,0.707107,-0.212119,0.212119,0.788676,
-	-0.707107,0,0.707107,-0.212119,0.212119,0.788676,
-	-0.707107,0,0.707107,-0.156938,0,0.843858,
-	-0.707107,0,0.707107,-0.156938,0.158996,0.843858,
-	-0.707107,0,0.707107,-0.212119,0.212119,0.788676,
-	-0.707107,0,0.707107,-0.156938,0.158996,0.843858,
-	-0.707107,0,0.707107,-0.14863,0.257435,0.852165,
-	-0.707107,0,0.707107,-0.14863,0.257435,0.852165,
-	-0.707107,0,0.707107,-0.156938,0.158996,0.843858,
-	-0.707107,0,0.707107,0,0.158996,1.000796,
-	-0.707107,0,0.707107,-0.14863,0.257435,0.852165,
-	-0.707107,0,0.707107,0,0.158996,1.000796,
-	-0.707107,0,0.707107,-0.076132,0.28413,0.924663,
-	-0.707107,0,0.707107,-0.076132,0.28413,0.924663,
-	-0.707107,0,0.707107,0,0.158996,1.000796,
-	-0.707107,0,0.707107,0,0.290889,1.000796,
-	-0.97545,0.216024,0.042787,-0.293114,0.07854,0.707681,
-	-0.990551,0.130408,0.042462,-0.32007,0,0.32007,
-	-0.990551,0.130408,0.042462,-0.303917,0,0.696878,
-	-0.990551,0.130408,0.042462,-0.32007,0,0.32007,
-	-0.97545,0.216024,0.042787,-0.293114,0.07854,0.707681,
-	-0.952777,0.300643,0.042787,-0.309598,0.082956,0.309598,
-	-0.461128,0.886301,0.042787,-0.163393,0.283005,0.163393,
-	-0.300643,0.952777,0.042787,-0.076132,0.28413,0.924663,
-	-0.216024,0.97545,0.042787,-0.085443,0.318879,0.085443,
-	-0.300643,0.952777,0.042787,-0.076132,0.28413,0.924663,
-	-0.461128,0.886301,0.042787,-0.163393,0.283005,0.163393,
-	-0.536995,0.842499,0.042787,-0.14863,0.257435,0.852165,
-	-0.886301,0.461128,0.042787,-0.26163,0.151052,0.739165,
-	-0.952777,0.300643,0.042787,-0.309598,0.082956,0.309598,
-	-0.97545,0.216024,0.042787,-0.293114,0.07854,0.707681,
-	-0.952777,0.300643,0.042787,-0.309598,0.082956,0.309598,
-	-0.886301,0.461128,0.042787,-0.26163,0.151052,0.739165,
-	-0.842499,0.536995,0.042787,-0.278724,0.160921,0.278724,
-	-0.736753,0.674807,0.042787,-0.212119,0.212119,0.788676,
-	-0.842499,0.536995,0.042787,-0.278724,0.160921,0.278724,
-	-0.886301,0.461128,0.042787,-0.26163,0.151052,0.739165,
-	-0.842499,0.536995,0.042787,-0.278724,0.160921,0.278724,
-	-0.736753,0.674807,0.042787,-0.212119,0.212119,0.788676,
-	-0.674807,0.736753,0.042787,-0.229082,0.229082,0.229082,
-	-0.707107,0,-0.707107,-0.309598,0.082956,0.309598,
-	-0.707107,0,-0.707107,-0.188122,0,0.188122,
-	-0.707107,0,-0.707107,-0.32007,0,0.32007,
-	-0.707107,0,-0.707107,-0.188122,0,0.188122,
-	-0.707107,0,-0.707107,-0.309598,0.082956,0.309598,
-	-0.707107,0,-0.707107,-0.188122,0.191561,0.188122,
-	-0.707107,0,-0.707107,-0.188122,0.191561,0.188122,
-	-0.707107,0,-0.707107,-0.309598,0.082956,0.309598,
-	-0.707107,0,-0.707107,-0.278724,0.160921,0.278724,
-	-0.707107,0,-0.707107,-0.188122,0.191561,0.188122,
-	-0.707107,0,-0.707107,-0.278724,0.160921,0.278724,
-	-0.707107,0,-0.707107,-0.229082,0.229082,0.229082,
-	-0.707107,0,-0.707107,-0.188122,0.191561,0.188122,
-	-0.707107,0,-0.707107,-0.229082,0.229082,0.229082,
-	-0.707107,0,-0.707107,0,0.191561,0,
-	-0.707107,0,-0.707107,0,0.191561,0,
-	-0.707107,0,-0.707107,-0.229082,0.229082,0.229082,
-	-0.707107,0,-0.707107,0,0.333791,0,
-	-0.707107,0,-0.707107,0,0.333791,0,
-	-0.707107,0,-0.707107,-0.229082,0.229082,0.229082,
-	-0.707107,0,-0.707107,-0.163393,0.283005,0.163393,
-	-0.707107,0,-0.707107,0,0.333791,0,
-	-0.707107,0,-0.707107,-0.163393,0.283005,0.163393,
-	-0.707107,0,-0.707107,-0.085443,0.318879,0.085443,
-	-0.674807,0.736753,0.042787,-0.229082,0.229082,0.229082,
-	-0.536995,0.842499,0.042787,-0.14863,0.257435,0.852165,
-	-0.461128,0.886301,0.042787,-0.163393,0.283005,0.163393,
-	-0.536995,0.842499,0.042787,-0.14863,0.257435,0.852165,
-	-0.674807,0.736753,0.042787,-0.229082,0.229082,0.229082,
-	-0.736753,0.674807,0.042787,-0.212119,0.212119,0.788676,
-	-0.843272,0,-0.537487,-0.191233,0.158996,0.888552,
-	-0.793353,0,-0.608761,-0.156938,0,0.843858,
-	-0.887114,0,-0.461551,-0.191233,0,0.888552,
-	-0.793353,0,-0.608761,-0.156938,0,0.843858,
-	-0.843272,0,-0.537487,-0.191233,0.158996,0.888552,
-	-0.793353,0,-0.608761,-0.156938,0.158996,0.843858,
-	-0.522622,0,0.852565,-0.110408,0,1.190193,
-	-0.258819,0,0.965926,-0.057152,0.158996,1.212253,
-	-0.5,0,0.866025,-0.110408,0.158996,1.190193,
-	-0.258819,0,0.965926,-0.057152,0.158996,1.212253,
-	-0.522622,0,0.852565,-0.110408,0,1.190193,
-	-0.258819,0,0.965926,-0.057152,0,1.212253,
-	-1,0,0,-0.220817,0.158996,0.99896,
-	-0.976344,0,-0.216222,-0.213293,0,0.941808,
-	-1,0,0,-0.220817,0,0.99896,
-	-0.976344,0,-0.216222,-0.213293,0,0.941808,
-	-1,0,0,-0.220817,0.158996,0.99896,
-	-0.95365,0,-0.300918,-0.213293,0.158996,0.941808,
-	-0.95365,0,-0.300918,-0.213293,0.158996,0.941808,
-	-0.887114,0,-0.461551,-0.191233,0,0.888552,
-	-0.976344,0,-0.216222,-0.213293,0,0.941808,
-	-0.887114,0,-0.461551,-0.191233,0,0.888552,
-	-0.95365,0,-0.300918,-0.213293,0.158996,0.941808,
-	-0.843272,0,-0.537487,-0.191233,0.158996,0.888552,
-	-0.976344,0,0.216222,-0.213293,0.158996,1.056112,
-	-0.991445,0,0.130526,-0.220575,0,1.000796,
-	-0.95365,0,0.300918,-0.213293,0,1.056112,
-	-0.991445,0,0.130526,-0.220575,0,1.000796,
-	-1,0,0,-0.220817,0.158996,0.99896,
-	-1,0,0,-0.220817,0,0.99896,
-	-1,0,0,-0.220817,0.158996,0.99896,
-	-0.991445,0,0.130526,-0.220575,0,1.000796,
-	-0.976344,0,0.216222,-0.213293,0.158996,1.056112,
-	-0.707107,0,0.707107,-0.156141,0.158996,1.155101,
-	-0.843272,0,0.537487,-0.191233,0,1.109368,
-	-0.707107,0,0.707107,-0.156141,0,1.155101,
-	-0.843272,0,0.537487,-0.191233,0,1.109368,
-	-0.707107,0,0.707107,-0.156141,0.158996,1.155101,
-	-0.887114,0,0.461551,-0.191233,0.158996,1.109368,
-	-0.522622,0,0.852565,-0.110408,0,1.190193,
-	-0.707107,0,0.707107,-0.156141,0.158996,1.155101,
-	-0.707107,0,0.707107,-0.156141,0,1.155101,
-	-0.707107,0,0.707107,-0.156141,0.158996,1.155101,
-	-0.522622,0,0.852565,-0.110408,0,1.190193,
-	-0.608761,0,0.793353,-0.155102,0.158996,1.155898,
-	-0.608761,0,0.793353,-0.155102,0.158996,1.155898,
-	-0.522622,0,0.852565,-0.110408,0,1.190193,
-	-0.5,0,0.866025,-0.110408,0.158996,1.190193,
-	-0.887114,0,0.461551,-0.191233,0.158996,1.109368,
-	-0.95365,0,0.300918,-0.213293,0,1.056112,
-	-0.843272,0,0.537487,-0.191233,0,1.109368,
-	-0.95365,0,0.300918,-0.213293,0,1.056112,
-	-0.887114,0,0.461551,-0.191233,0.158996,1.109368,
-	-0.976344,0,0.216222,-0.213293,0.158996,1.056112,
-	0.95365,0,0.300918,0.213293,0.158996,1.056112,
-	0.887114,0,0.461551,0.191233,0,1.109368,
-	0.976344,0,0.216222,0.213293,0,1.056112,
-	0.887114,0,0.461551,0.191233,0,1.109368,
-	0.95365,0,0.300918,0.213293,0.158996,1.056112,
-	0.843272,0,0.537487,0.191233,0.158996,1.109368,
-	0,0,1,0,0,1.219777,
-	0.258819,0,0.965926,0.057152,0.158996,1.212253,
-	0,0,1,0,0.158996,1.219777,
-	0.258819,0,0.965926,0.057152,0.158996,1.212253,
-	0,0,1,0,0,1.219777,
-	0.258819,0,0.965926,0.057152,0,1.212253,
-	0.461551,0,0.887114,0.110408,0,1.190193,
-	0.258819,0,0.965926,0.057152,0.158996,1.212253,
-	0.258819,0,0.965926,0.057152,0,1.212253,
-	0.258819,0,0.965926,0.057152,0.158996,1.212253,
-	0.461551,0,0.887114,0.110408,0,1.190193,
-	0.537487,0,0.843272,0.110408,0.158996,1.190193,
-	1,0,0,0.220575,0.158996,1.000796,
-	0.976344,0,0.216222,0.213293,0,1.056112,
-	1,0,0,0.220575,0,1.000796,
-	0.976344,0,0.216222,0.213293,0,1.056112,
-	1,0,0,0.220575,0.158996,1.000796,
-	0.95365,0,0.300918,0.213293,0.158996,1.056112,
-	0,0,1,0,0,1.219777,
-	-0.258819,0,0.965926,-0.057152,0.158996,1.212253,
-	-0.258819,0,0.965926,-0.057152,0,1.212253,
-	-0.258819,0,0.965926,-0.057152,0.158996,1.212253,
-	0,0,1,0,0,1.219777,
-	0,0,1,0,0.158996,1.219777,
-	0.707107,0,0.707107,0.156141,0,1.155101,
-	0.537487,0,0.843272,0.110408,0.158996,1.190193,
-	0.461551,0,0.887114,0.110408,0,1.190193,
-	0.537487,0,0.843272,0.110408,0.158996,1.190193,
-	0.707107,0,0.707107,0.156141,0,1.155101,
-	0.707107,0,0.707107,0.156141,0.158996,1.155101,
-	0.843272,0,0.537487,0.191233,0.158996,1.109368,
-	0.707107,0,0.707107,0.156141,0,1.155101,
-	0.887114,0,0.461551,0.191233,0,1.109368,
-	0.707107,0,0.707107,0.156141,0,1.155101,
-	0.843272,0,0.537487,0.191233,0.158996,1.109368,
-	0.707107,0,0.707107,0.156141,0.158996,1.155101,
-	0.139173,0,-0.990268,0,0.333791,0,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0,0.191561,0,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0,0.333791,0,
-	0.139173,0,-0.990268,0.086257,0.321915,0.012123,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0.086257,0.321915,0.012123,
-	0.139173,0,-0.990268,0.166394,0.288203,0.023385,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0.166394,0.288203,0.023385,
-	0.139173,0,-0.990268,0.235024,0.235024,0.033031,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0.235024,0.235024,0.033031,
-	0.139173,0,-0.990268,0.249144,0.216485,0.035015,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0.249144,0.216485,0.035015,
-	0.139173,0,-0.990268,0.287571,0.166029,0.040415,
-	0.139173,0,-0.990268,0.261211,0.191561,0.036711,
-	0.139173,0,-0.990268,0.287571,0.166029,0.040415,
-	0.139173,0,-0.990268,0.261211,0,0.036711,
-	0.139173,0,-0.990268,0.261211,0,0.036711,
-	0.139173,0,-0.990268,0.287571,0.166029,0.040415,
-	0.139173,0,-0.990268,0.331792,0,0.04663,
-	0.139173,0,-0.990268,0.331792,0,0.04663,
-	0.139173,0,-0.990268,0.287571,0.166029,0.040415,
-	0.139173,0,-0.990268,0.320552,0.085892,0.045051,
-	0.300643,0.952777,0.042787,0.075405,0.281416,0.990198,
-	0.461128,0.886301,0.042787,0.166394,0.288203,0.023385,
-	0.216024,0.97545,0.042787,0.086257,0.321915,0.012123,
-	0.461128,0.886301,0.042787,0.166394,0.288203,0.023385,
-	0.300643,0.952777,0.042787,0.075405,0.281416,0.990198,
-	0.536995,0.842499,0.042787,0.145884,0.252679,0.980293,
-	0.842499,0.536995,0.042787,0.287571,0.166029,0.040415,
-	0.751338,0.658532,0.042736,0.20657,0.20657,0.971764,
-	0.886301,0.461128,0.042787,0.253239,0.146207,0.965205,
-	0.751338,0.658532,0.042736,0.20657,0.20657,0.971764,
-	0.842499,0.536995,0.042787,0.287571,0.166029,0.040415,
-	0.792638,0.608212,0.042462,0.249144,0.216485,0.035015,
-	0.751338,0.658532,0.042736,0.20657,0.20657,0.971764,
-	0.792638,0.608212,0.042462,0.249144,0.216485,0.035015,
-	0.674807,0.736753,0.042787,0.235024,0.235024,0.033031,
-	0.990551,0.130408,0.042462,0.331792,0,0.04663,
-	0.97545,0.216024,0.042787,0.282622,0.075728,0.961076,
-	0.990551,0.130408,0.042462,0.292652,0,0.959666,
-	0.97545,0.216024,0.042787,0.282622,0.075728,0.961076,
-	0.990551,0.130408,0.042462,0.331792,0,0.04663,
-	0.952777,0.300643,0.042787,0.320552,0.085892,0.045051,
-	0.536995,0.842499,0.042787,0.145884,0.252679,0.980293,
-	0.674807,0.736753,0.042787,0.235024,0.235024,0.033031,
-	0.461128,0.886301,0.042787,0.166394,0.288203,0.023385,
-	0.674807,0.736753,0.042787,0.235024,0.235024,0.033031,
-	0.536995,0.842499,0.042787,0.145884,0.252679,0.980293,
-	0.751338,0.658532,0.042736,0.20657,0.20657,0.971764,
-	0.952777,0.300643,0.042787,0.320552,0.085892,0.045051,
-	0.886301,0.461128,0.042787,0.253239,0.146207,0.965205,
-	0.97545,0.216024,0.042787,0.282622,0.075728,0.961076,
-	0.886301,0.461128,0.042787,0.253239,0.146207,0.965205,
-	0.952777,0.300643,0.042787,0.320552,0.085892,0.045051,
-	0.842499,0.536995,0.042787,0.287571,0.166029,0.040415,
-	0.991445,0,-0.130526,0.216568,0,0.970359,
-	1,0,0,0.220575,0.158996,1.000796,
-	1,0,0,0.220575,0,1.000796,
-	1,0,0,0.220575,0.158996,1.000796,
-	0.991445,0,-0.130526,0.216568,0,0.970359,
-	0.991445,0,-0.130526,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.292652,0,0.959666,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.216568,0,0.970359,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.292652,0,0.959666,
-	0.139173,0,0.990268,0.253239,0.146207,0.965205,
-	0.139173,0,0.990268,0.253239,0.146207,0.965205,
-	0.139173,0,0.990268,0.292652,0,0.959666,
-	0.139173,0,0.990268,0.282622,0.075728,0.961076,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0,0.290889,1.000796,
-	0.139173,0,0.990268,0,0.158996,1.000796,
-	0.139173,0,0.990268,0,0.290889,1.000796,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.075405,0.281416,0.990198,
-	0.139173,0,0.990268,0.075405,0.281416,0.990198,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.145884,0.252679,0.980293,
-	0.139173,0,0.990268,0.145884,0.252679,0.980293,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.20657,0.20657,0.971764,
-	0.139173,0,0.990268,0.20657,0.20657,0.971764,
-	0.139173,0,0.990268,0.216568,0.158996,0.970359,
-	0.139173,0,0.990268,0.253239,0.146207,0.965205,
-	0,0.999082,0.042828,0,0.290889,1.000796,
-	0.216024,0.97545,0.042787,0.086257,0.321915,0.012123,
-	0,0.999082,0.042828,0,0.333791,0,
-	0.216024,0.97545,0.042787,0.086257,0.321915,0.012123,
-	0,0.999082,0.042828,0,0.290889,1.000796,
-	0.300643,0.952777,0.042787,0.075405,0.281416,0.990198,
-	-0.216024,0.97545,0.042787,-0.085443,0.318879,0.085443,
-	0,0.999082,0.042828,0,0.290889,1.000796,
-	0,0.999082,0.042828,0,0.333791,0,
-	0,0.999082,0.042828,0,0.290889,1.000796,
-	-0.216024,0.97545,0.042787,-0.085443,0.318879,0.085443,
-	-0.300643,0.952777,0.042787,-0.076132,0.28413,0.924663
-};
-static const struct gllist handsy_model_finger_intermediate_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 327, handsy_model_finger_intermediate_data, 0
-};
-const struct gllist *handsy_model_finger_intermediate = &handsy_model_finger_intermediate_frame;
-
-static const float handsy_model_finger_metacarpal_data[] = {
-	-0.271764,0.083332,0.958749,-0.068185,0.017822,1.409438,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.271764,0.083332,0.958749,-0.068185,0.017822,1.409438,
-	-0.240936,0.15083,0.958749,-0.061306,0.034429,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.193688,0.208049,0.958749,-0.050363,0.04869,1.409438,
-	-0.240936,0.15083,0.958749,-0.061306,0.034429,1.409438,
-	0.240936,0.15083,0.958749,0.057958,0.034429,1.409438,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.193688,0.208049,0.958749,0.047016,0.04869,1.409438,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.240936,0.15083,0.958749,0.057958,0.034429,1.409438,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.707107,0.707107,0,-0.189796,0.188122,1.152459,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.707107,0.707107,0,-0.189796,0.188122,1.152459,
-	0.063714,0.27702,0.958749,0.016148,0.066511,1.409438,
-	0,0.258748,0.965945,-0.001674,0.068857,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.669251,0.426569,-0.608393,-0.174654,0.09987,0.979478,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.669251,0.426569,-0.608393,-0.174654,0.09987,0.979478,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.631406,0.484495,-0.605468,-0.164437,0.125955,0.989696,
-	-0.631406,0.484495,-0.605468,-0.164437,0.125955,0.989696,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.560986,0.560986,-0.608761,-0.154077,0.152403,1.000056,
-	-0.73389,0.096619,0.672361,-0.189796,0,1.340581,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.860389,0.113272,0.496891,-0.232075,0,1.285481,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.73389,0.096619,0.672361,-0.189796,0,1.340581,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.133242,0.25109,0.958749,-0.036102,0.059632,1.409438,
-	-0.193688,0.208049,0.958749,-0.050363,0.04869,1.409438,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.518154,0.845276,-0.130482,0.130129,0.228289,1.133935,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	0.233224,0.972067,0.026312,0.067184,0.256979,1.152459,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	0.233224,0.972067,0.026312,0.067184,0.256979,1.152459,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	0.233224,0.972067,0.026312,0.067184,0.256979,1.152459,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.063714,0.27702,0.958749,0.016148,0.066511,1.409438,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	0,0.258748,0.965945,-0.001674,0.068857,1.409438,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	0.063714,0.27702,0.958749,0.016148,0.066511,1.409438,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.133242,0.25109,0.958749,0.032755,0.059632,1.409438,
-	0.063714,0.27702,0.958749,0.016148,0.066511,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.540992,0.705035,-0.458534,-0.134696,0.185858,1.019437,
-	-0.560986,0.560986,-0.608761,-0.154077,0.152403,1.000056,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.233224,0.972067,0.026312,0.067184,0.256979,1.152459,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.251417,0.932613,0.258889,0.064837,0.248223,1.221316,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.540992,0.705035,-0.458534,-0.134696,0.185858,1.019437,
-	-0.638521,0.571249,-0.515718,-0.164592,0.162918,1.019437,
-	-0.540992,0.705035,-0.458534,-0.134696,0.185858,1.019437,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.496644,0.779191,-0.382369,-0.119932,0.204829,1.0342,
-	-0.496644,0.779191,-0.382369,-0.119932,0.204829,1.0342,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.508803,0.828671,-0.233292,-0.130163,0.222551,1.083601,
-	-0.30062,0.039577,0.952922,-0.070531,0,1.409438,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.536052,0.070573,0.84123,-0.134696,0,1.38286,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.30062,0.039577,0.952922,-0.070531,0,1.409438,
-	-0.271764,0.083332,0.958749,-0.068185,0.017822,1.409438,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.260647,0.826023,0.499749,0.057958,0.222551,1.285481,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0.179072,0.683956,0.707204,0.047016,0.181712,1.340581,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.240936,0.15083,0.958749,-0.061306,0.034429,1.409438,
-	-0.271764,0.083332,0.958749,-0.068185,0.017822,1.409438,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	-0.193688,0.208049,0.958749,-0.050363,0.04869,1.409438,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.193688,0.208049,0.958749,-0.050363,0.04869,1.409438,
-	-0.133242,0.25109,0.958749,-0.036102,0.059632,1.409438,
-	0.193688,0.208049,0.958749,0.047016,0.04869,1.409438,
-	0.133242,0.25109,0.958749,0.032755,0.059632,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	0.30062,0.039577,0.952922,0.067184,0,1.409438,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.271764,0.083332,0.958749,0.064837,0.017822,1.409438,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.30062,0.039577,0.952922,0.067184,0,1.409438,
-	0.536052,0.070573,0.84123,0.131348,0,1.38286,
-	0.73389,0.096619,0.672361,0.186448,0,1.340581,
-	0.828725,0.200239,0.522609,0.220877,0.059632,1.285481,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.828725,0.200239,0.522609,0.220877,0.059632,1.285481,
-	0.73389,0.096619,0.672361,0.186448,0,1.340581,
-	0.881074,0.115996,0.458534,0.228728,0,1.285481,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.968364,0.127487,0.21452,0.255305,0,1.221316,
-	0.98934,0.130249,-0.065125,0.264371,0,1.152459,
-	0.968364,0.127487,0.21452,0.255305,0,1.221316,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.271764,0.083332,0.958749,0.064837,0.017822,1.409438,
-	0.240936,0.15083,0.958749,0.057958,0.034429,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	0.193688,0.208049,0.958749,0.047016,0.04869,1.409438,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	0.133242,0.25109,0.958749,0.032755,0.059632,1.409438,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	0.193688,0.208049,0.958749,0.047016,0.04869,1.409438,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.536052,0.070573,0.84123,0.131348,0,1.38286,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.536052,0.070573,0.84123,0.131348,0,1.38286,
-	0.73389,0.096619,0.672361,0.186448,0,1.340581,
-	0.240936,0.15083,0.958749,0.057958,0.034429,1.409438,
-	0.193688,0.208049,0.958749,0.047016,0.04869,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.828725,0.200239,0.522609,0.220877,0.059632,1.285481,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.133242,0.25109,0.958749,0.032755,0.059632,1.409438,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0.063714,0.27702,0.958749,0.016148,0.066511,1.409438,
-	0.124567,0.48414,0.866078,0.032755,0.12849,1.38286,
-	0.133242,0.25109,0.958749,0.032755,0.059632,1.409438,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.789061,0.103882,-0.605468,-0.189796,0,0.964337,
-	-0.860389,0.113272,-0.496891,-0.232075,0,1.019437,
-	-0.789061,0.103882,-0.605468,-0.189796,0,0.964337,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.756851,0.23882,-0.608393,-0.186114,0.049421,0.968018,
-	-0.958191,0.126148,-0.256821,-0.258653,0,1.083601,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.860389,0.113272,-0.496891,-0.232075,0,1.019437,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.958191,0.126148,-0.256821,-0.258653,0,1.083601,
-	-0.919462,0.271766,-0.284135,-0.249897,0.066511,1.083601,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.946203,0.12457,0.298635,-0.258653,0,1.221316,
-	-0.860389,0.113272,0.496891,-0.232075,0,1.285481,
-	-0.946203,0.12457,0.298635,-0.258653,0,1.221316,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.23131,0.96409,-0.130482,-0.069322,0.252467,1.116977,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.845681,0.187285,0.499749,-0.224224,0.059632,1.285481,
-	-0.768392,0.399782,0.499749,-0.201207,0.115201,1.285481,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	-0.62945,0.60815,0.48368,-0.164592,0.162918,1.285481,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.707107,0.707107,0,-0.189796,0.188122,1.152459,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.756851,0.23882,-0.608393,-0.186114,0.049421,0.968018,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.756851,0.23882,-0.608393,-0.186114,0.049421,0.968018,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.669251,0.426569,-0.608393,-0.174654,0.09987,0.979478,
-	-0.240936,0.15083,0.958749,-0.061306,0.034429,1.409438,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.240936,0.15083,0.958749,-0.061306,0.034429,1.409438,
-	-0.193688,0.208049,0.958749,-0.050363,0.04869,1.409438,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.610252,0.357007,0.707204,-0.164592,0.094061,1.340581,
-	-0.497058,0.502787,0.707204,-0.134696,0.133022,1.340581,
-	-0.430421,0.254256,0.866078,-0.116874,0.066511,1.38286,
-	-0.349948,0.356994,0.866078,-0.095735,0.094061,1.38286,
-	-0.919462,0.271766,-0.284135,-0.249897,0.066511,1.083601,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.845681,0.187285,-0.499749,-0.224224,0.059632,1.019437,
-	-0.768392,0.399782,-0.499749,-0.201207,0.115201,1.019437,
-	-0.919462,0.271766,-0.284135,-0.249897,0.066511,1.083601,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.536052,0.070573,0.84123,-0.134696,0,1.38286,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.73389,0.096619,0.672361,-0.189796,0,1.340581,
-	-0.681859,0.186897,0.707204,-0.183386,0.04869,1.340581,
-	-0.536052,0.070573,0.84123,-0.134696,0,1.38286,
-	-0.481561,0.134192,0.866078,-0.130163,0.034429,1.38286,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.837235,0.481678,0.258889,-0.224224,0.12849,1.221316,
-	-0.843272,0.537487,0,-0.232075,0.133022,1.152459,
-	-0.69037,0.69037,0.216285,-0.183386,0.181712,1.221316,
-	-0.707107,0.707107,0,-0.189796,0.188122,1.152459,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	0,0.67533,0.737516,-0.001674,0.188122,1.340581,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	0.017501,0.856275,0.516223,-0.001674,0.230401,1.285481,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	0.001472,0.965906,0.258889,-0.001674,0.256979,1.221316,
-	-0.133242,0.25109,0.958749,-0.036102,0.059632,1.409438,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	-0.133242,0.25109,0.958749,-0.036102,0.059632,1.409438,
-	-0.063714,0.27702,0.958749,-0.019495,0.066511,1.409438,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	-0.245627,0.435403,0.866078,-0.068185,0.115201,1.38286,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	-0.349991,0.614303,0.707204,-0.095735,0.162918,1.340581,
-	-0.179072,0.683956,0.707204,-0.050363,0.181712,1.340581,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	0,0.258748,0.965945,-0.001674,0.068857,1.409438,
-	-0.063714,0.27702,0.958749,-0.019495,0.066511,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.063714,0.27702,0.958749,-0.019495,0.066511,1.409438,
-	-0.133242,0.25109,0.958749,-0.036102,0.059632,1.409438,
-	-0.373774,0.902371,-0.21452,-0.070531,0.247251,1.083601,
-	-0.496644,0.779191,-0.382369,-0.119932,0.204829,1.0342,
-	-0.508803,0.828671,-0.233292,-0.130163,0.222551,1.083601,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	-0.271764,0.083332,0.958749,-0.068185,0.017822,1.409438,
-	-0.30062,0.039577,0.952922,-0.070531,0,1.409438,
-	-0.23131,0.96409,-0.130482,-0.069322,0.252467,1.116977,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	-0.129428,0.983106,-0.129428,-0.03773,0.256551,1.116403,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	-0.23131,0.96409,-0.130482,-0.069322,0.252467,1.116977,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	-0.430509,0.751368,0.500107,-0.116874,0.199533,1.285481,
-	-0.221372,0.83719,0.500107,-0.061306,0.222551,1.285481,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.537487,0.843272,0,-0.134696,0.230401,1.152459,
-	-0.300918,0.95365,0,-0.070531,0.256979,1.152459,
-	-0.481678,0.837235,0.258889,-0.130163,0.222551,1.221316,
-	-0.248573,0.933374,0.258889,-0.068185,0.248223,1.221316,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.484228,0.835763,0.258889,0.126816,0.222551,1.221316,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.98934,0.130249,-0.065125,0.264371,0,1.152459,
-	0.950582,0.281725,-0.130482,0.254081,0.068529,1.142828,
-	0.30062,0.039577,0.952922,0.067184,0,1.409438,
-	0.271764,0.083332,0.958749,0.064837,0.017822,1.409438,
-	0,0.084475,0.996426,-0.001674,0,1.418503,
-	0.719272,0.682366,-0.130482,0.184019,0.185692,1.126361,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.871372,0.472954,-0.130482,0.226616,0.131803,1.133935,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.719272,0.682366,-0.130482,0.184019,0.185692,1.126361,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.233224,0.972067,0.026312,0.067184,0.256979,1.152459,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	-0.063714,0.27702,0.958749,-0.019495,0.066511,1.409438,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	-0.124567,0.48414,0.866078,-0.036102,0.12849,1.38286,
-	0,0.461451,0.887166,-0.001674,0.133022,1.38286,
-	-0.063714,0.27702,0.958749,-0.019495,0.066511,1.409438,
-	0,0.258748,0.965945,-0.001674,0.068857,1.409438,
-	0.518154,0.845276,-0.130482,0.130129,0.228289,1.133935,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.719272,0.682366,-0.130482,0.184019,0.185692,1.126361,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.518154,0.845276,-0.130482,0.130129,0.228289,1.133935,
-	0.461551,0.887114,0,0.131348,0.230401,1.152459,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.675426,0.737428,0,0.186448,0.188122,1.152459,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0.245627,0.435403,0.866078,0.064837,0.115201,1.38286,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0.349948,0.356994,0.866078,0.092387,0.094061,1.38286,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.684039,0.681958,0.258889,0.180038,0.181712,1.221316,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.837235,0.481678,0.258889,0.220877,0.12849,1.221316,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.871372,0.472954,-0.130482,0.226616,0.131803,1.133935,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.950582,0.281725,-0.130482,0.254081,0.068529,1.142828,
-	0.960718,0.276888,0.018801,0.255305,0.068857,1.152459,
-	0.871372,0.472954,-0.130482,0.226616,0.131803,1.133935,
-	0.843272,0.537487,0,0.228728,0.133022,1.152459,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.768392,0.399782,0.499749,0.19786,0.115201,1.285481,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.828725,0.200239,0.522609,0.220877,0.059632,1.285481,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	0.349991,0.614303,0.707204,0.092387,0.162918,1.340581,
-	0.465556,0.730417,0.499749,0.113527,0.199533,1.285481,
-	0.497058,0.502787,0.707204,0.131348,0.133022,1.340581,
-	0.638738,0.585034,0.499749,0.161245,0.162918,1.285481,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	0.610252,0.357007,0.707204,0.161245,0.094061,1.340581,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.681859,0.186897,0.707204,0.180038,0.04869,1.340581,
-	0.271764,0.083332,0.958749,0.064837,0.017822,1.409438,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	0.240936,0.15083,0.958749,0.057958,0.034429,1.409438,
-	0.430421,0.254256,0.866078,0.113527,0.066511,1.38286,
-	0.271764,0.083332,0.958749,0.064837,0.017822,1.409438,
-	0.481561,0.134192,0.866078,0.126816,0.034429,1.38286,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.881074,0.115996,0.458534,0.228728,0,1.285481,
-	0.968364,0.127487,0.21452,0.255305,0,1.221316,
-	0.881074,0.115996,0.458534,0.228728,0,1.285481,
-	0.921136,0.246818,0.30098,0.246549,0.066511,1.221316,
-	0.828725,0.200239,0.522609,0.220877,0.059632,1.285481,
-	0,0,-1,-0.309053,0.082357,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.319896,0,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.309053,0.082357,-0.029987,
-	0,0,-1,-0.277265,0.1591,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.277265,0.1591,-0.029987,
-	0,0,-1,-0.226697,0.225002,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.226697,0.225002,-0.029987,
-	0,0,-1,-0.160795,0.275569,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.160795,0.275569,-0.029987,
-	0,0,-1,-0.084051,0.307358,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.084051,0.307358,-0.029987,
-	0,0,-1,-0.001695,0.3182,-0.029987,
-	0,0,-1,-0.001696,0,-0.029987,
-	0,0,-1,-0.001695,0.3182,-0.029987,
-	0,0,-1,-0.00158,0,-0.029987,
-	0,0,-1,-0.00158,0,-0.029987,
-	0,0,-1,-0.001695,0.3182,-0.029987,
-	0,0,-1,0.080661,0.307357,-0.029987,
-	0,0,-1,-0.00158,0,-0.029987,
-	0,0,-1,0.080661,0.307357,-0.029987,
-	0,0,-1,0,0,-0.029987,
-	0,0,-1,0,0,-0.029987,
-	0,0,-1,0.080661,0.307357,-0.029987,
-	0,0,-1,0.316504,0,-0.029987,
-	0,0,-1,0.316504,0,-0.029987,
-	0,0,-1,0.080661,0.307357,-0.029987,
-	0,0,-1,0.157405,0.275569,-0.029987,
-	0,0,-1,0.316504,0,-0.029987,
-	0,0,-1,0.157405,0.275569,-0.029987,
-	0,0,-1,0.223306,0.225001,-0.029987,
-	0,0,-1,0.316504,0,-0.029987,
-	0,0,-1,0.223306,0.225001,-0.029987,
-	0,0,-1,0.273874,0.1591,-0.029987,
-	0,0,-1,0.316504,0,-0.029987,
-	0,0,-1,0.273874,0.1591,-0.029987,
-	0,0,-1,0.305662,0.082356,-0.029987,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.991445,0.130526,0,-0.267718,0,1.152459,
-	-0.946203,0.12457,0.298635,-0.258653,0,1.221316,
-	-0.991445,0.130526,0,-0.267718,0,1.152459,
-	-0.933374,0.248573,0.258889,-0.249897,0.066511,1.221316,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.95365,0.300918,0,-0.258653,0.068857,1.152459,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.991445,0.130526,0,-0.267718,0,1.152459,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	0.45761,0.879539,-0.130403,0.129251,0.226768,1.120589,
-	0.214376,0.968007,-0.130403,0.065975,0.252467,1.116977,
-	0.45761,0.879539,-0.130403,0.129251,0.226768,1.120589,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	0.518154,0.845276,-0.130482,0.130129,0.228289,1.133935,
-	0.518154,0.845276,-0.130482,0.130129,0.228289,1.133935,
-	0.719272,0.682366,-0.130482,0.184019,0.185692,1.126361,
-	0.45761,0.879539,-0.130403,0.129251,0.226768,1.120589,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	0,0.991445,-0.130526,-0.001674,0.261211,1.115748,
-	-0.129428,0.983106,-0.129428,-0.03773,0.256551,1.116403,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	0.214376,0.968007,-0.130403,0.065975,0.252467,1.116977,
-	0,0.991445,-0.130526,-0.001674,0.261211,1.115748,
-	0.214376,0.968007,-0.130403,0.065975,0.252467,1.116977,
-	-0.014612,0.998932,-0.043837,-0.001674,0.266045,1.152459,
-	0.298349,0.945507,-0.130403,0.066855,0.255755,1.142828,
-	0.719272,0.682366,-0.130482,0.184019,0.185692,1.126361,
-	0.871372,0.472954,-0.130482,0.226616,0.131803,1.133935,
-	0.879539,0.45761,-0.130403,0.225094,0.130924,1.120589,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.373774,0.902371,-0.21452,-0.070531,0.247251,1.083601,
-	-0.508803,0.828671,-0.233292,-0.130163,0.222551,1.083601,
-	-0.373774,0.902371,-0.21452,-0.070531,0.247251,1.083601,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.298349,0.945507,-0.130403,-0.068262,0.248511,1.08587,
-	-0.298349,0.945507,-0.130403,-0.068262,0.248511,1.08587,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.281725,0.950582,-0.130482,-0.06928,0.252311,1.115748,
-	-0.281725,0.950582,-0.130482,-0.06928,0.252311,1.115748,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.281725,0.950582,-0.130482,-0.06928,0.252311,1.115748,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.23131,0.96409,-0.130482,-0.069322,0.252467,1.116977,
-	-0.603641,0.78668,-0.129428,-0.186378,0.184704,1.115748,
-	-0.508803,0.828671,-0.233292,-0.130163,0.222551,1.083601,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.508803,0.828671,-0.233292,-0.130163,0.222551,1.083601,
-	-0.603641,0.78668,-0.129428,-0.186378,0.184704,1.115748,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.603641,0.78668,-0.129428,-0.186378,0.184704,1.115748,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.479491,0.867789,-0.130504,-0.13228,0.226216,1.115748,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.45761,0.879539,-0.130403,-0.132598,0.226768,1.120589,
-	-0.916109,0.379465,-0.129428,-0.253985,0.067606,1.115748,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.919462,0.271766,-0.284135,-0.249897,0.066511,1.083601,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.916109,0.379465,-0.129428,-0.253985,0.067606,1.115748,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.431564,-0.902025,0.010166,-0.224224,0.12849,1.083601,
-	-0.431564,-0.902025,0.010166,-0.229963,0.131803,1.133935,
-	-0.431564,-0.902025,0.010166,-0.22789,0.130606,1.115748,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.983106,0.129428,-0.129428,-0.262885,0,1.115748,
-	-0.991445,0.130526,0,-0.267718,0,1.152459,
-	-0.983106,0.129428,-0.129428,-0.262885,0,1.115748,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.958191,0.126148,-0.256821,-0.258653,0,1.083601,
-	-0.958191,0.126148,-0.256821,-0.258653,0,1.083601,
-	-0.962321,0.238552,-0.130504,-0.257428,0.068529,1.142828,
-	-0.919462,0.271766,-0.284135,-0.249897,0.066511,1.083601,
-	-0.302618,-0.953093,-0.006007,-0.249897,0.066511,1.083601,
-	-0.302618,-0.953093,-0.006007,-0.257428,0.068529,1.142828,
-	-0.302618,-0.953093,-0.006007,-0.253985,0.067606,1.115748,
-	0.139173,0,0.990268,0.225094,0.130924,1.120589,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	0.046579,0.093184,0.994559,0.184019,0.185692,1.126361,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	0.139173,0,0.990268,0.225094,0.130924,1.120589,
-	0.139173,0,0.990268,0.250793,0.067648,1.116977,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	0.139173,0,0.990268,0.250793,0.067648,1.116977,
-	0.139173,0,0.990268,0.259538,0,1.115748,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	0.139173,0,0.990268,0.259538,0,1.115748,
-	0.139173,0,0.990268,0.371895,0,1.099957,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	0.139173,0,0.990268,0.371895,0,1.099957,
-	0.139173,0,0.990268,0.321932,0.186846,1.106979,
-	0.139173,0,0.990268,0.321932,0.186846,1.106979,
-	0.139173,0,0.990268,0.371895,0,1.099957,
-	0.139173,0,0.990268,0.35919,0.096699,1.101743,
-	-0.78668,0.603641,-0.129428,-0.22789,0.130606,1.115748,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.850426,0.467839,-0.240631,-0.224224,0.12849,1.083601,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.78668,0.603641,-0.129428,-0.22789,0.130606,1.115748,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.684559,0.681437,-0.258889,-0.183386,0.181712,1.083601,
-	-0.858616,0.495722,-0.130526,-0.229963,0.131803,1.133935,
-	-0.687753,0.714118,-0.130504,-0.187366,0.185692,1.126361,
-	-0.593496,-0.804597,0.019678,-0.183386,0.181712,1.083601,
-	-0.593496,-0.804597,0.019678,-0.187366,0.185692,1.126361,
-	-0.593496,-0.804597,0.019678,-0.186378,0.184704,1.115748,
-	0.968007,0.214376,-0.130403,0.250793,0.067648,1.116977,
-	0.98934,0.130249,-0.065125,0.264371,0,1.152459,
-	0.983106,0.129428,-0.129428,0.259538,0,1.115748,
-	0.98934,0.130249,-0.065125,0.264371,0,1.152459,
-	0.968007,0.214376,-0.130403,0.250793,0.067648,1.116977,
-	0.950582,0.281725,-0.130482,0.254081,0.068529,1.142828,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.358292,0.09555,0.795841,
-	-0.707107,0,0.707107,-0.370691,0,0.783442,
-	-0.707107,0,0.707107,-0.358292,0.09555,0.795841,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.321869,0.184852,0.832264,
-	-0.707107,0,0.707107,-0.321869,0.184852,0.832264,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.291911,0.224602,0.862221,
-	-0.707107,0,0.707107,-0.291911,0.224602,0.862221,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.263713,0.262018,0.89042,
-	-0.707107,0,0.707107,-0.263713,0.262018,0.89042,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.187523,0.321863,0.96661,
-	-0.707107,0,0.707107,-0.187523,0.321863,0.96661,
-	-0.707107,0,0.707107,-0.189796,0,0.964337,
-	-0.707107,0,0.707107,-0.186114,0.049421,0.968018,
-	-0.707107,0,0.707107,-0.187523,0.321863,0.96661,
-	-0.707107,0,0.707107,-0.186114,0.049421,0.968018,
-	-0.707107,0,0.707107,-0.174654,0.09987,0.979478,
-	-0.707107,0,0.707107,-0.187523,0.321863,0.96661,
-	-0.707107,0,0.707107,-0.174654,0.09987,0.979478,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707107,0,0.707107,-0.174654,0.09987,0.979478,
-	-0.707107,0,0.707107,-0.164437,0.125955,0.989696,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707107,0,0.707107,-0.164437,0.125955,0.989696,
-	-0.707107,0,0.707107,-0.154077,0.152403,1.000056,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707107,0,0.707107,-0.154077,0.152403,1.000056,
-	-0.707107,0,0.707107,-0.134696,0.185858,1.019437,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707107,0,0.707107,-0.134696,0.185858,1.019437,
-	-0.707107,0,0.707107,-0.119932,0.204829,1.0342,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707107,0,0.707107,-0.119932,0.204829,1.0342,
-	-0.707123,-0.000029,0.70709,-0.070531,0.247251,1.083601,
-	-0.707116,-0.000005,0.707098,-0.098222,0.360243,1.055911,
-	-0.707123,-0.000029,0.70709,-0.070531,0.247251,1.083601,
-	-0.707121,-0.000046,0.707093,-0.053235,0.366819,1.100906,
-	-0.707121,-0.000046,0.707093,-0.053235,0.366819,1.100906,
-	-0.707123,-0.000029,0.70709,-0.070531,0.247251,1.083601,
-	-0.707096,-0.000054,0.707118,-0.068262,0.248511,1.08587,
-	-0.707121,-0.000046,0.707093,-0.053235,0.366819,1.100906,
-	-0.707096,-0.000054,0.707118,-0.068262,0.248511,1.08587,
-	-0.7071,-0.000053,0.707114,-0.03773,0.256551,1.116403,
-	0.879539,0.45761,-0.130403,0.225094,0.130924,1.120589,
-	0.950582,0.281725,-0.130482,0.254081,0.068529,1.142828,
-	0.968007,0.214376,-0.130403,0.250793,0.067648,1.116977,
-	0.950582,0.281725,-0.130482,0.254081,0.068529,1.142828,
-	0.879539,0.45761,-0.130403,0.225094,0.130924,1.120589,
-	0.871372,0.472954,-0.130482,0.226616,0.131803,1.133935,
-	-0.281725,0.950582,-0.130482,-0.06928,0.252311,1.115748,
-	-0.129428,0.983106,-0.129428,-0.03773,0.256551,1.116403,
-	-0.298349,0.945507,-0.130403,-0.068262,0.248511,1.08587,
-	-0.129428,0.983106,-0.129428,-0.03773,0.256551,1.116403,
-	-0.281725,0.950582,-0.130482,-0.06928,0.252311,1.115748,
-	-0.23131,0.96409,-0.130482,-0.069322,0.252467,1.116977,
-	0,0.139173,0.990268,-0.03773,0.256551,1.116403,
-	0,0.139173,0.990268,-0.001695,0.373591,1.099954,
-	0,0.139173,0.990268,-0.053235,0.366819,1.100906,
-	0,0.139173,0.990268,-0.001695,0.373591,1.099954,
-	0,0.139173,0.990268,-0.03773,0.256551,1.116403,
-	0,0.139173,0.990268,-0.001674,0.261211,1.115748,
-	0,0.139173,0.990268,-0.001695,0.373591,1.099954,
-	0,0.139173,0.990268,-0.001674,0.261211,1.115748,
-	0,0.139173,0.990268,0.095004,0.360886,1.10174,
-	0,0.139173,0.990268,0.095004,0.360886,1.10174,
-	0,0.139173,0.990268,-0.001674,0.261211,1.115748,
-	0,0.139173,0.990268,0.065975,0.252467,1.116977,
-	0,0.139173,0.990268,0.095004,0.360886,1.10174,
-	0,0.139173,0.990268,0.065975,0.252467,1.116977,
-	0,0.139173,0.990268,0.129251,0.226768,1.120589,
-	0,0.139173,0.990268,0.095004,0.360886,1.10174,
-	0,0.139173,0.990268,0.129251,0.226768,1.120589,
-	-0.000013,0.139173,0.990268,0.185151,0.323627,1.106976,
-	-0.000013,0.139173,0.990268,0.185151,0.323627,1.106976,
-	0,0.139173,0.990268,0.129251,0.226768,1.120589,
-	0.046579,0.093184,0.994559,0.184019,0.185692,1.126361,
-	-0.000013,0.139173,0.990268,0.185151,0.323627,1.106976,
-	0.046579,0.093184,0.994559,0.184019,0.185692,1.126361,
-	0.116285,0.023258,0.992944,0.262631,0.264326,1.115313,
-	-0.97404,0.217777,-0.061794,-0.309053,0.082357,-0.029987,
-	-0.98955,0.130278,-0.061793,-0.319896,0,-0.029987,
-	-0.989173,0.133263,-0.061463,-0.370691,0,0.783442,
-	-0.949542,0.307659,-0.060957,-0.358292,0.09555,0.795841,
-	-0.97404,0.217777,-0.061794,-0.309053,0.082357,-0.029987,
-	-0.989173,0.133263,-0.061463,-0.370691,0,0.783442,
-	-0.660522,0.748734,-0.055749,-0.263713,0.262018,0.89042,
-	-0.528009,0.847482,-0.054603,-0.160795,0.275569,-0.029987,
-	-0.742333,0.667567,-0.057413,-0.226697,0.225002,-0.029987,
-	-0.442076,0.895438,-0.052531,-0.187523,0.321863,0.96661,
-	-0.528009,0.847482,-0.054603,-0.160795,0.275569,-0.029987,
-	-0.660522,0.748734,-0.055749,-0.263713,0.262018,0.89042,
-	-0.442076,0.895438,-0.052531,-0.187523,0.321863,0.96661,
-	-0.290009,0.955643,-0.051395,-0.084051,0.307358,-0.029987,
-	-0.528009,0.847482,-0.054603,-0.160795,0.275569,-0.029987,
-	-0.182842,0.982288,-0.040983,-0.098222,0.360243,1.055911,
-	-0.290009,0.955643,-0.051395,-0.084051,0.307358,-0.029987,
-	-0.442076,0.895438,-0.052531,-0.187523,0.321863,0.96661,
-	-0.882868,0.465741,-0.060243,-0.277265,0.1591,-0.029987,
-	-0.97404,0.217777,-0.061794,-0.309053,0.082357,-0.029987,
-	-0.949542,0.307659,-0.060957,-0.358292,0.09555,0.795841,
-	-0.834162,0.548386,-0.058709,-0.321869,0.184852,0.832264,
-	-0.882868,0.465741,-0.060243,-0.277265,0.1591,-0.029987,
-	-0.949542,0.307659,-0.060957,-0.358292,0.09555,0.795841,
-	0.706271,0.706269,-0.048625,0.223306,0.225001,-0.029987,
-	0.841431,0.538172,-0.048629,0.321932,0.186846,1.106979,
-	0.885777,0.461542,-0.048757,0.273874,0.1591,-0.029987,
-	0.706276,0.706273,-0.048501,0.262631,0.264326,1.115313,
-	0.841431,0.538172,-0.048629,0.321932,0.186846,1.106979,
-	0.706271,0.706269,-0.048625,0.223306,0.225001,-0.029987,
-	-0.742333,0.667567,-0.057413,-0.226697,0.225002,-0.029987,
-	-0.882868,0.465741,-0.060243,-0.277265,0.1591,-0.029987,
-	-0.834162,0.548386,-0.058709,-0.321869,0.184852,0.832264,
-	0.538174,0.84143,-0.048629,0.185151,0.323627,1.106976,
-	0.706271,0.706269,-0.048625,0.223306,0.225001,-0.029987,
-	0.461545,0.885776,-0.048757,0.157405,0.275569,-0.029987,
-	0.706276,0.706273,-0.048501,0.262631,0.264326,1.115313,
-	0.706271,0.706269,-0.048625,0.223306,0.225001,-0.029987,
-	0.538174,0.84143,-0.048629,0.185151,0.323627,1.106976,
-	-0.182842,0.982288,-0.040983,-0.098222,0.360243,1.055911,
-	-0.038606,0.998033,-0.04939,-0.001695,0.3182,-0.029987,
-	-0.290009,0.955643,-0.051395,-0.084051,0.307358,-0.029987,
-	0.003996,0.999178,-0.040348,-0.001695,0.373591,1.099954,
-	-0.038606,0.998033,-0.04939,-0.001695,0.3182,-0.029987,
-	-0.182842,0.982288,-0.040983,-0.098222,0.360243,1.055911,
-	-0.130511,0.991342,-0.014393,-0.053235,0.366819,1.100906,
-	0.003996,0.999178,-0.040348,-0.001695,0.373591,1.099954,
-	-0.182842,0.982288,-0.040983,-0.098222,0.360243,1.055911,
-	-0.776405,0.627699,-0.056469,-0.291911,0.224602,0.862221,
-	-0.742333,0.667567,-0.057413,-0.226697,0.225002,-0.029987,
-	-0.834162,0.548386,-0.058709,-0.321869,0.184852,0.832264,
-	-0.742333,0.667567,-0.057413,-0.226697,0.225002,-0.029987,
-	-0.776405,0.627699,-0.056469,-0.291911,0.224602,0.862221,
-	-0.660522,0.748734,-0.055749,-0.263713,0.262018,0.89042,
-	0.003996,0.999178,-0.040348,-0.001695,0.373591,1.099954,
-	0.216169,0.975132,-0.048879,0.080661,0.307357,-0.029987,
-	-0.038606,0.998033,-0.04939,-0.001695,0.3182,-0.029987,
-	0.216169,0.975132,-0.048879,0.080661,0.307357,-0.029987,
-	0.003996,0.999178,-0.040348,-0.001695,0.373591,1.099954,
-	0.30134,0.952267,-0.048814,0.095004,0.360886,1.10174,
-	0.885777,0.461542,-0.048757,0.273874,0.1591,-0.029987,
-	0.952267,0.301337,-0.048814,0.35919,0.096699,1.101743,
-	0.975132,0.216167,-0.048879,0.305662,0.082356,-0.029987,
-	0.841431,0.538172,-0.048629,0.321932,0.186846,1.106979,
-	0.952267,0.301337,-0.048814,0.35919,0.096699,1.101743,
-	0.885777,0.461542,-0.048757,0.273874,0.1591,-0.029987,
-	0.30134,0.952267,-0.048814,0.095004,0.360886,1.10174,
-	0.461545,0.885776,-0.048757,0.157405,0.275569,-0.029987,
-	0.216169,0.975132,-0.048879,0.080661,0.307357,-0.029987,
-	0.538174,0.84143,-0.048629,0.185151,0.323627,1.106976,
-	0.461545,0.885776,-0.048757,0.157405,0.275569,-0.029987,
-	0.30134,0.952267,-0.048814,0.095004,0.360886,1.10174,
-	0.975132,0.216167,-0.048879,0.305662,0.082356,-0.029987,
-	0.990237,0.130681,-0.048519,0.371895,0,1.099957,
-	0.990276,0.130371,-0.048544,0.316504,0,-0.029987,
-	0.990237,0.130681,-0.048519,0.371895,0,1.099957,
-	0.975132,0.216167,-0.048879,0.305662,0.082356,-0.029987,
-	0.952267,0.301337,-0.048814,0.35919,0.096699,1.101743
-};
-static const struct gllist handsy_model_finger_metacarpal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 825, handsy_model_finger_metacarpal_data, 0
-};
-const struct gllist *handsy_model_finger_metacarpal = &handsy_model_finger_metacarpal_frame;
-
-static const float handsy_model_finger_proximal_data[] = {
-	-0.707107,0,0.707107,-0.188122,0,2.002282,
-	-0.537487,0,0.843272,-0.133022,0.191561,2.044561,
-	-0.707107,0,0.707107,-0.188122,0.191561,2.002282,
-	-0.537487,0,0.843272,-0.133022,0.191561,2.044561,
-	-0.707107,0,0.707107,-0.188122,0,2.002282,
-	-0.461551,0,0.887114,-0.133022,0,2.044561,
-	0.866025,0,0.5,0.230401,0,1.947182,
-	0.707107,0,0.707107,0.188122,0.191561,2.002282,
-	0.707107,0,0.707107,0.188122,0,2.002282,
-	0.707107,0,0.707107,0.188122,0.191561,2.002282,
-	0.866025,0,0.5,0.230401,0,1.947182,
-	0.866025,0,0.5,0.230401,0.191561,1.947182,
-	-0.866025,0,-0.5,-0.230401,0,1.681138,
-	-0.793353,0,-0.608761,-0.188122,0.191561,1.626038,
-	-0.793353,0,-0.608761,-0.188122,0,1.626038,
-	-0.793353,0,-0.608761,-0.188122,0.191561,1.626038,
-	-0.866025,0,-0.5,-0.230401,0,1.681138,
-	-0.866025,0,-0.5,-0.230401,0.191561,1.681138,
-	-0.866025,0,0.5,-0.230401,0.191561,1.947182,
-	-0.965926,0,0.258819,-0.256979,0,1.883018,
-	-0.866025,0,0.5,-0.230401,0,1.947182,
-	-0.965926,0,0.258819,-0.256979,0,1.883018,
-	-0.866025,0,0.5,-0.230401,0.191561,1.947182,
-	-0.965926,0,0.258819,-0.256979,0.191561,1.883018,
-	-0.461551,0,0.887114,-0.133022,0,2.044561,
-	-0.300918,0,0.95365,-0.068857,0.191561,2.071139,
-	-0.537487,0,0.843272,-0.133022,0.191561,2.044561,
-	-0.300918,0,0.95365,-0.068857,0.191561,2.071139,
-	-0.461551,0,0.887114,-0.133022,0,2.044561,
-	-0.216222,0,0.976344,-0.068857,0,2.071139,
-	0.043842,0,0.999038,0,0,2.080205,
-	0.216222,0,0.976344,0.068857,0.191561,2.071139,
-	-0.043842,0,0.999038,0,0.191561,2.080205,
-	0.216222,0,0.976344,0.068857,0.191561,2.071139,
-	0.043842,0,0.999038,0,0,2.080205,
-	0.300918,0,0.95365,0.068857,0,2.071139,
-	-1,0,0,-0.266045,0.191561,1.81416,
-	-0.976344,0,-0.216222,-0.256979,0,1.745303,
-	-1,0,0,-0.266045,0,1.81416,
-	-0.976344,0,-0.216222,-0.256979,0,1.745303,
-	-1,0,0,-0.266045,0.191561,1.81416,
-	-0.95365,0,-0.300918,-0.256979,0.191561,1.745303,
-	-0.965926,0,0.258819,-0.256979,0,1.883018,
-	-1,0,0,-0.266045,0.191561,1.81416,
-	-1,0,0,-0.266045,0,1.81416,
-	-1,0,0,-0.266045,0.191561,1.81416,
-	-0.965926,0,0.258819,-0.256979,0,1.883018,
-	-0.965926,0,0.258819,-0.256979,0.191561,1.883018,
-	-0.95365,0,-0.300918,-0.256979,0.191561,1.745303,
-	-0.866025,0,-0.5,-0.230401,0,1.681138,
-	-0.976344,0,-0.216222,-0.256979,0,1.745303,
-	-0.866025,0,-0.5,-0.230401,0,1.681138,
-	-0.95365,0,-0.300918,-0.256979,0.191561,1.745303,
-	-0.866025,0,-0.5,-0.230401,0.191561,1.681138,
-	0.300918,0,0.95365,0.068857,0,2.071139,
-	0.461551,0,0.887114,0.133022,0.191561,2.044561,
-	0.216222,0,0.976344,0.068857,0.191561,2.071139,
-	0.461551,0,0.887114,0.133022,0.191561,2.044561,
-	0.300918,0,0.95365,0.068857,0,2.071139,
-	0.537487,0,0.843272,0.133022,0,2.044561,
-	0.537487,0,0.843272,0.133022,0,2.044561,
-	0.707107,0,0.707107,0.188122,0.191561,2.002282,
-	0.461551,0,0.887114,0.133022,0.191561,2.044561,
-	0.707107,0,0.707107,0.188122,0.191561,2.002282,
-	0.537487,0,0.843272,0.133022,0,2.044561,
-	0.707107,0,0.707107,0.188122,0,2.002282,
-	-0.216222,0,0.976344,-0.068857,0,2.071139,
-	-0.043842,0,0.999038,0,0.191561,2.080205,
-	-0.300918,0,0.95365,-0.068857,0.191561,2.071139,
-	-0.043842,0,0.999038,0,0.191561,2.080205,
-	-0.216222,0,0.976344,-0.068857,0,2.071139,
-	0.043842,0,0.999038,0,0,2.080205,
-	1,0,0,0.266045,0.191561,1.81416,
-	0.976344,0,0.216222,0.256979,0,1.883018,
-	1,0,0,0.266045,0,1.81416,
-	0.976344,0,0.216222,0.256979,0,1.883018,
-	1,0,0,0.266045,0.191561,1.81416,
-	0.95365,0,0.300918,0.256979,0.191561,1.883018,
-	0.95365,0,0.300918,0.256979,0.191561,1.883018,
-	0.866025,0,0.5,0.230401,0,1.947182,
-	0.976344,0,0.216222,0.256979,0,1.883018,
-	0.866025,0,0.5,0.230401,0,1.947182,
-	0.95365,0,0.300918,0.256979,0.191561,1.883018,
-	0.866025,0,0.5,0.230401,0.191561,1.947182,
-	-0.707107,0,0.707107,-0.188122,0,2.002282,
-	-0.866025,0,0.5,-0.230401,0.191561,1.947182,
-	-0.866025,0,0.5,-0.230401,0,1.947182,
-	-0.866025,0,0.5,-0.230401,0.191561,1.947182,
-	-0.707107,0,0.707107,-0.188122,0,2.002282,
-	-0.707107,0,0.707107,-0.188122,0.191561,2.002282,
-	0,1,0,-0.230401,0.191561,1.681138,
-	0,0.999802,0.019917,0,0.191561,1.81416,
-	0,1,0,-0.188122,0.191561,1.626038,
-	0,0.999802,0.019917,0,0.191561,1.81416,
-	0,1,0,-0.230401,0.191561,1.681138,
-	0,1,0,-0.256979,0.191561,1.745303,
-	0,0.999802,0.019917,0,0.191561,1.81416,
-	0,1,0,-0.256979,0.191561,1.745303,
-	0,0.99969,0.024899,-0.266045,0.191561,1.81416,
-	0,0.999802,0.019917,0,0.191561,1.81416,
-	0,0.99969,0.024899,-0.266045,0.191561,1.81416,
-	0,0.999449,0.033205,0.266045,0.191561,1.81416,
-	0,0.999449,0.033205,0.266045,0.191561,1.81416,
-	0,0.99969,0.024899,-0.266045,0.191561,1.81416,
-	0,1,0,0.256979,0.191561,1.883018,
-	0,1,0,0.256979,0.191561,1.883018,
-	0,0.99969,0.024899,-0.266045,0.191561,1.81416,
-	0,1,0,-0.256979,0.191561,1.883018,
-	0,1,0,0.256979,0.191561,1.883018,
-	0,1,0,-0.256979,0.191561,1.883018,
-	0,1,0,-0.230401,0.191561,1.947182,
-	0,1,0,0.256979,0.191561,1.883018,
-	0,1,0,-0.230401,0.191561,1.947182,
-	0,1,0,0.230401,0.191561,1.947182,
-	0,1,0,0.230401,0.191561,1.947182,
-	0,1,0,-0.230401,0.191561,1.947182,
-	0,1,0,-0.188122,0.191561,2.002282,
-	0,1,0,0.230401,0.191561,1.947182,
-	0,1,0,-0.188122,0.191561,2.002282,
-	0,1,0,0.188122,0.191561,2.002282,
-	0,1,0,0.188122,0.191561,2.002282,
-	0,1,0,-0.188122,0.191561,2.002282,
-	0,1,0,-0.133022,0.191561,2.044561,
-	0,1,0,0.188122,0.191561,2.002282,
-	0,1,0,-0.133022,0.191561,2.044561,
-	0,1,0,0.133022,0.191561,2.044561,
-	0,1,0,0.133022,0.191561,2.044561,
-	0,1,0,-0.133022,0.191561,2.044561,
-	0,1,0,-0.068857,0.191561,2.071139,
-	0,1,0,0.133022,0.191561,2.044561,
-	0,1,0,-0.068857,0.191561,2.071139,
-	0,1,0,0.068857,0.191561,2.071139,
-	0,1,0,0.068857,0.191561,2.071139,
-	0,1,0,-0.068857,0.191561,2.071139,
-	0,1,0,0,0.191561,2.080205,
-	0,0.999449,0.033205,0.266045,0.191561,1.81416,
-	0,1,0,0.261211,0.191561,1.777449,
-	0,0.999802,0.019917,0,0.191561,1.81416,
-	-0.707107,0,0.707107,-0.188122,0.191561,1.626038,
-	-0.707107,0,0.707107,-0.342487,0,1.471673,
-	-0.707107,0,0.707107,-0.188122,0,1.626038,
-	-0.707107,0,0.707107,-0.342487,0,1.471673,
-	-0.707107,0,0.707107,-0.188122,0.191561,1.626038,
-	-0.707107,0,0.707107,-0.330524,0.088564,1.483636,
-	-0.707107,0,0.707107,-0.330524,0.088564,1.483636,
-	-0.707107,0,0.707107,-0.188122,0.191561,1.626038,
-	-0.707107,0,0.707107,-0.295571,0.170648,1.518589,
-	-0.707107,0,0.707107,-0.295571,0.170648,1.518589,
-	-0.707107,0,0.707107,-0.188122,0.191561,1.626038,
-	-0.707107,0,0.707107,-0.240341,0.240341,1.573819,
-	-0.707107,0,0.707107,-0.240341,0.240341,1.573819,
-	-0.707107,0,0.707107,-0.188122,0.191561,1.626038,
-	-0.707107,0,0.707107,0,0.191561,1.81416,
-	-0.707107,0,0.707107,-0.240341,0.240341,1.573819,
-	-0.707107,0,0.707107,0,0.191561,1.81416,
-	-0.707107,0,0.707107,0,0.333791,1.81416,
-	-0.707107,0,0.707107,-0.240341,0.240341,1.573819,
-	-0.707107,0,0.707107,0,0.333791,1.81416,
-	-0.707107,0,0.707107,-0.169041,0.292788,1.645119,
-	-0.707107,0,0.707107,-0.169041,0.292788,1.645119,
-	-0.707107,0,0.707107,0,0.333791,1.81416,
-	-0.707107,0,0.707107,-0.086963,0.32455,1.727197,
-	-0.975964,0.216853,0.021658,-0.330524,0.088564,1.483636,
-	-0.991173,0.130825,0.021489,-0.366435,0.000001,0.366435,
-	-0.991152,0.130986,0.021476,-0.342487,0,1.471673,
-	-0.991173,0.130825,0.021489,-0.366435,0.000001,0.366435,
-	-0.975964,0.216853,0.021658,-0.330524,0.088564,1.483636,
-	-0.953119,0.301819,0.021666,-0.35419,0.094905,0.35419,
-	-0.896223,0.443073,0.021681,-0.295571,0.170648,1.518589,
-	-0.953119,0.301819,0.021666,-0.35419,0.094905,0.35419,
-	-0.975964,0.216853,0.021658,-0.330524,0.088564,1.483636,
-	-0.953119,0.301819,0.021666,-0.35419,0.094905,0.35419,
-	-0.896223,0.443073,0.021681,-0.295571,0.170648,1.518589,
-	-0.92339,0.383259,0.021542,-0.346541,0.113724,0.346541,
-	-0.842269,0.538618,0.02175,-0.31821,0.183719,0.31821,
-	-0.92339,0.383259,0.021542,-0.346541,0.113724,0.346541,
-	-0.896223,0.443073,0.021681,-0.295571,0.170648,1.518589,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.842269,0.538618,0.02175,-0.31821,0.183719,0.31821,
-	-0.896223,0.443073,0.021681,-0.295571,0.170648,1.518589,
-	-0.842269,0.538618,0.02175,-0.31821,0.183719,0.31821,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.792488,0.609503,0.021646,-0.307808,0.19758,0.307808,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.793166,0.608618,0.021712,-0.288583,0.223321,0.288583,
-	-0.792488,0.609503,0.021646,-0.307808,0.19758,0.307808,
-	-0.793166,0.608618,0.021712,-0.288583,0.223321,0.288583,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.706937,0.706937,0.0219,-0.26068,0.26068,0.26068,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.60721,0.794242,0.021817,-0.193727,0.313888,0.193727,
-	-0.706937,0.706937,0.0219,-0.26068,0.26068,0.26068,
-	-0.60721,0.794242,0.021817,-0.193727,0.313888,0.193727,
-	-0.498092,0.866843,0.022094,-0.169041,0.292788,1.645119,
-	-0.498727,0.866479,0.022051,-0.185142,0.320676,0.185142,
-	-0.498092,0.866843,0.022094,-0.169041,0.292788,1.645119,
-	-0.60721,0.794242,0.021817,-0.193727,0.313888,0.193727,
-	-0.73645,0.676138,0.021861,-0.240341,0.240341,1.573819,
-	-0.498092,0.866843,0.022094,-0.169041,0.292788,1.645119,
-	-0.380786,0.924402,0.021972,-0.101338,0.357372,0.101338,
-	-0.498727,0.866479,0.022051,-0.185142,0.320676,0.185142,
-	-0.380786,0.924402,0.021972,-0.101338,0.357372,0.101338,
-	-0.230952,0.97271,0.022268,-0.086963,0.32455,1.727197,
-	-0.215222,0.976313,0.022187,-0.09634,0.359544,0.09634,
-	-0.230952,0.97271,0.022268,-0.086963,0.32455,1.727197,
-	-0.380786,0.924402,0.021972,-0.101338,0.357372,0.101338,
-	-0.498092,0.866843,0.022094,-0.169041,0.292788,1.645119,
-	-0.230952,0.97271,0.022268,-0.086963,0.32455,1.727197,
-	0.001487,0.999749,0.022361,0,0.373195,0.052449,
-	-0.129511,0.991332,0.022072,-0.002638,0.372856,0.052402,
-	0.001487,0.999749,0.022361,0,0.373195,0.052449,
-	-0.230952,0.97271,0.022268,-0.086963,0.32455,1.727197,
-	0.001487,0.999749,0.022361,0,0.333791,1.81416,
-	0.300843,0.953412,0.02234,0.0966,0.360517,0.050667,
-	0.461436,0.886892,0.02234,0.167158,0.289526,1.790668,
-	0.537353,0.843061,0.02234,0.186676,0.323332,0.045441,
-	0.461436,0.886892,0.02234,0.167158,0.289526,1.790668,
-	0.300843,0.953412,0.02234,0.0966,0.360517,0.050667,
-	0.194766,0.980596,0.022313,0.086462,0.32268,1.802009,
-	0.991201,0.130494,0.02217,0.373195,0,0.052449,
-	0.976101,0.216168,0.02234,0.323399,0.086654,1.768709,
-	0.991201,0.130494,0.02217,0.334843,0,1.767101,
-	0.976101,0.216168,0.02234,0.323399,0.086654,1.768709,
-	0.991201,0.130494,0.02217,0.373195,0,0.052449,
-	0.953412,0.300843,0.02234,0.360517,0.0966,0.050667,
-	0.843061,0.537353,0.02234,0.323332,0.186676,0.045441,
-	0.725293,0.688078,0.022354,0.236551,0.236551,1.780915,
-	0.886892,0.461436,0.02234,0.28986,0.167351,1.773423,
-	0.725293,0.688078,0.022354,0.236551,0.236551,1.780915,
-	0.843061,0.537353,0.02234,0.323332,0.186676,0.045441,
-	0.793158,0.608612,0.02217,0.280033,0.243325,0.039356,
-	0.725293,0.688078,0.022354,0.236551,0.236551,1.780915,
-	0.793158,0.608612,0.02217,0.280033,0.243325,0.039356,
-	0.70693,0.70693,0.022361,0.264131,0.264131,0.037121,
-	0.537353,0.843061,0.02234,0.186676,0.323332,0.045441,
-	0.725293,0.688078,0.022354,0.236551,0.236551,1.780915,
-	0.70693,0.70693,0.022361,0.264131,0.264131,0.037121,
-	0.725293,0.688078,0.022354,0.236551,0.236551,1.780915,
-	0.537353,0.843061,0.02234,0.186676,0.323332,0.045441,
-	0.461436,0.886892,0.02234,0.167158,0.289526,1.790668,
-	0.953412,0.300843,0.02234,0.360517,0.0966,0.050667,
-	0.886892,0.461436,0.02234,0.28986,0.167351,1.773423,
-	0.976101,0.216168,0.02234,0.323399,0.086654,1.768709,
-	0.886892,0.461436,0.02234,0.28986,0.167351,1.773423,
-	0.953412,0.300843,0.02234,0.360517,0.0966,0.050667,
-	0.843061,0.537353,0.02234,0.323332,0.186676,0.045441,
-	0.130494,0.991201,0.02217,0.037985,0.368209,0.051748,
-	0.194766,0.980596,0.022313,0.086462,0.32268,1.802009,
-	0.300843,0.953412,0.02234,0.0966,0.360517,0.050667,
-	0.194766,0.980596,0.022313,0.086462,0.32268,1.802009,
-	0.130494,0.991201,0.02217,0.037985,0.368209,0.051748,
-	0.001487,0.999749,0.022361,0,0.373195,0.052449,
-	0.194766,0.980596,0.022313,0.086462,0.32268,1.802009,
-	0.001487,0.999749,0.022361,0,0.373195,0.052449,
-	0.001487,0.999749,0.022361,0,0.333791,1.81416,
-	0.991445,0,-0.130526,0.261211,0,1.777449,
-	1,0,0,0.266045,0.191561,1.81416,
-	1,0,0,0.266045,0,1.81416,
-	1,0,0,0.266045,0.191561,1.81416,
-	0.991445,0,-0.130526,0.261211,0,1.777449,
-	0.991445,0,-0.130526,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0,0.191561,1.81416,
-	0.139173,0,0.990268,0.086462,0.32268,1.802009,
-	0.139173,0,0.990268,0,0.333791,1.81416,
-	0.139173,0,0.990268,0.086462,0.32268,1.802009,
-	0.139173,0,0.990268,0,0.191561,1.81416,
-	0.139173,0,0.990268,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0.086462,0.32268,1.802009,
-	0.139173,0,0.990268,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0.167158,0.289526,1.790668,
-	0.139173,0,0.990268,0.167158,0.289526,1.790668,
-	0.139173,0,0.990268,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0.236551,0.236551,1.780915,
-	0.139173,0,0.990268,0.236551,0.236551,1.780915,
-	0.139173,0,0.990268,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0.28986,0.167351,1.773423,
-	0.139173,0,0.990268,0.28986,0.167351,1.773423,
-	0.139173,0,0.990268,0.261211,0.191561,1.777449,
-	0.139173,0,0.990268,0.261211,0,1.777449,
-	0.139173,0,0.990268,0.28986,0.167351,1.773423,
-	0.139173,0,0.990268,0.261211,0,1.777449,
-	0.139173,0,0.990268,0.334843,0,1.767101,
-	0.139173,0,0.990268,0.28986,0.167351,1.773423,
-	0.139173,0,0.990268,0.334843,0,1.767101,
-	0.139173,0,0.990268,0.323399,0.086654,1.768709,
-	-0.215222,0.976313,0.022187,-0.09634,0.359544,0.09634,
-	-0.129511,0.991332,0.022072,-0.002638,0.372856,0.052402,
-	-0.130495,0.991204,0.022019,-0.0515,0.366444,0.0515,
-	-0.129511,0.991332,0.022072,-0.002638,0.372856,0.052402,
-	-0.215222,0.976313,0.022187,-0.09634,0.359544,0.09634,
-	-0.230952,0.97271,0.022268,-0.086963,0.32455,1.727197,
-	-0.707107,0,-0.707107,-0.366435,0.000001,0.366435,
-	-0.707107,0,-0.707107,-0.18444,0.049421,0.18444,
-	-0.707107,0,-0.707107,-0.188122,0,0.188122,
-	-0.707107,0,-0.707107,-0.18444,0.049421,0.18444,
-	-0.707107,0,-0.707107,-0.366435,0.000001,0.366435,
-	-0.707107,0,-0.707107,-0.35419,0.094905,0.35419,
-	-0.707107,0,-0.707107,-0.18444,0.049421,0.18444,
-	-0.707107,0,-0.707107,-0.35419,0.094905,0.35419,
-	-0.707107,0,-0.707107,-0.17298,0.09987,0.17298,
-	-0.707107,0,-0.707107,-0.17298,0.09987,0.17298,
-	-0.707107,0,-0.707107,-0.35419,0.094905,0.35419,
-	-0.707107,0,-0.707107,-0.346541,0.113724,0.346541,
-	-0.707107,0,-0.707107,-0.17298,0.09987,0.17298,
-	-0.707107,0,-0.707107,-0.346541,0.113724,0.346541,
-	-0.707107,0,-0.707107,-0.152403,0.152403,0.152403,
-	-0.707107,0,-0.707107,-0.152403,0.152403,0.152403,
-	-0.707107,0,-0.707107,-0.346541,0.113724,0.346541,
-	-0.707107,0,-0.707107,-0.31821,0.183719,0.31821,
-	-0.707107,0,-0.707107,-0.152403,0.152403,0.152403,
-	-0.707107,0,-0.707107,-0.31821,0.183719,0.31821,
-	-0.707107,0,-0.707107,-0.133022,0.185858,0.133022,
-	-0.707107,0,-0.707107,-0.133022,0.185858,0.133022,
-	-0.707107,0,-0.707107,-0.31821,0.183719,0.31821,
-	-0.707107,0,-0.707107,-0.307808,0.19758,0.307808,
-	-0.707107,0,-0.707107,-0.133022,0.185858,0.133022,
-	-0.707107,0,-0.707107,-0.307808,0.19758,0.307808,
-	-0.707107,0,-0.707107,-0.118258,0.204829,0.118258,
-	-0.707107,0,-0.707107,-0.118258,0.204829,0.118258,
-	-0.707107,0,-0.707107,-0.307808,0.19758,0.307808,
-	-0.707107,0,-0.707107,-0.288583,0.223321,0.288583,
-	-0.707107,0,-0.707107,-0.118258,0.204829,0.118258,
-	-0.707107,0,-0.707107,-0.288583,0.223321,0.288583,
-	-0.707107,0,-0.707107,-0.068857,0.247251,0.068857,
-	-0.707107,0,-0.707107,-0.068857,0.247251,0.068857,
-	-0.707107,0,-0.707107,-0.288583,0.223321,0.288583,
-	-0.707107,0,-0.707107,-0.26068,0.26068,0.26068,
-	-0.707107,0,-0.707107,-0.068857,0.247251,0.068857,
-	-0.707107,0,-0.707107,-0.26068,0.26068,0.26068,
-	-0.707107,0,-0.707107,-0.066588,0.248511,0.066588,
-	-0.707107,0,-0.707107,-0.066588,0.248511,0.066588,
-	-0.707107,0,-0.707107,-0.26068,0.26068,0.26068,
-	-0.707107,0,-0.707107,-0.036056,0.256551,0.036056,
-	-0.707107,0,-0.707107,-0.036056,0.256551,0.036056,
-	-0.707107,0,-0.707107,-0.26068,0.26068,0.26068,
-	-0.707107,0,-0.707107,-0.0515,0.366444,0.0515,
-	-0.707107,0,-0.707107,-0.0515,0.366444,0.0515,
-	-0.707107,0,-0.707107,-0.26068,0.26068,0.26068,
-	-0.707107,0,-0.707107,-0.193727,0.313888,0.193727,
-	-0.707107,0,-0.707107,-0.0515,0.366444,0.0515,
-	-0.707107,0,-0.707107,-0.193727,0.313888,0.193727,
-	-0.707107,0,-0.707107,-0.185142,0.320676,0.185142,
-	-0.707107,0,-0.707107,-0.0515,0.366444,0.0515,
-	-0.707107,0,-0.707107,-0.185142,0.320676,0.185142,
-	-0.707107,0,-0.707107,-0.101338,0.357372,0.101338,
-	-0.707107,0,-0.707107,-0.0515,0.366444,0.0515,
-	-0.707107,0,-0.707107,-0.101338,0.357372,0.101338,
-	-0.707107,0,-0.707107,-0.09634,0.359544,0.09634,
-	0,0.139173,-0.990268,-0.002638,0.372856,0.052402,
-	0,0.139173,-0.990268,-0.036056,0.256551,0.036056,
-	0,0.139173,-0.990268,-0.0515,0.366444,0.0515,
-	0,0.139173,-0.990268,-0.036056,0.256551,0.036056,
-	0,0.139173,-0.990268,-0.002638,0.372856,0.052402,
-	0,0.139173,-0.990268,0,0.261211,0.036711,
-	0,0.139173,-0.990268,0,0.261211,0.036711,
-	0,0.139173,-0.990268,-0.002638,0.372856,0.052402,
-	0,0.139173,-0.990268,0,0.373195,0.052449,
-	0,0.139173,-0.990268,0,0.261211,0.036711,
-	0,0.139173,-0.990268,0,0.373195,0.052449,
-	0,0.139173,-0.990268,0.037985,0.368209,0.051748,
-	0,0.139173,-0.990268,0,0.261211,0.036711,
-	0,0.139173,-0.990268,0.037985,0.368209,0.051748,
-	0,0.139173,-0.990268,0.067648,0.252467,0.035482,
-	0,0.139173,-0.990268,0.067648,0.252467,0.035482,
-	0,0.139173,-0.990268,0.037985,0.368209,0.051748,
-	0,0.139173,-0.990268,0.0966,0.360517,0.050667,
-	0,0.139173,-0.990268,0.067648,0.252467,0.035482,
-	0,0.139173,-0.990268,0.0966,0.360517,0.050667,
-	0,0.139173,-0.990268,0.130924,0.226768,0.03187,
-	0,0.139173,-0.990268,0.130924,0.226768,0.03187,
-	0,0.139173,-0.990268,0.0966,0.360517,0.050667,
-	0,0.139173,-0.990268,0.186676,0.323332,0.045441,
-	0,0.139173,-0.990268,0.130924,0.226768,0.03187,
-	0,0.139173,-0.990268,0.186676,0.323332,0.045441,
-	0.046592,0.093184,-0.994558,0.185692,0.185692,0.026097,
-	0.046592,0.093184,-0.994558,0.185692,0.185692,0.026097,
-	0,0.139173,-0.990268,0.186676,0.323332,0.045441,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.139173,0,-0.990268,0.226768,0.130924,0.03187,
-	0.046592,0.093184,-0.994558,0.185692,0.185692,0.026097,
-	0.139173,0,-0.990268,0.226768,0.130924,0.03187,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.139173,0,-0.990268,0.252467,0.067648,0.035482,
-	0.139173,0,-0.990268,0.252467,0.067648,0.035482,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.139173,0,-0.990268,0.261211,0,0.036711,
-	0.139173,0,-0.990268,0.261211,0,0.036711,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.139173,0,-0.990268,0.373195,0,0.052449,
-	0.139173,0,-0.990268,0.373195,0,0.052449,
-	0.116291,0.023258,-0.992943,0.264131,0.264131,0.037121,
-	0.139173,0,-0.990268,0.280033,0.243325,0.039356,
-	0.139173,0,-0.990268,0.373195,0,0.052449,
-	0.139173,0,-0.990268,0.280033,0.243325,0.039356,
-	0.139173,0,-0.990268,0.323332,0.186676,0.045441,
-	0.139173,0,-0.990268,0.373195,0,0.052449,
-	0.139173,0,-0.990268,0.323332,0.186676,0.045441,
-	0.139173,0,-0.990268,0.360517,0.0966,0.050667
-};
-static const struct gllist handsy_model_finger_proximal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 399, handsy_model_finger_proximal_data, 0
-};
-const struct gllist *handsy_model_finger_proximal = &handsy_model_finger_proximal_frame;
-
-static const float handsy_model_palm_data[] = {
-	-0.796278,-0.586351,-0.148771,-1.752137,-0.376692,1.970411,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.778493,-0.586351,-0.223921,-1.625487,-0.376692,1.429408,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.796278,-0.586351,-0.148771,-1.752137,-0.376692,1.970411,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.99148,-0.06721,-0.111576,1.895235,-0.072325,2.815815,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.99148,-0.06721,-0.111576,1.895235,-0.072325,2.815815,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.993491,0.012797,-0.11319,1.899624,0.039057,2.815569,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.764255,-0.087329,0.638974,0.764565,-0.313698,1.206288,
-	-0.764255,-0.087329,0.638974,0.777003,-0.306661,1.222126,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.764255,-0.087329,0.638974,0.751492,-0.31812,1.190048,
-	-0.764255,-0.087329,0.638974,0.764565,-0.313698,1.206288,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.764255,-0.087329,0.638974,0.777003,-0.306661,1.222126,
-	-0.704036,0.00442,0.71015,0.782018,-0.302539,1.228689,
-	-0.99549,0.01313,-0.09395,-1.917766,0.038992,2.709671,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.99549,0.01313,-0.09395,-1.917766,0.038992,2.709671,
-	-0.991055,0.095192,-0.093531,-1.913398,0.150374,2.710083,
-	0.034078,0,0.999419,1.769671,-0.351987,2.781136,
-	0.034078,0,0.999419,1.767439,0.429968,2.781212,
-	0.034078,0,0.999419,1.767439,-0.351987,2.781212,
-	0.034078,0,0.999419,1.767439,0.429968,2.781212,
-	0.034078,0,0.999419,1.769671,-0.351987,2.781136,
-	0.034078,0,0.999419,1.769671,0.429968,2.781136,
-	0.355139,-0.836018,-0.418271,1.449875,0.1157,1.455178,
-	0.364775,-0.836018,-0.409895,0.833554,-0.391356,1.942938,
-	0.36952,-0.836018,-0.405622,1.350509,0.1157,1.368801,
-	0.364775,-0.836018,-0.409895,0.833554,-0.391356,1.942938,
-	0.355139,-0.836018,-0.418271,1.449875,0.1157,1.455178,
-	0.350247,-0.836018,-0.422375,0.953272,-0.391356,2.047007,
-	-0.991055,0.095192,-0.093531,-1.913398,0.150374,2.710083,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.991055,0.095192,-0.093531,-1.913398,0.150374,2.710083,
-	-0.977364,0.1904,-0.092239,-1.900591,0.254166,2.711292,
-	0.03368,0,0.999433,1.567503,0.418917,3.581738,
-	-0.029634,0,0.999561,0.500177,0.469339,3.617705,
-	-0.108877,0,0.994055,0.500177,0.418917,3.617705,
-	-0.029634,0,0.999561,0.500177,0.469339,3.617705,
-	0.03368,0,0.999433,1.567503,0.418917,3.581738,
-	0.03368,0,0.999433,1.567503,0.469339,3.581738,
-	0,1,0,0.551147,-0.351987,2.822685,
-	0,1,0,1.767999,-0.351987,2.786146,
-	0,1,0,1.767439,-0.351987,2.781212,
-	0,1,0,1.767999,-0.351987,2.786146,
-	0,1,0,0.551147,-0.351987,2.822685,
-	0,1,0,1.567503,-0.351987,3.38714,
-	0,1,0,1.567503,-0.351987,3.38714,
-	0,1,0,0.551147,-0.351987,2.822685,
-	0,1,0,0.500177,-0.351986,3.423108,
-	0.006145,-0.999897,-0.012996,-1.473662,0.418917,3.101913,
-	0.01031,-0.999871,-0.012311,-1.343835,0.429973,2.308269,
-	0.003577,-0.999903,-0.013468,-0.407016,0.429972,2.665229,
-	-0.977364,0.1904,-0.092239,-1.900591,0.254166,2.711292,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	-0.977364,0.1904,-0.092239,-1.900591,0.254166,2.711292,
-	-0.94405,0.317539,-0.089095,-1.880219,0.343294,2.713215,
-	-0.94405,0.317539,-0.089095,-1.880219,0.343294,2.713215,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.94405,0.317539,-0.089095,-1.880219,0.343294,2.713215,
-	-0.853307,0.515153,-0.080531,-1.853669,0.411684,2.71572,
-	-0.005944,-0.999865,-0.015303,1.768126,0.429883,2.787255,
-	0.000209,-0.999904,-0.013883,0.551147,0.429969,2.822685,
-	-0.000476,-0.999903,-0.013922,1.767439,0.429968,2.781212,
-	0.000209,-0.999904,-0.013883,0.551147,0.429969,2.822685,
-	-0.005944,-0.999865,-0.015303,1.768126,0.429883,2.787255,
-	-0.008676,-0.999834,-0.015995,1.567503,0.418917,3.581738,
-	-0.99332,-0.067292,-0.093745,-1.913398,-0.07239,2.710083,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	-0.99332,-0.067292,-0.093745,-1.913398,-0.07239,2.710083,
-	-0.99549,0.01313,-0.09395,-1.917766,0.038992,2.709671,
-	-0.853307,0.515153,-0.080531,-1.853669,0.411684,2.71572,
-	-0.802204,0.586352,-0.112519,-1.752137,0.454676,1.970411,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.802204,0.586352,-0.112519,-1.752137,0.454676,1.970411,
-	-0.853307,0.515153,-0.080531,-1.853669,0.411684,2.71572,
-	-0.807042,0.585562,-0.076165,-1.822751,0.454676,2.718638,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.993491,0.012797,-0.11319,1.899624,0.039057,2.815569,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.993491,0.012797,-0.11319,1.899624,0.039057,2.815569,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.988875,0.094445,-0.114917,1.895316,0.150435,2.815811,
-	-0.243848,-0.96921,-0.034203,-1.719171,-0.391356,1.9758,
-	-0.400958,-0.915315,-0.037841,-1.822751,-0.376692,2.718638,
-	-0.395209,-0.915619,-0.073838,-1.752137,-0.376692,1.970411,
-	-0.400958,-0.915315,-0.037841,-1.822751,-0.376692,2.718638,
-	-0.243848,-0.96921,-0.034203,-1.719171,-0.391356,1.9758,
-	-0.204863,-0.9786,-0.019334,-1.789572,-0.391356,2.721769,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	0.383451,-0.836018,-0.392479,1.254219,0.1157,1.279009,
-	0.392479,-0.836018,-0.383451,0.605375,-0.391356,1.722588,
-	0.396914,-0.836018,-0.378858,1.16112,0.1157,1.185911,
-	0.392479,-0.836018,-0.383451,0.605375,-0.391356,1.722588,
-	0.383451,-0.836018,-0.392479,1.254219,0.1157,1.279009,
-	0.378858,-0.836018,-0.396914,0.717541,-0.391356,1.834754,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.986902,0,-0.161321,-1.846542,0.038992,1.95498,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.983637,0.081437,-0.160709,-1.842202,0.150374,1.955689,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	-0.97188,0.173999,-0.158661,-1.829477,0.254166,1.957769,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	0.001315,-0.999904,-0.013782,0.500177,0.418917,3.617705,
-	0.000209,-0.999904,-0.013883,0.551147,0.429969,2.822685,
-	-0.008676,-0.999834,-0.015995,1.567503,0.418917,3.581738,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.943079,0.294939,-0.153663,-1.809236,0.343294,1.961078,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.400957,0.915315,-0.037841,-1.822751,0.454676,2.718638,
-	-0.39815,0.915619,-0.055846,-1.71917,0.46934,1.9758,
-	-0.395209,0.915619,-0.073838,-1.752137,0.454676,1.970411,
-	-0.39815,0.915619,-0.055846,-1.71917,0.46934,1.9758,
-	-0.400957,0.915315,-0.037841,-1.822751,0.454676,2.718638,
-	-0.259904,0.965446,-0.019075,-1.789572,0.46934,2.721769,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.78424,0.585803,-0.204457,-1.625486,0.454676,1.429408,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.78424,0.585803,-0.204457,-1.625486,0.454676,1.429408,
-	-0.866472,0.479125,-0.140234,-1.782856,0.411684,1.96539,
-	-0.802204,0.586352,-0.112519,-1.752137,0.454676,1.970411,
-	-0.395209,0.915619,-0.073838,-1.752137,0.454676,1.970411,
-	-0.346553,0.933315,-0.093941,-1.593323,0.46934,1.438224,
-	-0.388183,0.91542,-0.106401,-1.625486,0.454676,1.429408,
-	-0.346553,0.933315,-0.093941,-1.593323,0.46934,1.438224,
-	-0.395209,0.915619,-0.073838,-1.752137,0.454676,1.970411,
-	-0.39815,0.915619,-0.055846,-1.71917,0.46934,1.9758,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.395209,-0.915619,-0.073838,-1.752137,-0.376692,1.970411,
-	-0.388183,-0.915419,-0.106401,-1.625487,-0.376692,1.429408,
-	-0.395209,-0.915619,-0.073838,-1.752137,-0.376692,1.970411,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.243848,-0.96921,-0.034203,-1.719171,-0.391356,1.9758,
-	-0.867417,-0.424499,0.259594,0.420331,-0.082341,0.724045,
-	-0.863914,-0.459936,0.205211,0.5388,-0.276944,0.801677,
-	-0.866464,-0.37452,0.330114,0.455635,-0.09635,0.818877,
-	-0.866464,-0.37452,0.330114,0.455635,-0.09635,0.818877,
-	-0.863914,-0.459936,0.205211,0.5388,-0.276944,0.801677,
-	-0.855881,-0.307094,0.416127,0.592896,-0.292953,0.956179,
-	-0.849718,-0.515316,0.111482,0.396675,-0.073374,0.659509,
-	-0.863914,-0.459936,0.205211,0.5388,-0.276944,0.801677,
-	-0.867417,-0.424499,0.259594,0.420331,-0.082341,0.724045,
-	0.41415,-0.835984,-0.360015,0.901767,-0.028687,1.229839,
-	0.41415,-0.835984,-0.360015,1.050087,0.1157,1.065186,
-	0.409895,-0.836018,-0.364775,1.071328,0.1157,1.08962,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.41415,-0.835984,-0.360015,0.901767,-0.028687,1.229839,
-	0.409895,-0.836018,-0.364775,1.071328,0.1157,1.08962,
-	0.001315,-0.999904,-0.013782,0.500177,0.418917,3.617705,
-	0.003577,-0.999903,-0.013468,-0.407016,0.429972,2.665229,
-	0.000209,-0.999904,-0.013883,0.551147,0.429969,2.822685,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.416058,-0.835881,-0.358048,0.868735,-0.0443,1.228096,
-	0.41415,-0.835984,-0.360015,0.901767,-0.028687,1.229839,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.441471,-0.737274,-0.511401,0.758404,-0.078952,1.180247,
-	0.456862,-0.836223,-0.303327,0.106845,-0.391356,1.106955,
-	0.467544,-0.836198,-0.286662,0.020451,-0.391356,0.973919,
-	0.463075,-0.836184,-0.293866,0.420331,-0.082341,0.724045,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.432927,-0.836473,-0.335988,0.293295,-0.391356,1.363581,
-	0.428434,-0.836046,-0.342742,0.643743,-0.099518,1.08978,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.847965,-0.218877,1.272403,
-	0.432927,-0.836473,-0.335988,0.293295,-0.391356,1.363581,
-	0.446744,-0.83622,-0.318052,0.19783,-0.391356,1.236895,
-	0.438762,-0.836856,-0.327354,0.551399,-0.104719,0.980011,
-	0.476257,-0.836327,-0.271544,-0.061249,-0.391356,0.837949,
-	0.482357,-0.836304,-0.260629,0.365067,-0.017684,0.431644,
-	0.474256,-0.836102,-0.275709,0.38175,-0.056076,0.582184,
-	0.476257,-0.836327,-0.271544,-0.061249,-0.391356,0.837949,
-	0.485531,-0.836253,-0.254835,-0.138153,-0.391356,0.69921,
-	0.482357,-0.836304,-0.260629,0.365067,-0.017684,0.431644,
-	0.001315,-0.999904,-0.013782,0.500177,0.418917,3.617705,
-	0.003527,-0.999903,-0.013502,-0.497427,0.418917,3.460249,
-	0.003577,-0.999903,-0.013468,-0.407016,0.429972,2.665229,
-	0.03368,0,0.999433,1.567503,-0.391357,3.38714,
-	-0.029634,0,0.999561,0.500177,-0.351986,3.423108,
-	-0.093083,0,0.995658,0.500177,-0.391356,3.423108,
-	-0.029634,0,0.999561,0.500177,-0.351986,3.423108,
-	0.03368,0,0.999433,1.567503,-0.391357,3.38714,
-	0.03368,0,0.999433,1.567503,-0.351987,3.38714,
-	0.485531,-0.836253,-0.254835,-0.138153,-0.391356,0.69921,
-	0.49078,-0.836227,-0.244662,0.378789,0.038394,0.270618,
-	0.482357,-0.836304,-0.260629,0.365067,-0.017684,0.431644,
-	0.485531,-0.836253,-0.254835,-0.138153,-0.391356,0.69921,
-	0.494701,-0.836109,-0.23705,-0.210168,-0.391356,0.557872,
-	0.49078,-0.836227,-0.244662,0.378789,0.038394,0.270618,
-	0.449874,-0.836148,-0.313798,0.549572,-0.104847,0.977734,
-	0.446744,-0.83622,-0.318052,0.19783,-0.391356,1.236895,
-	0.451622,-0.836275,-0.310937,0.477253,-0.098489,0.857111,
-	0.446744,-0.83622,-0.318052,0.19783,-0.391356,1.236895,
-	0.449874,-0.836148,-0.313798,0.549572,-0.104847,0.977734,
-	0.438762,-0.836856,-0.327354,0.551399,-0.104719,0.980011,
-	0.446744,-0.83622,-0.318052,0.19783,-0.391356,1.236895,
-	0.456862,-0.836223,-0.303327,0.106845,-0.391356,1.106955,
-	0.451622,-0.836275,-0.310937,0.477253,-0.098489,0.857111,
-	0.496685,-0.836056,-0.233057,0.406831,0.08212,0.174281,
-	0.500479,-0.836021,-0.224924,0.428578,0.1157,0.099871,
-	0.49734,-0.835984,-0.231914,0.435364,0.1157,0.114425,
-	0.494701,-0.836109,-0.23705,-0.210168,-0.391356,0.557872,
-	0.501259,-0.836022,-0.223175,-0.277207,-0.391356,0.414107,
-	0.500479,-0.836021,-0.224924,0.428578,0.1157,0.099871,
-	0.467544,-0.836198,-0.286662,0.020451,-0.391356,0.973919,
-	0.476257,-0.836327,-0.271544,-0.061249,-0.391356,0.837949,
-	0.474256,-0.836102,-0.275709,0.38175,-0.056076,0.582184,
-	0.340325,-0.836018,-0.430411,1.552194,0.1157,1.538035,
-	0.350247,-0.836018,-0.422375,0.953272,-0.391356,2.047007,
-	0.355139,-0.836018,-0.418271,1.449875,0.1157,1.455178,
-	0.350247,-0.836018,-0.422375,0.953272,-0.391356,2.047007,
-	0.340325,-0.836018,-0.430411,1.552194,0.1157,1.538035,
-	0.334033,-0.836012,-0.435321,1.076548,-0.391356,2.146834,
-	-0.631771,0.096094,0.769175,0.847965,-0.218877,1.272403,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.839604,-0.23778,1.267897,
-	-0.631771,0.096094,0.769175,0.839604,-0.23778,1.267897,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.829506,-0.255335,1.261796,
-	-0.631771,0.096094,0.769175,0.829506,-0.255335,1.261796,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.817839,-0.27125,1.254201,
-	-0.631771,0.096094,0.769175,0.817839,-0.27125,1.254201,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.804797,-0.285259,1.245239,
-	-0.631771,0.096094,0.769175,0.804797,-0.285259,1.245239,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.631771,0.096094,0.769175,0.790598,-0.297129,1.23506,
-	-0.631771,0.096094,0.769175,0.790598,-0.297129,1.23506,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.704036,0.00442,0.71015,0.782018,-0.302539,1.228689,
-	-0.866464,-0.37452,0.330114,0.455635,-0.09635,0.818877,
-	-0.855881,-0.307094,0.416127,0.592896,-0.292953,0.956179,
-	-0.844783,-0.265761,0.464449,0.477253,-0.098489,0.857111,
-	-0.824319,-0.208014,0.526525,0.538904,-0.105527,0.964835,
-	-0.855881,-0.307094,0.416127,0.592896,-0.292953,0.956179,
-	-0.78972,-0.133178,0.598838,0.682929,-0.311817,1.108903,
-	0.217148,-0.937956,-0.270342,1.594074,0.1157,1.569594,
-	0.334033,-0.836012,-0.435321,1.076548,-0.391356,2.146834,
-	0.340325,-0.836018,-0.430411,1.552194,0.1157,1.538035,
-	0.334033,-0.836012,-0.435321,1.076548,-0.391356,2.146834,
-	0.217148,-0.937956,-0.270342,1.594074,0.1157,1.569594,
-	0.25896,-0.861903,-0.435962,1.620844,0.074945,1.667507,
-	0.334033,-0.836012,-0.435321,1.076548,-0.391356,2.146834,
-	0.25896,-0.861903,-0.435962,1.620844,0.074945,1.667507,
-	0.318637,-0.836012,-0.446714,1.203234,-0.391356,2.242299,
-	-0.775202,-0.621236,-0.11458,0.365783,-0.037793,0.497331,
-	-0.813222,-0.581613,-0.01991,0.524328,-0.264882,0.655925,
-	-0.831264,-0.554669,0.036637,0.38175,-0.056076,0.582184,
-	0.003527,-0.999903,-0.013502,-0.497427,0.418917,3.460249,
-	0.006145,-0.999897,-0.012996,-1.473662,0.418917,3.101913,
-	0.003577,-0.999903,-0.013468,-0.407016,0.429972,2.665229,
-	0.396914,-0.836018,-0.378858,1.16112,0.1157,1.185911,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.409895,-0.836018,-0.364775,1.071328,0.1157,1.08962,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.396914,-0.836018,-0.378858,1.16112,0.1157,1.185911,
-	0.392479,-0.836018,-0.383451,0.605375,-0.391356,1.722588,
-	-0.831264,-0.554669,0.036637,0.38175,-0.056076,0.582184,
-	-0.813222,-0.581613,-0.01991,0.524328,-0.264882,0.655925,
-	-0.849718,-0.515316,0.111482,0.396675,-0.073374,0.659509,
-	-0.506327,0.717294,0.478667,0.690311,-0.091124,1.126951,
-	-0.52259,0.598335,0.607367,0.755695,-0.079224,1.178282,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.234792,0.969195,0.074391,0.755695,-0.079224,1.178282,
-	-0.234792,0.969195,0.074391,0.690311,-0.091124,1.126951,
-	-0.234792,0.969195,0.074391,0.753511,-0.079688,1.177433,
-	-0.849718,-0.515316,0.111482,0.396675,-0.073374,0.659509,
-	-0.813222,-0.581613,-0.01991,0.524328,-0.264882,0.655925,
-	-0.863914,-0.459936,0.205211,0.5388,-0.276944,0.801677,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.775202,-0.621236,-0.11458,0.365783,-0.037793,0.497331,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.813222,-0.581613,-0.01991,0.524328,-0.264882,0.655925,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.78972,-0.133178,0.598838,0.682929,-0.311817,1.108903,
-	-0.764255,-0.087329,0.638974,0.724321,-0.318876,1.157447,
-	-0.093958,0,0.995576,-1.913398,-0.07239,2.710083,
-	-0.093958,0,0.995576,-1.913398,0.150374,2.710083,
-	-0.093958,0,0.995576,-1.917766,0.038992,2.709671,
-	-0.093958,0,0.995576,-1.913398,0.150374,2.710083,
-	-0.093958,0,0.995576,-1.913398,-0.07239,2.710083,
-	-0.093958,0,0.995576,-1.900591,-0.176182,2.711292,
-	-0.093958,0,0.995576,-1.913398,0.150374,2.710083,
-	-0.093958,0,0.995576,-1.900591,-0.176182,2.711292,
-	-0.093958,0,0.995576,-1.900591,0.254166,2.711292,
-	-0.093958,0,0.995576,-1.900591,0.254166,2.711292,
-	-0.093958,0,0.995576,-1.900591,-0.176182,2.711292,
-	-0.093958,0,0.995576,-1.880219,-0.26531,2.713215,
-	-0.093958,0,0.995576,-1.900591,0.254166,2.711292,
-	-0.093958,0,0.995576,-1.880219,-0.26531,2.713215,
-	-0.093958,0,0.995576,-1.880219,0.343294,2.713215,
-	-0.093958,0,0.995576,-1.880219,0.343294,2.713215,
-	-0.093958,0,0.995576,-1.880219,-0.26531,2.713215,
-	-0.093958,0,0.995576,-1.853669,-0.3337,2.71572,
-	-0.093958,0,0.995576,-1.880219,0.343294,2.713215,
-	-0.093958,0,0.995576,-1.853669,-0.3337,2.71572,
-	-0.093958,0,0.995576,-1.853669,0.411684,2.71572,
-	-0.093958,0,0.995576,-1.853669,0.411684,2.71572,
-	-0.093958,0,0.995576,-1.853669,-0.3337,2.71572,
-	-0.093958,0,0.995576,-1.822751,-0.376692,2.718638,
-	-0.093958,0,0.995576,-1.853669,0.411684,2.71572,
-	-0.093958,0,0.995576,-1.822751,-0.376692,2.718638,
-	-0.093958,0,0.995576,-1.822751,0.454676,2.718638,
-	-0.093958,0,0.995576,-1.822751,0.454676,2.718638,
-	-0.093958,0,0.995576,-1.822751,-0.376692,2.718638,
-	-0.236443,0,0.971645,-1.789572,-0.391356,2.721769,
-	-0.093958,0,0.995576,-1.822751,0.454676,2.718638,
-	-0.236443,0,0.971645,-1.789572,-0.391356,2.721769,
-	-0.307512,0,0.951544,-1.789572,-0.351986,2.721769,
-	-0.093958,0,0.995576,-1.822751,0.454676,2.718638,
-	-0.307512,0,0.951544,-1.789572,-0.351986,2.721769,
-	-0.093958,0,0.995576,-1.789572,0.418917,2.721769,
-	-0.093958,0,0.995576,-1.822751,0.454676,2.718638,
-	-0.093958,0,0.995576,-1.789572,0.418917,2.721769,
-	-0.093958,0,0.995576,-1.789572,0.46934,2.721769,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.764255,-0.087329,0.638974,0.724321,-0.318876,1.157447,
-	-0.764255,-0.087329,0.638974,0.738003,-0.319856,1.173677,
-	-0.893766,-0.44053,-0.08435,-1.853669,-0.3337,2.71572,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.893766,-0.44053,-0.08435,-1.853669,-0.3337,2.71572,
-	-0.958343,-0.27092,-0.090444,-1.880219,-0.26531,2.713215,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.764255,-0.087329,0.638974,0.738003,-0.319856,1.173677,
-	-0.764255,-0.087329,0.638974,0.751492,-0.31812,1.190048,
-	-0.958343,-0.27092,-0.090444,-1.880219,-0.26531,2.713215,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.942922,-0.294938,-0.154627,-1.809236,-0.26531,1.961078,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.958343,-0.27092,-0.090444,-1.880219,-0.26531,2.713215,
-	-0.983266,-0.156769,-0.092796,-1.900591,-0.176182,2.711292,
-	-0.983266,-0.156769,-0.092796,-1.900591,-0.176182,2.711292,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.971815,-0.173999,-0.159059,-1.829477,-0.176182,1.957769,
-	-0.983612,-0.081436,-0.160861,-1.842202,-0.07239,1.955689,
-	-0.983266,-0.156769,-0.092796,-1.900591,-0.176182,2.711292,
-	-0.99332,-0.067292,-0.093745,-1.913398,-0.07239,2.710083,
-	-0.807042,-0.585562,-0.076165,-1.822751,-0.376692,2.718638,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	-0.796278,-0.586351,-0.148771,-1.752137,-0.376692,1.970411,
-	-0.866026,-0.479125,-0.142963,-1.782856,-0.3337,1.96539,
-	-0.807042,-0.585562,-0.076165,-1.822751,-0.376692,2.718638,
-	-0.893766,-0.44053,-0.08435,-1.853669,-0.3337,2.71572,
-	-0.397992,0.380616,0.834706,0.886816,-0.070199,1.246183,
-	-0.355285,0.355664,0.864451,0.868735,-0.0443,1.228096,
-	-0.452228,0.452832,0.768397,0.762622,-0.077692,1.181918,
-	-0.47928,0.243811,0.843117,0.865187,-0.178304,1.269373,
-	-0.490795,0.246987,0.835534,0.753511,-0.079688,1.177433,
-	-0.456234,0.272969,0.846958,0.857464,-0.198941,1.271864,
-	-0.456234,0.272969,0.846958,0.857464,-0.198941,1.271864,
-	-0.490795,0.246987,0.835534,0.753511,-0.079688,1.177433,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.507972,-0.702526,-0.498419,0.391924,0.064577,0.205552,
-	-0.507497,-0.702632,-0.498754,0.615433,-0.255562,0.429129,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.595393,-0.695809,-0.401693,0.378789,0.038394,0.270618,
-	-0.507972,-0.702526,-0.498419,0.391924,0.064577,0.205552,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.671967,-0.6777,-0.298635,0.364466,0.008825,0.342799,
-	-0.595393,-0.695809,-0.401693,0.378789,0.038394,0.270618,
-	0.277111,-0.836018,-0.473586,1.711893,-0.247344,2.31135,
-	0.288056,-0.836018,-0.46701,1.46621,-0.391356,2.419678,
-	0.29347,-0.836018,-0.463626,1.681237,-0.12504,2.075563,
-	0.288056,-0.836018,-0.46701,1.46621,-0.391356,2.419678,
-	0.277111,-0.836018,-0.473586,1.711893,-0.247344,2.31135,
-	0.270198,-0.836012,-0.477573,1.60218,-0.391356,2.501378,
-	0.262608,-0.840906,-0.473195,1.72906,-0.317688,2.443393,
-	0.270198,-0.836012,-0.477573,1.60218,-0.391356,2.501378,
-	0.277111,-0.836018,-0.473586,1.711893,-0.247344,2.31135,
-	0.270198,-0.836012,-0.477573,1.60218,-0.391356,2.501378,
-	0.262608,-0.840906,-0.473195,1.72906,-0.317688,2.443393,
-	0.285897,-0.82997,-0.478972,1.743775,-0.387364,2.572911,
-	0.270198,-0.836012,-0.477573,1.60218,-0.391356,2.501378,
-	0.285897,-0.82997,-0.478972,1.743775,-0.387364,2.572911,
-	0.266041,-0.835984,-0.479951,1.740919,-0.391356,2.578282,
-	0.29347,-0.836018,-0.463626,1.681237,-0.12504,2.075563,
-	0.304179,-0.836018,-0.456672,1.333174,-0.391356,2.333284,
-	0.309472,-0.836018,-0.453102,1.653081,-0.015885,1.859001,
-	0.304179,-0.836018,-0.456672,1.333174,-0.391356,2.333284,
-	0.29347,-0.836018,-0.463626,1.681237,-0.12504,2.075563,
-	0.288056,-0.836018,-0.46701,1.46621,-0.391356,2.419678,
-	0.240977,-0.859676,-0.450429,1.63484,0.05269,1.718695,
-	0.318637,-0.836012,-0.446714,1.203234,-0.391356,2.242299,
-	0.25896,-0.861903,-0.435962,1.620844,0.074945,1.667507,
-	0.318637,-0.836012,-0.446714,1.203234,-0.391356,2.242299,
-	0.240977,-0.859676,-0.450429,1.63484,0.05269,1.718695,
-	0.309472,-0.836018,-0.453102,1.653081,-0.015885,1.859001,
-	0.318637,-0.836012,-0.446714,1.203234,-0.391356,2.242299,
-	0.309472,-0.836018,-0.453102,1.653081,-0.015885,1.859001,
-	0.304179,-0.836018,-0.456672,1.333174,-0.391356,2.333284,
-	0.998221,0,-0.059628,1.772155,-0.391357,2.822721,
-	0.998221,0,-0.059628,1.792693,-0.351987,3.166558,
-	0.998221,0,-0.059628,1.792693,-0.391357,3.166558,
-	0.998221,0,-0.059628,1.792693,-0.351987,3.166558,
-	0.998221,0,-0.059628,1.772155,-0.391357,2.822721,
-	0.99627,0,-0.086285,1.772155,-0.351987,2.822721,
-	0.034078,0,0.999419,1.767439,-0.351987,2.781212,
-	-0.031469,0,0.999505,0.551147,0.429969,2.822685,
-	-0.097163,0,0.995268,0.551147,-0.351987,2.822685,
-	-0.031469,0,0.999505,0.551147,0.429969,2.822685,
-	0.034078,0,0.999419,1.767439,-0.351987,2.781212,
-	0.034078,0,0.999419,1.767439,0.429968,2.781212,
-	0.993609,0,-0.112881,1.767999,-0.351987,2.786146,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.99627,0,-0.086285,1.772155,-0.351987,2.822721,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.993609,0,-0.112881,1.767999,-0.351987,2.786146,
-	0.993609,0,-0.112881,1.767439,-0.351987,2.781212,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.993609,0,-0.112881,1.767439,-0.351987,2.781212,
-	0.993609,0,-0.112881,1.767439,0.429968,2.781212,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.993609,0,-0.112881,1.767439,0.429968,2.781212,
-	0.993609,0,-0.112881,1.768126,0.429883,2.787255,
-	-0.987753,0,0.156023,-1.760402,0.46934,2.906435,
-	-0.987753,0,0.156023,-1.789572,0.418917,2.721769,
-	-0.987753,0,0.156023,-1.760402,0.418917,2.906435,
-	-0.987753,0,0.156023,-1.789572,0.418917,2.721769,
-	-0.987753,0,0.156023,-1.760402,0.46934,2.906435,
-	-0.987753,0,0.156023,-1.789572,0.46934,2.721769,
-	0.141065,0.989418,0.033953,1.804276,0.469339,3.360463,
-	0.315789,0.947008,-0.058772,1.772155,0.469339,2.822721,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.302581,0.949833,-0.079128,-1.593323,0.46934,1.438224,
-	-0.224548,0.97391,-0.032814,-1.71917,0.452349,1.9758,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.326344,0.942627,-0.070391,1.744615,0.460772,2.580312,
-	0.326686,0.943881,-0.048628,1.72906,0.455932,2.443393,
-	0.326344,0.942627,-0.070391,1.744615,0.460772,2.580312,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.315789,0.947008,-0.058772,1.772155,0.469339,2.822721,
-	0.32092,-0.381383,-0.866924,0.854313,0.115699,0.11448,
-	0.176399,-0.477835,-0.860556,0.987772,-0.280632,0.35003,
-	0.101282,-0.521126,-0.847449,0.711069,0.115699,0.073242,
-	0.176399,-0.477835,-0.860556,0.987772,-0.280632,0.35003,
-	0.32092,-0.381383,-0.866924,0.854313,0.115699,0.11448,
-	0.390324,-0.328222,-0.860184,1.142772,-0.29747,0.403027,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.402704,-0.285122,0.576005,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.764255,0.087329,-0.638974,1.402704,-0.285122,0.576005,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.412052,-0.271114,0.589101,
-	0.764255,0.087329,-0.638974,1.412052,-0.271114,0.589101,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.420033,-0.2552,0.600822,
-	0.764255,0.087329,-0.638974,1.420033,-0.2552,0.600822,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.426514,-0.237645,0.610972,
-	0.764255,0.087329,-0.638974,1.426514,-0.237645,0.610972,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.431386,-0.218743,0.619383,
-	0.764255,0.087329,-0.638974,1.431386,-0.218743,0.619383,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.764255,0.087329,-0.638974,1.434568,-0.198808,0.625914,
-	0.764255,0.087329,-0.638974,1.434568,-0.198808,0.625914,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.797114,0.147609,-0.58551,1.435649,-0.183315,0.629324,
-	0.797114,0.147609,-0.58551,1.435649,-0.183315,0.629324,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.829874,0.221855,-0.511946,1.226889,0.115699,0.4205,
-	0.315789,0.947008,-0.058772,1.772155,0.469339,2.822721,
-	0.486592,0.869856,-0.08111,1.777642,0.445154,2.578459,
-	0.326344,0.942627,-0.070391,1.744615,0.460772,2.580312,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.591679,-0.141218,-0.793708,1.296236,-0.316855,0.491942,
-	0.518689,-0.21565,-0.827319,0.994243,0.115699,0.189857,
-	0.591679,-0.141218,-0.793708,1.296236,-0.316855,0.491942,
-	0.741813,0.050923,-0.66867,1.121322,0.115699,0.294234,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.591679,-0.141218,-0.793708,1.296236,-0.316855,0.491942,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.309184,-0.318742,0.502813,
-	0.631771,-0.096094,-0.769175,1.309184,-0.318742,0.502813,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.325375,-0.319721,0.516234,
-	0.631771,-0.096094,-0.769175,1.325375,-0.319721,0.516234,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.341703,-0.317985,0.529428,
-	0.631771,-0.096094,-0.769175,1.341703,-0.317985,0.529428,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.357896,-0.313562,0.542176,
-	0.631771,-0.096094,-0.769175,1.357896,-0.313562,0.542176,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.373684,-0.306525,0.554264,
-	0.631771,-0.096094,-0.769175,1.373684,-0.306525,0.554264,
-	0.650762,-0.073441,-0.755722,1.401838,-0.286095,0.574837,
-	0.631771,-0.096094,-0.769175,1.388803,-0.296992,0.565492,
-	0.315789,0.947008,-0.058772,1.772155,0.469339,2.822721,
-	0.400291,0.912767,-0.081386,1.805181,0.45469,2.820868,
-	0.486592,0.869856,-0.08111,1.777642,0.445154,2.578459,
-	0.986902,0,0.161321,-1.71917,0.46934,1.9758,
-	0.989006,0,0.147878,-1.71917,0.452349,1.9758,
-	0.973675,0,0.22794,-1.593323,0.46934,1.438224,
-	0.995576,0,0.093958,-1.789572,0.46934,2.721769,
-	0.989006,0,0.147878,-1.71917,0.452349,1.9758,
-	0.986902,0,0.161321,-1.71917,0.46934,1.9758,
-	0.973675,0,0.22794,-1.593323,-0.351986,1.438224,
-	0.982991,0,0.183655,-1.719171,-0.391356,1.9758,
-	0.973675,0,0.22794,-1.593323,-0.391356,1.438224,
-	0.982991,0,0.183655,-1.719171,-0.391356,1.9758,
-	0.973675,0,0.22794,-1.593323,-0.351986,1.438224,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.973675,0,0.22794,-1.593323,-0.351986,1.438224,
-	0.973675,0,0.22794,-1.593323,0.418917,1.438224,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.973675,0,0.22794,-1.593323,0.418917,1.438224,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.973675,0,0.22794,-1.593323,0.418917,1.438224,
-	0.973675,0,0.22794,-1.593323,0.46934,1.438224,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.973675,0,0.22794,-1.593323,0.46934,1.438224,
-	0.989006,0,0.147878,-1.71917,0.452349,1.9758,
-	0.866467,0.373928,-0.330776,1.303752,0.115699,0.560049,
-	0.861953,0.471316,-0.186813,1.360664,0.095657,0.717369,
-	0.858796,0.320379,-0.399784,1.407455,-0.032839,0.663785,
-	0.861953,0.471316,-0.186813,1.360664,0.095657,0.717369,
-	0.866467,0.373928,-0.330776,1.303752,0.115699,0.560049,
-	0.856683,0.49371,-0.14948,1.346671,0.115699,0.703372,
-	-0.454111,0,0.890945,-1.473662,-0.391356,2.907315,
-	-0.307512,0,0.951544,-1.789572,-0.351986,2.721769,
-	-0.236443,0,0.971645,-1.789572,-0.391356,2.721769,
-	-0.307512,0,0.951544,-1.789572,-0.351986,2.721769,
-	-0.454111,0,0.890945,-1.473662,-0.391356,2.907315,
-	-0.399962,0,0.916532,-1.473662,-0.351986,2.907315,
-	0.655352,-0.477297,0.585407,1.426514,-0.237645,0.610972,
-	0.68352,-0.399978,0.610588,0.847965,-0.218877,1.272403,
-	0.639403,-0.514734,0.57115,0.839604,-0.23778,1.267897,
-	0.68352,-0.399978,0.610588,0.847965,-0.218877,1.272403,
-	0.655352,-0.477297,0.585407,1.426514,-0.237645,0.610972,
-	0.695739,-0.360096,0.621513,1.431386,-0.218743,0.619383,
-	0.695739,-0.360096,0.621513,1.431386,-0.218743,0.619383,
-	0.706645,-0.319621,0.631265,0.84883,-0.216217,1.272781,
-	0.68352,-0.399978,0.610588,0.847965,-0.218877,1.272403,
-	0.706645,-0.319621,0.631265,0.84883,-0.216217,1.272781,
-	0.695739,-0.360096,0.621513,1.431386,-0.218743,0.619383,
-	0.720552,-0.257783,0.643702,1.434568,-0.198808,0.625914,
-	0.706645,-0.319621,0.631265,0.84883,-0.216217,1.272781,
-	0.720552,-0.257783,0.643702,1.434568,-0.198808,0.625914,
-	0.720552,-0.257783,0.643702,0.857464,-0.198941,1.271864,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.995576,0,0.093958,-1.789572,-0.391356,2.721769,
-	0.982991,0,0.183655,-1.719171,-0.391356,1.9758,
-	0.995576,0,0.093958,-1.789572,-0.391356,2.721769,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.996516,0,0.083404,-1.789572,-0.351986,2.721769,
-	0.996516,0,0.083404,-1.789572,-0.351986,2.721769,
-	0.986902,0,0.161321,-1.719171,-0.351986,1.9758,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.996516,0,0.083404,-1.789572,-0.351986,2.721769,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.996177,0,0.087363,-1.789572,0.418917,2.721769,
-	0.996177,0,0.087363,-1.789572,0.418917,2.721769,
-	0.986902,0,0.161321,-1.71917,0.418917,1.9758,
-	0.989006,0,0.147878,-1.71917,0.452349,1.9758,
-	0.996177,0,0.087363,-1.789572,0.418917,2.721769,
-	0.989006,0,0.147878,-1.71917,0.452349,1.9758,
-	0.995576,0,0.093958,-1.789572,0.46934,2.721769,
-	0.093565,-0.992115,0.08339,1.341703,-0.317985,0.529428,
-	0.029609,-0.999217,0.026249,0.738003,-0.319856,1.173677,
-	-0.00254,-0.999994,-0.002474,1.325375,-0.319721,0.516234,
-	0.029609,-0.999217,0.026249,0.738003,-0.319856,1.173677,
-	0.093565,-0.992115,0.08339,1.341703,-0.317985,0.529428,
-	0.125371,-0.98579,0.111807,0.751492,-0.31812,1.190048,
-	0.420811,-0.825651,0.375791,1.401838,-0.286095,0.574837,
-	0.388456,-0.853684,0.346879,0.790598,-0.297129,1.23506,
-	0.366268,-0.87114,0.327053,1.388803,-0.296992,0.565492,
-	0.388456,-0.853684,0.346879,0.790598,-0.297129,1.23506,
-	0.420811,-0.825651,0.375791,1.401838,-0.286095,0.574837,
-	0.446912,-0.80061,0.399116,1.402704,-0.285122,0.576005,
-	0.388456,-0.853684,0.346879,0.790598,-0.297129,1.23506,
-	0.446912,-0.80061,0.399116,1.402704,-0.285122,0.576005,
-	0.472231,-0.774036,0.421742,0.804797,-0.285259,1.245239,
-	-0.00254,-0.999994,-0.002474,1.325375,-0.319721,0.516234,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.066668,-0.995984,-0.059767,1.309184,-0.318742,0.502813,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.00254,-0.999994,-0.002474,1.325375,-0.319721,0.516234,
-	0.029609,-0.999217,0.026249,0.738003,-0.319856,1.173677,
-	0.279519,-0.927146,0.249538,1.373684,-0.306525,0.554264,
-	0.219043,-0.955929,0.195501,0.764565,-0.313698,1.206288,
-	0.18811,-0.967697,0.167863,1.357896,-0.313562,0.542176,
-	0.219043,-0.955929,0.195501,0.764565,-0.313698,1.206288,
-	0.279519,-0.927146,0.249538,1.373684,-0.306525,0.554264,
-	0.316357,-0.905615,0.282454,0.777003,-0.306661,1.222126,
-	-0.125259,-0.625354,-0.770222,0.574271,0.115699,0.068952,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.307986,-0.679834,-0.66556,0.453243,0.1157,0.101903,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.125259,-0.625354,-0.770222,0.574271,0.115699,0.068952,
-	-0.049547,-0.594885,-0.802282,0.841799,-0.26749,0.336562,
-	0.831215,0.554744,-0.036624,1.347924,0.115699,0.731818,
-	0.861953,0.471316,-0.186813,1.360664,0.095657,0.717369,
-	0.856683,0.49371,-0.14948,1.346671,0.115699,0.703372,
-	0.829874,0.221855,-0.511946,1.226889,0.115699,0.4205,
-	0.844655,0.264802,-0.465229,1.435175,-0.178174,0.631389,
-	0.797114,0.147609,-0.58551,1.435649,-0.183315,0.629324,
-	0.844655,0.264802,-0.465229,1.435175,-0.178174,0.631389,
-	0.829874,0.221855,-0.511946,1.226889,0.115699,0.4205,
-	0.858796,0.320379,-0.399784,1.407455,-0.032839,0.663785,
-	0.858796,0.320379,-0.399784,1.407455,-0.032839,0.663785,
-	0.829874,0.221855,-0.511946,1.226889,0.115699,0.4205,
-	0.866467,0.373928,-0.330776,1.303752,0.115699,0.560049,
-	0.18811,-0.967697,0.167863,1.357896,-0.313562,0.542176,
-	0.125371,-0.98579,0.111807,0.751492,-0.31812,1.190048,
-	0.093565,-0.992115,0.08339,1.341703,-0.317985,0.529428,
-	0.125371,-0.98579,0.111807,0.751492,-0.31812,1.190048,
-	0.18811,-0.967697,0.167863,1.357896,-0.313562,0.542176,
-	0.219043,-0.955929,0.195501,0.764565,-0.313698,1.206288,
-	0.518689,-0.21565,-0.827319,0.994243,0.115699,0.189857,
-	0.390324,-0.328222,-0.860184,1.142772,-0.29747,0.403027,
-	0.32092,-0.381383,-0.866924,0.854313,0.115699,0.11448,
-	0.390324,-0.328222,-0.860184,1.142772,-0.29747,0.403027,
-	0.518689,-0.21565,-0.827319,0.994243,0.115699,0.189857,
-	0.591679,-0.141218,-0.793708,1.296236,-0.316855,0.491942,
-	0.594472,-0.603866,0.530989,1.420033,-0.2552,0.600822,
-	0.542659,-0.686007,0.484682,0.817839,-0.27125,1.254201,
-	0.520105,-0.716734,0.464525,1.412052,-0.271114,0.589101,
-	0.542659,-0.686007,0.484682,0.817839,-0.27125,1.254201,
-	0.594472,-0.603866,0.530989,1.420033,-0.2552,0.600822,
-	0.594472,-0.603866,0.530989,0.829506,-0.255335,1.261796,
-	-0.397992,0.380616,0.834706,0.886816,-0.070199,1.246183,
-	-0.499279,0.460824,0.733731,0.758404,-0.078952,1.180247,
-	-0.47928,0.243811,0.843117,0.865187,-0.178304,1.269373,
-	0.743937,-0.06942,0.664634,1.435175,-0.178174,0.631389,
-	0.745715,-0.006279,0.666235,0.886816,-0.070199,1.246183,
-	0.737507,-0.148222,0.658873,0.865187,-0.178304,1.269373,
-	0.745715,-0.006279,0.666235,0.886816,-0.070199,1.246183,
-	0.743937,-0.06942,0.664634,1.435175,-0.178174,0.631389,
-	0.745715,-0.006279,0.666235,1.407455,-0.032839,0.663785,
-	0.745715,-0.006279,0.666235,0.886816,-0.070199,1.246183,
-	0.745715,-0.006279,0.666235,1.407455,-0.032839,0.663785,
-	0.745715,-0.006279,0.666235,0.901767,-0.028687,1.229839,
-	0.745715,-0.006279,0.666235,0.901767,-0.028687,1.229839,
-	0.745715,-0.006279,0.666235,1.407455,-0.032839,0.663785,
-	0.745715,-0.006279,0.666235,1.360664,0.095657,0.717369,
-	0.745715,-0.006279,0.666235,0.901767,-0.028687,1.229839,
-	0.745715,-0.006279,0.666235,1.360664,0.095657,0.717369,
-	0.745715,-0.006279,0.666235,1.050087,0.1157,1.065186,
-	0.745715,-0.006279,0.666235,1.050087,0.1157,1.065186,
-	0.745715,-0.006279,0.666235,1.360664,0.095657,0.717369,
-	0.745715,-0.006279,0.666235,1.347924,0.115699,0.731818,
-	0,1,0,-1.789572,-0.351986,2.721769,
-	0,1,0,-1.343835,-0.351986,2.308269,
-	0,1,0,-1.753229,-0.351986,2.185036,
-	0,1,0,-1.343835,-0.351986,2.308269,
-	0,1,0,-1.789572,-0.351986,2.721769,
-	0,1,0,-1.473662,-0.351986,2.907315,
-	0.432927,-0.836473,-0.335988,0.293295,-0.391356,1.363581,
-	0.433809,-0.83702,-0.333476,0.555173,-0.104583,0.984454,
-	0.435934,-0.836023,-0.333207,0.640686,-0.100103,1.087313,
-	-0.082643,-0.993825,-0.074039,0.987772,-0.280632,0.35003,
-	-0.082643,-0.993825,-0.074039,0.714801,-0.258939,0.363541,
-	-0.082643,-0.993825,-0.074039,0.841799,-0.26749,0.336562,
-	-0.082643,-0.993825,-0.074039,0.714801,-0.258939,0.363541,
-	-0.082643,-0.993825,-0.074039,0.987772,-0.280632,0.35003,
-	-0.082643,-0.993825,-0.074039,1.142772,-0.29747,0.403027,
-	-0.082643,-0.993825,-0.074039,0.714801,-0.258939,0.363541,
-	-0.082643,-0.993825,-0.074039,1.142772,-0.29747,0.403027,
-	-0.082643,-0.993825,-0.074039,0.615433,-0.255562,0.429129,
-	-0.082643,-0.993825,-0.074039,0.615433,-0.255562,0.429129,
-	-0.082643,-0.993825,-0.074039,1.142772,-0.29747,0.403027,
-	-0.082643,-0.993825,-0.074039,1.296236,-0.316855,0.491942,
-	-0.082643,-0.993825,-0.074039,0.615433,-0.255562,0.429129,
-	-0.082643,-0.993825,-0.074039,1.296236,-0.316855,0.491942,
-	-0.082643,-0.993825,-0.074039,0.550466,-0.257589,0.528855,
-	-0.082643,-0.993825,-0.074039,0.550466,-0.257589,0.528855,
-	-0.082643,-0.993825,-0.074039,1.296236,-0.316855,0.491942,
-	-0.066668,-0.995984,-0.059767,1.309184,-0.318742,0.502813,
-	-0.082643,-0.993825,-0.074039,0.550466,-0.257589,0.528855,
-	-0.066668,-0.995984,-0.059767,1.309184,-0.318742,0.502813,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.082643,-0.993825,-0.074039,0.550466,-0.257589,0.528855,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.082643,-0.993825,-0.074039,0.524328,-0.264882,0.655925,
-	-0.082643,-0.993825,-0.074039,0.524328,-0.264882,0.655925,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.082643,-0.993825,-0.074039,0.5388,-0.276944,0.801677,
-	-0.082643,-0.993825,-0.074039,0.5388,-0.276944,0.801677,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.082643,-0.993825,-0.074039,0.592896,-0.292953,0.956179,
-	-0.082643,-0.993825,-0.074039,0.592896,-0.292953,0.956179,
-	-0.068953,-0.995703,-0.061808,0.724321,-0.318876,1.157447,
-	-0.082643,-0.993825,-0.074039,0.682929,-0.311817,1.108903,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.981604,-0.156227,-0.109762,1.882448,-0.17612,2.816533,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.981604,-0.156227,-0.109762,1.882448,-0.17612,2.816533,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.99148,-0.06721,-0.111576,1.895235,-0.072325,2.815815,
-	-0.249605,0.431242,0.867022,0.901767,-0.028687,1.229839,
-	-0.355285,0.355664,0.864451,0.868735,-0.0443,1.228096,
-	-0.397992,0.380616,0.834706,0.886816,-0.070199,1.246183,
-	0.520105,-0.716734,0.464525,1.412052,-0.271114,0.589101,
-	0.472231,-0.774036,0.421742,0.804797,-0.285259,1.245239,
-	0.446912,-0.80061,0.399116,1.402704,-0.285122,0.576005,
-	0.472231,-0.774036,0.421742,0.804797,-0.285259,1.245239,
-	0.520105,-0.716734,0.464525,1.412052,-0.271114,0.589101,
-	0.542659,-0.686007,0.484682,0.817839,-0.27125,1.254201,
-	0.275598,-0.853624,-0.442009,1.667565,0.059804,1.716859,
-	0.25896,-0.861903,-0.435962,1.620844,0.074945,1.667507,
-	0.117527,-0.982232,-0.146317,1.594074,0.1157,1.569594,
-	0.720552,-0.257783,0.643702,1.434568,-0.198808,0.625914,
-	0.737507,-0.148222,0.658873,0.865187,-0.178304,1.269373,
-	0.720552,-0.257783,0.643702,0.857464,-0.198941,1.271864,
-	0.737507,-0.148222,0.658873,0.865187,-0.178304,1.269373,
-	0.720552,-0.257783,0.643702,1.434568,-0.198808,0.625914,
-	0.731453,-0.194869,0.653454,1.435649,-0.183315,0.629324,
-	0.737507,-0.148222,0.658873,0.865187,-0.178304,1.269373,
-	0.731453,-0.194869,0.653454,1.435649,-0.183315,0.629324,
-	0.743937,-0.06942,0.664634,1.435175,-0.178174,0.631389,
-	-0.493712,0,0.869625,-1.473662,0.418917,3.101913,
-	-0.563285,0,0.826263,-1.760402,0.46934,2.906435,
-	-0.563285,0,0.826263,-1.760402,0.418917,2.906435,
-	-0.563285,0,0.826263,-1.760402,0.46934,2.906435,
-	-0.493712,0,0.869625,-1.473662,0.418917,3.101913,
-	-0.420316,0,0.907378,-1.473662,0.46934,3.101913,
-	0.101282,-0.521126,-0.847449,0.711069,0.115699,0.073242,
-	-0.049547,-0.594885,-0.802282,0.841799,-0.26749,0.336562,
-	-0.125259,-0.625354,-0.770222,0.574271,0.115699,0.068952,
-	-0.049547,-0.594885,-0.802282,0.841799,-0.26749,0.336562,
-	0.101282,-0.521126,-0.847449,0.711069,0.115699,0.073242,
-	0.176399,-0.477835,-0.860556,0.987772,-0.280632,0.35003,
-	0.594472,-0.603866,0.530989,1.420033,-0.2552,0.600822,
-	0.639403,-0.514734,0.57115,0.839604,-0.23778,1.267897,
-	0.594472,-0.603866,0.530989,0.829506,-0.255335,1.261796,
-	0.639403,-0.514734,0.57115,0.839604,-0.23778,1.267897,
-	0.594472,-0.603866,0.530989,1.420033,-0.2552,0.600822,
-	0.655352,-0.477297,0.585407,1.426514,-0.237645,0.610972,
-	-0.311023,0,0.950402,-1.343835,-0.351986,2.308269,
-	-0.288237,0,0.957559,-1.753229,0.429973,2.185036,
-	-0.288237,0,0.957559,-1.753229,-0.351986,2.185036,
-	-0.288237,0,0.957559,-1.753229,0.429973,2.185036,
-	-0.311023,0,0.950402,-1.343835,-0.351986,2.308269,
-	-0.333644,0,0.942699,-1.343835,0.429973,2.308269,
-	0.366268,-0.87114,0.327053,1.388803,-0.296992,0.565492,
-	0.316357,-0.905615,0.282454,0.777003,-0.306661,1.222126,
-	0.279519,-0.927146,0.249538,1.373684,-0.306525,0.554264,
-	0.316357,-0.905615,0.282454,0.777003,-0.306661,1.222126,
-	0.366268,-0.87114,0.327053,1.388803,-0.296992,0.565492,
-	0.388456,-0.853684,0.346879,0.790598,-0.297129,1.23506,
-	0.316357,-0.905615,0.282454,0.777003,-0.306661,1.222126,
-	0.388456,-0.853684,0.346879,0.790598,-0.297129,1.23506,
-	0.337978,-0.891461,0.301774,0.782018,-0.302539,1.228689,
-	0.426503,-0.836005,-0.345241,0.665608,-0.095567,1.107224,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.426432,-0.836018,-0.345296,0.645497,-0.099189,1.091151,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.426503,-0.836005,-0.345241,0.665608,-0.095567,1.107224,
-	0.426318,-0.836032,-0.345403,0.673898,-0.094074,1.113849,
-	0.405161,-0.913099,-0.045758,1.80488,-0.376661,2.820885,
-	0.252879,-0.950479,-0.180671,1.744615,-0.391346,2.580312,
-	0.379015,-0.886977,-0.263854,1.777341,-0.376815,2.578476,
-	0.252879,-0.950479,-0.180671,1.744615,-0.391346,2.580312,
-	0.405161,-0.913099,-0.045758,1.80488,-0.376661,2.820885,
-	0.207733,-0.9779,-0.023645,1.772155,-0.391357,2.822721,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.240571,0.970213,-0.028486,1.63484,0.469339,1.718695,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.504226,0.552291,0.663876,0.755695,-0.079224,1.178282,
-	-0.479798,0.509116,0.714559,0.758404,-0.078952,1.180247,
-	-0.765433,-0.076157,0.638994,0.546029,-0.105148,0.973456,
-	-0.824319,-0.208014,0.526525,0.538904,-0.105527,0.964835,
-	-0.78972,-0.133178,0.598838,0.682929,-0.311817,1.108903,
-	0.467544,-0.836198,-0.286662,0.020451,-0.391356,0.973919,
-	0.470214,-0.836003,-0.28284,0.396675,-0.073374,0.659509,
-	0.463075,-0.836184,-0.293866,0.420331,-0.082341,0.724045,
-	0.494701,-0.836109,-0.23705,-0.210168,-0.391356,0.557872,
-	0.500479,-0.836021,-0.224924,0.428578,0.1157,0.099871,
-	0.496685,-0.836056,-0.233057,0.406831,0.08212,0.174281,
-	0.494701,-0.836109,-0.23705,-0.210168,-0.391356,0.557872,
-	0.496685,-0.836056,-0.233057,0.406831,0.08212,0.174281,
-	0.49078,-0.836227,-0.244662,0.378789,0.038394,0.270618,
-	0.430585,-0.755425,-0.493893,0.762622,-0.077692,1.181918,
-	0.441471,-0.737274,-0.511401,0.758404,-0.078952,1.180247,
-	0.496169,-0.607991,-0.619809,0.758981,-0.077961,1.179865,
-	0.432927,-0.836473,-0.335988,0.293295,-0.391356,1.363581,
-	0.435934,-0.836023,-0.333207,0.640686,-0.100103,1.087313,
-	0.428434,-0.836046,-0.342742,0.643743,-0.099518,1.08978,
-	0.456862,-0.836223,-0.303327,0.106845,-0.391356,1.106955,
-	0.463075,-0.836184,-0.293866,0.420331,-0.082341,0.724045,
-	0.459265,-0.836065,-0.300117,0.455635,-0.09635,0.818877,
-	0.240977,-0.859676,-0.450429,1.63484,0.05269,1.718695,
-	0.25896,-0.861903,-0.435962,1.620844,0.074945,1.667507,
-	0.275598,-0.853624,-0.442009,1.667565,0.059804,1.716859,
-	0.367836,-0.89319,-0.258668,0.690311,-0.091124,1.126951,
-	0.324389,-0.893916,-0.309333,0.755695,-0.079224,1.178282,
-	0.341562,-0.894102,-0.289684,0.753511,-0.079688,1.177433,
-	0.444321,-0.74498,-0.497578,0.755695,-0.079224,1.178282,
-	0.455024,-0.799852,-0.391394,0.690311,-0.091124,1.126951,
-	0.496169,-0.607991,-0.619809,0.758981,-0.077961,1.179865,
-	0.444321,-0.74498,-0.497578,0.755695,-0.079224,1.178282,
-	0.496169,-0.607991,-0.619809,0.758981,-0.077961,1.179865,
-	0.441471,-0.737274,-0.511401,0.758404,-0.078952,1.180247,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	0.806377,-0.584412,-0.090654,1.80488,-0.376661,2.820885,
-	0.782324,-0.576239,-0.23647,1.777341,-0.376815,2.578476,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	0.956965,-0.269823,-0.106838,1.862133,-0.265255,2.817672,
-	0.892998,-0.438832,-0.099907,1.835677,-0.333656,2.819157,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.892998,-0.438832,-0.099907,1.835677,-0.333656,2.819157,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	0.941461,0.31575,-0.118125,1.862354,0.343336,2.81766,
-	0.974976,0.189186,-0.116748,1.882604,0.254219,2.816524,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.850682,0.512682,-0.116178,1.835947,0.411713,2.819142,
-	0.941461,0.31575,-0.118125,1.862354,0.343336,2.81766,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.805615,0.58129,-0.114393,1.805181,0.45469,2.820868,
-	0.850682,0.512682,-0.116178,1.835947,0.411713,2.819142,
-	0.797689,0.594217,-0.102947,1.777642,0.445154,2.578459,
-	0.981604,-0.156227,-0.109762,1.882448,-0.17612,2.816533,
-	0.956965,-0.269823,-0.106838,1.862133,-0.265255,2.817672,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.807977,-0.486376,-0.332584,1.792582,-0.265825,2.439829,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.993252,-0.014102,-0.11512,1.872085,0.03421,2.57316,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.797689,0.594217,-0.102947,1.777642,0.445154,2.578459,
-	0.850682,0.512682,-0.116178,1.835947,0.411713,2.819142,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.941461,0.31575,-0.118125,1.862354,0.343336,2.81766,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.956965,-0.269823,-0.106838,1.862133,-0.265255,2.817672,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.974976,0.189186,-0.116748,1.882604,0.254219,2.816524,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.892998,-0.438832,-0.099907,1.835677,-0.333656,2.819157,
-	0.806377,-0.584412,-0.090654,1.80488,-0.376661,2.820885,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	0.467544,-0.836198,-0.286662,0.020451,-0.391356,0.973919,
-	0.474256,-0.836102,-0.275709,0.38175,-0.056076,0.582184,
-	0.470214,-0.836003,-0.28284,0.396675,-0.073374,0.659509,
-	0.456862,-0.836223,-0.303327,0.106845,-0.391356,1.106955,
-	0.459265,-0.836065,-0.300117,0.455635,-0.09635,0.818877,
-	0.451622,-0.836275,-0.310937,0.477253,-0.098489,0.857111,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.428434,-0.836046,-0.342742,0.643743,-0.099518,1.08978,
-	0.426432,-0.836018,-0.345296,0.645497,-0.099189,1.091151,
-	0.432927,-0.836473,-0.335988,0.293295,-0.391356,1.363581,
-	0.438762,-0.836856,-0.327354,0.551399,-0.104719,0.980011,
-	0.433809,-0.83702,-0.333476,0.555173,-0.104583,0.984454,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.426318,-0.836032,-0.345403,0.673898,-0.094074,1.113849,
-	0.406635,-0.856746,-0.31723,0.690311,-0.091124,1.126951,
-	0.797689,0.594217,-0.102947,1.777642,0.445154,2.578459,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.844008,0.528559,-0.090974,1.792852,0.404136,2.439814,
-	0.37929,0.924605,-0.035288,1.762087,0.442766,2.44154,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.240571,0.970213,-0.028486,1.63484,0.469339,1.718695,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.946878,0.205961,-0.246986,1.717236,0.338631,1.562684,
-	0.904661,0.346941,-0.247428,1.271248,0.380955,-0.021329,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.938723,-0.205797,-0.276489,1.717155,0.246972,1.562689,
-	0.952752,-0.156236,-0.260487,1.284116,0.24723,-0.021329,
-	0.724259,-0.575555,-0.379718,1.761786,-0.304479,2.441557,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	0.782324,-0.576239,-0.23647,1.777341,-0.376815,2.578476,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.851194,0.50661,-0.137165,1.725039,0.408343,1.713635,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.94538,0.296534,-0.135365,1.745289,0.365203,1.712498,
-	0.240571,0.970213,-0.028486,1.63484,0.469339,1.718695,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.262608,-0.840906,-0.473195,1.72906,-0.317688,2.443393,
-	0.240977,-0.859676,-0.450429,1.63484,0.05269,1.718695,
-	0.275598,-0.853624,-0.442009,1.667565,0.059804,1.716859,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.653549,0.750745,-0.096206,1.777642,0.445154,2.578459,
-	0.844008,0.528559,-0.090974,1.792852,0.404136,2.439814,
-	0.711557,0.698766,-0.073569,1.762087,0.442766,2.44154,
-	0.36952,-0.836018,-0.405622,1.350509,0.1157,1.368801,
-	0.378858,-0.836018,-0.396914,0.717541,-0.391356,1.834754,
-	0.383451,-0.836018,-0.392479,1.254219,0.1157,1.279009,
-	0.378858,-0.836018,-0.396914,0.717541,-0.391356,1.834754,
-	0.36952,-0.836018,-0.405622,1.350509,0.1157,1.368801,
-	0.364775,-0.836018,-0.409895,0.833554,-0.391356,1.942938,
-	0.982391,-0.009206,-0.186608,1.762309,0.261046,1.711543,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.869834,0.47479,-0.13403,1.725039,0.408343,1.713635,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	0.613857,0.771354,-0.167905,1.223803,0.445458,-0.021329,
-	0.938723,-0.205797,-0.276489,1.717155,0.246972,1.562689,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.807151,-0.547554,-0.220661,1.250463,0.167512,-0.021329,
-	0.326686,0.943881,-0.048628,1.72906,0.455932,2.443393,
-	0.37929,0.924605,-0.035288,1.762087,0.442766,2.44154,
-	0.240571,0.970213,-0.028486,1.63484,0.469339,1.718695,
-	0.608966,-0.724087,-0.323817,1.657596,0.139442,1.56603,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	0.570937,-0.702812,-0.424365,1.698362,0.080622,1.715131,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.94538,0.296534,-0.135365,1.745289,0.365203,1.712498,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.352435,-0.903593,-0.243536,1.6268,0.121747,1.567758,
-	0.605395,-0.778525,-0.165517,1.223677,0.139521,-0.021329,
-	0.608966,-0.724087,-0.323817,1.657596,0.139442,1.56603,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.946878,0.205961,-0.246986,1.717236,0.338631,1.562684,
-	0.773313,0.602828,-0.196431,1.684274,0.418004,1.564533,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.80696,0.547786,-0.220785,1.250799,0.417372,-0.021329,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.946878,0.205961,-0.246986,1.717236,0.338631,1.562684,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.952938,0.154945,-0.260578,1.284174,0.338115,-0.021329,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.946878,0.205961,-0.246986,1.717236,0.338631,1.562684,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	0.739369,0.666111,-0.098133,1.698631,0.441443,1.715116,
-	0.851194,0.50661,-0.137165,1.725039,0.408343,1.713635,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.95607,0.274398,-0.103135,1.834814,0.335056,2.575251,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.982391,-0.009206,-0.186608,1.762309,0.261046,1.711543,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	-0.266041,0.835984,0.479951,1.744615,-0.391346,2.580312,
-	-0.266041,0.835984,0.479951,1.743775,-0.387364,2.572911,
-	-0.266041,0.835984,0.479951,1.740919,-0.391356,2.578282,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.953603,-0.164611,-0.252081,1.75792,0.207128,1.71179,
-	0.938723,-0.205797,-0.276489,1.717155,0.246972,1.562689,
-	0.527931,0.84762,-0.05318,1.762087,0.442766,2.44154,
-	0.694799,0.712655,-0.096836,1.698631,0.441443,1.715116,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.372426,-0.888996,-0.266431,1.744615,-0.391346,2.580312,
-	0.459522,-0.764252,-0.452503,1.761786,-0.304479,2.441557,
-	0.379015,-0.886977,-0.263854,1.777341,-0.376815,2.578476,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.982391,-0.009206,-0.186608,1.762309,0.261046,1.711543,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.982391,-0.009206,-0.186608,1.762309,0.261046,1.711543,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	0.608966,-0.724087,-0.323817,1.657596,0.139442,1.56603,
-	0.403179,0.91206,-0.074795,1.777642,0.445154,2.578459,
-	0.37929,0.924605,-0.035288,1.762087,0.442766,2.44154,
-	0.326686,0.943881,-0.048628,1.72906,0.455932,2.443393,
-	0.013852,-0.999834,-0.0118,-1.789572,0.418917,2.721769,
-	0.006074,-0.999778,-0.020183,-1.753229,0.429973,2.185036,
-	0.01031,-0.999871,-0.012311,-1.343835,0.429973,2.308269,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	0.773313,0.602828,-0.196431,1.684274,0.418004,1.564533,
-	0.613857,0.771354,-0.167905,1.223803,0.445458,-0.021329,
-	0.94538,0.296534,-0.135365,1.745289,0.365203,1.712498,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.998221,0,-0.059628,1.804276,0.469339,3.360463,
-	0.998221,0,-0.059628,1.804276,0.418917,3.360463,
-	0.998221,0,-0.059628,1.804276,0.469339,3.360463,
-	0.995462,0,-0.09516,1.772155,0.429175,2.822721,
-	0.998221,0,-0.059628,1.772155,0.469339,2.822721,
-	0.326344,0.942627,-0.070391,1.744615,0.460772,2.580312,
-	0.486592,0.869856,-0.08111,1.777642,0.445154,2.578459,
-	0.326686,0.943881,-0.048628,1.72906,0.455932,2.443393,
-	0.117527,-0.982232,-0.146317,1.594074,0.1157,1.569594,
-	0.259122,-0.963243,-0.070844,1.192294,0.121731,-0.021329,
-	0.30254,-0.939741,-0.159236,1.6268,0.121747,1.567758,
-	0,1,0,1.567503,-0.351987,3.38714,
-	0,1,0,1.772155,-0.351987,2.822721,
-	0,1,0,1.767999,-0.351987,2.786146,
-	0,1,0,1.772155,-0.351987,2.822721,
-	0,1,0,1.567503,-0.351987,3.38714,
-	0,1,0,1.792693,-0.351987,3.166558,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.807977,-0.486376,-0.332584,1.792582,-0.265825,2.439829,
-	0.815608,0.569675,-0.10126,1.698631,0.441443,1.715116,
-	0.844008,0.528559,-0.090974,1.792852,0.404136,2.439814,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.807977,-0.486376,-0.332584,1.792582,-0.265825,2.439829,
-	0.929733,-0.320654,-0.181048,1.834594,-0.266668,2.575264,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	-0.045349,0.979938,0.194076,-0.497427,0.46934,3.460249,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	-0.093562,0.988956,0.114946,-1.473662,0.46934,3.101913,
-	-0.108877,0,0.994055,0.500177,0.418917,3.617705,
-	-0.219726,0,0.975562,-0.497427,0.46934,3.460249,
-	-0.282885,0,0.959154,-0.497427,0.418917,3.460249,
-	-0.219726,0,0.975562,-0.497427,0.46934,3.460249,
-	-0.108877,0,0.994055,0.500177,0.418917,3.617705,
-	-0.155904,0,0.987772,0.001375,0.46934,3.538977,
-	-0.155904,0,0.987772,0.001375,0.46934,3.538977,
-	-0.108877,0,0.994055,0.500177,0.418917,3.617705,
-	-0.029634,0,0.999561,0.500177,0.469339,3.617705,
-	-0.030971,0.98007,0.196225,0.001375,0.46934,3.538977,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.045349,0.979938,0.194076,-0.497427,0.46934,3.460249,
-	0.68279,0,0.730615,1.804276,0.418917,3.360463,
-	0.68279,0,0.730615,1.567503,0.469339,3.581738,
-	0.68279,0,0.730615,1.567503,0.418917,3.581738,
-	0.68279,0,0.730615,1.567503,0.469339,3.581738,
-	0.68279,0,0.730615,1.804276,0.418917,3.360463,
-	0.68279,0,0.730615,1.804276,0.469339,3.360463,
-	-0.106238,0.992765,0.055963,-1.760402,0.46934,2.906435,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.259904,0.965446,-0.019075,-1.789572,0.46934,2.721769,
-	-0.019925,0.980232,0.196846,0.500177,0.469339,3.617705,
-	0.067043,0.991144,0.114624,1.567503,0.469339,3.581738,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	-0.282885,0,0.959154,-0.497427,-0.391356,3.265652,
-	-0.399962,0,0.916532,-1.473662,-0.351986,2.907315,
-	-0.454111,0,0.890945,-1.473662,-0.391356,2.907315,
-	-0.399962,0,0.916532,-1.473662,-0.351986,2.907315,
-	-0.282885,0,0.959154,-0.497427,-0.391356,3.265652,
-	-0.219726,0,0.975562,-0.497427,-0.351986,3.265652,
-	-0.097163,0,0.995268,0.551147,-0.351987,2.822685,
-	-0.227815,0,0.973704,-0.407016,0.429972,2.665229,
-	-0.292742,0,0.956192,-0.407017,-0.351986,2.665229,
-	-0.227815,0,0.973704,-0.407016,0.429972,2.665229,
-	-0.097163,0,0.995268,0.551147,-0.351987,2.822685,
-	-0.031469,0,0.999505,0.551147,0.429969,2.822685,
-	0.770964,-0.531938,-0.350222,1.792582,-0.265825,2.439829,
-	0.828657,-0.513374,-0.223105,1.808137,-0.334296,2.576748,
-	0.580091,-0.694621,-0.425438,1.761786,-0.304479,2.441557,
-	0.015086,-0.999854,-0.007974,-1.760402,0.418917,2.906435,
-	0.013852,-0.999834,-0.0118,-1.789572,0.418917,2.721769,
-	0.01031,-0.999871,-0.012311,-1.343835,0.429973,2.308269,
-	-0.259904,0.965446,-0.019075,-1.789572,0.46934,2.721769,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.224548,0.97391,-0.032814,-1.71917,0.452349,1.9758,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.326686,0.943881,-0.048628,1.72906,0.455932,2.443393,
-	0.240571,0.970213,-0.028486,1.63484,0.469339,1.718695,
-	-0.093562,0.988956,0.114946,-1.473662,0.46934,3.101913,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.019925,0.980232,0.196846,0.500177,0.469339,3.617705,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.030971,0.98007,0.196225,0.001375,0.46934,3.538977,
-	0.006145,-0.999897,-0.012996,-1.473662,0.418917,3.101913,
-	0.015086,-0.999854,-0.007974,-1.760402,0.418917,2.906435,
-	0.01031,-0.999871,-0.012311,-1.343835,0.429973,2.308269,
-	0,1,0,-1.473662,-0.351986,2.907315,
-	0,1,0,-0.407017,-0.351986,2.665229,
-	0,1,0,-1.343835,-0.351986,2.308269,
-	0,1,0,-0.407017,-0.351986,2.665229,
-	0,1,0,-1.473662,-0.351986,2.907315,
-	0,1,0,-0.497427,-0.351986,3.265652,
-	-0.045349,0.979938,0.194076,-0.497427,0.46934,3.460249,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	-0.844783,-0.265761,0.464449,0.477253,-0.098489,0.857111,
-	-0.855881,-0.307094,0.416127,0.592896,-0.292953,0.956179,
-	-0.824319,-0.208014,0.526525,0.538904,-0.105527,0.964835,
-	0,1,0,-0.497427,-0.351986,3.265652,
-	0,1,0,0.551147,-0.351987,2.822685,
-	0,1,0,-0.407017,-0.351986,2.665229,
-	0,1,0,0.551147,-0.351987,2.822685,
-	0,1,0,-0.497427,-0.351986,3.265652,
-	0,1,0,0.500177,-0.351986,3.423108,
-	0.000845,1,-0.00005,1.772155,-0.391357,2.822721,
-	0.000845,1,-0.00005,1.769671,-0.391357,2.781136,
-	0.000845,1,-0.00005,1.744615,-0.391346,2.580312,
-	0.982391,-0.009206,-0.186608,1.762309,0.261046,1.711543,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.067043,0.991144,0.114624,1.567503,0.469339,3.581738,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.69976,0,0.714378,1.792693,-0.391357,3.166558,
-	0.69976,0,0.714378,1.567503,-0.351987,3.38714,
-	0.69976,0,0.714378,1.567503,-0.391357,3.38714,
-	0.69976,0,0.714378,1.567503,-0.351987,3.38714,
-	0.69976,0,0.714378,1.792693,-0.391357,3.166558,
-	0.69976,0,0.714378,1.792693,-0.351987,3.166558,
-	-0.019925,0.980232,0.196846,0.500177,0.469339,3.617705,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	0.997715,0,0.067557,-1.753229,0.429973,2.185036,
-	0.996516,0,0.083404,-1.789572,-0.351986,2.721769,
-	0.997715,0,0.067557,-1.753229,-0.351986,2.185036,
-	0.996516,0,0.083404,-1.789572,-0.351986,2.721769,
-	0.997715,0,0.067557,-1.753229,0.429973,2.185036,
-	0.996177,0,0.087363,-1.789572,0.418917,2.721769,
-	-0.093562,0.988956,0.114946,-1.473662,0.46934,3.101913,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.106238,0.992765,0.055963,-1.760402,0.46934,2.906435,
-	0.401352,-0.790567,-0.462515,1.761786,-0.304479,2.441557,
-	0.285897,-0.82997,-0.478972,1.743775,-0.387364,2.572911,
-	0.262608,-0.840906,-0.473195,1.72906,-0.317688,2.443393,
-	0.285897,-0.82997,-0.478972,1.743775,-0.387364,2.572911,
-	0.401352,-0.790567,-0.462515,1.761786,-0.304479,2.441557,
-	0.372426,-0.888996,-0.266431,1.744615,-0.391346,2.580312,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.608966,-0.724087,-0.323817,1.657596,0.139442,1.56603,
-	0.605395,-0.778525,-0.165517,1.223677,0.139521,-0.021329,
-	-0.01688,-0.999694,-0.018062,1.772155,0.429175,2.822721,
-	-0.008676,-0.999834,-0.015995,1.567503,0.418917,3.581738,
-	-0.005944,-0.999865,-0.015303,1.768126,0.429883,2.787255,
-	-0.008676,-0.999834,-0.015995,1.567503,0.418917,3.581738,
-	-0.01688,-0.999694,-0.018062,1.772155,0.429175,2.822721,
-	-0.01688,-0.999694,-0.018062,1.804276,0.418917,3.360463,
-	0.067043,0.991144,0.114624,1.567503,0.469339,3.581738,
-	0.141065,0.989418,0.033953,1.804276,0.469339,3.360463,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.570937,-0.702812,-0.424365,1.698362,0.080622,1.715131,
-	0.415876,-0.852051,-0.317895,1.6268,0.121747,1.567758,
-	0.608966,-0.724087,-0.323817,1.657596,0.139442,1.56603,
-	-0.282885,0,0.959154,-0.497427,0.418917,3.460249,
-	-0.420316,0,0.907378,-1.473662,0.46934,3.101913,
-	-0.493712,0,0.869625,-1.473662,0.418917,3.101913,
-	-0.420316,0,0.907378,-1.473662,0.46934,3.101913,
-	-0.282885,0,0.959154,-0.497427,0.418917,3.460249,
-	-0.219726,0,0.975562,-0.497427,0.46934,3.460249,
-	0.94538,0.296534,-0.135365,1.745289,0.365203,1.712498,
-	0.967362,0.236279,-0.091558,1.839509,0.262575,2.437196,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.773313,0.602828,-0.196431,1.684274,0.418004,1.564533,
-	0.851194,0.50661,-0.137165,1.725039,0.408343,1.713635,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	-0.292742,0,0.956192,-0.407017,-0.351986,2.665229,
-	-0.333644,0,0.942699,-1.343835,0.429973,2.308269,
-	-0.311023,0,0.950402,-1.343835,-0.351986,2.308269,
-	-0.333644,0,0.942699,-1.343835,0.429973,2.308269,
-	-0.292742,0,0.956192,-0.407017,-0.351986,2.665229,
-	-0.227815,0,0.973704,-0.407016,0.429972,2.665229,
-	0.844008,0.528559,-0.090974,1.792852,0.404136,2.439814,
-	0.889216,0.445544,-0.103856,1.808407,0.402661,2.576733,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.694799,0.712655,-0.096836,1.698631,0.441443,1.715116,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	-0.093083,0,0.995658,0.500177,-0.391356,3.423108,
-	-0.219726,0,0.975562,-0.497427,-0.351986,3.265652,
-	-0.282885,0,0.959154,-0.497427,-0.391356,3.265652,
-	-0.219726,0,0.975562,-0.497427,-0.351986,3.265652,
-	-0.093083,0,0.995658,0.500177,-0.391356,3.423108,
-	-0.029634,0,0.999561,0.500177,-0.351986,3.423108,
-	0.739369,0.666111,-0.098133,1.698631,0.441443,1.715116,
-	0.919898,0.381988,-0.088733,1.819259,0.342676,2.438332,
-	0.851194,0.50661,-0.137165,1.725039,0.408343,1.713635,
-	0.352435,-0.903593,-0.243536,1.6268,0.121747,1.567758,
-	0.259122,-0.963243,-0.070844,1.192294,0.121731,-0.021329,
-	0.605395,-0.778525,-0.165517,1.223677,0.139521,-0.021329,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.988875,0.094445,-0.114917,1.895316,0.150435,2.815811,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.988875,0.094445,-0.114917,1.895316,0.150435,2.815811,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.974976,0.189186,-0.116748,1.882604,0.254219,2.816524,
-	0.371988,0.925853,-0.066493,1.667866,0.462248,1.716842,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.275598,-0.853624,-0.442009,1.667565,0.059804,1.716859,
-	0.117527,-0.982232,-0.146317,1.594074,0.1157,1.569594,
-	0.352435,-0.903593,-0.243536,1.6268,0.121747,1.567758,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.969456,-0.193643,-0.150523,1.854908,-0.178538,2.574124,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.262608,-0.840906,-0.473195,1.72906,-0.317688,2.443393,
-	0.335823,-0.832009,-0.441569,1.667565,0.059804,1.716859,
-	0.459522,-0.764252,-0.452503,1.761786,-0.304479,2.441557,
-	0.056017,0,0.99843,1.80488,-0.376661,2.820885,
-	0.056017,0,0.99843,1.772155,-0.351987,2.822721,
-	0.056017,0,0.99843,1.772155,-0.391357,2.822721,
-	0.056017,0,0.99843,1.772155,-0.351987,2.822721,
-	0.056017,0,0.99843,1.80488,-0.376661,2.820885,
-	0.056017,0,0.99843,1.772155,0.429175,2.822721,
-	0.056017,0,0.99843,1.772155,0.429175,2.822721,
-	0.056017,0,0.99843,1.80488,-0.376661,2.820885,
-	0.056017,0,0.99843,1.772155,0.469339,2.822721,
-	0.056017,0,0.99843,1.772155,0.469339,2.822721,
-	0.056017,0,0.99843,1.80488,-0.376661,2.820885,
-	0.056017,0,0.99843,1.805181,0.45469,2.820868,
-	0.056017,0,0.99843,1.805181,0.45469,2.820868,
-	0.056017,0,0.99843,1.80488,-0.376661,2.820885,
-	0.056017,0,0.99843,1.835677,-0.333656,2.819157,
-	0.056017,0,0.99843,1.805181,0.45469,2.820868,
-	0.056017,0,0.99843,1.835677,-0.333656,2.819157,
-	0.056017,0,0.99843,1.835947,0.411713,2.819142,
-	0.056017,0,0.99843,1.835947,0.411713,2.819142,
-	0.056017,0,0.99843,1.835677,-0.333656,2.819157,
-	0.056017,0,0.99843,1.862133,-0.265255,2.817672,
-	0.056017,0,0.99843,1.835947,0.411713,2.819142,
-	0.056017,0,0.99843,1.862133,-0.265255,2.817672,
-	0.056017,0,0.99843,1.862354,0.343336,2.81766,
-	0.056017,0,0.99843,1.862354,0.343336,2.81766,
-	0.056017,0,0.99843,1.862133,-0.265255,2.817672,
-	0.056017,0,0.99843,1.882448,-0.17612,2.816533,
-	0.056017,0,0.99843,1.862354,0.343336,2.81766,
-	0.056017,0,0.99843,1.882448,-0.17612,2.816533,
-	0.056017,0,0.99843,1.882604,0.254219,2.816524,
-	0.056017,0,0.99843,1.882604,0.254219,2.816524,
-	0.056017,0,0.99843,1.882448,-0.17612,2.816533,
-	0.056017,0,0.99843,1.895235,-0.072325,2.815815,
-	0.056017,0,0.99843,1.882604,0.254219,2.816524,
-	0.056017,0,0.99843,1.895235,-0.072325,2.815815,
-	0.056017,0,0.99843,1.895316,0.150435,2.815811,
-	0.056017,0,0.99843,1.895316,0.150435,2.815811,
-	0.056017,0,0.99843,1.895235,-0.072325,2.815815,
-	0.056017,0,0.99843,1.899624,0.039057,2.815569,
-	0.986156,-0.079836,-0.145337,1.852141,-0.030933,2.436487,
-	0.986813,-0.09744,-0.129251,1.867696,-0.075915,2.573407,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.892304,-0.335983,-0.30151,1.745133,0.156883,1.712507,
-	0.964083,-0.187609,-0.188009,1.839353,-0.124227,2.437205,
-	0.915392,-0.31686,-0.248308,1.819039,-0.204345,2.438344,
-	0.851194,0.50661,-0.137165,1.725039,0.408343,1.713635,
-	0.94538,0.296534,-0.135365,1.745289,0.365203,1.712498,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.782483,-0.506128,-0.362704,1.724818,0.113734,1.713647,
-	0.770964,-0.531938,-0.350222,1.792582,-0.265825,2.439829,
-	0.570937,-0.702812,-0.424365,1.698362,0.080622,1.715131,
-	0.335823,-0.832009,-0.441569,1.667565,0.059804,1.716859,
-	0.415876,-0.852051,-0.317895,1.6268,0.121747,1.567758,
-	0.570937,-0.702812,-0.424365,1.698362,0.080622,1.715131,
-	0.664025,-0.635453,-0.394044,1.792582,-0.265825,2.439829,
-	0.335823,-0.832009,-0.441569,1.667565,0.059804,1.716859,
-	0.570937,-0.702812,-0.424365,1.698362,0.080622,1.715131,
-	0.971942,0.152801,-0.17883,1.758001,0.314963,1.711785,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.992962,0.019572,-0.116804,1.85653,0.069181,2.436241,
-	0.938723,-0.205797,-0.276489,1.717155,0.246972,1.562689,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.904449,-0.347599,-0.24728,1.27116,0.204368,-0.021329,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.288332,0.954261,-0.079066,1.192338,0.463307,-0.021329,
-	0.711557,0.698766,-0.073569,1.762087,0.442766,2.44154,
-	0.844008,0.528559,-0.090974,1.792852,0.404136,2.439814,
-	0.739369,0.666111,-0.098133,1.698631,0.441443,1.715116,
-	0.506757,-0.743743,-0.43594,1.667565,0.059804,1.716859,
-	0.770964,-0.531938,-0.350222,1.792582,-0.265825,2.439829,
-	0.505027,-0.739497,-0.445076,1.761786,-0.304479,2.441557,
-	0.952938,0.154945,-0.260578,1.284174,0.338115,-0.021329,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.964597,-0.000855,-0.263728,1.288529,0.292549,-0.021329,
-	0.981926,0.158648,-0.103211,1.855064,0.246944,2.574115,
-	0.991975,0.067695,-0.106788,1.867776,0.144331,2.573402,
-	0.987616,0.121103,-0.099745,1.852221,0.169291,2.436483,
-	0.627181,0.763304,-0.154955,1.657866,0.44614,1.566015,
-	0.825346,0.546533,-0.14179,1.725039,0.408343,1.713635,
-	0.773313,0.602828,-0.196431,1.684274,0.418004,1.564533,
-	-0.998221,0,0.059628,1.772155,0.429175,2.822721,
-	-0.998221,0,0.059628,1.769671,-0.351987,2.781136,
-	-0.998221,0,0.059628,1.772155,-0.351987,2.822721,
-	-0.998221,0,0.059628,1.769671,-0.351987,2.781136,
-	-0.998221,0,0.059628,1.772155,0.429175,2.822721,
-	-0.998221,0,0.059628,1.769671,0.429968,2.781136,
-	0,-1,0,-1.473662,-0.391356,2.907315,
-	-0.204863,-0.9786,-0.019334,-1.789572,-0.391356,2.721769,
-	-0.243848,-0.96921,-0.034203,-1.719171,-0.391356,1.9758,
-	0,-1,0,-1.473662,-0.391356,2.907315,
-	-0.243848,-0.96921,-0.034203,-1.719171,-0.391356,1.9758,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	-0.00444,-0.99999,0.000116,-0.583012,-0.391356,-0.021329,
-	-0.004277,-0.999991,0.000118,-0.578202,-0.391399,-0.021329,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.445302,-0.391356,-0.021329,
-	0,-1,0,-0.396035,-0.391356,0.119998,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.339188,-0.391356,0.268089,
-	0,-1,0,-0.277207,-0.391356,0.414107,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.277207,-0.391356,0.414107,
-	0,-1,0,-0.210168,-0.391356,0.557872,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.210168,-0.391356,0.557872,
-	0,-1,0,-0.138153,-0.391356,0.69921,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.138153,-0.391356,0.69921,
-	0,-1,0,-0.061249,-0.391356,0.837949,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.061249,-0.391356,0.837949,
-	0,-1,0,0.020451,-0.391356,0.973919,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.020451,-0.391356,0.973919,
-	0,-1,0,0.106845,-0.391356,1.106955,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.106845,-0.391356,1.106955,
-	0,-1,0,0.19783,-0.391356,1.236895,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.19783,-0.391356,1.236895,
-	0,-1,0,0.293295,-0.391356,1.363581,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.293295,-0.391356,1.363581,
-	0,-1,0,0.393122,-0.391356,1.486857,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.393122,-0.391356,1.486857,
-	0,-1,0,0.497191,-0.391356,1.606575,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.497191,-0.391356,1.606575,
-	0,-1,0,0.605375,-0.391356,1.722588,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,0.605375,-0.391356,1.722588,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,0.605375,-0.391356,1.722588,
-	0,-1,0,0.717541,-0.391356,1.834754,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,0.717541,-0.391356,1.834754,
-	0,-1,0,0.833554,-0.391356,1.942938,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,0.833554,-0.391356,1.942938,
-	0,-1,0,0.953272,-0.391356,2.047007,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,0.953272,-0.391356,2.047007,
-	0,-1,0,1.076548,-0.391356,2.146834,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.076548,-0.391356,2.146834,
-	0,-1,0,1.203234,-0.391356,2.242299,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.203234,-0.391356,2.242299,
-	0,-1,0,1.333174,-0.391356,2.333284,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.333174,-0.391356,2.333284,
-	0,-1,0,1.46621,-0.391356,2.419678,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.46621,-0.391356,2.419678,
-	0,-1,0,1.60218,-0.391356,2.501378,
-	0,-1,0,1.567503,-0.391357,3.38714,
-	0,-1,0,1.60218,-0.391356,2.501378,
-	0.000552,-1,-0.000055,1.792693,-0.391357,3.166558,
-	0.000552,-1,-0.000055,1.792693,-0.391357,3.166558,
-	0,-1,0,1.60218,-0.391356,2.501378,
-	0.001527,-0.999999,-0.000135,1.740919,-0.391356,2.578282,
-	0.000552,-1,-0.000055,1.792693,-0.391357,3.166558,
-	0.001527,-0.999999,-0.000135,1.740919,-0.391356,2.578282,
-	0.20767,-0.977918,-0.023446,1.744615,-0.391346,2.580312,
-	0.000552,-1,-0.000055,1.792693,-0.391357,3.166558,
-	0.20767,-0.977918,-0.023446,1.744615,-0.391346,2.580312,
-	0.207733,-0.9779,-0.023645,1.772155,-0.391357,2.822721,
-	0.613857,0.771354,-0.167905,1.223803,0.445458,-0.021329,
-	0.773313,0.602828,-0.196431,1.684274,0.418004,1.564533,
-	0.80696,0.547786,-0.220785,1.250799,0.417372,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0,0.997162,-0.07528,0.377018,0.469993,-0.021329,
-	0.009051,0.997085,-0.075758,0.303932,0.469993,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.008038,0.997118,-0.075439,0.391707,0.469993,-0.021329,
-	0,0.997162,-0.07528,0.377018,0.469993,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.006337,0.997132,-0.075415,0.394344,0.469951,-0.021329,
-	0.008038,0.997118,-0.075439,0.391707,0.469993,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	-0.001701,0.997163,-0.075255,0.406812,0.469993,-0.021329,
-	0.006337,0.997132,-0.075415,0.394344,0.469951,-0.021329,
-	0.770844,-0.562595,-0.298807,1.684053,0.167587,1.564546,
-	0.605395,-0.778525,-0.165517,1.223677,0.139521,-0.021329,
-	0.807151,-0.547554,-0.220661,1.250463,0.167512,-0.021329,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.505346,0.851806,-0.138025,1.219931,0.447894,-0.021329,
-	0.288332,0.954261,-0.079066,1.192338,0.463307,-0.021329,
-	0.39596,0.91224,-0.105037,1.627101,0.463824,1.567741,
-	0.613857,0.771354,-0.167905,1.223803,0.445458,-0.021329,
-	0.505346,0.851806,-0.138025,1.219931,0.447894,-0.021329,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.001297,0.996986,-0.077575,0.029236,0.470013,-0.021329,
-	-0.001223,0.996985,-0.077584,0.012875,0.469971,-0.021329,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	-0.000418,0.999281,-0.037914,1.086592,0.46967,-0.021329,
-	-0.000735,0.999282,-0.03789,1.085566,0.469669,-0.021329,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.083141,0.995658,-0.041878,1.157159,0.469626,-0.021329,
-	-0.000418,0.999281,-0.037914,1.086592,0.46967,-0.021329,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.184736,0.981481,-0.050663,1.188641,0.464041,-0.021329,
-	0.168416,0.984624,-0.046387,1.159104,0.4693,-0.021329,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.288332,0.954261,-0.079066,1.192338,0.463307,-0.021329,
-	0.184736,0.981481,-0.050663,1.188641,0.464041,-0.021329,
-	0.904661,0.346941,-0.247428,1.271248,0.380955,-0.021329,
-	0.946878,0.205961,-0.246986,1.717236,0.338631,1.562684,
-	0.952938,0.154945,-0.260578,1.284174,0.338115,-0.021329,
-	-0.346553,0.933315,-0.093941,-1.593323,0.46934,1.438224,
-	-0.512223,0.844277,-0.157556,-1.168401,0.454762,-0.021329,
-	-0.388183,0.91542,-0.106401,-1.625486,0.454676,1.429408,
-	-0.436436,0.891263,-0.123179,-1.593323,0.46934,1.438224,
-	-0.505009,0.849029,-0.155293,-1.166885,0.456027,-0.021329,
-	-0.654864,0.727594,-0.204353,-1.168401,0.454762,-0.021329,
-	-0.346553,0.933315,-0.093941,-1.593323,0.46934,1.438224,
-	-0.271068,0.958765,-0.085395,-1.133667,0.469297,-0.021329,
-	-0.505009,0.849029,-0.155293,-1.166885,0.456027,-0.021329,
-	0.952752,-0.156236,-0.260487,1.284116,0.24723,-0.021329,
-	0.938723,-0.205797,-0.276489,1.717155,0.246972,1.562689,
-	0.904449,-0.347599,-0.24728,1.27116,0.204368,-0.021329,
-	0.904449,-0.347599,-0.24728,1.27116,0.204368,-0.021329,
-	0.882004,-0.370857,-0.290748,1.704367,0.204263,1.563406,
-	0.807151,-0.547554,-0.220661,1.250463,0.167512,-0.021329,
-	0.964263,-0.000657,-0.264945,1.721544,0.292802,1.562442,
-	0.952752,-0.156236,-0.260487,1.284116,0.24723,-0.021329,
-	0.964597,-0.000855,-0.263728,1.288529,0.292549,-0.021329,
-	0.80696,0.547786,-0.220785,1.250799,0.417372,-0.021329,
-	0.896813,0.381482,-0.22405,1.704523,0.381335,1.563397,
-	0.904661,0.346941,-0.247428,1.271248,0.380955,-0.021329,
-	-0.788436,-0.590729,-0.171486,0.365496,-0.027628,0.463635,
-	-0.671967,-0.6777,-0.298635,0.364466,0.008825,0.342799,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.084698,0.953745,0.28844,0.364466,0.008825,0.342799,
-	-0.084698,0.953745,0.28844,0.365496,-0.027628,0.463635,
-	-0.084698,0.953745,0.28844,0.364821,-0.003737,0.384439,
-	-0.874399,-0.46654,-0.133289,0.364821,-0.003737,0.384439,
-	-0.788436,-0.590729,-0.171486,0.365496,-0.027628,0.463635,
-	-0.874399,-0.46654,-0.133289,0.365067,-0.017684,0.431644,
-	-0.788436,-0.590729,-0.171486,0.365496,-0.027628,0.463635,
-	-0.672528,-0.677458,-0.297921,0.550466,-0.257589,0.528855,
-	-0.775202,-0.621236,-0.11458,0.365783,-0.037793,0.497331,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.765433,-0.076157,0.638994,0.546029,-0.105148,0.973456,
-	-0.78972,-0.133178,0.598838,0.682929,-0.311817,1.108903,
-	-0.765433,-0.076157,0.638994,0.546029,-0.105148,0.973456,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.765796,-0.063678,0.639923,0.555173,-0.104583,0.984454,
-	-0.765433,-0.076157,0.638994,0.546029,-0.105148,0.973456,
-	-0.765796,-0.063678,0.639923,0.555173,-0.104583,0.984454,
-	-0.759557,-0.12673,0.637976,0.549572,-0.104847,0.977734,
-	-0.438608,-0.806129,0.397215,0.549572,-0.104847,0.977734,
-	-0.438608,-0.806129,0.397215,0.555173,-0.104583,0.984454,
-	-0.438608,-0.806129,0.397215,0.551399,-0.104719,0.980011,
-	-0.397992,0.380616,0.834706,0.886816,-0.070199,1.246183,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.499279,0.460824,0.733731,0.758404,-0.078952,1.180247,
-	-0.084938,-0.957458,0.275791,0.758981,-0.077961,1.179865,
-	-0.084938,-0.957458,0.275791,0.886816,-0.070199,1.246183,
-	-0.084938,-0.957458,0.275791,0.762622,-0.077692,1.181918,
-	-0.47928,0.243811,0.843117,0.865187,-0.178304,1.269373,
-	-0.525635,0.427293,0.735615,0.755695,-0.079224,1.178282,
-	-0.490795,0.246987,0.835534,0.753511,-0.079688,1.177433,
-	-0.502999,0.214001,0.837374,0.755695,-0.079224,1.178282,
-	-0.47928,0.243811,0.843117,0.865187,-0.178304,1.269373,
-	-0.479672,0.399525,0.781213,0.758404,-0.078952,1.180247,
-	0.411104,-0.808356,-0.421371,0.755695,-0.079224,1.178282,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.341562,-0.894102,-0.289684,0.753511,-0.079688,1.177433,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.411104,-0.808356,-0.421371,0.755695,-0.079224,1.178282,
-	0.441471,-0.737274,-0.511401,0.758404,-0.078952,1.180247,
-	0.410782,-0.836134,-0.363507,0.393122,-0.391356,1.486857,
-	0.406635,-0.856746,-0.31723,0.690311,-0.091124,1.126951,
-	0.341562,-0.894102,-0.289684,0.753511,-0.079688,1.177433,
-	0.430585,-0.755425,-0.493893,0.762622,-0.077692,1.181918,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.441471,-0.737274,-0.511401,0.758404,-0.078952,1.180247,
-	0.40862,-0.836512,-0.365072,0.497191,-0.391356,1.606575,
-	0.430585,-0.755425,-0.493893,0.762622,-0.077692,1.181918,
-	0.416058,-0.835881,-0.358048,0.868735,-0.0443,1.228096,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.388183,-0.915419,-0.106401,-1.625487,-0.376692,1.429408,
-	-0.209954,-0.97514,-0.070863,-1.168402,-0.376779,-0.021329,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.209954,-0.97514,-0.070863,-1.168402,-0.376779,-0.021329,
-	-0.217197,-0.973383,-0.073152,-1.166885,-0.376822,-0.021329,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.217197,-0.973383,-0.073152,-1.166885,-0.376822,-0.021329,
-	-0.135336,-0.989883,-0.042621,-1.133667,-0.391356,-0.021329,
-	0.000001,-1,0.000294,0.435364,0.1157,0.114425,
-	-0.000315,-1,0.00014,0.428578,0.1157,0.099871,
-	-0.000086,-1,0.00026,0.50133,0.11566,-0.021329,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	0.000064,-1,0.000388,0.512455,0.115661,-0.021329,
-	0.000029,-1,0.000412,0.517242,0.115661,-0.021329,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	-0.000033,-1,0.000445,0.525941,0.115661,-0.021329,
-	-0.000014,-1,0.000438,0.53006,0.115661,-0.021329,
-	-0.000001,-1,0,1.303752,0.115699,0.560049,
-	0,-1,0,1.226889,0.115699,0.4205,
-	0,-1,0,1.158086,0.115699,-0.021329,
-	0,-1,0,1.346671,0.115699,0.703372,
-	-0.000001,-1,0,1.303752,0.115699,0.560049,
-	0,-1,0,1.158086,0.115699,-0.021329,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.347924,0.115699,0.731818,
-	0,-1,0,1.346671,0.115699,0.703372,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.350509,0.1157,1.368801,
-	0,-1,0,1.347924,0.115699,0.731818,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.449875,0.1157,1.455178,
-	0,-1,0,1.350509,0.1157,1.368801,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.552194,0.1157,1.538035,
-	0,-1,0,1.449875,0.1157,1.455178,
-	0,-1,0,1.071328,0.1157,1.08962,
-	0,-1,0,1.050087,0.1157,1.065186,
-	0,-1,0,1.347924,0.115699,0.731818,
-	0,-1,0,1.16112,0.1157,1.185911,
-	0,-1,0,1.071328,0.1157,1.08962,
-	0,-1,0,1.347924,0.115699,0.731818,
-	0,-1,0,1.254219,0.1157,1.279009,
-	0,-1,0,1.16112,0.1157,1.185911,
-	0,-1,0,1.347924,0.115699,0.731818,
-	0,-1,0,1.350509,0.1157,1.368801,
-	0,-1,0,1.254219,0.1157,1.279009,
-	0,-1,0,1.347924,0.115699,0.731818,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.630309,0.099649,0.769923,0.643743,-0.099518,1.08978,
-	-0.704322,0.009285,0.70982,0.640686,-0.100103,1.087313,
-	-0.630309,0.099649,0.769923,0.643743,-0.099518,1.08978,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.628473,0.104347,0.7708,0.645497,-0.099189,1.091151,
-	-0.628473,0.104347,0.7708,0.645497,-0.099189,1.091151,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.631922,0.095714,0.769099,0.665608,-0.095567,1.107224,
-	-0.631922,0.095714,0.769099,0.665608,-0.095567,1.107224,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.631713,0.096164,0.769215,0.673898,-0.094074,1.113849,
-	-0.631713,0.096164,0.769215,0.673898,-0.094074,1.113849,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.631638,0.096354,0.769253,0.690311,-0.091124,1.126951,
-	-0.611735,0.119506,0.781984,0.84883,-0.216217,1.272781,
-	-0.490795,0.246987,0.835534,0.753511,-0.079688,1.177433,
-	-0.631638,0.096354,0.769253,0.690311,-0.091124,1.126951,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.942413,0.153754,-0.297013,-1.250661,0.25354,-0.021329,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.942413,0.153754,-0.297013,-1.250661,0.25354,-0.021329,
-	-0.946173,0.125627,-0.298284,-1.258407,0.189508,-0.021329,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.946173,0.125627,-0.298284,-1.258407,0.189508,-0.021329,
-	-0.951352,0.071862,-0.299608,-1.264066,0.150374,-0.021329,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	-0.000014,-1,0.000438,0.53006,0.115661,-0.021329,
-	0.000022,-1,0.000133,1.105769,0.115699,-0.021329,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	0.006788,0.997025,-0.076781,0.302467,0.470013,-0.021329,
-	-0.001297,0.996986,-0.077575,0.029236,0.470013,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.058512,0.995903,-0.06894,0.726874,0.469993,-0.021329,
-	-0.001701,0.997163,-0.075255,0.406812,0.469993,-0.021329,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	-0.000735,0.999282,-0.03789,1.085566,0.469669,-0.021329,
-	0.078004,0.995473,-0.05431,0.72963,0.469668,-0.021329,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	0,-1,0,-1.129276,-0.391356,-0.021329,
-	-0.00444,-0.99999,0.000116,-0.583012,-0.391356,-0.021329,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	0,0.996796,-0.07999,-0.403368,0.470034,-0.021329,
-	-0.063557,0.995303,-0.073018,-0.701067,0.470034,-0.021329,
-	0.514271,-0.836016,-0.19132,-0.396035,-0.391356,0.119998,
-	0.51815,-0.835999,-0.18063,-0.445302,-0.391356,-0.021329,
-	0.515247,-0.836022,-0.18865,-0.007741,-0.120157,-0.021329,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.001223,0.996985,-0.077584,0.012875,0.469971,-0.021329,
-	0.009468,0.996863,-0.078582,-0.272122,0.470013,-0.021329,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	0.007064,0.996807,-0.079537,-0.273618,0.470034,-0.021329,
-	0,0.996796,-0.07999,-0.403368,0.470034,-0.021329,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	-0.004277,-0.999991,0.000118,-0.578202,-0.391399,-0.021329,
-	0.000109,-1,0.000002,-0.447809,-0.391356,-0.021329,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.047726,0.997181,-0.057905,-0.704134,0.46974,-0.021329,
-	-0.114051,0.992145,-0.051394,-1.131355,0.469698,-0.021329,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	0.000029,-1,0.000412,0.517242,0.115661,-0.021329,
-	-0.000033,-1,0.000445,0.525941,0.115661,-0.021329,
-	0.117527,-0.982232,-0.146317,1.594074,0.1157,1.569594,
-	0.089681,-0.995669,-0.024519,1.159105,0.115699,-0.021329,
-	0.259122,-0.963243,-0.070844,1.192294,0.121731,-0.021329,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.504226,0.552291,0.663876,0.755695,-0.079224,1.178282,
-	-0.479798,0.509116,0.714559,0.758404,-0.078952,1.180247,
-	-0.479798,0.509116,0.714559,0.758404,-0.078952,1.180247,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.504226,0.552291,0.663876,0.755695,-0.079224,1.178282,
-	-0.452228,0.452832,0.768397,0.762622,-0.077692,1.181918,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.499279,0.460824,0.733731,0.758404,-0.078952,1.180247,
-	-0.452228,0.452832,0.768397,0.762622,-0.077692,1.181918,
-	-0.486507,0.572163,0.660258,0.758981,-0.077961,1.179865,
-	-0.499279,0.460824,0.733731,0.758404,-0.078952,1.180247,
-	0,0,-1,-1.264066,0.150374,-0.021329,
-	0,0,-1,-1.264066,-0.07239,-0.021329,
-	0,0,-1,-1.268666,0.038992,-0.021329,
-	0,0,-1,-1.264066,-0.07239,-0.021329,
-	0,0,-1,-1.264066,0.150374,-0.021329,
-	0,0,-1,-1.25058,-0.176182,-0.021329,
-	0,0,-1,-1.25058,-0.176182,-0.021329,
-	0,0,-1,-1.264066,0.150374,-0.021329,
-	0,0,-1,-1.258407,0.189508,-0.021329,
-	0,0,-1,-1.25058,-0.176182,-0.021329,
-	0,0,-1,-1.258407,0.189508,-0.021329,
-	0,0,-1,-1.250661,0.25354,-0.021329,
-	0,0,-1,-1.25058,-0.176182,-0.021329,
-	0,0,-1,-1.250661,0.25354,-0.021329,
-	0,0,-1,-1.229126,0.343294,-0.021329,
-	0,0,-1,-1.25058,-0.176182,-0.021329,
-	0,0,-1,-1.229126,0.343294,-0.021329,
-	0,0,-1,-1.229126,-0.26531,-0.021329,
-	0,0,-1,-1.229126,-0.26531,-0.021329,
-	0,0,-1,-1.229126,0.343294,-0.021329,
-	0,0,-1,-1.201167,-0.333701,-0.021329,
-	0,0,-1,-1.201167,-0.333701,-0.021329,
-	0,0,-1,-1.229126,0.343294,-0.021329,
-	0,0,-1,-1.201167,0.411684,-0.021329,
-	0,0,-1,-1.201167,-0.333701,-0.021329,
-	0,0,-1,-1.201167,0.411684,-0.021329,
-	0,0,-1,-1.168402,-0.376779,-0.021329,
-	0,0,-1,-1.168402,-0.376779,-0.021329,
-	0,0,-1,-1.201167,0.411684,-0.021329,
-	0,0,-1,-1.168401,0.454762,-0.021329,
-	0,0,-1,-1.168402,-0.376779,-0.021329,
-	0,0,-1,-1.168401,0.454762,-0.021329,
-	0,0,-1,-1.166885,-0.376822,-0.021329,
-	0,0,-1,-1.166885,-0.376822,-0.021329,
-	0,0,-1,-1.168401,0.454762,-0.021329,
-	0,0,-1,-1.166885,0.456027,-0.021329,
-	0,0,-1,-1.166885,-0.376822,-0.021329,
-	0,0,-1,-1.166885,0.456027,-0.021329,
-	0,0,-1,-1.133667,-0.391356,-0.021329,
-	0,0,-1,-1.133667,-0.391356,-0.021329,
-	0,0,-1,-1.166885,0.456027,-0.021329,
-	0,0,-1,-1.133667,0.469297,-0.021329,
-	0,0,-1,-1.133667,-0.391356,-0.021329,
-	0,0,-1,-1.133667,0.469297,-0.021329,
-	0,0,-1,-1.131951,-0.391356,-0.021329,
-	0,0,-1,-1.131951,-0.391356,-0.021329,
-	0,0,-1,-1.133667,0.469297,-0.021329,
-	0,0,-1,-1.131355,0.469698,-0.021329,
-	0,0,-1,-1.131951,-0.391356,-0.021329,
-	0,0,-1,-1.131355,0.469698,-0.021329,
-	0,0,-1,-1.129276,-0.391356,-0.021329,
-	0,0,-1,-1.129276,-0.391356,-0.021329,
-	0,0,-1,-1.131355,0.469698,-0.021329,
-	0,0,-1,-0.704134,0.46974,-0.021329,
-	0,0,-1,-1.129276,-0.391356,-0.021329,
-	0,0,-1,-0.704134,0.46974,-0.021329,
-	0,0,-1,-0.583012,-0.391356,-0.021329,
-	0,0,-1,-0.583012,-0.391356,-0.021329,
-	0,0,-1,-0.704134,0.46974,-0.021329,
-	0,0,-1,-0.701067,0.470034,-0.021329,
-	0,0,-1,-0.583012,-0.391356,-0.021329,
-	0,0,-1,-0.701067,0.470034,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0,0,-1,-0.583012,-0.391356,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0,0,-1,-0.578202,-0.391399,-0.021329,
-	0,0,-1,-0.578202,-0.391399,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0,0,-1,-0.447809,-0.391356,-0.021329,
-	0,0,-1,-0.447809,-0.391356,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0,0,-1,-0.445302,-0.391356,-0.021329,
-	0,0,-1,-0.445302,-0.391356,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0.000003,0,-1,-0.007741,-0.120157,-0.021329,
-	0.000003,0,-1,-0.007741,-0.120157,-0.021329,
-	0,0,-1,-0.403368,0.470034,-0.021329,
-	0,0,-1,-0.273618,0.470034,-0.021329,
-	0.000003,0,-1,-0.007741,-0.120157,-0.021329,
-	0,0,-1,-0.273618,0.470034,-0.021329,
-	0,0,-1,-0.272122,0.470013,-0.021329,
-	0.000003,0,-1,-0.007741,-0.120157,-0.021329,
-	0,0,-1,-0.272122,0.470013,-0.021329,
-	0.000006,-0.000006,-1,0.012875,0.469971,-0.021329,
-	0.000003,0,-1,-0.007741,-0.120157,-0.021329,
-	0.000006,-0.000006,-1,0.012875,0.469971,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	0.000006,-0.000006,-1,0.012875,0.469971,-0.021329,
-	0,-0.000018,-1,0.029236,0.470013,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	0,-0.000018,-1,0.029236,0.470013,-0.021329,
-	0,-0.000018,-1,0.302467,0.470013,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	0,-0.000018,-1,0.302467,0.470013,-0.021329,
-	0,-0.000018,-1,0.303932,0.469993,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	0,-0.000018,-1,0.303932,0.469993,-0.021329,
-	0,-0.000018,-1,0.377018,0.469993,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	0,-0.000018,-1,0.377018,0.469993,-0.021329,
-	-0.000017,-0.000011,-1,0.391707,0.469993,-0.021329,
-	-0.000005,-0.000015,-1,0.377134,0.1157,-0.021323,
-	-0.000017,-0.000011,-1,0.391707,0.469993,-0.021329,
-	-0.00001,-0.000003,-1,0.50133,0.11566,-0.021329,
-	-0.00001,-0.000003,-1,0.50133,0.11566,-0.021329,
-	-0.000017,-0.000011,-1,0.391707,0.469993,-0.021329,
-	0,0,-1,0.394344,0.469951,-0.021329,
-	-0.00001,-0.000003,-1,0.50133,0.11566,-0.021329,
-	0,0,-1,0.394344,0.469951,-0.021329,
-	0,0,-1,0.406812,0.469993,-0.021329,
-	-0.00001,-0.000003,-1,0.50133,0.11566,-0.021329,
-	0,0,-1,0.406812,0.469993,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	-0.00001,-0.000003,-1,0.50133,0.11566,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.503029,0.11566,-0.021329,
-	0,0,-1,0.503029,0.11566,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.512455,0.115661,-0.021329,
-	0,0,-1,0.512455,0.115661,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.517242,0.115661,-0.021329,
-	0,0,-1,0.517242,0.115661,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.525941,0.115661,-0.021329,
-	0,0,-1,0.525941,0.115661,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.53006,0.115661,-0.021329,
-	0,0,-1,0.53006,0.115661,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,0.726874,0.469993,-0.021329,
-	0,0,-1,0.72963,0.469668,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,0.72963,0.469668,-0.021329,
-	0,0,-1,1.085566,0.469669,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,1.085566,0.469669,-0.021329,
-	0,0,-1,1.086592,0.46967,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,1.086592,0.46967,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.105769,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.11936,0.115699,-0.021329,
-	0,0,-1,1.11936,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.138614,0.115699,-0.021329,
-	0,0,-1,1.138614,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.150338,0.115699,-0.021329,
-	0,0,-1,1.150338,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.155792,0.115699,-0.021329,
-	0,0,-1,1.155792,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.158086,0.115699,-0.021329,
-	0,0,-1,1.158086,0.115699,-0.021329,
-	0,0,-1,1.157159,0.469626,-0.021329,
-	0,0,-1,1.159104,0.4693,-0.021329,
-	0,0,-1,1.158086,0.115699,-0.021329,
-	0,0,-1,1.159104,0.4693,-0.021329,
-	0,0,-1,1.159105,0.115699,-0.021329,
-	0,0,-1,1.159105,0.115699,-0.021329,
-	0,0,-1,1.159104,0.4693,-0.021329,
-	0,0,-1,1.188641,0.464041,-0.021329,
-	0,0,-1,1.159105,0.115699,-0.021329,
-	0,0,-1,1.188641,0.464041,-0.021329,
-	0,0,-1,1.192294,0.121731,-0.021329,
-	0,0,-1,1.192294,0.121731,-0.021329,
-	0,0,-1,1.188641,0.464041,-0.021329,
-	0,0,-1,1.192338,0.463307,-0.021329,
-	0,0,-1,1.192294,0.121731,-0.021329,
-	0,0,-1,1.192338,0.463307,-0.021329,
-	0,0,-1,1.223677,0.139521,-0.021329,
-	0,0,-1,1.223677,0.139521,-0.021329,
-	0,0,-1,1.192338,0.463307,-0.021329,
-	0,0,-1,1.219931,0.447894,-0.021329,
-	0,0,-1,1.223677,0.139521,-0.021329,
-	0,0,-1,1.219931,0.447894,-0.021329,
-	0,0,-1,1.223803,0.445458,-0.021329,
-	0,0,-1,1.223677,0.139521,-0.021329,
-	0,0,-1,1.223803,0.445458,-0.021329,
-	0,0,-1,1.250463,0.167512,-0.021329,
-	0,0,-1,1.250463,0.167512,-0.021329,
-	0,0,-1,1.223803,0.445458,-0.021329,
-	0,0,-1,1.250799,0.417372,-0.021329,
-	0,0,-1,1.250463,0.167512,-0.021329,
-	0,0,-1,1.250799,0.417372,-0.021329,
-	0,0,-1,1.27116,0.204368,-0.021329,
-	0,0,-1,1.27116,0.204368,-0.021329,
-	0,0,-1,1.250799,0.417372,-0.021329,
-	0,0,-1,1.271248,0.380955,-0.021329,
-	0,0,-1,1.27116,0.204368,-0.021329,
-	0,0,-1,1.271248,0.380955,-0.021329,
-	0,0,-1,1.284116,0.24723,-0.021329,
-	0,0,-1,1.284116,0.24723,-0.021329,
-	0,0,-1,1.271248,0.380955,-0.021329,
-	0,0,-1,1.284174,0.338115,-0.021329,
-	0,0,-1,1.284116,0.24723,-0.021329,
-	0,0,-1,1.284174,0.338115,-0.021329,
-	0,0,-1,1.288529,0.292549,-0.021329,
-	-0.000315,-1,0.00014,0.428578,0.1157,0.099871,
-	-0.000321,-1,0.000136,0.377134,0.1157,-0.021323,
-	-0.000086,-1,0.00026,0.50133,0.11566,-0.021329,
-	0.000128,-1,0.000374,0.453243,0.1157,0.101903,
-	-0.000086,-1,0.00026,0.50133,0.11566,-0.021329,
-	0.000057,-1,0.000347,0.503029,0.11566,-0.021329,
-	-0.000086,-1,0.00026,0.50133,0.11566,-0.021329,
-	0.000128,-1,0.000374,0.453243,0.1157,0.101903,
-	0.000001,-1,0.000294,0.435364,0.1157,0.114425,
-	0,-1,0,0.711069,0.115699,0.073242,
-	0.000022,-1,0.000133,1.105769,0.115699,-0.021329,
-	0,-1,0,1.11936,0.115699,-0.021329,
-	0.000022,-1,0.000133,1.105769,0.115699,-0.021329,
-	0,-1,0,0.711069,0.115699,0.073242,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	0,-1,0,0.854313,0.115699,0.11448,
-	0,-1,0,1.11936,0.115699,-0.021329,
-	0,-1,0,1.138614,0.115699,-0.021329,
-	0,-1,0,1.11936,0.115699,-0.021329,
-	0,-1,0,0.854313,0.115699,0.11448,
-	0,-1,0,0.711069,0.115699,0.073242,
-	0,-1,0,0.994243,0.115699,0.189857,
-	0,-1,0,1.138614,0.115699,-0.021329,
-	0,-1,0,1.150338,0.115699,-0.021329,
-	0,-1,0,1.138614,0.115699,-0.021329,
-	0,-1,0,0.994243,0.115699,0.189857,
-	0,-1,0,0.854313,0.115699,0.11448,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.158086,0.115699,-0.021329,
-	0.089681,-0.995669,-0.024519,1.159105,0.115699,-0.021329,
-	0,-1,0,1.158086,0.115699,-0.021329,
-	0.076269,-0.993022,-0.089943,1.594074,0.1157,1.569594,
-	0,-1,0,1.346671,0.115699,0.703372,
-	0.509935,-0.836018,-0.202584,0.377134,0.1157,-0.021323,
-	0.514271,-0.836016,-0.19132,-0.396035,-0.391356,0.119998,
-	0.515247,-0.836022,-0.18865,-0.007741,-0.120157,-0.021329,
-	0.514271,-0.836016,-0.19132,-0.396035,-0.391356,0.119998,
-	0.509935,-0.836018,-0.202584,0.377134,0.1157,-0.021323,
-	0.507543,-0.836018,-0.208504,-0.339188,-0.391356,0.268089,
-	0,-1,0,1.226889,0.115699,0.4205,
-	0,-1,0,1.155792,0.115699,-0.021329,
-	0,-1,0,1.158086,0.115699,-0.021329,
-	0,-1,0,1.155792,0.115699,-0.021329,
-	0,-1,0,1.226889,0.115699,0.4205,
-	0,-1,0,1.121322,0.115699,0.294234,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0.000109,-1,0.000002,-0.447809,-0.391356,-0.021329,
-	0,-1,0,-0.445302,-0.391356,-0.021329,
-	0.000109,-1,0.000002,-0.447809,-0.391356,-0.021329,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	0,-1,0,1.121322,0.115699,0.294234,
-	0,-1,0,1.150338,0.115699,-0.021329,
-	0,-1,0,1.155792,0.115699,-0.021329,
-	0,-1,0,1.150338,0.115699,-0.021329,
-	0,-1,0,1.121322,0.115699,0.294234,
-	0,-1,0,0.994243,0.115699,0.189857,
-	0,-1,0,-1.473662,-0.391356,2.907315,
-	-0.135336,-0.989883,-0.042621,-1.133667,-0.391356,-0.021329,
-	0,-1,0,-1.131951,-0.391356,-0.021329,
-	-0.135336,-0.989883,-0.042621,-1.133667,-0.391356,-0.021329,
-	0,-1,0,-1.473662,-0.391356,2.907315,
-	-0.232489,-0.970402,-0.065331,-1.593323,-0.391356,1.438224,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	0,-1,0,-1.131951,-0.391356,-0.021329,
-	0,-1,0,-1.129276,-0.391356,-0.021329,
-	0,-1,0,-1.131951,-0.391356,-0.021329,
-	-0.001426,-0.999999,0.000039,-0.497427,-0.391356,3.265652,
-	0,-1,0,-1.473662,-0.391356,2.907315,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	0.000057,-1,0.000347,0.503029,0.11566,-0.021329,
-	0.000064,-1,0.000388,0.512455,0.115661,-0.021329,
-	0.000057,-1,0.000347,0.503029,0.11566,-0.021329,
-	0.000033,-1,0.000347,0.574271,0.115699,0.068952,
-	0.000128,-1,0.000374,0.453243,0.1157,0.101903,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.918203,0.270695,-0.289184,-1.229126,0.343294,-0.021329,
-	-0.942413,0.153754,-0.297013,-1.250661,0.25354,-0.021329,
-	-0.918203,0.270695,-0.289184,-1.229126,0.343294,-0.021329,
-	-0.949809,0.173614,-0.260235,-1.700945,0.254166,1.408725,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	0.500479,-0.836021,-0.224924,0.428578,0.1157,0.099871,
-	0.507543,-0.836018,-0.208504,-0.339188,-0.391356,0.268089,
-	0.509935,-0.836018,-0.202584,0.377134,0.1157,-0.021323,
-	0.507543,-0.836018,-0.208504,-0.339188,-0.391356,0.268089,
-	0.500479,-0.836021,-0.224924,0.428578,0.1157,0.099871,
-	0.501259,-0.836022,-0.223175,-0.277207,-0.391356,0.414107,
-	-0.778493,-0.586351,-0.223921,-1.625487,-0.376692,1.429408,
-	-0.817175,-0.515734,-0.257377,-1.201167,-0.333701,-0.021329,
-	-0.772035,-0.587205,-0.243211,-1.168402,-0.376779,-0.021329,
-	-0.817175,-0.515734,-0.257377,-1.201167,-0.333701,-0.021329,
-	-0.778493,-0.586351,-0.223921,-1.625487,-0.376692,1.429408,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.904453,-0.317539,-0.284838,-1.229126,-0.26531,-0.021329,
-	-0.817175,-0.515734,-0.257377,-1.201167,-0.333701,-0.021329,
-	-0.904453,-0.317539,-0.284838,-1.229126,-0.26531,-0.021329,
-	-0.846632,-0.478533,-0.232853,-1.655459,-0.3337,1.421192,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.93637,-0.1904,-0.29489,-1.25058,-0.176182,-0.021329,
-	-0.904453,-0.317539,-0.284838,-1.229126,-0.26531,-0.021329,
-	-0.93637,-0.1904,-0.29489,-1.25058,-0.176182,-0.021329,
-	-0.921583,-0.294507,-0.252885,-1.681196,-0.26531,1.414138,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.949487,-0.095192,-0.299021,-1.264066,-0.07239,-0.021329,
-	-0.93637,-0.1904,-0.29489,-1.25058,-0.176182,-0.021329,
-	-0.949487,-0.095192,-0.299021,-1.264066,-0.07239,-0.021329,
-	-0.949732,-0.173729,-0.260436,-1.700945,-0.176182,1.408725,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.41126,-0.697198,-0.58718,0.435364,0.1157,0.114425,
-	-0.307986,-0.679834,-0.66556,0.453243,0.1157,0.101903,
-	-0.41126,-0.697198,-0.58718,0.435364,0.1157,0.114425,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.41126,-0.697198,-0.58718,0.406831,0.08212,0.174281,
-	-0.41126,-0.697198,-0.58718,0.406831,0.08212,0.174281,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.507972,-0.702526,-0.498419,0.391924,0.064577,0.205552,
-	-0.507972,-0.702526,-0.498419,0.391924,0.064577,0.205552,
-	-0.343264,-0.686966,-0.640506,0.714801,-0.258939,0.363541,
-	-0.507497,-0.702632,-0.498754,0.615433,-0.255562,0.429129,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.168416,0.984624,-0.046387,1.159104,0.4693,-0.021329,
-	0.083141,0.995658,-0.041878,1.157159,0.469626,-0.021329,
-	0.168416,0.984624,-0.046387,1.159104,0.4693,-0.021329,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	0.180985,0.982354,-0.047179,1.594075,0.469851,1.569594,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.078004,0.995473,-0.05431,0.72963,0.469668,-0.021329,
-	0.058512,0.995903,-0.06894,0.726874,0.469993,-0.021329,
-	0.078004,0.995473,-0.05431,0.72963,0.469668,-0.021329,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	0.132481,0.990896,-0.02395,1.285101,0.569339,2.603406,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	0.009051,0.997085,-0.075758,0.303932,0.469993,-0.021329,
-	0.006788,0.997025,-0.076781,0.302467,0.470013,-0.021329,
-	0.009051,0.997085,-0.075758,0.303932,0.469993,-0.021329,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	0.032071,0.999429,-0.01065,0.44507,0.66934,2.619225,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.951352,0.071862,-0.299608,-1.264066,0.150374,-0.021329,
-	-0.953736,-0.013129,-0.300359,-1.268666,0.038992,-0.021329,
-	-0.951352,0.071862,-0.299608,-1.264066,0.150374,-0.021329,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.959247,0.088043,-0.268503,-1.71336,0.150374,1.405322,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.953736,-0.013129,-0.300359,-1.268666,0.038992,-0.021329,
-	-0.949487,-0.095192,-0.299021,-1.264066,-0.07239,-0.021329,
-	-0.953736,-0.013129,-0.300359,-1.268666,0.038992,-0.021329,
-	-0.961223,-0.081307,-0.263515,-1.71336,-0.07239,1.405322,
-	-0.964427,0,-0.264349,-1.717594,0.038992,1.404161,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	0.009468,0.996863,-0.078582,-0.272122,0.470013,-0.021329,
-	0.007064,0.996807,-0.079537,-0.273618,0.470034,-0.021329,
-	0.009468,0.996863,-0.078582,-0.272122,0.470013,-0.021329,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	-0.009408,0.999431,0.032405,0.005897,0.66934,2.540767,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.063557,0.995303,-0.073018,-0.701067,0.470034,-0.021329,
-	-0.047726,0.997181,-0.057905,-0.704134,0.46974,-0.021329,
-	-0.063557,0.995303,-0.073018,-0.701067,0.470034,-0.021329,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.040582,0.999145,0.007945,-0.433276,0.66934,2.462309,
-	-0.302581,0.949833,-0.079128,-1.593323,0.46934,1.438224,
-	-0.114051,0.992145,-0.051394,-1.131355,0.469698,-0.021329,
-	-0.271068,0.958765,-0.085395,-1.133667,0.469297,-0.021329,
-	-0.114051,0.992145,-0.051394,-1.131355,0.469698,-0.021329,
-	-0.302581,0.949833,-0.079128,-1.593323,0.46934,1.438224,
-	-0.13077,0.99131,-0.01428,-1.234429,0.56934,2.130951,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	-0.855994,0.441137,-0.269577,-1.201167,0.411684,-0.021329,
-	-0.918203,0.270695,-0.289184,-1.229126,0.343294,-0.021329,
-	-0.855994,0.441137,-0.269577,-1.201167,0.411684,-0.021329,
-	-0.921725,0.294507,-0.252364,-1.681196,0.343294,1.414138,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.728809,0.645974,-0.227057,-1.168401,0.454762,-0.021329,
-	-0.855994,0.441137,-0.269577,-1.201167,0.411684,-0.021329,
-	-0.728809,0.645974,-0.227057,-1.168401,0.454762,-0.021329,
-	-0.846877,0.478832,-0.23134,-1.655458,0.411684,1.421192,
-	-0.78424,0.585803,-0.204457,-1.625486,0.454676,1.429408,
-	0,-1,0,0.500177,-0.391356,3.423108,
-	0,-1,0,-0.396035,-0.391356,0.119998,
-	0,-1,0,-0.339188,-0.391356,0.268089,
-	0.117527,-0.982232,-0.146317,1.594074,0.1157,1.569594,
-	0.259122,-0.963243,-0.070844,1.192294,0.121731,-0.021329,
-	0.30254,-0.939741,-0.159236,1.6268,0.121747,1.567758
-};
-static const struct gllist handsy_model_palm_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 2082, handsy_model_palm_data, 0
-};
-const struct gllist *handsy_model_palm = &handsy_model_palm_frame;
-
-static const float handsy_model_thumb_distal_data[] = {
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.873922,-0.003805,0.486051,0.255586,0.077023,0.737599,
-	0.873735,-0.002446,0.486396,0.259079,0.042565,0.731119,
-	0.873922,-0.003805,0.486051,0.255586,0.077023,0.737599,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.927775,0.05186,0.369519,0.290282,0.101111,0.675403,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.873703,-0.000675,0.48646,0.263372,0.000216,0.723233,
-	0.919547,0.019558,0.392492,0.301447,0,0.654848,
-	0.873703,-0.000675,0.48646,0.263372,0.000216,0.723233,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.873735,-0.002446,0.486396,0.259079,0.042565,0.731119,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.500468,0.831871,0.239838,0.145913,0.309078,1.106884,
-	0.312254,0.908542,0.277577,0.092482,0.341223,1.106884,
-	0.500468,0.831871,0.239838,0.145913,0.309078,1.106884,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.56058,0.750837,0.349275,0.145913,0.292777,1.143555,
-	0.56058,0.750837,0.349275,0.145913,0.292777,1.143555,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.539476,0.689911,0.482689,0.138564,0.274291,1.195089,
-	0.876662,-0.009947,0.481004,0.173158,0.314854,0.891031,
-	0.876902,-0.010028,0.480565,0.164839,0.309002,0.906089,
-	0.876422,-0.009866,0.481442,0.17165,0.297474,0.89342,
-	0.876902,-0.010028,0.480565,0.164839,0.309002,0.906089,
-	0.85821,-0.006695,0.513255,0.162433,0.32323,0.910776,
-	0.838263,-0.003347,0.545256,0.161481,0.30464,0.912126,
-	0.85821,-0.006695,0.513255,0.162433,0.32323,0.910776,
-	0.876902,-0.010028,0.480565,0.164839,0.309002,0.906089,
-	0.876662,-0.009947,0.481004,0.173158,0.314854,0.891031,
-	0.6758,0.511985,0.530251,0.182602,0.222325,1.198099,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.6758,0.511985,0.530251,0.182602,0.222325,1.198099,
-	0.62679,0.5624,0.539297,0.177609,0.230776,1.195089,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.62679,0.5624,0.539297,0.177609,0.230776,1.195089,
-	0.539476,0.689911,0.482689,0.138564,0.274291,1.195089,
-	0.793481,0.350519,0.497519,0.210798,0.152003,1.211665,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.793481,0.350519,0.497519,0.210798,0.152003,1.211665,
-	0.763605,0.403416,0.504145,0.195133,0.201117,1.19609,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.763605,0.403416,0.504145,0.195133,0.201117,1.19609,
-	0.6758,0.511985,0.530251,0.182602,0.222325,1.198099,
-	-0.952716,-0.303863,0,0.224838,0.10798,1.346935,
-	-0.971429,-0.23733,0,0.226074,0.104106,1.208813,
-	-0.985558,-0.169336,0,0.226074,0.104106,1.347445,
-	-0.971429,-0.23733,0,0.226074,0.104106,1.208813,
-	-0.952716,-0.303863,0,0.224838,0.10798,1.346935,
-	-0.952716,-0.303863,0,0.210798,0.152003,1.211665,
-	-0.952716,-0.303863,0,0.210798,0.152003,1.211665,
-	-0.952716,-0.303863,0,0.224838,0.10798,1.346935,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.308356,
-	-0.952716,-0.303863,0,0.210798,0.152003,1.211665,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.308356,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.19609,
-	0.994901,0.100856,0,0.263372,0.000216,0.723233,
-	0.994901,0.100856,0,0.263394,0,1.36115,
-	0.994901,0.100856,0,0.263394,0,0.723195,
-	0.994901,0.100856,0,0.263394,0,1.36115,
-	0.994901,0.100856,0,0.263372,0.000216,0.723233,
-	0.994901,0.100856,0,0.252447,0.10798,1.346935,
-	0.994901,0.100856,0,0.252447,0.10798,1.346935,
-	0.994901,0.100856,0,0.263372,0.000216,0.723233,
-	0.994901,0.100856,0,0.259079,0.042565,0.731119,
-	0.994901,0.100856,0,0.252447,0.10798,1.346935,
-	0.994901,0.100856,0,0.259079,0.042565,0.731119,
-	0.994901,0.100856,0,0.255586,0.077023,0.737599,
-	0.994901,0.100856,0,0.252447,0.10798,1.346935,
-	0.994901,0.100856,0,0.255586,0.077023,0.737599,
-	0.985558,0.169336,0,0.251928,0.113103,0.744607,
-	0.994901,0.100856,0,0.252447,0.10798,1.346935,
-	0.985558,0.169336,0,0.251928,0.113103,0.744607,
-	0.971429,0.23733,0,0.251928,0.113103,1.344813,
-	0.919422,0.073474,0.386347,0.274037,0.157167,0.70531,
-	0.874814,-0.007622,0.484399,0.237898,0.157092,0.77053,
-	0.874447,-0.006469,0.485078,0.248003,0.12541,0.751819,
-	0.874814,-0.007622,0.484399,0.237898,0.157092,0.77053,
-	0.919422,0.073474,0.386347,0.274037,0.157167,0.70531,
-	0.910258,0.063882,0.409084,0.259167,0.19321,0.732687,
-	0.910258,0.063882,0.409084,0.259167,0.19321,0.732687,
-	0.875344,-0.008697,0.483422,0.219541,0.214647,0.804721,
-	0.874814,-0.007622,0.484399,0.237898,0.157092,0.77053,
-	0.875344,-0.008697,0.483422,0.219541,0.214647,0.804721,
-	0.910258,0.063882,0.409084,0.259167,0.19321,0.732687,
-	0.875651,-0.009145,0.482859,0.230667,0.24695,0.785155,
-	0.876066,-0.009661,0.482094,0.214135,0.2689,0.815591,
-	0.876422,-0.009866,0.481442,0.17165,0.297474,0.89342,
-	0.87595,-0.009537,0.482307,0.206427,0.238615,0.828993,
-	0.876422,-0.009866,0.481442,0.17165,0.297474,0.89342,
-	0.876066,-0.009661,0.482094,0.214135,0.2689,0.815591,
-	0.876662,-0.009947,0.481004,0.173158,0.314854,0.891031,
-	0.865819,0.160892,0.473783,0.228767,0.077538,1.217427,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.865819,0.160892,0.473783,0.228767,0.077538,1.217427,
-	0.844325,0.24079,0.478682,0.226074,0.104106,1.208813,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.844325,0.24079,0.478682,0.226074,0.104106,1.208813,
-	0.793481,0.350519,0.497519,0.210798,0.152003,1.211665,
-	0.865819,0.160892,0.473783,0.228767,0.077538,1.217427,
-	0.84071,0.076204,0.536096,0.207581,0,1.270833,
-	0.881366,0.079889,0.46563,0.236628,0,1.215852,
-	0.84071,0.076204,0.536096,0.207581,0,1.270833,
-	0.865819,0.160892,0.473783,0.228767,0.077538,1.217427,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	-0.994901,-0.100856,0,0.236628,0,1.36115,
-	-0.994901,-0.100856,0,0.228767,0.077538,1.217427,
-	-0.994901,-0.100856,0,0.236628,0,1.215852,
-	-0.994901,-0.100856,0,0.228767,0.077538,1.217427,
-	-0.994901,-0.100856,0,0.236628,0,1.36115,
-	-0.985558,-0.169336,0,0.226074,0.104106,1.347445,
-	-0.994901,-0.100856,0,0.228767,0.077538,1.217427,
-	-0.985558,-0.169336,0,0.226074,0.104106,1.347445,
-	-0.971429,-0.23733,0,0.226074,0.104106,1.208813,
-	0.873703,-0.000675,0.48646,0.263372,0.000216,0.723233,
-	0.873705,0.00202,0.486453,0.263394,0,0.723195,
-	0.919547,0.019558,0.392492,0.301447,0,0.654848,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.919547,0.019558,0.392492,0.301447,0,0.654848,
-	0.977781,0.093209,0.187769,0.429204,0,0,
-	0.062066,0.491963,0.868401,0.218313,0.218497,1.297663,
-	0.023594,0.566338,0.823835,0.19071,0.208602,1.305256,
-	0.061786,0.414288,0.908046,0.195133,0.201117,1.308356,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.512375,0.851663,0.110186,0.145913,0.322451,1.012229,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.512375,0.851663,0.110186,0.145913,0.322451,1.012229,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.500468,0.831871,0.239838,0.145913,0.309078,1.106884,
-	0.500468,0.831871,0.239838,0.145913,0.309078,1.106884,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.312254,0.908542,0.277577,0.092482,0.341223,1.106884,
-	0.896572,0.442898,0,0.218313,0.218497,0.807025,
-	0.860952,0.508686,0,0.173108,0.295007,1.238954,
-	0.938151,0.346226,0,0.218313,0.218497,1.297663,
-	0.860952,0.508686,0,0.173108,0.295007,1.238954,
-	0.896572,0.442898,0,0.218313,0.218497,0.807025,
-	0.860952,0.508686,0,0.206427,0.238615,0.828993,
-	0.860952,0.508686,0,0.173108,0.295007,1.238954,
-	0.860952,0.508686,0,0.206427,0.238615,0.828993,
-	0.860952,0.508686,0,0.17165,0.297474,0.89342,
-	0.860952,0.508686,0,0.173108,0.295007,1.238954,
-	0.860952,0.508686,0,0.17165,0.297474,0.89342,
-	0.860952,0.508686,0,0.164839,0.309002,1.220716,
-	0.860952,0.508686,0,0.164839,0.309002,1.220716,
-	0.860952,0.508686,0,0.17165,0.297474,0.89342,
-	0.860952,0.508686,0,0.164839,0.309002,0.906089,
-	0.99992,0.012221,0.00341,0.146283,0.284903,1.087672,
-	0.99993,0.01068,0.005115,0.145913,0.292777,1.143555,
-	0.999936,0.010052,0.005203,0.145913,0.284422,1.159696,
-	0.99993,0.01068,0.005115,0.145913,0.292777,1.143555,
-	0.99992,0.012221,0.00341,0.146283,0.284903,1.087672,
-	0.999961,0.008668,0.001509,0.145913,0.309078,1.106884,
-	0.952716,0.303863,0,0.248003,0.12541,0.751819,
-	0.971429,0.23733,0,0.251928,0.113103,1.344813,
-	0.985558,0.169336,0,0.251928,0.113103,0.744607,
-	0.971429,0.23733,0,0.251928,0.113103,1.344813,
-	0.952716,0.303863,0,0.248003,0.12541,0.751819,
-	0.938151,0.346226,0,0.218313,0.218497,1.297663,
-	0.938151,0.346226,0,0.218313,0.218497,1.297663,
-	0.952716,0.303863,0,0.248003,0.12541,0.751819,
-	0.952716,0.303863,0,0.237898,0.157092,0.77053,
-	0.938151,0.346226,0,0.218313,0.218497,1.297663,
-	0.952716,0.303863,0,0.237898,0.157092,0.77053,
-	0.952716,0.303863,0,0.219541,0.214647,0.804721,
-	0.938151,0.346226,0,0.218313,0.218497,1.297663,
-	0.952716,0.303863,0,0.219541,0.214647,0.804721,
-	0.896572,0.442898,0,0.218313,0.218497,0.807025,
-	0,0.130526,0.991445,0.236628,0,1.36115,
-	-0.012701,0.21502,0.976527,0.252447,0.10798,1.346935,
-	0.004021,0.220216,0.975443,0.226074,0.104106,1.347445,
-	-0.012701,0.21502,0.976527,0.252447,0.10798,1.346935,
-	0,0.130526,0.991445,0.236628,0,1.36115,
-	0,0.130526,0.991445,0.263394,0,1.36115,
-	0.927775,0.05186,0.369519,0.290282,0.101111,0.675403,
-	0.874222,-0.005676,0.485494,0.251928,0.113103,0.744607,
-	0.873922,-0.003805,0.486051,0.255586,0.077023,0.737599,
-	0.874222,-0.005676,0.485494,0.251928,0.113103,0.744607,
-	0.927775,0.05186,0.369519,0.290282,0.101111,0.675403,
-	0.919422,0.073474,0.386347,0.274037,0.157167,0.70531,
-	0.874222,-0.005676,0.485494,0.251928,0.113103,0.744607,
-	0.919422,0.073474,0.386347,0.274037,0.157167,0.70531,
-	0.874447,-0.006469,0.485078,0.248003,0.12541,0.751819,
-	0.026002,0.337305,0.941036,0.251928,0.113103,1.344813,
-	0.061786,0.414288,0.908046,0.195133,0.201117,1.308356,
-	0.025091,0.266414,0.963532,0.224838,0.10798,1.346935,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.308356,
-	-0.860952,-0.508686,0,0.182602,0.222325,1.198099,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.19609,
-	-0.860952,-0.508686,0,0.182602,0.222325,1.198099,
-	-0.912598,-0.408857,0,0.195133,0.201117,1.308356,
-	-0.862228,-0.506519,0.000588,0.19071,0.208602,1.305256,
-	-0.860952,-0.508686,0,0.182602,0.222325,1.198099,
-	-0.862228,-0.506519,0.000588,0.19071,0.208602,1.305256,
-	-0.825039,-0.55911,0.081898,0.177609,0.230776,1.195089,
-	0.023594,0.566338,0.823835,0.19071,0.208602,1.305256,
-	0,0.675426,0.737428,0.154063,0.295007,1.238954,
-	0,0.608761,0.793353,0.146283,0.284903,1.246708,
-	0,0.675426,0.737428,0.154063,0.295007,1.238954,
-	0.023594,0.566338,0.823835,0.19071,0.208602,1.305256,
-	0,0.675426,0.737428,0.173108,0.295007,1.238954,
-	0,0.675426,0.737428,0.173108,0.295007,1.238954,
-	0.023594,0.566338,0.823835,0.19071,0.208602,1.305256,
-	0.062066,0.491963,0.868401,0.218313,0.218497,1.297663,
-	-0.012701,0.21502,0.976527,0.252447,0.10798,1.346935,
-	0.026002,0.337305,0.941036,0.251928,0.113103,1.344813,
-	0.004021,0.220216,0.975443,0.226074,0.104106,1.347445,
-	0.866079,0.482943,0.129122,0.230667,0.24695,0.785155,
-	0.938648,0.308986,0.15319,0.259167,0.19321,0.732687,
-	0.902969,0.403992,0.146418,0.371702,0.214602,0,
-	0.026002,0.337305,0.941036,0.251928,0.113103,1.344813,
-	0.025091,0.266414,0.963532,0.224838,0.10798,1.346935,
-	0.004021,0.220216,0.975443,0.226074,0.104106,1.347445,
-	0.926797,0.118754,0.356292,0.274037,0.157167,0.70531,
-	0.927775,0.05186,0.369519,0.290282,0.101111,0.675403,
-	0.964645,0.195253,0.177021,0.414579,0.111086,0,
-	0.141093,0.950715,0.276106,0.08622,0.34242,1.106884,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.288047,0.952171,0.101981,0.094656,0.35326,1.012229,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	0.288047,0.952171,0.101981,0.094656,0.35326,1.012229,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	0.026002,0.337305,0.941036,0.251928,0.113103,1.344813,
-	0.062066,0.491963,0.868401,0.218313,0.218497,1.297663,
-	0.061786,0.414288,0.908046,0.195133,0.201117,1.308356,
-	0,0.675426,0.737428,0.173108,0.295007,1.238954,
-	0,0.793353,0.608761,0.164839,0.309002,1.220716,
-	0,0.675426,0.737428,0.154063,0.295007,1.238954,
-	0.774879,0.62326,0.105398,0.173158,0.314854,0.891031,
-	0.845942,0.520777,0.114772,0.214135,0.2689,0.815591,
-	0.768035,0.631773,0.104812,0.303493,0.303493,0,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.495531,0.865546,0.072654,0.214602,0.371702,0,
-	0.293356,0.953923,0.063035,0.111086,0.414579,0,
-	0.100502,0.687999,0.718719,0.051933,0.254321,1.270833,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.141093,0.950715,0.276106,0.08622,0.34242,1.106884,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	0.025206,0.28498,0.958202,0.032138,0.094157,1.365488,
-	0.998302,0.002696,0.058183,0.145913,0.330528,0.935778,
-	0.981055,0.006029,0.193634,0.146283,0.284903,0.933671,
-	0.892207,0,0.451626,0.146283,0.330528,0.933671,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	0.100502,0.687999,0.718719,0.051933,0.254321,1.270833,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	0.025206,0.28498,0.958202,0.032138,0.094157,1.365488,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	-0.014849,0.257672,0.966118,0,0.094656,1.365488,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	0.141093,0.950715,0.276106,0.08622,0.34242,1.106884,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.599673,0.101216,0.793819,0.151142,0.047328,1.328953,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.231736,0.145641,0.961815,-0.081974,0.047328,1.365488,
-	-0.260629,0.080414,0.962084,-0.09143,0.024499,1.365488,
-	0.335836,0.144904,0.930708,0.085971,0.047328,1.365488,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.273657,0.202688,0.940228,0.075614,0.066932,1.365488,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.335836,0.144904,0.930708,0.085971,0.047328,1.365488,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.780002,0.279437,0.559921,0.183727,0.129302,1.270833,
-	0.335836,0.144904,0.930708,0.085971,0.047328,1.365488,
-	0.273657,0.202688,0.940228,0.075614,0.066932,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	0.273657,0.202688,0.940228,0.075614,0.066932,1.365488,
-	0.190766,0.247969,0.9498,0.062117,0.081974,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	0.273657,0.202688,0.940228,0.075614,0.066932,1.365488,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	0.190766,0.247969,0.9498,0.062117,0.081974,1.365488,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	0.273657,0.202688,0.940228,0.075614,0.066932,1.365488,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.411599,0.037309,0.910601,0.094702,0,1.365488,
-	0.374938,0.079168,0.923663,0.092482,0.024499,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.474349,0.333906,0.814555,0.118556,0.129302,1.328953,
-	0.676335,0.41763,0.606759,0.155432,0.182861,1.270833,
-	0.56058,0.750837,0.349275,0.145913,0.292777,1.143555,
-	0.539476,0.689911,0.482689,0.138564,0.274291,1.195089,
-	0.703455,0.631189,0.326728,0.145913,0.284422,1.159696,
-	-0.260629,0.080414,0.962084,-0.09143,0.024499,1.365488,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	-0.260629,0.080414,0.962084,-0.09143,0.024499,1.365488,
-	-0.231736,0.145641,0.961815,-0.081974,0.047328,1.365488,
-	0.190766,0.247969,0.9498,0.062117,0.081974,1.365488,
-	0.092059,0.276195,0.956683,0.046399,0.09143,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	0.190766,0.247969,0.9498,0.062117,0.081974,1.365488,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.092059,0.276195,0.956683,0.046399,0.09143,1.365488,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.190766,0.247969,0.9498,0.062117,0.081974,1.365488,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.539476,0.689911,0.482689,0.138564,0.274291,1.195089,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.539476,0.689911,0.482689,0.138564,0.274291,1.195089,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.34381,0.421062,0.839346,0.092482,0.158362,1.328953,
-	0.52718,0.556291,0.642357,0.118556,0.223958,1.270833,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.803542,-0.582394,0.123034,0.146283,0.284903,1.246708,
-	-0.825039,-0.55911,0.081898,0.177609,0.230776,1.195089,
-	-0.862228,-0.506519,0.000588,0.19071,0.208602,1.305256,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.288047,0.952171,0.101981,0.094656,0.35326,1.012229,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.231736,0.145641,0.961815,-0.081974,0.047328,1.365488,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	-0.430421,0.254256,0.866078,-0.158362,0.09143,1.328953,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	-0.231736,0.145641,0.961815,-0.081974,0.047328,1.365488,
-	-0.187251,0.201824,0.961355,-0.066932,0.066932,1.365488,
-	0.025206,0.28498,0.958202,0.032138,0.094157,1.365488,
-	-0.014849,0.257672,0.966118,0,0.094656,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.014849,0.257672,0.966118,0,0.094656,1.365488,
-	-0.062541,0.273564,0.959818,-0.024499,0.09143,1.365488,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.627494,0.326475,0.70687,-0.223958,0.129302,1.270833,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.062541,0.273564,0.959818,-0.024499,0.09143,1.365488,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	-0.062541,0.273564,0.959818,-0.024499,0.09143,1.365488,
-	-0.014849,0.257672,0.966118,0,0.094656,1.365488,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	-0.021105,0.462042,0.886607,0,0.182861,1.328953,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.004579,0.695959,0.718067,0,0.258604,1.270833,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	-0.004744,0.86721,0.49792,0,0.316724,1.195089,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	0.01826,0.970957,0.238555,0,0.35326,1.106884,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.751368,0.430509,0.500107,-0.274291,0.158362,1.195089,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	0.374938,0.079168,0.923663,0.092482,0.024499,1.365488,
-	0.335836,0.144904,0.930708,0.085971,0.047328,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	-0.248573,0.933374,0.258889,-0.09143,0.341223,1.106884,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.062541,0.273564,0.959818,-0.024499,0.09143,1.365488,
-	-0.129745,0.245423,0.960694,-0.047328,0.081974,1.365488,
-	-0.129745,0.245423,0.960694,-0.047328,0.081974,1.365488,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	-0.129745,0.245423,0.960694,-0.047328,0.081974,1.365488,
-	-0.062541,0.273564,0.959818,-0.024499,0.09143,1.365488,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.124567,0.48414,0.866078,-0.047328,0.17663,1.328953,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.129745,0.245423,0.960694,-0.047328,0.081974,1.365488,
-	-0.187251,0.201824,0.961355,-0.066932,0.066932,1.365488,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	-0.221372,0.83719,0.500107,-0.081974,0.305932,1.195089,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.179072,0.683956,0.707204,-0.066932,0.249792,1.270833,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.838063,0.110333,0.5343,-0.316724,0,1.195089,
-	-0.70396,0.092678,0.704167,-0.258604,0,1.270833,
-	-0.838063,0.110333,0.5343,-0.316724,0,1.195089,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.187251,0.201824,0.961355,-0.066932,0.066932,1.365488,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.187251,0.201824,0.961355,-0.066932,0.066932,1.365488,
-	-0.129745,0.245423,0.960694,-0.047328,0.081974,1.365488,
-	0.374938,0.079168,0.923663,0.092482,0.024499,1.365488,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.335836,0.144904,0.930708,0.085971,0.047328,1.365488,
-	0.587064,0.226454,0.777222,0.138564,0.09143,1.328953,
-	0.374938,0.079168,0.923663,0.092482,0.024499,1.365488,
-	0.599673,0.101216,0.793819,0.151142,0.047328,1.328953,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.349948,0.356994,0.866078,-0.129302,0.129302,1.328953,
-	-0.245627,0.435403,0.866078,-0.09143,0.158362,1.328953,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	-0.517383,0.501035,0.693742,-0.182861,0.182861,1.270833,
-	-0.349991,0.614303,0.707204,-0.129302,0.223958,1.270833,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	-0.627248,0.627248,0.46165,-0.223958,0.223958,1.195089,
-	-0.430509,0.751368,0.500107,-0.158362,0.274291,1.195089,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.187251,0.201824,0.961355,-0.066932,0.066932,1.365488,
-	-0.231736,0.145641,0.961815,-0.081974,0.047328,1.365488,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.69037,0.69037,0.216285,-0.249792,0.249792,1.106884,
-	-0.481678,0.837235,0.258889,-0.17663,0.305932,1.106884,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	0.67336,0.061035,0.736791,0.155432,0,1.328953,
-	0.84071,0.076204,0.536096,0.207581,0,1.270833,
-	0.67336,0.061035,0.736791,0.155432,0,1.328953,
-	0.777747,0.144332,0.611782,0.201514,0.066932,1.270833,
-	0.599673,0.101216,0.793819,0.151142,0.047328,1.328953,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.837235,0.481678,0.258889,-0.305932,0.17663,1.106884,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	-0.260629,0.080414,0.962084,-0.09143,0.024499,1.365488,
-	-0.290881,0.038295,0.955993,-0.094656,0,1.365488,
-	-0.290881,0.038295,0.955993,-0.094656,0,1.365488,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.536052,0.070573,0.84123,-0.182861,0,1.328953,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.290881,0.038295,0.955993,-0.094656,0,1.365488,
-	-0.260629,0.080414,0.962084,-0.09143,0.024499,1.365488,
-	-0.536052,0.070573,0.84123,-0.182861,0,1.328953,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.70396,0.092678,0.704167,-0.258604,0,1.270833,
-	-0.690611,0.152943,0.70687,-0.249792,0.066932,1.270833,
-	-0.536052,0.070573,0.84123,-0.182861,0,1.328953,
-	-0.481561,0.134192,0.866078,-0.17663,0.047328,1.328953,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.946203,0.12457,0.298635,-0.35326,0,1.106884,
-	-0.838063,0.110333,0.5343,-0.316724,0,1.195089,
-	-0.946203,0.12457,0.298635,-0.35326,0,1.106884,
-	-0.83719,0.221372,0.500107,-0.305932,0.081974,1.195089,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.985881,0.129794,0.105798,-0.365721,0,1.012229,
-	-0.946203,0.12457,0.298635,-0.35326,0,1.106884,
-	-0.985881,0.129794,0.105798,-0.365721,0,1.012229,
-	-0.933374,0.248573,0.258889,-0.341223,0.09143,1.106884,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	0.411599,0.037309,0.910601,0.094702,0,1.365488,
-	0.599673,0.101216,0.793819,0.151142,0.047328,1.328953,
-	0.374938,0.079168,0.923663,0.092482,0.024499,1.365488,
-	0.599673,0.101216,0.793819,0.151142,0.047328,1.328953,
-	0.411599,0.037309,0.910601,0.094702,0,1.365488,
-	0.67336,0.061035,0.736791,0.155432,0,1.328953,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.100502,0.687999,0.718719,0.051933,0.254321,1.270833,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	0.100502,0.687999,0.718719,0.051933,0.254321,1.270833,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.312254,0.908542,0.277577,0.092482,0.341223,1.106884,
-	0.141093,0.950715,0.276106,0.08622,0.34242,1.106884,
-	0.312254,0.908542,0.277577,0.092482,0.341223,1.106884,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.293356,0.953923,0.063035,0.111086,0.414579,0,
-	0.288047,0.952171,0.101981,0.094656,0.35326,1.012229,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.371923,0.814436,0.445385,0.085971,0.305932,1.195089,
-	0.278638,0.67847,0.679735,0.075614,0.249792,1.270833,
-	0.129618,0.851245,0.508509,0.067773,0.309412,1.195089,
-	0.100502,0.687999,0.718719,0.051933,0.254321,1.270833,
-	0.838263,-0.003347,0.545256,0.161481,0.30464,0.912126,
-	0.892207,0,0.451626,0.146283,0.330528,0.933671,
-	0.923345,0,0.383971,0.146283,0.284903,0.933671,
-	0.892207,0,0.451626,0.146283,0.330528,0.933671,
-	0.838263,-0.003347,0.545256,0.161481,0.30464,0.912126,
-	0.85821,-0.006695,0.513255,0.162433,0.32323,0.910776,
-	0.092059,0.276195,0.956683,0.046399,0.09143,1.365488,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	0.025206,0.28498,0.958202,0.032138,0.094157,1.365488,
-	0.060772,0.500882,0.863379,0.039779,0.180901,1.328953,
-	0.092059,0.276195,0.956683,0.046399,0.09143,1.365488,
-	0.178567,0.479998,0.858904,0.062117,0.17663,1.328953,
-	0.092059,0.276195,0.956683,0.046399,0.09143,1.365488,
-	0.025206,0.28498,0.958202,0.032138,0.094157,1.365488,
-	0.024964,0.082992,0.996238,0.029532,0,1.37795,
-	0.312254,0.908542,0.277577,0.092482,0.341223,1.106884,
-	0.361607,0.924025,0.124172,0.093273,0.345512,1.073157,
-	0.141093,0.950715,0.276106,0.08622,0.34242,1.106884,
-	0.875651,-0.009145,0.482859,0.230667,0.24695,0.785155,
-	0.875834,-0.009413,0.48252,0.218313,0.218497,0.807025,
-	0.875344,-0.008697,0.483422,0.219541,0.214647,0.804721,
-	0.875834,-0.009413,0.48252,0.218313,0.218497,0.807025,
-	0.875651,-0.009145,0.482859,0.230667,0.24695,0.785155,
-	0.87595,-0.009537,0.482307,0.206427,0.238615,0.828993,
-	0.87595,-0.009537,0.482307,0.206427,0.238615,0.828993,
-	0.875651,-0.009145,0.482859,0.230667,0.24695,0.785155,
-	0.876066,-0.009661,0.482094,0.214135,0.2689,0.815591,
-	-0.798008,0.602646,0.000065,0.146283,0.284903,1.246708,
-	-0.800822,0.598902,0.000098,0.145913,0.284422,1.159696,
-	-0.809157,0.587593,0.000196,0.138564,0.274291,1.195089,
-	0.964645,0.195253,0.177021,0.414579,0.111086,0,
-	0.927775,0.05186,0.369519,0.290282,0.101111,0.675403,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.610633,0.787554,0.082987,0.162433,0.32323,0.910776,
-	0.774879,0.62326,0.105398,0.173158,0.314854,0.891031,
-	0.768035,0.631773,0.104812,0.303493,0.303493,0,
-	-0.798008,0.602646,0.000065,0.146283,0.284903,1.246708,
-	-0.792329,0.610094,0,0.146283,0.284903,1.087672,
-	-0.800822,0.598902,0.000098,0.145913,0.284422,1.159696,
-	-0.792329,0.610094,0,0.146283,0.284903,1.087672,
-	-0.798008,0.602646,0.000065,0.146283,0.284903,1.246708,
-	-0.792329,0.610094,0,0.154063,0.295007,1.238954,
-	-0.792329,0.610094,0,0.146283,0.284903,1.087672,
-	-0.792329,0.610094,0,0.154063,0.295007,1.238954,
-	-0.792329,0.610094,0,0.146283,0.284903,0.933671,
-	-0.792329,0.610094,0,0.146283,0.284903,0.933671,
-	-0.792329,0.610094,0,0.154063,0.295007,1.238954,
-	-0.792329,0.610094,0,0.161481,0.30464,0.912126,
-	-0.792329,0.610094,0,0.161481,0.30464,0.912126,
-	-0.792329,0.610094,0,0.154063,0.295007,1.238954,
-	-0.792329,0.610094,0,0.164839,0.309002,1.220716,
-	-0.792329,0.610094,0,0.161481,0.30464,0.912126,
-	-0.792329,0.610094,0,0.164839,0.309002,1.220716,
-	-0.792329,0.610094,0,0.164839,0.309002,0.906089,
-	0.902969,0.403992,0.146418,0.371702,0.214602,0,
-	0.924479,0.12193,0.361208,0.259167,0.19321,0.732687,
-	0.926797,0.118754,0.356292,0.274037,0.157167,0.70531,
-	-0.803542,-0.582394,0.123034,0.146283,0.284903,1.246708,
-	-0.72232,-0.648117,0.241242,0.138564,0.274291,1.195089,
-	-0.825039,-0.55911,0.081898,0.177609,0.230776,1.195089,
-	0.902969,0.403992,0.146418,0.371702,0.214602,0,
-	0.945888,0.279771,0.16439,0.274037,0.157167,0.70531,
-	0.964645,0.195253,0.177021,0.414579,0.111086,0,
-	0.768035,0.631773,0.104812,0.303493,0.303493,0,
-	0.845942,0.520777,0.114772,0.214135,0.2689,0.815591,
-	0.866079,0.482943,0.129122,0.230667,0.24695,0.785155,
-	0.610633,0.787554,0.082987,0.162433,0.32323,0.910776,
-	0.768035,0.631773,0.104812,0.303493,0.303493,0,
-	0.495531,0.865546,0.072654,0.214602,0.371702,0,
-	0.768035,0.631773,0.104812,0.303493,0.303493,0,
-	0.866079,0.482943,0.129122,0.230667,0.24695,0.785155,
-	0.902969,0.403992,0.146418,0.371702,0.214602,0,
-	0.964645,0.195253,0.177021,0.414579,0.111086,0,
-	0.931218,0.038006,0.362475,0.29625,0.056256,0.664416,
-	0.977781,0.093209,0.187769,0.429204,0,0,
-	0.998302,0.002696,0.058183,0.145913,0.330528,0.935778,
-	0.999961,0.008668,0.001509,0.145913,0.309078,1.106884,
-	0.998275,0.007814,0.058184,0.146283,0.284903,0.933671,
-	0.999961,0.008668,0.001509,0.145913,0.309078,1.106884,
-	0.998302,0.002696,0.058183,0.145913,0.330528,0.935778,
-	1,0,0,0.145913,0.322451,1.012229,
-	0.999961,0.008668,0.001509,0.145913,0.309078,1.106884,
-	0.99992,0.012221,0.00341,0.146283,0.284903,1.087672,
-	0.998275,0.007814,0.058184,0.146283,0.284903,0.933671,
-	0.499452,0.862679,0.079575,0.146283,0.330528,0.933671,
-	0.610633,0.787554,0.082987,0.162433,0.32323,0.910776,
-	0.495531,0.865546,0.072654,0.214602,0.371702,0,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.499452,0.862679,0.079575,0.146283,0.330528,0.933671,
-	0.495531,0.865546,0.072654,0.214602,0.371702,0,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.513415,0.853391,0.090157,0.145913,0.330528,0.935778,
-	0.499452,0.862679,0.079575,0.146283,0.330528,0.933671,
-	0.513415,0.853391,0.090157,0.145913,0.330528,0.935778,
-	0.491078,0.866607,0.088512,0.106015,0.346454,1.012229,
-	0.512375,0.851663,0.110186,0.145913,0.322451,1.012229,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.842678,0.535089,0.059785,-0.351049,0.202678,0.351049,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.842678,0.535089,0.059785,-0.351049,0.202678,0.351049,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.794265,0.604621,0.059807,-0.341369,0.216238,0.341369,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.796561,0.601545,0.060284,-0.319565,0.247297,0.319565,
-	-0.794265,0.604621,0.059807,-0.341369,0.216238,0.341369,
-	-0.796561,0.601545,0.060284,-0.319565,0.247297,0.319565,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.676046,0.734345,0.060814,-0.289756,0.289756,0.289756,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.952168,0.299814,0.059064,-0.388916,0.10421,0.388916,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.952168,0.299814,0.059064,-0.388916,0.10421,0.388916,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.923255,0.379637,0.058951,-0.382487,0.120717,0.382487,
-	-0.842678,0.535089,0.059785,-0.351049,0.202678,0.351049,
-	-0.923255,0.379637,0.058951,-0.382487,0.120717,0.382487,
-	-0.872168,0.480862,0.089971,-0.316724,0.182861,1.012229,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.989755,0.130304,0.058357,-0.401718,0,0.401718,
-	-0.985881,0.129794,0.105798,-0.365721,0,1.012229,
-	-0.989755,0.130304,0.058357,-0.401718,0,0.401718,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.989867,0.129393,0.058479,-0.399435,0.01836,0.399435,
-	-0.952168,0.299814,0.059064,-0.388916,0.10421,0.388916,
-	-0.989867,0.129393,0.058479,-0.399435,0.01836,0.399435,
-	-0.966816,0.23921,0.089691,-0.35326,0.094656,1.012229,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.463375,0.883993,0.061975,-0.207855,0.360015,0.207855,
-	-0.611294,0.789058,0.060884,-0.277897,0.29976,0.277897,
-	-0.676046,0.734345,0.060814,-0.289756,0.289756,0.289756,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.611294,0.789058,0.060884,-0.277897,0.29976,0.277897,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.676046,0.734345,0.060814,-0.289756,0.289756,0.289756,
-	-0.744941,0.662269,0.080386,-0.258604,0.258604,1.012229,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.217377,0.974082,0.062537,-0.109312,0.407957,0.109312,
-	-0.38421,0.921178,0.061758,-0.194861,0.366264,0.194861,
-	-0.463375,0.883993,0.061975,-0.207855,0.360015,0.207855,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.38421,0.921178,0.061758,-0.194861,0.366264,0.194861,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	-0.463375,0.883993,0.061975,-0.207855,0.360015,0.207855,
-	-0.54686,0.832268,0.090962,-0.182861,0.316724,1.012229,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	0.293356,0.953923,0.063035,0.111086,0.414579,0,
-	0,0.998039,0.062593,0,0.429204,0,
-	0.293356,0.953923,0.063035,0.111086,0.414579,0,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	0.288047,0.952171,0.101981,0.094656,0.35326,1.012229,
-	-0.217377,0.974082,0.062537,-0.109312,0.407957,0.109312,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	0,0.998039,0.062593,0,0.429204,0,
-	-0.018655,0.995608,0.091745,0,0.365721,1.012229,
-	-0.217377,0.974082,0.062537,-0.109312,0.407957,0.109312,
-	-0.31221,0.945601,0.091454,-0.094656,0.35326,1.012229,
-	0,0,-1,0,0.429204,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0,0.214602,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0,0.429204,0,
-	0,0,-1,0.111086,0.414579,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.111086,0.414579,0,
-	0,0,-1,0.214602,0.371702,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.214602,0.371702,0,
-	0,0,-1,0.303493,0.303493,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.303493,0.303493,0,
-	0,0,-1,0.371702,0.214602,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.371702,0.214602,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.371702,0.214602,0,
-	0,0,-1,0.429204,0,0,
-	0,0,-1,0.429204,0,0,
-	0,0,-1,0.371702,0.214602,0,
-	0,0,-1,0.414579,0.111086,0,
-	-0.707107,0,-0.707107,-0.399435,0.01836,0.399435,
-	-0.707107,0,-0.707107,-0.25193,0,0.25193,
-	-0.707107,0,-0.707107,-0.401718,0,0.401718,
-	-0.707107,0,-0.707107,-0.25193,0,0.25193,
-	-0.707107,0,-0.707107,-0.399435,0.01836,0.399435,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.399435,0.01836,0.399435,
-	-0.707107,0,-0.707107,-0.388916,0.10421,0.388916,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.388916,0.10421,0.388916,
-	-0.707107,0,-0.707107,-0.382487,0.120717,0.382487,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.382487,0.120717,0.382487,
-	-0.707107,0,-0.707107,-0.351049,0.202678,0.351049,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.351049,0.202678,0.351049,
-	-0.707107,0,-0.707107,-0.341369,0.216238,0.341369,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.341369,0.216238,0.341369,
-	-0.707107,0,-0.707107,0,0.214602,0,
-	-0.707107,0,-0.707107,0,0.214602,0,
-	-0.707107,0,-0.707107,-0.341369,0.216238,0.341369,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.341369,0.216238,0.341369,
-	-0.707107,0,-0.707107,-0.319565,0.247297,0.319565,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.319565,0.247297,0.319565,
-	-0.707107,0,-0.707107,-0.289756,0.289756,0.289756,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.289756,0.289756,0.289756,
-	-0.707107,0,-0.707107,-0.277897,0.29976,0.277897,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.277897,0.29976,0.277897,
-	-0.707107,0,-0.707107,-0.207855,0.360015,0.207855,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.207855,0.360015,0.207855,
-	-0.707107,0,-0.707107,-0.194861,0.366264,0.194861,
-	-0.707107,0,-0.707107,0,0.429204,0,
-	-0.707107,0,-0.707107,-0.194861,0.366264,0.194861,
-	-0.707107,0,-0.707107,-0.109312,0.407957,0.109312
-};
-static const struct gllist handsy_model_thumb_distal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 804, handsy_model_thumb_distal_data, 0
-};
-const struct gllist *handsy_model_thumb_distal = &handsy_model_thumb_distal_frame;
-
-static const float handsy_model_thumb_metacarpal_data[] = {
-	-0.965926,0,-0.258819,-0.344143,0,1.403844,
-	-0.866025,0,-0.5,-0.30855,0.214602,1.317916,
-	-0.866025,0,-0.5,-0.30855,0,1.317916,
-	-0.866025,0,-0.5,-0.30855,0.214602,1.317916,
-	-0.965926,0,-0.258819,-0.344143,0,1.403844,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.403844,
-	0.258819,0,0.965926,0.092213,0,1.8402,
-	0,0,1,0,0.214602,1.85234,
-	0,0,1,0,0,1.85234,
-	0,0,1,0,0.214602,1.85234,
-	0.258819,0,0.965926,0.092213,0,1.8402,
-	0.258819,0,0.965926,0.092213,0.214602,1.8402,
-	-0.675426,0,0.737428,-0.25193,0,1.747987,
-	-0.5,0,0.866025,-0.178141,0.214602,1.804607,
-	-0.737428,0,0.675426,-0.25193,0.214602,1.747987,
-	-0.5,0,0.866025,-0.178141,0.214602,1.804607,
-	-0.675426,0,0.737428,-0.25193,0,1.747987,
-	-0.5,0,0.866025,-0.178141,0,1.804607,
-	0.707107,0,0.707107,0.25193,0,1.747987,
-	0.5,0,0.866025,0.178141,0.214602,1.804607,
-	0.5,0,0.866025,0.178141,0,1.804607,
-	0.5,0,0.866025,0.178141,0.214602,1.804607,
-	0.707107,0,0.707107,0.25193,0,1.747987,
-	0.707107,0,0.707107,0.25193,0.214602,1.747987,
-	-0.866025,0,0.5,-0.30855,0,1.674199,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.58827,
-	-0.965926,0,0.258819,-0.344143,0,1.58827,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.58827,
-	-0.866025,0,0.5,-0.30855,0,1.674199,
-	-0.866025,0,0.5,-0.30855,0.214602,1.674199,
-	-0.258819,0,0.965926,-0.092213,0,1.8402,
-	-0.5,0,0.866025,-0.178141,0.214602,1.804607,
-	-0.5,0,0.866025,-0.178141,0,1.804607,
-	-0.5,0,0.866025,-0.178141,0.214602,1.804607,
-	-0.258819,0,0.965926,-0.092213,0,1.8402,
-	-0.258819,0,0.965926,-0.092213,0.214602,1.8402,
-	0.866025,0,0.5,0.30855,0.214602,1.674199,
-	0.707107,0,0.707107,0.25193,0,1.747987,
-	0.866025,0,0.5,0.30855,0,1.674199,
-	0.707107,0,0.707107,0.25193,0,1.747987,
-	0.866025,0,0.5,0.30855,0.214602,1.674199,
-	0.707107,0,0.707107,0.25193,0.214602,1.747987,
-	0.991445,0,0.130526,0.356283,0.214602,1.496057,
-	0.965926,0,0.258819,0.344143,0,1.58827,
-	0.991445,0,0.130526,0.356283,0,1.496057,
-	0.965926,0,0.258819,0.344143,0,1.58827,
-	0.991445,0,0.130526,0.356283,0.214602,1.496057,
-	0.965926,0,0.258819,0.344143,0.214602,1.58827,
-	-0.999038,0,-0.043842,-0.356283,0.214602,1.496057,
-	-0.965926,0,-0.258819,-0.344143,0,1.403844,
-	-0.999038,0,0.043842,-0.356283,0,1.496057,
-	-0.965926,0,-0.258819,-0.344143,0,1.403844,
-	-0.999038,0,-0.043842,-0.356283,0.214602,1.496057,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.403844,
-	-0.866025,0,-0.5,-0.30855,0.214602,1.317916,
-	-0.793353,0,-0.608761,-0.25193,0,1.244127,
-	-0.866025,0,-0.5,-0.30855,0,1.317916,
-	-0.793353,0,-0.608761,-0.25193,0,1.244127,
-	-0.866025,0,-0.5,-0.30855,0.214602,1.317916,
-	-0.793353,0,-0.608761,-0.25193,0.214602,1.244127,
-	0.965926,0,0.258819,0.344143,0,1.58827,
-	0.866025,0,0.5,0.30855,0.214602,1.674199,
-	0.866025,0,0.5,0.30855,0,1.674199,
-	0.866025,0,0.5,0.30855,0.214602,1.674199,
-	0.965926,0,0.258819,0.344143,0,1.58827,
-	0.965926,0,0.258819,0.344143,0.214602,1.58827,
-	0.258819,0,0.965926,0.092213,0,1.8402,
-	0.5,0,0.866025,0.178141,0.214602,1.804607,
-	0.258819,0,0.965926,0.092213,0.214602,1.8402,
-	0.5,0,0.866025,0.178141,0.214602,1.804607,
-	0.258819,0,0.965926,0.092213,0,1.8402,
-	0.5,0,0.866025,0.178141,0,1.804607,
-	-0.737428,0,0.675426,-0.25193,0.214602,1.747987,
-	-0.866025,0,0.5,-0.30855,0,1.674199,
-	-0.675426,0,0.737428,-0.25193,0,1.747987,
-	-0.866025,0,0.5,-0.30855,0,1.674199,
-	-0.737428,0,0.675426,-0.25193,0.214602,1.747987,
-	-0.866025,0,0.5,-0.30855,0.214602,1.674199,
-	-0.258819,0,0.965926,-0.092213,0,1.8402,
-	0,0,1,0,0.214602,1.85234,
-	-0.258819,0,0.965926,-0.092213,0.214602,1.8402,
-	0,0,1,0,0.214602,1.85234,
-	-0.258819,0,0.965926,-0.092213,0,1.8402,
-	0,0,1,0,0,1.85234,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.58827,
-	-0.999038,0,0.043842,-0.356283,0,1.496057,
-	-0.965926,0,0.258819,-0.344143,0,1.58827,
-	-0.999038,0,0.043842,-0.356283,0,1.496057,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.58827,
-	-0.999038,0,-0.043842,-0.356283,0.214602,1.496057,
-	0,1,0,-0.30855,0.214602,1.317916,
-	0,1,0,0,0.214602,1.496057,
-	0,1,0,-0.25193,0.214602,1.244127,
-	0,1,0,0,0.214602,1.496057,
-	0,1,0,-0.30855,0.214602,1.317916,
-	0,1,0,-0.344143,0.214602,1.403844,
-	0,1,0,0,0.214602,1.496057,
-	0,1,0,-0.344143,0.214602,1.403844,
-	0,1,0,-0.356283,0.214602,1.496057,
-	0,0.081483,0.996675,0,0.214602,1.496057,
-	0,0.162423,0.986721,-0.356283,0.214602,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,1,0,0.356283,0.214602,1.496057,
-	0,1,0,-0.356283,0.214602,1.496057,
-	0,1,0,0.344143,0.214602,1.58827,
-	0,1,0,0.344143,0.214602,1.58827,
-	0,1,0,-0.356283,0.214602,1.496057,
-	0,1,0,-0.344143,0.214602,1.58827,
-	0,1,0,0.344143,0.214602,1.58827,
-	0,1,0,-0.344143,0.214602,1.58827,
-	0,1,0,-0.30855,0.214602,1.674199,
-	0,1,0,0.344143,0.214602,1.58827,
-	0,1,0,-0.30855,0.214602,1.674199,
-	0,1,0,0.30855,0.214602,1.674199,
-	0,1,0,0.30855,0.214602,1.674199,
-	0,1,0,-0.30855,0.214602,1.674199,
-	0,1,0,-0.25193,0.214602,1.747987,
-	0,1,0,0.30855,0.214602,1.674199,
-	0,1,0,-0.25193,0.214602,1.747987,
-	0,1,0,0.25193,0.214602,1.747987,
-	0,1,0,0.25193,0.214602,1.747987,
-	0,1,0,-0.25193,0.214602,1.747987,
-	0,1,0,-0.178141,0.214602,1.804607,
-	0,1,0,0.25193,0.214602,1.747987,
-	0,1,0,-0.178141,0.214602,1.804607,
-	0,1,0,0.178141,0.214602,1.804607,
-	0,1,0,0.178141,0.214602,1.804607,
-	0,1,0,-0.178141,0.214602,1.804607,
-	0,1,0,-0.092213,0.214602,1.8402,
-	0,1,0,0.178141,0.214602,1.804607,
-	0,1,0,-0.092213,0.214602,1.8402,
-	0,1,0,0.092213,0.214602,1.8402,
-	0,1,0,0.092213,0.214602,1.8402,
-	0,1,0,-0.092213,0.214602,1.8402,
-	0,1,0,0,0.214602,1.85234,
-	-0.707107,0,0.707107,-0.25193,0,1.244127,
-	-0.707107,0,0.707107,-0.391599,0.104929,1.104458,
-	-0.707107,0,0.707107,-0.40435,0,1.091707,
-	-0.707107,0,0.707107,-0.391599,0.104929,1.104458,
-	-0.707107,0,0.707107,-0.25193,0,1.244127,
-	-0.707107,0,0.707107,-0.353826,0.204282,1.142231,
-	-0.707107,0,0.707107,-0.353826,0.204282,1.142231,
-	-0.707107,0,0.707107,-0.25193,0,1.244127,
-	-0.707107,0,0.707107,-0.292513,0.292513,1.203544,
-	-0.707107,0,0.707107,-0.292513,0.292513,1.203544,
-	-0.707107,0,0.707107,-0.25193,0,1.244127,
-	-0.707107,0,0.707107,-0.25193,0.214602,1.244127,
-	-0.707107,0,0.707107,-0.25193,0.214602,1.244127,
-	-0.707107,0,0.707107,-0.210267,0.364193,1.28579,
-	-0.707107,0,0.707107,-0.292513,0.292513,1.203544,
-	-0.707107,0,0.707107,-0.210267,0.364193,1.28579,
-	-0.707107,0,0.707107,-0.25193,0.214602,1.244127,
-	-0.707107,0,0.707107,0,0.214602,1.496057,
-	-0.707107,0,0.707107,-0.210267,0.364193,1.28579,
-	-0.707107,0,0.707107,0,0.214602,1.496057,
-	-0.707107,0,0.707107,-0.110985,0.414201,1.385072,
-	-0.707107,0,0.707107,-0.110985,0.414201,1.385072,
-	-0.707107,0,0.707107,0,0.214602,1.496057,
-	-0.707107,0,0.707107,0,0.438068,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0,0.438068,1.496057,
-	0,0.081483,0.996675,0,0.214602,1.496057,
-	0,0,1,0,0.438068,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0.11338,0.423141,1.496057,
-	0,0,1,0.11338,0.423141,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0.219034,0.379378,1.496057,
-	0,0,1,0.219034,0.379378,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0.309761,0.309761,1.496057,
-	0,0,1,0.309761,0.309761,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0.379378,0.219034,1.496057,
-	0,0,1,0.379378,0.219034,1.496057,
-	0,0.023241,0.99973,0.356283,0.214602,1.496057,
-	0,0,1,0.356283,0,1.496057,
-	0,0,1,0.379378,0.219034,1.496057,
-	0,0,1,0.356283,0,1.496057,
-	0,0,1,0.438068,0,1.496057,
-	0,0,1,0.379378,0.219034,1.496057,
-	0,0,1,0.438068,0,1.496057,
-	0,0,1,0.423141,0.11338,1.496057,
-	0.041601,0.996196,-0.076566,0,0.438068,1.496057,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	0.041601,0.996196,-0.076566,0,0.438068,1.496057,
-	0.258058,0.963085,-0.076633,0.11338,0.423141,1.496057,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	0.49853,0.863479,-0.076633,0.219034,0.379378,1.496057,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.49853,0.863479,-0.076633,0.219034,0.379378,1.496057,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	0.258058,0.963085,-0.076633,0.11338,0.423141,1.496057,
-	0.49853,0.863479,-0.076633,0.219034,0.379378,1.496057,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.49853,0.863479,-0.076633,0.219034,0.379378,1.496057,
-	0.705027,0.705027,-0.076633,0.309761,0.309761,1.496057,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.840797,0.53591,-0.07656,0.379378,0.219034,1.496057,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.840797,0.53591,-0.07656,0.379378,0.219034,1.496057,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.705027,0.705027,-0.076633,0.309761,0.309761,1.496057,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.988579,0.130149,-0.075981,0.438068,0,1.496057,
-	0.99144,0.130526,0.00323,0.384098,0,0.793862,
-	0.988579,0.130149,-0.075981,0.438068,0,1.496057,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.950851,0.300035,-0.07656,0.423141,0.11338,1.496057,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.950851,0.300035,-0.07656,0.423141,0.11338,1.496057,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.950851,0.300035,-0.07656,0.423141,0.11338,1.496057,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.840797,0.53591,-0.07656,0.379378,0.219034,1.496057,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.9659,0.258812,0.007352,-0.37101,0.099412,0.793862,
-	-0.964063,0.256638,-0.068694,-0.391599,0.104929,1.104458,
-	-0.843132,0.53305,-0.070611,-0.353826,0.204282,1.142231,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.964063,0.256638,-0.068694,-0.391599,0.104929,1.104458,
-	-0.676924,0.732471,-0.072528,-0.292513,0.292513,1.203544,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.464387,0.882512,-0.074281,-0.210267,0.364193,1.28579,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	-0.676924,0.732471,-0.072528,-0.292513,0.292513,1.203544,
-	-0.219928,0.972573,-0.075722,-0.110985,0.414201,1.385072,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	0.041601,0.996196,-0.076566,0,0.438068,1.496057,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	-0.219928,0.972573,-0.075722,-0.110985,0.414201,1.385072,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.843132,0.53305,-0.070611,-0.353826,0.204282,1.142231,
-	-0.676924,0.732471,-0.072528,-0.292513,0.292513,1.203544,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.843132,0.53305,-0.070611,-0.353826,0.204282,1.142231,
-	-0.964063,0.256638,-0.068694,-0.391599,0.104929,1.104458,
-	-0.991477,0.130067,0.007441,-0.384098,0,0.793862,
-	-0.989436,0.128411,-0.067277,-0.40435,0,1.091707,
-	-0.964063,0.256638,-0.068694,-0.391599,0.104929,1.104458,
-	-0.9659,0.258812,0.007352,-0.37101,0.099412,0.793862,
-	-0.991477,0.130067,0.007441,-0.384098,0,0.793862,
-	-0.464387,0.882512,-0.074281,-0.210267,0.364193,1.28579,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	-0.219928,0.972573,-0.075722,-0.110985,0.414201,1.385072,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.464387,0.882512,-0.074281,-0.210267,0.364193,1.28579,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.840359,0.535631,0.083047,-0.389987,0.225159,0,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.840359,0.535631,0.083047,-0.389987,0.225159,0,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.673093,0.73488,0.083047,-0.318423,0.318423,0,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	0.257923,0.962583,0.083127,0.116551,0.434974,0,
-	-0.043691,0.995587,0.083047,0,0.450318,0,
-	0.257923,0.962583,0.083127,0.116551,0.434974,0,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.673093,0.73488,0.083047,0.318423,0.318423,0,
-	0.498269,0.863028,0.083127,0.225159,0.389987,0,
-	0.673093,0.73488,0.083047,0.318423,0.318423,0,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.962583,0.257923,0.083127,-0.434974,0.116551,0,
-	-0.9659,0.258812,0.007352,-0.37101,0.099412,0.793862,
-	-0.962583,0.257923,0.083127,-0.434974,0.116551,0,
-	-0.887453,0.460848,0.006822,-0.332638,0.192049,0.793862,
-	-0.840359,0.535631,0.083047,-0.389987,0.225159,0,
-	0.988072,0.130082,0.08242,0.450318,0,0,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.99144,0.130526,0.00323,0.384098,0,0.793862,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.988072,0.130082,0.08242,0.450318,0,0,
-	0.950356,0.299879,0.083047,0.434974,0.116551,0,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.043691,0.995587,0.083047,0,0.450318,0,
-	-0.257923,0.962583,0.083127,-0.116551,0.434974,0,
-	-0.043691,0.995587,0.083047,0,0.450318,0,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.001082,0.999993,0.003472,0,0.384098,0.793862,
-	-0.459957,0.884049,0.083047,-0.225159,0.389987,0,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.257923,0.962583,0.083127,-0.116551,0.434974,0,
-	-0.277867,0.960495,0.015458,-0.099412,0.37101,0.793862,
-	-0.459957,0.884049,0.083047,-0.225159,0.389987,0,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	0.257923,0.962583,0.083127,0.116551,0.434974,0,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.498269,0.863028,0.083127,0.225159,0.389987,0,
-	0.499776,0.865637,0.029959,0.192049,0.332638,0.793862,
-	0.257923,0.962583,0.083127,0.116551,0.434974,0,
-	0.258748,0.96566,-0.023446,0.099412,0.37101,0.793862,
-	0.950356,0.299879,0.083047,0.434974,0.116551,0,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.976339,0.216221,0.003255,0.37101,0.099412,0.793862,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.950356,0.299879,0.083047,0.434974,0.116551,0,
-	0.840359,0.535631,0.083047,0.389987,0.225159,0,
-	-0.673093,0.73488,0.083047,-0.318423,0.318423,0,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	-0.459957,0.884049,0.083047,-0.225159,0.389987,0,
-	-0.538474,0.842627,0.004963,-0.192049,0.332638,0.793862,
-	-0.673093,0.73488,0.083047,-0.318423,0.318423,0,
-	-0.738136,0.674626,0.005907,-0.271598,0.271598,0.793862,
-	-0.991477,0.130067,0.007441,-0.384098,0,0.793862,
-	-0.962583,0.257923,0.083127,-0.434974,0.116551,0,
-	-0.988072,0.130082,0.08242,-0.450318,0,0,
-	-0.962583,0.257923,0.083127,-0.434974,0.116551,0,
-	-0.991477,0.130067,0.007441,-0.384098,0,0.793862,
-	-0.9659,0.258812,0.007352,-0.37101,0.099412,0.793862,
-	0.840359,0.535631,0.083047,0.389987,0.225159,0,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.887109,0.461549,0.003255,0.332638,0.192049,0.793862,
-	0.72025,0.693666,-0.008188,0.271598,0.271598,0.793862,
-	0.840359,0.535631,0.083047,0.389987,0.225159,0,
-	0.673093,0.73488,0.083047,0.318423,0.318423,0,
-	0.30062,0.039577,-0.952922,0.092213,0,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0.271764,0.083332,-0.958749,0.089071,0.023866,-0.344143,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.30062,0.039577,-0.952922,0.092213,0,-0.344143,
-	0.271764,0.083332,-0.958749,0.089071,0.023866,-0.344143,
-	0.30062,0.039577,-0.952922,0.092213,0,-0.344143,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.536052,0.070573,-0.84123,0.178141,0,-0.30855,
-	0.668799,0.16246,-0.725476,0.243346,0.065204,-0.25193,
-	0.536052,0.070573,-0.84123,0.178141,0,-0.30855,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.536052,0.070573,-0.84123,0.178141,0,-0.30855,
-	0.668799,0.16246,-0.725476,0.243346,0.065204,-0.25193,
-	0.73389,0.096619,-0.672361,0.25193,0,-0.25193,
-	0.73389,0.096619,-0.672361,0.25193,0,-0.25193,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.860389,0.113272,-0.496891,0.30855,0,-0.178141,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.73389,0.096619,-0.672361,0.25193,0,-0.25193,
-	0.668799,0.16246,-0.725476,0.243346,0.065204,-0.25193,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.958191,0.126148,-0.256821,0.344143,0,-0.092213,
-	0.860389,0.113272,-0.496891,0.30855,0,-0.178141,
-	0.958191,0.126148,-0.256821,0.344143,0,-0.092213,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.919462,0.271766,-0.284135,0.332416,0.089071,-0.092213,
-	0.958191,0.126148,-0.256821,0.344143,0,-0.092213,
-	0.957662,0.256605,-0.130526,0.344143,0.092213,0,
-	0.983106,0.129428,-0.129428,0.356283,0,0,
-	0.957662,0.256605,-0.130526,0.344143,0.092213,0,
-	0.958191,0.126148,-0.256821,0.344143,0,-0.092213,
-	0.919462,0.271766,-0.284135,0.332416,0.089071,-0.092213,
-	0.271764,0.083332,-0.958749,0.089071,0.023866,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0.240936,0.15083,-0.958749,0.079859,0.046106,-0.344143,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.271764,0.083332,-0.958749,0.089071,0.023866,-0.344143,
-	0.240936,0.15083,-0.958749,0.079859,0.046106,-0.344143,
-	0.271764,0.083332,-0.958749,0.089071,0.023866,-0.344143,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.481561,0.134192,-0.866078,0.172071,0.046106,-0.30855,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.668799,0.16246,-0.725476,0.243346,0.065204,-0.25193,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.668799,0.16246,-0.725476,0.243346,0.065204,-0.25193,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.919462,0.271766,-0.284135,0.332416,0.089071,-0.092213,
-	0.831628,0.204716,-0.516223,0.298036,0.079859,-0.178141,
-	0.919462,0.271766,-0.284135,0.332416,0.089071,-0.092213,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.957662,0.256605,-0.130526,0.344143,0.092213,0,
-	0.919462,0.271766,-0.284135,0.332416,0.089071,-0.092213,
-	0.957662,0.256605,-0.130526,0.344143,0.092213,0,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.836071,0.532898,-0.130403,0.30855,0.178141,0,
-	0.240936,0.15083,-0.958749,0.079859,0.046106,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0.193688,0.208049,-0.958749,0.065204,0.065204,-0.344143,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.240936,0.15083,-0.958749,0.079859,0.046106,-0.344143,
-	0.193688,0.208049,-0.958749,0.065204,0.065204,-0.344143,
-	0.240936,0.15083,-0.958749,0.079859,0.046106,-0.344143,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.430421,0.254256,-0.866078,0.154275,0.089071,-0.30855,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.627494,0.326475,-0.70687,0.218178,0.125965,-0.25193,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.751368,0.430509,-0.500107,0.267212,0.154275,-0.178141,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.836071,0.532898,-0.130403,0.30855,0.178141,0,
-	0.837235,0.481678,-0.258889,0.298036,0.172071,-0.092213,
-	0.836071,0.532898,-0.130403,0.30855,0.178141,0,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.701057,0.701057,-0.130526,0.25193,0.25193,0,
-	0.193688,0.208049,-0.958749,0.065204,0.065204,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0.133242,0.25109,-0.958749,0.046106,0.079859,-0.344143,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.193688,0.208049,-0.958749,0.065204,0.065204,-0.344143,
-	0.133242,0.25109,-0.958749,0.046106,0.079859,-0.344143,
-	0.193688,0.208049,-0.958749,0.065204,0.065204,-0.344143,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.349948,0.356994,-0.866078,0.125965,0.125965,-0.30855,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.521615,0.477758,-0.70687,0.178141,0.178141,-0.25193,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.418063,0.77311,-0.476995,0.154275,0.267212,-0.178141,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.418063,0.77311,-0.476995,0.154275,0.267212,-0.178141,
-	0.60815,0.62945,-0.48368,0.218178,0.218178,-0.178141,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.532898,0.836071,-0.130403,0.178141,0.30855,0,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.69037,0.69037,-0.216285,0.243346,0.243346,-0.092213,
-	0.532898,0.836071,-0.130403,0.178141,0.30855,0,
-	0.701057,0.701057,-0.130526,0.25193,0.25193,0,
-	0.133242,0.25109,-0.958749,0.046106,0.079859,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0.063714,0.27702,-0.958749,0.023866,0.089071,-0.344143,
-	0.133251,0.458018,-0.878899,0.046106,0.172071,-0.30855,
-	0.133242,0.25109,-0.958749,0.046106,0.079859,-0.344143,
-	0.063714,0.27702,-0.958749,0.023866,0.089071,-0.344143,
-	0.133242,0.25109,-0.958749,0.046106,0.079859,-0.344143,
-	0.133251,0.458018,-0.878899,0.046106,0.172071,-0.30855,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.133251,0.458018,-0.878899,0.046106,0.172071,-0.30855,
-	0.245627,0.435403,-0.866078,0.089071,0.154275,-0.30855,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.370077,0.617872,-0.693742,0.125965,0.218178,-0.25193,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.418063,0.77311,-0.476995,0.154275,0.267212,-0.178141,
-	0.271766,0.919462,-0.284135,0.089071,0.332416,-0.092213,
-	0.418063,0.77311,-0.476995,0.154275,0.267212,-0.178141,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.418063,0.77311,-0.476995,0.154275,0.267212,-0.178141,
-	0.271766,0.919462,-0.284135,0.089071,0.332416,-0.092213,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.256605,0.957662,-0.130526,0.092213,0.344143,0,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.271766,0.919462,-0.284135,0.089071,0.332416,-0.092213,
-	0.481678,0.837235,-0.258889,0.172071,0.298036,-0.092213,
-	0.256605,0.957662,-0.130526,0.092213,0.344143,0,
-	0.532898,0.836071,-0.130403,0.178141,0.30855,0,
-	0.063714,0.27702,-0.958749,0.023866,0.089071,-0.344143,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	0,0.258748,-0.965945,0,0.092213,-0.344143,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	0.063714,0.27702,-0.958749,0.023866,0.089071,-0.344143,
-	0,0.258748,-0.965945,0,0.092213,-0.344143,
-	0.063714,0.27702,-0.958749,0.023866,0.089071,-0.344143,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	0.133251,0.458018,-0.878899,0.046106,0.172071,-0.30855,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.133251,0.458018,-0.878899,0.046106,0.172071,-0.30855,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.174788,0.652319,-0.737516,0.065204,0.243346,-0.25193,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	0.204716,0.831628,-0.516223,0.079859,0.298036,-0.178141,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	0.271766,0.919462,-0.284135,0.089071,0.332416,-0.092213,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	0.256605,0.957662,-0.130526,0.092213,0.344143,0,
-	0.271766,0.919462,-0.284135,0.089071,0.332416,-0.092213,
-	0.256605,0.957662,-0.130526,0.092213,0.344143,0,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	-0.043468,0.990508,-0.130403,0,0.356283,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.063714,0.27702,-0.958749,-0.023866,0.089071,-0.344143,
-	0,0.258748,-0.965945,0,0.092213,-0.344143,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	-0.063714,0.27702,-0.958749,-0.023866,0.089071,-0.344143,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	-0.063714,0.27702,-0.958749,-0.023866,0.089071,-0.344143,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	0,0.258748,-0.965945,0,0.092213,-0.344143,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	0.011532,0.483485,-0.875276,0,0.178141,-0.30855,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	0.004051,0.706997,-0.707204,0,0.25193,-0.25193,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.224128,0.836455,-0.500109,-0.079859,0.298036,-0.178141,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	-0.224128,0.836455,-0.500109,-0.079859,0.298036,-0.178141,
-	-0.037975,0.865338,-0.499749,0,0.30855,-0.178141,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.043468,0.990508,-0.130403,0,0.356283,0,
-	0.04235,0.96504,-0.258657,0,0.344143,-0.092213,
-	-0.043468,0.990508,-0.130403,0,0.356283,0,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.256605,0.957662,-0.130526,-0.092213,0.344143,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.133242,0.25109,-0.958749,-0.046106,0.079859,-0.344143,
-	-0.063714,0.27702,-0.958749,-0.023866,0.089071,-0.344143,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	-0.133242,0.25109,-0.958749,-0.046106,0.079859,-0.344143,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.133242,0.25109,-0.958749,-0.046106,0.079859,-0.344143,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	-0.063714,0.27702,-0.958749,-0.023866,0.089071,-0.344143,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.124567,0.48414,-0.866078,-0.046106,0.172071,-0.30855,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.19755,0.692601,-0.693742,-0.065204,0.243346,-0.25193,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.224128,0.836455,-0.500109,-0.079859,0.298036,-0.178141,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.224128,0.836455,-0.500109,-0.079859,0.298036,-0.178141,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.482954,0.8365,-0.258889,-0.172071,0.298036,-0.092213,
-	-0.495722,0.858616,-0.130526,-0.178141,0.30855,0,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.482954,0.8365,-0.258889,-0.172071,0.298036,-0.092213,
-	-0.249995,0.932995,-0.258889,-0.089071,0.332416,-0.092213,
-	-0.495722,0.858616,-0.130526,-0.178141,0.30855,0,
-	-0.256605,0.957662,-0.130526,-0.092213,0.344143,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.193688,0.208049,-0.958749,-0.065204,0.065204,-0.344143,
-	-0.133242,0.25109,-0.958749,-0.046106,0.079859,-0.344143,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.193688,0.208049,-0.958749,-0.065204,0.065204,-0.344143,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.193688,0.208049,-0.958749,-0.065204,0.065204,-0.344143,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.133242,0.25109,-0.958749,-0.046106,0.079859,-0.344143,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.245627,0.435403,-0.866078,-0.089071,0.154275,-0.30855,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.380188,0.596483,-0.70687,-0.125965,0.218178,-0.25193,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.424514,0.765403,-0.48368,-0.154275,0.267212,-0.178141,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.482954,0.8365,-0.258889,-0.172071,0.298036,-0.092213,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.495722,0.858616,-0.130526,-0.178141,0.30855,0,
-	-0.482954,0.8365,-0.258889,-0.172071,0.298036,-0.092213,
-	-0.495722,0.858616,-0.130526,-0.178141,0.30855,0,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.701057,0.701057,-0.130526,-0.25193,0.25193,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.240936,0.15083,-0.958749,-0.079859,0.046106,-0.344143,
-	-0.193688,0.208049,-0.958749,-0.065204,0.065204,-0.344143,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.240936,0.15083,-0.958749,-0.079859,0.046106,-0.344143,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.240936,0.15083,-0.958749,-0.079859,0.046106,-0.344143,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.193688,0.208049,-0.958749,-0.065204,0.065204,-0.344143,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.349948,0.356994,-0.866078,-0.125965,0.125965,-0.30855,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.521615,0.477758,-0.70687,-0.178141,0.178141,-0.25193,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.614342,0.610308,-0.500107,-0.218178,0.218178,-0.178141,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.836071,0.532898,-0.130403,-0.30855,0.178141,0,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.673819,0.698612,-0.240642,-0.243346,0.243346,-0.092213,
-	-0.836071,0.532898,-0.130403,-0.30855,0.178141,0,
-	-0.701057,0.701057,-0.130526,-0.25193,0.25193,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.271764,0.083332,-0.958749,-0.089071,0.023866,-0.344143,
-	-0.240936,0.15083,-0.958749,-0.079859,0.046106,-0.344143,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.271764,0.083332,-0.958749,-0.089071,0.023866,-0.344143,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.271764,0.083332,-0.958749,-0.089071,0.023866,-0.344143,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.240936,0.15083,-0.958749,-0.079859,0.046106,-0.344143,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.668799,0.16246,-0.725476,-0.243346,0.065204,-0.25193,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.430421,0.254256,-0.866078,-0.154275,0.089071,-0.30855,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.668799,0.16246,-0.725476,-0.243346,0.065204,-0.25193,
-	-0.627494,0.326475,-0.70687,-0.218178,0.125965,-0.25193,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.919462,0.271766,-0.284135,-0.332416,0.089071,-0.092213,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.751368,0.430509,-0.500107,-0.267212,0.154275,-0.178141,
-	-0.919462,0.271766,-0.284135,-0.332416,0.089071,-0.092213,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.957662,0.256605,-0.130526,-0.344143,0.092213,0,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.919462,0.271766,-0.284135,-0.332416,0.089071,-0.092213,
-	-0.837235,0.481678,-0.258889,-0.298036,0.172071,-0.092213,
-	-0.957662,0.256605,-0.130526,-0.344143,0.092213,0,
-	-0.836071,0.532898,-0.130403,-0.30855,0.178141,0,
-	0,0.084475,-0.996426,0,0,-0.356283,
-	-0.30062,0.039577,-0.952922,-0.092213,0,-0.344143,
-	-0.271764,0.083332,-0.958749,-0.089071,0.023866,-0.344143,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.30062,0.039577,-0.952922,-0.092213,0,-0.344143,
-	-0.536052,0.070573,-0.84123,-0.178141,0,-0.30855,
-	-0.30062,0.039577,-0.952922,-0.092213,0,-0.344143,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.271764,0.083332,-0.958749,-0.089071,0.023866,-0.344143,
-	-0.668799,0.16246,-0.725476,-0.243346,0.065204,-0.25193,
-	-0.536052,0.070573,-0.84123,-0.178141,0,-0.30855,
-	-0.73389,0.096619,-0.672361,-0.25193,0,-0.25193,
-	-0.536052,0.070573,-0.84123,-0.178141,0,-0.30855,
-	-0.668799,0.16246,-0.725476,-0.243346,0.065204,-0.25193,
-	-0.481561,0.134192,-0.866078,-0.172071,0.046106,-0.30855,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.73389,0.096619,-0.672361,-0.25193,0,-0.25193,
-	-0.860389,0.113272,-0.496891,-0.30855,0,-0.178141,
-	-0.73389,0.096619,-0.672361,-0.25193,0,-0.25193,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.668799,0.16246,-0.725476,-0.243346,0.065204,-0.25193,
-	-0.958191,0.126148,-0.256821,-0.344143,0,-0.092213,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.860389,0.113272,-0.496891,-0.30855,0,-0.178141,
-	-0.831628,0.204716,-0.516223,-0.298036,0.079859,-0.178141,
-	-0.958191,0.126148,-0.256821,-0.344143,0,-0.092213,
-	-0.919462,0.271766,-0.284135,-0.332416,0.089071,-0.092213,
-	-0.957662,0.256605,-0.130526,-0.344143,0.092213,0,
-	-0.958191,0.126148,-0.256821,-0.344143,0,-0.092213,
-	-0.983106,0.129428,-0.129428,-0.356283,0,0,
-	-0.958191,0.126148,-0.256821,-0.344143,0,-0.092213,
-	-0.957662,0.256605,-0.130526,-0.344143,0.092213,0,
-	-0.919462,0.271766,-0.284135,-0.332416,0.089071,-0.092213,
-	0,0,-1,-0.434974,0.116551,0,
-	0,0,-1,-0.356283,0,0,
-	0,0,-1,-0.450318,0,0,
-	0,0,-1,-0.356283,0,0,
-	0,0,-1,-0.434974,0.116551,0,
-	0,0,-1,-0.389987,0.225159,0,
-	0,0,-1,-0.356283,0,0,
-	0,0,-1,-0.389987,0.225159,0,
-	0,0,-1,-0.318423,0.318423,0,
-	0,0,-1,-0.356283,0,0,
-	0,0,-1,-0.318423,0.318423,0,
-	0,0,-1,-0.344143,0.092213,0,
-	0,0,-1,-0.344143,0.092213,0,
-	0,0,-1,-0.318423,0.318423,0,
-	0,0,-1,-0.30855,0.178141,0,
-	0,0,-1,-0.30855,0.178141,0,
-	0,0,-1,-0.318423,0.318423,0,
-	0,0,-1,-0.225159,0.389987,0,
-	0,0,-1,-0.30855,0.178141,0,
-	0,0,-1,-0.225159,0.389987,0,
-	0,0,-1,-0.25193,0.25193,0,
-	0,0,-1,-0.25193,0.25193,0,
-	0,0,-1,-0.225159,0.389987,0,
-	0,0,-1,-0.178141,0.30855,0,
-	0,0,-1,-0.178141,0.30855,0,
-	0,0,-1,-0.225159,0.389987,0,
-	0,0,-1,-0.116551,0.434974,0,
-	0,0,-1,-0.178141,0.30855,0,
-	0,0,-1,-0.116551,0.434974,0,
-	0,0,-1,-0.092213,0.344143,0,
-	0,0,-1,-0.092213,0.344143,0,
-	0,0,-1,-0.116551,0.434974,0,
-	0,0,-1,0,0.450318,0,
-	0,0,-1,-0.092213,0.344143,0,
-	0,0,-1,0,0.450318,0,
-	0,0,-1,0,0.356283,0,
-	0,0,-1,0,0.356283,0,
-	0,0,-1,0,0.450318,0,
-	0,0,-1,0.116551,0.434974,0,
-	0,0,-1,0,0.356283,0,
-	0,0,-1,0.116551,0.434974,0,
-	0,0,-1,0.092213,0.344143,0,
-	0,0,-1,0.092213,0.344143,0,
-	0,0,-1,0.116551,0.434974,0,
-	0,0,-1,0.178141,0.30855,0,
-	0,0,-1,0.178141,0.30855,0,
-	0,0,-1,0.116551,0.434974,0,
-	0,0,-1,0.225159,0.389987,0,
-	0,0,-1,0.178141,0.30855,0,
-	0,0,-1,0.225159,0.389987,0,
-	0,0,-1,0.25193,0.25193,0,
-	0,0,-1,0.25193,0.25193,0,
-	0,0,-1,0.225159,0.389987,0,
-	0,0,-1,0.318423,0.318423,0,
-	0,0,-1,0.25193,0.25193,0,
-	0,0,-1,0.318423,0.318423,0,
-	0,0,-1,0.30855,0.178141,0,
-	0,0,-1,0.30855,0.178141,0,
-	0,0,-1,0.318423,0.318423,0,
-	0,0,-1,0.344143,0.092213,0,
-	0,0,-1,0.344143,0.092213,0,
-	0,0,-1,0.318423,0.318423,0,
-	0,0,-1,0.389987,0.225159,0,
-	0,0,-1,0.344143,0.092213,0,
-	0,0,-1,0.389987,0.225159,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.389987,0.225159,0,
-	0,0,-1,0.450318,0,0,
-	0,0,-1,0.450318,0,0,
-	0,0,-1,0.389987,0.225159,0,
-	0,0,-1,0.434974,0.116551,0
-};
-static const struct gllist handsy_model_thumb_metacarpal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 795, handsy_model_thumb_metacarpal_data, 0
-};
-const struct gllist *handsy_model_thumb_metacarpal = &handsy_model_thumb_metacarpal_frame;
-
-static const float handsy_model_thumb_proximal_data[] = {
-	-0.936373,0.288163,0.20042,-0.353285,0.094662,0.353285,
-	-0.973563,0.117553,0.195847,-0.355438,0.071069,0.355438,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	0.518608,0.846422,0.120897,0.173828,0.301078,0.441663,
-	0.661729,0.722474,0.200364,0.309761,0.309761,0,
-	0.452191,0.869124,0.200364,0.219034,0.379378,0,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.375037,0.90542,0.198902,-0.131358,0.386837,0.131358,
-	-0.489842,0.848431,0.200549,-0.198696,0.344152,0.198696,
-	0.826171,0.526588,0.200364,0.379378,0.219034,0,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.934311,0.294816,0.200364,0.423141,0.11338,0,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	-0.042953,0.978779,0.200364,0,0.438068,0,
-	-0.253561,0.946302,0.200549,-0.107675,0.40185,0.107675,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.452191,0.869124,0.200364,0.219034,0.379378,0,
-	0.211837,0.956545,0.200364,0.11338,0.423141,0,
-	-0.692741,0.692741,0.200549,-0.270592,0.270592,0.270592,
-	-0.777502,0.596598,0.198902,-0.291297,0.236707,0.291297,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.596598,0.777502,0.198902,-0.233181,0.30887,0.233181,
-	-0.692741,0.692741,0.200549,-0.270592,0.270592,0.270592,
-	-0.826171,0.526588,0.200364,-0.322249,0.18605,0.322249,
-	-0.90542,0.375037,0.198902,-0.331519,0.158753,0.331519,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	0.934311,0.294816,0.200364,0.423141,0.11338,0,
-	0.965222,0.231799,0.120897,0.335809,0.08998,0.441663,
-	0.971635,0.127918,0.198902,0.438068,0,0,
-	0.661729,0.722474,0.200364,0.309761,0.309761,0,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.826171,0.526588,0.200364,0.379378,0.219034,0,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	0.211837,0.956545,0.200364,0.11338,0.423141,0,
-	-0.042953,0.978779,0.200364,0,0.438068,0,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.518608,0.846422,0.120897,0.173828,0.301078,0.441663,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.232074,0.966532,-0.109355,0.08998,0.335809,0.768373,
-	0.295926,0.937828,-0.181402,0.111086,0.414579,1.210037,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.232074,0.966532,-0.109355,0.08998,0.335809,0.768373,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.295926,0.937828,-0.181402,0.111086,0.414579,1.210037,
-	0.52857,0.829281,-0.181402,0.214602,0.371702,1.210037,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.829281,0.52857,-0.181402,0.371702,0.214602,1.210037,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.829281,0.52857,-0.181402,0.371702,0.214602,1.210037,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.695353,0.695353,-0.181571,0.303493,0.303493,1.210037,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	0.232074,0.966532,-0.109355,0.08998,0.335809,0.768373,
-	0.043115,0.982463,-0.181402,0,0.429204,1.210037,
-	0.232074,0.966532,-0.109355,0.08998,0.335809,0.768373,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	0.232074,0.966532,-0.109355,0.08998,0.335809,0.768373,
-	0.043115,0.982463,-0.181402,0,0.429204,1.210037,
-	0.295926,0.937828,-0.181402,0.111086,0.414579,1.210037,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.518608,0.846422,0.120897,0.173828,0.301078,0.441663,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.52857,0.829281,-0.181402,0.214602,0.371702,1.210037,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.482303,0.872513,-0.078134,0.173828,0.301078,0.768373,
-	0.701867,0.701867,-0.121508,0.24583,0.24583,0.768373,
-	0.52857,0.829281,-0.181402,0.214602,0.371702,1.210037,
-	0.695353,0.695353,-0.181571,0.303493,0.303493,1.210037,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.991445,0.130526,0,-0.347655,0,0.467099,
-	-0.987385,0.129992,-0.090404,-0.347655,0,0.768373,
-	-0.991445,0.130526,0,-0.347655,0,0.467099,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.989366,0.130253,0.064723,-0.347655,0,0.441663,
-	-0.989366,0.130253,0.064723,-0.347655,0,0.441663,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.965222,0.231799,0.120897,0.335809,0.08998,0.441663,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.937828,0.295926,-0.181402,0.414579,0.111086,1.210037,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.937828,0.295926,-0.181402,0.414579,0.111086,1.210037,
-	0.862238,0.498229,-0.091178,0.301078,0.173828,0.768373,
-	0.829281,0.52857,-0.181402,0.371702,0.214602,1.210037,
-	0.989244,0.130236,0.066597,0.347655,0,0.441663,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.987385,0.129992,-0.090404,0.347655,0,0.768373,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.989244,0.130236,0.066597,0.347655,0,0.441663,
-	0.965222,0.231799,0.120897,0.335809,0.08998,0.441663,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.975239,0.128393,-0.180068,0.429204,0,1.210037,
-	0.987385,0.129992,-0.090404,0.347655,0,0.768373,
-	0.975239,0.128393,-0.180068,0.429204,0,1.210037,
-	0.967612,0.240045,-0.078134,0.335809,0.08998,0.768373,
-	0.937828,0.295926,-0.181402,0.414579,0.111086,1.210037,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.965222,0.231799,0.120897,0.335809,0.08998,0.441663,
-	0.934311,0.294816,0.200364,0.423141,0.11338,0,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.211837,0.956545,0.200364,0.11338,0.423141,0,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	-0.972735,0.128063,0.193353,-0.363243,0,0.363243,
-	-0.989366,0.130253,0.064723,-0.347655,0,0.441663,
-	-0.972735,0.128063,0.193353,-0.363243,0,0.363243,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	-0.973563,0.117553,0.195847,-0.355438,0.071069,0.355438,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.826171,0.526588,0.200364,-0.322249,0.18605,0.322249,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	-0.826171,0.526588,0.200364,-0.322249,0.18605,0.322249,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.777502,0.596598,0.198902,-0.295978,0.229044,0.295978,
-	-0.777502,0.596598,0.198902,-0.295978,0.229044,0.295978,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.777502,0.596598,0.198902,-0.291297,0.236707,0.291297,
-	-0.596598,0.777502,0.198902,-0.233181,0.30887,0.233181,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.489842,0.848431,0.200549,-0.198696,0.344152,0.198696,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	-0.596598,0.777502,0.198902,-0.233181,0.30887,0.233181,
-	-0.730758,0.669317,0.134196,-0.24583,0.24583,0.441663,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	-0.936373,0.288163,0.20042,-0.353285,0.094662,0.353285,
-	-0.964953,0.236604,0.113507,-0.335809,0.08998,0.441663,
-	-0.936373,0.288163,0.20042,-0.353285,0.094662,0.353285,
-	-0.878954,0.457636,0.134198,-0.301078,0.173828,0.441663,
-	-0.90542,0.375037,0.198902,-0.331519,0.158753,0.331519,
-	-0.000441,0.994906,0.100805,0,0.347655,0.441663,
-	-0.042953,0.978779,0.200364,0,0.438068,0,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	0.275694,0.957356,0.086383,0.08998,0.335809,0.441663,
-	0.518608,0.846422,0.120897,0.173828,0.301078,0.441663,
-	0.452191,0.869124,0.200364,0.219034,0.379378,0,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.882604,0.459204,0.100709,0.301078,0.173828,0.441663,
-	0.826171,0.526588,0.200364,0.379378,0.219034,0,
-	0.717436,0.691248,0.086383,0.24583,0.24583,0.441663,
-	0.661729,0.722474,0.200364,0.309761,0.309761,0,
-	0.518608,0.846422,0.120897,0.173828,0.301078,0.441663,
-	-0.375037,0.90542,0.198902,-0.131358,0.386837,0.131358,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	-0.253561,0.946302,0.200549,-0.107675,0.40185,0.107675,
-	-0.256474,0.957172,0.134323,-0.08998,0.335809,0.441663,
-	-0.375037,0.90542,0.198902,-0.131358,0.386837,0.131358,
-	-0.497453,0.861614,0.100805,-0.173828,0.301078,0.441663,
-	0.965222,0.231799,0.120897,0.335809,0.08998,0.441663,
-	0.989244,0.130236,0.066597,0.347655,0,0.441663,
-	0.971635,0.127918,0.198902,0.438068,0,0,
-	0,0,-1,0,0.438068,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0,0.214602,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0,0.438068,0,
-	0,0,-1,0.11338,0.423141,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.11338,0.423141,0,
-	0,0,-1,0.219034,0.379378,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.219034,0.379378,0,
-	0,0,-1,0.309761,0.309761,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.309761,0.309761,0,
-	0,0,-1,0.379378,0.219034,0,
-	0,0,-1,0.356283,0.214602,0,
-	0,0,-1,0.379378,0.219034,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.356283,0,0,
-	0,0,-1,0.379378,0.219034,0,
-	0,0,-1,0.438068,0,0,
-	0,0,-1,0.438068,0,0,
-	0,0,-1,0.379378,0.219034,0,
-	0,0,-1,0.423141,0.11338,0,
-	-0.707107,0,-0.707107,-0.355438,0.071069,0.355438,
-	-0.707107,0,-0.707107,-0.25193,0,0.25193,
-	-0.707107,0,-0.707107,-0.363243,0,0.363243,
-	-0.707107,0,-0.707107,-0.25193,0,0.25193,
-	-0.707107,0,-0.707107,-0.355438,0.071069,0.355438,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.355438,0.071069,0.355438,
-	-0.707107,0,-0.707107,-0.353285,0.094662,0.353285,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.353285,0.094662,0.353285,
-	-0.707107,0,-0.707107,-0.331519,0.158753,0.331519,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.331519,0.158753,0.331519,
-	-0.707107,0,-0.707107,-0.322249,0.18605,0.322249,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.322249,0.18605,0.322249,
-	-0.707107,0,-0.707107,-0.295978,0.229044,0.295978,
-	-0.707107,0,-0.707107,-0.25193,0.214602,0.25193,
-	-0.707107,0,-0.707107,-0.295978,0.229044,0.295978,
-	-0.707107,0,-0.707107,0,0.214602,0,
-	-0.707107,0,-0.707107,0,0.214602,0,
-	-0.707107,0,-0.707107,-0.295978,0.229044,0.295978,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.295978,0.229044,0.295978,
-	-0.707107,0,-0.707107,-0.291297,0.236707,0.291297,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.291297,0.236707,0.291297,
-	-0.707107,0,-0.707107,-0.270592,0.270592,0.270592,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.270592,0.270592,0.270592,
-	-0.707107,0,-0.707107,-0.233181,0.30887,0.233181,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.233181,0.30887,0.233181,
-	-0.707107,0,-0.707107,-0.198696,0.344152,0.198696,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.198696,0.344152,0.198696,
-	-0.707107,0,-0.707107,-0.131358,0.386837,0.131358,
-	-0.707107,0,-0.707107,0,0.438068,0,
-	-0.707107,0,-0.707107,-0.131358,0.386837,0.131358,
-	-0.707107,0,-0.707107,-0.107675,0.40185,0.107675,
-	0,1,0,-0.30855,0.214602,1.031895,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,-0.25193,0.214602,0.958107,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,-0.30855,0.214602,1.031895,
-	0,1,0,-0.344143,0.214602,1.117824,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,-0.344143,0.214602,1.117824,
-	0,1,0,-0.356283,0.214602,1.210037,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,-0.356283,0.214602,1.210037,
-	0,1,0,-0.344143,0.214602,1.302249,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,0.344143,0.214602,1.302249,
-	0,1,0,0.356283,0.214602,1.210037,
-	0,1,0,0.344143,0.214602,1.302249,
-	0,1,0,0,0.214602,1.210037,
-	0,1,0,-0.344143,0.214602,1.302249,
-	0,1,0,0.344143,0.214602,1.302249,
-	0,1,0,-0.344143,0.214602,1.302249,
-	0,1,0,-0.317592,0.214602,1.366349,
-	0,1,0,0.344143,0.214602,1.302249,
-	0,1,0,-0.317592,0.214602,1.366349,
-	0,1,0,0.30855,0.214602,1.388178,
-	0,1,0,0.30855,0.214602,1.388178,
-	0,1,0,-0.317592,0.214602,1.366349,
-	0,1,0,-0.30855,0.214602,1.388178,
-	0,1,0,0.30855,0.214602,1.388178,
-	0,1,0,-0.30855,0.214602,1.388178,
-	0,1,0,-0.25193,0.214602,1.461967,
-	0,1,0,0.30855,0.214602,1.388178,
-	0,1,0,-0.25193,0.214602,1.461967,
-	0,1,0,0.25193,0.214602,1.461967,
-	0,1,0,0.25193,0.214602,1.461967,
-	0,1,0,-0.25193,0.214602,1.461967,
-	0,1,0,-0.178141,0.214602,1.518587,
-	0,1,0,0.25193,0.214602,1.461967,
-	0,1,0,-0.178141,0.214602,1.518587,
-	0,1,0,0.178141,0.214602,1.518587,
-	0,1,0,0.178141,0.214602,1.518587,
-	0,1,0,-0.178141,0.214602,1.518587,
-	0,1,0,-0.092213,0.214602,1.554179,
-	0,1,0,0.178141,0.214602,1.518587,
-	0,1,0,-0.092213,0.214602,1.554179,
-	0,1,0,0.092213,0.214602,1.554179,
-	0,1,0,0.092213,0.214602,1.554179,
-	0,1,0,-0.092213,0.214602,1.554179,
-	0,1,0,0,0.214602,1.566319,
-	0.991445,0,0.130526,0.356283,0,1.210037,
-	0.965926,0,0.258819,0.344143,0.214602,1.302249,
-	0.965926,0,0.258819,0.344143,0,1.302249,
-	0.965926,0,0.258819,0.344143,0.214602,1.302249,
-	0.991445,0,0.130526,0.356283,0,1.210037,
-	0.991445,0,0.130526,0.356283,0.214602,1.210037,
-	0.965926,0,0.258819,0.344143,0.214602,1.302249,
-	0.887114,0,0.461551,0.30855,0,1.388178,
-	0.965926,0,0.258819,0.344143,0,1.302249,
-	0.887114,0,0.461551,0.30855,0,1.388178,
-	0.965926,0,0.258819,0.344143,0.214602,1.302249,
-	0.843272,0,0.537487,0.30855,0.214602,1.388178,
-	0.843272,0,0.537487,0.30855,0.214602,1.388178,
-	0.707107,0,0.707107,0.25193,0,1.461967,
-	0.887114,0,0.461551,0.30855,0,1.388178,
-	0.707107,0,0.707107,0.25193,0,1.461967,
-	0.843272,0,0.537487,0.30855,0.214602,1.388178,
-	0.707107,0,0.707107,0.25193,0.214602,1.461967,
-	0.707107,0,0.707107,0.25193,0,1.461967,
-	0.537487,0,0.843272,0.178141,0.214602,1.518587,
-	0.461551,0,0.887114,0.178141,0,1.518587,
-	0.537487,0,0.843272,0.178141,0.214602,1.518587,
-	0.707107,0,0.707107,0.25193,0,1.461967,
-	0.707107,0,0.707107,0.25193,0.214602,1.461967,
-	0.461551,0,0.887114,0.178141,0,1.518587,
-	0.300918,0,0.95365,0.092213,0.214602,1.554179,
-	0.216222,0,0.976344,0.092213,0,1.554179,
-	0.300918,0,0.95365,0.092213,0.214602,1.554179,
-	0.461551,0,0.887114,0.178141,0,1.518587,
-	0.537487,0,0.843272,0.178141,0.214602,1.518587,
-	0.216222,0,0.976344,0.092213,0,1.554179,
-	0.043842,0,0.999038,0,0.214602,1.566319,
-	-0.043842,0,0.999038,0,0,1.566319,
-	0.043842,0,0.999038,0,0.214602,1.566319,
-	0.216222,0,0.976344,0.092213,0,1.554179,
-	0.300918,0,0.95365,0.092213,0.214602,1.554179,
-	-0.043842,0,0.999038,0,0,1.566319,
-	-0.216222,0,0.976344,-0.092213,0.214602,1.554179,
-	-0.300918,0,0.95365,-0.092213,0,1.554179,
-	-0.216222,0,0.976344,-0.092213,0.214602,1.554179,
-	-0.043842,0,0.999038,0,0,1.566319,
-	0.043842,0,0.999038,0,0.214602,1.566319,
-	-0.300918,0,0.95365,-0.092213,0,1.554179,
-	-0.461551,0,0.887114,-0.178141,0.214602,1.518587,
-	-0.555804,0,0.831313,-0.178141,0,1.518587,
-	-0.461551,0,0.887114,-0.178141,0.214602,1.518587,
-	-0.300918,0,0.95365,-0.092213,0,1.554179,
-	-0.216222,0,0.976344,-0.092213,0.214602,1.554179,
-	-0.555804,0,0.831313,-0.178141,0,1.518587,
-	-0.725474,0,0.68825,-0.25193,0.194957,1.461967,
-	-0.707107,0,0.707107,-0.25193,0,1.461967,
-	-0.725474,0,0.68825,-0.25193,0.194957,1.461967,
-	-0.555804,0,0.831313,-0.178141,0,1.518587,
-	-0.675426,0,0.737428,-0.25193,0.214602,1.461967,
-	-0.675426,0,0.737428,-0.25193,0.214602,1.461967,
-	-0.555804,0,0.831313,-0.178141,0,1.518587,
-	-0.461551,0,0.887114,-0.178141,0.214602,1.518587,
-	-0.725474,0,0.68825,-0.25193,0.194957,1.461967,
-	-0.843272,0,0.537487,-0.30855,0,1.388178,
-	-0.707107,0,0.707107,-0.25193,0,1.461967,
-	-0.843272,0,0.537487,-0.30855,0,1.388178,
-	-0.725474,0,0.68825,-0.25193,0.194957,1.461967,
-	-0.866025,0,0.5,-0.30855,0.214602,1.388178,
-	-0.866025,0,0.5,-0.30855,0.214602,1.388178,
-	-0.725474,0,0.68825,-0.25193,0.194957,1.461967,
-	-0.675426,0,0.737428,-0.25193,0.214602,1.461967,
-	-0.866025,0,0.5,-0.30855,0.214602,1.388178,
-	-0.92388,0,0.382683,-0.317592,0,1.366349,
-	-0.843272,0,0.537487,-0.30855,0,1.388178,
-	-0.92388,0,0.382683,-0.317592,0,1.366349,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.302249,
-	-0.965926,0,0.258819,-0.344143,0,1.302249,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.302249,
-	-0.92388,0,0.382683,-0.317592,0,1.366349,
-	-0.866025,0,0.5,-0.30855,0.214602,1.388178,
-	-0.645102,0.715851,0.26721,-0.344143,0.214602,1.302249,
-	-0.645102,0.715851,0.26721,-0.30855,0.214602,1.388178,
-	-0.645102,0.715851,0.26721,-0.317592,0.214602,1.366349,
-	-0.829281,0.52857,-0.181402,-0.320459,0.185017,0.889577,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.829281,0.52857,-0.181402,-0.320459,0.185017,0.889577,
-	-0.780385,0.598811,-0.180068,-0.293976,0.227495,0.916061,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.780385,0.598811,-0.180068,-0.293976,0.227495,0.916061,
-	-0.66422,0.725193,-0.181402,-0.268445,0.268445,0.941592,
-	-0.66422,0.725193,-0.181402,-0.268445,0.268445,0.941592,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	-0.716053,0.690228,-0.104175,-0.24583,0.24583,0.768373,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	-0.66422,0.725193,-0.181402,-0.268445,0.268445,0.941592,
-	-0.491689,0.85163,-0.181571,-0.196464,0.340286,1.013572,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	-0.254517,0.94987,-0.181571,-0.10602,0.395671,1.104017,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	-0.254517,0.94987,-0.181571,-0.10602,0.395671,1.104017,
-	-0.496295,0.859609,-0.121508,-0.173828,0.301078,0.768373,
-	-0.491689,0.85163,-0.181571,-0.196464,0.340286,1.013572,
-	-0.937828,0.295926,-0.181402,-0.351831,0.094273,0.858206,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.872513,0.482303,-0.078134,-0.301078,0.173828,0.768373,
-	-0.937828,0.295926,-0.181402,-0.351831,0.094273,0.858206,
-	-0.829281,0.52857,-0.181402,-0.320459,0.185017,0.889577,
-	-0.975239,0.128393,-0.180068,-0.362308,0,0.847729,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.987385,0.129992,-0.090404,-0.347655,0,0.768373,
-	-0.976006,0.203287,-0.078024,-0.335809,0.08998,0.768373,
-	-0.975239,0.128393,-0.180068,-0.362308,0,0.847729,
-	-0.937828,0.295926,-0.181402,-0.351831,0.094273,0.858206,
-	-0.254517,0.94987,-0.181571,-0.10602,0.395671,1.104017,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	-0.258341,0.964141,-0.06076,-0.08998,0.335809,0.768373,
-	0.00036,0.995835,-0.091178,0,0.347655,0.768373,
-	-0.254517,0.94987,-0.181571,-0.10602,0.395671,1.104017,
-	0.043115,0.982463,-0.181402,0,0.429204,1.210037,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.117824,
-	-0.866025,0,-0.5,-0.30855,0,1.031895,
-	-0.965926,0,-0.258819,-0.344143,0,1.117824,
-	-0.866025,0,-0.5,-0.30855,0,1.031895,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.117824,
-	-0.843272,0,-0.537487,-0.30855,0.214602,1.031895,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.302249,
-	-1,0,0,-0.356283,0,1.210037,
-	-0.965926,0,0.258819,-0.344143,0,1.302249,
-	-1,0,0,-0.356283,0,1.210037,
-	-0.965926,0,0.258819,-0.344143,0.214602,1.302249,
-	-1,0,0,-0.356283,0.214602,1.210037,
-	-1,0,0,-0.356283,0,1.210037,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.117824,
-	-0.965926,0,-0.258819,-0.344143,0,1.117824,
-	-0.965926,0,-0.258819,-0.344143,0.214602,1.117824,
-	-1,0,0,-0.356283,0,1.210037,
-	-1,0,0,-0.356283,0.214602,1.210037,
-	-0.866025,0,-0.5,-0.30855,0,1.031895,
-	-0.793353,0,-0.608761,-0.25193,0.194957,0.958107,
-	-0.793353,0,-0.608761,-0.25193,0,0.958107,
-	-0.793353,0,-0.608761,-0.25193,0.194957,0.958107,
-	-0.866025,0,-0.5,-0.30855,0,1.031895,
-	-0.843272,0,-0.537487,-0.30855,0.214602,1.031895,
-	-0.793353,0,-0.608761,-0.25193,0.194957,0.958107,
-	-0.843272,0,-0.537487,-0.30855,0.214602,1.031895,
-	-0.793353,0,-0.608761,-0.25193,0.214602,0.958107,
-	-0.707107,0,0.707107,0,0.429204,1.210037,
-	-0.707107,0,0.707107,-0.25193,0.214602,0.958107,
-	-0.707107,0,0.707107,0,0.214602,1.210037,
-	-0.707107,0,0.707107,-0.25193,0.214602,0.958107,
-	-0.707107,0,0.707107,0,0.429204,1.210037,
-	-0.707107,0,0.707107,-0.293976,0.227495,0.916061,
-	-0.707107,0,0.707107,-0.293976,0.227495,0.916061,
-	-0.707107,0,0.707107,0,0.429204,1.210037,
-	-0.707107,0,0.707107,-0.268445,0.268445,0.941592,
-	-0.707107,0,0.707107,-0.268445,0.268445,0.941592,
-	-0.707107,0,0.707107,0,0.429204,1.210037,
-	-0.707107,0,0.707107,-0.196464,0.340286,1.013572,
-	-0.707107,0,0.707107,-0.196464,0.340286,1.013572,
-	-0.707107,0,0.707107,0,0.429204,1.210037,
-	-0.707107,0,0.707107,-0.10602,0.395671,1.104017,
-	-0.707107,0,0.707107,-0.25193,0.194957,0.958107,
-	-0.707107,0,0.707107,-0.362308,0,0.847729,
-	-0.707107,0,0.707107,-0.25193,0,0.958107,
-	-0.707107,0,0.707107,-0.362308,0,0.847729,
-	-0.707107,0,0.707107,-0.25193,0.194957,0.958107,
-	-0.707107,0,0.707107,-0.351831,0.094273,0.858206,
-	-0.707107,0,0.707107,-0.351831,0.094273,0.858206,
-	-0.707107,0,0.707107,-0.25193,0.194957,0.958107,
-	-0.707107,0,0.707107,-0.320459,0.185017,0.889577,
-	-0.707107,0,0.707107,-0.320459,0.185017,0.889577,
-	-0.707107,0,0.707107,-0.25193,0.194957,0.958107,
-	-0.707107,0,0.707107,-0.293976,0.227495,0.916061,
-	-0.707107,0,0.707107,-0.293976,0.227495,0.916061,
-	-0.707107,0,0.707107,-0.25193,0.194957,0.958107,
-	-0.707107,0,0.707107,-0.25193,0.214602,0.958107,
-	0,0,1,0.429204,0,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.356283,0,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.429204,0,1.210037,
-	0,0,1,0.371702,0.214602,1.210037,
-	0,0,1,0.371702,0.214602,1.210037,
-	0,0,1,0.429204,0,1.210037,
-	0,0,1,0.414579,0.111086,1.210037,
-	0,0,1,0,0.214602,1.210037,
-	0,0,1,0.111086,0.414579,1.210037,
-	0,0,1,0,0.429204,1.210037,
-	0,0,1,0.111086,0.414579,1.210037,
-	0,0,1,0,0.214602,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.111086,0.414579,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.214602,0.371702,1.210037,
-	0,0,1,0.214602,0.371702,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.303493,0.303493,1.210037,
-	0,0,1,0.303493,0.303493,1.210037,
-	0,0,1,0.356283,0.214602,1.210037,
-	0,0,1,0.371702,0.214602,1.210037
-};
-static const struct gllist handsy_model_thumb_proximal_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 513, handsy_model_thumb_proximal_data, 0
-};
-const struct gllist *handsy_model_thumb_proximal = &handsy_model_thumb_proximal_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char handsy_model[] =
+ "XSGLMSH1\010\000\000\000\000\000\000\000finger_distal\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\020\002\000\000\004\000\000\000"
+ "\357\000\000\000l\003\000\000\302\001\000\000=RP\273)\331\025>\227h\034\077"
+ "\320i\2347finger_intermediate\000\000\000\000\000\000\000\000\000H\031\000"
+ "\000\004\000\000\000{\000\000\000G\001\000\000\261\000\000\000(\014\300;"
+ "\234\346*>\247!\034\077\337\042\2347finger_metacarpal\000\000\000\000\000"
+ "\000\000\000\000\000\000l#\000\000\004\000\000\000\317\000\000\0009\003\000"
+ "\000\251\001\000\000\177\322\035::G\077>\345\2721\077\226i\2717finger_pr"
+ "oximal\000\000\000\000\000\000\000\000\000\000\000\000\000\2348\000\000\004"
+ "\000\000\000\223\000\000\000\217\001\000\000\332\000\000\000%\200];]\023"
+ "\077>\247\315\206\077\206w\0038palm\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\344D\000\000\004"
+ "\000\000\000\265\002\000\000\042\010\000\000\015\004\000\000\274\236\024"
+ "\274<N\016>\006+\346\077\011Rt8thumb_distal\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000p\200\000\000\004\000\000\000\340\000\000"
+ "\000$\003\000\000\235\001\000\000(+a<\250\300[>\252`0\077\013b\2607thumb"
+ "_metacarpal\000\000\000\000\000\000\000\000\000\000\000\000\354\225\000\000"
+ "\004\000\000\000\326\000\000\000\033\003\000\000\237\001\000\000\000\000"
+ "\023\250\025\220f>\315~\077\077.[\0158thumb_proximal\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\374\252\000\000\004\000\000\000\244"
+ "\000\000\000\001\002\000\000\020\001\000\000\214=\031=gJ`>(}H\077\271~\310"
+ "7\226\024\034\007\344Q\000\000y\025\377\007$m\000\000y\025\377\007\344Q\000"
+ "\000\232\023 \006\323]\000\000u\022\373\004=b\000\000u\022\373\004\235d\000"
+ "\000u\022\373\004\376m\000\000\271\023\077\006lo\000\000u\022\373\004dp\000"
+ "\0005'\220\371\030\031\000\000\001\036\340\002\3341\000\000_%J\371z&\000"
+ "\000G!\230\003\030\031\000\000\236\024\345\011^@\000\000\216\031K\013\030"
+ "\031\000\000\357*\341\355\030\031\000\000\023*\321\3554\037\000\000\221\313"
+ "\000\000\236\300\000\000f\325\234\014F\253\000\000\240\313\367\377\014\265"
+ "\000\000P\325\263\014\236\300\000\000\261+X\341\264\034\000\0004,X\341\030"
+ "\031\000\000\023*\321\3554\037\000\000\034\342F\026\220\236\000\000\314\360"
+ "\221\034\236\300\000\000\337\360L\034\315\217\000\000\002\342q\026\236\300"
+ "\000\000\373\011\354\015\320P\000\000\217\020!\020\030\031\000\000q\3056"
+ "\361\236\300\000\000y\3054\3613\273\000\000Z\303X\341\236\300\000\000_\303"
+ "X\341L\275\000\000\237#~\357\251|\000\0008\037\332\356\355|\000\000l\037"
+ "^\356\376|\000\000)\036\255\374\304v\000\000\255\031p\373\267w\000\000e\032"
+ "\200\372\032x\000\000)\036\255\374\2371\000\000\237#~\357\251|\000\000\237"
+ "#~\357.)\000\000)\036\255\374\304v\000\000#!X\341\265~\000\000l\037^\356"
+ "\235d\000\000#!X\341\235d\000\000l\037^\356\376|\000\000u\022\330\004\177"
+ "p\000\000\321\026\077\006lo\000\000u\022\373\004dp\000\000u\022\373\004d"
+ "p\000\000u\022\330\004\016n\000\000u\022\330\004\177p\000\000u\022\373\004"
+ "\376m\000\000#!X\341\265~\000\000\264#\332\356\355|\000\000|%X\341\265~\000"
+ "\000u\022\330\004\235d\000\000u\022\373\004\235d\000\000y\025\377\007$m\000"
+ "\000\271\023\077\006lo\000\000\321\026\077\006lo\000\000y\025\377\007\015"
+ "\077\000\000y\025\377\007\344Q\000\000y\025\377\007$m\000\000\213\035\346"
+ "\362\235d\000\000l\037^\356Yc\000\000u\022\373\004=b\000\000u\022\330\004"
+ "\202b\000\000o\033\375\367\235d\000\000@\034\006\366{e\000\000e\032\200\372"
+ "\032x\000\000w\030\004\375\235d\000\000e\032\200\372\235d\000\000\255\031"
+ "p\373\267w\000\000u\022\330\004\177p\000\0009\027\243\376Te\000\000\003\026"
+ "6\000\235d\000\000u\022\330\004\235d\000\000|%X\341\265~\000\000|%X\341M"
+ "&\000\000\264#\332\356\355|\000\000\266\037&\354\220d\000\000K\033O\365\361"
+ "h\000\000]\036\255\353\361h\000\000l\037^\356Yc\000\000\213\035\346\362\235"
+ "d\000\000@\034\006\366{e\000\000k\022F\011\306C\000\000y\025\377\007\344"
+ "Q\000\000y\025\377\007\015\077\000\000k\022F\011\344Q\000\000y\025\377\007"
+ "\344Q\000\000k\022F\011\344Q\000\000\226\024\034\007\344Q\000\000u\022\330"
+ "\004\202b\000\0008\037\332\356\355|\000\000e\032\200\372\177c\000\000\320"
+ "\021\351\007\323]\000\000\226\024\034\007\344Q\000\000\232\023 \006\323]"
+ "\000\000\266\037&\354\220d\000\000#!X\341\212c\000\000*\007\310\351m~\000"
+ "\000C\005\255\353m~\000\000\252\000X\341\377\177\000\000\240\010O\347m~\000"
+ "\000\213\011O\365\322y\000\0008\015\245\361\322y\000\0008\015\224\375~r\000"
+ "\000h\026\224\375\361h\000\000\012\020\354\003\361h\000\000k\022e\370~r\000"
+ "\000u\022\373\004=b\000\000u\022\330\004\202b\000\000\003\0266\000\235d\000"
+ "\0009\027\243\376Te\000\000o\033\375\367\235d\000\000e\032\200\372\177c\000"
+ "\000w\030\004\375\235d\000\000\252\000\250\036\236\300\000\000\352\017J\034"
+ "&\202\000\000\252\000I\036\001\200\000\000\012\020\337\354\322y\000\000h"
+ "\026\245\361~r\000\000\213\011n\344m~\000\000\320\021O\347\322y\000\000\352"
+ "\030\310\351~r\000\000\333\011X\341m~\000\000k\022X\341\322y\000\000\305"
+ "\031X\341~r\000\000i\037X\341\361h\000\000#!X\341\212c\000\000I\011\372\015"
+ "\344Q\000\000\333\011\341\015\344Q\000\000\333\011\341\015\002Q\000\000\213"
+ "\011\134\014\323]\000\000\240\010\351\007\361h\000\000*\007\325\000~r\000"
+ "\000C\005\234\367\322y\000\000\013\003\337\354m~\000\000\252\000\341\015"
+ "\323]\000\000\252\000s\017\344Q\000\000\252\000F\011\361h\000\000\252\000"
+ "\362\001~r\000\000\252\000e\370\322y\000\000\252\000G\355m~\000\000\224\375"
+ "\337\354m~\000\000\235\351F\011\344Q\000\000$\365\134\014\323]\000\000\274"
+ "\364\341\015\344Q\000\000f\352\351\007\323]\000\000\264\354\354\003\361h"
+ "\000\000U\366\351\007\361h\000\000]\360\224\375~r\000\000:\370\325\000~r"
+ "\000\000$\365O\365\322y\000\000\263\372\234\367\322y\000\000\263\372\255"
+ "\353m~\000\000\237#~\357.)\000\000|%X\341M&\000\000\023*\321\3554\037\000"
+ "\000_%J\371z&\000\000)\036\255\374\2371\000\000\001\036\340\002\3341\000"
+ "\000y\025\377\007\015\077\000\000\236\024\345\011^@\000\000k\022F\011\306"
+ "C\000\000\333\011\341\015\002Q\000\000\373\011\354\015\320P\000\000I\011"
+ "\372\015\344Q\000\000-\341\325\000\323]\000\000\020\340\362\001\344Q\000"
+ "\000o\344\224\375\361h\000\000\235\351e\370~r\000\000]\360\245\361\322y\000"
+ "\000:\370\310\351m~\000\000\275\330e\370\344Q\000\000\031\332\234\367\323"
+ "]\000\000\026\336O\365\361h\000\000o\344\245\361~r\000\000\264\354\337\354"
+ "\322y\000\000U\366O\347m~\000\000\042\324G\355\344Q\000\000\246\325\337\354"
+ "\323]\000\000\031\332\255\353\361h\000\000-\341\310\351~r\000\000f\352O\347"
+ "\322y\000\000$\365n\344m~\000\000\217\322X\341\344Q\000\000\042\324X\341"
+ "\323]\000\000\275\330X\341\361h\000\000\020\340X\341~r\000\000\235\351X\341"
+ "\322y\000\000\274\364X\341m~\000\000\252\000\250\036\236\300\000\000q\020"
+ "\010\0349\202\000\000\223\325\277\014\030\253\000\000\274\036\364\025;\204"
+ "\000\000\252\000\250\036\236\300\000\000\224<\010\342m\210\000\000\246<X"
+ "\341o\210\000\000\373\036\321\025D\204\000\000\3034\204\377S\207\000\000"
+ "|4\376\377I\207\000\000\245:\362\360'\210\000\000t:\220\361 \210\000\000"
+ "Y+\027\014\001\206\000\000\015+d\014\366\205\000\000\355-\254\010]\206\000"
+ "\000y\3054\3613\273\000\000,\340X\341\177\240\000\000_\303X\341L\275\000"
+ "\000,\340\247\002\177\240\000\000\240\313\367\377\014\265\000\000f\325\234"
+ "\014F\253\000\000\252\000\247\002\001\200\000\000\252\000I\036\001\200\000"
+ "\000\223\325\277\014\030\253\000\000\034\342F\026\220\236\000\000\337\360"
+ "L\034\315\217\000\000\352\017J\034&\202\000\000\252\000\247\002\001\200\000"
+ "\000\252\000I\036\001\200\000\000\011.\247\002a\206\000\000q\020\010\034"
+ "9\202\000\000\274\036\364\025;\204\000\000\373\036\321\025D\204\000\000\015"
+ "+d\014\366\205\000\000Y+\027\014\001\206\000\000\355-\254\010]\206\000\000"
+ "|4\376\377I\207\000\000\246<X\341o\210\000\000\011.X\341a\206\000\000\303"
+ "4\204\377S\207\000\000t:\220\361 \210\000\000\245:\362\360'\210\000\000\224"
+ "<\010\342m\210\000\000\300\077\300\077\300\077\300\077\301@\301@\300@\300"
+ "@\300@Q$D0R!C45A3D`\023^\024\2650\300@\254,\303=Y\005h\013U\011\324T\343"
+ "]\350h\317K\037Y$T\243\035\230\030\224\016\220\017\002!\002\033\000\027\003"
+ "/\003/\004&Q.a\036j\025Q.\220\361\232\347\220\361\234\345\0007\000;\0007"
+ "\201\000\211\010\217\016\201\000\000\017\377\027\000\017\207\006\201\000"
+ "\000H\000\077H7H7H7H7\246\333\234\345\201\000\201\000\246\333\246\333\254"
+ "\325\270\311\257\322\270\311\270\311\270\311\270\311\270\311p\017p\017p\017"
+ "S\021D\034J\017L\030L\030D!(W%Z%Z-M\000\000\000\000\000\000\270\311\246\333"
+ "\257\322.>;;55\220\361\220\361\026\023\020\027\001\012\034\015\031\042\042"
+ "\033\042,8(-3.!2323237.@&@&@&\013n\034_\001\177*\0238\026 \0101\012\077\014"
+ "$\0047\006F\007T\011Y\011\021e\037Z%Z\032Q\030\077\0223\017'\010\033\005"
+ "b\007m\000R\002\077\002,\001\033\372\033\326K\352R\352]\330A\3379\355B\345"
+ "/\3627\354$\365*\363\030M\000M\000U\003M\000M\000M\000M\000M\000M\000M\000"
+ "M\000M\000\3117\305;\322.\332%\344\035\356\023\266+\275'\307!\320\031\335"
+ "\025\351\016\245\030\256\026\274\021\311\015\327\014\346\010\233\015\250"
+ "\014\266\012\302\010\321\006\342\004\037Z&S\311H'Q\376xh\014i\013-KM)G0]"
+ "\030V\037>98@D4\201\077\201@\201@\201\301\201\300\201@\201@\201@\201\300"
+ "\201@\201@\177\221\177o\177o\177\221\177\221\177o\177o\177\221\177\221\177"
+ "o\177o\177o\177\221\177o\177o\177o\177o\000\000\000\000\001\000\002\000\001"
+ "\000\000\000\003\000\001\000\003\000\004\000\001\000\004\000\005\000\001"
+ "\000\005\000\006\000\001\000\006\000\007\000\007\000\006\000\010\000\011"
+ "\000\012\000\013\000\012\000\011\000\014\000\015\000\014\000\016\000\014"
+ "\000\015\000\012\000\017\000\013\000\020\000\013\000\017\000\011\000\021"
+ "\000\022\000\023\000\022\000\021\000\024\000\017\000\025\000\026\000\025"
+ "\000\017\000\027\000\030\000\031\000\032\000\031\000\030\000\033\000\034"
+ "\000\016\000\035\000\016\000\034\000\015\000\036\000\023\000\037\000\023"
+ "\000\036\000\021\000 \000\037\000!\000\037\000 \000\036\000\042\000#\000"
+ "$\000%\000&\000'\000(\000)\000*\000)\000(\000+\000\042\000'\000#\000,\000"
+ "-\000.\000-\000,\000/\000%\0000\000&\0001\0002\0000\0003\0004\0005\0004\000"
+ "3\0006\0007\0008\000$\0008\0007\0009\0006\000:\0004\000:\0006\000;\000\042"
+ "\000%\000'\0001\000<\000=\000(\000>\000+\000>\000(\000\077\000>\000\077\000"
+ "@\000>\000@\000A\000B\000C\000-\0008\000\042\000$\000:\000D\000E\000D\000"
+ ":\000;\000%\0001\0000\000F\000B\000G\0001\000=\0002\000H\000I\000J\000I\000"
+ "H\000K\000I\000K\000L\000I\000L\000M\000M\000L\000N\000N\000L\000O\000:\000"
+ "5\0004\000*\000P\000Q\000P\000*\000R\000R\000*\000)\000S\000T\000U\000T\000"
+ "S\000V\000T\000V\000W\000T\000W\000X\000Y\000Z\000[\000Z\000Y\000\134\000"
+ "]\000^\000_\000O\000`\000N\000a\000-\000/\000-\000a\000B\000B\000a\000H\000"
+ "B\000H\000G\000G\000H\000F\000F\000H\000J\000I\000b\000J\000c\000d\000\134"
+ "\000d\000c\000e\000N\000I\000M\000.\000f\000g\000f\000.\000-\000f\000-\000"
+ "C\000b\000F\000J\000h\000i\000j\000k\000h\000j\000h\000l\000i\000l\000h\000"
+ "m\000n\000o\000p\000o\000n\000q\000p\000e\000c\000e\000p\000r\000r\000p\000"
+ "s\000s\000p\000t\000t\000p\000u\000u\000p\000o\000X\000o\000T\000o\000X\000"
+ "v\000o\000v\000w\000o\000w\000x\000o\000x\000u\000y\000z\000{\000m\000n\000"
+ "l\000n\000m\000q\000|\000q\000m\000q\000|\000}\000T\000q\000}\000q\000T\000"
+ "o\000k\000m\000h\000m\000k\000|\000~\000k\000j\000~\000|\000k\000|\000~\000"
+ "\177\000\177\000}\000|\000}\000\177\000\200\000U\000}\000\200\000}\000U\000"
+ "T\000\201\000~\000j\000\201\000\177\000~\000\177\000\201\000\202\000\202"
+ "\000\200\000\177\000\200\000\202\000\203\000U\000\203\000\204\000\203\000"
+ "U\000\200\000S\000\204\000\205\000\204\000S\000U\000\206\000\207\000\210"
+ "\000\211\000\134\000\207\000\134\000\211\000c\000\212\000c\000\211\000c\000"
+ "\212\000p\000\212\000n\000p\000n\000\212\000\213\000l\000\213\000\214\000"
+ "\213\000l\000n\000i\000\214\000\215\000\214\000i\000l\000i\000\215\000j\000"
+ "\216\000\206\000\217\000\206\000\211\000\207\000\211\000\206\000\216\000"
+ "\220\000\211\000\216\000\211\000\220\000\212\000\221\000\212\000\220\000"
+ "\212\000\221\000\213\000\222\000\213\000\221\000\213\000\222\000\214\000"
+ "\215\000\222\000\223\000\222\000\215\000\214\000\215\000\223\000j\000j\000"
+ "\223\000\224\000\225\000\226\000\227\000\226\000\225\000\230\000\231\000"
+ "\226\000\230\000\226\000\231\000\232\000\233\000\232\000\231\000\232\000"
+ "\233\000\234\000\235\000\234\000\233\000\234\000\235\000\236\000\237\000"
+ "\236\000\235\000\236\000\237\000\224\000j\000\224\000\237\000\025\000\240"
+ "\000\241\000\240\000\025\000\242\000\240\000\242\000\243\000\240\000\243"
+ "\000\244\000\244\000\243\000\245\000\244\000\245\000\246\000\246\000\245"
+ "\000\247\000\246\000\247\000\250\000\250\000\247\000\251\000\251\000\247"
+ "\000\252\000\251\000\252\000\253\000\254\000\225\000\255\000\225\000\254"
+ "\000\230\000\256\000\230\000\254\000\230\000\256\000\231\000\257\000\231"
+ "\000\256\000\231\000\257\000\233\000\260\000\233\000\257\000\233\000\260"
+ "\000\235\000\261\000\235\000\260\000\235\000\261\000\237\000j\000\237\000"
+ "\261\000\254\000\262\000\263\000\262\000\254\000\255\000\256\000\263\000"
+ "\264\000\263\000\256\000\254\000\257\000\264\000\265\000\264\000\257\000"
+ "\256\000\266\000\257\000\265\000\257\000\266\000\260\000\267\000\260\000"
+ "\266\000\260\000\267\000\261\000j\000\261\000\267\000\263\000\270\000\271"
+ "\000\270\000\263\000\262\000\264\000\271\000\272\000\271\000\264\000\263"
+ "\000\265\000\272\000\273\000\272\000\265\000\264\000\274\000\265\000\273"
+ "\000\265\000\274\000\266\000\275\000\266\000\274\000\266\000\275\000\267"
+ "\000j\000\267\000\275\000\271\000\276\000\277\000\276\000\271\000\270\000"
+ "\272\000\277\000\300\000\277\000\272\000\271\000\301\000\272\000\300\000"
+ "\272\000\301\000\273\000\302\000\273\000\301\000\273\000\302\000\274\000"
+ "\303\000\274\000\302\000\274\000\303\000\275\000j\000\275\000\303\000\210"
+ "\000\134\000Y\000\134\000\210\000\207\000\217\000\034\000\035\000\034\000"
+ "\217\000\206\000\304\000\305\000z\000\305\000\304\000\035\000\217\000\035"
+ "\000y\000\225\000\031\000\033\000\031\000\225\000\227\000\306\000\033\000"
+ "\030\000\033\000\306\000\022\000\033\000\022\000\024\000\255\000\033\000"
+ "\024\000\033\000\255\000\225\000\255\000\021\000\262\000\021\000\255\000"
+ "\024\000\262\000\036\000\270\000\036\000\262\000\021\000\270\000 \000\276"
+ "\000 \000\270\000\036\000\035\000\307\000\305\000\032\000\310\000{\000\310"
+ "\000\032\000\031\000\236\000\221\000\234\000\221\000\236\000\222\000\311"
+ "\000\026\000\312\000\026\000\311\000\017\000\227\000\310\000\031\000\310"
+ "\000\227\000\217\000\035\000\313\000\307\000\313\000\035\000\016\000\314"
+ "\000\014\000\011\000\014\000\314\000\315\000\316\000\011\000\017\000\011"
+ "\000\316\000\317\000\314\000\011\000\317\000\016\000\320\000\321\000\320"
+ "\000\016\000\014\000\234\000\220\000\232\000\220\000\234\000\221\000\016"
+ "\000\321\000\313\000\322\000\014\000\315\000\014\000\322\000\320\000\226"
+ "\000\220\000\216\000\220\000\226\000\232\000\316\000\017\000\311\000\224"
+ "\000\222\000\236\000\222\000\224\000\223\000\226\000\217\000\227\000\217"
+ "\000\226\000\216\000\323\000\324\000\325\000\324\000\323\000\326\000\326"
+ "\000\323\000\327\000\326\000\327\000\330\000\326\000\330\000\331\000\331"
+ "\000\330\000\332\000\332\000\330\000\333\000\332\000\333\000\334\000\332"
+ "\000\334\000\335\000\336\000\337\000\340\000\337\000\336\000\341\000\341"
+ "\000\336\000\342\000\341\000\342\000\343\000\341\000\343\000\344\000\341"
+ "\000\344\000\345\000\341\000\345\000\346\000\341\000\346\000\347\000\341"
+ "\000\347\000\350\000\341\000\351\000\352\000\351\000\341\000\350\000\351"
+ "\000\350\000\353\000\351\000\353\000\354\000\351\000\354\000\355\000\351"
+ "\000\355\000\356\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\003\000\004\000\001\000\004\000\004\000\005"
+ "\000\001\000\005\000\005\000\006\000\001\000\006\000\006\000\007\000\001"
+ "\000\007\000\006\000\010\000\007\000\010\000\011\000\012\000\012\000\013"
+ "\000\011\000\013\000\011\000\014\000\012\000\014\000\014\000\015\000\014"
+ "\000\016\000\015\000\016\000\012\000\015\000\013\000\017\000\013\000\020"
+ "\000\017\000\020\000\011\000\017\000\021\000\022\000\022\000\023\000\021"
+ "\000\023\000\021\000\024\000\022\000\024\000\017\000\025\000\025\000\026"
+ "\000\017\000\026\000\020\000\025\000\030\000\031\000\031\000\032\000\030"
+ "\000\032\000\030\000\033\000\031\000\033\000\016\000\034\000\016\000\035"
+ "\000\034\000\035\000\015\000\034\000\023\000\036\000\023\000\037\000\036"
+ "\000\037\000\021\000\036\000\037\000 \000\037\000!\000 \000!\000\036\000"
+ " \000\042\000#\000#\000$\000\042\000$\000%\000&\000&\000'\000%\000'\000\042"
+ "\000(\000\042\000*\000(\000*\000%\000(\000\042\000%\000\042\000'\000#\000"
+ "'\000,\000-\000-\000.\000,\000.\000$\000,\000$\000-\000%\0000\000&\0000\000"
+ "\010\0001\000\010\0000\0000\0001\000\010\0004\0000\0004\000\006\0004\000"
+ ",\0008\000$\0008\000,\0009\0008\0009\000\006\000:\0004\000:\000\005\000:"
+ "\000\001\0001\000\007\0001\000(\0001\000%\0001\000(\000\077\0001\000\077"
+ "\000\002\000\077\000\002\0001\000B\000C\000-\000C\000-\000B\000\042\0008"
+ "\000\004\000:\000\004\000E\000:\000E\000B\000F\000B\000G\000F\000G\000'\000"
+ "I\000I\000J\000'\000J\000&\000I\0000\000I\0000\000M\000I\000M\0000\000N\000"
+ "M\000N\0000\000:\000:\000N\000*\0009\0009\000Q\000*\000Q\000*\0008\000S\000"
+ "T\000T\000U\000S\000U\000C\000S\000C\000T\000B\000T\000G\000T\000\002\000"
+ "Y\000\077\000Y\000Y\000\134\000\002\000\134\000\000\000\134\000E\000N\000"
+ "#\000-\000#\000B\000'\000B\000'\000G\000'\000F\000F\000J\000I\000b\000J\000"
+ "b\000\000\000c\000\134\000c\000\003\000c\000I\000N\000.\000S\000S\000g\000"
+ ".\000g\000-\000S\000F\000b\000h\000i\000i\000j\000h\000j\000h\000k\000j\000"
+ "k\000h\000l\000i\000l\000h\000m\000l\000m\000n\000o\000o\000p\000n\000p\000"
+ "n\000q\000o\000q\000\003\000p\000c\000p\000\004\000p\000E\000p\000N\000p"
+ "\000M\000p\000M\000o\000G\000o\000T\000o\000F\000o\000b\000o\000I\000o\000"
+ "y\000z\000z\000{\000y\000{\000m\000n\000l\000n\000m\000q\000q\000|\000m\000"
+ "|\000|\000}\000q\000}\000T\000q\000T\000}\000k\000m\000k\000|\000k\000~\000"
+ "j\000~\000|\000~\000~\000\177\000|\000\177\000}\000\177\000\177\000\200\000"
+ "}\000\200\000U\000}\000U\000\200\000~\000\201\000j\000\201\000\177\000\201"
+ "\000\201\000\202\000\177\000\202\000\200\000\202\000\202\000\203\000\200"
+ "\000\203\000U\000\203\000\203\000\204\000U\000\204\000S\000\204\000g\000"
+ "\204\000\206\000\207\000\207\000\210\000\206\000\210\000\134\000\211\000"
+ "\134\000\207\000\207\000\211\000c\000\211\000c\000\212\000\211\000\212\000"
+ "p\000\212\000n\000\212\000\212\000\213\000n\000\213\000l\000\213\000\213"
+ "\000\214\000l\000\214\000i\000\214\000\214\000\215\000i\000\215\000j\000"
+ "\215\000\206\000\216\000\206\000\217\000\216\000\217\000\206\000\211\000"
+ "\211\000\216\000\211\000\220\000\216\000\220\000\212\000\220\000\212\000"
+ "\221\000\220\000\221\000\213\000\221\000\213\000\222\000\221\000\222\000"
+ "\214\000\222\000\215\000\222\000\222\000\223\000\215\000\223\000j\000\223"
+ "\000\223\000\224\000j\000\224\000\225\000\226\000\226\000\227\000\225\000"
+ "\227\000\225\000\230\000\226\000\230\000\226\000\231\000\230\000\231\000"
+ "\231\000\232\000\226\000\232\000\232\000\233\000\231\000\233\000\233\000"
+ "\234\000\232\000\234\000\234\000\235\000\233\000\235\000\235\000\236\000"
+ "\234\000\236\000\236\000\237\000\235\000\237\000\224\000\237\000\224\000"
+ "\236\000j\000\237\000\025\000*\000\025\000Q\000\020\000*\000\013\000*\000"
+ "\013\000(\000\012\000(\000\012\000\077\000\015\000\077\000\015\000Y\000\015"
+ "\000\210\000Y\000\210\000\034\000\210\000\034\000\206\000\225\000\254\000"
+ "\225\000\255\000\254\000\255\000\230\000\254\000\230\000\256\000\254\000"
+ "\256\000\231\000\256\000\231\000\257\000\256\000\257\000\233\000\257\000"
+ "\233\000\260\000\257\000\260\000\235\000\260\000\235\000\261\000\260\000"
+ "\261\000\237\000\261\000j\000\261\000\254\000\262\000\262\000\263\000\254"
+ "\000\263\000\255\000\262\000\256\000\263\000\263\000\264\000\256\000\264"
+ "\000\257\000\264\000\264\000\265\000\257\000\265\000\257\000\266\000\265"
+ "\000\266\000\260\000\266\000\260\000\267\000\266\000\267\000\261\000\267"
+ "\000j\000\267\000\263\000\270\000\270\000\271\000\263\000\271\000\262\000"
+ "\270\000\264\000\271\000\271\000\272\000\264\000\272\000\265\000\272\000"
+ "\272\000\273\000\265\000\273\000\265\000\274\000\273\000\274\000\266\000"
+ "\274\000\266\000\275\000\274\000\275\000\267\000\275\000j\000\275\000\271"
+ "\000\276\000\276\000\277\000\271\000\277\000\270\000\276\000\272\000\277"
+ "\000\277\000\300\000\272\000\300\000\272\000\301\000\300\000\301\000\273"
+ "\000\301\000\273\000\302\000\301\000\302\000\274\000\302\000\274\000\303"
+ "\000\302\000\303\000\275\000\303\000j\000\303\000\134\000\210\000\034\000"
+ "\217\000\035\000\217\000y\000\305\000z\000\305\000\035\000y\000\035\000\305"
+ "\000y\000\217\000\031\000\225\000\033\000\225\000\031\000\227\000\033\000"
+ "\306\000\030\000\306\000\022\000\306\000\022\000\033\000\024\000\033\000"
+ "\033\000\255\000\024\000\255\000\021\000\255\000\021\000\262\000\036\000"
+ "\262\000\036\000\270\000 \000\270\000 \000\276\000\035\000\307\000\305\000"
+ "\307\000\032\000y\000\032\000{\000\031\000y\000\221\000\236\000\221\000\234"
+ "\000\222\000\236\000\026\000\311\000\026\000\312\000\311\000\312\000\017"
+ "\000\311\000y\000\227\000\217\000\227\000\035\000\313\000\307\000\313\000"
+ "\016\000\313\000\014\000\314\000\011\000\314\000\314\000\315\000\014\000"
+ "\315\000\011\000\316\000\017\000\316\000\316\000\317\000\011\000\317\000"
+ "\314\000\317\000\016\000\320\000\320\000\321\000\016\000\321\000\014\000"
+ "\320\000\220\000\234\000\220\000\232\000\313\000\321\000\014\000\322\000"
+ "\315\000\322\000\320\000\322\000\220\000\226\000\216\000\226\000\311\000"
+ "\316\000\222\000\224\000\217\000\226\000\037\000\324\000!\000\324\000\037"
+ "\000\326\000\324\000\326\000\023\000\326\000\022\000\326\000\022\000\331"
+ "\000\326\000\331\000\022\000{\000{\000\331\000{\000\306\000\030\000{\000"
+ "z\000\331\000z\000\341\000\331\000\341\000\305\000\341\000\307\000\341\000"
+ "\313\000\341\000\321\000\341\000\320\000\341\000\322\000\341\000\315\000"
+ "\341\000\312\000\341\000\312\000\352\000\341\000\352\000\312\000\315\000"
+ "\312\000\314\000\312\000\317\000\312\000\316\000\243\326X\376|:\000\000\305"
+ "\376X\376\012R\000\000\325\335X\376\0321\000\000\002\322X\376\251E\000\000"
+ "m\320X\376\247Q\000\000\002\322X\376\246]\000\000\020-X\376\012R\000\000"
+ "\211+X\376\246]\000\000\243\326X\376\323h\000\000\347&X\376\323h\000\000"
+ "\000\336X\376lr\000\000\212\037X\376lr\000\0008\336X\376\227r\000\000\361"
+ "\025X\376\312y\000\000\231\347X\376\312y\000\000\307\362X\376k~\000\000\304"
+ "\012X\376k~\000\000\305\376X\376\377\177\000\0009,X\376\247K\000\000\325"
+ "\335\371\334\0321\000\000A\301u\355\206\024\000\000\375\276\371\334B\022"
+ "\000\000\335\307\255\374\042\033\000\000A\322~\011\206%\000\000\325\335X"
+ "\376\0321\000\000\224\337\000\023\3312\000\000\305\376X\376\012R\000\000"
+ "\313\356\233\030\020B\000\000\305\376\006\032\012R\000\000A\301u\355\206"
+ "\024\000\000\231\273\371\334-\303\000\000\375\276\371\334B\022\000\000\314"
+ "\275b\356\373\300\000\000{\334^\030K\242\000\000\313\356\233\030\020B\000"
+ "\000\327\354\346\037\360\221\000\000\224\337\000\023\3312\000\000\335\307"
+ "\255\374\042\033\000\000F\304\277\376\200\272\000\000A\322~\011\206%\000"
+ "\000\261\316\015\015\025\260\000\000\314\275b\356\373\300\000\000J\327\371"
+ "\334|\247\000\000\231\273\371\334-\303\000\000J\327-\005|\247\000\000F\304"
+ "\277\376\200\272\000\000\261\316\015\015\025\260\000\000\305\376-\005\001"
+ "\200\000\000\305\376\007#\001\200\000\000{\334^\030K\242\000\000\327\354"
+ "\346\037\360\221\000\000\243\326X\376|:\000\000\325\335\371\334\0321\000"
+ "\000\243\326\371\334|:\000\000\325\335X\376\0321\000\000\231\347\371\334"
+ "\312y\000\000\307\362X\376k~\000\000\231\347X\376\312y\000\000\307\362\371"
+ "\334k~\000\000m\320X\376\247Q\000\000\002\322\371\334\251E\000\000m\320\371"
+ "\334\247Q\000\000\002\322X\376\251E\000\000\002\322X\376\246]\000\000z\320"
+ "\371\334\012R\000\000\002\322\371\334\246]\000\000\000\336X\376lr\000\000"
+ "\243\326\371\334\323h\000\000\000\336\371\334lr\000\000\243\326X\376\323"
+ "h\000\0008\336X\376\227r\000\000\211+X\376\246]\000\000\347&\371\334\323"
+ "h\000\000\211+\371\334\246]\000\000\347&X\376\323h\000\000\305\376\371\334"
+ "\377\177\000\000\304\012X\376k~\000\000\305\376X\376\377\177\000\000\304"
+ "\012\371\334k~\000\000\361\025\371\334\312y\000\000\361\025X\376\312y\000"
+ "\000\020-X\376\012R\000\000\020-\371\334\012R\000\000\212\037\371\334lr\000"
+ "\000\212\037X\376lr\000\000\305\376\007#\001\200\000\000\2275-\005\265\207"
+ "\000\000\305\376-\005\001\200\000\000\337\020\211 \214\202\000\000\261!u"
+ "\031\351\204\000\000\0300L\016\360\206\000\000\0173h\012Z\207\000\000\037"
+ ";\321\377|\210\000\000\2275\371\334\265\207\000\000gD\371\334\312\211\000"
+ "\000\013B\000\357u\211\000\000\230\016\011\030\321O\000\000\261!u\031\351"
+ "\204\000\000\337\020\211 \214\202\000\000c\035\001\022\274M\000\000\037;"
+ "\321\377|\210\000\000\037*T\010\362K\000\000\3533\251\373\222J\000\000\017"
+ "3h\012Z\207\000\000\0300L\016\360\206\000\000gD\371\334\312\211\000\000\025"
+ ":\336\354\264I\000\0000<\371\334hI\000\000\013B\000\357u\211\000\0009,\371"
+ "\334\247K\000\0009,X\376\247K\000\0000<\371\334hI\000\0009,X\376\247K\000"
+ "\0009,\371\334\247K\000\000\3533\251\373\222J\000\000\025:\336\354\264I\000"
+ "\000\305\376\006\032\012R\000\000\305\376X\376\012R\000\000\230\016\011\030"
+ "\321O\000\000c\035\001\022\274M\000\000\037*T\010\362K\000\000\305\376\006"
+ "\032\012R\000\000\305\376\007#\001\200\000\000\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\301\000\300\000\300"
+ "\000\300\000\301\000\301\000\301\000\301\000\301\000\301\000\234\026\224"
+ "\016\224\016\243\035\326Q\343]\352d\320K\257*\2650\300;\305@\201\077\201"
+ "\301\201\301\201@\201\077\201@\201@\201@\201@\201@\201\317\2017\201\325\201"
+ "7\320\000\345\000\322\000\345\000\201\000\201\351\201\000\201\342\230\000"
+ "\220\000\237\000\301\000\262\000\300\000\254\000\311\000a\000T\000h\000N"
+ "\000\000\000\033\000\000\000\033\000+\0001\000\177\000\177\000\077\000@\000"
+ "\177o\177o\177\221\177o\177\221\177o\177o\177o\177o\177o\177o\035]*Q\026"
+ "d0KK0B:Q*F6;@l\016d\026l\016]\035\177\017\177\017\020\000\020\000\020\000"
+ "\020\000\020\000\020\000\020\000\020\000\020\000\020\000\000z\000z\000\000"
+ "\000\000\001\000\002\000\001\000\000\000\003\000\001\000\003\000\004\000"
+ "\001\000\004\000\005\000\001\000\005\000\006\000\006\000\005\000\007\000"
+ "\007\000\005\000\010\000\007\000\010\000\011\000\011\000\010\000\012\000"
+ "\011\000\012\000\013\000\013\000\012\000\014\000\013\000\014\000\015\000"
+ "\015\000\014\000\016\000\015\000\016\000\017\000\015\000\017\000\020\000"
+ "\020\000\017\000\021\000\006\000\022\000\001\000\023\000\024\000\025\000"
+ "\024\000\023\000\026\000\026\000\023\000\027\000\027\000\023\000\030\000"
+ "\027\000\030\000\031\000\031\000\030\000\032\000\031\000\032\000\033\000"
+ "\033\000\032\000\034\000\035\000\036\000\037\000\036\000\035\000 \000!\000"
+ "\042\000#\000\042\000!\000$\000%\000 \000\035\000 \000%\000&\000'\000&\000"
+ "%\000&\000'\000(\000)\000*\000+\000*\000)\000,\000,\000)\000-\000,\000-\000"
+ ".\000,\000.\000/\000/\000.\0000\0000\000.\0001\0000\0001\0002\000(\000$\000"
+ "!\000$\000(\000'\0003\0004\0005\0004\0003\0006\0007\0008\0009\0008\0007\000"
+ ":\000;\000<\000=\000<\000;\000>\000>\0005\000<\0005\000>\0003\000\077\000"
+ "@\000A\000@\000;\000=\000;\000@\000\077\000B\000C\000D\000C\000B\000E\000"
+ "7\000B\000D\000B\0007\000F\000F\0007\0009\000E\000A\000C\000A\000E\000\077"
+ "\000G\000H\000I\000H\000G\000J\000K\000L\000M\000L\000K\000N\000O\000L\000"
+ "N\000L\000O\000P\000Q\000I\000R\000I\000Q\000G\000K\0008\000:\0008\000K\000"
+ "M\000S\000P\000O\000P\000S\000T\000J\000S\000H\000S\000J\000T\000U\000V\000"
+ "W\000V\000U\000X\000V\000X\000Y\000V\000Y\000Z\000V\000Z\000[\000V\000[\000"
+ "\134\000V\000\134\000]\000]\000\134\000^\000^\000\134\000_\000`\000a\000"
+ "b\000a\000`\000c\000d\000e\000f\000e\000d\000g\000e\000g\000h\000i\000j\000"
+ "k\000j\000i\000l\000c\000h\000a\000h\000c\000e\000l\000f\000j\000f\000l\000"
+ "d\000m\000Q\000R\000Q\000m\000n\000o\000p\000q\000p\000o\000r\000r\000o\000"
+ "s\000p\000t\000u\000t\000p\000v\000v\000p\000w\000w\000p\000x\000x\000p\000"
+ "r\000y\000b\000z\000b\000y\000`\000#\000y\000z\000y\000#\000\042\000\000"
+ "\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001"
+ "\000\003\000\003\000\004\000\001\000\004\000\004\000\005\000\001\000\005"
+ "\000\005\000\006\000\001\000\006\000\005\000\007\000\006\000\007\000\005"
+ "\000\010\000\007\000\010\000\010\000\011\000\007\000\011\000\010\000\012"
+ "\000\011\000\012\000\012\000\013\000\011\000\013\000\012\000\014\000\013"
+ "\000\014\000\014\000\015\000\013\000\015\000\014\000\016\000\015\000\016"
+ "\000\016\000\017\000\015\000\017\000\017\000\020\000\015\000\020\000\017"
+ "\000\021\000\020\000\021\000\006\000\022\000\001\000\022\000\023\000\024"
+ "\000\024\000\025\000\023\000\025\000\023\000\026\000\024\000\026\000\023"
+ "\000\027\000\026\000\027\000\002\000\023\000\002\000\027\000\002\000\031"
+ "\000\027\000\031\000\001\000\031\000\001\000\033\000\031\000\033\000\001"
+ "\000\034\000\033\000\034\000\024\000\036\000\025\000\036\000\024\000 \000"
+ "\036\000 \000\033\000!\000\033\000#\000!\000#\000\031\000!\000\026\000 \000"
+ "\026\000&\000 \000&\000\027\000&\000\027\000(\000&\000(\000 \000*\000\036"
+ "\000*\000 \000,\000*\000,\000&\000,\000(\000,\000(\000/\000,\000/\000(\000"
+ "0\000/\0000\000!\000(\000!\0000\000#\0000\000\031\000(\000\000\000\023\000"
+ "\023\0005\000\000\0005\000\017\0007\000\016\0007\0007\000:\000\017\000:\000"
+ "\004\000<\000<\000=\000\004\000=\000\003\000<\000\003\0005\0005\000<\000"
+ "\005\000@\000@\000A\000\005\000A\000\004\000@\000=\000@\000\012\000C\000"
+ "C\000D\000\012\000D\000\010\000C\000\012\0007\0007\000D\000\014\0007\000"
+ "\010\000A\000A\000C\000\007\000H\000H\000I\000\007\000I\000\011\000H\000"
+ "\020\000K\000\021\000K\000K\000N\000\020\000N\000\020\000O\000N\000O\000"
+ "\015\000O\000\006\000I\000I\000R\000\006\000R\000\017\000K\000:\000K\000"
+ "\015\000S\000O\000S\000\013\000S\000\011\000S\000H\000S\0000\000V\000/\000"
+ "V\0000\000X\000V\000X\000X\000Y\000V\000Y\000Y\000Z\000V\000Z\000Z\000[\000"
+ "V\000[\000[\000\134\000V\000\134\000\134\000]\000V\000]\000\134\000^\000"
+ "]\000^\000\134\000_\000^\000_\000Y\000`\000X\000`\000`\000c\000Y\000c\000"
+ "\134\000e\000e\000f\000\134\000f\000[\000e\000Z\000e\000^\000j\000j\000k"
+ "\000^\000k\000_\000j\000Z\000c\000c\000e\000_\000f\000f\000j\000\006\000"
+ "m\000R\000m\000\022\000m\000\022\000k\000k\000m\000f\000k\000\022\000f\000"
+ "\022\000\034\000\022\000`\000\034\000`\000\022\000c\000\022\000e\000\034"
+ "\000X\000\034\0000\000\034\000#\000\330\363#\342e~\000\000=\353\276\352\262"
+ "y\000\000\344\350\022\345\262y\000\000\017\365\022\345e~\000\000\231\377"
+ "\375\336\377\177\000\000\376\366\230\347e~\000\000#\012\022\345e~\000\000"
+ "9\020\234\357\262y\000\0004\010\230\347e~\000\000\365\023\276\352\262y\000"
+ "\000/\322(\353\372P\000\000A\327H\366\264M\000\000f\322\031\353GO\000\000"
+ "\341\326\177\366\372P\000\000\310\336\316\377^L\000\000\027\350\265\007\372"
+ "P\000\000v\350\020\007XK\000\000Z\336<\000\372P\000\000\316\342\310\373}"
+ "h\000\000D\330\262\365&]\000\000V\334Y\363}h\000\000|\337\032\377&]\000\000"
+ "\277\002\276\352e~\000\000\231\377(\353e~\000\000\316\342\234\357:r\000\000"
+ "|\337\230\347:r\000\000\316\342\310\373x9\000\000\007\341\243\360h2\000\000"
+ "V\334Y\363x9\000\000\325\342\077\36564\000\000\252\344\354\371\0136\000\000"
+ "Z\336\375\336:r\000\000D\330\207\351}h\000\000\341\326\375\336}h\000\000"
+ "D\330\262\365\317D\000\000|\337\032\377\317D\000\000\203\371\207\351e~\000"
+ "\000\265\0130\014GO\000\000\033\027\265\007\372P\000\000\344\026U\007\264"
+ "M\000\000\304\013g\014\372P\000\000\231\377g\014&]\000\000\231\377\001\016"
+ "\372P\000\000Z\013\333\012&]\000\0004\010\032\377:r\000\000\231\377\265\007"
+ "}h\000\000\231\377<\000:r\000\000#\012R\006}h\000\000\257\005\262\365\262"
+ "y\000\000\231\377\177\366\262y\000\000\257\005\207\351e~\000\000\027\350"
+ "\177\366:r\000\000\027\350\326\377x9\000\000N\026R\006&]\000\000\365\023"
+ "@\002}h\000\000\263\3520\003\024<\000\000\344\350R\006\317D\000\000n\363"
+ "\375\336e~\000\000\027\350\375\336\262y\000\0009\020\310\373:r\000\000Z\013"
+ "Y\363\262y\000\000\273\323\276\352&]\000\000\376\366\032\377:r\000\000\017"
+ "\365R\006}h\000\000\330\363Y\363\262y\000\000\371\356\234\357\262y\000\000"
+ "\344\350R\006&]\000\000=\353@\002}h\000\000\304\013\375\336e~\000\000N\026"
+ "\022\345\262y\000\000Z\013#\342e~\000\000\033\027\375\336\262y\000\000\330"
+ " \375\336:r\000\000\356&\207\351}h\000\000\266\037\230\347:r\000\000Q(\375"
+ "\336}h\000\000d\034\234\357:r\000\000d\034\310\373}h\000\000\033\027\177"
+ "\366:r\000\000\335\042Y\363}h\000\000\004-(\353\372P\000\000\004-\375\336"
+ "&]\000\000\236.\375\336\372P\000\000w+\276\352&]\000\000\266\037\032\377"
+ "&]\000\000\356&\262\365&]\000\000D\330\207\351x9\000\000Z\336\375\336\273"
+ "/\000\000\341\326\375\336x9\000\000\000\337\271\347b0\000\000/\322\375\336"
+ "\317D\000\000\273\323\276\352\317D\000\000/\322\375\336&]\000\000n\363g\014"
+ "\372P\000\000\244\363\233\013\265J\000\000\371\356\310\373:r\000\000\203"
+ "\371\262\365\262y\000\000\330\363\333\012&]\000\000s\374\276\352e~\000\000"
+ "n\363\257\012\317D\000\000:\371T\014\233J\000\000\330 <\000\372P\000\000"
+ "\314,\031\353GO\000\000j \316\377^L\000\000Q(\177\366\372P\000\000\362'H"
+ "\366\264M\000\000F\311\213\355\001\200\000\000\230\377\375\336\001\200\000"
+ "\000\134\307\375\336\001\200\000\000\344\316\033\373\001\200\000\000\324"
+ "\327\301\006\001\200\000\000z\343\260\017\001\200\000\000\012\361O\025\001"
+ "\200\000\000\230\3779\027\001\200\000\000\235\377\375\336\001\200\000\000"
+ "&\016O\025\001\200\000\000\345\377\375\336\001\200\000\000\3247\375\336\001"
+ "\200\000\000\266\033\260\017\001\200\000\000\134'\301\006\001\200\000\000"
+ "L0\033\373\001\200\000\000\3525\213\355\001\200\000\000\224\320\375\336\372"
+ "P\000\000\274\026\020\007XK\000\000\216\013\233\013\265J\000\000\231\377"
+ "'\015}J\000\000\255' \366XK\000\000\204\350\370\006}J\000\000\324\363\350"
+ "\0126E\000\000\246\363\224\013}J\000\000\364\336\241\377}J\000\000\002\323"
+ "\360\352}J\000\000D\330\262\365\317D\000\000A\327H\366\264M\000\000\236\327"
+ "\022\366}J\000\000o\321\375\336}J\000\000\273\323\276\352\317D\000\000f\322"
+ "\031\353GO\000\000\002\323\360\352}J\000\000\255' \366XK\000\000O.\264\015"
+ "jJ\000\000j \316\377^L\000\0007,\361\352\265J\000\000\303-\375\336}J\000"
+ "\000\236A\375\336\263G\000\000\3128\002\000\361H\000\000`\077\024\360\004"
+ "H\000\000\236\327\022\366}J\000\000|\337\032\377\317D\000\000\310\336\316"
+ "\377^L\000\000\364\336\241\377}J\000\0007,\361\352\265J\000\000\303-\375"
+ "\336}J\000\000Z\336\375\336\273/\000\000\223\300\340\357\364\021\000\000"
+ "b\276\375\336\303\017\000\000\002\307\250\377d\030\000\000N\314\256\006\257"
+ "\035\000\000J\321K\015\253\042\000\000\301\336\337\027\0420\000\000\000\337"
+ "\271\347b0\000\000\007\341\243\360h2\000\000\211\356\247\036\352\077\000"
+ "\000\325\342\077\36564\000\000\252\344\354\371\0136\000\000\027\350\326\377"
+ "x9\000\000\263\3520\003\024<\000\000n\363\257\012\317D\000\000|\366\321\037"
+ "\336G\000\000\324\363\350\0126E\000\000:\371T\014\233J\000\000:\371T\014"
+ "\233J\000\000\230\377\003!\263G\000\000|\366\321\037\336G\000\000\231\377"
+ "'\015}J\000\000\257\020\304\036\004H\000\000\216\013\233\013\265J\000\000"
+ "\274\026\020\007XK\000\000\236 /\030\361H\000\000F\311\213\355\001\200\000"
+ "\000\134\307\375\336\001\200\000\000b\276\375\336\303\017\000\000\223\300"
+ "\340\357\364\021\000\000J\321K\015\253\042\000\000z\343\260\017\001\200\000"
+ "\000\324\327\301\006\001\200\000\000\301\336\337\027\0420\000\000\012\361"
+ "O\025\001\200\000\000\211\356\247\036\352\077\000\000\344\316\033\373\001"
+ "\200\000\000\002\307\250\377d\030\000\000\134'\301\006\001\200\000\000\312"
+ "8\002\000\361H\000\000L0\033\373\001\200\000\000O.\264\015jJ\000\000\236"
+ " /\030\361H\000\000\266\033\260\017\001\200\000\000\230\3779\027\001\200"
+ "\000\000\230\377\003!\263G\000\000|\366\321\037\336G\000\000N\314\256\006"
+ "\257\035\000\000&\016O\025\001\200\000\000\257\020\304\036\004H\000\000`"
+ "\077\024\360\004H\000\000\3525\213\355\001\200\000\000\236A\375\336\263G"
+ "\000\000\3247\375\336\001\200\000\000\346\010\335\025\327\014\351\016\000"
+ "\012\356\023\027\016\034\035\022\023#\025\237\036\2536\230#\2621\274F\317"
+ "N\315W\301\077\322-\275'\305\036\3117\006\033\000\033\322\033\311\017\253"
+ "P\241M\237D\245P\252V\302\010\272\020\266\012\247:\266I\363\030(c+T7S\030"
+ "d\000d\371}\026R\0167\002N\000=\025B\013*\000+\015\030\333%\266W'C#7\275"
+ "Y\304V\342\004\321\006\033/\024$\256\026\3627\356D\354$\344\035\331C\337"
+ "9\036\004)\014\032\010/\006>\010D\0207\017M\012.\033/+%%;\036a\034^\014q"
+ "\025P\02555C'\2219\212<\2135\224C\215$\2300\250\014\342a\335i\345/\365*\352"
+ "R\372\033\316_\346r=Be&FCN1V4\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\220\0173W!j\361\177W3\314V\330c\332e\303M\243-\327\253\327\253"
+ "\327\253\216\032\341\237\341\237\341\237\020\000\015\003\005\012\020\000"
+ "\020\000\020\000\020\000\020\000\263=\311\271\311\271\311\271j!r\032\301"
+ "\000\300\000\300\000\300\000\301\000\301\000\301\000\301\000\300\000\300"
+ "\000\301\000\301\000\301\000\300\000\300\000\301\000\301\000\301\000\000"
+ "\020\000\020\000\020\000\020\000\020\000\020\000\020\000\020\227\034\217"
+ "\025\217\025\237$\302F\314P\273\077\323W\337c\350l\253/\2615BBO4U.BB4O.U"
+ "\366z\005\177\360p\270;\033i\042bb\042i\033q\023q\023\000\000\000\000\001"
+ "\000\002\000\001\000\000\000\003\000\004\000\005\000\003\000\006\000\007"
+ "\000\010\000\007\000\006\000\011\000\012\000\013\000\014\000\013\000\012"
+ "\000\015\000\016\000\017\000\020\000\017\000\016\000\021\000\022\000\023"
+ "\000\024\000\023\000\022\000\025\000\015\000\016\000\013\000\016\000\015"
+ "\000\021\000\026\000\027\000\004\000\002\000\030\000\031\000\030\000\002"
+ "\000\001\000\032\000\033\000\034\000\033\000\032\000\035\000\035\000\032"
+ "\000\036\000\037\000 \000!\000 \000\037\000\031\000\042\000\032\000\034\000"
+ "\032\000\042\000#\000\004\000$\000\005\000%\000&\000'\000&\000%\000(\000"
+ ")\000(\000*\000(\000)\000+\000,\000-\000.\000-\000,\000/\0000\000.\0001\000"
+ ".\0000\000,\000\026\0001\000\027\0001\000\026\0000\000-\000+\000)\000+\000"
+ "-\000/\0002\000\026\000\004\000\030\000\022\000\024\000\022\000\030\0003"
+ "\0004\000\036\000\032\000+\000&\000(\000&\000+\0005\000/\0005\000+\0005\000"
+ "/\0006\000#\0004\000\032\0004\000#\0007\0007\000#\0008\0009\000\002\000:"
+ "\000\002\0009\000\000\000;\000/\000,\000/\000;\0006\000<\000,\0000\000,\000"
+ "<\000;\000\004\000\003\000\000\000\023\000\012\000=\000\012\000\023\000\015"
+ "\000>\000-\000\077\000-\000>\000.\000\005\000@\000A\000@\000\005\000$\000"
+ "\010\0002\000\004\000\022\000B\000\025\000B\000\022\000C\000D\000E\000F\000"
+ "E\000D\000G\000H\000I\000J\000I\000H\000K\000L\000M\000N\000M\000L\000O\000"
+ "P\000Q\000R\000Q\000P\000S\000\011\000N\000\007\000N\000\011\000L\000F\000"
+ "\006\000\004\000\010\000<\0002\000<\000\010\000\007\000G\000J\000E\000J\000"
+ "G\000H\000\006\000\010\000\004\0006\000T\0005\000T\0006\000M\000S\000O\000"
+ "I\000O\000S\000U\0002\0000\000\026\0000\0002\000<\000V\000W\000X\000W\000"
+ "V\000Y\000Z\000V\000X\000V\000Z\000[\000 \000\134\000!\000\134\000 \000="
+ "\000\020\000]\000^\000]\000\020\000\017\000\024\000=\000 \000=\000\024\000"
+ "\023\000\031\000\024\000 \000\024\000\031\000\030\0003\000C\000\022\000C"
+ "\0003\000_\000\025\000\017\000\021\000\017\000\025\000B\000A\000_\0003\000"
+ "_\000A\000@\000\034\000Y\000V\000Y\000\034\000\033\000\003\000A\000\001\000"
+ "A\000\003\000\005\000\001\0003\000\030\0003\000\001\000A\000[\000\034\000"
+ "V\000\034\000[\000\042\000:\000\031\000\037\000\031\000:\000\002\000\025"
+ "\000\015\000\023\000\015\000\025\000\021\000`\000.\000>\000.\000`\0001\000"
+ "\077\000)\000a\000)\000\077\000-\000a\000*\000]\000*\000a\000)\000$\000`"
+ "\000@\000`\000$\000b\000@\000>\000_\000>\000@\000`\000_\000\077\000C\000"
+ "\077\000_\000>\000\004\000\027\000b\000\004\000b\000$\000c\0007\0008\000"
+ "\004\000\000\0009\000^\000*\000d\000*\000^\000]\000C\000a\000B\000a\000C"
+ "\000\077\000B\000]\000\017\000]\000B\000a\0005\000e\000&\000e\0005\000T\000"
+ "P\000R\000f\000D\000F\000\004\000g\000h\000i\000h\000g\000e\000(\000%\000"
+ "*\000b\0001\000`\0001\000b\000\027\000'\000e\000g\000e\000'\000&\000h\000"
+ "T\000U\000T\000h\000e\000\007\000;\000<\000;\000\007\000N\000U\000M\000O"
+ "\000M\000U\000T\000P\000U\000S\000U\000P\000h\000i\000P\000f\000P\000i\000"
+ "h\000J\000O\000L\000O\000J\000I\000N\0006\000;\0006\000N\000M\000E\000L\000"
+ "\011\000L\000E\000J\000F\000\011\000\006\000\011\000F\000E\000S\000K\000"
+ "Q\000K\000S\000I\000j\000k\000l\000k\000j\000m\000k\000m\000n\000k\000n\000"
+ "o\000k\000o\000p\000k\000p\000q\000k\000q\000r\000r\000q\000s\000r\000s\000"
+ "t\000t\000s\000u\000u\000s\000v\000u\000v\000w\000u\000w\000x\000u\000x\000"
+ "y\000=\000z\000\134\000z\000=\000\012\000\012\000\014\000z\000%\000{\000"
+ "|\000{\000%\000'\000'\000g\000{\000*\000}\000d\000*\000|\000}\000|\000*\000"
+ "%\000g\000i\000~\000\177\000c\0008\000c\000\177\000\200\000\200\000\177\000"
+ "\201\000\201\000\177\000\020\000\201\000\020\000^\000\202\0008\000#\0008"
+ "\000\202\000\177\000\177\000\202\000\016\000\177\000\016\000\020\000\203"
+ "\000\042\000[\000\042\000\203\000\014\000\042\000\014\000\013\000\204\000"
+ "\205\000\206\000\014\000\207\000z\000\207\000\014\000Z\000Z\000\014\000["
+ "\000\210\000\211\000\212\000\213\000\214\000\215\000\214\000\213\000\216"
+ "\000\214\000\216\000\217\000\214\000\217\000\220\000\214\000\220\000\221"
+ "\000\221\000\220\000\222\000\223\000#\000\042\000#\000\223\000\013\000#\000"
+ "\013\000\016\000\224\000\225\000\226\000\227\000R\000\230\000R\000\227\000"
+ "f\000\231\000\232\000\233\000\232\000\231\000\234\000\234\000\231\000\235"
+ "\000\235\000\231\000\236\000\236\000\231\000\237\000\237\000\231\000\240"
+ "\000\237\000\240\000\241\000\237\000\241\000\242\000\242\000\241\000\243"
+ "\000\242\000\243\000\244\000\242\000\244\000\245\000\242\000\245\000\246"
+ "\000\242\000\246\000\247\000\242\000\247\000\250\000\250\000\247\000\251"
+ "\000\250\000\251\000\252\000~\000f\000\227\000f\000~\000i\000\201\000d\000"
+ "\200\000d\000\201\000^\000\253\000\254\000\255\000\254\000\253\000\256\000"
+ "\254\000\256\000\257\000\257\000\256\000\260\000\257\000\260\000\261\000"
+ "\257\000\261\000\262\000\262\000\261\000\215\000\262\000\215\000\214\000"
+ "\263\000\264\000\265\000\266\000\263\000\265\000\267\000\270\000\271\000"
+ "\272\000\270\000\267\000\272\000\273\000\270\000\274\000\273\000\272\000"
+ "\275\000\263\000\266\000\276\000\275\000\266\000\277\000\300\000\301\000"
+ "\302\000\300\000\277\000\271\000\275\000\276\000\303\000\277\000\304\000"
+ "\302\000\277\000\303\000\274\000\305\000\273\000\306\000\305\000\274\000"
+ "\307\000\306\000\274\000\310\000\271\000\276\000\271\000\310\000\267\000"
+ "\306\000\311\000\305\000\311\000\306\000\312\000\301\000\313\000\314\000"
+ "\300\000\313\000\301\000\312\000\304\000\311\000\303\000\304\000\312\000"
+ "\314\000\315\000\316\000\315\000\314\000\313\000\000\000\000\000\001\000"
+ "\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003\000\004\000"
+ "\005\000\003\000\005\000\003\000\004\000\006\000\007\000\007\000\010\000"
+ "\006\000\010\000\006\000\011\000\007\000\011\000\012\000\013\000\013\000"
+ "\014\000\012\000\014\000\012\000\015\000\013\000\015\000\016\000\017\000"
+ "\017\000\020\000\016\000\020\000\016\000\021\000\017\000\021\000\022\000"
+ "\023\000\023\000\024\000\022\000\024\000\022\000\025\000\023\000\025\000"
+ "\015\000\016\000\013\000\016\000\015\000\021\000\026\000\027\000\004\000"
+ "\027\000\004\000\026\000\002\000\030\000\030\000\031\000\002\000\031\000"
+ "\001\000\030\000\032\000\033\000\033\000\034\000\032\000\034\000\032\000"
+ "\035\000\033\000\035\000\032\000\036\000\035\000\036\000\037\000 \000 \000"
+ "!\000\037\000!\000\031\000\037\000\031\000 \000\032\000\042\000\034\000\042"
+ "\000\042\000#\000\032\000#\000\004\000$\000\005\000$\000%\000&\000&\000'"
+ "\000%\000'\000%\000(\000&\000(\000(\000)\000(\000*\000)\000*\000)\000+\000"
+ "(\000+\000,\000-\000-\000.\000,\000.\000,\000/\000-\000/\000.\0000\000.\000"
+ "1\0000\0001\000,\0000\000\026\0001\000\027\0001\000\026\0000\000+\000-\000"
+ ")\000-\000+\000/\000\026\0002\000\004\0002\000\022\000\030\000\024\000\030"
+ "\000\030\0003\000\022\0003\000\036\0004\000\032\0004\000&\000+\000+\0005"
+ "\000&\0005\000/\0005\000/\0006\0005\0006\000#\0004\000#\0007\0004\0007\000"
+ "#\0008\0007\0008\000\002\0009\000\002\000:\0009\000:\000\000\0009\000/\000"
+ ";\000,\000;\0006\000;\000,\000<\0000\000<\000;\000<\000\000\000\004\000\012"
+ "\000\023\000\012\000=\000\023\000=\000\015\000\023\000-\000>\000-\000\077"
+ "\000>\000\077\000.\000>\000\005\000@\000@\000A\000\005\000A\000$\000@\000"
+ "\010\0002\000\004\000\010\000\022\000B\000\025\000B\000\022\000C\000B\000"
+ "C\000D\000E\000E\000F\000D\000F\000D\000G\000E\000G\000H\000I\000I\000J\000"
+ "H\000J\000H\000K\000I\000K\000L\000M\000M\000N\000L\000N\000L\000O\000M\000"
+ "O\000P\000Q\000Q\000R\000P\000R\000P\000S\000Q\000S\000\011\000N\000\007"
+ "\000N\000\011\000L\000\006\000F\000\004\000\006\000\004\000F\000\010\000"
+ "<\0002\000<\000\007\000<\000G\000J\000E\000J\000G\000H\0006\000T\0005\000"
+ "T\0006\000M\000M\000T\000O\000S\000I\000O\000I\000S\000S\000U\000O\000U\000"
+ "0\0002\000V\000W\000W\000X\000V\000X\000V\000Y\000W\000Y\000V\000Z\000X\000"
+ "Z\000Z\000[\000V\000[\000 \000\134\000!\000\134\000 \000=\000=\000\134\000"
+ "\020\000]\000]\000^\000\020\000^\000\017\000]\000\024\000=\000\024\000 \000"
+ "\024\000\031\0003\000C\0003\000_\000C\000_\000\017\000\025\000\021\000\025"
+ "\000\017\000B\000A\000_\0003\000A\000@\000_\000\034\000Y\000\034\000V\000"
+ "\033\000Y\000\003\000A\000\001\000A\000\001\0003\000\034\000[\000\042\000"
+ "[\000\031\000:\000\037\000:\000\015\000\025\000.\000`\000>\000`\0001\000"
+ "`\000)\000\077\000)\000a\000\077\000a\000*\000a\000*\000]\000]\000a\000$"
+ "\000`\000@\000`\000$\000b\000`\000b\000>\000@\000>\000_\000\077\000_\000"
+ "\077\000C\000\027\000b\000\004\000b\0007\000c\0008\000c\000\004\0009\000"
+ "*\000^\000*\000d\000^\000d\000C\000a\000B\000a\000B\000]\0005\000e\000&\000"
+ "e\000T\000e\000R\000f\000P\000f\000\004\000D\000g\000h\000h\000i\000g\000"
+ "i\000e\000g\000e\000h\000%\000*\0001\000b\000'\000e\000'\000g\000T\000h\000"
+ "T\000U\000U\000h\000\007\000;\000;\000N\000M\000U\000P\000U\000P\000h\000"
+ "P\000i\000f\000i\000J\000O\000J\000L\0006\000N\000E\000L\000\011\000E\000"
+ "\011\000F\000K\000S\000K\000Q\000j\000k\000k\000l\000j\000l\000j\000m\000"
+ "k\000m\000m\000n\000k\000n\000n\000o\000k\000o\000o\000p\000k\000p\000p\000"
+ "q\000k\000q\000q\000r\000k\000r\000q\000s\000r\000s\000s\000t\000r\000t\000"
+ "s\000u\000t\000u\000s\000v\000u\000v\000v\000w\000u\000w\000w\000x\000u\000"
+ "x\000x\000y\000u\000y\000=\000z\000\134\000z\000\012\000z\000\014\000z\000"
+ "%\000{\000{\000|\000%\000|\000'\000{\000g\000{\000*\000}\000d\000}\000*\000"
+ "|\000|\000}\000i\000~\000g\000~\000c\000\177\0008\000\177\000\177\000\200"
+ "\000c\000\200\000\177\000\201\000\200\000\201\000\020\000\177\000\020\000"
+ "\201\000^\000\201\0008\000\202\000#\000\202\000\177\000\202\000\016\000\202"
+ "\000\016\000\177\000\042\000\203\000[\000\203\000\014\000\203\000\014\000"
+ "\042\000\013\000\042\000\013\000\206\000\042\000\206\000\014\000\207\000"
+ "z\000\207\000\014\000Z\000Z\000\207\000\014\000[\000~\000\214\000g\000\214"
+ "\000~\000\216\000\214\000\216\000\216\000\217\000\214\000\217\000\217\000"
+ "\220\000\214\000\220\000\220\000\221\000\214\000\221\000\220\000\222\000"
+ "\221\000\222\000#\000\206\000\013\000#\000\016\000#\000R\000\216\000R\000"
+ "\217\000f\000\216\000W\000\232\000\232\000\233\000W\000\233\000W\000\234"
+ "\000\232\000\234\000W\000\235\000\234\000\235\000W\000\236\000\235\000\236"
+ "\000W\000\237\000\236\000\237\000Y\000\237\000\033\000\237\000\033\000\242"
+ "\000\237\000\242\000\035\000\242\000\036\000\242\0004\000\242\0007\000\242"
+ "\000c\000\242\000c\000\250\000\242\000\250\000\200\000\250\000d\000\200\000"
+ "d\000\250\000f\000~\000d\000\201\000d\000\254\000\250\000\254\000}\000\254"
+ "\000}\000\257\000\254\000\257\000|\000\257\000{\000\257\000{\000\262\000"
+ "\257\000\262\000g\000\262\000\214\000\262\000l\000\233\000j\000\233\000j"
+ "\000\232\000o\000\236\000n\000\236\000o\000\237\000p\000\237\000p\000\242"
+ "\000m\000\232\000m\000\234\000w\000\221\000x\000\221\000w\000\214\000n\000"
+ "\234\000w\000\262\000v\000\262\000q\000\242\000q\000\254\000\242\000\254"
+ "\000n\000\235\000s\000\254\000s\000\257\000x\000\222\000y\000\222\000v\000"
+ "\257\000y\000\220\000u\000\220\000\042\350\277\350Iv\000\000\000\357\236"
+ "\000\216{\000\000\042\350\236\000Iv\000\000\000\357\277\350\216{\000\000"
+ "K\034\277\350ko\000\000\006\027\236\000Iv\000\000\006\027\277\350Iv\000\000"
+ "K\034\236\000ko\000\000\335\342\277\350CN\000\000\042\350\236\000eG\000\000"
+ "\042\350\277\350eG\000\000\335\342\236\000CN\000\000\335\342\236\000ko\000"
+ "\000\216\337\277\350lg\000\000\335\342\277\350ko\000\000\216\337\236\000"
+ "lg\000\000\377\366\236\000\336~\000\000\377\366\277\350\336~\000\000\224"
+ "\377\277\350\377\177\000\000)\010\236\000\336~\000\000\224\377\236\000\377"
+ "\177\000\000)\010\277\350\336~\000\000l\336\236\000\327^\000\000\216\337"
+ "\277\350BV\000\000l\336\277\350\327^\000\000\216\337\236\000BV\000\000(\020"
+ "\236\000\216{\000\000(\020\277\350\216{\000\000\274 \236\000\327^\000\000"
+ "\233\037\277\350lg\000\000\274 \277\350\327^\000\000\233\037\236\000lg\000"
+ "\000\335\342\236\000CN\000\000\224\377\236\000\327^\000\000\042\350\236\000"
+ "eG\000\000\216\337\236\000BV\000\000l\336\236\000\327^\000\000\274 \236\000"
+ "\327^\000\000\233\037\236\000lg\000\000\216\337\236\000lg\000\000\335\342"
+ "\236\000ko\000\000K\034\236\000ko\000\000\042\350\236\000Iv\000\000\006\027"
+ "\236\000Iv\000\000\000\357\236\000\216{\000\000(\020\236\000\216{\000\000"
+ "\377\366\236\000\336~\000\000)\010\236\000\336~\000\000\224\377\236\000\377"
+ "\177\000\000\042 \236\000DZ\000\000\042\350\236\000eG\000\000\346\324\277"
+ "\350(4\000\000\042\350\277\350eG\000\000c\326\310\363\2465\000\000\276\332"
+ "\003\376\001:\000\000\240\341\263\006\343@\000\000\224\377\236\000\327^\000"
+ "\000\224\377X\022\327^\000\000\203\352<\015\306I\000\000\276\3641\021\001"
+ "T\000\000c\326\310\363\2465\000\000\351\321\277\350k\252\000\000\346\324"
+ "\277\350(4\000\000p\323\223\364\344\250\000\000\276\332\003\376\001:\000"
+ "\000d\324\353\366\360\247\000\000\354\327\244\377i\244\000\000\240\341\263"
+ "\006\343@\000\0008\331^\001\035\243\000\000\235\333\224\004\267\240\000\000"
+ "\027\337<\011=\235\000\000p\347\335\017\345\224\000\000\203\352<\015\306"
+ "I\000\000\201\350\266\020\323\223\000\000\363\362H\025a\211\000\000\276\364"
+ "1\021\001T\000\000\223\363\216\025\302\210\000\000\224\377A\027J\203\000"
+ "\000@\3776\027H\203\000\000\224\377X\022\327^\000\000\236\013\255\025\021"
+ "\203\000\000i\024\324\014\352[\000\000\330\026\012\021j\202\000\000[\012"
+ "\366\020S]\000\000\027.\277\350J\203\000\000\342'\213\363-Y\000\000O)\277"
+ "\350\372X\000\000\202,\311\364\021\203\000\000\340'\003\000j\202\000\000"
+ "\017\035:\006\262Z\000\000\264#\232\375\303Y\000\000z\042\022\007\250\201"
+ "\000\000\177 \252\011a\201\000\000P\004\242\0263\203\000\000\042 \277\350"
+ "DZ\000\000\042 \236\000DZ\000\000\224\377\236\000\327^\000\000[\012\366\020"
+ "S]\000\000\224\377X\022\327^\000\000\042 \236\000DZ\000\000i\024\324\014"
+ "\352[\000\000\017\035:\006\262Z\000\000\264#\232\375\303Y\000\000\042 \277"
+ "\350DZ\000\000O)\277\350\372X\000\000\342'\213\363-Y\000\000)\371j\026+\203"
+ "\000\000\351\321\277\350k\252\000\000\230\350\350\356\275\223\000\000\042"
+ "\350\277\3502\224\000\000p\323\223\364\344\250\000\000\005\3521\365O\222"
+ "\000\000d\324\353\366\360\247\000\000\226\354\275\373\277\217\000\000\354"
+ "\327\244\377i\244\000\000\000\357\350\377T\215\000\0008\331^\001\035\243"
+ "\000\000\327\360F\002}\213\000\000\235\333\224\004\267\240\000\000\377\366"
+ "\217\007U\205\000\000\027\337<\011=\235\000\000H\367\267\007\015\205\000"
+ "\000\026\373\270\010\077\201\000\000)\371j\026+\203\000\000p\347\335\017"
+ "\345\224\000\000\201\350\266\020\323\223\000\000\363\362H\025a\211\000\000"
+ "\223\363\216\025\302\210\000\000@\3776\027H\203\000\000\026\373\270\010\077"
+ "\201\000\000)\371j\026+\203\000\000\224\377L\011T\201\000\000\224\377A\027"
+ "J\203\000\000P\004\242\0263\203\000\000\002\0106\010,\201\000\000\236\013"
+ "\255\025\021\203\000\000\345\017\002\005\271\200\000\000\330\026\012\021"
+ "j\202\000\000\270\026\343\377\001\200\000\000\177 \252\011a\201\000\000\327"
+ "\033\020\371\271\200\000\000\013\037-\361,\201\000\000\042 \277\350T\201"
+ "\000\000\027.\277\350J\203\000\000z\042\022\007\250\201\000\000\340'\003"
+ "\000j\202\000\000\202,\311\364\021\203\000\000\301\000\317\000\301\000\325"
+ "\000Q\000\077\000\077\000Q\000\201\322\201\311\201\311\201\322\257\000\234"
+ "\000\257\000\234\000\342\000\351\000\005\000\027\000\373\000\036\000\201"
+ "\000\201\351\201\000\201\342+\0001\000\177\000h\000\177\000a\000\000\177"
+ "\000}\000\177\000\177\000|\000{\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\300\000\300\000\300"
+ "\000\300\000\300\000\301\000\301\000\301\000\301\000\300\000\232\027\222"
+ "\017\222\017\241\036\254)\250%\2641\277<\2716\2716\301\077\312G\322O\322"
+ "O\334X\350e\351f\000|\362n\000|\036_+R1L\025hn\016f\027n\016_\036L1@=R+G"
+ "6\077\077\016n\177\017\177\017\020\000\020\000\020\000\020\000\020\000\020"
+ "\000\020\000\020\000\020\000\020\000\362n\201@\201\077\201\301\201\300\201"
+ "\300\201\300\201\301\201\300\201\300\201\300\201\077\201\301\201\300\201"
+ "\300\201\300\201\300\201\300\201\300\201\300\201\300\201\300o\177\221\177"
+ "\221\177o\177o\177o\177o\177\221\177\221\177\221\177uz|r\177o\177o\177o\177"
+ "\221\177\221\177\221\177\221\000\000\000\000\001\000\002\000\001\000\000"
+ "\000\003\000\004\000\005\000\006\000\005\000\004\000\007\000\010\000\011"
+ "\000\012\000\011\000\010\000\013\000\014\000\015\000\016\000\015\000\014"
+ "\000\017\000\003\000\020\000\001\000\020\000\003\000\021\000\022\000\023"
+ "\000\024\000\023\000\022\000\025\000\026\000\027\000\030\000\027\000\026"
+ "\000\031\000\015\000\026\000\030\000\026\000\015\000\017\000\031\000\010"
+ "\000\027\000\010\000\031\000\013\000\025\000\032\000\023\000\032\000\025"
+ "\000\033\000\033\000\005\000\032\000\005\000\033\000\006\000\021\000\024"
+ "\000\020\000\024\000\021\000\022\000\034\000\035\000\036\000\035\000\034"
+ "\000\037\000\037\000\004\000\035\000\004\000\037\000\007\000\000\000\014"
+ "\000\016\000\014\000\000\000\002\000 \000!\000\042\000!\000 \000#\000!\000"
+ "#\000$\000!\000$\000%\000%\000$\000&\000&\000$\000'\000&\000'\000(\000&\000"
+ "(\000)\000)\000(\000*\000)\000*\000+\000+\000*\000,\000+\000,\000-\000-\000"
+ ",\000.\000-\000.\000/\000/\000.\0000\000%\0001\000!\0002\0003\0004\0003\000"
+ "2\0005\0005\0002\0006\0006\0002\0007\0007\0002\0008\0007\0008\0009\0007\000"
+ "9\000:\000:\0009\000;\000<\000=\000>\000=\000<\000\077\000@\000\077\000<"
+ "\000\077\000@\000A\000B\000A\000@\000C\000B\000@\000B\000C\000D\000C\000"
+ "E\000D\000E\000C\000F\000C\000G\000F\000G\000H\000I\000H\000G\000C\000H\000"
+ "J\000I\000J\000K\000L\000K\000J\000H\000K\000M\000N\000M\000K\000O\000P\000"
+ "Q\000R\000Q\000P\000S\000T\000U\000V\000U\000T\000W\000X\000Y\000Z\000Y\000"
+ "X\000[\000Y\000[\000\134\000R\000Y\000\134\000Y\000R\000Q\000W\000Z\000U"
+ "\000Z\000W\000X\000]\000S\000P\000S\000]\000M\000S\000M\000O\000^\000\034"
+ "\000\036\000\034\000^\000_\000`\000a\000b\000a\000`\000c\000a\000c\000d\000"
+ "d\000c\000e\000e\000c\000f\000f\000c\000g\000f\000g\000h\000f\000h\000i\000"
+ "L\000N\000j\000N\000L\000K\000k\000l\000m\000l\000k\000n\000l\000n\000o\000"
+ "o\000n\000p\000o\000p\000q\000q\000p\000r\000q\000r\000s\000s\000r\000t\000"
+ "s\000t\000u\000u\000t\000v\000u\000v\000w\000w\000v\000x\000w\000x\000y\000"
+ "y\000x\000z\000z\000x\000{\000{\000x\000|\000{\000|\000}\000{\000}\000~\000"
+ "{\000~\000\177\000\200\000\201\000\202\000\201\000\200\000\203\000\203\000"
+ "\200\000\204\000\203\000\204\000\205\000\203\000\205\000\206\000\206\000"
+ "\205\000\207\000\206\000\207\000\210\000\210\000\207\000\211\000\210\000"
+ "\211\000\212\000\212\000\211\000\213\000\213\000\214\000\212\000\214\000"
+ "\213\000\215\000\215\000\213\000\216\000\216\000\213\000\217\000\217\000"
+ "\213\000\220\000\217\000\220\000\221\000\217\000\221\000\222\000\000\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000"
+ "\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000"
+ "\005\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000\010\000"
+ "\013\000\011\000\013\000\014\000\015\000\015\000\016\000\014\000\016\000"
+ "\014\000\017\000\015\000\017\000\003\000\020\000\001\000\020\000\003\000"
+ "\021\000\020\000\021\000\022\000\023\000\023\000\024\000\022\000\024\000"
+ "\022\000\025\000\023\000\025\000\026\000\027\000\027\000\030\000\026\000"
+ "\030\000\026\000\031\000\027\000\031\000\015\000\026\000\015\000\030\000"
+ "\017\000\026\000\010\000\031\000\010\000\027\000\013\000\031\000\025\000"
+ "\032\000\023\000\032\000\025\000\033\000\032\000\033\000\005\000\033\000"
+ "\005\000\032\000\006\000\033\000\021\000\024\000\020\000\024\000\021\000"
+ "\022\000\034\000\035\000\035\000\036\000\034\000\036\000\034\000\037\000"
+ "\035\000\037\000\004\000\037\000\004\000\035\000\007\000\037\000\000\000"
+ "\014\000\000\000\016\000\002\000\014\000\013\000!\000\011\000!\000\031\000"
+ "!\000\026\000!\000\026\000\034\000\034\000!\000\026\000\037\000\017\000\037"
+ "\000\014\000\037\000\007\000\014\000\002\000\007\000\002\000\005\000\001"
+ "\000\005\000\001\000\032\000\020\000\032\000\020\000\023\000\034\0001\000"
+ "!\0001\000\011\0003\000\012\0003\000\011\0005\0003\0005\000\011\0006\000"
+ "5\0006\000\011\0007\0006\0007\000!\0007\000!\0009\0007\0009\0009\000:\000"
+ "7\000:\0009\000;\000:\000;\0005\000=\0003\000=\0005\000\077\000=\000\077"
+ "\0006\000\077\0006\000A\000\077\000A\000A\000B\0006\000B\0007\000B\0007\000"
+ "D\000B\000D\0007\000E\000D\000E\0007\000F\000E\000F\0007\000G\000F\000G\000"
+ ":\000G\000:\000I\000G\000I\000:\000J\000I\000J\000;\000J\000;\000L\000J\000"
+ "L\000;\000M\000M\000N\000;\000N\0009\000M\000P\000Q\000Q\000R\000P\000R\000"
+ "P\000S\000Q\000S\000T\000U\000U\000V\000T\000V\000T\000W\000U\000W\000X\000"
+ "Y\000Y\000Z\000X\000Z\000X\000[\000Y\000[\000[\000\134\000Y\000\134\000R"
+ "\000Y\000R\000\134\000Q\000Y\000W\000Z\000U\000Z\000W\000X\000S\000]\000"
+ "P\000]\000M\000]\000M\000S\0009\000S\000\034\000^\000\036\000^\0001\000^"
+ "\000!\000S\0001\000S\0001\000Q\0001\000Y\0001\000Z\000Z\000^\000V\000^\000"
+ "V\000Z\000L\000N\000N\000j\000L\000j\000=\000l\000l\000m\000=\000m\000\077"
+ "\000l\000\077\000o\000l\000o\000A\000o\000A\000q\000o\000q\000B\000q\000"
+ "B\000s\000q\000s\000D\000s\000D\000u\000s\000u\000E\000u\000E\000w\000u\000"
+ "w\000F\000w\000F\000y\000w\000y\000F\000z\000y\000z\000F\000j\000j\000z\000"
+ "G\000j\000I\000j\000J\000j\000N\000z\000N\000\203\000z\000\203\000M\000\203"
+ "\000]\000\203\000]\000\206\000\203\000\206\000P\000\206\000P\000\210\000"
+ "\206\000\210\000R\000\210\000R\000\212\000\210\000\212\000\134\000\212\000"
+ "\134\000\214\000\212\000\214\000\134\000\215\000\214\000\215\000\134\000"
+ "\216\000\215\000\216\000T\000\134\000T\000\216\000T\000[\000T\000X\000\034"
+ "\213l\335\215\013\000\000\230\221N\340\270\346\000\000\233\223l\335E\347"
+ "\000\000\015\211N\3406\013\000\000&~\372\370\3703\000\000\264\177\325\361"
+ ">D\000\000\333}\227\361\3743\000\000\377\177M\371:D\000\000\223+\370\357"
+ "T\320\000\000\3413\245\341O\330\000\000\2674\036\342_\331\000\000\0013Y\341"
+ "8\327\000\000\0155e\342\317\331\000\000\001\200L\371 =\000\000\022\205\304"
+ "\000\220\012\000\000\310\204L\371\204\012\000\000L\200\304\000'=\000\000"
+ "Hw\024\337\352A\000\000\042w\204\023\354A\000\000\042w\024\337\354A\000\000"
+ "Hw\204\023\352A\000\000\326aq\376\377\350\000\000\2028p\334\265\011\000\000"
+ ",[q\3765\343\000\000\211@p\334\260\020\000\000\355\205\272\007\264\012\000"
+ "\000(\201\272\007;=\000\000\271i\306\022\233w\000\000&\042(\026\004z\000"
+ "\000&\042\306\022\004z\000\000\271i(\026\233w\000\000\221%\024\337\264D\000"
+ "\000+w\024\337@B\000\000\042w\024\337\354A\000\000\271i\024\337\216j\000"
+ "\000&\042\024\337\367l\000\000\311\235\306\022mW\000\000~\246\204\0235\042"
+ "\000\000P\345\204\023%:\000\000H\207\264\015\354\012\000\000\206\202\264"
+ "\015\134=\000\000\015\211J\0226\013\000\000M\204J\022\207=\000\000.w\202"
+ "\023TB\000\000\221%\204\023\264D\000\000\042w\204\023\354A\000\000\271i\306"
+ "\022\233w\000\000L\200\324\361'=\000\000\022\205\324\361\220\012\000\000"
+ "\034\213,\025\215\013\000\000`\206,\025\272=\000\000\334}\134\000\3743\000"
+ "\000\265\177\305\000>D\000\000R\215p\334\351\013\000\000`\206l\335\272=\000"
+ "\000\034\213l\335\215\013\000\000\232\210p\334\357=\000\000\336\217\344\344"
+ "\077\346\000\000H\207\344\344\354\012\000\000\213\216\336\352\342\345\000"
+ "\000\355\205\336\352\264\012\000\000m\215L\371\224\345\000\000\266\215\324"
+ "\361\250\345\000\000\267Tq\376/\335\000\0004)p\334\356\372\000\000yNq\376"
+ "\361\326\000\000\2720p\334t\002\000\000\266\215\304\000\250\345\000\000\213"
+ "\216\272\007\342\345\000\000\336\217\264\015\077\346\000\000&\042\306\022"
+ "\004z\000\000\230\221J\022\270\346\000\000`\206,\025\272=\000\000R\215(\026"
+ "\351\013\000\000\034\213,\025\215\013\000\000\232\210(\026\357=\000\000\233"
+ "\223,\025E\347\000\000\303\225(\026\334\347\000\000\233\223,\025E\347\000"
+ "\000\303\225p\334\334\347\000\000\233\223l\335E\347\000\000\314\034)\361"
+ "\370\267\000\000\275$\034\344-\275\000\000*\0378\360T\276\000\000^(\011\343"
+ "\211\307\000\0006\033\303\361\244\263\000\000\025=\302\364\343\331\000\000"
+ "\007Gq\376\330\316\000\000sHq\376|\320\000\000\363!p\334'\363\000\000\335"
+ ":\266\363\305\331\000\000\371\032p\334\037\353\000\000w3c\361\220\326\000"
+ "\000\306\007p\334\245\321\000\000\373\001p\334\272\310\000\000\314\034)\361"
+ "\370\267\000\000G\024p\334\333\342\000\000\307+\002\360\177\320\000\000\210"
+ "9.\350\304\334\000\000y9\001\350\276\334\000\000\340\015p\334\134\332\000"
+ "\000\226%\251\357\042\311\000\000\200\374p\334\233\277\000\000\027\031\177"
+ "\365\134\244\000\0005\032\354\362u\256\000\000X\367p\334N\266\000\000@\337"
+ "\306\022uo\000\000\271ip\334\216j\000\000&\042\024\337\367l\000\000&\042"
+ "p\334\367l\000\000\271i\024\337\216j\000\000\002\032A\371\220\231\000\000"
+ "\204\362p\334\323\254\000\000v%\246\357\373\310\000\000\235 \023\360\344"
+ "\300\000\000\344\0330\374\032\223\000\000Y\035q\376\035\216\000\000\316\035"
+ "q\376\026\217\000\000\005\356p\334/\243\000\000\263hq\376\216\356\000\000"
+ "\315Hp\334a\027\000\000\3518\274\346p\334\000\000<8\217\345\010\334\000\000"
+ "t7~\344\205\333\000\000\2246\215\343\353\332\000\000\2405\301\342=\332\000"
+ "\000\235 \023\360\344\300\000\000\277$\233\357\036\310\000\000h.\305\341"
+ "\307\321\000\000\202kq\376\254\360\000\000Mm\265\373=\367\000\000LQp\334"
+ "\310\035\000\000#\031%\364\304\250\000\000\305#\353\344g\263\000\0005\032"
+ "\354\362u\256\000\000\346.\222\360\375\322\000\000I3^\361n\326\000\000\201"
+ "3t\361\211\326\000\000I3^\361n\326\000\000\346.\222\360\375\322\000\000#"
+ "3V\361_\326\000\000\206%h\345\341\252\000\000.1L\341\010\325\000\000L\200"
+ "\324\361'=\000\000L\200\304\000'=\000\000\001\200L\371 =\000\000(\201\336"
+ "\352;=\000\000(\201\272\007;=\000\000\206\202\344\344\134=\000\000\206\202"
+ "\264\015\134=\000\000M\204N\340\207=\000\000M\204J\022\207=\000\000`\206"
+ "l\335\272=\000\000`\206,\025\272=\000\000\232\210p\334\357=\000\000\232\210"
+ "\024\337\357=\000\000\232\210\306\022\357=\000\000\232\210(\026\357=\000"
+ "\000\0312;\341\037\326\000\000M\204N\340\207=\000\000\206\202\344\344\134"
+ "=\000\000(\201\336\352;=\000\000`\206l\335\272=\000\000\024<\371\361\374"
+ "\332\000\000\335:\266\363\305\331\000\000\3003y\361\254\326\000\000\241:"
+ "\271\352\212\334\000\000#3V\361_\326\000\000\034:W\351\264\334\000\000\344"
+ "\032\003\3733\225\000\000\341)\213\3451\244\000\000\002\032A\371\220\231"
+ "\000\000\015\031F\367g\236\000\000hs\030\346j\042\000\000\356bp\334\255)"
+ "\000\000ZqL\356\232\022\000\000\015lp\334(/\000\000\217t`\341D+\000\000\213"
+ "u\264\334\3643\000\000Zup\334P4\000\000\003Zp\334\342#\000\000wo\236\365"
+ "\024\004\000\000=n7\372\253\372\000\000swp\334\264D\000\000\323x\024\337"
+ "\303[\000\000\323xp\334\303[\000\000sw\024\337\264D\000\000\221%\204\023"
+ "\264D\000\000\221%\024\337\264D\000\000+w\024\337@B\000\000swv\023\264D\000"
+ "\000\042w\024\337\354A\000\000\042w\204\023\354A\000\000.w\202\023TB\000"
+ "\000\217\212(\026RJ\000\000\232\210\306\022\357=\000\000\217\212\306\022"
+ "RJ\000\000\232\210(\026\357=\000\000\232y(\026\304h\000\000sw(\026\264D\000"
+ "\000\311V\334\034\3775\000\000\324\255\334\034Q\026\000\000\303\225(\026"
+ "\334\347\000\000R\215\004\025\351\013\000\000\232u\224\025s4\000\000\217"
+ "tA\025D+\000\000\3469q\376\027\217\000\000\331B\335\343\343\236\000\000K"
+ "0q\376S\214\000\000>M\274\342q\242\000\000\316Kq\376%\233\000\000\254^\220"
+ "\343\013\256\000\000\235^\177\343\366\255\000\000M_\200\344\353\256\000\000"
+ "\326_\221\345\265\257\000\000E`\277\346c\260\000\000\231`\003\350\363\260"
+ "\000\000\317`Y\351c\261\000\000\342`c\352\236\261\000\000\342Rq\376\235\243"
+ "\000\000\321w\210\024S4\000\000\210Wo\341g\250\000\000HCq\376%\224\000\000"
+ "gXN\341\042\251\000\000}Y>\341\010\252\000\000\225Z[\341\353\252\000\000"
+ "\253[\247\341\306\253\000\000\272\134 \342\225\254\000\000\276]\304\342V"
+ "\255\000\000\252y,\025\225D\000\000R\215(\026\351\013\000\000R\215\004\025"
+ "\351\013\000\000\303\225(\026\334\347\000\000\232\210(\026\357=\000\000\303"
+ "\225\024\337\334\347\000\000R\215p\334\351\013\000\000\303\225p\334\334\347"
+ "\000\000R\215\024\337\351\013\000\000\303\225\306\022\334\347\000\000R\215"
+ "\306\022\351\013\000\000\012Xq\376\371\254\000\000\333[\030\375\205\267\000"
+ "\000\376^{\364\355\263\000\000\352Zq\376\225\266\000\000\311\235p\334aJ\000"
+ "\000\311\235\024\337aJ\000\000E`\277\346c\260\000\000y9\001\350\276\334\000"
+ "\000\3518\274\346p\334\000\000\231`\003\350\363\260\000\000\2109.\350\304"
+ "\334\000\000\317`Y\351c\261\000\000\034:W\351\264\334\000\000\232\210p\334"
+ "\357=\000\000\232\210\024\337\357=\000\000\232\210\306\022\357=\000\000\225"
+ "Z[\341\353\252\000\000\0312;\341\037\326\000\000}Y>\341\010\252\000\000\001"
+ "3Y\3418\327\000\000\235^\177\343\366\255\000\000\2405\301\342=\332\000\000"
+ "\276]\304\342V\255\000\000\254^\220\343\013\256\000\000\2246\215\343\353"
+ "\332\000\000.1L\341\010\325\000\000gXN\341\042\251\000\000\272\134 \342\225"
+ "\254\000\000\3413\245\341O\330\000\000\253[\247\341\306\253\000\000\2674"
+ "\036\342_\331\000\000\036'q\376\012\214\000\000\2130Q\345\313\237\000\000"
+ "\001\037q\376\077\216\000\000\0179\276\344\374\235\000\000\000[q\376}\270"
+ "\000\000\332`\274\352\301\261\000\000\326_\221\345\265\257\000\000t7~\344"
+ "\205\333\000\000M_\200\344\353\256\000\000<8\217\345\010\334\000\000w3c\361"
+ "\220\326\000\000\332`\274\352\301\261\000\000\024<\371\361\374\332\000\000"
+ "\241:\271\352\212\334\000\000\376^{\364\355\263\000\000\025=\302\364\343"
+ "\331\000\000\333[\030\375\205\267\000\000\007Gq\376\330\316\000\000\000["
+ "q\376}\270\000\000\232\210\024\337\357=\000\000~\246\024\3375\042\000\000"
+ "\012\213\024\337\361\031\000\000\311\235\024\337aJ\000\000\326%\253\357n"
+ "\311\000\000\223+\370\357T\320\000\000\331B\335\343\343\236\000\000\2130"
+ "Q\345\313\237\000\000\0179\276\344\374\235\000\000>M\274\342q\242\000\000"
+ "\341)\213\3451\244\000\000\210Wo\341g\250\000\000\206%h\345\341\252\000\000"
+ "\305#\353\344g\263\000\000\275$\034\344-\275\000\000^(\011\343\211\307\000"
+ "\000h.\305\341\307\321\000\000\330~\337\352JD\000\000\377|\265\352\0114\000"
+ "\000\025=\302\364\343\331\000\000op\261\372\214\372\000\000\202kq\376\254"
+ "\360\000\000\342`c\352\236\261\000\000\311\235\306\022mW\000\000\217\212"
+ "(\026RJ\000\000\217\212\306\022RJ\000\000\311\235(\026mW\000\000~\246\024"
+ "\3375\042\000\000\012\213\204\023\361\031\000\000\012\213\024\337\361\031"
+ "\000\000~\246\204\0235\042\000\000\0155e\342\317\331\000\000>-F\360\252\321"
+ "\000\000\345+\007\360\226\320\000\000\315-_\360\034\322\000\000\245yl\335"
+ "\225D\000\000\232up\334s4\000\000\314wi\335S4\000\000swp\334\264D\000\000"
+ "=n(\026\253\372\000\000\202k0\026\254\360\000\000I3^\361n\326\000\000w3c"
+ "\361\220\326\000\000:%\241\357\262\310\000\0006\033\303\361\244\263\000\000"
+ "\3003y\361\254\326\000\000\2013t\361\211\326\000\000*\0378\360T\276\000\000"
+ "\346.\222\360\375\322\000\000I3^\361n\326\000\000#3V\361_\326\000\000I3^"
+ "\361n\326\000\000\346.\222\360\375\322\000\000\334yC\34064\000\000\245yl"
+ "\335\225D\000\000\314wi\335S4\000\000\364{Z\356\332*\000\000\320|\233\364"
+ "\316*\000\000\033}R\373\312*\000\000\243u4\001A\372\000\000\230z\372\350"
+ "\356*\000\000FtO\376U\372\000\000{}\345\344^D\000\000\265{N\340wD\000\000"
+ "\243{\314\344\0344\000\000\177}\264\015^D\000\000\333~\272\007JD\000\000"
+ "\246{&\015\0344\000\000\272{J\022wD\000\000\341y\257\02154\000\000\252y,"
+ "\025\225D\000\000\321w\210\024S4\000\000\321|\011\002\316*\000\000\321x\333"
+ "\344\007+\000\000\002}>\007\0114\000\000\346.\222\360\375\322\000\000\326"
+ "x\310\021\007+\000\000\306v_\024%+\000\000tp\256\025\214\372\000\000\352"
+ "rA\020A\360\000\000\304sd\0155\360\000\000\334U:\020\374\205\000\000\016"
+ "tQ\0121\360\000\000\303s>\0075\360\000\000\270VC\007\374\205\000\000\301"
+ "vC\342%+\000\000\233z\251\015\355*\000\000\367{J\010\332*\000\000Jt\020\022"
+ "T\372\000\000\245u,\017A\372\000\000~v\222\0045\372\000\000\321w\210\024"
+ "S4\000\000\306v_\024%+\000\000\312v0\0101\372\000\000Jt\020\022T\372\000"
+ "\000\271m\311\025\214\360\000\000\311o\231\024n\360\000\000\255R\216\024"
+ "\374\205\000\000\347ra\004A\360\000\000\212q\353\001U\360\000\000wT\352\001"
+ "\374\205\000\000\304o\010\000n\360\000\000\200r\026\374n\372\000\000\200"
+ "v\315\0135\372\000\000\263m\330\376\214\360\000\000\253R\011\000\374\205"
+ "\000\000\216q\266\022U\360\000\000|T\253\022\374\205\000\000\271V[\015\374"
+ "\205\000\000\205rI\024n\372\000\000\232up\334s4\000\000\213u\264\334\364"
+ "3\000\000Zup\334P4\000\000\306v_\024%+\000\000\205rI\024n\372\000\000\232"
+ "up\334s4\000\000\301vC\342%+\000\000\321w\210\024S4\000\000\232\210\306\022"
+ "\357=\000\000\012\213\204\023\361\031\000\000\232y(\026\304h\000\000\232"
+ "y\306\022\304h\000\000sw(\026\264D\000\000\220P\330\376\374\205\000\000\263"
+ "m\330\376\214\360\000\000sw\024\337\264D\000\000\323x\024\337\303[\000\000"
+ "\205rI\024n\372\000\000@\337(\026uo\000\000\216\343\221#\211,\000\000\311"
+ "\235(\026mW\000\000@\337(\026uo\000\000@\337\306\022uo\000\000\263\000(\026"
+ "\275t\000\000\263\000(\026\275t\000\000\001\001\221#\3141\000\000\232y\306"
+ "\022\304h\000\000\271i(\026\233w\000\000\271i\306\022\233w\000\000\232y("
+ "\026\304h\000\000\217\212(\026RJ\000\000&\042(\026\004z\000\000\271i(\026"
+ "\233w\000\000t\036\221#\0177\000\000@\337p\334hb\000\000@\337\024\337hb\000"
+ "\000P\345\204\023%:\000\000P\345\024\337%:\000\000\321x\333\344\007+\000"
+ "\000\301vC\342%+\000\000\217\212\306\022RJ\000\000P\345\024\337%:\000\000"
+ "@\337\024\337hb\000\000swp\334\264D\000\000Hwp\334\352A\000\000\232up\334"
+ "s4\000\000\323xp\334\303[\000\000\271i\024\337\216j\000\000\271ip\334\216"
+ "j\000\000\323x\024\337\303[\000\000\012\213\204\023\361\031\000\000\012\213"
+ "\024\337\361\031\000\000\301vC\342%+\000\000swv\023\264D\000\000\232y\306"
+ "\022\304h\000\000\263m\330\376\214\360\000\000op\261\372\214\372\000\000"
+ "\245yl\335\225D\000\000sw\024\337\264D\000\000swp\334\264D\000\000swv\023"
+ "\264D\000\000sw(\026\264D\000\000\252y,\025\225D\000\000\265{N\340wD\000"
+ "\000\272{J\022wD\000\000{}\345\344^D\000\000\177}\264\015^D\000\000\330~"
+ "\337\352JD\000\000\333~\272\007JD\000\000\264\177\325\361>D\000\000\265\177"
+ "\305\000>D\000\000\377\177M\371:D\000\000\321x\333\344\007+\000\000\332U"
+ "c\004\374\205\000\000\221P\300\025\374\205\000\000op\261\372\214\372\000"
+ "\000\301vC\342%+\000\000\004WM\012\374\205\000\000Jt\020\022T\372\000\000"
+ "swv\023\264D\000\000Hw\024\337\352A\000\000sw\024\337\264D\000\000Hw\204"
+ "\023\352A\000\000\311\235p\334aJ\000\000@\337p\334hb\000\000\203\331p\334"
+ "\374\205\000\000\326\331o\334\374\205\000\000&\042p\334\367l\000\000\277"
+ "\342p\334\374\205\000\000\015\346p\334v\217\000\000\335\351p\334d\231\000"
+ "\000\005\356p\334/\243\000\000\204\362p\334\323\254\000\000X\367p\334N\266"
+ "\000\000\200\374p\334\233\277\000\000\373\001p\334\272\310\000\000\306\007"
+ "p\334\245\321\000\000\340\015p\334\134\332\000\000G\024p\334\333\342\000"
+ "\000\371\032p\334\037\353\000\000\363!p\334'\363\000\0004)p\334\356\372\000"
+ "\000\271ip\334\216j\000\000\2720p\334t\002\000\000\2028p\334\265\011\000"
+ "\000\211@p\334\260\020\000\000\315Hp\334a\027\000\000LQp\334\310\035\000"
+ "\000\003Zp\334\342#\000\000\356bp\334\255)\000\000\015lp\334(/\000\000\323"
+ "xp\334\303[\000\000Zup\334P4\000\000\232up\334s4\000\000\344\0313\026\374"
+ "\205\000\000\375\0243\026\374\205\000\000\340\0323\026\374\205\000\000\016"
+ "\0332\026\374\205\000\000\344\0333\026\374\205\000\000kR\267\024\374\205"
+ "\000\000\222\0023\026\374\205\000\000y\0012\026\374\205\000\000yI-\026\374"
+ "\205\000\000hI-\026\374\205\000\0005N,\026\374\205\000\000QP\315\025\374"
+ "\205\000\000VN'\026\374\205\000\000B\262-\025\374\205\000\000\303\225(\026"
+ "\334\347\000\000\134\262C\025\374\205\000\000B\262-\025\374\205\000\000\226"
+ "\264'\026\374\205\000\000\036\031\324\364\201\246\000\000\015\031F\367g\236"
+ "\000\000\036\031\324\364\201\246\000\000\023\031n\3662\241\000\000\023\031"
+ "n\3662\241\000\000\027\031\177\365\134\244\000\000\326%\253\357n\311\000"
+ "\000v%\246\357\373\310\000\000v%\246\357\373\310\000\000\326%\253\357n\311"
+ "\000\000\226%\251\357\042\311\000\000\2013t\361\211\326\000\000\024<\371"
+ "\361\374\332\000\000\3003y\361\254\326\000\000I3^\361n\326\000\000I3^\361"
+ "n\326\000\000w3c\361\220\326\000\000I3^\361n\326\000\000B\262j\335\374\205"
+ "\000\000\134\262i\335\374\205\000\000\226\264p\334\374\205\000\000\316\035"
+ "q\376\026\217\000\000Y\035q\376\035\216\000\000:\042p\376\374\205\000\000"
+ "\036'q\376\012\214\000\000\371\042p\376\374\205\000\000K#p\376\374\205\000"
+ "\000\341#p\376\374\205\000\000'$p\376\374\205\000\000\012Xq\376\371\254\000"
+ "\000\342Rq\376\235\243\000\000ENq\376\374\205\000\000\352Zq\376\225\266\000"
+ "\000\202kq\376\254\360\000\000\000[q\376}\270\000\000,[q\3765\343\000\000"
+ "\326aq\376\377\350\000\000\263hq\376\216\356\000\000sHq\376|\320\000\000"
+ "\007Gq\376\330\316\000\000yNq\376\361\326\000\000\267Tq\376/\335\000\000"
+ "\307+\002\360\177\320\000\000\345+\007\360\226\320\000\000>-F\360\252\321"
+ "\000\000\315-_\360\034\322\000\000\346.\222\360\375\322\000\000\275\254\257"
+ "\007\374\205\000\0008\254d\003\374\205\000\000\327\253\304\000\374\205\000"
+ "\000\303Jq\376\374\205\000\000\344\0243\026\374\205\000\000Z13\026\374\205"
+ "\000\000\2111-\026\374\205\000\000\341\264p\334\374\205\000\000\217\3453"
+ "\026\374\205\000\000\230\3213\026\374\205\000\000\015\346p\334v\217\000\000"
+ "\277\342p\334\374\205\000\000\027\000\240\356\374\205\000\000\134\3563\026"
+ "\374\205\000\000B\3563\026\374\205\000\000\224\342p\334\374\205\000\000d"
+ "\321.\026\374\205\000\000\275\264.\026\374\205\000\000VNq\376\374\205\000"
+ "\000\327\253\304\000\374\205\000\000\327\253\324\361\374\205\000\000\210"
+ "\253L\371\374\205\000\000\277\254\336\352\374\205\000\0008\254d\003\374\205"
+ "\000\000\275\254\257\007\374\205\000\000/\256\264\015\374\205\000\000/\256"
+ "\344\344\374\205\000\000\017\260N\340\374\205\000\000\017\260J\022\374\205"
+ "\000\000B\262j\335\374\205\000\000B\262-\025\374\205\000\000\134\262i\335"
+ "\374\205\000\000\134\262C\025\374\205\000\000\226\264p\334\374\205\000\000"
+ "\226\264'\026\374\205\000\000\263\264p\334\374\205\000\000\275\264.\026\374"
+ "\205\000\000\341\264p\334\374\205\000\000d\321.\026\374\205\000\000\203\331"
+ "p\334\374\205\000\000\230\3213\026\374\205\000\000\217\3453\026\374\205\000"
+ "\000\326\331o\334\374\205\000\000\224\342p\334\374\205\000\000\277\342p\334"
+ "\374\205\000\000\027\000\240\356\374\205\000\000B\3563\026\374\205\000\000"
+ "\134\3563\026\374\205\000\000y\0012\026\374\205\000\000\346\031q\376\374"
+ "\205\000\000\222\0023\026\374\205\000\000\344\0243\026\374\205\000\000\375"
+ "\0243\026\374\205\000\000\344\0313\026\374\205\000\000\340\0323\026\374\205"
+ "\000\000:\042p\376\374\205\000\000\016\0332\026\374\205\000\000\344\0333"
+ "\026\374\205\000\000Z13\026\374\205\000\000W\042p\376\374\205\000\000\371"
+ "\042p\376\374\205\000\000K#p\376\374\205\000\000\341#p\376\374\205\000\000"
+ "'$p\376\374\205\000\000\303Jq\376\374\205\000\000\2111-\026\374\205\000\000"
+ "hI-\026\374\205\000\000yI-\026\374\205\000\0005N,\026\374\205\000\000\254"
+ "Kq\376\374\205\000\000\367Lq\376\374\205\000\000\300Mq\376\374\205\000\000"
+ "\035Nq\376\374\205\000\000ENq\376\374\205\000\000VN'\026\374\205\000\000"
+ "VNq\376\374\205\000\000QP\315\025\374\205\000\000\220P\330\376\374\205\000"
+ "\000\221P\300\025\374\205\000\000\253R\011\000\374\205\000\000kR\267\024"
+ "\374\205\000\000\255R\216\024\374\205\000\000wT\352\001\374\205\000\000|"
+ "T\253\022\374\205\000\000\332Uc\004\374\205\000\000\334U:\020\374\205\000"
+ "\000\270VC\007\374\205\000\000\271V[\015\374\205\000\000\004WM\012\374\205"
+ "\000\000\346\031q\376\374\205\000\000\001\037q\376\077\216\000\000W\042p"
+ "\376\374\205\000\000K0q\376S\214\000\000\254Kq\376\374\205\000\000\3469q"
+ "\376\027\217\000\000\367Lq\376\374\205\000\000HCq\376%\224\000\000\300Mq"
+ "\376\374\205\000\000\346\031q\376\374\205\000\000\335\351p\334d\231\000\000"
+ "\035Nq\376\374\205\000\000\316Kq\376%\233\000\000\263\264p\334\374\205\000"
+ "\000/\256\264\015\374\205\000\000\017\260N\340\374\205\000\000B\262j\335"
+ "\374\205\000\000/\256\344\344\374\205\000\000\277\254\336\352\374\205\000"
+ "\000\327\253\324\361\374\205\000\000\316\035q\376\026\217\000\000\344\033"
+ "0\374\032\223\000\000\210\253L\371\374\205\000\000\017\260J\022\374\205\000"
+ "\000B\262-\025\374\205\000\000\262\303\250\306\260\277\252\313}\361x\355"
+ "u\350~\016\301\001\277\371\277\371\277\371\301\000\203\014\211\031\201\022"
+ "\213\024\004\000\004\000\004\000\004\000=\235=\236=\236=\235\222 \224\034"
+ "\004\000\374\000\363\000\004\000\000\177\000\177\000\177\000\177\000\177"
+ "\002\202\003\202\002\201\234)\237&\2525\2564\375\202\002\201\376\201\375"
+ "\202\210\356\211\347\263;\2649x\023u\026\344\232\327\247\325\245\350\227"
+ "\232\321\234\327\221\330\222\340\201\033\211\336=\237=\240=\240=\237\211"
+ "\042\221(\232/\002\201\250:\327Y\326Z\325[\344d\260@\327_\323\134\342\230"
+ "\323\244\271\335\270\332\272\342\273\347\267\324=\242=\242=\241=\241=\242"
+ "=\241H\242<\245<\246<\246=\243=\243\315\012\312\010=\244=\244<\247<\250<"
+ "\247<\250\002\201\004\000\374\000\365\000\004\000;\251;\251=\245=\245;\251"
+ ";\252;\251;\252=\234=\233\312\010\312\010\312\010\312\010\312\010\274\353"
+ "\275\357\276\365+\2249\226=\232\265\302\265\312\266\316\3326\332,\334*\351"
+ "`\351`\351`\265\265\277\371\365\000\365\000\365\000\365\000\365\000\365\000"
+ "\365\000\365\000\365\000\365\000\365\000\347\000\341\000\365\000\365\000"
+ "\277\371\250\321\233\335\221\346\264\307\341\036\343\035\336\042\331\024"
+ "\330\024\333\026\265\247\265\247\265\256\265\265<\227<\230<\230<\227;\226"
+ "=\230<\226=\231=\2329\225\177\371\177\371\177\371\177\366\374\000\365\000"
+ "\177\363\177\365\177\363\177\363\177\363\222\000\222\000\222\000\222\000"
+ "\017l$a\021p\360p\334b\345h&`$``\233W\220R\212e\240{\077x>y\271x>x>x>x>x"
+ ">s=m<2Ts\262m\253w\267w\267w\267w\267w\267w\267,[m\000n\000g\000t\000g\000"
+ "k\000g\000m\000g\000m\000a9X7e:U6\325\000\331\0000\3353\342/\3325\3456\350"
+ "8\3548\354t\000u\000u\000\012\224\004\210\377\201\015\232!\277\037\274\036"
+ "\271\042\302$\305\361\211\362\211\030\257\024\247\022\243\033\264\265\213"
+ "\265\233\265\231\265\205M5j;,\324(\315'\312,\324\333#@\372C\377=\364C\377"
+ "C\377C\377C\377C\377\000\177\000\177\000\177\000\177=\243=\243\357\212\357"
+ "\212\357\212\357\212\357\212\357\212\357\212\357\212\357\212\357\212\357"
+ "\212o\345l\337\354#:\227\033\215;\360\322\000\315\000\315\000\330\000\341"
+ "\000\343\000\343\000\337\000\034\266=\243=\243=\243*\247(\2305\240\030\227"
+ "\034f\030l\333)\334&\276\371<\247F\242R\246<\2464\2405\2345\235G\242A\244"
+ "U\304M\306Q\277m\334w\350}\017c\313d\320X\275e\334X\320c\323b(l\036e$S6X"
+ "1N;M;r\027Y\300o\033:\242Q6'[)\134_3l)b2\177\345m\325q\331S\270\134+h T7"
+ "d(p\331\077HCB~\353V4-[@K@M`\312S\275S\302G\260J\254p 2\237\077\263NAS>q"
+ "'GA\353C\353C\353C4PCD5\240E\244,Z\003\203\003\202\177\371\177\371\177\371"
+ " \232*\234\000\177\000\177N9\373f\373y\366i\351\000\343\000\357\000\375g"
+ "\377z=\000=\000=\000=\000\364m\376h\007k\005{\343\000\351\000\350\000\342"
+ "\000V\274K\254\003\203\000\177\000\177\000\177\000\177\000\177\077\000\077"
+ "\000\077\000\077\000w\000w\000B\240\374\203\374\203;\242=\234\007\000\007"
+ "\000\007\000\007\000\007\000\007\000\007\000\007\000\007\000\007\000\007"
+ "\000\007\000\007\000\007\000\007\000O\263b\316#cG\247G\247\177\345Q:\210"
+ "\000\210\000\210\000\210\000\000\201\000\201\377\202\377\202\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\030\227\011\177\012"
+ "~\012~\012~\367\1777T\367\177\367\177\373\177\373\177\016v\031l\027m\310"
+ "T\317Y\310U\273K\336e\261\302\370[\370[\370[\251\314\251\314\276\372\301"
+ "\365\336\302\336\302\336\302\370\244\370\244\370\244\330 \327\021\333\037"
+ "@\241\344\226\343\227\355\220\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\022\211\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\313\010\313\011\312"
+ "\010\312\010\312\010\217)\215'\210$\000\201\012~\016x\017v\000\201\011\177"
+ "\361x:\253:\254:\253\012~\012~\000\201\364z\356r\015\213\177\177\177\177"
+ "\201\177\177\177\177\177\177\177\201\177\201\177\201\177\177\177\177\177"
+ "\201\177\201\177\201\177\177\177\201\177\201\177\201\177\201\177\201\177"
+ "\201\177\201\177\201\177\177\177\201\177\201\177\177\201\177\177\177\177"
+ "\177\201\201\201\177\201\201\201\201\201\201\201\201\201\201\201\177\177"
+ "\201\177\177\177\201\177\201\177\201\177\177\177\177\177\177\177\177\177"
+ "\201\177\201\177\177\177\177\177\177\177\177\177\177\177\177\177\201\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\201\177"
+ "\201\177\201\177\201\177\177\177\177\177\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201:\253;\253\000\201\000\201\000\201"
+ "\2300\252\302\260\276\234\315\222\325\212\333\265\240\265\240\202\341\245"
+ ":\264E\000\000\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005"
+ "\000\006\000\005\000\004\000\007\000\010\000\011\000\012\000\010\000\013"
+ "\000\011\000\010\000\012\000\014\000\015\000\016\000\017\000\016\000\015"
+ "\000\020\000\021\000\022\000\023\000\022\000\021\000\024\000\025\000\026"
+ "\000\027\000\026\000\025\000\030\000\020\000\031\000\016\000\031\000\020"
+ "\000\032\000\033\000\034\000\035\000\034\000\033\000\036\000\037\000 \000"
+ "!\000 \000\037\000\042\000\042\000\037\000#\000$\000%\000&\000\032\000'\000"
+ "\031\000'\000\032\000(\000(\000)\000'\000)\000(\000*\000+\000,\000-\000,"
+ "\000+\000.\000/\000\017\0000\000\017\000/\000\015\000*\0001\000)\0001\000"
+ "*\0002\0003\000\007\000\004\000\007\0003\0004\0005\0006\0007\0006\0005\000"
+ "8\000\003\0009\000\001\0009\000\003\000:\000:\000;\0009\000;\000:\000<\000"
+ "0\000=\000>\000=\0000\000\017\000\077\000@\000A\000@\000\077\000B\000\017"
+ "\000C\000=\000C\000\017\000\016\000\016\000D\000C\000D\000\016\000\031\000"
+ "\031\000E\000D\000E\000\031\000'\000F\000,\000.\000'\000G\000E\000G\000'"
+ "\000)\000H\000I\000J\000I\000H\000K\000)\000L\000G\000L\000)\0001\000J\000"
+ "M\000N\000M\000J\000I\000O\0007\000P\0007\000O\0005\000Q\000R\000S\000S\000"
+ "R\000T\000U\000R\000Q\000V\000W\000X\000Y\000V\000X\000F\000&\000,\000Y\000"
+ "Z\000V\000Y\000[\000\134\000]\000^\000_\000[\000`\000a\000b\000\010\000c"
+ "\000`\000d\000e\000f\000g\000h\000f\000i\000g\000F\000j\000&\000k\000l\000"
+ "m\000l\000k\000n\000i\000o\000g\000i\000p\000o\000q\000d\000r\000d\000q\000"
+ "e\000d\000]\000r\000s\000t\000u\000p\000v\000t\000^\000f\000h\000w\000\030"
+ "\000\025\000\030\000w\000x\000c\000\010\000y\000y\000\010\000z\000z\000\010"
+ "\000{\000{\000\010\000|\000|\000\010\000}\000}\000\010\000\014\000S\000T"
+ "\000~\000\177\000T\000\200\000\201\000x\000w\000x\000\201\000\202\000x\000"
+ "\202\000\203\000\204\000\205\000\206\000j\000$\000&\000A\000Y\000X\000Y\000"
+ "A\000@\000\206\000\205\000U\000\207\000\210\000\211\000\212\000\213\000\214"
+ "\000U\000\205\000R\000<\000>\000;\000>\000<\0000\000\204\000\215\000\205"
+ "\000\010\000\200\000\216\000\217\000\220\000\221\000\220\000\217\000\222"
+ "\000\220\000\222\000\223\000\223\000\222\000\224\000\223\000\224\000\225"
+ "\000\225\000\224\000\226\000\225\000\226\000\227\000\227\000\226\000\230"
+ "\000\227\000\230\000\231\000\231\000\230\000\232\000\231\000\232\000\233"
+ "\000\231\000\233\000\234\000\231\000\234\000\235\000\010\000\216\000\236"
+ "\000\237\000:\000\003\000:\000\237\000\240\000\010\000\236\000\013\000\240"
+ "\000<\000:\000<\000\240\000\241\000\241\0000\000<\0000\000\241\000/\000\242"
+ "\000\003\000\000\000\003\000\242\000\237\000\243\000\244\000\245\000\246"
+ "\000\247\000\250\000\250\000\247\000b\000\215\000\251\000\252\000\215\000"
+ "\253\000\251\000\215\000\254\000\253\000\255\000\256\000\257\000\256\000"
+ "\255\000\260\000\261\000\260\000\255\000\260\000\261\000\262\000\260\000"
+ "\262\000\263\000\257\000\264\000\265\000\264\000\257\000\256\000\266\000"
+ "\203\000\202\000\203\000\266\000\265\000\203\000\265\000\264\000\267\000"
+ "\270\000\271\000\270\000\267\000\272\000\023\000\273\000\274\000\273\000"
+ "\023\000\022\000\275\000\276\000\272\000\276\000\275\000\277\000\276\000"
+ "\277\000\300\000\276\000\300\000\301\000\302\000\303\000\304\000\303\000"
+ "\302\000\305\000\306\000\307\000\310\000\311\000\312\000\313\000\310\000"
+ "\314\000\315\000\314\000\310\000\307\000\316\000\317\000\320\000\317\000"
+ "\316\000\321\000\322\000\323\000\324\000\323\000\322\000\325\000\325\000"
+ "\322\000\326\000\326\000\322\000\327\000\327\000\322\000\330\000\330\000"
+ "\322\000\331\000\331\000\322\000\332\000\332\000\322\000\333\000\307\000"
+ "\334\000\314\000\322\000\335\000\336\000\335\000\322\000\324\000\335\000"
+ "\324\000\337\000\337\000\324\000\340\000\340\000\324\000\341\000\341\000"
+ "\324\000\342\000\342\000\324\000\343\000\343\000\324\000\344\000\307\000"
+ "\345\000\334\000\346\000\347\000\350\000\351\000\347\000\346\000\352\000"
+ "\353\000\354\000\353\000\352\000\355\000\355\000\352\000\356\000\355\000"
+ "\356\000\357\000\357\000\356\000\350\000\357\000\350\000\347\000\360\000"
+ "\361\000\362\000\361\000\360\000\363\000\364\000\233\000\232\000\233\000"
+ "\364\000\365\000\366\000\367\000\370\000\367\000\366\000\371\000\371\000"
+ "\372\000\367\000\372\000\371\000\373\000\372\000\373\000\374\000\355\000"
+ "\375\000\353\000\375\000\355\000\376\000\376\000\355\000\357\000\376\000"
+ "\357\000\377\000\377\000\357\000\347\000\377\000\347\000\351\000\000\001"
+ "\001\001\002\001\001\001\000\001\003\001\004\001\005\001\006\001\005\001"
+ "\004\001\007\001\005\001\007\001\010\001\002\001\011\001\012\001\011\001"
+ "\002\001\001\001\013\001\014\001\015\001\014\001\013\001\016\001\017\001"
+ "\020\001\021\001\020\001\017\001\022\001\023\001\361\000\363\000\333\000"
+ "\024\001\332\000\024\001\333\000\362\000\362\000\333\000\360\000\015\001"
+ "\003\001\000\001\003\001\015\001\014\001\336\000\321\000\316\000\321\000"
+ "\336\000\335\000\025\001\026\001\027\001\026\001\025\001\030\001\243\000"
+ "\031\001\246\000\032\001\033\001\034\001\033\001\032\001\035\001\033\001"
+ "\035\001\036\001\036\001\035\001\037\001\036\001\037\001 \001 \001\037\001"
+ "!\001\042\001#\001$\001#\001\042\001%\001`\000&\001'\001(\001)\001*\001)"
+ "\001(\001+\001)\001+\001,\001,\001+\001-\001,\001-\001.\001.\001-\001\012"
+ "\001.\001\012\001\011\001.\001\011\001/\001/\001\011\0010\0010\001\011\001"
+ "1\0011\001\011\0012\001\006\0003\0014\0013\001\006\000\005\0005\001\244\000"
+ "\243\000\027\001\010\001\007\001\010\001\027\001\026\0016\001\202\0007\001"
+ "\373\000\034\001\374\000\034\001\373\0008\001\034\0018\001\032\0019\001:"
+ "\001;\001:\0019\001<\001\320\000\022\001\017\001\022\001\320\000\317\000"
+ "\025\001\370\000\030\001\370\000\025\001\366\000=\001>\001\077\001>\001="
+ "\001@\001\006\001\016\001\013\001\016\001\006\001\005\001\016\001\005\001"
+ "A\001B\001[\000C\001[\000B\001D\001E\001F\001G\001F\001E\001H\001\310\000"
+ "I\001J\001\211\000K\001L\001M\001\177\000\200\000^\000N\001_\000p\000t\000"
+ "s\000p\000s\000o\000O\001\134\000P\001`\000'\001a\000]\000_\000Q\001\266"
+ "\000\202\0006\001R\001S\001T\001U\001V\001P\001U\001P\001\134\000W\001X\001"
+ "Y\001\006\0004\001Z\001\004\000\006\000[\001\134\001\004\000[\001]\001^\001"
+ "_\001`\001a\001b\001b\001a\001W\001c\001d\001e\001f\001c\001g\001h\001f\001"
+ "i\0013\001`\0014\001j\0013\000\134\001_\001^\001k\0013\000\004\000\134\001"
+ "i\001f\001g\001g\001c\001e\0014\001`\001b\001e\001d\001l\001a\001X\001W\001"
+ "^\000h\000N\001]\000Q\001r\000[\000a\000C\001`\000e\000&\001[\000D\001m\001"
+ "i\001g\001n\001o\001p\001I\001q\001r\001s\001t\001u\001v\001w\001W\001Y\001"
+ "x\001e\001y\001z\001y\001{\001I\001p\001J\001\261\000\266\0006\001|\001Z"
+ "\001]\001}\001n\001~\001\027\000B\000\077\000B\000\027\000\026\000\177\001"
+ "[\001|\001\200\001x\001y\001\201\001\202\001\203\001u\001|\001\204\001\204"
+ "\001\205\001\206\001\315\000o\001I\001\207\001_\001\210\001q\001{\001\211"
+ "\001\212\001\213\001\207\001q\001\211\001r\001\214\001q\001\215\001\204\001"
+ "]\001\205\001r\001t\001\216\001|\001]\001\204\001y\001l\001j\001e\001l\001"
+ "y\001r\001\211\001t\001\202\001\217\001z\001g\001e\001x\001t\001\177\001"
+ "|\001|\001[\001Z\001\205\001]\001_\001\220\001\221\001\222\001t\001|\001"
+ "u\001\223\001\224\001p\0014\001b\001^\001\225\001\226\001G\001\211\001\134"
+ "\001\177\001p\001\202\001\201\001\211\001\177\001t\001\205\001_\001\207\001"
+ "\227\001o\001\315\000\230\001\231\001%\000\202\001\214\001\203\001{\001j"
+ "\001\211\001\276\000\232\001\233\001\232\001\276\000\234\001\314\000\334"
+ "\000\315\0007\001\235\001\236\001\042\000\237\001 \000\237\001\042\000\240"
+ "\001^\001b\001k\001\241\001n\001x\001k\001b\001W\001\242\001\243\001\244"
+ "\001\035\000\245\001\246\001\245\001\035\000\247\001\247\001\035\000\034"
+ "\000\250\001\251\001\242\001\252\001\253\001\254\001\253\001\252\001\255"
+ "\001\256\001\311\000K\000\257\001\260\001\261\001\262\001\365\000\364\000"
+ "\365\000\262\001\263\001\274\000\264\001\265\001\264\001\274\000\273\000"
+ "\266\001W\001\267\001\270\001\230\001%\000K\000\311\000\313\000\310\000\315"
+ "\000I\001\244\001\243\001\311\000\257\001\251\001\250\001$\000\270\001%\000"
+ "%\001\271\001#\001\271\001%\001\272\001\242\001\251\001\243\001~\000T\000"
+ "\177\000\272\001\037\000\271\001\037\000\272\001#\000\273\001\274\001\275"
+ "\001\177\001\134\001[\001\260\001\310\000\261\001\276\001\277\001\300\001"
+ "\277\001\276\001\301\001\257\001\261\001\251\001\302\001\376\000\303\001"
+ "\376\000\302\001\377\000\244\001\311\000\256\001\304\001\262\000\261\000"
+ "\262\000\304\001\225\001\205\001\207\001\213\001\305\001.\000+\000.\000\305"
+ "\001\306\001\260\001\306\000\310\000\210\001\307\001\207\001\246\001<\001"
+ "9\001<\001\246\001\245\001{\001y\001j\001\214\001z\001q\001\265\001@\001"
+ "=\001@\001\265\001\264\001n\001g\001x\001p\001\224\001\202\001m\000\263\001"
+ "\262\001\263\001m\000l\000\217\001x\001z\001\212\001\235\001\213\001l\001"
+ "4\0003\0004\000l\001d\001p\001\201\001J\0016\0017\001\212\001Z\0014\001^"
+ "\001\261\000\310\001\226\001\311\001\312\001\313\001\312\001\311\001\314"
+ "\001\314\001\311\001\315\001\315\001\311\001\316\001\316\001\311\001\317"
+ "\001\316\001\317\001\320\001\320\001\317\001\321\001\320\001\321\001\322"
+ "\001\322\001\321\001\323\001\322\001\323\001\324\001\324\001\323\001\325"
+ "\001\324\001\325\001\326\001\326\001\325\001\327\001[\001\006\000Z\001]\001"
+ "Z\001^\001z\001{\001q\001_\001\266\001\210\001\310\001\307\001\210\001\330"
+ "\001\310\001\210\001\211\001j\001\134\001u\001\204\001\331\001J\001\201\001"
+ "\332\001~\001n\001\217\001\333\001\266\001\334\001\216\001t\001\335\001l"
+ "\0013\000j\001\202\001\336\001\214\001\337\001\340\001\341\001\340\001\337"
+ "\001\342\001\343\0018\0005\000\343\0015\000O\000\344\001\345\001\346\001"
+ "\347\001\350\001\351\001\347\001\352\001\353\001\347\001\353\001\354\001"
+ "\347\001\354\001\355\001\347\001\355\001\356\001\347\001\356\001\357\001"
+ "\347\001\357\001\360\001\347\001\360\001\361\001\347\001\361\001\362\001"
+ "\347\001\362\001\363\001\347\001\363\001\364\001\347\001\364\001\365\001"
+ "\347\001\365\001\366\001\366\001\365\001\367\001\366\001\367\001\370\001"
+ "\366\001\370\001\371\001\366\001\371\001\372\001\366\001\372\001\373\001"
+ "\366\001\373\001\374\001\366\001\374\001\375\001\366\001\375\001\376\001"
+ "\366\001\376\001\377\001\377\001\376\001\000\002\377\001\000\002\001\002"
+ "\377\001\001\002H\001\203\001\214\001\215\001\261\001\002\002\003\002\261"
+ "\001\004\002\002\002\261\001\005\002\004\002\261\001\006\002\005\002\205"
+ "\001\213\001\206\001\201\001\007\002\332\001\201\001\203\001\007\002\251"
+ "\001\010\002\011\002\310\000\012\002\013\002\310\000\014\002\012\002J\001"
+ "\015\002\016\002J\001\332\001\015\002s\001r\001\216\001M\000\017\002N\000"
+ "\020\002\021\002\022\002M\000\023\002\021\002v\001u\001\331\001\331\001\204"
+ "\001\206\001t\001v\001\335\001\215\001q\001s\001\024\002\254\000\215\000"
+ "\025\002\026\002\027\002\030\002\024\002\031\002\024\002\215\000\204\000"
+ "\010\000M\001\200\000M\001\010\000\032\002M\001\032\002\033\002\034\002\035"
+ "\002\036\002\243\000\211\000\031\001\037\002 \002!\002\246\000\042\002\247"
+ "\000#\002\246\000$\002%\002[\000T\001[\000%\002\134\000[\000m\001T\001O\001"
+ "Y\000\134\000Y\000O\001Z\000O\000P\000&\002O\000&\002'\002O\000'\002(\002"
+ ")\002*\002+\002,\002-\002.\002,\002/\0020\0021\0022\0023\0024\0021\0023\002"
+ "5\0026\0024\0025\0027\0026\0025\0028\0027\0025\0029\0028\002:\002;\0026\002"
+ "<\002:\0026\002=\002<\0026\0027\002=\0026\002b\000>\002\010\000>\002b\000"
+ "\077\002\077\002b\000@\002@\002b\000A\002A\002b\000B\002b\000\247\000B\002"
+ "D\000C\002C\000C\002D\002C\000D\002E\002C\000,\0020\002F\002\251\001G\002"
+ "\010\002\261\001H\002\006\002\310\000\013\002I\002\344\001J\002\345\001\243"
+ "\001K\002L\002M\002N\002O\002\251\001\011\002P\002\243\001Q\002K\002\344"
+ "\001\346\001R\002\311\000S\002T\002,\002.\002/\0027\001U\002\235\001\211"
+ "\000K\001L\001L\001\211\000K\001\245\000\211\000\031\001\245\000\211\000"
+ "\031\001V\002W\002X\002W\002V\002Y\002Y\002V\002Z\002Y\002Z\002[\002Y\002"
+ "[\002\134\002Y\002\134\002]\002]\002\134\002^\002^\002\134\002_\002^\002"
+ "_\002`\002`\002_\002a\002`\002a\002b\002b\002a\002c\002b\002c\002d\002d\002"
+ "c\002e\002d\002e\002f\002f\002e\002g\002f\002g\002h\002h\002g\002i\002h\002"
+ "i\002j\002j\002i\002k\002j\002k\002l\002j\002l\002m\002m\002l\002n\002n\002"
+ "l\002o\002o\002l\002p\002p\002l\002q\002p\002q\002r\002p\002r\002s\002p\002"
+ "s\002t\002t\002s\002u\002t\002u\002v\002t\002v\002w\002t\002w\002x\002t\002"
+ "x\002y\002t\002y\002z\002z\002y\002{\002z\002{\002|\002z\002|\002}\002z\002"
+ "}\002~\002~\002}\002\177\002\177\002}\002\200\002\200\002}\002\201\002\201"
+ "\002}\002\202\002\202\002}\002\203\002\203\002}\002\204\002\203\002\204\002"
+ "\205\002\203\002\205\002\206\002\203\002\206\002\207\002\203\002\207\002"
+ "\210\002\210\002\207\002\211\002\211\002\207\002\212\002\212\002\207\002"
+ "\213\002\213\002\207\002\214\002\214\002\207\002\215\002\214\002\215\002"
+ "\216\002\216\002\215\002\217\002\216\002\217\002\220\002\220\002\217\002"
+ "\221\002\220\002\221\002\222\002\222\002\221\002\223\002\222\002\223\002"
+ "\224\002\222\002\224\002\225\002\225\002\224\002\226\002\225\002\226\002"
+ "\227\002\227\002\226\002\230\002\227\002\230\002\231\002\231\002\230\002"
+ "\232\002\231\002\232\002\233\002*\002\234\002+\002\235\002+\002\236\002+"
+ "\002\235\002)\002\237\002F\002\240\002F\002\237\002,\002\241\002\240\002"
+ "\242\002\240\002\241\002\237\002\243\002\242\002\244\002\242\002\243\002"
+ "\241\0025\0023\002U\0023\0025\0024\002\245\002M\002O\002M\002\245\002\246"
+ "\0022\002\247\0023\002\247\0022\002\250\002\347\001R\002\350\001R\002\347"
+ "\001\344\001\250\002\244\002\247\002\244\002\250\002\243\002\343\001(\002"
+ "\251\002(\002\343\001O\000\344\001\251\002J\002\251\002\344\001\343\001,"
+ "\002\236\002-\002\236\002,\002\235\002D\000\252\002C\002\252\002D\000E\000"
+ "t\000\246\002\245\002\246\002t\000v\000\002\000\253\002\254\002\253\002\002"
+ "\000\001\000\001\000\255\002\253\002\255\002\001\0009\0009\000\256\002\255"
+ "\002\256\0029\000;\000;\000\257\002\256\002\257\002;\000>\000\020\001\260"
+ "\002\021\001\260\002\020\001\261\002\261\002\020\001\251\000\251\000\020"
+ "\001\252\000\310\000\016\002\014\002\016\002\310\000J\001\261\001I\002H\002"
+ "I\002\261\001\310\000\251\001\003\002G\002\003\002\251\001\261\001=\000E"
+ "\002\262\002E\002=\000C\000>\000\262\002\257\002\262\002>\000=\000\243\001"
+ "P\002Q\002P\002\243\001\251\001\311\000L\002S\002L\002\311\000\243\001\312"
+ "\000T\002\023\002T\002\312\000\311\000E\000\263\002\252\002\263\002E\000"
+ "G\000G\000\264\002\263\002\264\002G\000L\000\347\001\351\001\352\0017\001"
+ "\235\001\236\001\000\000\001\000\001\000\002\000\000\000\002\000\000\000"
+ "\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006\000"
+ "\004\000\007\000\005\000\007\000\010\000\011\000\011\000\012\000\010\000"
+ "\012\000\010\000\013\000\011\000\013\000\012\000\014\000\010\000\014\000"
+ "\015\000\016\000\016\000\017\000\015\000\017\000\015\000\020\000\016\000"
+ "\020\000\021\000\022\000\022\000\023\000\021\000\023\000\021\000\024\000"
+ "\022\000\024\000\025\000\026\000\026\000\027\000\025\000\027\000\025\000"
+ "\030\000\026\000\030\000\020\000\031\000\016\000\031\000\020\000\032\000"
+ "\031\000\032\000\033\000\034\000\034\000\035\000\033\000\035\000\033\000"
+ "\036\000\034\000\036\000\037\000 \000\023\000 \000\023\000\037\000\037\000"
+ "\042\000 \000\042\000\037\000#\000\042\000#\000$\000%\000%\000&\000$\000"
+ "&\000\032\000'\000\031\000'\000\032\000(\000'\000(\000(\000)\000'\000)\000"
+ "(\000*\000)\000*\000+\000,\000\022\000,\000\022\000+\000\033\000+\000\033"
+ "\000,\000\017\000/\000\017\0000\000/\0000\000\015\000/\000*\0001\000)\000"
+ "1\000*\0002\0001\0002\000\007\0003\000\004\0003\0003\0004\000\007\0004\000"
+ "5\0006\000\000\0006\000\000\0005\0005\0008\0006\0008\000\003\0009\000\001"
+ "\0009\000\003\000:\0009\000:\000:\000;\0009\000;\000:\000<\000;\000<\000"
+ "0\000=\000=\000>\0000\000>\000\017\000=\000\077\000@\000@\000A\000\077\000"
+ "A\000\077\000B\000@\000B\000\017\000C\000=\000C\000\016\000C\000\016\000"
+ "D\000C\000D\000\031\000D\000\031\000E\000D\000E\000'\000E\000\035\000,\000"
+ "'\000G\000E\000G\000)\000G\0002\000I\0001\000I\0002\000K\000I\000K\000)\000"
+ "L\000G\000L\0001\000L\0001\000M\000L\000M\000I\000M\000\000\000O\000\002"
+ "\000O\0005\000O\000Q\000R\000R\000S\000Q\000S\000R\000T\000S\000T\000R\000"
+ "U\000Q\000U\000V\000W\000W\000X\000V\000X\000V\000Y\000X\000Y\000\035\000"
+ "&\000&\000,\000Y\000Z\000V\000Z\000Y\000[\000[\000\134\000Y\000\134\000]"
+ "\000^\000Q\000^\000Q\000]\000[\000`\000`\000a\000[\000a\000\010\000b\000"
+ "\010\000c\000b\000c\000`\000d\000d\000e\000`\000e\000f\000g\000g\000h\000"
+ "f\000h\000f\000i\000g\000i\000\035\000j\000&\000j\000#\000k\000#\000m\000"
+ "k\000m\000\042\000k\000i\000o\000g\000o\000i\000p\000o\000p\000d\000q\000"
+ "d\000r\000q\000r\000e\000q\000]\000d\000]\000r\000s\000t\000t\000u\000s\000"
+ "u\000p\000v\000t\000v\000p\000t\000^\000f\000^\000h\000\030\000w\000\025"
+ "\000w\000w\000x\000\030\000x\000\010\000y\000c\000y\000\010\000z\000y\000"
+ "z\000\010\000{\000z\000{\000\010\000|\000{\000|\000\010\000}\000|\000}\000"
+ "\014\000}\000T\000r\000S\000r\000T\000\177\000T\000\200\000\177\000\200\000"
+ "x\000\201\000w\000\201\000\201\000\202\000x\000\202\000\202\000\203\000x"
+ "\000\203\000\204\000\205\000h\000\205\000h\000\204\000$\000j\000A\000Y\000"
+ "A\000X\000@\000Y\000U\000\205\000U\000h\000\207\000\210\000\210\000\211\000"
+ "\207\000\211\000\207\000\214\000\210\000\214\000R\000\205\000<\000>\000;"
+ "\000>\0000\000<\000\204\000\215\000\205\000\215\000\010\000\200\000\200\000"
+ "\216\000\010\000\216\000\020\000/\000/\000\222\000\020\000\222\000\032\000"
+ "\222\000\222\000\224\000\032\000\224\000(\000\224\000\224\000\226\000(\000"
+ "\226\000*\000\226\0006\000\226\000*\0006\0002\0006\0002\0008\0008\000\233"
+ "\0002\000\233\000\233\000\234\0002\000\234\000K\000\234\000\216\000\236\000"
+ "\010\000\236\000:\000\226\000\003\000\226\000:\000\224\000\013\000\236\000"
+ "<\000\224\000<\000\222\0000\000\222\000\003\0006\000Z\000\243\000Z\000\245"
+ "\000\243\000\245\000\214\000\246\000\214\000\250\000\246\000\250\000b\000"
+ "\214\000b\000\250\000\215\000\251\000\251\000\252\000\215\000\252\000o\000"
+ "\215\000o\000\251\000\215\000\254\000o\000\254\000\255\000\256\000\256\000"
+ "\257\000\255\000\257\000\255\000\260\000\256\000\260\000\260\000\261\000"
+ "\255\000\261\000\261\000\262\000\260\000\262\000\262\000\263\000\260\000"
+ "\263\000\257\000\264\000\264\000\265\000\257\000\265\000\256\000\264\000"
+ "\203\000\266\000\202\000\266\000\265\000\266\000\203\000\265\000\203\000"
+ "\264\000\267\000\270\000\270\000\271\000\267\000\271\000\267\000\272\000"
+ "\270\000\272\000\023\000,\000\037\000,\000 \000\276\000\272\000\276\000 "
+ "\000\272\000\023\000\276\000\022\000\276\000+\000\276\000\234\000\302\000"
+ "\234\000\304\000\302\000\304\000K\000\302\000\306\000\307\000\307\000\310"
+ "\000\306\000\310\000M\000\311\000M\000\313\000\311\000\313\000\310\000\314"
+ "\000\314\000\315\000\310\000\315\000\307\000\314\000\316\000\317\000\317"
+ "\000\320\000\316\000\320\000\316\000\321\000\317\000\321\000\322\000\323"
+ "\000\323\000\324\000\322\000\324\000\322\000\325\000\323\000\325\000\322"
+ "\000\326\000\325\000\326\000\322\000\327\000\326\000\327\000\322\000\330"
+ "\000\327\000\330\000\322\000\331\000\330\000\331\000\322\000\332\000\331"
+ "\000\332\000\322\000\333\000\332\000\333\000\307\000\334\000\314\000\334"
+ "\000\322\000\335\000\335\000\336\000\322\000\336\000\324\000\335\000\324"
+ "\000\337\000\335\000\337\000\324\000\340\000\337\000\340\000\324\000\341"
+ "\000\340\000\341\000\324\000\342\000\341\000\342\000\324\000\343\000\342"
+ "\000\343\000\324\000\344\000\343\000\344\000\307\000\345\000\334\000\345"
+ "\000I\000\313\000K\000\313\0005\000\352\000O\000\352\000\352\000\355\000"
+ "5\000\355\000\352\000\356\000\355\000\356\000\356\000\357\000\355\000\357"
+ "\000M\000\356\000M\000\357\000\313\000\357\000\360\000\361\000\361\000\362"
+ "\000\360\000\362\000\360\000\363\000\361\000\363\000\233\000\364\0008\000"
+ "\364\000\364\000\365\000\233\000\365\000c\000\327\000y\000\327\000c\000\330"
+ "\000b\000\330\000b\000\331\000\250\000\331\0008\000\355\000\233\000\355\000"
+ "\233\000\357\000\234\000\357\000\234\000\313\000\236\000\341\000\236\000"
+ "\340\000\013\000\341\000}\000\324\000}\000\344\000}\000\323\000|\000\323"
+ "\000\216\000\340\000\216\000\337\000\011\000\343\000\011\000\342\000\012"
+ "\000\343\000\017\001\020\001\020\001\021\001\017\001\021\001\017\001\022"
+ "\001\020\001\022\001\361\000\023\001\363\000\023\001\333\000\024\001\332"
+ "\000\024\001\333\000\362\000\362\000\024\001\333\000\360\000\013\000\342"
+ "\000\321\000\336\000\316\000\336\000\321\000\335\000{\000\326\000{\000\325"
+ "\000z\000\326\000\134\000\243\000\134\000\246\000\243\000\246\000\243\000"
+ "\024\001\246\000\024\001\243\000\362\000V\000\362\000V\000\243\000V\000\361"
+ "\000W\000\361\000W\000\023\001\233\000#\001#\001$\001\233\000$\001\365\000"
+ "#\001`\000&\001\010\000&\001\010\000`\000\317\000\020\001\317\000\022\001"
+ "\321\000\020\001\252\000\321\000\252\000\020\001\252\000\335\000\215\000"
+ "\335\000\215\000\337\000\215\000\216\000\205\000\216\000R\000\216\000T\000"
+ "\216\000\006\0003\0013\0014\001\006\0004\001\005\0003\001|\000\325\000\202"
+ "\0006\001\201\0006\001\246\000\331\000\246\000\332\000$\000\302\000$\000"
+ "\304\000$\000<\001\302\000<\001\320\000\022\001\320\000\017\001y\000\326"
+ "\000#\001>\001$\001>\001%\000#\001%\000>\001\012\000\344\000\012\000}\000"
+ "[\000B\001[\000C\001B\001C\001B\001D\001[\000D\001E\001F\001F\001G\001E\001"
+ "G\001\267\000E\001\267\000F\001\310\000I\001I\001J\001\310\000J\001\134\000"
+ "\210\000\134\000\211\000\177\000M\001\200\000M\001U\000^\000p\000s\000o\000"
+ "s\000\134\000\245\000\211\000\245\000\010\000a\000S\000]\000\266\0006\001"
+ "E\001W\001G\001W\0014\001Z\001\006\000Z\001\006\000[\001\004\000[\001\004"
+ "\000\134\001[\001\134\001]\001^\001^\001_\001]\001_\001`\001a\001a\001b\001"
+ "`\001b\001W\001a\001W\001b\001c\001d\001d\001e\001c\001e\001c\001f\001c\001"
+ "g\001f\001g\001\345\000f\001\334\000f\0013\001`\0014\001`\0013\000j\0013"
+ "\000\134\001\134\001j\001^\001k\001_\001k\001\334\000g\001e\001g\0014\001"
+ "b\001d\001l\001e\001l\001E\001a\001a\000C\001e\000&\001\207\000D\001[\000"
+ "\207\000g\001n\001\334\000n\001o\001p\001I\001p\001I\001o\001q\001r\001r"
+ "\001s\001q\001s\001t\001u\001u\001v\001t\001v\001W\001w\001G\001w\001e\001"
+ "x\001e\001y\001x\001y\001y\001z\001y\001{\001z\001{\001J\001p\001\261\000"
+ "\266\000\261\0006\001Z\001|\001Z\001]\001]\001|\001n\001o\001\334\000o\001"
+ "\027\000B\000\027\000\077\000\026\000B\000[\001\177\001[\001|\001|\001\177"
+ "\001x\001z\001\201\001\202\001\202\001\203\001\201\001\203\001u\001|\001"
+ "|\001\204\001u\001\204\001\204\001\205\001\205\001\206\001\204\001\206\001"
+ "\315\000o\001\315\000I\001_\001\207\001_\001\210\001\207\001\210\001q\001"
+ "{\001{\001\211\001q\001\211\001\212\001\213\001\207\001\213\001\207\001\212"
+ "\001r\001\211\001q\001\214\001q\001\215\001\214\001\215\001]\001\204\001"
+ "]\001\205\001r\001t\001t\001\216\001r\001\216\001l\001y\001j\001l\001j\001"
+ "y\001t\001\211\001\202\001\217\001z\001\217\001z\001\202\001g\001x\001t\001"
+ "\177\001t\001|\001Z\001[\001_\001\205\001\262\000F\001\263\000F\001o\001"
+ "\217\001p\001\217\001^\001b\0014\001^\001F\001w\001\134\001\211\001\134\001"
+ "\177\001\177\001\211\001p\001\202\001p\001\201\001\205\001\207\001\315\000"
+ "\334\000\234\000>\001%\000\234\000\202\001\214\001\203\001\214\001j\001{"
+ "\001j\001\211\001\276\000\306\000\306\000\233\001\276\000\233\001\276\000"
+ "\307\000\201\000\235\001\212\001\235\001\201\000\212\001\042\000\272\000"
+ "\042\000\270\000b\001k\001n\001\217\001n\001x\001x\001\217\001W\001k\001"
+ "\242\001\243\001<\001\243\001<\001\242\001\035\000\242\001j\000\242\001\035"
+ "\000\247\001\242\001\247\001\034\000\247\001\247\001\251\001\242\001\251"
+ "\001\036\000\233\001\033\000\233\001\036\000\306\000\302\000\311\000K\000"
+ "\311\000\036\000\261\001\034\000\261\001\365\000\262\001\364\000\262\001"
+ "\262\001\263\001\365\000\263\001\037\000&\000&\000\265\001\037\000\265\001"
+ "k\001w\001%\000\304\000\311\000\243\001\311\000<\001\034\000\251\001\365"
+ "\000\265\001#\001\265\001\263\001\265\001\243\001\251\001r\000\177\000\037"
+ "\000\263\001#\000\263\001\267\000\274\001F\001\274\001\036\000\310\000\310"
+ "\000\261\001\042\000\271\000k\000\271\000\251\001\261\001\233\000>\001\262"
+ "\000w\001\261\000w\001\205\001\213\001\033\000\276\000\210\001\212\001j\000"
+ "<\001z\001\214\001q\001z\001%\000\265\001m\000\263\001m\000\262\001\213\001"
+ "\235\0014\000l\0013\000l\0014\000d\001J\001\201\0016\001\212\001Z\001^\001"
+ "6\001w\001\272\000E\001\276\000E\001\307\000E\001\345\000E\001\345\000a\001"
+ "a\001f\001`\001f\001`\001c\0013\001c\0013\001d\001\005\000d\001\005\0004"
+ "\000k\001\210\0016\001\210\0016\001k\001\204\001\331\001u\001\331\001\201"
+ "\001\332\001J\001\332\001t\001\335\001\216\001\335\001\021\000\276\000\021"
+ "\000\272\000\024\000\276\0005\000\364\000O\000\364\000\262\001\345\001\345"
+ "\001\346\001\262\001\346\001m\000\350\001\350\001\351\001m\000\351\001m\000"
+ "\352\001v\000\352\001m\000v\000m\000p\000i\000m\000f\000m\000^\000m\000]"
+ "\000m\000d\000m\000`\000m\000[\000m\000Y\000m\000@\000m\000@\000k\000B\000"
+ "k\000\026\000k\000\030\000k\000k\000x\000k\000\203\000k\000\264\000k\000"
+ "\256\000k\000\260\000\260\000\271\000\263\000\271\000\271\000F\001\203\001"
+ "\215\001\261\001\002\002\002\002\003\002\261\001\003\002\261\001\004\002"
+ "\002\002\004\002\261\001\005\002\004\002\005\002\261\001\006\002\005\002"
+ "\006\002\206\001\213\001\201\001\007\002\332\001\007\002\203\001\007\002"
+ "\251\001\010\002\010\002\011\002\251\001\011\002\310\000\012\002\012\002"
+ "\013\002\310\000\013\002\310\000\014\002\012\002\014\002J\001\015\002\015"
+ "\002\016\002J\001\016\002\332\001\015\002s\001\216\001M\000\017\002L\000"
+ "\017\002M\000\021\002\017\002\021\002M\000\023\002\021\002\023\002v\001\331"
+ "\001\206\001\331\001v\001\335\001s\001\215\001\254\000\024\002\215\000\024"
+ "\002\024\002\027\002\254\000\027\002g\000\024\002g\000\027\002\204\000\024"
+ "\002\010\000M\001&\001M\001q\000&\001q\000M\001\211\000\243\000\210\000\246"
+ "\000[\000\210\000[\000\214\000Y\000\245\000\002\000&\002O\000&\002&\002'"
+ "\002O\000'\002'\002(\002O\000(\002t\000+\002u\000+\002\017\001-\002-\002"
+ ".\002\017\001.\002\017\001/\002/\0020\002\017\0010\002\333\0003\002\360\000"
+ "3\002\363\0003\002\201\000\023\001\201\000\363\000\027\000\201\000\027\000"
+ "\023\001\025\000\201\000X\000\023\001A\000\023\001\077\000\023\001a\000b"
+ "\000b\000C\001b\000B\001b\000D\001b\000\207\000D\000C\002C\000C\002C\002"
+ "D\002C\000D\002D\002E\002C\000E\0020\002F\002\017\001F\002\251\001G\002\010"
+ "\002G\002\261\001H\002\006\002H\002\013\002I\002\310\000I\002\262\001J\002"
+ "\345\001J\002\243\001K\002K\002L\002\243\001L\002\350\001O\002\351\001O\002"
+ "\011\002P\002\251\001P\002\243\001Q\002K\002Q\002\346\001R\002\262\001R\002"
+ "\311\000S\002S\002T\002\311\000T\002.\002/\002\201\000U\002\235\001U\002"
+ "E\002W\002W\002X\002E\002X\002E\002Y\002W\002Y\002D\002Y\002C\002Y\002C\002"
+ "\134\002Y\002\134\002\134\002]\002Y\002]\002\134\002^\002]\002^\002\134\002"
+ "_\002^\002_\002&\002_\002&\002^\002\017\002_\002\017\002&\002\017\002'\002"
+ "\021\002'\002\021\002(\002\023\002(\002\023\002f\002(\002f\002\023\002T\002"
+ "T\002f\002J\002T\002J\002f\002J\002S\002\345\001S\002L\002S\002\345\001L"
+ "\002\345\001K\002\346\001K\002K\002R\002\350\001K\002\350\001R\002K\002O"
+ "\002O\002Q\002P\002Q\002O\002P\002\011\002O\002\011\002t\002O\002t\002\010"
+ "\002t\002G\002t\002\003\002G\002\003\002t\002\002\002t\002\004\002t\002\004"
+ "\002+\002+\002t\002\005\002+\002\006\002+\002+\002H\002H\002~\002+\002~\002"
+ "-\002H\002-\002~\002.\002H\002/\002H\0020\002H\002F\002H\002H\002I\002F\002"
+ "I\002\013\002F\002\012\002F\002\014\002F\002\014\002\210\002F\002\210\002"
+ "\014\002\211\002\210\002\211\002\014\002\212\002\211\002\212\002\014\002"
+ "\213\002\212\002\213\002\014\0023\0023\002\213\002\014\002\016\002\016\002"
+ "3\002\016\002U\0023\002U\002\015\002U\002\235\001\015\002\235\001\332\001"
+ "\213\001\332\001\213\001\007\002\203\001\213\001\203\001\206\001\206\001"
+ "\215\001\215\001\331\001s\001\331\001s\001v\001v\001\216\001t\000t\002\021"
+ "\001+\002\021\001~\002u\000\021\001\320\000F\002\320\000\210\002\316\000"
+ "\210\002\316\000\211\002\336\000\211\002\336\000\212\002\201\0003\002\351"
+ "\001t\002\352\001t\002\351\001\352\001\333\000\213\002\322\000\213\002m\000"
+ "R\002\322\000\212\002\364\000(\002\364\000f\002\262\001f\002\017\001~\002"
+ "D\000\134\002E\000\134\002t\000\352\001\002\000^\002\001\000^\002\001\000"
+ "]\0029\000]\0029\000Y\002;\000Y\002;\000W\002>\000W\002u\000\020\001s\000"
+ "\020\001\251\000\020\001s\000\251\000\310\000\016\002\261\001I\002\251\001"
+ "\003\002=\000E\002=\000X\002>\000X\002\243\001P\002\311\000L\002M\000T\002"
+ "E\000_\002G\000_\002G\000\017\002|4\225\342p\373\000\000\356,q\346\010\011"
+ "\000\000\224-\012\340\324\007\000\000`3\352\352{\375\000\000`.,\330]\006"
+ "\000\000s5\042\330\251\371\000\000k\015\370\020\006^\000\000\216\030\215"
+ "\021\243M\000\000\241\016\206\027\243M\000\000\216\030\206\016sT\000\000"
+ "0\027\027\013\006^\000\000\236\035\240\022\212%\000\000\022\034\212\021V"
+ "(\000\000V\035e\017\373%\000\000\240\033.\0245)\000\000r\033\272\020u)\000"
+ "\000_\037o\001\225^\000\000y\023\275\001\031l\000\000S\032\032\372\031l\000"
+ "\000q\036\001\003\006^\000\000\234$_\364\033a\000\000\224\037'\360\031l\000"
+ "\000\263!\177\3756^\000\0007'1\354<z\000\000r'y\353\223`\000\000r'y\353T"
+ "z\000\000\234$_\364\033a\000\000\263!\177\375\021s\000\000\263!\177\3756"
+ "^\000\000`.,\330]\006\000\000a.\042\330\340|\000\000a.\042\330[\006\000\000"
+ "Y,1\354<z\000\000\224-\012\340\324\007\000\000\356,q\346\010\011\000\000"
+ "@,%\355V\012\000\000@,%\355\327y\000\000[0T\365\011\003\000\000\245)Q\365"
+ "'\017\000\000\205+n\357\255\013\000\000\230-\007\374\037\010\000\000<&\002"
+ "\000\201\025\000\000M(\002\006\336\021\000\000:%\026\012\206\027\000\000"
+ "\314#v\004\003\032\000\000\362'\211\346-b\000\000\342\042\221\344\031l\000"
+ "\000r'y\353\223`\000\000\003$\042\330\031l\000\000h)\042\330\342a\000\000"
+ "h)\042\330\340|\000\000\362'\211\346-b\000\000h)\042\330\342a\000\000a.\042"
+ "\330[\006\000\000/M\042\330\001\200\000\000\001&\271\000\025q\000\000\340"
+ " \343\376~r\000\000\263!\177\375\021s\000\000\306\016R\030_G\000\000\216"
+ "\030\011\024\016<\000\000$\021\177\030\016<\000\000\001&\271\000\356\025"
+ "\000\000\233\035\360\016,f\000\000\001&\271\000\025q\000\000\314#v\004\003"
+ "\032\000\000V\035e\017\373%\000\000\022\034\212\021\311b\000\000\022\034"
+ "\212\021V(\000\000\237\030\017\015\022J\000\000\216\030\206\016sT\000\000"
+ "\216\030\371\014sW\000\000\216\030\215\021\243M\000\000\205+n\357\255\013"
+ "\000\000\245)Q\365'\017\000\000<&\002\000\201\025\000\000h)\042\330\340|"
+ "\000\000Y,1\354<z\000\000r'y\353Tz\000\000a.\042\330\340|\000\000@,%\355"
+ "V\012\000\000@,%\355\327y\000\0007'1\354<z\000\000_\037o\001\225^\000\000"
+ "\340 \343\376~r\000\000q\036\001\003\006^\000\000\021\032\360\016,f\000\000"
+ "\237\030\017\015\235g\000\000\233\035\360\016,f\000\000M(\002\006\336\021"
+ "\000\000\230-\007\374\037\010\000\000\200B\000\000\001\200\000\000[0T\365"
+ "\011\003\000\000wJ\305\354\001\200\000\000w\015\277\027\243M\000\000r\375"
+ "\302\031\243M\000\000\010\017\302\031\016<\000\000r\375\023\034\016<\000"
+ "\000\022\034\212\021\311b\000\000\236\035\240\022\212%\000\000:%\026\012"
+ "\206\027\000\000\3245\204\020\001\200\000\000Q%0\035\001\200\000\000\026"
+ "\022'%\001\200\000\000\030\007a\007\031l\000\000r\375-\010\031l\000\000\326"
+ "\004\275\371\345v\000\000\012\012\235\021\006^\000\000r\375\371\022\006^"
+ "\000\000r\375\032\372\345v\000\000k\003\240\351\256}\000\000\216\030\211"
+ "\025\332-\000\000\237\030\017\015v-\000\000\237\030\211\025v-\000\000r\375"
+ "\267\351\256}\000\0000\027\036\351\345v\000\000\207\031\355\340\345v\000"
+ "\000\357\002\042\330\377\177\000\0008\356\355\340\256}\000\000v\354\257\334"
+ "\256}\000\000k\015\355\340\256}\000\000y\023'\360\345v\000\000\177\013\221"
+ "\344\256}\000\000\375\010\134\347\256}\000\000\241\016\215\365\345v\000\000"
+ "\012\017\042\330\256}\000\000\241\016\257\334\256}\000\000\216\030\371\014"
+ "sW\000\000\007\340\036\351\345v\000\000\242\334\355\340\345v\000\000\021"
+ "\006\036\351\256}\000\000z\333\032\372\031l\000\000\327\323'\360\031l\000"
+ "\000m\345'\360\345v\000\000\375\010\362\370\345v\000\000\012\317\221\344"
+ "\031l\000\000\177\013\212\006\031l\000\000}\312\215\365\006^\000\000\327"
+ "\323\275\001\006^\000\000\237\030\017\015\235g\000\000\235\304\362\370\243"
+ "M\000\000\012\317\212\006\243M\000\000\003\361\221\344\256}\000\000\345\370"
+ "\036\351\256}\000\000\235\304\134\347\006^\000\000\250\364\362\370\345v\000"
+ "\000\003\361\212\006\031l\000\0008\356\370\020\006^\000\000v\354\206\027"
+ "\243M\000\000\335\353\302\031\016<\000\000\016\276\036\351\243M\000\000\233"
+ "\302\032\372\016<\000\000g\315-\010\016<\000\000\007\340\027\013\006^\000"
+ "\000\242\334\370\020\243M\000\000z\333\371\022\016<\000\000\250\364\134\347"
+ "\256}\000\000v\354\215\365\345v\000\000m\345\275\001\031l\000\000\233\302"
+ "\042\330\006^\000\000g\315\042\330\031l\000\000S\032\042\330\345v\000\000"
+ "\322\273\267\351\016<\000\000\335\353\042\330\256}\000\000z\333\042\330\345"
+ "v\000\000\322\273\042\330\243M\000\000\201\271\042\330\016<\000\000\237\030"
+ "\017\015v-\000\000\001&\271\000\356\025\000\000\237\030\017\015\235g\000"
+ "\000\216\030\371\014sW\000\0000\027\027\013\006^\000\000\240\033.\0245)\000"
+ "\000\237\030\017\015\022J\000\000\021\032\360\016,f\000\000\237\030\017\015"
+ "v-\000\000r\033\272\020u)\000\000\022\034\212\021\311b\000\000\022\034\212"
+ "\021V(\000\000\230-\007\374\037\010\000\0000\027\027\013\006^\000\000[0T"
+ "\365\011\003\000\000\237\030\017\015v-\000\000\216\030\011\024\016<\000\000"
+ "\237\030\211\025v-\000\000\216\030\211\025\332-\000\000;\274\311\3759\301"
+ "\000\000\007\276N\000l\277\000\000\024\302\023\006_\273\000\000\236\307\366"
+ "\015\326\265\000\0002\265~\353A\310\000\000d\266\217\356\020\307\000\000"
+ "\321\262\042\330\242\312\000\000>\263\213\3336\312\000\000\325\326\004\033"
+ "\236\246\000\000\322\311\322\017\242\263\000\000$\351\354#P\224\000\000\077"
+ "\331-\0344\244\000\000r\375\336'\001\200\000\000r\375\336'\001\200\000\000"
+ "\243\077\000\000\001\200\000\000r\375\000\000\001\200\000\000\026\022'%\001"
+ "\200\000\000Q%0\035\001\200\000\000\3245\204\020\001\200\000\000\200B\000"
+ "\000\001\200\000\000\243\077\042\330\001\200\000\000/M\042\330\001\200\000"
+ "\000wJ\305\354\001\200\000\000>\263\213\3336\312\000\000\245\316\042\330"
+ "\317\256\000\000\321\262\042\330\242\312\000\000\245\316\000\000\317\256"
+ "\000\0002\265~\353A\310\000\000d\266\217\356\020\307\000\000;\274\311\375"
+ "9\301\000\000\007\276N\000l\277\000\000r\375\000\000\001\200\000\000r\375"
+ "\336'\001\200\000\000\024\302\023\006_\273\000\000\236\307\366\015\326\265"
+ "\000\000\322\311\322\017\242\263\000\000\325\326\004\033\236\246\000\000"
+ "\077\331-\0344\244\000\000$\351\354#P\224\000\000Y\004Q\000Q\000W\005R\000"
+ "X\002\035\077(C\032M+9(3Q\377Q\377Q\377O\377M\0002&')3\037.)=\033=\026:\037"
+ "\240\341\232\347\224\355\240\341\250\331\250\331s\014s\014s\014s\014s\014"
+ "s\014l\023f\031U\007Q\377Q\377T\006Q\377Q\377Q\377Q\377I\016@\014E\024I\007"
+ "N\007\215\364\215\364\215\364Q\000c\011\006,\0023\006&!S,I+LU*P/]\042P/P"
+ "/P/P/}\002}\001}\001~\001`\037`\037`\037\000\017\377\027\000\027\000\017"
+ "Q\377\003!\003\033\260\321\260\321\271\320\000=\0007\000=J)U\034O#T\013\134"
+ "\023\015X\002d\033Z\376r\000HA5I-A5,M\034\134\010:\000>\005-\013I\000P\376"
+ "+\003\035x\000j\001T\000\376\032/\0223\011\003\012\352\016\347\010\036\015"
+ "%\032\031\022\021\027\033!&\003#\00760\335\025\327\014\011\032\332%\320\031"
+ "\344\035\017(\307\015\0265\307!\322.\274\317\275'\3117\356\023\372\033\274"
+ "\022\365*\3627\356D\352R\343Y\256\026\263*\3009\3379\331C\321H\364\027\354"
+ "$\345/\270\011\304\010:\005\241\027\343\004\321\006\250\014\231\015Z\000"
+ "Q\377\2707\2676\26654D\2707\2707\2707\2707\2707\2707S\013\307\315V\032w\001"
+ "\177\000,L-J\266/\2735\2734\306\077\244\035\252#\225\016\225\016\326P\313"
+ "E\352c\334V\000x\201\177\177\177\201\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\201@\201@\201@\201\300\201@\201@\201\300\201\300"
+ "\201\300\201@\201@\201@\201\300\201@\201@\201\300\000\000\001\000\002\000"
+ "\001\000\000\000\003\000\000\000\004\000\005\000\004\000\000\000\002\000"
+ "\006\000\007\000\010\000\007\000\006\000\011\000\011\000\006\000\012\000"
+ "\013\000\014\000\015\000\014\000\016\000\017\000\016\000\014\000\013\000"
+ "\020\000\021\000\022\000\021\000\020\000\023\000\021\000\023\000\012\000"
+ "\024\000\022\000\025\000\022\000\024\000\026\000\022\000\026\000\020\000"
+ "\027\000\030\000\031\000\030\000\027\000\032\000\032\000\027\000\033\000"
+ "\032\000\033\000\034\000\035\000\036\000\037\000\036\000\035\000 \000 \000"
+ "\035\000!\000 \000!\000\042\000 \000\042\000#\000 \000#\000$\000%\000&\000"
+ "'\000&\000%\000(\000(\000)\000&\000)\000(\000*\000+\000\015\000,\000\015"
+ "\000+\000\013\000-\000\025\000.\000\025\000-\000/\000\025\000/\000\024\000"
+ "-\0000\0001\0000\000-\000.\0002\0003\0004\0003\0002\000\031\0003\000\031"
+ "\000\030\000\004\0005\000\005\000\000\000\005\0006\0007\0008\0009\000:\000"
+ ";\000<\000;\000:\000\007\000\007\000:\000\010\000=\000>\000\077\000>\000"
+ "=\000@\000>\000@\000A\000>\000A\000B\000B\000A\000C\000D\000E\000F\000E\000"
+ "D\000G\000H\000$\000#\000$\000H\000\077\000\077\000H\000I\000\077\000I\000"
+ "J\000\077\000J\000=\000K\000L\000M\000L\000K\000N\000\003\000O\000\001\000"
+ "O\000\003\000%\000O\000%\000'\000P\0009\000Q\000\033\000R\000\034\000R\000"
+ "\033\000S\000R\000S\000T\0008\000U\000V\000U\0008\000W\000W\0008\0007\000"
+ "L\000P\000M\000X\000Y\000Z\000P\000Q\000M\000[\000\003\000\134\000]\000:"
+ "\000^\000^\000:\000_\000^\000_\000`\000P\0007\0009\000W\000a\000U\000b\000"
+ "c\000d\000<\000e\000f\000g\000h\000i\000j\000]\000k\000i\000l\000m\000n\000"
+ "o\000p\000h\000j\000k\000h\000g\000j\000i\000h\000l\000m\000l\000q\000k\000"
+ "]\000^\000.\000r\000s\000r\000.\000\025\000t\000u\000v\000w\000x\000y\000"
+ "x\000w\000r\000r\000\022\000x\000\022\000r\000\025\000w\000y\000t\000y\000"
+ "z\000t\000y\000{\000z\000{\000y\000x\000|\000}\000t\000x\000\021\000{\000"
+ "\021\000x\000\022\000\011\000\012\000~\000v\000\177\000\200\000\177\000v"
+ "\000u\000z\000\201\000t\000\177\000\202\000\203\000\202\000\177\000\204\000"
+ "z\000\205\000\201\000\205\000z\000{\000\200\000\203\000\206\000\203\000\200"
+ "\000\177\000\207\000\012\000\006\000\012\000\207\000\021\000{\000\207\000"
+ "\205\000\207\000{\000\021\000\202\000\210\000\203\000\210\000\202\000\211"
+ "\000\212\000T\000S\000:\000<\000_\000\211\000\213\000\210\000\213\000\211"
+ "\000\214\000u\000\204\000\177\000\204\000u\000\215\000m\000q\000t\000t\000"
+ "q\000\216\000\203\000\217\000\206\000\217\000\203\000\210\000\216\000l\000"
+ "\220\000l\000\216\000q\000\220\000h\000\221\000h\000\220\000l\000\221\000"
+ "k\000\222\000k\000\221\000h\000\222\000^\000\223\000^\000\222\000k\000\223"
+ "\000`\000\224\000`\000\223\000^\000\210\000\225\000\217\000\225\000\210\000"
+ "\213\000}\000w\000t\000\214\000\226\000\213\000\226\000\214\000\227\000\230"
+ "\000\223\000\231\000\223\000\230\000\222\000\231\000\224\000\232\000\224"
+ "\000\231\000\223\000t\000\216\000\233\000\233\000\220\000\234\000\220\000"
+ "\233\000\216\000\234\000\221\000\235\000\221\000\234\000\220\000t\000\233"
+ "\000\215\000\235\000\222\000\230\000\222\000\235\000\221\000\206\000\236"
+ "\000\237\000\236\000\206\000\217\000\215\000\234\000\204\000\234\000\215"
+ "\000\233\000}\000r\000w\000r\000}\000s\000\204\000\235\000\202\000\235\000"
+ "\204\000\234\000\202\000\230\000\211\000\230\000\202\000\235\000\211\000"
+ "\231\000\214\000\231\000\211\000\230\000t\000\215\000u\000\214\000\232\000"
+ "\227\000\232\000\214\000\231\000.\000\240\0000\000\240\000.\000s\000\213"
+ "\000\241\000\225\000\241\000\213\000\226\000t\000v\000\242\000\242\000\200"
+ "\000\243\000\200\000\242\000v\000\243\000\206\000\237\000\206\000\243\000"
+ "\200\000\217\000\244\000\236\000\244\000\217\000\225\000\225\000\245\000"
+ "\244\000\245\000\225\000\241\000|\000s\000}\000s\000|\000\240\000\205\000"
+ "g\000i\000g\000\205\000\207\000j\000\010\000]\000\010\000j\000\006\000<\000"
+ "f\000_\000j\000\207\000\006\000\207\000j\000g\000\017\000p\000\246\000p\000"
+ "\017\000\016\000\201\000i\000m\000i\000\201\000\205\000\201\000m\000t\000"
+ "\010\000:\000]\000*\000\247\000)\000\247\000*\000,\000,\000*\000+\000\250"
+ "\000\251\000\252\000\134\000\003\000\000\000\253\000b\000d\000\250\000\254"
+ "\000\251\000\254\000\250\000\255\000\254\000\255\000\256\000\256\000\255"
+ "\000\257\000\257\000\255\000\260\000\257\000\260\000\261\000Z\000\262\000"
+ "[\000\212\000\263\000T\000Z\000\264\000\134\000d\000c\000X\000\253\000d\000"
+ "e\000d\000X\000Z\000\134\000\000\0006\000n\000G\000\265\000G\000n\000\266"
+ "\000G\000D\000\265\000\267\000\253\000e\000<\000\267\000e\000<\000\270\000"
+ "\267\000\270\000<\000;\000\227\000\271\000\226\000\271\000\227\000\272\000"
+ "\227\000\273\000\272\000\273\000\227\000\274\000\226\000\275\000\241\000"
+ "\275\000\226\000\276\000\271\000\276\000\226\000\241\000\277\000\245\000"
+ "\277\000\241\000\300\000\275\000\300\000\241\000\232\000\301\000\302\000"
+ "\274\000\232\000\302\000\232\000\274\000\227\000\224\000\303\000\304\000"
+ "\301\000\224\000\304\000\224\000\301\000\232\000`\000f\000\305\000f\000`"
+ "\000_\000\303\000`\000\305\000`\000\303\000\224\000\306\000\307\000\310\000"
+ "\307\000\306\000\311\000\307\000\311\000\312\000\307\000\312\000\313\000"
+ "\307\000\313\000\314\000\307\000\314\000\315\000\315\000\314\000\316\000"
+ "\316\000\314\000\317\000\320\000\321\000\322\000\321\000\320\000\323\000"
+ "\323\000\320\000\324\000\323\000\324\000\325\000\323\000\325\000\326\000"
+ "\323\000\326\000\327\000\323\000\327\000\330\000\330\000\327\000\331\000"
+ "\331\000\327\000\332\000\331\000\332\000\333\000\331\000\333\000\334\000"
+ "\331\000\334\000\335\000\331\000\335\000\336\000\331\000\336\000\337\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000"
+ "\003\000\000\000\004\000\004\000\005\000\000\000\005\000\002\000\004\000"
+ "\006\000\007\000\007\000\010\000\006\000\010\000\006\000\011\000\007\000"
+ "\011\000\006\000\012\000\011\000\012\000\013\000\014\000\014\000\015\000"
+ "\013\000\015\000\014\000\016\000\016\000\017\000\014\000\017\000\013\000"
+ "\016\000\020\000\021\000\021\000\022\000\020\000\022\000\020\000\023\000"
+ "\021\000\023\000\012\000\023\000\012\000\021\000\022\000\024\000\022\000"
+ "\025\000\024\000\025\000\024\000\026\000\022\000\026\000\020\000\026\000"
+ "\027\000\030\000\030\000\031\000\027\000\031\000\024\000\027\000\024\000"
+ "\030\000\027\000\033\000\024\000\033\000\026\000\033\000\004\000\036\000"
+ "\036\000\037\000\004\000\037\000\004\000 \000\036\000 \000\002\000 \000\001"
+ "\000 \000\001\000#\000 \000#\000#\000$\000 \000$\000%\000&\000&\000'\000"
+ "%\000'\000%\000(\000&\000(\000(\000)\000&\000)\000(\000*\000)\000*\000\015"
+ "\000+\000\015\000,\000+\000,\000\013\000+\000\025\000-\000\025\000.\000-"
+ "\000.\000\030\000-\000\025\000\030\000-\0000\0000\0001\000-\0001\000.\000"
+ "0\000-\0002\0001\0002\000\031\0002\000\031\000-\000\005\000\037\000\005\000"
+ "6\000\000\0006\0007\0008\000\033\0008\000\033\0007\000:\000;\000;\000<\000"
+ ":\000<\000\007\000:\000\007\000;\000\010\000:\000=\000>\0007\000>\0007\000"
+ "=\000,\000=\000,\000>\000\015\000>\000\015\000B\000>\000B\000\014\000B\000"
+ "\011\000D\000\011\000F\000D\000F\000\007\000D\000$\000'\000#\000'\000'\000"
+ "7\000$\0007\000&\0007\000)\0007\000)\000=\000 \0002\000\031\000 \000\036"
+ "\0002\000\003\000#\000\003\000%\000#\000%\000\033\000$\000\027\000$\000\020"
+ "\000\033\000\020\0008\000\023\0008\0008\000U\000U\000V\0008\000V\0008\000"
+ ">\000>\000U\000\031\000$\000(\000Z\000*\000Z\000\003\000\134\000%\000\134"
+ "\000:\000]\000:\000^\000]\000^\000:\000_\000^\000_\000_\000`\000^\000`\000"
+ "B\000U\000+\000d\000\013\000d\000<\000e\000e\000f\000<\000f\000g\000h\000"
+ "h\000i\000g\000i\000]\000j\000]\000k\000j\000k\000i\000l\000l\000m\000i\000"
+ "m\000n\000o\000o\000p\000n\000p\000h\000j\000h\000k\000g\000j\000h\000l\000"
+ "l\000q\000m\000q\000^\000k\000.\000r\000r\000s\000.\000s\000\025\000r\000"
+ "t\000u\000u\000v\000t\000v\000w\000x\000x\000y\000w\000y\000r\000w\000r\000"
+ "x\000\022\000r\000\022\000x\000t\000y\000t\000w\000y\000z\000t\000z\000y"
+ "\000{\000z\000{\000x\000{\000|\000}\000t\000}\000t\000|\000\021\000x\000"
+ "\021\000{\000\012\000F\000v\000\177\000\177\000\200\000v\000\200\000u\000"
+ "\177\000z\000\201\000t\000\201\000\177\000\202\000\202\000\203\000\177\000"
+ "\203\000\177\000\204\000\202\000\204\000z\000\205\000\201\000\205\000{\000"
+ "\205\000\200\000\203\000\203\000\206\000\200\000\206\000\012\000\207\000"
+ "\006\000\207\000\021\000\207\000{\000\207\000\205\000\207\000\202\000\210"
+ "\000\203\000\210\000\202\000\211\000\210\000\211\000\023\000V\000<\000_\000"
+ "\211\000\213\000\210\000\213\000\211\000\214\000\213\000\214\000u\000\204"
+ "\000u\000\215\000\204\000\215\000q\000t\000m\000t\000q\000\216\000t\000\216"
+ "\000\203\000\217\000\206\000\217\000\210\000\217\000l\000\216\000l\000\220"
+ "\000\216\000\220\000h\000\220\000h\000\221\000\220\000\221\000k\000\221\000"
+ "k\000\222\000\221\000\222\000^\000\222\000^\000\223\000\222\000\223\000`"
+ "\000\223\000`\000\224\000\223\000\224\000\210\000\225\000\217\000\225\000"
+ "\213\000\225\000w\000}\000\214\000\226\000\213\000\226\000\214\000\227\000"
+ "\226\000\227\000\223\000\230\000\223\000\231\000\230\000\231\000\222\000"
+ "\230\000\224\000\231\000\224\000\232\000\231\000\232\000\216\000\233\000"
+ "t\000\233\000\220\000\233\000\220\000\234\000\233\000\234\000\221\000\234"
+ "\000\221\000\235\000\234\000\235\000\215\000\233\000t\000\215\000\222\000"
+ "\235\000\230\000\235\000\206\000\236\000\236\000\237\000\206\000\237\000"
+ "\217\000\236\000\215\000\234\000\204\000\234\000r\000}\000s\000}\000\204"
+ "\000\235\000\202\000\235\000\202\000\230\000\211\000\230\000\211\000\231"
+ "\000\214\000\231\000\214\000\232\000\227\000\232\000.\000\240\0000\000\240"
+ "\000s\000\240\000\213\000\241\000\225\000\241\000\226\000\241\000v\000\242"
+ "\000t\000\242\000\200\000\242\000\200\000\243\000\242\000\243\000\206\000"
+ "\243\000\237\000\243\000\217\000\244\000\236\000\244\000\225\000\244\000"
+ "\225\000\245\000\244\000\245\000\241\000\245\000s\000|\000|\000\240\000g"
+ "\000\205\000i\000\205\000g\000\207\000\010\000j\000\010\000]\000\006\000"
+ "j\000_\000f\000j\000\207\000\017\000p\000\017\000o\000\016\000p\000i\000"
+ "\201\000m\000\201\000*\000=\000*\000,\000*\000+\000F\000V\000\012\000V\000"
+ "\000\000\134\000\016\000d\000D\000V\000D\000U\000U\000o\000D\000o\000\017"
+ "\000U\000\017\000B\000%\000Z\000Z\000\134\000*\000d\000d\000e\000\016\000"
+ "e\000Z\000d\0006\000\134\000\007\000n\000\007\000o\000;\000n\000e\000p\000"
+ "<\000p\000<\000n\000\227\000\271\000\226\000\271\000\227\000\272\000\271"
+ "\000\272\000\227\000\273\000\272\000\273\000\227\000\274\000\273\000\274"
+ "\000\226\000\275\000\241\000\275\000\226\000\276\000\275\000\276\000\271"
+ "\000\276\000\241\000\277\000\245\000\277\000\241\000\300\000\277\000\300"
+ "\000\275\000\300\000\232\000\301\000\301\000\302\000\232\000\302\000\232"
+ "\000\274\000\274\000\302\000\224\000\303\000\303\000\304\000\224\000\304"
+ "\000\224\000\301\000\301\000\304\000`\000f\000f\000\305\000`\000\305\000"
+ "`\000\303\000\303\000\305\000\305\000\307\000\307\000\310\000\305\000\310"
+ "\000f\000\307\000e\000\307\000d\000\307\000Z\000\307\000Z\000\315\000\307"
+ "\000\315\0006\000Z\0006\000\315\000\300\000\321\000\277\000\321\000\300\000"
+ "\323\000\321\000\323\000\275\000\323\000\276\000\323\000\271\000\323\000"
+ "\272\000\323\000\272\000\310\000\310\000\323\000\272\000\305\000\273\000"
+ "\305\000\274\000\305\000\302\000\305\000\301\000\305\000\304\000\305\000"
+ "\035\330\347\345\003L\000\000=\334\307\376\016B\000\000=\334\347\345\016"
+ "B\000\000\035\330\307\376\003L\000\000\260\012\347\345\227~\000\000\000\000"
+ "\307\376\377\177\000\000\000\000\347\345\377\177\000\000\260\012\307\376"
+ "\227~\000\000\315\342\347\345\347s\000\000Z\353\307\376wz\000\000\315\342"
+ "\307\376\347s\000\000Z\353\347\345wz\000\0003\035\347\345\347s\000\000\246"
+ "\024\307\376wz\000\000\246\024\347\345wz\000\0003\035\307\376\347s\000\000"
+ "=\334\347\345Yk\000\000\035\330\307\376da\000\000\035\330\347\345da\000\000"
+ "=\334\307\376Yk\000\000P\365\347\345\227~\000\000P\365\307\376\227~\000\000"
+ "\303#\307\376Yk\000\000\303#\347\345Yk\000\000L)\307\376\263V\000\000\343"
+ "'\347\345da\000\000L)\347\345\263V\000\000\343'\307\376da\000\000\264\326"
+ "\307\376\263V\000\000\264\326\347\345\263V\000\000\315\342\347\345\2009\000"
+ "\000\315\342\307\376\2009\000\000=\334\307\376\016B\000\000\000\000\307\376"
+ "\263V\000\000\315\342\307\376\2009\000\000\035\330\307\376\003L\000\000\264"
+ "\326\307\376\263V\000\000\000\000\307\376\263V\000\000\264\326\307\376\263"
+ "V\000\000L)\307\376\263V\000\000L)\307\376\263V\000\000\343'\307\376da\000"
+ "\000\035\330\307\376da\000\000=\334\307\376Yk\000\000\303#\307\376Yk\000"
+ "\000\315\342\307\376\347s\000\0003\035\307\376\347s\000\000Z\353\307\376"
+ "wz\000\000\246\024\307\376wz\000\000P\365\307\376\227~\000\000\260\012\307"
+ "\376\227~\000\000\000\000\307\376\377\177\000\000\315\342\347\345\2009\000"
+ "\000\235\322\021\362P)\000\000\042\321\347\345\326'\000\000\375\326\225\375"
+ "\261-\000\000\031\336\317\007\3144\000\000\315\342\307\376\2009\000\000\241"
+ "\347\035\020T>\000\000\000\000\307\376\263V\000\000#\363\351\025\326I\000"
+ "\000\000\000\255\030\263V\000\000\000\000\255\030\263V\000\000$\015\362\026"
+ "\263V\000\000c\031\340\021\263V\000\000\347#\316\011\263V\000\000\371+J\377"
+ "\263V\000\000L)\347\345\263V\000\000\3062\347\345\263V\000\000\0131\013\363"
+ "\263V\000\000\000\000\255\030\263V\000\000\206\013\350\020P\005\000\000\000"
+ "\000l\022P\005\000\000$\015\362\026\263V\000\000c\031\340\021\263V\000\000"
+ "B\026u\014P\005\000\000{\037b\005P\005\000\000\347#\316\011\263V\000\000"
+ "\371+J\377\263V\000\000\216&*\374P\005\000\000\001+m\361P\005\000\000\306"
+ "2\347\345\263V\000\000\205,\347\345P\005\000\000\0131\013\363\263V\000\000"
+ "r\331*\374P\005\000\000\377\324m\361P\005\000\000\235\322\021\362P)\000\000"
+ "\375\326\225\375\261-\000\000\031\336\317\007\3144\000\000\276\351u\014P"
+ "\005\000\000\205\340b\005P\005\000\000\241\347\035\020T>\000\000#\363\351"
+ "\025\326I\000\000z\364\350\020P\005\000\000{\323\347\345P\005\000\000\042"
+ "\321\347\345\326'\000\000\314\322\000\000M\251\000\000\030\333\317\012M\251"
+ "\000\000\202\015R\030M\251\000\000\000\000\031\032M\251\000\000\350$\317"
+ "\012M\251\000\000\031\032\033\023M\251\000\000\226\315i\363M\251\000\000"
+ "24\347\345M\251\000\000j2i\363M\251\000\000~\362R\030M\251\000\000\347\345"
+ "\033\023M\251\000\0004-\000\000M\251\000\000\316\313\347\345M\251\000\000"
+ "\260\012\347\345i\201\000\000\000\000\347\345\001\200\000\000S\012\253\350"
+ "i\201\000\000\362\023\077\353\211\205\000\000\246\024\347\345\211\205\000"
+ "\0005\034v\355\031\214\000\0003\035\347\345\031\214\000\000\213\042)\357"
+ "\247\224\000\000\303#\347\345\247\224\000\000\343'\347\345\234\236\000\000"
+ "\207&:\360\234\236\000\000\343'\227\360M\251\000\000L)\347\345M\251\000\000"
+ "B\011\077\353i\201\000\000\342\021:\360\211\205\000\000J\031\201\364\031"
+ "\214\000\000\371\036\311\367\247\224\000\000\213\042\331\371\234\236\000"
+ "\000\303#\215\372M\251\000\000\217\007v\355i\201\000\000\232\016\201\364"
+ "\211\205\000\000\246\024\215\372\031\214\000\000J\0311\377\247\224\000\000"
+ "5\034\034\002\234\236\000\0003\035\032\003M\251\000\000X\005)\357i\201\000"
+ "\000S\012\311\367\211\205\000\000\232\0161\377\031\214\000\000\342\021\340"
+ "\004\247\224\000\000\362\023r\010\234\236\000\000\246\024\252\011M\251\000"
+ "\000\304\002:\360i\201\000\000X\005\331\371\211\205\000\000\217\007\034\002"
+ "\031\214\000\000B\011r\010\247\224\000\000S\012o\014\234\236\000\000\260"
+ "\012\312\015M\251\000\000\000\000\227\360i\201\000\000\000\000\215\372\211"
+ "\205\000\000\000\000\032\003\031\214\000\000\000\000\252\011\247\224\000"
+ "\000\000\000\312\015\234\236\000\000\000\0003\017M\251\000\000<\375:\360"
+ "i\201\000\000\250\372\331\371\211\205\000\000q\370\034\002\031\214\000\000"
+ "\276\366r\010\247\224\000\000\255\365o\014\234\236\000\000P\365\312\015M"
+ "\251\000\000\250\372)\357i\201\000\000\255\365\311\367\211\205\000\000f\361"
+ "1\377\031\214\000\000\036\356\340\004\247\224\000\000\016\354r\010\234\236"
+ "\000\000Z\353\252\011M\251\000\000q\370v\355i\201\000\000f\361\201\364\211"
+ "\205\000\000Z\353\215\372\031\214\000\000\266\3461\377\247\224\000\000\313"
+ "\343\034\002\234\236\000\000\315\342\032\003M\251\000\000\276\366\077\353"
+ "i\201\000\000\036\356:\360\211\205\000\000\266\346\201\364\031\214\000\000"
+ "\007\341\311\367\247\224\000\000u\335\331\371\234\236\000\000=\334\215\372"
+ "M\251\000\000\255\365\253\350i\201\000\000\016\354\077\353\211\205\000\000"
+ "\313\343v\355\031\214\000\000u\335)\357\247\224\000\000y\331:\360\234\236"
+ "\000\000\035\330\227\360M\251\000\000P\365\347\345i\201\000\000Z\353\347"
+ "\345\211\205\000\000\315\342\347\345\031\214\000\000=\334\347\345\247\224"
+ "\000\000\035\330\347\345\234\236\000\000\264\326\347\345M\251\000\000\226"
+ "\315i\363M\251\000\000\264\326\347\345M\251\000\000\316\313\347\345M\251"
+ "\000\000\314\322\000\000M\251\000\000\030\333\317\012M\251\000\000\035\330"
+ "\227\360M\251\000\000=\334\215\372M\251\000\000\347\345\033\023M\251\000"
+ "\000\315\342\032\003M\251\000\000Z\353\252\011M\251\000\000~\362R\030M\251"
+ "\000\000P\365\312\015M\251\000\000\000\000\031\032M\251\000\000\000\0003"
+ "\017M\251\000\000\202\015R\030M\251\000\000\260\012\312\015M\251\000\000"
+ "\246\024\252\011M\251\000\000\031\032\033\023M\251\000\0003\035\032\003M"
+ "\251\000\000\350$\317\012M\251\000\000\303#\215\372M\251\000\000\343'\227"
+ "\360M\251\000\0004-\000\000M\251\000\000L)\347\345M\251\000\00024\347\345"
+ "M\251\000\000j2i\363M\251\000\000\201\345\201.\201.\201\345\033\000\000\000"
+ "\000\000\033\000\303\000\322\000\276\000\322\000\077\000.\000.\000\077\000"
+ "\257\000\234\000\234\000\257\000\345\000\345\000Q\000Q\000p\000d\000p\000"
+ "d\000\201\373\206\000\2017\201\311\000\177\000\177\000\177\000\177\000\177"
+ "\000\012\000\022\000\003\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\300\000\301\000\301\000"
+ "\301\000\300\000\300\000\300\000\301\000\301\000\301\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\015z\035e\000~!f3S-OA\077"
+ "CCP6S+h\027q\026p\017b$\255+\234\033\232 \2605\300E\317M\276<\320V\342i\344"
+ "a\220\017\217\025\267/\307\077\031^\373q9\077,L\242\031i\016[\035\347^\327"
+ "OI/\227\016{au\177wesVyPrHwAn;u5s$h0g%r\032qhj\134fO^FX<R8lmbc[XQRHHEEgr"
+ "[kPcD_<X8RdyWsJq;n0h%gd\177R~@\177\317|\036{\355z\234y\253t\271o\305m\323"
+ "i\333g\231r\245k\256b\273_\304X\312U\224m\236c\245X\256R\270J\273E\217h\226"
+ "\134\232O\242F\250<\2568\211e\215V\216H\222;\2300\231%\205a\207P\211A\213"
+ "5\215$\216\032\177\177\201\177\177\177\177\201\201\177\201\177\201\177\201"
+ "\177\201\177\201\177\177\177\177\177\177\177\177\177\201\177\177\177\201"
+ "\201\201\201\201\201\201\201\201\177\177\201\201\201\201\177\201\201\201"
+ "\201\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006"
+ "\000\005\000\004\000\007\000\010\000\011\000\012\000\011\000\010\000\013"
+ "\000\014\000\015\000\016\000\015\000\014\000\017\000\020\000\021\000\022"
+ "\000\021\000\020\000\023\000\024\000\011\000\013\000\011\000\024\000\025"
+ "\000\026\000\014\000\027\000\014\000\026\000\017\000\030\000\031\000\032"
+ "\000\031\000\030\000\033\000\034\000\000\000\035\000\000\000\034\000\003"
+ "\000\001\000\036\000\002\000\036\000\001\000\037\000\031\000\026\000\027"
+ "\000\026\000\031\000\033\000\004\000\015\000\007\000\015\000\004\000\016"
+ "\000\012\000\020\000\010\000\020\000\012\000\023\000\024\000\005\000\025"
+ "\000\005\000\024\000\006\000\021\000\035\000\022\000\035\000\021\000\034"
+ "\000 \000!\000\042\000!\000 \000#\000!\000#\000$\000%\000&\000'\000(\000"
+ "$\000)\000)\000$\000*\000)\000*\000+\000)\000+\000,\000,\000+\000-\000,\000"
+ "-\000.\000.\000-\000/\000.\000/\0000\0000\000/\0001\0000\0001\0002\0002\000"
+ "1\0003\0004\0005\0006\0005\0004\0007\0007\0004\0008\0008\0004\0009\0009\000"
+ ":\0008\000:\0009\000;\000:\000;\000<\000<\000;\000=\000'\000>\000%\000>\000"
+ "'\000\077\000\077\000'\000@\000@\000'\000A\000A\000'\000B\000B\000'\000C"
+ "\000B\000C\000D\000B\000D\000E\000F\000G\000H\000G\000F\000I\000G\000J\000"
+ "K\000J\000G\000I\000J\000L\000K\000L\000J\000M\000L\000N\000O\000N\000L\000"
+ "M\000P\000Q\000R\000Q\000P\000S\000O\000S\000P\000S\000O\000N\000T\000U\000"
+ "V\000W\000T\000V\000X\000Y\000Z\000[\000Y\000X\000\134\000H\000]\000F\000"
+ "H\000\134\000Z\000T\000W\000X\000Z\000W\000V\000^\000_\000V\000U\000^\000"
+ "[\000]\000Y\000\134\000]\000[\000Z\000`\000T\000`\000Z\000a\000H\000b\000"
+ "c\000b\000H\000G\000K\000d\000e\000d\000K\000L\000T\000f\000U\000f\000T\000"
+ "`\000g\000P\000R\000P\000g\000h\000]\000c\000i\000c\000]\000H\000j\000]\000"
+ "i\000]\000j\000Y\000b\000K\000e\000K\000b\000G\000h\000O\000P\000O\000h\000"
+ "k\000a\000Y\000j\000Y\000a\000Z\000^\000f\000l\000f\000^\000U\000k\000L\000"
+ "O\000L\000k\000d\000m\000n\000o\000p\000m\000o\000m\000p\000q\000r\000q\000"
+ "p\000q\000r\000s\000s\000t\000u\000t\000s\000r\000t\000v\000u\000v\000t\000"
+ "w\000v\000x\000y\000x\000v\000w\000o\000n\000z\000{\000o\000z\000o\000{\000"
+ "p\000|\000p\000{\000p\000|\000r\000|\000t\000r\000t\000|\000}\000}\000w\000"
+ "t\000w\000}\000~\000~\000x\000w\000x\000~\000\177\000z\000n\000\200\000\201"
+ "\000z\000\200\000z\000\201\000{\000\202\000{\000\201\000{\000\202\000|\000"
+ "\202\000}\000|\000}\000\202\000\203\000\203\000~\000}\000~\000\203\000\204"
+ "\000\204\000\177\000~\000\177\000\204\000\205\000\200\000n\000\206\000\207"
+ "\000\200\000\206\000\200\000\207\000\201\000\210\000\201\000\207\000\201"
+ "\000\210\000\202\000\210\000\203\000\202\000\203\000\210\000\211\000\212"
+ "\000\203\000\211\000\203\000\212\000\204\000\213\000\204\000\212\000\204"
+ "\000\213\000\205\000\206\000n\000\214\000\215\000\206\000\214\000\206\000"
+ "\215\000\207\000\216\000\207\000\215\000\207\000\216\000\210\000\217\000"
+ "\210\000\216\000\210\000\217\000\211\000\220\000\211\000\217\000\211\000"
+ "\220\000\212\000\221\000\212\000\220\000\212\000\221\000\213\000\214\000"
+ "n\000\222\000\223\000\214\000\222\000\214\000\223\000\215\000\216\000\223"
+ "\000\224\000\223\000\216\000\215\000\224\000\217\000\216\000\217\000\224"
+ "\000\225\000\226\000\217\000\225\000\217\000\226\000\220\000\226\000\221"
+ "\000\220\000\221\000\226\000\227\000n\000\230\000\222\000\223\000\230\000"
+ "\231\000\230\000\223\000\222\000\224\000\231\000\232\000\231\000\224\000"
+ "\223\000\232\000\225\000\224\000\225\000\232\000\233\000\234\000\225\000"
+ "\233\000\225\000\234\000\226\000\234\000\227\000\226\000\227\000\234\000"
+ "\235\000n\000\236\000\230\000\231\000\236\000\237\000\236\000\231\000\230"
+ "\000\232\000\237\000\240\000\237\000\232\000\231\000\241\000\232\000\240"
+ "\000\232\000\241\000\233\000\241\000\234\000\233\000\234\000\241\000\242"
+ "\000\243\000\234\000\242\000\234\000\243\000\235\000n\000\244\000\236\000"
+ "\237\000\244\000\245\000\244\000\237\000\236\000\240\000\245\000\246\000"
+ "\245\000\240\000\237\000\247\000\240\000\246\000\240\000\247\000\241\000"
+ "\250\000\241\000\247\000\241\000\250\000\242\000\250\000\243\000\242\000"
+ "\243\000\250\000\251\000n\000\252\000\244\000\245\000\252\000\253\000\252"
+ "\000\245\000\244\000\246\000\253\000\254\000\253\000\246\000\245\000\255"
+ "\000\246\000\254\000\246\000\255\000\247\000\256\000\247\000\255\000\247"
+ "\000\256\000\250\000\257\000\250\000\256\000\250\000\257\000\251\000n\000"
+ "\260\000\252\000\253\000\260\000\261\000\260\000\253\000\252\000\254\000"
+ "\261\000\262\000\261\000\254\000\253\000\263\000\254\000\262\000\254\000"
+ "\263\000\255\000\264\000\255\000\263\000\255\000\264\000\256\000\265\000"
+ "\256\000\264\000\256\000\265\000\257\000n\000\266\000\260\000\261\000\266"
+ "\000\267\000\266\000\261\000\260\000\262\000\267\000\270\000\267\000\262"
+ "\000\261\000\263\000\270\000\271\000\270\000\263\000\262\000\272\000\263"
+ "\000\271\000\263\000\272\000\264\000\265\000\272\000\273\000\272\000\265"
+ "\000\264\000\274\000\275\000\276\000\275\000\274\000\277\000\275\000\277"
+ "\000\300\000\275\000\300\000\301\000\301\000\300\000\302\000\302\000\300"
+ "\000\303\000\302\000\303\000\304\000\304\000\303\000\305\000\305\000\303"
+ "\000\306\000\305\000\306\000\307\000\307\000\306\000\310\000\307\000\310"
+ "\000\311\000\311\000\310\000\312\000\311\000\312\000\313\000\313\000\312"
+ "\000\314\000\314\000\312\000\315\000\314\000\315\000\316\000\316\000\315"
+ "\000\317\000\316\000\317\000\320\000\320\000\317\000\321\000\321\000\317"
+ "\000\322\000\321\000\322\000\323\000\323\000\322\000\324\000\324\000\322"
+ "\000\325\000\000\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006"
+ "\000\004\000\007\000\005\000\007\000\010\000\011\000\011\000\012\000\010"
+ "\000\012\000\010\000\013\000\011\000\013\000\014\000\015\000\015\000\016"
+ "\000\014\000\016\000\014\000\017\000\015\000\017\000\020\000\021\000\021"
+ "\000\022\000\020\000\022\000\020\000\023\000\021\000\023\000\011\000\024"
+ "\000\013\000\024\000\024\000\025\000\011\000\025\000\014\000\026\000\014"
+ "\000\027\000\026\000\027\000\017\000\026\000\030\000\031\000\031\000\032"
+ "\000\030\000\032\000\030\000\033\000\031\000\033\000\000\000\034\000\000"
+ "\000\035\000\034\000\035\000\003\000\034\000\001\000\036\000\002\000\036"
+ "\000\001\000\037\000\036\000\037\000\026\000\031\000\027\000\031\000\026"
+ "\000\033\000\004\000\015\000\007\000\015\000\004\000\016\000\012\000\020"
+ "\000\010\000\020\000\012\000\023\000\005\000\024\000\005\000\025\000\006"
+ "\000\024\000\021\000\035\000\022\000\035\000\021\000\034\000\001\000!\000"
+ "\037\000!\000\003\000!\000\034\000!\000\030\000\034\000\030\000!\000\033"
+ "\000\034\000\021\000\033\000\023\000\033\000\023\000\026\000\012\000\026"
+ "\000\012\000\017\000\011\000\017\000\011\000\015\000\015\000\025\000\007"
+ "\000\025\000\036\0005\0005\0006\000\036\0006\000\036\0007\0005\0007\000\036"
+ "\0008\0007\0008\000\037\0008\000\037\000:\0008\000:\000!\000:\000!\000<\000"
+ ":\000<\000!\000=\000<\000=\000\030\000=\000\030\000\077\000=\000\077\000"
+ "\030\000@\000\077\000@\000\030\000A\000@\000A\000\030\000B\000A\000B\000"
+ "\032\000B\000\032\000D\000B\000D\000D\000E\000B\000E\000=\000G\000G\000H"
+ "\000=\000H\000\077\000G\000@\000G\000@\000K\000G\000K\000@\000L\000K\000"
+ "L\000A\000L\000B\000L\000B\000O\000L\000O\000D\000P\000D\000R\000P\000R\000"
+ "E\000P\000E\000O\000O\000P\000T\000U\0005\000U\0005\000T\0007\000T\0008\000"
+ "Y\000Y\000Z\0008\000Z\000:\000Y\000<\000H\000H\000]\000<\000]\000T\000Z\000"
+ "7\000Z\0005\000^\0006\000^\000U\000^\000:\000]\000Y\000]\000Z\000`\000T\000"
+ "`\000Z\000a\000`\000a\000H\000b\000b\000c\000H\000c\000G\000b\000K\000d\000"
+ "d\000e\000K\000e\000L\000d\000T\000f\000U\000f\000`\000f\000P\000g\000R\000"
+ "g\000g\000h\000P\000h\000]\000c\000c\000i\000]\000i\000]\000j\000i\000j\000"
+ "Y\000j\000K\000b\000b\000e\000O\000h\000h\000k\000O\000k\000Y\000a\000a\000"
+ "j\000^\000f\000f\000l\000^\000l\000L\000k\000d\000k\000m\000n\000n\000o\000"
+ "m\000o\000m\000p\000o\000p\000p\000q\000m\000q\000q\000r\000p\000r\000r\000"
+ "s\000q\000s\000s\000t\000t\000u\000s\000u\000r\000t\000t\000v\000u\000v\000"
+ "t\000w\000v\000w\000v\000x\000x\000y\000v\000y\000w\000x\000n\000z\000o\000"
+ "z\000o\000{\000z\000{\000p\000{\000p\000|\000{\000|\000r\000|\000t\000|\000"
+ "|\000}\000t\000}\000w\000}\000}\000~\000w\000~\000x\000~\000~\000\177\000"
+ "x\000\177\000n\000\200\000z\000\200\000z\000\201\000\200\000\201\000{\000"
+ "\201\000{\000\202\000\201\000\202\000|\000\202\000}\000\202\000\202\000\203"
+ "\000}\000\203\000~\000\203\000\203\000\204\000~\000\204\000\177\000\204\000"
+ "\204\000\205\000\177\000\205\000n\000\206\000\200\000\206\000\200\000\207"
+ "\000\206\000\207\000\201\000\207\000\201\000\210\000\207\000\210\000\202"
+ "\000\210\000\203\000\210\000\210\000\211\000\203\000\211\000\203\000\212"
+ "\000\211\000\212\000\204\000\212\000\204\000\213\000\212\000\213\000\205"
+ "\000\213\000n\000\214\000\206\000\214\000\206\000\215\000\214\000\215\000"
+ "\207\000\215\000\207\000\216\000\215\000\216\000\210\000\216\000\210\000"
+ "\217\000\216\000\217\000\211\000\217\000\211\000\220\000\217\000\220\000"
+ "\212\000\220\000\212\000\221\000\220\000\221\000\213\000\221\000n\000\222"
+ "\000\214\000\222\000\214\000\223\000\222\000\223\000\215\000\223\000\216"
+ "\000\223\000\223\000\224\000\216\000\224\000\217\000\224\000\224\000\225"
+ "\000\217\000\225\000\217\000\226\000\225\000\226\000\220\000\226\000\221"
+ "\000\226\000\226\000\227\000\221\000\227\000n\000\230\000\222\000\230\000"
+ "\223\000\230\000\230\000\231\000\223\000\231\000\224\000\231\000\231\000"
+ "\232\000\224\000\232\000\225\000\232\000\232\000\233\000\225\000\233\000"
+ "\225\000\234\000\233\000\234\000\226\000\234\000\227\000\234\000\234\000"
+ "\235\000\227\000\235\000n\000\236\000\230\000\236\000\231\000\236\000\236"
+ "\000\237\000\231\000\237\000\232\000\237\000\237\000\240\000\232\000\240"
+ "\000\232\000\241\000\240\000\241\000\233\000\241\000\234\000\241\000\241"
+ "\000\242\000\234\000\242\000\234\000\243\000\242\000\243\000\235\000\243"
+ "\000n\000\244\000\236\000\244\000\237\000\244\000\244\000\245\000\237\000"
+ "\245\000\240\000\245\000\245\000\246\000\240\000\246\000\240\000\247\000"
+ "\246\000\247\000\241\000\247\000\241\000\250\000\247\000\250\000\242\000"
+ "\250\000\243\000\250\000\250\000\251\000\243\000\251\000n\000\252\000\244"
+ "\000\252\000\245\000\252\000\252\000\253\000\245\000\253\000\246\000\253"
+ "\000\253\000\254\000\246\000\254\000\246\000\255\000\254\000\255\000\247"
+ "\000\255\000\247\000\256\000\255\000\256\000\250\000\256\000\250\000\257"
+ "\000\256\000\257\000\251\000\257\000n\000\260\000\252\000\260\000\253\000"
+ "\260\000\260\000\261\000\253\000\261\000\254\000\261\000\261\000\262\000"
+ "\254\000\262\000\254\000\263\000\262\000\263\000\255\000\263\000\255\000"
+ "\264\000\263\000\264\000\256\000\264\000\256\000\265\000\264\000\265\000"
+ "\257\000\265\000n\000\266\000\260\000\266\000\261\000\266\000\266\000\267"
+ "\000\261\000\267\000\262\000\267\000\267\000\270\000\262\000\270\000\263"
+ "\000\270\000\270\000\271\000\263\000\271\000\263\000\272\000\271\000\272"
+ "\000\264\000\272\000\265\000\272\000\272\000\273\000\265\000\273\000f\000"
+ "\273\000l\000\273\000`\000\273\000a\000\273\000a\000\265\000a\000\257\000"
+ "j\000\257\000j\000\251\000j\000\243\000i\000\243\000i\000\235\000c\000\235"
+ "\000c\000\227\000b\000\227\000b\000\221\000b\000\213\000e\000\213\000e\000"
+ "\205\000d\000\205\000d\000\177\000d\000x\000k\000x\000k\000y\000g\000k\000"
+ "g\000y\000%\300\254\353\276\271\000\000\313\277\321\347\030\272\000\000\001"
+ "\303\350\3520\310\000\000L\026i\0150\310\000\000\203,\324\016\001\200\000"
+ "\000\257\0355\032\001\200\000\000z\335i\0150\310\000\000k\344m\033y\225\000"
+ "\000i\331s\024z\240\000\000\3447\000\000\001\200\000\000\030+\235\3700\310"
+ "\000\000\013\077\274\356\001\200\000\000.\353\026\0230\310\000\000\343\371"
+ "\314#\001\200\000\000J\350\341\035\232\221\000\000\227\010\026\0230\310\000"
+ "\000j\014\134!\001\200\000\000\251\315m\010:\254\000\000G\312\343\002\235"
+ "\257\000\000\265\321a\0040\310\000\000\307\323\257\016\035\246\000\0008\305"
+ "\234\372\254\264\000\000\264\303&\3660\266\000\000\256\310\235\3700\310\000"
+ "\000\3050\350\3520\310\000\000{A4\334\001\200\000\000\020\042a\0040\310\000"
+ "\000\343\371\005\0250\310\000\000.\353\026\023\225\375\000\000z\335i\015"
+ "\225\375\000\000L\026i\015\225\375\000\000\227\010\026\023\225\375\000\000"
+ "\012\014\366\037\304E\000\000\366\034\364\030\304E\000\000\256\310\235\370"
+ "\225\375\000\000\265\321a\004\225\375\000\000\343\371\005\025\225\375\000"
+ "\000\030+\235\370\225\375\000\000\020\042a\004\225\375\000\000\2436G\377"
+ "\304E\000\000}+\316\015\304E\000\000\343\371Y\042\304E\000\000\001\303\350"
+ "\352\225\375\000\000\021\3014\334X\314\000\000\021\3014\334\225\375\000\000"
+ "\021\3014\3340\310\000\000\3050\350\352\225\375\000\000\244=\134\356\304"
+ "E\000\000\26424\3340\310\000\000\26424\334\225\375\000\000\010@4\334\304"
+ "E\000\000\205\2764\334_\273\000\000\203\311\243\001a\260\000\000\343\371"
+ "\314#\001\200\000\000\0354G\377\001\200\000\000\343\371G\377\001\200\000"
+ "\000j\014\134!\001\200\000\000\257\0355\032\001\200\000\000\203,\324\016"
+ "\001\200\000\000\3447\000\000\001\200\000\000\03544\334\001\200\000\000{"
+ "A4\334\001\200\000\000\013\077\274\356\001\200\000\000\313\277\321\347\030"
+ "\272\000\000\266\3204\334.\251\000\000\205\2764\334_\273\000\000\266\320"
+ "G\377.\251\000\000%\300\254\353\276\271\000\000\264\303&\3660\266\000\000"
+ "8\305\234\372\254\264\000\000\203\311\243\001a\260\000\000\343\371G\377\001"
+ "\200\000\000\343\371\314#\001\200\000\000G\312\343\002\235\257\000\000\251"
+ "\315m\010:\254\000\000\307\323\257\016\035\246\000\000i\331s\024z\240\000"
+ "\000k\344m\033y\225\000\000J\350\341\035\232\221\000\000u\307G\377\247(\000"
+ "\000\343\371G\377\304E\000\000\266\320G\377\230\034\000\000\244\301G\377"
+ "\2626\000\000\250\277G\377\304E\000\000\244\301G\377\326T\000\000!2G\377"
+ "\326T\000\000\0354G\377\304E\000\000\373\305G\377P_\000\000P,G\377\342b\000"
+ "\000u\307G\377\342b\000\000\266\320G\377\361n\000\000\017#G\377\361n\000"
+ "\000\305\334G\3772x\000\000\000\027G\3772x\000\000\321\352G\377\003~\000"
+ "\000\365\010G\377\003~\000\000\343\371G\377\377\177\000\000\03544\334\304"
+ "E\000\000!2G\377\326T\000\000!24\334\326T\000\000\0354G\377\304E\000\000"
+ "P,4\334\342b\000\000P,G\377\342b\000\000\017#4\334\361n\000\000\017#G\377"
+ "\361n\000\000\000\027G\3772x\000\000\000\0274\3342x\000\000\365\010G\377"
+ "\003~\000\000\365\0104\334\003~\000\000\343\371G\377\377\177\000\000\343"
+ "\3714\334\377\177\000\000\321\352G\377\003~\000\000\321\3524\334\003~\000"
+ "\000\305\334G\3772x\000\000\305\3344\3342x\000\000\266\320\021\374\361n\000"
+ "\000\266\3204\334\361n\000\000\266\320G\377\361n\000\000u\3074\334\342b\000"
+ "\000u\307G\377\342b\000\000\373\3054\334P_\000\000\244\301G\377\326T\000"
+ "\000\244\3014\334\326T\000\000\244\301G\377\326T\000\000u\307G\377\342b\000"
+ "\000\373\305G\377P_\000\000\203\305q\372d\021\000\000\327\311b\001\271\025"
+ "\000\000\003\316\023\010\345\031\000\000\307\331\321\023\250%\000\000\217"
+ "\350\336\034q4\000\000b\300\234\353D\014\000\000\254\2764\334\216\012\000"
+ "\000\244\301G\377\2626\000\000u\3074\334\247(\000\000\244\3014\334\2626\000"
+ "\000u\307G\377\247(\000\000\250\2774\334\304E\000\000\250\277G\377\304E\000"
+ "\000\266\320\021\374\230\034\000\000\266\3204\334\230\034\000\000\266\320"
+ "G\377\230\034\000\000\343\371Y\042\304E\000\000\266\320G\377\230\034\000"
+ "\000\343\371G\377\304E\000\000\327\311b\001\271\025\000\000\003\316\023\010"
+ "\345\031\000\000\307\331\321\023\250%\000\000\217\350\336\034q4\000\000\266"
+ "\320\021\374\230\034\000\000\254\2764\334\216\012\000\000\266\3204\334\230"
+ "\034\000\000b\300\234\353D\014\000\000\203\305q\372d\021\000\000\010@4\334"
+ "\304E\000\000\0354G\377\304E\000\000\03544\334\304E\000\000\2436G\377\304"
+ "E\000\000\244=\134\356\304E\000\000\343\371G\377\304E\000\000\012\014\366"
+ "\037\304E\000\000\343\371Y\042\304E\000\000\366\034\364\030\304E\000\000"
+ "}+\316\015\304E\000\000\255\032\240\014\243\027,H5:&I\325K\340N\330FD+N("
+ "S\032\350Z\374f\351V\033\134\024Y\3117\3010\3047\320\077\274+\262 \264(]"
+ "\026_\015=;\000s\340e\313T2T!h+d;S\2542\273C\013\177S4EES;GG\030z\226\034"
+ "\220\017\217\027\226\016g\037d+j\016q\027r\037\241\015\3010\177\201\201\201"
+ "\177\201\201\201\201\201\201\201\201\201\201\201\201\201\201\201\201\300"
+ "\201\300\201\300\201\300\201\300\201\300\201\300\201\301\201\300\201@\201"
+ "@\201@\201\077\201@\201@\201@\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177p\000d\000d\000p\000T\000N\000\077\000\077\000"
+ "1\000+\000\036\000\027\000\005\000\373\000\351\000\342\000\325\000\315\000"
+ "\277\000\300\000\303\000\262\000\257\000\246\000\234\000\234\000\3157\315"
+ "7\3157\255;\262\077\274I\310V\330h\234+\216\037\201\033\201\322\201\033\201"
+ "\317\201\000\201\000\201\311\201\311\201\311\301\000\301\000\301\000\301"
+ "\000\300\000\301\000\301\000\300\000\301\000\300\000\300\000\300\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010"
+ "\000\011\000\012\000\013\000\014\000\015\000\016\000\017\000\005\000\020"
+ "\000\021\000\022\000\023\000\023\000\024\000\021\000\025\000\026\000\027"
+ "\000\013\000\030\000\031\000\004\000\032\000\011\000\033\000\020\000\015"
+ "\000\006\000\034\000\014\000\034\000\006\000\035\000\017\000\036\000\003"
+ "\000\036\000\017\000\037\000 \000\036\000\037\000\036\000 \000!\000\042\000"
+ "\023\000\027\000\023\000\042\000#\000\034\000\033\000\014\000\033\000\034"
+ "\000$\000\032\000%\000\012\000%\000\032\000&\000&\000'\000%\000'\000&\000"
+ "(\000#\000\006\000\023\000\006\000#\000\035\000$\000\017\000\033\000\017"
+ "\000$\000\037\000)\000\037\000$\000\037\000)\000 \000\042\000\002\000*\000"
+ "\002\000\042\000\027\000\036\000\032\000\003\000\032\000\036\000&\000!\000"
+ "&\000\036\000&\000!\000(\000*\000+\000,\000+\000*\000-\000-\000*\000\002"
+ "\000\012\000.\000\030\000.\000\012\000%\000%\000/\000.\000/\000%\000'\000"
+ "0\000.\0001\000.\0000\000\030\000.\0002\0001\0002\000.\000/\000\012\000\030"
+ "\000\013\000\017\000\020\000\033\000\002\0003\000-\0003\000\002\000\001\000"
+ "\023\000\025\000\027\000\025\000\023\0004\0004\000\023\000\022\000\024\000"
+ "\006\000\010\000\006\000\024\000\023\000\027\000\000\000\002\000\000\000"
+ "\027\000\026\000\033\000\015\000\014\000\017\000\003\000\005\000\032\000"
+ "\012\000\011\000\032\000\004\000\003\000\007\000\014\000\016\000\014\000"
+ "\007\000\006\000\030\0000\000\031\0005\0006\0007\0006\0005\0008\0006\000"
+ "8\0009\0006\0009\000:\0006\000:\000;\0006\000;\000<\000<\000;\000=\000=\000"
+ ";\000>\000\077\000@\000A\000@\000\077\000B\000B\000\077\000C\000B\000C\000"
+ "D\000B\000D\000E\000B\000E\000F\000B\000F\000G\000G\000F\000H\000H\000F\000"
+ "I\000H\000I\000J\000H\000J\000K\000H\000K\000L\000H\000L\000M\000H\000M\000"
+ "N\000O\000P\000Q\000P\000O\000R\000P\000R\000S\000P\000S\000T\000P\000U\000"
+ "V\000U\000P\000T\000U\000T\000W\000U\000W\000X\000X\000W\000Y\000X\000Y\000"
+ "Z\000X\000Z\000[\000[\000Z\000\134\000[\000\134\000]\000]\000\134\000^\000"
+ "]\000^\000_\000_\000^\000`\000a\000b\000c\000b\000a\000d\000b\000e\000c\000"
+ "e\000b\000f\000f\000g\000e\000g\000f\000h\000g\000i\000j\000i\000g\000h\000"
+ "j\000k\000l\000k\000j\000i\000l\000m\000n\000m\000l\000k\000n\000o\000p\000"
+ "o\000n\000m\000p\000q\000r\000q\000p\000o\000r\000s\000t\000s\000r\000u\000"
+ "u\000r\000q\000s\000v\000t\000v\000s\000w\000w\000s\000u\000w\000x\000v\000"
+ "x\000y\000z\000y\000x\000w\000{\000|\000}\000~\000#\000\042\000#\000~\000"
+ "\177\000#\000\177\000\200\000\200\000\035\000#\000\035\000\200\000\201\000"
+ "\035\000\202\000\034\000\202\000\035\000\201\000\203\000\042\000*\000\042"
+ "\000\203\000~\000\204\000*\000,\000*\000\204\000\203\000\202\000$\000\034"
+ "\000$\000\202\000)\000\205\000\206\000\207\000\206\000\205\000\210\000y\000"
+ "\211\000z\000\211\000y\000\212\000\211\000\205\000\207\000\205\000\211\000"
+ "\212\000\206\000\213\000\214\000\213\000\206\000\210\000\213\000\210\000"
+ "\215\000\216\000\217\000\220\000\217\000\216\000\221\000\221\000\216\000"
+ "\222\000\222\000\216\000\223\000\223\000\216\000\224\000\225\000\226\000"
+ "\227\000\226\000\225\000\230\000\230\000\225\000\231\000\231\000\225\000"
+ "\221\000\221\000\225\000\217\000\232\000\233\000\234\000\233\000\232\000"
+ "\235\000\235\000\232\000\236\000\237\000\240\000\241\000\240\000\237\000"
+ "\233\000\240\000\233\000\242\000\242\000\233\000\243\000\243\000\233\000"
+ "\235\000\000\000\000\000\001\000\001\000\002\000\000\000\002\000\003\000"
+ "\004\000\004\000\005\000\003\000\005\000\006\000\007\000\007\000\010\000"
+ "\006\000\010\000\011\000\012\000\012\000\013\000\011\000\013\000\014\000"
+ "\015\000\015\000\016\000\014\000\016\000\005\000\017\000\005\000\020\000"
+ "\017\000\020\000\021\000\022\000\022\000\023\000\021\000\023\000\023\000"
+ "\024\000\021\000\024\000\025\000\026\000\026\000\027\000\025\000\027\000"
+ "\013\000\030\000\030\000\031\000\013\000\031\000\004\000\032\000\011\000"
+ "\032\000\004\000\011\000\020\000\033\000\015\000\020\000\015\000\033\000"
+ "\006\000\034\000\014\000\034\000\006\000\014\000\006\000\035\000\034\000"
+ "\035\000\017\000\036\000\003\000\036\000\003\000\017\000\017\000\037\000"
+ "\036\000\037\000\036\000 \000\037\000 \000 \000!\000\036\000!\000\023\000"
+ "\042\000\023\000\027\000\027\000\042\000\042\000#\000\023\000#\000\033\000"
+ "\034\000\014\000\033\000\034\000$\000\033\000$\000\032\000%\000\012\000%"
+ "\000\012\000\032\000\032\000&\000%\000&\000&\000'\000%\000'\000&\000(\000"
+ "'\000(\000\006\000#\000\006\000\023\000\035\000#\000\017\000$\000\017\000"
+ "\033\000\037\000$\000\037\000)\000$\000)\000 \000)\000\002\000\042\000\002"
+ "\000*\000\042\000*\000\002\000\027\000\032\000\036\000\003\000\032\000\036"
+ "\000&\000!\000&\000!\000(\000*\000+\000+\000,\000*\000,\000*\000-\000+\000"
+ "-\000\002\000-\000\012\000.\000\030\000.\000\012\000\030\000%\000.\000%\000"
+ "/\000.\000/\000'\000/\000.\0000\000.\0001\0000\0001\000\030\0000\000.\000"
+ "2\0001\0002\000/\0002\000\002\0003\000-\0003\000\001\0003\000\023\000\025"
+ "\000\023\0004\000\025\0004\000\022\0004\000\006\000\024\000\010\000\024\000"
+ "\000\000\027\000\000\000\026\000\007\000\014\000\007\000\016\000\031\000"
+ "0\000\015\0006\0006\0007\000\015\0007\000\020\0006\000\005\0006\000\004\000"
+ "6\000\011\0006\000\011\000<\0006\000<\000\011\000\031\000\031\000<\000\001"
+ "\000@\0003\000@\000\001\000B\000@\000B\000\000\000B\000\026\000B\000\025"
+ "\000B\0004\000B\0004\0007\0007\000B\000\015\0004\000\015\000\022\000\015"
+ "\000\021\000\015\000\024\000\010\000\015\000\007\000\015\000O\000P\000P\000"
+ "Q\000O\000Q\000O\000R\000P\000R\000R\000S\000P\000S\000S\000T\000P\000T\000"
+ "P\000U\000U\000V\000P\000V\000T\000U\000T\000W\000U\000W\000W\000X\000U\000"
+ "X\000W\000Y\000X\000Y\000Y\000Z\000X\000Z\000Z\000[\000X\000[\000Z\000\134"
+ "\000[\000\134\000\134\000]\000[\000]\000\134\000^\000]\000^\000^\000_\000"
+ "]\000_\000^\000`\000_\000`\000U\000a\000U\000c\000a\000c\000V\000a\000U\000"
+ "e\000c\000e\000X\000e\000X\000g\000e\000g\000[\000g\000]\000g\000]\000j\000"
+ "g\000j\000_\000j\000_\000l\000j\000l\000`\000l\000`\000n\000l\000n\000^\000"
+ "n\000^\000p\000n\000p\000\134\000p\000\134\000r\000p\000r\000r\000s\000s"
+ "\000t\000r\000t\000Z\000r\000Z\000s\000s\000v\000t\000v\000Y\000s\000Y\000"
+ "v\000Y\000x\000v\000x\000T\000x\000T\000z\000x\000z\000T\000Y\000#\000~\000"
+ "\042\000~\000~\000\177\000#\000\177\000\177\000\200\000#\000\200\000\035"
+ "\000\200\000\200\000\201\000\035\000\201\000\035\000\202\000\034\000\202"
+ "\000\201\000\202\000\042\000\203\000*\000\203\000~\000\203\000*\000\204\000"
+ ",\000\204\000\203\000\204\000$\000\202\000)\000\202\000R\000\206\000\206"
+ "\000\207\000R\000\207\000O\000\206\000T\000\211\000z\000\211\000S\000\211"
+ "\000R\000\211\000\207\000\211\000\206\000\213\000\213\000\214\000\206\000"
+ "\214\000O\000\213\000Q\000\213\000)\000Q\000)\000P\000)\000\177\000Q\000"
+ "\177\000)\000\200\000)\000\201\000\204\000\213\000\204\000\214\000\203\000"
+ "\213\000~\000\213\000\177\000\213\0002\000V\0002\000a\000'\0002\000'\000"
+ "V\000 \000P\000 \000V\000!\000V\000(\000V\000"
+;
+const unsigned long handsy_model_size = 47528;
@@ -45,13 +45,25 @@
 #include "rotator.h"
 #include "gllist.h"
 
-extern const struct gllist
+/* A binary mesh container, see "headroom_dxf" in Makefile.in. */
+extern const unsigned char headroom_model[];
+extern const unsigned long headroom_model_size;
+
+/* Loaded from headroom_model on first use. */
+static const struct gllist
   *headroom_model_skull_half, *headroom_model_jaw_half,
   *headroom_model_teeth_upper_half, *headroom_model_teeth_lower_half,
   *headroom_model_torso_half, *headroom_model_torso_cap_half,
   *headroom_model_mask_half;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "skull_half", "jaw_half",
+  "teeth_upper_half", "teeth_lower_half",
+  "torso_half", "torso_cap_half",
+  "mask_half",
+};
+
+static const struct gllist **all_objs[] = {
   &headroom_model_skull_half, &headroom_model_jaw_half,
   &headroom_model_teeth_upper_half, &headroom_model_teeth_lower_half,
   &headroom_model_torso_half, &headroom_model_torso_cap_half,
@@ -260,27 +272,33 @@ init_headroom (ModeInfo *mi)
     bp->trackball = gltrackball_init (False);
   }
 
+  for (i = 0; i < countof(all_objs); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (headroom_model, headroom_model_size,
+                                         all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
 
   for (i = 0; i < countof(all_objs); i++)
     {
-      const struct gllist *gll = *all_objs[i];
       char *key = 0;
       GLfloat spec[4] = {0.4, 0.4, 0.4, 1.0};
       GLfloat shiny = 80; /* 0-128 */
 
+      /* Only the material goes in the display list: the model itself is
+         drawn by render_component, so that it comes from buffer objects. */
       glNewList (bp->dlists[i], GL_COMPILE);
 
-      glMatrixMode(GL_MODELVIEW);
-      glPushMatrix();
-      glMatrixMode(GL_TEXTURE);
-      glPushMatrix();
-      glMatrixMode(GL_MODELVIEW);
-
-      glRotatef (-90, 1, 0, 0);
-
       glBindTexture (GL_TEXTURE_2D, 0);
 
       switch (i) {
@@ -309,12 +327,6 @@ init_headroom (ModeInfo *mi)
 
       glMaterialfv (GL_FRONT_AND_BACK, GL_SPECULAR,  spec);
       glMaterialf  (GL_FRONT_AND_BACK, GL_SHININESS, shiny);
-      renderList (gll, wire);
-
-      glMatrixMode(GL_TEXTURE);
-      glPopMatrix();
-      glMatrixMode(GL_MODELVIEW);
-      glPopMatrix();
 
       glEndList ();
     }
@@ -394,6 +406,18 @@ draw_box (ModeInfo *mi)
 
 
 
+static void
+render_component (ModeInfo *mi, int i)
+{
+  headroom_configuration *bp = &bps[MI_SCREEN(mi)];
+  glPushMatrix();
+  glRotatef (-90, 1, 0, 0);
+  glCallList (bp->dlists[i]);
+  renderList (*all_objs[i], MI_IS_WIREFRAME(mi));
+  glPopMatrix();
+}
+
+
 static int
 draw_component (ModeInfo *mi, int i)
 {
@@ -402,12 +426,12 @@ draw_component (ModeInfo *mi, int i)
                 bp->component_colors[i]);
 
   glFrontFace (GL_CCW);
-  glCallList (bp->dlists[i]);
+  render_component (mi, i);
 
   glPushMatrix();
   glScalef (-1, 1, 1);
   glFrontFace (GL_CW);
-  glCallList (bp->dlists[i]);
+  render_component (mi, i);
   glPopMatrix();
 
   return 2 * (*all_objs[i])->points / 3;
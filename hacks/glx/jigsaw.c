@@ -57,11 +57,13 @@
 		  "*grabDesktopImages:	False	\n" \
 		  "*chooseRandomImages:	True	\n" \
 		  "*suppressRotationAnimation: True\n" \
+		  THREAD_DEFAULTS_XLOCK
 
 
 # define release_jigsaw 0
 
 #include "xlockmore.h"
+#include "thread_util.h"
 #include "rotator.h"
 #include "gltrackball.h"
 #include "spline.h"
@@ -153,6 +155,7 @@ static XrmOptionDescRec opts[] = {
   { "-wobble",     ".wobble",      XrmoptionNoArg, "True" },
   { "+wobble",     ".wobble",      XrmoptionNoArg, "False" },
   { "-debug",      ".debug",       XrmoptionNoArg, "True" },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
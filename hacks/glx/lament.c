@@ -46,69 +46,41 @@
 #undef MIN
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 
-extern const struct gllist
-  *lament_model_box,
-  *lament_model_iso_base_a,
-  *lament_model_iso_base_b,
-  *lament_model_iso_den,
-  *lament_model_iso_dse,
-  *lament_model_iso_dwn,
-  *lament_model_iso_swd,
-  *lament_model_iso_une,
-  *lament_model_iso_unw,
-  *lament_model_iso_use,
-  *lament_model_iso_usw,
-  *lament_model_leviathan,
-  *lament_model_lid_a,
-  *lament_model_lid_b,
-  *lament_model_lid_base,
-  *lament_model_lid_c,
-  *lament_model_lid_d,
-  *lament_model_pillar_a,
-  *lament_model_pillar_b,
-  *lament_model_pillar_base,
-  *lament_model_star_d,
-  *lament_model_star_u,
-  *lament_model_taser_a,
-  *lament_model_taser_b,
-  *lament_model_taser_base,
-  *lament_model_tetra_base,
-  *lament_model_tetra_dse,
-  *lament_model_tetra_dwn,
-  *lament_model_tetra_une,
-  *lament_model_tetra_usw;
-
-static const struct gllist * const *all_objs[] = {
-  &lament_model_box,
-  &lament_model_iso_base_a,
-  &lament_model_iso_base_b,
-  &lament_model_iso_den,
-  &lament_model_iso_dse,
-  &lament_model_iso_dwn,
-  &lament_model_iso_swd,
-  &lament_model_iso_une,
-  &lament_model_iso_unw,
-  &lament_model_iso_use,
-  &lament_model_iso_usw,
-  &lament_model_leviathan,
-  &lament_model_lid_a,
-  &lament_model_lid_b,
-  &lament_model_lid_base,
-  &lament_model_lid_c,
-  &lament_model_lid_d,
-  &lament_model_pillar_a,
-  &lament_model_pillar_b,
-  &lament_model_pillar_base,
-  &lament_model_star_d,
-  &lament_model_star_u,
-  &lament_model_taser_a,
-  &lament_model_taser_b,
-  &lament_model_taser_base,
-  &lament_model_tetra_base,
-  &lament_model_tetra_dse,
-  &lament_model_tetra_dwn,
-  &lament_model_tetra_une,
-  &lament_model_tetra_usw
+extern const unsigned char lament_model[];
+extern const unsigned long lament_model_size;
+
+/* The layers of lament_model. */
+static const char * const all_objs[] = {
+  "box",
+  "iso_base_a",
+  "iso_base_b",
+  "iso_den",
+  "iso_dse",
+  "iso_dwn",
+  "iso_swd",
+  "iso_une",
+  "iso_unw",
+  "iso_use",
+  "iso_usw",
+  "leviathan",
+  "lid_a",
+  "lid_b",
+  "lid_base",
+  "lid_c",
+  "lid_d",
+  "pillar_a",
+  "pillar_b",
+  "pillar_base",
+  "star_d",
+  "star_u",
+  "taser_a",
+  "taser_b",
+  "taser_base",
+  "tetra_base",
+  "tetra_dse",
+  "tetra_dwn",
+  "tetra_une",
+  "tetra_usw"
 };
 
 typedef enum {	/* must be in the same order as in `all_objs'. */
@@ -1614,10 +1586,20 @@ gl_init (ModeInfo *mi)
   for (i = 0; i < countof(all_objs); i++)
     {
       GLfloat s = 1/3.0;  /* box is 3" square */
-      const struct gllist *L = *all_objs[i];
-      const GLfloat *f = (const GLfloat *) L->data;
+      const struct gllist *L = gllist_read_mesh (lament_model,
+                                                 lament_model_size,
+                                                 all_objs[i]);
+      const GLfloat *f;
       int j;
 
+      if (!L)
+        {
+          fprintf (stderr, "%s: unable to load model %s\n",
+                   progname, all_objs[i]);
+          exit (1);
+        }
+      f = gllist_floats (L);
+
       lc->dlists[i] = glGenLists(1);
       lc->polys[i] = L->points / 3;
       glNewList(lc->dlists[i], GL_COMPILE);
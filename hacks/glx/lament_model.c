@@ -1,5 +1,6 @@
-/* Generated from "lament.dxf" on Aug-25-2014.
-   Smoothed vertex normals.
+/* Generated from "lament.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°.
    Components: box, iso_base_a, iso_base_b, iso_den, iso_dse, iso_dwn,
      iso_swd, iso_une, iso_unw, iso_use, iso_usw, leviathan, lid_a, lid_b,
      lid_base, lid_c, lid_d, pillar_a, pillar_b, pillar_base, star_d,
@@ -9,16250 +10,5620 @@
 
 #include "gllist.h"
 
-static const float lament_model_box_data[] = {
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.077767,2.131917,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	0,0.447214,-0.894427,2.502268,3,0,
-	0,1,0,2.795,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,-0.447214,-0.894427,2.502268,0,0,
-	0.408248,-0.408248,-0.816497,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0.408248,-0.408248,-0.816497,3,0,0,
-	0.6,0,-0.8,3,0.497732,0,
-	1,0,0,3,0.205,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0.447214,0,-0.894427,3,2.502268,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	1,0,0,3,2.795,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,3,0,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	0,0,1,2.502268,0,3,
-	0,-0.948683,-0.316228,2.795,0,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.502268,3,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,3,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,3,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0.447214,0,0.894427,3,2.502268,3,
-	1,0,0,3,2.795,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.5,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0,3,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,3,0,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,3,0,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0.447214,0,0.894427,3,0.497732,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	1,0,0,3,0.205,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.87868,3,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,3,
-	0,0,-1,1.5,0,3,
-	0,0,-1,2.795,0,3,
-	0,0,-1,2.502268,0,3,
-	0,0,-1,1.5,0,3,
-	0,0,-1,2.502268,0,3,
-	0,0,-1,2.12132,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.798369,0,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.87868,0,3,
-	0,0,-1,0.205,0,3,
-	0,0,-1,0.87868,0,3,
-	0,0,-1,0.497732,0,3,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,3,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,3,
-	0,1,0,2.795,3,3,
-	0,0.447214,0.894427,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,2.12132,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,2.502268,3,3,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,3,
-	0,0.447214,0.894427,1.5,3,3,
-	0,0.83205,0.5547,0.205,3,3,
-	0,0,1,0.497732,3,3,
-	0,0.447214,0.894427,1.5,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0.447214,0.894427,1.5,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.201631,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0,0,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,0.205,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0.205,
-	1,0,0,3,3,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,2.795,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,3,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,3,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,0,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,1.5,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.720616,2.227275,3
-};
-static const struct gllist lament_model_box_frame = { GL_N3F_V3F, GL_TRIANGLES, 1584, lament_model_box_data, 0 };
-const struct gllist *lament_model_box = &lament_model_box_frame;
-
-static const float lament_model_iso_base_a_data[] = {
-	0,-1,0,0.883139,0,2.116861,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.883139,0,2.116861,
-	0,-1,0,0.679903,0,1.974903,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,0.42625,2.57375,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.5,2.54773,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,2.25,0.75,
-	0,-1,0,2.649417,0,1.645583,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.54773,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.649417,0,1.645583,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,2.57375,0,2.57375,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,2.57375,0,2.57375,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,1.854008,0,2.795,
-	0,-1,0,1.974903,0,0.679903,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.64319,0,0.205,
-	1,0,0,3,0.45227,1.5,
-	1,0,0,3,0.205,2.3525,
-	1,0,0,3,0.205,1.854008,
-	1,0,0,3,0.205,2.3525,
-	1,0,0,3,0.45227,1.5,
-	1,0,0,3,0.42625,2.57375,
-	1,0,0,3,0.42625,2.57375,
-	1,0,0,3,0.45227,1.5,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,0.8525,3,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,0.45227,1.5,
-	1,0,0,3,0.883139,0.883139,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,0.883139,0.883139,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,1.5,0.205,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.077767,0.868083,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,1.5,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.720616,2.227275,3,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.75,0,0.75,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.351731,0.754603,3,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0.205,0,1.5,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,2.54773,1.5,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,3,0.8525,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.5,0.74,3,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,1.5,0,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,2.1475,0,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.251134,2.751134,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,1.251134,2.751134,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.251134,2.751134,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.351731,2.245397,3,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,1.295,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,2.25,0.75,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.25,0.75,
-	1,0,0,3,2.795,1.295,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.251134,2.751134,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.348827,2.26,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.227275,1.720616,3,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,1.5,2.54773,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,1.5,1.5,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,1.64319,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,1.64319,
-	1,0,0,3,2.795,1.5,
-	0,-1,0,0.205,0,1.64319,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,0.883139,0,2.116861,
-	0,-1,0,1.5,0,1.5,
-	1,0,0,3,0.205,2.3525,
-	1,0,0,3,0,2.1475,
-	1,0,0,3,0.205,1.854008,
-	0,-1,0,1.64319,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,0.679903,0,1.974903,
-	0,-1,0,0.205,0,1.64319,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0.75,0,0.75,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.974903,0,0.679903,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.974903,0,0.679903,
-	0,-1,0,2.116861,0,0.883139,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,2.795,0,1.854008,
-	0,-1,0,3,0,2.1475,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.116861,0,0.883139,
-	0,-1,0,2.54773,0,1.5,
-	0,-1,0,2.795,0,1.854008,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.649417,0,1.645583,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,1.854008,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,2.57375,0,2.57375,
-	0,-1,0,2.1475,0,3,
-	0,-1,0,1.854008,0,2.795,
-	0,-1,0,2.3525,0,2.795,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.54773,1.5,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.209161,0.797852,3,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.077767,2.131917,3,
-	-0.442836,-0.633994,0.633994,2.1475,0,3,
-	-0.442836,-0.633994,0.633994,2.110662,0.025731,3,
-	-0.442836,-0.633994,0.633994,1.854008,0,2.795,
-	-0.442836,-0.633994,0.633994,0.205,0,1.64319,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,0,0,1.5,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,0.205,0,1.64319,
-	-0.442836,-0.633994,0.633994,0.679903,0,1.974903,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,0.679903,0,1.974903,
-	-0.442836,-0.633994,0.633994,0.883139,0,2.116861,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,0.883139,0,2.116861,
-	-0.442836,-0.633994,0.633994,1.5,0,2.54773,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,1.5,0,2.54773,
-	-0.442836,-0.633994,0.633994,1.645583,0,2.649417,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,1.645583,0,2.649417,
-	-0.442836,-0.633994,0.633994,1.854008,0,2.795,
-	-0.442836,-0.633994,0.633994,0,1.5,3,
-	-0.442836,-0.633994,0.633994,1.854008,0,2.795,
-	-0.442836,-0.633994,0.633994,2.110662,0.025731,3,
-	0,0,1,0,1.5,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,0,1.5,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,0,1.5,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,0,1.5,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,-1,0,1.5,3,
-	0,0,-1,1.163402,0.68738,3,
-	0,0,-1,1.022694,0.785662,3,
-	0,0,1,0,1.5,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,-1,0,1.5,3,
-	0,0,-1,0.883139,0.883139,3,
-	0,0,-1,0.733368,0.987753,3,
-	0,0,-1,0,1.5,3,
-	0,0,-1,0.733368,0.987753,3,
-	0,0,-1,0.55839,1.109972,3,
-	0,0,-1,0,1.5,3,
-	0,0,-1,0.55839,1.109972,3,
-	0,0,-1,0.332481,1.267766,3,
-	0.633994,0.442836,0.633994,3,1.145992,2.795,
-	0.633994,0.442836,0.633994,2.974269,0.889338,3,
-	0.633994,0.442836,0.633994,3,0.8525,3,
-	0.633994,0.442836,0.633994,2.974269,0.889338,3,
-	0.633994,0.442836,0.633994,3,1.145992,2.795,
-	0.633994,0.442836,0.633994,2.716787,1.257966,3,
-	0.633994,0.442836,0.633994,2.716787,1.257966,3,
-	0.633994,0.442836,0.633994,3,1.145992,2.795,
-	0.633994,0.442836,0.633994,3,1.5,2.54773,
-	0.633994,0.442836,0.633994,2.716787,1.257966,3,
-	0.633994,0.442836,0.633994,3,1.5,2.54773,
-	0.633994,0.442836,0.633994,2.54773,1.5,3,
-	0.633994,0.442836,0.633994,2.54773,1.5,3,
-	0.633994,0.442836,0.633994,3,1.5,2.54773,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.54773,1.5,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.419919,1.682983,3,
-	0.633994,0.442836,0.633994,2.419919,1.682983,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.31262,1.836598,3,
-	0.633994,0.442836,0.633994,2.31262,1.836598,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.214338,1.977306,3,
-	0.633994,0.442836,0.633994,2.214338,1.977306,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.116861,2.116861,3,
-	0.633994,0.442836,0.633994,2.116861,2.116861,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,2.012247,2.266632,3,
-	0.633994,0.442836,0.633994,2.012247,2.266632,3,
-	0.633994,0.442836,0.633994,3,2.116861,2.116861,
-	0.633994,0.442836,0.633994,3,2.795,1.64319,
-	0.633994,0.442836,0.633994,2.012247,2.266632,3,
-	0.633994,0.442836,0.633994,3,2.795,1.64319,
-	0.633994,0.442836,0.633994,1.890028,2.44161,3,
-	0.633994,0.442836,0.633994,1.890028,2.44161,3,
-	0.633994,0.442836,0.633994,3,2.795,1.64319,
-	0.633994,0.442836,0.633994,1.732234,2.667519,3,
-	0.633994,0.442836,0.633994,1.732234,2.667519,3,
-	0.633994,0.442836,0.633994,3,2.795,1.64319,
-	0.633994,0.442836,0.633994,1.5,3,3,
-	0.633994,0.442836,0.633994,1.5,3,3,
-	0.633994,0.442836,0.633994,3,2.795,1.64319,
-	0.633994,0.442836,0.633994,3,3,1.5,
-	-0.57735,0.57735,-0.57735,1.295,0,0.205,
-	-0.57735,0.57735,-0.57735,3,1.5,0,
-	-0.57735,0.57735,-0.57735,1.5,0,0,
-	-0.57735,0.57735,-0.57735,3,1.5,0,
-	-0.57735,0.57735,-0.57735,1.295,0,0.205,
-	-0.57735,0.57735,-0.57735,3,1.705,0.205,
-	-0.57735,0.57735,-0.57735,3,1.705,0.205,
-	-0.57735,0.57735,-0.57735,1.295,0,0.205,
-	-0.57735,0.57735,-0.57735,0.75,0,0.75,
-	-0.57735,0.57735,-0.57735,3,1.705,0.205,
-	-0.57735,0.57735,-0.57735,0.75,0,0.75,
-	-0.57735,0.57735,-0.57735,3,2.25,0.75,
-	-0.57735,0.57735,-0.57735,3,2.25,0.75,
-	-0.57735,0.57735,-0.57735,0.75,0,0.75,
-	-0.57735,0.57735,-0.57735,0.205,0,1.295,
-	-0.57735,0.57735,-0.57735,3,2.25,0.75,
-	-0.57735,0.57735,-0.57735,0.205,0,1.295,
-	-0.57735,0.57735,-0.57735,3,2.795,1.295,
-	-0.57735,0.57735,-0.57735,3,2.795,1.295,
-	-0.57735,0.57735,-0.57735,0.205,0,1.295,
-	-0.57735,0.57735,-0.57735,0,0,1.5,
-	-0.57735,0.57735,-0.57735,3,2.795,1.295,
-	-0.57735,0.57735,-0.57735,0,0,1.5,
-	-0.57735,0.57735,-0.57735,3,3,1.5,
-	-0.57735,0.57735,-0.57735,3,3,1.5,
-	-0.57735,0.57735,-0.57735,0,0,1.5,
-	-0.57735,0.57735,-0.57735,0,1.5,3,
-	-0.57735,0.57735,-0.57735,3,3,1.5,
-	-0.57735,0.57735,-0.57735,0,1.5,3,
-	-0.57735,0.57735,-0.57735,1.5,3,3,
-	0,0,-1,1.5,3,3,
-	0,0,-1,0,1.5,3,
-	0,0,-1,0.248866,1.748866,3,
-	0,0,1,1.5,3,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,-1,1.5,3,3,
-	0,0,-1,0.43934,1.93934,3,
-	0,0,-1,0.600816,2.100816,3,
-	0,0,1,1.5,3,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,1.5,3,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,-1,1.5,3,3,
-	0,0,-1,0.899184,2.399184,3,
-	0,0,-1,1.06066,2.56066,3,
-	0,0,-1,1.5,3,3,
-	0,0,-1,1.06066,2.56066,3,
-	0,0,-1,1.251134,2.751134,3,
-	0.012176,0.99989,-0.008505,1.5,0,0,
-	0.012176,0.99989,-0.008505,1.974903,0,0.679903,
-	0.012176,0.99989,-0.008505,1.64319,0,0.205,
-	0.633994,-0.633994,-0.442836,1.974903,0,0.679903,
-	0.633994,-0.633994,-0.442836,1.5,0,0,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,1.974903,0,0.679903,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,2.116861,0,0.883139,
-	0.633994,-0.633994,-0.442836,2.116861,0,0.883139,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,2.54773,0,1.5,
-	0.633994,-0.633994,-0.442836,2.54773,0,1.5,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,2.649417,0,1.645583,
-	0.633994,-0.633994,-0.442836,2.649417,0,1.645583,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,2.795,0,1.854008,
-	0.633994,-0.633994,-0.442836,2.795,0,1.854008,
-	0.633994,-0.633994,-0.442836,3,1.5,0,
-	0.633994,-0.633994,-0.442836,3,0.205,1.854008,
-	0.633994,-0.633994,-0.442836,2.795,0,1.854008,
-	0.633994,-0.633994,-0.442836,3,0.205,1.854008,
-	0.633994,-0.633994,-0.442836,3,0,2.1475,
-	-1,0,0,3,0.205,1.854008,
-	-1,0,0,3,1.5,0,
-	-1,0,0,3,0.883139,0.883139,
-	-1,0,0,3,0.205,1.854008,
-	-1,0,0,3,0.883139,0.883139,
-	-1,0,0,3,0.45227,1.5,
-	-1,0,0,3,0.883139,0.883139,
-	-1,0,0,3,1.5,0,
-	-1,0,0,3,1.35681,0.205,
-	0.57735,-0.57735,0.57735,2.3525,0,2.795,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,2.1475,0,3,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,2.3525,0,2.795,
-	0.57735,-0.57735,0.57735,2.57375,0,2.57375,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,2.57375,0,2.57375,
-	0.57735,-0.57735,0.57735,2.795,0,2.3525,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,2.795,0,2.3525,
-	0.57735,-0.57735,0.57735,3,0,2.1475,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,3,0,2.1475,
-	0.57735,-0.57735,0.57735,3,0.205,2.3525,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,3,0.205,2.3525,
-	0.57735,-0.57735,0.57735,3,0.42625,2.57375,
-	0.57735,-0.57735,0.57735,2.360168,0.212668,3,
-	0.57735,-0.57735,0.57735,3,0.42625,2.57375,
-	0.57735,-0.57735,0.57735,2.57375,0.42625,3,
-	0.57735,-0.57735,0.57735,2.57375,0.42625,3,
-	0.57735,-0.57735,0.57735,3,0.42625,2.57375,
-	0.57735,-0.57735,0.57735,3,0.6475,2.795,
-	0.57735,-0.57735,0.57735,2.57375,0.42625,3,
-	0.57735,-0.57735,0.57735,3,0.6475,2.795,
-	0.57735,-0.57735,0.57735,2.787332,0.639832,3,
-	0.57735,-0.57735,0.57735,2.787332,0.639832,3,
-	0.57735,-0.57735,0.57735,3,0.6475,2.795,
-	0.57735,-0.57735,0.57735,3,0.8525,3
-};
-static const struct gllist lament_model_iso_base_a_frame = { GL_N3F_V3F, GL_TRIANGLES, 858, lament_model_iso_base_a_data, 0 };
-const struct gllist *lament_model_iso_base_a = &lament_model_iso_base_a_frame;
-
-static const float lament_model_iso_base_b_data[] = {
-	0.442836,0.633994,-0.633994,1.145992,3,0.205,
-	0.442836,0.633994,-0.633994,0.889338,2.974269,0,
-	0.442836,0.633994,-0.633994,0.8525,3,0,
-	0.442836,0.633994,-0.633994,0.889338,2.974269,0,
-	0.442836,0.633994,-0.633994,1.145992,3,0.205,
-	0.442836,0.633994,-0.633994,1.257966,2.716787,0,
-	0.442836,0.633994,-0.633994,1.257966,2.716787,0,
-	0.442836,0.633994,-0.633994,1.145992,3,0.205,
-	0.442836,0.633994,-0.633994,1.354417,3,0.350583,
-	0.442836,0.633994,-0.633994,1.257966,2.716787,0,
-	0.442836,0.633994,-0.633994,1.354417,3,0.350583,
-	0.442836,0.633994,-0.633994,1.5,2.54773,0,
-	0.442836,0.633994,-0.633994,1.5,2.54773,0,
-	0.442836,0.633994,-0.633994,1.354417,3,0.350583,
-	0.442836,0.633994,-0.633994,1.5,3,0.45227,
-	0.442836,0.633994,-0.633994,1.5,2.54773,0,
-	0.442836,0.633994,-0.633994,1.5,3,0.45227,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,1.5,2.54773,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,1.682983,2.419919,0,
-	0.442836,0.633994,-0.633994,1.682983,2.419919,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,1.836598,2.31262,0,
-	0.442836,0.633994,-0.633994,1.836598,2.31262,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,1.977306,2.214338,0,
-	0.442836,0.633994,-0.633994,1.977306,2.214338,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,2.116861,2.116861,0,
-	0.442836,0.633994,-0.633994,2.116861,2.116861,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,2.266632,2.012247,0,
-	0.442836,0.633994,-0.633994,2.266632,2.012247,0,
-	0.442836,0.633994,-0.633994,2.116861,3,0.883139,
-	0.442836,0.633994,-0.633994,2.320097,3,1.025097,
-	0.442836,0.633994,-0.633994,2.266632,2.012247,0,
-	0.442836,0.633994,-0.633994,2.320097,3,1.025097,
-	0.442836,0.633994,-0.633994,2.44161,1.890028,0,
-	0.442836,0.633994,-0.633994,2.44161,1.890028,0,
-	0.442836,0.633994,-0.633994,2.320097,3,1.025097,
-	0.442836,0.633994,-0.633994,2.795,3,1.35681,
-	0.442836,0.633994,-0.633994,2.44161,1.890028,0,
-	0.442836,0.633994,-0.633994,2.795,3,1.35681,
-	0.442836,0.633994,-0.633994,2.667519,1.732234,0,
-	0.442836,0.633994,-0.633994,2.667519,1.732234,0,
-	0.442836,0.633994,-0.633994,2.795,3,1.35681,
-	0.442836,0.633994,-0.633994,3,1.5,0,
-	0.442836,0.633994,-0.633994,3,1.5,0,
-	0.442836,0.633994,-0.633994,2.795,3,1.35681,
-	0.442836,0.633994,-0.633994,3,3,1.5,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.116861,3,0.883139,
-	0,1,0,1.5,3,0.45227,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,1.35681,3,2.795,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,1.025097,3,2.320097,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0,2.1475,0,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.962599,2.037401,0,
-	-1,0,0,0,2.1475,0,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,2.1475,0.205,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,1,0,0.350583,3,1.354417,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.350583,3,1.354417,
-	0,1,0,0.45227,3,1.5,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.25,3,2.25,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.25,3,2.25,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.705,3,2.795,
-	0,1,0,0.6475,3,0.205,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,1.145992,3,0.205,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,0.6475,3,0.205,
-	0,1,0,0.42625,3,0.42625,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,0.42625,3,0.42625,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.320097,3,1.025097,
-	0,1,0,2.116861,3,0.883139,
-	0,1,0,2.320097,3,1.025097,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.42625,3,0.42625,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0.350583,3,1.354417,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.705,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,1.705,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.25,3,2.25,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,2.320097,3,1.025097,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,0.45227,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,1.5,3,0.45227,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,1.5,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0,3,0.8525,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.351731,2.245397,0,
-	-1,0,0,0,1.5,0.45227,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,1.5,1.5,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	-0.633994,-0.442836,-0.633994,0,0.205,1.35681,
-	-0.633994,-0.442836,-0.633994,1.5,0,0,
-	-0.633994,-0.442836,-0.633994,0,0,1.5,
-	-0.633994,-0.442836,-0.633994,1.5,0,0,
-	-0.633994,-0.442836,-0.633994,0,0.205,1.35681,
-	-0.633994,-0.442836,-0.633994,1.267766,0.332481,0,
-	-0.633994,-0.442836,-0.633994,1.267766,0.332481,0,
-	-0.633994,-0.442836,-0.633994,0,0.205,1.35681,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,1.267766,0.332481,0,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,1.109972,0.55839,0,
-	-0.633994,-0.442836,-0.633994,1.109972,0.55839,0,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,0.987753,0.733368,0,
-	-0.633994,-0.442836,-0.633994,0.987753,0.733368,0,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,0.883139,0.883139,0,
-	-0.633994,-0.442836,-0.633994,0.883139,0.883139,0,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,0.785662,1.022694,0,
-	-0.633994,-0.442836,-0.633994,0.785662,1.022694,0,
-	-0.633994,-0.442836,-0.633994,0,0.883139,0.883139,
-	-0.633994,-0.442836,-0.633994,0,1.5,0.45227,
-	-0.633994,-0.442836,-0.633994,0.785662,1.022694,0,
-	-0.633994,-0.442836,-0.633994,0,1.5,0.45227,
-	-0.633994,-0.442836,-0.633994,0.68738,1.163402,0,
-	-0.633994,-0.442836,-0.633994,0.68738,1.163402,0,
-	-0.633994,-0.442836,-0.633994,0,1.5,0.45227,
-	-0.633994,-0.442836,-0.633994,0.580081,1.317017,0,
-	-0.633994,-0.442836,-0.633994,0.580081,1.317017,0,
-	-0.633994,-0.442836,-0.633994,0,1.5,0.45227,
-	-0.633994,-0.442836,-0.633994,0.45227,1.5,0,
-	-0.633994,-0.442836,-0.633994,0.45227,1.5,0,
-	-0.633994,-0.442836,-0.633994,0,1.5,0.45227,
-	-0.633994,-0.442836,-0.633994,0,1.854008,0.205,
-	-0.633994,-0.442836,-0.633994,0.45227,1.5,0,
-	-0.633994,-0.442836,-0.633994,0,1.854008,0.205,
-	-0.633994,-0.442836,-0.633994,0.283213,1.742034,0,
-	-0.633994,-0.442836,-0.633994,0.283213,1.742034,0,
-	-0.633994,-0.442836,-0.633994,0,1.854008,0.205,
-	-0.633994,-0.442836,-0.633994,0.025731,2.110662,0,
-	-0.633994,-0.442836,-0.633994,0.025731,2.110662,0,
-	-0.633994,-0.442836,-0.633994,0,1.854008,0.205,
-	-0.633994,-0.442836,-0.633994,0,2.1475,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.267766,0.332481,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0.74,0,
-	0.57735,-0.57735,0.57735,1.5,0,0,
-	0.57735,-0.57735,0.57735,0,0.205,1.705,
-	0.57735,-0.57735,0.57735,0,0,1.5,
-	0.57735,-0.57735,0.57735,0,0.205,1.705,
-	0.57735,-0.57735,0.57735,1.5,0,0,
-	0.57735,-0.57735,0.57735,1.748866,0.248866,0,
-	0.57735,-0.57735,0.57735,0,0.205,1.705,
-	0.57735,-0.57735,0.57735,1.748866,0.248866,0,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,1.748866,0.248866,0,
-	0.57735,-0.57735,0.57735,1.93934,0.43934,0,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,1.93934,0.43934,0,
-	0.57735,-0.57735,0.57735,2.100816,0.600816,0,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,2.100816,0.600816,0,
-	0.57735,-0.57735,0.57735,2.25,0.75,0,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,2.25,0.75,0,
-	0.57735,-0.57735,0.57735,2.399184,0.899184,0,
-	0.57735,-0.57735,0.57735,0,0.75,2.25,
-	0.57735,-0.57735,0.57735,2.399184,0.899184,0,
-	0.57735,-0.57735,0.57735,0,1.295,2.795,
-	0.57735,-0.57735,0.57735,0,1.295,2.795,
-	0.57735,-0.57735,0.57735,2.399184,0.899184,0,
-	0.57735,-0.57735,0.57735,2.56066,1.06066,0,
-	0.57735,-0.57735,0.57735,0,1.295,2.795,
-	0.57735,-0.57735,0.57735,2.56066,1.06066,0,
-	0.57735,-0.57735,0.57735,2.751134,1.251134,0,
-	0.57735,-0.57735,0.57735,0,1.295,2.795,
-	0.57735,-0.57735,0.57735,2.751134,1.251134,0,
-	0.57735,-0.57735,0.57735,3,1.5,0,
-	0.57735,-0.57735,0.57735,0,1.295,2.795,
-	0.57735,-0.57735,0.57735,3,1.5,0,
-	0.57735,-0.57735,0.57735,0,1.5,3,
-	0.57735,-0.57735,0.57735,0,1.5,3,
-	0.57735,-0.57735,0.57735,3,1.5,0,
-	0.57735,-0.57735,0.57735,3,3,1.5,
-	0.57735,-0.57735,0.57735,0,1.5,3,
-	0.57735,-0.57735,0.57735,3,3,1.5,
-	0.57735,-0.57735,0.57735,1.705,3,2.795,
-	0.627963,0.459701,0.627963,1.705,3,2.795,
-	0.713615,0.660796,0.232598,3,3,1.5,
-	0,1,0,2.25,3,2.25,
-	0,1,0,2.25,3,2.25,
-	0.713615,0.660796,0.232598,3,3,1.5,
-	0,1,0,2.795,3,1.705,
-	0.57735,-0.57735,0.57735,1.5,3,3,
-	0.57735,-0.57735,0.57735,0,1.5,3,
-	0.57735,-0.57735,0.57735,1.705,3,2.795,
-	-0.633994,0.633994,0.442836,1.5,3,3,
-	-0.633994,0.633994,0.442836,0,1.64319,2.795,
-	-0.633994,0.633994,0.442836,0,1.5,3,
-	-0.633994,0.633994,0.442836,0,1.64319,2.795,
-	-0.633994,0.633994,0.442836,1.5,3,3,
-	-0.633994,0.633994,0.442836,0,2.116861,2.116861,
-	-0.633994,0.633994,0.442836,0,2.116861,2.116861,
-	-0.633994,0.633994,0.442836,1.5,3,3,
-	-0.633994,0.633994,0.442836,0,2.54773,1.5,
-	-0.633994,0.633994,0.442836,0,2.54773,1.5,
-	-0.633994,0.633994,0.442836,1.5,3,3,
-	-0.633994,0.633994,0.442836,0,2.795,1.145992,
-	-0.633994,0.633994,0.442836,0,2.795,1.145992,
-	-0.633994,0.633994,0.442836,1.5,3,3,
-	-0.633994,0.633994,0.442836,1.35681,3,2.795,
-	-0.633994,0.633994,0.442836,1.35681,3,2.795,
-	-0.633994,0.633994,0.442836,0,3,0.8525,
-	-0.633994,0.633994,0.442836,0,2.795,1.145992,
-	0,1,0,0,3,0.8525,
-	0,1,0,1.35681,3,2.795,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0,3,0.8525,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,0,3,0.8525,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0,3,0.8525,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0.350583,3,1.354417,
-	0,-1,0,0,3,0.8525,
-	0,-1,0,0.350583,3,1.354417,
-	0,-1,0,0.205,3,1.145992,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,2.795,0.6475,
-	-0.836014,0.387995,-0.387995,0,2.795,0.6475,
-	-0.903879,0.350707,0.244964,0,2.795,1.145992,
-	-1,0,0,0,2.795,0.8525,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,3,0.8525,
-	-1,0,0,0,2.795,0.8525,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,2.116861,2.116861,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,1.5,0.45227,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,0.45227,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,2.1475,0.205,
-	-1,0,0,0,2.1475,0.205,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,0.205,1.705,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,3,0.8525,
-	-1,0,0,0,2.795,0.6475,
-	-1,0,0,0,2.795,0.8525,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.267766,0.332481,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.267766,0.332481,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.267766,0.332481,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,1,0,2.795,3,1.705,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,0.8525,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.8525,3,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,2.795,3,1.5,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0.212668,2.360168,0,
-	-0.57735,0.57735,-0.57735,0,2.1475,0,
-	-0.57735,0.57735,-0.57735,0.212668,2.360168,0,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0.42625,2.57375,0,
-	-0.57735,0.57735,-0.57735,0.42625,2.57375,0,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0.639832,2.787332,0,
-	-0.57735,0.57735,-0.57735,0.639832,2.787332,0,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0.8525,3,0,
-	-0.57735,0.57735,-0.57735,0.8525,3,0,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0.6475,3,0.205,
-	-0.57735,0.57735,-0.57735,0.6475,3,0.205,
-	-0.57735,0.57735,-0.57735,0,2.3525,0.205,
-	-0.57735,0.57735,-0.57735,0,2.57375,0.42625,
-	-0.57735,0.57735,-0.57735,0.6475,3,0.205,
-	-0.57735,0.57735,-0.57735,0,2.57375,0.42625,
-	-0.57735,0.57735,-0.57735,0.42625,3,0.42625,
-	-0.57735,0.57735,-0.57735,0.42625,3,0.42625,
-	-0.57735,0.57735,-0.57735,0,2.57375,0.42625,
-	-0.57735,0.57735,-0.57735,0,2.795,0.6475,
-	-0.57735,0.57735,-0.57735,0.42625,3,0.42625,
-	-0.57735,0.57735,-0.57735,0,2.795,0.6475,
-	-0.57735,0.57735,-0.57735,0.205,3,0.6475,
-	-0.57735,0.57735,-0.57735,0.205,3,0.6475,
-	-0.57735,0.57735,-0.57735,0,2.795,0.6475,
-	-0.57735,0.57735,-0.57735,0,3,0.8525,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,1,0,0.6475,3,0.205,
-	0,1,0,1.145992,3,0.205,
-	0,1,0,0.8525,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.648269,2.245397,0,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,1.35681,
-	-1,0,0,0,0,1.5,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,1,0,1.5,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.35681,3,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,0.205,1.35681,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.5,1.5,
-	0,1,0,1.5,3,3,
-	0,1,0,1.705,3,2.795,
-	0,1,0,1.5,3,2.795,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.116861,2.116861,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,2.1475,0,
-	-1,0,0,0,2.1475,0.205,
-	-1,0,0,0,0.205,1.705,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,1.705,
-	-1,0,0,0,0.75,2.25,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.75,2.25,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,1.5,2.795
-};
-static const struct gllist lament_model_iso_base_b_frame = { GL_N3F_V3F, GL_TRIANGLES, 864, lament_model_iso_base_b_data, 0 };
-const struct gllist *lament_model_iso_base_b = &lament_model_iso_base_b_frame;
-
-static const float lament_model_iso_den_data[] = {
-	0,1,0,1.5,3,0.45227,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.45227,
-	0,1,0,2.116861,3,0.883139,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,1.836598,2.31262,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,1.977306,2.214338,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0.485071,0.485071,-0.727607,3,3,0,
-	0,0.5547,-0.83205,2.502268,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.45227,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.320097,3,1.025097,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.354417,3,0.350583,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.145992,3,0.205,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.35681,
-	0,1,0,3,3,1.5,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.682983,2.419919,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,2.116861,2.116861,0,
-	0,0,-1,2.266632,2.012247,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0.5547,0,-0.83205,3,2.502268,0,
-	0.485071,0.485071,-0.727607,3,3,0,
-	1,0,0,3,2.795,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0,
-	0,1,0,0.8525,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.8525,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,0.8525,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.8525,3,0,
-	0,1,0,1.145992,3,0.205,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.257966,2.716787,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.54773,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,2.44161,1.890028,0,
-	0,0,-1,2.667519,1.732234,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.25,0.75,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,3,0,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0,
-	1,0,0,3,2.795,1.295,
-	1,0,0,3,2.25,0.75,
-	1,0,0,3,2.795,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,1.295,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.295,
-	1,0,0,3,3,0.205,
-	1,0,0,3,3,1.5,
-	0,1,0,2.320097,3,1.025097,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.116861,3,0.883139,
-	0,0,-1,0.889338,2.974269,0,
-	0,0,-1,0.8525,3,0,
-	0,0,-1,0.87868,3,0,
-	-0.442836,-0.633994,0.633994,0.889338,2.974269,0,
-	-0.442836,-0.633994,0.633994,1.145992,3,0.205,
-	-0.442836,-0.633994,0.633994,0.8525,3,0,
-	-0.442836,-0.633994,0.633994,1.145992,3,0.205,
-	-0.442836,-0.633994,0.633994,0.889338,2.974269,0,
-	-0.442836,-0.633994,0.633994,1.257966,2.716787,0,
-	-0.442836,-0.633994,0.633994,1.145992,3,0.205,
-	-0.442836,-0.633994,0.633994,1.257966,2.716787,0,
-	-0.442836,-0.633994,0.633994,1.354417,3,0.350583,
-	-0.442836,-0.633994,0.633994,1.354417,3,0.350583,
-	-0.442836,-0.633994,0.633994,1.257966,2.716787,0,
-	-0.442836,-0.633994,0.633994,1.5,2.54773,0,
-	-0.442836,-0.633994,0.633994,1.354417,3,0.350583,
-	-0.442836,-0.633994,0.633994,1.5,2.54773,0,
-	-0.442836,-0.633994,0.633994,1.5,3,0.45227,
-	-0.442836,-0.633994,0.633994,1.5,3,0.45227,
-	-0.442836,-0.633994,0.633994,1.5,2.54773,0,
-	-0.442836,-0.633994,0.633994,1.682983,2.419919,0,
-	-0.442836,-0.633994,0.633994,1.5,3,0.45227,
-	-0.442836,-0.633994,0.633994,1.682983,2.419919,0,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,1.682983,2.419919,0,
-	-0.442836,-0.633994,0.633994,1.836598,2.31262,0,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,1.836598,2.31262,0,
-	-0.442836,-0.633994,0.633994,1.977306,2.214338,0,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,1.977306,2.214338,0,
-	-0.442836,-0.633994,0.633994,2.116861,2.116861,0,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,2.116861,2.116861,0,
-	-0.442836,-0.633994,0.633994,2.266632,2.012247,0,
-	-0.442836,-0.633994,0.633994,2.116861,3,0.883139,
-	-0.442836,-0.633994,0.633994,2.266632,2.012247,0,
-	-0.442836,-0.633994,0.633994,2.320097,3,1.025097,
-	-0.442836,-0.633994,0.633994,2.320097,3,1.025097,
-	-0.442836,-0.633994,0.633994,2.266632,2.012247,0,
-	-0.442836,-0.633994,0.633994,2.44161,1.890028,0,
-	-0.442836,-0.633994,0.633994,2.320097,3,1.025097,
-	-0.442836,-0.633994,0.633994,2.44161,1.890028,0,
-	-0.442836,-0.633994,0.633994,2.795,3,1.35681,
-	-0.442836,-0.633994,0.633994,2.795,3,1.35681,
-	-0.442836,-0.633994,0.633994,2.44161,1.890028,0,
-	-0.442836,-0.633994,0.633994,2.667519,1.732234,0,
-	-0.442836,-0.633994,0.633994,2.795,3,1.35681,
-	-0.442836,-0.633994,0.633994,2.667519,1.732234,0,
-	-0.442836,-0.633994,0.633994,3,1.5,0,
-	-0.442836,-0.633994,0.633994,2.795,3,1.35681,
-	-0.442836,-0.633994,0.633994,3,1.5,0,
-	-0.442836,-0.633994,0.633994,3,3,1.5,
-	0.605634,0.397847,0.689148,3,3,1.5,
-	0.087875,-0.974602,0.205981,3,1.5,0,
-	1,0,0,3,1.705,0.205,
-	0.605634,0.397847,0.689148,3,3,1.5,
-	1,0,0,3,1.705,0.205,
-	1,0,0,3,2.25,0.75,
-	0.605634,0.397847,0.689148,3,3,1.5,
-	1,0,0,3,2.25,0.75,
-	1,0,0,3,2.795,1.295
-};
-static const struct gllist lament_model_iso_den_frame = { GL_N3F_V3F, GL_TRIANGLES, 222, lament_model_iso_den_data, 0 };
-const struct gllist *lament_model_iso_den = &lament_model_iso_den_frame;
-
-static const float lament_model_iso_dse_data[] = {
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.748866,0.248866,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.93934,0.43934,0,
-	0,0,-1,2.12132,0,0,
-	0,-1,0,2.649417,0,1.645583,
-	0,-1,0,2.54773,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	-0.003005,-0.999993,0.002099,1.64319,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	-0.003005,-0.999993,0.002099,1.64319,0,0.205,
-	0,-1,0,2.1475,0,0.8525,
-	-0.004007,-0.999988,0.002799,1.974903,0,0.679903,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.116861,0,0.883139,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.116861,0,0.883139,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.54773,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.795,0,0.205,
-	-0.004007,-0.999988,0.002799,1.5,0,0,
-	-0.004007,-0.999988,0.002799,1.5,0,0,
-	0,-1,0,2.795,0,0.205,
-	-0.003005,-0.999993,0.002099,1.64319,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	1,0,0,3,0.883139,0.883139,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.883139,0.883139,
-	1,0,0,3,0.45227,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0,
-	0,-1,0,3,0,0.205,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.100816,0.600816,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,3,0,0,
-	0,-0.5547,-0.83205,2.502268,0,0,
-	0.485071,-0.485071,-0.727607,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.25,0.75,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.399184,0.899184,0,
-	0,0,-1,3,0.497732,0,
-	0.485071,-0.485071,-0.727607,3,0,0,
-	0.707107,0,-0.707107,3,0.497732,0,
-	1,0,0,3,0.205,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.56066,1.06066,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.751134,1.251134,0,
-	0,0,-1,3,1.201631,0,
-	-0.004007,-0.999988,0.002799,1.974903,0,0.679903,
-	-0.004007,-0.999988,0.002799,1.5,0,0,
-	-0.003005,-0.999993,0.002099,1.64319,0,0.205,
-	-0.633994,0.633994,0.442836,1.5,0,0,
-	-0.633994,0.633994,0.442836,1.974903,0,0.679903,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,1.974903,0,0.679903,
-	-0.633994,0.633994,0.442836,2.116861,0,0.883139,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,2.116861,0,0.883139,
-	-0.633994,0.633994,0.442836,2.54773,0,1.5,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,2.54773,0,1.5,
-	-0.633994,0.633994,0.442836,2.649417,0,1.645583,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,2.649417,0,1.645583,
-	-0.633994,0.633994,0.442836,2.795,0,1.854008,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,2.795,0,1.854008,
-	-0.633994,0.633994,0.442836,3,0,2.1475,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,3,0,2.1475,
-	-0.633994,0.633994,0.442836,3,0.205,1.854008,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,3,0.205,1.854008,
-	-0.633994,0.633994,0.442836,3,0.45227,1.5,
-	-0.633994,0.633994,0.442836,1.748866,0.248866,0,
-	-0.633994,0.633994,0.442836,3,0.45227,1.5,
-	-0.633994,0.633994,0.442836,1.93934,0.43934,0,
-	-0.633994,0.633994,0.442836,1.93934,0.43934,0,
-	-0.633994,0.633994,0.442836,3,0.45227,1.5,
-	-0.633994,0.633994,0.442836,2.100816,0.600816,0,
-	-0.633994,0.633994,0.442836,2.100816,0.600816,0,
-	-0.633994,0.633994,0.442836,3,0.45227,1.5,
-	-0.633994,0.633994,0.442836,3,0.883139,0.883139,
-	-0.633994,0.633994,0.442836,2.100816,0.600816,0,
-	-0.633994,0.633994,0.442836,3,0.883139,0.883139,
-	-0.633994,0.633994,0.442836,2.25,0.75,0,
-	-0.633994,0.633994,0.442836,2.25,0.75,0,
-	-0.633994,0.633994,0.442836,3,0.883139,0.883139,
-	-0.633994,0.633994,0.442836,2.399184,0.899184,0,
-	-0.633994,0.633994,0.442836,2.399184,0.899184,0,
-	-0.633994,0.633994,0.442836,3,0.883139,0.883139,
-	-0.633994,0.633994,0.442836,3,1.35681,0.205,
-	-0.633994,0.633994,0.442836,2.399184,0.899184,0,
-	-0.633994,0.633994,0.442836,3,1.35681,0.205,
-	-0.633994,0.633994,0.442836,2.56066,1.06066,0,
-	-0.633994,0.633994,0.442836,2.56066,1.06066,0,
-	-0.633994,0.633994,0.442836,3,1.35681,0.205,
-	-0.633994,0.633994,0.442836,2.751134,1.251134,0,
-	-0.633994,0.633994,0.442836,2.751134,1.251134,0,
-	-0.633994,0.633994,0.442836,3,1.35681,0.205,
-	-0.633994,0.633994,0.442836,3,1.5,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.45227,1.5,
-	1,0,0,3,0.205,1.854008,
-	1,0,0,3,0.205,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	0,-1,0,2.795,0,1.854008,
-	0,-1,0,2.649417,0,1.645583,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,0.205,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,0.883139,0.883139,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.35681,0.205,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0,2.1475,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,2.1475,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,1.854008,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0,
-	0,-1,0,3,0,2.1475,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.1475,
-	0,-1,0,2.795,0,1.854008,
-	0,-1,0,2.116861,0,0.883139,
-	-0.004007,-0.999988,0.002799,1.974903,0,0.679903,
-	0,-1,0,2.1475,0,0.8525
-};
-static const struct gllist lament_model_iso_dse_frame = { GL_N3F_V3F, GL_TRIANGLES, 204, lament_model_iso_dse_data, 0 };
-const struct gllist *lament_model_iso_dse = &lament_model_iso_dse_frame;
-
-static const float lament_model_iso_dwn_data[] = {
-	0,1,0,0,3,0.7275,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.7275,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0,3,0.7275,
-	0,1,0,0,3,0.8525,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.8525,3,0,
-	0,1,0,0.8525,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.6475,3,0.205,
-	0,1,0,0.42625,3,0.42625,
-	0,1,0,0.6475,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,0,-1,0.8525,3,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0,2.2725,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.2725,0,
-	0,0,-1,0.212668,2.360168,0,
-	0,0,-1,0,2.1475,0,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0,
-	0,1,0,0,3,0.205,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.57375,0.42625,
-	-1,0,0,0,2.795,0.6475,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.639832,2.787332,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.42625,2.57375,0,
-	0,0,-1,0.212668,2.360168,0,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,2.2725,0,
-	-1,0,0,0,2.1475,0,
-	-1,0,0,0,2.2725,0,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.3525,0.205,
-	-1,0,0,0,2.57375,0.42625,
-	0,1,0,0.205,3,0.6475,
-	0,1,0,0.42625,3,0.42625,
-	0,1,0,0.205,3,0.205,
-	-1,0,0,0,3,0.8525,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0.6475,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.8525,
-	-1,0,0,0,3,0.205,
-	-0.707107,0.707107,0,0,3,0.205,
-	-0.893371,0.265408,0.362555,0,3,0.8525,
-	0,1,0,0,3,0.7275,
-	0.57735,-0.57735,0.57735,0.212668,2.360168,0,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0,2.1475,0,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.212668,2.360168,0,
-	0.57735,-0.57735,0.57735,0.42625,2.57375,0,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.42625,2.57375,0,
-	0.57735,-0.57735,0.57735,0.639832,2.787332,0,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.639832,2.787332,0,
-	0.57735,-0.57735,0.57735,0.8525,3,0,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.8525,3,0,
-	0.57735,-0.57735,0.57735,0.6475,3,0.205,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.6475,3,0.205,
-	0.57735,-0.57735,0.57735,0.42625,3,0.42625,
-	0.57735,-0.57735,0.57735,0,2.3525,0.205,
-	0.57735,-0.57735,0.57735,0.42625,3,0.42625,
-	0.57735,-0.57735,0.57735,0,2.57375,0.42625,
-	0.57735,-0.57735,0.57735,0,2.57375,0.42625,
-	0.57735,-0.57735,0.57735,0.42625,3,0.42625,
-	0.57735,-0.57735,0.57735,0.205,3,0.6475,
-	0.57735,-0.57735,0.57735,0,2.57375,0.42625,
-	0.57735,-0.57735,0.57735,0.205,3,0.6475,
-	0.57735,-0.57735,0.57735,0,2.795,0.6475,
-	0.57735,-0.57735,0.57735,0,2.795,0.6475,
-	0.57735,-0.57735,0.57735,0.205,3,0.6475,
-	0.57735,-0.57735,0.57735,0,3,0.8525
-};
-static const struct gllist lament_model_iso_dwn_frame = { GL_N3F_V3F, GL_TRIANGLES, 120, lament_model_iso_dwn_data, 0 };
-const struct gllist *lament_model_iso_dwn = &lament_model_iso_dwn_frame;
-
-static const float lament_model_iso_swd_data[] = {
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.267766,0.332481,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.45227,1.5,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.580081,1.317017,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0.283213,1.742034,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.109972,0.55839,0,
-	0,0,-1,1.267766,0.332481,0,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,1.5,0.45227,
-	-1,0,0,0,0.883139,0.883139,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,1.35681,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,2.1475,0,
-	-1,0,0,0,1.854008,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0.45227,
-	-1,0,0,0,0.205,1.35681,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.35681,
-	-1,0,0,0,0.205,0.205,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.68738,1.163402,0,
-	0,0,-1,0.785662,1.022694,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.883139,0.883139,0,
-	0,0,-1,0.987753,0.733368,0,
-	0,-1,0,0.75,0,0.75,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0,0,1.5,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.295,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.205,0,1.295,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.75,0,0.75,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,0,-1,0.025731,2.110662,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,2.1475,0,
-	0.633994,0.442836,0.633994,0.205,0,1.295,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,0,0,1.5,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,0.205,0,1.295,
-	0.633994,0.442836,0.633994,0.75,0,0.75,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,0.75,0,0.75,
-	0.633994,0.442836,0.633994,1.295,0,0.205,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,1.295,0,0.205,
-	0.633994,0.442836,0.633994,1.5,0,0,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,1.5,0,0,
-	0.633994,0.442836,0.633994,1.267766,0.332481,0,
-	0.633994,0.442836,0.633994,0,0.205,1.35681,
-	0.633994,0.442836,0.633994,1.267766,0.332481,0,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,1.267766,0.332481,0,
-	0.633994,0.442836,0.633994,1.109972,0.55839,0,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,1.109972,0.55839,0,
-	0.633994,0.442836,0.633994,0.987753,0.733368,0,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,0.987753,0.733368,0,
-	0.633994,0.442836,0.633994,0.883139,0.883139,0,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,0.883139,0.883139,0,
-	0.633994,0.442836,0.633994,0.785662,1.022694,0,
-	0.633994,0.442836,0.633994,0,0.883139,0.883139,
-	0.633994,0.442836,0.633994,0.785662,1.022694,0,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0.785662,1.022694,0,
-	0.633994,0.442836,0.633994,0.68738,1.163402,0,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0.68738,1.163402,0,
-	0.633994,0.442836,0.633994,0.580081,1.317017,0,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0.580081,1.317017,0,
-	0.633994,0.442836,0.633994,0.45227,1.5,0,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0.45227,1.5,0,
-	0.633994,0.442836,0.633994,0.283213,1.742034,0,
-	0.633994,0.442836,0.633994,0,1.5,0.45227,
-	0.633994,0.442836,0.633994,0.283213,1.742034,0,
-	0.633994,0.442836,0.633994,0,1.854008,0.205,
-	0.633994,0.442836,0.633994,0,1.854008,0.205,
-	0.633994,0.442836,0.633994,0.283213,1.742034,0,
-	0.633994,0.442836,0.633994,0.025731,2.110662,0,
-	0.633994,0.442836,0.633994,0,1.854008,0.205,
-	0.633994,0.442836,0.633994,0.025731,2.110662,0,
-	0.633994,0.442836,0.633994,0,2.1475,0
-};
-static const struct gllist lament_model_iso_swd_frame = { GL_N3F_V3F, GL_TRIANGLES, 204, lament_model_iso_swd_data, 0 };
-const struct gllist *lament_model_iso_swd = &lament_model_iso_swd_frame;
-
-static const float lament_model_iso_une_data[] = {
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.54773,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.419919,1.682983,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.54773,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,3,1.5,3,
-	0,0,1,2.54773,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,2.716787,1.257966,3,
-	0,0,1,3,1.201631,3,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.705,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,3,
-	0,1,0,2.795,3,3,
-	-0.741864,0.651962,-0.156792,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,2.12132,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,2.502268,3,3,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,3,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.8525,3,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.25,3,2.25,
-	0,1,0,1.705,3,2.795,
-	0,1,0,2.795,3,1.705,
-	0,1,0,3,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,1.705,
-	0,1,0,2.795,3,2.795,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,2.54773,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,1.64319,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,2.795,
-	0,1,0,3,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.705,
-	0,1,0,2.25,3,2.25,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.116861,2.116861,
-	1,0,0,3,2.795,1.64319,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.31262,1.836598,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.732234,2.667519,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.890028,2.44161,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.012247,2.266632,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,3,3,3,
-	0,0,1,2.502268,3,3,
-	0.485071,0.485071,0.727607,3,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,3,3,3,
-	0,0,1,2.116861,2.116861,3,
-	0,0,1,3,3,3,
-	0,0,1,2.214338,1.977306,3,
-	0,0,1,3,2.502268,3,
-	0.485071,0.485071,0.727607,3,3,3,
-	0.5547,0,0.83205,3,2.502268,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.145992,2.795,
-	1,0,0,3,1.5,2.54773,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.732234,2.667519,3,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,2.795,2.795,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.974269,0.889338,3,
-	0,0,1,3,0.8525,3,
-	-0.633994,-0.442836,-0.633994,2.974269,0.889338,3,
-	-0.633994,-0.442836,-0.633994,3,1.145992,2.795,
-	-0.633994,-0.442836,-0.633994,3,0.8525,3,
-	-0.633994,-0.442836,-0.633994,3,1.145992,2.795,
-	-0.633994,-0.442836,-0.633994,2.974269,0.889338,3,
-	-0.633994,-0.442836,-0.633994,2.716787,1.257966,3,
-	-0.633994,-0.442836,-0.633994,3,1.145992,2.795,
-	-0.633994,-0.442836,-0.633994,2.716787,1.257966,3,
-	-0.633994,-0.442836,-0.633994,3,1.5,2.54773,
-	-0.633994,-0.442836,-0.633994,3,1.5,2.54773,
-	-0.633994,-0.442836,-0.633994,2.716787,1.257966,3,
-	-0.633994,-0.442836,-0.633994,2.54773,1.5,3,
-	-0.633994,-0.442836,-0.633994,3,1.5,2.54773,
-	-0.633994,-0.442836,-0.633994,2.54773,1.5,3,
-	-0.633994,-0.442836,-0.633994,2.419919,1.682983,3,
-	-0.633994,-0.442836,-0.633994,3,1.5,2.54773,
-	-0.633994,-0.442836,-0.633994,2.419919,1.682983,3,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,2.419919,1.682983,3,
-	-0.633994,-0.442836,-0.633994,2.31262,1.836598,3,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,2.31262,1.836598,3,
-	-0.633994,-0.442836,-0.633994,2.214338,1.977306,3,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,2.214338,1.977306,3,
-	-0.633994,-0.442836,-0.633994,2.116861,2.116861,3,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,2.116861,2.116861,3,
-	-0.633994,-0.442836,-0.633994,2.012247,2.266632,3,
-	-0.633994,-0.442836,-0.633994,3,2.116861,2.116861,
-	-0.633994,-0.442836,-0.633994,2.012247,2.266632,3,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	-0.633994,-0.442836,-0.633994,2.012247,2.266632,3,
-	-0.633994,-0.442836,-0.633994,1.890028,2.44161,3,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	-0.633994,-0.442836,-0.633994,1.890028,2.44161,3,
-	-0.633994,-0.442836,-0.633994,1.732234,2.667519,3,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	-0.633994,-0.442836,-0.633994,1.732234,2.667519,3,
-	-0.633994,-0.442836,-0.633994,1.5,3,3,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	-0.633994,-0.442836,-0.633994,1.5,3,3,
-	-0.633994,-0.442836,-0.633994,1.705,3,2.795,
-	-0.633994,-0.442836,-0.633994,1.705,3,2.795,
-	-0.633994,-0.442836,-0.633994,3,3,1.5,
-	-0.633994,-0.442836,-0.633994,3,2.795,1.64319,
-	0.85071,0.346986,-0.394833,3,3,1.5,
-	-0.600591,0.527809,-0.600591,1.705,3,2.795,
-	0,1,0,2.25,3,2.25,
-	0.85071,0.346986,-0.394833,3,3,1.5,
-	0,1,0,2.25,3,2.25,
-	0,1,0,2.795,3,1.705
-};
-static const struct gllist lament_model_iso_une_frame = { GL_N3F_V3F, GL_TRIANGLES, 204, lament_model_iso_une_data, 0 };
-const struct gllist *lament_model_iso_une = &lament_model_iso_une_frame;
-
-static const float lament_model_iso_unw_data[] = {
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.350583,3,1.354417,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0,3,0.8525,
-	0,1,0,0.205,3,1.145992,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.600816,2.100816,3,
-	0,0,1,0.75,2.25,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.899184,2.399184,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.43934,1.93934,3,
-	0,0,1,0.600816,2.100816,3,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,2.116861,2.116861,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.116861,2.116861,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,0.8525,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.35681,3,2.795,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.06066,2.56066,3,
-	0,0,1,1.251134,2.751134,3,
-	0,1,0,0.45227,3,1.5,
-	0,1,0,0.350583,3,1.354417,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.205,3,3,
-	0,1,0,1.35681,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.35681,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,3,
-	0.974602,-0.205981,0.087875,1.5,3,3,
-	0,0.83205,0.5547,0.205,3,3,
-	0,0,1,0.497732,3,3,
-	0.974602,-0.205981,0.087875,1.5,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0.974602,-0.205981,0.087875,1.5,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.248866,1.748866,3,
-	0,0,1,0.43934,1.93934,3,
-	-1,0,0,0,2.795,1.145992,
-	-1,0,0,0,2.54773,1.5,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,3,3,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.64319,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,3,
-	0,1,0,0.205,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.251134,2.751134,3,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0.883139,3,2.116861,
-	0,1,0,0.8525,3,2.1475,
-	0.633994,-0.633994,-0.442836,0,3,0.8525,
-	0.633994,-0.633994,-0.442836,1.35681,3,2.795,
-	0.633994,-0.633994,-0.442836,0,2.795,1.145992,
-	0,-1,0,1.35681,3,2.795,
-	0,-1,0,0,3,0.8525,
-	0,-1,0,1.025097,3,2.320097,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0,3,0.8525,
-	0,1,0,0.205,3,1.145992,
-	0,-1,0,1.025097,3,2.320097,
-	0,-1,0,0.205,3,1.145992,
-	0,-1,0,0.350583,3,1.354417,
-	0,1,0,1.025097,3,2.320097,
-	0,1,0,0.350583,3,1.354417,
-	0,1,0,0.45227,3,1.5,
-	0,-1,0,1.025097,3,2.320097,
-	0,-1,0,0.45227,3,1.5,
-	0,-1,0,0.883139,3,2.116861,
-	0.633994,-0.633994,-0.442836,0,1.64319,2.795,
-	0.633994,-0.633994,-0.442836,0.248866,1.748866,3,
-	0.633994,-0.633994,-0.442836,0,1.5,3,
-	0.633994,-0.633994,-0.442836,0.248866,1.748866,3,
-	0.633994,-0.633994,-0.442836,0,1.64319,2.795,
-	0.633994,-0.633994,-0.442836,0,2.116861,2.116861,
-	0.633994,-0.633994,-0.442836,0.248866,1.748866,3,
-	0.633994,-0.633994,-0.442836,0,2.116861,2.116861,
-	0.633994,-0.633994,-0.442836,0.43934,1.93934,3,
-	0.633994,-0.633994,-0.442836,0.43934,1.93934,3,
-	0.633994,-0.633994,-0.442836,0,2.116861,2.116861,
-	0.633994,-0.633994,-0.442836,0.600816,2.100816,3,
-	0.633994,-0.633994,-0.442836,0.600816,2.100816,3,
-	0.633994,-0.633994,-0.442836,0,2.116861,2.116861,
-	0.633994,-0.633994,-0.442836,0.75,2.25,3,
-	0.633994,-0.633994,-0.442836,0.75,2.25,3,
-	0.633994,-0.633994,-0.442836,0,2.116861,2.116861,
-	0.633994,-0.633994,-0.442836,0,2.54773,1.5,
-	0.633994,-0.633994,-0.442836,0.75,2.25,3,
-	0.633994,-0.633994,-0.442836,0,2.54773,1.5,
-	0.633994,-0.633994,-0.442836,0.899184,2.399184,3,
-	0.633994,-0.633994,-0.442836,0.899184,2.399184,3,
-	0.633994,-0.633994,-0.442836,0,2.54773,1.5,
-	0.633994,-0.633994,-0.442836,1.06066,2.56066,3,
-	0.633994,-0.633994,-0.442836,1.06066,2.56066,3,
-	0.633994,-0.633994,-0.442836,0,2.54773,1.5,
-	0.633994,-0.633994,-0.442836,0,2.795,1.145992,
-	0.633994,-0.633994,-0.442836,1.06066,2.56066,3,
-	0.633994,-0.633994,-0.442836,0,2.795,1.145992,
-	0.633994,-0.633994,-0.442836,1.251134,2.751134,3,
-	0.633994,-0.633994,-0.442836,1.251134,2.751134,3,
-	0.633994,-0.633994,-0.442836,0,2.795,1.145992,
-	0.633994,-0.633994,-0.442836,1.5,3,3,
-	0.633994,-0.633994,-0.442836,1.5,3,3,
-	0.633994,-0.633994,-0.442836,0,2.795,1.145992,
-	0.633994,-0.633994,-0.442836,1.35681,3,2.795
-};
-static const struct gllist lament_model_iso_unw_frame = { GL_N3F_V3F, GL_TRIANGLES, 204, lament_model_iso_unw_data, 0 };
-const struct gllist *lament_model_iso_unw = &lament_model_iso_unw_frame;
-
-static const float lament_model_iso_use_data[] = {
-	0,0,1,2.502268,0,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.795,0,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.795,0,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.8525,3,
-	0,0,1,2.787332,0.639832,3,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,3,0,2.1475,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.502268,0,3,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,2.502268,0,3,
-	0,-1,0,2.1475,0,3,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.57375,0,2.57375,
-	0,-1,0,2.795,0,2.3525,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,3,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,2.1475,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,2.1475,
-	1,0,0,3,0.205,2.3525,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,0.8525,3,
-	1,0,0,3,0.6475,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.42625,2.57375,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.1475,0,3,
-	1,0,0,3,0.42625,2.57375,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,2.3525,
-	0,0,1,3,0,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,1,2.787332,0.639832,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0.707107,0,0.707107,3,0.497732,3,
-	0.485071,-0.485071,0.727607,3,0,3,
-	1,0,0,3,0.205,3,
-	0,-1,0,2.3525,0,2.795,
-	0,-1,0,2.57375,0,2.57375,
-	0,-1,0,2.795,0,2.795,
-	-0.57735,0.57735,-0.57735,2.795,0,2.3525,
-	-0.57735,0.57735,-0.57735,3,0.205,2.3525,
-	-0.57735,0.57735,-0.57735,3,0,2.1475,
-	-0.57735,0.57735,-0.57735,3,0.205,2.3525,
-	-0.57735,0.57735,-0.57735,2.795,0,2.3525,
-	-0.57735,0.57735,-0.57735,2.57375,0,2.57375,
-	-0.57735,0.57735,-0.57735,3,0.205,2.3525,
-	-0.57735,0.57735,-0.57735,2.57375,0,2.57375,
-	-0.57735,0.57735,-0.57735,3,0.42625,2.57375,
-	-0.57735,0.57735,-0.57735,3,0.42625,2.57375,
-	-0.57735,0.57735,-0.57735,2.57375,0,2.57375,
-	-0.57735,0.57735,-0.57735,2.3525,0,2.795,
-	-0.57735,0.57735,-0.57735,3,0.42625,2.57375,
-	-0.57735,0.57735,-0.57735,2.3525,0,2.795,
-	-0.57735,0.57735,-0.57735,3,0.6475,2.795,
-	-0.57735,0.57735,-0.57735,3,0.6475,2.795,
-	-0.57735,0.57735,-0.57735,2.3525,0,2.795,
-	-0.57735,0.57735,-0.57735,2.1475,0,3,
-	-0.57735,0.57735,-0.57735,3,0.6475,2.795,
-	-0.57735,0.57735,-0.57735,2.1475,0,3,
-	-0.57735,0.57735,-0.57735,2.360168,0.212668,3,
-	-0.57735,0.57735,-0.57735,2.360168,0.212668,3,
-	-0.57735,0.57735,-0.57735,3,0.8525,3,
-	-0.57735,0.57735,-0.57735,3,0.6475,2.795,
-	0,0,1,3,0.8525,3,
-	0,0,1,2.360168,0.212668,3,
-	0,0,1,2.57375,0.42625,3,
-	0,0,-1,3,0.8525,3,
-	0,0,-1,2.57375,0.42625,3,
-	0,0,-1,2.787332,0.639832,3
-};
-static const struct gllist lament_model_iso_use_frame = { GL_N3F_V3F, GL_TRIANGLES, 108, lament_model_iso_use_data, 0 };
-const struct gllist *lament_model_iso_use = &lament_model_iso_use_frame;
-
-static const float lament_model_iso_usw_data[] = {
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.163402,0.68738,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,1.854008,0,2.795,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,3,
-	0,-1,0,0,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.679903,0,1.974903,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.64319,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.679903,0,1.974903,
-	0,-1,0,0.8525,0,2.1475,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,3,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,3,
-	-1,0,0,0,0.75,2.25,
-	-1,0,0,0,0.205,1.705,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.705,
-	-1,0,0,0,1.295,2.795,
-	-1,0,0,0,0.75,2.25,
-	-1,0,0,0,0.205,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.854008,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,3,
-	0,-1,0,2.12132,0,3,
-	0,-1,0,2.12132,0,3,
-	0,-1,0,1.5,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,0,1,1.5,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0,0,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.163402,0.68738,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.742034,0.283213,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.733368,0.987753,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,1,0.332481,1.267766,3,
-	0,-1,0,0.205,0,1.64319,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,1.64319,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.87868,0,3,
-	0,0,-1,0.205,0,3,
-	0,0,-1,0.87868,0,3,
-	0,0,-1,0.497732,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,1.645583,0,2.649417,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.883139,0,2.116861,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,2.54773,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.679903,0,1.974903,
-	0,-1,0,0.883139,0,2.116861,
-	0,0,1,2.1475,0,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,2.12132,0,3,
-	0.442836,0.633994,-0.633994,0,0.205,1.705,
-	0.442836,0.633994,-0.633994,0.205,0,1.64319,
-	0.442836,0.633994,-0.633994,0,0,1.5,
-	0.442836,0.633994,-0.633994,0.205,0,1.64319,
-	0.442836,0.633994,-0.633994,0,0.205,1.705,
-	0.442836,0.633994,-0.633994,0.679903,0,1.974903,
-	0.442836,0.633994,-0.633994,0.679903,0,1.974903,
-	0.442836,0.633994,-0.633994,0,0.205,1.705,
-	0.442836,0.633994,-0.633994,0,0.75,2.25,
-	0.442836,0.633994,-0.633994,0.679903,0,1.974903,
-	0.442836,0.633994,-0.633994,0,0.75,2.25,
-	0.442836,0.633994,-0.633994,0.883139,0,2.116861,
-	0.442836,0.633994,-0.633994,0.883139,0,2.116861,
-	0.442836,0.633994,-0.633994,0,0.75,2.25,
-	0.442836,0.633994,-0.633994,1.5,0,2.54773,
-	0.442836,0.633994,-0.633994,1.5,0,2.54773,
-	0.442836,0.633994,-0.633994,0,0.75,2.25,
-	0.442836,0.633994,-0.633994,0,1.295,2.795,
-	0.442836,0.633994,-0.633994,1.5,0,2.54773,
-	0.442836,0.633994,-0.633994,0,1.295,2.795,
-	0.442836,0.633994,-0.633994,1.645583,0,2.649417,
-	0.442836,0.633994,-0.633994,1.645583,0,2.649417,
-	0.442836,0.633994,-0.633994,0,1.295,2.795,
-	0.442836,0.633994,-0.633994,1.854008,0,2.795,
-	0.442836,0.633994,-0.633994,1.854008,0,2.795,
-	0.442836,0.633994,-0.633994,0,1.295,2.795,
-	0.442836,0.633994,-0.633994,0,1.5,3,
-	0.442836,0.633994,-0.633994,1.854008,0,2.795,
-	0.442836,0.633994,-0.633994,0,1.5,3,
-	0.442836,0.633994,-0.633994,2.110662,0.025731,3,
-	0.442836,0.633994,-0.633994,1.854008,0,2.795,
-	0.442836,0.633994,-0.633994,2.110662,0.025731,3,
-	0.442836,0.633994,-0.633994,2.1475,0,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,0.332481,1.267766,3,
-	0,0,1,0.55839,1.109972,3,
-	0,0,-1,2.110662,0.025731,3,
-	0,0,-1,0.55839,1.109972,3,
-	0,0,-1,0.733368,0.987753,3,
-	0,0,-1,2.110662,0.025731,3,
-	0,0,-1,0.733368,0.987753,3,
-	0,0,-1,0.883139,0.883139,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,0.883139,0.883139,3,
-	0,0,1,1.022694,0.785662,3,
-	0,0,-1,2.110662,0.025731,3,
-	0,0,-1,1.022694,0.785662,3,
-	0,0,-1,1.163402,0.68738,3,
-	0,0,-1,2.110662,0.025731,3,
-	0,0,-1,1.163402,0.68738,3,
-	0,0,-1,1.317017,0.580081,3,
-	0,0,1,2.110662,0.025731,3,
-	0,0,1,1.317017,0.580081,3,
-	0,0,1,1.5,0.45227,3,
-	0,0,-1,2.110662,0.025731,3,
-	0,0,-1,1.5,0.45227,3,
-	0,0,-1,1.742034,0.283213,3
-};
-static const struct gllist lament_model_iso_usw_frame = { GL_N3F_V3F, GL_TRIANGLES, 222, lament_model_iso_usw_data, 0 };
-const struct gllist *lament_model_iso_usw = &lament_model_iso_usw_frame;
-
-static const float lament_model_leviathan_data[] = {
-	0.81642,0.40914,-0.407508,2.250059,3.000719,2.250389,
-	0.869552,0.350012,-0.348384,6.835994,-3.832072,6.831978,
-	0.81642,0.40914,-0.407508,2.253099,0.752183,-0.001065,
-	0.81642,0.40914,-0.407508,2.250059,3.000719,2.250389,
-	0.81642,0.40914,-0.407508,2.253099,0.752183,-0.001065,
-	0.755275,0.464254,-0.462632,-3.832693,6.833336,-3.834015,
-	-0.348245,-0.869659,-0.349884,6.835994,-3.832072,6.831978,
-	-0.407383,-0.816545,-0.409015,0.001794,0.748994,2.24762,
-	-0.407383,-0.816545,-0.409015,2.253099,0.752183,-0.001065,
-	-0.349891,0.348284,0.86964,6.835994,-3.832072,6.831978,
-	-0.409037,0.407405,0.816523,2.250059,3.000719,2.250389,
-	-0.409037,0.407405,0.816523,0.001794,0.748994,2.24762,
-	-0.409037,0.407405,0.816523,0.001794,0.748994,2.24762,
-	-0.409037,0.407405,0.816523,2.250059,3.000719,2.250389,
-	-0.464168,0.462527,0.755392,-3.832693,6.833336,-3.834015,
-	-0.407383,-0.816545,-0.409015,0.001794,0.748994,2.24762,
-	-0.462522,-0.755417,-0.464132,-3.832693,6.833336,-3.834015,
-	-0.407383,-0.816545,-0.409015,2.253099,0.752183,-0.001065
-};
-static const struct gllist lament_model_leviathan_frame = { GL_N3F_V3F, GL_TRIANGLES, 18, lament_model_leviathan_data, 0 };
-const struct gllist *lament_model_leviathan = &lament_model_leviathan_frame;
-
-static const float lament_model_lid_a_data[] = {
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	1,0,0,1.5,0.0625,2.7325,
-	1,0,0,1.5,0,2.795,
-	1,0,0,1.5,0,1.5,
-	0,0,-1,1.5,0,1.5,
-	0,0,-1,0.205,0,1.5,
-	0,0,-1,0.2675,0.0625,1.5,
-	-0.57735,0.57735,0.57735,1.5,0,2.795,
-	-0.57735,0.57735,0.57735,0.2675,0.0625,1.5,
-	-0.57735,0.57735,0.57735,0.205,0,1.5,
-	-0.57735,0.57735,0.57735,0.2675,0.0625,1.5,
-	-0.57735,0.57735,0.57735,1.5,0,2.795,
-	-0.57735,0.57735,0.57735,1.5,0.0625,2.7325,
-	0.05058,0.997438,-0.05058,1.5,0.0625,2.7325,
-	0.05058,0.997438,-0.05058,1.5,0,1.5,
-	0.05058,0.997438,-0.05058,0.2675,0.0625,1.5
-};
-static const struct gllist lament_model_lid_a_frame = { GL_N3F_V3F, GL_TRIANGLES, 18, lament_model_lid_a_data, 0 };
-const struct gllist *lament_model_lid_a = &lament_model_lid_a_frame;
-
-static const float lament_model_lid_b_data[] = {
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,0,-1,2.795,0,1.5,
-	0,0,-1,1.5,0,1.5,
-	0,0,-1,2.7325,0.0625,1.5,
-	-1,0,0,1.5,0.0625,2.7325,
-	-1,0,0,1.5,0,1.5,
-	-1,0,0,1.5,0,2.795,
-	-0.05058,0.997438,-0.05058,1.5,0.0625,2.7325,
-	-0.05058,0.997438,-0.05058,2.7325,0.0625,1.5,
-	-0.05058,0.997438,-0.05058,1.5,0,1.5,
-	0.57735,0.57735,0.57735,2.7325,0.0625,1.5,
-	0.57735,0.57735,0.57735,1.5,0,2.795,
-	0.57735,0.57735,0.57735,2.795,0,1.5,
-	0.57735,0.57735,0.57735,1.5,0,2.795,
-	0.57735,0.57735,0.57735,2.7325,0.0625,1.5,
-	0.57735,0.57735,0.57735,1.5,0.0625,2.7325
-};
-static const struct gllist lament_model_lid_b_frame = { GL_N3F_V3F, GL_TRIANGLES, 18, lament_model_lid_b_data, 0 };
-const struct gllist *lament_model_lid_b = &lament_model_lid_b_frame;
-
-static const float lament_model_lid_base_data[] = {
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0.447214,0.894427,2.502268,3,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0,1,0,2.795,3,3,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0.205,
-	1,0,0,3,3,1.5,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,3,
-	0,-0.447214,0.894427,1.5,0,3,
-	0,-1,0,2.795,0,3,
-	0,0,1,2.502268,0,3,
-	0,-0.447214,0.894427,1.5,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.798369,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.077767,0.868083,0,
-	-0.57735,-0.57735,-0.57735,2.1475,0,2.1475,
-	-0.57735,-0.57735,-0.57735,2.545,0.25,1.5,
-	-0.57735,-0.57735,-0.57735,2.795,0,1.5,
-	-0.57735,-0.57735,-0.57735,2.545,0.25,1.5,
-	-0.57735,-0.57735,-0.57735,2.1475,0,2.1475,
-	-0.57735,-0.57735,-0.57735,2.0225,0.25,2.0225,
-	-0.57735,-0.57735,0.57735,2.1475,0,0.8525,
-	-0.57735,-0.57735,0.57735,1.5,0.25,0.455,
-	-0.57735,-0.57735,0.57735,1.5,0,0.205,
-	-0.57735,-0.57735,0.57735,1.5,0.25,0.455,
-	-0.57735,-0.57735,0.57735,2.1475,0,0.8525,
-	-0.57735,-0.57735,0.57735,2.0225,0.25,0.9775,
-	0.57735,-0.57735,-0.57735,0.9775,0.25,2.0225,
-	0.57735,-0.57735,-0.57735,1.5,0,2.795,
-	0.57735,-0.57735,-0.57735,0.8525,0,2.1475,
-	0.57735,-0.57735,-0.57735,1.5,0,2.795,
-	0.57735,-0.57735,-0.57735,0.9775,0.25,2.0225,
-	0.57735,-0.57735,-0.57735,1.5,0.25,2.545,
-	0.57735,-0.57735,0.57735,0.9775,0.25,0.9775,
-	0.57735,-0.57735,0.57735,0.205,0,1.5,
-	0.57735,-0.57735,0.57735,0.8525,0,0.8525,
-	0.57735,-0.57735,0.57735,0.205,0,1.5,
-	0.57735,-0.57735,0.57735,0.9775,0.25,0.9775,
-	0.57735,-0.57735,0.57735,0.455,0.25,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.87868,0,3,
-	0,0,-1,0.205,0,3,
-	0,0,-1,0.87868,0,3,
-	0,0,-1,0.497732,0,3,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,3,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,-0.447214,-0.894427,2.502268,0,0,
-	0.408248,-0.408248,-0.816497,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	0,0.447214,-0.894427,2.502268,3,0,
-	0,1,0,2.795,3,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0.447214,0,-0.894427,3,2.502268,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	1,0,0,3,2.795,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0.408248,-0.408248,-0.816497,3,0,0,
-	0.6,0,-0.8,3,0.497732,0,
-	1,0,0,3,0.205,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,3,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,3,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0.447214,0,0.894427,3,2.502268,3,
-	1,0,0,3,2.795,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.5,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0,3,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,3,0,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,3,0,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0.447214,0,0.894427,3,0.497732,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	1,0,0,3,0.205,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,3,0,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	0,0,1,2.502268,0,3,
-	0,-1,0,2.795,0,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.922233,3,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,3,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.201631,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,0.497732,3,3,
-	0,1,0,0.497732,3,3,
-	0,1,0,1.5,3,3,
-	0,1,0,1.5,3,2.795,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0.447214,0.894427,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.502268,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.502268,3,3,
-	0,1,0,2.795,3,3,
-	0,0.447214,0.894427,2.502268,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,0.447214,0.894427,2.502268,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,2.12132,3,3,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,1.5,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,0,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0.57735,-0.57735,0.57735,1.5,0.25,0.455,
-	0.57735,-0.57735,0.57735,0.8525,0,0.8525,
-	0.57735,-0.57735,0.57735,1.5,0,0.205,
-	0.57735,-0.57735,0.57735,0.8525,0,0.8525,
-	0.57735,-0.57735,0.57735,1.5,0.25,0.455,
-	0.57735,-0.57735,0.57735,0.9775,0.25,0.9775,
-	-0.57735,-0.57735,-0.57735,1.5,0.25,2.545,
-	-0.57735,-0.57735,-0.57735,2.1475,0,2.1475,
-	-0.57735,-0.57735,-0.57735,1.5,0,2.795,
-	-0.57735,-0.57735,-0.57735,2.1475,0,2.1475,
-	-0.57735,-0.57735,-0.57735,1.5,0.25,2.545,
-	-0.57735,-0.57735,-0.57735,2.0225,0.25,2.0225,
-	-0.57735,-0.57735,0.57735,2.795,0,1.5,
-	-0.57735,-0.57735,0.57735,2.0225,0.25,0.9775,
-	-0.57735,-0.57735,0.57735,2.1475,0,0.8525,
-	-0.57735,-0.57735,0.57735,2.0225,0.25,0.9775,
-	-0.57735,-0.57735,0.57735,2.795,0,1.5,
-	-0.57735,-0.57735,0.57735,2.545,0.25,1.5,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,3,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,3,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,3,
-	1,0,0,3,0,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0,0,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,3,3,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,0.205,
-	0.57735,-0.57735,-0.57735,0.455,0.25,1.5,
-	0.57735,-0.57735,-0.57735,0.8525,0,2.1475,
-	0.57735,-0.57735,-0.57735,0.205,0,1.5,
-	0.57735,-0.57735,-0.57735,0.8525,0,2.1475,
-	0.57735,-0.57735,-0.57735,0.455,0.25,1.5,
-	0.57735,-0.57735,-0.57735,0.9775,0.25,2.0225
-};
-static const struct gllist lament_model_lid_base_frame = { GL_N3F_V3F, GL_TRIANGLES, 1584, lament_model_lid_base_data, 0 };
-const struct gllist *lament_model_lid_base = &lament_model_lid_base_frame;
-
-static const float lament_model_lid_c_data[] = {
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,1.5,
-	-1,0,0,1.5,0.0625,0.2675,
-	-1,0,0,1.5,0,0.205,
-	-1,0,0,1.5,0,1.5,
-	0,0,1,2.795,0,1.5,
-	0,0,1,2.7325,0.0625,1.5,
-	0,0,1,1.5,0,1.5,
-	-0.05058,0.997438,0.05058,2.7325,0.0625,1.5,
-	-0.05058,0.997438,0.05058,1.5,0.0625,0.2675,
-	-0.05058,0.997438,0.05058,1.5,0,1.5,
-	0.57735,0.57735,-0.57735,1.5,0.0625,0.2675,
-	0.57735,0.57735,-0.57735,2.795,0,1.5,
-	0.57735,0.57735,-0.57735,1.5,0,0.205,
-	0.57735,0.57735,-0.57735,2.795,0,1.5,
-	0.57735,0.57735,-0.57735,1.5,0.0625,0.2675,
-	0.57735,0.57735,-0.57735,2.7325,0.0625,1.5
-};
-static const struct gllist lament_model_lid_c_frame = { GL_N3F_V3F, GL_TRIANGLES, 18, lament_model_lid_c_data, 0 };
-const struct gllist *lament_model_lid_c = &lament_model_lid_c_frame;
-
-static const float lament_model_lid_d_data[] = {
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,1.5,
-	0,0,1,1.5,0,1.5,
-	0,0,1,0.2675,0.0625,1.5,
-	0,0,1,0.205,0,1.5,
-	1,0,0,1.5,0.0625,0.2675,
-	1,0,0,1.5,0,1.5,
-	1,0,0,1.5,0,0.205,
-	0.05058,0.997438,0.05058,1.5,0,1.5,
-	0.05058,0.997438,0.05058,1.5,0.0625,0.2675,
-	0.05058,0.997438,0.05058,0.2675,0.0625,1.5,
-	-0.57735,0.57735,-0.57735,0.205,0,1.5,
-	-0.57735,0.57735,-0.57735,1.5,0.0625,0.2675,
-	-0.57735,0.57735,-0.57735,1.5,0,0.205,
-	-0.57735,0.57735,-0.57735,1.5,0.0625,0.2675,
-	-0.57735,0.57735,-0.57735,0.205,0,1.5,
-	-0.57735,0.57735,-0.57735,0.2675,0.0625,1.5
-};
-static const struct gllist lament_model_lid_d_frame = { GL_N3F_V3F, GL_TRIANGLES, 18, lament_model_lid_d_data, 0 };
-const struct gllist *lament_model_lid_d = &lament_model_lid_d_frame;
-
-static const float lament_model_pillar_a_data[] = {
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.74,3,
-	-0.840455,0.541882,0,0.868083,1.922233,3,
-	-0.874085,0.485774,0,0.82974,1.858262,1.5,
-	-0.889521,0.456893,0,0.82974,1.858262,3,
-	-0.874085,0.485774,0,0.82974,1.858262,1.5,
-	-0.840455,0.541882,0,0.868083,1.922233,3,
-	-0.822262,0.56911,0,0.868083,1.922233,1.5,
-	-0.889521,0.456893,0,0.82974,1.858262,3,
-	-0.91749,0.397759,0,0.797852,1.790839,1.5,
-	-0.930022,0.367505,0,0.797852,1.790839,3,
-	-0.91749,0.397759,0,0.797852,1.790839,1.5,
-	-0.889521,0.456893,0,0.82974,1.858262,3,
-	-0.874085,0.485774,0,0.82974,1.858262,1.5,
-	-0.983848,0.179005,0,0.754603,1.648269,3,
-	-0.993446,0.114299,0,0.74366,1.574493,1.5,
-	-0.996656,0.081709,0,0.74366,1.574493,3,
-	-0.993446,0.114299,0,0.74366,1.574493,1.5,
-	-0.983848,0.179005,0,0.754603,1.648269,3,
-	-0.97746,0.211123,0,0.754603,1.648269,1.5,
-	0.211123,0.97746,0,1.648269,2.245397,3,
-	0.274577,0.961565,0,1.720616,2.227275,1.5,
-	0.179005,0.983848,0,1.648269,2.245397,1.5,
-	0.274577,0.961565,0,1.720616,2.227275,1.5,
-	0.211123,0.97746,0,1.648269,2.245397,3,
-	0.305914,0.952059,0,1.720616,2.227275,3,
-	0.114299,0.993446,0,1.574493,2.25634,3,
-	0.179005,0.983848,0,1.648269,2.245397,1.5,
-	0.081709,0.996656,0,1.574493,2.25634,1.5,
-	0.179005,0.983848,0,1.648269,2.245397,1.5,
-	0.114299,0.993446,0,1.574493,2.25634,3,
-	0.211123,0.97746,0,1.648269,2.245397,3,
-	-0.707107,0.707107,0,0.962599,2.037401,3,
-	-0.646965,0.76252,0,1.017861,2.087488,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	-0.646965,0.76252,0,1.017861,2.087488,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,3,
-	-0.621651,0.783294,0,1.017861,2.087488,3,
-	-0.707107,0.707107,0,0.962599,2.037401,3,
-	-0.76252,0.646965,0,0.912512,1.982139,1.5,
-	-0.783294,0.621651,0,0.912512,1.982139,3,
-	-0.76252,0.646965,0,0.912512,1.982139,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,3,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	0.952059,0.305914,0,2.227275,1.720616,1.5,
-	0.930022,0.367505,0,2.202148,1.790839,3,
-	0.961565,0.274577,0,2.227275,1.720616,3,
-	0.930022,0.367505,0,2.202148,1.790839,3,
-	0.952059,0.305914,0,2.227275,1.720616,1.5,
-	0.91749,0.397759,0,2.202148,1.790839,1.5,
-	-0.211123,-0.97746,0,1.351731,0.754603,3,
-	-0.274577,-0.961565,0,1.279384,0.772725,1.5,
-	-0.179005,-0.983848,0,1.351731,0.754603,1.5,
-	-0.274577,-0.961565,0,1.279384,0.772725,1.5,
-	-0.211123,-0.97746,0,1.351731,0.754603,3,
-	-0.305914,-0.952059,0,1.279384,0.772725,3,
-	-0.016373,-0.999866,0,1.5,0.74,3,
-	-0.081709,-0.996656,0,1.425507,0.74366,1.5,
-	0.016373,-0.999866,0,1.5,0.74,1.5,
-	-0.081709,-0.996656,0,1.425507,0.74366,1.5,
-	-0.016373,-0.999866,0,1.5,0.74,3,
-	-0.114299,-0.993446,0,1.425507,0.74366,3,
-	0.081709,-0.996656,0,1.574493,0.74366,3,
-	0.016373,-0.999866,0,1.5,0.74,1.5,
-	0.114299,-0.993446,0,1.574493,0.74366,1.5,
-	0.016373,-0.999866,0,1.5,0.74,1.5,
-	0.081709,-0.996656,0,1.574493,0.74366,3,
-	-0.016373,-0.999866,0,1.5,0.74,3,
-	0.783294,-0.621651,0,2.087488,1.017861,1.5,
-	0.822262,-0.56911,0,2.131917,1.077767,3,
-	0.76252,-0.646965,0,2.087488,1.017861,3,
-	0.822262,-0.56911,0,2.131917,1.077767,3,
-	0.783294,-0.621651,0,2.087488,1.017861,1.5,
-	0.840455,-0.541882,0,2.131917,1.077767,1.5,
-	-0.305914,-0.952059,0,1.279384,0.772725,3,
-	-0.367505,-0.930022,0,1.209161,0.797852,1.5,
-	-0.274577,-0.961565,0,1.279384,0.772725,1.5,
-	-0.367505,-0.930022,0,1.209161,0.797852,1.5,
-	-0.305914,-0.952059,0,1.279384,0.772725,3,
-	-0.397759,-0.91749,0,1.209161,0.797852,3,
-	0.995185,0.098017,0,2.25634,1.574493,1.5,
-	0.999866,0.016373,0,2.26,1.5,3,
-	0.999866,-0.016373,0,2.26,1.5,1.5,
-	0.999866,0.016373,0,2.26,1.5,3,
-	0.995185,0.098017,0,2.25634,1.574493,1.5,
-	0.995185,0.098017,0,2.25634,1.574493,3,
-	-0.114299,-0.993446,0,1.425507,0.74366,3,
-	-0.179005,-0.983848,0,1.351731,0.754603,1.5,
-	-0.081709,-0.996656,0,1.425507,0.74366,1.5,
-	-0.179005,-0.983848,0,1.351731,0.754603,1.5,
-	-0.114299,-0.993446,0,1.425507,0.74366,3,
-	-0.211123,-0.97746,0,1.351731,0.754603,3,
-	0.456893,-0.889521,0,1.858262,0.82974,3,
-	0.397759,-0.91749,0,1.790839,0.797852,1.5,
-	0.485774,-0.874085,0,1.858262,0.82974,1.5,
-	0.397759,-0.91749,0,1.790839,0.797852,1.5,
-	0.456893,-0.889521,0,1.858262,0.82974,3,
-	0.367505,-0.930022,0,1.790839,0.797852,3,
-	-0.541882,0.840455,0,1.077767,2.131917,3,
-	-0.485774,0.874085,0,1.141738,2.17026,1.5,
-	-0.56911,0.822262,0,1.077767,2.131917,1.5,
-	-0.485774,0.874085,0,1.141738,2.17026,1.5,
-	-0.541882,0.840455,0,1.077767,2.131917,3,
-	-0.456893,0.889521,0,1.141738,2.17026,3,
-	-0.621651,0.783294,0,1.017861,2.087488,3,
-	-0.56911,0.822262,0,1.077767,2.131917,1.5,
-	-0.646965,0.76252,0,1.017861,2.087488,1.5,
-	-0.56911,0.822262,0,1.077767,2.131917,1.5,
-	-0.621651,0.783294,0,1.017861,2.087488,3,
-	-0.541882,0.840455,0,1.077767,2.131917,3,
-	0.485774,0.874085,0,1.858262,2.17026,3,
-	0.541882,0.840455,0,1.922233,2.131917,1.5,
-	0.456893,0.889521,0,1.858262,2.17026,1.5,
-	0.541882,0.840455,0,1.922233,2.131917,1.5,
-	0.485774,0.874085,0,1.858262,2.17026,3,
-	0.56911,0.822262,0,1.922233,2.131917,3,
-	0.71859,-0.695434,0,2.037401,0.962599,1.5,
-	0.76252,-0.646965,0,2.087488,1.017861,3,
-	0.695434,-0.71859,0,2.037401,0.962599,3,
-	0.76252,-0.646965,0,2.087488,1.017861,3,
-	0.71859,-0.695434,0,2.037401,0.962599,1.5,
-	0.783294,-0.621651,0,2.087488,1.017861,1.5,
-	0.97746,0.211123,0,2.245397,1.648269,1.5,
-	0.961565,0.274577,0,2.227275,1.720616,3,
-	0.983848,0.179005,0,2.245397,1.648269,3,
-	0.961565,0.274577,0,2.227275,1.720616,3,
-	0.97746,0.211123,0,2.245397,1.648269,1.5,
-	0.952059,0.305914,0,2.227275,1.720616,1.5,
-	0.993446,-0.114299,0,2.25634,1.425507,1.5,
-	0.983848,-0.179005,0,2.245397,1.351731,3,
-	0.97746,-0.211123,0,2.245397,1.351731,1.5,
-	0.983848,-0.179005,0,2.245397,1.351731,3,
-	0.993446,-0.114299,0,2.25634,1.425507,1.5,
-	0.996656,-0.081709,0,2.25634,1.425507,3,
-	-0.397759,-0.91749,0,1.209161,0.797852,3,
-	-0.456893,-0.889521,0,1.141738,0.82974,1.5,
-	-0.367505,-0.930022,0,1.209161,0.797852,1.5,
-	-0.456893,-0.889521,0,1.141738,0.82974,1.5,
-	-0.397759,-0.91749,0,1.209161,0.797852,3,
-	-0.485774,-0.874085,0,1.141738,0.82974,3,
-	-0.930022,0.367505,0,0.797852,1.790839,3,
-	-0.952059,0.305914,0,0.772725,1.720616,1.5,
-	-0.961565,0.274577,0,0.772725,1.720616,3,
-	-0.952059,0.305914,0,0.772725,1.720616,1.5,
-	-0.930022,0.367505,0,0.797852,1.790839,3,
-	-0.91749,0.397759,0,0.797852,1.790839,1.5,
-	0.016373,0.999866,0,1.5,2.26,3,
-	0.081709,0.996656,0,1.574493,2.25634,1.5,
-	-0.016373,0.999866,0,1.5,2.26,1.5,
-	0.081709,0.996656,0,1.574493,2.25634,1.5,
-	0.016373,0.999866,0,1.5,2.26,3,
-	0.114299,0.993446,0,1.574493,2.25634,3,
-	-0.081709,0.996656,0,1.425507,2.25634,3,
-	-0.016373,0.999866,0,1.5,2.26,1.5,
-	-0.114299,0.993446,0,1.425507,2.25634,1.5,
-	-0.016373,0.999866,0,1.5,2.26,1.5,
-	-0.081709,0.996656,0,1.425507,2.25634,3,
-	0.016373,0.999866,0,1.5,2.26,3,
-	-0.179005,0.983848,0,1.351731,2.245397,3,
-	-0.114299,0.993446,0,1.425507,2.25634,1.5,
-	-0.211123,0.97746,0,1.351731,2.245397,1.5,
-	-0.114299,0.993446,0,1.425507,2.25634,1.5,
-	-0.179005,0.983848,0,1.351731,2.245397,3,
-	-0.081709,0.996656,0,1.425507,2.25634,3,
-	-0.274577,0.961565,0,1.279384,2.227275,3,
-	-0.211123,0.97746,0,1.351731,2.245397,1.5,
-	-0.305914,0.952059,0,1.279384,2.227275,1.5,
-	-0.211123,0.97746,0,1.351731,2.245397,1.5,
-	-0.274577,0.961565,0,1.279384,2.227275,3,
-	-0.179005,0.983848,0,1.351731,2.245397,3,
-	-0.367505,0.930022,0,1.209161,2.202148,3,
-	-0.305914,0.952059,0,1.279384,2.227275,1.5,
-	-0.397759,0.91749,0,1.209161,2.202148,1.5,
-	-0.305914,0.952059,0,1.279384,2.227275,1.5,
-	-0.367505,0.930022,0,1.209161,2.202148,3,
-	-0.274577,0.961565,0,1.279384,2.227275,3,
-	0.874085,0.485774,0,2.17026,1.858262,1.5,
-	0.840455,0.541882,0,2.131917,1.922233,3,
-	0.889521,0.456893,0,2.17026,1.858262,3,
-	0.840455,0.541882,0,2.131917,1.922233,3,
-	0.874085,0.485774,0,2.17026,1.858262,1.5,
-	0.822262,0.56911,0,2.131917,1.922233,1.5,
-	-0.783294,0.621651,0,0.912512,1.982139,3,
-	-0.822262,0.56911,0,0.868083,1.922233,1.5,
-	-0.840455,0.541882,0,0.868083,1.922233,3,
-	-0.822262,0.56911,0,0.868083,1.922233,1.5,
-	-0.783294,0.621651,0,0.912512,1.982139,3,
-	-0.76252,0.646965,0,0.912512,1.982139,1.5,
-	0.541882,-0.840455,0,1.922233,0.868083,3,
-	0.485774,-0.874085,0,1.858262,0.82974,1.5,
-	0.56911,-0.822262,0,1.922233,0.868083,1.5,
-	0.485774,-0.874085,0,1.858262,0.82974,1.5,
-	0.541882,-0.840455,0,1.922233,0.868083,3,
-	0.456893,-0.889521,0,1.858262,0.82974,3,
-	0.621651,-0.783294,0,1.982139,0.912512,3,
-	0.56911,-0.822262,0,1.922233,0.868083,1.5,
-	0.646965,-0.76252,0,1.982139,0.912512,1.5,
-	0.56911,-0.822262,0,1.922233,0.868083,1.5,
-	0.621651,-0.783294,0,1.982139,0.912512,3,
-	0.541882,-0.840455,0,1.922233,0.868083,3,
-	0.695434,-0.71859,0,2.037401,0.962599,3,
-	0.646965,-0.76252,0,1.982139,0.912512,1.5,
-	0.71859,-0.695434,0,2.037401,0.962599,1.5,
-	0.646965,-0.76252,0,1.982139,0.912512,1.5,
-	0.695434,-0.71859,0,2.037401,0.962599,3,
-	0.621651,-0.783294,0,1.982139,0.912512,3,
-	-0.646965,-0.76252,0,1.017861,0.912512,3,
-	-0.695434,-0.71859,0,0.962599,0.962599,1.5,
-	-0.621651,-0.783294,0,1.017861,0.912512,1.5,
-	-0.695434,-0.71859,0,0.962599,0.962599,1.5,
-	-0.646965,-0.76252,0,1.017861,0.912512,3,
-	-0.71859,-0.695434,0,0.962599,0.962599,3,
-	0.397759,0.91749,0,1.790839,2.202148,3,
-	0.456893,0.889521,0,1.858262,2.17026,1.5,
-	0.367505,0.930022,0,1.790839,2.202148,1.5,
-	0.456893,0.889521,0,1.858262,2.17026,1.5,
-	0.397759,0.91749,0,1.790839,2.202148,3,
-	0.485774,0.874085,0,1.858262,2.17026,3,
-	0.822262,0.56911,0,2.131917,1.922233,1.5,
-	0.783294,0.621651,0,2.087488,1.982139,3,
-	0.840455,0.541882,0,2.131917,1.922233,3,
-	0.783294,0.621651,0,2.087488,1.982139,3,
-	0.822262,0.56911,0,2.131917,1.922233,1.5,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.995185,0.098017,0,2.25634,1.574493,1.5,
-	0.983848,0.179005,0,2.245397,1.648269,3,
-	0.995185,0.098017,0,2.25634,1.574493,3,
-	0.983848,0.179005,0,2.245397,1.648269,3,
-	0.995185,0.098017,0,2.25634,1.574493,1.5,
-	0.97746,0.211123,0,2.245397,1.648269,1.5,
-	0.56911,0.822262,0,1.922233,2.131917,3,
-	0.621651,0.783294,0,1.982139,2.087488,1.5,
-	0.541882,0.840455,0,1.922233,2.131917,1.5,
-	0.621651,0.783294,0,1.982139,2.087488,1.5,
-	0.56911,0.822262,0,1.922233,2.131917,3,
-	0.646965,0.76252,0,1.982139,2.087488,3,
-	0.646965,0.76252,0,1.982139,2.087488,3,
-	0.695434,0.71859,0,2.037401,2.037401,1.5,
-	0.621651,0.783294,0,1.982139,2.087488,1.5,
-	0.695434,0.71859,0,2.037401,2.037401,1.5,
-	0.646965,0.76252,0,1.982139,2.087488,3,
-	0.71859,0.695434,0,2.037401,2.037401,3,
-	0.305914,0.952059,0,1.720616,2.227275,3,
-	0.367505,0.930022,0,1.790839,2.202148,1.5,
-	0.274577,0.961565,0,1.720616,2.227275,1.5,
-	0.367505,0.930022,0,1.790839,2.202148,1.5,
-	0.305914,0.952059,0,1.720616,2.227275,3,
-	0.397759,0.91749,0,1.790839,2.202148,3,
-	0.91749,0.397759,0,2.202148,1.790839,1.5,
-	0.889521,0.456893,0,2.17026,1.858262,3,
-	0.930022,0.367505,0,2.202148,1.790839,3,
-	0.889521,0.456893,0,2.17026,1.858262,3,
-	0.91749,0.397759,0,2.202148,1.790839,1.5,
-	0.874085,0.485774,0,2.17026,1.858262,1.5,
-	-0.485774,-0.874085,0,1.141738,0.82974,3,
-	-0.541882,-0.840455,0,1.077767,0.868083,1.5,
-	-0.456893,-0.889521,0,1.141738,0.82974,1.5,
-	-0.541882,-0.840455,0,1.077767,0.868083,1.5,
-	-0.485774,-0.874085,0,1.141738,0.82974,3,
-	-0.56911,-0.822262,0,1.077767,0.868083,3,
-	0.367505,-0.930022,0,1.790839,0.797852,3,
-	0.305914,-0.952059,0,1.720616,0.772725,1.5,
-	0.397759,-0.91749,0,1.790839,0.797852,1.5,
-	0.305914,-0.952059,0,1.720616,0.772725,1.5,
-	0.367505,-0.930022,0,1.790839,0.797852,3,
-	0.274577,-0.961565,0,1.720616,0.772725,3,
-	-0.996656,0.081709,0,0.74366,1.574493,3,
-	-0.999866,0.016373,0,0.74,1.5,1.5,
-	-0.999866,-0.016373,0,0.74,1.5,3,
-	-0.999866,0.016373,0,0.74,1.5,1.5,
-	-0.996656,0.081709,0,0.74366,1.574493,3,
-	-0.993446,0.114299,0,0.74366,1.574493,1.5,
-	-0.961565,0.274577,0,0.772725,1.720616,3,
-	-0.97746,0.211123,0,0.754603,1.648269,1.5,
-	-0.983848,0.179005,0,0.754603,1.648269,3,
-	-0.97746,0.211123,0,0.754603,1.648269,1.5,
-	-0.961565,0.274577,0,0.772725,1.720616,3,
-	-0.952059,0.305914,0,0.772725,1.720616,1.5,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.71859,0.695434,0,2.037401,2.037401,3,
-	0.783294,0.621651,0,2.087488,1.982139,3,
-	0.71859,0.695434,0,2.037401,2.037401,3,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.695434,0.71859,0,2.037401,2.037401,1.5,
-	0.274577,-0.961565,0,1.720616,0.772725,3,
-	0.211123,-0.97746,0,1.648269,0.754603,1.5,
-	0.305914,-0.952059,0,1.720616,0.772725,1.5,
-	0.211123,-0.97746,0,1.648269,0.754603,1.5,
-	0.274577,-0.961565,0,1.720616,0.772725,3,
-	0.179005,-0.983848,0,1.648269,0.754603,3,
-	-0.71859,-0.695434,0,0.962599,0.962599,3,
-	-0.76252,-0.646965,0,0.912512,1.017861,1.5,
-	-0.695434,-0.71859,0,0.962599,0.962599,1.5,
-	-0.76252,-0.646965,0,0.912512,1.017861,1.5,
-	-0.71859,-0.695434,0,0.962599,0.962599,3,
-	-0.783294,-0.621651,0,0.912512,1.017861,3,
-	-0.91749,-0.397759,0,0.797852,1.209161,3,
-	-0.881921,-0.471397,0,0.82974,1.141738,1.5,
-	-0.881921,-0.471397,0,0.82974,1.141738,3,
-	-0.881921,-0.471397,0,0.82974,1.141738,1.5,
-	-0.91749,-0.397759,0,0.797852,1.209161,3,
-	-0.930022,-0.367505,0,0.797852,1.209161,1.5,
-	0.840455,-0.541882,0,2.131917,1.077767,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,3,
-	0.822262,-0.56911,0,2.131917,1.077767,3,
-	0.881921,-0.471397,0,2.17026,1.141738,3,
-	0.840455,-0.541882,0,2.131917,1.077767,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.91749,-0.397759,0,2.202148,1.209161,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,3,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,3,
-	0.91749,-0.397759,0,2.202148,1.209161,1.5,
-	0.930022,-0.367505,0,2.202148,1.209161,3,
-	-0.840455,-0.541882,0,0.868083,1.077767,3,
-	-0.881921,-0.471397,0,0.82974,1.141738,1.5,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.881921,-0.471397,0,0.82974,1.141738,1.5,
-	-0.840455,-0.541882,0,0.868083,1.077767,3,
-	-0.881921,-0.471397,0,0.82974,1.141738,3,
-	0.97746,-0.211123,0,2.245397,1.351731,1.5,
-	0.961565,-0.274577,0,2.227275,1.279384,3,
-	0.952059,-0.305914,0,2.227275,1.279384,1.5,
-	0.961565,-0.274577,0,2.227275,1.279384,3,
-	0.97746,-0.211123,0,2.245397,1.351731,1.5,
-	0.983848,-0.179005,0,2.245397,1.351731,3,
-	0.952059,-0.305914,0,2.227275,1.279384,1.5,
-	0.930022,-0.367505,0,2.202148,1.209161,3,
-	0.91749,-0.397759,0,2.202148,1.209161,1.5,
-	0.930022,-0.367505,0,2.202148,1.209161,3,
-	0.952059,-0.305914,0,2.227275,1.279384,1.5,
-	0.961565,-0.274577,0,2.227275,1.279384,3,
-	0.999866,-0.016373,0,2.26,1.5,1.5,
-	0.996656,-0.081709,0,2.25634,1.425507,3,
-	0.993446,-0.114299,0,2.25634,1.425507,1.5,
-	0.996656,-0.081709,0,2.25634,1.425507,3,
-	0.999866,-0.016373,0,2.26,1.5,1.5,
-	0.999866,0.016373,0,2.26,1.5,3,
-	0.179005,-0.983848,0,1.648269,0.754603,3,
-	0.114299,-0.993446,0,1.574493,0.74366,1.5,
-	0.211123,-0.97746,0,1.648269,0.754603,1.5,
-	0.114299,-0.993446,0,1.574493,0.74366,1.5,
-	0.179005,-0.983848,0,1.648269,0.754603,3,
-	0.081709,-0.996656,0,1.574493,0.74366,3,
-	-0.783294,-0.621651,0,0.912512,1.017861,3,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.76252,-0.646965,0,0.912512,1.017861,1.5,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.783294,-0.621651,0,0.912512,1.017861,3,
-	-0.840455,-0.541882,0,0.868083,1.077767,3,
-	-0.56911,-0.822262,0,1.077767,0.868083,3,
-	-0.621651,-0.783294,0,1.017861,0.912512,1.5,
-	-0.541882,-0.840455,0,1.077767,0.868083,1.5,
-	-0.621651,-0.783294,0,1.017861,0.912512,1.5,
-	-0.56911,-0.822262,0,1.077767,0.868083,3,
-	-0.646965,-0.76252,0,1.017861,0.912512,3,
-	-0.999866,-0.016373,0,0.74,1.5,3,
-	-0.996656,-0.081709,0,0.74366,1.425507,1.5,
-	-0.993446,-0.114299,0,0.74366,1.425507,3,
-	-0.996656,-0.081709,0,0.74366,1.425507,1.5,
-	-0.999866,-0.016373,0,0.74,1.5,3,
-	-0.999866,0.016373,0,0.74,1.5,1.5,
-	-0.993446,-0.114299,0,0.74366,1.425507,3,
-	-0.983848,-0.179005,0,0.754603,1.351731,1.5,
-	-0.97746,-0.211123,0,0.754603,1.351731,3,
-	-0.983848,-0.179005,0,0.754603,1.351731,1.5,
-	-0.993446,-0.114299,0,0.74366,1.425507,3,
-	-0.996656,-0.081709,0,0.74366,1.425507,1.5,
-	-0.97746,-0.211123,0,0.754603,1.351731,3,
-	-0.961565,-0.274577,0,0.772725,1.279384,1.5,
-	-0.952059,-0.305914,0,0.772725,1.279384,3,
-	-0.961565,-0.274577,0,0.772725,1.279384,1.5,
-	-0.97746,-0.211123,0,0.754603,1.351731,3,
-	-0.983848,-0.179005,0,0.754603,1.351731,1.5,
-	-0.952059,-0.305914,0,0.772725,1.279384,3,
-	-0.930022,-0.367505,0,0.797852,1.209161,1.5,
-	-0.91749,-0.397759,0,0.797852,1.209161,3,
-	-0.930022,-0.367505,0,0.797852,1.209161,1.5,
-	-0.952059,-0.305914,0,0.772725,1.279384,3,
-	-0.961565,-0.274577,0,0.772725,1.279384,1.5,
-	-0.456893,0.889521,0,1.141738,2.17026,3,
-	-0.397759,0.91749,0,1.209161,2.202148,1.5,
-	-0.485774,0.874085,0,1.141738,2.17026,1.5,
-	-0.397759,0.91749,0,1.209161,2.202148,1.5,
-	-0.456893,0.889521,0,1.141738,2.17026,3,
-	-0.367505,0.930022,0,1.209161,2.202148,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,-1,2.245397,1.351731,1.5,
-	0,0,-1,2.202148,1.209161,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.202148,1.209161,1.5,
-	0,0,-1,2.245397,1.351731,1.5,
-	0,0,-1,2.227275,1.279384,1.5,
-	0,0,-1,2.26,1.5,1.5,
-	0,0,-1,2.245397,1.351731,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.245397,1.351731,1.5,
-	0,0,-1,2.26,1.5,1.5,
-	0,0,-1,2.25634,1.425507,1.5,
-	0,0,-1,2.131917,1.077767,1.5,
-	0,0,-1,2.037401,0.962599,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.037401,0.962599,1.5,
-	0,0,-1,2.131917,1.077767,1.5,
-	0,0,-1,2.087488,1.017861,1.5,
-	0,0,-1,2.202148,1.209161,1.5,
-	0,0,-1,2.131917,1.077767,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.131917,1.077767,1.5,
-	0,0,-1,2.202148,1.209161,1.5,
-	0,0,-1,2.17026,1.141738,1.5,
-	0,0,-1,1.425507,2.25634,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.351731,2.245397,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.425507,2.25634,1.5,
-	0,0,-1,1.5,2.26,1.5,
-	0,0,-1,1.279384,2.227275,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.209161,2.202148,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.279384,2.227275,1.5,
-	0,0,-1,1.351731,2.245397,1.5,
-	0,0,-1,2.202148,1.790839,1.5,
-	0,0,-1,2.245397,1.648269,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.245397,1.648269,1.5,
-	0,0,-1,2.202148,1.790839,1.5,
-	0,0,-1,2.227275,1.720616,1.5,
-	0,0,-1,2.245397,1.648269,1.5,
-	0,0,-1,2.26,1.5,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.26,1.5,1.5,
-	0,0,-1,2.245397,1.648269,1.5,
-	0,0,-1,2.25634,1.574493,1.5,
-	0,0,-1,1.790839,0.797852,1.5,
-	0,0,-1,1.648269,0.754603,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.648269,0.754603,1.5,
-	0,0,-1,1.790839,0.797852,1.5,
-	0,0,-1,1.720616,0.772725,1.5,
-	0,0,-1,1.922233,0.868083,1.5,
-	0,0,-1,1.790839,0.797852,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.790839,0.797852,1.5,
-	0,0,-1,1.922233,0.868083,1.5,
-	0,0,-1,1.858262,0.82974,1.5,
-	0,0,-1,1.922233,2.131917,1.5,
-	0,0,-1,2.037401,2.037401,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.037401,2.037401,1.5,
-	0,0,-1,1.922233,2.131917,1.5,
-	0,0,-1,1.982139,2.087488,1.5,
-	0,0,-1,2.037401,2.037401,1.5,
-	0,0,-1,2.131917,1.922233,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.131917,1.922233,1.5,
-	0,0,-1,2.037401,2.037401,1.5,
-	0,0,-1,2.087488,1.982139,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.912512,1.017861,1.5,
-	0,0,-1,0.868083,1.077767,1.5,
-	0,0,-1,0.912512,1.017861,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.962599,0.962599,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.82974,1.141738,1.5,
-	0,0,-1,0.797852,1.209161,1.5,
-	0,0,-1,0.82974,1.141738,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.868083,1.077767,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.017861,0.912512,1.5,
-	0,0,-1,0.962599,0.962599,1.5,
-	0,0,-1,1.017861,0.912512,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.077767,0.868083,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.141738,0.82974,1.5,
-	0,0,-1,1.077767,0.868083,1.5,
-	0,0,-1,1.141738,0.82974,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.209161,0.797852,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.425507,0.74366,1.5,
-	0,0,-1,1.351731,0.754603,1.5,
-	0,0,-1,1.425507,0.74366,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.5,0.74,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.574493,0.74366,1.5,
-	0,0,-1,1.5,0.74,1.5,
-	0,0,-1,1.574493,0.74366,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.648269,0.754603,1.5,
-	0,0,-1,1.574493,2.25634,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.5,2.26,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.574493,2.25634,1.5,
-	0,0,-1,1.648269,2.245397,1.5,
-	0,0,-1,1.648269,2.245397,1.5,
-	0,0,-1,1.790839,2.202148,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.790839,2.202148,1.5,
-	0,0,-1,1.648269,2.245397,1.5,
-	0,0,-1,1.720616,2.227275,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.74366,1.425507,1.5,
-	0,0,-1,0.74,1.5,1.5,
-	0,0,-1,0.74366,1.425507,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.754603,1.351731,1.5,
-	0,0,-1,0.74366,1.574493,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.74,1.5,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.74366,1.574493,1.5,
-	0,0,-1,0.754603,1.648269,1.5,
-	0,0,-1,0.82974,1.858262,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.797852,1.790839,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.82974,1.858262,1.5,
-	0,0,-1,0.868083,1.922233,1.5,
-	0,0,-1,0.772725,1.720616,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.754603,1.648269,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.772725,1.720616,1.5,
-	0,0,-1,0.797852,1.790839,1.5,
-	0,0,-1,1.017861,2.087488,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.962599,2.037401,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.017861,2.087488,1.5,
-	0,0,-1,1.077767,2.131917,1.5,
-	0,0,-1,0.912512,1.982139,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.868083,1.922233,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.912512,1.982139,1.5,
-	0,0,-1,0.962599,2.037401,1.5,
-	0,0,-1,1.790839,2.202148,1.5,
-	0,0,-1,1.922233,2.131917,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.922233,2.131917,1.5,
-	0,0,-1,1.790839,2.202148,1.5,
-	0,0,-1,1.858262,2.17026,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.279384,0.772725,1.5,
-	0,0,-1,1.209161,0.797852,1.5,
-	0,0,-1,1.279384,0.772725,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.351731,0.754603,1.5,
-	0,0,-1,2.131917,1.922233,1.5,
-	0,0,-1,2.202148,1.790839,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.202148,1.790839,1.5,
-	0,0,-1,2.131917,1.922233,1.5,
-	0,0,-1,2.17026,1.858262,1.5,
-	0,0,-1,2.037401,0.962599,1.5,
-	0,0,-1,1.922233,0.868083,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.922233,0.868083,1.5,
-	0,0,-1,2.037401,0.962599,1.5,
-	0,0,-1,1.982139,0.912512,1.5,
-	0,0,-1,1.141738,2.17026,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.077767,2.131917,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.141738,2.17026,1.5,
-	0,0,-1,1.209161,2.202148,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.772725,1.279384,1.5,
-	0,0,-1,0.754603,1.351731,1.5,
-	0,0,-1,0.772725,1.279384,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.797852,1.209161,1.5
-};
-static const struct gllist lament_model_pillar_a_frame = { GL_N3F_V3F, GL_TRIANGLES, 768, lament_model_pillar_a_data, 0 };
-const struct gllist *lament_model_pillar_a = &lament_model_pillar_a_frame;
-
-static const float lament_model_pillar_b_data[] = {
-	0.97746,0.211123,0,2.245397,1.648269,0,
-	0.961565,0.274577,0,2.227275,1.720616,1.5,
-	0.983848,0.179005,0,2.245397,1.648269,1.5,
-	0.961565,0.274577,0,2.227275,1.720616,1.5,
-	0.97746,0.211123,0,2.245397,1.648269,0,
-	0.952059,0.305914,0,2.227275,1.720616,0,
-	-0.621651,0.783294,0,1.017861,2.087488,1.5,
-	-0.56911,0.822262,0,1.077767,2.131917,0,
-	-0.646965,0.76252,0,1.017861,2.087488,0,
-	-0.56911,0.822262,0,1.077767,2.131917,0,
-	-0.621651,0.783294,0,1.017861,2.087488,1.5,
-	-0.541882,0.840455,0,1.077767,2.131917,1.5,
-	0.485774,0.874085,0,1.858262,2.17026,1.5,
-	0.541882,0.840455,0,1.922233,2.131917,0,
-	0.456893,0.889521,0,1.858262,2.17026,0,
-	0.541882,0.840455,0,1.922233,2.131917,0,
-	0.485774,0.874085,0,1.858262,2.17026,1.5,
-	0.56911,0.822262,0,1.922233,2.131917,1.5,
-	0.456893,-0.889521,0,1.858262,0.82974,1.5,
-	0.397759,-0.91749,0,1.790839,0.797852,0,
-	0.485774,-0.874085,0,1.858262,0.82974,0,
-	0.397759,-0.91749,0,1.790839,0.797852,0,
-	0.456893,-0.889521,0,1.858262,0.82974,1.5,
-	0.367505,-0.930022,0,1.790839,0.797852,1.5,
-	-0.541882,0.840455,0,1.077767,2.131917,1.5,
-	-0.485774,0.874085,0,1.141738,2.17026,0,
-	-0.56911,0.822262,0,1.077767,2.131917,0,
-	-0.485774,0.874085,0,1.141738,2.17026,0,
-	-0.541882,0.840455,0,1.077767,2.131917,1.5,
-	-0.456893,0.889521,0,1.141738,2.17026,1.5,
-	-0.211123,-0.97746,0,1.351731,0.754603,1.5,
-	-0.274577,-0.961565,0,1.279384,0.772725,0,
-	-0.179005,-0.983848,0,1.351731,0.754603,0,
-	-0.274577,-0.961565,0,1.279384,0.772725,0,
-	-0.211123,-0.97746,0,1.351731,0.754603,1.5,
-	-0.305914,-0.952059,0,1.279384,0.772725,1.5,
-	-0.114299,-0.993446,0,1.425507,0.74366,1.5,
-	-0.179005,-0.983848,0,1.351731,0.754603,0,
-	-0.081709,-0.996656,0,1.425507,0.74366,0,
-	-0.179005,-0.983848,0,1.351731,0.754603,0,
-	-0.114299,-0.993446,0,1.425507,0.74366,1.5,
-	-0.211123,-0.97746,0,1.351731,0.754603,1.5,
-	-0.016373,-0.999866,0,1.5,0.74,1.5,
-	-0.081709,-0.996656,0,1.425507,0.74366,0,
-	0.016373,-0.999866,0,1.5,0.74,0,
-	-0.081709,-0.996656,0,1.425507,0.74366,0,
-	-0.016373,-0.999866,0,1.5,0.74,1.5,
-	-0.114299,-0.993446,0,1.425507,0.74366,1.5,
-	0.081709,-0.996656,0,1.574493,0.74366,1.5,
-	0.016373,-0.999866,0,1.5,0.74,0,
-	0.114299,-0.993446,0,1.574493,0.74366,0,
-	0.016373,-0.999866,0,1.5,0.74,0,
-	0.081709,-0.996656,0,1.574493,0.74366,1.5,
-	-0.016373,-0.999866,0,1.5,0.74,1.5,
-	0.783294,-0.621651,0,2.087488,1.017861,0,
-	0.822262,-0.56911,0,2.131917,1.077767,1.5,
-	0.76252,-0.646965,0,2.087488,1.017861,1.5,
-	0.822262,-0.56911,0,2.131917,1.077767,1.5,
-	0.783294,-0.621651,0,2.087488,1.017861,0,
-	0.840455,-0.541882,0,2.131917,1.077767,0,
-	-0.305914,-0.952059,0,1.279384,0.772725,1.5,
-	-0.367505,-0.930022,0,1.209161,0.797852,0,
-	-0.274577,-0.961565,0,1.279384,0.772725,0,
-	-0.367505,-0.930022,0,1.209161,0.797852,0,
-	-0.305914,-0.952059,0,1.279384,0.772725,1.5,
-	-0.397759,-0.91749,0,1.209161,0.797852,1.5,
-	1,0,0,2.26,1.5,0,
-	0.996656,0.081709,0,2.25634,1.574493,1.5,
-	1,0,0,2.26,1.5,1.5,
-	0.996656,0.081709,0,2.25634,1.574493,1.5,
-	1,0,0,2.26,1.5,0,
-	0.993446,0.114299,0,2.25634,1.574493,0,
-	-0.980785,0.19509,0,0.754603,1.648269,1.5,
-	-0.993446,0.114299,0,0.74366,1.574493,0,
-	-0.996656,0.081709,0,0.74366,1.574493,1.5,
-	-0.993446,0.114299,0,0.74366,1.574493,0,
-	-0.980785,0.19509,0,0.754603,1.648269,1.5,
-	-0.980785,0.19509,0,0.754603,1.648269,0,
-	0.211123,0.97746,0,1.648269,2.245397,1.5,
-	0.274577,0.961565,0,1.720616,2.227275,0,
-	0.179005,0.983848,0,1.648269,2.245397,0,
-	0.274577,0.961565,0,1.720616,2.227275,0,
-	0.211123,0.97746,0,1.648269,2.245397,1.5,
-	0.305914,0.952059,0,1.720616,2.227275,1.5,
-	0.114299,0.993446,0,1.574493,2.25634,1.5,
-	0.179005,0.983848,0,1.648269,2.245397,0,
-	0.081709,0.996656,0,1.574493,2.25634,0,
-	0.179005,0.983848,0,1.648269,2.245397,0,
-	0.114299,0.993446,0,1.574493,2.25634,1.5,
-	0.211123,0.97746,0,1.648269,2.245397,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	-0.646965,0.76252,0,1.017861,2.087488,0,
-	-0.707107,0.707107,0,0.962599,2.037401,0,
-	-0.646965,0.76252,0,1.017861,2.087488,0,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	-0.621651,0.783294,0,1.017861,2.087488,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	-0.76252,0.646965,0,0.912512,1.982139,0,
-	-0.783294,0.621651,0,0.912512,1.982139,1.5,
-	-0.76252,0.646965,0,0.912512,1.982139,0,
-	-0.707107,0.707107,0,0.962599,2.037401,1.5,
-	-0.707107,0.707107,0,0.962599,2.037401,0,
-	-0.881921,0.471397,0,0.82974,1.858262,1.5,
-	-0.83147,0.55557,0,0.868083,1.922233,0,
-	-0.881921,0.471397,0,0.82974,1.858262,0,
-	-0.83147,0.55557,0,0.868083,1.922233,0,
-	-0.881921,0.471397,0,0.82974,1.858262,1.5,
-	-0.83147,0.55557,0,0.868083,1.922233,1.5,
-	-0.881921,0.471397,0,0.82974,1.858262,1.5,
-	-0.91749,0.397759,0,0.797852,1.790839,0,
-	-0.930022,0.367505,0,0.797852,1.790839,1.5,
-	-0.91749,0.397759,0,0.797852,1.790839,0,
-	-0.881921,0.471397,0,0.82974,1.858262,1.5,
-	-0.881921,0.471397,0,0.82974,1.858262,0,
-	-0.930022,0.367505,0,0.797852,1.790839,1.5,
-	-0.95694,0.290285,0,0.772725,1.720616,0,
-	-0.95694,0.290285,0,0.772725,1.720616,1.5,
-	-0.95694,0.290285,0,0.772725,1.720616,0,
-	-0.930022,0.367505,0,0.797852,1.790839,1.5,
-	-0.91749,0.397759,0,0.797852,1.790839,0,
-	0.016373,0.999866,0,1.5,2.26,1.5,
-	0.081709,0.996656,0,1.574493,2.25634,0,
-	-0.016373,0.999866,0,1.5,2.26,0,
-	0.081709,0.996656,0,1.574493,2.25634,0,
-	0.016373,0.999866,0,1.5,2.26,1.5,
-	0.114299,0.993446,0,1.574493,2.25634,1.5,
-	-0.081709,0.996656,0,1.425507,2.25634,1.5,
-	-0.016373,0.999866,0,1.5,2.26,0,
-	-0.114299,0.993446,0,1.425507,2.25634,0,
-	-0.016373,0.999866,0,1.5,2.26,0,
-	-0.081709,0.996656,0,1.425507,2.25634,1.5,
-	0.016373,0.999866,0,1.5,2.26,1.5,
-	-0.179005,0.983848,0,1.351731,2.245397,1.5,
-	-0.114299,0.993446,0,1.425507,2.25634,0,
-	-0.211123,0.97746,0,1.351731,2.245397,0,
-	-0.114299,0.993446,0,1.425507,2.25634,0,
-	-0.179005,0.983848,0,1.351731,2.245397,1.5,
-	-0.081709,0.996656,0,1.425507,2.25634,1.5,
-	-0.274577,0.961565,0,1.279384,2.227275,1.5,
-	-0.211123,0.97746,0,1.351731,2.245397,0,
-	-0.305914,0.952059,0,1.279384,2.227275,0,
-	-0.211123,0.97746,0,1.351731,2.245397,0,
-	-0.274577,0.961565,0,1.279384,2.227275,1.5,
-	-0.179005,0.983848,0,1.351731,2.245397,1.5,
-	-0.367505,0.930022,0,1.209161,2.202148,1.5,
-	-0.305914,0.952059,0,1.279384,2.227275,0,
-	-0.397759,0.91749,0,1.209161,2.202148,0,
-	-0.305914,0.952059,0,1.279384,2.227275,0,
-	-0.367505,0.930022,0,1.209161,2.202148,1.5,
-	-0.274577,0.961565,0,1.279384,2.227275,1.5,
-	0.874085,0.485774,0,2.17026,1.858262,0,
-	0.83147,0.55557,0,2.131917,1.922233,1.5,
-	0.889521,0.456893,0,2.17026,1.858262,1.5,
-	0.83147,0.55557,0,2.131917,1.922233,1.5,
-	0.874085,0.485774,0,2.17026,1.858262,0,
-	0.83147,0.55557,0,2.131917,1.922233,0,
-	-0.783294,0.621651,0,0.912512,1.982139,1.5,
-	-0.83147,0.55557,0,0.868083,1.922233,0,
-	-0.83147,0.55557,0,0.868083,1.922233,1.5,
-	-0.83147,0.55557,0,0.868083,1.922233,0,
-	-0.783294,0.621651,0,0.912512,1.982139,1.5,
-	-0.76252,0.646965,0,0.912512,1.982139,0,
-	0.541882,-0.840455,0,1.922233,0.868083,1.5,
-	0.485774,-0.874085,0,1.858262,0.82974,0,
-	0.56911,-0.822262,0,1.922233,0.868083,0,
-	0.485774,-0.874085,0,1.858262,0.82974,0,
-	0.541882,-0.840455,0,1.922233,0.868083,1.5,
-	0.456893,-0.889521,0,1.858262,0.82974,1.5,
-	0.621651,-0.783294,0,1.982139,0.912512,1.5,
-	0.56911,-0.822262,0,1.922233,0.868083,0,
-	0.646965,-0.76252,0,1.982139,0.912512,0,
-	0.56911,-0.822262,0,1.922233,0.868083,0,
-	0.621651,-0.783294,0,1.982139,0.912512,1.5,
-	0.541882,-0.840455,0,1.922233,0.868083,1.5,
-	0.695434,-0.71859,0,2.037401,0.962599,1.5,
-	0.646965,-0.76252,0,1.982139,0.912512,0,
-	0.71859,-0.695434,0,2.037401,0.962599,0,
-	0.646965,-0.76252,0,1.982139,0.912512,0,
-	0.695434,-0.71859,0,2.037401,0.962599,1.5,
-	0.621651,-0.783294,0,1.982139,0.912512,1.5,
-	-0.646965,-0.76252,0,1.017861,0.912512,1.5,
-	-0.695434,-0.71859,0,0.962599,0.962599,0,
-	-0.621651,-0.783294,0,1.017861,0.912512,0,
-	-0.695434,-0.71859,0,0.962599,0.962599,0,
-	-0.646965,-0.76252,0,1.017861,0.912512,1.5,
-	-0.71859,-0.695434,0,0.962599,0.962599,1.5,
-	0.397759,0.91749,0,1.790839,2.202148,1.5,
-	0.456893,0.889521,0,1.858262,2.17026,0,
-	0.367505,0.930022,0,1.790839,2.202148,0,
-	0.456893,0.889521,0,1.858262,2.17026,0,
-	0.397759,0.91749,0,1.790839,2.202148,1.5,
-	0.485774,0.874085,0,1.858262,2.17026,1.5,
-	0.783294,0.621651,0,2.087488,1.982139,0,
-	0.83147,0.55557,0,2.131917,1.922233,1.5,
-	0.83147,0.55557,0,2.131917,1.922233,0,
-	0.83147,0.55557,0,2.131917,1.922233,1.5,
-	0.783294,0.621651,0,2.087488,1.982139,0,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.993446,0.114299,0,2.25634,1.574493,0,
-	0.983848,0.179005,0,2.245397,1.648269,1.5,
-	0.996656,0.081709,0,2.25634,1.574493,1.5,
-	0.983848,0.179005,0,2.245397,1.648269,1.5,
-	0.993446,0.114299,0,2.25634,1.574493,0,
-	0.97746,0.211123,0,2.245397,1.648269,0,
-	0.56911,0.822262,0,1.922233,2.131917,1.5,
-	0.621651,0.783294,0,1.982139,2.087488,0,
-	0.541882,0.840455,0,1.922233,2.131917,0,
-	0.621651,0.783294,0,1.982139,2.087488,0,
-	0.56911,0.822262,0,1.922233,2.131917,1.5,
-	0.646965,0.76252,0,1.982139,2.087488,1.5,
-	0.646965,0.76252,0,1.982139,2.087488,1.5,
-	0.707107,0.707107,0,2.037401,2.037401,0,
-	0.621651,0.783294,0,1.982139,2.087488,0,
-	0.707107,0.707107,0,2.037401,2.037401,0,
-	0.646965,0.76252,0,1.982139,2.087488,1.5,
-	0.707107,0.707107,0,2.037401,2.037401,1.5,
-	0.305914,0.952059,0,1.720616,2.227275,1.5,
-	0.367505,0.930022,0,1.790839,2.202148,0,
-	0.274577,0.961565,0,1.720616,2.227275,0,
-	0.367505,0.930022,0,1.790839,2.202148,0,
-	0.305914,0.952059,0,1.720616,2.227275,1.5,
-	0.397759,0.91749,0,1.790839,2.202148,1.5,
-	0.91749,0.397759,0,2.202148,1.790839,0,
-	0.889521,0.456893,0,2.17026,1.858262,1.5,
-	0.930022,0.367505,0,2.202148,1.790839,1.5,
-	0.889521,0.456893,0,2.17026,1.858262,1.5,
-	0.91749,0.397759,0,2.202148,1.790839,0,
-	0.874085,0.485774,0,2.17026,1.858262,0,
-	-0.485774,-0.874085,0,1.141738,0.82974,1.5,
-	-0.541882,-0.840455,0,1.077767,0.868083,0,
-	-0.456893,-0.889521,0,1.141738,0.82974,0,
-	-0.541882,-0.840455,0,1.077767,0.868083,0,
-	-0.485774,-0.874085,0,1.141738,0.82974,1.5,
-	-0.56911,-0.822262,0,1.077767,0.868083,1.5,
-	0.367505,-0.930022,0,1.790839,0.797852,1.5,
-	0.305914,-0.952059,0,1.720616,0.772725,0,
-	0.397759,-0.91749,0,1.790839,0.797852,0,
-	0.305914,-0.952059,0,1.720616,0.772725,0,
-	0.367505,-0.930022,0,1.790839,0.797852,1.5,
-	0.274577,-0.961565,0,1.720616,0.772725,1.5,
-	-0.996656,0.081709,0,0.74366,1.574493,1.5,
-	-0.999866,0.016373,0,0.74,1.5,0,
-	-0.999866,-0.016373,0,0.74,1.5,1.5,
-	-0.999866,0.016373,0,0.74,1.5,0,
-	-0.996656,0.081709,0,0.74366,1.574493,1.5,
-	-0.993446,0.114299,0,0.74366,1.574493,0,
-	-0.980785,0.19509,0,0.754603,1.648269,1.5,
-	-0.95694,0.290285,0,0.772725,1.720616,0,
-	-0.980785,0.19509,0,0.754603,1.648269,0,
-	-0.95694,0.290285,0,0.772725,1.720616,0,
-	-0.980785,0.19509,0,0.754603,1.648269,1.5,
-	-0.95694,0.290285,0,0.772725,1.720616,1.5,
-	0.707107,0.707107,0,2.037401,2.037401,0,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.783294,0.621651,0,2.087488,1.982139,0,
-	0.76252,0.646965,0,2.087488,1.982139,1.5,
-	0.707107,0.707107,0,2.037401,2.037401,0,
-	0.707107,0.707107,0,2.037401,2.037401,1.5,
-	0.274577,-0.961565,0,1.720616,0.772725,1.5,
-	0.211123,-0.97746,0,1.648269,0.754603,0,
-	0.305914,-0.952059,0,1.720616,0.772725,0,
-	0.211123,-0.97746,0,1.648269,0.754603,0,
-	0.274577,-0.961565,0,1.720616,0.772725,1.5,
-	0.179005,-0.983848,0,1.648269,0.754603,1.5,
-	-0.71859,-0.695434,0,0.962599,0.962599,1.5,
-	-0.77301,-0.634393,0,0.912512,1.017861,0,
-	-0.695434,-0.71859,0,0.962599,0.962599,0,
-	-0.77301,-0.634393,0,0.912512,1.017861,0,
-	-0.71859,-0.695434,0,0.962599,0.962599,1.5,
-	-0.77301,-0.634393,0,0.912512,1.017861,1.5,
-	-0.91749,-0.397759,0,0.797852,1.209161,1.5,
-	-0.889521,-0.456893,0,0.82974,1.141738,0,
-	-0.874085,-0.485774,0,0.82974,1.141738,1.5,
-	-0.889521,-0.456893,0,0.82974,1.141738,0,
-	-0.91749,-0.397759,0,0.797852,1.209161,1.5,
-	-0.930022,-0.367505,0,0.797852,1.209161,0,
-	0.840455,-0.541882,0,2.131917,1.077767,0,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.822262,-0.56911,0,2.131917,1.077767,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.840455,-0.541882,0,2.131917,1.077767,0,
-	0.881921,-0.471397,0,2.17026,1.141738,0,
-	0.91749,-0.397759,0,2.202148,1.209161,0,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.881921,-0.471397,0,2.17026,1.141738,0,
-	0.881921,-0.471397,0,2.17026,1.141738,1.5,
-	0.91749,-0.397759,0,2.202148,1.209161,0,
-	0.930022,-0.367505,0,2.202148,1.209161,1.5,
-	-0.874085,-0.485774,0,0.82974,1.141738,1.5,
-	-0.840455,-0.541882,0,0.868083,1.077767,0,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.840455,-0.541882,0,0.868083,1.077767,0,
-	-0.874085,-0.485774,0,0.82974,1.141738,1.5,
-	-0.889521,-0.456893,0,0.82974,1.141738,0,
-	0.95694,-0.290285,0,2.227275,1.279384,0,
-	0.980785,-0.19509,0,2.245397,1.351731,1.5,
-	0.95694,-0.290285,0,2.227275,1.279384,1.5,
-	0.980785,-0.19509,0,2.245397,1.351731,1.5,
-	0.95694,-0.290285,0,2.227275,1.279384,0,
-	0.980785,-0.19509,0,2.245397,1.351731,0,
-	0.95694,-0.290285,0,2.227275,1.279384,0,
-	0.930022,-0.367505,0,2.202148,1.209161,1.5,
-	0.91749,-0.397759,0,2.202148,1.209161,0,
-	0.930022,-0.367505,0,2.202148,1.209161,1.5,
-	0.95694,-0.290285,0,2.227275,1.279384,0,
-	0.95694,-0.290285,0,2.227275,1.279384,1.5,
-	1,0,0,2.26,1.5,0,
-	0.996656,-0.081709,0,2.25634,1.425507,1.5,
-	0.993446,-0.114299,0,2.25634,1.425507,0,
-	0.996656,-0.081709,0,2.25634,1.425507,1.5,
-	1,0,0,2.26,1.5,0,
-	1,0,0,2.26,1.5,1.5,
-	0.179005,-0.983848,0,1.648269,0.754603,1.5,
-	0.114299,-0.993446,0,1.574493,0.74366,0,
-	0.211123,-0.97746,0,1.648269,0.754603,0,
-	0.114299,-0.993446,0,1.574493,0.74366,0,
-	0.179005,-0.983848,0,1.648269,0.754603,1.5,
-	0.081709,-0.996656,0,1.574493,0.74366,1.5,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.77301,-0.634393,0,0.912512,1.017861,0,
-	-0.77301,-0.634393,0,0.912512,1.017861,1.5,
-	-0.77301,-0.634393,0,0.912512,1.017861,0,
-	-0.822262,-0.56911,0,0.868083,1.077767,1.5,
-	-0.840455,-0.541882,0,0.868083,1.077767,0,
-	-0.56911,-0.822262,0,1.077767,0.868083,1.5,
-	-0.621651,-0.783294,0,1.017861,0.912512,0,
-	-0.541882,-0.840455,0,1.077767,0.868083,0,
-	-0.621651,-0.783294,0,1.017861,0.912512,0,
-	-0.56911,-0.822262,0,1.077767,0.868083,1.5,
-	-0.646965,-0.76252,0,1.017861,0.912512,1.5,
-	-0.999866,-0.016373,0,0.74,1.5,1.5,
-	-0.996656,-0.081709,0,0.74366,1.425507,0,
-	-0.993446,-0.114299,0,0.74366,1.425507,1.5,
-	-0.996656,-0.081709,0,0.74366,1.425507,0,
-	-0.999866,-0.016373,0,0.74,1.5,1.5,
-	-0.999866,0.016373,0,0.74,1.5,0,
-	-0.993446,-0.114299,0,0.74366,1.425507,1.5,
-	-0.983848,-0.179005,0,0.754603,1.351731,0,
-	-0.97746,-0.211123,0,0.754603,1.351731,1.5,
-	-0.983848,-0.179005,0,0.754603,1.351731,0,
-	-0.993446,-0.114299,0,0.74366,1.425507,1.5,
-	-0.996656,-0.081709,0,0.74366,1.425507,0,
-	-0.97746,-0.211123,0,0.754603,1.351731,1.5,
-	-0.961565,-0.274577,0,0.772725,1.279384,0,
-	-0.952059,-0.305914,0,0.772725,1.279384,1.5,
-	-0.961565,-0.274577,0,0.772725,1.279384,0,
-	-0.97746,-0.211123,0,0.754603,1.351731,1.5,
-	-0.983848,-0.179005,0,0.754603,1.351731,0,
-	-0.952059,-0.305914,0,0.772725,1.279384,1.5,
-	-0.930022,-0.367505,0,0.797852,1.209161,0,
-	-0.91749,-0.397759,0,0.797852,1.209161,1.5,
-	-0.930022,-0.367505,0,0.797852,1.209161,0,
-	-0.952059,-0.305914,0,0.772725,1.279384,1.5,
-	-0.961565,-0.274577,0,0.772725,1.279384,0,
-	-0.456893,0.889521,0,1.141738,2.17026,1.5,
-	-0.397759,0.91749,0,1.209161,2.202148,0,
-	-0.485774,0.874085,0,1.141738,2.17026,0,
-	-0.397759,0.91749,0,1.209161,2.202148,0,
-	-0.456893,0.889521,0,1.141738,2.17026,1.5,
-	-0.367505,0.930022,0,1.209161,2.202148,1.5,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0.993446,-0.114299,0,2.25634,1.425507,0,
-	0.980785,-0.19509,0,2.245397,1.351731,1.5,
-	0.980785,-0.19509,0,2.245397,1.351731,0,
-	0.980785,-0.19509,0,2.245397,1.351731,1.5,
-	0.993446,-0.114299,0,2.25634,1.425507,0,
-	0.996656,-0.081709,0,2.25634,1.425507,1.5,
-	0.71859,-0.695434,0,2.037401,0.962599,0,
-	0.76252,-0.646965,0,2.087488,1.017861,1.5,
-	0.695434,-0.71859,0,2.037401,0.962599,1.5,
-	0.76252,-0.646965,0,2.087488,1.017861,1.5,
-	0.71859,-0.695434,0,2.037401,0.962599,0,
-	0.783294,-0.621651,0,2.087488,1.017861,0,
-	0.952059,0.305914,0,2.227275,1.720616,0,
-	0.930022,0.367505,0,2.202148,1.790839,1.5,
-	0.961565,0.274577,0,2.227275,1.720616,1.5,
-	0.930022,0.367505,0,2.202148,1.790839,1.5,
-	0.952059,0.305914,0,2.227275,1.720616,0,
-	0.91749,0.397759,0,2.202148,1.790839,0,
-	-0.397759,-0.91749,0,1.209161,0.797852,1.5,
-	-0.456893,-0.889521,0,1.141738,0.82974,0,
-	-0.367505,-0.930022,0,1.209161,0.797852,0,
-	-0.456893,-0.889521,0,1.141738,0.82974,0,
-	-0.397759,-0.91749,0,1.209161,0.797852,1.5,
-	-0.485774,-0.874085,0,1.141738,0.82974,1.5,
-	0,0,1,2.245397,1.648269,1.5,
-	0,0,1,2.202148,1.790839,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.202148,1.790839,1.5,
-	0,0,1,2.245397,1.648269,1.5,
-	0,0,1,2.227275,1.720616,1.5,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,1,2.202148,1.790839,1.5,
-	0,0,1,2.131917,1.922233,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.131917,1.922233,1.5,
-	0,0,1,2.202148,1.790839,1.5,
-	0,0,1,2.17026,1.858262,1.5,
-	0,0,1,1.922233,2.131917,1.5,
-	0,0,1,1.790839,2.202148,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.790839,2.202148,1.5,
-	0,0,1,1.922233,2.131917,1.5,
-	0,0,1,1.858262,2.17026,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.912512,1.982139,1.5,
-	0,0,1,0.868083,1.922233,1.5,
-	0,0,1,0.912512,1.982139,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.962599,2.037401,1.5,
-	0,0,1,1.790839,2.202148,1.5,
-	0,0,1,1.648269,2.245397,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.648269,2.245397,1.5,
-	0,0,1,1.790839,2.202148,1.5,
-	0,0,1,1.720616,2.227275,1.5,
-	0,0,1,2.131917,1.922233,1.5,
-	0,0,1,2.037401,2.037401,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.037401,2.037401,1.5,
-	0,0,1,2.131917,1.922233,1.5,
-	0,0,1,2.087488,1.982139,1.5,
-	0,0,1,1.648269,2.245397,1.5,
-	0,0,1,1.5,2.26,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.5,2.26,1.5,
-	0,0,1,1.648269,2.245397,1.5,
-	0,0,1,1.574493,2.25634,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.017861,2.087488,1.5,
-	0,0,1,0.962599,2.037401,1.5,
-	0,0,1,1.017861,2.087488,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.077767,2.131917,1.5,
-	0,0,1,1.017861,0.912512,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.962599,0.962599,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.017861,0.912512,1.5,
-	0,0,1,1.077767,0.868083,1.5,
-	0,0,1,0.82974,1.141738,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.797852,1.209161,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.82974,1.141738,1.5,
-	0,0,1,0.868083,1.077767,1.5,
-	0,0,1,1.922233,0.868083,1.5,
-	0,0,1,2.037401,0.962599,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.037401,0.962599,1.5,
-	0,0,1,1.922233,0.868083,1.5,
-	0,0,1,1.982139,0.912512,1.5,
-	0,0,1,0.912512,1.017861,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.868083,1.077767,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.912512,1.017861,1.5,
-	0,0,1,0.962599,0.962599,1.5,
-	0,0,1,1.279384,0.772725,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.209161,0.797852,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.279384,0.772725,1.5,
-	0,0,1,1.351731,0.754603,1.5,
-	0,0,1,1.790839,0.797852,1.5,
-	0,0,1,1.922233,0.868083,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.922233,0.868083,1.5,
-	0,0,1,1.790839,0.797852,1.5,
-	0,0,1,1.858262,0.82974,1.5,
-	0,0,1,2.131917,1.077767,1.5,
-	0,0,1,2.202148,1.209161,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.202148,1.209161,1.5,
-	0,0,1,2.131917,1.077767,1.5,
-	0,0,1,2.17026,1.141738,1.5,
-	0,0,1,1.141738,0.82974,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.077767,0.868083,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.141738,0.82974,1.5,
-	0,0,1,1.209161,0.797852,1.5,
-	0,0,1,1.648269,0.754603,1.5,
-	0,0,1,1.790839,0.797852,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.790839,0.797852,1.5,
-	0,0,1,1.648269,0.754603,1.5,
-	0,0,1,1.720616,0.772725,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.772725,1.720616,1.5,
-	0,0,1,0.754603,1.648269,1.5,
-	0,0,1,0.772725,1.720616,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.797852,1.790839,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.141738,2.17026,1.5,
-	0,0,1,1.077767,2.131917,1.5,
-	0,0,1,1.141738,2.17026,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.209161,2.202148,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.74366,1.574493,1.5,
-	0,0,1,0.74,1.5,1.5,
-	0,0,1,0.74366,1.574493,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.754603,1.648269,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.82974,1.858262,1.5,
-	0,0,1,0.797852,1.790839,1.5,
-	0,0,1,0.82974,1.858262,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.868083,1.922233,1.5,
-	0,0,1,0.74366,1.425507,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.74,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.74366,1.425507,1.5,
-	0,0,1,0.754603,1.351731,1.5,
-	0,0,1,0.772725,1.279384,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.754603,1.351731,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.772725,1.279384,1.5,
-	0,0,1,0.797852,1.209161,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.425507,2.25634,1.5,
-	0,0,1,1.351731,2.245397,1.5,
-	0,0,1,1.425507,2.25634,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.5,2.26,1.5,
-	0,0,1,2.037401,2.037401,1.5,
-	0,0,1,1.922233,2.131917,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.922233,2.131917,1.5,
-	0,0,1,2.037401,2.037401,1.5,
-	0,0,1,1.982139,2.087488,1.5,
-	0,0,1,2.037401,0.962599,1.5,
-	0,0,1,2.131917,1.077767,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.131917,1.077767,1.5,
-	0,0,1,2.037401,0.962599,1.5,
-	0,0,1,2.087488,1.017861,1.5,
-	0,0,1,2.26,1.5,1.5,
-	0,0,1,2.245397,1.648269,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.245397,1.648269,1.5,
-	0,0,1,2.26,1.5,1.5,
-	0,0,1,2.25634,1.574493,1.5,
-	0,0,1,1.425507,0.74366,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.351731,0.754603,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.425507,0.74366,1.5,
-	0,0,1,1.5,0.74,1.5,
-	0,0,1,1.5,0.74,1.5,
-	0,0,1,1.648269,0.754603,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.648269,0.754603,1.5,
-	0,0,1,1.5,0.74,1.5,
-	0,0,1,1.574493,0.74366,1.5,
-	0,0,1,2.202148,1.209161,1.5,
-	0,0,1,2.245397,1.351731,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.245397,1.351731,1.5,
-	0,0,1,2.202148,1.209161,1.5,
-	0,0,1,2.227275,1.279384,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.279384,2.227275,1.5,
-	0,0,1,1.209161,2.202148,1.5,
-	0,0,1,1.279384,2.227275,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.351731,2.245397,1.5,
-	0,0,1,2.245397,1.351731,1.5,
-	0,0,1,2.26,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.26,1.5,1.5,
-	0,0,1,2.245397,1.351731,1.5,
-	0,0,1,2.25634,1.425507,1.5
-};
-static const struct gllist lament_model_pillar_b_frame = { GL_N3F_V3F, GL_TRIANGLES, 768, lament_model_pillar_b_data, 0 };
-const struct gllist *lament_model_pillar_b = &lament_model_pillar_b_frame;
-
-static const float lament_model_pillar_base_data[] = {
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.74366,1.574493,3,
-	0,0,1,0.754603,1.648269,3,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,3,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0,
-	0,-1,0,3,0,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.201631,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0.621651,0.783294,0,1.017861,0.912512,3,
-	0.56911,0.822262,0,1.077767,0.868083,0,
-	0.646965,0.76252,0,1.017861,0.912512,0,
-	0.56911,0.822262,0,1.077767,0.868083,0,
-	0.621651,0.783294,0,1.017861,0.912512,3,
-	0.541882,0.840455,0,1.077767,0.868083,3,
-	-0.456893,-0.889521,0,1.858262,2.17026,3,
-	-0.397759,-0.91749,0,1.790839,2.202148,0,
-	-0.485774,-0.874085,0,1.858262,2.17026,0,
-	-0.397759,-0.91749,0,1.790839,2.202148,0,
-	-0.456893,-0.889521,0,1.858262,2.17026,3,
-	-0.367505,-0.930022,0,1.790839,2.202148,3,
-	0.993446,0.114299,0,0.74366,1.425507,0,
-	0.983848,0.179005,0,0.754603,1.351731,3,
-	0.97746,0.211123,0,0.754603,1.351731,0,
-	0.983848,0.179005,0,0.754603,1.351731,3,
-	0.993446,0.114299,0,0.74366,1.425507,0,
-	0.996656,0.081709,0,0.74366,1.425507,3,
-	0.97746,0.211123,0,0.754603,1.351731,0,
-	0.961565,0.274577,0,0.772725,1.279384,3,
-	0.952059,0.305914,0,0.772725,1.279384,0,
-	0.961565,0.274577,0,0.772725,1.279384,3,
-	0.97746,0.211123,0,0.754603,1.351731,0,
-	0.983848,0.179005,0,0.754603,1.351731,3,
-	0.952059,0.305914,0,0.772725,1.279384,0,
-	0.930022,0.367505,0,0.797852,1.209161,3,
-	0.91749,0.397759,0,0.797852,1.209161,0,
-	0.930022,0.367505,0,0.797852,1.209161,3,
-	0.952059,0.305914,0,0.772725,1.279384,0,
-	0.961565,0.274577,0,0.772725,1.279384,3,
-	0.91749,0.397759,0,0.797852,1.209161,0,
-	0.889521,0.456893,0,0.82974,1.141738,3,
-	0.874085,0.485774,0,0.82974,1.141738,0,
-	0.889521,0.456893,0,0.82974,1.141738,3,
-	0.91749,0.397759,0,0.797852,1.209161,0,
-	0.930022,0.367505,0,0.797852,1.209161,3,
-	-0.874085,0.485774,0,2.17026,1.141738,3,
-	-0.840455,0.541882,0,2.131917,1.077767,0,
-	-0.822262,0.56911,0,2.131917,1.077767,3,
-	-0.840455,0.541882,0,2.131917,1.077767,0,
-	-0.874085,0.485774,0,2.17026,1.141738,3,
-	-0.889521,0.456893,0,2.17026,1.141738,0,
-	-0.91749,0.397759,0,2.202148,1.209161,3,
-	-0.889521,0.456893,0,2.17026,1.141738,0,
-	-0.874085,0.485774,0,2.17026,1.141738,3,
-	-0.889521,0.456893,0,2.17026,1.141738,0,
-	-0.91749,0.397759,0,2.202148,1.209161,3,
-	-0.930022,0.367505,0,2.202148,1.209161,0,
-	0.874085,0.485774,0,0.82974,1.141738,0,
-	0.840455,0.541882,0,0.868083,1.077767,3,
-	0.822262,0.56911,0,0.868083,1.077767,0,
-	0.840455,0.541882,0,0.868083,1.077767,3,
-	0.874085,0.485774,0,0.82974,1.141738,0,
-	0.889521,0.456893,0,0.82974,1.141738,3,
-	0.999866,0.016373,0,0.74,1.5,0,
-	0.996656,0.081709,0,0.74366,1.425507,3,
-	0.993446,0.114299,0,0.74366,1.425507,0,
-	0.996656,0.081709,0,0.74366,1.425507,3,
-	0.999866,0.016373,0,0.74,1.5,0,
-	0.999866,-0.016373,0,0.74,1.5,3,
-	0.456893,0.889521,0,1.141738,0.82974,3,
-	0.397759,0.91749,0,1.209161,0.797852,0,
-	0.485774,0.874085,0,1.141738,0.82974,0,
-	0.397759,0.91749,0,1.209161,0.797852,0,
-	0.456893,0.889521,0,1.141738,0.82974,3,
-	0.367505,0.930022,0,1.209161,0.797852,3,
-	0.996656,-0.081709,0,0.74366,1.574493,0,
-	0.999866,-0.016373,0,0.74,1.5,3,
-	0.999866,0.016373,0,0.74,1.5,0,
-	0.999866,-0.016373,0,0.74,1.5,3,
-	0.996656,-0.081709,0,0.74366,1.574493,0,
-	0.993446,-0.114299,0,0.74366,1.574493,3,
-	0.983848,-0.179005,0,0.754603,1.648269,0,
-	0.993446,-0.114299,0,0.74366,1.574493,3,
-	0.996656,-0.081709,0,0.74366,1.574493,0,
-	0.993446,-0.114299,0,0.74366,1.574493,3,
-	0.983848,-0.179005,0,0.754603,1.648269,0,
-	0.97746,-0.211123,0,0.754603,1.648269,3,
-	0.961565,-0.274577,0,0.772725,1.720616,0,
-	0.97746,-0.211123,0,0.754603,1.648269,3,
-	0.983848,-0.179005,0,0.754603,1.648269,0,
-	0.97746,-0.211123,0,0.754603,1.648269,3,
-	0.961565,-0.274577,0,0.772725,1.720616,0,
-	0.952059,-0.305914,0,0.772725,1.720616,3,
-	0.930022,-0.367505,0,0.797852,1.790839,0,
-	0.952059,-0.305914,0,0.772725,1.720616,3,
-	0.961565,-0.274577,0,0.772725,1.720616,0,
-	0.952059,-0.305914,0,0.772725,1.720616,3,
-	0.930022,-0.367505,0,0.797852,1.790839,0,
-	0.91749,-0.397759,0,0.797852,1.790839,3,
-	0.889521,-0.456893,0,0.82974,1.858262,0,
-	0.91749,-0.397759,0,0.797852,1.790839,3,
-	0.930022,-0.367505,0,0.797852,1.790839,0,
-	0.91749,-0.397759,0,0.797852,1.790839,3,
-	0.889521,-0.456893,0,0.82974,1.858262,0,
-	0.874085,-0.485774,0,0.82974,1.858262,3,
-	0.840455,-0.541882,0,0.868083,1.922233,0,
-	0.874085,-0.485774,0,0.82974,1.858262,3,
-	0.889521,-0.456893,0,0.82974,1.858262,0,
-	0.874085,-0.485774,0,0.82974,1.858262,3,
-	0.840455,-0.541882,0,0.868083,1.922233,0,
-	0.822262,-0.56911,0,0.868083,1.922233,3,
-	0.783294,-0.621651,0,0.912512,1.982139,0,
-	0.822262,-0.56911,0,0.868083,1.922233,3,
-	0.840455,-0.541882,0,0.868083,1.922233,0,
-	0.822262,-0.56911,0,0.868083,1.922233,3,
-	0.783294,-0.621651,0,0.912512,1.982139,0,
-	0.76252,-0.646965,0,0.912512,1.982139,3,
-	0.707107,-0.707107,0,0.962599,2.037401,0,
-	0.76252,-0.646965,0,0.912512,1.982139,3,
-	0.783294,-0.621651,0,0.912512,1.982139,0,
-	0.76252,-0.646965,0,0.912512,1.982139,3,
-	0.707107,-0.707107,0,0.962599,2.037401,0,
-	0.707107,-0.707107,0,0.962599,2.037401,3,
-	0.016373,-0.999866,0,1.5,2.26,3,
-	0.081709,-0.996656,0,1.425507,2.25634,0,
-	-0.016373,-0.999866,0,1.5,2.26,0,
-	0.081709,-0.996656,0,1.425507,2.25634,0,
-	0.016373,-0.999866,0,1.5,2.26,3,
-	0.114299,-0.993446,0,1.425507,2.25634,3,
-	0.114299,-0.993446,0,1.425507,2.25634,3,
-	0.179005,-0.983848,0,1.351731,2.245397,0,
-	0.081709,-0.996656,0,1.425507,2.25634,0,
-	0.179005,-0.983848,0,1.351731,2.245397,0,
-	0.114299,-0.993446,0,1.425507,2.25634,3,
-	0.211123,-0.97746,0,1.351731,2.245397,3,
-	0.211123,-0.97746,0,1.351731,2.245397,3,
-	0.274577,-0.961565,0,1.279384,2.227275,0,
-	0.179005,-0.983848,0,1.351731,2.245397,0,
-	0.274577,-0.961565,0,1.279384,2.227275,0,
-	0.211123,-0.97746,0,1.351731,2.245397,3,
-	0.305914,-0.952059,0,1.279384,2.227275,3,
-	0.305914,-0.952059,0,1.279384,2.227275,3,
-	0.367505,-0.930022,0,1.209161,2.202148,0,
-	0.274577,-0.961565,0,1.279384,2.227275,0,
-	0.367505,-0.930022,0,1.209161,2.202148,0,
-	0.305914,-0.952059,0,1.279384,2.227275,3,
-	0.397759,-0.91749,0,1.209161,2.202148,3,
-	0.76252,0.646965,0,0.912512,1.017861,0,
-	0.707107,0.707107,0,0.962599,0.962599,3,
-	0.707107,0.707107,0,0.962599,0.962599,0,
-	0.707107,0.707107,0,0.962599,0.962599,3,
-	0.76252,0.646965,0,0.912512,1.017861,0,
-	0.783294,0.621651,0,0.912512,1.017861,3,
-	0.397759,-0.91749,0,1.209161,2.202148,3,
-	0.456893,-0.889521,0,1.141738,2.17026,0,
-	0.367505,-0.930022,0,1.209161,2.202148,0,
-	0.456893,-0.889521,0,1.141738,2.17026,0,
-	0.397759,-0.91749,0,1.209161,2.202148,3,
-	0.485774,-0.874085,0,1.141738,2.17026,3,
-	0.485774,-0.874085,0,1.141738,2.17026,3,
-	0.541882,-0.840455,0,1.077767,2.131917,0,
-	0.456893,-0.889521,0,1.141738,2.17026,0,
-	0.541882,-0.840455,0,1.077767,2.131917,0,
-	0.485774,-0.874085,0,1.141738,2.17026,3,
-	0.56911,-0.822262,0,1.077767,2.131917,3,
-	0.56911,-0.822262,0,1.077767,2.131917,3,
-	0.621651,-0.783294,0,1.017861,2.087488,0,
-	0.541882,-0.840455,0,1.077767,2.131917,0,
-	0.621651,-0.783294,0,1.017861,2.087488,0,
-	0.56911,-0.822262,0,1.077767,2.131917,3,
-	0.646965,-0.76252,0,1.017861,2.087488,3,
-	0.646965,-0.76252,0,1.017861,2.087488,3,
-	0.707107,-0.707107,0,0.962599,2.037401,0,
-	0.621651,-0.783294,0,1.017861,2.087488,0,
-	0.707107,-0.707107,0,0.962599,2.037401,0,
-	0.646965,-0.76252,0,1.017861,2.087488,3,
-	0.707107,-0.707107,0,0.962599,2.037401,3,
-	-0.367505,-0.930022,0,1.790839,2.202148,3,
-	-0.305914,-0.952059,0,1.720616,2.227275,0,
-	-0.397759,-0.91749,0,1.790839,2.202148,0,
-	-0.305914,-0.952059,0,1.720616,2.227275,0,
-	-0.367505,-0.930022,0,1.790839,2.202148,3,
-	-0.274577,-0.961565,0,1.720616,2.227275,3,
-	-0.274577,-0.961565,0,1.720616,2.227275,3,
-	-0.211123,-0.97746,0,1.648269,2.245397,0,
-	-0.305914,-0.952059,0,1.720616,2.227275,0,
-	-0.211123,-0.97746,0,1.648269,2.245397,0,
-	-0.274577,-0.961565,0,1.720616,2.227275,3,
-	-0.179005,-0.983848,0,1.648269,2.245397,3,
-	-0.179005,-0.983848,0,1.648269,2.245397,3,
-	-0.114299,-0.993446,0,1.574493,2.25634,0,
-	-0.211123,-0.97746,0,1.648269,2.245397,0,
-	-0.114299,-0.993446,0,1.574493,2.25634,0,
-	-0.179005,-0.983848,0,1.648269,2.245397,3,
-	-0.081709,-0.996656,0,1.574493,2.25634,3,
-	-0.081709,-0.996656,0,1.574493,2.25634,3,
-	-0.016373,-0.999866,0,1.5,2.26,0,
-	-0.114299,-0.993446,0,1.574493,2.25634,0,
-	-0.016373,-0.999866,0,1.5,2.26,0,
-	-0.081709,-0.996656,0,1.574493,2.25634,3,
-	0.016373,-0.999866,0,1.5,2.26,3,
-	-0.621651,-0.783294,0,1.982139,2.087488,3,
-	-0.56911,-0.822262,0,1.922233,2.131917,0,
-	-0.646965,-0.76252,0,1.982139,2.087488,0,
-	-0.56911,-0.822262,0,1.922233,2.131917,0,
-	-0.621651,-0.783294,0,1.982139,2.087488,3,
-	-0.541882,-0.840455,0,1.922233,2.131917,3,
-	-0.541882,-0.840455,0,1.922233,2.131917,3,
-	-0.485774,-0.874085,0,1.858262,2.17026,0,
-	-0.56911,-0.822262,0,1.922233,2.131917,0,
-	-0.485774,-0.874085,0,1.858262,2.17026,0,
-	-0.541882,-0.840455,0,1.922233,2.131917,3,
-	-0.456893,-0.889521,0,1.858262,2.17026,3,
-	-0.707107,-0.707107,0,2.037401,2.037401,3,
-	-0.646965,-0.76252,0,1.982139,2.087488,0,
-	-0.707107,-0.707107,0,2.037401,2.037401,0,
-	-0.646965,-0.76252,0,1.982139,2.087488,0,
-	-0.707107,-0.707107,0,2.037401,2.037401,3,
-	-0.621651,-0.783294,0,1.982139,2.087488,3,
-	-0.707107,-0.707107,0,2.037401,2.037401,3,
-	-0.76252,-0.646965,0,2.087488,1.982139,0,
-	-0.783294,-0.621651,0,2.087488,1.982139,3,
-	-0.76252,-0.646965,0,2.087488,1.982139,0,
-	-0.707107,-0.707107,0,2.037401,2.037401,3,
-	-0.707107,-0.707107,0,2.037401,2.037401,0,
-	-0.930022,-0.367505,0,2.202148,1.790839,3,
-	-0.952059,-0.305914,0,2.227275,1.720616,0,
-	-0.961565,-0.274577,0,2.227275,1.720616,3,
-	-0.952059,-0.305914,0,2.227275,1.720616,0,
-	-0.930022,-0.367505,0,2.202148,1.790839,3,
-	-0.91749,-0.397759,0,2.202148,1.790839,0,
-	-0.889521,-0.456893,0,2.17026,1.858262,3,
-	-0.91749,-0.397759,0,2.202148,1.790839,0,
-	-0.930022,-0.367505,0,2.202148,1.790839,3,
-	-0.91749,-0.397759,0,2.202148,1.790839,0,
-	-0.889521,-0.456893,0,2.17026,1.858262,3,
-	-0.874085,-0.485774,0,2.17026,1.858262,0,
-	-0.840455,-0.541882,0,2.131917,1.922233,3,
-	-0.874085,-0.485774,0,2.17026,1.858262,0,
-	-0.889521,-0.456893,0,2.17026,1.858262,3,
-	-0.874085,-0.485774,0,2.17026,1.858262,0,
-	-0.840455,-0.541882,0,2.131917,1.922233,3,
-	-0.822262,-0.56911,0,2.131917,1.922233,0,
-	-0.783294,-0.621651,0,2.087488,1.982139,3,
-	-0.822262,-0.56911,0,2.131917,1.922233,0,
-	-0.840455,-0.541882,0,2.131917,1.922233,3,
-	-0.822262,-0.56911,0,2.131917,1.922233,0,
-	-0.783294,-0.621651,0,2.087488,1.982139,3,
-	-0.76252,-0.646965,0,2.087488,1.982139,0,
-	-0.961565,-0.274577,0,2.227275,1.720616,3,
-	-0.97746,-0.211123,0,2.245397,1.648269,0,
-	-0.983848,-0.179005,0,2.245397,1.648269,3,
-	-0.97746,-0.211123,0,2.245397,1.648269,0,
-	-0.961565,-0.274577,0,2.227275,1.720616,3,
-	-0.952059,-0.305914,0,2.227275,1.720616,0,
-	-0.211123,0.97746,0,1.648269,0.754603,3,
-	-0.274577,0.961565,0,1.720616,0.772725,0,
-	-0.179005,0.983848,0,1.648269,0.754603,0,
-	-0.274577,0.961565,0,1.720616,0.772725,0,
-	-0.211123,0.97746,0,1.648269,0.754603,3,
-	-0.305914,0.952059,0,1.720616,0.772725,3,
-	-0.114299,0.993446,0,1.574493,0.74366,3,
-	-0.179005,0.983848,0,1.648269,0.754603,0,
-	-0.081709,0.996656,0,1.574493,0.74366,0,
-	-0.179005,0.983848,0,1.648269,0.754603,0,
-	-0.114299,0.993446,0,1.574493,0.74366,3,
-	-0.211123,0.97746,0,1.648269,0.754603,3,
-	-0.993446,0.114299,0,2.25634,1.425507,3,
-	-0.983848,0.179005,0,2.245397,1.351731,0,
-	-0.97746,0.211123,0,2.245397,1.351731,3,
-	-0.983848,0.179005,0,2.245397,1.351731,0,
-	-0.993446,0.114299,0,2.25634,1.425507,3,
-	-0.996656,0.081709,0,2.25634,1.425507,0,
-	-0.999866,0.016373,0,2.26,1.5,3,
-	-0.996656,0.081709,0,2.25634,1.425507,0,
-	-0.993446,0.114299,0,2.25634,1.425507,3,
-	-0.996656,0.081709,0,2.25634,1.425507,0,
-	-0.999866,0.016373,0,2.26,1.5,3,
-	-0.999866,-0.016373,0,2.26,1.5,0,
-	-0.996656,-0.081709,0,2.25634,1.574493,3,
-	-0.999866,-0.016373,0,2.26,1.5,0,
-	-0.999866,0.016373,0,2.26,1.5,3,
-	-0.999866,-0.016373,0,2.26,1.5,0,
-	-0.996656,-0.081709,0,2.25634,1.574493,3,
-	-0.993446,-0.114299,0,2.25634,1.574493,0,
-	-0.983848,-0.179005,0,2.245397,1.648269,3,
-	-0.993446,-0.114299,0,2.25634,1.574493,0,
-	-0.996656,-0.081709,0,2.25634,1.574493,3,
-	-0.993446,-0.114299,0,2.25634,1.574493,0,
-	-0.983848,-0.179005,0,2.245397,1.648269,3,
-	-0.97746,-0.211123,0,2.245397,1.648269,0,
-	0.822262,0.56911,0,0.868083,1.077767,0,
-	0.783294,0.621651,0,0.912512,1.017861,3,
-	0.76252,0.646965,0,0.912512,1.017861,0,
-	0.783294,0.621651,0,0.912512,1.017861,3,
-	0.822262,0.56911,0,0.868083,1.077767,0,
-	0.840455,0.541882,0,0.868083,1.077767,3,
-	0.707107,0.707107,0,0.962599,0.962599,3,
-	0.646965,0.76252,0,1.017861,0.912512,0,
-	0.707107,0.707107,0,0.962599,0.962599,0,
-	0.646965,0.76252,0,1.017861,0.912512,0,
-	0.707107,0.707107,0,0.962599,0.962599,3,
-	0.621651,0.783294,0,1.017861,0.912512,3,
-	-0.97746,0.211123,0,2.245397,1.351731,3,
-	-0.961565,0.274577,0,2.227275,1.279384,0,
-	-0.952059,0.305914,0,2.227275,1.279384,3,
-	-0.961565,0.274577,0,2.227275,1.279384,0,
-	-0.97746,0.211123,0,2.245397,1.351731,3,
-	-0.983848,0.179005,0,2.245397,1.351731,0,
-	0.541882,0.840455,0,1.077767,0.868083,3,
-	0.485774,0.874085,0,1.141738,0.82974,0,
-	0.56911,0.822262,0,1.077767,0.868083,0,
-	0.485774,0.874085,0,1.141738,0.82974,0,
-	0.541882,0.840455,0,1.077767,0.868083,3,
-	0.456893,0.889521,0,1.141738,0.82974,3,
-	-0.56911,0.822262,0,1.922233,0.868083,3,
-	-0.621651,0.783294,0,1.982139,0.912512,0,
-	-0.541882,0.840455,0,1.922233,0.868083,0,
-	-0.621651,0.783294,0,1.982139,0.912512,0,
-	-0.56911,0.822262,0,1.922233,0.868083,3,
-	-0.646965,0.76252,0,1.982139,0.912512,3,
-	-0.646965,0.76252,0,1.982139,0.912512,3,
-	-0.707107,0.707107,0,2.037401,0.962599,0,
-	-0.621651,0.783294,0,1.982139,0.912512,0,
-	-0.707107,0.707107,0,2.037401,0.962599,0,
-	-0.646965,0.76252,0,1.982139,0.912512,3,
-	-0.707107,0.707107,0,2.037401,0.962599,3,
-	-0.952059,0.305914,0,2.227275,1.279384,3,
-	-0.930022,0.367505,0,2.202148,1.209161,0,
-	-0.91749,0.397759,0,2.202148,1.209161,3,
-	-0.930022,0.367505,0,2.202148,1.209161,0,
-	-0.952059,0.305914,0,2.227275,1.279384,3,
-	-0.961565,0.274577,0,2.227275,1.279384,0,
-	-0.485774,0.874085,0,1.858262,0.82974,3,
-	-0.541882,0.840455,0,1.922233,0.868083,0,
-	-0.456893,0.889521,0,1.858262,0.82974,0,
-	-0.541882,0.840455,0,1.922233,0.868083,0,
-	-0.485774,0.874085,0,1.858262,0.82974,3,
-	-0.56911,0.822262,0,1.922233,0.868083,3,
-	-0.397759,0.91749,0,1.790839,0.797852,3,
-	-0.456893,0.889521,0,1.858262,0.82974,0,
-	-0.367505,0.930022,0,1.790839,0.797852,0,
-	-0.456893,0.889521,0,1.858262,0.82974,0,
-	-0.397759,0.91749,0,1.790839,0.797852,3,
-	-0.485774,0.874085,0,1.858262,0.82974,3,
-	0.179005,0.983848,0,1.351731,0.754603,3,
-	0.114299,0.993446,0,1.425507,0.74366,0,
-	0.211123,0.97746,0,1.351731,0.754603,0,
-	0.114299,0.993446,0,1.425507,0.74366,0,
-	0.179005,0.983848,0,1.351731,0.754603,3,
-	0.081709,0.996656,0,1.425507,0.74366,3,
-	0.081709,0.996656,0,1.425507,0.74366,3,
-	0.016373,0.999866,0,1.5,0.74,0,
-	0.114299,0.993446,0,1.425507,0.74366,0,
-	0.016373,0.999866,0,1.5,0.74,0,
-	0.081709,0.996656,0,1.425507,0.74366,3,
-	-0.016373,0.999866,0,1.5,0.74,3,
-	-0.822262,0.56911,0,2.131917,1.077767,3,
-	-0.783294,0.621651,0,2.087488,1.017861,0,
-	-0.76252,0.646965,0,2.087488,1.017861,3,
-	-0.783294,0.621651,0,2.087488,1.017861,0,
-	-0.822262,0.56911,0,2.131917,1.077767,3,
-	-0.840455,0.541882,0,2.131917,1.077767,0,
-	0.367505,0.930022,0,1.209161,0.797852,3,
-	0.305914,0.952059,0,1.279384,0.772725,0,
-	0.397759,0.91749,0,1.209161,0.797852,0,
-	0.305914,0.952059,0,1.279384,0.772725,0,
-	0.367505,0.930022,0,1.209161,0.797852,3,
-	0.274577,0.961565,0,1.279384,0.772725,3,
-	0.274577,0.961565,0,1.279384,0.772725,3,
-	0.211123,0.97746,0,1.351731,0.754603,0,
-	0.305914,0.952059,0,1.279384,0.772725,0,
-	0.211123,0.97746,0,1.351731,0.754603,0,
-	0.274577,0.961565,0,1.279384,0.772725,3,
-	0.179005,0.983848,0,1.351731,0.754603,3,
-	-0.305914,0.952059,0,1.720616,0.772725,3,
-	-0.367505,0.930022,0,1.790839,0.797852,0,
-	-0.274577,0.961565,0,1.720616,0.772725,0,
-	-0.367505,0.930022,0,1.790839,0.797852,0,
-	-0.305914,0.952059,0,1.720616,0.772725,3,
-	-0.397759,0.91749,0,1.790839,0.797852,3,
-	-0.76252,0.646965,0,2.087488,1.017861,3,
-	-0.707107,0.707107,0,2.037401,0.962599,0,
-	-0.707107,0.707107,0,2.037401,0.962599,3,
-	-0.707107,0.707107,0,2.037401,0.962599,0,
-	-0.76252,0.646965,0,2.087488,1.017861,3,
-	-0.783294,0.621651,0,2.087488,1.017861,0,
-	-0.016373,0.999866,0,1.5,0.74,3,
-	-0.081709,0.996656,0,1.574493,0.74366,0,
-	0.016373,0.999866,0,1.5,0.74,0,
-	-0.081709,0.996656,0,1.574493,0.74366,0,
-	-0.016373,0.999866,0,1.5,0.74,3,
-	-0.114299,0.993446,0,1.574493,0.74366,3,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0.408248,-0.408248,-0.816497,3,0,0,
-	0.6,0,-0.8,3,0.497732,0,
-	1,0,0,3,0.205,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	0,0.447214,-0.894427,2.502268,3,0,
-	0,1,0,2.795,3,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.74366,1.425507,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,1.017861,0.912512,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.772725,1.720616,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.82974,1.141738,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.279384,0.772725,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0.447214,0,-0.894427,3,2.502268,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	1,0,0,3,2.795,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.795,0,0,
-	0,0,-1,2.795,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.077767,0.868083,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.141738,0.82974,0,
-	0,0,-1,1.209161,0.797852,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.868083,1.077767,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.912512,1.017861,0,
-	0,0,-1,0.962599,0.962599,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.797852,1.209161,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0.772725,1.279384,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.754603,1.351731,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.754603,1.648269,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.74366,1.574493,0,
-	0,0,-1,0.74,1.5,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0,3,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.754603,1.351731,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.74366,1.425507,3,
-	0,0,1,0.74,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.5,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.82974,1.141738,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.502268,3,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,3,0,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	0,0,1,2.502268,0,3,
-	0,-0.948683,-0.316228,2.795,0,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,0,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,3,0,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0.447214,0,0.894427,3,0.497732,3,
-	0.408248,-0.408248,0.816497,3,0,3,
-	1,0,0,3,0.205,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.754603,1.648269,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.772725,1.720616,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,3,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,3,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0.447214,0,0.894427,3,2.502268,3,
-	1,0,0,3,2.795,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.279384,0.772725,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.912512,1.017861,3,
-	0,0,1,0.868083,1.077767,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,1.141738,0.82974,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.209161,0.797852,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,0.962599,0.962599,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,1.017861,0.912512,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.077767,0.868083,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.797852,1.209161,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.772725,1.279384,3,
-	0,0,1,0.754603,1.351731,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,3,
-	0,0,-1,1.5,0,3,
-	0,0,-1,2.795,0,3,
-	0,0,-1,2.502268,0,3,
-	0,0,-1,1.5,0,3,
-	0,0,-1,2.502268,0,3,
-	0,0,-1,2.12132,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.798369,0,3,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,3,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.205,0,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,0.87868,0,3,
-	0,0,-1,0.205,0,3,
-	0,0,-1,0.87868,0,3,
-	0,0,-1,0.497732,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,3,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0.83205,0.5547,0.205,3,3,
-	0,0,1,0.497732,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,3,
-	0,1,0,2.795,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,2.12132,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,2.502268,3,3,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0,0,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0.205,
-	1,0,0,3,3,1.5,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,3,
-	1,0,0,3,0,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0,
-	1,0,0,3,3,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,3,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.1475,0,0.8525,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	0,-1,0,0,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.8525,0,2.1475,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.205,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,0.205,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.5,3,1.5,
-	0,1,0,0.8525,3,0.8525,
-	0,1,0,0.205,3,1.5
-};
-static const struct gllist lament_model_pillar_base_frame = { GL_N3F_V3F, GL_TRIANGLES, 1572, lament_model_pillar_base_data, 0 };
-const struct gllist *lament_model_pillar_base = &lament_model_pillar_base_frame;
-
-static const float lament_model_star_d_data[] = {
-	0,0,-1,0.955528,0.955528,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0.955528,0.955528,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.955528,0.955528,0,
-	0,0,-1,1.011517,0.904782,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,1.011517,0.904782,0,
-	0,0,-1,1.072211,0.859768,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.988483,2.095218,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,1.988483,2.095218,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,3,0,
-	0,-1,0,3,3,0,
-	0,-1,0,2.502268,3,0,
-	0,-1,0,2.795,3,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.266292,1.575473,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,2.266292,1.575473,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.34978,2.255205,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.34978,2.255205,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.424527,2.266292,0,
-	0,0,-1,1.424527,2.266292,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.27,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0.904782,1.988483,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.904782,1.988483,0,
-	0,0,-1,0.859768,1.927789,0,
-	0,0,-1,2.095218,1.011517,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.095218,1.011517,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,3,0.497732,0,
-	0,-1,0,2.12132,0,0.82632,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.12132,0,0.82632,
-	0,-1,0,2.12132,0,2.17368,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.723519,0.763156,3,
-	0,0,1,1.65022,0.744795,3,
-	0,0,1,1.723519,0.763156,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,1,0,0.87868,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.87868,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.87868,3,3,
-	0,1,0,1.201631,3,3,
-	0,1,0,1.5,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.201631,3,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.072211,0.859768,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.072211,0.859768,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.137025,0.820921,3,
-	0,0,1,1.137025,0.820921,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.205334,0.788613,3,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.12132,3,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,0.87868,0,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.201631,3,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.201631,0,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,0,
-	0,0,1,2.236844,1.723519,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.236844,1.723519,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,3,1.798369,3,
-	0,0,-1,1.575473,0.733708,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.73,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.575473,0.733708,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.575473,0.733708,0,
-	0,0,-1,1.65022,0.744795,0,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.179079,1.137025,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,2.179079,1.137025,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,0.763156,1.276481,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0.763156,1.276481,3,
-	0,0,1,0.744795,1.34978,3,
-	0,0,-1,0.73,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.73,1.5,0,
-	0,0,-1,0.733708,1.424527,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.733708,1.424527,0,
-	0,0,-1,0.744795,1.34978,0,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,3,3,
-	-1,0,0,0,3,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,1.988483,2.095218,0,
-	0,0,1,1.205334,2.211387,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.205334,2.211387,3,
-	0,0,1,1.276481,2.236844,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.276481,2.236844,3,
-	0,0,1,1.34978,2.255205,3,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0,3,
-	1,0,0,3,0,0,
-	1,0,0,3,0,3,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,0.87868,3,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.795,3,1.5,
-	-0.55557,-0.83147,0,1.927789,2.140232,3,
-	-0.471397,-0.881921,0,1.862975,2.179079,1.5,
-	-0.55557,-0.83147,0,1.927789,2.140232,1.5,
-	-0.471397,-0.881921,0,1.862975,2.179079,1.5,
-	-0.55557,-0.83147,0,1.927789,2.140232,3,
-	-0.471397,-0.881921,0,1.862975,2.179079,3,
-	-0.941544,-0.33689,0,2.211387,1.794666,3,
-	-0.952059,-0.305914,0,2.236844,1.723519,1.5,
-	-0.961565,-0.274577,0,2.236844,1.723519,3,
-	-0.952059,-0.305914,0,2.236844,1.723519,1.5,
-	-0.941544,-0.33689,0,2.211387,1.794666,3,
-	-0.941544,-0.33689,0,2.211387,1.794666,1.5,
-	0.740951,-0.671559,0,0.955528,2.044472,1.5,
-	0.76252,-0.646965,0,0.904782,1.988483,3,
-	0.783294,-0.621651,0,0.904782,1.988483,1.5,
-	0.76252,-0.646965,0,0.904782,1.988483,3,
-	0.740951,-0.671559,0,0.955528,2.044472,1.5,
-	0.740951,-0.671559,0,0.955528,2.044472,3,
-	-0.996656,-0.081709,0,2.266292,1.575473,3,
-	-0.998795,-0.049068,0,2.27,1.5,1.5,
-	-0.998795,-0.049068,0,2.27,1.5,3,
-	-0.998795,-0.049068,0,2.27,1.5,1.5,
-	-0.996656,-0.081709,0,2.266292,1.575473,3,
-	-0.993446,-0.114299,0,2.266292,1.575473,1.5,
-	-0.822262,0.56911,0,2.140232,1.072211,3,
-	-0.783294,0.621651,0,2.095218,1.011517,1.5,
-	-0.76252,0.646965,0,2.095218,1.011517,3,
-	-0.783294,0.621651,0,2.095218,1.011517,1.5,
-	-0.822262,0.56911,0,2.140232,1.072211,3,
-	-0.840455,0.541882,0,2.140232,1.072211,1.5,
-	0.840455,-0.541882,0,0.859768,1.927789,1.5,
-	0.874085,-0.485774,0,0.820921,1.862975,3,
-	0.889521,-0.456893,0,0.820921,1.862975,1.5,
-	0.874085,-0.485774,0,0.820921,1.862975,3,
-	0.840455,-0.541882,0,0.859768,1.927789,1.5,
-	0.822262,-0.56911,0,0.859768,1.927789,3,
-	-0.471397,-0.881921,0,1.862975,2.179079,1.5,
-	-0.427555,-0.903989,0,1.794666,2.211387,3,
-	-0.427555,-0.903989,0,1.794666,2.211387,1.5,
-	-0.427555,-0.903989,0,1.794666,2.211387,3,
-	-0.471397,-0.881921,0,1.862975,2.179079,1.5,
-	-0.471397,-0.881921,0,1.862975,2.179079,3,
-	-0.382683,-0.92388,0,0.788613,1.794666,0,
-	-0.382683,-0.92388,0,0,2.12132,3,
-	-0.382683,-0.92388,0,0,2.12132,0,
-	-0.382683,-0.92388,0,0,2.12132,3,
-	-0.382683,-0.92388,0,0.788613,1.794666,0,
-	-0.382683,-0.92388,0,0.788613,1.794666,1.5,
-	-0.382683,-0.92388,0,0,2.12132,3,
-	-0.382683,-0.92388,0,0.788613,1.794666,1.5,
-	-0.382683,-0.92388,0,0.788613,1.794666,3,
-	-0.290285,-0.95694,0,1.276481,0.763156,0,
-	-0.33689,-0.941544,0,1.205334,0.788613,1.5,
-	-0.33689,-0.941544,0,1.205334,0.788613,0,
-	-0.33689,-0.941544,0,1.205334,0.788613,1.5,
-	-0.290285,-0.95694,0,1.276481,0.763156,0,
-	-0.290285,-0.95694,0,1.276481,0.763156,1.5,
-	-1,0,0,1.5,0.73,3,
-	-1,0,0,1.5,0,2.795,
-	-1,0,0,1.5,0,3,
-	-1,0,0,1.5,0,2.795,
-	-1,0,0,1.5,0.73,3,
-	-1,0,0,1.5,0,0.205,
-	-1,0,0,1.5,0,0.205,
-	-1,0,0,1.5,0.73,3,
-	-1,0,0,1.5,0,0,
-	-1,0,0,1.5,0,0,
-	-1,0,0,1.5,0.73,3,
-	-1,0,0,1.5,0.73,0,
-	-0.027218,-0.554032,-0.83205,1.5,0.73,0,
-	-0.823173,0.401247,0.401731,1.5,0.73,3,
-	0.689105,0,0.724662,1.5,0.73,1.5,
-	0.783294,0.621651,0,2.095218,1.988483,0,
-	0.822262,0.56911,0,2.140232,1.927789,1.5,
-	0.840455,0.541882,0,2.140232,1.927789,0,
-	0.822262,0.56911,0,2.140232,1.927789,1.5,
-	0.783294,0.621651,0,2.095218,1.988483,0,
-	0.76252,0.646965,0,2.095218,1.988483,1.5,
-	0.114299,0.993446,0,1.575473,2.266292,0,
-	0.179005,0.983848,0,1.65022,2.255205,1.5,
-	0.211123,0.97746,0,1.65022,2.255205,0,
-	0.179005,0.983848,0,1.65022,2.255205,1.5,
-	0.114299,0.993446,0,1.575473,2.266292,0,
-	0.081709,0.996656,0,1.575473,2.266292,1.5,
-	-0.382683,0.92388,0,2.211387,1.794666,1.5,
-	-0.382683,0.92388,0,3,2.12132,0,
-	-0.382683,0.92388,0,2.211387,1.794666,0,
-	-0.382683,0.92388,0,3,2.12132,0,
-	-0.382683,0.92388,0,2.211387,1.794666,1.5,
-	-0.382683,0.92388,0,3,2.12132,3,
-	-0.382683,0.92388,0,3,2.12132,3,
-	-0.382683,0.92388,0,2.211387,1.794666,1.5,
-	-0.382683,0.92388,0,2.211387,1.794666,3,
-	-0.55557,0.83147,0,1.072211,2.140232,1.5,
-	-0.471397,0.881921,0,1.137025,2.179079,0,
-	-0.55557,0.83147,0,1.072211,2.140232,0,
-	-0.471397,0.881921,0,1.137025,2.179079,0,
-	-0.55557,0.83147,0,1.072211,2.140232,1.5,
-	-0.471397,0.881921,0,1.137025,2.179079,1.5,
-	0.471397,-0.881921,0,1.862975,0.820921,0,
-	0.427555,-0.903989,0,1.794666,0.788613,1.5,
-	0.427555,-0.903989,0,1.794666,0.788613,0,
-	0.427555,-0.903989,0,1.794666,0.788613,1.5,
-	0.471397,-0.881921,0,1.862975,0.820921,0,
-	0.471397,-0.881921,0,1.862975,0.820921,1.5,
-	-0.903989,-0.427555,0,0.788613,1.205334,1.5,
-	-0.889521,-0.456893,0,0.820921,1.137025,0,
-	-0.874085,-0.485774,0,0.820921,1.137025,1.5,
-	-0.889521,-0.456893,0,0.820921,1.137025,0,
-	-0.903989,-0.427555,0,0.788613,1.205334,1.5,
-	-0.903989,-0.427555,0,0.788613,1.205334,0,
-	-0.671559,0.740951,0,0.955528,2.044472,0,
-	-0.646965,0.76252,0,1.011517,2.095218,1.5,
-	-0.621651,0.783294,0,1.011517,2.095218,0,
-	-0.646965,0.76252,0,1.011517,2.095218,1.5,
-	-0.671559,0.740951,0,0.955528,2.044472,0,
-	-0.671559,0.740951,0,0.955528,2.044472,1.5,
-	0.049068,0.998795,0,1.5,2.27,0,
-	0.081709,0.996656,0,1.575473,2.266292,1.5,
-	0.114299,0.993446,0,1.575473,2.266292,0,
-	0.081709,0.996656,0,1.575473,2.266292,1.5,
-	0.049068,0.998795,0,1.5,2.27,0,
-	0.049068,0.998795,0,1.5,2.27,1.5,
-	-0.471397,0.881921,0,1.137025,2.179079,0,
-	-0.427555,0.903989,0,1.205334,2.211387,1.5,
-	-0.427555,0.903989,0,1.205334,2.211387,0,
-	-0.427555,0.903989,0,1.205334,2.211387,1.5,
-	-0.471397,0.881921,0,1.137025,2.179079,0,
-	-0.471397,0.881921,0,1.137025,2.179079,1.5,
-	0.55557,-0.83147,0,1.927789,0.859768,1.5,
-	0.471397,-0.881921,0,1.862975,0.820921,0,
-	0.55557,-0.83147,0,1.927789,0.859768,0,
-	0.471397,-0.881921,0,1.862975,0.820921,0,
-	0.55557,-0.83147,0,1.927789,0.859768,1.5,
-	0.471397,-0.881921,0,1.862975,0.820921,1.5,
-	-0.621651,0.783294,0,1.011517,2.095218,0,
-	-0.55557,0.83147,0,1.072211,2.140232,1.5,
-	-0.55557,0.83147,0,1.072211,2.140232,0,
-	-0.55557,0.83147,0,1.072211,2.140232,1.5,
-	-0.621651,0.783294,0,1.011517,2.095218,0,
-	-0.646965,0.76252,0,1.011517,2.095218,1.5,
-	-0.874085,0.485774,0,2.179079,1.137025,3,
-	-0.840455,0.541882,0,2.140232,1.072211,1.5,
-	-0.822262,0.56911,0,2.140232,1.072211,3,
-	-0.840455,0.541882,0,2.140232,1.072211,1.5,
-	-0.874085,0.485774,0,2.179079,1.137025,3,
-	-0.889521,0.456893,0,2.179079,1.137025,1.5,
-	-0.822262,-0.56911,0,0.859768,1.072211,1.5,
-	-0.783294,-0.621651,0,0.904782,1.011517,0,
-	-0.76252,-0.646965,0,0.904782,1.011517,1.5,
-	-0.783294,-0.621651,0,0.904782,1.011517,0,
-	-0.822262,-0.56911,0,0.859768,1.072211,1.5,
-	-0.840455,-0.541882,0,0.859768,1.072211,0,
-	0.098017,-0.995185,0,1.424527,2.266292,3,
-	0.179005,-0.983848,0,1.34978,2.255205,1.5,
-	0.098017,-0.995185,0,1.424527,2.266292,1.5,
-	0.179005,-0.983848,0,1.34978,2.255205,1.5,
-	0.098017,-0.995185,0,1.424527,2.266292,3,
-	0.211123,-0.97746,0,1.34978,2.255205,3,
-	-0.76252,0.646965,0,2.095218,1.011517,3,
-	-0.740951,0.671559,0,2.044472,0.955528,1.5,
-	-0.740951,0.671559,0,2.044472,0.955528,3,
-	-0.740951,0.671559,0,2.044472,0.955528,1.5,
-	-0.76252,0.646965,0,2.095218,1.011517,3,
-	-0.783294,0.621651,0,2.095218,1.011517,1.5,
-	-0.961565,-0.274577,0,2.236844,1.723519,3,
-	-0.97746,-0.211123,0,2.255205,1.65022,1.5,
-	-0.983848,-0.179005,0,2.255205,1.65022,3,
-	-0.97746,-0.211123,0,2.255205,1.65022,1.5,
-	-0.961565,-0.274577,0,2.236844,1.723519,3,
-	-0.952059,-0.305914,0,2.236844,1.723519,1.5,
-	0.471397,0.881921,0,1.137025,0.820921,1.5,
-	0.427555,0.903989,0,1.205334,0.788613,3,
-	0.427555,0.903989,0,1.205334,0.788613,1.5,
-	0.427555,0.903989,0,1.205334,0.788613,3,
-	0.471397,0.881921,0,1.137025,0.820921,1.5,
-	0.471397,0.881921,0,1.137025,0.820921,3,
-	0.305914,0.952059,0,1.723519,2.236844,0,
-	0.33689,0.941544,0,1.794666,2.211387,1.5,
-	0.33689,0.941544,0,1.794666,2.211387,0,
-	0.33689,0.941544,0,1.794666,2.211387,1.5,
-	0.305914,0.952059,0,1.723519,2.236844,0,
-	0.274577,0.961565,0,1.723519,2.236844,1.5,
-	0.671559,0.740951,0,0.955528,0.955528,1.5,
-	0.634393,0.77301,0,1.011517,0.904782,3,
-	0.634393,0.77301,0,1.011517,0.904782,1.5,
-	0.634393,0.77301,0,1.011517,0.904782,3,
-	0.671559,0.740951,0,0.955528,0.955528,1.5,
-	0.671559,0.740951,0,0.955528,0.955528,3,
-	1,0,0,1.5,3,0,
-	1,0,0,1.5,2.27,1.5,
-	1,0,0,1.5,2.27,0,
-	1,0,0,1.5,2.27,1.5,
-	1,0,0,1.5,3,0,
-	1,0,0,1.5,2.27,3,
-	1,0,0,1.5,2.27,3,
-	1,0,0,1.5,3,0,
-	1,0,0,1.5,3,3,
-	0.301511,0.301511,0.904534,1.5,3,3,
-	0.688247,0.229416,-0.688247,1.5,3,0,
-	0,1,0,1.5,3,0.205,
-	0.301511,0.301511,0.904534,1.5,3,3,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,2.795,
-	-0.961565,0.274577,0,0.763156,1.723519,1.5,
-	-0.97746,0.211123,0,0.744795,1.65022,0,
-	-0.983848,0.179005,0,0.744795,1.65022,1.5,
-	-0.97746,0.211123,0,0.744795,1.65022,0,
-	-0.961565,0.274577,0,0.763156,1.723519,1.5,
-	-0.952059,0.305914,0,0.763156,1.723519,0,
-	0.889521,-0.456893,0,0.820921,1.862975,1.5,
-	0.903989,-0.427555,0,0.788613,1.794666,3,
-	0.903989,-0.427555,0,0.788613,1.794666,1.5,
-	0.903989,-0.427555,0,0.788613,1.794666,3,
-	0.889521,-0.456893,0,0.820921,1.862975,1.5,
-	0.874085,-0.485774,0,0.820921,1.862975,3,
-	-0.634393,-0.77301,0,1.988483,2.095218,1.5,
-	-0.55557,-0.83147,0,1.927789,2.140232,3,
-	-0.55557,-0.83147,0,1.927789,2.140232,1.5,
-	-0.55557,-0.83147,0,1.927789,2.140232,3,
-	-0.634393,-0.77301,0,1.988483,2.095218,1.5,
-	-0.634393,-0.77301,0,1.988483,2.095218,3,
-	-0.707107,0.707107,0,0.955528,0.955528,3,
-	-0.707107,0.707107,0,0,0,2.795,
-	-0.707107,0.707107,0,0,0,3,
-	-0.707107,0.707107,0,0,0,2.795,
-	-0.707107,0.707107,0,0.955528,0.955528,3,
-	-0.707107,0.707107,0,0,0,1.5,
-	-0.707107,0.707107,0,0,0,1.5,
-	-0.707107,0.707107,0,0.955528,0.955528,3,
-	-0.707107,0.707107,0,0,0,0.205,
-	-0.707107,0.707107,0,0,0,0.205,
-	-0.707107,0.707107,0,0.955528,0.955528,3,
-	-0.707107,0.707107,0,0,0,0,
-	-0.707107,0.707107,0,0,0,0,
-	-0.707107,0.707107,0,0.955528,0.955528,3,
-	-0.707107,0.707107,0,0.955528,0.955528,0,
-	0,1,0,0.955528,0.955528,0,
-	0,1,0,0.955528,0.955528,3,
-	0,1,0,0.955528,0.955528,1.5,
-	-0.707107,-0.707107,0,3,0,0,
-	-0.707107,-0.707107,0,2.044472,0.955528,1.5,
-	-0.707107,-0.707107,0,2.044472,0.955528,0,
-	-0.707107,-0.707107,0,2.044472,0.955528,1.5,
-	-0.707107,-0.707107,0,3,0,0,
-	-0.707107,-0.707107,0,3,0,3,
-	-0.707107,-0.707107,0,2.044472,0.955528,1.5,
-	-0.707107,-0.707107,0,3,0,3,
-	-0.707107,-0.707107,0,2.044472,0.955528,3,
-	0.996993,0.077486,0,2.12132,0,0,
-	1,0,0,2.12132,0,0.82632,
-	1,0,0,2.12132,0,0.205,
-	1,0,0,2.12132,0,0.82632,
-	0.996993,0.077486,0,2.12132,0,0,
-	1,0,0,2.12132,0,2.17368,
-	1,0,0,2.12132,0,2.17368,
-	0.996993,0.077486,0,2.12132,0,0,
-	1,0,0,2.12132,0,2.795,
-	1,0,0,2.12132,0,2.795,
-	0.996993,0.077486,0,2.12132,0,0,
-	0.96573,0.259551,0,2.12132,0,3,
-	0.96573,0.259551,0,2.12132,0,3,
-	0.996993,0.077486,0,2.12132,0,0,
-	0.92388,0.382683,0,1.794666,0.788613,0,
-	0.96573,0.259551,0,2.12132,0,3,
-	0.92388,0.382683,0,1.794666,0.788613,0,
-	0.92388,0.382683,0,1.794666,0.788613,3,
-	0.237702,0.536246,0.8099,1.794666,0.788613,3,
-	0.470193,0.03587,-0.881834,1.794666,0.788613,0,
-	0.371553,0.153902,0.915567,1.794666,0.788613,1.5,
-	0.993446,-0.114299,0,2.266292,1.424527,0,
-	0.983848,-0.179005,0,2.255205,1.34978,1.5,
-	0.97746,-0.211123,0,2.255205,1.34978,0,
-	0.983848,-0.179005,0,2.255205,1.34978,1.5,
-	0.993446,-0.114299,0,2.266292,1.424527,0,
-	0.996656,-0.081709,0,2.266292,1.424527,1.5,
-	0.998795,-0.049068,0,2.27,1.5,0,
-	0.996656,-0.081709,0,2.266292,1.424527,1.5,
-	0.993446,-0.114299,0,2.266292,1.424527,0,
-	0.996656,-0.081709,0,2.266292,1.424527,1.5,
-	0.998795,-0.049068,0,2.27,1.5,0,
-	0.998795,-0.049068,0,2.27,1.5,1.5,
-	0.97746,-0.211123,0,2.255205,1.34978,0,
-	0.961565,-0.274577,0,2.236844,1.276481,1.5,
-	0.952059,-0.305914,0,2.236844,1.276481,0,
-	0.961565,-0.274577,0,2.236844,1.276481,1.5,
-	0.97746,-0.211123,0,2.255205,1.34978,0,
-	0.983848,-0.179005,0,2.255205,1.34978,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,2.095218,1.011517,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,2.095218,1.011517,1.5,
-	0,0,1,2.140232,1.072211,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,2.140232,1.072211,1.5,
-	0,0,1,2.179079,1.137025,1.5,
-	0.993446,0.114299,0,0.733708,1.424527,1.5,
-	0.983848,0.179005,0,0.744795,1.34978,3,
-	0.97746,0.211123,0,0.744795,1.34978,1.5,
-	0.983848,0.179005,0,0.744795,1.34978,3,
-	0.993446,0.114299,0,0.733708,1.424527,1.5,
-	0.996656,0.081709,0,0.733708,1.424527,3,
-	-0.874085,-0.485774,0,0.820921,1.137025,1.5,
-	-0.840455,-0.541882,0,0.859768,1.072211,0,
-	-0.822262,-0.56911,0,0.859768,1.072211,1.5,
-	-0.840455,-0.541882,0,0.859768,1.072211,0,
-	-0.874085,-0.485774,0,0.820921,1.137025,1.5,
-	-0.889521,-0.456893,0,0.820921,1.137025,0,
-	-0.92388,-0.382683,0,0.87868,3,3,
-	-0.92388,-0.382683,0,1.205334,2.211387,1.5,
-	-0.92388,-0.382683,0,1.205334,2.211387,3,
-	-0.92388,-0.382683,0,1.205334,2.211387,1.5,
-	-0.92388,-0.382683,0,0.87868,3,3,
-	-0.92388,-0.382683,0,1.205334,2.211387,0,
-	-0.92388,-0.382683,0,1.205334,2.211387,0,
-	-0.92388,-0.382683,0,0.87868,3,3,
-	-0.92388,-0.382683,0,0.87868,3,0,
-	0,-1,0,0.87868,3,0,
-	0,-1,0,0.87868,3,3,
-	0,-1,0,0.87868,3,2.795,
-	0,-1,0,0.87868,3,0,
-	0,-1,0,0.87868,3,2.795,
-	0,-1,0,0.87868,3,2.17368,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.87868,3,0.82632,
-	-0.653281,-0.270598,-0.707107,0.87868,3,0,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,0.87868,3,0.205,
-	0.382683,0.92388,0,2.211387,1.205334,1.5,
-	0.382683,0.92388,0,3,0.87868,0,
-	0.382683,0.92388,0,2.211387,1.205334,0,
-	0.382683,0.92388,0,3,0.87868,0,
-	0.382683,0.92388,0,2.211387,1.205334,1.5,
-	0.382683,0.92388,0,3,0.87868,3,
-	0.382683,0.92388,0,3,0.87868,3,
-	0.382683,0.92388,0,2.211387,1.205334,1.5,
-	0.382683,0.92388,0,2.211387,1.205334,3,
-	0,-1,0,3,1.5,0,
-	0,-1,0,2.27,1.5,1.5,
-	0,-1,0,2.27,1.5,0,
-	0,-1,0,2.27,1.5,1.5,
-	0,-1,0,3,1.5,0,
-	0,-1,0,3,1.5,3,
-	0,-1,0,2.27,1.5,1.5,
-	0,-1,0,3,1.5,3,
-	0,-1,0,2.27,1.5,3,
-	0.382683,-0.92388,0,0.788613,1.205334,0,
-	0.382683,-0.92388,0,0,0.87868,3,
-	0.382683,-0.92388,0,0,0.87868,0,
-	0.382683,-0.92388,0,0,0.87868,3,
-	0.382683,-0.92388,0,0.788613,1.205334,0,
-	0.382683,-0.92388,0,0.788613,1.205334,1.5,
-	0.382683,-0.92388,0,0,0.87868,3,
-	0.382683,-0.92388,0,0.788613,1.205334,1.5,
-	0.382683,-0.92388,0,0.788613,1.205334,3,
-	0.634393,0.77301,0,1.011517,0.904782,3,
-	0.56911,0.822262,0,1.072211,0.859768,1.5,
-	0.634393,0.77301,0,1.011517,0.904782,1.5,
-	0.56911,0.822262,0,1.072211,0.859768,1.5,
-	0.634393,0.77301,0,1.011517,0.904782,3,
-	0.541882,0.840455,0,1.072211,0.859768,3,
-	0.889521,0.456893,0,2.179079,1.862975,0,
-	0.903989,0.427555,0,2.211387,1.794666,1.5,
-	0.903989,0.427555,0,2.211387,1.794666,0,
-	0.903989,0.427555,0,2.211387,1.794666,1.5,
-	0.889521,0.456893,0,2.179079,1.862975,0,
-	0.874085,0.485774,0,2.179079,1.862975,1.5,
-	0.621651,-0.783294,0,1.988483,0.904782,0,
-	0.55557,-0.83147,0,1.927789,0.859768,1.5,
-	0.55557,-0.83147,0,1.927789,0.859768,0,
-	0.55557,-0.83147,0,1.927789,0.859768,1.5,
-	0.621651,-0.783294,0,1.988483,0.904782,0,
-	0.646965,-0.76252,0,1.988483,0.904782,1.5,
-	0.305914,-0.952059,0,1.276481,2.236844,3,
-	0.33689,-0.941544,0,1.205334,2.211387,1.5,
-	0.274577,-0.961565,0,1.276481,2.236844,1.5,
-	0.33689,-0.941544,0,1.205334,2.211387,1.5,
-	0.305914,-0.952059,0,1.276481,2.236844,3,
-	0.33689,-0.941544,0,1.205334,2.211387,3,
-	0.97746,0.211123,0,0.744795,1.34978,1.5,
-	0.961565,0.274577,0,0.763156,1.276481,3,
-	0.952059,0.305914,0,0.763156,1.276481,1.5,
-	0.961565,0.274577,0,0.763156,1.276481,3,
-	0.97746,0.211123,0,0.744795,1.34978,1.5,
-	0.983848,0.179005,0,0.744795,1.34978,3,
-	-0.305914,0.952059,0,1.723519,0.763156,3,
-	-0.33689,0.941544,0,1.794666,0.788613,1.5,
-	-0.274577,0.961565,0,1.723519,0.763156,1.5,
-	-0.33689,0.941544,0,1.794666,0.788613,1.5,
-	-0.305914,0.952059,0,1.723519,0.763156,3,
-	-0.33689,0.941544,0,1.794666,0.788613,3,
-	-0.671559,-0.740951,0,2.044472,2.044472,3,
-	-0.634393,-0.77301,0,1.988483,2.095218,1.5,
-	-0.671559,-0.740951,0,2.044472,2.044472,1.5,
-	-0.634393,-0.77301,0,1.988483,2.095218,1.5,
-	-0.671559,-0.740951,0,2.044472,2.044472,3,
-	-0.634393,-0.77301,0,1.988483,2.095218,3,
-	-0.19509,0.980785,0,1.65022,0.744795,3,
-	-0.274577,0.961565,0,1.723519,0.763156,1.5,
-	-0.19509,0.980785,0,1.65022,0.744795,1.5,
-	-0.274577,0.961565,0,1.723519,0.763156,1.5,
-	-0.19509,0.980785,0,1.65022,0.744795,3,
-	-0.305914,0.952059,0,1.723519,0.763156,3,
-	-0.098017,0.995185,0,1.575473,0.733708,1.5,
-	-0.19509,0.980785,0,1.65022,0.744795,3,
-	-0.19509,0.980785,0,1.65022,0.744795,1.5,
-	-0.19509,0.980785,0,1.65022,0.744795,3,
-	-0.098017,0.995185,0,1.575473,0.733708,1.5,
-	-0.098017,0.995185,0,1.575473,0.733708,3,
-	0.049068,-0.998795,0,1.5,2.27,1.5,
-	0.098017,-0.995185,0,1.424527,2.266292,3,
-	0.098017,-0.995185,0,1.424527,2.266292,1.5,
-	0.098017,-0.995185,0,1.424527,2.266292,3,
-	0.049068,-0.998795,0,1.5,2.27,1.5,
-	0.049068,-0.998795,0,1.5,2.27,3,
-	0.211123,-0.97746,0,1.34978,2.255205,3,
-	0.274577,-0.961565,0,1.276481,2.236844,1.5,
-	0.179005,-0.983848,0,1.34978,2.255205,1.5,
-	0.274577,-0.961565,0,1.276481,2.236844,1.5,
-	0.211123,-0.97746,0,1.34978,2.255205,3,
-	0.305914,-0.952059,0,1.276481,2.236844,3,
-	0.998795,0.049068,0,0.73,1.5,1.5,
-	0.996656,0.081709,0,0.733708,1.424527,3,
-	0.993446,0.114299,0,0.733708,1.424527,1.5,
-	0.996656,0.081709,0,0.733708,1.424527,3,
-	0.998795,0.049068,0,0.73,1.5,1.5,
-	0.998795,0.049068,0,0.73,1.5,3,
-	-0.983848,-0.179005,0,2.255205,1.65022,3,
-	-0.993446,-0.114299,0,2.266292,1.575473,1.5,
-	-0.996656,-0.081709,0,2.266292,1.575473,3,
-	-0.993446,-0.114299,0,2.266292,1.575473,1.5,
-	-0.983848,-0.179005,0,2.255205,1.65022,3,
-	-0.97746,-0.211123,0,2.255205,1.65022,1.5,
-	-0.098017,-0.995185,0,1.424527,0.733708,1.5,
-	-0.179005,-0.983848,0,1.34978,0.744795,0,
-	-0.098017,-0.995185,0,1.424527,0.733708,0,
-	-0.179005,-0.983848,0,1.34978,0.744795,0,
-	-0.098017,-0.995185,0,1.424527,0.733708,1.5,
-	-0.211123,-0.97746,0,1.34978,0.744795,1.5,
-	-0.903989,0.427555,0,2.211387,1.205334,3,
-	-0.889521,0.456893,0,2.179079,1.137025,1.5,
-	-0.874085,0.485774,0,2.179079,1.137025,3,
-	-0.889521,0.456893,0,2.179079,1.137025,1.5,
-	-0.903989,0.427555,0,2.211387,1.205334,3,
-	-0.903989,0.427555,0,2.211387,1.205334,1.5,
-	-0.049068,0.998795,0,1.5,0.73,3,
-	-0.098017,0.995185,0,1.575473,0.733708,1.5,
-	-0.049068,0.998795,0,1.5,0.73,1.5,
-	-0.098017,0.995185,0,1.575473,0.733708,1.5,
-	-0.049068,0.998795,0,1.5,0.73,3,
-	-0.098017,0.995185,0,1.575473,0.733708,3,
-	0.671559,-0.740951,0,2.044472,0.955528,0,
-	0.646965,-0.76252,0,1.988483,0.904782,1.5,
-	0.621651,-0.783294,0,1.988483,0.904782,0,
-	0.646965,-0.76252,0,1.988483,0.904782,1.5,
-	0.671559,-0.740951,0,2.044472,0.955528,0,
-	0.671559,-0.740951,0,2.044472,0.955528,1.5,
-	-0.049068,-0.998795,0,1.5,0.73,0,
-	-0.098017,-0.995185,0,1.424527,0.733708,1.5,
-	-0.098017,-0.995185,0,1.424527,0.733708,0,
-	-0.098017,-0.995185,0,1.424527,0.733708,1.5,
-	-0.049068,-0.998795,0,1.5,0.73,0,
-	-0.049068,-0.998795,0,1.5,0.73,1.5,
-	-0.983848,0.179005,0,0.744795,1.65022,1.5,
-	-0.993446,0.114299,0,0.733708,1.575473,0,
-	-0.996656,0.081709,0,0.733708,1.575473,1.5,
-	-0.993446,0.114299,0,0.733708,1.575473,0,
-	-0.983848,0.179005,0,0.744795,1.65022,1.5,
-	-0.97746,0.211123,0,0.744795,1.65022,0,
-	-0.941544,0.33689,0,0.788613,1.794666,1.5,
-	-0.952059,0.305914,0,0.763156,1.723519,0,
-	-0.961565,0.274577,0,0.763156,1.723519,1.5,
-	-0.952059,0.305914,0,0.763156,1.723519,0,
-	-0.941544,0.33689,0,0.788613,1.794666,1.5,
-	-0.941544,0.33689,0,0.788613,1.794666,0,
-	-0.211123,-0.97746,0,1.34978,0.744795,1.5,
-	-0.290285,-0.95694,0,1.276481,0.763156,0,
-	-0.179005,-0.983848,0,1.34978,0.744795,0,
-	-0.290285,-0.95694,0,1.276481,0.763156,0,
-	-0.211123,-0.97746,0,1.34978,0.744795,1.5,
-	-0.290285,-0.95694,0,1.276481,0.763156,1.5,
-	0.740951,0.671559,0,2.044472,2.044472,0,
-	0.76252,0.646965,0,2.095218,1.988483,1.5,
-	0.783294,0.621651,0,2.095218,1.988483,0,
-	0.76252,0.646965,0,2.095218,1.988483,1.5,
-	0.740951,0.671559,0,2.044472,2.044472,0,
-	0.740951,0.671559,0,2.044472,2.044472,1.5,
-	-0.76252,-0.646965,0,0.904782,1.011517,1.5,
-	-0.740951,-0.671559,0,0.955528,0.955528,0,
-	-0.740951,-0.671559,0,0.955528,0.955528,1.5,
-	-0.740951,-0.671559,0,0.955528,0.955528,0,
-	-0.76252,-0.646965,0,0.904782,1.011517,1.5,
-	-0.783294,-0.621651,0,0.904782,1.011517,0,
-	0.211123,0.97746,0,1.65022,2.255205,0,
-	0.274577,0.961565,0,1.723519,2.236844,1.5,
-	0.305914,0.952059,0,1.723519,2.236844,0,
-	0.274577,0.961565,0,1.723519,2.236844,1.5,
-	0.211123,0.97746,0,1.65022,2.255205,0,
-	0.179005,0.983848,0,1.65022,2.255205,1.5,
-	-0.996656,0.081709,0,0.733708,1.575473,1.5,
-	-0.998795,0.049068,0,0.73,1.5,0,
-	-0.998795,0.049068,0,0.73,1.5,1.5,
-	-0.998795,0.049068,0,0.73,1.5,0,
-	-0.996656,0.081709,0,0.733708,1.575473,1.5,
-	-0.993446,0.114299,0,0.733708,1.575473,0,
-	0.707107,-0.707107,0,3,3,0,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,2.044472,2.044472,0,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,3,3,0,
-	0.707107,-0.707107,0,3,3,0.205,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,3,3,0.205,
-	0.707107,-0.707107,0,3,3,1.5,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,3,3,1.5,
-	0.707107,-0.707107,0,3,3,2.795,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,3,3,2.795,
-	0.707107,-0.707107,0,2.044472,2.044472,3,
-	0.707107,-0.707107,0,2.044472,2.044472,3,
-	0.707107,-0.707107,0,3,3,2.795,
-	0.707107,-0.707107,0,3,3,3,
-	0.840455,0.541882,0,2.140232,1.927789,0,
-	0.874085,0.485774,0,2.179079,1.862975,1.5,
-	0.889521,0.456893,0,2.179079,1.862975,0,
-	0.874085,0.485774,0,2.179079,1.862975,1.5,
-	0.840455,0.541882,0,2.140232,1.927789,0,
-	0.822262,0.56911,0,2.140232,1.927789,1.5,
-	0.952059,-0.305914,0,2.236844,1.276481,0,
-	0.941544,-0.33689,0,2.211387,1.205334,1.5,
-	0.941544,-0.33689,0,2.211387,1.205334,0,
-	0.941544,-0.33689,0,2.211387,1.205334,1.5,
-	0.952059,-0.305914,0,2.236844,1.276481,0,
-	0.961565,-0.274577,0,2.236844,1.276481,1.5,
-	0,1,0,0,1.5,3,
-	0,1,0,0.73,1.5,0,
-	0,1,0,0,1.5,0,
-	0,1,0,0.73,1.5,0,
-	0,1,0,0,1.5,3,
-	0,1,0,0.73,1.5,1.5,
-	0,1,0,0.73,1.5,1.5,
-	0,1,0,0,1.5,3,
-	0,1,0,0.73,1.5,3,
-	0.541882,0.840455,0,1.072211,0.859768,3,
-	0.471397,0.881921,0,1.137025,0.820921,1.5,
-	0.56911,0.822262,0,1.072211,0.859768,1.5,
-	0.471397,0.881921,0,1.137025,0.820921,1.5,
-	0.541882,0.840455,0,1.072211,0.859768,3,
-	0.471397,0.881921,0,1.137025,0.820921,3,
-	0.952059,0.305914,0,0.763156,1.276481,1.5,
-	0.941544,0.33689,0,0.788613,1.205334,3,
-	0.941544,0.33689,0,0.788613,1.205334,1.5,
-	0.941544,0.33689,0,0.788613,1.205334,3,
-	0.952059,0.305914,0,0.763156,1.276481,1.5,
-	0.961565,0.274577,0,0.763156,1.276481,3,
-	0.783294,-0.621651,0,0.904782,1.988483,1.5,
-	0.822262,-0.56911,0,0.859768,1.927789,3,
-	0.840455,-0.541882,0,0.859768,1.927789,1.5,
-	0.822262,-0.56911,0,0.859768,1.927789,3,
-	0.783294,-0.621651,0,0.904782,1.988483,1.5,
-	0.76252,-0.646965,0,0.904782,1.988483,3,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,0.87868,0,0.205,
-	0.92388,-0.382683,0,0.87868,0,0,
-	0.92388,-0.382683,0,0.87868,0,0.205,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,0.87868,0,0.82632,
-	0.92388,-0.382683,0,0.87868,0,0.82632,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,0.87868,0,2.17368,
-	0.92388,-0.382683,0,0.87868,0,2.17368,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,0.87868,0,2.795,
-	0.92388,-0.382683,0,0.87868,0,2.795,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,0.87868,0,3,
-	0.92388,-0.382683,0,0.87868,0,3,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,1.205334,0.788613,3,
-	0.714674,0.572585,0.401731,1.205334,0.788613,3,
-	0.793487,-0.468606,-0.388313,1.205334,0.788613,0,
-	0.516676,-0.562787,0.645226,1.205334,0.788613,1.5,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.763156,1.276481,0,
-	0,0,-1,0.763156,1.276481,0,
-	0,0,-1,0,1.201631,0,
-	0,0,-1,0.744795,1.34978,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,2.095218,1.988483,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,2.179079,1.862975,0,
-	0,0,-1,1.072211,0.859768,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,0.497732,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.072211,0.859768,0,
-	0,0,-1,1.137025,0.820921,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.137025,0.820921,0,
-	0,0,-1,1.205334,0.788613,0,
-	0,0,-1,2.179079,1.137025,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.179079,1.137025,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,1.862975,0.820921,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,1.65022,0.744795,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.65022,0.744795,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,1.723519,0.763156,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,2.236844,1.276481,0,
-	0,0,-1,0.820921,1.862975,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.820921,1.862975,0,
-	0,0,-1,0.859768,1.927789,0,
-	0,0,-1,0.904782,1.988483,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.859768,1.927789,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.904782,1.988483,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0.763156,1.723519,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.744795,1.65022,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.763156,1.723519,0,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.862975,2.179079,0,
-	0,0,-1,1.65022,2.255205,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.65022,2.255205,0,
-	0,0,-1,1.723519,2.236844,0,
-	0,0,-1,1.723519,0.763156,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.65022,0.744795,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.723519,0.763156,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,2.236844,1.723519,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,2.266292,1.575473,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.011517,0.904782,0,
-	0,0,-1,0.955528,0.955528,0,
-	0,0,-1,1.011517,0.904782,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.072211,0.859768,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.137025,0.820921,0,
-	0,0,-1,1.072211,0.859768,0,
-	0,0,-1,1.137025,0.820921,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.205334,0.788613,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.733708,1.424527,0,
-	0,0,-1,0.73,1.5,0,
-	0,0,-1,0.733708,1.424527,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.744795,1.34978,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.276481,0.763156,0,
-	0,0,-1,1.205334,0.788613,0,
-	0,0,-1,1.276481,0.763156,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.34978,0.744795,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.763156,1.276481,0,
-	0,0,-1,0.744795,1.34978,0,
-	0,0,-1,0.763156,1.276481,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0.733708,1.575473,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.73,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.733708,1.575473,0,
-	0,0,-1,0.744795,1.65022,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.820921,1.137025,0,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0.820921,1.137025,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.859768,1.072211,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,2.266292,1.424527,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,2.095218,1.011517,0,
-	0,0,-1,1.575473,2.266292,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,2.27,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.575473,2.266292,0,
-	0,0,-1,1.65022,2.255205,0,
-	0,0,-1,1.011517,2.095218,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.011517,2.095218,0,
-	0,0,-1,1.072211,2.140232,0,
-	0,0,-1,1.137025,2.179079,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.072211,2.140232,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.137025,2.179079,0,
-	0,0,-1,1.205334,2.211387,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,1.988483,0.904782,0,
-	0,0,-1,1.276481,2.236844,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.205334,2.211387,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.276481,2.236844,0,
-	0,0,-1,1.34978,2.255205,0,
-	0,0,-1,1.424527,2.266292,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.34978,2.255205,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.424527,2.266292,0,
-	0,0,-1,1.5,2.27,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,2.140232,1.072211,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,2.179079,1.137025,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.904782,1.011517,0,
-	0,0,-1,0.859768,1.072211,0,
-	0,0,-1,0.904782,1.011517,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,0.955528,0.955528,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.575473,0.733708,0,
-	0,0,-1,1.5,0.73,0,
-	0,0,-1,1.575473,0.733708,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.65022,0.744795,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.205334,2.211387,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.205334,2.211387,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.276481,2.236844,0,
-	0,0,-1,1.276481,2.236844,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.34978,2.255205,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.820921,1.862975,0,
-	0,0,-1,0.820921,1.862975,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.859768,1.927789,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.862975,2.179079,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.862975,2.179079,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,1.927789,2.140232,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.424527,0.733708,0,
-	0,0,-1,1.34978,0.744795,0,
-	0,0,-1,1.424527,0.733708,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.73,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.236844,1.723519,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,2.236844,1.723519,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,2.255205,1.65022,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	-0.92388,0.382683,0,2.12132,3,3,
-	-0.92388,0.382683,0,1.794666,2.211387,1.5,
-	-0.92388,0.382683,0,1.794666,2.211387,3,
-	-0.92388,0.382683,0,1.794666,2.211387,1.5,
-	-0.92388,0.382683,0,2.12132,3,3,
-	-0.92388,0.382683,0,1.794666,2.211387,0,
-	-0.92388,0.382683,0,1.794666,2.211387,0,
-	-0.92388,0.382683,0,2.12132,3,3,
-	-0.92388,0.382683,0,2.12132,3,0,
-	-0.269347,0.403107,-0.874618,2.12132,3,0,
-	-0.537476,0.61047,0.58176,2.12132,3,3,
-	0,1,0,2.12132,3,2.795,
-	-0.269347,0.403107,-0.874618,2.12132,3,0,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,2.12132,3,2.17368,
-	-0.269347,0.403107,-0.874618,2.12132,3,0,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,2.12132,3,0.82632,
-	-0.269347,0.403107,-0.874618,2.12132,3,0,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.12132,3,0.205,
-	0,0,1,1.862975,2.179079,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.862975,2.179079,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,0.820921,1.862975,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.820921,1.862975,3,
-	0,0,1,0.859768,1.927789,3,
-	0.707107,0.707107,0,0,3,0,
-	0.707107,0.707107,0,0.955528,2.044472,1.5,
-	0.707107,0.707107,0,0.955528,2.044472,0,
-	0.707107,0.707107,0,0.955528,2.044472,1.5,
-	0.707107,0.707107,0,0,3,0,
-	0.707107,0.707107,0,0.955528,2.044472,3,
-	0.707107,0.707107,0,0.955528,2.044472,3,
-	0.707107,0.707107,0,0,3,0,
-	0.707107,0.707107,0,0,3,3,
-	0,0,1,0.859768,1.927789,3,
-	0,0,1,0,3,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,3,3,
-	0,0,1,0.859768,1.927789,3,
-	0,0,1,0.904782,1.988483,3,
-	0,0,1,0,3,3,
-	0,0,1,0.904782,1.988483,3,
-	0,0,1,0.955528,2.044472,3,
-	0,0,1,1.34978,2.255205,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.34978,2.255205,3,
-	0,0,1,1.424527,2.266292,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.424527,2.266292,3,
-	0,0,1,1.5,2.27,3,
-	0,0,1,2.266292,1.575473,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.266292,1.575473,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,0,0,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,0.205,0,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.011517,0.904782,3,
-	0,0,1,1.011517,0.904782,3,
-	0,0,1,0.497732,0,3,
-	0,0,1,1.072211,0.859768,3,
-	0,0,1,0.744795,1.34978,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.201631,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.744795,1.34978,3,
-	0,0,1,0.733708,1.424527,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0.733708,1.424527,3,
-	0,0,1,0.73,1.5,3,
-	0,0,1,1.988483,2.095218,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.988483,2.095218,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,3,3,3,
-	0,0,1,2.502268,3,3,
-	0.561517,0.232588,0.794104,3,3,3,
-	0,1,0,2.795,3,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.73,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.73,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.575473,0.733708,3,
-	0,0,1,1.575473,0.733708,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.65022,0.744795,3,
-	0,0,1,3,0,3,
-	0,0,1,2.095218,1.011517,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,2.095218,1.011517,3,
-	0,0,1,3,0,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.87868,3,2.795,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,2.12132,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.12132,3,3,
-	0,1,0,2.795,3,3,
-	0,1,0,2.795,3,3,
-	-0.537476,0.61047,0.58176,2.12132,3,3,
-	0,0,1,2.502268,3,3,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,2.12132,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.12132,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.12132,0,3,
-	0,-1,0,1.798369,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,1.798369,0,3,
-	0,-1,0,1.5,0,3,
-	0,-1,0,2.12132,0,0.82632,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,0.87868,0,2.17368,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,0.205,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,3,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.87868,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.87868,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.87868,0,3,
-	0,-1,0,0.205,0,3,
-	0,-0.83205,0.5547,0.205,0,3,
-	0.412538,-0.617407,0.669792,0.87868,0,3,
-	0,0,1,0.497732,0,3,
-	0,-1,0,0.87868,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.497732,0,0,
-	0,-1,0,0.87868,0,0.205,
-	0,-1,0,0.87868,0,2.17368,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.87868,0,2.17368,
-	0,-1,0,0.87868,0,2.795,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.87868,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.12132,0,2.17368,
-	0,-1,0,2.12132,0,2.795,
-	0,0,1,1.794666,0.788613,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,1.794666,0.788613,1.5,
-	0,0,1,1.862975,0.820921,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,1.862975,0.820921,1.5,
-	0,0,1,1.927789,0.859768,1.5,
-	0,0,1,2.044472,0.955528,1.5,
-	0,0,1,1.927789,0.859768,1.5,
-	0,0,1,1.988483,0.904782,1.5,
-	0.83147,0.55557,0,1.5,1.5,0,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.707107,0.707107,0,2.044472,0.955528,0,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.83147,0.55557,0,1.5,1.5,0,
-	0.83147,0.55557,0,1.5,1.5,1.5,
-	0.83147,0.55557,0,1.5,1.5,1.5,
-	0.83147,0.55557,0,1.5,1.5,0,
-	0.707107,0.707107,0,0.955528,2.044472,0,
-	0.83147,0.55557,0,1.5,1.5,1.5,
-	0.707107,0.707107,0,0.955528,2.044472,0,
-	0.707107,0.707107,0,0.955528,2.044472,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.276481,2.236844,1.5,
-	0,0,1,1.205334,2.211387,1.5,
-	0,0,1,1.276481,2.236844,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.34978,2.255205,1.5,
-	0,0,1,1.34978,2.255205,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.424527,2.266292,1.5,
-	0,0,1,1.424527,2.266292,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.5,2.27,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.820921,1.862975,1.5,
-	0,0,1,0.788613,1.794666,1.5,
-	0,0,1,0.820921,1.862975,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.859768,1.927789,1.5,
-	0,0,1,0.859768,1.927789,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.904782,1.988483,1.5,
-	0,0,1,0.904782,1.988483,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.955528,2.044472,1.5,
-	-0.382683,-0.92388,0,2.211387,1.205334,1.5,
-	-0.382683,-0.92388,0,1.5,1.5,0,
-	-0.382683,-0.92388,0,2.211387,1.205334,0,
-	-0.382683,-0.92388,0,1.5,1.5,0,
-	-0.382683,-0.92388,0,0.788613,1.794666,1.5,
-	-0.382683,-0.92388,0,0.788613,1.794666,0,
-	-0.382683,-0.92388,0,0.788613,1.794666,1.5,
-	-0.382683,-0.92388,0,1.5,1.5,0,
-	-0.382683,-0.92388,0,2.211387,1.205334,1.5,
-	-0.53272,-0.732123,0.424506,0.788613,1.794666,1.5,
-	0.220004,0.109479,0.969336,2.211387,1.205334,1.5,
-	0.245003,0.094681,0.964888,1.5,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.011517,2.095218,1.5,
-	0,0,1,0.955528,2.044472,1.5,
-	0,0,1,1.011517,2.095218,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.072211,2.140232,1.5,
-	0,0,1,1.072211,2.140232,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.137025,2.179079,1.5,
-	0,0,1,1.137025,2.179079,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.205334,2.211387,1.5,
-	0,0,1,1.276481,0.763156,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.205334,0.788613,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.276481,0.763156,1.5,
-	0,0,1,1.34978,0.744795,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.34978,0.744795,1.5,
-	0,0,1,1.424527,0.733708,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.424527,0.733708,1.5,
-	0,0,1,1.5,0.73,1.5,
-	0.92388,0.382683,0,1.5,1.5,0,
-	0.92388,0.382683,0,1.794666,0.788613,1.5,
-	0.92388,0.382683,0,1.794666,0.788613,0,
-	0.92388,0.382683,0,1.794666,0.788613,1.5,
-	0.92388,0.382683,0,1.5,1.5,0,
-	0.92388,0.382683,0,1.5,1.5,1.5,
-	0.92388,0.382683,0,1.5,1.5,1.5,
-	0.92388,0.382683,0,1.5,1.5,0,
-	0.92388,0.382683,0,1.205334,2.211387,0,
-	0.92388,0.382683,0,1.5,1.5,1.5,
-	0.92388,0.382683,0,1.205334,2.211387,0,
-	0.92388,0.382683,0,1.205334,2.211387,1.5,
-	0,0,1,1.575473,0.733708,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.5,0.73,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.575473,0.733708,1.5,
-	0,0,1,1.794666,0.788613,1.5,
-	0,0,1,1.794666,0.788613,1.5,
-	0,0,1,1.575473,0.733708,1.5,
-	0,0,1,1.65022,0.744795,1.5,
-	0,0,1,1.794666,0.788613,1.5,
-	0,0,1,1.65022,0.744795,1.5,
-	0,0,1,1.723519,0.763156,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.794666,2.211387,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.794666,2.211387,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.862975,2.179079,1.5,
-	0,0,1,1.862975,2.179079,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.927789,2.140232,1.5,
-	0,0,1,1.927789,2.140232,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.988483,2.095218,1.5,
-	1,0,0,1.5,1.5,0,
-	1,0,0,1.5,0.73,1.5,
-	1,0,0,1.5,0.73,0,
-	1,0,0,1.5,0.73,1.5,
-	1,0,0,1.5,1.5,0,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,1.5,0,
-	1,0,0,1.5,2.27,0,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,2.27,0,
-	1,0,0,1.5,2.27,1.5,
-	0,0,1,0.820921,1.137025,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.788613,1.205334,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.820921,1.137025,1.5,
-	0,0,1,0.859768,1.072211,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.859768,1.072211,1.5,
-	0,0,1,0.904782,1.011517,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.904782,1.011517,1.5,
-	0,0,1,0.955528,0.955528,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.575473,2.266292,1.5,
-	0,0,1,1.5,2.27,1.5,
-	0,0,1,1.575473,2.266292,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.794666,2.211387,1.5,
-	0,0,1,1.575473,2.266292,1.5,
-	0,0,1,1.794666,2.211387,1.5,
-	0,0,1,1.65022,2.255205,1.5,
-	0,0,1,1.65022,2.255205,1.5,
-	0,0,1,1.794666,2.211387,1.5,
-	0,0,1,1.723519,2.236844,1.5,
-	0.941913,-0.335858,0,1.5,1.5,0,
-	0.92388,-0.382683,0,1.205334,0.788613,1.5,
-	0.92388,-0.382683,0,1.205334,0.788613,0,
-	0.92388,-0.382683,0,1.205334,0.788613,1.5,
-	0.941913,-0.335858,0,1.5,1.5,0,
-	0.980785,-0.19509,0,1.5,1.5,1.5,
-	0.980785,-0.19509,0,1.5,1.5,1.5,
-	0.941913,-0.335858,0,1.5,1.5,0,
-	0.92388,-0.382683,0,1.794666,2.211387,0,
-	0.980785,-0.19509,0,1.5,1.5,1.5,
-	0.92388,-0.382683,0,1.794666,2.211387,0,
-	0.92388,-0.382683,0,1.794666,2.211387,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.236844,1.723519,1.5,
-	0,0,1,2.236844,1.723519,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.255205,1.65022,1.5,
-	0,0,1,2.255205,1.65022,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.266292,1.575473,1.5,
-	0,0,1,1.011517,0.904782,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.955528,0.955528,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.011517,0.904782,1.5,
-	0,0,1,1.072211,0.859768,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.072211,0.859768,1.5,
-	0,0,1,1.137025,0.820921,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.137025,0.820921,1.5,
-	0,0,1,1.205334,0.788613,1.5,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,1.5,1.5,0,
-	0.707107,-0.707107,0,2.044472,2.044472,0,
-	0.707107,-0.707107,0,1.5,1.5,0,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,0.955528,0.955528,0,
-	0.707107,-0.707107,0,0.955528,0.955528,0,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,0.955528,0.955528,1.5,
-	0,0,1,0.955528,0.955528,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.733708,1.575473,1.5,
-	0,0,1,0.73,1.5,1.5,
-	0,0,1,0.733708,1.575473,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.744795,1.65022,1.5,
-	0,0,1,0.744795,1.65022,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.763156,1.723519,1.5,
-	0,0,1,0.763156,1.723519,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.788613,1.794666,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.044472,2.044472,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,2.095218,1.988483,1.5,
-	0,0,1,2.095218,1.988483,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,2.140232,1.927789,1.5,
-	0,0,1,2.140232,1.927789,1.5,
-	0,0,1,2.211387,1.794666,1.5,
-	0,0,1,2.179079,1.862975,1.5,
-	0.382683,-0.92388,0,2.211387,1.794666,1.5,
-	0.522079,-0.852897,0,1.5,1.5,0,
-	0.382683,-0.92388,0,2.211387,1.794666,0,
-	0.522079,-0.852897,0,1.5,1.5,0,
-	0.382683,-0.92388,0,2.211387,1.794666,1.5,
-	0.382683,-0.92388,0,0.788613,1.205334,1.5,
-	0,0,-1,0.788613,1.205334,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0.382683,-0.92388,0,0.788613,1.205334,1.5,
-	0.382683,-0.92388,0,0.788613,1.205334,0,
-	0.522079,-0.852897,0,1.5,1.5,0,
-	0,0,1,0.733708,1.424527,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.73,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.733708,1.424527,1.5,
-	0,0,1,0.744795,1.34978,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.744795,1.34978,1.5,
-	0,0,1,0.763156,1.276481,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,0.763156,1.276481,1.5,
-	0,0,1,0.788613,1.205334,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,1.5,1.5,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.211387,1.205334,1.5,
-	0,0,1,2.236844,1.276481,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.236844,1.276481,1.5,
-	0,0,1,2.255205,1.34978,1.5,
-	0,0,1,2.27,1.5,1.5,
-	0,0,1,2.255205,1.34978,1.5,
-	0,0,1,2.266292,1.424527,1.5,
-	0,1,0,0.73,1.5,1.5,
-	0,1,0,1.5,1.5,0,
-	0,1,0,0.73,1.5,0,
-	0,1,0,1.5,1.5,0,
-	0,1,0,0.73,1.5,1.5,
-	0,1,0,1.5,1.5,1.5,
-	0,1,0,1.5,1.5,0,
-	0,1,0,2.27,1.5,1.5,
-	0,1,0,2.27,1.5,0,
-	0,1,0,2.27,1.5,1.5,
-	0,1,0,1.5,1.5,0,
-	0,1,0,1.5,1.5,1.5
-};
-static const struct gllist lament_model_star_d_frame = { GL_N3F_V3F, GL_TRIANGLES, 1608, lament_model_star_d_data, 0 };
-const struct gllist *lament_model_star_d = &lament_model_star_d_frame;
-
-static const float lament_model_star_u_data[] = {
-	0,0,1,3,1.201631,3,
-	0,0,1,2.266292,1.424527,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,2.266292,1.424527,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.5,3,
-	0,0,1,0.73,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.73,1.5,3,
-	0,0,1,0.733708,1.575473,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.733708,1.575473,3,
-	0,0,1,0.744795,1.65022,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.988483,0.904782,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,1.988483,0.904782,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,3,0,3,
-	0.397052,-0.725981,0.561517,3,0,3,
-	0,0,1,2.502268,0,3,
-	0,-1,0,2.795,0,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,0.904782,1.011517,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.904782,1.011517,3,
-	0,0,1,0.859768,1.072211,3,
-	0,0,1,1.575473,2.266292,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.27,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.575473,2.266292,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.575473,2.266292,3,
-	0,0,1,1.65022,2.255205,3,
-	0,0,1,2.095218,1.988483,3,
-	0,0,1,3,3,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,3,3,3,
-	0,0,1,2.095218,1.988483,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,3,3,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,3,2.502268,3,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,3,
-	0,-1,0,2.12132,0,2.17368,
-	0,-1,0,2.12132,0,0.82632,
-	0,-1,0,2.795,0,1.5,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,3,0,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,3,0,
-	1,0,0,3,3,3,
-	0,0,-1,2.236844,1.276481,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.211387,1.205334,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.236844,1.276481,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,3,1.201631,0,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.497732,3,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,0.497732,0,
-	-1,0,0,0,0.87868,3,
-	-1,0,0,0,0.87868,0,
-	0,0,1,0.955528,2.044472,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.955528,2.044472,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.955528,2.044472,3,
-	0,0,1,1.011517,2.095218,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,1.011517,2.095218,3,
-	0,0,1,1.072211,2.140232,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.34978,0.744795,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.34978,0.744795,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.424527,0.733708,3,
-	0,0,1,1.424527,0.733708,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.73,3,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0.87868,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.788613,1.205334,0,
-	0,0,-1,0.820921,1.137025,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0.820921,1.137025,0,
-	0,0,-1,0.859768,1.072211,0,
-	-0.56911,-0.822262,0,1.072211,0.859768,3,
-	-0.621651,-0.783294,0,1.011517,0.904782,1.5,
-	-0.541882,-0.840455,0,1.072211,0.859768,1.5,
-	-0.621651,-0.783294,0,1.011517,0.904782,1.5,
-	-0.56911,-0.822262,0,1.072211,0.859768,3,
-	-0.646965,-0.76252,0,1.011517,0.904782,3,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.179079,1.862975,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,2.179079,1.862975,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,2.211387,1.794666,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	-1,0,0,1.5,3,3,
-	-1,0,0,1.5,2.27,1.5,
-	-1,0,0,1.5,2.27,3,
-	-1,0,0,1.5,2.27,1.5,
-	-1,0,0,1.5,3,3,
-	-1,0,0,1.5,2.27,0,
-	-1,0,0,1.5,2.27,0,
-	-1,0,0,1.5,3,3,
-	-1,0,0,1.5,3,0,
-	-0.408248,0.408248,-0.816497,1.5,3,0,
-	-0.727607,0.485071,0.485071,1.5,3,3,
-	0,1,0,1.5,3,2.795,
-	-0.408248,0.408248,-0.816497,1.5,3,0,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,0.205,
-	-0.998795,0.049068,0,2.27,1.5,1.5,
-	-0.996656,0.081709,0,2.266292,1.424527,0,
-	-0.993446,0.114299,0,2.266292,1.424527,1.5,
-	-0.996656,0.081709,0,2.266292,1.424527,0,
-	-0.998795,0.049068,0,2.27,1.5,1.5,
-	-0.998795,0.049068,0,2.27,1.5,0,
-	-0.952059,0.305914,0,2.236844,1.276481,1.5,
-	-0.941544,0.33689,0,2.211387,1.205334,0,
-	-0.941544,0.33689,0,2.211387,1.205334,1.5,
-	-0.941544,0.33689,0,2.211387,1.205334,0,
-	-0.952059,0.305914,0,2.236844,1.276481,1.5,
-	-0.961565,0.274577,0,2.236844,1.276481,0,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,2.12132,0,2.795,
-	-0.92388,-0.382683,0,2.12132,0,3,
-	-0.92388,-0.382683,0,2.12132,0,2.795,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,2.12132,0,2.17368,
-	-0.92388,-0.382683,0,2.12132,0,2.17368,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,2.12132,0,0.82632,
-	-0.92388,-0.382683,0,2.12132,0,0.82632,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,2.12132,0,0.205,
-	-0.92388,-0.382683,0,2.12132,0,0.205,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,2.12132,0,0,
-	-0.92388,-0.382683,0,2.12132,0,0,
-	-0.92388,-0.382683,0,1.794666,0.788613,3,
-	-0.92388,-0.382683,0,1.794666,0.788613,0,
-	-0.767794,0.296171,-0.568133,1.794666,0.788613,0,
-	-0.446575,-0.504521,0.738938,1.794666,0.788613,3,
-	0.066046,0.203371,-0.976872,1.794666,0.788613,1.5,
-	-0.646965,-0.76252,0,1.011517,0.904782,3,
-	-0.671559,-0.740951,0,0.955528,0.955528,1.5,
-	-0.621651,-0.783294,0,1.011517,0.904782,1.5,
-	-0.671559,-0.740951,0,0.955528,0.955528,1.5,
-	-0.646965,-0.76252,0,1.011517,0.904782,3,
-	-0.671559,-0.740951,0,0.955528,0.955528,3,
-	0.874085,-0.485774,0,2.179079,1.137025,1.5,
-	0.840455,-0.541882,0,2.140232,1.072211,3,
-	0.822262,-0.56911,0,2.140232,1.072211,1.5,
-	0.840455,-0.541882,0,2.140232,1.072211,3,
-	0.874085,-0.485774,0,2.179079,1.137025,1.5,
-	0.889521,-0.456893,0,2.179079,1.137025,3,
-	0.92388,-0.382683,0,2.12132,3,0,
-	0.92388,-0.382683,0,1.794666,2.211387,1.5,
-	0.92388,-0.382683,0,1.794666,2.211387,0,
-	0.92388,-0.382683,0,1.794666,2.211387,1.5,
-	0.92388,-0.382683,0,2.12132,3,0,
-	0.92388,-0.382683,0,1.794666,2.211387,3,
-	0.92388,-0.382683,0,1.794666,2.211387,3,
-	0.92388,-0.382683,0,2.12132,3,0,
-	0.92388,-0.382683,0,2.12132,3,3,
-	0.618034,0.412957,0.668955,2.12132,3,3,
-	0.903634,0.27776,-0.326029,2.12132,3,0,
-	0,1,0,2.12132,3,0.205,
-	0.618034,0.412957,0.668955,2.12132,3,3,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,2.12132,3,0.82632,
-	0.618034,0.412957,0.668955,2.12132,3,3,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.12132,3,2.17368,
-	0.618034,0.412957,0.668955,2.12132,3,3,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,2.12132,3,2.795,
-	-0.740951,-0.671559,0,2.044472,2.044472,1.5,
-	-0.76252,-0.646965,0,2.095218,1.988483,0,
-	-0.783294,-0.621651,0,2.095218,1.988483,1.5,
-	-0.76252,-0.646965,0,2.095218,1.988483,0,
-	-0.740951,-0.671559,0,2.044472,2.044472,1.5,
-	-0.740951,-0.671559,0,2.044472,2.044472,0,
-	-0.33689,0.941544,0,1.205334,2.211387,3,
-	-0.305914,0.952059,0,1.276481,2.236844,1.5,
-	-0.33689,0.941544,0,1.205334,2.211387,1.5,
-	-0.305914,0.952059,0,1.276481,2.236844,1.5,
-	-0.33689,0.941544,0,1.205334,2.211387,3,
-	-0.274577,0.961565,0,1.276481,2.236844,3,
-	0.941544,0.33689,0,2.211387,1.794666,1.5,
-	0.952059,0.305914,0,2.236844,1.723519,3,
-	0.961565,0.274577,0,2.236844,1.723519,1.5,
-	0.952059,0.305914,0,2.236844,1.723519,3,
-	0.941544,0.33689,0,2.211387,1.794666,1.5,
-	0.941544,0.33689,0,2.211387,1.794666,3,
-	0.081709,-0.996656,0,1.575473,0.733708,3,
-	0.049068,-0.998795,0,1.5,0.73,1.5,
-	0.114299,-0.993446,0,1.575473,0.733708,1.5,
-	0.049068,-0.998795,0,1.5,0.73,1.5,
-	0.081709,-0.996656,0,1.575473,0.733708,3,
-	0.049068,-0.998795,0,1.5,0.73,3,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.707107,0.707107,0,3,0,0,
-	0.707107,0.707107,0,2.044472,0.955528,0,
-	0.707107,0.707107,0,3,0,0,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.707107,0.707107,0,3,0,0.205,
-	0.707107,0.707107,0,3,0,0.205,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.707107,0.707107,0,3,0,1.5,
-	0.707107,0.707107,0,3,0,1.5,
-	0.707107,0.707107,0,2.044472,0.955528,1.5,
-	0.707107,0.707107,0,2.044472,0.955528,3,
-	0.707107,0.707107,0,3,0,1.5,
-	0.707107,0.707107,0,2.044472,0.955528,3,
-	0.707107,0.707107,0,3,0,2.795,
-	0.707107,0.707107,0,3,0,2.795,
-	0.707107,0.707107,0,2.044472,0.955528,3,
-	0.707107,0.707107,0,3,0,3,
-	-0.783294,-0.621651,0,2.095218,1.988483,1.5,
-	-0.822262,-0.56911,0,2.140232,1.927789,0,
-	-0.840455,-0.541882,0,2.140232,1.927789,1.5,
-	-0.822262,-0.56911,0,2.140232,1.927789,0,
-	-0.783294,-0.621651,0,2.095218,1.988483,1.5,
-	-0.76252,-0.646965,0,2.095218,1.988483,0,
-	0.983848,0.179005,0,2.255205,1.65022,1.5,
-	0.993446,0.114299,0,2.266292,1.575473,3,
-	0.996656,0.081709,0,2.266292,1.575473,1.5,
-	0.993446,0.114299,0,2.266292,1.575473,3,
-	0.983848,0.179005,0,2.255205,1.65022,1.5,
-	0.97746,0.211123,0,2.255205,1.65022,3,
-	0.33689,0.941544,0,1.205334,0.788613,1.5,
-	0.305914,0.952059,0,1.276481,0.763156,0,
-	0.33689,0.941544,0,1.205334,0.788613,0,
-	0.305914,0.952059,0,1.276481,0.763156,0,
-	0.33689,0.941544,0,1.205334,0.788613,1.5,
-	0.274577,0.961565,0,1.276481,0.763156,1.5,
-	-0.179005,-0.983848,0,1.65022,2.255205,1.5,
-	-0.114299,-0.993446,0,1.575473,2.266292,0,
-	-0.211123,-0.97746,0,1.65022,2.255205,0,
-	-0.114299,-0.993446,0,1.575473,2.266292,0,
-	-0.179005,-0.983848,0,1.65022,2.255205,1.5,
-	-0.081709,-0.996656,0,1.575473,2.266292,1.5,
-	-0.274577,-0.961565,0,1.723519,2.236844,1.5,
-	-0.211123,-0.97746,0,1.65022,2.255205,0,
-	-0.305914,-0.952059,0,1.723519,2.236844,0,
-	-0.211123,-0.97746,0,1.65022,2.255205,0,
-	-0.274577,-0.961565,0,1.723519,2.236844,1.5,
-	-0.179005,-0.983848,0,1.65022,2.255205,1.5,
-	-0.081709,-0.996656,0,1.575473,2.266292,1.5,
-	-0.049068,-0.998795,0,1.5,2.27,0,
-	-0.114299,-0.993446,0,1.575473,2.266292,0,
-	-0.049068,-0.998795,0,1.5,2.27,0,
-	-0.081709,-0.996656,0,1.575473,2.266292,1.5,
-	-0.049068,-0.998795,0,1.5,2.27,1.5,
-	0.76252,0.646965,0,0.904782,1.011517,0,
-	0.740951,0.671559,0,0.955528,0.955528,1.5,
-	0.740951,0.671559,0,0.955528,0.955528,0,
-	0.740951,0.671559,0,0.955528,0.955528,1.5,
-	0.76252,0.646965,0,0.904782,1.011517,0,
-	0.783294,0.621651,0,0.904782,1.011517,1.5,
-	-0.889521,0.456893,0,0.820921,1.862975,3,
-	-0.903989,0.427555,0,0.788613,1.794666,1.5,
-	-0.903989,0.427555,0,0.788613,1.794666,3,
-	-0.903989,0.427555,0,0.788613,1.794666,1.5,
-	-0.889521,0.456893,0,0.820921,1.862975,3,
-	-0.874085,0.485774,0,0.820921,1.862975,1.5,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,1.798369,0,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.12132,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.723519,2.236844,0,
-	0,0,-1,1.65022,2.255205,0,
-	0,0,-1,1.723519,2.236844,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.794666,2.211387,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.862975,0.820921,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.794666,0.788613,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.862975,0.820921,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,2.502268,0,0,
-	-0.382683,0.92388,0,0,0.87868,3,
-	-0.382683,0.92388,0,0.788613,1.205334,0,
-	-0.382683,0.92388,0,0,0.87868,0,
-	-0.382683,0.92388,0,0.788613,1.205334,0,
-	-0.382683,0.92388,0,0,0.87868,3,
-	-0.382683,0.92388,0,0.788613,1.205334,1.5,
-	-0.382683,0.92388,0,0.788613,1.205334,1.5,
-	-0.382683,0.92388,0,0,0.87868,3,
-	-0.382683,0.92388,0,0.788613,1.205334,3,
-	0,-1,0,0.73,1.5,1.5,
-	0,-1,0,0,1.5,0,
-	0,-1,0,0.73,1.5,0,
-	0,-1,0,0,1.5,0,
-	0,-1,0,0.73,1.5,1.5,
-	0,-1,0,0,1.5,3,
-	0,-1,0,0,1.5,3,
-	0,-1,0,0.73,1.5,1.5,
-	0,-1,0,0.73,1.5,3,
-	-0.707107,0.707107,0,2.044472,2.044472,1.5,
-	-0.707107,0.707107,0,3,3,0,
-	-0.707107,0.707107,0,2.044472,2.044472,0,
-	-0.707107,0.707107,0,3,3,0,
-	-0.707107,0.707107,0,2.044472,2.044472,1.5,
-	-0.707107,0.707107,0,3,3,3,
-	-0.707107,0.707107,0,3,3,3,
-	-0.707107,0.707107,0,2.044472,2.044472,1.5,
-	-0.707107,0.707107,0,2.044472,2.044472,3,
-	-0.382683,-0.92388,0,3,0.87868,3,
-	-0.382683,-0.92388,0,2.211387,1.205334,0,
-	-0.382683,-0.92388,0,3,0.87868,0,
-	-0.382683,-0.92388,0,2.211387,1.205334,0,
-	-0.382683,-0.92388,0,3,0.87868,3,
-	-0.382683,-0.92388,0,2.211387,1.205334,1.5,
-	-0.382683,-0.92388,0,2.211387,1.205334,1.5,
-	-0.382683,-0.92388,0,3,0.87868,3,
-	-0.382683,-0.92388,0,2.211387,1.205334,3,
-	-0.427555,-0.903989,0,1.205334,0.788613,3,
-	-0.456893,-0.889521,0,1.137025,0.820921,1.5,
-	-0.427555,-0.903989,0,1.205334,0.788613,1.5,
-	-0.456893,-0.889521,0,1.137025,0.820921,1.5,
-	-0.427555,-0.903989,0,1.205334,0.788613,3,
-	-0.485774,-0.874085,0,1.137025,0.820921,3,
-	0.92388,0.382683,0,0.87868,3,0,
-	0.92388,0.382683,0,1.205334,2.211387,1.5,
-	0.92388,0.382683,0,1.205334,2.211387,0,
-	0.92388,0.382683,0,1.205334,2.211387,1.5,
-	0.92388,0.382683,0,0.87868,3,0,
-	0.92388,0.382683,0,1.205334,2.211387,3,
-	0.92388,0.382683,0,1.205334,2.211387,3,
-	0.92388,0.382683,0,0.87868,3,0,
-	0.92388,0.382683,0,0.87868,3,3,
-	0.269347,0.403107,0.874618,0.87868,3,3,
-	0.537476,0.61047,-0.58176,0.87868,3,0,
-	0,1,0,0.87868,3,0.205,
-	0.269347,0.403107,0.874618,0.87868,3,3,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,0.87868,3,0.82632,
-	0.269347,0.403107,0.874618,0.87868,3,3,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,0.87868,3,2.17368,
-	0.269347,0.403107,0.874618,0.87868,3,3,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.87868,3,2.795,
-	-0.740951,0.671559,0,0.955528,2.044472,3,
-	-0.76252,0.646965,0,0.904782,1.988483,1.5,
-	-0.783294,0.621651,0,0.904782,1.988483,3,
-	-0.76252,0.646965,0,0.904782,1.988483,1.5,
-	-0.740951,0.671559,0,0.955528,2.044472,3,
-	-0.740951,0.671559,0,0.955528,2.044472,1.5,
-	-0.993446,-0.114299,0,0.733708,1.424527,3,
-	-0.983848,-0.179005,0,0.744795,1.34978,1.5,
-	-0.97746,-0.211123,0,0.744795,1.34978,3,
-	-0.983848,-0.179005,0,0.744795,1.34978,1.5,
-	-0.993446,-0.114299,0,0.733708,1.424527,3,
-	-0.996656,-0.081709,0,0.733708,1.424527,1.5,
-	-0.707107,-0.707107,0,0,3,3,
-	-0.707107,-0.707107,0,0.955528,2.044472,1.5,
-	-0.707107,-0.707107,0,0.955528,2.044472,3,
-	-0.707107,-0.707107,0,0.955528,2.044472,1.5,
-	-0.707107,-0.707107,0,0,3,3,
-	-0.707107,-0.707107,0,0.955528,2.044472,0,
-	-0.707107,-0.707107,0,0.955528,2.044472,0,
-	-0.707107,-0.707107,0,0,3,3,
-	-0.707107,-0.707107,0,0,3,0,
-	-0.561517,0.232588,-0.794104,0,3,0,
-	-0.903326,-0.051662,0.425832,0,3,3,
-	0,1,0,0,3,2.795,
-	-0.561517,0.232588,-0.794104,0,3,0,
-	0,1,0,0,3,2.795,
-	0,1,0,0,3,1.5,
-	-0.561517,0.232588,-0.794104,0,3,0,
-	0,1,0,0,3,1.5,
-	0,1,0,0,3,0.205,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,2.095218,1.988483,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,2.095218,1.988483,1.5,
-	0,0,-1,2.140232,1.927789,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,2.140232,1.927789,1.5,
-	0,0,-1,2.179079,1.862975,1.5,
-	0.274577,-0.961565,0,1.723519,0.763156,3,
-	0.211123,-0.97746,0,1.65022,0.744795,1.5,
-	0.305914,-0.952059,0,1.723519,0.763156,1.5,
-	0.211123,-0.97746,0,1.65022,0.744795,1.5,
-	0.274577,-0.961565,0,1.723519,0.763156,3,
-	0.179005,-0.983848,0,1.65022,0.744795,3,
-	0.874085,0.485774,0,0.820921,1.137025,0,
-	0.840455,0.541882,0,0.859768,1.072211,1.5,
-	0.822262,0.56911,0,0.859768,1.072211,0,
-	0.840455,0.541882,0,0.859768,1.072211,1.5,
-	0.874085,0.485774,0,0.820921,1.137025,0,
-	0.889521,0.456893,0,0.820921,1.137025,1.5,
-	0.822262,-0.56911,0,2.140232,1.072211,1.5,
-	0.783294,-0.621651,0,2.095218,1.011517,3,
-	0.76252,-0.646965,0,2.095218,1.011517,1.5,
-	0.783294,-0.621651,0,2.095218,1.011517,3,
-	0.822262,-0.56911,0,2.140232,1.072211,1.5,
-	0.840455,-0.541882,0,2.140232,1.072211,3,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.072211,2.140232,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.072211,2.140232,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.137025,2.179079,0,
-	0,0,-1,1.137025,2.179079,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.205334,2.211387,0,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.87868,0,2.17368,
-	1,0,0,1.5,0.73,0,
-	1,0,0,1.5,0,0.205,
-	1,0,0,1.5,0,0,
-	1,0,0,1.5,0,0.205,
-	1,0,0,1.5,0.73,0,
-	1,0,0,1.5,0,2.795,
-	1,0,0,1.5,0,2.795,
-	1,0,0,1.5,0.73,0,
-	1,0,0,1.5,0,3,
-	1,0,0,1.5,0,3,
-	1,0,0,1.5,0.73,0,
-	1,0,0,1.5,0.73,3,
-	0.694147,-0.227384,0.682976,1.5,0.73,3,
-	0.878025,0.427983,-0.21425,1.5,0.73,0,
-	0.341066,-0.296944,-0.891907,1.5,0.73,1.5,
-	-0.993446,0.114299,0,2.266292,1.424527,1.5,
-	-0.983848,0.179005,0,2.255205,1.34978,0,
-	-0.97746,0.211123,0,2.255205,1.34978,1.5,
-	-0.983848,0.179005,0,2.255205,1.34978,0,
-	-0.993446,0.114299,0,2.266292,1.424527,1.5,
-	-0.996656,0.081709,0,2.266292,1.424527,0,
-	0.961565,0.274577,0,2.236844,1.723519,1.5,
-	0.97746,0.211123,0,2.255205,1.65022,3,
-	0.983848,0.179005,0,2.255205,1.65022,1.5,
-	0.97746,0.211123,0,2.255205,1.65022,3,
-	0.961565,0.274577,0,2.236844,1.723519,1.5,
-	0.952059,0.305914,0,2.236844,1.723519,3,
-	-0.274577,0.961565,0,1.276481,2.236844,3,
-	-0.211123,0.97746,0,1.34978,2.255205,1.5,
-	-0.305914,0.952059,0,1.276481,2.236844,1.5,
-	-0.211123,0.97746,0,1.34978,2.255205,1.5,
-	-0.274577,0.961565,0,1.276481,2.236844,3,
-	-0.179005,0.983848,0,1.34978,2.255205,3,
-	0.903989,-0.427555,0,2.211387,1.205334,1.5,
-	0.889521,-0.456893,0,2.179079,1.137025,3,
-	0.874085,-0.485774,0,2.179079,1.137025,1.5,
-	0.889521,-0.456893,0,2.179079,1.137025,3,
-	0.903989,-0.427555,0,2.211387,1.205334,1.5,
-	0.903989,-0.427555,0,2.211387,1.205334,3,
-	0.646965,0.76252,0,1.988483,2.095218,3,
-	0.671559,0.740951,0,2.044472,2.044472,1.5,
-	0.621651,0.783294,0,1.988483,2.095218,1.5,
-	0.671559,0.740951,0,2.044472,2.044472,1.5,
-	0.646965,0.76252,0,1.988483,2.095218,3,
-	0.671559,0.740951,0,2.044472,2.044472,3,
-	-0.081709,0.996656,0,1.424527,2.266292,3,
-	-0.049068,0.998795,0,1.5,2.27,1.5,
-	-0.114299,0.993446,0,1.424527,2.266292,1.5,
-	-0.049068,0.998795,0,1.5,2.27,1.5,
-	-0.081709,0.996656,0,1.424527,2.266292,3,
-	-0.049068,0.998795,0,1.5,2.27,3,
-	0.427555,0.903989,0,1.794666,2.211387,3,
-	0.456893,0.889521,0,1.862975,2.179079,1.5,
-	0.427555,0.903989,0,1.794666,2.211387,1.5,
-	0.456893,0.889521,0,1.862975,2.179079,1.5,
-	0.427555,0.903989,0,1.794666,2.211387,3,
-	0.485774,0.874085,0,1.862975,2.179079,3,
-	0,1,0,2.27,1.5,1.5,
-	0,1,0,3,1.5,0,
-	0,1,0,2.27,1.5,0,
-	0,1,0,3,1.5,0,
-	0,1,0,2.27,1.5,1.5,
-	0,1,0,3,1.5,3,
-	0,1,0,3,1.5,3,
-	0,1,0,2.27,1.5,1.5,
-	0,1,0,2.27,1.5,3,
-	0.996656,-0.081709,0,0.733708,1.575473,0,
-	0.998795,-0.049068,0,0.73,1.5,1.5,
-	0.998795,-0.049068,0,0.73,1.5,0,
-	0.998795,-0.049068,0,0.73,1.5,1.5,
-	0.996656,-0.081709,0,0.733708,1.575473,0,
-	0.993446,-0.114299,0,0.733708,1.575473,1.5,
-	-0.840455,0.541882,0,0.859768,1.927789,3,
-	-0.874085,0.485774,0,0.820921,1.862975,1.5,
-	-0.889521,0.456893,0,0.820921,1.862975,3,
-	-0.874085,0.485774,0,0.820921,1.862975,1.5,
-	-0.840455,0.541882,0,0.859768,1.927789,3,
-	-0.822262,0.56911,0,0.859768,1.927789,1.5,
-	-0.998795,-0.049068,0,0.73,1.5,3,
-	-0.996656,-0.081709,0,0.733708,1.424527,1.5,
-	-0.993446,-0.114299,0,0.733708,1.424527,3,
-	-0.996656,-0.081709,0,0.733708,1.424527,1.5,
-	-0.998795,-0.049068,0,0.73,1.5,3,
-	-0.998795,-0.049068,0,0.73,1.5,1.5,
-	-0.97746,-0.211123,0,0.744795,1.34978,3,
-	-0.961565,-0.274577,0,0.763156,1.276481,1.5,
-	-0.952059,-0.305914,0,0.763156,1.276481,3,
-	-0.961565,-0.274577,0,0.763156,1.276481,1.5,
-	-0.97746,-0.211123,0,0.744795,1.34978,3,
-	-0.983848,-0.179005,0,0.744795,1.34978,1.5,
-	0.961565,-0.274577,0,0.763156,1.723519,0,
-	0.97746,-0.211123,0,0.744795,1.65022,1.5,
-	0.983848,-0.179005,0,0.744795,1.65022,0,
-	0.97746,-0.211123,0,0.744795,1.65022,1.5,
-	0.961565,-0.274577,0,0.763156,1.723519,0,
-	0.952059,-0.305914,0,0.763156,1.723519,1.5,
-	0.33689,-0.941544,0,1.794666,0.788613,3,
-	0.305914,-0.952059,0,1.723519,0.763156,1.5,
-	0.33689,-0.941544,0,1.794666,0.788613,1.5,
-	0.305914,-0.952059,0,1.723519,0.763156,1.5,
-	0.33689,-0.941544,0,1.794666,0.788613,3,
-	0.274577,-0.961565,0,1.723519,0.763156,3,
-	0.707107,-0.707107,0,0.955528,0.955528,0,
-	0.707107,-0.707107,0,0,0,3,
-	0.707107,-0.707107,0,0,0,0,
-	0.707107,-0.707107,0,0,0,3,
-	0.707107,-0.707107,0,0.955528,0.955528,0,
-	0.707107,-0.707107,0,0.955528,0.955528,3,
-	0.282725,-0.558186,0.780061,0.955528,0.955528,3,
-	0.865795,-0.298347,-0.401731,0.955528,0.955528,0,
-	0.362971,-0.362971,-0.858198,0.955528,0.955528,1.5,
-	0.646965,-0.76252,0,1.011517,2.095218,1.5,
-	0.671559,-0.740951,0,0.955528,2.044472,0,
-	0.621651,-0.783294,0,1.011517,2.095218,0,
-	0.671559,-0.740951,0,0.955528,2.044472,0,
-	0.646965,-0.76252,0,1.011517,2.095218,1.5,
-	0.671559,-0.740951,0,0.955528,2.044472,1.5,
-	-0.485774,0.874085,0,1.862975,0.820921,1.5,
-	-0.541882,0.840455,0,1.927789,0.859768,0,
-	-0.456893,0.889521,0,1.862975,0.820921,0,
-	-0.541882,0.840455,0,1.927789,0.859768,0,
-	-0.485774,0.874085,0,1.862975,0.820921,1.5,
-	-0.56911,0.822262,0,1.927789,0.859768,1.5,
-	-0.97746,0.211123,0,2.255205,1.34978,1.5,
-	-0.961565,0.274577,0,2.236844,1.276481,0,
-	-0.952059,0.305914,0,2.236844,1.276481,1.5,
-	-0.961565,0.274577,0,2.236844,1.276481,0,
-	-0.97746,0.211123,0,2.255205,1.34978,1.5,
-	-0.983848,0.179005,0,2.255205,1.34978,0,
-	-0.427555,0.903989,0,1.794666,0.788613,1.5,
-	-0.456893,0.889521,0,1.862975,0.820921,0,
-	-0.427555,0.903989,0,1.794666,0.788613,0,
-	-0.456893,0.889521,0,1.862975,0.820921,0,
-	-0.427555,0.903989,0,1.794666,0.788613,1.5,
-	-0.485774,0.874085,0,1.862975,0.820921,1.5,
-	0.081709,0.996656,0,1.424527,0.733708,1.5,
-	0.049068,0.998795,0,1.5,0.73,0,
-	0.114299,0.993446,0,1.424527,0.733708,0,
-	0.049068,0.998795,0,1.5,0.73,0,
-	0.081709,0.996656,0,1.424527,0.733708,1.5,
-	0.049068,0.998795,0,1.5,0.73,1.5,
-	-0.485774,-0.874085,0,1.137025,0.820921,3,
-	-0.541882,-0.840455,0,1.072211,0.859768,1.5,
-	-0.456893,-0.889521,0,1.137025,0.820921,1.5,
-	-0.541882,-0.840455,0,1.072211,0.859768,1.5,
-	-0.485774,-0.874085,0,1.137025,0.820921,3,
-	-0.56911,-0.822262,0,1.072211,0.859768,3,
-	0.485774,-0.874085,0,1.137025,2.179079,1.5,
-	0.541882,-0.840455,0,1.072211,2.140232,0,
-	0.456893,-0.889521,0,1.137025,2.179079,0,
-	0.541882,-0.840455,0,1.072211,2.140232,0,
-	0.485774,-0.874085,0,1.137025,2.179079,1.5,
-	0.56911,-0.822262,0,1.072211,2.140232,1.5,
-	-0.92388,0.382683,0,0.87868,0,0.205,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,0,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,0.205,
-	-0.92388,0.382683,0,0.87868,0,0.82632,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,0.82632,
-	-0.92388,0.382683,0,0.87868,0,2.17368,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,2.17368,
-	-0.92388,0.382683,0,0.87868,0,2.795,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,2.795,
-	-0.92388,0.382683,0,0.87868,0,3,
-	-0.92388,0.382683,0,1.205334,0.788613,0,
-	-0.92388,0.382683,0,0.87868,0,3,
-	-0.92388,0.382683,0,1.205334,0.788613,3,
-	-0.807325,0.502043,-0.310129,1.205334,0.788613,0,
-	0.015077,-0.480291,0.876979,1.205334,0.788613,3,
-	0.489038,0.249268,-0.835887,1.205334,0.788613,1.5,
-	0.76252,-0.646965,0,2.095218,1.011517,1.5,
-	0.740951,-0.671559,0,2.044472,0.955528,3,
-	0.740951,-0.671559,0,2.044472,0.955528,1.5,
-	0.740951,-0.671559,0,2.044472,0.955528,3,
-	0.76252,-0.646965,0,2.095218,1.011517,1.5,
-	0.783294,-0.621651,0,2.095218,1.011517,3,
-	0.485774,0.874085,0,1.862975,2.179079,3,
-	0.541882,0.840455,0,1.927789,2.140232,1.5,
-	0.456893,0.889521,0,1.862975,2.179079,1.5,
-	0.541882,0.840455,0,1.927789,2.140232,1.5,
-	0.485774,0.874085,0,1.862975,2.179079,3,
-	0.56911,0.822262,0,1.927789,2.140232,3,
-	0.382683,-0.92388,0,3,2.12132,3,
-	0.382683,-0.92388,0,2.211387,1.794666,0,
-	0.382683,-0.92388,0,3,2.12132,0,
-	0.382683,-0.92388,0,2.211387,1.794666,0,
-	0.382683,-0.92388,0,3,2.12132,3,
-	0.382683,-0.92388,0,2.211387,1.794666,1.5,
-	0.382683,-0.92388,0,2.211387,1.794666,1.5,
-	0.382683,-0.92388,0,3,2.12132,3,
-	0.382683,-0.92388,0,2.211387,1.794666,3,
-	0.179005,-0.983848,0,1.65022,0.744795,3,
-	0.114299,-0.993446,0,1.575473,0.733708,1.5,
-	0.211123,-0.97746,0,1.65022,0.744795,1.5,
-	0.114299,-0.993446,0,1.575473,0.733708,1.5,
-	0.179005,-0.983848,0,1.65022,0.744795,3,
-	0.081709,-0.996656,0,1.575473,0.733708,3,
-	-0.952059,-0.305914,0,0.763156,1.276481,3,
-	-0.941544,-0.33689,0,0.788613,1.205334,1.5,
-	-0.941544,-0.33689,0,0.788613,1.205334,3,
-	-0.941544,-0.33689,0,0.788613,1.205334,1.5,
-	-0.952059,-0.305914,0,0.763156,1.276481,3,
-	-0.961565,-0.274577,0,0.763156,1.276481,1.5,
-	0.274577,0.961565,0,1.276481,0.763156,1.5,
-	0.211123,0.97746,0,1.34978,0.744795,0,
-	0.305914,0.952059,0,1.276481,0.763156,0,
-	0.211123,0.97746,0,1.34978,0.744795,0,
-	0.274577,0.961565,0,1.276481,0.763156,1.5,
-	0.179005,0.983848,0,1.34978,0.744795,1.5,
-	0.996656,0.081709,0,2.266292,1.575473,1.5,
-	0.998795,0.049068,0,2.27,1.5,3,
-	0.998795,0.049068,0,2.27,1.5,1.5,
-	0.998795,0.049068,0,2.27,1.5,3,
-	0.996656,0.081709,0,2.266292,1.575473,1.5,
-	0.993446,0.114299,0,2.266292,1.575473,3,
-	0.983848,-0.179005,0,0.744795,1.65022,0,
-	0.993446,-0.114299,0,0.733708,1.575473,1.5,
-	0.996656,-0.081709,0,0.733708,1.575473,0,
-	0.993446,-0.114299,0,0.733708,1.575473,1.5,
-	0.983848,-0.179005,0,0.744795,1.65022,0,
-	0.97746,-0.211123,0,0.744795,1.65022,1.5,
-	0.903989,0.427555,0,0.788613,1.205334,0,
-	0.889521,0.456893,0,0.820921,1.137025,1.5,
-	0.874085,0.485774,0,0.820921,1.137025,0,
-	0.889521,0.456893,0,0.820921,1.137025,1.5,
-	0.903989,0.427555,0,0.788613,1.205334,0,
-	0.903989,0.427555,0,0.788613,1.205334,1.5,
-	0.427555,-0.903989,0,1.205334,2.211387,1.5,
-	0.456893,-0.889521,0,1.137025,2.179079,0,
-	0.427555,-0.903989,0,1.205334,2.211387,0,
-	0.456893,-0.889521,0,1.137025,2.179079,0,
-	0.427555,-0.903989,0,1.205334,2.211387,1.5,
-	0.485774,-0.874085,0,1.137025,2.179079,1.5,
-	-0.33689,-0.941544,0,1.794666,2.211387,1.5,
-	-0.305914,-0.952059,0,1.723519,2.236844,0,
-	-0.33689,-0.941544,0,1.794666,2.211387,0,
-	-0.305914,-0.952059,0,1.723519,2.236844,0,
-	-0.33689,-0.941544,0,1.794666,2.211387,1.5,
-	-0.274577,-0.961565,0,1.723519,2.236844,1.5,
-	-0.889521,-0.456893,0,2.179079,1.862975,1.5,
-	-0.903989,-0.427555,0,2.211387,1.794666,0,
-	-0.903989,-0.427555,0,2.211387,1.794666,1.5,
-	-0.903989,-0.427555,0,2.211387,1.794666,0,
-	-0.889521,-0.456893,0,2.179079,1.862975,1.5,
-	-0.874085,-0.485774,0,2.179079,1.862975,0,
-	-0.56911,0.822262,0,1.927789,0.859768,1.5,
-	-0.621651,0.783294,0,1.988483,0.904782,0,
-	-0.541882,0.840455,0,1.927789,0.859768,0,
-	-0.621651,0.783294,0,1.988483,0.904782,0,
-	-0.56911,0.822262,0,1.927789,0.859768,1.5,
-	-0.646965,0.76252,0,1.988483,0.904782,1.5,
-	0.56911,-0.822262,0,1.072211,2.140232,1.5,
-	0.621651,-0.783294,0,1.011517,2.095218,0,
-	0.541882,-0.840455,0,1.072211,2.140232,0,
-	0.621651,-0.783294,0,1.011517,2.095218,0,
-	0.56911,-0.822262,0,1.072211,2.140232,1.5,
-	0.646965,-0.76252,0,1.011517,2.095218,1.5,
-	0.179005,0.983848,0,1.34978,0.744795,1.5,
-	0.114299,0.993446,0,1.424527,0.733708,0,
-	0.211123,0.97746,0,1.34978,0.744795,0,
-	0.114299,0.993446,0,1.424527,0.733708,0,
-	0.179005,0.983848,0,1.34978,0.744795,1.5,
-	0.081709,0.996656,0,1.424527,0.733708,1.5,
-	0.56911,0.822262,0,1.927789,2.140232,3,
-	0.621651,0.783294,0,1.988483,2.095218,1.5,
-	0.541882,0.840455,0,1.927789,2.140232,1.5,
-	0.621651,0.783294,0,1.988483,2.095218,1.5,
-	0.56911,0.822262,0,1.927789,2.140232,3,
-	0.646965,0.76252,0,1.988483,2.095218,3,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.5,3,
-	0.822262,0.56911,0,0.859768,1.072211,0,
-	0.783294,0.621651,0,0.904782,1.011517,1.5,
-	0.76252,0.646965,0,0.904782,1.011517,0,
-	0.783294,0.621651,0,0.904782,1.011517,1.5,
-	0.822262,0.56911,0,0.859768,1.072211,0,
-	0.840455,0.541882,0,0.859768,1.072211,1.5,
-	0.941544,-0.33689,0,0.788613,1.794666,0,
-	0.952059,-0.305914,0,0.763156,1.723519,1.5,
-	0.961565,-0.274577,0,0.763156,1.723519,0,
-	0.952059,-0.305914,0,0.763156,1.723519,1.5,
-	0.941544,-0.33689,0,0.788613,1.794666,0,
-	0.941544,-0.33689,0,0.788613,1.794666,1.5,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.788613,1.794666,0,
-	0,0,-1,0.763156,1.723519,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0.763156,1.723519,0,
-	0,0,-1,0.744795,1.65022,0,
-	0,0,-1,1.205334,0.788613,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,0.87868,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.205334,0.788613,0,
-	0,0,-1,1.276481,0.763156,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.276481,0.763156,0,
-	0,0,-1,1.34978,0.744795,0,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,1.5,3,0.205,
-	-0.783294,0.621651,0,0.904782,1.988483,3,
-	-0.822262,0.56911,0,0.859768,1.927789,1.5,
-	-0.840455,0.541882,0,0.859768,1.927789,3,
-	-0.822262,0.56911,0,0.859768,1.927789,1.5,
-	-0.783294,0.621651,0,0.904782,1.988483,3,
-	-0.76252,0.646965,0,0.904782,1.988483,1.5,
-	-0.179005,0.983848,0,1.34978,2.255205,3,
-	-0.114299,0.993446,0,1.424527,2.266292,1.5,
-	-0.211123,0.97746,0,1.34978,2.255205,1.5,
-	-0.114299,0.993446,0,1.424527,2.266292,1.5,
-	-0.179005,0.983848,0,1.34978,2.255205,3,
-	-0.081709,0.996656,0,1.424527,2.266292,3,
-	0.382683,0.92388,0,0,2.12132,3,
-	0.382683,0.92388,0,0.788613,1.794666,0,
-	0.382683,0.92388,0,0,2.12132,0,
-	0.382683,0.92388,0,0.788613,1.794666,0,
-	0.382683,0.92388,0,0,2.12132,3,
-	0.382683,0.92388,0,0.788613,1.794666,1.5,
-	0.382683,0.92388,0,0.788613,1.794666,1.5,
-	0.382683,0.92388,0,0,2.12132,3,
-	0.382683,0.92388,0,0.788613,1.794666,3,
-	-0.840455,-0.541882,0,2.140232,1.927789,1.5,
-	-0.874085,-0.485774,0,2.179079,1.862975,0,
-	-0.889521,-0.456893,0,2.179079,1.862975,1.5,
-	-0.874085,-0.485774,0,2.179079,1.862975,0,
-	-0.840455,-0.541882,0,2.140232,1.927789,1.5,
-	-0.822262,-0.56911,0,2.140232,1.927789,0,
-	-0.646965,0.76252,0,1.988483,0.904782,1.5,
-	-0.671559,0.740951,0,2.044472,0.955528,0,
-	-0.621651,0.783294,0,1.988483,0.904782,0,
-	-0.671559,0.740951,0,2.044472,0.955528,0,
-	-0.646965,0.76252,0,1.988483,0.904782,1.5,
-	-0.671559,0.740951,0,2.044472,0.955528,1.5,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.733708,1.575473,3,
-	0,0,1,0.73,1.5,3,
-	0,0,1,0.733708,1.575473,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.744795,1.65022,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.763156,1.723519,3,
-	0,0,1,0.744795,1.65022,3,
-	0,0,1,0.763156,1.723519,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,1.424527,0.733708,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.34978,0.744795,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.424527,0.733708,3,
-	0,0,1,1.5,0.73,3,
-	0,0,1,1.276481,0.763156,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.205334,0.788613,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.276481,0.763156,3,
-	0,0,1,1.34978,0.744795,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,2.179079,1.137025,3,
-	0,0,1,1.137025,0.820921,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.072211,0.859768,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.137025,0.820921,3,
-	0,0,1,1.205334,0.788613,3,
-	0,0,1,1.575473,0.733708,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,0.73,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.575473,0.733708,3,
-	0,0,1,1.65022,0.744795,3,
-	0,0,1,1.65022,0.744795,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.65022,0.744795,3,
-	0,0,1,1.723519,0.763156,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,0,0.87868,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.820921,1.137025,3,
-	0,0,1,0.820921,1.137025,3,
-	0,0,1,0,0.497732,3,
-	0,0,1,0.859768,1.072211,3,
-	0,0,1,0.904782,1.011517,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.859768,1.072211,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.904782,1.011517,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.820921,1.862975,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,0.820921,1.862975,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.859768,1.927789,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,2.236844,1.276481,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,1.988483,0.904782,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.236844,1.276481,3,
-	0,0,1,2.211387,1.205334,3,
-	0,0,1,2.236844,1.276481,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.205334,0.788613,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.205334,0.788613,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.276481,0.763156,3,
-	0,0,1,1.276481,0.763156,3,
-	0,0,1,1.201631,0,3,
-	0,0,1,1.34978,0.744795,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,2.236844,1.723519,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,2.179079,1.862975,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.255205,1.65022,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,2.266292,1.575473,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.862975,0.820921,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.862975,0.820921,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.723519,2.236844,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.65022,2.255205,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.723519,2.236844,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.424527,2.266292,3,
-	0,0,1,1.34978,2.255205,3,
-	0,0,1,1.424527,2.266292,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.27,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.276481,2.236844,3,
-	0,0,1,1.205334,2.211387,3,
-	0,0,1,1.276481,2.236844,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.34978,2.255205,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.575473,2.266292,3,
-	0,0,1,1.5,2.27,3,
-	0,0,1,1.575473,2.266292,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.65022,2.255205,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,1.65022,2.255205,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.65022,2.255205,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,1.723519,2.236844,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.794666,2.211387,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,1.862975,2.179079,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.137025,2.179079,3,
-	0,0,1,1.072211,2.140232,3,
-	0,0,1,1.137025,2.179079,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.205334,2.211387,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.011517,2.095218,3,
-	0,0,1,0.955528,2.044472,3,
-	0,0,1,1.011517,2.095218,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.072211,2.140232,3,
-	0,0,1,1.072211,2.140232,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.072211,2.140232,3,
-	0,0,1,1.137025,2.179079,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.137025,2.179079,3,
-	0,0,1,1.205334,2.211387,3,
-	0,0,1,0.733708,1.424527,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.73,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.733708,1.424527,3,
-	0,0,1,0.744795,1.34978,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.788613,1.794666,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.763156,1.723519,3,
-	0,0,1,0.763156,1.723519,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.744795,1.65022,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.927789,2.140232,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,1.988483,2.095218,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.27,1.5,3,
-	0,0,1,2.255205,1.34978,3,
-	0,0,1,2.266292,1.424527,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.927789,0.859768,3,
-	0,0,1,1.794666,0.788613,3,
-	0,0,1,1.862975,0.820921,3,
-	0,0,1,2.179079,1.862975,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.179079,1.862975,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.140232,1.072211,3,
-	0,0,1,2.044472,0.955528,3,
-	0,0,1,2.095218,1.011517,3,
-	0,0,1,0.820921,1.137025,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.820921,1.137025,3,
-	0,0,1,0.859768,1.072211,3,
-	0,0,1,1.011517,0.904782,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.955528,0.955528,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.011517,0.904782,3,
-	0,0,1,1.072211,0.859768,3,
-	0,0,1,0.763156,1.276481,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.744795,1.34978,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.763156,1.276481,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.044472,2.044472,3,
-	0,0,1,2.140232,1.927789,3,
-	0,0,1,2.095218,1.988483,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.904782,1.988483,3,
-	0,0,1,0.859768,1.927789,3,
-	0,0,1,0.904782,1.988483,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,0.955528,2.044472,3,
-	0,0,-1,3,3,0,
-	0,0,-1,2.095218,1.988483,0,
-	0,0,-1,2.044472,2.044472,0,
-	0,0,-1,2.095218,1.988483,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,2.140232,1.927789,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.575473,2.266292,0,
-	0,0,-1,1.5,2.27,0,
-	0,0,-1,1.575473,2.266292,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.575473,2.266292,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.65022,2.255205,0,
-	0,0,-1,2.266292,1.424527,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.255205,1.34978,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.266292,1.424527,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.27,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,1.34978,0.744795,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.201631,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.34978,0.744795,0,
-	0,0,-1,1.424527,0.733708,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.424527,0.733708,0,
-	0,0,-1,1.5,0.73,0,
-	0,0,-1,1.988483,0.904782,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.927789,0.859768,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.988483,0.904782,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.044472,0.955528,0,
-	0,0,-1,3,0,0,
-	0,-0.447214,-0.894427,2.502268,0,0,
-	0.794104,0.232588,-0.561517,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,0,-1,0.744795,1.65022,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,1.798369,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.744795,1.65022,0,
-	0,0,-1,0.733708,1.575473,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.733708,1.575473,0,
-	0,0,-1,0.73,1.5,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.955528,2.044472,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.011517,2.095218,0,
-	0,0,-1,1.011517,2.095218,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,1.072211,2.140232,0,
-	0,0,-1,0.859768,1.072211,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0.497732,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.859768,1.072211,0,
-	0,0,-1,0.904782,1.011517,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.904782,1.011517,0,
-	0,0,-1,0.955528,0.955528,0,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.12132,0,2.17368,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.12132,0,2.17368,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.12132,0,2.795,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.12132,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.12132,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.12132,0,3,
-	-0.269347,-0.403107,0.874618,2.12132,0,3,
-	0,-1,0,2.795,0,3,
-	0,0,1,2.502268,0,3,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,2.12132,0,0.205,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.12132,0,0.82632,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.201631,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,0.87868,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.87868,0,0.205,
-	0,-1,0,0.87868,0,2.795,
-	0,-1,0,0.87868,0,2.17368,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.87868,0,0.82632,
-	0,-1,0,0.87868,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,3,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.87868,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.87868,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.87868,0,3,
-	0,0,1,0.87868,0,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.201631,0,3,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0.205,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0.82632,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.12132,3,2.17368,
-	0,1,0,1.5,3,3,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.12132,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.12132,3,3,
-	0.618034,0.412957,0.668955,2.12132,3,3,
-	-0.727607,0.485071,0.485071,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0.205,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.87868,3,0.82632,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,0.87868,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.87868,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,0.87868,3,3,
-	0.269347,0.403107,0.874618,0.87868,3,3,
-	0,0.83205,0.5547,0.205,3,3,
-	0,0,1,0.497732,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.87868,3,2.17368,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.87868,3,2.795,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.87868,3,0.205,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,2.095218,1.011517,1.5,
-	0,0,-1,2.095218,1.011517,1.5,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,2.140232,1.072211,1.5,
-	0,0,-1,2.140232,1.072211,1.5,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,2.179079,1.137025,1.5,
-	0.382683,0.92388,0,0.788613,1.794666,3,
-	0.382683,0.92388,0,1.5,1.5,1.5,
-	0.382683,0.92388,0,0.788613,1.794666,1.5,
-	0.382683,0.92388,0,1.5,1.5,1.5,
-	0.382683,0.92388,0,0.788613,1.794666,3,
-	0.382683,0.92388,0,2.211387,1.205334,1.5,
-	0.382683,0.92388,0,2.211387,1.205334,1.5,
-	0.382683,0.92388,0,0.788613,1.794666,3,
-	0.382683,0.92388,0,2.211387,1.205334,3,
-	0,0,-1,2.211387,1.205334,3,
-	0,0,-1,0.788613,1.794666,3,
-	0,0,-1,1.5,1.5,3,
-	0,0,-1,1.276481,2.236844,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.205334,2.211387,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.276481,2.236844,1.5,
-	0,0,-1,1.34978,2.255205,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.34978,2.255205,1.5,
-	0,0,-1,1.424527,2.266292,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.424527,2.266292,1.5,
-	0,0,-1,1.5,2.27,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.733708,1.424527,1.5,
-	0,0,-1,0.73,1.5,1.5,
-	0,0,-1,0.733708,1.424527,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.744795,1.34978,1.5,
-	0,0,-1,0.744795,1.34978,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.763156,1.276481,1.5,
-	0,0,-1,0.763156,1.276481,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.788613,1.205334,1.5,
-	0.92388,-0.382683,0,1.5,1.5,1.5,
-	0.92388,-0.382683,0,1.205334,0.788613,3,
-	0.92388,-0.382683,0,1.205334,0.788613,1.5,
-	0.92388,-0.382683,0,1.205334,0.788613,3,
-	0.92388,-0.382683,0,1.5,1.5,1.5,
-	0.92388,-0.382683,0,1.5,1.5,3,
-	0.92388,-0.382683,0,1.5,1.5,3,
-	0.92388,-0.382683,0,1.5,1.5,1.5,
-	0.92388,-0.382683,0,1.794666,2.211387,1.5,
-	0.92388,-0.382683,0,1.5,1.5,3,
-	0.92388,-0.382683,0,1.794666,2.211387,1.5,
-	0.92388,-0.382683,0,1.794666,2.211387,3,
-	0,0,-1,1.011517,2.095218,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.955528,2.044472,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.011517,2.095218,1.5,
-	0,0,-1,1.072211,2.140232,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.072211,2.140232,1.5,
-	0,0,-1,1.137025,2.179079,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.137025,2.179079,1.5,
-	0,0,-1,1.205334,2.211387,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.276481,0.763156,1.5,
-	0,0,-1,1.205334,0.788613,1.5,
-	0,0,-1,1.276481,0.763156,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.34978,0.744795,1.5,
-	0,0,-1,1.34978,0.744795,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.424527,0.733708,1.5,
-	0,0,-1,1.424527,0.733708,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.5,0.73,1.5,
-	0.980785,0.19509,0,1.5,1.5,1.5,
-	0.92388,0.382683,0,1.794666,0.788613,3,
-	0.92388,0.382683,0,1.794666,0.788613,1.5,
-	0.92388,0.382683,0,1.794666,0.788613,3,
-	0.980785,0.19509,0,1.5,1.5,1.5,
-	0.980785,0.19509,0,1.5,1.5,3,
-	0.980785,0.19509,0,1.5,1.5,3,
-	0.980785,0.19509,0,1.5,1.5,1.5,
-	0.92388,0.382683,0,1.205334,2.211387,1.5,
-	0.980785,0.19509,0,1.5,1.5,3,
-	0.92388,0.382683,0,1.205334,2.211387,1.5,
-	0.92388,0.382683,0,1.205334,2.211387,3,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.011517,0.904782,1.5,
-	0,0,-1,0.955528,0.955528,1.5,
-	0,0,-1,1.011517,0.904782,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.072211,0.859768,1.5,
-	0,0,-1,1.072211,0.859768,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.137025,0.820921,1.5,
-	0,0,-1,1.137025,0.820921,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.205334,0.788613,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.211387,1.205334,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.236844,1.276481,1.5,
-	0,0,-1,2.236844,1.276481,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.255205,1.34978,1.5,
-	0,0,-1,2.255205,1.34978,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.266292,1.424527,1.5,
-	-0.382683,0.92388,0,0.788613,1.205334,3,
-	-0.382683,0.92388,0,1.5,1.5,1.5,
-	-0.382683,0.92388,0,0.788613,1.205334,1.5,
-	-0.382683,0.92388,0,1.5,1.5,1.5,
-	-0.382683,0.92388,0,0.788613,1.205334,3,
-	-0.382683,0.92388,0,2.211387,1.794666,1.5,
-	-0.382683,0.92388,0,2.211387,1.794666,1.5,
-	-0.382683,0.92388,0,0.788613,1.205334,3,
-	-0.382683,0.92388,0,2.211387,1.794666,3,
-	0,0,1,2.211387,1.794666,3,
-	0,0,1,0.788613,1.205334,3,
-	0,0,1,1.5,1.5,3,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.211387,1.794666,1.5,
-	0,0,-1,2.236844,1.723519,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.236844,1.723519,1.5,
-	0,0,-1,2.255205,1.65022,1.5,
-	0,0,-1,2.27,1.5,1.5,
-	0,0,-1,2.255205,1.65022,1.5,
-	0,0,-1,2.266292,1.575473,1.5,
-	0,0,-1,0.733708,1.575473,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.73,1.5,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.733708,1.575473,1.5,
-	0,0,-1,0.744795,1.65022,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.744795,1.65022,1.5,
-	0,0,-1,0.763156,1.723519,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.763156,1.723519,1.5,
-	0,0,-1,0.788613,1.794666,1.5,
-	0,-1,0,2.27,1.5,3,
-	0,-1,0,1.5,1.5,1.5,
-	0,-1,0,2.27,1.5,1.5,
-	0,-1,0,1.5,1.5,1.5,
-	0,-1,0,2.27,1.5,3,
-	0,-1,0,0.73,1.5,1.5,
-	0,-1,0,0.73,1.5,1.5,
-	0,-1,0,2.27,1.5,3,
-	0,-1,0,0.73,1.5,3,
-	-0.404462,-0.42482,0.8099,0.73,1.5,3,
-	0.302501,-0.288004,0.908596,2.27,1.5,3,
-	0.154098,-0.097337,0.983249,1.5,1.5,3,
-	0,0,-1,0.820921,1.862975,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.788613,1.794666,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.820921,1.862975,1.5,
-	0,0,-1,0.859768,1.927789,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.859768,1.927789,1.5,
-	0,0,-1,0.904782,1.988483,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.904782,1.988483,1.5,
-	0,0,-1,0.955528,2.044472,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,1.862975,0.820921,1.5,
-	0,0,-1,1.862975,0.820921,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,1.927789,0.859768,1.5,
-	0,0,-1,1.927789,0.859768,1.5,
-	0,0,-1,2.044472,0.955528,1.5,
-	0,0,-1,1.988483,0.904782,1.5,
-	-0.707107,-0.707107,0,1.5,1.5,3,
-	-0.707107,-0.707107,0,2.044472,0.955528,1.5,
-	-0.707107,-0.707107,0,2.044472,0.955528,3,
-	-0.707107,-0.707107,0,2.044472,0.955528,1.5,
-	-0.707107,-0.707107,0,1.5,1.5,3,
-	-0.707107,-0.707107,0,1.5,1.5,1.5,
-	-0.707107,-0.707107,0,1.5,1.5,1.5,
-	-0.707107,-0.707107,0,1.5,1.5,3,
-	-0.707107,-0.707107,0,0.955528,2.044472,1.5,
-	-0.707107,-0.707107,0,0.955528,2.044472,1.5,
-	-0.707107,-0.707107,0,1.5,1.5,3,
-	-0.707107,-0.707107,0,0.955528,2.044472,3,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,1.5,0.73,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.5,0.73,1.5,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,1.575473,0.733708,1.5,
-	0,0,-1,1.575473,0.733708,1.5,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,1.65022,0.744795,1.5,
-	0,0,-1,1.65022,0.744795,1.5,
-	0,0,-1,1.794666,0.788613,1.5,
-	0,0,-1,1.723519,0.763156,1.5,
-	0,0,-1,1.575473,2.266292,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.5,2.27,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,1.575473,2.266292,1.5,
-	0,0,-1,1.794666,2.211387,1.5,
-	0,0,-1,1.794666,2.211387,1.5,
-	0,0,-1,1.575473,2.266292,1.5,
-	0,0,-1,1.65022,2.255205,1.5,
-	0,0,-1,1.794666,2.211387,1.5,
-	0,0,-1,1.65022,2.255205,1.5,
-	0,0,-1,1.723519,2.236844,1.5,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,0.73,3,
-	1,0,0,1.5,0.73,1.5,
-	1,0,0,1.5,0.73,3,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,1.5,3,
-	1,0,0,1.5,1.5,3,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,2.27,1.5,
-	1,0,0,1.5,1.5,3,
-	1,0,0,1.5,2.27,1.5,
-	1,0,0,1.5,2.27,3,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.820921,1.137025,1.5,
-	0,0,-1,0.788613,1.205334,1.5,
-	0,0,-1,0.820921,1.137025,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.859768,1.072211,1.5,
-	0,0,-1,0.859768,1.072211,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.904782,1.011517,1.5,
-	0,0,-1,0.904782,1.011517,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,0.955528,0.955528,1.5,
-	0,0,-1,1.794666,2.211387,1.5,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,1.5,1.5,1.5,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,1.794666,2.211387,1.5,
-	0,0,-1,1.862975,2.179079,1.5,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,1.862975,2.179079,1.5,
-	0,0,-1,1.927789,2.140232,1.5,
-	0,0,-1,2.044472,2.044472,1.5,
-	0,0,-1,1.927789,2.140232,1.5,
-	0,0,-1,1.988483,2.095218,1.5,
-	0.83147,-0.55557,0,1.5,1.5,1.5,
-	0.707107,-0.707107,0,0.955528,0.955528,3,
-	0.707107,-0.707107,0,0.955528,0.955528,1.5,
-	0.707107,-0.707107,0,0.955528,0.955528,3,
-	0.83147,-0.55557,0,1.5,1.5,1.5,
-	0.83147,-0.55557,0,1.5,1.5,3,
-	0.83147,-0.55557,0,1.5,1.5,3,
-	0.83147,-0.55557,0,1.5,1.5,1.5,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.83147,-0.55557,0,1.5,1.5,3,
-	0.707107,-0.707107,0,2.044472,2.044472,1.5,
-	0.707107,-0.707107,0,2.044472,2.044472,3
-};
-static const struct gllist lament_model_star_u_frame = { GL_N3F_V3F, GL_TRIANGLES, 1608, lament_model_star_u_data, 0 };
-const struct gllist *lament_model_star_u = &lament_model_star_u_frame;
-
-static const float lament_model_taser_a_data[] = {
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,1.798369,3,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.12132,3,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.502268,3,
-	-1,0,0,0,2.795,3,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,1.5,1.5,
-	-0.639602,0.639602,-0.426401,0,1.5,2.795,
-	-0.57735,0.57735,0.57735,0,1.5,2.277,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.205,3,0.723,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.53125,3,0.982,
-	0,1,0,0.53125,3,0.982,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.53125,3,1.17375,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,1.5,3,
-	1,0,0,0.777,1.5,2.795,
-	1,0,0,0.777,1.5,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,1.643814,3,
-	1,0,0,0.777,1.643814,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,1.799476,3,
-	1,0,0,0.777,1.799476,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,1.983093,3,
-	1,0,0,0.777,1.983093,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,2.223,3,
-	1,0,0,0.777,2.223,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,2.582046,3,
-	1,0,0,0.777,2.582046,3,
-	1,0,0,0.777,3,2.795,
-	1,0,0,0.777,3,3,
-	0,-1,0,1.295,0,3,
-	0,-1,0,0,0,0,
-	0,-1,0,1.295,0,0,
-	0,-1,0,0,0,0,
-	0,-1,0,1.295,0,3,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,1.295,0,3,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,1.295,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,1.295,0,3,
-	0,-1,0,0,0,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.795,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0.777,2.223,3,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,2.795,0.723,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,0.723,
-	-1,0,0,0,3,1.5,
-	-1,0,0,0,3,0.723,
-	1,0,0,0.53125,3,2.018,
-	1,0,0,0.53125,1.5,2.277,
-	1,0,0,0.53125,1.5,2.018,
-	1,0,0,0.53125,1.5,2.277,
-	1,0,0,0.53125,3,2.018,
-	1,0,0,0.53125,3,2.277,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0.205,3,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,3,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.796875,3,1.5,
-	0,1,0,0.53125,3,1.5,
-	0,1,0,0.796875,3,1.5,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.796875,3,2.018,
-	0,1,0,0.796875,3,2.018,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.723,3,2.018,
-	0,0,-1,0.723,3,0.982,
-	0,0,-1,0.53125,1.5,0.982,
-	0,0,-1,0.53125,3,0.982,
-	0,0,-1,0.53125,1.5,0.982,
-	0,0,-1,0.723,3,0.982,
-	0,0,-1,0.796875,1.5,0.982,
-	0,0,-1,0.796875,1.5,0.982,
-	0,0,-1,0.723,3,0.982,
-	0,0,-1,0.796875,3,0.982,
-	0,0,-1,0.205,3,2.795,
-	0,0,-1,0,2.795,2.795,
-	0,0,-1,0,3,2.795,
-	0,0,-1,0,2.795,2.795,
-	0,0,-1,0.205,3,2.795,
-	0,0,-1,0,1.5,2.795,
-	0,0,-1,0,1.5,2.795,
-	0,0,-1,0.205,3,2.795,
-	0,0,-1,0.777,1.5,2.795,
-	0,0,-1,0.777,1.5,2.795,
-	0,0,-1,0.205,3,2.795,
-	0,0,-1,0.777,3,2.795,
-	1,0,0,1.295,1.5,0,
-	1,0,0,1.295,0,3,
-	1,0,0,1.295,0,0,
-	1,0,0,1.295,0,3,
-	1,0,0,1.295,1.5,0,
-	1,0,0,1.295,1.5,3,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0.777,1.799476,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,0.205,
-	1,0,0,0.53125,3,0.723,
-	1,0,0,0.53125,1.5,0.982,
-	1,0,0,0.53125,1.5,0.723,
-	1,0,0,0.53125,1.5,0.982,
-	1,0,0,0.53125,3,0.723,
-	1,0,0,0.53125,3,0.982,
-	0,0,1,0.53125,1.5,2.277,
-	0,0,1,0,2.277,2.277,
-	0,0,1,0,1.5,2.277,
-	0,0,1,0,2.277,2.277,
-	0,0,1,0.53125,1.5,2.277,
-	0,0,1,0,2.795,2.277,
-	0,0,1,0,2.795,2.277,
-	0,0,1,0.53125,1.5,2.277,
-	0,0,1,0,3,2.277,
-	0,0,1,0,3,2.277,
-	0,0,1,0.53125,1.5,2.277,
-	0,0,1,0.205,3,2.277,
-	0,0,1,0.205,3,2.277,
-	0,0,1,0.53125,1.5,2.277,
-	0,0,1,0.53125,3,2.277,
-	1,0,0,0.796875,3,1.759,
-	1,0,0,0.796875,1.5,2.018,
-	1,0,0,0.796875,1.5,1.759,
-	1,0,0,0.796875,1.5,2.018,
-	1,0,0,0.796875,3,1.759,
-	1,0,0,0.796875,3,2.018,
-	0,1,0,0.796875,3,1.5,
-	0,1,0,1.0625,3,1.241,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,1.0625,3,1.241,
-	0,1,0,0.796875,3,1.5,
-	0,1,0,1.0625,3,1.5,
-	0,0,1,0.777,1.799476,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,2.502268,3,
-	0,0,1,0.777,1.799476,3,
-	0,0,1,0.777,1.983093,3,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.723,
-	0,1,0,0,3,0.723,
-	0,1,0,0.205,3,0.723,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	1,0,0,0.796875,3,0.982,
-	1,0,0,0.796875,1.5,1.241,
-	1,0,0,0.796875,1.5,0.982,
-	1,0,0,0.796875,1.5,1.241,
-	1,0,0,0.796875,3,0.982,
-	1,0,0,0.796875,3,1.241,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,1.5,
-	0,0,1,1.0625,1.5,1.759,
-	0,0,1,0.796875,3,1.759,
-	0,0,1,0.796875,1.5,1.759,
-	0,0,1,0.796875,3,1.759,
-	0,0,1,1.0625,1.5,1.759,
-	0,0,1,1.0625,3,1.759,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,3,2.277,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,2.277,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,3,2.277,
-	-1,0,0,0,3,1.5,
-	0,1,0,0.205,3,3,
-	0,1,0,0.777,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.777,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,0.777,3,3,
-	0.57735,0.57735,0.57735,0.777,3,3,
-	0,0.83205,0.5547,0.205,3,3,
-	0,0,1,0.259,3,3,
-	0.57735,0.57735,0.57735,0.777,3,3,
-	0,0,1,0.259,3,3,
-	0,0,1,0.497732,3,3,
-	0.57735,0.57735,0.57735,0.777,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.518,3,3,
-	0,1,0,0.53125,3,1.17375,
-	0,1,0,0.723,3,0.982,
-	0,1,0,0.53125,3,0.982,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,0.205,0.205,
-	-0.588348,0.784465,0.196116,0,1.5,0.205,
-	-1,0,0,0,1.5,1.5,
-	-0.408248,0.408248,-0.816497,0,1.5,0.723,
-	0,0,1,0.777,1.5,0.205,
-	0,0,1,0,2.795,0.205,
-	0,0,1,0,1.5,0.205,
-	0,0,1,0,2.795,0.205,
-	0,0,1,0.777,1.5,0.205,
-	0,0,1,0,3,0.205,
-	0,0,1,0,3,0.205,
-	0,0,1,0.777,1.5,0.205,
-	0,0,1,0.205,3,0.205,
-	0,0,1,0.205,3,0.205,
-	0,0,1,0.777,1.5,0.205,
-	0,0,1,0.777,3,0.205,
-	0,0,1,0.796875,1.5,2.018,
-	0,0,1,0.53125,3,2.018,
-	0,0,1,0.53125,1.5,2.018,
-	0,0,1,0.53125,3,2.018,
-	0,0,1,0.796875,1.5,2.018,
-	0,0,1,0.723,3,2.018,
-	0,0,1,0.723,3,2.018,
-	0,0,1,0.796875,1.5,2.018,
-	0,0,1,0.796875,3,2.018,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.12132,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.502268,0,
-	-1,0,0,0,2.795,0.205,
-	-1,0,0,0,2.795,0,
-	0,0,1,0.777,1.643814,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,2.12132,3,
-	0,0,1,0.777,1.643814,3,
-	0,0,1,0.777,1.799476,3,
-	0,0,-1,0.777,1.799476,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,2.12132,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0.777,1.799476,0,
-	0,0,-1,0.777,1.5,0,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0,0,
-	-1,0,0,0,0,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0.777,3,0,
-	0,1,0,0.497732,3,0,
-	0,1,0,0.777,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0.777,3,0.205,
-	0,1,0,0.777,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0.205,3,0.205,
-	-1,0,0,0,3,0,
-	-1,0,0,0,2.795,0,
-	-1,0,0,0,2.795,0.205,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0.497732,3,0,
-	0,0,-1,0.777,2.582046,0,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.53125,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,0,1,0.777,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.798369,3,
-	0,0,1,0.777,1.5,3,
-	0,0,1,0.777,1.643814,3,
-	0,1,0,0.723,3,2.018,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.53125,3,2.018,
-	0,1,0,0.53125,3,1.17375,
-	0,1,0,0.796875,3,0.982,
-	0,1,0,0.723,3,0.982,
-	0,1,0,0.796875,3,0.982,
-	0,1,0,0.53125,3,1.17375,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,0.53125,3,1.17375,
-	0,1,0,0.53125,3,1.5,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,0.53125,3,1.5,
-	0,1,0,0.796875,3,1.5,
-	0,0,-1,0.777,3,0,
-	0,0,-1,0.777,2.582046,0,
-	0,0,-1,0.497732,3,0,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0.205,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,1.5,3,
-	-1,0,0,0,1.5,2.795,
-	0,0,-1,0.205,3,0.723,
-	0,0,-1,0,2.795,0.723,
-	0,0,-1,0,3,0.723,
-	0,0,-1,0,2.795,0.723,
-	0,0,-1,0.205,3,0.723,
-	0,0,-1,0,2.277,0.723,
-	0,0,-1,0,2.277,0.723,
-	0,0,-1,0.205,3,0.723,
-	0,0,-1,0,1.5,0.723,
-	0,0,-1,0,1.5,0.723,
-	0,0,-1,0.205,3,0.723,
-	0,0,-1,0.53125,1.5,0.723,
-	0,0,-1,0.53125,1.5,0.723,
-	0,0,-1,0.205,3,0.723,
-	0,0,-1,0.53125,3,0.723,
-	-1,0,0,0,2.277,0.723,
-	-1,0,0,0,1.5,0.723,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,3,3,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,2.795,3,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.53125,3,1.82625,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0.53125,3,2.018,
-	0,1,0,0.53125,3,2.018,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0.53125,3,2.277,
-	1,0,0,1.0625,3,1.241,
-	1,0,0,1.0625,1.5,1.759,
-	1,0,0,1.0625,1.5,1.241,
-	1,0,0,1.0625,1.5,1.759,
-	1,0,0,1.0625,3,1.241,
-	1,0,0,1.0625,3,1.759,
-	0.57735,0.57735,0.57735,1.0625,3,1.759,
-	0.57735,0.57735,-0.57735,1.0625,3,1.241,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,0,3,2.277,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.277,
-	0,1,0,0.205,3,2.277,
-	1,0,0,0.777,1.799476,0,
-	1,0,0,0.777,1.5,0.205,
-	1,0,0,0.777,1.5,0,
-	1,0,0,0.777,1.5,0.205,
-	1,0,0,0.777,1.799476,0,
-	1,0,0,0.777,3,0.205,
-	1,0,0,0.777,3,0.205,
-	1,0,0,0.777,1.799476,0,
-	1,0,0,0.777,1.983093,0,
-	1,0,0,0.777,3,0.205,
-	1,0,0,0.777,1.983093,0,
-	1,0,0,0.777,2.223,0,
-	1,0,0,0.777,3,0.205,
-	1,0,0,0.777,2.223,0,
-	1,0,0,0.777,2.582046,0,
-	1,0,0,0.777,3,0.205,
-	1,0,0,0.777,2.582046,0,
-	1,0,0,0.777,3,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,2.795,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0,2.502268,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0.777,1.983093,0,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.259,3,3,
-	0,0,1,0.259,3,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.777,2.582046,3,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,1.5,
-	-1,0,0,0,0.205,2.795,
-	0,1,0,0.53125,3,1.5,
-	0,1,0,0.53125,3,1.17375,
-	0,1,0,0.205,3,1.5,
-	-1,0,0,0,2.277,2.277,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.277,2.277,
-	-1,0,0,0,2.795,2.277,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,0,
-	-1,0,0,0,0,0,
-	0,0,-1,1.0625,3,1.241,
-	0,0,-1,0.796875,1.5,1.241,
-	0,0,-1,0.796875,3,1.241,
-	0,0,-1,0.796875,1.5,1.241,
-	0,0,-1,1.0625,3,1.241,
-	0,0,-1,1.0625,1.5,1.241,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,2.795,2.795,
-	-1,0,0,0,3,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,0.518,3,3,
-	0,0,1,0.497732,3,3,
-	0,0,1,0.518,3,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,0.777,3,3,
-	-1,0,0,0,0.205,2.795,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,0.796875,3,1.5,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,1.0625,3,1.759,
-	0,1,0,0.796875,1.5,2.018,
-	0,1,0,1.0625,1.5,1.759,
-	0,1,0,0.796875,1.5,1.759,
-	0,1,0,0.53125,1.5,2.277,
-	0,1,0,0.796875,1.5,2.018,
-	0,1,0,0.53125,1.5,2.018,
-	0,1,0,0,1.5,2.795,
-	0,1,0,0.53125,1.5,2.277,
-	0,1,0,0,1.5,2.277,
-	0,1,0,0.777,1.5,0.205,
-	0,1,0,1.295,1.5,0,
-	0,1,0,0.777,1.5,0,
-	0,1,0,1.295,1.5,0,
-	0,1,0,0.777,1.5,0.205,
-	0,1,0,1.0625,1.5,1.241,
-	0,1,0,1.295,1.5,0,
-	0,1,0,1.0625,1.5,1.241,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.0625,1.5,1.241,
-	0,1,0,0.777,1.5,0.205,
-	0,1,0,0.796875,1.5,0.982,
-	0,1,0,0.796875,1.5,0.982,
-	0,1,0,0.777,1.5,0.205,
-	0,1,0,0,1.5,0.205,
-	0.218218,0.872872,-0.436436,0.796875,1.5,0.982,
-	-0.588348,0.784465,0.196116,0,1.5,0.205,
-	0.333333,0.666667,-0.666667,0.53125,1.5,0.723,
-	0,1,0,0.53125,1.5,0.723,
-	0,1,0,0,1.5,0.205,
-	0,1,0,0,1.5,0.723,
-	0,1,0,0.796875,1.5,0.982,
-	0,1,0,0.53125,1.5,0.723,
-	0,1,0,0.53125,1.5,0.982,
-	0,1,0,1.0625,1.5,1.241,
-	0,1,0,0.796875,1.5,0.982,
-	0,1,0,0.796875,1.5,1.241,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.0625,1.5,1.241,
-	0,1,0,1.0625,1.5,1.759,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.0625,1.5,1.759,
-	0,1,0,0.796875,1.5,2.018,
-	0,1,0,1.295,1.5,3,
-	0,1,0,0.796875,1.5,2.018,
-	0,1,0,0.53125,1.5,2.277,
-	0,1,0,1.295,1.5,3,
-	0,1,0,0.53125,1.5,2.277,
-	0,1,0,0.777,1.5,2.795,
-	0,1,0,0.777,1.5,2.795,
-	0,1,0,0.53125,1.5,2.277,
-	0,1,0,0,1.5,2.795,
-	0,1,0,1.295,1.5,3,
-	0,1,0,0.777,1.5,2.795,
-	0,1,0,0.777,1.5,3,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.277,0.723,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,2.277,0.723,
-	-1,0,0,0,2.795,1.5,
-	-1,0,0,0,2.795,0.723,
-	-1,0,0,0,2.277,2.277,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,1.5,2.277,
-	-1,0,0,0,1.5,1.5,
-	-1,0,0,0,0.205,0.205,
-	-1,0,0,0,0.205,1.5,
-	0,0,1,1.295,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,0,0,3,
-	0,0,1,0,0.205,3,
-	0,0,1,1.295,0,3,
-	0,0,1,0,1.5,3,
-	0,0,1,0,1.5,3,
-	0,0,1,1.295,0,3,
-	0,0,1,0.777,1.5,3,
-	0,0,1,0.777,1.5,3,
-	0,0,1,1.295,0,3,
-	0,0,1,1.295,1.5,3,
-	0,1,0,0,1.5,3,
-	0,1,0,0.777,1.5,2.795,
-	0,1,0,0,1.5,2.795,
-	0,1,0,0.777,1.5,2.795,
-	0,1,0,0,1.5,3,
-	0,1,0,0.777,1.5,3,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0,1.5,0,
-	0,0,-1,0,0.205,0,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,1.295,0,0,
-	0,0,-1,1.295,0,0,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,1.295,1.5,0,
-	0,1,0,0,1.5,0.205,
-	0,1,0,0.777,1.5,0,
-	0,1,0,0,1.5,0,
-	0,1,0,0.777,1.5,0,
-	0,1,0,0,1.5,0.205,
-	0,1,0,0.777,1.5,0.205
-};
-static const struct gllist lament_model_taser_a_frame = { GL_N3F_V3F, GL_TRIANGLES, 582, lament_model_taser_a_data, 0 };
-const struct gllist *lament_model_taser_a = &lament_model_taser_a_frame;
-
-static const float lament_model_taser_b_data[] = {
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.295,1.806804,0,
-	-1,0,0,0,3,0.205,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,3,0.464,
-	-1,0,0,0,3,0.723,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,1.5,0.723,
-	-1,0,0,0,1.5,0.205,
-	-1,0,0,0,3,0.723,
-	-1,0,0,0,3,0.464,
-	-1,0,0,0.53125,3,0.982,
-	-0.989278,0,-0.146043,0.53125,1.5,0.723,
-	-1,0,0,0.53125,1.5,0.982,
-	-0.989278,0,-0.146043,0.53125,1.5,0.723,
-	-1,0,0,0.53125,3,0.982,
-	-0.956392,0,-0.292087,0.53125,3,0.723,
-	0,0,1,1.0625,1.5,1.241,
-	0,0,1,0.796875,3,1.241,
-	0,0,1,0.796875,1.5,1.241,
-	0,0,1,0.796875,3,1.241,
-	0,0,1,1.0625,1.5,1.241,
-	0,0,1,1.0625,3,1.241,
-	0,0,-1,1.0625,3,1.759,
-	0,0,-1,0.796875,1.5,1.759,
-	0,0,-1,0.796875,3,1.759,
-	0,0,-1,0.796875,1.5,1.759,
-	0,0,-1,1.0625,3,1.759,
-	0,0,-1,1.0625,1.5,1.759,
-	-1,0,0,0.777,1.643814,3,
-	-1,0,0,0.777,1.5,2.795,
-	-1,0,0,0.777,1.5,3,
-	-1,0,0,0.777,1.5,2.795,
-	-1,0,0,0.777,1.643814,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,1.643814,3,
-	-1,0,0,0.777,1.732563,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,1.732563,3,
-	-1,0,0,0.777,1.799476,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,1.799476,3,
-	-1,0,0,0.777,1.983093,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,1.983093,3,
-	-1,0,0,0.777,2.223,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,2.223,3,
-	-1,0,0,0.777,2.582046,3,
-	-1,0,0,0.777,3,2.795,
-	-1,0,0,0.777,2.582046,3,
-	-1,0,0,0.777,3,3,
-	-1,0,0,0.53125,3,2.277,
-	-1,0,0,0.53125,1.5,2.018,
-	-1,0,0,0.53125,1.5,2.277,
-	-1,0,0,0.53125,1.5,2.018,
-	-1,0,0,0.53125,3,2.277,
-	-1,0,0,0.53125,3,2.018,
-	-1,0,0,0.796875,3,1.241,
-	-1,0,0,0.796875,1.5,0.982,
-	-1,0,0,0.796875,1.5,1.241,
-	-1,0,0,0.796875,1.5,0.982,
-	-1,0,0,0.796875,3,1.241,
-	-1,0,0,0.796875,3,0.982,
-	-1,0,0,1.0625,3,1.759,
-	-1,0,0,1.0625,1.5,1.5,
-	-1,0,0,1.0625,1.5,1.759,
-	-1,0,0,1.0625,1.5,1.5,
-	-1,0,0,1.0625,3,1.759,
-	-1,0,0,1.0625,1.5,1.241,
-	-1,0,0,1.0625,1.5,1.241,
-	-1,0,0,1.0625,3,1.759,
-	-1,0,0,1.0625,3,1.241,
-	-0.301511,0.904534,0.301511,1.0625,3,1.241,
-	-0.639602,0.639602,-0.426401,1.0625,3,1.759,
-	0,1,0,1.0625,3,1.5,
-	-1,0,0,0.796875,3,2.018,
-	-1,0,0,0.796875,1.5,1.759,
-	-1,0,0,0.796875,1.5,2.018,
-	-1,0,0,0.796875,1.5,1.759,
-	-1,0,0,0.796875,3,2.018,
-	-1,0,0,0.796875,3,1.759,
-	0,0,-1,0.723,3,2.018,
-	0,0,-1,0.53125,1.5,2.018,
-	0,0,-1,0.53125,3,2.018,
-	0,0,-1,0.53125,1.5,2.018,
-	0,0,-1,0.723,3,2.018,
-	0,0,-1,0.796875,1.5,2.018,
-	0,0,-1,0.796875,1.5,2.018,
-	0,0,-1,0.723,3,2.018,
-	0,0,-1,0.796875,3,2.018,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,1.5,2.277,
-	-1,0,0,0,1.5,2.795,
-	-1,0,0,0,1.5,2.277,
-	-1,0,0,0,3,2.795,
-	-1,0,0,0,3,2.277,
-	-0.57735,0.57735,-0.57735,0,3,2.277,
-	-0.666667,0.333333,0.666667,0,3,2.795,
-	0,1,0,0,3,2.536,
-	0,0,1,0.796875,1.5,0.982,
-	0,0,1,0.53125,3,0.982,
-	0,0,1,0.53125,1.5,0.982,
-	0,0,1,0.53125,3,0.982,
-	0,0,1,0.796875,1.5,0.982,
-	0,0,1,0.723,3,0.982,
-	0,0,1,0.723,3,0.982,
-	0,0,1,0.796875,1.5,0.982,
-	0,0,1,0.796875,3,0.982,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.295,2.231186,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.295,1.806804,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.295,1.806804,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.295,1.806804,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,0.777,1.643814,0,
-	0,0,-1,0.777,1.5,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,1.295,1.5,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.777,1.643814,0,
-	0,0,-1,0.777,1.732563,0,
-	0,0,-1,0.777,1.643814,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.295,3,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.201631,3,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.279384,2.227275,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.295,2.231186,0,
-	0,0,-1,0.777,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.777,2.582046,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.777,3,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,1.141738,2.17026,0,
-	0,0,-1,0.87868,3,0,
-	0,0,-1,1.209161,2.202148,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.777,1.799476,0,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0.777,1.799476,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.777,1.799476,0,
-	0,0,-1,0.82974,1.858262,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.777,1.983093,0,
-	0,0,-1,0.912512,1.982139,0,
-	0,0,-1,0.868083,1.922233,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,0.777,2.582046,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,1.077767,2.131917,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.777,2.223,0,
-	0,0,-1,1.017861,2.087488,0,
-	0,0,-1,0.962599,2.037401,0,
-	0,0,-1,0.797852,1.790839,0,
-	0,0,-1,0.777,1.732563,0,
-	0,0,-1,0.777,1.799476,0,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,0.777,2.223,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0.777,1.799476,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.777,1.983093,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,1.295,1.5,3,
-	0,0,1,0.777,1.643814,3,
-	0,0,1,0.777,1.5,3,
-	0,0,1,0.777,1.643814,3,
-	0,0,1,1.295,1.5,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.777,3,3,
-	0,0,1,0.777,2.582046,3,
-	0,0,1,0.777,3,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.295,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.017861,2.087488,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.912512,1.982139,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,0.962599,2.037401,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.077767,2.131917,3,
-	0,0,1,1.141738,2.17026,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.295,1.994914,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.82974,1.858262,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,0.868083,1.922233,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.036,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.036,3,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.295,2.231186,3,
-	0,0,1,1.295,1.994914,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.209161,2.202148,3,
-	0,0,1,1.279384,2.227275,3,
-	0,0,1,1.295,1.994914,3,
-	0,0,1,1.295,2.231186,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,0.777,1.732563,3,
-	0,0,1,0.777,1.643814,3,
-	0,0,1,0.777,1.732563,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,0.797852,1.790839,3,
-	0,0,1,0.777,1.799476,3,
-	0,0,1,0.777,1.732563,3,
-	0,0,1,0.777,1.5,2.795,
-	0,0,1,0,3,2.795,
-	0,0,1,0,1.5,2.795,
-	0,0,1,0,3,2.795,
-	0,0,1,0.777,1.5,2.795,
-	0,0,1,0.205,3,2.795,
-	0,0,1,0.205,3,2.795,
-	0,0,1,0.777,1.5,2.795,
-	0,0,1,0.777,3,2.795,
-	0,0,-1,0.205,3,2.277,
-	0,0,-1,0,1.5,2.277,
-	0,0,-1,0,3,2.277,
-	0,0,-1,0,1.5,2.277,
-	0,0,-1,0.205,3,2.277,
-	0,0,-1,0.53125,1.5,2.277,
-	0,0,-1,0.53125,1.5,2.277,
-	0,0,-1,0.205,3,2.277,
-	0,0,-1,0.53125,3,2.277,
-	0,0,1,0.53125,1.5,0.723,
-	0,0,1,0,3,0.723,
-	0,0,1,0,1.5,0.723,
-	0,0,1,0,3,0.723,
-	0,0,1,0.53125,1.5,0.723,
-	0,0,1,0.205,3,0.723,
-	0,0,1,0.205,3,0.723,
-	0,0,1,0.53125,1.5,0.723,
-	0,0,1,0.53125,3,0.723,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,1.5,0,
-	-0.956392,0,-0.292087,0.777,1.5,0.205,
-	-1,0,0,0.777,1.5,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,1.643814,0,
-	-1,0,0,0.777,1.643814,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,1.732563,0,
-	-1,0,0,0.777,1.732563,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,1.799476,0,
-	-1,0,0,0.777,1.799476,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,1.983093,0,
-	-1,0,0,0.777,1.983093,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,2.223,0,
-	-1,0,0,0.777,2.223,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,2.582046,0,
-	-1,0,0,0.777,2.582046,0,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	-1,0,0,0.777,3,0,
-	0,0,-1,0.205,3,0.205,
-	0,0,-1,0,1.5,0.205,
-	0,0,-1,0,3,0.205,
-	0,0,-1,0,1.5,0.205,
-	0,0,-1,0.205,3,0.205,
-	0,0,-1,0.777,1.5,0.205,
-	0,0,-1,0.777,1.5,0.205,
-	0,0,-1,0.205,3,0.205,
-	0,0,-1,0.777,3,0.205,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,2.530605,0,
-	0.707107,0,-0.707107,1.295,3,0,
-	0.707107,0,-0.707107,1.295,2.530605,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,2.231186,0,
-	0.707107,0,-0.707107,1.295,2.231186,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.994914,0,
-	0.707107,0,-0.707107,1.295,1.994914,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.806804,0,
-	0.707107,0,-0.707107,1.295,1.806804,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.705,0,
-	0.707107,0,-0.707107,1.295,1.705,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.636977,0,
-	0.707107,0,-0.707107,1.295,1.636977,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.584914,0,
-	0.707107,0,-0.707107,1.295,1.584914,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.540777,0,
-	0.707107,0,-0.707107,1.295,1.540777,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,1.295,1.5,0,
-	0.707107,0,-0.707107,1.295,1.5,0,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,2.1475,1.5,0.8525,
-	0.707107,0,-0.707107,2.1475,1.5,0.8525,
-	0.707107,0,-0.707107,1.5,3,0.205,
-	0.707107,0,-0.707107,2.1475,3,0.8525,
-	1,0,0,2.1475,3,0.8525,
-	1,0,0,2.1475,1.5,1.284167,
-	1,0,0,2.1475,1.5,0.8525,
-	1,0,0,2.1475,1.5,1.284167,
-	1,0,0,2.1475,3,0.8525,
-	1,0,0,2.1475,3,1.284167,
-	-0.707107,0,-0.707107,2.1475,3,1.715833,
-	-0.707107,0,-0.707107,1.715833,1.5,2.1475,
-	-0.707107,0,-0.707107,1.715833,3,2.1475,
-	-0.707107,0,-0.707107,1.715833,1.5,2.1475,
-	-0.707107,0,-0.707107,2.1475,3,1.715833,
-	-0.707107,0,-0.707107,2.1475,1.5,1.715833,
-	1,0,0,2.1475,3,1.715833,
-	1,0,0,2.1475,1.5,2.1475,
-	1,0,0,2.1475,1.5,1.715833,
-	1,0,0,2.1475,1.5,2.1475,
-	1,0,0,2.1475,3,1.715833,
-	1,0,0,2.1475,3,2.1475,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.5,3,
-	0.707107,0,0.707107,2.1475,1.5,2.1475,
-	0.707107,0,0.707107,1.295,1.5,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.540777,3,
-	0.707107,0,0.707107,1.295,1.540777,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.584914,3,
-	0.707107,0,0.707107,1.295,1.584914,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.636977,3,
-	0.707107,0,0.707107,1.295,1.636977,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.705,3,
-	0.707107,0,0.707107,1.295,1.705,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.806804,3,
-	0.707107,0,0.707107,1.295,1.806804,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,1.994914,3,
-	0.707107,0,0.707107,1.295,1.994914,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,2.231186,3,
-	0.707107,0,0.707107,1.295,2.231186,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,2.530605,3,
-	0.707107,0,0.707107,1.295,2.530605,3,
-	0.707107,0,0.707107,2.1475,3,2.1475,
-	0.707107,0,0.707107,1.295,3,3,
-	0.259688,0.73451,0.626943,1.295,3,3,
-	0.828694,0.205349,0.52067,2.1475,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	1,0,0,1.5,3,1.5,
-	1,0,0,1.5,1.5,1.812191,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,1.5,1.812191,
-	1,0,0,1.5,3,1.5,
-	1,0,0,1.5,3,1.812191,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.508856,3,1.812374,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.705014,3,1.73585,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.715833,3,1.725471,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.705014,3,1.73585,
-	0,1,0,1.68091,3,1.75481,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.68091,3,1.75481,
-	0,1,0,1.655063,3,1.771315,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.655063,3,1.771315,
-	0,1,0,1.627723,3,1.785207,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.627723,3,1.785207,
-	0,1,0,1.599152,3,1.796353,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.599152,3,1.796353,
-	0,1,0,1.569627,3,1.804645,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.569627,3,1.804645,
-	0,1,0,1.539432,3,1.810002,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.539432,3,1.810002,
-	0,1,0,1.508856,3,1.812374,
-	0,-1,0,1.5,1.5,1.812191,
-	0,-1,0,1.0625,1.5,1.5,
-	0,-1,0,1.5,1.5,1.5,
-	0,-1,0,1.0625,1.5,1.5,
-	0,-1,0,1.5,1.5,1.812191,
-	0,-1,0,1.0625,1.5,1.759,
-	0,-1,0,0,1.5,2.795,
-	0,-1,0,0,1.5,2.277,
-	0,-1,0,0.53125,1.5,2.277,
-	0,-1,0,0,1.5,2.795,
-	0,-1,0,0.53125,1.5,2.277,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,0.53125,1.5,2.018,
-	0,-1,0,0.796875,1.5,2.018,
-	0,-1,0,0.53125,1.5,2.018,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,0.53125,1.5,2.277,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,2.1475,1.5,1.715833,
-	0,-1,0,2.1475,1.5,2.1475,
-	0,-1,0,1.295,1.5,3,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,2.1475,1.5,2.1475,
-	0,-1,0,1.295,1.5,3,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,1.295,1.5,3,
-	0,-1,0,0.777,1.5,3,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,0.796875,1.5,2.018,
-	0,-1,0,0.796875,1.5,1.759,
-	0,-1,0,0.796875,1.5,2.018,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,0.777,1.5,2.795,
-	0,-1,0,1.5,1.5,1.812191,
-	0,-1,0,0.796875,1.5,1.759,
-	0,-1,0,1.0625,1.5,1.759,
-	0,-1,0,0.796875,1.5,1.759,
-	0,-1,0,1.5,1.5,1.812191,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,0,1.5,0.723,
-	0,-1,0,0,1.5,0.205,
-	0,-1,0,0.53125,1.5,0.723,
-	0,-1,0,0.53125,1.5,0.723,
-	0,-1,0,0,1.5,0.205,
-	0,-1,0,0.777,1.5,0.205,
-	0,-1,0,0.796875,1.5,0.982,
-	0,-1,0,0.53125,1.5,0.723,
-	0,-1,0,0.777,1.5,0.205,
-	0,-1,0,0.53125,1.5,0.723,
-	0,-1,0,0.796875,1.5,0.982,
-	0,-1,0,0.53125,1.5,0.982,
-	0,-1,0,2.1475,1.5,1.284167,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,2.1475,1.5,0.8525,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.295,1.5,0,
-	0,-1,0,2.1475,1.5,0.8525,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,0.777,1.5,0,
-	0,-1,0,1.295,1.5,0,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,0.777,1.5,0.205,
-	0,-1,0,0.777,1.5,0,
-	0,-1,0,0.777,1.5,0.205,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,0.796875,1.5,0.982,
-	0,-1,0,0.796875,1.5,0.982,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,0.796875,1.5,1.241,
-	0,-1,0,1.5,1.5,1.187809,
-	0,-1,0,0.796875,1.5,1.241,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,0.796875,1.5,1.241,
-	0,-1,0,1.5,1.5,1.187809,
-	0,-1,0,1.0625,1.5,1.241,
-	1,0,0,1.715833,3,1.725471,
-	1,0,0,1.715833,1.5,2.1475,
-	1,0,0,1.715833,1.5,1.725471,
-	1,0,0,1.715833,1.5,2.1475,
-	1,0,0,1.715833,3,1.725471,
-	1,0,0,1.715833,3,2.1475,
-	-0.011969,0,-0.999928,1.508856,3,1.812374,
-	0.020743,0,-0.999785,1.5,1.5,1.812191,
-	0.020743,0,-0.999785,1.5,3,1.812191,
-	0.020743,0,-0.999785,1.5,1.5,1.812191,
-	-0.011969,0,-0.999928,1.508856,3,1.812374,
-	-0.044703,0,-0.999,1.508856,1.5,1.812374,
-	-0.692287,0,-0.721622,1.715833,3,1.725471,
-	-0.668315,0,-0.743879,1.705014,1.5,1.73585,
-	-0.6436,0,-0.765362,1.705014,3,1.73585,
-	-0.668315,0,-0.743879,1.705014,1.5,1.73585,
-	-0.692287,0,-0.721622,1.715833,3,1.725471,
-	-0.692287,0,-0.721622,1.715833,1.5,1.725471,
-	-0.6436,0,-0.765362,1.705014,3,1.73585,
-	-0.592184,0,-0.805803,1.68091,1.5,1.75481,
-	-0.565482,0,-0.824761,1.68091,3,1.75481,
-	-0.592184,0,-0.805803,1.68091,1.5,1.75481,
-	-0.6436,0,-0.765362,1.705014,3,1.73585,
-	-0.668315,0,-0.743879,1.705014,1.5,1.73585,
-	-0.565482,0,-0.824761,1.68091,3,1.75481,
-	-0.51035,0,-0.859967,1.655063,1.5,1.771315,
-	-0.481919,0,-0.876216,1.655063,3,1.771315,
-	-0.51035,0,-0.859967,1.655063,1.5,1.771315,
-	-0.565482,0,-0.824761,1.68091,3,1.75481,
-	-0.592184,0,-0.805803,1.68091,1.5,1.75481,
-	-0.481919,0,-0.876216,1.655063,3,1.771315,
-	-0.423601,0,-0.905849,1.627723,1.5,1.785207,
-	-0.393714,0,-0.919233,1.627723,3,1.785207,
-	-0.423601,0,-0.905849,1.627723,1.5,1.785207,
-	-0.481919,0,-0.876216,1.655063,3,1.771315,
-	-0.51035,0,-0.859967,1.655063,1.5,1.771315,
-	-0.393714,0,-0.919233,1.627723,3,1.785207,
-	-0.332772,0,-0.943007,1.599152,1.5,1.796353,
-	-0.301717,0,-0.953397,1.599152,3,1.796353,
-	-0.332772,0,-0.943007,1.599152,1.5,1.796353,
-	-0.393714,0,-0.919233,1.627723,3,1.785207,
-	-0.423601,0,-0.905849,1.627723,1.5,1.785207,
-	-0.301717,0,-0.953397,1.599152,3,1.796353,
-	-0.238739,0,-0.971084,1.569627,1.5,1.804645,
-	-0.206815,0,-0.97838,1.569627,3,1.804645,
-	-0.238739,0,-0.971084,1.569627,1.5,1.804645,
-	-0.301717,0,-0.953397,1.599152,3,1.796353,
-	-0.332772,0,-0.943007,1.599152,1.5,1.796353,
-	-0.206815,0,-0.97838,1.569627,3,1.804645,
-	-0.142406,0,-0.989808,1.539432,1.5,1.810002,
-	-0.109921,0,-0.99394,1.539432,3,1.810002,
-	-0.142406,0,-0.989808,1.539432,1.5,1.810002,
-	-0.206815,0,-0.97838,1.569627,3,1.804645,
-	-0.238739,0,-0.971084,1.569627,1.5,1.804645,
-	-0.109921,0,-0.99394,1.539432,3,1.810002,
-	-0.044703,0,-0.999,1.508856,1.5,1.812374,
-	-0.011969,0,-0.999928,1.508856,3,1.812374,
-	-0.044703,0,-0.999,1.508856,1.5,1.812374,
-	-0.109921,0,-0.99394,1.539432,3,1.810002,
-	-0.142406,0,-0.989808,1.539432,1.5,1.810002,
-	0,0,1,1.036,3,3,
-	0,0,1,1.201631,3,3,
-	0,0,1,0.87868,3,3,
-	0,1,0,0.777,3,2.795,
-	0,1,0,1.295,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.295,3,3,
-	0,1,0,0.777,3,2.795,
-	0,1,0,0.777,3,3,
-	0.259688,0.73451,0.626943,1.295,3,3,
-	-0.408248,0.408248,0.816497,0.777,3,3,
-	0,0,1,0.87868,3,3,
-	0.259688,0.73451,0.626943,1.295,3,3,
-	0,0,1,0.87868,3,3,
-	0,0,1,1.201631,3,3,
-	0.840862,0,-0.54125,1.5,3,1.812191,
-	0.840862,0,-0.54125,1.715833,1.5,2.1475,
-	0.840862,0,-0.54125,1.5,1.5,1.812191,
-	0.840862,0,-0.54125,1.715833,1.5,2.1475,
-	0.840862,0,-0.54125,1.5,3,1.812191,
-	0.840862,0,-0.54125,1.715833,3,2.1475,
-	0,-1,0,1.715833,3,2.1475,
-	0,-1,0,1.5,3,1.812191,
-	0,-1,0,1.607917,3,1.979845,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.691322,3,1.252913,
-	0,1,0,1.71462,3,1.272856,
-	0,1,0,1.691322,3,1.252913,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.666182,3,1.23535,
-	0,1,0,1.666182,3,1.23535,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.639442,3,1.220336,
-	0,1,0,1.639442,3,1.220336,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.611359,3,1.208015,
-	0,1,0,1.611359,3,1.208015,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.582203,3,1.198505,
-	0,1,0,1.582203,3,1.198505,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.552255,3,1.1919,
-	0,1,0,1.552255,3,1.1919,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.521805,3,1.188262,
-	0,1,0,1.521805,3,1.188262,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.5,3,1.187809,
-	0.840862,0,0.54125,1.715833,3,0.8525,
-	0.840862,0,0.54125,1.5,1.5,1.187809,
-	0.840862,0,0.54125,1.715833,1.5,0.8525,
-	0.840862,0,0.54125,1.5,1.5,1.187809,
-	0.840862,0,0.54125,1.715833,3,0.8525,
-	0.840862,0,0.54125,1.5,3,1.187809,
-	0,-1,0,1.5,3,1.187809,
-	0,-1,0,1.715833,3,0.8525,
-	0,-1,0,1.607917,3,1.020155,
-	1,0,0,1.715833,3,0.8525,
-	1,0,0,1.715833,1.5,1.274121,
-	1,0,0,1.715833,1.5,0.8525,
-	1,0,0,1.715833,1.5,1.274121,
-	1,0,0,1.715833,3,0.8525,
-	1,0,0,1.715833,3,1.274121,
-	-0.053432,0,0.998571,1.521805,1.5,1.188262,
-	-0.020743,0,0.999785,1.5,3,1.187809,
-	-0.020743,0,0.999785,1.5,1.5,1.187809,
-	-0.020743,0,0.999785,1.5,3,1.187809,
-	-0.053432,0,0.998571,1.521805,1.5,1.188262,
-	-0.086099,0,0.996287,1.521805,3,1.188262,
-	-0.151052,0,0.988526,1.552255,1.5,1.1919,
-	-0.086099,0,0.996287,1.521805,3,1.188262,
-	-0.053432,0,0.998571,1.521805,1.5,1.188262,
-	-0.086099,0,0.996287,1.521805,3,1.188262,
-	-0.151052,0,0.988526,1.552255,1.5,1.1919,
-	-0.183337,0,0.98305,1.552255,3,1.1919,
-	-0.247217,0,0.96896,1.582203,1.5,1.198505,
-	-0.183337,0,0.98305,1.552255,3,1.1919,
-	-0.151052,0,0.988526,1.552255,1.5,1.1919,
-	-0.183337,0,0.98305,1.552255,3,1.1919,
-	-0.247217,0,0.96896,1.582203,1.5,1.198505,
-	-0.27881,0,0.960346,1.582203,3,1.198505,
-	-0.341001,0,0.940063,1.611359,1.5,1.208015,
-	-0.27881,0,0.960346,1.582203,3,1.198505,
-	-0.247217,0,0.96896,1.582203,1.5,1.198505,
-	-0.27881,0,0.960346,1.582203,3,1.198505,
-	-0.341001,0,0.940063,1.611359,1.5,1.208015,
-	-0.371598,0,0.928394,1.611359,3,1.208015,
-	-0.431501,0,0.902112,1.639442,1.5,1.220336,
-	-0.371598,0,0.928394,1.611359,3,1.208015,
-	-0.341001,0,0.940063,1.611359,1.5,1.208015,
-	-0.371598,0,0.928394,1.611359,3,1.208015,
-	-0.431501,0,0.902112,1.639442,1.5,1.220336,
-	-0.460807,0,0.8875,1.639442,3,1.220336,
-	-0.517846,0,0.855474,1.666182,1.5,1.23535,
-	-0.460807,0,0.8875,1.639442,3,1.220336,
-	-0.431501,0,0.902112,1.639442,1.5,1.220336,
-	-0.460807,0,0.8875,1.639442,3,1.220336,
-	-0.517846,0,0.855474,1.666182,1.5,1.23535,
-	-0.545579,0,0.83806,1.666182,3,1.23535,
-	-0.599204,0,0.800597,1.691322,1.5,1.252913,
-	-0.545579,0,0.83806,1.666182,3,1.23535,
-	-0.517846,0,0.855474,1.666182,1.5,1.23535,
-	-0.545579,0,0.83806,1.666182,3,1.23535,
-	-0.599204,0,0.800597,1.691322,1.5,1.252913,
-	-0.625096,0,0.780548,1.691322,3,1.252913,
-	-0.686784,0,0.726862,1.71462,1.5,1.272856,
-	-0.625096,0,0.780548,1.691322,3,1.252913,
-	-0.599204,0,0.800597,1.691322,1.5,1.252913,
-	-0.625096,0,0.780548,1.691322,3,1.252913,
-	-0.686784,0,0.726862,1.71462,1.5,1.272856,
-	-0.686784,0,0.726862,1.71462,3,1.272856,
-	-0.721622,0,0.692287,1.715833,3,1.274121,
-	-0.686784,0,0.726862,1.71462,1.5,1.272856,
-	-0.721622,0,0.692287,1.715833,1.5,1.274121,
-	-0.686784,0,0.726862,1.71462,1.5,1.272856,
-	-0.721622,0,0.692287,1.715833,3,1.274121,
-	-0.686784,0,0.726862,1.71462,3,1.272856,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.705014,1.5,1.73585,
-	0,-1,0,1.715833,1.5,1.725471,
-	0,-1,0,1.705014,1.5,1.73585,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.68091,1.5,1.75481,
-	0,-1,0,1.68091,1.5,1.75481,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.655063,1.5,1.771315,
-	0,-1,0,1.655063,1.5,1.771315,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.627723,1.5,1.785207,
-	0,-1,0,1.627723,1.5,1.785207,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.599152,1.5,1.796353,
-	0,-1,0,1.599152,1.5,1.796353,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.569627,1.5,1.804645,
-	0,-1,0,1.569627,1.5,1.804645,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.539432,1.5,1.810002,
-	0,-1,0,1.539432,1.5,1.810002,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.508856,1.5,1.812374,
-	0,-1,0,1.715833,1.5,2.1475,
-	0,-1,0,1.5,1.5,1.812191,
-	0,-1,0,1.508856,1.5,1.812374,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.521805,1.5,1.188262,
-	0,-1,0,1.5,1.5,1.187809,
-	0,-1,0,1.521805,1.5,1.188262,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.552255,1.5,1.1919,
-	0,-1,0,1.552255,1.5,1.1919,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.582203,1.5,1.198505,
-	0,-1,0,1.582203,1.5,1.198505,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.611359,1.5,1.208015,
-	0,-1,0,1.611359,1.5,1.208015,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.639442,1.5,1.220336,
-	0,-1,0,1.639442,1.5,1.220336,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.666182,1.5,1.23535,
-	0,-1,0,1.666182,1.5,1.23535,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.691322,1.5,1.252913,
-	0,-1,0,1.691322,1.5,1.252913,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.71462,1.5,1.272856,
-	0,-1,0,1.71462,1.5,1.272856,
-	0,-1,0,1.715833,1.5,0.8525,
-	0,-1,0,1.715833,1.5,1.274121,
-	0,1,0,0,3,2.536,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0,3,2.277,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0,3,2.536,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.536,
-	0,1,0,0,3,2.795,
-	0,1,0,0,3,0.464,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.464,
-	0,1,0,0.205,3,0.723,
-	0,1,0,0.205,3,0.723,
-	0,1,0,0,3,0.464,
-	0,1,0,0,3,0.723,
-	0,1,0,0.777,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.87868,3,0,
-	0,1,0,1.201631,3,0,
-	0,1,0,0.777,3,0,
-	0,1,0,1.295,3,0,
-	0,1,0,1.295,3,0,
-	0,1,0,0.777,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.777,3,0,
-	0,1,0,0.777,3,0.205,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,1.715833,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.53125,3,2.277,
-	0,1,0,0.205,3,2.277,
-	0,1,0,0.53125,3,2.277,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.777,3,2.795,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.777,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.723,3,0.982,
-	0,1,0,0.723,3,0.982,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.53125,3,0.982,
-	0,1,0,1.0625,3,1.241,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.0625,3,1.241,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,1.715833,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.715833,3,0.8525,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.0625,3,1.5,
-	0,1,0,1.0625,3,1.759,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.796875,3,0.982,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,0.796875,3,0.982,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.723,3,0.982,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.0625,3,1.759,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,1.0625,3,1.759,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.715833,3,2.1475,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.715833,3,0.8525,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.715833,3,0.8525,
-	0,0,1,2.1475,1.5,0.8525,
-	0,0,1,1.715833,3,0.8525,
-	0,0,1,1.715833,1.5,0.8525,
-	0,0,1,1.715833,3,0.8525,
-	0,0,1,2.1475,1.5,0.8525,
-	0,0,1,2.1475,3,0.8525,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.715833,3,2.1475,
-	0,0,-1,2.1475,3,2.1475,
-	0,0,-1,1.715833,1.5,2.1475,
-	0,0,-1,1.715833,3,2.1475,
-	0,0,-1,1.715833,1.5,2.1475,
-	0,0,-1,2.1475,3,2.1475,
-	0,0,-1,2.1475,1.5,2.1475,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,0.796875,3,1.241,
-	0,1,0,1.0625,3,1.241,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.796875,3,2.018,
-	0,1,0,0.723,3,2.018,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.796875,3,1.759,
-	0,1,0,0.796875,3,2.018,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.777,3,0.205,
-	0,1,0,0.53125,3,0.723,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0.205,3,0.723,
-	-0.956392,0,-0.292087,0.53125,3,0.723,
-	-0.956392,0,-0.292087,0.777,1.5,0.205,
-	-0.989278,0,-0.146043,0.53125,1.5,0.723,
-	-0.956392,0,-0.292087,0.777,1.5,0.205,
-	-0.956392,0,-0.292087,0.53125,3,0.723,
-	-0.998843,0,-0.048086,0.777,3,0.205,
-	0,1,0,0.53125,3,2.277,
-	0,1,0,0.723,3,2.018,
-	0,1,0,0.53125,3,2.018,
-	0,1,0,0.723,3,2.018,
-	0,1,0,0.53125,3,2.277,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.53125,3,2.277,
-	0,1,0,0.777,3,2.795,
-	0,-1,0,1.5,1.5,1.5,
-	0,-1,0,1.0625,1.5,1.241,
-	0,-1,0,1.5,1.5,1.187809,
-	0,-1,0,1.0625,1.5,1.241,
-	0,-1,0,1.5,1.5,1.5,
-	0,-1,0,1.0625,1.5,1.5,
-	1,0,0,1.5,3,1.187809,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,1.5,1.187809,
-	1,0,0,1.5,1.5,1.5,
-	1,0,0,1.5,3,1.187809,
-	1,0,0,1.5,3,1.5,
-	0,1,0,1.715833,3,2.1475,
-	0,1,0,1.715833,3,1.725471,
-	0,1,0,1.607917,3,1.979845,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.715833,3,1.274121,
-	0,1,0,1.715833,3,0.8525,
-	0,1,0,1.715833,3,1.274121,
-	0,1,0,1.607917,3,1.020155,
-	0,1,0,1.71462,3,1.272856,
-	-0.707107,0,0.707107,2.1475,3,1.284167,
-	-0.707107,0,0.707107,1.715833,1.5,0.8525,
-	-0.707107,0,0.707107,2.1475,1.5,1.284167,
-	-0.707107,0,0.707107,1.715833,1.5,0.8525,
-	-0.707107,0,0.707107,2.1475,3,1.284167,
-	-0.707107,0,0.707107,1.715833,3,0.8525
-};
-static const struct gllist lament_model_taser_b_frame = { GL_N3F_V3F, GL_TRIANGLES, 990, lament_model_taser_b_data, 0 };
-const struct gllist *lament_model_taser_b = &lament_model_taser_b_frame;
-
-static const float lament_model_taser_base_data[] = {
-	0.341001,0,-0.940063,1.611359,3,1.208015,
-	0.27881,0,-0.960346,1.582203,1.5,1.198505,
-	0.247217,0,-0.96896,1.582203,3,1.198505,
-	0.27881,0,-0.960346,1.582203,1.5,1.198505,
-	0.341001,0,-0.940063,1.611359,3,1.208015,
-	0.371598,0,-0.928394,1.611359,1.5,1.208015,
-	0,1,0,1.295,1.5,0,
-	0,1,0,1.5,1.5,1.187809,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.5,1.5,1.187809,
-	0,1,0,1.295,1.5,0,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.5,1.5,1.187809,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.5,1.5,1.812191,
-	0,1,0,1.5,1.5,1.812191,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.508856,1.5,1.812374,
-	0,1,0,1.508856,1.5,1.812374,
-	0,1,0,1.295,1.5,3,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.295,1.5,3,
-	0,1,0,2.1475,1.5,2.1475,
-	0,1,0,2.1475,1.5,2.1475,
-	0,1,0,2.1475,1.5,1.715833,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.705014,1.5,1.73585,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.715833,1.5,1.725471,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.705014,1.5,1.73585,
-	0,1,0,1.68091,1.5,1.75481,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.68091,1.5,1.75481,
-	0,1,0,1.655063,1.5,1.771315,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.655063,1.5,1.771315,
-	0,1,0,1.627723,1.5,1.785207,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.627723,1.5,1.785207,
-	0,1,0,1.599152,1.5,1.796353,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.599152,1.5,1.796353,
-	0,1,0,1.569627,1.5,1.804645,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.569627,1.5,1.804645,
-	0,1,0,1.539432,1.5,1.810002,
-	0,1,0,1.715833,1.5,2.1475,
-	0,1,0,1.539432,1.5,1.810002,
-	0,1,0,1.508856,1.5,1.812374,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.71462,1.5,1.272856,
-	0,1,0,1.715833,1.5,1.274121,
-	0,1,0,1.71462,1.5,1.272856,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.691322,1.5,1.252913,
-	0,1,0,1.691322,1.5,1.252913,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.666182,1.5,1.23535,
-	0,1,0,1.666182,1.5,1.23535,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.639442,1.5,1.220336,
-	0,1,0,1.639442,1.5,1.220336,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.611359,1.5,1.208015,
-	0,1,0,1.611359,1.5,1.208015,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.582203,1.5,1.198505,
-	0,1,0,1.582203,1.5,1.198505,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.552255,1.5,1.1919,
-	0,1,0,1.552255,1.5,1.1919,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.521805,1.5,1.188262,
-	0,1,0,1.521805,1.5,1.188262,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,1.5,1.5,1.187809,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,2.1475,1.5,0.8525,
-	0,1,0,1.295,1.5,0,
-	0,1,0,2.1475,1.5,0.8525,
-	0,1,0,1.715833,1.5,0.8525,
-	0,1,0,2.1475,1.5,1.284167,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.193196,0,
-	0,0,-1,1.295,1.295,0,
-	0.206815,0,0.97838,1.569627,1.5,1.804645,
-	0.142406,0,0.989808,1.539432,3,1.810002,
-	0.109921,0,0.99394,1.539432,1.5,1.810002,
-	0.142406,0,0.989808,1.539432,3,1.810002,
-	0.206815,0,0.97838,1.569627,1.5,1.804645,
-	0.238739,0,0.971084,1.569627,3,1.804645,
-	0.565482,0,0.824761,1.68091,1.5,1.75481,
-	0.51035,0,0.859967,1.655063,3,1.771315,
-	0.481919,0,0.876216,1.655063,1.5,1.771315,
-	0.51035,0,0.859967,1.655063,3,1.771315,
-	0.565482,0,0.824761,1.68091,1.5,1.75481,
-	0.592184,0,0.805803,1.68091,3,1.75481,
-	0.053432,0,-0.998571,1.521805,3,1.188262,
-	0.020743,0,-0.999785,1.5,1.5,1.187809,
-	0.020743,0,-0.999785,1.5,3,1.187809,
-	0.020743,0,-0.999785,1.5,1.5,1.187809,
-	0.053432,0,-0.998571,1.521805,3,1.188262,
-	0.086099,0,-0.996287,1.521805,1.5,1.188262,
-	-1,0,0,1.5,3,1.812191,
-	-1,0,0,1.5,1.5,1.187809,
-	-1,0,0,1.5,1.5,1.812191,
-	-1,0,0,1.5,1.5,1.187809,
-	-1,0,0,1.5,3,1.812191,
-	-1,0,0,1.5,3,1.187809,
-	-0.569325,0.581384,-0.581259,1.5,3,1.187809,
-	-0.216196,0.95311,0.211757,1.5,3,1.812191,
-	0,1,0,1.5,3,1.5,
-	-1,0,0,1.715833,3,2.1475,
-	-1,0,0,1.715833,1.5,1.725471,
-	-1,0,0,1.715833,1.5,2.1475,
-	-1,0,0,1.715833,1.5,1.725471,
-	-1,0,0,1.715833,3,2.1475,
-	-1,0,0,1.715833,3,1.725471,
-	0.247217,0,-0.96896,1.582203,3,1.198505,
-	0.183337,0,-0.98305,1.552255,1.5,1.1919,
-	0.151052,0,-0.988526,1.552255,3,1.1919,
-	0.183337,0,-0.98305,1.552255,1.5,1.1919,
-	0.247217,0,-0.96896,1.582203,3,1.198505,
-	0.27881,0,-0.960346,1.582203,1.5,1.198505,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,2.1475,
-	0.707107,0,0.707107,2.1475,1.5,1.715833,
-	0.707107,0,0.707107,1.715833,3,2.1475,
-	0.707107,0,0.707107,1.715833,1.5,2.1475,
-	0.707107,0,0.707107,1.715833,3,2.1475,
-	0.707107,0,0.707107,2.1475,1.5,1.715833,
-	0.707107,0,0.707107,2.1475,3,1.715833,
-	0.517846,0,-0.855474,1.666182,3,1.23535,
-	0.460807,0,-0.8875,1.639442,1.5,1.220336,
-	0.431501,0,-0.902112,1.639442,3,1.220336,
-	0.460807,0,-0.8875,1.639442,1.5,1.220336,
-	0.517846,0,-0.855474,1.666182,3,1.23535,
-	0.545579,0,-0.83806,1.666182,1.5,1.23535,
-	0.599204,0,-0.800597,1.691322,3,1.252913,
-	0.545579,0,-0.83806,1.666182,1.5,1.23535,
-	0.517846,0,-0.855474,1.666182,3,1.23535,
-	0.545579,0,-0.83806,1.666182,1.5,1.23535,
-	0.599204,0,-0.800597,1.691322,3,1.252913,
-	0.625096,0,-0.780548,1.691322,1.5,1.252913,
-	0.686784,0,-0.726862,1.71462,3,1.272856,
-	0.625096,0,-0.780548,1.691322,1.5,1.252913,
-	0.599204,0,-0.800597,1.691322,3,1.252913,
-	0.625096,0,-0.780548,1.691322,1.5,1.252913,
-	0.686784,0,-0.726862,1.71462,3,1.272856,
-	0.686784,0,-0.726862,1.71462,1.5,1.272856,
-	0.707107,0,-0.707107,1.715833,3,0.8525,
-	0.707107,0,-0.707107,2.1475,1.5,1.284167,
-	0.707107,0,-0.707107,1.715833,1.5,0.8525,
-	0.707107,0,-0.707107,2.1475,1.5,1.284167,
-	0.707107,0,-0.707107,1.715833,3,0.8525,
-	0.707107,0,-0.707107,2.1475,3,1.284167,
-	-1,0,0,2.1475,3,2.1475,
-	-1,0,0,2.1475,1.5,1.715833,
-	-1,0,0,2.1475,1.5,2.1475,
-	-1,0,0,2.1475,1.5,1.715833,
-	-1,0,0,2.1475,3,2.1475,
-	-1,0,0,2.1475,3,1.715833,
-	0.109921,0,0.99394,1.539432,1.5,1.810002,
-	0.044703,0,0.999,1.508856,3,1.812374,
-	0.011969,0,0.999928,1.508856,1.5,1.812374,
-	0.044703,0,0.999,1.508856,3,1.812374,
-	0.109921,0,0.99394,1.539432,1.5,1.810002,
-	0.142406,0,0.989808,1.539432,3,1.810002,
-	0.011969,0,0.999928,1.508856,1.5,1.812374,
-	-0.020743,0,0.999785,1.5,3,1.812191,
-	-0.020743,0,0.999785,1.5,1.5,1.812191,
-	-0.020743,0,0.999785,1.5,3,1.812191,
-	0.011969,0,0.999928,1.508856,1.5,1.812374,
-	0.044703,0,0.999,1.508856,3,1.812374,
-	0.393714,0,0.919233,1.627723,1.5,1.785207,
-	0.332772,0,0.943007,1.599152,3,1.796353,
-	0.301717,0,0.953397,1.599152,1.5,1.796353,
-	0.332772,0,0.943007,1.599152,3,1.796353,
-	0.393714,0,0.919233,1.627723,1.5,1.785207,
-	0.423601,0,0.905849,1.627723,3,1.785207,
-	0.301717,0,0.953397,1.599152,1.5,1.796353,
-	0.238739,0,0.971084,1.569627,3,1.804645,
-	0.206815,0,0.97838,1.569627,1.5,1.804645,
-	0.238739,0,0.971084,1.569627,3,1.804645,
-	0.301717,0,0.953397,1.599152,1.5,1.796353,
-	0.332772,0,0.943007,1.599152,3,1.796353,
-	-1,0,0,1.715833,3,1.274121,
-	-1,0,0,1.715833,1.5,0.8525,
-	-1,0,0,1.715833,1.5,1.274121,
-	-1,0,0,1.715833,1.5,0.8525,
-	-1,0,0,1.715833,3,1.274121,
-	-1,0,0,1.715833,3,0.8525,
-	0.481919,0,0.876216,1.655063,1.5,1.771315,
-	0.423601,0,0.905849,1.627723,3,1.785207,
-	0.393714,0,0.919233,1.627723,1.5,1.785207,
-	0.423601,0,0.905849,1.627723,3,1.785207,
-	0.481919,0,0.876216,1.655063,1.5,1.771315,
-	0.51035,0,0.859967,1.655063,3,1.771315,
-	0.151052,0,-0.988526,1.552255,3,1.1919,
-	0.086099,0,-0.996287,1.521805,1.5,1.188262,
-	0.053432,0,-0.998571,1.521805,3,1.188262,
-	0.086099,0,-0.996287,1.521805,1.5,1.188262,
-	0.151052,0,-0.988526,1.552255,3,1.1919,
-	0.183337,0,-0.98305,1.552255,1.5,1.1919,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0.205,0,
-	-0.707107,0,-0.707107,1.295,1.540777,3,
-	-0.707107,0,-0.707107,2.1475,1.5,2.1475,
-	-0.707107,0,-0.707107,1.295,1.5,3,
-	-0.707107,0,-0.707107,2.1475,1.5,2.1475,
-	-0.707107,0,-0.707107,1.295,1.540777,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.540777,3,
-	-0.707107,0,-0.707107,1.295,1.584914,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.584914,3,
-	-0.707107,0,-0.707107,1.295,1.636977,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.636977,3,
-	-0.707107,0,-0.707107,1.295,1.705,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.705,3,
-	-0.707107,0,-0.707107,1.295,1.806804,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.806804,3,
-	-0.707107,0,-0.707107,1.295,1.994914,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,1.994914,3,
-	-0.707107,0,-0.707107,1.295,2.231186,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,2.231186,3,
-	-0.707107,0,-0.707107,1.295,2.530605,3,
-	-0.707107,0,-0.707107,2.1475,3,2.1475,
-	-0.707107,0,-0.707107,1.295,2.530605,3,
-	-0.707107,0,-0.707107,1.295,3,3,
-	-0.765259,0.274484,-0.582269,2.1475,3,2.1475,
-	-0.397052,0.561517,0.725981,1.295,3,3,
-	0,1,0,1.5,3,2.795,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,1.295,1.5,3,
-	-1,0,0,2.1475,3,1.284167,
-	-1,0,0,2.1475,1.5,0.8525,
-	-1,0,0,2.1475,1.5,1.284167,
-	-1,0,0,2.1475,1.5,0.8525,
-	-1,0,0,2.1475,3,1.284167,
-	-1,0,0,2.1475,3,0.8525,
-	0.6436,0,0.765362,1.705014,1.5,1.73585,
-	0.592184,0,0.805803,1.68091,3,1.75481,
-	0.565482,0,0.824761,1.68091,1.5,1.75481,
-	0.592184,0,0.805803,1.68091,3,1.75481,
-	0.6436,0,0.765362,1.705014,1.5,1.73585,
-	0.682921,0.000198,0.730492,1.705014,3,1.73585,
-	0.431501,0,-0.902112,1.639442,3,1.220336,
-	0.371598,0,-0.928394,1.611359,1.5,1.208015,
-	0.341001,0,-0.940063,1.611359,3,1.208015,
-	0.371598,0,-0.928394,1.611359,1.5,1.208015,
-	0.431501,0,-0.902112,1.639442,3,1.220336,
-	0.460807,0,-0.8875,1.639442,1.5,1.220336,
-	0.686784,0,-0.726862,1.71462,3,1.272856,
-	0.721622,0,-0.692287,1.715833,1.5,1.274121,
-	0.686784,0,-0.726862,1.71462,1.5,1.272856,
-	0.721622,0,-0.692287,1.715833,1.5,1.274121,
-	0.686784,0,-0.726862,1.71462,3,1.272856,
-	0.721622,0,-0.692287,1.715833,3,1.274121,
-	0.713423,0.000297,0.700733,1.715833,1.5,1.725471,
-	0.682921,0.000198,0.730492,1.705014,3,1.73585,
-	0.6436,0,0.765362,1.705014,1.5,1.73585,
-	0.682921,0.000198,0.730492,1.705014,3,1.73585,
-	0.713423,0.000297,0.700733,1.715833,1.5,1.725471,
-	0.733929,0.000594,0.679226,1.71462,3,1.725471,
-	0,0,1,1.71462,3,1.725471,
-	0,0,1,1.715833,1.5,1.725471,
-	0,0,1,1.715833,3,1.725471,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.540777,0,
-	-0.707107,0,0.707107,1.295,1.5,0,
-	-0.707107,0,0.707107,1.295,1.540777,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.584914,0,
-	-0.707107,0,0.707107,1.295,1.584914,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.636977,0,
-	-0.707107,0,0.707107,1.295,1.636977,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.705,0,
-	-0.707107,0,0.707107,1.295,1.705,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.806804,0,
-	-0.707107,0,0.707107,1.295,1.806804,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,1.994914,0,
-	-0.707107,0,0.707107,1.295,1.994914,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,2.231186,0,
-	-0.707107,0,0.707107,1.295,2.231186,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,2.530605,0,
-	-0.707107,0,0.707107,1.295,2.530605,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.295,3,0,
-	-0.707107,0,0.707107,1.295,3,0,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,1.5,3,0.205,
-	-0.707107,0,0.707107,1.5,3,0.205,
-	-0.707107,0,0.707107,2.1475,1.5,0.8525,
-	-0.707107,0,0.707107,2.1475,3,0.8525,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.295,0,
-	0,0,-1,1.295,1.363023,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.459223,0,
-	0,0,-1,1.295,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.806804,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.415086,0,
-	0,0,-1,1.295,1.459223,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.5,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.295,2.231186,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,1.295,2.231186,0,
-	0,0,-1,1.295,1.994914,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.636977,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0.436436,-0.218218,-0.872872,3,0,0,
-	0.6,0,-0.8,3,0.497732,0,
-	1,0,0,3,0.205,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.497732,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,0.87868,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.201631,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.295,3,0,
-	0,0,-1,1.295,2.530605,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,3,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.295,0,0,
-	0,0,-1,1.295,0.469395,0,
-	0,0,-1,1.295,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.705,0,
-	0,0,-1,1.295,1.806804,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.798369,3,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.363023,0,
-	0,0,-1,1.295,1.415086,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.798369,0,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,2.12132,0,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,2.12132,3,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,3,1.5,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.502268,3,0,
-	0,0,-1,2.795,3,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.795,3,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,2.502268,0,
-	0.447214,0,-0.894427,3,2.502268,0,
-	0.408248,0.408248,-0.816497,3,3,0,
-	1,0,0,3,2.795,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.295,0.469395,0,
-	0,0,-1,1.295,0.768814,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,0.768814,0,
-	0,0,-1,1.295,1.005086,0,
-	0,0,-1,1.295,0.768814,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,3,2.502268,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,3,2.12132,0,
-	0,0,-1,3,1.798369,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.502268,0,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,3,0,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.351731,2.245397,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,2.25634,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,2.26,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.574493,2.25634,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.574493,0.74366,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.648269,2.245397,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.648269,0.754603,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.720616,2.227275,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.720616,0.772725,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.790839,2.202148,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.790839,0.797852,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.858262,2.17026,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.858262,0.82974,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.922233,2.131917,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.922233,0.868083,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,1.982139,2.087488,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,1.982139,0.912512,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.037401,2.037401,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.037401,0.962599,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.087488,1.982139,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.087488,1.017861,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.131917,1.922233,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.131917,1.077767,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.17026,1.858262,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.17026,1.141738,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.202148,1.790839,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.202148,1.209161,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.227275,1.720616,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.227275,1.279384,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.245397,1.648269,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.245397,1.351731,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.25634,1.425507,0,
-	0,0,-1,2.25634,1.574493,0,
-	0,0,-1,2.26,1.5,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.351731,0.754603,0,
-	0,0,-1,1.425507,0.74366,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.5,0.74,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.005086,0,
-	0,0,-1,1.295,1.193196,0,
-	0,0,-1,1.5,1.5,0,
-	0,0,-1,1.295,1.540777,0,
-	0,0,-1,1.295,1.584914,0,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.5,3,
-	0,0,1,1.295,1.459223,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.295,2.231186,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,2.231186,3,
-	0,0,1,1.295,1.994914,3,
-	0,0,1,1.295,2.231186,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.363023,3,
-	0,0,1,1.295,1.295,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.295,0.469395,3,
-	0,0,1,1.295,0,3,
-	0,0,1,1.295,0.469395,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.415086,3,
-	0,0,1,1.295,1.363023,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.295,3,
-	0,0,1,1.295,1.193196,3,
-	0,0,1,3,0,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,3,0,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,3,0,3,
-	0,0,1,3,0.497732,3,
-	0.447214,0,0.894427,3,0.497732,3,
-	0.365148,-0.182574,0.912871,3,0,3,
-	1,0,0,3,0.205,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,3,0.497732,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,1.295,1.540777,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.459223,3,
-	0,0,1,1.295,1.415086,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.193196,3,
-	0,0,1,1.295,1.005086,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.295,0.768814,3,
-	0,0,1,1.295,0.469395,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,3,0.87868,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.502268,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.994914,3,
-	0,0,1,1.295,1.806804,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.705,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.295,1.636977,3,
-	0,0,1,1.295,1.584914,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.295,3,3,
-	0,0,1,1.295,2.530605,3,
-	0,0,1,1.295,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,3,0,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.295,1.005086,3,
-	0,0,1,1.295,0.768814,3,
-	0,0,1,1.295,1.005086,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,2.12132,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.201631,3,
-	0,0,1,3,1.5,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.798369,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,3,1.5,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,0,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,3,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,3,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,3,2.502268,3,
-	0.408248,0.408248,0.816497,3,3,3,
-	0.447214,0,0.894427,3,2.502268,3,
-	1,0,0,3,2.795,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.795,3,3,
-	0,0,1,2.795,3,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,3,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.12132,3,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,2.502268,3,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.351731,0.754603,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,0.74366,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,0.74,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.5,2.26,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.574493,0.74366,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.574493,2.25634,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.648269,0.754603,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.648269,2.245397,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.720616,0.772725,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.720616,2.227275,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.790839,0.797852,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.790839,2.202148,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.858262,0.82974,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.858262,2.17026,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.922233,2.131917,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.922233,0.868083,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,1.982139,0.912512,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,1.982139,2.087488,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.037401,0.962599,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.037401,2.037401,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.087488,1.017861,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.087488,1.982139,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.131917,1.077767,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.131917,1.922233,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.17026,1.141738,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.17026,1.858262,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.202148,1.209161,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.202148,1.790839,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.227275,1.279384,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.227275,1.720616,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.245397,1.648269,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.245397,1.351731,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.25634,1.574493,3,
-	0,0,1,2.25634,1.425507,3,
-	0,0,1,2.26,1.5,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.351731,2.245397,3,
-	0,0,1,1.425507,2.25634,3,
-	0,0,1,1.5,1.5,3,
-	0,0,1,1.5,2.26,3,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,3,0,0,
-	0,-1,0,2.502268,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,2.12132,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,1.798369,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,1.295,0,0,
-	0,-1,0,1.295,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,1.295,0,3,
-	0,-1,0,1.295,0,3,
-	0,-1,0,3,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,1.295,0,3,
-	0,-1,0,3,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,1.295,0,3,
-	0,-1,0,3,0,2.795,
-	0,-1,0,3,0,3,
-	0,0,1,1.295,0,3,
-	0,0,1,3,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,1.295,0,3,
-	0,0,1,2.502268,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.295,0,3,
-	0,0,1,2.12132,0,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.295,0,3,
-	0,0,1,1.798369,0,3,
-	0,0,1,1.5,0,3,
-	-1,0,0,1.295,0.469395,3,
-	-1,0,0,1.295,0,0,
-	-1,0,0,1.295,0,3,
-	-1,0,0,1.295,0,0,
-	-1,0,0,1.295,0.469395,3,
-	-1,0,0,1.295,0.469395,0,
-	-1,0,0,1.295,0.469395,0,
-	-1,0,0,1.295,0.469395,3,
-	-1,0,0,1.295,0.768814,0,
-	-1,0,0,1.295,0.768814,0,
-	-1,0,0,1.295,0.469395,3,
-	-1,0,0,1.295,0.768814,3,
-	-1,0,0,1.295,0.768814,0,
-	-1,0,0,1.295,0.768814,3,
-	-1,0,0,1.295,1.005086,3,
-	-1,0,0,1.295,0.768814,0,
-	-1,0,0,1.295,1.005086,3,
-	-1,0,0,1.295,1.005086,0,
-	-1,0,0,1.295,1.005086,0,
-	-1,0,0,1.295,1.005086,3,
-	-1,0,0,1.295,1.193196,0,
-	-1,0,0,1.295,1.193196,0,
-	-1,0,0,1.295,1.005086,3,
-	-1,0,0,1.295,1.193196,3,
-	-1,0,0,1.295,1.193196,0,
-	-1,0,0,1.295,1.193196,3,
-	-1,0,0,1.295,1.295,0,
-	-1,0,0,1.295,1.295,0,
-	-1,0,0,1.295,1.193196,3,
-	-1,0,0,1.295,1.295,3,
-	-1,0,0,1.295,1.295,0,
-	-1,0,0,1.295,1.295,3,
-	-1,0,0,1.295,1.363023,0,
-	-1,0,0,1.295,1.363023,0,
-	-1,0,0,1.295,1.295,3,
-	-1,0,0,1.295,1.363023,3,
-	-1,0,0,1.295,1.363023,0,
-	-1,0,0,1.295,1.363023,3,
-	-1,0,0,1.295,1.415086,3,
-	-1,0,0,1.295,1.363023,0,
-	-1,0,0,1.295,1.415086,3,
-	-1,0,0,1.295,1.415086,0,
-	-1,0,0,1.295,1.415086,0,
-	-1,0,0,1.295,1.415086,3,
-	-1,0,0,1.295,1.459223,3,
-	-1,0,0,1.295,1.415086,0,
-	-1,0,0,1.295,1.459223,3,
-	-1,0,0,1.295,1.459223,0,
-	-1,0,0,1.295,1.459223,0,
-	-1,0,0,1.295,1.459223,3,
-	-1,0,0,1.295,1.5,3,
-	-1,0,0,1.295,1.459223,0,
-	-1,0,0,1.295,1.5,3,
-	-1,0,0,1.295,1.5,0,
-	0,1,0,1.5,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.295,3,3,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,1.295,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,1.798369,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.12132,3,0,
-	0,1,0,2.12132,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.502268,3,0,
-	0,1,0,2.502268,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,3,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.502268,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.502268,3,3,
-	0,1,0,2.795,3,3,
-	0,0.447214,0.894427,2.502268,3,3,
-	0,0.514496,0.857493,1.5,3,3,
-	0,0,1,1.798369,3,3,
-	0,0.447214,0.894427,2.502268,3,3,
-	0,0,1,1.798369,3,3,
-	0,0,1,2.12132,3,3,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,2.1475,3,1.5,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,1.715833,3,1.274121,
-	0,1,0,1.71462,3,1.272856,
-	0,1,0,1.715833,3,1.274121,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,2.1475,3,1.5,
-	0,1,0,2.1475,3,1.284167,
-	0,1,0,1.715833,3,0.8525,
-	0,1,0,1.715833,3,1.274121,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,2.1475,3,1.5,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,2.1475,3,1.5,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,1.715833,3,1.725471,
-	0,1,0,2.1475,3,1.715833,
-	0,1,0,1.715833,3,1.725471,
-	0,1,0,1.715833,3,2.1475,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.521805,3,1.188262,
-	0,1,0,1.5,3,1.187809,
-	0,1,0,1.521805,3,1.188262,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.552255,3,1.1919,
-	0,1,0,1.552255,3,1.1919,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.582203,3,1.198505,
-	0,1,0,1.582203,3,1.198505,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.611359,3,1.208015,
-	0,1,0,1.611359,3,1.208015,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.639442,3,1.220336,
-	0,1,0,1.639442,3,1.220336,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.666182,3,1.23535,
-	0,1,0,1.666182,3,1.23535,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.691322,3,1.252913,
-	0,1,0,1.691322,3,1.252913,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.71462,3,1.272856,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.705014,3,1.73585,
-	0,1,0,1.705014,3,1.73585,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.68091,3,1.75481,
-	0,1,0,1.68091,3,1.75481,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.655063,3,1.771315,
-	0,1,0,1.655063,3,1.771315,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.627723,3,1.785207,
-	0,1,0,1.627723,3,1.785207,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.599152,3,1.796353,
-	0,1,0,1.599152,3,1.796353,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.569627,3,1.804645,
-	0,1,0,1.569627,3,1.804645,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.539432,3,1.810002,
-	0,1,0,1.539432,3,1.810002,
-	0,1,0,1.5,3,1.812191,
-	0,1,0,1.508856,3,1.812374,
-	0,1,0,1.71462,3,1.725471,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,1.5,3,1.5,
-	0,1,0,1.71462,3,1.5,
-	0,1,0,1.71462,3,1.272856,
-	0,1,0,1.5,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.1475,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0.205,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,1.5,
-	1,0,0,3,3,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,0.497732,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,0.87868,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.201631,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,0,3,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0.205,3,
-	1,0,0,3,0,3,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,3,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,2.795,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,0.205,1.5,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,1.5,
-	1,0,0,3,3,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.795,0,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,3,2.795,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.205,0,
-	1,0,0,3,0.205,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.497732,0,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,0.87868,0,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,1.201631,0,
-	1,0,0,3,1.5,0,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,1.5,2.795,
-	1,0,0,3,1.5,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,1.798369,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.12132,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.502268,3,
-	1,0,0,3,2.795,2.795,
-	1,0,0,3,2.795,3,
-	1,0,0,3,1.5,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,0.205,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.5,0,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,1.798369,0,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.12132,0,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0.205,
-	1,0,0,3,2.502268,0,
-	1,0,0,3,2.795,0,
-	1,0,0,3,3,3,
-	1,0,0,3,2.795,3,
-	1,0,0,3,2.795,2.795
-};
-static const struct gllist lament_model_taser_base_frame = { GL_N3F_V3F, GL_TRIANGLES, 1362, lament_model_taser_base_data, 0 };
-const struct gllist *lament_model_taser_base = &lament_model_taser_base_frame;
-
-static const float lament_model_tetra_base_data[] = {
-	0.57735,0.57735,0.57735,0,3,3,
-	0.57735,0.57735,0.57735,3,0,3,
-	0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,-0.57735,0.57735,0,3,3,
-	-0.57735,-0.57735,0.57735,0,0,0,
-	-0.57735,-0.57735,0.57735,3,0,3,
-	-0.57735,0.57735,-0.57735,3,3,0,
-	-0.57735,0.57735,-0.57735,0,0,0,
-	-0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,-0.57735,-0.57735,3,3,0,
-	0.57735,-0.57735,-0.57735,3,0,3,
-	0.57735,-0.57735,-0.57735,0,0,0
-};
-static const struct gllist lament_model_tetra_base_frame = { GL_N3F_V3F, GL_TRIANGLES, 12, lament_model_tetra_base_data, 0 };
-const struct gllist *lament_model_tetra_base = &lament_model_tetra_base_frame;
-
-static const float lament_model_tetra_dse_data[] = {
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.1475,0,2.1475,
-	0,0,-1,3,3,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,0,0,
-	0,0,-1,3,3,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,1.5,0,0,
-	0,0,-1,3,3,0,
-	0,0,-1,2.795,0,0,
-	0,0,-1,2.795,0,0,
-	0,0,-1,3,3,0,
-	0,0,-1,3,0,0,
-	1,0,0,3,3,0,
-	1,0,0,3,0,0.205,
-	1,0,0,3,0,0,
-	1,0,0,3,0,0.205,
-	1,0,0,3,3,0,
-	1,0,0,3,0,1.5,
-	1,0,0,3,0,1.5,
-	1,0,0,3,3,0,
-	1,0,0,3,0,2.795,
-	1,0,0,3,0,2.795,
-	1,0,0,3,3,0,
-	1,0,0,3,0,3,
-	-0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,0.57735,0.57735,2.795,0,2.795,
-	-0.57735,0.57735,0.57735,3,0,3,
-	-0.57735,0.57735,0.57735,2.795,0,2.795,
-	-0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,0.57735,0.57735,2.1475,0,2.1475,
-	-0.57735,0.57735,0.57735,2.1475,0,2.1475,
-	-0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,0.57735,0.57735,0.8525,0,0.8525,
-	-0.57735,0.57735,0.57735,0.8525,0,0.8525,
-	-0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,0.57735,0.57735,0.205,0,0.205,
-	-0.57735,0.57735,0.57735,0.205,0,0.205,
-	-0.57735,0.57735,0.57735,3,3,0,
-	-0.57735,0.57735,0.57735,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,3,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,2.795,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,0.205,0,0,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,3,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0,
-	0,-1,0,2.795,0,0,
-	0,-1,0,1.5,0,0,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,0.205,
-	0,-1,0,2.795,0,0.205,
-	0,-1,0,3,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,2.795,0,1.5,
-	0,-1,0,1.5,0,0.205,
-	0,-1,0,2.795,0,0.205
-};
-static const struct gllist lament_model_tetra_dse_frame = { GL_N3F_V3F, GL_TRIANGLES, 90, lament_model_tetra_dse_data, 0 };
-const struct gllist *lament_model_tetra_dse = &lament_model_tetra_dse_frame;
-
-static const float lament_model_tetra_dwn_data[] = {
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,0.205,
-	0,1,0,1.5,3,0.205,
-	-1,0,0,0,3,3,
-	-1,0,0,0,3,0,
-	-1,0,0,0,0,0,
-	-0.57735,0.57735,-0.57735,0,3,0,
-	-0.265408,0.893371,0.362555,0,3,3,
-	0,1,0,0,3,2.795,
-	-0.57735,0.57735,-0.57735,0,3,0,
-	0,1,0,0,3,2.795,
-	0,1,0,0,3,1.5,
-	-0.57735,0.57735,-0.57735,0,3,0,
-	0,1,0,0,3,1.5,
-	0,1,0,0,3,0.205,
-	0,0,-1,0.205,3,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0,3,0,
-	0,0,-1,0,0,0,
-	0,0,-1,0.205,3,0,
-	0,0,-1,3,3,0,
-	0.694747,0.50859,-0.50859,3,3,0,
-	0,0.83205,-0.5547,0.205,3,0,
-	0,1,0,1.5,3,0,
-	0.694747,0.50859,-0.50859,3,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,2.795,3,0,
-	0.57735,-0.57735,0.57735,2.795,3,0.205,
-	0.57735,-0.57735,0.57735,0,0,0,
-	0.57735,-0.57735,0.57735,3,3,0,
-	0.57735,-0.57735,0.57735,0,0,0,
-	0.57735,-0.57735,0.57735,2.795,3,0.205,
-	0.57735,-0.57735,0.57735,0,3,3,
-	-0.265408,0.893371,0.362555,0,3,3,
-	0.468609,0.748873,0.468609,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	-0.265408,0.893371,0.362555,0,3,3,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0,3,3,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,2.795,3,0,
-	0,1,0,1.5,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,0.205,
-	0,1,0,0.205,3,0.205,
-	0,1,0,0,3,1.5,
-	0,1,0,0.205,3,1.5,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0,
-	0,1,0,0.205,3,0,
-	0,1,0,1.5,3,0,
-	0,1,0,0.205,3,0.205,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,1.5,
-	0,1,0,1.5,3,0.205,
-	0,1,0,0.205,3,0.205
-};
-static const struct gllist lament_model_tetra_dwn_frame = { GL_N3F_V3F, GL_TRIANGLES, 90, lament_model_tetra_dwn_data, 0 };
-const struct gllist *lament_model_tetra_dwn = &lament_model_tetra_dwn_frame;
-
-static const float lament_model_tetra_une_data[] = {
-	1,0,0,3,3,0,
-	1,0,0,3,3,3,
-	1,0,0,3,0,3,
-	0.57735,0.57735,0.57735,3,3,3,
-	0.50859,0.50859,-0.694747,3,3,0,
-	0,1,0,3,3,0.205,
-	0.57735,0.57735,0.57735,3,3,3,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,1.5,
-	0.57735,0.57735,0.57735,3,3,3,
-	0,1,0,3,3,1.5,
-	0,1,0,3,3,2.795,
-	0,0,1,3,0,3,
-	0,0,1,0.205,3,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,3,3,
-	0,0,1,3,0,3,
-	0,0,1,1.5,3,3,
-	0,0,1,1.5,3,3,
-	0,0,1,3,0,3,
-	0,0,1,2.795,3,3,
-	0,0,1,2.795,3,3,
-	0,0,1,3,0,3,
-	0,0,1,3,3,3,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.795,3,0.205,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,3,3,0.205,
-	0,1,0,3,3,0,
-	0,1,0,2.795,3,0.205,
-	-0.57735,-0.57735,-0.57735,3,0,3,
-	-0.57735,-0.57735,-0.57735,2.795,3,0.205,
-	-0.57735,-0.57735,-0.57735,3,3,0,
-	-0.57735,-0.57735,-0.57735,2.795,3,0.205,
-	-0.57735,-0.57735,-0.57735,3,0,3,
-	-0.57735,-0.57735,-0.57735,2.1475,3,0.8525,
-	-0.57735,-0.57735,-0.57735,2.1475,3,0.8525,
-	-0.57735,-0.57735,-0.57735,3,0,3,
-	-0.57735,-0.57735,-0.57735,0.8525,3,2.1475,
-	-0.57735,-0.57735,-0.57735,0.8525,3,2.1475,
-	-0.57735,-0.57735,-0.57735,3,0,3,
-	-0.57735,-0.57735,-0.57735,0.205,3,2.795,
-	-0.57735,-0.57735,-0.57735,0.205,3,2.795,
-	-0.57735,-0.57735,-0.57735,3,0,3,
-	-0.57735,-0.57735,-0.57735,0,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,0.205,
-	0,1,0,3,3,0.205,
-	0,1,0,2.795,3,1.5,
-	0,1,0,3,3,1.5,
-	0,1,0,0.205,3,3,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,0.205,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,0.205,3,3,
-	0,1,0,1.5,3,3,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,2.795,3,1.5,
-	0,1,0,2.1475,3,0.8525,
-	0,1,0,2.795,3,1.5,
-	0,1,0,0.8525,3,2.1475,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,3,3,2.795,
-	0,1,0,2.795,3,3,
-	0,1,0,3,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,2.795,3,1.5,
-	0,1,0,1.5,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,2.795,
-	0,1,0,2.795,3,2.795,
-	0,1,0,1.5,3,3,
-	0,1,0,2.795,3,3
-};
-static const struct gllist lament_model_tetra_une_frame = { GL_N3F_V3F, GL_TRIANGLES, 90, lament_model_tetra_une_data, 0 };
-const struct gllist *lament_model_tetra_une = &lament_model_tetra_une_frame;
-
-static const float lament_model_tetra_usw_data[] = {
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,1.5,0,2.795,
-	0,0,1,0.205,0,3,
-	0,0,1,0,3,3,
-	0,0,1,0,0,3,
-	0,0,1,0,3,3,
-	0,0,1,0.205,0,3,
-	0,0,1,3,0,3,
-	0.694747,-0.50859,0.50859,3,0,3,
-	0,-0.83205,0.5547,0.205,0,3,
-	0,-1,0,1.5,0,3,
-	0.694747,-0.50859,0.50859,3,0,3,
-	0,-1,0,1.5,0,3,
-	0,-1,0,2.795,0,3,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,0,3,
-	-1,0,0,0,0,2.795,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,0,1.5,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,0,0.205,
-	-1,0,0,0,3,3,
-	-1,0,0,0,0,0,
-	0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,0.57735,-0.57735,0.205,0,0.205,
-	0.57735,0.57735,-0.57735,0,0,0,
-	0.57735,0.57735,-0.57735,0.205,0,0.205,
-	0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,0.57735,-0.57735,0.8525,0,0.8525,
-	0.57735,0.57735,-0.57735,0.8525,0,0.8525,
-	0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,0.57735,-0.57735,2.1475,0,2.1475,
-	0.57735,0.57735,-0.57735,2.1475,0,2.1475,
-	0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,0.57735,-0.57735,2.795,0,2.795,
-	0.57735,0.57735,-0.57735,2.795,0,2.795,
-	0.57735,0.57735,-0.57735,0,3,3,
-	0.57735,0.57735,-0.57735,3,0,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.8525,0,0.8525,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,1.5,0,3,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.1475,0,2.1475,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0,0,0,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0.205,0,3,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,0.205,0,3,
-	0,-1,0,0,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,1.5,0,3,
-	0,-1,0,0.205,0,3,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,0.205,
-	0,-1,0,0,0,0.205,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,0,0,1.5,
-	0,-1,0,0.205,0,2.795,
-	0,-1,0,0.205,0,1.5,
-	0,-1,0,1.5,0,2.795,
-	0,-1,0,2.795,0,3,
-	0,-1,0,2.795,0,2.795,
-	0,-1,0,3,0,3
-};
-static const struct gllist lament_model_tetra_usw_frame = { GL_N3F_V3F, GL_TRIANGLES, 90, lament_model_tetra_usw_data, 0 };
-const struct gllist *lament_model_tetra_usw = &lament_model_tetra_usw_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char lament_model[] =
+ "XSGLMSH1\036\000\000\000\000\000\000\000box\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\220"
+ "\007\000\000\004\000\000\000n\001\000\0000\006\000\000\030\003\000\000\000"
+ "\000\300\077\000\000\300\077\000\000\300\077\200\001@8iso_base_a\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\234.\000"
+ "\000\004\000\000\000\346\000\000\000Z\003\000\000\255\001\000\000\000\000"
+ "\300\077\000\000\300\077\000\000\300\077\200\001@8iso_base_b\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E\000\000"
+ "\004\000\000\000\345\000\000\000`\003\000\000\260\001\000\000\000\000\300"
+ "\077\000\000\300\077\000\000\300\077\200\001@8iso_den\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000t[\000\000"
+ "\004\000\000\000N\000\000\000\336\000\000\000o\000\000\000\134\217\366\077"
+ "\000\000\020@\000\000@\077\267q\0118iso_dse\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\370a\000\000\004\000"
+ "\000\000G\000\000\000\314\000\000\000f\000\000\000\000\000\020@\000\000@"
+ "\077\244p\211\077\267q\0118iso_dwn\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\360g\000\000\004\000\000\000"
+ "/\000\000\000x\000\000\000<\000\000\000q=\332>R\270$@q=\332>%\077Z7iso_s"
+ "wd\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\250k\000\000\004\000\000\000I\000\000\000\314\000\000\000f\000"
+ "\000\000\000\000@\077\244p\211\077\000\000@\077\267q\0118iso_une\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\264q\000\000\004\000\000\000G\000\000\000\314\000\000\000f\000\000\000"
+ "\000\000\020@\134\217\366\077\000\000\020@\267q\0118iso_unw\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\254"
+ "w\000\000\004\000\000\000H\000\000\000\314\000\000\000f\000\000\000\000\000"
+ "@\077\000\000\020@\134\217\366\077\267q\0118iso_use\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\254}\000\000"
+ "\004\000\000\000,\000\000\000l\000\000\0006\000\000\000R\270$@q=\332>R\270"
+ "$@%\077Z7iso_usw\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\024\201\000\000\004\000\000\000M\000\000\000"
+ "\336\000\000\000o\000\000\000\244p\211\077\000\000@\077\000\000\020@\267"
+ "q\0118leviathan\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\220\207\000\000\004\000\000\000\014\000\000\000\022\000"
+ "\000\000\011\000\000\000\0256\300\077\266\024\300\077\240\336\277\077G\264"
+ "*9lid_a\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000P\210\000\000\004\000\000\000\020\000\000\000\022"
+ "\000\000\000\011\000\000\000q=Z\077\000\000\000=\244p\011@\333\303\2457l"
+ "id_b\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\0008\211\000\000\004\000\000\000\020\000\000\000\022"
+ "\000\000\000\011\000\000\000\244p\011@\000\000\000=\244p\011@\333\303\245"
+ "7lid_base\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000 \212\000\000\004\000\000\000\200\001\000\0000\006\000\000"
+ "\034\003\000\000\000\000\300\077\000\000\300\077\000\000\300\077\200\001"
+ "@8lid_c\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\360\261\000\000\004\000\000\000\020\000\000\000"
+ "\022\000\000\000\011\000\000\000\244p\011@\000\000\000=q=Z\077\333\303\245"
+ "7lid_d\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\330\262\000\000\004\000\000\000\020\000\000\000"
+ "\022\000\000\000\011\000\000\000q=Z\077\000\000\000=q=Z\077\333\303\2457"
+ "pillar_a\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\300\263\000\000\004\000\000\000\002\001\000\000\000\003"
+ "\000\000\200\001\000\000\000\000\300\077\000\000\300\077\000\000\020@\341"
+ "\220\3027pillar_b\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\324\311\000\000\004\000\000\000\002\001\000\000"
+ "\000\003\000\000\200\001\000\000\000\000\300\077\000\000\300\077\000\000"
+ "@\077\341\220\3027pillar_base\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\350\337\000\000\004\000\000\000\352\001\000\000"
+ "$\006\000\000\022\003\000\000\000\000\300\077\000\000\300\077\000\000\300"
+ "\077\200\001@8star_d\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\234\013\001\000\004\000\000\000j\002"
+ "\000\000H\006\000\000\010\003\000\000\000\000\300\077\000\000\300\077\000"
+ "\000\300\077\200\001@8star_u\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000p<\001\000\004\000\000\000c\002"
+ "\000\000H\006\000\000\010\003\000\000\000\000\300\077\000\000\300\077\000"
+ "\000\300\077\200\001@8taser_a\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000m\001\000\004\000\000\000\354"
+ "\000\000\000F\002\000\000\037\001\000\000\217\302%\077\000\000\300\077\000"
+ "\000\300\077\200\001@8taser_b\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000@\177\001\000\004\000\000\000\177"
+ "\001\000\000\336\003\000\000\343\001\000\000\244p\211\077\000\000\020@\000"
+ "\000\300\077\200\001@8taser_base\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\200\235\001\000\004\000\000\000\225\001"
+ "\000\000R\005\000\000\251\002\000\000\244p\011@\000\000\300\077\000\000\300"
+ "\077\200\001@8tetra_base\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\234\302\001\000\004\000\000\000\014\000\000\000"
+ "\014\000\000\000\006\000\000\000\000\000\300\077\000\000\300\077\000\000"
+ "\300\077\200\001@8tetra_dse\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000D\303\001\000\004\000\000\000#\000\000\000Z\000"
+ "\000\000-\000\000\000\000\000\300\077\000\000\300\077\000\000\300\077\200"
+ "\001@8tetra_dwn\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\014\306\001\000\004\000\000\000 \000\000\000Z\000\000\000"
+ "-\000\000\000\000\000\300\077\000\000\300\077\000\000\300\077\200\001@8t"
+ "etra_une\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\264\310\001\000\004\000\000\000\042\000\000\000Z\000\000\000"
+ "-\000\000\000\000\000\300\077\000\000\300\077\000\000\300\077\200\001@8t"
+ "etra_usw\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000p\313\001\000\004\000\000\000#\000\000\000Z\000\000\000-\000"
+ "\000\000\000\000\300\077\000\000\300\077\000\000\300\077\200\001@8\001\200"
+ "\177\221\201n\000\000\001\200\001\200\201n\000\000\001\200\001\200\377\177"
+ "\000\000%\322\333-\377\177\000\000\177\221\377\177\377\177\000\000\001\200"
+ "\377\177\377\177\000\000z\252\377\177\377\177\000\000\334\326!2\377\177\000"
+ "\000\370\333\3545\377\177\000\000\377\177\000\000\201n\000\000\377\177\177"
+ "\221\377\177\000\000\377\177\177\221\201n\000\000\377\177z\252\377\177\000"
+ "\000\377\177\373\312\377\177\000\000\377\177\212\346\377\177\000\000\377"
+ "\177\000\000\377\177\000\000\001\200\377\177\000\000\000\000\177\221\377"
+ "\177\177\221\000\000\001\200\377\177\177\221\000\000\177\221\377\177\000"
+ "\000\000\000\201n\001\200\177\221\000\000\201n\001\200\001\200\000\000\377"
+ "\177\001\200\001\200\000\000\206U\377\177\001\200\000\000$)!2\001\200\000"
+ "\000\010$\3545\001\200\000\000\333-\333-\001\200\000\000\377\177\377\177"
+ "\001\200\000\000\377\177\377\177\001\200\000\000\206U\377\177\001\200\000"
+ "\000\201n\377\177\001\200\000\000\0055\377\177\001\200\000\000\222\03629"
+ "\001\200\000\000\321\030\352;\001\200\000\000[\006v\277\001\200\000\000\000"
+ "\000\001\200\001\200\000\000\000\000&\277\001\200\000\000v\031\001\200\001"
+ "\200\000\000\247\014e\300\001\200\000\000$)\337\315\001\200\000\000\206U"
+ "\001\200\001\200\000\000\010$\024\312\001\200\000\000\333-%\322\001\200\000"
+ "\000\377\177\001\200\001\200\000\000\206U\001\200\001\200\000\000\377\177"
+ "\001\200\001\200\000\000!2\334\326\001\200\000\000\3545\370\333\001\200\000"
+ "\000\377\177z\252\001\200\000\000\377\177z\252\001\200\000\000\377\177\177"
+ "\221\001\200\000\000\377\177\206U\001\200\000\00029\222\036\001\200\000\000"
+ "\3545\010$\001\200\000\000\352;\321\030\001\200\000\000\377\177\0055\001"
+ "\200\000\000\017>\323\022\001\200\000\000\233\077\247\014\001\200\000\000"
+ "\377\177v\031\001\200\000\000\024\312\370\333\001\200\000\000\001\200\177"
+ "\221\001\200\000\000\001\200z\252\001\200\000\000\001\200\001\200\001\200"
+ "\000\000\337\315\334\326\001\200\000\000%\322%\322\001\200\000\000\026\304"
+ "/\347\001\200\000\000\001\200\373\312\001\200\000\000\316\306n\341\001\200"
+ "\000\000\212@[\006\001\200\000\000\332@\000\000\001\200\000\000\377\177\000"
+ "\000\001\200\000\000Y\363e\300\001\200\000\000\212\346\001\200\001\200\000"
+ "\000\245\371v\277\001\200\000\000!2$)\001\200\000\000\377\177\206U\001\200"
+ "\000\000\377\177\201n\001\200\000\000%\322\333-\001\200\000\000\001\200\201"
+ "n\001\200\000\000\001\200\377\177\001\200\000\000\001\200\206U\001\200\000"
+ "\000\337\315$)\001\200\000\000\024\312\010$\001\200\000\000\001\200\0055"
+ "\001\200\000\000\316\306\222\036\001\200\000\000\026\304\321\030\001\200"
+ "\000\000\323\022\361\301\001\200\000\000\321\030\026\304\001\200\000\000"
+ "\0055\001\200\001\200\000\000\222\036\316\306\001\200\000\000\000\000\377"
+ "\177\001\200\000\000Y\363\233\077\001\200\000\000\212\346\377\177\001\200"
+ "\000\000\245\371\212@\001\200\000\000\000\000\332@\001\200\000\000/\347\352"
+ ";\001\200\000\000\373\312\377\177\001\200\000\000-\355\017>\001\200\000\000"
+ "&\277\000\000\001\200\000\000\001\200\212\346\001\200\000\000\001\200\000"
+ "\000\001\200\000\000v\277\245\371\001\200\000\000e\300Y\363\001\200\000\000"
+ "\212@\245\371\001\200\000\000\377\177\212\346\001\200\000\000\233\077Y\363"
+ "\001\200\000\000\017>-\355\001\200\000\000\377\177\373\312\001\200\000\000"
+ "\352;/\347\001\200\000\000e\300\247\014\001\200\000\000\001\200v\031\001"
+ "\200\000\000v\277[\006\001\200\000\000\370\333\024\312\001\200\000\000\373"
+ "\312\001\200\001\200\000\000z\252\001\200\001\200\000\000n\341\316\306\001"
+ "\200\000\000/\347\026\304\001\200\000\000-\355\361\301\001\200\000\000\361"
+ "\301-\355\001\200\000\000\177\221\001\200\001\200\000\000\334\326\337\315"
+ "\001\200\000\00029n\341\001\200\000\000\370\333\3545\001\200\000\000z\252"
+ "\377\177\001\200\000\000n\34129\001\200\000\000\177\221\377\177\001\200\000"
+ "\000\334\326!2\001\200\000\000v\031\377\177\001\200\000\000[\006\212@\001"
+ "\200\000\000\247\014\233\077\001\200\000\000\323\022\017>\001\200\000\000"
+ "\361\301\323\022\001\200\000\000\000\000\000\000\001\200\000\000v\031\001"
+ "\200\377\177\000\000\000\000&\277\377\177\000\000\000\000\001\200\377\177"
+ "\000\000[\006v\277\377\177\000\000\247\014e\300\377\177\000\000\323\022\361"
+ "\301\377\177\000\000\321\030\026\304\377\177\000\000\0055\001\200\377\177"
+ "\000\000\373\312\377\177\377\177\000\000n\34129\377\177\000\000/\347\352"
+ ";\377\177\000\000\212\346\377\177\377\177\000\000\032\363\332@\377\177\000"
+ "\000-\355\017>\377\177\000\000Y\363\233\077\377\177\000\000\206U\001\200"
+ "\377\177\000\000$)\337\315\377\177\000\000\010$\024\312\377\177\000\000\333"
+ "-%\322\377\177\000\000\377\177\001\200\377\177\000\000\377\177\001\200\377"
+ "\177\000\000\201n\001\200\377\177\000\000[\006\212@\377\177\000\000\000\000"
+ "\377\177\377\177\000\000\000\000\332@\377\177\000\000v\031\377\177\377\177"
+ "\000\000\247\014\233\077\377\177\000\000\245\371\212@\377\177\000\000\222"
+ "\036\316\306\377\177\000\000$)!2\377\177\000\000\206U\377\177\377\177\000"
+ "\000\010$\3545\377\177\000\000\333-\333-\377\177\000\000\377\177\377\177"
+ "\377\177\000\000\377\177\377\177\377\177\000\000\201n\377\177\377\177\000"
+ "\000\177\221\001\200\377\177\000\000%\322%\322\377\177\000\000\001\200\001"
+ "\200\377\177\000\000z\252\001\200\377\177\000\000\334\326\337\315\377\177"
+ "\000\000\370\333\024\312\377\177\000\000\373\312\001\200\377\177\000\000"
+ "n\341\316\306\377\177\000\000/\347\026\304\377\177\000\000!2$)\377\177\000"
+ "\000\3545\010$\377\177\000\000\377\177\206U\377\177\000\000\377\177\206U"
+ "\377\177\000\000\377\177\201n\377\177\000\000\001\200\177\221\377\177\000"
+ "\000\001\200z\252\377\177\000\000\337\315\334\326\377\177\000\000\024\312"
+ "\370\333\377\177\000\000\212\346\001\200\377\177\000\000-\355\361\301\377"
+ "\177\000\000Y\363e\300\377\177\000\000\245\371v\277\377\177\000\00029\222"
+ "\036\377\177\000\000\352;\321\030\377\177\000\000\377\177\0055\377\177\000"
+ "\000\017>\323\022\377\177\000\000\233\077\247\014\377\177\000\000\377\177"
+ "v\031\377\177\000\000e\300\247\014\377\177\000\000\001\200\0055\377\177\000"
+ "\000\001\200v\031\377\177\000\000\361\301\323\022\377\177\000\000\026\304"
+ "\321\030\377\177\000\000\026\304/\347\377\177\000\000\001\200\212\346\377"
+ "\177\000\000\001\200\373\312\377\177\000\000\361\301-\355\377\177\000\000"
+ "e\300Y\363\377\177\000\000\316\306n\341\377\177\000\000\377\177\373\312\377"
+ "\177\000\000\017>-\355\377\177\000\000\352;/\347\377\177\000\000\233\077"
+ "Y\363\377\177\000\000\377\177\212\346\377\177\000\000\212@\245\371\377\177"
+ "\000\000\332@\000\000\377\177\000\000\377\177\000\000\377\177\000\000\001"
+ "\200\206U\377\177\000\000\316\306\222\036\377\177\000\000\024\312\010$\377"
+ "\177\000\000\323\022\017>\377\177\000\000\321\030\352;\377\177\000\000\005"
+ "5\377\177\377\177\000\000\222\03629\377\177\000\000\212@[\006\377\177\000"
+ "\000\000\000\000\000\377\177\000\000\001\200\201n\377\177\000\000\337\315"
+ "$)\377\177\000\000\001\200\000\000\377\177\000\000v\277\245\371\377\177\000"
+ "\000&\277\000\000\377\177\000\000v\277[\006\377\177\000\000!2\334\326\377"
+ "\177\000\000\3545\370\333\377\177\000\000\377\177z\252\377\177\000\000\377"
+ "\177z\252\377\177\000\00029n\341\377\177\000\000\377\177\001\200\000\000"
+ "\000\000\377\177\001\200\177\221\000\000\201n\001\200\000\000\000\000\201"
+ "n\001\200\377\177\000\000\000\000\001\200\201n\000\000\201n\001\200\201n"
+ "\000\000\000\000\001\200\377\177\000\000\000\000\001\200\377\177\000\000"
+ "\201n\001\200\377\177\000\000\206U\001\200\377\177\000\000\0055\001\200\377"
+ "\177\000\000\177\221\001\200\000\000\000\000\001\200\001\200\177\221\000"
+ "\000\177\221\001\200\177\221\000\000\001\200\001\200\000\000\000\000\177"
+ "\221\001\200\201n\000\000\001\200\001\200\201n\000\000\377\177\001\200\377"
+ "\177\000\000\206U\001\200\001\200\000\000\0055\001\200\001\200\000\000v\031"
+ "\001\200\001\200\000\000\000\000\001\200\001\200\000\000\000\000\001\200"
+ "\177\221\000\000\212\346\001\200\001\200\000\000\373\312\001\200\001\200"
+ "\000\000z\252\001\200\001\200\000\000\177\221\001\200\001\200\000\000\300"
+ "\310\001\200\300\310\000\000\000\000\001\200\000\000\000\000\177\221\001"
+ "\200\377\177\000\000\177\221\001\200\377\177\000\000\373\312\001\200\377"
+ "\177\000\000z\252\001\200\377\177\000\000\377\177\001\200\201n\000\000\001"
+ "\200\377\177\201n\000\000\177\221\377\177\201n\000\000\377\177\377\177\377"
+ "\177\000\000\377\177\377\177\201n\000\000\201n\377\177\201n\000\000\000\000"
+ "\377\177\377\177\000\000\000\000\377\177\201n\000\000\000\000\377\177\377"
+ "\177\000\000\177\221\377\177\377\177\000\000\177\221\377\177\377\177\000"
+ "\000\177\221\377\177\001\200\000\000\001\200\377\177\001\200\000\000\377"
+ "\177\377\177\000\000\000\000\201n\377\177\000\000\000\000\377\177\377\177"
+ "\177\221\000\000\201n\377\177\177\221\000\000\377\177\377\177\001\200\000"
+ "\000z\252\377\177\001\200\000\000\373\312\377\177\001\200\000\000\212\346"
+ "\377\177\001\200\000\000\000\000\377\177\001\200\000\000\000\000\377\177"
+ "\177\221\000\000\001\200\377\177\377\177\000\000v\031\377\177\001\200\000"
+ "\000\0055\377\177\001\200\000\000\206U\377\177\001\200\000\000\001\200\177"
+ "\221\377\177\000\000\001\200\377\177\201n\000\000\001\200\201n\201n\000\000"
+ "\001\200\377\177\377\177\000\000\001\200\177\221\177\221\000\000\001\200"
+ "\177\221\001\200\000\000\001\200\001\200\001\200\000\000\001\200\201n\377"
+ "\177\000\000\001\200\000\000\177\221\000\000\001\200\000\000\000\000\000"
+ "\000\001\200\177\221\000\000\000\000\001\200\377\177\001\200\000\000\001"
+ "\200\201n\177\221\000\000\001\200\377\177\177\221\000\000\001\200\001\200"
+ "\177\221\000\000\001\200\201n\001\200\000\000\001\200\201n\000\000\000\000"
+ "\001\200z\252\377\177\000\000\001\200\000\000\201n\000\000\001\200\373\312"
+ "\377\177\000\000\001\200\212\346\377\177\000\000\001\200\000\000\377\177"
+ "\000\000\001\200z\252\001\200\000\000\001\200\373\312\001\200\000\000\001"
+ "\200\212\346\001\200\000\000\001\200\000\000\001\200\000\000\001\200\001"
+ "\200\000\000\000\000\001\200\377\177\000\000\000\000\001\200v\031\001\200"
+ "\000\000\001\200\0055\001\200\000\000\001\200\206U\001\200\000\000\001\200"
+ "v\031\377\177\000\000\001\200\0055\377\177\000\000\001\200\206U\377\177\000"
+ "\000\377\177\001\200\377\177\000\000\377\177\377\177\177\221\000\000\377"
+ "\177\201n\000\000\000\000\377\177\201n\177\221\000\000\377\177\377\177\000"
+ "\000\000\000\377\177\177\221\177\221\000\000\377\177\001\200\177\221\000"
+ "\000\377\177\001\200\001\200\000\000\377\177\201n\201n\000\000\377\177\377"
+ "\177\201n\000\000\377\177\377\177\377\177\000\000\377\177\377\177\001\200"
+ "\000\000\377\177\001\200\201n\000\000\377\177\177\221\000\000\000\000\377"
+ "\177\001\200\000\000\000\000\377\177\000\000\177\221\000\000\377\177z\252"
+ "\001\200\000\000\377\177\373\312\001\200\000\000\377\177\212\346\001\200"
+ "\000\000\377\177\000\000\001\200\000\000\377\177v\031\001\200\000\000\377"
+ "\177\0055\001\200\000\000\377\177\206U\001\200\000\000\377\177v\031\377\177"
+ "\000\000\377\177\0055\377\177\000\000\377\177\206U\377\177\000\000@7\001"
+ "\200\300\310\000\000\001\200\001\200\001\200\000\000\300\310\001\200@7\000"
+ "\000@7\001\200@7\000\000\001\200\001\200\377\177\000\000\300\310\377\177"
+ "\300\310\000\000@7\377\177@7\000\000\000\000\377\177\000\000\000\000@7\377"
+ "\177\300\310\000\000\300\310\377\177@7\000\000\201\000\201\000\201\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\000\177\000\177\000\177\000\177\000\201\000"
+ "\201\000\201\177\177\177\177\177\177\177\177\177\177__U\177\000\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177U\201_\241\177\177\177\177\177\177\177I\177\000\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177U\177\000\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000 \340\340\201\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000  \000\177\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000*\000\177\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "*\000\000\000\000\201\000\201\000\201\000\201\000\201\000\201\000\201\177"
+ "\177\177\177\177\177\177\177\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\177\177\177\177\177\177\000\201\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000*\000\177\000L\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\000\201\000\201\000\201\000\201\000\201\000"
+ "\177\000\177\000\177\000\177\000\177\000\000\001\000\002\000\003\000\004"
+ "\000\005\000\004\000\003\000\006\000\006\000\003\000\007\000\006\000\007"
+ "\000\010\000\011\000\012\000\013\000\012\000\011\000\014\000\014\000\011"
+ "\000\015\000\015\000\011\000\016\000\016\000\011\000\017\000\020\000\021"
+ "\000\022\000\021\000\020\000\023\000\024\000\025\000\026\000\027\000\030"
+ "\000\031\000\030\000\027\000\032\000\032\000\027\000\033\000\034\000\035"
+ "\000\036\000\037\000 \000!\000 \000\037\000\031\000\031\000\037\000\027\000"
+ "\042\000#\000$\000#\000\042\000%\000%\000\042\000&\000'\000(\000)\000(\000"
+ "'\000*\000(\000*\000+\000,\000-\000\025\000.\000+\000*\000+\000.\000/\000"
+ "+\000/\0000\000-\0001\0002\0003\0004\0005\0004\0003\0006\0006\0003\0007\000"
+ "7\0008\0006\0008\0007\0009\0009\0007\000:\000;\000<\000=\000<\000;\000>\000"
+ ">\000;\000\077\000>\000\077\000@\000A\000=\000B\000=\000A\000C\000=\000C"
+ "\000;\000:\000D\0009\000D\000:\000E\000E\000:\000F\000G\000#\000H\000#\000"
+ "G\000I\000#\000I\000$\000\033\000J\000\032\000J\000\033\0005\0005\000\033"
+ "\0003\000K\000\034\000L\000M\000N\000O\000N\000M\000P\000P\000M\000Q\000"
+ "P\000Q\000R\000R\000S\000P\000S\000R\000T\000S\000T\000U\000V\000%\000&\000"
+ "%\000V\000W\000%\000W\000X\000Y\000X\000W\000X\000Y\000)\000X\000)\000(\000"
+ "Z\000[\000\134\000[\000Z\000]\000]\000Z\000^\000\134\000_\000`\000_\000\134"
+ "\000a\000a\000\134\000[\000b\000c\000d\000c\000b\000e\000c\000e\000f\000"
+ "g\000h\000i\000h\000g\000E\000h\000E\000F\000j\000k\000l\000k\000j\000i\000"
+ "k\000i\000h\000m\000d\000n\000d\000m\000o\000d\000o\000b\000p\000q\000r\000"
+ "q\000p\000s\000q\000s\000t\000t\000H\000q\000H\000t\000u\000H\000u\000G\000"
+ "f\000B\000c\000B\000f\000v\000B\000v\000A\000@\000w\000>\000w\000@\000r\000"
+ "r\000@\000x\000r\000x\000p\000y\0000\000/\0000\000y\000l\0000\000l\000k\000"
+ "`\000z\000{\000z\000`\000|\000|\000`\000_\000}\000M\000O\000M\000}\000{\000"
+ "M\000{\000~\000~\000{\000z\000\177\000^\000Z\000^\000\177\000\200\000\200"
+ "\000\177\000\201\000\177\000\202\000\201\000\202\000\177\000!\000!\000\177"
+ "\000\037\000U\000n\000S\000n\000U\000\203\000n\000\203\000m\000l\000/\000"
+ "\204\000/\000l\000y\000\205\000\206\000\207\000\206\000\205\000\210\000\210"
+ "\000\205\000\211\000\205\000\212\000\211\000\212\000\205\000\213\000\213"
+ "\000\205\000\214\000\010\000\215\000\006\000\215\000\010\000\216\000\215"
+ "\000\216\000\217\000\217\000\220\000\215\000\220\000\217\000\221\000\221"
+ "\000\217\000\222\000\221\000\222\000\223\000\224\000\225\000\226\000\225"
+ "\000\224\000\227\000\227\000\224\000\230\000\231\000\224\000\232\000\233"
+ "\000\234\000\235\000\234\000\233\000\236\000\236\000\233\000\237\000\221"
+ "\000\234\000\220\000\234\000\221\000\223\000\234\000\223\000\240\000\234"
+ "\000\240\000\235\000\214\000\241\000\213\000\241\000\214\000\226\000\226"
+ "\000\214\000\224\000\242\000\243\000\244\000\243\000\242\000\245\000\243"
+ "\000\245\000\246\000\243\000\247\000\250\000\251\000\252\000\253\000\252"
+ "\000\251\000\254\000\252\000\254\000\255\000\255\000\254\000\256\000\257"
+ "\000\256\000\254\000\256\000\257\000\260\000\260\000\257\000\261\000\262"
+ "\000\246\000\245\000\246\000\262\000\263\000\246\000\263\000\264\000\247"
+ "\000\265\000\266\000\252\000\267\000\253\000\267\000\252\000\270\000\270"
+ "\000\252\000\271\000\270\000\271\000\272\000\273\000\261\000\257\000\261"
+ "\000\273\000\274\000\274\000\273\000\275\000\207\000\275\000\273\000\275"
+ "\000\207\000\276\000\276\000\207\000\206\000\277\000\264\000\263\000\264"
+ "\000\277\000\300\000\264\000\300\000\301\000\302\000\301\000\300\000\301"
+ "\000\302\000\303\000\301\000\303\000\304\000\305\000\306\000\307\000\306"
+ "\000\305\000\310\000\306\000\310\000\311\000\312\000\313\000\314\000\313"
+ "\000\312\000\315\000\313\000\315\000\316\000\272\000\314\000\270\000\314"
+ "\000\272\000\317\000\314\000\317\000\312\000\320\000\321\000\322\000\321"
+ "\000\320\000\323\000\323\000\320\000\324\000\324\000\325\000\323\000\325"
+ "\000\324\000\326\000\326\000\324\000\327\000\311\000\330\000\306\000\330"
+ "\000\311\000\331\000\330\000\331\000\332\000\333\000\236\000\237\000\236"
+ "\000\333\000\334\000\236\000\334\000\335\000\336\000\335\000\334\000\335"
+ "\000\336\000\244\000\335\000\244\000\243\000\337\000\304\000\303\000\304"
+ "\000\337\000\326\000\304\000\326\000\327\000\210\000\340\000\206\000\340"
+ "\000\210\000\211\000\332\000\341\000\330\000\341\000\332\000\005\000\005"
+ "\000\332\000\342\000\005\000\342\000\003\000\316\000\343\000\313\000\343"
+ "\000\316\000\344\000\343\000\344\000\345\000\345\000\307\000\343\000\307"
+ "\000\345\000\346\000\307\000\346\000\305\000\230\000\347\000\227\000\347"
+ "\000\230\000\350\000\350\000\230\000\351\000\352\000\231\000\012\000\351"
+ "\000\353\000\350\000\353\000\351\000\322\000\322\000\351\000\320\000\354"
+ "\000\024\000\355\000\024\000\354\000\356\000\357\000\360\000\361\000\360"
+ "\000\357\000\362\000\363\000\364\000\365\000\363\000\365\000\366\000\207"
+ "\000\214\000\205\000\367\000\370\000\371\000\370\000\367\000\372\000\373"
+ "\000\372\000\367\000\372\000\373\000\374\000\357\000\361\000\375\000\024"
+ "\000\376\000\025\000\376\000\024\000\377\000\377\000\024\000\000\001\000"
+ "\001\024\000\001\001\001\001\024\000\002\001\002\001\003\001\001\001\003"
+ "\001\002\001\004\001\004\001\002\001\005\001\005\001\002\001\006\001\006"
+ "\001\002\001\371\000\367\000\007\001\010\001\362\000\373\000\360\000\373"
+ "\000\362\000\011\001\251\000\207\000\273\000\251\000\273\000\257\000\012"
+ "\001\013\001\014\001\015\001\356\000\354\000\356\000\015\001\361\000\016"
+ "\001\023\000\020\000\023\000\016\001\017\001\020\001\021\001\022\001\023"
+ "\001\022\001\024\001\022\001\023\001\250\000\250\000\025\001\236\000\250"
+ "\000\236\000\335\000\250\000\335\000\243\000\026\001\024\001\017\001\024"
+ "\001\026\001\023\001\025\001\027\001\006\000\025\001\006\000\215\000\025"
+ "\001\215\000\220\000\021\000\030\001\031\001\022\001\032\001\033\001\032"
+ "\001\022\001\021\001\033\001\034\001\035\001\034\001\033\001\032\001\034"
+ "\001\036\001\035\001\021\000\037\001\030\001\037\001\021\000 \001 \001\021"
+ "\000!\001!\001\021\000\042\001\042\001\021\000#\001\026\001\017\001$\001"
+ "#\001%\001\042\001%\001#\001&\001&\001#\001'\001'\001#\001\036\000\036\000"
+ "#\001\035\001\000\000\002\000(\001)\001*\001+\001,\001-\001.\001+\001*\001"
+ "/\0010\001,\0011\0011\0012\001\000\0003\0014\0015\001,\001.\0016\0013\001"
+ "7\0014\0018\0011\001*\0019\001\000\000(\001\000\0009\001:\001:\0019\001;"
+ "\001:\001;\001<\001:\001<\001=\001,\001>\001-\001>\001,\0010\001>\0010\001"
+ "\077\001\077\0010\001@\001@\0010\001A\001\000\000B\001\001\000B\001\000\000"
+ "2\0011\001\000\000:\001)\0018\001*\0018\001)\001C\0014\001A\0010\001A\001"
+ "4\001D\001D\0014\001E\001E\0014\001F\001F\0014\0017\0014\0010\0011\001*\001"
+ "1\001:\001G\001:\001=\001:\001G\001*\001*\001G\001H\001*\001H\001I\001*\001"
+ "I\001/\001C\0014\0018\0014\001C\0015\0011\001,\0012\0014\0011\0018\0012\001"
+ "6\001B\0016\0012\001,\001\012\000J\001\013\000K\001L\001M\001L\001K\001N"
+ "\001O\001P\001Q\001O\001Q\0012\000N\001R\001L\001R\001N\001S\001T\001R\001"
+ "S\001K\001M\001U\001T\001\266\000R\001\013\000J\001V\001W\001V\001X\001V"
+ "\001W\001\013\000Y\001W\001O\001W\001\011\000\013\000\011\000W\001Y\001\011"
+ "\000Y\001M\001\011\000M\001R\001R\001M\001L\001U\001M\001L\000Z\001O\001"
+ "2\000O\001Z\001Y\001Y\001Z\001[\001Y\001[\001\134\001Y\001\134\001]\001^"
+ "\001Y\001]\001Y\001^\001M\001M\001^\001_\001M\001_\001`\001M\001`\001L\000"
+ "O\001X\001P\001X\001O\001W\001R\001\017\000\011\000\017\000R\001a\001a\001"
+ "R\001b\001b\001R\001c\001c\001R\001\266\000\010\001\002\001d\001\370\000"
+ "e\001\371\000d\001\002\001\024\000f\001\367\000\010\001\360\000\010\001g"
+ "\001\360\000f\001\010\001\373\000f\001\360\000\010\001d\001\356\000h\001"
+ "\373\000\011\001\360\000g\001\361\000\024\000\026\000\355\000g\001\010\001"
+ "\356\000\010\001\007\001\002\001\361\000g\001\356\000\356\000d\001\024\000"
+ "\375\000\361\000\015\001h\001\374\000\373\000\373\000\367\000f\001\367\000"
+ "\371\000\007\001\007\001\371\000\002\001\371\000e\001\006\001i\001#\001\021"
+ "\000j\001\033\001k\001\022\001\033\001j\001\033\001\035\001l\001\033\001"
+ "l\001k\001k\001#\001i\001\024\001k\001m\001\023\000i\001\021\000k\001i\001"
+ "\023\000\024\001j\001k\001\022\001j\001\024\001\021\000\031\001\022\000\020"
+ "\001\022\001\250\000\024\001m\001\017\001m\001k\001\023\000k\001l\001#\001"
+ "\035\001\036\001\036\000$\001\017\001\016\001\017\001m\001\023\000l\001\035"
+ "\001#\001\204\000s\000p\000s\000\204\000t\000a\000\204\000_\000\204\000a"
+ "\000[\0009\000E\000\204\000E\0009\000D\000\203\000\204\000m\000\204\000\203"
+ "\000U\000&\000$\000\204\000$\000&\000\042\000\204\000v\000f\000v\000\204"
+ "\000A\000\201\000!\000\204\000!\000\201\000\202\000\031\000\032\000\204\000"
+ "\032\000\031\000\030\000\204\000I\000G\000I\000\204\000$\000\204\000x\000"
+ "@\000x\000\204\000p\000!\000\031\000\204\000\031\000!\000 \000\200\000\204"
+ "\000^\000\204\000\200\000\201\000\204\000u\000t\000u\000\204\000G\000)\000"
+ "W\000\204\000W\000)\000Y\000]\000\204\000[\000\204\000]\000^\000~\000\204"
+ "\000M\000\204\000~\000z\000W\000&\000\204\000&\000W\000V\000|\000\204\000"
+ "z\000\204\000|\000_\000/\000*\000\204\000*\000/\000.\000Q\000\204\000R\000"
+ "\204\000Q\000M\000*\000)\000\204\000)\000*\000'\000E\000i\000\204\000i\000"
+ "E\000g\000T\000\204\000U\000\204\000T\000R\000i\000l\000\204\000l\000i\000"
+ "j\000o\000\204\000b\000\204\000o\000m\0005\0006\000\204\0006\0005\0004\000"
+ "\204\000e\000b\000e\000\204\000f\000\204\000\077\000;\000\077\000\204\000"
+ "@\0006\0009\000\204\0009\0006\0008\000\204\000C\000A\000C\000\204\000;\000"
+ "\032\0005\000\204\0005\000\032\000J\000\340\000\216\000\010\000\216\000\340"
+ "\000\217\000\340\000\240\000\223\000\240\000\340\000\235\000\211\000\213"
+ "\000\340\000\213\000\211\000\212\000\226\000\227\000\340\000\227\000\226"
+ "\000\225\000\340\000\222\000\217\000\222\000\340\000\223\000\340\000\342"
+ "\000\332\000\342\000\340\000\003\000\213\000\226\000\340\000\226\000\213"
+ "\000\241\000\350\000\322\000\340\000\322\000\350\000\353\000\340\000\007"
+ "\000\003\000\007\000\340\000\010\000\227\000\350\000\340\000\350\000\227"
+ "\000\347\000\340\000\310\000\305\000\310\000\340\000\311\000\340\000\331"
+ "\000\311\000\331\000\340\000\332\000\323\000\326\000\340\000\326\000\323"
+ "\000\325\000\344\000\340\000\345\000\340\000\344\000\316\000\322\000\323"
+ "\000\340\000\323\000\322\000\321\000\303\000\300\000\340\000\300\000\303"
+ "\000\302\000\340\000\346\000\345\000\346\000\340\000\305\000\326\000\303"
+ "\000\340\000\303\000\326\000\337\000\317\000\340\000\312\000\340\000\317"
+ "\000\272\000\263\000\245\000\340\000\245\000\263\000\262\000\315\000\340"
+ "\000\316\000\340\000\315\000\312\000\255\000\340\000\252\000\340\000\255"
+ "\000\256\000\300\000\263\000\340\000\263\000\300\000\277\000\271\000\340"
+ "\000\272\000\340\000\271\000\252\000\244\000\334\000\340\000\334\000\244"
+ "\000\336\000\274\000\340\000\261\000\340\000\274\000\275\000\245\000\244"
+ "\000\340\000\244\000\245\000\242\000\237\000\235\000\340\000\235\000\237"
+ "\000\233\000\260\000\340\000\256\000\340\000\260\000\261\000\276\000\340"
+ "\000\275\000\340\000\276\000\206\000\334\000\237\000\340\000\237\000\334"
+ "\000\333\000\000\000\001\000\001\000\002\000\000\000\002\000\003\000\004"
+ "\000\004\000\005\000\003\000\005\000\003\000\006\000\004\000\006\000\003"
+ "\000\007\000\006\000\007\000\007\000\010\000\006\000\010\000\011\000\012"
+ "\000\012\000\013\000\011\000\013\000\011\000\014\000\012\000\014\000\011"
+ "\000\015\000\014\000\015\000\011\000\016\000\015\000\016\000\011\000\017"
+ "\000\016\000\017\000\020\000\021\000\021\000\022\000\020\000\022\000\020"
+ "\000\023\000\021\000\023\000\024\000\025\000\025\000\026\000\024\000\026"
+ "\000\027\000\030\000\030\000\031\000\027\000\031\000\027\000\032\000\030"
+ "\000\032\000\027\000\033\000\032\000\033\000\027\000\036\000\033\000\036"
+ "\000\037\000 \000 \000!\000\037\000!\000\031\000\037\000\031\000 \000\027"
+ "\000\037\000\042\000#\000#\000$\000\042\000$\000\042\000%\000#\000%\000\042"
+ "\000&\000%\000&\000'\000(\000(\000)\000'\000)\000'\000*\000(\000*\000\026"
+ "\000*\000\026\000(\000\025\000(\000\026\000.\000*\000.\000.\000/\000\026"
+ "\000/\000/\0000\000\026\0000\0000\0002\000\026\0002\0003\0004\0004\0005\000"
+ "3\0005\0003\0006\0004\0006\0003\0007\0006\0007\0007\0008\0006\0008\0007\000"
+ "9\0008\0009\0007\000:\0009\000:\000;\000<\000<\000=\000;\000=\000;\000>\000"
+ "<\000>\000;\000\077\000>\000\077\000\077\000@\000>\000@\000=\000A\000=\000"
+ "B\000A\000B\000A\000C\000=\000C\000;\000C\000:\000D\0009\000D\000:\000E\000"
+ "D\000E\000:\000F\000E\000F\000#\000G\000#\000H\000G\000H\000G\000I\000#\000"
+ "I\000$\000I\000\033\000J\000\032\000J\000\033\0005\0005\000J\000\033\000"
+ "3\000\033\000L\0003\000L\000M\000N\000N\000O\000M\000O\000M\000P\000N\000"
+ "P\000M\000Q\000P\000Q\000Q\000R\000P\000R\000R\000S\000P\000S\000R\000T\000"
+ "S\000T\000T\000U\000S\000U\000%\000V\000&\000V\000V\000W\000%\000W\000W\000"
+ "X\000%\000X\000X\000Y\000W\000Y\000)\000Y\000)\000X\000(\000X\000Z\000[\000"
+ "[\000\134\000Z\000\134\000Z\000]\000[\000]\000Z\000^\000]\000^\000\134\000"
+ "_\000_\000`\000\134\000`\000\134\000a\000_\000a\000[\000a\000b\000c\000c"
+ "\000d\000b\000d\000b\000e\000c\000e\000e\000f\000c\000f\000g\000h\000h\000"
+ "i\000g\000i\000E\000g\000E\000h\000F\000h\000j\000k\000k\000l\000j\000l\000"
+ "i\000j\000i\000k\000h\000k\000d\000m\000d\000n\000m\000n\000m\000o\000d\000"
+ "o\000b\000o\000p\000q\000q\000r\000p\000r\000p\000s\000q\000s\000s\000t\000"
+ "q\000t\000H\000t\000H\000q\000t\000u\000H\000u\000G\000u\000B\000f\000B\000"
+ "c\000f\000v\000B\000v\000A\000v\000@\000w\000>\000w\000@\000r\000r\000w\000"
+ "@\000x\000r\000x\000p\000x\0000\000y\000/\000y\000l\000y\0000\000l\0000\000"
+ "k\000`\000z\000z\000{\000`\000{\000`\000|\000z\000|\000_\000|\000M\000}\000"
+ "O\000}\000{\000}\000M\000{\000{\000~\000M\000~\000z\000~\000^\000\177\000"
+ "Z\000\177\000\177\000\200\000^\000\200\000\177\000\201\000\200\000\201\000"
+ "\177\000\202\000\201\000\202\000!\000\177\000!\000\202\000\037\000\177\000"
+ "U\000n\000S\000n\000U\000\203\000n\000\203\000m\000\203\000/\000l\000/\000"
+ "\204\000l\000\204\000\205\000\206\000\206\000\207\000\205\000\207\000\205"
+ "\000\210\000\206\000\210\000\205\000\211\000\210\000\211\000\205\000\212"
+ "\000\211\000\212\000\205\000\213\000\212\000\213\000\205\000\214\000\213"
+ "\000\214\000\010\000\215\000\006\000\215\000\010\000\216\000\215\000\216"
+ "\000\216\000\217\000\215\000\217\000\217\000\220\000\215\000\220\000\217"
+ "\000\221\000\220\000\221\000\217\000\222\000\221\000\222\000\222\000\223"
+ "\000\221\000\223\000\224\000\225\000\225\000\226\000\224\000\226\000\224"
+ "\000\227\000\225\000\227\000\224\000\230\000\227\000\230\000\224\000\232"
+ "\000\230\000\232\000\233\000\234\000\234\000\235\000\233\000\235\000\233"
+ "\000\236\000\234\000\236\000\233\000\237\000\236\000\237\000\221\000\234"
+ "\000\220\000\234\000\223\000\234\000\223\000\240\000\234\000\240\000\235"
+ "\000\240\000\214\000\241\000\213\000\241\000\214\000\226\000\226\000\241"
+ "\000\214\000\224\000\242\000\243\000\243\000\244\000\242\000\244\000\242"
+ "\000\245\000\243\000\245\000\245\000\246\000\243\000\246\000\246\000\250"
+ "\000\243\000\250\000\251\000\252\000\002\000\252\000\002\000\251\000\251"
+ "\000\254\000\252\000\254\000\254\000\255\000\252\000\255\000\254\000\256"
+ "\000\255\000\256\000\256\000\257\000\254\000\257\000\257\000\260\000\256"
+ "\000\260\000\257\000\261\000\260\000\261\000\246\000\262\000\245\000\262"
+ "\000\262\000\263\000\246\000\263\000\263\000\264\000\246\000\264\000\264"
+ "\000\266\000\246\000\266\000\252\000\267\000\002\000\267\000\252\000\270"
+ "\000\267\000\270\000\252\000\271\000\270\000\271\000\271\000\272\000\270"
+ "\000\272\000\261\000\273\000\257\000\273\000\273\000\274\000\261\000\274"
+ "\000\273\000\275\000\274\000\275\000\207\000\275\000\207\000\273\000\207"
+ "\000\276\000\275\000\276\000\206\000\276\000\264\000\277\000\263\000\277"
+ "\000\277\000\300\000\264\000\300\000\300\000\301\000\264\000\301\000\301"
+ "\000\302\000\300\000\302\000\302\000\303\000\301\000\303\000\303\000\304"
+ "\000\301\000\304\000\305\000\306\000\306\000\307\000\305\000\307\000\305"
+ "\000\310\000\306\000\310\000\310\000\311\000\306\000\311\000\312\000\313"
+ "\000\313\000\314\000\312\000\314\000\312\000\315\000\313\000\315\000\315"
+ "\000\316\000\313\000\316\000\272\000\314\000\270\000\314\000\272\000\317"
+ "\000\314\000\317\000\312\000\317\000\015\000\321\000\321\000\322\000\015"
+ "\000\322\000\015\000\323\000\321\000\323\000\016\000\323\000\016\000\325"
+ "\000\323\000\325\000\016\000\326\000\325\000\326\000\017\000\326\000\311"
+ "\000\330\000\306\000\330\000\311\000\331\000\330\000\331\000\331\000\332"
+ "\000\330\000\332\000\236\000\333\000\237\000\333\000\333\000\334\000\236"
+ "\000\334\000\334\000\335\000\236\000\335\000\335\000\336\000\334\000\336"
+ "\000\244\000\336\000\244\000\335\000\243\000\335\000\304\000\337\000\303"
+ "\000\337\000\326\000\337\000\304\000\326\000\017\000\304\000\210\000\340"
+ "\000\206\000\340\000\211\000\340\000\332\000\341\000\330\000\341\000\005"
+ "\000\332\000\005\000\341\000\332\000\342\000\005\000\342\000\003\000\342"
+ "\000\316\000\343\000\313\000\343\000\316\000\344\000\343\000\344\000\344"
+ "\000\345\000\343\000\345\000\307\000\345\000\307\000\343\000\345\000\346"
+ "\000\307\000\346\000\305\000\346\000\230\000\347\000\227\000\347\000\230"
+ "\000\350\000\347\000\350\000\014\000\230\000\014\000\350\000\012\000\230"
+ "\000\014\000\353\000\350\000\353\000\014\000\322\000\322\000\353\000\024"
+ "\000\354\000\024\000\355\000\354\000\355\000\354\000\356\000\024\000\356"
+ "\000\232\000\360\000\360\000\361\000\232\000\361\000\207\000\232\000\207"
+ "\000\360\000\207\000\224\000\207\000\214\000\367\000\370\000\370\000\371"
+ "\000\367\000\371\000\367\000\372\000\370\000\372\000\372\000\373\000\367"
+ "\000\373\000\001\000\373\000\001\000\372\000\230\000\361\000\024\000(\000"
+ "\024\000X\000\024\000%\000\024\000#\000\024\000\002\001#\000\002\001H\000"
+ "\002\001q\000\002\001r\000\002\001w\000\002\001\371\000\002\001w\000\371"
+ "\000\367\000\007\001\007\001\010\001\367\000\010\001\207\000\373\000\360"
+ "\000\373\000\207\000\251\000\251\000\373\000\251\000\273\000\251\000\257"
+ "\000\356\000\015\001\354\000\015\001\361\000\015\001\356\000\361\000\023"
+ "\000\016\001\020\000\016\001\016\001\017\001\023\000\017\001\246\000\021"
+ "\001\021\001\022\001\246\000\022\001\234\000\022\001\022\001\024\001\234"
+ "\000\024\001\234\000\250\000\250\000\022\001\236\000\250\000\250\000\335"
+ "\000\004\000\024\001\017\001\024\001\004\000\017\001\004\000\234\000\006"
+ "\000\234\000\215\000\234\000\021\000}\000\021\000O\000\022\001\032\001\032"
+ "\001\033\001\022\001\033\001\021\001\032\001\033\001\034\001\034\001\035"
+ "\001\033\001\035\001\032\001\034\001\033\000\034\001\033\000\035\001\021"
+ "\000{\000\021\000`\000\021\000\134\000\021\000Z\000\021\000#\001Z\000#\001"
+ "\005\000\017\001\177\000#\001\037\000#\001\027\000#\001\036\000#\001\035"
+ "\001#\001\036\000\035\001\000\000\267\000\016\001*\001\005\000*\001\005\000"
+ "\016\001<\000,\001>\000,\001\341\000*\001,\0010\001,\0011\0010\0011\0011"
+ "\0012\001\000\0002\001\000\0001\001O\0004\001\022\0004\001\022\000O\000>"
+ "\000\370\000\370\000,\001N\0004\0011\0018\001*\0011\001*\0018\001\000\000"
+ "\270\000\270\000:\001\000\000:\001\314\000:\001\313\000:\001\343\000:\001"
+ "=\000,\001=\0000\001B\0000\001c\0000\001d\0000\001\000\000\372\000\372\000"
+ "2\0011\001:\001\016\0018\001\020\0008\001d\0004\0010\0014\001n\0004\001S"
+ "\0004\001P\0004\0011\0014\001*\001:\001\307\000:\001\307\000*\001\306\000"
+ "*\001\330\000*\001\020\0004\0014\0018\001,\0012\001\370\0002\001\013\000"
+ "\230\000\034\001L\001L\001M\001\034\001M\001\032\001L\001\355\000O\001\026"
+ "\000\355\000\026\000O\0012\000O\001\032\001R\001L\001R\001\021\001R\001\246"
+ "\000R\001\033\000M\001\266\000R\001\230\000\015\001\013\000\015\001\015\001"
+ "W\001\354\000W\001\013\000W\001W\001Y\001O\001W\001O\001Y\001\011\000W\001"
+ "\011\000Y\001M\001Y\001\011\000M\001M\001R\001\011\000R\001L\000M\0010\000"
+ "O\0010\000Y\001k\000Y\001h\000Y\001F\000Y\001:\000Y\001:\000M\0017\000M\001"
+ "3\000M\001\354\000O\001\017\000R\001\304\000R\001\301\000R\001\264\000R\001"
+ "\002\001\010\001\002\001d\001\010\001d\001>\000\371\000\024\000d\001\367"
+ "\000f\001\010\001f\001\360\000\010\001\010\001g\001\360\000g\001\360\000"
+ "f\001\373\000f\001\356\000d\001\356\000\010\001\002\000\373\000\361\000g"
+ "\001\356\000g\001\002\001\007\001\371\000\007\001#\001i\001\021\000i\001"
+ "\033\001j\001\033\001k\001j\001k\001\022\001j\001\035\001l\001\033\001l\001"
+ "k\001l\001#\001k\001i\001k\001\024\001k\001k\001m\001\024\001m\001\023\000"
+ "i\001\023\000k\001\024\001j\001\017\001m\001\023\000m\001#\001l\001s\000"
+ "\204\000p\000\204\000t\000\204\000a\000\204\000_\000\204\000[\000\204\000"
+ "9\000E\000E\000\204\0009\000\204\000\203\000\204\000m\000\204\000U\000\204"
+ "\000$\000&\000$\000\204\000&\000\204\000v\000\204\000f\000\204\000A\000\204"
+ "\000!\000\201\000!\000\204\000\201\000\204\000\031\000\032\000\032\000\204"
+ "\000\031\000\204\000I\000\204\000G\000\204\000x\000\204\000@\000\204\000"
+ "\031\000!\000\200\000\204\000^\000\204\000u\000\204\000)\000W\000W\000\204"
+ "\000)\000\204\000]\000\204\000~\000\204\000M\000\204\000z\000\204\000&\000"
+ "W\000|\000\204\000*\000/\000*\000\204\000Q\000\204\000R\000\204\000)\000"
+ "*\000E\000i\000i\000\204\000T\000\204\000i\000l\000o\000\204\000b\000\204"
+ "\0005\0006\0006\000\204\0005\000\204\000e\000\204\000\077\000\204\000;\000"
+ "\204\0006\0009\000C\000\204\000\032\0005\000\216\000\340\000\010\000\340"
+ "\000\217\000\340\000\240\000\340\000\223\000\340\000\235\000\340\000\211"
+ "\000\213\000\213\000\340\000\226\000\227\000\227\000\340\000\226\000\340"
+ "\000\222\000\340\000\340\000\342\000\332\000\340\000\003\000\340\000\213"
+ "\000\226\000\322\000\350\000\322\000\340\000\340\000\350\000\007\000\340"
+ "\000\227\000\350\000\310\000\340\000\305\000\340\000\311\000\340\000\331"
+ "\000\340\000\323\000\326\000\326\000\340\000\323\000\340\000\340\000\344"
+ "\000\340\000\345\000\316\000\340\000\322\000\323\000\300\000\303\000\300"
+ "\000\340\000\303\000\340\000\340\000\346\000\303\000\326\000\317\000\340"
+ "\000\312\000\340\000\272\000\340\000\245\000\263\000\245\000\340\000\263"
+ "\000\340\000\315\000\340\000\255\000\340\000\252\000\340\000\256\000\340"
+ "\000\263\000\300\000\271\000\340\000\244\000\334\000\334\000\340\000\244"
+ "\000\340\000\274\000\340\000\261\000\340\000\275\000\340\000\244\000\245"
+ "\000\235\000\237\000\237\000\340\000\260\000\340\000\276\000\340\000\237"
+ "\000\334\000]\313\001\200\2434\000\000\177\221\001\200\000\000\000\000\000"
+ "\000\001\200\000\000\000\000\005\272\001\200\206(\000\000\377\177\000\000"
+ "\000\000\000\000\377\177A\267\201n\000\000\377\177`\244\240[\000\000\377"
+ "\177\313\341\201n\000\000\377\177\000\000gY\000\000\377\177~\021\177\221"
+ "\000\000\377\177\000\000\177\221\000\000\377\177\000@\000\300\000\000\025"
+ "b\001\200l\014\000\000gY\001\200\000\000\000\000@7\001\200@7\000\000\000"
+ "\000\001\200gY\000\000l\014\001\200\025b\000\000\240[\001\200\240[\000\000"
+ "\277H\001\200\201n\000\0005\036\001\200\201n\000\000\206(\001\200\005\272"
+ "\000\000\000\000\001\200\177\221\000\0008\014\001\200\177\221\000\000\377"
+ "\177\231\246\000\000\000\000\377\177\177\221\277H\000\000\377\177\177\221"
+ "5\036\000\000\377\177\300\310\377\177\000\000\377\177]\313]\313\000\000\377"
+ "\177\310\363\177\221\000\000\000\000\000\000\377\177\000\000\361\301\323"
+ "\022\377\177\000\000e\300\247\014\377\177\000\000\026\304\321\030\377\177"
+ "\000\000\334\326\337\315\377\177\000\000%\322%\322\377\177\000\000\370\333"
+ "\024\312\377\177\000\000\300\310\001\200\300\310\000\000\245\371\212@\377"
+ "\177\000\000Y\363\233\077\377\177\000\000\000\000\332@\377\177\000\000\245"
+ "\371v\277\377\177\000\000Y\363e\300\377\177\000\000\000\000&\277\377\177"
+ "\000\000\321\030\352;\377\177\000\000\247\014\233\077\377\177\000\000\323"
+ "\022\017>\377\177\000\000\202\356\001\200\177\221\000\000\000\300\001\200"
+ "\000\300\000\000\337\315$)\377\177\000\000\024\312\010$\377\177\000\000%"
+ "\322\333-\377\177\000\000\321\030\026\304\377\177\000\000\010$\024\312\377"
+ "\177\000\000\222\036\316\306\377\177\000\000\352;/\347\377\177\000\000\233"
+ "\077Y\363\377\177\000\000\017>-\355\377\177\000\000v\277\245\371\377\177"
+ "\000\000&\277\000\000\377\177\000\000e\300Y\363\377\177\000\000\332@\000"
+ "\000\377\177\000\000\233\077\247\014\377\177\000\000\212@[\006\377\177\000"
+ "\000\316\306n\341\377\177\000\000\026\304/\347\377\177\000\000\024\312\370"
+ "\333\377\177\000\000\337\315\334\326\377\177\000\000\222\03629\377\177\000"
+ "\000H!YP\377\177\000\000\010$\3545\377\177\000\000\266+kA\377\177\000\000"
+ "\3545\010$\377\177\000\000\333-\333-\377\177\000\000!2$)\377\177\000\000"
+ "29\222\036\377\177\000\000\364<\273(\377\177\000\000\352;\321\030\377\177"
+ "\000\000WE\271\034\377\177\000\000c\360\201\261\377\177\000\000/\347\026"
+ "\304\377\177\000\000G\343\251\272\377\177\000\000-\355\361\301\377\177\000"
+ "\000fI'\222\377\177\000\000$)\337\315\377\177\000\000\333-%\322\377\177\000"
+ "\000\240[`\244\377\177\000\000[\006\212@\377\177\000\000\000\000\377\177"
+ "\377\177\000\000\321\023\240c\377\177\000\000\212@\245\371\377\177\000\000"
+ "\001\200\001\200\000\000\000\000\177\221\001\200\202\356\000\000\3545\370"
+ "\333\377\177\000\00029n\341\377\177\000\000E\327\014\303\377\177\000\000"
+ "n\341\316\306\377\177\000\000\2434\2434\377\177\000\000\324gY\353\377\177"
+ "\000\000gY\000\000\377\177\000\000\361\301-\355\377\177\000\000F\263E3\377"
+ "\177\000\000~\245}%\377\177\000\000\316\306\222\036\377\177\000\000\247\257"
+ "\270\336\377\177\000\000`\234/\354\377\177\000\000\225\276J\324\377\177\000"
+ "\000\315}\344\313\377\177\000\000[\006v\277\377\177\000\000\247\014e\300"
+ "\377\177\000\000\000\300\000@\377\177\000\000\001\200\000\000\377\177\000"
+ "\000!2\334\326\377\177\000\000\331m\232\266\377\177\000\000\377\177\300\310"
+ "\377\177\000\000=\225<\025\377\177\000\000v\277[\006\377\177\000\000\000"
+ "\000\231\246\377\177\000\000\377\177\000\000\001\200\000\000\334\326!2\377"
+ "\177\000\000\370\333\3545\377\177\000\000\03443\202\377\177\000\000@7\001"
+ "\200\377\177\000\000\247\024,\230\377\177\000\000\323\022\361\301\377\177"
+ "\000\000\203\332\202Z\377\177\000\000\273\314\272L\377\177\000\000n\3412"
+ "9\377\177\000\000/\347\352;\377\177\000\000\304\352\303j\377\177\000\000"
+ "-\355\017>\377\177\000\000\032\363\332@\377\177\000\000\377\177\377\177\000"
+ "\000\000\000\377\177\201n\000\000\000\000\377\177\201n\202\356\000\000]\313"
+ "]\313\377\177\000\000\017>\323\022\377\177\000\000\377\177\2434\2434\000"
+ "\000\377\177\201n8\014\000\000\177\221\001\2008\014\000\000\377\177\001\200"
+ "@7\000\000\000\000\001\200\001\200\000\000\2434\001\200]\313\000\000\201"
+ "n\001\200\277H\000\000\201n\001\2005\036\000\000\377\177\001\200@7\000\000"
+ "@7\001\200\377\177\000\000$)!2\377\177\000\000\177N\235\017\377\177\000\000"
+ "@7\001\200\377\177\000\000\03443\202\377\177\000\0005\036\001\200\201n\000"
+ "\000\177\221\001\2008\014\000\000\001\200\000\000\377\177\000\000\001\200"
+ "\001\200\000\000\000\000\005\272\001\200\206(\000\000]\313\001\200\2434\000"
+ "\000\000\000\001\200gY\000\000l\014\001\200\025b\000\000\001\200\000\000"
+ "\377\177\000\000G\343\251\272\377\177\000\000E\327\014\303\377\177\000\000"
+ "]\313]\313\377\177\000\000\225\276J\324\377\177\000\000\247\257\270\336\377"
+ "\177\000\000`\234/\354\377\177\000\000\377\177\313\341\201n\000\000\315}"
+ "\344\313\377\177\000\000\377\177\300\310\377\177\000\000\324gY\353\377\177"
+ "\000\000\377\177\000\000gY\000\000gY\000\000\377\177\000\000\377\177\243"
+ "4\2434\000\000\177N\235\017\377\177\000\000WE\271\034\377\177\000\000\364"
+ "<\273(\377\177\000\000\2434\2434\377\177\000\000\266+kA\377\177\000\000\377"
+ "\177\201n8\014\000\000H!YP\377\177\000\000\321\023\240c\377\177\000\000\000"
+ "\000\377\177\377\177\000\000\377\177\377\177\000\000\000\000\202\356\001"
+ "\200\177\221\000\000\377\177\000\000\001\200\000\000\000\000\001\200\001"
+ "\200\000\000\377\177~\021\177\221\000\000\000\300\001\200\000\300\000\000"
+ "\377\177\000@\000\300\000\000\177\221\001\200\202\356\000\000\377\177\201"
+ "n\202\356\000\000\001\200\001\200\000\000\000\000\377\177\377\177\000\000"
+ "\000\000\001\200\000\000\377\177\000\000\000\000\377\177\377\177\000\000"
+ "\000\000\377\177\377\177\000\000=\225<\025\377\177\000\000~\245}%\377\177"
+ "\000\000F\263E3\377\177\000\000\273\314\272L\377\177\000\000\203\332\202"
+ "Z\377\177\000\000\304\352\303j\377\177\000\000\000\000\001\200\001\200\000"
+ "\000\206(\001\200\005\272\000\0008\014\001\200\177\221\000\000\206(\001\200"
+ "\005\272\000\000\000\000\001\200\001\200\000\000\377\177\000\000\001\200"
+ "\000\000\2434\001\200]\313\000\000gY\001\200\000\000\000\000\025b\001\200"
+ "l\014\000\000\201n\001\2005\036\000\000\377\177\177\2215\036\000\000\377"
+ "\177\001\200@7\000\000\377\177\177\2215\036\000\000\377\177\000\000\001\200"
+ "\000\000\377\177]\313]\313\000\000\377\177\231\246\000\000\000\000\377\177"
+ "\310\363\177\221\000\000\277H\001\200\201n\000\000fI'\222\377\177\000\000"
+ "@7\001\200\377\177\000\000\240[\001\200\240[\000\000\201n\001\200\277H\000"
+ "\000\377\177\001\200@7\000\000\377\177\177\221\277H\000\000\377\177`\244"
+ "\240[\000\000\240[`\244\377\177\000\000\377\177A\267\201n\000\000\331m\232"
+ "\266\377\177\000\000\377\177\300\310\377\177\000\000\000\201\000\201\000"
+ "\201\000\201\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\177\000\177\000\177\000\177\000\177\000\177\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\201\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\201\000"
+ "\201\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\201\000\201\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\177\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\177\000\177\000\177\000\000\000\000\000\177\000\177"
+ "\000\000\201\177\000\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\000\000\000\337\321\337\321\337\321\337\321\337\321\337\321\337\321\337"
+ "\321\337\321\337\321\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177/!/!/!/!/!/!/!/!/!/!/!/!/!/!/!/!/!\253U\253U\253U\253U\253U\253U\253"
+ "U\253U\253U\253U\253U\253U\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\003}\003}\003}P\260P\260P\260P\260P\260P\260P\260P\260P\260\201"
+ "\000\201\000\201\000\201\000\201\000*\326*\326*\326*\326*\326*\326*\326*"
+ "\326*\326*\326*\326*\326\000\000\001\000\002\000\001\000\000\000\003\000"
+ "\004\000\005\000\006\000\005\000\004\000\007\000\007\000\004\000\010\000"
+ "\011\000\004\000\012\000\004\000\011\000\013\000\014\000\002\000\015\000"
+ "\002\000\014\000\016\000\016\000\017\000\002\000\017\000\016\000\020\000"
+ "\021\000\020\000\016\000\020\000\021\000\022\000\020\000\022\000\023\000"
+ "\024\000\025\000\026\000\027\000\030\000\031\000\030\000\027\000\006\000"
+ "\006\000\027\000\004\000\007\000\032\000\005\000\004\000\027\000\033\000"
+ "\034\000\004\000\033\000\004\000\034\000\012\000\035\000\036\000\037\000"
+ "\036\000\035\000 \000!\000\035\000\042\000\035\000!\000#\000\001\000$\000"
+ "\002\000\035\000%\000&\000%\000\035\000'\000(\000\035\000)\000\035\000(\000"
+ "*\000+\000,\000\035\000,\000+\000-\000\002\000$\000\025\000$\000.\000\025"
+ "\000.\000$\000/\000\035\0000\0001\0000\000\035\0002\0003\0004\000\035\000"
+ "4\0003\0005\0006\0007\000\035\0007\0006\0008\0009\000\035\000:\000\035\000"
+ "9\000;\000<\000=\000\035\000=\000<\000>\000\077\000\035\000@\000\035\000"
+ "\077\000A\000B\000\035\000A\000\035\000B\000\042\000C\000D\000+\000D\000"
+ "C\000E\000D\000E\000F\000G\000H\000\035\000H\000G\000I\000J\000K\000G\000"
+ "K\000J\000L\000K\000L\000M\000N\000O\000P\000O\000N\000Q\000Q\000N\000)\000"
+ "R\000S\0004\000S\000R\000T\000T\000R\000U\000V\000W\000'\000W\000V\000X\000"
+ "X\000V\000,\0007\000<\000\035\000<\0007\000Y\000Q\000\035\000O\000\035\000"
+ "Q\000)\000Z\000[\000\001\000\134\0006\000\035\0006\000\134\000]\000P\000"
+ "#\000^\000#\000P\000_\000_\000P\000O\000I\000`\000H\000`\000I\000G\000`\000"
+ "G\000K\000a\000Y\0007\000Y\000a\000<\000<\000a\000b\000c\000\035\000;\000"
+ "\035\000c\000@\000 \000d\000e\000d\000 \000f\000d\000f\0001\000g\000;\000"
+ "h\000;\000g\000c\000c\000g\000@\000i\000@\000g\000@\000i\000\077\000\077"
+ "\000i\000A\000j\0008\0006\0008\000j\0007\0007\000j\000a\000k\000\035\000"
+ "*\000\035\000k\000l\0001\000m\000d\000m\0001\0000\000m\0000\0002\000h\000"
+ ":\000n\000:\000h\0009\0009\000h\000;\000U\000o\000T\000o\000U\000\134\000"
+ "\134\000U\000p\000p\000]\000\134\000]\000p\0006\0006\000p\000j\000j\000p"
+ "\000q\000:\000r\000n\000r\000:\000s\000r\000s\000\037\000t\000)\000N\000"
+ ")\000t\000(\000(\000t\000*\000\012\000\034\000u\000\035\000v\0002\000v\000"
+ "\035\000w\000x\0005\0003\0005\000x\0004\0004\000x\000R\000R\000x\000y\000"
+ "z\000{\000l\000{\000z\0003\0003\000z\000x\000w\000|\000}\000|\000w\000~\000"
+ "|\000~\000\177\000\177\000\200\000|\000\200\000\177\000\201\000\200\000\201"
+ "\000\202\000\202\000\201\000&\000\203\000\204\000\205\000\011\000\012\000"
+ "u\000\013\000\204\000\004\000\204\000\013\000\205\000z\000*\000t\000*\000"
+ "z\000k\000k\000z\000l\000-\000X\000,\000X\000-\000+\000X\000+\000D\000^\000"
+ "\042\000\206\000\042\000^\000!\000!\000^\000#\000\035\000~\000w\000~\000"
+ "\035\000\177\000E\000+\000\035\000+\000E\000C\000L\000G\000\035\000G\000"
+ "L\000J\000\202\000W\000\200\000W\000\202\000&\000W\000&\000%\000W\000%\000"
+ "'\000l\0003\000\035\0003\000l\000{\000\035\000\201\000\177\000\201\000\035"
+ "\000&\000=\000L\000\035\000L\000=\000\207\000\210\000\010\000\004\000\204"
+ "\000\210\000\004\000\210\000\204\000\211\000\203\000\211\000\204\000\212"
+ "\000Z\000\001\000\017\000\000\000\002\000\030\000\213\000\031\000\026\000"
+ "\025\000\214\000\003\000\212\000\001\000$\000[\000/\000[\000$\000\001\000"
+ "\024\000\002\000\025\000\002\000\024\000\215\000\216\000\217\000\220\000"
+ "\002\000\215\000\015\000\217\000\016\000\014\000\016\000\217\000\216\000"
+ "\016\000\216\000\021\000\221\000\023\000\022\000\035\000s\000:\000s\000\035"
+ "\000\037\000T\000\134\000\035\000\134\000T\000o\000\222\000F\000E\000F\000"
+ "\222\000H\000F\000H\000`\000H\000E\000\035\000E\000H\000\222\000>\000\223"
+ "\000=\000\223\000>\000<\000\223\000<\000b\000\207\000M\000L\000M\000\207"
+ "\000=\000M\000=\000\223\000,\000'\000\035\000'\000,\000V\000\035\000f\000"
+ " \000f\000\035\0001\000\037\000e\000r\000e\000\037\000\036\000e\000\036\000"
+ " \000_\000\035\000#\000\035\000_\000O\000.\000\214\000\025\000\206\000A\000"
+ "i\000A\000\206\000B\000B\000\206\000\042\0004\000T\000\035\000T\0004\000"
+ "S\0002\000}\000m\000}\0002\000v\000}\000v\000w\000\224\000\225\000\226\000"
+ "\227\000\230\000\231\000\230\000\227\000\232\000\230\000\232\000\233\000"
+ "\230\000\233\000\234\000\230\000\234\000\235\000\230\000\235\000\226\000"
+ "\230\000\226\000\225\000n\000x\000z\000n\000z\000t\000n\000t\000N\000n\000"
+ "N\000P\000\236\000\237\000\240\000n\000^\000\206\000\236\000\241\000\242"
+ "\000\236\000\242\000\243\000\236\000\243\000\244\000\245\000\246\000\247"
+ "\000\246\000\245\000\250\000\250\000\245\000\251\000\250\000\251\000\252"
+ "\000\252\000\251\000\253\000\252\000\253\000\254\000\254\000\253\000\255"
+ "\000\255\000\253\000\256\000\256\000\253\000\257\000\257\000\253\000\260"
+ "\000\260\000\253\000\261\000\260\000\261\000\262\000\262\000\261\000\263"
+ "\000\263\000\261\000\264\000\264\000\261\000\265\000\266\000\267\000\270"
+ "\000\267\000\266\000\271\000\271\000\266\000\272\000\271\000\272\000\273"
+ "\000\273\000\272\000\274\000\273\000\274\000\275\000\275\000\274\000\276"
+ "\000\275\000\276\000\277\000\277\000\276\000\300\000\277\000\300\000\301"
+ "\000\302\000\236\000\303\000W\000r\000e\000\302\000\304\000\305\000W\000"
+ "d\000m\000W\000m\000}\000\302\000\306\000\307\000\302\000\307\000\310\000"
+ "\311\000\312\000\313\000\314\000\315\000\316\000\314\000\316\000\317\000"
+ "\317\000\316\000\320\000\320\000\316\000\321\000\321\000\316\000\322\000"
+ "\322\000\316\000\323\000\322\000\323\000\324\000\325\000\326\000\327\000"
+ "\325\000\327\000\330\000\327\000\326\000\331\000\332\000\333\000\334\000"
+ "\333\000\332\000\335\000\333\000\335\000\336\000\333\000\336\000\337\000"
+ "\333\000\337\000\340\000\333\000\340\000\341\000\333\000\341\000\342\000"
+ "\342\000\341\000\343\000\342\000\343\000\344\000\344\000\343\000\345\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000"
+ "\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000"
+ "\005\000\007\000\004\000\010\000\007\000\010\000\004\000\011\000\004\000"
+ "\012\000\011\000\012\000\011\000\013\000\004\000\013\000\002\000\014\000"
+ "\002\000\015\000\014\000\015\000\014\000\016\000\002\000\016\000\016\000"
+ "\017\000\002\000\017\000\016\000\020\000\017\000\020\000\020\000\021\000"
+ "\016\000\021\000\021\000\022\000\020\000\022\000\022\000\023\000\020\000"
+ "\023\000\024\000\025\000\025\000\026\000\024\000\026\000\027\000\030\000"
+ "\030\000\031\000\027\000\031\000\006\000\027\000\006\000\030\000\004\000"
+ "\027\000\007\000\032\000\005\000\032\000\027\000\033\000\004\000\033\000"
+ "\004\000\034\000\033\000\034\000\012\000\034\000\035\000\036\000\036\000"
+ "\037\000\035\000\037\000\035\000 \000\036\000 \000\035\000!\000\035\000\042"
+ "\000!\000\042\000!\000#\000\035\000#\000\001\000$\000\002\000$\000\035\000"
+ "%\000%\000&\000\035\000&\000\035\000'\000%\000'\000\035\000(\000\035\000"
+ ")\000(\000)\000(\000*\000\035\000*\000+\000,\000\035\000,\000\035\000+\000"
+ "+\000-\000,\000-\000\025\000$\000\002\000\025\000$\000.\000\025\000.\000"
+ "$\000/\000.\000/\000\035\0000\0000\0001\000\035\0001\000\035\0002\0000\000"
+ "2\0003\0004\000\035\0004\000\035\0003\0003\0005\0004\0005\0006\0007\000\035"
+ "\0007\000\035\0006\0006\0008\0007\0008\000\035\0009\000\035\000:\0009\000"
+ ":\0009\000;\000\035\000;\000<\000=\000\035\000=\000\035\000<\000<\000>\000"
+ "=\000>\000\035\000\077\000\035\000@\000\077\000@\000\077\000A\000\035\000"
+ "A\000\035\000B\000A\000B\000\042\000B\000C\000D\000+\000D\000+\000C\000C"
+ "\000E\000D\000E\000E\000F\000D\000F\000G\000H\000\035\000H\000\035\000G\000"
+ "G\000I\000H\000I\000J\000K\000G\000K\000G\000J\000J\000L\000K\000L\000L\000"
+ "M\000K\000M\000N\000O\000O\000P\000N\000P\000N\000Q\000O\000Q\000)\000N\000"
+ ")\000Q\000R\000S\0004\000S\0004\000R\000R\000T\000S\000T\000R\000U\000T\000"
+ "U\000V\000W\000'\000W\000'\000V\000V\000X\000W\000X\000,\000V\000,\000X\000"
+ "7\000<\0007\000Y\000<\000Y\000\035\000Q\000\035\000O\000Z\000[\000\001\000"
+ "[\000\001\000Z\0006\000\134\000\035\000\134\000\134\000]\0006\000]\000#\000"
+ "P\000#\000^\000P\000^\000P\000_\000#\000_\000O\000_\000I\000`\000H\000`\000"
+ "G\000`\000K\000`\000Y\000a\0007\000a\000<\000a\000a\000b\000<\000b\000\035"
+ "\000c\000;\000c\000@\000c\000 \000d\000d\000e\000 \000e\000 \000f\000d\000"
+ "f\0001\000f\0001\000d\000;\000g\000;\000h\000g\000h\000c\000g\000@\000g\000"
+ "@\000i\000g\000i\000\077\000i\000A\000i\0008\000j\0006\000j\0007\000j\000"
+ "a\000j\000\035\000k\000*\000k\000k\000l\000\035\000l\0001\000m\000d\000m"
+ "\0000\000m\0002\000m\000:\000h\000:\000n\000h\000n\0009\000h\000U\000o\000"
+ "T\000o\000U\000\134\000\134\000o\000U\000p\000\134\000p\000]\000p\0006\000"
+ "p\000j\000p\000\032\000p\000\032\000j\000:\000r\000n\000r\000:\000s\000r"
+ "\000s\000\037\000s\000\037\000r\000)\000t\000N\000t\000(\000t\000*\000t\000"
+ "\034\000u\000\012\000u\000\035\000v\0002\000v\000\035\000w\000v\000w\000"
+ "5\000x\0003\000x\0004\000x\000R\000x\000x\000y\000R\000y\000z\000{\000l\000"
+ "{\000l\000z\0003\000z\0003\000{\000x\000z\000w\000|\000|\000}\000w\000}\000"
+ "w\000~\000|\000~\000~\000\177\000|\000\177\000\177\000\200\000|\000\200\000"
+ "\177\000\201\000\200\000\201\000\201\000\202\000\200\000\202\000&\000\201"
+ "\000&\000\202\000\203\000\204\000\204\000\205\000\203\000\205\000\011\000"
+ "u\000\013\000\204\000\004\000\204\000\013\000\205\000*\000z\000t\000z\000"
+ "k\000z\000-\000X\000+\000X\000D\000X\000\042\000^\000\042\000\206\000^\000"
+ "\206\000!\000^\000\035\000~\000\035\000\177\000+\000E\000\035\000E\000G\000"
+ "L\000\035\000L\000W\000\202\000W\000\200\000&\000W\000%\000W\0003\000l\000"
+ "\035\000\201\000=\000L\000=\000\207\000L\000\207\000\010\000\210\000\004"
+ "\000\210\000\204\000\210\000\204\000\211\000\210\000\211\000\203\000\211"
+ "\000Z\000\212\000\001\000\212\000\000\000\017\000\030\000\213\000\031\000"
+ "\213\000\025\000\214\000\026\000\214\000\003\000\212\000$\000[\000/\000["
+ "\000\002\000\024\000\024\000\215\000\002\000\215\000\216\000\217\000\213"
+ "\000\217\000\213\000\216\000\015\000\215\000\016\000\217\000\014\000\217"
+ "\000\016\000\216\000\021\000\216\000\023\000y\000\022\000y\000\035\000s\000"
+ "T\000\134\000\035\000T\000F\000\222\000E\000\222\000H\000\222\000F\000H\000"
+ "F\000`\000E\000H\000>\000\223\000=\000\223\000<\000\223\000b\000\223\000"
+ "M\000\207\000=\000M\000M\000\223\000'\000,\000\035\000f\000\037\000e\000"
+ "e\000r\000\036\000e\000\035\000_\000.\000\214\000A\000\206\000i\000\206\000"
+ "B\000\206\0004\000T\0002\000}\000m\000}\000v\000}\000\023\000x\000n\000\212"
+ "\000Z\000n\000\003\000n\000\000\000n\000\017\000n\000\020\000n\000\023\000"
+ "n\000n\000x\000n\000z\000n\000t\000N\000n\000P\000n\000^\000n\000n\000\206"
+ "\000i\000n\000g\000n\000\007\000j\000\007\000a\000\010\000a\000\010\000b"
+ "\000b\000\210\000\210\000\223\000M\000\210\000K\000\210\000`\000\210\000"
+ "F\000\210\000F\000\211\000D\000\211\000X\000\211\000W\000\211\000W\000\203"
+ "\000.\000u\000u\000\214\000\011\000.\000\011\000/\000\013\000/\000\013\000"
+ "[\000[\000\205\000Z\000\205\000Z\000\203\000n\000\203\000W\000n\000W\000"
+ "r\000W\000e\000W\000d\000W\000m\000W\000}\000W\000|\000\024\000\214\000\024"
+ "\000u\000u\000\215\000\015\000u\000\014\000u\000u\000\217\000\031\000u\000"
+ "\031\000\217\000\033\000u\000\031\000\033\000\022\000R\000\021\000R\000R"
+ "\000\216\000R\000\213\000\030\000R\000\006\000R\000\006\000U\000\005\000"
+ "U\000\005\000p\000\313\341\377\177\177\221\000\000\344\313\315}\001\200\000"
+ "\000\300\310\377\177\001\200\000\000Y\353\324g\001\200\000\000\224\363\377"
+ "\177\353\235\000\000\000\000gY\001\200\000\000\000\000\377\177\231\246\000"
+ "\000\2434\377\177]\313\000\000\235\017\177N\001\200\000\000\271\034WE\001"
+ "\200\000\000\273(\364<\001\200\000\000\2434\2434\001\200\000\000kA\266+\001"
+ "\200\000\000\373E\377\177z\327\000\000YPH!\001\200\000\000\201n\377\177\310"
+ "\363\000\000\240c\321\023\001\200\000\000\377\177\000\000\001\200\000\000"
+ "\377\177\377\177\000\000\000\000[\006v\277\001\200\000\000\000\000\001\200"
+ "\001\200\000\000\000\000&\277\001\200\000\000<\025=\225\001\200\000\000\247"
+ "\014e\300\001\200\000\000\000\000\377\177\000\000\000\000\2434\377\177]\313"
+ "\000\000\000\000\377\177\231\246\000\000\321\030\026\304\001\200\000\000"
+ "\000\000\000\000\001\200\000\000\323\022\361\301\001\200\000\000\000\000"
+ "\377\177\201n\000\000z\327\377\177\373E\000\000\310\363\377\177\201n\000"
+ "\000]\313\377\177\2434\000\000\235\017\177N\001\200\000\000\000\000\332@"
+ "\001\200\000\000\000\000gY\001\200\000\000[\006\212@\001\200\000\000\247"
+ "\014\233\077\001\200\000\000'\222fI\001\200\000\0003\202\0344\001\200\000"
+ "\000\001\200@7\001\200\000\000\026\304\321\030\001\200\000\000\316\306\222"
+ "\036\001\200\000\000\024\312\010$\001\200\000\000&\277\000\000\001\200\000"
+ "\000\201\261c\360\001\200\000\000\231\246\000\000\001\200\000\000v\277\245"
+ "\371\001\200\000\000e\300Y\363\001\200\000\000\333-\333-\001\200\000\000"
+ "\3545\010$\001\200\000\000!2$)\001\200\000\000}%~\245\001\200\000\00029n"
+ "\341\001\200\000\000\272L\273\314\001\200\000\000\3545\370\333\001\200\000"
+ "\000\352;/\347\001\200\000\000\202Z\203\332\001\200\000\000\212@\245\371"
+ "\001\200\000\000\303j\304\352\001\200\000\000\233\077Y\363\001\200\000\000"
+ "\332@\000\000\001\200\000\000\377\177\000\000\001\200\000\000`\244\240[\001"
+ "\200\000\000\337\315$)\001\200\000\000%\322\333-\001\200\000\000\001\200"
+ "@7\001\200\000\000\001\2005\036\177\221\000\000\001\200@7\177\221\000\000"
+ "\017>-\355\001\200\000\000n\34129\001\200\000\000\370\333\3545\001\200\000"
+ "\000/\347\352;\001\200\000\000\333-%\322\001\200\000\000!2\334\326\001\200"
+ "\000\000\010$\024\312\001\200\000\000$)\337\315\001\200\000\000\361\301\323"
+ "\022\001\200\000\000e\300\247\014\001\200\000\000\353\235\377\177\224\363"
+ "\000\000\300\310\377\177\300\310\000\000\231\246\377\177\000\000\000\000"
+ "\361\301-\355\001\200\000\000\026\304/\347\001\200\000\000\321\030\352;\001"
+ "\200\000\000\323\022\017>\001\200\000\000@7\377\177@7\000\000\000@\377\177"
+ "\000@\000\000~\021\377\177\201n\000\000A\267\377\177\177\221\000\000\224"
+ "\363\377\177\353\235\000\000\313\341\377\177\177\221\000\000`\244\377\177"
+ "`\244\000\000\201n\377\177\000\000\000\000\373E\377\177z\327\000\000\010"
+ "$\3545\001\200\000\000$)!2\001\200\000\000\177\221\377\177A\267\000\000\177"
+ "\221\377\177\313\341\000\000\245\371v\277\001\200\000\000Y\363e\300\001\200"
+ "\000\000\201n\377\177~\021\000\000\201n\377\177\310\363\000\000n\341\316"
+ "\306\001\200\000\000\370\333\024\312\001\200\000\000/\347\026\304\001\200"
+ "\000\000\334\326!2\001\200\000\000\001\200\377\177\300\310\000\000-\355\017"
+ ">\001\200\000\000Y\363\233\077\001\200\000\000\001\200\000\000\231\246\000"
+ "\000\001\200]\313]\313\000\000\001\200\000\000\000\000\000\000\222\03629"
+ "\001\200\000\000\001\200\177\221\310\363\000\000\000\000\001\200\001\200"
+ "\000\000\001\200\001\200\000\000\000\000/\354`\234\001\200\000\000\001\200"
+ "]\313]\313\000\000\270\336\247\257\001\200\000\000J\324\225\276\001\200\000"
+ "\000]\313]\313\001\200\000\000\014\303E\327\001\200\000\000\001\200\000\000"
+ "\231\246\000\000\251\272G\343\001\200\000\000\201\261c\360\001\200\000\000"
+ "\231\246\000\000\001\200\000\000\001\2005\036\177\221\000\000,\230\247\024"
+ "\001\200\000\0003\202\0344\001\200\000\000\001\200@7\001\200\000\000\271"
+ "\034WE\001\200\000\000\273(\364<\001\200\000\000E3F\263\001\200\000\000\000"
+ "@\000\300\001\200\000\000kA\266+\001\200\000\00029\222\036\001\200\000\000"
+ "\352;\321\030\001\200\000\000YPH!\001\200\000\000\017>\323\022\001\200\000"
+ "\000\233\077\247\014\001\200\000\000\240c\321\023\001\200\000\000\024\312"
+ "\370\333\001\200\000\000]\313]\313\001\200\000\000\014\303E\327\001\200\000"
+ "\000\337\315\334\326\001\200\000\000%\322%\322\001\200\000\000J\324\225\276"
+ "\001\200\000\000\334\326\337\315\001\200\000\000Y\353\324g\001\200\000\000"
+ "\245\371\212@\001\200\000\000\270\336\247\257\001\200\000\000\212@[\006\001"
+ "\200\000\000\222\036\316\306\001\200\000\000v\277[\006\001\200\000\000/\354"
+ "`\234\001\200\000\000\000\000\001\200\001\200\000\000\001\200\177\221~\021"
+ "\000\000\001\200\001\200\000\000\000\000<\025=\225\001\200\000\000\001\200"
+ "\000\300\000@\000\000}%~\245\001\200\000\000E3F\263\001\200\000\000\000@"
+ "\000\300\001\200\000\000\272L\273\314\001\200\000\000\001\200\202\356\201"
+ "n\000\000\202Z\203\332\001\200\000\000\303j\304\352\001\200\000\000\377\177"
+ "\000\000\001\200\000\000\001\200\000\000\377\177\000\000\377\177\377\177"
+ "\000\000\000\000~\021\377\177\201n\000\000~\021\377\177\201n\000\000\377"
+ "\177\377\177\000\000\000\000\000\000\377\177\377\177\000\000\000\000\377"
+ "\177\377\177\000\000\001\2008\014\201n\000\000\001\200\000\000\377\177\000"
+ "\000\001\200\2434\2434\000\000\001\200gY\000\000\000\000\001\200\201n\313"
+ "\341\000\000\310\363\377\177\201n\000\000\001\200\377\177\300\310\000\000"
+ "\001\200\377\177\300\310\000\000\353\235\377\177\224\363\000\000\177\221"
+ "\377\177\313\341\000\000\001\200\000\000\201n\000\000\001\200\202\356\201"
+ "n\000\000\001\200\000\000\377\177\000\000\001\200gY\000\000\000\000\001\200"
+ "\240[`\244\000\000\001\200\201n\313\341\000\000\001\200\201nA\267\000\000"
+ "\001\200\201nA\267\000\000\001\200\201n\313\341\000\000\001\200\201n\300"
+ "\310\000\000\001\2008\014\201n\000\000\001\200\377\177\300\310\000\000\001"
+ "\200\2434\2434\000\000\001\200\277H\177\221\000\000\001\200\177\221~\021"
+ "\000\000\001\200\177\221\000\000\000\000\001\200\001\200\000\000\000\000"
+ "-\355\361\301\001\200\000\000\344\313\315}\001\200\000\000\2434\2434\001"
+ "\200\000\000\377\177\377\177\000\000\000\000\251\272G\343\001\200\000\000"
+ ",\230\247\024\001\200\000\000\316\306n\341\001\200\000\000\300\310\377\177"
+ "\001\200\000\000\232\266\331m\001\200\000\000\001\200\277H\177\221\000\000"
+ "'\222fI\001\200\000\000\001\200@7\001\200\000\000`\244\240[\001\200\000\000"
+ "\232\266\331m\001\200\000\000\300\310\377\177\001\200\000\000A\267\377\177"
+ "\177\221\000\000\001\200\240[`\244\000\000`\244\377\177`\244\000\000\001"
+ "\200\201nA\267\000\000\177\221\377\177A\267\000\000\001\200\377\177\300\310"
+ "\000\000\300\310\377\177\001\200\000\000\001\200\177\221\310\363\000\000"
+ "\000\000\377\177\377\177\000\000\001\200\000\300\000@\000\000P^P^P^P^P^P"
+ "^P^P^P^P^P^P^P^P^P^P^P^P^P^\201\177\177\177\177\177\201\177\201\177\000\177"
+ "\000\177\000\177\201\177\177\177\201\177\000\177\000\177\000\177\000\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\201\177\201\177\201\201\177"
+ "\201\177\201\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\201\177\201\177\201\177\201\177\201\177\177\177\177\201\177\177"
+ "\177\177\177\177\177\177\201\177\201\177\201\177\201\000\201\000\201\000"
+ "\201\177\201\177\201\177\201\177\201\177\201\177\201\177\201\177\201\177"
+ "\177\177\000\177\000\177\000\177\177\177\177\177\177\177\177\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\177\177"
+ "\177\177\000\177\000\177\177\177\177\177\000\177\000\177\177\177\177\177"
+ "\177\177\201\177\000\177\201\177\177\177\201\000\201\000\201\000\177\177"
+ "\242\260\242\260\242\260\242\260\242\260\242\260\242\260\242\260\242\260"
+ "\242\260\242\260\242\260\242\260\242\260\242\260\242\260\242\260\177\177"
+ "\177\177\201\177\201\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\201\177\177\177\177\177\201\177\177\201\177\177*\326*\326*\326*\326*\326"
+ "*\326*\326*\326*\326*\326*\326*\326*\326*\326*\326*\326.\04284*\326\321/"
+ "\321/\321/\321/\321/\321/\321/\321/\000\201\000\201\000\201\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\240=\263\036\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\177\177\201\177\177\177\000"
+ "\177\177\177\201\177\177\177\201\177\201\177\253U\253U\253U\253U\253U\253"
+ "U\253U\253U\253U\253U\253U\253U\000\177\201\000\000\177\201\000\000\000\000"
+ "\000\001\000\002\000\001\000\000\000\003\000\003\000\000\000\004\000\003"
+ "\000\004\000\005\000\005\000\004\000\006\000\005\000\006\000\007\000\005"
+ "\000\007\000\010\000\010\000\007\000\011\000\011\000\007\000\012\000\012"
+ "\000\007\000\013\000\013\000\007\000\014\000\014\000\007\000\015\000\014"
+ "\000\015\000\016\000\016\000\015\000\017\000\016\000\017\000\020\000\020"
+ "\000\017\000\021\000\021\000\017\000\022\000\023\000\024\000\025\000\024"
+ "\000\023\000\026\000\026\000\023\000\027\000\030\000\031\000\032\000\033"
+ "\000\027\000\034\000\027\000\033\000\035\000\036\000\037\000 \000!\000\036"
+ "\000\030\000\036\000!\000\037\000\042\000#\000$\000#\000\042\000%\000%\000"
+ "\042\000&\000'\000(\000)\000(\000'\000*\000*\000'\000+\000+\000'\000,\000"
+ "-\000.\000/\000.\000-\0000\000.\0000\0001\0002\0003\000\034\0003\0002\000"
+ "4\000\035\000\026\000\027\000\026\000\035\000\033\000\026\000\033\0005\000"
+ "6\0007\0008\0007\0006\0009\0007\0009\000:\000;\000<\000=\000<\000;\000>\000"
+ "<\000>\000\077\000@\000,\000'\000,\000@\000A\000A\000@\000B\000C\000D\000"
+ "E\000=\0009\000\034\0009\000=\000F\000G\000\034\000H\000\034\000G\000I\000"
+ "8\000J\000\034\000J\0008\000K\000J\000L\000\034\000L\000J\000M\000A\000\034"
+ "\000,\000\034\000A\000B\000N\000\034\000O\000\034\000N\000*\000P\000\030"
+ "\000Q\000\030\000P\000R\000\034\000S\0001\000S\000\034\000T\000&\000U\000"
+ "\034\000U\000&\000V\000\036\000W\000\030\000\036\000X\000W\000X\000\036\000"
+ "Y\000Z\000[\000\134\000[\000Z\000]\000[\000]\000Q\000W\000^\000\030\000\030"
+ "\000_\000\031\000_\000\030\000^\000`\0002\000\034\0002\000`\000a\000\027"
+ "\000\025\000\034\000\025\000\027\000\023\000b\000Q\000]\000Q\000b\000c\000"
+ "Q\000c\000P\000\034\000d\000e\000d\000\034\000\025\000W\000f\000^\000f\000"
+ "W\000X\000^\000g\000_\000\034\000h\000i\000h\000\034\000j\000Q\000\032\000"
+ "[\000\032\000Q\000\030\000k\000\034\000B\000\034\000k\000H\000!\000\030\000"
+ "R\000c\000b\000l\000\034\0000\000-\0000\000\034\0001\000m\000\034\000I\000"
+ "\034\000m\000n\000o\000p\000q\000U\000`\000\034\000`\000U\000r\000s\000t"
+ "\000u\000t\000s\000v\000v\000s\000w\000v\000w\000x\000x\000w\000y\000y\000"
+ "w\000z\000z\000w\000{\000{\000w\000|\000{\000|\000}\000}\000|\000~\000~\000"
+ "|\000\177\000\177\000|\000\200\000\177\000\200\000\201\000\201\000\200\000"
+ "\202\000\202\000\200\000\203\000\204\000r\000U\000r\000\204\000\205\000r"
+ "\000\205\000`\000M\000\206\000L\000\206\000M\000J\000\206\000J\000\207\000"
+ "K\000\207\000J\000\207\000K\0008\000\207\0008\0007\000\210\000\211\0003\000"
+ "\211\000\210\000\212\000\212\000\210\000\213\000\213\000\214\000\212\000"
+ "\214\000\213\000\215\000\215\000\213\000\216\000\217\000\220\000\221\000"
+ "\220\000\217\000\222\000\220\000\222\000\223\000\223\000\224\000\220\000"
+ "\224\000\223\000\225\000\224\000\225\000i\000$\000n\000\226\000n\000$\000"
+ "\227\000\227\000$\000#\000i\000\230\000\224\000\230\000i\000h\000\230\000"
+ "h\000j\000\216\000\231\000\215\000\231\000\216\000>\000>\000\216\000\077"
+ "\000\215\000>\000\034\000>\000\215\000\231\000\232\0005\000\033\0005\000"
+ "\232\000L\0005\000L\000\206\000\042\000V\000&\000V\000\042\000\204\000V\000"
+ "\204\000U\000L\000\033\000\034\000\033\000L\000\232\000\233\000\034\000-"
+ "\000\034\000\233\000O\000e\000\024\000\234\000\024\000e\000d\000\024\000"
+ "d\000\025\000\235\000\236\000\237\000\236\000\235\000\240\000\236\000\240"
+ "\000\241\000\241\000\240\000\242\000\241\000\242\000\243\000\241\000\243"
+ "\000\244\000\241\000\244\000\245\000\241\000\245\000\246\000\246\000\245"
+ "\000\247\000\246\000\247\000\250\000\246\000\250\000\251\000\246\000\251"
+ "\000\252\000\252\000\251\000\253\000\252\000\253\000\254\000\255\000\256"
+ "\000X\000X\000\256\000f\000\257\000\252\000\254\000\260\000\261\000\262\000"
+ "\261\000\260\000\263\000\263\000\260\000\264\000\264\000\260\000\265\000"
+ "\265\000\260\000\266\000\266\000\267\000\265\000l\000 \000\037\000l\000\037"
+ "\000!\000l\000!\000R\000l\000R\000P\000\270\000\271\000\272\000\273\000\274"
+ "\000\275\000\276\000\277\000q\000\277\000\276\000\300\000\277\000\300\000"
+ "\301\000\302\000\303\000\304\000\305\000\273\000\275\000\306\000\304\000"
+ "\300\000\305\000q\000\273\000q\000\305\000\307\000\277\000o\000q\000o\000"
+ "\277\000D\000D\000\277\000E\000E\000\277\000\310\000\311\000\312\000\313"
+ "\000\306\000\301\000\304\000j\000\234\000\230\000\234\000j\000\314\000\234"
+ "\000\314\000e\000\226\000I\000\315\000I\000\226\000m\000m\000\226\000n\000"
+ "\034\000\225\000\223\000\225\000\034\000i\000\034\000\222\000\217\000\222"
+ "\000\034\000\223\000\316\0004\0002\0004\000\316\0003\0003\000\316\000\210"
+ "\000f\000\317\000^\0001\000\320\000.\000\320\0001\000S\000\320\000S\000T"
+ "\000O\000/\000\321\000/\000O\000\233\000/\000\233\000-\000F\000:\0009\000"
+ ":\000F\000=\000:\000=\000<\000>\000=\000\034\000=\000>\000;\000\034\000\322"
+ "\000T\000\322\000\034\000\217\0003\000\212\000\034\000\212\0003\000\211\000"
+ "\323\000H\000\324\000H\000\323\000\315\000H\000\315\000G\000G\000\315\000"
+ "I\000\212\000\215\000\034\000\215\000\212\000\214\000\227\000\034\000n\000"
+ "\034\000\227\000#\000\317\000g\000^\000\325\000\326\000\327\000\326\000\325"
+ "\000\330\000\330\000\325\000\331\000\331\000\325\000\332\000\332\000\325"
+ "\000\333\000\333\000\325\000\334\000\333\000\334\000\335\000\335\000\334"
+ "\000\336\000\335\000\336\000\337\000\337\000\336\000\340\000\034\000\314"
+ "\000j\000\314\000\034\000e\000+\000\034\000*\000\034\000+\000,\000*\000\321"
+ "\000(\000\321\000*\000N\000\321\000N\000O\000\205\000a\000`\000a\000\205"
+ "\000\316\000a\000\316\0002\000\324\000B\000@\000B\000\324\000k\000k\000\324"
+ "\000H\000Z\000\134\000\341\000%\000\034\000#\000\034\000%\000&\000\312\000"
+ "\342\000\313\000T\000\221\000\320\000\221\000T\000\322\000\221\000\322\000"
+ "\217\0009\0008\000\034\0008\0009\0006\000\343\000\036\000 \000\312\000p\000"
+ "\342\000p\000\312\000q\000\343\000Y\000\036\000\276\000q\000\307\000\310"
+ "\000C\000E\000\311\000q\000\312\000q\000\311\000\344\000\274\000q\000\344"
+ "\000q\000\274\000\273\000\000\000\001\000\001\000\002\000\000\000\002\000"
+ "\000\000\003\000\001\000\003\000\000\000\004\000\003\000\004\000\004\000"
+ "\005\000\003\000\005\000\004\000\006\000\005\000\006\000\006\000\007\000"
+ "\005\000\007\000\007\000\010\000\005\000\010\000\007\000\011\000\010\000"
+ "\011\000\007\000\012\000\011\000\012\000\007\000\013\000\012\000\013\000"
+ "\007\000\014\000\013\000\014\000\007\000\015\000\014\000\015\000\015\000"
+ "\016\000\014\000\016\000\015\000\017\000\016\000\017\000\017\000\020\000"
+ "\016\000\020\000\017\000\021\000\020\000\021\000\017\000\022\000\021\000"
+ "\022\000\023\000\024\000\024\000\025\000\023\000\025\000\023\000\026\000"
+ "\024\000\026\000\023\000\027\000\026\000\027\000\007\000\030\000\006\000"
+ "\030\000\027\000\033\000\027\000\034\000\033\000\034\000\033\000\035\000"
+ "\027\000\035\000\036\000\037\000\037\000 \000\036\000 \000\036\000!\000\030"
+ "\000\036\000\030\000!\000\037\000!\000\010\000#\000\005\000#\000\010\000"
+ "%\000#\000%\000\010\000&\000%\000&\000'\000(\000(\000)\000'\000)\000'\000"
+ "*\000(\000*\000'\000+\000*\000+\000'\000,\000+\000,\000-\000.\000.\000/\000"
+ "-\000/\000-\0000\000.\0000\0000\0001\000.\0001\0002\0003\000\034\0003\000"
+ "\034\0002\0002\0004\0003\0004\000\026\000\035\000\026\000\033\000\033\000"
+ "5\000\026\0005\0006\0007\0007\0008\0006\0008\0006\0009\0007\0009\0009\000"
+ ":\0007\000:\000;\000<\000<\000=\000;\000=\000;\000>\000<\000>\000\021\000"
+ ">\000\021\000<\000,\000@\000'\000@\000@\000A\000,\000A\000@\000B\000A\000"
+ "B\000)\000D\000D\000E\000)\000E\0009\000=\000\034\0009\000\034\000=\000="
+ "\000F\0009\000F\000\034\000G\000\034\000H\000G\000H\000G\000I\000\034\000"
+ "I\0008\000J\000\034\000J\000\034\0008\0008\000K\000J\000K\000J\000L\000\034"
+ "\000L\000J\000M\000L\000M\000\034\000A\000\034\000,\000\034\000B\000\034"
+ "\000N\000\034\000O\000N\000O\000*\000N\000\034\000*\000\030\000P\000\030"
+ "\000Q\000P\000Q\000P\000R\000\030\000R\000\034\000S\0001\000S\000\034\000"
+ "1\000\034\000T\000S\000T\000&\000U\000\034\000U\000\034\000&\000&\000V\000"
+ "U\000V\000\036\000W\000\030\000W\000\036\000X\000W\000X\000\036\000Y\000"
+ "X\000Y\000\004\000Z\000\000\000Z\000Z\000]\000\004\000]\000Q\000]\000\004"
+ "\000Q\000W\000^\000\030\000^\000\015\000\030\000\015\000^\0002\000`\000\034"
+ "\000`\000`\000a\0002\000a\000\025\000\027\000\025\000\034\000Q\000b\000]"
+ "\000b\000b\000c\000Q\000c\000P\000c\000\034\000d\000d\000e\000\034\000e\000"
+ "\025\000d\000W\000f\000^\000f\000X\000f\000\017\000^\000\034\000h\000h\000"
+ "i\000\034\000i\000\034\000j\000h\000j\000\006\000Q\000\034\000k\000B\000"
+ "k\000H\000k\000!\000R\000b\000l\000c\000l\000\034\0000\000\034\000-\000\034"
+ "\000m\000I\000m\000m\000n\000\034\000n\000o\000p\000p\000q\000o\000q\000"
+ "U\000`\000U\000r\000`\000r\000\024\000s\000\024\000u\000s\000u\000s\000v"
+ "\000\024\000v\000p\000s\000p\000v\000p\000x\000v\000x\000p\000y\000x\000"
+ "y\000p\000z\000y\000z\000p\000{\000z\000{\000o\000{\000o\000}\000{\000}\000"
+ ".\000o\000.\000}\000/\000o\000D\000o\000/\000D\000D\000\201\000/\000\201"
+ "\000(\000D\000(\000\201\000\011\000r\000\011\000U\000\012\000r\000\012\000"
+ "`\000M\000\206\000L\000\206\000J\000\206\000J\000\207\000\206\000\207\000"
+ "K\000\207\0008\000\207\0007\000\207\000\014\000\211\0003\000\211\000\014"
+ "\0003\000\014\000\212\000\211\000\212\000\016\000\212\000\016\000\214\000"
+ "\212\000\214\000\016\000\215\000\214\000\215\000\020\000\215\000z\000\217"
+ "\000{\000\217\000\217\000\222\000z\000\222\000\222\000\223\000z\000\223\000"
+ "y\000\223\000\223\000\225\000y\000\225\000i\000\225\000i\000y\000\005\000"
+ "n\000\003\000n\000\005\000\227\000n\000\227\000#\000\227\000i\000x\000h\000"
+ "x\000j\000x\000\020\000\231\000\215\000\231\000\020\000>\000>\000\231\000"
+ ">\000\215\000\034\000>\000\034\000\215\0005\000\232\000\033\000\232\000L"
+ "\000\232\0005\000L\0005\000\206\000\010\000V\000\011\000V\000\033\000L\000"
+ "\034\000\233\000-\000\233\000O\000\233\000\024\000e\000e\000v\000\024\000"
+ "d\000\024\000\236\000u\000\236\000\026\000\236\000\026\000\241\000\236\000"
+ "\241\0005\000\241\000\206\000\241\000\207\000\241\0007\000\241\0007\000\246"
+ "\000\241\000\246\000:\000\246\000:\000<\000<\000\246\000\021\000\246\000"
+ "\021\000\252\000\246\000\252\000\022\000\252\000\022\000Y\000Y\000\252\000"
+ "\022\000X\000\022\000f\000\252\000\257\000Y\000\257\000\257\000\261\000\252"
+ "\000\261\000\257\000\263\000\261\000\263\000\257\000\264\000\263\000\264"
+ "\000\257\000\265\000\264\000\265\000 \000\257\000 \000\265\000 \000l\000"
+ "l\000\265\000\037\000l\000!\000l\000R\000l\000P\000l\000\246\000\273\000"
+ "\252\000\273\000\264\000\277\000q\000\277\000q\000\264\000\265\000\277\000"
+ "\265\000\301\000\277\000\301\000\265\000\304\000\301\000\304\000\261\000"
+ "\273\000l\000\304\000q\000\261\000q\000\273\000q\000\263\000o\000\277\000"
+ "D\000\277\000E\000\277\000\277\000\310\000E\000\310\000\236\000\312\000u"
+ "\000\312\000l\000\301\000j\000v\000j\000\314\000v\000\314\000e\000\314\000"
+ "\003\000I\000\001\000I\000\003\000m\000\034\000\225\000\034\000\223\000\034"
+ "\000\222\000\034\000\217\000\013\0004\000\013\0002\000\013\0003\000\022\000"
+ "^\0001\000}\000S\000}\000T\000}\000/\000O\000O\000\201\000/\000\233\000:"
+ "\000F\000:\000=\000=\000>\000\034\000\322\000T\000\322\000\217\000\322\000"
+ "3\000\212\000\034\000\212\000\002\000H\000H\000\324\000\002\000\324\000\001"
+ "\000H\000\001\000G\000\212\000\215\000\034\000\227\000\034\000#\000'\000"
+ "\310\000)\000\310\000@\000\310\000\310\000\324\000@\000\324\000\002\000\310"
+ "\000Z\000\310\000\002\000Z\000Z\000\277\000]\000\277\000]\000\301\000b\000"
+ "\301\000\034\000\314\000\034\000+\000*\000\201\000N\000\201\000\012\000a"
+ "\000\013\000a\000B\000\324\000k\000\324\000\034\000%\000s\000\312\000T\000"
+ "{\000{\000\322\0008\0009\000\036\000\257\000p\000\312\000q\000\312\000q\000"
+ "\236\000q\000\241\000q\000\246\0000\315gY\202\334\000\000`\032gY8\014\000"
+ "\0000\315gY\011\277\000\000\271\026gY\337\017\000\000\302\360gY\231\246\000"
+ "\000P\365w\007\231\246\000\000\000\343A\024\231\246\000\000A\027gY\231\246"
+ "\000\000\026\006\300\373\231\246\000\000\252DgY\231\246\000\000\271\026!"
+ "\360\231\246\000\000\377\177gY\231\246\000\000\377\177gY\231\246\000\000"
+ "\252DgY\231\246\000\000\217ggY\231\246\000\000\326\273gYc\320\000\000\217"
+ "ggYVH\000\000\217ggY\011\277\000\000\363.gY\313 \000\000\375\242gY\011\277"
+ "\000\000\377\177\022\036\231\246\000\000o=\027\325\231\246\000\000\223(\251"
+ "\343\231\246\000\000\377\177\251\360\231\246\000\000\377\177gY\011\277\000"
+ "\000\377\177gYgY\000\0000\315~#\231\246\000\0000\315gY\231\246\000\000\377"
+ "\177\231\246\231\246\000\000]XH\302\231\246\000\000\377\177*\312\231\246"
+ "\000\000\377\177\022\036\231\246\000\000\377\177\367@\231\246\000\000\237"
+ "\251gY\231\246\000\000e\204VV\231\246\000\000 \203gY\231\246\000\000V\260"
+ "\2457\231\246\000\000\377\177gY\231\246\000\000\377\177*\312\231\246\000"
+ "\000\377\177\011\277\011\277\000\000\377\177\231\246\231\246\000\000\377"
+ "\177\367@\011\277\000\000\377\177\251\360\231\246\000\000\377\177\022\036"
+ "\231\246\000\000\001\200gY\231\246\000\000\237\251gY\231\246\000\000 \203"
+ "gY\231\246\000\0000\315gY\231\246\000\000\377\177\000\000\000\000\000\000"
+ "\377\177gY\011\277\000\000\377\177gY\231\246\000\000\377\177\367@\367@\000"
+ "\000\302\360gY\231\246\000\000A\027gY\231\246\000\000\252DgY\231\246\000"
+ "\000\377\177gYgY\000\000\001\200gY\231\246\000\000e\204VV\231\246\000\000"
+ "\375\242gY\011\277\000\000\001\200gY\231\246\000\000V\260\2457\231\246\000"
+ "\000\326\273gYc\320\000\0000\315~#\231\246\000\0000\315gY\202\334\000\000"
+ "\000\343A\024\231\246\000\000\271\026gY\337\017\000\000P\365w\007\231\246"
+ "\000\000\026\006\300\373\231\246\000\000\271\026!\360\231\246\000\000\223"
+ "(\251\343\231\246\000\000\363.gY\313 \000\000o=\027\325\231\246\000\000\217"
+ "ggYVH\000\000]XH\302\231\246\000\000\377\177\231\246\231\246\000\000\377"
+ "\177gYgY\000\000\377\177gYgY\000\000\377\177\231\246\231\246\000\000\000"
+ "\177\000\177\000\177\000\177\201\201\201\201\201\201\201\201\201\201\201"
+ "\201\201\201\201\201[[\264\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\201\201\201\201\201\201\201\201\000\177\000\177\201\201\201\201\201"
+ "\177\201\201\201\177\177\264\177\000\201\201\201\201\201\201\201\201\000"
+ "\177\177\000\177\000\177\000\177\000\177\000\177\000\000\177\000\177\000"
+ "\177\000\177\177\000\177\000\177\000\177\000\000\177\000\177\000\177\177"
+ "\000\201\201\337\321\337\321\337\321\337\321\337\321\337\321\337\321\337"
+ "\321\337\321\337\321\337\321\337\321\337\321\337\321\337\321\337\321\337"
+ "\321\337\321\337\321-\036\011\236\000\000\001\000\002\000\001\000\000\000"
+ "\003\000\004\000\005\000\006\000\005\000\004\000\007\000\007\000\010\000"
+ "\005\000\010\000\007\000\011\000\011\000\012\000\010\000\012\000\011\000"
+ "\013\000\014\000\015\000\016\000\000\000\002\000\017\000\001\000\020\000"
+ "\021\000\020\000\001\000\022\000\001\000\021\000\002\000\017\000\002\000"
+ "\023\000\024\000\025\000\026\000\025\000\024\000\027\000\020\000\030\000"
+ "\021\000\030\000\020\000\031\000\004\000\032\000\033\000\032\000\004\000"
+ "\006\000\034\000\035\000\036\000\013\000\026\000\012\000\026\000\013\000"
+ "\024\000\037\000\014\000 \000!\000\042\000#\000\042\000!\000$\000\021\000"
+ "%\000\016\000&\000'\000(\000'\000&\000)\000)\000&\000*\000)\000*\000+\000"
+ ")\000+\000 \000,\000-\000.\000-\000,\000/\000/\000,\000\002\000\002\000,"
+ "\000\023\000\033\000$\000!\000$\000\033\000\032\000\027\000\035\000\025\000"
+ "\035\000\027\000\036\000)\0000\000'\0001\000)\0002\000\030\000%\000\021\000"
+ "2\000)\000 \0003\0000\000)\000\002\0004\000/\0004\000\002\0005\0005\000\002"
+ "\0006\0006\000\002\000\016\000\016\000\002\000\021\0001\0003\000)\0003\000"
+ "1\0007\000\022\000\001\000\003\000\042\0008\000#\0009\000:\000;\000:\000"
+ "9\000<\000:\000<\000=\000=\000<\000>\000=\000>\000\077\000\077\000>\000@"
+ "\000\077\000@\000A\000A\000@\000B\000A\000B\000C\000A\000C\000D\000A\000"
+ "D\000E\000A\000E\000F\000F\000E\000G\000F\000G\000H\000H\000G\000I\000H\000"
+ "I\000J\000H\000J\000K\000L\000M\000'\000L\000'\0000\000L\0000\0003\000\000"
+ "\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003"
+ "\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000\005"
+ "\000\007\000\007\000\010\000\005\000\010\000\007\000\011\000\010\000\011"
+ "\000\011\000\012\000\010\000\012\000\011\000\013\000\012\000\013\000\011"
+ "\000\016\000\013\000\016\000\002\000\017\000\000\000\017\000\001\000\020"
+ "\000\020\000\021\000\001\000\021\000\001\000\022\000\020\000\022\000\002"
+ "\000\021\000\002\000\023\000\017\000\023\000\024\000\025\000\025\000\026"
+ "\000\024\000\026\000\024\000\027\000\025\000\027\000\020\000\030\000\021"
+ "\000\030\000\020\000\031\000\030\000\031\000\004\000\032\000\032\000\033"
+ "\000\004\000\033\000\006\000\032\000\034\000\035\000\035\000\036\000\034"
+ "\000\036\000\013\000\026\000\012\000\026\000\013\000\024\000\013\000 \000"
+ "\024\000 \000!\000\042\000\042\000#\000!\000#\000!\000$\000\042\000$\000"
+ "\013\000\021\000\016\000\021\000\036\000'\000\034\000'\000\036\000)\000'"
+ "\000)\000\027\000\036\000\027\000)\000\024\000)\000 \000)\000!\000,\000#"
+ "\000,\000\033\000,\000\033\000!\000\002\000,\000\002\000\033\000\023\000"
+ ",\000\033\000$\000\032\000$\000\027\000\035\000\025\000\035\000)\0000\000"
+ "'\0000\000\030\000)\000\013\000)\000\013\000\030\0000\0003\000)\0003\000"
+ "\002\000\004\000\002\000\007\000\002\000\011\000\002\000\016\000\030\000"
+ "3\000\031\0003\000\003\000\022\000\042\000,\000\023\000\042\000\023\000$"
+ "\000\017\000$\000\017\000\032\000\000\000\032\000\000\000\006\000\003\000"
+ "\006\000\003\000\005\000\003\000\010\000\003\000\012\000\003\000\026\000"
+ "\022\000\026\000\022\000\025\000\020\000\025\000\020\000\035\000\020\000"
+ "\034\000\031\000\034\000\031\000'\000\031\0000\000*\312\231\246\001\200\000"
+ "\000\231\246\231\246\001\200\000\000C\304C\304\001\200\000\0007\3567\356"
+ "\001\200\000\000\251\360\231\246\001\200\000\000\370\332\370\332\001\200"
+ "\000\000\022\036\231\246\001\200\000\000\235/\231\246*D\000\000~#\231\246"
+ "\3202\000\000\367@\231\246\3202\000\000\310\363\231\246\240\345\000\000\252"
+ "\267\231\246q\230\000\000\367@\231\246q\230\000\0005\337\231\246\015\321"
+ "\000\000!\360\231\246G\351\000\000\022\036\231\246\001\200\000\000\367@\231"
+ "\246\001\200\000\000\251\360\231\246\001\200\000\000*\312\231\246\001\200"
+ "\000\000\231\246\231\246\001\200\000\000gY\231\246\3202\000\000gY\231\246"
+ "q\230\000\000gY\337\017G\351\000\000gY\011\277\3202\000\000gY\011\277q\230"
+ "\000\000gY\202\334\3202\000\000gY\231\246\001\200\000\000\010%\010%\001\200"
+ "\000\000gY\356\341\001\200\000\000\311\021\311\021\001\200\000\000gYW\017"
+ "\001\200\000\000\000\000\000\000\001\200\000\000gY\231\246\001\200\000\000"
+ "\022\036\231\246\001\200\000\000gY\231\246\001\200\000\000gY\3265\001\200"
+ "\000\000\275;\275;\001\200\000\000gYgY\001\200\000\000gY\356\341\001\200"
+ "\000\000gY\011\277\001\200\000\000\231\246\231\246\001\200\000\0005\337\231"
+ "\246\015\321\000\000C\304C\304\001\200\000\000!\360\231\246G\351\000\000"
+ "~#\231\246\3202\000\000\235/\231\246*D\000\000\367@\231\246\003]\000\000"
+ "gY\231\246\377\177\000\000gY\011\277\003]\000\000gY\202\334\3202\000\000"
+ "\370\332\370\332\001\200\000\0007\3567\356\001\200\000\000gY\337\017G\351"
+ "\000\000\000\000\000\000\001\200\000\000\311\021\311\021\001\200\000\000"
+ "gYVHq\230\000\000\010%\010%\001\200\000\000\275;\275;\001\200\000\000gYg"
+ "Y\001\200\000\000gY\231\246q\230\000\000gY\231\246\001\200\000\000gY\011"
+ "\277\003]\000\000gY\231\246\3202\000\000\367@\231\246\003]\000\000gYVHq\230"
+ "\000\000gY\356\341\001\200\000\000gYW\017\001\200\000\000gY\3265\001\200"
+ "\000\000gYgY\001\200\000\000gY\231\246\377\177\000\000gY\231\246\377\177"
+ "\000\000\177\201\177\201\177\201\177\201\177\201\177\201\177\201\000\201"
+ "\000\201\000\201\000\201\000\202\000\201\377\202\000\201\000\201\000\201"
+ "\000\201\000\201\377\202\000\201\000\201\177\000\177\000\177\000\177\000"
+ "\000\201\177\177\177\177\177\177\177\177\177\201\177\201L\201[\245\201\177"
+ "\201\177\201\177\177@\177\000\321/\321/\321/\321/\321/\321/\321/\321/\321"
+ "/\321/\321/\321/\321/\321/\321/\321/\321/\321/\321/\177\000\177\000\177\000"
+ "\177\000\000\201\177\000\177\000\177\000\177\000\177\000\177\000\000\201"
+ "\000\000\000\000\001\000\002\000\003\000\004\000\005\000\004\000\003\000"
+ "\006\000\005\000\000\000\002\000\000\000\005\000\004\000\007\000\010\000"
+ "\011\000\012\000\013\000\014\000\013\000\012\000\015\000\011\000\016\000"
+ "\012\000\016\000\011\000\010\000\014\000\017\000\020\000\017\000\014\000"
+ "\021\000\021\000\014\000\022\000\022\000\014\000\023\000\023\000\014\000"
+ "\013\000\024\000\014\000\025\000\014\000\024\000\011\000\026\000\027\000"
+ "\030\000\027\000\026\000\031\000\014\000\032\000\025\000\033\000\034\000"
+ "\035\000\034\000\033\000\036\000\037\000\006\000\003\000\006\000\037\000"
+ " \000!\000\042\000\020\000#\000$\000%\000\035\000 \000\037\000 \000\035\000"
+ "\034\000\042\000&\000'\000$\000\036\000\033\000\036\000$\000#\000\015\000"
+ "\023\000\013\000(\000)\000*\000*\000)\000+\000*\000+\000,\000*\000,\000-"
+ "\000*\000-\000.\000*\000.\000/\000*\000/\0000\000*\0000\0001\000*\0001\000"
+ "2\0002\0001\0003\0003\0001\0004\0003\0004\0005\0005\0004\0006\0006\0004\000"
+ "7\0006\0007\0008\0008\0007\0009\0009\0007\000:\000\030\000;\000<\000\031"
+ "\000=\000\027\000\014\000\020\000\032\000\030\000>\000;\000>\000\030\000"
+ "\027\000\077\000\007\000\011\000\011\000\012\000\014\000@\000\026\000\030"
+ "\000A\000\030\000'\000\030\000A\000@\000@\000A\000B\000@\000B\000C\000@\000"
+ "C\000D\000\027\000E\000>\000E\000\027\000=\000\030\000<\000'\000F\000\011"
+ "\000\024\000\011\000F\000\077\000\016\000\015\000\012\000\000\000\001\000"
+ "\001\000\002\000\000\000\002\000\003\000\004\000\004\000\005\000\003\000"
+ "\005\000\003\000\006\000\004\000\006\000\000\000\005\000\002\000\005\000"
+ "\000\000\004\000\007\000\010\000\010\000\011\000\007\000\011\000\012\000"
+ "\013\000\013\000\014\000\012\000\014\000\012\000\015\000\013\000\015\000"
+ "\011\000\016\000\012\000\016\000\011\000\012\000\010\000\016\000\006\000"
+ "\014\000\006\000\020\000\014\000\020\000\004\000\014\000\000\000\014\000"
+ "\001\000\014\000\001\000\013\000\014\000\024\000\014\000\025\000\024\000"
+ "\025\000\011\000\024\000\011\000\014\000\026\000\027\000\027\000\030\000"
+ "\026\000\030\000\026\000\031\000\027\000\031\000\014\000\032\000\025\000"
+ "\032\000\033\000\034\000\034\000\035\000\033\000\035\000\033\000\036\000"
+ "\034\000\036\000\006\000\037\000\003\000\037\000\032\000\037\000\006\000"
+ "\032\000\020\000\032\000#\000$\000$\000%\000#\000%\000\032\000\035\000\035"
+ "\000\037\000\032\000\034\000\034\000'\000\032\000'\000\036\000$\000\033\000"
+ "$\000\036\000#\000\001\000\015\000\002\000\015\000\015\000\016\000\002\000"
+ "\016\000\002\000\010\000\002\000\007\000\007\000.\000\002\000.\000.\000/"
+ "\000\002\000/\000/\0000\000\002\0000\000\031\0000\000\002\000\031\000\005"
+ "\000\031\000\003\000\031\000\003\000\026\000\026\000\037\000\026\000\035"
+ "\000\026\0007\000\035\0007\000\033\0007\000$\0007\000%\0007\000\025\000\030"
+ "\000\030\000\032\000\027\0000\000\024\000\030\000\024\000\027\000\011\000"
+ ".\000\030\0007\000\030\000\034\000\030\000'\000\034\0007\000\036\0007\000"
+ "#\0007\000\027\000/\000\024\000/\000\011\000/\000\001\200\377\177vZ\000\000"
+ "\220\275\377\177\220\275\000\000\001\200\377\177\220\275\000\000\220\275"
+ "\377\177pB\000\000\001\200\377\177\377\177\000\000w\025\377\177\001\200\000"
+ "\000\220\275\377\177\001\200\000\000\377\177\377\177\001\200\000\000pB\377"
+ "\177\220\275\000\000\000\000\377\177\000\000\000\000\377\177\377\177\001"
+ "\200\000\000#@#@\001\200\000\000w\025\377\177\001\200\000\000\335\277\335"
+ "\277\001\200\000\000\001\200\212\245\001\200\000\000\001\200\211\352\001"
+ "\200\000\000\001\200\001\200\001\200\000\000\001\200\377\177\001\200\000"
+ "\000\001\200pB\001\200\000\000\001\200pB\220\275\000\000\001\200\377\177"
+ "\220\275\000\000\001\200\377\177\001\200\000\000\001\200\000\000\000\000"
+ "\000\000\001\200pBpB\000\000\220\275\377\177\001\200\000\000\000\000\000"
+ "\000\001\200\000\000\001\200\377\177\001\200\000\000\001\200pB\001\200\000"
+ "\000\001\200\220\275\220\275\000\000\001\200\212\245\001\200\000\000\001"
+ "\200\001\200\001\200\000\000\001\200\211\352\001\200\000\000\001\200\377"
+ "\177\377\177\000\000\001\200\377\177\220\275\000\000\001\200\377\177\377"
+ "\177\000\000\335\277\335\277\001\200\000\000\001\200\220\275\220\275\000"
+ "\000\001\200\001\200\001\200\000\000\000\000\000\000\001\200\000\000#@#@"
+ "\001\200\000\000\377\177\377\177\001\200\000\000pB\377\177\220\275\000\000"
+ "\000\000\377\177\000\000\000\000\001\200\000\000\000\000\000\000\220\275"
+ "\377\177pB\000\000\001\200pBpB\000\000\001\200\377\177\377\177\000\000\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\177\201\177\201\177\201\177\201\177\177\177\201\177\177\201\000\201"
+ "\000\201\000\201\000\000\177\201\000\201\000\177\201\177\201\177\201\177"
+ "\177\201\000\201\000\201\000\201\000\201\000\300@\265\026*\326*\326*\326"
+ "*\326*\326*\326*\326*\326*\326*\326*\326*\326\000\000\000\000\001\000\002"
+ "\000\001\000\000\000\003\000\003\000\000\000\004\000\001\000\005\000\006"
+ "\000\005\000\001\000\007\000\007\000\001\000\010\000\011\000\010\000\001"
+ "\000\012\000\013\000\014\000\015\000\016\000\017\000\016\000\015\000\020"
+ "\000\021\000\022\000\023\000\021\000\023\000\024\000\001\000\025\000\002"
+ "\000\023\000\026\000\027\000\030\000\031\000\032\000\031\000\030\000\014"
+ "\000\031\000\014\000\013\000\031\000\033\000\032\000\033\000\031\000\017"
+ "\000\017\000\031\000\015\000\034\000\035\000\036\000\035\000\034\000\037"
+ "\000\037\000\034\000\023\000\037\000\023\000\022\000\001\000\006\000\025"
+ "\000\023\000\034\000\026\000\003\000\011\000\001\000 \000\023\000\027\000"
+ "\023\000 \000\024\000!\000\042\000\000\000#\000$\000%\000$\000#\000&\000"
+ "$\000&\000'\000$\000'\000(\000$\000(\000)\000$\000)\000*\000$\000*\000+\000"
+ "+\000*\000,\000+\000,\000-\000-\000,\000.\000\000\000\001\000\001\000\002"
+ "\000\000\000\002\000\000\000\003\000\001\000\003\000\000\000\004\000\003"
+ "\000\004\000\001\000\005\000\005\000\006\000\001\000\006\000\001\000\007"
+ "\000\005\000\007\000\001\000\010\000\007\000\010\000\010\000\011\000\001"
+ "\000\011\000\007\000\013\000\005\000\013\000\015\000\016\000\016\000\017"
+ "\000\015\000\017\000\015\000\020\000\016\000\020\000\021\000\022\000\022"
+ "\000\023\000\021\000\023\000\002\000\023\000\002\000\021\000\001\000\021"
+ "\000\023\000\026\000\026\000\027\000\023\000\027\000\006\000\031\000\021"
+ "\000\031\000\006\000\021\000\005\000\031\000\013\000\031\000\022\000\031"
+ "\000\017\000\031\000\017\000\022\000\015\000\031\000\016\000\034\000\020"
+ "\000\034\000\017\000\034\000\023\000\034\000\017\000\023\000\026\000\034"
+ "\000\003\000\011\000\004\000\023\000\004\000\027\000\002\000\004\000\015"
+ "\000\034\000\031\000\034\000\013\000\034\000\007\000\034\000\010\000\034"
+ "\000\011\000\034\000\011\000\026\000\003\000\026\000\003\000\027\000gY\001"
+ "\200\231\246\000\000\3265\001\200\231\246\000\000\270=\243\247\231\246\000"
+ "\000\231\246q\230\011\277\000\000\231\246\001\200\231\246\000\000\231\246"
+ "\001\200\011\277\000\000\231\246q\230\231\246\000\000\231\246V\273\231\246"
+ "\000\000\231\246\3202\011\277\000\000\231\246\277\350\231\246\000\000\231"
+ "\246>\017\231\246\000\000\231\246\3202\231\246\000\000[\310\252O\231\246"
+ "\000\000\231\246\3202\231\246\000\000\231\246aV\231\246\000\000\202\334\320"
+ "2\231\246\000\000\231\246>\017\231\246\000\000\277\353\000\035\231\246\000"
+ "\000\231\246\277\350\231\246\000\000\211\370\260\012\231\246\000\000\252"
+ "\251\233{\231\246\000\000\231\246\340|\231\246\000\000@\004\352\371\231\246"
+ "\000\000\231\246q\230\231\246\000\000\231\246V\273\231\246\000\000\231\246"
+ "\001\200\231\246\000\000\337\017G\351\231\246\000\000W\034m\327\231\246\000"
+ "\000W\017\001\200\231\246\000\000\356\341\001\200\231\246\000\000\351*\221"
+ "\302\231\246\000\000\231\246G\351\337\017\000\000\231\246\3202\202\334\000"
+ "\000\231\246q\230VH\000\000\231\246\003]\011\277\000\000\231\246aV\231\246"
+ "\000\000\231\246\340|\231\246\000\000\231\246\377\177\231\246\000\000\231"
+ "\246\001\200gY\000\000\011\277\001\200\231\246\000\000\000\000\001\200\000"
+ "\000\000\000\011\277\001\200\011\277\000\000\367@\001\200\011\277\000\000"
+ "\231\246\001\200\231\246\000\000\011\277\001\200\231\246\000\000\011\277"
+ "\001\200\367@\000\000\231\246\001\200\011\277\000\000\231\246\001\200gY\000"
+ "\000\3265\001\200\231\246\000\000gY\001\200\231\246\000\000W\017\001\200"
+ "\231\246\000\000\356\341\001\200\231\246\000\000\231\246\377\177\231\246"
+ "\000\000\011\277\001\200\367@\000\000\231\246q\230VH\000\000\231\246\001"
+ "\200gY\000\000\000\000\001\200\000\000\000\000\367@\001\200\011\277\000\000"
+ "gY\001\200\231\246\000\000\270=\243\247\231\246\000\000\231\246G\351\337"
+ "\017\000\000\351*\221\302\231\246\000\000W\034m\327\231\246\000\000\337\017"
+ "G\351\231\246\000\000@\004\352\371\231\246\000\000\231\246\3202\202\334\000"
+ "\000\211\370\260\012\231\246\000\000\277\353\000\035\231\246\000\000\202"
+ "\334\3202\231\246\000\000[\310\252O\231\246\000\000\231\246\003]\011\277"
+ "\000\000\252\251\233{\231\246\000\000\231\246\377\177\231\246\000\000\201"
+ "\201\201\201\201\201\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\177\177\201\177\177\177\201\177\201\177\201\177\201"
+ "\177\201\177\177\177\177\177\201\177\201\177\201\177\201\201\201\201\201"
+ "\201\201\201\201\201\201\201\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\177\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\177\177/!/!/!/!/!/!"
+ "/!/!/!/!/!/!/!/!/!/!/!/!/!/!\000\000\000\000\001\000\002\000\003\000\004"
+ "\000\005\000\003\000\006\000\004\000\003\000\007\000\006\000\007\000\003"
+ "\000\010\000\007\000\010\000\011\000\011\000\010\000\012\000\012\000\010"
+ "\000\013\000\014\000\015\000\016\000\015\000\014\000\017\000\017\000\020"
+ "\000\015\000\020\000\017\000\021\000\021\000\022\000\020\000\022\000\021"
+ "\000\023\000\024\000\016\000\025\000\016\000\024\000\014\000\026\000\027"
+ "\000\030\000\027\000\026\000\031\000\031\000\026\000\032\000\033\000\034"
+ "\000\035\000\034\000\033\000\036\000\036\000\001\000\034\000\001\000\036"
+ "\000\002\000\037\000\010\000\003\000\010\000\037\000 \000\037\000\003\000"
+ "!\000\042\000\013\000\010\000\013\000\042\000#\000#\000\042\000$\000$\000"
+ "\042\000%\000\042\000\010\000 \000!\000\005\000&\000\005\000!\000\003\000"
+ "\023\000\030\000\022\000\030\000\023\000\026\000\032\000'\000\031\000'\000"
+ "\032\000\035\000\035\000\032\000\033\000(\000)\000*\000)\000+\000,\000-\000"
+ ".\000)\000.\000-\000/\000*\0000\0001\0000\000*\0002\0002\000*\0003\0003\000"
+ "*\000,\000,\000*\000)\000-\000)\000(\000.\000+\000)\000\024\000\025\0004"
+ "\0005\0006\0007\0006\0005\0008\0006\0008\0009\0006\0009\000:\0006\000:\000"
+ ";\0006\000;\000<\000<\000;\000=\000<\000=\000>\000<\000>\000\077\000<\000"
+ "\077\000@\000<\000@\000A\000A\000@\000B\000A\000B\000C\000A\000C\000D\000"
+ "A\000D\000E\000A\000E\000F\000F\000E\000G\000F\000G\000H\000\000\000\001"
+ "\000\001\000\002\000\000\000\002\000\003\000\004\000\004\000\005\000\003"
+ "\000\005\000\003\000\006\000\004\000\006\000\003\000\007\000\006\000\007"
+ "\000\003\000\010\000\007\000\010\000\010\000\011\000\007\000\011\000\010"
+ "\000\012\000\011\000\012\000\010\000\013\000\012\000\013\000\013\000\014"
+ "\000\013\000\016\000\014\000\016\000\014\000\017\000\013\000\017\000\012"
+ "\000\017\000\017\000\021\000\012\000\021\000\011\000\021\000\021\000\023"
+ "\000\011\000\023\000\016\000\024\000\016\000\025\000\024\000\025\000\014"
+ "\000\024\000\006\000\026\000\007\000\026\000\004\000\026\000\026\000\032"
+ "\000\004\000\032\000\033\000\034\000\034\000\035\000\033\000\035\000\033"
+ "\000\036\000\034\000\036\000\001\000\036\000\001\000\034\000\002\000\036"
+ "\000\010\000\037\000\003\000\037\000\037\000 \000\010\000 \000\003\000!\000"
+ "\037\000!\000\013\000\042\000\010\000\042\000\016\000\042\000\025\000\042"
+ "\000\042\000%\000\025\000%\000 \000\042\000\005\000!\000\005\000&\000!\000"
+ "&\000\007\000\023\000\023\000\026\000\032\000'\000\004\000'\000\032\000\035"
+ "\000\035\000'\000\032\000\033\000(\000)\000)\000*\000(\000*\000\004\000)"
+ "\000'\000)\000\005\000-\000\005\000)\000)\000-\000&\000-\000\001\000*\000"
+ "\000\000*\000\034\000*\000\035\000*\000'\000*\000(\000-\000\024\000%\000"
+ "!\000-\000!\000(\000!\000*\000\000\000!\000\002\000!\000\002\000\037\000"
+ "\036\000\037\000\033\000\037\000\032\000\037\000\026\000\037\000\026\000"
+ " \000\023\000 \000\021\000 \000\017\000 \000\014\000 \000\014\000\042\000"
+ "\024\000\042\000A\024\000\343gY\000\000gYA\027gY\000\000w\007P\365gY\000"
+ "\000gY\302\360gY\000\000~#0\315gY\000\000gY0\315gY\000\000VVe\204gY\000\000"
+ "gY\237\251gY\000\000\2457V\260gY\000\000gY \203gY\000\000\231\246\377\177"
+ "gY\000\000\367@\377\177\367@\000\000\011\277\377\177\367@\000\000\367@\377"
+ "\177gY\000\000\231\246\377\177gY\000\000*\312\377\177gY\000\000\251\360\377"
+ "\177gY\000\000\022\036\377\177gY\000\000gY\377\177gY\000\000gY\375\242\367"
+ "@\000\000gY \203gY\000\000gY\001\200gY\000\000gY\237\251gY\000\000gY0\315"
+ "\367@\000\000gY0\315gY\000\000gY\377\177gY\000\000gY\217g\367@\000\000gY"
+ "\377\177\367@\000\000gY\302\360gY\000\000gYA\027gY\000\000gY\252DgY\000\000"
+ "gY\217ggY\000\000\000\000\377\177\000\000\000\000\367@\377\177\011\277\000"
+ "\000gY\377\177\367@\000\000gY\377\177\231\246\000\000gY\271\026!\360\000"
+ "\000gY0\315~#\000\000gY\377\177\231\246\000\000gY\217g\252\267\000\000gY"
+ "\252DgY\000\000\300\373\026\006gY\000\000\251\343\223(gY\000\000\027\325"
+ "o=gY\000\000H\302]XgY\000\000!\360\271\026gY\000\000gY\377\177gY\000\000"
+ "gY\377\177gY\000\000gY\252DgY\000\000\231\246\377\177gY\000\000gY\001\200"
+ "gY\000\000VVe\204gY\000\000gY\375\242\367@\000\000gY\001\200gY\000\000\245"
+ "7V\260gY\000\000gY0\315~#\000\000~#0\315gY\000\000A\024\000\343gY\000\000"
+ "gY\271\026!\360\000\000w\007P\365gY\000\000\300\373\026\006gY\000\000!\360"
+ "\271\026gY\000\000\251\343\223(gY\000\000gY\217g\252\267\000\000\027\325"
+ "o=gY\000\000H\302]XgY\000\000\231\246\377\177gY\000\000\011\277\377\177\367"
+ "@\000\000gY\377\177\231\246\000\000gY\377\177\231\246\000\000\011\277\377"
+ "\177\367@\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\177\000\177\000\177\000\177\266B\000\000\000"
+ "\000\000\000\000\177\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\000\177\000\177\000"
+ "\177\000\177\177\000\177\000\177\000\177\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000$$3\000\000\000\000\000\242\260\242\260\242\260"
+ "\242\260\242\260\242\260\242\260\242\260\242\260\242\260\242\260\242\260"
+ "\242\260\242\260\242\260\242\260\242\260\242\260c;\250S\000\000\000\000\001"
+ "\000\002\000\001\000\000\000\003\000\004\000\003\000\000\000\003\000\004"
+ "\000\005\000\006\000\007\000\010\000\007\000\006\000\011\000\010\000\005"
+ "\000\004\000\005\000\010\000\007\000\012\000\013\000\014\000\013\000\012"
+ "\000\015\000\015\000\016\000\017\000\015\000\017\000\020\000\015\000\020"
+ "\000\021\000\022\000\013\000\015\000\023\000\024\000\025\000\024\000\023"
+ "\000\026\000\026\000\023\000\027\000\026\000\027\000\030\000\031\000\032"
+ "\000\033\000\032\000\030\000\027\000\030\000\032\000\034\000\034\000\032"
+ "\000\035\000\035\000\032\000\036\000\036\000\032\000\037\000\013\000 \000"
+ "\014\000!\000\042\000#\000\042\000!\000\013\000$\000\027\000%\000\027\000"
+ "$\000\032\000&\000\032\000'\000\032\000&\000\033\000\022\000\042\000\013"
+ "\000\013\000!\000 \000\032\000$\000'\000\002\000(\000)\000(\000\002\000\001"
+ "\000*\000\020\000+\000\020\000*\000\021\000+\000\017\000,\000\017\000+\000"
+ "\020\000-\000\021\000*\000\021\000-\000.\000\021\000/\000\015\000)\000.\000"
+ "-\000.\000)\000(\000/\0000\000\037\000\027\000\023\000%\000\017\0001\000"
+ ",\000\031\000\037\000\032\000\011\000\006\0002\0003\0004\0005\0004\0003\000"
+ "6\0004\0006\0007\0007\0006\0008\0007\0008\0009\0007\0009\000:\000:\0009\000"
+ ";\000:\000;\000<\000:\000<\000=\000:\000=\000>\000:\000>\000\077\000\077"
+ "\000>\000@\000\077\000@\000A\000\077\000A\000B\000\077\000B\000C\000C\000"
+ "D\000\077\000E\000F\000 \000E\000 \000!\000\000\000\001\000\001\000\002\000"
+ "\000\000\002\000\000\000\003\000\001\000\003\000\003\000\004\000\000\000"
+ "\004\000\004\000\005\000\003\000\005\000\006\000\007\000\007\000\010\000"
+ "\006\000\010\000\006\000\011\000\007\000\011\000\005\000\010\000\004\000"
+ "\010\000\005\000\007\000\012\000\013\000\013\000\014\000\012\000\014\000"
+ "\012\000\015\000\013\000\015\000\012\000\017\000\015\000\017\000\017\000"
+ "\020\000\015\000\020\000\020\000\021\000\015\000\021\000\013\000\022\000"
+ "\015\000\022\000\011\000\023\000\011\000\025\000\023\000\025\000\007\000"
+ "\023\000\023\000\027\000\007\000\027\000\005\000\027\000\022\000\032\000"
+ "\032\000\033\000\022\000\033\000\005\000\032\000\027\000\032\000\003\000"
+ "\032\000\001\000\032\000\032\000\036\000\001\000\036\000\032\000\037\000"
+ "\036\000\037\000\013\000 \000\014\000 \000\033\000!\000\033\000#\000!\000"
+ "#\000\013\000!\000\013\000\033\000\027\000$\000\027\000%\000$\000%\000\032"
+ "\000$\000\032\000#\000\032\000'\000#\000'\000 \000!\000$\000'\000\002\000"
+ "\036\000\036\000)\000\002\000)\000\020\000*\000\020\000+\000*\000+\000\021"
+ "\000*\000\017\000+\000\017\000,\000+\000,\000\021\000-\000*\000-\000\022"
+ "\000-\000\021\000\022\000\022\000)\000)\000-\000\022\000\036\000\022\000"
+ "\037\000\023\000%\000\012\000,\000\006\000\025\000\006\000\023\000\010\000"
+ "\023\000\010\000%\000\004\000%\000\000\000%\000\000\000$\000\002\000$\000"
+ "$\000)\000$\000-\000$\000*\000'\000*\000'\000+\000'\000,\000\012\000'\000"
+ "\014\000'\000\014\000#\000 \000#\000\011\277gY0\315\000\000c\320gY\326\273"
+ "\000\000\011\277gY\375\242\000\0008\014gY`\032\000\000\202\334gY0\315\000"
+ "\000\337\017gY\271\026\000\000\231\246gY0\315\000\000\231\246gY\001\200\000"
+ "\000\000\000\000\000\377\177\000\000\011\277gY\377\177\000\000\231\246gY"
+ "\377\177\000\000\356\341gY\377\177\000\000\311\021\311\021\377\177\000\000"
+ "7\3567\356\377\177\000\000\231\246\367@\377\177\000\000\231\246\022\036\377"
+ "\177\000\000W\017gY\377\177\000\000\010%\010%\377\177\000\000C\304C\304\377"
+ "\177\000\000\231\246*\312\377\177\000\000\231\246\231\246\377\177\000\000"
+ "\370\332\370\332\377\177\000\000\231\246\251\360\377\177\000\000\231\246"
+ "gY\377\177\000\000\011\277gY\217g\000\000\231\246gY\217g\000\000\231\246"
+ "\367@\217g\000\000\231\246~#0\315\000\000\231\246!\360\271\026\000\000\231"
+ "\246\367@0\315\000\000\231\246gY\377\177\000\000\231\246\367@\377\177\000"
+ "\000\231\246gY\217g\000\000\231\246gY0\315\000\000\231\246\252\267\217g\000"
+ "\000\231\246\367@\375\242\000\000\231\246gY\001\200\000\000\313 gY\363.\000"
+ "\000VHgY\217g\000\000\3265gY\377\177\000\000\275;\275;\377\177\000\000\011"
+ "\277gY\377\177\000\000gYgY\377\177\000\000gYgY\377\177\000\000\011\277gY"
+ "\377\177\000\000\231\246*\312\377\177\000\000\231\246\231\246\377\177\000"
+ "\000\231\246\251\360\377\177\000\000\231\246\022\036\377\177\000\000gYgY"
+ "\377\177\000\000\231\246gY\001\200\000\000VHgY\217g\000\000\231\246\367@"
+ "\375\242\000\000VHgY\217g\000\000\231\246gY\001\200\000\000\313 gY\363.\000"
+ "\000\011\277gY\375\242\000\000c\320gY\326\273\000\000\202\334gY0\315\000"
+ "\000\337\017gY\271\026\000\000\231\246\252\267\217g\000\000C\304C\304\377"
+ "\177\000\000\231\246\231\246\377\177\000\000\231\246!\360\271\026\000\000"
+ "\370\332\370\332\377\177\000\0007\3567\356\377\177\000\000\000\000\000\000"
+ "\377\177\000\000\231\246~#0\315\000\000\311\021\311\021\377\177\000\000\010"
+ "%\010%\377\177\000\000\275;\275;\377\177\000\000gYgY\377\177\000\000\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\177\000\177\000\177\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\000\177\000\177\000\000\000\000\000\177\000\177b\353\000L\201\000\201"
+ "\000\201\000\201\000\000\000P\260P\260P\260\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201P\260P\260P\260P\260P\260P\260P\260P\260P\260P\260"
+ "P\260P\260\000\000\001\000\002\000\003\000\004\000\000\000\004\000\003\000"
+ "\005\000\006\000\002\000\007\000\002\000\006\000\000\000\010\000\011\000"
+ "\012\000\011\000\010\000\013\000\013\000\010\000\014\000\015\000\016\000"
+ "\017\000\016\000\015\000\012\000\012\000\015\000\010\000\014\000\020\000"
+ "\013\000\020\000\014\000\021\000\022\000\023\000\024\000\025\000\017\000"
+ "\026\000\017\000\025\000\015\000\027\000\030\000\031\000\030\000\003\000"
+ "\000\000\032\000\033\000\034\000\033\000\032\000\035\000\036\000\032\000"
+ "\037\000 \000\035\000\032\000\035\000 \000!\000\032\000\034\000\042\000!"
+ "\000#\000\035\000#\000!\000$\000\030\000%\000\003\000%\000\030\000&\000\021"
+ "\000'\000\020\000'\000\021\000(\000\004\000\001\000\000\000)\000&\000\030"
+ "\000&\000)\000*\000+\000,\000\013\000+\000\013\000\020\000+\000\020\000'"
+ "\000\022\000\026\000\023\000\026\000\022\000\025\000#\000\033\000\035\000"
+ " \000\032\000\036\000-\000\042\000.\000\042\000-\000\032\000\032\000-\000"
+ "/\000\032\000/\0000\000\032\0000\000\037\000)\000\030\000\027\0001\000'\000"
+ "(\000\031\000\000\000\006\000\000\000\031\000\030\000%\000\005\000\003\000"
+ "2\0003\0004\0005\0006\0007\000%\000\007\000\002\0007\0008\0009\000%\000\001"
+ "\000\004\0007\000:\000;\000<\000=\000>\000=\000<\000\077\000=\000\077\000"
+ "@\000@\000\077\000A\000A\000\077\000B\000B\000\077\000C\000B\000C\000D\000"
+ "D\000C\000E\000E\000C\0004\000E\0004\000F\000F\0004\000G\000G\0004\0003\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\003\000\004\000\000\000"
+ "\004\000\000\000\003\000\003\000\005\000\004\000\005\000\002\000\006\000"
+ "\002\000\007\000\006\000\007\000\000\000\006\000\010\000\011\000\011\000"
+ "\012\000\010\000\012\000\010\000\013\000\011\000\013\000\010\000\014\000"
+ "\013\000\014\000\015\000\016\000\016\000\017\000\015\000\017\000\012\000"
+ "\015\000\012\000\016\000\010\000\015\000\014\000\020\000\013\000\020\000"
+ "\014\000\021\000\020\000\021\000\022\000\023\000\023\000\024\000\022\000"
+ "\024\000\017\000\025\000\017\000\026\000\025\000\026\000\015\000\025\000"
+ "\012\000\030\000\030\000\031\000\012\000\031\000\003\000\030\000\000\000"
+ "\030\000\032\000\033\000\033\000\034\000\032\000\034\000\032\000\035\000"
+ "\033\000\035\000\012\000\032\000\016\000\032\000\031\000\035\000\031\000"
+ "\032\000\006\000\031\000\006\000\035\000\034\000\042\000\032\000\042\000"
+ "\006\000#\000\035\000#\000\007\000#\000\030\000%\000\003\000%\000\030\000"
+ "&\000%\000&\000\021\000'\000\020\000'\000\021\000(\000'\000(\000\001\000"
+ "\004\000\011\000&\000\011\000\030\000\011\000*\000&\000*\000\013\000*\000"
+ "\020\000*\000'\000*\000\022\000\026\000\023\000\026\000\022\000\025\000\033"
+ "\000#\000\023\000\042\000\024\000\042\000\023\000\032\000\026\000\032\000"
+ "\017\000\032\000(\000*\000\000\000\031\000\005\000%\000\007\000&\000#\000"
+ "&\000\007\000%\000\002\000%\000\001\000%\000\004\000%\000\022\000\042\000"
+ "\022\000\034\000\025\000\034\000\015\000\034\000\010\000\034\000\010\000"
+ "\033\000\014\000\033\000\021\000\033\000\021\000#\000#\000(\000#\000*\000"
+ "\211\352\001\200\377\177\000\000\000\000\000\000\377\177\000\000\335\277"
+ "\335\277\377\177\000\000pB\001\200\377\177\000\000\377\177\001\200\377\177"
+ "\000\000\377\177w\025\377\177\000\000\377\177\377\177\377\177\000\000#@#"
+ "@\377\177\000\000\377\177\001\200pB\000\000pB\001\200\220\275\000\000\377"
+ "\177\001\200\001\200\000\000pB\001\200pB\000\000pB\001\200\377\177\000\000"
+ "\220\275\001\200pB\000\000\211\352\001\200\377\177\000\000\001\200\001\200"
+ "\377\177\000\000\377\177\001\200\377\177\000\000\000\000\001\200\000\000"
+ "\000\000\377\177\220\275pB\000\000\377\177\001\200\377\177\000\000\377\177"
+ "\001\200pB\000\000\377\177\001\200\001\200\000\000\377\177\220\275\220\275"
+ "\000\000\377\177\220\275\377\177\000\000\377\177pBpB\000\000\377\177w\025"
+ "\377\177\000\000\377\177\377\177\377\177\000\000\377\177\000\000\000\000"
+ "\000\000\001\200\001\200\377\177\000\000\377\177w\025\377\177\000\000\377"
+ "\177\001\200\377\177\000\000pB\001\200\220\275\000\000\377\177\220\275\220"
+ "\275\000\000\377\177\001\200\001\200\000\000\000\000\001\200\000\000\000"
+ "\000\377\177\000\000\000\000\000\000\220\275\001\200pB\000\000\377\177pB"
+ "pB\000\000\001\200\001\200\377\177\000\000\335\277\335\277\377\177\000\000"
+ "\377\177\377\177\377\177\000\000\377\177\377\177\377\177\000\000\000\000"
+ "\000\000\377\177\000\000#@#@\377\177\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\000\000@\000$\334\253"
+ "U\253U\253U\253U\253U\253U\253U\253U\253U\253U\177\177\177\177\177\177\000"
+ "\000\001\000\002\000\001\000\000\000\003\000\001\000\003\000\004\000\005"
+ "\000\006\000\007\000\010\000\011\000\012\000\011\000\010\000\013\000\014"
+ "\000\015\000\013\000\015\000\014\000\016\000\015\000\016\000\017\000\020"
+ "\000\013\000\010\000\013\000\021\000\011\000\014\000\013\000\020\000\022"
+ "\000\023\000\024\000\025\000\022\000\024\000\022\000\025\000\026\000\027"
+ "\000\023\000\022\000\030\000\027\000\022\000\027\000\030\000\031\000\031"
+ "\000\030\000\032\000\030\000\022\000\033\000\000\000\002\000\034\000\033"
+ "\000\022\000\026\000\004\000\007\000\001\000\007\000\004\000\005\000\035"
+ "\000\036\000\027\000\015\000\021\000\013\000\037\000 \000!\000 \000\037\000"
+ "\042\000 \000\042\000#\000#\000\042\000$\000#\000$\000%\000%\000$\000&\000"
+ "%\000&\000'\000'\000(\000%\000\006\000\002\000\001\000)\000*\000+\000\000"
+ "\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003"
+ "\000\003\000\004\000\001\000\004\000\005\000\006\000\006\000\007\000\005"
+ "\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000\010\000\013"
+ "\000\011\000\013\000\003\000\015\000\013\000\015\000\003\000\013\000\000"
+ "\000\015\000\000\000\017\000\015\000\017\000\004\000\013\000\004\000\010"
+ "\000\013\000\021\000\011\000\021\000\004\000\022\000\010\000\022\000\012"
+ "\000\022\000\012\000\026\000\022\000\026\000\004\000\027\000\022\000\027"
+ "\000\027\000\030\000\022\000\030\000\005\000\030\000\005\000\027\000\006"
+ "\000\030\000\022\000\033\000\030\000\033\000\002\000\017\000\026\000\033"
+ "\000\004\000\007\000\001\000\007\000\004\000\005\000\015\000\021\000\011"
+ "\000\026\000\021\000\026\000\021\000\033\000\015\000\033\000\015\000\030"
+ "\000\017\000\030\000\002\000\030\000\002\000\006\000\001\000\006\000\243"
+ "\247\270=gY\000\000\001\200gYgY\000\000\001\200\3265gY\000\000G\351\337\017"
+ "gY\000\000\001\200\011\277gY\000\000\001\200\231\246gY\000\000\001\200\356"
+ "\341gY\000\000m\327W\034gY\000\000\3202\231\246gY\000\000\000\035\277\353"
+ "gY\000\000>\017\231\246gY\000\000\3202\202\334gY\000\000\277\350\231\246"
+ "gY\000\000\352\371@\004gY\000\000V\273\231\246gY\000\000\260\012\211\370"
+ "gY\000\000\3202\231\246\367@\000\000*D\231\246\235/\000\000\003]\231\246"
+ "\367@\000\000\001\200\011\277\367@\000\000\001\200\231\246gY\000\000\001"
+ "\200\011\277gY\000\000\001\200\231\246gY\000\000\001\200\231\246\367@\000"
+ "\000q\230\231\246\367@\000\000\015\321\231\2465\337\000\000q\230\231\246"
+ "\252\267\000\000\240\345\231\246\310\363\000\000\001\200\356\341gY\000\000"
+ "\001\200\367@\367@\000\000\001\200W\017gY\000\000\001\200\3265gY\000\000"
+ "\001\200gYgY\000\000q\230\231\246gY\000\000\001\200\000\000\000\000\000\000"
+ "\001\200\011\277\011\277\000\000\001\200\231\246\367@\000\000\001\200\231"
+ "\246\231\246\000\000\377\177\231\246gY\000\000\340|\231\246gY\000\000\320"
+ "2\231\246gY\000\000\340|\231\246gY\000\000aV\231\246gY\000\000q\230\231\246"
+ "gY\000\000\252O[\310gY\000\000\233{\252\251gY\000\000\001\200W\017gY\000"
+ "\000\221\302\351*gY\000\000\001\200\231\246\231\246\000\000q\230\231\246"
+ "gY\000\000\277\350\231\246gY\000\000V\273\231\246gY\000\000\3202\231\246"
+ "~#\000\000G\351\231\246!\360\000\000\377\177\231\246gY\000\000\001\200\011"
+ "\277\011\277\000\000q\230\231\246\252\267\000\000\001\200\231\246\231\246"
+ "\000\000\015\321\231\2465\337\000\000\001\200\000\000\000\000\000\000G\351"
+ "\231\246!\360\000\000\3202\231\246~#\000\000\001\200\367@\367@\000\000*D"
+ "\231\246\235/\000\000\003]\231\246\367@\000\000\001\200gYgY\000\000\233{"
+ "\252\251gY\000\000\377\177\231\246gY\000\000\233{\252\251gY\000\000\221\302"
+ "\351*gY\000\000m\327W\034gY\000\000G\351\337\017gY\000\000\352\371@\004g"
+ "Y\000\000\260\012\211\370gY\000\000\000\035\277\353gY\000\000\3202\202\334"
+ "gY\000\000\252O[\310gY\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\201\000\201\000\201\201\000\201\000\201\000\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\201\000\201\000\201\000\201\000\201"
+ "\000\000\201\201\000\201\000\201\000\201\000\000\201\000\201\000\201\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\201\177\177\177"
+ "\177\177\177\000\201\000\201\000\000P^P^P^P^P^P^P^P^P^P^P^P^P^\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\000\000\000"
+ "\000\001\000\002\000\003\000\004\000\005\000\004\000\003\000\006\000\006"
+ "\000\003\000\007\000\010\000\011\000\012\000\011\000\010\000\013\000\014"
+ "\000\015\000\016\000\015\000\014\000\017\000\020\000\021\000\022\000\023"
+ "\000\024\000\025\000\026\000\027\000\030\000\031\000\030\000\032\000\030"
+ "\000\031\000\033\000\034\000\023\000\025\000\023\000\034\000\035\000\035"
+ "\000\034\000\036\000\035\000\036\000\037\000\035\000\037\000 \000\026\000"
+ "\030\000!\000\042\000#\000\023\000\023\000$\000\024\000\023\000%\000$\000"
+ "%\000\023\000#\000\035\000\042\000\023\000\030\000\033\000\020\000&\000\020"
+ "\000\022\000\020\000&\000'\000'\000(\000\020\000\010\000)\000*\000+\000\003"
+ "\000\005\000\003\000+\000\016\000\003\000\016\000\015\000\012\000\017\000"
+ "\014\000\017\000\012\000\011\000*\000\013\000\010\000\013\000*\000,\000*"
+ "\000-\000,\000-\000*\000)\000\007\000.\000\006\000.\000\007\000/\000/\000"
+ "\002\000.\000\002\000/\000\000\000\032\000\027\0000\000\027\000\032\000\030"
+ "\000(\000\030\000\020\000\030\000(\000!\000+\000\010\000\012\000+\000\012"
+ "\000\014\0001\0002\0003\000\020\0004\000\021\0004\000\033\0005\000\033\000"
+ "4\000\020\000\033\000\031\0005\0006\000-\000)\0007\0008\0009\0008\0007\000"
+ ":\000:\0007\000;\000:\000;\000<\000<\000;\000=\000=\000;\000>\000=\000>\000"
+ "\077\000\077\000>\000@\000@\000>\000A\000@\000A\000B\000@\000B\000C\000-"
+ "\000\001\000\000\000-\000\000\000/\000D\000E\000F\000D\000F\000G\000-\000"
+ "\003\000\015\000D\000H\000I\000D\000I\000J\000-\000\011\000\013\000D\000"
+ "K\000L\000\000\000\001\000\001\000\002\000\000\000\002\000\003\000\004\000"
+ "\004\000\005\000\003\000\005\000\003\000\006\000\004\000\006\000\003\000"
+ "\007\000\006\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000"
+ "\010\000\013\000\011\000\013\000\014\000\015\000\015\000\016\000\014\000"
+ "\016\000\014\000\017\000\015\000\017\000\020\000\021\000\021\000\022\000"
+ "\020\000\022\000\005\000\023\000\004\000\023\000\005\000\027\000\027\000"
+ "\030\000\005\000\030\000\030\000\031\000\030\000\032\000\031\000\032\000"
+ "\031\000\033\000\030\000\033\000\006\000\023\000\006\000\035\000\023\000"
+ "\035\000\006\000\036\000\035\000\036\000\002\000\036\000\002\000\035\000"
+ "\001\000\035\000\030\000!\000\005\000!\000\042\000#\000\023\000#\000\023"
+ "\000\042\000\023\000\027\000\023\000%\000\027\000%\000#\000%\000\035\000"
+ "\042\000\020\000\033\000\020\000\030\000\020\000&\000\022\000&\000&\000'"
+ "\000\020\000'\000\010\000'\000\010\000\020\000'\000*\000\010\000*\000\003"
+ "\000!\000\016\000!\000\003\000\016\000\003\000\015\000\012\000\017\000\012"
+ "\000\014\000\011\000\017\000\013\000*\000*\000,\000\013\000,\000*\000-\000"
+ ",\000-\000'\000-\000\007\000\036\000\007\000/\000\036\000/\000\002\000/\000"
+ "\000\000/\000\027\000\032\000\032\000%\000\010\000\030\000\010\000!\000\012"
+ "\000!\000\014\000!\000\020\0004\000\021\0004\000\033\0004\000\033\0005\000"
+ "4\0005\000\031\0005\000&\000-\000\032\000#\000\031\000#\000\031\000\042\000"
+ "\042\0005\000\042\0004\000\035\0004\000\021\000\035\000\022\000\035\000\001"
+ "\000\022\000\001\000-\000\022\000-\000\000\000-\000-\000/\000\007\000-\000"
+ "\003\000-\000\015\000-\000\017\000-\000\011\000-\000\013\000-\000\365\021"
+ "\377#\010\022\000\000\377\177\013\200\367\177\000\000\010\022\013\356\002"
+ "\334\000\000\001\200\365\177\011\200\000\000\377\177\013\200\367\177\000"
+ "\000\003\334\367\355\367\021\000\000\010\022\013\356\002\334\000\000\377"
+ "\177\013\200\367\177\000\000\365\021\377#\010\022\000\000\003\334\367\355"
+ "\367\021\000\000\001\200\365\177\011\200\000\000\001\200\365\177\011\200"
+ "\000\000_@c9_@\134F\307\235\301\241\301\241\344\034\340 \340 \335#\272\244"
+ "\000\000\001\000\002\000\000\000\002\000\003\000\004\000\005\000\006\000"
+ "\007\000\010\000\011\000\011\000\010\000\012\000\005\000\013\000\006\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\002\000\003\000\000\000"
+ "\003\000\001\000\005\000\002\000\005\000\000\000\005\000\003\000\005\000"
+ "\377\177\323\371\377\177\000\000\001\200\323\371\001\200\000\000\377\177"
+ "\323\371\001\200\000\000\377\177-\006\244s\000\000\377\177\323\371\377\177"
+ "\000\000\377\177\323\371\001\200\000\000\377\177\323\371\001\200\000\000"
+ "\001\200\323\371\001\200\000\000\134\214-\006\001\200\000\000\377\177\323"
+ "\371\377\177\000\000\134\214-\006\001\200\000\000\001\200\323\371\001\200"
+ "\000\000\377\177-\006\244s\000\000\377\177-\006\244s\000\000\377\177\323"
+ "\371\001\200\000\000\134\214-\006\001\200\000\000\000\201\000\201\000\201"
+ "\177\000\177\000\177\000\177\177\177\177\177\177\326*\326*\326*\326*\014"
+ "y\014y\014y\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000"
+ "\010\000\011\000\012\000\013\000\012\000\011\000\014\000\015\000\016\000"
+ "\017\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000"
+ "\002\000\003\000\001\000\010\000\002\000\010\000\000\000\010\000\003\000"
+ "\010\000\001\200\323\371\377\177\000\000\001\200\323\371\001\200\000\000"
+ "\377\177\323\371\001\200\000\000\377\177\323\371\001\200\000\000\001\200"
+ "\323\371\001\200\000\000\244s-\006\001\200\000\000\001\200-\006\244s\000"
+ "\000\001\200\323\371\001\200\000\000\001\200\323\371\377\177\000\000\001"
+ "\200-\006\244s\000\000\244s-\006\001\200\000\000\001\200\323\371\001\200"
+ "\000\000\244s-\006\001\200\000\000\001\200\323\371\377\177\000\000\377\177"
+ "\323\371\001\200\000\000\001\200-\006\244s\000\000\000\201\000\201\000\201"
+ "\177\177\177\177\177\177\201\000\201\000\201\000\364y\364y\364y********\000"
+ "\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010\000\011"
+ "\000\012\000\013\000\014\000\015\000\016\000\015\000\014\000\017\000\000"
+ "\000\001\000\001\000\002\000\000\000\002\000\001\000\005\000\002\000\005"
+ "\000\001\000\006\000\000\000\006\000\005\000\006\000\000\000\005\000\377"
+ "\177\001\200\000\000\000\000\201n\001\200\177\221\000\000\377\177\001\200"
+ "\177\221\000\000\201n\001\200\000\000\000\000\177\221\377\177\177\221\000"
+ "\000\177\221\377\177\001\200\000\000\001\200\377\177\001\200\000\000\000"
+ "\000\001\200\177\221\000\000\212\346\001\200\001\200\000\000\000\000\001"
+ "\200\001\200\000\000\373\312\001\200\001\200\000\000z\252\001\200\001\200"
+ "\000\000\177\221\001\200\001\200\000\000\177\221\001\200\177\221\000\000"
+ "$)!2\377\177\000\000\206U\377\177\377\177\000\000\010$\3545\377\177\000\000"
+ "\333-\333-\377\177\000\000\377\177\377\177\377\177\000\000\206U\377\177\377"
+ "\177\000\000\377\177\377\177\377\177\000\000\201n\377\177\377\177\000\000"
+ "\377\177\377\177\177\221\000\000\377\177\201n\000\000\000\000\377\177\201"
+ "n\177\221\000\000\377\177\377\177\000\000\000\000\201n\001\200\377\177\000"
+ "\000\000\000\001\200\201n\000\000\201n\001\200\201n\000\000\000\000\001\200"
+ "\377\177\000\000\000\000\001\200\377\177\000\000\206U\001\200\377\177\000"
+ "\000\0055\001\200\377\177\000\000\000\000\001\200\377\177\000\000v\031\001"
+ "\200\377\177\000\000\177\221\001\200\201n\000\000\001\200\001\200\000\000"
+ "\000\000\177\221\001\200\000\000\000\000\001\200\001\200\201n\000\000\001"
+ "\200\177\221\201n\000\000\001\200\001\200\201n\000\000\001\200\001\200\377"
+ "\177\000\000%\322%\322\001\200\000\000\177\221\001\200\001\200\000\000\001"
+ "\200\001\200\001\200\000\000z\252\001\200\001\200\000\000\334\326\337\315"
+ "\001\200\000\000\370\333\024\312\001\200\000\000@7\001\200@7\000\000,YV\225"
+ "\000\000\000\000\201n\001\200\000\000\000\000\226,V\225\226,\000\000@7\001"
+ "\200\300\310\000\000\000\000V\225\324\246\000\000\000\000\001\200\177\221"
+ "\000\000\226,V\225j\323\000\000j\323V\225\226,\000\000\000\000\001\200\201"
+ "n\000\000\300\310\001\200@7\000\000\000\000V\225,Y\000\000j\323V\225j\323"
+ "\000\000\177\221\001\200\000\000\000\000\300\310\001\200\300\310\000\000"
+ "\324\246V\225\000\000\000\000\300\310\001\200@7\000\000\001\200\001\200\177"
+ "\221\000\000\001\200\001\200\001\200\000\000\377\177\001\200\001\200\000"
+ "\000\300\310\001\200\300\310\000\000\206U\001\200\001\200\000\000\201n\001"
+ "\200\001\200\000\000\0055\001\200\001\200\000\000v\031\001\200\001\200\000"
+ "\000@7\001\200\300\310\000\000\377\177\001\200\377\177\000\000@7\001\200"
+ "@7\000\000\377\177\001\200\201n\000\000\177\221\001\200\377\177\000\000\177"
+ "\221\001\200\377\177\000\000\212\346\001\200\377\177\000\000\373\312\001"
+ "\200\377\177\000\000\177\221\001\200\377\177\000\000\373\312\001\200\377"
+ "\177\000\000z\252\001\200\377\177\000\000\001\200\001\200\377\177\000\000"
+ "\000\000\377\177\001\200\000\000Y\363\233\077\001\200\000\000\212\346\377"
+ "\177\001\200\000\000\245\371\212@\001\200\000\000\000\000\332@\001\200\000"
+ "\000v\031\377\177\001\200\000\000[\006\212@\001\200\000\000\247\014\233\077"
+ "\001\200\000\000$)\337\315\001\200\000\000\206U\001\200\001\200\000\000\010"
+ "$\024\312\001\200\000\000\333-%\322\001\200\000\000\377\177\001\200\001\200"
+ "\000\000\206U\001\200\001\200\000\000\377\177\001\200\001\200\000\000\222"
+ "\036\316\306\001\200\000\000\0055\001\200\001\200\000\000\321\030\026\304"
+ "\001\200\000\000Y\363e\300\001\200\000\000\000\000\001\200\001\200\000\000"
+ "\212\346\001\200\001\200\000\000\245\371v\277\001\200\000\000\000\000&\277"
+ "\001\200\000\000/\347\026\304\001\200\000\000\373\312\001\200\001\200\000"
+ "\000-\355\361\301\001\200\000\000\024\312\370\333\001\200\000\000\001\200"
+ "\177\221\001\200\000\000\001\200z\252\001\200\000\000\337\315\334\326\001"
+ "\200\000\000n\341\316\306\001\200\000\000&\277\000\000\001\200\000\000\001"
+ "\200\212\346\001\200\000\000\001\200\000\000\001\200\000\000v\277\245\371"
+ "\001\200\000\000e\300Y\363\001\200\000\000e\300\247\014\001\200\000\000\001"
+ "\200v\031\001\200\000\000v\277[\006\001\200\000\000[\006v\277\001\200\000"
+ "\000v\031\001\200\001\200\000\000\247\014e\300\001\200\000\000\206U\377\177"
+ "\001\200\000\000$)!2\001\200\000\000\010$\3545\001\200\000\000\333-\333-"
+ "\001\200\000\000\377\177\377\177\001\200\000\000\377\177\377\177\001\200"
+ "\000\000\206U\377\177\001\200\000\000\201n\377\177\001\200\000\000!2$)\001"
+ "\200\000\000\3545\010$\001\200\000\000\377\177\206U\001\200\000\000\377\177"
+ "\206U\001\200\000\000\377\177\201n\001\200\000\000\323\022\361\301\001\200"
+ "\000\000\0055\377\177\001\200\000\000\222\03629\001\200\000\000\321\030\352"
+ ";\001\200\000\000%\322\333-\001\200\000\000\001\200\201n\001\200\000\000"
+ "\001\200\377\177\001\200\000\000\001\200\206U\001\200\000\000\337\315$)\001"
+ "\200\000\000\024\312\010$\001\200\000\000\177\221\377\177\001\200\000\000"
+ "z\252\377\177\001\200\000\000\334\326!2\001\200\000\000\370\333\3545\001"
+ "\200\000\000\026\304/\347\001\200\000\000\001\200\373\312\001\200\000\000"
+ "\316\306n\341\001\200\000\000\323\022\017>\001\200\000\000\001\200\0055\001"
+ "\200\000\000\316\306\222\036\001\200\000\000\026\304\321\030\001\200\000"
+ "\000\377\177\0055\001\200\000\000\017>\323\022\001\200\000\000\352;\321\030"
+ "\001\200\000\000\233\077\247\014\001\200\000\000\377\177v\031\001\200\000"
+ "\000\212@[\006\001\200\000\000\332@\000\000\001\200\000\000\377\177\000\000"
+ "\001\200\000\00029\222\036\001\200\000\000\361\301-\355\001\200\000\000!"
+ "2\334\326\001\200\000\000\3545\370\333\001\200\000\000\377\177z\252\001\200"
+ "\000\000\377\177z\252\001\200\000\000\377\177\177\221\001\200\000\000\361"
+ "\301\323\022\001\200\000\000n\34129\001\200\000\000/\347\352;\001\200\000"
+ "\000-\355\017>\001\200\000\00029n\341\001\200\000\000\352;/\347\001\200\000"
+ "\000\017>-\355\001\200\000\000\233\077Y\363\001\200\000\000\212@\245\371"
+ "\001\200\000\000\377\177\373\312\001\200\000\000\377\177\212\346\001\200"
+ "\000\000\373\312\377\177\001\200\000\000!2$)\377\177\000\000\3545\010$\377"
+ "\177\000\000\377\177\206U\377\177\000\000\377\177\206U\377\177\000\000\377"
+ "\177\201n\377\177\000\000\212@[\006\377\177\000\000\377\177v\031\377\177"
+ "\000\000\233\077\247\014\377\177\000\000\332@\000\000\377\177\000\000\377"
+ "\177\000\000\377\177\000\000\377\177\212\346\377\177\000\000\212@\245\371"
+ "\377\177\000\000\233\077Y\363\377\177\000\000[\006\212@\377\177\000\000\000"
+ "\000\377\177\377\177\000\000\000\000\332@\377\177\000\000v\031\377\177\377"
+ "\177\000\000\247\014\233\077\377\177\000\000\323\022\017>\377\177\000\000"
+ "\321\030\352;\377\177\000\000\0055\377\177\377\177\000\000\024\312\010$\377"
+ "\177\000\000\001\200\201n\377\177\000\000\001\200\206U\377\177\000\000\001"
+ "\200\377\177\377\177\000\000\337\315$)\377\177\000\000%\322\333-\377\177"
+ "\000\000Y\363\233\077\377\177\000\000\212\346\377\177\377\177\000\000\245"
+ "\371\212@\377\177\000\000\377\177\001\200\377\177\000\000!2\334\326\377\177"
+ "\000\000\333-%\322\377\177\000\000\3545\370\333\377\177\000\000\377\177z"
+ "\252\377\177\000\000\377\177z\252\377\177\000\000\377\177\001\200\377\177"
+ "\000\000\377\177\177\221\377\177\000\00029n\341\377\177\000\000\352;/\347"
+ "\377\177\000\000\377\177\373\312\377\177\000\000\017>\323\022\377\177\000"
+ "\000\377\177\0055\377\177\000\000\352;\321\030\377\177\000\000\000\000&\277"
+ "\377\177\000\000[\006v\277\377\177\000\000\247\014e\300\377\177\000\000\323"
+ "\022\361\301\377\177\000\000\321\030\026\304\377\177\000\000\177\221\377"
+ "\177\377\177\000\000z\252\377\177\377\177\000\000\334\326!2\377\177\000\000"
+ "\370\333\3545\377\177\000\000\024\312\370\333\377\177\000\000\001\200\373"
+ "\312\377\177\000\000\001\200z\252\377\177\000\000\316\306n\341\377\177\000"
+ "\000\026\304/\347\377\177\000\000\222\036\316\306\377\177\000\000\010$\024"
+ "\312\377\177\000\000\001\200\212\346\377\177\000\000\361\301-\355\377\177"
+ "\000\000e\300Y\363\377\177\000\000\373\312\377\177\377\177\000\000n\3412"
+ "9\377\177\000\000/\347\352;\377\177\000\000-\355\017>\377\177\000\000Y\363"
+ "e\300\377\177\000\000\245\371v\277\377\177\000\000%\322%\322\377\177\000"
+ "\000\001\200\001\200\377\177\000\000z\252\001\200\377\177\000\000\334\326"
+ "\337\315\377\177\000\000\370\333\024\312\377\177\000\000n\341\316\306\377"
+ "\177\000\000/\347\026\304\377\177\000\000-\355\361\301\377\177\000\000\222"
+ "\03629\377\177\000\000\017>-\355\377\177\000\000$)\337\315\377\177\000\000"
+ "&\277\000\000\377\177\000\000\001\200v\031\377\177\000\000\001\200\000\000"
+ "\377\177\000\000v\277[\006\377\177\000\000e\300\247\014\377\177\000\000\001"
+ "\200\0055\377\177\000\000\361\301\323\022\377\177\000\000\026\304\321\030"
+ "\377\177\000\00029\222\036\377\177\000\000\001\200\177\221\377\177\000\000"
+ "\337\315\334\326\377\177\000\000v\277\245\371\377\177\000\000\316\306\222"
+ "\036\377\177\000\000\001\200\377\177\201n\000\000\177\221\377\177\000\000"
+ "\000\000\001\200\377\177\000\000\000\000\177\221\377\177\201n\000\000\001"
+ "\200\377\177\177\221\000\000\201n\377\177\177\221\000\000\377\177\377\177"
+ "\001\200\000\000\201n\377\177\000\000\000\000\377\177\377\177\177\221\000"
+ "\000\377\177\377\177\000\000\000\000\201n\377\177\201n\000\000\377\177\377"
+ "\177\201n\000\000\377\177\377\177\377\177\000\000\000\000\377\177\177\221"
+ "\000\000v\031\377\177\001\200\000\000\000\000\377\177\001\200\000\000\005"
+ "5\377\177\001\200\000\000\206U\377\177\001\200\000\000z\252\377\177\001\200"
+ "\000\000\373\312\377\177\001\200\000\000\212\346\377\177\001\200\000\000"
+ "\001\200\377\177\377\177\000\000@7\377\177\300\310\000\000\177\221\377\177"
+ "\377\177\000\000\000\000\377\177\201n\000\000z\252\377\177\377\177\000\000"
+ "\000\000\377\177\377\177\000\000\000\000\377\177\377\177\000\000z\252\377"
+ "\177\377\177\000\000\206U\377\177\377\177\000\000\300\310\377\177@7\000\000"
+ "\000\000\377\177\000\000\000\000\300\310\377\177\300\310\000\000@7\377\177"
+ "@7\000\000\000\000V\225\324\246\000\000\000\000\001\200\177\221\000\000\000"
+ "\000V\225,Y\000\000\000\000\001\200\201n\000\000\201n\001\200\000\000\000"
+ "\000,YV\225\000\000\000\000\377\177\201n\201n\000\000\377\177\377\177\201"
+ "n\000\000\377\177\000\000\201n\000\000\377\177\177\221\201n\000\000\377\177"
+ "z\252\377\177\000\000\377\177\373\312\377\177\000\000\377\177\212\346\377"
+ "\177\000\000\377\177\000\000\377\177\000\000\377\177\001\200\377\177\000"
+ "\000\377\177\377\177\001\200\000\000\377\177\177\221\177\221\000\000\377"
+ "\177\001\200\177\221\000\000\377\177\001\200\001\200\000\000\377\177\001"
+ "\200\000\000\000\000\377\177\177\221\000\000\000\000\377\177\377\177\377"
+ "\177\000\000\377\177\001\200\201n\000\000\377\177v\031\377\177\000\000\377"
+ "\177\0055\377\177\000\000\377\177\206U\377\177\000\000\377\177z\252\001\200"
+ "\000\000\377\177\000\000\177\221\000\000\377\177\373\312\001\200\000\000"
+ "\377\177\212\346\001\200\000\000\377\177\000\000\001\200\000\000\377\177"
+ "v\031\001\200\000\000\377\177\0055\001\200\000\000\377\177\206U\001\200\000"
+ "\000\001\200z\252\377\177\000\000\001\200\177\221\377\177\000\000\001\200"
+ "\000\000\201n\000\000\001\200\373\312\377\177\000\000\001\200\212\346\377"
+ "\177\000\000\001\200\000\000\377\177\000\000\001\200\177\221\177\221\000"
+ "\000\001\200z\252\001\200\000\000\001\200\177\221\001\200\000\000\001\200"
+ "\000\000\177\221\000\000\001\200\373\312\001\200\000\000\001\200\212\346"
+ "\001\200\000\000\001\200\000\000\001\200\000\000\001\200\001\200\001\200"
+ "\000\000\001\200\377\177\377\177\000\000\001\200\201n\201n\000\000\001\200"
+ "\201n\377\177\000\000\001\200\377\177\201n\000\000\001\200\201n\000\000\000"
+ "\000\001\200\377\177\000\000\000\000\001\200v\031\377\177\000\000\001\200"
+ "\0055\377\177\000\000\001\200\206U\377\177\000\000\001\200\001\200\000\000"
+ "\000\000\001\200\177\221\000\000\000\000\001\200\201n\177\221\000\000\001"
+ "\200\377\177\177\221\000\000\001\200\001\200\177\221\000\000\001\200v\031"
+ "\001\200\000\000\001\200\0055\001\200\000\000\001\200\206U\001\200\000\000"
+ "\001\200\201n\001\200\000\000\001\200\377\177\001\200\000\000\324\246V\225"
+ "\000\000\000\000\177\221\001\200\000\000\000\000\000\201\000\201\000\201"
+ "\000\201\000\177\000\177\000\177\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\000\000\000\000\000\000\000\000\000\000*  \000\177\177"
+ "\000\177\000\177\000\177\000\000\201\000\201\000\201\000\201\000\326\000"
+ "\000\000\000\000\000\000\000\000\201\000\201\000\201\000\201\201\000\201"
+ "\000\201\000\177\177\177\177\177\177\177\177\177\177\177\177\253\253\253"
+ "\253\253\253\253\253\326\326\326\326\326\326\326\326U\253U\253U\253U\253"
+ "*\326*\326*\326*\326\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\000\000"
+ "\000\000\000\177\177\177\177\177\177\000\201\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177U\201_\241\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177__U\177\000\177\177\177"
+ "\177\177\177\177\177U\177\000\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177I\177\000\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\000\000\000\000\000\000"
+ "*\000\177\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000*\000 \340\177\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\0000\000*\000"
+ "\177\000\177\000\177\000\177\000\177*\326*\326\253\253\253\253\326\326\326"
+ "\326\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000U\253U\253\000"
+ "\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006\000\007"
+ "\000\010\000\011\000\010\000\007\000\012\000\012\000\007\000\013\000\013"
+ "\000\007\000\014\000\014\000\007\000\015\000\016\000\017\000\020\000\017"
+ "\000\016\000\021\000\017\000\021\000\022\000\023\000\024\000\025\000\026"
+ "\000\027\000\030\000\027\000\026\000\031\000\032\000\033\000\034\000\033"
+ "\000\032\000\035\000\036\000\032\000\037\000\036\000\037\000 \000!\000 \000"
+ "\042\000#\000$\000%\000$\000#\000&\000'\000(\000)\000*\000+\000,\000+\000"
+ "*\000-\000-\000*\000.\000-\000.\000/\0000\0001\0002\0001\0000\0003\0004\000"
+ "5\0006\0005\0004\0007\0008\0009\000:\0009\0008\000;\000<\000=\000>\000=\000"
+ "<\000\077\000#\000@\000\033\000\015\000A\000B\000\001\000C\000\002\000%\000"
+ "\015\000D\000\015\000$\000A\000$\000\015\000%\000\001\000E\000F\000E\000"
+ "\001\000G\000G\000\001\000H\000H\000\001\000\011\000\011\000\001\000\007"
+ "\000\003\000I\000\001\000\032\000\034\000J\000\033\000K\000\034\000L\000"
+ "\003\000\000\000\003\000L\000\034\000\035\000#\000\033\000#\000\035\000M"
+ "\000N\000!\000O\000N\000O\000P\000Q\000R\000S\000T\000#\000M\000U\000V\000"
+ "W\000V\000U\000X\000X\000U\000Y\000Z\000Y\000U\000Y\000Z\000[\000[\000Z\000"
+ "\134\000]\000^\000_\000^\000]\000`\000^\000`\000a\000b\000c\000F\000d\000"
+ "e\000f\000e\000d\000_\000e\000_\000^\000g\000h\000i\000h\000g\000j\000h\000"
+ "j\000k\000l\000i\000m\000i\000l\000n\000i\000n\000g\000o\000p\000q\000p\000"
+ "o\000,\000,\000o\000r\000,\000r\000*\000/\000m\000-\000m\000/\000s\000m\000"
+ "s\000l\000t\000u\000v\000u\000t\000w\000u\000w\000x\000y\000v\000z\000v\000"
+ "y\000{\000v\000{\000t\000|\000h\000k\000h\000|\000}\000}\000|\000~\000\177"
+ "\000\200\000\201\000\200\000\177\000\202\000\202\000\177\000\203\000\204"
+ "\000\205\000\206\000\203\000\207\000\202\000\207\000\203\000\210\000\210"
+ "\000\203\000\211\000\212\000\204\000\213\000\214\000}\000~\000}\000\214\000"
+ "f\000}\000f\000e\000\215\000\216\000\217\000\216\000\215\000\201\000\201"
+ "\000\215\000\177\000\220\000\221\000\222\000\221\000\220\000\223\000\223"
+ "\000\220\000\224\000\223\000\224\000\225\000\226\000\220\000\222\000\220"
+ "\000\226\000\227\000\220\000\227\000\230\000\230\000\227\000\231\000\232"
+ "\000q\000\233\000q\000\232\000\234\000q\000\234\000o\000Z\000\235\000\134"
+ "\000\235\000Z\000\217\000\217\000Z\000\215\000\225\000\236\000\223\000\236"
+ "\000\225\000\237\000\236\000\237\000\240\000\241\000\242\000\243\000\242"
+ "\000\241\000\244\000\244\000\241\000\245\000\245\000\246\000\244\000\246"
+ "\000\245\000\247\000\247\000\245\000\250\000\211\000\251\000\210\000\251"
+ "\000\211\000\243\000\243\000\211\000\241\000x\000\233\000u\000\233\000x\000"
+ "\252\000\233\000\252\000\232\000\253\000a\000`\000a\000\253\000\254\000a"
+ "\000\254\000\255\000c\000\256\000\257\000\240\000z\000\236\000z\000\240\000"
+ "\260\000z\000\260\000y\000{\000w\000t\000w\000{\000y\000w\000y\000x\000x"
+ "\000y\000\260\000x\000\260\000\252\000\252\000\260\000\240\000\252\000\240"
+ "\000\232\000\232\000\240\000\237\000\232\000\237\000\234\000\234\000\237"
+ "\000\225\000\234\000\225\000o\000o\000\225\000\224\000o\000\224\000r\000"
+ "r\000\224\000\220\000r\000\220\000*\000*\000\220\000\230\000*\000\230\000"
+ ".\000.\000\230\000\231\000.\000\231\000/\000/\000\231\000\261\000/\000\261"
+ "\000s\000s\000\261\000\262\000s\000\262\000l\000l\000\262\000\263\000l\000"
+ "\263\000n\000n\000\263\000V\000n\000V\000g\000g\000V\000X\000g\000X\000j"
+ "\000j\000X\000Y\000j\000Y\000k\000k\000Y\000[\000k\000[\000|\000|\000[\000"
+ "\134\000|\000\134\000~\000~\000\134\000\235\000~\000\235\000\214\000\214"
+ "\000\235\000\217\000\214\000\217\000f\000f\000\217\000\216\000f\000\216\000"
+ "d\000d\000\216\000\201\000d\000\201\000_\000_\000\201\000\200\000_\000\200"
+ "\000]\000]\000\200\000\202\000]\000\202\000`\000`\000\202\000\207\000`\000"
+ "\207\000\253\000\253\000\207\000\210\000\253\000\210\000\254\000\254\000"
+ "\210\000\251\000\254\000\251\000\264\000\264\000\251\000\243\000\264\000"
+ "\243\000\265\000\265\000\243\000\242\000\265\000\242\000\266\000\266\000"
+ "\242\000\244\000\266\000\244\000\267\000\267\000\244\000\246\000\267\000"
+ "\246\000\270\000\270\000\246\000\247\000\264\000\255\000\254\000\255\000"
+ "\264\000\265\000\255\000\265\000\271\000\266\000\271\000\265\000\271\000"
+ "\266\000\267\000\271\000\267\000\272\000\270\000\272\000\267\000\272\000"
+ "\270\000\247\000\272\000\247\000\250\000\273\000\231\000\227\000\231\000"
+ "\273\000\261\000\261\000\273\000\262\000W\000\262\000\273\000\262\000W\000"
+ "\263\000\263\000W\000V\000\274\000\022\000\021\000\022\000\274\000\275\000"
+ "\022\000\275\000\276\000\024\000\277\000\300\000\301\000\302\000\303\000"
+ "\302\000\301\000\304\000\302\000\304\000\305\000\306\000\307\000\310\000"
+ "\307\000\306\000\304\000\304\000\306\000\305\000\311\000\312\000\313\000"
+ "\312\000\311\000\314\000\314\000\311\000\315\000\316\000\314\000\315\000"
+ "\314\000\316\000\317\000\314\000\317\000\320\000\321\000\322\000\323\000"
+ "\322\000\321\000\324\000\324\000\321\000\325\000\324\000\325\000\326\000"
+ "\327\000\312\000\330\000\312\000\327\000\331\000\312\000\331\000\313\000"
+ "\332\000\333\000\334\000\333\000\332\000\335\000\335\000\332\000\336\000"
+ "\337\000\340\000\341\000\336\000\342\000\335\000\342\000\336\000\343\000"
+ "\343\000\336\000\344\000\345\000\346\000\347\000\346\000\345\000\303\000"
+ "\346\000\303\000\302\000\042\000\350\000!\000\350\000\042\000\351\000\351"
+ "\000\042\000\352\000\042\000\353\000\352\000\353\000\042\000\354\000\354"
+ "\000\042\000 \000\326\000\355\000\324\000\355\000\326\000\356\000\356\000"
+ "\326\000\357\000\356\000\357\000\360\000\361\000\362\000\363\000\362\000"
+ "\361\000\364\000\362\000\364\000\365\000 \000\366\000\354\000\366\000 \000"
+ "\367\000\367\000 \000\037\000\365\000\370\000\362\000\370\000\365\000\371"
+ "\000\370\000\371\000\372\000\360\000\373\000\356\000\373\000\360\000\374"
+ "\000\373\000\374\000\375\000\375\000\330\000\373\000\330\000\375\000\376"
+ "\000\330\000\376\000\327\000!\000\377\000O\000\377\000!\000\000\001\000\001"
+ "!\000\350\000N\000\001\001\002\001\001\001N\000\003\001\001\001\003\001\004"
+ "\001\004\001\003\001\005\001P\000\005\001\003\001\005\001P\000\006\001\006"
+ "\001P\000\007\001O\000\007\001P\000\007\001O\000\010\001\010\001O\000\377"
+ "\000\011\001\320\000\317\000\320\000\011\001\020\000\320\000\020\000\017"
+ "\000\344\000\012\001\343\000\012\001\344\000\310\000\310\000\344\000\306"
+ "\000\037\000\013\001\367\000\013\001\037\000\334\000\334\000\037\000\332"
+ "\000\340\000\037\000\032\000\014\001\015\001\016\001\015\001\014\001\017"
+ "\001\015\001\017\001\020\001\020\001\021\001\015\001\021\001\020\001\022"
+ "\001\021\001\022\001\023\001\024\001\276\000\275\000\276\000\024\001\347"
+ "\000\276\000\347\000\346\000\001\001\025\001\002\001\025\001\001\001\363"
+ "\000\363\000\001\001\026\001\363\000\026\001\361\000\372\000\016\001\370"
+ "\000\016\001\372\000\027\001\016\001\027\001\014\001\027\001\017\001\014"
+ "\001\017\001\027\001\372\000\017\001\372\000\020\001\020\001\372\000\371"
+ "\000\020\001\371\000\022\001\022\001\371\000\365\000\022\001\365\000\023"
+ "\001\023\001\365\000\364\000\023\001\364\000\030\001\030\001\364\000\361"
+ "\000\030\001\361\000\321\000\321\000\361\000\026\001\321\000\026\001\325"
+ "\000\325\000\026\001\001\001\325\000\001\001\326\000\326\000\001\001\004"
+ "\001\326\000\004\001\357\000\357\000\004\001\360\000\360\000\004\001\005"
+ "\001\360\000\005\001\006\001\360\000\006\001\374\000\374\000\006\001\375"
+ "\000\375\000\006\001\007\001\375\000\007\001\010\001\375\000\010\001\376"
+ "\000\376\000\010\001\377\000\376\000\377\000\327\000\327\000\377\000\000"
+ "\001\327\000\000\001\331\000\331\000\000\001\350\000\331\000\350\000\313"
+ "\000\313\000\350\000\351\000\313\000\351\000\311\000\311\000\351\000\352"
+ "\000\311\000\352\000\315\000\315\000\352\000\353\000\315\000\353\000\316"
+ "\000\316\000\353\000\354\000\316\000\354\000\317\000\317\000\354\000\366"
+ "\000\317\000\366\000\011\001\011\001\366\000\367\000\011\001\367\000\020"
+ "\000\020\000\367\000\016\000\016\000\367\000\013\001\016\000\013\001\334"
+ "\000\016\000\334\000\021\000\021\000\334\000\333\000\021\000\333\000\274"
+ "\000\274\000\333\000\335\000\274\000\335\000\275\000\275\000\335\000\342"
+ "\000\275\000\342\000\024\001\024\001\342\000\343\000\024\001\343\000\347"
+ "\000\347\000\343\000\012\001\347\000\012\001\345\000\345\000\012\001\310"
+ "\000\345\000\310\000\303\000\303\000\310\000\301\000\301\000\310\000\307"
+ "\000\301\000\307\000\304\000\023\001\323\000\021\001\323\000\023\001\030"
+ "\001\323\000\030\001\321\000\031\001\032\001\033\001\032\001\031\001\034"
+ "\001\033\001\004\000\035\001\004\000\033\001\032\001\036\001\037\001\206"
+ "\000 \001!\001\036\001!\001 \001\042\001#\001\042\001 \001\042\001#\001$"
+ "\001%\001$\001#\001&\001'\001(\001'\001&\001)\001)\001&\001*\001*\001&\001"
+ "\206\000\206\000&\001\036\001\004\000+\001\005\000+\001\004\000,\001,\001"
+ "\004\000-\001-\001\004\000(\001(\001\004\000&\001.\001\034\001\031\001 \001"
+ "\036\001/\0010\0011\001\034\0011\0010\0012\0012\0013\0011\0014\0015\001\373"
+ "\0004\001\373\000\330\0003\001#\0011\001#\0013\0016\001#\0016\001\025\000"
+ "\023\0004\001\314\000\023\000\314\000\320\000/\001\036\001&\0010\001\034"
+ "\001.\001\034\0017\001\032\001 \001/\0018\0019\001&\001\004\000#\001 \001"
+ ":\0018\001&\0019\001!\001\037\001\036\001#\001:\0011\0011\0017\001\034\001"
+ "\032\0019\001\004\0008\0019\001\032\0011\0018\0017\001\004\000\006\000\035"
+ "\001\025\000%\001#\0011\001:\0018\0018\001/\001&\001:\001 \0018\0017\001"
+ "8\001\032\001#\000%\000@\000I\000\007\000\001\000T\000&\000#\000\001\000"
+ "F\000C\000\015\000B\000\014\000\034\000K\000\003\000D\000\015\000\007\000"
+ "J\000\034\000L\000;\001>\000<\001>\000;\001<\000=\0010\000>\0010\000=\001"
+ "3\000\077\0017\0004\0007\000\077\001@\001\031\000A\001\027\000A\001\031\000"
+ "B\001C\001\341\000D\001\341\000C\001E\001E\001C\001F\001F\001C\001G\001G"
+ "\001C\001H\001\341\000I\001D\001\026\000\030\000J\001K\001L\001M\001K\001"
+ "N\001L\001N\001K\001O\001P\001A\001B\001O\001Q\001N\001Q\001O\001D\001A\001"
+ "H\001C\001H\001A\001R\001R\001A\001S\001S\001A\001T\001T\001A\001\300\000"
+ "K\001M\001\257\000U\001K\001\257\000K\001U\001V\001V\001U\001W\001V\001W"
+ "\001X\001V\001X\001Y\001J\001\030\000\213\000Z\001V\001Y\001V\001Z\001\030"
+ "\000\030\000Z\001[\001\030\000[\001\134\001\030\000\134\001\213\000V\001"
+ "O\001K\001P\001\300\000A\001O\001C\001D\001C\001O\001V\001C\001V\001\030"
+ "\000C\001\030\000A\001A\001\030\000\027\000D\001I\001Q\001]\001'\000^\001"
+ "'\000]\001_\001_\001]\001`\001_\001`\001a\001_\001a\001b\001'\000)\000^\001"
+ "c\001d\001e\001d\001c\001f\001d\001f\001g\001g\001f\001h\001h\001f\001i\001"
+ "c\001e\001j\001k\001l\001m\001n\001l\001k\001n\001o\001l\001o\001n\001p\001"
+ "q\001_\001b\001_\001q\001l\001l\001q\001r\001l\001r\001s\001l\001s\001m\001"
+ "'\000t\001(\000t\001'\000u\001p\001v\001o\001v\001p\001w\001u\001x\001t\001"
+ "x\001u\001c\001v\001i\001f\001i\001v\001y\001y\001v\001z\001z\001v\001{\001"
+ "{\001v\001|\001}\001v\001w\001}\001|\001v\001_\001u\001'\000u\001_\001c\001"
+ "c\001_\001f\001f\001_\001l\001f\001l\001v\001v\001l\001o\001c\001j\001x\001"
+ "~\001:\000\177\001:\000~\0018\000\000\000\001\000\001\000\002\000\000\000"
+ "\002\000\000\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000"
+ "\004\000\006\000\007\000\010\000\010\000\011\000\007\000\011\000\007\000"
+ "\012\000\010\000\012\000\007\000\013\000\012\000\013\000\007\000\014\000"
+ "\013\000\014\000\007\000\015\000\014\000\015\000\016\000\017\000\017\000"
+ "\020\000\016\000\020\000\016\000\021\000\017\000\021\000\021\000\022\000"
+ "\017\000\022\000\022\000\025\000\017\000\025\000\026\000\027\000\027\000"
+ "\030\000\026\000\030\000\026\000\031\000\027\000\031\000\032\000\033\000"
+ "\033\000\034\000\032\000\034\000\032\000\035\000\033\000\035\000\032\000"
+ "\037\000\035\000\037\000\037\000 \000\035\000 \000 \000\042\000\035\000\042"
+ "\000#\000$\000$\000%\000#\000%\000#\000&\000$\000&\000&\000'\000&\000)\000"
+ "'\000)\000\014\000*\000\014\000,\000*\000,\000\013\000*\000*\000.\000\013"
+ "\000.\000.\000/\000\013\000/\0000\0001\000\003\0001\000\003\0000\0000\000"
+ "3\0001\0003\0004\0005\000\007\0005\000\007\0004\0004\0007\0005\0007\000\033"
+ "\0008\000\033\000:\0008\000:\0008\000;\000\033\000;\000%\000<\000%\000>\000"
+ "<\000>\000<\000\077\000%\000\077\000#\000:\000\033\000#\000\015\000A\000"
+ ",\000A\000\015\000,\000\001\000C\000\002\000C\000\015\000%\000\015\000>\000"
+ "\015\000$\000$\000A\000\001\000E\000E\000F\000\001\000F\000\001\000G\000"
+ "E\000G\000\001\000H\000G\000H\000\001\000\011\000\011\000H\000\001\000\007"
+ "\000\003\0004\000\001\0004\000\034\000J\000\032\000J\000\033\0000\000\034"
+ "\0000\000\003\000L\000\000\000L\000\034\000L\000\003\000\034\000\035\000"
+ "#\000\035\000M\000#\000M\000\035\000O\000M\000O\000O\000P\000M\000P\000P"
+ "\000S\000M\000S\000#\000)\000)\000M\000U\000V\000V\000W\000U\000W\000U\000"
+ "X\000V\000X\000U\000Y\000X\000Y\000Y\000Z\000U\000Z\000Z\000[\000Y\000[\000"
+ "Z\000\134\000[\000\134\000E\000]\000E\000_\000]\000_\000]\000`\000E\000`"
+ "\000C\000`\000C\000E\000C\000F\000G\000d\000G\000f\000d\000f\000_\000d\000"
+ "G\000_\000\011\000g\000\010\000g\000g\000j\000\011\000j\000j\000k\000\011"
+ "\000k\000\010\000l\000\012\000l\000l\000n\000\010\000n\000g\000n\000o\000"
+ "p\000p\000q\000o\000q\000,\000o\000,\000p\000o\000r\000,\000r\000*\000r\000"
+ "\012\000/\000/\000s\000\012\000s\000l\000s\000t\000u\000u\000v\000t\000v"
+ "\000t\000w\000u\000w\000w\000x\000u\000x\000v\000y\000v\000z\000y\000z\000"
+ "y\000{\000v\000{\000t\000{\000\011\000|\000k\000|\000H\000|\000|\000~\000"
+ "H\000~\000\177\000\200\000\200\000\201\000\177\000\201\000\177\000\202\000"
+ "\200\000\202\000\177\000\203\000\202\000\203\000\177\000\206\000\203\000"
+ "\206\000\203\000\207\000\202\000\207\000\203\000\210\000\207\000\210\000"
+ "\203\000\211\000\210\000\211\000\203\000\213\000\211\000\213\000H\000\214"
+ "\000~\000\214\000f\000\214\000H\000f\000\215\000\216\000\216\000\217\000"
+ "\215\000\217\000\201\000\215\000\201\000\216\000\177\000\215\000\220\000"
+ "\221\000\006\000\221\000\006\000\220\000\220\000\223\000\221\000\223\000"
+ "\220\000\224\000\223\000\224\000\224\000\225\000\223\000\225\000\005\000"
+ "\220\000\005\000\227\000\220\000\227\000\227\000\230\000\220\000\230\000"
+ "\227\000\231\000\230\000\231\000q\000\232\000q\000\233\000\232\000\233\000"
+ "\232\000\234\000q\000\234\000o\000\234\000Z\000\235\000\134\000\235\000Z"
+ "\000\217\000\217\000\235\000Z\000\215\000\225\000\236\000\223\000\236\000"
+ "\225\000\237\000\236\000\237\000\237\000\240\000\236\000\240\000\241\000"
+ "\242\000\242\000\243\000\241\000\243\000\241\000\244\000\242\000\244\000"
+ "\241\000\245\000\244\000\245\000\245\000\246\000\244\000\246\000\245\000"
+ "\247\000\246\000\247\000\245\000\250\000\247\000\250\000\211\000\251\000"
+ "\210\000\251\000\211\000\243\000\243\000\251\000\211\000\241\000x\000\233"
+ "\000u\000\233\000x\000\252\000\233\000\252\000\232\000\252\000C\000\253\000"
+ "`\000\253\000\253\000\254\000C\000\254\000\254\000\255\000C\000\255\000\255"
+ "\000\257\000C\000\257\000z\000\240\000z\000\236\000\240\000\260\000z\000"
+ "\260\000y\000\260\000w\000{\000w\000y\000x\000y\000x\000\260\000\252\000"
+ "\260\000\240\000\252\000\232\000\240\000\232\000\237\000\234\000\237\000"
+ "\225\000\234\000o\000\225\000o\000\224\000r\000\224\000r\000\220\000*\000"
+ "\220\000*\000\230\000.\000\230\000.\000\231\000/\000\231\000\231\000\261"
+ "\000/\000\261\000s\000\261\000\261\000\262\000s\000\262\000l\000\262\000"
+ "\262\000\263\000l\000\263\000n\000\263\000V\000\263\000V\000n\000V\000g\000"
+ "X\000g\000X\000j\000Y\000j\000Y\000k\000[\000k\000[\000|\000\134\000|\000"
+ "\134\000~\000~\000\235\000\214\000\235\000\214\000\217\000f\000\217\000f"
+ "\000\216\000d\000\216\000d\000\201\000_\000\201\000_\000\200\000]\000\200"
+ "\000]\000\202\000`\000\202\000`\000\207\000\207\000\253\000\210\000\253\000"
+ "\210\000\254\000\251\000\254\000\251\000\264\000\254\000\264\000\243\000"
+ "\264\000\243\000\265\000\264\000\265\000\242\000\265\000\242\000\266\000"
+ "\265\000\266\000\244\000\266\000\244\000\267\000\266\000\267\000\246\000"
+ "\267\000\246\000\270\000\267\000\270\000\247\000\270\000\255\000\264\000"
+ "\255\000\265\000\265\000\271\000\255\000\271\000\266\000\271\000\267\000"
+ "\271\000\267\000\272\000\271\000\272\000\270\000\272\000\247\000\272\000"
+ "\250\000\272\000\231\000\273\000\227\000\273\000\261\000\273\000\262\000"
+ "\273\000W\000\262\000W\000\273\000W\000\263\000\022\000\274\000\021\000\274"
+ "\000\274\000\275\000\022\000\275\000\275\000\276\000\022\000\276\000\276"
+ "\000\300\000\022\000\300\000\301\000\302\000\302\000\303\000\301\000\303"
+ "\000\301\000\304\000\302\000\304\000\304\000\305\000\302\000\305\000\306"
+ "\000\307\000\307\000\310\000\306\000\310\000\304\000\306\000\304\000\307"
+ "\000\305\000\306\000\311\000\312\000\312\000\313\000\311\000\313\000\311"
+ "\000\314\000\312\000\314\000\311\000\315\000\314\000\315\000\314\000\316"
+ "\000\315\000\316\000\316\000\317\000\314\000\317\000\317\000\320\000\314"
+ "\000\320\000\321\000\322\000\322\000\323\000\321\000\323\000\321\000\324"
+ "\000\322\000\324\000\321\000\325\000\324\000\325\000\325\000\326\000\324"
+ "\000\326\000\312\000\327\000\312\000\330\000\327\000\330\000\327\000\331"
+ "\000\312\000\331\000\313\000\331\000J\000\333\000\333\000\334\000J\000\334"
+ "\000J\000\335\000\333\000\335\000J\000\336\000\335\000\336\000J\000\341\000"
+ "\336\000\341\000\336\000\342\000\335\000\342\000\336\000\343\000\342\000"
+ "\343\000\336\000\344\000\343\000\344\000\345\000\346\000\346\000\347\000"
+ "\345\000\347\000\303\000\345\000\303\000\346\000\302\000\346\000\042\000"
+ "\350\000\035\000\350\000\042\000\351\000\350\000\351\000\042\000\352\000"
+ "\351\000\352\000\042\000\353\000\352\000\353\000\042\000\354\000\353\000"
+ "\354\000 \000\354\000\326\000\355\000\324\000\355\000\326\000\356\000\355"
+ "\000\356\000\326\000\357\000\356\000\357\000\357\000\360\000\356\000\360"
+ "\000\361\000\362\000\362\000\363\000\361\000\363\000\361\000\364\000\362"
+ "\000\364\000\364\000\365\000\362\000\365\000 \000\366\000\354\000\366\000"
+ " \000\367\000\366\000\367\000\037\000\367\000\365\000\370\000\362\000\370"
+ "\000\365\000\371\000\370\000\371\000\371\000\372\000\370\000\372\000\360"
+ "\000\373\000\356\000\373\000\360\000\374\000\373\000\374\000\374\000\375"
+ "\000\373\000\375\000\330\000\375\000\330\000\373\000\375\000\376\000\330"
+ "\000\376\000\327\000\376\000\035\000\377\000O\000\377\000\035\000\000\001"
+ "\377\000\000\001\350\000\000\001M\000\001\001)\000\001\001S\000\001\001S"
+ "\000\004\001\001\001\004\001S\000\005\001\004\001\005\001P\000\005\001P\000"
+ "\006\001\005\001\006\001P\000\007\001\006\001\007\001O\000\007\001O\000\010"
+ "\001\007\001\010\001\377\000\010\001\320\000\011\001\317\000\011\001\020"
+ "\000\011\001\020\000\320\000\017\000\320\000\344\000\012\001\343\000\012"
+ "\001\310\000\344\000\310\000\012\001\306\000\344\000\037\000\013\001\367"
+ "\000\013\001\037\000\334\000\334\000\013\001\037\000J\000\014\001\015\001"
+ "\015\001\016\001\014\001\016\001\014\001\017\001\015\001\017\001\017\001"
+ "\020\001\015\001\020\001\020\001\021\001\015\001\021\001\020\001\022\001"
+ "\021\001\022\001\022\001\023\001\021\001\023\001\276\000\024\001\275\000"
+ "\024\001\347\000\024\001\276\000\347\000\276\000\346\000\001\001\025\001"
+ ")\000\025\001\363\000\001\001\363\000\025\001\001\001\026\001\363\000\026"
+ "\001\361\000\026\001\372\000\016\001\370\000\016\001\372\000\027\001\016"
+ "\001\027\001\014\001\027\001\017\001\027\001\372\000\017\001\372\000\020"
+ "\001\371\000\020\001\371\000\022\001\365\000\022\001\365\000\023\001\364"
+ "\000\023\001\364\000\030\001\023\001\030\001\361\000\030\001\321\000\361"
+ "\000\321\000\030\001\321\000\026\001\325\000\026\001\325\000\001\001\326"
+ "\000\001\001\326\000\004\001\357\000\004\001\360\000\004\001\360\000\005"
+ "\001\360\000\006\001\374\000\006\001\375\000\006\001\375\000\007\001\375"
+ "\000\010\001\376\000\010\001\376\000\377\000\327\000\377\000\327\000\000"
+ "\001\331\000\000\001\331\000\350\000\313\000\350\000\313\000\351\000\311"
+ "\000\351\000\311\000\352\000\315\000\352\000\315\000\353\000\316\000\353"
+ "\000\316\000\354\000\317\000\354\000\317\000\366\000\366\000\011\001\367"
+ "\000\011\001\020\000\367\000\016\000\367\000\016\000\013\001\016\000\334"
+ "\000\021\000\334\000\021\000\333\000\274\000\333\000\274\000\335\000\275"
+ "\000\335\000\275\000\342\000\342\000\024\001\343\000\024\001\343\000\347"
+ "\000\347\000\012\001\345\000\012\001\310\000\345\000\303\000\310\000\301"
+ "\000\310\000\301\000\307\000\323\000\023\001\323\000\021\001\323\000\030"
+ "\001\031\001\032\001\032\001\033\001\031\001\033\001\031\001\034\001\032"
+ "\001\034\001\004\000\033\001\004\000\035\001\033\001\035\001\004\000\032"
+ "\001\203\000\036\001\206\000\036\001\026\000 \001\026\000\036\001\036\001"
+ " \001\031\000 \001\031\000#\001 \001#\001#\001$\001\031\000$\001\022\000"
+ "$\001\022\000#\001Z\000&\001U\000&\001\215\000&\001\177\000&\001\206\000"
+ "&\001\036\001&\001\004\000\227\000\004\000\273\000\004\000W\000\004\000U"
+ "\000\004\000&\001\324\000\034\001\324\000\031\001\036\001/\001 \001/\001"
+ "\355\0001\001\034\0011\001\355\000\034\001\356\0001\001\312\000\356\000\312"
+ "\0001\001\312\000\373\000\312\000#\001#\0011\001\017\000\312\000\017\000"
+ "#\001\025\000#\001\017\000\314\000&\001/\001\034\0017\001\032\0017\001/\001"
+ "8\001 \0018\001&\0019\001\004\0009\001 \001:\001#\001:\001&\0018\0018\001"
+ "9\001\026\000\203\0001\001:\0011\0017\001\032\0019\001\032\0018\0011\001"
+ "8\0017\0018\001\006\000\035\0018\001:\001%\000:\000\007\000>\000J\000L\000"
+ "5\000>\0005\000<\0000\000;\0003\000;\000\003\0007\0001\0007\000\031\000A"
+ "\001\027\000A\001$\001A\001\341\000C\001\341\000D\001C\001D\001\336\000C"
+ "\001\344\000C\001\306\000C\001\305\000C\001J\000D\001\030\000\203\000\002"
+ "\000K\001C\000K\001\000\000K\001K\001O\001\000\000O\001\022\000A\001L\000"
+ "O\001D\001O\001L\000D\001\305\000A\001A\001C\001\302\000A\001\346\000A\001"
+ "\276\000A\001\300\000A\001\257\000K\001\255\000K\001\255\000V\001K\001V\001"
+ "\271\000V\001\272\000V\001\250\000V\001\030\000\213\000\245\000V\001\030"
+ "\000\245\000\030\000V\001\030\000\241\000\030\000\211\000O\001V\001C\001"
+ "O\001C\001V\001\030\000C\001\030\000A\001'\000\363\000'\000\025\001\363\000"
+ "_\001'\000_\001\362\000_\001\370\000_\001\016\001_\001q\000c\001p\000c\001"
+ "c\001f\001q\000f\001\233\000f\001u\000f\001v\000f\001,\000c\001\324\000l"
+ "\001\322\000l\001\031\001l\001\031\001o\001l\001o\001\033\001o\001\015\001"
+ "_\001\015\001l\001_\001l\001\021\001l\001\323\000l\001$\000'\000'\000u\001"
+ "$\000u\001\033\001v\001o\001v\001\035\001v\001A\000u\001c\001u\001A\000c"
+ "\001v\000v\001f\001v\001z\000v\001\236\000v\001\223\000v\001\221\000v\001"
+ "\006\000v\001_\001u\001_\001c\001_\001f\001f\001l\001l\001v\001:\000\077"
+ "\0008\000\077\000\001\200\323\371\377\177\000\000\001\200\323\371\001\200"
+ "\000\000\377\177\323\371\377\177\000\000\001\200-\006\134\214\000\000\001"
+ "\200\323\371\001\200\000\000\001\200\323\371\377\177\000\000\377\177\323"
+ "\371\377\177\000\000\244s-\006\377\177\000\000\001\200\323\371\377\177\000"
+ "\000\244s-\006\377\177\000\000\001\200-\006\134\214\000\000\001\200\323\371"
+ "\377\177\000\000\001\200-\006\134\214\000\000\377\177\323\371\377\177\000"
+ "\000\001\200\323\371\001\200\000\000\244s-\006\377\177\000\000\000\201\000"
+ "\201\000\201\201\000\201\000\201\000\000\000\000\000\000\000\372s\372s\372"
+ "sUUUUUUUU\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000"
+ "\010\000\011\000\012\000\013\000\014\000\015\000\016\000\015\000\014\000"
+ "\017\000\000\000\001\000\001\000\002\000\000\000\002\000\001\000\003\000"
+ "\000\000\003\000\002\000\007\000\000\000\007\000\003\000\007\000\002\000"
+ "\003\000\001\200\323\371\377\177\000\000\377\177\323\371\001\200\000\000"
+ "\377\177\323\371\377\177\000\000\377\177\323\371\377\177\000\000\134\214"
+ "-\006\377\177\000\000\001\200\323\371\377\177\000\000\377\177-\006\134\214"
+ "\000\000\377\177\323\371\377\177\000\000\377\177\323\371\001\200\000\000"
+ "\377\177\323\371\377\177\000\000\377\177-\006\134\214\000\000\134\214-\006"
+ "\377\177\000\000\001\200\323\371\377\177\000\000\377\177-\006\134\214\000"
+ "\000\377\177\323\371\001\200\000\000\134\214-\006\377\177\000\000\000\201"
+ "\000\201\000\201\000\000\000\000\000\000\177\000\177\000\177\000\006s\006"
+ "s\006s\253U\253U\253U\253U\000\000\001\000\002\000\003\000\004\000\005\000"
+ "\006\000\007\000\010\000\011\000\012\000\013\000\014\000\015\000\016\000"
+ "\015\000\014\000\017\000\000\000\001\000\001\000\002\000\000\000\002\000"
+ "\002\000\004\000\000\000\004\000\002\000\006\000\001\000\006\000\004\000"
+ "\006\000\000\000\006\000t\363\237\200P~\000\000\000\000\000\000P~\000\000"
+ "\007\347w\202P~\000\000\000\000\001\200P~\000\000\223\225\034GP~\000\000"
+ "\036\217V<\260\201\000\000\036\217V<P~\000\000\223\225\034G\260\201\000\000"
+ "\277\211\3730\260\201\000\000\277\211\3730P~\000\000w\202\371\030P~\000\000"
+ "\237\200\214\014\260\201\000\000\237\200\214\014P~\000\000w\202\371\030\260"
+ "\201\000\000\371\030\211}P~\000\000(%|z\260\201\000\000\371\030\211}\260"
+ "\201\000\000(%|zP~\000\000\214\014a\177P~\000\000\214\014a\177\260\201\000"
+ "\000~\245\202ZP~\000\000\315\256\361b\260\201\000\000~\245\202Z\260\201\000"
+ "\000\315\256\361bP~\000\000\017\2353Q\260\201\000\000\017\2353QP~\000\000"
+ "|z(%\260\201\000\000Av\3730P~\000\000|z(%P~\000\000Av\3730\260\201\000\000"
+ "\007\347w\202P~\000\000\330\332\204\205\260\201\000\000\007\347w\202\260"
+ "\201\000\000\330\332\204\205P~\000\000\000\000\001\200P~\000\000t\363\237"
+ "\200\260\201\000\000\000\000\001\200\260\201\000\000t\363\237\200P~\000\000"
+ "\214\014\237\200P~\000\000\214\014\237\200\260\201\000\000\361b\315\256\260"
+ "\201\000\000mj\344\270P~\000\000\361b\315\256P~\000\000mj\344\270\260\201"
+ "\000\000\005\317\277\211\260\201\000\000\005\317\277\211P~\000\000a\177\214"
+ "\014\260\201\000\000\377\177\000\000P~\000\000\377\177\000\000\260\201\000"
+ "\000a\177\214\014P~\000\000V<\036\217P~\000\000\3730\277\211\260\201\000"
+ "\000V<\036\217\260\201\000\000\3730\277\211P~\000\000\344\270mjP~\000\000"
+ "\252\303\342p\260\201\000\000\344\270mj\260\201\000\000\252\303\342pP~\000"
+ "\000V<\342pP~\000\000\034Gmj\260\201\000\000V<\342p\260\201\000\000\034G"
+ "mjP~\000\000\202Z~\245\260\201\000\000\202Z~\245P~\000\000\211}\371\030\260"
+ "\201\000\000\211}\371\030P~\000\000a\177t\363\260\201\000\000\211}\007\347"
+ "P~\000\000\211}\007\347\260\201\000\000a\177t\363P~\000\000\252\303\036\217"
+ "\260\201\000\000\252\303\036\217P~\000\000\204\205(%\260\201\000\000\204"
+ "\205(%P~\000\000\000\000\377\177P~\000\000\000\000\377\177\260\201\000\000"
+ "t\363a\177P~\000\000t\363a\177\260\201\000\000\007\347\211}P~\000\000\007"
+ "\347\211}\260\201\000\000\330\332|zP~\000\000\330\332|z\260\201\000\000\005"
+ "\317AvP~\000\000\005\317Av\260\201\000\000\342pV<\260\201\000\000mj\034G"
+ "P~\000\000\342pV<P~\000\000mj\034G\260\201\000\000\034G\223\225P~\000\000"
+ "\034G\223\225\260\201\000\0003Q\017\235P~\000\0003Q\017\235\260\201\000\000"
+ "\315\256\017\235P~\000\000~\245~\245\260\201\000\000\315\256\017\235\260"
+ "\201\000\000~\245~\245P~\000\000\3730AvP~\000\000\3730Av\260\201\000\000"
+ "\361b3QP~\000\000\361b3Q\260\201\000\0003Q\361b\260\201\000\0003Q\361bP~"
+ "\000\000\202Z\202Z\260\201\000\000\202Z\202ZP~\000\000\344\270\223\225\260"
+ "\201\000\000\344\270\223\225P~\000\000(%\204\205\260\201\000\000(%\204\205"
+ "P~\000\000\001\200\000\000\260\201\000\000\001\200\000\000P~\000\000\371"
+ "\030w\202\260\201\000\000\371\030w\202P~\000\000\017\235\315\256\260\201"
+ "\000\000\017\235\315\256P~\000\000\277\211\005\317P~\000\000\036\217\252"
+ "\303\260\201\000\000\036\217\252\303P~\000\000\277\211\005\317\260\201\000"
+ "\000\342p\252\303P~\000\000\342p\252\303\260\201\000\000Av\005\317\260\201"
+ "\000\000Av\005\317P~\000\000\223\225\344\270P~\000\000\223\225\344\270\260"
+ "\201\000\000|z\330\332P~\000\000|z\330\332\260\201\000\000\237\200t\363\260"
+ "\201\000\000\237\200t\363P~\000\000w\202\007\347\260\201\000\000w\202\007"
+ "\347P~\000\000\204\205\330\332\260\201\000\000\204\205\330\332P~\000\000"
+ "Av\005\317P~\000\000\211}\007\347P~\000\000|z\330\332P~\000\000\377\177\000"
+ "\000P~\000\000a\177t\363P~\000\000\204\205\330\332P~\000\000w\202\007\347"
+ "P~\000\000\277\211\005\317P~\000\000\036\217\252\303P~\000\000\223\225\344"
+ "\270P~\000\000\237\200\214\014P~\000\000\001\200\000\000P~\000\000w\202\371"
+ "\030P~\000\000\017\235\315\256P~\000\000~\245~\245P~\000\000\315\256\017"
+ "\235P~\000\000\344\270\223\225P~\000\000\252\303\036\217P~\000\000\005\317"
+ "\277\211P~\000\000\034G\223\225P~\000\000\202Z~\245P~\000\0003Q\017\235P"
+ "~\000\000\330\332\204\205P~\000\000\371\030w\202P~\000\000\214\014\237\200"
+ "P~\000\000\371\030\211}P~\000\000\000\000\377\177P~\000\000\214\014a\177"
+ "P~\000\000\3730AvP~\000\000(%|zP~\000\000t\363a\177P~\000\000\007\347\211"
+ "}P~\000\000\330\332|zP~\000\000\005\317AvP~\000\000\252\303\342pP~\000\000"
+ "\344\270mjP~\000\000\034GmjP~\000\000V<\342pP~\000\000\202Z\202ZP~\000\000"
+ "3Q\361bP~\000\000\3730\277\211P~\000\000(%\204\205P~\000\000\315\256\361"
+ "bP~\000\000~\245\202ZP~\000\000\017\2353QP~\000\000\223\225\034GP~\000\000"
+ "\036\217V<P~\000\000\277\211\3730P~\000\000mj\034GP~\000\000\361b3QP~\000"
+ "\000Av\3730P~\000\000\342pV<P~\000\000mj\344\270P~\000\000\342p\252\303P"
+ "~\000\000V<\036\217P~\000\000\361b\315\256P~\000\000\211}\371\030P~\000\000"
+ "a\177\214\014P~\000\000|z(%P~\000\000\204\205(%P~\000\000\237\200t\363P~"
+ "\000\000\211}\007\347\260\201\000\000Av\005\317\260\201\000\000\000\000\000"
+ "\000\260\201\000\000|z\330\332\260\201\000\000\377\177\000\000\260\201\000"
+ "\000a\177t\363\260\201\000\000mj\344\270\260\201\000\000\202Z~\245\260\201"
+ "\000\000\361b\315\256\260\201\000\000\342p\252\303\260\201\000\000t\363a"
+ "\177\260\201\000\000\007\347\211}\260\201\000\000\000\000\377\177\260\201"
+ "\000\000\330\332|z\260\201\000\000\005\317Av\260\201\000\000Av\3730\260\201"
+ "\000\000\211}\371\030\260\201\000\000|z(%\260\201\000\000a\177\214\014\260"
+ "\201\000\000\3730\277\211\260\201\000\000\371\030w\202\260\201\000\000(%"
+ "\204\205\260\201\000\000\034G\223\225\260\201\000\000V<\036\217\260\201\000"
+ "\000\034Gmj\260\201\000\000\202Z\202Z\260\201\000\0003Q\361b\260\201\000"
+ "\000mj\034G\260\201\000\000\361b3Q\260\201\000\000\017\235\315\256\260\201"
+ "\000\000\223\225\344\270\260\201\000\000~\245~\245\260\201\000\000\036\217"
+ "\252\303\260\201\000\000\277\211\005\317\260\201\000\000\315\256\017\235"
+ "\260\201\000\000\344\270\223\225\260\201\000\000\252\303\036\217\260\201"
+ "\000\000\005\317\277\211\260\201\000\000t\363\237\200\260\201\000\000\007"
+ "\347w\202\260\201\000\000\000\000\001\200\260\201\000\000\214\014\237\200"
+ "\260\201\000\000\214\014a\177\260\201\000\000\371\030\211}\260\201\000\000"
+ "\3730Av\260\201\000\000(%|z\260\201\000\000\237\200t\363\260\201\000\000"
+ "\001\200\000\000\260\201\000\000w\202\007\347\260\201\000\000\237\200\214"
+ "\014\260\201\000\000w\202\371\030\260\201\000\000\036\217V<\260\201\000\000"
+ "\277\211\3730\260\201\000\000\223\225\034G\260\201\000\000\204\205(%\260"
+ "\201\000\000\315\256\361b\260\201\000\000~\245\202Z\260\201\000\000\344\270"
+ "mj\260\201\000\000\017\2353Q\260\201\000\000V<\342p\260\201\000\000\330\332"
+ "\204\205\260\201\000\000\342pV<\260\201\000\0003Q\017\235\260\201\000\000"
+ "\252\303\342p\260\201\000\000\204\205\330\332\260\201\000\000\000\000\000"
+ "\000\000\000\000\000\2632\256-\254+\2654\247&\245$\225\024\216\015\213\012"
+ "\230\027\027h\034c\024k\037`\015r\012u\301@\306E\301@\310G\273:\2718`\037"
+ "[$c\034Y&\351\230\344\235\354\225\341\240\376\203\366\213\002\203\363\216"
+ "\012\213\015\216G\310K\314E\306M\316\334\245\332\247t\013}\002}\376t\013"
+ "+\254&\247-\256$\245\316M\323R\314K\325T-R2M+T4KA\302>\277h\027k\024r\363"
+ "k\354h\351u\366\325\254\323\256\240\037\235\034\002}\376}\366u\363r\354k"
+ "\351h\344c\341`\334[\332YR-M2T+K42\2634\2658\271:\273\306\273\302\277\310"
+ "\271\277\302&Y$[G8E:8G:E>AA>\316\263\314\265\037\240\034\235\203\002\203"
+ "\376\027\230\024\225\273\306\271\310\247\332\255\324\255\324\245\334S\324"
+ "S\324Y\332[\334\263\316\265\314c\344`\341\213\366\216\363\225\354\230\351"
+ "\235\344\240\341\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\000\000\001\000\002\000\001\000\000\000\003\000\004\000"
+ "\005\000\006\000\005\000\004\000\007\000\006\000\010\000\011\000\010\000"
+ "\006\000\005\000\012\000\013\000\014\000\013\000\012\000\015\000\016\000"
+ "\017\000\020\000\017\000\016\000\021\000\022\000\020\000\023\000\020\000"
+ "\022\000\016\000\024\000\025\000\026\000\025\000\024\000\027\000\024\000"
+ "\030\000\031\000\030\000\024\000\026\000\032\000\033\000\034\000\033\000"
+ "\032\000\035\000\036\000\037\000 \000\037\000\036\000!\000\042\000#\000$"
+ "\000#\000\042\000%\000&\000$\000'\000$\000&\000\042\000(\000)\000*\000)\000"
+ "(\000+\000!\000,\000\037\000,\000!\000-\000.\000/\0000\000/\000.\0001\000"
+ "%\000 \000#\000 \000%\000\036\0002\0003\0004\0003\0002\0005\0006\0007\000"
+ "8\0007\0006\0009\000\027\0008\000\025\0008\000\027\0006\000:\000;\000<\000"
+ ";\000:\000=\000>\000*\000\077\000*\000>\000(\000@\000\034\000A\000\034\000"
+ "@\000\032\000B\000C\000D\000C\000B\000E\000-\000F\000,\000F\000-\000G\000"
+ "\011\000H\000I\000H\000\011\000\010\000J\000\023\000K\000\023\000J\000\022"
+ "\000L\000K\000M\000K\000L\000J\000N\000M\000O\000M\000N\000L\000P\000O\000"
+ "Q\000O\000P\000N\000R\000Q\000S\000Q\000R\000P\000T\000U\000V\000U\000T\000"
+ "W\000\031\000\007\000\004\000\007\000\031\000\030\000X\0004\000Y\0004\000"
+ "X\0002\000Z\000Y\000[\000Y\000Z\000X\000\077\000[\000>\000[\000\077\000Z"
+ "\000\134\000]\000^\000]\000\134\000_\000`\000<\000a\000<\000`\000:\000W\000"
+ "b\000U\000b\000W\000c\000.\000A\0001\000A\000.\000@\000=\000d\000;\000d\000"
+ "=\000e\000e\000f\000d\000f\000e\000g\000\021\000a\000\017\000a\000\021\000"
+ "`\000\035\000V\000\033\000V\000\035\000T\000G\000h\000F\000h\000G\000i\000"
+ "5\000j\0003\000j\0005\000k\000\014\000l\000m\000l\000\014\000\013\000I\000"
+ "\015\000\012\000\015\000I\000H\000c\000g\000b\000g\000c\000f\000k\000n\000"
+ "j\000n\000k\000o\000_\000p\000]\000p\000_\000q\000r\000s\000t\000s\000r\000"
+ "u\000+\000v\000)\000v\000+\000w\000x\000v\000w\000v\000x\000y\000z\000s\000"
+ "{\000s\000z\000t\000D\000|\000}\000|\000D\000C\000}\000y\000x\000y\000}\000"
+ "|\0000\000E\000B\000E\0000\000/\000o\000'\000n\000'\000o\000&\000q\000{\000"
+ "p\000{\000q\000z\000i\000^\000h\000^\000i\000\134\000m\000~\000\177\000~"
+ "\000m\000l\000\177\000\200\000\201\000\200\000\177\000~\000\201\000\202\000"
+ "\203\000\202\000\201\000\200\000\203\000u\000r\000u\000\203\000\202\0009"
+ "\000S\0007\000S\0009\000R\000\204\000\205\000\001\000\205\000\204\000\206"
+ "\000\205\000\207\000\001\000\207\000\205\000\210\000\211\000\001\000\212"
+ "\000\001\000\211\000\213\000\214\000\001\000\213\000\001\000\214\000\215"
+ "\000\001\000\216\000\217\000\216\000\001\000\220\000\221\000\001\000\215"
+ "\000\001\000\221\000\222\000\223\000\001\000\222\000\001\000\223\000\224"
+ "\000\225\000\001\000\224\000\001\000\225\000\226\000\227\000\230\000\001"
+ "\000\230\000\227\000\231\000\232\000\001\000\226\000\001\000\232\000\002"
+ "\000\003\000\233\000\001\000\233\000\003\000\234\000\235\000\236\000\001"
+ "\000\236\000\235\000\237\000\240\000\235\000\001\000\235\000\240\000\241"
+ "\000\001\000\242\000\243\000\242\000\001\000\236\000\001\000\244\000\245"
+ "\000\244\000\001\000\243\000\001\000\246\000\247\000\246\000\001\000\245"
+ "\000\250\000\240\000\001\000\240\000\250\000\251\000\252\000\250\000\001"
+ "\000\250\000\252\000\253\000\233\000\254\000\001\000\254\000\233\000\255"
+ "\000\001\000\256\000\257\000\256\000\001\000\247\000\001\000\260\000\261"
+ "\000\260\000\001\000\257\000\001\000\262\000\263\000\262\000\001\000\261"
+ "\000\264\000\252\000\001\000\252\000\264\000\265\000\266\000\264\000\001"
+ "\000\264\000\266\000\267\000\270\000\204\000\001\000\204\000\270\000\271"
+ "\000\254\000\227\000\001\000\227\000\254\000\272\000\230\000\270\000\001"
+ "\000\270\000\230\000\273\000\207\000\274\000\001\000\274\000\207\000\275"
+ "\000\274\000\266\000\001\000\266\000\274\000\276\000\001\000\277\000\220"
+ "\000\277\000\001\000\263\000\300\000\001\000\217\000\001\000\300\000\212"
+ "\000\301\000\302\000\303\000\302\000\301\000\304\000\305\000\301\000\303"
+ "\000\301\000\305\000\306\000\307\000\310\000\303\000\310\000\307\000\311"
+ "\000\302\000\307\000\303\000\307\000\302\000\312\000\313\000\303\000\314"
+ "\000\303\000\313\000\315\000\316\000\303\000\317\000\303\000\316\000\314"
+ "\000\320\000\321\000\303\000\321\000\320\000\322\000\321\000\305\000\303"
+ "\000\305\000\321\000\323\000\324\000\325\000\303\000\325\000\324\000\326"
+ "\000\327\000\324\000\303\000\324\000\327\000\330\000\331\000\332\000\303"
+ "\000\332\000\331\000\333\000\332\000\334\000\303\000\334\000\332\000\335"
+ "\000\303\000\336\000\337\000\336\000\303\000\340\000\303\000\341\000\342"
+ "\000\341\000\303\000\337\000\303\000\343\000\340\000\343\000\303\000\344"
+ "\000\303\000\345\000\344\000\345\000\303\000\346\000\303\000\347\000\350"
+ "\000\347\000\303\000\351\000\303\000\352\000\351\000\352\000\303\000\325"
+ "\000\353\000\303\000\315\000\303\000\353\000\354\000\354\000\355\000\303"
+ "\000\355\000\354\000\356\000\303\000\357\000\360\000\357\000\303\000\361"
+ "\000\362\000\303\000\360\000\303\000\362\000\363\000\364\000\303\000\365"
+ "\000\303\000\364\000\366\000\367\000\303\000\363\000\303\000\367\000\365"
+ "\000\370\000\303\000\371\000\303\000\370\000\372\000\373\000\303\000\366"
+ "\000\303\000\373\000\371\000\355\000\331\000\303\000\331\000\355\000\374"
+ "\000\303\000\375\000\346\000\375\000\303\000\350\000\334\000\320\000\303"
+ "\000\320\000\334\000\376\000\310\000\327\000\303\000\327\000\310\000\377"
+ "\000\000\001\303\000\372\000\303\000\000\001\317\000\303\000\001\001\361"
+ "\000\001\001\303\000\342\000\000\000\001\000\001\000\002\000\000\000\002"
+ "\000\000\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004"
+ "\000\006\000\004\000\007\000\005\000\007\000\006\000\010\000\010\000\011"
+ "\000\006\000\011\000\005\000\010\000\012\000\013\000\013\000\014\000\012"
+ "\000\014\000\012\000\015\000\013\000\015\000\016\000\017\000\017\000\020"
+ "\000\016\000\020\000\016\000\021\000\017\000\021\000\020\000\022\000\020"
+ "\000\023\000\022\000\023\000\016\000\022\000\024\000\025\000\025\000\026"
+ "\000\024\000\026\000\024\000\027\000\025\000\027\000\024\000\030\000\030"
+ "\000\031\000\024\000\031\000\026\000\030\000\032\000\033\000\033\000\034"
+ "\000\032\000\034\000\032\000\035\000\033\000\035\000\002\000\037\000\037"
+ "\000 \000\002\000 \000\002\000!\000\037\000!\000\003\000#\000#\000$\000\003"
+ "\000$\000\000\000#\000$\000&\000$\000'\000&\000'\000\003\000&\000(\000)\000"
+ ")\000*\000(\000*\000(\000+\000)\000+\000!\000,\000\037\000,\000!\000-\000"
+ ",\000-\000.\000/\000/\0000\000.\0000\000.\0001\000/\0001\000\000\000 \000"
+ " \000#\0002\0003\0003\0004\0002\0004\0002\0005\0003\0005\0006\0007\0007\000"
+ "8\0006\0008\0006\0009\0007\0009\000\027\0008\000\025\0008\000\027\0006\000"
+ ":\000;\000;\000<\000:\000<\000:\000=\000;\000=\000*\000>\000*\000\077\000"
+ ">\000\077\000(\000>\000\034\000@\000\034\000A\000@\000A\000\032\000@\000"
+ "B\000C\000C\000D\000B\000D\000B\000E\000C\000E\000-\000F\000,\000F\000-\000"
+ "G\000F\000G\000\011\000H\000H\000I\000\011\000I\000\010\000H\000\023\000"
+ "J\000\023\000K\000J\000K\000\022\000J\000K\000L\000K\000M\000L\000M\000J"
+ "\000L\000M\000N\000M\000O\000N\000O\000L\000N\000O\000P\000O\000Q\000P\000"
+ "Q\000N\000P\000Q\000R\000Q\000S\000R\000S\000P\000R\000T\000U\000U\000V\000"
+ "T\000V\000T\000W\000U\000W\000\007\000\031\000\004\000\031\000\007\000\030"
+ "\0004\000X\0004\000Y\000X\000Y\0002\000X\000Y\000Z\000Y\000[\000Z\000[\000"
+ "X\000Z\000\077\000[\000>\000[\000\077\000Z\000\134\000]\000]\000^\000\134"
+ "\000^\000\134\000_\000]\000_\000<\000`\000<\000a\000`\000a\000:\000`\000"
+ "W\000b\000U\000b\000W\000c\000b\000c\000.\000A\0001\000A\000.\000@\000=\000"
+ "d\000;\000d\000=\000e\000d\000e\000e\000f\000d\000f\000e\000g\000f\000g\000"
+ "\021\000a\000\017\000a\000\021\000`\000\035\000V\000\033\000V\000\035\000"
+ "T\000G\000h\000F\000h\000G\000i\000h\000i\0005\000j\0003\000j\0005\000k\000"
+ "j\000k\000\014\000l\000l\000m\000\014\000m\000\013\000l\000\015\000I\000"
+ "\012\000I\000\015\000H\000c\000g\000b\000g\000c\000f\000k\000n\000j\000n"
+ "\000k\000o\000n\000o\000_\000p\000]\000p\000_\000q\000p\000q\000r\000s\000"
+ "s\000t\000r\000t\000r\000u\000s\000u\000+\000v\000)\000v\000+\000w\000v\000"
+ "w\000v\000x\000w\000x\000x\000y\000v\000y\000s\000z\000s\000{\000z\000{\000"
+ "t\000z\000D\000|\000|\000}\000D\000}\000C\000|\000y\000}\000x\000}\000y\000"
+ "|\0000\000E\0000\000B\000/\000E\000'\000o\000'\000n\000&\000o\000q\000{\000"
+ "p\000{\000q\000z\000^\000i\000^\000h\000\134\000i\000m\000~\000~\000\177"
+ "\000m\000\177\000l\000~\000\177\000\200\000\200\000\201\000\177\000\201\000"
+ "~\000\200\000\201\000\202\000\202\000\203\000\201\000\203\000\200\000\202"
+ "\000u\000\203\000r\000\203\000u\000\202\0009\000S\0007\000S\0009\000R\000"
+ "C\000y\000\001\000C\000\001\000y\000/\000C\000\001\000/\000\001\000\203\000"
+ "\001\000\201\000\001\000r\000\001\000t\000\001\000z\000\001\000\014\000\001"
+ "\000m\000\001\000\012\000\001\000q\000\001\000_\000\001\000\134\000\001\000"
+ "i\000\001\000G\000\001\000-\000\077\000X\000\001\000\077\000\001\000X\000"
+ "\001\000!\000\003\000o\000\001\000o\000\016\000J\000\001\000J\000\001\000"
+ "\016\000\016\000`\000\001\000`\000\001\000L\000\001\000N\000\001\000P\000"
+ "\001\000R\000\001\0009\000\001\0006\000=\000`\000\001\000=\000=\000g\000"
+ "\001\000g\0005\000o\000\001\0005\000\001\000\027\000\001\000\024\000\001"
+ "\000\031\000\001\000\004\000\001\000\006\000\001\000\011\000U\000g\000\001"
+ "\000U\000\033\000U\000\001\000\033\000)\000y\000\001\000)\0005\000X\000)"
+ "\000\077\000/\000A\000\001\000A\000\033\000A\000\001\000I\000\001\000\177"
+ "\000D\000x\000x\000\303\000D\000\303\0000\000D\0000\000\303\000+\000>\000"
+ ">\000\303\000+\000\303\000+\000x\000M\000\303\000O\000\303\000K\000\303\000"
+ "Q\000\303\000S\000\303\000\035\000@\000@\000\303\000\035\000\303\0000\000"
+ "@\0003\000n\000n\000\303\0003\000\303\0003\000Y\000Y\000\303\000;\000f\000"
+ "f\000\303\000;\000\303\000W\000f\000W\000\303\000p\000\303\000{\000\303\000"
+ "]\000\303\000s\000\303\000u\000\303\000^\000\303\000h\000\303\000F\000\303"
+ "\000,\000\303\000#\000\303\000 \000\303\000$\000\303\000'\000\303\000\023"
+ "\000\303\000\020\000\303\000\020\000a\000a\000\303\000~\000\303\000l\000"
+ "\303\000\200\000\303\000\013\000\303\000\015\000\303\000\005\000\303\000"
+ "\010\000\303\000\007\000\303\000H\000\303\000\025\000\303\000\026\000\303"
+ "\0008\000\303\000\030\000\303\000;\000a\000\037\000\303\000\035\000W\000"
+ ">\000Y\0007\000\303\000\202\000\303\000\211}\371\030\260\201\000\000|z(%"
+ "P~\000\000\211}\371\030P~\000\000|z(%\260\201\000\000\315\256\361bP~\000"
+ "\000\344\270mj\260\201\000\000\315\256\361b\260\201\000\000\344\270mjP~\000"
+ "\000V<\342pP~\000\000\034Gmj\260\201\000\000V<\342p\260\201\000\000\034G"
+ "mjP~\000\000V<\036\217P~\000\000\3730\277\211\260\201\000\000V<\036\217\260"
+ "\201\000\000\3730\277\211P~\000\000\252\303\342p\260\201\000\000\252\303"
+ "\342pP~\000\000\007\347w\202P~\000\000\330\332\204\205\260\201\000\000\007"
+ "\347w\202\260\201\000\000\330\332\204\205P~\000\000t\363\237\200P~\000\000"
+ "t\363\237\200\260\201\000\000\000\000\001\200P~\000\000\000\000\001\200\260"
+ "\201\000\000\214\014\237\200P~\000\000\214\014\237\200\260\201\000\000\361"
+ "b\315\256\260\201\000\000mj\344\270P~\000\000\361b\315\256P~\000\000mj\344"
+ "\270\260\201\000\000\005\317\277\211\260\201\000\000\005\317\277\211P~\000"
+ "\000\377\177\000\000\260\201\000\000a\177\214\014P~\000\000\377\177\000\000"
+ "P~\000\000a\177\214\014\260\201\000\000w\202\371\030P~\000\000\237\200\214"
+ "\014\260\201\000\000\237\200\214\014P~\000\000w\202\371\030\260\201\000\000"
+ "\371\030\211}P~\000\000(%|z\260\201\000\000\371\030\211}\260\201\000\000"
+ "(%|zP~\000\000\214\014a\177P~\000\000\214\014a\177\260\201\000\000~\245\202"
+ "ZP~\000\000~\245\202Z\260\201\000\000\017\2353Q\260\201\000\000\017\2353"
+ "QP~\000\000\036\217V<P~\000\000\223\225\034G\260\201\000\000\036\217V<\260"
+ "\201\000\000\223\225\034GP~\000\000\277\211\3730\260\201\000\000\277\211"
+ "\3730P~\000\000\204\205(%\260\201\000\000\204\205(%P~\000\000\000\000\377"
+ "\177P~\000\000\000\000\377\177\260\201\000\000t\363a\177P~\000\000t\363a"
+ "\177\260\201\000\000\007\347\211}P~\000\000\007\347\211}\260\201\000\000"
+ "\330\332|zP~\000\000\330\332|z\260\201\000\000\005\317AvP~\000\000\005\317"
+ "Av\260\201\000\000\342pV<\260\201\000\000mj\034GP~\000\000\342pV<P~\000\000"
+ "mj\034G\260\201\000\000\034G\223\225P~\000\000\034G\223\225\260\201\000\000"
+ "3Q\017\235P~\000\0003Q\017\235\260\201\000\000\202Z~\245P~\000\000\202Z~"
+ "\245\260\201\000\000\315\256\017\235P~\000\000~\245~\245\260\201\000\000"
+ "\315\256\017\235\260\201\000\000~\245~\245P~\000\000\3730AvP~\000\000\373"
+ "0Av\260\201\000\000\361b3Q\260\201\000\000\361b3QP~\000\0003Q\361b\260\201"
+ "\000\0003Q\361bP~\000\000\202Z\202Z\260\201\000\000\202Z\202ZP~\000\000A"
+ "v\3730\260\201\000\000Av\3730P~\000\000\252\303\036\217P~\000\000\344\270"
+ "\223\225\260\201\000\000\252\303\036\217\260\201\000\000\344\270\223\225"
+ "P~\000\000(%\204\205\260\201\000\000(%\204\205P~\000\000\001\200\000\000"
+ "\260\201\000\000\001\200\000\000P~\000\000\371\030w\202\260\201\000\000\371"
+ "\030w\202P~\000\000\017\235\315\256\260\201\000\000\017\235\315\256P~\000"
+ "\000\277\211\005\317P~\000\000\036\217\252\303\260\201\000\000\036\217\252"
+ "\303P~\000\000\277\211\005\317\260\201\000\000\342p\252\303P~\000\000\342"
+ "p\252\303\260\201\000\000Av\005\317\260\201\000\000Av\005\317P~\000\000\223"
+ "\225\344\270\260\201\000\000\223\225\344\270P~\000\000|z\330\332\260\201"
+ "\000\000\211}\007\347P~\000\000|z\330\332P~\000\000\211}\007\347\260\201"
+ "\000\000a\177t\363P~\000\000a\177t\363\260\201\000\000\237\200t\363\260\201"
+ "\000\000\237\200t\363P~\000\000w\202\007\347\260\201\000\000w\202\007\347"
+ "P~\000\000\204\205\330\332\260\201\000\000\204\205\330\332P~\000\000\000"
+ "\000\000\000\260\201\000\000t\363\237\200\260\201\000\000\007\347w\202\260"
+ "\201\000\000\000\000\001\200\260\201\000\000\211}\371\030P~\000\000Av\373"
+ "0P~\000\000\000\000\000\000P~\000\000|z(%P~\000\000\237\200\214\014\260\201"
+ "\000\000\001\200\000\000\260\201\000\000w\202\371\030\260\201\000\000\371"
+ "\030\211}\260\201\000\000\3730Av\260\201\000\000(%|z\260\201\000\000\211"
+ "}\007\347\260\201\000\000Av\005\317\260\201\000\000|z\330\332\260\201\000"
+ "\000\252\303\036\217\260\201\000\000\344\270\223\225\260\201\000\000\005"
+ "\317\277\211\260\201\000\000\000\000\377\177\260\201\000\000\214\014a\177"
+ "\260\201\000\000\034Gmj\260\201\000\000\202Z\202Z\260\201\000\0003Q\361b"
+ "\260\201\000\000\330\332\204\205\260\201\000\000\017\235\315\256\260\201"
+ "\000\000\223\225\344\270\260\201\000\000~\245~\245\260\201\000\000V<\342"
+ "p\260\201\000\000mj\034G\260\201\000\000Av\3730\260\201\000\000\342pV<\260"
+ "\201\000\000\315\256\017\235\260\201\000\000\204\205\330\332\260\201\000"
+ "\000w\202\007\347\260\201\000\000\277\211\005\317\260\201\000\000\361b3Q"
+ "\260\201\000\000\036\217\252\303\260\201\000\000\211}\371\030\260\201\000"
+ "\000\377\177\000\000\260\201\000\000a\177\214\014\260\201\000\000\237\200"
+ "t\363\260\201\000\000|z(%\260\201\000\000\036\217V<\260\201\000\000\277\211"
+ "\3730\260\201\000\000\223\225\034G\260\201\000\000a\177t\363\260\201\000"
+ "\000\204\205(%\260\201\000\000mj\344\270\260\201\000\000\202Z~\245\260\201"
+ "\000\000\361b\315\256\260\201\000\000\342p\252\303\260\201\000\000\315\256"
+ "\361b\260\201\000\000~\245\202Z\260\201\000\000\344\270mj\260\201\000\000"
+ "\034G\223\225\260\201\000\000\3730\277\211\260\201\000\000V<\036\217\260"
+ "\201\000\000\017\2353Q\260\201\000\0003Q\017\235\260\201\000\000\330\332"
+ "|z\260\201\000\000\005\317Av\260\201\000\000\007\347\211}\260\201\000\000"
+ "\252\303\342p\260\201\000\000\371\030w\202\260\201\000\000\214\014\237\200"
+ "\260\201\000\000(%\204\205\260\201\000\000t\363a\177\260\201\000\000mj\034"
+ "GP~\000\000\342pV<P~\000\000\034GmjP~\000\000\3730AvP~\000\000V<\342pP~\000"
+ "\000\017\2353QP~\000\000\223\225\034GP~\000\000~\245\202ZP~\000\000\371\030"
+ "\211}P~\000\000(%|zP~\000\000\202Z\202ZP~\000\000\361b3QP~\000\000\000\000"
+ "\377\177P~\000\000\214\014a\177P~\000\000\315\256\361bP~\000\000\344\270"
+ "mjP~\000\000\315\256\017\235P~\000\000~\245~\245P~\000\000\344\270\223\225"
+ "P~\000\000\036\217\252\303P~\000\000\277\211\005\317P~\000\000\223\225\344"
+ "\270P~\000\000\034G\223\225P~\000\000\202Z~\245P~\000\0003Q\017\235P~\000"
+ "\000\017\235\315\256P~\000\000\330\332\204\205P~\000\000\005\317\277\211"
+ "P~\000\000\007\347w\202P~\000\000\3730\277\211P~\000\000V<\036\217P~\000"
+ "\000mj\344\270P~\000\000Av\005\317P~\000\000\342p\252\303P~\000\000\252\303"
+ "\036\217P~\000\000\371\030w\202P~\000\000(%\204\205P~\000\000\204\205(%P"
+ "~\000\000w\202\371\030P~\000\000\277\211\3730P~\000\000\252\303\342pP~\000"
+ "\000\005\317AvP~\000\000\237\200\214\014P~\000\000\001\200\000\000P~\000"
+ "\000\036\217V<P~\000\000\237\200t\363P~\000\000w\202\007\347P~\000\000\204"
+ "\205\330\332P~\000\000t\363a\177P~\000\000\007\347\211}P~\000\0003Q\361b"
+ "P~\000\000\361b\315\256P~\000\000\377\177\000\000P~\000\000a\177\214\014"
+ "P~\000\000t\363\237\200P~\000\000\000\000\001\200P~\000\000\214\014\237\200"
+ "P~\000\000\211}\007\347P~\000\000|z\330\332P~\000\000\330\332|zP~\000\000"
+ "a\177t\363P~\000\000h\027c\034k\024`\037\310G\314K\306E\316M-R2M+T4K+\254"
+ "&\247-\256$\245\323R\325T\351\230\344\235\354\225\341\240\363\216\366\213"
+ "\376\203\002\203\012\213\015\216G\310K\314E\306M\316\334\245\332\247\177"
+ "\000u\012\177\000r\015\226\025\216\015\213\012\226\025\027h\034c\024k\037"
+ "`\015r\012u\301@\301@\273:\2718\255,\2643\255,\2643\247&\245$\237\036\237"
+ "\036\002}\376}\366u\363r\354k\351h\344c\341`\334[\332YR-L3T+L32\2634\265"
+ "8\271:\273>\277A\302\306\273\302\277\310\271\277\302&Y$[G8E:8G:E\077@@@Y"
+ "&[$\323\256\316\263\325\254\314\265\037\240\034\235\203\002\203\376\027\230"
+ "\024\225\272\307\272\307\247\332\254\325\256\323\245\334S\324S\324Y\332["
+ "\334\263\316\265\314a\342j\353a\342j\353u\366r\363\213\366\216\363\225\354"
+ "\230\351\235\344\240\341\177\177\177\177\177\177\177\177\000\000\000\000"
+ "\000\000\000\000\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001\000"
+ "\002\000\001\000\000\000\003\000\004\000\005\000\006\000\005\000\004\000"
+ "\007\000\010\000\011\000\012\000\011\000\010\000\013\000\014\000\015\000"
+ "\016\000\015\000\014\000\017\000\007\000\020\000\005\000\020\000\007\000"
+ "\021\000\022\000\023\000\024\000\023\000\022\000\025\000\026\000\024\000"
+ "\027\000\024\000\026\000\022\000\030\000\027\000\031\000\027\000\030\000"
+ "\026\000\032\000\031\000\033\000\031\000\032\000\030\000\034\000\035\000"
+ "\036\000\035\000\034\000\037\000\025\000 \000\023\000 \000\025\000!\000\042"
+ "\000#\000$\000#\000\042\000%\000&\000'\000(\000'\000&\000)\000*\000+\000"
+ ",\000+\000*\000-\000.\000,\000/\000,\000.\000*\0000\000\006\0001\000\006"
+ "\0000\000\004\0000\0002\0003\0002\0000\0001\0004\0005\0006\0005\0004\000"
+ "7\0004\0008\0009\0008\0004\0006\0009\000:\000;\000:\0009\0008\000<\000/\000"
+ "=\000/\000<\000.\000>\000=\000\077\000=\000>\000<\000@\000\077\000A\000\077"
+ "\000@\000>\000B\000A\000C\000A\000B\000@\000D\000C\000E\000C\000D\000B\000"
+ "F\000G\000H\000G\000F\000I\0003\0005\0007\0005\0003\0002\000J\000\016\000"
+ "K\000\016\000J\000\014\000L\000K\000M\000K\000L\000J\000N\000M\000O\000M"
+ "\000N\000L\000P\000Q\000R\000Q\000P\000S\000T\000\012\000U\000\012\000T\000"
+ "\010\000V\000G\000I\000G\000V\000W\000%\000\002\000#\000\002\000%\000\000"
+ "\000\013\000X\000\011\000X\000\013\000Y\000Y\000Z\000X\000Z\000Y\000[\000"
+ "-\000U\000+\000U\000-\000T\000\134\000H\000]\000H\000\134\000F\000^\000_"
+ "\000`\000_\000^\000a\000\017\000b\000\015\000b\000\017\000c\000(\000d\000"
+ "e\000d\000(\000'\000&\000:\000)\000:\000&\000;\000Z\000W\000V\000W\000Z\000"
+ "[\000c\000f\000b\000f\000c\000g\000S\000h\000Q\000h\000S\000i\000j\000k\000"
+ "l\000k\000j\000m\000\037\000n\000\035\000n\000\037\000o\000p\000n\000o\000"
+ "n\000p\000q\000l\000r\000s\000r\000l\000k\000t\000u\000v\000u\000t\000w\000"
+ "t\000q\000p\000q\000t\000v\000\042\000x\000y\000x\000\042\000$\000g\000\033"
+ "\000f\000\033\000g\000\032\000s\000h\000i\000h\000s\000r\000a\000R\000_\000"
+ "R\000a\000P\000e\000z\000{\000z\000e\000d\000{\000|\000}\000|\000{\000z\000"
+ "}\000~\000\177\000~\000}\000|\000\177\000m\000j\000m\000\177\000~\000\021"
+ "\000E\000\020\000E\000\021\000D\000\200\000\201\000\202\000\201\000\200\000"
+ "\203\000y\000u\000w\000u\000y\000x\000O\000\036\000N\000\036\000O\000\034"
+ "\000\003\000]\000\001\000]\000\003\000\134\000!\000`\000 \000`\000!\000^"
+ "\000\204\000\205\000\206\000\205\000\204\000\207\000\210\000\200\000\211"
+ "\000\200\000\210\000\212\000\213\000\214\000\200\000\214\000\213\000\215"
+ "\000\216\000\217\000\200\000\217\000\216\000\220\000\200\000\221\000\222"
+ "\000\221\000\200\000\223\000\224\000\213\000\200\000\213\000\224\000\225"
+ "\000\226\000\227\000\200\000\227\000\226\000\230\000\200\000\231\000\223"
+ "\000\231\000\200\000\202\000\200\000\232\000\233\000\232\000\200\000\234"
+ "\000\214\000\226\000\200\000\226\000\214\000\235\000\236\000\237\000\200"
+ "\000\237\000\236\000\240\000\200\000\241\000\234\000\241\000\200\000\222"
+ "\000\200\000\242\000\243\000\242\000\200\000\244\000\227\000\236\000\200"
+ "\000\236\000\227\000\245\000\200\000\246\000\244\000\246\000\200\000\233"
+ "\000\247\000\250\000\200\000\250\000\247\000\251\000\200\000\252\000\211"
+ "\000\252\000\200\000\243\000\237\000\247\000\200\000\247\000\237\000\253"
+ "\000\254\000\200\000\255\000\200\000\254\000\256\000\250\000\216\000\200"
+ "\000\216\000\250\000\257\000\260\000\200\000\212\000\200\000\260\000\255"
+ "\000\261\000\262\000\200\000\262\000\261\000\263\000\217\000\261\000\200"
+ "\000\261\000\217\000\264\000\265\000\200\000\266\000\200\000\265\000\267"
+ "\000\270\000\271\000\200\000\271\000\270\000\272\000\273\000\200\000\256"
+ "\000\200\000\273\000\266\000\262\000\270\000\200\000\270\000\262\000\274"
+ "\000\275\000\200\000\276\000\200\000\275\000\277\000\300\000\200\000\267"
+ "\000\200\000\300\000\276\000\301\000\203\000\200\000\203\000\301\000\302"
+ "\000\271\000\301\000\200\000\301\000\271\000\303\000\304\000\200\000\277"
+ "\000\200\000\304\000\224\000\205\000\305\000\206\000\305\000\205\000\306"
+ "\000\307\000\310\000\206\000\310\000\307\000\311\000\206\000\312\000\313"
+ "\000\312\000\206\000\314\000\310\000\315\000\206\000\315\000\310\000\316"
+ "\000\305\000\317\000\206\000\317\000\305\000\320\000\315\000\321\000\206"
+ "\000\321\000\315\000\322\000\206\000\323\000\314\000\323\000\206\000\324"
+ "\000\325\000\206\000\326\000\206\000\325\000\327\000\330\000\206\000\331"
+ "\000\206\000\330\000\332\000\333\000\334\000\206\000\334\000\333\000\335"
+ "\000\336\000\206\000\332\000\206\000\336\000\326\000\337\000\206\000\340"
+ "\000\206\000\337\000\341\000\342\000\333\000\206\000\333\000\342\000\343"
+ "\000\344\000\345\000\206\000\345\000\344\000\346\000\347\000\206\000\327"
+ "\000\206\000\347\000\340\000\350\000\342\000\206\000\342\000\350\000\351"
+ "\000\206\000\352\000\353\000\352\000\206\000\354\000\206\000\355\000\324"
+ "\000\355\000\206\000\356\000\206\000\357\000\360\000\357\000\206\000\353"
+ "\000\206\000\361\000\354\000\361\000\206\000\313\000\362\000\206\000\360"
+ "\000\206\000\362\000\363\000\364\000\206\000\363\000\206\000\364\000\331"
+ "\000\206\000\365\000\366\000\365\000\206\000\321\000\317\000\307\000\206"
+ "\000\307\000\317\000\367\000\334\000\344\000\206\000\344\000\334\000\370"
+ "\000\371\000\204\000\206\000\204\000\371\000\372\000\373\000\206\000\341"
+ "\000\206\000\373\000\374\000\374\000\350\000\206\000\350\000\374\000\375"
+ "\000\345\000\376\000\206\000\376\000\345\000\377\000\206\000\000\001\356"
+ "\000\000\001\206\000\366\000\376\000\371\000\206\000\371\000\376\000\001"
+ "\001\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001"
+ "\000\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007"
+ "\000\005\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000\010"
+ "\000\013\000\011\000\013\000\014\000\015\000\015\000\016\000\014\000\016"
+ "\000\014\000\017\000\015\000\017\000\007\000\020\000\005\000\020\000\007"
+ "\000\021\000\020\000\021\000\022\000\023\000\023\000\024\000\022\000\024"
+ "\000\022\000\025\000\023\000\025\000\024\000\026\000\024\000\027\000\026"
+ "\000\027\000\022\000\026\000\027\000\030\000\027\000\031\000\030\000\031"
+ "\000\026\000\030\000\031\000\032\000\031\000\033\000\032\000\033\000\030"
+ "\000\032\000\034\000\035\000\035\000\036\000\034\000\036\000\034\000\037"
+ "\000\035\000\037\000\025\000 \000\023\000 \000\025\000!\000 \000!\000\042"
+ "\000#\000#\000$\000\042\000$\000\042\000%\000#\000%\000&\000'\000'\000(\000"
+ "&\000(\000&\000)\000'\000)\000*\000+\000+\000,\000*\000,\000*\000-\000+\000"
+ "-\000,\000.\000,\000/\000.\000/\000*\000.\000\006\0000\000\006\0001\0000"
+ "\0001\000\004\0000\0000\0002\0002\0003\0000\0003\0001\0002\0004\0005\000"
+ "5\0006\0004\0006\0004\0007\0005\0007\0004\0008\0008\0009\0004\0009\0006\000"
+ "8\0009\000:\000:\000;\0009\000;\0008\000:\000/\000<\000/\000=\000<\000=\000"
+ ".\000<\000=\000>\000=\000\077\000>\000\077\000<\000>\000\077\000@\000\077"
+ "\000A\000@\000A\000>\000@\000A\000B\000A\000C\000B\000C\000@\000B\000C\000"
+ "D\000C\000E\000D\000E\000B\000D\000F\000G\000G\000H\000F\000H\000F\000I\000"
+ "G\000I\0003\0005\0003\0007\0002\0005\000\016\000J\000\016\000K\000J\000K"
+ "\000\014\000J\000K\000L\000K\000M\000L\000M\000J\000L\000M\000N\000M\000"
+ "O\000N\000O\000L\000N\000P\000Q\000Q\000R\000P\000R\000P\000S\000Q\000S\000"
+ "\012\000T\000\012\000U\000T\000U\000\010\000T\000G\000V\000I\000V\000V\000"
+ "W\000G\000W\000\002\000%\000\002\000#\000\000\000%\000\013\000X\000\011\000"
+ "X\000\013\000Y\000X\000Y\000Y\000Z\000X\000Z\000Y\000[\000Z\000[\000-\000"
+ "U\000+\000U\000-\000T\000H\000\134\000H\000]\000\134\000]\000F\000\134\000"
+ "^\000_\000_\000`\000^\000`\000^\000a\000_\000a\000\017\000b\000\015\000b"
+ "\000\017\000c\000b\000c\000(\000d\000d\000e\000(\000e\000'\000d\000&\000"
+ ":\000)\000:\000&\000;\000W\000Z\000V\000Z\000W\000[\000c\000f\000b\000f\000"
+ "c\000g\000f\000g\000S\000h\000Q\000h\000S\000i\000h\000i\000j\000k\000k\000"
+ "l\000j\000l\000j\000m\000k\000m\000\037\000n\000\035\000n\000\037\000o\000"
+ "n\000o\000n\000p\000o\000p\000p\000q\000n\000q\000l\000r\000r\000s\000l\000"
+ "s\000k\000r\000t\000u\000u\000v\000t\000v\000t\000w\000u\000w\000q\000t\000"
+ "p\000t\000q\000v\000\042\000x\000x\000y\000\042\000y\000$\000x\000\033\000"
+ "g\000\033\000f\000\032\000g\000h\000s\000i\000s\000h\000r\000R\000a\000R"
+ "\000_\000P\000a\000e\000z\000z\000{\000e\000{\000d\000z\000{\000|\000|\000"
+ "}\000{\000}\000z\000|\000}\000~\000~\000\177\000}\000\177\000|\000~\000m"
+ "\000\177\000j\000\177\000m\000~\000\021\000E\000\020\000E\000\021\000D\000"
+ "\027\000\200\000\024\000\200\000\031\000\200\000u\000y\000w\000y\000u\000"
+ "x\000\036\000O\000\036\000N\000\034\000O\000\003\000]\000\001\000]\000\003"
+ "\000\134\000!\000`\000 \000`\000!\000^\000\002\000]\000]\000\206\000\002"
+ "\000\206\000'\000\200\000d\000\200\000)\000\200\000,\000U\000U\000\200\000"
+ ",\000\200\000p\000w\000p\000\200\000w\000\200\000`\000\200\000_\000\200\000"
+ " \000\200\000,\000=\000=\000\200\000\011\000Z\000Z\000\200\000\011\000\200"
+ "\000\023\000\200\000h\000\200\000r\000\200\000Q\000\200\000\011\000U\000"
+ "I\000\134\000\134\000\200\000I\000\200\000R\000\200\000~\000\200\000|\000"
+ "\200\000m\000\200\000I\000Z\000k\000\200\000\000\000\042\000\042\000\200"
+ "\000\000\000\200\000z\000\200\000\000\000\134\0006\000\200\0008\000\200\000"
+ "5\000\200\000\042\000w\000:\000\200\000\037\000O\000O\000\200\000\037\000"
+ "\200\000\037\000p\000\006\000\200\0001\000\200\000\005\000\200\000\015\000"
+ "K\000\015\000\200\000K\000\200\0002\000\200\000K\000O\000C\000\200\000E\000"
+ "\200\000A\000\200\000\020\000\200\000\031\000f\000f\000\200\000\015\000f"
+ "\000\077\000\200\000G\000]\000G\000\206\000\013\000T\000T\000\206\000\013"
+ "\000\206\0003\000\206\0007\000\206\0000\000\206\000*\000T\000*\000\206\000"
+ "G\000[\000[\000\206\000*\000<\000<\000\206\000\004\000\206\000\007\000\206"
+ "\000P\000\206\000S\000\206\000a\000\206\000l\000\206\000j\000\206\000s\000"
+ "\206\000J\000N\000N\000\206\000J\000\206\000i\000\206\000\025\000\206\000"
+ "!\000\206\000\022\000\206\000\017\000J\000\017\000\206\000\035\000q\000q"
+ "\000\206\000\035\000\206\000^\000\206\000\017\000g\000g\000\206\000;\000"
+ "\206\000&\000\206\0009\000\206\000\021\000\206\000D\000\206\000(\000\206"
+ "\000e\000\206\0004\000\206\000{\000\206\000}\000\206\000\177\000\206\000"
+ ">\000\206\000@\000\206\000\013\000[\000\035\000N\000\002\000$\000$\000\206"
+ "\000\026\000\206\000\030\000\206\000\030\000g\000q\000u\000u\000\206\000"
+ "B\000\206\000$\000u\000\377\177\177\221\177\221\000\000\377\177\001\200\001"
+ "\200\000\000\377\177\177\221\001\200\000\000&\277\000\000\377\177\000\000"
+ "\001\200v\031\377\177\000\000\001\200\000\000\377\177\000\000v\277[\006\377"
+ "\177\000\000e\300\247\014\377\177\000\000\001\200\377\177\377\177\000\000"
+ "\001\200\201n\201n\000\000\001\200\201n\377\177\000\000\201n\001\200\177"
+ "\221\000\000\377\177\001\200\001\200\000\000\377\177\001\200\177\221\000"
+ "\000\177\221\377\177\177\221\000\000z\252\377\177\001\200\000\000\177\221"
+ "\377\177\001\200\000\000\373\312\377\177\001\200\000\000\212\346\377\177"
+ "\001\200\000\000\000\000\377\177\001\200\000\000\000\000\377\177\177\221"
+ "\000\000\334\326\337\315\377\177\000\000\370\333\024\312\001\200\000\000"
+ "\334\326\337\315\001\200\000\000\370\333\024\312\377\177\000\000\222\036"
+ "29\377\177\000\000\321\030\352;\001\200\000\000\222\03629\001\200\000\000"
+ "\321\030\352;\377\177\000\000v\277\245\371\001\200\000\000e\300Y\363\377"
+ "\177\000\000e\300Y\363\001\200\000\000v\277\245\371\377\177\000\000\361\301"
+ "-\355\377\177\000\000\361\301-\355\001\200\000\000\026\304/\347\377\177\000"
+ "\000\026\304/\347\001\200\000\000\316\306n\341\377\177\000\000\316\306n\341"
+ "\001\200\000\00029n\341\377\177\000\000\3545\370\333\001\200\000\000\354"
+ "5\370\333\377\177\000\00029n\341\001\200\000\000\352;/\347\377\177\000\000"
+ "\352;/\347\001\200\000\000\024\312\370\333\377\177\000\000\024\312\370\333"
+ "\001\200\000\000&\277\000\000\001\200\000\000&\277\000\000\377\177\000\000"
+ "n\341\316\306\377\177\000\000/\347\026\304\001\200\000\000n\341\316\306\001"
+ "\200\000\000/\347\026\304\377\177\000\000v\277[\006\001\200\000\000v\277"
+ "[\006\377\177\000\000e\300\247\014\001\200\000\000e\300\247\014\377\177\000"
+ "\000\361\301\323\022\001\200\000\000\361\301\323\022\377\177\000\000\026"
+ "\304\321\030\001\200\000\000\026\304\321\030\377\177\000\000\316\306\222"
+ "\036\001\200\000\000\316\306\222\036\377\177\000\000\024\312\010$\001\200"
+ "\000\000\024\312\010$\377\177\000\000\337\315$)\001\200\000\000\337\315$"
+ ")\377\177\000\000%\322\333-\001\200\000\000%\322\333-\377\177\000\000\000"
+ "\000\332@\377\177\000\000\245\371\212@\001\200\000\000\000\000\332@\001\200"
+ "\000\000\245\371\212@\377\177\000\000Y\363\233\077\001\200\000\000Y\363\233"
+ "\077\377\177\000\000-\355\017>\001\200\000\000-\355\017>\377\177\000\000"
+ "/\347\352;\001\200\000\000/\347\352;\377\177\000\000\337\315\334\326\001"
+ "\200\000\000%\322%\322\377\177\000\000%\322%\322\001\200\000\000\337\315"
+ "\334\326\377\177\000\000n\34129\001\200\000\000n\34129\377\177\000\000\370"
+ "\333\3545\001\200\000\000\370\333\3545\377\177\000\000\334\326!2\001\200"
+ "\000\000\334\326!2\377\177\000\000\323\022\017>\001\200\000\000\323\022\017"
+ ">\377\177\000\000\247\014\233\077\001\200\000\000\247\014\233\077\377\177"
+ "\000\000[\006\212@\001\200\000\000[\006\212@\377\177\000\000$)!2\377\177"
+ "\000\000\010$\3545\001\200\000\000$)!2\001\200\000\000\010$\3545\377\177"
+ "\000\000\333-\333-\377\177\000\000\333-\333-\001\200\000\000!2$)\001\200"
+ "\000\000!2$)\377\177\000\000\352;\321\030\377\177\000\000\017>\323\022\001"
+ "\200\000\000\017>\323\022\377\177\000\000\352;\321\030\001\200\000\00029"
+ "\222\036\377\177\000\00029\222\036\001\200\000\000\3545\010$\377\177\000"
+ "\000\3545\010$\001\200\000\000\233\077\247\014\001\200\000\000\233\077\247"
+ "\014\377\177\000\000\247\014e\300\377\177\000\000\323\022\361\301\001\200"
+ "\000\000\247\014e\300\001\200\000\000\323\022\361\301\377\177\000\000[\006"
+ "v\277\377\177\000\000[\006v\277\001\200\000\000\212@\245\371\377\177\000"
+ "\000\233\077Y\363\001\200\000\000\233\077Y\363\377\177\000\000\212@\245\371"
+ "\001\200\000\000\332@\000\000\377\177\000\000\332@\000\000\001\200\000\000"
+ "\212@[\006\377\177\000\000\212@[\006\001\200\000\000\017>-\355\001\200\000"
+ "\000\017>-\355\377\177\000\000\010$\024\312\377\177\000\000$)\337\315\001"
+ "\200\000\000\010$\024\312\001\200\000\000$)\337\315\377\177\000\000\333-"
+ "%\322\001\200\000\000\333-%\322\377\177\000\000\222\036\316\306\377\177\000"
+ "\000\222\036\316\306\001\200\000\000\321\030\026\304\377\177\000\000\321"
+ "\030\026\304\001\200\000\000Y\363e\300\377\177\000\000\245\371v\277\001\200"
+ "\000\000Y\363e\300\001\200\000\000\245\371v\277\377\177\000\000\000\000&"
+ "\277\001\200\000\000\000\000&\277\377\177\000\000!2\334\326\001\200\000\000"
+ "!2\334\326\377\177\000\000-\355\361\301\001\200\000\000-\355\361\301\377"
+ "\177\000\000!2\334\326\001\200\000\000\377\177\001\200\001\200\000\000\333"
+ "-%\322\001\200\000\000\3545\370\333\001\200\000\000\377\177z\252\001\200"
+ "\000\000\377\177\001\200\001\200\000\000\377\177z\252\001\200\000\000\206"
+ "U\377\177\001\200\000\000$)!2\001\200\000\000\010$\3545\001\200\000\000\333"
+ "-\333-\001\200\000\000\377\177\377\177\001\200\000\000\377\177\377\177\001"
+ "\200\000\000\206U\377\177\001\200\000\000\201n\377\177\001\200\000\000[\006"
+ "v\277\001\200\000\000\000\000\001\200\001\200\000\000\000\000&\277\001\200"
+ "\000\000v\031\001\200\001\200\000\000\247\014e\300\001\200\000\000&\277\000"
+ "\000\001\200\000\000\001\200\212\346\001\200\000\000\001\200\000\000\001"
+ "\200\000\000v\277\245\371\001\200\000\000e\300Y\363\001\200\000\000%\322"
+ "%\322\001\200\000\000\177\221\001\200\001\200\000\000\001\200\001\200\001"
+ "\200\000\000z\252\001\200\001\200\000\000\334\326\337\315\001\200\000\000"
+ "\370\333\024\312\001\200\000\000\000\000\377\177\001\200\000\000Y\363\233"
+ "\077\001\200\000\000\212\346\377\177\001\200\000\000\245\371\212@\001\200"
+ "\000\000\000\000\332@\001\200\000\000\377\177v\031\001\200\000\000\212@["
+ "\006\001\200\000\000\233\077\247\014\001\200\000\000\332@\000\000\001\200"
+ "\000\000\377\177\000\000\001\200\000\000%\322\333-\001\200\000\000\001\200"
+ "\201n\001\200\000\000\001\200\377\177\001\200\000\000\337\315$)\001\200\000"
+ "\000\024\312\010$\001\200\000\000\001\200\206U\001\200\000\000\017>-\355"
+ "\001\200\000\000\377\177\373\312\001\200\000\000\352;/\347\001\200\000\000"
+ "\233\077Y\363\001\200\000\000\377\177\212\346\001\200\000\000\026\304\321"
+ "\030\001\200\000\000\001\200v\031\001\200\000\000\001\200\0055\001\200\000"
+ "\000\361\301\323\022\001\200\000\000e\300\247\014\001\200\000\000\026\304"
+ "/\347\001\200\000\000\001\200z\252\001\200\000\000\001\200\373\312\001\200"
+ "\000\000\316\306n\341\001\200\000\000\024\312\370\333\001\200\000\000/\347"
+ "\026\304\001\200\000\000\212\346\001\200\001\200\000\000\373\312\001\200"
+ "\001\200\000\000-\355\361\301\001\200\000\000Y\363e\300\001\200\000\000\222"
+ "\036\316\306\001\200\000\000\0055\001\200\001\200\000\000\321\030\026\304"
+ "\001\200\000\000\010$\024\312\001\200\000\000\206U\001\200\001\200\000\000"
+ "\377\177\206U\001\200\000\00029\222\036\001\200\000\000\3545\010$\001\200"
+ "\000\000\352;\321\030\001\200\000\000\377\177\0055\001\200\000\000v\031\377"
+ "\177\001\200\000\000\323\022\017>\001\200\000\000\247\014\233\077\001\200"
+ "\000\000\321\030\352;\001\200\000\000\0055\377\177\001\200\000\000\373\312"
+ "\377\177\001\200\000\000\370\333\3545\001\200\000\000z\252\377\177\001\200"
+ "\000\000n\34129\001\200\000\000/\347\352;\001\200\000\000\177\221\377\177"
+ "\001\200\000\000\334\326!2\001\200\000\000-\355\017>\001\200\000\000[\006"
+ "\212@\001\200\000\000\222\03629\001\200\000\000!2$)\001\200\000\000\377\177"
+ "\206U\001\200\000\000\377\177\201n\001\200\000\000\017>\323\022\001\200\000"
+ "\000\212@\245\371\001\200\000\00029n\341\001\200\000\000$)\337\315\001\200"
+ "\000\000\201n\001\200\001\200\000\000\323\022\361\301\001\200\000\000\245"
+ "\371v\277\001\200\000\000n\341\316\306\001\200\000\000\001\200\177\221\001"
+ "\200\000\000\337\315\334\326\001\200\000\000\361\301-\355\001\200\000\000"
+ "v\277[\006\001\200\000\000\316\306\222\036\001\200\000\000\024\312\010$\377"
+ "\177\000\000\001\200\201n\377\177\000\000\001\200\206U\377\177\000\000\001"
+ "\200\377\177\377\177\000\000\337\315$)\377\177\000\000%\322\333-\377\177"
+ "\000\00029\222\036\377\177\000\000\377\177\206U\377\177\000\000\3545\010"
+ "$\377\177\000\000\352;\321\030\377\177\000\000\377\177\0055\377\177\000\000"
+ "e\300Y\363\377\177\000\000\001\200\212\346\377\177\000\000v\277\245\371\377"
+ "\177\000\000\377\177\212\346\377\177\000\000\212@\245\371\377\177\000\000"
+ "\233\077Y\363\377\177\000\000\332@\000\000\377\177\000\000\377\177\000\000"
+ "\377\177\000\000\000\000\001\200\377\177\000\000Y\363e\300\377\177\000\000"
+ "\212\346\001\200\377\177\000\000\245\371v\277\377\177\000\000\000\000&\277"
+ "\377\177\000\000\177\221\377\177\377\177\000\000z\252\377\177\377\177\000"
+ "\000\334\326!2\377\177\000\000\370\333\3545\377\177\000\000\373\312\377\177"
+ "\377\177\000\000n\34129\377\177\000\000/\347\352;\377\177\000\000Y\363\233"
+ "\077\377\177\000\000\000\000\377\177\377\177\000\000\212\346\377\177\377"
+ "\177\000\000\245\371\212@\377\177\000\000\000\000\332@\377\177\000\000\377"
+ "\177z\252\377\177\000\00029n\341\377\177\000\000\3545\370\333\377\177\000"
+ "\000\352;/\347\377\177\000\000\377\177\373\312\377\177\000\000\026\304\321"
+ "\030\377\177\000\000\001\200\0055\377\177\000\000\316\306\222\036\377\177"
+ "\000\000\024\312\370\333\377\177\000\000\001\200\373\312\377\177\000\000"
+ "\001\200z\252\377\177\000\000\316\306n\341\377\177\000\000\026\304/\347\377"
+ "\177\000\000$)!2\377\177\000\000\206U\377\177\377\177\000\000\010$\3545\377"
+ "\177\000\000\333-\333-\377\177\000\000\377\177\377\177\377\177\000\000\377"
+ "\177\377\177\377\177\000\000\201n\377\177\377\177\000\000\212@[\006\377\177"
+ "\000\000\377\177v\031\377\177\000\000\233\077\247\014\377\177\000\000\206"
+ "U\001\200\377\177\000\000$)\337\315\377\177\000\000\010$\024\312\377\177"
+ "\000\000\333-%\322\377\177\000\000\377\177\001\200\377\177\000\000\377\177"
+ "\001\200\377\177\000\000\201n\001\200\377\177\000\000v\031\001\200\377\177"
+ "\000\000\323\022\361\301\377\177\000\000\247\014e\300\377\177\000\000\321"
+ "\030\026\304\377\177\000\000\0055\001\200\377\177\000\000-\355\017>\377\177"
+ "\000\000[\006\212@\377\177\000\000v\031\377\177\377\177\000\000\247\014\233"
+ "\077\377\177\000\000\222\036\316\306\377\177\000\000\323\022\017>\377\177"
+ "\000\000\321\030\352;\377\177\000\000\0055\377\177\377\177\000\000\017>-"
+ "\355\377\177\000\000!2\334\326\377\177\000\000\377\177z\252\377\177\000\000"
+ "\377\177\177\221\377\177\000\000\361\301\323\022\377\177\000\000!2$)\377"
+ "\177\000\000\377\177\206U\377\177\000\000\377\177\201n\377\177\000\000/\347"
+ "\026\304\377\177\000\000\373\312\001\200\377\177\000\000-\355\361\301\377"
+ "\177\000\000[\006v\277\377\177\000\000%\322%\322\377\177\000\000\001\200"
+ "\177\221\377\177\000\000\001\200\001\200\377\177\000\000\337\315\334\326"
+ "\377\177\000\000\370\333\024\312\377\177\000\000z\252\001\200\377\177\000"
+ "\000n\341\316\306\377\177\000\000\177\221\001\200\377\177\000\000\334\326"
+ "\337\315\377\177\000\000\017>\323\022\377\177\000\000\222\03629\377\177\000"
+ "\000\361\301-\355\377\177\000\000\177\221\001\200\000\000\000\000\001\200"
+ "\001\200\177\221\000\000\177\221\001\200\177\221\000\000\001\200\001\200"
+ "\000\000\000\000\177\221\001\200\201n\000\000\001\200\001\200\201n\000\000"
+ "\377\177\001\200\000\000\000\000\201n\001\200\000\000\000\000\201n\001\200"
+ "\377\177\000\000\000\000\001\200\201n\000\000\201n\001\200\201n\000\000\000"
+ "\000\001\200\377\177\000\000\000\000\001\200\377\177\000\000\201n\001\200"
+ "\377\177\000\000\206U\001\200\377\177\000\000\0055\001\200\377\177\000\000"
+ "\377\177\001\200\377\177\000\000\000\000\001\200\177\221\000\000\212\346"
+ "\001\200\001\200\000\000\000\000\001\200\001\200\000\000\373\312\001\200"
+ "\001\200\000\000z\252\001\200\001\200\000\000\177\221\001\200\001\200\000"
+ "\000\001\200\001\200\377\177\000\000\177\221\001\200\377\177\000\000\377"
+ "\177\001\200\201n\000\000\206U\001\200\001\200\000\000\201n\001\200\001\200"
+ "\000\000\0055\001\200\001\200\000\000v\031\001\200\001\200\000\000\177\221"
+ "\001\200\377\177\000\000\373\312\001\200\377\177\000\000z\252\001\200\377"
+ "\177\000\000\300\310\001\200@7\000\000\000\000\001\200\000\000\000\000\201"
+ "n\377\177\201n\000\000\377\177\377\177\000\000\000\000\201n\377\177\000\000"
+ "\000\000\377\177\377\177\201n\000\000\377\177\377\177\177\221\000\000\201"
+ "n\377\177\177\221\000\000\377\177\377\177\001\200\000\000\377\177\377\177"
+ "\377\177\000\000v\031\377\177\001\200\000\000\0055\377\177\001\200\000\000"
+ "\206U\377\177\001\200\000\000\001\200\377\177\377\177\000\000\177\221\377"
+ "\177\201n\000\000\001\200\377\177\201n\000\000\001\200\377\177\001\200\000"
+ "\000\177\221\377\177\000\000\000\000\001\200\377\177\000\000\000\000\001"
+ "\200\377\177\177\221\000\000\000\000\377\177\000\000\000\000\300\310\377"
+ "\177\300\310\000\000\177\221\377\177\377\177\000\000\000\000\377\177\201"
+ "n\000\000\000\000\377\177\377\177\000\000\000\000\377\177\377\177\000\000"
+ "\177\221\377\177\377\177\000\000\001\200\377\177\001\200\000\000\001\200"
+ "\201n\177\221\000\000\001\200\377\177\177\221\000\000\001\200\377\177\000"
+ "\000\000\000\001\200\201n\000\000\000\000\001\200\177\221\177\221\000\000"
+ "\001\200z\252\001\200\000\000\001\200\177\221\001\200\000\000\001\200\000"
+ "\000\177\221\000\000\001\200\373\312\001\200\000\000\001\200\212\346\001"
+ "\200\000\000\001\200\000\000\001\200\000\000\001\200\001\200\001\200\000"
+ "\000\001\200\377\177\201n\000\000\001\200\177\221\201n\000\000\001\200\001"
+ "\200\201n\000\000\001\200\001\200\377\177\000\000\001\200\177\221\377\177"
+ "\000\000\001\200\201n\001\200\000\000\001\200\001\200\000\000\000\000\001"
+ "\200\177\221\000\000\000\000\001\200v\031\377\177\000\000\001\200\000\000"
+ "\201n\000\000\001\200\000\000\377\177\000\000\001\200\0055\377\177\000\000"
+ "\001\200\206U\377\177\000\000\001\200z\252\377\177\000\000\001\200\373\312"
+ "\377\177\000\000\001\200\212\346\377\177\000\000\001\200v\031\001\200\000"
+ "\000\001\200\0055\001\200\000\000\001\200\206U\001\200\000\000\001\200\001"
+ "\200\177\221\000\000\377\177\001\200\177\221\000\000\377\177\001\200\000"
+ "\000\000\000\377\177\177\221\000\000\000\000\377\177\377\177\377\177\000"
+ "\000\377\177\201n\201n\000\000\377\177\377\177\201n\000\000\377\177\377\177"
+ "\000\000\000\000\377\177\201n\000\000\000\000\377\177\001\200\201n\000\000"
+ "\377\177\177\221\201n\000\000\377\177\377\177\177\221\000\000\377\177\201"
+ "n\177\221\000\000\377\177\001\200\377\177\000\000\377\177\377\177\001\200"
+ "\000\000\377\177v\031\001\200\000\000\377\177\000\000\177\221\000\000\377"
+ "\177\000\000\001\200\000\000\377\177\0055\001\200\000\000\377\177\206U\001"
+ "\200\000\000\377\177z\252\001\200\000\000\377\177\373\312\001\200\000\000"
+ "\377\177\212\346\001\200\000\000\377\177\000\000\201n\000\000\377\177z\252"
+ "\377\177\000\000\377\177\373\312\377\177\000\000\377\177\212\346\377\177"
+ "\000\000\377\177\000\000\377\177\000\000\377\177v\031\377\177\000\000\377"
+ "\177\0055\377\177\000\000\377\177\206U\377\177\000\000\300\310\377\177@7"
+ "\000\000@7\377\177\300\310\000\000@7\377\177@7\000\000@7\001\200@7\000\000"
+ "\300\310\001\200\300\310\000\000@7\001\200\300\310\000\000\001\200\001\200"
+ "\001\200\000\000\177\000\177\000\177\000\000\000\000\000\000\000\000\000"
+ "\000\000\201\000\201\000\201\000\000\201\000\201\000\201\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\1778G4K:E2M\325\254\332\247\323\256"
+ "\334\245r\015k\024h\027u\012c\034`\037[$Y&T+R-\256-\2632\2654\254+\247&\245"
+ "$M2K4}\002}\376+T&Y-R$[u\366r\363k\354h\351c\344`\341[\334Y\332T\325R\323"
+ "M\316K\314G\310E\306\077\300\077\300\002\203\012\213\376\203\015\216\024"
+ "\225\027\230\034\235\037\240$\245&\247E:@@@@G8+\254-\2562\2634\2658\271:"
+ "\273\341\240\344\235\351\230\354\225\363\216\366\213\310\271\314\265\306"
+ "\273\316\263\300\300\300\300\273\306\271\310\245\334\240\341\235\344\247"
+ "\332\254\325\256\323\263\316\265\314\230\351\225\354\351h\344c\354k\341`"
+ "\363r\366u\216\015\225\024\230\027\213\012\203\002\203\376\213\366\216\363"
+ "\235\034\240\037\314K\310G\316M\306E\300\077\300\077\323R\325T\332Y\334["
+ "\024k\015r\027h\012u\002}\376}\2718\273:\037`\034c\177\177\177\177\177\177"
+ "\177\177\177\177_\241\177I\177\177\177\177\177\177\177\177\177\177__U\177"
+ "\000\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177U\177\000\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000  \000\177\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000 \340\340\201\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000*\000\177\000\000\000\000\000*\000\177\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\177\177"
+ "\177\177\177\177\177\177\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\177\177"
+ "\177\177\177\177\000\201\000\201\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\0000\000L\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\000\177\000\177\000\177\000\201\000\201\000\201\000\201\000\000"
+ "\001\000\002\000\003\000\004\000\005\000\004\000\003\000\006\000\004\000"
+ "\006\000\007\000\010\000\011\000\012\000\013\000\014\000\015\000\016\000"
+ "\017\000\020\000\017\000\016\000\021\000\021\000\016\000\022\000\022\000"
+ "\016\000\023\000\023\000\016\000\024\000\025\000\026\000\027\000\026\000"
+ "\025\000\030\000\031\000\032\000\033\000\032\000\031\000\034\000\035\000"
+ "\036\000\037\000\036\000\035\000 \000\037\000!\000\042\000!\000\037\000\036"
+ "\000\042\000#\000$\000#\000\042\000!\000$\000%\000&\000%\000$\000#\000'\000"
+ "(\000)\000(\000'\000*\000+\000*\000'\000*\000+\000,\000&\000-\000.\000-\000"
+ "&\000%\000/\000 \000\035\000 \000/\0000\0001\0002\0003\0002\0001\0004\000"
+ "5\0000\000/\0000\0005\0006\0007\0006\0005\0006\0007\0008\0009\0008\0007\000"
+ "8\0009\000:\000;\000:\0009\000:\000;\000<\000=\000<\000;\000<\000=\000>\000"
+ "\077\000>\000=\000>\000\077\000@\000A\000@\000\077\000@\000A\000B\000C\000"
+ "B\000A\000B\000C\000D\000E\000F\000G\000F\000E\000H\000H\000I\000F\000I\000"
+ "H\000J\000J\000K\000I\000K\000J\000L\000L\000M\000K\000M\000L\000N\000O\000"
+ "P\000Q\000P\000O\000R\000N\000S\000M\000S\000N\000T\000T\000U\000S\000U\000"
+ "T\000V\000V\000W\000U\000W\000V\000X\000X\000C\000W\000C\000X\000D\000\034"
+ "\000Y\000\032\000Y\000\034\000Z\000Z\000[\000Y\000[\000Z\000\134\000\134"
+ "\000]\000[\000]\000\134\000^\000^\000G\000]\000G\000^\000E\000_\000`\000"
+ "a\000`\000_\000b\000b\000\033\000`\000\033\000b\000\031\000c\000a\000d\000"
+ "a\000c\000_\000c\000e\000f\000e\000c\000d\000g\000h\000i\000h\000g\000j\000"
+ "k\000j\000g\000j\000k\000l\000m\000l\000k\000l\000m\000n\000f\000n\000m\000"
+ "n\000f\000e\000i\000o\000p\000o\000i\000h\000q\000r\000s\000r\000q\000t\000"
+ "u\000s\000v\000s\000u\000q\000w\000x\000y\000x\000w\000z\000{\000z\000w\000"
+ "z\000{\000|\000}\000|\000{\000|\000}\000~\000p\000~\000}\000~\000p\000o\000"
+ ".\000R\000O\000R\000.\000-\000P\000\027\000Q\000\027\000P\000\025\000y\000"
+ "\177\000\200\000\177\000y\000x\000\030\0003\000\026\0003\000\030\0001\000"
+ "\201\000\202\000\203\000\202\000\201\000\204\000\204\000\205\000\202\000"
+ "\205\000\204\000\206\000\200\000,\000+\000,\000\200\000\177\000\207\000\203"
+ "\000\210\000\203\000\207\000\201\000\211\000\210\000\212\000\210\000\211"
+ "\000\207\000\213\000\214\000\215\000\214\000\213\000\216\000\216\000\217"
+ "\000\214\000\217\000\216\000\220\000)\000\221\000\222\000\221\000)\000(\000"
+ "4\000\223\0002\000\223\0004\000\224\000\224\000\215\000\223\000\215\000\224"
+ "\000\213\000t\000\212\000r\000\212\000t\000\211\000\222\000\205\000\206\000"
+ "\205\000\222\000\221\000\220\000v\000\217\000v\000\220\000u\000\225\000\226"
+ "\000\227\000\226\000\225\000\230\000\226\000\230\000\231\000\232\000\233"
+ "\000\002\000\234\000\235\000\236\000\235\000\234\000\237\000\237\000\234"
+ "\000\240\000\241\000\242\000\243\000\244\000\245\000\246\000\245\000\244"
+ "\000\247\000\247\000\244\000\250\000\251\000\252\000\253\000\252\000\251"
+ "\000\254\000\252\000\254\000\255\000\256\000\257\000\260\000\257\000\256"
+ "\000\261\000\261\000\256\000\262\000\261\000\262\000\263\000\264\000\265"
+ "\000\266\000\265\000\264\000\267\000\267\000\264\000\270\000\271\000\272"
+ "\000\273\000\272\000\271\000\274\000\274\000\271\000\275\000\276\000\277"
+ "\000\300\000\277\000\276\000\301\000\277\000\301\000\302\000\302\000\303"
+ "\000\277\000\304\000\305\000\306\000\305\000\304\000\307\000\305\000\307"
+ "\000\310\000\311\000\312\000\313\000\312\000\311\000\314\000\312\000\314"
+ "\000\315\000\316\000\317\000\320\000\317\000\316\000\321\000\317\000\321"
+ "\000\322\000\323\000\324\000\325\000\324\000\323\000\326\000\324\000\326"
+ "\000\327\000\330\000\331\000\332\000\331\000\330\000\333\000\331\000\333"
+ "\000\334\000\335\000\336\000\337\000\336\000\335\000\340\000\340\000\335"
+ "\000\341\000\342\000\343\000\344\000\343\000\342\000\345\000\345\000\342"
+ "\000\346\000\347\000\350\000\351\000\350\000\347\000\352\000\352\000\347"
+ "\000\353\000\354\000\276\000\300\000\276\000\354\000\351\000\276\000\351"
+ "\000\355\000\355\000\351\000\350\000\266\000\353\000\347\000\353\000\266"
+ "\000\356\000\356\000\266\000\265\000\264\000\357\000\270\000\357\000\264"
+ "\000\342\000\357\000\342\000\344\000\346\000\360\000\345\000\360\000\346"
+ "\000\236\000\236\000\346\000\234\000\240\000\361\000\237\000\361\000\240"
+ "\000\337\000\337\000\240\000\335\000\362\000\241\000\363\000\341\000\364"
+ "\000\340\000\364\000\341\000\273\000\273\000\341\000\271\000\365\000\310"
+ "\000\307\000\310\000\365\000\274\000\310\000\274\000\275\000\366\000\231"
+ "\000\230\000\231\000\366\000\306\000\231\000\306\000\305\000\367\000\334"
+ "\000\333\000\334\000\367\000\227\000\334\000\227\000\370\000\370\000\227"
+ "\000\226\000\371\000\247\000\250\000\247\000\371\000\332\000\247\000\332"
+ "\000\331\000\327\000\245\000\324\000\245\000\327\000\372\000\245\000\372"
+ "\000\246\000\263\000\325\000\261\000\325\000\263\000\373\000\325\000\373"
+ "\000\323\000\322\000\374\000\317\000\374\000\322\000\260\000\260\000\322"
+ "\000\375\000\260\000\375\000\256\000\252\000\316\000\320\000\316\000\252"
+ "\000\376\000\376\000\252\000\255\000\315\000\253\000\312\000\253\000\315"
+ "\000\377\000\253\000\377\000\251\000\302\000\313\000\303\000\313\000\302"
+ "\000\000\001\313\000\000\001\311\000\001\001\002\001\003\001\002\001\001"
+ "\001\004\001\004\001\001\001\005\001\004\001\005\001\006\001\007\001\010"
+ "\001\011\001\010\001\007\001\012\001\010\001\012\001\013\001\014\001\005"
+ "\000\015\001\005\000\014\001\016\001\005\000\016\001\003\000\017\001\020"
+ "\001\021\001\020\001\017\001\022\001\022\001\017\001\023\001\024\001\025"
+ "\001\026\001\025\001\024\001\027\001\027\001\024\001\030\001\006\001\031"
+ "\001\004\001\031\001\006\001\032\001\032\001\006\001\033\001\032\001\033"
+ "\001\034\001\034\001\035\001\032\001\035\001\034\001\036\001\035\001\036"
+ "\001\037\001 \001!\001\042\001!\001 \001#\001!\001#\001$\001%\001&\001'\001"
+ "&\001%\001(\001(\001%\001)\001*\001\003\001+\001\003\001*\001,\001\003\001"
+ ",\001\001\001-\001.\001/\001.\001-\0010\001.\0010\0011\0012\0013\0014\001"
+ "3\0012\0015\0013\0015\0016\0013\0017\0018\0019\001:\001;\001:\0019\001\022"
+ "\001:\001\022\001\023\001<\001=\001>\001=\001<\001\077\001\077\001<\001@"
+ "\001A\001<\001B\001C\001D\001E\001D\001C\001F\001F\001C\001G\001\037\001"
+ "\042\001\035\001\042\001\037\001H\001\042\001H\001 \001I\001!\001$\001!\001"
+ "I\001J\001J\001I\001K\001G\001L\001F\001L\001G\001>\001>\001G\001<\001M\001"
+ "J\001K\001J\001M\001N\001J\001N\001O\001)\001P\001(\001P\001)\001\021\001"
+ "\021\001)\001\017\001@\001Q\001\077\001Q\001@\001'\001'\001@\001%\001R\001"
+ "A\001S\001\007\000+\001\004\000+\001\007\000T\001+\001T\001*\001U\0016\001"
+ "5\0016\001U\001\011\0016\001\011\001\010\0017\001V\001W\001\026\001X\001"
+ "Y\001X\001\026\001Z\001Z\001\026\001\025\001C\001\030\001\024\001\030\001"
+ "C\001[\001[\001C\001E\001\134\001]\001^\001]\001\134\001/\001/\001\134\001"
+ "_\001/\001_\001-\001Y\001`\001a\001`\001Y\001b\001b\001Y\001X\001c\001\134"
+ "\001^\001\134\001c\001a\001\134\001a\001d\001d\001a\001`\001e\001\013\001"
+ "\012\001\013\001e\001;\001\013\001;\001:\001f\001O\001N\001O\001f\0014\001"
+ "O\0014\0013\0011\001\015\001.\001\015\0011\001g\001\015\001g\001\014\001"
+ "h\001i\001j\001i\001h\001k\001l\001k\001h\001k\001l\001m\001n\001\013\000"
+ "\015\000\013\000n\001o\001p\001q\001r\001q\001p\001s\001t\001u\001v\001t"
+ "\001v\001w\001\024\001G\001C\001p\001r\001x\001y\001z\001{\001z\001y\001"
+ "|\001|\001y\001}\001}\001y\001~\001~\001y\001j\001\177\001l\001\200\001\201"
+ "\001o\001n\001o\001\201\001r\001\013\000\202\001\203\001\202\001\013\000"
+ "\204\001\204\001\013\000\205\001\205\001\013\000{\001{\001\013\000y\001s"
+ "\001l\001q\001l\001s\001\200\001c\001\024\001\026\001c\001\026\001Y\001\206"
+ "\001\207\001\210\001q\001\211\001\212\001\213\001\214\001\215\001\214\001"
+ "\213\001\216\001\215\001\217\001\220\001\217\001\215\001\214\001\220\001"
+ "\221\001\243\000\222\001\216\001\213\001\024\000\223\001\023\000\223\001"
+ "\024\000\224\001\224\001\024\000\225\001\225\001\024\000\243\000\243\000"
+ "\024\000\220\001\226\001\227\001\230\001\016\000\020\000\231\001\230\001"
+ "\232\001\233\001\232\001\230\001\227\001\233\001\016\000\234\001\016\000"
+ "\233\001\232\001\235\001\024\000\236\001\237\001\240\001\227\001\240\001"
+ "\237\001\241\001\242\001\243\001\032\001\242\001\032\001\035\001\242\001"
+ "\035\001\042\001\241\001\213\001\240\001\213\001\241\0018\0018\001\242\001"
+ "J\0018\001J\001O\0018\001O\0013\001\244\001\245\001\246\001\247\001\245\001"
+ "\250\001\245\001\247\001\246\001\251\001\252\001\253\001\252\001\251\001"
+ "\254\001\252\001\254\001\255\001\255\001\254\001\256\001\256\001\254\001"
+ "\257\001\251\001\253\001\260\001\261\001\250\001\011\000\250\001\261\001"
+ "\247\001\261\001\011\000\010\000\262\001\263\001\264\001\262\001\264\001"
+ "\265\001\244\001\266\001\245\001\262\001\267\001\263\001\267\001\262\001"
+ "\270\001\271\001\272\001\273\001\272\001\271\001\011\000\011\000\271\001"
+ "\274\001\011\000\274\001\275\001\011\000\275\001\012\000\276\001\262\001"
+ "\265\001\262\001\276\001\272\001\272\001\276\001\277\001\272\001\277\001"
+ "\300\001\272\001\300\001\273\001\245\001\257\001\254\001\257\001\245\001"
+ "\301\001\301\001\245\001\302\001\302\001\245\001\303\001\303\001\245\001"
+ "\266\001\251\001\260\001\304\001\270\001\304\001\267\001\304\001\270\001"
+ "\251\001\272\001\270\001\262\001\270\001\272\001\251\001\251\001\272\001"
+ "\254\001\254\001\272\001\011\000\254\001\011\000\245\001\245\001\011\000"
+ "\250\001\000\000\305\001\001\000\000\000\306\001\305\001\306\001\000\000"
+ "\307\001\310\001\311\001\312\001\313\001\311\001\314\001\311\001\313\001"
+ "\312\001\307\001\315\001\306\001\315\001\307\001\316\001\317\001\314\001"
+ "\320\001\314\001\317\001\313\001S\001\321\001\316\001\316\001\321\001\315"
+ "\001\317\001\320\001\322\001\323\001\324\001\325\001\324\001\323\001\320"
+ "\001\320\001\323\001\326\001\320\001\326\001\327\001\320\001\327\001\363"
+ "\000\322\001\320\001\363\000\330\001\000\000\002\000\000\000\330\001\324"
+ "\001\324\001\330\001\331\001\324\001\331\001\332\001\324\001\332\001\325"
+ "\001\310\001W\001\311\001\333\001S\001\316\001S\001\333\001\334\001\334\001"
+ "\333\001\335\001\335\001\333\001\336\001\336\001\333\001\337\001\311\001"
+ "\337\001\333\001\337\001\311\001\340\001\340\001\311\001\341\001\341\001"
+ "\311\001\342\001\342\001\311\001W\001\324\001\307\001\000\000\307\001\333"
+ "\001\316\001\333\001\307\001\324\001\333\001\324\001\320\001\333\001\320"
+ "\001\311\001\311\001\320\001\314\001\343\001\235\001\232\001\236\001\024"
+ "\000\016\000\344\001\220\001\024\000\227\001\343\001\232\001\345\001\215"
+ "\001\235\001\235\001\344\001\024\000q\001\212\001\346\001l\001\211\001q\001"
+ "q\001\346\001r\001h\001\347\001\212\001\212\001\350\001o\001\347\001j\001"
+ "y\001j\001\351\001~\001\212\001\347\001y\001r\001\346\001o\001o\001\350\001"
+ "\013\000x\001r\001\201\001\346\001\212\001o\001\350\001y\001\013\000\212"
+ "\001y\001\350\001\013\000\203\001\014\000\177\001m\001l\001l\001h\001\211"
+ "\001h\001j\001\347\001i\001\351\001j\001\211\001h\001\212\001\217\001\221"
+ "\001\220\001\240\001\235\001\343\001\213\001\215\001\345\001\215\001\344"
+ "\001\235\001\237\001\227\001\226\001\215\001\220\001\344\001\222\001\213"
+ "\0018\001\240\001\345\001\235\001\016\000\231\001\234\001\232\001\236\001"
+ "\016\000\213\001\345\001\240\001\240\001\343\001\227\001\235\001\236\001"
+ "\232\001\000\000\001\000\001\000\002\000\000\000\002\000\003\000\004\000"
+ "\004\000\005\000\003\000\005\000\003\000\006\000\004\000\006\000\006\000"
+ "\007\000\004\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000"
+ "\001\000\013\000\001\000\015\000\013\000\015\000\016\000\017\000\017\000"
+ "\020\000\016\000\020\000\016\000\021\000\017\000\021\000\016\000\022\000"
+ "\021\000\022\000\016\000\023\000\022\000\023\000\016\000\024\000\023\000"
+ "\024\000\025\000\026\000\026\000\027\000\025\000\027\000\025\000\030\000"
+ "\026\000\030\000\031\000\032\000\032\000\033\000\031\000\033\000\031\000"
+ "\034\000\032\000\034\000\035\000\036\000\036\000\037\000\035\000\037\000"
+ "\035\000 \000\036\000 \000\037\000!\000!\000\042\000\037\000\042\000\036"
+ "\000!\000\042\000#\000#\000$\000\042\000$\000!\000#\000$\000%\000%\000&\000"
+ "$\000&\000#\000%\000'\000(\000(\000)\000'\000)\000'\000*\000(\000*\000*\000"
+ "+\000'\000+\000+\000,\000*\000,\000&\000-\000-\000.\000&\000.\000%\000-\000"
+ " \000/\000\035\000/\000\003\000/\000\003\000 \0001\0002\0002\0003\0001\000"
+ "3\0001\0004\0002\0004\000\003\0005\000/\0005\000\006\0005\000\006\0007\000"
+ "5\0007\000\007\0007\000\007\0009\0007\0009\0009\000:\000\007\000:\000:\000"
+ ";\0009\000;\000;\000<\000:\000<\000<\000=\000;\000=\000=\000>\000<\000>\000"
+ ">\000\077\000=\000\077\000\077\000@\000>\000@\000@\000A\000\077\000A\000"
+ "A\000B\000@\000B\000B\000C\000A\000C\000C\000D\000B\000D\000E\000F\000F\000"
+ "G\000E\000G\000E\000H\000F\000H\000H\000I\000F\000I\000H\000J\000I\000J\000"
+ "J\000K\000I\000K\000J\000L\000K\000L\000L\000M\000K\000M\000L\000N\000M\000"
+ "N\000O\000P\000P\000Q\000O\000Q\000O\000R\000P\000R\000N\000S\000M\000S\000"
+ "N\000T\000S\000T\000T\000U\000S\000U\000T\000V\000U\000V\000V\000W\000U\000"
+ "W\000V\000X\000W\000X\000C\000X\000C\000W\000D\000X\000\034\000Y\000\032"
+ "\000Y\000\034\000Z\000Y\000Z\000Z\000[\000Y\000[\000Z\000\134\000[\000\134"
+ "\000\134\000]\000[\000]\000\134\000^\000]\000^\000G\000^\000G\000]\000E\000"
+ "^\000_\000`\000`\000a\000_\000a\000_\000b\000`\000b\000\033\000b\000\033"
+ "\000`\000\031\000b\000a\000c\000a\000d\000c\000d\000_\000c\000c\000e\000"
+ "e\000f\000c\000f\000d\000e\000g\000h\000h\000i\000g\000i\000g\000j\000h\000"
+ "j\000j\000k\000g\000k\000k\000l\000j\000l\000l\000m\000k\000m\000m\000n\000"
+ "l\000n\000f\000n\000f\000m\000e\000n\000i\000o\000o\000p\000i\000p\000h\000"
+ "o\000q\000r\000r\000s\000q\000s\000q\000t\000r\000t\000s\000u\000s\000v\000"
+ "u\000v\000q\000u\000w\000x\000x\000y\000w\000y\000w\000z\000x\000z\000z\000"
+ "{\000w\000{\000{\000|\000z\000|\000|\000}\000{\000}\000}\000~\000|\000~\000"
+ "p\000~\000p\000}\000o\000~\000.\000R\000.\000O\000-\000R\000\027\000P\000"
+ "\027\000Q\000\025\000P\000y\000\177\000\177\000\200\000y\000\200\000x\000"
+ "\177\000\030\0003\000\026\0003\000\030\0001\000\201\000\202\000\202\000\203"
+ "\000\201\000\203\000\201\000\204\000\202\000\204\000\204\000\205\000\202"
+ "\000\205\000\204\000\206\000\205\000\206\000,\000\200\000+\000\200\000,\000"
+ "\177\000\203\000\207\000\203\000\210\000\207\000\210\000\201\000\207\000"
+ "\210\000\211\000\210\000\212\000\211\000\212\000\207\000\211\000\213\000"
+ "\214\000\214\000\215\000\213\000\215\000\213\000\216\000\214\000\216\000"
+ "\216\000\217\000\214\000\217\000\216\000\220\000\217\000\220\000)\000\221"
+ "\000\221\000\222\000)\000\222\000(\000\221\0004\000\223\0002\000\223\000"
+ "4\000\224\000\223\000\224\000\215\000\224\000\215\000\223\000\213\000\224"
+ "\000t\000\212\000r\000\212\000t\000\211\000\205\000\222\000\206\000\222\000"
+ "\205\000\221\000v\000\220\000v\000\217\000u\000\220\000\001\000\221\000\001"
+ "\000\205\000\001\000(\000(\000\231\000\001\000\231\000\002\000\231\000a\000"
+ "\234\000`\000\234\000d\000\234\000\234\000\240\000d\000\240\000\234\000\243"
+ "\000\240\000\243\000v\000\245\000\217\000\245\000v\000\247\000\245\000\247"
+ "\000s\000\247\000/\000\252\000\252\000\253\000/\000\253\000\035\000\252\000"
+ "\037\000\252\000Q\000\257\000\257\000\260\000Q\000\260\000Q\000\261\000\257"
+ "\000\261\000\027\000\261\000\026\000\261\000\023\000I\000\022\000I\000\023"
+ "\000F\000\023\000G\000~\000\271\000o\000\271\000|\000\271\000\271\000\275"
+ "\000|\000\275\000C\000\277\000\277\000\300\000C\000\300\000A\000\277\000"
+ "\077\000\277\000\077\000\303\000\277\000\303\000\177\000\305\000,\000\305"
+ "\000x\000\305\000x\000\310\000\305\000\310\000;\000\312\000\312\000\313\000"
+ ";\000\313\0009\000\312\0007\000\312\000$\000\317\000\317\000\320\000$\000"
+ "\320\000&\000\317\000.\000\317\0002\000\324\000\324\000\325\0002\000\325"
+ "\000\223\000\324\000\215\000\324\000\210\000\331\000\212\000\331\000\203"
+ "\000\331\000\203\000\334\000\331\000\334\000l\000\335\000n\000\335\000j\000"
+ "\335\000\335\000\341\000j\000\341\000Y\000\342\000[\000\342\000\032\000\342"
+ "\000\342\000\346\000\032\000\346\000\021\000U\000\017\000U\000\021\000S\000"
+ "\021\000M\000\020\000C\000\020\000\300\000\017\000C\000\017\000W\000\022"
+ "\000M\000\022\000K\000\023\000]\000\023\000\342\000]\000\342\000\033\000"
+ "\346\000`\000\346\000\234\000\346\000e\000\240\000n\000\240\000\240\000\335"
+ "\000\240\000\363\000\335\000\363\000h\000\341\000o\000\341\000\271\000\341"
+ "\000z\000\310\000|\000\310\000\275\000\310\000*\000\231\000,\000\231\000"
+ "\231\000\305\000\202\000\334\000\205\000\334\000\205\000\370\000\334\000"
+ "\370\000\001\000\370\000r\000\247\000\212\000\247\000\247\000\331\000\215"
+ "\000\245\000\245\000\324\000\214\000\245\000\026\000\325\000\261\000\325"
+ "\0003\000\325\000.\000\374\000\317\000\374\000.\000\260\000\260\000\374\000"
+ "O\000\260\000$\000\252\000\252\000\320\000\042\000\252\0007\000\253\000\253"
+ "\000\312\0005\000\253\000\077\000\313\000\303\000\313\000=\000\313\000\012"
+ "\000@\000\012\000\003\001@\000\003\001\010\000@\000\010\000B\000\010\000"
+ "D\000k\000\010\001m\000\010\001g\000\010\001g\000\013\001\010\001\013\001"
+ "\005\000\036\000\005\000\015\001\036\000\015\001\005\000 \000w\000\017\001"
+ "y\000\017\001{\000\017\001\017\001\023\001{\000\023\001\213\000\024\001\213"
+ "\000\026\001\024\001\026\001\216\000\024\001\220\000\024\001D\000\031\001"
+ "\010\000\031\001D\000\032\001\031\001\032\001X\000\032\001V\000\032\001V"
+ "\000\035\001\032\001\035\001T\000\035\001N\000\035\001J\000!\001!\001\042"
+ "\001J\000\042\001H\000!\001E\000!\001'\000%\001)\000%\001+\000%\001%\001"
+ ")\001+\000)\001<\000\003\001\003\001+\001<\000+\001>\000\003\001-\000.\001"
+ ".\001/\001-\000/\001%\000.\001#\000.\001_\0003\001b\0003\001c\0003\001c\000"
+ "6\0013\0016\0016\0018\0013\0018\001}\000:\001p\000:\001{\000:\001\023\001"
+ ":\001\204\000<\001\201\000<\001\206\000<\001<\001@\001\206\000@\001<\001"
+ "B\001@\001B\001t\000C\001q\000C\001\211\000C\001C\001G\001\211\000G\001N"
+ "\000\042\001\035\001\042\001L\000\042\001^\000!\001^\000J\001!\001J\001\134"
+ "\000J\001\207\000G\001\201\000G\001<\001G\001Z\000J\001\034\000J\001\034"
+ "\000O\001J\001O\001\200\000)\001y\000)\001\017\001)\001\222\000@\001)\000"
+ "@\001%\001@\001@\001S\001%\001S\001\007\000+\001\004\000+\001:\000+\001f"
+ "\0006\001m\0006\001\010\0016\001\010\001W\0016\001W\0014\000\026\0014\000"
+ "Y\001\026\001Y\001\224\000\026\001\220\000C\001\024\001C\001u\000C\001P\000"
+ "]\001]\001^\001P\000^\001P\000/\001/\001]\001R\000/\001\030\000Y\001\030"
+ "\000a\001Y\001a\0011\000Y\001P\000c\001^\001c\001a\001c\001P\000a\001\025"
+ "\000a\001i\000\013\001p\000\013\001\013\001:\001\031\000O\001b\000O\0013"
+ "\001O\001#\000\015\001\015\001.\001!\000\015\001h\001i\001i\001j\001h\001"
+ "j\001h\001k\001i\001k\001k\001l\001h\001l\001l\001m\001k\001m\001\013\000"
+ "n\001\015\000n\001n\001o\001\013\000o\001B\001q\001q\001r\001B\001r\001\024"
+ "\001B\001\024\001q\001\024\001<\001\024\001G\001@\001r\001\324\000y\001\245"
+ "\000y\001\325\000y\001\261\000y\001\257\000y\001j\001y\001\257\000j\001^"
+ "\001l\001c\001l\001o\001\201\001n\001\201\001r\001\201\001o\001r\001\013"
+ "\000\334\000\013\000\370\000\013\000\331\000\013\000\247\000\013\000\245"
+ "\000\013\000y\001\024\001l\001l\001q\001\024\001c\001\026\001c\001Y\001c"
+ "\001q\001\211\001\211\001\212\001q\001\212\001\213\001\214\001\214\001\215"
+ "\001\213\001\215\001\213\001\216\001\214\001\216\001\215\001\217\001\217"
+ "\001\220\001\215\001\220\001\214\001\217\001\240\000\220\001\243\000\220"
+ "\0016\001\216\0016\001\213\001\024\000\342\000\024\000\346\000\024\000\234"
+ "\000\024\000\243\000\024\000\220\001\010\000\227\001\227\001\230\001\010"
+ "\000\230\001\016\000\300\000\230\001\232\001\232\001\233\001\230\001\233"
+ "\001\227\001\232\001\016\000\233\001\016\000\234\001\233\001\234\001\016"
+ "\000\232\001\024\000\235\001\024\000\236\001\235\001\236\001\031\001\240"
+ "\001\227\001\240\001\031\001\227\001\031\001!\001!\001\240\001\032\001!\001"
+ "\035\001!\001!\001\213\001\213\001\240\001!\0018\0018\001\213\0018\001J\001"
+ "8\001O\001\300\000\245\001\234\001\245\001\300\000\234\001\233\001\245\001"
+ "\245\001\250\001\233\001\250\001\317\000\251\001\374\000\251\001\251\001"
+ "\254\001\317\000\254\001\320\000\254\001\252\000\254\001\253\000\254\001"
+ "\260\000\251\001\230\001\250\001\011\000\250\001\011\000\230\001m\001\262"
+ "\001^\001m\001^\001\262\001]\001\262\001\277\000\245\001k\001\262\001\262"
+ "\001\270\001k\001\270\001\004\000\272\001\005\000\272\001\004\000\011\000"
+ "\011\000\272\001\011\000+\001\011\000\003\001/\001\262\001/\001\272\001\262"
+ "\001\272\001.\001\272\001\015\001\272\001\253\000\245\001\245\001\254\001"
+ "\312\000\245\001\313\000\245\001\303\000\245\001\260\000i\001i\001\251\001"
+ "i\001\270\001\251\001\270\001\270\001\272\001\251\001\272\001\254\001\272"
+ "\001\011\000\254\001\011\000\245\001\000\000\015\000\000\000n\001\000\000"
+ "\307\001n\001\307\0016\001\311\001\216\001\311\001\214\001\311\001\311\001"
+ "\314\001\214\001\314\001\201\001\307\001\307\001\316\001\201\001\316\001"
+ "\217\001\314\001\314\001\320\001\217\001\320\001@\001\316\001S\001\316\001"
+ "@\001\201\001\240\000\320\001\240\000\217\001\271\000\324\001\275\000\324"
+ "\001\271\000\320\001\320\001\324\001\341\000\320\001\335\000\320\001\363"
+ "\000\320\001\000\000\231\000\231\000\324\001\000\000\324\001\305\000\324"
+ "\001\310\000\324\001W\001\311\001S\001\333\001\316\001\333\001%\001\333\001"
+ ")\001\333\001\017\001\333\001\023\001\333\001\023\001\311\001\311\001\333"
+ "\001:\001\311\001\013\001\311\001\010\001\311\001\307\001\324\001\307\001"
+ "\333\001\324\001\333\001\320\001\333\001\311\001\320\001\235\001\343\001"
+ "\232\001\235\001\232\001\343\001\016\000\236\001\220\001\344\001\024\000"
+ "\344\001\227\001\343\001\215\001\345\001\215\001\235\001\235\001\345\001"
+ "\235\001\344\001\212\001\346\001q\001\346\001l\001\211\001r\001\346\001h"
+ "\001\347\001\212\001\347\001h\001\212\001\212\001\350\001o\001\350\001o\001"
+ "\212\001j\001\347\001y\001\347\001\260\000j\001y\001\212\001o\001\346\001"
+ "\013\000\350\001y\001\350\001h\001\211\001\235\001\240\001\240\001\343\001"
+ "\213\001\345\001\215\001\344\001\240\001\345\001\232\001\236\001\212\321"
+ "\212\321\001\200\000\000\177\221\001\200\001\200\000\000\001\200\001\200"
+ "\001\200\000\000z\252\001\200\001\200\000\000Q\3266\315\001\200\000\000\177"
+ "\333^\311\001\200\000\000\206U\377\177\001\200\000\000\257)\3122\001\200"
+ "\000\000\201$\2426\001\200\000\000v.v.\001\200\000\000\377\177\377\177\001"
+ "\200\000\000\377\177\377\177\001\200\000\000\206U\377\177\001\200\000\000"
+ "\201n\377\177\001\200\000\000\377\177v\031\001\200\000\000cAq\006\001\200"
+ "\000\000q@\321\014\001\200\000\000\264A\000\000\001\200\000\000\377\177\000"
+ "\000\001\200\000\000\000\000\377\177\001\200\000\000/\363q@\001\200\000\000"
+ "\212\346\377\177\001\200\000\000\217\371cA\001\200\000\000\000\000\264A\001"
+ "\200\000\000\212\321v.\001\200\000\000\001\200\206U\001\200\000\000\001\200"
+ "\377\177\001\200\000\0006\315\257)\001\200\000\000^\311\201$\001\200\000"
+ "\000\3122Q\326\001\200\000\000\377\177\001\200\001\200\000\000v.\212\321"
+ "\001\200\000\000\2426\177\333\001\200\000\000\377\177z\252\001\200\000\000"
+ "\0055\001\200\204\306\000\000\000\000\001\200\201n\000\000\000\000\001\200"
+ "\177\221\000\000\0055\001\200|9\000\000v\031\001\200\377\177\000\000\023"
+ "\023 \301\377\177\000\000\321\014\217\277\377\177\000\000%\031L\303\377\177"
+ "\000\000\0055\001\200\377\177\000\000\373\312\377\177\377\177\000\000\000"
+ "\000\377\177\201n\000\000\373\312\377\177\201n\000\000\212\346\377\177\377"
+ "\177\000\000\000\000\377\177\377\177\000\000\373\312\001\200\377\177\000"
+ "\000\177\333^\311\377\177\000\000z\252\001\200\377\177\000\000\007\341\016"
+ "\306\377\177\000\000\333\346L\303\377\177\000\000\377\177v\031\001\200\000"
+ "\000\377\177\000\000\377\177\000\000\377\177\000\000\001\200\000\000\377"
+ "\177v\031\377\177\000\000\377\177\0055\001\200\000\000\377\177\0055\377\177"
+ "\000\000\001\200\212\346\377\177\000\000\001\200\373\312\001\200\000\000"
+ "\001\200\373\312\377\177\000\000\001\200\212\346\001\200\000\000\001\200"
+ "\000\000\377\177\000\000\001\200\000\000\001\200\000\000\340>\023\023\377"
+ "\177\000\000\377\177\0055\377\177\000\000\264<%\031\377\177\000\000q@\321"
+ "\014\377\177\000\000\377\177v\031\377\177\000\000q\006\235\276\001\200\000"
+ "\000\000\000\001\200\001\200\000\000\000\000L\276\001\200\000\000v\031\001"
+ "\200\001\200\000\000\321\014\217\277\001\200\000\000\377\177z\252\377\177"
+ "\000\000\3629\007\341\377\177\000\000\2426\177\333\377\177\000\000\264<\333"
+ "\346\377\177\000\000\377\177\373\312\377\177\000\000L\303\333\346\377\177"
+ "\000\000\001\200\212\346\377\177\000\000\001\200\373\312\377\177\000\000"
+ " \301\355\354\377\177\000\000\217\277/\363\377\177\000\000L\276\000\000\001"
+ "\200\000\000\001\200\212\346\001\200\000\000\001\200\000\000\001\200\000"
+ "\000\235\276\217\371\001\200\000\000\217\277/\363\001\200\000\000\177\221"
+ "\001\200\201n\000\000\001\200\001\200\000\000\000\000\177\221\001\200\000"
+ "\000\000\000\001\200\001\200\201n\000\000\001\200\206U\377\177\000\000\001"
+ "\200\0055\001\200\000\000\001\200\0055\377\177\000\000\001\200\206U\001\200"
+ "\000\000\001\200\377\177\377\177\000\000\001\200\377\177\001\200\000\000"
+ "\000\000\000\000\001\200\000\000\333\346\264<\377\177\000\000\212\346\377"
+ "\177\377\177\000\000\373\312\377\177\377\177\000\000\355\354\340>\377\177"
+ "\000\000/\363q@\377\177\000\000\377\177z\252\001\200\000\000\377\177\001"
+ "\200\377\177\000\000\377\177\001\200\001\200\000\000\377\177z\252\377\177"
+ "\000\000\377\177\373\312\001\200\000\000\377\177\373\312\377\177\000\000"
+ "\0055\377\177\204\306\000\000\201n\377\177\177\221\000\000\0055\377\177\177"
+ "\221\000\000\201n\377\177\000\000\000\000\201$\2426\377\177\000\000\371\036"
+ "\3629\000\000\000\000\201$\2426\000\000\000\000\371\036\3629\377\177\000"
+ "\000\264<%\031\377\177\000\000\340>\023\023\000\000\000\000\340>\023\023"
+ "\377\177\000\000\264<%\031\000\000\000\000\212\321v.\000\000\000\0006\315"
+ "\257)\377\177\000\0006\315\257)\000\000\000\000\212\321v.\377\177\000\000"
+ "cAq\006\377\177\000\000\264A\000\000\000\000\000\000\264A\000\000\377\177"
+ "\000\000cAq\006\000\000\000\000\2426\177\333\377\177\000\000\3122Q\326\000"
+ "\000\000\000\3122Q\326\377\177\000\000\2426\177\333\000\000\000\000^\311"
+ "\201$\000\000\000\000\016\306\371\036\377\177\000\000\016\306\371\036\000"
+ "\000\000\000^\311\201$\377\177\000\000%\031\264<\377\177\000\000%\031\264"
+ "<\000\000\000\000L\303%\031\001\200\000\000\001\200\0055\377\177\000\000"
+ "\001\200\0055\001\200\000\000L\303%\031\000\000\000\000L\303%\031\377\177"
+ "\000\000\355\354 \301\001\200\000\000\333\346L\303\000\000\000\000\333\346"
+ "L\303\001\200\000\000\355\354 \301\000\000\000\000\000\000L\276\377\177\000"
+ "\000\000\000\001\200\201n\000\000\000\000\001\200\377\177\000\000\000\000"
+ "\001\200\177\221\000\000\000\000\001\200\001\200\000\000\000\000L\276\001"
+ "\200\000\000\000\000L\276\001\200\000\000\000\000L\276\377\177\000\000\000"
+ "\000L\276\000\000\000\000\3122\257)\001\200\000\000\2426\201$\000\000\000"
+ "\000\2426\201$\001\200\000\000\3122\257)\000\000\000\000q\006cA\001\200\000"
+ "\000\321\014q@\000\000\000\000\321\014q@\001\200\000\000q\006cA\000\000\000"
+ "\000\264<%\031\000\000\000\000\377\177\0055\001\200\000\000\264<%\031\001"
+ "\200\000\000\377\177\0055\377\177\000\000\264<%\031\377\177\000\000\177\333"
+ "\2426\000\000\000\000\007\341\3629\001\200\000\000\177\333\2426\001\200\000"
+ "\000\007\341\3629\000\000\000\000\371\036\016\306\001\200\000\000%\031L\303"
+ "\000\000\000\000%\031L\303\001\200\000\000\371\036\016\306\000\000\000\000"
+ "L\303\333\346\000\000\000\000\016\306\007\341\001\200\000\000\016\306\007"
+ "\341\000\000\000\000L\303\333\346\001\200\000\000\212\321v.\001\200\000\000"
+ "Q\326\3122\000\000\000\000Q\326\3122\001\200\000\000\212\321v.\000\000\000"
+ "\000\000\000\264A\001\200\000\000\000\000\264A\000\000\000\000\333\346\264"
+ "<\000\000\000\000\333\346\264<\001\200\000\000\201$^\311\000\000\000\000"
+ "\201$^\311\001\200\000\000\3629\007\341\377\177\000\000\3629\007\341\000"
+ "\000\000\000^\311\177\333\000\000\000\0006\315Q\326\001\200\000\0006\315"
+ "Q\326\000\000\000\000^\311\177\333\001\200\000\000\217\371cA\377\177\000"
+ "\000/\363q@\000\000\000\000\217\371cA\000\000\000\000/\363q@\377\177\000"
+ "\000v.\212\321\000\000\000\000v.\212\321\377\177\000\000q@\321\014\000\000"
+ "\000\000q@\321\014\377\177\000\000\007\341\016\306\000\000\000\000\333\346"
+ "L\303\377\177\000\000\333\346L\303\000\000\000\000\007\341\016\306\377\177"
+ "\000\000\023\023\340>\001\200\000\000%\031\264<\000\000\000\000%\031\264"
+ "<\001\200\000\000\023\023\340>\000\000\000\000\212\321\212\321\000\000\000"
+ "\000Q\3266\315\377\177\000\000Q\3266\315\000\000\000\000\212\321\212\321"
+ "\377\177\000\000\000\000\377\177\001\200\000\000\000\000\264A\000\000\000"
+ "\000\000\000\264A\001\200\000\000\000\000\264A\377\177\000\000\000\000\377"
+ "\177\377\177\000\000\000\000\377\177\377\177\000\000\000\000\377\177\001"
+ "\200\000\000\000\000\377\177\177\221\000\000 \301\023\023\000\000\000\000"
+ "\217\277\321\014\001\200\000\000\217\277\321\014\000\000\000\000 \301\023"
+ "\023\001\200\000\000L\303%\031\377\177\000\000L\303%\031\000\000\000\000"
+ "\257)\3122\000\000\000\000\257)\3122\377\177\000\000\212\321\212\321\377"
+ "\177\000\000\001\200\001\200\201n\000\000\001\200\001\200\377\177\000\000"
+ "\001\200\001\200\000\000\000\000\001\200\001\200\177\221\000\000\001\200"
+ "\001\200\001\200\000\000\212\321\212\321\001\200\000\000\212\321\212\321"
+ "\001\200\000\000\212\321\212\321\377\177\000\000\212\321\212\321\000\000"
+ "\000\000\377\177\001\200\001\200\000\000v.\212\321\000\000\000\000v.\212"
+ "\321\001\200\000\000\377\177\001\200\377\177\000\000v.\212\321\377\177\000"
+ "\000\0055\001\200\001\200\000\000\0055\001\200\204\306\000\000\0055\001\200"
+ "\177\221\000\000\0055\001\200|9\000\000\0055\001\200\201n\000\000\0055\001"
+ "\200\377\177\000\000%\031L\303\001\200\000\000%\031L\303\377\177\000\000"
+ "%\031L\303\377\177\000\000%\031L\303\001\200\000\000%\031L\303\000\000\000"
+ "\000cA\217\371\001\200\000\000q@/\363\000\000\000\000q@/\363\001\200\000"
+ "\000cA\217\371\000\000\000\000\264A\000\000\001\200\000\000\264A\000\000"
+ "\000\000\000\000\340>\355\354\000\000\000\000\340>\355\354\001\200\000\000"
+ "v.\212\321\000\000\000\000\264<\333\346\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\3122Q\326\000\000\000\000\2426\177\333\000\000\000\000\3629"
+ "\007\341\000\000\000\000\235\276\217\371\000\000\000\000\217\277/\363\377"
+ "\177\000\000\217\277/\363\000\000\000\000\235\276\217\371\377\177\000\000"
+ "\373\312\377\177\377\177\000\000\333\346\264<\000\000\000\000\333\346\264"
+ "<\377\177\000\000\333\346\264<\001\200\000\000\373\312\377\177\001\200\000"
+ "\000\373\312\377\177\001\200\000\000\373\312\377\177\377\177\000\000\373"
+ "\312\377\177\201n\000\000\373\312\377\177|9\000\000\373\312\377\177\001\200"
+ "\000\000\373\312\377\177|9\000\000\373\312\377\177\204\306\000\000\373\312"
+ "\377\177\001\200\000\000\373\312\377\177\177\221\000\000\264<\333\346\000"
+ "\000\000\000\377\177\373\312\001\200\000\000\264<\333\346\001\200\000\000"
+ "\377\177\373\312\377\177\000\000\264<\333\346\377\177\000\000\377\177\000"
+ "\000\001\200\000\000\264A\000\000\000\000\000\000\264A\000\000\001\200\000"
+ "\000\377\177\000\000\377\177\000\000\264A\000\000\377\177\000\000L\303\333"
+ "\346\001\200\000\000\001\200\373\312\377\177\000\000\001\200\373\312\001"
+ "\200\000\000L\303\333\346\000\000\000\000L\303\333\346\377\177\000\000\177"
+ "\333^\311\000\000\000\000\177\333^\311\377\177\000\000\3629\371\036\001\200"
+ "\000\000\264<%\031\000\000\000\000\264<%\031\001\200\000\000\3629\371\036"
+ "\000\000\000\000\257)6\315\001\200\000\000\257)6\315\000\000\000\000\355"
+ "\354\340>\377\177\000\000\333\346\264<\000\000\000\000\355\354\340>\000\000"
+ "\000\000\333\346\264<\377\177\000\000 \301\355\354\377\177\000\000 \301\355"
+ "\354\000\000\000\000\023\023 \301\377\177\000\000%\031L\303\000\000\000\000"
+ "\023\023 \301\000\000\000\000%\031L\303\377\177\000\000v.v.\377\177\000\000"
+ "v.v.\000\000\000\000\321\014\217\277\377\177\000\000\321\014\217\277\000"
+ "\000\000\000q\006\235\276\000\000\000\000q\006\235\276\377\177\000\000\000"
+ "\000\264A\000\000\000\000\000\000\264A\377\177\000\000L\276\000\000\000\000"
+ "\000\000L\276\000\000\377\177\000\000\217\371\235\276\000\000\000\000/\363"
+ "\217\277\001\200\000\000\217\371\235\276\001\200\000\000/\363\217\277\000"
+ "\000\000\000\264<\333\346\377\177\000\000\264<\333\346\000\000\000\000\000"
+ "\000L\276\377\177\000\000\000\000L\276\000\000\000\000v.\212\321\001\200"
+ "\000\000v.\212\321\000\000\000\000\000\000L\276\001\200\000\000\000\000L"
+ "\276\000\000\000\000\235\276q\006\001\200\000\000\235\276q\006\000\000\000"
+ "\000L\303%\031\000\000\000\000L\303%\031\001\200\000\000v.v.\001\200\000"
+ "\000v.v.\000\000\000\000\212\321\212\321\001\200\000\000\212\321\212\321"
+ "\000\000\000\000L\276\000\000\001\200\000\000L\276\000\000\000\000\000\000"
+ "\377\177\377\177\001\200\000\000v.v.\000\000\000\000v.v.\001\200\000\000"
+ "\377\177\377\177\177\221\000\000\377\177\377\177\000\000\000\000\377\177"
+ "\377\177\201n\000\000v.v.\377\177\000\000\377\177\377\177\377\177\000\000"
+ "\264<\333\346\000\000\000\000\264<\333\346\001\200\000\000\001\200\000\000"
+ "\377\177\000\000L\276\000\000\001\200\000\000\001\200\000\000\001\200\000"
+ "\000L\276\000\000\000\000\000\000L\276\000\000\377\177\000\000L\303\333\346"
+ "\377\177\000\000L\303\333\346\000\000\000\000\333\346L\303\001\200\000\000"
+ "\373\312\001\200\177\221\000\000\373\312\001\200\001\200\000\000\373\312"
+ "\001\200\204\306\000\000\373\312\001\200|9\000\000\373\312\001\200\201n\000"
+ "\000\373\312\001\200\377\177\000\000\333\346L\303\377\177\000\000\333\346"
+ "L\303\377\177\000\000\333\346L\303\001\200\000\000\333\346L\303\000\000\000"
+ "\000L\303\333\346\001\200\000\000\001\200\373\312\001\200\000\000 \301\355"
+ "\354\001\200\000\000\2426\201$\001\200\000\000\3122\257)\001\200\000\000"
+ "\264<%\031\001\200\000\000\3629\371\036\001\200\000\000\373\312\001\200\001"
+ "\200\000\000\007\341\016\306\001\200\000\000\333\346L\303\001\200\000\000"
+ "\3629\007\341\001\200\000\000\264<\333\346\001\200\000\000\377\177\373\312"
+ "\001\200\000\000\201$^\311\001\200\000\000%\031L\303\001\200\000\000\371"
+ "\036\016\306\001\200\000\000\023\023 \301\001\200\000\000q@/\363\001\200"
+ "\000\000\340>\355\354\001\200\000\000\016\306\371\036\001\200\000\000L\303"
+ "%\031\001\200\000\000 \301\023\023\001\200\000\000\217\277\321\014\001\200"
+ "\000\000%\031\264<\001\200\000\000\371\036\3629\001\200\000\000\321\014q"
+ "@\001\200\000\000\023\023\340>\001\200\000\000\0055\001\200\001\200\000\000"
+ "\340>\023\023\001\200\000\000\355\354 \301\001\200\000\000/\363\217\277\001"
+ "\200\000\000\235\276q\006\001\200\000\000\016\306\007\341\001\200\000\000"
+ "^\311\177\333\001\200\000\000cA\217\371\001\200\000\000q\006cA\001\200\000"
+ "\000Q\326\3122\001\200\000\000\177\333\2426\001\200\000\000\007\341\3629"
+ "\001\200\000\000\333\346\264<\001\200\000\000\257)6\315\001\200\000\000\355"
+ "\354\340>\001\200\000\0006\315Q\326\001\200\000\000\373\312\377\177\001\200"
+ "\000\000\001\200\0055\001\200\000\000\0055\377\177\001\200\000\000\217\371"
+ "\235\276\001\200\000\000\377\177\0055\001\200\000\000\0055\377\177\377\177"
+ "\000\000%\031\264<\000\000\000\000%\031\264<\377\177\000\000%\031\264<\001"
+ "\200\000\000\0055\377\177\001\200\000\000\0055\377\177\001\200\000\000\005"
+ "5\377\177\377\177\000\000\0055\377\177\201n\000\000\0055\377\177|9\000\000"
+ "\371\036\3629\377\177\000\000\0055\377\177\377\177\000\000%\031\264<\377"
+ "\177\000\000\201$\2426\377\177\000\000\206U\377\177\377\177\000\000L\303"
+ "%\031\377\177\000\000\001\200\206U\377\177\000\000\001\200\0055\377\177\000"
+ "\000\016\306\371\036\377\177\000\000^\311\201$\377\177\000\000\001\200\377"
+ "\177\001\200\000\000\212\321v.\000\000\000\000\212\321v.\001\200\000\000"
+ "\212\321v.\377\177\000\000\001\200\377\177\377\177\000\000\001\200\377\177"
+ "\377\177\000\0006\315\257)\377\177\000\000\212\321v.\377\177\000\000\000"
+ "\000\377\177\377\177\000\000\217\371cA\377\177\000\000\000\000\264A\377\177"
+ "\000\000cAq\006\377\177\000\000\264A\000\000\377\177\000\000\377\177\000"
+ "\000\377\177\000\000\177\221\001\200\377\177\000\000\212\321\212\321\377"
+ "\177\000\000\001\200\001\200\377\177\000\000Q\3266\315\377\177\000\000\001"
+ "\200\000\000\377\177\000\000\235\276\217\371\377\177\000\000L\276\000\000"
+ "\377\177\000\000\257)\3122\377\177\000\000v.v.\377\177\000\000\377\177\377"
+ "\177\377\177\000\000\377\177\377\177\377\177\000\000\201n\377\177\377\177"
+ "\000\000\000\000L\276\377\177\000\000\000\000\001\200\377\177\000\000q\006"
+ "\235\276\377\177\000\000\377\177\001\200\377\177\000\000\3122Q\326\377\177"
+ "\000\000v.\212\321\377\177\000\000\201n\377\177\201n\000\000\377\177\377"
+ "\177\001\200\000\000\201n\377\177\001\200\000\000\377\177\377\177\177\221"
+ "\000\000\206U\377\177\001\200\000\000\0055\377\177\001\200\000\000\377\177"
+ "\377\177\000\000\000\000\377\177\377\177\201n\000\000\377\177\377\177\377"
+ "\177\000\000\212\346\377\177\001\200\000\000\000\000\377\177\001\200\000"
+ "\000\0055\377\177\377\177\000\000\0055\001\200\177\221\000\000v\031\001\200"
+ "\001\200\000\000\0055\001\200\001\200\000\000\000\000\001\200\001\200\000"
+ "\000\0055\001\200\377\177\000\000\0055\001\200\201n\000\000v\031\001\200"
+ "\377\177\000\000\000\000\001\200\377\177\000\000\373\312\001\200|9\000\000"
+ "\373\312\001\200\204\306\000\000\177\221\001\200\377\177\000\000\001\200"
+ "\001\200\377\177\000\000\001\200\001\200\177\221\000\000\177\221\001\200"
+ "\177\221\000\000\001\200\001\200\001\200\000\000\177\221\001\200\001\200"
+ "\000\000\373\312\001\200\377\177\000\000\373\312\001\200\201n\000\000\177"
+ "\221\001\200\377\177\000\000\373\312\001\200\377\177\000\000\373\312\001"
+ "\200\177\221\000\000z\252\001\200\001\200\000\000\373\312\001\200\001\200"
+ "\000\000%\031L\303\000\000\000\000\371\036\016\306\000\000\000\000\201$^"
+ "\311\000\000\000\000\257)6\315\000\000\000\000\000\000\000\000\001\200\000"
+ "\000v.\212\321\000\000\000\000v.\212\321\001\200\000\000\000\000\000\000"
+ "\000\000\000\000\355\354\340>\000\000\000\000\333\346\264<\000\000\000\000"
+ "/\363q@\000\000\000\000\217\371cA\000\000\000\000\000\000\264A\000\000\000"
+ "\000\016\306\371\036\000\000\000\000L\303%\031\000\000\000\000^\311\201$"
+ "\000\000\000\0006\315\257)\000\000\000\000\212\321v.\000\000\000\000\264"
+ "<\333\346\000\000\000\000\000\000\000\000\001\200\000\000\264<\333\346\001"
+ "\200\000\000L\303%\031\000\000\000\000\264<\333\346\000\000\000\000\000\000"
+ "\000\000\000\000\000\000Q\326\3122\000\000\000\000\177\333\2426\000\000\000"
+ "\000\007\341\3629\000\000\000\000\355\354 \301\000\000\000\000\333\346L\303"
+ "\000\000\000\000/\363\217\277\000\000\000\000\217\371\235\276\000\000\000"
+ "\000\000\000L\276\000\000\000\000\000\000\000\000\001\200\000\000%\031L\303"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\333\346\264<\001\200\000"
+ "\000\333\346\264<\000\000\000\000q\006\235\276\000\000\000\000\321\014\217"
+ "\277\000\000\000\000\023\023 \301\000\000\000\000v.v.\000\000\000\000%\031"
+ "\264<\000\000\000\000\371\036\3629\000\000\000\000\201$\2426\000\000\000"
+ "\000\257)\3122\000\000\000\000\000\000\000\000\001\200\000\000\000\000L\276"
+ "\000\000\000\000\000\000L\276\001\200\000\000\000\000\000\000\000\000\000"
+ "\000\016\306\007\341\000\000\000\000L\303\333\346\000\000\000\000^\311\177"
+ "\333\000\000\000\0006\315Q\326\000\000\000\000\212\321\212\321\000\000\000"
+ "\000q\006cA\000\000\000\000\321\014q@\000\000\000\000\023\023\340>\000\000"
+ "\000\000\000\000\000\000\001\200\000\000\333\346L\303\000\000\000\000\000"
+ "\000\000\000\000\000\000\000%\031\264<\001\200\000\000%\031\264<\000\000"
+ "\000\000\264A\000\000\000\000\000\000\264<%\031\000\000\000\000\340>\023"
+ "\023\000\000\000\000q@\321\014\000\000\000\000cAq\006\000\000\000\000Q\326"
+ "6\315\000\000\000\000\177\333^\311\000\000\000\000\007\341\016\306\000\000"
+ "\000\000\000\000\000\000\001\200\000\000\212\321\212\321\001\200\000\000"
+ "\212\321\212\321\000\000\000\000\235\276q\006\000\000\000\000L\276\000\000"
+ "\000\000\000\000\217\277\321\014\000\000\000\000 \301\023\023\000\000\000"
+ "\000\3122\257)\000\000\000\000\2426\201$\000\000\000\000\3629\371\036\000"
+ "\000\000\000\264<%\031\000\000\000\000\000\000\000\000\001\200\000\000\264"
+ "<%\031\001\200\000\000L\303\333\346\000\000\000\000\264<%\031\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\235\276\217\371\000\000\000\000\217"
+ "\277/\363\000\000\000\000 \301\355\354\000\000\000\000\340>\355\354\000\000"
+ "\000\000q@/\363\000\000\000\000cA\217\371\000\000\000\000\000\000\000\000"
+ "\001\200\000\000\000\000\000\000\000\000\000\000\264A\000\000\000\000\000"
+ "\000\264A\000\000\001\200\000\000\201\177\177\201\177\177\201\177\201\177"
+ "\177\177\177\201\201\201\177\177\177\177\177\177\000\201\000\201\000\201"
+ "\177\201\177\201\177\201\177\177\177\177\177\177\201\177\177\177\177\201"
+ "\177\201\201\201\177\177\201\201\177\177\201\201\177\201\201\201\177\201"
+ "\177\201\177\177\000\201\000\201\000\201\000\201\000\000\000\000\000\000"
+ "\000\000\000\000\000\177\000\177\000\177\000\177\000\177\000\000\000\000"
+ "\000\000\000\000\000\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\000\000\000\000\000\000"
+ "\000\000\000\000\201\201\201\201\177\177\201\201\201\177\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\177\201"
+ "\201\177\177\201\201\177\201\177\000\201\000\201\000\201\000\201\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\201\000\000\000\000\000\000"
+ "\000\000\000\000\177\000\177\000\177\000\177\000\177\000\177\000\000\177"
+ "\000\177\000\177\000\177\315\264\324\255\315\264\324\255\242\337\240\341"
+ "\235\344\242\337C\304E\306G\310C\304\213\366\207\372\207\372\216\363\265"
+ "4\2718\273:\2632M\316R\323T\325K\314\327\252\327\252\333\246\333\246\333"
+ "\246\333\246\333\246\342\237\337\242\337\242\342\237\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\263\203\300\037>\000G8K4M2E:\015r\024k\027h"
+ "\012u\333Z\333Z\333Z\333Z\333Z\315L\324S\315L\324S,\255)\252)\252,\255\252"
+ "\327\254\325\256\323\252\327\304C\306E\310G\304C\006y\006y\327V\327V3\264"
+ "3\264\256-\254+\265\314\271\310\273\306\263\316\013\214\024\225\013\214\027"
+ "\230\275<\275<\230\351\225\354,S)V)V,S\037`!^!^\034c<C9F9F<C\177\000\177"
+ "\000\177\000\177\000\177\000\031\031mI\000\177\235\034\230\027\225\024\240"
+ "\037V\327V\327\307\272\307\272\300@\300@\300@\300\077\300\077\300\077\300"
+ "@\000\177\000\177\000\177\301\300\301\300\301\300\301\300\301\300v\011\177"
+ "\000\177\000\177\000\177\000d\033Z%Z%\023+|T!\016r\363k\354h\351u\366y\372"
+ "y\372c\344`\341\000\000\000\000\000\000\000\000\000\000\000\000r\015k\024"
+ "h\027u\012\246\333\246\333\246\333\246\333\246\333\000\201\000\201\000\201"
+ "\000\201\000\177\000\177\000\177\226\264\000\177%Z%Z%Z%Z%Z\000\201\000\201"
+ "\000\201\000\201\000\201%\246%\246%\246%\246%\2464K2MT+V)V)R-8\271:\273\037"
+ "\240!\242\034\235!\242c\034`\037\341`\337^\344c\337^\304\275\304\275\353"
+ "j\353j\365t\365t\006\207\006\207y\006y\006\365\214\354\225\365\214\351\230"
+ "\252)\252)\372y\372y<\275<\275\372\207\372\207\216\015\213\012\242!\242!"
+ "C<C<\275\304\275\304\207\006\207\006@\300@\301@\300@\300@\300@\300@\300@"
+ "\300^\337^\337\000\177\000\177\000\177\000\177\000\177^!^!Z\333Z\333Z\333"
+ "Z\333Z\333Z\333Z\333Z\3336+[\276&\327\177\201\201\177\201\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\201\177\177\201\177\201\177\177\177"
+ "\201\177\201\177\201\201\177\177\201\201\177\177\177\177\177\177\201\177"
+ "\201\177\177\177\177\177\177\177\177\201\201\201\177\201\177\201\177\177"
+ "\201\177\201\201\177\177\201\201\201\201\201\177\201\201\201\201\201\177"
+ "\201\177\177\177\201\177\177\177\177\177\201\177\177\177\177\246%\246%\246"
+ "%\246%\246%\242i\331-\000\177\000\177\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000@\077@\077@@@\077@\077\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "-\023\000\177\000\000\000\000\000\000\000\000\000\000\000\000\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\264\037\322\000\201\000\201\000\201\000\000\000\000\000"
+ "\000\000\000L3@\077@\077L3\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\333\246\333\246\333\246\330\311\026\013"
+ "\030\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "Z%Z%Z%Z%Z%\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\177\000\177\000\177\000\177\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000^\337Z\333j\353Z\333Z\333\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000@\301@\301@\301\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000%\2460\261%\246\177\177\177\177\177\177"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\177\000\177\000\177"
+ "\000\177\000\000\001\000\002\000\001\000\000\000\003\000\003\000\000\000"
+ "\004\000\003\000\004\000\005\000\006\000\007\000\010\000\007\000\006\000"
+ "\011\000\011\000\006\000\012\000\013\000\014\000\015\000\016\000\017\000"
+ "\020\000\017\000\016\000\021\000\021\000\016\000\022\000\023\000\024\000"
+ "\025\000\024\000\023\000\026\000\026\000\023\000\027\000\030\000\031\000"
+ "\032\000\031\000\030\000\033\000\031\000\033\000\034\000\035\000\036\000"
+ "\037\000\036\000\035\000 \000\036\000 \000!\000\042\000#\000$\000#\000\042"
+ "\000%\000&\000'\000(\000'\000&\000)\000)\000&\000*\000+\000,\000-\000,\000"
+ "+\000.\000/\000,\000.\0000\0001\0002\0001\0000\0003\0003\0000\0004\0005\000"
+ "6\0007\0006\0005\0008\0008\0005\0009\0008\0009\000:\000;\000<\000=\000<\000"
+ ";\000>\000>\000;\000\077\000>\000\077\000@\000A\000B\000C\000B\000A\000D"
+ "\000B\000D\000E\000F\000G\000H\000G\000F\000I\000I\000F\000J\000K\000L\000"
+ "M\000L\000K\000N\000N\000K\000O\000P\000Q\000R\000Q\000P\000S\000Q\000S\000"
+ "T\000U\000V\000W\000V\000U\000X\000V\000X\000Y\000Z\000[\000\134\000[\000"
+ "Z\000]\000^\000_\000`\000_\000^\000a\000a\000^\000b\000a\000b\000c\000\010"
+ "\000\011\000d\000\011\000\010\000\007\000e\000f\000g\000f\000e\000h\000f"
+ "\000h\000i\000j\000k\000l\000k\000j\000m\000m\000j\000n\000m\000n\000o\000"
+ "p\000q\000r\000q\000p\000s\000t\000u\000v\000u\000t\000w\000x\000y\000z\000"
+ "y\000x\000{\000|\000}\000~\000}\000|\000\177\000\200\000\201\000\202\000"
+ "\201\000\200\000\203\000\204\000\205\000\206\000\205\000\204\000\207\000"
+ "\210\000\211\000\212\000\211\000\210\000\213\000u\000\214\000\215\000\214"
+ "\000u\000w\000\216\000\217\000\220\000\217\000\216\000\221\000\217\000\221"
+ "\000\222\000\223\000\224\000\225\000\224\000\223\000\226\000\227\000\230"
+ "\000\231\000\230\000\227\000\232\000\232\000\227\000\233\000\233\000\227"
+ "\000\234\000\235\000\236\000\237\000\240\000\241\000\242\000\241\000\240"
+ "\000\243\000\244\000\245\000\246\000\245\000\244\000\247\000\250\000\251"
+ "\000\252\000\251\000\250\000\253\000\253\000\250\000\254\000\255\000\256"
+ "\000\257\000\256\000\255\000\260\000\261\000\262\000\263\000\262\000\261"
+ "\000\264\000\265\000\266\000\267\000\266\000\265\000\270\000\271\000\272"
+ "\000\273\000\272\000\271\000\274\000\275\000\247\000\244\000\247\000\275"
+ "\000\276\000\256\000\277\000\300\000\277\000\256\000\260\000\301\000\261"
+ "\000\302\000\261\000\301\000\264\000\273\000\255\000\257\000\255\000\273"
+ "\000\272\000\303\000\207\000\204\000\207\000\303\000\304\000\305\000\306"
+ "\000\307\000\306\000\305\000\310\000\311\000\312\000\313\000\312\000\311"
+ "\000\314\000\206\000\315\000\316\000\315\000\206\000\205\000z\000\317\000"
+ "\320\000\317\000z\000y\000\321\000\322\000\323\000\322\000\321\000\324\000"
+ "\325\000\326\000\327\000\326\000\325\000\330\000\331\000\332\000\333\000"
+ "\332\000\331\000\334\000\335\000\336\000\337\000\336\000\335\000\340\000"
+ "\340\000\335\000\341\000\342\000\343\000\344\000\342\000\344\000,\000\345"
+ "\000\346\000\347\000\346\000\345\000\350\000\212\000\351\000\352\000\351"
+ "\000\212\000\211\000\353\000t\000v\000t\000\353\000\354\000\355\000\356\000"
+ "\357\000\356\000\355\000\360\000\360\000\355\000\361\000\361\000\355\000"
+ "\362\000\362\000\355\000\363\000\364\000\365\000\366\000\367\000\370\000"
+ "\371\000\370\000\367\000\372\000\370\000\372\000\373\000\374\000\375\000"
+ "\376\000\375\000\374\000\377\000\377\000\374\000\000\001\000\001\374\000"
+ "\001\001\001\001\374\000\002\001\001\001\002\001\003\001\004\001\005\001"
+ "\006\001\007\001\010\001\011\001\010\001\007\001\012\001\013\001\012\001"
+ "\007\001\012\001\013\001\014\001\011\001\015\001\016\001\015\001\011\001"
+ "\010\001\017\001\020\001\021\001\020\001\017\001\022\001\020\001\022\001"
+ "\023\001\020\001\023\001\024\001\025\001\026\001\027\001\026\001\025\001"
+ "\030\001\267\000\310\000\305\000\310\000\267\000\266\000\031\001\032\001"
+ "\033\001\032\001\031\001\034\001\034\001\031\001\035\001\036\001\037\001"
+ " \001\036\001 \001!\001\042\001#\001$\001%\001$\001&\001'\001(\001)\001("
+ "\001'\001*\001*\001'\001+\001,\001-\001.\001-\001,\001/\001-\001/\0010\001"
+ "1\0012\0013\0012\0011\0014\0012\0014\0015\001\332\0006\001\333\0006\001\332"
+ "\0007\0018\0019\001:\0019\0018\001;\001<\001\301\000\302\000\301\000<\001"
+ "=\001>\001\077\001@\001\077\001>\001A\001\027\001B\001C\001B\001\027\001"
+ "\026\001D\001E\001F\001E\001D\001G\001H\001\353\000I\001\353\000H\001\354"
+ "\000J\001F\001K\001F\001J\001D\001L\001J\001K\001J\001L\001M\001N\001\311"
+ "\000\313\000\311\000N\001O\001\314\000@\001\312\000@\001\314\000>\001P\001"
+ "\030\001\025\001\030\001P\001Q\001\320\000\203\000\200\000\203\000\320\000"
+ "\317\000R\001S\001T\001S\001R\001U\001V\001\304\000\303\000\304\000V\001"
+ "W\001X\001L\001Y\001L\001X\001M\001Z\001=\001<\001=\001Z\001[\001\134\001"
+ "R\001T\001R\001\134\001]\001\347\000^\001_\001^\001\347\000\346\000`\001"
+ "\350\000\345\000\350\000`\001a\001U\001\223\000S\001\223\000U\001\226\000"
+ "b\001\243\000\240\000\243\000b\001c\001\307\000d\001e\001d\001\307\000\306"
+ "\000\246\000\330\000\325\000\330\000\246\000\245\000_\001f\001g\001f\001"
+ "_\001^\001h\001i\001j\001i\001h\001k\001i\001k\001l\001i\001l\001m\001i\001"
+ "m\001n\001n\001m\001o\001\242\000;\0018\001;\001\242\000\241\000\016\001"
+ "p\001q\001p\001\016\001\015\001r\001s\001t\001s\001r\001u\001u\001r\001v"
+ "\0017\001\321\0006\001\321\0007\001\324\000C\001w\001x\001w\001C\001B\001"
+ "~\000\213\000\210\000\213\000~\000}\000y\001z\001{\001z\001y\001|\001|\001"
+ "y\001}\001}\001y\001~\001~\001y\001\177\001\177\001y\001\200\001\201\001"
+ "\202\001\203\001V\000\204\001\205\001\204\001V\000\206\001\206\001V\000Y"
+ "\000\011\000\207\001d\000\207\001\011\000\210\001\207\001\211\001d\000\211"
+ "\001\207\001\212\001\005\000\213\001\003\000\213\001\005\000\214\001\213"
+ "\001\214\001\215\001\216\001!\000 \000!\000\216\001\217\001!\000\217\001"
+ "\220\001\221\001\222\001d\000\222\001\221\001\223\001\222\001J\000d\000J"
+ "\000\222\001\224\001\225\001\217\001d\000\217\001\225\001\226\001\227\001"
+ "d\000\230\001d\000\227\001\034\000\033\000d\000\034\000d\000\033\000\030"
+ "\000\231\001d\000\232\001d\000\231\001\230\001\233\001\010\000d\000\010\000"
+ "\233\001\234\001\235\001\233\001d\000\233\001\235\001\236\001\224\001I\000"
+ "J\000I\000\224\001\222\001I\000\222\001\237\001\211\001\020\000d\000\020"
+ "\000\211\001\240\001\020\000\021\000d\000\021\000\020\000\017\000d\000\004"
+ "\000\000\000\004\000d\000\005\000d\000\214\001\005\000\214\001d\000\215\001"
+ "d\000X\000U\000X\000d\000Y\000d\000\241\001\215\001\241\001d\000\242\001"
+ "d\000\206\001Y\000\206\001d\000\204\001\243\001d\000U\000d\000\243\001\232"
+ "\001d\000\244\001\204\001\244\001d\000\245\001\021\000\225\001d\000\225\001"
+ "\021\000\246\001 \000\037\000d\000\037\000 \000\035\000\247\001d\000\027"
+ "\000d\000\247\001\235\001\250\001d\000\030\000d\000\250\001\251\001\252\001"
+ "d\000\251\001d\000\252\001\253\001\037\000\221\001d\000\221\001\037\000\254"
+ "\001\255\001d\000\253\001d\000\255\001\024\000\026\000d\000\024\000d\000"
+ "\026\000\027\000\217\001 \000d\000 \000\217\001\216\001d\000\256\001\245"
+ "\001\256\001d\000\000\000d\000F\000H\000F\000d\000J\000\025\000\253\001\257"
+ "\001\253\001\025\000\255\001\255\001\025\000\024\000\031\000\230\001\260"
+ "\001\230\001\031\000\227\001\227\001\031\000\034\000\261\001\234\001\233"
+ "\001\234\001\261\001\010\000\010\000\261\001\006\000d\000\262\001\242\001"
+ "\262\001d\000H\000\263\001\240\001\211\001\240\001\263\001\020\000\020\000"
+ "\263\001\016\000\264\001\265\001\266\001\265\001\264\001\267\001\267\001"
+ "\264\001\270\001\271\001\272\001\273\001\271\001\273\001\274\001\271\001"
+ "\274\001p\000\271\001p\000r\000\275\001\276\001\277\001\276\001\275\001\300"
+ "\001\276\001\300\001\301\001\302\001\303\001\304\001\303\001\302\001\305"
+ "\001\303\001\305\001\306\001\307\001\310\001\311\001\310\001\307\001\312"
+ "\001\312\001\307\001\313\001\306\001\314\001\303\001\314\001\306\001\315"
+ "\001\314\001\315\001\316\001i\000\317\001f\000\317\001i\000\320\001\317\001"
+ "\320\001\321\001\322\001E\000D\000E\000\322\001\323\001E\000\323\001\324"
+ "\001\325\001\326\001\327\001\326\001\325\0012\000\326\0012\000\330\001\330"
+ "\0012\0001\000T\000\331\001Q\000\331\001T\000\332\001\331\001\332\001\333"
+ "\001\334\001\301\001\300\001\301\001\334\001\335\001\301\001\335\001\336"
+ "\001\301\001\337\001\340\001&\000\341\001\342\001\341\001&\000\343\001\343"
+ "\001&\000(\000\344\001\345\001\346\001\345\001\344\001M\000M\000\344\001"
+ "K\000\274\001s\000p\000\274\001\347\001s\000\347\001\274\001\273\001q\000"
+ "\350\001\351\001\350\001q\000\352\001r\000\353\001\354\001\353\001q\000\351"
+ "\001q\000\353\001r\000s\000\352\001q\000\352\001s\000\355\001$\001\344\000"
+ "&\001,\000#\001-\000$\001,\000\344\000,\000$\001#\001\340\001\356\001\347"
+ "\001\356\001\340\001\357\001\347\001\355\001s\000\355\001\347\001\356\001"
+ "&\001\360\001\042\001\360\001\344\000\361\001\344\000\360\001&\001\362\001"
+ "\347\001\273\001\347\001\362\001\340\001\340\001\272\001\301\001\363\001"
+ "\364\001\365\001\364\001$\000\366\001$\000\364\001\363\001\367\001#\000\370"
+ "\001#\000\367\001\371\001#\000\371\001\372\001\042\000$\000\363\001\373\001"
+ "\134\000\374\001\375\001]\000Z\000]\000\375\001\376\001\134\000\377\001\000"
+ "\002\377\001\134\000[\000\000\002\001\002\002\002\001\002\000\002\377\001"
+ "\003\002Z\000\004\002Z\000\003\002\375\001\005\002\006\0022\000\007\002\010"
+ "\002\011\002\010\002\000\002\002\002\000\002\010\002\007\002\373\001Z\000"
+ "\134\000Z\000\373\001\004\002\374\001\000\002\007\002\000\002\374\001\134"
+ "\000#\000%\000\370\001\012\002\017\001\021\001\017\001\012\002\013\002\017"
+ "\001\013\002\014\002\017\001\014\002\015\002\016\002\017\002\020\002\017"
+ "\002\016\002\021\002\021\002\016\002\311\001\021\002\311\001\310\001\021"
+ "\001\022\002\023\002\022\002\021\001\024\002\024\002\021\001\025\002\025"
+ "\002\021\001\026\002\021\001\027\002\030\002\027\002\021\001\031\002\031"
+ "\002\021\001\032\002\032\002\021\001\033\002\034\002\035\002\036\002\035"
+ "\002\221\000\216\000\221\000\035\002\034\002\037\002 \002!\002\021\001\042"
+ "\002\033\002\042\002\021\001#\002#\002\021\001$\002$\002\021\001\023\002"
+ "%\002\021\001&\002\021\001%\002'\002\021\001'\002(\002\021\001(\002)\002"
+ "*\002+\002\002\001+\002*\002,\002,\002*\002-\002,\002-\002.\002/\002\021"
+ "\001)\002\021\001/\002\012\002\012\002/\0020\002\012\0020\0021\0022\0023"
+ "\002\021\0013\0022\0024\0024\0022\0025\0025\0022\0026\0027\0028\0029\002"
+ "8\0027\002:\002:\0027\002\337\000:\002\337\000\336\000;\002\021\001<\002"
+ "\021\001;\002=\002\021\001=\002>\002\021\001>\002\077\002\021\001@\002\026"
+ "\002@\002\021\0013\002@\0023\002A\002A\0023\002B\002C\002D\002y\001D\002"
+ "C\002E\002E\002C\002F\002E\002F\002G\002H\002I\002\021\001I\002H\002J\002"
+ "J\002H\002K\002K\002H\002L\002M\002\021\001\077\002\021\001M\002N\002\021"
+ "\001N\002O\002\021\001O\002&\002i\001P\002j\001P\002i\001Q\002Q\002i\001"
+ "R\002\077\0022\002\021\001\021\001S\002T\002S\002\021\001U\002U\002\021\001"
+ "V\002V\002\021\001\030\002I\0022\002\021\0012\002I\002W\002W\002I\002X\002"
+ "X\002I\002Y\002Z\002[\002\134\002[\002Z\0024\001]\002^\002_\0024\0011\001"
+ "[\002`\002\021\001T\002\021\001`\002a\002\021\001a\002b\002\021\001b\002"
+ "<\002\020\001H\002\021\001H\002\020\001c\002H\002c\002d\002H\002d\002e\002"
+ "u\001f\002s\001f\002u\001g\002f\002h\002i\002h\002f\002g\002\000\000\001"
+ "\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003\000\000"
+ "\000\004\000\003\000\004\000\004\000\005\000\003\000\005\000\006\000\007"
+ "\000\007\000\010\000\006\000\010\000\006\000\011\000\007\000\011\000\006"
+ "\000\012\000\011\000\012\000\006\000\015\000\012\000\015\000\016\000\017"
+ "\000\017\000\020\000\016\000\020\000\016\000\021\000\017\000\021\000\016"
+ "\000\022\000\021\000\022\000\023\000\024\000\024\000\025\000\023\000\025"
+ "\000\023\000\026\000\024\000\026\000\023\000\027\000\026\000\027\000\030"
+ "\000\031\000\031\000\032\000\030\000\032\000\030\000\033\000\031\000\033"
+ "\000\033\000\034\000\031\000\034\000\035\000\036\000\036\000\037\000\035"
+ "\000\037\000\035\000 \000\036\000 \000 \000!\000\036\000!\000\042\000#\000"
+ "#\000$\000\042\000$\000\042\000%\000#\000%\000&\000'\000'\000(\000&\000("
+ "\000&\000)\000'\000)\000&\000*\000)\000*\000+\000,\000,\000-\000+\000-\000"
+ "+\000.\000,\000.\000,\000/\000.\000/\0000\0001\0001\0002\0000\0002\0000\000"
+ "3\0001\0003\0000\0004\0003\0004\000\016\0006\000\022\0006\000\016\0008\000"
+ "6\0008\000\016\0009\0008\0009\0009\000:\0008\000:\000;\000<\000<\000=\000"
+ ";\000=\000;\000>\000<\000>\000;\000\077\000>\000\077\000\077\000@\000>\000"
+ "@\000:\000A\000:\000C\000A\000C\000A\000D\000:\000D\0008\000D\000F\000G\000"
+ "G\000H\000F\000H\000F\000I\000G\000I\000F\000J\000I\000J\000K\000L\000L\000"
+ "M\000K\000M\000K\000N\000L\000N\000K\000O\000N\000O\000;\000P\000=\000P\000"
+ "P\000S\000;\000S\000S\000T\000;\000T\000>\000U\000@\000U\000U\000X\000>\000"
+ "X\000X\000Y\000>\000Y\000Z\000[\000[\000\134\000Z\000\134\000Z\000]\000["
+ "\000]\000^\000_\000_\000`\000^\000`\000\031\000^\000\031\000_\000^\000b\000"
+ "\031\000b\000\032\000b\000\010\000\011\000\011\000d\000\010\000d\000.\000"
+ "e\000+\000e\000e\000h\000.\000h\000h\000i\000.\000i\000!\000k\000\036\000"
+ "k\000!\000K\000K\000k\000!\000n\000K\000n\000O\000n\000p\000q\000q\000r\000"
+ "p\000r\000p\000s\000q\000s\000t\000u\000u\000v\000t\000v\000t\000w\000u\000"
+ "w\000C\000y\000A\000y\000C\000{\000y\000{\000|\000}\000}\000~\000|\000~\000"
+ "|\000\177\000}\000\177\000\200\000\201\000\201\000\202\000\200\000\202\000"
+ "\200\000\203\000\201\000\203\000M\000\205\000\205\000\206\000M\000\206\000"
+ "M\000\207\000\205\000\207\000\210\000\211\000\211\000\212\000\210\000\212"
+ "\000\210\000\213\000\211\000\213\000u\000\214\000\214\000\215\000u\000\215"
+ "\000w\000\214\000`\000\216\000_\000\216\000\216\000\221\000`\000\221\000"
+ "\221\000\222\000`\000\222\000\223\000\224\000\224\000\225\000\223\000\225"
+ "\000\223\000\226\000\224\000\226\000#\000\227\000#\000\231\000\227\000\231"
+ "\000$\000\227\000G\000\227\000$\000G\000H\000\227\000\227\000\237\000H\000"
+ "\237\000\240\000\241\000\241\000\242\000\240\000\242\000\240\000\243\000"
+ "\241\000\243\000\244\000\245\000\245\000\246\000\244\000\246\000\244\000"
+ "\247\000\245\000\247\0009\000{\0009\000\252\000{\000\252\000:\000{\000\255"
+ "\000\256\000\256\000\257\000\255\000\257\000\255\000\260\000\256\000\260"
+ "\000\261\000\262\000\262\000\263\000\261\000\263\000\261\000\264\000\262"
+ "\000\264\000\265\000\266\000\266\000\267\000\265\000\267\000\265\000\270"
+ "\000\266\000\270\000\030\000\272\000\272\000\273\000\030\000\273\000\030"
+ "\000|\000|\000\272\000\027\000\247\000\027\000\244\000\027\000\276\000\247"
+ "\000\276\000\256\000\277\000\277\000\300\000\256\000\300\000\260\000\277"
+ "\000\261\000\301\000\261\000\302\000\301\000\302\000\264\000\301\000\255"
+ "\000\273\000\257\000\273\000\255\000\272\000L\000\207\000L\000\304\000\207"
+ "\000\304\000\305\000\306\000\306\000\307\000\305\000\307\000\305\000\310"
+ "\000\306\000\310\000\311\000\312\000\312\000\313\000\311\000\313\000i\000"
+ "\311\000i\000\312\000\206\000\315\000\315\000\316\000\206\000\316\000\205"
+ "\000\315\000A\000\317\000D\000\317\000y\000\317\0004\000\321\0004\000\224"
+ "\000\224\000\321\0003\000\321\000\215\000\325\000\215\000\327\000\325\000"
+ "\327\000\325\000\330\000\215\000\330\000\331\000\332\000\332\000\333\000"
+ "\331\000\333\000\331\000\334\000\332\000\334\000\023\000\276\000\023\000"
+ "\340\000\276\000\340\000\023\000/\000/\000\340\000\023\000\344\000/\000\344"
+ "\000,\000\344\000\345\000\346\000\346\000\347\000\345\000\347\000\345\000"
+ "\350\000\346\000\350\000\212\000\222\000\212\000\221\000\211\000\222\000"
+ "t\000\353\000v\000\353\000\353\000\354\000t\000\354\000]\000\334\000]\000"
+ "\357\000\334\000\357\000[\000\334\000\334\000\361\000[\000\361\000\002\000"
+ "\334\000\002\000\361\000\000\000\334\000\000\000\331\000\036\000\315\000"
+ "\037\000\315\000k\000\315\000k\000\316\000\042\000\374\000\042\000\376\000"
+ "\374\000\376\000%\000\374\000\374\000\000\001%\000\000\001*\000\374\000*"
+ "\000\000\001\263\000\374\000*\000\263\000)\000\263\000)\000\262\000\007\001"
+ "\010\001\010\001\011\001\007\001\011\001\007\001\012\001\010\001\012\001"
+ "\021\000\012\001\021\000\007\001\021\000\201\000\201\000\012\001\011\001"
+ "\015\001\015\001\016\001\011\001\016\001\010\001\015\001\315\000\020\001"
+ "\020\001\021\001\315\000\021\001\205\000\020\001\207\000\020\001\304\000"
+ "\020\001T\000\025\001T\000\027\001\025\001\027\001\025\001\030\001T\000\030"
+ "\001\267\000\310\000\267\000\305\000\266\000\310\000+\000\277\000e\000\277"
+ "\000+\000\300\000+\000\035\001\300\000\035\001-\000\035\001-\000!\001\035"
+ "\001!\001!\001$\001\035\001$\001$\001&\001\035\001&\001n\000\020\001n\000"
+ ")\001\020\001)\001O\000\020\001N\000\020\001\022\000\201\0006\000\201\000"
+ "6\000\202\000=\000\270\000<\000\270\000=\000\265\000P\000\265\000\332\000"
+ "6\001\333\0006\0011\000\332\0001\0006\001{\0008\001\252\0008\0018\001;\001"
+ "{\000;\001\301\000<\001\302\000<\001<\001=\001\301\000=\001h\000\277\000"
+ "\277\000@\001h\000@\001S\000\027\001S\000C\001\027\001C\001'\000\262\000"
+ "\262\000F\001'\000F\001\353\000H\001\353\000I\001H\001I\001\354\000H\001"
+ "(\000F\001F\001K\001(\000K\001(\000L\001K\001L\001L\001M\001(\000M\001\276"
+ "\000\311\000\276\000\313\000\311\000\340\000i\000@\001\312\000@\001\030\001"
+ "P\001\025\001P\001P\001Q\001\030\001Q\001D\000\203\000D\000\200\000\203\000"
+ "\317\000R\001S\001S\001T\001R\001T\001R\001U\001S\001U\001N\000\304\000\227"
+ "\000L\001\237\000L\001\227\000M\001\037\000=\001\037\000<\001\315\000=\001"
+ "H\000R\001H\000T\001\237\000R\001\347\000^\001^\001_\001\347\000_\001\346"
+ "\000^\001\221\000\350\000\221\000\345\000\216\000\350\000\223\000U\001\223"
+ "\000S\001\226\000U\001\011\000\243\000\011\000\240\000\011\000I\001\243\000"
+ "I\001\000\000\307\000\307\000\331\000\000\000\306\000\246\000\330\000\246"
+ "\000\325\000\245\000\330\000U\000_\001U\000P\001P\001_\001U\000^\001\012"
+ "\000I\001\012\000k\001I\001k\001k\001l\001I\001l\001l\001m\001I\001m\001"
+ "H\001m\001m\001o\001H\001o\001\242\000;\001\242\0008\001\241\000;\001\016"
+ "\001\020\001\016\001)\001\015\001\020\001\077\000U\000\077\000P\001\077\000"
+ "Q\0011\000\321\000\321\0006\001P\000C\001\265\000C\001~\000\213\000~\000"
+ "\210\000}\000\213\000\225\000z\001z\001{\001\225\000{\001\225\000|\001z\001"
+ "|\001\225\000}\001|\001}\001\225\000~\001}\001~\0010\000\225\0000\000~\001"
+ "4\000\225\000>\000\270\000>\000\206\001\270\000\206\001Y\000\206\001\011"
+ "\000\242\000d\000\242\000\242\000\252\000d\000\252\000\005\000{\001\003\000"
+ "{\001\005\000\214\001{\001\214\001\225\000\214\001!\000\216\001 \000\216"
+ "\001)\001\216\001!\000)\001\263\000\302\000d\000\263\000d\000\302\000J\000"
+ "\263\000J\000d\000\263\000\224\001J\000\224\001\011\001)\001d\000)\001d\000"
+ "\011\001d\000\227\001d\000\216\000\216\000\227\001\034\000\227\001\034\000"
+ "d\000\033\000d\000\030\000d\000d\000\350\000d\000\346\000\010\000\327\000"
+ "d\000\327\000\327\000\234\001\010\000\234\001\246\000\327\000d\000\246\000"
+ "I\000\224\001I\000\263\000I\000\374\000\020\000\252\000\020\000d\000\252"
+ "\000\240\001\020\000\240\001\020\000\021\000\021\000d\000\004\000d\000\000"
+ "\000d\000\005\000d\000d\000\214\001d\000\225\000X\000d\000U\000d\000Y\000"
+ "d\000d\000\223\000d\000S\001d\000\206\001d\000\270\000d\000^\001d\000\266"
+ "\000d\000\310\000\021\000\011\001\037\000 \000\037\000d\000 \000d\000d\000"
+ "\244\000\027\000d\000d\000\273\000d\000\257\000d\000\256\000d\000\300\000"
+ "\037\000\302\000d\000\255\001\300\000\255\001\024\000\255\001\024\000d\000"
+ "\026\000d\000 \000)\001d\000\306\000F\000d\000H\000d\000\025\000\300\000"
+ "\025\000\035\001\025\000\255\001\031\000\216\000\031\000\227\001\234\001"
+ "\261\001\327\000\261\001\010\000\261\001\006\000\261\001d\000T\0019\000\240"
+ "\001\020\0009\000\215\000\264\001\214\000\264\001\327\000\264\001\261\001"
+ "\264\001\264\001\273\001\261\001\273\001\273\001\274\001\261\001\274\001"
+ "p\000\274\001p\000\261\001r\000\261\001w\000\264\001t\000\264\001t\000\301"
+ "\001\264\001\301\001^\000\222\000^\000\211\000^\000\213\000\032\000|\000"
+ "\032\000\177\000b\000\177\000b\000\213\000b\000}\000/\000i\000/\000\311\000"
+ "8\000\200\0008\000\202\000\334\000\325\001\357\000\325\0012\000\325\0012"
+ "\000\334\0002\000\332\000\077\000T\000\077\000\030\001\354\000\301\001H\001"
+ "\301\001o\001\301\001o\001\340\001\301\001\340\001&\000\227\000&\000\231"
+ "\000&\000M\001k\000\206\000M\000k\000s\000\274\001\274\001\347\001s\000\347"
+ "\001\273\001\347\001\012\000q\000\015\000q\000q\000k\001\006\000r\000\006"
+ "\000q\000s\000k\001s\000l\001\344\000$\001\344\000&\001,\000!\001,\000$\001"
+ "m\001\340\001m\001\347\001\340\001\347\001l\001\347\001\025\000&\001\025"
+ "\000\344\000\264\001\347\001\264\001\340\001I\000\376\000$\000I\000$\000"
+ "\376\000#\000*\000#\000\000\001#\000&\000\134\000}\001\134\000|\001]\000"
+ "\325\001Z\000\325\001\134\000\361\000\361\000\000\002\134\000\000\002\002"
+ "\000\000\002\001\000\000\0020\000Z\000Z\000~\0010\000\325\001\003\000z\001"
+ "\003\000\000\002z\001\000\002Z\000}\001|\001\000\002\262\000\315\000\262"
+ "\000\021\001\264\000\315\000\301\000\315\000d\000\315\000d\000\021\001\030"
+ "\000\021\001|\000\021\001\021\001@\001\277\000\021\001\312\000\021\001\313"
+ "\000\021\001\276\000\021\001\212\000\021\001\221\000\021\001\210\000\021"
+ "\001~\000\021\001d\000\020\001d\000\221\000\221\000\020\001\272\000\021\001"
+ "\255\000\021\001\260\000\021\001\226\000\021\001\224\000\021\001\021\001"
+ "U\001\021\001R\001\237\000\021\001d\000\262\000\300\000\021\001\021\001L"
+ "\001\262\000L\001\262\000K\001\215\000I\001\215\000\021\001\021\001I\001"
+ "u\000I\001v\000I\001d\000\237\000\027\000\021\001\267\000\021\001\265\000"
+ "\021\001\305\000\021\001\307\000\021\001\331\000\021\001\247\000\021\001"
+ "\215\000\247\000\215\000\245\000d\000\224\000\327\000\021\001{\000\201\000"
+ "{\000\021\001\201\000\021\001y\000\201\000\201\000\317\000\333\000\021\001"
+ "\021\0016\001\321\000\021\001d\000I\001\000\000I\001\331\000I\001\021\001"
+ "_\001\021\001P\001\347\000\021\001\345\000\021\001{\000I\001{\000\243\000"
+ "{\000\241\000d\000{\000{\000\265\000d\000\265\000\021\001\025\001\021\001"
+ "\027\001\021\001C\001\201\000\020\001\201\000\015\001\201\000\010\001d\000"
+ "P\001d\000\201\000\377\177\212\346\377\177\000\000cA\217\371\377\177\000"
+ "\000q@/\363\377\177\000\000\264A\000\000\377\177\000\000\377\177\000\000"
+ "\377\177\000\000L\276\000\000\377\177\000\000\001\200v\031\377\177\000\000"
+ "\001\200\000\000\377\177\000\000\235\276q\006\377\177\000\000\217\277\321"
+ "\014\377\177\000\000\206U\001\200\377\177\000\000\257)6\315\377\177\000\000"
+ "\201$^\311\377\177\000\000v.\212\321\377\177\000\000\377\177\001\200\377"
+ "\177\000\000\377\177\001\200\377\177\000\000\201n\001\200\377\177\000\000"
+ "\212\321\212\321\377\177\000\000\001\200z\252\377\177\000\000\001\200\001"
+ "\200\377\177\000\0006\315Q\326\377\177\000\000^\311\177\333\377\177\000\000"
+ "q\006cA\377\177\000\000\000\000\377\177\377\177\000\000\000\000\264A\377"
+ "\177\000\000v\031\377\177\377\177\000\000\321\014q@\377\177\000\000\3122"
+ "\257)\377\177\000\000\377\177\377\177\377\177\000\000v.v.\377\177\000\000"
+ "\2426\201$\377\177\000\000\377\177\206U\377\177\000\000\001\200\377\177\377"
+ "\177\000\000\177\221\377\177\201n\000\000\001\200\377\177\201n\000\000\177"
+ "\221\377\177\377\177\000\000\0055\001\200|9\000\000\0055\001\200\204\306"
+ "\000\000\201n\001\200\000\000\000\000\377\177\206U\001\200\000\000\377\177"
+ "\0055\377\177\000\000\377\177\0055\001\200\000\000\377\177\206U\377\177\000"
+ "\000\377\177\377\177\001\200\000\000\377\177\377\177\377\177\000\000\340"
+ ">\355\354\001\200\000\000\377\177\373\312\001\200\000\000\264<\333\346\001"
+ "\200\000\000q@/\363\001\200\000\000\377\177\212\346\001\200\000\000\001\200"
+ "z\252\377\177\000\000\001\200\001\200\001\200\000\000\001\200\001\200\377"
+ "\177\000\000\001\200z\252\001\200\000\000\001\200\373\312\377\177\000\000"
+ "\001\200\373\312\001\200\000\000\212\321v.\377\177\000\000\177\221\377\177"
+ "\377\177\000\000\001\200\377\177\377\177\000\000z\252\377\177\377\177\000"
+ "\000Q\326\3122\377\177\000\000\177\333\2426\377\177\000\000\000\000\001\200"
+ "\377\177\000\000/\363\217\277\377\177\000\000\212\346\001\200\377\177\000"
+ "\000\217\371\235\276\377\177\000\000\000\000L\276\377\177\000\000L\303\333"
+ "\346\001\200\000\000\001\200z\252\001\200\000\000\001\200\373\312\001\200"
+ "\000\000\016\306\007\341\001\200\000\000^\311\177\333\001\200\000\000\177"
+ "\333^\311\377\177\000\000Q\3266\315\000\000\000\000\177\333^\311\000\000"
+ "\000\000Q\3266\315\377\177\000\000\377\177\206U\001\200\000\000\3629\371"
+ "\036\001\200\000\000\2426\201$\001\200\000\000\264<%\031\001\200\000\000"
+ "\377\177\0055\001\200\000\000\000\000\377\177\377\177\000\000\000\000\264"
+ "A\000\000\000\000\000\000\264A\377\177\000\000\000\000\264A\001\200\000\000"
+ "\000\000\377\177\001\200\000\000\000\000\377\177\001\200\000\000\000\000"
+ "\377\177\377\177\000\000\000\000\377\177\201n\000\000\000\000\377\177\177"
+ "\221\000\000\264A\000\000\000\000\000\000cA\217\371\001\200\000\000cA\217"
+ "\371\000\000\000\000\264A\000\000\001\200\000\000\340>\355\354\000\000\000"
+ "\000\264<\333\346\001\200\000\000\264<\333\346\000\000\000\000\340>\355\354"
+ "\001\200\000\000%\031L\303\377\177\000\000\0055\001\200\201n\000\000\005"
+ "5\001\200\377\177\000\000\0055\001\200|9\000\000\0055\001\200\204\306\000"
+ "\000\0055\001\200\177\221\000\000\0055\001\200\001\200\000\000%\031L\303"
+ "\001\200\000\000%\031L\303\001\200\000\000%\031L\303\377\177\000\000%\031"
+ "L\303\000\000\000\000\212\321\212\321\000\000\000\000\212\321\212\321\377"
+ "\177\000\000\3629\007\341\000\000\000\000\2426\177\333\377\177\000\000\242"
+ "6\177\333\000\000\000\000\3629\007\341\377\177\000\000\0055\377\177\001\200"
+ "\000\000%\031\264<\000\000\000\000%\031\264<\001\200\000\000%\031\264<\377"
+ "\177\000\000\0055\377\177\377\177\000\000\0055\377\177\377\177\000\000\005"
+ "5\377\177\001\200\000\000\0055\377\177\177\221\000\000\0055\377\177\204\306"
+ "\000\000\0055\377\177|9\000\000\0055\377\177\201n\000\000v.v.\000\000\000"
+ "\000\3122\257)\001\200\000\000\3122\257)\000\000\000\000v.v.\001\200\000"
+ "\000\333\346\264<\377\177\000\000\355\354\340>\000\000\000\000\333\346\264"
+ "<\000\000\000\000\355\354\340>\377\177\000\000\264<%\031\000\000\000\000"
+ "\340>\023\023\377\177\000\000\340>\023\023\000\000\000\000\264<%\031\377"
+ "\177\000\000q\006\235\276\377\177\000\000\000\000L\276\000\000\000\000q\006"
+ "\235\276\000\000\000\000\000\000L\276\377\177\000\000v.\212\321\000\000\000"
+ "\000\377\177\001\200\001\200\000\000v.\212\321\001\200\000\000\377\177\001"
+ "\200\177\221\000\000\377\177\001\200\000\000\000\000v.\212\321\377\177\000"
+ "\000\377\177\001\200\201n\000\000\377\177\001\200\377\177\000\000\2426\201"
+ "$\001\200\000\000\2426\201$\000\000\000\000q@\321\014\000\000\000\000cAq"
+ "\006\377\177\000\000cAq\006\000\000\000\000q@\321\014\377\177\000\000\333"
+ "\346L\303\000\000\000\000\355\354 \301\001\200\000\000\333\346L\303\001\200"
+ "\000\000\355\354 \301\000\000\000\000\321\014q@\000\000\000\000q\006cA\001"
+ "\200\000\000\321\014q@\001\200\000\000q\006cA\000\000\000\000\023\023\340"
+ ">\000\000\000\000\023\023\340>\001\200\000\000\000\000\264A\001\200\000\000"
+ "\000\000\264A\000\000\000\0006\315Q\326\001\200\000\000\212\321\212\321\000"
+ "\000\000\000\212\321\212\321\001\200\000\0006\315Q\326\000\000\000\000\016"
+ "\306\371\036\377\177\000\000L\303%\031\000\000\000\000L\303%\031\377\177"
+ "\000\000\016\306\371\036\000\000\000\000\001\200v\031\377\177\000\000\001"
+ "\200\000\000\001\200\000\000\001\200\000\000\377\177\000\000\001\200v\031"
+ "\001\200\000\000\001\200\0055\377\177\000\000\001\200\0055\001\200\000\000"
+ "v\031\377\177\001\200\000\000\023\023\340>\001\200\000\000\321\014q@\001"
+ "\200\000\000%\031\264<\001\200\000\000\0055\377\177\001\200\000\000\371\036"
+ "\016\306\001\200\000\000\0055\001\200\001\200\000\000%\031L\303\001\200\000"
+ "\000\201$^\311\001\200\000\000\206U\001\200\001\200\000\000\001\200\373\312"
+ "\377\177\000\000L\303\333\346\001\200\000\000\001\200\373\312\001\200\000"
+ "\000L\303\333\346\000\000\000\000L\303\333\346\377\177\000\000L\276\000\000"
+ "\000\000\000\000\001\200\000\000\001\200\000\000L\276\000\000\001\200\000"
+ "\000\001\200\000\000\377\177\000\000L\276\000\000\377\177\000\000v.v.\000"
+ "\000\000\000\377\177\377\177\001\200\000\000v.v.\001\200\000\000\377\177"
+ "\377\177\377\177\000\000v.v.\377\177\000\000\377\177\373\312\377\177\000"
+ "\000\264<\333\346\001\200\000\000\377\177\373\312\001\200\000\000\264<\333"
+ "\346\000\000\000\000\264<\333\346\377\177\000\000\333\346L\303\377\177\000"
+ "\000\007\341\016\306\000\000\000\000\333\346L\303\000\000\000\000\007\341"
+ "\016\306\377\177\000\000\373\312\377\177\001\200\000\000\333\346\264<\000"
+ "\000\000\000\333\346\264<\001\200\000\000\333\346\264<\377\177\000\000\373"
+ "\312\377\177\377\177\000\000\373\312\377\177\377\177\000\000\373\312\377"
+ "\177\001\200\000\000\373\312\377\177\177\221\000\000\373\312\377\177\204"
+ "\306\000\000\373\312\377\177|9\000\000\373\312\377\177\201n\000\000\212\321"
+ "v.\377\177\000\0006\315\257)\000\000\000\0006\315\257)\377\177\000\000\212"
+ "\321v.\000\000\000\000\235\276\217\371\377\177\000\000\217\277/\363\000\000"
+ "\000\000\217\277/\363\377\177\000\000\235\276\217\371\000\000\000\000\001"
+ "\200\377\177\377\177\000\000\212\321v.\000\000\000\000\212\321v.\377\177"
+ "\000\000\212\321v.\001\200\000\000\001\200\377\177\001\200\000\000\001\200"
+ "\377\177\001\200\000\000\001\200\377\177\377\177\000\000\001\200\377\177"
+ "\000\000\000\000\001\200\377\177\177\221\000\000v.v.\000\000\000\000\264"
+ "<%\031\000\000\000\000\000\000\000\000\000\000\000\000\3122\257)\000\000"
+ "\000\000\2426\201$\000\000\000\000\3629\371\036\000\000\000\000\023\023 "
+ "\301\377\177\000\000\321\014\217\277\000\000\000\000\023\023 \301\000\000"
+ "\000\000\321\014\217\277\377\177\000\000\016\306\007\341\001\200\000\000"
+ "^\311\177\333\000\000\000\000^\311\177\333\001\200\000\000\016\306\007\341"
+ "\000\000\000\000\3122Q\326\377\177\000\000\3122Q\326\000\000\000\000\373"
+ "\312\377\177\001\200\000\000\177\333\2426\001\200\000\000z\252\377\177\001"
+ "\200\000\000\007\341\3629\001\200\000\000\333\346\264<\001\200\000\000\000"
+ "\000\001\200\201n\000\000\373\312\001\200\204\306\000\000\000\000\001\200"
+ "\177\221\000\000\373\312\001\200|9\000\000\000\000L\276\001\200\000\000\000"
+ "\000\001\200\177\221\000\000\000\000\001\200\001\200\000\000\000\000\001"
+ "\200\201n\000\000\000\000\001\200\377\177\000\000\000\000L\276\377\177\000"
+ "\000\000\000L\276\377\177\000\000\000\000L\276\001\200\000\000\000\000L\276"
+ "\000\000\000\000q@/\363\001\200\000\000q@/\363\000\000\000\000/\363q@\000"
+ "\000\000\000/\363q@\377\177\000\000\264<\333\346\000\000\000\000\264<\333"
+ "\346\377\177\000\000\257)\3122\377\177\000\000v.v.\000\000\000\000\257)\312"
+ "2\000\000\000\000v.v.\377\177\000\000\217\371cA\377\177\000\000\000\000\264"
+ "A\000\000\000\000\217\371cA\000\000\000\000\000\000\264A\377\177\000\000"
+ "%\031\264<\377\177\000\000\371\036\3629\000\000\000\000%\031\264<\000\000"
+ "\000\000\371\036\3629\377\177\000\000\264A\000\000\000\000\000\000\377\177"
+ "\000\000\001\200\000\000\264A\000\000\001\200\000\000\377\177\000\000\377"
+ "\177\000\000\264A\000\000\377\177\000\000\235\276q\006\001\200\000\000L\276"
+ "\000\000\000\000\000\000L\276\000\000\001\200\000\000\235\276q\006\000\000"
+ "\000\000^\311\201$\377\177\000\000^\311\201$\000\000\000\000L\276\000\000"
+ "\377\177\000\000L\276\000\000\000\000\000\000 \301\355\354\000\000\000\000"
+ " \301\355\354\377\177\000\000 \301\023\023\001\200\000\000\217\277\321\014"
+ "\000\000\000\000\217\277\321\014\001\200\000\000 \301\023\023\000\000\000"
+ "\000%\031L\303\377\177\000\000%\031L\303\000\000\000\000\212\321\212\321"
+ "\001\200\000\000\001\200\001\200\377\177\000\000\001\200\001\200\001\200"
+ "\000\000\212\321\212\321\377\177\000\000\212\321\212\321\377\177\000\000"
+ "\212\321\212\321\001\200\000\000\212\321\212\321\000\000\000\000Q\326\312"
+ "2\000\000\000\000\212\321v.\001\200\000\000Q\326\3122\001\200\000\000\212"
+ "\321v.\000\000\000\000\371\036\016\306\000\000\000\000\201$^\311\001\200"
+ "\000\000\371\036\016\306\001\200\000\000\201$^\311\000\000\000\000%\031L"
+ "\303\000\000\000\000%\031L\303\001\200\000\000\217\371\235\276\000\000\000"
+ "\000\000\000L\276\001\200\000\000\217\371\235\276\001\200\000\000\000\000"
+ "L\276\000\000\000\000\007\341\3629\000\000\000\000\177\333\2426\001\200\000"
+ "\000\007\341\3629\001\200\000\000\177\333\2426\000\000\000\000\373\312\001"
+ "\200\177\221\000\000\333\346L\303\001\200\000\000\373\312\001\200\001\200"
+ "\000\000\373\312\001\200\204\306\000\000\373\312\001\200|9\000\000\373\312"
+ "\001\200\201n\000\000\373\312\001\200\377\177\000\000\333\346L\303\377\177"
+ "\000\000\333\346L\303\001\200\000\000\333\346L\303\377\177\000\000\333\346"
+ "L\303\000\000\000\000v.\212\321\377\177\000\000v.\212\321\000\000\000\000"
+ "\201$\2426\000\000\000\000\201$\2426\377\177\000\000\377\177\0055\377\177"
+ "\000\000\264<%\031\001\200\000\000\377\177\0055\001\200\000\000\264<%\031"
+ "\000\000\000\000\264<%\031\377\177\000\000L\303\333\346\000\000\000\000L"
+ "\303\333\346\377\177\000\000/\363\217\277\001\200\000\000/\363\217\277\000"
+ "\000\000\000\264A\000\000\377\177\000\000\264A\000\000\000\000\000\000L\303"
+ "\333\346\001\200\000\000L\303\333\346\000\000\000\000\333\346\264<\000\000"
+ "\000\000\333\346\264<\001\200\000\000%\031\264<\000\000\000\000%\031\264"
+ "<\001\200\000\000\3629\371\036\000\000\000\000\264<%\031\001\200\000\000"
+ "\264<%\031\000\000\000\000\3629\371\036\001\200\000\000\257)6\315\001\200"
+ "\000\000\257)6\315\000\000\000\000\377\177\212\346\001\200\000\000\377\177"
+ "\373\312\377\177\000\000\377\177\373\312\001\200\000\000\377\177\212\346"
+ "\377\177\000\000\377\177\000\000\001\200\000\000\377\177\000\000\377\177"
+ "\000\000L\303%\031\001\200\000\000L\303%\031\000\000\000\000L\303%\031\001"
+ "\200\000\000\001\200v\031\001\200\000\000\001\200\0055\001\200\000\000 \301"
+ "\023\023\001\200\000\000\217\277\321\014\001\200\000\000\333\346L\303\001"
+ "\200\000\000\212\346\001\200\001\200\000\000\373\312\001\200\001\200\000"
+ "\000\355\354 \301\001\200\000\000/\363\217\277\001\200\000\000\001\200\005"
+ "5\377\177\000\000L\303%\031\001\200\000\000\001\200\0055\001\200\000\000"
+ "L\303%\031\000\000\000\000L\303%\031\377\177\000\000v.\212\321\001\200\000"
+ "\000v.\212\321\000\000\000\000\000\000\000\000\377\177\000\000 \301\023\023"
+ "\377\177\000\000L\303%\031\377\177\000\000\355\354 \301\377\177\000\000\333"
+ "\346L\303\377\177\000\000\2426\177\333\377\177\000\000\264<\333\346\377\177"
+ "\000\000\3629\007\341\377\177\000\000\007\341\016\306\377\177\000\000\177"
+ "\333^\311\377\177\000\000q\006\235\276\377\177\000\000\321\014\217\277\377"
+ "\177\000\000%\031L\303\377\177\000\000\023\023 \301\377\177\000\000L\303"
+ "\333\346\377\177\000\000\001\200\373\312\377\177\000\000\016\306\007\341"
+ "\377\177\000\000\016\306\371\036\377\177\000\000^\311\201$\377\177\000\000"
+ "\340>\355\354\377\177\000\000\377\177\373\312\377\177\000\000\373\312\001"
+ "\200\377\177\000\000q@\321\014\377\177\000\000\264<%\031\377\177\000\000"
+ "\340>\023\023\377\177\000\000\3629\371\036\377\177\000\000cAq\006\377\177"
+ "\000\000\0055\001\200\377\177\000\000\371\036\016\306\377\177\000\000\023"
+ "\023\340>\377\177\000\000%\031\264<\377\177\000\000\0055\377\177\377\177"
+ "\000\000\217\371cA\377\177\000\000/\363q@\377\177\000\000\355\354\340>\377"
+ "\177\000\000\333\346\264<\377\177\000\000\201$\2426\377\177\000\000\371\036"
+ "\3629\377\177\000\000\007\341\3629\377\177\000\000\373\312\377\177\377\177"
+ "\000\000\235\276\217\371\377\177\000\000\217\277/\363\377\177\000\000\001"
+ "\200\0055\377\177\000\000\257)\3122\377\177\000\000\377\177\0055\377\177"
+ "\000\000\3122Q\326\377\177\000\000Q\3266\315\377\177\000\000 \301\355\354"
+ "\377\177\000\0006\315\257)\377\177\000\000\377\177\377\177\001\200\000\000"
+ "\3122\257)\001\200\000\000v.v.\001\200\000\000\000\000\377\177\001\200\000"
+ "\000q\006cA\001\200\000\000\000\000\264A\001\200\000\000cA\217\371\001\200"
+ "\000\000\264A\000\000\001\200\000\000\377\177\000\000\001\200\000\000\000"
+ "\000\001\200\001\200\000\000\217\371\235\276\001\200\000\000\000\000L\276"
+ "\001\200\000\000\257)6\315\001\200\000\000v.\212\321\001\200\000\000\377"
+ "\177\001\200\001\200\000\000\206U\001\200\001\200\000\000\377\177\001\200"
+ "\001\200\000\000\201n\001\200\001\200\000\000\001\200\000\000\001\200\000"
+ "\000\235\276q\006\001\200\000\000L\276\000\000\001\200\000\000\177\221\377"
+ "\177\001\200\000\000\212\321v.\001\200\000\000\001\200\377\177\001\200\000"
+ "\000Q\326\3122\001\200\000\000\001\200\001\200\001\200\000\0006\315Q\326"
+ "\001\200\000\000\212\321\212\321\001\200\000\000\201n\001\200\201n\000\000"
+ "\0055\001\200\201n\000\000\201n\001\200\177\221\000\000\206U\001\200\001"
+ "\200\000\000\0055\001\200\001\200\000\000\0055\001\200\177\221\000\000\005"
+ "5\001\200\377\177\000\000\0055\001\200\377\177\000\000\212\346\001\200\001"
+ "\200\000\000\000\000\001\200\001\200\000\000\373\312\001\200\001\200\000"
+ "\000\373\312\001\200\177\221\000\000\373\312\001\200\201n\000\000\377\177"
+ "\001\200\377\177\000\000\377\177\001\200\201n\000\000\377\177\001\200\177"
+ "\221\000\000\377\177\001\200\001\200\000\000\377\177\001\200\000\000\000"
+ "\000\000\000\001\200\377\177\000\000\373\312\001\200\377\177\000\000v\031"
+ "\377\177\001\200\000\000\000\000\377\177\001\200\000\000\0055\377\177\001"
+ "\200\000\000\000\000\377\177\377\177\000\000\0055\377\177\377\177\000\000"
+ "\177\221\377\177\000\000\000\000\177\221\377\177\177\221\000\000\373\312"
+ "\377\177\377\177\000\000\177\221\377\177\377\177\000\000\177\221\377\177"
+ "\001\200\000\000\001\200\377\177\001\200\000\000z\252\377\177\001\200\000"
+ "\000\373\312\377\177\001\200\000\000\264<\333\346\000\000\000\000v.\212\321"
+ "\000\000\000\000\3122Q\326\000\000\000\000\2426\177\333\000\000\000\000\362"
+ "9\007\341\000\000\000\000\000\000\000\000\000\000\000\000\264<\333\346\000"
+ "\000\000\000\264<\333\346\377\177\000\000\264<\333\346\377\177\000\000L\303"
+ "%\031\377\177\000\000\000\000\000\000\377\177\000\000\355\354\340>\000\000"
+ "\000\000\333\346\264<\000\000\000\000/\363q@\000\000\000\000\217\371cA\000"
+ "\000\000\000\000\000\264A\000\000\000\000\235\276\217\371\000\000\000\000"
+ "L\276\000\000\000\000\000\000\217\277/\363\000\000\000\000 \301\355\354\000"
+ "\000\000\000L\303\333\346\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\333\346L\303\377\177\000\000\333\346L\303\000\000\000\000\000\000\000\000"
+ "\377\177\000\000Q\326\3122\000\000\000\000\212\321v.\000\000\000\000\177"
+ "\333\2426\000\000\000\000\007\341\3629\000\000\000\000\355\354 \301\000\000"
+ "\000\000\333\346L\303\000\000\000\000/\363\217\277\000\000\000\000\217\371"
+ "\235\276\000\000\000\000\000\000L\276\000\000\000\000\000\000\000\000\000"
+ "\000\000\000%\031L\303\377\177\000\000%\031L\303\000\000\000\000\000\000"
+ "\000\000\377\177\000\000Q\3266\315\000\000\000\000\212\321\212\321\000\000"
+ "\000\000\177\333^\311\000\000\000\000\007\341\016\306\000\000\000\000\264"
+ "A\000\000\000\000\000\000\340>\355\354\000\000\000\000q@/\363\000\000\000"
+ "\000cA\217\371\000\000\000\000\000\000\000\000\000\000\000\000\264<%\031"
+ "\000\000\000\000\264<%\031\377\177\000\000\340>\023\023\000\000\000\000q"
+ "@\321\014\000\000\000\000cAq\006\000\000\000\000\235\276q\006\000\000\000"
+ "\000\217\277\321\014\000\000\000\000 \301\023\023\000\000\000\000L\303%\031"
+ "\000\000\000\000\264A\000\000\377\177\000\000\000\000\000\000\000\000\000"
+ "\000\264A\000\000\000\000\000\000L\276\000\000\377\177\000\000\264A\000\000"
+ "\377\177\000\000\000\000\000\000\377\177\000\000\016\306\371\036\000\000"
+ "\000\000^\311\201$\000\000\000\0006\315\257)\000\000\000\000%\031L\303\000"
+ "\000\000\000\371\036\016\306\000\000\000\000\201$^\311\000\000\000\000\257"
+ ")6\315\000\000\000\000\000\000\000\000\377\177\000\000v.\212\321\000\000"
+ "\000\000v.\212\321\377\177\000\000\000\000\000\000\000\000\000\000q\006\235"
+ "\276\000\000\000\000\321\014\217\277\000\000\000\000\023\023 \301\000\000"
+ "\000\000q\006cA\000\000\000\000%\031\264<\000\000\000\000\321\014q@\000\000"
+ "\000\000\023\023\340>\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000L\276\000\000\000\000\000\000\000\000\377\177\000\000\000\000\264A\000"
+ "\000\000\000\000\000\264A\377\177\000\000\016\306\007\341\000\000\000\000"
+ "^\311\177\333\000\000\000\0006\315Q\326\000\000\000\000\371\036\3629\000"
+ "\000\000\000\201$\2426\000\000\000\000\257)\3122\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\212\321\212\321\000\000\000\000\000\000\000\000"
+ "\377\177\000\000v.v.\000\000\000\000v.v.\377\177\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\036\311\000\201\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\177\000\177\000\177\000\177\000\201\000\201"
+ "\000\201\177\000\177\000\177\000\177\000\177\000\177\000\177\177\177\177"
+ "\177\177\177\177\177\177\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\177\177\177\177\177\177\177\177\177\177\314\265\310\271"
+ "\316\263\306\273\177\177\177\177\177\177\177\177\177\177\201\000\201\000"
+ "\201\000\201\000\201\000\241_\312$\000\177\000\177\207\006\213\012\216\015"
+ "\207\006\240\037\242!\242!\235\034\246\333\246\333\246\333\246\333\246\333"
+ "\246\333\246\333\246\333\230C\336\332jx\304\275\304\275R\323M\316K\314T\325"
+ "Z\333Z\333Z\333Z\333Z\333.\037h3\000\177\000\177\000\177\000\177\275\304"
+ "\273\306\271\310\275\304\337^\341`\337^\344c^!`\037c\034^!\012\213\006\207"
+ "\015\216\006\207\077@\077@\077@\077@\077@\077@\077@\077@\265\314\263\316"
+ "k\024r\015u\012h\027!^\037`!^\034c\354\225\363\216\351\230\366\213\344\235"
+ "\341\240\372\207\372\207E:C<C<G8\254+\252)\252)\256-\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\333Z\333Z\333Z\333Z\333Z\000\201\000"
+ "\201\000\201\000\201\000\201\300@\300@\300@\300@\300@\333\246\333\246\333"
+ "\246\333\246\333\246\327\252\325\254\327\252\323\256Z%Z%Z%Z%Z%\026!RX\000"
+ "\177\000\177\000\177\000\177\275<\273:\2718\275<\216\363\225\354\230\351"
+ "\213\366\300\301\301\300\301\300\300\301\300\301\224R\255\373\000\177\000"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\034\235\027\230\037"
+ "\240\024\225R-M2K4T+G\310E\306\177\177\177\177\177\177\177\177\177\177\000"
+ "\201\000\201\000\201\000\201\177\000\177\000\177\000\177\000\177\000\177"
+ "\0007\356[6f\235\225\024\230\027\351h\354kV\327V\327:E<C8G<C\366u\372y\363"
+ "r\372y)V+T)V-R\000\177\000\177\000\177\000\177\000\177u\366y\372y\372r\363"
+ "\2632\2654\207\372\207\372\235\344\240\341c\344h\351k\354`\341!\242!\242"
+ "@\300@\300@\300@\300\026\324g\307b\236:\273<\2758\271<\275\323R\316M\325"
+ "T\314K\327V\327V\012u\006y\015r\006y-\2562\263+\2544\265\246%\246%\246%\246"
+ "%\246%\246%\246%\246%\250@\001\324kXC\304C\3042M4K%\246%\246%\246%\246%\246"
+ "\242\337\242\337\027h\024ky\006y\006V)V))\252)\252\337\242\337\242\254\325"
+ "\252\327\252\327\256\323\310G\306E\177\000\177\000\177\000\177\000\177\000"
+ "\177\000^\337^\337\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177%Z%Z%Z%Z%Z\304C\304C\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177U\201l@\000\201\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\352\337\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000L\000\177\000\177\000\177\000\177\177\177\177\177\177\177\177"
+ "\177\177\177%Z%Z%Z\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177Z\333Z\333Z\333Z\333\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177j\025"
+ "Z%Z%j\025\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\333Z\333Z\333Z\177\177\177\177\177\177\177\177\177\177\177\177\177\177\000"
+ "\201\000\201\000\201\341\337\032\350\020\366\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\300\300\300\301\300\301\300\300\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\000\177\000\177\000\177"
+ "\000\177\000\177\177\177\177\177\177\177\177\177\177\177\177L\315@\300L\315"
+ "@\300@\300\000\000\000\000\001\000\002\000\001\000\000\000\003\000\003\000"
+ "\000\000\004\000\005\000\006\000\007\000\006\000\005\000\010\000\006\000"
+ "\010\000\011\000\012\000\013\000\014\000\013\000\012\000\015\000\015\000"
+ "\012\000\016\000\017\000\012\000\020\000\021\000\022\000\023\000\022\000"
+ "\021\000\024\000\022\000\024\000\025\000\026\000\027\000\030\000\027\000"
+ "\026\000\031\000\031\000\026\000\032\000\033\000\034\000\035\000\034\000"
+ "\033\000\036\000\034\000\036\000\037\000 \000!\000\042\000!\000 \000#\000"
+ "$\000%\000&\000'\000(\000)\000(\000'\000*\000*\000'\000+\000*\000+\000,\000"
+ "-\000.\000/\000.\000-\0000\000.\0000\0001\0002\0003\0004\0003\0002\0005\000"
+ "5\0002\0006\0005\0006\0007\0008\0009\000:\0009\0008\000;\000;\0008\000<\000"
+ ";\000<\000=\000>\000\077\000@\000\077\000>\000A\000A\000>\000B\000C\000D"
+ "\000E\000D\000C\000F\000D\000F\000G\000H\000I\000J\000I\000H\000K\000L\000"
+ "M\000N\000M\000L\000O\000O\000L\000P\000Q\000R\000S\000R\000Q\000T\000T\000"
+ "Q\000U\000V\000W\000X\000V\000X\000Y\000Z\000[\000\134\000[\000Z\000]\000"
+ "^\000_\000`\000_\000^\000a\000b\000c\000d\000c\000b\000e\000e\000b\000f\000"
+ "f\000b\000g\000g\000b\000h\000h\000b\000i\000j\000k\000l\000K\000m\000I\000"
+ "m\000K\000n\000o\000p\000q\000p\000o\000r\000s\000t\000u\000t\000s\000v\000"
+ "v\000s\000w\000x\000y\000z\000x\000z\000{\000x\000{\000|\000x\000|\000}\000"
+ "~\000\177\000\200\000\177\000~\000\201\000\202\000\203\000\204\000\203\000"
+ "\202\000\205\000\206\000\207\000\210\000\207\000\206\000\211\000\212\000"
+ "\213\000\214\000\213\000\212\000\215\000\216\000\217\000\220\000\217\000"
+ "\216\000\221\000\221\000\216\000\222\000\222\000\216\000\223\000\222\000"
+ "\223\000\224\000\224\000\223\000\225\000\200\000\226\000\227\000\226\000"
+ "\200\000\177\000\230\000\231\000\232\000\231\000\230\000\233\000\234\000"
+ "\235\000\236\000\235\000\234\000\237\000\240\000\241\000\242\000\241\000"
+ "\240\000\243\000\244\000\242\000\245\000\242\000\244\000\240\000\243\000"
+ "\246\000\241\000\246\000\243\000\247\000\250\000\251\000\252\000\251\000"
+ "\250\000\253\000\254\000\255\000\256\000\255\000\254\000\257\000\260\000"
+ "\261\000\262\000\261\000\260\000\263\000\263\000\260\000\264\000\263\000"
+ "\264\000\265\000\266\000\267\000\270\000\267\000\266\000\271\000\271\000"
+ "\266\000\272\000\273\000\274\000\275\000\274\000\273\000\276\000\274\000"
+ "\276\000\277\000\300\000\301\000\302\000\301\000\300\000\303\000\303\000"
+ "\300\000\304\000\305\000\306\000\307\000\306\000\305\000\310\000\310\000"
+ "\305\000\311\000\312\000\313\000\314\000\313\000\312\000\315\000\315\000"
+ "\312\000\316\000\317\000\320\000\321\000\320\000\317\000\322\000\322\000"
+ "\317\000\323\000\324\000\325\000\326\000\325\000\324\000\327\000\330\000"
+ "\331\000\332\000\331\000\330\000\333\000\333\000\330\000\334\000\335\000"
+ "\336\000\337\000\335\000\337\000\340\000\335\000\340\000\341\000\335\000"
+ "\341\000\342\000\343\000\344\000\345\000\344\000\343\000\346\000\347\000"
+ "\350\000\351\000\350\000\347\000\352\000\353\000\354\000\355\000\354\000"
+ "\353\000\356\000\356\000\353\000\357\000\360\000\361\000\042\000\360\000"
+ "\042\000\362\000\360\000\362\000\363\000\364\000\365\000\366\000\365\000"
+ "\364\000\367\000\365\000\367\000\370\000\365\000\370\000\371\000\372\000"
+ "\373\000\374\000\373\000\372\000\375\000\376\000\377\000\000\001\377\000"
+ "\376\000\001\001q\000\002\001\003\001\002\001q\000p\000\004\001\005\001\006"
+ "\001\005\001\004\001\007\001\007\001\004\001\010\001\011\001\012\001\013"
+ "\001\012\001\011\001\014\001\015\001\016\001\017\001\016\001\015\001\020"
+ "\001\020\001\015\001\021\001\021\001\015\001\022\001\023\001\024\001\025"
+ "\001\134\000\026\001\027\001\026\001\134\000[\000\210\000\233\000\230\000"
+ "\233\000\210\000\207\000\205\000\030\001\203\000\030\001\205\000\031\001"
+ "\032\001r\000o\000r\000\032\001\033\001\034\001\035\001\036\001\035\001\034"
+ "\001\037\001 \001!\001\042\001!\001 \001#\001$\001%\001&\001%\001$\001'\001"
+ "(\001)\001*\001)\001(\001+\001+\001(\001,\001-\001.\001/\001.\001-\0010\001"
+ "1\001\257\000\254\000\257\0001\0012\0013\001\352\000\347\000\352\0003\001"
+ "4\001\351\0005\0016\0015\001\351\000\350\0007\0018\0019\0018\0017\001:\001"
+ ";\001\374\000<\001\374\000;\001\372\000=\001>\001\077\001>\001=\001@\001"
+ "A\001B\001C\001D\001E\001F\001E\001D\001G\001H\001I\001J\001I\001H\001K\001"
+ "\027\001a\000^\000a\000\027\001\026\001L\001J\001M\001J\001L\001H\001N\001"
+ "O\001P\001O\001N\001Q\001\327\000J\000\325\000J\000\327\000H\000R\001S\001"
+ "T\001S\001R\001U\001V\001W\001X\001W\001V\001Y\001W\001Y\001Z\001W\001Z\001"
+ "[\001W\001[\001\134\001W\001\134\001]\001^\001_\001`\001\003\001a\001b\001"
+ "a\001\003\001\002\001'\001c\001%\001c\001'\001d\001e\001f\001g\001f\001e"
+ "\001h\001h\001e\001i\001\375\000\214\000\373\000\214\000\375\000\212\000"
+ "6\001j\001k\001j\0016\0015\001\237\000l\001\235\000l\001\237\000m\001\232"
+ "\000n\001o\001n\001\232\000\231\0009\0010\001-\0010\0019\0018\001p\001\001"
+ "\001\376\000\001\001p\001q\001r\001T\001s\001T\001r\001R\001t\001\245\000"
+ "u\001\245\000t\001\244\000v\001w\001x\001w\001v\001y\001K\001z\001I\001z"
+ "\001K\001{\001U\001F\001S\001F\001U\001D\001m\001P\001l\001P\001m\001N\001"
+ "d\001\036\001c\001\036\001d\001\034\001|\001}\001~\001}\001|\001\177\001"
+ "\177\001|\001\200\001\177\001\200\001\201\001\000\001\253\000\250\000\253"
+ "\000\000\001\377\000\202\001:\0017\001:\001\202\001\203\001\204\001\205\001"
+ "\206\001\205\001\204\001\207\001\205\001\207\001\210\001\211\001\212\001"
+ "\213\001\212\001\211\001\214\001\212\001\214\001\215\001{\000z\000Y\000\345"
+ "\0002\0011\0012\001\345\000\344\000\031\001\042\001\030\001\042\001\031\001"
+ " \001\216\001\217\001\220\001\217\001\216\001\221\001\221\001\216\001\222"
+ "\001\227\000y\001v\001y\001\227\000\226\000{\001\223\001z\001\223\001{\001"
+ "\224\001\225\001\010\000\005\000\010\000\225\001\011\000\225\001\226\001"
+ "\011\000\226\001\225\001\227\001A\000\225\001\077\000\225\001A\000B\000\230"
+ "\001\225\001\231\001\225\001\230\001\077\000\232\001\233\001\225\001\233"
+ "\001\232\001\234\001\235\001\225\001\236\001\225\001\235\001\231\001\237"
+ "\001\225\001B\000\225\001\237\001\240\001\240\001\241\001\225\001\241\001"
+ "\240\001\242\001\022\000\243\001\244\001\243\001\022\000\245\001\245\001"
+ "\022\000\025\000\024\000\225\001\025\000\225\001\024\000\021\000\225\001"
+ "\246\001\227\001\246\001\225\001\247\001\233\001\002\000\225\001\002\000"
+ "\233\001\250\001\014\000\015\000\225\001\015\000\014\000\013\000\251\001"
+ "\250\001\233\001\250\001\251\001\002\000\002\000\251\001\000\000@\000\231"
+ "\001\252\001\231\001@\000\230\001\230\001@\000\077\000\253\001\254\001\225"
+ "\001\254\001\253\001\255\001\254\001\036\000\225\001\036\000\254\001\256"
+ "\001\003\000\253\001\225\001\253\001\003\000\257\001\260\001\261\001\241"
+ "\001\261\001\260\001\014\000\014\000\260\001\012\000\262\001\031\000\032"
+ "\000\031\000\262\001\263\001\031\000\263\001\264\001\225\001\265\001\266"
+ "\001\265\001\225\001\030\000\225\001\267\001\270\001\267\001\225\001\266"
+ "\001\225\001\026\000\030\000\026\000\225\001\032\000\263\001\032\000\225"
+ "\001\032\000\263\001\262\001\271\001\263\001\225\001\263\001\271\001\272"
+ "\001\225\001\273\001=\000\273\001\225\001\270\001\225\001<\0008\000<\000"
+ "\225\001=\000=\000\274\001;\000\274\001=\000\273\001\274\001\273\001\270"
+ "\001\275\001\225\001\005\000\225\001\275\001\276\001\006\000\227\001\277"
+ "\001\227\001\006\000\226\001\226\001\006\000\011\000\035\000\271\001\225"
+ "\001\271\001\035\000\300\001\002\000\003\000\225\001\003\000\002\000\001"
+ "\000\241\001\014\000\225\001\014\000\241\001\261\001\256\001\037\000\036"
+ "\000\037\000\256\001\254\001\037\000\254\001\301\001\015\000\232\001\225"
+ "\001\232\001\015\000\302\001\245\001\225\001\243\001\225\001\245\001\025"
+ "\000\303\001\225\001\021\000\225\001\303\001\236\001\304\001\225\001\276"
+ "\001\225\001\304\001\243\001\036\000\035\000\225\001\035\000\036\000\033"
+ "\000\225\001\305\001\247\001\305\001\225\0018\000\306\001\307\001\310\001"
+ "\307\001\306\001N\000N\000\306\001L\000\311\001\312\001\313\001\312\001\311"
+ "\001\266\000\312\001\266\000\270\000\314\0011\0000\0001\000\314\001\315\001"
+ "1\000\315\001\316\001\215\001\317\001\212\001\317\001\215\001\320\001\317"
+ "\001\320\001\321\001\322\001\277\000\276\000\277\000\322\001\323\001\277"
+ "\000\323\001\324\001\325\001\326\001\327\001\210\001\330\001\205\001\330"
+ "\001\210\001\331\001\330\001\331\001\332\001\333\001\334\001\335\001\334"
+ "\001\333\001\006\001\334\001\006\001\336\001\336\001\006\001\005\001G\000"
+ "\337\001D\000\337\001G\000\340\001\337\001\340\001\341\001\342\001$\000&"
+ "\000$\000\342\001\343\001\344\001\345\001\327\001\345\001\344\001\346\001"
+ "\346\001\344\001\347\001\020\000\343\001\342\001\343\001\020\000\350\001"
+ "\351\001\020\000\012\000&\000\347\001\344\001\347\001&\000%\000\013\001\352"
+ "\001\353\001\352\001\013\001\354\001\354\001\013\001\355\001\356\001\014"
+ "\001\011\001\012\001\355\001\013\001\357\001\342\001\360\001\342\001\357"
+ "\001\020\000\361\001\327\001\362\001\327\001\361\001\344\001\360\001&\000"
+ "\363\001&\000\360\001\342\001\364\001\356\001\011\001\356\001\364\001\365"
+ "\001\252\001>\000@\000\363\001\344\001\361\001\344\001\363\001&\000Y\000"
+ "\366\001\367\001\366\001Y\000\370\001\370\001Y\000z\000}\000|\000X\000X\000"
+ "{\000Y\000{\000X\000|\000\371\001}\000X\000}\000\371\001\372\001x\000W\000"
+ "\031\000\341\000\340\000\373\001\373\001\337\000\374\001\337\000\373\001"
+ "\340\000\042\000\373\001\362\000\373\001\042\000!\000#\000\342\000!\000\342"
+ "\000#\000\375\001\335\000\376\001;\000!\000\341\000\373\001\341\000!\000"
+ "\342\000\362\000\374\001\363\000\374\001\362\000\373\001\363\000\377\001"
+ "\000\002\377\001\363\000\374\001\374\001\001\002\377\001\001\002\374\001"
+ "\002\002\002\002\374\001\337\000\003\002\004\002\366\000\004\002\003\002"
+ "\005\002\005\002\003\002\006\002\006\002\003\002\007\002\222\001\010\002"
+ "\221\001\010\002\222\001\011\002\011\002\222\001\012\002\013\002\014\002"
+ "\015\002\016\002\366\000\017\002\366\000\016\002\020\002\366\000\020\002"
+ "\021\002\366\000\021\002\022\002\366\000\023\002\024\002\023\002\366\000"
+ "\025\002\025\002\366\000\026\002\026\002\366\000\027\002\030\002\031\002"
+ "\032\002\031\002\030\002\033\002\033\002\030\002t\000\033\002t\000v\000\034"
+ "\002\366\000\035\002\366\000\034\002\036\002\366\000\036\002\037\002\366"
+ "\000\037\002\017\002\366\000 \002!\002 \002\366\000\042\002\042\002\366\000"
+ "#\002#\002\366\000$\002%\002&\002'\002&\002%\002(\002(\002%\002\331\000("
+ "\002\331\000\333\000\366\000)\002*\002)\002\366\000+\002+\002\366\000,\002"
+ ",\002\366\000!\002-\002\003\002\366\000\003\002-\002.\002.\002-\002/\002"
+ "/\002-\0020\002\304\0001\002\303\0001\002\304\0002\0022\002\304\0003\002"
+ "\254\001\243\001\225\001\365\000-\002\366\000-\002\365\0004\002-\0024\002"
+ "5\002-\0025\0026\0027\002\366\000\024\002\366\0007\0028\002\366\0008\002"
+ "9\002\366\0009\002:\002;\002<\002=\002<\002;\002\305\000\305\000;\002\311"
+ "\000>\002\077\002@\002A\002\366\000:\002\366\000A\002B\002\366\000B\002C"
+ "\002\366\000C\002\035\002\004\002D\002\366\000D\002\004\002E\002E\002\004"
+ "\002F\002F\002\004\002G\002H\002I\002J\002I\002H\002K\002K\002H\002\354\000"
+ "\354\000H\002\355\000D\002$\002\366\000$\002D\002L\002L\002D\002M\002M\002"
+ "D\002N\002O\002\366\000\022\002\366\000O\002P\002P\002O\002Q\002P\002Q\002"
+ "R\002S\002\022\001T\002\022\001S\002U\002U\002S\002V\002U\002V\002W\002\366"
+ "\000X\002\027\002X\002\366\000Y\002Y\002\366\000Z\002Z\002\366\000*\002P"
+ "\002\364\000\366\000\364\000P\002[\002\364\000[\002\134\002\364\000\134\002"
+ "]\002^\002@\001_\002@\001^\002`\002`\002^\002a\002`\002a\002b\002\000\000"
+ "\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003\000"
+ "\000\000\004\000\003\000\004\000\005\000\006\000\006\000\007\000\005\000"
+ "\007\000\005\000\010\000\006\000\010\000\010\000\011\000\006\000\011\000"
+ "\012\000\013\000\013\000\014\000\012\000\014\000\012\000\015\000\013\000"
+ "\015\000\012\000\016\000\015\000\016\000\012\000\020\000\016\000\020\000"
+ "\021\000\022\000\022\000\023\000\021\000\023\000\021\000\024\000\022\000"
+ "\024\000\024\000\025\000\022\000\025\000\026\000\027\000\027\000\030\000"
+ "\026\000\030\000\026\000\031\000\027\000\031\000\026\000\032\000\031\000"
+ "\032\000\033\000\034\000\034\000\035\000\033\000\035\000\033\000\036\000"
+ "\034\000\036\000\036\000\037\000\034\000\037\000 \000!\000!\000\042\000 "
+ "\000\042\000 \000#\000!\000#\000$\000%\000%\000&\000$\000&\000'\000(\000"
+ "(\000)\000'\000)\000\037\000'\000\037\000(\000'\000+\000\037\000+\000\034"
+ "\000+\000-\000.\000.\000/\000-\000/\000-\0000\000.\0000\0000\0001\000.\000"
+ "1\000\022\0003\000\023\0003\000\022\0005\0003\0005\000\022\0006\0005\000"
+ "6\0006\0007\0005\0007\000#\0008\000 \0008\0008\000;\000#\000;\0008\000<\000"
+ ";\000<\000<\000=\000;\000=\000>\000\077\000\077\000@\000>\000@\000>\000A"
+ "\000\077\000A\000>\000B\000A\000B\0005\000C\0007\000C\000C\000F\0005\000"
+ "F\000F\000G\0005\000G\000H\000I\000I\000J\000H\000J\000H\000K\000I\000K\000"
+ "'\000M\000M\000N\000'\000N\000'\000O\000M\000O\000)\000O\000\027\000R\000"
+ "\030\000R\000\027\000T\000R\000T\000\027\000U\000T\000U\000\027\000X\000"
+ "U\000X\000X\000Y\000U\000Y\000Z\000[\000[\000\134\000Z\000\134\000Z\000]"
+ "\000[\000]\000/\000^\000/\000`\000^\000`\000-\000^\000b\000c\000c\000d\000"
+ "b\000d\000$\000b\000$\000c\000%\000b\000b\000g\000%\000g\000b\000h\000g\000"
+ "h\000b\000i\000h\000i\000b\000l\000i\000l\000K\000m\000I\000m\000\021\000"
+ "K\000\021\000m\000o\000p\000p\000q\000o\000q\000o\000r\000p\000r\000s\000"
+ "t\000t\000u\000s\000u\000s\000v\000t\000v\000s\000w\000v\000w\000s\000z\000"
+ "w\000z\000z\000{\000w\000{\000{\000|\000w\000|\000|\000}\000w\000}\000~\000"
+ "\177\000\177\000\200\000~\000\200\000~\000\201\000\177\000\201\000\202\000"
+ "\203\000\203\000\204\000\202\000\204\000\202\000\205\000\203\000\205\000"
+ "\206\000\207\000\207\000\210\000\206\000\210\000\206\000\211\000\207\000"
+ "\211\000\212\000\213\000\213\000\214\000\212\000\214\000B\000\212\000B\000"
+ "\213\000\216\000\217\000\217\000\220\000\216\000\220\000\216\000\221\000"
+ "\217\000\221\000\216\000\222\000\221\000\222\000\015\000\216\000\015\000"
+ "\222\000\015\000\224\000\222\000\224\000\016\000\224\000N\000\200\000N\000"
+ "\227\000\200\000\227\000N\000\177\000\230\000\231\000\231\000\232\000\230"
+ "\000\232\000\230\000\233\000\231\000\233\000\234\000\235\000\235\000\236"
+ "\000\234\000\236\000\234\000\237\000\235\000\237\000\240\000\241\000\241"
+ "\000\242\000\240\000\242\000\240\000\243\000\241\000\243\000\242\000\244"
+ "\000\242\000\245\000\244\000\245\000\240\000\244\000T\000\243\000T\000\241"
+ "\000R\000\243\000m\000\250\000m\000\252\000\250\000\252\000\250\000\253\000"
+ "m\000\253\000\254\000\255\000\255\000\256\000\254\000\256\000\254\000\257"
+ "\000\255\000\257\000\006\000\261\000\007\000\261\000\006\000\263\000\261"
+ "\000\263\000\006\000\264\000\263\000\264\000\264\000\265\000\263\000\265"
+ "\000\245\000\266\000\242\000\266\000u\000\266\000u\000\245\000s\000\266\000"
+ "h\000\273\000i\000\273\000\273\000\276\000h\000\276\000\276\000\277\000h"
+ "\000\277\0006\000C\0006\000\303\000C\000\303\0006\000\304\000\303\000\304"
+ "\000\261\000\305\000\261\000\307\000\305\000\307\000\007\000\305\000\005"
+ "\000\305\000+\000~\000+\000\201\000\034\000~\000\035\000~\000/\000\317\000"
+ ".\000\317\000`\000\317\000\317\000\323\000`\000\323\000\324\000\325\000\234"
+ "\000\325\000\234\000\324\000\324\000\327\000\325\000\327\000\204\000\330"
+ "\000\204\000\332\000\330\000\332\000\202\000\330\000\330\000\334\000\202"
+ "\000\334\000\330\000\337\000\334\000\337\000\337\000\340\000\334\000\340"
+ "\000\340\000\341\000\334\000\341\000\341\000\342\000\334\000\342\0008\000"
+ "\344\000\344\000\345\0008\000\345\0008\000\346\000\344\000\346\000\347\000"
+ "\350\000\350\000\351\000\347\000\351\000\347\000\352\000\350\000\352\000"
+ " \000\346\000 \000\356\000\346\000\356\000 \000\357\000\356\000\357\000\042"
+ "\000\357\000\042\000\362\000\357\000\362\000\362\000\363\000\357\000\363"
+ "\000~\000\206\000\206\000\366\000~\000\366\000\200\000\206\000\206\000\227"
+ "\000\227\000\371\000\206\000\371\000\372\000\373\000\373\000\374\000\372"
+ "\000\374\000\372\000\375\000\373\000\375\000F\000\377\000G\000\377\000F\000"
+ "\001\001\377\000\001\001q\000\002\001\002\001\003\001q\000\003\001p\000\002"
+ "\001\330\000\005\001\005\001\006\001\330\000\006\001\330\000\007\001\005"
+ "\001\007\001\332\000\007\001\011\001\012\001\012\001\013\001\011\001\013"
+ "\001\011\001\014\001\012\001\014\001\013\001\015\001\013\001\017\001\015"
+ "\001\017\001\011\001\015\001>\000\015\001>\000\011\001B\000\015\001\213\000"
+ "\015\0010\000\134\0000\000\027\001\134\000\027\0010\000[\000\210\000\233"
+ "\000\210\000\230\000\207\000\233\000\205\000\030\001\203\000\030\001\205"
+ "\000\031\001\030\001\031\001`\000r\000`\000o\000r\000\323\000~\000\034\001"
+ "~\000\036\001\034\001\036\001\035\000\034\001R\000 \001R\000\042\001 \001"
+ "\042\001\030\000 \001v\000%\001t\000%\001v\000'\001%\001'\001Z\000)\001]"
+ "\000)\001\004\000Z\000\004\000)\001\003\000Z\000\305\000-\001\307\000-\001"
+ "-\0010\001\305\0000\001\257\0001\001\254\0001\0011\0012\001\257\0002\001"
+ "\005\000\352\000\005\000\347\000\305\000\352\000\351\0005\0015\0016\001\351"
+ "\0006\001\350\0005\0017\0018\0018\0019\0017\0019\0017\001:\0018\001:\001"
+ "b\000\374\000l\000\374\000b\000\372\000\023\000\252\0003\000\252\000\021"
+ "\000\252\000\356\000D\001\356\000F\001D\001F\001\346\000D\001\276\000H\001"
+ "\273\000H\001H\001K\001\276\000K\001-\000\027\001^\000\027\001l\000\273\000"
+ "l\000H\001\015\001N\001\015\001P\001N\001P\001\213\000N\001J\000\327\000"
+ "J\000\325\000H\000\327\000\005\001R\001\007\001R\001R\001U\001\005\001U\001"
+ "\236\000V\001\236\000X\001V\001X\001\012\001V\001\236\000\012\001\236\000"
+ "\014\001\014\001[\001\236\000[\001[\001\134\001\236\000\134\001\324\000\134"
+ "\001\236\000\324\000\015\000\003\001\216\000\003\001\015\000\002\001'\001"
+ "c\001%\001c\001'\001d\001c\001d\001(\000O\000(\000\206\000O\000\206\000("
+ "\000\211\000\214\000\375\000\214\000\373\000\212\000\375\000\303\0006\001"
+ "\304\0006\001\303\0005\001\237\000l\001\235\000l\001\237\000m\001l\001m\001"
+ "\003\000\232\000Z\000\232\000\003\000\231\0000\0019\001-\0019\0010\0018\001"
+ "C\000\001\001\303\000\001\001\204\000\007\001\204\000R\001t\000\245\000t"
+ "\000\244\000O\000\371\000M\000\371\000K\001z\001\276\000z\001K\001{\001z"
+ "\001{\001F\001U\001\005\001F\001D\001U\001P\001m\001P\001l\001N\001m\001"
+ "\036\001d\001\036\001c\001\034\001d\0011\000\317\000\000\0001\000\000\000"
+ "\317\0001\000)\001\000\000)\001G\000\253\000G\000\250\000\253\000\377\000"
+ ":\001\202\0017\001\202\001\255\000\202\001\255\000:\001\263\000\202\001\265"
+ "\000\202\001\263\0007\001\263\0009\001\236\000\212\001X\001\212\001\235\000"
+ "\212\001l\001\212\001Y\000z\000Y\000{\000\345\0002\001\345\0001\001\344\000"
+ "2\001\031\001\042\001\030\001\042\001\031\001 \001\264\000\202\001\255\000"
+ "\264\000\256\000\264\000M\000\227\000\220\000{\001\220\000z\001\216\000{"
+ "\001\010\000\225\001\005\000\225\001\011\000\225\001\225\001\226\001\011"
+ "\000\226\001\256\000\225\001\256\000\226\001A\000\225\001\077\000\225\001"
+ "B\000\225\001\225\001\230\001\324\000\225\001\324\000\230\001\077\000\230"
+ "\001p\000\323\000\323\000\225\001p\000\225\001\327\000\225\001H\000\225\001"
+ "\212\000\225\001\375\000\225\001b\000\375\000b\000\225\001\022\000\304\000"
+ "\022\000\245\001\304\000\245\001\025\000\245\001\024\000\225\001\025\000"
+ "\225\001\021\000\225\001\254\000\225\0011\001\225\001\002\000\323\000\002"
+ "\000\225\001\323\000\250\001\002\000\250\001\014\000\015\000\015\000\225"
+ "\001\014\000\225\001\317\000\250\001\002\000\317\000@\000\324\000@\000\134"
+ "\001@\000\230\001\211\000\233\000\211\000\225\001\233\000\225\001\036\000"
+ "\211\000\036\000\225\001\211\000\256\001\036\000\256\001\003\000\233\000"
+ "\003\000\225\001d\000\261\001b\000\261\001\014\000d\000\014\000\261\001\012"
+ "\000d\000\031\000\262\001\032\000\262\001v\000\262\001\031\000v\000\031\000"
+ "w\000 \001\225\001\031\001\225\001\030\000\225\001\205\000\225\001\202\000"
+ "\225\001\026\000\225\001\032\000\225\001\032\000v\000v\000\225\001v\000d"
+ "\001d\001\225\001\225\001\273\001=\000\273\001=\000\225\001\202\000\273\001"
+ "<\000\225\0018\000\225\001=\000\334\000;\000\334\000\334\000\273\001\347"
+ "\000\225\001\351\000\225\001\006\000\256\000\006\000\226\001\035\000d\001"
+ "\035\000\225\001\002\000\003\000\014\000b\000\037\000\256\001\037\000\211"
+ "\000\015\000p\000\225\001\245\001\304\000\225\001K\000\225\0016\001\225\001"
+ "\035\000\036\000\345\000\225\001+\000\177\000+\000N\000U\000\241\000U\000"
+ "\266\000\241\000\266\0001\000[\0001\000]\000\017\001l\001\017\001\212\001"
+ "\017\001P\001\277\000z\001\220\000\277\000\217\000\277\000\217\000\327\001"
+ "\277\000\327\001\261\0009\001\261\000-\001\356\000\333\001\357\000\333\001"
+ "\006\001\333\001\356\000\006\001\006\001F\0013\000G\0003\000\250\000$\000"
+ "\342\001&\000\342\001c\000\342\001\277\000\344\001\327\001\344\001h\000\344"
+ "\001g\000\344\001\020\000c\000\020\000\342\001\020\000d\000&\000g\000&\000"
+ "\344\001\013\001\212\001\013\001X\001\013\001V\001\011\001[\001\016\000\342"
+ "\001\224\000\342\001\221\000\327\001\221\000\344\001&\000\224\000&\000\222"
+ "\000>\000[\001>\000\134\001\222\000\344\001Y\000\266\000Y\000s\000X\000|"
+ "\000X\000}\000X\000{\000\027\000}\000\027\000w\000\340\000\373\001\341\000"
+ "\373\001\337\000\373\001\337\000\374\001\373\001\374\001\042\000\373\001"
+ "\362\000\373\001!\000\373\001#\000\342\000!\000\342\000#\000\334\000!\000"
+ "\341\000\362\000\374\001\363\000\374\001\363\000\333\001\333\001\374\001"
+ "\006\001\374\001\330\000\374\001`\000\216\000\216\000\366\000`\000\366\000"
+ "`\000\003\001`\000q\000\256\000\366\000\255\000\366\000`\000\256\000\256"
+ "\000\323\000\203\000\366\000\204\000\366\000\366\000\030\001\366\000\042"
+ "\001R\000\366\000\352\000\366\000\305\000\366\000\350\000\366\000\366\000"
+ "5\001\303\000\366\000\324\000\366\000\234\000\366\000\366\000\225\001t\000"
+ "\366\000t\000\225\001\366\000D\001\346\000\366\000\366\000U\001\366\000R"
+ "\001\237\000\366\000\366\000m\001\366\000N\001\213\000\366\000b\000\366\000"
+ "l\000\366\000\204\000\225\001I\000\366\000m\000\366\000J\000\366\000\325"
+ "\000\366\000Z\000`\000Z\000\366\000Z\000^\000Z\000\027\001\304\000\366\000"
+ "\206\000\304\000\211\000\304\000Z\000\206\000Z\000\210\000Z\000\230\000\366"
+ "\0000\001\366\0008\001\366\000:\001\003\000\366\000\003\000\305\000\003\000"
+ "\005\000\257\000\366\000\366\0002\001\344\000\366\000l\000\216\000\216\000"
+ "H\001\216\000K\001\216\000\225\001\346\000\225\001l\000\213\000l\000\214"
+ "\000l\000\373\000\243\000\366\000t\000\243\000t\000\240\000B\000\366\000"
+ "R\000\225\001\366\000\001\001\366\000\377\000\253\000\366\000t\000~\000~"
+ "\000%\001~\000c\001\021\000\366\000~\000\225\001\300\310\000\000\377\177"
+ "\000\000\300\310\201n\201n\000\000\300\310\000\000\201n\000\000\300\310v"
+ "\031\377\177\000\000\300\310\0055\377\177\000\000\300\310\206U\377\177\000"
+ "\000\300\310\201n\377\177\000\000\300\310\000\000\000\000\000\000\300\310"
+ "\177\221\201n\000\000\300\310\000\000\201n\000\000\300\310\000\000MB\000"
+ "\000>\332\377\177\000\000\000\000\025\366\377\177\263\275\000\000>\332\377"
+ "\177\263\275\000\000\025\366\377\177\314\323\000\000\025\366\377\177)\344"
+ "\000\000\015\013\377\177\201n\000\000\015\013\000\000\377\177\000\000\015"
+ "\013\000\000\201n\000\000\015\013F\014\377\177\000\000\015\013\216\031\377"
+ "\177\000\000\015\0139)\377\177\000\000\015\013\262=\377\177\000\000\015\013"
+ "U\134\377\177\000\000\015\013\377\177\377\177\000\000@7\001\200\377\177\000"
+ "\000\300\310\001\200\001\200\000\000@7\001\200\001\200\000\000\300\310\001"
+ "\200\177\221\000\000\300\310\001\200\000\000\000\000\300\310\001\200\201"
+ "n\000\000\300\310\001\200\377\177\000\000\015\0139)\377\177\000\000\300\310"
+ "\201n\377\177\000\000\300\310\206U\377\177\000\000\300\310\377\177\377\177"
+ "\000\000\015\013\262=\377\177\000\000\300\310\377\177\000\000\000\000\300"
+ "\310\201n\263\275\000\000\300\310\201n\000\000\000\000\300\310\377\177\263"
+ "\275\000\000\025\366\377\1774,\000\000\025\366\000\000MB\000\000\025\366"
+ "\000\0004,\000\000\025\366\377\177MB\000\000\300\310\001\200\377\177\000"
+ "\000\300\310\177\221\377\177\000\000\300\310\377\177\377\177\000\000>\332"
+ "\377\177\201n\000\000\300\310\377\177\201n\000\000>\332\377\177\377\177\000"
+ "\000\025\366\377\177\327\033\000\000\277\014\377\177\000\000\000\000\025"
+ "\366\377\177\000\000\000\000\277\014\377\177\032\026\000\000\277\014\377"
+ "\1774,\000\000q\006\377\1774,\000\000q\006\377\177\314\323\000\000\025\366"
+ "\000\000\314\323\000\000\025\366\377\177\314\323\000\000\277\014\000\000"
+ "\314\323\000\000\277\014\377\177\314\323\000\000>\332\377\177\201n\000\000"
+ "\300\310\201n\201n\000\000\300\310\377\177\201n\000\000\300\310\000\000\201"
+ "n\000\000\015\013\000\000\201n\000\000\015\013\377\177\201n\000\000@7\000"
+ "\000\001\200\000\000@7\001\200\377\177\000\000@7\001\200\001\200\000\000"
+ "@7\000\000\377\177\000\000\015\0139)\001\200\000\000\300\310\0055\001\200"
+ "\000\000\300\310\206U\001\200\000\000\015\013\216\031\001\200\000\000\300"
+ "\310\177\221\177\221\000\000\300\310\000\000\001\200\000\000\300\310\177"
+ "\221\001\200\000\000\300\310\000\000\177\221\000\000\300\310\177\221\000"
+ "\000\000\000\300\310\001\200\177\221\000\000\300\310\001\200\000\000\000"
+ "\000\025\366\377\177\263\275\000\000\025\366\000\000\314\323\000\000\025"
+ "\366\000\000\263\275\000\000\025\366\377\177\314\323\000\000\025\366\000"
+ "\000MB\000\000\300\310MBMB\000\000\300\310\000\000MB\000\000\300\310\201"
+ "nMB\000\000\300\310\377\177MB\000\000>\332\377\177MB\000\000\025\366\377"
+ "\177MB\000\000\277\014\377\177\032\026\000\000\277\014\000\0004,\000\000"
+ "\277\014\000\000\032\026\000\000\277\014\377\1774,\000\000j#\377\177\346"
+ "\351\000\000\277\014\377\177\346\351\000\000j#\377\177\000\000\000\000\015"
+ "\013\216\031\377\177\000\000\300\310\0055\377\177\000\000\300\310\377\177"
+ "\000\000\000\000\300\310\377\177\263\275\000\000\277\014\377\177\314\323"
+ "\000\000\277\014\000\000\346\351\000\000\277\014\000\000\314\323\000\000"
+ "\277\014\377\177\346\351\000\000\300\310\001\200\201n\000\000j#\000\000\032"
+ "\026\000\000\277\014\377\177\032\026\000\000\277\014\000\000\032\026\000"
+ "\000j#\377\177\032\026\000\000\300\310\377\177\001\200\000\000\300\310\201"
+ "n\177\221\000\000\300\310\377\177\177\221\000\000\300\310\377\177MB\000\000"
+ "\300\310\201nMB\000\000\015\013\377\177\201n\000\000\015\013\377\177\377"
+ "\177\000\000\015\013\377\177\377\177\000\000>\332\377\177\377\177\000\000"
+ "\331\336\377\177\377\177\000\0008\363\377\177\377\177\000\000\363\364\377"
+ "\177\377\177\000\000q\006\377\177\314\323\000\000\300\310\000\000\177\221"
+ "\000\000\300\310\000\000\263\275\000\000\015\013\000\000\177\221\000\000"
+ "\300\310\201n\177\221\000\000\300\310\000\000\177\221\000\000\300\310\377"
+ "\177\177\221\000\000>\332\377\177\177\221\000\000\015\013\377\177\177\221"
+ "\000\000\277\014\000\0004,\000\000\025\366\377\1774,\000\000\025\366\000"
+ "\0004,\000\000q\006\377\1774,\000\000\277\014\377\1774,\000\000\300\310\005"
+ "5\001\200\000\000\300\310\206U\001\200\000\000\300\310\201n\001\200\000\000"
+ "\015\013F\014\377\177\000\000\300\310v\031\377\177\000\000\300\310\000\000"
+ "\001\200\000\000\015\013\000\000\001\200\000\000\300\310\001\200\001\200"
+ "\000\000>\332\377\177\001\200\000\000\015\013\377\177\001\200\000\0008\363"
+ "\377\177\001\200\000\000\015\013\377\177\177\221\000\000>\332\377\177\177"
+ "\221\000\000>\332\377\177\001\200\000\000\015\013\262=\001\200\000\000\300"
+ "\310\377\177\001\200\000\0008\363\377\177\001\200\000\000\015\013U\134\001"
+ "\200\000\000\015\013\000\000\377\177\000\000\300\310\000\000\377\177\000"
+ "\000\025\366\377\1774,\000\000\277\014\377\177\314\323\000\000\015\013\377"
+ "\177\001\200\000\000>\332\377\177\263\275\000\000\300\310\201n\263\275\000"
+ "\000\300\310\377\177\263\275\000\000\300\310MB\263\275\000\000\300\310\000"
+ "\000\263\275\000\000\025\366\000\000\263\275\000\000\025\366\377\177\263"
+ "\275\000\000\300\310MB\263\275\000\000\300\310\000\000\263\275\000\000\300"
+ "\310\377\177\377\177\000\000>\332\377\177MB\000\000\025\366\377\177MB\000"
+ "\000j#\377\177\346\351\000\000j#\000\000\032\026\000\000j#\000\000\346\351"
+ "\000\000j#\377\177\032\026\000\000j#\377\177\032\026\000\000j#\377\177\346"
+ "\351\000\000\300\310\377\177MB\000\000\015\013\216\031\001\200\000\000\015"
+ "\013\000\000\177\221\000\000\015\013\000\000\001\200\000\000\015\013\377"
+ "\177\177\221\000\000\015\0139)\001\200\000\000\015\013\262=\001\200\000\000"
+ "\015\013U\134\001\200\000\000\015\013\377\177\001\200\000\000\300\310\201"
+ "n\001\200\000\000\300\310\377\177\177\221\000\000\300\310\377\177\001\200"
+ "\000\000>\332\377\177\377\177\000\000\015\013U\134\377\177\000\000\300\310"
+ "MBMB\000\000j#\377\177\346\351\000\000\277\014\000\000\346\351\000\000\277"
+ "\014\377\177\346\351\000\000j#\000\000\346\351\000\000\300\310\377\177\201"
+ "n\000\000\015\013\377\177\377\177\000\000j#\377\177\032\026\000\000\277\014"
+ "\000\0004,\000\000j#\000\000\032\026\000\000\277\014\000\000\032\026\000"
+ "\000\025\366\000\000MB\000\000\025\366\000\0004,\000\000\300\310\000\000"
+ "\201n\000\000\300\310\000\000MB\000\000\015\013\000\000\177\221\000\000@"
+ "7\000\000\001\200\000\000\015\013\000\000\001\200\000\000j#\000\000\346\351"
+ "\000\000@7\000\000\377\177\000\000\277\014\000\000\314\323\000\000\300\310"
+ "\000\000\177\221\000\000\277\014\000\000\314\323\000\000\025\366\000\000"
+ "\263\275\000\000\025\366\000\000\263\275\000\000\300\310\000\000\263\275"
+ "\000\000\025\366\000\000\314\323\000\000\277\014\000\000\346\351\000\000"
+ "\015\013\000\000\201n\000\000\015\013\000\000\377\177\000\000\300\310\000"
+ "\000MB\000\000@7\001\200\377\177\000\000\300\310\177\221\377\177\000\000"
+ "\300\310\001\200\377\177\000\000@7\000\000\377\177\000\000\300\310\000\000"
+ "\377\177\000\000\300\310\177\221\001\200\000\000\300\310\001\200\001\200"
+ "\000\000@7\001\200\001\200\000\000@7\000\000\001\200\000\000\300\310\000"
+ "\000\001\200\000\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\261O\326*\000\177\000\177\000\177\000\177\000\177\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\000\000\000\000"
+ "\000\000\000\000\000\201\000\201\000\201\000\201\000\177\000\177\000\177"
+ "\000\177\000\201\000\201\000\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\000\177\000\177"
+ "\000\177\000\177\177\177\177\177\177\177\201\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\177\000\177\000\177\000\177\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\177\000\177\000\177\000\177"
+ "\000\000\177\000\177\000\177\000\000\000\000\000\177\000\177\177\000\177"
+ "\000\177\000\177\000\201\000\000\000\000\000\000\000\000\000\201\000\201"
+ "\000\201\000\201\000\201\000\000\177\000\177**\000L\000\000\000\000\000\000"
+ "\000\177\320@\241_\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\201\000\201\000\201\000\000\000\000\000"
+ "\177\201\177\201\201\000\000\177\000\177\000\177\000\177\000\177\201\201"
+ "\201\177\201\177\201\201\177\177\000\000\000\000\000\177\000\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\201\000\201\000"
+ "\201\000\000\177\000\177\177\000\177\000\177\000\177\000**UU\000\177\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\177\000"
+ "\177\000\177\000\000\000\000\201\000\177\177\177\177\177\177\177\177\201"
+ "\000\000\000\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\1776mLf\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\201\000\000\000\000\000\000\000"
+ "\000\000\000\177\201\201\201\201\177\201\177\201\000\177\000\000\001\000"
+ "\002\000\001\000\000\000\003\000\001\000\003\000\004\000\001\000\004\000"
+ "\005\000\001\000\005\000\006\000\002\000\007\000\010\000\007\000\011\000"
+ "\012\000\013\000\014\000\015\000\014\000\013\000\016\000\016\000\013\000"
+ "\017\000\020\000\021\000\022\000\021\000\020\000\023\000\023\000\020\000"
+ "\024\000\024\000\020\000\025\000\025\000\020\000\026\000\026\000\020\000"
+ "\027\000\027\000\020\000\030\000\031\000\032\000\033\000\032\000\031\000"
+ "\034\000\034\000\031\000\035\000\035\000\031\000\036\000\036\000\031\000"
+ "\037\000 \000!\000\042\000!\000 \000#\000#\000 \000$\000%\000&\000'\000&"
+ "\000%\000(\000)\000*\000+\000*\000)\000,\000\010\000-\000.\000/\0000\000"
+ "1\0000\000/\0002\0003\0004\0005\0004\0003\0006\0006\0003\0007\0007\0003\000"
+ "8\0009\000:\000;\000:\0009\000<\000<\0009\000=\000>\000\077\000@\000\077"
+ "\000>\000A\000A\000>\000B\000B\000>\000C\000D\000E\000F\000E\000D\000G\000"
+ "H\000I\000J\000I\000H\000K\000L\000M\000N\000M\000L\000O\000P\000Q\000R\000"
+ "Q\000P\000L\000S\000T\000U\000T\000S\000V\000W\000X\000Y\000X\000W\000Z\000"
+ "Z\000W\000[\000[\000W\000\134\000\134\000W\000]\000^\000_\000`\000_\000^"
+ "\000a\0004\000b\000c\000b\0004\000d\000e\000\042\000f\000\042\000e\000 \000"
+ "g\000\015\000h\000\015\000g\000\013\000i\000j\000k\000j\000i\000l\000\010"
+ "\000R\000m\000R\000\010\000P\000n\000o\000p\000o\000n\000q\000r\000s\000"
+ "t\000u\000'\000v\000'\000u\000%\0002\000w\0000\000w\0002\000x\000y\000z\000"
+ "{\000y\000{\000|\000y\000|\000}\000\017\000~\000\016\000\007\000O\000L\000"
+ "\177\000\007\000\200\000\201\000\202\000\203\000\202\000\201\000\204\000"
+ "\204\000\201\000\205\000\205\000\201\000\206\000\207\000\210\000\211\000"
+ "\210\000\207\000\212\000\212\000\207\000\213\000s\000M\000O\000M\000s\000"
+ "\214\000\214\000s\000\215\000\215\000s\000\216\000\217\000f\000\220\000f"
+ "\000\217\000e\000K\000\221\000I\000\221\000K\000\222\000L\000\223\000Q\000"
+ "\224\000\225\000\226\000\225\000\224\000\227\000\227\000\224\000\230\000"
+ "r\000\216\000s\000\231\000\232\000\233\000\232\000\231\000\234\000\232\000"
+ "\234\000\235\0003\0005\000\013\000\236\000\220\000\237\000\220\000\236\000"
+ "\217\0008\0003\000\240\000\017\000\241\000~\000\241\000\017\000c\000c\000"
+ "\017\0005\000c\0005\0004\000\242\000\235\000\234\000\000\000\010\000.\000"
+ "\010\000\000\000\002\000\243\000\244\000\245\000\244\000\243\000\246\000"
+ "\246\000\243\000\247\000\247\000\243\000\250\000\250\000\243\000\251\000"
+ "\252\000\253\000\007\000\254\000\001\000\006\000\255\0003\000\013\0003\000"
+ "\255\000\240\000\240\000\255\000\256\000\257\000\260\000\261\000\260\000"
+ "\257\000\262\000\263\000\264\000d\000\265\000\013\000g\000\013\000\265\000"
+ "\255\000\266\000\267\000\270\000\267\000\266\000\271\000\271\000\266\000"
+ "\272\000\271\000\272\000\273\000\271\000\273\000\274\000\271\000\274\000"
+ "\275\000\232\000\276\000\233\000\276\000\232\000J\000J\000\232\000H\000\277"
+ "\000\224\000\300\000\224\000\277\000\230\000$\000\301\000#\000\301\000$\000"
+ "{\000{\000$\000|\000|\000$\000\302\000\007\000P\000\010\0005\000\017\000"
+ "\013\000\303\000'\000\007\000'\000\303\000v\000L\000N\000\223\000\304\000"
+ "\305\000\306\000\305\000\304\000\307\000\310\000\001\000\254\000\302\000"
+ "}\000|\000}\000\302\000\311\000\010\000m\000-\0006\000d\0004\000d\0006\000"
+ "\312\000\313\000\314\000\315\000\316\000\313\000\317\000\320\000\316\000"
+ "\321\000\322\000\323\000\324\000\323\000\322\000\325\000\323\000\325\000"
+ "\326\000\325\000\322\000\327\000\327\000\322\000\330\000\331\000\177\000"
+ "\332\000\333\000\330\000\334\000\327\000\333\000\335\000\325\000\327\000"
+ "\336\000\326\000\325\000\314\000\326\000\314\000\313\000\326\000\313\000"
+ "\316\000\326\000\316\000\337\000\337\000\316\000\320\000\326\000\337\000"
+ "\340\000'\000\252\000\007\000\252\000'\000&\000\303\000\007\000\341\000\007"
+ "\000L\000P\000\342\000\343\000\344\000\343\000\342\000\237\000\237\000\342"
+ "\000\236\000\236\000\342\000\345\000\346\000\337\000\320\000\337\000\346"
+ "\000\340\000\222\000\347\000\221\000\347\000\222\000\350\000\350\000\222"
+ "\000\351\000\351\000\222\000\352\000\330\000\324\000\353\000\324\000\330"
+ "\000\322\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003"
+ "\000\001\000\003\000\003\000\004\000\001\000\004\000\004\000\005\000\001"
+ "\000\005\000\005\000\006\000\001\000\006\000\002\000\007\000\007\000\010"
+ "\000\002\000\010\000\002\000\012\000\007\000\012\000\013\000\014\000\014"
+ "\000\015\000\013\000\015\000\013\000\016\000\014\000\016\000\013\000\017"
+ "\000\016\000\017\000\020\000\021\000\021\000\022\000\020\000\022\000\020"
+ "\000\023\000\021\000\023\000\020\000\024\000\023\000\024\000\020\000\025"
+ "\000\024\000\025\000\020\000\026\000\025\000\026\000\020\000\027\000\026"
+ "\000\027\000\020\000\030\000\027\000\030\000\031\000\032\000\032\000\033"
+ "\000\031\000\033\000\031\000\034\000\032\000\034\000\031\000\035\000\034"
+ "\000\035\000\031\000\036\000\035\000\036\000\031\000\037\000\036\000\037"
+ "\000\006\000\025\000\005\000\025\000\025\000#\000\006\000#\000\026\000#\000"
+ "%\000&\000&\000'\000%\000'\000%\000(\000&\000(\000)\000*\000*\000+\000)\000"
+ "+\000)\000,\000*\000,\000\010\000\037\000\037\000.\000\010\000.\000#\000"
+ "0\0000\0001\000#\0001\000#\0002\0000\0002\0003\0004\0004\0005\0003\0005\000"
+ "3\0006\0004\0006\0003\0007\0006\0007\0003\0008\0007\0008\0009\000:\000\016"
+ "\000:\000\016\0009\0009\000<\000:\000<\0009\000=\000<\000=\000\001\0000\000"
+ "\001\0001\000\002\0000\000\022\0000\000\002\000\022\000\020\0000\000\031"
+ "\000D\000\033\000D\000D\000G\000\031\000G\000H\000I\000I\000J\000H\000J\000"
+ "H\000K\000I\000K\000L\000M\000M\000N\000L\000N\000L\000O\000M\000O\000\034"
+ "\000P\000\035\000P\000L\000P\000\034\000L\000\014\000:\000:\000U\000\014"
+ "\000U\000*\000X\000\012\000X\000\012\000*\000*\000Z\000X\000Z\000*\000[\000"
+ "Z\000[\000*\000\134\000[\000\134\000,\000\134\0006\000_\000_\000`\0006\000"
+ "`\0007\000_\0004\000b\000b\000c\0004\000c\0004\000d\000b\000d\000\005\000"
+ "\024\000\004\000\024\000\015\000%\000\015\000(\000\013\000%\000=\000j\000"
+ "<\000j\000=\000c\000c\000j\000\010\000\035\000\010\000\036\000\010\000P\000"
+ "6\000n\000`\000n\000n\000q\0006\000q\000r\000s\000s\000t\000r\000t\000'\000"
+ "[\000'\000Z\000%\000[\000\020\0002\000\030\0002\0002\000{\000\030\000{\000"
+ "{\000|\000\030\000|\000|\000}\000\030\000}\000\017\0009\000\007\000O\000"
+ "\007\000L\000\007\000\200\000O\000\200\000s\000\201\000O\000s\000O\000\201"
+ "\000t\000\201\000\201\000\205\000t\000\205\000\201\000\206\000\205\000\206"
+ "\000)\000_\000+\000_\0008\000_\000)\0008\000M\000s\000I\000s\000I\000M\000"
+ "J\000s\000s\000\216\000J\000\216\000\004\000\023\000\003\000\023\000K\000"
+ "M\000K\000\222\000M\000\222\000\032\000L\000\224\000\225\000\225\000\226"
+ "\000\224\000\226\000\206\000\224\000\206\000\225\000\205\000\224\000r\000"
+ "\216\000\224\000\232\000r\000\232\000r\000\224\000\226\000\232\000\226\000"
+ "\235\000\232\000\235\000\013\0005\000\013\0003\000\003\000\021\000\000\000"
+ "\021\000)\0003\000\017\000=\000\017\000c\000\017\0005\0005\000c\000\225\000"
+ "\235\000\000\000\010\000\000\000.\000\015\000&\000\015\000\246\000&\000\246"
+ "\000\015\000\200\000\200\000\246\000\015\000U\000U\000\200\000\007\000\246"
+ "\000\001\000#\0003\000\134\000\013\000\134\000)\000\134\000b\000n\000n\000"
+ "\261\000b\000\261\000b\000q\000d\000q\000\013\000[\000K\000\201\000\201\000"
+ "\222\000K\000\206\000H\000\206\000H\000\232\000\206\000\232\000\206\000\235"
+ "\000\216\000\232\000J\000\232\000t\000\224\000\026\0002\000\026\000{\000"
+ "\026\000|\000\027\000|\000\007\000P\000'\000X\000\007\000'\000\007\000X\000"
+ "\032\000N\000b\000j\000j\000\261\000\027\000}\0006\000d\000_\000n\000*\000"
+ "_\000\002\000*\000D\000\201\000D\000\222\000\201\000\261\000D\000\261\000"
+ "G\000\261\000<\000\201\000<\000\261\000<\000O\000O\000U\000<\000U\000G\000"
+ "n\000G\000_\000*\000G\000\022\000*\000\022\000G\000\021\000G\000'\000\246"
+ "\000\031\000.\000\000\000\031\000\021\000\031\000\000\000\022\000N\000\222"
+ "\000\032\000\222\000\033\000\222\000O\000\222\000s\356\010\344\377\177\000"
+ "\000\256\346\262\375\377\177\000\000\256\346:\351\377\177\000\000>\362%\351"
+ "\377\177\000\000\204\366\334\355\377\177\000\000;\373\042\362\001\200\000"
+ "\000\341\022\177\321\001\200\000\000\204\366\334\355\001\200\000\000X\000"
+ "\355\365\001\200\000\000\341\022/\332\001\200\000\000`\244\000@\177\221\000"
+ "\000`\244\000\300\177\221\000\000`\244\000@\231\247\000\000`\244\000@\263"
+ "\275\000\000`\244\000\300\263\275\000\000\265\321\000@\314\323\000\000\265"
+ "\321\000\300\263\275\000\000\265\321\000\300\314\323\000\000\265\321\000"
+ "@\263\275\000\000\012\377\000\300\346\351\000\000`\350\000@\346\351\000\000"
+ "`\350\000\300\346\351\000\000\012\377\000@\346\351\000\000\012\377\000@\032"
+ "\026\000\000`\350\000\300\032\026\000\000`\350\000@\032\026\000\000\012\377"
+ "\000\300\032\026\000\000\256\346F\314\377\177\000\000\256\346\000\300\201"
+ "n\000\000\256\346\000\300\377\177\000\000\256\346\000@\201n\000\000\256\346"
+ "\331\323\377\177\000\000\256\346\216\331\377\177\000\000\256\346:\351\377"
+ "\177\000\000\256\346\262\375\377\177\000\000\256\346U\034\377\177\000\000"
+ "\256\346\000@\377\177\000\000\265\321\000@MB\000\000\265\321\000\3004,\000"
+ "\000\265\321\000\300MB\000\000\265\321\000@4,\000\000`\350\000@\346\351\000"
+ "\000`\350\000\300\314\323\000\000`\350\000\300\346\351\000\000`\350\000@"
+ "\314\323\000\000\012\377\000@\032\026\000\000\012\377\000\300\000\000\000"
+ "\000\012\377\000\300\032\026\000\000\012\377\000\300\346\351\000\000\012"
+ "\377\000@\346\351\000\000\012\377\000@\346\351\000\000\012\377\000@\032\026"
+ "\000\000\012\377\000@\000\000\000\000`\350\000@4,\000\000`\350\000\300\032"
+ "\026\000\000`\350\000\3004,\000\000`\350\000@\032\026\000\000\022\342\000"
+ "@4,\000\000\265\321\000\3004,\000\000\265\321\000@4,\000\000`\350\000\300"
+ "4,\000\000`\350\000@4,\000\000`\244\000@\201n\000\000`\244\000\300MB\000"
+ "\000`\244\000\300\201n\000\000`\244\000@MB\000\000`\244\000@MB\000\000`\244"
+ "\000@\201n\000\000`\244\000@gX\000\000`\350\000\300\314\323\000\000\265\321"
+ "\000@\314\323\000\000\265\321\000\300\314\323\000\000\022\342\000@\314\323"
+ "\000\000`\350\000@\314\323\000\000>\362%\351\001\200\000\000\341\022\261"
+ "\313\001\200\000\000s\356\010\344\001\200\000\000\214\021\020\376\001\200"
+ "\000\000\341\022<\352\001\200\000\000\216\013\353\373\001\200\000\000\341"
+ "\022e\376\001\200\000\000\315\0052\371\001\200\000\000.\353\223\336\001\200"
+ "\000\000\341\022\077\307\001\200\000\000u\350\322\330\001\200\000\000\341"
+ "\022{\303\001\200\000\000\256\346\000\300\001\200\000\000\256\346F\314\001"
+ "\200\000\000\341\022\000\300\001\200\000\000\256\346\331\323\001\200\000"
+ "\000\341\022\362\027\001\200\000\000\352\012\000@\001\200\000\000\341\022"
+ "\000@\001\200\000\000[\357\000@\001\200\000\000\256\346\000@\001\200\000"
+ "\000\256\346U\034\001\200\000\000\256\346\216\331\001\200\000\000\256\346"
+ ":\351\001\200\000\000\256\346\262\375\001\200\000\000\256\346U\034\377\177"
+ "\000\000;\373\042\362\377\177\000\000X\000\355\365\377\177\000\000u\350\322"
+ "\330\377\177\000\000\256\346\216\331\377\177\000\000.\353\223\336\377\177"
+ "\000\000\341\022\000\300\377\177\000\000\256\346F\314\377\177\000\000\256"
+ "\346\000\300\377\177\000\000\341\022{\303\377\177\000\000\256\346\000@\377"
+ "\177\000\000[\357\000@\377\177\000\000\315\0052\371\377\177\000\000\216\013"
+ "\353\373\377\177\000\000\341\022\000@\377\177\000\000\352\012\000@\377\177"
+ "\000\000\341\022\362\027\377\177\000\000\341\022\177\321\377\177\000\000"
+ "\341\022/\332\377\177\000\000\341\022\261\313\377\177\000\000\341\022<\352"
+ "\377\177\000\000\341\022\077\307\377\177\000\000\307\374\000@\377\177\000"
+ "\000\214\021\020\376\377\177\000\000\341\022e\376\377\177\000\000\256\346"
+ "\331\323\377\177\000\000\256\346\000\300\201n\000\000`\244\000@\201n\000"
+ "\000`\244\000\300\201n\000\000\336\265\000@\201n\000\000\256\346\000@\201"
+ "n\000\000\336\265\000@MB\000\000`\244\000\300MB\000\000`\244\000@MB\000\000"
+ "\265\321\000\300MB\000\000\265\321\000@MB\000\000\265\321\000\300\263\275"
+ "\000\000`\244\000@\263\275\000\000`\244\000\300\263\275\000\000\336\265\000"
+ "@\263\275\000\000\265\321\000@\263\275\000\000\256\346\000@\177\221\000\000"
+ "\256\346\000\300\001\200\000\000\256\346\000\300\177\221\000\000\256\346"
+ "F\314\001\200\000\000\256\346\331\323\001\200\000\000\256\346\216\331\001"
+ "\200\000\000\256\346:\351\001\200\000\000\256\346\262\375\001\200\000\000"
+ "\256\346U\034\001\200\000\000\256\346\000@\001\200\000\000\336\265\000@\177"
+ "\221\000\000`\244\000\300\177\221\000\000`\244\000@\177\221\000\000\256\346"
+ "\000\300\177\221\000\000\256\346\000@\177\221\000\000_$\000@\177\221\000"
+ "\000\341\022\362\027\001\200\000\000\341\022\000@\001\200\000\000\341\022"
+ "e\376\001\200\000\000\341\022<\352\001\200\000\000\341\022/\332\001\200\000"
+ "\000\341\022\177\321\001\200\000\000\341\022\261\313\001\200\000\000\341"
+ "\022\077\307\001\200\000\000\341\022{\303\001\200\000\000\341\022\000\300"
+ "\001\200\000\000\240[\000\300\300\310\000\000\240[\000@\300\310\000\000\240"
+ "[\000@\300\310\000\000\240[\000\300\225\355\000\000\240[\000\300\300\310"
+ "\000\000\240[\000@\225\355\000\000\240[\000@k\022\000\000\3126\000\300@7"
+ "\000\000\3126\000@@7\000\000\240[\000\300k\022\000\000\240[\000@k\022\000"
+ "\000\240[\000\300@7\000\000\240[\000\300k\022\000\000\240[\000@@7\000\000"
+ "\240[\000@@7\000\000\341\022\000\300\377\177\000\000\240[\000\300@7\000\000"
+ "\341\022{\303\377\177\000\000\341\022\077\307\377\177\000\000\341\022\261"
+ "\313\377\177\000\000\341\022\177\321\377\177\000\000\341\022/\332\377\177"
+ "\000\000\341\022<\352\377\177\000\000\341\022e\376\377\177\000\000\341\022"
+ "\362\027\377\177\000\000\341\022\000@\377\177\000\000\341\022\000@\377\177"
+ "\000\000\240[\000@@7\000\000_$\000@\201n\000\000_$\000@\000\000\000\000_"
+ "$\000\300\244\032\000\000_$\000\300\000\000\000\000_$\000@\244\032\000\000"
+ "\225-\000@\362(\000\000!%\000@\250\032\000\000_$\000@\244\032\000\000\336"
+ "5\000@ \024\000\000\3126\000@=\023\000\000\3173\000@\276\025\000\000\233"
+ "1\000@'\027\000\000E/\000@V\030\000\000\325,\000@J\031\000\000P*\000@\377"
+ "\031\000\000\275'\000@t\032\000\000_$\000\300\244\032\000\000\012\377\000"
+ "\300\000\000\000\000_$\000\300\000\000\000\000\012\377\000\300\032\026\000"
+ "\000`\244\000\300\201n\000\000`\244\000\300MB\000\000\265\321\000\300MB\000"
+ "\000\256\346\000\300\201n\000\000\265\321\000\3004,\000\000`\350\000\300"
+ "4,\000\000\3126\000\300@7\000\000\240[\000\300k\022\000\000\240[\000\300"
+ "@7\000\000\341\022\000\300\377\177\000\000\256\346\000\300\377\177\000\000"
+ "`\350\000\300\032\026\000\000`\244\000\300\263\275\000\000`\244\000\300\177"
+ "\221\000\000\265\321\000\300\263\275\000\000\256\346\000\300\177\221\000"
+ "\000`\350\000\300\314\323\000\000\265\321\000\300\314\323\000\000\240[\000"
+ "\300\225\355\000\000\3126\000\300\300\310\000\000\240[\000\300\300\310\000"
+ "\000\341\022\000\300\001\200\000\000\256\346\000\300\001\200\000\000`\350"
+ "\000\300\346\351\000\000_$\000\300\134\345\000\000\012\377\000\300\346\351"
+ "\000\000\3126\000@=\023\000\000\3126\000\300@7\000\000\3126\000\300=\023"
+ "\000\000\3126\000@@7\000\000!%\000@\250\032\000\000_$\000\300\244\032\000"
+ "\000_$\000@\244\032\000\000!%\000\300\250\032\000\000\3126\000@=\023\000"
+ "\000\3365\000\300 \024\000\000\3365\000@ \024\000\000\3126\000\300=\023\000"
+ "\000\3173\000\300\276\025\000\000\3173\000@\276\025\000\000\2331\000\300"
+ "'\027\000\000\2331\000@'\027\000\000E/\000\300V\030\000\000E/\000@V\030\000"
+ "\000\325,\000\300J\031\000\000\325,\000@J\031\000\000P*\000\300\377\031\000"
+ "\000P*\000@\377\031\000\000\275'\000\300t\032\000\000\275'\000@t\032\000"
+ "\000\256\346\000@\201n\000\000\341\022\000@\377\177\000\000\256\346\000@"
+ "\377\177\000\000\256\346\000@\377\177\000\000_$\000@\244\032\000\000\312"
+ "6\000\300@7\000\000_$\000\300\244\032\000\000\3126\000@@7\000\000\3126\000"
+ "@@7\000\000_$\000@\244\032\000\000\225-\000@\362(\000\000\225-\000@\016\327"
+ "\000\000\2634\000@\352\352\000\000\2606\000@\236\354\000\000\2152\000@k\351"
+ "\000\000E0\000@#\350\000\000\340-\000@\026\347\000\000c+\000@F\346\000\000"
+ "\325(\000@\266\345\000\000<&\000@f\345\000\000_$\000@\134\345\000\000\312"
+ "6\000@\300\310\000\000_$\000\300\134\345\000\000\3126\000\300\300\310\000"
+ "\000_$\000@\134\345\000\000_$\000@\134\345\000\000\3126\000@\300\310\000"
+ "\000\225-\000@\016\327\000\000\3126\000@\300\310\000\000\3126\000\300\272"
+ "\354\000\000\3126\000\300\300\310\000\000\3126\000@\272\354\000\000<&\000"
+ "\300f\345\000\000_$\000@\134\345\000\000_$\000\300\134\345\000\000<&\000"
+ "@f\345\000\000\325(\000\300\266\345\000\000\325(\000@\266\345\000\000c+\000"
+ "\300F\346\000\000c+\000@F\346\000\000\340-\000\300\026\347\000\000\340-\000"
+ "@\026\347\000\000E0\000\300#\350\000\000E0\000@#\350\000\000\2152\000\300"
+ "k\351\000\000\2152\000@k\351\000\000\2634\000\300\352\352\000\000\2634\000"
+ "@\352\352\000\000\2606\000\300\236\354\000\000\2606\000@\236\354\000\000"
+ "\3126\000@\272\354\000\000\3126\000\300\272\354\000\000\3365\000\300 \024"
+ "\000\000\3126\000\300=\023\000\000\3173\000\300\276\025\000\000\2331\000"
+ "\300'\027\000\000E/\000\300V\030\000\000\325,\000\300J\031\000\000P*\000"
+ "\300\377\031\000\000\275'\000\300t\032\000\000!%\000\300\250\032\000\000"
+ "<&\000\300f\345\000\000\325(\000\300\266\345\000\000c+\000\300F\346\000\000"
+ "\340-\000\300\026\347\000\000E0\000\300#\350\000\000\2152\000\300k\351\000"
+ "\000\2634\000\300\352\352\000\000\2606\000\300\236\354\000\000\3126\000\300"
+ "\272\354\000\000\336\265\000@MB\000\000`\244\000@MB\000\000\336\265\000@"
+ "\201n\000\000`\244\000@\201n\000\000`\244\000@\231\247\000\000\336\265\000"
+ "@\177\221\000\000`\244\000@\177\221\000\000\336\265\000@\263\275\000\000"
+ "`\244\000@\263\275\000\000\256\346\000@\001\200\000\000\352\012\000@\001"
+ "\200\000\000[\357\000@\001\200\000\000\341\022\000@\001\200\000\000_$\000"
+ "@\177\221\000\000\256\346\000@\177\221\000\000\240[\000@@7\000\000\240[\000"
+ "@k\022\000\000\3126\000@@7\000\000\265\321\000@MB\000\000\265\321\000@\263"
+ "\275\000\000\022\342\000@\314\323\000\000\265\321\000@\314\323\000\000\012"
+ "\377\000@\346\351\000\000_$\000@\000\000\000\000\3126\000@\300\310\000\000"
+ "\012\377\000@\032\026\000\000`\350\000@\314\323\000\000`\350\000@\346\351"
+ "\000\000`\350\000@\032\026\000\000\240[\000@\300\310\000\000\240[\000@\225"
+ "\355\000\000\240[\000\300\300\310\000\000\3126\000@\300\310\000\000\3126"
+ "\000\300\300\310\000\000\240[\000@\300\310\000\000\240[\000@@7\000\000\312"
+ "6\000\300@7\000\000\3126\000@@7\000\000\240[\000\300@7\000\000`\350\000@"
+ "4,\000\000\022\342\000@4,\000\000\265\321\000@4,\000\000_$\000@\134\345\000"
+ "\000_$\000\300\134\345\000\000\3126\000@\272\354\000\000\240[\000@\225\355"
+ "\000\000\3126\000\300\300\310\000\000\240[\000\300\225\355\000\000\3126\000"
+ "@\300\310\000\000\000\000\000\000\000\000\000\000\000\000\201\177\177\201"
+ "\201\177\201\201\177\201\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\020\201\000\201\036\000\000\000\000\000\000\000\000\177\177\177\177"
+ "\177\177\177\177\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\347L\261O\000\177"
+ "\201\000\201\000\201\000\201\000\177\177\177\177\177\177\177\177\177\177"
+ "\201\000\201\000\201\000\201\000\253U\315\031\000\177\000\000\000\000\000"
+ "\000\000\000\000\000\201\177\177\201\201\177\177\201\177\201\177\201\177"
+ "\201\177\201\201\177\177\201\201\177\177\201\177\201\201\201\177\201\201"
+ "\177\177\201\177\201\177\201\201\201\201\201\201\177\201\177\201\177\201"
+ "\177\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\177\177\177\177\177\177\177\177\177"
+ "\177\000\000\000\000\000\000\000\000\000\000\201\006\201\000\201\036\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\177\177\177\177\177"
+ "\177\201\177\201\177\177\301\177\301\177\301\177\301\177\301\177\301\177"
+ "\301\177\301\177\301\177\301\177\301\177@\177@\177\000\177\000\177\000\177"
+ "\000\201@\201@\201@\201@\177\000\177\000\177\000\177\000@\000@\000@\000@"
+ "\000@\000@\000@\000@\000@\000@\000@\000@\000\024:D\021\000\177\177\000\177"
+ "\000\177\000\177\000\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\177\000\177"
+ "\000\177\000\177\000\201}\177|\177|\201z\201A\201C\201E\201A\201I\201K\201"
+ "P\201R\201W\201Y\201^\201`\201f\201i\201o\201r\000\177\000\177\000\177\340"
+ " \1772\1772\1772\1772\000\201\000\201\000\201\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177M\000M\000M\000M\000"
+ "\000\201\000\201\000\201\177\000\177\000\177\000\177\000\372\000\375\000"
+ "\375\000\366\000\357\000\354\000\346\000\343\000\336\000\334\000\327\000"
+ "\325\000\320\000\316\000\312\000\310\000\302\000\302\000\277\000\277\000"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\000\000\000\000\000\000\000\177\177"
+ "\177\177\177\177\177\177\000\177\000\177\000\177\177\000\177\000\000\177"
+ "\300\000\300\000\300\000\300\000\000\000\000\000\001\000\002\000\001\000"
+ "\000\000\003\000\001\000\003\000\004\000\005\000\006\000\007\000\006\000"
+ "\005\000\010\000\006\000\010\000\011\000\012\000\013\000\014\000\015\000"
+ "\013\000\016\000\013\000\015\000\014\000\017\000\020\000\021\000\020\000"
+ "\017\000\022\000\023\000\024\000\025\000\024\000\023\000\026\000\027\000"
+ "\030\000\031\000\030\000\027\000\032\000\033\000\034\000\035\000\034\000"
+ "\033\000\036\000\036\000\033\000\037\000\036\000\037\000 \000\036\000 \000"
+ "!\000\036\000!\000\042\000\036\000\042\000#\000\036\000#\000$\000%\000&\000"
+ "'\000&\000%\000(\000)\000*\000+\000*\000)\000,\000-\000.\000/\000.\000-\000"
+ "0\0000\000-\0001\0002\0003\0004\0005\0006\0007\0006\0005\0008\0009\000:\000"
+ ";\000:\0009\000<\000<\0009\000=\000>\000\077\000@\000\077\000>\000A\000B"
+ "\000C\000D\000E\000F\000G\000F\000E\000H\000H\000E\000I\000J\000K\000L\000"
+ "K\000J\000\007\000K\000\007\000\006\000M\000N\000O\000N\000M\000P\000Q\000"
+ "\011\000\010\000\011\000Q\000O\000\011\000O\000N\000R\000S\000T\000S\000"
+ "R\000L\000S\000L\000K\000U\000V\000W\000V\000U\000X\000T\000W\000Y\000W\000"
+ "T\000U\000U\000T\000S\000Z\000[\000\134\000[\000O\000]\000O\000[\000Z\000"
+ "O\000Z\000M\000M\000Z\000P\000^\000\010\000_\000\010\000^\000]\000\010\000"
+ "]\000Q\000Q\000]\000O\000L\000`\000a\000`\000L\000R\000`\000R\000T\000\007"
+ "\000a\000b\000a\000\007\000J\000a\000J\000L\000\010\000b\000_\000b\000\010"
+ "\000\005\000b\000\005\000\007\000T\000Y\000`\000\004\000c\000\001\000c\000"
+ "\004\000d\000c\000d\000e\000f\000\002\000g\000\002\000f\000h\000\002\000"
+ "h\000\000\000i\000j\000k\000j\000i\000l\000e\000m\000c\000m\000e\000n\000"
+ "n\000e\000o\000n\000o\000p\000q\000r\000s\000t\000d\000\004\000d\000t\000"
+ "e\000e\000t\000u\000v\000\003\000\000\000\003\000v\000\004\000\004\000v\000"
+ "t\000u\000o\000e\000o\000u\000p\000p\000u\000w\000x\000h\000f\000h\000x\000"
+ "\000\000\000\000x\000v\000p\000y\000n\000y\000p\000r\000r\000p\000s\000s"
+ "\000p\000z\000s\000z\000{\000w\000z\000p\000z\000w\000{\000l\000|\000j\000"
+ "|\000l\000f\000f\000l\000x\000f\000g\000|\000}\000~\000\177\000~\000}\000"
+ "\200\000\200\000}\000\201\000\202\000\203\000\204\000\203\000\202\000\205"
+ "\000\205\000\202\000\206\000\207\000\210\000\211\000\210\000\207\000\212"
+ "\000\212\000\207\000\213\000\214\000\215\000\216\000\215\000\214\000\217"
+ "\000\217\000\214\000\220\000\220\000\214\000\221\000\221\000\214\000\222"
+ "\000\222\000\214\000\223\000\223\000\214\000\224\000\224\000\214\000\225"
+ "\000\226\000\227\000\230\000\227\000\226\000\231\000\231\000\226\000\232"
+ "\000\233\000\234\000\235\000\234\000\233\000\236\000\236\000\233\000\237"
+ "\000\237\000\233\000\240\000\240\000\233\000\241\000\241\000\233\000\242"
+ "\000\242\000\233\000\243\000\243\000\233\000\244\000\244\000\233\000\245"
+ "\000\245\000\233\000\246\000\246\000\233\000\247\000\250\000\251\000\252"
+ "\000\251\000\250\000\253\000\254\000\255\000\256\000\255\000\254\000\257"
+ "\000\260\000\261\000\262\000\261\000\260\000\263\000\264\000\265\000\266"
+ "\000\265\000\264\000\267\000\267\000\264\000\270\000\270\000\264\000\271"
+ "\000\271\000\264\000\272\000\272\000\264\000\273\000\273\000\264\000\274"
+ "\000\274\000\264\000\275\000\275\000\264\000\276\000\276\000\264\000\277"
+ "\000\300\000\301\000\302\000\303\000\304\000\305\000\304\000\303\000\306"
+ "\000\307\000\310\000\311\000\312\000\307\000\313\000\307\000\312\000\314"
+ "\000\307\000\314\000\315\000\307\000\315\000\316\000\307\000\316\000\317"
+ "\000\307\000\317\000\320\000\307\000\320\000\321\000\307\000\321\000\310"
+ "\000\322\000\323\000\324\000\323\000\322\000\325\000\326\000\327\000\330"
+ "\000\326\000\330\000\331\000\331\000\332\000\333\000\332\000\331\000\330"
+ "\000\334\000\335\000\336\000\337\000\334\000\336\000\337\000\331\000\334"
+ "\000\331\000\337\000\340\000\334\000\333\000\341\000\333\000\334\000\331"
+ "\000\322\000\341\000\325\000\341\000\322\000\334\000\342\000\343\000\344"
+ "\000\344\000\343\000\345\000\346\000\344\000\345\000\344\000\346\000\347"
+ "\000\350\000\351\000\352\000\351\000\353\000\352\000\351\000\354\000\353"
+ "\000\351\000\345\000\354\000\345\000\351\000\346\000\346\000\351\000\355"
+ "\000\356\000\355\000\351\000\355\000\356\000\357\000\360\000\361\000\362"
+ "\000\361\000\360\000\363\000\364\000\365\000\366\000\365\000\364\000\367"
+ "\000\370\000\371\000\372\000\371\000\370\000\373\000\372\000\374\000\375"
+ "\000\374\000\372\000\371\000\375\000\376\000\377\000\376\000\375\000\374"
+ "\000\377\000\000\001\001\001\000\001\377\000\376\000\001\001\002\001\003"
+ "\001\002\001\001\001\000\001\003\001\004\001\005\001\004\001\003\001\002"
+ "\001\005\001\006\001\007\001\006\001\005\001\004\001\007\001\367\000\364"
+ "\000\367\000\007\001\006\001y\000r\000n\000\010\001\011\001\302\000\011\001"
+ "\010\001\012\001\300\000\013\001n\000\300\000n\000r\000\014\001\015\001\016"
+ "\001\015\001\014\001\017\001\020\001\021\001\022\001\023\001\024\001\025"
+ "\001\024\001\023\001\026\001\026\001\023\001\027\001\027\001\023\001\030"
+ "\001\030\001\023\001\031\001\031\001\023\001\032\001\032\001\023\001\033"
+ "\001\033\001\023\001\034\001\035\001\036\001\037\001\036\001\035\001 \001"
+ "!\001\042\001#\001$\001%\001&\001%\001$\001'\001(\001)\001*\001)\001(\001"
+ "+\001,\001+\001(\001+\001,\001-\001.\001-\001,\001-\001.\001/\0010\001/\001"
+ ".\001/\0010\0011\0012\0011\0010\0011\0012\0013\0014\0013\0012\0013\0014\001"
+ "5\0016\0015\0014\0015\0016\0017\0018\0017\0016\0017\0018\0019\001:\0018\001"
+ ";\0018\001:\0019\001\334\000<\001=\001<\001\334\000>\001>\001\334\000\077"
+ "\001\077\001\334\000@\001@\001\334\000A\001A\001\334\000B\001B\001\334\000"
+ "C\001C\001\334\000D\001\334\000\322\000D\001\351\000E\001\356\000E\001\351"
+ "\000F\001F\001\351\000G\001G\001\351\000H\001H\001\351\000I\001I\001\351"
+ "\000J\001J\001\351\000K\001K\001\351\000L\001L\001\351\000M\001D\000N\001"
+ "O\001N\001D\000P\001P\001D\000Q\001R\001S\001T\001S\001R\001U\001U\001R\001"
+ "V\001W\001X\001Y\001X\001W\001Z\001Z\001W\001[\001[\001W\001\134\001]\001"
+ "^\001_\001P\001`\001N\001`\001P\001\010\001a\001[\001\134\001[\001a\001b"
+ "\001b\001a\001c\001d\001e\001\034\001e\001d\0014\000\034\001f\001[\001f\001"
+ "\034\001\023\0014\000\311\000e\001\311\0004\000g\001[\001h\001i\001h\001"
+ "[\001b\001\302\000g\001j\001g\001\302\000\311\000\302\000\307\000\311\000"
+ "\307\000\302\000_\001k\001[\001f\001l\001k\001f\001m\001n\001o\001n\001m"
+ "\001p\001\302\000]\001_\001q\001r\001s\001r\001q\001t\001i\001\034\001[\001"
+ "\034\001i\001d\001\302\000u\001v\001\302\000j\001u\001S\001a\001\134\001"
+ "a\001S\001U\001\022\000\216\000\020\000\216\000\022\000\214\000`\001v\001"
+ "w\001v\001`\001\302\000\302\000`\001\010\001\324\000\357\000\356\000\357"
+ "\000\324\000\323\000x\001\305\000y\001\305\000x\001\303\000_\001\313\000"
+ "\307\000\023\001z\001f\001z\001\023\001\025\001{\001|\001}\001|\001{\001"
+ "~\001\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001"
+ "\000\003\000\003\000\004\000\001\000\004\000\005\000\006\000\006\000\007"
+ "\000\005\000\007\000\005\000\010\000\006\000\010\000\010\000\011\000\006"
+ "\000\011\000\012\000\013\000\013\000\014\000\012\000\014\000\013\000\015"
+ "\000\013\000\016\000\015\000\016\000\014\000\015\000\017\000\020\000\020"
+ "\000\021\000\017\000\021\000\017\000\022\000\020\000\022\000\023\000\024"
+ "\000\024\000\025\000\023\000\025\000\023\000\026\000\024\000\026\000\027"
+ "\000\030\000\030\000\031\000\027\000\031\000\027\000\032\000\030\000\032"
+ "\000\033\000\034\000\034\000\035\000\033\000\035\000\033\000\036\000\034"
+ "\000\036\000\033\000\037\000\036\000\037\000\037\000 \000\036\000 \000\002"
+ "\000 \000\002\000\036\000\001\000\036\000\001\000#\000\036\000#\000#\000"
+ "$\000\036\000$\000%\000&\000&\000'\000%\000'\000%\000(\000&\000(\000\024"
+ "\000*\000\025\000*\000\024\000,\000*\000,\000\027\000.\000\032\000.\000\023"
+ "\000\027\000\023\000.\000\026\000\027\000\027\0004\000\026\0004\000\030\000"
+ "5\000\030\0007\0005\0007\000\031\0005\000&\0009\000(\0009\0007\0009\000&"
+ "\0007\0005\0009\000>\000\077\000\077\000@\000>\000@\000>\000A\000\077\000"
+ "A\000>\000D\000A\000D\000\017\000*\000\021\000*\000*\000H\000\017\000H\000"
+ ",\000H\000J\000K\000K\000L\000J\000L\000\007\000J\000\007\000K\000\006\000"
+ "K\000M\000N\000N\000O\000M\000O\000M\000P\000N\000P\000\011\000Q\000\010"
+ "\000Q\000O\000Q\000\011\000O\000\011\000N\000R\000S\000S\000T\000R\000T\000"
+ "L\000R\000L\000S\000K\000S\000U\000V\000V\000W\000U\000W\000U\000X\000V\000"
+ "X\000T\000W\000W\000Y\000T\000Y\000T\000U\000S\000U\000Z\000[\000[\000\134"
+ "\000Z\000\134\000O\000[\000O\000]\000[\000]\000O\000Z\000M\000Z\000P\000"
+ "Z\000\010\000^\000\010\000_\000^\000_\000]\000^\000\010\000]\000Q\000]\000"
+ "L\000`\000`\000a\000L\000a\000R\000`\000T\000`\000\007\000a\000a\000b\000"
+ "\007\000b\000J\000a\000\010\000b\000_\000b\000\005\000b\000Y\000`\000\004"
+ "\000#\000\004\000d\000#\000d\000d\000e\000#\000e\000\002\000f\000 \000f\000"
+ "f\000h\000\002\000h\000\000\000h\000\033\000i\000\035\000i\000i\000l\000"
+ "\033\000l\000$\000e\000e\000n\000$\000n\000e\000o\000n\000o\000o\000p\000"
+ "n\000p\000q\000r\000r\000s\000q\000s\000d\000t\000\004\000t\000e\000t\000"
+ "t\000u\000e\000u\000\003\000v\000\000\000v\000\004\000v\000t\000v\000o\000"
+ "u\000p\000u\000u\000w\000p\000w\000h\000x\000f\000x\000\000\000x\000v\000"
+ "x\000p\000y\000n\000y\000p\000r\000r\000y\000p\000s\000p\000z\000s\000z\000"
+ "z\000{\000s\000{\000w\000z\000w\000{\000\037\000l\000f\000l\000\037\000f"
+ "\000l\000x\000\034\000>\000\034\000@\000\034\000\200\000>\000\200\000\036"
+ "\000\200\000\077\000\202\000A\000\202\000'\000\202\000'\000\077\000%\000"
+ "\202\000\015\000\020\000\016\000\020\000\020\000\212\000\015\000\212\000"
+ "\022\000\212\000V\000\214\000V\000\216\000\214\000\216\000W\000\214\000Y"
+ "\000\214\000`\000\214\000a\000\214\000b\000\214\000_\000\214\000^\000\214"
+ "\000\013\000\226\000\012\000\226\000\216\000\226\000\013\000\216\000\214"
+ "\000\226\000Z\000\233\000\134\000\233\000P\000\233\000N\000\233\000\011\000"
+ "\233\000\006\000\233\000K\000\233\000S\000\233\000U\000\233\000X\000\233"
+ "\000\233\000\246\000X\000\246\000\233\000\247\000\246\000\247\000\247\000"
+ "\251\000\246\000\251\000\247\000\253\000\251\000\253\000\254\000\255\000"
+ "\255\000\256\000\254\000\256\000\254\000\257\000\255\000\257\000\254\000"
+ "\261\000\257\000\261\000\254\000\263\000\261\000\263\000i\000\263\000i\000"
+ "\261\000l\000\263\000x\000\263\000v\000\263\000t\000\263\000u\000\263\000"
+ "w\000\263\000{\000\263\000s\000\263\000q\000\263\000\263\000\302\000q\000"
+ "\302\000\303\000\304\000\304\000\305\000\303\000\305\000\303\000\306\000"
+ "\304\000\306\000\307\000\310\000\306\000\310\000\306\000\307\000\307\000"
+ "\312\000\307\000\313\000\312\000\313\000\312\000\314\000\307\000\314\000"
+ "\314\000\315\000\307\000\315\000\315\000\316\000\307\000\316\000\316\000"
+ "\317\000\307\000\317\000\317\000\320\000\307\000\320\000\320\000\321\000"
+ "\307\000\321\000\310\000\321\000.\000\304\000.\000\305\000\032\000\304\000"
+ "'\000@\000\034\000'\000\034\000&\000\034\0007\000\255\000\261\000i\000\255"
+ "\000\034\000i\000\034\000\255\0007\000\255\000\030\000\255\000\030\000\304"
+ "\000\255\000\304\000\013\000\020\000\020\000\216\000\020\000*\000*\000\216"
+ "\000\251\000\351\000\246\000\351\000X\000\351\000V\000\351\000\216\000\351"
+ "\000*\000\351\000\025\000\351\000\025\000\356\000\351\000\356\000\023\000"
+ "\356\000\255\000\313\000\255\000\362\000\313\000\362\000\256\000\313\000"
+ "\304\000\310\000\310\000\367\000\304\000\367\000\313\000\371\000\312\000"
+ "\371\000\362\000\371\000\312\000\374\000\314\000\374\000\371\000\374\000"
+ "\314\000\376\000\315\000\376\000\374\000\376\000\315\000\000\001\316\000"
+ "\000\001\376\000\000\001\316\000\002\001\317\000\002\001\000\001\002\001"
+ "\317\000\004\001\320\000\004\001\002\001\004\001\320\000\006\001\321\000"
+ "\006\001\004\001\006\001\321\000\367\000\367\000\006\001n\000r\000\036\000"
+ "q\000\036\000\302\000$\000q\000n\000q\000\255\000\306\000\256\000\306\000"
+ "\256\000\307\000\023\001\024\001\024\001\025\001\023\001\025\001\023\001"
+ "\026\001\024\001\026\001\023\001\027\001\026\001\027\001\023\001\030\001"
+ "\027\001\030\001\023\001\031\001\030\001\031\001\023\001\032\001\031\001"
+ "\032\001\023\001\033\001\032\001\033\001\023\001\034\001\033\001\034\001"
+ "\356\000\035\001\351\000\035\001\034\001\035\001\356\000\034\001\023\001"
+ "\035\001\035\001%\001\351\000%\001\035\001'\001%\001'\001\034\001(\001\356"
+ "\000(\001\033\001(\001\033\001,\001(\001,\001\032\001,\001\032\001.\001,"
+ "\001.\001\031\001.\001\031\0010\001.\0010\001\030\0010\001\030\0012\0010"
+ "\0012\001\027\0012\001\027\0014\0012\0014\001\026\0014\001\026\0016\0014"
+ "\0016\001\024\0016\001\024\0018\0016\0018\001\025\0018\001'\0018\001%\001"
+ "8\001\025\001'\001\255\000\371\000\255\000\374\000\255\000\376\000\255\000"
+ "\000\001\255\000\002\001\255\000\004\001\255\000\006\001\255\000\367\000"
+ "\351\000(\001\351\000,\001\351\000.\001\351\0000\001\351\0002\001\351\000"
+ "4\001\351\0006\001\351\0008\001D\000\202\000D\000\200\000\200\000\202\000"
+ "\014\000\226\000\014\000\212\000\212\000\226\000[\000^\000\134\000^\000^"
+ "\000\233\000\214\000\233\000\256\000\263\000%\000\200\000\036\000%\000\022"
+ "\000\233\000\022\000\214\000\022\000H\000H\000\233\000\026\000\303\000\303"
+ "\000\034\001\026\000\034\0014\000\303\000\233\000\035\001\233\000\034\001"
+ "4\000\306\000\027\000\306\000,\000\233\000\024\000\233\000\027\000\302\000"
+ "\031\000\302\000\302\000\306\000\302\000\307\000\256\000\302\000\247\000"
+ "\035\001\253\000\035\001\246\000\035\001\255\000\263\000\024\000\034\001"
+ "5\000\302\0009\000\302\000\022\000\226\000\022\000\216\000%\0009\000%\000"
+ "\302\000\023\000\305\000\305\000\356\000\305\000\034\001\023\001'\001\253"
+ "\000\351\000@\322\377\177\026\347\000\000\303\317\000\000F\346\000\000\303"
+ "\317\377\177F\346\000\000@\322\000\000\026\347\000\000A\267\000\000\001\200"
+ "\000\000\300\310\000\000\134\345\000\000*\333\000\000\300\310\000\000A\267"
+ "\000\000\377\177\000\000\300\310\000\000\244\032\000\000\201\311\000\000"
+ "\250\032\000\000*\333\000\000@7\000\000\000\000\000\000@7\000\000\000\000"
+ "\000\000k\022\000\000>\332\000\000 \024\000\000*\333\000\000=\023\000\000"
+ "/\330\000\000\276\025\000\000\373\325\000\000'\027\000\000\246\323\000\000"
+ "V\030\000\0006\321\000\000J\031\000\000\261\316\000\000\377\031\000\000\035"
+ "\314\000\000t\032\000\000\020\333\000\000\236\354\000\000*\333\000\000\272"
+ "\354\000\000\023\331\000\000\352\352\000\000\356\326\000\000k\351\000\000"
+ "\246\324\000\000#\350\000\000@\322\000\000\026\347\000\000\303\317\000\000"
+ "F\346\000\0005\315\000\000\266\345\000\000\234\312\000\000f\345\000\000\000"
+ "\000\000\000\300\310\000\000\000\000\000\000\225\355\000\000\300\310\000"
+ "\000\001\200\000\000A\267\322\345\001\200\000\000A\267\202\356\001\200\000"
+ "\000\261\316\000\000\377\031\000\000\035\314\377\177t\032\000\000\035\314"
+ "\000\000t\032\000\000\261\316\377\177\377\031\000\000/\330\000\000\276\025"
+ "\000\000\373\325\377\177'\027\000\000\373\325\000\000'\027\000\000/\330\377"
+ "\177\276\025\000\000\234\312\377\177f\345\000\000\300\310\000\000\134\345"
+ "\000\000\300\310\377\177\134\345\000\000\234\312\000\000f\345\000\000\300"
+ "\310\377\177\244\032\000\000\300\310\000\000\134\345\000\000\300\310\000"
+ "\000\244\032\000\000\300\310\377\177\134\345\000\000\300\310\377\177\134"
+ "\345\000\000\300\310\377\177\244\032\000\000\300\310\377\177\000\000\000"
+ "\000*\333\377\177@7\000\000*\333\000\000=\023\000\000*\333\000\000@7\000"
+ "\000*\333\377\177=\023\000\0005\315\000\000\266\345\000\0005\315\377\177"
+ "\266\345\000\000@7\377\177\201n\000\000@7\377\177\000\000\000\000\000\000"
+ "\377\177@7\000\000\000\000\000\000k\022\000\000*\333\377\177@7\000\000*\333"
+ "\000\000@7\000\000\000\000\377\177k\022\000\000\356\326\377\177k\351\000"
+ "\000\246\324\000\000#\350\000\000\246\324\377\177#\350\000\000\356\326\000"
+ "\000k\351\000\000\023\331\377\177\352\352\000\000\023\331\000\000\352\352"
+ "\000\000\020\333\377\177\236\354\000\000\020\333\000\000\236\354\000\000"
+ "*\333\377\177\300\310\000\000\000\000\000\000\225\355\000\000*\333\000\000"
+ "\300\310\000\000\000\000\377\177\225\355\000\000\000\000\377\177@7\000\000"
+ "\000\000\000\000k\022\000\000\000\000\000\000@7\000\000\000\000\377\177k"
+ "\022\000\000\201\311\377\177\250\032\000\000\201\311\000\000\250\032\000"
+ "\000\300\310\377\177\244\032\000\000\300\310\000\000\244\032\000\000\246"
+ "\323\000\000V\030\000\0006\321\377\177J\031\000\0006\321\000\000J\031\000"
+ "\000\246\323\377\177V\030\000\000*\333\377\177\272\354\000\000*\333\000\000"
+ "\300\310\000\000*\333\000\000\272\354\000\000*\333\377\177\300\310\000\000"
+ "\277H\177\221\177\221\000\000\277H\001\200\001\200\000\000\277H\177\221\001"
+ "\200\000\000A\267{\003\377\177\000\000\000\000\000\000@7\000\000A\267\000"
+ "\000\377\177\000\000\000\000\377\177@7\000\000A\267\077\007\377\177\000\000"
+ "A\267\260\013\377\177\000\000A\267~\021\377\177\000\000A\267.\032\377\177"
+ "\000\000A\267;*\377\177\000\000A\267e>\377\177\000\000A\267\361W\377\177"
+ "\000\000A\267\377\177\377\177\000\000\000\000\377\177@7\000\000A\267\377"
+ "\177\377\177\000\000\300\310\377\177\201n\000\000\300\310\000\000\377\177"
+ "\000\000A\267{\003\377\177\000\000A\267\000\000\377\177\000\000\000\000\377"
+ "\177\225\355\000\000\000\000\000\000\300\310\000\000\000\000\000\000\225"
+ "\355\000\000\000\000\377\177\300\310\000\000>\332\000\000 \024\000\000>\332"
+ "\377\177 \024\000\000*\333\000\000\272\354\000\000*\333\377\177\272\354\000"
+ "\000*\333\000\000=\023\000\000\020\333\377\177=\023\000\000\020\333\377\177"
+ "=\023\000\000*\333\000\000=\023\000\000*\333\377\177=\023\000\000\000\000"
+ "\000\000\300\310\000\000A\267{\003\001\200\000\000A\267\000\000\001\200\000"
+ "\000A\267\077\007\001\200\000\000A\267\260\013\001\200\000\000A\267~\021"
+ "\001\200\000\000A\267.\032\001\200\000\000A\267;*\001\200\000\000A\267e>"
+ "\001\200\000\000A\267\361W\001\200\000\000A\267\377\177\001\200\000\000\300"
+ "\310\377\177\177\221\000\000\000\000\377\177\300\310\000\000A\267P\364\001"
+ "\200\000\000A\267\205\374\001\200\000\000A\267\000\000\001\200\000\000A\267"
+ ".\032\001\200\000\000A\267;*\001\200\000\000A\267\301\370\001\200\000\000"
+ "A\267{\003\001\200\000\000\031\274\233\077\001\200\000\000A\267e>\001\200"
+ "\000\000A\267\361W\001\200\000\000A\267\077\007\001\200\000\000A\267\260"
+ "\013\001\200\000\000A\267~\021\001\200\000\000\341\372\334\326\001\200\000"
+ "\000\277H\001\200\001\200\000\000\233\366%\322\001\200\000\000\254\376\370"
+ "\333\001\200\000\000\277Hz\252\001\200\000\000\277H\001\200\001\200\000\000"
+ "\277Hz\252\001\200\000\000\361\001n\341\001\200\000\000\252\004/\347\001"
+ "\200\000\000\277H\373\312\001\200\000\000\317\006-\355\001\200\000\000[\010"
+ "Y\363\001\200\000\000\277H\212\346\001\200\000\000J\011\245\371\001\200\000"
+ "\000\232\011\000\000\001\200\000\000\277H\000\000\001\200\000\000\300\310"
+ "\377\177\001\200\000\000A\267\377\177\001\200\000\000d\302\212@\001\200\000"
+ "\000\300\310\332@\001\200\000\0005\342\377\177\001\200\000\000\033\317\212"
+ "@\001\200\000\000f\325\233\077\001\200\000\000\031\274e\300\001\200\000\000"
+ "A\267\001\200\001\200\000\000A\267\017\250\001\200\000\000\300\310\001\200"
+ "\001\200\000\000d\302v\277\001\200\000\000\300\310&\277\001\200\000\000\033"
+ "\317v\277\001\200\000\0005\342\001\200\001\200\000\000f\325e\300\001\200"
+ "\000\000\223\333\017>\001\200\000\000\221\341\352;\001\200\000\000\304\375"
+ "\377\177\001\200\000\000R\347\316\306\001\200\000\000\304\375\001\200\001"
+ "\200\000\000\221\341\026\304\001\200\000\000\307\354\024\312\001\200\000"
+ "\000F\036\001\200\001\200\000\000\223\333\361\301\001\200\000\000R\34729"
+ "\001\200\000\000\307\354\3545\001\200\000\000F\036\377\177\001\200\000\000"
+ "\277Hv\031\001\200\000\000J\011[\006\001\200\000\000[\010\247\014\001\200"
+ "\000\000\344\361!2\001\200\000\000\233\366\333-\001\200\000\000@7\377\177"
+ "\001\200\000\000\277H\377\177\001\200\000\000\341\372$)\001\200\000\000\254"
+ "\376\010$\001\200\000\000\277H\206U\001\200\000\000\277H\206U\001\200\000"
+ "\000\277H\377\177\001\200\000\000\277H\201n\001\200\000\000A\267\233\301"
+ "\001\200\000\000A\267\305\325\001\200\000\000\361\001\222\036\001\200\000"
+ "\000\252\004\321\030\001\200\000\000\277H\0055\001\200\000\000\317\006\323"
+ "\022\001\200\000\000\344\361\337\315\001\200\000\000A\267\205\374\377\177"
+ "\000\000\031\274\233\077\377\177\000\000A\267\361W\377\177\000\000A\267e"
+ ">\377\177\000\000A\267;*\377\177\000\000A\267P\364\377\177\000\000A\267\202"
+ "\356\377\177\000\000\300\310\001\200\377\177\000\000A\267\017\250\377\177"
+ "\000\000A\267\001\200\377\177\000\000\031\274e\300\377\177\000\000d\302v"
+ "\277\377\177\000\000\300\310&\277\377\177\000\000A\267\301\370\377\177\000"
+ "\000A\267\322\345\377\177\000\000\277H\001\200\377\177\000\000\341\372\334"
+ "\326\377\177\000\000\233\366%\322\377\177\000\000\254\376\370\333\377\177"
+ "\000\000\277Hz\252\377\177\000\000\277Hz\252\377\177\000\000\277H\001\200"
+ "\377\177\000\000\277H\177\221\377\177\000\000\361\001n\341\377\177\000\000"
+ "\252\004/\347\377\177\000\000\277H\373\312\377\177\000\000A\267\077\007\377"
+ "\177\000\000A\267\305\325\377\177\000\000A\267\233\301\377\177\000\000\033"
+ "\317\212@\377\177\000\000\300\310\377\177\377\177\000\000\300\310\332@\377"
+ "\177\000\0005\342\377\177\377\177\000\000f\325\233\077\377\177\000\000\223"
+ "\333\017>\377\177\000\000\221\341\352;\377\177\000\000\304\375\377\177\377"
+ "\177\000\000\317\006-\355\377\177\000\000[\010Y\363\377\177\000\000\277H"
+ "\212\346\377\177\000\000\361\001\222\036\377\177\000\000\277H\206U\377\177"
+ "\000\000\254\376\010$\377\177\000\000\252\004\321\030\377\177\000\000\277"
+ "H\0055\377\177\000\000A\267.\032\377\177\000\000A\267~\021\377\177\000\000"
+ "A\267\260\013\377\177\000\000A\267\377\177\377\177\000\000d\302\212@\377"
+ "\177\000\000\304\375\001\200\377\177\000\000R\347\316\306\377\177\000\000"
+ "\221\341\026\304\377\177\000\000\307\354\024\312\377\177\000\000F\036\001"
+ "\200\377\177\000\000\344\361\337\315\377\177\000\000\317\006\323\022\377"
+ "\177\000\000[\010\247\014\377\177\000\000\277Hv\031\377\177\000\0005\342"
+ "\001\200\377\177\000\000\223\333\361\301\377\177\000\000f\325e\300\377\177"
+ "\000\000J\011\245\371\377\177\000\000\232\011\000\000\377\177\000\000\277"
+ "H\000\000\377\177\000\000J\011[\006\377\177\000\000\033\317v\277\377\177"
+ "\000\000\341\372$)\377\177\000\000\277H\377\177\377\177\000\000\233\366\333"
+ "-\377\177\000\000\277H\377\177\377\177\000\000\277H\206U\377\177\000\000"
+ "\277H\201n\377\177\000\000\344\361!2\377\177\000\000F\036\377\177\377\177"
+ "\000\000\307\354\3545\377\177\000\000@7\377\177\377\177\000\000R\34729\377"
+ "\177\000\000\277H\001\200\177\221\000\000F\036\001\200\001\200\000\000\277"
+ "H\001\200\001\200\000\000\304\375\001\200\001\200\000\0005\342\001\200\001"
+ "\200\000\000\300\310\001\200\001\200\000\000A\267\001\200\001\200\000\000"
+ "A\267\001\200\377\177\000\000\277H\001\200\000\000\000\000\277H\001\200\201"
+ "n\000\000\277H\001\200\377\177\000\000A\267\017\250\377\177\000\000A\267"
+ "\001\200\001\200\000\000A\267\001\200\377\177\000\000A\267\017\250\001\200"
+ "\000\000A\267\233\301\001\200\000\000A\267\233\301\377\177\000\000A\267\305"
+ "\325\377\177\000\000A\267\305\325\001\200\000\000A\267\322\345\001\200\000"
+ "\000A\267\322\345\377\177\000\000A\267\202\356\001\200\000\000A\267\202\356"
+ "\377\177\000\000A\267P\364\001\200\000\000A\267P\364\377\177\000\000A\267"
+ "\301\370\377\177\000\000A\267\301\370\001\200\000\000A\267\205\374\377\177"
+ "\000\000A\267\205\374\001\200\000\000A\267\000\000\377\177\000\000A\267\000"
+ "\000\001\200\000\000\300\310\377\177\377\177\000\000A\267\377\177\377\177"
+ "\000\000\300\310\377\177\177\221\000\000\300\310\377\177\001\200\000\000"
+ "A\267\377\177\001\200\000\0005\342\377\177\001\200\000\000\304\375\377\177"
+ "\001\200\000\000F\036\377\177\001\200\000\000@7\377\177\001\200\000\000@"
+ "7\377\177\177\221\000\000\000\000\377\177\300\310\000\000\277H\377\177\001"
+ "\200\000\000\277H\377\177\377\177\000\000\277H\377\177\201n\000\000\277H"
+ "\377\177\177\221\000\000\277H\377\177\000\000\000\000\000\000\377\177k\022"
+ "\000\000\000\000\377\177\000\000\000\000F\036\377\177\377\177\000\000@7\377"
+ "\177\377\177\000\000F\036\377\177\377\177\000\000\300\310\377\177\377\177"
+ "\000\000\000\000\377\177\225\355\000\000\020\333\377\177\000\000\000\000"
+ "*\333\377\177\272\354\000\000\020\333\377\177\236\354\000\000*\333\377\177"
+ "\300\310\000\000\020\333\377\177=\023\000\000*\333\377\177=\023\000\000*"
+ "\333\377\177@7\000\000\234\312\377\177f\345\000\000\300\310\377\177\134\345"
+ "\000\0005\315\377\177\266\345\000\000\303\317\377\177F\346\000\000@\322\377"
+ "\177\026\347\000\000\246\324\377\177#\350\000\000\356\326\377\177k\351\000"
+ "\000\023\331\377\177\352\352\000\000\300\310\377\177\244\032\000\000>\332"
+ "\377\177 \024\000\000/\330\377\177\276\025\000\000\373\325\377\177'\027\000"
+ "\000\246\323\377\177V\030\000\0006\321\377\177J\031\000\000\261\316\377\177"
+ "\377\031\000\000\035\314\377\177t\032\000\000\201\311\377\177\250\032\000"
+ "\000\277H\001\200\177\221\000\000\277H\377\177\177\221\000\000\277H\201n"
+ "\000\000\000\000\277H\201n\177\221\000\000\277H\377\177\000\000\000\000\277"
+ "H\201n\201n\000\000\277H\377\177\201n\000\000\277H\000\000\201n\000\000\277"
+ "H\177\221\201n\000\000\277Hz\252\377\177\000\000\277H\373\312\377\177\000"
+ "\000\277H\212\346\377\177\000\000\277H\000\000\377\177\000\000\277H\177\221"
+ "\000\000\000\000\277H\001\200\201n\000\000\277H\001\200\000\000\000\000\277"
+ "H\001\200\377\177\000\000\277H\377\177\001\200\000\000\277H\000\000\177\221"
+ "\000\000\277H\377\177\377\177\000\000\277Hz\252\001\200\000\000\277H\373"
+ "\312\001\200\000\000\277H\212\346\001\200\000\000\277H\000\000\001\200\000"
+ "\000\277Hv\031\377\177\000\000\277H\0055\377\177\000\000\277H\206U\377\177"
+ "\000\000\277Hv\031\001\200\000\000\277H\0055\001\200\000\000\277H\206U\001"
+ "\200\000\000\177]\177b\177e\177[\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\177\201\177\201\177\201\026\000"
+ "\020\000\015\000\031\0004\000/\000-\0006\000\177y\177|\177|\177u\201\000"
+ "\201\000\201\000\201\000\254U\354X\000\177\201\000\201\000\201\000\201\000"
+ "\177k\177n\000\177\000\177\000\177@\000@\000@\000@\000\177O\177T\177V\177"
+ "M\177I\177G\177A\177A\177@\177@\177@\177@\201\000\201\000\201\000\201\000"
+ "\005\000\002\000\375\000\375\000&\000!\000\037\000(\000\201\000\201\000\201"
+ "\000\201\000\177\000\177\000\177\000\201@\201@\201@\201@\201@\201@\201@\201"
+ "@\201@\201@\201@\201@\226C\342*\000\177\000\000\000\000\000\000\201\000\201"
+ "\000\201\000\201\000:\000=\000\177>\177>@\000B\000\000\000\000\000\000\000"
+ "\300\000\300\000\300\000\300\000\300\000\300\000\300\000\300\000\300\000"
+ "\301\000\300\000\300\000\300\000\177\201\177\201\177\201\177\201\177\177"
+ "\177\201\177\177\177\201\177\201\177\201\177\201\177\201\177\201\177\177"
+ "\177\177\177\177\177\177\177\177m\245\177I\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\201\177\201\177\177\177\177"
+ "\177\177\177\177\177\177\177\201\177\201\177\201\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177U__\177\000\177"
+ "\201\177\201\177\177\177\177\177\177\177\177\177\177\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000*\000"
+ " \360\177\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000  *\000\177\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000*\0000\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\000\000\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000"
+ "\006\000\005\000\004\000\007\000\005\000\007\000\010\000\010\000\007\000"
+ "\011\000\011\000\007\000\012\000\012\000\007\000\013\000\013\000\014\000"
+ "\012\000\015\000\012\000\016\000\012\000\015\000\017\000\012\000\017\000"
+ "\020\000\012\000\020\000\021\000\012\000\021\000\022\000\012\000\022\000"
+ "\023\000\012\000\023\000\024\000\012\000\024\000\011\000\006\000\025\000"
+ "\026\000\025\000\006\000\027\000\027\000\006\000\030\000\030\000\006\000"
+ "\031\000\031\000\006\000\032\000\032\000\006\000\033\000\033\000\006\000"
+ "\034\000\034\000\006\000\035\000\035\000\006\000\005\000\006\000\036\000"
+ "\004\000\036\000\006\000\037\000 \000!\000\042\000#\000$\000%\000$\000#\000"
+ "&\000'\000(\000)\000(\000'\000*\000+\000,\000-\000,\000+\000.\000/\0000\000"
+ "1\0000\000/\0002\0003\0004\0005\0006\0007\0008\0007\0006\0009\000\002\000"
+ ":\000;\000:\000\002\000\001\000<\000=\000>\000\077\000@\000A\000@\000\077"
+ "\000B\000C\000D\000E\000D\000C\000F\000G\000F\000C\000F\000G\000H\000I\000"
+ "H\000G\000H\000I\000J\000K\000L\000M\000L\000K\000N\000O\000P\000Q\000P\000"
+ "O\000R\000%\000S\000T\000S\000%\000$\000T\000U\000V\000U\000T\000S\000W\000"
+ "X\000Y\000X\000W\000Z\000Y\000&\000#\000&\000Y\000X\000[\000\134\000]\000"
+ "\134\000[\000^\000)\000Z\000W\000Z\000)\000(\000;\000.\000+\000.\000;\000"
+ ":\000_\000`\000a\000b\000c\000d\000c\000b\000e\000e\000b\000f\000e\000f\000"
+ "g\000e\000g\000h\000e\000h\000i\000e\000i\000j\000e\000j\000k\000e\000k\000"
+ "l\000e\000l\000m\000n\000o\000p\000q\000r\000s\000t\000u\000v\000u\000t\000"
+ "w\000x\000*\000'\000*\000x\000y\000E\000\003\000\000\000\003\000E\000D\000"
+ "I\000z\000J\000z\000I\000{\000|\000y\000x\000y\000|\000}\000~\000\177\000"
+ "\200\000\201\000\202\000\203\000\202\000\201\000\204\000\204\000\201\000"
+ "\205\000\205\000\201\000\206\000\206\000\201\000\207\000\207\000\201\000"
+ "\210\000\210\000\201\000\211\000\211\000\201\000\212\000\212\000\201\000"
+ "\213\000\213\000\201\000\214\000\214\000\201\000\215\000 \000\042\000\216"
+ "\000 \000\217\000\220\000 \000\221\000\222\000 \000\223\000\217\000 \000"
+ "\220\000\224\000\225\000\226\000\227\000\225\000\222\000\226\000\222\000"
+ "\225\000 \000 \000\230\000\231\000 \000\231\000\232\000\233\000\234\000\235"
+ "\000\234\000\233\000\236\000\234\000\236\000\237\000\240\000\241\000a\000"
+ "\242\000\237\000\236\000\237\000\242\000\243\000\237\000\243\000\244\000"
+ "\245\000\244\000\243\000\244\000\245\000\246\000\244\000\246\000\247\000"
+ "\250\000\247\000\246\000\247\000\250\000\251\000\247\000\251\000\252\000"
+ "\253\000\227\000\254\000\227\000\253\000\225\000\225\000\253\000\255\000"
+ "\255\000\253\000\256\000\257\000\256\000\253\000\256\000\257\000\260\000"
+ "\260\000\257\000\261\000\262\000\263\000\264\000\263\000\262\000\265\000"
+ "\265\000\262\000\266\000\265\000\266\000\267\000\270\000\265\000\267\000"
+ "\265\000\270\000\271\000\271\000\270\000\272\000 \000\232\000\221\000\257"
+ "\000\273\000\261\000\273\000\257\000\274\000\274\000\257\000\275\000 \000"
+ "\216\000\223\000\276\000\277\000\300\000\277\000\276\000\301\000\277\000"
+ "\301\000\302\000\303\000\271\000\272\000\271\000\303\000\300\000\271\000"
+ "\300\000\277\000\275\000\304\000\274\000\304\000\275\000\305\000\305\000"
+ "\275\000\306\000\307\000\310\000\311\000\310\000\307\000\251\000\251\000"
+ "\307\000\252\000\306\000\312\000\305\000\312\000\306\000\313\000\313\000"
+ "\306\000\314\000\313\000\314\000\315\000\315\000\316\000\313\000\316\000"
+ "\315\000\317\000\317\000\315\000\320\000\321\000\322\000\323\000\262\000"
+ "\264\000\324\000 \000\324\000\325\000\324\000 \000\262\000\320\000\326\000"
+ "\317\000\326\000\320\000\327\000\327\000\320\000\330\000\330\000\331\000"
+ "\327\000\331\000\330\000\311\000\311\000\330\000\307\000\332\000\302\000"
+ "\301\000\302\000\332\000\235\000\302\000\235\000\234\000\255\000 \000\225"
+ "\000 \000\255\000\256\000 \000\256\000\260\000 \000\260\000\267\000\267\000"
+ "\260\000\270\000\270\000\260\000\261\000\270\000\261\000\272\000\272\000"
+ "\261\000\273\000\272\000\273\000\303\000\303\000\273\000\274\000\303\000"
+ "\274\000\300\000\300\000\274\000\304\000\300\000\304\000\276\000\276\000"
+ "\304\000\305\000\276\000\305\000\301\000\301\000\305\000\312\000\301\000"
+ "\312\000\332\000\332\000\312\000\313\000\332\000\313\000\235\000\235\000"
+ "\313\000\316\000\235\000\316\000\233\000\233\000\316\000\317\000\233\000"
+ "\317\000\236\000\236\000\317\000\326\000\236\000\326\000\242\000\242\000"
+ "\326\000\327\000\242\000\327\000\243\000\243\000\327\000\331\000\243\000"
+ "\331\000\245\000\245\000\331\000\311\000\245\000\311\000\246\000\246\000"
+ "\311\000\310\000\246\000\310\000\250\000\250\000\310\000\251\000 \000\266"
+ "\000\262\000\266\000 \000\267\000 \000\325\000!\000 \000\224\000\230\000"
+ "q\000s\000\333\000\334\000\335\000\336\000q\000\336\000\337\000\336\000q"
+ "\000\334\000q\000\340\000\341\000\342\000\343\000\344\000\343\000\342\000"
+ "\345\000\345\000\342\000\346\000\346\000\342\000\347\000q\000\350\000\340"
+ "\000q\000\341\000\351\000\352\000\353\000\354\000\353\000\352\000\355\000"
+ "\355\000\352\000\356\000\357\000\360\000\361\000\356\000\362\000\355\000"
+ "\362\000\356\000\363\000\363\000\356\000\364\000q\000\365\000r\000q\000\333"
+ "\000\350\000q\000\351\000\366\000\345\000\367\000\343\000\370\000\371\000"
+ "\372\000\371\000\370\000\373\000\373\000\370\000\374\000\375\000\373\000"
+ "\374\000\373\000\375\000\376\000\373\000\376\000\377\000\364\000\000\001"
+ "\363\000\000\001\364\000\001\001\001\001\364\000\002\001\003\001\004\001"
+ "\005\001\004\001\003\001\006\001\004\001\006\001\007\001q\000\010\001\011"
+ "\001q\000\337\000\010\001q\000\011\001\012\001q\000\012\001\365\000\334\000"
+ "\013\001\335\000\013\001\334\000\371\000\371\000\334\000\014\001\371\000"
+ "\014\001\372\000\015\001\016\001\017\001\016\001\015\001\020\001\020\001"
+ "\015\001\021\001\021\001\022\001\020\001\022\001\021\001\354\000\354\000"
+ "\021\001\352\000\345\000\366\000\367\000\366\000\345\000q\000\023\001\007"
+ "\001\006\001\007\001\023\001\024\001\007\001\024\001\025\001\026\001\027"
+ "\001\030\001\027\001\026\001\017\001\017\001\026\001\015\001\002\001\031"
+ "\001\001\001\031\001\002\001\032\001\032\001\002\001\033\001\034\001\025"
+ "\001\024\001\025\001\034\001\032\001\025\001\032\001\033\001\026\001\347"
+ "\000\342\000\347\000\026\001\035\001\035\001\026\001\030\001\036\001\037"
+ "\001 \001\037\001\036\001\005\001\037\001\005\001\004\001!\001\042\001#\001"
+ "$\001%\001&\001%\001$\001 \001%\001 \001'\001'\001 \001\037\001(\001\377"
+ "\000\376\000\377\000(\001&\001\377\000&\001%\001\346\000q\000\345\000q\000"
+ "\346\000\347\000q\000\347\000\035\001q\000\035\001\372\000\372\000\035\001"
+ "\370\000\370\000\035\001\030\001\370\000\030\001\374\000\374\000\030\001"
+ "\027\001\374\000\027\001\375\000\375\000\027\001\017\001\375\000\017\001"
+ "\376\000\376\000\017\001\016\001\376\000\016\001(\001(\001\016\001\020\001"
+ "(\001\020\001&\001&\001\020\001$\001$\001\020\001\022\001$\001\022\001\354"
+ "\000$\001\354\000 \001 \001\354\000\353\000 \001\353\000\036\001\036\001"
+ "\353\000\355\000\036\001\355\000\005\001\005\001\355\000\362\000\005\001"
+ "\362\000\003\001\003\001\362\000\363\000\003\001\363\000\006\001\006\001"
+ "\363\000\000\001\006\001\000\001\023\001\023\001\000\001\001\001\023\001"
+ "\001\001\024\001\024\001\001\001\034\001\034\001\001\001\031\001\034\001"
+ "\031\001\032\001q\000\014\001\334\000\014\001q\000\372\000)\001*\001+\001"
+ "*\001)\001,\001,\001)\001-\001-\001)\001.\001.\001)\001/\001/\001)\0010\001"
+ "0\001)\0011\0010\0011\0012\0010\0012\0013\001\344\000\352\000\021\001\344"
+ "\000\021\001\015\001\344\000\015\001\026\001\344\000\026\001\342\0004\001"
+ "5\0016\0015\0014\0017\0017\0014\0018\0018\0014\0019\0018\0019\001:\0018\001"
+ ":\001;\001;\001:\001<\001<\001:\001=\001<\001=\001>\001>\001=\001\077\001"
+ ">\001\077\001@\001@\001\077\001A\001@\001A\001B\001@\001B\001C\001C\001B"
+ "\001D\001C\001D\001E\001E\001D\001F\001E\001F\001G\001H\001p\000I\001J\001"
+ "K\001L\001J\001M\001K\001M\001J\001N\001N\001J\001O\001O\001J\001P\001P\001"
+ "J\001Q\001R\001Q\001J\001Q\001S\001P\001T\001U\001<\000=\000V\001Q\001V\001"
+ "=\000W\001X\001=\000Y\001=\000X\001>\000<\000W\001=\000W\001<\000U\001H\001"
+ "<\000p\000<\000H\001Z\001<\000Z\001[\001\134\001]\001\373\000\134\001\373"
+ "\000\377\000^\001=\000R\001=\000^\001Y\001_\001`\001a\001`\001_\001^\001"
+ "^\001_\001Y\001^\001b\001`\001c\001Y\001_\001Y\001c\001X\001X\001c\001d\001"
+ "X\001d\001e\0015\000f\001g\001f\0015\000h\001h\0015\000i\001i\0015\000j\001"
+ "j\0015\000k\001k\0015\000l\001l\0015\000m\001m\0015\000a\001n\001c\0015\000"
+ "c\001n\001o\001o\001n\001p\001p\001n\001q\001q\001n\001r\001r\001n\001s\001"
+ "s\001n\001t\001t\001n\001u\001u\001n\001v\001c\001_\0015\000_\001a\0015\000"
+ "<\000>\000p\000[\001T\001<\000=\000Q\001R\001V\001S\001Q\001_\000w\001`\000"
+ "x\001y\001z\001y\001x\001{\001{\001|\001y\001|\001{\001}\001~\001\361\000"
+ "\177\001\361\000~\001\200\001\200\001~\001\201\001\201\001~\001\202\001\202"
+ "\001~\001\203\001\204\001\205\001\206\001\205\001\204\001\177\001_\000\206"
+ "\001w\001\206\001_\000\204\001\177\001\207\001\205\001\361\000\207\001\177"
+ "\001x\001z\001\210\001\211\001\204\001_\000\204\001~\001\177\001~\001\204"
+ "\001\211\001~\001\211\001z\001~\001z\001|\001|\001z\001y\001\210\001z\001"
+ "\323\000\212\001|\001}\001\213\001_\000a\000_\000\213\001\211\001\211\001"
+ "\213\001\214\001\211\001\214\001\215\001\211\001\215\001\216\001|\001\203"
+ "\001~\001\203\001|\001\217\001\217\001|\001\220\001\220\001|\001\221\001"
+ "\221\001|\001#\001\216\001z\001\211\001z\001\216\001\222\001z\001\222\001"
+ "\223\001z\001\223\001\224\001z\001\224\001\323\000\212\001#\001|\001\000"
+ "\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000\003"
+ "\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000\005"
+ "\000\007\000\007\000\010\000\005\000\010\000\007\000\011\000\010\000\011"
+ "\000\007\000\012\000\011\000\012\000\007\000\013\000\012\000\013\000\013"
+ "\000\014\000\012\000\014\000\012\000\015\000\012\000\016\000\015\000\016"
+ "\000\015\000\017\000\012\000\017\000\017\000\020\000\012\000\020\000\020"
+ "\000\021\000\012\000\021\000\021\000\022\000\012\000\022\000\022\000\023"
+ "\000\012\000\023\000\023\000\024\000\012\000\024\000\011\000\024\000\006"
+ "\000\025\000\025\000\026\000\006\000\026\000\006\000\027\000\025\000\027"
+ "\000\006\000\030\000\027\000\030\000\006\000\031\000\030\000\031\000\003"
+ "\000\006\000\003\000\031\000\001\000\006\000\006\000\034\000\001\000\034"
+ "\000\006\000\035\000\034\000\035\000\005\000\035\000\006\000\036\000\004"
+ "\000\036\000\006\000\037\000\036\000\037\000 \000!\000!\000\042\000 \000"
+ "\042\000\023\000$\000\024\000$\000\023\000&\000$\000&\000\017\000(\000\020"
+ "\000(\000\017\000*\000(\000*\000\005\000+\000\005\000-\000+\000-\000\035"
+ "\000+\000\005\000/\000\010\000/\000-\000/\000/\0005\000-\0005\000\016\000"
+ "6\000\012\0006\0006\0009\000\016\0009\000\002\000\034\000\034\000;\000\002"
+ "\000;\000<\000=\000=\000>\000<\000>\000\014\0006\000\014\000B\0006\000B\000"
+ "\031\000C\000\031\000E\000C\000E\000\030\000C\000\030\000G\000C\000G\000"
+ "\027\000G\000\027\000I\000G\000I\000\025\000I\000\037\000K\000\006\000K\000"
+ "K\000N\000\037\000N\000\014\000>\000\013\000>\000>\000B\000\024\000S\000"
+ "\011\000S\000$\000S\000\011\000/\000/\000S\000\021\000X\000\022\000X\000"
+ "\021\000Z\000X\000Z\000\022\000&\000&\000X\000\006\000[\000\026\000[\000"
+ "K\000[\000\020\000Z\000(\000Z\000\035\000;\000+\000;\000_\000`\000`\000a"
+ "\000_\000a\000\013\000b\000\007\000b\000>\000b\000b\000f\000>\000f\000f\000"
+ "g\000>\000g\000g\000h\000>\000h\000h\000i\000>\000i\000i\000j\000>\000j\000"
+ "j\000k\000>\000k\000k\000l\000>\000l\000l\000m\000>\000m\000m\000p\000>\000"
+ "p\000b\000q\000\007\000q\000\036\000N\000N\000w\000\036\000w\000\015\000"
+ "*\000\015\000y\000*\000y\000\003\000E\000\000\000E\000\026\000I\000I\000"
+ "[\000\016\000y\000\016\000}\000y\000}\0009\000}\000\036\000\202\000\004\000"
+ "\202\000\036\000\204\000\202\000\204\000\036\000\205\000\204\000\205\000"
+ "\036\000\206\000\205\000\206\000\036\000\207\000\206\000\207\000\036\000"
+ "\210\000\207\000\210\000\036\000\211\000\210\000\211\000\036\000\212\000"
+ "\211\000\212\000\036\000\213\000\212\000\213\000\036\000\214\000\213\000"
+ "\214\000w\000\214\000\042\000\216\000 \000\216\000 \000\217\000\004\000\217"
+ "\000\004\000 \000 \000\207\000 \000\210\000 \000\223\000\217\000\223\000"
+ " \000\202\000\211\000\225\000\212\000\225\000\210\000\225\000 \000\225\000"
+ " \000\204\000 \000\205\000 \000\206\000`\000\233\000`\000\235\000\233\000"
+ "\235\000\233\000\236\000`\000\236\000\236\000\237\000`\000\237\000a\000\237"
+ "\000\237\000\242\000\236\000\242\000\242\000\243\000\237\000\243\000\243"
+ "\000\244\000\237\000\244\000\244\000\245\000\243\000\245\000\245\000\246"
+ "\000\244\000\246\000\246\000\247\000\244\000\247\000\247\000\250\000\246"
+ "\000\250\000\250\000\251\000\247\000\251\000\251\000\252\000\247\000\252"
+ "\000\212\000\253\000\213\000\253\000\225\000\253\000\253\000\255\000\225"
+ "\000\255\000\253\000\256\000\255\000\256\000\256\000\257\000\253\000\257"
+ "\000\257\000\260\000\256\000\260\000\257\000\261\000\260\000\261\000\262"
+ "\000\263\000\263\000\264\000\262\000\264\000\262\000\265\000\263\000\265"
+ "\000\262\000\266\000\265\000\266\000\266\000\267\000\265\000\267\000\265"
+ "\000\270\000\267\000\270\000\270\000\271\000\265\000\271\000\270\000\272"
+ "\000\271\000\272\000\257\000\273\000\261\000\273\000\257\000\274\000\273"
+ "\000\274\000\257\000\275\000\274\000\275\000\216\000\223\000\276\000\277"
+ "\000\277\000\300\000\276\000\300\000\276\000\301\000\277\000\301\000\301"
+ "\000\302\000\277\000\302\000\271\000\303\000\272\000\303\000\300\000\303"
+ "\000\271\000\300\000\271\000\277\000\275\000\304\000\274\000\304\000\275"
+ "\000\305\000\304\000\305\000\275\000\306\000\305\000\306\000\307\000\310"
+ "\000\310\000\311\000\307\000\311\000\251\000\307\000\251\000\310\000\252"
+ "\000\307\000\306\000\312\000\305\000\312\000\306\000\313\000\312\000\313"
+ "\000\306\000\314\000\313\000\314\000\314\000\315\000\313\000\315\000\315"
+ "\000\316\000\313\000\316\000\315\000\317\000\316\000\317\000\315\000\320"
+ "\000\317\000\320\000\315\000\323\000\320\000\323\000\264\000\324\000\262"
+ "\000\324\000 \000\324\000\324\000\325\000 \000\325\000 \000\262\000\320\000"
+ "\326\000\317\000\326\000\320\000\327\000\326\000\327\000\320\000\330\000"
+ "\327\000\330\000\330\000\331\000\327\000\331\000\311\000\330\000\311\000"
+ "\331\000\307\000\330\000\302\000\332\000\301\000\332\000\235\000\332\000"
+ "\235\000\302\000`\000\302\000 \000\255\000 \000\256\000 \000\260\000\260"
+ "\000\267\000 \000\267\000\260\000\270\000\261\000\270\000\261\000\272\000"
+ "\272\000\273\000\273\000\303\000\274\000\303\000\274\000\300\000\300\000"
+ "\304\000\276\000\304\000\276\000\305\000\301\000\305\000\301\000\312\000"
+ "\312\000\332\000\313\000\332\000\235\000\313\000\235\000\316\000\233\000"
+ "\316\000\233\000\317\000\236\000\317\000\236\000\326\000\242\000\326\000"
+ "\242\000\327\000\243\000\327\000\243\000\331\000\245\000\331\000\245\000"
+ "\311\000\246\000\311\000\246\000\310\000\250\000\310\000 \000\266\000!\000"
+ "\325\000\007\000\333\000q\000\333\000l\000\334\000k\000\334\000k\000q\000"
+ "j\000q\000q\000\334\000q\000\340\000\340\000\341\000q\000\341\000\342\000"
+ "\343\000\343\000\344\000\342\000\344\000\342\000\345\000\343\000\345\000"
+ "\342\000\346\000\345\000\346\000\342\000\347\000\346\000\347\000q\000\350"
+ "\000\340\000\350\000\341\000\351\000q\000\351\000\352\000\353\000\353\000"
+ "\354\000\352\000\354\000\352\000\355\000\353\000\355\000\352\000\356\000"
+ "\355\000\356\000\352\000\361\000\356\000\361\000\356\000\362\000\355\000"
+ "\362\000\356\000\363\000\362\000\363\000\356\000\364\000\363\000\364\000"
+ "f\000q\000\333\000\350\000\351\000\366\000q\000\366\000\345\000\367\000\343"
+ "\000\367\000\370\000\371\000\371\000\372\000\370\000\372\000\370\000\373"
+ "\000\371\000\373\000\370\000\374\000\373\000\374\000\373\000\375\000\374"
+ "\000\375\000\375\000\376\000\373\000\376\000\376\000\377\000\373\000\377"
+ "\000\364\000\000\001\363\000\000\001\364\000\001\001\000\001\001\001\364"
+ "\000\002\001\001\001\002\001\003\001\004\001\004\001\005\001\003\001\005"
+ "\001\003\001\006\001\004\001\006\001\006\001\007\001\004\001\007\001i\000"
+ "q\000h\000q\000g\000q\000m\000\334\000\334\000\371\000m\000\371\000\334\000"
+ "\014\001\371\000\014\001\372\000\014\001\015\001\016\001\016\001\017\001"
+ "\015\001\017\001\015\001\020\001\016\001\020\001\015\001\021\001\020\001"
+ "\021\001\021\001\022\001\020\001\022\001\354\000\021\001\354\000\022\001"
+ "\352\000\021\001\345\000\366\000\366\000\367\000q\000\345\000\007\001\023"
+ "\001\006\001\023\001\023\001\024\001\007\001\024\001\024\001\025\001\007"
+ "\001\025\001\026\001\027\001\027\001\030\001\026\001\030\001\017\001\026"
+ "\001\017\001\027\001\015\001\026\001\002\001\031\001\001\001\031\001\002"
+ "\001\032\001\031\001\032\001\002\001\033\001\032\001\033\001\025\001\034"
+ "\001\024\001\034\001\032\001\034\001\025\001\032\001\025\001\033\001\347"
+ "\000\026\001\342\000\026\001\026\001\035\001\347\000\035\001\030\001\035"
+ "\001\036\001\037\001\037\001 \001\036\001 \001\005\001\036\001\005\001\037"
+ "\001\004\001\037\001\004\001#\001\037\001#\001$\001%\001%\001&\001$\001&"
+ "\001 \001$\001 \001%\001 \001'\001%\001'\001\037\001'\001\377\000(\001\376"
+ "\000(\001&\001(\001\377\000&\001\377\000%\001q\000\346\000q\000\347\000q"
+ "\000\035\001\372\000\035\001q\000\372\000\370\000\035\001\370\000\030\001"
+ "\374\000\030\001\374\000\027\001\375\000\027\001\375\000\017\001\376\000"
+ "\017\001\376\000\016\001\016\001(\001\020\001(\001\020\001&\001\020\001$"
+ "\001\022\001$\001\354\000$\001\354\000 \001\353\000 \001\353\000\036\001"
+ "\355\000\036\001\355\000\005\001\362\000\005\001\362\000\003\001\363\000"
+ "\003\001\363\000\006\001\000\001\006\001\000\001\023\001\001\001\023\001"
+ "\001\001\024\001\001\001\034\001\031\001\034\001q\000\014\001\302\000)\001"
+ "`\000)\001\277\000)\001\271\000)\001\265\000)\001\263\000)\001\344\000)\001"
+ "\263\000\344\000)\0011\001\344\0001\0011\0012\001\344\0002\001\352\0002\001"
+ "\344\000\352\000\344\000\021\001\344\000\015\001\344\000\026\001\263\000"
+ "\343\000\264\000\343\000\324\000\343\000\324\000\367\000\324\000\366\000"
+ "\325\000\366\000!\000\366\000!\000\351\000\042\000\351\000\042\000\341\000"
+ "\216\000\341\000\216\000\340\000\216\000\350\000\223\000\350\000\223\000"
+ "\333\000\217\000\333\000\007\000\217\000p\000\371\000\214\000\253\000\214"
+ "\000\257\000\214\000\275\000\214\000\306\000\214\000\314\000\214\000Q\001"
+ "\314\000Q\001w\000Q\001\315\000Q\001\037\001U\001<\000U\001<\000\037\001"
+ "=\000V\001Q\001V\001=\000Q\001=\000W\001V\001W\001=\000B\000=\000Y\001B\000"
+ "Y\001<\000W\001U\001W\001<\000\371\000<\000p\000\371\000%\001<\000%\001<"
+ "\000'\001\373\000%\001=\000N\000=\000w\000N\000Y\001[\000_\001I\000_\001"
+ "N\000_\001N\000[\000Y\001_\001}\000Y\001}\000_\001B\000}\0009\000B\000+\000"
+ "5\0005\000;\000\002\0005\000\000\0005\0005\000E\0005\000C\0005\000G\0005"
+ "\000I\000/\000}\0005\000}\000/\000y\000*\000/\000(\000/\000/\000Z\000/\000"
+ "X\000&\000/\000$\000/\0005\000_\001\315\000V\001_\000)\001V\001y\001y\001"
+ "z\001V\001z\001W\001y\001W\001|\001y\001|\001U\001|\001\361\000~\001\361"
+ "\000\177\001~\001\177\001\356\000~\001\364\000~\001\002\001~\001\033\001"
+ "~\0012\001\204\0011\001\204\001\177\001\204\0012\001\177\001_\0001\001_\000"
+ "\204\001\352\000\177\001\315\000z\001\204\001\211\001_\000\211\001~\001\204"
+ "\001~\001\211\001z\001\211\001z\001~\001z\001|\001|\001~\001\323\000z\001"
+ "\037\001|\001_\000\237\000\237\000\211\001\244\000\211\001\247\000\211\001"
+ "\252\000\211\001\033\001|\001\025\001|\001\007\001|\001\004\001|\001#\001"
+ "|\001\252\000z\001\307\000z\001\330\000z\001\320\000z\001\001\200\377\177"
+ "\377\177\000\000\377\177\001\200\377\177\000\000\377\177\377\177\001\200"
+ "\000\000\001\200\377\177\377\177\000\000\001\200\001\200\001\200\000\000"
+ "\377\177\001\200\377\177\000\000\377\177\377\177\001\200\000\000\001\200"
+ "\001\200\001\200\000\000\001\200\377\177\377\177\000\000\377\177\377\177"
+ "\001\200\000\000\377\177\001\200\377\177\000\000\001\200\001\200\001\200"
+ "\000\000******\326\326\326\326\326\326\253U\253U\253UU\253U\253U\253\000"
+ "\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010\000\011"
+ "\000\012\000\013\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\004\000\001\000\004\000\002\000\004\000\201n\001\200\000\000\000\000"
+ "\300\310\001\200\300\310\000\000\000\000\001\200\177\221\000\000@7\001\200"
+ "@7\000\000\377\177\377\177\001\200\000\000\177\221\001\200\001\200\000\000"
+ "\001\200\001\200\001\200\000\000\000\000\001\200\001\200\000\000\201n\001"
+ "\200\001\200\000\000\377\177\001\200\001\200\000\000\377\177\377\177\001"
+ "\200\000\000\377\177\001\200\177\221\000\000\377\177\001\200\001\200\000"
+ "\000\377\177\001\200\000\000\000\000\377\177\001\200\201n\000\000\377\177"
+ "\001\200\377\177\000\000\377\177\377\177\001\200\000\000\201n\001\200\201"
+ "n\000\000\377\177\001\200\377\177\000\000@7\001\200@7\000\000\300\310\001"
+ "\200\300\310\000\000\177\221\001\200\177\221\000\000\001\200\001\200\001"
+ "\200\000\000\177\221\001\200\177\221\000\000\001\200\001\200\001\200\000"
+ "\000\177\221\001\200\001\200\000\000\201n\001\200\201n\000\000\377\177\001"
+ "\200\377\177\000\000\377\177\001\200\201n\000\000\377\177\001\200\177\221"
+ "\000\000\201n\001\200\001\200\000\000\377\177\001\200\001\200\000\000\201"
+ "n\001\200\177\221\000\000\000\000\001\200\001\200\000\000\377\177\001\200"
+ "\000\000\000\000\000\201\000\201\000\201\000\201\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\326*\326*\326*\326*\326*\326*\326*\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\000\000\000"
+ "\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006\000\005\000"
+ "\004\000\007\000\007\000\004\000\010\000\010\000\004\000\011\000\012\000"
+ "\013\000\014\000\013\000\012\000\015\000\015\000\012\000\016\000\016\000"
+ "\012\000\017\000\020\000\021\000\022\000\021\000\020\000\023\000\023\000"
+ "\020\000\024\000\024\000\020\000\025\000\025\000\020\000\026\000\027\000"
+ "\030\000\031\000\032\000\003\000\000\000\001\000\027\000\002\000\033\000"
+ "\032\000\034\000\035\000\036\000\037\000\036\000\035\000 \000\002\000\031"
+ "\000!\000\031\000\002\000\027\000\034\000\000\000\042\000\000\000\034\000"
+ "\032\000 \000!\000\036\000!\000 \000\002\000\042\000 \000\035\000 \000\042"
+ "\000\000\000\000\000\002\000 \000\000\000\001\000\001\000\002\000\000\000"
+ "\002\000\000\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000"
+ "\004\000\006\000\004\000\007\000\005\000\007\000\004\000\010\000\007\000"
+ "\010\000\004\000\011\000\010\000\011\000\004\000\013\000\011\000\013\000"
+ "\004\000\015\000\013\000\015\000\004\000\016\000\015\000\016\000\004\000"
+ "\017\000\016\000\017\000\004\000\021\000\017\000\021\000\003\000\004\000"
+ "\003\000\021\000\001\000\004\000\004\000\025\000\001\000\025\000\006\000"
+ "\025\000\005\000\025\000\000\000\021\000\002\000\025\000\016\000\021\000"
+ "\010\000\013\000\013\000 \000\010\000 \000\002\000\005\000\002\000\007\000"
+ "\000\000\016\000\000\000\015\000\007\000 \000\002\000 \000\015\000 \000\000"
+ "\000 \000@7\377\177\300\310\000\000\201n\377\177\177\221\000\000\000\000"
+ "\377\177\177\221\000\000\001\200\377\177\377\177\000\000\001\200\377\177"
+ "\001\200\000\000\001\200\001\200\001\200\000\000\001\200\377\177\001\200"
+ "\000\000\001\200\377\177\377\177\000\000\001\200\377\177\201n\000\000\001"
+ "\200\377\177\000\000\000\000\001\200\377\177\177\221\000\000\177\221\377"
+ "\177\001\200\000\000\001\200\001\200\001\200\000\000\001\200\377\177\001"
+ "\200\000\000\377\177\377\177\001\200\000\000\377\177\377\177\001\200\000"
+ "\000\177\221\377\177\001\200\000\000\000\000\377\177\001\200\000\000\201"
+ "n\377\177\001\200\000\000\201n\377\177\177\221\000\000\001\200\001\200\001"
+ "\200\000\000\377\177\377\177\001\200\000\000\001\200\377\177\377\177\000"
+ "\000\201n\377\177\177\221\000\000\300\310\377\177@7\000\000\001\200\377\177"
+ "\377\177\000\000\177\221\377\177\201n\000\000\177\221\377\177\000\000\000"
+ "\000\177\221\377\177\001\200\000\000\001\200\377\177\001\200\000\000\177"
+ "\221\377\177\177\221\000\000\377\177\377\177\001\200\000\000\000\177\000"
+ "\177\000\177\201\000\201\000\201\000\253U\352K\000\177\000\177\000\177\177"
+ "\177\177\177\177\177\177\177YK3\177\000\177\000\177*\326*\326*\326*\326#"
+ "8\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\000"
+ "\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010\000\006\000"
+ "\010\000\011\000\006\000\011\000\012\000\013\000\014\000\015\000\014\000"
+ "\013\000\016\000\017\000\020\000\021\000\017\000\021\000\022\000\023\000"
+ "\024\000\025\000\024\000\023\000\026\000\007\000\027\000\000\000\007\000"
+ "\000\000\030\000\031\000\030\000\032\000\033\000\000\000\002\000\000\000"
+ "\033\000\030\000\012\000\034\000\035\000\034\000\012\000\036\000\001\000"
+ "\037\000\022\000\002\000\022\000\021\000\022\000\002\000\001\000\032\000"
+ "\030\000\033\000\031\000\032\000\010\000\010\000\033\000\011\000\033\000"
+ "\010\000\032\000\011\000\036\000\012\000\036\000\011\000\033\000\036\000"
+ "\021\000\034\000\021\000\036\000\002\000\033\000\002\000\036\000\000\000"
+ "\001\000\001\000\002\000\000\000\002\000\003\000\004\000\004\000\005\000"
+ "\003\000\005\000\003\000\010\000\004\000\010\000\010\000\011\000\004\000"
+ "\011\000\011\000\012\000\004\000\012\000\005\000\013\000\004\000\013\000"
+ "\013\000\016\000\005\000\016\000\013\000\021\000\016\000\021\000\021\000"
+ "\022\000\016\000\022\000\001\000\005\000\001\000\016\000\001\000\003\000"
+ "\000\000\003\000\000\000\030\000\003\000\030\000\030\000\032\000\003\000"
+ "\032\000\000\000\033\000\002\000\033\000\030\000\033\000\012\000\013\000"
+ "\012\000\036\000\013\000\036\000\001\000\022\000\002\000\022\000\002\000"
+ "\021\000\032\000\033\000\010\000\032\000\010\000\033\000\011\000\033\000"
+ "\011\000\036\000\033\000\036\000\021\000\036\000\002\000\036\000\377\177"
+ "\377\177\001\200\000\000\377\177\377\177\377\177\000\000\377\177\001\200"
+ "\377\177\000\000\377\177\377\177\377\177\000\000\377\177\377\177\001\200"
+ "\000\000\377\177\377\177\177\221\000\000\377\177\377\177\000\000\000\000"
+ "\377\177\377\177\201n\000\000\377\177\001\200\377\177\000\000\177\221\377"
+ "\177\377\177\000\000\001\200\377\177\377\177\000\000\000\000\377\177\377"
+ "\177\000\000\201n\377\177\377\177\000\000\377\177\377\177\377\177\000\000"
+ "\201n\377\177\000\000\000\000\201n\377\177\177\221\000\000@7\377\177\300"
+ "\310\000\000\377\177\377\177\001\200\000\000\377\177\001\200\377\177\000"
+ "\000\201n\377\177\177\221\000\000\377\177\377\177\001\200\000\000@7\377\177"
+ "\300\310\000\000\300\310\377\177@7\000\000\177\221\377\177\201n\000\000\001"
+ "\200\377\177\377\177\000\000\201n\377\177\201n\000\000\177\221\377\177\377"
+ "\177\000\000\177\221\377\177\201n\000\000\001\200\377\177\377\177\000\000"
+ "\000\000\377\177\201n\000\000\300\310\377\177@7\000\000\000\000\377\177\377"
+ "\177\000\000\201n\377\177\377\177\000\000\377\177\377\177\377\177\000\000"
+ "\177\000\177\000\177\000**YY\000\177\000\177\000\177\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\177\000\177\000\177\000\177\253\253\253"
+ "\253\253\253\253\253\253\253\253\253\253\253\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\000\001\000\002\000\003"
+ "\000\004\000\005\000\003\000\005\000\006\000\003\000\006\000\007\000\010"
+ "\000\011\000\012\000\011\000\010\000\013\000\013\000\010\000\014\000\014"
+ "\000\010\000\015\000\016\000\017\000\020\000\005\000\021\000\017\000\022"
+ "\000\023\000\024\000\023\000\022\000\025\000\025\000\022\000\026\000\026"
+ "\000\022\000\027\000\027\000\022\000\030\000\031\000\006\000\016\000\006"
+ "\000\031\000\007\000\016\000\005\000\017\000\005\000\016\000\006\000\032"
+ "\000\033\000\034\000\035\000\036\000\033\000\032\000\035\000\033\000\035"
+ "\000\032\000\037\000\036\000\016\000\020\000\016\000\036\000\035\000 \000"
+ "\007\000\031\000\007\000 \000!\000\031\000\016\000\035\000\037\000\031\000"
+ "\035\000\031\000\037\000 \000\000\000\001\000\001\000\002\000\000\000\002"
+ "\000\000\000\005\000\001\000\005\000\005\000\006\000\001\000\006\000\006"
+ "\000\007\000\001\000\007\000\002\000\011\000\011\000\012\000\002\000\012"
+ "\000\002\000\013\000\011\000\013\000\002\000\014\000\013\000\014\000\001"
+ "\000\014\000\016\000\017\000\017\000\020\000\016\000\020\000\000\000\017"
+ "\000\005\000\017\000\002\000\017\000\002\000\020\000\002\000\026\000\020"
+ "\000\026\000\002\000\027\000\026\000\027\000\012\000\027\000\006\000\031"
+ "\000\006\000\016\000\016\000\031\000\007\000\031\000\005\000\016\000\011"
+ "\000\027\000\026\000\035\000\027\000\035\000\011\000\035\000\013\000\035"
+ "\000\016\000\026\000\016\000\035\000\007\000\014\000\014\000\031\000\031"
+ "\000\035\000\013\000\031\000@7\001\200@7\000\000\177\221\001\200\000\000"
+ "\000\000\300\310\001\200\300\310\000\000\000\000\001\200\201n\000\000\177"
+ "\221\001\200\377\177\000\000\001\200\377\177\377\177\000\000\001\200\001"
+ "\200\377\177\000\000\377\177\001\200\377\177\000\000\377\177\001\200\377"
+ "\177\000\000\177\221\001\200\377\177\000\000\000\000\001\200\377\177\000"
+ "\000\201n\001\200\377\177\000\000\001\200\377\177\377\177\000\000\001\200"
+ "\001\200\201n\000\000\001\200\001\200\377\177\000\000\001\200\001\200\000"
+ "\000\000\000\001\200\001\200\177\221\000\000\001\200\001\200\001\200\000"
+ "\000\001\200\377\177\377\177\000\000\177\221\001\200\177\221\000\000\001"
+ "\200\001\200\001\200\000\000\300\310\001\200\300\310\000\000@7\001\200@7"
+ "\000\000\201n\001\200\201n\000\000\377\177\001\200\377\177\000\000\177\221"
+ "\001\200\177\221\000\000\201n\001\200\201n\000\000\001\200\001\200\177\221"
+ "\000\000\001\200\001\200\001\200\000\000\177\221\001\200\377\177\000\000"
+ "\001\200\001\200\201n\000\000\177\221\001\200\201n\000\000\001\200\001\200"
+ "\377\177\000\000\001\200\001\200\000\000\000\000\377\177\001\200\377\177"
+ "\000\000\000\201\000\201\000\201\000\201\000\000\000\000\000\000\000\000"
+ "4\332\000\264\000\201\000\201\201\000\201\000\201\000\201\000\201\000\201"
+ "\000UUUUUUUUUUUUUU\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\000\000\000\001\000\002\000\001\000\000\000"
+ "\003\000\004\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000"
+ "\012\000\010\000\012\000\013\000\014\000\015\000\016\000\015\000\014\000"
+ "\017\000\017\000\014\000\020\000\020\000\014\000\021\000\022\000\023\000"
+ "\024\000\023\000\022\000\025\000\025\000\022\000\026\000\026\000\022\000"
+ "\027\000\027\000\022\000\030\000\001\000\031\000\002\000\013\000\003\000"
+ "\032\000\003\000\013\000\012\000\003\000\000\000\032\000\033\000\034\000"
+ "\031\000\035\000\036\000\037\000\036\000\035\000 \000\037\000!\000\001\000"
+ "!\000\037\000\036\000\012\000\037\000\003\000\037\000\012\000\035\000\001"
+ "\000\033\000\031\000\033\000\001\000!\000\037\000\001\000\003\000\013\000"
+ "\032\000\042\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000"
+ "\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006\000"
+ "\004\000\007\000\005\000\007\000\004\000\012\000\007\000\012\000\012\000"
+ "\013\000\007\000\013\000\005\000\015\000\006\000\015\000\005\000\017\000"
+ "\015\000\017\000\005\000\020\000\017\000\020\000\005\000\021\000\020\000"
+ "\021\000\005\000\023\000\021\000\023\000\002\000\005\000\002\000\023\000"
+ "\000\000\005\000\005\000\027\000\000\000\027\000\007\000\027\000\001\000"
+ "\023\000\003\000\013\000\003\000\027\000\013\000\027\000\003\000\012\000"
+ "\020\000\023\000\004\000\015\000\015\000\037\000\004\000\037\000\017\000"
+ "\037\000\001\000\017\000\001\000\037\000\012\000\037\000\003\000\037\000"
+ "\001\000\020\000"
+;
+const unsigned long lament_model_size = 118328;
@@ -69,6 +69,7 @@
 			"*wireframe:    False       \n" \
 			"*geometry:	600x900\n"      \
 			"*count:      " DEF_COUNT " \n" \
+			THREAD_DEFAULTS_XLOCK
 
 # define release_lavalite 0
 
@@ -86,6 +87,7 @@
 
 #include "xlockmore.h"
 #include "marching.h"
+#include "thread_util.h"
 #include "rotator.h"
 #include "gltrackball.h"
 #include "ximage-loader.h"
@@ -93,7 +95,6 @@
 
 #ifdef USE_GL /* whole file */
 
-
 #define DEF_SPIN        "Z"
 #define DEF_WANDER      "False"
 #define DEF_SPEED       "0.003"
@@ -213,7 +214,8 @@ typedef struct {
   metaball *balls;
 
   GLuint bottle_list;
-  GLuint ball_list;
+  marching_mesh *mesh;		   /* the lava, rebuilt every frame */
+  GLuint lava_buffers[2];	   /* vertexes and indexes, if we have VBOs */
 
   int bottle_poly_count;	   /* polygons in the bottle only */
 
@@ -266,6 +268,7 @@ static XrmOptionDescRec opts[] = {
   { "-fluid-texture",".fluidTexture",  XrmoptionSepArg, 0 },
   { "-base-texture", ".baseTexture",   XrmoptionSepArg, 0 },
   { "-table-texture",".tableTexture",  XrmoptionSepArg, 0 },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
@@ -875,7 +878,7 @@ max_bottle_radius (lavalite_configuration *bp)
 
 
 static GLfloat
-bottle_radius_at (lavalite_configuration *bp, GLfloat z)
+bottle_radius_at (const lavalite_configuration *bp, GLfloat z)
 {
   GLfloat topz = -999, botz = -999, topr = 0, botr = 0;
   const lamp_geometry *slice;
@@ -1004,129 +1007,116 @@ move_balls (ModeInfo *mi)   /* for great justice */
 
 
 /* Rendering blobbies using marching cubes.
+
+   The field is computed a row of the grid at a time, along X: within a
+   row, each ball only reaches a short run of points, and the radius of
+   the glass is the same everywhere.
  */
 
-static double
-compute_metaball_influence (lavalite_configuration *bp,
-                            double x, double y, double z,
-                            int nballs, metaball *balls)
+/* Grid coordinates to lamp coordinates: X and Y range from -.5 to +.5;
+   Z ranges from 0-1. */
+#define GRID_X(BP,X) ((double) (X) / (BP)->grid_size - 0.5)
+#define GRID_Y(BP,Y) ((double) (Y) / (BP)->grid_size - 0.5)
+#define GRID_Z(BP,Z) ((double) (Z) / (BP)->grid_size)
+
+
+/* Adds the influence of the metaballs to the n points of the row at y,z.
+ */
+static void
+add_metaball_influence (const lavalite_configuration *bp,
+                        double y, double z, int n, float *out)
 {
-  double vv = 0;
   int i;
 
-  for (i = 0; i < nballs; i++)
+  for (i = 0; i < bp->nballs; i++)
     {
-      metaball *b = &balls[i];
-      double dx, dy, dz;
-      double d2, r, R, r2, R2;
+      const metaball *b = &bp->balls[i];
+      double dy, dz, dyz2, r2, R2, scale;
+      double R = b->R;
+      int x, x0, x1;
 
       if (!b->alive_p) continue;
 
-      dx = x - b->x;
       dy = y - b->y;
       dz = z - b->z;
-      R = b->R;
-
-      if (dx > R || dx < -R ||    /* quick check before multiplying */
-          dy > R || dy < -R ||
+      if (dy > R || dy < -R ||    /* quick check before multiplying */
           dz > R || dz < -R)
         continue;
 
-      d2 = (dx*dx + dy*dy + dz*dz);
-      r = b->r;
+      /* The points of the row within R of the ball, on X. */
+      x0 = floor ((b->x - R + 0.5) * bp->grid_size);
+      x1 = ceil  ((b->x + R + 0.5) * bp->grid_size);
+      if (x0 < 0) x0 = 0;
+      if (x1 > n-1) x1 = n-1;
 
-      r2 = r*r;
-      R2 = R*R;
+      r2 = b->r * b->r;
+      R2 = R * R;
+      dyz2 = dy*dy + dz*dz;
+      scale = 1 / (R2 - r2);
 
-      if (d2 <= r2)             /* (d <= r)   inside the hard radius */
-        vv += 1;
-      else if (d2 > R2)         /* (d > R)   outside the radius of influence */
-        ;
-      else          /* somewhere in between: linear drop-off from r=1 to R=0 */
+      for (x = x0; x <= x1; x++)
         {
-          /* was: vv += 1 - ((d-r) / (R-r)); */
-          vv += 1 - ((d2-r2) / (R2-r2));
+          double dx = GRID_X (bp, x) - b->x;
+          double d2 = dx*dx + dyz2;
+
+          /* Inside the hard radius, 1; outside the radius of influence, 0;
+             and in between, a linear drop-off from r=1 to R=0.
+             was: vv += 1 - ((d-r) / (R-r)); */
+          out[x] += (d2 <= r2 ? 1 :
+                     d2 >  R2 ? 0 :
+                     1 - (d2 - r2) * scale);
         }
     }
-
-  return vv;
-}
-
-
-/* callback for marching_cubes() */
-static void *
-obj_init (double grid_size, void *closure)
-{
-  lavalite_configuration *bp = (lavalite_configuration *) closure;
-  bp->grid_size = grid_size;
-
-  return closure;
 }
 
 
-/* Returns True if the given point is outside of the glass tube.
+/* Fades out the n points of the row at y,z as they approach the glass
+   tube, and zeroes those outside of it.
  */
-static double
-clipped_by_glass_p (double x, double y, double z,
-                    lavalite_configuration *bp)
+static void
+clip_by_glass (const lavalite_configuration *bp,
+               double y, double z, int n, float *out)
 {
-  double d2, or, or2, ir2;
+  double or, or2, ir2, scale, y2;
+  int x;
 
   or = bp->max_bottle_radius;
+  if (y > or || y < -or)      /* quick check before multiplying */
+    {
+      memset (out, 0, n * sizeof(*out));
+      return;
+    }
 
-  if (x > or || x < -or ||    /* quick check before multiplying */
-      y > or || y < -or)
-    return 0;
-
-  d2 = (x*x + y*y);
   or = bottle_radius_at (bp, z);
-
   or2 = or*or;
-
-  if (d2 > or2)   /* (sqrt(d) > or) */
-    return 0;
-
   ir2 = or2 * 0.7;
+  scale = 1 / (or2 - ir2);
+  y2 = y*y;
 
-  if (d2 > ir2)  /* (sqrt(d) > ir) */
+  for (x = 0; x < n; x++)
     {
-      double dr1 = or2;
-      double dr2 = ir2;
+      double gx = GRID_X (bp, x);
+      double d2 = gx*gx + y2;
       /* was: (1 - (d-ratio2) / (ratio1-ratio2)) */
-      return (1 - (d2-dr2) / (dr1-dr2));
+      out[x] *= (d2 > or2 ? 0 :
+                 d2 > ir2 ? 1 - (d2 - ir2) * scale :
+                 1);
     }
-
-  return 1;
-}
-
-
-
-/* callback for marching_cubes() */
-static double
-obj_compute (double x, double y, double z, void *closure)
-{
-  lavalite_configuration *bp = (lavalite_configuration *) closure;
-  double clip;
-
-  x /= bp->grid_size;	/* convert from 0-N to 0-1. */
-  y /= bp->grid_size;
-  z /= bp->grid_size;
-
-  x -= 0.5;	/* X and Y range from -.5 to +.5; z ranges from 0-1. */
-  y -= 0.5;
-
-  clip = clipped_by_glass_p (x, y, z, bp);
-  if (clip == 0) return 0;
-
-  return (clip *
-          compute_metaball_influence (bp, x, y, z, bp->nballs, bp->balls));
 }
 
 
-/* callback for marching_cubes() */
+/* callback for marching_cubes_mesh(): runs on several threads at once.
+ */
 static void
-obj_free (void *closure)
+obj_compute_row (int y, int z, int n, float *out, void *closure)
 {
+  const lavalite_configuration *bp = (lavalite_configuration *) closure;
+  double gy = GRID_Y (bp, y);
+  double gz = GRID_Z (bp, z);
+
+  memset (out, 0, n * sizeof(*out));
+  add_metaball_influence (bp, gy, gz, n, out);
+  clip_by_glass (bp, gy, gz, n, out);
 }
 
 
@@ -1201,7 +1191,20 @@ animate_lava (ModeInfo *mi)
 
   move_balls (mi);
 
-  glNewList (bp->ball_list, GL_COMPILE);
+  bp->grid_size = resolution;
+  mi->polygon_count =
+    marching_cubes_mesh (bp->mesh, bp->grid_size, isolevel, wire, do_smooth,
+                         obj_compute_row, bp);
+  mi->polygon_count += bp->bottle_poly_count;
+}
+
+
+static void
+draw_lava (ModeInfo *mi)
+{
+  lavalite_configuration *bp = &bps[MI_SCREEN(mi)];
+  double s = 1.0 / bp->grid_size;
+
   glPushMatrix();
 
   glMaterialfv (GL_FRONT, GL_SPECULAR,            lava_spec);
@@ -1213,25 +1216,11 @@ animate_lava (ModeInfo *mi)
    */
   glTranslatef (0, 0, -0.5);
 
-  mi->polygon_count = 0;
-  {
-    double s;
-    if (bp->grid_size == 0) bp->grid_size = 1;  /* first time through */
-    s = 1.0/bp->grid_size;
-
-    glPushMatrix();
-    glTranslatef (-0.5, -0.5, 0);
-    glScalef (s, s, s);
-    marching_cubes (resolution, isolevel, wire, do_smooth,
-                    obj_init, obj_compute, obj_free, bp,
-                    &mi->polygon_count);
-    glPopMatrix();
-  }
-
-  mi->polygon_count += bp->bottle_poly_count;
+  glTranslatef (-0.5, -0.5, 0);
+  glScalef (s, s, s);
+  marching_mesh_draw (bp->mesh, bp->lava_buffers[0], bp->lava_buffers[1]);
 
   glPopMatrix();
-  glEndList ();
 }
 
 
@@ -1399,7 +1388,18 @@ init_lavalite (ModeInfo *mi)
   bp->balls = (metaball *) calloc (sizeof(*bp->balls), bp->nballs+1);
 
   bp->bottle_list = glGenLists (1);
-  bp->ball_list = glGenLists (1);
+  bp->mesh = marching_mesh_new (MI_DISPLAY (mi));
+
+# ifdef USE_VBO
+  {
+    /* Buffer objects are core as of OpenGL 1.5. */
+    const char *s = (const char *) glGetString (GL_VERSION);
+    int maj = 0, min = 0;
+    if (s && 2 == sscanf (s, "%d.%d", &maj, &min) &&
+        (maj > 1 || (maj == 1 && min >= 5)))
+      glGenBuffers (2, bp->lava_buffers);
+  }
+# endif /* USE_VBO */
 
   generate_bottle (mi);
   generate_static_blobs (mi);
@@ -1521,7 +1521,7 @@ draw_lavalite (ModeInfo *mi)
 
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
   glCallList (bp->bottle_list);
-  glCallList (bp->ball_list);
+  draw_lava (mi);
   glPopMatrix ();
 
   if (mi->fps_p) do_fps (mi);
@@ -1542,7 +1542,10 @@ free_lavalite (ModeInfo *mi)
   if (bp->rot) free_rotator (bp->rot);
   if (bp->rot2) free_rotator (bp->rot2);
   if (glIsList(bp->bottle_list)) glDeleteLists(bp->bottle_list, 1);
-  if (glIsList(bp->ball_list)) glDeleteLists(bp->ball_list, 1);
+  if (bp->mesh) marching_mesh_free (bp->mesh);
+# ifdef USE_VBO
+  if (bp->lava_buffers[0]) glDeleteBuffers (2, bp->lava_buffers);
+# endif
 }
 
 XSCREENSAVER_MODULE ("Lavalite", lavalite)
@@ -16,9 +16,12 @@
 #include "screenhackI.h"
 #include "marching.h"
 #include "normals.h"
+#include "thread_util.h"
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <errno.h>
 #include <math.h>
 
 #undef ABS
@@ -626,3 +629,604 @@ marching_cubes (int grid_size,     /* density of the mesh */
   if (polygon_count)
     *polygon_count = polys;
 }
+
+
+/* Indexed meshes, for marching_cubes_mesh().
+
+   The whole field is computed first, a slab of layers per thread, since
+   the normals need the layers on either side of a vertex.  Then each
+   thread polygonizes its own slab a layer at a time: every point owns the
+   three edges leading from it toward +X, +Y and +Z, so each vertex is
+   made exactly once, and the thread remembers which one it was for the
+   current and previous layers.  The only vertexes made twice are those
+   in the layer where two threads' slabs meet.
+
+   Most of the grid is nowhere near the surface, so while computing the
+   field we also note which rows are entirely inside or outside: a row of
+   cubes between four such rows that agree has no faces to make.
+ */
+
+#define ROW_OUT   0
+#define ROW_IN    1
+#define ROW_MIXED 2
+
+/* For each of the 12 edges of a cube (see "Indexing convention" above),
+   the corner of the cube at which the edge starts, and the axis it goes
+   along from there.  Corner 0 is the lowest X, Y and Z.
+ */
+static const unsigned char cube_edges[12][4] = {
+  { 0, 0, 0, 0 }, { 1, 0, 0, 1 }, { 0, 1, 0, 0 }, { 0, 0, 0, 1 },
+  { 0, 0, 1, 0 }, { 1, 0, 1, 1 }, { 0, 1, 1, 0 }, { 0, 0, 1, 1 },
+  { 0, 0, 0, 2 }, { 1, 0, 0, 2 }, { 1, 1, 0, 2 }, { 0, 1, 0, 2 },
+};
+
+struct mesh_thread {
+  marching_mesh *m;
+  unsigned id;
+  int *edges;			/* 3 per point, for two layers: the vertex on
+                                   the point's +X, +Y and +Z edges */
+  int edges_size;
+  GLfloat *verts;		/* normal and position, as with GL_N3F_V3F */
+  int nverts, verts_size;
+  GLuint *indices;
+  int nindices, indices_size;
+};
+
+struct marching_mesh {
+  struct threadpool threads;
+  struct mesh_thread **workers;
+  struct mesh_thread serial;	/* the only worker, if threads.count is 0 */
+
+  int grid_size;
+  float isolevel;
+  int wireframe_p, smooth_p;
+  void (*row_fn) (int y, int z, int n, float *out, void *closure);
+  void *closure;
+
+  float *values;		/* grid_size^3 */
+  int values_size;
+  unsigned char *rows;		/* grid_size^2: ROW_IN, ROW_OUT or ROW_MIXED */
+  int rows_size;
+  int edge_offset[12];		/* from corner 0 of a cube to each edge's
+                                   entry in mesh_thread.edges */
+
+  GLfloat *verts, *flat;
+  int nverts, verts_size, flat_size;
+  GLuint *indices;
+  int nindices, indices_size;
+  GLenum primitive;
+};
+
+
+static void *
+mesh_grow (void *p, int *size, long want, size_t elt)
+{
+  if (want > *size)
+    {
+      long s = (*size ? *size : 1024);
+      while (s < want) s *= 2;
+      p = realloc (p, s * elt);
+      if (!p)
+        {
+          fprintf (stderr, "%s: out of memory for marching cubes\n",
+                   progname);
+          exit (1);
+        }
+      *size = s;
+    }
+  return p;
+}
+
+
+/* Without a threadpool, the serial worker does everything. */
+#define MESH_WORKERS(M) ((M)->threads.count ? (M)->threads.count : 1)
+
+
+/* This thread's share of the n layers or slabs: [*z0, *z1). */
+static void
+mesh_thread_range (const struct mesh_thread *t, int n, int *z0, int *z1)
+{
+  unsigned count = MESH_WORKERS (t->m);
+  *z0 = (int) ((long) n * t->id / count);
+  *z1 = (int) ((long) n * (t->id + 1) / count);
+}
+
+
+static void
+mesh_field_run (void *self)
+{
+  struct mesh_thread *t = (struct mesh_thread *) self;
+  marching_mesh *m = t->m;
+  int n = m->grid_size;
+  int y, z, z0, z1;
+
+  mesh_thread_range (t, n, &z0, &z1);
+  for (z = z0; z < z1; z++)
+    for (y = 0; y < n; y++)
+      {
+        float *v = m->values + ((long) z * n + y) * n;
+        int x, in = 0;
+        m->row_fn (y, z, n, v, m->closure);
+        for (x = 0; x < n; x++)
+          in += (v[x] < m->isolevel);
+        m->rows[(long) z * n + y] = (in == 0 ? ROW_OUT :
+                                     in == n ? ROW_IN : ROW_MIXED);
+      }
+}
+
+
+/* The normal at a grid point: the same differences that
+   do_function_normal() takes, but of the values we already have.
+ */
+static void
+mesh_gradient (const marching_mesh *m, int x, int y, int z, GLfloat *g)
+{
+  const float *v = m->values;
+  int n = m->grid_size;
+  long nn = (long) n * n;
+  long p = z * nn + (long) y * n + x;
+
+  g[0] = v[x > 0 ? p-1  : p] - v[x < n-1 ? p+1  : p];
+  g[1] = v[y > 0 ? p-n  : p] - v[y < n-1 ? p+n  : p];
+  g[2] = v[z > 0 ? p-nn : p] - v[z < n-1 ? p+nn : p];
+}
+
+
+/* Makes the vertex where the surface cuts the edge from point p, at
+   x,y,z, to the next point along the axis, and notes it in *slot.
+ */
+static void
+mesh_vertex (struct mesh_thread *t, long p, int axis, long step,
+             int x, int y, int z, int *slot)
+{
+  marching_mesh *m = t->m;
+  float iso = m->isolevel;
+  float v0 = m->values[p];
+  float v1 = m->values[p + step];
+  float mu;
+  GLfloat *out;
+
+  /* The same as interp_vertex(). */
+  if (ABS(iso-v0) < 0.00001)
+    mu = 0;
+  else if (ABS(iso-v1) < 0.00001)
+    mu = 1;
+  else if (ABS(v0-v1) < 0.00001)
+    mu = 0;
+  else
+    mu = (iso - v0) / (v1 - v0);
+
+  t->verts = (GLfloat *)
+    mesh_grow (t->verts, &t->verts_size, (t->nverts + 1) * 6L,
+               sizeof(*t->verts));
+  out = t->verts + t->nverts * 6L;
+  out[3] = x;
+  out[4] = y;
+  out[5] = z;
+  out[3 + axis] += mu;
+
+  if (m->smooth_p)
+    {
+      GLfloat g1[3];
+      float d;
+      int i;
+      mesh_gradient (m, x, y, z, out);
+      mesh_gradient (m, x + (axis == 0), y + (axis == 1), z + (axis == 2),
+                     g1);
+      for (i = 0; i < 3; i++)
+        out[i] += mu * (g1[i] - out[i]);
+      d = out[0]*out[0] + out[1]*out[1] + out[2]*out[2];
+      if (d > 0)
+        {
+          d = 1 / sqrt (d);
+          out[0] *= d;
+          out[1] *= d;
+          out[2] *= d;
+        }
+    }
+  else
+    out[0] = out[1] = out[2] = 0;	/* see mesh_flatten() */
+
+  *slot = t->nverts++;
+}
+
+
+/* Makes the vertexes on the edges leading from the points of layer z:
+   along X and Y, and along Z too unless this is the top of the slab.
+ */
+static void
+mesh_layer (struct mesh_thread *t, int z, int up_p)
+{
+  marching_mesh *m = t->m;
+  float iso = m->isolevel;
+  int n = m->grid_size;
+  long nn = (long) n * n;
+  const unsigned char *rows = m->rows + (long) z * n;
+  int *edges = t->edges + (z & 1) * 3 * nn;
+  int x, y;
+
+  for (y = 0; y < n; y++)
+    {
+      long p = z * nn + (long) y * n;
+      const float *v = m->values + p;
+      int *e = edges + 3L * y * n;
+      int row = rows[y];
+      Bool x_p = (row == ROW_MIXED);
+      Bool y_p = (y < n-1 && (row == ROW_MIXED || rows[y+1] != row));
+      Bool z_p = (up_p    && (row == ROW_MIXED || rows[y+n] != row));
+
+      if (!x_p && !y_p && !z_p)
+        continue;
+
+      for (x = 0; x < n; x++, e += 3)
+        {
+          int in = (v[x] < iso);
+          if (x_p && x < n-1 && (v[x+1] < iso) != in)
+            mesh_vertex (t, p + x, 0, 1, x, y, z, e);
+          if (y_p && (v[x+n] < iso) != in)
+            mesh_vertex (t, p + x, 1, n, x, y, z, e + 1);
+          if (z_p && (v[x+nn] < iso) != in)
+            mesh_vertex (t, p + x, 2, nn, x, y, z, e + 2);
+        }
+    }
+}
+
+
+/* Makes the faces in the cubes between layers z and z+1.
+ */
+static void
+mesh_faces (struct mesh_thread *t, int z)
+{
+  marching_mesh *m = t->m;
+  float iso = m->isolevel;
+  int n = m->grid_size;
+  long nn = (long) n * n;
+  int per_tri = (m->wireframe_p ? 6 : 3);
+  const int *edges[2];
+  int x, y;
+
+  edges[0] = t->edges + (z & 1) * 3 * nn;
+  edges[1] = t->edges + (~z & 1) * 3 * nn;
+
+# define COLUMN(V,X) (((V)[X] < iso) | \
+                      (((V)[(X)+n] < iso) << 1) | \
+                      (((V)[(X)+nn] < iso) << 2) | \
+                      (((V)[(X)+n+nn] < iso) << 3))
+
+  for (y = 0; y < n-1; y++)
+    {
+      const float *v = m->values + z * nn + (long) y * n;
+      const unsigned char *rows = m->rows + (long) z * n + y;
+      int left;
+
+      if (rows[0] != ROW_MIXED &&
+          rows[0] == rows[1] && rows[0] == rows[n] && rows[0] == rows[n+1])
+        continue;
+
+      left = COLUMN (v, 0);
+
+      for (x = 0; x < n-1; x++)
+        {
+          /* The four corners at x+1 are the four at x of the next cube. */
+          int right = COLUMN (v, x+1);
+          int cubeindex = ((left & 1)        | ((left & 2) << 2)  |
+                           ((left & 4) << 2) | ((left & 8) << 4)  |
+                           ((right & 1) << 1) | ((right & 2) << 1) |
+                           ((right & 4) << 3) | ((right & 8) << 3));
+          const int *tri;
+          GLuint *out;
+          int i;
+
+          left = right;
+          if (edgeTable[cubeindex] == 0)
+            continue;
+
+          t->indices = (GLuint *)
+            mesh_grow (t->indices, &t->indices_size,
+                       t->nindices + 5L * per_tri, sizeof(*t->indices));
+          out = t->indices + t->nindices;
+
+          tri = triTable[cubeindex];
+          for (i = 0; tri[i] != -1; i += 3)
+            {
+              GLuint idx[3];
+              int j;
+              for (j = 0; j < 3; j++)
+                {
+                  int k = tri[i+j];
+                  idx[j] = edges[cube_edges[k][2]][3 * (y * n + x) +
+                                                   m->edge_offset[k]];
+                }
+              if (m->wireframe_p)
+                {
+                  *out++ = idx[0]; *out++ = idx[1];
+                  *out++ = idx[1]; *out++ = idx[2];
+                  *out++ = idx[2]; *out++ = idx[0];
+                }
+              else
+                {
+                  *out++ = idx[0]; *out++ = idx[1]; *out++ = idx[2];
+                }
+            }
+          t->nindices = out - t->indices;
+        }
+    }
+# undef COLUMN
+}
+
+
+static void
+mesh_run (void *self)
+{
+  struct mesh_thread *t = (struct mesh_thread *) self;
+  marching_mesh *m = t->m;
+  int n = m->grid_size;
+  int z, z0, z1;
+
+  t->nverts = 0;
+  t->nindices = 0;
+  mesh_thread_range (t, n-1, &z0, &z1);
+  if (z0 >= z1) return;
+
+  t->edges = (int *)
+    mesh_grow (t->edges, &t->edges_size, 2 * 3L * n * n, sizeof(*t->edges));
+
+  mesh_layer (t, z0, True);
+  for (z = z0; z < z1; z++)
+    {
+      mesh_layer (t, z+1, z+1 < z1);
+      mesh_faces (t, z);
+    }
+}
+
+
+/* Faceted: give every face its own three vertexes, with the face's normal.
+ */
+static void
+mesh_flatten (marching_mesh *m)
+{
+  GLfloat *swap;
+  int i, j, size;
+
+  m->flat = (GLfloat *)
+    mesh_grow (m->flat, &m->flat_size, m->nindices * 6L, sizeof(*m->flat));
+
+  for (i = 0; i < m->nindices; i += 3)
+    {
+      XYZ p[3], n;
+      for (j = 0; j < 3; j++)
+        {
+          const GLfloat *v = m->verts + m->indices[i+j] * 6L + 3;
+          p[j].x = v[0];
+          p[j].y = v[1];
+          p[j].z = v[2];
+        }
+      n = calc_normal (p[0], p[1], p[2]);
+      for (j = 0; j < 3; j++)
+        {
+          GLfloat *out = m->flat + (i + j) * 6L;
+          out[0] = n.x;
+          out[1] = n.y;
+          out[2] = n.z;
+          out[3] = p[j].x;
+          out[4] = p[j].y;
+          out[5] = p[j].z;
+          m->indices[i+j] = i + j;
+        }
+    }
+
+  swap = m->verts; m->verts = m->flat; m->flat = swap;
+  size = m->verts_size; m->verts_size = m->flat_size; m->flat_size = size;
+  m->nverts = m->nindices;
+}
+
+
+static int
+mesh_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct mesh_thread *t = (struct mesh_thread *) self;
+  marching_mesh *m = GET_PARENT_OBJ (marching_mesh, threads, pool);
+  memset (t, 0, sizeof(*t));
+  t->m = m;
+  t->id = id;
+  m->workers[id] = t;
+  return 0;
+}
+
+
+static void
+mesh_thread_destroy (void *self)
+{
+  struct mesh_thread *t = (struct mesh_thread *) self;
+  if (t->edges) free (t->edges);
+  if (t->verts) free (t->verts);
+  if (t->indices) free (t->indices);
+}
+
+
+marching_mesh *
+marching_mesh_new (Display *dpy)
+{
+  static const struct threadpool_class cls = {
+    sizeof (struct mesh_thread),
+    mesh_thread_create,
+    mesh_thread_destroy
+  };
+  marching_mesh *m = (marching_mesh *) calloc (1, sizeof(*m));
+  unsigned count = hardware_concurrency (dpy);
+  int err;
+
+  if (m)
+    m->workers = (struct mesh_thread **)
+      calloc (count, sizeof(*m->workers));
+  if (!m || !m->workers)
+    {
+      fprintf (stderr, "%s: out of memory\n", progname);
+      exit (1);
+    }
+
+  err = threadpool_create (&m->threads, &cls, dpy, count);
+  if (err)
+    {
+      m->threads.count = 0; /* See the note in thread_util.h. */
+      m->serial.m = m;
+      m->workers[0] = &m->serial;
+    }
+  return m;
+}
+
+
+void
+marching_mesh_free (marching_mesh *m)
+{
+  if (m->threads.count)
+    threadpool_destroy (&m->threads);
+  else
+    mesh_thread_destroy (&m->serial);
+  free (m->workers);
+  if (m->values)  free (m->values);
+  if (m->rows)    free (m->rows);
+  if (m->verts)   free (m->verts);
+  if (m->flat)    free (m->flat);
+  if (m->indices) free (m->indices);
+  free (m);
+}
+
+
+unsigned long
+marching_cubes_mesh (marching_mesh *m,
+                     int grid_size,
+                     double isolevel,
+                     int wireframe_p,
+                     int smooth_p,
+                     void (*row_fn) (int y, int z, int n, float *out,
+                                     void *closure),
+                     void *closure)
+{
+  unsigned i;
+
+  m->nverts = m->nindices = 0;
+  m->primitive = (wireframe_p ? GL_LINES : GL_TRIANGLES);
+  if (grid_size < 2)
+    return 0;
+
+  m->values = (float *)
+    mesh_grow (m->values, &m->values_size,
+               (long) grid_size * grid_size * grid_size, sizeof(*m->values));
+  m->rows = (unsigned char *)
+    mesh_grow (m->rows, &m->rows_size, (long) grid_size * grid_size,
+               sizeof(*m->rows));
+  for (i = 0; i < 12; i++)
+    m->edge_offset[i] = (3 * (cube_edges[i][0] + cube_edges[i][1] * grid_size)
+                         + cube_edges[i][3]);
+
+  m->grid_size   = grid_size;
+  m->isolevel    = isolevel;
+  m->wireframe_p = wireframe_p;
+  m->smooth_p    = smooth_p;
+  m->row_fn      = row_fn;
+  m->closure     = closure;
+
+  if (m->threads.count)
+    {
+      threadpool_run (&m->threads, mesh_field_run);
+      threadpool_wait (&m->threads);
+      threadpool_run (&m->threads, mesh_run);
+      threadpool_wait (&m->threads);
+    }
+  else
+    {
+      mesh_field_run (&m->serial);
+      mesh_run (&m->serial);
+    }
+
+  /* Stick the threads' pieces together. */
+  for (i = 0; i < MESH_WORKERS (m); i++)
+    {
+      m->nverts   += m->workers[i]->nverts;
+      m->nindices += m->workers[i]->nindices;
+    }
+  m->verts = (GLfloat *)
+    mesh_grow (m->verts, &m->verts_size, m->nverts * 6L, sizeof(*m->verts));
+  m->indices = (GLuint *)
+    mesh_grow (m->indices, &m->indices_size, m->nindices,
+               sizeof(*m->indices));
+
+  m->nverts = m->nindices = 0;
+  for (i = 0; i < MESH_WORKERS (m); i++)
+    {
+      const struct mesh_thread *t = m->workers[i];
+      GLuint *out = m->indices + m->nindices;
+      int j;
+      memcpy (m->verts + m->nverts * 6L, t->verts,
+              t->nverts * 6L * sizeof(*t->verts));
+      for (j = 0; j < t->nindices; j++)
+        out[j] = t->indices[j] + m->nverts;
+      m->nverts   += t->nverts;
+      m->nindices += t->nindices;
+    }
+
+  if (!smooth_p && !wireframe_p)
+    mesh_flatten (m);
+
+  return m->nindices / (wireframe_p ? 6 : 3);
+}
+
+
+void
+marching_mesh_draw (marching_mesh *m,
+                    GLuint vertex_buffer, GLuint index_buffer)
+{
+  const char *verts = (const char *) m->verts;
+  const GLuint *indices = m->indices;
+# ifdef USE_VBO
+  Bool bound_p = False;
+# endif
+
+  if (!m->nindices) return;
+
+# ifdef USE_VBO
+  if (vertex_buffer && index_buffer)
+    {
+      /* The mesh changes every frame, so let the driver orphan the old
+         storage rather than waiting for the GPU to finish with it. */
+      glBindBuffer (GL_ARRAY_BUFFER, vertex_buffer);
+      glBufferData (GL_ARRAY_BUFFER, m->nverts * 6L * sizeof(*m->verts),
+                    m->verts, GL_STREAM_DRAW);
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+      glBufferData (GL_ELEMENT_ARRAY_BUFFER,
+                    m->nindices * sizeof(*m->indices),
+                    m->indices, GL_STREAM_DRAW);
+      verts = 0;
+      indices = 0;
+      bound_p = True;
+    }
+# endif /* USE_VBO */
+
+  glFrontFace (GL_CCW);
+  glDisableClientState (GL_COLOR_ARRAY);
+  glDisableClientState (GL_TEXTURE_COORD_ARRAY);
+  glEnableClientState (GL_VERTEX_ARRAY);
+  glVertexPointer (3, GL_FLOAT, 6 * sizeof(GLfloat),
+                   verts + 3 * sizeof(GLfloat));
+  if (m->primitive == GL_LINES)
+    glDisableClientState (GL_NORMAL_ARRAY);
+  else
+    {
+      glEnableClientState (GL_NORMAL_ARRAY);
+      glNormalPointer (GL_FLOAT, 6 * sizeof(GLfloat), verts);
+    }
+
+  glDrawElements (m->primitive, m->nindices, GL_UNSIGNED_INT, indices);
+
+  glDisableClientState (GL_NORMAL_ARRAY);
+  glDisableClientState (GL_VERTEX_ARRAY);
+
+# ifdef USE_VBO
+  if (bound_p)
+    {
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+      glBindBuffer (GL_ARRAY_BUFFER, 0);
+    }
+# endif /* USE_VBO */
+}
@@ -45,4 +45,49 @@ marching_cubes (int grid_size,     /* density of the mesh */
 
                 unsigned long *polygon_count);
 
+
+/* The same thing, but faster, for fields that are rebuilt every frame.
+
+   Rather than one point at a time, row_fn fills in a whole row of the
+   field: out[x] is the value at (x, y, z) for x from 0 to n-1.  Rows are
+   computed on several threads at once, so row_fn must not write to
+   anything but out.
+
+   The result is kept in the marching_mesh as an indexed mesh in which
+   triangles share the vertexes on their common edges, and the vertex
+   normals come from the gradient of the field on the grid rather than
+   from calling the field function again.  Draw it with
+   marching_mesh_draw().
+
+   Returns the number of faces.
+*/
+typedef struct marching_mesh marching_mesh;
+
+extern marching_mesh *marching_mesh_new (Display *dpy);
+extern void marching_mesh_free (marching_mesh *);
+
+extern unsigned long
+marching_cubes_mesh (marching_mesh *,
+                     int grid_size,
+                     double isolevel,
+                     int wireframe_p,
+                     int smooth_p,
+                     void (*row_fn) (int y, int z, int n, float *out,
+                                     void *closure),
+                     void *closure);
+
+/* Draws the mesh, in grid coordinates, like marching_cubes() would have.
+   If vertex_buffer and index_buffer are non-zero, they are buffer objects
+   belonging to the caller, and the mesh is copied into them first;
+   otherwise it is drawn from client-side arrays.  Buffer objects are only
+   used where USE_VBO is defined.  Don't call this inside glNewList.
+ */
+#if defined(HAVE_GLSL) && !defined(HAVE_JWZGLES) && \
+    !defined(HAVE_COCOA) && !defined(HAVE_ANDROID)
+# define USE_VBO
+#endif
+
+extern void marching_mesh_draw (marching_mesh *,
+                                GLuint vertex_buffer, GLuint index_buffer);
+
 #endif /* __MARCHING_H__ */
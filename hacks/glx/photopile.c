@@ -25,6 +25,7 @@
                   "*grabDesktopImages:   False \n" \
                   "*chooseRandomImages:  True  \n" \
 		  "*suppressRotationAnimation: True\n" \
+		  THREAD_DEFAULTS_XLOCK
 
 # define release_photopile 0
 # define photopile_handle_event xlockmore_no_events
@@ -35,6 +36,7 @@
 #include <math.h>
 
 #include "xlockmore.h"
+#include "thread_util.h"
 #include "grab-ximage.h"
 #include "texfont.h"
 #include "dropshadow.h"
@@ -131,6 +133,7 @@ static XrmOptionDescRec opts[] = {
   {"-no-shadows",   ".shadows",       XrmoptionNoArg, "False" },
   {"-debug",        ".debug",         XrmoptionNoArg, "True"  },
   {"-font",         ".font",          XrmoptionSepArg, 0 },
+  THREAD_OPTIONS
 };
 
 static argtype vars[] = {
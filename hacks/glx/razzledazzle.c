@@ -34,11 +34,20 @@
 #undef RANDSIGN
 #define RANDSIGN() ((random() & 1) ? 1 : -1)
 
-extern const struct gllist
+/* A binary mesh container, see "ships_dxf" in Makefile.in. */
+extern const unsigned char ships[];
+extern const unsigned long ships_size;
+
+/* Loaded from ships on first use. */
+static const struct gllist
   *ships_ship1, *ships_ship2, *ships_ship3, *ships_ship4,
   *ships_ship5, *ships_ship6, *ships_ship7, *ships_ship8;
 
-static const struct gllist * const *all_ships[] = {
+static const char * const all_layers[] = {
+  "ship1", "ship2", "ship3", "ship4", "ship5", "ship6", "ship7", "ship8",
+};
+
+static const struct gllist **all_ships[] = {
   &ships_ship1, &ships_ship2, &ships_ship3, &ships_ship4,
   &ships_ship5, &ships_ship6, &ships_ship7, &ships_ship8,
 };
@@ -523,6 +532,19 @@ init_dazzle (ModeInfo *mi)
   if (bp->mode == SHIPS || bp->mode == RANDOM)
     {
       int i;
+      for (i = 0; i < countof(all_ships); i++)
+        if (! *all_ships[i])
+          {
+            *all_ships[i] = gllist_read_mesh (ships, ships_size,
+                                              all_layers[i]);
+            if (! *all_ships[i])
+              {
+                fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                         progname, all_layers[i]);
+                exit (1);
+              }
+          }
+
       bp->dlists = (GLuint *) calloc (countof(all_ships)+1, sizeof(GLuint));
       for (i = 0; i < countof(all_ships); i++)
         {
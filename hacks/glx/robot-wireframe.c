@@ -1,154 +1,50 @@
-/* Generated from "robot-wireframe.dxf" on Aug-22-2014.
+/* Generated from "robot-wireframe.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
    Wireframe.
  */
 
 #include "gllist.h"
 
-static const float robot_wireframe_data[] = {
-	729.885788,421.399756,2459.256694,
-	959.278463,553.839679,1921.436233,
-	729.885788,421.399756,2824.242214,
-	-0,842.799512,2824.242214,
-	-0,842.799512,2824.242214,
-	-0,842.799512,2459.256694,
-	-0,842.799512,2459.256694,
-	729.885788,421.399756,2459.256694,
-	0,0,3212.282649,
-	-0,842.799512,2824.242214,
-	665.532008,384.245084,587.016307,
-	-0,768.490168,587.016307,
-	750.739667,433.439749,887.912962,
-	0,866.879498,887.912962,
-	690.700937,398.776372,934.321154,
-	750.739667,433.439749,887.912962,
-	959.278463,-553.839679,1921.436233,
-	959.278463,553.839679,1921.436233,
-	959.278463,553.839679,1921.436233,
-	690.700937,398.776372,934.321154,
-	690.700937,-398.776372,934.321154,
-	690.700937,398.776372,934.321154,
-	665.532008,-384.245084,587.016307,
-	665.532008,384.245084,587.016307,
-	750.739667,-433.439749,887.912962,
-	750.739667,433.439749,887.912962,
-	750.739667,433.439749,887.912962,
-	665.532008,384.245084,587.016307,
-	-0,-797.552743,934.321154,
-	690.700937,-398.776372,934.321154,
-	-0,-1107.679357,1921.436233,
-	959.278463,-553.839679,1921.436233,
-	959.278463,-553.839679,1921.436233,
-	690.700937,-398.776372,934.321154,
-	0,-866.879498,887.912962,
-	-0,-797.552743,934.321154,
-	-0,-797.552743,934.321154,
-	-0,-1107.679357,1921.436233,
-	690.700937,-398.776372,934.321154,
-	750.739667,-433.439749,887.912962,
-	750.739667,-433.439749,887.912962,
-	665.532008,-384.245084,587.016307,
-	729.885788,421.399756,2824.242214,
-	729.885788,421.399756,2459.256694,
-	729.885788,421.399756,2459.256694,
-	729.885788,-421.399756,2459.256694,
-	729.885788,-421.399756,2824.242214,
-	729.885788,421.399756,2824.242214,
-	0,-866.879498,887.912962,
-	750.739667,-433.439749,887.912962,
-	0,-768.490168,587.016307,
-	0,-866.879498,887.912962,
-	0,-768.490168,587.016307,
-	665.532008,-384.245084,587.016307,
-	0,0,3212.282649,
-	729.885788,-421.399756,2824.242214,
-	-0,-1107.679357,1921.436233,
-	0,-842.799512,2459.256694,
-	729.885788,-421.399756,2459.256694,
-	959.278463,-553.839679,1921.436233,
-	0,-842.799512,2824.242214,
-	0,0,3212.282649,
-	0,0,3212.282649,
-	729.885788,421.399756,2824.242214,
-	0,866.879498,887.912962,
-	-0,768.490168,587.016307,
-	690.700937,398.776372,934.321154,
-	0,797.552743,934.321154,
-	0,797.552743,934.321154,
-	0,866.879498,887.912962,
-	959.278463,553.839679,1921.436233,
-	0,1107.679357,1921.436233,
-	0,1107.679357,1921.436233,
-	0,797.552743,934.321154,
-	-0,842.799512,2459.256694,
-	0,1107.679357,1921.436233,
-	-0,842.799512,2824.242214,
-	-729.885788,421.399756,2824.242214,
-	-729.885788,421.399756,2824.242214,
-	-729.885788,421.399756,2459.256694,
-	-729.885788,421.399756,2459.256694,
-	-0,842.799512,2459.256694,
-	0,0,3212.282649,
-	-729.885788,421.399756,2824.242214,
-	-0,768.490168,587.016307,
-	-665.532008,384.245084,587.016307,
-	0,866.879498,887.912962,
-	-750.739667,433.439749,887.912962,
-	-750.739667,433.439749,887.912962,
-	-665.532008,384.245084,587.016307,
-	0,797.552743,934.321154,
-	-690.700937,398.776372,934.321154,
-	-690.700937,398.776372,934.321154,
-	-750.739667,433.439749,887.912962,
-	0,1107.679357,1921.436233,
-	-959.278463,553.839679,1921.436233,
-	-959.278463,553.839679,1921.436233,
-	-690.700937,398.776372,934.321154,
-	-729.885788,421.399756,2459.256694,
-	-959.278463,553.839679,1921.436233,
-	-729.885788,421.399756,2824.242214,
-	-729.885788,-421.399756,2824.242214,
-	-729.885788,-421.399756,2824.242214,
-	-729.885788,-421.399756,2459.256694,
-	-729.885788,-421.399756,2459.256694,
-	-729.885788,421.399756,2459.256694,
-	0,0,3212.282649,
-	-729.885788,-421.399756,2824.242214,
-	-665.532008,384.245084,587.016307,
-	-665.532008,-384.245084,587.016307,
-	-750.739667,433.439749,887.912962,
-	-750.739667,-433.439749,887.912962,
-	-750.739667,-433.439749,887.912962,
-	-665.532008,-384.245084,587.016307,
-	-690.700937,398.776372,934.321154,
-	-690.700937,-398.776372,934.321154,
-	-690.700937,-398.776372,934.321154,
-	-750.739667,-433.439749,887.912962,
-	-959.278463,553.839679,1921.436233,
-	-959.278463,-553.839679,1921.436233,
-	-959.278463,-553.839679,1921.436233,
-	-690.700937,-398.776372,934.321154,
-	-729.885788,-421.399756,2459.256694,
-	-959.278463,-553.839679,1921.436233,
-	-729.885788,-421.399756,2824.242214,
-	0,-842.799512,2824.242214,
-	0,-842.799512,2459.256694,
-	-729.885788,-421.399756,2459.256694,
-	-665.532008,-384.245084,587.016307,
-	0,-768.490168,587.016307,
-	-750.739667,-433.439749,887.912962,
-	0,-866.879498,887.912962,
-	-690.700937,-398.776372,934.321154,
-	-0,-797.552743,934.321154,
-	-959.278463,-553.839679,1921.436233,
-	-0,-1107.679357,1921.436233,
-	0,-842.799512,2459.256694,
-	0,-842.799512,2824.242214,
-	0,-842.799512,2824.242214,
-	729.885788,-421.399756,2824.242214,
-	729.885788,-421.399756,2824.242214,
-	729.885788,-421.399756,2459.256694,
-	729.885788,-421.399756,2459.256694,
-	0,-842.799512,2459.256694
-};
-static const struct gllist robot_wireframe_frame = { GL_V3F, GL_LINES, 144, robot_wireframe_data, 0 };
-const struct gllist *robot_wireframe = &robot_wireframe_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char robot_wireframe[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\001\000\000\000%\000\000\000\220\000\000\000\000\000\000\000\000"
+ "\000\020\253\000\000\000\000\311t\355D\213\025$=,G\027)\2216\000\000\212"
+ "]\0016 \002\000\000,G\027)(Z\000\000\000\000/R(Z\000\000\000\000/R\2216\000"
+ "\000\000\000\000\000\377\177\000\000\346@x%\001\200\000\000\000\000\360J"
+ "\001\200\000\0005ID*X\235\000\000\000\000\210TX\235\000\000ZC\343&\337\241"
+ "\000\000\212]\377\311 \002\000\000ZC\035\331\337\241\000\000\346@\210\332"
+ "\001\200\000\0005I\274\325X\235\000\000\000\000;\262\337\241\000\000\000"
+ "\000\375\223 \002\000\000\000\000x\253X\235\000\000,G\351\326\2216\000\000"
+ ",G\351\326(Z\000\000\000\000\020\265\001\200\000\000\000\000\321\255\221"
+ "6\000\000\000\000\321\255(Z\000\000\000\000\305M\337\241\000\000\000\000"
+ "\003l \002\000\000\324\270\027)(Z\000\000\324\270\027)\2216\000\000\032\277"
+ "x%\001\200\000\000\313\266D*X\235\000\000\246\274\343&\337\241\000\000v\242"
+ "\0016 \002\000\000\324\270\351\326(Z\000\000\324\270\351\326\2216\000\000"
+ "\032\277\210\332\001\200\000\000\313\266\274\325X\235\000\000\246\274\035"
+ "\331\337\241\000\000v\242\377\311 \002\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\001"
+ "\000\002\000\003\000\003\000\004\000\004\000\000\000\005\000\003\000\006"
+ "\000\007\000\010\000\011\000\012\000\010\000\013\000\001\000\001\000\012"
+ "\000\014\000\012\000\015\000\006\000\016\000\010\000\010\000\006\000\017"
+ "\000\014\000\020\000\013\000\013\000\014\000\021\000\017\000\017\000\020"
+ "\000\014\000\016\000\016\000\015\000\002\000\000\000\000\000\022\000\023"
+ "\000\002\000\021\000\016\000\024\000\021\000\024\000\015\000\005\000\023"
+ "\000\020\000\025\000\022\000\013\000\026\000\005\000\005\000\002\000\011"
+ "\000\007\000\012\000\027\000\027\000\011\000\001\000\030\000\030\000\027"
+ "\000\004\000\030\000\003\000\031\000\031\000\032\000\032\000\004\000\005"
+ "\000\031\000\007\000\033\000\011\000\034\000\034\000\033\000\027\000\035"
+ "\000\035\000\034\000\030\000\036\000\036\000\035\000\032\000\036\000\031"
+ "\000\037\000\037\000 \000 \000\032\000\005\000\037\000\033\000!\000\034\000"
+ "\042\000\042\000!\000\035\000#\000#\000\042\000\036\000$\000$\000#\000 \000"
+ "$\000\037\000\026\000\025\000 \000!\000\024\000\042\000\021\000#\000\017"
+ "\000$\000\020\000\025\000\026\000\026\000\023\000\023\000\022\000\022\000"
+ "\025\000"
+;
+const unsigned long robot_wireframe_size = 740;
@@ -1,1733 +1,478 @@
+/* Generated from "s1_1.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.918718,-0.113815,-0.378157,0.721812,0.890313,-0.595062,
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.918718,-0.113815,-0.378157,0.721812,0.890313,-0.595062,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.918718,-0.113815,-0.378157,0.721812,0.890313,-0.595062,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.918718,-0.113815,-0.378157,0.721812,0.890313,-0.595062,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.66233,0.350197,-0.66233,0.674539,0.926104,-0.674539,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.918718,-0.113815,-0.378157,0.721812,0.890313,-0.595062,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.918719,-0.113815,0.378157,0.721812,0.890313,-0.404938,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.918719,-0.113815,0.378157,0.721812,0.890313,-0.404938,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.66233,0.350196,0.66233,0.674539,0.926104,-0.325461,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.918719,-0.113815,0.378157,0.721812,0.890313,-0.404938,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.918719,-0.113815,0.378157,0.721812,0.890313,-0.404938,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.918719,-0.113815,0.378157,0.721812,0.890313,-0.404938,
-	0.995164,-0.09823,0,0.737656,0.890313,-0.5,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.18835,0.976969,0.100277,0.664625,0.962948,-0.4175,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.592505,0.805566,0,0.7215,0.950535,-0.5,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.18835,0.976969,0.100277,0.664625,0.962948,-0.4175,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.592505,0.805566,0,0.7215,0.950535,-0.5,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.66233,0.350196,0.66233,0.674539,0.926104,-0.325461,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0.513442,0.838005,0.184732,0.706,0.949319,-0.4125,
-	0.891913,0.278471,0.356294,0.722453,0.926408,-0.404859,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.18835,0.976969,-0.100277,0.664625,0.962948,-0.5825,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0.66233,0.350197,-0.66233,0.674539,0.926104,-0.674539,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.592505,0.805566,0,0.7215,0.950535,-0.5,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.911846,0.410531,0,0.738539,0.926712,-0.5,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.891913,0.278471,-0.356294,0.722453,0.926408,-0.595141,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.18835,0.976969,-0.100277,0.664625,0.962948,-0.5825,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.513442,0.838005,-0.184732,0.706,0.949319,-0.5875,
-	0.592505,0.805566,0,0.7215,0.950535,-0.5,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0.378157,-0.113815,0.918718,0.595062,0.890313,-0.278187,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.378157,-0.113815,0.918718,0.595062,0.890313,-0.278187,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0.378157,-0.113815,0.918718,0.595062,0.890313,-0.278187,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0.378157,-0.113815,0.918718,0.595062,0.890313,-0.278187,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0.66233,0.350196,0.66233,0.674539,0.926104,-0.325461,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.705394,-0.069557,0.705394,0.674281,0.890313,-0.325719,
-	0.378157,-0.113815,0.918718,0.595062,0.890313,-0.278187,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.378157,-0.113815,0.918718,0.404938,0.890313,-0.278187,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.378157,-0.113815,0.918718,0.404938,0.890313,-0.278187,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.66233,0.350197,0.66233,0.325461,0.926104,-0.325461,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	-0.378157,-0.113815,0.918718,0.404938,0.890313,-0.278187,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	-0.378157,-0.113815,0.918718,0.404938,0.890313,-0.278187,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	-0.378157,-0.113815,0.918718,0.404938,0.890313,-0.278187,
-	0,-0.09823,0.995164,0.5,0.890313,-0.262344,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.100277,0.976969,0.18835,0.4175,0.962948,-0.335375,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	0,0.805567,0.592505,0.5,0.950535,-0.2785,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	-0.100277,0.976969,0.18835,0.4175,0.962948,-0.335375,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	0,0.805567,0.592505,0.5,0.950535,-0.2785,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	-0.66233,0.350197,0.66233,0.325461,0.926104,-0.325461,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	-0.184731,0.838005,0.513442,0.4125,0.949319,-0.294,
-	-0.356294,0.278471,0.891913,0.404859,0.926408,-0.277547,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0.100277,0.976969,0.18835,0.5825,0.962948,-0.335375,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0.66233,0.350196,0.66233,0.674539,0.926104,-0.325461,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0.448747,0.772821,0.448747,0.660875,0.948104,-0.339125,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	0,0.805567,0.592505,0.5,0.950535,-0.2785,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0,0.410531,0.911846,0.5,0.926712,-0.261461,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0.356294,0.278471,0.891913,0.595141,0.926408,-0.277547,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	0.100277,0.976969,0.18835,0.5825,0.962948,-0.335375,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	0.184731,0.838005,0.513442,0.5875,0.949319,-0.294,
-	0,0.805567,0.592505,0.5,0.950535,-0.2785,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.918718,-0.113815,0.378157,0.278187,0.890313,-0.404938,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.918718,-0.113815,0.378157,0.278187,0.890313,-0.404938,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.918718,-0.113815,0.378157,0.278187,0.890313,-0.404938,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.918718,-0.113815,0.378157,0.278187,0.890313,-0.404938,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.66233,0.350197,0.66233,0.325461,0.926104,-0.325461,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.705394,-0.069557,0.705394,0.325719,0.890313,-0.325719,
-	-0.918718,-0.113815,0.378157,0.278187,0.890313,-0.404938,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.918718,-0.113815,-0.378157,0.278187,0.890313,-0.595062,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.918718,-0.113815,-0.378157,0.278187,0.890313,-0.595062,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.66233,0.350196,-0.66233,0.325461,0.926104,-0.674539,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.918718,-0.113815,-0.378157,0.278187,0.890313,-0.595062,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.918718,-0.113815,-0.378157,0.278187,0.890313,-0.595062,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.918718,-0.113815,-0.378157,0.278187,0.890313,-0.595062,
-	-0.995164,-0.09823,0,0.262344,0.890313,-0.5,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.18835,0.976969,-0.100277,0.335375,0.962948,-0.5825,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.592505,0.805566,0,0.2785,0.950535,-0.5,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.18835,0.976969,-0.100277,0.335375,0.962948,-0.5825,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.592505,0.805566,0,0.2785,0.950535,-0.5,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.66233,0.350196,-0.66233,0.325461,0.926104,-0.674539,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	-0.513442,0.838005,-0.184731,0.294,0.949319,-0.5875,
-	-0.891913,0.278471,-0.356294,0.277547,0.926408,-0.595141,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.18835,0.976969,0.100277,0.335375,0.962948,-0.4175,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	-0.66233,0.350197,0.66233,0.325461,0.926104,-0.325461,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.448747,0.77282,0.448747,0.339125,0.948104,-0.339125,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.592505,0.805566,0,0.2785,0.950535,-0.5,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.911846,0.410531,0,0.261461,0.926712,-0.5,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.891913,0.278471,0.356294,0.277547,0.926408,-0.404859,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.18835,0.976969,0.100277,0.335375,0.962948,-0.4175,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.513442,0.838005,0.184731,0.294,0.949319,-0.4125,
-	-0.592505,0.805566,0,0.2785,0.950535,-0.5,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	-0.378157,-0.113815,-0.918719,0.404938,0.890313,-0.721812,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.378157,-0.113815,-0.918719,0.404938,0.890313,-0.721812,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	-0.378157,-0.113815,-0.918719,0.404938,0.890313,-0.721812,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	-0.378157,-0.113815,-0.918719,0.404938,0.890313,-0.721812,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	-0.66233,0.350196,-0.66233,0.325461,0.926104,-0.674539,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.705394,-0.069557,-0.705394,0.325719,0.890313,-0.674281,
-	-0.378157,-0.113815,-0.918719,0.404938,0.890313,-0.721812,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.378157,-0.113815,-0.918718,0.595062,0.890313,-0.721812,
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.378157,-0.113815,-0.918718,0.595062,0.890313,-0.721812,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.66233,0.350197,-0.66233,0.674539,0.926104,-0.674539,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0.378157,-0.113815,-0.918718,0.595062,0.890313,-0.721812,
-	0.705394,-0.069557,-0.705394,0.674281,0.890313,-0.674281,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0.378157,-0.113815,-0.918718,0.595062,0.890313,-0.721812,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0.378157,-0.113815,-0.918718,0.595062,0.890313,-0.721812,
-	0,-0.09823,-0.995164,0.5,0.890313,-0.737656,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.100277,0.976969,-0.18835,0.5825,0.962948,-0.664625,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	0,0.805567,-0.592505,0.5,0.950535,-0.7215,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0.100277,0.976969,-0.18835,0.5825,0.962948,-0.664625,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0,0.805567,-0.592505,0.5,0.950535,-0.7215,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	0.66233,0.350197,-0.66233,0.674539,0.926104,-0.674539,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0.448747,0.772821,-0.448747,0.660875,0.948104,-0.660875,
-	0.184732,0.838005,-0.513442,0.5875,0.949319,-0.706,
-	0.356294,0.278471,-0.891913,0.595141,0.926408,-0.722453,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	-0.100277,0.976969,-0.18835,0.4175,0.962948,-0.664625,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	-0.66233,0.350196,-0.66233,0.325461,0.926104,-0.674539,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	-0.448747,0.772821,-0.448747,0.339125,0.948104,-0.660875,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	0,0.805567,-0.592505,0.5,0.950535,-0.7215,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	0,0.410531,-0.911846,0.5,0.926712,-0.738539,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	-0.356294,0.278471,-0.891913,0.404859,0.926408,-0.722453,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	-0.100277,0.976969,-0.18835,0.4175,0.962948,-0.664625,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	-0.184732,0.838005,-0.513442,0.4125,0.949319,-0.706,
-	0,0.805567,-0.592505,0.5,0.950535,-0.7215,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.100277,0.976969,0.18835,0.5825,0.962948,-0.335375,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0.199329,0.959446,0.199329,0.638667,0.958463,-0.361333,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0.18835,0.976969,0.100277,0.664625,0.962948,-0.4175,
-	0.100277,0.976969,0.18835,0.5825,0.962948,-0.335375,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0.100277,0.976969,0.18835,0.5825,0.962948,-0.335375,
-	0,1,0,0.5,0.976924,-0.5,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0,1,0,0.5,0.976924,-0.5,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.18835,0.976969,0.100277,0.664625,0.962948,-0.4175,
-	0.18835,0.976969,0.100277,0.664625,0.962948,-0.4175,
-	0.079739,0.993621,0.079739,0.5905,0.971195,-0.4095,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.18835,0.976969,0.100277,0.335375,0.962948,-0.4175,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	-0.199329,0.959446,0.199329,0.361333,0.958463,-0.361333,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	-0.100277,0.976969,0.18835,0.4175,0.962948,-0.335375,
-	-0.18835,0.976969,0.100277,0.335375,0.962948,-0.4175,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	-0.18835,0.976969,0.100277,0.335375,0.962948,-0.4175,
-	0,1,0,0.5,0.976924,-0.5,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	0,1,0,0.5,0.976924,-0.5,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	0,0.969635,0.244558,0.5,0.965162,-0.322437,
-	-0.100277,0.976969,0.18835,0.4175,0.962948,-0.335375,
-	-0.100277,0.976969,0.18835,0.4175,0.962948,-0.335375,
-	-0.079739,0.993621,0.079739,0.4095,0.971195,-0.4095,
-	0,0.996384,0.08496,0.5,0.973972,-0.40225,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.100277,0.976969,-0.18835,0.4175,0.962948,-0.664625,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	-0.199329,0.959446,-0.199329,0.361333,0.958463,-0.638667,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	-0.18835,0.976969,-0.100277,0.335375,0.962948,-0.5825,
-	-0.100277,0.976969,-0.18835,0.4175,0.962948,-0.664625,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	-0.100277,0.976969,-0.18835,0.4175,0.962948,-0.664625,
-	0,1,0,0.5,0.976924,-0.5,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	0,1,0,0.5,0.976924,-0.5,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	-0.244558,0.969635,0,0.322437,0.965162,-0.5,
-	-0.18835,0.976969,-0.100277,0.335375,0.962948,-0.5825,
-	-0.18835,0.976969,-0.100277,0.335375,0.962948,-0.5825,
-	-0.079739,0.993621,-0.079739,0.4095,0.971195,-0.5905,
-	-0.08496,0.996384,0,0.40225,0.973972,-0.5,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.18835,0.976969,-0.100277,0.664625,0.962948,-0.5825,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0.199329,0.959446,-0.199329,0.638667,0.958463,-0.638667,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0.100277,0.976969,-0.18835,0.5825,0.962948,-0.664625,
-	0.18835,0.976969,-0.100277,0.664625,0.962948,-0.5825,
-	0.244558,0.969635,0,0.677562,0.965162,-0.5,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0.18835,0.976969,-0.100277,0.664625,0.962948,-0.5825,
-	0,1,0,0.5,0.976924,-0.5,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0,1,0,0.5,0.976924,-0.5,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0.08496,0.996384,0,0.59775,0.973972,-0.5,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	0,0.969635,-0.244558,0.5,0.965162,-0.677562,
-	0.100277,0.976969,-0.18835,0.5825,0.962948,-0.664625,
-	0.100277,0.976969,-0.18835,0.5825,0.962948,-0.664625,
-	0.079739,0.993621,-0.079739,0.5905,0.971195,-0.5905,
-	0,0.996384,-0.08496,0.5,0.973972,-0.59775,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.92844,-0.14479,-0.342105,0.713281,0.838781,-0.591406,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.934344,-0.092655,-0.344117,0.706063,0.769563,-0.588313,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	1,-0.00015,0,0.709531,0.494688,-0.5,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0.938032,-0.028246,-0.345395,0.696875,0.593625,-0.584375,
-	0.936848,-0.057446,-0.344986,0.700484,0.686547,-0.585922,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	1,-0.00015,0,0.709531,0.494688,-0.5,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	0.938032,-0.028246,0.345395,0.696875,0.593625,-0.415625,
-	0.999728,-0.023338,0,0.710938,0.593625,-0.5,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.991208,-0.132313,0,0.728516,0.838781,-0.5,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.92844,-0.14479,0.342105,0.713281,0.838781,-0.408594,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.998665,-0.051663,0,0.714805,0.686547,-0.5,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.996389,-0.084903,0,0.720781,0.769563,-0.5,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.934344,-0.092655,0.344117,0.706063,0.769563,-0.411687,
-	0.936848,-0.057446,0.344986,0.700484,0.686547,-0.414078,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	-0.342105,-0.14479,-0.92844,0.408594,0.838781,-0.713281,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	-0.344117,-0.092655,-0.934344,0.411687,0.769563,-0.706063,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	0,-0.00015,-1,0.5,0.494688,-0.709531,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.345395,-0.028246,-0.938032,0.415625,0.593625,-0.696875,
-	-0.344986,-0.057446,-0.936848,0.414078,0.686547,-0.700484,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0.706706,-0.033664,-0.706706,0.654688,0.593625,-0.654688,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	0,-0.00015,-1,0.5,0.494688,-0.709531,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0.345395,-0.028246,-0.938032,0.584375,0.593625,-0.696875,
-	0,-0.023338,-0.999728,0.5,0.593625,-0.710938,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0.698103,-0.159073,-0.698103,0.667578,0.838781,-0.667578,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0,-0.132313,-0.991208,0.5,0.838781,-0.728516,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0.342105,-0.14479,-0.92844,0.591406,0.838781,-0.713281,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	0,-0.051663,-0.998665,0.5,0.686547,-0.714805,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0,-0.084903,-0.996389,0.5,0.769563,-0.720781,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.703449,-0.101581,-0.703449,0.661906,0.769563,-0.661906,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0.705656,-0.064019,-0.705656,0.657523,0.686547,-0.657523,
-	0.344117,-0.092655,-0.934344,0.588313,0.769563,-0.706063,
-	0.344986,-0.057446,-0.936848,0.585922,0.686547,-0.700484,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	-0.342105,-0.144791,0.92844,0.408594,0.838781,-0.286719,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.344116,-0.092655,0.934344,0.411687,0.769563,-0.293938,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0.698103,-0.159073,0.698103,0.667578,0.838781,-0.332422,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0.703449,-0.101581,0.703449,0.661906,0.769563,-0.338094,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	0.342105,-0.144791,0.92844,0.591406,0.838781,-0.286719,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0,-0.132314,0.991208,0.5,0.838781,-0.271484,
-	0.344116,-0.092655,0.934344,0.588313,0.769563,-0.293938,
-	0,-0.084902,0.996389,0.5,0.769563,-0.279219,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0,-0.00015,1,0.5,0.494688,-0.290469,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	0.705656,-0.064019,0.705656,0.657523,0.686547,-0.342477,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.706706,-0.033664,0.706706,0.654688,0.593625,-0.345313,
-	0.345395,-0.028246,0.938032,0.584375,0.593625,-0.303125,
-	0.344986,-0.057445,0.936848,0.585922,0.686547,-0.299516,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	0,-0.051662,0.998665,0.5,0.686547,-0.285195,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	-0.344986,-0.057445,0.936848,0.414078,0.686547,-0.299516,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	0,-0.00015,1,0.5,0.494688,-0.290469,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	-0.345395,-0.028246,0.938032,0.415625,0.593625,-0.303125,
-	0,-0.023338,0.999728,0.5,0.593625,-0.289063,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.698103,-0.159073,-0.698103,0.332422,0.838781,-0.667578,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.92844,-0.144791,-0.342105,0.286719,0.838781,-0.591406,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.703449,-0.101581,-0.703449,0.338094,0.769563,-0.661906,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.934344,-0.092655,-0.344116,0.293938,0.769563,-0.588313,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.698103,-0.159073,0.698103,0.332422,0.838781,-0.332422,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.703449,-0.101581,0.703449,0.338094,0.769563,-0.338094,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.92844,-0.144791,0.342105,0.286719,0.838781,-0.408594,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.991208,-0.132314,0,0.271484,0.838781,-0.5,
-	-0.934344,-0.092655,0.344116,0.293938,0.769563,-0.411687,
-	-0.996389,-0.084902,0,0.279219,0.769563,-0.5,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-1,-0.00015,0,0.290469,0.494688,-0.5,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.705656,-0.064019,0.705656,0.342477,0.686547,-0.342477,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	-0.706706,-0.033664,0.706706,0.345313,0.593625,-0.345313,
-	-0.938032,-0.028246,0.345395,0.303125,0.593625,-0.415625,
-	-0.936848,-0.057445,0.344986,0.299516,0.686547,-0.414078,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.705656,-0.064019,-0.705656,0.342477,0.686547,-0.657523,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.706706,-0.033664,-0.706706,0.345313,0.593625,-0.654688,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.998665,-0.051662,0,0.285195,0.686547,-0.5,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.936848,-0.057445,-0.344986,0.299516,0.686547,-0.585922,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-1,-0.00015,0,0.290469,0.494688,-0.5,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-0.938032,-0.028246,-0.345395,0.303125,0.593625,-0.584375,
-	-0.999728,-0.023338,0,0.289063,0.593625,-0.5,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.344301,0.086306,-0.934884,0.411687,0.207062,-0.706063,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	0.344301,0.086306,-0.934884,0.588313,0.207062,-0.706063,
-	0,0.079157,-0.996862,0.5,0.207062,-0.720781,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0,-0.00015,-1,0.5,0.494688,-0.709531,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0.285548,-0.000151,-0.958364,0.583813,0.494688,-0.695563,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.345404,0.027067,-0.938064,0.584375,0.393625,-0.696875,
-	0.345045,0.054036,-0.937029,0.585922,0.295922,-0.700484,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	0,0.048741,-0.998811,0.5,0.295922,-0.714805,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	-0.345045,0.054036,-0.937029,0.414078,0.295922,-0.700484,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	0,-0.00015,-1,0.5,0.494688,-0.709531,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	-0.285548,-0.000151,-0.958364,0.416187,0.494688,-0.695563,
-	-0.345404,0.027067,-0.938064,0.415625,0.393625,-0.696875,
-	0,0.022461,-0.999748,0.5,0.393625,-0.710938,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.703939,0.094548,-0.703939,0.338094,0.207062,-0.661906,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.934884,0.086306,-0.344301,0.293938,0.207062,-0.588313,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.707107,-0.000155,-0.707107,0.346344,0.494688,-0.653656,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-1,-0.00015,0,0.290469,0.494688,-0.5,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.958364,-0.000151,-0.285548,0.304437,0.494688,-0.583813,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.70583,0.060067,-0.70583,0.342477,0.295922,-0.657523,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	-0.706741,0.032156,-0.706741,0.345313,0.393625,-0.654688,
-	-0.938064,0.027067,-0.345404,0.303125,0.393625,-0.584375,
-	-0.937029,0.054035,-0.345045,0.299516,0.295922,-0.585922,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-1,-0.00015,0,0.290469,0.494688,-0.5,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-0.958364,-0.000151,0.285548,0.304437,0.494688,-0.416187,
-	-0.938064,0.027067,0.345404,0.303125,0.393625,-0.415625,
-	-0.999748,0.022461,0,0.289063,0.393625,-0.5,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.998811,0.04874,0,0.285195,0.295922,-0.5,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.996862,0.079157,0,0.279219,0.207062,-0.5,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.934884,0.086306,0.344301,0.293938,0.207062,-0.411687,
-	-0.937029,0.054035,0.345045,0.299516,0.295922,-0.414078,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	-0.703939,0.094548,0.703939,0.338094,0.207062,-0.338094,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	-0.344301,0.086306,0.934884,0.411687,0.207062,-0.293938,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	-0.707107,-0.000155,0.707107,0.346344,0.494688,-0.346344,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	0,-0.00015,1,0.5,0.494688,-0.290469,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	-0.285548,-0.000151,0.958364,0.416187,0.494688,-0.304437,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	-0.70583,0.060067,0.70583,0.342477,0.295922,-0.342477,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.706741,0.032156,0.706741,0.345313,0.393625,-0.345313,
-	-0.345404,0.027067,0.938064,0.415625,0.393625,-0.303125,
-	-0.345045,0.054035,0.937029,0.414078,0.295922,-0.299516,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	0,-0.00015,1,0.5,0.494688,-0.290469,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0.285548,-0.000151,0.958364,0.583813,0.494688,-0.304437,
-	0.345404,0.027067,0.938064,0.584375,0.393625,-0.303125,
-	0,0.022461,0.999748,0.5,0.393625,-0.289063,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	0,0.04874,0.998811,0.5,0.295922,-0.285195,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0,0.079157,0.996862,0.5,0.207062,-0.279219,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.344301,0.086306,0.934884,0.588313,0.207062,-0.293938,
-	0.345045,0.054035,0.937029,0.585922,0.295922,-0.299516,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.703939,0.094548,0.703939,0.661906,0.207062,-0.338094,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.934884,0.086306,0.344301,0.706063,0.207062,-0.411687,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.707107,-0.000155,0.707107,0.653656,0.494688,-0.346344,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	1,-0.00015,0,0.709531,0.494688,-0.5,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.958364,-0.000151,0.285548,0.695563,0.494688,-0.416187,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.70583,0.060067,0.70583,0.657523,0.295922,-0.342477,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0.706741,0.032156,0.706741,0.654688,0.393625,-0.345313,
-	0.938064,0.027067,0.345404,0.696875,0.393625,-0.415625,
-	0.937029,0.054036,0.345045,0.700484,0.295922,-0.414078,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.707107,-0.000155,-0.707107,0.653656,0.494688,-0.653656,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.706741,0.032156,-0.706741,0.654688,0.393625,-0.654688,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	1,-0.00015,0,0.709531,0.494688,-0.5,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	0.958364,-0.000151,-0.285548,0.695563,0.494688,-0.583813,
-	0.938064,0.027067,-0.345404,0.696875,0.393625,-0.584375,
-	0.999748,0.022461,0,0.710938,0.393625,-0.5,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.998811,0.048741,0,0.714805,0.295922,-0.5,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.996862,0.079157,0,0.720781,0.207062,-0.5,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.703939,0.094547,-0.703939,0.661906,0.207062,-0.661906,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.70583,0.060067,-0.70583,0.657523,0.295922,-0.657523,
-	0.934884,0.086306,-0.344301,0.706063,0.207062,-0.588313,
-	0.937029,0.054036,-0.345045,0.700484,0.295922,-0.585922,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.919364,0.107435,0.378454,0.721812,0.077813,-0.404938,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.919364,0.107435,0.378454,0.721812,0.077813,-0.404938,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.919364,0.107435,0.378454,0.721812,0.077813,-0.404938,
-	0.929642,0.135808,0.342523,0.713281,0.132531,-0.408594,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.919364,0.107435,0.378454,0.721812,0.077813,-0.404938,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.663755,-0.344758,0.663755,0.674539,0.040427,-0.325461,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.919364,0.107435,0.378454,0.721812,0.077813,-0.404938,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.919364,0.107435,-0.378454,0.721812,0.077813,-0.595062,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.919364,0.107435,-0.378454,0.721812,0.077813,-0.595062,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.663755,-0.344758,-0.663755,0.674539,0.040427,-0.674539,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.919364,0.107435,-0.378454,0.721812,0.077813,-0.595062,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.919364,0.107435,-0.378454,0.721812,0.077813,-0.595062,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.992308,0.12379,0,0.728516,0.132531,-0.5,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.929642,0.135808,-0.342523,0.713281,0.132531,-0.591406,
-	0.919364,0.107435,-0.378454,0.721812,0.077813,-0.595062,
-	0.995686,0.092789,0,0.737656,0.077813,-0.5,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.596646,-0.802505,0,0.7215,0.015465,-0.5,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.596646,-0.802505,0,0.7215,0.015465,-0.5,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.663755,-0.344758,-0.663755,0.674539,0.040427,-0.674539,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0.517064,-0.835523,-0.185868,0.706,0.016681,-0.5875,
-	0.892994,-0.274252,-0.356859,0.722453,0.040123,-0.595141,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0.663755,-0.344758,0.663755,0.674539,0.040427,-0.325461,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.596646,-0.802505,0,0.7215,0.015465,-0.5,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.914719,-0.404091,0,0.738539,0.039819,-0.5,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.892993,-0.274252,0.35686,0.722453,0.040123,-0.404859,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.517064,-0.835523,0.185868,0.706,0.016681,-0.4125,
-	0.596646,-0.802505,0,0.7215,0.015465,-0.5,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0.378454,0.107435,-0.919364,0.595062,0.077813,-0.721812,
-	0.699155,0.149544,-0.699155,0.667578,0.132531,-0.667578,
-	0.378454,0.107435,-0.919364,0.595062,0.077813,-0.721812,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0.378454,0.107435,-0.919364,0.595062,0.077813,-0.721812,
-	0.342523,0.135808,-0.929642,0.591406,0.132531,-0.713281,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0.378454,0.107435,-0.919364,0.595062,0.077813,-0.721812,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0.663755,-0.344758,-0.663755,0.674539,0.040427,-0.674539,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.705578,0.065727,-0.705578,0.674281,0.077813,-0.674281,
-	0.378454,0.107435,-0.919364,0.595062,0.077813,-0.721812,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.378454,0.107435,-0.919364,0.404938,0.077813,-0.721812,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.378454,0.107435,-0.919364,0.404938,0.077813,-0.721812,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.663755,-0.344758,-0.663755,0.325461,0.040427,-0.674539,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	-0.378454,0.107435,-0.919364,0.404938,0.077813,-0.721812,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	-0.378454,0.107435,-0.919364,0.404938,0.077813,-0.721812,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	0,0.12379,-0.992308,0.5,0.132531,-0.728516,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	-0.342523,0.135808,-0.929642,0.408594,0.132531,-0.713281,
-	-0.378454,0.107435,-0.919364,0.404938,0.077813,-0.721812,
-	0,0.092789,-0.995686,0.5,0.077813,-0.737656,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0,-0.802505,-0.596646,0.5,0.015465,-0.7215,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	0,-0.802505,-0.596646,0.5,0.015465,-0.7215,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	-0.663755,-0.344758,-0.663755,0.325461,0.040427,-0.674539,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	-0.185868,-0.835523,-0.517064,0.4125,0.016681,-0.706,
-	-0.35686,-0.274252,-0.892993,0.404859,0.040123,-0.722453,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0.663755,-0.344758,-0.663755,0.674539,0.040427,-0.674539,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0.452944,-0.767908,-0.452945,0.660875,0.017896,-0.660875,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	0,-0.802505,-0.596646,0.5,0.015465,-0.7215,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0,-0.404091,-0.914719,0.5,0.039819,-0.738539,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0.356859,-0.274252,-0.892994,0.595141,0.040123,-0.722453,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0.185868,-0.835523,-0.517064,0.5875,0.016681,-0.706,
-	0,-0.802505,-0.596646,0.5,0.015465,-0.7215,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.919364,0.107436,-0.378454,0.278187,0.077813,-0.595062,
-	-0.699155,0.149544,-0.699156,0.332422,0.132531,-0.667578,
-	-0.919364,0.107436,-0.378454,0.278187,0.077813,-0.595062,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.919364,0.107436,-0.378454,0.278187,0.077813,-0.595062,
-	-0.929642,0.135808,-0.342523,0.286719,0.132531,-0.591406,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.919364,0.107436,-0.378454,0.278187,0.077813,-0.595062,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.663755,-0.344758,-0.663755,0.325461,0.040427,-0.674539,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.705578,0.065727,-0.705578,0.325719,0.077813,-0.674281,
-	-0.919364,0.107436,-0.378454,0.278187,0.077813,-0.595062,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.919364,0.107436,0.378454,0.278187,0.077813,-0.404938,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.919364,0.107436,0.378454,0.278187,0.077813,-0.404938,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.663755,-0.344758,0.663755,0.325461,0.040427,-0.325461,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.919364,0.107436,0.378454,0.278187,0.077813,-0.404938,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.919364,0.107436,0.378454,0.278187,0.077813,-0.404938,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.992308,0.12379,0,0.271484,0.132531,-0.5,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.929642,0.135808,0.342523,0.286719,0.132531,-0.408594,
-	-0.919364,0.107436,0.378454,0.278187,0.077813,-0.404938,
-	-0.995686,0.092789,0,0.262344,0.077813,-0.5,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.596646,-0.802505,0,0.2785,0.015465,-0.5,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.596646,-0.802505,0,0.2785,0.015465,-0.5,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.663755,-0.344758,0.663755,0.325461,0.040427,-0.325461,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	-0.517064,-0.835523,0.185867,0.294,0.016681,-0.4125,
-	-0.892993,-0.274251,0.35686,0.277547,0.040123,-0.404859,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	-0.663755,-0.344758,-0.663755,0.325461,0.040427,-0.674539,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.452945,-0.767908,-0.452945,0.339125,0.017896,-0.660875,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.596646,-0.802505,0,0.2785,0.015465,-0.5,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.914719,-0.404091,0,0.261461,0.039819,-0.5,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.892993,-0.274251,-0.35686,0.277547,0.040123,-0.595141,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.517064,-0.835523,-0.185868,0.294,0.016681,-0.5875,
-	-0.596646,-0.802505,0,0.2785,0.015465,-0.5,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	-0.378454,0.107436,0.919364,0.404938,0.077813,-0.278187,
-	-0.699155,0.149545,0.699155,0.332422,0.132531,-0.332422,
-	-0.378454,0.107436,0.919364,0.404938,0.077813,-0.278187,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	-0.378454,0.107436,0.919364,0.404938,0.077813,-0.278187,
-	-0.342523,0.135808,0.929642,0.408594,0.132531,-0.286719,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	-0.378454,0.107436,0.919364,0.404938,0.077813,-0.278187,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	-0.663755,-0.344758,0.663755,0.325461,0.040427,-0.325461,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.705578,0.065726,0.705578,0.325719,0.077813,-0.325719,
-	-0.378454,0.107436,0.919364,0.404938,0.077813,-0.278187,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.378454,0.107436,0.919364,0.595062,0.077813,-0.278187,
-	0.699156,0.149544,0.699155,0.667578,0.132531,-0.332422,
-	0.378454,0.107436,0.919364,0.595062,0.077813,-0.278187,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.663755,-0.344758,0.663755,0.674539,0.040427,-0.325461,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0.378454,0.107436,0.919364,0.595062,0.077813,-0.278187,
-	0.705578,0.065727,0.705578,0.674281,0.077813,-0.325719,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0.378454,0.107436,0.919364,0.595062,0.077813,-0.278187,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0,0.12379,0.992308,0.5,0.132531,-0.271484,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0.342523,0.135808,0.929642,0.591406,0.132531,-0.286719,
-	0.378454,0.107436,0.919364,0.595062,0.077813,-0.278187,
-	0,0.092789,0.995686,0.5,0.077813,-0.262344,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0,-0.802505,0.596646,0.5,0.015465,-0.2785,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0,-0.802505,0.596646,0.5,0.015465,-0.2785,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	0.663755,-0.344758,0.663755,0.674539,0.040427,-0.325461,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0.452945,-0.767908,0.452945,0.660875,0.017896,-0.339125,
-	0.185868,-0.835523,0.517064,0.5875,0.016681,-0.294,
-	0.35686,-0.274251,0.892993,0.595141,0.040123,-0.277547,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	-0.663755,-0.344758,0.663755,0.325461,0.040427,-0.325461,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	-0.452945,-0.767908,0.452945,0.339125,0.017896,-0.339125,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	0,-0.802505,0.596646,0.5,0.015465,-0.2785,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	0,-0.404091,0.914719,0.5,0.039819,-0.261461,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	-0.35686,-0.274251,0.892993,0.404859,0.040123,-0.277547,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	-0.185867,-0.835523,0.517064,0.4125,0.016681,-0.294,
-	0,-0.802505,0.596646,0.5,0.015465,-0.2785,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_1=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_1[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000\000"
+ "\000\000\077\307K\367>\000\000\000\277\225\345|7m+3\134\223\324\000\000E"
+ "73\134P\350\000\000{9\215i^\347\000\000*-\215i\326\322\000\0008;3\134\000"
+ "\000\000\000\226=\215i\000\000\000\000\321=\374r\000\000\000\000\2469\350"
+ "rX\347\000\000;-\324r\305\322\000\000m+3\134m+\000\000*-\215i*-\000\000{"
+ "9\215i\242\030\000\000E73\134\260\027\000\000;-\324r;-\000\000\2469\350r"
+ "\250\030\000\000\357#6{\357#\000\000\251*`|a\025\000\000b5\330x\255\026\000"
+ "\000\260)\207x\260)\000\000\003.\363|\000\000\000\000f9(y\000\000\000\000"
+ "\357#6{\021\334\000\000\260)\207xP\326\000\000b5\330xS\351\000\000\251*`"
+ "|\237\352\000\000\260\0273\134E7\000\000\242\030\215i{9\000\000\000\0003"
+ "\1348;\000\000\000\000\215i\226=\000\000\000\000\374r\321=\000\000\250\030"
+ "\350r\2469\000\000\223\3243\134m+\000\000\326\322\215i*-\000\000^\347\215"
+ "i{9\000\000P\3503\134E7\000\000\305\322\324r;-\000\000X\347\350r\2469\000"
+ "\000\021\3346{\357#\000\000\237\352`|\251*\000\000S\351\330xb5\000\000P\326"
+ "\207x\260)\000\000\000\000\363|\004.\000\000\000\000(yf9\000\000\255\026"
+ "\330xb5\000\000a\025`|\251*\000\000\273\3103\134\260\027\000\000\205\306"
+ "\215i\242\030\000\000\310\3043\134\000\000\000\000j\302\215i\000\000\000"
+ "\000/\302\374r\000\000\000\000Z\306\350r\250\030\000\000\223\3243\134\223"
+ "\324\000\000\326\322\215i\326\322\000\000\205\306\215i^\347\000\000\273\310"
+ "3\134P\350\000\000\305\322\324r\305\322\000\000Z\306\350rX\347\000\000\021"
+ "\3346{\021\334\000\000W\325`|\237\352\000\000\236\312\330xS\351\000\000P"
+ "\326\207xP\326\000\000\374\321\363|\000\000\000\000\232\306(y\000\000\000"
+ "\000\236\312\330x\255\026\000\000W\325`|a\025\000\000P\3503\134\273\310\000"
+ "\000^\347\215i\205\306\000\000\000\0003\134\310\304\000\000\000\000\215i"
+ "j\302\000\000\000\000\374r/\302\000\000X\347\350rZ\306\000\000\242\030\215"
+ "i\205\306\000\000\260\0273\134\273\310\000\000\250\030\350rZ\306\000\000"
+ "a\025`|W\325\000\000\255\026\330x\236\312\000\000\000\000\363|\375\321\000"
+ "\000\000\000(y\232\306\000\000S\351\330x\236\312\000\000\237\352`|W\325\000"
+ "\000t\027\203~t\027\000\000\000\000;\177U\031\000\000\000\000\377\177\000"
+ "\000\000\000U\031;\177\000\000\000\000\214\350\203~t\027\000\000\253\346"
+ ";\177\000\000\000\000\214\350\203~\214\350\000\000\000\000;\177\253\346\000"
+ "\000t\027\203~\214\350\000\000\365)CJ\013\326\000\000f5CJ\035\351\000\000"
+ "\322(\2774.\327\000\000\3643\2774\274\351\000\000\2527\2774\000\000\000\000"
+ "79CJ\000\000\000\000\322'\007\003.\330\000\000\2562\007\003H\352\000\000"
+ "\0053\253\034#\352\000\000\026(\253\034\352\327\000\000L6\007\003\000\000"
+ "\000\000\2526\253\034\000\000\000\000\322'\007\003\322'\000\000\026(\253"
+ "\034\026(\000\000\0053\253\034\335\025\000\000\2562\007\003\270\025\000\000"
+ "\322(\2774\322(\000\000\3643\2774D\026\000\000\365)CJ\365)\000\000f5CJ\343"
+ "\026\000\000\013\326CJ\013\326\000\000\035\351CJ\232\312\000\000.\327\277"
+ "4.\327\000\000\274\351\2774\014\314\000\000\000\000\2774V\310\000\000\000"
+ "\000CJ\311\306\000\000.\330\007\003.\330\000\000H\352\007\003R\315\000\000"
+ "#\352\253\034\373\314\000\000\352\327\253\034\352\327\000\000\000\000\007"
+ "\003\264\311\000\000\000\000\253\034V\311\000\000\335\025\253\034\373\314"
+ "\000\000\270\025\007\003R\315\000\000D\026\2774\014\314\000\000\343\026C"
+ "J\232\312\000\000\013\326CJ\365)\000\000\035\351CJf5\000\000\000\000CJ79"
+ "\000\000\000\000\2774\2527\000\000\274\351\2774\3643\000\000.\327\2774\322"
+ "(\000\000\343\026CJf5\000\000D\026\2774\3643\000\000\270\025\007\003\256"
+ "2\000\000\335\025\253\034\0053\000\000\000\000\007\003L6\000\000\000\000"
+ "\253\034\2526\000\000.\330\007\003\322'\000\000\352\327\253\034\026(\000"
+ "\000#\352\253\034\0053\000\000H\352\007\003\2562\000\000\232\312CJ\035\351"
+ "\000\000\311\306CJ\000\000\000\000V\310\2774\000\000\000\000\014\314\277"
+ "4\274\351\000\000\232\312CJ\343\026\000\000\014\314\2774D\026\000\000R\315"
+ "\007\003\270\025\000\000\373\314\253\034\335\025\000\000\264\311\007\003"
+ "\000\000\000\000V\311\253\034\000\000\000\000\373\314\253\034#\352\000\000"
+ "R\315\007\003H\352\000\000\013\326~\270\013\326\000\000\223\324.\245\223"
+ "\324\000\000P\350.\245\273\310\000\000\035\351~\270\232\312\000\000\000\000"
+ ".\245\310\304\000\000\000\000~\270\311\306\000\000\000\000\205\317V\310\000"
+ "\000\274\351\205\317\014\314\000\000.\327\205\317.\327\000\000\260\027.\245"
+ "\273\310\000\000m+.\245\223\324\000\000\365)~\270\013\326\000\000\343\026"
+ "~\270\232\312\000\000\322(\205\317.\327\000\000D\026\205\317\014\314\000"
+ "\000\335\025\327\350\373\314\000\000\026(\327\350\352\327\000\000\000\000"
+ "\327\350V\311\000\000\352\327\327\350\352\327\000\000#\352\327\350\373\314"
+ "\000\000\273\310.\245P\350\000\000\232\312~\270\035\351\000\000\014\314\205"
+ "\317\274\351\000\000V\310\205\317\000\000\000\000\311\306~\270\000\000\000"
+ "\000\310\304.\245\000\000\000\000\373\314\327\350#\352\000\000V\311\327\350"
+ "\000\000\000\000\352\327\327\350\026(\000\000\373\314\327\350\335\025\000"
+ "\000.\327\205\317\322(\000\000\014\314\205\317D\026\000\000\013\326~\270"
+ "\365)\000\000\223\324.\245m+\000\000\273\310.\245\260\027\000\000\232\312"
+ "~\270\343\026\000\000P\350.\245E7\000\000\035\351~\270f5\000\000\274\351"
+ "\205\317\3643\000\000\000\000\205\317\2527\000\000\000\000~\27079\000\000"
+ "\000\000.\2458;\000\000#\352\327\350\0053\000\000\000\000\327\350\2526\000"
+ "\000\026(\327\350\026(\000\000\335\025\327\350\0053\000\000\322(\205\317"
+ "\322(\000\000D\026\205\317\3643\000\000\365)~\270\365)\000\000m+.\245m+\000"
+ "\000\260\027.\245E7\000\000\343\026~\270f5\000\000E7.\245\260\027\000\000"
+ "f5~\270\343\026\000\000\3643\205\317D\026\000\000\2527\205\317\000\000\000"
+ "\00079~\270\000\000\000\0008;.\245\000\000\000\000\0053\327\350\335\025\000"
+ "\000\2526\327\350\000\000\000\000\0053\327\350#\352\000\000\3643\205\317"
+ "\274\351\000\000E7.\245P\350\000\000f5~\270\035\351\000\000{9\000\227\242"
+ "\030\000\000*-\000\227*-\000\000\226=\000\227\000\000\000\000\321='\215\000"
+ "\000\000\000\2469;\215\250\030\000\000;-P\215;-\000\000*-\000\227\326\322"
+ "\000\000{9\000\227^\347\000\000;-P\215\305\322\000\000\2469;\215X\347\000"
+ "\000\357#\312\204\021\334\000\000\251*\240\203\237\352\000\000b5(\207S\351"
+ "\000\000\260)y\207P\326\000\000\003.\015\203\000\000\000\000f9\330\206\000"
+ "\000\000\000\357#\312\204\357#\000\000\260)y\207\260)\000\000b5(\207\255"
+ "\026\000\000\251*\240\203a\025\000\000\242\030\000\227\205\306\000\000\000"
+ "\000\000\227j\302\000\000\000\000'\215/\302\000\000\250\030;\215Z\306\000"
+ "\000\326\322\000\227\326\322\000\000^\347\000\227\205\306\000\000\305\322"
+ "P\215\305\322\000\000X\347;\215Z\306\000\000\021\334\312\204\021\334\000"
+ "\000\237\352\240\203W\325\000\000S\351(\207\236\312\000\000P\326y\207P\326"
+ "\000\000\000\000\015\203\375\321\000\000\000\000\330\206\232\306\000\000"
+ "\255\026(\207\236\312\000\000a\025\240\203W\325\000\000\205\306\000\227^"
+ "\347\000\000j\302\000\227\000\000\000\000/\302'\215\000\000\000\000Z\306"
+ ";\215X\347\000\000\326\322\000\227*-\000\000\205\306\000\227\242\030\000"
+ "\000\305\322P\215;-\000\000Z\306;\215\250\030\000\000\021\334\312\204\357"
+ "#\000\000W\325\240\203a\025\000\000\236\312(\207\255\026\000\000P\326y\207"
+ "\260)\000\000\374\321\015\203\000\000\000\000\232\306\330\206\000\000\000"
+ "\000\236\312(\207S\351\000\000W\325\240\203\237\352\000\000^\347\000\227"
+ "{9\000\000\000\000\000\227\226=\000\000\000\000'\215\321=\000\000X\347;\215"
+ "\2469\000\000\242\030\000\227{9\000\000\250\030;\215\2469\000\000a\025\240"
+ "\203\251*\000\000\255\026(\207b5\000\000\000\000\015\203\004.\000\000\000"
+ "\000\330\206f9\000\000S\351(\207b5\000\000\237\352\240\203\251*\000\000t"
+ "\027}\201\214\350\000\000\000\000\305\200\253\346\000\000\000\000\001\200"
+ "\000\000\000\000U\031\305\200\000\000\000\000\214\350}\201\214\350\000\000"
+ "\253\346\305\200\000\000\000\000\214\350}\201t\027\000\000\000\000\305\200"
+ "U\031\000\000t\027}\201t\027\000\000r\272r\324u\324y\276p\361t\365X'h5dM"
+ "9\363=\372S\366S\3632\033J\027\023Z\023b*E\042;\032e6I%lD]:U\035l\037\363"
+ "\042\366\000\361\000\365\000'\036\027\307\363\303\372\336\366\341\363\316"
+ "\033\342\027\355Z\366b\361E\336;\000e\000I\017E\012b\255\363\255\366\220"
+ "\361\214\365\250'\266\027\216\272\207\276\213\324\216\324\234M\2305\333l"
+ "\343l\306U\274]\346e\312I\326E\355b\216\240\213\243p\201t\201X\177\230au"
+ "\243r\240ha\035u:p\032\1776\177\306p\343u\011m\000u\000\177\012u\367m\366"
+ "u\356v\012\177\022vv\274v\330y\276z\332y\372u\366\177\300\177\343|\334|\277"
+ "\177\000|\375\077\000>\375[\375b\000=\372Y\373;\367W\367\212\274\212\241"
+ "\207\276\206\242y\201u\201\201\300\201\236\204\242\204\277\177\201|\201|"
+ "\242\177\236z\242v\241\305\367\340\367\000\366\000\372\337\373\303\372 \367"
+ "!\373\035\000!\375\000\000\000\375\301\000\302\375\337\375\343\000\212\330"
+ "\213\366\207\372\206\332\251\367\247\373\236\000\245\375\201\000\204\375"
+ "\204\334\201\343\211C\215F\215`\211_q\177v\177y\177\206^\206Bs`sFwCw_zBz"
+ "^|^|A|\177\204A\204^\215+\211(\206&\207\006\212\011\217\016\204$\204\003"
+ "\302\003\245\003\303\005\247\005\304\010\307\014\254\014\251\010\341\014"
+ "\340\010\337\005\000\006\000\011\000\016\337\003\000\003>\003!\003=\005!"
+ "\005<\0109\014\037\014 \010T\014W\010Y\005y\006v\011q\016[\003|\003|$z&s"
+ "+w(S\012=\006t\013X\331J\3512\346yBu,e\263h\313%\224\035\224:\254E\243\032"
+ "\2336\267\023\246\042\306+\273\023\236u]t\177X\201h\237\207B\213]\233\263"
+ "\230\237\333\224\343\213\306\220\273\243\032\2016\201:\220\035\213\213,\214"
+ "\013\250\331\230\313\303\006\255\012\316\346\266\351\355\246\355\236\325"
+ "\273\336\306\346\233\312\267\306\254\343\224\336\012\000\013\000\331\342"
+ "\351\042\012\036\351\012\236\017\273\000\233\000\267\361\273\366\236\022"
+ "\212\012\201\000\201\012\213\356\212\366\213\367\223\000\213\011\223\000"
+ "\000\001\000\002\000\000\000\002\000\003\000\001\000\004\000\005\000\005"
+ "\000\002\000\001\000\005\000\006\000\007\000\007\000\002\000\005\000\007"
+ "\000\010\000\003\000\003\000\002\000\007\000\011\000\012\000\013\000\011"
+ "\000\013\000\014\000\012\000\015\000\016\000\016\000\013\000\012\000\016"
+ "\000\006\000\005\000\005\000\013\000\016\000\005\000\004\000\014\000\014"
+ "\000\013\000\005\000\017\000\020\000\021\000\017\000\021\000\022\000\023"
+ "\000\024\000\021\000\023\000\021\000\020\000\006\000\016\000\021\000\006"
+ "\000\021\000\024\000\016\000\015\000\022\000\022\000\021\000\016\000\025"
+ "\000\026\000\027\000\025\000\027\000\030\000\026\000\010\000\007\000\007"
+ "\000\027\000\026\000\006\000\024\000\027\000\006\000\027\000\007\000\023"
+ "\000\030\000\027\000\023\000\027\000\024\000\011\000\031\000\032\000\011"
+ "\000\032\000\012\000\031\000\033\000\034\000\034\000\032\000\031\000\034"
+ "\000\035\000\036\000\036\000\032\000\034\000\036\000\015\000\012\000\012"
+ "\000\032\000\036\000\037\000 \000!\000\037\000!\000\042\000 \000#\000$\000"
+ "$\000!\000 \000$\000\035\000\034\000\034\000!\000$\000\034\000\033\000\042"
+ "\000\042\000!\000\034\000%\000&\000'\000%\000'\000(\000)\000*\000'\000)\000"
+ "'\000&\000\035\000$\000'\000\035\000'\000*\000$\000#\000(\000(\000'\000$"
+ "\000\017\000\022\000+\000\017\000+\000,\000\022\000\015\000\036\000\036\000"
+ "+\000\022\000\035\000*\000+\000\035\000+\000\036\000)\000,\000+\000)\000"
+ "+\000*\000\037\000-\000.\000\037\000.\000 \000-\000/\0000\0000\000.\000-"
+ "\0000\0001\0002\0002\000.\0000\0002\000#\000 \000 \000.\0002\0003\0004\000"
+ "5\0003\0005\0006\0004\0007\0008\0008\0005\0004\0008\0001\0000\0000\0005\000"
+ "8\0000\000/\0006\0006\0005\0000\0009\000:\000;\0009\000;\000<\000=\000>\000"
+ ";\000=\000;\000:\0001\0008\000;\0001\000;\000>\0008\0007\000<\000<\000;\000"
+ "8\000%\000(\000\077\000%\000\077\000@\000(\000#\0002\0002\000\077\000(\000"
+ "1\000>\000\077\0001\000\077\0002\000=\000@\000\077\000=\000\077\000>\000"
+ "3\000A\000B\0003\000B\0004\000A\000C\000D\000D\000B\000A\000D\000E\000F\000"
+ "F\000B\000D\000F\0007\0004\0004\000B\000F\000\000\000\003\000G\000\000\000"
+ "G\000H\000\003\000\010\000I\000I\000G\000\003\000I\000E\000D\000D\000G\000"
+ "I\000D\000C\000H\000H\000G\000D\000\025\000J\000K\000\025\000K\000\026\000"
+ "L\000M\000K\000L\000K\000J\000E\000I\000K\000E\000K\000M\000I\000\010\000"
+ "\026\000\026\000K\000I\0009\000<\000N\0009\000N\000O\000<\0007\000F\000F"
+ "\000N\000<\000E\000M\000N\000E\000N\000F\000L\000O\000N\000L\000N\000M\000"
+ "\017\000,\000P\000\017\000P\000\020\000,\000)\000Q\000Q\000P\000,\000R\000"
+ "S\000P\000R\000P\000Q\000S\000\023\000\020\000\020\000P\000S\000%\000@\000"
+ "T\000%\000T\000&\000@\000=\000U\000U\000T\000@\000R\000Q\000T\000R\000T\000"
+ "U\000Q\000)\000&\000&\000T\000Q\0009\000O\000V\0009\000V\000:\000O\000L\000"
+ "W\000W\000V\000O\000R\000U\000V\000R\000V\000W\000U\000=\000:\000:\000V\000"
+ "U\000\025\000\030\000X\000\025\000X\000J\000\030\000\023\000S\000S\000X\000"
+ "\030\000R\000W\000X\000R\000X\000S\000W\000L\000J\000J\000X\000W\000\001"
+ "\000\000\000Y\000Y\000Z\000\001\000[\000\134\000Z\000[\000Z\000Y\000\134"
+ "\000]\000^\000^\000Z\000\134\000\004\000\001\000Z\000\004\000Z\000^\000_"
+ "\000`\000a\000_\000a\000b\000`\000c\000d\000d\000a\000`\000]\000\134\000"
+ "a\000]\000a\000d\000\134\000[\000b\000b\000a\000\134\000e\000f\000g\000e"
+ "\000g\000h\000f\000i\000j\000j\000g\000f\000]\000d\000g\000]\000g\000j\000"
+ "d\000c\000h\000h\000g\000d\000k\000\011\000\014\000\014\000l\000k\000\004"
+ "\000^\000l\000\004\000l\000\014\000^\000]\000j\000j\000l\000^\000i\000k\000"
+ "l\000i\000l\000j\000A\0003\000m\000m\000n\000A\000o\000p\000n\000o\000n\000"
+ "m\000p\000q\000r\000r\000n\000p\000C\000A\000n\000C\000n\000r\000s\000t\000"
+ "u\000s\000u\000v\000t\000w\000x\000x\000u\000t\000q\000p\000u\000q\000u\000"
+ "x\000p\000o\000v\000v\000u\000p\000_\000b\000y\000_\000y\000z\000b\000[\000"
+ "{\000{\000y\000b\000q\000x\000y\000q\000y\000{\000x\000w\000z\000z\000y\000"
+ "x\000Y\000\000\000H\000H\000|\000Y\000C\000r\000|\000C\000|\000H\000r\000"
+ "q\000{\000{\000|\000r\000[\000Y\000|\000[\000|\000{\000}\000\037\000\042"
+ "\000\042\000~\000}\000\033\000\177\000~\000\033\000~\000\042\000\177\000"
+ "\200\000\201\000\201\000~\000\177\000\202\000}\000~\000\202\000~\000\201"
+ "\000\031\000\011\000k\000k\000\203\000\031\000i\000\204\000\203\000i\000"
+ "\203\000k\000\204\000\200\000\177\000\177\000\203\000\204\000\033\000\031"
+ "\000\203\000\033\000\203\000\177\000e\000\205\000\206\000e\000\206\000f\000"
+ "\205\000\207\000\210\000\210\000\206\000\205\000\200\000\204\000\206\000"
+ "\200\000\206\000\210\000\204\000i\000f\000f\000\206\000\204\000\211\000\212"
+ "\000\213\000\211\000\213\000\214\000\212\000\202\000\201\000\201\000\213"
+ "\000\212\000\200\000\210\000\213\000\200\000\213\000\201\000\210\000\207"
+ "\000\214\000\214\000\213\000\210\000m\0003\0006\0006\000\215\000m\000/\000"
+ "\216\000\215\000/\000\215\0006\000\216\000\217\000\220\000\220\000\215\000"
+ "\216\000o\000m\000\215\000o\000\215\000\220\000-\000\037\000}\000}\000\221"
+ "\000-\000\202\000\222\000\221\000\202\000\221\000}\000\222\000\217\000\216"
+ "\000\216\000\221\000\222\000/\000-\000\221\000/\000\221\000\216\000\211\000"
+ "\223\000\224\000\211\000\224\000\212\000\223\000\225\000\226\000\226\000"
+ "\224\000\223\000\217\000\222\000\224\000\217\000\224\000\226\000\222\000"
+ "\202\000\212\000\212\000\224\000\222\000s\000v\000\227\000s\000\227\000\230"
+ "\000v\000o\000\220\000\220\000\227\000v\000\217\000\226\000\227\000\217\000"
+ "\227\000\220\000\226\000\225\000\230\000\230\000\227\000\226\000\231\000"
+ "\232\000\233\000\233\000\234\000\231\000\235\000\236\000\234\000\235\000"
+ "\234\000\233\000\236\000\237\000\240\000\240\000\234\000\236\000\241\000"
+ "\231\000\234\000\241\000\234\000\240\000\242\000\243\000\244\000\244\000"
+ "\245\000\242\000\246\000\247\000\245\000\246\000\245\000\244\000\247\000"
+ "\237\000\236\000\236\000\245\000\247\000\235\000\242\000\245\000\235\000"
+ "\245\000\236\000_\000z\000\250\000_\000\250\000\251\000z\000w\000\252\000"
+ "\252\000\250\000z\000\237\000\247\000\250\000\237\000\250\000\252\000\247"
+ "\000\246\000\251\000\251\000\250\000\247\000s\000\253\000\254\000s\000\254"
+ "\000t\000\253\000\241\000\240\000\240\000\254\000\253\000\237\000\252\000"
+ "\254\000\237\000\254\000\240\000\252\000w\000t\000t\000\254\000\252\000\255"
+ "\000\232\000\231\000\231\000\256\000\255\000\241\000\257\000\256\000\241"
+ "\000\256\000\231\000\257\000\260\000\261\000\261\000\256\000\257\000\262"
+ "\000\255\000\256\000\262\000\256\000\261\000s\000\230\000\263\000s\000\263"
+ "\000\253\000\230\000\225\000\264\000\264\000\263\000\230\000\260\000\257"
+ "\000\263\000\260\000\263\000\264\000\257\000\241\000\253\000\253\000\263"
+ "\000\257\000\211\000\265\000\266\000\211\000\266\000\223\000\265\000\267"
+ "\000\270\000\270\000\266\000\265\000\260\000\264\000\266\000\260\000\266"
+ "\000\270\000\264\000\225\000\223\000\223\000\266\000\264\000\271\000\272"
+ "\000\273\000\273\000\274\000\271\000\262\000\261\000\274\000\262\000\274"
+ "\000\273\000\261\000\260\000\270\000\270\000\274\000\261\000\267\000\271"
+ "\000\274\000\267\000\274\000\270\000\275\000\272\000\271\000\271\000\276"
+ "\000\275\000\267\000\277\000\276\000\267\000\276\000\271\000\277\000\300"
+ "\000\301\000\301\000\276\000\277\000\302\000\275\000\276\000\302\000\276"
+ "\000\301\000\211\000\214\000\303\000\211\000\303\000\265\000\214\000\207"
+ "\000\304\000\304\000\303\000\214\000\300\000\277\000\303\000\300\000\303"
+ "\000\304\000\277\000\267\000\265\000\265\000\303\000\277\000e\000\305\000"
+ "\306\000e\000\306\000\205\000\305\000\307\000\310\000\310\000\306\000\305"
+ "\000\300\000\304\000\306\000\300\000\306\000\310\000\304\000\207\000\205"
+ "\000\205\000\306\000\304\000\311\000\312\000\313\000\313\000\314\000\311"
+ "\000\302\000\301\000\314\000\302\000\314\000\313\000\301\000\300\000\310"
+ "\000\310\000\314\000\301\000\307\000\311\000\314\000\307\000\314\000\310"
+ "\000\315\000\312\000\311\000\311\000\316\000\315\000\307\000\317\000\316"
+ "\000\307\000\316\000\311\000\317\000\320\000\321\000\321\000\316\000\317"
+ "\000\322\000\315\000\316\000\322\000\316\000\321\000e\000h\000\323\000e\000"
+ "\323\000\305\000h\000c\000\324\000\324\000\323\000h\000\320\000\317\000\323"
+ "\000\320\000\323\000\324\000\317\000\307\000\305\000\305\000\323\000\317"
+ "\000_\000\251\000\325\000_\000\325\000`\000\251\000\246\000\326\000\326\000"
+ "\325\000\251\000\320\000\324\000\325\000\320\000\325\000\326\000\324\000"
+ "c\000`\000`\000\325\000\324\000\244\000\243\000\327\000\327\000\330\000\244"
+ "\000\322\000\321\000\330\000\322\000\330\000\327\000\321\000\320\000\326"
+ "\000\326\000\330\000\321\000\246\000\244\000\330\000\246\000\330\000\326"
+ "\000\312\000\315\000\331\000\312\000\331\000\332\000\315\000\322\000\333"
+ "\000\333\000\331\000\315\000\333\000\334\000\335\000\335\000\331\000\333"
+ "\000\335\000\336\000\332\000\332\000\331\000\335\000\243\000\337\000\340"
+ "\000\243\000\340\000\327\000\337\000\341\000\342\000\342\000\340\000\337"
+ "\000\342\000\334\000\333\000\333\000\340\000\342\000\333\000\322\000\327"
+ "\000\327\000\340\000\333\000\343\000\344\000\345\000\343\000\345\000\346"
+ "\000\347\000\350\000\345\000\347\000\345\000\344\000\334\000\342\000\345"
+ "\000\334\000\345\000\350\000\342\000\341\000\346\000\346\000\345\000\342"
+ "\000\351\000\352\000\353\000\351\000\353\000\354\000\352\000\336\000\335"
+ "\000\335\000\353\000\352\000\334\000\350\000\353\000\334\000\353\000\335"
+ "\000\347\000\354\000\353\000\347\000\353\000\350\000\243\000\242\000\355"
+ "\000\243\000\355\000\337\000\242\000\235\000\356\000\356\000\355\000\242"
+ "\000\356\000\357\000\360\000\360\000\355\000\356\000\360\000\341\000\337"
+ "\000\337\000\355\000\360\000\232\000\361\000\362\000\232\000\362\000\233"
+ "\000\361\000\363\000\364\000\364\000\362\000\361\000\364\000\357\000\356"
+ "\000\356\000\362\000\364\000\356\000\235\000\233\000\233\000\362\000\356"
+ "\000\365\000\366\000\367\000\365\000\367\000\370\000\371\000\372\000\367"
+ "\000\371\000\367\000\366\000\357\000\364\000\367\000\357\000\367\000\372"
+ "\000\364\000\363\000\370\000\370\000\367\000\364\000\343\000\346\000\373"
+ "\000\343\000\373\000\374\000\346\000\341\000\360\000\360\000\373\000\346"
+ "\000\357\000\372\000\373\000\357\000\373\000\360\000\371\000\374\000\373"
+ "\000\371\000\373\000\372\000\232\000\255\000\375\000\232\000\375\000\361"
+ "\000\255\000\262\000\376\000\376\000\375\000\255\000\376\000\377\000\000"
+ "\001\000\001\375\000\376\000\000\001\363\000\361\000\361\000\375\000\000"
+ "\001\272\000\001\001\002\001\272\000\002\001\273\000\001\001\003\001\004"
+ "\001\004\001\002\001\001\001\004\001\377\000\376\000\376\000\002\001\004"
+ "\001\376\000\262\000\273\000\273\000\002\001\376\000\005\001\006\001\007"
+ "\001\005\001\007\001\010\001\011\001\012\001\007\001\011\001\007\001\006"
+ "\001\377\000\004\001\007\001\377\000\007\001\012\001\004\001\003\001\010"
+ "\001\010\001\007\001\004\001\365\000\370\000\013\001\365\000\013\001\014"
+ "\001\370\000\363\000\000\001\000\001\013\001\370\000\377\000\012\001\013"
+ "\001\377\000\013\001\000\001\011\001\014\001\013\001\011\001\013\001\012"
+ "\001\272\000\275\000\015\001\272\000\015\001\001\001\275\000\302\000\016"
+ "\001\016\001\015\001\275\000\016\001\017\001\020\001\020\001\015\001\016"
+ "\001\020\001\003\001\001\001\001\001\015\001\020\001\312\000\332\000\021"
+ "\001\312\000\021\001\313\000\332\000\336\000\022\001\022\001\021\001\332"
+ "\000\022\001\017\001\016\001\016\001\021\001\022\001\016\001\302\000\313"
+ "\000\313\000\021\001\016\001\351\000\023\001\024\001\351\000\024\001\352"
+ "\000\025\001\026\001\024\001\025\001\024\001\023\001\017\001\022\001\024"
+ "\001\017\001\024\001\026\001\022\001\336\000\352\000\352\000\024\001\022"
+ "\001\005\001\010\001\027\001\005\001\027\001\030\001\010\001\003\001\020"
+ "\001\020\001\027\001\010\001\017\001\026\001\027\001\017\001\027\001\020"
+ "\001\025\001\030\001\027\001\025\001\027\001\026\001\343\000\374\000\031"
+ "\001\343\000\031\001\344\000\374\000\371\000\032\001\032\001\031\001\374"
+ "\000\033\001\034\001\031\001\033\001\031\001\032\001\034\001\347\000\344"
+ "\000\344\000\031\001\034\001\365\000\014\001\035\001\365\000\035\001\366"
+ "\000\014\001\011\001\036\001\036\001\035\001\014\001\033\001\032\001\035"
+ "\001\033\001\035\001\036\001\032\001\371\000\366\000\366\000\035\001\032"
+ "\001\005\001\030\001\037\001\005\001\037\001\006\001\030\001\025\001 \001"
+ " \001\037\001\030\001\033\001\036\001\037\001\033\001\037\001 \001\036\001"
+ "\011\001\006\001\006\001\037\001\036\001\351\000\354\000!\001\351\000!\001"
+ "\023\001\354\000\347\000\034\001\034\001!\001\354\000\033\001 \001!\001\033"
+ "\001!\001\034\001 \001\025\001\023\001\023\001!\001 \001\000\000\001\000"
+ "\001\000\002\000\000\000\002\000\002\000\003\000\000\000\003\000\001\000"
+ "\004\000\004\000\005\000\001\000\005\000\002\000\005\000\005\000\006\000"
+ "\006\000\007\000\005\000\007\000\002\000\007\000\007\000\010\000\003\000"
+ "\010\000\003\000\007\000\011\000\012\000\012\000\013\000\011\000\013\000"
+ "\013\000\014\000\011\000\014\000\012\000\015\000\015\000\016\000\012\000"
+ "\016\000\013\000\016\000\006\000\016\000\005\000\016\000\005\000\013\000"
+ "\004\000\014\000\005\000\014\000\017\000\020\000\020\000\021\000\017\000"
+ "\021\000\021\000\022\000\017\000\022\000\023\000\024\000\021\000\024\000"
+ "\021\000\023\000\020\000\023\000\016\000\021\000\006\000\021\000\006\000"
+ "\024\000\015\000\022\000\016\000\022\000\025\000\026\000\026\000\027\000"
+ "\025\000\027\000\027\000\030\000\025\000\030\000\010\000\026\000\007\000"
+ "\026\000\007\000\027\000\024\000\027\000\006\000\027\000\023\000\030\000"
+ "\023\000\027\000\011\000\031\000\031\000\032\000\011\000\032\000\012\000"
+ "\032\000\031\000\033\000\033\000\034\000\031\000\034\000\032\000\034\000"
+ "\034\000\035\000\035\000\036\000\034\000\036\000\032\000\036\000\015\000"
+ "\036\000\012\000\036\000\037\000 \000 \000!\000\037\000!\000!\000\042\000"
+ "\037\000\042\000 \000#\000#\000$\000 \000$\000!\000$\000\035\000$\000\034"
+ "\000$\000\034\000!\000\033\000\042\000\034\000\042\000%\000&\000&\000'\000"
+ "%\000'\000'\000(\000%\000(\000)\000*\000'\000*\000'\000)\000&\000)\000$\000"
+ "'\000\035\000'\000\035\000*\000#\000(\000$\000(\000\022\000+\000\017\000"
+ "+\000+\000,\000\017\000,\000\022\000\036\000\036\000+\000*\000+\000\035\000"
+ "+\000)\000,\000)\000+\000\037\000-\000-\000.\000\037\000.\000 \000.\000-"
+ "\000/\000/\0000\000-\0000\000.\0000\0000\0001\0001\0002\0000\0002\000.\000"
+ "2\000#\0002\000 \0002\0003\0004\0004\0005\0003\0005\0005\0006\0003\0006\000"
+ "4\0007\0007\0008\0004\0008\0005\0008\0001\0008\0000\0008\0000\0005\000/\000"
+ "6\0000\0006\0009\000:\000:\000;\0009\000;\000;\000<\0009\000<\000=\000>\000"
+ ";\000>\000;\000=\000:\000=\0008\000;\0001\000;\0001\000>\0007\000<\0008\000"
+ "<\000(\000\077\000%\000\077\000\077\000@\000%\000@\000(\0002\0002\000\077"
+ "\000>\000\077\0001\000\077\000=\000@\000=\000\077\0003\000A\000A\000B\000"
+ "3\000B\0004\000B\000A\000C\000C\000D\000A\000D\000B\000D\000D\000E\000E\000"
+ "F\000D\000F\000B\000F\0007\000F\0004\000F\000\003\000G\000\000\000G\000G"
+ "\000H\000\000\000H\000\010\000I\000\003\000I\000G\000I\000E\000I\000D\000"
+ "I\000D\000G\000C\000H\000D\000H\000\025\000J\000J\000K\000\025\000K\000\026"
+ "\000K\000L\000M\000K\000M\000K\000L\000J\000L\000I\000K\000E\000K\000E\000"
+ "M\000\026\000I\000<\000N\0009\000N\000N\000O\0009\000O\000<\000F\000F\000"
+ "N\000M\000N\000E\000N\000L\000O\000L\000N\000,\000P\000\017\000P\000\020"
+ "\000P\000)\000Q\000,\000Q\000P\000Q\000R\000S\000P\000S\000P\000R\000Q\000"
+ "R\000\023\000S\000\020\000S\000@\000T\000%\000T\000&\000T\000=\000U\000@"
+ "\000U\000T\000U\000Q\000T\000R\000T\000R\000U\000&\000Q\000O\000V\0009\000"
+ "V\000:\000V\000L\000W\000O\000W\000V\000W\000U\000V\000R\000V\000R\000W\000"
+ ":\000U\000\030\000X\000\025\000X\000J\000X\000\030\000S\000S\000X\000W\000"
+ "X\000R\000X\000J\000W\000\000\000Y\000\001\000Y\000Y\000Z\000\001\000Z\000"
+ "[\000\134\000Z\000\134\000Z\000[\000Y\000[\000\134\000]\000]\000^\000\134"
+ "\000^\000Z\000^\000\004\000Z\000\004\000^\000_\000`\000`\000a\000_\000a\000"
+ "a\000b\000_\000b\000`\000c\000c\000d\000`\000d\000a\000d\000\134\000a\000"
+ "]\000a\000]\000d\000[\000b\000\134\000b\000e\000f\000f\000g\000e\000g\000"
+ "g\000h\000e\000h\000f\000i\000i\000j\000f\000j\000g\000j\000d\000g\000]\000"
+ "g\000]\000j\000c\000h\000d\000h\000\011\000k\000\014\000k\000\014\000l\000"
+ "k\000l\000^\000l\000\004\000l\000^\000j\000j\000l\000i\000k\000i\000l\000"
+ "3\000m\000A\000m\000m\000n\000A\000n\000o\000p\000n\000p\000n\000o\000m\000"
+ "o\000p\000q\000q\000r\000p\000r\000n\000r\000C\000n\000C\000r\000s\000t\000"
+ "t\000u\000s\000u\000u\000v\000s\000v\000t\000w\000w\000x\000t\000x\000u\000"
+ "x\000p\000u\000q\000u\000q\000x\000o\000v\000p\000v\000b\000y\000_\000y\000"
+ "y\000z\000_\000z\000[\000{\000b\000{\000y\000{\000x\000y\000q\000y\000q\000"
+ "{\000w\000z\000x\000z\000H\000Y\000H\000|\000Y\000|\000r\000|\000C\000|\000"
+ "r\000{\000{\000|\000[\000|\000\037\000}\000\042\000}\000\042\000~\000}\000"
+ "~\000\033\000\177\000~\000\177\000\033\000~\000\177\000\200\000\200\000\201"
+ "\000\177\000\201\000~\000\201\000}\000\202\000~\000\202\000\201\000\202\000"
+ "\031\000k\000k\000\203\000\031\000\203\000i\000\204\000\203\000\204\000i"
+ "\000\203\000\200\000\204\000\177\000\204\000\177\000\203\000\033\000\203"
+ "\000e\000\205\000\205\000\206\000e\000\206\000f\000\206\000\205\000\207\000"
+ "\207\000\210\000\205\000\210\000\206\000\210\000\204\000\206\000\200\000"
+ "\206\000\200\000\210\000f\000\204\000\211\000\212\000\212\000\213\000\211"
+ "\000\213\000\213\000\214\000\211\000\214\000\202\000\212\000\201\000\212"
+ "\000\201\000\213\000\210\000\213\000\200\000\213\000\207\000\214\000\210"
+ "\000\214\0006\000m\0006\000\215\000m\000\215\000/\000\216\000\215\000\216"
+ "\000/\000\215\000\216\000\217\000\217\000\220\000\216\000\220\000\215\000"
+ "\220\000o\000\215\000o\000\220\000-\000}\000}\000\221\000-\000\221\000\202"
+ "\000\222\000\221\000\222\000\202\000\221\000\217\000\222\000\216\000\222"
+ "\000\216\000\221\000/\000\221\000\211\000\223\000\223\000\224\000\211\000"
+ "\224\000\212\000\224\000\223\000\225\000\225\000\226\000\223\000\226\000"
+ "\224\000\226\000\222\000\224\000\217\000\224\000\217\000\226\000\212\000"
+ "\222\000v\000\227\000s\000\227\000\227\000\230\000s\000\230\000v\000\220"
+ "\000\220\000\227\000\226\000\227\000\217\000\227\000\225\000\230\000\226"
+ "\000\230\000\231\000\232\000\232\000\233\000\231\000\233\000\233\000\234"
+ "\000\231\000\234\000\235\000\236\000\234\000\236\000\234\000\235\000\233"
+ "\000\235\000\236\000\237\000\237\000\240\000\236\000\240\000\234\000\240"
+ "\000\231\000\241\000\234\000\241\000\240\000\241\000\242\000\243\000\243"
+ "\000\244\000\242\000\244\000\244\000\245\000\242\000\245\000\246\000\247"
+ "\000\245\000\247\000\245\000\246\000\244\000\246\000\237\000\247\000\236"
+ "\000\247\000\236\000\245\000\235\000\242\000\235\000\245\000z\000\250\000"
+ "_\000\250\000\250\000\251\000_\000\251\000w\000\252\000z\000\252\000\250"
+ "\000\252\000\247\000\250\000\237\000\250\000\237\000\252\000\246\000\251"
+ "\000\247\000\251\000s\000\253\000\253\000\254\000s\000\254\000t\000\254\000"
+ "\241\000\253\000\240\000\253\000\240\000\254\000\252\000\254\000\237\000"
+ "\254\000t\000\252\000\232\000\255\000\231\000\255\000\231\000\256\000\255"
+ "\000\256\000\241\000\257\000\256\000\257\000\241\000\256\000\257\000\260"
+ "\000\260\000\261\000\257\000\261\000\256\000\261\000\255\000\262\000\256"
+ "\000\262\000\261\000\262\000\230\000\263\000s\000\263\000\253\000\263\000"
+ "\225\000\264\000\230\000\264\000\263\000\264\000\257\000\263\000\260\000"
+ "\263\000\260\000\264\000\253\000\257\000\211\000\265\000\265\000\266\000"
+ "\211\000\266\000\223\000\266\000\265\000\267\000\267\000\270\000\265\000"
+ "\270\000\266\000\270\000\264\000\266\000\260\000\266\000\260\000\270\000"
+ "\223\000\264\000\271\000\272\000\272\000\273\000\271\000\273\000\273\000"
+ "\274\000\271\000\274\000\261\000\274\000\262\000\274\000\262\000\273\000"
+ "\261\000\270\000\270\000\274\000\267\000\271\000\267\000\274\000\272\000"
+ "\275\000\271\000\275\000\271\000\276\000\275\000\276\000\267\000\277\000"
+ "\276\000\277\000\267\000\276\000\277\000\300\000\300\000\301\000\277\000"
+ "\301\000\276\000\301\000\275\000\302\000\276\000\302\000\301\000\302\000"
+ "\214\000\303\000\211\000\303\000\265\000\303\000\207\000\304\000\214\000"
+ "\304\000\303\000\304\000\277\000\303\000\300\000\303\000\300\000\304\000"
+ "\265\000\277\000e\000\305\000\305\000\306\000e\000\306\000\205\000\306\000"
+ "\305\000\307\000\307\000\310\000\305\000\310\000\306\000\310\000\304\000"
+ "\306\000\300\000\306\000\300\000\310\000\205\000\304\000\311\000\312\000"
+ "\312\000\313\000\311\000\313\000\313\000\314\000\311\000\314\000\301\000"
+ "\314\000\302\000\314\000\302\000\313\000\301\000\310\000\310\000\314\000"
+ "\307\000\311\000\307\000\314\000\312\000\315\000\311\000\315\000\311\000"
+ "\316\000\315\000\316\000\307\000\317\000\316\000\317\000\307\000\316\000"
+ "\317\000\320\000\320\000\321\000\317\000\321\000\316\000\321\000\315\000"
+ "\322\000\316\000\322\000\321\000\322\000h\000\323\000e\000\323\000\305\000"
+ "\323\000c\000\324\000h\000\324\000\323\000\324\000\317\000\323\000\320\000"
+ "\323\000\320\000\324\000\305\000\317\000\251\000\325\000_\000\325\000`\000"
+ "\325\000\246\000\326\000\251\000\326\000\325\000\326\000\324\000\325\000"
+ "\320\000\325\000\320\000\326\000`\000\324\000\243\000\327\000\244\000\327"
+ "\000\327\000\330\000\244\000\330\000\321\000\330\000\322\000\330\000\322"
+ "\000\327\000\321\000\326\000\326\000\330\000\246\000\330\000\315\000\331"
+ "\000\312\000\331\000\331\000\332\000\312\000\332\000\322\000\333\000\315"
+ "\000\333\000\331\000\333\000\333\000\334\000\334\000\335\000\333\000\335"
+ "\000\331\000\335\000\335\000\336\000\332\000\336\000\332\000\335\000\243"
+ "\000\337\000\337\000\340\000\243\000\340\000\327\000\340\000\337\000\341"
+ "\000\341\000\342\000\337\000\342\000\340\000\342\000\334\000\342\000\333"
+ "\000\342\000\333\000\340\000\327\000\333\000\343\000\344\000\344\000\345"
+ "\000\343\000\345\000\345\000\346\000\343\000\346\000\347\000\350\000\345"
+ "\000\350\000\345\000\347\000\344\000\347\000\342\000\345\000\334\000\345"
+ "\000\334\000\350\000\341\000\346\000\342\000\346\000\351\000\352\000\352"
+ "\000\353\000\351\000\353\000\353\000\354\000\351\000\354\000\336\000\352"
+ "\000\335\000\352\000\335\000\353\000\350\000\353\000\334\000\353\000\347"
+ "\000\354\000\347\000\353\000\242\000\355\000\243\000\355\000\337\000\355"
+ "\000\235\000\356\000\242\000\356\000\355\000\356\000\356\000\357\000\357"
+ "\000\360\000\356\000\360\000\355\000\360\000\341\000\360\000\337\000\360"
+ "\000\232\000\361\000\361\000\362\000\232\000\362\000\233\000\362\000\361"
+ "\000\363\000\363\000\364\000\361\000\364\000\362\000\364\000\357\000\364"
+ "\000\356\000\364\000\356\000\362\000\233\000\356\000\365\000\366\000\366"
+ "\000\367\000\365\000\367\000\367\000\370\000\365\000\370\000\371\000\372"
+ "\000\367\000\372\000\367\000\371\000\366\000\371\000\364\000\367\000\357"
+ "\000\367\000\357\000\372\000\363\000\370\000\364\000\370\000\346\000\373"
+ "\000\343\000\373\000\373\000\374\000\343\000\374\000\346\000\360\000\360"
+ "\000\373\000\372\000\373\000\357\000\373\000\371\000\374\000\371\000\373"
+ "\000\255\000\375\000\232\000\375\000\361\000\375\000\262\000\376\000\255"
+ "\000\376\000\375\000\376\000\376\000\377\000\377\000\000\001\376\000\000"
+ "\001\375\000\000\001\363\000\000\001\361\000\000\001\272\000\001\001\001"
+ "\001\002\001\272\000\002\001\273\000\002\001\001\001\003\001\003\001\004"
+ "\001\001\001\004\001\002\001\004\001\377\000\004\001\376\000\004\001\376"
+ "\000\002\001\273\000\376\000\005\001\006\001\006\001\007\001\005\001\007"
+ "\001\007\001\010\001\005\001\010\001\011\001\012\001\007\001\012\001\007"
+ "\001\011\001\006\001\011\001\004\001\007\001\377\000\007\001\377\000\012"
+ "\001\003\001\010\001\004\001\010\001\370\000\013\001\365\000\013\001\013"
+ "\001\014\001\365\000\014\001\370\000\000\001\000\001\013\001\012\001\013"
+ "\001\377\000\013\001\011\001\014\001\011\001\013\001\275\000\015\001\272"
+ "\000\015\001\001\001\015\001\302\000\016\001\275\000\016\001\015\001\016"
+ "\001\016\001\017\001\017\001\020\001\016\001\020\001\015\001\020\001\003"
+ "\001\020\001\001\001\020\001\332\000\021\001\312\000\021\001\313\000\021"
+ "\001\336\000\022\001\332\000\022\001\021\001\022\001\017\001\022\001\016"
+ "\001\022\001\016\001\021\001\313\000\016\001\351\000\023\001\023\001\024"
+ "\001\351\000\024\001\352\000\024\001\025\001\026\001\024\001\026\001\024"
+ "\001\025\001\023\001\025\001\022\001\024\001\017\001\024\001\017\001\026"
+ "\001\352\000\022\001\010\001\027\001\005\001\027\001\027\001\030\001\005"
+ "\001\030\001\010\001\020\001\020\001\027\001\026\001\027\001\017\001\027"
+ "\001\025\001\030\001\025\001\027\001\374\000\031\001\343\000\031\001\344"
+ "\000\031\001\371\000\032\001\374\000\032\001\031\001\032\001\033\001\034"
+ "\001\031\001\034\001\031\001\033\001\032\001\033\001\347\000\034\001\344"
+ "\000\034\001\014\001\035\001\365\000\035\001\366\000\035\001\011\001\036"
+ "\001\014\001\036\001\035\001\036\001\032\001\035\001\033\001\035\001\033"
+ "\001\036\001\366\000\032\001\030\001\037\001\005\001\037\001\006\001\037"
+ "\001\025\001 \001\030\001 \001\037\001 \001\036\001\037\001\033\001\037\001"
+ "\033\001 \001\006\001\036\001\354\000!\001\351\000!\001\023\001!\001\354"
+ "\000\034\001\034\001!\001 \001!\001\033\001!\001\023\001 \001"
+;
+const unsigned long s1_1_size = 9892;
@@ -1,1733 +1,475 @@
+/* Generated from "s1_2.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.945978,-0.110612,-0.304781,0.91525,0.49905,-0.604062,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.749601,-0.05627,-0.659493,0.877427,0.54752,-0.683563,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.945978,-0.110612,-0.304781,0.91525,0.49905,-0.604062,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.749601,-0.05627,-0.659493,0.877427,0.54752,-0.683563,
-	0.749601,-0.05627,-0.659493,0.877427,0.54752,-0.683563,
-	0.919806,-0.190639,-0.342948,0.925,0.532253,-0.600125,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.749602,-0.05627,0.659493,0.877427,0.54752,-0.316437,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.945978,-0.110612,0.304781,0.91525,0.49905,-0.395938,
-	0.749602,-0.05627,0.659493,0.877427,0.54752,-0.316437,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.749602,-0.05627,0.659493,0.877427,0.54752,-0.316437,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.945978,-0.110612,0.304781,0.91525,0.49905,-0.395938,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.919806,-0.190639,0.342948,0.925,0.532253,-0.399875,
-	0.981457,-0.191681,0,0.940858,0.527164,-0.5,
-	0.503147,0.845347,0.179535,0.858509,0.615264,-0.361333,
-	0.496158,0.862422,0.100278,0.884513,0.611054,-0.4175,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.503147,0.845347,0.179535,0.858509,0.615264,-0.361333,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.788799,0.614652,0,0.934249,0.5808,-0.5,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.496158,0.862422,0.100278,0.884513,0.611054,-0.4175,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.788799,0.614652,0,0.934249,0.5808,-0.5,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.729041,0.662418,0.172342,0.919197,0.584697,-0.4125,
-	0.932108,0.142863,0.332815,0.92981,0.559801,-0.403594,
-	0.503147,0.845347,-0.179534,0.858509,0.615264,-0.638667,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.503147,0.845347,-0.179534,0.858509,0.615264,-0.638667,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.496158,0.862422,-0.100277,0.884513,0.611054,-0.5825,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.788799,0.614652,0,0.934249,0.5808,-0.5,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.973132,0.23025,0,0.945338,0.554869,-0.5,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.932108,0.142863,-0.332815,0.92981,0.559801,-0.596406,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.496158,0.862422,-0.100277,0.884513,0.611054,-0.5825,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.729041,0.662418,-0.172342,0.919197,0.584697,-0.5875,
-	0.788799,0.614652,0,0.934249,0.5808,-0.5,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.749602,-0.05627,0.659493,0.877427,0.54752,-0.316437,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.446948,0.373871,0.812686,0.80768,0.601112,-0.274594,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.749602,-0.05627,0.659493,0.877427,0.54752,-0.316437,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.413121,0.093331,0.905881,0.798138,0.572966,-0.266375,
-	0.446948,0.373871,0.812686,0.80768,0.601112,-0.274594,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	-0.468298,0.578298,0.668033,0.500319,0.618731,-0.309219,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	-0.227561,0.374378,0.89892,0.607846,0.634036,-0.266375,
-	0.075758,0.234707,0.96911,0.702992,0.603501,-0.249687,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	-0.070158,0.909054,0.410729,0.571915,0.702991,-0.339125,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.329457,0.915147,0.232303,0.729578,0.666743,-0.322437,
-	0.2681,0.82446,0.498385,0.724816,0.652913,-0.2785,
-	0.2681,0.82446,0.498385,0.724816,0.652913,-0.2785,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	0.2681,0.82446,0.498385,0.724816,0.652913,-0.2785,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.070158,0.909054,0.410729,0.571915,0.702991,-0.339125,
-	-0.070158,0.909054,0.410729,0.571915,0.702991,-0.339125,
-	0.096538,0.86115,0.4991,0.641688,0.680252,-0.294,
-	-0.109115,0.586342,0.802681,0.625134,0.662855,-0.274594,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.503147,0.845347,0.179535,0.858509,0.615264,-0.361333,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.446948,0.373871,0.812686,0.80768,0.601112,-0.274594,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.692376,0.299843,0.656284,0.88375,0.575062,-0.323141,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.634483,0.691277,0.345786,0.876135,0.59824,-0.339125,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.2681,0.82446,0.498385,0.724816,0.652913,-0.2785,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.190084,0.486023,0.853024,0.716506,0.632271,-0.258297,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.446948,0.373871,0.812686,0.80768,0.601112,-0.274594,
-	0.329457,0.915147,0.232303,0.729578,0.666743,-0.322437,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.329457,0.915147,0.232303,0.729578,0.666743,-0.322437,
-	0.454725,0.723574,0.519294,0.807153,0.623277,-0.294,
-	0.2681,0.82446,0.498385,0.724816,0.652913,-0.2785,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.468298,0.578298,0.668033,0.500319,0.618731,-0.309219,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	-0.655082,0.755558,0,0.487673,0.709673,-0.5,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.541739,0.509206,0.668752,0.528557,0.659482,-0.316437,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.740712,0.587497,0.325872,0.480984,0.67475,-0.399875,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.468298,0.578298,-0.668033,0.500319,0.618731,-0.690781,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	-0.655082,0.755558,0,0.487673,0.709673,-0.5,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.740713,0.587497,-0.325872,0.480984,0.67475,-0.600125,
-	-0.797112,0.603831,0,0.465127,0.679839,-0.5,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	0.139983,0.985063,-0.100277,0.573201,0.718247,-0.5825,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	-0.070159,0.909054,-0.410729,0.571915,0.702991,-0.660875,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	0.139983,0.985063,-0.100277,0.573201,0.718247,-0.5825,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.655082,0.755558,0,0.487673,0.709673,-0.5,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.070159,0.909054,-0.410729,0.571915,0.702991,-0.660875,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.142867,0.968199,-0.205377,0.529644,0.718831,-0.5875,
-	-0.606207,0.755737,-0.247737,0.503003,0.704166,-0.596406,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	-0.070158,0.909054,0.410729,0.571915,0.702991,-0.339125,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	0.139983,0.985063,0.100277,0.573201,0.718247,-0.4175,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	-0.424048,0.688165,0.588737,0.548866,0.688331,-0.323141,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	-0.070158,0.909054,0.410729,0.571915,0.702991,-0.339125,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	-0.655082,0.755558,0,0.487673,0.709673,-0.5,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	-0.606207,0.755737,0.247737,0.503003,0.704166,-0.403594,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	0.139983,0.985063,0.100277,0.573201,0.718247,-0.4175,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	-0.142867,0.968199,0.205377,0.529644,0.718831,-0.4125,
-	-0.31505,0.949075,0,0.515384,0.725027,-0.5,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	-0.468298,0.578298,-0.668033,0.500319,0.618731,-0.690781,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.541738,0.509206,-0.668752,0.528557,0.659482,-0.683563,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.227561,0.374378,-0.89892,0.607846,0.634036,-0.733625,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.749601,-0.05627,-0.659493,0.877427,0.54752,-0.683563,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.446948,0.373871,-0.812686,0.80768,0.601112,-0.725406,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.749601,-0.05627,-0.659493,0.877427,0.54752,-0.683563,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.446948,0.373871,-0.812686,0.80768,0.601112,-0.725406,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.41312,0.093332,-0.905881,0.798138,0.572966,-0.733625,
-	0.075758,0.234708,-0.969109,0.702992,0.603501,-0.750313,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.503147,0.845347,-0.179534,0.858509,0.615264,-0.638667,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.329457,0.915147,-0.232303,0.729578,0.666743,-0.677562,
-	0.2681,0.82446,-0.498385,0.724816,0.652913,-0.7215,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.329457,0.915147,-0.232303,0.729578,0.666743,-0.677562,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.446948,0.373871,-0.812686,0.80768,0.601112,-0.725406,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.2681,0.82446,-0.498385,0.724816,0.652913,-0.7215,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.634482,0.691277,-0.345786,0.876135,0.59824,-0.660875,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.692376,0.299844,-0.656284,0.88375,0.575062,-0.676859,
-	0.454725,0.723574,-0.519294,0.807153,0.623277,-0.706,
-	0.446948,0.373871,-0.812686,0.80768,0.601112,-0.725406,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	-0.070159,0.909054,-0.410729,0.571915,0.702991,-0.660875,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	-0.070159,0.909054,-0.410729,0.571915,0.702991,-0.660875,
-	-0.424048,0.688166,-0.588737,0.548866,0.688331,-0.676859,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	-0.070159,0.909054,-0.410729,0.571915,0.702991,-0.660875,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.2681,0.82446,-0.498385,0.724816,0.652913,-0.7215,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	0.190084,0.486023,-0.853024,0.716506,0.632271,-0.741703,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	-0.109115,0.586342,-0.802681,0.625134,0.662855,-0.725406,
-	0.2681,0.82446,-0.498385,0.724816,0.652913,-0.7215,
-	0.329457,0.915147,-0.232303,0.729578,0.666743,-0.677562,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	0.096538,0.86115,-0.4991,0.641688,0.680252,-0.706,
-	0.2681,0.82446,-0.498385,0.724816,0.652913,-0.7215,
-	0.503147,0.845347,0.179535,0.858509,0.615264,-0.361333,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.503147,0.845347,0.179535,0.858509,0.615264,-0.361333,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.496158,0.862422,0.100278,0.884513,0.611054,-0.4175,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.329457,0.915147,0.232303,0.729578,0.666743,-0.322437,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.423992,0.883446,0.199385,0.806863,0.637791,-0.335375,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.496158,0.862422,0.100278,0.884513,0.611054,-0.4175,
-	0.496158,0.862422,0.100278,0.884513,0.611054,-0.4175,
-	0.398886,0.913527,0.079739,0.817112,0.642984,-0.4095,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	0.139983,0.985063,0.100277,0.573201,0.718247,-0.4175,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.123897,0.972069,0.199329,0.596285,0.705555,-0.361333,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.139983,0.985063,0.100277,0.573201,0.718247,-0.4175,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.139983,0.985063,0.100277,0.573201,0.718247,-0.4175,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.329457,0.915147,0.232303,0.729578,0.666743,-0.322437,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.226858,0.951027,0.209959,0.650852,0.69151,-0.335375,
-	0.248097,0.965448,0.079739,0.645973,0.701912,-0.4095,
-	0.324391,0.9421,0.08496,0.732447,0.675074,-0.40225,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.123896,0.972069,-0.199329,0.596285,0.705555,-0.638667,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.139983,0.985063,-0.100277,0.573201,0.718247,-0.5825,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	0.329457,0.915147,-0.232303,0.729578,0.666743,-0.677562,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.226858,0.951027,-0.209959,0.650852,0.69151,-0.664625,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.084449,0.996428,0,0.561689,0.724552,-0.5,
-	0.139983,0.985063,-0.100277,0.573201,0.718247,-0.5825,
-	0.139983,0.985063,-0.100277,0.573201,0.718247,-0.5825,
-	0.248097,0.965448,-0.079739,0.645973,0.701912,-0.5905,
-	0.24406,0.96976,0,0.640022,0.706898,-0.5,
-	0.503147,0.845347,-0.179534,0.858509,0.615264,-0.638667,
-	0.496158,0.862422,-0.100277,0.884513,0.611054,-0.5825,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.503147,0.845347,-0.179534,0.858509,0.615264,-0.638667,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.496158,0.862422,-0.100277,0.884513,0.611054,-0.5825,
-	0.546916,0.837188,0,0.897467,0.608935,-0.5,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.496158,0.862422,-0.100277,0.884513,0.611054,-0.5825,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.325568,0.945519,0,0.733407,0.677865,-0.5,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.404722,0.91444,0,0.824871,0.64325,-0.5,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.329457,0.915147,-0.232303,0.729578,0.666743,-0.677562,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.423992,0.883446,-0.199386,0.806863,0.637791,-0.664625,
-	0.398886,0.913527,-0.079739,0.817112,0.642984,-0.5905,
-	0.324391,0.9421,-0.08496,0.732447,0.675074,-0.59775,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.945978,-0.110612,-0.304781,0.91525,0.49905,-0.604062,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.945978,-0.110612,-0.304781,0.91525,0.49905,-0.604062,
-	0.945978,-0.110612,-0.304781,0.91525,0.49905,-0.604062,
-	0.942442,-0.005211,-0.334328,0.911045,0.457192,-0.613625,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.63763,-0.234074,-0.733919,0.81384,0.310563,-0.75575,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.924673,-0.163459,-0.343891,0.899707,0.356231,-0.635,
-	0.940489,-0.03309,-0.338208,0.907494,0.408859,-0.625156,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.63763,-0.234074,0.733919,0.81384,0.310563,-0.24425,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.924673,-0.16346,0.343891,0.899707,0.356231,-0.365,
-	0.985079,-0.172104,0,0.921826,0.352648,-0.5,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.945978,-0.110612,0.304781,0.91525,0.49905,-0.395938,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.945978,-0.110612,0.304781,0.91525,0.49905,-0.395938,
-	0.980435,-0.196846,0,0.931847,0.494263,-0.5,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.945978,-0.110612,0.304781,0.91525,0.49905,-0.395938,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.998189,-0.060158,0,0.927845,0.404808,-0.5,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.998674,-0.051473,0,0.929348,0.452746,-0.5,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.942442,-0.005211,0.334328,0.911045,0.457192,-0.386375,
-	0.940489,-0.03309,0.338208,0.907494,0.408859,-0.374844,
-	-0.468298,0.578298,-0.668033,0.500319,0.618731,-0.690781,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	-0.468298,0.578298,-0.668033,0.500319,0.618731,-0.690781,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	-0.208655,0.445101,-0.870832,0.583305,0.594795,-0.742813,
-	-0.1826,0.53251,-0.826493,0.544994,0.546127,-0.765125,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.645198,0.198269,-0.737841,0.308193,0.377118,-0.75575,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.261623,0.387306,-0.884052,0.45733,0.427884,-0.815,
-	-0.208343,0.508292,-0.835603,0.500479,0.489876,-0.792031,
-	0.63763,-0.234074,-0.733919,0.81384,0.310563,-0.75575,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.63763,-0.234074,-0.733919,0.81384,0.310563,-0.75575,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.711272,-0.0413,-0.701703,0.83335,0.366979,-0.7475,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	0.369337,0.119431,-0.921589,0.722756,0.384892,-0.815,
-	0.046906,0.258379,-0.964904,0.590043,0.406388,-0.8375,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.744225,-0.02143,-0.667585,0.865458,0.513412,-0.690781,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.088733,0.313595,-0.945402,0.682889,0.566071,-0.760156,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.395884,0.173928,-0.901679,0.782472,0.537348,-0.742813,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	0.081884,0.387365,-0.918283,0.622584,0.465571,-0.812891,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.102672,0.412673,-0.905074,0.654809,0.519447,-0.784063,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.730929,0.12699,-0.670535,0.856137,0.470533,-0.708313,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.725615,0.097758,-0.681122,0.846442,0.421012,-0.729453,
-	0.403724,0.284631,-0.869478,0.764624,0.492766,-0.765125,
-	0.390355,0.256716,-0.884149,0.744688,0.441266,-0.792031,
-	-0.468298,0.578298,0.668033,0.500319,0.618731,-0.309219,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	-0.468298,0.578298,0.668033,0.500319,0.618731,-0.309219,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	-0.208655,0.445101,0.870832,0.583305,0.594795,-0.257187,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.1826,0.532509,0.826493,0.544994,0.546127,-0.234875,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.744225,-0.02143,0.667585,0.865458,0.513412,-0.309219,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.730929,0.126989,0.670535,0.856137,0.470533,-0.291687,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	0.395884,0.173928,0.901679,0.782472,0.537348,-0.257187,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.088734,0.313595,0.945402,0.682889,0.566071,-0.239844,
-	0.403724,0.284631,0.869478,0.764624,0.492766,-0.234875,
-	0.102672,0.412673,0.905074,0.654809,0.519447,-0.215937,
-	0.63763,-0.234074,0.733919,0.81384,0.310563,-0.24425,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.63763,-0.234074,0.733919,0.81384,0.310563,-0.24425,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	0.725614,0.097758,0.681122,0.846442,0.421012,-0.270547,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.711272,-0.0413,0.701703,0.83335,0.366979,-0.2525,
-	0.369337,0.119431,0.921589,0.722756,0.384892,-0.185,
-	0.390355,0.256716,0.884149,0.744688,0.441266,-0.207969,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	-0.645198,0.198269,0.737841,0.308193,0.377118,-0.24425,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	0.081884,0.387365,0.918283,0.622584,0.465571,-0.187109,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	-0.208343,0.508292,0.835603,0.500479,0.489876,-0.207969,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	-0.261623,0.387306,0.884052,0.45733,0.427884,-0.185,
-	0.046906,0.258379,0.964904,0.590043,0.406388,-0.1625,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	-0.468298,0.578298,-0.668033,0.500319,0.618731,-0.690781,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.677265,0.639604,-0.363619,0.450527,0.633092,-0.604062,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.718122,0.695917,0,0.317323,0.526334,-0.5,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.46274,0.649831,-0.602985,0.453481,0.568361,-0.708313,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.641469,0.710708,-0.288812,0.398573,0.581701,-0.613625,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.468298,0.578298,0.668033,0.500319,0.618731,-0.309219,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.46274,0.649831,0.602985,0.453481,0.568361,-0.291687,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.718122,0.695917,0,0.317323,0.526334,-0.5,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.677265,0.639604,0.363619,0.450527,0.633092,-0.395938,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.749144,0.662408,0,0.43393,0.63788,-0.5,
-	-0.641469,0.710708,0.288812,0.398573,0.581701,-0.386375,
-	-0.689225,0.724547,0,0.380271,0.586148,-0.5,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.645198,0.198269,0.737841,0.308193,0.377118,-0.24425,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.778413,0.562971,0.277735,0.280379,0.456545,-0.365,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.778413,0.562971,0.277735,0.280379,0.456545,-0.365,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.778413,0.562971,0.277735,0.280379,0.456545,-0.365,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.718122,0.695917,0,0.317323,0.526334,-0.5,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.778413,0.562971,0.277735,0.280379,0.456545,-0.365,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.490654,0.624331,0.60784,0.398726,0.51013,-0.270547,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.59415,0.505848,0.625383,0.346736,0.445797,-0.2525,
-	-0.778413,0.562971,0.277735,0.280379,0.456545,-0.365,
-	-0.680327,0.681689,0.269175,0.337674,0.522283,-0.374844,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.645198,0.198269,-0.737841,0.308193,0.377118,-0.75575,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.778414,0.562971,-0.277735,0.280379,0.456545,-0.635,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.490654,0.624331,-0.60784,0.398726,0.51013,-0.729453,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.778414,0.562971,-0.277735,0.280379,0.456545,-0.635,
-	-0.59415,0.505848,-0.625383,0.346736,0.445797,-0.7475,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.718122,0.695917,0,0.317323,0.526334,-0.5,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.778414,0.562971,-0.277735,0.280379,0.456545,-0.635,
-	-0.680327,0.681689,-0.269175,0.337674,0.522283,-0.625156,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.778414,0.562971,-0.277735,0.280379,0.456545,-0.635,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.778414,0.562971,-0.277735,0.280379,0.456545,-0.635,
-	-0.786635,0.617419,0,0.25826,0.460127,-0.5,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.337162,-0.377107,-0.86262,0.400082,0.165542,-0.765125,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	0.274839,-0.496479,-0.823391,0.626577,0.153203,-0.765125,
-	-0.024814,-0.431442,-0.901799,0.513329,0.159372,-0.784063,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.63763,-0.234074,-0.733919,0.81384,0.310563,-0.75575,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	0.330471,-0.133893,-0.93427,0.69892,0.325689,-0.8255,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.285459,-0.369325,-0.884371,0.673275,0.265703,-0.815,
-	0.267074,-0.480259,-0.835478,0.648325,0.207388,-0.792031,
-	-0.645198,0.198269,-0.737841,0.308193,0.377118,-0.75575,
-	-0.746027,-0.030098,-0.665235,0.293781,0.305853,-0.7475,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.645198,0.198269,-0.737841,0.308193,0.377118,-0.75575,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.746027,-0.030098,-0.665235,0.293781,0.305853,-0.7475,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.034163,-0.398975,-0.916325,0.52383,0.217409,-0.812891,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.348349,-0.345034,-0.871553,0.399335,0.22743,-0.792031,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	0.001894,-0.000876,-0.999998,0.561017,0.343841,-0.84875,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	-0.328501,0.124794,-0.936223,0.423113,0.361992,-0.8255,
-	-0.383319,-0.173246,-0.907222,0.405397,0.294044,-0.815,
-	-0.029604,-0.263,-0.964342,0.539336,0.279873,-0.8375,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.681322,-0.324401,-0.656174,0.305709,0.170683,-0.708313,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.90316,-0.279949,-0.32547,0.249085,0.173768,-0.613625,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.746027,-0.030098,-0.665235,0.293781,0.305853,-0.7475,
-	-0.645198,0.198269,-0.737841,0.308193,0.377118,-0.75575,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.746027,-0.030098,-0.665235,0.293781,0.305853,-0.7475,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.862657,0.31434,-0.396249,0.239242,0.386194,-0.6395,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.746027,-0.030098,-0.665235,0.293781,0.305853,-0.7475,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.700275,-0.236966,-0.673395,0.295589,0.235781,-0.729453,
-	-0.939405,0.002804,-0.342799,0.226812,0.312938,-0.635,
-	-0.92222,-0.200491,-0.330626,0.233342,0.240791,-0.625156,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.645198,0.198269,0.737841,0.308193,0.377118,-0.24425,
-	-0.746027,-0.030098,0.665236,0.293781,0.305853,-0.2525,
-	-0.746027,-0.030098,0.665236,0.293781,0.305853,-0.2525,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.746027,-0.030098,0.665236,0.293781,0.305853,-0.2525,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.862657,0.31434,0.396249,0.239242,0.386194,-0.3605,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.940313,0.340311,0,0.216258,0.389219,-0.5,
-	-0.939405,0.002804,0.342799,0.226812,0.312938,-0.365,
-	-0.999757,-0.022023,0,0.204489,0.3153,-0.5,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.978535,-0.206083,0,0.212593,0.242461,-0.5,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.963203,-0.268774,0,0.23021,0.174796,-0.5,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.90316,-0.279949,0.32547,0.249085,0.173768,-0.386375,
-	-0.92222,-0.200492,0.330626,0.233342,0.240791,-0.374844,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.681322,-0.324401,0.656174,0.305709,0.170683,-0.291687,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	-0.337162,-0.377107,0.862619,0.400082,0.165542,-0.234875,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	-0.645198,0.198269,0.737841,0.308193,0.377118,-0.24425,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.645198,0.198269,0.737841,0.308193,0.377118,-0.24425,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.746027,-0.030098,0.665236,0.293781,0.305853,-0.2525,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.328501,0.124794,0.936223,0.423113,0.361992,-0.1745,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.746027,-0.030098,0.665236,0.293781,0.305853,-0.2525,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.700275,-0.236966,0.673395,0.295589,0.235781,-0.270547,
-	-0.383319,-0.173246,0.907222,0.405397,0.294044,-0.185,
-	-0.34835,-0.345034,0.871553,0.399335,0.22743,-0.207969,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.63763,-0.234074,0.733919,0.81384,0.310563,-0.24425,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	0.330471,-0.133893,0.93427,0.69892,0.325689,-0.1745,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	0.001894,-0.000875,0.999998,0.561017,0.343841,-0.15125,
-	0.285459,-0.369325,0.884371,0.673275,0.265703,-0.185,
-	-0.029604,-0.263,0.964342,0.539336,0.279873,-0.1625,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	-0.034164,-0.398975,0.916325,0.52383,0.217409,-0.187109,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	-0.024814,-0.431443,0.901799,0.513329,0.159372,-0.215937,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.274839,-0.496479,0.823391,0.626577,0.153203,-0.234875,
-	0.267074,-0.480259,0.835478,0.648325,0.207388,-0.207969,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.562162,-0.569598,0.59961,0.72095,0.148061,-0.291687,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.752224,-0.592299,0.288689,0.777574,0.144976,-0.386375,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.63763,-0.234074,0.733919,0.81384,0.310563,-0.24425,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.846641,-0.361408,0.39062,0.882792,0.301487,-0.3605,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.603048,-0.457417,0.653531,0.78489,0.253894,-0.2525,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.562306,-0.55594,0.612162,0.75207,0.199038,-0.270547,
-	0.784719,-0.539182,0.305775,0.85186,0.246808,-0.365,
-	0.743616,-0.602792,0.28927,0.814318,0.194027,-0.374844,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.63763,-0.234074,-0.733919,0.81384,0.310563,-0.75575,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.603048,-0.457417,-0.653531,0.78489,0.253894,-0.7475,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.846641,-0.361408,-0.390619,0.882792,0.301487,-0.6395,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.918091,-0.39637,0,0.905776,0.298462,-0.5,
-	0.784719,-0.539182,-0.305775,0.85186,0.246808,-0.635,
-	0.822786,-0.568352,0,0.874183,0.244447,-0.5,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.788677,-0.614808,0,0.835067,0.192357,-0.5,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.807803,-0.589452,0,0.796449,0.143948,-0.5,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.562307,-0.55594,-0.612162,0.75207,0.199038,-0.729453,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	0.562161,-0.569598,-0.59961,0.72095,0.148061,-0.708313,
-	0.752224,-0.592299,-0.288689,0.777574,0.144976,-0.613625,
-	0.743616,-0.602791,-0.28927,0.814318,0.194027,-0.625156,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.829185,-0.462729,0.313581,0.749037,0.101488,-0.395938,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.877019,-0.354062,0.324773,0.736115,0.065395,-0.399875,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.829185,-0.462729,-0.313581,0.749037,0.101488,-0.604062,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.902893,-0.429866,0,0.766349,0.100974,-0.5,
-	0.877019,-0.354062,-0.324773,0.736115,0.065395,-0.600125,
-	0.936513,-0.350633,0,0.75279,0.06519,-0.5,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.528671,-0.848827,0,0.7215,0.015465,-0.5,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.528671,-0.848827,0,0.7215,0.015465,-0.5,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	0.460562,-0.87149,-0.168487,0.706,0.016681,-0.5875,
-	0.776532,-0.563325,-0.282246,0.726029,0.037019,-0.596406,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.528671,-0.848827,0,0.7215,0.015465,-0.5,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.796583,-0.60453,0,0.742322,0.036664,-0.5,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.776532,-0.563325,0.282246,0.726029,0.037019,-0.403594,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.460562,-0.87149,0.168487,0.706,0.016681,-0.4125,
-	0.528671,-0.848827,0,0.7215,0.015465,-0.5,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	0.612462,-0.474039,-0.632596,0.6971,0.103031,-0.690781,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	0.309535,-0.382382,-0.870616,0.610539,0.105601,-0.742813,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.662382,-0.336592,-0.669295,0.68609,0.066012,-0.683563,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.325986,-0.296158,-0.897788,0.602715,0.067041,-0.733625,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.321508,-0.547444,-0.772617,0.404279,0.038047,-0.725406,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.321508,-0.547444,-0.772617,0.404279,0.038047,-0.725406,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	-0.009985,-0.330184,-0.943864,0.506665,0.108686,-0.760156,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.340489,-0.258832,-0.903921,0.402791,0.111771,-0.742813,
-	-0.33904,-0.236102,-0.910663,0.402616,0.069508,-0.733625,
-	-0.003719,-0.252904,-0.967484,0.502666,0.068274,-0.750313,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	-0.000173,-0.840077,-0.542467,0.5,0.015465,-0.7215,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	-0.321508,-0.547444,-0.772617,0.404279,0.038047,-0.725406,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.000173,-0.840077,-0.542467,0.5,0.015465,-0.7215,
-	-0.321508,-0.547444,-0.772617,0.404279,0.038047,-0.725406,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	-0.173348,-0.862844,-0.474818,0.4125,0.016681,-0.706,
-	-0.321508,-0.547444,-0.772617,0.404279,0.038047,-0.725406,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	0.609651,-0.5022,-0.613287,0.677491,0.037477,-0.676859,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	0.392801,-0.830761,-0.394389,0.660875,0.017896,-0.660875,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	-0.000173,-0.840077,-0.542467,0.5,0.015465,-0.7215,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	-0.025551,-0.524875,-0.850796,0.500666,0.037435,-0.741703,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	0.28571,-0.534951,-0.795108,0.597054,0.03743,-0.725406,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0.170214,-0.866923,-0.468478,0.5875,0.016681,-0.706,
-	-0.000173,-0.840077,-0.542467,0.5,0.015465,-0.7215,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.68646,-0.277096,-0.672303,0.316229,0.114342,-0.690781,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.917766,-0.211835,-0.335904,0.264292,0.115884,-0.604062,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.696634,-0.190085,-0.691787,0.319242,0.070537,-0.683563,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.92467,-0.172819,-0.339293,0.269217,0.071154,-0.600125,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.917766,-0.211835,0.335904,0.264292,0.115884,-0.395938,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.984639,-0.174604,0,0.24698,0.116398,-0.5,
-	-0.92467,-0.172819,0.339293,0.269217,0.071154,-0.399875,
-	-0.985139,-0.171761,0,0.252542,0.071359,-0.5,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.556955,-0.830542,0,0.2785,0.015465,-0.5,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.556955,-0.830542,0,0.2785,0.015465,-0.5,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.483213,-0.857792,0.175209,0.294,0.016681,-0.4125,
-	-0.829046,-0.471848,0.300069,0.275304,0.038459,-0.403594,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	-0.643521,-0.419436,-0.640277,0.323842,0.038608,-0.676859,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.412793,-0.812756,-0.411133,0.339125,0.017896,-0.660875,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.556955,-0.830542,0,0.2785,0.015465,-0.5,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.851281,-0.524711,0,0.25901,0.038206,-0.5,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.829046,-0.471849,-0.300069,0.275304,0.038459,-0.596406,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.483213,-0.857792,-0.17521,0.294,0.016681,-0.5875,
-	-0.556955,-0.830542,0,0.2785,0.015465,-0.5,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.68646,-0.277096,0.672303,0.316229,0.114342,-0.309219,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.340489,-0.258832,0.903921,0.402791,0.111771,-0.257187,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	-0.321508,-0.547444,0.772617,0.404279,0.038047,-0.274594,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.696634,-0.190085,0.691786,0.319242,0.070537,-0.316437,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.339041,-0.236102,0.910663,0.402616,0.069508,-0.266375,
-	-0.321508,-0.547444,0.772617,0.404279,0.038047,-0.274594,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	0.612462,-0.474038,0.632596,0.6971,0.103031,-0.309219,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	0.662382,-0.336592,0.669295,0.68609,0.066012,-0.316437,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	0.309535,-0.382382,0.870616,0.610539,0.105601,-0.257187,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	-0.009985,-0.330184,0.943864,0.506665,0.108686,-0.239844,
-	0.325986,-0.296157,0.897788,0.602715,0.067041,-0.266375,
-	-0.003719,-0.252904,0.967484,0.502666,0.068274,-0.249687,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	-0.000173,-0.840077,0.542467,0.5,0.015465,-0.2785,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	-0.000173,-0.840077,0.542467,0.5,0.015465,-0.2785,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	0.609651,-0.5022,0.613287,0.677491,0.037477,-0.323141,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0.392801,-0.830761,0.394389,0.660875,0.017896,-0.339125,
-	0.170214,-0.866923,0.468477,0.5875,0.016681,-0.294,
-	0.28571,-0.534951,0.795108,0.597054,0.03743,-0.274594,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.643521,-0.419436,0.640277,0.323842,0.038608,-0.323141,
-	-0.321508,-0.547444,0.772617,0.404279,0.038047,-0.274594,
-	-0.321508,-0.547444,0.772617,0.404279,0.038047,-0.274594,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.412793,-0.812756,0.411133,0.339125,0.017896,-0.339125,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	-0.000173,-0.840077,0.542467,0.5,0.015465,-0.2785,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.025551,-0.524875,0.850796,0.500666,0.037435,-0.258297,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.321508,-0.547444,0.772617,0.404279,0.038047,-0.274594,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	-0.173348,-0.862844,0.474817,0.4125,0.016681,-0.294,
-	-0.000173,-0.840077,0.542467,0.5,0.015465,-0.2785,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.199329,-0.959446,-0.199329,0.638667,0.007537,-0.638667,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.100277,-0.976969,-0.18835,0.5825,0.003052,-0.664625,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.18835,-0.976969,-0.100277,0.664625,0.003052,-0.5825,
-	0.079739,-0.993621,-0.079739,0.5905,-0.005194,-0.5905,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.199329,-0.959446,-0.199329,0.361333,0.007537,-0.638667,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.188349,-0.976969,-0.100277,0.335375,0.003052,-0.5825,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	0,-0.969635,-0.244558,0.5,0.000839,-0.677562,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.100277,-0.976969,-0.18835,0.4175,0.003052,-0.664625,
-	-0.079739,-0.993621,-0.079739,0.4095,-0.005194,-0.5905,
-	0,-0.996384,-0.08496,0.5,-0.007972,-0.59775,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.199328,-0.959446,0.199328,0.361333,0.007537,-0.361333,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.100277,-0.976969,0.188349,0.4175,0.003052,-0.335375,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	0,-1,0,0.5,-0.010924,-0.5,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	-0.244558,-0.969635,0,0.322437,0.000839,-0.5,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.188349,-0.976969,0.100277,0.335375,0.003052,-0.4175,
-	-0.079739,-0.993621,0.079739,0.4095,-0.005194,-0.4095,
-	-0.08496,-0.996384,0,0.40225,-0.007972,-0.5,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.199329,-0.959446,0.199329,0.638667,0.007537,-0.361333,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0.244558,-0.969635,0,0.677562,0.000839,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.18835,-0.976969,0.100277,0.664625,0.003052,-0.4175,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0,-1,0,0.5,-0.010924,-0.5,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0.08496,-0.996384,0,0.59775,-0.007972,-0.5,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-	0,-0.969635,0.244558,0.5,0.000839,-0.322437,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.100277,-0.976969,0.188349,0.5825,0.003052,-0.335375,
-	0.079739,-0.993621,0.079739,0.5905,-0.005194,-0.4095,
-	0,-0.996384,0.08496,0.5,-0.007972,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_2=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_2[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000\210"
+ "-\023\077t\317\266>\000\000\000\277\303\251=7ed\0076\024\276\000\000\231"
+ "u\0211\013\334\000\000\370x\212<g\335\000\000\210h\320A\222\300\000\000V"
+ "{i/\000\000\000\000s~\310:\000\000\000\000\377\177[D\000\000\000\000\241"
+ "z\017F\260\336\000\000\267jUK\343\302\000\000ed\0076\354A\000\000\210h\320"
+ "An\077\000\000\370x\212<\231\042\000\000\231u\0211\365#\000\000\267jUK\035"
+ "=\000\000\241z\017FP!\000\000\376a9Y\352/\000\000\373j\305W\202\034\000\000"
+ "\367v\251N<\036\000\000\025hWS\2277\000\000to\011W\000\000\000\000*|PM\000"
+ "\000\000\000\376a9Y\026\320\000\000\025hWSi\310\000\000\367v\251N\304\341"
+ "\000\000\373j\305W~\343\000\000\270GM>\347S\000\000\042M\233J\272P\000\000"
+ "O%9H\345Y\000\000B,(U~V\000\000\3550\031_\205S\000\000nPUT\343M\000\000\346"
+ "\002&R\347S\000\000:\346lZ\354A\000\000\373\357\200hn\077\000\000a\013\265"
+ "_\272P\000\000\000\367xr\035=\000\000Z\021\253i\343M\000\000b\007lx\352/"
+ "\000\000=\032\222s\3428\000\000\023\027\256o.G\000\000\367\376\211w\2277"
+ "\000\000q5\003k[=\000\000\3143;f\211L\000\000&P\002a\3428\000\000\077P\376"
+ "[.G\000\000\005\325b_\365#\000\000\213\337\307m\231\042\000\000I\317\012"
+ "a\000\000\000\000\021\332\211o\000\000\000\000\333\341\330y\000\000\000\000"
+ "'\347\361wP!\000\000\005\325b_\013\334\000\000:\346lZ\024\276\000\000\373"
+ "\357\200h\222\300\000\000\213\337\307mg\335\000\000\000\367xr\343\302\000"
+ "\000'\347\361w\260\336\000\000b\007lx\026\320\000\000i\377\317|~\343\000"
+ "\000\134\360\002}\304\341\000\000\367\376\211wi\310\000\000n\373\374~\000"
+ "\000\000\000n\353&\177\000\000\000\000\134\360\002}<\036\000\000i\377\317"
+ "|\202\034\000\000\346\002&R\031\254\000\000a\013\265_F\257\000\000O%9H\033"
+ "\246\000\000B,(U\202\251\000\000\3550\031_{\254\000\000Z\021\253i\035\262"
+ "\000\000\042M\233JF\257\000\000\270GM>\031\254\000\000nPUT\035\262\000\000"
+ "&P\002a\036\307\000\000\077P\376[\322\270\000\000q5\003k\245\302\000\000"
+ "\3143;fw\263\000\000\023\027\256o\322\270\000\000=\032\222s\036\307\000\000"
+ "\260S\315bE\037\000\000o6\344m\307!\000\000\3046\333n\000\000\000\000_V\345"
+ "b\000\000\000\000\216\030*wE\037\000\000\177\026\343x\000\000\000\000\216"
+ "\030*w\273\340\000\000o6\344m9\336\000\000\260S\315b\273\340\000\000,a6'"
+ "\005\270\000\000&t\232\042\275\330\000\000\323]\032\026\267\260\000\000\353"
+ "r\347\021\301\324\000\000\364y\200\020\000\000\000\000yz\021!\000\000\000"
+ "\000MYn\003{\252\000\000\217R\360\357\241\247\000\000bj\315\354\314\317\000"
+ "\000;p\267\377Z\321\000\000Sr\301\353\000\000\000\000\337wz\376\000\000\000"
+ "\000bj\315\35440\000\000\217R\360\357_X\000\000MYn\003\205U\000\000;p\267"
+ "\377\246.\000\000\323]\032\026IO\000\000\353r\347\021\077+\000\000&t\232"
+ "\042C'\000\000,a6'\373G\000\000\012\326\004I\005\270\000\000\251\365UAd\244"
+ "\000\000\037\303\3454\267\260\000\000H\346\345-\030\233\000\000y\020\177"
+ "%\342\223\000\000\233\033\0358\330\235\000\000(\261\252\036{\252\000\000"
+ "\326\243\357\006\241\247\000\000\214\313\265\001\207\217\000\000_\327z\030"
+ "(\223\000\0003\373o\373~\207\000\000:\005\014\021a\213\000\000\0263\237\011"
+ "(\223\000\000\331**\365\207\217\000\000\252:\031\035\030\233\000\000\215"
+ "A\345.d\244\000\000\251\365UA\234[\000\000\012\326\004I\373G\000\000\233"
+ "\033\0358(b\000\000y\020\177%\036l\000\000H\346\345-\350d\000\000\037\303"
+ "\3454IO\000\000\215A\345.\234[\000\000\252:\031\035\350d\000\000\331**\365"
+ "yp\000\000\0263\237\011\330l\000\0003\373o\373\202x\000\000:\005\014\021"
+ "\237t\000\000\214\313\265\001yp\000\000\326\243\357\006_X\000\000(\261\252"
+ "\036\205U\000\000_\327z\030\330l\000\000\021\303\240M\275\330\000\000\276"
+ "\274)O\000\000\000\000\376\246~:\000\000\000\000\006\256\0309\301\324\000"
+ "\000\021\303\240MC'\000\000\006\256\0309\077+\000\000\003\214\022\01240\000"
+ "\000:\232a\042\246.\000\000\022\204\035\013\000\000\000\000\225\222\236#"
+ "\000\000\000\000\003\214\022\012\314\317\000\000:\232a\042Z\321\000\000\235"
+ "\246\042\254\024\276\000\000\206\304\077\253\031\254\000\000\227\303\323"
+ "\275d\244\000\000\373\242\232\277\005\270\000\000k\350.\252\033\246\000\000"
+ "\270\352\262\273\330\235\000\000Y\356\300\317\342\223\000\000U\3036\323\030"
+ "\233\000\000|\237\031\326\267\260\000\0008*:\250\024\276\000\000v2\311\267"
+ "\005\270\000\000\332\021\220\271d\244\000\000O\014\035\251\031\254\000\000"
+ "7=f\311\267\260\000\000^\031I\314\030\233\000\000\216H[\334{\252\000\000"
+ "\375!o\340(\223\000\000\265\363U\345a\213\000\000\334\236O\356{\252\000\000"
+ "m\305:\352(\223\000\000j\217\253\300\275\330\000\000\253\224\253\254\013"
+ "\334\000\000\371\211\324\327\301\324\000\000\316\202h\330\000\000\000\000"
+ "\344\210\006\301\000\000\000\000\260\216\330\254\000\000\000\000\270\207"
+ "\302\360Z\321\000\000\001\200\223\361\000\000\000\000\334\236O\356\205U\000"
+ "\000\270\207\302\360\246.\000\000|\237\031\326IO\000\000\371\211\324\327"
+ "\077+\000\000\235\246\042\254\354A\000\000\253\224\253\254\365#\000\000j"
+ "\217\253\300C'\000\000\373\242\232\277\373G\000\000\227\303\323\275\234["
+ "\000\000\206\304\077\253\347S\000\000U\3036\323\350d\000\000Y\356\300\317"
+ "\036l\000\000\270\352\262\273(b\000\000k\350.\252\345Y\000\000m\305:\352"
+ "\330l\000\000\265\363U\345\237t\000\000\216H[\334\205U\000\000\375!o\340"
+ "\330l\000\0007=f\311IO\000\000^\031I\314\350d\000\0008*:\250\354A\000\000"
+ "O\014\035\251\347S\000\000\332\021\220\271\234[\000\000v2\311\267\373G\000"
+ "\000\007F\270\266C'\000\000+<\261\247\365#\000\000\271R\253\307\077+\000"
+ "\000\345Y\027\307\000\000\000\000\215L]\266\000\000\000\000&B\204\247\000"
+ "\000\000\000\262_\350\331\246.\000\000ig\027\331\000\000\000\000\262_\350"
+ "\331Z\321\000\000\271R\253\307\301\324\000\000+<\261\247\013\334\000\000"
+ "\007F\270\266\275\330\000\000j&o\233n\077\000\000\26479\233\231\042\000\000"
+ "w='\233\000\000\000\000\3319K\221\000\000\000\00074k\221P!\000\000r#\223"
+ "\221\035=\000\000j&o\233\222\300\000\000\26479\233g\335\000\000r#\223\221"
+ "\343\302\000\00074k\221\260\336\000\000\010\026;\207\026\320\000\000\000"
+ "\037\256\205~\343\000\000L-d\212\304\341\000\000\264\035\317\212i\310\000"
+ "\000x#\352\204\000\000\000\000\2472\370\211\000\000\000\000\010\026;\207"
+ "\352/\000\000\264\035\317\212\2277\000\000L-d\212<\036\000\000\000\037\256"
+ "\205\202\034\000\000\233\011\312\233F\257\000\000\011\3477\234\202\251\000"
+ "\000X\346\217\221{\254\000\000\247\007\217\221\035\262\000\000\250\247\000"
+ "\235\222\300\000\000w\304\244\234F\257\000\000\077\251\367\221\343\302\000"
+ "\000\012\305\306\221\035\262\000\0003\266;\207\026\320\000\000\234\311\256"
+ "\205\036\307\000\000\341\307d\212\322\270\000\000\207\256\317\212i\310\000"
+ "\000\035\346\352\204\245\302\000\000\035\346\370\211w\263\000\000Y\004d\212"
+ "\322\270\000\000\237\002\256\205\036\307\000\000_\2266\235g\335\000\000\234"
+ "\220H\235\000\000\000\000\330\222\324\221\000\000\000\000y\230\352\221\260"
+ "\336\000\000\250\247\000\235n\077\000\000_\2266\235\231\042\000\000\077\251"
+ "\367\221\035=\000\000y\230\352\221P!\000\0003\266;\207\352/\000\000;\255"
+ "\256\205\202\034\000\000\357\236d\212<\036\000\000\207\256\317\212\2277\000"
+ "\000\302\250\352\204\000\000\000\000\224\231\370\211\000\000\000\000\357"
+ "\236d\212\304\341\000\000;\255\256\205~\343\000\000w\304\244\234\272P\000"
+ "\000\011\3477\234~V\000\000X\346\217\221\205S\000\000\012\305\306\221\343"
+ "M\000\000\233\011\312\233\272P\000\000\247\007\217\221\343M\000\000\237\002"
+ "\256\205\3428\000\000Y\004d\212.G\000\000\035\346\352\204[=\000\000\035\346"
+ "\370\211\211L\000\000\341\307d\212.G\000\000\234\311\256\205\3428\000\000"
+ "c\005\324\202\273\340\000\000\035\346\337\2019\336\000\000\035\346\332\200"
+ "\000\000\000\000\344\007\337\201\000\000\000\000\330\306\324\202\273\340"
+ "\000\000W\304\337\201\000\000\000\000\330\306\324\202E\037\000\000\035\346"
+ "\337\201\307!\000\000c\005\324\202E\037\000\000}\303u\331n\321z\302j\353"
+ "j\353g\030r+hJB\376A\373P\357X\3665\027T\015*F+K;6052MG89UJOID4T\042\017"
+ "%\010\010\036\010\027\020(#\035\357%\335+\330&\355 \3403\3672\014_\025W\010"
+ "K\372S\034O\025B$J\0426\3150\307-\275<\2707\305D\320<\261L\254\134\247W\256"
+ "F\264_\275O s\031p\336q\324y\012u\340_\362]\017f\246n\241lawhwWo\263vwZp"
+ "]b\1345[I]0c=j4w(j$S\036Y!^'X\030_\032e g&a,[tB~\336wB|\334x\371y\372{\277"
+ "l\263b\304q\323Y\332l\355C\3432\355>\374R\362=\010[\375]\377=\013\261]\255"
+ "p\257[\253n\134xZv\246S\221K\214a\241i\177\201ezt^s\237j_h^\361,\3360\011"
+ "%\007#\357*\334.!\027 \025\036\364!\013\000\000\005\032\342\013\314\020\324"
+ "%\352 \270M\302A\300\077\266J\3167\3135\272\031\303,\243\042\2718\2329\255"
+ "B\227\266\227\236\237\234\232\265\242\202\251\203\247\204\235\235\224\270"
+ "\134\256U\252W\227`\232V\252X\226]\256a\231\234\204\204\303\220\242\231\315"
+ "\223\321\223\322\227\352\235\344\224\355\201\042\204\375\276\375\243\000"
+ "\311\355\257\356\313\352\260\356\264\350\314\347\345\342\343\352\344\344"
+ "\375\332\376\330\377\337\337\361\375\345-\336\030\342)\327\025\331-\335\031"
+ "\341\026\330)\326:\322B\333:\321G\310I\312V\327=\326K\314U\276P\273Z\303"
+ "Q\2732\346H\343\134\335H\311=\324-\333e\263b\311Z\256S\276%\224\035\2245"
+ "\250>\240\032\2331\262\023\246\037\277'\266\023\236f\234\233\201\261\203"
+ "U\227\220\271\225\236\240\261\253\232\333\224\343\213\312\220\300\241\032"
+ "\201\316\2016\217\035\213\220\323\224\355\261\320\246\303\310\361\256\361"
+ "\320\341\276\333\355\246\355\236\330\270\340\301\346\233\315\264\311\251"
+ "\343\224\343\354\000\346\376\320\347\326\033\347\026\326\012\236\016\267"
+ "\000\233\000\263\361\267\366\236\022\212\012\201\000\201\012\213\356\212"
+ "\366\213\367\223\000\213\011\223\000\000\001\000\002\000\000\000\002\000"
+ "\003\000\004\000\005\000\002\000\004\000\002\000\001\000\005\000\006\000"
+ "\007\000\007\000\002\000\005\000\007\000\010\000\003\000\003\000\002\000"
+ "\007\000\011\000\012\000\013\000\011\000\013\000\014\000\012\000\015\000"
+ "\016\000\016\000\013\000\012\000\016\000\006\000\005\000\005\000\013\000"
+ "\016\000\004\000\014\000\013\000\004\000\013\000\005\000\017\000\020\000"
+ "\021\000\017\000\021\000\022\000\023\000\024\000\021\000\023\000\021\000"
+ "\020\000\006\000\016\000\021\000\006\000\021\000\024\000\016\000\015\000"
+ "\022\000\022\000\021\000\016\000\025\000\026\000\027\000\025\000\027\000"
+ "\030\000\026\000\010\000\007\000\007\000\027\000\026\000\006\000\024\000"
+ "\027\000\006\000\027\000\007\000\023\000\030\000\027\000\023\000\027\000"
+ "\024\000\011\000\031\000\032\000\011\000\032\000\012\000\031\000\033\000"
+ "\034\000\034\000\032\000\031\000\035\000\036\000\032\000\035\000\032\000"
+ "\034\000\015\000\012\000\032\000\015\000\032\000\036\000\037\000 \000!\000"
+ "!\000\042\000\037\000#\000$\000\042\000#\000\042\000!\000$\000\035\000\034"
+ "\000\034\000\042\000$\000\033\000\037\000\042\000\033\000\042\000\034\000"
+ "%\000&\000'\000%\000'\000(\000&\000)\000*\000*\000'\000&\000\035\000$\000"
+ "'\000\035\000'\000*\000$\000#\000(\000(\000'\000$\000+\000\017\000\022\000"
+ "\022\000,\000+\000\015\000\036\000,\000\015\000,\000\022\000\035\000*\000"
+ ",\000\035\000,\000\036\000)\000+\000,\000)\000,\000*\000!\000 \000-\000-"
+ "\000.\000!\000/\0000\000.\000/\000.\000-\0000\0001\0002\0002\000.\0000\000"
+ "#\000!\000.\000#\000.\0002\0003\0004\0005\0005\0006\0003\0007\0008\0006\000"
+ "7\0006\0005\0008\0001\0000\0000\0006\0008\000/\0003\0006\000/\0006\0000\000"
+ "9\000:\000;\0009\000;\000<\000=\000>\000;\000=\000;\000:\000>\0001\0008\000"
+ "8\000;\000>\0007\000<\000;\0007\000;\0008\000%\000(\000\077\000%\000\077"
+ "\000@\000#\0002\000\077\000#\000\077\000(\0002\0001\000>\000>\000\077\000"
+ "2\000=\000@\000\077\000=\000\077\000>\0005\0004\000A\000A\000B\0005\000C"
+ "\000D\000B\000C\000B\000A\000D\000E\000F\000F\000B\000D\0007\0005\000B\000"
+ "7\000B\000F\000\000\000\003\000G\000\000\000G\000H\000\010\000I\000G\000"
+ "\010\000G\000\003\000E\000D\000G\000E\000G\000I\000D\000C\000H\000H\000G"
+ "\000D\000\026\000\025\000J\000J\000K\000\026\000L\000M\000K\000L\000K\000"
+ "J\000E\000I\000K\000E\000K\000M\000\010\000\026\000K\000\010\000K\000I\000"
+ "9\000<\000N\0009\000N\000O\000<\0007\000F\000F\000N\000<\000E\000M\000N\000"
+ "E\000N\000F\000M\000L\000O\000O\000N\000M\000\017\000+\000P\000\017\000P"
+ "\000\020\000+\000)\000Q\000Q\000P\000+\000R\000S\000P\000R\000P\000Q\000"
+ "S\000\023\000\020\000\020\000P\000S\000%\000@\000T\000%\000T\000&\000@\000"
+ "=\000U\000U\000T\000@\000R\000Q\000T\000R\000T\000U\000Q\000)\000&\000&\000"
+ "T\000Q\0009\000O\000V\0009\000V\000:\000O\000L\000W\000W\000V\000O\000R\000"
+ "U\000V\000R\000V\000W\000U\000=\000:\000:\000V\000U\000\025\000\030\000X"
+ "\000\025\000X\000J\000\030\000\023\000S\000S\000X\000\030\000R\000W\000X"
+ "\000R\000X\000S\000W\000L\000J\000J\000X\000W\000\000\000Y\000Z\000\000\000"
+ "Z\000\001\000Y\000[\000\134\000\134\000Z\000Y\000]\000^\000Z\000]\000Z\000"
+ "\134\000^\000\004\000\001\000\001\000Z\000^\000_\000`\000a\000a\000b\000"
+ "_\000c\000d\000b\000c\000b\000a\000d\000]\000\134\000\134\000b\000d\000["
+ "\000_\000b\000[\000b\000\134\000e\000f\000g\000g\000h\000e\000i\000j\000"
+ "h\000i\000h\000g\000j\000]\000d\000d\000h\000j\000c\000e\000h\000c\000h\000"
+ "d\000\011\000\014\000k\000\011\000k\000l\000\014\000\004\000^\000^\000k\000"
+ "\014\000]\000j\000k\000]\000k\000^\000j\000i\000l\000l\000k\000j\0004\000"
+ "m\000n\0004\000n\000A\000m\000o\000p\000p\000n\000m\000q\000r\000n\000q\000"
+ "n\000p\000r\000C\000A\000A\000n\000r\000s\000t\000u\000u\000v\000s\000w\000"
+ "x\000v\000w\000v\000u\000x\000q\000p\000p\000v\000x\000o\000s\000v\000o\000"
+ "v\000p\000`\000_\000y\000`\000y\000z\000_\000[\000{\000{\000y\000_\000q\000"
+ "x\000y\000q\000y\000{\000x\000w\000z\000z\000y\000x\000Y\000\000\000H\000"
+ "H\000|\000Y\000C\000r\000|\000C\000|\000H\000r\000q\000{\000{\000|\000r\000"
+ "[\000Y\000|\000[\000|\000{\000 \000\037\000}\000 \000}\000~\000\037\000\033"
+ "\000\177\000\177\000}\000\037\000\200\000\201\000}\000\200\000}\000\177\000"
+ "\201\000\202\000~\000~\000}\000\201\000\031\000\011\000l\000l\000\203\000"
+ "\031\000i\000\204\000\203\000i\000\203\000l\000\204\000\200\000\177\000\177"
+ "\000\203\000\204\000\033\000\031\000\203\000\033\000\203\000\177\000f\000"
+ "\205\000\206\000f\000\206\000g\000\205\000\207\000\210\000\210\000\206\000"
+ "\205\000\200\000\204\000\206\000\200\000\206\000\210\000\204\000i\000g\000"
+ "g\000\206\000\204\000\211\000\212\000\213\000\213\000\214\000\211\000\202"
+ "\000\201\000\214\000\202\000\214\000\213\000\201\000\200\000\210\000\210"
+ "\000\214\000\201\000\207\000\211\000\214\000\207\000\214\000\210\000m\000"
+ "4\0003\0003\000\215\000m\000/\000\216\000\215\000/\000\215\0003\000\216\000"
+ "\217\000\220\000\220\000\215\000\216\000o\000m\000\215\000o\000\215\000\220"
+ "\000-\000 \000~\000~\000\221\000-\000\202\000\222\000\221\000\202\000\221"
+ "\000~\000\222\000\217\000\216\000\216\000\221\000\222\000/\000-\000\221\000"
+ "/\000\221\000\216\000\213\000\212\000\223\000\223\000\224\000\213\000\225"
+ "\000\226\000\224\000\225\000\224\000\223\000\226\000\217\000\222\000\222"
+ "\000\224\000\226\000\222\000\202\000\213\000\213\000\224\000\222\000\227"
+ "\000t\000s\000s\000\230\000\227\000s\000o\000\220\000\220\000\230\000s\000"
+ "\220\000\217\000\226\000\226\000\230\000\220\000\225\000\227\000\230\000"
+ "\225\000\230\000\226\000\231\000\232\000\233\000\231\000\233\000\234\000"
+ "\235\000\236\000\233\000\235\000\233\000\232\000\236\000\237\000\240\000"
+ "\240\000\233\000\236\000\240\000\241\000\234\000\234\000\233\000\240\000"
+ "\242\000\243\000\244\000\242\000\244\000\245\000\243\000\246\000\247\000"
+ "\247\000\244\000\243\000\237\000\236\000\244\000\237\000\244\000\247\000"
+ "\236\000\235\000\245\000\245\000\244\000\236\000\250\000`\000z\000z\000\251"
+ "\000\250\000w\000\252\000\251\000w\000\251\000z\000\252\000\237\000\247\000"
+ "\247\000\251\000\252\000\246\000\250\000\251\000\246\000\251\000\247\000"
+ "t\000\253\000\254\000t\000\254\000u\000\241\000\240\000\254\000\241\000\254"
+ "\000\253\000\237\000\252\000\254\000\237\000\254\000\240\000\252\000w\000"
+ "u\000u\000\254\000\252\000\231\000\234\000\255\000\231\000\255\000\256\000"
+ "\234\000\241\000\257\000\257\000\255\000\234\000\260\000\261\000\255\000"
+ "\260\000\255\000\257\000\261\000\262\000\256\000\256\000\255\000\261\000"
+ "\253\000t\000\227\000\227\000\263\000\253\000\225\000\264\000\263\000\225"
+ "\000\263\000\227\000\264\000\260\000\257\000\257\000\263\000\264\000\241"
+ "\000\253\000\263\000\241\000\263\000\257\000\223\000\212\000\265\000\265"
+ "\000\266\000\223\000\267\000\270\000\266\000\267\000\266\000\265\000\270"
+ "\000\260\000\264\000\264\000\266\000\270\000\225\000\223\000\266\000\225"
+ "\000\266\000\264\000\271\000\272\000\273\000\271\000\273\000\274\000\272"
+ "\000\262\000\261\000\261\000\273\000\272\000\260\000\270\000\273\000\260"
+ "\000\273\000\261\000\270\000\267\000\274\000\274\000\273\000\270\000\271"
+ "\000\274\000\275\000\271\000\275\000\276\000\274\000\267\000\277\000\277"
+ "\000\275\000\274\000\277\000\300\000\301\000\301\000\275\000\277\000\302"
+ "\000\276\000\275\000\302\000\275\000\301\000\212\000\211\000\303\000\212"
+ "\000\303\000\265\000\211\000\207\000\304\000\304\000\303\000\211\000\300"
+ "\000\277\000\303\000\300\000\303\000\304\000\267\000\265\000\303\000\267"
+ "\000\303\000\277\000\205\000f\000\305\000\305\000\306\000\205\000\307\000"
+ "\310\000\306\000\307\000\306\000\305\000\310\000\300\000\304\000\304\000"
+ "\306\000\310\000\207\000\205\000\306\000\207\000\306\000\304\000\311\000"
+ "\312\000\313\000\311\000\313\000\314\000\312\000\302\000\301\000\301\000"
+ "\313\000\312\000\300\000\310\000\313\000\300\000\313\000\301\000\310\000"
+ "\307\000\314\000\314\000\313\000\310\000\311\000\314\000\315\000\311\000"
+ "\315\000\316\000\314\000\307\000\317\000\317\000\315\000\314\000\320\000"
+ "\321\000\315\000\320\000\315\000\317\000\321\000\322\000\316\000\316\000"
+ "\315\000\321\000\305\000f\000e\000e\000\323\000\305\000c\000\324\000\323"
+ "\000c\000\323\000e\000\324\000\320\000\317\000\317\000\323\000\324\000\307"
+ "\000\305\000\323\000\307\000\323\000\317\000a\000`\000\250\000\250\000\325"
+ "\000a\000\246\000\326\000\325\000\246\000\325\000\250\000\326\000\320\000"
+ "\324\000\324\000\325\000\326\000c\000a\000\325\000c\000\325\000\324\000\242"
+ "\000\327\000\330\000\242\000\330\000\243\000\327\000\322\000\321\000\321"
+ "\000\330\000\327\000\320\000\326\000\330\000\320\000\330\000\321\000\326"
+ "\000\246\000\243\000\243\000\330\000\326\000\331\000\311\000\316\000\316"
+ "\000\332\000\331\000\322\000\333\000\332\000\322\000\332\000\316\000\333"
+ "\000\334\000\335\000\335\000\332\000\333\000\336\000\331\000\332\000\336"
+ "\000\332\000\335\000\327\000\242\000\337\000\337\000\340\000\327\000\341"
+ "\000\342\000\340\000\341\000\340\000\337\000\342\000\334\000\333\000\333"
+ "\000\340\000\342\000\322\000\327\000\340\000\322\000\340\000\333\000\343"
+ "\000\344\000\345\000\343\000\345\000\346\000\347\000\350\000\345\000\347"
+ "\000\345\000\344\000\334\000\342\000\345\000\334\000\345\000\350\000\342"
+ "\000\341\000\346\000\346\000\345\000\342\000\351\000\352\000\353\000\351"
+ "\000\353\000\354\000\352\000\336\000\335\000\335\000\353\000\352\000\334"
+ "\000\350\000\353\000\334\000\353\000\335\000\347\000\354\000\353\000\347"
+ "\000\353\000\350\000\337\000\242\000\245\000\245\000\355\000\337\000\235"
+ "\000\356\000\355\000\235\000\355\000\245\000\356\000\357\000\360\000\360"
+ "\000\355\000\356\000\341\000\337\000\355\000\341\000\355\000\360\000\232"
+ "\000\231\000\361\000\361\000\362\000\232\000\363\000\364\000\362\000\363"
+ "\000\362\000\361\000\357\000\356\000\362\000\357\000\362\000\364\000\356"
+ "\000\235\000\232\000\232\000\362\000\356\000\365\000\366\000\367\000\365"
+ "\000\367\000\370\000\371\000\372\000\367\000\371\000\367\000\366\000\357"
+ "\000\364\000\367\000\357\000\367\000\372\000\364\000\363\000\370\000\370"
+ "\000\367\000\364\000\343\000\346\000\373\000\343\000\373\000\374\000\346"
+ "\000\341\000\360\000\360\000\373\000\346\000\357\000\372\000\373\000\357"
+ "\000\373\000\360\000\371\000\374\000\373\000\371\000\373\000\372\000\361"
+ "\000\231\000\256\000\256\000\375\000\361\000\262\000\376\000\375\000\262"
+ "\000\375\000\256\000\376\000\377\000\000\001\000\001\375\000\376\000\363"
+ "\000\361\000\375\000\363\000\375\000\000\001\272\000\271\000\001\001\001"
+ "\001\002\001\272\000\003\001\004\001\002\001\003\001\002\001\001\001\004"
+ "\001\377\000\376\000\376\000\002\001\004\001\262\000\272\000\002\001\262"
+ "\000\002\001\376\000\005\001\006\001\007\001\005\001\007\001\010\001\011"
+ "\001\012\001\007\001\011\001\007\001\006\001\377\000\004\001\007\001\377"
+ "\000\007\001\012\001\004\001\003\001\010\001\010\001\007\001\004\001\365"
+ "\000\370\000\013\001\365\000\013\001\014\001\370\000\363\000\000\001\000"
+ "\001\013\001\370\000\377\000\012\001\013\001\377\000\013\001\000\001\011"
+ "\001\014\001\013\001\011\001\013\001\012\001\001\001\271\000\276\000\276"
+ "\000\015\001\001\001\276\000\302\000\016\001\016\001\015\001\276\000\017"
+ "\001\020\001\015\001\017\001\015\001\016\001\003\001\001\001\015\001\003"
+ "\001\015\001\020\001\312\000\311\000\331\000\331\000\021\001\312\000\336"
+ "\000\022\001\021\001\336\000\021\001\331\000\022\001\017\001\016\001\016"
+ "\001\021\001\022\001\302\000\312\000\021\001\302\000\021\001\016\001\351"
+ "\000\023\001\024\001\351\000\024\001\352\000\025\001\026\001\024\001\025"
+ "\001\024\001\023\001\017\001\022\001\024\001\017\001\024\001\026\001\022"
+ "\001\336\000\352\000\352\000\024\001\022\001\005\001\010\001\027\001\005"
+ "\001\027\001\030\001\010\001\003\001\020\001\020\001\027\001\010\001\017"
+ "\001\026\001\027\001\017\001\027\001\020\001\025\001\030\001\027\001\025"
+ "\001\027\001\026\001\343\000\374\000\031\001\343\000\031\001\344\000\374"
+ "\000\371\000\032\001\032\001\031\001\374\000\033\001\034\001\031\001\033"
+ "\001\031\001\032\001\034\001\347\000\344\000\344\000\031\001\034\001\365"
+ "\000\014\001\035\001\365\000\035\001\366\000\014\001\011\001\036\001\036"
+ "\001\035\001\014\001\033\001\032\001\035\001\033\001\035\001\036\001\032"
+ "\001\371\000\366\000\366\000\035\001\032\001\005\001\030\001\037\001\005"
+ "\001\037\001\006\001\030\001\025\001 \001 \001\037\001\030\001\033\001\036"
+ "\001\037\001\033\001\037\001 \001\036\001\011\001\006\001\006\001\037\001"
+ "\036\001\351\000\354\000!\001\351\000!\001\023\001\354\000\347\000\034\001"
+ "\034\001!\001\354\000\033\001 \001!\001\033\001!\001\034\001 \001\025\001"
+ "\023\001\023\001!\001 \001\000\000\001\000\001\000\002\000\000\000\002\000"
+ "\002\000\003\000\000\000\003\000\004\000\005\000\002\000\005\000\002\000"
+ "\004\000\001\000\004\000\005\000\006\000\006\000\007\000\005\000\007\000"
+ "\002\000\007\000\007\000\010\000\003\000\010\000\003\000\007\000\011\000"
+ "\012\000\012\000\013\000\011\000\013\000\013\000\014\000\011\000\014\000"
+ "\012\000\015\000\015\000\016\000\012\000\016\000\013\000\016\000\006\000"
+ "\016\000\005\000\016\000\005\000\013\000\004\000\014\000\004\000\013\000"
+ "\017\000\020\000\020\000\021\000\017\000\021\000\021\000\022\000\017\000"
+ "\022\000\023\000\024\000\021\000\024\000\021\000\023\000\020\000\023\000"
+ "\016\000\021\000\006\000\021\000\006\000\024\000\015\000\022\000\016\000"
+ "\022\000\025\000\026\000\026\000\027\000\025\000\027\000\027\000\030\000"
+ "\025\000\030\000\010\000\026\000\007\000\026\000\007\000\027\000\024\000"
+ "\027\000\006\000\027\000\023\000\030\000\023\000\027\000\011\000\031\000"
+ "\031\000\032\000\011\000\032\000\012\000\032\000\031\000\033\000\033\000"
+ "\034\000\031\000\034\000\032\000\034\000\035\000\036\000\032\000\036\000"
+ "\032\000\035\000\034\000\035\000\015\000\032\000\015\000\036\000\037\000"
+ " \000 \000!\000\037\000!\000!\000\042\000\037\000\042\000#\000$\000\042\000"
+ "$\000\042\000#\000!\000#\000\035\000$\000\034\000$\000\034\000\042\000\033"
+ "\000\037\000\033\000\042\000%\000&\000&\000'\000%\000'\000'\000(\000%\000"
+ "(\000&\000)\000)\000*\000&\000*\000'\000*\000$\000'\000\035\000'\000\035"
+ "\000*\000#\000(\000$\000(\000\017\000+\000\022\000+\000\022\000,\000+\000"
+ ",\000\036\000,\000\015\000,\000*\000,\000\035\000,\000)\000+\000)\000,\000"
+ " \000-\000!\000-\000-\000.\000!\000.\000/\0000\000.\0000\000.\000/\000-\000"
+ "/\0000\0001\0001\0002\0000\0002\000.\0002\000#\000.\000#\0002\0003\0004\000"
+ "4\0005\0003\0005\0005\0006\0003\0006\0007\0008\0006\0008\0006\0007\0005\000"
+ "7\0001\0008\0000\0008\0000\0006\000/\0003\000/\0006\0009\000:\000:\000;\000"
+ "9\000;\000;\000<\0009\000<\000=\000>\000;\000>\000;\000=\000:\000=\0001\000"
+ ">\0008\000>\0008\000;\0007\000<\0007\000;\000(\000\077\000%\000\077\000\077"
+ "\000@\000%\000@\0002\000\077\000#\000\077\0002\000>\000>\000\077\000=\000"
+ "@\000=\000\077\0004\000A\0005\000A\000A\000B\0005\000B\000C\000D\000B\000"
+ "D\000B\000C\000A\000C\000D\000E\000E\000F\000D\000F\000B\000F\0007\000B\000"
+ "7\000F\000\003\000G\000\000\000G\000G\000H\000\000\000H\000\010\000I\000"
+ "G\000I\000\010\000G\000D\000G\000E\000G\000E\000I\000C\000H\000D\000H\000"
+ "\025\000J\000\026\000J\000J\000K\000\026\000K\000L\000M\000K\000M\000K\000"
+ "L\000J\000L\000I\000K\000E\000K\000E\000M\000\010\000K\000<\000N\0009\000"
+ "N\000N\000O\0009\000O\000<\000F\000F\000N\000M\000N\000E\000N\000L\000O\000"
+ "M\000O\000+\000P\000\017\000P\000\020\000P\000)\000Q\000+\000Q\000P\000Q"
+ "\000R\000S\000P\000S\000P\000R\000Q\000R\000\023\000S\000\020\000S\000@\000"
+ "T\000%\000T\000&\000T\000=\000U\000@\000U\000T\000U\000Q\000T\000R\000T\000"
+ "R\000U\000&\000Q\000O\000V\0009\000V\000:\000V\000L\000W\000O\000W\000V\000"
+ "W\000U\000V\000R\000V\000R\000W\000:\000U\000\030\000X\000\025\000X\000J"
+ "\000X\000\030\000S\000S\000X\000W\000X\000R\000X\000J\000W\000\000\000Y\000"
+ "Y\000Z\000\000\000Z\000\001\000Z\000Y\000[\000[\000\134\000Y\000\134\000"
+ "Z\000\134\000]\000^\000Z\000^\000Z\000]\000\134\000]\000\004\000^\000\001"
+ "\000^\000_\000`\000`\000a\000_\000a\000a\000b\000_\000b\000c\000d\000b\000"
+ "d\000b\000c\000a\000c\000]\000d\000\134\000d\000\134\000b\000[\000_\000["
+ "\000b\000e\000f\000f\000g\000e\000g\000g\000h\000e\000h\000i\000j\000h\000"
+ "j\000h\000i\000g\000i\000]\000j\000d\000j\000d\000h\000c\000e\000c\000h\000"
+ "\014\000k\000\011\000k\000k\000l\000\011\000l\000\014\000^\000^\000k\000"
+ "j\000k\000]\000k\000i\000l\000j\000l\0004\000m\000m\000n\0004\000n\000A\000"
+ "n\000m\000o\000o\000p\000m\000p\000n\000p\000q\000r\000n\000r\000n\000q\000"
+ "p\000q\000C\000r\000A\000r\000s\000t\000t\000u\000s\000u\000u\000v\000s\000"
+ "v\000w\000x\000v\000x\000v\000w\000u\000w\000q\000x\000p\000x\000p\000v\000"
+ "o\000s\000o\000v\000_\000y\000`\000y\000y\000z\000`\000z\000[\000{\000_\000"
+ "{\000y\000{\000x\000y\000q\000y\000q\000{\000w\000z\000x\000z\000H\000Y\000"
+ "H\000|\000Y\000|\000r\000|\000C\000|\000r\000{\000{\000|\000[\000|\000\037"
+ "\000}\000 \000}\000}\000~\000 \000~\000\033\000\177\000\037\000\177\000}"
+ "\000\177\000\200\000\201\000}\000\201\000}\000\200\000\177\000\200\000\201"
+ "\000\202\000~\000\202\000~\000\201\000\031\000l\000l\000\203\000\031\000"
+ "\203\000i\000\204\000\203\000\204\000i\000\203\000\200\000\204\000\177\000"
+ "\204\000\177\000\203\000\033\000\203\000f\000\205\000\205\000\206\000f\000"
+ "\206\000g\000\206\000\205\000\207\000\207\000\210\000\205\000\210\000\206"
+ "\000\210\000\204\000\206\000\200\000\206\000\200\000\210\000g\000\204\000"
+ "\211\000\212\000\212\000\213\000\211\000\213\000\213\000\214\000\211\000"
+ "\214\000\201\000\214\000\202\000\214\000\202\000\213\000\201\000\210\000"
+ "\210\000\214\000\207\000\211\000\207\000\214\0003\000m\0003\000\215\000m"
+ "\000\215\000/\000\216\000\215\000\216\000/\000\215\000\216\000\217\000\217"
+ "\000\220\000\216\000\220\000\215\000\220\000o\000\215\000o\000\220\000-\000"
+ "~\000~\000\221\000-\000\221\000\202\000\222\000\221\000\222\000\202\000\221"
+ "\000\217\000\222\000\216\000\222\000\216\000\221\000/\000\221\000\212\000"
+ "\223\000\213\000\223\000\223\000\224\000\213\000\224\000\225\000\226\000"
+ "\224\000\226\000\224\000\225\000\223\000\225\000\217\000\226\000\222\000"
+ "\226\000\222\000\224\000\213\000\222\000t\000\227\000s\000\227\000s\000\230"
+ "\000\227\000\230\000s\000\220\000\220\000\230\000\220\000\226\000\226\000"
+ "\230\000\225\000\227\000\225\000\230\000\231\000\232\000\232\000\233\000"
+ "\231\000\233\000\233\000\234\000\231\000\234\000\235\000\236\000\233\000"
+ "\236\000\233\000\235\000\232\000\235\000\236\000\237\000\237\000\240\000"
+ "\236\000\240\000\233\000\240\000\240\000\241\000\234\000\241\000\234\000"
+ "\240\000\242\000\243\000\243\000\244\000\242\000\244\000\244\000\245\000"
+ "\242\000\245\000\243\000\246\000\246\000\247\000\243\000\247\000\244\000"
+ "\247\000\236\000\244\000\237\000\244\000\237\000\247\000\235\000\245\000"
+ "\236\000\245\000`\000\250\000z\000\250\000z\000\251\000\250\000\251\000w"
+ "\000\252\000\251\000\252\000w\000\251\000\237\000\252\000\247\000\252\000"
+ "\247\000\251\000\246\000\250\000\246\000\251\000t\000\253\000\253\000\254"
+ "\000t\000\254\000u\000\254\000\240\000\254\000\241\000\254\000\241\000\253"
+ "\000\252\000\254\000\237\000\254\000u\000\252\000\234\000\255\000\231\000"
+ "\255\000\255\000\256\000\231\000\256\000\241\000\257\000\234\000\257\000"
+ "\255\000\257\000\260\000\261\000\255\000\261\000\255\000\260\000\257\000"
+ "\260\000\261\000\262\000\256\000\262\000\256\000\261\000\227\000\253\000"
+ "\227\000\263\000\253\000\263\000\225\000\264\000\263\000\264\000\225\000"
+ "\263\000\260\000\264\000\257\000\264\000\257\000\263\000\241\000\263\000"
+ "\212\000\265\000\223\000\265\000\265\000\266\000\223\000\266\000\267\000"
+ "\270\000\266\000\270\000\266\000\267\000\265\000\267\000\260\000\270\000"
+ "\264\000\270\000\264\000\266\000\225\000\266\000\271\000\272\000\272\000"
+ "\273\000\271\000\273\000\273\000\274\000\271\000\274\000\262\000\272\000"
+ "\261\000\272\000\261\000\273\000\270\000\273\000\260\000\273\000\267\000"
+ "\274\000\270\000\274\000\274\000\275\000\271\000\275\000\275\000\276\000"
+ "\271\000\276\000\267\000\277\000\274\000\277\000\275\000\277\000\277\000"
+ "\300\000\300\000\301\000\277\000\301\000\275\000\301\000\276\000\302\000"
+ "\275\000\302\000\301\000\302\000\211\000\303\000\212\000\303\000\265\000"
+ "\303\000\207\000\304\000\211\000\304\000\303\000\304\000\277\000\303\000"
+ "\300\000\303\000\300\000\304\000\267\000\303\000f\000\305\000\205\000\305"
+ "\000\305\000\306\000\205\000\306\000\307\000\310\000\306\000\310\000\306"
+ "\000\307\000\305\000\307\000\300\000\310\000\304\000\310\000\304\000\306"
+ "\000\207\000\306\000\311\000\312\000\312\000\313\000\311\000\313\000\313"
+ "\000\314\000\311\000\314\000\302\000\312\000\301\000\312\000\301\000\313"
+ "\000\310\000\313\000\300\000\313\000\307\000\314\000\310\000\314\000\314"
+ "\000\315\000\311\000\315\000\315\000\316\000\311\000\316\000\307\000\317"
+ "\000\314\000\317\000\315\000\317\000\320\000\321\000\315\000\321\000\315"
+ "\000\320\000\317\000\320\000\321\000\322\000\316\000\322\000\316\000\321"
+ "\000e\000\305\000e\000\323\000\305\000\323\000c\000\324\000\323\000\324\000"
+ "c\000\323\000\320\000\324\000\317\000\324\000\317\000\323\000\307\000\323"
+ "\000a\000\250\000\250\000\325\000a\000\325\000\246\000\326\000\325\000\326"
+ "\000\246\000\325\000\320\000\326\000\324\000\326\000\324\000\325\000c\000"
+ "\325\000\242\000\327\000\327\000\330\000\242\000\330\000\243\000\330\000"
+ "\322\000\327\000\321\000\327\000\321\000\330\000\326\000\330\000\320\000"
+ "\330\000\243\000\326\000\311\000\331\000\316\000\331\000\316\000\332\000"
+ "\331\000\332\000\322\000\333\000\332\000\333\000\322\000\332\000\333\000"
+ "\334\000\334\000\335\000\333\000\335\000\332\000\335\000\331\000\336\000"
+ "\332\000\336\000\335\000\336\000\242\000\337\000\327\000\337\000\337\000"
+ "\340\000\327\000\340\000\341\000\342\000\340\000\342\000\340\000\341\000"
+ "\337\000\341\000\334\000\342\000\333\000\342\000\333\000\340\000\322\000"
+ "\340\000\343\000\344\000\344\000\345\000\343\000\345\000\345\000\346\000"
+ "\343\000\346\000\347\000\350\000\345\000\350\000\345\000\347\000\344\000"
+ "\347\000\342\000\345\000\334\000\345\000\334\000\350\000\341\000\346\000"
+ "\342\000\346\000\351\000\352\000\352\000\353\000\351\000\353\000\353\000"
+ "\354\000\351\000\354\000\336\000\352\000\335\000\352\000\335\000\353\000"
+ "\350\000\353\000\334\000\353\000\347\000\354\000\347\000\353\000\245\000"
+ "\337\000\245\000\355\000\337\000\355\000\235\000\356\000\355\000\356\000"
+ "\235\000\355\000\356\000\357\000\357\000\360\000\356\000\360\000\355\000"
+ "\360\000\341\000\355\000\341\000\360\000\231\000\361\000\232\000\361\000"
+ "\361\000\362\000\232\000\362\000\363\000\364\000\362\000\364\000\362\000"
+ "\363\000\361\000\363\000\356\000\362\000\357\000\362\000\357\000\364\000"
+ "\232\000\356\000\365\000\366\000\366\000\367\000\365\000\367\000\367\000"
+ "\370\000\365\000\370\000\371\000\372\000\367\000\372\000\367\000\371\000"
+ "\366\000\371\000\364\000\367\000\357\000\367\000\357\000\372\000\363\000"
+ "\370\000\364\000\370\000\346\000\373\000\343\000\373\000\373\000\374\000"
+ "\343\000\374\000\346\000\360\000\360\000\373\000\372\000\373\000\357\000"
+ "\373\000\371\000\374\000\371\000\373\000\256\000\361\000\256\000\375\000"
+ "\361\000\375\000\262\000\376\000\375\000\376\000\262\000\375\000\376\000"
+ "\377\000\377\000\000\001\376\000\000\001\375\000\000\001\363\000\375\000"
+ "\363\000\000\001\271\000\001\001\272\000\001\001\001\001\002\001\272\000"
+ "\002\001\003\001\004\001\002\001\004\001\002\001\003\001\001\001\003\001"
+ "\377\000\004\001\376\000\004\001\376\000\002\001\262\000\002\001\005\001"
+ "\006\001\006\001\007\001\005\001\007\001\007\001\010\001\005\001\010\001"
+ "\011\001\012\001\007\001\012\001\007\001\011\001\006\001\011\001\004\001"
+ "\007\001\377\000\007\001\377\000\012\001\003\001\010\001\004\001\010\001"
+ "\370\000\013\001\365\000\013\001\013\001\014\001\365\000\014\001\370\000"
+ "\000\001\000\001\013\001\012\001\013\001\377\000\013\001\011\001\014\001"
+ "\011\001\013\001\276\000\001\001\276\000\015\001\001\001\015\001\302\000"
+ "\016\001\276\000\016\001\015\001\016\001\017\001\020\001\015\001\020\001"
+ "\015\001\017\001\016\001\017\001\003\001\015\001\003\001\020\001\312\000"
+ "\331\000\331\000\021\001\312\000\021\001\336\000\022\001\021\001\022\001"
+ "\336\000\021\001\017\001\022\001\016\001\022\001\016\001\021\001\302\000"
+ "\021\001\351\000\023\001\023\001\024\001\351\000\024\001\352\000\024\001"
+ "\025\001\026\001\024\001\026\001\024\001\025\001\023\001\025\001\022\001"
+ "\024\001\017\001\024\001\017\001\026\001\352\000\022\001\010\001\027\001"
+ "\005\001\027\001\027\001\030\001\005\001\030\001\010\001\020\001\020\001"
+ "\027\001\026\001\027\001\017\001\027\001\025\001\030\001\025\001\027\001"
+ "\374\000\031\001\343\000\031\001\344\000\031\001\371\000\032\001\374\000"
+ "\032\001\031\001\032\001\033\001\034\001\031\001\034\001\031\001\033\001"
+ "\032\001\033\001\347\000\034\001\344\000\034\001\014\001\035\001\365\000"
+ "\035\001\366\000\035\001\011\001\036\001\014\001\036\001\035\001\036\001"
+ "\032\001\035\001\033\001\035\001\033\001\036\001\366\000\032\001\030\001"
+ "\037\001\005\001\037\001\006\001\037\001\025\001 \001\030\001 \001\037\001"
+ " \001\036\001\037\001\033\001\037\001\033\001 \001\006\001\036\001\354\000"
+ "!\001\351\000!\001\023\001!\001\354\000\034\001\034\001!\001 \001!\001\033"
+ "\001!\001\023\001 \001"
+;
+const unsigned long s1_2_size = 9892;
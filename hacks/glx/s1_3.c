@@ -1,1733 +1,479 @@
+/* Generated from "s1_3.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.622801,-0.721415,-0.302786,1.219224,0.33452,-0.595444,
-	0.622801,-0.721415,-0.302786,1.219224,0.33452,-0.595444,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.257435,-0.906571,-0.334448,1.188046,0.322006,-0.596277,
-	0.622801,-0.721415,-0.302786,1.219224,0.33452,-0.595444,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.622801,-0.721415,0.302786,1.219224,0.33452,-0.404556,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.622801,-0.721415,0.302786,1.219224,0.33452,-0.404556,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.622801,-0.721415,0.302786,1.219224,0.33452,-0.404556,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.257435,-0.906571,0.334448,1.188046,0.322006,-0.403722,
-	0.301979,-0.953315,0,1.196159,0.308395,-0.5,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.940255,0.325371,0.100277,1.221821,0.401211,-0.4175,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.890812,0.056731,0.450816,1.207091,0.397037,-0.339125,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.992798,-0.119797,0,1.239508,0.345749,-0.5,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.940255,0.325371,0.100277,1.221821,0.401211,-0.4175,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.622801,-0.721415,0.302786,1.219224,0.33452,-0.404556,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.992798,-0.119797,0,1.239508,0.345749,-0.5,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.890812,0.056731,0.450816,1.207091,0.397037,-0.339125,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.974899,-0.059226,0.214627,1.230706,0.358565,-0.4125,
-	0.622801,-0.721415,0.302786,1.219224,0.33452,-0.404556,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.890812,0.056731,-0.450816,1.207091,0.397037,-0.660875,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.940255,0.325371,-0.100277,1.221821,0.401211,-0.5825,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.622801,-0.721415,-0.302786,1.219224,0.33452,-0.595444,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.890812,0.056731,-0.450816,1.207091,0.397037,-0.660875,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.992798,-0.119797,0,1.239508,0.345749,-0.5,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.780431,-0.625241,0,1.227578,0.320768,-0.5,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.622801,-0.721415,-0.302786,1.219224,0.33452,-0.595444,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.940255,0.325371,-0.100277,1.221821,0.401211,-0.5825,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.974899,-0.059226,-0.214627,1.230706,0.358565,-0.5875,
-	0.992798,-0.119797,0,1.239508,0.345749,-0.5,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.202524,-0.691948,0.692959,1.163707,0.362839,-0.323491,
-	0.095842,-0.348455,0.932413,1.123141,0.430895,-0.275352,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	-0.011301,0.717458,0.69651,1.01927,0.677486,-0.324904,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	-0.011301,0.717458,0.69651,1.01927,0.677486,-0.324904,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	-0.162184,0.309455,0.936981,1.025784,0.594229,-0.275352,
-	-0.024646,-0.015417,0.999577,1.074463,0.512562,-0.259306,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	0.73381,0.655202,0.179534,1.066291,0.661627,-0.361333,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	0.83547,0.498022,0.232303,1.141425,0.544887,-0.322437,
-	0.742505,0.410638,0.529209,1.128758,0.537574,-0.2785,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.83547,0.498022,0.232303,1.141425,0.544887,-0.322437,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.742505,0.410638,0.529209,1.128758,0.537574,-0.2785,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	-0.011301,0.717458,0.69651,1.01927,0.677486,-0.324904,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	0.621316,0.565314,0.542574,1.083956,0.612743,-0.294,
-	0.171113,0.465842,0.868165,1.059471,0.609015,-0.276838,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.890812,0.056731,0.450816,1.207091,0.397037,-0.339125,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.890812,0.056731,0.450816,1.207091,0.397037,-0.339125,
-	0.631575,-0.472875,0.614412,1.194861,0.37578,-0.324904,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.890812,0.056731,0.450816,1.207091,0.397037,-0.339125,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.742505,0.410638,0.529209,1.128758,0.537574,-0.2785,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.346195,0.171304,0.92239,1.107591,0.526937,-0.260702,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.484632,-0.165545,0.858911,1.155185,0.444556,-0.276838,
-	0.742505,0.410638,0.529209,1.128758,0.537574,-0.2785,
-	0.83547,0.498022,0.232303,1.141425,0.544887,-0.322437,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.808962,0.235076,0.538813,1.171456,0.461189,-0.294,
-	0.742505,0.410638,0.529209,1.128758,0.537574,-0.2785,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	-0.011301,0.717458,0.69651,1.01927,0.677486,-0.324904,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	-0.323336,0.633934,0.702554,0.985218,0.662285,-0.323491,
-	-0.436203,0.832732,0.341005,0.960879,0.703118,-0.403722,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.0113,0.717458,-0.69651,1.01927,0.677486,-0.675096,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.436203,0.832732,-0.341005,0.960879,0.703118,-0.596277,
-	-0.483417,0.87539,0,0.952766,0.71673,-0.5,
-	0.73381,0.655202,-0.179535,1.066291,0.661627,-0.638667,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	0.73381,0.655202,-0.179535,1.066291,0.661627,-0.638667,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	0.739038,0.673664,0,1.052644,0.698661,-0.5,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	-0.0113,0.717458,-0.69651,1.01927,0.677486,-0.675096,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.442446,0.874241,-0.199863,1.024706,0.715367,-0.5875,
-	-0.079433,0.924124,-0.373745,0.995432,0.719051,-0.595444,
-	0.73381,0.655202,0.179534,1.066291,0.661627,-0.361333,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	0.73381,0.655202,0.179534,1.066291,0.661627,-0.361333,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	-0.011301,0.717458,0.69651,1.01927,0.677486,-0.324904,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	0.499427,0.759449,0.416905,1.046216,0.67568,-0.339125,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	-0.145364,0.989378,0,0.987605,0.733106,-0.5,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	-0.079433,0.924124,0.373745,0.995432,0.719051,-0.404556,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	0.739038,0.673664,0,1.052644,0.698661,-0.5,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.442446,0.874241,0.199863,1.024706,0.715367,-0.4125,
-	0.507297,0.861771,0,1.018008,0.729398,-0.5,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	-0.0113,0.717458,-0.69651,1.01927,0.677486,-0.675096,
-	-0.323336,0.633934,-0.702554,0.985218,0.662285,-0.676509,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	-0.0113,0.717458,-0.69651,1.01927,0.677486,-0.675096,
-	-0.162184,0.309456,-0.936981,1.025784,0.594229,-0.724648,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	0.202525,-0.691948,-0.692959,1.163707,0.362839,-0.676509,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.095842,-0.348454,-0.932413,1.123141,0.430895,-0.724648,
-	-0.024646,-0.015417,-0.999577,1.074463,0.512562,-0.740694,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.890812,0.056731,-0.450816,1.207091,0.397037,-0.660875,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.83547,0.498022,-0.232303,1.141425,0.544887,-0.677562,
-	0.742506,0.410638,-0.529208,1.128758,0.537574,-0.7215,
-	0.742506,0.410638,-0.529208,1.128758,0.537574,-0.7215,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.742506,0.410638,-0.529208,1.128758,0.537574,-0.7215,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	0.631576,-0.472875,-0.614411,1.194861,0.37578,-0.675096,
-	0.890812,0.056731,-0.450816,1.207091,0.397037,-0.660875,
-	0.890812,0.056731,-0.450816,1.207091,0.397037,-0.660875,
-	0.808963,0.235076,-0.538812,1.171456,0.461189,-0.706,
-	0.484632,-0.165544,-0.85891,1.155185,0.444556,-0.723162,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.73381,0.655202,-0.179535,1.066291,0.661627,-0.638667,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	-0.0113,0.717458,-0.69651,1.01927,0.677486,-0.675096,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.499427,0.759449,-0.416905,1.046216,0.67568,-0.660875,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.742506,0.410638,-0.529208,1.128758,0.537574,-0.7215,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.346195,0.171304,-0.92239,1.107591,0.526937,-0.739298,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.171114,0.465842,-0.868165,1.059471,0.609015,-0.723162,
-	0.83547,0.498022,-0.232303,1.141425,0.544887,-0.677562,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.83547,0.498022,-0.232303,1.141425,0.544887,-0.677562,
-	0.621316,0.565314,-0.542574,1.083956,0.612743,-0.706,
-	0.742506,0.410638,-0.529208,1.128758,0.537574,-0.7215,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.930569,0.3071,0.199327,1.204957,0.421449,-0.361333,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.940255,0.325371,0.100277,1.221821,0.401211,-0.4175,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.83547,0.498022,0.232303,1.141425,0.544887,-0.322437,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.890268,0.404155,0.209958,1.180758,0.472333,-0.335375,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.940255,0.325371,0.100277,1.221821,0.401211,-0.4175,
-	0.940255,0.325371,0.100277,1.221821,0.401211,-0.4175,
-	0.900371,0.427755,0.079739,1.1919,0.469528,-0.4095,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.73381,0.655202,0.179534,1.066291,0.661627,-0.361333,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.73381,0.655202,0.179534,1.066291,0.661627,-0.361333,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.739038,0.673664,0,1.052644,0.698661,-0.5,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.737725,0.668365,0.095126,1.057196,0.68635,-0.4175,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.83547,0.498022,0.232303,1.141425,0.544887,-0.322437,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.786313,0.584772,0.199385,1.098258,0.615227,-0.335375,
-	0.820632,0.565867,0.079739,1.1014,0.626279,-0.4095,
-	0.862894,0.498192,0.08496,1.149055,0.549292,-0.40225,
-	0.73381,0.655202,-0.179535,1.066291,0.661627,-0.638667,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.73381,0.655202,-0.179535,1.066291,0.661627,-0.638667,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.83547,0.498022,-0.232303,1.141425,0.544887,-0.677562,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.786313,0.584772,-0.199385,1.098258,0.615227,-0.664625,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.739038,0.673664,0,1.052644,0.698661,-0.5,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	0.737725,0.668365,-0.095126,1.057196,0.68635,-0.5825,
-	0.820632,0.565867,-0.079739,1.1014,0.626279,-0.5905,
-	0.820414,0.57177,0,1.10018,0.633946,-0.5,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.940255,0.325371,-0.100277,1.221821,0.401211,-0.5825,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.930569,0.3071,-0.199328,1.204957,0.421449,-0.638667,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.940255,0.325371,-0.100277,1.221821,0.401211,-0.5825,
-	0.962007,0.273026,0,1.230206,0.391113,-0.5,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.940255,0.325371,-0.100277,1.221821,0.401211,-0.5825,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.866025,0.5,0,1.151611,0.550768,-0.5,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.905374,0.424615,0,1.19793,0.464638,-0.5,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.83547,0.498022,-0.232303,1.141425,0.544887,-0.677562,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.890268,0.404155,-0.209958,1.180758,0.472333,-0.664625,
-	0.900371,0.427755,-0.079739,1.1919,0.469528,-0.5905,
-	0.862894,0.498192,-0.08496,1.149055,0.549292,-0.59775,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.164983,-0.93415,-0.316457,1.139957,0.313586,-0.594444,
-	0.197559,-0.930384,-0.308798,1.077742,0.301825,-0.594388,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.319032,-0.902133,-0.290473,0.93867,0.26597,-0.596525,
-	0.245574,-0.922075,-0.299117,1.008335,0.286145,-0.595338,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.319032,-0.902133,0.290473,0.93867,0.26597,-0.403475,
-	0.303521,-0.952825,0,0.948068,0.255539,-0.5,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.166954,-0.985965,0,1.148052,0.300668,-0.5,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.164983,-0.93415,0.316457,1.139957,0.313586,-0.405556,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.233794,-0.972286,0,1.017091,0.274757,-0.5,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.1906,-0.981668,0,1.086058,0.289628,-0.5,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.19756,-0.930384,0.308798,1.077742,0.301825,-0.405612,
-	0.245574,-0.922075,0.299116,1.008335,0.286145,-0.404662,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.176226,0.307645,-0.935039,0.978052,0.571957,-0.720369,
-	-0.128571,0.348912,-0.928294,0.911431,0.545768,-0.720237,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.168868,0.358367,-0.918181,0.750708,0.474572,-0.725225,
-	-0.132599,0.364183,-0.92184,0.833218,0.513896,-0.722456,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.287838,-0.708745,-0.644073,0.910476,0.29726,-0.676962,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	0.181001,-0.354486,-0.917376,0.863485,0.34941,-0.725225,
-	0.02248,0.015117,-0.999633,0.807096,0.411991,-0.741313,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	0.133481,-0.728232,-0.672207,1.115671,0.352342,-0.673147,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	-0.042028,-0.027931,-0.998726,1.026623,0.494446,-0.736109,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	0.060251,-0.377234,-0.924156,1.075195,0.416935,-0.720369,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	0.026562,0.016059,-0.999518,0.885754,0.44557,-0.738345,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	0.010552,0.00411,-0.999936,0.961325,0.472585,-0.735969,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.180025,-0.723743,-0.666173,1.052796,0.338416,-0.673044,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	0.227251,-0.720523,-0.655136,0.982068,0.320307,-0.674787,
-	0.114557,-0.361315,-0.92538,1.011218,0.399402,-0.720237,
-	0.149984,-0.357133,-0.921933,0.938289,0.377245,-0.722456,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	-0.176226,0.307645,0.935039,0.978052,0.571957,-0.279631,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.128571,0.348912,0.928294,0.911431,0.545768,-0.279763,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	0.133481,-0.728232,0.672206,1.115671,0.352342,-0.326853,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	0.180025,-0.723743,0.666173,1.052796,0.338416,-0.326956,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	0.060251,-0.377234,0.924156,1.075195,0.416935,-0.279631,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	-0.042028,-0.027931,0.998726,1.026623,0.494446,-0.263891,
-	0.114557,-0.361314,0.92538,1.011218,0.399402,-0.279763,
-	0.010552,0.00411,0.999936,0.961325,0.472585,-0.264031,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	0.227251,-0.720523,0.655136,0.982068,0.320307,-0.325213,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.287838,-0.708745,0.644073,0.910476,0.29726,-0.323037,
-	0.181001,-0.354486,0.917376,0.863485,0.34941,-0.274775,
-	0.149984,-0.357133,0.921933,0.938289,0.377245,-0.277544,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	0.026562,0.01606,0.999518,0.885754,0.44557,-0.261655,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	-0.132599,0.364183,0.921839,0.833218,0.513896,-0.277544,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	-0.168868,0.358366,0.918181,0.750708,0.474572,-0.274775,
-	0.02248,0.015118,0.999633,0.807096,0.411991,-0.258687,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	-0.334948,0.636181,-0.695043,0.937575,0.63655,-0.673147,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.440797,0.833329,-0.333557,0.913289,0.675305,-0.594444,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.290177,0.673481,-0.679868,0.869854,0.606754,-0.673044,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.397769,0.859277,-0.321594,0.844907,0.643346,-0.594388,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.334947,0.636181,0.695043,0.937575,0.63655,-0.326853,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.290177,0.673481,0.679868,0.869854,0.606754,-0.326956,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.440797,0.833329,0.333557,0.913289,0.675305,-0.405556,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.456348,0.889801,0,0.905194,0.688224,-0.5,
-	-0.397769,0.859277,0.321594,0.844907,0.643346,-0.405612,
-	-0.427853,0.903848,0,0.836591,0.655543,-0.5,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.308574,0.679683,0.665442,0.789439,0.570833,-0.325213,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.36742,0.660294,0.654992,0.703717,0.526722,-0.323037,
-	-0.487389,0.819353,0.301848,0.675523,0.558012,-0.403475,
-	-0.421194,0.852237,0.310301,0.763171,0.604996,-0.404662,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	-0.308574,0.679683,-0.665442,0.789439,0.570833,-0.674787,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.36742,0.660294,-0.654992,0.703717,0.526722,-0.676962,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.459546,0.888154,0,0.754416,0.616383,-0.5,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.421194,0.852237,-0.310301,0.763171,0.604996,-0.595338,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.487389,0.819353,-0.301848,0.675523,0.558012,-0.596525,
-	-0.532473,0.846447,0,0.666125,0.568442,-0.5,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.317966,0.212815,-0.923909,0.495371,0.238512,-0.720237,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	0.525124,-0.503608,-0.68602,0.752404,0.194475,-0.674787,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.314626,-0.214176,-0.924737,0.656244,0.179386,-0.720237,
-	-0.005469,-0.009402,-0.999941,0.575807,0.208949,-0.735969,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	0.214466,-0.344671,-0.913896,0.793886,0.314845,-0.726748,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	0.525124,-0.503608,-0.68602,0.752404,0.194475,-0.674787,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	0.525124,-0.503608,-0.68602,0.752404,0.194475,-0.674787,
-	0.248581,-0.323271,-0.913074,0.736568,0.272496,-0.725225,
-	0.282948,-0.282367,-0.916629,0.690899,0.226098,-0.722456,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.015914,-0.029529,-0.999437,0.617093,0.264045,-0.738345,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.31459,0.228088,-0.921417,0.543287,0.301992,-0.722456,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	0.003382,-0.001295,-0.999993,0.73254,0.370437,-0.742944,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	-0.231331,0.321253,-0.918304,0.671195,0.426029,-0.726748,
-	-0.288623,0.26748,-0.919321,0.601974,0.3665,-0.725225,
-	-0.014673,-0.023374,-0.999619,0.669271,0.319498,-0.741313,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.610536,0.426181,-0.667544,0.428341,0.263148,-0.673044,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.770954,0.557417,-0.308084,0.388123,0.27793,-0.594388,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.459897,0.603331,-0.651526,0.620074,0.472355,-0.678159,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.716797,0.697282,0,0.501029,0.437003,-0.5,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.5899,0.750266,-0.298526,0.589401,0.500151,-0.597178,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.716797,0.697282,0,0.501029,0.437003,-0.5,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.595775,0.458968,-0.659091,0.481782,0.333615,-0.674787,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.565284,0.537872,-0.625418,0.545894,0.405668,-0.676962,
-	-0.694867,0.675869,-0.245685,0.512245,0.429169,-0.596525,
-	-0.740072,0.600901,-0.302014,0.444878,0.352588,-0.595338,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.716797,0.697282,0,0.501029,0.437003,-0.5,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.5899,0.750266,0.298526,0.589401,0.500151,-0.402822,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.64127,0.767315,0,0.579177,0.509417,-0.5,
-	-0.694867,0.675869,0.245685,0.512245,0.429169,-0.403475,
-	-0.716797,0.697282,0,0.501029,0.437003,-0.5,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.766999,0.641648,0,0.432577,0.358913,-0.5,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.804241,0.594303,0,0.374717,0.282857,-0.5,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.770954,0.557417,0.308084,0.388123,0.27793,-0.405612,
-	-0.740072,0.600901,0.302014,0.444878,0.352588,-0.404662,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	-0.610536,0.426181,0.667544,0.428341,0.263148,-0.326956,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	-0.317966,0.212815,0.923909,0.495371,0.238512,-0.279763,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.459898,0.603331,0.651526,0.620074,0.472355,-0.321841,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.231331,0.321253,0.918304,0.671195,0.426029,-0.273252,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	-0.595775,0.458968,0.659091,0.481782,0.333615,-0.325213,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.565284,0.537872,0.625418,0.545894,0.405668,-0.323037,
-	-0.288623,0.267481,0.919321,0.601974,0.3665,-0.274775,
-	-0.31459,0.228088,0.921417,0.543287,0.301992,-0.277544,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.525124,-0.503609,0.68602,0.752404,0.194475,-0.325213,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	0.525124,-0.503609,0.68602,0.752404,0.194475,-0.325213,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	0.214466,-0.34467,0.913896,0.793886,0.314845,-0.273252,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	0.003382,-0.001295,0.999993,0.73254,0.370437,-0.257056,
-	0.248581,-0.323271,0.913073,0.736568,0.272496,-0.274775,
-	-0.014673,-0.023374,0.999619,0.669271,0.319498,-0.258687,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	-0.015914,-0.029529,0.999437,0.617093,0.264045,-0.261655,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	-0.005469,-0.009402,0.999941,0.575807,0.208949,-0.264031,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	0.525124,-0.503609,0.68602,0.752404,0.194475,-0.325213,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.314626,-0.214176,0.924737,0.656244,0.179386,-0.279763,
-	0.282948,-0.282367,0.916629,0.690899,0.226098,-0.277544,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.525124,-0.503609,0.68602,0.752404,0.194475,-0.325213,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.617578,-0.419693,0.665173,0.723274,0.15475,-0.326956,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.814068,-0.486717,0.316859,0.763492,0.139968,-0.405612,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.37574,-0.67126,0.638928,0.845007,0.268518,-0.321841,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.438584,-0.8515,0.287389,0.875679,0.240722,-0.402822,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.525124,-0.503609,0.68602,0.752404,0.194475,-0.325213,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.473587,-0.60369,0.641306,0.792649,0.233327,-0.323037,
-	0.582001,-0.759448,0.290711,0.826297,0.209826,-0.403475,
-	0.694632,-0.626894,0.352832,0.789307,0.175501,-0.404662,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.37574,-0.67126,-0.638928,0.845007,0.268518,-0.678159,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.525124,-0.503608,-0.68602,0.752404,0.194475,-0.674787,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.473586,-0.60369,-0.641307,0.792649,0.233327,-0.676962,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.419512,-0.90775,0,0.885904,0.231457,-0.5,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.438584,-0.8515,-0.287389,0.875679,0.240722,-0.597178,
-	0.582001,-0.759448,-0.290711,0.826297,0.209826,-0.596525,
-	0.576871,-0.816835,0,0.837513,0.201992,-0.5,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.746099,-0.665835,0,0.801608,0.169177,-0.5,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.881754,-0.47171,0,0.776898,0.135041,-0.5,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.525124,-0.503608,-0.68602,0.752404,0.194475,-0.674787,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	0.617578,-0.419692,-0.665174,0.723274,0.15475,-0.673044,
-	0.814068,-0.486716,-0.31686,0.763492,0.139968,-0.594388,
-	0.694632,-0.626893,-0.352832,0.789307,0.175501,-0.595338,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.894665,-0.298343,0.332514,0.747636,0.105446,-0.405556,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.78946,-0.545462,0.281469,0.731601,0.048967,-0.404556,
-	0.78946,-0.545462,0.281469,0.731601,0.048967,-0.404556,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.903923,-0.26074,0.339026,0.740522,0.074155,-0.403722,
-	0.78946,-0.545462,0.281469,0.731601,0.048967,-0.404556,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.789459,-0.545462,-0.281469,0.731601,0.048967,-0.595444,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.789459,-0.545462,-0.281469,0.731601,0.048967,-0.595444,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.789459,-0.545462,-0.281469,0.731601,0.048967,-0.595444,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.894665,-0.298343,-0.332514,0.747636,0.105446,-0.594444,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.961956,-0.273203,0,0.762094,0.101615,-0.5,
-	0.903923,-0.26074,-0.339025,0.740522,0.074155,-0.596277,
-	0.957991,-0.286797,0,0.755907,0.07093,-0.5,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	0.015839,-0.994833,-0.100277,0.667212,0.026513,-0.5825,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.21248,-0.884802,-0.414701,0.666096,0.041783,-0.660875,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	0.389749,-0.920921,0,0.725378,0.028862,-0.5,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.015839,-0.994833,-0.100277,0.667212,0.026513,-0.5825,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.789459,-0.545462,-0.281469,0.731601,0.048967,-0.595444,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.389749,-0.920921,0,0.725378,0.028862,-0.5,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.21248,-0.884802,-0.414701,0.666096,0.041783,-0.660875,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.33287,-0.922331,-0.196223,0.710325,0.03275,-0.5875,
-	0.789459,-0.545462,-0.281469,0.731601,0.048967,-0.595444,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	0.21248,-0.884802,0.414702,0.666096,0.041783,-0.339125,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.015839,-0.994833,0.100277,0.667212,0.026513,-0.4175,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.78946,-0.545462,0.281469,0.731601,0.048967,-0.404556,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.21248,-0.884802,0.414702,0.666096,0.041783,-0.339125,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.389749,-0.920921,0,0.725378,0.028862,-0.5,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.740764,-0.671765,0,0.747335,0.045755,-0.5,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.78946,-0.545462,0.281469,0.731601,0.048967,-0.404556,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	0.015839,-0.994833,0.100277,0.667212,0.026513,-0.4175,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	0.33287,-0.922331,0.196223,0.710325,0.03275,-0.4125,
-	0.389749,-0.920921,0,0.725378,0.028862,-0.5,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.677454,-0.2664,-0.685629,0.704261,0.116939,-0.673147,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.344586,-0.098997,-0.93352,0.631969,0.136095,-0.720369,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.691984,-0.189259,-0.696663,0.694366,0.083832,-0.676509,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.338241,-0.103362,-0.935366,0.61744,0.099959,-0.724648,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.720224,-0.15594,-0.675988,0.342054,0.121167,-0.675096,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	0.013842,0.059444,-0.998136,0.545218,0.159081,-0.736109,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.304433,0.241938,-0.921296,0.458468,0.182068,-0.720369,
-	-0.317034,0.182994,-0.930593,0.432817,0.138665,-0.724648,
-	0.007661,0.031192,-0.999484,0.525128,0.119312,-0.740694,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.364711,-0.913648,-0.179534,0.369306,0.083596,-0.638667,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	-0.143026,-0.80792,-0.571672,0.507243,0.067325,-0.7215,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.143026,-0.80792,-0.571672,0.507243,0.067325,-0.7215,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	-0.720224,-0.15594,-0.675988,0.342054,0.121167,-0.675096,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.32072,-0.774629,-0.545059,0.421284,0.083716,-0.706,
-	-0.440529,-0.24065,-0.864882,0.419921,0.106487,-0.723162,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	0.21248,-0.884802,-0.414701,0.666096,0.041783,-0.660875,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	-0.070895,-0.97954,-0.18835,0.586334,0.040774,-0.664625,
-	0.21248,-0.884802,-0.414701,0.666096,0.041783,-0.660875,
-	0.570751,-0.537595,-0.620672,0.684631,0.057942,-0.675096,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	0.21248,-0.884802,-0.414701,0.666096,0.041783,-0.660875,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	-0.143026,-0.80792,-0.571672,0.507243,0.067325,-0.7215,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	-0.09747,-0.388654,-0.916214,0.513237,0.088956,-0.739298,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	0.227406,-0.473471,-0.850947,0.606658,0.072023,-0.723162,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	-0.070895,-0.97954,-0.18835,0.586334,0.040774,-0.664625,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	0.024087,-0.872904,-0.487296,0.593625,0.053327,-0.706,
-	-0.143026,-0.80792,-0.571672,0.507243,0.067325,-0.7215,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.603758,0.432599,-0.669577,0.386176,0.201223,-0.673147,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.77971,0.541974,-0.313555,0.342801,0.212716,-0.594444,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.720224,-0.15594,-0.675988,0.342054,0.121167,-0.675096,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.649491,0.313781,-0.692606,0.355891,0.154793,-0.676509,
-	-0.828821,0.45488,-0.325791,0.309735,0.164469,-0.596277,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.720224,-0.155939,0.675988,0.342054,0.121167,-0.324904,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.820475,0.571682,0,0.328343,0.216547,-0.5,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.77971,0.541974,0.313555,0.342801,0.212716,-0.405556,
-	-0.828821,0.454881,0.325791,0.309735,0.164469,-0.403722,
-	-0.857982,0.51368,0,0.29435,0.167695,-0.5,
-	-0.364711,-0.913648,0.179534,0.369306,0.083596,-0.361333,
-	-0.355137,-0.92942,0.100277,0.342964,0.083687,-0.4175,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.364711,-0.913648,0.179534,0.369306,0.083596,-0.361333,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.75175,-0.659448,0,0.289108,0.105788,-0.5,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.355137,-0.92942,0.100277,0.342964,0.083687,-0.4175,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.75175,-0.659448,0,0.289108,0.105788,-0.5,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.720224,-0.155939,0.675988,0.342054,0.121167,-0.324904,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.672934,-0.714357,0.191973,0.304584,0.104293,-0.4125,
-	-0.916555,-0.053852,0.396267,0.294978,0.129544,-0.404556,
-	-0.364711,-0.913648,-0.179534,0.369306,0.083596,-0.638667,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.364711,-0.913648,-0.179534,0.369306,0.083596,-0.638667,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.355137,-0.92942,-0.100277,0.342964,0.083687,-0.5825,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.720224,-0.15594,-0.675988,0.342054,0.121167,-0.675096,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.560128,-0.705465,-0.434253,0.349234,0.097654,-0.660875,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.75175,-0.659448,0,0.289108,0.105788,-0.5,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.999967,0.008167,0,0.279139,0.132156,-0.5,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.916555,-0.053852,-0.396267,0.294978,0.129544,-0.595444,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.355137,-0.92942,-0.100277,0.342964,0.083687,-0.5825,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.672934,-0.714357,-0.191973,0.304584,0.104293,-0.5875,
-	-0.75175,-0.659448,0,0.289108,0.105788,-0.5,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	-0.603758,0.432599,0.669577,0.386176,0.201223,-0.326853,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	-0.304433,0.241938,0.921296,0.458468,0.182068,-0.279631,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	-0.720224,-0.155939,0.675988,0.342054,0.121167,-0.324904,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.649491,0.313782,0.692606,0.355891,0.154793,-0.323491,
-	-0.317035,0.182994,0.930592,0.432817,0.138665,-0.275352,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	0.677454,-0.2664,0.685629,0.704261,0.116939,-0.326853,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.691984,-0.189259,0.696663,0.694366,0.083832,-0.323491,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	0.344586,-0.098997,0.93352,0.631969,0.136095,-0.279631,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.013842,0.059444,0.998136,0.545218,0.159081,-0.263891,
-	0.338242,-0.103362,0.935366,0.61744,0.099959,-0.275352,
-	0.007661,0.031192,0.999484,0.525128,0.119312,-0.259306,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	-0.070895,-0.97954,0.188349,0.586334,0.040774,-0.335375,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	0.21248,-0.884802,0.414702,0.666096,0.041783,-0.339125,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	-0.143026,-0.80792,0.571672,0.507243,0.067325,-0.2785,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	-0.070895,-0.97954,0.188349,0.586334,0.040774,-0.335375,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	-0.143026,-0.80792,0.571672,0.507243,0.067325,-0.2785,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	0.570752,-0.537595,0.620673,0.684631,0.057942,-0.324904,
-	0.21248,-0.884802,0.414702,0.666096,0.041783,-0.339125,
-	0.21248,-0.884802,0.414702,0.666096,0.041783,-0.339125,
-	0.024087,-0.872904,0.487296,0.593625,0.053327,-0.294,
-	0.227406,-0.473471,0.850948,0.606658,0.072023,-0.276838,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.364711,-0.913648,0.179534,0.369306,0.083596,-0.361333,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.720224,-0.155939,0.675988,0.342054,0.121167,-0.324904,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.560128,-0.705466,0.434252,0.349234,0.097654,-0.339125,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	-0.143026,-0.80792,0.571672,0.507243,0.067325,-0.2785,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.09747,-0.388653,0.916214,0.513237,0.088956,-0.260702,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.44053,-0.240649,0.864882,0.419921,0.106487,-0.276838,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	-0.32072,-0.774629,0.545059,0.421284,0.083716,-0.294,
-	-0.143026,-0.80792,0.571672,0.507243,0.067325,-0.2785,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	-0.070895,-0.97954,-0.18835,0.586334,0.040774,-0.664625,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	0.029695,-0.979483,-0.199329,0.642426,0.035438,-0.638667,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	0.015839,-0.994833,-0.100277,0.667212,0.026513,-0.5825,
-	-0.070895,-0.97954,-0.18835,0.586334,0.040774,-0.664625,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	-0.070895,-0.97954,-0.18835,0.586334,0.040774,-0.664625,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	0.015839,-0.994833,-0.100277,0.667212,0.026513,-0.5825,
-	0.015839,-0.994833,-0.100277,0.667212,0.026513,-0.5825,
-	-0.094013,-0.992373,-0.079739,0.592781,0.031264,-0.5905,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	-0.364711,-0.913648,-0.179534,0.369306,0.083596,-0.638667,
-	-0.355137,-0.92942,-0.100277,0.342964,0.083687,-0.5825,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.364711,-0.913648,-0.179534,0.369306,0.083596,-0.638667,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.355137,-0.92942,-0.100277,0.342964,0.083687,-0.5825,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.355137,-0.92942,-0.100277,0.342964,0.083687,-0.5825,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.168375,-0.954904,-0.244557,0.504703,0.05292,-0.677562,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.280571,-0.938896,-0.199385,0.423841,0.069426,-0.664625,
-	-0.251068,-0.964679,-0.079739,0.414531,0.062694,-0.5905,
-	-0.17302,-0.981247,-0.08496,0.503173,0.044243,-0.59775,
-	-0.364711,-0.913648,0.179534,0.369306,0.083596,-0.361333,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.364711,-0.913648,0.179534,0.369306,0.083596,-0.361333,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.355137,-0.92942,0.100277,0.342964,0.083687,-0.4175,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.280571,-0.938896,0.199385,0.423841,0.069426,-0.335375,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	-0.409218,-0.912437,0,0.329838,0.083754,-0.5,
-	-0.355137,-0.92942,0.100277,0.342964,0.083687,-0.4175,
-	-0.355137,-0.92942,0.100277,0.342964,0.083687,-0.4175,
-	-0.251068,-0.964679,0.079739,0.414531,0.062694,-0.4095,
-	-0.25669,-0.966494,0,0.406908,0.061217,-0.5,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	0.015839,-0.994833,0.100277,0.667212,0.026513,-0.4175,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	0.029695,-0.979483,0.199329,0.642426,0.035438,-0.361333,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	-0.070895,-0.97954,0.188349,0.586334,0.040774,-0.335375,
-	0.015839,-0.994833,0.100277,0.667212,0.026513,-0.4175,
-	0.072467,-0.997371,0,0.679568,0.022087,-0.5,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	0.015839,-0.994833,0.100277,0.667212,0.026513,-0.4175,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	-0.173648,-0.984808,0,0.502661,0.041337,-0.5,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	-0.089351,-0.996,0,0.599438,0.027269,-0.5,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-	-0.168376,-0.954904,0.244557,0.504703,0.05292,-0.322437,
-	-0.070895,-0.97954,0.188349,0.586334,0.040774,-0.335375,
-	-0.070895,-0.97954,0.188349,0.586334,0.040774,-0.335375,
-	-0.094013,-0.992373,0.079739,0.592781,0.031264,-0.4095,
-	-0.17302,-0.981247,0.08496,0.503173,0.044243,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_3=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_3[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000\006"
+ "cB\077TT\301>\000\000\000\277\252\334u7\312k\021\374\363\320\000\000\375"
+ "^E\371\331\321\000\000ve\360\356\323\346\000\000Gr/\361V\346\000\000\236"
+ "g\177\353\000\000\000\000qt\216\355\000\000\000\000\321|\332\360\000\000"
+ "\000\000\227z\205\364\217\346\000\000\030t\204\377T\321\000\000ve\360\356"
+ "-\031\000\000\375^E\371'.\000\000\312k\021\374\015/\000\000Gr/\361\252\031"
+ "\000\000\030t\204\377\254.\000\000\227z\205\364q\031\000\000\311v\260\013"
+ "\366$\000\000H{K\006\376\025\000\000\246}\355\372S\027\000\000[w/\005\342"
+ "*\000\000\204}\232\003\000\000\000\000\377\177\203\367\000\000\000\000\311"
+ "v\260\013\012\333\000\000[w/\005\036\325\000\000\246}\355\372\255\350\000"
+ "\000H{K\006\002\352\000\0003T|\012\276:\000\000\372`5\016\342;\000\000@G"
+ "&\037\360>\000\000\001T\372#)@\000\000\325\134\317'\311\077\000\000\205i"
+ "\331\021|;\000\000N:\3173\276:\000\000\204/\007E'.\000\0007<\343K\015/\000"
+ "\000\007G\2779\342;\000\000JE\360O\254.\000\000\002P\260=|;\000\000yLuO\342"
+ "*\000\000\323Q\266K\366$\000\000XZX\077\342+\000\000\210V\256>\3516\000\000"
+ "\332e\230,U/\000\000zb\245*\013;\000\000\333mH\026\3516\000\000VpA\031\342"
+ "+\000\000\012)[O-\031\000\000\2725\305V\252\031\000\000\342&\315R\000\000"
+ "\000\000\2203fZ\000\000\000\000\332<\303^\000\000\000\000\360>\004[q\031"
+ "\000\000\204/\007E\331\321\000\0007<\343K\363\320\000\000\2725\305VV\346"
+ "\000\000\012)[O\323\346\000\000JE\360OT\321\000\000\360>\004[\217\346\000"
+ "\000\323Q\266K\012\333\000\000fOMR\002\352\000\000\275F\011Z\255\350\000"
+ "\000yLuO\036\325\000\0000N\225U\000\000\000\000\364D\306]\000\000\000\000"
+ "\275F\011ZS\027\000\000fOMR\376\025\000\000N:\3173B\305\000\000\007G\277"
+ "9\036\304\000\000@G&\037\020\301\000\000\001T\372#\327\277\000\000\325\134"
+ "\317'7\300\000\000\002P\260=\204\304\000\000\372`5\016\036\304\000\0003T"
+ "|\012B\305\000\000\205i\331\021\204\304\000\000VpA\031\036\324\000\000\333"
+ "mH\026\027\311\000\000\332e\230,\253\320\000\000zb\245*\365\304\000\000X"
+ "ZX\077\036\324\000\000\210V\256>\027\311\000\000Ns\201\030 \030\000\000\343"
+ "g\304-\016\032\000\000\221h).\000\000\000\000\352t4\027\000\000\000\000/"
+ "[JB \030\000\000\333ZUD\000\000\000\000/[JB\340\347\000\000\343g\304-\362"
+ "\345\000\000Ns\201\030\340\347\000\000:N\216\365\340\321\000\000\340T\315"
+ "\353\327\346\000\000`;\273\360i\321\000\000`B\240\347\226\346\000\000\266"
+ "D\226\344\000\000\000\000\030W\215\350\000\000\000\000J(\226\352\324\320"
+ "\000\000\327\026\355\342\203\320\000\000\004\037\204\333\031\346\000\000"
+ "\316/\077\342E\346\000\000\276!\014\331\000\000\000\000P2w\337\000\000\000"
+ "\000\004\037\204\333\347\031\000\000\327\026\355\342}/\000\000J(\226\352"
+ ",/\000\000\316/\077\342\273\031\000\000`;\273\360\227.\000\000`B\240\347"
+ "j\031\000\000\340T\315\353)\031\000\000:N\216\365 .\000\000v\035\025=\340"
+ "\321\000\000\214(\324,K\305\000\000\007\010\2023i\321\000\000\262\023U$\264"
+ "\304\000\000\263!\036\022x\300\000\000\3305R\031\032\301\000\000.\361\300"
+ "'\324\320\000\000\342\332B\031\203\320\000\000\202\350\351\014\217\303\000"
+ "\000\264\375\331\031\367\303\000\000\334\370\027\376>\277\000\000\274\014"
+ "+\011\255\277\000\000\304\033}\370\367\303\000\0006\011F\357\217\303\000"
+ "\000\264/\350\377\264\304\000\000%C\320\005K\305\000\000\214(\324,\265:\000"
+ "\000v\035\025= .\000\000\3305R\031\346>\000\000\263!\036\022\210\077\000"
+ "\000\262\023U$L;\000\000\007\010\2023\227.\000\000%C\320\005\265:\000\000"
+ "\264/\350\377L;\000\0006\011F\357q<\000\000\304\033}\370\011<\000\000\334"
+ "\370\027\376\302@\000\000\274\014+\011S@\000\000\202\350\351\014q<\000\000"
+ "\342\332B\031}/\000\000.\361\300',/\000\000\264\375\331\031\011<\000\000"
+ "\320\026\326F\327\346\000\000\231\024\027J\000\000\000\000\261\376\246\077"
+ "\000\000\000\000\007\001\235<\226\346\000\000\320\026\326F)\031\000\000\007"
+ "\001\235<j\031\000\000\265\322\253 \347\031\000\000\252\351\0270\273\031"
+ "\000\000\373\317##\000\000\000\000(\347\3372\000\000\000\000\252\351\027"
+ "0E\346\000\000\265\322\253 \031\346\000\000\306\247~\341\340\321\000\000"
+ "\211\234\375\320\331\321\000\000\316\257\341\313B\305\000\000\244\271\355"
+ "\332K\305\000\000\356\306\301\305\020\301\000\000\025\317\014\323\032\301"
+ "\000\000\026\332\273\341x\300\000\000j\306\331\353\264\304\000\000\005\266"
+ "G\364i\321\000\000S\361\205\272\331\321\000\000d\366\231\304\340\321\000"
+ "\000\206\344*\313K\305\000\000\016\336\240\277B\305\000\000(\3760\317i\321"
+ "\000\000\303\355\236\327\264\304\000\000\342\010\213\331\324\320\000\000"
+ "\357\371\374\343\367\303\000\000\377\347\203\360\255\277\000\000\034\307"
+ "|\007\324\320\000\000\017\326\013\375\367\303\000\000\371\220\015\324\323"
+ "\346\000\000\016\235o\345\327\346\000\000/\254U\371\226\346\000\000\347\250"
+ "\005\373\000\000\000\000{\231\277\346\000\000\000\000\037\215\022\325\000"
+ "\000\000\000$\276\277\015E\346\000\000&\273\326\017\000\000\000\000\034\307"
+ "|\007,/\000\000$\276\277\015\273\031\000\000\005\266G\364\227.\000\000/\254"
+ "U\371j\031\000\000\306\247~\341 .\000\000\211\234\375\320'.\000\000\371\220"
+ "\015\324-\031\000\000\016\235o\345)\031\000\000\316\257\341\313\276:\000"
+ "\000\244\271\355\332\265:\000\000j\306\331\353L;\000\000\026\332\273\341"
+ "\210\077\000\000\025\317\014\323\346>\000\000\356\306\301\305\360>\000\000"
+ "\017\326\013\375\011<\000\000\377\347\203\360S@\000\000\342\010\213\331,"
+ "/\000\000\357\371\374\343\011<\000\000(\3760\317\227.\000\000\303\355\236"
+ "\327L;\000\000S\361\205\272'.\000\000\016\336\240\277\276:\000\000\206\344"
+ "*\313\265:\000\000d\366\231\304 .\000\000\034\001\251\300)\031\000\000\342"
+ "\374u\267-\031\000\000\376\007!\312j\031\000\000E\013r\310\000\000\000\000"
+ "\257\004X\277\000\000\000\000\275\000o\266\000\000\000\000\332\021H\323\273"
+ "\031\000\000\330\0241\321\000\000\000\000\332\021H\323E\346\000\000\376\007"
+ "!\312\226\346\000\000\342\374u\267\323\346\000\000\034\001\251\300\327\346"
+ "\000\000\257\356\262\261\015/\000\000\375\372\036\257\252\031\000\000\027"
+ "\377B\256\000\000\000\000\316\374\214\247\000\000\000\000\234\370g\250q\031"
+ "\000\000\027\354\313\252\254.\000\000\257\356\262\261\363\320\000\000\375"
+ "\372\036\257V\346\000\000\027\354\313\252T\321\000\000\234\370g\250\217\346"
+ "\000\000\327\340\314\244\012\333\000\000r\347k\242\002\352\000\000\360\362"
+ "\024\244\255\350\000\000&\347}\246\036\325\000\000\276\352=\241\000\000\000"
+ "\000\364\366\013\243\000\000\000\000\327\340\314\244\366$\000\000&\347}\246"
+ "\342*\000\000\360\362\024\244S\027\000\000r\347k\242\376\025\000\000.\332"
+ "\376\265\036\304\000\000\223\301'\273\327\277\000\000g\276\020\2637\300\000"
+ "\000N\327\214\256\204\304\000\000v\224\234\304\363\320\000\000\370\250P\300"
+ "\036\304\000\000\306\220\246\273T\321\000\000\210\245\274\267\204\304\000"
+ "\000\260\222a\265\036\325\000\000\012\230\242\261\012\333\000\000\223\246"
+ "\333\255\036\324\000\000\345\245\252\261\027\311\000\000!\274u\251\253\320"
+ "\000\000\316\274L\255\365\304\000\000\325\323\220\251\027\311\000\000\343"
+ "\3218\246\036\324\000\000)\2101\307V\346\000\000\017\204\015\310\000\000"
+ "\000\000\001\200\224\276\000\000\000\000:\204\341\275\217\346\000\000v\224"
+ "\234\304\015/\000\000)\2101\307\252\031\000\000\306\220\246\273\254.\000"
+ "\000:\204\341\275q\031\000\000\012\230\242\261\366$\000\000\004\221\250\261"
+ "\376\025\000\000\311\206&\267S\027\000\000\260\222a\265\342*\000\000\205"
+ "\215\255\261\000\000\000\000\251\202\214\267\000\000\000\000\311\206&\267"
+ "\255\350\000\000\004\221\250\261\002\352\000\000\370\250P\300\342;\000\000"
+ "\223\301'\273)@\000\000g\276\020\263\311\077\000\000\210\245\274\267|;\000"
+ "\000.\332\376\265\342;\000\000N\327\214\256|;\000\000\343\3218\246\342+\000"
+ "\000\325\323\220\251\3516\000\000!\274u\251U/\000\000\316\274L\255\013;\000"
+ "\000\223\246\333\255\342+\000\000\345\245\252\261\3516\000\000\233\323\257"
+ "\243\340\347\000\000\271\273%\247\362\345\000\000\226\273^\246\000\000\000"
+ "\000b\325\236\242\000\000\000\000\030\244\020\254\340\347\000\000\020\242"
+ "\253\253\000\000\000\000\030\244\020\254 \030\000\000\271\273%\247\016\032"
+ "\000\000\233\323\257\243 \030\000\000H\221C\214+\2202\227\022\223\037\240"
+ "G\310G\261\134\260\017\254\013\304\020\311\026\263/\3350\310R\033W\036c\372"
+ "Q\005c\034q\362d-z.y\344a(\006\335\011\340\373\375\375\376\037\017)\362\360"
+ "\034\3460\3471\361\034\377@\016'&:;5@/.*D(8\037A\023K\042\335B\336B\325T"
+ "\323R\360o\371U\261e\262f\303]\303\134\301~\326xJDFA6ZEYB=/P%I>9\235o\235"
+ "p\204\206\203\204p`Xq_\212\134\207q\252]4l>W;`GP\077UQQ'L,Q.V)G1K4N8S3X."
+ "D\220-\222F\223/\226\031\232\025\226H\227L\235:\2443\234(\251\037\240#\273"
+ "\034\315\026\311\033\264\022\307\025\260\021\256\017\305\265i\241s\265g\242"
+ "s}|~~\263c\256]\235k\240p\177\201}|`\221a\223_\216^\213\364 \3524\001\001"
+ "\003\002\364!\3504\012\337\015\340\022\342\020\341\000\000\003\002\354\034"
+ "\336-\3442\361\037\306_\327V\325T\305]\340E\336D\322:\332A\306E\317N\302"
+ "Y\273Q\241R\241R\226e\224cx}\202\202\205\203\225d\243Sj\266`\257l\234v\241"
+ "Z\250g\231R\244c\226\204\203\251U\230f\253B\254C\257F\273:\2676\2654\266"
+ "H\300\077\326(\3115\324\042\307.\323 \323 \303*\304+\346\025\344\023\345"
+ "\024\376\374\377\377\002\007\347\027\376\375#\323\025\344'\333\030\3505\353"
+ " \367\033\355.\341@\332J\3475\320C\304S\324c\344-\3055\266D\256O\266f\313"
+ "Y\3018\361L\352b\343C\304>\325*\331p\271i\315X\253T\277\030\204\015\203."
+ "\2365\223\011\212&\247\003\231\022\266\035\257\002\216u\240{~\244\212X\224"
+ "\231M\221c\216\274\225\245\266\253\321\241\325\232\275\232\332\221\304\215"
+ "/\203\345\210\245>\2610\202\001\206\326\316\030\277$\305\363\253\373\340"
+ "\260\337\253\312\307\326\313\331\250\274\305\272\267\326\242\344\020\001"
+ "\004\367\335\334\354\037\366\023\331\371\234\002\260\360\247\364\275\347"
+ "\254\347\304\355\213\346\223\355\224\366\213\340\232\345\234\347\241\356"
+ "\233\366\224\000\000\001\000\002\000\002\000\003\000\000\000\004\000\005"
+ "\000\003\000\004\000\003\000\002\000\005\000\006\000\007\000\007\000\003"
+ "\000\005\000\010\000\000\000\003\000\010\000\003\000\007\000\011\000\012"
+ "\000\013\000\013\000\014\000\011\000\015\000\016\000\014\000\015\000\014"
+ "\000\013\000\016\000\006\000\005\000\005\000\014\000\016\000\004\000\011"
+ "\000\014\000\004\000\014\000\005\000\017\000\020\000\021\000\017\000\021"
+ "\000\022\000\023\000\024\000\021\000\023\000\021\000\020\000\006\000\016"
+ "\000\021\000\006\000\021\000\024\000\015\000\022\000\021\000\015\000\021"
+ "\000\016\000\025\000\026\000\027\000\025\000\027\000\030\000\010\000\007"
+ "\000\027\000\010\000\027\000\026\000\006\000\024\000\027\000\006\000\027"
+ "\000\007\000\023\000\030\000\027\000\023\000\027\000\024\000\012\000\031"
+ "\000\032\000\012\000\032\000\013\000\031\000\033\000\034\000\034\000\032"
+ "\000\031\000\035\000\036\000\032\000\035\000\032\000\034\000\036\000\015"
+ "\000\013\000\013\000\032\000\036\000\037\000 \000!\000!\000\042\000\037\000"
+ "#\000$\000\042\000#\000\042\000!\000$\000\035\000\034\000\034\000\042\000"
+ "$\000\033\000\037\000\042\000\033\000\042\000\034\000%\000&\000'\000'\000"
+ "(\000%\000)\000*\000(\000)\000(\000'\000\035\000$\000(\000\035\000(\000*"
+ "\000$\000#\000%\000%\000(\000$\000\017\000\022\000+\000\017\000+\000,\000"
+ "\022\000\015\000\036\000\036\000+\000\022\000\035\000*\000+\000\035\000+"
+ "\000\036\000*\000)\000,\000,\000+\000*\000 \000-\000.\000 \000.\000!\000"
+ "-\000/\0000\0000\000.\000-\0001\0002\000.\0001\000.\0000\0002\000#\000!\000"
+ "!\000.\0002\0003\0004\0005\0003\0005\0006\0004\0007\0008\0008\0005\0004\000"
+ "1\0000\0005\0001\0005\0008\0000\000/\0006\0006\0005\0000\0009\000:\000;\000"
+ "9\000;\000<\000:\000=\000>\000>\000;\000:\0001\0008\000;\0001\000;\000>\000"
+ "8\0007\000<\000<\000;\0008\000&\000%\000\077\000&\000\077\000@\000%\000#"
+ "\0002\0002\000\077\000%\0001\000>\000\077\0001\000\077\0002\000>\000=\000"
+ "@\000@\000\077\000>\0004\0003\000A\000A\000B\0004\000C\000D\000B\000C\000"
+ "B\000A\000D\000E\000F\000F\000B\000D\0007\0004\000B\0007\000B\000F\000\001"
+ "\000\000\000G\000\001\000G\000H\000\000\000\010\000I\000I\000G\000\000\000"
+ "E\000D\000G\000E\000G\000I\000D\000C\000H\000H\000G\000D\000\025\000J\000"
+ "K\000\025\000K\000\026\000J\000L\000M\000M\000K\000J\000E\000I\000K\000E"
+ "\000K\000M\000I\000\010\000\026\000\026\000K\000I\000N\0009\000<\000<\000"
+ "O\000N\000<\0007\000F\000F\000O\000<\000E\000M\000O\000E\000O\000F\000L\000"
+ "N\000O\000L\000O\000M\000\017\000,\000P\000\017\000P\000\020\000,\000)\000"
+ "Q\000Q\000P\000,\000R\000S\000P\000R\000P\000Q\000S\000\023\000\020\000\020"
+ "\000P\000S\000&\000@\000T\000&\000T\000'\000@\000=\000U\000U\000T\000@\000"
+ "R\000Q\000T\000R\000T\000U\000Q\000)\000'\000'\000T\000Q\0009\000N\000V\000"
+ "9\000V\000:\000N\000L\000W\000W\000V\000N\000R\000U\000V\000R\000V\000W\000"
+ "U\000=\000:\000:\000V\000U\000\025\000\030\000X\000\025\000X\000J\000\030"
+ "\000\023\000S\000S\000X\000\030\000R\000W\000X\000R\000X\000S\000W\000L\000"
+ "J\000J\000X\000W\000\001\000Y\000Z\000\001\000Z\000\002\000Y\000[\000\134"
+ "\000\134\000Z\000Y\000]\000^\000Z\000]\000Z\000\134\000^\000\004\000\002"
+ "\000\002\000Z\000^\000_\000`\000a\000a\000b\000_\000c\000d\000b\000c\000"
+ "b\000a\000d\000]\000\134\000\134\000b\000d\000[\000_\000b\000[\000b\000\134"
+ "\000e\000f\000g\000g\000h\000e\000i\000j\000h\000i\000h\000g\000j\000]\000"
+ "d\000d\000h\000j\000c\000e\000h\000c\000h\000d\000\012\000\011\000k\000\012"
+ "\000k\000l\000\011\000\004\000^\000^\000k\000\011\000]\000j\000k\000]\000"
+ "k\000^\000j\000i\000l\000l\000k\000j\0003\000m\000n\0003\000n\000A\000m\000"
+ "o\000p\000p\000n\000m\000q\000r\000n\000q\000n\000p\000r\000C\000A\000A\000"
+ "n\000r\000s\000t\000u\000u\000v\000s\000w\000x\000v\000w\000v\000u\000x\000"
+ "q\000p\000p\000v\000x\000o\000s\000v\000o\000v\000p\000`\000_\000y\000`\000"
+ "y\000z\000_\000[\000{\000{\000y\000_\000q\000x\000y\000q\000y\000{\000x\000"
+ "w\000z\000z\000y\000x\000Y\000\001\000H\000H\000|\000Y\000C\000r\000|\000"
+ "C\000|\000H\000r\000q\000{\000{\000|\000r\000[\000Y\000|\000[\000|\000{\000"
+ " \000\037\000}\000 \000}\000~\000\037\000\033\000\177\000\177\000}\000\037"
+ "\000\200\000\201\000}\000\200\000}\000\177\000\201\000\202\000~\000~\000"
+ "}\000\201\000\031\000\012\000l\000l\000\203\000\031\000i\000\204\000\203"
+ "\000i\000\203\000l\000\204\000\200\000\177\000\177\000\203\000\204\000\033"
+ "\000\031\000\203\000\033\000\203\000\177\000f\000\205\000\206\000f\000\206"
+ "\000g\000\205\000\207\000\210\000\210\000\206\000\205\000\200\000\204\000"
+ "\206\000\200\000\206\000\210\000\204\000i\000g\000g\000\206\000\204\000\211"
+ "\000\212\000\213\000\213\000\214\000\211\000\202\000\201\000\214\000\202"
+ "\000\214\000\213\000\201\000\200\000\210\000\210\000\214\000\201\000\207"
+ "\000\211\000\214\000\207\000\214\000\210\000m\0003\0006\0006\000\215\000"
+ "m\000/\000\216\000\215\000/\000\215\0006\000\216\000\217\000\220\000\220"
+ "\000\215\000\216\000o\000m\000\215\000o\000\215\000\220\000-\000 \000~\000"
+ "~\000\221\000-\000\202\000\222\000\221\000\202\000\221\000~\000\222\000\217"
+ "\000\216\000\216\000\221\000\222\000/\000-\000\221\000/\000\221\000\216\000"
+ "\212\000\223\000\224\000\212\000\224\000\213\000\223\000\225\000\226\000"
+ "\226\000\224\000\223\000\217\000\222\000\224\000\217\000\224\000\226\000"
+ "\222\000\202\000\213\000\213\000\224\000\222\000t\000s\000\227\000t\000\227"
+ "\000\230\000s\000o\000\220\000\220\000\227\000s\000\217\000\226\000\227\000"
+ "\217\000\227\000\220\000\226\000\225\000\230\000\230\000\227\000\226\000"
+ "\231\000\232\000\233\000\233\000\234\000\231\000\235\000\236\000\234\000"
+ "\235\000\234\000\233\000\236\000\237\000\240\000\240\000\234\000\236\000"
+ "\241\000\231\000\234\000\241\000\234\000\240\000\242\000\243\000\244\000"
+ "\242\000\244\000\245\000\243\000\246\000\247\000\247\000\244\000\243\000"
+ "\237\000\236\000\244\000\237\000\244\000\247\000\236\000\235\000\245\000"
+ "\245\000\244\000\236\000\250\000`\000z\000z\000\251\000\250\000w\000\252"
+ "\000\251\000w\000\251\000z\000\252\000\237\000\247\000\247\000\251\000\252"
+ "\000\246\000\250\000\251\000\246\000\251\000\247\000t\000\253\000\254\000"
+ "t\000\254\000u\000\253\000\241\000\240\000\240\000\254\000\253\000\237\000"
+ "\252\000\254\000\237\000\254\000\240\000\252\000w\000u\000u\000\254\000\252"
+ "\000\255\000\232\000\231\000\231\000\256\000\255\000\241\000\257\000\256"
+ "\000\241\000\256\000\231\000\257\000\260\000\261\000\261\000\256\000\257"
+ "\000\262\000\255\000\256\000\262\000\256\000\261\000\253\000t\000\230\000"
+ "\230\000\263\000\253\000\225\000\264\000\263\000\225\000\263\000\230\000"
+ "\260\000\257\000\263\000\260\000\263\000\264\000\257\000\241\000\253\000"
+ "\253\000\263\000\257\000\223\000\212\000\265\000\265\000\266\000\223\000"
+ "\265\000\267\000\270\000\270\000\266\000\265\000\260\000\264\000\266\000"
+ "\260\000\266\000\270\000\225\000\223\000\266\000\225\000\266\000\264\000"
+ "\271\000\272\000\273\000\273\000\274\000\271\000\262\000\261\000\274\000"
+ "\262\000\274\000\273\000\261\000\260\000\270\000\270\000\274\000\261\000"
+ "\267\000\271\000\274\000\267\000\274\000\270\000\275\000\272\000\271\000"
+ "\271\000\276\000\275\000\267\000\277\000\276\000\267\000\276\000\271\000"
+ "\277\000\300\000\301\000\301\000\276\000\277\000\302\000\275\000\276\000"
+ "\302\000\276\000\301\000\212\000\211\000\303\000\212\000\303\000\265\000"
+ "\211\000\207\000\304\000\304\000\303\000\211\000\300\000\277\000\303\000"
+ "\300\000\303\000\304\000\277\000\267\000\265\000\265\000\303\000\277\000"
+ "\205\000f\000\305\000\305\000\306\000\205\000\307\000\310\000\306\000\307"
+ "\000\306\000\305\000\310\000\300\000\304\000\304\000\306\000\310\000\207"
+ "\000\205\000\306\000\207\000\306\000\304\000\311\000\312\000\313\000\311"
+ "\000\313\000\314\000\312\000\302\000\301\000\301\000\313\000\312\000\300"
+ "\000\310\000\313\000\300\000\313\000\301\000\310\000\307\000\314\000\314"
+ "\000\313\000\310\000\311\000\314\000\315\000\311\000\315\000\316\000\314"
+ "\000\307\000\317\000\317\000\315\000\314\000\320\000\321\000\315\000\320"
+ "\000\315\000\317\000\321\000\322\000\316\000\316\000\315\000\321\000f\000"
+ "e\000\323\000f\000\323\000\305\000e\000c\000\324\000\324\000\323\000e\000"
+ "\320\000\317\000\323\000\320\000\323\000\324\000\317\000\307\000\305\000"
+ "\305\000\323\000\317\000`\000\250\000\325\000`\000\325\000a\000\250\000\246"
+ "\000\326\000\326\000\325\000\250\000\320\000\324\000\325\000\320\000\325"
+ "\000\326\000\324\000c\000a\000a\000\325\000\324\000\242\000\327\000\330\000"
+ "\242\000\330\000\243\000\327\000\322\000\321\000\321\000\330\000\327\000"
+ "\320\000\326\000\330\000\320\000\330\000\321\000\326\000\246\000\243\000"
+ "\243\000\330\000\326\000\331\000\311\000\316\000\316\000\332\000\331\000"
+ "\322\000\333\000\332\000\322\000\332\000\316\000\333\000\334\000\335\000"
+ "\335\000\332\000\333\000\336\000\331\000\332\000\336\000\332\000\335\000"
+ "\327\000\242\000\337\000\337\000\340\000\327\000\341\000\342\000\340\000"
+ "\341\000\340\000\337\000\342\000\334\000\333\000\333\000\340\000\342\000"
+ "\322\000\327\000\340\000\322\000\340\000\333\000\343\000\344\000\345\000"
+ "\343\000\345\000\346\000\347\000\350\000\345\000\347\000\345\000\344\000"
+ "\334\000\342\000\345\000\334\000\345\000\350\000\341\000\346\000\345\000"
+ "\341\000\345\000\342\000\351\000\352\000\353\000\351\000\353\000\354\000"
+ "\336\000\335\000\353\000\336\000\353\000\352\000\334\000\350\000\353\000"
+ "\334\000\353\000\335\000\347\000\354\000\353\000\347\000\353\000\350\000"
+ "\337\000\242\000\245\000\245\000\355\000\337\000\235\000\356\000\355\000"
+ "\235\000\355\000\245\000\356\000\357\000\360\000\360\000\355\000\356\000"
+ "\341\000\337\000\355\000\341\000\355\000\360\000\232\000\361\000\362\000"
+ "\232\000\362\000\233\000\361\000\363\000\364\000\364\000\362\000\361\000"
+ "\357\000\356\000\362\000\357\000\362\000\364\000\356\000\235\000\233\000"
+ "\233\000\362\000\356\000\365\000\366\000\367\000\367\000\370\000\365\000"
+ "\371\000\372\000\370\000\371\000\370\000\367\000\357\000\364\000\370\000"
+ "\357\000\370\000\372\000\364\000\363\000\365\000\365\000\370\000\364\000"
+ "\343\000\346\000\373\000\343\000\373\000\374\000\346\000\341\000\360\000"
+ "\360\000\373\000\346\000\357\000\372\000\373\000\357\000\373\000\360\000"
+ "\371\000\374\000\373\000\371\000\373\000\372\000\232\000\255\000\375\000"
+ "\232\000\375\000\361\000\255\000\262\000\376\000\376\000\375\000\255\000"
+ "\377\000\000\001\375\000\377\000\375\000\376\000\000\001\363\000\361\000"
+ "\361\000\375\000\000\001\272\000\001\001\002\001\272\000\002\001\273\000"
+ "\001\001\003\001\004\001\004\001\002\001\001\001\377\000\376\000\002\001"
+ "\377\000\002\001\004\001\376\000\262\000\273\000\273\000\002\001\376\000"
+ "\005\001\006\001\007\001\005\001\007\001\010\001\011\001\012\001\007\001"
+ "\011\001\007\001\006\001\377\000\004\001\007\001\377\000\007\001\012\001"
+ "\004\001\003\001\010\001\010\001\007\001\004\001\366\000\365\000\013\001"
+ "\366\000\013\001\014\001\365\000\363\000\000\001\000\001\013\001\365\000"
+ "\377\000\012\001\013\001\377\000\013\001\000\001\011\001\014\001\013\001"
+ "\011\001\013\001\012\001\272\000\275\000\015\001\272\000\015\001\001\001"
+ "\275\000\302\000\016\001\016\001\015\001\275\000\017\001\020\001\015\001"
+ "\017\001\015\001\016\001\020\001\003\001\001\001\001\001\015\001\020\001"
+ "\312\000\311\000\331\000\331\000\021\001\312\000\336\000\022\001\021\001"
+ "\336\000\021\001\331\000\022\001\017\001\016\001\016\001\021\001\022\001"
+ "\302\000\312\000\021\001\302\000\021\001\016\001\351\000\023\001\024\001"
+ "\351\000\024\001\352\000\025\001\026\001\024\001\025\001\024\001\023\001"
+ "\017\001\022\001\024\001\017\001\024\001\026\001\022\001\336\000\352\000"
+ "\352\000\024\001\022\001\027\001\005\001\010\001\010\001\030\001\027\001"
+ "\010\001\003\001\020\001\020\001\030\001\010\001\017\001\026\001\030\001"
+ "\017\001\030\001\020\001\025\001\027\001\030\001\025\001\030\001\026\001"
+ "\343\000\374\000\031\001\343\000\031\001\344\000\374\000\371\000\032\001"
+ "\032\001\031\001\374\000\033\001\034\001\031\001\033\001\031\001\032\001"
+ "\034\001\347\000\344\000\344\000\031\001\034\001\366\000\014\001\035\001"
+ "\366\000\035\001\367\000\014\001\011\001\036\001\036\001\035\001\014\001"
+ "\033\001\032\001\035\001\033\001\035\001\036\001\032\001\371\000\367\000"
+ "\367\000\035\001\032\001\005\001\027\001\037\001\005\001\037\001\006\001"
+ "\027\001\025\001 \001 \001\037\001\027\001\033\001\036\001\037\001\033\001"
+ "\037\001 \001\036\001\011\001\006\001\006\001\037\001\036\001\351\000\354"
+ "\000!\001\351\000!\001\023\001\354\000\347\000\034\001\034\001!\001\354\000"
+ "\033\001 \001!\001\033\001!\001\034\001 \001\025\001\023\001\023\001!\001"
+ " \001\000\000\001\000\001\000\002\000\000\000\002\000\002\000\003\000\000"
+ "\000\003\000\004\000\005\000\003\000\005\000\003\000\004\000\002\000\004"
+ "\000\005\000\006\000\006\000\007\000\005\000\007\000\003\000\007\000\000"
+ "\000\010\000\003\000\010\000\007\000\010\000\011\000\012\000\012\000\013"
+ "\000\011\000\013\000\013\000\014\000\011\000\014\000\015\000\016\000\014"
+ "\000\016\000\014\000\015\000\013\000\015\000\006\000\016\000\005\000\016"
+ "\000\005\000\014\000\004\000\011\000\004\000\014\000\017\000\020\000\020"
+ "\000\021\000\017\000\021\000\021\000\022\000\017\000\022\000\023\000\024"
+ "\000\021\000\024\000\021\000\023\000\020\000\023\000\016\000\021\000\006"
+ "\000\021\000\006\000\024\000\015\000\022\000\015\000\021\000\025\000\026"
+ "\000\026\000\027\000\025\000\027\000\027\000\030\000\025\000\030\000\007"
+ "\000\027\000\010\000\027\000\010\000\026\000\024\000\027\000\006\000\027"
+ "\000\023\000\030\000\023\000\027\000\012\000\031\000\031\000\032\000\012"
+ "\000\032\000\013\000\032\000\031\000\033\000\033\000\034\000\031\000\034"
+ "\000\032\000\034\000\035\000\036\000\032\000\036\000\032\000\035\000\034"
+ "\000\035\000\015\000\036\000\013\000\036\000\037\000 \000 \000!\000\037\000"
+ "!\000!\000\042\000\037\000\042\000#\000$\000\042\000$\000\042\000#\000!\000"
+ "#\000\035\000$\000\034\000$\000\034\000\042\000\033\000\037\000\033\000\042"
+ "\000%\000&\000&\000'\000%\000'\000'\000(\000%\000(\000)\000*\000(\000*\000"
+ "(\000)\000'\000)\000$\000(\000\035\000(\000\035\000*\000#\000%\000$\000%"
+ "\000\022\000+\000\017\000+\000+\000,\000\017\000,\000\022\000\036\000\036"
+ "\000+\000*\000+\000\035\000+\000)\000,\000*\000,\000 \000-\000-\000.\000"
+ " \000.\000!\000.\000-\000/\000/\0000\000-\0000\000.\0000\0001\0002\000.\000"
+ "2\000.\0001\0000\0001\000#\0002\000!\0002\0003\0004\0004\0005\0003\0005\000"
+ "5\0006\0003\0006\0004\0007\0007\0008\0004\0008\0005\0008\0000\0005\0001\000"
+ "5\0001\0008\000/\0006\0000\0006\0009\000:\000:\000;\0009\000;\000;\000<\000"
+ "9\000<\000:\000=\000=\000>\000:\000>\000;\000>\0008\000;\0001\000;\0001\000"
+ ">\0007\000<\0008\000<\000%\000\077\000&\000\077\000\077\000@\000&\000@\000"
+ "%\0002\0002\000\077\000>\000\077\0001\000\077\000=\000@\000>\000@\0003\000"
+ "A\0004\000A\000A\000B\0004\000B\000C\000D\000B\000D\000B\000C\000A\000C\000"
+ "D\000E\000E\000F\000D\000F\000B\000F\0007\000B\0007\000F\000\000\000G\000"
+ "\001\000G\000G\000H\000\001\000H\000\010\000I\000\000\000I\000G\000I\000"
+ "D\000G\000E\000G\000E\000I\000C\000H\000D\000H\000\025\000J\000J\000K\000"
+ "\025\000K\000\026\000K\000J\000L\000L\000M\000J\000M\000K\000M\000I\000K"
+ "\000E\000K\000E\000M\000\026\000I\0009\000N\000<\000N\000<\000O\000N\000"
+ "O\000<\000F\000F\000O\000M\000O\000E\000O\000L\000N\000L\000O\000,\000P\000"
+ "\017\000P\000\020\000P\000)\000Q\000,\000Q\000P\000Q\000R\000S\000P\000S"
+ "\000P\000R\000Q\000R\000\023\000S\000\020\000S\000@\000T\000&\000T\000'\000"
+ "T\000=\000U\000@\000U\000T\000U\000Q\000T\000R\000T\000R\000U\000'\000Q\000"
+ "N\000V\0009\000V\000:\000V\000L\000W\000N\000W\000V\000W\000U\000V\000R\000"
+ "V\000R\000W\000:\000U\000\030\000X\000\025\000X\000J\000X\000\030\000S\000"
+ "S\000X\000W\000X\000R\000X\000J\000W\000\001\000Y\000Y\000Z\000\001\000Z"
+ "\000\002\000Z\000Y\000[\000[\000\134\000Y\000\134\000Z\000\134\000]\000^"
+ "\000Z\000^\000Z\000]\000\134\000]\000\004\000^\000\002\000^\000_\000`\000"
+ "`\000a\000_\000a\000a\000b\000_\000b\000c\000d\000b\000d\000b\000c\000a\000"
+ "c\000]\000d\000\134\000d\000\134\000b\000[\000_\000[\000b\000e\000f\000f"
+ "\000g\000e\000g\000g\000h\000e\000h\000i\000j\000h\000j\000h\000i\000g\000"
+ "i\000]\000j\000d\000j\000d\000h\000c\000e\000c\000h\000\011\000k\000\012"
+ "\000k\000k\000l\000\012\000l\000\011\000^\000^\000k\000j\000k\000]\000k\000"
+ "i\000l\000j\000l\0003\000m\000m\000n\0003\000n\000A\000n\000m\000o\000o\000"
+ "p\000m\000p\000n\000p\000q\000r\000n\000r\000n\000q\000p\000q\000C\000r\000"
+ "A\000r\000s\000t\000t\000u\000s\000u\000u\000v\000s\000v\000w\000x\000v\000"
+ "x\000v\000w\000u\000w\000q\000x\000p\000x\000p\000v\000o\000s\000o\000v\000"
+ "_\000y\000`\000y\000y\000z\000`\000z\000[\000{\000_\000{\000y\000{\000x\000"
+ "y\000q\000y\000q\000{\000w\000z\000x\000z\000H\000Y\000H\000|\000Y\000|\000"
+ "r\000|\000C\000|\000r\000{\000{\000|\000[\000|\000\037\000}\000 \000}\000"
+ "}\000~\000 \000~\000\033\000\177\000\037\000\177\000}\000\177\000\200\000"
+ "\201\000}\000\201\000}\000\200\000\177\000\200\000\201\000\202\000~\000\202"
+ "\000~\000\201\000\031\000l\000l\000\203\000\031\000\203\000i\000\204\000"
+ "\203\000\204\000i\000\203\000\200\000\204\000\177\000\204\000\177\000\203"
+ "\000\033\000\203\000f\000\205\000\205\000\206\000f\000\206\000g\000\206\000"
+ "\205\000\207\000\207\000\210\000\205\000\210\000\206\000\210\000\204\000"
+ "\206\000\200\000\206\000\200\000\210\000g\000\204\000\211\000\212\000\212"
+ "\000\213\000\211\000\213\000\213\000\214\000\211\000\214\000\201\000\214"
+ "\000\202\000\214\000\202\000\213\000\201\000\210\000\210\000\214\000\207"
+ "\000\211\000\207\000\214\0006\000m\0006\000\215\000m\000\215\000/\000\216"
+ "\000\215\000\216\000/\000\215\000\216\000\217\000\217\000\220\000\216\000"
+ "\220\000\215\000\220\000o\000\215\000o\000\220\000-\000~\000~\000\221\000"
+ "-\000\221\000\202\000\222\000\221\000\222\000\202\000\221\000\217\000\222"
+ "\000\216\000\222\000\216\000\221\000/\000\221\000\212\000\223\000\223\000"
+ "\224\000\212\000\224\000\213\000\224\000\223\000\225\000\225\000\226\000"
+ "\223\000\226\000\224\000\226\000\222\000\224\000\217\000\224\000\217\000"
+ "\226\000\213\000\222\000s\000\227\000t\000\227\000\227\000\230\000t\000\230"
+ "\000s\000\220\000\220\000\227\000\226\000\227\000\217\000\227\000\225\000"
+ "\230\000\226\000\230\000\231\000\232\000\232\000\233\000\231\000\233\000"
+ "\233\000\234\000\231\000\234\000\235\000\236\000\234\000\236\000\234\000"
+ "\235\000\233\000\235\000\236\000\237\000\237\000\240\000\236\000\240\000"
+ "\234\000\240\000\231\000\241\000\234\000\241\000\240\000\241\000\242\000"
+ "\243\000\243\000\244\000\242\000\244\000\244\000\245\000\242\000\245\000"
+ "\243\000\246\000\246\000\247\000\243\000\247\000\244\000\247\000\236\000"
+ "\244\000\237\000\244\000\237\000\247\000\235\000\245\000\236\000\245\000"
+ "`\000\250\000z\000\250\000z\000\251\000\250\000\251\000w\000\252\000\251"
+ "\000\252\000w\000\251\000\237\000\252\000\247\000\252\000\247\000\251\000"
+ "\246\000\250\000\246\000\251\000t\000\253\000\253\000\254\000t\000\254\000"
+ "u\000\254\000\241\000\253\000\240\000\253\000\240\000\254\000\252\000\254"
+ "\000\237\000\254\000u\000\252\000\232\000\255\000\231\000\255\000\231\000"
+ "\256\000\255\000\256\000\241\000\257\000\256\000\257\000\241\000\256\000"
+ "\257\000\260\000\260\000\261\000\257\000\261\000\256\000\261\000\255\000"
+ "\262\000\256\000\262\000\261\000\262\000\230\000\253\000\230\000\263\000"
+ "\253\000\263\000\225\000\264\000\263\000\264\000\225\000\263\000\257\000"
+ "\263\000\260\000\263\000\260\000\264\000\253\000\257\000\212\000\265\000"
+ "\223\000\265\000\265\000\266\000\223\000\266\000\265\000\267\000\267\000"
+ "\270\000\265\000\270\000\266\000\270\000\264\000\266\000\260\000\266\000"
+ "\260\000\270\000\225\000\266\000\271\000\272\000\272\000\273\000\271\000"
+ "\273\000\273\000\274\000\271\000\274\000\261\000\274\000\262\000\274\000"
+ "\262\000\273\000\261\000\270\000\270\000\274\000\267\000\271\000\267\000"
+ "\274\000\272\000\275\000\271\000\275\000\271\000\276\000\275\000\276\000"
+ "\267\000\277\000\276\000\277\000\267\000\276\000\277\000\300\000\300\000"
+ "\301\000\277\000\301\000\276\000\301\000\275\000\302\000\276\000\302\000"
+ "\301\000\302\000\211\000\303\000\212\000\303\000\265\000\303\000\207\000"
+ "\304\000\211\000\304\000\303\000\304\000\277\000\303\000\300\000\303\000"
+ "\300\000\304\000\265\000\277\000f\000\305\000\205\000\305\000\305\000\306"
+ "\000\205\000\306\000\307\000\310\000\306\000\310\000\306\000\307\000\305"
+ "\000\307\000\300\000\310\000\304\000\310\000\304\000\306\000\207\000\306"
+ "\000\311\000\312\000\312\000\313\000\311\000\313\000\313\000\314\000\311"
+ "\000\314\000\302\000\312\000\301\000\312\000\301\000\313\000\310\000\313"
+ "\000\300\000\313\000\307\000\314\000\310\000\314\000\314\000\315\000\311"
+ "\000\315\000\315\000\316\000\311\000\316\000\307\000\317\000\314\000\317"
+ "\000\315\000\317\000\320\000\321\000\315\000\321\000\315\000\320\000\317"
+ "\000\320\000\321\000\322\000\316\000\322\000\316\000\321\000e\000\323\000"
+ "f\000\323\000\305\000\323\000c\000\324\000e\000\324\000\323\000\324\000\317"
+ "\000\323\000\320\000\323\000\320\000\324\000\305\000\317\000\250\000\325"
+ "\000`\000\325\000a\000\325\000\246\000\326\000\250\000\326\000\325\000\326"
+ "\000\324\000\325\000\320\000\325\000\320\000\326\000a\000\324\000\242\000"
+ "\327\000\327\000\330\000\242\000\330\000\243\000\330\000\322\000\327\000"
+ "\321\000\327\000\321\000\330\000\326\000\330\000\320\000\330\000\243\000"
+ "\326\000\311\000\331\000\316\000\331\000\316\000\332\000\331\000\332\000"
+ "\322\000\333\000\332\000\333\000\322\000\332\000\333\000\334\000\334\000"
+ "\335\000\333\000\335\000\332\000\335\000\331\000\336\000\332\000\336\000"
+ "\335\000\336\000\242\000\337\000\327\000\337\000\337\000\340\000\327\000"
+ "\340\000\341\000\342\000\340\000\342\000\340\000\341\000\337\000\341\000"
+ "\334\000\342\000\333\000\342\000\333\000\340\000\322\000\340\000\343\000"
+ "\344\000\344\000\345\000\343\000\345\000\345\000\346\000\343\000\346\000"
+ "\347\000\350\000\345\000\350\000\345\000\347\000\344\000\347\000\342\000"
+ "\345\000\334\000\345\000\334\000\350\000\341\000\346\000\341\000\345\000"
+ "\351\000\352\000\352\000\353\000\351\000\353\000\353\000\354\000\351\000"
+ "\354\000\335\000\353\000\336\000\353\000\336\000\352\000\350\000\353\000"
+ "\334\000\353\000\347\000\354\000\347\000\353\000\245\000\337\000\245\000"
+ "\355\000\337\000\355\000\235\000\356\000\355\000\356\000\235\000\355\000"
+ "\356\000\357\000\357\000\360\000\356\000\360\000\355\000\360\000\341\000"
+ "\355\000\341\000\360\000\232\000\361\000\361\000\362\000\232\000\362\000"
+ "\233\000\362\000\361\000\363\000\363\000\364\000\361\000\364\000\362\000"
+ "\364\000\356\000\362\000\357\000\362\000\357\000\364\000\233\000\356\000"
+ "\365\000\366\000\366\000\367\000\365\000\367\000\367\000\370\000\365\000"
+ "\370\000\371\000\372\000\370\000\372\000\370\000\371\000\367\000\371\000"
+ "\364\000\370\000\357\000\370\000\357\000\372\000\363\000\365\000\364\000"
+ "\365\000\346\000\373\000\343\000\373\000\373\000\374\000\343\000\374\000"
+ "\346\000\360\000\360\000\373\000\372\000\373\000\357\000\373\000\371\000"
+ "\374\000\371\000\373\000\255\000\375\000\232\000\375\000\361\000\375\000"
+ "\262\000\376\000\255\000\376\000\375\000\376\000\377\000\000\001\375\000"
+ "\000\001\375\000\377\000\376\000\377\000\363\000\000\001\361\000\000\001"
+ "\272\000\001\001\001\001\002\001\272\000\002\001\273\000\002\001\001\001"
+ "\003\001\003\001\004\001\001\001\004\001\002\001\004\001\376\000\002\001"
+ "\377\000\002\001\377\000\004\001\273\000\376\000\005\001\006\001\006\001"
+ "\007\001\005\001\007\001\007\001\010\001\005\001\010\001\011\001\012\001"
+ "\007\001\012\001\007\001\011\001\006\001\011\001\004\001\007\001\377\000"
+ "\007\001\377\000\012\001\003\001\010\001\004\001\010\001\365\000\013\001"
+ "\366\000\013\001\013\001\014\001\366\000\014\001\365\000\000\001\000\001"
+ "\013\001\012\001\013\001\377\000\013\001\011\001\014\001\011\001\013\001"
+ "\275\000\015\001\272\000\015\001\001\001\015\001\302\000\016\001\275\000"
+ "\016\001\015\001\016\001\017\001\020\001\015\001\020\001\015\001\017\001"
+ "\016\001\017\001\003\001\020\001\001\001\020\001\312\000\331\000\331\000"
+ "\021\001\312\000\021\001\336\000\022\001\021\001\022\001\336\000\021\001"
+ "\017\001\022\001\016\001\022\001\016\001\021\001\302\000\021\001\351\000"
+ "\023\001\023\001\024\001\351\000\024\001\352\000\024\001\025\001\026\001"
+ "\024\001\026\001\024\001\025\001\023\001\025\001\022\001\024\001\017\001"
+ "\024\001\017\001\026\001\352\000\022\001\005\001\027\001\010\001\027\001"
+ "\010\001\030\001\027\001\030\001\010\001\020\001\020\001\030\001\026\001"
+ "\030\001\017\001\030\001\025\001\027\001\025\001\030\001\374\000\031\001"
+ "\343\000\031\001\344\000\031\001\371\000\032\001\374\000\032\001\031\001"
+ "\032\001\033\001\034\001\031\001\034\001\031\001\033\001\032\001\033\001"
+ "\347\000\034\001\344\000\034\001\014\001\035\001\366\000\035\001\367\000"
+ "\035\001\011\001\036\001\014\001\036\001\035\001\036\001\032\001\035\001"
+ "\033\001\035\001\033\001\036\001\367\000\032\001\027\001\037\001\005\001"
+ "\037\001\006\001\037\001\025\001 \001\027\001 \001\037\001 \001\036\001\037"
+ "\001\033\001\037\001\033\001 \001\006\001\036\001\354\000!\001\351\000!\001"
+ "\023\001!\001\354\000\034\001\034\001!\001 \001!\001\033\001!\001\023\001"
+ " \001"
+;
+const unsigned long s1_3_size = 9892;
@@ -1,1733 +1,479 @@
+/* Generated from "s1_4.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	-0.342337,-0.675989,-0.652567,1.284897,0.013483,-0.674188,
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.342337,-0.675989,-0.652567,1.284897,0.013483,-0.674188,
-	-0.802735,-0.496752,-0.329932,1.231827,0.004686,-0.594296,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.342337,-0.675989,0.652567,1.284897,0.013483,-0.325812,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.342337,-0.675989,0.652567,1.284897,0.013483,-0.325812,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.802735,-0.496752,0.329932,1.231827,0.004686,-0.405704,
-	-0.829744,-0.558144,0,1.221734,-0.007055,-0.5,
-	0.581551,-0.793452,0.179534,1.331736,0.017726,-0.361333,
-	0.6,-0.793691,0.100277,1.3177,-0.004566,-0.4175,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	0.581551,-0.793452,0.179534,1.331736,0.017726,-0.361333,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.184945,-0.982749,0,1.270418,-0.038526,-0.5,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	0.6,-0.793691,0.100277,1.3177,-0.004566,-0.4175,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	0.184945,-0.982749,0,1.270418,-0.038526,-0.5,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	-0.342337,-0.675989,0.652567,1.284897,0.013483,-0.325812,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.266434,-0.94535,0.187955,1.279887,-0.026194,-0.4125,
-	-0.429143,-0.839932,0.332191,1.253444,-0.022303,-0.405051,
-	0.581551,-0.793452,-0.179534,1.331736,0.017726,-0.638667,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	0.581551,-0.793452,-0.179534,1.331736,0.017726,-0.638667,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	0.6,-0.793691,-0.100277,1.3177,-0.004566,-0.5825,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	-0.342337,-0.675989,-0.652567,1.284897,0.013483,-0.674188,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	0.184945,-0.982749,0,1.270418,-0.038526,-0.5,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	-0.372431,-0.92806,0,1.243033,-0.034453,-0.5,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	-0.429143,-0.839931,-0.332192,1.253444,-0.022303,-0.594949,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.6,-0.793691,-0.100277,1.3177,-0.004566,-0.5825,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.266434,-0.94535,-0.187955,1.279887,-0.026194,-0.5875,
-	0.184945,-0.982749,0,1.270418,-0.038526,-0.5,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	-0.342337,-0.675989,0.652567,1.284897,0.013483,-0.325812,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.632405,-0.365743,0.682858,1.262105,0.039911,-0.327123,
-	-0.363086,-0.142915,0.92073,1.312568,0.09862,-0.279975,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	0.074097,0.34389,0.936082,1.38723,0.275032,-0.291188,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	0.074097,0.34389,0.936082,1.38723,0.275032,-0.291188,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	0.113526,0.358822,0.926476,1.433681,0.239521,-0.279975,
-	-0.10731,0.091019,0.990051,1.373124,0.16907,-0.264259,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.85656,-0.215911,0.468709,1.524471,0.247261,-0.339125,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.725947,-0.653645,0.21389,1.4295,0.116294,-0.322437,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.85656,-0.215911,0.468709,1.524471,0.247261,-0.339125,
-	0.85656,-0.215911,0.468709,1.524471,0.247261,-0.339125,
-	0.736468,-0.384081,0.556864,1.476277,0.191919,-0.294,
-	0.422175,0.108161,0.900039,1.463411,0.213552,-0.277994,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.581551,-0.793452,0.179534,1.331736,0.017726,-0.361333,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.432476,-0.665439,0.608404,1.359179,0.061869,-0.294,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	-0.342337,-0.675989,0.652567,1.284897,0.013483,-0.325812,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	0.432476,-0.665439,0.608404,1.359179,0.061869,-0.294,
-	0.307416,-0.846879,0.433925,1.309178,0.008154,-0.339125,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.432476,-0.665439,0.608404,1.359179,0.061869,-0.294,
-	0.221822,-0.232839,0.94688,1.400739,0.142695,-0.26194,
-	0.432476,-0.665439,0.608404,1.359179,0.061869,-0.294,
-	-0.050406,-0.482634,0.874371,1.337615,0.072243,-0.277994,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.725947,-0.653645,0.21389,1.4295,0.116294,-0.322437,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.432476,-0.665439,0.608404,1.359179,0.061869,-0.294,
-	0.64097,-0.57721,0.50595,1.418631,0.126081,-0.2785,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.765648,0.567983,0.301958,1.547582,0.308099,-0.405051,
-	0.765648,0.567983,0.301958,1.547582,0.308099,-0.405051,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.365915,0.616651,0.697028,1.484144,0.298229,-0.327123,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.507038,0.792213,0.339576,1.514422,0.333454,-0.405704,
-	0.765648,0.567983,0.301958,1.547582,0.308099,-0.405051,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.765648,0.567983,-0.301958,1.547582,0.308099,-0.594949,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	0.765648,0.567983,-0.301958,1.547582,0.308099,-0.594949,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.765648,0.567983,-0.301958,1.547582,0.308099,-0.594949,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.507038,0.792213,-0.339576,1.514422,0.333454,-0.594296,
-	0.561935,0.827181,0,1.524515,0.345196,-0.5,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.85206,-0.513749,-0.100278,1.538011,0.240115,-0.5825,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.85656,-0.215911,-0.468708,1.524471,0.247261,-0.660875,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.997731,-0.067332,0,1.566843,0.290687,-0.5,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.85206,-0.513749,-0.100278,1.538011,0.240115,-0.5825,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.765648,0.567983,-0.301958,1.547582,0.308099,-0.594949,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.997731,-0.067332,0,1.566843,0.290687,-0.5,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.85656,-0.215911,-0.468708,1.524471,0.247261,-0.660875,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.967592,-0.122072,-0.221053,1.555568,0.279982,-0.5875,
-	0.765648,0.567983,-0.301958,1.547582,0.308099,-0.594949,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.85656,-0.215911,0.468709,1.524471,0.247261,-0.339125,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.85206,-0.513749,0.100278,1.538011,0.240115,-0.4175,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.765648,0.567983,0.301958,1.547582,0.308099,-0.405051,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.704743,0.348932,0.617724,1.515677,0.27272,-0.325812,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.85656,-0.215911,0.468709,1.524471,0.247261,-0.339125,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.997731,-0.067332,0,1.566843,0.290687,-0.5,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.887347,0.461103,0,1.558444,0.319842,-0.5,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.765648,0.567983,0.301958,1.547582,0.308099,-0.405051,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.85206,-0.513749,0.100278,1.538011,0.240115,-0.4175,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.967592,-0.122072,0.221053,1.555568,0.279982,-0.4125,
-	0.997731,-0.067332,0,1.566843,0.290687,-0.5,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.074097,0.34389,-0.936082,1.38723,0.275032,-0.708812,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	0.074097,0.34389,-0.936082,1.38723,0.275032,-0.708812,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	0.365915,0.616651,-0.697028,1.484144,0.298229,-0.672877,
-	0.113526,0.358822,-0.926476,1.433681,0.239521,-0.720025,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	-0.342337,-0.675989,-0.652567,1.284897,0.013483,-0.674188,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	-0.632405,-0.365743,-0.682858,1.262105,0.039911,-0.672877,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.363086,-0.142915,-0.92073,1.312568,0.09862,-0.720025,
-	-0.10731,0.091019,-0.990051,1.373124,0.16907,-0.735741,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	0.581551,-0.793452,-0.179534,1.331736,0.017726,-0.638667,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.432476,-0.665439,-0.608404,1.359179,0.061869,-0.706,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.725947,-0.653645,-0.21389,1.4295,0.116294,-0.677562,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	0.432476,-0.665439,-0.608404,1.359179,0.061869,-0.706,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	0.432476,-0.665439,-0.608404,1.359179,0.061869,-0.706,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	0.432476,-0.665439,-0.608404,1.359179,0.061869,-0.706,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	-0.342337,-0.675989,-0.652567,1.284897,0.013483,-0.674188,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	0.307416,-0.846879,-0.433925,1.309178,0.008154,-0.660875,
-	0.432476,-0.665439,-0.608404,1.359179,0.061869,-0.706,
-	-0.050406,-0.482634,-0.87437,1.337615,0.072243,-0.722006,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.85656,-0.215911,-0.468708,1.524471,0.247261,-0.660875,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.85656,-0.215911,-0.468708,1.524471,0.247261,-0.660875,
-	0.704744,0.348932,-0.617724,1.515677,0.27272,-0.674188,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.85656,-0.215911,-0.468708,1.524471,0.247261,-0.660875,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.221822,-0.232839,-0.94688,1.400739,0.142695,-0.73806,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.422175,0.108161,-0.900039,1.463411,0.213552,-0.722006,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	0.725947,-0.653645,-0.21389,1.4295,0.116294,-0.677562,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.736467,-0.384081,-0.556864,1.476277,0.191919,-0.706,
-	0.64097,-0.577211,-0.50595,1.418631,0.126081,-0.7215,
-	0.581551,-0.793452,0.179534,1.331736,0.017726,-0.361333,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.581551,-0.793452,0.179534,1.331736,0.017726,-0.361333,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.6,-0.793691,0.100277,1.3177,-0.004566,-0.4175,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.725947,-0.653645,0.21389,1.4295,0.116294,-0.322437,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.649588,-0.728866,0.216309,1.372652,0.056465,-0.335375,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.6,-0.793691,0.100277,1.3177,-0.004566,-0.4175,
-	0.6,-0.793691,0.100277,1.3177,-0.004566,-0.4175,
-	0.685049,-0.72412,0.079739,1.373428,0.045002,-0.4095,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.85206,-0.513749,0.100278,1.538011,0.240115,-0.4175,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.846384,-0.493864,0.199328,1.517309,0.223825,-0.361333,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.85206,-0.513749,0.100278,1.538011,0.240115,-0.4175,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.85206,-0.513749,0.100278,1.538011,0.240115,-0.4175,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.725947,-0.653645,0.21389,1.4295,0.116294,-0.322437,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.786785,-0.580419,0.209959,1.483059,0.179084,-0.335375,
-	0.791761,-0.605604,0.079739,1.49454,0.179511,-0.4095,
-	0.740458,-0.666711,0.08496,1.436048,0.110398,-0.40225,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.846384,-0.493864,-0.199329,1.517309,0.223825,-0.638667,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.85206,-0.513749,-0.100278,1.538011,0.240115,-0.5825,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.725947,-0.653645,-0.21389,1.4295,0.116294,-0.677562,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.786785,-0.580419,-0.209959,1.483059,0.179084,-0.664625,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.88422,-0.467071,0,1.548313,0.248248,-0.5,
-	0.85206,-0.513749,-0.100278,1.538011,0.240115,-0.5825,
-	0.85206,-0.513749,-0.100278,1.538011,0.240115,-0.5825,
-	0.791761,-0.605604,-0.079739,1.49454,0.179511,-0.5905,
-	0.797307,-0.603573,0,1.501456,0.18304,-0.5,
-	0.581551,-0.793452,-0.179534,1.331736,0.017726,-0.638667,
-	0.6,-0.793691,-0.100277,1.3177,-0.004566,-0.5825,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.581551,-0.793452,-0.179534,1.331736,0.017726,-0.638667,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.6,-0.793691,-0.100277,1.3177,-0.004566,-0.5825,
-	0.556938,-0.830554,0,1.310688,-0.015661,-0.5,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.6,-0.793691,-0.100277,1.3177,-0.004566,-0.5825,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.743145,-0.669131,0,1.438241,0.108423,-0.5,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.683609,-0.729849,0,1.370641,0.037756,-0.5,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	0.725947,-0.653645,-0.21389,1.4295,0.116294,-0.677562,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.649588,-0.728866,-0.216309,1.372652,0.056465,-0.664625,
-	0.685049,-0.72412,-0.079739,1.373428,0.045002,-0.5905,
-	0.740458,-0.666711,-0.08496,1.436048,0.110398,-0.59775,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.858311,-0.411605,-0.306404,1.208797,0.050229,-0.589491,
-	-0.84747,-0.443196,-0.292185,1.178115,0.10978,-0.584482,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.547648,-0.532516,-0.645374,1.112441,0.256132,-0.640641,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	-0.417976,-0.908458,0,1.064065,0.250523,-0.5,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.547648,-0.532516,-0.645374,1.112441,0.256132,-0.640641,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.696441,-0.651142,-0.301635,1.103513,0.226037,-0.576713,
-	-0.813982,-0.512235,-0.273951,1.142211,0.172121,-0.579984,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	-0.547648,-0.532516,0.645374,1.112441,0.256132,-0.359359,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.547648,-0.532516,0.645374,1.112441,0.256132,-0.359359,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.417976,-0.908458,0,1.064065,0.250523,-0.5,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	-0.696441,-0.651142,0.301635,1.103513,0.226037,-0.423287,
-	-0.753723,-0.657192,0,1.100538,0.216006,-0.5,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.900624,-0.4346,0,1.199875,0.038989,-0.5,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.858311,-0.411604,0.306404,1.208797,0.050229,-0.410509,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.860968,-0.508659,0,1.136909,0.161755,-0.5,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.891261,-0.453491,0,1.170811,0.099004,-0.5,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.84747,-0.443196,0.292185,1.178115,0.10978,-0.415518,
-	-0.813982,-0.512235,0.273951,1.142211,0.172121,-0.420016,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	0.074097,0.34389,-0.936082,1.38723,0.275032,-0.708812,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	0.074097,0.34389,-0.936082,1.38723,0.275032,-0.708812,
-	0.074097,0.34389,-0.936082,1.38723,0.275032,-0.708812,
-	0.12092,0.358415,-0.925698,1.324207,0.325294,-0.697124,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.08947,0.74633,-0.659535,1.074101,0.505017,-0.638205,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.115814,0.384301,-0.915915,1.163029,0.426667,-0.678998,
-	0.126992,0.363932,-0.922728,1.248257,0.379456,-0.686629,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	-0.547648,-0.532516,-0.645374,1.112441,0.256132,-0.640641,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	-0.547648,-0.532516,-0.645374,1.112441,0.256132,-0.640641,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.547648,-0.532516,-0.645374,1.112441,0.256132,-0.640641,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	-0.30711,-0.324628,-0.894595,1.12732,0.306289,-0.678998,
-	-0.066606,0.01431,-0.997677,1.145175,0.366478,-0.691783,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.695773,-0.304145,-0.650689,1.235562,0.083949,-0.664066,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.152737,0.118235,-0.981169,1.3337,0.207591,-0.723727,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.420703,-0.10775,-0.900777,1.28017,0.14015,-0.708812,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	-0.106175,0.048409,-0.993168,1.216443,0.317256,-0.69996,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.127933,0.082246,-0.988367,1.280379,0.26064,-0.711204,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.687216,-0.351805,-0.635584,1.200029,0.142107,-0.654883,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.659424,-0.432639,-0.614804,1.158118,0.203222,-0.646637,
-	-0.406685,-0.158703,-0.899678,1.236552,0.195985,-0.697124,
-	-0.382336,-0.228691,-0.895276,1.18463,0.255055,-0.686629,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.074097,0.34389,0.936082,1.38723,0.275032,-0.291188,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.074097,0.34389,0.936082,1.38723,0.275032,-0.291188,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	0.074097,0.34389,0.936082,1.38723,0.275032,-0.291188,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.12092,0.358415,0.925698,1.324207,0.325294,-0.302876,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	-0.695773,-0.304144,0.650689,1.235562,0.083949,-0.335934,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.687216,-0.351805,0.635584,1.200029,0.142107,-0.345117,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	-0.420703,-0.10775,0.900777,1.28017,0.14015,-0.291188,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.152737,0.118235,0.981169,1.3337,0.207591,-0.276273,
-	-0.406685,-0.158702,0.899678,1.236552,0.195985,-0.302876,
-	-0.127934,0.082246,0.988367,1.280379,0.26064,-0.288796,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.547648,-0.532516,0.645374,1.112441,0.256132,-0.359359,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	-0.659424,-0.432639,0.614804,1.158118,0.203222,-0.353363,
-	-0.547648,-0.532516,0.645374,1.112441,0.256132,-0.359359,
-	-0.547648,-0.532516,0.645374,1.112441,0.256132,-0.359359,
-	-0.30711,-0.324628,0.894595,1.12732,0.306289,-0.321002,
-	-0.382336,-0.228691,0.895276,1.18463,0.255055,-0.313371,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.08947,0.74633,0.659535,1.074101,0.505017,-0.361795,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	-0.106175,0.048409,0.993168,1.216443,0.317256,-0.30004,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	0.126992,0.363931,0.922728,1.248257,0.379456,-0.313371,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	0.115814,0.384301,0.915915,1.163029,0.426667,-0.321002,
-	-0.066605,0.01431,0.997677,1.145175,0.366478,-0.308217,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.311074,0.63183,-0.709947,1.431839,0.331232,-0.664066,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.460195,0.823869,-0.330849,1.458604,0.364953,-0.589491,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	0.339667,0.655519,-0.674478,1.36073,0.379173,-0.654883,
-	0.4628,0.825265,-0.323657,1.382643,0.4115,-0.584482,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.311074,0.63183,0.709947,1.431839,0.331232,-0.335934,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.339667,0.655519,0.674478,1.36073,0.379173,-0.345117,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.489941,0.871755,0,1.467526,0.376193,-0.5,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.460195,0.823869,0.330849,1.458604,0.364953,-0.410509,
-	0.4628,0.825265,0.323657,1.382643,0.4115,-0.415518,
-	0.499794,0.866144,0,1.389948,0.422275,-0.5,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.08947,0.74633,0.659535,1.074101,0.505017,-0.361795,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.225321,0.739198,0.634679,1.177908,0.476825,-0.359359,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.306584,0.689695,0.655994,1.274769,0.43129,-0.353363,
-	0.298199,0.907962,0.294419,1.186836,0.506919,-0.423287,
-	0.40832,0.858475,0.310315,1.290676,0.46239,-0.420016,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	0.08947,0.74633,-0.659535,1.074101,0.505017,-0.638205,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.306584,0.689695,-0.655994,1.274769,0.43129,-0.646637,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.225321,0.739198,-0.634679,1.177908,0.476825,-0.640641,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.445921,0.895072,0,1.295978,0.472757,-0.5,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.408321,0.858475,-0.310315,1.290676,0.46239,-0.579984,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	0.298199,0.907962,-0.294419,1.186836,0.506919,-0.576713,
-	0.336559,0.941662,0,1.189812,0.516951,-0.5,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.044996,0.438512,-0.897598,0.808756,0.407522,-0.697124,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.585878,-0.414463,-0.696396,0.940757,0.242249,-0.654883,
-	0.585878,-0.414463,-0.696396,0.940757,0.242249,-0.654883,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.585878,-0.414463,-0.696396,0.940757,0.242249,-0.654883,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.362669,-0.212082,-0.907465,0.901933,0.290859,-0.697124,
-	0.142808,0.115868,-0.982945,0.855345,0.34919,-0.711204,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	0.118719,-0.361063,-0.924954,1.008203,0.340968,-0.678998,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	0.118719,-0.361063,-0.924954,1.008203,0.340968,-0.678998,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	0.118719,-0.361063,-0.924954,1.008203,0.340968,-0.678998,
-	-0.094868,-0.409964,-0.907155,1.067539,0.338617,-0.675897,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.118719,-0.361063,-0.924954,1.008203,0.340968,-0.678998,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.118719,-0.361063,-0.924954,1.008203,0.340968,-0.678998,
-	0.281388,-0.318777,-0.905098,0.952079,0.322122,-0.686629,
-	0.08947,0.74633,-0.659535,1.074101,0.505017,-0.638205,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	0.08947,0.74633,-0.659535,1.074101,0.505017,-0.638205,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	0.124797,0.069981,-0.989711,0.920924,0.379919,-0.69996,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	-0.024081,0.437847,-0.898727,0.88977,0.437716,-0.686629,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	0.012548,-0.001301,-0.99992,1.069855,0.397346,-0.688461,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	0.076521,0.412911,-0.907551,1.072171,0.456076,-0.675897,
-	0.017449,0.433004,-0.901223,0.97933,0.45683,-0.678998,
-	0.086047,0.023651,-0.99601,0.993766,0.398899,-0.691783,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.199176,0.745044,-0.636583,0.769932,0.456132,-0.654883,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.283565,0.912815,-0.293871,0.746638,0.485298,-0.584482,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	0.08947,0.74633,-0.659535,1.074101,0.505017,-0.638205,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	-0.090849,0.947666,-0.306066,0.960081,0.534071,-0.576713,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.090849,0.947666,-0.306066,0.960081,0.534071,-0.576713,
-	0.099282,0.948291,-0.301476,1.075259,0.534381,-0.575384,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	-0.090849,0.947666,-0.306066,0.960081,0.534071,-0.576713,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.041682,0.78334,-0.620195,0.967299,0.505105,-0.640641,
-	-0.090849,0.947666,-0.306066,0.960081,0.534071,-0.576713,
-	-0.142137,0.766468,-0.626358,0.863808,0.485881,-0.646637,
-	-0.090849,0.947666,-0.306066,0.960081,0.534071,-0.576713,
-	-0.20497,0.936687,-0.283911,0.848231,0.51478,-0.579984,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	0.08947,0.74633,0.659535,1.074101,0.505017,-0.361795,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	-0.090849,0.947666,0.306066,0.960081,0.534071,-0.423287,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.090849,0.947666,0.306066,0.960081,0.534071,-0.423287,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.090849,0.947666,0.306066,0.960081,0.534071,-0.423287,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.090849,0.947666,0.306066,0.960081,0.534071,-0.423287,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	0.156232,0.98772,0,1.075645,0.544169,-0.5,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	0.099282,0.948291,0.301476,1.075259,0.534381,-0.424615,
-	-0.090849,0.947666,0.306066,0.960081,0.534071,-0.423287,
-	-0.084634,0.996412,0,0.957675,0.543726,-0.5,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.237278,0.971442,0,0.843038,0.524412,-0.5,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.314129,0.94938,0,0.738873,0.49502,-0.5,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.283565,0.912815,0.293871,0.746638,0.485298,-0.415518,
-	-0.20497,0.936687,0.283911,0.848231,0.51478,-0.420016,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	-0.199176,0.745044,0.636583,0.769932,0.456132,-0.345117,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	-0.044996,0.438512,0.897598,0.808756,0.407522,-0.302876,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	0.08947,0.74633,0.659535,1.074101,0.505017,-0.361795,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	0.08947,0.74633,0.659535,1.074101,0.505017,-0.361795,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	0.076521,0.412911,0.907551,1.072171,0.456076,-0.324103,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	-0.142137,0.766468,0.626358,0.863808,0.485881,-0.353363,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	-0.041682,0.78334,0.620195,0.967299,0.505105,-0.359359,
-	0.017449,0.433004,0.901223,0.97933,0.45683,-0.321002,
-	-0.024081,0.437847,0.898727,0.88977,0.437716,-0.313371,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.118719,-0.361063,0.924954,1.008203,0.340968,-0.321002,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.118719,-0.361063,0.924954,1.008203,0.340968,-0.321002,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	0.118719,-0.361063,0.924954,1.008203,0.340968,-0.321002,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	-0.094868,-0.409964,0.907155,1.067539,0.338617,-0.324103,
-	0.118719,-0.361063,0.924954,1.008203,0.340968,-0.321002,
-	0.012549,-0.001301,0.99992,1.069855,0.397346,-0.311539,
-	0.118719,-0.361063,0.924954,1.008203,0.340968,-0.321002,
-	0.086047,0.023651,0.99601,0.993766,0.398899,-0.308217,
-	0.585878,-0.414463,0.696396,0.940757,0.242249,-0.345117,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.585878,-0.414463,0.696396,0.940757,0.242249,-0.345117,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.124797,0.069981,0.989711,0.920924,0.379919,-0.30004,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.142808,0.115868,0.982945,0.855345,0.34919,-0.288796,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.585878,-0.414463,0.696396,0.940757,0.242249,-0.345117,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.362669,-0.212082,0.907465,0.901933,0.290859,-0.302876,
-	0.281389,-0.318776,0.905098,0.952079,0.322122,-0.313371,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.585878,-0.414463,0.696396,0.940757,0.242249,-0.345117,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.575394,-0.755507,0.31326,0.993618,0.245059,-0.420016,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.585878,-0.414463,0.696396,0.940757,0.242249,-0.345117,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.575394,-0.755507,0.31326,0.993618,0.245059,-0.420016,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.748153,-0.579603,0.322997,0.964051,0.213083,-0.415518,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	-0.30458,-0.744204,0.594467,1.065609,0.289676,-0.361795,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	-0.417976,-0.908458,0,1.064065,0.250523,-0.5,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	-0.393741,-0.892942,0.218225,1.064451,0.260311,-0.424615,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.575394,-0.755507,0.31326,0.993618,0.245059,-0.420016,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	0.575394,-0.755507,0.31326,0.993618,0.245059,-0.420016,
-	0.514373,-0.562786,0.647064,0.978041,0.273957,-0.353363,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.223486,-0.713834,0.663698,1.020234,0.292692,-0.359359,
-	0.224558,-0.931869,0.284944,1.027452,0.263727,-0.423287,
-	0.575394,-0.755507,0.31326,0.993618,0.245059,-0.420016,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	-0.30458,-0.744204,-0.594467,1.065609,0.289676,-0.638205,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.575393,-0.755507,-0.31326,0.993618,0.245059,-0.579984,
-	0.575393,-0.755507,-0.31326,0.993618,0.245059,-0.579984,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	0.223486,-0.713834,-0.663698,1.020234,0.292692,-0.640641,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	0.575393,-0.755507,-0.31326,0.993618,0.245059,-0.579984,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	-0.417976,-0.908458,0,1.064065,0.250523,-0.5,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	-0.39374,-0.892943,-0.218225,1.064451,0.260311,-0.575384,
-	0.224558,-0.931869,-0.284944,1.027452,0.263727,-0.576713,
-	0.113113,-0.993582,0,1.029858,0.254072,-0.5,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.585878,-0.414463,-0.696396,0.940757,0.242249,-0.654883,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.575393,-0.755507,-0.31326,0.993618,0.245059,-0.579984,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.637531,-0.770425,0,0.998811,0.235426,-0.5,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.82345,-0.567389,0,0.971816,0.203361,-0.5,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.585878,-0.414463,-0.696396,0.940757,0.242249,-0.654883,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.514373,-0.562786,-0.647064,0.978041,0.273957,-0.646637,
-	0.748153,-0.579603,-0.322997,0.964051,0.213083,-0.584482,
-	0.575393,-0.755507,-0.31326,0.993618,0.245059,-0.579984,
-	0.65574,-0.380493,0.652097,0.887817,0.175019,-0.327123,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.65574,-0.380493,0.652097,0.887817,0.175019,-0.327123,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.828154,-0.461264,0.318428,0.939852,0.176575,-0.410509,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	0.520237,-0.801686,0.294369,0.90384,0.122594,-0.405051,
-	0.520237,-0.801686,0.294369,0.90384,0.122594,-0.405051,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	0.65574,-0.380493,0.652097,0.887817,0.175019,-0.327123,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	0.788892,-0.514111,0.336659,0.922122,0.14431,-0.405704,
-	0.520237,-0.801686,0.294369,0.90384,0.122594,-0.405051,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.65574,-0.380493,-0.652097,0.887817,0.175019,-0.672877,
-	0.65574,-0.380493,-0.652097,0.887817,0.175019,-0.672877,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	0.520237,-0.801686,-0.29437,0.90384,0.122594,-0.594949,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.65574,-0.380493,-0.652097,0.887817,0.175019,-0.672877,
-	0.520237,-0.801686,-0.29437,0.90384,0.122594,-0.594949,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.520237,-0.801686,-0.29437,0.90384,0.122594,-0.594949,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.828154,-0.461264,-0.318429,0.939852,0.176575,-0.589491,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.879883,-0.475191,0,0.949767,0.166652,-0.5,
-	0.788892,-0.514111,-0.336659,0.922122,0.14431,-0.594296,
-	0.818537,-0.574454,0,0.933557,0.134073,-0.5,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.4837,-0.869471,-0.100277,0.83753,0.13389,-0.5825,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	-0.23383,-0.86988,-0.434318,0.844199,0.147671,-0.660875,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.093893,-0.995582,0,0.889078,0.10684,-0.5,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	-0.4837,-0.869471,-0.100277,0.83753,0.13389,-0.5825,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	0.520237,-0.801686,-0.29437,0.90384,0.122594,-0.594949,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	-0.093893,-0.995582,0,0.889078,0.10684,-0.5,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	-0.23383,-0.86988,-0.434318,0.844199,0.147671,-0.660875,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	-0.146037,-0.967926,-0.204432,0.877985,0.117734,-0.5875,
-	0.520237,-0.801686,-0.29437,0.90384,0.122594,-0.594949,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.23383,-0.86988,0.434318,0.844199,0.147671,-0.339125,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	-0.4837,-0.869471,0.100277,0.83753,0.13389,-0.4175,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	0.520237,-0.801686,0.294369,0.90384,0.122594,-0.405051,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	-0.23383,-0.86988,0.434318,0.844199,0.147671,-0.339125,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	-0.093893,-0.995582,0,0.889078,0.10684,-0.5,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	0.394485,-0.918903,0,0.915792,0.112008,-0.5,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	0.520237,-0.801686,0.294369,0.90384,0.122594,-0.405051,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.4837,-0.869471,0.100277,0.83753,0.13389,-0.4175,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.146037,-0.967926,0.204432,0.877985,0.117734,-0.4125,
-	-0.093893,-0.995582,0,0.889078,0.10684,-0.5,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.66282,-0.338306,-0.667996,0.910107,0.206343,-0.664066,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.65574,-0.380493,-0.652097,0.887817,0.175019,-0.672877,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.398283,-0.122544,-0.90904,0.860532,0.255958,-0.708812,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	0.65574,-0.380493,-0.652097,0.887817,0.175019,-0.672877,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	0.378094,-0.147323,-0.91397,0.830643,0.2262,-0.720025,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.638487,0.393678,-0.661326,0.60431,0.378335,-0.674188,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	0.160738,0.160922,-0.97379,0.801042,0.315496,-0.723727,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	-0.042916,0.448451,-0.892776,0.741552,0.375033,-0.708812,
-	-0.106617,0.392034,-0.913752,0.693423,0.349037,-0.720025,
-	0.108083,0.116579,-0.987283,0.762033,0.287619,-0.735741,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.772673,-0.608887,-0.179534,0.608078,0.332278,-0.638667,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.635534,-0.736296,-0.232302,0.709997,0.238013,-0.677562,
-	-0.531095,-0.656282,-0.53594,0.719399,0.249218,-0.7215,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.635534,-0.736296,-0.232302,0.709997,0.238013,-0.677562,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.531095,-0.656282,-0.53594,0.719399,0.249218,-0.7215,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	-0.638487,0.393678,-0.661326,0.60431,0.378335,-0.674188,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.660431,-0.496512,-0.563299,0.653151,0.306393,-0.706,
-	-0.462569,0.070189,-0.8838,0.66406,0.327,-0.722006,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.23383,-0.86988,-0.434318,0.844199,0.147671,-0.660875,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.23383,-0.86988,-0.434318,0.844199,0.147671,-0.660875,
-	0.31991,-0.691022,-0.648187,0.867858,0.153664,-0.674188,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	-0.23383,-0.86988,-0.434318,0.844199,0.147671,-0.660875,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	-0.531095,-0.656282,-0.53594,0.719399,0.249218,-0.7215,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	-0.233968,-0.2359,-0.943191,0.735693,0.265534,-0.73806,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	0.024413,-0.469703,-0.882487,0.807717,0.204533,-0.722006,
-	-0.531095,-0.656282,-0.53594,0.719399,0.249218,-0.7215,
-	-0.635534,-0.736296,-0.232302,0.709997,0.238013,-0.677562,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.376394,-0.756788,-0.534415,0.787209,0.193905,-0.706,
-	-0.531095,-0.656282,-0.53594,0.719399,0.249218,-0.7215,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.218035,0.735069,-0.641977,0.691977,0.424648,-0.664066,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.31842,0.898971,-0.300764,0.662233,0.454417,-0.589491,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.638487,0.393678,-0.661326,0.60431,0.378335,-0.674188,
-	-0.304611,0.675798,-0.6712,0.636249,0.400218,-0.672877,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.638487,0.393678,-0.661326,0.60431,0.378335,-0.674188,
-	-0.419827,0.848984,-0.320893,0.601944,0.430927,-0.594296,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.638487,0.393678,0.661326,0.60431,0.378335,-0.325812,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.638487,0.393678,0.661326,0.60431,0.378335,-0.325812,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.318419,0.898972,0.300764,0.662233,0.454417,-0.410509,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.346116,0.938192,0,0.652318,0.46434,-0.5,
-	-0.419827,0.848984,0.320893,0.601944,0.430927,-0.405704,
-	-0.477849,0.878442,0,0.590509,0.441164,-0.5,
-	-0.772673,-0.608887,0.179534,0.608078,0.332278,-0.361333,
-	-0.772268,-0.627334,0.100277,0.58531,0.345528,-0.4175,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.772673,-0.608887,0.179534,0.608078,0.332278,-0.361333,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.985168,-0.171594,0,0.54972,0.391595,-0.5,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.772268,-0.627334,0.100277,0.58531,0.345528,-0.4175,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.985168,-0.171594,0,0.54972,0.391595,-0.5,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.638487,0.393678,0.661326,0.60431,0.378335,-0.325812,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.944453,-0.263136,0.196897,0.562375,0.382563,-0.4125,
-	-0.801358,0.491779,0.340556,0.567937,0.40894,-0.405051,
-	-0.772673,-0.608887,-0.179534,0.608078,0.332278,-0.638667,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.772673,-0.608887,-0.179534,0.608078,0.332278,-0.638667,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.772268,-0.627334,-0.100277,0.58531,0.345528,-0.5825,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.638487,0.393678,-0.661326,0.60431,0.378335,-0.674188,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.838454,-0.308168,-0.449475,0.597724,0.354488,-0.660875,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.985168,-0.171594,0,0.54972,0.391595,-0.5,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.89858,0.43881,0,0.555594,0.41906,-0.5,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.801359,0.491779,-0.340556,0.567937,0.40894,-0.594949,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.772268,-0.627334,-0.100277,0.58531,0.345528,-0.5825,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.944453,-0.263136,-0.196896,0.562375,0.382563,-0.5875,
-	-0.985168,-0.171594,0,0.54972,0.391595,-0.5,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	-0.218035,0.735069,0.641977,0.691977,0.424648,-0.335934,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	-0.042916,0.448451,0.892776,0.741552,0.375033,-0.291188,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	-0.638487,0.393678,0.661326,0.60431,0.378335,-0.325812,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.304611,0.675798,0.6712,0.636249,0.400218,-0.327123,
-	-0.106617,0.392034,0.913752,0.693423,0.349037,-0.279975,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.65574,-0.380493,0.652097,0.887817,0.175019,-0.327123,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.66282,-0.338306,0.667996,0.910107,0.206343,-0.335934,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.65574,-0.380493,0.652097,0.887817,0.175019,-0.327123,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	0.398283,-0.122544,0.90904,0.860532,0.255958,-0.291188,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.160738,0.160922,0.97379,0.801042,0.315496,-0.276273,
-	0.378094,-0.147323,0.91397,0.830643,0.2262,-0.279975,
-	0.108083,0.116579,0.987283,0.762033,0.287619,-0.264259,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	-0.23383,-0.86988,0.434318,0.844199,0.147671,-0.339125,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.635534,-0.736296,0.232302,0.709997,0.238013,-0.322437,
-	-0.531095,-0.656282,0.53594,0.719399,0.249218,-0.2785,
-	-0.531095,-0.656282,0.53594,0.719399,0.249218,-0.2785,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	-0.531095,-0.656282,0.53594,0.719399,0.249218,-0.2785,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	0.31991,-0.691022,0.648187,0.867858,0.153664,-0.325812,
-	-0.23383,-0.86988,0.434318,0.844199,0.147671,-0.339125,
-	-0.23383,-0.86988,0.434318,0.844199,0.147671,-0.339125,
-	-0.376394,-0.756788,0.534415,0.787209,0.193905,-0.294,
-	0.024414,-0.469703,0.882487,0.807717,0.204533,-0.277994,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.772673,-0.608887,0.179534,0.608078,0.332278,-0.361333,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.638487,0.393678,0.661326,0.60431,0.378335,-0.325812,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.838454,-0.308168,0.449475,0.597724,0.354488,-0.339125,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	-0.531095,-0.656282,0.53594,0.719399,0.249218,-0.2785,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.233968,-0.2359,0.943191,0.735693,0.265534,-0.26194,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.462569,0.07019,0.883801,0.66406,0.327,-0.277994,
-	-0.635534,-0.736296,0.232302,0.709997,0.238013,-0.322437,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.635534,-0.736296,0.232302,0.709997,0.238013,-0.322437,
-	-0.660431,-0.496512,0.5633,0.653151,0.306393,-0.294,
-	-0.531095,-0.656282,0.53594,0.719399,0.249218,-0.2785,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.464025,-0.863104,-0.199329,0.820528,0.154011,-0.638667,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.4837,-0.869471,-0.100277,0.83753,0.13389,-0.5825,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.635534,-0.736296,-0.232302,0.709997,0.238013,-0.677562,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.552608,-0.806562,-0.209959,0.774619,0.186679,-0.664625,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.4837,-0.869471,-0.100277,0.83753,0.13389,-0.5825,
-	-0.4837,-0.869471,-0.100277,0.83753,0.13389,-0.5825,
-	-0.577604,-0.812413,-0.079739,0.775446,0.175219,-0.5905,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.772673,-0.608887,-0.179534,0.608078,0.332278,-0.638667,
-	-0.772268,-0.627334,-0.100277,0.58531,0.345528,-0.5825,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.772673,-0.608887,-0.179534,0.608078,0.332278,-0.638667,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.772268,-0.627334,-0.100277,0.58531,0.345528,-0.5825,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.772268,-0.627334,-0.100277,0.58531,0.345528,-0.5825,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.635534,-0.736296,-0.232302,0.709997,0.238013,-0.677562,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.712429,-0.672822,-0.199386,0.648221,0.292739,-0.664625,
-	-0.699771,-0.709903,-0.079739,0.636792,0.291564,-0.5905,
-	-0.640463,-0.763275,-0.08496,0.704334,0.231264,-0.59775,
-	-0.772673,-0.608887,0.179534,0.608078,0.332278,-0.361333,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.772673,-0.608887,0.179534,0.608078,0.332278,-0.361333,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.772268,-0.627334,0.100277,0.58531,0.345528,-0.4175,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.635534,-0.736296,0.232302,0.709997,0.238013,-0.322437,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.712429,-0.672822,0.199385,0.648221,0.292739,-0.335375,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.810611,-0.585585,0,0.573976,0.352148,-0.5,
-	-0.772268,-0.627334,0.100277,0.58531,0.345528,-0.4175,
-	-0.772268,-0.627334,0.100277,0.58531,0.345528,-0.4175,
-	-0.699771,-0.709903,0.079739,0.636792,0.291564,-0.4095,
-	-0.705547,-0.708663,0,0.629453,0.294096,-0.5,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.4837,-0.869471,0.100277,0.83753,0.13389,-0.4175,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.464025,-0.863104,0.199329,0.820528,0.154011,-0.361333,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.4837,-0.869471,0.100277,0.83753,0.13389,-0.4175,
-	-0.435927,-0.899982,0,0.846018,0.123878,-0.5,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.4837,-0.869471,0.100277,0.83753,0.13389,-0.4175,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.642787,-0.766045,0,0.702437,0.229003,-0.5,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.57538,-0.817886,0,0.779215,0.168431,-0.5,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-	-0.635534,-0.736296,0.232302,0.709997,0.238013,-0.322437,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.552608,-0.806562,0.209959,0.774619,0.186679,-0.335375,
-	-0.577604,-0.812413,0.079739,0.775446,0.175219,-0.4095,
-	-0.640463,-0.763275,0.08496,0.704334,0.231264,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_4=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_4[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000\305"
+ "u\207\077\322q\201>\000\000\000\277\0332\2027M3j\312}\324\000\000\236,\177"
+ "\325\265\326\000\000\342%\003\315z\351\000\000\256+\214\301D\350\000\000"
+ "\243#/\312\000\000\000\000#)\230\276\000\000\000\000\200.\263\267\000\000"
+ "\000\000\0361\302\272\032\350\000\000\0119\303\303)\324\000\000\342%\003"
+ "\315\206\026\000\000\236,\177\325K)\000\000M3j\312\203+\000\000\256+\214"
+ "\301\274\027\000\000\0119\303\303\327+\000\000\0361\302\272\346\027\000\000"
+ "\323D\325\304\346\042\000\000KA8\277\304\024\000\000\3067\307\271\006\026"
+ "\000\000%\077l\302}(\000\000\207\077m\274\000\000\000\000d5\254\266\000\000"
+ "\000\000\323D\325\304\032\335\000\000%\077l\302\203\327\000\000\3067\307"
+ "\271\372\351\000\000KA8\277<\353\000\000\3307\244\343\2164\000\000\000@1"
+ "\331`7\000\000QE\236\364O8\000\000>O\354\352U;\000\0001VH\344\352;\000\000"
+ "NF\215\322\3407\000\000\005^\274\023K)\000\000/kn\013\203+\000\000{^\247"
+ "\374`7\000\000\312R\227\005\2164\000\000\036s\002\005\327+\000\000\367e\036"
+ "\366\3407\000\000\207s\264\370\346\042\000\000\351jq\355o)\000\0004i\254"
+ "\360\3313\000\000Uu\232\376}(\000\000n]\243\335\261,\000\000\262Z\032\340"
+ "\2777\000\000\037O\225\316o)\000\000\273K\361\317\3313\000\000\301d9\034"
+ "\206\026\000\000\315rK\024\274\027\000\000\000g\015\037\000\000\000\000X"
+ "u@\027\000\000\000\000\342}\336\020\000\000\000\000&{\352\015\346\027\000"
+ "\000\301d9\034z\351\000\000\005^\274\023\265\326\000\000/kn\013}\324\000"
+ "\000\315rK\024D\350\000\000\036s\002\005)\324\000\000&{\352\015\032\350\000"
+ "\000\207s\264\370\032\335\000\000\275x\315\374<\353\000\000)}\326\006\372"
+ "\351\000\000Uu\232\376\203\327\000\000U{\331\376\000\000\000\000\377\177"
+ "\210\011\000\000\000\000)}\326\006\006\026\000\000\275x\315\374\304\024\000"
+ "\000\312R\227\005r\313\000\000{^\247\374\240\310\000\000QE\236\364\261\307"
+ "\000\000>O\354\352\253\304\000\0001VH\344\026\304\000\000\367e\036\366 \310"
+ "\000\000\000@1\331\240\310\000\000\3307\244\343r\313\000\000NF\215\322 \310"
+ "\000\000\037O\225\316\221\326\000\000\273K\361\317'\314\000\000n]\243\335"
+ "P\323\000\000\262Z\032\340A\310\000\0004i\254\360'\314\000\000\351jq\355"
+ "\221\326\000\000QO\262\313\307\026\000\000\024_(\334\232\030\000\000\241"
+ "_\250\333\000\000\000\000\236N\337\311\000\000\000\000\314m\215\355\307\026"
+ "\000\000\212op\356\000\000\000\000\314m\215\3559\351\000\000\024_(\334f\347"
+ "\000\000QO\262\3139\351\000\000\255##\344\005\331\000\000)\036\000\334\275"
+ "\352\000\000!\031\204\363\030\333\000\000 \025\260\353\337\353\000\000\312"
+ "\023\025\351\000\000\000\000R\034I\331\000\000\000\000\330\001G\0117\335"
+ "\000\000\216\001\343\001\007\355\000\000b\013B\371\261\354\000\000\242\015"
+ "\325\000\232\334\000\000u\001l\377\000\000\000\000\243\012\274\366\000\000"
+ "\000\000\330\001G\011\311\042\000\000\242\015\325\000f#\000\000b\013B\371"
+ "O\023\000\000\216\001\343\001\371\022\000\000!\031\204\363\350$\000\000 "
+ "\025\260\353!\024\000\000)\036\000\334C\025\000\000\255##\344\373&\000\000"
+ "\037L\315\037\005\331\000\000\356B=\022c\316\000\000|6\353,\030\333\000\000"
+ "\320/\337\037\007\321\000\000\316'8\020\254\315\000\000\3467\370\001\330"
+ "\312\000\000\034\036a8\232\334\000\000\373\003y\0777\335\000\000\177\003"
+ "(3\273\323\000\000]\032\301+\363\322\000\000\352\002`$\221\320\000\000\337"
+ "\025\233\034\273\317\000\000`\021u\015\363\322\000\000T\002\230\025\273\323"
+ "\000\000\315\037\220\000\007\321\000\000\336,\262\361c\316\000\000\356B="
+ "\022\2351\000\000\037L\315\037\373&\000\000\3467\370\001(5\000\000\316'8"
+ "\020T2\000\000\320/\337\037\371.\000\000|6\353,\350$\000\000\336,\262\361"
+ "\2351\000\000\315\037\220\000\371.\000\000T\002\230\025E,\000\000`\021u\015"
+ "\015-\000\000\352\002`$o/\000\000\337\025\233\034E0\000\000\177\003(3E,\000"
+ "\000\373\003y\077\311\042\000\000\034\036a8f#\000\000]\032\301+\015-\000"
+ "\000\243Q\360'\275\352\000\000zS\246*\000\000\000\000\323;[7\000\000\000"
+ "\000}:\2774\337\353\000\000\243Q\360'C\025\000\000}:\2774!\024\000\000F\004"
+ "\335F\371\022\000\000[ \364\077O\023\000\000_\004TI\000\000\000\000\033!"
+ "zB\000\000\000\000F\004\335F\007\355\000\000[ \364\077\261\354\000\000m\267"
+ "+3\005\331\000\000\317\243\077+\265\326\000\000I\260\302\036r\313\000\000"
+ "3\301\357&c\316\000\000B\277\306\017\261\307\000\000\355\314A\030\330\312"
+ "\000\000n\335\375\037\254\315\000\000\227\325\211.\007\321\000\000\016\317"
+ "\250:\030\333\000\000;\316\312\000r\313\000\000\265\332M\364\265\326\000"
+ "\000l\342W\375\005\331\000\000\246\330\223\011c\316\000\000\316\353R\005"
+ "\030\333\000\000E\345q\021\007\321\000\000m\366\011\012\232\334\000\000e"
+ "\363/\026\363\322\000\000\303\357\304$\273\317\000\000\032\351\177\077\232"
+ "\334\000\000!\354X3\363\322\000\000\221\261\203:\275\352\000\000R\234\275"
+ "2z\351\000\000\042\313\356A\337\353\000\000\324\311[D\000\000\000\000\234"
+ "\257\365<\000\000\000\000\323\231<5\000\000\000\000I\347\311F\261\354\000"
+ "\000\256\3467I\000\000\000\000\032\351\177\077f#\000\000I\347\311FO\023\000"
+ "\000\016\317\250:\350$\000\000\042\313\356A!\024\000\000\317\243\077+K)\000"
+ "\000R\234\2752\206\026\000\000\221\261\203:C\025\000\000m\267+3\373&\000"
+ "\000I\260\302\036\2164\000\0003\301\357&\2351\000\000\227\325\211.\371.\000"
+ "\000n\335\375\037T2\000\000\355\314A\030(5\000\000B\277\306\017O8\000\000"
+ "!\354X3\015-\000\000\303\357\304$E0\000\000m\366\011\012f#\000\000e\363/"
+ "\026\015-\000\000\316\353R\005\350$\000\000E\345q\021\371.\000\000l\342W"
+ "\375\373&\000\000\265\332M\364K)\000\000;\316\312\000\2164\000\000\246\330"
+ "\223\011\2351\000\000I\350\000\366C\025\000\0001\342\317\354\206\026\000"
+ "\000\272\357\014\376!\024\000\000\010\361\237\373\000\000\000\000=\352\215"
+ "\363\000\000\000\000\260\344P\352\000\000\000\000>\370\277\002O\023\000\000"
+ "\331\370Q\000\000\000\000\000>\370\277\002\261\354\000\000\272\357\014\376"
+ "\337\353\000\0001\342\317\354z\351\000\000I\350\000\366\275\352\000\000\031"
+ "\325k\354\203+\000\000\273\335\261\344\274\027\000\000\234\340\035\342\000"
+ "\000\000\000#\334\217\334\000\000\000\000!\3319\337\346\027\000\000\023\320"
+ "\013\347\327+\000\000\031\325k\354}\324\000\000\273\335\261\344D\350\000"
+ "\000\023\320\013\347)\324\000\000!\3319\337\032\350\000\000)\304\042\347"
+ "\032\335\000\000q\310\021\342<\353\000\000\237\322\000\336\372\351\000\000"
+ "\037\312\211\345\203\327\000\000\224\312\214\337\000\000\000\000j\325B\333"
+ "\000\000\000\000)\304\042\347\346\042\000\000\037\312\211\345}(\000\000\237"
+ "\322\000\336\006\026\000\000q\310\021\342\304\024\000\000\265\306M\371\240"
+ "\310\000\000p\265\302\010\253\304\000\000\317\2563\003\026\304\000\000\360"
+ "\300\331\363 \310\000\000\310\225\031%}\324\000\000,\2447\030\240\310\000"
+ "\000\276\215\227\037)\324\000\000\310\234\253\022 \310\000\000\026\214\226"
+ "\031\203\327\000\000\261\216\377\023\032\335\000\000\313\230\014\012\221"
+ "\326\000\000\011\232|\015'\314\000\000X\250F\374P\323\000\000\266\252\030"
+ "\377A\310\000\000\307\273,\361'\314\000\000\233\270Z\357\221\326\000\000"
+ "&\215\323,D\350\000\000E\212g/\000\000\000\000{\201\327)\000\000\000\000"
+ "\227\204K'\032\350\000\000\310\225\031%\203+\000\000&\215\323,\274\027\000"
+ "\000\276\215\227\037\327+\000\000\227\204K'\346\027\000\000\261\216\377\023"
+ "\346\042\000\000\366\210U\027\304\024\000\0000\203\247 \006\026\000\000\026"
+ "\214\226\031}(\000\000\034\206\000\031\000\000\000\000\001\200\355\042\000"
+ "\000\000\0000\203\247 \372\351\000\000\366\210U\027<\353\000\000,\2447\030"
+ "`7\000\000p\265\302\010U;\000\000\317\2563\003\352;\000\000\310\234\253\022"
+ "\3407\000\000\265\306M\371`7\000\000\360\300\331\363\3407\000\000\233\270"
+ "Z\357o)\000\000\307\273,\361\3313\000\000X\250F\374\261,\000\000\266\252"
+ "\030\377\2777\000\000\313\230\014\012o)\000\000\011\232|\015\3313\000\000"
+ "\321\270x\3549\351\000\000\353\246\223\372f\347\000\000q\246\001\372\000"
+ "\000\000\000\304\271\303\352\000\000\000\000\353\225\300\0119\351\000\000"
+ "\022\224c\012\000\000\000\000\353\225\300\011\307\026\000\000\353\246\223"
+ "\372\232\030\000\000\321\270x\354\307\026\000\000\235\261\230\267\242\306"
+ "\250\300\252\327\264\315\334\245\304\243\264\233\273\337\312\351\320\344"
+ "\301\331\346\315\336\2750\2773\275\030\252\031\2743\264\024\225>\261;\232"
+ ")\231<\264\333\366\340\363\361\014\365\012\024\353\373\324\0301\034/\012"
+ "!\007 6\033%\012F\327\077\3218\343G\356:\314/\3254\306 \316$A'=.Q3LT+;,>"
+ "[NgPcBXdISDV\307R\313s\337m\310S\324w\370^\364J\323_x^u\215p\213tj\225uZ"
+ "\216\241\213\246\255\206E\265M\241K\273T\260b\271P\300:\302\077\307C\304"
+ "=\276D\314H\311K\305F\300A\273\234\265\245\305\241\262\252\302\260\321\254"
+ "\325\273\231\314\242\263\267\250\251\330\251\274\305\350\306\330\331\312"
+ "\316\337\265\317\340\277\327\274\334\314\345Me_tJg^t\206s\212qDm@wYx]u\177"
+ "\203\203w\234\233\246\212\224\241\217\244\013 \0322\362\011\364\005\013!"
+ "\0305\335\362\340\355\367\333\346\345\002\000\370\002\007&\010\077\022;\012"
+ "\042>[.Q*U:^$A!E\011Y\031M\021n!^&v2f\275o\274n\252{\251{oospwr\252}\300"
+ "st\244e\263`\255m\240V\247d\231F\223^\214|u\306{V}\317g\314d\324m\347f\340"
+ "_\336]\333v\366u\374E\367Z\364\077\356S\357;\345K\350N\360<\374)\374(\376"
+ ")\015\010\017\014\020\020\002)\012\003\022\307\013\337&\327\030\345,\341"
+ "2\346#\365\037\356:\323A\334,\306:\273K\314R\323\024\256\015\216-\225E\255"
+ "[\302R\2731\343=\330K\314&\247)\301\030\313b\262W\276J\231@\252\311\250\315"
+ "\253\336\217\311\224\327\252\365\214\331\270\355\270\362\243\326\264r\242"
+ "st\226\226T\203\265h\244u\237O\207V\232\304\263\300\267\272\246\262\273\263"
+ "\261\250\273\236\302\256\305]\323R\253*\247A\3514\336D\320\036\302&\301\316"
+ "\277\313\253\350\275\347\266\313\224\355\231\326\266\302\366#\013\014\353"
+ "\353\327\006!\363\002\325\323\277\343\306\316\306\331\320\307\312\317\333"
+ "\307\263\302\270\306\273\314\265\276\275\301\300\304\303\311\277\316\272"
+ "\000\000\001\000\002\000\002\000\003\000\000\000\004\000\005\000\003\000"
+ "\004\000\003\000\002\000\005\000\006\000\007\000\007\000\003\000\005\000"
+ "\010\000\000\000\003\000\010\000\003\000\007\000\011\000\012\000\013\000"
+ "\013\000\014\000\011\000\015\000\016\000\014\000\015\000\014\000\013\000"
+ "\016\000\006\000\005\000\005\000\014\000\016\000\004\000\011\000\014\000"
+ "\004\000\014\000\005\000\017\000\020\000\021\000\017\000\021\000\022\000"
+ "\023\000\024\000\021\000\023\000\021\000\020\000\006\000\016\000\021\000"
+ "\006\000\021\000\024\000\016\000\015\000\022\000\022\000\021\000\016\000"
+ "\025\000\026\000\027\000\025\000\027\000\030\000\026\000\010\000\007\000"
+ "\007\000\027\000\026\000\006\000\024\000\027\000\006\000\027\000\007\000"
+ "\023\000\030\000\027\000\023\000\027\000\024\000\012\000\031\000\032\000"
+ "\012\000\032\000\013\000\031\000\033\000\034\000\034\000\032\000\031\000"
+ "\035\000\036\000\032\000\035\000\032\000\034\000\036\000\015\000\013\000"
+ "\013\000\032\000\036\000\037\000 \000!\000\037\000!\000\042\000 \000#\000"
+ "$\000$\000!\000 \000$\000\035\000\034\000\034\000!\000$\000\033\000\042\000"
+ "!\000\033\000!\000\034\000%\000&\000'\000%\000'\000(\000&\000)\000*\000*"
+ "\000'\000&\000\035\000$\000'\000\035\000'\000*\000$\000#\000(\000(\000'\000"
+ "$\000+\000\017\000\022\000\022\000,\000+\000\022\000\015\000\036\000\036"
+ "\000,\000\022\000\035\000*\000,\000\035\000,\000\036\000*\000)\000+\000+"
+ "\000,\000*\000 \000\037\000-\000-\000.\000 \000/\0000\000.\000/\000.\000"
+ "-\0000\0001\0002\0002\000.\0000\000#\000 \000.\000#\000.\0002\0003\0004\000"
+ "5\0005\0006\0003\0007\0008\0006\0007\0006\0005\0008\0001\0000\0000\0006\000"
+ "8\000/\0003\0006\000/\0006\0000\0009\000:\000;\0009\000;\000<\000=\000>\000"
+ ";\000=\000;\000:\0001\0008\000;\0001\000;\000>\0007\000<\000;\0007\000;\000"
+ "8\000%\000(\000\077\000%\000\077\000@\000#\0002\000\077\000#\000\077\000"
+ "(\0001\000>\000\077\0001\000\077\0002\000=\000@\000\077\000=\000\077\000"
+ ">\0004\000A\000B\0004\000B\0005\000C\000D\000B\000C\000B\000A\000D\000E\000"
+ "F\000F\000B\000D\000F\0007\0005\0005\000B\000F\000\001\000\000\000G\000\001"
+ "\000G\000H\000\000\000\010\000I\000I\000G\000\000\000E\000D\000G\000E\000"
+ "G\000I\000D\000C\000H\000H\000G\000D\000\026\000\025\000J\000J\000K\000\026"
+ "\000J\000L\000M\000M\000K\000J\000E\000I\000K\000E\000K\000M\000I\000\010"
+ "\000\026\000\026\000K\000I\0009\000<\000N\0009\000N\000O\000<\0007\000F\000"
+ "F\000N\000<\000E\000M\000N\000E\000N\000F\000M\000L\000O\000O\000N\000M\000"
+ "\017\000+\000P\000\017\000P\000\020\000+\000)\000Q\000Q\000P\000+\000R\000"
+ "S\000P\000R\000P\000Q\000S\000\023\000\020\000\020\000P\000S\000%\000@\000"
+ "T\000%\000T\000&\000@\000=\000U\000U\000T\000@\000R\000Q\000T\000R\000T\000"
+ "U\000Q\000)\000&\000&\000T\000Q\0009\000O\000V\0009\000V\000:\000O\000L\000"
+ "W\000W\000V\000O\000R\000U\000V\000R\000V\000W\000U\000=\000:\000:\000V\000"
+ "U\000\025\000\030\000X\000\025\000X\000J\000\030\000\023\000S\000S\000X\000"
+ "\030\000R\000W\000X\000R\000X\000S\000W\000L\000J\000J\000X\000W\000\001"
+ "\000Y\000Z\000\001\000Z\000\002\000Y\000[\000\134\000\134\000Z\000Y\000]"
+ "\000^\000Z\000]\000Z\000\134\000^\000\004\000\002\000\002\000Z\000^\000_"
+ "\000`\000a\000_\000a\000b\000`\000c\000d\000d\000a\000`\000d\000]\000\134"
+ "\000\134\000a\000d\000[\000b\000a\000[\000a\000\134\000e\000f\000g\000e\000"
+ "g\000h\000i\000j\000g\000i\000g\000f\000j\000]\000d\000d\000g\000j\000d\000"
+ "c\000h\000h\000g\000d\000\012\000\011\000k\000\012\000k\000l\000\011\000"
+ "\004\000^\000^\000k\000\011\000]\000j\000k\000]\000k\000^\000j\000i\000l"
+ "\000l\000k\000j\0004\000m\000n\0004\000n\000A\000m\000o\000p\000p\000n\000"
+ "m\000q\000r\000n\000q\000n\000p\000r\000C\000A\000A\000n\000r\000s\000t\000"
+ "u\000u\000v\000s\000w\000x\000v\000w\000v\000u\000x\000q\000p\000p\000v\000"
+ "x\000o\000s\000v\000o\000v\000p\000_\000b\000y\000_\000y\000z\000b\000[\000"
+ "{\000{\000y\000b\000q\000x\000y\000q\000y\000{\000x\000w\000z\000z\000y\000"
+ "x\000Y\000\001\000H\000H\000|\000Y\000C\000r\000|\000C\000|\000H\000r\000"
+ "q\000{\000{\000|\000r\000[\000Y\000|\000[\000|\000{\000\037\000\042\000}"
+ "\000\037\000}\000~\000\042\000\033\000\177\000\177\000}\000\042\000\200\000"
+ "\201\000}\000\200\000}\000\177\000\201\000\202\000~\000~\000}\000\201\000"
+ "\031\000\012\000l\000l\000\203\000\031\000i\000\204\000\203\000i\000\203"
+ "\000l\000\204\000\200\000\177\000\177\000\203\000\204\000\033\000\031\000"
+ "\203\000\033\000\203\000\177\000e\000\205\000\206\000e\000\206\000f\000\205"
+ "\000\207\000\210\000\210\000\206\000\205\000\200\000\204\000\206\000\200"
+ "\000\206\000\210\000\204\000i\000f\000f\000\206\000\204\000\211\000\212\000"
+ "\213\000\213\000\214\000\211\000\202\000\201\000\214\000\202\000\214\000"
+ "\213\000\201\000\200\000\210\000\210\000\214\000\201\000\207\000\211\000"
+ "\214\000\207\000\214\000\210\0004\0003\000\215\0004\000\215\000m\0003\000"
+ "/\000\216\000\216\000\215\0003\000\217\000\220\000\215\000\217\000\215\000"
+ "\216\000\220\000o\000m\000m\000\215\000\220\000\037\000~\000\221\000\037"
+ "\000\221\000-\000~\000\202\000\222\000\222\000\221\000~\000\217\000\216\000"
+ "\221\000\217\000\221\000\222\000\216\000/\000-\000-\000\221\000\216\000\213"
+ "\000\212\000\223\000\223\000\224\000\213\000\225\000\226\000\224\000\225"
+ "\000\224\000\223\000\226\000\217\000\222\000\222\000\224\000\226\000\202"
+ "\000\213\000\224\000\202\000\224\000\222\000\227\000t\000s\000s\000\230\000"
+ "\227\000o\000\220\000\230\000o\000\230\000s\000\220\000\217\000\226\000\226"
+ "\000\230\000\220\000\225\000\227\000\230\000\225\000\230\000\226\000\231"
+ "\000\232\000\233\000\233\000\234\000\231\000\235\000\236\000\234\000\235"
+ "\000\234\000\233\000\236\000\237\000\240\000\240\000\234\000\236\000\241"
+ "\000\231\000\234\000\241\000\234\000\240\000\242\000\243\000\244\000\244"
+ "\000\245\000\242\000\246\000\247\000\245\000\246\000\245\000\244\000\237"
+ "\000\236\000\245\000\237\000\245\000\247\000\236\000\235\000\242\000\242"
+ "\000\245\000\236\000\250\000_\000z\000z\000\251\000\250\000w\000\252\000"
+ "\251\000w\000\251\000z\000\252\000\237\000\247\000\247\000\251\000\252\000"
+ "\247\000\246\000\250\000\250\000\251\000\247\000t\000\253\000\254\000t\000"
+ "\254\000u\000\253\000\241\000\240\000\240\000\254\000\253\000\237\000\252"
+ "\000\254\000\237\000\254\000\240\000\252\000w\000u\000u\000\254\000\252\000"
+ "\232\000\231\000\255\000\232\000\255\000\256\000\231\000\241\000\257\000"
+ "\257\000\255\000\231\000\260\000\261\000\255\000\260\000\255\000\257\000"
+ "\261\000\262\000\256\000\256\000\255\000\261\000\253\000t\000\227\000\227"
+ "\000\263\000\253\000\227\000\225\000\264\000\264\000\263\000\227\000\264"
+ "\000\260\000\257\000\257\000\263\000\264\000\241\000\253\000\263\000\241"
+ "\000\263\000\257\000\223\000\212\000\265\000\265\000\266\000\223\000\267"
+ "\000\270\000\266\000\267\000\266\000\265\000\270\000\260\000\264\000\264"
+ "\000\266\000\270\000\264\000\225\000\223\000\223\000\266\000\264\000\271"
+ "\000\272\000\273\000\271\000\273\000\274\000\272\000\262\000\261\000\261"
+ "\000\273\000\272\000\260\000\270\000\273\000\260\000\273\000\261\000\270"
+ "\000\267\000\274\000\274\000\273\000\270\000\275\000\271\000\274\000\274"
+ "\000\276\000\275\000\267\000\277\000\276\000\267\000\276\000\274\000\277"
+ "\000\300\000\301\000\301\000\276\000\277\000\302\000\275\000\276\000\302"
+ "\000\276\000\301\000\212\000\211\000\303\000\212\000\303\000\265\000\211"
+ "\000\207\000\304\000\304\000\303\000\211\000\300\000\277\000\303\000\300"
+ "\000\303\000\304\000\277\000\267\000\265\000\265\000\303\000\277\000\205"
+ "\000e\000\305\000\305\000\306\000\205\000\305\000\307\000\310\000\310\000"
+ "\306\000\305\000\310\000\300\000\304\000\304\000\306\000\310\000\207\000"
+ "\205\000\306\000\207\000\306\000\304\000\311\000\312\000\313\000\313\000"
+ "\314\000\311\000\313\000\302\000\301\000\301\000\314\000\313\000\300\000"
+ "\310\000\314\000\300\000\314\000\301\000\307\000\311\000\314\000\307\000"
+ "\314\000\310\000\312\000\311\000\315\000\312\000\315\000\316\000\307\000"
+ "\317\000\315\000\307\000\315\000\311\000\320\000\321\000\315\000\320\000"
+ "\315\000\317\000\321\000\322\000\316\000\316\000\315\000\321\000e\000h\000"
+ "\323\000e\000\323\000\305\000h\000c\000\324\000\324\000\323\000h\000\320"
+ "\000\317\000\323\000\320\000\323\000\324\000\317\000\307\000\305\000\305"
+ "\000\323\000\317\000_\000\250\000\325\000_\000\325\000`\000\250\000\246\000"
+ "\326\000\326\000\325\000\250\000\320\000\324\000\325\000\320\000\325\000"
+ "\326\000\324\000c\000`\000`\000\325\000\324\000\243\000\327\000\330\000\243"
+ "\000\330\000\244\000\327\000\322\000\321\000\321\000\330\000\327\000\320"
+ "\000\326\000\330\000\320\000\330\000\321\000\246\000\244\000\330\000\246"
+ "\000\330\000\326\000\331\000\312\000\316\000\316\000\332\000\331\000\322"
+ "\000\333\000\332\000\322\000\332\000\316\000\333\000\334\000\335\000\335"
+ "\000\332\000\333\000\336\000\331\000\332\000\336\000\332\000\335\000\327"
+ "\000\243\000\337\000\337\000\340\000\327\000\341\000\342\000\340\000\341"
+ "\000\340\000\337\000\342\000\334\000\333\000\333\000\340\000\342\000\322"
+ "\000\327\000\340\000\322\000\340\000\333\000\343\000\344\000\345\000\343"
+ "\000\345\000\346\000\347\000\350\000\345\000\347\000\345\000\344\000\334"
+ "\000\342\000\345\000\334\000\345\000\350\000\341\000\346\000\345\000\341"
+ "\000\345\000\342\000\351\000\352\000\353\000\351\000\353\000\354\000\336"
+ "\000\335\000\353\000\336\000\353\000\352\000\334\000\350\000\353\000\334"
+ "\000\353\000\335\000\347\000\354\000\353\000\347\000\353\000\350\000\243"
+ "\000\242\000\355\000\243\000\355\000\337\000\235\000\356\000\355\000\235"
+ "\000\355\000\242\000\356\000\357\000\360\000\360\000\355\000\356\000\341"
+ "\000\337\000\355\000\341\000\355\000\360\000\232\000\361\000\362\000\232"
+ "\000\362\000\233\000\361\000\363\000\364\000\364\000\362\000\361\000\357"
+ "\000\356\000\362\000\357\000\362\000\364\000\356\000\235\000\233\000\233"
+ "\000\362\000\356\000\365\000\366\000\367\000\367\000\370\000\365\000\371"
+ "\000\372\000\370\000\371\000\370\000\367\000\357\000\364\000\370\000\357"
+ "\000\370\000\372\000\364\000\363\000\365\000\365\000\370\000\364\000\343"
+ "\000\346\000\373\000\343\000\373\000\374\000\346\000\341\000\360\000\360"
+ "\000\373\000\346\000\357\000\372\000\373\000\357\000\373\000\360\000\372"
+ "\000\371\000\374\000\374\000\373\000\372\000\361\000\232\000\256\000\256"
+ "\000\375\000\361\000\262\000\376\000\375\000\262\000\375\000\256\000\376"
+ "\000\377\000\000\001\000\001\375\000\376\000\363\000\361\000\375\000\363"
+ "\000\375\000\000\001\272\000\271\000\001\001\001\001\002\001\272\000\003"
+ "\001\004\001\002\001\003\001\002\001\001\001\004\001\377\000\376\000\376"
+ "\000\002\001\004\001\262\000\272\000\002\001\262\000\002\001\376\000\005"
+ "\001\006\001\007\001\005\001\007\001\010\001\011\001\012\001\007\001\011"
+ "\001\007\001\006\001\377\000\004\001\007\001\377\000\007\001\012\001\004"
+ "\001\003\001\010\001\010\001\007\001\004\001\366\000\365\000\013\001\366"
+ "\000\013\001\014\001\365\000\363\000\000\001\000\001\013\001\365\000\377"
+ "\000\012\001\013\001\377\000\013\001\000\001\011\001\014\001\013\001\011"
+ "\001\013\001\012\001\271\000\275\000\015\001\271\000\015\001\001\001\275"
+ "\000\302\000\016\001\016\001\015\001\275\000\017\001\020\001\015\001\017"
+ "\001\015\001\016\001\020\001\003\001\001\001\001\001\015\001\020\001\312"
+ "\000\331\000\021\001\312\000\021\001\313\000\336\000\022\001\021\001\336"
+ "\000\021\001\331\000\022\001\017\001\016\001\016\001\021\001\022\001\302"
+ "\000\313\000\021\001\302\000\021\001\016\001\351\000\023\001\024\001\351"
+ "\000\024\001\352\000\023\001\025\001\026\001\026\001\024\001\023\001\017"
+ "\001\022\001\024\001\017\001\024\001\026\001\022\001\336\000\352\000\352"
+ "\000\024\001\022\001\027\001\005\001\010\001\010\001\030\001\027\001\010"
+ "\001\003\001\020\001\020\001\030\001\010\001\017\001\026\001\030\001\017"
+ "\001\030\001\020\001\025\001\027\001\030\001\025\001\030\001\026\001\343"
+ "\000\374\000\031\001\343\000\031\001\344\000\374\000\371\000\032\001\032"
+ "\001\031\001\374\000\033\001\034\001\031\001\033\001\031\001\032\001\034"
+ "\001\347\000\344\000\344\000\031\001\034\001\366\000\014\001\035\001\366"
+ "\000\035\001\367\000\014\001\011\001\036\001\036\001\035\001\014\001\033"
+ "\001\032\001\035\001\033\001\035\001\036\001\032\001\371\000\367\000\367"
+ "\000\035\001\032\001\005\001\027\001\037\001\005\001\037\001\006\001\027"
+ "\001\025\001 \001 \001\037\001\027\001\033\001\036\001\037\001\033\001\037"
+ "\001 \001\036\001\011\001\006\001\006\001\037\001\036\001\351\000\354\000"
+ "!\001\351\000!\001\023\001\354\000\347\000\034\001\034\001!\001\354\000\033"
+ "\001 \001!\001\033\001!\001\034\001 \001\025\001\023\001\023\001!\001 \001"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\002\000\003\000\000\000"
+ "\003\000\004\000\005\000\003\000\005\000\003\000\004\000\002\000\004\000"
+ "\005\000\006\000\006\000\007\000\005\000\007\000\003\000\007\000\000\000"
+ "\010\000\003\000\010\000\007\000\010\000\011\000\012\000\012\000\013\000"
+ "\011\000\013\000\013\000\014\000\011\000\014\000\015\000\016\000\014\000"
+ "\016\000\014\000\015\000\013\000\015\000\006\000\016\000\005\000\016\000"
+ "\005\000\014\000\004\000\011\000\004\000\014\000\017\000\020\000\020\000"
+ "\021\000\017\000\021\000\021\000\022\000\017\000\022\000\023\000\024\000"
+ "\021\000\024\000\021\000\023\000\020\000\023\000\016\000\021\000\006\000"
+ "\021\000\006\000\024\000\015\000\022\000\016\000\022\000\025\000\026\000"
+ "\026\000\027\000\025\000\027\000\027\000\030\000\025\000\030\000\010\000"
+ "\026\000\007\000\026\000\007\000\027\000\024\000\027\000\006\000\027\000"
+ "\023\000\030\000\023\000\027\000\012\000\031\000\031\000\032\000\012\000"
+ "\032\000\013\000\032\000\031\000\033\000\033\000\034\000\031\000\034\000"
+ "\032\000\034\000\035\000\036\000\032\000\036\000\032\000\035\000\034\000"
+ "\035\000\015\000\036\000\013\000\036\000\037\000 \000 \000!\000\037\000!"
+ "\000!\000\042\000\037\000\042\000 \000#\000#\000$\000 \000$\000!\000$\000"
+ "\035\000$\000\034\000$\000\034\000!\000\033\000\042\000\033\000!\000%\000"
+ "&\000&\000'\000%\000'\000'\000(\000%\000(\000&\000)\000)\000*\000&\000*\000"
+ "'\000*\000$\000'\000\035\000'\000\035\000*\000#\000(\000$\000(\000\017\000"
+ "+\000\022\000+\000\022\000,\000+\000,\000\022\000\036\000\036\000,\000*\000"
+ ",\000\035\000,\000)\000+\000*\000+\000\037\000-\000 \000-\000-\000.\000 "
+ "\000.\000/\0000\000.\0000\000.\000/\000-\000/\0000\0001\0001\0002\0000\000"
+ "2\000.\0002\000#\000.\000#\0002\0003\0004\0004\0005\0003\0005\0005\0006\000"
+ "3\0006\0007\0008\0006\0008\0006\0007\0005\0007\0001\0008\0000\0008\0000\000"
+ "6\000/\0003\000/\0006\0009\000:\000:\000;\0009\000;\000;\000<\0009\000<\000"
+ "=\000>\000;\000>\000;\000=\000:\000=\0008\000;\0001\000;\0001\000>\0007\000"
+ "<\0007\000;\000(\000\077\000%\000\077\000\077\000@\000%\000@\0002\000\077"
+ "\000#\000\077\000>\000\077\0001\000\077\000=\000@\000=\000\077\0004\000A"
+ "\000A\000B\0004\000B\0005\000B\000C\000D\000B\000D\000B\000C\000A\000C\000"
+ "D\000E\000E\000F\000D\000F\000B\000F\0007\000F\0005\000F\000\000\000G\000"
+ "\001\000G\000G\000H\000\001\000H\000\010\000I\000\000\000I\000G\000I\000"
+ "D\000G\000E\000G\000E\000I\000C\000H\000D\000H\000\025\000J\000\026\000J"
+ "\000J\000K\000\026\000K\000J\000L\000L\000M\000J\000M\000K\000M\000I\000"
+ "K\000E\000K\000E\000M\000\026\000I\000<\000N\0009\000N\000N\000O\0009\000"
+ "O\000<\000F\000F\000N\000M\000N\000E\000N\000L\000O\000M\000O\000+\000P\000"
+ "\017\000P\000\020\000P\000)\000Q\000+\000Q\000P\000Q\000R\000S\000P\000S"
+ "\000P\000R\000Q\000R\000\023\000S\000\020\000S\000@\000T\000%\000T\000&\000"
+ "T\000=\000U\000@\000U\000T\000U\000Q\000T\000R\000T\000R\000U\000&\000Q\000"
+ "O\000V\0009\000V\000:\000V\000L\000W\000O\000W\000V\000W\000U\000V\000R\000"
+ "V\000R\000W\000:\000U\000\030\000X\000\025\000X\000J\000X\000\030\000S\000"
+ "S\000X\000W\000X\000R\000X\000J\000W\000\001\000Y\000Y\000Z\000\001\000Z"
+ "\000\002\000Z\000Y\000[\000[\000\134\000Y\000\134\000Z\000\134\000]\000^"
+ "\000Z\000^\000Z\000]\000\134\000]\000\004\000^\000\002\000^\000_\000`\000"
+ "`\000a\000_\000a\000a\000b\000_\000b\000`\000c\000c\000d\000`\000d\000a\000"
+ "d\000]\000d\000\134\000d\000\134\000a\000[\000b\000[\000a\000e\000f\000f"
+ "\000g\000e\000g\000g\000h\000e\000h\000i\000j\000g\000j\000g\000i\000f\000"
+ "i\000]\000j\000d\000j\000d\000g\000c\000h\000d\000h\000\011\000k\000\012"
+ "\000k\000k\000l\000\012\000l\000\011\000^\000^\000k\000j\000k\000]\000k\000"
+ "i\000l\000j\000l\0004\000m\000m\000n\0004\000n\000A\000n\000m\000o\000o\000"
+ "p\000m\000p\000n\000p\000q\000r\000n\000r\000n\000q\000p\000q\000C\000r\000"
+ "A\000r\000s\000t\000t\000u\000s\000u\000u\000v\000s\000v\000w\000x\000v\000"
+ "x\000v\000w\000u\000w\000q\000x\000p\000x\000p\000v\000o\000s\000o\000v\000"
+ "b\000y\000_\000y\000y\000z\000_\000z\000[\000{\000b\000{\000y\000{\000x\000"
+ "y\000q\000y\000q\000{\000w\000z\000x\000z\000H\000Y\000H\000|\000Y\000|\000"
+ "r\000|\000C\000|\000r\000{\000{\000|\000[\000|\000\042\000}\000\037\000}"
+ "\000}\000~\000\037\000~\000\033\000\177\000\042\000\177\000}\000\177\000"
+ "\200\000\201\000}\000\201\000}\000\200\000\177\000\200\000\201\000\202\000"
+ "~\000\202\000~\000\201\000\031\000l\000l\000\203\000\031\000\203\000i\000"
+ "\204\000\203\000\204\000i\000\203\000\200\000\204\000\177\000\204\000\177"
+ "\000\203\000\033\000\203\000e\000\205\000\205\000\206\000e\000\206\000f\000"
+ "\206\000\205\000\207\000\207\000\210\000\205\000\210\000\206\000\210\000"
+ "\204\000\206\000\200\000\206\000\200\000\210\000f\000\204\000\211\000\212"
+ "\000\212\000\213\000\211\000\213\000\213\000\214\000\211\000\214\000\201"
+ "\000\214\000\202\000\214\000\202\000\213\000\201\000\210\000\210\000\214"
+ "\000\207\000\211\000\207\000\214\0003\000\215\0004\000\215\000m\000\215\000"
+ "/\000\216\0003\000\216\000\215\000\216\000\217\000\220\000\215\000\220\000"
+ "\215\000\217\000\216\000\217\000o\000\220\000m\000\220\000~\000\221\000\037"
+ "\000\221\000-\000\221\000\202\000\222\000~\000\222\000\221\000\222\000\216"
+ "\000\221\000\217\000\221\000\217\000\222\000-\000\216\000\212\000\223\000"
+ "\213\000\223\000\223\000\224\000\213\000\224\000\225\000\226\000\224\000"
+ "\226\000\224\000\225\000\223\000\225\000\217\000\226\000\222\000\226\000"
+ "\222\000\224\000\202\000\224\000t\000\227\000s\000\227\000s\000\230\000\227"
+ "\000\230\000\220\000\230\000o\000\230\000\220\000\226\000\226\000\230\000"
+ "\225\000\227\000\225\000\230\000\231\000\232\000\232\000\233\000\231\000"
+ "\233\000\233\000\234\000\231\000\234\000\235\000\236\000\234\000\236\000"
+ "\234\000\235\000\233\000\235\000\236\000\237\000\237\000\240\000\236\000"
+ "\240\000\234\000\240\000\231\000\241\000\234\000\241\000\240\000\241\000"
+ "\242\000\243\000\243\000\244\000\242\000\244\000\244\000\245\000\242\000"
+ "\245\000\246\000\247\000\245\000\247\000\245\000\246\000\244\000\246\000"
+ "\236\000\245\000\237\000\245\000\237\000\247\000\235\000\242\000\236\000"
+ "\242\000_\000\250\000z\000\250\000z\000\251\000\250\000\251\000w\000\252"
+ "\000\251\000\252\000w\000\251\000\237\000\252\000\247\000\252\000\247\000"
+ "\251\000\246\000\250\000\247\000\250\000t\000\253\000\253\000\254\000t\000"
+ "\254\000u\000\254\000\241\000\253\000\240\000\253\000\240\000\254\000\252"
+ "\000\254\000\237\000\254\000u\000\252\000\231\000\255\000\232\000\255\000"
+ "\255\000\256\000\232\000\256\000\241\000\257\000\231\000\257\000\255\000"
+ "\257\000\260\000\261\000\255\000\261\000\255\000\260\000\257\000\260\000"
+ "\261\000\262\000\256\000\262\000\256\000\261\000\227\000\253\000\227\000"
+ "\263\000\253\000\263\000\225\000\264\000\227\000\264\000\263\000\264\000"
+ "\260\000\264\000\257\000\264\000\257\000\263\000\241\000\263\000\212\000"
+ "\265\000\223\000\265\000\265\000\266\000\223\000\266\000\267\000\270\000"
+ "\266\000\270\000\266\000\267\000\265\000\267\000\260\000\270\000\264\000"
+ "\270\000\264\000\266\000\223\000\264\000\271\000\272\000\272\000\273\000"
+ "\271\000\273\000\273\000\274\000\271\000\274\000\262\000\272\000\261\000"
+ "\272\000\261\000\273\000\270\000\273\000\260\000\273\000\267\000\274\000"
+ "\270\000\274\000\271\000\275\000\274\000\275\000\274\000\276\000\275\000"
+ "\276\000\267\000\277\000\276\000\277\000\267\000\276\000\277\000\300\000"
+ "\300\000\301\000\277\000\301\000\276\000\301\000\275\000\302\000\276\000"
+ "\302\000\301\000\302\000\211\000\303\000\212\000\303\000\265\000\303\000"
+ "\207\000\304\000\211\000\304\000\303\000\304\000\277\000\303\000\300\000"
+ "\303\000\300\000\304\000\265\000\277\000e\000\305\000\205\000\305\000\305"
+ "\000\306\000\205\000\306\000\305\000\307\000\307\000\310\000\305\000\310"
+ "\000\306\000\310\000\300\000\310\000\304\000\310\000\304\000\306\000\207"
+ "\000\306\000\311\000\312\000\312\000\313\000\311\000\313\000\313\000\314"
+ "\000\311\000\314\000\302\000\313\000\301\000\313\000\301\000\314\000\310"
+ "\000\314\000\300\000\314\000\307\000\311\000\307\000\314\000\311\000\315"
+ "\000\312\000\315\000\315\000\316\000\312\000\316\000\307\000\317\000\315"
+ "\000\317\000\307\000\315\000\320\000\321\000\315\000\321\000\315\000\320"
+ "\000\317\000\320\000\321\000\322\000\316\000\322\000\316\000\321\000h\000"
+ "\323\000e\000\323\000\305\000\323\000c\000\324\000h\000\324\000\323\000\324"
+ "\000\317\000\323\000\320\000\323\000\320\000\324\000\305\000\317\000\250"
+ "\000\325\000_\000\325\000`\000\325\000\246\000\326\000\250\000\326\000\325"
+ "\000\326\000\324\000\325\000\320\000\325\000\320\000\326\000`\000\324\000"
+ "\243\000\327\000\327\000\330\000\243\000\330\000\244\000\330\000\322\000"
+ "\327\000\321\000\327\000\321\000\330\000\326\000\330\000\320\000\330\000"
+ "\246\000\330\000\312\000\331\000\316\000\331\000\316\000\332\000\331\000"
+ "\332\000\322\000\333\000\332\000\333\000\322\000\332\000\333\000\334\000"
+ "\334\000\335\000\333\000\335\000\332\000\335\000\331\000\336\000\332\000"
+ "\336\000\335\000\336\000\243\000\337\000\327\000\337\000\337\000\340\000"
+ "\327\000\340\000\341\000\342\000\340\000\342\000\340\000\341\000\337\000"
+ "\341\000\334\000\342\000\333\000\342\000\333\000\340\000\322\000\340\000"
+ "\343\000\344\000\344\000\345\000\343\000\345\000\345\000\346\000\343\000"
+ "\346\000\347\000\350\000\345\000\350\000\345\000\347\000\344\000\347\000"
+ "\342\000\345\000\334\000\345\000\334\000\350\000\341\000\346\000\341\000"
+ "\345\000\351\000\352\000\352\000\353\000\351\000\353\000\353\000\354\000"
+ "\351\000\354\000\335\000\353\000\336\000\353\000\336\000\352\000\350\000"
+ "\353\000\334\000\353\000\347\000\354\000\347\000\353\000\242\000\355\000"
+ "\243\000\355\000\337\000\355\000\235\000\356\000\355\000\356\000\235\000"
+ "\355\000\356\000\357\000\357\000\360\000\356\000\360\000\355\000\360\000"
+ "\341\000\355\000\341\000\360\000\232\000\361\000\361\000\362\000\232\000"
+ "\362\000\233\000\362\000\361\000\363\000\363\000\364\000\361\000\364\000"
+ "\362\000\364\000\356\000\362\000\357\000\362\000\357\000\364\000\233\000"
+ "\356\000\365\000\366\000\366\000\367\000\365\000\367\000\367\000\370\000"
+ "\365\000\370\000\371\000\372\000\370\000\372\000\370\000\371\000\367\000"
+ "\371\000\364\000\370\000\357\000\370\000\357\000\372\000\363\000\365\000"
+ "\364\000\365\000\346\000\373\000\343\000\373\000\373\000\374\000\343\000"
+ "\374\000\346\000\360\000\360\000\373\000\372\000\373\000\357\000\373\000"
+ "\371\000\374\000\372\000\374\000\256\000\361\000\256\000\375\000\361\000"
+ "\375\000\262\000\376\000\375\000\376\000\262\000\375\000\376\000\377\000"
+ "\377\000\000\001\376\000\000\001\375\000\000\001\363\000\375\000\363\000"
+ "\000\001\271\000\001\001\272\000\001\001\001\001\002\001\272\000\002\001"
+ "\003\001\004\001\002\001\004\001\002\001\003\001\001\001\003\001\377\000"
+ "\004\001\376\000\004\001\376\000\002\001\262\000\002\001\005\001\006\001"
+ "\006\001\007\001\005\001\007\001\007\001\010\001\005\001\010\001\011\001"
+ "\012\001\007\001\012\001\007\001\011\001\006\001\011\001\004\001\007\001"
+ "\377\000\007\001\377\000\012\001\003\001\010\001\004\001\010\001\365\000"
+ "\013\001\366\000\013\001\013\001\014\001\366\000\014\001\365\000\000\001"
+ "\000\001\013\001\012\001\013\001\377\000\013\001\011\001\014\001\011\001"
+ "\013\001\275\000\015\001\271\000\015\001\001\001\015\001\302\000\016\001"
+ "\275\000\016\001\015\001\016\001\017\001\020\001\015\001\020\001\015\001"
+ "\017\001\016\001\017\001\003\001\020\001\001\001\020\001\331\000\021\001"
+ "\312\000\021\001\313\000\021\001\336\000\022\001\021\001\022\001\336\000"
+ "\021\001\017\001\022\001\016\001\022\001\016\001\021\001\302\000\021\001"
+ "\351\000\023\001\023\001\024\001\351\000\024\001\352\000\024\001\023\001"
+ "\025\001\025\001\026\001\023\001\026\001\024\001\026\001\022\001\024\001"
+ "\017\001\024\001\017\001\026\001\352\000\022\001\005\001\027\001\010\001"
+ "\027\001\010\001\030\001\027\001\030\001\010\001\020\001\020\001\030\001"
+ "\026\001\030\001\017\001\030\001\025\001\027\001\025\001\030\001\374\000"
+ "\031\001\343\000\031\001\344\000\031\001\371\000\032\001\374\000\032\001"
+ "\031\001\032\001\033\001\034\001\031\001\034\001\031\001\033\001\032\001"
+ "\033\001\347\000\034\001\344\000\034\001\014\001\035\001\366\000\035\001"
+ "\367\000\035\001\011\001\036\001\014\001\036\001\035\001\036\001\032\001"
+ "\035\001\033\001\035\001\033\001\036\001\367\000\032\001\027\001\037\001"
+ "\005\001\037\001\006\001\037\001\025\001 \001\027\001 \001\037\001 \001\036"
+ "\001\037\001\033\001\037\001\033\001 \001\006\001\036\001\354\000!\001\351"
+ "\000!\001\023\001!\001\354\000\034\001\034\001!\001 \001!\001\033\001!\001"
+ "\023\001 \001"
+;
+const unsigned long s1_4_size = 9892;
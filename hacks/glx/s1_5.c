@@ -1,1733 +1,479 @@
+/* Generated from "s1_5.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	-0.115437,0.702917,-0.701842,0.907098,0.650057,-0.673773,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	0.5309,0.794781,-0.294055,0.944384,0.679375,-0.593392,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	-0.115435,0.702917,0.701842,0.907098,0.650057,-0.326227,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.530901,0.79478,0.294055,0.944384,0.679375,-0.406608,
-	0.577305,0.816529,0,0.944762,0.694795,-0.5,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.976969,0.188349,0.100277,0.870135,0.645704,-0.4175,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.744977,0.66709,0,0.882548,0.702579,-0.5,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.976969,0.188349,0.100277,0.870135,0.645704,-0.4175,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.744977,0.66709,0,0.882548,0.702579,-0.5,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	-0.115435,0.702917,0.701842,0.907098,0.650057,-0.326227,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.794244,0.572801,0.20267,0.883764,0.687079,-0.4125,
-	-0.039712,0.912418,0.407328,0.907078,0.697653,-0.405277,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.976969,0.188349,-0.100277,0.870135,0.645704,-0.5825,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	-0.115437,0.702917,-0.701842,0.907098,0.650057,-0.673773,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	-0.744977,0.66709,0,0.882548,0.702579,-0.5,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	0.007037,0.999975,0,0.906869,0.713633,-0.5,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.039712,0.912418,-0.407328,0.907078,0.697653,-0.594723,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.976969,0.188349,-0.100277,0.870135,0.645704,-0.5825,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.794244,0.572801,-0.202671,0.883764,0.687079,-0.5875,
-	-0.744977,0.66709,0,0.882548,0.702579,-0.5,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	-0.115435,0.702917,0.701842,0.907098,0.650057,-0.326227,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	0.429706,0.63213,0.644797,0.943249,0.633115,-0.328782,
-	0.345209,0.311815,0.885213,0.941357,0.556014,-0.282086,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.06872,-0.352527,0.933275,0.936818,0.370973,-0.282086,
-	0.214014,-0.011143,0.976767,0.939088,0.463494,-0.26652,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.976969,-0.100277,0.18835,0.870135,0.398579,-0.335375,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.826326,-0.370128,0.424489,0.884979,0.320204,-0.339125,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.761522,0.030964,0.647398,0.882548,0.481079,-0.2785,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.976969,-0.100277,0.18835,0.870135,0.398579,-0.335375,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.761522,0.030964,0.647398,0.882548,0.481079,-0.2785,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	-0.826326,-0.370128,0.424489,0.884979,0.320204,-0.339125,
-	-0.826326,-0.370128,0.424489,0.884979,0.320204,-0.339125,
-	-0.845588,-0.179708,0.502679,0.883764,0.393579,-0.294,
-	-0.359172,-0.316853,0.877838,0.905187,0.382177,-0.278521,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.976969,0.100277,0.18835,0.870135,0.563579,-0.335375,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.115435,0.702917,0.701842,0.907098,0.650057,-0.326227,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.714284,0.497638,0.492092,0.884979,0.641954,-0.339125,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	-0.247399,0.003968,0.968906,0.905451,0.476683,-0.262505,
-	-0.761522,0.030964,0.647398,0.882548,0.481079,-0.2785,
-	-0.761522,0.030964,0.647398,0.882548,0.481079,-0.2785,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.23409,0.368714,0.899584,0.906322,0.571188,-0.278521,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.976969,0.100277,0.18835,0.870135,0.563579,-0.335375,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.859317,0.197434,0.471799,0.883764,0.568579,-0.294,
-	-0.761522,0.030964,0.647398,0.882548,0.481079,-0.2785,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.438574,-0.828046,0.349274,0.90443,0.255712,-0.405277,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.438574,-0.828046,0.349274,0.90443,0.255712,-0.405277,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	-0.088988,-0.705766,0.702834,0.934927,0.293873,-0.328782,
-	-0.196471,-0.920135,0.338748,0.933792,0.247612,-0.406608,
-	-0.438574,-0.828046,0.349274,0.90443,0.255712,-0.405277,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	-0.438575,-0.828046,-0.349274,0.90443,0.255712,-0.594723,
-	-0.438575,-0.828046,-0.349274,0.90443,0.255712,-0.594723,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.438575,-0.828046,-0.349274,0.90443,0.255712,-0.594723,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.196471,-0.920135,-0.338748,0.933792,0.247612,-0.593392,
-	-0.217971,-0.975955,0,0.933414,0.232192,-0.5,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.976969,-0.18835,-0.100277,0.870135,0.316454,-0.5825,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.826325,-0.370128,-0.424489,0.884979,0.320204,-0.660875,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.84069,-0.541516,0,0.882548,0.259579,-0.5,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.976969,-0.18835,-0.100277,0.870135,0.316454,-0.5825,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.438575,-0.828046,-0.349274,0.90443,0.255712,-0.594723,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.84069,-0.541516,0,0.882548,0.259579,-0.5,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	-0.826325,-0.370128,-0.424489,0.884979,0.320204,-0.660875,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	-0.849789,-0.488885,-0.197102,0.883764,0.275079,-0.5875,
-	-0.438575,-0.828046,-0.349274,0.90443,0.255712,-0.594723,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.826326,-0.370128,0.424489,0.884979,0.320204,-0.339125,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.976969,-0.18835,0.100277,0.870135,0.316454,-0.4175,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	-0.438574,-0.828046,0.349274,0.90443,0.255712,-0.405277,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.455383,-0.61687,0.641949,0.905018,0.303308,-0.326227,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.826326,-0.370128,0.424489,0.884979,0.320204,-0.339125,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.84069,-0.541516,0,0.882548,0.259579,-0.5,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.489368,-0.872077,0,0.904032,0.239732,-0.5,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.438574,-0.828046,0.349274,0.90443,0.255712,-0.405277,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.976969,-0.18835,0.100277,0.870135,0.316454,-0.4175,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.849789,-0.488886,0.197102,0.883764,0.275079,-0.4125,
-	-0.84069,-0.541516,0,0.882548,0.259579,-0.5,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	-0.088988,-0.705766,-0.702834,0.934927,0.293873,-0.671218,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	0.06872,-0.352527,-0.933275,0.936818,0.370973,-0.717914,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	-0.115437,0.702917,-0.701842,0.907098,0.650057,-0.673773,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	0.429706,0.63213,-0.644798,0.943249,0.633115,-0.671218,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.345208,0.311816,-0.885213,0.941357,0.556014,-0.717914,
-	0.214013,-0.011144,-0.976767,0.939088,0.463494,-0.73348,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.976969,0.100277,-0.18835,0.870135,0.563579,-0.664625,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.761523,0.030964,-0.647398,0.882548,0.481079,-0.7215,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.976969,0.100277,-0.18835,0.870135,0.563579,-0.664625,
-	-0.761523,0.030964,-0.647398,0.882548,0.481079,-0.7215,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.761523,0.030964,-0.647398,0.882548,0.481079,-0.7215,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	-0.115437,0.702917,-0.701842,0.907098,0.650057,-0.673773,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	-0.714284,0.497638,-0.492092,0.884979,0.641954,-0.660875,
-	-0.859317,0.197434,-0.471799,0.883764,0.568579,-0.706,
-	-0.23409,0.368714,-0.899584,0.906322,0.571188,-0.721479,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.826325,-0.370128,-0.424489,0.884979,0.320204,-0.660875,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.976969,-0.100277,-0.18835,0.870135,0.398579,-0.664625,
-	-0.826325,-0.370128,-0.424489,0.884979,0.320204,-0.660875,
-	-0.455383,-0.61687,-0.641949,0.905018,0.303308,-0.673773,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.826325,-0.370128,-0.424489,0.884979,0.320204,-0.660875,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	-0.761523,0.030964,-0.647398,0.882548,0.481079,-0.7215,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.2474,0.003968,-0.968905,0.905451,0.476683,-0.737495,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.359172,-0.316853,-0.877838,0.905187,0.382177,-0.721479,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.976969,-0.100277,-0.18835,0.870135,0.398579,-0.664625,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.845588,-0.179708,-0.502678,0.883764,0.393579,-0.706,
-	-0.761523,0.030964,-0.647398,0.882548,0.481079,-0.7215,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.976969,0.100277,0.18835,0.870135,0.563579,-0.335375,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-0.959446,0.199329,0.199329,0.87462,0.619745,-0.361333,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-0.976969,0.188349,0.100277,0.870135,0.645704,-0.4175,
-	-0.976969,0.100277,0.18835,0.870135,0.563579,-0.335375,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-0.976969,0.100277,0.18835,0.870135,0.563579,-0.335375,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.976969,0.188349,0.100277,0.870135,0.645704,-0.4175,
-	-0.976969,0.188349,0.100277,0.870135,0.645704,-0.4175,
-	-0.993621,0.079739,0.079739,0.861889,0.571579,-0.4095,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.976969,-0.18835,0.100277,0.870135,0.316454,-0.4175,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-0.959446,-0.199329,0.199329,0.87462,0.342412,-0.361333,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-0.976969,-0.100277,0.18835,0.870135,0.398579,-0.335375,
-	-0.976969,-0.18835,0.100277,0.870135,0.316454,-0.4175,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-0.976969,-0.18835,0.100277,0.870135,0.316454,-0.4175,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.969635,0,0.244558,0.867922,0.481079,-0.322437,
-	-0.976969,-0.100277,0.18835,0.870135,0.398579,-0.335375,
-	-0.976969,-0.100277,0.18835,0.870135,0.398579,-0.335375,
-	-0.993621,-0.079739,0.079739,0.861889,0.390579,-0.4095,
-	-0.996384,0,0.08496,0.859111,0.481079,-0.40225,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.976969,-0.100277,-0.18835,0.870135,0.398579,-0.664625,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-0.959446,-0.199329,-0.199329,0.87462,0.342412,-0.638667,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-0.976969,-0.18835,-0.100277,0.870135,0.316454,-0.5825,
-	-0.976969,-0.100277,-0.18835,0.870135,0.398579,-0.664625,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-0.976969,-0.100277,-0.18835,0.870135,0.398579,-0.664625,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.969635,-0.244558,0,0.867922,0.303516,-0.5,
-	-0.976969,-0.18835,-0.100277,0.870135,0.316454,-0.5825,
-	-0.976969,-0.18835,-0.100277,0.870135,0.316454,-0.5825,
-	-0.993621,-0.079739,-0.079739,0.861889,0.390579,-0.5905,
-	-0.996384,-0.08496,0,0.859111,0.383329,-0.5,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.976969,0.188349,-0.100277,0.870135,0.645704,-0.5825,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-0.959446,0.199329,-0.199329,0.87462,0.619745,-0.638667,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-0.976969,0.100277,-0.18835,0.870135,0.563579,-0.664625,
-	-0.976969,0.188349,-0.100277,0.870135,0.645704,-0.5825,
-	-0.969635,0.244558,0,0.867922,0.658641,-0.5,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-0.976969,0.188349,-0.100277,0.870135,0.645704,-0.5825,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-1,0,0,0.856159,0.481079,-0.5,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-0.996384,0.08496,0,0.859111,0.578829,-0.5,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	-0.969635,0,-0.244558,0.867922,0.481079,-0.677562,
-	-0.976969,0.100277,-0.18835,0.870135,0.563579,-0.664625,
-	-0.976969,0.100277,-0.18835,0.870135,0.563579,-0.664625,
-	-0.993621,0.079739,-0.079739,0.861889,0.571579,-0.5905,
-	-0.996384,0,-0.08496,0.859111,0.481079,-0.59775,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.668157,0.701389,-0.248233,1.071585,0.569561,-0.579959,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.668157,0.701389,-0.248233,1.071585,0.569561,-0.579959,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.700187,0.71396,0,1.161726,0.497346,-0.5,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.668157,0.701389,-0.248233,1.071585,0.569561,-0.579959,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.642358,0.715039,-0.275852,0.998334,0.63557,-0.58723,
-	0.668157,0.701389,-0.248233,1.071585,0.569561,-0.579959,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.668157,0.701389,-0.248233,1.071585,0.569561,-0.579959,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.700187,0.71396,0,1.161726,0.497346,-0.5,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.688382,0.659806,-0.301308,1.253715,0.391468,-0.567669,
-	0.682874,0.680924,-0.264625,1.158568,0.486483,-0.572975,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.700187,0.71396,0,1.161726,0.497346,-0.5,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.688382,0.659806,0.301308,1.253715,0.391468,-0.432331,
-	0.71287,0.701296,0,1.258403,0.4006,-0.5,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.668157,0.701389,0.248233,1.071585,0.569561,-0.420041,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.668157,0.701389,0.248233,1.071585,0.569561,-0.420041,
-	0.662437,0.749118,0,0.99928,0.649745,-0.5,
-	0.668157,0.701389,0.248233,1.071585,0.569561,-0.420041,
-	0.642358,0.715039,0.275852,0.998334,0.63557,-0.41277,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.700187,0.71396,0,1.161726,0.497346,-0.5,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.668157,0.701389,0.248233,1.071585,0.569561,-0.420041,
-	0.687547,0.72614,0,1.073477,0.582162,-0.5,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.668157,0.701389,0.248233,1.071585,0.569561,-0.420041,
-	0.682874,0.680923,0.264625,1.158568,0.486483,-0.427025,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	0.110573,-0.360362,-0.926236,0.979421,0.352064,-0.703536,
-	0.010629,-0.366255,-0.930454,1.033759,0.31755,-0.686572,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	-0.469451,-0.529408,-0.706642,1.136509,0.163187,-0.624059,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	-0.469451,-0.529408,-0.706642,1.136509,0.163187,-0.624059,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.469451,-0.529408,-0.706642,1.136509,0.163187,-0.624059,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.19623,-0.318838,-0.927274,1.15995,0.208844,-0.657894,
-	-0.092335,-0.356775,-0.929616,1.095409,0.269215,-0.670274,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.568513,0.503436,-0.65065,1.23965,0.364075,-0.624059,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	0.340631,0.234777,-0.910412,1.216209,0.318418,-0.657894,
-	0.084953,-0.04518,-0.99536,1.18808,0.263631,-0.669172,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.575185,0.562873,-0.59358,0.995497,0.593044,-0.659921,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.291602,-0.024985,-0.956213,0.985095,0.437116,-0.718074,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.447221,0.281892,-0.84884,0.990769,0.522168,-0.703536,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	0.167416,-0.052778,-0.984473,1.114357,0.334395,-0.682436,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.238763,-0.041303,-0.970199,1.045107,0.393153,-0.699898,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.599141,0.555368,-0.576712,1.065911,0.531759,-0.646592,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.585003,0.517563,-0.62442,1.149095,0.453892,-0.633787,
-	0.431005,0.262774,-0.86324,1.056455,0.468757,-0.686572,
-	0.392854,0.244042,-0.886628,1.133305,0.399575,-0.670274,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	0.110573,-0.360361,0.926236,0.979421,0.352064,-0.296464,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	0.010629,-0.366254,0.930454,1.033759,0.31755,-0.313428,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	0.575185,0.562873,0.59358,0.995497,0.593044,-0.340079,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.599141,0.555368,0.576712,1.065911,0.531759,-0.353408,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.447221,0.281892,0.848841,0.990769,0.522168,-0.296464,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.291601,-0.024985,0.956214,0.985095,0.437116,-0.281926,
-	0.431005,0.262774,0.863241,1.056455,0.468757,-0.313428,
-	0.238762,-0.041303,0.970199,1.045107,0.393153,-0.300102,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	0.585003,0.517563,0.62442,1.149095,0.453892,-0.366213,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.568513,0.503436,0.65065,1.23965,0.364075,-0.375941,
-	0.34063,0.234777,0.910412,1.216209,0.318418,-0.342106,
-	0.392854,0.244041,0.886628,1.133305,0.399575,-0.329726,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.469451,-0.529408,0.706642,1.136509,0.163187,-0.375941,
-	-0.469451,-0.529408,0.706642,1.136509,0.163187,-0.375941,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	-0.469451,-0.529408,0.706642,1.136509,0.163187,-0.375941,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	0.167415,-0.052778,0.984473,1.114357,0.334395,-0.317564,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	-0.092335,-0.356776,0.929616,1.095409,0.269215,-0.329726,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	-0.19623,-0.318838,0.927274,1.15995,0.208844,-0.342106,
-	0.084953,-0.04518,0.99536,1.18808,0.263631,-0.330828,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	-0.103837,-0.707557,-0.698986,0.974692,0.281188,-0.659921,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.260846,-0.906261,-0.332641,0.971855,0.238662,-0.58723,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.60511,-0.796142,0,1.066987,0.171444,-0.5,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.251782,-0.681632,-0.687011,1.024302,0.254547,-0.646592,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.42869,-0.845027,-0.319616,1.018628,0.216746,-0.579959,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.103837,-0.707557,0.698986,0.974692,0.281188,-0.340079,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.251782,-0.681632,0.68701,1.024302,0.254547,-0.353408,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.60511,-0.796142,0,1.066987,0.171444,-0.5,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.260846,-0.906261,0.332641,0.971855,0.238662,-0.41277,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.339022,-0.940778,0,0.97091,0.224487,-0.5,
-	-0.42869,-0.845027,0.319616,1.018628,0.216746,-0.420041,
-	-0.49913,-0.866527,0,1.016736,0.204145,-0.5,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.469451,-0.529408,0.706642,1.136509,0.163187,-0.375941,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.60511,-0.796142,0,1.066987,0.171444,-0.5,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.469451,-0.529408,0.706642,1.136509,0.163187,-0.375941,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.405056,-0.645141,0.64786,1.079619,0.214898,-0.366213,
-	-0.649709,-0.667916,0.362996,1.122445,0.135794,-0.432331,
-	-0.573691,-0.778283,0.255254,1.070145,0.182308,-0.427025,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.469451,-0.529408,-0.706642,1.136509,0.163187,-0.624059,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.405056,-0.645141,-0.64786,1.079619,0.214898,-0.633787,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.469451,-0.529408,-0.706642,1.136509,0.163187,-0.624059,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.60511,-0.796142,0,1.066987,0.171444,-0.5,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.573691,-0.778283,-0.255254,1.070145,0.182308,-0.572975,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.649709,-0.667916,-0.362996,1.122445,0.135794,-0.567669,
-	-0.713427,-0.700729,0,1.117756,0.126662,-0.5,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.356933,0.09138,-0.92965,1.401596,-0.166219,-0.703536,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.736772,-0.170063,-0.654405,1.310553,-0.12345,-0.646592,
-	-0.356933,0.09138,-0.92965,1.401596,-0.166219,-0.703536,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.356933,0.09138,-0.92965,1.401596,-0.166219,-0.703536,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	-0.411811,-0.074302,-0.908235,1.329732,-0.022152,-0.670274,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.736772,-0.170063,-0.654405,1.310553,-0.12345,-0.646592,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.410606,0.007113,-0.911785,1.370721,-0.099359,-0.686572,
-	-0.411811,-0.074302,-0.908235,1.329732,-0.022152,-0.670274,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	0.22394,0.359068,-0.906047,1.515124,-0.041541,-0.686572,
-	-0.076935,0.189453,-0.978871,1.442923,-0.07045,-0.699898,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	-0.080719,0.04088,-0.995898,1.329879,0.097243,-0.669172,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	0.284277,0.249094,-0.925818,1.300058,0.22908,-0.652683,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	-0.080719,0.04088,-0.995898,1.329879,0.097243,-0.669172,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.192479,0.2506,-0.948763,1.379742,0.135354,-0.657894,
-	0.227361,0.327503,-0.917087,1.452388,0.04317,-0.670274,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.411811,-0.074302,-0.908235,1.329732,-0.022152,-0.670274,
-	-0.411811,-0.074302,-0.908235,1.329732,-0.022152,-0.670274,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	-0.080719,0.04088,-0.995898,1.329879,0.097243,-0.669172,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.094492,0.118807,-0.988411,1.39106,0.010509,-0.682436,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.411811,-0.074302,-0.908235,1.329732,-0.022152,-0.670274,
-	-0.080719,0.04088,-0.995898,1.329879,0.097243,-0.669172,
-	0.003001,-0.001255,-0.999995,1.261509,0.18365,-0.663589,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	-0.293198,-0.238286,-0.925881,1.22296,0.138221,-0.652683,
-	-0.356146,-0.13643,-0.924417,1.280017,0.059132,-0.657894,
-	-0.080719,0.04088,-0.995898,1.329879,0.097243,-0.669172,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.736772,-0.170063,-0.654405,1.310553,-0.12345,-0.646592,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.736772,-0.170063,-0.654405,1.310553,-0.12345,-0.646592,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.736772,-0.170063,-0.654405,1.310553,-0.12345,-0.646592,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.977953,-0.208824,0,1.278985,-0.206245,-0.5,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.904992,-0.260217,-0.336566,1.274453,-0.137904,-0.579959,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.591819,-0.448047,-0.670078,1.190836,0.100363,-0.619965,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.769835,-0.555714,-0.313903,1.171562,0.077649,-0.565436,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.880661,-0.339398,-0.330522,1.247962,-0.0657,-0.572975,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.691037,-0.22774,-0.686005,1.278626,-0.049369,-0.633787,
-	-0.660133,-0.325846,-0.676793,1.238464,0.027373,-0.624059,
-	-0.841533,-0.433873,-0.321832,1.213533,0.008318,-0.567669,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.769835,-0.555714,0.313903,1.171562,0.077649,-0.434564,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.831075,-0.55616,0,1.165137,0.070077,-0.5,
-	-0.841533,-0.433873,0.321832,1.213533,0.008318,-0.432331,
-	-0.896641,-0.442758,0,1.205222,0.001966,-0.5,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.736772,-0.170063,0.654405,1.310553,-0.12345,-0.353408,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.977953,-0.208824,0,1.278985,-0.206245,-0.5,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.934966,-0.354738,0,1.237741,-0.071143,-0.5,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.960468,-0.278392,0,1.262419,-0.142723,-0.5,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.736772,-0.170063,0.654405,1.310553,-0.12345,-0.353408,
-	-0.736772,-0.170063,0.654405,1.310553,-0.12345,-0.353408,
-	-0.904992,-0.260217,0.336566,1.274453,-0.137904,-0.420041,
-	-0.880661,-0.339398,0.330522,1.247962,-0.0657,-0.427025,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.736772,-0.170063,0.654405,1.310553,-0.12345,-0.353408,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.356933,0.09138,0.92965,1.401596,-0.166219,-0.296464,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.411811,-0.074302,0.908235,1.329732,-0.022152,-0.329726,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.736772,-0.170063,0.654405,1.310553,-0.12345,-0.353408,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.411811,-0.074302,0.908235,1.329732,-0.022152,-0.329726,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	-0.356933,0.09138,0.92965,1.401596,-0.166219,-0.296464,
-	-0.356933,0.09138,0.92965,1.401596,-0.166219,-0.296464,
-	-0.410607,0.007113,0.911785,1.370721,-0.099359,-0.313428,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.591819,-0.448047,0.670078,1.190836,0.100363,-0.380035,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	-0.080719,0.04088,0.995898,1.329879,0.097243,-0.330828,
-	-0.080719,0.04088,0.995898,1.329879,0.097243,-0.330828,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.293197,-0.238286,0.925881,1.22296,0.138221,-0.347317,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	-0.411811,-0.074302,0.908235,1.329732,-0.022152,-0.329726,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.080719,0.04088,0.995898,1.329879,0.097243,-0.330828,
-	-0.411811,-0.074302,0.908235,1.329732,-0.022152,-0.329726,
-	-0.691037,-0.22774,0.686005,1.278626,-0.049369,-0.366213,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.660133,-0.325846,0.676793,1.238464,0.027373,-0.375941,
-	-0.356146,-0.13643,0.924417,1.280017,0.059132,-0.342106,
-	-0.411811,-0.074302,0.908235,1.329732,-0.022152,-0.329726,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	-0.080719,0.04088,0.995898,1.329879,0.097243,-0.330828,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	0.284277,0.249093,0.925818,1.300058,0.22908,-0.347317,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	0.003001,-0.001255,0.999995,1.261509,0.18365,-0.336411,
-	0.192478,0.250599,0.948763,1.379742,0.135354,-0.342106,
-	-0.080719,0.04088,0.995898,1.329879,0.097243,-0.330828,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	-0.094492,0.118807,0.988411,1.39106,0.010509,-0.317564,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	-0.076935,0.189453,0.978871,1.442923,-0.07045,-0.300102,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.22394,0.359067,0.906047,1.515124,-0.041541,-0.313428,
-	0.227361,0.327503,0.917087,1.452388,0.04317,-0.329726,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.523007,0.53259,0.665441,1.575292,-0.017451,-0.353408,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.706952,0.630412,0.320624,1.611392,-0.002996,-0.420041,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.547232,0.498931,0.672016,1.332183,0.266938,-0.380035,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.694102,0.647395,0.314805,1.351457,0.289652,-0.434564,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.522827,0.522069,0.673866,1.503495,0.070388,-0.366213,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.509286,0.493808,0.704828,1.421294,0.167113,-0.375941,
-	0.698693,0.638817,0.32209,1.446226,0.186168,-0.432331,
-	0.703,0.633573,0.323073,1.534158,0.086718,-0.427025,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.547232,0.498931,-0.672015,1.332183,0.266938,-0.619965,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.509286,0.493808,-0.704828,1.421294,0.167113,-0.624059,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.726158,0.687528,0,1.357882,0.297224,-0.5,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.694102,0.647395,-0.314805,1.351457,0.289652,-0.565436,
-	0.698693,0.638817,-0.32209,1.446226,0.186168,-0.567669,
-	0.738573,0.674173,0,1.454536,0.19252,-0.5,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.747578,0.664174,0,1.54438,0.092162,-0.5,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.754132,0.656723,0,1.623426,0.001822,-0.5,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.523007,0.53259,-0.665441,1.575292,-0.017451,-0.646592,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.522827,0.522069,-0.673866,1.503495,0.070388,-0.633787,
-	0.706952,0.630412,-0.320624,1.611392,-0.002996,-0.579959,
-	0.703,0.633573,-0.323073,1.534158,0.086718,-0.572975,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.709684,0.62897,0.317403,1.674065,-0.077274,-0.41277,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.722198,-0.015351,0.691516,1.693578,-0.180157,-0.326227,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.765571,0.555064,0.325277,1.718314,-0.130413,-0.406608,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.722198,-0.015351,-0.691516,1.693578,-0.180157,-0.673773,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.758437,0.651747,0,1.687689,-0.072827,-0.5,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.709684,0.62897,-0.317403,1.674065,-0.077274,-0.58723,
-	0.765571,0.555064,-0.325277,1.718314,-0.130413,-0.593392,
-	0.798106,0.602517,0,1.733181,-0.12611,-0.5,
-	0.442953,-0.878385,-0.179534,1.670754,-0.221475,-0.638667,
-	0.43479,-0.894931,-0.100277,1.696988,-0.219088,-0.5825,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.442953,-0.878385,-0.179534,1.670754,-0.221475,-0.638667,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.821423,-0.57032,0,1.748713,-0.192378,-0.5,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.43479,-0.894931,-0.100277,1.696988,-0.219088,-0.5825,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.821423,-0.57032,0,1.748713,-0.192378,-0.5,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.722198,-0.015351,-0.691516,1.693578,-0.180157,-0.673773,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.746757,-0.63494,-0.198004,1.733426,-0.195216,-0.5875,
-	0.911574,0.083749,-0.402516,1.73961,-0.167898,-0.594723,
-	0.442953,-0.878385,0.179534,1.670754,-0.221475,-0.361333,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.442953,-0.878385,0.179534,1.670754,-0.221475,-0.361333,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.43479,-0.894931,0.100278,1.696988,-0.219088,-0.4175,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.722198,-0.015351,0.691516,1.693578,-0.180157,-0.326227,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.821423,-0.57032,0,1.748713,-0.192378,-0.5,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.990091,0.14043,0,1.755118,-0.163978,-0.5,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.911574,0.083749,0.402517,1.73961,-0.167898,-0.405277,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.43479,-0.894931,0.100278,1.696988,-0.219088,-0.4175,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.746757,-0.63494,0.198005,1.733426,-0.195216,-0.4125,
-	0.821423,-0.57032,0,1.748713,-0.192378,-0.5,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	0.523401,0.54123,-0.65812,1.633195,-0.090616,-0.659921,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	0.223762,0.38464,-0.895535,1.565078,-0.112852,-0.703536,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	0.722198,-0.015351,-0.691516,1.693578,-0.180157,-0.673773,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.58545,0.437052,-0.682813,1.673712,-0.14332,-0.671218,
-	0.256589,0.31723,-0.912977,1.599377,-0.164832,-0.717914,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.738864,-0.111606,-0.664548,1.346635,-0.237972,-0.671218,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.356933,0.09138,-0.92965,1.401596,-0.166219,-0.703536,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.738864,-0.111606,-0.664548,1.346635,-0.237972,-0.671218,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	-0.356933,0.09138,-0.92965,1.401596,-0.166219,-0.703536,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.07755,0.232519,-0.969495,1.483337,-0.139536,-0.718074,
-	-0.39719,0.033721,-0.917117,1.420971,-0.21646,-0.717914,
-	-0.053569,0.174234,-0.983246,1.510174,-0.190646,-0.73348,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	0.155998,-0.969633,-0.18835,1.458284,-0.283049,-0.664625,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	-0.175453,-0.874143,-0.452869,1.378738,-0.288996,-0.660875,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.205519,-0.76511,-0.61022,1.53476,-0.249706,-0.7215,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	0.155998,-0.969633,-0.18835,1.458284,-0.283049,-0.664625,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	0.205519,-0.76511,-0.61022,1.53476,-0.249706,-0.7215,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.175453,-0.874143,-0.452869,1.378738,-0.288996,-0.660875,
-	-0.175453,-0.874143,-0.452869,1.378738,-0.288996,-0.660875,
-	0.03573,-0.852716,-0.521152,1.449927,-0.271179,-0.706,
-	-0.236076,-0.378114,-0.895152,1.435022,-0.251106,-0.721479,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.442953,-0.878385,-0.179534,1.670754,-0.221475,-0.638667,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.722198,-0.015351,-0.691516,1.693578,-0.180157,-0.673773,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.633983,-0.622541,-0.458813,1.689524,-0.205721,-0.660875,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	0.205519,-0.76511,-0.61022,1.53476,-0.249706,-0.7215,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.100693,-0.274502,-0.9563,1.526344,-0.226473,-0.737495,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.442231,-0.107524,-0.890433,1.617509,-0.201252,-0.721479,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.389599,-0.715498,-0.579893,1.618964,-0.225886,-0.706,
-	0.205519,-0.76511,-0.61022,1.53476,-0.249706,-0.7215,
-	-0.738864,-0.111606,-0.664548,1.346635,-0.237972,-0.671218,
-	-0.693597,-0.068529,-0.717096,1.333479,-0.188456,-0.659921,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.899118,-0.21787,-0.37963,1.302034,-0.25088,-0.593392,
-	-0.738864,-0.111606,-0.664548,1.346635,-0.237972,-0.671218,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.977953,-0.208824,0,1.278985,-0.206245,-0.5,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.899118,-0.21787,-0.37963,1.302034,-0.25088,-0.593392,
-	-0.932432,-0.178414,-0.314228,1.292609,-0.201797,-0.58723,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.822459,-0.568824,0,1.297571,-0.288968,-0.5,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	-0.899118,-0.21787,-0.37963,1.302034,-0.25088,-0.593392,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.738864,-0.111606,-0.664548,1.346635,-0.237972,-0.671218,
-	-0.899118,-0.21787,-0.37963,1.302034,-0.25088,-0.593392,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.899118,-0.21787,-0.37963,1.302034,-0.25088,-0.593392,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.738864,-0.111606,0.664548,1.346635,-0.237972,-0.328782,
-	-0.738864,-0.111606,0.664548,1.346635,-0.237972,-0.328782,
-	-0.899119,-0.217869,0.37963,1.302034,-0.25088,-0.406608,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	-0.899119,-0.217869,0.37963,1.302034,-0.25088,-0.406608,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.899119,-0.217869,0.37963,1.302034,-0.25088,-0.406608,
-	-0.738864,-0.111606,0.664548,1.346635,-0.237972,-0.328782,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	-0.822459,-0.568824,0,1.297571,-0.288968,-0.5,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.899119,-0.217869,0.37963,1.302034,-0.25088,-0.406608,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	-0.977953,-0.208824,0,1.278985,-0.206245,-0.5,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.932432,-0.178414,0.314228,1.292609,-0.201797,-0.41277,
-	-0.899119,-0.217869,0.37963,1.302034,-0.25088,-0.406608,
-	-0.972456,-0.233085,0,1.287166,-0.255182,-0.5,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	0.070927,-0.992428,0.100277,1.378957,-0.304305,-0.4175,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	-0.175453,-0.874143,0.452869,1.378738,-0.288996,-0.339125,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	0.070927,-0.992428,0.100277,1.378957,-0.304305,-0.4175,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.822459,-0.568824,0,1.297571,-0.288968,-0.5,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.175453,-0.874143,0.452869,1.378738,-0.288996,-0.339125,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.244016,-0.944635,0.219364,1.335465,-0.301849,-0.4125,
-	-0.775521,-0.569812,0.271814,1.312921,-0.28446,-0.405277,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	-0.175453,-0.874143,-0.452869,1.378738,-0.288996,-0.660875,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	0.070927,-0.992428,-0.100277,1.378957,-0.304305,-0.5825,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	-0.588534,-0.475384,-0.653941,1.358796,-0.271614,-0.673773,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	-0.175453,-0.874143,-0.452869,1.378738,-0.288996,-0.660875,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	-0.822459,-0.568824,0,1.297571,-0.288968,-0.5,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	-0.77552,-0.569812,-0.271814,1.312921,-0.28446,-0.594723,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	0.070927,-0.992428,-0.100277,1.378957,-0.304305,-0.5825,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	-0.244016,-0.944635,-0.219364,1.335465,-0.301849,-0.5875,
-	-0.433457,-0.901174,0,1.320807,-0.307035,-0.5,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.356933,0.09138,0.92965,1.401596,-0.166219,-0.296464,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.693597,-0.068529,0.717096,1.333479,-0.188456,-0.340079,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.738864,-0.111606,0.664548,1.346635,-0.237972,-0.328782,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.356933,0.09138,0.92965,1.401596,-0.166219,-0.296464,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.738864,-0.111606,0.664548,1.346635,-0.237972,-0.328782,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.39719,0.033722,0.917117,1.420971,-0.21646,-0.282086,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	0.523401,0.54123,0.65812,1.633195,-0.090616,-0.340079,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.722198,-0.015351,0.691516,1.693578,-0.180157,-0.326227,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	0.58545,0.437052,0.682813,1.673712,-0.14332,-0.328782,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	-0.07755,0.232519,0.969495,1.483337,-0.139536,-0.281926,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	0.223762,0.384639,0.895535,1.565078,-0.112852,-0.296464,
-	0.256589,0.31723,0.912977,1.599377,-0.164832,-0.282086,
-	-0.053569,0.174235,0.983246,1.510174,-0.190646,-0.26652,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.442953,-0.878385,0.179534,1.670754,-0.221475,-0.361333,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.205519,-0.76511,0.610221,1.53476,-0.249706,-0.2785,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.205519,-0.76511,0.610221,1.53476,-0.249706,-0.2785,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	0.722198,-0.015351,0.691516,1.693578,-0.180157,-0.326227,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.633983,-0.62254,0.458813,1.689524,-0.205721,-0.339125,
-	0.389599,-0.715497,0.579893,1.618964,-0.225886,-0.294,
-	0.442231,-0.107524,0.890433,1.617509,-0.201252,-0.278521,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	-0.175453,-0.874143,0.452869,1.378738,-0.288996,-0.339125,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	0.155998,-0.969634,0.188349,1.458284,-0.283049,-0.335375,
-	-0.175453,-0.874143,0.452869,1.378738,-0.288996,-0.339125,
-	-0.588534,-0.475383,0.653941,1.358796,-0.271614,-0.326227,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	-0.175453,-0.874143,0.452869,1.378738,-0.288996,-0.339125,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	0.205519,-0.76511,0.610221,1.53476,-0.249706,-0.2785,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	0.100693,-0.274502,0.9563,1.526344,-0.226473,-0.262505,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	-0.236076,-0.378113,0.895153,1.435022,-0.251106,-0.278521,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.155998,-0.969634,0.188349,1.458284,-0.283049,-0.335375,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.03573,-0.852716,0.521152,1.449927,-0.271179,-0.294,
-	0.205519,-0.76511,0.610221,1.53476,-0.249706,-0.2785,
-	0.442953,-0.878385,-0.179534,1.670754,-0.221475,-0.638667,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.442953,-0.878385,-0.179534,1.670754,-0.221475,-0.638667,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.43479,-0.894931,-0.100277,1.696988,-0.219088,-0.5825,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.361333,-0.91087,-0.199385,1.617662,-0.240344,-0.664625,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.43479,-0.894931,-0.100277,1.696988,-0.219088,-0.5825,
-	0.43479,-0.894931,-0.100277,1.696988,-0.219088,-0.5825,
-	0.33419,-0.939127,-0.079739,1.627523,-0.246239,-0.5905,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	0.070927,-0.992428,-0.100277,1.378957,-0.304305,-0.5825,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.055786,-0.978343,-0.199329,1.40287,-0.293254,-0.638667,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.155998,-0.969633,-0.18835,1.458284,-0.283049,-0.664625,
-	0.070927,-0.992428,-0.100277,1.378957,-0.304305,-0.5825,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.070927,-0.992428,-0.100277,1.378957,-0.304305,-0.5825,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.25096,-0.936595,-0.244557,1.538546,-0.263835,-0.677562,
-	0.155998,-0.969633,-0.18835,1.458284,-0.283049,-0.664625,
-	0.155998,-0.969633,-0.18835,1.458284,-0.283049,-0.664625,
-	0.180146,-0.980403,-0.079739,1.452691,-0.293085,-0.5905,
-	0.257883,-0.962433,-0.08496,1.540826,-0.272345,-0.59775,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	0.155998,-0.969634,0.188349,1.458284,-0.283049,-0.335375,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.055786,-0.978344,0.199328,1.40287,-0.293254,-0.361333,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.070927,-0.992428,0.100277,1.378957,-0.304305,-0.4175,
-	0.155998,-0.969634,0.188349,1.458284,-0.283049,-0.335375,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.155998,-0.969634,0.188349,1.458284,-0.283049,-0.335375,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.014735,-0.999891,0,1.367033,-0.309791,-0.5,
-	0.070927,-0.992428,0.100277,1.378957,-0.304305,-0.4175,
-	0.070927,-0.992428,0.100277,1.378957,-0.304305,-0.4175,
-	0.180146,-0.980403,0.079739,1.452691,-0.293085,-0.4095,
-	0.175818,-0.984423,0,1.446407,-0.297645,-0.5,
-	0.442953,-0.878385,0.179534,1.670754,-0.221475,-0.361333,
-	0.43479,-0.894931,0.100278,1.696988,-0.219088,-0.4175,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.442953,-0.878385,0.179534,1.670754,-0.221475,-0.361333,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.43479,-0.894931,0.100278,1.696988,-0.219088,-0.4175,
-	0.487185,-0.873299,0,1.710058,-0.217878,-0.5,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.43479,-0.894931,0.100278,1.696988,-0.219088,-0.4175,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.258819,-0.965926,0,1.54159,-0.275196,-0.5,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.339948,-0.940444,0,1.635245,-0.247046,-0.5,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-	0.25096,-0.936595,0.244557,1.538546,-0.263835,-0.322437,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.361333,-0.91087,0.199385,1.617662,-0.240344,-0.335375,
-	0.33419,-0.939126,0.079739,1.627523,-0.246239,-0.4095,
-	0.257883,-0.962433,0.08496,1.540826,-0.272345,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_5=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_5[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000*\037"
+ "\247\077a\304N>\000\000\000\277\225\000\2037l\262\325a\000\330\000\000\042"
+ "\263xl.\352\000\000\243\245mw\244\350\000\000[\245\333k,\325\000\000_\263"
+ "\004p\000\000\000\000\274\245I{\000\000\000\000A\234\377\177\000\000\000"
+ "\000O\234\000|O\350\000\000P\234\030p\211\324\000\000l\262\325a\000(\000"
+ "\000[\245\333k\324*\000\000\243\245mw\134\027\000\000\042\263xl\322\025\000"
+ "\000P\234\030pw+\000\000O\234\000|\261\027\000\0000\224\203h\257\042\000"
+ "\000\021\223\001o\243\024\000\000z\226[y\343\025\000\000\307\226\021n=(\000"
+ "\000\203\222>r\000\000\000\000,\226;}\000\000\000\0000\224\203hQ\335\000"
+ "\000\307\226\021n\303\327\000\000z\226[y\035\352\000\000\021\223\001o]\353"
+ "\000\000>\261\033P\3512\000\000\342\244\222X\2026\000\000\322\257\324:\214"
+ "6\000\000P\244nAg:\000\000\346\233\272Dh;\000\000\036\234^\134f7\000\000"
+ "g\256\216%\3512\000\0008\255\324\023\000(\000\000F\243\000\027\324*\000\000"
+ "\277\243I*\2026\000\000\313\233\134\031w+\000\000\325\233\027-f7\000\000"
+ "0\224$#\257\042\000\000\021\22311.)\000\000z\226\361/\2073\000\000\307\226"
+ "\226\035=(\000\000\203\222\324Ej,\000\000,\226\324Eh7\000\000z\226\267[\207"
+ "3\000\000\021\223vZ.)\000\000\202\2541\011\322\025\000\000\375\242n\013\134"
+ "\027\000\000F\254\245\005\000\000\000\000\345\242\222\007\000\000\000\000"
+ "\214\233u\011\000\000\000\000\245\233t\015\261\027\000\0008\255\324\023\000"
+ "\330\000\000F\243\000\027,\325\000\000\375\242n\013\244\350\000\000\202\254"
+ "1\011.\352\000\000\313\233\134\031\211\324\000\000\245\233t\015O\350\000"
+ "\0000\224$#Q\335\000\000\021\223\246\034]\353\000\000z\226M\022\035\352\000"
+ "\000\307\226\226\035\303\327\000\000\203\222j\031\000\000\000\000,\226l\016"
+ "\000\000\000\000z\226M\022\343\025\000\000\021\223\246\034\243\024\000\000"
+ "g\256\216%\027\315\000\000\277\243I*~\311\000\000\322\257\324:t\311\000\000"
+ "P\244nA\231\305\000\000\346\233\272D\230\304\000\000\325\233\027-\232\310"
+ "\000\000\342\244\222X~\311\000\000>\261\033P\027\315\000\000\036\234^\134"
+ "\232\310\000\000\021\223vZ\322\326\000\000z\226\267[y\314\000\000\203\222"
+ "\324E\226\323\000\000,\226\324E\230\310\000\000z\226\361/y\314\000\000\021"
+ "\22311\322\326\000\000\001\221w\134\243\026\000\000O\220\324Es\030\000\000"
+ "\222\217\324E\000\000\000\000O\220G^\000\000\000\000\001\2211/\243\026\000"
+ "\000O\220`-\000\000\000\000\001\2211/]\351\000\000O\220\324E\215\347\000"
+ "\000\001\221w\134]\351\000\000\011\304\201RU\333\000\000u\305\365[\000\354"
+ "\000\000\330\330\007\077\211\336\000\0006\333.G\277\355\000\000\001\334\345"
+ "I\000\000\000\000\356\305\034_\000\000\000\000~\357\217(\370\340\000\000"
+ "\244\006C\020\376\341\000\000v\013\362\025\242\357\000\000\003\363i/\023"
+ "\357\000\000\021\015\327\027\000\000\000\000/\364\2621\000\000\000\000v\013"
+ "\362\025^\020\000\000\244\006C\020\002\036\000\000~\357\217(\010\037\000"
+ "\000\003\363i/\355\020\000\000\330\330\007\077w!\000\0006\333.GA\022\000"
+ "\000\011\304\201R\253$\000\000u\305\365[\000\024\000\000\241\271*\015U\333"
+ "\000\000\376\273\354\034U\321\000\000w\307\077\003\211\336\000\000j\313\325"
+ "\020i\325\000\000'\320#!^\322\000\000\325\276\325/\000\316\000\000\262\325"
+ "P\366\370\340\000\000I\343\231\346\376\341\000\000R\353\021\360\317\331\000"
+ "\000\217\333\273\001\201\330\000\000\366\364n\373\025\327\000\000\230\342"
+ "p\017\257\325\000\000\241\351$\035\201\330\000\000\233\376\313\006\317\331"
+ "\000\000\345\324q1i\325\000\000\254\301\277BU\321\000\000\376\273\354\034"
+ "\253.\000\000\241\271*\015\253$\000\000\325\276\325/\0002\000\000'\320#!"
+ "\242-\000\000j\313\325\020\227*\000\000w\307\077\003w!\000\000\254\301\277"
+ "B\253.\000\000\345\324q1\227*\000\000\233\376\313\0061&\000\000\241\351$"
+ "\035\177'\000\000\366\364n\373\353(\000\000\230\342p\017Q*\000\000R\353\021"
+ "\3601&\000\000I\343\231\346\002\036\000\000\262\325P\366\010\037\000\000"
+ "\217\333\273\001\177'\000\0006\270\265\003\000\354\000\000\274\267\216\000"
+ "\000\000\000\000N\304`\370\000\000\000\000\030\305\030\373\277\355\000\000"
+ "6\270\265\003\000\024\000\000\030\305\030\373A\022\000\000w\336\352\340^"
+ "\020\000\000-\322v\357\355\020\000\000\333\334\005\337\000\000\000\000\001"
+ "\321-\355\000\000\000\000-\322v\357\023\357\000\000w\336\352\340\242\357"
+ "\000\000\367\006[\236\000\330\000\000\001\030\352\243\027\315\000\000G\020"
+ "\244\264U\321\000\000;\001\235\256U\333\000\000s,\227\252t\311\000\000W\042"
+ "\337\273\000\316\000\000^\025\037\320^\322\000\000\007\006\364\307i\325\000"
+ "\000>\371%\301\211\336\000\000\345@D\261\027\315\000\000\357Q\324\266\000"
+ "\330\000\000sC!\311U\333\000\000f4\032\303U\321\000\000~1\031\337\211\336"
+ "\000\000\265$K\330i\325\000\000\356\034K\367\370\340\000\000\211\022Y\357"
+ "\201\330\000\000\020\006\321\345\257\325\000\0003\357W\324\370\340\000\000"
+ "\227\371I\334\201\330\000\0003\370\000\253\000\354\000\000\276\374\004\233"
+ ".\352\000\000\223\361\017\275\277\355\000\000\004\357\263\273\000\000\000"
+ "\0000\365\313\251\000\000\000\000U\371\347\231\000\000\000\000\366\350\223"
+ "\317\023\357\000\000\342\346\374\315\000\000\000\0003\357W\324\010\037\000"
+ "\000\366\350\223\317\355\020\000\000>\371%\301w!\000\000\223\361\017\275"
+ "A\022\000\000\367\006[\236\000(\000\000\276\374\004\233\322\025\000\0003"
+ "\370\000\253\000\024\000\000;\001\235\256\253$\000\000G\020\244\264\253."
+ "\000\000\001\030\352\243\3512\000\000\007\006\364\307\227*\000\000^\025\037"
+ "\320\242-\000\000W\042\337\273\0002\000\000s,\227\252\2146\000\000\227\371"
+ "I\334\177'\000\000\020\006\321\345Q*\000\000\356\034K\367\010\037\000\000"
+ "\211\022Y\357\177'\000\000~1\031\337w!\000\000\265$K\330\227*\000\000sC!"
+ "\311\253$\000\000\357Q\324\266\000(\000\000\345@D\261\3512\000\000f4\032"
+ "\303\253.\000\000(\134*\272\322\025\000\000{L\276\314\000\024\000\000)9/"
+ "\343A\022\000\000\270;\214\344\000\000\000\000}O\363\315\000\000\000\000"
+ "\220_G\273\000\000\000\000*#\017\374\355\020\000\000\077%\246\375\000\000"
+ "\000\000*#\017\374\023\357\000\000)9/\343\277\355\000\000(\134*\272.\352"
+ "\000\000{L\276\314\000\354\000\0009g\337\254\134\027\000\000\021\134\245"
+ "\251\324*\000\000\361j\363\255\000\000\000\000npz\244\000\000\000\000\215"
+ "l\177\243\261\027\000\000\011an\240w+\000\000\021\134\245\251,\325\000\000"
+ "9g\337\254\244\350\000\000\011an\240\211\324\000\000\215l\177\243O\350\000"
+ "\000T[\030\226Q\335\000\000\344a\261\226]\353\000\000\001k\252\234\035\352"
+ "\000\000\006`\011\232\303\327\000\000)e\377\226\000\000\000\000\324n_\235"
+ "\000\000\000\000T[\030\226\257\042\000\000\006`\011\232=(\000\000\001k\252"
+ "\234\343\025\000\000\344a\261\226\243\024\000\000yIC\244~\311\000\000)3\316"
+ "\235\231\305\000\00057\330\224\230\304\000\000\002N'\233\232\310\000\000"
+ "A\012\370\221,\325\000\000\331\034Y\227~\311\000\000L\015\216\211\211\324"
+ "\000\000] \257\216\232\310\000\000R\030$\204Q\335\000\000/&\261\206\322\326"
+ "\000\000\027$\251\211y\314\000\000I\0225\205\303\327\000\000B:\200\213\226"
+ "\323\000\000P9\010\217\230\310\000\000\014N`\221\322\326\000\000`N\376\224"
+ "y\314\000\000\031\377\275\216\244\350\000\000a\373\252\215\000\000\000\000"
+ "\373\3756\205\000\000\000\000\322\001W\206O\350\000\000A\012\370\221\324"
+ "*\000\000\031\377\275\216\134\027\000\000L\015\216\211w+\000\000\322\001"
+ "W\206\261\027\000\000R\030$\204\257\042\000\000W\022`\201\243\024\000\000"
+ "v\007\376\201\343\025\000\000I\0225\205=(\000\000[\017\001\200\000\000\000"
+ "\000\313\003\261\200\000\000\000\000v\007\376\201\035\352\000\000W\022`\201"
+ "]\353\000\000\331\034Y\227\2026\000\000)3\316\235g:\000\00057\330\224h;\000"
+ "\000] \257\216f7\000\000yIC\244\2026\000\000\002N'\233f7\000\000\014N`\221"
+ ".)\000\000`N\376\224\2073\000\000B:\200\213j,\000\000P9\010\217h7\000\000"
+ "\027$\251\211\2073\000\000/&\261\206.)\000\000\204P\346\217]\351\000\000"
+ "\324:_\211\215\347\000\000\005;\250\210\000\000\000\000rR\263\217\000\000"
+ "\000\000\310$/\204]\351\000\0006#\013\203\000\000\000\000\310$/\204\243\026"
+ "\000\000\324:_\211s\030\000\000\204P\346\217\243\026\000\000VUGMAUP_<C5J"
+ "\001~\326{\274u*) /*>28\366;\374U\246\023\236\023\300.\313%\233\032\275<"
+ "\224%\246J\257\077\224\035$\027\034\032\035\376\027\377\346\000\354\037\012"
+ "\337\367\305\370\304\006\337\336\322\343\346\246\355\236\366\272\361\277"
+ "\343\233\000\275\003\271\020\236\012\352\263\357\260\336\243\351\230\322"
+ "\257\336\277\274\212\275\211\321\222\316\227\257\243\302\243\224\333\224"
+ "\343\251\307\236\302\233\346\263\316\272\330\236\355^\213^\207}\236~\230"
+ "\201e\233\236ech[\240k\213\035\2218\201\032\204<\220\307\213\343\223\011"
+ "\213\000\201\000\213\012\223\367\213\366\212\356\201\012\212\022VSHKYTJJ"
+ "\077@>AZUZWMJLJA>@\07752(%*%53+&55,)47\266\225[\202\261\237\242\212y\223"
+ "{\231\250\244\242\255\226\233\235\222\177\201z\213kbifk^j\134\001\334\354"
+ "\313\030\374\022\372\367\337\342\320#\025!\024\031\026\035\024\000\000\012"
+ "\373\346\353\324\337\335\331\357\344\304\243\322\257\311\270\276\256\336"
+ "\275\323\303\304\325\317\316\264\315\300\301\263\262\254\275\207\275\211"
+ "^\202X\217\275\230w\224w\216u\210\247\223\270_lWXXX`lXXckZYhm\206v\232\263"
+ "\215\241\227\316\221\324\235\311\244\335\236\343\227\352\243\304\253\326"
+ "\316\347\275\336\311\356\270\344\304\372\255\360\263\352\304\362\331\001"
+ "\337\010\332\371\366\015\370\023\370\027\340\364\367\005&%\022\027''\024"
+ "\034'''(\023 \023\037606060C<D;D;51B=NJOIOIOI;+,!H7o\020S\010@\377^STD~\301"
+ "w,5\2460\250L\275Q\260-\256K\314%\266/\322<\315'\261di\223ye\213v\250\212"
+ "\277\204Z\244\255\241\225\032\207!\2202\204\313\220,\227B\2220\240I\236\223"
+ "\315\232\347\265\314\256\276\302\367\264\356\324\335\303\323\006\233\010"
+ "\224\352\253\361\266\002\203\327\252\326\227\023\211\333\003\372\022\012"
+ "\346\354\340\026\033'\367\037\261\035\312\026\255\021\303\003\263\017\242"
+ "'\240!\232\033\234\042\243\033\223\023\224\022\234\031\242\037\250\000\000"
+ "\001\000\002\000\000\000\002\000\003\000\001\000\004\000\005\000\005\000"
+ "\002\000\001\000\006\000\007\000\002\000\006\000\002\000\005\000\007\000"
+ "\010\000\003\000\003\000\002\000\007\000\011\000\012\000\013\000\011\000"
+ "\013\000\014\000\012\000\015\000\016\000\016\000\013\000\012\000\006\000"
+ "\005\000\013\000\006\000\013\000\016\000\005\000\004\000\014\000\014\000"
+ "\013\000\005\000\017\000\020\000\021\000\017\000\021\000\022\000\023\000"
+ "\024\000\021\000\023\000\021\000\020\000\006\000\016\000\021\000\006\000"
+ "\021\000\024\000\016\000\015\000\022\000\022\000\021\000\016\000\025\000"
+ "\026\000\027\000\025\000\027\000\030\000\026\000\010\000\007\000\007\000"
+ "\027\000\026\000\006\000\024\000\027\000\006\000\027\000\007\000\023\000"
+ "\030\000\027\000\023\000\027\000\024\000\011\000\031\000\032\000\011\000"
+ "\032\000\012\000\031\000\033\000\034\000\034\000\032\000\031\000\035\000"
+ "\036\000\032\000\035\000\032\000\034\000\036\000\015\000\012\000\012\000"
+ "\032\000\036\000\037\000 \000!\000!\000\042\000\037\000#\000$\000\042\000"
+ "#\000\042\000!\000$\000\035\000\034\000\034\000\042\000$\000\033\000\037"
+ "\000\042\000\033\000\042\000\034\000%\000&\000'\000%\000'\000(\000)\000*"
+ "\000'\000)\000'\000&\000\035\000$\000'\000\035\000'\000*\000$\000#\000(\000"
+ "(\000'\000$\000\017\000\022\000+\000\017\000+\000,\000\022\000\015\000\036"
+ "\000\036\000+\000\022\000\036\000\035\000*\000*\000+\000\036\000)\000,\000"
+ "+\000)\000+\000*\000 \000-\000.\000 \000.\000!\000-\000/\0000\0000\000.\000"
+ "-\0001\0002\000.\0001\000.\0000\0002\000#\000!\000!\000.\0002\0003\0004\000"
+ "5\0003\0005\0006\0004\0007\0008\0008\0005\0004\0001\0000\0005\0001\0005\000"
+ "8\0000\000/\0006\0006\0005\0000\0009\000:\000;\0009\000;\000<\000=\000>\000"
+ ";\000=\000;\000:\0001\0008\000;\0001\000;\000>\0007\000<\000;\0007\000;\000"
+ "8\000%\000(\000\077\000%\000\077\000@\000#\0002\000\077\000#\000\077\000"
+ "(\0001\000>\000\077\0001\000\077\0002\000=\000@\000\077\000=\000\077\000"
+ ">\0004\0003\000A\000A\000B\0004\000C\000D\000B\000C\000B\000A\000D\000E\000"
+ "F\000F\000B\000D\0007\0004\000B\0007\000B\000F\000\000\000\003\000G\000\000"
+ "\000G\000H\000\003\000\010\000I\000I\000G\000\003\000E\000D\000G\000E\000"
+ "G\000I\000D\000C\000H\000H\000G\000D\000\025\000J\000K\000\025\000K\000\026"
+ "\000L\000M\000K\000L\000K\000J\000M\000E\000I\000I\000K\000M\000I\000\010"
+ "\000\026\000\026\000K\000I\0009\000<\000N\0009\000N\000O\000<\0007\000F\000"
+ "F\000N\000<\000E\000M\000N\000E\000N\000F\000L\000O\000N\000L\000N\000M\000"
+ "\017\000,\000P\000\017\000P\000\020\000,\000)\000Q\000Q\000P\000,\000R\000"
+ "S\000P\000R\000P\000Q\000S\000\023\000\020\000\020\000P\000S\000%\000@\000"
+ "T\000%\000T\000&\000@\000=\000U\000U\000T\000@\000R\000Q\000T\000R\000T\000"
+ "U\000Q\000)\000&\000&\000T\000Q\0009\000O\000V\0009\000V\000:\000O\000L\000"
+ "W\000W\000V\000O\000R\000U\000V\000R\000V\000W\000U\000=\000:\000:\000V\000"
+ "U\000\025\000\030\000X\000\025\000X\000J\000\030\000\023\000S\000S\000X\000"
+ "\030\000R\000W\000X\000R\000X\000S\000W\000L\000J\000J\000X\000W\000\001"
+ "\000\000\000Y\000Y\000Z\000\001\000Y\000[\000\134\000\134\000Z\000Y\000\134"
+ "\000]\000^\000^\000Z\000\134\000\004\000\001\000Z\000\004\000Z\000^\000_"
+ "\000`\000a\000a\000b\000_\000c\000d\000b\000c\000b\000a\000d\000]\000\134"
+ "\000\134\000b\000d\000[\000_\000b\000[\000b\000\134\000e\000f\000g\000g\000"
+ "h\000e\000i\000j\000h\000i\000h\000g\000j\000]\000d\000d\000h\000j\000c\000"
+ "e\000h\000c\000h\000d\000k\000\011\000\014\000\014\000l\000k\000\004\000"
+ "^\000l\000\004\000l\000\014\000^\000]\000j\000j\000l\000^\000j\000i\000k"
+ "\000k\000l\000j\0003\000m\000n\0003\000n\000A\000m\000o\000p\000p\000n\000"
+ "m\000q\000r\000n\000q\000n\000p\000r\000C\000A\000A\000n\000r\000s\000t\000"
+ "u\000u\000v\000s\000w\000x\000v\000w\000v\000u\000x\000q\000p\000p\000v\000"
+ "x\000o\000s\000v\000o\000v\000p\000`\000_\000y\000`\000y\000z\000_\000[\000"
+ "{\000{\000y\000_\000q\000x\000y\000q\000y\000{\000x\000w\000z\000z\000y\000"
+ "x\000Y\000\000\000H\000H\000|\000Y\000C\000r\000|\000C\000|\000H\000r\000"
+ "q\000{\000{\000|\000r\000[\000Y\000|\000[\000|\000{\000 \000\037\000}\000"
+ " \000}\000~\000\037\000\033\000\177\000\177\000}\000\037\000\200\000\201"
+ "\000}\000\200\000}\000\177\000\201\000\202\000~\000~\000}\000\201\000\031"
+ "\000\011\000k\000k\000\203\000\031\000i\000\204\000\203\000i\000\203\000"
+ "k\000\204\000\200\000\177\000\177\000\203\000\204\000\033\000\031\000\203"
+ "\000\033\000\203\000\177\000f\000\205\000\206\000f\000\206\000g\000\205\000"
+ "\207\000\210\000\210\000\206\000\205\000\200\000\204\000\206\000\200\000"
+ "\206\000\210\000\204\000i\000g\000g\000\206\000\204\000\211\000\212\000\213"
+ "\000\213\000\214\000\211\000\202\000\201\000\214\000\202\000\214\000\213"
+ "\000\201\000\200\000\210\000\210\000\214\000\201\000\207\000\211\000\214"
+ "\000\207\000\214\000\210\000m\0003\0006\0006\000\215\000m\000/\000\216\000"
+ "\215\000/\000\215\0006\000\216\000\217\000\220\000\220\000\215\000\216\000"
+ "o\000m\000\215\000o\000\215\000\220\000-\000 \000~\000~\000\221\000-\000"
+ "\202\000\222\000\221\000\202\000\221\000~\000\222\000\217\000\216\000\216"
+ "\000\221\000\222\000/\000-\000\221\000/\000\221\000\216\000\212\000\223\000"
+ "\224\000\212\000\224\000\213\000\223\000\225\000\226\000\226\000\224\000"
+ "\223\000\226\000\217\000\222\000\222\000\224\000\226\000\202\000\213\000"
+ "\224\000\202\000\224\000\222\000t\000s\000\227\000t\000\227\000\230\000o"
+ "\000\220\000\227\000o\000\227\000s\000\220\000\217\000\226\000\226\000\227"
+ "\000\220\000\226\000\225\000\230\000\230\000\227\000\226\000\231\000\232"
+ "\000\233\000\231\000\233\000\234\000\232\000\235\000\236\000\236\000\233"
+ "\000\232\000\237\000\240\000\233\000\237\000\233\000\236\000\241\000\234"
+ "\000\233\000\241\000\233\000\240\000\242\000\243\000\244\000\244\000\245"
+ "\000\242\000\246\000\247\000\245\000\246\000\245\000\244\000\247\000\237"
+ "\000\236\000\236\000\245\000\247\000\235\000\242\000\245\000\235\000\245"
+ "\000\236\000\250\000`\000z\000z\000\251\000\250\000w\000\252\000\251\000"
+ "w\000\251\000z\000\237\000\247\000\251\000\237\000\251\000\252\000\247\000"
+ "\246\000\250\000\250\000\251\000\247\000t\000\253\000\254\000t\000\254\000"
+ "u\000\253\000\241\000\240\000\240\000\254\000\253\000\237\000\252\000\254"
+ "\000\237\000\254\000\240\000\252\000w\000u\000u\000\254\000\252\000\231\000"
+ "\234\000\255\000\231\000\255\000\256\000\234\000\241\000\257\000\257\000"
+ "\255\000\234\000\260\000\261\000\255\000\260\000\255\000\257\000\261\000"
+ "\262\000\256\000\256\000\255\000\261\000\253\000t\000\230\000\230\000\263"
+ "\000\253\000\225\000\264\000\263\000\225\000\263\000\230\000\264\000\260"
+ "\000\257\000\257\000\263\000\264\000\263\000\257\000\241\000\241\000\253"
+ "\000\263\000\223\000\212\000\265\000\265\000\266\000\223\000\266\000\265"
+ "\000\267\000\267\000\270\000\266\000\270\000\260\000\264\000\264\000\266"
+ "\000\270\000\225\000\223\000\266\000\225\000\266\000\264\000\271\000\272"
+ "\000\273\000\271\000\273\000\274\000\272\000\262\000\261\000\261\000\273"
+ "\000\272\000\260\000\270\000\273\000\260\000\273\000\261\000\270\000\267"
+ "\000\274\000\274\000\273\000\270\000\271\000\274\000\275\000\271\000\275"
+ "\000\276\000\267\000\277\000\275\000\267\000\275\000\274\000\300\000\301"
+ "\000\275\000\300\000\275\000\277\000\301\000\302\000\276\000\276\000\275"
+ "\000\301\000\212\000\211\000\303\000\212\000\303\000\265\000\211\000\207"
+ "\000\304\000\304\000\303\000\211\000\300\000\277\000\303\000\300\000\303"
+ "\000\304\000\277\000\267\000\265\000\265\000\303\000\277\000\205\000f\000"
+ "\305\000\305\000\306\000\205\000\305\000\307\000\310\000\310\000\306\000"
+ "\305\000\300\000\304\000\306\000\300\000\306\000\310\000\207\000\205\000"
+ "\306\000\207\000\306\000\304\000\311\000\312\000\313\000\313\000\314\000"
+ "\311\000\302\000\301\000\314\000\302\000\314\000\313\000\301\000\300\000"
+ "\310\000\310\000\314\000\301\000\307\000\311\000\314\000\307\000\314\000"
+ "\310\000\315\000\312\000\311\000\311\000\316\000\315\000\307\000\317\000"
+ "\316\000\307\000\316\000\311\000\317\000\320\000\321\000\321\000\316\000"
+ "\317\000\322\000\315\000\316\000\322\000\316\000\321\000f\000e\000\323\000"
+ "f\000\323\000\305\000e\000c\000\324\000\324\000\323\000e\000\320\000\317"
+ "\000\323\000\320\000\323\000\324\000\317\000\307\000\305\000\305\000\323"
+ "\000\317\000`\000\250\000\325\000`\000\325\000a\000\250\000\246\000\326\000"
+ "\326\000\325\000\250\000\320\000\324\000\325\000\320\000\325\000\326\000"
+ "\324\000c\000a\000a\000\325\000\324\000\244\000\243\000\327\000\327\000\330"
+ "\000\244\000\322\000\321\000\330\000\322\000\330\000\327\000\321\000\320"
+ "\000\326\000\326\000\330\000\321\000\246\000\244\000\330\000\246\000\330"
+ "\000\326\000\312\000\315\000\331\000\312\000\331\000\332\000\315\000\322"
+ "\000\333\000\333\000\331\000\315\000\334\000\335\000\331\000\334\000\331"
+ "\000\333\000\335\000\336\000\332\000\332\000\331\000\335\000\243\000\337"
+ "\000\340\000\243\000\340\000\327\000\337\000\341\000\342\000\342\000\340"
+ "\000\337\000\334\000\333\000\340\000\334\000\340\000\342\000\333\000\322"
+ "\000\327\000\327\000\340\000\333\000\343\000\344\000\345\000\343\000\345"
+ "\000\346\000\347\000\350\000\345\000\347\000\345\000\344\000\334\000\342"
+ "\000\345\000\334\000\345\000\350\000\342\000\341\000\346\000\346\000\345"
+ "\000\342\000\351\000\352\000\353\000\351\000\353\000\354\000\352\000\336"
+ "\000\335\000\335\000\353\000\352\000\334\000\350\000\353\000\334\000\353"
+ "\000\335\000\347\000\354\000\353\000\347\000\353\000\350\000\243\000\242"
+ "\000\355\000\243\000\355\000\337\000\242\000\235\000\356\000\356\000\355"
+ "\000\242\000\357\000\360\000\355\000\357\000\355\000\356\000\360\000\341"
+ "\000\337\000\337\000\355\000\360\000\231\000\361\000\362\000\231\000\362"
+ "\000\232\000\363\000\364\000\362\000\363\000\362\000\361\000\364\000\357"
+ "\000\356\000\356\000\362\000\364\000\235\000\232\000\362\000\235\000\362"
+ "\000\356\000\365\000\366\000\367\000\365\000\367\000\370\000\371\000\372"
+ "\000\367\000\371\000\367\000\366\000\357\000\364\000\367\000\357\000\367"
+ "\000\372\000\364\000\363\000\370\000\370\000\367\000\364\000\373\000\343"
+ "\000\346\000\346\000\374\000\373\000\346\000\341\000\360\000\360\000\374"
+ "\000\346\000\357\000\372\000\374\000\357\000\374\000\360\000\371\000\373"
+ "\000\374\000\371\000\374\000\372\000\361\000\231\000\256\000\256\000\375"
+ "\000\361\000\256\000\262\000\376\000\376\000\375\000\256\000\376\000\377"
+ "\000\000\001\000\001\375\000\376\000\363\000\361\000\375\000\363\000\375"
+ "\000\000\001\272\000\271\000\001\001\001\001\002\001\272\000\003\001\004"
+ "\001\002\001\003\001\002\001\001\001\004\001\377\000\376\000\376\000\002"
+ "\001\004\001\376\000\262\000\272\000\272\000\002\001\376\000\005\001\006"
+ "\001\007\001\005\001\007\001\010\001\011\001\012\001\007\001\011\001\007"
+ "\001\006\001\012\001\377\000\004\001\004\001\007\001\012\001\003\001\010"
+ "\001\007\001\003\001\007\001\004\001\365\000\370\000\013\001\365\000\013"
+ "\001\014\001\363\000\000\001\013\001\363\000\013\001\370\000\000\001\377"
+ "\000\012\001\012\001\013\001\000\001\011\001\014\001\013\001\011\001\013"
+ "\001\012\001\271\000\276\000\015\001\271\000\015\001\001\001\302\000\016"
+ "\001\015\001\302\000\015\001\276\000\016\001\017\001\020\001\020\001\015"
+ "\001\016\001\003\001\001\001\015\001\003\001\015\001\020\001\312\000\332"
+ "\000\021\001\312\000\021\001\313\000\332\000\336\000\022\001\022\001\021"
+ "\001\332\000\017\001\016\001\021\001\017\001\021\001\022\001\016\001\302"
+ "\000\313\000\313\000\021\001\016\001\352\000\351\000\023\001\023\001\024"
+ "\001\352\000\025\001\026\001\024\001\025\001\024\001\023\001\017\001\022"
+ "\001\024\001\017\001\024\001\026\001\022\001\336\000\352\000\352\000\024"
+ "\001\022\001\005\001\010\001\027\001\005\001\027\001\030\001\010\001\003"
+ "\001\020\001\020\001\027\001\010\001\017\001\026\001\027\001\017\001\027"
+ "\001\020\001\025\001\030\001\027\001\025\001\027\001\026\001\343\000\373"
+ "\000\031\001\343\000\031\001\344\000\373\000\371\000\032\001\032\001\031"
+ "\001\373\000\033\001\034\001\031\001\033\001\031\001\032\001\034\001\347"
+ "\000\344\000\344\000\031\001\034\001\365\000\014\001\035\001\365\000\035"
+ "\001\366\000\014\001\011\001\036\001\036\001\035\001\014\001\033\001\032"
+ "\001\035\001\033\001\035\001\036\001\032\001\371\000\366\000\366\000\035"
+ "\001\032\001\005\001\030\001\037\001\005\001\037\001\006\001\030\001\025"
+ "\001 \001 \001\037\001\030\001\033\001\036\001\037\001\033\001\037\001 \001"
+ "\036\001\011\001\006\001\006\001\037\001\036\001\351\000\354\000!\001\351"
+ "\000!\001\023\001\354\000\347\000\034\001\034\001!\001\354\000\033\001 \001"
+ "!\001\033\001!\001\034\001 \001\025\001\023\001\023\001!\001 \001\000\000"
+ "\001\000\001\000\002\000\000\000\002\000\002\000\003\000\000\000\003\000"
+ "\001\000\004\000\004\000\005\000\001\000\005\000\002\000\005\000\006\000"
+ "\007\000\002\000\007\000\002\000\006\000\005\000\006\000\007\000\010\000"
+ "\003\000\010\000\003\000\007\000\011\000\012\000\012\000\013\000\011\000"
+ "\013\000\013\000\014\000\011\000\014\000\012\000\015\000\015\000\016\000"
+ "\012\000\016\000\013\000\016\000\005\000\013\000\006\000\013\000\006\000"
+ "\016\000\004\000\014\000\005\000\014\000\017\000\020\000\020\000\021\000"
+ "\017\000\021\000\021\000\022\000\017\000\022\000\023\000\024\000\021\000"
+ "\024\000\021\000\023\000\020\000\023\000\016\000\021\000\006\000\021\000"
+ "\006\000\024\000\015\000\022\000\016\000\022\000\025\000\026\000\026\000"
+ "\027\000\025\000\027\000\027\000\030\000\025\000\030\000\010\000\026\000"
+ "\007\000\026\000\007\000\027\000\024\000\027\000\006\000\027\000\023\000"
+ "\030\000\023\000\027\000\011\000\031\000\031\000\032\000\011\000\032\000"
+ "\012\000\032\000\031\000\033\000\033\000\034\000\031\000\034\000\032\000"
+ "\034\000\035\000\036\000\032\000\036\000\032\000\035\000\034\000\035\000"
+ "\015\000\036\000\012\000\036\000\037\000 \000 \000!\000\037\000!\000!\000"
+ "\042\000\037\000\042\000#\000$\000\042\000$\000\042\000#\000!\000#\000\035"
+ "\000$\000\034\000$\000\034\000\042\000\033\000\037\000\033\000\042\000%\000"
+ "&\000&\000'\000%\000'\000'\000(\000%\000(\000)\000*\000'\000*\000'\000)\000"
+ "&\000)\000$\000'\000\035\000'\000\035\000*\000#\000(\000$\000(\000\022\000"
+ "+\000\017\000+\000+\000,\000\017\000,\000\022\000\036\000\036\000+\000\036"
+ "\000*\000*\000+\000)\000,\000)\000+\000 \000-\000-\000.\000 \000.\000!\000"
+ ".\000-\000/\000/\0000\000-\0000\000.\0000\0001\0002\000.\0002\000.\0001\000"
+ "0\0001\000#\0002\000!\0002\0003\0004\0004\0005\0003\0005\0005\0006\0003\000"
+ "6\0004\0007\0007\0008\0004\0008\0005\0008\0000\0005\0001\0005\0001\0008\000"
+ "/\0006\0000\0006\0009\000:\000:\000;\0009\000;\000;\000<\0009\000<\000=\000"
+ ">\000;\000>\000;\000=\000:\000=\0008\000;\0001\000;\0001\000>\0007\000<\000"
+ "7\000;\000(\000\077\000%\000\077\000\077\000@\000%\000@\0002\000\077\000"
+ "#\000\077\000>\000\077\0001\000\077\000=\000@\000=\000\077\0003\000A\000"
+ "4\000A\000A\000B\0004\000B\000C\000D\000B\000D\000B\000C\000A\000C\000D\000"
+ "E\000E\000F\000D\000F\000B\000F\0007\000B\0007\000F\000\003\000G\000\000"
+ "\000G\000G\000H\000\000\000H\000\010\000I\000\003\000I\000G\000I\000D\000"
+ "G\000E\000G\000E\000I\000C\000H\000D\000H\000\025\000J\000J\000K\000\025"
+ "\000K\000\026\000K\000L\000M\000K\000M\000K\000L\000J\000L\000E\000M\000"
+ "I\000M\000I\000K\000\026\000I\000<\000N\0009\000N\000N\000O\0009\000O\000"
+ "<\000F\000F\000N\000M\000N\000E\000N\000L\000O\000L\000N\000,\000P\000\017"
+ "\000P\000\020\000P\000)\000Q\000,\000Q\000P\000Q\000R\000S\000P\000S\000"
+ "P\000R\000Q\000R\000\023\000S\000\020\000S\000@\000T\000%\000T\000&\000T"
+ "\000=\000U\000@\000U\000T\000U\000Q\000T\000R\000T\000R\000U\000&\000Q\000"
+ "O\000V\0009\000V\000:\000V\000L\000W\000O\000W\000V\000W\000U\000V\000R\000"
+ "V\000R\000W\000:\000U\000\030\000X\000\025\000X\000J\000X\000\030\000S\000"
+ "S\000X\000W\000X\000R\000X\000J\000W\000\000\000Y\000\001\000Y\000Y\000Z"
+ "\000\001\000Z\000Y\000[\000[\000\134\000Y\000\134\000Z\000\134\000\134\000"
+ "]\000]\000^\000\134\000^\000Z\000^\000\004\000Z\000\004\000^\000_\000`\000"
+ "`\000a\000_\000a\000a\000b\000_\000b\000c\000d\000b\000d\000b\000c\000a\000"
+ "c\000]\000d\000\134\000d\000\134\000b\000[\000_\000[\000b\000e\000f\000f"
+ "\000g\000e\000g\000g\000h\000e\000h\000i\000j\000h\000j\000h\000i\000g\000"
+ "i\000]\000j\000d\000j\000d\000h\000c\000e\000c\000h\000\011\000k\000\014"
+ "\000k\000\014\000l\000k\000l\000^\000l\000\004\000l\000^\000j\000j\000l\000"
+ "i\000k\000j\000k\0003\000m\000m\000n\0003\000n\000A\000n\000m\000o\000o\000"
+ "p\000m\000p\000n\000p\000q\000r\000n\000r\000n\000q\000p\000q\000C\000r\000"
+ "A\000r\000s\000t\000t\000u\000s\000u\000u\000v\000s\000v\000w\000x\000v\000"
+ "x\000v\000w\000u\000w\000q\000x\000p\000x\000p\000v\000o\000s\000o\000v\000"
+ "_\000y\000`\000y\000y\000z\000`\000z\000[\000{\000_\000{\000y\000{\000x\000"
+ "y\000q\000y\000q\000{\000w\000z\000x\000z\000H\000Y\000H\000|\000Y\000|\000"
+ "r\000|\000C\000|\000r\000{\000{\000|\000[\000|\000\037\000}\000 \000}\000"
+ "}\000~\000 \000~\000\033\000\177\000\037\000\177\000}\000\177\000\200\000"
+ "\201\000}\000\201\000}\000\200\000\177\000\200\000\201\000\202\000~\000\202"
+ "\000~\000\201\000\031\000k\000k\000\203\000\031\000\203\000i\000\204\000"
+ "\203\000\204\000i\000\203\000\200\000\204\000\177\000\204\000\177\000\203"
+ "\000\033\000\203\000f\000\205\000\205\000\206\000f\000\206\000g\000\206\000"
+ "\205\000\207\000\207\000\210\000\205\000\210\000\206\000\210\000\204\000"
+ "\206\000\200\000\206\000\200\000\210\000g\000\204\000\211\000\212\000\212"
+ "\000\213\000\211\000\213\000\213\000\214\000\211\000\214\000\201\000\214"
+ "\000\202\000\214\000\202\000\213\000\201\000\210\000\210\000\214\000\207"
+ "\000\211\000\207\000\214\0006\000m\0006\000\215\000m\000\215\000/\000\216"
+ "\000\215\000\216\000/\000\215\000\216\000\217\000\217\000\220\000\216\000"
+ "\220\000\215\000\220\000o\000\215\000o\000\220\000-\000~\000~\000\221\000"
+ "-\000\221\000\202\000\222\000\221\000\222\000\202\000\221\000\217\000\222"
+ "\000\216\000\222\000\216\000\221\000/\000\221\000\212\000\223\000\223\000"
+ "\224\000\212\000\224\000\213\000\224\000\223\000\225\000\225\000\226\000"
+ "\223\000\226\000\224\000\226\000\217\000\226\000\222\000\226\000\222\000"
+ "\224\000\202\000\224\000s\000\227\000t\000\227\000\227\000\230\000t\000\230"
+ "\000\220\000\227\000o\000\227\000\220\000\226\000\226\000\227\000\225\000"
+ "\230\000\226\000\230\000\231\000\232\000\232\000\233\000\231\000\233\000"
+ "\233\000\234\000\231\000\234\000\232\000\235\000\235\000\236\000\232\000"
+ "\236\000\233\000\236\000\237\000\240\000\233\000\240\000\233\000\237\000"
+ "\236\000\237\000\234\000\241\000\233\000\241\000\240\000\241\000\242\000"
+ "\243\000\243\000\244\000\242\000\244\000\244\000\245\000\242\000\245\000"
+ "\246\000\247\000\245\000\247\000\245\000\246\000\244\000\246\000\237\000"
+ "\247\000\236\000\247\000\236\000\245\000\235\000\242\000\235\000\245\000"
+ "`\000\250\000z\000\250\000z\000\251\000\250\000\251\000w\000\252\000\251"
+ "\000\252\000w\000\251\000\247\000\251\000\237\000\251\000\237\000\252\000"
+ "\246\000\250\000\247\000\250\000t\000\253\000\253\000\254\000t\000\254\000"
+ "u\000\254\000\241\000\253\000\240\000\253\000\240\000\254\000\252\000\254"
+ "\000\237\000\254\000u\000\252\000\234\000\255\000\231\000\255\000\255\000"
+ "\256\000\231\000\256\000\241\000\257\000\234\000\257\000\255\000\257\000"
+ "\260\000\261\000\255\000\261\000\255\000\260\000\257\000\260\000\261\000"
+ "\262\000\256\000\262\000\256\000\261\000\230\000\253\000\230\000\263\000"
+ "\253\000\263\000\225\000\264\000\263\000\264\000\225\000\263\000\260\000"
+ "\264\000\257\000\264\000\257\000\263\000\241\000\263\000\212\000\265\000"
+ "\223\000\265\000\265\000\266\000\223\000\266\000\265\000\267\000\266\000"
+ "\267\000\267\000\270\000\266\000\270\000\260\000\270\000\264\000\270\000"
+ "\264\000\266\000\225\000\266\000\271\000\272\000\272\000\273\000\271\000"
+ "\273\000\273\000\274\000\271\000\274\000\262\000\272\000\261\000\272\000"
+ "\261\000\273\000\270\000\273\000\260\000\273\000\267\000\274\000\270\000"
+ "\274\000\274\000\275\000\271\000\275\000\275\000\276\000\271\000\276\000"
+ "\267\000\277\000\275\000\277\000\267\000\275\000\300\000\301\000\275\000"
+ "\301\000\275\000\300\000\277\000\300\000\301\000\302\000\276\000\302\000"
+ "\276\000\301\000\211\000\303\000\212\000\303\000\265\000\303\000\207\000"
+ "\304\000\211\000\304\000\303\000\304\000\277\000\303\000\300\000\303\000"
+ "\300\000\304\000\265\000\277\000f\000\305\000\205\000\305\000\305\000\306"
+ "\000\205\000\306\000\305\000\307\000\307\000\310\000\305\000\310\000\306"
+ "\000\310\000\304\000\306\000\300\000\306\000\300\000\310\000\207\000\306"
+ "\000\311\000\312\000\312\000\313\000\311\000\313\000\313\000\314\000\311"
+ "\000\314\000\301\000\314\000\302\000\314\000\302\000\313\000\301\000\310"
+ "\000\310\000\314\000\307\000\311\000\307\000\314\000\312\000\315\000\311"
+ "\000\315\000\311\000\316\000\315\000\316\000\307\000\317\000\316\000\317"
+ "\000\307\000\316\000\317\000\320\000\320\000\321\000\317\000\321\000\316"
+ "\000\321\000\315\000\322\000\316\000\322\000\321\000\322\000e\000\323\000"
+ "f\000\323\000\305\000\323\000c\000\324\000e\000\324\000\323\000\324\000\317"
+ "\000\323\000\320\000\323\000\320\000\324\000\305\000\317\000\250\000\325"
+ "\000`\000\325\000a\000\325\000\246\000\326\000\250\000\326\000\325\000\326"
+ "\000\324\000\325\000\320\000\325\000\320\000\326\000a\000\324\000\243\000"
+ "\327\000\244\000\327\000\327\000\330\000\244\000\330\000\321\000\330\000"
+ "\322\000\330\000\322\000\327\000\321\000\326\000\326\000\330\000\246\000"
+ "\330\000\315\000\331\000\312\000\331\000\331\000\332\000\312\000\332\000"
+ "\322\000\333\000\315\000\333\000\331\000\333\000\334\000\335\000\331\000"
+ "\335\000\331\000\334\000\333\000\334\000\335\000\336\000\332\000\336\000"
+ "\332\000\335\000\243\000\337\000\337\000\340\000\243\000\340\000\327\000"
+ "\340\000\337\000\341\000\341\000\342\000\337\000\342\000\340\000\342\000"
+ "\333\000\340\000\334\000\340\000\334\000\342\000\327\000\333\000\343\000"
+ "\344\000\344\000\345\000\343\000\345\000\345\000\346\000\343\000\346\000"
+ "\347\000\350\000\345\000\350\000\345\000\347\000\344\000\347\000\342\000"
+ "\345\000\334\000\345\000\334\000\350\000\341\000\346\000\342\000\346\000"
+ "\351\000\352\000\352\000\353\000\351\000\353\000\353\000\354\000\351\000"
+ "\354\000\336\000\352\000\335\000\352\000\335\000\353\000\350\000\353\000"
+ "\334\000\353\000\347\000\354\000\347\000\353\000\242\000\355\000\243\000"
+ "\355\000\337\000\355\000\235\000\356\000\242\000\356\000\355\000\356\000"
+ "\357\000\360\000\355\000\360\000\355\000\357\000\356\000\357\000\341\000"
+ "\360\000\337\000\360\000\231\000\361\000\361\000\362\000\231\000\362\000"
+ "\232\000\362\000\363\000\364\000\362\000\364\000\362\000\363\000\361\000"
+ "\363\000\357\000\364\000\356\000\364\000\356\000\362\000\235\000\362\000"
+ "\365\000\366\000\366\000\367\000\365\000\367\000\367\000\370\000\365\000"
+ "\370\000\371\000\372\000\367\000\372\000\367\000\371\000\366\000\371\000"
+ "\364\000\367\000\357\000\367\000\357\000\372\000\363\000\370\000\364\000"
+ "\370\000\343\000\373\000\346\000\373\000\346\000\374\000\373\000\374\000"
+ "\346\000\360\000\360\000\374\000\372\000\374\000\357\000\374\000\371\000"
+ "\373\000\371\000\374\000\256\000\361\000\256\000\375\000\361\000\375\000"
+ "\262\000\376\000\256\000\376\000\375\000\376\000\376\000\377\000\377\000"
+ "\000\001\376\000\000\001\375\000\000\001\363\000\375\000\363\000\000\001"
+ "\271\000\001\001\272\000\001\001\001\001\002\001\272\000\002\001\003\001"
+ "\004\001\002\001\004\001\002\001\003\001\001\001\003\001\377\000\004\001"
+ "\376\000\004\001\376\000\002\001\272\000\376\000\005\001\006\001\006\001"
+ "\007\001\005\001\007\001\007\001\010\001\005\001\010\001\011\001\012\001"
+ "\007\001\012\001\007\001\011\001\006\001\011\001\377\000\012\001\004\001"
+ "\012\001\004\001\007\001\003\001\010\001\003\001\007\001\370\000\013\001"
+ "\365\000\013\001\013\001\014\001\365\000\014\001\000\001\013\001\363\000"
+ "\013\001\000\001\012\001\012\001\013\001\011\001\014\001\011\001\013\001"
+ "\276\000\015\001\271\000\015\001\001\001\015\001\302\000\016\001\015\001"
+ "\016\001\302\000\015\001\016\001\017\001\017\001\020\001\016\001\020\001"
+ "\015\001\020\001\003\001\015\001\003\001\020\001\332\000\021\001\312\000"
+ "\021\001\313\000\021\001\336\000\022\001\332\000\022\001\021\001\022\001"
+ "\016\001\021\001\017\001\021\001\017\001\022\001\313\000\016\001\351\000"
+ "\023\001\352\000\023\001\023\001\024\001\352\000\024\001\025\001\026\001"
+ "\024\001\026\001\024\001\025\001\023\001\025\001\022\001\024\001\017\001"
+ "\024\001\017\001\026\001\352\000\022\001\010\001\027\001\005\001\027\001"
+ "\027\001\030\001\005\001\030\001\010\001\020\001\020\001\027\001\026\001"
+ "\027\001\017\001\027\001\025\001\030\001\025\001\027\001\373\000\031\001"
+ "\343\000\031\001\344\000\031\001\371\000\032\001\373\000\032\001\031\001"
+ "\032\001\033\001\034\001\031\001\034\001\031\001\033\001\032\001\033\001"
+ "\347\000\034\001\344\000\034\001\014\001\035\001\365\000\035\001\366\000"
+ "\035\001\011\001\036\001\014\001\036\001\035\001\036\001\032\001\035\001"
+ "\033\001\035\001\033\001\036\001\366\000\032\001\030\001\037\001\005\001"
+ "\037\001\006\001\037\001\025\001 \001\030\001 \001\037\001 \001\036\001\037"
+ "\001\033\001\037\001\033\001 \001\006\001\036\001\354\000!\001\351\000!\001"
+ "\023\001!\001\354\000\034\001\034\001!\001 \001!\001\033\001!\001\023\001"
+ " \001"
+;
+const unsigned long s1_5_size = 9892;
@@ -1,1733 +1,481 @@
+/* Generated from "s1_6.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	0.478093,0.57114,-0.667253,1.416649,0.522728,-0.673866,
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.478093,0.57114,-0.667253,1.416649,0.522728,-0.673866,
-	0.888327,0.330007,-0.319329,1.470529,0.515074,-0.593594,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.478094,0.57114,0.667253,1.416649,0.522728,-0.326134,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.478094,0.57114,0.667253,1.416649,0.522728,-0.326134,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.888327,0.330007,0.319329,1.470529,0.515074,-0.406406,
-	0.923004,0.384789,0,1.481548,0.525864,-0.5,
-	-0.553505,0.813265,0.179534,1.370035,0.524394,-0.361333,
-	-0.571934,0.814147,0.100277,1.384841,0.546182,-0.4175,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	-0.553505,0.813265,0.179534,1.370035,0.524394,-0.361333,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.070011,0.997546,0,1.433279,0.578472,-0.5,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	-0.571934,0.814147,0.100277,1.384841,0.546182,-0.4175,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	-0.070011,0.997546,0,1.433279,0.578472,-0.5,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	0.478094,0.57114,0.667253,1.416649,0.522728,-0.326134,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.169784,0.964201,0.20369,1.423386,0.566478,-0.4125,
-	0.590668,0.729279,0.345345,1.449724,0.55695,-0.405226,
-	-0.553505,0.813265,-0.179534,1.370035,0.524394,-0.638667,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	-0.553505,0.813265,-0.179534,1.370035,0.524394,-0.638667,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	-0.571934,0.814147,-0.100277,1.384841,0.546182,-0.5825,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	0.478093,0.57114,-0.667253,1.416649,0.522728,-0.673866,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	-0.070011,0.997546,0,1.433279,0.578472,-0.5,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	0.551211,0.834366,0,1.460683,0.568581,-0.5,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	0.590668,0.729279,-0.345345,1.449724,0.55695,-0.594774,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.571934,0.814147,-0.100277,1.384841,0.546182,-0.5825,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.169784,0.964201,-0.203689,1.423386,0.566478,-0.5875,
-	-0.070011,0.997546,0,1.433279,0.578472,-0.5,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	0.478094,0.57114,0.667253,1.416649,0.522728,-0.326134,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.710152,0.225044,0.667112,1.437472,0.482703,-0.32841,
-	0.413326,0.054801,0.908933,1.382377,0.428753,-0.281613,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	-0.19339,-0.303475,0.933008,1.25015,0.299272,-0.281613,
-	0.112951,-0.120534,0.986262,1.316263,0.364012,-0.266014,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.850149,0.280677,0.445496,1.169407,0.301726,-0.339125,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.702693,0.678582,0.21389,1.26889,0.429299,-0.322437,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.850149,0.280677,0.445496,1.169407,0.301726,-0.339125,
-	-0.850149,0.280677,0.445496,1.169407,0.301726,-0.339125,
-	-0.723455,0.416599,0.550508,1.219504,0.355352,-0.294,
-	-0.461199,-0.002494,0.887293,1.22904,0.331527,-0.278403,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.553505,0.813265,0.179534,1.370035,0.524394,-0.361333,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.382645,0.670188,0.635949,1.341069,0.481236,-0.294,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	0.478094,0.57114,0.667253,1.416649,0.522728,-0.326134,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	-0.382645,0.670188,0.635949,1.341069,0.481236,-0.294,
-	-0.216141,0.855174,0.471127,1.392914,0.533174,-0.339125,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.382645,0.670188,0.635949,1.341069,0.481236,-0.294,
-	-0.191431,0.222135,0.956039,1.294932,0.399266,-0.262379,
-	-0.382645,0.670188,0.635949,1.341069,0.481236,-0.294,
-	0.141626,0.422273,0.895336,1.36126,0.466583,-0.278403,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.702693,0.678582,0.21389,1.26889,0.429299,-0.322437,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.382645,0.670188,0.635949,1.341069,0.481236,-0.294,
-	-0.617508,0.597059,0.512059,1.279412,0.419138,-0.2785,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.856012,-0.369954,0.361078,1.140576,0.24116,-0.405226,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.856012,-0.369954,0.361078,1.140576,0.24116,-0.405226,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.508694,-0.497612,0.702576,1.195055,0.245321,-0.32841,
-	-0.707587,-0.61874,0.341293,1.161998,0.212951,-0.406406,
-	-0.856012,-0.369954,0.361078,1.140576,0.24116,-0.405226,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.856012,-0.369954,-0.361078,1.140576,0.24116,-0.594774,
-	-0.856012,-0.369954,-0.361078,1.140576,0.24116,-0.594774,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.856012,-0.369954,-0.361078,1.140576,0.24116,-0.594774,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.707587,-0.61874,-0.341293,1.161998,0.212951,-0.593594,
-	-0.749482,-0.662025,0,1.150979,0.202161,-0.5,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.833612,0.543172,-0.100277,1.156124,0.30934,-0.5825,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.850149,0.280677,-0.445496,1.169407,0.301726,-0.660875,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.986597,0.163178,0,1.125545,0.259804,-0.5,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.833612,0.543172,-0.100277,1.156124,0.30934,-0.5825,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.856012,-0.369954,-0.361078,1.140576,0.24116,-0.594774,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.986597,0.163178,0,1.125545,0.259804,-0.5,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.850149,0.280677,-0.445496,1.169407,0.301726,-0.660875,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.955913,0.208955,-0.20632,1.137187,0.27011,-0.5875,
-	-0.856012,-0.369954,-0.361078,1.140576,0.24116,-0.594774,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.850149,0.280677,0.445496,1.169407,0.301726,-0.339125,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.833612,0.543172,0.100277,1.156124,0.30934,-0.4175,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.856012,-0.369954,0.361078,1.140576,0.24116,-0.405226,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.73056,-0.181076,0.658402,1.174088,0.27496,-0.326134,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.850149,0.280677,0.445496,1.169407,0.301726,-0.339125,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.986597,0.163178,0,1.125545,0.259804,-0.5,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.92836,-0.371683,0,1.12918,0.229952,-0.5,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.856012,-0.369954,0.361078,1.140576,0.24116,-0.405226,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.833612,0.543172,0.100277,1.156124,0.30934,-0.4175,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.955913,0.208955,0.20632,1.137187,0.27011,-0.4125,
-	-0.986597,0.163178,0,1.125545,0.259804,-0.5,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.508694,-0.497611,-0.702576,1.195055,0.245321,-0.67159,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.193391,-0.303475,-0.933008,1.25015,0.299272,-0.718387,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	0.478093,0.57114,-0.667253,1.416649,0.522728,-0.673866,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	0.710152,0.225044,-0.667113,1.437472,0.482703,-0.67159,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.413326,0.054801,-0.908933,1.382377,0.428753,-0.718387,
-	0.112951,-0.120534,-0.986262,1.316263,0.364012,-0.733986,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	-0.553505,0.813265,-0.179534,1.370035,0.524394,-0.638667,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.382645,0.670188,-0.635948,1.341069,0.481236,-0.706,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.702693,0.678582,-0.21389,1.26889,0.429299,-0.677562,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	-0.382645,0.670188,-0.635948,1.341069,0.481236,-0.706,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	-0.382645,0.670188,-0.635948,1.341069,0.481236,-0.706,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	-0.382645,0.670188,-0.635948,1.341069,0.481236,-0.706,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	0.478093,0.57114,-0.667253,1.416649,0.522728,-0.673866,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	-0.216141,0.855174,-0.471127,1.392914,0.533174,-0.660875,
-	-0.382645,0.670188,-0.635948,1.341069,0.481236,-0.706,
-	0.141625,0.422274,-0.895336,1.36126,0.466583,-0.721597,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.850149,0.280677,-0.445496,1.169407,0.301726,-0.660875,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.850149,0.280677,-0.445496,1.169407,0.301726,-0.660875,
-	-0.73056,-0.181076,-0.658402,1.174088,0.27496,-0.673866,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.850149,0.280677,-0.445496,1.169407,0.301726,-0.660875,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.191432,0.222135,-0.956039,1.294932,0.399266,-0.737621,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.461199,-0.002494,-0.887293,1.22904,0.331527,-0.721597,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	-0.702693,0.678582,-0.21389,1.26889,0.429299,-0.677562,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.723455,0.416599,-0.550508,1.219504,0.355352,-0.706,
-	-0.617508,0.597059,-0.512058,1.279412,0.419138,-0.7215,
-	-0.553505,0.813265,0.179534,1.370035,0.524394,-0.361333,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.553505,0.813265,0.179534,1.370035,0.524394,-0.361333,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.571934,0.814147,0.100277,1.384841,0.546182,-0.4175,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.702693,0.678582,0.21389,1.26889,0.429299,-0.322437,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.623755,0.751092,0.216309,1.327792,0.487107,-0.335375,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.571934,0.814147,0.100277,1.384841,0.546182,-0.4175,
-	-0.571934,0.814147,0.100277,1.384841,0.546182,-0.4175,
-	-0.65936,0.747587,0.079739,1.327417,0.49859,-0.4095,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.833612,0.543172,0.100277,1.156124,0.30934,-0.4175,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.828633,0.523102,0.199328,1.177383,0.324897,-0.361333,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.833612,0.543172,0.100277,1.156124,0.30934,-0.4175,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.833612,0.543172,0.100277,1.156124,0.30934,-0.4175,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.702693,0.678582,0.21389,1.26889,0.429299,-0.322437,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.766049,0.607525,0.209958,1.213173,0.368416,-0.335375,
-	-0.770142,0.632868,0.079739,1.201684,0.368389,-0.4095,
-	-0.716739,0.692147,0.08496,1.262552,0.435419,-0.40225,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.828633,0.523102,-0.199328,1.177383,0.324897,-0.638667,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.833612,0.543172,-0.100277,1.156124,0.30934,-0.5825,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.702693,0.678582,-0.21389,1.26889,0.429299,-0.677562,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.766049,0.607525,-0.209958,1.213173,0.368416,-0.664625,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.867381,0.497645,0,1.145545,0.301571,-0.5,
-	-0.833612,0.543172,-0.100277,1.156124,0.30934,-0.5825,
-	-0.833612,0.543172,-0.100277,1.156124,0.30934,-0.5825,
-	-0.770142,0.632868,-0.079739,1.201684,0.368389,-0.5905,
-	-0.775757,0.631031,0,1.19465,0.365104,-0.5,
-	-0.553505,0.813265,-0.179534,1.370035,0.524394,-0.638667,
-	-0.571934,0.814147,-0.100277,1.384841,0.546182,-0.5825,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.553505,0.813265,-0.179534,1.370035,0.524394,-0.638667,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.571934,0.814147,-0.100277,1.384841,0.546182,-0.5825,
-	-0.527613,0.849485,0,1.392236,0.557026,-0.5,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.571934,0.814147,-0.100277,1.384841,0.546182,-0.5825,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.71934,0.694658,0,1.260429,0.437469,-0.5,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.65772,0.753262,0,1.330455,0.505735,-0.5,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	-0.702693,0.678582,-0.21389,1.26889,0.429299,-0.677562,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.623755,0.751092,-0.216309,1.327792,0.487107,-0.664625,
-	-0.65936,0.747587,-0.079739,1.327417,0.49859,-0.5905,
-	-0.716739,0.692147,-0.08496,1.262552,0.435419,-0.59775,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.922813,0.236109,-0.304415,1.492239,0.440457,-0.587736,
-	0.924767,0.224636,-0.307154,1.521298,0.332708,-0.580972,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.924112,0.20782,-0.320669,1.588828,0.061527,-0.569694,
-	0.924854,0.216174,-0.312912,1.554547,0.202755,-0.574544,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.924112,0.20782,0.320669,1.588828,0.061527,-0.430306,
-	0.973545,0.228495,0,1.599013,0.064899,-0.5,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.964484,0.264141,0,1.502855,0.449898,-0.5,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.922813,0.236109,0.304415,1.492239,0.440457,-0.412264,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.97102,0.238998,0,1.564666,0.208184,-0.5,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.968395,0.249424,0,1.531587,0.340261,-0.5,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.924767,0.224636,0.307154,1.521298,0.332708,-0.419028,
-	0.924854,0.216174,0.312912,1.554547,0.202755,-0.425456,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	-0.17234,-0.336344,-0.925836,1.279939,0.25163,-0.704717,
-	-0.232261,-0.293469,-0.927325,1.315513,0.181646,-0.688934,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.032665,-0.015822,-0.999341,1.473124,-0.103652,-0.669158,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	-0.032665,-0.015822,-0.999341,1.473124,-0.103652,-0.669158,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.331282,-0.167258,-0.928589,1.385142,-0.005911,-0.662619,
-	-0.287334,-0.241218,-0.926959,1.352154,0.09418,-0.673936,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.721766,0.139046,-0.678027,1.558275,0.051411,-0.627772,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	-0.032665,-0.015822,-0.999341,1.473124,-0.103652,-0.669158,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	0.376201,0.032359,-0.925973,1.507354,0.034552,-0.662619,
-	0.024003,-0.070986,-0.997189,1.446248,0.01432,-0.674234,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.751095,0.142007,-0.644741,1.460394,0.412133,-0.660849,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.144715,-0.16618,-0.975419,1.343629,0.308278,-0.71934,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.45328,-0.007609,-0.891335,1.407319,0.364926,-0.704717,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	0.061121,-0.115002,-0.991483,1.412872,0.126752,-0.68636,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.103365,-0.143519,-0.984235,1.377249,0.226965,-0.70243,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.74475,0.138417,-0.652831,1.49043,0.310049,-0.648448,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.734405,0.137212,-0.664697,1.524188,0.186469,-0.636664,
-	0.430582,0.000669,-0.902551,1.438984,0.272283,-0.688934,
-	0.403594,0.012135,-0.914858,1.47359,0.159325,-0.673936,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	-0.17234,-0.336344,0.925836,1.279939,0.25163,-0.295283,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.232261,-0.293468,0.927325,1.315513,0.181646,-0.311066,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	0.751095,0.142007,0.644741,1.460394,0.412133,-0.339151,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.74475,0.138417,0.652831,1.49043,0.310049,-0.351552,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	0.45328,-0.00761,0.891335,1.407319,0.364926,-0.295283,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.144715,-0.16618,0.975419,1.343629,0.308278,-0.28066,
-	0.430582,0.000669,0.902551,1.438984,0.272283,-0.311066,
-	0.103365,-0.143519,0.984235,1.377249,0.226965,-0.29757,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	-0.032665,-0.015822,0.999341,1.473124,-0.103652,-0.330842,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	0.734405,0.137212,0.664697,1.524188,0.186469,-0.363336,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.721766,0.139046,0.678027,1.558275,0.051411,-0.372228,
-	0.376201,0.032359,0.925973,1.507354,0.034552,-0.337381,
-	0.403594,0.012135,0.914858,1.47359,0.159325,-0.326064,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	0.061121,-0.115002,0.991483,1.412872,0.126752,-0.31364,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	-0.287334,-0.241218,0.926959,1.352154,0.09418,-0.326064,
-	-0.032665,-0.015822,0.999341,1.473124,-0.103652,-0.330842,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	-0.032665,-0.015822,0.999341,1.473124,-0.103652,-0.330842,
-	-0.331282,-0.167257,0.928589,1.385142,-0.005911,-0.337381,
-	0.024003,-0.070986,0.997189,1.446248,0.01432,-0.325766,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	-0.503423,-0.512227,-0.695836,1.226863,0.204423,-0.660849,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.715537,-0.612433,-0.336055,1.195018,0.176099,-0.587736,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.575759,-0.440808,-0.688615,1.264067,0.143881,-0.648448,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.788495,-0.519776,-0.328798,1.2332,0.121222,-0.580972,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.503423,-0.512227,0.695837,1.226863,0.204423,-0.339151,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.575759,-0.440808,0.688615,1.264067,0.143881,-0.351552,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.715537,-0.612433,0.336055,1.195018,0.176099,-0.412264,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.784292,-0.620391,0,1.184403,0.166658,-0.5,
-	-0.788495,-0.519776,0.328798,1.2332,0.121222,-0.419028,
-	-0.853449,-0.521176,0,1.222911,0.113669,-0.5,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.637408,-0.358226,0.682191,1.301556,0.067036,-0.363336,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.686016,-0.251158,0.682863,1.33422,-0.022771,-0.372228,
-	-0.899929,-0.290508,0.325166,1.303667,-0.032887,-0.430306,
-	-0.849326,-0.416862,0.323838,1.271198,0.05075,-0.425456,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.637408,-0.358226,-0.682191,1.301556,0.067036,-0.636664,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.686016,-0.251158,-0.682863,1.33422,-0.022771,-0.627772,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.912287,-0.409552,0,1.261078,0.045321,-0.5,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.849326,-0.416862,-0.323838,1.271198,0.05075,-0.574544,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.899929,-0.290508,-0.325166,1.303667,-0.032887,-0.569694,
-	-0.961859,-0.273547,0,1.293483,-0.036258,-0.5,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.340683,0.181594,-0.922474,1.419028,-0.429344,-0.688934,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	0.339336,0.190036,-0.92127,1.580972,-0.429344,-0.688934,
-	-0.000776,0.175432,-0.984491,1.5,-0.429344,-0.70243,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	-0.032665,-0.015822,-0.999341,1.473124,-0.103652,-0.669158,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	0.294772,0.058288,-0.953788,1.536493,-0.093537,-0.657881,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.345572,0.118142,-0.930926,1.557226,-0.21644,-0.662619,
-	0.341595,0.155693,-0.926862,1.571427,-0.329821,-0.673936,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.003469,0.126882,-0.991912,1.497312,-0.330832,-0.68636,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.347569,0.124206,-0.929392,1.423198,-0.331844,-0.673936,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	-0.032665,-0.015822,-0.999341,1.473124,-0.103652,-0.669158,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	-0.355153,-0.061801,-0.932763,1.409755,-0.113768,-0.657881,
-	-0.356256,0.046266,-0.933242,1.421273,-0.224532,-0.662619,
-	-0.00536,0.065692,-0.997826,1.489249,-0.220486,-0.674234,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.693871,0.192788,-0.693812,1.351552,-0.429344,-0.648448,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.923459,0.178536,-0.339629,1.311066,-0.429344,-0.580972,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.71415,-0.110296,-0.691249,1.356947,-0.122198,-0.624049,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.999919,0.012734,0,1.319309,-0.230602,-0.5,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.933801,-0.132296,-0.332437,1.325262,-0.127256,-0.567663,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.999919,0.012734,0,1.319309,-0.230602,-0.5,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.702754,0.131399,-0.699193,1.361436,-0.332687,-0.636664,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.739331,0.03305,-0.672531,1.364627,-0.227904,-0.627772,
-	-0.960211,0.01432,-0.27891,1.330638,-0.229927,-0.569694,
-	-0.933761,0.111444,-0.340103,1.324378,-0.333193,-0.574544,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.999919,0.012734,0,1.319309,-0.230602,-0.5,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.933801,-0.132296,0.332437,1.325262,-0.127256,-0.432337,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.994338,-0.106266,0,1.314701,-0.128942,-0.5,
-	-0.960211,0.01432,0.27891,1.330638,-0.229927,-0.430306,
-	-0.999919,0.012734,0,1.319309,-0.230602,-0.5,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.995379,0.096022,0,1.312026,-0.333361,-0.5,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.985978,0.166878,0,1.29757,-0.429344,-0.5,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.923459,0.178536,0.339629,1.311066,-0.429344,-0.419028,
-	-0.933761,0.111444,0.340103,1.324378,-0.333193,-0.425456,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	-0.693871,0.192788,0.693812,1.351552,-0.429344,-0.351552,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	-0.340683,0.181594,0.922474,1.419028,-0.429344,-0.311066,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.714149,-0.110296,0.691249,1.356947,-0.122198,-0.375951,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.032665,-0.015822,0.999341,1.473124,-0.103652,-0.330842,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.355153,-0.061801,0.932763,1.409755,-0.113768,-0.342119,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	-0.702754,0.131399,0.699193,1.361436,-0.332687,-0.363336,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.739331,0.03305,0.672531,1.364627,-0.227904,-0.372228,
-	-0.356256,0.046266,0.933242,1.421273,-0.224532,-0.337381,
-	-0.347569,0.124206,0.929392,1.423198,-0.331844,-0.326064,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	-0.032665,-0.015822,0.999341,1.473124,-0.103652,-0.330842,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	0.294772,0.058287,0.953788,1.536493,-0.093537,-0.342119,
-	0.345572,0.118142,0.930926,1.557226,-0.21644,-0.337381,
-	-0.005359,0.065692,0.997826,1.489249,-0.220486,-0.325766,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	-0.003469,0.126882,0.991912,1.497312,-0.330832,-0.31364,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	-0.000776,0.175432,0.984491,1.5,-0.429344,-0.29757,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.339336,0.190036,0.921269,1.580972,-0.429344,-0.311066,
-	0.341595,0.155693,0.926862,1.571427,-0.329821,-0.326064,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.692333,0.202929,0.692456,1.648448,-0.429344,-0.351552,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.919751,0.19868,0.338503,1.688934,-0.429344,-0.419028,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.68395,0.1429,0.715397,1.589301,-0.085107,-0.375951,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.923419,0.19798,0.328787,1.620986,-0.080049,-0.432337,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.695529,0.18142,0.695217,1.633189,-0.328978,-0.363336,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	0.699329,0.164944,0.695509,1.613873,-0.213068,-0.372228,
-	0.922767,0.190694,0.334869,1.647861,-0.211045,-0.430306,
-	0.921783,0.189963,0.337979,1.670246,-0.328472,-0.425456,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.68395,0.1429,-0.715397,1.589301,-0.085107,-0.624049,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.699329,0.164944,-0.695509,1.613873,-0.213068,-0.627772,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.976556,0.215262,0,1.631547,-0.078363,-0.5,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.923419,0.19798,-0.328787,1.620986,-0.080049,-0.567663,
-	0.922767,0.190694,-0.334869,1.647861,-0.211045,-0.569694,
-	0.979589,0.201011,0,1.65919,-0.21037,-0.5,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.981065,0.19368,0,1.682599,-0.328303,-0.5,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.980577,0.196136,0,1.70243,-0.429344,-0.5,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.692333,0.202928,-0.692456,1.648448,-0.429344,-0.648448,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.695529,0.18142,-0.695217,1.633189,-0.328978,-0.636664,
-	0.919751,0.19868,-0.338503,1.688934,-0.429344,-0.580972,
-	0.921783,0.189963,-0.337979,1.670246,-0.328472,-0.574544,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.914159,0.225597,0.336777,1.704717,-0.510672,-0.412264,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.676292,-0.291987,0.676293,1.673866,-0.608893,-0.326134,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0.925394,0.167122,0.340171,1.718387,-0.569469,-0.406406,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.676292,-0.291988,-0.676293,1.673866,-0.608893,-0.673866,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.976322,0.216322,0,1.71934,-0.510672,-0.5,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.914159,0.225597,-0.336777,1.704717,-0.510672,-0.587736,
-	0.925394,0.167122,-0.340171,1.718387,-0.569469,-0.593594,
-	0.981432,0.191813,0,1.733986,-0.569469,-0.5,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.188349,-0.976969,-0.100277,1.664625,-0.646948,-0.5825,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.611773,-0.791034,0,1.7215,-0.634535,-0.5,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.188349,-0.976969,-0.100277,1.664625,-0.646948,-0.5825,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.611773,-0.791034,0,1.7215,-0.634535,-0.5,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.676292,-0.291988,-0.676293,1.673866,-0.608893,-0.673866,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0.529853,-0.826565,-0.189859,1.706,-0.633319,-0.5875,
-	0.878536,-0.271725,-0.392861,1.721597,-0.609197,-0.594774,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.188349,-0.976969,0.100277,1.664625,-0.646948,-0.4175,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0.676292,-0.291987,0.676293,1.673866,-0.608893,-0.326134,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.611773,-0.791034,0,1.7215,-0.634535,-0.5,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.968451,-0.249205,0,1.737621,-0.609501,-0.5,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.878536,-0.271725,0.392861,1.721597,-0.609197,-0.405226,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.188349,-0.976969,0.100277,1.664625,-0.646948,-0.4175,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.529853,-0.826565,0.189859,1.706,-0.633319,-0.4125,
-	0.611773,-0.791034,0,1.7215,-0.634535,-0.5,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0.686951,0.237061,-0.686951,1.660849,-0.510672,-0.660849,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0.336776,0.225597,-0.91416,1.587736,-0.510672,-0.704717,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	0.676292,-0.291988,-0.676293,1.673866,-0.608893,-0.673866,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.700149,0.139938,-0.700149,1.67159,-0.569469,-0.67159,
-	0.340171,0.167122,-0.925394,1.593594,-0.569469,-0.718387,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	-0.676292,-0.291988,-0.676293,1.326134,-0.608893,-0.673866,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	0,0.216323,-0.976322,1.5,-0.510672,-0.71934,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.336776,0.225597,-0.91416,1.412264,-0.510672,-0.704717,
-	-0.340171,0.167122,-0.925394,1.406406,-0.569469,-0.718387,
-	0,0.191813,-0.981432,1.5,-0.569469,-0.733986,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.100277,-0.976969,-0.18835,1.4175,-0.646948,-0.664625,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	0,-0.791034,-0.611773,1.5,-0.634535,-0.7215,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	-0.100277,-0.976969,-0.18835,1.4175,-0.646948,-0.664625,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	0,-0.791034,-0.611773,1.5,-0.634535,-0.7215,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	-0.676292,-0.291988,-0.676293,1.326134,-0.608893,-0.673866,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	-0.189859,-0.826565,-0.529853,1.4125,-0.633319,-0.706,
-	-0.392861,-0.271725,-0.878536,1.405226,-0.609197,-0.721597,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0.100277,-0.976969,-0.18835,1.5825,-0.646948,-0.664625,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0.676292,-0.291988,-0.676293,1.673866,-0.608893,-0.673866,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0.467068,-0.750796,-0.467068,1.660875,-0.632104,-0.660875,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	0,-0.791034,-0.611773,1.5,-0.634535,-0.7215,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0,-0.249205,-0.968451,1.5,-0.609501,-0.737621,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0.392861,-0.271725,-0.878536,1.594774,-0.609197,-0.721597,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	0.100277,-0.976969,-0.18835,1.5825,-0.646948,-0.664625,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	0.189859,-0.826565,-0.529853,1.5875,-0.633319,-0.706,
-	0,-0.791034,-0.611773,1.5,-0.634535,-0.7215,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.686951,0.237061,-0.686951,1.339151,-0.510672,-0.660849,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.914159,0.225597,-0.336777,1.295283,-0.510672,-0.587736,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.676292,-0.291988,-0.676293,1.326134,-0.608893,-0.673866,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	-0.700149,0.139938,-0.700149,1.32841,-0.569469,-0.67159,
-	-0.925394,0.167122,-0.340171,1.281613,-0.569469,-0.593594,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.676292,-0.291987,0.676293,1.326134,-0.608893,-0.326134,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.976322,0.216322,0,1.28066,-0.510672,-0.5,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.914159,0.225597,0.336777,1.295283,-0.510672,-0.412264,
-	-0.925394,0.167122,0.340171,1.281613,-0.569469,-0.406406,
-	-0.981432,0.191813,0,1.266014,-0.569469,-0.5,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.188349,-0.976969,0.100277,1.335375,-0.646948,-0.4175,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.611773,-0.791034,0,1.2785,-0.634535,-0.5,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.188349,-0.976969,0.100277,1.335375,-0.646948,-0.4175,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.611773,-0.791034,0,1.2785,-0.634535,-0.5,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.676292,-0.291987,0.676293,1.326134,-0.608893,-0.326134,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	-0.529853,-0.826565,0.189859,1.294,-0.633319,-0.4125,
-	-0.878536,-0.271725,0.392861,1.278403,-0.609197,-0.405226,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.188349,-0.976969,-0.100277,1.335375,-0.646948,-0.5825,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	-0.676292,-0.291988,-0.676293,1.326134,-0.608893,-0.673866,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.467068,-0.750796,-0.467068,1.339125,-0.632104,-0.660875,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.611773,-0.791034,0,1.2785,-0.634535,-0.5,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.968451,-0.249205,0,1.262379,-0.609501,-0.5,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.878536,-0.271725,-0.392861,1.278403,-0.609197,-0.594774,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.188349,-0.976969,-0.100277,1.335375,-0.646948,-0.5825,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.529853,-0.826565,-0.189859,1.294,-0.633319,-0.5875,
-	-0.611773,-0.791034,0,1.2785,-0.634535,-0.5,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	-0.68695,0.237061,0.686951,1.339151,-0.510672,-0.339151,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	-0.336776,0.225598,0.914159,1.412264,-0.510672,-0.295283,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	-0.676292,-0.291987,0.676293,1.326134,-0.608893,-0.326134,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.700149,0.139938,0.700149,1.32841,-0.569469,-0.32841,
-	-0.340171,0.167122,0.925394,1.406406,-0.569469,-0.281613,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0.68695,0.237061,0.686951,1.660849,-0.510672,-0.339151,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0.676292,-0.291987,0.676293,1.673866,-0.608893,-0.326134,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0.700149,0.139938,0.700149,1.67159,-0.569469,-0.32841,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	0,0.216323,0.976322,1.5,-0.510672,-0.28066,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	0.336776,0.225598,0.914159,1.587736,-0.510672,-0.295283,
-	0.340171,0.167122,0.925394,1.593594,-0.569469,-0.281613,
-	0,0.191813,0.981432,1.5,-0.569469,-0.266014,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.100277,-0.976969,0.18835,1.5825,-0.646948,-0.335375,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	0,-0.791034,0.611773,1.5,-0.634535,-0.2785,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0.100277,-0.976969,0.18835,1.5825,-0.646948,-0.335375,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0,-0.791034,0.611773,1.5,-0.634535,-0.2785,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	0.676292,-0.291987,0.676293,1.673866,-0.608893,-0.326134,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0.467068,-0.750796,0.467068,1.660875,-0.632104,-0.339125,
-	0.189859,-0.826565,0.529853,1.5875,-0.633319,-0.294,
-	0.392861,-0.271724,0.878536,1.594774,-0.609197,-0.278403,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	-0.100277,-0.976969,0.18835,1.4175,-0.646948,-0.335375,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	-0.676292,-0.291987,0.676293,1.326134,-0.608893,-0.326134,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	-0.467068,-0.750796,0.467068,1.339125,-0.632104,-0.339125,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	0,-0.791034,0.611773,1.5,-0.634535,-0.2785,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	0,-0.249205,0.968451,1.5,-0.609501,-0.262379,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	-0.392861,-0.271724,0.878536,1.405226,-0.609197,-0.278403,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	-0.100277,-0.976969,0.18835,1.4175,-0.646948,-0.335375,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	-0.189859,-0.826565,0.529853,1.4125,-0.633319,-0.294,
-	0,-0.791034,0.611773,1.5,-0.634535,-0.2785,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.100277,-0.976969,-0.18835,1.5825,-0.646948,-0.664625,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0.199329,-0.959446,-0.199329,1.638667,-0.642463,-0.638667,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0.188349,-0.976969,-0.100277,1.664625,-0.646948,-0.5825,
-	0.100277,-0.976969,-0.18835,1.5825,-0.646948,-0.664625,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0.100277,-0.976969,-0.18835,1.5825,-0.646948,-0.664625,
-	0,-1,0,1.5,-0.660924,-0.5,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0,-1,0,1.5,-0.660924,-0.5,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.188349,-0.976969,-0.100277,1.664625,-0.646948,-0.5825,
-	0.188349,-0.976969,-0.100277,1.664625,-0.646948,-0.5825,
-	0.079739,-0.993621,-0.079739,1.5905,-0.655194,-0.5905,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.188349,-0.976969,-0.100277,1.335375,-0.646948,-0.5825,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	-0.199329,-0.959446,-0.199329,1.361333,-0.642463,-0.638667,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	-0.100277,-0.976969,-0.18835,1.4175,-0.646948,-0.664625,
-	-0.188349,-0.976969,-0.100277,1.335375,-0.646948,-0.5825,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	-0.188349,-0.976969,-0.100277,1.335375,-0.646948,-0.5825,
-	0,-1,0,1.5,-0.660924,-0.5,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	0,-1,0,1.5,-0.660924,-0.5,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	0,-0.969635,-0.244558,1.5,-0.649161,-0.677562,
-	-0.100277,-0.976969,-0.18835,1.4175,-0.646948,-0.664625,
-	-0.100277,-0.976969,-0.18835,1.4175,-0.646948,-0.664625,
-	-0.079739,-0.993621,-0.079739,1.4095,-0.655194,-0.5905,
-	0,-0.996384,-0.08496,1.5,-0.657972,-0.59775,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.100277,-0.976969,0.18835,1.4175,-0.646948,-0.335375,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	-0.199329,-0.959446,0.199329,1.361333,-0.642463,-0.361333,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	-0.188349,-0.976969,0.100277,1.335375,-0.646948,-0.4175,
-	-0.100277,-0.976969,0.18835,1.4175,-0.646948,-0.335375,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	-0.100277,-0.976969,0.18835,1.4175,-0.646948,-0.335375,
-	0,-1,0,1.5,-0.660924,-0.5,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	0,-1,0,1.5,-0.660924,-0.5,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	-0.244558,-0.969635,0,1.322438,-0.649161,-0.5,
-	-0.188349,-0.976969,0.100277,1.335375,-0.646948,-0.4175,
-	-0.188349,-0.976969,0.100277,1.335375,-0.646948,-0.4175,
-	-0.079739,-0.993621,0.079739,1.4095,-0.655194,-0.4095,
-	-0.08496,-0.996384,0,1.40225,-0.657972,-0.5,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.188349,-0.976969,0.100277,1.664625,-0.646948,-0.4175,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0.199329,-0.959446,0.199329,1.638667,-0.642463,-0.361333,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0.100277,-0.976969,0.18835,1.5825,-0.646948,-0.335375,
-	0.188349,-0.976969,0.100277,1.664625,-0.646948,-0.4175,
-	0.244558,-0.969635,0,1.677562,-0.649161,-0.5,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0.188349,-0.976969,0.100277,1.664625,-0.646948,-0.4175,
-	0,-1,0,1.5,-0.660924,-0.5,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0,-1,0,1.5,-0.660924,-0.5,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0.08496,-0.996384,0,1.59775,-0.657972,-0.5,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-	0,-0.969635,0.244558,1.5,-0.649161,-0.322437,
-	0.100277,-0.976969,0.18835,1.5825,-0.646948,-0.335375,
-	0.100277,-0.976969,0.18835,1.5825,-0.646948,-0.335375,
-	0.079739,-0.993621,0.079739,1.5905,-0.655194,-0.4095,
-	0,-0.996384,0.08496,1.5,-0.657972,-0.40225,
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1728,data,NULL};
-const struct gllist *s1_6=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_6[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\042\001\000\000\300\006\000\000`\003\000\000\035"
+ ">\267\077\230\334(\275\000\000\000\277\304\245\23677\0017l\217\334\000\000"
+ "\363\005\244]\307\336\000\000\207\014}c\341\355\000\000\013\010\347r\253"
+ "\354\000\000\271\016qe\000\000\000\000R\012!u\000\000\000\000\003\006\364"
+ "}\000\000\000\000\277\003\215{m\354\000\000\352\374{t\027\334\000\000\207"
+ "\014}c\037\022\000\000\363\005\244]9!\000\0007\0017lq#\000\000\013\010\347"
+ "rU\023\000\000\352\374{t\351#\000\000\277\003\215{\223\023\000\000J\363\324"
+ "t\244\034\000\000X\366Ty\012\021\000\000O\376\205}\023\022\000\000\003\370"
+ "\244v:!\000\000\337\367\221{\000\000\000\000Z\000\377\177\000\000\000\000"
+ "J\363\324t\134\343\000\000\003\370\244v\306\336\000\000O\376\205}\355\355"
+ "\000\000X\366Ty\366\356\000\000\375\372\344SI*\000\000\326\365\022a\033-"
+ "\000\000\325\3550HN-\000\000.\350\263ST0\000\000\306\343\373Z\0241\000\000"
+ "z\361\343h\305-\000\000\256\340}<I*\000\000\267\325\27529!\000\000%\317/"
+ ";q#\000\000\207\332TF\033-\000\000\321\312OA\351#\000\000*\326\376L\305-"
+ "\000\000\177\313\237K\244\034\000\000\343\322\234T\001\042\000\0002\324\351"
+ "Q\214*\000\000\331\311\326F:!\000\000e\336/a\255$\000\000\222\340\026_\300"
+ "-\000\000\220\352 m\001\042\000\000N\355\352k\214*\000\000#\317\343,\037"
+ "\022\000\000Q\310\2004U\023\000\000\362\314\360*\000\000\000\000\013\306"
+ "E2\000\000\000\000\212\301\0038\000\000\000\000\345\303S:\223\023\000\000"
+ "\267\325\2752\307\336\000\000%\317/;\217\334\000\000Q\310\2004\253\354\000"
+ "\000#\317\343,\341\355\000\000\321\312OA\027\334\000\000\345\303S:m\354\000"
+ "\000\177\313\237K\134\343\000\000\033\307hH\366\356\000\0002\303N@\355\355"
+ "\000\000\331\311\326F\306\336\000\000\354\304\316F\000\000\000\000\312\300"
+ "->\000\000\000\0002\303N@\023\022\000\000\033\307hH\012\021\000\000\256\340"
+ "}<\267\325\000\000\207\332TF\345\322\000\000\325\3550H\262\322\000\000.\350"
+ "\263S\254\317\000\000\306\343\373Z\354\316\000\000*\326\376L;\322\000\000"
+ "\326\365\022a\345\322\000\000\375\372\344S\267\325\000\000z\361\343h;\322"
+ "\000\000\220\352 m\377\335\000\000N\355\352kt\325\000\000e\336/aS\333\000"
+ "\000\222\340\026_@\322\000\0002\324\351Qt\325\000\000\343\322\234T\377\335"
+ "\000\000|\352\177o\261\022\000\000\026\335sb1\024\000\000\246\334\337b\000"
+ "\000\000\000\035\353\371p\000\000\000\000\204\320\233T\261\022\000\000\020"
+ "\317\355S\000\000\000\000\204\320\233TO\355\000\000\026\335sb\317\353\000"
+ "\000|\352\177oO\355\000\000(\014\216HW\341\000\000\210\022<MG\357\000\000"
+ "!\023\010/\306\343\000\000f\031e2\232\360\000\000}\033\2043\000\000\000\000"
+ "\250\024\313N\000\000\000\000+\032\042\023\234\345\000\000\223 \360\366a"
+ "\346\000\000\037'\373\367\006\362\000\000z 9\025\233\361\000\000M)T\370\000"
+ "\000\000\000\225\042\353\025\000\000\000\000\037'\373\367\372\015\000\000"
+ "\223 \360\366\237\031\000\000+\032\042\023d\032\000\000z 9\025e\016\000\000"
+ "!\023\010/:\034\000\000f\031e2f\017\000\000\210\022<M\271\020\000\000(\014"
+ "\216H\251\036\000\000f\335<&W\341\000\000\007\350\011.\372\330\000\000%\345"
+ "\134\026\306\343\000\000\230\357\370\033\023\334\000\000#\374\262\042\202"
+ "\331\000\000\307\364e70\326\000\000\344\353\320\003\234\345\000\000\226\360"
+ "G\357a\346\000\000~\373\004\361d\337\000\000h\366K\007i\336\000\000\225\010"
+ "\033\363\020\335\000\000\007\003y\013\003\334\000\000\246\017\247\017i\336"
+ "\000\000\253\0252\365d\337\000\000\255\010l)\023\334\000\000\207\001\301"
+ "@\372\330\000\000\007\350\011.\006'\000\000f\335<&\251\036\000\000\307\364"
+ "e7\320)\000\000#\374\262\042~&\000\000\230\357\370\033\355#\000\000%\345"
+ "\134\026:\034\000\000\207\001\301@\006'\000\000\255\010l)\355#\000\000\253"
+ "\0252\365\234 \000\000\246\017\247\017\227!\000\000\225\010\033\363\360\042"
+ "\000\000\007\003y\013\375#\000\000~\373\004\361\234 \000\000\226\360G\357"
+ "\237\031\000\000\344\353\320\003d\032\000\000h\366K\007\227!\000\000\006"
+ "\327\216!G\357\000\000\346\324\376\037\000\000\000\000\310\334\340\021\000"
+ "\000\000\000\340\336\377\022\232\360\000\000\006\327\216!\271\020\000\000"
+ "\340\336\377\022f\017\000\000\012\352;\356\372\015\000\000\224\345\271\001"
+ "e\016\000\000\334\347\342\355\000\000\000\000z\343\007\001\000\000\000\000"
+ "\224\345\271\001\233\361\000\000\012\352;\356\006\362\000\000x\357\326\257"
+ "W\341\000\000\351\354\012\237\307\336\000\000\002\374\012\237\267\325\000"
+ "\000h\375\326\257\372\330\000\000\042\016\012\237\262\322\000\000\042\016"
+ "\326\2570\326\000\000\223\015/\304\202\331\000\000E\376\371\303\023\334\000"
+ "\000\203\361\315\303\306\343\000\000A \012\237\267\325\000\000[/\012\237"
+ "\307\336\000\000\313,\326\257W\341\000\000\333\036\326\257\372\330\000\000"
+ "\244)\221\304\306\343\000\000\342\034d\304\023\334\000\000\363\031\317\333"
+ "i\336\000\000\247%\202\334\234\345\000\000\351\013\371\332\003\334\000\000"
+ ",\362q\331\234\345\000\000\337\375$\332i\336\000\000\331\343\012\237\341"
+ "\355\000\000\034\347\326\257G\357\000\000\333\351\262\303\232\360\000\000"
+ "N\347\251\303\000\000\000\000R\344\326\257\000\000\000\000\324\340\012\237"
+ "\000\000\000\000&\353\006\331\233\361\000\000\317\350\343\330\000\000\000"
+ "\000,\362q\331d\032\000\000&\353\006\331e\016\000\000\203\361\315\303:\034"
+ "\000\000\333\351\262\303f\017\000\000x\357\326\257\251\036\000\000\351\354"
+ "\012\2379!\000\000\331\343\012\237\037\022\000\000\034\347\326\257\271\020"
+ "\000\000\002\374\012\237I*\000\000h\375\326\257\006'\000\000E\376\371\303"
+ "\355#\000\000\223\015/\304~&\000\000\042\016\326\257\320)\000\000\042\016"
+ "\012\237N-\000\000\337\375$\332\227!\000\000\351\013\371\332\375#\000\000"
+ "\247%\202\334d\032\000\000\363\031\317\333\227!\000\000\244)\221\304:\034"
+ "\000\000\342\034d\304\355#\000\000\313,\326\257\251\036\000\000[/\012\237"
+ "9!\000\000A \012\237I*\000\000\333\036\326\257\006'\000\000j8\012\237\037"
+ "\022\000\000(5\326\257\271\020\000\000K1\254\304f\017\000\000\3313\265\304"
+ "\000\000\000\000\3617\326\257\000\000\000\000o;\012\237\000\000\000\000\254"
+ ",\355\334e\016\000\000\003/\020\335\000\000\000\000\254,\355\334\233\361"
+ "\000\000K1\254\304\232\360\000\000j8\012\237\341\355\000\000(5\326\257G\357"
+ "\000\000=;\345\222U\023\000\000\2231\345\222q#\000\000v>\345\222\000\000"
+ "\000\0006\077\240\212\000\000\000\000\347;\260\212\223\023\000\000\0132\300"
+ "\212\351#\000\000\2231\345\222\217\334\000\000=;\345\222\253\354\000\000"
+ "\0132\300\212\027\334\000\000\347;\260\212m\354\000\000\306*\321\203\134"
+ "\343\000\000\0420\344\202\366\356\000\000\2568\265\205\355\355\000\000\134"
+ "/\365\205\306\336\000\000\3162o\202\000\000\000\000\342;t\205\000\000\000"
+ "\000\306*\321\203\244\034\000\000\134/\365\205:!\000\000\2568\265\205\023"
+ "\022\000\000\0420\344\202\012\021\000\000v!\345\222\345\322\000\000\042\016"
+ "\345\222\254\317\000\000\042\016\240\212\354\316\000\000\265!\260\212;\322"
+ "\000\000\261\352\345\222\217\334\000\000\315\372\345\222\345\322\000\000"
+ "8\352\300\212\027\334\000\000\216\372\260\212;\322\000\000}\361\321\203\134"
+ "\343\000\000\027\375\344\202\377\335\000\000\017\374\265\205t\325\000\000"
+ "\347\354\365\205\306\336\000\000\042\016o\202S\333\000\000\042\016t\205@"
+ "\322\000\0004 \265\205t\325\000\000,\037\344\202\377\335\000\000\006\341"
+ "\345\222\253\354\000\000\315\335\345\222\000\000\000\000\015\335\240\212"
+ "\000\000\000\000\134\340\260\212m\354\000\000\261\352\345\222q#\000\000\006"
+ "\341\345\222U\023\000\0008\352\300\212\351#\000\000\134\340\260\212\223\023"
+ "\000\000}\361\321\203\244\034\000\000!\354\344\202\012\021\000\000\225\343"
+ "\265\205\023\022\000\000\347\354\365\205:!\000\000u\351o\202\000\000\000"
+ "\000b\340t\205\000\000\000\000\225\343\265\205\355\355\000\000!\354\344\202"
+ "\366\356\000\000\315\372\345\222\033-\000\000\042\016\345\222T0\000\000\042"
+ "\016\240\212\0241\000\000\216\372\260\212\305-\000\000v!\345\222\033-\000"
+ "\000\265!\260\212\305-\000\000,\037\344\202\001\042\000\0004 \265\205\214"
+ "*\000\000\042\016o\202\255$\000\000\042\016t\205\300-\000\000\017\374\265"
+ "\205\214*\000\000\027\375\344\202\001\042\000\000\323 0\201O\355\000\000"
+ "\042\016\235\200\317\353\000\000\042\016\001\200\000\000\000\000R\042\235"
+ "\200\000\000\000\000p\3730\201O\355\000\000\361\371\235\200\000\000\000\000"
+ "p\3730\201\261\022\000\000\042\016\235\2001\024\000\000\323 0\201\261\022"
+ "\000\000mGsAk/d6d\033Z%3LGRU\134P\024>\0148\022I\033#*-8\323C\317F\360\134"
+ "\356F\317N\370w\304R\307m\335o\307N+\377&\005\016\360\014\363\356\025\014"
+ "%\361\342\333\332\332\333\357\345\305\361\325\000\274+\3031\312\037\274\027"
+ "\3106\323,\316<\3432\311\321\312\321\271\310\275\304\245\334\273\342\247"
+ "\246\246\247\260\267\260\270\220\274\237\306\254;\2607\224&\230;\257.\223"
+ "\022\247\023\270/\237\220\234\222o\217r\215\226m\201\254zY~\254Zs\275M\263"
+ "b\267G\255R\240I\262B\310@\303;\277>\305D\2766\2729\267=\274B\301GtAk.tB"
+ "l.f\031e\032tCsGn.m.h\027g\030Q\0218\014<\013Q\022=\013Q\023Q\024>\013\242"
+ "\254\233\225\234\261\226\232r\210p\214\225\267\212\275\207\242\220\236\203"
+ "\205w\204|[yb~X\177V\354\346\325\337\013\361\007\363\347\353\320\345)\000"
+ "'\001\035\006$\003\374\376\003\370\337\372\304\367\312\354\343\361\251\276"
+ "\261\320\250\331\242\305\303\330\274\337\253\364\265\350\215\364\235\344"
+ "\231\314\215\326\220G\224I\224b\221ah\177\224\177\217\177\214_\214ElblIo"
+ "HnapGqat`rF\211~\204>\205]\2240\221.\213)\214\013\223\022\230\027\202\036"
+ "\203\002\277\003\237\001\306\013\252\012\310\017\312\023\261\023\257\020"
+ "\343\023\342\020\340\013\000\016\000\023\000\027\336\004\377\0109\015\037"
+ "\0138\017\036\0167\0206\023\035\023\036\021O\023P\021Q\021j\025j\025h\027"
+ "Q\021i\026n.n.l0n/R\017:\014j\025e\346H\3524\351sEp-h\265i\311%\224\035\224"
+ ";\255F\244\032\2337\270\023\246#\307,\274\023\236paj\177e\201i\241\215E\220"
+ "a\230\265\227\241\333\224\343\213\305\221\272\244\032\2017\201;\221\035\213"
+ "\220-\226\025\233\346\227\311\306\014\256\017\314\351\270\352\355\246\355"
+ "\236\324\274\335\307\346\233\311\270\305\255\343\224\342\017\000\025\000"
+ "\346\340\352\036\017 \352\012\236\020\274\000\233\000\270\360\274\366\236"
+ "\022\212\012\201\000\201\012\213\356\212\366\213\367\223\000\213\011\223"
+ "\000\000\001\000\002\000\002\000\003\000\000\000\004\000\005\000\003\000"
+ "\004\000\003\000\002\000\005\000\006\000\007\000\007\000\003\000\005\000"
+ "\010\000\000\000\003\000\010\000\003\000\007\000\011\000\012\000\013\000"
+ "\013\000\014\000\011\000\015\000\016\000\014\000\015\000\014\000\013\000"
+ "\016\000\006\000\005\000\005\000\014\000\016\000\004\000\011\000\014\000"
+ "\004\000\014\000\005\000\017\000\020\000\021\000\017\000\021\000\022\000"
+ "\023\000\024\000\021\000\023\000\021\000\020\000\006\000\016\000\021\000"
+ "\006\000\021\000\024\000\016\000\015\000\022\000\022\000\021\000\016\000"
+ "\025\000\026\000\027\000\025\000\027\000\030\000\026\000\010\000\007\000"
+ "\007\000\027\000\026\000\006\000\024\000\027\000\006\000\027\000\007\000"
+ "\023\000\030\000\027\000\023\000\027\000\024\000\012\000\031\000\032\000"
+ "\012\000\032\000\013\000\031\000\033\000\034\000\034\000\032\000\031\000"
+ "\035\000\036\000\032\000\035\000\032\000\034\000\036\000\015\000\013\000"
+ "\013\000\032\000\036\000\037\000 \000!\000!\000\042\000\037\000#\000$\000"
+ "\042\000#\000\042\000!\000$\000\035\000\034\000\034\000\042\000$\000\033"
+ "\000\037\000\042\000\033\000\042\000\034\000%\000&\000'\000%\000'\000(\000"
+ "&\000)\000*\000*\000'\000&\000\035\000$\000'\000\035\000'\000*\000$\000#"
+ "\000(\000(\000'\000$\000+\000\017\000\022\000\022\000,\000+\000\022\000\015"
+ "\000\036\000\036\000,\000\022\000\035\000*\000,\000\035\000,\000\036\000"
+ "*\000)\000+\000+\000,\000*\000 \000-\000.\000 \000.\000!\000-\000/\0000\000"
+ "0\000.\000-\0001\0002\000.\0001\000.\0000\0002\000#\000!\000!\000.\0002\000"
+ "3\0004\0005\0003\0005\0006\0004\0007\0008\0008\0005\0004\0001\0000\0005\000"
+ "1\0005\0008\0000\000/\0006\0006\0005\0000\0009\000:\000;\0009\000;\000<\000"
+ "=\000>\000;\000=\000;\000:\0001\0008\000;\0001\000;\000>\0007\000<\000;\000"
+ "7\000;\0008\000%\000(\000\077\000%\000\077\000@\000#\0002\000\077\000#\000"
+ "\077\000(\0001\000>\000\077\0001\000\077\0002\000=\000@\000\077\000=\000"
+ "\077\000>\0004\0003\000A\000A\000B\0004\000C\000D\000B\000C\000B\000A\000"
+ "D\000E\000F\000F\000B\000D\0007\0004\000B\0007\000B\000F\000\001\000\000"
+ "\000G\000\001\000G\000H\000\000\000\010\000I\000I\000G\000\000\000E\000D"
+ "\000G\000E\000G\000I\000D\000C\000H\000H\000G\000D\000\026\000\025\000J\000"
+ "J\000K\000\026\000J\000L\000M\000M\000K\000J\000E\000I\000K\000E\000K\000"
+ "M\000I\000\010\000\026\000\026\000K\000I\0009\000<\000N\0009\000N\000O\000"
+ "<\0007\000F\000F\000N\000<\000E\000M\000N\000E\000N\000F\000M\000L\000O\000"
+ "O\000N\000M\000\017\000+\000P\000\017\000P\000\020\000+\000)\000Q\000Q\000"
+ "P\000+\000R\000S\000P\000R\000P\000Q\000S\000\023\000\020\000\020\000P\000"
+ "S\000%\000@\000T\000%\000T\000&\000@\000=\000U\000U\000T\000@\000R\000Q\000"
+ "T\000R\000T\000U\000Q\000)\000&\000&\000T\000Q\0009\000O\000V\0009\000V\000"
+ ":\000O\000L\000W\000W\000V\000O\000R\000U\000V\000R\000V\000W\000U\000=\000"
+ ":\000:\000V\000U\000\025\000\030\000X\000\025\000X\000J\000\030\000\023\000"
+ "S\000S\000X\000\030\000R\000W\000X\000R\000X\000S\000W\000L\000J\000J\000"
+ "X\000W\000\001\000Y\000Z\000\001\000Z\000\002\000Y\000[\000\134\000\134\000"
+ "Z\000Y\000]\000^\000Z\000]\000Z\000\134\000^\000\004\000\002\000\002\000"
+ "Z\000^\000_\000`\000a\000a\000b\000_\000c\000d\000b\000c\000b\000a\000d\000"
+ "]\000\134\000\134\000b\000d\000[\000_\000b\000[\000b\000\134\000e\000f\000"
+ "g\000g\000h\000e\000i\000j\000h\000i\000h\000g\000j\000]\000d\000d\000h\000"
+ "j\000c\000e\000h\000c\000h\000d\000\012\000\011\000k\000\012\000k\000l\000"
+ "\011\000\004\000^\000^\000k\000\011\000]\000j\000k\000]\000k\000^\000j\000"
+ "i\000l\000l\000k\000j\0003\000m\000n\0003\000n\000A\000m\000o\000p\000p\000"
+ "n\000m\000q\000r\000n\000q\000n\000p\000r\000C\000A\000A\000n\000r\000s\000"
+ "t\000u\000u\000v\000s\000w\000x\000v\000w\000v\000u\000x\000q\000p\000p\000"
+ "v\000x\000o\000s\000v\000o\000v\000p\000`\000_\000y\000`\000y\000z\000_\000"
+ "[\000{\000{\000y\000_\000q\000x\000y\000q\000y\000{\000x\000w\000z\000z\000"
+ "y\000x\000Y\000\001\000H\000H\000|\000Y\000C\000r\000|\000C\000|\000H\000"
+ "r\000q\000{\000{\000|\000r\000[\000Y\000|\000[\000|\000{\000 \000\037\000"
+ "}\000 \000}\000~\000\037\000\033\000\177\000\177\000}\000\037\000\200\000"
+ "\201\000}\000\200\000}\000\177\000\201\000\202\000~\000~\000}\000\201\000"
+ "\031\000\012\000l\000l\000\203\000\031\000i\000\204\000\203\000i\000\203"
+ "\000l\000\204\000\200\000\177\000\177\000\203\000\204\000\033\000\031\000"
+ "\203\000\033\000\203\000\177\000f\000\205\000\206\000f\000\206\000g\000\205"
+ "\000\207\000\210\000\210\000\206\000\205\000\200\000\204\000\206\000\200"
+ "\000\206\000\210\000\204\000i\000g\000g\000\206\000\204\000\211\000\212\000"
+ "\213\000\213\000\214\000\211\000\202\000\201\000\214\000\202\000\214\000"
+ "\213\000\201\000\200\000\210\000\210\000\214\000\201\000\207\000\211\000"
+ "\214\000\207\000\214\000\210\000m\0003\0006\0006\000\215\000m\000/\000\216"
+ "\000\215\000/\000\215\0006\000\216\000\217\000\220\000\220\000\215\000\216"
+ "\000o\000m\000\215\000o\000\215\000\220\000-\000 \000~\000~\000\221\000-"
+ "\000\202\000\222\000\221\000\202\000\221\000~\000\222\000\217\000\216\000"
+ "\216\000\221\000\222\000/\000-\000\221\000/\000\221\000\216\000\212\000\223"
+ "\000\224\000\212\000\224\000\213\000\223\000\225\000\226\000\226\000\224"
+ "\000\223\000\217\000\222\000\224\000\217\000\224\000\226\000\222\000\202"
+ "\000\213\000\213\000\224\000\222\000t\000s\000\227\000t\000\227\000\230\000"
+ "s\000o\000\220\000\220\000\227\000s\000\217\000\226\000\227\000\217\000\227"
+ "\000\220\000\226\000\225\000\230\000\230\000\227\000\226\000\231\000\232"
+ "\000\233\000\233\000\234\000\231\000\235\000\236\000\234\000\235\000\234"
+ "\000\233\000\236\000\237\000\240\000\240\000\234\000\236\000\241\000\231"
+ "\000\234\000\241\000\234\000\240\000\242\000\243\000\244\000\244\000\245"
+ "\000\242\000\246\000\247\000\245\000\246\000\245\000\244\000\247\000\237"
+ "\000\236\000\236\000\245\000\247\000\235\000\242\000\245\000\235\000\245"
+ "\000\236\000`\000z\000\250\000`\000\250\000\251\000z\000w\000\252\000\252"
+ "\000\250\000z\000\237\000\247\000\250\000\237\000\250\000\252\000\247\000"
+ "\246\000\251\000\251\000\250\000\247\000t\000\253\000\254\000t\000\254\000"
+ "u\000\253\000\241\000\240\000\240\000\254\000\253\000\237\000\252\000\254"
+ "\000\237\000\254\000\240\000\252\000w\000u\000u\000\254\000\252\000\255\000"
+ "\232\000\231\000\231\000\256\000\255\000\241\000\257\000\256\000\241\000"
+ "\256\000\231\000\257\000\260\000\261\000\261\000\256\000\257\000\262\000"
+ "\255\000\256\000\262\000\256\000\261\000\253\000t\000\230\000\230\000\263"
+ "\000\253\000\225\000\264\000\263\000\225\000\263\000\230\000\260\000\257"
+ "\000\263\000\260\000\263\000\264\000\257\000\241\000\253\000\253\000\263"
+ "\000\257\000\223\000\212\000\265\000\265\000\266\000\223\000\265\000\267"
+ "\000\270\000\270\000\266\000\265\000\260\000\264\000\266\000\260\000\266"
+ "\000\270\000\225\000\223\000\266\000\225\000\266\000\264\000\271\000\272"
+ "\000\273\000\273\000\274\000\271\000\262\000\261\000\274\000\262\000\274"
+ "\000\273\000\261\000\260\000\270\000\270\000\274\000\261\000\267\000\271"
+ "\000\274\000\267\000\274\000\270\000\275\000\272\000\271\000\271\000\276"
+ "\000\275\000\267\000\277\000\276\000\267\000\276\000\271\000\277\000\300"
+ "\000\301\000\301\000\276\000\277\000\302\000\275\000\276\000\302\000\276"
+ "\000\301\000\212\000\211\000\303\000\212\000\303\000\265\000\211\000\207"
+ "\000\304\000\304\000\303\000\211\000\300\000\277\000\303\000\300\000\303"
+ "\000\304\000\277\000\267\000\265\000\265\000\303\000\277\000f\000\305\000"
+ "\306\000f\000\306\000\205\000\305\000\307\000\310\000\310\000\306\000\305"
+ "\000\300\000\304\000\306\000\300\000\306\000\310\000\304\000\207\000\205"
+ "\000\205\000\306\000\304\000\311\000\312\000\313\000\313\000\314\000\311"
+ "\000\302\000\301\000\314\000\302\000\314\000\313\000\301\000\300\000\310"
+ "\000\310\000\314\000\301\000\307\000\311\000\314\000\307\000\314\000\310"
+ "\000\315\000\312\000\311\000\311\000\316\000\315\000\307\000\317\000\316"
+ "\000\307\000\316\000\311\000\317\000\320\000\321\000\321\000\316\000\317"
+ "\000\322\000\315\000\316\000\322\000\316\000\321\000f\000e\000\323\000f\000"
+ "\323\000\305\000e\000c\000\324\000\324\000\323\000e\000\320\000\317\000\323"
+ "\000\320\000\323\000\324\000\317\000\307\000\305\000\305\000\323\000\317"
+ "\000`\000\251\000\325\000`\000\325\000a\000\251\000\246\000\326\000\326\000"
+ "\325\000\251\000\320\000\324\000\325\000\320\000\325\000\326\000\324\000"
+ "c\000a\000a\000\325\000\324\000\244\000\243\000\327\000\327\000\330\000\244"
+ "\000\322\000\321\000\330\000\322\000\330\000\327\000\321\000\320\000\326"
+ "\000\326\000\330\000\321\000\246\000\244\000\330\000\246\000\330\000\326"
+ "\000\312\000\315\000\331\000\312\000\331\000\332\000\315\000\322\000\333"
+ "\000\333\000\331\000\315\000\334\000\335\000\331\000\334\000\331\000\333"
+ "\000\335\000\336\000\332\000\332\000\331\000\335\000\243\000\337\000\340"
+ "\000\243\000\340\000\327\000\337\000\341\000\342\000\342\000\340\000\337"
+ "\000\334\000\333\000\340\000\334\000\340\000\342\000\333\000\322\000\327"
+ "\000\327\000\340\000\333\000\343\000\344\000\345\000\343\000\345\000\346"
+ "\000\347\000\350\000\345\000\347\000\345\000\344\000\334\000\342\000\345"
+ "\000\334\000\345\000\350\000\342\000\341\000\346\000\346\000\345\000\342"
+ "\000\351\000\352\000\353\000\351\000\353\000\354\000\352\000\336\000\335"
+ "\000\335\000\353\000\352\000\334\000\350\000\353\000\334\000\353\000\335"
+ "\000\347\000\354\000\353\000\347\000\353\000\350\000\243\000\242\000\355"
+ "\000\243\000\355\000\337\000\242\000\235\000\356\000\356\000\355\000\242"
+ "\000\357\000\360\000\355\000\357\000\355\000\356\000\360\000\341\000\337"
+ "\000\337\000\355\000\360\000\232\000\361\000\362\000\232\000\362\000\233"
+ "\000\361\000\363\000\364\000\364\000\362\000\361\000\357\000\356\000\362"
+ "\000\357\000\362\000\364\000\356\000\235\000\233\000\233\000\362\000\356"
+ "\000\365\000\366\000\367\000\365\000\367\000\370\000\371\000\372\000\367"
+ "\000\371\000\367\000\366\000\357\000\364\000\367\000\357\000\367\000\372"
+ "\000\364\000\363\000\370\000\370\000\367\000\364\000\343\000\346\000\373"
+ "\000\343\000\373\000\374\000\346\000\341\000\360\000\360\000\373\000\346"
+ "\000\357\000\372\000\373\000\357\000\373\000\360\000\371\000\374\000\373"
+ "\000\371\000\373\000\372\000\232\000\255\000\375\000\232\000\375\000\361"
+ "\000\255\000\262\000\376\000\376\000\375\000\255\000\377\000\000\001\375"
+ "\000\377\000\375\000\376\000\000\001\363\000\361\000\361\000\375\000\000"
+ "\001\272\000\001\001\002\001\272\000\002\001\273\000\001\001\003\001\004"
+ "\001\004\001\002\001\001\001\377\000\376\000\002\001\377\000\002\001\004"
+ "\001\376\000\262\000\273\000\273\000\002\001\376\000\005\001\006\001\007"
+ "\001\005\001\007\001\010\001\011\001\012\001\007\001\011\001\007\001\006"
+ "\001\377\000\004\001\007\001\377\000\007\001\012\001\004\001\003\001\010"
+ "\001\010\001\007\001\004\001\365\000\370\000\013\001\365\000\013\001\014"
+ "\001\370\000\363\000\000\001\000\001\013\001\370\000\377\000\012\001\013"
+ "\001\377\000\013\001\000\001\011\001\014\001\013\001\011\001\013\001\012"
+ "\001\272\000\275\000\015\001\272\000\015\001\001\001\275\000\302\000\016"
+ "\001\016\001\015\001\275\000\017\001\020\001\015\001\017\001\015\001\016"
+ "\001\020\001\003\001\001\001\001\001\015\001\020\001\312\000\332\000\021"
+ "\001\312\000\021\001\313\000\332\000\336\000\022\001\022\001\021\001\332"
+ "\000\017\001\016\001\021\001\017\001\021\001\022\001\016\001\302\000\313"
+ "\000\313\000\021\001\016\001\351\000\023\001\024\001\351\000\024\001\352"
+ "\000\025\001\026\001\024\001\025\001\024\001\023\001\017\001\022\001\024"
+ "\001\017\001\024\001\026\001\022\001\336\000\352\000\352\000\024\001\022"
+ "\001\005\001\010\001\027\001\005\001\027\001\030\001\010\001\003\001\020"
+ "\001\020\001\027\001\010\001\017\001\026\001\027\001\017\001\027\001\020"
+ "\001\025\001\030\001\027\001\025\001\027\001\026\001\343\000\374\000\031"
+ "\001\343\000\031\001\344\000\374\000\371\000\032\001\032\001\031\001\374"
+ "\000\033\001\034\001\031\001\033\001\031\001\032\001\034\001\347\000\344"
+ "\000\344\000\031\001\034\001\365\000\014\001\035\001\365\000\035\001\366"
+ "\000\014\001\011\001\036\001\036\001\035\001\014\001\033\001\032\001\035"
+ "\001\033\001\035\001\036\001\032\001\371\000\366\000\366\000\035\001\032"
+ "\001\005\001\030\001\037\001\005\001\037\001\006\001\030\001\025\001 \001"
+ " \001\037\001\030\001\033\001\036\001\037\001\033\001\037\001 \001\036\001"
+ "\011\001\006\001\006\001\037\001\036\001\351\000\354\000!\001\351\000!\001"
+ "\023\001\354\000\347\000\034\001\034\001!\001\354\000\033\001 \001!\001\033"
+ "\001!\001\034\001 \001\025\001\023\001\023\001!\001 \001\000\000\001\000"
+ "\001\000\002\000\000\000\002\000\002\000\003\000\000\000\003\000\004\000"
+ "\005\000\003\000\005\000\003\000\004\000\002\000\004\000\005\000\006\000"
+ "\006\000\007\000\005\000\007\000\003\000\007\000\000\000\010\000\003\000"
+ "\010\000\007\000\010\000\011\000\012\000\012\000\013\000\011\000\013\000"
+ "\013\000\014\000\011\000\014\000\015\000\016\000\014\000\016\000\014\000"
+ "\015\000\013\000\015\000\006\000\016\000\005\000\016\000\005\000\014\000"
+ "\004\000\011\000\004\000\014\000\017\000\020\000\020\000\021\000\017\000"
+ "\021\000\021\000\022\000\017\000\022\000\023\000\024\000\021\000\024\000"
+ "\021\000\023\000\020\000\023\000\016\000\021\000\006\000\021\000\006\000"
+ "\024\000\015\000\022\000\016\000\022\000\025\000\026\000\026\000\027\000"
+ "\025\000\027\000\027\000\030\000\025\000\030\000\010\000\026\000\007\000"
+ "\026\000\007\000\027\000\024\000\027\000\006\000\027\000\023\000\030\000"
+ "\023\000\027\000\012\000\031\000\031\000\032\000\012\000\032\000\013\000"
+ "\032\000\031\000\033\000\033\000\034\000\031\000\034\000\032\000\034\000"
+ "\035\000\036\000\032\000\036\000\032\000\035\000\034\000\035\000\015\000"
+ "\036\000\013\000\036\000\037\000 \000 \000!\000\037\000!\000!\000\042\000"
+ "\037\000\042\000#\000$\000\042\000$\000\042\000#\000!\000#\000\035\000$\000"
+ "\034\000$\000\034\000\042\000\033\000\037\000\033\000\042\000%\000&\000&"
+ "\000'\000%\000'\000'\000(\000%\000(\000&\000)\000)\000*\000&\000*\000'\000"
+ "*\000$\000'\000\035\000'\000\035\000*\000#\000(\000$\000(\000\017\000+\000"
+ "\022\000+\000\022\000,\000+\000,\000\022\000\036\000\036\000,\000*\000,\000"
+ "\035\000,\000)\000+\000*\000+\000 \000-\000-\000.\000 \000.\000!\000.\000"
+ "-\000/\000/\0000\000-\0000\000.\0000\0001\0002\000.\0002\000.\0001\0000\000"
+ "1\000#\0002\000!\0002\0003\0004\0004\0005\0003\0005\0005\0006\0003\0006\000"
+ "4\0007\0007\0008\0004\0008\0005\0008\0000\0005\0001\0005\0001\0008\000/\000"
+ "6\0000\0006\0009\000:\000:\000;\0009\000;\000;\000<\0009\000<\000=\000>\000"
+ ";\000>\000;\000=\000:\000=\0008\000;\0001\000;\0001\000>\0007\000<\0007\000"
+ ";\000(\000\077\000%\000\077\000\077\000@\000%\000@\0002\000\077\000#\000"
+ "\077\000>\000\077\0001\000\077\000=\000@\000=\000\077\0003\000A\0004\000"
+ "A\000A\000B\0004\000B\000C\000D\000B\000D\000B\000C\000A\000C\000D\000E\000"
+ "E\000F\000D\000F\000B\000F\0007\000B\0007\000F\000\000\000G\000\001\000G"
+ "\000G\000H\000\001\000H\000\010\000I\000\000\000I\000G\000I\000D\000G\000"
+ "E\000G\000E\000I\000C\000H\000D\000H\000\025\000J\000\026\000J\000J\000K"
+ "\000\026\000K\000J\000L\000L\000M\000J\000M\000K\000M\000I\000K\000E\000"
+ "K\000E\000M\000\026\000I\000<\000N\0009\000N\000N\000O\0009\000O\000<\000"
+ "F\000F\000N\000M\000N\000E\000N\000L\000O\000M\000O\000+\000P\000\017\000"
+ "P\000\020\000P\000)\000Q\000+\000Q\000P\000Q\000R\000S\000P\000S\000P\000"
+ "R\000Q\000R\000\023\000S\000\020\000S\000@\000T\000%\000T\000&\000T\000="
+ "\000U\000@\000U\000T\000U\000Q\000T\000R\000T\000R\000U\000&\000Q\000O\000"
+ "V\0009\000V\000:\000V\000L\000W\000O\000W\000V\000W\000U\000V\000R\000V\000"
+ "R\000W\000:\000U\000\030\000X\000\025\000X\000J\000X\000\030\000S\000S\000"
+ "X\000W\000X\000R\000X\000J\000W\000\001\000Y\000Y\000Z\000\001\000Z\000\002"
+ "\000Z\000Y\000[\000[\000\134\000Y\000\134\000Z\000\134\000]\000^\000Z\000"
+ "^\000Z\000]\000\134\000]\000\004\000^\000\002\000^\000_\000`\000`\000a\000"
+ "_\000a\000a\000b\000_\000b\000c\000d\000b\000d\000b\000c\000a\000c\000]\000"
+ "d\000\134\000d\000\134\000b\000[\000_\000[\000b\000e\000f\000f\000g\000e"
+ "\000g\000g\000h\000e\000h\000i\000j\000h\000j\000h\000i\000g\000i\000]\000"
+ "j\000d\000j\000d\000h\000c\000e\000c\000h\000\011\000k\000\012\000k\000k"
+ "\000l\000\012\000l\000\011\000^\000^\000k\000j\000k\000]\000k\000i\000l\000"
+ "j\000l\0003\000m\000m\000n\0003\000n\000A\000n\000m\000o\000o\000p\000m\000"
+ "p\000n\000p\000q\000r\000n\000r\000n\000q\000p\000q\000C\000r\000A\000r\000"
+ "s\000t\000t\000u\000s\000u\000u\000v\000s\000v\000w\000x\000v\000x\000v\000"
+ "w\000u\000w\000q\000x\000p\000x\000p\000v\000o\000s\000o\000v\000_\000y\000"
+ "`\000y\000y\000z\000`\000z\000[\000{\000_\000{\000y\000{\000x\000y\000q\000"
+ "y\000q\000{\000w\000z\000x\000z\000H\000Y\000H\000|\000Y\000|\000r\000|\000"
+ "C\000|\000r\000{\000{\000|\000[\000|\000\037\000}\000 \000}\000}\000~\000"
+ " \000~\000\033\000\177\000\037\000\177\000}\000\177\000\200\000\201\000}"
+ "\000\201\000}\000\200\000\177\000\200\000\201\000\202\000~\000\202\000~\000"
+ "\201\000\031\000l\000l\000\203\000\031\000\203\000i\000\204\000\203\000\204"
+ "\000i\000\203\000\200\000\204\000\177\000\204\000\177\000\203\000\033\000"
+ "\203\000f\000\205\000\205\000\206\000f\000\206\000g\000\206\000\205\000\207"
+ "\000\207\000\210\000\205\000\210\000\206\000\210\000\204\000\206\000\200"
+ "\000\206\000\200\000\210\000g\000\204\000\211\000\212\000\212\000\213\000"
+ "\211\000\213\000\213\000\214\000\211\000\214\000\201\000\214\000\202\000"
+ "\214\000\202\000\213\000\201\000\210\000\210\000\214\000\207\000\211\000"
+ "\207\000\214\0006\000m\0006\000\215\000m\000\215\000/\000\216\000\215\000"
+ "\216\000/\000\215\000\216\000\217\000\217\000\220\000\216\000\220\000\215"
+ "\000\220\000o\000\215\000o\000\220\000-\000~\000~\000\221\000-\000\221\000"
+ "\202\000\222\000\221\000\222\000\202\000\221\000\217\000\222\000\216\000"
+ "\222\000\216\000\221\000/\000\221\000\212\000\223\000\223\000\224\000\212"
+ "\000\224\000\213\000\224\000\223\000\225\000\225\000\226\000\223\000\226"
+ "\000\224\000\226\000\222\000\224\000\217\000\224\000\217\000\226\000\213"
+ "\000\222\000s\000\227\000t\000\227\000\227\000\230\000t\000\230\000s\000"
+ "\220\000\220\000\227\000\226\000\227\000\217\000\227\000\225\000\230\000"
+ "\226\000\230\000\231\000\232\000\232\000\233\000\231\000\233\000\233\000"
+ "\234\000\231\000\234\000\235\000\236\000\234\000\236\000\234\000\235\000"
+ "\233\000\235\000\236\000\237\000\237\000\240\000\236\000\240\000\234\000"
+ "\240\000\231\000\241\000\234\000\241\000\240\000\241\000\242\000\243\000"
+ "\243\000\244\000\242\000\244\000\244\000\245\000\242\000\245\000\246\000"
+ "\247\000\245\000\247\000\245\000\246\000\244\000\246\000\237\000\247\000"
+ "\236\000\247\000\236\000\245\000\235\000\242\000\235\000\245\000z\000\250"
+ "\000`\000\250\000\250\000\251\000`\000\251\000w\000\252\000z\000\252\000"
+ "\250\000\252\000\247\000\250\000\237\000\250\000\237\000\252\000\246\000"
+ "\251\000\247\000\251\000t\000\253\000\253\000\254\000t\000\254\000u\000\254"
+ "\000\241\000\253\000\240\000\253\000\240\000\254\000\252\000\254\000\237"
+ "\000\254\000u\000\252\000\232\000\255\000\231\000\255\000\231\000\256\000"
+ "\255\000\256\000\241\000\257\000\256\000\257\000\241\000\256\000\257\000"
+ "\260\000\260\000\261\000\257\000\261\000\256\000\261\000\255\000\262\000"
+ "\256\000\262\000\261\000\262\000\230\000\253\000\230\000\263\000\253\000"
+ "\263\000\225\000\264\000\263\000\264\000\225\000\263\000\257\000\263\000"
+ "\260\000\263\000\260\000\264\000\253\000\257\000\212\000\265\000\223\000"
+ "\265\000\265\000\266\000\223\000\266\000\265\000\267\000\267\000\270\000"
+ "\265\000\270\000\266\000\270\000\264\000\266\000\260\000\266\000\260\000"
+ "\270\000\225\000\266\000\271\000\272\000\272\000\273\000\271\000\273\000"
+ "\273\000\274\000\271\000\274\000\261\000\274\000\262\000\274\000\262\000"
+ "\273\000\261\000\270\000\270\000\274\000\267\000\271\000\267\000\274\000"
+ "\272\000\275\000\271\000\275\000\271\000\276\000\275\000\276\000\267\000"
+ "\277\000\276\000\277\000\267\000\276\000\277\000\300\000\300\000\301\000"
+ "\277\000\301\000\276\000\301\000\275\000\302\000\276\000\302\000\301\000"
+ "\302\000\211\000\303\000\212\000\303\000\265\000\303\000\207\000\304\000"
+ "\211\000\304\000\303\000\304\000\277\000\303\000\300\000\303\000\300\000"
+ "\304\000\265\000\277\000f\000\305\000\305\000\306\000f\000\306\000\205\000"
+ "\306\000\305\000\307\000\307\000\310\000\305\000\310\000\306\000\310\000"
+ "\304\000\306\000\300\000\306\000\300\000\310\000\205\000\304\000\311\000"
+ "\312\000\312\000\313\000\311\000\313\000\313\000\314\000\311\000\314\000"
+ "\301\000\314\000\302\000\314\000\302\000\313\000\301\000\310\000\310\000"
+ "\314\000\307\000\311\000\307\000\314\000\312\000\315\000\311\000\315\000"
+ "\311\000\316\000\315\000\316\000\307\000\317\000\316\000\317\000\307\000"
+ "\316\000\317\000\320\000\320\000\321\000\317\000\321\000\316\000\321\000"
+ "\315\000\322\000\316\000\322\000\321\000\322\000e\000\323\000f\000\323\000"
+ "\305\000\323\000c\000\324\000e\000\324\000\323\000\324\000\317\000\323\000"
+ "\320\000\323\000\320\000\324\000\305\000\317\000\251\000\325\000`\000\325"
+ "\000a\000\325\000\246\000\326\000\251\000\326\000\325\000\326\000\324\000"
+ "\325\000\320\000\325\000\320\000\326\000a\000\324\000\243\000\327\000\244"
+ "\000\327\000\327\000\330\000\244\000\330\000\321\000\330\000\322\000\330"
+ "\000\322\000\327\000\321\000\326\000\326\000\330\000\246\000\330\000\315"
+ "\000\331\000\312\000\331\000\331\000\332\000\312\000\332\000\322\000\333"
+ "\000\315\000\333\000\331\000\333\000\334\000\335\000\331\000\335\000\331"
+ "\000\334\000\333\000\334\000\335\000\336\000\332\000\336\000\332\000\335"
+ "\000\243\000\337\000\337\000\340\000\243\000\340\000\327\000\340\000\337"
+ "\000\341\000\341\000\342\000\337\000\342\000\340\000\342\000\333\000\340"
+ "\000\334\000\340\000\334\000\342\000\327\000\333\000\343\000\344\000\344"
+ "\000\345\000\343\000\345\000\345\000\346\000\343\000\346\000\347\000\350"
+ "\000\345\000\350\000\345\000\347\000\344\000\347\000\342\000\345\000\334"
+ "\000\345\000\334\000\350\000\341\000\346\000\342\000\346\000\351\000\352"
+ "\000\352\000\353\000\351\000\353\000\353\000\354\000\351\000\354\000\336"
+ "\000\352\000\335\000\352\000\335\000\353\000\350\000\353\000\334\000\353"
+ "\000\347\000\354\000\347\000\353\000\242\000\355\000\243\000\355\000\337"
+ "\000\355\000\235\000\356\000\242\000\356\000\355\000\356\000\357\000\360"
+ "\000\355\000\360\000\355\000\357\000\356\000\357\000\341\000\360\000\337"
+ "\000\360\000\232\000\361\000\361\000\362\000\232\000\362\000\233\000\362"
+ "\000\361\000\363\000\363\000\364\000\361\000\364\000\362\000\364\000\356"
+ "\000\362\000\357\000\362\000\357\000\364\000\233\000\356\000\365\000\366"
+ "\000\366\000\367\000\365\000\367\000\367\000\370\000\365\000\370\000\371"
+ "\000\372\000\367\000\372\000\367\000\371\000\366\000\371\000\364\000\367"
+ "\000\357\000\367\000\357\000\372\000\363\000\370\000\364\000\370\000\346"
+ "\000\373\000\343\000\373\000\373\000\374\000\343\000\374\000\346\000\360"
+ "\000\360\000\373\000\372\000\373\000\357\000\373\000\371\000\374\000\371"
+ "\000\373\000\255\000\375\000\232\000\375\000\361\000\375\000\262\000\376"
+ "\000\255\000\376\000\375\000\376\000\377\000\000\001\375\000\000\001\375"
+ "\000\377\000\376\000\377\000\363\000\000\001\361\000\000\001\272\000\001"
+ "\001\001\001\002\001\272\000\002\001\273\000\002\001\001\001\003\001\003"
+ "\001\004\001\001\001\004\001\002\001\004\001\376\000\002\001\377\000\002"
+ "\001\377\000\004\001\273\000\376\000\005\001\006\001\006\001\007\001\005"
+ "\001\007\001\007\001\010\001\005\001\010\001\011\001\012\001\007\001\012"
+ "\001\007\001\011\001\006\001\011\001\004\001\007\001\377\000\007\001\377"
+ "\000\012\001\003\001\010\001\004\001\010\001\370\000\013\001\365\000\013"
+ "\001\013\001\014\001\365\000\014\001\370\000\000\001\000\001\013\001\012"
+ "\001\013\001\377\000\013\001\011\001\014\001\011\001\013\001\275\000\015"
+ "\001\272\000\015\001\001\001\015\001\302\000\016\001\275\000\016\001\015"
+ "\001\016\001\017\001\020\001\015\001\020\001\015\001\017\001\016\001\017"
+ "\001\003\001\020\001\001\001\020\001\332\000\021\001\312\000\021\001\313"
+ "\000\021\001\336\000\022\001\332\000\022\001\021\001\022\001\016\001\021"
+ "\001\017\001\021\001\017\001\022\001\313\000\016\001\351\000\023\001\023"
+ "\001\024\001\351\000\024\001\352\000\024\001\025\001\026\001\024\001\026"
+ "\001\024\001\025\001\023\001\025\001\022\001\024\001\017\001\024\001\017"
+ "\001\026\001\352\000\022\001\010\001\027\001\005\001\027\001\027\001\030"
+ "\001\005\001\030\001\010\001\020\001\020\001\027\001\026\001\027\001\017"
+ "\001\027\001\025\001\030\001\025\001\027\001\374\000\031\001\343\000\031"
+ "\001\344\000\031\001\371\000\032\001\374\000\032\001\031\001\032\001\033"
+ "\001\034\001\031\001\034\001\031\001\033\001\032\001\033\001\347\000\034"
+ "\001\344\000\034\001\014\001\035\001\365\000\035\001\366\000\035\001\011"
+ "\001\036\001\014\001\036\001\035\001\036\001\032\001\035\001\033\001\035"
+ "\001\033\001\036\001\366\000\032\001\030\001\037\001\005\001\037\001\006"
+ "\001\037\001\025\001 \001\030\001 \001\037\001 \001\036\001\037\001\033\001"
+ "\037\001\033\001 \001\006\001\036\001\354\000!\001\351\000!\001\023\001!"
+ "\001\354\000\034\001\034\001!\001 \001!\001\033\001!\001\023\001 \001"
+;
+const unsigned long s1_6_size = 9892;
@@ -1,505 +1,306 @@
+/* Generated from "s1_b.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
+
 #include "gllist.h"
-static const float data[]={
-	-0.137893,0.043508,-0.125711,
-	-0.095845,-0.165656,0.072892,
-	-0.093165,0.152051,0.327744,
-	-0.003795,0.001470,-0.102225,
-	0.152845,-0.430757,-0.031907,
-	-0.118828,0.399389,0.091047,
-	-0.169137,-0.181241,-0.288763,
-	0.048660,0.018262,-0.035049,
-	0.008859,0.208004,-0.059048,
-	-0.009212,-0.042229,-0.000692,
-	-0.040025,0.115695,0.178962,
-	-0.198525,0.018630,0.257202,
-	0.205081,-0.244569,0.136314,
-	-0.214336,-0.149946,-0.006872,
-	0.245675,-0.227316,-0.184201,
-	-0.001494,0.259139,-0.260652,
-	0.070243,0.038750,0.069425,
-	-0.033229,-0.259151,0.298856,
-	0.088773,-0.065324,0.260294,
-	0.009195,0.078651,0.055543,
-	-0.090795,0.025672,0.056988,
-	-0.163707,-0.011627,-0.096395,
-	0.068886,0.257031,-0.264175,
-	-0.018086,-0.285526,0.152989,
-	-0.017489,0.031671,0.000107,
-	-0.075583,-0.097617,0.030074,
-	0.129221,-0.087628,0.171748,
-	-0.007530,-0.084194,0.186045,
-	0.474638,0.004818,0.200460,
-	0.016796,0.096614,-0.221351,
-	0.187032,0.031017,0.039986,
-	-0.142119,-0.105297,-0.100849,
-	0.142768,-0.313960,-0.349716,
-	-0.146805,0.140482,0.035653,
-	0.039939,-0.051822,-0.017672,
-	0.057111,-0.075686,-0.103478,
-	0.049696,-0.135070,0.055097,
-	0.030271,0.075412,-0.103571,
-	0.100158,-0.022917,0.073895,
-	0.085544,-0.273613,0.092456,
-	0.077489,-0.309836,-0.003664,
-	-0.017590,-0.127869,0.153118,
-	-0.157014,-0.242184,0.070478,
-	-0.018167,-0.133639,-0.174937,
-	-0.106973,-0.189783,0.038622,
-	-0.000096,0.104429,-0.032589,
-	-0.032036,-0.021493,0.279829,
-	-0.093181,-0.058024,0.182239,
-	0.012941,-0.010409,0.088080,
-	0.256718,-0.118137,-0.078847,
-	-0.113382,0.135060,0.269946,
-	0.175810,-0.026321,0.013860,
-	-0.110606,-0.023553,-0.255525,
-	0.007163,0.068674,0.010214,
-	0.031631,-0.170381,-0.174604,
-	0.117242,0.014353,-0.021215,
-	0.090315,0.161755,0.074427,
-	0.285616,0.335824,-0.083891,
-	-0.145763,0.109292,0.121340,
-	-0.147459,-0.041936,0.010427,
-	-0.082626,0.151300,-0.030875,
-	0.217154,-0.288504,-0.202483,
-	0.026532,-0.106796,0.121041,
-	0.046695,-0.033673,-0.043721,
-	0.135596,0.217426,-0.219631,
-	0.137627,0.026335,-0.082390,
-	-0.031665,-0.115897,0.077834,
-	-0.214922,-0.162169,0.073035,
-	-0.076108,0.200481,0.036119,
-	0.012715,-0.161921,0.179804,
-	0.140409,-0.165899,-0.005149,
-	-0.054606,0.011149,0.045768,
-	0.116640,-0.180314,0.045320,
-	0.342166,0.295895,-0.049250,
-	-0.133242,0.129064,0.136969,
-	0.137520,-0.387145,0.132137,
-	0.023302,0.194298,-0.066187,
-	0.089302,0.128683,-0.072530,
-	-0.141374,0.035924,-0.079354,
-	-0.209233,0.018987,-0.004193,
-	0.156295,-0.034087,0.344315,
-	-0.005946,0.039791,0.071862,
-	0.076043,-0.094430,0.090122,
-	0.127394,0.031466,-0.028015,
-	-0.061000,0.169741,-0.127635,
-	-0.015117,-0.160883,-0.095443,
-	-0.185998,-0.182942,0.056857,
-	0.016499,-0.308118,-0.075513,
-	0.024971,-0.301226,-0.027251,
-	-0.035944,0.061566,0.013883,
-	0.007215,0.046198,-0.227891,
-	0.189165,0.079471,-0.067849,
-	0.026963,0.027982,-0.050419,
-	-0.050896,0.069604,-0.196938,
-	0.064274,-0.205263,0.297868,
-	-0.047543,0.147822,0.166593,
-	0.010318,-0.002148,0.029434,
-	0.036107,-0.523568,-0.118442,
-	-0.199410,0.233526,-0.161289,
-	-0.047441,-0.013973,0.112998,
-	-0.043494,-0.181796,0.065864,
-	-0.074984,0.177758,-0.156470,
-	0.225216,0.081058,-0.169876,
-	-0.041510,0.025763,-0.231350,
-	0.259015,0.274641,0.018290,
-	0.039196,0.010028,0.072771,
-	0.031646,0.075290,0.039258,
-	0.052930,-0.034809,0.165429,
-	-0.072511,0.095786,-0.222144,
-	0.038706,0.032296,-0.002495,
-	0.011675,-0.061944,0.082555,
-	-0.168400,0.074113,0.049321,
-	0.001263,-0.207436,0.013949,
-	-0.027045,0.015697,-0.047831,
-	0.121989,-0.043014,-0.004426,
-	0.238374,-0.320060,-0.111754,
-	0.095077,0.014640,0.070665,
-	-0.084367,0.016444,0.000788,
-	-0.117804,0.113550,0.087029,
-	-0.109080,-0.155795,0.040085,
-	-0.020370,0.118787,0.101787,
-	0.140877,-0.144829,0.107720,
-	-0.247002,-0.454632,0.070535,
-	-0.016278,-0.111440,0.270110,
-	-0.017624,-0.146232,0.154626,
-	0.214030,0.041025,-0.170250,
-	0.010009,-0.159290,-0.076895,
-	0.116168,0.156775,-0.077935,
-	0.199355,0.081120,0.003352,
-	0.054178,-0.036863,-0.004573,
-	-0.015149,0.057005,-0.008878,
-	0.374758,-0.007823,-0.078051,
-	-0.034977,0.026837,0.035441,
-	0.101867,0.121954,0.040450,
-	-0.136911,0.010061,0.082698,
-	0.121665,-0.589852,0.106401,
-	-0.064574,0.098679,0.059336,
-	0.103037,-0.075263,0.172586,
-	-0.217492,-0.170584,-0.025846,
-	0.260366,0.002117,0.041535,
-	-0.024112,-0.023437,-0.088146,
-	-0.007767,0.061738,0.116208,
-	0.253471,0.113278,0.231012,
-	-0.011399,0.116962,-0.037465,
-	0.233898,0.226108,0.077176,
-	-0.004640,0.209191,-0.091738,
-	0.093995,0.328937,0.245098,
-	0.155739,-0.327971,-0.115265,
-	0.125306,0.174931,0.130030,
-	0.005005,-0.022310,0.120651,
-	0.046982,-0.058839,-0.097958,
-	-0.059618,-0.068114,0.070137,
-	0.053184,-0.081163,0.000020,
-	0.188066,-0.082942,-0.013689,
-	-0.161390,-0.335891,-0.060737,
-	0.131189,0.036733,-0.093511,
-	-0.002496,-0.059035,-0.084055,
-	0.109820,-0.235531,0.130865,
-	0.018909,0.062351,0.111532,
-	0.123548,0.094008,0.056761,
-	0.106710,-0.049834,-0.147748,
-	0.102940,-0.113169,0.191710,
-	-0.028647,0.128038,-0.104189,
-	0.107226,-0.220633,-0.147310,
-	-0.205747,0.063433,-0.026135,
-	-0.064614,0.096963,-0.080108,
-	-0.083255,0.113008,-0.089852,
-	0.180961,-0.269100,0.115523,
-	0.044722,-0.023285,0.024813,
-	0.078986,0.037242,0.005124,
-	0.115141,0.124478,-0.034603,
-	0.022454,0.155937,-0.096183,
-	0.175318,0.007233,-0.138507,
-	0.019182,-0.037869,0.074242,
-	0.058218,0.212269,-0.003886,
-	-0.188525,-0.075703,0.075643,
-	-0.029085,-0.076746,-0.273473,
-	-0.105590,-0.238524,-0.087465,
-	0.086122,-0.340807,-0.192851,
-	-0.247936,-0.003160,0.082106,
-	0.137988,-0.041876,-0.012086,
-	-0.140714,-0.138827,-0.064179,
-	-0.059380,0.015642,0.113841,
-	-0.031501,0.007130,-0.125767,
-	0.021294,-0.021957,-0.069365,
-	-0.012419,0.019780,-0.077459,
-	0.085524,0.087513,-0.107484,
-	-0.303263,0.263672,-0.220649,
-	-0.090267,-0.376337,-0.127634,
-	0.087681,0.015985,-0.029860,
-	0.119257,0.140347,0.194003,
-	0.066270,0.127178,-0.003765,
-	0.037563,-0.110829,0.000382,
-	0.034295,-0.045737,0.045204,
-	0.017365,-0.072708,0.056698,
-	0.045238,0.187956,-0.055878,
-	-0.132755,0.017969,-0.041205,
-	0.189702,-0.020780,-0.077422,
-	0.210419,0.178041,-0.005855,
-	0.104527,-0.304323,0.002581,
-	0.043359,-0.060695,-0.011878,
-	-0.000267,0.020510,-0.046383,
-	0.252891,0.074246,-0.047689,
-	-0.069874,0.118962,-0.052781,
-	0.086188,0.068354,-0.213621,
-	0.086637,-0.171519,0.006447,
-	0.196785,-0.086044,-0.068059,
-	0.100401,0.243886,-0.142258,
-	0.173010,0.303375,-0.060085,
-	-0.041181,-0.097467,0.073776,
-	-0.013471,-0.133299,-0.143570,
-	-0.302092,-0.158342,0.230719,
-	0.074434,-0.143530,0.294895,
-	-0.165626,0.200869,-0.130737,
-	0.102444,0.277067,0.078210,
-	-0.183696,-0.010502,-0.150481,
-	-0.070029,-0.019635,-0.059141,
-	-0.005930,0.069199,-0.013126,
-	-0.119333,-0.007972,0.119489,
-	0.033072,0.081756,-0.034481,
-	-0.108282,-0.065310,0.146009,
-	0.080950,0.111320,0.004291,
-	0.071208,-0.112941,0.028135,
-	-0.024632,0.190525,-0.285626,
-	-0.105040,0.044008,0.020236,
-	-0.017815,-0.076684,-0.065840,
-	0.083563,0.100873,-0.141154,
-	-0.062066,-0.010894,0.066110,
-	-0.056763,0.024777,-0.176209,
-	-0.014442,0.052861,0.013010,
-	-0.157546,-0.118279,-0.237648,
-	-0.234497,-0.158049,0.102635,
-	0.061685,-0.052695,-0.042243,
-	0.093961,-0.025060,0.046602,
-	0.004395,0.150912,0.191784,
-	0.067299,-0.059575,0.161018,
-	-0.233155,-0.109721,0.194653,
-	0.217444,0.221231,-0.201241,
-	-0.033689,-0.341937,-0.099231,
-	0.042771,-0.028862,0.067736,
-	0.110240,0.274029,-0.157689,
-	-0.055994,0.144729,0.090901,
-	0.211192,0.058165,-0.149872,
-	0.102735,-0.044061,-0.044795,
-	-0.042153,-0.010955,0.014341,
-	-0.011649,0.099072,-0.086419,
-	-0.018920,0.000640,-0.031729,
-	-0.216886,-0.057512,0.071195,
-	-0.188150,0.049292,0.258489,
-	-0.023494,0.021489,0.199785,
-	-0.045818,0.066753,-0.035593,
-	0.010986,0.166767,0.275085,
-	-0.177039,0.010372,0.167936,
-	-0.423239,0.027466,-0.126114,
-	-0.102035,0.282640,0.022622,
-	-0.023997,0.176943,0.093272,
-	-0.090009,0.015338,0.250857,
-	0.011095,0.006703,0.057076,
-	0.133423,0.234639,-0.070260,
-	-0.295994,0.185615,0.117148,
-	0.235480,0.066195,0.078641,
-	-0.026545,0.093931,0.008019,
-	0.181656,-0.088719,0.045959,
-	-0.076308,-0.164584,0.018271,
-	0.092026,0.201866,-0.106051,
-	0.019876,0.050967,0.176081,
-	-0.018546,0.138749,-0.008255,
-	-0.026049,-0.068465,-0.055467,
-	-0.260245,0.221833,-0.048541,
-	-0.169783,0.354992,-0.017943,
-	-0.306063,0.074787,0.101971,
-	0.215973,0.107558,-0.008808,
-	0.390235,-0.275652,-0.117085,
-	0.033898,0.046047,-0.108977,
-	-0.263507,-0.091765,-0.250234,
-	-0.044613,0.149563,0.027937,
-	-0.015397,-0.040254,0.065692,
-	-0.017531,-0.013504,0.004021,
-	0.054665,-0.018996,-0.006954,
-	0.033068,0.219349,-0.194079,
-	-0.057780,0.011881,0.084904,
-	0.139243,-0.109890,0.039145,
-	0.223272,0.208110,0.165882,
-	-0.008046,0.103847,0.278718,
-	-0.035499,0.112662,-0.088418,
-	-0.053118,0.053871,-0.054706,
-	0.118632,0.086431,-0.022494,
-	0.014943,0.039622,0.047307,
-	0.006570,0.093461,0.058982,
-	0.031448,0.325716,-0.047305,
-	-0.193710,0.087226,0.051790,
-	0.116154,-0.080023,-0.106643,
-	0.156514,-0.222710,0.275425,
-	-0.084294,-0.101851,0.425222,
-	0.030344,-0.141370,-0.282460,
-	0.003022,0.108996,-0.229152,
-	-0.133040,0.061025,-0.128942,
-	-0.077348,0.013363,-0.072511,
-	-0.050317,0.452190,0.094114,
-	0.053309,-0.143722,0.249884,
-	-0.257016,0.100544,0.012236,
-	-0.022056,-0.212133,0.023533,
-	0.153299,0.031763,0.034577,
-	0.161729,0.084914,0.050770,
-	0.320438,0.112175,0.135015,
-	-0.040717,0.073400,0.080543,
-	-0.226004,0.143154,0.170139,
-	0.009756,0.068337,0.132111,
-	0.380191,0.233715,0.026664,
-	-0.018016,0.265426,-0.110691,
-	0.041281,0.056674,-0.119834,
-	0.170794,-0.112611,0.094839,
-	0.216318,0.002081,0.154653,
-	-0.036815,0.024332,0.172587,
-	-0.064554,0.160699,0.101229,
-	0.114451,0.016039,0.293489,
-	0.023010,-0.028932,0.014800,
-	-0.290527,0.172553,0.129526,
-	-0.048159,-0.181222,0.305871,
-	0.065351,-0.399962,-0.030479,
-	0.334123,-0.120149,0.241310,
-	-0.203728,-0.155627,0.140805,
-	0.061022,-0.016097,0.131688,
-	0.045050,-0.313782,-0.279077,
-	0.034252,-0.135512,-0.087765,
-	0.276236,0.036449,0.418332,
-	-0.122146,0.050998,0.131453,
-	-0.087629,0.330142,0.061353,
-	0.228676,0.093309,-0.009307,
-	0.435264,0.186185,-0.127484,
-	0.156565,0.013842,-0.103874,
-	-0.274053,-0.084119,0.096687,
-	-0.027947,-0.051152,-0.078997,
-	0.013399,0.194440,0.072030,
-	0.000082,0.130666,0.052218,
-	0.064984,-0.136859,0.092204,
-	0.109060,0.424779,-0.111867,
-	0.061748,0.160827,-0.068538,
-	0.062960,0.059638,-0.181514,
-	0.018961,0.072298,0.003517,
-	-0.099508,-0.225455,-0.021791,
-	0.001955,-0.320555,0.159506,
-	-0.057735,-0.054327,-0.095525,
-	0.319748,-0.146158,-0.198384,
-	-0.158741,-0.265443,0.036635,
-	-0.093089,-0.358379,-0.110549,
-	-0.049805,0.022246,-0.036724,
-	0.223000,0.247522,-0.232652,
-	-0.249441,-0.248325,-0.071169,
-	0.000369,0.094598,-0.162153,
-	-0.133873,-0.188473,0.272734,
-	0.046594,0.069766,0.015561,
-	0.111582,-0.239786,0.034658,
-	0.093232,0.183507,-0.011298,
-	-0.226805,0.514871,-0.064144,
-	0.085949,0.031412,0.042790,
-	-0.043755,-0.290797,-0.159142,
-	0.056671,0.167837,0.016536,
-	-0.034538,0.072185,0.066973,
-	-0.021211,0.064120,-0.174756,
-	0.090627,-0.055253,0.109457,
-	0.019686,0.004469,-0.096316,
-	-0.038864,-0.135083,0.244529,
-	0.034613,-0.069587,0.144533,
-	-0.100009,-0.057516,-0.079338,
-	-0.178026,0.085994,0.061804,
-	-0.189256,0.342739,0.043372,
-	-0.046206,0.168946,-0.133904,
-	0.015314,-0.090127,-0.058530,
-	0.169657,-0.097086,0.013746,
-	0.185131,-0.089445,0.347806,
-	-0.264432,-0.170170,-0.335858,
-	-0.086511,0.248252,-0.169698,
-	0.002287,-0.028338,-0.266432,
-	-0.085060,0.001974,-0.032789,
-	0.192750,-0.007081,0.098197,
-	0.012577,0.034983,-0.003058,
-	-0.039249,0.038498,0.067306,
-	0.021988,0.379705,-0.054619,
-	-0.151707,0.051034,-0.016003,
-	-0.057048,0.075729,-0.213397,
-	-0.137847,0.130600,0.046198,
-	0.024786,0.049556,-0.045772,
-	-0.082533,0.155397,-0.096145,
-	0.049152,0.270979,-0.147022,
-	0.061153,-0.104531,-0.103623,
-	-0.142997,-0.232885,0.040538,
-	0.048806,-0.013095,-0.003505,
-	-0.095063,0.241414,-0.202255,
-	0.108558,-0.147584,0.162682,
-	0.217105,0.252340,-0.114830,
-	-0.188028,0.417252,-0.077456,
-	-0.112855,0.105192,0.073968,
-	-0.186972,0.164022,-0.073415,
-	-0.074349,-0.324874,-0.056645,
-	0.327855,-0.271424,-0.141142,
-	0.151049,0.155239,-0.083116,
-	0.035395,-0.133176,-0.095112,
-	0.127283,-0.011837,0.199750,
-	-0.120775,0.103698,0.063302,
-	0.014222,0.198468,0.137537,
-	-0.269656,0.120644,-0.153958,
-	-0.136743,-0.119817,-0.073747,
-	-0.068156,-0.138484,0.033507,
-	-0.106835,0.114964,0.023924,
-	-0.222525,0.330321,-0.007431,
-	-0.011739,0.095156,0.139086,
-	0.146766,0.037685,0.136122,
-	-0.086532,-0.081295,0.009434,
-	0.189439,0.290592,-0.048317,
-	0.139152,0.224931,0.355509,
-	0.017162,-0.016825,0.094198,
-	-0.237595,0.205475,-0.041412,
-	0.050511,0.094900,0.252891,
-	-0.012538,-0.014082,0.064629,
-	-0.059810,0.020665,-0.260979,
-	0.073490,-0.242270,0.085847,
-	0.049499,-0.045617,-0.015894,
-	-0.121040,0.004350,0.381603,
-	-0.062798,0.055006,0.077472,
-	-0.156846,-0.033342,0.035284,
-	0.105383,0.002776,-0.046394,
-	0.247612,0.310528,0.046188,
-	-0.144567,-0.197996,0.083309,
-	-0.317845,-0.014793,-0.041608,
-	-0.169858,0.102631,0.283962,
-	-0.168757,0.093105,0.050325,
-	-0.013639,0.285100,0.047089,
-	0.216644,0.102018,0.031983,
-	0.046988,0.081482,0.021865,
-	0.124995,-0.193086,0.127870,
-	0.009153,0.178713,-0.077949,
-	-0.235371,-0.046817,-0.125764,
-	-0.089381,0.289172,-0.129356,
-	0.312993,0.120426,0.296957,
-	-0.106431,0.117096,0.156971,
-	0.030001,0.244577,0.085119,
-	0.002958,-0.035469,-0.084615,
-	-0.052248,-0.004298,-0.129170,
-	-0.158458,0.059061,-0.041780,
-	-0.007117,-0.174211,0.098819,
-	-0.158387,0.060840,-0.064818,
-	0.117241,-0.050754,-0.027945,
-	-0.014301,0.146402,-0.118414,
-	0.186611,-0.162182,-0.150909,
-	-0.106992,0.286109,-0.055512,
-	0.109689,-0.346409,0.072611,
-	-0.009694,-0.038102,0.098565,
-	-0.034598,0.323300,0.020962,
-	-0.149219,0.040596,-0.114206,
-	0.164744,0.048081,0.105464,
-	0.036214,0.099523,0.038595,
-	0.056537,0.036271,0.003042,
-	-0.157110,0.001614,-0.133994,
-	-0.104357,-0.032004,0.262334,
-	0.041215,-0.010418,-0.037968,
-	0.223491,-0.387946,0.117291,
-	-0.344434,0.110318,-0.031448,
-	0.123562,-0.315729,0.164533,
-	0.008207,0.042004,0.050014,
-	-0.191339,-0.069291,-0.220065,
-	0.023845,0.009474,0.035598,
-	-0.173295,-0.036604,-0.193323,
-	-0.040347,-0.106063,-0.055559,
-	-0.071543,0.136487,0.105697,
-	-0.179027,-0.071852,0.117512,
-	0.064769,-0.345895,0.012833,
-	0.044800,-0.032357,-0.042161,
-	0.243586,0.392499,-0.180641,
-	-0.148924,-0.181446,0.146644,
-	-0.042773,0.045843,-0.176893,
-	0.025938,0.058109,0.242063,
-	-0.028489,-0.024828,0.161289,
-	0.073899,-0.081205,-0.023751,
-	0.026149,0.051399,-0.072348,
-	0.024308,-0.041819,-0.030578,
-	-0.077778,0.010272,0.066967,
-	-0.139184,-0.018983,0.035150,
-	-0.061359,-0.152358,-0.072849,
-	0.043101,0.028278,0.077387,
-	0.065599,-0.049676,0.043708,
-	-0.255767,0.023510,-0.076982,
-	0.020468,-0.040630,0.208424,
-	0.044922,0.025184,0.004764,
-	0.107432,-0.009356,0.239863,
-	-0.005475,0.158400,0.089743,
-	0.018352,0.134559,0.221650,
-	0.094423,0.129390,-0.031274,
-	0.048541,0.100595,-0.155938,
-	-0.016298,-0.036518,-0.149178,
-	-0.329953,-0.327602,-0.150086,
-	0.148403,-0.363334,0.028237,
-	-0.305790,-0.009844,-0.075571,
-	-0.045131,0.152595,0.228720,
-	0.039725,-0.127469,0.066522,
-	-0.078576,-0.349749,-0.146881,
-	0.013160,-0.040312,0.129980,
-	0.221142,-0.106068,0.254967,
-	0.180912,-0.207357,-0.196999,
-	0.098219,0.085231,0.121963,
-};
-static const struct gllist frame={GL_V3F,GL_POINTS,500,data,NULL};
-const struct gllist *s1_b=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char s1_b[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\000\000\000\000\364\001\000\000\364\001\000\000\000\000\000\000"
+ "\302\207\322<\243\217\031\275\344\242\032=\253h\2157\027\332\305\022\037"
+ "\332\000\000\326\343M\342%\010\000\000u\344\354+3C\000\000*\371\007\011\220"
+ "\337\000\000v\035\337\244\334\357\000\000\202\336<eY\014\000\000\332\322"
+ "\260\336W\264\000\000R\005\353\014!\357\000\000\031\374\3438\222\351\000"
+ "\000\351\367\347\376\027\367\000\000\305\360\177#\271 \000\000\013\314\001"
+ "\015\3322\000\000\221)\004\320\327\026\000\000a\310\361\345\251\365\000\000"
+ "\3712\003\324\221\314\000\000\263\371\275D\332\272\000\000R\012\253\021W"
+ "\007\000\000X\362\243\314\201<\000\000\236\016\215\371\2223\000\000-\374"
+ "\352\032\037\004\000\000\001\345\243\016u\004\000\000\034\324\376\005\352"
+ "\340\000\000\002\012@D\011\272\000\000\333\365\206\306\264\032\000\000\376"
+ "\365\007\020G\367\000\000\210\350\021\3628\376\000\000\375\027b\364\015\037"
+ "\000\000M\370-\365]\042\000\000\010h\316\011\264%\000\000\360\375\023\037"
+ "\366\303\000\000c%\340\017\204\000\000\000\035\331J\360\342\337\000\000!"
+ "\033\357\2777\246\000\000\007\330>)\203\377\000\000M\003\256\374(\363\000"
+ "\000G\007&\367F\337\000\000\220\005c\351\005\004\000\000\017\001*\032@\337"
+ "\000\000A\021a\003`\010\000\000\336\015I\311\255\014\000\000\000\014\344"
+ "\300g\366\000\000\370\365\017\353\274\032\000\000\251\325\221\320\225\007"
+ "\000\000\326\365\270\351\267\316\000\000B\341\266\3344\000\000\000\006\372"
+ "\343 \263\357\000\000\237\362\265\003\0308\000\000t\344>\373{!\000\000\013"
+ "\375G\006\251\013\000\000\2105P\355\373\344\000\000\305\337\374'\3165\000"
+ "\000\311\042\227\002w\372\000\000j\340;\003\012\274\000\000\264\373\232\030"
+ "\236\371\000\000`\0015\341\313\316\000\0006\025\003\014V\362\000\000\371"
+ "\016,.\200\010\000\000;<\202V\320\343\000\000E\330\003\042_\023\000\000\340"
+ "\327\370\376\253\371\000\000\346\346\277+\031\360\000\000],\325\305U\310"
+ "\000\0001\000\361\357M\023\000\000\335\004\342\000\037\355\000\000w\031\022"
+ ";\134\304\000\000\360\031\312\016)\344\000\000\265\362\325\355J\011\000\000"
+ ">\310\034\343-\010\000\000i\350%7\237\377\000\000\376\374+\343\353 \000\000"
+ "\225\032\077\342\017\366\000\000d\355E\013\333\001\000\000\023\025\347\336"
+ "\301\001\000\000UIAM\327\353\000\000+\333\230&\376\026\000\000\351\031\372"
+ "\256\337\025\000\000r\377\2665\352\347\000\000\275\016\202&r\346\000\000"
+ "I\331\003\021\335\344\000\000\217\311\026\015H\366\000\000C\036\312\000\012"
+ "G\000\000\253\370\350\021\347\007\000\000\252\013\316\362#\014\000\000\221"
+ "\027\373\017\303\360\000\000\351\353\0050\255\331\000\000\213\366h\343#\341"
+ "\000\000\362\316L\336m\004\000\000\336\375J\301\301\345\000\000\325\377\343"
+ "\302\360\360\000\000\267\361\364\026x\372\000\000\267\373e\023r\302\000\000"
+ "\341%\032\033\210\347\000\000K\000,\017\221\353\000\000@\356\321\030\236"
+ "\311\000\000\360\010\037\331F<\000\000\007\357\361*\333\035\000\000p\374"
+ "1\010\023\376\000\000i\002]\217\316\333\000\000\326\313\315>\340\321\000"
+ "\000\015\357s\005p\021\000\000\367\357\220\336\204\006\000\000\253\350\341"
+ "1\376\322\000\000<.x\033\343\317\000\000m\360\250\016\244\301\000\000\021"
+ "6TH}\373\000\000!\003\003\013\035\010\000\000a\001\042\032Y\000\000\000O"
+ "\006\237\000\226\035\000\000>\351\342\036\306\303\000\000\004\003,\020\254"
+ "\366\000\000\300\374U\372b\012\000\000\006\323\335\031\256\002\000\000V\372"
+ "\237\330|\372\000\000\307\363S\014+\354\000\000P\026\270\376:\366\000\000"
+ "H1\206\276[\335\000\000\024\020\024\014\240\007\000\000\177\346\177\014o"
+ "\367\000\000\277\336\000#k\013\000\000\305\340\226\344\212\000\000\000S\365"
+ "7$\327\016\000\000\261\032!\3477\020\000\000\317\300V\237\231\007\000\000"
+ "F\366\335\356\3305\000\000\366\365\315\346\025\033\000\000\244+2\022\315"
+ "\317\000\000]\374\307\343o\345\000\000\367\024\004-1\345\000\000>(|\033\007"
+ "\370\000\000\231\006%\0001\366\000\000\211\366\346\0252\365\000\000\343P"
+ "\340\006*\345\000\000\361\361\350\016w\377\000\000\246\021\363$\240\000\000"
+ "\000R\332\005\013j\012\000\000=\026\001\200\350\017\000\000\025\353\216\037"
+ "\000\005\000\000\354\021\077\367\077\037\000\000\245\307)\341C\361\000\000"
+ "a6.\011\340\000\000\000u\364B\003\323\342\000\000\077\370\376\026.\022\000"
+ "\000\3104\360\042\310,\000\000g\367\312#\222\356\000\000\0770\025=#\011\000"
+ "\000\370\370*9\376\341\000\000\323\017\351T\0140\000\000\042\036\260\274"
+ "\213\334\000\000\025\02791b\025\000\0004\373\205\0036\023\000\000\357\004"
+ "\016\373\215\340\000\000;\354\347\370\201\007\000\000^\006\341\365B\367\000"
+ "\000\240%x\365\024\364\000\000\246\324\332\272-\351\000\000r\0303\021\225"
+ "\341\000\000w\371\002\373\306\343\000\000~\023\034\322\224\025\000\000m\376"
+ "#\027\031\021\000\000\255\026y\036h\004\000\000\306\022$\375\004\325\000"
+ "\000\346\021w\356\255#\000\000h\363[&\034\337\000\000\344\022\220\325\036"
+ "\325\000\000^\312c\0272\361\000\000\022\353(\037\260\344\000\000\301\346"
+ "\340\042n\342\000\000\372#U\312\005\022\000\000h\004K\003\000\375\000\000"
+ "Y\014Q\021p\370\000\000\272\024\210%<\357\000\000\077\377\322,\367\340\000"
+ "\000\254\042]\012(\327\000\000}\376\352\377u\010\000\000\211\007\3409Z\366"
+ "\000\000\134\316%\367\310\010\000\000N\363\347\366\342\267\000\000\224\341"
+ "j\321\374\342\000\000\000\016\267\271\220\312\000\000\227\300\365\007G\012"
+ "\000\000\005\032\374\376s\364\000\000p\331\205\350a\350\000\000I\354P\014"
+ "\242\021\000\000\277\362W\012\034\332\000\000\373\376\231\003.\347\000\000"
+ "+\367E\015M\345\000\000\335\015\367\034X\336\000\000\305\263\311E\037\304"
+ "\000\000!\345{\261\255\331\000\000]\016d\014U\360\000\000\256\0256)5$\000"
+ "\000g\011(&a\366\000\000\300\002\001\357W\367\000\000\376\001\027\376\272"
+ "\001\000\000\022\376\327\367d\004\000\000\207\004>4N\352\000\000H\333\332"
+ "\014\264\355\000\000\001&\337\003P\345\000\000\316*\3621\345\365\000\000"
+ "D\022+\302\332\367\000\000\030\004\237\372\200\364\000\000\374\371q\015\201"
+ "\354\000\000\2454\344\0313\354\000\000\332\351A$\005\353\000\000\004\016"
+ "\207\030\300\305\000\000\037\016\361\340\277\370\000\000\245'\300\364{\347"
+ "\000\000O\0214AI\326\000\000#\042\375NT\351\000\000\201\360\032\362Y\010"
+ "\000\000\354\366\314\351\374\325\000\000\013\264\377\343\267,\000\000K\013"
+ "n\347\226;\000\000\252\323<7\365\330\000\000\311\021\344H`\011\000\000z\317"
+ "A\006b\324\000\000\321\351#\004\214\351\000\000\254\370\271\0306\364\000"
+ "\000d\336\327\006\361\022\000\000\265\001\242\033C\357\000\000\364\340\216"
+ "\371\026\031\000\000\316\014|\042\077\370\000\000\214\012\204\356\305\375"
+ "\000\000V\364\3264\021\265\000\000\264\341\343\022\361\373\000\000\353\365"
+ "\353\366\377\347\000\000i\015\020 \213\326\000\000\252\353*\006\222\006\000"
+ "\000\344\354n\016k\316\000\000\263\366\360\024D\372\000\000\212\325G\355"
+ "/\300\000\000\265\303\020\344\011\017\000\000W\010z\374w\355\000\000\321"
+ "\017\341\002\015\002\000\000\020\373\250+\261#\000\000\244\011\342\372\220"
+ "\034\000\000\004\304C\357\134$\000\000o,\364;\236\310\000\000=\362t\271B"
+ "\340\000\000\365\003\000\002\363\006\000\000\227\0230H\266\322\000\000\022"
+ "\355:*Q\014\000\000\374**\026\206\324\000\000\332\021z\376\337\354\000\000"
+ "G\360&\006\223\372\000\000X\367\245\037:\343\000\000\251\365\326\010\346"
+ "\357\000\000\311\307\134\373\300\007\000\000r\316\034\024&3\000\000\232\364"
+ "\253\015\214%\000\000m\357(\030\001\357\000\000\227\374U/\3776\000\000\005"
+ "\321\027\013+\036\000\000\370\227\015\017\007\332\000\000g\342/J~\374\000"
+ "\000|\364\2611\335\014\000\0000\345>\014b1\000\000\236\374>\012z\004\000"
+ "\000\366\030\017\077\370\346\000\000u\265\2633f\022\000\000\2350\007\030"
+ "z\011\000\000\345\363t\036\034\371\000\000$$!\364\347\001\000\000]\350\215"
+ "\342|\373\000\000_\017w7\255\336\000\000\247\376\177\024\016 \000\000\277"
+ "\365\327(W\365\000\000\002\364\323\370f\352\000\000\275\275\027<\001\354"
+ "\000\000\264\322\363Z\030\363\000\000\037\263\004\032\342\016\000\000\027"
+ ",\235!6\365\000\000yT\320\310\037\334\000\000\346\001\134\023\000\336\000"
+ "\000\374\274l\363D\275\000\000\265\357X+\272\375\000\000z\366\134\377y\006"
+ "\000\000\373\365\217\005/\370\000\000\266\006I\004\244\365\000\000\265\001"
+ "\204;G\312\000\000\250\354q\013\355\012\000\000P\0329\357S\000\000\000\310"
+ "-\3518\261\035\000\000.\370\300 \3267\000\000\322\361\313\042\303\342\000"
+ "\000\274\355,\025\223\352\000\000\211\025\267\034\012\362\000\000\202\375"
+ "\336\0217\002\000\000\221\373X\036\353\004\000\000U\001*TJ\354\000\000(\315"
+ "\346\034A\003\000\000\366\024%\366\212\336\000\000P\036\024\325\0237\000"
+ "\000\203\346\026\361\311Y\000\000\024\001\356\347\314\265\000\000\277\372"
+ "\362!'\302\000\0007\333\324\026_\331\000\000\037\350\311\013s\346\000\000"
+ "c\356yq\017\015\000\000f\006b\347(1\000\000}\276\374\037\026\372\000\000"
+ "\357\364\210\327\264\374\000\000\221\035\014\020D\377\000\000\205\037]\034"
+ "\004\003\000\000LD\256\042\212\026\000\000\234\360\262\031\352\011\000\000"
+ "\255\305\334)\255\036\000\000N\374\206\030\335\025\000\000%R\330>n\375\000"
+ "\000\337\3652F\232\335\000\000\234\003\322\025|\333\000\000\237!\230\356"
+ ":\015\000\000,,+\011\027\033\000\000\204\361S\016\077\037\000\000\026\353"
+ "\355-\266\016\000\000\221\024g\014C;\000\000`\377\374\001\256\372\000\000"
+ "\271\266\2540D\025\000\000\343\356\262\336!>\000\0000\011\002\2540\360\000"
+ "\000xG\331\354+/\000\000\326\312\240\344\341\027\000\000/\010\365\004\304"
+ "\025\000\000|\004\372\277\225\266\000\000\373\001I\351\352\342\000\000\016"
+ ":\042\0211X\000\000\276\335\201\024\266\025\000\000\275\3451Ux\005\000\000"
+ "\011/O\036\030\365\000\000\350^\3253\266\331\000\000S\036\345\013.\337\000"
+ "\000\212\2722\365\250\015\000\000\222\363\326\374\362\344\000\000&\375\277"
+ "5\361\007\000\000\020\372\367&Z\003\000\000\032\011\371\350\236\014\000\000"
+ "Q\023\037kT\335\000\000Z\010\365-_\347\000\000\242\010\202\0261\315\000\000"
+ "p\376q\031\021\370\000\000\374\342r\3244\362\000\000\177\372h\2767\034\000"
+ "\000\253\354\031\374\036\341\000\000#D\322\346H\311\000\000C\325-\313\276"
+ "\377\000\000y\344\244\265\242\335\000\000\201\356\330\015\276\356\000\000"
+ "\270-\013BW\301\000\000>\300%\317\303\346\000\000!\372\234\036\255\321\000"
+ "\000\006\333\003\335s6\000\000\327\004\333\030\334\372\000\000\347\023\037"
+ "\321H\377\000\000\246\01763\242\364\000\000}\305\377\177c\350\000\000\366"
+ "\015\367\017+\001\000\000\350\357M\305`\322\000\000-\007\224/\025\373\000"
+ "\000\013\362j\031\305\006\000\000!\365\214\027\302\316\000\000\014\017\342"
+ "\373\236\020\000\000\233\376\271\011\357\340\000\000\012\361c\351\352/\000"
+ "\000\021\002\220\370\276\030\000\000\337\342\134\373\336\344\000\000\313"
+ "\320\235\034\223\005\000\0000\316\034XM\001\000\000V\357\326/9\330\000\000"
+ "\230\375\316\363\260\351\000\000\134!1\362p\372\000\000\362$\366\363\331"
+ "G\000\000\305\274A\341m\251\000\000\377\3457B\356\317\000\000\223\372\037"
+ "\002\203\271\000\000V\346%\011\247\357\000\000\266&\014\007\002\016\000\000"
+ "\366\374\313\020\213\366\000\000\363\360\234\021\331\006\000\000$\377\255"
+ "`\230\352\000\000\344\326\203\024\213\363\000\000\323\354<\032\315\305\000"
+ "\000\032\332\363&\365\001\000\000\312\377,\024\245\354\000\000\353\346\262"
+ ",\371\340\000\000o\005{G/\325\000\0007\010w\360=\337\000\000\351\330\271"
+ "\322\245\000\000\000[\005\247\005q\366\000\000\004\344\241@b\310\000\000"
+ "3\023}\346\363\034\000\000Z,)C\245\334\000\000y\316`iN\345\000\000\345\337"
+ "\020!d\010\000\000\270\316\262.=\346\000\000\321\350h\275 \352\000\000\004"
+ "F\313\311\214\326\000\000\014\035\251,\376\343\000\000\077\002\324\3516\341"
+ "\000\000\212\027\362\005\212%\000\000\017\336\270 \354\005\000\000W\375\255"
+ "6\037\027\000\000\217\273\245$\223\323\000\000\134\332\354\354*\346\000\000"
+ "@\352\231\350\004\377\000\000J\341T#\314\374\000\000{\306;U\210\365\000\000"
+ "S\367\275\036{\027\000\000\016\034l\021\313\026\000\000\376\345\331\365p"
+ "\371\000\000\361%\006L\016\354\000\000J\032\317<\242I\000\000\006\376\312"
+ "\004\024\015\000\000\375\302M8\250\355\000\000\300\005\256\036\3321\000\000"
+ "$\367m\005:\006\000\000/\354z\015\307\272\000\000\023\013\214\320%\013\000"
+ "\000\204\005\036\376\222\363\000\000\377\335\262\011\256O\000\000~\353o\025"
+ "4\011\000\000\263\325\366\000n\377\000\000w\022U\011\200\354\000\000l3\245"
+ "P\364\001\000\000\214\330\317\332\216\012\000\000d\260B\005\234\355\000\000"
+ "\257\322x \0169\000\000\361\322C\036\352\002\000\000\342\366\301J*\002\000"
+ "\000\077,T \252\376\000\000\357\004\222\033Q\374\000\000\002\027\362\333"
+ "\342\024\000\000*\374\03220\345\000\000\201\303\327\375\034\332\000\000U"
+ "\345\262KG\331\000\000\223B\230$\020<\000\000b\341\322#\240\033\000\000\377"
+ "\000]A\372\012\000\000\273\372x\000\245\343\000\000\360\355\261\007R\331"
+ "\000\000S\325`\026\222\355\000\000e\370R\340'\016\000\000X\325\311\026;\350"
+ "\000\0006\025\355\374\307\360\000\000\273\366\235*\320\333\000\000J%\033"
+ "\343H\324\000\000A\341\374Jc\352\000\000v\023j\270\024\010\000\000\314\367"
+ "\334\377\027\016\000\000\007\362\233S\034\374\000\000x\327\030\022\312\334"
+ "\000\0008 \324\023\261\017\000\000p\002\300\0372\000\000\000%\007\030\021"
+ "\365\367\000\000\243\325\020\0114\330\000\000\335\341E\001\0134\000\000\230"
+ "\003F\006t\356\000\000\325-\312\256n\022\000\000;\252@\042\367\357\000\000"
+ "\255\026\206\277a\035\000\000\362\373l\022\327\002\000\000\265\315\242\370"
+ "B\304\000\000\222\377\342\012\200\377\000\000\343\3215\000t\312\000\000\262"
+ "\360\034\360a\352\000\000w\351Q(\277\017\000\000\217\320\012\370{\022\000"
+ "\000\016\011\211\270:\372\000\000m\0041\001{\355\000\000}2\244ce\315\000"
+ "\000\211\327\244\336<\031\000\000\042\360O\023C\316\000\000\016\000'\026"
+ "X/\000\000q\363\357\002\240\034\000\000+\013\337\365\277\361\000\000\033"
+ "\000\231\024}\346\000\000\255\377\377\376*\360\000\000\006\350\021\013\305"
+ "\006\000\000\313\331J\004f\377\000\000\324\353b\345_\346\000\000\010\004"
+ "=\017/\011\000\000\077\011-\375a\001\000\000\307\276#\016j\345\000\000\312"
+ "\376F\377\214'\000\000t\004\206\016[\370\000\000\361\022\205\006\326.\000"
+ "\000\307\370e-\014\014\000\000L\376\336'\235*\000\000\355\017\254&\001\360"
+ "\000\000K\005\377\037\036\323\000\000E\366:\000\257\324\000\000\226\255\306"
+ "\274y\324\000\000o\034~\264\313\375\000\000/\263h\006\275\345\000\000\226"
+ "\357\014,@,\000\000@\003&\353\253\006\000\000\326\347\244\2677\325\000\000"
+ "\030\375Y\377_\025\000\000J-\034\360U2\000\000\367#\243\330\232\311\000\000"
+ "\316\020p\034\203\023\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010\000\011"
+ "\000\012\000\013\000\014\000\015\000\016\000\017\000\020\000\021\000\022"
+ "\000\023\000\024\000\025\000\026\000\027\000\030\000\031\000\032\000\033"
+ "\000\034\000\035\000\036\000\037\000 \000!\000\042\000#\000$\000%\000&\000"
+ "'\000(\000)\000*\000+\000,\000-\000.\000/\0000\0001\0002\0003\0004\0005\000"
+ "6\0007\0008\0009\000:\000;\000<\000=\000>\000\077\000@\000A\000B\000C\000"
+ "D\000E\000F\000G\000H\000I\000J\000K\000L\000M\000N\000O\000P\000Q\000R\000"
+ "S\000T\000U\000V\000W\000X\000Y\000Z\000[\000\134\000]\000^\000_\000`\000"
+ "a\000b\000c\000d\000e\000f\000g\000h\000i\000j\000k\000l\000m\000n\000o\000"
+ "p\000q\000r\000s\000t\000u\000v\000w\000x\000y\000z\000{\000|\000}\000~\000"
+ "\177\000\200\000\201\000\202\000\203\000\204\000\205\000\206\000\207\000"
+ "\210\000\211\000\212\000\213\000\214\000\215\000\216\000\217\000\220\000"
+ "\221\000\222\000\223\000\224\000\225\000\226\000\227\000\230\000\231\000"
+ "\232\000\233\000\234\000\235\000\236\000\237\000\240\000\241\000\242\000"
+ "\243\000\244\000\245\000\246\000\247\000\250\000\251\000\252\000\253\000"
+ "\254\000\255\000\256\000\257\000\260\000\261\000\262\000\263\000\264\000"
+ "\265\000\266\000\267\000\270\000\271\000\272\000\273\000\274\000\275\000"
+ "\276\000\277\000\300\000\301\000\302\000\303\000\304\000\305\000\306\000"
+ "\307\000\310\000\311\000\312\000\313\000\314\000\315\000\316\000\317\000"
+ "\320\000\321\000\322\000\323\000\324\000\325\000\326\000\327\000\330\000"
+ "\331\000\332\000\333\000\334\000\335\000\336\000\337\000\340\000\341\000"
+ "\342\000\343\000\344\000\345\000\346\000\347\000\350\000\351\000\352\000"
+ "\353\000\354\000\355\000\356\000\357\000\360\000\361\000\362\000\363\000"
+ "\364\000\365\000\366\000\367\000\370\000\371\000\372\000\373\000\374\000"
+ "\375\000\376\000\377\000\000\001\001\001\002\001\003\001\004\001\005\001"
+ "\006\001\007\001\010\001\011\001\012\001\013\001\014\001\015\001\016\001"
+ "\017\001\020\001\021\001\022\001\023\001\024\001\025\001\026\001\027\001"
+ "\030\001\031\001\032\001\033\001\034\001\035\001\036\001\037\001 \001!\001"
+ "\042\001#\001$\001%\001&\001'\001(\001)\001*\001+\001,\001-\001.\001/\001"
+ "0\0011\0012\0013\0014\0015\0016\0017\0018\0019\001:\001;\001<\001=\001>\001"
+ "\077\001@\001A\001B\001C\001D\001E\001F\001G\001H\001I\001J\001K\001L\001"
+ "M\001N\001O\001P\001Q\001R\001S\001T\001U\001V\001W\001X\001Y\001Z\001[\001"
+ "\134\001]\001^\001_\001`\001a\001b\001c\001d\001e\001f\001g\001h\001i\001"
+ "j\001k\001l\001m\001n\001o\001p\001q\001r\001s\001t\001u\001v\001w\001x\001"
+ "y\001z\001{\001|\001}\001~\001\177\001\200\001\201\001\202\001\203\001\204"
+ "\001\205\001\206\001\207\001\210\001\211\001\212\001\213\001\214\001\215"
+ "\001\216\001\217\001\220\001\221\001\222\001\223\001\224\001\225\001\226"
+ "\001\227\001\230\001\231\001\232\001\233\001\234\001\235\001\236\001\237"
+ "\001\240\001\241\001\242\001\243\001\244\001\245\001\246\001\247\001\250"
+ "\001\251\001\252\001\253\001\254\001\255\001\256\001\257\001\260\001\261"
+ "\001\262\001\263\001\264\001\265\001\266\001\267\001\270\001\271\001\272"
+ "\001\273\001\274\001\275\001\276\001\277\001\300\001\301\001\302\001\303"
+ "\001\304\001\305\001\306\001\307\001\310\001\311\001\312\001\313\001\314"
+ "\001\315\001\316\001\317\001\320\001\321\001\322\001\323\001\324\001\325"
+ "\001\326\001\327\001\330\001\331\001\332\001\333\001\334\001\335\001\336"
+ "\001\337\001\340\001\341\001\342\001\343\001\344\001\345\001\346\001\347"
+ "\001\350\001\351\001\352\001\353\001\354\001\355\001\356\001\357\001\360"
+ "\001\361\001\362\001\363\001"
+;
+const unsigned long s1_b_size = 6080;
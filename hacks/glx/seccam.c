@@ -1,1388 +1,484 @@
-/* Generated from "seccam.dxf" on 31-May-2017.
-   Smoothed vertex normals.
+/* Generated from "seccam.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°.
    Components: body, cap, hinge, lens, pipe.
  */
 
 #include "gllist.h"
 
-static const float seccam_body_data[] = {
-	0,0.894427,0.447214,-5,2.25,5,
-	0,0.952226,0.305393,7.75,3,3.5,
-	0,0.988273,0.152697,-5,3,3.5,
-	0,0.952226,0.305393,7.75,3,3.5,
-	0,0.894427,0.447214,-5,2.25,5,
-	0,0.894427,0.447214,7.75,2.25,5,
-	0,0.172669,-0.98498,7.75,2.450912,1.010298,
-	0,0.083016,-0.996548,-5,2.36871,1,
-	0,0.22073,-0.975335,-5,2.450912,1.010298,
-	0,0.083016,-0.996548,-5,2.36871,1,
-	0,0.172669,-0.98498,7.75,2.450912,1.010298,
-	0,0.041508,-0.999138,7.75,2.36871,1,
-	0,0.996548,-0.083016,-5,3,1.63129,
-	0,0.98498,-0.172669,7.75,2.989702,1.549088,
-	0,0.975335,-0.22073,-5,2.989702,1.549088,
-	0,0.98498,-0.172669,7.75,2.989702,1.549088,
-	0,0.996548,-0.083016,-5,3,1.63129,
-	0,0.999138,-0.041508,7.75,3,1.63129,
-	0,0.041508,-0.999138,7.75,2.36871,1,
-	0,0,-1,-5,2.25,1,
-	0,0.083016,-0.996548,-5,2.36871,1,
-	0,0,-1,-5,2.25,1,
-	0,0.041508,-0.999138,7.75,2.36871,1,
-	0,0,-1,7.75,2.25,1,
-	0,0.450399,-0.892827,7.75,2.640242,1.078314,
-	0,0.361055,-0.932544,-5,2.548078,1.037344,
-	0,0.49361,-0.869683,-5,2.640242,1.078314,
-	0,0.361055,-0.932544,-5,2.548078,1.037344,
-	0,0.450399,-0.892827,7.75,2.640242,1.078314,
-	0,0.314923,-0.949117,7.75,2.548078,1.037344,
-	0,0.869683,-0.49361,-5,2.921686,1.359758,
-	0,0.817322,-0.576182,7.75,2.867672,1.274581,
-	0,0.788104,-0.615542,-5,2.867672,1.274581,
-	0,0.817322,-0.576182,7.75,2.867672,1.274581,
-	0,0.869683,-0.49361,-5,2.921686,1.359758,
-	0,0.892827,-0.450399,7.75,2.921686,1.359758,
-	0,0,-1,7.75,2.25,1,
-	0,0,-1,-5,0,1,
-	0,0,-1,-5,2.25,1,
-	0,0,-1,-5,0,1,
-	0,0,-1,7.75,2.25,1,
-	0,0,-1,7.75,0,1,
-	0,0,1,7.75,0,5,
-	0,0,1,-5,2.25,5,
-	0,0,1,-5,0,5,
-	0,0,1,-5,2.25,5,
-	0,0,1,7.75,0,5,
-	0,0,1,7.75,2.25,5,
-	0,0.576182,-0.817322,7.75,2.725419,1.132328,
-	0,0.49361,-0.869683,-5,2.640242,1.078314,
-	0,0.615542,-0.788104,-5,2.725419,1.132328,
-	0,0.49361,-0.869683,-5,2.640242,1.078314,
-	0,0.576182,-0.817322,7.75,2.725419,1.132328,
-	0,0.450399,-0.892827,7.75,2.640242,1.078314,
-	0,1,0,-5,3,1.75,
-	0,0.999138,-0.041508,7.75,3,1.63129,
-	0,0.996548,-0.083016,-5,3,1.63129,
-	0,0.999138,-0.041508,7.75,3,1.63129,
-	0,1,0,-5,3,1.75,
-	0,1,0,7.75,3,1.75,
-	0,0.932544,-0.361055,-5,2.962656,1.451922,
-	0,0.892827,-0.450399,7.75,2.921686,1.359758,
-	0,0.869683,-0.49361,-5,2.921686,1.359758,
-	0,0.892827,-0.450399,7.75,2.921686,1.359758,
-	0,0.932544,-0.361055,-5,2.962656,1.451922,
-	0,0.949117,-0.314923,7.75,2.962656,1.451922,
-	0,0.788104,-0.615542,-5,2.867672,1.274581,
-	0,0.707107,-0.707107,7.75,2.801777,1.198223,
-	0,0.707107,-0.707107,-5,2.801777,1.198223,
-	0,0.707107,-0.707107,7.75,2.801777,1.198223,
-	0,0.788104,-0.615542,-5,2.867672,1.274581,
-	0,0.817322,-0.576182,7.75,2.867672,1.274581,
-	0,0.988273,0.152697,-5,3,3.5,
-	0,1,0,7.75,3,1.75,
-	0,1,0,-5,3,1.75,
-	0,1,0,7.75,3,1.75,
-	0,0.988273,0.152697,-5,3,3.5,
-	0,0.952226,0.305393,7.75,3,3.5,
-	0,0.975335,-0.22073,-5,2.989702,1.549088,
-	0,0.949117,-0.314923,7.75,2.962656,1.451922,
-	0,0.932544,-0.361055,-5,2.962656,1.451922,
-	0,0.949117,-0.314923,7.75,2.962656,1.451922,
-	0,0.975335,-0.22073,-5,2.989702,1.549088,
-	0,0.98498,-0.172669,7.75,2.989702,1.549088,
-	0,0.707107,-0.707107,7.75,2.801777,1.198223,
-	0,0.615542,-0.788104,-5,2.725419,1.132328,
-	0,0.707107,-0.707107,-5,2.801777,1.198223,
-	0,0.615542,-0.788104,-5,2.725419,1.132328,
-	0,0.707107,-0.707107,7.75,2.801777,1.198223,
-	0,0.576182,-0.817322,7.75,2.725419,1.132328,
-	0,0.314923,-0.949117,7.75,2.548078,1.037344,
-	0,0.22073,-0.975335,-5,2.450912,1.010298,
-	0,0.361055,-0.932544,-5,2.548078,1.037344,
-	0,0.22073,-0.975335,-5,2.450912,1.010298,
-	0,0.314923,-0.949117,7.75,2.548078,1.037344,
-	0,0.172669,-0.98498,7.75,2.450912,1.010298,
-	1,0,0,7.75,3.002239,1.649165,
-	1,0,0,7.75,3,1.75,
-	1,0,0,7.75,3,1.63129,
-	1,0,0,7.75,2.36871,1,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,2.350835,0.997761,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,0,1.875,
-	1,0,0,7.75,0,1,
-	1,0,0,7.75,0,1.875,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.174754,1.875947,
-	1,0,0,7.75,1.174754,1.875947,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.245773,1.89962,
-	1,0,0,7.75,1.245773,1.89962,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.306225,1.943775,
-	1,0,0,7.75,1.306225,1.943775,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.35038,2.004227,
-	1,0,0,7.75,1.35038,2.004227,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.374053,2.075246,
-	1,0,0,7.75,1.374053,2.075246,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,1.374053,3.924754,
-	1,0,0,7.75,1.174754,4.124053,
-	1,0,0,7.75,0,5,
-	1,0,0,7.75,0,4.125,
-	1,0,0,7.75,0,5,
-	1,0,0,7.75,1.174754,4.124053,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,1.174754,4.124053,
-	1,0,0,7.75,1.245773,4.10038,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,1.245773,4.10038,
-	1,0,0,7.75,1.306225,4.056225,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,1.306225,4.056225,
-	1,0,0,7.75,1.35038,3.995773,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,1.35038,3.995773,
-	1,0,0,7.75,1.374053,3.924754,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,1.374053,3.924754,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,2.25,1,
-	1,0,0,7.75,2.36871,1,
-	1,0,0,7.75,2.25,5,
-	1,0,0,7.75,2.36871,1,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.36871,1,
-	1,0,0,7.75,2.450912,1.010298,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.450912,1.010298,
-	1,0,0,7.75,2.548078,1.037344,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.548078,1.037344,
-	1,0,0,7.75,2.640242,1.078314,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.640242,1.078314,
-	1,0,0,7.75,2.725419,1.132328,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.725419,1.132328,
-	1,0,0,7.75,2.801777,1.198223,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.801777,1.198223,
-	1,0,0,7.75,2.867672,1.274581,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.867672,1.274581,
-	1,0,0,7.75,2.921686,1.359758,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.921686,1.359758,
-	1,0,0,7.75,2.962656,1.451922,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.962656,1.451922,
-	1,0,0,7.75,2.989702,1.549088,
-	1,0,0,7.75,3,3.5,
-	1,0,0,7.75,2.989702,1.549088,
-	1,0,0,7.75,3,1.63129,
-	0.966335,0.244997,0.078574,7.75,3,3.5,
-	0.555363,0.830891,-0.034519,7.75,3,1.63129,
-	0.316228,0.948683,0,7.75,3,1.75,
-	0,-0.976994,0.213265,7.75,1.374053,2.075246,
-	0,-0.888698,0.458494,7.55,1.35038,2.004227,
-	0,-0.888698,0.458494,7.75,1.35038,2.004227,
-	0,-0.888698,0.458494,7.55,1.35038,2.004227,
-	0,-0.976994,0.213265,7.75,1.374053,2.075246,
-	0,-0.994299,0.106632,7.55,1.374053,2.075246,
-	0,-0.000806,1,7.75,0,1.875,
-	0,-0.10717,0.994241,7.55,1.174754,1.875947,
-	0,-0.000806,1,7.55,0,1.875,
-	0,-0.10717,0.994241,7.55,1.174754,1.875947,
-	0,-0.000806,1,7.75,0,1.875,
-	0,-0.213524,0.976938,7.75,1.174754,1.875947,
-	0,-0.10717,-0.994241,7.75,1.174754,4.124053,
-	0,-0.000806,-1,7.55,0,4.125,
-	0,-0.213524,-0.976938,7.55,1.174754,4.124053,
-	0,-0.000806,-1,7.55,0,4.125,
-	0,-0.10717,-0.994241,7.75,1.174754,4.124053,
-	0,-0.000806,-1,7.75,0,4.125,
-	0,-0.411789,-0.911279,7.75,1.245773,4.10038,
-	0,-0.213524,-0.976938,7.55,1.174754,4.124053,
-	0,-0.503965,-0.863724,7.55,1.245773,4.10038,
-	0,-0.213524,-0.976938,7.55,1.174754,4.124053,
-	0,-0.411789,-0.911279,7.75,1.245773,4.10038,
-	0,-0.10717,-0.994241,7.75,1.174754,4.124053,
-	0,-0.911279,-0.411789,7.75,1.35038,3.995773,
-	0,-0.976994,-0.213265,7.55,1.374053,3.924754,
-	0,-0.994299,-0.106632,7.75,1.374053,3.924754,
-	0,-0.976994,-0.213265,7.55,1.374053,3.924754,
-	0,-0.911279,-0.411789,7.75,1.35038,3.995773,
-	0,-0.863724,-0.503965,7.55,1.35038,3.995773,
-	0,-0.742826,0.669484,7.75,1.306225,1.943775,
-	0,-0.888698,0.458494,7.55,1.35038,2.004227,
-	0,-0.669484,0.742826,7.55,1.306225,1.943775,
-	0,-0.888698,0.458494,7.55,1.35038,2.004227,
-	0,-0.742826,0.669484,7.75,1.306225,1.943775,
-	0,-0.888698,0.458494,7.75,1.35038,2.004227,
-	0,-0.707107,-0.707107,7.75,1.306225,4.056225,
-	0,-0.503965,-0.863724,7.55,1.245773,4.10038,
-	0,-0.707107,-0.707107,7.55,1.306225,4.056225,
-	0,-0.503965,-0.863724,7.55,1.245773,4.10038,
-	0,-0.707107,-0.707107,7.75,1.306225,4.056225,
-	0,-0.411789,-0.911279,7.75,1.245773,4.10038,
-	0,-0.213524,0.976938,7.75,1.174754,1.875947,
-	0,-0.411789,0.911279,7.55,1.245773,1.89962,
-	0,-0.10717,0.994241,7.55,1.174754,1.875947,
-	0,-0.411789,0.911279,7.55,1.245773,1.89962,
-	0,-0.213524,0.976938,7.75,1.174754,1.875947,
-	0,-0.503965,0.863724,7.75,1.245773,1.89962,
-	0,-0.994299,-0.106632,7.75,1.374053,3.924754,
-	0,-0.994299,0.106632,7.55,1.374053,2.075246,
-	0,-0.976994,0.213265,7.75,1.374053,2.075246,
-	0,-0.994299,0.106632,7.55,1.374053,2.075246,
-	0,-0.994299,-0.106632,7.75,1.374053,3.924754,
-	0,-0.976994,-0.213265,7.55,1.374053,3.924754,
-	0,-0.503965,0.863724,7.75,1.245773,1.89962,
-	0,-0.669484,0.742826,7.55,1.306225,1.943775,
-	0,-0.411789,0.911279,7.55,1.245773,1.89962,
-	0,-0.669484,0.742826,7.55,1.306225,1.943775,
-	0,-0.503965,0.863724,7.75,1.245773,1.89962,
-	0,-0.742826,0.669484,7.75,1.306225,1.943775,
-	0,-0.707107,-0.707107,7.75,1.306225,4.056225,
-	0,-0.863724,-0.503965,7.55,1.35038,3.995773,
-	0,-0.911279,-0.411789,7.75,1.35038,3.995773,
-	0,-0.863724,-0.503965,7.55,1.35038,3.995773,
-	0,-0.707107,-0.707107,7.75,1.306225,4.056225,
-	0,-0.707107,-0.707107,7.55,1.306225,4.056225,
-	-1,0,0,-5,2.25,5,
-	-1,0,0,-5,0,1,
-	-1,0,0,-5,0,5,
-	-1,0,0,-5,0,1,
-	-1,0,0,-5,2.25,5,
-	-1,0,0,-5,2.25,1,
-	-1,0,0,-5,2.25,1,
-	-1,0,0,-5,2.25,5,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.25,1,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.36871,1,
-	-1,0,0,-5,2.36871,1,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.450912,1.010298,
-	-1,0,0,-5,2.450912,1.010298,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.548078,1.037344,
-	-1,0,0,-5,2.548078,1.037344,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.640242,1.078314,
-	-1,0,0,-5,2.640242,1.078314,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.725419,1.132328,
-	-1,0,0,-5,2.725419,1.132328,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.801777,1.198223,
-	-1,0,0,-5,2.801777,1.198223,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.867672,1.274581,
-	-1,0,0,-5,2.867672,1.274581,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.921686,1.359758,
-	-1,0,0,-5,2.921686,1.359758,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.962656,1.451922,
-	-1,0,0,-5,2.962656,1.451922,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,2.989702,1.549088,
-	-1,0,0,-5,2.989702,1.549088,
-	-1,0,0,-5,3,3.5,
-	-1,0,0,-5,3,1.63129,
-	-0.316719,0.945245,-0.078743,-5,3,1.63129,
-	-0.971484,0.234324,0.036205,-5,3,3.5,
-	0,1,0,-5,3,1.75
-};
-static const struct gllist seccam_body_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 294, seccam_body_data, 0
-};
-const struct gllist *seccam_body = &seccam_body_frame;
-
-static const float seccam_cap_data[] = {
-	0,-0.499258,-0.866453,9.5,2.292275,5.079185,
-	0,-0.389309,-0.921107,-5.5,2.247183,5.1016,
-	0,-0.551704,-0.83404,-5.5,2.292275,5.079185,
-	0,-0.389309,-0.921107,-5.5,2.247183,5.1016,
-	0,-0.499258,-0.866453,9.5,2.292275,5.079185,
-	0,-0.331806,-0.943348,9.5,2.247183,5.1016,
-	0,-0.672883,-0.739749,9.5,2.332489,5.048877,
-	0,-0.551704,-0.83404,-5.5,2.292275,5.079185,
-	0,-0.672883,-0.739749,-5.5,2.332489,5.048877,
-	0,-0.551704,-0.83404,-5.5,2.292275,5.079185,
-	0,-0.672883,-0.739749,9.5,2.332489,5.048877,
-	0,-0.499258,-0.866453,9.5,2.292275,5.079185,
-	0,-0.331806,-0.943348,9.5,2.247183,5.1016,
-	0,-0.213696,-0.9769,-5.5,2.198743,5.115361,
-	0,-0.389309,-0.921107,-5.5,2.247183,5.1016,
-	0,-0.213696,-0.9769,-5.5,2.198743,5.115361,
-	0,-0.331806,-0.943348,9.5,2.247183,5.1016,
-	0,-0.153089,-0.988212,9.5,2.198743,5.115361,
-	0,-0.153089,-0.988212,9.5,2.198743,5.115361,
-	0,-0.061479,-0.998108,-5.5,2.148601,5.12,
-	0,-0.213696,-0.9769,-5.5,2.198743,5.115361,
-	0,-0.061479,-0.998108,-5.5,2.148601,5.12,
-	0,-0.153089,-0.988212,9.5,2.198743,5.115361,
-	0,-0.03074,-0.999527,9.5,2.148601,5.12,
-	0,-0.815421,-0.578869,9.5,2.36646,5.011706,
-	0,-0.877321,-0.479905,-5.5,2.393034,4.968932,
-	0,-0.872852,-0.487984,9.5,2.393034,4.968932,
-	0,-0.877321,-0.479905,-5.5,2.393034,4.968932,
-	0,-0.815421,-0.578869,9.5,2.36646,5.011706,
-	0,-0.778198,-0.628018,-5.5,2.36646,5.011706,
-	0,-0.03074,-0.999527,9.5,2.148601,5.12,
-	0,0,-1,-5.5,0,5.12,
-	0,-0.061479,-0.998108,-5.5,2.148601,5.12,
-	0,0,-1,-5.5,0,5.12,
-	0,-0.03074,-0.999527,9.5,2.148601,5.12,
-	0,0,-1,9.5,0,5.12,
-	0,-0.672883,-0.739749,9.5,2.332489,5.048877,
-	0,-0.778198,-0.628018,-5.5,2.36646,5.011706,
-	0,-0.815421,-0.578869,9.5,2.36646,5.011706,
-	0,-0.778198,-0.628018,-5.5,2.36646,5.011706,
-	0,-0.672883,-0.739749,9.5,2.332489,5.048877,
-	0,-0.672883,-0.739749,-5.5,2.332489,5.048877,
-	0,0.213696,0.9769,9.5,2.242938,5.153304,
-	0,0.331806,0.943348,-5.5,2.292351,5.139267,
-	0,0.153089,0.988212,-5.5,2.242938,5.153304,
-	0,0.331806,0.943348,-5.5,2.292351,5.139267,
-	0,0.213696,0.9769,9.5,2.242938,5.153304,
-	0,0.389309,0.921107,9.5,2.292351,5.139267,
-	0,0.389309,0.921107,9.5,2.292351,5.139267,
-	0,0.499258,0.866453,-5.5,2.33835,5.116402,
-	0,0.331806,0.943348,-5.5,2.292351,5.139267,
-	0,0.499258,0.866453,-5.5,2.33835,5.116402,
-	0,0.389309,0.921107,9.5,2.292351,5.139267,
-	0,0.551704,0.83404,9.5,2.33835,5.116402,
-	0,0.672883,0.739749,-5.5,2.379372,5.085485,
-	0,0.778198,0.628018,9.5,2.414026,5.047566,
-	0,0.815421,0.578869,-5.5,2.414026,5.047566,
-	0,0.778198,0.628018,9.5,2.414026,5.047566,
-	0,0.672883,0.739749,-5.5,2.379372,5.085485,
-	0,0.672883,0.739749,9.5,2.379372,5.085485,
-	0,0.815421,0.578869,-5.5,2.414026,5.047566,
-	0,0.865241,0.501356,9.5,2.441134,5.003932,
-	0,0.883881,0.467712,-5.5,2.441134,5.003932,
-	0,0.865241,0.501356,9.5,2.441134,5.003932,
-	0,0.815421,0.578869,-5.5,2.414026,5.047566,
-	0,0.778198,0.628018,9.5,2.414026,5.047566,
-	0,0,1,9.5,0,5.158037,
-	0,0.03074,0.999527,-5.5,2.191788,5.158037,
-	0,0,1,-5.5,0,5.158037,
-	0,0.03074,0.999527,-5.5,2.191788,5.158037,
-	0,0,1,9.5,0,5.158037,
-	0,0.061479,0.998108,9.5,2.191788,5.158037,
-	0,0.061479,0.998108,9.5,2.191788,5.158037,
-	0,0.153089,0.988212,-5.5,2.242938,5.153304,
-	0,0.03074,0.999527,-5.5,2.191788,5.158037,
-	0,0.153089,0.988212,-5.5,2.242938,5.153304,
-	0,0.061479,0.998108,9.5,2.191788,5.158037,
-	0,0.213696,0.9769,9.5,2.242938,5.153304,
-	0,0.551704,0.83404,9.5,2.33835,5.116402,
-	0,0.672883,0.739749,-5.5,2.379372,5.085485,
-	0,0.499258,0.866453,-5.5,2.33835,5.116402,
-	0,0.672883,0.739749,-5.5,2.379372,5.085485,
-	0,0.551704,0.83404,9.5,2.33835,5.116402,
-	0,0.672883,0.739749,9.5,2.379372,5.085485,
-	0,0,-1,-5,3.152109,3.22762,
-	-0.004217,0,-0.999991,-5.066635,3.09,3.22762,
-	-0.008435,0,-0.999964,-5.066635,3.152109,3.22762,
-	-0.004217,0,-0.999991,-5.066635,3.09,3.22762,
-	0,0,-1,-5,3.152109,3.22762,
-	0,0,-1,-5,3.09,3.22762,
-	-1,0,0,-5.5,2.191788,5.158037,
-	-1,0,0,-5.5,0,5.12,
-	-1,0,0,-5.5,0,5.158037,
-	-1,0,0,-5.5,0,5.12,
-	-1,0,0,-5.5,2.191788,5.158037,
-	-1,0,0,-5.5,2.148601,5.12,
-	-1,0,0,-5.5,2.148601,5.12,
-	-1,0,0,-5.5,2.191788,5.158037,
-	-1,0,0,-5.5,2.198743,5.115361,
-	-1,0,0,-5.5,2.198743,5.115361,
-	-1,0,0,-5.5,2.191788,5.158037,
-	-1,0,0,-5.5,2.242938,5.153304,
-	-1,0,0,-5.5,2.198743,5.115361,
-	-1,0,0,-5.5,2.242938,5.153304,
-	-1,0,0,-5.5,2.247183,5.1016,
-	-1,0,0,-5.5,2.247183,5.1016,
-	-1,0,0,-5.5,2.242938,5.153304,
-	-1,0,0,-5.5,2.292351,5.139267,
-	-1,0,0,-5.5,2.247183,5.1016,
-	-1,0,0,-5.5,2.292351,5.139267,
-	-1,0,0,-5.5,2.292275,5.079185,
-	-1,0,0,-5.5,2.292275,5.079185,
-	-1,0,0,-5.5,2.292351,5.139267,
-	-1,0,0,-5.5,2.332489,5.048877,
-	-1,0,0,-5.5,2.332489,5.048877,
-	-1,0,0,-5.5,2.292351,5.139267,
-	-1,0,0,-5.5,2.33835,5.116402,
-	-1,0,0,-5.5,2.332489,5.048877,
-	-1,0,0,-5.5,2.33835,5.116402,
-	-1,0,0,-5.5,2.36646,5.011706,
-	-1,0,0,-5.5,2.36646,5.011706,
-	-1,0,0,-5.5,2.33835,5.116402,
-	-1,0,0,-5.5,2.379372,5.085485,
-	-1,0,0,-5.5,2.36646,5.011706,
-	-1,0,0,-5.5,2.379372,5.085485,
-	-1,0,0,-5.5,2.393034,4.968932,
-	-1,0,0,-5.5,2.393034,4.968932,
-	-1,0,0,-5.5,2.379372,5.085485,
-	-1,0,0,-5.5,2.414026,5.047566,
-	-1,0,0,-5.5,2.393034,4.968932,
-	-1,0,0,-5.5,2.414026,5.047566,
-	-1,0,0,-5.5,3.012323,3.730353,
-	-1,0,0,-5.5,3.012323,3.730353,
-	-1,0,0,-5.5,2.414026,5.047566,
-	-1,0,0,-5.5,2.441134,5.003932,
-	-1,0,0,-5.5,3.012323,3.730353,
-	-1,0,0,-5.5,2.441134,5.003932,
-	-1,0,0,-5.5,3.072871,3.740458,
-	-1,0,0,-5.5,3.012323,3.730353,
-	-1,0,0,-5.5,3.072871,3.740458,
-	-0.999991,0,-0.004217,-5.5,3.013942,3.726777,
-	-0.999991,0,-0.004217,-5.5,3.013942,3.726777,
-	-1,0,0,-5.5,3.072871,3.740458,
-	-0.999979,-0.003174,-0.005654,-5.5,3.079063,3.726777,
-	-0.008435,0,-0.999964,-5.066635,3.152109,3.22762,
-	-0.115062,0,-0.993358,-5.136049,3.09,3.228498,
-	-0.217337,0,-0.976097,-5.136049,3.152109,3.228498,
-	-0.115062,0,-0.993358,-5.136049,3.09,3.228498,
-	-0.008435,0,-0.999964,-5.066635,3.152109,3.22762,
-	-0.004217,0,-0.999991,-5.066635,3.09,3.22762,
-	-0.217337,0,-0.976097,-5.136049,3.152109,3.228498,
-	-0.411789,0,-0.911279,-5.265128,3.09,3.271524,
-	-0.503965,0,-0.863724,-5.265128,3.152109,3.271524,
-	-0.411789,0,-0.911279,-5.265128,3.09,3.271524,
-	-0.217337,0,-0.976097,-5.136049,3.152109,3.228498,
-	-0.115062,0,-0.993358,-5.136049,3.09,3.228498,
-	-0.503965,0,-0.863724,-5.265128,3.152109,3.271524,
-	-0.707107,0,-0.707107,-5.375,3.09,3.351777,
-	-0.742826,0,-0.669484,-5.375,3.152109,3.351777,
-	-0.707107,0,-0.707107,-5.375,3.09,3.351777,
-	-0.503965,0,-0.863724,-5.265128,3.152109,3.271524,
-	-0.411789,0,-0.911279,-5.265128,3.09,3.271524,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.807527,0,-0.589831,-5.452667,3.087804,3.458109,
-	-0.911279,0,-0.411789,-5.455253,3.087392,3.461649,
-	-0.807527,0,-0.589831,-5.452667,3.087804,3.458109,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.807527,0,-0.589831,-5.41118,3.09,3.40131,
-	-0.807527,0,-0.589831,-5.41118,3.09,3.40131,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.707107,0,-0.707107,-5.375,3.09,3.351777,
-	-0.707107,0,-0.707107,-5.375,3.09,3.351777,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.742826,0,-0.669484,-5.375,3.152109,3.351777,
-	-0.742826,0,-0.669484,-5.375,3.152109,3.351777,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.807527,0,-0.589831,-5.41373,3.152109,3.404801,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.948683,0,-0.316228,-5.491487,3.070318,3.570354,
-	-0.993064,-0.002828,-0.117538,-5.498279,3.064669,3.590727,
-	-0.948683,0,-0.316228,-5.491487,3.070318,3.570354,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.948683,0,-0.316228,-5.472893,3.08123,3.514569,
-	-0.948683,0,-0.316228,-5.472893,3.08123,3.514569,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.911279,0,-0.411789,-5.455253,3.087392,3.461649,
-	-0.911279,0,-0.411789,-5.455253,3.087392,3.461649,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.948683,0,-0.316228,-5.493784,3.132031,3.577243,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.948683,0,-0.316228,-5.493784,3.132031,3.577243,
-	-0.948683,0,-0.316228,-5.474815,3.143163,3.520337,
-	-0.880629,0,-0.473806,-5.455253,3.149911,3.461649,
-	-0.948683,0,-0.316228,-5.474815,3.143163,3.520337,
-	-0.948683,0,-0.316228,-5.455617,3.149869,3.462742,
-	0.002121,-0.92655,-0.376167,-5,3.035761,3.678568,
-	0.004239,-0.926812,-0.375501,-5.499357,3.034537,3.675953,
-	0.001061,-0.94351,-0.331343,-5.498714,3.055131,3.625129,
-	0.004239,-0.926812,-0.375501,-5.499357,3.034537,3.675953,
-	0.002121,-0.92655,-0.376167,-5,3.035761,3.678568,
-	0.00106,-0.915118,-0.403184,-5.5,3.013942,3.726777,
-	-0.999844,0.016157,-0.007185,-5.5,3.09678,3.687633,
-	-0.999852,-0.007895,-0.015313,-5.498714,3.055131,3.625129,
-	-0.999925,-0.005639,-0.01087,-5.499357,3.034537,3.675953,
-	-0.999852,-0.007895,-0.015313,-5.498714,3.055131,3.625129,
-	-0.999844,0.016157,-0.007185,-5.5,3.09678,3.687633,
-	-0.993064,-0.002828,-0.117538,-5.498279,3.064669,3.590727,
-	-0.993064,-0.002828,-0.117538,-5.498279,3.064669,3.590727,
-	-0.999844,0.016157,-0.007185,-5.5,3.09678,3.687633,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.973406,0.015316,-0.228574,-5.498279,3.128292,3.590727,
-	-0.999844,0.016157,-0.007185,-5.5,3.09678,3.687633,
-	-0.994223,0.106009,0.016812,-5.498815,3.116539,3.633119,
-	-0.999979,-0.003174,-0.005654,-5.5,3.079063,3.726777,
-	-0.999925,-0.005639,-0.01087,-5.499357,3.034537,3.675953,
-	-0.999991,0,-0.004217,-5.5,3.013942,3.726777,
-	-0.999925,-0.005639,-0.01087,-5.499357,3.034537,3.675953,
-	-0.999979,-0.003174,-0.005654,-5.5,3.079063,3.726777,
-	-0.999844,0.016157,-0.007185,-5.5,3.09678,3.687633,
-	0,0.963648,0.267176,-5.498279,3.128292,3.590727,
-	0,0.970208,0.242274,8.7276,3.132031,3.577243,
-	0,0.976128,0.217194,-5.493784,3.132031,3.577243,
-	0,0.970208,0.242274,8.7276,3.132031,3.577243,
-	0,0.963648,0.267176,-5.498279,3.128292,3.590727,
-	0,0.956449,0.291901,8.783476,3.116539,3.633119,
-	0,0.956449,0.291901,8.783476,3.116539,3.633119,
-	0,0.963648,0.267176,-5.498279,3.128292,3.590727,
-	0,0.94861,0.316448,-5.498815,3.116539,3.633119,
-	0,0,-1,8.377977,3.152109,3.22762,
-	0,0,-1,-5,3.09,3.22762,
-	0,0,-1,-5,3.152109,3.22762,
-	0,0,-1,-5,3.09,3.22762,
-	0,0,-1,8.377977,3.152109,3.22762,
-	0,0,-1,8.377977,3.09,3.22762,
-	0,-0.997016,-0.077198,8.608467,3.087804,3.458109,
-	0,-0.999668,-0.025756,-5.41118,3.09,3.40131,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-0.999668,-0.025756,-5.41118,3.09,3.40131,
-	0,-0.997016,-0.077198,8.608467,3.087804,3.458109,
-	0,-0.997016,-0.077198,-5.452667,3.087804,3.458109,
-	0,0.883881,0.467712,-5.5,2.441134,5.003932,
-	0,0.904554,0.42636,8.890816,3.072871,3.740458,
-	0,0.902899,0.429852,-5.5,3.072871,3.740458,
-	0,0.904554,0.42636,8.890816,3.072871,3.740458,
-	0,0.883881,0.467712,-5.5,2.441134,5.003932,
-	0,0.894427,0.447214,9.5,2.768279,4.349643,
-	0,0.894427,0.447214,9.5,2.768279,4.349643,
-	0,0.883881,0.467712,-5.5,2.441134,5.003932,
-	0,0.865241,0.501356,9.5,2.441134,5.003932,
-	0,0.976128,0.217194,-5.493784,3.132031,3.577243,
-	0,0.986016,0.166653,8.670694,3.143163,3.520337,
-	0,0.989982,0.141191,-5.474815,3.143163,3.520337,
-	0,0.986016,0.166653,8.670694,3.143163,3.520337,
-	0,0.976128,0.217194,-5.493784,3.132031,3.577243,
-	0,0.970208,0.242274,8.7276,3.132031,3.577243,
-	0,-0.958309,-0.285734,8.775486,3.055131,3.625129,
-	0,-0.973249,-0.229753,-5.491487,3.070318,3.570354,
-	0,-0.973249,-0.229753,8.720711,3.070318,3.570354,
-	0,-0.973249,-0.229753,-5.491487,3.070318,3.570354,
-	0,-0.958309,-0.285734,8.775486,3.055131,3.625129,
-	0,-0.963648,-0.267176,-5.498279,3.064669,3.590727,
-	0,-0.963648,-0.267176,-5.498279,3.064669,3.590727,
-	0,-0.958309,-0.285734,8.775486,3.055131,3.625129,
-	0.001061,-0.94351,-0.331343,-5.498714,3.055131,3.625129,
-	0,-0.902899,-0.429852,8.880711,3.012323,3.730353,
-	0,-0.877321,-0.479905,-5.5,2.393034,4.968932,
-	0,-0.902899,-0.429852,-5.5,3.012323,3.730353,
-	0,-0.877321,-0.479905,-5.5,2.393034,4.968932,
-	0,-0.902899,-0.429852,8.880711,3.012323,3.730353,
-	0,-0.894427,-0.447214,9.5,2.702679,4.349643,
-	0,-0.877321,-0.479905,-5.5,2.393034,4.968932,
-	0,-0.894427,-0.447214,9.5,2.702679,4.349643,
-	0,-0.872852,-0.487984,9.5,2.393034,4.968932,
-	0,1,0,-5.136049,3.152109,3.228498,
-	0,1,0,-5,3.152109,3.22762,
-	0,1,0,-5.066635,3.152109,3.22762,
-	0,1,0,-5,3.152109,3.22762,
-	0,1,0,-5.136049,3.152109,3.228498,
-	0,1,0,8.377977,3.152109,3.22762,
-	0,1,0,8.377977,3.152109,3.22762,
-	0,1,0,-5.136049,3.152109,3.228498,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,1,0,-5.136049,3.152109,3.228498,
-	0,1,0,-5.265128,3.152109,3.271524,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,1,0,-5.265128,3.152109,3.271524,
-	0,1,0,-5.375,3.152109,3.351777,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,1,0,-5.375,3.152109,3.351777,
-	0,0.999813,0.019317,-5.41373,3.152109,3.404801,
-	0,-0.926282,-0.376831,8.828926,3.035761,3.678568,
-	0.00106,-0.915118,-0.403184,-5.5,3.013942,3.726777,
-	0.002121,-0.92655,-0.376167,-5,3.035761,3.678568,
-	0.00106,-0.915118,-0.403184,-5.5,3.013942,3.726777,
-	0,-0.926282,-0.376831,8.828926,3.035761,3.678568,
-	0,-0.902899,-0.429852,8.880711,3.012323,3.730353,
-	0.00106,-0.915118,-0.403184,-5.5,3.013942,3.726777,
-	0,-0.902899,-0.429852,8.880711,3.012323,3.730353,
-	0,-0.902899,-0.429852,-5.5,3.012323,3.730353,
-	0,-0.988081,-0.153935,8.664927,3.08123,3.514569,
-	0,-0.973249,-0.229753,-5.491487,3.070318,3.570354,
-	0,-0.988081,-0.153935,-5.472893,3.08123,3.514569,
-	0,-0.973249,-0.229753,-5.491487,3.070318,3.570354,
-	0,-0.988081,-0.153935,8.664927,3.08123,3.514569,
-	0,-0.973249,-0.229753,8.720711,3.070318,3.570354,
-	0,0.999254,0.038628,-5.455253,3.149911,3.461649,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,0.999813,0.019317,-5.41373,3.152109,3.404801,
-	0,0.999917,0.012878,8.555159,3.152109,3.404801,
-	0,0.999254,0.038628,-5.455253,3.149911,3.461649,
-	0,0.997016,0.077198,8.613099,3.149869,3.462742,
-	0,0.997016,0.077198,8.613099,3.149869,3.462742,
-	0,0.999254,0.038628,-5.455253,3.149911,3.461649,
-	0,0.997016,0.077198,-5.455617,3.149869,3.462742,
-	0,0.92135,0.388735,-5.5,3.09678,3.687633,
-	0,0.904554,0.42636,8.890816,3.072871,3.740458,
-	0,0.93106,0.364865,8.83799,3.09678,3.687633,
-	0,0.904554,0.42636,8.890816,3.072871,3.740458,
-	0,0.92135,0.388735,-5.5,3.09678,3.687633,
-	0,0.911034,0.41233,-5.5,3.079063,3.726777,
-	0,0.904554,0.42636,8.890816,3.072871,3.740458,
-	0,0.911034,0.41233,-5.5,3.079063,3.726777,
-	0,0.902899,0.429852,-5.5,3.072871,3.740458,
-	0,-0.997016,-0.077198,8.608467,3.087804,3.458109,
-	0,-0.99329,-0.115653,-5.455253,3.087392,3.461649,
-	0,-0.997016,-0.077198,-5.452667,3.087804,3.458109,
-	0,-0.99329,-0.115653,-5.455253,3.087392,3.461649,
-	0,-0.997016,-0.077198,8.608467,3.087804,3.458109,
-	0,-0.988081,-0.153935,8.664927,3.08123,3.514569,
-	0,-0.99329,-0.115653,-5.455253,3.087392,3.461649,
-	0,-0.988081,-0.153935,8.664927,3.08123,3.514569,
-	0,-0.988081,-0.153935,-5.472893,3.08123,3.514569,
-	0,0.94861,0.316448,-5.498815,3.116539,3.633119,
-	0,0.93106,0.364865,8.83799,3.09678,3.687633,
-	0,0.956449,0.291901,8.783476,3.116539,3.633119,
-	0,0.93106,0.364865,8.83799,3.09678,3.687633,
-	0,0.94861,0.316448,-5.498815,3.116539,3.633119,
-	0,0.92135,0.388735,-5.5,3.09678,3.687633,
-	0,-0.926282,-0.376831,8.828926,3.035761,3.678568,
-	0.001061,-0.94351,-0.331343,-5.498714,3.055131,3.625129,
-	0,-0.958309,-0.285734,8.775486,3.055131,3.625129,
-	0.001061,-0.94351,-0.331343,-5.498714,3.055131,3.625129,
-	0,-0.926282,-0.376831,8.828926,3.035761,3.678568,
-	0.002121,-0.92655,-0.376167,-5,3.035761,3.678568,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-1,0,-5,3.09,3.22762,
-	0,-1,0,8.377977,3.09,3.22762,
-	0,-1,0,-5,3.09,3.22762,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-1,0,-5.066635,3.09,3.22762,
-	0,-1,0,-5.066635,3.09,3.22762,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-1,0,-5.136049,3.09,3.228498,
-	0,-1,0,-5.136049,3.09,3.228498,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-1,0,-5.265128,3.09,3.271524,
-	0,-1,0,-5.265128,3.09,3.271524,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-1,0,-5.375,3.09,3.351777,
-	0,-1,0,-5.375,3.09,3.351777,
-	0,-0.999985,-0.005519,8.551667,3.09,3.40131,
-	0,-0.999668,-0.025756,-5.41118,3.09,3.40131,
-	0,0.989982,0.141191,-5.474815,3.143163,3.520337,
-	0,0.997016,0.077198,8.613099,3.149869,3.462742,
-	0,0.997016,0.077198,-5.455617,3.149869,3.462742,
-	0,0.997016,0.077198,8.613099,3.149869,3.462742,
-	0,0.989982,0.141191,-5.474815,3.143163,3.520337,
-	0,0.986016,0.166653,8.670694,3.143163,3.520337,
-	1,0,0,9.5,2.148601,5.12,
-	1,0,0,9.5,0,5.158037,
-	1,0,0,9.5,0,5.12,
-	1,0,0,9.5,0,5.158037,
-	1,0,0,9.5,2.148601,5.12,
-	1,0,0,9.5,2.191788,5.158037,
-	1,0,0,9.5,2.191788,5.158037,
-	1,0,0,9.5,2.148601,5.12,
-	1,0,0,9.5,2.198743,5.115361,
-	1,0,0,9.5,2.191788,5.158037,
-	1,0,0,9.5,2.198743,5.115361,
-	1,0,0,9.5,2.242938,5.153304,
-	1,0,0,9.5,2.242938,5.153304,
-	1,0,0,9.5,2.198743,5.115361,
-	1,0,0,9.5,2.247183,5.1016,
-	1,0,0,9.5,2.242938,5.153304,
-	1,0,0,9.5,2.247183,5.1016,
-	1,0,0,9.5,2.292351,5.139267,
-	1,0,0,9.5,2.292351,5.139267,
-	1,0,0,9.5,2.247183,5.1016,
-	1,0,0,9.5,2.292275,5.079185,
-	1,0,0,9.5,2.292351,5.139267,
-	1,0,0,9.5,2.292275,5.079185,
-	1,0,0,9.5,2.332489,5.048877,
-	1,0,0,9.5,2.292351,5.139267,
-	1,0,0,9.5,2.332489,5.048877,
-	1,0,0,9.5,2.33835,5.116402,
-	1,0,0,9.5,2.33835,5.116402,
-	1,0,0,9.5,2.332489,5.048877,
-	1,0,0,9.5,2.36646,5.011706,
-	1,0,0,9.5,2.33835,5.116402,
-	1,0,0,9.5,2.36646,5.011706,
-	1,0,0,9.5,2.379372,5.085485,
-	1,0,0,9.5,2.379372,5.085485,
-	1,0,0,9.5,2.36646,5.011706,
-	1,0,0,9.5,2.393034,4.968932,
-	1,0,0,9.5,2.379372,5.085485,
-	1,0,0,9.5,2.393034,4.968932,
-	1,0,0,9.5,2.414026,5.047566,
-	1,0,0,9.5,2.414026,5.047566,
-	1,0,0,9.5,2.393034,4.968932,
-	1,0,0,9.5,2.702679,4.349643,
-	1,0,0,9.5,2.414026,5.047566,
-	1,0,0,9.5,2.702679,4.349643,
-	1,0,0,9.5,2.441134,5.003932,
-	1,0,0,9.5,2.441134,5.003932,
-	1,0,0,9.5,2.702679,4.349643,
-	1,0,0,9.5,2.768279,4.349643,
-	0.707107,0,-0.707107,8.377977,3.152109,3.22762,
-	0.707107,0,-0.707107,8.551667,3.09,3.40131,
-	0.707107,0,-0.707107,8.377977,3.09,3.22762,
-	0.707107,0,-0.707107,8.551667,3.09,3.40131,
-	0.707107,0,-0.707107,8.377977,3.152109,3.22762,
-	0.707107,0,-0.707107,8.555159,3.152109,3.404801,
-	0.707107,0,-0.707107,8.551667,3.09,3.40131,
-	0.707107,0,-0.707107,8.555159,3.152109,3.404801,
-	0.707107,0,-0.707107,8.608467,3.087804,3.458109,
-	0.707107,0,-0.707107,8.608467,3.087804,3.458109,
-	0.707107,0,-0.707107,8.555159,3.152109,3.404801,
-	0.707107,0,-0.707107,8.613099,3.149869,3.462742,
-	0.707107,0,-0.707107,8.608467,3.087804,3.458109,
-	0.707107,0,-0.707107,8.613099,3.149869,3.462742,
-	0.707107,0,-0.707107,8.664927,3.08123,3.514569,
-	0.707107,0,-0.707107,8.664927,3.08123,3.514569,
-	0.707107,0,-0.707107,8.613099,3.149869,3.462742,
-	0.707107,0,-0.707107,8.670694,3.143163,3.520337,
-	0.707107,0,-0.707107,8.664927,3.08123,3.514569,
-	0.707107,0,-0.707107,8.670694,3.143163,3.520337,
-	0.707107,0,-0.707107,8.720711,3.070318,3.570354,
-	0.707107,0,-0.707107,8.720711,3.070318,3.570354,
-	0.707107,0,-0.707107,8.670694,3.143163,3.520337,
-	0.707107,0,-0.707107,8.7276,3.132031,3.577243,
-	0.707107,0,-0.707107,8.720711,3.070318,3.570354,
-	0.707107,0,-0.707107,8.7276,3.132031,3.577243,
-	0.707107,0,-0.707107,8.775486,3.055131,3.625129,
-	0.707107,0,-0.707107,8.775486,3.055131,3.625129,
-	0.707107,0,-0.707107,8.7276,3.132031,3.577243,
-	0.707107,0,-0.707107,8.783476,3.116539,3.633119,
-	0.707107,0,-0.707107,8.775486,3.055131,3.625129,
-	0.707107,0,-0.707107,8.783476,3.116539,3.633119,
-	0.707107,0,-0.707107,8.828926,3.035761,3.678568,
-	0.707107,0,-0.707107,8.828926,3.035761,3.678568,
-	0.707107,0,-0.707107,8.783476,3.116539,3.633119,
-	0.707107,0,-0.707107,8.83799,3.09678,3.687633,
-	0.707107,0,-0.707107,8.828926,3.035761,3.678568,
-	0.707107,0,-0.707107,8.83799,3.09678,3.687633,
-	0.707107,0,-0.707107,8.880711,3.012323,3.730353,
-	0.707107,0,-0.707107,8.880711,3.012323,3.730353,
-	0.707107,0,-0.707107,8.83799,3.09678,3.687633,
-	0.707107,0,-0.707107,8.890816,3.072871,3.740458,
-	0.707107,0,-0.707107,8.880711,3.012323,3.730353,
-	0.707107,0,-0.707107,8.890816,3.072871,3.740458,
-	0.707107,0,-0.707107,9.5,2.702679,4.349643,
-	0.707107,0,-0.707107,9.5,2.702679,4.349643,
-	0.707107,0,-0.707107,8.890816,3.072871,3.740458,
-	0.707107,0,-0.707107,9.5,2.768279,4.349643
-};
-static const struct gllist seccam_cap_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 468, seccam_cap_data, 0
-};
-const struct gllist *seccam_cap = &seccam_cap_frame;
-
-static const float seccam_hinge_data[] = {
-	0.843272,0,-0.537487,0.649519,0.375,-0.375,
-	0.707107,0,-0.707107,0.53033,0.625,-0.53033,
-	0.887114,0,-0.461551,0.649519,0.625,-0.375,
-	0.707107,0,-0.707107,0.53033,0.625,-0.53033,
-	0.843272,0,-0.537487,0.649519,0.375,-0.375,
-	0.707107,0,-0.707107,0.53033,0.375,-0.53033,
-	0.991445,0,-0.130526,0.75,0.375,0,
-	0.976344,0,-0.216222,0.724444,0.625,-0.194114,
-	0.991445,0,-0.130526,0.75,0.625,0,
-	0.976344,0,-0.216222,0.724444,0.625,-0.194114,
-	0.991445,0,-0.130526,0.75,0.375,0,
-	0.95365,0,-0.300918,0.724444,0.375,-0.194114,
-	0.537487,0,-0.843272,0.375,0.375,-0.649519,
-	0.707107,0,-0.707107,0.53033,0.625,-0.53033,
-	0.707107,0,-0.707107,0.53033,0.375,-0.53033,
-	0.707107,0,-0.707107,0.53033,0.625,-0.53033,
-	0.537487,0,-0.843272,0.375,0.375,-0.649519,
-	0.461551,0,-0.887114,0.375,0.625,-0.649519,
-	-0.976344,0,-0.216222,-0.724444,0.375,-0.194114,
-	-0.991445,0,-0.130526,-0.75,0.625,0,
-	-0.95365,0,-0.300918,-0.724444,0.625,-0.194114,
-	-0.991445,0,-0.130526,-0.75,0.625,0,
-	-0.976344,0,-0.216222,-0.724444,0.375,-0.194114,
-	-0.991445,0,-0.130526,-0.75,0.375,0,
-	0.300918,0,-0.95365,0.194114,0.375,-0.724444,
-	0.461551,0,-0.887114,0.375,0.625,-0.649519,
-	0.537487,0,-0.843272,0.375,0.375,-0.649519,
-	0.461551,0,-0.887114,0.375,0.625,-0.649519,
-	0.300918,0,-0.95365,0.194114,0.375,-0.724444,
-	0.216222,0,-0.976344,0.194114,0.625,-0.724444,
-	0,1,0,-0.194114,0.625,-0.724444,
-	0,1,0,0.194114,0.625,-0.724444,
-	0,1,0,0,0.625,-0.75,
-	0,1,0,0.194114,0.625,-0.724444,
-	0,1,0,-0.194114,0.625,-0.724444,
-	0,1,0,-0.375,0.625,-0.649519,
-	0,1,0,0.194114,0.625,-0.724444,
-	0,1,0,-0.375,0.625,-0.649519,
-	0,1,0,0.375,0.625,-0.649519,
-	0,1,0,0.375,0.625,-0.649519,
-	0,1,0,-0.375,0.625,-0.649519,
-	0,1,0,-0.53033,0.625,-0.53033,
-	0,1,0,0.375,0.625,-0.649519,
-	0,1,0,-0.53033,0.625,-0.53033,
-	0,1,0,0.53033,0.625,-0.53033,
-	0,1,0,0.53033,0.625,-0.53033,
-	0,1,0,-0.53033,0.625,-0.53033,
-	0,1,0,-0.649519,0.625,-0.375,
-	0,1,0,0.53033,0.625,-0.53033,
-	0,1,0,-0.649519,0.625,-0.375,
-	0,1,0,0.649519,0.625,-0.375,
-	0,1,0,0.649519,0.625,-0.375,
-	0,1,0,-0.649519,0.625,-0.375,
-	0,1,0,-0.724444,0.625,-0.194114,
-	0,1,0,0.649519,0.625,-0.375,
-	0,1,0,-0.724444,0.625,-0.194114,
-	0,1,0,0.724444,0.625,-0.194114,
-	0,1,0,0.724444,0.625,-0.194114,
-	0,1,0,-0.724444,0.625,-0.194114,
-	0,1,0,0.75,0.625,0,
-	0,1,0,0.75,0.625,0,
-	0,1,0,-0.724444,0.625,-0.194114,
-	0,1,0,-0.75,0.625,0,
-	-0.707107,0,-0.707107,-0.53033,0.375,-0.53033,
-	-0.537487,0,-0.843272,-0.375,0.625,-0.649519,
-	-0.461551,0,-0.887114,-0.375,0.375,-0.649519,
-	-0.537487,0,-0.843272,-0.375,0.625,-0.649519,
-	-0.707107,0,-0.707107,-0.53033,0.375,-0.53033,
-	-0.707107,0,-0.707107,-0.53033,0.625,-0.53033,
-	-0.707107,0,-0.707107,-0.53033,0.375,-0.53033,
-	-0.843272,0,-0.537487,-0.649519,0.625,-0.375,
-	-0.707107,0,-0.707107,-0.53033,0.625,-0.53033,
-	-0.843272,0,-0.537487,-0.649519,0.625,-0.375,
-	-0.707107,0,-0.707107,-0.53033,0.375,-0.53033,
-	-0.887114,0,-0.461551,-0.649519,0.375,-0.375,
-	-0.461551,0,-0.887114,-0.375,0.375,-0.649519,
-	-0.300918,0,-0.95365,-0.194114,0.625,-0.724444,
-	-0.216222,0,-0.976344,-0.194114,0.375,-0.724444,
-	-0.300918,0,-0.95365,-0.194114,0.625,-0.724444,
-	-0.461551,0,-0.887114,-0.375,0.375,-0.649519,
-	-0.537487,0,-0.843272,-0.375,0.625,-0.649519,
-	-0.216222,0,-0.976344,-0.194114,0.375,-0.724444,
-	-0.043842,0,-0.999038,0,0.625,-0.75,
-	0.043842,0,-0.999038,0,0.375,-0.75,
-	-0.043842,0,-0.999038,0,0.625,-0.75,
-	-0.216222,0,-0.976344,-0.194114,0.375,-0.724444,
-	-0.300918,0,-0.95365,-0.194114,0.625,-0.724444,
-	0.95365,0,-0.300918,0.724444,0.375,-0.194114,
-	0.887114,0,-0.461551,0.649519,0.625,-0.375,
-	0.976344,0,-0.216222,0.724444,0.625,-0.194114,
-	0.887114,0,-0.461551,0.649519,0.625,-0.375,
-	0.95365,0,-0.300918,0.724444,0.375,-0.194114,
-	0.843272,0,-0.537487,0.649519,0.375,-0.375,
-	0.043842,0,-0.999038,0,0.375,-0.75,
-	0.216222,0,-0.976344,0.194114,0.625,-0.724444,
-	0.300918,0,-0.95365,0.194114,0.375,-0.724444,
-	0.216222,0,-0.976344,0.194114,0.625,-0.724444,
-	0.043842,0,-0.999038,0,0.375,-0.75,
-	-0.043842,0,-0.999038,0,0.625,-0.75,
-	-0.887114,0,-0.461551,-0.649519,0.375,-0.375,
-	-0.95365,0,-0.300918,-0.724444,0.625,-0.194114,
-	-0.843272,0,-0.537487,-0.649519,0.625,-0.375,
-	-0.95365,0,-0.300918,-0.724444,0.625,-0.194114,
-	-0.887114,0,-0.461551,-0.649519,0.375,-0.375,
-	-0.976344,0,-0.216222,-0.724444,0.375,-0.194114,
-	0,-1,0,0.194114,0.375,-0.724444,
-	0,-1,0,-0.194114,0.375,-0.724444,
-	0,-1,0,0,0.375,-0.75,
-	0,-1,0,-0.194114,0.375,-0.724444,
-	0,-1,0,0.194114,0.375,-0.724444,
-	0,-1,0,0.375,0.375,-0.649519,
-	0,-1,0,-0.194114,0.375,-0.724444,
-	0,-1,0,0.375,0.375,-0.649519,
-	0,-1,0,-0.375,0.375,-0.649519,
-	0,-1,0,-0.375,0.375,-0.649519,
-	0,-1,0,0.375,0.375,-0.649519,
-	0,-1,0,0.53033,0.375,-0.53033,
-	0,-1,0,-0.375,0.375,-0.649519,
-	0,-1,0,0.53033,0.375,-0.53033,
-	0,-1,0,-0.53033,0.375,-0.53033,
-	0,-1,0,-0.53033,0.375,-0.53033,
-	0,-1,0,0.53033,0.375,-0.53033,
-	0,-1,0,0.649519,0.375,-0.375,
-	0,-1,0,-0.53033,0.375,-0.53033,
-	0,-1,0,0.649519,0.375,-0.375,
-	0,-1,0,-0.649519,0.375,-0.375,
-	0,-1,0,-0.649519,0.375,-0.375,
-	0,-1,0,0.649519,0.375,-0.375,
-	0,-1,0,0.724444,0.375,-0.194114,
-	0,-1,0,-0.649519,0.375,-0.375,
-	0,-1,0,0.724444,0.375,-0.194114,
-	0,-1,0,-0.724444,0.375,-0.194114,
-	0,-1,0,-0.724444,0.375,-0.194114,
-	0,-1,0,0.724444,0.375,-0.194114,
-	0,-1,0,0.75,0.375,0,
-	0,-1,0,-0.724444,0.375,-0.194114,
-	0,-1,0,0.75,0.375,0,
-	0,-1,0,-0.75,0.375,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0.965926,0.258819,0,
-	0,0,-1,1,0,0,
-	0,0,-1,0.965926,0.258819,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0.866025,0.5,0,
-	0,0,-1,0.866025,0.5,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0.707107,0.707107,0,
-	0,0,-1,0.707107,0.707107,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0.5,0.866025,0,
-	0,0,-1,0.5,0.866025,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0.258819,0.965926,0,
-	0,0,-1,0.258819,0.965926,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,0,1,0,
-	0,0,-1,0,1,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,-0.258819,0.965926,0,
-	0,0,-1,-0.258819,0.965926,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,-0.5,0.866025,0,
-	0,0,-1,-0.5,0.866025,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,-0.707107,0.707107,0,
-	0,0,-1,-0.707107,0.707107,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,-0.866025,0.5,0,
-	0,0,-1,-0.866025,0.5,0,
-	0,0,-1,-1,0,0,
-	0,0,-1,-0.965926,0.258819,0,
-	0.043842,0.999038,0,0,1,1,
-	0.216222,0.976344,0,0.258819,0.965926,0,
-	-0.043842,0.999038,0,0,1,0,
-	0.216222,0.976344,0,0.258819,0.965926,0,
-	0.043842,0.999038,0,0,1,1,
-	0.300918,0.95365,0,0.258819,0.965926,1,
-	-0.707107,0.707107,0,-0.707107,0.707107,1,
-	-0.537487,0.843272,0,-0.5,0.866025,0,
-	-0.707107,0.707107,0,-0.707107,0.707107,0,
-	-0.537487,0.843272,0,-0.5,0.866025,0,
-	-0.707107,0.707107,0,-0.707107,0.707107,1,
-	-0.461551,0.887114,0,-0.5,0.866025,1,
-	-0.461551,0.887114,0,-0.5,0.866025,1,
-	-0.300918,0.95365,0,-0.258819,0.965926,0,
-	-0.537487,0.843272,0,-0.5,0.866025,0,
-	-0.300918,0.95365,0,-0.258819,0.965926,0,
-	-0.461551,0.887114,0,-0.5,0.866025,1,
-	-0.216222,0.976344,0,-0.258819,0.965926,1,
-	0.300918,0.95365,0,0.258819,0.965926,1,
-	0.461551,0.887114,0,0.5,0.866025,0,
-	0.216222,0.976344,0,0.258819,0.965926,0,
-	0.461551,0.887114,0,0.5,0.866025,0,
-	0.300918,0.95365,0,0.258819,0.965926,1,
-	0.537487,0.843272,0,0.5,0.866025,1,
-	0.991445,0.130526,0,1,0,1,
-	0.976344,0.216222,0,0.965926,0.258819,0,
-	0.95365,0.300918,0,0.965926,0.258819,1,
-	0.976344,0.216222,0,0.965926,0.258819,0,
-	0.991445,0.130526,0,1,0,1,
-	0.991445,0.130526,0,1,0,0,
-	0.843272,0.537487,0,0.866025,0.5,1,
-	0.707107,0.707107,0,0.707107,0.707107,0,
-	0.707107,0.707107,0,0.707107,0.707107,1,
-	0.707107,0.707107,0,0.707107,0.707107,0,
-	0.843272,0.537487,0,0.866025,0.5,1,
-	0.887114,0.461551,0,0.866025,0.5,0,
-	-0.216222,0.976344,0,-0.258819,0.965926,1,
-	-0.043842,0.999038,0,0,1,0,
-	-0.300918,0.95365,0,-0.258819,0.965926,0,
-	-0.043842,0.999038,0,0,1,0,
-	-0.216222,0.976344,0,-0.258819,0.965926,1,
-	0.043842,0.999038,0,0,1,1,
-	-0.95365,0.300918,0,-0.965926,0.258819,0,
-	-0.887114,0.461551,0,-0.866025,0.5,1,
-	-0.843272,0.537487,0,-0.866025,0.5,0,
-	-0.887114,0.461551,0,-0.866025,0.5,1,
-	-0.95365,0.300918,0,-0.965926,0.258819,0,
-	-0.976344,0.216222,0,-0.965926,0.258819,1,
-	-0.843272,0.537487,0,-0.866025,0.5,0,
-	-0.707107,0.707107,0,-0.707107,0.707107,1,
-	-0.707107,0.707107,0,-0.707107,0.707107,0,
-	-0.707107,0.707107,0,-0.707107,0.707107,1,
-	-0.843272,0.537487,0,-0.866025,0.5,0,
-	-0.887114,0.461551,0,-0.866025,0.5,1,
-	0.537487,0.843272,0,0.5,0.866025,1,
-	0.707107,0.707107,0,0.707107,0.707107,0,
-	0.461551,0.887114,0,0.5,0.866025,0,
-	0.707107,0.707107,0,0.707107,0.707107,0,
-	0.537487,0.843272,0,0.5,0.866025,1,
-	0.707107,0.707107,0,0.707107,0.707107,1,
-	0.95365,0.300918,0,0.965926,0.258819,1,
-	0.887114,0.461551,0,0.866025,0.5,0,
-	0.843272,0.537487,0,0.866025,0.5,1,
-	0.887114,0.461551,0,0.866025,0.5,0,
-	0.95365,0.300918,0,0.965926,0.258819,1,
-	0.976344,0.216222,0,0.965926,0.258819,0,
-	-0.991445,0.130526,0,-1,0,0,
-	-0.976344,0.216222,0,-0.965926,0.258819,1,
-	-0.95365,0.300918,0,-0.965926,0.258819,0,
-	-0.976344,0.216222,0,-0.965926,0.258819,1,
-	-0.991445,0.130526,0,-1,0,0,
-	-0.991445,0.130526,0,-1,0,1
-};
-static const struct gllist seccam_hinge_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 243, seccam_hinge_data, 0
-};
-const struct gllist *seccam_hinge = &seccam_hinge_frame;
-
-static const float seccam_lens_data[] = {
-	1,0,0,7.55,-1.923472,1.31269,
-	1,0,0,7.55,2.033558,4.687325,
-	1,0,0,7.55,-1.923714,4.687325,
-	1,0,0,7.55,2.033558,4.687325,
-	1,0,0,7.55,-1.923472,1.31269,
-	1,0,0,7.55,2.0338,1.31269
-};
-static const struct gllist seccam_lens_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 6, seccam_lens_data, 0
-};
-const struct gllist *seccam_lens = &seccam_lens_frame;
-
-static const float seccam_pipe_data[] = {
-	-0.752339,0.658776,0,-0.265165,0.265165,0.4375,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.947173,0.320722,0,-0.346455,0.143506,0.4375,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.752339,0.658776,0,-0.265165,0.265165,0.4375,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.442968,0.896538,0,-0.143506,0.346455,0.4375,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	-0.442968,0.896538,0,-0.143506,0.346455,0.4375,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.752339,0.658776,0,-0.265165,0.265165,0.4375,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	-0.066159,0.997809,0,0,0.375,0.4375,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	-0.066159,0.997809,0,0,0.375,0.4375,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	-0.442968,0.896538,0,-0.143506,0.346455,0.4375,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	0.320722,0.947173,0,0.143506,0.346455,0.4375,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.320722,0.947173,0,0.143506,0.346455,0.4375,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	-0.066159,0.997809,0,0,0.375,0.4375,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.707107,0.707107,0,0.265165,0.265165,0.4375,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.707107,0.707107,0,0.265165,0.265165,0.4375,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.320722,0.947173,0,0.143506,0.346455,0.4375,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	0.707107,0.707107,0,0.265165,0.265165,0.4375,
-	0.947173,0.320722,0,0.346455,0.143506,0.4375,
-	0.707107,0.707107,0,0.265165,0.265165,0.4375,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.979876,0.195414,-0.040695,0.375,0,-1.804641,
-	0.947173,0.320722,0,0.346455,0.143506,0.4375,
-	0.980785,0.19509,0,0.375,0,0.4375,
-	0.947173,0.320722,0,0.346455,0.143506,0.4375,
-	0.979876,0.195414,-0.040695,0.375,0,-1.804641,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	-0.947173,0.320722,0,-0.346455,0.143506,0.4375,
-	-0.979876,0.195414,0.040695,-0.375,0,-1.757859,
-	-0.980785,0.19509,0,-0.375,0,0.4375,
-	-0.979876,0.195414,0.040695,-0.375,0,-1.757859,
-	-0.947173,0.320722,0,-0.346455,0.143506,0.4375,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.704865,0.70779,0.046895,-0.265165,0.265165,-1.76471,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	-0.381068,0.924135,0.027592,-0.143506,0.346455,-1.772299,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	0.000257,0.999991,0.00412,0,0.375,-1.78125,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.381543,0.924135,-0.019977,0.143506,0.346455,-1.790201,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	0.704059,0.707717,-0.058632,0.265165,0.265165,-1.79779,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.953546,0.197386,-0.227573,0.277106,0,-2.586284,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	0.979876,0.195414,-0.040695,0.375,0,-1.804641,
-	0.921725,0.383318,-0.05908,0.346455,0.143506,-1.802861,
-	0.953546,0.197386,-0.227573,0.277106,0,-2.586284,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.953546,0.197386,0.227573,-0.451541,0,-2.36901,
-	-0.979876,0.195414,0.040695,-0.375,0,-1.757859,
-	-0.953546,0.197386,0.227573,-0.451541,0,-2.36901,
-	-0.921725,0.383318,0.05908,-0.346455,0.143506,-1.759639,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.558784,0.739142,0.376071,-0.614405,0.265165,-2.951841,
-	-0.558784,0.739142,0.376071,-0.614405,0.265165,-2.951841,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	-0.558784,0.739142,0.376071,-0.614405,0.265165,-2.951841,
-	-0.670724,0.711915,0.208102,-0.344833,0.265165,-2.400829,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	-0.35955,0.925667,0.117746,-0.226638,0.346455,-2.436073,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	0.003116,0.999941,0.010449,-0.087217,0.375,-2.477647,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.365318,0.925667,-0.098401,0.052203,0.346455,-2.51922,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	0.661307,0.711395,-0.237887,0.170398,0.265165,-2.554465,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.82814,0.197386,-0.524617,-0.086272,0,-3.329037,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	0.953546,0.197386,-0.227573,0.277106,0,-2.586284,
-	0.882346,0.387175,-0.26751,0.249374,0.143506,-2.578014,
-	0.82814,0.197386,-0.524617,-0.086272,0,-3.329037,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.797706,0.197679,0.569726,-0.705019,0,-2.887125,
-	-0.953546,0.197386,0.227573,-0.451541,0,-2.36901,
-	-0.797706,0.197679,0.569726,-0.705019,0,-2.887125,
-	-0.882346,0.387175,0.26751,-0.423809,0.143506,-2.377279,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.558784,0.739142,0.376071,-0.614405,0.265165,-2.951841,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.558784,0.739142,0.376071,-0.614405,0.265165,-2.951841,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	-0.301902,0.925667,0.228024,-0.514037,0.346455,-3.023525,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	0.006337,0.999941,0.008873,-0.395645,0.375,-3.108081,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.313635,0.925667,-0.211597,-0.277253,0.346455,-3.192637,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	0.548361,0.711395,-0.439564,-0.176885,0.265165,-3.264321,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	0.613149,0.197386,-0.76491,-0.670963,0,-3.913728,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.613149,0.197386,-0.76491,-0.670963,0,-3.913728,
-	0.747834,0.387175,-0.539295,-0.109821,0.143506,-3.312218,
-	0.82814,0.197386,-0.524617,-0.086272,0,-3.329037,
-	-0.797706,0.197679,0.569726,-0.705019,0,-2.887125,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.524617,0.197386,0.82814,-1.112875,0,-3.294981,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.797706,0.197679,0.569726,-0.705019,0,-2.887125,
-	-0.727589,0.447862,0.519648,-0.681469,0.143506,-2.903944,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.439564,0.711395,0.548361,-1.048159,0.265165,-3.385595,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	-0.211597,0.925667,0.313635,-0.976475,0.346455,-3.485963,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	0.008873,0.999941,0.006337,-0.891919,0.375,-3.604355,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.228024,0.925667,-0.301902,-0.807363,0.346455,-3.722747,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.376096,0.711395,-0.593691,-0.735679,0.265165,-3.823115,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.331829,0.197386,-0.922458,-1.413716,0,-4.277106,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.331829,0.197386,-0.922458,-1.413716,0,-4.277106,
-	0.532425,0.387175,-0.752741,-0.687782,0.143506,-3.890179,
-	0.613149,0.197386,-0.76491,-0.670963,0,-3.913728,
-	-0.524617,0.197386,0.82814,-1.112875,0,-3.294981,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.227573,0.197386,0.953546,-1.63099,0,-3.548459,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.524617,0.197386,0.82814,-1.112875,0,-3.294981,
-	-0.539295,0.387175,0.747834,-1.096056,0.143506,-3.318531,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	-0.237887,0.711395,0.661307,-1.599171,0.265165,-3.655167,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	-0.098401,0.925667,0.365318,-1.563927,0.346455,-3.773362,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0.010449,0.999941,0.003116,-1.522353,0.375,-3.912783,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0.117746,0.925667,-0.35955,-1.48078,0.346455,-4.052203,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0.163146,0.711395,-0.683594,-1.445535,0.265165,-4.170398,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.08139,0.195414,-0.977338,-2.195359,0,-4.375,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0.08139,0.195414,-0.977338,-2.195359,0,-4.375,
-	0.259419,0.387175,-0.884758,-1.421986,0.143506,-4.249374,
-	0.331829,0.197386,-0.922458,-1.413716,0,-4.277106,
-	-0.227573,0.197386,0.953546,-1.63099,0,-3.548459,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545,
-	-0.040695,0.195414,0.979876,-2.242141,0,-3.625,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545,
-	-0.227573,0.197386,0.953546,-1.63099,0,-3.548459,
-	-0.26751,0.387175,0.882346,-1.622721,0.143506,-3.576191,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545,
-	0,0.707107,0.707107,-7.983022,0.265165,-3.734835,
-	0,0.320722,0.947173,-7.983022,0.143506,-3.653545,
-	0,0.707107,0.707107,-7.983022,0.265165,-3.734835,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	0,0.707107,0.707107,-7.983022,0.265165,-3.734835,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	0,0.947173,0.320722,-7.983022,0.346455,-3.856494,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	0,0.707107,0.707107,-7.983022,0.265165,-3.734835,
-	-0.058632,0.707717,0.704059,-2.23529,0.265165,-3.734835,
-	0,0.947173,0.320722,-7.983022,0.346455,-3.856494,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0,0.997809,-0.066159,-7.983022,0.375,-4,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0,0.947173,0.320722,-7.983022,0.346455,-3.856494,
-	-0.019977,0.924135,0.381543,-2.227701,0.346455,-3.856494,
-	0,0.997809,-0.066159,-7.983022,0.375,-4,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0,0.896538,-0.442968,-7.983022,0.346455,-4.143506,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0,0.997809,-0.066159,-7.983022,0.375,-4,
-	0.00412,0.999991,0.000257,-2.21875,0.375,-4,
-	0,0.896538,-0.442968,-7.983022,0.346455,-4.143506,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0,0.707107,-0.707107,-7.983022,0.265165,-4.265165,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0,0.896538,-0.442968,-7.983022,0.346455,-4.143506,
-	0.027592,0.924135,-0.381068,-2.209799,0.346455,-4.143506,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0,0.442968,-0.896538,-7.983022,0.143506,-4.346455,
-	0,0.707107,-0.707107,-7.983022,0.265165,-4.265165,
-	0,0.442968,-0.896538,-7.983022,0.143506,-4.346455,
-	0.029316,0.707717,-0.705888,-2.20221,0.265165,-4.265165,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0,0.19509,-0.980785,-7.983022,0,-4.375,
-	0,0.442968,-0.896538,-7.983022,0.143506,-4.346455,
-	0,0.19509,-0.980785,-7.983022,0,-4.375,
-	0.055921,0.383318,-0.921922,-2.197139,0.143506,-4.346455,
-	0.08139,0.195414,-0.977338,-2.195359,0,-4.375,
-	-0.040695,0.195414,0.979876,-2.242141,0,-3.625,
-	0,0.320722,0.947173,-7.983022,0.143506,-3.653545,
-	0,0.19509,0.980785,-7.983022,0,-3.625,
-	0,0.320722,0.947173,-7.983022,0.143506,-3.653545,
-	-0.040695,0.195414,0.979876,-2.242141,0,-3.625,
-	-0.05908,0.383318,0.921725,-2.240361,0.143506,-3.653545
-};
-static const struct gllist seccam_pipe_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 336, seccam_pipe_data, 0
-};
-const struct gllist *seccam_pipe = &seccam_pipe_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char seccam[] =
+ "XSGLMSH1\005\000\000\000\000\000\000\000body\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\001"
+ "\000\000\004\000\000\000p\000\000\000&\001\000\000\235\000\000\000\000\000"
+ "\260\077\261$\300\077\250\355\077@\230\001L9cap\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "p\012\000\000\004\000\000\000\245\000\000\000\324\001\000\000\354\000\000"
+ "\000\000\000\000@'\274\311\077\246+\206@\340\001p9hinge\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "<\030\000\000\004\000\000\000[\000\000\000\363\000\000\000\203\000\000\000"
+ "\000\000\300%\000\000\000\077\000\000\000>\000\001\0008lens\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\300\037\000\000\004\000\000\000\004\000\000\000\006\000\000\000"
+ "\005\000\000\000\232\231\361@\213ta=\037\000@@\345I}8pipe\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\010 \000\000\004\000\000\000H\000\000\000P\001\000\000\267\000\000"
+ "\000\352ts\300\000\000@>\000\000\374\277\201\273\0059\001\200\011\017.(\000"
+ "\000\377\177\030\036\020\012\000\000\001\200\030\036\020\012\000\000\377"
+ "\177\011\017.(\000\000\377\177\022\023\023\330\000\000\001\200k\021\336\327"
+ "\000\000\001\200\022\023\023\330\000\000\377\177k\021\336\327\000\000\001"
+ "\200\030\036\213\344\000\000\377\177\343\035\344\342\000\000\001\200\343"
+ "\035\344\342\000\000\377\177\030\036\213\344\000\000\001\200\011\017\336"
+ "\327\000\000\377\177\011\017\336\327\000\000\377\177\337\026p\331\000\000"
+ "\001\200\005\025\236\330\000\000\001\200\337\026p\331\000\000\377\177\005"
+ "\025\236\330\000\000\001\200\206\034\027\337\000\000\377\177p\033a\335\000"
+ "\000\001\200p\033a\335\000\000\377\177\206\034\027\337\000\000\001\200\334"
+ "\341\336\327\000\000\377\177\334\341\336\327\000\000\377\177\334\341.(\000"
+ "\000\001\200\011\017.(\000\000\001\200\334\341.(\000\000\377\177\011\017"
+ ".(\000\000\377\177\225\030\206\332\000\000\001\200\225\030\206\332\000\000"
+ "\001\200\030\036\355\346\000\000\377\177\030\036\355\346\000\000\001\200"
+ "X\035\361\340\000\000\377\177X\035\361\340\000\000\377\177\035\032\331\333"
+ "\000\000\001\200\035\032\331\333\000\000\377\177$\036\347\344\000\000\377"
+ "\177\030\036\355\346\000\000\377\177\030\036\213\344\000\000\377\177k\021"
+ "\336\327\000\000\377\177\011\017\336\327\000\000\377\177\017\021\322\327"
+ "\000\000\377\177\334\341o\351\000\000\377\177\334\341\336\327\000\000\377"
+ "\177s\371t\351\000\000\377\177\340\372\356\351\000\000\377\177\026\374\321"
+ "\352\000\000\377\177\371\374\010\354\000\000\377\177s\375u\355\000\000\377"
+ "\177s\375\227\022\000\000\377\177s\371\227\026\000\000\377\177\334\341.("
+ "\000\000\377\177\334\341\234\026\000\000\377\177\011\017.(\000\000\377\177"
+ "\340\372\036\026\000\000\377\177\026\374;\025\000\000\377\177\371\374\004"
+ "\024\000\000\377\177\030\036\020\012\000\000\377\177\022\023\023\330\000"
+ "\000\377\177\005\025\236\330\000\000\377\177\337\026p\331\000\000\377\177"
+ "\225\030\206\332\000\000\377\177\035\032\331\333\000\000\377\177p\033a\335"
+ "\000\000\377\177\206\034\027\337\000\000\377\177X\035\361\340\000\000\377"
+ "\177\343\035\344\342\000\000\377\177\030\036\020\012\000\000\377\177\030"
+ "\036\213\344\000\000\377\177\030\036\355\346\000\000\377\177s\375u\355\000"
+ "\000\373{\371\374\010\354\000\000\377\177\371\374\010\354\000\000\373{s\375"
+ "u\355\000\000\377\177\334\341o\351\000\000\373{s\371t\351\000\000\373{\334"
+ "\341o\351\000\000\377\177s\371t\351\000\000\377\177s\371\227\026\000\000"
+ "\373{\334\341\234\026\000\000\373{s\371\227\026\000\000\377\177\334\341\234"
+ "\026\000\000\377\177\340\372\036\026\000\000\373{\340\372\036\026\000\000"
+ "\377\177\371\374\004\024\000\000\373{s\375\227\022\000\000\377\177s\375\227"
+ "\022\000\000\373{\371\374\004\024\000\000\377\177\026\374\321\352\000\000"
+ "\373{\026\374\321\352\000\000\377\177\026\374;\025\000\000\373{\026\374;"
+ "\025\000\000\373{\340\372\356\351\000\000\377\177\340\372\356\351\000\000"
+ "\001\200\011\017.(\000\000\001\200\334\341\336\327\000\000\001\200\334\341"
+ ".(\000\000\001\200\011\017\336\327\000\000\001\200\030\036\020\012\000\000"
+ "\001\200k\021\336\327\000\000\001\200\022\023\023\330\000\000\001\200\005"
+ "\025\236\330\000\000\001\200\337\026p\331\000\000\001\200\225\030\206\332"
+ "\000\000\001\200\035\032\331\333\000\000\001\200p\033a\335\000\000\001\200"
+ "\206\034\027\337\000\000\001\200X\035\361\340\000\000\001\200\343\035\344"
+ "\342\000\000\001\200\030\036\213\344\000\000\001\200\030\036\213\344\000"
+ "\000\001\200\030\036\020\012\000\000\000U\000`\000n\000Ul\177u\177h\177z"
+ "\177\012\177\023\177\027\177\005\177\177\177\177\177T\177\134\177Q\177_\177"
+ ".\1775\1778\177+\177\177\177\177\177\000\000\000\000\000\000\000\000J\177"
+ "G\177\000\177\000\177#\177 \177\077\177\077\177\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000_\0305M _\000\230\000\254\000\254\000\215\000\000\000\364\000\000\000"
+ "\351s\201\177\201h\201\177\201W\201P\201(\201\027\201\014\201/\201\000\275"
+ "\000\304@\201@\201\000\330\000\321\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\333a\235\030\000\000\001\000\002\000\001\000\000\000\003"
+ "\000\004\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000\012"
+ "\000\011\000\010\000\013\000\007\000\014\000\005\000\014\000\007\000\015"
+ "\000\016\000\017\000\020\000\017\000\016\000\021\000\022\000\023\000\024"
+ "\000\023\000\022\000\025\000\015\000\026\000\014\000\026\000\015\000\027"
+ "\000\030\000\031\000\032\000\031\000\030\000\033\000\034\000\020\000\035"
+ "\000\020\000\034\000\016\000\036\000\013\000\010\000\013\000\036\000\037"
+ "\000 \000\025\000\022\000\025\000 \000!\000\024\000\042\000#\000\042\000"
+ "\024\000\023\000\002\000\037\000\036\000\037\000\002\000\001\000\012\000"
+ "!\000 \000!\000\012\000\011\000\042\000\035\000#\000\035\000\042\000\034"
+ "\000\021\000\006\000\017\000\006\000\021\000\004\000$\000%\000&\000'\000"
+ "(\000)\000(\000*\000+\000*\000(\000,\000,\000(\000-\000-\000(\000.\000.\000"
+ "(\000/\000/\000(\0000\0000\000(\0001\0002\0003\0004\0003\0002\0005\0005\000"
+ "2\0006\0005\0006\0007\0005\0007\0008\0005\0008\0001\0005\0001\000(\0005\000"
+ "(\000'\0005\000'\0009\0009\000'\000:\0009\000:\000;\0009\000;\000<\0009\000"
+ "<\000=\0009\000=\000>\0009\000>\000\077\0009\000\077\000@\0009\000@\000A"
+ "\0009\000A\000B\0009\000B\000&\000C\000D\000E\000F\000G\000H\000G\000F\000"
+ "I\000J\000K\000L\000K\000J\000M\000N\000O\000P\000O\000N\000Q\000R\000P\000"
+ "S\000P\000R\000N\000T\000U\000V\000U\000T\000W\000X\000G\000Y\000G\000X\000"
+ "H\000Z\000S\000[\000S\000Z\000R\000M\000\134\000K\000\134\000M\000]\000V"
+ "\000I\000F\000I\000V\000U\000]\000Y\000\134\000Y\000]\000X\000Z\000W\000"
+ "T\000W\000Z\000[\000^\000_\000`\000_\000^\000a\000a\000^\000b\000a\000b\000"
+ "c\000c\000b\000d\000d\000b\000e\000e\000b\000f\000f\000b\000g\000g\000b\000"
+ "h\000h\000b\000i\000i\000b\000j\000j\000b\000k\000k\000b\000l\000l\000b\000"
+ "m\000n\000o\000\036\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006"
+ "\000\004\000\007\000\005\000\007\000\010\000\011\000\011\000\012\000\010"
+ "\000\012\000\010\000\013\000\011\000\013\000\007\000\014\000\005\000\014"
+ "\000\007\000\015\000\014\000\015\000\016\000\017\000\017\000\020\000\016"
+ "\000\020\000\016\000\021\000\017\000\021\000\022\000\023\000\023\000\024"
+ "\000\022\000\024\000\022\000\025\000\023\000\025\000\015\000\026\000\014"
+ "\000\026\000\015\000\027\000\026\000\027\000\000\000\030\000\000\000\032"
+ "\000\030\000\032\000\003\000\030\000\020\000\034\000\020\000\035\000\034"
+ "\000\035\000\016\000\034\000\013\000\036\000\010\000\036\000\036\000\037"
+ "\000\013\000\037\000\025\000 \000\022\000 \000 \000!\000\025\000!\000\024"
+ "\000\042\000\042\000#\000\024\000#\000\023\000\042\000\002\000\037\000\002"
+ "\000\036\000\001\000\037\000\012\000!\000\012\000 \000\011\000!\000\035\000"
+ "\042\000\035\000#\000\034\000\042\000\006\000\021\000\006\000\017\000\004"
+ "\000\021\000\037\000$\000\013\000$\000\015\000)\000\007\000)\000\015\000"
+ "*\000\027\000*\000\015\000,\000*\000,\000\015\000-\000,\000-\000\015\000"
+ ".\000-\000.\000\015\000/\000.\000/\000\015\0000\000/\0000\000\015\0001\000"
+ "0\0001\000\030\0002\000\030\0004\0002\0004\000\003\0002\0002\0006\000\003"
+ "\0006\0006\0007\000\003\0007\0007\0008\000\003\0008\0001\0008\000\003\000"
+ "1\000\003\000\015\000\003\000\007\000\001\000\007\000\001\000\004\000\001"
+ "\000\021\000\001\000\016\000\001\000\034\000\001\000\042\000\001\000\023"
+ "\000\001\000\025\000\001\000!\000\001\000\011\000\001\000\013\0000\000G\000"
+ "/\000G\0000\000I\000G\000I\000*\000K\000K\000L\000*\000L\000,\000K\0002\000"
+ "O\000O\000P\0002\000P\0004\000O\0006\000P\000P\000S\0006\000S\0008\000U\000"
+ "1\000U\0008\000W\000U\000W\000.\000G\000G\000Y\000.\000Y\0007\000S\000S\000"
+ "[\0007\000[\000,\000\134\000K\000\134\000-\000\134\0001\000I\000I\000U\000"
+ "-\000Y\000Y\000\134\0007\000W\000W\000[\000\000\000\026\000\026\000\032\000"
+ "\000\000\014\000\002\000\014\000\002\000\005\000\002\000\006\000\002\000"
+ "\017\000\002\000\020\000\002\000\035\000\002\000#\000\002\000\024\000\002"
+ "\000\022\000\002\000 \000\002\000\012\000\002\000\010\000\377\1779\014 \017"
+ "\000\000\001\200t\013\202\017\000\000\001\2009\014 \017\000\000\377\177t"
+ "\013\202\017\000\000\377\177\351\014\234\016\000\000\001\200\351\014\234"
+ "\016\000\000\001\200\240\012\276\017\000\000\377\177\240\012\276\017\000"
+ "\000\001\200\305\011\323\017\000\000\377\177\305\011\323\017\000\000\377"
+ "\177}\015\372\015\000\000\001\200\361\015\077\015\000\000\377\177\361\015"
+ "\077\015\000\000\001\200}\015\372\015\000\000\001\200\032\345\323\017\000"
+ "\000\377\177\032\345\323\017\000\000\377\177b\013d\020\000\000\001\2009\014"
+ "'\020\000\000\001\200b\013d\020\000\000\377\1779\014'\020\000\000\001\200"
+ "\002\015\303\017\000\000\377\177\002\015\303\017\000\000\001\200\266\015"
+ "<\017\000\000\377\177M\016\226\016\000\000\001\200M\016\226\016\000\000\377"
+ "\177\266\015<\017\000\000\377\177\303\016\330\015\000\000\001\200\303\016"
+ "\330\015\000\000\377\177\032\345y\020\000\000\001\200\202\012y\020\000\000"
+ "\001\200\032\345y\020\000\000\377\177\202\012y\020\000\000\211\210\346\032"
+ "\207\357\000\000f\207\326\031\207\357\000\000f\207\346\032\207\357\000\000"
+ "\211\210\326\031\207\357\000\000\001\200\202\012y\020\000\000\001\200\032"
+ "\345\323\017\000\000\001\200\032\345y\020\000\000\001\200\305\011\323\017"
+ "\000\000\001\200\240\012\276\017\000\000\001\200b\013d\020\000\000\001\200"
+ "t\013\202\017\000\000\001\2009\014'\020\000\000\001\2009\014 \017\000\000"
+ "\001\200\351\014\234\016\000\000\001\200\002\015\303\017\000\000\001\200"
+ "}\015\372\015\000\000\001\200\266\015<\017\000\000\001\200\361\015\077\015"
+ "\000\000\001\200M\016\226\016\000\000\001\200\203\030\033\370\000\000\001"
+ "\200\303\016\330\015\000\000\001\200\213\031H\370\000\000\001\200\212\030"
+ "\014\370\000\000\001\200\247\031\014\370\000\0007\206\326\031\213\357\000"
+ "\0007\206\346\032\213\357\000\000\003\204\326\031G\360\000\000\003\204\346"
+ "\032G\360\000\000#\202\326\031\246\361\000\000#\202\346\032\246\361\000\000"
+ "\304\200\334\032\206\363\000\000\320\200\315\031v\363\000\000\304\200\313"
+ "\031\206\363\000\000\205\201\326\031~\362\000\000z\201\346\032\215\362\000"
+ "\000\011\200~\032\271\365\000\000&\200\200\031`\365\000\000\011\200h\031"
+ "\271\365\000\000w\200\260\031m\364\000\000\034\200\216\032\177\365\000\000"
+ "o\200\277\032\206\364\000\000\303\200\334\032\212\363\000\000\211\210\351"
+ "\0309\367\000\000\004\200\344\030.\367\000\000\007\200>\031P\366\000\000"
+ "\001\200\212\030\014\370\000\000\001\200\364\031a\367\000\000\007\200>\031"
+ "P\366\000\000\004\200\344\030.\367\000\000\006\200J\032s\366\000\000\011"
+ "\200~\032\271\365\000\000\320r\216\032\177\365\000\000\034\200\216\032\177"
+ "\365\000\000\305sJ\032s\366\000\000\006\200J\032s\366\000\000\331l\346\032"
+ "\207\357\000\000\331l\326\031\207\357\000\000\310p\315\031v\363\000\000\205"
+ "\201\326\031~\362\000\000\320o\326\031~\362\000\000\320\200\315\031v\363"
+ "\000\000\232u\213\031H\370\000\000\001\200\213\031H\370\000\000\377\177Y"
+ "\024\255\002\000\000\330q\277\032\206\364\000\000o\200\277\032\206\364\000"
+ "\000\242s>\031P\366\000\000&\200\200\031`\365\000\000\262r\200\031`\365\000"
+ "\000\011\200h\031\271\365\000\000mu\203\030\033\370\000\000\001\200\203\030"
+ "\033\370\000\000\377\177:\023\255\002\000\0007\206\346\032\213\357\000\000"
+ "\211\210\346\032\207\357\000\000f\207\346\032\207\357\000\000\331l\346\032"
+ "\207\357\000\000\337o\346\032\215\362\000\000\003\204\346\032G\360\000\000"
+ "#\202\346\032\246\361\000\000z\201\346\032\215\362\000\000\213t\351\0309"
+ "\367\000\000\277q\260\031m\364\000\000w\200\260\031m\364\000\000\304\200"
+ "\334\032\206\363\000\000\334p\334\032\212\363\000\000\303\200\334\032\212"
+ "\363\000\000\001\200\364\031a\367\000\000\263t\364\031a\367\000\000\001\200"
+ "\247\031\014\370\000\000\304\200\313\031\206\363\000\000\211\210\326\031"
+ "\207\357\000\000\331l\326\031\207\357\000\000f\207\326\031\207\357\000\000"
+ "7\206\326\031\213\357\000\000\003\204\326\031G\360\000\000#\202\326\031\246"
+ "\361\000\000\377\177\305\011\323\017\000\000\377\177\032\345y\020\000\000"
+ "\377\177\032\345\323\017\000\000\377\177\202\012y\020\000\000\377\177\240"
+ "\012\276\017\000\000\377\177b\013d\020\000\000\377\177t\013\202\017\000\000"
+ "\377\1779\014'\020\000\000\377\1779\014 \017\000\000\377\177\351\014\234"
+ "\016\000\000\377\177\002\015\303\017\000\000\377\177}\015\372\015\000\000"
+ "\377\177\266\015<\017\000\000\377\177\361\015\077\015\000\000\377\177M\016"
+ "\226\016\000\000\377\177:\023\255\002\000\000\377\177\303\016\330\015\000"
+ "\000\377\177Y\024\255\002\000\000\331l\346\032\207\357\000\000\320o\326\031"
+ "~\362\000\000\331l\326\031\207\357\000\000\337o\346\032\215\362\000\000\310"
+ "p\315\031v\363\000\000\334p\334\032\212\363\000\000\277q\260\031m\364\000"
+ "\000\330q\277\032\206\364\000\000\262r\200\031`\365\000\000\320r\216\032"
+ "\177\365\000\000\242s>\031P\366\000\000\305sJ\032s\366\000\000\213t\351\030"
+ "9\367\000\000\263t\364\031a\367\000\000mu\203\030\033\370\000\000\232u\213"
+ "\031H\370\000\000\377\177:\023\255\002\000\000\377\177Y\024\255\002\000\000"
+ "Q\201Y\201L\201^\201C\201C\201h\201n\201x\201{\2015\201\323\201.\2019\201"
+ "\177\177\177\177\000\027\000!\000\021\000&\000.\0003\000<\000F\000J\000<"
+ "\000P\000S\000\000\000\004\000\000\000\007\177\177\201~\201~\177\177\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201"
+ "\377\201\377\201r\201h\201W\201P\201\301\201<\201\324\201\312\201(\201\312"
+ "\2016\203\031\201\340\201\362\201 \201 \201\340\201\340%\201%\201!\201'\201"
+ "\203\003\202\375\202\376\217\014\000c\000f\000h\000a\000_\177\177\177\177"
+ "\011\201\003\201\001\201\011\201\000V\000V\000U\000m\000o\343\201\350\201"
+ "\350\201\344\201\327\201\327\201*\201\000\177\000\177\000\177\000\177\000"
+ "}\000\177\000\177\000}\333\201\021\201\021\201\000z\000v\000v\000Y\000[\000"
+ "W\015\201\000\201\000\201\000\201\000\201\000\201\000\201\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177@\177\077\177"
+ "@\177\077\177\077\177@\177\300\177\300\177\300\177\300\177@\177@\177\300"
+ "\177\300\177@\177@\177@\177@\000\000\000\000\001\000\002\000\001\000\000"
+ "\000\003\000\004\000\002\000\005\000\002\000\004\000\000\000\003\000\006"
+ "\000\001\000\006\000\003\000\007\000\007\000\010\000\006\000\010\000\007"
+ "\000\011\000\012\000\013\000\014\000\013\000\012\000\015\000\011\000\016"
+ "\000\010\000\016\000\011\000\017\000\004\000\015\000\012\000\015\000\004"
+ "\000\005\000\020\000\021\000\022\000\021\000\020\000\023\000\023\000\024"
+ "\000\021\000\024\000\023\000\025\000\026\000\027\000\030\000\027\000\026"
+ "\000\031\000\030\000\032\000\033\000\032\000\030\000\027\000\034\000\035"
+ "\000\036\000\035\000\034\000\037\000\037\000\022\000\035\000\022\000\037"
+ "\000\020\000\025\000\026\000\024\000\026\000\025\000\031\000 \000!\000\042"
+ "\000!\000 \000#\000$\000%\000&\000%\000$\000'\000'\000$\000(\000(\000$\000"
+ ")\000(\000)\000*\000*\000)\000+\000*\000+\000,\000,\000+\000-\000-\000+\000"
+ ".\000-\000.\000/\000/\000.\0000\000/\0000\0001\0001\0000\0002\0001\0002\000"
+ "3\0003\0002\0004\0003\0004\0005\0003\0005\0006\0006\0005\0007\000\042\000"
+ "8\0009\0008\000\042\000!\0009\000:\000;\000:\0009\0008\000;\000<\000=\000"
+ "<\000;\000:\000>\000\077\000@\000\077\000>\000A\000A\000>\000<\000<\000>"
+ "\000=\000=\000>\000B\000C\000D\000E\000D\000C\000F\000F\000C\000@\000@\000"
+ "C\000>\000>\000C\000G\000>\000G\000H\000>\000H\000I\000J\000K\000L\000K\000"
+ "J\000M\000N\000O\000P\000O\000N\000E\000E\000N\000C\000C\000N\000Q\0007\000"
+ "P\0006\000P\0007\000N\000R\000S\000T\000S\000R\000U\000U\000R\000V\000W\000"
+ "#\000 \000#\000W\000X\000Y\000Z\000[\000Z\000Y\000\134\000\033\000]\000^"
+ "\000]\000\033\000_\000_\000\033\000\032\000T\000`\000a\000`\000T\000S\000"
+ "b\000c\000d\000c\000b\000e\000e\000b\000L\000f\000\013\000g\000\013\000f"
+ "\000h\000\013\000h\000\014\000i\000j\000k\000j\000i\000l\000l\000i\000m\000"
+ "m\000i\000n\000m\000n\000o\000m\000o\000p\000q\000M\000J\000M\000q\000f\000"
+ "M\000f\000g\000r\000c\000s\000c\000r\000d\000t\000m\000p\000m\000t\000u\000"
+ "u\000t\000v\000w\000]\000x\000]\000w\000y\000]\000y\000^\000Y\000z\000\134"
+ "\000z\000Y\000r\000z\000r\000s\000V\000x\000U\000x\000V\000w\000q\000L\000"
+ "b\000L\000q\000J\000[\000{\000|\000{\000[\000}\000}\000[\000~\000~\000[\000"
+ "\177\000\177\000[\000\200\000\200\000[\000Z\000a\000u\000v\000u\000a\000"
+ "`\000\201\000\202\000\203\000\202\000\201\000\204\000\204\000\201\000\205"
+ "\000\204\000\205\000\206\000\206\000\205\000\207\000\206\000\207\000\210"
+ "\000\210\000\207\000\211\000\210\000\211\000\212\000\210\000\212\000\213"
+ "\000\213\000\212\000\214\000\213\000\214\000\215\000\215\000\214\000\216"
+ "\000\215\000\216\000\217\000\217\000\216\000\220\000\217\000\220\000\221"
+ "\000\221\000\220\000\222\000\223\000\224\000\225\000\224\000\223\000\226"
+ "\000\224\000\226\000\227\000\227\000\226\000\230\000\227\000\230\000\231"
+ "\000\231\000\230\000\232\000\231\000\232\000\233\000\233\000\232\000\234"
+ "\000\233\000\234\000\235\000\235\000\234\000\236\000\235\000\236\000\237"
+ "\000\237\000\236\000\240\000\237\000\240\000\241\000\241\000\240\000\242"
+ "\000\241\000\242\000\243\000\243\000\242\000\244\000\000\000\001\000\001"
+ "\000\002\000\000\000\002\000\000\000\003\000\001\000\003\000\002\000\004"
+ "\000\002\000\005\000\004\000\005\000\000\000\004\000\003\000\006\000\001"
+ "\000\006\000\003\000\007\000\006\000\007\000\007\000\010\000\006\000\010"
+ "\000\007\000\011\000\010\000\011\000\012\000\013\000\013\000\014\000\012"
+ "\000\014\000\012\000\015\000\013\000\015\000\011\000\016\000\010\000\016"
+ "\000\011\000\017\000\016\000\017\000\004\000\015\000\004\000\012\000\005"
+ "\000\015\000\020\000\021\000\021\000\022\000\020\000\022\000\020\000\023"
+ "\000\021\000\023\000\023\000\024\000\021\000\024\000\023\000\025\000\024"
+ "\000\025\000\026\000\027\000\027\000\030\000\026\000\030\000\026\000\031"
+ "\000\027\000\031\000\030\000\032\000\032\000\033\000\030\000\033\000\027"
+ "\000\032\000\034\000\035\000\035\000\036\000\034\000\036\000\034\000\037"
+ "\000\035\000\037\000\022\000\037\000\022\000\035\000\020\000\037\000\025"
+ "\000\026\000\024\000\026\000\025\000\031\000 \000!\000!\000\042\000 \000"
+ "\042\000 \000#\000!\000#\000\016\000\035\000\016\000\036\000\010\000\035"
+ "\000\006\000\035\000\006\000\022\000\001\000\022\000\001\000\021\000\002"
+ "\000\021\000\005\000\021\000\005\000\024\000\015\000\024\000\015\000\026"
+ "\000\013\000\026\000\013\000\030\000\030\0003\000\013\0003\000\033\0003\000"
+ "\033\0005\0003\0005\0005\0006\0003\0006\0005\0007\0006\0007\000\042\0008"
+ "\0008\0009\000\042\0009\000!\0008\0009\000:\000:\000;\0009\000;\0008\000"
+ ":\000;\000<\000<\000=\000;\000=\000:\000<\000>\000\077\000\077\000@\000>"
+ "\000@\000>\000A\000\077\000A\000<\000>\000<\000A\000=\000>\000>\000B\000"
+ "=\000B\000C\000D\000D\000E\000C\000E\000C\000F\000D\000F\000@\000C\000@\000"
+ "F\000>\000C\000C\000G\000>\000G\000G\000H\000>\000H\000H\000I\000>\000I\000"
+ "J\000K\000K\000L\000J\000L\0006\000J\0006\000K\000L\000N\000K\000N\000E\000"
+ "N\000E\000L\000C\000N\000N\000Q\000C\000Q\0007\000K\0007\000N\000C\000S\000"
+ "G\000S\000C\000U\000S\000U\000Q\000U\000#\000W\000 \000W\000W\000X\000#\000"
+ "X\000A\000Y\000A\000[\000Y\000[\000\077\000Y\000\033\000]\0005\000]\000\033"
+ "\000_\000]\000_\000\032\000_\000G\000`\000H\000`\000S\000`\000D\000b\000"
+ "D\000d\000b\000d\000E\000b\000L\000b\000\013\000f\0003\000f\000f\000h\000"
+ "\013\000h\000\014\000h\000 \0009\0009\000W\0009\000m\000W\000m\000;\000m"
+ "\000=\000m\000B\000m\0006\000q\000J\000q\000f\000q\0006\000f\000D\000r\000"
+ "F\000r\000d\000r\000>\000m\000>\000u\000m\000u\000I\000u\000N\000]\000]\000"
+ "x\000N\000x\0007\000]\000@\000Y\000Y\000r\000@\000r\000Q\000x\000U\000x\000"
+ "L\000q\000b\000q\000#\000[\000X\000[\000!\000[\0008\000[\000:\000[\000<\000"
+ "[\000H\000u\000`\000u\000\011\000\034\000\017\000\034\000\011\000\037\000"
+ "\007\000\037\000\007\000\020\000\003\000\020\000\003\000\023\000\000\000"
+ "\023\000\004\000\023\000\004\000\025\000\012\000\025\000\012\000\031\000"
+ "\014\000\031\000\014\000\027\000\027\000h\000\032\000h\000_\000h\000W\000"
+ "[\000[\000m\000Y\000m\000Y\000u\000r\000u\000`\000r\000`\000d\000S\000d\000"
+ "S\000b\000U\000b\000U\000q\000q\000x\000f\000x\000]\000f\000]\000h\000#S"
+ "\000\360\001\300\000\000\341C\000\020\037\254\000\000#S\000\020\001\300\000"
+ "\000\341C\000\360\037\254\000\000\377_\000\360\000\360\000\000\272\134\000"
+ "\020(\327\000\000\377_\000\020\000\360\000\000\272\134\000\360(\327\000\000"
+ "\0000\000\360\335\234\000\000\0000\000\020\335\234\000\000F\243\000\360("
+ "\327\000\000\001\240\000\020\000\360\000\000F\243\000\020(\327\000\000\001"
+ "\240\000\360\000\360\000\000\331\030\000\360F\223\000\000\331\030\000\020"
+ "F\223\000\000'\347\000\020F\223\000\000\331\030\000\020F\223\000\000\000"
+ "\000\000\020\001\220\000\000\000\320\000\020\335\234\000\000\0000\000\020"
+ "\335\234\000\000\037\274\000\020\037\254\000\000\341C\000\020\037\254\000"
+ "\000\335\254\000\020\001\300\000\000#S\000\020\001\300\000\000F\243\000\020"
+ "(\327\000\000\272\134\000\020(\327\000\000\377_\000\020\000\360\000\000\001"
+ "\240\000\020\000\360\000\000\037\274\000\360\037\254\000\000\000\320\000"
+ "\020\335\234\000\000\000\320\000\360\335\234\000\000\037\274\000\020\037"
+ "\254\000\000\335\254\000\020\001\300\000\000\335\254\000\360\001\300\000"
+ "\000'\347\000\020F\223\000\000'\347\000\360F\223\000\000\000\000\000\020"
+ "\001\220\000\000\000\000\000\360\001\220\000\000\331\030\000\360F\223\000"
+ "\000'\347\000\360F\223\000\000\000\000\000\360\001\220\000\000\0000\000\360"
+ "\335\234\000\000\000\320\000\360\335\234\000\000\341C\000\360\037\254\000"
+ "\000\037\274\000\360\037\254\000\000#S\000\360\001\300\000\000\335\254\000"
+ "\360\001\300\000\000\272\134\000\360(\327\000\000F\243\000\360(\327\000\000"
+ "\377_\000\360\000\360\000\000\001\240\000\360\000\360\000\000\001\200\001"
+ "\300\000\360\000\000\242{!\341\000\360\000\000\377\177\000\300\000\360\000"
+ "\000\331n\000\000\000\360\000\000\202Z\202\032\000\360\000\000\000@\332."
+ "\000\360\000\000!!\243;\000\360\000\000\000\000\000@\000\360\000\000\337"
+ "\336\243;\000\360\000\000\001\300\332.\000\360\000\000~\245\202\032\000\360"
+ "\000\000'\221\000\000\000\360\000\000^\204!\341\000\360\000\000\000\000\000"
+ "@\377o\000\000!!\243;\000\360\000\000\000\000\000@\000\360\000\000!!\243"
+ ";\377o\000\000~\245\202\032\377o\000\000\001\300\332.\000\360\000\000~\245"
+ "\202\032\000\360\000\000\001\300\332.\377o\000\000\337\336\243;\000\360\000"
+ "\000\337\336\243;\377o\000\000\000@\332.\000\360\000\000\000@\332.\377o\000"
+ "\000\377\177\000\300\377o\000\000\242{!\341\000\360\000\000\242{!\341\377"
+ "o\000\000\377\177\000\300\000\360\000\000\331n\000\000\377o\000\000\202Z"
+ "\202\032\000\360\000\000\202Z\202\032\377o\000\000\331n\000\000\000\360\000"
+ "\000^\204!\341\000\360\000\000'\221\000\000\377o\000\000'\221\000\000\000"
+ "\360\000\000^\204!\341\377o\000\000\001\200\001\300\000\360\000\000\001\200"
+ "\001\300\377o\000\000\177\317\177\300\177\325\177\300\177\361\177\351\177"
+ "\361\177\342\177\262\177\254\201\027\201\017\201\036\201\017\177\237\177"
+ "\230\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\201@\201N\201T\201@\2011\201+\201a\201"
+ "h\201z\177\206\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\005z\027h\373z\036a\301@\317N\301@\325T\342a\351h+T1Np\017h\027a\036"
+ "p\017N1@\077@\077T+\237\036\254+\2621\230\027\220\017\220\017\000\000\000"
+ "\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006\000\005"
+ "\000\004\000\007\000\010\000\001\000\003\000\001\000\010\000\011\000\012"
+ "\000\013\000\014\000\013\000\012\000\015\000\016\000\011\000\010\000\011"
+ "\000\016\000\017\000\020\000\021\000\022\000\021\000\020\000\023\000\021"
+ "\000\023\000\024\000\024\000\023\000\025\000\024\000\025\000\026\000\026"
+ "\000\025\000\027\000\026\000\027\000\030\000\030\000\027\000\031\000\030"
+ "\000\031\000\032\000\032\000\031\000\033\000\033\000\031\000\034\000\035"
+ "\000\036\000\037\000\036\000\035\000 \000\035\000!\000 \000!\000\035\000"
+ "\042\000\037\000#\000$\000#\000\037\000\036\000$\000%\000&\000%\000$\000"
+ "#\000\007\000\002\000\005\000\002\000\007\000\000\000&\000\017\000\016\000"
+ "\017\000&\000%\000\042\000\014\000!\000\014\000\042\000\012\000'\000(\000"
+ ")\000(\000'\000*\000(\000*\000+\000+\000*\000,\000+\000,\000-\000-\000,\000"
+ ".\000-\000.\000/\000/\000.\0000\000/\0000\0001\0001\0000\0002\0001\0002\000"
+ "3\0004\0005\0006\0005\0004\0007\0007\0004\0008\0008\0004\0009\0009\0004\000"
+ ":\000:\0004\000;\000;\0004\000<\000<\0004\000=\000=\0004\000>\000>\0004\000"
+ "\077\000\077\0004\000@\000A\000B\000C\000B\000A\000D\000E\000F\000G\000F"
+ "\000E\000H\000H\000I\000F\000I\000H\000J\000D\000K\000B\000K\000D\000L\000"
+ "M\000N\000O\000N\000M\000P\000Q\000R\000S\000R\000Q\000T\000J\000C\000I\000"
+ "C\000J\000A\000U\000V\000W\000V\000U\000X\000W\000E\000G\000E\000W\000V\000"
+ "L\000R\000K\000R\000L\000S\000O\000T\000Q\000T\000O\000N\000Y\000X\000U\000"
+ "X\000Y\000Z\000\000\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006"
+ "\000\004\000\007\000\005\000\007\000\001\000\010\000\003\000\010\000\010"
+ "\000\011\000\001\000\011\000\012\000\013\000\013\000\014\000\012\000\014"
+ "\000\012\000\015\000\013\000\015\000\011\000\016\000\010\000\016\000\016"
+ "\000\017\000\011\000\017\000\017\000\020\000\017\000\022\000\020\000\022"
+ "\000\020\000\023\000\017\000\023\000\011\000\023\000\023\000\025\000\011"
+ "\000\025\000\001\000\025\000\025\000\027\000\001\000\027\000\002\000\027"
+ "\000\014\000\027\000\002\000\014\000\005\000\014\000\002\000\005\000\006"
+ "\000\014\000\006\000\013\000\023\000\035\000\023\000\037\000\035\000\037"
+ "\000\025\000\035\000\027\000\035\000\035\000\042\000\027\000\042\000\020"
+ "\000\037\000\020\000$\000\037\000$\000\022\000$\000\022\000&\000$\000&\000"
+ "\002\000\007\000\000\000\007\000\017\000&\000\016\000&\000\014\000\042\000"
+ "\012\000\042\000\016\000$\000\010\000$\000\010\000\037\000\003\000\037\000"
+ "\003\000\035\000\000\000\035\000\000\000\042\000\007\000\042\000\007\000"
+ "\012\000\004\000\012\000\004\000\015\0004\0005\0005\0006\0004\0006\0004\000"
+ "7\0005\0007\0004\0008\0007\0008\0004\0009\0008\0009\0004\000:\0009\000:\000"
+ "4\000;\000:\000;\0004\000<\000;\000<\0004\000=\000<\000=\0004\000>\000=\000"
+ ">\0004\000\077\000>\000\077\0004\000@\000\077\000@\000:\000A\000;\000A\000"
+ "A\000D\000:\000D\000=\000E\000>\000E\000E\000H\000=\000H\000<\000H\000H\000"
+ "J\000<\000J\0009\000D\000D\000L\0009\000L\0005\000M\0005\000O\000M\000O\000"
+ "6\000M\0008\000Q\0008\000S\000Q\000S\0007\000Q\000;\000J\000A\000J\000@\000"
+ "V\000\077\000V\000@\000X\000V\000X\000\077\000E\000E\000V\0008\000L\000L"
+ "\000S\0007\000O\000O\000Q\0004\000X\0004\000Z\000X\000Z\000\000\000\005\200"
+ "\333\222\000\000\000\000\373\177%m\000\000\000\000\001\200%m\000\000\000"
+ "\000\377\177\333\222\000\000\177\000\177\000\177\000\177\000\000\000\001"
+ "\000\002\000\001\000\000\000\003\000\000\000\001\000\001\000\002\000\000"
+ "\000\002\000\000\000\003\000\001\000\003\000dla\002\263I\000\000\346i\247"
+ "\376h\006\000\000\346i\247\376\263I\000\000dla\002@\006\000\000\035p\336"
+ "\004\263I\000\000\035p\336\004\004\006\000\000\203t\276\005\263I\000\000"
+ "\203t\276\005\276\005\000\000\350x\336\004\263I\000\000\350x\336\004x\005"
+ "\000\000\242|a\002\263I\000\000\242|a\002<\005\000\000\037\177\247\376\025"
+ "\005\000\000\037\177\247\376\263I\000\000\377\177B\372\007\005\000\000\377"
+ "\177B\372\263I\000\000\006iB\372v\006\000\000\006iB\372\263I\000\000\210"
+ "g\247\376}\363\000\000\363ia\002\304\362\000\000\222m\336\004\260\361\000"
+ "\000\327q\276\005j\360\000\000\034v\336\004$\357\000\000\273ya\002\017\356"
+ "\000\000&|\247\376W\355\000\000\377|B\372\026\355\000\000\256fB\372\276\363"
+ "\000\000\243_\247\376[\343\000\000\261aa\002\344\341\000\000\304d\336\004"
+ "\262\337\000\000dh\276\005\033\335\000\000\005l\336\004\204\332\000\000\030"
+ "oa\002R\330\000\000&q\247\376\332\326\000\000\336qB\372V\326\000\000\353"
+ "^B\372\337\343\000\000hTa\002\233\324\000\000\361R\247\376\251\326\000\000"
+ "\232V\336\004\210\321\000\0001Y\276\005\347\315\000\000\310[\336\004G\312"
+ "\000\000\372]a\0024\307\000\000r_\247\376&\305\000\000\366_B\372n\304\000"
+ "\000mRB\372a\327\000\000\210Ca\002Y\314\000\000\317B\247\376\304\316\000"
+ "\000\234D\336\004\272\310\000\000\342E\276\005u\304\000\000(G\336\0040\300"
+ "\000\000<Ha\002\221\274\000\000\365H\247\376&\272\000\0006IB\372M\271\000"
+ "\000\216BB\372\236\317\000\000\0140a\002\350\311\000\000\344/\247\376f\314"
+ "\000\000H0\336\004.\306\000\000\2160\276\005\311\301\000\000\3240\336\004"
+ "d\275\000\000\0171a\002\252\271\000\00071\247\376-\267\000\000E1B\372M\266"
+ "\000\000\326/B\372F\315\000\000\001\200a\002\350\311\000\000\001\200\247"
+ "\376f\314\000\000\001\200\336\004.\306\000\000\001\200\276\005\311\301\000"
+ "\000\001\200\336\004d\275\000\000\001\200a\002\252\271\000\000\001\200\247"
+ "\376-\267\000\000\001\200B\372M\266\000\000\001\200B\372F\315\000\000\274"
+ ";\252$\241 \303>\326U\334X\370w\000~ _&Z@\077BB[)_ k\031j\025\232\024\226"
+ "\025\267 \3129\337T\000}*^GK_6m'\250\022\311\042\3268\346Q\001}.dJVbFo;\277"
+ "\020\3375\327\035\355Q\001}.kIcbWoN\325\020\3558\352 \367U\001}+tEr_inb\353"
+ "\022\373=\372$\376Y\001~'|A|[zkw\374\024\000@\000 \000_\010\177*\177@\177"
+ "U\177j\177\000\025\000\000\001\000\002\000\001\000\000\000\003\000\003\000"
+ "\004\000\005\000\004\000\003\000\000\000\005\000\006\000\007\000\006\000"
+ "\005\000\004\000\007\000\010\000\011\000\010\000\007\000\006\000\011\000"
+ "\012\000\013\000\012\000\011\000\010\000\014\000\012\000\015\000\012\000"
+ "\014\000\013\000\016\000\015\000\017\000\015\000\016\000\014\000\002\000"
+ "\020\000\021\000\020\000\002\000\001\000\003\000\022\000\001\000\022\000"
+ "\003\000\023\000\023\000\005\000\024\000\005\000\023\000\003\000\024\000"
+ "\007\000\025\000\007\000\024\000\005\000\025\000\011\000\026\000\011\000"
+ "\025\000\007\000\026\000\013\000\027\000\013\000\026\000\011\000\030\000"
+ "\013\000\014\000\013\000\030\000\027\000\031\000\014\000\016\000\014\000"
+ "\031\000\030\000\001\000\032\000\020\000\032\000\001\000\022\000\023\000"
+ "\033\000\022\000\033\000\023\000\034\000\034\000\024\000\035\000\024\000"
+ "\034\000\023\000\035\000\025\000\036\000\025\000\035\000\024\000\036\000"
+ "\026\000\037\000\026\000\036\000\025\000\037\000\027\000 \000\027\000\037"
+ "\000\026\000!\000\027\000\030\000\027\000!\000 \000\042\000\030\000\031\000"
+ "\030\000\042\000!\000\022\000#\000\032\000#\000\022\000\033\000\033\000$"
+ "\000%\000$\000\033\000\034\000$\000\035\000&\000\035\000$\000\034\000&\000"
+ "\036\000'\000\036\000&\000\035\000'\000\037\000(\000\037\000'\000\036\000"
+ "(\000 \000)\000 \000(\000\037\000*\000 \000!\000 \000*\000)\000!\000+\000"
+ "*\000+\000!\000\042\000#\000%\000,\000%\000#\000\033\000%\000-\000.\000-"
+ "\000%\000$\000-\000&\000/\000&\000-\000$\000/\000'\0000\000'\000/\000&\000"
+ "0\000(\0001\000(\0000\000'\0001\000)\0002\000)\0001\000(\000)\0003\0002\000"
+ "3\000)\000*\000*\0004\0003\0004\000*\000+\000,\000.\0005\000.\000,\000%\000"
+ ".\0006\0007\0006\000.\000-\0006\000/\0008\000/\0006\000-\0008\0000\0009\000"
+ "0\0008\000/\0009\0001\000:\0001\0009\0000\000:\0002\000;\0002\000:\0001\000"
+ "2\000<\000;\000<\0002\0003\0003\000=\000<\000=\0003\0004\0005\0007\000>\000"
+ "7\0005\000.\0007\000\077\000@\000\077\0007\0006\000\077\0008\000A\0008\000"
+ "\077\0006\000A\0009\000B\0009\000A\0008\000B\000:\000C\000:\000B\0009\000"
+ "C\000;\000D\000;\000C\000:\000;\000E\000D\000E\000;\000<\000<\000F\000E\000"
+ "F\000<\000=\000>\000@\000G\000@\000>\0007\000\000\000\001\000\001\000\002"
+ "\000\000\000\002\000\000\000\003\000\001\000\003\000\003\000\004\000\004"
+ "\000\005\000\003\000\005\000\000\000\004\000\005\000\006\000\006\000\007"
+ "\000\005\000\007\000\004\000\006\000\007\000\010\000\010\000\011\000\007"
+ "\000\011\000\006\000\010\000\011\000\012\000\012\000\013\000\011\000\013"
+ "\000\010\000\012\000\012\000\014\000\012\000\015\000\014\000\015\000\013"
+ "\000\014\000\015\000\016\000\015\000\017\000\016\000\017\000\014\000\016"
+ "\000\002\000\020\000\020\000\021\000\002\000\021\000\001\000\020\000\003"
+ "\000\022\000\001\000\022\000\003\000\023\000\022\000\023\000\005\000\023"
+ "\000\005\000\024\000\023\000\024\000\007\000\024\000\007\000\025\000\024"
+ "\000\025\000\011\000\025\000\011\000\026\000\025\000\026\000\013\000\026"
+ "\000\013\000\027\000\026\000\027\000\013\000\030\000\014\000\030\000\027"
+ "\000\030\000\014\000\031\000\016\000\031\000\030\000\031\000\001\000\032"
+ "\000\020\000\032\000\022\000\032\000\023\000\033\000\022\000\033\000\023"
+ "\000\034\000\033\000\034\000\024\000\034\000\024\000\035\000\034\000\035"
+ "\000\025\000\035\000\025\000\036\000\035\000\036\000\026\000\036\000\026"
+ "\000\037\000\036\000\037\000\027\000\037\000\027\000 \000\037\000 \000\027"
+ "\000!\000\030\000!\000 \000!\000\030\000\042\000\031\000\042\000!\000\042"
+ "\000\022\000#\000\032\000#\000\033\000#\000\033\000$\000$\000%\000\033\000"
+ "%\000\034\000$\000\035\000$\000\035\000&\000$\000&\000\036\000&\000\036\000"
+ "'\000&\000'\000\037\000'\000\037\000(\000'\000(\000 \000(\000 \000)\000("
+ "\000)\000 \000*\000!\000*\000)\000*\000!\000+\000*\000+\000\042\000+\000"
+ "#\000%\000%\000,\000#\000,\000%\000-\000-\000.\000%\000.\000$\000-\000&\000"
+ "-\000&\000/\000-\000/\000'\000/\000'\0000\000/\0000\000(\0000\000(\0001\000"
+ "0\0001\000)\0001\000)\0002\0001\0002\000)\0003\0002\0003\000*\0003\000*\000"
+ "4\0003\0004\000+\0004\000,\000.\000.\0005\000,\0005\000.\0006\0006\0007\000"
+ ".\0007\000-\0006\000/\0006\000/\0008\0006\0008\0000\0008\0000\0009\0008\000"
+ "9\0001\0009\0001\000:\0009\000:\0002\000:\0002\000;\000:\000;\0002\000<\000"
+ ";\000<\0003\000<\0003\000=\000<\000=\0004\000=\0005\0007\0007\000>\0005\000"
+ ">\0007\000\077\000\077\000@\0007\000@\0006\000\077\0008\000\077\0008\000"
+ "A\000\077\000A\0009\000A\0009\000B\000A\000B\000:\000B\000:\000C\000B\000"
+ "C\000;\000C\000;\000D\000C\000D\000;\000E\000D\000E\000<\000E\000<\000F\000"
+ "E\000F\000=\000F\000>\000@\000@\000G\000>\000G\000"
+;
+const unsigned long seccam_size = 10324;
@@ -1,4976 +1,1926 @@
-/* Generated from "ships.dxf" on 28-Jan-2018.
+/* Generated from "ships.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
    Faceted face normals. Normalized to unit bounding box.
    Components: ship1, ship2, ship3, ship4, ship5, ship6, ship7, ship8.
  */
 
 #include "gllist.h"
 
-static const float ships_ship1_data[] = {
-	0,1,0,0.116962,0,0.06683,
-	0,1,0,0.155077,0,0.058558,
-	0,1,0,0.116882,0,0.064477,
-	0,1,0,0.155077,0,0.058558,
-	0,1,0,0.116962,0,0.06683,
-	0,1,0,0.183794,0,0.06683,
-	0,1,0,0.155077,0,0.058558,
-	0,1,0,0.183794,0,0.06683,
-	0,1,0,0.165867,0,0.042832,
-	0,1,0,0.165867,0,0.042832,
-	0,1,0,0.183794,0,0.06683,
-	0,1,0,0.182076,0,-0.033078,
-	0,1,0,0.182076,0,-0.033078,
-	0,1,0,0.183794,0,0.06683,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.183794,0,0.06683,
-	0,1,0,0.206431,0,0.085132,
-	0,1,0,0.144982,0,0.047158,
-	0,1,0,0.144464,0,-0.025545,
-	0,1,0,0.142517,0,-0.008241,
-	0,1,0,0.144464,0,-0.025545,
-	0,1,0,0.144982,0,0.047158,
-	0,1,0,0.150519,0,0.014247,
-	0,1,0,0.144464,0,-0.025545,
-	0,1,0,0.150519,0,0.014247,
-	0,1,0,0.182076,0,-0.033078,
-	0,1,0,0.150519,0,0.014247,
-	0,1,0,0.144982,0,0.047158,
-	0,1,0,0.145659,0,0.055321,
-	0,1,0,0.150519,0,0.014247,
-	0,1,0,0.145659,0,0.055321,
-	0,1,0,0.148882,0,0.056932,
-	0,1,0,0.182076,0,-0.033078,
-	0,1,0,0.150519,0,0.014247,
-	0,1,0,0.165867,0,0.042832,
-	0,1,0,0.563884,0,0.184308,
-	0,1,0,0.588726,0,-0.050731,
-	0,1,0,0.505825,0,0.177803,
-	0,1,0,0.588726,0,-0.050731,
-	0,1,0,0.563884,0,0.184308,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.588726,0,-0.050731,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.651336,0,-0.055351,
-	0,1,0,0.651336,0,-0.055351,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.654279,0,-0.056707,
-	0,1,0,0.175726,0,0.171966,
-	0,1,0,0.206431,0,0.085132,
-	0,1,0,0.171797,0,0.170156,
-	0,1,0,0.206431,0,0.085132,
-	0,1,0,0.175726,0,0.171966,
-	0,1,0,0.194183,0,0.133925,
-	0,1,0,0.206431,0,0.085132,
-	0,1,0,0.194183,0,0.133925,
-	0,1,0,0.214272,0,0.096042,
-	0,1,0,0.206431,0,0.085132,
-	0,1,0,0.214272,0,0.096042,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.214272,0,0.096042,
-	0,1,0,0.215488,0,0.116749,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.215488,0,0.116749,
-	0,1,0,0.239742,0,0.126581,
-	0,1,0,0.360276,0,-0.04832,
-	0,1,0,0.182076,0,-0.033078,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.360276,0,-0.04832,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.360276,0,-0.04832,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.373485,0,-0.04699,
-	0,1,0,0.373485,0,-0.04699,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.406711,0,-0.042205,
-	0,1,0,0.322926,0,0.320583,
-	0,1,0,0.32449,0,0.313371,
-	0,1,0,0.301859,0,0.3108,
-	0,1,0,0.32449,0,0.313371,
-	0,1,0,0.322926,0,0.320583,
-	0,1,0,0.324435,0,0.321321,
-	0,1,0,0.32449,0,0.313371,
-	0,1,0,0.324435,0,0.321321,
-	0,1,0,0.334072,0,0.331602,
-	0,1,0,0.32449,0,0.313371,
-	0,1,0,0.334072,0,0.331602,
-	0,1,0,0.332829,0,0.298122,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.334072,0,0.331602,
-	0,1,0,0.332052,0,0.33913,
-	0,1,0,0.334072,0,0.331602,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.342277,0,0.362383,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.305543,0,0.360518,
-	0,1,0,0.34814,0,0.369892,
-	0,1,0,0.347981,0,0.350547,
-	0,1,0,0.344815,0,0.375591,
-	0,1,0,0.347981,0,0.350547,
-	0,1,0,0.34814,0,0.369892,
-	0,1,0,0.353013,0,0.361538,
-	0,1,0,0.347981,0,0.350547,
-	0,1,0,0.353013,0,0.361538,
-	0,1,0,0.362663,0,0.354466,
-	0,1,0,0.362663,0,0.354466,
-	0,1,0,0.353013,0,0.361538,
-	0,1,0,0.393197,0,0.356483,
-	0,1,0,0.362663,0,0.354466,
-	0,1,0,0.393197,0,0.356483,
-	0,1,0,0.378025,0,0.353893,
-	0,1,0,0.378679,0,0.229386,
-	0,1,0,0.368952,0,0.22393,
-	0,1,0,0.361091,0,0.236693,
-	0,1,0,0.374536,0,0.329731,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.347981,0,0.350547,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.374536,0,0.329731,
-	0,1,0,0.369252,0,0.304088,
-	0,1,0,0.369252,0,0.304088,
-	0,1,0,0.374536,0,0.329731,
-	0,1,0,0.375498,0,0.311907,
-	0,1,0,0.378815,0,0.30157,
-	0,1,0,0.371067,0,0.2787,
-	0,1,0,0.369252,0,0.304088,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.371067,0,0.2787,
-	0,1,0,0.409606,0,0.272745,
-	0,1,0,0.371067,0,0.2787,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.369252,0,0.304088,
-	0,1,0,0.329387,0,0.234545,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.311459,0,0.21872,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.329387,0,0.234545,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.361091,0,0.236693,
-	0,1,0,0.361091,0,0.236693,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.361091,0,0.236693,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.336773,0,0.355518,
-	0,1,0,0.342277,0,0.362383,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.342277,0,0.362383,
-	0,1,0,0.343893,0,0.36804,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.343893,0,0.36804,
-	0,1,0,0.344815,0,0.375591,
-	0,1,0,0.355027,0,0.271558,
-	0,1,0,0.344815,0,0.375591,
-	0,1,0,0.347981,0,0.350547,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.361091,0,0.236693,
-	0,1,0,0.368952,0,0.22393,
-	0,1,0,0.25875,0,0.2828,
-	0,1,0,0.267311,0,0.276092,
-	0,1,0,0.25728,0,0.280552,
-	0,1,0,0.267311,0,0.276092,
-	0,1,0,0.25875,0,0.2828,
-	0,1,0,0.273094,0,0.278099,
-	0,1,0,0.273094,0,0.278099,
-	0,1,0,0.25875,0,0.2828,
-	0,1,0,0.303096,0,0.283554,
-	0,1,0,0.267311,0,0.276092,
-	0,1,0,0.273094,0,0.278099,
-	0,1,0,0.267457,0,0.244485,
-	0,1,0,0.273094,0,0.278099,
-	0,1,0,0.303096,0,0.283554,
-	0,1,0,0.325469,0,0.275657,
-	0,1,0,0.325469,0,0.275657,
-	0,1,0,0.303096,0,0.283554,
-	0,1,0,0.320429,0,0.283567,
-	0,1,0,0.325469,0,0.275657,
-	0,1,0,0.320429,0,0.283567,
-	0,1,0,0.332829,0,0.298122,
-	0,1,0,0.325469,0,0.275657,
-	0,1,0,0.332829,0,0.298122,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.334395,0,0.258292,
-	0,1,0,0.332829,0,0.298122,
-	0,1,0,0.334072,0,0.331602,
-	0,1,0,0.273094,0,0.214646,
-	0,1,0,0.267457,0,0.244485,
-	0,1,0,0.273094,0,0.278099,
-	0,1,0,0.418177,0,0.231171,
-	0,1,0,0.409996,0,0.219049,
-	0,1,0,0.409996,0,0.259494,
-	0,1,0,0.409996,0,0.219049,
-	0,1,0,0.418177,0,0.231171,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.418177,0,0.231171,
-	0,1,0,0.418324,0,0.202436,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.395625,0,0.207154,
-	0,1,0,0.409996,0,0.219049,
-	0,1,0,0.505825,0,0.177803,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.495108,0,0.212769,
-	0,1,0,0.406711,0,-0.042205,
-	0,1,0,0.460766,0,0.175176,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.460766,0,0.175176,
-	0,1,0,0.406711,0,-0.042205,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.460766,0,0.175176,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.42226,0,0.181691,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.44763,0,-0.044825,
-	0,1,0,0.406711,0,-0.042205,
-	0,1,0,0.44763,0,-0.044825,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.480357,0,-0.052799,
-	0,1,0,0.480357,0,-0.052799,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.496626,0,-0.056372,
-	0,1,0,0.496626,0,-0.056372,
-	0,1,0,0.495108,0,0.177713,
-	0,1,0,0.505825,0,0.177803,
-	0,1,0,0.85052,0,0.207976,
-	0,1,0,0.85018,0,-0.03742,
-	0,1,0,0.786183,0,0.207755,
-	0,1,0,0.85018,0,-0.03742,
-	0,1,0,0.85052,0,0.207976,
-	0,1,0,0.850681,0,0.089096,
-	0,1,0,0.850681,0,0.089096,
-	0,1,0,0.85052,0,0.207976,
-	0,1,0,0.855957,0,0.183257,
-	0,1,0,0.850681,0,0.089096,
-	0,1,0,0.855957,0,0.183257,
-	0,1,0,0.853091,0,0.109288,
-	0,1,0,0.853091,0,0.109288,
-	0,1,0,0.855957,0,0.183257,
-	0,1,0,0.862404,0,0.162275,
-	0,1,0,0.853091,0,0.109288,
-	0,1,0,0.862404,0,0.162275,
-	0,1,0,0.865092,0,0.162319,
-	0,1,0,0.725123,0,0.201897,
-	0,1,0,0.858149,0,-0.077347,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.858149,0,-0.077347,
-	0,1,0,0.725123,0,0.201897,
-	0,1,0,0.786183,0,0.207755,
-	0,1,0,0.858149,0,-0.077347,
-	0,1,0,0.786183,0,0.207755,
-	0,1,0,0.85018,0,-0.03742,
-	0,1,0,0.858149,0,-0.077347,
-	0,1,0,0.85018,0,-0.03742,
-	0,1,0,0.85643,0,-0.06679,
-	0,1,0,0.856701,0,0.198121,
-	0,1,0,0.855957,0,0.183257,
-	0,1,0,0.85052,0,0.207976,
-	0,1,0,0.855957,0,0.183257,
-	0,1,0,0.856701,0,0.198121,
-	0,1,0,0.871968,0,0.193412,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.66245,0,-0.066583,
-	0,1,0,0.654279,0,-0.056707,
-	0,1,0,0.66245,0,-0.066583,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.77276,0,-0.075247,
-	0,1,0,0.77276,0,-0.075247,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.7813,0,-0.067188,
-	0,1,0,0.7813,0,-0.067188,
-	0,1,0,0.691269,0,0.197453,
-	0,1,0,0.858149,0,-0.077347,
-	0,1,0,0.282027,0,0.139433,
-	0,1,0,0.281231,0,0.130089,
-	0,1,0,0.202972,0,0.139577,
-	0,1,0,0.292538,0,0.191458,
-	0,1,0,0.28622,0,0.16455,
-	0,1,0,0.283073,0,0.18298,
-	0,1,0,0.281231,0,0.130089,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.268468,0,0.112678,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.281231,0,0.130089,
-	0,1,0,0.282027,0,0.139433,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.282027,0,0.139433,
-	0,1,0,0.28622,0,0.16455,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.28622,0,0.16455,
-	0,1,0,0.292538,0,0.191458,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.292538,0,0.191458,
-	0,1,0,0.294058,0,0.21557,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.294058,0,0.21557,
-	0,1,0,0.311459,0,0.21872,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.311459,0,0.21872,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.41681,0,0.172841,
-	0,1,0,0.368952,0,0.214645,
-	0,1,0,0.395625,0,0.207154,
-	0,1,0,0.588726,0,-0.050731,
-	0,1,0,0.496626,0,-0.056372,
-	0,1,0,0.505825,0,0.177803,
-	0,1,0,0.34814,0,0.466117,
-	0,1,0,0.344815,0,0.375591,
-	0,1,0,0.344815,0,0.466117,
-	0,1,0,0.344815,0,0.375591,
-	0,1,0,0.34814,0,0.466117,
-	0,1,0,0.34814,0,0.369892
-};
-static const struct gllist ships_ship1_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 318, ships_ship1_data, 0
-};
-const struct gllist *ships_ship1 = &ships_ship1_frame;
-
-static const float ships_ship2_data[] = {
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.007746,0,0.002005,
-	0,1,0,0.000601,0,-0.005265,
-	0,1,0,-0.000907,0,-0.004103,
-	0,1,0,0.000601,0,-0.005265,
-	0,1,0,0.007746,0,0.002005,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.007746,0,0.002005,
-	0,1,0,0.011124,0,0.003295,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.011124,0,0.003295,
-	0,1,0,0.034381,0,0.008035,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.034381,0,0.008035,
-	0,1,0,0.036326,0,0.008049,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.036326,0,0.008049,
-	0,1,0,0.04544,0,0.006283,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.04544,0,0.006283,
-	0,1,0,0.046047,0,0.005835,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.046047,0,0.005835,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.05233,0,-0.01634,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.056496,0,-0.017817,
-	0,1,0,0.05539,0,0.015178,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.046047,0,0.005835,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.05539,0,0.015178,
-	0,1,0,0.114262,0,0.021494,
-	0,1,0,0.082078,0,-0.023373,
-	0,1,0,0.114262,0,0.021494,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.114262,0,0.021494,
-	0,1,0,0.115443,0,0.022381,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.115443,0,0.022381,
-	0,1,0,0.135675,0,0.029186,
-	0,1,0,0.135675,0,0.029186,
-	0,1,0,0.115443,0,0.022381,
-	0,1,0,0.123036,0,0.035357,
-	0,1,0,0.135675,0,0.029186,
-	0,1,0,0.123036,0,0.035357,
-	0,1,0,0.125791,0,0.037178,
-	0,1,0,0.135675,0,0.029186,
-	0,1,0,0.125791,0,0.037178,
-	0,1,0,0.128954,0,0.038029,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.135675,0,0.029186,
-	0,1,0,0.149603,0,0.030315,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.149603,0,0.030315,
-	0,1,0,0.155902,0,0.031606,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.155902,0,0.031606,
-	0,1,0,0.19146,0,0.034085,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.19146,0,0.034085,
-	0,1,0,0.215206,0,0.033981,
-	0,1,0,0.215206,0,0.033981,
-	0,1,0,0.19146,0,0.034085,
-	0,1,0,0.198656,0,0.03732,
-	0,1,0,0.215206,0,0.033981,
-	0,1,0,0.198656,0,0.03732,
-	0,1,0,0.204208,0,0.039424,
-	0,1,0,0.215206,0,0.033981,
-	0,1,0,0.204208,0,0.039424,
-	0,1,0,0.205257,0,0.039407,
-	0,1,0,0.148814,0,0.110426,
-	0,1,0,0.15748,0,0.109506,
-	0,1,0,0.149603,0,0.030315,
-	0,1,0,0.15748,0,0.109506,
-	0,1,0,0.148814,0,0.110426,
-	0,1,0,0.159954,0,0.112868,
-	0,1,0,0.159954,0,0.112868,
-	0,1,0,0.148814,0,0.110426,
-	0,1,0,0.166818,0,0.122163,
-	0,1,0,0.149603,0,0.030315,
-	0,1,0,0.15748,0,0.109506,
-	0,1,0,0.155902,0,0.031606,
-	0,1,0,0.159954,0,0.112868,
-	0,1,0,0.166818,0,0.122163,
-	0,1,0,0.166936,0,0.115979,
-	0,1,0,0.166936,0,0.115979,
-	0,1,0,0.166818,0,0.122163,
-	0,1,0,0.167792,0,0.118769,
-	0,1,0,0.19581,0,0.059166,
-	0,1,0,0.19146,0,0.034085,
-	0,1,0,0.189765,0,0.059166,
-	0,1,0,0.19146,0,0.034085,
-	0,1,0,0.19581,0,0.059166,
-	0,1,0,0.198656,0,0.03732,
-	0,1,0,0.239422,0,0.050277,
-	0,1,0,0.241019,0,0.031691,
-	0,1,0,0.229393,0,0.036323,
-	0,1,0,0.241019,0,0.031691,
-	0,1,0,0.239422,0,0.050277,
-	0,1,0,0.243607,0,0.051238,
-	0,1,0,0.241019,0,0.031691,
-	0,1,0,0.243607,0,0.051238,
-	0,1,0,0.247913,0,0.050436,
-	0,1,0,0.256691,0,0.038188,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.252993,0,0.034769,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.256691,0,0.038188,
-	0,1,0,0.256714,0,0.038965,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.256714,0,0.038965,
-	0,1,0,0.262006,0,0.043711,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.262006,0,0.043711,
-	0,1,0,0.273095,0,0.046817,
-	0,1,0,0.289924,0,0.059902,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.285549,0,0.033421,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.289924,0,0.059902,
-	0,1,0,0.295191,0,0.059902,
-	0,1,0,0.309389,0,0.113628,
-	0,1,0,0.30392,0,0.107488,
-	0,1,0,0.302842,0,0.109306,
-	0,1,0,0.30392,0,0.107488,
-	0,1,0,0.309389,0,0.113628,
-	0,1,0,0.30413,0,0.105206,
-	0,1,0,0.30413,0,0.105206,
-	0,1,0,0.309389,0,0.113628,
-	0,1,0,0.311562,0,0.078755,
-	0,1,0,0.311562,0,0.078755,
-	0,1,0,0.309389,0,0.113628,
-	0,1,0,0.31579,0,0.077563,
-	0,1,0,0.311562,0,0.078755,
-	0,1,0,0.31579,0,0.077563,
-	0,1,0,0.311665,0,0.071318,
-	0,1,0,0.315386,0,0.144383,
-	0,1,0,0.312981,0,0.131794,
-	0,1,0,0.312651,0,0.133195,
-	0,1,0,0.312981,0,0.131794,
-	0,1,0,0.315386,0,0.144383,
-	0,1,0,0.321788,0,0.1221,
-	0,1,0,0.321788,0,0.1221,
-	0,1,0,0.315386,0,0.144383,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.321788,0,0.1221,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.322054,0,0.120653,
-	0,1,0,0.322054,0,0.120653,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.322874,0,0.096569,
-	0,1,0,0.322874,0,0.096569,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.323482,0,0.093677,
-	0,1,0,0.323449,0,0.083168,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.321915,0,0.077563,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.323449,0,0.083168,
-	0,1,0,0.323482,0,0.093677,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.323482,0,0.093677,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.327612,0,0.134409,
-	0,1,0,0.327612,0,0.134409,
-	0,1,0,0.32648,0,0.141993,
-	0,1,0,0.327459,0,0.138248,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.327612,0,0.134409,
-	0,1,0,0.331449,0,0.108836,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.331449,0,0.108836,
-	0,1,0,0.332251,0,0.082544,
-	0,1,0,0.332251,0,0.082544,
-	0,1,0,0.331449,0,0.108836,
-	0,1,0,0.333204,0,0.102871,
-	0,1,0,0.332251,0,0.082544,
-	0,1,0,0.333204,0,0.102871,
-	0,1,0,0.333121,0,0.093642,
-	0,1,0,0.333121,0,0.093642,
-	0,1,0,0.333204,0,0.102871,
-	0,1,0,0.333462,0,0.095451,
-	0,1,0,0.348516,0,0.105101,
-	0,1,0,0.397365,0,0.086139,
-	0,1,0,0.345482,0,0.078911,
-	0,1,0,0.397365,0,0.086139,
-	0,1,0,0.348516,0,0.105101,
-	0,1,0,0.350483,0,0.11097,
-	0,1,0,0.397365,0,0.086139,
-	0,1,0,0.350483,0,0.11097,
-	0,1,0,0.394512,0,0.087776,
-	0,1,0,0.394512,0,0.087776,
-	0,1,0,0.350483,0,0.11097,
-	0,1,0,0.351201,0,0.1154,
-	0,1,0,0.394512,0,0.087776,
-	0,1,0,0.351201,0,0.1154,
-	0,1,0,0.352062,0,0.133162,
-	0,1,0,0.394512,0,0.087776,
-	0,1,0,0.352062,0,0.133162,
-	0,1,0,0.362231,0,0.135702,
-	0,1,0,0.394512,0,0.087776,
-	0,1,0,0.362231,0,0.135702,
-	0,1,0,0.38958,0,0.099906,
-	0,1,0,0.38958,0,0.099906,
-	0,1,0,0.362231,0,0.135702,
-	0,1,0,0.387409,0,0.108858,
-	0,1,0,0.387409,0,0.108858,
-	0,1,0,0.362231,0,0.135702,
-	0,1,0,0.38428,0,0.198644,
-	0,1,0,0.406915,0,0.152377,
-	0,1,0,0.403253,0,0.135128,
-	0,1,0,0.401572,0,0.147035,
-	0,1,0,0.403253,0,0.135128,
-	0,1,0,0.406915,0,0.152377,
-	0,1,0,0.407934,0,0.130498,
-	0,1,0,0.407934,0,0.130498,
-	0,1,0,0.406915,0,0.152377,
-	0,1,0,0.41953,0,0.148153,
-	0,1,0,0.407934,0,0.130498,
-	0,1,0,0.41953,0,0.148153,
-	0,1,0,0.410269,0,0.08858,
-	0,1,0,0.410269,0,0.08858,
-	0,1,0,0.41953,0,0.148153,
-	0,1,0,0.425347,0,0.083593,
-	0,1,0,0.425347,0,0.083593,
-	0,1,0,0.451234,0,0.037834,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.451234,0,0.037834,
-	0,1,0,0.425347,0,0.083593,
-	0,1,0,0.444133,0,0.07151,
-	0,1,0,0.444133,0,0.07151,
-	0,1,0,0.425347,0,0.083593,
-	0,1,0,0.444133,0,0.084461,
-	0,1,0,0.451234,0,0.037834,
-	0,1,0,0.444133,0,0.07151,
-	0,1,0,0.445707,0,0.066652,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.226528,0,0.034709,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.218433,0,0.033347,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.226528,0,0.034709,
-	0,1,0,0.229393,0,0.036323,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.229393,0,0.036323,
-	0,1,0,0.241019,0,0.031691,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.241019,0,0.031691,
-	0,1,0,0.252993,0,0.034769,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.252993,0,0.034769,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.27313,0,-0.03143,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.275723,0,0.033421,
-	0,1,0,0.285549,0,0.033421,
-	0,1,0,0.298627,0,0.033229,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.295792,0,0.032171,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.298627,0,0.033229,
-	0,1,0,0.302246,0,0.036983,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.302246,0,0.036983,
-	0,1,0,0.308875,0,0.065389,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.308875,0,0.065389,
-	0,1,0,0.311665,0,0.071318,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.311665,0,0.071318,
-	0,1,0,0.31579,0,0.077563,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.31579,0,0.077563,
-	0,1,0,0.321915,0,0.077563,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.321915,0,0.077563,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.331265,0,0.078444,
-	0,1,0,0.345482,0,0.078911,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.345482,0,0.078911,
-	0,1,0,0.397365,0,0.086139,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.397365,0,0.086139,
-	0,1,0,0.399049,0,0.086793,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.399049,0,0.086793,
-	0,1,0,0.410269,0,0.08858,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.410269,0,0.08858,
-	0,1,0,0.425347,0,0.083593,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.350411,0,0.198046,
-	0,1,0,0.348022,0,0.202613,
-	0,1,0,0.350411,0,0.198046,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.360613,0,0.196837,
-	0,1,0,0.360613,0,0.196837,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.362231,0,0.157776,
-	0,1,0,0.362231,0,0.157776,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.362244,0,0.144871,
-	0,1,0,0.358945,0,0.220663,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.357496,0,0.219463,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.358945,0,0.220663,
-	0,1,0,0.366627,0,0.223011,
-	0,1,0,0.380369,0,0.324825,
-	0,1,0,0.373861,0,0.224955,
-	0,1,0,0.369225,0,0.227836,
-	0,1,0,0.373861,0,0.224955,
-	0,1,0,0.380369,0,0.324825,
-	0,1,0,0.38352,0,0.322964,
-	0,1,0,0.38352,0,0.322964,
-	0,1,0,0.380369,0,0.324825,
-	0,1,0,0.381407,0,0.329175,
-	0,1,0,0.38352,0,0.322964,
-	0,1,0,0.381407,0,0.329175,
-	0,1,0,0.381858,0,0.329038,
-	0,1,0,0.38352,0,0.322964,
-	0,1,0,0.381858,0,0.329038,
-	0,1,0,0.383958,0,0.323947,
-	0,1,0,0.362244,0,0.144871,
-	0,1,0,0.38428,0,0.198644,
-	0,1,0,0.362231,0,0.135702,
-	0,1,0,0.38428,0,0.198644,
-	0,1,0,0.362244,0,0.144871,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.38428,0,0.198644,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.363156,0,0.202613,
-	0,1,0,0.366627,0,0.223011,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.366627,0,0.223011,
-	0,1,0,0.36848,0,0.224601,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.36848,0,0.224601,
-	0,1,0,0.369225,0,0.227836,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.369225,0,0.227836,
-	0,1,0,0.373861,0,0.224955,
-	0,1,0,0.380949,0,0.201539,
-	0,1,0,0.373861,0,0.224955,
-	0,1,0,0.380949,0,0.223681,
-	0,1,0,0.358191,0,0.154835,
-	0,1,0,0.35916,0,0.147807,
-	0,1,0,0.356002,0,0.149867,
-	0,1,0,0.35916,0,0.147807,
-	0,1,0,0.358191,0,0.154835,
-	0,1,0,0.362231,0,0.157776,
-	0,1,0,0.35916,0,0.147807,
-	0,1,0,0.362231,0,0.157776,
-	0,1,0,0.36019,0,0.147475,
-	0,1,0,0.36019,0,0.147475,
-	0,1,0,0.362231,0,0.157776,
-	0,1,0,0.362244,0,0.144871,
-	0,1,0,0.478811,0,0.092274,
-	0,1,0,0.473165,0,0.036584,
-	0,1,0,0.463625,0,0.042121,
-	0,1,0,0.473165,0,0.036584,
-	0,1,0,0.478811,0,0.092274,
-	0,1,0,0.490493,0,0.092799,
-	0,1,0,0.490493,0,0.092799,
-	0,1,0,0.478811,0,0.092274,
-	0,1,0,0.481892,0,0.096319,
-	0,1,0,0.490493,0,0.092799,
-	0,1,0,0.481892,0,0.096319,
-	0,1,0,0.498402,0,0.106856,
-	0,1,0,0.490493,0,0.092799,
-	0,1,0,0.498402,0,0.106856,
-	0,1,0,0.491729,0,0.094592,
-	0,1,0,0.491729,0,0.094592,
-	0,1,0,0.498402,0,0.106856,
-	0,1,0,0.500624,0,0.09968,
-	0,1,0,0.500624,0,0.09968,
-	0,1,0,0.498402,0,0.106856,
-	0,1,0,0.499526,0,0.10796,
-	0,1,0,0.500624,0,0.09968,
-	0,1,0,0.499526,0,0.10796,
-	0,1,0,0.50155,0,0.101548,
-	0,1,0,0.545711,0,0.050757,
-	0,1,0,0.551148,0,0.030911,
-	0,1,0,0.530999,0,0.030908,
-	0,1,0,0.551148,0,0.030911,
-	0,1,0,0.545711,0,0.050757,
-	0,1,0,0.556558,0,0.03991,
-	0,1,0,0.551148,0,0.030911,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.530999,0,0.030908,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.551148,0,0.030911,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.551148,0,0.030911,
-	0,1,0,0.569784,0,0.030911,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.569784,0,0.030911,
-	0,1,0,0.57627,0,0.03241,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.57627,0,0.03241,
-	0,1,0,0.578786,0,0.032037,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.578786,0,0.032037,
-	0,1,0,0.584034,0,0.028571,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.584034,0,0.028571,
-	0,1,0,0.593555,0,0.027764,
-	0,1,0,0.454472,0,0.039998,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.452392,0,0.034041,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.454472,0,0.039998,
-	0,1,0,0.4559,0,0.041105,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.4559,0,0.041105,
-	0,1,0,0.463625,0,0.042121,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.463625,0,0.042121,
-	0,1,0,0.473165,0,0.036584,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.473165,0,0.036584,
-	0,1,0,0.521992,0,0.026308,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.521992,0,0.026308,
-	0,1,0,0.526188,0,0.027401,
-	0,1,0,0.53283,0,-0.042382,
-	0,1,0,0.526188,0,0.027401,
-	0,1,0,0.530999,0,0.030908,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.593555,0,0.027764,
-	0,1,0,0.61703,0,-0.045932,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.686573,0,0.025396,
-	0,1,0,0.64097,0,0.065405,
-	0,1,0,0.636461,0,0.040099,
-	0,1,0,0.634712,0,0.065405,
-	0,1,0,0.667649,0,0.066339,
-	0,1,0,0.66702,0,0.042964,
-	0,1,0,0.66702,0,0.066177,
-	0,1,0,0.595342,0,0.029428,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.593555,0,0.027764,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.595342,0,0.029428,
-	0,1,0,0.600274,0,0.047426,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.600274,0,0.047426,
-	0,1,0,0.621236,0,0.041148,
-	0,1,0,0.621236,0,0.041148,
-	0,1,0,0.600274,0,0.047426,
-	0,1,0,0.612783,0,0.047426,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.621236,0,0.041148,
-	0,1,0,0.636461,0,0.040099,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.636461,0,0.040099,
-	0,1,0,0.646435,0,0.040846,
-	0,1,0,0.646435,0,0.040846,
-	0,1,0,0.636461,0,0.040099,
-	0,1,0,0.644949,0,0.043771,
-	0,1,0,0.644949,0,0.043771,
-	0,1,0,0.636461,0,0.040099,
-	0,1,0,0.64097,0,0.065405,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.646435,0,0.040846,
-	0,1,0,0.658856,0,0.033146,
-	0,1,0,0.658856,0,0.033146,
-	0,1,0,0.646435,0,0.040846,
-	0,1,0,0.658114,0,0.033868,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.658856,0,0.033146,
-	0,1,0,0.660833,0,0.041706,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.660833,0,0.041706,
-	0,1,0,0.66702,0,0.042964,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.66702,0,0.042964,
-	0,1,0,0.667649,0,0.066339,
-	0,1,0,0.67251,0,0.024493,
-	0,1,0,0.667649,0,0.066339,
-	0,1,0,0.671724,0,0.060605,
-	0,1,0,0.733263,0,0.068956,
-	0,1,0,0.724391,0,0.035637,
-	0,1,0,0.724391,0,0.067731,
-	0,1,0,0.724391,0,0.035637,
-	0,1,0,0.733263,0,0.068956,
-	0,1,0,0.731575,0,0.035178,
-	0,1,0,0.751012,0,0.070143,
-	0,1,0,0.745822,0,0.032981,
-	0,1,0,0.744276,0,0.067174,
-	0,1,0,0.686573,0,0.025396,
-	0,1,0,0.702004,0,0.036422,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.702004,0,0.036422,
-	0,1,0,0.686573,0,0.025396,
-	0,1,0,0.693908,0,0.039314,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.702004,0,0.036422,
-	0,1,0,0.705222,0,0.035648,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.705222,0,0.035648,
-	0,1,0,0.724391,0,0.035637,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.724391,0,0.035637,
-	0,1,0,0.731575,0,0.035178,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.731575,0,0.035178,
-	0,1,0,0.745822,0,0.032981,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.745822,0,0.032981,
-	0,1,0,0.751012,0,0.070143,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.751012,0,0.070143,
-	0,1,0,0.751251,0,0.069879,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.686573,0,0.025396,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.758328,0,0.022225,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.752838,0,0.022247,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.758328,0,0.022225,
-	0,1,0,0.760717,0,0.023705,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.760717,0,0.023705,
-	0,1,0,0.763686,0,0.029793,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.763686,0,0.029793,
-	0,1,0,0.775494,0,0.029431,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.775494,0,0.029431,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.775494,0,0.029431,
-	0,1,0,0.793924,0,0.030164,
-	0,1,0,0.793924,0,0.030164,
-	0,1,0,0.775494,0,0.029431,
-	0,1,0,0.777172,0,0.032133,
-	0,1,0,0.793924,0,0.030164,
-	0,1,0,0.777172,0,0.032133,
-	0,1,0,0.792169,0,0.030598,
-	0,1,0,0.792169,0,0.030598,
-	0,1,0,0.777172,0,0.032133,
-	0,1,0,0.780437,0,0.034775,
-	0,1,0,0.792169,0,0.030598,
-	0,1,0,0.780437,0,0.034775,
-	0,1,0,0.783285,0,0.035582,
-	0,1,0,0.792169,0,0.030598,
-	0,1,0,0.783285,0,0.035582,
-	0,1,0,0.785043,0,0.03528,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.793924,0,0.030164,
-	0,1,0,0.804859,0,0.033487,
-	0,1,0,0.800558,0,0.159259,
-	0,1,0,0.787813,0,0.145168,
-	0,1,0,0.784219,0,0.148766,
-	0,1,0,0.787813,0,0.145168,
-	0,1,0,0.800558,0,0.159259,
-	0,1,0,0.796022,0,0.149859,
-	0,1,0,0.796022,0,0.149859,
-	0,1,0,0.800558,0,0.159259,
-	0,1,0,0.799435,0,0.133145,
-	0,1,0,0.799435,0,0.133145,
-	0,1,0,0.792353,0,0.128543,
-	0,1,0,0.790974,0,0.134211,
-	0,1,0,0.792353,0,0.128543,
-	0,1,0,0.799435,0,0.133145,
-	0,1,0,0.797658,0,0.124415,
-	0,1,0,0.797658,0,0.124415,
-	0,1,0,0.799435,0,0.133145,
-	0,1,0,0.804859,0,0.033487,
-	0,1,0,0.804859,0,0.033487,
-	0,1,0,0.799435,0,0.133145,
-	0,1,0,0.800558,0,0.159259,
-	0,1,0,0.804859,0,0.033487,
-	0,1,0,0.800558,0,0.159259,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.777658,0,-0.051804,
-	0,1,0,0.773649,0,-0.052537,
-	0,1,0,0.777658,0,-0.051804,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.86606,0,0.023103,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.86606,0,0.023103,
-	0,1,0,0.886731,0,0.026124,
-	0,1,0,0.841367,0,0.029285,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.815305,0,0.030123,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.841367,0,0.029285,
-	0,1,0,0.851862,0,0.025179,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.851862,0,0.025179,
-	0,1,0,0.853977,0,0.024647,
-	0,1,0,0.845392,0,-0.047089,
-	0,1,0,0.853977,0,0.024647,
-	0,1,0,0.86606,0,0.023103,
-	0,1,0,0.886731,0,0.026124,
-	0,1,0,0.86606,0,0.023103,
-	0,1,0,0.879107,0,0.033745,
-	0,1,0,0.93232,0,0.028568,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.886731,0,0.026124,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.93232,0,0.028568,
-	0,1,0,0.936722,0,0.029307,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.936722,0,0.029307,
-	0,1,0,0.941445,0,0.029359,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.941445,0,0.029359,
-	0,1,0,0.942786,0,0.0299,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.942786,0,0.0299,
-	0,1,0,0.955336,0,0.037642,
-	0,1,0,0.957862,0,0.037913,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.955336,0,0.037642,
-	0,1,0,0.964659,0,-0.059776,
-	0,1,0,0.957862,0,0.037913,
-	0,1,0,0.967828,0,0.035511
-};
-static const struct gllist ships_ship2_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 648, ships_ship2_data, 0
-};
-const struct gllist *ships_ship2 = &ships_ship2_frame;
-
-static const float ships_ship3_data[] = {
-	0,1,0,0.015851,0,0.046394,
-	0,1,0,0.015929,0,0.038282,
-	0,1,0,0.014266,0,0.040885,
-	0,1,0,0.015929,0,0.038282,
-	0,1,0,0.015851,0,0.046394,
-	0,1,0,0.018182,0,0.047508,
-	0,1,0,0.015929,0,0.038282,
-	0,1,0,0.018182,0,0.047508,
-	0,1,0,0.019779,0,0.038229,
-	0,1,0,0.019779,0,0.038229,
-	0,1,0,0.018182,0,0.047508,
-	0,1,0,0.035945,0,0.047566,
-	0,1,0,0.019779,0,0.038229,
-	0,1,0,0.035945,0,0.047566,
-	0,1,0,0.02188,0,0.036875,
-	0,1,0,0.02188,0,0.036875,
-	0,1,0,0.035945,0,0.047566,
-	0,1,0,0.029478,0,0.024544,
-	0,1,0,0.029478,0,0.024544,
-	0,1,0,0.035945,0,0.047566,
-	0,1,0,0.037645,0,0.003234,
-	0,1,0,0.037645,0,0.003234,
-	0,1,0,0.035945,0,0.047566,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.037645,0,0.003234,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.040264,0,-0.011908,
-	0,1,0,0.040264,0,-0.011908,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.040536,0,-0.021064,
-	0,1,0,0.040536,0,-0.021064,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.041948,0,-0.030472,
-	0,1,0,0.041948,0,-0.030472,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.042065,0,0.052086,
-	0,1,0,0.044194,0,0.054994,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.044194,0,0.054994,
-	0,1,0,0.049793,0,0.051119,
-	0,1,0,0.049793,0,0.051119,
-	0,1,0,0.044194,0,0.054994,
-	0,1,0,0.048873,0,0.056721,
-	0,1,0,0.049793,0,0.051119,
-	0,1,0,0.048873,0,0.056721,
-	0,1,0,0.049708,0,0.055744,
-	0,1,0,0.295437,0,0.189535,
-	0,1,0,0.295348,0,0.125306,
-	0,1,0,0.292194,0,0.125174,
-	0,1,0,0.295348,0,0.125306,
-	0,1,0,0.295437,0,0.189535,
-	0,1,0,0.298384,0,0.189681,
-	0,1,0,0.298384,0,0.189681,
-	0,1,0,0.295437,0,0.189535,
-	0,1,0,0.29722,0,0.191215,
-	0,1,0,0.290227,0,0.117533,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.289122,0,0.111447,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.290227,0,0.117533,
-	0,1,0,0.292194,0,0.125174,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.292194,0,0.125174,
-	0,1,0,0.295348,0,0.125306,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.045608,0,-0.036047,
-	0,1,0,0.041948,0,-0.030472,
-	0,1,0,0.045608,0,-0.036047,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.063489,0,-0.048855,
-	0,1,0,0.063489,0,-0.048855,
-	0,1,0,0.053729,0,0.047541,
-	0,1,0,0.073036,0,0.047538,
-	0,1,0,0.063489,0,-0.048855,
-	0,1,0,0.073036,0,0.047538,
-	0,1,0,0.07063,0,-0.057463,
-	0,1,0,0.07063,0,-0.057463,
-	0,1,0,0.073036,0,0.047538,
-	0,1,0,0.071931,0,-0.074179,
-	0,1,0,0.071931,0,-0.074179,
-	0,1,0,0.073036,0,0.047538,
-	0,1,0,0.073929,0,-0.07413,
-	0,1,0,0.073929,0,-0.07413,
-	0,1,0,0.073036,0,0.047538,
-	0,1,0,0.080232,0,0.046154,
-	0,1,0,0.073929,0,-0.07413,
-	0,1,0,0.080232,0,0.046154,
-	0,1,0,0.079608,0,-0.072847,
-	0,1,0,0.079608,0,-0.072847,
-	0,1,0,0.080232,0,0.046154,
-	0,1,0,0.095979,0,0.048639,
-	0,1,0,0.095979,0,0.048639,
-	0,1,0,0.080232,0,0.046154,
-	0,1,0,0.093136,0,0.048192,
-	0,1,0,0.093136,0,0.048192,
-	0,1,0,0.080232,0,0.046154,
-	0,1,0,0.08401,0,0.04815,
-	0,1,0,0.066853,0,-0.066771,
-	0,1,0,0.071931,0,-0.074179,
-	0,1,0,0.066006,0,-0.069836,
-	0,1,0,0.071931,0,-0.074179,
-	0,1,0,0.066853,0,-0.066771,
-	0,1,0,0.068385,0,-0.066732,
-	0,1,0,0.071931,0,-0.074179,
-	0,1,0,0.068385,0,-0.066732,
-	0,1,0,0.07063,0,-0.057463,
-	0,1,0,0.095979,0,0.048639,
-	0,1,0,0.095594,0,-0.07618,
-	0,1,0,0.079608,0,-0.072847,
-	0,1,0,0.095594,0,-0.07618,
-	0,1,0,0.095979,0,0.048639,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.095979,0,0.048639,
-	0,1,0,0.099578,0,0.054939,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.099578,0,0.054939,
-	0,1,0,0.104217,0,0.056863,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.104217,0,0.056863,
-	0,1,0,0.112866,0,0.056826,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.112866,0,0.056826,
-	0,1,0,0.112866,0,0.049101,
-	0,1,0,0.107623,0,-0.080766,
-	0,1,0,0.112866,0,0.049101,
-	0,1,0,0.117782,0,-0.082199,
-	0,1,0,0.117782,0,-0.082199,
-	0,1,0,0.112866,0,0.049101,
-	0,1,0,0.120566,0,0.049101,
-	0,1,0,0.117782,0,-0.082199,
-	0,1,0,0.120566,0,0.049101,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.120566,0,0.049101,
-	0,1,0,0.122811,0,0.049147,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.122811,0,0.049147,
-	0,1,0,0.132573,0,0.050735,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.132573,0,0.050735,
-	0,1,0,0.143604,0,0.049297,
-	0,1,0,0.151725,0,0.053824,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.143604,0,0.049297,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.151725,0,0.053824,
-	0,1,0,0.153019,0,0.055208,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.153019,0,0.055208,
-	0,1,0,0.160992,0,0.05183,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.160992,0,0.05183,
-	0,1,0,0.161772,0,0.050677,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.161772,0,0.050677,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.162074,0,-0.085334,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.164064,0,-0.086036,
-	0,1,0,0.164064,0,-0.086036,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.179323,0,-0.085322,
-	0,1,0,0.179323,0,-0.085322,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.210986,0,-0.085355,
-	0,1,0,0.210986,0,-0.085355,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.164064,0,-0.086036,
-	0,1,0,0.179323,0,-0.085322,
-	0,1,0,0.174355,0,-0.086232,
-	0,1,0,0.164004,0,0.058998,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.163342,0,0.052327,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.164004,0,0.058998,
-	0,1,0,0.166036,0,0.0644,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.166036,0,0.0644,
-	0,1,0,0.176335,0,0.078644,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.176335,0,0.078644,
-	0,1,0,0.181777,0,0.081599,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.181777,0,0.081599,
-	0,1,0,0.201083,0,0.081563,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.201083,0,0.081563,
-	0,1,0,0.205442,0,0.082139,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.205442,0,0.082139,
-	0,1,0,0.222419,0,0.080429,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.222419,0,0.080429,
-	0,1,0,0.22596,0,0.081582,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.22596,0,0.081582,
-	0,1,0,0.235552,0,0.080432,
-	0,1,0,0.226909,0,-0.085975,
-	0,1,0,0.235552,0,0.080432,
-	0,1,0,0.242832,0,-0.086596,
-	0,1,0,0.242832,0,-0.086596,
-	0,1,0,0.235552,0,0.080432,
-	0,1,0,0.262862,0,-0.08689,
-	0,1,0,0.262862,0,-0.08689,
-	0,1,0,0.235552,0,0.080432,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.237151,0,0.081245,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.235552,0,0.080432,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.237151,0,0.081245,
-	0,1,0,0.25104,0,0.090562,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.25104,0,0.090562,
-	0,1,0,0.262936,0,0.095569,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.262936,0,0.095569,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.336118,0,-0.084098,
-	0,1,0,0.283076,0,-0.088384,
-	0,1,0,0.336118,0,-0.084098,
-	0,1,0,0.321823,0,-0.086865,
-	0,1,0,0.278458,0,0.097208,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.262936,0,0.095569,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.278458,0,0.097208,
-	0,1,0,0.284215,0,0.102654,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.284215,0,0.102654,
-	0,1,0,0.288497,0,0.109486,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.288497,0,0.109486,
-	0,1,0,0.289122,0,0.111447,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.289122,0,0.111447,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.350542,0,-0.081588,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.364966,0,-0.079077,
-	0,1,0,0.298197,0,0.122344,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.295356,0,0.120633,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.298197,0,0.122344,
-	0,1,0,0.305665,0,0.124623,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.305665,0,0.124623,
-	0,1,0,0.322084,0,0.123258,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.322084,0,0.123258,
-	0,1,0,0.325168,0,0.12322,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.325168,0,0.12322,
-	0,1,0,0.33646,0,0.127836,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.33646,0,0.127836,
-	0,1,0,0.357946,0,0.146587,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.357946,0,0.146587,
-	0,1,0,0.362818,0,0.147952,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.362818,0,0.147952,
-	0,1,0,0.385985,0,0.148029,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.385985,0,0.148029,
-	0,1,0,0.396055,0,0.148029,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.396055,0,0.148029,
-	0,1,0,0.397327,0,0.147452,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.397327,0,0.147452,
-	0,1,0,0.39755,0,0.147372,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.39755,0,0.147372,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.402829,0,-0.069765,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.448393,0,-0.069842,
-	0,1,0,0.448393,0,-0.069842,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.452983,0,-0.069752,
-	0,1,0,0.387946,0,0.149451,
-	0,1,0,0.396055,0,0.148029,
-	0,1,0,0.385985,0,0.148029,
-	0,1,0,0.396055,0,0.148029,
-	0,1,0,0.387946,0,0.149451,
-	0,1,0,0.392417,0,0.149679,
-	0,1,0,0.392417,0,0.149679,
-	0,1,0,0.387946,0,0.149451,
-	0,1,0,0.389737,0,0.16196,
-	0,1,0,0.392417,0,0.149679,
-	0,1,0,0.389737,0,0.16196,
-	0,1,0,0.391512,0,0.158236,
-	0,1,0,0.391512,0,0.158236,
-	0,1,0,0.389737,0,0.16196,
-	0,1,0,0.391138,0,0.169794,
-	0,1,0,0.39265,0,0.179964,
-	0,1,0,0.391512,0,0.158236,
-	0,1,0,0.391138,0,0.169794,
-	0,1,0,0.391512,0,0.158236,
-	0,1,0,0.39265,0,0.179964,
-	0,1,0,0.394239,0,0.174853,
-	0,1,0,0.394239,0,0.174853,
-	0,1,0,0.39265,0,0.179964,
-	0,1,0,0.397569,0,0.204221,
-	0,1,0,0.394239,0,0.174853,
-	0,1,0,0.397569,0,0.204221,
-	0,1,0,0.40666,0,0.219098,
-	0,1,0,0.40666,0,0.219098,
-	0,1,0,0.397569,0,0.204221,
-	0,1,0,0.404345,0,0.223788,
-	0,1,0,0.40666,0,0.219098,
-	0,1,0,0.404345,0,0.223788,
-	0,1,0,0.408002,0,0.244733,
-	0,1,0,0.40666,0,0.219098,
-	0,1,0,0.408002,0,0.244733,
-	0,1,0,0.408099,0,0.224636,
-	0,1,0,0.408099,0,0.224636,
-	0,1,0,0.408002,0,0.244733,
-	0,1,0,0.408103,0,0.249253,
-	0,1,0,0.408099,0,0.224636,
-	0,1,0,0.408103,0,0.249253,
-	0,1,0,0.409262,0,0.230389,
-	0,1,0,0.409262,0,0.230389,
-	0,1,0,0.408103,0,0.249253,
-	0,1,0,0.409766,0,0.262537,
-	0,1,0,0.409262,0,0.230389,
-	0,1,0,0.409766,0,0.262537,
-	0,1,0,0.409683,0,0.234017,
-	0,1,0,0.409683,0,0.234017,
-	0,1,0,0.409766,0,0.262537,
-	0,1,0,0.410439,0,0.237557,
-	0,1,0,0.410439,0,0.237557,
-	0,1,0,0.409766,0,0.262537,
-	0,1,0,0.411514,0,0.264809,
-	0,1,0,0.410439,0,0.237557,
-	0,1,0,0.411514,0,0.264809,
-	0,1,0,0.410716,0,0.23952,
-	0,1,0,0.410716,0,0.23952,
-	0,1,0,0.411514,0,0.264809,
-	0,1,0,0.411294,0,0.23952,
-	0,1,0,0.411294,0,0.23952,
-	0,1,0,0.411514,0,0.264809,
-	0,1,0,0.412466,0,0.250129,
-	0,1,0,0.412466,0,0.250129,
-	0,1,0,0.411514,0,0.264809,
-	0,1,0,0.413564,0,0.265255,
-	0,1,0,0.412466,0,0.250129,
-	0,1,0,0.413564,0,0.265255,
-	0,1,0,0.414263,0,0.261778,
-	0,1,0,0.414263,0,0.261778,
-	0,1,0,0.413564,0,0.265255,
-	0,1,0,0.414269,0,0.264074,
-	0,1,0,0.410716,0,0.237056,
-	0,1,0,0.410439,0,0.237557,
-	0,1,0,0.410716,0,0.23952,
-	0,1,0,0.449951,0,0.131491,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.449885,0,0.112195,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.449951,0,0.131491,
-	0,1,0,0.456562,0,0.143466,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.456562,0,0.143466,
-	0,1,0,0.461568,0,0.148136,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.461568,0,0.148136,
-	0,1,0,0.488701,0,0.15421,
-	0,1,0,0.488701,0,0.15421,
-	0,1,0,0.461568,0,0.148136,
-	0,1,0,0.470528,0,0.152711,
-	0,1,0,0.488701,0,0.15421,
-	0,1,0,0.470528,0,0.152711,
-	0,1,0,0.478978,0,0.154784,
-	0,1,0,0.397327,0,0.148029,
-	0,1,0,0.397327,0,0.147452,
-	0,1,0,0.396055,0,0.148029,
-	0,1,0,0.397327,0,0.147452,
-	0,1,0,0.397327,0,0.148029,
-	0,1,0,0.39755,0,0.147372,
-	0,1,0,0.414121,0,0.239961,
-	0,1,0,0.412797,0,0.232563,
-	0,1,0,0.412797,0,0.23952,
-	0,1,0,0.412797,0,0.232563,
-	0,1,0,0.412705,0,0.228176,
-	0,1,0,0.412671,0,0.232563,
-	0,1,0,0.412705,0,0.228176,
-	0,1,0,0.412797,0,0.232563,
-	0,1,0,0.414375,0,0.214159,
-	0,1,0,0.414375,0,0.214159,
-	0,1,0,0.412797,0,0.232563,
-	0,1,0,0.414121,0,0.239961,
-	0,1,0,0.414375,0,0.214159,
-	0,1,0,0.414121,0,0.239961,
-	0,1,0,0.415751,0,0.237628,
-	0,1,0,0.414375,0,0.214159,
-	0,1,0,0.415751,0,0.237628,
-	0,1,0,0.41744,0,0.195384,
-	0,1,0,0.41744,0,0.195384,
-	0,1,0,0.415751,0,0.237628,
-	0,1,0,0.417574,0,0.222045,
-	0,1,0,0.41744,0,0.195384,
-	0,1,0,0.417574,0,0.222045,
-	0,1,0,0.418892,0,0.189839,
-	0,1,0,0.418892,0,0.189839,
-	0,1,0,0.417574,0,0.222045,
-	0,1,0,0.420163,0,0.207736,
-	0,1,0,0.418892,0,0.189839,
-	0,1,0,0.420163,0,0.207736,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.420163,0,0.207736,
-	0,1,0,0.420471,0,0.206322,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.420471,0,0.206322,
-	0,1,0,0.422094,0,0.189984,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.422094,0,0.189984,
-	0,1,0,0.422204,0,0.18577,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.422204,0,0.18577,
-	0,1,0,0.422281,0,0.185797,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.422281,0,0.185797,
-	0,1,0,0.445986,0,0.117057,
-	0,1,0,0.422448,0,0.176471,
-	0,1,0,0.445986,0,0.117057,
-	0,1,0,0.440637,0,0.123725,
-	0,1,0,0.440637,0,0.123725,
-	0,1,0,0.445986,0,0.117057,
-	0,1,0,0.446342,0,0.105798,
-	0,1,0,0.446342,0,0.105798,
-	0,1,0,0.445986,0,0.117057,
-	0,1,0,0.449885,0,0.112195,
-	0,1,0,0.404666,0,0.144819,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.39755,0,0.147372,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.404666,0,0.144819,
-	0,1,0,0.417249,0,0.137992,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.417249,0,0.137992,
-	0,1,0,0.417828,0,0.135939,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.417828,0,0.135939,
-	0,1,0,0.418963,0,0.137857,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.418963,0,0.137857,
-	0,1,0,0.420489,0,0.14266,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.420489,0,0.14266,
-	0,1,0,0.423494,0,0.136547,
-	0,1,0,0.423494,0,0.136547,
-	0,1,0,0.420489,0,0.14266,
-	0,1,0,0.423393,0,0.140375,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.423494,0,0.136547,
-	0,1,0,0.426619,0,0.128495,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.426619,0,0.128495,
-	0,1,0,0.446342,0,0.105798,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.446342,0,0.105798,
-	0,1,0,0.449885,0,0.112195,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.449885,0,0.112195,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.47088,0,-0.068458,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.472985,0,-0.079165,
-	0,1,0,0.472985,0,-0.079165,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.477482,0,-0.083803,
-	0,1,0,0.477482,0,-0.083803,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.493522,0,-0.08792,
-	0,1,0,0.493522,0,-0.08792,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.503354,0,-0.089342,
-	0,1,0,0.503354,0,-0.089342,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.50828,0,-0.088395,
-	0,1,0,0.50828,0,-0.088395,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.534723,0,-0.08711,
-	0,1,0,0.534723,0,-0.08711,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.523233,0,0.184872,
-	0,1,0,0.522566,0,0.172052,
-	0,1,0,0.522412,0,0.19779,
-	0,1,0,0.503876,0,0.164781,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.495993,0,0.155045,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.503876,0,0.164781,
-	0,1,0,0.507138,0,0.175776,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.507138,0,0.175776,
-	0,1,0,0.511315,0,0.197987,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.511315,0,0.197987,
-	0,1,0,0.511757,0,0.204784,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.511757,0,0.204784,
-	0,1,0,0.515058,0,0.208096,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.515058,0,0.208096,
-	0,1,0,0.517911,0,0.206731,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.517911,0,0.206731,
-	0,1,0,0.522566,0,0.172052,
-	0,1,0,0.522566,0,0.172052,
-	0,1,0,0.517911,0,0.206731,
-	0,1,0,0.522412,0,0.19779,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.522566,0,0.172052,
-	0,1,0,0.525238,0,0.168112,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.525238,0,0.168112,
-	0,1,0,0.541531,0,0.157186,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.541531,0,0.157186,
-	0,1,0,0.550193,0,0.142374,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.550193,0,0.142374,
-	0,1,0,0.550431,0,0.139425,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.550431,0,0.139425,
-	0,1,0,0.555635,0,0.135535,
-	0,1,0,0.557055,0,-0.086961,
-	0,1,0,0.555635,0,0.135535,
-	0,1,0,0.579593,0,-0.085334,
-	0,1,0,0.579593,0,-0.085334,
-	0,1,0,0.555635,0,0.135535,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.569712,0,0.137066,
-	0,1,0,0.570459,0,0.127076,
-	0,1,0,0.570371,0,0.122531,
-	0,1,0,0.570459,0,0.127076,
-	0,1,0,0.569712,0,0.137066,
-	0,1,0,0.571755,0,0.13583,
-	0,1,0,0.590147,0,0.136555,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.588142,0,0.137089,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.590147,0,0.136555,
-	0,1,0,0.591503,0,0.117398,
-	0,1,0,0.591503,0,0.117398,
-	0,1,0,0.590147,0,0.136555,
-	0,1,0,0.596161,0,0.12439,
-	0,1,0,0.591503,0,0.117398,
-	0,1,0,0.596161,0,0.12439,
-	0,1,0,0.595853,0,0.123322,
-	0,1,0,0.555635,0,0.135535,
-	0,1,0,0.570371,0,0.122531,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.570371,0,0.122531,
-	0,1,0,0.555635,0,0.135535,
-	0,1,0,0.569712,0,0.137066,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.570371,0,0.122531,
-	0,1,0,0.577399,0,0.12947,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.577399,0,0.12947,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.577399,0,0.12947,
-	0,1,0,0.588142,0,0.137089,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.598969,0,-0.084539,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.618344,0,-0.083744,
-	0,1,0,0.618344,0,-0.083744,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.620558,0,-0.083594,
-	0,1,0,0.638795,0,0.138343,
-	0,1,0,0.630773,0,0.109371,
-	0,1,0,0.628868,0,0.134444,
-	0,1,0,0.630773,0,0.109371,
-	0,1,0,0.638795,0,0.138343,
-	0,1,0,0.635865,0,0.11419,
-	0,1,0,0.635865,0,0.11419,
-	0,1,0,0.638795,0,0.138343,
-	0,1,0,0.641805,0,0.120056,
-	0,1,0,0.641805,0,0.120056,
-	0,1,0,0.638795,0,0.138343,
-	0,1,0,0.640371,0,0.13732,
-	0,1,0,0.641805,0,0.120056,
-	0,1,0,0.640371,0,0.13732,
-	0,1,0,0.644216,0,0.129739,
-	0,1,0,0.593283,0,0.112433,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.589106,0,0.113213,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.593283,0,0.112433,
-	0,1,0,0.608183,0,0.115627,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.608183,0,0.115627,
-	0,1,0,0.620228,0,0.125744,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.620228,0,0.125744,
-	0,1,0,0.628868,0,0.134444,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.628868,0,0.134444,
-	0,1,0,0.630773,0,0.109371,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.630773,0,0.109371,
-	0,1,0,0.632083,0,0.099196,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.632083,0,0.099196,
-	0,1,0,0.633435,0,0.097076,
-	0,1,0,0.636807,0,-0.079832,
-	0,1,0,0.633435,0,0.097076,
-	0,1,0,0.659098,0,-0.082422,
-	0,1,0,0.659098,0,-0.082422,
-	0,1,0,0.633435,0,0.097076,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.683151,0,0.104598,
-	0,1,0,0.676838,0,0.095602,
-	0,1,0,0.67674,0,0.096198,
-	0,1,0,0.676838,0,0.095602,
-	0,1,0,0.683151,0,0.104598,
-	0,1,0,0.681594,0,0.095206,
-	0,1,0,0.645913,0,0.095497,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.633435,0,0.097076,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.645913,0,0.095497,
-	0,1,0,0.658364,0,0.095442,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.658364,0,0.095442,
-	0,1,0,0.665007,0,0.092662,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.665007,0,0.092662,
-	0,1,0,0.668193,0,0.093641,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.668193,0,0.093641,
-	0,1,0,0.675042,0,0.093973,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.675042,0,0.093973,
-	0,1,0,0.676838,0,0.095602,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.676838,0,0.095602,
-	0,1,0,0.681594,0,0.095206,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.681594,0,0.095206,
-	0,1,0,0.682756,0,0.094429,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.682756,0,0.094429,
-	0,1,0,0.69471,0,0.095379,
-	0,1,0,0.688136,0,-0.086747,
-	0,1,0,0.69471,0,0.095379,
-	0,1,0,0.697541,0,-0.085334,
-	0,1,0,0.697541,0,-0.085334,
-	0,1,0,0.69471,0,0.095379,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.697541,0,-0.085334,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.721669,0,-0.084006,
-	0,1,0,0.721669,0,-0.084006,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.721669,0,-0.084006,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.740914,0,-0.08382,
-	0,1,0,0.666293,0,0.147331,
-	0,1,0,0.664464,0,0.129539,
-	0,1,0,0.659941,0,0.133769,
-	0,1,0,0.664464,0,0.129539,
-	0,1,0,0.666293,0,0.147331,
-	0,1,0,0.670008,0,0.146624,
-	0,1,0,0.670008,0,0.146624,
-	0,1,0,0.666293,0,0.147331,
-	0,1,0,0.672392,0,0.152118,
-	0,1,0,0.658491,0,0.105804,
-	0,1,0,0.665007,0,0.092662,
-	0,1,0,0.658364,0,0.095442,
-	0,1,0,0.665007,0,0.092662,
-	0,1,0,0.658491,0,0.105804,
-	0,1,0,0.659941,0,0.133769,
-	0,1,0,0.665007,0,0.092662,
-	0,1,0,0.659941,0,0.133769,
-	0,1,0,0.664565,0,0.096331,
-	0,1,0,0.664565,0,0.096331,
-	0,1,0,0.659941,0,0.133769,
-	0,1,0,0.664464,0,0.129539,
-	0,1,0,0.683316,0,0.128023,
-	0,1,0,0.67432,0,0.110964,
-	0,1,0,0.673619,0,0.119635,
-	0,1,0,0.67432,0,0.110964,
-	0,1,0,0.683316,0,0.128023,
-	0,1,0,0.67674,0,0.096198,
-	0,1,0,0.67674,0,0.096198,
-	0,1,0,0.683316,0,0.128023,
-	0,1,0,0.683151,0,0.104598,
-	0,1,0,0.683151,0,0.104598,
-	0,1,0,0.683316,0,0.128023,
-	0,1,0,0.68523,0,0.10755,
-	0,1,0,0.68523,0,0.10755,
-	0,1,0,0.683316,0,0.128023,
-	0,1,0,0.686054,0,0.131038,
-	0,1,0,0.68523,0,0.10755,
-	0,1,0,0.686054,0,0.131038,
-	0,1,0,0.689344,0,0.118277,
-	0,1,0,0.689344,0,0.118277,
-	0,1,0,0.686054,0,0.131038,
-	0,1,0,0.690758,0,0.15228,
-	0,1,0,0.689344,0,0.118277,
-	0,1,0,0.690758,0,0.15228,
-	0,1,0,0.690744,0,0.135418,
-	0,1,0,0.690744,0,0.135418,
-	0,1,0,0.690758,0,0.15228,
-	0,1,0,0.695374,0,0.151256,
-	0,1,0,0.695374,0,0.151256,
-	0,1,0,0.690758,0,0.15228,
-	0,1,0,0.694023,0,0.154102,
-	0,1,0,0.676838,0,0.095602,
-	0,1,0,0.675042,0,0.093973,
-	0,1,0,0.67674,0,0.096198,
-	0,1,0,0.700699,0,0.113833,
-	0,1,0,0.698637,0,0.107129,
-	0,1,0,0.698607,0,0.110847,
-	0,1,0,0.698637,0,0.107129,
-	0,1,0,0.700699,0,0.113833,
-	0,1,0,0.700027,0,0.1007,
-	0,1,0,0.71142,0,0.121852,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.706288,0,0.114609,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.71142,0,0.121852,
-	0,1,0,0.712349,0,0.097834,
-	0,1,0,0.712349,0,0.097834,
-	0,1,0,0.71142,0,0.121852,
-	0,1,0,0.718607,0,0.119625,
-	0,1,0,0.712349,0,0.097834,
-	0,1,0,0.718607,0,0.119625,
-	0,1,0,0.716207,0,0.10467,
-	0,1,0,0.716207,0,0.10467,
-	0,1,0,0.718607,0,0.119625,
-	0,1,0,0.720963,0,0.115796,
-	0,1,0,0.700027,0,0.1007,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.69471,0,0.095379,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.700027,0,0.1007,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.700027,0,0.1007,
-	0,1,0,0.700699,0,0.113833,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.700699,0,0.113833,
-	0,1,0,0.70433,0,0.107742,
-	0,1,0,0.70433,0,0.107742,
-	0,1,0,0.700699,0,0.113833,
-	0,1,0,0.703083,0,0.111247,
-	0,1,0,0.710934,0,0.096154,
-	0,1,0,0.70433,0,0.107742,
-	0,1,0,0.706288,0,0.114609,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.726299,0,0.121245,
-	0,1,0,0.724778,0,0.123159,
-	0,1,0,0.726299,0,0.121245,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.727211,0,0.118538,
-	0,1,0,0.727211,0,0.118538,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.728191,0,0.109149,
-	0,1,0,0.717693,0,0.090808,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.714606,0,0.090823,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.717693,0,0.090808,
-	0,1,0,0.724838,0,0.096644,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.724838,0,0.096644,
-	0,1,0,0.728191,0,0.109149,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.728191,0,0.109149,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.735872,0,0.120998,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.735872,0,0.120998,
-	0,1,0,0.746533,0,0.123297,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.746533,0,0.123297,
-	0,1,0,0.75824,0,0.125027,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.75824,0,0.125027,
-	0,1,0,0.769164,0,0.128267,
-	0,1,0,0.760371,0,-0.082103,
-	0,1,0,0.769164,0,0.128267,
-	0,1,0,0.773434,0,-0.081962,
-	0,1,0,0.773434,0,-0.081962,
-	0,1,0,0.769164,0,0.128267,
-	0,1,0,0.770977,0,0.129352,
-	0,1,0,0.773434,0,-0.081962,
-	0,1,0,0.770977,0,0.129352,
-	0,1,0,0.780388,0,0.131047,
-	0,1,0,0.773434,0,-0.081962,
-	0,1,0,0.780388,0,0.131047,
-	0,1,0,0.781407,0,-0.077168,
-	0,1,0,0.781407,0,-0.077168,
-	0,1,0,0.780388,0,0.131047,
-	0,1,0,0.785378,0,0.128196,
-	0,1,0,0.781407,0,-0.077168,
-	0,1,0,0.785378,0,0.128196,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.785378,0,0.128196,
-	0,1,0,0.798004,0,0.111252,
-	0,1,0,0.798004,0,0.111252,
-	0,1,0,0.785378,0,0.128196,
-	0,1,0,0.795684,0,0.117865,
-	0,1,0,0.798004,0,0.111252,
-	0,1,0,0.795684,0,0.117865,
-	0,1,0,0.797348,0,0.11477,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.798004,0,0.111252,
-	0,1,0,0.802588,0,0.109414,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.802588,0,0.109414,
-	0,1,0,0.807957,0,0.109245,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.807957,0,0.109245,
-	0,1,0,0.810112,0,0.105565,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.810112,0,0.105565,
-	0,1,0,0.809692,0,0.098815,
-	0,1,0,0.698986,0,0.159118,
-	0,1,0,0.697733,0,0.157344,
-	0,1,0,0.697047,0,0.159257,
-	0,1,0,0.697733,0,0.157344,
-	0,1,0,0.698986,0,0.159118,
-	0,1,0,0.704953,0,0.147311,
-	0,1,0,0.704953,0,0.147311,
-	0,1,0,0.698986,0,0.159118,
-	0,1,0,0.700381,0,0.158805,
-	0,1,0,0.704953,0,0.147311,
-	0,1,0,0.700381,0,0.158805,
-	0,1,0,0.707131,0,0.15673,
-	0,1,0,0.704953,0,0.147311,
-	0,1,0,0.707131,0,0.15673,
-	0,1,0,0.70634,0,0.142556,
-	0,1,0,0.70634,0,0.142556,
-	0,1,0,0.707131,0,0.15673,
-	0,1,0,0.713988,0,0.128847,
-	0,1,0,0.713988,0,0.128847,
-	0,1,0,0.707131,0,0.15673,
-	0,1,0,0.709295,0,0.14924,
-	0,1,0,0.713988,0,0.128847,
-	0,1,0,0.709295,0,0.14924,
-	0,1,0,0.712793,0,0.136003,
-	0,1,0,0.713988,0,0.128847,
-	0,1,0,0.712793,0,0.136003,
-	0,1,0,0.720359,0,0.128477,
-	0,1,0,0.713988,0,0.128847,
-	0,1,0,0.720359,0,0.128477,
-	0,1,0,0.724778,0,0.123159,
-	0,1,0,0.724778,0,0.123159,
-	0,1,0,0.720359,0,0.128477,
-	0,1,0,0.72999,0,0.121899,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.785814,0,-0.077411,
-	0,1,0,0.781407,0,-0.077168,
-	0,1,0,0.785814,0,-0.077411,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.800677,0,-0.080722,
-	0,1,0,0.800677,0,-0.080722,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.822454,0,-0.079411,
-	0,1,0,0.822454,0,-0.079411,
-	0,1,0,0.808261,0,0.092493,
-	0,1,0,0.817664,0,0.087083,
-	0,1,0,0.822454,0,-0.079411,
-	0,1,0,0.817664,0,0.087083,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.822454,0,-0.079411,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.876622,0,-0.077509,
-	0,1,0,0.876622,0,-0.077509,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.891471,0,-0.072365,
-	0,1,0,0.876622,0,-0.077509,
-	0,1,0,0.891471,0,-0.072365,
-	0,1,0,0.886758,0,-0.075894,
-	0,1,0,0.879236,0,0.103329,
-	0,1,0,0.880494,0,0.087719,
-	0,1,0,0.876092,0,0.089178,
-	0,1,0,0.880494,0,0.087719,
-	0,1,0,0.879236,0,0.103329,
-	0,1,0,0.880933,0,0.112746,
-	0,1,0,0.880494,0,0.087719,
-	0,1,0,0.880933,0,0.112746,
-	0,1,0,0.882485,0,0.101668,
-	0,1,0,0.882485,0,0.101668,
-	0,1,0,0.880933,0,0.112746,
-	0,1,0,0.883682,0,0.116359,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.983297,0,-0.043914,
-	0,1,0,0.983297,0,-0.043914,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.988108,0,-0.009716,
-	0,1,0,0.983297,0,-0.043914,
-	0,1,0,0.988108,0,-0.009716,
-	0,1,0,0.987389,0,-0.028605,
-	0,1,0,0.988108,0,-0.009716,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.990187,0,0.00336,
-	0,1,0,0.988108,0,-0.009716,
-	0,1,0,0.98919,0,-0.02392,
-	0,1,0,0.987389,0,-0.028605,
-	0,1,0,0.98919,0,-0.02392,
-	0,1,0,0.988108,0,-0.009716,
-	0,1,0,0.988446,0,-0.01112,
-	0,1,0,0.832307,0,0.092813,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.817664,0,0.087083,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.832307,0,0.092813,
-	0,1,0,0.837239,0,0.093877,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.837239,0,0.093877,
-	0,1,0,0.852684,0,0.093915,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.852684,0,0.093915,
-	0,1,0,0.868186,0,0.090299,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.868186,0,0.090299,
-	0,1,0,0.874095,0,0.087813,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.874095,0,0.087813,
-	0,1,0,0.876092,0,0.089178,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.876092,0,0.089178,
-	0,1,0,0.880494,0,0.087719,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.880494,0,0.087719,
-	0,1,0,0.889776,0,0.087627,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.889776,0,0.087627,
-	0,1,0,0.930862,0,0.086184,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.930862,0,0.086184,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.990594,0,0.044208,
-	0,1,0,0.988787,0,0.009887,
-	0,1,0,0.979628,0,0.056886,
-	0,1,0,0.988787,0,0.009887,
-	0,1,0,0.990594,0,0.044208,
-	0,1,0,0.992143,0,0.01847,
-	0,1,0,0.992143,0,0.01847,
-	0,1,0,0.990594,0,0.044208,
-	0,1,0,0.996902,0,0.039876,
-	0,1,0,0.992143,0,0.01847,
-	0,1,0,0.996902,0,0.039876,
-	0,1,0,0.998585,0,0.029074,
-	0,1,0,0.998585,0,0.029074,
-	0,1,0,0.996902,0,0.039876,
-	0,1,0,0.999093,0,0.039624,
-	0,1,0,0.916362,0,0.10467,
-	0,1,0,0.914865,0,0.097326,
-	0,1,0,0.914857,0,0.102711,
-	0,1,0,0.914865,0,0.097326,
-	0,1,0,0.916362,0,0.10467,
-	0,1,0,0.91648,0,0.095495,
-	0,1,0,0.91648,0,0.095495,
-	0,1,0,0.916362,0,0.10467,
-	0,1,0,0.927423,0,0.107904,
-	0,1,0,0.91648,0,0.095495,
-	0,1,0,0.927423,0,0.107904,
-	0,1,0,0.921214,0,0.093992,
-	0,1,0,0.921214,0,0.093992,
-	0,1,0,0.927423,0,0.107904,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.927423,0,0.107904,
-	0,1,0,0.945177,0,0.107786,
-	0,1,0,0.935113,0,0.086174,
-	0,1,0,0.945177,0,0.107786,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.945177,0,0.107786,
-	0,1,0,0.956964,0,0.106578,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.956964,0,0.106578,
-	0,1,0,0.962517,0,0.102149,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.962517,0,0.102149,
-	0,1,0,0.973408,0,0.069285,
-	0,1,0,0.973408,0,0.069285,
-	0,1,0,0.962517,0,0.102149,
-	0,1,0,0.972771,0,0.079921,
-	0,1,0,0.972771,0,0.079921,
-	0,1,0,0.962517,0,0.102149,
-	0,1,0,0.972658,0,0.08315,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.973408,0,0.069285,
-	0,1,0,0.976736,0,0.059775,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.976736,0,0.059775,
-	0,1,0,0.979628,0,0.056886,
-	0,1,0,0.989048,0,0.004923,
-	0,1,0,0.979628,0,0.056886,
-	0,1,0,0.988787,0,0.009887,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.915167,0,-0.070111,
-	0,1,0,0.894145,0,-0.071426,
-	0,1,0,0.915167,0,-0.070111,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.939839,0,-0.069902,
-	0,1,0,0.939839,0,-0.069902,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.964695,0,-0.068243,
-	0,1,0,0.964695,0,-0.068243,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.973177,0,-0.068253,
-	0,1,0,0.973177,0,-0.068253,
-	0,1,0,0.980026,0,-0.051806,
-	0,1,0,0.980817,0,-0.058157,
-	0,1,0,0.973177,0,-0.068253,
-	0,1,0,0.980817,0,-0.058157,
-	0,1,0,0.982753,0,-0.067376
-};
-static const struct gllist ships_ship3_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 1044, ships_ship3_data, 0
-};
-const struct gllist *ships_ship3 = &ships_ship3_frame;
-
-static const float ships_ship4_data[] = {
-	0,1,0,0.304943,0,0.190323,
-	0,1,0,0.326396,0,0.170348,
-	0,1,0,0.299248,0,0.187399,
-	0,1,0,0.326396,0,0.170348,
-	0,1,0,0.304943,0,0.190323,
-	0,1,0,0.345944,0,0.166544,
-	0,1,0,0.246234,0,0.135536,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.245025,0,0.128414,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.246234,0,0.135536,
-	0,1,0,0.257787,0,0.135536,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.257787,0,0.135536,
-	0,1,0,0.262284,0,0.12738,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.262284,0,0.12738,
-	0,1,0,0.273445,0,0.128616,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.273445,0,0.128616,
-	0,1,0,0.273481,0,0.138748,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.273481,0,0.138748,
-	0,1,0,0.275634,0,0.164606,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.275634,0,0.164606,
-	0,1,0,0.28583,0,0.172039,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.28583,0,0.172039,
-	0,1,0,0.297928,0,0.175909,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.297928,0,0.175909,
-	0,1,0,0.326396,0,0.170348,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.326396,0,0.170348,
-	0,1,0,0.358476,0,-0.020344,
-	0,1,0,0.358476,0,-0.020344,
-	0,1,0,0.326396,0,0.170348,
-	0,1,0,0.345944,0,0.166544,
-	0,1,0,0.14381,0,0.103841,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.14156,0,0.094759,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.14381,0,0.103841,
-	0,1,0,0.158432,0,0.103903,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.158432,0,0.103903,
-	0,1,0,0.168776,0,0.095234,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.168776,0,0.095234,
-	0,1,0,0.175846,0,0.104926,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.175846,0,0.104926,
-	0,1,0,0.194066,0,0.087656,
-	0,1,0,0.194066,0,0.087656,
-	0,1,0,0.175846,0,0.104926,
-	0,1,0,0.190935,0,0.102262,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.194066,0,0.087656,
-	0,1,0,0.202579,0,0.103094,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.202579,0,0.103094,
-	0,1,0,0.210571,0,0.087724,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.210571,0,0.087724,
-	0,1,0,0.223665,0,0.105104,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.223665,0,0.105104,
-	0,1,0,0.223681,0,0.123024,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.223681,0,0.123024,
-	0,1,0,0.245025,0,0.128414,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.245025,0,0.128414,
-	0,1,0,0.297968,0,-0.027452,
-	0,1,0,0.036626,0,0.113962,
-	0,1,0,0.03682,0,0.09696,
-	0,1,0,0.031803,0,0.10418,
-	0,1,0,0.03682,0,0.09696,
-	0,1,0,0.036626,0,0.113962,
-	0,1,0,0.05721,0,0.099867,
-	0,1,0,0.03682,0,0.09696,
-	0,1,0,0.05721,0,0.099867,
-	0,1,0,0.039559,0,0.002209,
-	0,1,0,0.039559,0,0.002209,
-	0,1,0,0.05721,0,0.099867,
-	0,1,0,0.051559,0,-0.037322,
-	0,1,0,0.051559,0,-0.037322,
-	0,1,0,0.05721,0,0.099867,
-	0,1,0,0.061101,0,0.092082,
-	0,1,0,0.03061,0,-0.010889,
-	0,1,0,0.03271,0,-0.026229,
-	0,1,0,0.025668,0,-0.013396,
-	0,1,0,0.03271,0,-0.026229,
-	0,1,0,0.03061,0,-0.010889,
-	0,1,0,0.039559,0,0.002209,
-	0,1,0,0.03271,0,-0.026229,
-	0,1,0,0.039559,0,0.002209,
-	0,1,0,0.051559,0,-0.037322,
-	0,1,0,0.009609,0,0.103487,
-	0,1,0,0.015049,0,0.084688,
-	0,1,0,0.006732,0,0.089029,
-	0,1,0,0.015049,0,0.084688,
-	0,1,0,0.009609,0,0.103487,
-	0,1,0,0.022363,0,0.103487,
-	0,1,0,0.015049,0,0.084688,
-	0,1,0,0.022363,0,0.103487,
-	0,1,0,0.017935,0,0.071363,
-	0,1,0,0.017935,0,0.071363,
-	0,1,0,0.022363,0,0.103487,
-	0,1,0,0.03285,0,0.034328,
-	0,1,0,0.03285,0,0.034328,
-	0,1,0,0.022363,0,0.103487,
-	0,1,0,0.031087,0,0.094974,
-	0,1,0,0.03285,0,0.034328,
-	0,1,0,0.031087,0,0.094974,
-	0,1,0,0.03682,0,0.09696,
-	0,1,0,0.03285,0,0.034328,
-	0,1,0,0.03682,0,0.09696,
-	0,1,0,0.039559,0,0.002209,
-	0,1,0,0.106151,0,0.104429,
-	0,1,0,0.104181,0,0.088847,
-	0,1,0,0.096575,0,0.104429,
-	0,1,0,0.061101,0,0.092082,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.051559,0,-0.037322,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.061101,0,0.092082,
-	0,1,0,0.091936,0,0.089043,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.091936,0,0.089043,
-	0,1,0,0.104181,0,0.088847,
-	0,1,0,0.104181,0,0.088847,
-	0,1,0,0.091936,0,0.089043,
-	0,1,0,0.096575,0,0.104429,
-	0,1,0,0.23746,0,-0.034559,
-	0,1,0,0.104181,0,0.088847,
-	0,1,0,0.14156,0,0.094759,
-	0,1,0,0.329906,0,0.185972,
-	0,1,0,0.342762,0,0.172869,
-	0,1,0,0.324891,0,0.186066,
-	0,1,0,0.342762,0,0.172869,
-	0,1,0,0.329906,0,0.185972,
-	0,1,0,0.339844,0,0.181324,
-	0,1,0,0.342762,0,0.172869,
-	0,1,0,0.339844,0,0.181324,
-	0,1,0,0.360305,0,0.183469,
-	0,1,0,0.342762,0,0.172869,
-	0,1,0,0.360305,0,0.183469,
-	0,1,0,0.345944,0,0.166544,
-	0,1,0,0.345944,0,0.166544,
-	0,1,0,0.360305,0,0.183469,
-	0,1,0,0.358476,0,-0.020344,
-	0,1,0,0.358476,0,-0.020344,
-	0,1,0,0.360305,0,0.183469,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.360305,0,0.183469,
-	0,1,0,0.369467,0,0.182719,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.369467,0,0.182719,
-	0,1,0,0.38488,0,0.188501,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.38488,0,0.188501,
-	0,1,0,0.397781,0,0.183285,
-	0,1,0,0.408713,0,0.203571,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.397781,0,0.183285,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.408713,0,0.203571,
-	0,1,0,0.410142,0,0.215072,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.410142,0,0.215072,
-	0,1,0,0.425881,0,0.215072,
-	0,1,0,0.415493,0,-0.021069,
-	0,1,0,0.425881,0,0.215072,
-	0,1,0,0.479404,0,-0.030146,
-	0,1,0,0.479404,0,-0.030146,
-	0,1,0,0.425881,0,0.215072,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.418248,0,0.35148,
-	0,1,0,0.418356,0,0.341484,
-	0,1,0,0.405514,0,0.352143,
-	0,1,0,0.418356,0,0.341484,
-	0,1,0,0.418248,0,0.35148,
-	0,1,0,0.428617,0,0.369988,
-	0,1,0,0.418356,0,0.341484,
-	0,1,0,0.428617,0,0.369988,
-	0,1,0,0.42234,0,0.318448,
-	0,1,0,0.42234,0,0.318448,
-	0,1,0,0.428617,0,0.369988,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.428617,0,0.369988,
-	0,1,0,0.452839,0,0.343883,
-	0,1,0,0.452839,0,0.343883,
-	0,1,0,0.428617,0,0.369988,
-	0,1,0,0.445208,0,0.355164,
-	0,1,0,0.410902,0,0.298372,
-	0,1,0,0.390397,0,0.283464,
-	0,1,0,0.383552,0,0.29897,
-	0,1,0,0.390397,0,0.283464,
-	0,1,0,0.410902,0,0.298372,
-	0,1,0,0.399968,0,0.282169,
-	0,1,0,0.399968,0,0.282169,
-	0,1,0,0.410902,0,0.298372,
-	0,1,0,0.404167,0,0.283968,
-	0,1,0,0.404167,0,0.283968,
-	0,1,0,0.410902,0,0.298372,
-	0,1,0,0.420169,0,0.284013,
-	0,1,0,0.420169,0,0.284013,
-	0,1,0,0.410902,0,0.298372,
-	0,1,0,0.414131,0,0.314687,
-	0,1,0,0.420169,0,0.284013,
-	0,1,0,0.414131,0,0.314687,
-	0,1,0,0.42234,0,0.318448,
-	0,1,0,0.420169,0,0.284013,
-	0,1,0,0.42234,0,0.318448,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.520644,0,0.224976,
-	0,1,0,0.516866,0,0.207753,
-	0,1,0,0.503959,0,0.226903,
-	0,1,0,0.530608,0,0.199574,
-	0,1,0,0.52136,0,0.179767,
-	0,1,0,0.516866,0,0.207753,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.479404,0,-0.030146,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.503959,0,0.226903,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.503959,0,0.226903,
-	0,1,0,0.516866,0,0.207753,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.516866,0,0.207753,
-	0,1,0,0.52136,0,0.179767,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.52136,0,0.179767,
-	0,1,0,0.523769,0,0.167802,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.523769,0,0.167802,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.537226,0,-0.025853,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.549719,0,0.12887,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.549719,0,0.12887,
-	0,1,0,0.554575,0,0.12323,
-	0,1,0,0.552753,0,0.178346,
-	0,1,0,0.523769,0,0.167802,
-	0,1,0,0.52136,0,0.179767,
-	0,1,0,0.523769,0,0.167802,
-	0,1,0,0.552753,0,0.178346,
-	0,1,0,0.560238,0,0.169988,
-	0,1,0,0.541347,0,0.163708,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.523769,0,0.167802,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.541347,0,0.163708,
-	0,1,0,0.555944,0,0.155783,
-	0,1,0,0.555944,0,0.155783,
-	0,1,0,0.541347,0,0.163708,
-	0,1,0,0.559142,0,0.163585,
-	0,1,0,0.560035,0,0.144169,
-	0,1,0,0.548236,0,0.136243,
-	0,1,0,0.555944,0,0.155783,
-	0,1,0,0.564799,0,0.119242,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.554575,0,0.12323,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.564799,0,0.119242,
-	0,1,0,0.58033,0,0.115393,
-	0,1,0,0.566645,0,-0.018616,
-	0,1,0,0.58033,0,0.115393,
-	0,1,0,0.62089,0,-0.018575,
-	0,1,0,0.62089,0,-0.018575,
-	0,1,0,0.58033,0,0.115393,
-	0,1,0,0.585431,0,0.121481,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.583856,0,0.153968,
-	0,1,0,0.581753,0,0.158505,
-	0,1,0,0.583856,0,0.153968,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.585431,0,0.121481,
-	0,1,0,0.585431,0,0.121481,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.583856,0,0.153968,
-	0,1,0,0.574491,0,0.147231,
-	0,1,0,0.570974,0,0.157277,
-	0,1,0,0.574491,0,0.147231,
-	0,1,0,0.583856,0,0.153968,
-	0,1,0,0.585431,0,0.121481,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.62089,0,-0.018575,
-	0,1,0,0.585431,0,0.121481,
-	0,1,0,0.62089,0,-0.018575,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.61878,0,-0.025619,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.62089,0,-0.018575,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.661318,0,0.122183,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.661318,0,0.122183,
-	0,1,0,0.670206,0,0.110851,
-	0,1,0,0.573562,0,0.172873,
-	0,1,0,0.581753,0,0.158505,
-	0,1,0,0.572534,0,0.161272,
-	0,1,0,0.581753,0,0.158505,
-	0,1,0,0.573562,0,0.172873,
-	0,1,0,0.583793,0,0.171573,
-	0,1,0,0.581753,0,0.158505,
-	0,1,0,0.583793,0,0.171573,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.583793,0,0.171573,
-	0,1,0,0.584888,0,0.181456,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.584888,0,0.181456,
-	0,1,0,0.624872,0,0.174338,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.624872,0,0.174338,
-	0,1,0,0.633124,0,0.175123,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.633124,0,0.175123,
-	0,1,0,0.634269,0,0.164334,
-	0,1,0,0.633973,0,0.156872,
-	0,1,0,0.634269,0,0.164334,
-	0,1,0,0.668778,0,0.167913,
-	0,1,0,0.668778,0,0.167913,
-	0,1,0,0.634269,0,0.164334,
-	0,1,0,0.665861,0,0.175198,
-	0,1,0,0.6544,0,0.149992,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.635778,0,0.146679,
-	0,1,0,0.637038,0,0.134243,
-	0,1,0,0.6544,0,0.149992,
-	0,1,0,0.661318,0,0.122183,
-	0,1,0,0.661318,0,0.122183,
-	0,1,0,0.6544,0,0.149992,
-	0,1,0,0.662997,0,0.135334,
-	0,1,0,0.665945,0,0.129564,
-	0,1,0,0.670206,0,0.110851,
-	0,1,0,0.661318,0,0.122183,
-	0,1,0,0.670206,0,0.110851,
-	0,1,0,0.665945,0,0.129564,
-	0,1,0,0.672333,0,0.136286,
-	0,1,0,0.735491,0,0.103255,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.734536,0,0.096627,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.735491,0,0.103255,
-	0,1,0,0.756588,0,0.09584,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.756588,0,0.09584,
-	0,1,0,0.787724,0,0.092968,
-	0,1,0,0.787724,0,0.092968,
-	0,1,0,0.756588,0,0.09584,
-	0,1,0,0.779594,0,0.095468,
-	0,1,0,0.692539,0,0.110851,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.670206,0,0.110851,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.692539,0,0.110851,
-	0,1,0,0.700333,0,0.101232,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.700333,0,0.101232,
-	0,1,0,0.702466,0,0.086725,
-	0,1,0,0.702152,0,-0.018998,
-	0,1,0,0.702466,0,0.086725,
-	0,1,0,0.73176,0,-0.018818,
-	0,1,0,0.73176,0,-0.018818,
-	0,1,0,0.702466,0,0.086725,
-	0,1,0,0.720485,0,0.08966,
-	0,1,0,0.73176,0,-0.018818,
-	0,1,0,0.720485,0,0.08966,
-	0,1,0,0.734536,0,0.096627,
-	0,1,0,0.73176,0,-0.018818,
-	0,1,0,0.734536,0,0.096627,
-	0,1,0,0.761369,0,-0.022527,
-	0,1,0,0.761369,0,-0.022527,
-	0,1,0,0.734536,0,0.096627,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.761369,0,-0.022527,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.793365,0,-0.023345,
-	0,1,0,0.762469,0,0.0869,
-	0,1,0,0.793365,0,-0.023345,
-	0,1,0,0.75396,0,0.088343,
-	0,1,0,0.793365,0,-0.023345,
-	0,1,0,0.762469,0,0.0869,
-	0,1,0,0.792877,0,0.074633,
-	0,1,0,0.793365,0,-0.023345,
-	0,1,0,0.792877,0,0.074633,
-	0,1,0,0.803272,0,0.067506,
-	0,1,0,0.793365,0,-0.023345,
-	0,1,0,0.803272,0,0.067506,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.803272,0,0.067506,
-	0,1,0,0.821617,0,0.065833,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.821617,0,0.065833,
-	0,1,0,0.84053,0,0.064639,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.84053,0,0.064639,
-	0,1,0,0.852984,0,0.059455,
-	0,1,0,0.88081,0,0.08527,
-	0,1,0,0.84053,0,0.064639,
-	0,1,0,0.821617,0,0.065833,
-	0,1,0,0.84053,0,0.064639,
-	0,1,0,0.88081,0,0.08527,
-	0,1,0,0.847707,0,0.067725,
-	0,1,0,0.847707,0,0.067725,
-	0,1,0,0.88081,0,0.08527,
-	0,1,0,0.882139,0,0.078045,
-	0,1,0,0.882139,0,0.078045,
-	0,1,0,0.88081,0,0.08527,
-	0,1,0,0.883984,0,0.079929,
-	0,1,0,0.929535,0,0.061348,
-	0,1,0,0.920327,0,0.053894,
-	0,1,0,0.897836,0,0.057214,
-	0,1,0,0.920327,0,0.053894,
-	0,1,0,0.929535,0,0.061348,
-	0,1,0,0.938087,0,0.057211,
-	0,1,0,0.864701,0,0.066306,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.852984,0,0.059455,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.864701,0,0.066306,
-	0,1,0,0.880233,0,0.058765,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.880233,0,0.058765,
-	0,1,0,0.897836,0,0.057214,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.897836,0,0.057214,
-	0,1,0,0.920327,0,0.053894,
-	0,1,0,0.904408,0,-0.014934,
-	0,1,0,0.920327,0,0.053894,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.920327,0,0.053894,
-	0,1,0,0.935168,0,0.046694,
-	0,1,0,0.958106,0,0.048214,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.935168,0,0.046694,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.958106,0,0.048214,
-	0,1,0,0.966364,0,0.035069,
-	0,1,0,0.966364,0,0.035069,
-	0,1,0,0.958106,0,0.048214,
-	0,1,0,0.966595,0,0.039642,
-	0,1,0,0.973143,0,0.031323,
-	0,1,0,0.967674,0,-0.002108,
-	0,1,0,0.966364,0,0.035069,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.967674,0,-0.002108,
-	0,1,0,0.981188,0,-0.014459,
-	0,1,0,0.967674,0,-0.002108,
-	0,1,0,0.96438,0,-0.016439,
-	0,1,0,0.966364,0,0.035069,
-	0,1,0,0.981188,0,-0.014459,
-	0,1,0,0.967674,0,-0.002108,
-	0,1,0,0.984607,0,-0.00735,
-	0,1,0,0.476049,0,0.277053,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.452839,0,0.343883,
-	0,1,0,0.427524,0,0.227217,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.425881,0,0.215072,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.427524,0,0.227217,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.47774,0,0.264282,
-	0,1,0,0.47774,0,0.264282,
-	0,1,0,0.427764,0,0.276224,
-	0,1,0,0.476049,0,0.277053,
-	0,1,0,0.489913,0,0.219775,
-	0,1,0,0.47774,0,0.264282,
-	0,1,0,0.489232,0,0.230519,
-	0,1,0,0.473055,0,0.390849,
-	0,1,0,0.458901,0,0.371717,
-	0,1,0,0.439417,0,0.380594,
-	0,1,0,0.458901,0,0.371717,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.452839,0,0.343883,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.458901,0,0.371717,
-	0,1,0,0.473055,0,0.390849,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.473055,0,0.390849,
-	0,1,0,0.483181,0,0.363554,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.483181,0,0.363554,
-	0,1,0,0.484033,0,0.350585,
-	0,1,0,0.476049,0,0.277053,
-	0,1,0,0.452839,0,0.343883,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.503726,0,0.315268,
-	0,1,0,0.476049,0,0.277053,
-	0,1,0,0.474537,0,0.318785,
-	0,1,0,0.476049,0,0.277053,
-	0,1,0,0.503726,0,0.315268,
-	0,1,0,0.492139,0,0.292934,
-	0,1,0,0.492139,0,0.292934,
-	0,1,0,0.503726,0,0.315268,
-	0,1,0,0.506622,0,0.300411,
-	0,1,0,0.492139,0,0.292934,
-	0,1,0,0.506622,0,0.300411,
-	0,1,0,0.574724,0,0.29066,
-	0,1,0,0.574724,0,0.29066,
-	0,1,0,0.506622,0,0.300411,
-	0,1,0,0.571048,0,0.29579
-};
-static const struct gllist ships_ship4_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 522, ships_ship4_data, 0
-};
-const struct gllist *ships_ship4 = &ships_ship4_frame;
-
-static const float ships_ship5_data[] = {
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.001715,0,-0.045957,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.181433,0,0.064832,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.181433,0,0.064832,
-	0,1,0,0.181484,0,0.064736,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.181484,0,0.064736,
-	0,1,0,0.181506,0,0.064743,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.052158,0,0.02414,
-	0,1,0,0.048308,0,0.034479,
-	0,1,0,0.136388,0,0.141637,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.125094,0,0.067408,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.136388,0,0.141637,
-	0,1,0,0.171394,0,0.137342,
-	0,1,0,0.095935,0,0.057113,
-	0,1,0,0.111465,0,0.057453,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.111465,0,0.057453,
-	0,1,0,0.095935,0,0.057113,
-	0,1,0,0.100355,0,0.06043,
-	0,1,0,0.016847,0,0.048638,
-	0,1,0,0.014814,0,0.024288,
-	0,1,0,0.012424,0,0.046373,
-	0,1,0,0.014814,0,0.024288,
-	0,1,0,0.016847,0,0.048638,
-	0,1,0,0.021172,0,0.02702,
-	0,1,0,0.014814,0,0.024288,
-	0,1,0,0.021172,0,0.02702,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.021172,0,0.02702,
-	0,1,0,0.016847,0,0.048638,
-	0,1,0,0.017702,0,0.047032,
-	0,1,0,0.008355,0,0.00998,
-	0,1,0,0.052158,0,0.02414,
-	0,1,0,0.008266,0,-0.029831,
-	0,1,0,0.052158,0,0.02414,
-	0,1,0,0.008355,0,0.00998,
-	0,1,0,0.044731,0,0.024115,
-	0,1,0,0.044731,0,0.024115,
-	0,1,0,0.008355,0,0.00998,
-	0,1,0,0.01012,0,0.024024,
-	0,1,0,0.044731,0,0.024115,
-	0,1,0,0.01012,0,0.024024,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.01012,0,0.024024,
-	0,1,0,0.014814,0,0.024288,
-	0,1,0,0.044731,0,0.024115,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.032846,0,0.025595,
-	0,1,0,0.044731,0,0.024115,
-	0,1,0,0.032846,0,0.025595,
-	0,1,0,0.039222,0,0.025488,
-	0,1,0,0.034322,0,0.058994,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.021172,0,0.02702,
-	0,1,0,0.026929,0,0.024129,
-	0,1,0,0.034322,0,0.058994,
-	0,1,0,0.037972,0,0.057261,
-	0,1,0,0.042779,0,0.077034,
-	0,1,0,0.061377,0,0.061235,
-	0,1,0,0.040701,0,0.072796,
-	0,1,0,0.061377,0,0.061235,
-	0,1,0,0.042779,0,0.077034,
-	0,1,0,0.063459,0,0.06709,
-	0,1,0,0.070295,0,0.075306,
-	0,1,0,0.063459,0,0.06709,
-	0,1,0,0.063459,0,0.075306,
-	0,1,0,0.053526,0,0.041817,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.048308,0,0.034479,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.053526,0,0.041817,
-	0,1,0,0.058269,0,0.056058,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.058269,0,0.056058,
-	0,1,0,0.061377,0,0.061235,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.061377,0,0.061235,
-	0,1,0,0.087644,0,0.050772,
-	0,1,0,0.087644,0,0.050772,
-	0,1,0,0.061377,0,0.061235,
-	0,1,0,0.063459,0,0.06709,
-	0,1,0,0.087644,0,0.050772,
-	0,1,0,0.063459,0,0.06709,
-	0,1,0,0.076667,0,0.063045,
-	0,1,0,0.076667,0,0.063045,
-	0,1,0,0.063459,0,0.06709,
-	0,1,0,0.070295,0,0.075306,
-	0,1,0,0.070295,0,0.075306,
-	0,1,0,0.076728,0,0.082213,
-	0,1,0,0.076667,0,0.063045,
-	0,1,0,0.076728,0,0.082213,
-	0,1,0,0.070295,0,0.075306,
-	0,1,0,0.079137,0,0.246431,
-	0,1,0,0.076728,0,0.082213,
-	0,1,0,0.079137,0,0.246431,
-	0,1,0,0.080977,0,0.237572,
-	0,1,0,0.076728,0,0.082213,
-	0,1,0,0.080616,0,0.066126,
-	0,1,0,0.076667,0,0.063045,
-	0,1,0,0.080616,0,0.066126,
-	0,1,0,0.076728,0,0.082213,
-	0,1,0,0.082403,0,0.082213,
-	0,1,0,0.125094,0,0.067408,
-	0,1,0,0.111465,0,0.057453,
-	0,1,0,0.113351,0,0.069023,
-	0,1,0,0.003246,0,-0.031262,
-	0,1,0,0.001715,0,-0.045957,
-	0,1,0,0.001618,0,-0.038157,
-	0,1,0,0.001715,0,-0.045957,
-	0,1,0,0.003246,0,-0.031262,
-	0,1,0,0.00775,0,-0.031028,
-	0,1,0,0.001715,0,-0.045957,
-	0,1,0,0.00775,0,-0.031028,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.00775,0,-0.031028,
-	0,1,0,0.008266,0,-0.029831,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.008266,0,-0.029831,
-	0,1,0,0.052158,0,0.02414,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.052158,0,0.02414,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.095908,0,0.047446,
-	0,1,0,0.111465,0,0.057453,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.111465,0,0.057453,
-	0,1,0,0.125094,0,0.067408,
-	0,1,0,0.171507,0,0.07103,
-	0,1,0,0.181433,0,0.064832,
-	0,1,0,0.166125,0,0.064832,
-	0,1,0,0.181433,0,0.064832,
-	0,1,0,0.171507,0,0.07103,
-	0,1,0,0.178121,0,0.07103,
-	0,1,0,0.207789,0,0.072818,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.194012,0,0.069031,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.207789,0,0.072818,
-	0,1,0,0.214555,0,0.072818,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.214555,0,0.072818,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.181484,0,0.064832,
-	0,1,0,0.181484,0,0.064736,
-	0,1,0,0.181433,0,0.064832,
-	0,1,0,0.181484,0,0.064736,
-	0,1,0,0.181484,0,0.064832,
-	0,1,0,0.181506,0,0.064743,
-	0,1,0,0.191757,0,0.068026,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.181506,0,0.064743,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.191757,0,0.068026,
-	0,1,0,0.194012,0,0.069031,
-	0,1,0,0.207789,0,0.072818,
-	0,1,0,0.194012,0,0.069031,
-	0,1,0,0.207789,0,0.086154,
-	0,1,0,0.224037,0,0.154308,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.214555,0,0.072818,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.224037,0,0.154308,
-	0,1,0,0.225964,0,0.161564,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.225964,0,0.161564,
-	0,1,0,0.234166,0,0.160331,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.234166,0,0.160331,
-	0,1,0,0.261724,0,0.159312,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.261557,0,0.072881,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.261557,0,0.072881,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.256317,0,0.072881,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.261557,0,0.072881,
-	0,1,0,0.277221,0,0.075279,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.277221,0,0.075279,
-	0,1,0,0.317776,0,0.082282,
-	0,1,0,0.269452,0,0.084624,
-	0,1,0,0.261557,0,0.072881,
-	0,1,0,0.261557,0,0.084624,
-	0,1,0,0.261557,0,0.072881,
-	0,1,0,0.269452,0,0.084624,
-	0,1,0,0.277221,0,0.075279,
-	0,1,0,0.289785,0,0.088598,
-	0,1,0,0.287961,0,0.07869,
-	0,1,0,0.281601,0,0.088598,
-	0,1,0,0.277221,0,0.075279,
-	0,1,0,0.287961,0,0.07869,
-	0,1,0,0.317776,0,0.082282,
-	0,1,0,0.287961,0,0.07869,
-	0,1,0,0.277221,0,0.075279,
-	0,1,0,0.281601,0,0.088598,
-	0,1,0,0.317776,0,0.082282,
-	0,1,0,0.287961,0,0.07869,
-	0,1,0,0.299525,0,0.081697,
-	0,1,0,0.317776,0,0.082282,
-	0,1,0,0.299525,0,0.081697,
-	0,1,0,0.310606,0,0.087359,
-	0,1,0,0.333544,0,0.184582,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.317776,0,0.082282,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.333544,0,0.184582,
-	0,1,0,0.37772,0,0.181407,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.37772,0,0.181407,
-	0,1,0,0.370959,0,0.119141,
-	0,1,0,0.370959,0,0.119141,
-	0,1,0,0.372074,0,0.108315,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.372074,0,0.108315,
-	0,1,0,0.370959,0,0.119141,
-	0,1,0,0.372137,0,0.112193,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.376455,0,-0.041627,
-	0,1,0,0.207789,0,-0.043575,
-	0,1,0,0.376455,0,-0.041627,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.376455,0,-0.041627,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.454473,0,0.095982,
-	0,1,0,0.394231,0,0.112852,
-	0,1,0,0.38823,0,0.091739,
-	0,1,0,0.38823,0,0.106849,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.403191,0,0.089718,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.403191,0,0.089718,
-	0,1,0,0.366697,0,0.082669,
-	0,1,0,0.38823,0,0.091739,
-	0,1,0,0.403191,0,0.089718,
-	0,1,0,0.38823,0,0.091739,
-	0,1,0,0.397302,0,0.093667,
-	0,1,0,0.397302,0,0.093667,
-	0,1,0,0.38823,0,0.091739,
-	0,1,0,0.394231,0,0.112852,
-	0,1,0,0.397302,0,0.093667,
-	0,1,0,0.394231,0,0.112852,
-	0,1,0,0.396581,0,0.105608,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.446113,0,0.095183,
-	0,1,0,0.454473,0,0.095982,
-	0,1,0,0.446113,0,0.095183,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.436002,0,0.094225,
-	0,1,0,0.436002,0,0.094225,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.431829,0,0.094236,
-	0,1,0,0.431829,0,0.094236,
-	0,1,0,0.420461,0,0.087749,
-	0,1,0,0.422378,0,0.108735,
-	0,1,0,0.431829,0,0.094236,
-	0,1,0,0.422378,0,0.108735,
-	0,1,0,0.428035,0,0.110773,
-	0,1,0,0.431829,0,0.094236,
-	0,1,0,0.428035,0,0.110773,
-	0,1,0,0.430142,0,0.106462,
-	0,1,0,0.446113,0,0.095183,
-	0,1,0,0.436002,0,0.094225,
-	0,1,0,0.43972,0,0.097141,
-	0,1,0,0.446113,0,0.095183,
-	0,1,0,0.43972,0,0.097141,
-	0,1,0,0.442315,0,0.106176,
-	0,1,0,0.446113,0,0.095183,
-	0,1,0,0.442315,0,0.106176,
-	0,1,0,0.446113,0,0.10759,
-	0,1,0,0.463906,0,0.207466,
-	0,1,0,0.497607,0,0.091808,
-	0,1,0,0.454473,0,0.095982,
-	0,1,0,0.497607,0,0.091808,
-	0,1,0,0.463906,0,0.207466,
-	0,1,0,0.497655,0,0.099429,
-	0,1,0,0.497655,0,0.099429,
-	0,1,0,0.463906,0,0.207466,
-	0,1,0,0.509623,0,0.205684,
-	0,1,0,0.50481,0,0.10516,
-	0,1,0,0.511486,0,0.090215,
-	0,1,0,0.501456,0,0.091808,
-	0,1,0,0.511486,0,0.090215,
-	0,1,0,0.50481,0,0.10516,
-	0,1,0,0.509337,0,0.103405,
-	0,1,0,0.52893,0,0.10095,
-	0,1,0,0.553107,0,0.091478,
-	0,1,0,0.511486,0,0.090215,
-	0,1,0,0.553107,0,0.091478,
-	0,1,0,0.52893,0,0.10095,
-	0,1,0,0.54413,0,0.10095,
-	0,1,0,0.644949,0,0.236471,
-	0,1,0,0.572047,0,0.105355,
-	0,1,0,0.569738,0,0.111048,
-	0,1,0,0.572047,0,0.105355,
-	0,1,0,0.644949,0,0.236471,
-	0,1,0,0.644873,0,0.222943,
-	0,1,0,0.644873,0,0.222943,
-	0,1,0,0.644949,0,0.236471,
-	0,1,0,0.64714,0,0.231454,
-	0,1,0,0.550144,0,0.127813,
-	0,1,0,0.547445,0,0.124606,
-	0,1,0,0.545142,0,0.125558,
-	0,1,0,0.547445,0,0.124606,
-	0,1,0,0.550144,0,0.127813,
-	0,1,0,0.552892,0,0.116183,
-	0,1,0,0.552892,0,0.116183,
-	0,1,0,0.550144,0,0.127813,
-	0,1,0,0.566351,0,0.123158,
-	0,1,0,0.552892,0,0.116183,
-	0,1,0,0.566351,0,0.123158,
-	0,1,0,0.552912,0,0.114184,
-	0,1,0,0.552912,0,0.114184,
-	0,1,0,0.566351,0,0.123158,
-	0,1,0,0.556858,0,0.098286,
-	0,1,0,0.556422,0,0.095834,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.553107,0,0.091478,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.556422,0,0.095834,
-	0,1,0,0.556858,0,0.098286,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.556858,0,0.098286,
-	0,1,0,0.572047,0,0.105355,
-	0,1,0,0.572047,0,0.105355,
-	0,1,0,0.556858,0,0.098286,
-	0,1,0,0.569738,0,0.111048,
-	0,1,0,0.569738,0,0.111048,
-	0,1,0,0.556858,0,0.098286,
-	0,1,0,0.566351,0,0.123158,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.572047,0,0.105355,
-	0,1,0,0.579834,0,0.105355,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.579834,0,0.105355,
-	0,1,0,0.579933,0,0.109136,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.579933,0,0.109136,
-	0,1,0,0.582443,0,0.111613,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.582443,0,0.111613,
-	0,1,0,0.591814,0,0.112965,
-	0,1,0,0.634432,0,0.166831,
-	0,1,0,0.620851,0,0.091797,
-	0,1,0,0.614411,0,0.098278,
-	0,1,0,0.620851,0,0.091797,
-	0,1,0,0.634432,0,0.166831,
-	0,1,0,0.641824,0,0.166831,
-	0,1,0,0.636952,0,0.101194,
-	0,1,0,0.631438,0,0.091797,
-	0,1,0,0.629595,0,0.098001,
-	0,1,0,0.631438,0,0.091797,
-	0,1,0,0.636952,0,0.101194,
-	0,1,0,0.643871,0,0.087598,
-	0,1,0,0.667128,0,0.360389,
-	0,1,0,0.663409,0,0.259363,
-	0,1,0,0.660866,0,0.358077,
-	0,1,0,0.660866,0,0.358077,
-	0,1,0,0.652329,0,0.09576,
-	0,1,0,0.643871,0,0.087598,
-	0,1,0,0.652329,0,0.09576,
-	0,1,0,0.660866,0,0.358077,
-	0,1,0,0.663409,0,0.249927,
-	0,1,0,0.663409,0,0.249927,
-	0,1,0,0.660866,0,0.358077,
-	0,1,0,0.663409,0,0.259363,
-	0,1,0,0.652329,0,0.09576,
-	0,1,0,0.657966,0,0.089941,
-	0,1,0,0.643871,0,0.087598,
-	0,1,0,0.657966,0,0.089941,
-	0,1,0,0.652329,0,0.09576,
-	0,1,0,0.657966,0,0.095447,
-	0,1,0,0.669946,0,0.10117,
-	0,1,0,0.663424,0,0.094392,
-	0,1,0,0.663409,0,0.099025,
-	0,1,0,0.663424,0,0.094392,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.662071,0,0.090935,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.663424,0,0.094392,
-	0,1,0,0.669946,0,0.092138,
-	0,1,0,0.669946,0,0.092138,
-	0,1,0,0.663424,0,0.094392,
-	0,1,0,0.669946,0,0.10117,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.669946,0,0.092138,
-	0,1,0,0.682405,0,0.093684,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.682405,0,0.093684,
-	0,1,0,0.687829,0,0.097372,
-	0,1,0,0.759943,0,0.121689,
-	0,1,0,0.761196,0,0.112841,
-	0,1,0,0.757564,0,0.116773,
-	0,1,0,0.761196,0,0.112841,
-	0,1,0,0.759943,0,0.121689,
-	0,1,0,0.763846,0,0.119808,
-	0,1,0,0.739593,0,0.106753,
-	0,1,0,0.730899,0,0.094722,
-	0,1,0,0.727889,0,0.103317,
-	0,1,0,0.730899,0,0.094722,
-	0,1,0,0.739593,0,0.106753,
-	0,1,0,0.739289,0,0.082921,
-	0,1,0,0.739289,0,0.082921,
-	0,1,0,0.739593,0,0.106753,
-	0,1,0,0.741908,0,0.084462,
-	0,1,0,0.741908,0,0.084462,
-	0,1,0,0.739593,0,0.106753,
-	0,1,0,0.742166,0,0.093571,
-	0,1,0,0.741908,0,0.084462,
-	0,1,0,0.742166,0,0.093571,
-	0,1,0,0.783334,0,0.120508,
-	0,1,0,0.783334,0,0.120508,
-	0,1,0,0.742166,0,0.093571,
-	0,1,0,0.761196,0,0.112841,
-	0,1,0,0.783334,0,0.120508,
-	0,1,0,0.761196,0,0.112841,
-	0,1,0,0.767964,0,0.117251,
-	0,1,0,0.767964,0,0.117251,
-	0,1,0,0.761196,0,0.112841,
-	0,1,0,0.763846,0,0.119808,
-	0,1,0,0.783334,0,0.120508,
-	0,1,0,0.767964,0,0.117251,
-	0,1,0,0.777789,0,0.128777,
-	0,1,0,0.721492,0,0.088515,
-	0,1,0,0.741942,0,0.07987,
-	0,1,0,0.72121,0,0.082325,
-	0,1,0,0.741942,0,0.07987,
-	0,1,0,0.721492,0,0.088515,
-	0,1,0,0.739289,0,0.082921,
-	0,1,0,0.739289,0,0.082921,
-	0,1,0,0.721492,0,0.088515,
-	0,1,0,0.730899,0,0.094722,
-	0,1,0,0.745551,0,0.080024,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.741942,0,0.07987,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.745551,0,0.080024,
-	0,1,0,0.747943,0,0.080733,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.747943,0,0.080733,
-	0,1,0,0.764433,0,0.083265,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.764433,0,0.083265,
-	0,1,0,0.772205,0,0.083449,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.892328,0,0.094571,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.93599,0,-0.034208,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.93599,0,-0.034208,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.916393,0,0.003488,
-	0,1,0,0.916393,0,0.003488,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.93599,0,-0.034208,
-	0,1,0,0.916393,0,0.003488,
-	0,1,0,0.936516,0,-0.027225,
-	0,1,0,0.777327,0,0.11054,
-	0,1,0,0.793083,0,0.086486,
-	0,1,0,0.774096,0,0.103935,
-	0,1,0,0.793083,0,0.086486,
-	0,1,0,0.777327,0,0.11054,
-	0,1,0,0.781652,0,0.108678,
-	0,1,0,0.793083,0,0.086486,
-	0,1,0,0.781652,0,0.108678,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.793083,0,0.086486,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.794464,0,0.083624,
-	0,1,0,0.8128,0,0.105465,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.800691,0,0.103287,
-	0,1,0,0.794464,0,0.083624,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.787201,0,0.083237,
-	0,1,0,0.787201,0,0.073019,
-	0,1,0,0.794464,0,0.083624,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.794464,0,0.083624,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.817616,0,0.086439,
-	0,1,0,0.817616,0,0.086439,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.815769,0,0.089603,
-	0,1,0,0.815769,0,0.089603,
-	0,1,0,0.805114,0,0.089496,
-	0,1,0,0.8128,0,0.105465,
-	0,1,0,0.846707,0,0.099473,
-	0,1,0,0.841234,0,0.094315,
-	0,1,0,0.841234,0,0.099473,
-	0,1,0,0.8516,0,0.100934,
-	0,1,0,0.852472,0,0.096213,
-	0,1,0,0.850639,0,0.099893,
-	0,1,0,0.852472,0,0.096213,
-	0,1,0,0.8516,0,0.100934,
-	0,1,0,0.857423,0,0.100975,
-	0,1,0,0.892328,0,0.101988,
-	0,1,0,0.862558,0,0.094381,
-	0,1,0,0.861866,0,0.107563,
-	0,1,0,0.825162,0,0.09278,
-	0,1,0,0.831943,0,0.090034,
-	0,1,0,0.82127,0,0.090034,
-	0,1,0,0.831943,0,0.090034,
-	0,1,0,0.825162,0,0.09278,
-	0,1,0,0.841234,0,0.094315,
-	0,1,0,0.831943,0,0.090034,
-	0,1,0,0.841234,0,0.094315,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.841234,0,0.094315,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.832532,0,0.080587,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.892328,0,0.094571,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.841234,0,0.094315,
-	0,1,0,0.846707,0,0.099473,
-	0,1,0,0.892328,0,0.094571,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.862558,0,0.094381,
-	0,1,0,0.862558,0,0.094381,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.857423,0,0.094381,
-	0,1,0,0.857423,0,0.094381,
-	0,1,0,0.846707,0,0.093071,
-	0,1,0,0.852472,0,0.096213,
-	0,1,0,0.857423,0,0.094381,
-	0,1,0,0.852472,0,0.096213,
-	0,1,0,0.857423,0,0.100975,
-	0,1,0,0.892328,0,0.094571,
-	0,1,0,0.862558,0,0.094381,
-	0,1,0,0.892328,0,0.101988,
-	0,1,0,0.899199,0,0.094571,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.892328,0,0.094571,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.899199,0,0.094571,
-	0,1,0,0.899404,0,0.097981,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.899404,0,0.097981,
-	0,1,0,0.909473,0,0.097981,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.909473,0,0.097981,
-	0,1,0,0.916301,0,0.092997,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.916301,0,0.092997,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.916301,0,0.092997,
-	0,1,0,0.918851,0,0.098476,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.918851,0,0.098476,
-	0,1,0,0.925888,0,0.095161,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.925888,0,0.095161,
-	0,1,0,0.926485,0,0.100656,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.926485,0,0.100656,
-	0,1,0,0.92745,0,0.10042,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.92745,0,0.10042,
-	0,1,0,0.929789,0,0.096688,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.929789,0,0.096688,
-	0,1,0,0.935651,0,0.092805,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.915137,0,0.028034,
-	0,1,0,0.909874,0,0.024996,
-	0,1,0,0.915137,0,0.028034,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.935651,0,0.083822,
-	0,1,0,0.946131,0,0.086203,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.946131,0,0.086203,
-	0,1,0,0.947032,0,0.091237,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.947032,0,0.091237,
-	0,1,0,0.952058,0,0.086382,
-	0,1,0,0.952058,0,0.086382,
-	0,1,0,0.947032,0,0.091237,
-	0,1,0,0.951521,0,0.095301,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.952058,0,0.086382,
-	0,1,0,0.959508,0,0.086382,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.959508,0,0.086382,
-	0,1,0,0.96675,0,0.087777,
-	0,1,0,0.966042,0,0.048493,
-	0,1,0,0.96675,0,0.087777,
-	0,1,0,0.967897,0,0.050346,
-	0,1,0,0.967897,0,0.050346,
-	0,1,0,0.96675,0,0.087777,
-	0,1,0,0.98216,0,0.092901,
-	0,1,0,0.967897,0,0.050346,
-	0,1,0,0.98216,0,0.092901,
-	0,1,0,0.976559,0,0.061589,
-	0,1,0,0.976559,0,0.061589,
-	0,1,0,0.98216,0,0.092901,
-	0,1,0,0.989246,0,0.074312,
-	0,1,0,0.98144,0,0.13698,
-	0,1,0,0.96675,0,0.087777,
-	0,1,0,0.959508,0,0.086382,
-	0,1,0,0.96675,0,0.087777,
-	0,1,0,0.98144,0,0.13698,
-	0,1,0,0.985565,0,0.138938,
-	0,1,0,0.985565,0,0.138938,
-	0,1,0,0.98144,0,0.13698,
-	0,1,0,0.984862,0,0.140108,
-	0,1,0,0.985565,0,0.138938,
-	0,1,0,0.984862,0,0.140108,
-	0,1,0,0.985414,0,0.139537,
-	0,1,0,0.60316,0,0.098248,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.60316,0,0.098248,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.60316,0,0.098248,
-	0,1,0,0.620851,0,0.091797,
-	0,1,0,0.620851,0,0.091797,
-	0,1,0,0.60316,0,0.098248,
-	0,1,0,0.614411,0,0.098278,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.620851,0,0.091797,
-	0,1,0,0.631438,0,0.091797,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.631438,0,0.091797,
-	0,1,0,0.643871,0,0.087598,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.643871,0,0.087598,
-	0,1,0,0.657966,0,0.089941,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.657966,0,0.089941,
-	0,1,0,0.662071,0,0.090935,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.662071,0,0.090935,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.698505,0,0.081469,
-	0,1,0,0.704247,0,0.079546,
-	0,1,0,0.454473,0,0.095982,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.376455,0,-0.041627,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.454473,0,0.095982,
-	0,1,0,0.497607,0,0.091808,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.497607,0,0.091808,
-	0,1,0,0.501456,0,0.091808,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.501456,0,0.091808,
-	0,1,0,0.511486,0,0.090215,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.511486,0,0.090215,
-	0,1,0,0.553107,0,0.091478,
-	0,1,0,0.591814,0,-0.039138,
-	0,1,0,0.553107,0,0.091478,
-	0,1,0,0.591814,0,0.095491,
-	0,1,0,0.72121,0,0.082325,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.704247,0,0.079546,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.72121,0,0.082325,
-	0,1,0,0.741942,0,0.07987,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.741942,0,0.07987,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.755534,0,-0.037246,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.935029,0,-0.035172,
-	0,1,0,0.935029,0,-0.035172,
-	0,1,0,0.775495,0,0.071129,
-	0,1,0,0.93599,0,-0.034208,
-	0,1,0,0.693133,0,0.290579,
-	0,1,0,0.663409,0,0.249927,
-	0,1,0,0.663409,0,0.259363,
-	0,1,0,0.663409,0,0.249927,
-	0,1,0,0.693133,0,0.290579,
-	0,1,0,0.69697,0,0.283488
-};
-static const struct gllist ships_ship5_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 702, ships_ship5_data, 0
-};
-const struct gllist *ships_ship5 = &ships_ship5_frame;
-
-static const float ships_ship6_data[] = {
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.00761,0,0.035711,
-	0,1,0,0.005168,0,0.049856,
-	0,1,0,0.00761,0,0.035711,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.012035,0,-0.003074,
-	0,1,0,0.012035,0,-0.003074,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.012056,0,-0.009788,
-	0,1,0,0.012056,0,-0.009788,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.020554,0,-0.019586,
-	0,1,0,0.020554,0,-0.019586,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.069502,0,-0.027048,
-	0,1,0,0.069502,0,-0.027048,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.100116,0,-0.032121,
-	0,1,0,0.100116,0,-0.032121,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.317531,0,0.099131,
-	0,1,0,0.301761,0,-0.052847,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.301761,0,-0.052847,
-	0,1,0,0.317531,0,0.099131,
-	0,1,0,0.327571,0,0.095154,
-	0,1,0,0.301761,0,-0.052847,
-	0,1,0,0.327571,0,0.095154,
-	0,1,0,0.337878,0,0.093814,
-	0,1,0,0.114815,0,0.086584,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.113471,0,0.075648,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.114815,0,0.086584,
-	0,1,0,0.149053,0,0.088333,
-	0,1,0,0.044223,0,0.078999,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.037078,0,0.07165,
-	0,1,0,0.037189,0,0.049856,
-	0,1,0,0.044223,0,0.078999,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.044223,0,0.078999,
-	0,1,0,0.055073,0,0.07854,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.055073,0,0.07854,
-	0,1,0,0.113471,0,0.075648,
-	0,1,0,0.149053,0,0.088333,
-	0,1,0,0.179741,0,-0.042731,
-	0,1,0,0.119522,0,-0.037428,
-	0,1,0,0.179741,0,-0.042731,
-	0,1,0,0.149053,0,0.088333,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.179741,0,-0.042731,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.301761,0,-0.052847,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.149053,0,0.088333,
-	0,1,0,0.149053,0,0.125958,
-	0,1,0,0.149053,0,0.088333,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.264064,0,0.128088,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.264064,0,0.128088,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.257925,0,0.133426,
-	0,1,0,0.307142,0,0.1844,
-	0,1,0,0.265691,0,0.157236,
-	0,1,0,0.262648,0,0.186124,
-	0,1,0,0.265691,0,0.157236,
-	0,1,0,0.307142,0,0.1844,
-	0,1,0,0.304541,0,0.176581,
-	0,1,0,0.265691,0,0.157236,
-	0,1,0,0.304541,0,0.176581,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.301761,0,0.101015,
-	0,1,0,0.264064,0,0.128088,
-	0,1,0,0.265691,0,0.157236,
-	0,1,0,0.257941,0,0.155385,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.170246,0,0.156415,
-	0,1,0,0.172143,0,0.125958,
-	0,1,0,0.257941,0,0.155385,
-	0,1,0,0.257925,0,0.133426,
-	0,1,0,0.337878,0,0.093814,
-	0,1,0,0.314473,0,-0.053901,
-	0,1,0,0.301761,0,-0.052847,
-	0,1,0,0.314473,0,-0.053901,
-	0,1,0,0.337878,0,0.093814,
-	0,1,0,0.439288,0,-0.062858,
-	0,1,0,0.439288,0,-0.062858,
-	0,1,0,0.337878,0,0.093814,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.684966,0,0.102797,
-	0,1,0,0.692751,0,0.029614,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.692751,0,0.029614,
-	0,1,0,0.684966,0,0.102797,
-	0,1,0,0.692758,0,0.037014,
-	0,1,0,0.692758,0,0.037014,
-	0,1,0,0.684966,0,0.102797,
-	0,1,0,0.693759,0,0.091606,
-	0,1,0,0.410007,0,0.09773,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.337878,0,0.093814,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.410007,0,0.09773,
-	0,1,0,0.46531,0,0.0988,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.46531,0,0.0988,
-	0,1,0,0.554952,0,0.103058,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.554952,0,0.103058,
-	0,1,0,0.642868,0,0.109787,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.642868,0,0.109787,
-	0,1,0,0.684966,0,0.102797,
-	0,1,0,0.684966,0,0.102797,
-	0,1,0,0.642868,0,0.109787,
-	0,1,0,0.662723,0,0.107084,
-	0,1,0,0.692751,0,0.029614,
-	0,1,0,0.698436,0,-0.076424,
-	0,1,0,0.596878,0,-0.07232,
-	0,1,0,0.698436,0,-0.076424,
-	0,1,0,0.692751,0,0.029614,
-	0,1,0,0.834403,0,-0.08059,
-	0,1,0,0.904352,0,0.036065,
-	0,1,0,0.925985,0,-0.018014,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.925985,0,-0.018014,
-	0,1,0,0.904352,0,0.036065,
-	0,1,0,0.980572,0,0.03958,
-	0,1,0,0.925985,0,-0.018014,
-	0,1,0,0.980572,0,0.03958,
-	0,1,0,0.976029,0,0.029161,
-	0,1,0,0.757179,0,0.029859,
-	0,1,0,0.834403,0,-0.08059,
-	0,1,0,0.692751,0,0.029614,
-	0,1,0,0.834403,0,-0.08059,
-	0,1,0,0.757179,0,0.029859,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.868277,0,-0.047334,
-	0,1,0,0.834403,0,-0.08059,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.834403,0,-0.08059,
-	0,1,0,0.868277,0,-0.047334,
-	0,1,0,0.851539,0,-0.083355,
-	0,1,0,0.851539,0,-0.083355,
-	0,1,0,0.868277,0,-0.047334,
-	0,1,0,0.891466,0,-0.085733,
-	0,1,0,0.925985,0,-0.018014,
-	0,1,0,0.868277,0,-0.047334,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.868277,0,-0.047334,
-	0,1,0,0.925985,0,-0.018014,
-	0,1,0,0.879096,0,-0.042237,
-	0,1,0,0.763854,0,0.035269,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.757179,0,0.029859,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.763854,0,0.035269,
-	0,1,0,0.773021,0,0.039488,
-	0,1,0,0.801927,0,0.033143,
-	0,1,0,0.773021,0,0.039488,
-	0,1,0,0.796625,0,0.034321,
-	0,1,0,0.796625,0,0.034321,
-	0,1,0,0.773021,0,0.039488,
-	0,1,0,0.786431,0,0.038696
-};
-static const struct gllist ships_ship6_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 171, ships_ship6_data, 0
-};
-const struct gllist *ships_ship6 = &ships_ship6_frame;
-
-static const float ships_ship7_data[] = {
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.014324,0,-0.091298,
-	0,1,0,0.008486,0,0.067418,
-	0,1,0,0.622021,0,0.158469,
-	0,1,0,0.618682,0,0.141172,
-	0,1,0,0.616974,0,0.153637,
-	0,1,0,0.668086,0,0.19311,
-	0,1,0,0.622021,0,0.185792,
-	0,1,0,0.618171,0,0.193377,
-	0,1,0,0.622021,0,0.185792,
-	0,1,0,0.668086,0,0.19311,
-	0,1,0,0.622021,0,0.158469,
-	0,1,0,0.622021,0,0.158469,
-	0,1,0,0.668086,0,0.19311,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.668086,0,0.19311,
-	0,1,0,0.668588,0,0.191766,
-	0,1,0,0.609389,0,0.079131,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.597457,0,0.051725,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.609389,0,0.079131,
-	0,1,0,0.618682,0,0.141172,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.618682,0,0.141172,
-	0,1,0,0.622021,0,0.158469,
-	0,1,0,0.120954,0,0.083755,
-	0,1,0,0.13173,0,0.077601,
-	0,1,0,0.116971,0,0.077939,
-	0,1,0,0.13173,0,0.077601,
-	0,1,0,0.120954,0,0.083755,
-	0,1,0,0.132081,0,0.085502,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.327336,0,-0.097558,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.327336,0,-0.097558,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.315366,0,0.092546,
-	0,1,0,0.327336,0,-0.097558,
-	0,1,0,0.315366,0,0.092546,
-	0,1,0,0.317931,0,0.120779,
-	0,1,0,0.327336,0,-0.097558,
-	0,1,0,0.317931,0,0.120779,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.327336,0,-0.097558,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.34539,0,0.136116,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.34539,0,0.136116,
-	0,1,0,0.348844,0,0.131725,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.348844,0,0.131725,
-	0,1,0,0.355564,0,0.134282,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.355564,0,0.134282,
-	0,1,0,0.362675,0,0.139519,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.362675,0,0.139519,
-	0,1,0,0.367321,0,0.138882,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.367321,0,0.138882,
-	0,1,0,0.37021,0,0.158014,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.37021,0,0.158014,
-	0,1,0,0.377344,0,0.138085,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.377344,0,0.138085,
-	0,1,0,0.428914,0,0.138503,
-	0,1,0,0.428914,0,0.138503,
-	0,1,0,0.377344,0,0.138085,
-	0,1,0,0.418305,0,0.141517,
-	0,1,0,0.009607,0,0.075536,
-	0,1,0,0.000711,0,0.067906,
-	0,1,0,0,0,0.069294,
-	0,1,0,0.000711,0,0.067906,
-	0,1,0,0.009607,0,0.075536,
-	0,1,0,0.008486,0,0.067418,
-	0,1,0,0.008486,0,0.067418,
-	0,1,0,0.009607,0,0.075536,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.009607,0,0.075536,
-	0,1,0,0.041213,0,0.073473,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.041213,0,0.073473,
-	0,1,0,0.086238,0,0.074943,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.086238,0,0.074943,
-	0,1,0,0.096676,0,0.077939,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.096676,0,0.077939,
-	0,1,0,0.116971,0,0.077939,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.116971,0,0.077939,
-	0,1,0,0.13173,0,0.077601,
-	0,1,0,0.17083,0,-0.094428,
-	0,1,0,0.13173,0,0.077601,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.287798,0,0.099437,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.281269,0,0.098363,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.287798,0,0.099437,
-	0,1,0,0.290717,0,0.092546,
-	0,1,0,0.284714,0,0.077601,
-	0,1,0,0.290717,0,0.092546,
-	0,1,0,0.315366,0,0.092546,
-	0,1,0,0.245353,0,0.230555,
-	0,1,0,0.311617,0,0.103912,
-	0,1,0,0.245351,0,0.225658,
-	0,1,0,0.311617,0,0.103912,
-	0,1,0,0.245353,0,0.230555,
-	0,1,0,0.315583,0,0.110485,
-	0,1,0,0.311617,0,0.103912,
-	0,1,0,0.315583,0,0.110485,
-	0,1,0,0.315366,0,0.092546,
-	0,1,0,0.315366,0,0.092546,
-	0,1,0,0.315583,0,0.110485,
-	0,1,0,0.317931,0,0.120779,
-	0,1,0,0.317931,0,0.120779,
-	0,1,0,0.315583,0,0.110485,
-	0,1,0,0.316521,0,0.120995,
-	0,1,0,0.332508,0,0.260412,
-	0,1,0,0.331132,0,0.250756,
-	0,1,0,0.327441,0,0.260681,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.317931,0,0.120779,
-	0,1,0,0.328331,0,0.211178,
-	0,1,0,0.340791,0,0.338854,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.329553,0,0.330834,
-	0,1,0,0.345635,0,0.395783,
-	0,1,0,0.314718,0,0.384075,
-	0,1,0,0.313951,0,0.386601,
-	0,1,0,0.314718,0,0.384075,
-	0,1,0,0.345635,0,0.395783,
-	0,1,0,0.345113,0,0.39162,
-	0,1,0,0.327947,0,0.216964,
-	0,1,0,0.267365,0,0.206311,
-	0,1,0,0.26709,0,0.20931,
-	0,1,0,0.267365,0,0.206311,
-	0,1,0,0.327947,0,0.216964,
-	0,1,0,0.328331,0,0.211178,
-	0,1,0,0.328331,0,0.211178,
-	0,1,0,0.327947,0,0.216964,
-	0,1,0,0.331132,0,0.250756,
-	0,1,0,0.328331,0,0.211178,
-	0,1,0,0.331132,0,0.250756,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.330962,0,0.131536,
-	0,1,0,0.331132,0,0.250756,
-	0,1,0,0.33706,0,0.213894,
-	0,1,0,0.33706,0,0.213894,
-	0,1,0,0.331132,0,0.250756,
-	0,1,0,0.332508,0,0.260412,
-	0,1,0,0.33706,0,0.213894,
-	0,1,0,0.332508,0,0.260412,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.33706,0,0.213894,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.337814,0,0.218526,
-	0,1,0,0.337814,0,0.218526,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.342221,0,0.274447,
-	0,1,0,0.342221,0,0.274447,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.341927,0,0.280776,
-	0,1,0,0.341927,0,0.280776,
-	0,1,0,0.338533,0,0.299547,
-	0,1,0,0.340791,0,0.338854,
-	0,1,0,0.342221,0,0.274447,
-	0,1,0,0.341927,0,0.280776,
-	0,1,0,0.39956,0,0.285924,
-	0,1,0,0.342221,0,0.274447,
-	0,1,0,0.39956,0,0.285924,
-	0,1,0,0.453565,0,0.289694,
-	0,1,0,0.453565,0,0.289694,
-	0,1,0,0.39956,0,0.285924,
-	0,1,0,0.407973,0,0.28984,
-	0,1,0,0.407973,0,0.28984,
-	0,1,0,0.39956,0,0.285924,
-	0,1,0,0.401022,0,0.293318,
-	0,1,0,0.407973,0,0.28984,
-	0,1,0,0.401022,0,0.293318,
-	0,1,0,0.407039,0,0.296757,
-	0,1,0,0.453565,0,0.289694,
-	0,1,0,0.407973,0,0.28984,
-	0,1,0,0.459932,0,0.294641,
-	0,1,0,0.453565,0,0.289694,
-	0,1,0,0.459932,0,0.294641,
-	0,1,0,0.460649,0,0.292436,
-	0,1,0,0.345113,0,0.39162,
-	0,1,0,0.341927,0,0.280776,
-	0,1,0,0.340791,0,0.338854,
-	0,1,0,0.341927,0,0.280776,
-	0,1,0,0.345113,0,0.39162,
-	0,1,0,0.346201,0,0.35631,
-	0,1,0,0.346201,0,0.35631,
-	0,1,0,0.345113,0,0.39162,
-	0,1,0,0.345635,0,0.395783,
-	0,1,0,0.346201,0,0.35631,
-	0,1,0,0.345635,0,0.395783,
-	0,1,0,0.347948,0,0.411892,
-	0,1,0,0.346201,0,0.35631,
-	0,1,0,0.347948,0,0.411892,
-	0,1,0,0.347402,0,0.391374,
-	0,1,0,0.347402,0,0.391374,
-	0,1,0,0.347948,0,0.411892,
-	0,1,0,0.350552,0,0.396948,
-	0,1,0,0.347402,0,0.391374,
-	0,1,0,0.350552,0,0.396948,
-	0,1,0,0.382114,0,0.401417,
-	0,1,0,0.382114,0,0.401417,
-	0,1,0,0.350552,0,0.396948,
-	0,1,0,0.381306,0,0.404196,
-	0,1,0,0.349356,0,0.370527,
-	0,1,0,0.346201,0,0.35631,
-	0,1,0,0.347402,0,0.391374,
-	0,1,0,0.385815,0,0.249062,
-	0,1,0,0.390794,0,0.225064,
-	0,1,0,0.380095,0,0.243782,
-	0,1,0,0.390794,0,0.225064,
-	0,1,0,0.385815,0,0.249062,
-	0,1,0,0.43745,0,0.149593,
-	0,1,0,0.390794,0,0.225064,
-	0,1,0,0.43745,0,0.149593,
-	0,1,0,0.393313,0,0.220564,
-	0,1,0,0.393313,0,0.220564,
-	0,1,0,0.43745,0,0.149593,
-	0,1,0,0.430713,0,0.148117,
-	0,1,0,0.337814,0,0.218526,
-	0,1,0,0.393313,0,0.220564,
-	0,1,0,0.33706,0,0.213894,
-	0,1,0,0.393313,0,0.220564,
-	0,1,0,0.337814,0,0.218526,
-	0,1,0,0.390794,0,0.225064,
-	0,1,0,0.36139,0,0.170056,
-	0,1,0,0.362675,0,0.139519,
-	0,1,0,0.355564,0,0.134282,
-	0,1,0,0.362675,0,0.139519,
-	0,1,0,0.36139,0,0.170056,
-	0,1,0,0.364485,0,0.169719,
-	0,1,0,0.46663,0,0.27632,
-	0,1,0,0.46013,0,0.257261,
-	0,1,0,0.458352,0,0.27632,
-	0,1,0,0.467463,0,0.329531,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.465354,0,0.329827,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.467463,0,0.329531,
-	0,1,0,0.473423,0,0.35107,
-	0,1,0,0.485465,0,0.322943,
-	0,1,0,0.477384,0,0.305137,
-	0,1,0,0.476383,0,0.327431,
-	0,1,0,0.477384,0,0.305137,
-	0,1,0,0.485465,0,0.322943,
-	0,1,0,0.528435,0,0.306428,
-	0,1,0,0.528435,0,0.306428,
-	0,1,0,0.485465,0,0.322943,
-	0,1,0,0.520583,0,0.315234,
-	0,1,0,0.475946,0,0.372381,
-	0,1,0,0.473423,0,0.35107,
-	0,1,0,0.468659,0,0.37335,
-	0,1,0,0.473423,0,0.35107,
-	0,1,0,0.475946,0,0.372381,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.475946,0,0.372381,
-	0,1,0,0.476383,0,0.327431,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.476383,0,0.327431,
-	0,1,0,0.477384,0,0.305137,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.477384,0,0.305137,
-	0,1,0,0.486025,0,0.280547,
-	0,1,0,0.486025,0,0.280547,
-	0,1,0,0.477384,0,0.305137,
-	0,1,0,0.483949,0,0.293936,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.46663,0,0.27632,
-	0,1,0,0.463702,0,0.296102,
-	0,1,0,0.46663,0,0.27632,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.475869,0,0.279193,
-	0,1,0,0.47107,0,0.29969,
-	0,1,0,0.473423,0,0.35107,
-	0,1,0,0.46013,0,0.257261,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.456111,0,0.138352,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.46013,0,0.257261,
-	0,1,0,0.46663,0,0.27632,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.442748,0,0.408702,
-	0,1,0,0.44226,0,0.411925,
-	0,1,0,0.442748,0,0.408702,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.475946,0,0.413137,
-	0,1,0,0.475946,0,0.413137,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.475946,0,0.372381,
-	0,1,0,0.475946,0,0.372381,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.476383,0,0.327431,
-	0,1,0,0.476383,0,0.327431,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.478415,0,0.336819,
-	0,1,0,0.478415,0,0.336819,
-	0,1,0,0.477848,0,0.418978,
-	0,1,0,0.480807,0,0.438935,
-	0,1,0,0.478415,0,0.336819,
-	0,1,0,0.480807,0,0.438935,
-	0,1,0,0.480645,0,0.413861,
-	0,1,0,0.480645,0,0.413861,
-	0,1,0,0.480807,0,0.438935,
-	0,1,0,0.482457,0,0.419142,
-	0,1,0,0.480645,0,0.413861,
-	0,1,0,0.482457,0,0.419142,
-	0,1,0,0.518255,0,0.421079,
-	0,1,0,0.482457,0,0.419142,
-	0,1,0,0.480807,0,0.438935,
-	0,1,0,0.482457,0,0.438748,
-	0,1,0,0.518255,0,0.421079,
-	0,1,0,0.482457,0,0.419142,
-	0,1,0,0.517782,0,0.423624,
-	0,1,0,0.478415,0,0.336819,
-	0,1,0,0.480966,0,0.371794,
-	0,1,0,0.488375,0,0.340838,
-	0,1,0,0.480966,0,0.371794,
-	0,1,0,0.478415,0,0.336819,
-	0,1,0,0.480645,0,0.413861,
-	0,1,0,0.488375,0,0.340838,
-	0,1,0,0.480966,0,0.371794,
-	0,1,0,0.487638,0,0.351236,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.478574,0,0.146831,
-	0,1,0,0.500967,0,0.138201,
-	0,1,0,0.478574,0,0.146831,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.474716,0,0.16388,
-	0,1,0,0.478574,0,0.146831,
-	0,1,0,0.474716,0,0.16388,
-	0,1,0,0.477013,0,0.163688,
-	0,1,0,0.500967,0,0.138201,
-	0,1,0,0.478574,0,0.146831,
-	0,1,0,0.486654,0,0.154293,
-	0,1,0,0.500967,0,0.138201,
-	0,1,0,0.486654,0,0.154293,
-	0,1,0,0.496634,0,0.150891,
-	0,1,0,0.524782,0,0.213734,
-	0,1,0,0.523887,0,0.186165,
-	0,1,0,0.519853,0,0.206749,
-	0,1,0,0.523887,0,0.186165,
-	0,1,0,0.520443,0,0.136372,
-	0,1,0,0.520309,0,0.15512,
-	0,1,0,0.520443,0,0.136372,
-	0,1,0,0.523887,0,0.186165,
-	0,1,0,0.572047,0,0.202588,
-	0,1,0,0.572047,0,0.202588,
-	0,1,0,0.523887,0,0.186165,
-	0,1,0,0.524782,0,0.213734,
-	0,1,0,0.572047,0,0.202588,
-	0,1,0,0.524782,0,0.213734,
-	0,1,0,0.574691,0,0.213144,
-	0,1,0,0.572047,0,0.202588,
-	0,1,0,0.574691,0,0.213144,
-	0,1,0,0.57819,0,0.2068,
-	0,1,0,0.520443,0,0.136372,
-	0,1,0,0.569256,0,0.178476,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.569256,0,0.178476,
-	0,1,0,0.520443,0,0.136372,
-	0,1,0,0.572047,0,0.202588,
-	0,1,0,0.5725,0,0.174129,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.569256,0,0.178476,
-	0,1,0,0.428914,0,0.138503,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.428914,0,0.138503,
-	0,1,0,0.456111,0,0.138352,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.456111,0,0.138352,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.468552,0,0.139316,
-	0,1,0,0.500967,0,0.138201,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.500967,0,0.138201,
-	0,1,0,0.520443,0,0.136372,
-	0,1,0,0.597457,0,0.051725,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.596177,0,0.051864,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.597457,0,0.051725,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.656931,0,0.083623,
-	0,1,0,0.666578,0,0.083623,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.666578,0,0.083623,
-	0,1,0,0.683404,0,0.087819,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.683404,0,0.087819,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.694309,0,-0.093781,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.798565,0,-0.08952,
-	0,1,0,0.798565,0,-0.08952,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.798565,0,-0.08952,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.790788,0,0.064708,
-	0,1,0,0.798565,0,-0.08952,
-	0,1,0,0.790788,0,0.064708,
-	0,1,0,0.811472,0,0.062538,
-	0,1,0,0.674737,0,0.116819,
-	0,1,0,0.669179,0,0.104053,
-	0,1,0,0.66632,0,0.109728,
-	0,1,0,0.669179,0,0.104053,
-	0,1,0,0.666578,0,0.083623,
-	0,1,0,0.663318,0,0.09943,
-	0,1,0,0.666578,0,0.083623,
-	0,1,0,0.669179,0,0.104053,
-	0,1,0,0.683404,0,0.087819,
-	0,1,0,0.683404,0,0.087819,
-	0,1,0,0.669179,0,0.104053,
-	0,1,0,0.674737,0,0.116819,
-	0,1,0,0.683404,0,0.087819,
-	0,1,0,0.674737,0,0.116819,
-	0,1,0,0.682157,0,0.113373,
-	0,1,0,0.740263,0,0.3376,
-	0,1,0,0.717651,0,0.327031,
-	0,1,0,0.698159,0,0.328757,
-	0,1,0,0.717651,0,0.327031,
-	0,1,0,0.740263,0,0.3376,
-	0,1,0,0.739514,0,0.330799,
-	0,1,0,0.746733,0,0.349037,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.740263,0,0.3376,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.746733,0,0.349037,
-	0,1,0,0.747104,0,0.331665,
-	0,1,0,0.747104,0,0.331665,
-	0,1,0,0.746733,0,0.349037,
-	0,1,0,0.747255,0,0.337924,
-	0,1,0,0.747104,0,0.331665,
-	0,1,0,0.747255,0,0.337924,
-	0,1,0,0.788766,0,0.335619,
-	0,1,0,0.788766,0,0.335619,
-	0,1,0,0.747255,0,0.337924,
-	0,1,0,0.786613,0,0.341369,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.717701,0,0.212449,
-	0,1,0,0.716987,0,0.217392,
-	0,1,0,0.717701,0,0.212449,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.727255,0,0.210387,
-	0,1,0,0.727255,0,0.210387,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.729666,0,0.180357,
-	0,1,0,0.729666,0,0.180357,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.733489,0,0.097134,
-	0,1,0,0.733489,0,0.097134,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.738759,0,0.212174,
-	0,1,0,0.738759,0,0.212174,
-	0,1,0,0.734225,0,0.221566,
-	0,1,0,0.739514,0,0.330799,
-	0,1,0,0.738759,0,0.212174,
-	0,1,0,0.739514,0,0.330799,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.738759,0,0.212174,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.750578,0,0.219996,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.739514,0,0.330799,
-	0,1,0,0.740263,0,0.3376,
-	0,1,0,0.750578,0,0.219996,
-	0,1,0,0.742502,0,0.228901,
-	0,1,0,0.748683,0,0.227909,
-	0,1,0,0.703808,0,0.097401,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.694034,0,0.097401,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.703808,0,0.097401,
-	0,1,0,0.719793,0,0.090445,
-	0,1,0,0.695292,0,0.090379,
-	0,1,0,0.719793,0,0.090445,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.719793,0,0.090445,
-	0,1,0,0.703808,0,0.097401,
-	0,1,0,0.707051,0,0.10343,
-	0,1,0,0.719793,0,0.090445,
-	0,1,0,0.707051,0,0.10343,
-	0,1,0,0.71883,0,0.101826,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.719793,0,0.090445,
-	0,1,0,0.725651,0,0.097121,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.725651,0,0.097121,
-	0,1,0,0.733489,0,0.097134,
-	0,1,0,0.733489,0,0.097134,
-	0,1,0,0.725651,0,0.097121,
-	0,1,0,0.729666,0,0.180357,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.733489,0,0.097134,
-	0,1,0,0.745404,0,0.097732,
-	0,1,0,0.770867,0,0.070277,
-	0,1,0,0.745404,0,0.097732,
-	0,1,0,0.770867,0,0.090136,
-	0,1,0,0.795116,0,0.092,
-	0,1,0,0.790788,0,0.064708,
-	0,1,0,0.780926,0,0.089234,
-	0,1,0,0.790788,0,0.064708,
-	0,1,0,0.795116,0,0.092,
-	0,1,0,0.811472,0,0.062538,
-	0,1,0,0.811472,0,0.062538,
-	0,1,0,0.839683,0,-0.0832,
-	0,1,0,0.798565,0,-0.08952,
-	0,1,0,0.839683,0,-0.0832,
-	0,1,0,0.811472,0,0.062538,
-	0,1,0,0.821874,0,0.066961,
-	0,1,0,0.839683,0,-0.0832,
-	0,1,0,0.821874,0,0.066961,
-	0,1,0,0.824648,0,0.054798,
-	0,1,0,0.839683,0,-0.0832,
-	0,1,0,0.824648,0,0.054798,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.839683,0,-0.0832,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.873228,0,-0.082377,
-	0,1,0,0.860183,0,0.056987,
-	0,1,0,0.873228,0,-0.082377,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.873228,0,-0.082377,
-	0,1,0,0.860183,0,0.056987,
-	0,1,0,0.866568,0,0.058768,
-	0,1,0,0.873228,0,-0.082377,
-	0,1,0,0.866568,0,0.058768,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.860315,0,0.058264,
-	0,1,0,0.860183,0,0.056987,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.844083,0,0.132103,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.841015,0,0.131717,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.844083,0,0.132103,
-	0,1,0,0.847015,0,0.061852,
-	0,1,0,0.841015,0,0.05224,
-	0,1,0,0.847015,0,0.061852,
-	0,1,0,0.860315,0,0.058264,
-	0,1,0,0.847015,0,0.061852,
-	0,1,0,0.844083,0,0.132103,
-	0,1,0,0.845568,0,0.125387,
-	0,1,0,0.936557,0,0.052887,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.921574,0,0.072794,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.936557,0,0.052887,
-	0,1,0,0.936557,0,0.027166,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.936557,0,0.027166,
-	0,1,0,0.940124,0,0.021527,
-	0,1,0,0.891583,0,0.060764,
-	0,1,0,0.866568,0,0.058768,
-	0,1,0,0.865717,0,0.063887,
-	0,1,0,0.866568,0,0.058768,
-	0,1,0,0.891583,0,0.060764,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.891583,0,0.060764,
-	0,1,0,0.904169,0,0.074437,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.904169,0,0.074437,
-	0,1,0,0.911647,0,0.068036,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.911647,0,0.068036,
-	0,1,0,0.914909,0,0.074511,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.914909,0,0.074511,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.914203,0,-0.088048,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.914909,0,0.074511,
-	0,1,0,0.921574,0,0.072794,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.921574,0,0.072794,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.988265,0,0.034438,
-	0,1,0,0.940124,0,0.021527,
-	0,1,0,0.936557,0,0.027166,
-	0,1,0,0.940124,0,0.021527,
-	0,1,0,0.988265,0,0.034438,
-	0,1,0,0.988726,0,0.030608,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.944142,0,-0.00253,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.944142,0,-0.00253,
-	0,1,0,0.936486,0,0.00536,
-	0,1,0,0.960369,0,0.001815,
-	0,1,0,0.944142,0,-0.00253,
-	0,1,0,0.960369,0,0.001815,
-	0,1,0,0.960221,0,-0.000654,
-	0,1,0,0.980908,0,-0.045793,
-	0,1,0,0.975212,0,-0.050942,
-	0,1,0,0.974361,0,-0.040383,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.950727,0,-0.029415,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.950727,0,-0.029415,
-	0,1,0,0.941242,0,-0.028276,
-	0,1,0,0.94791,0,-0.017538,
-	0,1,0,0.950727,0,-0.029415,
-	0,1,0,0.94791,0,-0.017538,
-	0,1,0,0.949423,0,-0.017734,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.950727,0,-0.029415,
-	0,1,0,0.958398,0,-0.035904,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.958398,0,-0.035904,
-	0,1,0,0.963588,0,-0.026807,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.963588,0,-0.026807,
-	0,1,0,0.9736,0,-0.02933,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.9736,0,-0.02933,
-	0,1,0,0.974361,0,-0.040383,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.974361,0,-0.040383,
-	0,1,0,0.975212,0,-0.050942,
-	0,1,0,0.969736,0,-0.083885,
-	0,1,0,0.975212,0,-0.050942,
-	0,1,0,0.978121,0,-0.065859,
-	0,1,0,0.58558,0,0.077834,
-	0,1,0,0.583383,0,0.057688,
-	0,1,0,0.578541,0,0.071411,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.37477,0,-0.091097,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.560158,0,0.070785,
-	0,1,0,0.581853,0,0.056878,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.581853,0,0.056878,
-	0,1,0,0.583383,0,0.057688,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.583383,0,0.057688,
-	0,1,0,0.58558,0,0.077834,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.58558,0,0.077834,
-	0,1,0,0.596177,0,0.051864,
-	0,1,0,0.596177,0,0.051864,
-	0,1,0,0.58558,0,0.077834,
-	0,1,0,0.593621,0,0.073449,
-	0,1,0,0.643211,0,-0.08754,
-	0,1,0,0.596177,0,0.051864,
-	0,1,0,0.694309,0,-0.093781
-};
-static const struct gllist ships_ship7_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 672, ships_ship7_data, 0
-};
-const struct gllist *ships_ship7 = &ships_ship7_frame;
-
-static const float ships_ship8_data[] = {
-	0,1,0,0.005832,0,0.055975,
-	0,1,0,0.003363,0,0.050178,
-	0,1,0,0.002964,0,0.052735,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.010321,0,0.057502,
-	0,1,0,0.010321,0,0.059668,
-	0,1,0,0.010321,0,0.057502,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.02045,0,0.031007,
-	0,1,0,0.02045,0,0.031007,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.022233,0,0.029468,
-	0,1,0,0.022233,0,0.029468,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.023945,0,0.02295,
-	0,1,0,0.023945,0,0.02295,
-	0,1,0,0.02253,0,0.059668,
-	0,1,0,0.024481,0,0.057055,
-	0,1,0,0.023945,0,0.02295,
-	0,1,0,0.024481,0,0.057055,
-	0,1,0,0.0251,0,0.012782,
-	0,1,0,0.0251,0,0.012782,
-	0,1,0,0.024481,0,0.057055,
-	0,1,0,0.026015,0,0.053784,
-	0,1,0,0.0251,0,0.012782,
-	0,1,0,0.026015,0,0.053784,
-	0,1,0,0.028168,0,0.004866,
-	0,1,0,0.028168,0,0.004866,
-	0,1,0,0.026015,0,0.053784,
-	0,1,0,0.028936,0,0.051351,
-	0,1,0,0.028168,0,0.004866,
-	0,1,0,0.028936,0,0.051351,
-	0,1,0,0.044663,0,-0.019137,
-	0,1,0,0.044663,0,-0.019137,
-	0,1,0,0.028936,0,0.051351,
-	0,1,0,0.033428,0,0.050917,
-	0,1,0,0.044663,0,-0.019137,
-	0,1,0,0.033428,0,0.050917,
-	0,1,0,0.03541,0,0.049777,
-	0,1,0,0.044663,0,-0.019137,
-	0,1,0,0.03541,0,0.049777,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.044663,0,-0.019137,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.045996,0,-0.025663,
-	0,1,0,0.045996,0,-0.025663,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.047669,0,-0.023914,
-	0,1,0,0.047669,0,-0.023914,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.062945,0,-0.046148,
-	0,1,0,0.062945,0,-0.046148,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.057326,0,0.049434,
-	0,1,0,0.062945,0,-0.046148,
-	0,1,0,0.057326,0,0.049434,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.047669,0,-0.023914,
-	0,1,0,0.045011,0,-0.027703,
-	0,1,0,0.045996,0,-0.025663,
-	0,1,0,0.002434,0,0.045554,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.002202,0,0.042612,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.002434,0,0.045554,
-	0,1,0,0.003363,0,0.050178,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.003363,0,0.050178,
-	0,1,0,0.005832,0,0.055975,
-	0,1,0,0.011938,0,0.035003,
-	0,1,0,0.005832,0,0.055975,
-	0,1,0,0.010321,0,0.057502,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.438902,0,-0.078115,
-	0,1,0,0.438902,0,-0.078115,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.42304,0,0.142145,
-	0,1,0,0.438902,0,-0.078115,
-	0,1,0,0.42304,0,0.142145,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.438902,0,-0.078115,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.452409,0,-0.078112,
-	0,1,0,0.452409,0,-0.078112,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.45572,0,-0.076151,
-	0,1,0,0.036206,0,0.061696,
-	0,1,0,0.03541,0,0.049777,
-	0,1,0,0.033904,0,0.057269,
-	0,1,0,0.03541,0,0.049777,
-	0,1,0,0.036206,0,0.061696,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.036206,0,0.061696,
-	0,1,0,0.043939,0,0.060872,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.043939,0,0.060872,
-	0,1,0,0.049068,0,0.059312,
-	0,1,0,0.052082,0,0.050568,
-	0,1,0,0.049068,0,0.059312,
-	0,1,0,0.051072,0,0.054396,
-	0,1,0,0.072814,0,0.059976,
-	0,1,0,0.072474,0,0.049213,
-	0,1,0,0.070112,0,0.057303,
-	0,1,0,0.072474,0,0.049213,
-	0,1,0,0.072814,0,0.059976,
-	0,1,0,0.07525,0,0.052979,
-	0,1,0,0.07525,0,0.052979,
-	0,1,0,0.072814,0,0.059976,
-	0,1,0,0.075906,0,0.056689,
-	0,1,0,0.058722,0,0.052729,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.057326,0,0.049434,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.058722,0,0.052729,
-	0,1,0,0.059767,0,0.057637,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.059767,0,0.057637,
-	0,1,0,0.062576,0,0.059836,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.062576,0,0.059836,
-	0,1,0,0.072474,0,0.049213,
-	0,1,0,0.072474,0,0.049213,
-	0,1,0,0.062576,0,0.059836,
-	0,1,0,0.070112,0,0.057303,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.062945,0,-0.046148,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.073875,0,0.047148,
-	0,1,0,0.077211,0,0.046012,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.077211,0,0.046012,
-	0,1,0,0.08503,0,0.046156,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.08503,0,0.046156,
-	0,1,0,0.092167,0,0.045258,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.092167,0,0.045258,
-	0,1,0,0.096503,0,0.046612,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.096503,0,0.046612,
-	0,1,0,0.098793,0,0.043324,
-	0,1,0,0.119348,0,0.043466,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.098793,0,0.043324,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.119348,0,0.043466,
-	0,1,0,0.12502,0,0.040413,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.12502,0,0.040413,
-	0,1,0,0.131056,0,0.037851,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.131056,0,0.037851,
-	0,1,0,0.137656,0,0.037851,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.137656,0,0.037851,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.137656,0,0.037851,
-	0,1,0,0.139518,0,0.038519,
-	0,1,0,0.139518,0,0.038519,
-	0,1,0,0.137656,0,0.037851,
-	0,1,0,0.138069,0,0.040466,
-	0,1,0,0.139518,0,0.038519,
-	0,1,0,0.138069,0,0.040466,
-	0,1,0,0.138791,0,0.04013,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.139518,0,0.038519,
-	0,1,0,0.142802,0,0.039252,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.142802,0,0.039252,
-	0,1,0,0.14614,0,0.039719,
-	0,1,0,0.14614,0,0.039719,
-	0,1,0,0.142802,0,0.039252,
-	0,1,0,0.14388,0,0.04044,
-	0,1,0,0.125341,0,0.043539,
-	0,1,0,0.131056,0,0.037851,
-	0,1,0,0.12502,0,0.040413,
-	0,1,0,0.131056,0,0.037851,
-	0,1,0,0.125341,0,0.043539,
-	0,1,0,0.128161,0,0.043825,
-	0,1,0,0.145652,0,0.052722,
-	0,1,0,0.146904,0,0.041826,
-	0,1,0,0.144617,0,0.046237,
-	0,1,0,0.146904,0,0.041826,
-	0,1,0,0.145652,0,0.052722,
-	0,1,0,0.1479,0,0.055176,
-	0,1,0,0.146904,0,0.041826,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.14614,0,0.039719,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.146904,0,0.041826,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.146904,0,0.041826,
-	0,1,0,0.1479,0,0.055176,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.1479,0,0.055176,
-	0,1,0,0.150072,0,0.053004,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.150072,0,0.053004,
-	0,1,0,0.151217,0,0.055047,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.151217,0,0.055047,
-	0,1,0,0.15571,0,0.055047,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.15571,0,0.055047,
-	0,1,0,0.158149,0,0.046535,
-	0,1,0,0.158149,0,0.046535,
-	0,1,0,0.15571,0,0.055047,
-	0,1,0,0.158105,0,0.050391,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.158948,0,0.040799,
-	0,1,0,0.164424,0,0.045919,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.21016,0,0.039644,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.21016,0,0.039644,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.203635,0,0.039688,
-	0,1,0,0.203635,0,0.039688,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.201135,0,0.040599,
-	0,1,0,0.201135,0,0.040599,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.170685,0,0.041151,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.16306,0,0.038153,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.170685,0,0.041151,
-	0,1,0,0.174519,0,0.043527,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.174519,0,0.043527,
-	0,1,0,0.181947,0,0.046578,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.181947,0,0.046578,
-	0,1,0,0.19086,0,0.046478,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.19086,0,0.046478,
-	0,1,0,0.192825,0,0.048165,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.192825,0,0.048165,
-	0,1,0,0.203826,0,0.070368,
-	0,1,0,0.198876,0,0.044189,
-	0,1,0,0.203826,0,0.070368,
-	0,1,0,0.208131,0,0.070368,
-	0,1,0,0.21016,0,0.039644,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.108166,0,-0.049511,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.21016,0,0.039644,
-	0,1,0,0.211879,0,0.043758,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.211879,0,0.043758,
-	0,1,0,0.214133,0,0.046343,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.214133,0,0.046343,
-	0,1,0,0.217067,0,0.047303,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.217067,0,0.047303,
-	0,1,0,0.220717,0,0.051314,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.220717,0,0.051314,
-	0,1,0,0.22281,0,0.064939,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.22281,0,0.064939,
-	0,1,0,0.22375,0,0.067435,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.22375,0,0.067435,
-	0,1,0,0.223758,0,0.071907,
-	0,1,0,0.27304,0,0.092137,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.223758,0,0.071907,
-	0,1,0,0.414461,0,-0.072292,
-	0,1,0,0.27304,0,0.092137,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.280165,0,0.133184,
-	0,1,0,0.296022,0,0.116631,
-	0,1,0,0.277564,0,0.132002,
-	0,1,0,0.296022,0,0.116631,
-	0,1,0,0.280165,0,0.133184,
-	0,1,0,0.333437,0,0.135428,
-	0,1,0,0.296022,0,0.116631,
-	0,1,0,0.333437,0,0.135428,
-	0,1,0,0.296022,0,0.111411,
-	0,1,0,0.296022,0,0.111411,
-	0,1,0,0.272364,0,0.103443,
-	0,1,0,0.271875,0,0.104698,
-	0,1,0,0.272364,0,0.103443,
-	0,1,0,0.296022,0,0.111411,
-	0,1,0,0.27304,0,0.092137,
-	0,1,0,0.27304,0,0.092137,
-	0,1,0,0.296022,0,0.111411,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.296022,0,0.111411,
-	0,1,0,0.333437,0,0.135428,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.333437,0,0.135428,
-	0,1,0,0.339306,0,0.140563,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.339306,0,0.140563,
-	0,1,0,0.346191,0,0.144191,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.346191,0,0.144191,
-	0,1,0,0.361782,0,0.130795,
-	0,1,0,0.361782,0,0.130795,
-	0,1,0,0.346191,0,0.144191,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.27304,0,0.092137,
-	0,1,0,0.272185,0,0.097253,
-	0,1,0,0.272364,0,0.103443,
-	0,1,0,0.396131,0,0.201591,
-	0,1,0,0.394287,0,0.192194,
-	0,1,0,0.393804,0,0.200441,
-	0,1,0,0.36561,0,0.142342,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.364378,0,0.128268,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.36561,0,0.142342,
-	0,1,0,0.367505,0,0.14929,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.367505,0,0.14929,
-	0,1,0,0.367521,0,0.190175,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.367521,0,0.190175,
-	0,1,0,0.394287,0,0.192194,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.394287,0,0.192194,
-	0,1,0,0.39762,0,0.192106,
-	0,1,0,0.39762,0,0.192106,
-	0,1,0,0.394287,0,0.192194,
-	0,1,0,0.396131,0,0.201591,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.39762,0,0.192106,
-	0,1,0,0.411441,0,0.192103,
-	0,1,0,0.417031,0,0.142145,
-	0,1,0,0.411441,0,0.192103,
-	0,1,0,0.41751,0,0.189939,
-	0,1,0,0.46729,0,0.156326,
-	0,1,0,0.46455,0,0.14786,
-	0,1,0,0.46391,0,0.154195,
-	0,1,0,0.46455,0,0.14786,
-	0,1,0,0.46729,0,0.156326,
-	0,1,0,0.467188,0,0.151932,
-	0,1,0,0.467188,0,0.151932,
-	0,1,0,0.46729,0,0.156326,
-	0,1,0,0.468792,0,0.153724,
-	0,1,0,0.494957,0,0.142883,
-	0,1,0,0.492192,0,0.138739,
-	0,1,0,0.473771,0,0.142883,
-	0,1,0,0.430244,0,0.148851,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.42304,0,0.142145,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.430244,0,0.148851,
-	0,1,0,0.436776,0,0.145631,
-	0,1,0,0.436776,0,0.145631,
-	0,1,0,0.430244,0,0.148851,
-	0,1,0,0.4303,0,0.152047,
-	0,1,0,0.436776,0,0.145631,
-	0,1,0,0.4303,0,0.152047,
-	0,1,0,0.431657,0,0.154623,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.436776,0,0.145631,
-	0,1,0,0.46087,0,0.143294,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.46087,0,0.143294,
-	0,1,0,0.462544,0,0.148898,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.462544,0,0.148898,
-	0,1,0,0.46455,0,0.14786,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.46455,0,0.14786,
-	0,1,0,0.468291,0,0.149647,
-	0,1,0,0.468291,0,0.149647,
-	0,1,0,0.46455,0,0.14786,
-	0,1,0,0.467188,0,0.151932,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.468291,0,0.149647,
-	0,1,0,0.470539,0,0.149639,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.470539,0,0.149639,
-	0,1,0,0.473771,0,0.142883,
-	0,1,0,0.473771,0,0.142883,
-	0,1,0,0.470539,0,0.149639,
-	0,1,0,0.472711,0,0.147588,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.473771,0,0.142883,
-	0,1,0,0.492192,0,0.138739,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.554376,0,-0.083574,
-	0,1,0,0.45572,0,-0.076151,
-	0,1,0,0.554376,0,-0.083574,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.554376,0,-0.083574,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.654247,0,0.015187,
-	0,1,0,0.502776,0,0.108696,
-	0,1,0,0.501788,0,0.10362,
-	0,1,0,0.495229,0,0.109265,
-	0,1,0,0.520624,0,0.103177,
-	0,1,0,0.512293,0,0.098887,
-	0,1,0,0.511027,0,0.103177,
-	0,1,0,0.525775,0,0.103226,
-	0,1,0,0.525756,0,0.097929,
-	0,1,0,0.523115,0,0.103226,
-	0,1,0,0.573637,0,0.088855,
-	0,1,0,0.558207,0,0.086926,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.558207,0,0.086926,
-	0,1,0,0.573637,0,0.088855,
-	0,1,0,0.571308,0,0.086919,
-	0,1,0,0.604955,0,0.07973,
-	0,1,0,0.603117,0,0.073276,
-	0,1,0,0.601069,0,0.081537,
-	0,1,0,0.603117,0,0.073276,
-	0,1,0,0.604955,0,0.07973,
-	0,1,0,0.60802,0,0.073309,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.501788,0,0.10362,
-	0,1,0,0.501788,0,0.10362,
-	0,1,0,0.492192,0,0.102364,
-	0,1,0,0.495229,0,0.109265,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.501788,0,0.10362,
-	0,1,0,0.506596,0,0.10335,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.506596,0,0.10335,
-	0,1,0,0.509379,0,0.098989,
-	0,1,0,0.509379,0,0.098989,
-	0,1,0,0.506596,0,0.10335,
-	0,1,0,0.509367,0,0.100434,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.509626,0,0.097197,
-	0,1,0,0.512293,0,0.098887,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.512293,0,0.098887,
-	0,1,0,0.522474,0,0.099087,
-	0,1,0,0.522474,0,0.099087,
-	0,1,0,0.512293,0,0.098887,
-	0,1,0,0.520624,0,0.103177,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.522474,0,0.099087,
-	0,1,0,0.523115,0,0.103226,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.523115,0,0.103226,
-	0,1,0,0.525756,0,0.097929,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.559466,0,0.085046,
-	0,1,0,0.559466,0,0.085046,
-	0,1,0,0.528723,0,0.087979,
-	0,1,0,0.558207,0,0.086926,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.559466,0,0.085046,
-	0,1,0,0.569292,0,0.083154,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.569292,0,0.083154,
-	0,1,0,0.577201,0,0.080132,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.577201,0,0.080132,
-	0,1,0,0.579331,0,0.083338,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.579331,0,0.083338,
-	0,1,0,0.580957,0,0.082369,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.580957,0,0.082369,
-	0,1,0,0.587377,0,0.083066,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.587377,0,0.083066,
-	0,1,0,0.603117,0,0.068976,
-	0,1,0,0.603117,0,0.068976,
-	0,1,0,0.587377,0,0.083066,
-	0,1,0,0.59551,0,0.082918,
-	0,1,0,0.603117,0,0.068976,
-	0,1,0,0.59551,0,0.082918,
-	0,1,0,0.601069,0,0.081537,
-	0,1,0,0.603117,0,0.068976,
-	0,1,0,0.601069,0,0.081537,
-	0,1,0,0.603117,0,0.073276,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.603117,0,0.068976,
-	0,1,0,0.618127,0,0.067729,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.618127,0,0.067729,
-	0,1,0,0.63036,0,0.064661,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.63036,0,0.064661,
-	0,1,0,0.644519,0,0.053387,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.644519,0,0.053387,
-	0,1,0,0.647455,0,0.043469,
-	0,1,0,0.647455,0,0.043469,
-	0,1,0,0.644519,0,0.053387,
-	0,1,0,0.646258,0,0.049809,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.647455,0,0.043469,
-	0,1,0,0.650701,0,0.037636,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.650701,0,0.037636,
-	0,1,0,0.653033,0,0.035305,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.653033,0,0.035305,
-	0,1,0,0.654069,0,0.029472,
-	0,1,0,0.655501,0,0.016428,
-	0,1,0,0.654247,0,0.015187,
-	0,1,0,0.654112,0,0.015207,
-	0,1,0,0.945366,0,-0.037253,
-	0,1,0,0.943627,0,-0.044241,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.860413,0,-0.101142,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.860413,0,-0.101142,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.94546,0,-0.104852,
-	0,1,0,0.94546,0,-0.104852,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.943627,0,-0.044241,
-	0,1,0,0.675281,0,0.011748,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.675281,0,0.011748,
-	0,1,0,0.827887,0,0.032351,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.827887,0,0.032351,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.827887,0,0.032351,
-	0,1,0,0.881549,0,0.0425,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.881549,0,0.0425,
-	0,1,0,0.884461,0,0.043681,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.884461,0,0.043681,
-	0,1,0,0.892484,0,0.045416,
-	0,1,0,0.892484,0,0.045416,
-	0,1,0,0.884461,0,0.043681,
-	0,1,0,0.88951,0,0.046355,
-	0,1,0,0.932523,0,0.067243,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.929184,0,0.060147,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.932523,0,0.067243,
-	0,1,0,0.931834,0,0.058098,
-	0,1,0,0.931834,0,0.058098,
-	0,1,0,0.932523,0,0.067243,
-	0,1,0,0.932515,0,0.061838,
-	0,1,0,0.932515,0,0.061838,
-	0,1,0,0.932523,0,0.067243,
-	0,1,0,0.933892,0,0.064053,
-	0,1,0,0.935665,0,0.058098,
-	0,1,0,0.932778,0,0.053821,
-	0,1,0,0.931834,0,0.058098,
-	0,1,0,0.932778,0,0.053821,
-	0,1,0,0.935665,0,0.058098,
-	0,1,0,0.935665,0,0.054317,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.932778,0,0.053821,
-	0,1,0,0.93821,0,0.052186,
-	0,1,0,0.932778,0,0.053821,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.931834,0,0.058098,
-	0,1,0,0.95718,0,0.097525,
-	0,1,0,0.956297,0,0.088372,
-	0,1,0,0.956137,0,0.091159,
-	0,1,0,0.956297,0,0.088372,
-	0,1,0,0.95718,0,0.097525,
-	0,1,0,0.957079,0,0.084323,
-	0,1,0,0.957079,0,0.084323,
-	0,1,0,0.95718,0,0.097525,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.95718,0,0.097525,
-	0,1,0,0.957651,0,0.104195,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.957651,0,0.104195,
-	0,1,0,0.960891,0,0.055267,
-	0,1,0,0.960891,0,0.055267,
-	0,1,0,0.957651,0,0.104195,
-	0,1,0,0.959009,0,0.097879,
-	0,1,0,0.93821,0,0.052186,
-	0,1,0,0.945366,0,-0.037253,
-	0,1,0,0.931238,0,0.050966,
-	0,1,0,0.945366,0,-0.037253,
-	0,1,0,0.93821,0,0.052186,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.945366,0,-0.037253,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.972642,0,0.02864,
-	0,1,0,0.972642,0,0.02864,
-	0,1,0,0.957195,0,0.055454,
-	0,1,0,0.960891,0,0.055267,
-	0,1,0,0.972642,0,0.02864,
-	0,1,0,0.960891,0,0.055267,
-	0,1,0,0.985604,0,0.059894,
-	0,1,0,0.972642,0,0.02864,
-	0,1,0,0.985604,0,0.059894,
-	0,1,0,0.988456,0,0.057791,
-	0,1,0,0.988456,0,0.057791,
-	0,1,0,0.985604,0,0.059894,
-	0,1,0,0.987834,0,0.059485,
-	0,1,0,0.654247,0,0.015187,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.554376,0,-0.083574,
-	0,1,0,0.814871,0,-0.103174,
-	0,1,0,0.654247,0,0.015187,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.655501,0,0.016428,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.654247,0,0.015187,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.655501,0,0.016428,
-	0,1,0,0.657185,0,0.02107,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.657185,0,0.02107,
-	0,1,0,0.659916,0,0.02521,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.659916,0,0.02521,
-	0,1,0,0.664177,0,0.020241,
-	0,1,0,0.664177,0,0.020241,
-	0,1,0,0.659916,0,0.02521,
-	0,1,0,0.66073,0,0.026097,
-	0,1,0,0.664177,0,0.020241,
-	0,1,0,0.66073,0,0.026097,
-	0,1,0,0.66237,0,0.026134,
-	0,1,0,0.669576,0,0.012951,
-	0,1,0,0.664177,0,0.020241,
-	0,1,0,0.668157,0,0.021264,
-	0,1,0,0.347066,0,0.549424,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.345213,0,0.547729,
-	0,1,0,0.348058,0,0.418216,
-	0,1,0,0.346981,0,0.41173,
-	0,1,0,0.344483,0,0.413246,
-	0,1,0,0.346981,0,0.41173,
-	0,1,0,0.348058,0,0.418216,
-	0,1,0,0.347565,0,0.40265,
-	0,1,0,0.327308,0,0.536788,
-	0,1,0,0.32919,0,0.535075,
-	0,1,0,0.321335,0,0.537318,
-	0,1,0,0.32919,0,0.535075,
-	0,1,0,0.327308,0,0.536788,
-	0,1,0,0.328188,0,0.5366,
-	0,1,0,0.32919,0,0.535075,
-	0,1,0,0.328188,0,0.5366,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.32919,0,0.535075,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.346293,0,0.532502,
-	0,1,0,0.346293,0,0.532502,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.346334,0,0.471726,
-	0,1,0,0.346334,0,0.471726,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.347276,0,0.465686,
-	0,1,0,0.347276,0,0.465686,
-	0,1,0,0.3464,0,0.534556,
-	0,1,0,0.347066,0,0.549424,
-	0,1,0,0.347276,0,0.465686,
-	0,1,0,0.347066,0,0.549424,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.347066,0,0.549424,
-	0,1,0,0.349227,0,0.547746,
-	0,1,0,0.347276,0,0.465686,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.347278,0,0.458759,
-	0,1,0,0.347278,0,0.458759,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.347293,0,0.42338,
-	0,1,0,0.347293,0,0.42338,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.348058,0,0.418216,
-	0,1,0,0.345815,0,0.388,
-	0,1,0,0.347024,0,0.386769,
-	0,1,0,0.345487,0,0.387331,
-	0,1,0,0.347024,0,0.386769,
-	0,1,0,0.345815,0,0.388,
-	0,1,0,0.347565,0,0.40265,
-	0,1,0,0.347024,0,0.386769,
-	0,1,0,0.347565,0,0.40265,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.347565,0,0.40265,
-	0,1,0,0.348058,0,0.418216,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.348058,0,0.418216,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.348219,0,0.515458,
-	0,1,0,0.348219,0,0.515458,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.349188,0,0.531671,
-	0,1,0,0.349188,0,0.531671,
-	0,1,0,0.34814,0,0.533961,
-	0,1,0,0.38184,0,0.527549,
-	0,1,0,0.349188,0,0.531671,
-	0,1,0,0.38184,0,0.527549,
-	0,1,0,0.380546,0,0.52602,
-	0,1,0,0.347221,0,0.339233,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.346151,0,0.335537,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.347221,0,0.339233,
-	0,1,0,0.347364,0,0.342998,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.347364,0,0.342998,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.348186,0,0.347995,
-	0,1,0,0.348219,0,0.515458,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.348219,0,0.515458,
-	0,1,0,0.349153,0,0.508619,
-	0,1,0,0.349278,0,0.501883,
-	0,1,0,0.349188,0,0.496373,
-	0,1,0,0.349153,0,0.508619,
-	0,1,0,0.349188,0,0.496373,
-	0,1,0,0.349278,0,0.501883,
-	0,1,0,0.351564,0,0.493203,
-	0,1,0,0.351564,0,0.493203,
-	0,1,0,0.349278,0,0.501883,
-	0,1,0,0.351549,0,0.496092,
-	0,1,0,0.349237,0,0.470978,
-	0,1,0,0.349203,0,0.461645,
-	0,1,0,0.349188,0,0.496373,
-	0,1,0,0.349203,0,0.461645,
-	0,1,0,0.349237,0,0.470978,
-	0,1,0,0.349729,0,0.465878,
-	0,1,0,0.352189,0,0.414687,
-	0,1,0,0.351043,0,0.412516,
-	0,1,0,0.350152,0,0.418304,
-	0,1,0,0.351043,0,0.412516,
-	0,1,0,0.352189,0,0.414687,
-	0,1,0,0.354741,0,0.41097,
-	0,1,0,0.352609,0,0.387986,
-	0,1,0,0.352082,0,0.381934,
-	0,1,0,0.351117,0,0.39323,
-	0,1,0,0.355774,0,0.331472,
-	0,1,0,0.355466,0,0.329124,
-	0,1,0,0.352095,0,0.363754,
-	0,1,0,0.341708,0,0.323397,
-	0,1,0,0.311235,0,0.324384,
-	0,1,0,0.3097,0,0.326063,
-	0,1,0,0.311235,0,0.324384,
-	0,1,0,0.341708,0,0.323397,
-	0,1,0,0.346191,0,0.320472,
-	0,1,0,0.346191,0,0.320472,
-	0,1,0,0.341708,0,0.323397,
-	0,1,0,0.345765,0,0.324132,
-	0,1,0,0.346191,0,0.320472,
-	0,1,0,0.345765,0,0.324132,
-	0,1,0,0.347876,0,0.322954,
-	0,1,0,0.346191,0,0.320472,
-	0,1,0,0.347876,0,0.322954,
-	0,1,0,0.346191,0,0.144191,
-	0,1,0,0.346191,0,0.144191,
-	0,1,0,0.347876,0,0.322954,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.347876,0,0.322954,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.350152,0,0.418304,
-	0,1,0,0.350152,0,0.418304,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.349203,0,0.461645,
-	0,1,0,0.349203,0,0.461645,
-	0,1,0,0.348223,0,0.336993,
-	0,1,0,0.349153,0,0.508619,
-	0,1,0,0.349203,0,0.461645,
-	0,1,0,0.349153,0,0.508619,
-	0,1,0,0.349188,0,0.496373,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.350152,0,0.418304,
-	0,1,0,0.351117,0,0.39323,
-	0,1,0,0.351117,0,0.39323,
-	0,1,0,0.350152,0,0.418304,
-	0,1,0,0.351043,0,0.412516,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.351117,0,0.39323,
-	0,1,0,0.352095,0,0.363754,
-	0,1,0,0.352095,0,0.363754,
-	0,1,0,0.351117,0,0.39323,
-	0,1,0,0.352082,0,0.381934,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.352095,0,0.363754,
-	0,1,0,0.355481,0,0.327095,
-	0,1,0,0.355481,0,0.327095,
-	0,1,0,0.352095,0,0.363754,
-	0,1,0,0.355466,0,0.329124,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.355481,0,0.327095,
-	0,1,0,0.35597,0,0.324825,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.35597,0,0.324825,
-	0,1,0,0.357392,0,0.322493,
-	0,1,0,0.358829,0,0.141179,
-	0,1,0,0.357392,0,0.322493,
-	0,1,0,0.358837,0,0.319339,
-	0,1,0,0.358837,0,0.319339,
-	0,1,0,0.357392,0,0.322493,
-	0,1,0,0.393191,0,0.319422,
-	0,1,0,0.358837,0,0.319339,
-	0,1,0,0.393191,0,0.319422,
-	0,1,0,0.396476,0,0.31792,
-	0,1,0,0.347293,0,0.42338,
-	0,1,0,0.346836,0,0.454548,
-	0,1,0,0.347278,0,0.458759,
-	0,1,0,0.346981,0,0.41173,
-	0,1,0,0.34676,0,0.408074,
-	0,1,0,0.343807,0,0.406572,
-	0,1,0,0.34676,0,0.408074,
-	0,1,0,0.346981,0,0.41173,
-	0,1,0,0.347565,0,0.40265
-};
-static const struct gllist ships_ship8_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 837, ships_ship8_data, 0
-};
-const struct gllist *ships_ship8 = &ships_ship8_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char ships[] =
+ "XSGLMSH1\010\000\000\000\000\000\000\000ship1\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\002"
+ "\000\000\004\000\000\000l\000\000\000>\001\000\000\325\000\000\000G%\375"
+ ">C3\134\244\340\014G>\324NA7ship2\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\030\014\000\000\004"
+ "\000\000\000\332\000\000\000\210\002\000\000\261\001\000\000\042\210\367"
+ ">8\345\271#\264\356\011>\361\000x7ship3\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000p \000\000\004\000"
+ "\000\000\134\001\000\000\024\004\000\000\267\002\000\000\275\265\001\077"
+ "*\361b#m\042\264=\236\037|7ship4\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\014A\000\000\004\000"
+ "\000\000\260\000\000\000\012\002\000\000]\001\000\000i\310\375>;)\345#\203"
+ "\0015>\365Wz7ship5\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000tQ\000\000\004\000\000\000\353\000\000"
+ "\000\276\002\000\000\324\001\000\000B\251\375>x\305\376$T\375 >2\327|7sh"
+ "ip6\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000pg\000\000\004\000\000\000;\000\000\000\253\000\000\000"
+ "s\000\000\000~Y\374>\271a\026\245\255\231M=\005\266y7ship7\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\344l\000\000\004\000\000\000\342\000\000\000\240\002\000\000\301\001"
+ "\000\000*\035\375>LR\020%\354\310.>$\037}7ship8\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\374\201"
+ "\000\000\004\000\000\000\030\001\000\000E\003\000\000.\002\000\000\273\233"
+ "\375>\364\027\344%\010\237c>\036}|7\010\200\000\000\301\324\000\000\364\214"
+ "\000\000\364\321\000\000\001\200\000\000\365\323\000\000\260\226\000\000"
+ "\301\324\000\000\234\220\000\000\237\314\000\000\033\226\000\000\342\262"
+ "\000\000e\263\000\000M\344\000\000]\236\000\000\366\332\000\000\210\211\000"
+ "\000\026\316\000\000[\211\000\000p\265\000\000\262\210\000\000N\273\000\000"
+ "h\213\000\000\356\302\000\000\303\211\000\000\333\320\000\000\332\212\000"
+ "\000f\321\000\000\214\027\000\000\225\374\000\000\370\037\000\000\346\254"
+ "\000\000\335\003\000\000a\372\000\000\274B\000\000\012\001\000\00025\000"
+ "\000U\253\000\00026\000\000\340\252\000\000\364\223\000\000f\370\000\000"
+ "\237\222\000\000\311\367\000\0006\232\000\000\201\353\000\000\005\241\000"
+ "\000\251\336\000\000o\241\000\000\256\345\000\000\250\251\000\000\003\351"
+ "\000\000\205\322\000\000\270\255\000\000\260\345\000\000\262\370\000\000"
+ "\000\327\000\000+\256\000\000C\342\000\000\312\257\000\000\334\305\000\000"
+ "\311*\000\000c\306\000\000W(\000\000\267\276\000\000x'\000\000_\306\000\000"
+ "\011+\000\000\243\311\000\000\205.\000\0007\311\000\000+#\000\000\215\312"
+ "\000\000\2416\000\000\364\310\000\000\0221\000\000\277\311\000\000\252\025"
+ "\000\000k\314\000\000\3658\000\000\367\277\000\000S8\000\000h\316\000\000"
+ "\200;\000\000Z\316\000\000\3614\000\000G\315\000\000o=\000\000\017\320\000"
+ "\000\2538\000\000T\323\000\000E6\000\000\256\335\000\000\3646\000\000\212"
+ "\330\000\000\0246\000\000\302\330\000\000\336\013\000\000v\325\000\000\004"
+ "\012\000\000\314\322\000\000X\016\000\000[\327\000\000\343-\000\000\276\320"
+ "\000\000*\032\000\000\220\325\000\0001%\000\000\256\327\000\000\330'\000"
+ "\000\316\330\000\000W$\000\000.\326\000\000\226\034\000\000\077\343\000\000"
+ "\221\032\000\000\014\310\000\000\236\015\000\000v\325\000\000\336\006\000"
+ "\000\370\301\000\000@\010\000\000\367\314\000\000\340:\000\000\032\260\000"
+ "\000\372\035\000\000\001\263\000\000\263\033\000\000\232\257\000\0006\035"
+ "\000\000\367\264\000\000b\034\000\000#\277\000\000;\036\000\000\015\263\000"
+ "\000\374\020\000\000\270\306\000\000\216\033\000\000\003\305\000\000<\036"
+ "\000\000\367\264\000\000\336\006\000\000&\346\000\000y\014\000\000`\343\000"
+ "\000]\010\000\000`\343\000\000\023\026\000\0003\346\000\000\273\002\000\000"
+ "\201\336\000\000T\004\000\000;\000\000\000Y\372\000\000;\000\000\000<\006"
+ "\000\000\227\364\000\000}\371\000\000\211\347\000\000\262\373\000\000#\360"
+ "\000\000\347\256\000\000;\373\000\0003\254\000\000\277\000\000\000\375\252"
+ "\000\000\272x\000\000\234\004\000\000\234x\000\000j\261\000\000\352b\000"
+ "\000\210\004\000\000\307x\000\000N\334\000\000\221z\000\000:\374\000\000"
+ "\231y\000\000&\343\000\000\301|\000\000\035\365\000\000\252}\000\000!\365"
+ "\000\0006N\000\000\214\002\000\000P{\000\000\340\243\000\000\272z\000\000"
+ "u\247\000\000\322z\000\000D\001\000\000\377\177\000\000\254\377\000\000\367"
+ "8\000\000\207\247\000\000]^\000\000\227\244\000\000Ba\000\000R\247\000\000"
+ "\376\267\000\000_\355\000\000\271\267\000\0004\352\000\0001\235\000\000k"
+ "\355\000\000\216\273\000\000\002\377\000\000j\271\000\000\343\365\000\000"
+ "Y\270\000\000\042\374\000\000\022\274\000\000/\007\000\000h\316\000\000 "
+ "\134\000\000G\315\000\000 \134\000\000\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\000\001\000\002\000\001\000\000"
+ "\000\003\000\001\000\003\000\004\000\004\000\003\000\005\000\005\000\003"
+ "\000\006\000\006\000\003\000\007\000\010\000\011\000\012\000\011\000\010"
+ "\000\013\000\011\000\013\000\005\000\013\000\010\000\014\000\013\000\014"
+ "\000\015\000\005\000\013\000\004\000\016\000\017\000\020\000\017\000\016"
+ "\000\021\000\017\000\021\000\022\000\022\000\021\000\023\000\024\000\007"
+ "\000\025\000\007\000\024\000\026\000\007\000\026\000\027\000\007\000\027"
+ "\000\006\000\006\000\027\000\030\000\006\000\030\000\031\000\032\000\005"
+ "\000\006\000\033\000\032\000\006\000\032\000\033\000\034\000\034\000\033"
+ "\000\035\000\036\000\037\000 \000\037\000\036\000!\000\037\000!\000\042\000"
+ "\037\000\042\000#\000$\000\042\000%\000\042\000$\000&\000'\000$\000(\000"
+ ")\000*\000+\000*\000)\000,\000*\000,\000-\000-\000,\000.\000-\000.\000/\000"
+ "0\0001\0002\0003\0004\000*\0004\0003\0005\0005\0003\0006\0007\0008\0005\000"
+ "4\0008\0009\0008\0004\0005\000:\000;\000<\000;\000:\000&\000;\000&\0002\000"
+ "2\000&\000$\0002\000$\0004\0004\000$\000'\0004\000'\000=\0004\000=\000+\000"
+ "4\000+\000*\000;\0002\0001\000>\000\077\000@\000\077\000>\000A\000A\000>"
+ "\000B\000\077\000A\000C\000A\000B\000D\000D\000B\000E\000D\000E\000#\000"
+ "D\000#\000&\000&\000#\000\042\000F\000C\000A\000G\000H\000I\000H\000G\000"
+ "\033\000\033\000G\000J\000\033\000K\000H\000\020\000L\000M\000\035\000N\000"
+ "L\000N\000\035\000\033\000N\000\033\000O\000L\000P\000\035\000P\000L\000"
+ "Q\000Q\000L\000R\000R\000L\000\020\000S\000T\000U\000T\000S\000V\000V\000"
+ "S\000W\000V\000W\000X\000X\000W\000Y\000X\000Y\000Z\000[\000\134\000\021"
+ "\000\134\000[\000U\000\134\000U\000T\000\134\000T\000]\000^\000W\000S\000"
+ "W\000^\000_\000\021\000`\000\023\000`\000\021\000a\000a\000\021\000b\000"
+ "b\000\021\000\134\000c\000d\000e\000f\000g\000h\000d\000\033\000\006\000"
+ "\033\000d\000c\000\033\000c\000g\000\033\000g\000f\000\033\000f\000i\000"
+ "\033\000i\000<\000\033\000<\000;\000\033\000;\000K\000\017\000R\000\020\000"
+ "j\000+\000k\000+\000j\000)\000\000\000\001\000\001\000\002\000\000\000\002"
+ "\000\000\000\003\000\001\000\003\000\003\000\004\000\001\000\004\000\003"
+ "\000\005\000\004\000\005\000\003\000\006\000\005\000\006\000\003\000\007"
+ "\000\006\000\007\000\010\000\011\000\011\000\012\000\010\000\012\000\010"
+ "\000\013\000\011\000\013\000\005\000\013\000\005\000\011\000\010\000\014"
+ "\000\013\000\014\000\014\000\015\000\013\000\015\000\004\000\013\000\016"
+ "\000\017\000\017\000\020\000\016\000\020\000\016\000\021\000\017\000\021"
+ "\000\021\000\022\000\017\000\022\000\021\000\023\000\022\000\023\000\007"
+ "\000\024\000\007\000\025\000\024\000\025\000\024\000\026\000\007\000\026"
+ "\000\026\000\027\000\007\000\027\000\006\000\027\000\027\000\030\000\006"
+ "\000\030\000\030\000\031\000\006\000\031\000\005\000\032\000\006\000\032"
+ "\000\032\000\033\000\006\000\033\000\033\000\034\000\032\000\034\000\033"
+ "\000\035\000\034\000\035\000\036\000\037\000\037\000 \000\036\000 \000\036"
+ "\000!\000\037\000!\000!\000\042\000\037\000\042\000\042\000#\000\037\000"
+ "#\000\042\000$\000\042\000%\000$\000%\000$\000&\000\042\000&\000$\000'\000"
+ "$\000(\000'\000(\000)\000*\000*\000+\000)\000+\000)\000,\000*\000,\000,\000"
+ "-\000*\000-\000,\000.\000-\000.\000.\000/\000-\000/\0000\0001\0001\0002\000"
+ "0\0002\0003\0004\000*\0004\000*\0003\0003\0005\0004\0005\0003\0006\0005\000"
+ "6\0007\0008\0005\0008\0005\0007\0004\0008\0008\0009\0004\0009\000:\000;\000"
+ ";\000<\000:\000<\000&\000:\000&\000;\000&\0002\0002\000;\000$\0002\000$\000"
+ "4\0002\0004\000'\0004\000'\000=\0004\000=\000+\000=\000+\0004\0001\000;\000"
+ ">\000\077\000\077\000@\000>\000@\000>\000A\000\077\000A\000>\000B\000A\000"
+ "B\000A\000C\000\077\000C\000B\000D\000A\000D\000B\000E\000D\000E\000#\000"
+ "E\000#\000D\000#\000&\000&\000D\000C\000F\000A\000F\000G\000H\000H\000I\000"
+ "G\000I\000\033\000G\000\033\000H\000G\000J\000\033\000J\000\033\000K\000"
+ "H\000K\000\020\000L\000L\000M\000\020\000M\000\035\000N\000L\000N\000\035"
+ "\000L\000\033\000N\000\033\000O\000N\000O\000L\000P\000\035\000P\000L\000"
+ "Q\000P\000Q\000L\000R\000Q\000R\000\020\000R\000S\000T\000T\000U\000S\000"
+ "U\000S\000V\000T\000V\000S\000W\000V\000W\000W\000X\000V\000X\000W\000Y\000"
+ "X\000Y\000Y\000Z\000X\000Z\000[\000\134\000\021\000\134\000\021\000[\000"
+ "U\000[\000U\000\134\000T\000\134\000T\000]\000\134\000]\000W\000^\000S\000"
+ "^\000^\000_\000W\000_\000\021\000`\000\023\000`\000\021\000a\000`\000a\000"
+ "\021\000b\000a\000b\000\134\000b\000c\000d\000d\000e\000c\000e\000f\000g"
+ "\000g\000h\000f\000h\000\033\000d\000\006\000d\000\033\000c\000c\000g\000"
+ "\033\000g\000\033\000f\000f\000i\000\033\000i\000<\000i\000\033\000<\000"
+ "\033\000;\000;\000K\000\017\000R\000+\000j\000+\000k\000j\000k\000)\000j"
+ "\000k\310\000\000\032\324\000\000\357\225\000\000;\326\000\000\367\271\000"
+ "\0008\345\000\000J\202\000\000\357\334\000\000g\200\000\000\004\333\000\000"
+ "\001\200\000\000R\333\000\000\022\216\000\000\026\330\000\000/\203\000\000"
+ "G\335\000\000T\211\000\000\207\336\000\000\330\211\000\000\210\336\000\000"
+ "@\214\000\000\021\336\000\000i\214\000\000\362\335\000\000,\217\000\000\262"
+ "\327\000\000\341\216\000\000j\340\000\000p\236\000\000\026\342\000\000\300"
+ "\236\000\000R\342\000\000\031\244\000\000\036\344\000\000\302\240\000\000"
+ "\300\345\000\000|\241\000\000;\346\000\000R\242\000\000t\346\000\000\307"
+ "\247\000\000j\344\000\000q\251\000\000\302\344\000\000\326\262\000\000j\345"
+ "\000\000\035\271\000\000b\345\000\000\275\264\000\000D\346\000\0005\266\000"
+ "\000\323\346\000\000|\266\000\000\322\346\000\000\222\247\000\000\226\371"
+ "\000\000\334\251\000\000X\371\000\000\203\252\000\000;\372\000\000S\254\000"
+ "\000\260\374\000\000[\254\000\000\016\373\000\000\225\254\000\000\312\373"
+ "\000\000\375\263\000\000\012\354\000\000d\262\000\000\012\354\000\000\203"
+ "\277\000\000\261\351\000\000\357\277\000\000\310\344\000\000\335\274\000"
+ "\000\001\346\000\000\236\300\000\000\362\351\000\000\301\301\000\000\274"
+ "\351\000\000\023\304\000\000\177\346\000\000\033\311\000\000=\345\000\000"
+ "\031\303\000\000\230\345\000\000\025\304\000\000\264\346\000\000{\305\000"
+ "\000\365\347\000\000i\310\000\000\307\350\000\000\333\314\000\000<\354\000"
+ "\000h\316\000\000\350\344\000\000\263\313\000\000=\345\000\000@\316\000\000"
+ "<\354\000\000\000\322\000\000o\372\000\000\216\320\000\000\317\370\000\000"
+ "E\320\000\000J\371\000\000\234\320\000\0005\370\000\000\223\322\000\0007"
+ "\361\000\000\261\323\000\000\347\360\000\000\232\322\000\000@\357\000\000"
+ "\226\323\000\000\217\002\000\000\363\322\000\000;\377\000\000\335\322\000"
+ "\000\232\377\000\000G\325\000\000\254\374\000\000\204\326\000\000\355\001"
+ "\000\000Y\325\000\000J\374\000\000\220\325\000\000\354\365\000\000\272\325"
+ "\000\000)\365\000\000\267\325\000\000b\362\000\000\310\327\000\000\042\361"
+ "\000\000P\325\000\000\347\360\000\000\321\326\000\000\354\377\000\000\307"
+ "\326\000\000\360\000\000\000\325\327\000\000*\371\000\000\013\330\000\000"
+ "8\362\000\000K\330\000\000\227\367\000\000F\330\000\000&\365\000\000]\330"
+ "\000\000\241\365\000\000W\334\000\000.\370\000\000@\351\000\000+\363\000"
+ "\000\212\333\000\000B\361\000\000\334\334\000\000\273\371\000\000\177\350"
+ "\000\000\232\363\000\000\015\335\000\000\346\372\000\000G\335\000\000\230"
+ "\377\000\000\367\337\000\000D\000\000\0001\347\000\000\316\366\000\000\236"
+ "\346\000\000,\371\000\000\313\345\000\000\346\020\000\000\306\353\000\000"
+ "\254\004\000\000\316\352\000\000\035\000\000\000\134\352\000\000C\003\000"
+ "\000\013\354\000\000\344\376\000\000\033\357\000\000\216\003\000\000\251"
+ "\354\000\000\320\363\000\000\245\360\000\000\177\362\000\000|\367\000\000"
+ "g\346\000\000\312\367\000\000g\345\000\000\234\365\000\000M\357\000\000\234"
+ "\365\000\000\271\362\000\000\006\366\000\000\005\356\000\000\014\015\000"
+ "\0005\321\000\000\033\274\000\000\224\345\000\000(\317\000\0000\345\000\000"
+ "\035\320\000\000.\346\000\000\335\321\000\000\257\355\000\000\262\351\000"
+ "\000W\363\000\0006\340\000\000\362\021\000\000\327\334\000\000\275\020\000"
+ "\0006\334\000\000\362\021\000\000\211\337\000\000l\020\000\000\367\337\000"
+ "\000\031\006\000\000\370\337\000\000\260\002\000\000\031\337\000\000\267"
+ "\026\000\000\267\336\000\000f\026\000\000 \341\000\000V\027\000\000\302\344"
+ "\000\000>2\000\000\012\343\000\000\332\027\000\000\320\341\000\000\235\030"
+ "\000\000\227\345\000\000\3001\000\000\010\345\000\000d3\000\000'\345\000"
+ "\000[3\000\000\265\345\000\000\0022\000\000\351\344\000\000\252\021\000\000"
+ "\236\341\000\000\302\027\000\000\351\344\000\000\204\027\000\000\346\336"
+ "\000\000R\005\000\000'\337\000\000w\003\000\000R\336\000\000\002\004\000"
+ "\000m\337\000\000`\003\000\000\305\376\000\000\312\364\000\000H\375\000\000"
+ "\023\346\000\000\302\372\000\000\211\347\000\000\334\001\000\000\355\364"
+ "\000\000\226\377\000\000\334\365\000\000\363\003\000\000\244\370\000\000"
+ "/\002\000\000g\365\000\000\211\004\000\000\277\366\000\000\077\004\000\000"
+ "\357\370\000\000\310\004\000\000=\367\000\000s\020\000\000\321\351\000\000"
+ "\343\021\000\000\223\344\000\000\220\014\000\000\223\344\000\000Q\023\000"
+ "\000\364\346\000\000L#\000\000D\320\000\000\320\026\000\000\223\344\000\000"
+ "\206\030\000\000\370\344\000\0001\031\000\000\337\344\000\000\224\032\000"
+ "\000\364\343\000\000\030\035\000\000\276\343\000\000W\370\000\000\372\346"
+ "\000\000\270\370\000\000D\347\000\000/\012\000\000[\343\000\000J\013\000"
+ "\000\245\343\000\000\3651\000\000\341\342\000\000\257L\000\000\206\316\000"
+ "\000\2545\000\000\036\343\000\000\237)\000\000\260\355\000\000n(\000\000"
+ "\000\347\000\000\370'\000\000\260\355\000\000\2540\000\000\357\355\000\000"
+ "\2020\000\000\302\347\000\000\2020\000\000\345\355\000\000\221\035\000\000"
+ ".\344\000\000\336\036\000\000\360\350\000\000h$\000\000G\347\000\000-\042"
+ "\000\000\360\350\000\000\021+\000\0003\347\000\000\255*\000\000\371\347\000"
+ "\000Y.\000\000*\345\000\000'.\000\000[\345\000\000\337.\000\000m\347\000"
+ "\000\3001\000\000l\354\000\000\003B\000\000\241\356\000\000\253\077\000\000"
+ "\322\345\000\000\253\077\000\000N\356\000\000\221A\000\000\263\345\000\000"
+ "\264F\000\000\361\356\000\000TE\000\000\037\345\000\000\354D\000\000(\356"
+ "\000\000\3009\000\000\010\346\000\000/G\000\000I\342\000\000\2357\000\000"
+ "\313\346\000\000\232:\000\000\323\345\000\000\304F\000\000\337\356\000\000"
+ "\243H\000\000G\342\000\000DI\000\000\253\342\000\000\015J\000\000G\344\000"
+ "\000,M\000\000/\344\000\000\261W\000\000]\344\000\000\013R\000\000`\344\000"
+ "\000\235M\000\000\345\344\000\000\224Q\000\000~\344\000\000zN\000\000\230"
+ "\345\000\000;O\000\000\317\345\000\000\262O\000\000\272\345\000\000\356T"
+ "\000\000A\345\000\000\313S\000\000}\006\000\000mP\000\000\304\002\000\000"
+ "zO\000\000\270\003\000\000\230R\000\000\001\004\000\000\177S\000\000\227"
+ "\377\000\000\240Q\000\000_\376\000\000CQ\000\000\337\377\000\000\007S\000"
+ "\000H\375\000\000\276M\000\000\267\316\000\000\244_\000\000\366\317\000\000"
+ "\033e\000\000\203\342\000\000)\177\000\000\234\314\000\000\221j\000\000O"
+ "\343\000\000\224^\000\000%\344\000\000Za\000\000\017\343\000\000\351a\000"
+ "\000\353\342\000\000\215h\000\000R\345\000\000\235v\000\000\364\343\000\000"
+ "\307w\000\000&\344\000\000\006y\000\000*\344\000\000ay\000\000N\344\000\000"
+ "\262|\000\000Z\346\000\000]}\000\000m\346\000\000\377\177\000\000\312\345"
+ "\000\000\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\000\001\000\002\000\003\000\004\000\005\000"
+ "\004\000\003\000\006\000\006\000\003\000\007\000\006\000\007\000\010\000"
+ "\006\000\010\000\011\000\006\000\011\000\012\000\006\000\012\000\013\000"
+ "\006\000\013\000\001\000\006\000\001\000\014\000\015\000\001\000\013\000"
+ "\001\000\015\000\016\000\001\000\016\000\002\000\002\000\016\000\017\000"
+ "\002\000\017\000\020\000\020\000\017\000\021\000\020\000\021\000\022\000"
+ "\020\000\022\000\023\000\002\000\020\000\024\000\002\000\024\000\025\000"
+ "\002\000\025\000\026\000\002\000\026\000\027\000\027\000\026\000\030\000"
+ "\027\000\030\000\031\000\027\000\031\000\032\000\033\000\034\000\024\000"
+ "\034\000\033\000\035\000\035\000\033\000\036\000\024\000\034\000\025\000"
+ "\035\000\036\000\037\000\037\000\036\000 \000!\000\026\000\042\000\026\000"
+ "!\000\030\000#\000$\000%\000$\000#\000&\000$\000&\000'\000(\000)\000*\000"
+ ")\000(\000+\000)\000+\000,\000)\000,\000-\000.\000/\0000\000/\000.\0001\000"
+ "2\0003\0004\0003\0002\0005\0005\0002\0006\0006\0002\0007\0006\0007\0008\000"
+ "9\000:\000;\000:\0009\000<\000<\0009\000=\000<\000=\000>\000>\000=\000\077"
+ "\000\077\000=\000@\000A\000B\000C\000B\000A\000@\000B\000@\000=\000B\000"
+ "=\000D\000D\000=\000E\000B\000D\000F\000B\000F\000G\000G\000F\000H\000G\000"
+ "H\000I\000I\000H\000J\000K\000L\000M\000L\000K\000N\000L\000N\000O\000O\000"
+ "N\000P\000O\000P\000Q\000O\000Q\000R\000O\000R\000S\000S\000R\000T\000T\000"
+ "R\000U\000V\000W\000X\000W\000V\000Y\000Y\000V\000Z\000Y\000Z\000[\000[\000"
+ "Z\000\134\000\134\000]\000^\000]\000\134\000_\000_\000\134\000`\000]\000"
+ "_\000a\000/\000b\000\000\000b\000/\000^\000c\000\000\000\002\000\000\000"
+ "c\000%\000\000\000%\000$\000\000\000$\000*\000\000\000*\000)\000\000\000"
+ ")\000/\000/\000)\0000\000d\000^\000/\000^\000d\000e\000^\000e\000f\000^\000"
+ "f\0008\000^\0008\0007\000^\0007\000C\000^\000C\000B\000^\000B\000M\000^\000"
+ "M\000L\000^\000L\000g\000^\000g\000[\000^\000[\000\134\000h\000i\000j\000"
+ "i\000h\000k\000k\000h\000l\000l\000h\000m\000n\000h\000o\000h\000n\000p\000"
+ "q\000r\000s\000r\000q\000t\000t\000q\000u\000t\000u\000v\000t\000v\000w\000"
+ "m\000U\000R\000U\000m\000h\000U\000h\000x\000x\000h\000p\000x\000p\000y\000"
+ "x\000y\000s\000x\000s\000r\000x\000r\000z\000{\000|\000}\000|\000{\000l\000"
+ "|\000l\000~\000~\000l\000m\000\177\000\200\000\201\000\200\000\177\000\202"
+ "\000\202\000\177\000\203\000\202\000\203\000\204\000\202\000\204\000\205"
+ "\000\205\000\204\000\206\000\206\000\204\000\207\000\206\000\207\000\210"
+ "\000\211\000\212\000\213\000\212\000\211\000\214\000\212\000b\000\213\000"
+ "b\000\212\000\215\000\215\000\212\000\216\000\215\000\216\000\217\000\215"
+ "\000\217\000\220\000\215\000\220\000\221\000\215\000\221\000\222\000\223"
+ "\000b\000^\000b\000\223\000\224\000b\000\224\000\201\000b\000\201\000\200"
+ "\000b\000\200\000\225\000b\000\225\000\226\000b\000\226\000\213\000\227\000"
+ "\215\000\222\000\215\000\227\000\230\000\230\000\227\000\231\000\232\000"
+ "\233\000\234\000\235\000\236\000\237\000\240\000\227\000\222\000\227\000"
+ "\240\000\241\000\227\000\241\000\242\000\242\000\241\000\243\000\227\000"
+ "\242\000\233\000\227\000\233\000\244\000\244\000\233\000\245\000\245\000"
+ "\233\000\232\000\227\000\244\000\246\000\246\000\244\000\247\000\227\000"
+ "\246\000\250\000\227\000\250\000\236\000\227\000\236\000\235\000\227\000"
+ "\235\000\251\000\252\000\253\000\254\000\253\000\252\000\255\000\256\000"
+ "\257\000\260\000\231\000\261\000\262\000\261\000\231\000\263\000\262\000"
+ "\261\000\264\000\262\000\264\000\253\000\262\000\253\000\255\000\262\000"
+ "\255\000\257\000\262\000\257\000\256\000\262\000\256\000\265\000\230\000"
+ "\231\000\262\000\266\000\230\000\262\000\230\000\266\000\267\000\230\000"
+ "\267\000\270\000\230\000\270\000\271\000\230\000\271\000\272\000\272\000"
+ "\271\000\273\000\273\000\271\000\274\000\273\000\274\000\275\000\275\000"
+ "\274\000\276\000\275\000\276\000\277\000\275\000\277\000\300\000\272\000"
+ "\273\000\301\000\302\000\303\000\304\000\303\000\302\000\305\000\305\000"
+ "\302\000\306\000\306\000\307\000\310\000\307\000\306\000\311\000\311\000"
+ "\306\000\301\000\301\000\306\000\302\000\301\000\302\000\272\000\272\000"
+ "\312\000\230\000\312\000\272\000\313\000\314\000\315\000\313\000\315\000"
+ "\314\000\316\000\317\000\313\000\272\000\313\000\317\000\320\000\313\000"
+ "\320\000\321\000\313\000\321\000\314\000\316\000\314\000\322\000\323\000"
+ "\315\000\316\000\315\000\323\000\324\000\315\000\324\000\325\000\315\000"
+ "\325\000\326\000\315\000\326\000\327\000\330\000\315\000\327\000\315\000"
+ "\330\000\331\000\000\000\001\000\001\000\002\000\000\000\002\000\003\000"
+ "\004\000\004\000\005\000\003\000\005\000\003\000\006\000\004\000\006\000"
+ "\003\000\007\000\006\000\007\000\007\000\010\000\006\000\010\000\010\000"
+ "\011\000\006\000\011\000\011\000\012\000\006\000\012\000\012\000\013\000"
+ "\006\000\013\000\001\000\013\000\001\000\006\000\001\000\014\000\006\000"
+ "\014\000\001\000\015\000\013\000\015\000\015\000\016\000\001\000\016\000"
+ "\002\000\016\000\016\000\017\000\002\000\017\000\017\000\020\000\002\000"
+ "\020\000\017\000\021\000\020\000\021\000\021\000\022\000\020\000\022\000"
+ "\022\000\023\000\020\000\023\000\020\000\024\000\002\000\024\000\024\000"
+ "\025\000\002\000\025\000\025\000\026\000\002\000\026\000\026\000\027\000"
+ "\002\000\027\000\026\000\030\000\027\000\030\000\030\000\031\000\027\000"
+ "\031\000\031\000\032\000\027\000\032\000\033\000\034\000\024\000\034\000"
+ "\024\000\033\000\033\000\035\000\034\000\035\000\033\000\036\000\035\000"
+ "\036\000\025\000\034\000\036\000\037\000\035\000\037\000\036\000 \000\037"
+ "\000 \000\026\000!\000\026\000\042\000!\000\042\000\030\000!\000#\000$\000"
+ "$\000%\000#\000%\000#\000&\000$\000&\000&\000'\000$\000'\000(\000)\000)\000"
+ "*\000(\000*\000(\000+\000)\000+\000+\000,\000)\000,\000,\000-\000)\000-\000"
+ ".\000/\000/\0000\000.\0000\000.\0001\000/\0001\0002\0003\0003\0004\0002\000"
+ "4\0002\0005\0003\0005\0002\0006\0005\0006\0002\0007\0006\0007\0007\0008\000"
+ "6\0008\0009\000:\000:\000;\0009\000;\0009\000<\000:\000<\0009\000=\000<\000"
+ "=\000=\000>\000<\000>\000=\000\077\000>\000\077\000=\000@\000\077\000@\000"
+ "A\000B\000B\000C\000A\000C\000@\000A\000@\000B\000=\000B\000=\000D\000B\000"
+ "D\000=\000E\000D\000E\000D\000F\000B\000F\000F\000G\000B\000G\000F\000H\000"
+ "G\000H\000H\000I\000G\000I\000H\000J\000I\000J\000K\000L\000L\000M\000K\000"
+ "M\000K\000N\000L\000N\000N\000O\000L\000O\000N\000P\000O\000P\000P\000Q\000"
+ "O\000Q\000Q\000R\000O\000R\000R\000S\000O\000S\000R\000T\000S\000T\000R\000"
+ "U\000T\000U\000V\000W\000W\000X\000V\000X\000V\000Y\000W\000Y\000V\000Z\000"
+ "Y\000Z\000Z\000[\000Y\000[\000Z\000\134\000[\000\134\000\134\000]\000]\000"
+ "^\000\134\000^\000\134\000_\000]\000_\000\134\000`\000_\000`\000_\000a\000"
+ "]\000a\000/\000b\000\000\000b\000\000\000/\000/\000^\000^\000b\000\000\000"
+ "c\000\002\000c\000%\000c\000\000\000%\000\000\000$\000$\000*\000\000\000"
+ "*\000\000\000)\000)\000/\000)\0000\000^\000d\000/\000d\000d\000e\000^\000"
+ "e\000e\000f\000^\000f\0008\000f\0008\000^\0007\000^\0007\000C\000C\000^\000"
+ "B\000^\000B\000M\000M\000^\000L\000^\000L\000g\000^\000g\000[\000g\000[\000"
+ "^\000h\000i\000i\000j\000h\000j\000h\000k\000i\000k\000h\000l\000k\000l\000"
+ "h\000m\000l\000m\000h\000n\000h\000o\000n\000o\000n\000p\000h\000p\000q\000"
+ "r\000r\000s\000q\000s\000q\000t\000r\000t\000q\000u\000t\000u\000u\000v\000"
+ "t\000v\000v\000w\000t\000w\000U\000m\000R\000m\000U\000h\000h\000x\000U\000"
+ "x\000p\000x\000p\000y\000x\000y\000s\000y\000s\000x\000r\000x\000r\000z\000"
+ "x\000z\000{\000|\000|\000}\000{\000}\000l\000{\000l\000|\000l\000~\000|\000"
+ "~\000m\000~\000\177\000\200\000\200\000\201\000\177\000\201\000\177\000\202"
+ "\000\200\000\202\000\177\000\203\000\202\000\203\000\203\000\204\000\202"
+ "\000\204\000\204\000\205\000\202\000\205\000\204\000\206\000\205\000\206"
+ "\000\204\000\207\000\206\000\207\000\207\000\210\000\206\000\210\000\211"
+ "\000\212\000\212\000\213\000\211\000\213\000\211\000\214\000\212\000\214"
+ "\000b\000\212\000b\000\213\000\212\000\215\000b\000\215\000\212\000\216\000"
+ "\215\000\216\000\216\000\217\000\215\000\217\000\217\000\220\000\215\000"
+ "\220\000\220\000\221\000\215\000\221\000\221\000\222\000\215\000\222\000"
+ "b\000\223\000^\000\223\000\223\000\224\000b\000\224\000\201\000\224\000b"
+ "\000\201\000b\000\200\000\200\000\225\000b\000\225\000\225\000\226\000b\000"
+ "\226\000\213\000\226\000\215\000\227\000\222\000\227\000\227\000\230\000"
+ "\215\000\230\000\227\000\231\000\230\000\231\000\232\000\233\000\233\000"
+ "\234\000\232\000\234\000\235\000\236\000\236\000\237\000\235\000\237\000"
+ "\227\000\240\000\222\000\240\000\240\000\241\000\227\000\241\000\241\000"
+ "\242\000\227\000\242\000\241\000\243\000\242\000\243\000\233\000\242\000"
+ "\227\000\233\000\233\000\244\000\227\000\244\000\233\000\245\000\244\000"
+ "\245\000\232\000\245\000\244\000\246\000\227\000\246\000\244\000\247\000"
+ "\246\000\247\000\246\000\250\000\227\000\250\000\236\000\250\000\227\000"
+ "\236\000\227\000\235\000\235\000\251\000\227\000\251\000\252\000\253\000"
+ "\253\000\254\000\252\000\254\000\252\000\255\000\253\000\255\000\256\000"
+ "\257\000\257\000\260\000\256\000\260\000\231\000\261\000\261\000\262\000"
+ "\231\000\262\000\231\000\263\000\261\000\263\000\261\000\264\000\262\000"
+ "\264\000\253\000\264\000\253\000\262\000\255\000\262\000\255\000\257\000"
+ "\257\000\262\000\256\000\262\000\256\000\265\000\262\000\265\000\230\000"
+ "\262\000\230\000\266\000\262\000\266\000\266\000\267\000\230\000\267\000"
+ "\267\000\270\000\230\000\270\000\270\000\271\000\230\000\271\000\271\000"
+ "\272\000\230\000\272\000\271\000\273\000\272\000\273\000\271\000\274\000"
+ "\273\000\274\000\274\000\275\000\273\000\275\000\274\000\276\000\275\000"
+ "\276\000\276\000\277\000\275\000\277\000\277\000\300\000\275\000\300\000"
+ "\273\000\301\000\272\000\301\000\302\000\303\000\303\000\304\000\302\000"
+ "\304\000\302\000\305\000\303\000\305\000\302\000\306\000\305\000\306\000"
+ "\306\000\307\000\307\000\310\000\306\000\310\000\306\000\311\000\307\000"
+ "\311\000\301\000\306\000\301\000\311\000\301\000\302\000\272\000\302\000"
+ "\272\000\312\000\230\000\312\000\272\000\313\000\312\000\313\000\314\000"
+ "\315\000\313\000\315\000\313\000\314\000\314\000\316\000\315\000\316\000"
+ "\313\000\317\000\272\000\317\000\317\000\320\000\313\000\320\000\320\000"
+ "\321\000\313\000\321\000\314\000\321\000\314\000\322\000\316\000\322\000"
+ "\315\000\323\000\316\000\323\000\323\000\324\000\315\000\324\000\324\000"
+ "\325\000\315\000\325\000\325\000\326\000\315\000\326\000\326\000\327\000"
+ "\315\000\327\000\315\000\330\000\327\000\330\000\330\000\331\000\315\000"
+ "\331\000j\200\000\0002\365\000\000p\200\000\000\027\363\000\000\001\200\000"
+ "\000\304\363\000\000\006\201\000\000|\365\000\000p\201\000\000\023\363\000"
+ "\000\244\205\000\000\200\365\000\000\374\201\000\000\271\362\000\000\365"
+ "\203\000\000\204\357\000\000\025\206\000\000\372\351\000\000;\207\000\000"
+ "\255\366\000\000\303\206\000\000\013\346\000\000\325\206\000\000\251\343"
+ "\000\0003\207\000\0007\341\000\000C\212\000\000\177\365\000\000\311\207\000"
+ "\000o\367\000\000=\211\000\000m\366\000\000\000\211\000\000\342\367\000\000"
+ "7\211\000\000\240\367\000\000\027\311\000\000g\032\000\000\021\311\000\000"
+ "\265\011\000\000\077\310\000\000\255\011\000\000\333\311\000\000q\032\000"
+ "\000\216\311\000\000\327\032\000\000\274\307\000\000\260\007\000\000\022"
+ "\311\000\000~\010\000\000s\307\000\000\033\006\000\000'\210\000\000\304\337"
+ "\000\000\315\214\000\000p\334\000\000H\217\000\000~\365\000\000\250\216\000"
+ "\0003\332\000\000\376\216\000\000\333\325\000\000\203\217\000\000\336\325"
+ "\000\000'\221\000\000\042\365\000\000\375\220\000\0004\326\000\000\077\225"
+ "\000\000\310\365\000\000\201\224\000\000\252\365\000\000\042\222\000\000"
+ "\247\365\000\000\254\215\000\000\310\327\000\000t\215\000\000\374\326\000"
+ "\000\022\216\000\000\313\327\000\000%\225\000\000V\325\000\000E\230\000\000"
+ "%\324\000\000.\226\000\000k\367\000\000c\227\000\000\353\367\000\000\242"
+ "\231\000\000\350\367\000\000\242\231\000\000\346\365\000\000\351\232\000"
+ "\000\305\323\000\000\243\233\000\000\346\365\000\000m\246\000\000\365\322"
+ "\000\0008\234\000\000\352\365\000\000\302\236\000\000S\366\000\000\240\241"
+ "\000\000\363\365\000\000\274\243\000\000!\367\000\000\022\244\000\000}\367"
+ "\000\000%\246\000\000\234\366\000\000Y\246\000\000O\366\000\000\301\246\000"
+ "\000\275\366\000\000\361\246\000\000\306\322\000\000\351\252\000\000\365"
+ "\322\000\000#\263\000\000\363\322\000\000G\267\000\000\312\322\000\000\236"
+ "\251\000\000\271\322\000\000\355\246\000\000y\370\000\000t\247\000\000\340"
+ "\371\000\000\042\252\000\000\224\375\000\000\214\253\000\000Y\376\000\000"
+ "\221\260\000\000W\376\000\000\263\261\000\000}\376\000\000\034\266\000\000"
+ "\013\376\000\000\010\267\000\000X\376\000\000\206\271\000\000\013\376\000"
+ "\000k\273\000\000\241\322\000\000\237\300\000\000\215\322\000\000\341\305"
+ "\000\000*\322\000\000\361\271\000\000A\376\000\000\215\275\000\000\255\000"
+ "\000\000\244\300\000\000\373\001\000\000j\327\000\000\356\323\000\000\252"
+ "\323\000\000G\323\000\000\363\317\000\000\217\322\000\000\255\304\000\000"
+ "h\002\000\000,\306\000\000\322\003\000\000I\307\000\000\231\005\000\000\001"
+ "\345\000\000\001\327\000\000*\333\000\000\225\324\000\000\317\311\000\000"
+ "\360\010\000\000\300\313\000\000\210\011\000\000\004\320\000\000-\011\000"
+ "\000\322\320\000\000+\011\000\000\301\323\000\000^\012\000\000W\331\000\000"
+ ">\017\000\000\233\332\000\000\230\017\000\000\241\340\000\000\235\017\000"
+ "\000\077\343\000\000\235\017\000\000\223\343\000\000w\017\000\000\242\343"
+ "\000\000r\017\000\000\262\366\000\000X\327\000\000\331\360\000\000\374\326"
+ "\000\000\013\362\000\000\001\327\000\000#\341\000\000\374\017\000\000M\342"
+ "\000\000\013\020\000\000\232\341\000\000<\023\000\000\020\342\000\000E\022"
+ "\000\000\367\341\000\000F\025\000\000\134\342\000\000\353\027\000\000\306"
+ "\342\000\000\226\026\000\000\243\343\000\0009\036\000\000\000\346\000\000"
+ "\027\042\000\000f\345\000\000O#\000\000Z\346\000\000\300(\000\000`\346\000"
+ "\000\207#\000\000`\346\000\000\355)\000\000\255\346\000\000\006%\000\000"
+ "\317\346\000\000a-\000\000\312\346\000\000\367%\000\000\374\346\000\000\343"
+ "&\000\000C\347\000\000\370-\000\000\016\347\000\000f'\000\0005\347\000\000"
+ "f'\000\000\203\347\000\000(*\000\000\314\347\000\000\026.\000\000\372\347"
+ "\000\000/-\000\000\373\347\000\000\310-\000\000\016\347\000\000\302&\000"
+ "\000A\361\000\000Q\013\000\0009\375\000\000p\021\000\000=\361\000\000M\006"
+ "\000\000\371\362\000\000n\016\000\000F\364\000\000\245\017\000\000T\373\000"
+ "\0009\021\000\000\232\366\000\000\325\020\000\000\315\370\000\000_\021\000"
+ "\000\223\343\000\000\235\017\000\000\361\347\000\000\203'\000\000\231\347"
+ "\000\000\227%\000\000\231\347\000\000f'\000\000\223\347\000\000s$\000\000"
+ "\220\347\000\000\227%\000\000\002\350\000\000\316 \000\000]\350\000\000\350"
+ "&\000\000\316\350\000\000\355\033\000\000\327\350\000\000\333\042\000\000"
+ ".\351\000\000|\032\000\000\203\351\000\000#\037\000\000\033\352\000\000\002"
+ "\027\000\000\227\351\000\000\304\036\000\000\003\352\000\000\205\032\000"
+ "\000\013\352\000\000m\031\000\000\020\352\000\000o\031\000\0009\360\000\000"
+ "\221\007\000\000\325\356\000\000L\011\000\000Q\360\000\000\243\004\000\000"
+ "|\345\000\000\310\016\000\000\301\350\000\000\002\015\000\000\350\350\000"
+ "\000y\014\000\0003\351\000\000\371\014\000\000\231\351\000\0008\016\000\000"
+ "a\352\000\000\241\014\000\000Z\352\000\000\240\015\000\0001\353\000\000\212"
+ "\012\000\000>\367\000\000\217\324\000\000i\370\000\000[\323\000\000\224\374"
+ "\000\000I\322\000\000#\377\000\000\352\321\000\000k\000\000\000)\322\000"
+ "\000J\007\000\000~\322\000\000\030\015\000\000\210\322\000\000N\004\000\000"
+ "1\031\000\000!\004\000\000\334\025\000\000\027\004\000\000\215\034\000\000"
+ "E\377\000\000\370\023\000\000\037\000\000\000\324\026\000\0004\001\000\000"
+ "\232\034\000\000R\001\000\000^\036\000\000.\002\000\000;\037\000\000\353"
+ "\002\000\000\340\036\000\000\323\004\000\000\326\024\000\000\017\011\000"
+ "\000\377\021\000\000P\013\000\000%\016\000\000_\013\000\000a\015\000\000"
+ "\272\014\000\000^\014\000\000\364\022\000\000\365\322\000\000\375\027\000"
+ "\000*\323\000\000b\020\000\000\304\014\000\000\224\020\000\000+\012\000\000"
+ "\216\020\000\000\375\010\000\000\352\020\000\000r\014\000\000\262\025\000"
+ "\000\242\014\000\000m\025\000\000\221\006\000\000-\025\000\000\306\014\000"
+ "\000\014\026\000\000\247\007\000\000B\027\000\000x\011\000\000.\027\000\000"
+ "1\011\000\000b\022\000\000\312\012\000\000\323!\000\000c\324\000\000\007"
+ "\035\000\000^\323\000\000\232\035\000\000h\323\000\000W\042\000\000\031\015"
+ "\000\000B \000\000\221\005\000\000\303\037\000\000\025\014\000\000\224!\000"
+ "\000\322\006\000\000 #\000\000X\010\000\000\300\042\000\000\325\014\000\000"
+ "\300#\000\000\334\012\000\000\203\026\000\000]\006\000\000b\032\000\0001"
+ "\007\000\000\204\035\000\000\323\011\000\000\231 \000\000\354\002\000\000"
+ "\363 \000\000_\002\000\000\236'\000\000\266\323\000\000+/\000\000\227\322"
+ "\000\000\337-\000\000S\004\000\000;,\000\000\375\001\000\0004,\000\000$\002"
+ "\000\000w-\000\000\342\001\000\0001$\000\000\366\001\000\000n'\000\000\362"
+ "\001\000\000()\000\0009\001\000\000\374)\000\000z\001\000\000\303+\000\000"
+ "\220\001\000\000\305-\000\000\257\001\000\000\3400\000\000\356\001\000\000"
+ "\2351\000\000\365\322\000\000\0146\000\000\277\000\000\000\3427\000\000M"
+ "\323\000\000\362A\000\000\314\323\000\000\343<\000\000Y\323\000\000})\000"
+ "\000o\017\000\000\004)\000\000\317\012\000\000\327'\000\000\351\013\000\000"
+ "t*\000\000@\017\000\000\023+\000\000\256\020\000\000v'\000\000\244\004\000"
+ "\000\012)\000\000-\002\000\000\352-\000\000j\012\000\000\223+\000\000\373"
+ "\005\000\000e+\000\000<\010\000\000i.\000\000\030\005\000\000\240.\000\000"
+ "3\013\000\000{/\000\000\342\007\000\000\331/\000\000\270\020\000\000\330"
+ "/\000\000V\014\000\000\0141\000\000t\020\000\000\2630\000\0002\021\000\000"
+ "o2\000\000\272\006\000\000\3461\000\000\374\004\000\000\3441\000\000\363"
+ "\005\000\000B2\000\000P\003\000\00085\000\000\320\010\000\000\0305\000\000"
+ "!\002\000\000\3433\000\000\356\006\000\000v5\000\000\221\002\000\000\026"
+ "7\000\000;\010\000\000w6\000\000X\004\000\000\2637\000\000=\007\000\000`"
+ "3\000\000%\005\000\000\0153\000\000\016\006\000\000\014:\000\000\323\010"
+ "\000\000\0269\000\000\247\010\000\000\2618\000\000'\011\000\000S9\000\000"
+ "\363\007\000\000\2249\000\000\202\005\000\000\3326\000\000\276\000\000\000"
+ "\2658\000\000B\002\000\000\223;\000\000\227\010\000\000Y>\000\0000\011\000"
+ "\000dA\000\000\243\011\000\000;D\000\000z\012\000\000WE\000\000\325\323\000"
+ "\000\263D\000\000\303\012\000\000&G\000\0003\013\000\000iG\000\000\024\325"
+ "\000\000rH\000\000v\012\000\000dN\000\000.\001\000\000\272K\000\000\016\006"
+ "\000\000\037K\000\000\306\007\000\000\216K\000\000\370\006\000\000\353L\000"
+ "\000\224\005\000\000PN\000\000\211\005\000\000\340N\000\000\224\004\000\000"
+ "\304N\000\000\323\002\000\000\3751\000\000\177\022\000\000\2511\000\000\011"
+ "\022\000\000|1\000\000\211\022\000\000\2123\000\000n\017\000\000Z2\000\000"
+ "k\022\000\000\0334\000\000\340\021\000\000\3463\000\0001\016\000\000\343"
+ "5\000\000\241\012\000\000\2534\000\000\356\017\000\000\2245\000\000}\014"
+ "\000\000\2137\000\000\210\012\000\000\217H\000\000\004\325\000\000lL\000"
+ "\000(\324\000\000\025R\000\000\177\324\000\000\326P\000\000\306\377\000\000"
+ "\267d\000\000\222\326\000\000)`\000\000\375\324\000\000\005d\000\000T\326"
+ "\000\000\314b\000\000i\325\000\000\327`\000\000\377\003\000\000+a\000\000"
+ "\360\377\000\000\006`\000\000Q\000\000\000Ha\000\000r\006\000\000\257a\000"
+ "\000\220\003\000\000\377a\000\000b\007\000\000^o\000\000\211\377\000\000"
+ "\012{\000\000\254\333\000\000c}\000\000k\352\000\000\344{\000\000\271\335"
+ "\000\000$}\000\000\235\346\000\000\364|\000\000\264\341\000\000\256}\000"
+ "\000\003\352\000\000l}\000\000\353\342\000\000;}\000\000\077\346\000\000"
+ "\244T\000\000C\001\000\000\355U\000\000\212\001\000\000\360Y\000\000\215"
+ "\001\000\000\370]\000\000\234\000\000\000\201_\000\000\366\377\000\000\225"
+ "c\000\000\352\377\000\000Cn\000\000\212\377\000\000\311}\000\000\241\364"
+ "\000\000Q}\000\000\265\353\000\000\360z\000\000\354\367\000\0000~\000\000"
+ "\360\355\000\000m\177\000\000\201\363\000\000\335\177\000\000\262\360\000"
+ "\000\377\177\000\000p\363\000\000~j\000\000X\004\000\000\032j\000\000p\002"
+ "\000\000\032j\000\000\326\003\000\000\206j\000\000\366\001\000\000^m\000"
+ "\000/\005\000\000\301k\000\000\222\001\000\000\373q\000\000(\005\000\000"
+ "\014u\000\000\327\004\000\000}v\000\000\260\003\000\000Ry\000\000&\373\000"
+ "\000'y\000\000\351\375\000\000 y\000\000\300\376\000\000/z\000\000\255\370"
+ "\000\000.j\000\000\352\326\000\000\230p\000\000\370\326\000\000\016w\000"
+ "\000f\327\000\000By\000\000e\327\000\000\077{\000\000\005\332\000\000\300"
+ "{\000\000\240\327\000\000\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177"
+ "\000\000\001\000\002\000\001\000\000\000\003\000\001\000\003\000\004\000"
+ "\004\000\003\000\005\000\004\000\005\000\006\000\006\000\005\000\007\000"
+ "\007\000\005\000\010\000\010\000\005\000\011\000\010\000\011\000\012\000"
+ "\012\000\011\000\013\000\013\000\011\000\014\000\014\000\011\000\015\000"
+ "\015\000\011\000\016\000\015\000\016\000\017\000\017\000\016\000\020\000"
+ "\017\000\020\000\021\000\022\000\023\000\024\000\023\000\022\000\025\000"
+ "\025\000\022\000\026\000\027\000\030\000\031\000\030\000\027\000\024\000"
+ "\030\000\024\000\023\000\015\000\032\000\014\000\032\000\015\000\033\000"
+ "\033\000\015\000\034\000\033\000\034\000\035\000\035\000\034\000\036\000"
+ "\036\000\034\000\037\000\037\000\034\000 \000\037\000 \000!\000!\000 \000"
+ "\042\000\042\000 \000#\000#\000 \000$\000%\000\036\000&\000\036\000%\000"
+ "'\000\036\000'\000\035\000\042\000(\000!\000(\000\042\000)\000)\000\042\000"
+ "*\000)\000*\000+\000)\000+\000,\000)\000,\000-\000)\000-\000.\000.\000-\000"
+ "/\000.\000/\0000\0000\000/\0001\0000\0001\0002\0000\0002\0003\0004\0000\000"
+ "3\0000\0004\0005\0000\0005\0006\0000\0006\0007\0000\0007\0008\0000\0008\000"
+ "9\0009\0008\000:\000:\0008\000;\000;\0008\000<\0009\000:\000=\000>\000<\000"
+ "8\000<\000>\000\077\000<\000\077\000@\000<\000@\000A\000<\000A\000B\000<"
+ "\000B\000C\000<\000C\000D\000<\000D\000E\000<\000E\000F\000<\000F\000G\000"
+ "G\000F\000H\000H\000F\000I\000J\000I\000F\000I\000J\000K\000I\000K\000L\000"
+ "I\000L\000M\000I\000M\000N\000I\000N\000O\000P\000M\000L\000M\000P\000Q\000"
+ "M\000Q\000R\000M\000R\000\031\000M\000\031\000\030\000M\000\030\000S\000"
+ "M\000S\000T\000U\000S\000\030\000S\000U\000V\000S\000V\000W\000S\000W\000"
+ "X\000S\000X\000Y\000S\000Y\000Z\000S\000Z\000[\000S\000[\000\134\000S\000"
+ "\134\000]\000S\000]\000^\000S\000^\000_\000S\000_\000`\000S\000`\000a\000"
+ "a\000`\000b\000c\000]\000\134\000]\000c\000d\000d\000c\000e\000d\000e\000"
+ "f\000f\000e\000g\000h\000f\000g\000f\000h\000i\000i\000h\000j\000i\000j\000"
+ "k\000k\000j\000l\000k\000l\000m\000k\000m\000n\000n\000m\000o\000n\000o\000"
+ "p\000p\000o\000q\000p\000q\000r\000r\000q\000s\000s\000q\000t\000s\000t\000"
+ "u\000u\000t\000v\000v\000t\000w\000w\000t\000x\000w\000x\000y\000y\000x\000"
+ "z\000{\000s\000u\000|\000}\000~\000}\000|\000\177\000}\000\177\000\200\000"
+ "}\000\200\000\201\000\201\000\200\000\202\000\201\000\202\000\203\000\204"
+ "\000^\000]\000^\000\204\000_\000\205\000\206\000\207\000\206\000\210\000"
+ "\211\000\210\000\206\000\212\000\212\000\206\000\205\000\212\000\205\000"
+ "\213\000\212\000\213\000\214\000\214\000\213\000\215\000\214\000\215\000"
+ "\216\000\216\000\215\000\217\000\216\000\217\000\220\000\220\000\217\000"
+ "\221\000\220\000\221\000\222\000\220\000\222\000\223\000\220\000\223\000"
+ "\224\000\220\000\224\000\225\000\220\000\225\000\226\000\226\000\225\000"
+ "\227\000\227\000\225\000~\000\230\000`\000_\000`\000\230\000\231\000`\000"
+ "\231\000\232\000`\000\232\000\233\000`\000\233\000\234\000`\000\234\000\235"
+ "\000\235\000\234\000\236\000`\000\235\000\237\000`\000\237\000\227\000`\000"
+ "\227\000~\000`\000~\000}\000`\000}\000\240\000\240\000}\000\241\000\241\000"
+ "}\000\242\000\242\000}\000\243\000\243\000}\000\244\000\244\000}\000\245"
+ "\000\245\000}\000\246\000\247\000\250\000\251\000\252\000\246\000}\000\246"
+ "\000\252\000\253\000\246\000\253\000\254\000\246\000\254\000\255\000\246"
+ "\000\255\000\256\000\246\000\256\000\257\000\246\000\257\000\250\000\250"
+ "\000\257\000\251\000\246\000\250\000\260\000\246\000\260\000\261\000\246"
+ "\000\261\000\262\000\246\000\262\000\263\000\246\000\263\000\264\000\246"
+ "\000\264\000\265\000\265\000\264\000\266\000\267\000\270\000\271\000\270"
+ "\000\267\000\272\000\273\000\274\000\275\000\274\000\273\000\276\000\276"
+ "\000\273\000\277\000\276\000\277\000\300\000\264\000\271\000\266\000\271"
+ "\000\264\000\267\000\266\000\271\000\301\000\266\000\301\000\274\000\274"
+ "\000\301\000\275\000\266\000\274\000\302\000\266\000\302\000\303\000\303"
+ "\000\302\000\304\000\305\000\306\000\307\000\306\000\305\000\310\000\310"
+ "\000\305\000\311\000\311\000\305\000\312\000\311\000\312\000\313\000\314"
+ "\000\302\000\274\000\302\000\314\000\315\000\302\000\315\000\316\000\302"
+ "\000\316\000\307\000\302\000\307\000\306\000\302\000\306\000\317\000\302"
+ "\000\317\000\320\000\302\000\320\000\321\000\321\000\320\000\322\000\323"
+ "\000\324\000\325\000\324\000\323\000\326\000\327\000\322\000\320\000\322"
+ "\000\327\000\330\000\322\000\330\000\331\000\322\000\331\000\332\000\322"
+ "\000\332\000\333\000\322\000\333\000\324\000\322\000\324\000\326\000\322"
+ "\000\326\000\334\000\322\000\334\000\335\000\322\000\335\000\336\000\336"
+ "\000\335\000\337\000\336\000\337\000\340\000\340\000\337\000\341\000\340"
+ "\000\341\000\342\000\343\000\344\000\345\000\344\000\343\000\346\000\346"
+ "\000\343\000\347\000\350\000\331\000\330\000\331\000\350\000\345\000\331"
+ "\000\345\000\351\000\351\000\345\000\344\000\352\000\353\000\354\000\353"
+ "\000\352\000\325\000\325\000\352\000\323\000\323\000\352\000\355\000\355"
+ "\000\352\000\356\000\355\000\356\000\357\000\357\000\356\000\360\000\357"
+ "\000\360\000\361\000\361\000\360\000\362\000\362\000\360\000\363\000\324"
+ "\000\333\000\325\000\364\000\365\000\366\000\365\000\364\000\367\000\370"
+ "\000\371\000\372\000\371\000\370\000\373\000\373\000\370\000\374\000\373"
+ "\000\374\000\375\000\375\000\374\000\376\000\367\000\337\000\335\000\337"
+ "\000\367\000\371\000\371\000\367\000\364\000\371\000\364\000\377\000\377"
+ "\000\364\000\000\001\371\000\377\000\372\000\001\001\002\001\003\001\002"
+ "\001\001\001\004\001\004\001\001\001\005\001\006\001\341\000\337\000\341"
+ "\000\006\001\007\001\341\000\007\001\005\001\341\000\005\001\001\001\341"
+ "\000\001\001\010\001\341\000\010\001\011\001\341\000\011\001\012\001\341"
+ "\000\012\001\013\001\341\000\013\001\014\001\014\001\013\001\015\001\014"
+ "\001\015\001\016\001\014\001\016\001\017\001\017\001\016\001\020\001\017"
+ "\001\020\001\021\001\021\001\020\001\022\001\022\001\020\001\023\001\022"
+ "\001\023\001\024\001\021\001\022\001\025\001\021\001\025\001\026\001\021"
+ "\001\026\001\027\001\021\001\027\001\030\001\031\001\032\001\033\001\032"
+ "\001\031\001\034\001\034\001\031\001\035\001\034\001\035\001\036\001\034"
+ "\001\036\001\037\001\037\001\036\001 \001 \001\036\001!\001 \001!\001\042"
+ "\001 \001\042\001#\001 \001#\001\003\001\003\001#\001\001\001\021\001$\001"
+ "\017\001$\001\021\001%\001%\001\021\001&\001&\001\021\001'\001&\001'\001"
+ "(\001&\001(\001)\001)\001(\001*\001)\001*\001+\001,\001-\001.\001-\001,\001"
+ "/\001-\001/\0010\0010\001/\0011\0012\0013\001(\0013\0012\0014\0013\0014\001"
+ "5\0015\0014\0016\0015\0016\0017\0016\0014\0018\0016\0019\0017\0019\0016\001"
+ ":\001;\001(\001'\001(\001;\001<\001(\001<\001=\001(\001=\001>\001(\001>\001"
+ "\077\001(\001\077\001.\001(\001.\001-\001(\001-\001@\001(\001@\001A\001("
+ "\001A\0012\001B\001C\001D\001C\001B\001E\001E\001B\001F\001E\001F\001G\001"
+ "G\001F\001H\001I\001J\001K\001J\001I\001L\001L\001I\001M\001L\001M\001N\001"
+ "N\001M\0012\0012\001M\001O\0012\001O\0014\0014\001O\001P\0014\001P\001Q\001"
+ "4\001Q\001R\001R\001Q\001S\001S\001Q\001T\0014\001R\001U\0014\001U\001D\001"
+ "4\001D\001C\0013\001V\001(\001V\0013\001W\001W\0013\001X\001X\0013\001Y\001"
+ "Y\0013\001Z\001Y\001Z\001[\001\000\000\001\000\001\000\002\000\000\000\002"
+ "\000\000\000\003\000\001\000\003\000\003\000\004\000\001\000\004\000\003"
+ "\000\005\000\004\000\005\000\005\000\006\000\004\000\006\000\005\000\007"
+ "\000\006\000\007\000\005\000\010\000\007\000\010\000\005\000\011\000\010"
+ "\000\011\000\011\000\012\000\010\000\012\000\011\000\013\000\012\000\013"
+ "\000\011\000\014\000\013\000\014\000\011\000\015\000\014\000\015\000\011"
+ "\000\016\000\015\000\016\000\016\000\017\000\015\000\017\000\016\000\020"
+ "\000\017\000\020\000\020\000\021\000\017\000\021\000\022\000\023\000\023"
+ "\000\024\000\022\000\024\000\022\000\025\000\023\000\025\000\022\000\026"
+ "\000\025\000\026\000\027\000\030\000\030\000\031\000\027\000\031\000\024"
+ "\000\027\000\024\000\030\000\023\000\030\000\015\000\032\000\014\000\032"
+ "\000\015\000\033\000\032\000\033\000\015\000\034\000\033\000\034\000\034"
+ "\000\035\000\033\000\035\000\034\000\036\000\035\000\036\000\034\000\037"
+ "\000\036\000\037\000\034\000 \000\037\000 \000 \000!\000\037\000!\000 \000"
+ "\042\000!\000\042\000 \000#\000\042\000#\000 \000$\000#\000$\000\036\000"
+ "%\000\036\000&\000%\000&\000%\000'\000\036\000'\000\035\000'\000\042\000"
+ "(\000!\000(\000\042\000)\000(\000)\000\042\000*\000)\000*\000*\000+\000)"
+ "\000+\000+\000,\000)\000,\000,\000-\000)\000-\000-\000.\000)\000.\000-\000"
+ "/\000.\000/\000/\0000\000.\0000\000/\0001\0000\0001\0001\0002\0000\0002\000"
+ "2\0003\0000\0003\0000\0004\0003\0004\0004\0005\0000\0005\0005\0006\0000\000"
+ "6\0006\0007\0000\0007\0007\0008\0000\0008\0008\0009\0000\0009\0008\000:\000"
+ "9\000:\0008\000;\000:\000;\0008\000<\000;\000<\000:\000=\0009\000=\000<\000"
+ ">\0008\000>\000>\000\077\000<\000\077\000\077\000@\000<\000@\000@\000A\000"
+ "<\000A\000A\000B\000<\000B\000B\000C\000<\000C\000C\000D\000<\000D\000D\000"
+ "E\000<\000E\000E\000F\000<\000F\000F\000G\000<\000G\000F\000H\000G\000H\000"
+ "F\000I\000H\000I\000I\000J\000F\000J\000J\000K\000I\000K\000K\000L\000I\000"
+ "L\000L\000M\000I\000M\000M\000N\000I\000N\000N\000O\000I\000O\000M\000P\000"
+ "L\000P\000P\000Q\000M\000Q\000Q\000R\000M\000R\000\031\000R\000\031\000M"
+ "\000\030\000M\000\030\000S\000M\000S\000S\000T\000M\000T\000S\000U\000\030"
+ "\000U\000U\000V\000S\000V\000V\000W\000S\000W\000W\000X\000S\000X\000X\000"
+ "Y\000S\000Y\000Y\000Z\000S\000Z\000Z\000[\000S\000[\000[\000\134\000S\000"
+ "\134\000\134\000]\000S\000]\000]\000^\000S\000^\000^\000_\000S\000_\000_"
+ "\000`\000S\000`\000`\000a\000S\000a\000`\000b\000a\000b\000]\000c\000\134"
+ "\000c\000c\000d\000]\000d\000c\000e\000d\000e\000e\000f\000d\000f\000e\000"
+ "g\000f\000g\000f\000h\000g\000h\000h\000i\000f\000i\000h\000j\000i\000j\000"
+ "j\000k\000i\000k\000j\000l\000k\000l\000l\000m\000k\000m\000m\000n\000k\000"
+ "n\000m\000o\000n\000o\000o\000p\000n\000p\000o\000q\000p\000q\000q\000r\000"
+ "p\000r\000q\000s\000r\000s\000q\000t\000s\000t\000t\000u\000s\000u\000t\000"
+ "v\000u\000v\000t\000w\000v\000w\000t\000x\000w\000x\000x\000y\000w\000y\000"
+ "x\000z\000y\000z\000s\000{\000u\000{\000|\000}\000}\000~\000|\000~\000|\000"
+ "\177\000}\000\177\000\177\000\200\000}\000\200\000\200\000\201\000}\000\201"
+ "\000\200\000\202\000\201\000\202\000\202\000\203\000\201\000\203\000^\000"
+ "\204\000]\000\204\000_\000\204\000\205\000\206\000\206\000\207\000\205\000"
+ "\207\000\206\000\210\000\210\000\211\000\206\000\211\000\206\000\212\000"
+ "\210\000\212\000\205\000\212\000\205\000\213\000\212\000\213\000\213\000"
+ "\214\000\212\000\214\000\213\000\215\000\214\000\215\000\215\000\216\000"
+ "\214\000\216\000\215\000\217\000\216\000\217\000\217\000\220\000\216\000"
+ "\220\000\217\000\221\000\220\000\221\000\221\000\222\000\220\000\222\000"
+ "\222\000\223\000\220\000\223\000\223\000\224\000\220\000\224\000\224\000"
+ "\225\000\220\000\225\000\225\000\226\000\220\000\226\000\225\000\227\000"
+ "\226\000\227\000~\000\225\000~\000\227\000`\000\230\000_\000\230\000\230"
+ "\000\231\000`\000\231\000\231\000\232\000`\000\232\000\232\000\233\000`\000"
+ "\233\000\233\000\234\000`\000\234\000\234\000\235\000`\000\235\000\234\000"
+ "\236\000\235\000\236\000\235\000\237\000`\000\237\000\227\000\237\000`\000"
+ "\227\000`\000~\000`\000}\000}\000\240\000`\000\240\000}\000\241\000\240\000"
+ "\241\000}\000\242\000\241\000\242\000}\000\243\000\242\000\243\000}\000\244"
+ "\000\243\000\244\000}\000\245\000\244\000\245\000}\000\246\000\245\000\246"
+ "\000\247\000\250\000\250\000\251\000\247\000\251\000\246\000\252\000}\000"
+ "\252\000\252\000\253\000\246\000\253\000\253\000\254\000\246\000\254\000"
+ "\254\000\255\000\246\000\255\000\255\000\256\000\246\000\256\000\256\000"
+ "\257\000\246\000\257\000\250\000\257\000\246\000\250\000\251\000\257\000"
+ "\250\000\260\000\246\000\260\000\260\000\261\000\246\000\261\000\261\000"
+ "\262\000\246\000\262\000\262\000\263\000\246\000\263\000\263\000\264\000"
+ "\246\000\264\000\264\000\265\000\246\000\265\000\264\000\266\000\265\000"
+ "\266\000\267\000\270\000\270\000\271\000\267\000\271\000\267\000\272\000"
+ "\270\000\272\000\273\000\274\000\274\000\275\000\273\000\275\000\273\000"
+ "\276\000\274\000\276\000\273\000\277\000\276\000\277\000\277\000\300\000"
+ "\276\000\300\000\264\000\271\000\266\000\271\000\264\000\267\000\271\000"
+ "\301\000\266\000\301\000\274\000\301\000\266\000\274\000\275\000\301\000"
+ "\274\000\302\000\266\000\302\000\302\000\303\000\266\000\303\000\302\000"
+ "\304\000\303\000\304\000\305\000\306\000\306\000\307\000\305\000\307\000"
+ "\305\000\310\000\306\000\310\000\305\000\311\000\310\000\311\000\305\000"
+ "\312\000\311\000\312\000\312\000\313\000\311\000\313\000\302\000\314\000"
+ "\274\000\314\000\314\000\315\000\302\000\315\000\315\000\316\000\302\000"
+ "\316\000\307\000\316\000\302\000\307\000\302\000\306\000\306\000\317\000"
+ "\302\000\317\000\317\000\320\000\302\000\320\000\320\000\321\000\302\000"
+ "\321\000\320\000\322\000\321\000\322\000\323\000\324\000\324\000\325\000"
+ "\323\000\325\000\323\000\326\000\324\000\326\000\322\000\327\000\320\000"
+ "\327\000\327\000\330\000\322\000\330\000\330\000\331\000\322\000\331\000"
+ "\331\000\332\000\322\000\332\000\332\000\333\000\322\000\333\000\324\000"
+ "\333\000\322\000\324\000\322\000\326\000\326\000\334\000\322\000\334\000"
+ "\334\000\335\000\322\000\335\000\335\000\336\000\322\000\336\000\335\000"
+ "\337\000\336\000\337\000\337\000\340\000\336\000\340\000\337\000\341\000"
+ "\340\000\341\000\341\000\342\000\340\000\342\000\343\000\344\000\344\000"
+ "\345\000\343\000\345\000\343\000\346\000\344\000\346\000\343\000\347\000"
+ "\346\000\347\000\331\000\350\000\330\000\350\000\345\000\350\000\331\000"
+ "\345\000\345\000\351\000\331\000\351\000\344\000\351\000\352\000\353\000"
+ "\353\000\354\000\352\000\354\000\325\000\352\000\325\000\353\000\323\000"
+ "\352\000\352\000\355\000\323\000\355\000\352\000\356\000\355\000\356\000"
+ "\356\000\357\000\355\000\357\000\356\000\360\000\357\000\360\000\360\000"
+ "\361\000\357\000\361\000\360\000\362\000\361\000\362\000\360\000\363\000"
+ "\362\000\363\000\325\000\333\000\364\000\365\000\365\000\366\000\364\000"
+ "\366\000\364\000\367\000\365\000\367\000\370\000\371\000\371\000\372\000"
+ "\370\000\372\000\370\000\373\000\371\000\373\000\370\000\374\000\373\000"
+ "\374\000\374\000\375\000\373\000\375\000\374\000\376\000\375\000\376\000"
+ "\337\000\367\000\335\000\367\000\367\000\371\000\337\000\371\000\364\000"
+ "\371\000\364\000\377\000\371\000\377\000\364\000\000\001\377\000\000\001"
+ "\372\000\377\000\001\001\002\001\002\001\003\001\001\001\003\001\001\001"
+ "\004\001\002\001\004\001\001\001\005\001\004\001\005\001\341\000\006\001"
+ "\337\000\006\001\006\001\007\001\341\000\007\001\005\001\007\001\341\000"
+ "\005\001\341\000\001\001\001\001\010\001\341\000\010\001\010\001\011\001"
+ "\341\000\011\001\011\001\012\001\341\000\012\001\012\001\013\001\341\000"
+ "\013\001\013\001\014\001\341\000\014\001\013\001\015\001\014\001\015\001"
+ "\015\001\016\001\014\001\016\001\016\001\017\001\014\001\017\001\016\001"
+ "\020\001\017\001\020\001\020\001\021\001\017\001\021\001\020\001\022\001"
+ "\021\001\022\001\020\001\023\001\022\001\023\001\023\001\024\001\022\001"
+ "\024\001\022\001\025\001\021\001\025\001\025\001\026\001\021\001\026\001"
+ "\026\001\027\001\021\001\027\001\027\001\030\001\021\001\030\001\031\001"
+ "\032\001\032\001\033\001\031\001\033\001\031\001\034\001\032\001\034\001"
+ "\031\001\035\001\034\001\035\001\035\001\036\001\034\001\036\001\036\001"
+ "\037\001\034\001\037\001\036\001 \001\037\001 \001\036\001!\001 \001!\001"
+ "!\001\042\001 \001\042\001\042\001#\001 \001#\001\003\001#\001\003\001 \001"
+ "\001\001#\001\021\001$\001\017\001$\001\021\001%\001$\001%\001\021\001&\001"
+ "%\001&\001\021\001'\001&\001'\001'\001(\001&\001(\001(\001)\001&\001)\001"
+ "(\001*\001)\001*\001*\001+\001)\001+\001,\001-\001-\001.\001,\001.\001,\001"
+ "/\001-\001/\001/\0010\001-\0010\001/\0011\0010\0011\0012\0013\001(\0013\001"
+ "(\0012\0012\0014\0013\0014\0014\0015\0013\0015\0014\0016\0015\0016\0016\001"
+ "7\0015\0017\0014\0018\0016\0018\0016\0019\0017\0019\0016\001:\0019\001:\001"
+ "(\001;\001'\001;\001;\001<\001(\001<\001<\001=\001(\001=\001=\001>\001(\001"
+ ">\001>\001\077\001(\001\077\001.\001\077\001(\001.\001(\001-\001-\001@\001"
+ "(\001@\001@\001A\001(\001A\0012\001A\001B\001C\001C\001D\001B\001D\001B\001"
+ "E\001C\001E\001B\001F\001E\001F\001F\001G\001E\001G\001F\001H\001G\001H\001"
+ "I\001J\001J\001K\001I\001K\001I\001L\001J\001L\001I\001M\001L\001M\001M\001"
+ "N\001L\001N\0012\001M\0012\001N\001M\001O\0012\001O\0014\001O\001O\001P\001"
+ "4\001P\001P\001Q\0014\001Q\001Q\001R\0014\001R\001Q\001S\001R\001S\001Q\001"
+ "T\001S\001T\001R\001U\0014\001U\001D\001U\0014\001D\0014\001C\0013\001V\001"
+ "(\001V\0013\001W\001V\001W\0013\001X\001W\001X\0013\001Y\001X\001Y\0013\001"
+ "Z\001Y\001Z\001Z\001[\001Y\001[\001\022\316\000\000\215\003\000\000\260\323"
+ "\000\000R\376\000\000\224\314\000\000\311\002\000\000\316\330\000\000S\375"
+ "\000\000\264\276\000\0005\365\000\000\077\314\000\000\212\312\000\000c\276"
+ "\000\000X\363\000\000\272\301\000\0005\365\000\000\347\302\000\000\022\363"
+ "\000\000\323\305\000\000e\363\000\000\326\305\000\000\014\366\000\000f\306"
+ "\000\000\321\374\000\000\021\311\000\000\303\376\000\000<\314\000\000\307"
+ "\377\000\000\026\334\000\000g\314\000\000\343\243\000\000\351\354\000\000"
+ "h\274\000\000\256\310\000\000M\243\000\000\210\352\000\000\267\247\000\000"
+ "\355\354\000\000m\252\000\000\250\352\000\000F\254\000\0002\355\000\000\013"
+ "\261\000\000\254\350\000\000:\260\000\000\177\354\000\000F\263\000\000\267"
+ "\354\000\000^\265\000\000\261\350\000\000\313\270\000\000>\355\000\000\314"
+ "\270\000\000\357\361\000\000\324\207\000\000\217\357\000\000\341\207\000"
+ "\000\034\353\000\000\221\206\000\000\000\355\000\0008\215\000\000\337\353"
+ "\000\000\231\210\000\000N\322\000\000\275\213\000\000\365\307\000\000=\216"
+ "\000\000\325\351\000\000A\206\000\000\340\316\000\000\316\206\000\000\334"
+ "\312\000\000\366\204\000\0008\316\000\000\302\200\000\000\321\354\000\000"
+ ".\202\000\000\345\347\000\000\001\200\000\000\010\351\000\000\031\204\000"
+ "\000\321\354\000\000\360\202\000\000h\344\000\000\327\206\000\000\266\332"
+ "\000\000a\206\000\000\227\352\000\000\010\232\000\000\020\355\000\000\204"
+ "\231\000\000\374\350\000\000\206\227\000\000\020\355\000\000O\226\000\000"
+ "\011\351\000\000\233\324\000\000i\002\000\000\371\327\000\000\373\376\000"
+ "\000K\323\000\000o\002\000\0005\327\000\0002\001\000\000\220\334\000\000"
+ "\301\001\000\000\003\353\000\0006\314\000\000\366\336\000\000\217\001\000"
+ "\000\377\342\000\000\023\003\000\000`\346\000\000\265\001\000\000<\351\000"
+ "\000\005\007\000\000\234\351\000\000\007\012\000\000\273\355\000\000\007"
+ "\012\000\000\276\373\000\000\326\311\000\000~\376\000\000B\013\000\000\273"
+ "\353\000\000\275-\000\000\303\353\000\000\037+\000\000f\350\000\000\351-"
+ "\000\000r\356\000\000\2252\000\000\316\354\000\000\027%\000\0009\356\000"
+ "\000\012\032\000\000\312\364\000\000\300+\000\000\312\362\000\000\264.\000"
+ "\000\317\351\000\000\326\037\000\000q\344\000\000\357\033\000\000\246\342"
+ "\000\000\376\037\000\000\362\346\000\000\230\033\000\000\014\350\000\000"
+ "\020\034\000\000<\354\000\000\024\034\000\000\250\352\000\000\033$\000\000"
+ "\212\006\000\000\237\014\000\000\215\005\000\000\035\010\000\000,\002\000"
+ "\000 \015\000\000%\011\000\000\371\005\000\000\272\006\000\000\311\000\000"
+ "\000\341\012\000\000\365\312\000\000[\007\000\000\247\375\000\000\303\015"
+ "\000\000d\365\000\000\225\022\000\000\332\314\000\000&\016\000\000v\363\000"
+ "\000l\017\000\000\374\361\000\000\362\016\000\000j\000\000\000\347\020\000"
+ "\000:\376\000\000\365\013\000\000\225\374\000\000\307\017\000\000\202\372"
+ "\000\000\236\020\000\000\215\374\000\000\332\020\000\000x\367\000\000\031"
+ "\022\000\000\361\360\000\000*\026\000\000\357\357\000\000\310 \000\000\335"
+ "\314\000\000\200\027\000\000\207\361\000\0005$\000\000\313\372\000\000\026"
+ "\027\000\000\010\372\000\000\211\026\000\0008\373\000\000\002%\000\000\336"
+ "\364\000\000\242\024\000\000E\370\000\000\267\023\000\000\346\372\000\000"
+ "\0166\000\000\301\314\000\000: \000\000\005\313\000\000]+\000\000\266\361"
+ "\000\000\261-\000\000\277\356\000\000d\024\000\000\373\376\000\000\037\024"
+ "\000\000\362\373\000\000\022\027\000\000\244\376\000\000[\027\000\000:\001"
+ "\000\000\323!\000\000]\377\000\000\374#\000\000\222\377\000\000I$\000\000"
+ "\277\374\000\000Q-\000\000\257\375\000\000\216,\000\000\227\377\000\000\216"
+ ")\000\000\376\370\000\000\256$\000\000 \370\000\000\316+\000\000(\365\000"
+ "\000\223,\000\000\245\363\000\000\077.\000\000g\365\000\000\310>\000\000"
+ "\302\354\000\000\236C\000\000\332\350\000\000\210>\000\000\005\353\000\000"
+ "ND\000\000\321\352\000\000uL\000\000\020\352\000\000TJ\000\000\270\352\000"
+ "\000\2123\000\000\277\356\000\000\2245\000\000:\354\000\000#6\000\000n\350"
+ "\000\000\316=\000\000\315\314\000\000\332:\000\0003\351\000\000\216E\000"
+ "\000\324\313\000\000\357M\000\000\235\313\000\000\330E\000\000z\350\000\000"
+ "\316M\000\000D\345\000\000\206P\000\000f\343\000\000\000k\000\000\321\315"
+ "\000\000TU\000\000\366\342\000\000GZ\000\000\246\342\000\000\212]\000\000"
+ "J\341\000\000\323d\000\000\014\350\000\000(\134\000\000u\343\000\000,e\000"
+ "\000(\346\000\000\250e\000\000\246\346\000\000\224q\000\000\311\341\000\000"
+ "+o\000\000\326\337\000\000Hi\000\000\264\340\000\000\321s\000\000\264\340"
+ "\000\000\233`\000\000\026\343\000\000\254d\000\000\034\341\000\000\263z\000"
+ "\000l\315\000\000\016s\000\000\363\335\000\000\017y\000\000Y\336\000\000"
+ "8{\000\000\350\332\000\000H{\000\000\033\334\000\000\377|\000\000\355\331"
+ "\000\000\220{\000\000-\321\000\000\032\177\000\000\361\315\000\000\377\177"
+ "\000\000\315\317\000\000\335\372\000\000A\032\000\000)\356\000\0005\015\000"
+ "\000N\373\000\000\351\026\000\000Q\376\000\000\023\016\000\000\024\372\000"
+ "\000\0138\000\000`\366\000\000\0113\000\000F\361\000\000\1345\000\000x\372"
+ "\000\000.%\000\000\273\374\000\000\3460\000\000\364\374\000\000\201-\000"
+ "\000\034\002\000\000B$\000\000\023\377\000\000i\036\000\000\336\002\000\000"
+ "^ \000\000\262\024\000\000\321\035\000\000\274\023\000\000)\037\000\000\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\000\001\000\002\000\001\000\000"
+ "\000\003\000\004\000\005\000\006\000\005\000\004\000\007\000\005\000\007"
+ "\000\010\000\005\000\010\000\011\000\005\000\011\000\012\000\005\000\012"
+ "\000\013\000\005\000\013\000\014\000\005\000\014\000\015\000\005\000\015"
+ "\000\001\000\005\000\001\000\016\000\016\000\001\000\003\000\017\000\020"
+ "\000\021\000\020\000\017\000\022\000\020\000\022\000\023\000\020\000\023"
+ "\000\024\000\020\000\024\000\025\000\025\000\024\000\026\000\020\000\025"
+ "\000\027\000\020\000\027\000\030\000\020\000\030\000\031\000\020\000\031"
+ "\000\032\000\020\000\032\000\006\000\020\000\006\000\005\000\033\000\034"
+ "\000\035\000\034\000\033\000\036\000\034\000\036\000\037\000\037\000\036"
+ "\000 \000 \000\036\000!\000\042\000#\000$\000#\000\042\000\037\000#\000\037"
+ "\000 \000%\000&\000'\000&\000%\000(\000&\000(\000)\000)\000(\000*\000*\000"
+ "(\000+\000*\000+\000\034\000*\000\034\000\037\000,\000-\000.\000!\000\020"
+ "\000 \000\020\000!\000/\000\020\000/\000-\000-\000/\000.\000\020\000-\000"
+ "\021\0000\0001\0002\0001\0000\0003\0001\0003\0004\0001\0004\000\003\000\003"
+ "\0004\000\016\000\016\0004\0005\0005\0004\0006\0005\0006\0007\0005\0007\000"
+ "8\0009\0005\0008\0005\0009\000:\0005\000:\000;\0005\000;\000<\000<\000;\000"
+ "=\000>\000\077\000@\000\077\000>\000A\000\077\000A\000B\000B\000A\000C\000"
+ "C\000A\000D\000D\000A\000E\000F\000G\000H\000G\000F\000I\000I\000F\000J\000"
+ "J\000F\000K\000K\000F\000L\000K\000L\000B\000K\000B\000C\000M\000N\000O\000"
+ "P\000Q\000N\000=\000R\000<\000R\000=\000O\000R\000O\000N\000R\000N\000Q\000"
+ "R\000Q\000S\000R\000S\000T\000R\000T\000U\000U\000T\000V\000U\000V\000W\000"
+ "X\000S\000Q\000S\000X\000Y\000Z\000T\000S\000T\000Z\000[\000[\000Z\000\134"
+ "\000]\000T\000[\000^\000U\000W\000U\000^\000_\000U\000_\000`\000`\000_\000"
+ "a\000b\000c\000d\000c\000b\000a\000a\000b\000e\000c\000f\000g\000f\000c\000"
+ "a\000e\000`\000a\000`\000h\000i\000h\000`\000e\000h\000e\000j\000h\000j\000"
+ "k\000l\000d\000m\000d\000l\000n\000d\000n\000b\000b\000n\000o\000b\000o\000"
+ "p\000b\000p\000q\000b\000q\000r\000b\000r\000s\000s\000r\000t\000u\000e\000"
+ "v\000e\000u\000j\000j\000u\000w\000x\000k\000j\000k\000x\000y\000z\000{\000"
+ "|\000{\000z\000}\000{\000}\000~\000~\000}\000\177\000\200\000h\000k\000h"
+ "\000\200\000\201\000h\000\201\000\202\000h\000\202\000\203\000\203\000\202"
+ "\000\204\000\203\000\204\000|\000\203\000|\000\205\000\205\000|\000{\000"
+ "\205\000{\000\206\000\207\000\206\000{\000\206\000\207\000\210\000\206\000"
+ "\210\000\211\000\206\000\211\000\212\000\212\000\211\000\213\000\212\000"
+ "\213\000\214\000\212\000\214\000\215\000\216\000\214\000\213\000\214\000"
+ "\216\000\217\000\217\000\216\000\220\000\220\000\216\000\221\000\222\000"
+ "\223\000\224\000\223\000\222\000\225\000\226\000\212\000\215\000\212\000"
+ "\226\000\227\000\212\000\227\000\224\000\212\000\224\000\223\000\212\000"
+ "\223\000\230\000\230\000\223\000\231\000\232\000\230\000\231\000\230\000"
+ "\232\000\233\000\233\000\232\000\234\000\235\000\236\000\233\000\230\000"
+ "\236\000\237\000\236\000\230\000\233\000\237\000\236\000\240\000\241\000"
+ "C\000D\000\242\000=\000;\000=\000\242\000C\000=\000C\000\243\000\243\000"
+ "C\000\241\000=\000\243\000\244\000\245\000\246\000\247\000\246\000\250\000"
+ "D\000\250\000\246\000\245\000\250\000\245\000\251\000\250\000\251\000\252"
+ "\000\241\000D\000\250\000\253\000\241\000\250\000\241\000\253\000\254\000"
+ "\254\000\253\000\255\000\254\000\255\000\256\000\256\000\255\000\257\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000"
+ "\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000"
+ "\005\000\007\000\007\000\010\000\005\000\010\000\010\000\011\000\005\000"
+ "\011\000\011\000\012\000\005\000\012\000\012\000\013\000\005\000\013\000"
+ "\013\000\014\000\005\000\014\000\014\000\015\000\005\000\015\000\001\000"
+ "\015\000\001\000\005\000\001\000\016\000\005\000\016\000\003\000\016\000"
+ "\017\000\020\000\020\000\021\000\017\000\021\000\017\000\022\000\020\000"
+ "\022\000\022\000\023\000\020\000\023\000\023\000\024\000\020\000\024\000"
+ "\024\000\025\000\020\000\025\000\024\000\026\000\025\000\026\000\025\000"
+ "\027\000\020\000\027\000\027\000\030\000\020\000\030\000\030\000\031\000"
+ "\020\000\031\000\031\000\032\000\020\000\032\000\006\000\032\000\006\000"
+ "\020\000\005\000\020\000\033\000\034\000\034\000\035\000\033\000\035\000"
+ "\033\000\036\000\034\000\036\000\036\000\037\000\034\000\037\000\036\000"
+ " \000\037\000 \000\036\000!\000 \000!\000\042\000#\000#\000$\000\042\000"
+ "$\000\037\000\042\000\037\000#\000 \000#\000%\000&\000&\000'\000%\000'\000"
+ "%\000(\000&\000(\000(\000)\000&\000)\000(\000*\000)\000*\000(\000+\000*\000"
+ "+\000\034\000+\000\034\000*\000\037\000*\000,\000-\000-\000.\000,\000.\000"
+ "\020\000!\000\020\000 \000!\000/\000\020\000/\000-\000/\000\020\000-\000"
+ ".\000/\000\021\000-\0000\0001\0001\0002\0000\0002\0000\0003\0001\0003\000"
+ "3\0004\0001\0004\000\003\0004\000\003\0001\000\016\0004\0004\0005\000\016"
+ "\0005\0004\0006\0005\0006\0006\0007\0005\0007\0007\0008\0005\0008\0005\000"
+ "9\0008\0009\0009\000:\0005\000:\000:\000;\0005\000;\000;\000<\0005\000<\000"
+ ";\000=\000<\000=\000>\000\077\000\077\000@\000>\000@\000>\000A\000\077\000"
+ "A\000A\000B\000\077\000B\000A\000C\000B\000C\000A\000D\000C\000D\000A\000"
+ "E\000D\000E\000F\000G\000G\000H\000F\000H\000F\000I\000G\000I\000F\000J\000"
+ "I\000J\000F\000K\000J\000K\000F\000L\000K\000L\000B\000L\000B\000K\000C\000"
+ "K\000M\000N\000N\000O\000M\000O\000P\000Q\000N\000Q\000N\000P\000=\000R\000"
+ "<\000R\000=\000O\000O\000R\000N\000R\000Q\000R\000Q\000S\000R\000S\000S\000"
+ "T\000R\000T\000T\000U\000R\000U\000T\000V\000U\000V\000V\000W\000U\000W\000"
+ "S\000X\000Q\000X\000X\000Y\000S\000Y\000T\000Z\000S\000Z\000Z\000[\000T\000"
+ "[\000Z\000\134\000[\000\134\000T\000]\000[\000]\000U\000^\000W\000^\000^"
+ "\000_\000U\000_\000_\000`\000U\000`\000_\000a\000`\000a\000b\000c\000c\000"
+ "d\000b\000d\000a\000b\000a\000c\000b\000e\000a\000e\000c\000f\000f\000g\000"
+ "c\000g\000a\000f\000`\000e\000`\000h\000h\000i\000`\000i\000e\000h\000e\000"
+ "j\000h\000j\000j\000k\000h\000k\000d\000l\000d\000m\000l\000m\000l\000n\000"
+ "d\000n\000b\000n\000n\000o\000b\000o\000o\000p\000b\000p\000p\000q\000b\000"
+ "q\000q\000r\000b\000r\000r\000s\000b\000s\000r\000t\000s\000t\000e\000u\000"
+ "e\000v\000u\000v\000j\000u\000u\000w\000j\000w\000k\000x\000j\000x\000x\000"
+ "y\000k\000y\000z\000{\000{\000|\000z\000|\000z\000}\000{\000}\000}\000~\000"
+ "{\000~\000}\000\177\000~\000\177\000h\000\200\000k\000\200\000\200\000\201"
+ "\000h\000\201\000\201\000\202\000h\000\202\000\202\000\203\000h\000\203\000"
+ "\202\000\204\000\203\000\204\000|\000\204\000|\000\203\000|\000\205\000\203"
+ "\000\205\000{\000\205\000{\000\206\000\205\000\206\000\206\000\207\000{\000"
+ "\207\000\207\000\210\000\206\000\210\000\210\000\211\000\206\000\211\000"
+ "\211\000\212\000\206\000\212\000\211\000\213\000\212\000\213\000\213\000"
+ "\214\000\212\000\214\000\214\000\215\000\212\000\215\000\214\000\216\000"
+ "\213\000\216\000\216\000\217\000\214\000\217\000\216\000\220\000\217\000"
+ "\220\000\216\000\221\000\220\000\221\000\222\000\223\000\223\000\224\000"
+ "\222\000\224\000\222\000\225\000\223\000\225\000\212\000\226\000\215\000"
+ "\226\000\226\000\227\000\212\000\227\000\224\000\227\000\212\000\224\000"
+ "\212\000\223\000\223\000\230\000\212\000\230\000\223\000\231\000\230\000"
+ "\231\000\230\000\232\000\231\000\232\000\232\000\233\000\230\000\233\000"
+ "\232\000\234\000\233\000\234\000\235\000\236\000\233\000\236\000\233\000"
+ "\235\000\230\000\236\000\236\000\237\000\230\000\237\000\236\000\240\000"
+ "\237\000\240\000C\000\241\000D\000\241\000=\000\242\000;\000\242\000C\000"
+ "\242\000=\000C\000C\000\243\000=\000\243\000\241\000\243\000\243\000\244"
+ "\000=\000\244\000\245\000\246\000\246\000\247\000\245\000\247\000\246\000"
+ "\250\000D\000\250\000D\000\246\000\245\000\250\000\245\000\251\000\250\000"
+ "\251\000\251\000\252\000\250\000\252\000\241\000\250\000\241\000\253\000"
+ "\250\000\253\000\253\000\254\000\241\000\254\000\253\000\255\000\254\000"
+ "\255\000\255\000\256\000\254\000\256\000\255\000\257\000\256\000\257\000"
+ "\245\252\000\000\016\350\000\000r\265\000\000\364\313\000\000\007\200\000"
+ "\000V\313\000\000\235\256\000\000\016\350\000\000\240\256\000\000\007\350"
+ "\000\000\241\256\000\000\010\350\000\000r\230\000\000\214\343\000\000\033"
+ "\215\000\000\202\335\000\000\033\214\000\0000\340\000\000\360\242\000\000"
+ "\366\373\000\000\002\240\000\000\271\350\000\000\003\254\000\000\331\372"
+ "\000\000s\230\000\000\016\346\000\000z\234\000\000$\346\000\000\231\231\000"
+ "\000\352\346\000\000\364\203\000\000\333\343\000\000m\203\000\000\214\335"
+ "\000\000\316\202\000\000E\343\000\000\023\205\000\000A\336\000\000\221\206"
+ "\000\000\201\335\000\000,\204\000\000q\343\000\000\300\201\000\000\326\331"
+ "\000\000\272\201\000\000\204\317\000\000.\213\000\000\200\335\000\0005\202"
+ "\000\000z\335\000\000\031\210\000\000\342\335\000\000\300\211\000\000\333"
+ "\335\000\000{\210\000\000\212\346\000\000m\211\000\000\027\346\000\000\254"
+ "\212\000\0007\353\000\000~\217\000\000\037\347\000\000\042\212\000\000\036"
+ "\352\000\000\010\220\000\000\244\350\000\000\316\221\000\000\305\352\000"
+ "\000\010\220\000\000\305\352\000\000u\215\000\000\027\342\000\000\260\216"
+ "\000\000\310\345\000\000M\226\000\000i\344\000\000u\223\000\000\227\347\000"
+ "\000y\223\000\000\217\354\000\000\031\224\000\000 \027\000\000\223\224\000"
+ "\000\324\024\000\000{\224\000\000d\350\000\000\362\224\000\000\217\354\000"
+ "\000\367\234\000\000$\351\000\000m\200\000\000&\317\000\000\001\200\000\000"
+ "\134\315\000\000\230\201\000\0005\317\000\000\012\254\000\000\251\351\000"
+ "\000\301\255\000\000\251\351\000\000r\265\000\000 \352\000\000\337\261\000"
+ "\000$\351\000\0002\267\000\000 \352\000\000\006\302\000\000$\352\000\000"
+ "\240\256\000\000\016\350\000\000J\261\000\000\342\350\000\000r\265\000\000"
+ "\225\355\000\000\250\271\000\000\077\377\000\000'\272\000\000 \001\000\000"
+ "H\274\000\000\317\000\000\000l\303\000\000\213\000\000\000a\303\000\000$"
+ "\352\000\000\242\336\000\000\255\354\000\000q\307\000\000\303\352\000\000"
+ "\364\321\000\000\224\354\000\000m\305\000\000/\355\000\000a\303\000\000/"
+ "\355\000\000\262\312\000\0007\356\000\0009\312\000\000\245\353\000\000\223"
+ "\310\000\0007\356\000\0009\315\000\000m\354\000\000\030\320\000\000\345\355"
+ "\000\000\012\326\000\000\030\007\000\000}\341\000\000E\006\000\000\275\337"
+ "\000\000!\366\000\000\007\340\000\000S\363\000\000\013\340\000\000T\364\000"
+ "\000)\341\000\000v\314\000\000\221\354\000\000\377\355\000\000b\365\000\000"
+ "!\360\000\000\305\345\000\000\200\364\000\0007\344\000\000\007\357\000\000"
+ "7\344\000\000\362\362\000\000\027\350\000\000\201\356\000\000\221\346\000"
+ "\000\207\357\000\000a\346\000\000\237\362\000\0007\363\000\000\354\357\000"
+ "\000\231\360\000\000\254\357\000\000\204\357\000\000\255\357\000\000\021"
+ "\355\000\000o\363\000\000\210\356\000\000\366\363\000\000\024\357\000\000"
+ "\330\362\000\000\217\361\000\000n\360\000\000;\362\000\000\305\362\000\000"
+ "7\363\000\000#\363\000\000\324\367\000\000\006\015\000\000\220\000\000\000"
+ "\014\357\000\000\224\000\000\000\005\361\000\000\256\003\000\000\220\014"
+ "\000\000n\002\000\000\202\362\000\000)\004\000\000\242\356\000\000\220\001"
+ "\000\000\014\357\000\000\233\003\000\000\015\362\000\000\257\010\000\000"
+ "j\361\000\000\363\016\000\000\366\356\000\000\237\014\000\000j\361\000\000"
+ "\301&\000\000\213\024\000\000\334\023\000\000\217\362\000\000C\023\000\000"
+ "\010\364\000\000\274&\000\000\011\021\000\000S'\000\000>\023\000\000.\016"
+ "\000\000a\370\000\000{\015\000\000\214\367\000\000\342\014\000\000\313\367"
+ "\000\000\345\016\000\000]\365\000\000b\022\000\000,\367\000\000\346\016\000"
+ "\000\331\364\000\000\354\017\000\000\272\360\000\000\317\017\000\000\027"
+ "\360\000\000\373\030\000\000\000\360\000\000\341\025\000\000\217\362\000"
+ "\000\347\025\000\000\212\363\000\000\216\026\000\000.\364\000\000\373\030"
+ "\000\000\210\364\000\000\007$\000\000~\002\000\000\202 \000\000\013\357\000"
+ "\000\327\036\000\000\271\360\000\000\362%\000\000~\002\000\000\257$\000\000"
+ "{\361\000\000A#\000\000\013\357\000\000\306\042\000\000\247\360\000\000z"
+ "&\000\000\364\355\000\000\201,\000\000\2524\000\000\212+\000\000z\032\000"
+ "\000\341*\000\000\0204\000\000\253(\000\000\022\360\000\000\212+\000\000"
+ "\010\030\000\000!*\000\000\220\356\000\000!*\000\000\375\357\000\000<-\000"
+ "\000y\361\000\000\213+\000\000\267\357\000\000\212+\000\000\353\360\000\000"
+ "\2434\000\000^\354\000\0001+\000\000\322\356\000\000<-\000\000\042\357\000"
+ "\000w0\000\000\210\357\000\000\3361\000\000}\360\000\000\220D\000\000\313"
+ "\366\000\000\343D\000\000\177\364\000\000\362C\000\000\204\365\000\000\223"
+ "E\000\000N\366\000\000I\077\000\000\353\362\000\000\010=\000\000\315\357"
+ "\000\000A<\000\000\010\362\000\0005\077\000\000\276\354\000\000\343\077\000"
+ "\000$\355\000\000\364\077\000\000\201\357\000\000\240J\000\000|\366\000\000"
+ "\244F\000\000\244\365\000\0000I\000\000\241\370\000\000\230:\000\0001\356"
+ "\000\000\345\077\000\000\364\353\000\000\205:\000\000\227\354\000\000\325"
+ "@\000\000\376\353\000\000\230H\000\000\260\351\000\000sA\000\000-\354\000"
+ "\000\272E\000\000\325\354\000\000\275G\000\000\341\354\000\000`W\000\000"
+ "#\354\000\000lk\000\000\273\335\000\000\240K\000\000-\352\000\000\340f\000"
+ "\000\303\357\000\0001r\000\000b\316\000\000\035m\000\000'\330\000\000Tr\000"
+ "\0001\320\000\000\021I\000\000\347\363\000\000'M\000\000\253\355\000\000"
+ ";H\000\0001\362\000\0000J\000\000k\363\000\000EP\000\000r\356\000\000\202"
+ "M\000\000\355\354\000\000CR\000\000\226\362\000\000\037O\000\000\006\362"
+ "\000\000\240K\000\000\323\354\000\000\202S\000\000\250\355\000\000\010S\000"
+ "\000z\356\000\000\015[\000\000\010\361\000\000\242Y\000\000\262\357\000\000"
+ "\242Y\000\000\010\361\000\000Q\134\000\000i\361\000\000\213\134\000\0000"
+ "\360\000\000\022\134\000\000$\361\000\000\324]\000\000l\361\000\000\340f"
+ "\000\000\257\361\000\000)_\000\000\267\357\000\000\373^\000\000!\363\000"
+ "\000wU\000\000L\357\000\0009W\000\000\226\356\000\000uT\000\000\226\356\000"
+ "\000\015[\000\000`\357\000\000\324]\000\000\267\357\000\000\250h\000\000"
+ "\303\357\000\000\266h\000\000\245\360\000\000Rk\000\000\245\360\000\000\027"
+ "m\000\000[\357\000\000\033r\000\000\372\354\000\000\300m\000\000\306\360"
+ "\000\000\223o\000\000\352\357\000\000\272o\000\000W\361\000\000\373o\000"
+ "\000G\361\000\000\226p\000\000P\360\000\000\033r\000\000N\357\000\000\311"
+ "l\000\000\204\336\000\000\373y\000\000\322\343\000\000\322t\000\000\230\355"
+ "\000\000\016u\000\000\346\356\000\000[v\000\000\244\355\000\0008v\000\000"
+ "\364\357\000\000Jx\000\000\244\355\000\000*z\000\000\000\356\000\000vz\000"
+ "\000M\344\000\000)~\000\000T\357\000\000\265|\000\0007\347\000\000\377\177"
+ "\000\000\203\352\000\000\371}\000\000\301\372\000\000\013\177\000\000C\373"
+ "\000\000\334~\000\000\221\373\000\000\001\177\000\000k\373\000\000\354\033"
+ "\000\000\267\360\000\000\373\030\000\000\033\315\000\000kC\000\000\230\315"
+ "\000\000 6\000\000\336\353\000\000\361q\000\000\042\316\000\000>3\000\000"
+ "\221\042\000\000=4\000\000\273 \000\000\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\000\000\000\001\000\002"
+ "\000\001\000\000\000\003\000\001\000\003\000\004\000\001\000\004\000\005"
+ "\000\006\000\007\000\010\000\011\000\000\000\012\000\000\000\011\000\013"
+ "\000\014\000\015\000\006\000\015\000\014\000\016\000\017\000\020\000\021"
+ "\000\020\000\017\000\022\000\020\000\022\000\023\000\022\000\017\000\024"
+ "\000\025\000\007\000\026\000\007\000\025\000\027\000\027\000\025\000\030"
+ "\000\027\000\030\000\023\000\023\000\030\000\020\000\027\000\023\000\031"
+ "\000\027\000\031\000\032\000\033\000\023\000\022\000\023\000\033\000\034"
+ "\000\035\000\036\000\037\000\036\000\035\000 \000!\000 \000\042\000#\000"
+ "\006\000\010\000\006\000#\000$\000\006\000$\000\036\000\006\000\036\000%"
+ "\000%\000\036\000 \000%\000 \000&\000&\000 \000!\000!\000'\000&\000'\000"
+ "!\000(\000'\000(\000)\000'\000*\000&\000*\000'\000+\000\012\000\015\000,"
+ "\000-\000\002\000.\000\002\000-\000/\000\002\000/\000\000\000\000\000/\000"
+ "\026\000\000\000\026\000\007\000\000\000\007\000\006\000\000\000\006\000"
+ "\015\000\000\000\015\000\012\0000\000\003\000\000\000\003\0000\0001\0002"
+ "\000\001\0003\000\001\0002\0004\000\001\0004\0005\0006\000\004\000\003\000"
+ "\004\0006\000\005\0007\000\001\000\005\000\001\0007\0003\0002\0003\0008\000"
+ "9\0005\0004\0005\0009\000:\0005\000:\000;\0005\000;\000<\000\001\000=\000"
+ ">\000=\000\001\0005\000>\000=\000\077\000>\000\077\000@\000A\000=\000B\000"
+ "=\000A\000\077\000C\000D\000E\000\077\000D\000@\000D\000\077\000E\000@\000"
+ "D\000F\000@\000F\000G\000H\000>\000@\000>\000H\000I\000>\000I\000J\000J\000"
+ "K\000>\000K\000J\000L\000>\000M\000\001\000M\000>\000N\000M\000N\000O\000"
+ "P\000Q\000R\000>\000S\000N\000S\000>\000Q\000S\000Q\000T\000T\000Q\000P\000"
+ "T\000P\000U\000N\000V\000O\000V\000N\000W\000W\000N\000X\000X\000N\000Y\000"
+ "X\000Y\000Z\000X\000Z\000[\000V\000W\000\134\000V\000\134\000]\000V\000]"
+ "\000^\000_\000`\000O\000`\000_\000a\000a\000_\000b\000c\000d\000e\000d\000"
+ "c\000f\000g\000h\000d\000h\000g\000i\000j\000k\000l\000k\000j\000m\000m\000"
+ "j\000n\000o\000p\000q\000p\000o\000r\000r\000o\000s\000r\000s\000t\000t\000"
+ "s\000u\000v\000w\000h\000w\000v\000u\000w\000u\000k\000k\000u\000l\000l\000"
+ "u\000s\000w\000k\000x\000w\000x\000y\000w\000y\000z\000w\000z\000{\000|\000"
+ "}\000~\000}\000|\000\177\000\200\000\201\000\202\000\201\000\200\000\203"
+ "\000\204\000\205\000\206\000\206\000\207\000\203\000\207\000\206\000\210"
+ "\000\210\000\206\000\205\000\207\000\211\000\203\000\211\000\207\000\212"
+ "\000\213\000\214\000\215\000\214\000\216\000\217\000\216\000\214\000\220"
+ "\000\220\000\214\000\213\000\216\000\220\000\221\000\216\000\221\000\222"
+ "\000\223\000\224\000\225\000\224\000\223\000\226\000\227\000\230\000\231"
+ "\000\230\000\227\000\232\000\232\000\227\000\233\000\233\000\227\000\234"
+ "\000\233\000\234\000\235\000\235\000\234\000\224\000\235\000\224\000\236"
+ "\000\236\000\224\000\226\000\235\000\236\000\237\000\240\000\241\000\242"
+ "\000\241\000\240\000\232\000\232\000\240\000\230\000\243\000\244\000\241"
+ "\000\244\000\243\000\245\000\244\000\245\000\246\000\244\000\246\000\247"
+ "\000\250\000\251\000\252\000\251\000\250\000\253\000\252\000\254\000\244"
+ "\000\254\000\252\000\255\000\255\000\252\000\251\000\254\000\255\000\256"
+ "\000\257\000\260\000\261\000\260\000\257\000\262\000\260\000\262\000\263"
+ "\000\260\000\263\000\264\000\265\000\263\000\266\000\264\000\252\000\267"
+ "\000\252\000\264\000\250\000\250\000\264\000\263\000\250\000\263\000\270"
+ "\000\270\000\263\000\271\000\271\000\263\000\265\000\272\000\273\000\274"
+ "\000\275\000\276\000\277\000\276\000\275\000\300\000\301\000\302\000\303"
+ "\000\304\000\305\000\306\000\305\000\304\000\273\000\305\000\273\000\250"
+ "\000\250\000\273\000\307\000\250\000\307\000\253\000\307\000\273\000\272"
+ "\000\253\000\307\000\302\000\302\000\307\000\310\000\310\000\307\000\276"
+ "\000\310\000\276\000\300\000\253\000\302\000\301\000\311\000\251\000\253"
+ "\000\251\000\311\000\312\000\251\000\312\000\313\000\251\000\313\000\314"
+ "\000\251\000\314\000\315\000\315\000\314\000\316\000\315\000\316\000\317"
+ "\000\315\000\317\000\320\000\315\000\320\000\321\000\315\000\321\000\322"
+ "\000\315\000\322\000\323\000\315\000\324\000\251\000\324\000\315\000\325"
+ "\000\325\000\315\000\326\000\325\000\326\000\327\000\325\000\327\000\330"
+ "\000\330\000\327\000\331\000\325\000\330\000\332\000\325\000\332\000\333"
+ "\000\325\000\333\000\334\000\334\000\333\000\335\000\334\000\335\000\336"
+ "\000\336\000\335\000\337\000\340\000\333\000\332\000\333\000\340\000\341"
+ "\000\341\000\340\000\342\000\341\000\342\000\343\000\344\000\345\000w\000"
+ "\345\000\344\000\346\000\346\000\344\000}\000}\000\344\000~\000\346\000}"
+ "\000\201\000\346\000\201\000\203\000\346\000\203\000\211\000\346\000\211"
+ "\000\217\000\346\000\217\000\216\000\346\000\216\000\347\000O\000\345\000"
+ "M\000\345\000O\000`\000\345\000`\000e\000\345\000e\000d\000\345\000d\000"
+ "h\000\345\000h\000w\000\242\000\346\000\347\000\346\000\242\000\241\000\346"
+ "\000\241\000\244\000\346\000\244\000\350\000\350\000\244\000\254\000\351"
+ "\000\210\000\205\000\210\000\351\000\352\000\000\000\001\000\001\000\002"
+ "\000\000\000\002\000\000\000\003\000\001\000\003\000\003\000\004\000\001"
+ "\000\004\000\004\000\005\000\001\000\005\000\006\000\007\000\007\000\010"
+ "\000\006\000\010\000\000\000\011\000\000\000\012\000\011\000\012\000\011"
+ "\000\013\000\000\000\013\000\014\000\015\000\006\000\015\000\006\000\014"
+ "\000\014\000\016\000\015\000\016\000\017\000\020\000\020\000\021\000\017"
+ "\000\021\000\017\000\022\000\020\000\022\000\022\000\023\000\020\000\023"
+ "\000\017\000\024\000\022\000\024\000\007\000\025\000\007\000\026\000\025"
+ "\000\026\000\025\000\027\000\007\000\027\000\025\000\030\000\027\000\030"
+ "\000\023\000\030\000\023\000\027\000\020\000\030\000\023\000\031\000\027"
+ "\000\031\000\031\000\032\000\027\000\032\000\023\000\033\000\022\000\033"
+ "\000\033\000\034\000\023\000\034\000\035\000\036\000\036\000\037\000\035"
+ "\000\037\000\035\000 \000\036\000 \000 \000!\000 \000\042\000!\000\042\000"
+ "\006\000#\000\010\000#\000#\000$\000\006\000$\000\036\000$\000\006\000\036"
+ "\000\036\000%\000\006\000%\000 \000%\000 \000&\000%\000&\000!\000&\000!\000"
+ "'\000&\000'\000!\000(\000'\000(\000(\000)\000'\000)\000'\000*\000&\000*\000"
+ "'\000+\000*\000+\000\012\000\015\000\015\000,\000\012\000,\000\002\000-\000"
+ "\002\000.\000-\000.\000-\000/\000\002\000/\000\000\000/\000\026\000/\000"
+ "\000\000\026\000\000\000\007\000\000\000\006\000\000\000\015\000\003\000"
+ "0\000\000\0000\0000\0001\000\003\0001\000\001\0002\000\001\0003\0002\000"
+ "3\0002\0004\000\001\0004\0004\0005\000\001\0005\000\004\0006\000\003\000"
+ "6\000\005\0006\000\001\0007\000\005\0007\0003\0007\0003\0008\0002\0008\000"
+ "5\0009\0004\0009\0009\000:\0005\000:\000:\000;\0005\000;\000;\000<\0005\000"
+ "<\000\001\000=\000=\000>\000\001\000>\0005\000=\000=\000\077\000>\000\077"
+ "\000\077\000@\000>\000@\000=\000A\000=\000B\000A\000B\000\077\000A\000C\000"
+ "D\000D\000E\000C\000E\000\077\000D\000@\000D\000\077\000E\000D\000F\000@"
+ "\000F\000F\000G\000@\000G\000>\000H\000@\000H\000H\000I\000>\000I\000I\000"
+ "J\000>\000J\000J\000K\000>\000K\000J\000L\000K\000L\000>\000M\000\001\000"
+ "M\000>\000N\000M\000N\000N\000O\000M\000O\000P\000Q\000Q\000R\000P\000R\000"
+ ">\000S\000N\000S\000>\000Q\000Q\000S\000Q\000T\000S\000T\000P\000T\000P\000"
+ "U\000T\000U\000N\000V\000O\000V\000N\000W\000V\000W\000N\000X\000W\000X\000"
+ "N\000Y\000X\000Y\000Y\000Z\000X\000Z\000Z\000[\000X\000[\000W\000\134\000"
+ "V\000\134\000\134\000]\000V\000]\000]\000^\000V\000^\000_\000`\000O\000`"
+ "\000O\000_\000_\000a\000`\000a\000_\000b\000a\000b\000c\000d\000d\000e\000"
+ "c\000e\000c\000f\000d\000f\000g\000h\000d\000h\000d\000g\000g\000i\000h\000"
+ "i\000j\000k\000k\000l\000j\000l\000j\000m\000k\000m\000j\000n\000m\000n\000"
+ "o\000p\000p\000q\000o\000q\000o\000r\000p\000r\000o\000s\000r\000s\000s\000"
+ "t\000r\000t\000s\000u\000t\000u\000v\000w\000h\000w\000h\000v\000u\000v\000"
+ "u\000w\000k\000u\000k\000w\000l\000u\000l\000s\000k\000x\000w\000x\000x\000"
+ "y\000w\000y\000y\000z\000w\000z\000z\000{\000w\000{\000|\000}\000}\000~\000"
+ "|\000~\000|\000\177\000}\000\177\000\200\000\201\000\201\000\202\000\200"
+ "\000\202\000\200\000\203\000\201\000\203\000\204\000\205\000\205\000\206"
+ "\000\204\000\206\000\206\000\207\000\203\000\207\000\203\000\206\000\206"
+ "\000\210\000\207\000\210\000\205\000\210\000\207\000\211\000\203\000\211"
+ "\000\207\000\212\000\211\000\212\000\213\000\214\000\214\000\215\000\213"
+ "\000\215\000\214\000\216\000\216\000\217\000\214\000\217\000\214\000\220"
+ "\000\216\000\220\000\213\000\220\000\220\000\221\000\216\000\221\000\221"
+ "\000\222\000\216\000\222\000\223\000\224\000\224\000\225\000\223\000\225"
+ "\000\223\000\226\000\224\000\226\000\227\000\230\000\230\000\231\000\227"
+ "\000\231\000\227\000\232\000\230\000\232\000\227\000\233\000\232\000\233"
+ "\000\227\000\234\000\233\000\234\000\234\000\235\000\233\000\235\000\224"
+ "\000\234\000\224\000\235\000\224\000\236\000\235\000\236\000\226\000\236"
+ "\000\236\000\237\000\235\000\237\000\240\000\241\000\241\000\242\000\240"
+ "\000\242\000\232\000\240\000\232\000\241\000\230\000\240\000\243\000\244"
+ "\000\241\000\244\000\241\000\243\000\243\000\245\000\244\000\245\000\245"
+ "\000\246\000\244\000\246\000\246\000\247\000\244\000\247\000\250\000\251"
+ "\000\251\000\252\000\250\000\252\000\250\000\253\000\251\000\253\000\252"
+ "\000\254\000\244\000\254\000\244\000\252\000\252\000\255\000\254\000\255"
+ "\000\251\000\255\000\255\000\256\000\254\000\256\000\257\000\260\000\260"
+ "\000\261\000\257\000\261\000\257\000\262\000\260\000\262\000\262\000\263"
+ "\000\260\000\263\000\263\000\264\000\260\000\264\000\263\000\265\000\263"
+ "\000\266\000\265\000\266\000\252\000\264\000\252\000\267\000\264\000\267"
+ "\000\250\000\264\000\250\000\263\000\263\000\270\000\250\000\270\000\263"
+ "\000\271\000\270\000\271\000\265\000\271\000\272\000\273\000\273\000\274"
+ "\000\272\000\274\000\275\000\276\000\276\000\277\000\275\000\277\000\275"
+ "\000\300\000\276\000\300\000\301\000\302\000\302\000\303\000\301\000\303"
+ "\000\304\000\305\000\305\000\306\000\304\000\306\000\273\000\304\000\273"
+ "\000\305\000\250\000\273\000\250\000\305\000\273\000\307\000\250\000\307"
+ "\000\253\000\307\000\272\000\307\000\302\000\307\000\253\000\302\000\307"
+ "\000\310\000\302\000\310\000\276\000\307\000\276\000\310\000\300\000\310"
+ "\000\253\000\301\000\251\000\311\000\253\000\311\000\311\000\312\000\251"
+ "\000\312\000\312\000\313\000\251\000\313\000\313\000\314\000\251\000\314"
+ "\000\314\000\315\000\251\000\315\000\314\000\316\000\315\000\316\000\316"
+ "\000\317\000\315\000\317\000\317\000\320\000\315\000\320\000\320\000\321"
+ "\000\315\000\321\000\321\000\322\000\315\000\322\000\322\000\323\000\315"
+ "\000\323\000\315\000\324\000\251\000\324\000\315\000\325\000\324\000\325"
+ "\000\315\000\326\000\325\000\326\000\326\000\327\000\325\000\327\000\327"
+ "\000\330\000\325\000\330\000\327\000\331\000\330\000\331\000\330\000\332"
+ "\000\325\000\332\000\332\000\333\000\325\000\333\000\333\000\334\000\325"
+ "\000\334\000\333\000\335\000\334\000\335\000\335\000\336\000\334\000\336"
+ "\000\335\000\337\000\336\000\337\000\333\000\340\000\332\000\340\000\340"
+ "\000\341\000\333\000\341\000\340\000\342\000\341\000\342\000\342\000\343"
+ "\000\341\000\343\000\344\000\345\000w\000\345\000w\000\344\000\344\000\346"
+ "\000\345\000\346\000}\000\344\000}\000\346\000~\000\344\000}\000\201\000"
+ "\201\000\346\000\203\000\346\000\211\000\346\000\211\000\217\000\217\000"
+ "\346\000\216\000\346\000\216\000\347\000\346\000\347\000O\000\345\000M\000"
+ "\345\000`\000\345\000`\000e\000e\000\345\000d\000\345\000h\000\345\000\242"
+ "\000\346\000\242\000\347\000\241\000\346\000\244\000\346\000\244\000\350"
+ "\000\346\000\350\000\254\000\350\000\210\000\351\000\205\000\351\000\351"
+ "\000\352\000\210\000\352\000h\210\000\000\351\377\000\000\245\200\000\000"
+ "3\374\000\000\001\200\000\000\351\377\000\000\316\201\000\000\005\362\000"
+ "\000\320\201\000\000B\360\000\000\013\204\000\000\260\355\000\000\343\220"
+ "\000\000\272\353\000\000\354\230\000\000e\352\000\000\004\236\000\000\001"
+ "\351\000\000\374\321\000\000\330\014\000\000\330\315\000\000\365\344\000"
+ "\000\330\315\000\000V\015\000\000\236\324\000\000\315\013\000\000S\327\000"
+ "\000s\013\000\000\310\234\000\000\215\011\000\000m\234\000\000\256\006\000"
+ "\000\304\245\000\000\002\012\000\000A\212\000\000\217\007\000\000a\210\000"
+ "\000\241\005\000\000\032\215\000\000p\007\000\000\322\255\000\000\235\347"
+ "\000\000\323\253\000\000\342\023\000\000\304\245\000\000\342\023\000\000"
+ "\363\303\000\000q\024\000\000W\302\000\000\330\025\000\000B\317\000\0009"
+ "#\000\000a\304\000\000\030\034\000\000\224\303\000\000\255#\000\000\223\316"
+ "\000\000+!\000\000X\302\000\000\233\033\000\000T\253\000\000\341\033\000"
+ "\000.\321\000\000\256\344\000\000\360\361\000\000T\342\000\000L\033\000\000"
+ "\331\337\000\000j2\000\000\316\015\000\000u4\000\000\231\372\000\000v4\000"
+ "\000\212\374\000\000\2714\000\000\336\012\000\000A\352\000\000z\014\000\000"
+ "\304\370\000\000\302\014\000\000K\020\000\000\340\015\000\000^'\000\000\244"
+ "\017\000\000\224,\000\000\356\016\000\000\3635\000\000\305\336\000\000\242"
+ "Y\000\000\255\335\000\000\376k\000\000K\374\000\000\253q\000\000\031\356"
+ "\000\000\034Q\000\000\206\373\000\000\377\177\000\0007\375\000\000\316~\000"
+ "\000{\372\000\000^E\000\000\252\372\000\000\206b\000\000g\346\000\000\042"
+ "^\000\000\363\334\000\000\234h\000\000S\334\000\000]e\000\000\276\347\000"
+ "\000\036G\000\000\025\374\000\000\206I\000\0001\375\000\000\270O\000\000"
+ "\325\373\000\000\013M\000\000\373\374\000\000\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\000\000\000\001\000\002\000\001\000\000\000\003\000\003"
+ "\000\000\000\004\000\004\000\000\000\005\000\005\000\000\000\006\000\006"
+ "\000\000\000\007\000\007\000\000\000\010\000\011\000\012\000\013\000\012"
+ "\000\011\000\014\000\012\000\014\000\015\000\016\000\010\000\017\000\010"
+ "\000\016\000\020\000\021\000\000\000\022\000\000\000\021\000\010\000\010"
+ "\000\021\000\023\000\010\000\023\000\017\000\020\000\024\000\010\000\024"
+ "\000\020\000\013\000\024\000\013\000\012\000\025\000\020\000\026\000\020"
+ "\000\025\000\013\000\025\000\027\000\013\000\027\000\025\000\030\000\031"
+ "\000\032\000\033\000\032\000\031\000\034\000\032\000\034\000\013\000\013"
+ "\000\027\000\032\000\035\000\025\000\036\000\025\000\035\000\030\000\015"
+ "\000\037\000\012\000\037\000\015\000 \000 \000\015\000!\000\042\000#\000"
+ "!\000#\000\042\000$\000$\000\042\000%\000&\000!\000\015\000!\000&\000'\000"
+ "!\000'\000(\000!\000(\000)\000!\000)\000\042\000\042\000)\000*\000#\000+"
+ "\000!\000+\000#\000,\000-\000.\000/\000.\000-\0000\000.\0000\0001\0002\000"
+ ",\000#\000,\0002\000/\0003\000,\000/\000,\0003\0004\0004\0003\0005\000.\000"
+ "3\000/\0003\000.\0006\0007\000/\0002\000/\0007\0008\000/\0008\0009\0009\000"
+ "8\000:\000\000\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000"
+ "\003\000\001\000\003\000\000\000\004\000\003\000\004\000\000\000\005\000"
+ "\004\000\005\000\000\000\006\000\005\000\006\000\000\000\007\000\006\000"
+ "\007\000\000\000\010\000\007\000\010\000\011\000\012\000\012\000\013\000"
+ "\011\000\013\000\011\000\014\000\012\000\014\000\014\000\015\000\012\000"
+ "\015\000\010\000\016\000\010\000\017\000\016\000\017\000\016\000\020\000"
+ "\010\000\020\000\000\000\021\000\000\000\022\000\021\000\022\000\010\000"
+ "\021\000\021\000\023\000\010\000\023\000\017\000\023\000\020\000\024\000"
+ "\010\000\024\000\013\000\020\000\013\000\024\000\012\000\024\000\020\000"
+ "\025\000\020\000\026\000\025\000\026\000\013\000\025\000\025\000\027\000"
+ "\013\000\027\000\025\000\030\000\027\000\030\000\031\000\032\000\032\000"
+ "\033\000\031\000\033\000\031\000\034\000\032\000\034\000\013\000\034\000"
+ "\013\000\032\000\027\000\032\000\025\000\035\000\025\000\036\000\035\000"
+ "\036\000\030\000\035\000\015\000\037\000\012\000\037\000\015\000 \000\037"
+ "\000 \000\015\000!\000 \000!\000\042\000#\000!\000#\000!\000\042\000\042"
+ "\000$\000#\000$\000\042\000%\000$\000%\000!\000&\000\015\000&\000&\000'\000"
+ "!\000'\000'\000(\000!\000(\000(\000)\000!\000)\000\042\000)\000)\000*\000"
+ "\042\000*\000#\000+\000!\000+\000#\000,\000+\000,\000-\000.\000.\000/\000"
+ "-\000/\000-\0000\000.\0000\0000\0001\000.\0001\000,\0002\000#\0002\000/\000"
+ "2\000,\000/\000,\0003\000/\0003\0003\0004\000,\0004\0003\0005\0004\0005\000"
+ ".\0003\000.\0006\0003\0006\000/\0007\0002\0007\0007\0008\000/\0008\0008\000"
+ "9\000/\0009\0008\000:\0009\000:\000<\254\000\000\134\273\000\000\266\203"
+ "\000\000+\274\000\0003\202\000\000C\345\000\000\015!\000\000\326\374\000"
+ "\0000 \000\000\134\370\000\000\277\037\000\000\226\373\000\000\373,\000\000"
+ "\316\005\000\000\015!\000\000\351\003\000\000\016 \000\000\340\005\000\000"
+ "\027*\000\000u\351\000\000\034-\000\000u\005\000\000\310\035\000\000K\350"
+ "\000\000\261\032\000\0003\341\000\000R\237\000\000~\351\000\000\034\242\000"
+ "\000\346\347\000\000J\236\000\000\374\347\000\0004\242\000\000\362\351\000"
+ "\000\270\311\000\000\346\347\000\000\301\324\000\000\214\272\000\000\250"
+ "\321\000\000\305\353\000\000R\322\000\000\024\363\000\000\262\325\000\000"
+ "\335\365\000\000\011\341\000\0009\274\000\000n\331\000\000\015\367\000\000"
+ "S\332\000\000\351\365\000\000\020\334\000\000\223\366\000\000\350\335\000"
+ "\000\356\367\000\000\034\337\000\000\304\367\000\000\333\337\000\000\270"
+ "\374\000\000\264\341\000\000\217\367\000\000\016\357\000\000\253\367\000"
+ "\000O\354\000\000r\370\000\000~\202\000\000]\347\000\0000\200\000\000c\345"
+ "\000\000\001\200\000\000\277\345\000\000\255\212\000\000\324\346\000\000"
+ "U\226\000\0006\347\000\000\011\231\000\000\374\347\000\000\205\312\000\000"
+ "\215\355\000\000\324\310\000\000F\355\000\000F\313\000\000\305\353\000\000"
+ "\207\277\000\000\200\017\000\000\257\320\000\000\266\356\000\000\207\277"
+ "\000\000;\016\000\000\266\321\000\000j\360\000\000\364\321\000\000\042\363"
+ "\000\000\030\326\000\000;\027\000\000\275\325\000\000\273\024\000\000\310"
+ "\324\000\000M\027\000\000\003\325\000\000|\012\000\000=\330\000\000\212+"
+ "\000\000\247\327\000\000]!\000\000T\325\000\000w)\000\000~\331\000\000H:"
+ "\000\000}\321\000\000@7\000\000J\321\000\000\3477\000\000\134\331\000\000"
+ "49\000\000\352\324\000\000\373\013\000\000:\305\000\0009\011\000\000(\305"
+ "\000\000\000\012\000\000F\327\000\0000\013\000\000x\327\000\000c\014\000"
+ "\000\234\330\000\000\335\032\000\000\210\330\000\000\201\034\000\000t\347"
+ "\000\000\326\035\000\000p\365\000\000\320\036\000\000\242\351\000\000\332"
+ "\036\000\000\325\347\000\000\300\037\000\000d\351\000\000\244 \000\000\026"
+ "\367\000\000\030 \000\000E\367\000\000\206\037\000\000\244\331\000\000\017"
+ "0\000\000\027\332\000\000s>\000\000\363\331\000\000#9\000\000\304\332\000"
+ "\000\225:\000\000\360\342\000\000\275;\000\000\272\342\000\000u<\000\000"
+ "u\332\000\000\2763\000\000\345\343\000\000K\024\000\000/\345\000\000\024"
+ "\016\000\000j\342\000\000\355\022\000\000D\361\000\000\212\372\000\000\326"
+ "\345\000\000\352\014\000\000\205\357\000\000(\372\000\000\222\335\000\000"
+ "\326\377\000\000_\336\000\000\300\377\000\000\322\370\000\000Y\033\000\000"
+ "#\367\000\000j\026\000\000\255\366\000\000Y\033\000\000\011\371\000\000 "
+ ")\000\000\370\371\000\000f!\000\000}\370\000\0004)\000\000\224\372\000\000"
+ "\264.\000\000\262\375\000\000l'\000\000\233\373\000\000\317\042\000\000X"
+ "\373\000\000\225(\000\000\322\010\000\000%#\000\000\312\006\000\000m%\000"
+ "\000;\373\000\00084\000\000X\371\000\000y4\000\0006\373\000\000\030\034\000"
+ "\000\327\375\000\000r\034\000\000N\375\000\000\351\037\000\000\020\370\000"
+ "\000y \000\000Q\371\000\000\341\367\000\000\031\366\000\000\241\367\000\000"
+ "\271\373\000\000I@\000\000\243\362\000\000\240=\000\000\203\362\000\000u"
+ ">\000\000;\373\000\000\306>\000\000\337\373\000\000\003+\000\000}\374\000"
+ "\000tE\000\000s\374\000\000\366>\000\000\353\374\000\000T@\000\0000\006\000"
+ "\000\324@\000\000\353\374\000\000gE\000\000\020\006\000\000}A\000\000\210"
+ "\374\000\000\0224\000\000s\376\000\000\016,\000\000B\376\000\000\277.\000"
+ "\000\351\373\000\000\323\371\000\000\266\001\000\000\227\367\000\000\352"
+ "\372\000\000=\376\000\000\202\373\000\0000\376\000\000\001\376\000\000\301"
+ "\373\000\000\227\000\000\000\340\372\000\000\340\007\000\000%\013\000\000"
+ "\245\007\000\000\002\004\000\000\231\006\000\000V\011\000\000\301\006\000"
+ "\000\035\367\000\000\270\006\000\000\370\373\000\000\035\024\000\000B\010"
+ "\000\000\314\024\000\000\376\012\000\000\264\025\000\000Z\011\000\000d\023"
+ "\000\000\004\002\000\000\011\021\000\000\042\346\000\000;\024\000\000\344"
+ "\000\000\000\3053\000\000\207\273\000\000\134\032\000\000<\341\000\000\227"
+ ",\000\000u\351\000\000\3620\000\000\213\352\000\000\0064\000\0005\353\000"
+ "\000\303N\000\000\241\274\000\000\227G\000\000\001\346\000\000\277L\000\000"
+ "\217\344\000\000\032R\000\000\000\344\000\000\263.\000\000\015\362\000\000"
+ "C-\000\000\277\356\000\000\206,\000\0008\360\000\000\277+\000\000\215\355"
+ "\000\000\2370\000\000)\361\000\000\253\077\000\0007+\000\000\3209\000\000"
+ "{(\000\000\3044\000\000\355(\000\000y\077\000\000t)\000\000WA\000\000-.\000"
+ "\000\077@\000\000\022\017\000\000pA\000\000\256)\000\000zA\000\000M+\000"
+ "\0009L\000\000\264*\000\000\253K\000\0001,\000\000\032>\000\000,\015\000"
+ "\000\3239\000\000\320\012\000\000\2449\000\000\030\014\000\000L<\000\000"
+ "G\012\000\000\354<\000\000\201\002\000\000\352=\000\000\365\354\000\000G"
+ "\077\000\000\276\012\000\000VB\000\000\304\014\000\000\331A\000\000\321\016"
+ "\000\000:6\000\000\006\355\000\000\2623\000\000\006\355\000\000^:\000\000"
+ "9\353\000\000\0217\000\000\226\356\000\000\036:\000\000,\356\000\000\342"
+ ";\000\000\364\354\000\000\377@\000\000\034\355\000\000\227G\000\000%\353"
+ "\000\000\336M\000\000\240\353\000\0002J\000\000\351\352\000\000hY\000\000"
+ "D\276\000\000\314T\000\000%\345\000\000\204U\000\000\377\341\000\000\301"
+ "Y\000\000U\341\000\000\030b\000\000z\276\000\000\267^\000\000\220\342\000"
+ "\000^`\000\000\006\343\000\000\264l\000\000\003\275\000\000\300^\000\000"
+ "\344\342\000\000\214Z\000\000\003\366\000\000\301Y\000\000\351\365\000\000"
+ "N[\000\000\322\343\000\000\356Z\000\000E\364\000\000}r\000\000\200\341\000"
+ "\000xr\000\0002\325\000\000\234n\000\000\247\346\000\000}r\000\000\327\332"
+ "\000\000js\000\000a\331\000\000\330f\000\000\212\343\000\000&`\000\000Y\344"
+ "\000\000\032j\000\000\024\347\000\000\012l\000\000l\345\000\000\342l\000"
+ "\000\031\347\000\000\264s\000\000|\314\000\000\024{\000\000\027\276\000\000"
+ "\340\177\000\000\271\334\000\000\377\177\000\000\273\333\000\000tt\000\000"
+ "'\323\000\000\247x\000\000G\324\000\000\236x\000\000\243\323\000\000\371"
+ "}\000\000\363\307\000\000\177|\000\000\236\306\000\000G|\000\000Z\311\000"
+ "\000(v\000\0001\314\000\000nu\000\000D\317\000\000\322u\000\0007\317\000"
+ "\000%x\000\000\203\312\000\000}y\000\000\336\314\000\000\024|\000\0007\314"
+ "\000\000@}\000\000\301\302\000\000\236\027\000\000\366\347\000\000\014\027"
+ "\000\000\276\342\000\000\313\025\000\000L\346\000\000\212&\000\000$\275\000"
+ "\000\247\026\000\000\211\342\000\000\263\031\000\000\323\346\000\000\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010"
+ "\000\007\000\006\000\003\000\003\000\006\000\011\000\011\000\006\000\012"
+ "\000\013\000\011\000\014\000\011\000\013\000\004\000\011\000\004\000\003"
+ "\000\015\000\016\000\017\000\016\000\015\000\020\000\021\000\022\000\000"
+ "\000\022\000\021\000\023\000\022\000\023\000\024\000\022\000\024\000\025"
+ "\000\022\000\025\000\026\000\026\000\025\000\027\000\026\000\027\000\030"
+ "\000\026\000\030\000\031\000\026\000\031\000\032\000\026\000\032\000\033"
+ "\000\026\000\033\000\034\000\026\000\034\000\035\000\026\000\035\000\036"
+ "\000\036\000\035\000\037\000 \000!\000\042\000!\000 \000\002\000\002\000"
+ " \000\000\000\000\000 \000#\000\000\000#\000$\000\000\000$\000%\000\000\000"
+ "%\000\017\000\000\000\017\000\016\000\000\000\016\000\021\000&\000\021\000"
+ "'\000\021\000&\000(\000\021\000(\000\023\000)\000*\000+\000*\000)\000,\000"
+ "*\000,\000\023\000\023\000,\000\024\000\024\000,\000-\000.\000/\0000\000"
+ "\025\000\024\0001\0002\0003\0004\0005\0006\0007\0006\0005\0008\0009\000:"
+ "\000;\000:\0009\0001\0001\0009\000/\0001\000/\000\025\000\025\000/\000<\000"
+ "<\000/\000.\000<\000.\0003\000<\0003\000=\000=\0003\000>\000>\0003\000\077"
+ "\000\077\0003\0002\000>\000\077\000@\000>\000@\000A\000A\000@\000B\000B\000"
+ "@\000C\000B\000C\000D\000A\000B\000E\000A\000E\000F\0008\000\077\0002\000"
+ "\077\0008\000G\000G\0008\0005\000G\0005\000H\000G\000H\000I\000I\000H\000"
+ "J\000I\000J\000K\000K\000J\000L\000M\000G\000I\000N\000O\000P\000O\000N\000"
+ "Q\000O\000Q\000R\000R\000Q\000S\000=\000R\000<\000R\000=\000O\000T\000\032"
+ "\000\031\000\032\000T\000U\000V\000W\000X\000Y\000Z\000[\000Z\000Y\000\134"
+ "\000]\000^\000_\000^\000]\000`\000`\000]\000a\000b\000\134\000c\000\134\000"
+ "b\000d\000d\000b\000_\000d\000_\000^\000d\000^\000e\000e\000^\000f\000Z\000"
+ "V\000g\000V\000Z\000h\000h\000Z\000d\000d\000Z\000\134\000W\000h\000i\000"
+ "h\000W\000V\000j\000k\000l\000k\000j\000m\000m\000j\000b\000b\000j\000_\000"
+ "_\000j\000n\000n\000j\000o\000n\000o\000p\000p\000o\000q\000p\000q\000r\000"
+ "q\000o\000s\000r\000q\000t\000n\000u\000v\000u\000n\000p\000v\000u\000w\000"
+ "h\000x\000y\000x\000h\000z\000x\000z\000{\000y\000x\000|\000y\000|\000}\000"
+ "~\000\177\000\200\000\177\000\201\000\202\000\201\000\177\000\203\000\203"
+ "\000\177\000~\000\203\000~\000\204\000\203\000\204\000\205\000\201\000\206"
+ "\000\207\000\206\000\201\000\203\000\210\000\207\000\206\000\036\000\207"
+ "\000\026\000\207\000\036\000i\000\207\000i\000h\000\207\000h\000y\000\207"
+ "\000y\000\201\000\014\000\211\000\212\000\211\000\014\000\011\000\211\000"
+ "\011\000\213\000\211\000\213\000\214\000\211\000\214\000\215\000\211\000"
+ "\215\000\216\000\216\000\215\000\217\000\216\000\217\000\220\000\216\000"
+ "\220\000\221\000\222\000\223\000\224\000\223\000\213\000\225\000\213\000"
+ "\223\000\214\000\214\000\223\000\222\000\214\000\222\000\226\000\227\000"
+ "\230\000\231\000\230\000\227\000\232\000\233\000\234\000\227\000\234\000"
+ "\233\000\235\000\235\000\233\000\236\000\235\000\236\000\237\000\237\000"
+ "\236\000\240\000\241\000\242\000\243\000\242\000\241\000\244\000\244\000"
+ "\241\000\245\000\245\000\241\000\246\000\246\000\241\000\247\000\247\000"
+ "\241\000\232\000\247\000\232\000\234\000\247\000\234\000\250\000\234\000"
+ "\232\000\227\000\250\000\234\000\251\000\252\000\215\000\253\000\215\000"
+ "\252\000\254\000\215\000\254\000\217\000\254\000\252\000\255\000\254\000"
+ "\255\000\256\000\217\000\254\000\257\000\217\000\257\000\246\000\246\000"
+ "\257\000\245\000\217\000\246\000\260\000\217\000\260\000\261\000\262\000"
+ "\220\000\263\000\220\000\262\000\221\000\221\000\264\000\216\000\264\000"
+ "\221\000\265\000\264\000\265\000\266\000\264\000\266\000\267\000\264\000"
+ "\267\000\270\000\271\000\270\000\267\000\270\000\271\000\272\000\270\000"
+ "\272\000\273\000\274\000\271\000\267\000\275\000\267\000\276\000\267\000"
+ "\275\000\277\000\267\000\277\000\274\000\277\000\275\000\300\000\301\000"
+ "\302\000\303\000\302\000\301\000\304\000\302\000\304\000\305\000\306\000"
+ "\272\000\307\000\272\000\306\000\273\000\273\000\306\000\310\000\273\000"
+ "\310\000\311\000\273\000\311\000\312\000\273\000\312\000\313\000\273\000"
+ "\313\000\314\000\313\000\312\000\303\000\313\000\303\000\302\000\315\000"
+ "\305\000\304\000\305\000\315\000\316\000\302\000\317\000\313\000\317\000"
+ "\302\000\320\000\317\000\320\000\321\000\322\000\323\000\324\000\313\000"
+ "\325\000\314\000\325\000\313\000\326\000\325\000\326\000\327\000\314\000"
+ "\325\000\330\000\314\000\330\000\331\000\314\000\331\000\332\000\314\000"
+ "\332\000\324\000\314\000\324\000\323\000\314\000\323\000\333\000\334\000"
+ "\335\000\336\000\207\000\337\000\026\000\337\000\207\000\340\000\337\000"
+ "\340\000\335\000\337\000\335\000\334\000\337\000\334\000\212\000\212\000"
+ "\334\000\341\000\337\000\212\000\211\000\000\000\001\000\001\000\002\000"
+ "\000\000\002\000\003\000\004\000\004\000\005\000\003\000\005\000\006\000"
+ "\007\000\007\000\010\000\006\000\010\000\003\000\006\000\003\000\007\000"
+ "\006\000\011\000\003\000\011\000\006\000\012\000\011\000\012\000\011\000"
+ "\013\000\011\000\014\000\013\000\014\000\004\000\013\000\004\000\011\000"
+ "\015\000\016\000\016\000\017\000\015\000\017\000\015\000\020\000\016\000"
+ "\020\000\021\000\022\000\000\000\022\000\000\000\021\000\021\000\023\000"
+ "\022\000\023\000\023\000\024\000\022\000\024\000\024\000\025\000\022\000"
+ "\025\000\025\000\026\000\022\000\026\000\025\000\027\000\026\000\027\000"
+ "\027\000\030\000\026\000\030\000\030\000\031\000\026\000\031\000\031\000"
+ "\032\000\026\000\032\000\032\000\033\000\026\000\033\000\033\000\034\000"
+ "\026\000\034\000\034\000\035\000\026\000\035\000\035\000\036\000\026\000"
+ "\036\000\035\000\037\000\036\000\037\000 \000!\000!\000\042\000 \000\042"
+ "\000\002\000 \000\002\000!\000\000\000 \000 \000#\000\000\000#\000#\000$"
+ "\000\000\000$\000$\000%\000\000\000%\000\017\000%\000\000\000\017\000\000"
+ "\000\016\000\016\000\021\000\021\000&\000\021\000'\000&\000'\000&\000(\000"
+ "\021\000(\000\023\000(\000)\000*\000*\000+\000)\000+\000)\000,\000*\000,"
+ "\000\023\000,\000\023\000*\000\024\000,\000,\000-\000\024\000-\000.\000/"
+ "\000/\0000\000.\0000\000\024\0001\000\025\0001\0002\0003\0003\0004\0002\000"
+ "4\0005\0006\0006\0007\0005\0007\0005\0008\0006\0008\0009\000:\000:\000;\000"
+ "9\000;\0001\0009\0001\000:\000/\0009\000/\0001\000\025\000/\000/\000<\000"
+ "\025\000<\000.\000<\000.\0003\0003\000<\0003\000=\000<\000=\0003\000>\000"
+ "=\000>\0003\000\077\000>\000\077\0002\000\077\000\077\000@\000>\000@\000"
+ "@\000A\000>\000A\000@\000B\000A\000B\000@\000C\000B\000C\000C\000D\000B\000"
+ "D\000B\000E\000A\000E\000E\000F\000A\000F\0008\000\077\0002\0008\0008\000"
+ "G\000\077\000G\0005\000G\0005\000H\000G\000H\000H\000I\000G\000I\000H\000"
+ "J\000I\000J\000J\000K\000I\000K\000J\000L\000K\000L\000G\000M\000I\000M\000"
+ "N\000O\000O\000P\000N\000P\000N\000Q\000O\000Q\000Q\000R\000O\000R\000Q\000"
+ "S\000R\000S\000=\000R\000<\000R\000=\000O\000\032\000T\000\031\000T\000T"
+ "\000U\000\032\000U\000V\000W\000W\000X\000V\000X\000Y\000Z\000Z\000[\000"
+ "Y\000[\000Y\000\134\000Z\000\134\000]\000^\000^\000_\000]\000_\000]\000`"
+ "\000^\000`\000]\000a\000`\000a\000\134\000b\000\134\000c\000b\000c\000b\000"
+ "d\000\134\000d\000_\000b\000_\000d\000^\000d\000^\000e\000d\000e\000^\000"
+ "f\000e\000f\000V\000Z\000V\000g\000Z\000g\000Z\000h\000V\000h\000Z\000d\000"
+ "d\000h\000W\000h\000h\000i\000W\000i\000j\000k\000k\000l\000j\000l\000j\000"
+ "m\000k\000m\000b\000j\000b\000m\000_\000j\000j\000n\000_\000n\000j\000o\000"
+ "n\000o\000o\000p\000n\000p\000o\000q\000p\000q\000q\000r\000p\000r\000o\000"
+ "s\000q\000s\000q\000t\000r\000t\000n\000u\000u\000v\000n\000v\000p\000u\000"
+ "u\000w\000v\000w\000h\000x\000x\000y\000h\000y\000h\000z\000x\000z\000z\000"
+ "{\000x\000{\000x\000|\000y\000|\000|\000}\000y\000}\000~\000\177\000\177"
+ "\000\200\000~\000\200\000\177\000\201\000\201\000\202\000\177\000\202\000"
+ "\177\000\203\000\201\000\203\000~\000\203\000~\000\204\000\203\000\204\000"
+ "\204\000\205\000\203\000\205\000\201\000\206\000\206\000\207\000\201\000"
+ "\207\000\203\000\206\000\207\000\210\000\206\000\210\000\036\000\207\000"
+ "\026\000\207\000\036\000i\000i\000\207\000h\000\207\000y\000\207\000y\000"
+ "\201\000\014\000\211\000\211\000\212\000\014\000\212\000\011\000\211\000"
+ "\011\000\213\000\211\000\213\000\213\000\214\000\211\000\214\000\214\000"
+ "\215\000\211\000\215\000\215\000\216\000\211\000\216\000\215\000\217\000"
+ "\216\000\217\000\217\000\220\000\216\000\220\000\220\000\221\000\216\000"
+ "\221\000\222\000\223\000\223\000\224\000\222\000\224\000\213\000\223\000"
+ "\213\000\225\000\223\000\225\000\214\000\223\000\214\000\222\000\222\000"
+ "\226\000\214\000\226\000\227\000\230\000\230\000\231\000\227\000\231\000"
+ "\227\000\232\000\230\000\232\000\233\000\234\000\227\000\234\000\227\000"
+ "\233\000\233\000\235\000\234\000\235\000\233\000\236\000\235\000\236\000"
+ "\236\000\237\000\235\000\237\000\236\000\240\000\237\000\240\000\241\000"
+ "\242\000\242\000\243\000\241\000\243\000\241\000\244\000\242\000\244\000"
+ "\241\000\245\000\244\000\245\000\241\000\246\000\245\000\246\000\241\000"
+ "\247\000\246\000\247\000\232\000\241\000\232\000\247\000\232\000\234\000"
+ "\234\000\247\000\234\000\250\000\247\000\250\000\234\000\251\000\250\000"
+ "\251\000\215\000\252\000\215\000\253\000\252\000\253\000\252\000\254\000"
+ "\215\000\254\000\217\000\254\000\252\000\255\000\254\000\255\000\255\000"
+ "\256\000\254\000\256\000\254\000\257\000\217\000\257\000\246\000\257\000"
+ "\217\000\246\000\245\000\257\000\246\000\260\000\217\000\260\000\260\000"
+ "\261\000\217\000\261\000\220\000\262\000\220\000\263\000\262\000\263\000"
+ "\221\000\262\000\221\000\264\000\216\000\264\000\221\000\265\000\264\000"
+ "\265\000\265\000\266\000\264\000\266\000\266\000\267\000\264\000\267\000"
+ "\267\000\270\000\264\000\270\000\270\000\271\000\267\000\271\000\271\000"
+ "\272\000\270\000\272\000\272\000\273\000\270\000\273\000\271\000\274\000"
+ "\267\000\274\000\267\000\275\000\267\000\276\000\275\000\276\000\275\000"
+ "\277\000\267\000\277\000\274\000\277\000\275\000\300\000\277\000\300\000"
+ "\301\000\302\000\302\000\303\000\301\000\303\000\301\000\304\000\302\000"
+ "\304\000\304\000\305\000\302\000\305\000\272\000\306\000\272\000\307\000"
+ "\306\000\307\000\273\000\306\000\306\000\310\000\273\000\310\000\310\000"
+ "\311\000\273\000\311\000\311\000\312\000\273\000\312\000\312\000\313\000"
+ "\273\000\313\000\313\000\314\000\273\000\314\000\303\000\312\000\303\000"
+ "\313\000\302\000\313\000\305\000\315\000\304\000\315\000\315\000\316\000"
+ "\305\000\316\000\302\000\317\000\313\000\317\000\302\000\320\000\317\000"
+ "\320\000\320\000\321\000\317\000\321\000\322\000\323\000\323\000\324\000"
+ "\322\000\324\000\313\000\325\000\314\000\325\000\313\000\326\000\325\000"
+ "\326\000\326\000\327\000\325\000\327\000\325\000\330\000\314\000\330\000"
+ "\330\000\331\000\314\000\331\000\331\000\332\000\314\000\332\000\324\000"
+ "\332\000\314\000\324\000\314\000\323\000\323\000\333\000\314\000\333\000"
+ "\334\000\335\000\335\000\336\000\334\000\336\000\207\000\337\000\026\000"
+ "\337\000\207\000\340\000\337\000\340\000\335\000\340\000\335\000\337\000"
+ "\334\000\337\000\212\000\334\000\212\000\337\000\334\000\341\000\212\000"
+ "\341\000\211\000\337\000\362\200\000\000\325\324\000\000N\200\000\000T\323"
+ "\000\0004\200\000\000\376\323\000\000H\205\000\000\312\325\000\000\035\202"
+ "\000\000;\325\000\000\035\202\000\000\312\325\000\000\210\202\000\000c\317"
+ "\000\000\276\204\000\000Z\316\000\0004\205\000\000\364\315\000\000\246\205"
+ "\000\000C\314\000\000\311\205\000\000\035\325\000\000\363\205\000\000\237"
+ "\311\000\000/\206\000\000C\324\000\000\276\206\000\000\221\307\000\000\361"
+ "\206\000\000\242\323\000\000\006\213\000\000V\301\000\000\034\210\000\000"
+ "\205\323\000\000\240\210\000\0009\323\000\000\363\214\000\000n\323\000\000"
+ "_\213\000\000\244\277\000\000\316\213\000\000\031\300\000\000\305\217\000"
+ "\000S\272\000\000P\216\000\000\042\323\000\000\233\222\000\000\212\322\000"
+ "\000\036\213\000\000\035\277\000\000\020\200\000\000!\322\000\000\001\200"
+ "\000\000]\321\000\000\255\353\000\0003\353\000\000\003\353\000\000\212\263"
+ "\000\000\003\336\000\000\231\347\000\000[\361\000\000\007\262\000\000=\355"
+ "\000\0003\353\000\0000\377\000\000\337\340\000\000\334\364\000\000\007\262"
+ "\000\000\270\365\000\000\212\262\000\000\325\210\000\000Q\326\000\000<\210"
+ "\000\000+\325\000\000\326\212\000\000\032\326\000\000+\214\000\000\263\325"
+ "\000\000\260\214\000\000l\324\000\000U\222\000\000\337\325\000\000>\222\000"
+ "\000\024\323\000\000\241\221\000\000-\325\000\000\367\222\000\000\016\324"
+ "\000\000\042\223\000\000\005\325\000\000\255\216\000\000\375\323\000\000"
+ "\362\216\000\000C\325\000\000\255\217\000\000\326\325\000\000\202\233\000"
+ "\000t\271\000\000y\223\000\000\077\322\000\000\201\225\000\000I\322\000\000"
+ "[\227\000\000\015\322\000\000{\230\000\000g\322\000\000\023\231\000\000\214"
+ "\321\000\000i\236\000\000\226\321\000\000\342\237\000\000\313\320\000\000"
+ "s\241\000\000!\320\000\000*\243\000\000!\320\000\000\302\251\000\0005\320"
+ "\000\000\245\243\000\000M\320\000\000E\243\000\000\317\320\000\000u\243\000"
+ "\000\270\320\000\000\200\244\000\000~\320\000\000]\245\000\000\235\320\000"
+ "\000\307\244\000\000\315\320\000\000\367\237\000\000\233\321\000\000\263"
+ "\240\000\000\256\321\000\000=\245\000\000\375\323\000\000\220\245\000\000"
+ ")\321\000\000\370\244\000\000N\322\000\000\322\245\000\000\240\324\000\000"
+ "\260\250\000\000\345\320\000\000c\246\000\000\020\324\000\000\257\246\000"
+ "\000\227\324\000\000\331\247\000\000\227\324\000\000{\250\000\000b\322\000"
+ "\000x\250\000\000b\323\000\000\034\252\000\0009\322\000\000\373\265\000\000"
+ "\230\320\000\000J\264\000\000\233\320\000\000\244\263\000\000\327\320\000"
+ "\000\015\263\000\000\306\321\000\000\274\253\000\000\374\320\000\000\273"
+ "\254\000\000\232\321\000\000\251\256\000\000e\322\000\000\371\260\000\000"
+ "^\322\000\000{\261\000\000\316\322\000\000V\264\000\000\221\330\000\000t"
+ "\265\000\000\221\330\000\000n\266\000\000\251\321\000\000\003\267\000\000"
+ "U\322\000\000\306\267\000\000\225\322\000\000\271\270\000\000\237\323\000"
+ "\000D\271\000\000)\327\000\000\202\271\000\000\317\327\000\000\203\271\000"
+ "\000\370\330\000\000N\306\000\0008\336\000\000'\310\000\000\337\350\000\000"
+ "E\314\000\000\224\344\000\000z\307\000\000\221\350\000\000\373\325\000\000"
+ "t\351\000\000E\314\000\0009\343\000\000!\306\000\000'\341\000\000\000\306"
+ "\000\000{\341\000\000\201\327\000\000\312\352\000\000J\331\000\000\273\353"
+ "\000\000V\335\000\000A\350\000\000\222\334\000\000\363\352\000\000\025\306"
+ "\000\000\214\337\000\000A\346\000\000\241\372\000\000\306\345\000\0000\370"
+ "\000\000\246\345\000\000T\372\000\000U\336\000\000@\353\000\000\322\336\000"
+ "\000\016\355\000\000\324\336\000\000\252\367\000\000\244\346\000\000+\370"
+ "\000\000:\352\000\000*\370\000\000\315\353\000\000\233\367\000\000\271\370"
+ "\000\000\341\356\000\000\003\370\000\000\257\354\000\000\330\367\000\000"
+ "T\356\000\000\262\370\000\000\275\355\000\000\035\371\000\0004\356\000\000"
+ "\347\377\000\000d\353\000\0000\377\000\000Q\352\000\000h\372\000\000d\353"
+ "\000\000\033\357\000\000\360\354\000\000\315\360\000\000\032\354\000\000"
+ "\037\357\000\000\305\355\000\000y\357\000\000p\356\000\000\016\367\000\000"
+ "\177\353\000\000~\367\000\000\364\354\000\000\373\370\000\000%\355\000\000"
+ "\221\371\000\000%\355\000\000!\372\000\000\234\354\000\000T\017\000\000\234"
+ "\260\000\0007)\000\000@\312\000\000@)\000\000\077\312\000\000\357\001\000"
+ "\000\204\342\000\000\255\001\000\0003\341\000\000\371\377\000\000\252\342"
+ "\000\000\221\006\000\000\025\341\000\000g\004\000\000\370\337\000\000\023"
+ "\004\000\000\025\341\000\000\347\007\000\000\031\341\000\000\346\007\000"
+ "\000\271\337\000\0006\007\000\000\031\341\000\000S\024\000\000^\335\000\000"
+ "R\020\000\000\336\334\000\000\253\010\000\000$\335\000\000\271\023\000\000"
+ "\335\334\000\000t\034\000\000\377\332\000\000\372\033\000\000S\331\000\000"
+ "r\033\000\000x\333\000\000@\035\000\000U\331\000\000\266\003\000\000\210"
+ "\337\000\000\355\002\000\000!\341\000\000\246\003\000\000\377\337\000\000"
+ "\245\003\000\000_\340\000\000\014\007\000\000\006\340\000\000\246\020\000"
+ "\000a\334\000\0003\023\000\000\343\333\000\000@\025\000\000\032\333\000\000"
+ "\316\025\000\000\357\333\000\000:\026\000\000\257\333\000\000\344\027\000"
+ "\000\335\333\000\000\372\033\000\0005\330\000\000\001\032\000\000\323\333"
+ "\000\000\340\037\000\000\342\327\000\000\014#\000\000\026\327\000\000\271"
+ "&\000\000)\324\000\000|'\000\000\226\321\000\000-'\000\000;\323\000\000T"
+ "(\000\000\022\320\000\000\357(\000\000x\317\000\0004)\000\000\364\315\000"
+ "\000\223)\000\000\221\312\000\000\320t\000\000\242\274\000\000\134t\000\000"
+ "\322\272\000\000%q\000\000\210\323\000\000\303^\000\000\015\254\000\000\361"
+ "R\000\000\206\253\000\000\326t\000\000\027\253\000\000\265.\000\000Z\311"
+ "\000\000:-\000\000\252\311\000\000RV\000\000\263\316\000\000\077d\000\000"
+ "V\321\000\000\001e\000\000\244\321\000\000\026g\000\000\027\322\000\000P"
+ "f\000\000V\322\000\000zq\000\000\302\327\000\000\235p\000\000\352\325\000"
+ "\000Mq\000\000b\325\000\000zq\000\000[\326\000\000\325q\000\000\356\326\000"
+ "\000Kr\000\000b\325\000\000\213q\000\000F\324\000\000Kr\000\000g\324\000"
+ "\000\364r\000\000\331\323\000\000\341w\000\000\236\337\000\000\246w\000\000"
+ ">\335\000\000\234w\000\000\367\335\000\000\332w\000\0001\334\000\000\342"
+ "w\000\000\262\324\000\000\000x\000\000Y\341\000\000\327x\000\000\246\324"
+ "\000\000Zx\000\000\265\337\000\000\344{\000\000\275\315\000\000A\177\000"
+ "\000\331\325\000\000\377\177\000\000N\325\000\000\326\177\000\000\276\325"
+ "\000\000\003*\000\000\306\313\000\000\270*\000\000\331\314\000\000\323+\000"
+ "\000\217\313\000\000\356*\000\000\024\315\000\000[+\000\000\026\315\000\000"
+ "\334,\000\000\323\313\000\000\204\331\000\000\351T\000\000X\331\000\000\015"
+ "Q\000\000\011\331\000\000yT\000\000\306\331\000\000\3332\000\000\177\331"
+ "\000\000,1\000\000\331\330\000\000\2211\000\000\246\331\000\000\321.\000"
+ "\000c\324\000\000\242Q\000\000\341\324\000\0000Q\000\000\327\322\000\000"
+ "\305Q\000\000\236\324\000\000\225Q\000\000Q\331\000\000\205P\000\000T\331"
+ "\000\000\277@\000\000\222\331\000\000-\077\000\000\314\331\000\000\346P\000"
+ "\000\024\332\000\000zT\000\000\222\331\000\000a=\000\000\223\331\000\000"
+ "24\000\0001\331\000\000\003+\000\000\202\331\000\000\261*\000\000\033\331"
+ "\000\000\327*\000\000\317\331\000\000\241 \000\000\321\331\000\000\030L\000"
+ "\000\021\332\000\000NP\000\000\213\342\000\000<O\000\0005\342\000\000\326"
+ "N\000\000\217\331\000\000[\036\000\000\321\331\000\000\306\035\000\000H\331"
+ "\000\000e\035\000\000\230\331\000\000U\037\000\000\017\332\000\000RJ\000"
+ "\000\027\332\000\000\222H\000\000\021\332\000\000$G\000\000\257\332\000\000"
+ "RF\000\000\256\332\000\000\022G\000\000\025\332\000\000\215@\000\000\022"
+ "\332\000\000!>\000\0005\332\000\000:\077\000\000\331\332\000\000\3611\000"
+ "\000\215\332\000\000`1\000\000Q\332\000\000\3412\000\000\202\333\000\000"
+ "\3720\000\000\365\332\000\000\002+\000\000\322\332\000\000p)\000\000\221"
+ "\332\000\000_,\000\000\307\333\000\000W\034\000\000\262\333\000\000\273\033"
+ "\000\000\323\332\000\000\270$\000\000 \330\000\000\077\032\000\0007\320\000"
+ "\000\200\032\000\000\321\317\000\000\360\032\000\000J\331\000\000|\031\000"
+ "\000.\331\000\000o\032\000\000\272\331\000\000!\032\000\000\263\333\000\000"
+ "4\033\000\000\324\333\000\000\235\032\000\0002\334\000\000\002\032\000\000"
+ "\222\334\000\0001\031\000\000}\345\000\0006\031\000\000X\346\000\000\323"
+ "\030\000\000u\331\000\000I<\000\000p\331\000\00090\000\000\254\330\000\000"
+ "\325/\000\000\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000\177\000"
+ "\177\000\177\000\177\000\000\001\000\002\000\003\000\004\000\005\000\004"
+ "\000\003\000\006\000\006\000\003\000\007\000\007\000\003\000\010\000\010"
+ "\000\003\000\011\000\011\000\003\000\012\000\011\000\012\000\013\000\013"
+ "\000\012\000\014\000\013\000\014\000\015\000\015\000\014\000\016\000\015"
+ "\000\016\000\017\000\017\000\016\000\020\000\017\000\020\000\021\000\017"
+ "\000\021\000\022\000\017\000\022\000\023\000\023\000\022\000\024\000\024"
+ "\000\022\000\025\000\025\000\022\000\026\000\025\000\026\000\027\000\024"
+ "\000\030\000\023\000\031\000\006\000\032\000\006\000\031\000\001\000\006"
+ "\000\001\000\000\000\006\000\000\000\004\000\033\000\034\000\035\000\034"
+ "\000\033\000\036\000\036\000\033\000\037\000\036\000\037\000 \000\036\000"
+ " \000!\000!\000 \000\042\000#\000\021\000$\000\021\000#\000\022\000\022\000"
+ "#\000%\000\022\000%\000&\000\022\000&\000'\000(\000)\000*\000)\000(\000+"
+ "\000+\000(\000,\000-\000\027\000\026\000\027\000-\000.\000\027\000.\000/"
+ "\000\027\000/\000)\000)\000/\000*\000\027\0000\000\025\0000\000\027\0001"
+ "\0000\0001\0002\0000\0002\0003\0000\0003\0004\0000\0004\0005\0006\0000\000"
+ "5\0000\0006\0007\0000\0007\0008\0000\0008\0009\0000\0009\000:\000:\0009\000"
+ ";\000;\0009\000<\000;\000<\000=\000:\000;\000>\000:\000>\000\077\000\077"
+ "\000>\000@\000A\0008\0007\0008\000A\000B\000C\000D\000E\000D\000C\000F\000"
+ "D\000:\000\077\000:\000D\000G\000G\000D\000F\000G\000F\000H\000G\000H\000"
+ "I\000G\000I\000J\000G\000J\000K\000K\000J\000L\000:\000G\000M\000:\000N\000"
+ "0\000N\000:\000O\000O\000:\000P\000P\000:\000Q\000R\000Q\000:\000Q\000R\000"
+ "S\000Q\000S\000T\000Q\000T\000U\000Q\000U\000V\000Q\000V\000W\000Q\000W\000"
+ "X\000N\000\034\0000\000\034\000N\000Y\000\034\000Y\000Z\000\034\000Z\000"
+ "[\000\034\000[\000\134\000\034\000\134\000]\000\034\000]\000^\000\034\000"
+ "^\000_\000`\000\034\000_\000\034\000`\000\035\000a\000b\000c\000b\000a\000"
+ "d\000b\000d\000e\000e\000f\000g\000f\000e\000`\000`\000e\000\035\000\035"
+ "\000e\000d\000\035\000d\000h\000\035\000h\000i\000\035\000i\000j\000j\000"
+ "i\000k\000`\000l\000f\000m\000n\000o\000p\000\033\000\035\000\033\000p\000"
+ "q\000\033\000q\000r\000\033\000r\000n\000\033\000n\000s\000s\000n\000m\000"
+ "\033\000s\000t\000\033\000t\000u\000v\000w\000x\000w\000v\000y\000y\000v"
+ "\000z\000{\000|\000}\000~\000 \000\037\000 \000~\000\177\000\177\000~\000"
+ "\200\000\177\000\200\000\201\000 \000\177\000\202\000 \000\202\000\203\000"
+ " \000\203\000w\000 \000w\000\204\000\204\000w\000y\000 \000\204\000\205\000"
+ " \000\205\000}\000}\000\205\000\206\000 \000}\000|\000 \000\207\000\042\000"
+ "\207\000 \000\210\000\207\000\210\000\211\000\212\000\213\000\214\000\215"
+ "\000\216\000\217\000\220\000\221\000\222\000\223\000\224\000\225\000\224"
+ "\000\223\000\226\000\227\000\230\000\231\000\230\000\227\000\232\000 \000"
+ "\233\000\210\000\233\000 \000\213\000\213\000 \000\214\000\233\000\213\000"
+ "\234\000\233\000\234\000\235\000\235\000\234\000\236\000\210\000\233\000"
+ "\225\000\225\000\233\000\216\000\225\000\216\000\237\000\237\000\216\000"
+ "\215\000\225\000\237\000\222\000\225\000\222\000\221\000\210\000\225\000"
+ "\240\000\240\000\225\000\224\000\210\000\240\000\241\000\210\000\241\000"
+ "\242\000\210\000\242\000\243\000\210\000\243\000\244\000\210\000\244\000"
+ "\245\000\210\000\245\000\246\000\246\000\245\000\247\000\246\000\247\000"
+ "\231\000\246\000\231\000\230\000\210\000\246\000\250\000\210\000\250\000"
+ "\251\000\210\000\251\000\252\000\210\000\252\000\253\000\253\000\252\000"
+ "\254\000\210\000\253\000\255\000\210\000\255\000\256\000\210\000\256\000"
+ "\257\000\260\000\211\000\210\000\261\000\262\000\263\000\263\000\264\000"
+ "\265\000\264\000\263\000\266\000\266\000\263\000\262\000\267\000\265\000"
+ "\270\000\265\000\267\000\271\000\265\000\271\000\263\000\263\000\271\000"
+ "\272\000\263\000\272\000\273\000\263\000\273\000\274\000\274\000\273\000"
+ "\275\000\276\000\263\000\277\000\263\000\276\000\300\000\300\000\276\000"
+ "\301\000\301\000\276\000\302\000\303\000\304\000\300\000\304\000\303\000"
+ "\305\000\263\000\304\000\306\000\304\000\263\000\300\000\307\000\310\000"
+ "\311\000\310\000\307\000\312\000\312\000\307\000\313\000\313\000\307\000"
+ "\314\000\313\000\314\000\315\000\315\000\314\000\316\000\306\000\261\000"
+ "\263\000\261\000\306\000\313\000\261\000\313\000\317\000\317\000\313\000"
+ "\315\000\317\000\315\000\320\000\317\000\320\000\321\000\321\000\320\000"
+ "\322\000\211\000\265\000\207\000\265\000\211\000\270\000\260\000\270\000"
+ "\211\000\270\000\260\000\323\000\270\000\323\000\324\000\270\000\324\000"
+ "\325\000\325\000\324\000\326\000\325\000\326\000\327\000\270\000\325\000"
+ "\330\000\331\000\332\000\333\000\334\000\335\000\336\000\335\000\334\000"
+ "\337\000\340\000\341\000\342\000\341\000\340\000\343\000\341\000\343\000"
+ "\332\000\341\000\332\000\344\000\344\000\332\000\345\000\345\000\332\000"
+ "\346\000\346\000\332\000\331\000\346\000\331\000\347\000\347\000\331\000"
+ "\350\000\346\000\347\000\351\000\351\000\347\000\352\000\352\000\347\000"
+ "\334\000\353\000\354\000\355\000\354\000\353\000\337\000\354\000\337\000"
+ "\356\000\356\000\337\000\334\000\356\000\334\000\347\000\356\000\347\000"
+ "\357\000\357\000\347\000\360\000\360\000\347\000\361\000\360\000\361\000"
+ "\362\000\363\000\364\000\365\000\364\000\363\000\366\000\364\000\366\000"
+ "\356\000\364\000\356\000\357\000\364\000\357\000\367\000\370\000\371\000"
+ "\367\000\371\000\370\000\372\000\372\000\370\000\373\000\374\000\375\000"
+ "\371\000\375\000\374\000\376\000\377\000\000\001\001\001\000\001\377\000"
+ "\002\001\003\001\004\001\005\001\006\001\007\001\010\001\011\001\012\001"
+ "\013\001\012\001\011\001\014\001\014\001\011\001\015\001\014\001\015\001"
+ "\016\001\014\001\016\001i\000i\000\016\001k\000k\000\016\001\364\000k\000"
+ "\364\000\001\001\001\001\364\000\375\000\375\000\364\000\367\000\375\000"
+ "\367\000\371\000k\000\001\001\005\001\005\001\001\001\000\001k\000\005\001"
+ "\010\001\010\001\005\001\004\001k\000\010\001\017\001\017\001\010\001\007"
+ "\001k\000\017\001\020\001k\000\020\001\021\001k\000\021\001\022\001\022\001"
+ "\021\001\023\001\022\001\023\001\024\001\352\000\025\001\351\000\335\000"
+ "\026\001\027\001\026\001\335\000\337\000\000\000\000\000\001\000\001\000"
+ "\002\000\000\000\002\000\003\000\004\000\004\000\005\000\003\000\005\000"
+ "\003\000\006\000\004\000\006\000\003\000\007\000\006\000\007\000\003\000"
+ "\010\000\007\000\010\000\003\000\011\000\010\000\011\000\003\000\012\000"
+ "\011\000\012\000\012\000\013\000\011\000\013\000\012\000\014\000\013\000"
+ "\014\000\014\000\015\000\013\000\015\000\014\000\016\000\015\000\016\000"
+ "\016\000\017\000\015\000\017\000\016\000\020\000\017\000\020\000\020\000"
+ "\021\000\017\000\021\000\021\000\022\000\017\000\022\000\022\000\023\000"
+ "\017\000\023\000\022\000\024\000\023\000\024\000\022\000\025\000\024\000"
+ "\025\000\022\000\026\000\025\000\026\000\026\000\027\000\025\000\027\000"
+ "\024\000\030\000\023\000\030\000\006\000\031\000\006\000\032\000\031\000"
+ "\032\000\001\000\031\000\001\000\006\000\000\000\006\000\000\000\004\000"
+ "\033\000\034\000\034\000\035\000\033\000\035\000\033\000\036\000\034\000"
+ "\036\000\033\000\037\000\036\000\037\000\037\000 \000\036\000 \000 \000!"
+ "\000\036\000!\000 \000\042\000!\000\042\000\021\000#\000\021\000$\000#\000"
+ "$\000\022\000#\000#\000%\000\022\000%\000%\000&\000\022\000&\000&\000'\000"
+ "\022\000'\000(\000)\000)\000*\000(\000*\000(\000+\000)\000+\000(\000,\000"
+ "+\000,\000\027\000-\000\026\000-\000-\000.\000\027\000.\000.\000/\000\027"
+ "\000/\000)\000/\000\027\000)\000*\000/\000\027\0000\000\025\0000\000\027"
+ "\0001\0000\0001\0001\0002\0000\0002\0002\0003\0000\0003\0003\0004\0000\000"
+ "4\0004\0005\0000\0005\0000\0006\0005\0006\0006\0007\0000\0007\0007\0008\000"
+ "0\0008\0008\0009\0000\0009\0009\000:\0000\000:\0009\000;\000:\000;\0009\000"
+ "<\000;\000<\000<\000=\000;\000=\000;\000>\000:\000>\000>\000\077\000:\000"
+ "\077\000>\000@\000\077\000@\0008\000A\0007\000A\000A\000B\0008\000B\000C"
+ "\000D\000D\000E\000C\000E\000C\000F\000D\000F\000:\000D\000\077\000D\000"
+ "D\000G\000:\000G\000F\000G\000F\000H\000G\000H\000H\000I\000G\000I\000I\000"
+ "J\000G\000J\000J\000K\000G\000K\000J\000L\000K\000L\000G\000M\000:\000M\000"
+ ":\000N\0000\000N\000:\000O\000N\000O\000:\000P\000O\000P\000:\000Q\000P\000"
+ "Q\000Q\000R\000:\000R\000R\000S\000Q\000S\000S\000T\000Q\000T\000T\000U\000"
+ "Q\000U\000U\000V\000Q\000V\000V\000W\000Q\000W\000W\000X\000Q\000X\000\034"
+ "\000N\000\034\0000\000N\000Y\000\034\000Y\000Y\000Z\000\034\000Z\000Z\000"
+ "[\000\034\000[\000[\000\134\000\034\000\134\000\134\000]\000\034\000]\000"
+ "]\000^\000\034\000^\000^\000_\000\034\000_\000\034\000`\000_\000`\000\035"
+ "\000`\000a\000b\000b\000c\000a\000c\000a\000d\000b\000d\000d\000e\000b\000"
+ "e\000e\000f\000f\000g\000e\000g\000`\000e\000`\000f\000\035\000e\000\035"
+ "\000d\000d\000h\000\035\000h\000h\000i\000\035\000i\000i\000j\000\035\000"
+ "j\000i\000k\000j\000k\000`\000l\000f\000l\000m\000n\000n\000o\000m\000o\000"
+ "\033\000p\000\035\000p\000p\000q\000\033\000q\000q\000r\000\033\000r\000"
+ "n\000r\000\033\000n\000n\000s\000\033\000s\000m\000s\000s\000t\000\033\000"
+ "t\000t\000u\000\033\000u\000v\000w\000w\000x\000v\000x\000v\000y\000w\000"
+ "y\000v\000z\000y\000z\000{\000|\000|\000}\000{\000}\000 \000~\000\037\000"
+ "~\000~\000\177\000 \000\177\000~\000\200\000\177\000\200\000\200\000\201"
+ "\000\177\000\201\000\177\000\202\000 \000\202\000\202\000\203\000 \000\203"
+ "\000w\000\203\000 \000w\000w\000\204\000 \000\204\000y\000\204\000\204\000"
+ "\205\000 \000\205\000}\000\205\000 \000}\000\205\000\206\000}\000\206\000"
+ " \000|\000 \000\207\000\042\000\207\000 \000\210\000\207\000\210\000\210"
+ "\000\211\000\207\000\211\000\212\000\213\000\213\000\214\000\212\000\214"
+ "\000\215\000\216\000\216\000\217\000\215\000\217\000\220\000\221\000\221"
+ "\000\222\000\220\000\222\000\223\000\224\000\224\000\225\000\223\000\225"
+ "\000\223\000\226\000\224\000\226\000\227\000\230\000\230\000\231\000\227"
+ "\000\231\000\227\000\232\000\230\000\232\000 \000\233\000\210\000\233\000"
+ " \000\213\000\213\000\233\000 \000\214\000\213\000\234\000\233\000\234\000"
+ "\234\000\235\000\233\000\235\000\234\000\236\000\235\000\236\000\225\000"
+ "\233\000\210\000\225\000\216\000\233\000\216\000\225\000\216\000\237\000"
+ "\225\000\237\000\215\000\237\000\222\000\237\000\222\000\225\000\221\000"
+ "\225\000\225\000\240\000\210\000\240\000\224\000\240\000\240\000\241\000"
+ "\210\000\241\000\241\000\242\000\210\000\242\000\242\000\243\000\210\000"
+ "\243\000\243\000\244\000\210\000\244\000\244\000\245\000\210\000\245\000"
+ "\245\000\246\000\210\000\246\000\245\000\247\000\246\000\247\000\231\000"
+ "\247\000\231\000\246\000\230\000\246\000\246\000\250\000\210\000\250\000"
+ "\250\000\251\000\210\000\251\000\251\000\252\000\210\000\252\000\252\000"
+ "\253\000\210\000\253\000\252\000\254\000\253\000\254\000\253\000\255\000"
+ "\210\000\255\000\255\000\256\000\210\000\256\000\256\000\257\000\210\000"
+ "\257\000\211\000\260\000\210\000\260\000\261\000\262\000\262\000\263\000"
+ "\261\000\263\000\263\000\264\000\264\000\265\000\263\000\265\000\263\000"
+ "\266\000\264\000\266\000\262\000\266\000\265\000\267\000\265\000\270\000"
+ "\267\000\270\000\267\000\271\000\265\000\271\000\263\000\271\000\271\000"
+ "\272\000\263\000\272\000\272\000\273\000\263\000\273\000\273\000\274\000"
+ "\263\000\274\000\273\000\275\000\274\000\275\000\263\000\276\000\263\000"
+ "\277\000\276\000\277\000\276\000\300\000\263\000\300\000\276\000\301\000"
+ "\300\000\301\000\276\000\302\000\301\000\302\000\303\000\304\000\300\000"
+ "\304\000\300\000\303\000\303\000\305\000\304\000\305\000\263\000\304\000"
+ "\304\000\306\000\263\000\306\000\307\000\310\000\310\000\311\000\307\000"
+ "\311\000\307\000\312\000\310\000\312\000\307\000\313\000\312\000\313\000"
+ "\307\000\314\000\313\000\314\000\314\000\315\000\313\000\315\000\314\000"
+ "\316\000\315\000\316\000\261\000\306\000\306\000\313\000\261\000\313\000"
+ "\313\000\317\000\261\000\317\000\315\000\317\000\315\000\320\000\317\000"
+ "\320\000\320\000\321\000\317\000\321\000\320\000\322\000\321\000\322\000"
+ "\211\000\265\000\207\000\265\000\211\000\270\000\260\000\270\000\260\000"
+ "\323\000\270\000\323\000\323\000\324\000\270\000\324\000\324\000\325\000"
+ "\270\000\325\000\324\000\326\000\325\000\326\000\326\000\327\000\325\000"
+ "\327\000\325\000\330\000\270\000\330\000\331\000\332\000\332\000\333\000"
+ "\331\000\333\000\334\000\335\000\335\000\336\000\334\000\336\000\334\000"
+ "\337\000\335\000\337\000\340\000\341\000\341\000\342\000\340\000\342\000"
+ "\340\000\343\000\341\000\343\000\332\000\343\000\332\000\341\000\332\000"
+ "\344\000\341\000\344\000\332\000\345\000\344\000\345\000\332\000\346\000"
+ "\345\000\346\000\331\000\346\000\331\000\347\000\346\000\347\000\331\000"
+ "\350\000\347\000\350\000\347\000\351\000\346\000\351\000\347\000\352\000"
+ "\351\000\352\000\334\000\347\000\334\000\352\000\353\000\354\000\354\000"
+ "\355\000\353\000\355\000\337\000\353\000\337\000\354\000\337\000\356\000"
+ "\354\000\356\000\334\000\356\000\347\000\356\000\347\000\357\000\356\000"
+ "\357\000\347\000\360\000\357\000\360\000\347\000\361\000\360\000\361\000"
+ "\361\000\362\000\360\000\362\000\363\000\364\000\364\000\365\000\363\000"
+ "\365\000\363\000\366\000\364\000\366\000\356\000\366\000\356\000\364\000"
+ "\357\000\364\000\357\000\367\000\364\000\367\000\370\000\371\000\367\000"
+ "\371\000\367\000\370\000\370\000\372\000\371\000\372\000\370\000\373\000"
+ "\372\000\373\000\374\000\375\000\371\000\375\000\371\000\374\000\374\000"
+ "\376\000\375\000\376\000\377\000\000\001\000\001\001\001\377\000\001\001"
+ "\377\000\002\001\000\001\002\001\003\001\004\001\004\001\005\001\003\001"
+ "\005\001\006\001\007\001\007\001\010\001\006\001\010\001\011\001\012\001"
+ "\012\001\013\001\011\001\013\001\011\001\014\001\012\001\014\001\011\001"
+ "\015\001\014\001\015\001\015\001\016\001\014\001\016\001i\000\016\001i\000"
+ "\014\001k\000\016\001\364\000\016\001k\000\364\000\364\000\001\001k\000\001"
+ "\001\364\000\375\000\375\000\001\001\367\000\375\000\001\001\005\001k\000"
+ "\005\001\000\001\005\001\005\001\010\001k\000\010\001\004\001\010\001\010"
+ "\001\017\001k\000\017\001\007\001\017\001\017\001\020\001k\000\020\001\020"
+ "\001\021\001k\000\021\001\021\001\022\001k\000\022\001\021\001\023\001\022"
+ "\001\023\001\023\001\024\001\022\001\024\001\352\000\025\001\351\000\025"
+ "\001\335\000\026\001\026\001\027\001\335\000\027\001\337\000\026\001"
+;
+const unsigned long ships_size = 39984;
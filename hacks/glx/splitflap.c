@@ -50,15 +50,24 @@
 #include "texfont.h"
 #include "gllist.h"
 
-extern const struct gllist
+/* A binary mesh container, see "splitflap_dxf" in Makefile.in. */
+extern const unsigned char splitflap_obj[];
+extern const unsigned long splitflap_obj_size;
+
+/* Loaded from splitflap_obj on first use. */
+static const struct gllist
   *splitflap_obj_box_quarter_frame, *splitflap_obj_disc_quarter,
   *splitflap_obj_fin_edge_half, *splitflap_obj_fin_face_half;
 static struct gllist *splitflap_obj_outer_frame = 0;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "box_quarter_frame", "disc_quarter", "fin_edge_half", "fin_face_half",
+};
+
+static const struct gllist **all_objs[] = {
   &splitflap_obj_box_quarter_frame, &splitflap_obj_disc_quarter, 
   &splitflap_obj_fin_edge_half, &splitflap_obj_fin_face_half,
-  (const struct gllist * const *) &splitflap_obj_outer_frame
+  (const struct gllist **) &splitflap_obj_outer_frame
 };
 
 #define SPLITFLAP_QUARTER_FRAME	0
@@ -381,6 +390,19 @@ init_splitflap (ModeInfo *mi)
     bp->trackball = gltrackball_init (False);
   }
 
+  for (i = 0; i < countof(all_layers); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (splitflap_obj, splitflap_obj_size,
+                                         all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
@@ -1,200 +1,110 @@
-/* Generated from "splitflap.dxf" on 04-May-2015.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "splitflap.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
    Components: box_quarter_frame, disc_quarter, fin_edge_half,
      fin_face_half.
  */
 
 #include "gllist.h"
 
-static const float splitflap_obj_box_quarter_frame_data[] = {
-	0,0,-1,0,0.037037,0.884606,
-	0,0,-1,-0.950617,-0.049383,0.884606,
-	0,0,-1,-0.950617,0.037037,0.884606,
-	0,0,-1,-0.950617,-0.049383,0.884606,
-	0,0,-1,0,0.037037,0.884606,
-	0,0,-1,0,-0.049383,0.884606,
-	0,0,1,-1,-0.049383,0.983371,
-	0,0,1,0,0.061728,0.983371,
-	0,0,1,-1,0.061728,0.983371,
-	0,0,1,0,0.061728,0.983371,
-	0,0,1,-1,-0.049383,0.983371,
-	0,0,1,0,-0.049383,0.983371,
-	0,-1,0,0,-0.049383,0.983371,
-	0,-1,0.000217,-0.950617,-0.049383,0.884606,
-	0,-1,0,0,-0.049383,0.884606,
-	0,-1,0.000217,-0.950617,-0.049383,0.884606,
-	0,-1,0,0,-0.049383,0.983371,
-	-0.002919,-0.999996,0.000163,-1,-0.049383,0.884606,
-	-0.002919,-0.999996,0.000163,-1,-0.049383,0.884606,
-	0,-1,0,0,-0.049383,0.983371,
-	0,-1,0,-1,-0.049383,0.983371,
-	-1,0,0,-1,0.061728,0.983371,
-	-1,0,0,-1,-0.049383,0.884606,
-	-1,0,0,-1,-0.049383,0.983371,
-	-1,0,0,-1,-0.049383,0.884606,
-	-1,0,0,-1,0.061728,0.983371,
-	-1,0,0,-1,0.061728,0.884606,
-	-1,0,0,-1,0.061728,0.884606,
-	-1,0,0,-1,-0.049383,-0.000043,
-	-1,0,0,-1,-0.049383,0.884606,
-	-1,0,0,-1,-0.049383,-0.000043,
-	-1,0,0,-1,0.061728,0.884606,
-	-1,0,0,-1,0.061728,-0.000043,
-	-0.005838,-0.999983,0.000326,-0.950617,-0.049959,0,
-	-0.002919,-0.999996,0.000163,-1,-0.049383,0.884606,
-	-0.011676,-0.999932,0,-1,-0.049383,-0.000043,
-	-0.002919,-0.999996,0.000163,-1,-0.049383,0.884606,
-	-0.005838,-0.999983,0.000326,-0.950617,-0.049959,0,
-	0,-1,0.000217,-0.950617,-0.049383,0.884606,
-	1,0,0,-0.950617,0.037037,0,
-	1,0,0,-0.950617,-0.049383,0.884606,
-	1,0,0,-0.950617,-0.049959,0,
-	1,0,0,-0.950617,-0.049383,0.884606,
-	1,0,0,-0.950617,0.037037,0,
-	1,0,0,-0.950617,0.037037,0.884606,
-	0,-1,0,0,0.037037,0.884606,
-	0,-1,0,-0.950617,0.037037,0,
-	0,-1,0,0,0.037037,0,
-	0,-1,0,-0.950617,0.037037,0,
-	0,-1,0,0,0.037037,0.884606,
-	0,-1,0,-0.950617,0.037037,0.884606
-};
-static const struct gllist splitflap_obj_box_quarter_frame_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 51, splitflap_obj_box_quarter_frame_data, 0
-};
-const struct gllist *splitflap_obj_box_quarter_frame = &splitflap_obj_box_quarter_frame_frame;
-
-static const float splitflap_obj_disc_quarter_data[] = {
-	0,-1,0,-0.839506,-0.08077,0,
-	0,-0.991445,0.130526,-0.950617,-0.08077,0.076689,
-	0,-1,0,-0.950617,-0.08077,0,
-	0,-0.991445,0.130526,-0.950617,-0.08077,0.076689,
-	0,-1,0,-0.839506,-0.08077,0,
-	0,-0.991445,0.130526,-0.839506,-0.08077,0.076689,
-	0,-0.939769,0.341811,-0.839506,-0.041073,0.22484,
-	0,-0.991445,0.130526,-0.950617,-0.08077,0.076689,
-	0,-0.991445,0.130526,-0.839506,-0.08077,0.076689,
-	0,-0.991445,0.130526,-0.950617,-0.08077,0.076689,
-	0,-0.939769,0.341811,-0.839506,-0.041073,0.22484,
-	0,-0.906214,0.42282,-0.950617,-0.041073,0.22484,
-	0,-0.866025,0.5,-0.839506,0.037037,0.36013,
-	0,-0.906214,0.42282,-0.950617,-0.041073,0.22484,
-	0,-0.939769,0.341811,-0.839506,-0.041073,0.22484,
-	0,-0.906214,0.42282,-0.950617,-0.041073,0.22484,
-	0,-0.866025,0.5,-0.839506,0.037037,0.36013,
-	0,-0.866025,0.5,-0.950617,0.037037,0.36013,
-	-1,0,0,-0.950617,0.037037,0,
-	-1,0,0,-0.950617,-0.08077,0,
-	-1,0,0,-0.950617,-0.08077,0.076689,
-	-1,0,0,-0.950617,0.037037,0,
-	-1,0,0,-0.950617,-0.08077,0.076689,
-	-1,0,0,-0.950617,-0.041073,0.22484,
-	1,0,0,-0.839506,0.037037,0.36013,
-	1,0,0,-0.839506,-0.041073,0.22484,
-	1,0,0,-0.839506,0.037037,0,
-	1,0,0,-0.839506,0.037037,0,
-	1,0,0,-0.839506,-0.08077,0.076689,
-	1,0,0,-0.839506,-0.08077,0,
-	1,0,0,-0.839506,0.037037,0,
-	1,0,0,-0.839506,-0.041073,0.22484,
-	1,0,0,-0.839506,-0.08077,0.076689
-};
-static const struct gllist splitflap_obj_disc_quarter_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 33, splitflap_obj_disc_quarter_data, 0
-};
-const struct gllist *splitflap_obj_disc_quarter = &splitflap_obj_disc_quarter_frame;
-
-static const float splitflap_obj_fin_edge_half_data[] = {
-	0,0,-1,-0.82716,0.006173,0.43613,
-	0,0,-1,-0.925926,-0.030864,0.43613,
-	0,0,-1,-0.925926,0.006173,0.43613,
-	0,0,-1,-0.925926,-0.030864,0.43613,
-	0,0,-1,-0.82716,0.006173,0.43613,
-	0,0,-1,-0.82716,-0.030864,0.43613,
-	-0.996214,0,0.086934,-0.925926,0.006173,0.761149,
-	-1,0,0,-0.925926,-0.030864,0.43613,
-	-0.984769,0,0.173868,-0.925926,-0.030864,0.761149,
-	-1,0,0,-0.925926,-0.030864,0.43613,
-	-0.996214,0,0.086934,-0.925926,0.006173,0.761149,
-	-1,0,0,-0.925926,0.006173,0.43613,
-	0,0,1,0,-0.030864,0.859915,
-	-0.086934,0,0.996214,-0.82716,0.006173,0.859915,
-	-0.173868,0,0.984769,-0.82716,-0.030864,0.859915,
-	-0.086934,0,0.996214,-0.82716,0.006173,0.859915,
-	0,0,1,0,-0.030864,0.859915,
-	0,0,1,0,0.006173,0.859915,
-	0,0,-1,0,0.006173,0.012346,
-	0,0,-1,-0.82716,-0.030864,0.012346,
-	0,0,-1,-0.82716,0.006173,0.012346,
-	0,0,-1,-0.82716,-0.030864,0.012346,
-	0,0,-1,0,0.006173,0.012346,
-	0,0,-1,0,-0.030864,0.012346,
-	-1,0,0,-0.82716,0.006173,0.43613,
-	-1,0,0,-0.82716,-0.030864,0.012346,
-	-1,0,0,-0.82716,-0.030864,0.43613,
-	-1,0,0,-0.82716,-0.030864,0.012346,
-	-1,0,0,-0.82716,0.006173,0.43613,
-	-1,0,0,-0.82716,0.006173,0.012346,
-	-0.907073,0,0.420974,-0.912694,0.006173,0.810532,
-	-0.984769,0,0.173868,-0.925926,-0.030864,0.761149,
-	-0.81811,0,0.575061,-0.912694,-0.030864,0.810532,
-	-0.984769,0,0.173868,-0.925926,-0.030864,0.761149,
-	-0.907073,0,0.420974,-0.912694,0.006173,0.810532,
-	-0.996214,0,0.086934,-0.925926,0.006173,0.761149,
-	-0.707107,0,0.707107,-0.876543,0.006173,0.846683,
-	-0.81811,0,0.575061,-0.912694,-0.030864,0.810532,
-	-0.707107,0,0.707107,-0.876543,-0.030864,0.846683,
-	-0.81811,0,0.575061,-0.912694,-0.030864,0.810532,
-	-0.707107,0,0.707107,-0.876543,0.006173,0.846683,
-	-0.907073,0,0.420974,-0.912694,0.006173,0.810532,
-	-0.173868,0,0.984769,-0.82716,-0.030864,0.859915,
-	-0.258819,0,0.965926,-0.876543,0.006173,0.846683,
-	-0.258819,0,0.965926,-0.876543,-0.030864,0.846683,
-	-0.258819,0,0.965926,-0.876543,0.006173,0.846683,
-	-0.173868,0,0.984769,-0.82716,-0.030864,0.859915,
-	-0.086934,0,0.996214,-0.82716,0.006173,0.859915
-};
-static const struct gllist splitflap_obj_fin_edge_half_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 48, splitflap_obj_fin_edge_half_data, 0
-};
-const struct gllist *splitflap_obj_fin_edge_half = &splitflap_obj_fin_edge_half_frame;
-
-static const float splitflap_obj_fin_face_half_data[] = {
-	0,-1,0,-0.82716,-0.030864,0.859915,
-	0,-1,0,-0.82716,-0.030864,0.761149,
-	0,-1,0,0,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.761149,
-	0,-1,0,-0.925926,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,0,-0.030864,0.761149,
-	0,-1,0,0,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,0,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.859915,
-	0,-1,0,0,-0.030864,0.761149,
-	0,-1,0,0,-0.030864,0.859915,
-	0,-1,0,-0.925926,-0.030864,0.761149,
-	0,-1,0,-0.925926,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,0,-0.030864,0.012346,
-	0,-1,0,0,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.43613,
-	0,-1,0,-0.82716,-0.030864,0.012346,
-	0,-1,0,0,-0.030864,0.012346,
-	0,-1,0,-0.912694,-0.030864,0.810532,
-	0,-1,0,-0.925926,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.761149,
-	0,-1,0,-0.876543,-0.030864,0.846683,
-	0,-1,0,-0.912694,-0.030864,0.810532,
-	0,-1,0,-0.82716,-0.030864,0.761149,
-	0,-1,0,-0.82716,-0.030864,0.859915,
-	0,-1,0,-0.876543,-0.030864,0.846683,
-	0,-1,0,-0.82716,-0.030864,0.761149
-};
-static const struct gllist splitflap_obj_fin_face_half_frame = {
- GL_N3F_V3F, GL_TRIANGLES, 33, splitflap_obj_fin_face_half_data, 0
-};
-const struct gllist *splitflap_obj_fin_face_half = &splitflap_obj_fin_face_half_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char splitflap_obj[] =
+ "XSGLMSH1\004\000\000\000\000\000\000\000box_quarter_frame\000\000\000\000"
+ "\000\000\000\000\000\000\000\020\001\000\000\004\000\000\000\035\000\000"
+ "\0003\000\000\000\037\000\000\000\000\000\000\277\011\323\300;m\273\373>"
+ "\000\001\2007disc_quarter\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\030\003\000\000\004\000\000\000\021\000\000\000!\000\000"
+ "\000\024\000\000\000\304\042e\277\371 \263\274\370b8>id\2706fin_edge_hal"
+ "f\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000X\004\000\000"
+ "\004\000\000\000\032\000\000\0000\000\000\000!\000\000\000{\011\355\276\210"
+ "EJ\274uL\337>U\013m7fin_face_half\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000@\006\000\000\004\000\000\000\014\000\000\000!\000\000"
+ "\000\026\000\000\000{\011\355\276\352\326\374\274uL\337>U\013m7\377\177\372"
+ "\007\227d\000\000\245\214\332\361\227d\000\000\245\214\372\007\227d\000\000"
+ "\377\177\332\361\227d\000\000\001\200\332\361\340}\000\000\377\177L\016\340"
+ "}\000\000\001\200L\016\340}\000\000\377\177\332\361\340}\000\000\377\177"
+ "\332\361\340}\000\000\245\214\332\361\227d\000\000\377\177\332\361\227d\000"
+ "\000\001\200\332\361\227d\000\000\001\200\332\361\340}\000\000\001\200L\016"
+ "\340}\000\000\001\200\332\361\227d\000\000\001\200\332\361\340}\000\000\001"
+ "\200L\016\227d\000\000\001\200\332\361 \202\000\000\001\200L\016 \202\000"
+ "\000\245\214\264\361#\202\000\000\001\200\332\361 \202\000\000\245\214\372"
+ "\007#\202\000\000\245\214\332\361\227d\000\000\245\214\264\361#\202\000\000"
+ "\245\214\372\007\227d\000\000\377\177\372\007\227d\000\000\245\214\372\007"
+ "#\202\000\000\377\177\372\007#\202\000\000\245\214\372\007\227d\000\000\177"
+ "\177\177\177\177\177\177\177\000\000\000\000\000\000\000\000\000\201\000"
+ "\201\000\201\000\201\000\201\201\000\201\000\201\000\201\000\201\000\201"
+ "\000\377\202\377\202\177\000\177\000\177\000\177\000\000\201\000\201\000"
+ "\201\000\201\000\000\000\000\001\000\002\000\001\000\000\000\003\000\004"
+ "\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000\012\000\011"
+ "\000\010\000\013\000\013\000\010\000\014\000\015\000\016\000\017\000\016"
+ "\000\015\000\020\000\020\000\021\000\016\000\021\000\020\000\022\000\023"
+ "\000\013\000\024\000\013\000\023\000\011\000\025\000\026\000\027\000\026"
+ "\000\025\000\030\000\031\000\032\000\033\000\032\000\031\000\034\000\000"
+ "\000\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001"
+ "\000\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007"
+ "\000\005\000\007\000\001\000\007\000\003\000\007\000\007\000\013\000\001"
+ "\000\013\000\004\000\013\000\006\000\013\000\006\000\020\000\013\000\020"
+ "\000\020\000\021\000\013\000\021\000\020\000\022\000\021\000\022\000\013"
+ "\000\023\000\021\000\023\000\001\000\023\000\001\000\025\000\023\000\025"
+ "\000\002\000\025\000\000\000\025\000\025\000\033\000\000\000\033\000~'!\326"
+ "\001\200\000\000\202\330!\326\204\266\000\000\202\330!\326\001\200\000\000"
+ "~'!\326\204\266\000\000~'Y\362\324\037\000\000\202\330Y\362\324\037\000\000"
+ "~'\337)\377\177\000\000\202\330\337)\377\177\000\000\202\330\337)\001\200"
+ "\000\000\202\330!\326\001\200\000\000\202\330!\326\204\266\000\000\202\330"
+ "Y\362\324\037\000\000~'\337)\377\177\000\000~'Y\362\324\037\000\000~'\337"
+ ")\001\200\000\000~'!\326\204\266\000\000~'!\326\001\200\000\000\000\201\000"
+ "\220\000\201\000\220\000\243\000\251\000\257\000\257\201\000\201\000\201"
+ "\000\201\000\177\000\177\000\177\000\177\000\177\000\000\000\000\000\001"
+ "\000\002\000\001\000\000\000\003\000\004\000\001\000\003\000\001\000\004"
+ "\000\005\000\006\000\005\000\004\000\005\000\006\000\007\000\010\000\011"
+ "\000\012\000\010\000\012\000\013\000\014\000\015\000\016\000\016\000\017"
+ "\000\020\000\016\000\015\000\017\000\000\000\000\000\001\000\001\000\002"
+ "\000\000\000\002\000\000\000\003\000\001\000\003\000\001\000\004\000\003"
+ "\000\004\000\004\000\005\000\001\000\005\000\005\000\006\000\004\000\006"
+ "\000\006\000\007\000\005\000\007\000\002\000\010\000\001\000\010\000\005"
+ "\000\010\000\004\000\016\000\006\000\016\000\003\000\016\000\000\000\016"
+ "\000O\233\037\005\000\000\000\000\001\200\341\372\000\000\000\000\001\200"
+ "\037\005\000\000\000\000O\233\341\372\000\000\000\000\001\200\037\005\334"
+ "Y\000\000\001\200\341\372\000\000\000\000\001\200\341\372\334Y\000\000\001"
+ "\200\037\005\000\000\000\000\377\177\341\372*u\000\000O\233\037\005*u\000"
+ "\000O\233\341\372*u\000\000\377\177\037\005*u\000\000\377\177\037\005\326"
+ "\212\000\000O\233\341\372\326\212\000\000O\233\037\005\326\212\000\000\377"
+ "\177\341\372\326\212\000\000O\233\037\005\000\000\000\000O\233\341\372\326"
+ "\212\000\000O\233\341\372\000\000\000\000O\233\037\005\326\212\000\000\252"
+ "\203\037\005\203g\000\000\252\203\341\372\203g\000\000\250\215\037\005\202"
+ "q\000\000\250\215\341\372\202q\000\000\250\215\037\005\202q\000\000\250\215"
+ "\341\372\202q\000\000\177\177\177\177\177\177\177\177\213\000\201\000\224"
+ "\000\201\000\000\000\366\000\355\000\000\000\177\177\177\177\177\177\177"
+ "\177\201\000\201\000\201\000\201\000\251\000\265\000\300\000\300\000\345"
+ "\000\345\000\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005"
+ "\000\006\000\005\000\004\000\007\000\010\000\011\000\012\000\011\000\010"
+ "\000\013\000\014\000\015\000\016\000\015\000\014\000\017\000\020\000\021"
+ "\000\022\000\021\000\020\000\023\000\024\000\006\000\025\000\006\000\024"
+ "\000\004\000\026\000\025\000\027\000\025\000\026\000\024\000\012\000\030"
+ "\000\031\000\030\000\012\000\011\000\000\000\001\000\001\000\002\000\000"
+ "\000\002\000\000\000\003\000\001\000\003\000\001\000\004\000\001\000\006"
+ "\000\004\000\006\000\002\000\004\000\010\000\011\000\011\000\012\000\010"
+ "\000\012\000\010\000\013\000\011\000\013\000\014\000\015\000\015\000\016"
+ "\000\014\000\016\000\014\000\017\000\015\000\017\000\000\000\015\000\003"
+ "\000\015\000\000\000\016\000\006\000\024\000\006\000\025\000\024\000\025"
+ "\000\004\000\024\000\025\000\026\000\025\000\027\000\026\000\027\000\024"
+ "\000\026\000\012\000\026\000\012\000\027\000\011\000\026\000O\233\000\000"
+ "*u\000\000O\233\000\000\334Y\000\000\377\177\000\000\334Y\000\000\001\200"
+ "\000\000\334Y\000\000O\233\000\000\000\000\000\000\377\177\000\000\000\000"
+ "\000\000\377\177\000\000*u\000\000\001\200\000\000\000\000\000\000\377\177"
+ "\000\000\326\212\000\000O\233\000\000\326\212\000\000\252\203\000\000\203"
+ "g\000\000\250\215\000\000\202q\000\000\000\201\000\201\000\201\000\201\000"
+ "\201\000\201\000\201\000\201\000\201\000\201\000\201\000\201\000\000\001"
+ "\000\002\000\001\000\003\000\004\000\001\000\004\000\002\000\002\000\004"
+ "\000\005\000\000\000\002\000\006\000\003\000\007\000\004\000\004\000\010"
+ "\000\005\000\004\000\011\000\010\000\012\000\003\000\001\000\013\000\012"
+ "\000\001\000\000\000\013\000\001\000\000\000\000\000\001\000\001\000\002"
+ "\000\000\000\002\000\001\000\003\000\003\000\004\000\001\000\004\000\002"
+ "\000\004\000\004\000\005\000\002\000\005\000\002\000\006\000\000\000\006"
+ "\000\003\000\007\000\004\000\007\000\004\000\010\000\005\000\010\000\004"
+ "\000\011\000\010\000\011\000\003\000\012\000\001\000\012\000\012\000\013"
+ "\000\001\000\013\000\000\000\013\000"
+;
+const unsigned long splitflap_obj_size = 1876;
@@ -58,13 +58,22 @@ static const char sccsid[] = "@(#)sproingies.c	4.04 97/07/28 xlockmore";
  * There are other frame numbers for special cases (e.g. BOOM_FRAME).
  */
 
-extern const struct gllist *s1_1;
-extern const struct gllist *s1_2;
-extern const struct gllist *s1_3;
-extern const struct gllist *s1_4;
-extern const struct gllist *s1_5;
-extern const struct gllist *s1_6;
-extern const struct gllist *s1_b;
+/* Binary mesh containers, see gllist.h. */
+extern const unsigned char s1_1[], s1_2[], s1_3[], s1_4[], s1_5[], s1_6[];
+extern const unsigned char s1_b[];
+extern const unsigned long s1_1_size, s1_2_size, s1_3_size, s1_4_size;
+extern const unsigned long s1_5_size, s1_6_size, s1_b_size;
+
+static const struct gllist *
+load_model(const unsigned char *data, unsigned long size)
+{
+	const struct gllist *gll = gllist_read_mesh(data, size, "all");
+	if (!gll) {
+		(void) fprintf(stderr, "%s: unable to load model\n", progname);
+		exit(1);
+	}
+	return gll;
+}
 
 static int
 myrand(int range)
@@ -858,13 +867,13 @@ InitSproingies(sp_instance *si, int wfmode, int grnd, int mspr, int smrtspr,
 	if (!(si->SproingieBoom = BuildLWO(si->wireframe, &LWO_s1_b)))
 		(void) fprintf(stderr, "BuildLWO - b\n");
 */
-	si->sproingies[0]=s1_1;
-	si->sproingies[1]=s1_2;
-	si->sproingies[2]=s1_3;
-	si->sproingies[3]=s1_4;
-	si->sproingies[4]=s1_5;
-	si->sproingies[5]=s1_6;
-	si->SproingieBoom=s1_b;
+	si->sproingies[0]=load_model(s1_1, s1_1_size);
+	si->sproingies[1]=load_model(s1_2, s1_2_size);
+	si->sproingies[2]=load_model(s1_3, s1_3_size);
+	si->sproingies[3]=load_model(s1_4, s1_4_size);
+	si->sproingies[4]=load_model(s1_5, s1_5_size);
+	si->sproingies[5]=load_model(s1_6, s1_6_size);
+	si->SproingieBoom=load_model(s1_b, s1_b_size);
 
 	if (si->wireframe) {
 		glShadeModel(GL_FLAT);
@@ -1,3982 +1,1372 @@
-/* Generated from "timezones.dxf" on 25-Feb-2022.
-   Drawn by hand by jwz.
+/* Generated from "timezones.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Wireframe. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float timezones_data[] = {
-	0.062141,0.498384,0,
-	0.062141,0.4473,0,
-	0.062141,0.4473,0,
-	0.047726,0.444361,0,
-	0.047726,0.444361,0,
-	0.029952,0.437363,0,
-	0.062141,0.4473,0,
-	0.104128,0.444361,0,
-	0.104128,0.444361,0,
-	0.104128,0.498384,0,
-	0.145416,0.498384,0,
-	0.145416,0.444361,0,
-	0.145416,0.444361,0,
-	0.153113,0.453318,0,
-	0.153113,0.453318,0,
-	0.152273,0.454858,0,
-	0.152273,0.454858,0,
-	0.158432,0.461156,0,
-	0.158432,0.461156,0,
-	0.171307,0.464234,0,
-	0.171307,0.464234,0,
-	0.175506,0.464234,0,
-	0.175506,0.464234,0,
-	0.183624,0.467034,0,
-	0.183624,0.467034,0,
-	0.187262,0.467034,0,
-	0.187262,0.467034,0,
-	0.187262,0.498384,0,
-	0.22855,0.498384,0,
-	0.22855,0.472632,0,
-	0.22855,0.472632,0,
-	0.216373,0.472632,0,
-	0.216373,0.472632,0,
-	0.216373,0.452478,0,
-	0.216373,0.452478,0,
-	0.235827,0.450099,0,
-	0.235827,0.450099,0,
-	0.239606,0.44884,0,
-	0.239606,0.44884,0,
-	0.248423,0.442122,0,
-	0.248423,0.442122,0,
-	0.251362,0.442122,0,
-	0.251362,0.442122,0,
-	0.252762,0.440722,0,
-	0.252762,0.440722,0,
-	0.252762,0.434564,0,
-	0.252762,0.434564,0,
-	0.216373,0.434564,0,
-	0.216373,0.434564,0,
-	0.216373,0.41525,0,
-	0.216373,0.41525,0,
-	0.19398,0.41525,0,
-	0.19398,0.41525,0,
-	0.19398,0.38502,0,
-	0.19398,0.38502,0,
-	0.210635,0.38502,0,
-	0.270536,0.47935,0,
-	0.270536,0.498384,0,
-	0.270536,0.47935,0,
-	0.263398,0.47935,0,
-	0.263398,0.47935,0,
-	0.263398,0.432744,0,
-	0.263398,0.432744,0,
-	0.26018,0.431625,0,
-	0.26018,0.431625,0,
-	0.25906,0.428686,0,
-	0.25906,0.428686,0,
-	0.256541,0.425607,0,
-	0.256541,0.425607,0,
-	0.256541,0.424067,0,
-	0.256541,0.424067,0,
-	0.25962,0.421828,0,
-	0.25962,0.421828,0,
-	0.263398,0.420289,0,
-	0.263398,0.420289,0,
-	0.263398,0.402514,0,
-	0.263398,0.402514,0,
-	0.256541,0.404053,0,
-	0.256541,0.404053,0,
-	0.252762,0.406573,0,
-	0.252762,0.406573,0,
-	0.250523,0.405313,0,
-	0.311823,0.498384,0,
-	0.311823,0.47935,0,
-	0.311823,0.47935,0,
-	0.323159,0.47935,0,
-	0.323159,0.47935,0,
-	0.333517,0.476971,0,
-	0.107907,0.442401,0,
-	0.107907,0.41581,0,
-	0.109027,0.41581,0,
-	0.114065,0.41651,0,
-	0.114065,0.41651,0,
-	0.117984,0.412591,0,
-	0.117984,0.412591,0,
-	0.119943,0.412591,0,
-	0.119943,0.412591,0,
-	0.122883,0.41455,0,
-	0.122883,0.41455,0,
-	0.124282,0.41455,0,
-	0.124282,0.41455,0,
-	0.131,0.409652,0,
-	0.131,0.409652,0,
-	0.134639,0.405593,0,
-	0.134639,0.405593,0,
-	0.139397,0.404053,0,
-	0.139397,0.404053,0,
-	0.139397,0.401394,0,
-	0.139397,0.401394,0,
-	0.135759,0.399995,0,
-	0.135759,0.399995,0,
-	0.131,0.399995,0,
-	0.131,0.399995,0,
-	0.129461,0.398035,0,
-	0.129461,0.398035,0,
-	0.13282,0.394536,0,
-	0.13282,0.394536,0,
-	0.145416,0.387679,0,
-	0.107907,0.442401,0,
-	0.114065,0.442401,0,
-	0.114065,0.442401,0,
-	0.117984,0.440302,0,
-	0.117984,0.440302,0,
-	0.121413,0.440302,0,
-	0.121413,0.440302,0,
-	0.121413,0.434704,0,
-	0.121413,0.434704,0,
-	0.127641,0.434704,0,
-	0.127641,0.434704,0,
-	0.129461,0.431905,0,
-	0.129461,0.431905,0,
-	0.132259,0.431905,0,
-	0.132259,0.431905,0,
-	0.132259,0.429106,0,
-	0.132259,0.429106,0,
-	0.134639,0.427566,0,
-	0.134639,0.427566,0,
-	0.137018,0.427566,0,
-	0.137018,0.427566,0,
-	0.141777,0.421408,0,
-	0.141777,0.421408,0,
-	0.145416,0.419309,0,
-	0.145416,0.419309,0,
-	0.147515,0.419309,0,
-	0.147515,0.419309,0,
-	0.147515,0.417629,0,
-	0.147515,0.417629,0,
-	0.154093,0.417629,0,
-	0.154093,0.417629,0,
-	0.156192,0.41455,0,
-	0.156192,0.41455,0,
-	0.166689,0.41455,0,
-	0.166689,0.41455,0,
-	0.166689,0.408392,0,
-	0.166689,0.408392,0,
-	0.160531,0.406712,0,
-	0.160531,0.406712,0,
-	0.156192,0.407622,0,
-	0.156192,0.407622,0,
-	0.155142,0.407168,0,
-	0.155142,0.407168,0,
-	0.156192,0.404053,0,
-	0.156192,0.404053,0,
-	0.16144,0.399995,0,
-	0.16144,0.399995,0,
-	0.167669,0.399015,0,
-	0.167669,0.399015,0,
-	0.171447,0.395376,0,
-	0.171447,0.395376,0,
-	0.170748,0.392857,0,
-	0.170748,0.392857,0,
-	0.176346,0.389638,0,
-	0.176346,0.389638,0,
-	0.176346,0.387679,0,
-	0.176346,0.387679,0,
-	0.175506,0.386419,0,
-	0.175506,0.386419,0,
-	0.176346,0.384739,0,
-	0.176346,0.384739,0,
-	0.177885,0.384739,0,
-	0.177885,0.384739,0,
-	0.177885,0.381381,0,
-	0.029952,0.387679,0,
-	0.062002,0.387679,0,
-	0.062002,0.387679,0,
-	0.062002,0.322599,0,
-	0.062002,0.322599,0,
-	0.029952,0.322599,0,
-	0.029952,0.28915,0,
-	0.03457,0.28915,0,
-	0.03457,0.28915,0,
-	0.03457,0.242264,0,
-	0.029952,0.242264,0,
-	0.03457,0.242264,0,
-	0.059062,0.242264,0,
-	0.059062,0.252341,0,
-	0.059062,0.252341,0,
-	0.052904,0.252341,0,
-	0.052904,0.252341,0,
-	0.052904,0.25724,0,
-	0.052904,0.25724,0,
-	0.070399,0.25724,0,
-	0.070399,0.25724,0,
-	0.084814,0.22477,0,
-	0.084814,0.22477,0,
-	0.084814,0.220151,0,
-	0.084814,0.220151,0,
-	0.070399,0.220151,0,
-	0.070399,0.220151,0,
-	0.070399,0.226169,0,
-	0.070399,0.226169,0,
-	0.038209,0.226169,0,
-	0.038209,0.226169,0,
-	0.038209,0.217492,0,
-	0.038209,0.217492,0,
-	0.03408,0.217492,0,
-	0.03408,0.217492,0,
-	0.03408,0.186142,0,
-	0.03408,0.186142,0,
-	0.062282,0.186142,0,
-	0.062282,0.186142,0,
-	0.062282,0,0,
-	0.103289,0,0,
-	0.103289,0.183342,0,
-	0.145275,0,0,
-	0.145275,0.177185,0,
-	0.186703,0,0,
-	0.186703,0.315741,0,
-	0.228129,0,0,
-	0.228129,0.156191,0,
-	0.228129,0.156191,0,
-	0.191461,0.156191,0,
-	0.191461,0.156191,0,
-	0.191461,0.188101,0,
-	0.191461,0.188101,0,
-	0.228129,0.188101,0,
-	0.134079,0.186142,0,
-	0.16347,0.186142,0,
-	0.16347,0.186142,0,
-	0.16347,0.177185,0,
-	0.16347,0.177185,0,
-	0.145275,0.177185,0,
-	0.134079,0.177185,0,
-	0.134079,0.186142,0,
-	0.269837,0,0,
-	0.269837,0.299646,0,
-	0.311264,0,0,
-	0.311264,0.093071,0,
-	0.353251,0,0,
-	0.353251,0.157591,0,
-	0.394957,0,0,
-	0.394957,0.097129,0,
-	0.394957,0.097129,0,
-	0.374244,0.097129,0,
-	0.374244,0.097129,0,
-	0.374244,0.104407,0,
-	0.374244,0.104407,0,
-	0.394957,0.104407,0,
-	0.394957,0.104407,0,
-	0.394957,0.215252,0,
-	0.436385,0,0,
-	0.436385,0.285931,0,
-	0.478092,0,0,
-	0.478092,0.133798,0,
-	0.478092,0.133798,0,
-	0.458778,0.133798,0,
-	0.458778,0.133798,0,
-	0.458778,0.150593,0,
-	0.458778,0.150593,0,
-	0.478092,0.150593,0,
-	0.478092,0.150593,0,
-	0.478092,0.22281,0,
-	0.478092,0.22281,0,
-	0.454579,0.22281,0,
-	0.454579,0.22281,0,
-	0.454579,0.232084,0,
-	0.454579,0.232084,0,
-	0.478092,0.232084,0,
-	0.478092,0.232084,0,
-	0.478092,0.260879,0,
-	0.519519,0,0,
-	0.519519,0.238205,0,
-	0.561225,0,0,
-	0.561225,0.155071,0,
-	0.602932,0,0,
-	0.602932,0.200138,0,
-	0.644639,0,0,
-	0.644639,0.278093,0,
-	0.686346,0,0,
-	0.686346,0.270325,0,
-	0.694184,0.229808,0,
-	0.702861,0.229808,0,
-	0.702861,0.229808,0,
-	0.702861,0.22281,0,
-	0.702861,0.22281,0,
-	0.694184,0.22281,0,
-	0.694184,0.22281,0,
-	0.694184,0.229808,0,
-	0.728053,0,0,
-	0.728053,0.294608,0,
-	0.76948,0,0,
-	0.76948,0.210214,0,
-	0.76948,0.217492,0,
-	0.759123,0.217492,0,
-	0.759123,0.217492,0,
-	0.759123,0.210214,0,
-	0.759123,0.210214,0,
-	0.76948,0.210214,0,
-	0.810907,0,0,
-	0.810907,0.22281,0,
-	0.810907,0.22281,0,
-	0.820984,0.22281,0,
-	0.820984,0.22281,0,
-	0.820984,0.228409,0,
-	0.852894,0,0,
-	0.852894,0.15983,0,
-	0.894321,0,0,
-	0.894321,0.143035,0,
-	0.935748,0,0,
-	0.935748,0.22421,0,
-	0.977735,0,0,
-	0.977735,0.098529,0,
-	0.977735,0.098529,0,
-	0.957581,0.098529,0,
-	0.957581,0.098529,0,
-	0.957581,0.12792,0,
-	0.957581,0.12792,0,
-	0.977735,0.15983,0,
-	0.977735,0.15983,0,
-	0.977735,0.163469,0,
-	0.938126,0.164869,0,
-	0.957581,0.164869,0,
-	0.957581,0.164869,0,
-	0.957581,0.155911,0,
-	0.957581,0.155911,0,
-	0.938126,0.155911,0,
-	0.938126,0.155911,0,
-	0.938126,0.164869,0,
-	0.977735,0.171866,0,
-	0.96066,0.171866,0,
-	0.96066,0.171866,0,
-	0.96066,0.163469,0,
-	0.96066,0.163469,0,
-	0.977735,0.163469,0,
-	1,0.1296,0,
-	0.99285,0.1296,0,
-	0.99285,0.1296,0,
-	0.988092,0.124281,0,
-	0.988092,0.124281,0,
-	0.988092,0.119802,0,
-	0.988092,0.119802,0,
-	1,0.119802,0,
-	0.103289,0.183342,0,
-	0.119523,0.183342,0,
-	0.119523,0.183342,0,
-	0.127081,0.189781,0,
-	0.127081,0.189781,0,
-	0.127081,0.211894,0,
-	0.127081,0.211894,0,
-	0.103289,0.211894,0,
-	0.103289,0.211894,0,
-	0.103289,0.387679,0,
-	0.106647,0.228968,0,
-	0.123302,0.228968,0,
-	0.123302,0.228968,0,
-	0.123302,0.217492,0,
-	0.123302,0.217492,0,
-	0.106647,0.217492,0,
-	0.106647,0.217492,0,
-	0.106647,0.228968,0,
-	0.145275,0.186561,0,
-	0.145275,0.387679,0,
-	0.177885,0.381381,0,
-	0.181664,0.378441,0,
-	0.181664,0.378441,0,
-	0.181664,0.374803,0,
-	0.181664,0.374803,0,
-	0.175926,0.374803,0,
-	0.175926,0.374803,0,
-	0.173547,0.371724,0,
-	0.173547,0.371724,0,
-	0.171447,0.371724,0,
-	0.171447,0.371724,0,
-	0.171447,0.366685,0,
-	0.171447,0.366685,0,
-	0.175506,0.366685,0,
-	0.175506,0.366685,0,
-	0.183343,0.365286,0,
-	0.183343,0.365286,0,
-	0.183343,0.348491,0,
-	0.183343,0.348491,0,
-	0.181664,0.348491,0,
-	0.181664,0.348491,0,
-	0.182503,0.343453,0,
-	0.182503,0.343453,0,
-	0.181664,0.338134,0,
-	0.181664,0.338134,0,
-	0.188662,0.326098,0,
-	0.188662,0.326098,0,
-	0.174736,0.326098,0,
-	0.174736,0.326098,0,
-	0.174736,0.315741,0,
-	0.174736,0.315741,0,
-	0.186703,0.315741,0,
-	0.145416,0.444361,0,
-	0.13282,0.442401,0,
-	0.13282,0.442401,0,
-	0.125961,0.441422,0,
-	0.125961,0.441422,0,
-	0.121413,0.440302,0,
-	0.210635,0.38502,0,
-	0.210635,0.38222,0,
-	0.210635,0.38222,0,
-	0.211755,0.381381,0,
-	0.211755,0.381381,0,
-	0.218333,0.381381,0,
-	0.218333,0.381381,0,
-	0.220712,0.378441,0,
-	0.220712,0.378441,0,
-	0.221552,0.373263,0,
-	0.221552,0.373263,0,
-	0.220712,0.370044,0,
-	0.220712,0.370044,0,
-	0.221552,0.367945,0,
-	0.221552,0.367945,0,
-	0.218333,0.364166,0,
-	0.218333,0.364166,0,
-	0.218333,0.359967,0,
-	0.218333,0.359967,0,
-	0.215813,0.359967,0,
-	0.215813,0.359967,0,
-	0.215813,0.358568,0,
-	0.215813,0.358568,0,
-	0.218333,0.358568,0,
-	0.218333,0.358568,0,
-	0.218333,0.353529,0,
-	0.218333,0.353529,0,
-	0.215813,0.353529,0,
-	0.215813,0.353529,0,
-	0.215813,0.35157,0,
-	0.215813,0.35157,0,
-	0.213854,0.35157,0,
-	0.213854,0.35157,0,
-	0.213854,0.338134,0,
-	0.213854,0.338134,0,
-	0.208116,0.338134,0,
-	0.208116,0.338134,0,
-	0.208116,0.333655,0,
-	0.208116,0.333655,0,
-	0.204057,0.336735,0,
-	0.204057,0.336735,0,
-	0.199299,0.336735,0,
-	0.199299,0.336735,0,
-	0.199299,0.335895,0,
-	0.199299,0.335895,0,
-	0.197479,0.335895,0,
-	0.197479,0.335895,0,
-	0.198389,0.332116,0,
-	0.198389,0.332116,0,
-	0.198389,0.327498,0,
-	0.198389,0.327498,0,
-	0.19664,0.327498,0,
-	0.19664,0.327498,0,
-	0.198389,0.323719,0,
-	0.198389,0.323719,0,
-	0.200978,0.323719,0,
-	0.200978,0.323719,0,
-	0.202938,0.317561,0,
-	0.202938,0.317561,0,
-	0.206087,0.315741,0,
-	0.206087,0.315741,0,
-	0.206087,0.313642,0,
-	0.206087,0.313642,0,
-	0.210635,0.310982,0,
-	0.210635,0.310982,0,
-	0.210985,0.307623,0,
-	0.210985,0.307623,0,
-	0.209656,0.306224,0,
-	0.209656,0.306224,0,
-	0.208116,0.307623,0,
-	0.208116,0.307623,0,
-	0.206087,0.304825,0,
-	0.206087,0.304825,0,
-	0.208885,0.301745,0,
-	0.208116,0.301745,0,
-	0.211755,0.300906,0,
-	0.211755,0.300906,0,
-	0.216373,0.298386,0,
-	0.216373,0.298386,0,
-	0.222252,0.296147,0,
-	0.222252,0.296147,0,
-	0.225191,0.294468,0,
-	0.225191,0.294468,0,
-	0.228129,0.293068,0,
-	0.228129,0.293068,0,
-	0.228129,0.188101,0,
-	0.250523,0.405313,0,
-	0.250523,0.381381,0,
-	0.250523,0.381381,0,
-	0.248563,0.378441,0,
-	0.248563,0.378441,0,
-	0.249543,0.376622,0,
-	0.249543,0.376622,0,
-	0.253462,0.376622,0,
-	0.253462,0.376622,0,
-	0.255421,0.375852,0,
-	0.255421,0.375852,0,
-	0.256541,0.373263,0,
-	0.256541,0.373263,0,
-	0.259969,0.374803,0,
-	0.259969,0.374803,0,
-	0.259969,0.374033,0,
-	0.259969,0.374033,0,
-	0.258255,0.371653,0,
-	0.258255,0.371653,0,
-	0.258255,0.365286,0,
-	0.258255,0.365286,0,
-	0.259969,0.364166,0,
-	0.259969,0.364166,0,
-	0.258255,0.361227,0,
-	0.258255,0.361227,0,
-	0.256541,0.361227,0,
-	0.256541,0.361227,0,
-	0.256541,0.355349,0,
-	0.256541,0.355349,0,
-	0.260879,0.352549,0,
-	0.260879,0.352549,0,
-	0.264518,0.35157,0,
-	0.264518,0.35157,0,
-	0.264518,0.348491,0,
-	0.264518,0.348491,0,
-	0.262139,0.344852,0,
-	0.262139,0.344852,0,
-	0.264518,0.338134,0,
-	0.264518,0.338134,0,
-	0.264518,0.331276,0,
-	0.264518,0.331276,0,
-	0.267457,0.332116,0,
-	0.267457,0.332116,0,
-	0.269837,0.328757,0,
-	0.269837,0.328757,0,
-	0.269837,0.315741,0,
-	0.269837,0.315741,0,
-	0.260879,0.315741,0,
-	0.260879,0.315741,0,
-	0.260879,0.299646,0,
-	0.260879,0.299646,0,
-	0.269837,0.299646,0,
-	0.333517,0.476971,0,
-	0.328898,0.475711,0,
-	0.328898,0.475711,0,
-	0.328898,0.473891,0,
-	0.328898,0.473891,0,
-	0.327498,0.473891,0,
-	0.327498,0.473891,0,
-	0.322321,0.473891,0,
-	0.322321,0.473891,0,
-	0.311823,0.472632,0,
-	0.311823,0.472632,0,
-	0.311823,0.470952,0,
-	0.311823,0.470952,0,
-	0.318821,0.470952,0,
-	0.318821,0.470952,0,
-	0.318821,0.469273,0,
-	0.318821,0.469273,0,
-	0.311823,0.468433,0,
-	0.311823,0.468433,0,
-	0.298248,0.467034,0,
-	0.298248,0.467034,0,
-	0.298248,0.463395,0,
-	0.298248,0.463395,0,
-	0.310424,0.459616,0,
-	0.310424,0.459616,0,
-	0.310424,0.444501,0,
-	0.310424,0.444501,0,
-	0.315322,0.440722,0,
-	0.315322,0.440722,0,
-	0.315322,0.439042,0,
-	0.315322,0.439042,0,
-	0.323159,0.437643,0,
-	0.323159,0.437643,0,
-	0.327498,0.435544,0,
-	0.327498,0.435544,0,
-	0.330158,0.434564,0,
-	0.330158,0.434564,0,
-	0.330158,0.432744,0,
-	0.330158,0.432744,0,
-	0.325959,0.430155,0,
-	0.325959,0.430155,0,
-	0.323159,0.428126,0,
-	0.323159,0.428126,0,
-	0.322321,0.422948,0,
-	0.322321,0.422948,0,
-	0.320081,0.419169,0,
-	0.320081,0.419169,0,
-	0.3212,0.41525,0,
-	0.3212,0.41525,0,
-	0.31924,0.41525,0,
-	0.320081,0.41595,0,
-	0.320641,0.412311,0,
-	0.320641,0.412311,0,
-	0.322321,0.411401,0,
-	0.322321,0.411401,0,
-	0.3212,0.409932,0,
-	0.3212,0.409932,0,
-	0.32274,0.408532,0,
-	0.32274,0.408532,0,
-	0.320641,0.405313,0,
-	0.320641,0.405313,0,
-	0.321691,0.404053,0,
-	0.321691,0.404053,0,
-	0.324559,0.402514,0,
-	0.324559,0.402514,0,
-	0.32274,0.400135,0,
-	0.32274,0.400135,0,
-	0.317491,0.401324,0,
-	0.317491,0.401324,0,
-	0.314343,0.402514,0,
-	0.314343,0.402514,0,
-	0.311823,0.398735,0,
-	0.311823,0.398735,0,
-	0.314343,0.396636,0,
-	0.314343,0.396636,0,
-	0.314343,0.394816,0,
-	0.314343,0.394816,0,
-	0.315918,0.395726,0,
-	0.315918,0.395726,0,
-	0.315918,0.393347,0,
-	0.315918,0.393347,0,
-	0.320081,0.393347,0,
-	0.320081,0.393347,0,
-	0.321166,0.392017,0,
-	0.321166,0.392017,0,
-	0.322321,0.395726,0,
-	0.322321,0.395726,0,
-	0.32274,0.393347,0,
-	0.32274,0.393347,0,
-	0.324559,0.393347,0,
-	0.324559,0.393347,0,
-	0.324559,0.38306,0,
-	0.324559,0.38306,0,
-	0.320641,0.38306,0,
-	0.335056,0.379911,0,
-	0.334636,0.38418,0,
-	0.334636,0.38418,0,
-	0.336735,0.38502,0,
-	0.336735,0.38502,0,
-	0.341494,0.390898,0,
-	0.341494,0.390898,0,
-	0.341494,0.396636,0,
-	0.341494,0.396636,0,
-	0.344713,0.396636,0,
-	0.344713,0.396636,0,
-	0.346113,0.392682,0,
-	0.346113,0.392682,0,
-	0.346113,0.386419,0,
-	0.346113,0.386419,0,
-	0.350452,0.386419,0,
-	0.350452,0.386419,0,
-	0.35395,0.381381,0,
-	0.35395,0.381381,0,
-	0.352831,0.377532,0,
-	0.352831,0.377532,0,
-	0.348282,0.378441,0,
-	0.348282,0.378441,0,
-	0.348282,0.379911,0,
-	0.348282,0.379911,0,
-	0.346673,0.379911,0,
-	0.346673,0.379911,0,
-	0.344013,0.377532,0,
-	0.344013,0.377532,0,
-	0.342194,0.377532,0,
-	0.342194,0.377532,0,
-	0.341494,0.381381,0,
-	0.341494,0.381381,0,
-	0.338415,0.381381,0,
-	0.338415,0.381381,0,
-	0.335056,0.379911,0,
-	0.320641,0.38306,0,
-	0.310984,0.382045,0,
-	0.310984,0.382045,0,
-	0.308325,0.379911,0,
-	0.308325,0.379911,0,
-	0.311823,0.379176,0,
-	0.311823,0.379176,0,
-	0.311823,0.375852,0,
-	0.311823,0.375852,0,
-	0.315322,0.373263,0,
-	0.315322,0.373263,0,
-	0.311823,0.371653,0,
-	0.311823,0.371653,0,
-	0.311823,0.304825,0,
-	0.311823,0.304825,0,
-	0.300207,0.304825,0,
-	0.300207,0.304825,0,
-	0.300207,0.283691,0,
-	0.300207,0.283691,0,
-	0.302167,0.283691,0,
-	0.302167,0.283691,0,
-	0.302167,0.281732,0,
-	0.302167,0.281732,0,
-	0.299367,0.281732,0,
-	0.299367,0.281732,0,
-	0.297128,0.278093,0,
-	0.297128,0.278093,0,
-	0.295309,0.273474,0,
-	0.295309,0.273474,0,
-	0.298248,0.273474,0,
-	0.298248,0.273474,0,
-	0.299367,0.271095,0,
-	0.299367,0.271095,0,
-	0.298248,0.269556,0,
-	0.298248,0.269556,0,
-	0.300207,0.268016,0,
-	0.300207,0.268016,0,
-	0.304825,0.268786,0,
-	0.304825,0.268786,0,
-	0.306785,0.266056,0,
-	0.306785,0.266056,0,
-	0.312803,0.266056,0,
-	0.312803,0.266056,0,
-	0.311123,0.262138,0,
-	0.311123,0.262138,0,
-	0.312803,0.258359,0,
-	0.312803,0.258359,0,
-	0.311123,0.25682,0,
-	0.311123,0.25682,0,
-	0.312803,0.25542,0,
-	0.312803,0.25542,0,
-	0.312803,0.25416,0,
-	0.312803,0.25416,0,
-	0.311123,0.253321,0,
-	0.311123,0.253321,0,
-	0.305805,0.25416,0,
-	0.305805,0.25416,0,
-	0.305805,0.252201,0,
-	0.305805,0.252201,0,
-	0.307765,0.251641,0,
-	0.307765,0.251641,0,
-	0.307765,0.250522,0,
-	0.307765,0.250522,0,
-	0.304825,0.250522,0,
-	0.304825,0.250522,0,
-	0.304825,0.248003,0,
-	0.304825,0.248003,0,
-	0.307765,0.245483,0,
-	0.307765,0.245483,0,
-	0.304825,0.236946,0,
-	0.304825,0.236946,0,
-	0.299228,0.236106,0,
-	0.299228,0.236106,0,
-	0.297128,0.234287,0,
-	0.297128,0.234287,0,
-	0.296218,0.230788,0,
-	0.296218,0.230788,0,
-	0.294749,0.229388,0,
-	0.294749,0.229388,0,
-	0.294749,0.228689,0,
-	0.294749,0.228689,0,
-	0.298808,0.227149,0,
-	0.298808,0.227149,0,
-	0.304825,0.226309,0,
-	0.304825,0.226309,0,
-	0.314902,0.221271,0,
-	0.314902,0.221271,0,
-	0.309864,0.218612,0,
-	0.309864,0.218612,0,
-	0.306295,0.218052,0,
-	0.306295,0.218052,0,
-	0.308465,0.213853,0,
-	0.308465,0.213853,0,
-	0.308465,0.209234,0,
-	0.308465,0.209234,0,
-	0.30738,0.208115,0,
-	0.30738,0.208115,0,
-	0.306785,0.205036,0,
-	0.306785,0.205036,0,
-	0.308465,0.203636,0,
-	0.308465,0.203636,0,
-	0.305805,0.200557,0,
-	0.305805,0.200557,0,
-	0.305805,0.198598,0,
-	0.305805,0.198598,0,
-	0.304825,0.197898,0,
-	0.304825,0.197898,0,
-	0.305316,0.19272,0,
-	0.305316,0.19272,0,
-	0.305071,0.186282,0,
-	0.305071,0.186282,0,
-	0.303426,0.180124,0,
-	0.303426,0.180124,0,
-	0.271516,0.180124,0,
-	0.271516,0.180124,0,
-	0.271516,0.145275,0,
-	0.271516,0.145275,0,
-	0.295449,0.145275,0,
-	0.295449,0.145275,0,
-	0.296148,0.140656,0,
-	0.296148,0.140656,0,
-	0.296148,0.137857,0,
-	0.296148,0.137857,0,
-	0.294049,0.134918,0,
-	0.294049,0.134918,0,
-	0.294049,0.132958,0,
-	0.294049,0.132958,0,
-	0.292789,0.128759,0,
-	0.292789,0.128759,0,
-	0.29125,0.128759,0,
-	0.29125,0.128759,0,
-	0.29125,0.121202,0,
-	0.29125,0.121202,0,
-	0.28985,0.119802,0,
-	0.28985,0.119802,0,
-	0.28929,0.107766,0,
-	0.28929,0.107766,0,
-	0.29125,0.104407,0,
-	0.29125,0.104407,0,
-	0.296709,0.097129,0,
-	0.296709,0.097129,0,
-	0.301467,0.097129,0,
-	0.301467,0.097129,0,
-	0.304825,0.09503,0,
-	0.304825,0.09503,0,
-	0.310004,0.09419,0,
-	0.310004,0.09419,0,
-	0.311264,0.093071,0,
-	0.308465,0.09671,0,
-	0.319521,0.09608,0,
-	0.319521,0.09608,0,
-	0.32302,0.09769,0,
-	0.32302,0.09769,0,
-	0.315602,0.09769,0,
-	0.315602,0.09769,0,
-	0.312243,0.099509,0,
-	0.312243,0.099509,0,
-	0.312243,0.113784,0,
-	0.312243,0.113784,0,
-	0.317841,0.116164,0,
-	0.317841,0.116164,0,
-	0.317841,0.118263,0,
-	0.317841,0.118263,0,
-	0.313922,0.118263,0,
-	0.313922,0.118263,0,
-	0.312243,0.119802,0,
-	0.312243,0.119802,0,
-	0.312243,0.122322,0,
-	0.312243,0.122322,0,
-	0.317841,0.124981,0,
-	0.317841,0.124981,0,
-	0.318681,0.128759,0,
-	0.318681,0.128759,0,
-	0.32302,0.130019,0,
-	0.32302,0.130019,0,
-	0.32246,0.132259,0,
-	0.32246,0.132259,0,
-	0.319311,0.132259,0,
-	0.319311,0.132259,0,
-	0.319311,0.134918,0,
-	0.319311,0.134918,0,
-	0.319521,0.135618,0,
-	0.319521,0.135618,0,
-	0.323999,0.134918,0,
-	0.323999,0.134918,0,
-	0.327639,0.135618,0,
-	0.327639,0.135618,0,
-	0.327639,0.137857,0,
-	0.327639,0.137857,0,
-	0.328338,0.140656,0,
-	0.328338,0.140656,0,
-	0.335196,0.141776,0,
-	0.335196,0.141776,0,
-	0.338835,0.142965,0,
-	0.338835,0.142965,0,
-	0.342893,0.147094,0,
-	0.342893,0.147094,0,
-	0.342893,0.148214,0,
-	0.342893,0.148214,0,
-	0.340864,0.148214,0,
-	0.340864,0.148214,0,
-	0.340864,0.149193,0,
-	0.340864,0.149193,0,
-	0.341879,0.150733,0,
-	0.341879,0.150733,0,
-	0.337016,0.152692,0,
-	0.337016,0.152692,0,
-	0.338135,0.154092,0,
-	0.338135,0.154092,0,
-	0.343453,0.151713,0,
-	0.343453,0.151713,0,
-	0.349191,0.151713,0,
-	0.349191,0.151713,0,
-	0.351711,0.155212,0,
-	0.351711,0.155212,0,
-	0.353251,0.157591,0,
-	0.308465,0.09671,0,
-	0.308465,0.104407,0,
-	0.308465,0.104407,0,
-	0.305805,0.104967,0,
-	0.305805,0.104967,0,
-	0.299088,0.104967,0,
-	0.299088,0.104967,0,
-	0.299088,0.107766,0,
-	0.299088,0.107766,0,
-	0.296709,0.107766,0,
-	0.296709,0.107766,0,
-	0.295449,0.110006,0,
-	0.295449,0.110006,0,
-	0.295449,0.112105,0,
-	0.295449,0.112105,0,
-	0.297898,0.113784,0,
-	0.297898,0.113784,0,
-	0.299088,0.114974,0,
-	0.299088,0.114974,0,
-	0.298493,0.116164,0,
-	0.298493,0.116164,0,
-	0.301467,0.119802,0,
-	0.301467,0.119802,0,
-	0.29998,0.122322,0,
-	0.29998,0.122322,0,
-	0.301467,0.123651,0,
-	0.301467,0.123651,0,
-	0.29998,0.124981,0,
-	0.29998,0.124316,0,
-	0.301467,0.1261,0,
-	0.301467,0.1261,0,
-	0.29998,0.12778,0,
-	0.29998,0.12778,0,
-	0.299088,0.131139,0,
-	0.299088,0.131139,0,
-	0.29998,0.132958,0,
-	0.29998,0.132958,0,
-	0.29998,0.136737,0,
-	0.29998,0.136737,0,
-	0.301467,0.141776,0,
-	0.301467,0.141776,0,
-	0.302446,0.141776,0,
-	0.302446,0.141776,0,
-	0.302446,0.147654,0,
-	0.302446,0.147654,0,
-	0.304248,0.149193,0,
-	0.304248,0.149193,0,
-	0.303426,0.151713,0,
-	0.303426,0.151713,0,
-	0.305805,0.154092,0,
-	0.305805,0.154092,0,
-	0.305805,0.156401,0,
-	0.305805,0.156401,0,
-	0.303348,0.162699,0,
-	0.303348,0.162699,0,
-	0.305316,0.164869,0,
-	0.305316,0.164869,0,
-	0.305071,0.167528,0,
-	0.305071,0.167528,0,
-	0.308465,0.173406,0,
-	0.308465,0.173406,0,
-	0.310004,0.173406,0,
-	0.310004,0.173406,0,
-	0.309234,0.176065,0,
-	0.309234,0.176065,0,
-	0.30962,0.181103,0,
-	0.30962,0.181103,0,
-	0.313083,0.182503,0,
-	0.313083,0.182503,0,
-	0.313083,0.186282,0,
-	0.313083,0.186282,0,
-	0.315881,0.188801,0,
-	0.315881,0.188801,0,
-	0.317841,0.188101,0,
-	0.317841,0.188101,0,
-	0.320851,0.187541,0,
-	0.320851,0.187541,0,
-	0.321271,0.186282,0,
-	0.321271,0.186282,0,
-	0.32274,0.188101,0,
-	0.32274,0.188101,0,
-	0.325819,0.187822,0,
-	0.325819,0.187822,0,
-	0.326799,0.186282,0,
-	0.326799,0.186282,0,
-	0.329178,0.184392,0,
-	0.329178,0.184392,0,
-	0.330297,0.183203,0,
-	0.330297,0.183203,0,
-	0.333377,0.182503,0,
-	0.333377,0.182503,0,
-	0.337016,0.180124,0,
-	0.336456,0.180124,0,
-	0.339447,0.178584,0,
-	0.339447,0.178584,0,
-	0.339447,0.177465,0,
-	0.339447,0.177465,0,
-	0.336456,0.173406,0,
-	0.336456,0.173406,0,
-	0.343453,0.172706,0,
-	0.343453,0.172706,0,
-	0.346322,0.173406,0,
-	0.346322,0.173406,0,
-	0.347792,0.175435,0,
-	0.347792,0.175435,0,
-	0.349191,0.182503,0,
-	0.349191,0.182503,0,
-	0.350451,0.185337,0,
-	0.350451,0.185337,0,
-	0.35521,0.188801,0,
-	0.35521,0.188801,0,
-	0.35577,0.1916,0,
-	0.35577,0.1916,0,
-	0.358009,0.19272,0,
-	0.358009,0.19272,0,
-	0.358009,0.195309,0,
-	0.358009,0.195309,0,
-	0.352481,0.197898,0,
-	0.352481,0.197898,0,
-	0.351431,0.202097,0,
-	0.351431,0.202097,0,
-	0.35577,0.205036,0,
-	0.35577,0.205036,0,
-	0.358009,0.208115,0,
-	0.358009,0.208115,0,
-	0.359408,0.213853,0,
-	0.359408,0.213853,0,
-	0.358708,0.218612,0,
-	0.358708,0.218612,0,
-	0.360388,0.221271,0,
-	0.360388,0.221271,0,
-	0.358009,0.221271,0,
-	0.358009,0.221271,0,
-	0.358009,0.22379,0,
-	0.358009,0.22379,0,
-	0.35577,0.225469,0,
-	0.35577,0.225469,0,
-	0.358009,0.227149,0,
-	0.358009,0.227149,0,
-	0.356889,0.230088,0,
-	0.356889,0.230088,0,
-	0.353601,0.230788,0,
-	0.353601,0.230788,0,
-	0.352481,0.236106,0,
-	0.352481,0.235196,0,
-	0.35451,0.240025,0,
-	0.35451,0.240025,0,
-	0.35577,0.239325,0,
-	0.35577,0.239325,0,
-	0.35577,0.241215,0,
-	0.35577,0.241215,0,
-	0.35451,0.242264,0,
-	0.35451,0.242264,0,
-	0.35451,0.246743,0,
-	0.35451,0.246743,0,
-	0.351956,0.251081,0,
-	0.351956,0.251081,0,
-	0.347792,0.25416,0,
-	0.347792,0.25416,0,
-	0.347792,0.25612,0,
-	0.347792,0.25612,0,
-	0.344153,0.25612,0,
-	0.344153,0.25612,0,
-	0.344153,0.25374,0,
-	0.344153,0.25374,0,
-	0.342334,0.25416,0,
-	0.342334,0.25416,0,
-	0.339447,0.260248,0,
-	0.339447,0.260248,0,
-	0.339447,0.262978,0,
-	0.339447,0.262978,0,
-	0.340891,0.262978,0,
-	0.340891,0.262978,0,
-	0.340891,0.265357,0,
-	0.340891,0.265357,0,
-	0.349821,0.265357,0,
-	0.349821,0.265357,0,
-	0.353601,0.262978,0,
-	0.353601,0.262978,0,
-	0.353601,0.428686,0,
-	0.394957,0.215252,0,
-	0.395937,0.218332,0,
-	0.395937,0.218332,0,
-	0.399996,0.221271,0,
-	0.399996,0.221271,0,
-	0.402795,0.225469,0,
-	0.402795,0.225469,0,
-	0.402795,0.230788,0,
-	0.402795,0.230788,0,
-	0.400696,0.234287,0,
-	0.400696,0.234287,0,
-	0.397967,0.234287,0,
-	0.397967,0.234287,0,
-	0.394957,0.236106,0,
-	0.394957,0.236106,0,
-	0.394957,0.430155,0,
-	0.353601,0.428686,0,
-	0.349751,0.432744,0,
-	0.349751,0.432744,0,
-	0.349191,0.435054,0,
-	0.349191,0.435054,0,
-	0.350452,0.436593,0,
-	0.350452,0.436593,0,
-	0.346812,0.442122,0,
-	0.346812,0.442122,0,
-	0.346812,0.44674,0,
-	0.346812,0.44674,0,
-	0.343104,0.44758,0,
-	0.343104,0.44758,0,
-	0.343104,0.450099,0,
-	0.343104,0.450099,0,
-	0.339115,0.456047,0,
-	0.339115,0.456047,0,
-	0.334636,0.459616,0,
-	0.334636,0.459616,0,
-	0.325959,0.459616,0,
-	0.325959,0.459616,0,
-	0.323125,0.460456,0,
-	0.323125,0.460456,0,
-	0.311823,0.468433,0,
-	0.333517,0.476971,0,
-	0.353601,0.47816,0,
-	0.353601,0.47816,0,
-	0.353601,0.498384,0,
-	0.395237,0.498384,0,
-	0.395237,0.481309,0,
-	0.436664,0.498384,0,
-	0.436664,0.47935,0,
-	0.436664,0.47935,0,
-	0.422948,0.481309,0,
-	0.422948,0.481309,0,
-	0.395237,0.481309,0,
-	0.436664,0.47935,0,
-	0.44912,0.476341,0,
-	0.44912,0.476341,0,
-	0.463116,0.476341,0,
-	0.463116,0.476341,0,
-	0.466475,0.475711,0,
-	0.466475,0.475711,0,
-	0.464795,0.473891,0,
-	0.465635,0.473891,0,
-	0.451779,0.470952,0,
-	0.451779,0.470952,0,
-	0.451079,0.464444,0,
-	0.451079,0.464444,0,
-	0.44912,0.460456,0,
-	0.44912,0.460456,0,
-	0.4501,0.457831,0,
-	0.4501,0.457831,0,
-	0.451779,0.457831,0,
-	0.451779,0.457831,0,
-	0.451429,0.456047,0,
-	0.451429,0.456047,0,
-	0.446181,0.455138,0,
-	0.446181,0.455138,0,
-	0.440023,0.450799,0,
-	0.440023,0.450799,0,
-	0.439183,0.44884,0,
-	0.439183,0.44884,0,
-	0.440863,0.44604,0,
-	0.440863,0.44604,0,
-	0.440863,0.444431,0,
-	0.440863,0.444431,0,
-	0.436664,0.442122,0,
-	0.436664,0.442122,0,
-	0.425748,0.439042,0,
-	0.425748,0.439042,0,
-	0.410352,0.437643,0,
-	0.410352,0.437643,0,
-	0.404754,0.432744,0,
-	0.404754,0.432744,0,
-	0.395237,0.430155,0,
-	0.478371,0.498384,0,
-	0.478371,0.436593,0,
-	0.478371,0.436593,0,
-	0.429246,0.436593,0,
-	0.429246,0.436593,0,
-	0.429246,0.422948,0,
-	0.429246,0.422948,0,
-	0.436664,0.422948,0,
-	0.478371,0.422948,0,
-	0.478371,0.402514,0,
-	0.477671,0.402514,0,
-	0.476552,0.402514,0,
-	0.476552,0.402514,0,
-	0.474872,0.400135,0,
-	0.474872,0.400135,0,
-	0.471933,0.400135,0,
-	0.471933,0.400135,0,
-	0.470254,0.398735,0,
-	0.470254,0.398735,0,
-	0.471093,0.396636,0,
-	0.471093,0.396636,0,
-	0.473403,0.395726,0,
-	0.473403,0.395726,0,
-	0.470254,0.393347,0,
-	0.470254,0.393347,0,
-	0.471093,0.390898,0,
-	0.471093,0.390898,0,
-	0.475712,0.390898,0,
-	0.475712,0.390898,0,
-	0.477671,0.392122,0,
-	0.477671,0.392122,0,
-	0.477671,0.370464,0,
-	0.436664,0.422948,0,
-	0.436664,0.360527,0,
-	0.436664,0.360527,0,
-	0.411192,0.360527,0,
-	0.411192,0.360527,0,
-	0.411192,0.35017,0,
-	0.411192,0.35017,0,
-	0.436664,0.35017,0,
-	0.436664,0.35017,0,
-	0.436664,0.300206,0,
-	0.436664,0.300206,0,
-	0.422668,0.300206,0,
-	0.422668,0.300206,0,
-	0.422668,0.285931,0,
-	0.422668,0.285931,0,
-	0.436385,0.285931,0,
-	0.478092,0.260879,0,
-	0.474452,0.262978,0,
-	0.474452,0.262978,0,
-	0.462976,0.270255,0,
-	0.462976,0.270255,0,
-	0.462136,0.274734,0,
-	0.462136,0.274734,0,
-	0.458078,0.279213,0,
-	0.458078,0.279213,0,
-	0.454579,0.279213,0,
-	0.454579,0.279213,0,
-	0.453879,0.281032,0,
-	0.453879,0.281032,0,
-	0.452899,0.283271,0,
-	0.452899,0.283271,0,
-	0.453388,0.28733,0,
-	0.453388,0.28733,0,
-	0.4508,0.290129,0,
-	0.4508,0.290129,0,
-	0.453388,0.291668,0,
-	0.453388,0.291668,0,
-	0.453879,0.295727,0,
-	0.453879,0.295727,0,
-	0.454579,0.297267,0,
-	0.454579,0.297267,0,
-	0.454579,0.300906,0,
-	0.454579,0.300906,0,
-	0.452094,0.305944,0,
-	0.452094,0.305944,0,
-	0.452899,0.309583,0,
-	0.452899,0.309583,0,
-	0.454229,0.311402,0,
-	0.454229,0.311402,0,
-	0.455418,0.314482,0,
-	0.455418,0.314482,0,
-	0.458078,0.317561,0,
-	0.458078,0.317561,0,
-	0.458078,0.31882,0,
-	0.458078,0.31882,0,
-	0.459197,0.31882,0,
-	0.459197,0.31882,0,
-	0.459197,0.32036,0,
-	0.459197,0.32036,0,
-	0.441842,0.32036,0,
-	0.441842,0.32036,0,
-	0.441842,0.332536,0,
-	0.441842,0.332536,0,
-	0.458078,0.365145,0,
-	0.458078,0.365145,0,
-	0.474872,0.365145,0,
-	0.474872,0.365145,0,
-	0.473403,0.368504,0,
-	0.473403,0.368504,0,
-	0.475712,0.369344,0,
-	0.475712,0.369344,0,
-	0.477671,0.370464,0,
-	0.474872,0.365145,0,
-	0.476691,0.365985,0,
-	0.476691,0.365985,0,
-	0.477111,0.365145,0,
-	0.477111,0.365145,0,
-	0.481311,0.365145,0,
-	0.481311,0.365145,0,
-	0.48215,0.364306,0,
-	0.48215,0.364306,0,
-	0.48061,0.362486,0,
-	0.48061,0.362486,0,
-	0.48061,0.359267,0,
-	0.48061,0.359267,0,
-	0.47921,0.358568,0,
-	0.47921,0.358568,0,
-	0.479911,0.357168,0,
-	0.479911,0.357168,0,
-	0.47921,0.355349,0,
-	0.47921,0.355349,0,
-	0.479911,0.354369,0,
-	0.479911,0.354369,0,
-	0.47921,0.352829,0,
-	0.47921,0.352829,0,
-	0.47921,0.35171,0,
-	0.47921,0.35171,0,
-	0.48215,0.35171,0,
-	0.48215,0.35171,0,
-	0.48215,0.349471,0,
-	0.48215,0.349471,0,
-	0.484389,0.348841,0,
-	0.484389,0.348841,0,
-	0.486209,0.346251,0,
-	0.486209,0.346251,0,
-	0.491387,0.346251,0,
-	0.491387,0.346251,0,
-	0.494046,0.346251,0,
-	0.494046,0.346251,0,
-	0.494886,0.344992,0,
-	0.494886,0.344992,0,
-	0.494466,0.340794,0,
-	0.494466,0.340794,0,
-	0.496426,0.339394,0,
-	0.496426,0.339394,0,
-	0.495446,0.337994,0,
-	0.495446,0.337994,0,
-	0.491387,0.337994,0,
-	0.491387,0.337994,0,
-	0.488798,0.336874,0,
-	0.488798,0.336874,0,
-	0.488798,0.335055,0,
-	0.488798,0.335055,0,
-	0.484389,0.331696,0,
-	0.484389,0.331696,0,
-	0.478092,0.330576,0,
-	0.478092,0.330576,0,
-	0.475292,0.328757,0,
-	0.475292,0.328757,0,
-	0.475292,0.324558,0,
-	0.475292,0.324558,0,
-	0.502304,0.307764,0,
-	0.502304,0.307764,0,
-	0.502304,0.306504,0,
-	0.502304,0.306504,0,
-	0.505943,0.304685,0,
-	0.505943,0.304685,0,
-	0.508322,0.304685,0,
-	0.508322,0.304685,0,
-	0.508322,0.301746,0,
-	0.508322,0.301746,0,
-	0.511261,0.301746,0,
-	0.511261,0.301746,0,
-	0.511261,0.294328,0,
-	0.511261,0.294328,0,
-	0.509022,0.290899,0,
-	0.509022,0.290899,0,
-	0.5,0.290129,0,
-	0.5,0.290129,0,
-	0.5,0.28733,0,
-	0.5,0.28733,0,
-	0.502304,0.28733,0,
-	0.502304,0.28733,0,
-	0.502304,0.285301,0,
-	0.502304,0.285301,0,
-	0.505943,0.283831,0,
-	0.505943,0.283831,0,
-	0.505943,0.281032,0,
-	0.505943,0.281032,0,
-	0.503423,0.280122,0,
-	0.503423,0.280122,0,
-	0.501152,0.279213,0,
-	0.501152,0.279213,0,
-	0.502288,0.276973,0,
-	0.502288,0.276973,0,
-	0.503423,0.276973,0,
-	0.503423,0.276973,0,
-	0.503423,0.274734,0,
-	0.503423,0.274734,0,
-	0.504124,0.273754,0,
-	0.504124,0.273754,0,
-	0.504124,0.266617,0,
-	0.504124,0.266617,0,
-	0.508322,0.266617,0,
-	0.508322,0.266617,0,
-	0.511261,0.266617,0,
-	0.511261,0.266617,0,
-	0.5135,0.265077,0,
-	0.5135,0.265077,0,
-	0.51518,0.261928,0,
-	0.51518,0.261928,0,
-	0.515879,0.260879,0,
-	0.515879,0.260879,0,
-	0.520218,0.261403,0,
-	0.520218,0.261403,0,
-	0.520218,0.246481,0,
-	0.520218,0.246481,0,
-	0.506223,0.246481,0,
-	0.506223,0.246481,0,
-	0.506223,0.238205,0,
-	0.507132,0.238205,0,
-	0.519519,0.238205,0,
-	0.520078,0.498384,0,
-	0.520078,0.424767,0,
-	0.520078,0.424767,0,
-	0.516299,0.422948,0,
-	0.516299,0.422948,0,
-	0.5128,0.421408,0,
-	0.5128,0.421408,0,
-	0.5121,0.417209,0,
-	0.5121,0.417209,0,
-	0.5135,0.41609,0,
-	0.5135,0.41609,0,
-	0.51455,0.412171,0,
-	0.51455,0.412171,0,
-	0.516299,0.410491,0,
-	0.516299,0.410491,0,
-	0.518188,0.409792,0,
-	0.518188,0.409792,0,
-	0.520078,0.409792,0,
-	0.520078,0.409792,0,
-	0.520078,0.397685,0,
-	0.520078,0.397685,0,
-	0.5128,0.396636,0,
-	0.5128,0.396636,0,
-	0.5121,0.394536,0,
-	0.5121,0.394536,0,
-	0.507761,0.39151,0,
-	0.507761,0.39151,0,
-	0.503423,0.390898,0,
-	0.503423,0.390898,0,
-	0.503423,0.388239,0,
-	0.503423,0.388239,0,
-	0.5,0.387399,0,
-	0.5,0.387399,0,
-	0.499364,0.385719,0,
-	0.499364,0.385719,0,
-	0.496426,0.386559,0,
-	0.496426,0.386559,0,
-	0.495936,0.387399,0,
-	0.495936,0.387399,0,
-	0.494046,0.386979,0,
-	0.494046,0.386979,0,
-	0.494676,0.3839,0,
-	0.494676,0.3839,0,
-	0.492087,0.3839,0,
-	0.492087,0.3839,0,
-	0.491387,0.3846,0,
-	0.490827,0.3846,0,
-	0.487328,0.3846,0,
-	0.487328,0.3846,0,
-	0.485298,0.3832,0,
-	0.485298,0.3832,0,
-	0.487328,0.381293,0,
-	0.487328,0.381293,0,
-	0.490092,0.380401,0,
-	0.490092,0.380401,0,
-	0.490827,0.380401,0,
-	0.490827,0.380401,0,
-	0.492717,0.380401,0,
-	0.492717,0.380401,0,
-	0.493381,0.377882,0,
-	0.493381,0.377882,0,
-	0.496426,0.375782,0,
-	0.496426,0.375782,0,
-	0.494992,0.368924,0,
-	0.494992,0.368924,0,
-	0.477671,0.370464,0,
-	0.561785,0.498384,0,
-	0.561785,0.474801,0,
-	0.561785,0.474801,0,
-	0.593415,0.474801,0,
-	0.593415,0.474801,0,
-	0.593415,0.459144,0,
-	0.593415,0.459144,0,
-	0.561785,0.459144,0,
-	0.561785,0.459144,0,
-	0.561785,0.44534,0,
-	0.561785,0.44534,0,
-	0.564724,0.44632,0,
-	0.564724,0.44632,0,
-	0.577601,0.44632,0,
-	0.577601,0.44632,0,
-	0.583198,0.44534,0,
-	0.583198,0.44534,0,
-	0.589916,0.442542,0,
-	0.589916,0.442542,0,
-	0.593415,0.441282,0,
-	0.593415,0.441282,0,
-	0.599013,0.441282,0,
-	0.599013,0.441282,0,
-	0.603632,0.439882,0,
-	0.603632,0.439882,0,
-	0.603632,0.467488,0,
-	0.603632,0.467488,0,
-	0.599013,0.467488,0,
-	0.599013,0.467488,0,
-	0.599013,0.474801,0,
-	0.599013,0.474801,0,
-	0.603632,0.474801,0,
-	0.603632,0.474801,0,
-	0.603632,0.498384,0,
-	0.585335,0.44445,0,
-	0.585335,0.441912,0,
-	0.585335,0.441912,0,
-	0.583198,0.441912,0,
-	0.583198,0.441912,0,
-	0.5804,0.441282,0,
-	0.5804,0.441282,0,
-	0.578299,0.439882,0,
-	0.578299,0.439882,0,
-	0.578299,0.438063,0,
-	0.578299,0.438063,0,
-	0.582498,0.436593,0,
-	0.582498,0.436593,0,
-	0.583198,0.435264,0,
-	0.583198,0.435264,0,
-	0.579349,0.434564,0,
-	0.579349,0.434564,0,
-	0.583198,0.431485,0,
-	0.583198,0.431485,0,
-	0.582498,0.429945,0,
-	0.582498,0.429945,0,
-	0.582498,0.429106,0,
-	0.582498,0.429106,0,
-	0.584266,0.426866,0,
-	0.584266,0.426866,0,
-	0.583824,0.425817,0,
-	0.583824,0.425817,0,
-	0.585335,0.423857,0,
-	0.585335,0.423857,0,
-	0.586557,0.423857,0,
-	0.586557,0.423857,0,
-	0.586557,0.422178,0,
-	0.586557,0.422178,0,
-	0.581274,0.418609,0,
-	0.581274,0.418609,0,
-	0.57662,0.41665,0,
-	0.57662,0.41665,0,
-	0.578299,0.413291,0,
-	0.578299,0.413291,0,
-	0.57592,0.412171,0,
-	0.57592,0.412171,0,
-	0.57711,0.409792,0,
-	0.57711,0.409792,0,
-	0.57592,0.408952,0,
-	0.57592,0.408952,0,
-	0.57662,0.407132,0,
-	0.57662,0.407132,0,
-	0.57746,0.404893,0,
-	0.57746,0.404893,0,
-	0.580399,0.404893,0,
-	0.580399,0.404893,0,
-	0.581274,0.403739,0,
-	0.581274,0.403739,0,
-	0.585335,0.403739,0,
-	0.585335,0.403739,0,
-	0.585335,0.400135,0,
-	0.585335,0.400135,0,
-	0.589496,0.397685,0,
-	0.589496,0.397685,0,
-	0.589496,0.396636,0,
-	0.589496,0.396636,0,
-	0.586557,0.396181,0,
-	0.586557,0.396181,0,
-	0.587415,0.393347,0,
-	0.587415,0.393347,0,
-	0.589496,0.393023,0,
-	0.589496,0.393023,0,
-	0.589496,0.394536,0,
-	0.589496,0.394536,0,
-	0.593975,0.394764,0,
-	0.593975,0.394764,0,
-	0.595375,0.393023,0,
-	0.595375,0.393023,0,
-	0.593975,0.391204,0,
-	0.593975,0.391204,0,
-	0.597894,0.390898,0,
-	0.597894,0.390898,0,
-	0.598593,0.388239,0,
-	0.598593,0.388239,0,
-	0.603632,0.388239,0,
-	0.603632,0.388239,0,
-	0.603632,0.387189,0,
-	0.603632,0.387189,0,
-	0.60853,0.387189,0,
-	0.60853,0.387189,0,
-	0.61049,0.386139,0,
-	0.61049,0.386139,0,
-	0.60951,0.3839,0,
-	0.60951,0.3839,0,
-	0.61049,0.382247,0,
-	0.61049,0.382247,0,
-	0.606081,0.381293,0,
-	0.606081,0.381293,0,
-	0.601112,0.373823,0,
-	0.601112,0.373823,0,
-	0.601112,0.363396,0,
-	0.601112,0.363396,0,
-	0.61049,0.362486,0,
-	0.61049,0.362486,0,
-	0.614968,0.364306,0,
-	0.5804,0.441282,0,
-	0.580399,0.442542,0,
-	0.580399,0.442542,0,
-	0.57662,0.443941,0,
-	0.57662,0.443941,0,
-	0.571162,0.442542,0,
-	0.571162,0.442542,0,
-	0.571162,0.440582,0,
-	0.571162,0.440582,0,
-	0.567803,0.438063,0,
-	0.567803,0.438063,0,
-	0.565844,0.439882,0,
-	0.565844,0.439882,0,
-	0.563255,0.439882,0,
-	0.563255,0.439882,0,
-	0.558706,0.441597,0,
-	0.558706,0.441597,0,
-	0.557586,0.440582,0,
-	0.557586,0.440582,0,
-	0.56098,0.438063,0,
-	0.56098,0.438063,0,
-	0.564549,0.438063,0,
-	0.564549,0.438063,0,
-	0.565844,0.434564,0,
-	0.565844,0.434564,0,
-	0.565196,0.433024,0,
-	0.565196,0.433024,0,
-	0.566823,0.431485,0,
-	0.566823,0.431485,0,
-	0.556887,0.424767,0,
-	0.556887,0.424767,0,
-	0.553108,0.41665,0,
-	0.553108,0.41665,0,
-	0.553108,0.41413,0,
-	0.553108,0.41413,0,
-	0.558706,0.41413,0,
-	0.558706,0.41413,0,
-	0.557586,0.402514,0,
-	0.557586,0.402514,0,
-	0.562764,0.401324,0,
-	0.562764,0.401324,0,
-	0.562764,0.400135,0,
-	0.562764,0.400135,0,
-	0.565196,0.399435,0,
-	0.565196,0.399435,0,
-	0.56601,0.395586,0,
-	0.56601,0.395586,0,
-	0.56398,0.393893,0,
-	0.56398,0.393893,0,
-	0.565603,0.392113,0,
-	0.565603,0.392113,0,
-	0.566823,0.389568,0,
-	0.566823,0.389568,0,
-	0.562764,0.386664,0,
-	0.562764,0.386664,0,
-	0.562764,0.38502,0,
-	0.562764,0.38502,0,
-	0.560175,0.38425,0,
-	0.560175,0.38425,0,
-	0.56147,0.383074,0,
-	0.56147,0.383074,0,
-	0.562764,0.382247,0,
-	0.562764,0.382247,0,
-	0.56147,0.380847,0,
-	0.56147,0.380847,0,
-	0.558706,0.377558,0,
-	0.558706,0.377558,0,
-	0.555907,0.376832,0,
-	0.555907,0.376832,0,
-	0.560088,0.372353,0,
-	0.560088,0.372353,0,
-	0.562764,0.372353,0,
-	0.562764,0.372353,0,
-	0.562764,0.371164,0,
-	0.562764,0.371164,0,
-	0.56147,0.369344,0,
-	0.56147,0.369344,0,
-	0.56398,0.368504,0,
-	0.56398,0.368504,0,
-	0.562117,0.366825,0,
-	0.562117,0.366825,0,
-	0.562117,0.365985,0,
-	0.562117,0.365985,0,
-	0.56398,0.365145,0,
-	0.56398,0.365145,0,
-	0.56398,0.363396,0,
-	0.56398,0.363396,0,
-	0.560822,0.362486,0,
-	0.560822,0.362486,0,
-	0.558706,0.362486,0,
-	0.558706,0.362486,0,
-	0.556606,0.359827,0,
-	0.556606,0.359827,0,
-	0.553108,0.359827,0,
-	0.553108,0.359827,0,
-	0.555907,0.357868,0,
-	0.555907,0.357868,0,
-	0.556606,0.357168,0,
-	0.556606,0.357168,0,
-	0.556606,0.355349,0,
-	0.556606,0.355349,0,
-	0.556606,0.353599,0,
-	0.556606,0.353599,0,
-	0.558706,0.352829,0,
-	0.558706,0.352829,0,
-	0.558706,0.35059,0,
-	0.558706,0.35059,0,
-	0.561426,0.35059,0,
-	0.561426,0.35059,0,
-	0.562117,0.35059,0,
-	0.562117,0.35059,0,
-	0.562117,0.340794,0,
-	0.562117,0.340794,0,
-	0.56398,0.339394,0,
-	0.56398,0.339394,0,
-	0.566823,0.337994,0,
-	0.566823,0.337994,0,
-	0.569482,0.337994,0,
-	0.569482,0.337994,0,
-	0.569482,0.336874,0,
-	0.569482,0.336874,0,
-	0.568153,0.335965,0,
-	0.568153,0.335965,0,
-	0.569482,0.334215,0,
-	0.569482,0.334215,0,
-	0.568153,0.332536,0,
-	0.568153,0.332536,0,
-	0.569482,0.330576,0,
-	0.569482,0.330576,0,
-	0.569482,0.304685,0,
-	0.569482,0.304685,0,
-	0.565844,0.303215,0,
-	0.565844,0.303215,0,
-	0.565844,0.292613,0,
-	0.565844,0.292613,0,
-	0.563465,0.292613,0,
-	0.563465,0.292613,0,
-	0.561785,0.28733,0,
-	0.561785,0.28733,0,
-	0.560385,0.284566,0,
-	0.560385,0.284566,0,
-	0.561785,0.283831,0,
-	0.561785,0.283831,0,
-	0.561785,0.281032,0,
-	0.561785,0.281032,0,
-	0.562625,0.278093,0,
-	0.562625,0.278093,0,
-	0.565844,0.275854,0,
-	0.565844,0.275854,0,
-	0.564654,0.272495,0,
-	0.564654,0.272495,0,
-	0.566544,0.272495,0,
-	0.566544,0.272495,0,
-	0.566544,0.271655,0,
-	0.566544,0.271655,0,
-	0.568363,0.271655,0,
-	0.568363,0.271655,0,
-	0.569482,0.268996,0,
-	0.569482,0.268996,0,
-	0.573401,0.267596,0,
-	0.573401,0.267596,0,
-	0.573401,0.266617,0,
-	0.573401,0.266617,0,
-	0.575361,0.265077,0,
-	0.575361,0.265077,0,
-	0.575361,0.262978,0,
-	0.575361,0.262978,0,
-	0.572561,0.261928,0,
-	0.572561,0.261928,0,
-	0.568363,0.262978,0,
-	0.568363,0.262978,0,
-	0.562205,0.261403,0,
-	0.562205,0.261403,0,
-	0.561785,0.260178,0,
-	0.561785,0.260178,0,
-	0.564654,0.259479,0,
-	0.564654,0.259479,0,
-	0.563219,0.258219,0,
-	0.563219,0.258219,0,
-	0.563219,0.25626,0,
-	0.563937,0.25626,0,
-	0.565598,0.25514,0,
-	0.565598,0.25514,0,
-	0.562205,0.25514,0,
-	0.562205,0.25514,0,
-	0.561085,0.252901,0,
-	0.561085,0.252901,0,
-	0.564768,0.246481,0,
-	0.564768,0.246481,0,
-	0.567453,0.244364,0,
-	0.567453,0.244364,0,
-	0.567453,0.243104,0,
-	0.567453,0.243104,0,
-	0.561085,0.243104,0,
-	0.561085,0.243104,0,
-	0.557167,0.241704,0,
-	0.557167,0.241704,0,
-	0.556606,0.238905,0,
-	0.556606,0.238905,0,
-	0.555767,0.233307,0,
-	0.555767,0.233307,0,
-	0.553808,0.232084,0,
-	0.553808,0.232084,0,
-	0.553808,0.229528,0,
-	0.553808,0.229528,0,
-	0.556187,0.229528,0,
-	0.556187,0.229528,0,
-	0.556886,0.228548,0,
-	0.556886,0.228548,0,
-	0.560245,0.228548,0,
-	0.560245,0.228548,0,
-	0.560245,0.22281,0,
-	0.560245,0.22281,0,
-	0.561225,0.220431,0,
-	0.561225,0.220431,0,
-	0.561085,0.217632,0,
-	0.561085,0.217632,0,
-	0.56611,0.217632,0,
-	0.56611,0.217632,0,
-	0.56611,0.212593,0,
-	0.56611,0.212593,0,
-	0.560245,0.212593,0,
-	0.560245,0.212593,0,
-	0.560245,0.203356,0,
-	0.560245,0.203356,0,
-	0.564269,0.200138,0,
-	0.564269,0.200138,0,
-	0.561225,0.199018,0,
-	0.561225,0.199018,0,
-	0.552968,0.199018,0,
-	0.552968,0.199018,0,
-	0.550449,0.200837,0,
-	0.550449,0.200837,0,
-	0.537992,0.200837,0,
-	0.537152,0.200837,0,
-	0.535893,0.201747,0,
-	0.535893,0.201747,0,
-	0.534074,0.200837,0,
-	0.534074,0.200837,0,
-	0.531974,0.201292,0,
-	0.531974,0.201292,0,
-	0.531274,0.199927,0,
-	0.531274,0.199927,0,
-	0.533024,0.197058,0,
-	0.533024,0.197058,0,
-	0.537992,0.188801,0,
-	0.537992,0.188801,0,
-	0.540091,0.186701,0,
-	0.540091,0.186701,0,
-	0.539042,0.181523,0,
-	0.539042,0.181523,0,
-	0.540931,0.180683,0,
-	0.540931,0.180683,0,
-	0.540931,0.176345,0,
-	0.540931,0.176345,0,
-	0.542611,0.171586,0,
-	0.542611,0.171586,0,
-	0.54527,0.169907,0,
-	0.54527,0.169907,0,
-	0.546809,0.167387,0,
-	0.546809,0.167387,0,
-	0.546809,0.165848,0,
-	0.546809,0.165848,0,
-	0.550449,0.16053,0,
-	0.550449,0.16053,0,
-	0.550449,0.15941,0,
-	0.550449,0.15941,0,
-	0.549189,0.157591,0,
-	0.549189,0.157591,0,
-	0.550449,0.155911,0,
-	0.550449,0.155911,0,
-	0.550449,0.154092,0,
-	0.550449,0.154092,0,
-	0.554787,0.152272,0,
-	0.554787,0.152272,0,
-	0.556187,0.153182,0,
-	0.556187,0.153182,0,
-	0.558566,0.154092,0,
-	0.558566,0.154092,0,
-	0.560245,0.153637,0,
-	0.560245,0.153637,0,
-	0.561225,0.155071,0,
-	0.602932,0.200138,0,
-	0.60979,0.203356,0,
-	0.60979,0.203356,0,
-	0.612729,0.207135,0,
-	0.612729,0.207135,0,
-	0.612729,0.208535,0,
-	0.612729,0.208535,0,
-	0.61126,0.210354,0,
-	0.61126,0.210354,0,
-	0.611995,0.217632,0,
-	0.611995,0.217632,0,
-	0.612729,0.219031,0,
-	0.612729,0.219031,0,
-	0.611627,0.220431,0,
-	0.611627,0.220431,0,
-	0.60979,0.218611,0,
-	0.610709,0.218611,0,
-	0.604332,0.217632,0,
-	0.604332,0.217632,0,
-	0.604332,0.216512,0,
-	0.604332,0.216512,0,
-	0.599153,0.216512,0,
-	0.599153,0.216512,0,
-	0.598593,0.217632,0,
-	0.598593,0.217632,0,
-	0.596074,0.217632,0,
-	0.596074,0.217632,0,
-	0.594535,0.22281,0,
-	0.594535,0.22281,0,
-	0.590896,0.22281,0,
-	0.590896,0.22281,0,
-	0.585018,0.22463,0,
-	0.585018,0.22463,0,
-	0.583339,0.229528,0,
-	0.583339,0.229528,0,
-	0.581659,0.230228,0,
-	0.581659,0.230228,0,
-	0.580119,0.236106,0,
-	0.580119,0.236106,0,
-	0.583339,0.238205,0,
-	0.583339,0.238205,0,
-	0.586137,0.238905,0,
-	0.586137,0.238905,0,
-	0.586137,0.240305,0,
-	0.586137,0.240305,0,
-	0.584178,0.241704,0,
-	0.584178,0.241704,0,
-	0.586137,0.243104,0,
-	0.586137,0.243104,0,
-	0.585158,0.245422,0,
-	0.585158,0.245422,0,
-	0.581729,0.245422,0,
-	0.581729,0.245422,0,
-	0.581729,0.248982,0,
-	0.581729,0.248982,0,
-	0.583339,0.252201,0,
-	0.583339,0.252201,0,
-	0.586698,0.25514,0,
-	0.586698,0.25514,0,
-	0.585018,0.25626,0,
-	0.585018,0.25626,0,
-	0.585648,0.259479,0,
-	0.585648,0.259479,0,
-	0.587957,0.259829,0,
-	0.587957,0.259829,0,
-	0.592716,0.259829,0,
-	0.592716,0.259829,0,
-	0.594535,0.261403,0,
-	0.594535,0.261403,0,
-	0.598593,0.261403,0,
-	0.598593,0.261403,0,
-	0.598873,0.264027,0,
-	0.598873,0.264027,0,
-	0.597334,0.264027,0,
-	0.597334,0.264027,0,
-	0.596074,0.267596,0,
-	0.596074,0.267596,0,
-	0.592716,0.270325,0,
-	0.592716,0.270325,0,
-	0.590896,0.270325,0,
-	0.590896,0.270325,0,
-	0.591806,0.272495,0,
-	0.591806,0.272495,0,
-	0.594395,0.272495,0,
-	0.594395,0.272495,0,
-	0.593625,0.276973,0,
-	0.593101,0.275854,0,
-	0.594535,0.278793,0,
-	0.594535,0.278793,0,
-	0.596704,0.278793,0,
-	0.596704,0.278793,0,
-	0.597334,0.282431,0,
-	0.597334,0.282431,0,
-	0.598104,0.284199,0,
-	0.598104,0.284199,0,
-	0.599713,0.284199,0,
-	0.599713,0.284199,0,
-	0.601112,0.28733,0,
-	0.601112,0.28733,0,
-	0.600413,0.290899,0,
-	0.600413,0.290899,0,
-	0.601952,0.293348,0,
-	0.601952,0.293348,0,
-	0.601952,0.295868,0,
-	0.601952,0.295868,0,
-	0.605801,0.297914,0,
-	0.605801,0.297914,0,
-	0.607131,0.299646,0,
-	0.607131,0.299646,0,
-	0.605801,0.300626,0,
-	0.605801,0.300626,0,
-	0.605801,0.302585,0,
-	0.605801,0.302585,0,
-	0.603877,0.302585,0,
-	0.603877,0.302585,0,
-	0.603877,0.316161,0,
-	0.603877,0.316161,0,
-	0.597019,0.326518,0,
-	0.597019,0.326518,0,
-	0.595619,0.326518,0,
-	0.595619,0.326518,0,
-	0.596074,0.330576,0,
-	0.596074,0.330576,0,
-	0.599713,0.330576,0,
-	0.599713,0.330576,0,
-	0.601112,0.331556,0,
-	0.601112,0.331556,0,
-	0.603877,0.331556,0,
-	0.603877,0.331556,0,
-	0.603877,0.333376,0,
-	0.603877,0.333376,0,
-	0.605801,0.333376,0,
-	0.605801,0.333376,0,
-	0.602494,0.336874,0,
-	0.602494,0.336874,0,
-	0.608111,0.337994,0,
-	0.608111,0.337994,0,
-	0.607131,0.341493,0,
-	0.607131,0.341493,0,
-	0.613989,0.344152,0,
-	0.613989,0.344152,0,
-	0.613989,0.349471,0,
-	0.613989,0.349471,0,
-	0.614968,0.35059,0,
-	0.614968,0.35059,0,
-	0.616228,0.35059,0,
-	0.616228,0.35059,0,
-	0.618467,0.352829,0,
-	0.618467,0.352829,0,
-	0.622526,0.35171,0,
-	0.622526,0.35171,0,
-	0.623646,0.35227,0,
-	0.623646,0.35227,0,
-	0.621826,0.357868,0,
-	0.621826,0.357868,0,
-	0.623086,0.358847,0,
-	0.623086,0.358847,0,
-	0.620496,0.362486,0,
-	0.620496,0.362486,0,
-	0.618467,0.364306,0,
-	0.618467,0.364306,0,
-	0.614968,0.364306,0,
-	0.644779,0.498384,0,
-	0.644779,0.47893,0,
-	0.686625,0.498384,0,
-	0.686625,0.47893,0,
-	0.686625,0.462975,0,
-	0.690964,0.462975,0,
-	0.690964,0.462975,0,
-	0.690964,0.461016,0,
-	0.690964,0.461016,0,
-	0.686625,0.459896,0,
-	0.686625,0.459896,0,
-	0.686625,0.453528,0,
-	0.644779,0.47893,0,
-	0.686625,0.47893,0,
-	0.728192,0.498384,0,
-	0.728192,0.492366,0,
-	0.728192,0.492366,0,
-	0.686625,0.475431,0,
-	0.686625,0.44716,0,
-	0.684946,0.44632,0,
-	0.684946,0.44632,0,
-	0.684106,0.44534,0,
-	0.684106,0.44534,0,
-	0.686625,0.44445,0,
-	0.686625,0.44445,0,
-	0.685786,0.443941,0,
-	0.685786,0.443941,0,
-	0.684946,0.442542,0,
-	0.684946,0.442542,0,
-	0.685366,0.441089,0,
-	0.685366,0.441089,0,
-	0.687885,0.441562,0,
-	0.687885,0.441562,0,
-	0.689845,0.440582,0,
-	0.689845,0.440582,0,
-	0.691524,0.439882,0,
-	0.691524,0.439882,0,
-	0.689845,0.438063,0,
-	0.689845,0.438063,0,
-	0.683267,0.440739,0,
-	0.683267,0.440739,0,
-	0.679348,0.441325,0,
-	0.679348,0.441325,0,
-	0.678368,0.439882,0,
-	0.678368,0.439882,0,
-	0.681307,0.439401,0,
-	0.681307,0.439401,0,
-	0.680747,0.438063,0,
-	0.680747,0.438063,0,
-	0.683267,0.437328,0,
-	0.683267,0.437328,0,
-	0.683267,0.436313,0,
-	0.683267,0.436313,0,
-	0.679838,0.433794,0,
-	0.679838,0.433794,0,
-	0.67389,0.433024,0,
-	0.67389,0.433024,0,
-	0.67389,0.432255,0,
-	0.67389,0.432255,0,
-	0.670111,0.430715,0,
-	0.670111,0.430715,0,
-	0.667872,0.429106,0,
-	0.667872,0.429106,0,
-	0.666332,0.429526,0,
-	0.666332,0.429526,0,
-	0.664513,0.428126,0,
-	0.664513,0.428126,0,
-	0.665422,0.425817,0,
-	0.665422,0.425817,0,
-	0.662973,0.423857,0,
-	0.662973,0.423857,0,
-	0.664513,0.422178,0,
-	0.664513,0.422178,0,
-	0.662973,0.418609,0,
-	0.662973,0.418609,0,
-	0.657095,0.419728,0,
-	0.657095,0.419728,0,
-	0.651217,0.417629,0,
-	0.651217,0.417629,0,
-	0.645898,0.418609,0,
-	0.645898,0.418609,0,
-	0.643099,0.417629,0,
-	0.643099,0.417629,0,
-	0.644499,0.41539,0,
-	0.644499,0.41539,0,
-	0.648558,0.41539,0,
-	0.648558,0.41539,0,
-	0.646528,0.413291,0,
-	0.646528,0.413291,0,
-	0.648558,0.412731,0,
-	0.648558,0.412731,0,
-	0.651217,0.408042,0,
-	0.651217,0.408042,0,
-	0.649887,0.406013,0,
-	0.649887,0.406013,0,
-	0.650552,0.404316,0,
-	0.650552,0.404316,0,
-	0.647543,0.404316,0,
-	0.647543,0.404316,0,
-	0.645898,0.405164,0,
-	0.645898,0.405164,0,
-	0.643799,0.403739,0,
-	0.643799,0.403739,0,
-	0.642119,0.404316,0,
-	0.642119,0.404316,0,
-	0.635262,0.408042,0,
-	0.635262,0.408042,0,
-	0.629103,0.406179,0,
-	0.629103,0.406179,0,
-	0.628404,0.408322,0,
-	0.628404,0.408322,0,
-	0.631343,0.408952,0,
-	0.631343,0.408952,0,
-	0.631343,0.410386,0,
-	0.631343,0.410386,0,
-	0.628404,0.409792,0,
-	0.628404,0.409792,0,
-	0.628404,0.410981,0,
-	0.628404,0.410981,0,
-	0.631343,0.412731,0,
-	0.631343,0.412731,0,
-	0.627564,0.41651,0,
-	0.627564,0.41651,0,
-	0.631343,0.419169,0,
-	0.631343,0.419169,0,
-	0.633862,0.418119,0,
-	0.633862,0.418119,0,
-	0.633862,0.41497,0,
-	0.633862,0.41497,0,
-	0.637781,0.413011,0,
-	0.637781,0.413011,0,
-	0.637781,0.41462,0,
-	0.637781,0.41462,0,
-	0.642959,0.41462,0,
-	0.642959,0.41462,0,
-	0.643799,0.41651,0,
-	0.650552,0.404316,0,
-	0.646721,0.401324,0,
-	0.646721,0.401324,0,
-	0.647543,0.400729,0,
-	0.647543,0.400729,0,
-	0.647543,0.39891,0,
-	0.647543,0.39891,0,
-	0.644849,0.399435,0,
-	0.644849,0.399435,0,
-	0.643799,0.396181,0,
-	0.643799,0.396181,0,
-	0.64142,0.393004,0,
-	0.64142,0.393004,0,
-	0.634702,0.388239,0,
-	0.634702,0.388239,0,
-	0.634702,0.387189,0,
-	0.634702,0.387189,0,
-	0.633862,0.386664,0,
-	0.633862,0.386664,0,
-	0.631343,0.388239,0,
-	0.631343,0.388239,0,
-	0.629103,0.386927,0,
-	0.629103,0.386927,0,
-	0.629873,0.384635,0,
-	0.629873,0.384635,0,
-	0.628404,0.383662,0,
-	0.628404,0.383662,0,
-	0.629103,0.38266,0,
-	0.629103,0.38266,0,
-	0.630224,0.38266,0,
-	0.630224,0.38266,0,
-	0.631343,0.381293,0,
-	0.631343,0.381293,0,
-	0.633862,0.381293,0,
-	0.633862,0.381293,0,
-	0.635262,0.379202,0,
-	0.635262,0.379202,0,
-	0.636522,0.377195,0,
-	0.636522,0.377195,0,
-	0.634702,0.375502,0,
-	0.634702,0.375502,0,
-	0.631343,0.375502,0,
-	0.631343,0.375502,0,
-	0.629489,0.376349,0,
-	0.629489,0.376349,0,
-	0.628404,0.378199,0,
-	0.628404,0.378199,0,
-	0.630224,0.379202,0,
-	0.630224,0.379202,0,
-	0.628404,0.380847,0,
-	0.628404,0.380847,0,
-	0.625885,0.381977,0,
-	0.625885,0.381977,0,
-	0.622737,0.382247,0,
-	0.622737,0.382247,0,
-	0.620496,0.380248,0,
-	0.620496,0.380248,0,
-	0.618467,0.380248,0,
-	0.618467,0.380248,0,
-	0.617347,0.382112,0,
-	0.617347,0.382112,0,
-	0.616228,0.38177,0,
-	0.616228,0.38177,0,
-	0.616228,0.383161,0,
-	0.616228,0.383161,0,
-	0.617907,0.384148,0,
-	0.617907,0.384148,0,
-	0.617907,0.38502,0,
-	0.617907,0.38502,0,
-	0.616228,0.38502,0,
-	0.616228,0.38502,0,
-	0.616228,0.386927,0,
-	0.616228,0.386927,0,
-	0.614968,0.387583,0,
-	0.614968,0.387583,0,
-	0.614479,0.390621,0,
-	0.614479,0.390621,0,
-	0.616228,0.391204,0,
-	0.616228,0.391204,0,
-	0.617907,0.391204,0,
-	0.617907,0.391204,0,
-	0.617907,0.393004,0,
-	0.617907,0.393004,0,
-	0.619482,0.394764,0,
-	0.619482,0.394764,0,
-	0.628404,0.394764,0,
-	0.628404,0.394764,0,
-	0.629313,0.395586,0,
-	0.629313,0.395586,0,
-	0.632603,0.395175,0,
-	0.632603,0.395175,0,
-	0.633862,0.395586,0,
-	0.633862,0.395586,0,
-	0.633023,0.39716,0,
-	0.633023,0.39716,0,
-	0.634562,0.39891,0,
-	0.634562,0.39891,0,
-	0.638691,0.398035,0,
-	0.638691,0.398035,0,
-	0.638691,0.400135,0,
-	0.638061,0.400135,0,
-	0.64142,0.399785,0,
-	0.64142,0.399785,0,
-	0.642959,0.400729,0,
-	0.642959,0.400729,0,
-	0.644849,0.399435,0,
-	0.614968,0.364306,0,
-	0.614968,0.366825,0,
-	0.614968,0.366825,0,
-	0.61049,0.369344,0,
-	0.61049,0.369344,0,
-	0.613989,0.370254,0,
-	0.613989,0.370254,0,
-	0.615353,0.368924,0,
-	0.615353,0.368924,0,
-	0.618467,0.368924,0,
-	0.618467,0.368924,0,
-	0.621826,0.366825,0,
-	0.621826,0.366825,0,
-	0.625885,0.366825,0,
-	0.625885,0.366825,0,
-	0.629313,0.365145,0,
-	0.629313,0.365145,0,
-	0.631343,0.363396,0,
-	0.631343,0.363396,0,
-	0.633862,0.363396,0,
-	0.633862,0.363396,0,
-	0.634562,0.365145,0,
-	0.634562,0.365145,0,
-	0.630783,0.368504,0,
-	0.630783,0.368504,0,
-	0.631903,0.371164,0,
-	0.631903,0.371164,0,
-	0.631343,0.372353,0,
-	0.631343,0.372353,0,
-	0.630224,0.371164,0,
-	0.630224,0.371164,0,
-	0.628404,0.372353,0,
-	0.628404,0.372353,0,
-	0.631343,0.375502,0,
-	0.634562,0.365145,0,
-	0.638061,0.361157,0,
-	0.638061,0.361157,0,
-	0.636522,0.357168,0,
-	0.636522,0.357168,0,
-	0.635262,0.355349,0,
-	0.635262,0.355349,0,
-	0.632603,0.356259,0,
-	0.632603,0.356259,0,
-	0.632672,0.359162,0,
-	0.632672,0.359162,0,
-	0.630783,0.358847,0,
-	0.630783,0.358847,0,
-	0.628859,0.356259,0,
-	0.628859,0.356259,0,
-	0.625885,0.356259,0,
-	0.625885,0.356259,0,
-	0.623086,0.358847,0,
-	0.623646,0.35227,0,
-	0.625885,0.348491,0,
-	0.625885,0.348491,0,
-	0.628404,0.348491,0,
-	0.628404,0.348491,0,
-	0.627599,0.345692,0,
-	0.627599,0.345692,0,
-	0.625885,0.344992,0,
-	0.625885,0.344992,0,
-	0.625885,0.342823,0,
-	0.625885,0.342823,0,
-	0.628001,0.340094,0,
-	0.628001,0.340094,0,
-	0.632603,0.336874,0,
-	0.632603,0.336874,0,
-	0.632603,0.334215,0,
-	0.632603,0.334215,0,
-	0.634212,0.332466,0,
-	0.634212,0.332466,0,
-	0.638061,0.331556,0,
-	0.638061,0.331556,0,
-	0.64261,0.325538,0,
-	0.64324,0.325538,0,
-	0.645339,0.325538,0,
-	0.645339,0.325538,0,
-	0.646599,0.323159,0,
-	0.646599,0.323159,0,
-	0.649677,0.323159,0,
-	0.649677,0.323159,0,
-	0.651217,0.3205,0,
-	0.651217,0.3205,0,
-	0.654156,0.323159,0,
-	0.654156,0.323159,0,
-	0.657515,0.324349,0,
-	0.657515,0.324349,0,
-	0.658914,0.3205,0,
-	0.658914,0.3205,0,
-	0.67067,0.31854,0,
-	0.67067,0.31854,0,
-	0.67067,0.321829,0,
-	0.67067,0.321829,0,
-	0.67515,0.323159,0,
-	0.67515,0.323159,0,
-	0.67515,0.324349,0,
-	0.67515,0.324349,0,
-	0.67389,0.324349,0,
-	0.67389,0.324349,0,
-	0.67389,0.326518,0,
-	0.67389,0.326518,0,
-	0.67067,0.328547,0,
-	0.67067,0.328547,0,
-	0.668291,0.332011,0,
-	0.668291,0.332011,0,
-	0.671371,0.334215,0,
-	0.671371,0.334215,0,
-	0.671371,0.335965,0,
-	0.671371,0.335965,0,
-	0.668291,0.33642,0,
-	0.668291,0.33642,0,
-	0.667592,0.343907,0,
-	0.667592,0.343907,0,
-	0.669831,0.348491,0,
-	0.669831,0.348491,0,
-	0.669481,0.35059,0,
-	0.669481,0.35059,0,
-	0.666892,0.35059,0,
-	0.666892,0.35059,0,
-	0.663813,0.353214,0,
-	0.663813,0.353214,0,
-	0.660874,0.353599,0,
-	0.660874,0.353599,0,
-	0.658215,0.355349,0,
-	0.658215,0.355349,0,
-	0.652687,0.354474,0,
-	0.652687,0.354474,0,
-	0.651217,0.352829,0,
-	0.651217,0.352829,0,
-	0.649677,0.35227,0,
-	0.649677,0.35227,0,
-	0.649677,0.35059,0,
-	0.649677,0.35059,0,
-	0.643799,0.35003,0,
-	0.643799,0.35003,0,
-	0.638061,0.352549,0,
-	0.638061,0.352549,0,
-	0.635892,0.352549,0,
-	0.635892,0.352549,0,
-	0.635262,0.355349,0,
-	0.645339,0.324349,0,
-	0.645339,0.316161,0,
-	0.645339,0.316161,0,
-	0.64261,0.315601,0,
-	0.64261,0.315601,0,
-	0.645969,0.312942,0,
-	0.645969,0.312942,0,
-	0.649677,0.311822,0,
-	0.649677,0.311822,0,
-	0.652687,0.311822,0,
-	0.652687,0.311822,0,
-	0.654156,0.310003,0,
-	0.654156,0.310003,0,
-	0.654156,0.308184,0,
-	0.654156,0.308184,0,
-	0.652057,0.303215,0,
-	0.652057,0.303215,0,
-	0.64324,0.301606,0,
-	0.64324,0.301606,0,
-	0.647648,0.295868,0,
-	0.647648,0.295868,0,
-	0.645339,0.294608,0,
-	0.645339,0.294608,0,
-	0.645339,0.28733,0,
-	0.645339,0.28733,0,
-	0.654156,0.28733,0,
-	0.654156,0.28733,0,
-	0.654156,0.278093,0,
-	0.644639,0.278093,0,
-	0.654156,0.278093,0,
-	0.686346,0.282711,0,
-	0.70524,0.282711,0,
-	0.70524,0.282711,0,
-	0.70524,0.270325,0,
-	0.70524,0.270325,0,
-	0.686346,0.270325,0,
-	0.686346,0.315601,0,
-	0.685366,0.31854,0,
-	0.685366,0.31854,0,
-	0.684387,0.317841,0,
-	0.684387,0.317841,0,
-	0.684387,0.31952,0,
-	0.684387,0.31952,0,
-	0.67067,0.31854,0,
-	0.668711,0.347092,0,
-	0.671371,0.347092,0,
-	0.671371,0.347092,0,
-	0.67228,0.346811,0,
-	0.67228,0.346811,0,
-	0.67452,0.346811,0,
-	0.67452,0.346811,0,
-	0.67515,0.348491,0,
-	0.67515,0.348491,0,
-	0.678928,0.349541,0,
-	0.678928,0.349541,0,
-	0.678928,0.351902,0,
-	0.678928,0.351902,0,
-	0.682707,0.353214,0,
-	0.682707,0.353214,0,
-	0.687465,0.35227,0,
-	0.687465,0.35227,0,
-	0.688865,0.35143,0,
-	0.688865,0.35143,0,
-	0.691804,0.35227,0,
-	0.691804,0.35227,0,
-	0.694464,0.353214,0,
-	0.694464,0.353214,0,
-	0.695793,0.355069,0,
-	0.695793,0.355069,0,
-	0.696983,0.355803,0,
-	0.696983,0.355803,0,
-	0.698522,0.353652,0,
-	0.698522,0.353652,0,
-	0.697752,0.35031,0,
-	0.697752,0.35031,0,
-	0.696983,0.349016,0,
-	0.696983,0.349016,0,
-	0.698137,0.347651,0,
-	0.698137,0.347651,0,
-	0.698522,0.345692,0,
-	0.698522,0.345692,0,
-	0.696387,0.343907,0,
-	0.696387,0.343907,0,
-	0.693133,0.342823,0,
-	0.693133,0.342823,0,
-	0.694464,0.341458,0,
-	0.694464,0.341458,0,
-	0.692504,0.340794,0,
-	0.692504,0.340794,0,
-	0.691804,0.336874,0,
-	0.691804,0.336874,0,
-	0.688865,0.33642,0,
-	0.688865,0.33642,0,
-	0.686346,0.335545,0,
-	0.686346,0.335545,0,
-	0.684876,0.335545,0,
-	0.684876,0.335545,0,
-	0.682707,0.334215,0,
-	0.682707,0.334215,0,
-	0.683791,0.332466,0,
-	0.683791,0.332466,0,
-	0.680818,0.330576,0,
-	0.680818,0.330576,0,
-	0.67228,0.330576,0,
-	0.67228,0.330576,0,
-	0.668291,0.332011,0,
-	0.687465,0.35227,0,
-	0.688865,0.354911,0,
-	0.688865,0.354911,0,
-	0.688166,0.357168,0,
-	0.688166,0.357168,0,
-	0.685786,0.357868,0,
-	0.685786,0.357868,0,
-	0.684946,0.360667,0,
-	0.684946,0.360667,0,
-	0.684106,0.365145,0,
-	0.684106,0.365145,0,
-	0.683249,0.365565,0,
-	0.683249,0.365565,0,
-	0.682305,0.366825,0,
-	0.682305,0.366825,0,
-	0.687885,0.368504,0,
-	0.687885,0.368504,0,
-	0.688515,0.370254,0,
-	0.688515,0.370254,0,
-	0.686625,0.372353,0,
-	0.686625,0.372353,0,
-	0.685786,0.377195,0,
-	0.685786,0.377195,0,
-	0.681553,0.377195,0,
-	0.681553,0.377195,0,
-	0.6734,0.379202,0,
-	0.6734,0.379202,0,
-	0.677476,0.38177,0,
-	0.677476,0.38177,0,
-	0.676864,0.383161,0,
-	0.676864,0.383161,0,
-	0.6734,0.38502,0,
-	0.6734,0.38502,0,
-	0.67228,0.386664,0,
-	0.67228,0.386664,0,
-	0.6734,0.387714,0,
-	0.6734,0.387714,0,
-	0.67228,0.389568,0,
-	0.67228,0.389568,0,
-	0.677476,0.390621,0,
-	0.677476,0.390621,0,
-	0.678368,0.389102,0,
-	0.678368,0.389102,0,
-	0.679838,0.390621,0,
-	0.679838,0.390621,0,
-	0.679348,0.393185,0,
-	0.679348,0.393185,0,
-	0.682777,0.394536,0,
-	0.682777,0.394536,0,
-	0.683791,0.396181,0,
-	0.683791,0.396181,0,
-	0.682707,0.398473,0,
-	0.682707,0.398473,0,
-	0.683285,0.400729,0,
-	0.683285,0.400729,0,
-	0.689845,0.401936,0,
-	0.689845,0.401936,0,
-	0.69476,0.401936,0,
-	0.69476,0.401936,0,
-	0.696387,0.405164,0,
-	0.696387,0.405164,0,
-	0.698137,0.406179,0,
-	0.698137,0.406179,0,
-	0.697752,0.40725,0,
-	0.697752,0.40725,0,
-	0.695574,0.408042,0,
-	0.695574,0.408042,0,
-	0.69476,0.409792,0,
-	0.69476,0.409792,0,
-	0.695793,0.410981,0,
-	0.695793,0.410981,0,
-	0.697262,0.410981,0,
-	0.697262,0.410981,0,
-	0.697752,0.409792,0,
-	0.697752,0.409792,0,
-	0.7058,0.410089,0,
-	0.7058,0.410089,0,
-	0.708459,0.411856,0,
-	0.708459,0.411856,0,
-	0.710419,0.41434,0,
-	0.710419,0.41434,0,
-	0.712378,0.41399,0,
-	0.712378,0.41399,0,
-	0.713498,0.417629,0,
-	0.713498,0.417629,0,
-	0.719795,0.417629,0,
-	0.719795,0.417629,0,
-	0.720635,0.416545,0,
-	0.720635,0.416545,0,
-	0.725954,0.417629,0,
-	0.725954,0.417629,0,
-	0.728192,0.417087,0,
-	0.728192,0.417087,0,
-	0.730712,0.418119,0,
-	0.730712,0.418119,0,
-	0.733931,0.417087,0,
-	0.733931,0.417087,0,
-	0.73855,0.419728,0,
-	0.73855,0.419728,0,
-	0.733371,0.421268,0,
-	0.733371,0.421268,0,
-	0.73624,0.423018,0,
-	0.73624,0.423018,0,
-	0.73624,0.424837,0,
-	0.73624,0.424837,0,
-	0.734805,0.425817,0,
-	0.734805,0.425817,0,
-	0.73855,0.426971,0,
-	0.73855,0.426971,0,
-	0.73771,0.428826,0,
-	0.73771,0.428826,0,
-	0.733371,0.429316,0,
-	0.733371,0.429316,0,
-	0.733371,0.431485,0,
-	0.733371,0.431485,0,
-	0.730712,0.431485,0,
-	0.730712,0.431485,0,
-	0.729452,0.435054,0,
-	0.729452,0.435054,0,
-	0.728192,0.435054,0,
-	0.728192,0.435054,0,
-	0.725954,0.436821,0,
-	0.725954,0.436821,0,
-	0.728822,0.437695,0,
-	0.728822,0.437695,0,
-	0.729452,0.439401,0,
-	0.729452,0.439401,0,
-	0.725954,0.441325,0,
-	0.725954,0.441325,0,
-	0.720635,0.441325,0,
-	0.720635,0.441325,0,
-	0.719096,0.441815,0,
-	0.719096,0.441815,0,
-	0.719096,0.443241,0,
-	0.719096,0.443241,0,
-	0.723294,0.44445,0,
-	0.723294,0.44445,0,
-	0.723294,0.44583,0,
-	0.723294,0.44583,0,
-	0.719795,0.44674,0,
-	0.719795,0.44674,0,
-	0.722175,0.44842,0,
-	0.722175,0.44842,0,
-	0.717416,0.449679,0,
-	0.717416,0.449679,0,
-	0.716646,0.451219,0,
-	0.716646,0.451219,0,
-	0.716646,0.452618,0,
-	0.716646,0.452618,0,
-	0.727388,0.453528,0,
-	0.727388,0.453528,0,
-	0.686625,0.453528,0,
-	0.727388,0.453528,0,
-	0.727388,0.456957,0,
-	0.727388,0.456957,0,
-	0.729452,0.456957,0,
-	0.729452,0.456957,0,
-	0.730712,0.458497,0,
-	0.730712,0.458497,0,
-	0.730712,0.459896,0,
-	0.730712,0.459896,0,
-	0.730082,0.460456,0,
-	0.730082,0.460456,0,
-	0.727388,0.460456,0,
-	0.727388,0.460456,0,
-	0.727388,0.480679,0,
-	0.727388,0.480679,0,
-	0.77032,0.480679,0,
-	0.77032,0.480679,0,
-	0.77032,0.498384,0,
-	0.707143,0.410981,0,
-	0.710419,0.408042,0,
-	0.710419,0.408042,0,
-	0.710419,0.404452,0,
-	0.710419,0.404452,0,
-	0.707759,0.40282,0,
-	0.707759,0.40282,0,
-	0.708459,0.401324,0,
-	0.708459,0.401324,0,
-	0.709439,0.400135,0,
-	0.709439,0.400135,0,
-	0.710419,0.398035,0,
-	0.710419,0.398035,0,
-	0.712938,0.399172,0,
-	0.712938,0.399172,0,
-	0.716646,0.395586,0,
-	0.716646,0.395586,0,
-	0.722314,0.389102,0,
-	0.722314,0.389102,0,
-	0.725114,0.391903,0,
-	0.725114,0.391903,0,
-	0.725954,0.390095,0,
-	0.725954,0.390095,0,
-	0.730712,0.389862,0,
-	0.730712,0.389862,0,
-	0.732321,0.390095,0,
-	0.732321,0.390095,0,
-	0.733931,0.388239,0,
-	0.734805,0.387714,0,
-	0.735523,0.387583,0,
-	0.735523,0.387583,0,
-	0.73596,0.386927,0,
-	0.73596,0.386927,0,
-	0.740229,0.386664,0,
-	0.740229,0.386664,0,
-	0.741489,0.38502,0,
-	0.741489,0.38502,0,
-	0.740229,0.383161,0,
-	0.740229,0.383161,0,
-	0.736678,0.383161,0,
-	0.736678,0.383161,0,
-	0.736678,0.380025,0,
-	0.736678,0.380025,0,
-	0.73596,0.378701,0,
-	0.73596,0.378701,0,
-	0.729452,0.379363,0,
-	0.729452,0.379363,0,
-	0.728192,0.375926,0,
-	0.728192,0.375926,0,
-	0.728822,0.373928,0,
-	0.728822,0.373928,0,
-	0.725114,0.373928,0,
-	0.725114,0.373928,0,
-	0.720635,0.373928,0,
-	0.720635,0.373928,0,
-	0.720635,0.373141,0,
-	0.720635,0.373141,0,
-	0.722314,0.372353,0,
-	0.722314,0.372353,0,
-	0.723714,0.368924,0,
-	0.723714,0.368924,0,
-	0.722314,0.367665,0,
-	0.722314,0.367665,0,
-	0.722314,0.365565,0,
-	0.722314,0.365565,0,
-	0.717416,0.363396,0,
-	0.717416,0.363396,0,
-	0.716646,0.362486,0,
-	0.716646,0.362486,0,
-	0.713498,0.362486,0,
-	0.713498,0.362486,0,
-	0.711678,0.361157,0,
-	0.711678,0.361157,0,
-	0.709439,0.360667,0,
-	0.709439,0.360667,0,
-	0.708459,0.361157,0,
-	0.708459,0.361157,0,
-	0.70454,0.360107,0,
-	0.70454,0.360107,0,
-	0.70356,0.35771,0,
-	0.70356,0.35771,0,
-	0.70454,0.356259,0,
-	0.70454,0.356259,0,
-	0.707143,0.355069,0,
-	0.707143,0.355069,0,
-	0.707759,0.35199,0,
-	0.707759,0.35199,0,
-	0.710419,0.35031,0,
-	0.710419,0.35031,0,
-	0.710559,0.348334,0,
-	0.710559,0.348334,0,
-	0.712938,0.347651,0,
-	0.712938,0.347651,0,
-	0.715072,0.346952,0,
-	0.715072,0.346952,0,
-	0.712938,0.3448,0,
-	0.712938,0.3448,0,
-	0.708459,0.3448,0,
-	0.708459,0.3448,0,
-	0.70454,0.344992,0,
-	0.70454,0.344992,0,
-	0.70524,0.340794,0,
-	0.70524,0.340794,0,
-	0.70713,0.338834,0,
-	0.70713,0.338834,0,
-	0.709088,0.338484,0,
-	0.709088,0.338484,0,
-	0.708949,0.336647,0,
-	0.708949,0.336647,0,
-	0.7065,0.337565,0,
-	0.7065,0.337565,0,
-	0.7065,0.335545,0,
-	0.7065,0.335545,0,
-	0.70405,0.330576,0,
-	0.70405,0.330576,0,
-	0.698522,0.326518,0,
-	0.698522,0.326518,0,
-	0.696387,0.325538,0,
-	0.696387,0.325538,0,
-	0.69476,0.326028,0,
-	0.69476,0.326028,0,
-	0.692303,0.324349,0,
-	0.692303,0.324349,0,
-	0.692303,0.322494,0,
-	0.692303,0.322494,0,
-	0.694464,0.322424,0,
-	0.694464,0.322424,0,
-	0.694464,0.320185,0,
-	0.694464,0.320185,0,
-	0.695793,0.320185,0,
-	0.695793,0.320185,0,
-	0.696983,0.317071,0,
-	0.696983,0.317071,0,
-	0.694464,0.316161,0,
-	0.694464,0.316161,0,
-	0.693484,0.315601,0,
-	0.693484,0.315601,0,
-	0.690335,0.316161,0,
-	0.690335,0.316161,0,
-	0.689565,0.314272,0,
-	0.689565,0.314272,0,
-	0.691804,0.312382,0,
-	0.691804,0.312382,0,
-	0.68995,0.310003,0,
-	0.68995,0.310003,0,
-	0.694464,0.3057,0,
-	0.694464,0.3057,0,
-	0.698329,0.3057,0,
-	0.698329,0.3057,0,
-	0.699782,0.308184,0,
-	0.699782,0.308184,0,
-	0.701286,0.309093,0,
-	0.701286,0.309093,0,
-	0.701286,0.3057,0,
-	0.701286,0.3057,0,
-	0.701286,0.304125,0,
-	0.701286,0.304125,0,
-	0.702861,0.293488,0,
-	0.702861,0.293488,0,
-	0.7065,0.28649,0,
-	0.7065,0.28649,0,
-	0.707452,0.283411,0,
-	0.707452,0.283411,0,
-	0.710699,0.278093,0,
-	0.710699,0.278093,0,
-	0.711749,0.273614,0,
-	0.711749,0.273614,0,
-	0.714005,0.271375,0,
-	0.714005,0.271375,0,
-	0.716646,0.271375,0,
-	0.716646,0.271375,0,
-	0.717031,0.273614,0,
-	0.717031,0.273614,0,
-	0.718816,0.274734,0,
-	0.718816,0.274734,0,
-	0.721475,0.273614,0,
-	0.721475,0.273614,0,
-	0.720145,0.271375,0,
-	0.720145,0.271375,0,
-	0.72081,0.267316,0,
-	0.72081,0.267316,0,
-	0.721475,0.265917,0,
-	0.721475,0.265917,0,
-	0.724694,0.265917,0,
-	0.724694,0.265917,0,
-	0.726653,0.267876,0,
-	0.726653,0.267876,0,
-	0.726653,0.269346,0,
-	0.726653,0.269346,0,
-	0.724694,0.274174,0,
-	0.724694,0.274174,0,
-	0.72081,0.278093,0,
-	0.72081,0.278093,0,
-	0.72081,0.281592,0,
-	0.72081,0.281592,0,
-	0.722752,0.284951,0,
-	0.722752,0.284951,0,
-	0.721781,0.28859,0,
-	0.721781,0.28859,0,
-	0.721475,0.290969,0,
-	0.721475,0.290969,0,
-	0.722267,0.292788,0,
-	0.722267,0.292788,0,
-	0.725673,0.292788,0,
-	0.725673,0.292788,0,
-	0.725673,0.293488,0,
-	0.725673,0.293488,0,
-	0.728192,0.294608,0,
-	0.728192,0.294608,0,
-	0.734071,0.299926,0,
-	0.734071,0.299926,0,
-	0.73575,0.303215,0,
-	0.73575,0.303215,0,
-	0.741208,0.3057,0,
-	0.741208,0.3057,0,
-	0.741208,0.307851,0,
-	0.741208,0.307851,0,
-	0.743588,0.309093,0,
-	0.743588,0.309093,0,
-	0.746527,0.308638,0,
-	0.746527,0.308638,0,
-	0.745967,0.312942,0,
-	0.745967,0.312942,0,
-	0.745058,0.316161,0,
-	0.745058,0.316161,0,
-	0.744288,0.317841,0,
-	0.744288,0.317841,0,
-	0.745512,0.31903,0,
-	0.745512,0.31903,0,
-	0.744288,0.320185,0,
-	0.744288,0.320185,0,
-	0.744288,0.321829,0,
-	0.744288,0.321829,0,
-	0.740369,0.322494,0,
-	0.740369,0.322494,0,
-	0.734071,0.323754,0,
-	0.734071,0.323754,0,
-	0.734071,0.324349,0,
-	0.734071,0.324349,0,
-	0.730432,0.325188,0,
-	0.730432,0.325188,0,
-	0.721871,0.328547,0,
-	0.721871,0.328547,0,
-	0.721871,0.330576,0,
-	0.721871,0.330576,0,
-	0.722314,0.331556,0,
-	0.722314,0.331556,0,
-	0.724694,0.332011,0,
-	0.724694,0.332011,0,
-	0.718816,0.335545,0,
-	0.718816,0.335545,0,
-	0.717031,0.338834,0,
-	0.717031,0.338834,0,
-	0.719866,0.338834,0,
-	0.719866,0.338834,0,
-	0.720145,0.340163,0,
-	0.720145,0.340163,0,
-	0.718816,0.341458,0,
-	0.718816,0.341458,0,
-	0.718816,0.343907,0,
-	0.718816,0.343907,0,
-	0.719866,0.343365,0,
-	0.719866,0.343365,0,
-	0.720477,0.3448,0,
-	0.720477,0.3448,0,
-	0.721871,0.344992,0,
-	0.721871,0.344992,0,
-	0.722093,0.347092,0,
-	0.722093,0.347092,0,
-	0.71948,0.349016,0,
-	0.71948,0.349016,0,
-	0.717416,0.348334,0,
-	0.717416,0.348334,0,
-	0.715072,0.346952,0,
-	0.724694,0.332011,0,
-	0.726933,0.33334,0,
-	0.726933,0.33334,0,
-	0.730432,0.331066,0,
-	0.730432,0.331066,0,
-	0.732252,0.329562,0,
-	0.732252,0.329562,0,
-	0.73722,0.327533,0,
-	0.73722,0.327533,0,
-	0.742329,0.326028,0,
-	0.742329,0.326028,0,
-	0.743588,0.326518,0,
-	0.743588,0.326518,0,
-	0.744288,0.321829,0,
-	0.743588,0.326518,0,
-	0.748067,0.326518,0,
-	0.748067,0.326518,0,
-	0.749746,0.327533,0,
-	0.749746,0.327533,0,
-	0.753945,0.32678,0,
-	0.753945,0.32678,0,
-	0.756044,0.326028,0,
-	0.756044,0.326028,0,
-	0.760243,0.328547,0,
-	0.760243,0.328547,0,
-	0.761782,0.330279,0,
-	0.761782,0.330279,0,
-	0.764441,0.329562,0,
-	0.764441,0.329562,0,
-	0.765841,0.330576,0,
-	0.765841,0.330576,0,
-	0.76724,0.328547,0,
-	0.76724,0.328547,0,
-	0.766541,0.327533,0,
-	0.766541,0.327533,0,
-	0.771159,0.327533,0,
-	0.771159,0.327533,0,
-	0.76885,0.326028,0,
-	0.76885,0.326028,0,
-	0.76885,0.324349,0,
-	0.76885,0.324349,0,
-	0.765141,0.324349,0,
-	0.765141,0.324349,0,
-	0.763112,0.322161,0,
-	0.763112,0.322161,0,
-	0.763112,0.320185,0,
-	0.763112,0.320185,0,
-	0.761782,0.318435,0,
-	0.761782,0.318435,0,
-	0.761782,0.316161,0,
-	0.761782,0.316161,0,
-	0.761013,0.315216,0,
-	0.761013,0.315216,0,
-	0.758983,0.315601,0,
-	0.758983,0.315601,0,
-	0.758983,0.312942,0,
-	0.758983,0.312942,0,
-	0.758143,0.310003,0,
-	0.758143,0.310003,0,
-	0.756044,0.310003,0,
-	0.756044,0.310003,0,
-	0.756044,0.314272,0,
-	0.756044,0.314272,0,
-	0.754994,0.314272,0,
-	0.754994,0.314272,0,
-	0.753945,0.312382,0,
-	0.753945,0.312382,0,
-	0.751845,0.314272,0,
-	0.751845,0.314272,0,
-	0.752895,0.316616,0,
-	0.752895,0.316616,0,
-	0.758143,0.317001,0,
-	0.758143,0.317001,0,
-	0.756044,0.31931,0,
-	0.756044,0.31931,0,
-	0.748906,0.31931,0,
-	0.748906,0.31931,0,
-	0.748906,0.321304,0,
-	0.748906,0.321304,0,
-	0.744288,0.321829,0,
-	0.756044,0.310003,0,
-	0.756044,0.306776,0,
-	0.756044,0.306776,0,
-	0.755519,0.3057,0,
-	0.755519,0.3057,0,
-	0.749886,0.299926,0,
-	0.749886,0.299926,0,
-	0.749886,0.290969,0,
-	0.749886,0.265917,0,
-	0.757094,0.265917,0,
-	0.762447,0.265917,0,
-	0.762447,0.290969,0,
-	0.762447,0.290969,0,
-	0.749886,0.290969,0,
-	0.76948,0.247582,0,
-	0.757094,0.265917,0,
-	0.811467,0.462975,0,
-	0.811467,0.498384,0,
-	0.811467,0.462975,0,
-	0.816225,0.460456,0,
-	0.816225,0.460456,0,
-	0.816225,0.456957,0,
-	0.816225,0.456957,0,
-	0.808668,0.455243,0,
-	0.808668,0.455243,0,
-	0.808668,0.453528,0,
-	0.808668,0.453528,0,
-	0.806428,0.452618,0,
-	0.806428,0.452618,0,
-	0.806428,0.450449,0,
-	0.806428,0.450449,0,
-	0.809787,0.44905,0,
-	0.809787,0.44905,0,
-	0.810347,0.44716,0,
-	0.810347,0.44716,0,
-	0.812447,0.44632,0,
-	0.812447,0.44632,0,
-	0.808668,0.44514,0,
-	0.808668,0.44514,0,
-	0.804889,0.444895,0,
-	0.804889,0.444895,0,
-	0.802929,0.443241,0,
-	0.802929,0.443241,0,
-	0.802929,0.442542,0,
-	0.802929,0.442542,0,
-	0.798031,0.441815,0,
-	0.798031,0.441815,0,
-	0.793692,0.441325,0,
-	0.793692,0.441325,0,
-	0.793692,0.440363,0,
-	0.793692,0.440363,0,
-	0.795862,0.440232,0,
-	0.795862,0.440232,0,
-	0.795862,0.435937,0,
-	0.795862,0.435937,0,
-	0.792852,0.435054,0,
-	0.792852,0.435054,0,
-	0.795862,0.4304,0,
-	0.795862,0.4304,0,
-	0.792852,0.427899,0,
-	0.792852,0.427899,0,
-	0.80048,0.426971,0,
-	0.80048,0.426971,0,
-	0.795862,0.425817,0,
-	0.795862,0.425817,0,
-	0.794357,0.423927,0,
-	0.794357,0.423927,0,
-	0.795109,0.422178,0,
-	0.795109,0.422178,0,
-	0.793692,0.419728,0,
-	0.793692,0.419728,0,
-	0.789634,0.418609,0,
-	0.789634,0.418609,0,
-	0.789634,0.416545,0,
-	0.789634,0.416545,0,
-	0.792852,0.41581,0,
-	0.792852,0.41581,0,
-	0.792852,0.41511,0,
-	0.792852,0.41511,0,
-	0.790333,0.41434,0,
-	0.790333,0.41434,0,
-	0.791663,0.413098,0,
-	0.791663,0.413098,0,
-	0.789634,0.410981,0,
-	0.789634,0.410981,0,
-	0.784735,0.41399,0,
-	0.784735,0.41399,0,
-	0.783056,0.413098,0,
-	0.783056,0.413098,0,
-	0.783056,0.411856,0,
-	0.783056,0.411856,0,
-	0.780256,0.410386,0,
-	0.780256,0.410386,0,
-	0.779137,0.408042,0,
-	0.779137,0.408042,0,
-	0.776618,0.410386,0,
-	0.776618,0.410386,0,
-	0.774658,0.409512,0,
-	0.774658,0.409512,0,
-	0.771159,0.409512,0,
-	0.771159,0.409512,0,
-	0.770005,0.40725,0,
-	0.770005,0.40725,0,
-	0.770582,0.405672,0,
-	0.770582,0.405672,0,
-	0.767941,0.404452,0,
-	0.767941,0.404452,0,
-	0.767941,0.400135,0,
-	0.767941,0.400135,0,
-	0.765141,0.399601,0,
-	0.765141,0.399601,0,
-	0.767941,0.398035,0,
-	0.767941,0.398035,0,
-	0.770005,0.398035,0,
-	0.770005,0.398035,0,
-	0.772908,0.396181,0,
-	0.772908,0.396181,0,
-	0.775638,0.396181,0,
-	0.775638,0.396181,0,
-	0.772908,0.393861,0,
-	0.772908,0.393861,0,
-	0.773679,0.393185,0,
-	0.773679,0.393185,0,
-	0.771159,0.390999,0,
-	0.771159,0.390999,0,
-	0.771159,0.389862,0,
-	0.771159,0.389862,0,
-	0.771457,0.389102,0,
-	0.771457,0.389102,0,
-	0.772419,0.387648,0,
-	0.772419,0.387648,0,
-	0.769261,0.386664,0,
-	0.769261,0.386664,0,
-	0.761782,0.387714,0,
-	0.761782,0.387714,0,
-	0.761013,0.389167,0,
-	0.761013,0.389167,0,
-	0.754994,0.390095,0,
-	0.754994,0.390095,0,
-	0.748067,0.387255,0,
-	0.748067,0.387255,0,
-	0.747367,0.386664,0,
-	0.747367,0.386664,0,
-	0.744848,0.386664,0,
-	0.744848,0.386664,0,
-	0.743938,0.38502,0,
-	0.743938,0.38502,0,
-	0.741489,0.38502,0,
-	0.80048,0.426971,0,
-	0.80048,0.425327,0,
-	0.80048,0.425327,0,
-	0.803069,0.424837,0,
-	0.803069,0.424837,0,
-	0.803069,0.422178,0,
-	0.803069,0.422178,0,
-	0.804469,0.422143,0,
-	0.804469,0.422143,0,
-	0.804469,0.420953,0,
-	0.804469,0.420953,0,
-	0.803769,0.420498,0,
-	0.803769,0.420498,0,
-	0.806428,0.418408,0,
-	0.806428,0.418408,0,
-	0.803069,0.413544,0,
-	0.803069,0.413544,0,
-	0.805099,0.412477,0,
-	0.805099,0.412477,0,
-	0.811047,0.41434,0,
-	0.811047,0.41434,0,
-	0.812027,0.413011,0,
-	0.812027,0.413011,0,
-	0.814685,0.413409,0,
-	0.814685,0.413409,0,
-	0.815665,0.41511,0,
-	0.815665,0.41511,0,
-	0.821124,0.417087,0,
-	0.821124,0.417087,0,
-	0.824623,0.415976,0,
-	0.824623,0.415976,0,
-	0.824623,0.414725,0,
-	0.824623,0.414725,0,
-	0.829101,0.414259,0,
-	0.829101,0.414259,0,
-	0.830081,0.409949,0,
-	0.830081,0.409949,0,
-	0.826862,0.410981,0,
-	0.826862,0.410981,0,
-	0.825322,0.410465,0,
-	0.825322,0.410465,0,
-	0.824063,0.408381,0,
-	0.824063,0.408381,0,
-	0.826092,0.40725,0,
-	0.826092,0.40725,0,
-	0.825322,0.406461,0,
-	0.825322,0.406461,0,
-	0.819724,0.406856,0,
-	0.819724,0.406856,0,
-	0.821124,0.402293,0,
-	0.821124,0.402293,0,
-	0.822873,0.401534,0,
-	0.822873,0.401534,0,
-	0.824063,0.399868,0,
-	0.824063,0.399868,0,
-	0.819724,0.399601,0,
-	0.819724,0.399601,0,
-	0.815176,0.398035,0,
-	0.815176,0.398035,0,
-	0.815665,0.396181,0,
-	0.815665,0.396181,0,
-	0.815665,0.395021,0,
-	0.815665,0.395021,0,
-	0.810347,0.393861,0,
-	0.810347,0.393861,0,
-	0.806428,0.392092,0,
-	0.806428,0.392092,0,
-	0.80048,0.392092,0,
-	0.80048,0.392092,0,
-	0.799431,0.389481,0,
-	0.799431,0.389481,0,
-	0.80048,0.388675,0,
-	0.80048,0.388675,0,
-	0.797331,0.387648,0,
-	0.797331,0.387648,0,
-	0.801774,0.38502,0,
-	0.801774,0.38502,0,
-	0.808072,0.385842,0,
-	0.808072,0.385842,0,
-	0.813006,0.386334,0,
-	0.813006,0.386334,0,
-	0.815665,0.388239,0,
-	0.815665,0.388239,0,
-	0.818395,0.388375,0,
-	0.818395,0.388375,0,
-	0.821894,0.386795,0,
-	0.821894,0.386795,0,
-	0.824063,0.387286,0,
-	0.824063,0.387286,0,
-	0.825707,0.386795,0,
-	0.825707,0.386795,0,
-	0.830081,0.387714,0,
-	0.830081,0.387714,0,
-	0.830081,0.389167,0,
-	0.830081,0.389167,0,
-	0.83386,0.392976,0,
-	0.83386,0.392976,0,
-	0.83386,0.395021,0,
-	0.83386,0.395021,0,
-	0.8326,0.395601,0,
-	0.8326,0.395601,0,
-	0.836659,0.397108,0,
-	0.836659,0.397108,0,
-	0.843377,0.398035,0,
-	0.843377,0.398035,0,
-	0.850095,0.395311,0,
-	0.850095,0.395311,0,
-	0.853873,0.386664,0,
-	0.853873,0.386664,0,
-	0.857932,0.385842,0,
-	0.857932,0.385842,0,
-	0.861851,0.38409,0,
-	0.861851,0.38409,0,
-	0.862691,0.381593,0,
-	0.862691,0.381593,0,
-	0.86703,0.381593,0,
-	0.86703,0.381593,0,
-	0.868009,0.381593,0,
-	0.868009,0.381593,0,
-	0.871508,0.383161,0,
-	0.871508,0.383161,0,
-	0.872908,0.383161,0,
-	0.872908,0.383161,0,
-	0.872908,0.380681,0,
-	0.872908,0.380681,0,
-	0.872207,0.380681,0,
-	0.872207,0.380681,0,
-	0.869759,0.374927,0,
-	0.869759,0.374927,0,
-	0.869129,0.373928,0,
-	0.869129,0.373928,0,
-	0.86486,0.374427,0,
-	0.86486,0.374427,0,
-	0.862691,0.373141,0,
-	0.862691,0.373141,0,
-	0.863776,0.368924,0,
-	0.863776,0.368924,0,
-	0.862271,0.366615,0,
-	0.862271,0.366615,0,
-	0.859892,0.36777,0,
-	0.859892,0.36777,0,
-	0.857932,0.365565,0,
-	0.857932,0.365565,0,
-	0.854573,0.364481,0,
-	0.854573,0.364481,0,
-	0.854573,0.363396,0,
-	0.854573,0.363396,0,
-	0.852893,0.363396,0,
-	0.852893,0.363396,0,
-	0.851214,0.364481,0,
-	0.851214,0.364481,0,
-	0.850095,0.362767,0,
-	0.850095,0.362767,0,
-	0.845056,0.360527,0,
-	0.845056,0.360527,0,
-	0.843937,0.358988,0,
-	0.843937,0.358988,0,
-	0.843937,0.340163,0,
-	0.843937,0.340163,0,
-	0.853733,0.340163,0,
-	0.852893,0.498384,0,
-	0.852893,0.474032,0,
-	0.852893,0.474032,0,
-	0.811536,0.464655,0,
-	0.894741,0.498384,0,
-	0.894741,0.464655,0,
-	0.894741,0.464655,0,
-	0.884244,0.464655,0,
-	0.884244,0.464655,0,
-	0.86577,0.457657,0,
-	0.86577,0.457657,0,
-	0.86577,0.44573,0,
-	0.86577,0.44573,0,
-	0.868709,0.411856,0,
-	0.868709,0.411856,0,
-	0.86486,0.409949,0,
-	0.86486,0.409949,0,
-	0.86577,0.409214,0,
-	0.86577,0.409214,0,
-	0.863776,0.408042,0,
-	0.863776,0.408042,0,
-	0.865315,0.406461,0,
-	0.865315,0.406461,0,
-	0.863233,0.405062,0,
-	0.863233,0.405062,0,
-	0.862691,0.403214,0,
-	0.862691,0.403214,0,
-	0.867519,0.403214,0,
-	0.867519,0.403214,0,
-	0.868009,0.402293,0,
-	0.868009,0.402293,0,
-	0.861081,0.399601,0,
-	0.861081,0.399601,0,
-	0.861081,0.398818,0,
-	0.861081,0.398818,0,
-	0.864545,0.398035,0,
-	0.864545,0.398035,0,
-	0.864545,0.397108,0,
-	0.864545,0.397108,0,
-	0.869129,0.397108,0,
-	0.869129,0.397108,0,
-	0.873888,0.397572,0,
-	0.873888,0.397572,0,
-	0.873888,0.393861,0,
-	0.873888,0.393861,0,
-	0.869129,0.395021,0,
-	0.869129,0.395021,0,
-	0.869129,0.393523,0,
-	0.869129,0.393523,0,
-	0.86577,0.392976,0,
-	0.86577,0.392976,0,
-	0.861851,0.39043,0,
-	0.861851,0.39043,0,
-	0.862271,0.389078,0,
-	0.862271,0.389078,0,
-	0.864274,0.388239,0,
-	0.864274,0.388239,0,
-	0.864545,0.385431,0,
-	0.864545,0.385431,0,
-	0.861851,0.38409,0,
-	0.853733,0.340163,0,
-	0.853733,0.325188,0,
-	0.853733,0.325188,0,
-	0.840298,0.325188,0,
-	0.840298,0.325188,0,
-	0.840298,0.314272,0,
-	0.840298,0.314272,0,
-	0.853733,0.314272,0,
-	0.853733,0.314272,0,
-	0.853733,0.257939,0,
-	0.771159,0.327533,0,
-	0.772699,0.324768,0,
-	0.772699,0.324768,0,
-	0.773819,0.324349,0,
-	0.773819,0.324349,0,
-	0.773819,0.321007,0,
-	0.773819,0.321007,0,
-	0.770005,0.317298,0,
-	0.770005,0.317298,0,
-	0.771159,0.315881,0,
-	0.771159,0.315881,0,
-	0.773819,0.315881,0,
-	0.773819,0.315881,0,
-	0.774518,0.313327,0,
-	0.774518,0.313327,0,
-	0.776057,0.312942,0,
-	0.776057,0.312942,0,
-	0.774518,0.31079,0,
-	0.774518,0.31079,0,
-	0.776057,0.310003,0,
-	0.776057,0.310003,0,
-	0.777457,0.308638,0,
-	0.777457,0.308638,0,
-	0.780117,0.308638,0,
-	0.780117,0.308638,0,
-	0.778787,0.306776,0,
-	0.778787,0.306776,0,
-	0.774168,0.304125,0,
-	0.774168,0.304125,0,
-	0.771159,0.303215,0,
-	0.771159,0.303215,0,
-	0.770582,0.299926,0,
-	0.770582,0.299926,0,
-	0.774168,0.293488,0,
-	0.774168,0.293488,0,
-	0.771929,0.289989,0,
-	0.771929,0.289989,0,
-	0.774168,0.28789,0,
-	0.774168,0.28789,0,
-	0.776057,0.280752,0,
-	0.776057,0.280752,0,
-	0.773819,0.279213,0,
-	0.773819,0.279213,0,
-	0.773819,0.277113,0,
-	0.773819,0.277113,0,
-	0.771911,0.275854,0,
-	0.771911,0.275854,0,
-	0.770871,0.278443,0,
-	0.770871,0.278443,0,
-	0.771391,0.279982,0,
-	0.771391,0.279982,0,
-	0.771391,0.281592,0,
-	0.771391,0.281592,0,
-	0.76948,0.281592,0,
-	0.76948,0.281592,0,
-	0.771159,0.284951,0,
-	0.771159,0.284951,0,
-	0.771911,0.286105,0,
-	0.771911,0.286105,0,
-	0.77032,0.28859,0,
-	0.77032,0.28859,0,
-	0.77032,0.294608,0,
-	0.77032,0.294608,0,
-	0.76948,0.295588,0,
-	0.76948,0.295588,0,
-	0.764441,0.291878,0,
-	0.764441,0.291878,0,
-	0.759998,0.293138,0,
-	0.759998,0.293138,0,
-	0.761782,0.296707,0,
-	0.761782,0.296707,0,
-	0.76089,0.301571,0,
-	0.76089,0.301571,0,
-	0.759123,0.303215,0,
-	0.759123,0.303215,0,
-	0.756044,0.306776,0,
-	0.780117,0.308638,0,
-	0.782076,0.308472,0,
-	0.782076,0.308472,0,
-	0.782076,0.310003,0,
-	0.782076,0.310003,0,
-	0.781096,0.31079,0,
-	0.781096,0.31079,0,
-	0.784455,0.312942,0,
-	0.784455,0.312942,0,
-	0.786134,0.311866,0,
-	0.786134,0.311866,0,
-	0.790613,0.312137,0,
-	0.790613,0.312137,0,
-	0.791733,0.313327,0,
-	0.791733,0.313327,0,
-	0.794952,0.312404,0,
-	0.794952,0.312404,0,
-	0.795932,0.310003,0,
-	0.795932,0.310003,0,
-	0.797471,0.308472,0,
-	0.797471,0.308472,0,
-	0.79915,0.308472,0,
-	0.79915,0.308472,0,
-	0.79915,0.299139,0,
-	0.79915,0.299139,0,
-	0.805309,0.289779,0,
-	0.805309,0.289779,0,
-	0.812027,0.289779,0,
-	0.812027,0.289779,0,
-	0.812027,0.265917,0,
-	0.812027,0.265917,0,
-	0.782775,0.265917,0,
-	0.782775,0.265917,0,
-	0.782775,0.265217,0,
-	0.782775,0.265217,0,
-	0.780117,0.265217,0,
-	0.780117,0.265217,0,
-	0.779452,0.266617,0,
-	0.779452,0.266617,0,
-	0.776758,0.267316,0,
-	0.776758,0.267316,0,
-	0.776057,0.265917,0,
-	0.776057,0.265917,0,
-	0.778787,0.262138,0,
-	0.778787,0.262138,0,
-	0.779452,0.258639,0,
-	0.779452,0.258639,0,
-	0.782076,0.25542,0,
-	0.782076,0.25542,0,
-	0.786835,0.252901,0,
-	0.786835,0.252901,0,
-	0.788374,0.251361,0,
-	0.789073,0.252131,0,
-	0.791173,0.25416,0,
-	0.791173,0.25416,0,
-	0.791173,0.262978,0,
-	0.791173,0.262978,0,
-	0.802929,0.262978,0,
-	0.802929,0.262978,0,
-	0.802929,0.25416,0,
-	0.802929,0.25416,0,
-	0.80153,0.252131,0,
-	0.80153,0.252131,0,
-	0.80041,0.250101,0,
-	0.80041,0.250101,0,
-	0.802929,0.245903,0,
-	0.802929,0.245903,0,
-	0.804609,0.245903,0,
-	0.804609,0.245903,0,
-	0.804609,0.240725,0,
-	0.804609,0.240725,0,
-	0.809367,0.240725,0,
-	0.809367,0.240725,0,
-	0.809367,0.239185,0,
-	0.809367,0.239185,0,
-	0.810907,0.239185,0,
-	0.810907,0.239185,0,
-	0.810907,0.234707,0,
-	0.812027,0.234707,0,
-	0.822523,0.234707,0,
-	0.822523,0.234707,0,
-	0.822523,0.228409,0,
-	0.822523,0.228409,0,
-	0.820984,0.228409,0,
-	0.853733,0.257939,0,
-	0.844076,0.245903,0,
-	0.844076,0.245903,0,
-	0.844076,0.240725,0,
-	0.844076,0.240725,0,
-	0.847575,0.240725,0,
-	0.847575,0.240725,0,
-	0.847575,0.228409,0,
-	0.847575,0.228409,0,
-	0.852894,0.228409,0,
-	0.852894,0.228409,0,
-	0.852894,0.210214,0,
-	0.852894,0.210214,0,
-	0.855273,0.207695,0,
-	0.855273,0.207695,0,
-	0.857512,0.207695,0,
-	0.857512,0.207695,0,
-	0.857512,0.161089,0,
-	0.857512,0.161089,0,
-	0.852894,0.15983,0,
-	0.936308,0.464655,0,
-	0.936308,0.498384,0,
-	0.937287,0.464655,0,
-	0.939386,0.461156,0,
-	0.939386,0.461156,0,
-	0.939386,0.458706,0,
-	0.939386,0.458706,0,
-	0.916713,0.454385,0,
-	0.916713,0.454385,0,
-	0.903698,0.456546,0,
-	0.903698,0.456546,0,
-	0.894741,0.4561,0,
-	0.894741,0.4561,0,
-	0.894741,0.454385,0,
-	0.894741,0.454385,0,
-	0.899219,0.452618,0,
-	0.899219,0.452618,0,
-	0.891662,0.420953,0,
-	0.891662,0.420953,0,
-	0.893901,0.420498,0,
-	0.893901,0.420498,0,
-	0.89698,0.420953,0,
-	0.89698,0.420953,0,
-	0.899219,0.420498,0,
-	0.899219,0.420498,0,
-	0.900899,0.420953,0,
-	0.900899,0.420953,0,
-	0.904398,0.420953,0,
-	0.904398,0.420953,0,
-	0.906357,0.420498,0,
-	0.906357,0.420498,0,
-	0.906357,0.418408,0,
-	0.906357,0.418408,0,
-	0.902648,0.417087,0,
-	0.902648,0.417087,0,
-	0.902648,0.416098,0,
-	0.902648,0.416098,0,
-	0.906357,0.415976,0,
-	0.906357,0.415976,0,
-	0.907197,0.41511,0,
-	0.907197,0.41511,0,
-	0.907197,0.413676,0,
-	0.907197,0.413676,0,
-	0.893901,0.412477,0,
-	0.893901,0.412477,0,
-	0.890822,0.376902,0,
-	0.890822,0.376902,0,
-	0.881725,0.376902,0,
-	0.881725,0.376902,0,
-	0.873888,0.369624,0,
-	0.873888,0.369624,0,
-	0.868709,0.367192,0,
-	0.868709,0.367192,0,
-	0.86577,0.368408,0,
-	0.86577,0.368408,0,
-	0.86381,0.367192,0,
-	0.86381,0.367192,0,
-	0.862271,0.366615,0,
-	0.890822,0.376902,0,
-	0.903418,0.372563,0,
-	0.903418,0.372563,0,
-	0.904503,0.368924,0,
-	0.904503,0.368924,0,
-	0.901738,0.3678,0,
-	0.901738,0.3678,0,
-	0.899219,0.36777,0,
-	0.899219,0.36777,0,
-	0.89712,0.365023,0,
-	0.89712,0.365023,0,
-	0.89488,0.365565,0,
-	0.89488,0.365565,0,
-	0.89488,0.328477,0,
-	0.89488,0.328477,0,
-	0.875566,0.328477,0,
-	0.875566,0.328477,0,
-	0.875566,0.302305,0,
-	0.875566,0.302305,0,
-	0.89488,0.302305,0,
-	0.977735,0.44674,0,
-	0.977735,0.498384,0,
-	0.977735,0.44674,0,
-	0.943165,0.44674,0,
-	0.943165,0.44674,0,
-	0.943165,0.444501,0,
-	0.943165,0.444501,0,
-	0.945265,0.443101,0,
-	0.945265,0.443101,0,
-	0.949184,0.443101,0,
-	0.949184,0.443101,0,
-	0.951143,0.441002,0,
-	0.951143,0.441002,0,
-	0.950164,0.438763,0,
-	0.950164,0.438763,0,
-	0.947224,0.438763,0,
-	0.947224,0.438763,0,
-	0.938126,0.438063,0,
-	0.938126,0.438063,0,
-	0.937287,0.436786,0,
-	0.937287,0.436786,0,
-	0.938126,0.435264,0,
-	0.938126,0.435264,0,
-	0.940226,0.434424,0,
-	0.940226,0.434424,0,
-	0.939386,0.432745,0,
-	0.939386,0.432745,0,
-	0.940226,0.432745,0,
-	0.940226,0.432745,0,
-	0.940926,0.430925,0,
-	0.940926,0.430925,0,
-	0.944215,0.430226,0,
-	0.944215,0.430226,0,
-	0.949184,0.428793,0,
-	0.949184,0.428793,0,
-	0.953241,0.428126,0,
-	0.953241,0.428126,0,
-	0.953241,0.426587,0,
-	0.953241,0.426587,0,
-	0.951212,0.425747,0,
-	0.951212,0.425747,0,
-	0.950164,0.423367,0,
-	0.950164,0.423367,0,
-	0.950688,0.422108,0,
-	0.950688,0.422108,0,
-	0.950426,0.420498,0,
-	0.950426,0.420498,0,
-	0.945265,0.417087,0,
-	0.945265,0.417087,0,
-	0.942571,0.418408,0,
-	0.942571,0.418408,0,
-	0.944215,0.420498,0,
-	0.944215,0.420498,0,
-	0.936308,0.420498,0,
-	0.936308,0.420498,0,
-	0.936308,0.409214,0,
-	0.936308,0.409214,0,
-	0.932949,0.406461,0,
-	0.932949,0.406461,0,
-	0.931549,0.405062,0,
-	0.931549,0.405062,0,
-	0.931549,0.400947,0,
-	0.931549,0.400947,0,
-	0.933648,0.393998,0,
-	0.933648,0.393998,0,
-	0.934628,0.389754,0,
-	0.934628,0.389754,0,
-	0.92805,0.385842,0,
-	0.92805,0.385842,0,
-	0.92805,0.38409,0,
-	0.92805,0.38409,0,
-	0.921472,0.377804,0,
-	0.921472,0.377804,0,
-	0.915314,0.374927,0,
-	0.915314,0.374927,0,
-	0.908036,0.373141,0,
-	0.908036,0.373141,0,
-	0.907197,0.369624,0,
-	0.907197,0.369624,0,
-	0.904503,0.368924,0,
-	0.934628,0.389754,0,
-	0.936308,0.391072,0,
-	0.936308,0.391072,0,
-	0.936308,0.389754,0,
-	0.936308,0.282292,0,
-	0.89488,0.282292,0,
-	0.89488,0.302305,0,
-	0.89488,0.282292,0,
-	0.936308,0.389754,0,
-	0.978155,0.389754,0,
-	0.978155,0.389754,0,
-	0.978155,0.306784,0,
-	0.978155,0.306784,0,
-	0.944845,0.306784,0,
-	0.882284,0.282292,0,
-	0.879345,0.279772,0,
-	0.879345,0.279772,0,
-	0.879345,0.252131,0,
-	0.879345,0.252131,0,
-	0.890822,0.248702,0,
-	0.890822,0.248702,0,
-	0.890822,0.22421,0,
-	0.894321,0.143035,0,
-	0.890822,0.143035,0,
-	0.890822,0.143035,0,
-	0.890822,0.177324,0,
-	0.890822,0.177324,0,
-	0.882285,0.177324,0,
-	0.882285,0.177324,0,
-	0.882285,0.202797,0,
-	0.882285,0.202797,0,
-	0.879346,0.206015,0,
-	0.879346,0.206015,0,
-	0.877526,0.206015,0,
-	0.877526,0.206015,0,
-	0.876126,0.207695,0,
-	0.876126,0.207695,0,
-	0.879346,0.208954,0,
-	0.879346,0.208954,0,
-	0.879346,0.210214,0,
-	0.879346,0.210214,0,
-	0.878437,0.212873,0,
-	0.878437,0.212873,0,
-	0.879346,0.214553,0,
-	0.879346,0.214553,0,
-	0.878891,0.218052,0,
-	0.878891,0.218052,0,
-	0.876826,0.216302,0,
-	0.876826,0.216302,0,
-	0.872768,0.216302,0,
-	0.872768,0.216302,0,
-	0.86759,0.218052,0,
-	0.86759,0.218052,0,
-	0.861712,0.218052,0,
-	0.861712,0.218052,0,
-	0.860452,0.217177,0,
-	0.860452,0.217177,0,
-	0.861712,0.216302,0,
-	0.861712,0.216302,0,
-	0.861712,0.213713,0,
-	0.861712,0.213713,0,
-	0.860452,0.210914,0,
-	0.860452,0.210914,0,
-	0.857512,0.207695,0,
-	0.882285,0.202797,0,
-	0.884524,0.202797,0,
-	0.884524,0.202797,0,
-	0.886553,0.203636,0,
-	0.886553,0.203636,0,
-	0.887463,0.203216,0,
-	0.887463,0.203216,0,
-	0.887008,0.200837,0,
-	0.887008,0.200837,0,
-	0.889003,0.199857,0,
-	0.889003,0.199857,0,
-	0.891662,0.203426,0,
-	0.891662,0.203426,0,
-	0.892571,0.212873,0,
-	0.892571,0.212873,0,
-	0.893761,0.219312,0,
-	0.893761,0.219312,0,
-	0.890822,0.22421,0,
-	0.935748,0.22421,0,
-	0.92903,0.229248,0,
-	0.92903,0.229248,0,
-	0.935748,0.232747,0,
-	0.935748,0.232747,0,
-	0.935748,0.248702,0,
-	0.935748,0.248702,0,
-	0.890822,0.248702,0,
-	0.944845,0.306784,0,
-	0.944845,0.242404,0,
-	0.944845,0.242404,0,
-	0.977735,0.242404,0,
-	1,0.4129,0,
-	0.971437,0.395796,0,
-	0.971437,0.395796,0,
-	1,0.380947,0,
-	1,0.401674,0,
-	0.981032,0.401674,0,
-	1,0.387798,0,
-	0.98711,0.387798,0,
-	1,0.380947,0,
-	1,0.242404,0,
-	0,0,0,
-	0,0.106927,0,
-	0,0.106927,0,
-	0.020139,0.124281,0,
-	0.020139,0.124281,0,
-	0.020139,0,0,
-	0.020139,0.124281,0,
-	0.020139,0.183902,0,
-	0.020139,0.183902,0,
-	0,0.183902,0,
-	0,0.183902,0,
-	0,0.188661,0,
-	0,0.188661,0,
-	0.008103,0.1909,0,
-	0.008103,0.1909,0,
-	0.008103,0.207695,0,
-	0.008103,0.207695,0,
-	0.020139,0.207695,0,
-	0.023498,0.207695,0,
-	0.023498,0.213853,0,
-	0.023498,0.213853,0,
-	0.019999,0.217352,0,
-	0.019999,0.217352,0,
-	0.029936,0.217352,0,
-	0.012302,0.1296,0,
-	0,0.1296,0,
-	0,0.119802,0,
-	0.012302,0.119802,0,
-	0.012302,0.119802,0,
-	0.012302,0.1296,0,
-	0,0.456546,0,
-	0,0.498384,0,
-	0,0.456546,0,
-	0.029936,0.437424,0,
-	0.029936,0.430575,0,
-	0,0.412337,0,
-	0.029936,0.401674,0,
-	0,0.401674,0,
-	0.029936,0.401674,0,
-	0.029936,0.387798,0,
-	0.029936,0.387798,0,
-	0,0.387798,0,
-	0,0.38194,0,
-	0,0.242404,0,
-	0.029936,0.322739,0,
-	0.020139,0.322739,0,
-	0.020139,0.322739,0,
-	0.020139,0.311402,0,
-	0.020139,0.311402,0,
-	0.013981,0.311402,0,
-	0.013981,0.311402,0,
-	0.013981,0.289009,0,
-	0.013981,0.289009,0,
-	0.029936,0.289009,0,
-	0,0.242404,0,
-	0.029936,0.242404,0,
-	0.019859,0.498384,0,
-	0.019859,0.443801,0,
-	0.029936,0.430575,0,
-	0.029936,0.437424,0,
-	0.062002,0.387679,0,
-	0.103289,0.387679,0,
-	0.03457,0.242264,0,
-	0.059062,0.242264,0,
-	0.03408,0.217492,0,
-	0.029952,0.217492,0,
-	0.145275,0.177185,0,
-	0.134079,0.177185,0,
-	0.686346,0.270325,0,
-	0.686346,0.282711,0,
-	0.76948,0.210214,0,
-	0.76948,0.217492,0,
-	0.977735,0.171866,0,
-	0.977735,0.242404,0,
-	0.977735,0.163469,0,
-	0.977735,0.171866,0,
-	0.436664,0.422948,0,
-	0.478371,0.422948,0,
-	0.583824,0.425817,0,
-	0.583382,0.424767,0,
-	0.686625,0.475431,0,
-	0.686625,0.462975,0,
-	0.686625,0.47893,0,
-	0.686625,0.475431,0,
-	0.686625,0.453528,0,
-	0.686625,0.44716,0,
-	0.720635,0.373141,0,
-	0.720635,0.372353,0,
-	0.749886,0.290969,0,
-	0.749886,0.265917,0,
-	0.757094,0.265917,0,
-	0.762447,0.265917,0,
-	0.936308,0.389754,0,
-	0.936308,0.282292,0,
-	0.89488,0.282292,0,
-	0.883124,0.282292,0,
-	0.020139,0.183902,0,
-	0.020139,0.207695,0,
-	0.020139,0.207695,0,
-	0.023498,0.207695,0,
-	0.686346,0.282711,0,
-	0.686346,0.315601,0,
-	0.76948,0.217492,0,
-	0.76948,0.247582,0
-};
-static const struct gllist timezones_frame = {
- GL_V3F, GL_LINES, 3970, timezones_data, 0
-};
-const struct gllist *timezones = &timezones_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char timezones[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\001\000\000\000\343\007\000\000\202\017\000\000\000\000\000\000"
+ "\000\000\000\0773,\177>\000\000\000\000\000\001\2007\351\217\313\077\000"
+ "\000\000\000\351\217\2672\000\000\000\0009\214\3661\000\000\000\000\254\207"
+ ",0\000\000\000\000\251\232\3661\000\000\000\000\251\232\313\077\000\000\000"
+ "\000;\245\313\077\000\000\000\000;\245\3661\000\000\000\0003\247A4\000\000"
+ "\000\000\374\246\2464\000\000\000\000\220\250C6\000\000\000\000\333\253\015"
+ "7\000\000\000\000\357\254\0157\000\000\000\000\003\257\3047\000\000\000\000"
+ "\361\257\3047\000\000\000\000\361\257\313\077\000\000\000\000\203\272\313"
+ "\077\000\000\000\000\203\27239\000\000\000\000e\26739\000\000\000\000e\267"
+ "\0124\000\000\000\000`\274n3\000\000\000\000W\275\0343\000\000\000\000\231"
+ "\277c1\000\000\000\000Z\300c1\000\000\000\000\265\300\0101\000\000\000\000"
+ "\265\300t/\000\000\000\000e\267t/\000\000\000\000e\267\202*\000\000\000\000"
+ "\251\261\202*\000\000\000\000\251\261\305\042\000\000\000\000\355\265\305"
+ "\042\000\000\000\000B\305\353:\000\000\000\000B\305\313\077\000\000\000\000"
+ "o\303\353:\000\000\000\000o\303\375.\000\000\000\000\234\302\264.\000\000"
+ "\000\000R\302\363-\000\000\000\000\255\301)-\000\000\000\000\255\301\304"
+ ",\000\000\000\000w\3022,\000\000\000\000o\303\315+\000\000\000\000o\303@"
+ "'\000\000\000\000\255\301\245'\000\000\000\000\265\300J(\000\000\000\000"
+ "#\300\367'\000\000\000\000\324\317\313\077\000\000\000\000\324\317\353:\000"
+ "\000\000\000\273\322\353:\000\000\000\000b\325O:\000\000\000\000\241\233"
+ "v1\000\000\000\000\241\233\247*\000\000\000\000\352\233\247*\000\000\000"
+ "\0004\235\325*\000\000\000\0005\236\324)\000\000\000\000\265\236\324)\000"
+ "\000\000\000v\237U*\000\000\000\000\322\237U*\000\000\000\000\212\241\024"
+ ")\000\000\000\000x\242\012(\000\000\000\000\260\243\245'\000\000\000\000"
+ "\260\243\366&\000\000\000\000\302\242\233&\000\000\000\000\212\241\233&\000"
+ "\000\000\000%\241\032&\000\000\000\000\001\2425%\000\000\000\000;\245t#\000"
+ "\000\000\0004\235v1\000\000\000\0005\236\3540\000\000\000\000\026\237\354"
+ "0\000\000\000\000\026\237}/\000\000\000\000\256\240}/\000\000\000\000%\241"
+ "\306.\000\000\000\000\334\241\306.\000\000\000\000\334\241\016.\000\000\000"
+ "\000x\242\252-\000\000\000\000\024\243\252-\000\000\000\000L\244\026,\000"
+ "\000\000\000;\245\214+\000\000\000\000\304\245\214+\000\000\000\000\304\245"
+ "\036+\000\000\000\000s\247\036+\000\000\000\000\375\247U*\000\000\000\000"
+ "\255\252U*\000\000\000\000\255\252\301(\000\000\000\000\031\251S(\000\000"
+ "\000\000\375\247\217(\000\000\000\000\270\247q(\000\000\000\000\375\247\245"
+ "'\000\000\000\000U\251\233&\000\000\000\000\355\252Z&\000\000\000\000\345"
+ "\253l%\000\000\000\000\267\253\307$\000\000\000\000&\255\364#\000\000\000"
+ "\000&\255t#\000\000\000\000\357\254!#\000\000\000\000&\255\263\042\000\000"
+ "\000\000\213\255\263\042\000\000\000\000\213\255\327!\000\000\000\000\254"
+ "\207t#\000\000\000\000\340\217t#\000\000\000\000\340\217\313\022\000\000"
+ "\000\000\254\207\313\022\000\000\000\000\254\207;\012\000\000\000\000\333"
+ "\210;\012\000\000\000\000\333\210:\376\000\000\000\000\254\207:\376\000\000"
+ "\000\000 \217:\376\000\000\000\000 \217\316\000\000\000\000\000\214\215\316"
+ "\000\000\000\000\000\214\215\017\002\000\000\000\000\007\222\017\002\000"
+ "\000\000\000\267\225\277\371\000\000\000\000\267\225\221\370\000\000\000"
+ "\000\007\222\221\370\000\000\000\000\007\222\033\372\000\000\000\000\311"
+ "\211\033\372\000\000\000\000\311\211\343\367\000\000\000\000\272\210\343"
+ "\367\000\000\000\000\272\210\334\357\000\000\000\000\363\217\334\357\000"
+ "\000\000\000\363\2175\300\000\000\000\000r\2325\300\000\000\000\000r\232"
+ "%\357\000\000\000\0001\2455\300\000\000\000\0001\245\221\355\000\000\000"
+ "\000\314\2575\300\000\000\000\000\314\257\011\021\000\000\000\000g\2725\300"
+ "\000\000\000\000g\2721\350\000\000\000\000\004\2611\350\000\000\000\000\004"
+ "\261\134\360\000\000\000\000g\272\134\360\000\000\000\000T\242\334\357\000"
+ "\000\000\000\332\251\334\357\000\000\000\000\332\251\221\355\000\000\000"
+ "\000T\242\221\355\000\000\000\000\024\3055\300\000\000\000\000\024\305\352"
+ "\014\000\000\000\000\257\3175\300\000\000\000\000\257\317\011\330\000\000"
+ "\000\000o\3325\300\000\000\000\000o\332\215\350\000\000\000\000\034\3455"
+ "\300\000\000\000\000\034\345\023\331\000\000\000\000\317\337\023\331\000"
+ "\000\000\000\317\337\360\332\000\000\000\000\034\345\360\332\000\000\000"
+ "\000\034\345P\367\000\000\000\000\267\3575\300\000\000\000\000\267\357h\011"
+ "\000\000\000\000d\3725\300\000\000\000\000d\372v\342\000\000\000\000s\365"
+ "v\342\000\000\000\000s\365\302\346\000\000\000\000d\372\302\346\000\000\000"
+ "\000d\372\077\371\000\000\000\000_\364\077\371\000\000\000\000_\364\237\373"
+ "\000\000\000\000d\372\237\373\000\000\000\000d\372\376\002\000\000\000\000"
+ "\377\0045\300\000\000\000\000\377\0040\375\000\000\000\000\254\0175\300\000"
+ "\000\000\000\254\017\350\347\000\000\000\000Z\0325\300\000\000\000\000Z\032"
+ "q\363\000\000\000\000\007%5\300\000\000\000\000\007%f\007\000\000\000\000"
+ "\264/5\300\000\000\000\000\264/i\005\000\000\000\000\2661\012\373\000\000"
+ "\000\000\3563\012\373\000\000\000\000\3563\077\371\000\000\000\000\2661\077"
+ "\371\000\000\000\000a:5\300\000\000\000\000a:\240\013\000\000\000\000\374"
+ "D5\300\000\000\000\000\374D\006\366\000\000\000\000\374D\343\367\000\000"
+ "\000\000UB\343\367\000\000\000\000UB\006\366\000\000\000\000\227O5\300\000"
+ "\000\000\000\227O\077\371\000\000\000\000+R\077\371\000\000\000\000+R\256"
+ "\372\000\000\000\000WZ5\300\000\000\000\000WZ \351\000\000\000\000\361d5"
+ "\300\000\000\000\000\361d\323\344\000\000\000\000\214o5\300\000\000\000\000"
+ "\214o\233\371\000\000\000\000Lz5\300\000\000\000\000Lzn\331\000\000\000\000"
+ "#un\331\000\000\000\000#u\365\340\000\000\000\000Lz \351\000\000\000\000"
+ "Lz\016\352\000\000\000\000(pj\352\000\000\000\000#uj\352\000\000\000\000"
+ "#u\037\350\000\000\000\000(p\037\350\000\000\000\000Lz5\354\000\000\000\000"
+ "\355u5\354\000\000\000\000\355u\016\352\000\000\000\000\377\177c\341\000"
+ "\000\000\000*~c\341\000\000\000\000\363|\006\340\000\000\000\000\363|\341"
+ "\336\000\000\000\000\377\177\341\336\000\000\000\000\232\236%\357\000\000"
+ "\000\000\211\240\313\360\000\000\000\000\211\240t\366\000\000\000\000r\232"
+ "t\366\000\000\000\000r\232t#\000\000\000\000N\233\323\372\000\000\000\000"
+ "\221\237\323\372\000\000\000\000\221\237\343\367\000\000\000\000N\233\343"
+ "\367\000\000\000\0001\245\370\357\000\000\000\0001\245t#\000\000\000\000"
+ "\202\256\026!\000\000\000\000\202\256( \000\000\000\000\012\255( \000\000"
+ "\000\000n\254^\037\000\000\000\000\345\253^\037\000\000\000\000\345\253\024"
+ "\036\000\000\000\000\357\254\024\036\000\000\000\000\360\256\270\035\000"
+ "\000\000\000\360\256k\031\000\000\000\000\202\256k\031\000\000\000\000\271"
+ "\256!\030\000\000\000\000\202\256\305\026\000\000\000\000M\260\260\023\000"
+ "\000\000\000\274\254\260\023\000\000\000\000\274\254\011\021\000\000\000"
+ "\000\001\242v1\000\000\000\000@\24061\000\000\000\000\355\265\016\042\000"
+ "\000\000\0006\266\327!\000\000\000\000\345\267\327!\000\000\000\000\201\270"
+ "\026!\000\000\000\000\270\270\303\037\000\000\000\000\201\270\360\036\000"
+ "\000\000\000\270\270f\036\000\000\000\000\345\267o\035\000\000\000\000\345"
+ "\267\134\034\000\000\000\000@\267\134\034\000\000\000\000@\267\000\034\000"
+ "\000\000\000\345\267\000\034\000\000\000\000\345\267\266\032\000\000\000"
+ "\000@\267\266\032\000\000\000\000@\2675\032\000\000\000\000\300\2665\032"
+ "\000\000\000\000\300\266\305\026\000\000\000\000H\265\305\026\000\000\000"
+ "\000H\265\237\025\000\000\000\000>\264i\026\000\000\000\000\006\263i\026"
+ "\000\000\000\000\006\2632\026\000\000\000\000\217\2622\026\000\000\000\000"
+ "\312\262:\025\000\000\000\000\312\262\014\024\000\000\000\000X\262\014\024"
+ "\000\000\000\000\312\262\024\023\000\000\000\000t\263\024\023\000\000\000"
+ "\000\364\263\200\021\000\000\000\000\303\264\011\021\000\000\000\000\303"
+ "\264\200\020\000\000\000\000\355\265\321\017\000\000\000\000\004\266\365"
+ "\016\000\000\000\000\255\265\232\016\000\000\000\000H\265\365\016\000\000"
+ "\000\000\303\264>\016\000\000\000\000z\265t\015\000\000\000\000H\265t\015"
+ "\000\000\000\0006\266=\015\000\000\000\000e\267\230\014\000\000\000\000\346"
+ "\270\005\014\000\000\000\000\247\271\227\013\000\000\000\000g\272;\013\000"
+ "\000\000\000#\300\327!\000\000\000\000\242\277\026!\000\000\000\000\343\277"
+ "\237 \000\000\000\000\343\300\237 \000\000\000\000d\301m \000\000\000\000"
+ "\255\301\303\037\000\000\000\000\216\302( \000\000\000\000\216\302\365\037"
+ "\000\000\000\000\035\302Y\037\000\000\000\000\035\302\270\035\000\000\000"
+ "\000\216\302o\035\000\000\000\000\035\302\256\034\000\000\000\000\255\301"
+ "\256\034\000\000\000\000\255\301-\033\000\000\000\000\311\302u\032\000\000"
+ "\000\000\270\3035\032\000\000\000\000\270\303k\031\000\000\000\000\034\303"
+ "}\030\000\000\000\000\270\303\305\026\000\000\000\000\270\303\003\025\000"
+ "\000\000\000y\304:\025\000\000\000\000\024\305^\024\000\000\000\000\024\305"
+ "\011\021\000\000\000\000\311\302\011\021\000\000\000\000\311\302\352\014"
+ "\000\000\000\0003\324\3759\000\000\000\0003\324\2059\000\000\000\000\327"
+ "\323\2059\000\000\000\000\204\322\2059\000\000\000\000\324\31739\000\000"
+ "\000\000\324\317\3058\000\000\000\000\237\321\3058\000\000\000\000\237\321"
+ "W8\000\000\000\000\324\317 8\000\000\000\000Z\314\3047\000\000\000\000Z\314"
+ "\3266\000\000\000\000x\317\3365\000\000\000\000x\317\3771\000\000\000\000"
+ "\271\320\0101\000\000\000\000\271\320\2320\000\000\000\000\273\322>0\000"
+ "\000\000\000\327\323\264/\000\000\000\000\206\324t/\000\000\000\000\206\324"
+ "\375.\000\000\000\000r\323S.\000\000\000\000\273\322\316-\000\000\000\000"
+ "\204\322{,\000\000\000\000\361\321\203+\000\000\000\000;\322\202*\000\000"
+ "\000\000\272\321\202*\000\000\000\000\361\321\260*\000\000\000\000\026\322"
+ "\302)\000\000\000\000\204\322\206)\000\000\000\000;\322&)\000\000\000\000"
+ "\237\322\312(\000\000\000\000\026\322\367'\000\000\000\000[\322\245'\000"
+ "\000\000\000\027\323@'\000\000\000\000\237\322\244&\000\000\000\000G\321"
+ "\362&\000\000\000\000y\320@'\000\000\000\000\324\317H&\000\000\000\000y\320"
+ "\277%\000\000\000\000y\320G%\000\000\000\000\340\320\203%\000\000\000\000"
+ "\340\320\347$\000\000\000\000\361\321\347$\000\000\000\0008\322\220$\000"
+ "\000\000\000\204\322\203%\000\000\000\000\237\322\347$\000\000\000\000\027"
+ "\323\347$\000\000\000\000\027\323E\042\000\000\000\000\026\322E\042\000\000"
+ "\000\000\307\325w!\000\000\000\000\253\325\216\042\000\000\000\0005\326\305"
+ "\042\000\000\000\000l\327G$\000\000\000\000l\327\277%\000\000\000\000\077"
+ "\330\277%\000\000\000\000\233\330\273$\000\000\000\000\233\330!#\000\000"
+ "\000\000\270\331!#\000\000\000\000\235\332\327!\000\000\000\000S\332\333"
+ " \000\000\000\000)\331\026!\000\000\000\000)\331w!\000\000\000\000\300\330"
+ "w!\000\000\000\000\022\330\333 \000\000\000\000\232\327\333 \000\000\000"
+ "\000l\327\327!\000\000\000\000\243\326\327!\000\000\000\000\235\317\002\042"
+ "\000\000\000\000\357\316w!\000\000\000\000\324\317F!\000\000\000\000\324"
+ "\317m \000\000\000\000\271\320\303\037\000\000\000\000\324\317Y\037\000\000"
+ "\000\000\324\317>\016\000\000\000\000\333\314>\016\000\000\000\000\333\314"
+ "\325\010\000\000\000\000[\315\325\010\000\000\000\000[\315T\010\000\000\000"
+ "\000\244\314T\010\000\000\000\000\021\314f\007\000\000\000\000\232\3137\006"
+ "\000\000\000\000Z\3147\006\000\000\000\000\244\314\233\005\000\000\000\000"
+ "Z\3147\005\000\000\000\000\333\314\322\004\000\000\000\000\011\316\004\005"
+ "\000\000\000\000\212\316Q\004\000\000\000\000\024\320Q\004\000\000\000\000"
+ "\246\317P\003\000\000\000\000\024\320Y\002\000\000\000\000\246\317\364\001"
+ "\000\000\000\000\024\320\230\001\000\000\000\000\024\320F\001\000\000\000"
+ "\000\246\317\017\001\000\000\000\000J\316F\001\000\000\000\000J\316\305\000"
+ "\000\000\000\000\312\316\240\000\000\000\000\000\312\316W\000\000\000\000"
+ "\000\011\316W\000\000\000\000\000\011\316\262\377\000\000\000\000\312\316"
+ "\015\377\000\000\000\000\011\316\335\374\000\000\000\000\233\314\246\374"
+ "\000\000\000\000\021\314/\374\000\000\000\000\325\313J\373\000\000\000\000"
+ "u\313\356\372\000\000\000\000u\313\300\372\000\000\000\000\177\314[\372\000"
+ "\000\000\000\011\316$\372\000\000\000\000\236\320\332\370\000\000\000\000"
+ "T\317,\370\000\000\000\000j\316\007\370\000\000\000\000\370\316\364\366\000"
+ "\000\000\000\370\316\305\365\000\000\000\000\261\316|\365\000\000\000\000"
+ "\212\316\262\364\000\000\000\000\370\316W\364\000\000\000\000J\316\215\363"
+ "\000\000\000\000J\316\014\363\000\000\000\000\011\316\336\362\000\000\000"
+ "\000*\316\213\361\000\000\000\000\032\316\345\357\000\000\000\000\256\315"
+ "R\356\000\000\000\000\203\305R\356\000\000\000\000\203\305f\345\000\000\000"
+ "\000\243\313f\345\000\000\000\000\321\3137\344\000\000\000\000\321\313\200"
+ "\343\000\000\000\000G\313\277\342\000\000\000\000G\313\077\342\000\000\000"
+ "\000\365\312,\341\000\000\000\000\220\312,\341\000\000\000\000\220\312<\337"
+ "\000\000\000\0004\312\341\336\000\000\000\000\017\312\314\333\000\000\000"
+ "\000\220\312\360\332\000\000\000\000\365\313\023\331\000\000\000\000-\315"
+ "\023\331\000\000\000\000\011\316\211\330\000\000\000\000]\317R\330\000\000"
+ "\000\000\370\316\367\330\000\000\000\000\314\321\316\330\000\000\000\000"
+ "\262\3227\331\000\000\000\000\314\3207\331\000\000\000\000\360\317\257\331"
+ "\000\000\000\000\360\317V\335\000\000\000\000^\321\362\335\000\000\000\000"
+ "^\321|\336\000\000\000\000^\320|\336\000\000\000\000\360\317\341\336\000"
+ "\000\000\000\360\317\206\337\000\000\000\000^\3214\340\000\000\000\000\225"
+ "\321,\341\000\000\000\000\262\322~\341\000\000\000\000\215\322\021\342\000"
+ "\000\000\000\277\321\021\342\000\000\000\000\277\321\277\342\000\000\000"
+ "\000\314\321\355\342\000\000\000\000\362\322\277\342\000\000\000\000\340"
+ "\323\355\342\000\000\000\000\340\323\200\343\000\000\000\000\016\3247\344"
+ "\000\000\000\000\320\325\201\344\000\000\000\000\276\326\317\344\000\000"
+ "\000\000\310\327\335\345\000\000\000\000\310\327&\346\000\000\000\000C\327"
+ "&\346\000\000\000\000C\327g\346\000\000\000\000\206\327\314\346\000\000\000"
+ "\000G\326L\347\000\000\000\000\220\326\250\347\000\000\000\000\355\327\014"
+ "\347\000\000\000\000e\331\014\347\000\000\000\000\012\332\361\347\000\000"
+ "\000\000\370\316\360\332\000\000\000\000J\316\024\333\000\000\000\000\221"
+ "\314\024\333\000\000\000\000\221\314\314\333\000\000\000\000\365\313\314"
+ "\333\000\000\000\000\243\313_\334\000\000\000\000\243\313\350\334\000\000"
+ "\000\000C\314V\335\000\000\000\000\221\314\244\335\000\000\000\000j\314\362"
+ "\335\000\000\000\000-\315\341\336\000\000\000\000\314\314\206\337\000\000"
+ "\000\000-\315\335\337\000\000\000\000\314\3144\340\000\000\000\000\314\314"
+ "\010\340\000\000\000\000-\315}\340\000\000\000\000\314\314\353\340\000\000"
+ "\000\000\221\314\310\341\000\000\000\000\314\314\077\342\000\000\000\000"
+ "\314\3146\343\000\000\000\000-\315\201\344\000\000\000\000n\315\201\344\000"
+ "\000\000\000n\315\002\346\000\000\000\000\344\315g\346\000\000\000\000\256"
+ "\315\014\347\000\000\000\000J\316\250\347\000\000\000\000J\316\077\350\000"
+ "\000\000\000\251\315\334\351\000\000\000\000*\316j\352\000\000\000\000\032"
+ "\316\030\353\000\000\000\000\370\316\231\354\000\000\000\000]\317\231\354"
+ "\000\000\000\000*\317H\355\000\000\000\000D\317\222\356\000\000\000\000'"
+ "\320\356\356\000\000\000\000'\320\345\357\000\000\000\000\336\320\212\360"
+ "\000\000\000\000^\321\134\360\000\000\000\000$\3228\360\000\000\000\000\077"
+ "\322\345\357\000\000\000\000\237\322\134\360\000\000\000\000i\323J\360\000"
+ "\000\000\000\251\323\345\357\000\000\000\000E\324i\357\000\000\000\000\217"
+ "\324\033\357\000\000\000\000X\325\356\356\000\000\000\000G\326R\356\000\000"
+ "\000\000\042\326R\356\000\000\000\000\346\326\355\355\000\000\000\000\346"
+ "\326\243\355\000\000\000\000\042\326\231\354\000\000\000\000\355\327l\354"
+ "\000\000\000\000\251\330\231\354\000\000\000\000\011\331\036\355\000\000"
+ "\000\000e\331\356\356\000\000\000\000\267\331\247\357\000\000\000\000\357"
+ "\332\212\360\000\000\000\000\024\333B\361\000\000\000\000\247\333\213\361"
+ "\000\000\000\000\247\3335\362\000\000\000\000<\332\336\362\000\000\000\000"
+ "\370\331\362\363\000\000\000\000\024\333\262\364\000\000\000\000\247\333"
+ "|\365\000\000\000\000\002\334\364\366\000\000\000\000\325\333,\370\000\000"
+ "\000\000C\334\332\370\000\000\000\000\247\333\332\370\000\000\000\000\247"
+ "\333\177\371\000\000\000\000\024\333\355\371\000\000\000\000\247\333[\372"
+ "\000\000\000\000]\333\034\373\000\000\000\000\206\332J\373\000\000\000\000"
+ "<\332\246\374\000\000\000\000<\332k\374\000\000\000\000\301\332\247\375\000"
+ "\000\000\000\024\333y\375\000\000\000\000\024\333\365\375\000\000\000\000"
+ "\301\332:\376\000\000\000\000\301\332`\377\000\000\000\000\032\332|\000\000"
+ "\000\000\000\011\331F\001\000\000\000\000\011\331\306\001\000\000\000\000"
+ "\033\330\306\001\000\000\000\000\033\330*\001\000\000\000\000\244\327F\001"
+ "\000\000\000\000\346\326\325\002\000\000\000\000\346\326\207\003\000\000"
+ "\000\000E\327\207\003\000\000\000\000E\327#\004\000\000\000\000\216\331#"
+ "\004\000\000\000\000\206\332\207\003\000\000\000\000\206\332\363-\000\000"
+ "\000\000\134\345\032\370\000\000\000\000f\346\332\370\000\000\000\000\036"
+ "\347\355\371\000\000\000\000\036\347J\373\000\000\000\000\224\346/\374\000"
+ "\000\000\000\341\345/\374\000\000\000\000\034\345\246\374\000\000\000\000"
+ "\034\345S.\000\000\000\000\212\331\375.\000\000\000\000e\331\224/\000\000"
+ "\000\000\270\331\371/\000\000\000\000\311\330c1\000\000\000\000\311\330\222"
+ "2\000\000\000\000\326\327\3112\000\000\000\000\326\327n3\000\000\000\000"
+ "\321\326\3644\000\000\000\000\253\325\3365\000\000\000\000r\323\3365\000"
+ "\000\000\000\271\322\0256\000\000\000\000\206\332\235:\000\000\000\000\206"
+ "\332\313\077\000\000\000\000.\345\313\077\000\000\000\000.\345l;\000\000"
+ "\000\000\311\357\313\077\000\000\000\000\311\357\353:\000\000\000\000F\354"
+ "l;\000\000\000\000\372\362&:\000\000\000\000\217\366&:\000\000\000\000k\367"
+ "\3759\000\000\000\000\375\366\2059\000\000\000\0004\367\2059\000\000\000"
+ "\000\250\363\3058\000\000\000\000z\363\0327\000\000\000\000\372\362\0256"
+ "\000\000\000\000:\363i5\000\000\000\000\250\363i5\000\000\000\000\221\363"
+ "\3644\000\000\000\0009\362\2704\000\000\000\000\245\360\2343\000\000\000"
+ "\000n\360\0343\000\000\000\000\335\360d2\000\000\000\000\335\360\3731\000"
+ "\000\000\000\311\357c1\000\000\000\000\376\354\2320\000\000\000\000\015\351"
+ ">0\000\000\000\000\236\347\375.\000\000\000\000.\345S.\000\000\000\000w\372"
+ "\313\077\000\000\000\000w\372\371/\000\000\000\000\343\355\371/\000\000\000"
+ "\000\343\355{,\000\000\000\000\311\357{,\000\000\000\000w\372{,\000\000\000"
+ "\000w\372@'\000\000\000\000I\372@'\000\000\000\000\377\371@'\000\000\000"
+ "\000\221\371\244&\000\000\000\000\321\370\244&\000\000\000\000c\370H&\000"
+ "\000\000\000\232\370\277%\000\000\000\0001\371\203%\000\000\000\000c\370"
+ "\347$\000\000\000\000\232\370G$\000\000\000\000\310\371G$\000\000\000\000"
+ "I\372\227$\000\000\000\000I\372\013\037\000\000\000\000\311\357\200\034\000"
+ "\000\000\000D\351\200\034\000\000\000\000D\351\332\031\000\000\000\000\311"
+ "\357\332\031\000\000\000\000\311\357\017\015\000\000\000\0004\354\017\015"
+ "\000\000\000\0004\354h\011\000\000\000\000v\371\207\003\000\000\000\000\206"
+ "\366d\005\000\000\000\000O\366\212\006\000\000\000\000E\365\257\007\000\000"
+ "\000\000_\364\257\007\000\000\000\0001\364'\010\000\000\000\000\361\363\271"
+ "\010\000\000\000\000\021\364\303\011\000\000\000\000h\363{\012\000\000\000"
+ "\000\021\364\340\012\000\000\000\0001\364\352\013\000\000\000\000_\364O\014"
+ "\000\000\000\000_\364=\015\000\000\000\000\275\363\207\016\000\000\000\000"
+ "\361\363v\017\000\000\000\000H\364\355\017\000\000\000\000\226\364\267\020"
+ "\000\000\000\000E\365\200\021\000\000\000\000E\365\323\021\000\000\000\000"
+ "\216\365\323\021\000\000\000\000\216\3658\022\000\000\000\000\035\3618\022"
+ "\000\000\000\000\035\361V\025\000\000\000\000E\365\257\035\000\000\000\000"
+ "\221\371\257\035\000\000\000\0001\371\213\036\000\000\000\000\310\371\302"
+ "\036\000\000\000\000\010\372\346\035\000\000\000\000$\372\257\035\000\000"
+ "\000\0007\373\257\035\000\000\000\000n\373x\035\000\000\000\000\011\373\001"
+ "\035\000\000\000\000\011\373.\034\000\000\000\000\256\372\000\034\000\000"
+ "\000\000\333\372\244\033\000\000\000\000\256\372-\033\000\000\000\000\333"
+ "\372\355\032\000\000\000\000\256\372\210\032\000\000\000\000\256\372>\032"
+ "\000\000\000\000n\373>\032\000\000\000\000n\373\254\031\000\000\000\000\001"
+ "\374\202\031\000\000\000\000x\374\331\030\000\000\000\000\314\375\331\030"
+ "\000\000\000\000z\376\331\030\000\000\000\000\261\376\206\030\000\000\000"
+ "\000\225\376s\027\000\000\000\000\026\377\027\027\000\000\000\000\326\376"
+ "\274\026\000\000\000\000\314\375\274\026\000\000\000\000\042\375r\026\000"
+ "\000\000\000\042\375\373\025\000\000\000\000\001\374\037\025\000\000\000"
+ "\000d\372\325\024\000\000\000\000\255\371^\024\000\000\000\000\255\371K\023"
+ "\000\000\000\000\227\000\376\016\000\000\000\000\227\000\254\016\000\000"
+ "\000\000\205\0015\016\000\000\000\000!\0025\016\000\000\000\000!\002t\015"
+ "\000\000\000\000\342\002t\015\000\000\000\000\342\002\216\013\000\000\000"
+ "\000O\002\255\012\000\000\000\000\000\000{\012\000\000\000\000\000\000\303"
+ "\011\000\000\000\000\227\000\303\011\000\000\000\000\227\000>\011\000\000"
+ "\000\000\205\001\336\010\000\000\000\000\205\001'\010\000\000\000\000\340"
+ "\000\353\007\000\000\000\000K\000\257\007\000\000\000\000\226\000\035\007"
+ "\000\000\000\000\340\000\035\007\000\000\000\000\340\000\212\006\000\000"
+ "\000\000\016\001J\006\000\000\000\000\016\001v\004\000\000\000\000!\002v"
+ "\004\000\000\000\000\342\002v\004\000\000\000\000u\003\021\004\000\000\000"
+ "\000\343\003C\003\000\000\000\000\021\004\376\002\000\000\000\000-\005 \003"
+ "\000\000\000\000-\005N\377\000\000\000\000\230\001N\377\000\000\000\000\230"
+ "\0010\375\000\000\000\000\323\0010\375\000\000\000\000$\005\313\077\000\000"
+ "\000\000$\005\362,\000\000\000\000,\004{,\000\000\000\000G\003\026,\000\000"
+ "\000\000\031\003\003+\000\000\000\000u\003\271*\000\000\000\000\272\003\271"
+ ")\000\000\000\000,\004K)\000\000\000\000\250\004\035)\000\000\000\000$\005"
+ "\035)\000\000\000\000$\005\003&\000\000\000\000G\003\277%\000\000\000\000"
+ "\031\0035%\000\000\000\000\375\001o$\000\000\000\000\340\000G$\000\000\000"
+ "\000\340\000\230#\000\000\000\000\000\000a#\000\000\000\000\326\377\363\042"
+ "\000\000\000\000\026\377*#\000\000\000\000\366\376a#\000\000\000\000z\376"
+ "F#\000\000\000\000\243\376|\042\000\000\000\000\371\375|\042\000\000\000"
+ "\000\314\375\252\042\000\000\000\000\247\375\252\042\000\000\000\000\302"
+ "\374\252\042\000\000\000\000=\374N\042\000\000\000\000\302\374\321!\000\000"
+ "\000\000w\375\227!\000\000\000\000\247\375\227!\000\000\000\000#\376\227"
+ "!\000\000\000\000N\376\362 \000\000\000\000\026\377h \000\000\000\000\270"
+ "\376\247\036\000\000\000\000\321\017\313\077\000\000\000\000\321\017\301"
+ "9\000\000\000\000\352\027\3019\000\000\000\000\352\027\2775\000\000\000\000"
+ "\321\017\2775\000\000\000\000\321\01762\000\000\000\000\222\020w2\000\000"
+ "\000\000\335\023w2\000\000\000\000L\02562\000\000\000\000\005\027\1771\000"
+ "\000\000\000\352\027,1\000\000\000\000Y\031,1\000\000\000\000\207\032\321"
+ "0\000\000\000\000\207\032\3427\000\000\000\000Y\031\3427\000\000\000\000"
+ "Y\031\3019\000\000\000\000\207\032\3019\000\000\000\000\207\032\313\077\000"
+ "\000\000\000\330\025\3741\000\000\000\000\330\025V1\000\000\000\000L\025"
+ "V1\000\000\000\000\225\024,1\000\000\000\000\013\024\3210\000\000\000\000"
+ "\013\024Y0\000\000\000\000\036\025\371/\000\000\000\000L\025\242/\000\000"
+ "\000\000P\024t/\000\000\000\000L\025\252.\000\000\000\000\036\025E.\000\000"
+ "\000\000\036\025\016.\000\000\000\000\222\025|-\000\000\000\000u\0257-\000"
+ "\000\000\000\330\025\267,\000\000\000\000(\026\267,\000\000\000\000(\026"
+ "H,\000\000\000\000\316\024_+\000\000\000\000\235\023\336*\000\000\000\000"
+ "\013\024\002*\000\000\000\000o\023\271)\000\000\000\000\275\023\035)\000"
+ "\000\000\000o\023\346(\000\000\000\000\235\023n(\000\000\000\000\324\023"
+ "\334'\000\000\000\000\225\024\334'\000\000\000\000\316\024\220'\000\000\000"
+ "\000\330\025\220'\000\000\000\000\330\025\244&\000\000\000\000\351\026\003"
+ "&\000\000\000\000\351\026\277%\000\000\000\000(\026\241%\000\000\000\000"
+ "a\026\347$\000\000\000\000\351\026\322$\000\000\000\000\351\0265%\000\000"
+ "\000\000\017\030D%\000\000\000\000j\030\322$\000\000\000\000\017\030[$\000"
+ "\000\000\000\017\031G$\000\000\000\000=\031\230#\000\000\000\000\207\032"
+ "\230#\000\000\000\000\207\032S#\000\000\000\000\310\033S#\000\000\000\000"
+ "I\034\017#\000\000\000\000\011\034|\042\000\000\000\000I\034\020\042\000"
+ "\000\000\000(\033\321!\000\000\000\000\342\031\350\037\000\000\000\000\342"
+ "\031<\035\000\000\000\000I\034\001\035\000\000\000\000n\035x\035\000\000"
+ "\000\000\225\024\1771\000\000\000\000\235\023\3331\000\000\000\0008\022\177"
+ "1\000\000\000\0008\022\3770\000\000\000\000[\021Y0\000\000\000\000\333\020"
+ "\3210\000\000\000\0001\020\3210\000\000\000\000\007\017A1\000\000\000\000"
+ "\276\016\3770\000\000\000\000\234\017Y0\000\000\000\000\206\020Y0\000\000"
+ "\000\000\333\020t/\000\000\000\000\261\020\017/\000\000\000\000\033\021\252"
+ ".\000\000\000\000\220\016\362,\000\000\000\000\230\015\336*\000\000\000\000"
+ "\230\0159*\000\000\000\000\007\0179*\000\000\000\000\276\016@'\000\000\000"
+ "\000\021\020\362&\000\000\000\000\021\020\244&\000\000\000\000\261\020v&"
+ "\000\000\000\000\346\020z%\000\000\000\000a\020\013%\000\000\000\000\313"
+ "\020\226$\000\000\000\000\033\021\357#\000\000\000\000\021\0201#\000\000"
+ "\000\000\021\020\305\042\000\000\000\000h\017\223\042\000\000\000\000\274"
+ "\017F\042\000\000\000\000\021\020\020\042\000\000\000\000\274\017\264!\000"
+ "\000\000\000\007\017\334 \000\000\000\000P\016\255 \000\000\000\000b\017"
+ "\207\037\000\000\000\000\021\020\207\037\000\000\000\000\021\0209\037\000"
+ "\000\000\000\274\017\302\036\000\000\000\000a\020\213\036\000\000\000\000"
+ "\347\017\035\036\000\000\000\000\347\017\346\035\000\000\000\000a\020\257"
+ "\035\000\000\000\000a\020<\035\000\000\000\000\222\017\001\035\000\000\000"
+ "\000\007\017\001\035\000\000\000\000~\016R\034\000\000\000\000\230\015R\034"
+ "\000\000\000\000P\016\322\033\000\000\000\000~\016\244\033\000\000\000\000"
+ "~\016-\033\000\000\000\000~\016\272\032\000\000\000\000\007\017\210\032\000"
+ "\000\000\000\007\017\365\031\000\000\000\000\271\017\365\031\000\000\000"
+ "\000\347\017\365\031\000\000\000\000\347\017s\027\000\000\000\000a\020\027"
+ "\027\000\000\000\000\033\021\274\026\000\000\000\000\311\021\274\026\000"
+ "\000\000\000\311\021r\026\000\000\000\000r\0217\026\000\000\000\000\311\021"
+ "\304\025\000\000\000\000r\021V\025\000\000\000\000\311\021\325\024\000\000"
+ "\000\000\311\0215\016\000\000\000\000\333\020\324\015\000\000\000\000\333"
+ "\020\036\013\000\000\000\000\077\020\036\013\000\000\000\000\321\017\303"
+ "\011\000\000\000\000u\017\016\011\000\000\000\000\321\017\336\010\000\000"
+ "\000\000\321\017'\010\000\000\000\000\010\020f\007\000\000\000\000\333\020"
+ "\323\006\000\000\000\000\215\020\367\005\000\000\000\000\011\021\367\005"
+ "\000\000\000\000\011\021\300\005\000\000\000\000\200\021\300\005\000\000"
+ "\000\000\311\021\022\005\000\000\000\000\312\022\266\004\000\000\000\000"
+ "\312\022v\004\000\000\000\000K\023\021\004\000\000\000\000K\023\207\003\000"
+ "\000\000\000\223\022C\003\000\000\000\000\200\021\207\003\000\000\000\000"
+ "\355\017 \003\000\000\000\000\321\017\320\002\000\000\000\000\215\020\242"
+ "\002\000\000\000\000/\020P\002\000\000\000\000/\020\317\001\000\000\000\000"
+ "^\020\317\001\000\000\000\000\313\020\206\001\000\000\000\000\355\017\206"
+ "\001\000\000\000\000\243\017\363\000\000\000\000\000\224\020N\377\000\000"
+ "\000\000D\021\304\376\000\000\000\000D\021q\376\000\000\000\000\243\017q"
+ "\376\000\000\000\000\242\016\025\376\000\000\000\000~\016^\375\000\000\000"
+ "\000G\016\357\373\000\000\000\000\306\015\237\373\000\000\000\000\306\015"
+ "\367\372\000\000\000\000b\016\367\372\000\000\000\000\220\016\267\372\000"
+ "\000\000\000l\017\267\372\000\000\000\000l\017\077\371\000\000\000\000\254"
+ "\017\243\370\000\000\000\000\243\017\354\367\000\000\000\000\354\020\354"
+ "\367\000\000\000\000\354\020\242\366\000\000\000\000l\017\242\366\000\000"
+ "\000\000l\017D\364\000\000\000\000t\020q\363\000\000\000\000\254\017(\363"
+ "\000\000\000\000\217\015(\363\000\000\000\000\352\014\237\363\000\000\000"
+ "\000\272\011\237\363\000\000\000\000\203\011\237\363\000\000\000\0000\011"
+ "\333\363\000\000\000\000\271\010\237\363\000\000\000\000/\010\275\363\000"
+ "\000\000\000\002\010c\363\000\000\000\000t\010\247\362\000\000\000\000\272"
+ "\011\212\360\000\000\000\000C\012\001\360\000\000\000\000\377\011\255\356"
+ "\000\000\000\000z\012v\356\000\000\000\000z\012Z\355\000\000\000\000\350"
+ "\012\042\354\000\000\000\000\227\013\264\353\000\000\000\000\374\013\017"
+ "\353\000\000\000\000\374\013\252\352\000\000\000\000\352\014N\351\000\000"
+ "\000\000\352\014\004\351\000\000\000\000\230\014\215\350\000\000\000\000"
+ "\352\014\037\350\000\000\000\000\352\014\250\347\000\000\000\000\006\016"
+ "0\347\000\000\000\000b\016l\347\000\000\000\000\376\016\250\347\000\000\000"
+ "\000l\017\212\347\000\000\000\000\033\034D\364\000\000\000\000\334\034<\365"
+ "\000\000\000\000\334\034\230\365\000\000\000\000{\034\017\366\000\000\000"
+ "\000\253\034\354\367\000\000\000\000\334\034G\370\000\000\000\000\223\034"
+ "\243\370\000\000\000\000\033\034,\370\000\000\000\000W\034,\370\000\000\000"
+ "\000\265\032\354\367\000\000\000\000\265\032\242\367\000\000\000\000b\031"
+ "\242\367\000\000\000\000=\031\354\367\000\000\000\000\230\030\354\367\000"
+ "\000\000\0003\030\077\371\000\000\000\000E\027\077\371\000\000\000\000\304"
+ "\025\266\371\000\000\000\000V\025\367\372\000\000\000\000\347\024%\373\000"
+ "\000\000\000\203\024\246\374\000\000\000\000V\0250\375\000\000\000\000\015"
+ "\026^\375\000\000\000\000\015\026\272\375\000\000\000\000\215\025\025\376"
+ "\000\000\000\000\015\026q\376\000\000\000\000\315\025\011\377\000\000\000"
+ "\000\354\024\011\377\000\000\000\000\354\024\362\377\000\000\000\000V\025"
+ "\305\000\000\000\000\0002\026\206\001\000\000\000\000\304\025\317\001\000"
+ "\000\000\000\355\025\242\002\000\000\000\000\204\026\271\002\000\000\000"
+ "\000\274\027\271\002\000\000\000\0003\030 \003\000\000\000\000=\031 \003"
+ "\000\000\000\000P\031\314\003\000\000\000\000\353\030\314\003\000\000\000"
+ "\000\230\030\266\004\000\000\000\000\274\027i\005\000\000\000\000E\027i\005"
+ "\000\000\000\000\200\027\367\005\000\000\000\000*\030\367\005\000\000\000"
+ "\000\370\027\035\007\000\000\000\000\325\027\323\006\000\000\000\0003\030"
+ "\224\007\000\000\000\000\301\030\224\007\000\000\000\000\353\030\202\010"
+ "\000\000\000\000\035\031\366\010\000\000\000\000\207\031\366\010\000\000"
+ "\000\000\342\031\303\011\000\000\000\000\264\031\255\012\000\000\000\000"
+ "\031\032N\013\000\000\000\000\031\032\363\013\000\000\000\000\026\033y\014"
+ "\000\000\000\000m\033\352\014\000\000\000\000\026\033+\015\000\000\000\000"
+ "\026\033\253\015\000\000\000\000\227\032\253\015\000\000\000\000\227\032"
+ "%\021\000\000\000\000\326\030\313\023\000\000\000\000z\030\313\023\000\000"
+ "\000\000\230\030\325\024\000\000\000\000\207\031\325\024\000\000\000\000"
+ "\342\031\026\025\000\000\000\000\227\032\026\025\000\000\000\000\227\032"
+ "\215\025\000\000\000\000\026\033\215\025\000\000\000\000=\032r\026\000\000"
+ "\000\000\255\033\274\026\000\000\000\000m\033\241\027\000\000\000\000.\035"
+ "O\030\000\000\000\000.\035\254\031\000\000\000\000n\035\365\031\000\000\000"
+ "\000\301\035\365\031\000\000\000\000T\036\210\032\000\000\000\000^\037>\032"
+ "\000\000\000\000\247\037c\032\000\000\000\0000\037\322\033\000\000\000\000"
+ "\202\037\022\034\000\000\000\000\331\036\001\035\000\000\000\000T\036x\035"
+ "\000\000\000\000\020%\313\077\000\000\000\000\020%\320:\000\000\000\000\306"
+ "/\313\077\000\000\000\000\306/\320:\000\000\000\000\306/\2726\000\000\000"
+ "\000\3430\2726\000\000\000\000\3430:6\000\000\000\000\306/\3605\000\000\000"
+ "\000\306/O4\000\000\000\000j:\313\077\000\000\000\000j:@>\000\000\000\000"
+ "\306/\3529\000\000\000\000\306/\2562\000\000\000\000X/w2\000\000\000\000"
+ "!/62\000\000\000\000\306/\3741\000\000\000\000\217/\3331\000\000\000\000"
+ "X/\1771\000\000\000\000t/ 1\000\000\000\000\0310\0771\000\000\000\000\231"
+ "0\3770\000\000\000\000\0071\3210\000\000\000\000\2310Y0\000\000\000\000\352"
+ ".\0111\000\000\000\000\351-/1\000\000\000\000\251-\3210\000\000\000\000j"
+ ".\2610\000\000\000\000E.Y0\000\000\000\000\352.)0\000\000\000\000\352.\347"
+ "/\000\000\000\000\011.B/\000\000\000\000\204,\017/\000\000\000\000\204,\335"
+ ".\000\000\000\000\214+x.\000\000\000\000\371*\016.\000\000\000\000\224**"
+ ".\000\000\000\000\035*\316-\000\000\000\000Y*7-\000\000\000\000\270)\267"
+ ",\000\000\000\000\035*H,\000\000\000\000\270)_+\000\000\000\0007(\250+\000"
+ "\000\000\000\266&\036+\000\000\000\000Y%_+\000\000\000\000\242$\036+\000"
+ "\000\000\000\376$\214*\000\000\000\000\010&\214*\000\000\000\000\203%\002"
+ "*\000\000\000\000\010&\335)\000\000\000\000\266&\252(\000\000\000\000_&%"
+ "(\000\000\000\000\212&\266'\000\000\000\000\305%\266'\000\000\000\000Y%\355"
+ "'\000\000\000\000\320$\220'\000\000\000\000b$\266'\000\000\000\000\240\042"
+ "\252(\000\000\000\000\015!0(\000\000\000\000\337 \274(\000\000\000\000\237"
+ "!\346(\000\000\000\000\237!D)\000\000\000\000\337 \035)\000\000\000\000\337"
+ " k)\000\000\000\000\237!\335)\000\000\000\000\250 \325*\000\000\000\000\237"
+ "!\203+\000\000\000\000E\042>+\000\000\000\000E\042p*\000\000\000\000E#\360"
+ ")\000\000\000\000E#Y*\000\000\000\000\231$Y*\000\000\000\000\320$\325*\000"
+ "\000\000\000\217%\362&\000\000\000\000\305%\313&\000\000\000\000\305%T&\000"
+ "\000\000\000\025%v&\000\000\000\000\320$\241%\000\000\000\0004$\321$\000"
+ "\000\000\000|\042\230#\000\000\000\000|\042S#\000\000\000\000E\0421#\000"
+ "\000\000\000\237!\230#\000\000\000\000\015!B#\000\000\000\000\077!\254\042"
+ "\000\000\000\000\337 l\042\000\000\000\000\015!+\042\000\000\000\000V!+\042"
+ "\000\000\000\000\237!\321!\000\000\000\000E\042\321!\000\000\000\000\240"
+ "\042H!\000\000\000\000\363\042\305 \000\000\000\000|\042V \000\000\000\000"
+ "\237!V \000\000\000\000&!\215 \000\000\000\000\337 \006!\000\000\000\000"
+ "V!H!\000\000\000\000\337 \264!\000\000\000\000: \376!\000\000\000\000k\037"
+ "\020\042\000\000\000\000\331\036\215!\000\000\000\000T\036\215!\000\000\000"
+ "\000\012\036\007\042\000\000\000\000\301\035\360!\000\000\000\000\301\035"
+ "L\042\000\000\000\000/\036\214\042\000\000\000\000/\036\305\042\000\000\000"
+ "\000\301\035\305\042\000\000\000\000\301\035B#\000\000\000\000n\035m#\000"
+ "\000\000\000N\0354$\000\000\000\000\301\035[$\000\000\000\000/\036[$\000"
+ "\000\000\000/\036\321$\000\000\000\000\226\036D%\000\000\000\000\337 D%\000"
+ "\000\000\000\032!z%\000\000\000\000\362!_%\000\000\000\000E\042z%\000\000"
+ "\000\000\015\042\341%\000\000\000\000r\042T&\000\000\000\000\201#\032&\000"
+ "\000\000\000\201#\244&\000\000\000\000X#\244&\000\000\000\0004$\215&\000"
+ "\000\000\000\231$\313&\000\000\000\000n\035\035\036\000\000\000\000I\034"
+ "\302\036\000\000\000\000.\035\376\036\000\000\000\000\210\035\247\036\000"
+ "\000\000\000T\036\247\036\000\000\000\0000\037\035\036\000\000\000\000: "
+ "\035\036\000\000\000\000\032!\257\035\000\000\000\000\237!<\035\000\000\000"
+ "\000E\042<\035\000\000\000\000r\042\257\035\000\000\000\000{!\213\036\000"
+ "\000\000\000\304!9\037\000\000\000\000\237!\207\037\000\000\000\000V!9\037"
+ "\000\000\000\000\337 \207\037\000\000\000\000X#\251\034\000\000\000\000\363"
+ "\042\244\033\000\000\000\000\240\042-\033\000\000\000\000\362!h\033\000\000"
+ "\000\000\367!'\034\000\000\000\000{!\022\034\000\000\000\000\375 h\033\000"
+ "\000\000\000: h\033\000\000\000\000: k\031\000\000\000\000\337 k\031\000"
+ "\000\000\000\252 \264\030\000\000\000\000: \206\030\000\000\000\000: \370"
+ "\027\000\000\000\000\304 E\027\000\000\000\000\362!r\026\000\000\000\000"
+ "\362!\304\025\000\000\000\000[\042Q\025\000\000\000\000X#\026\025\000\000"
+ "\000\000\202$\213\023\000\000\000\000\253$\213\023\000\000\000\0005%\213"
+ "\023\000\000\000\000\207%\357\022\000\000\000\000Q&\357\022\000\000\000\000"
+ "\266&A\022\000\000\000\000v'\357\022\000\000\000\000S(=\023\000\000\000\000"
+ "\256(A\022\000\000\000\000\261+\301\021\000\000\000\000\261+\230\022\000"
+ "\000\000\000\326,\357\022\000\000\000\000\326,=\023\000\000\000\000\204,"
+ "=\023\000\000\000\000\204,\313\023\000\000\000\000\261+P\024\000\000\000"
+ "\000\025+3\025\000\000\000\000\337+\304\025\000\000\000\000\337+7\026\000"
+ "\000\000\000\025+T\026\000\000\000\000\347*\077\030\000\000\000\000z+k\031"
+ "\000\000\000\000c+\365\031\000\000\000\000\271*\365\031\000\000\000\000\357"
+ ")\241\032\000\000\000\000/)\272\032\000\000\000\000\200(-\033\000\000\000"
+ "\000\026'\364\032\000\000\000\000\266&\210\032\000\000\000\000Q&c\032\000"
+ "\000\000\000Q&\365\031\000\000\000\000\320$\320\031\000\000\000\000X#u\032"
+ "\000\000\000\000\312\042u\032\000\000\000\0005%=\023\000\000\000\0005%%\021"
+ "\000\000\000\000\202$\000\021\000\000\000\000^%R\020\000\000\000\000Q&\010"
+ "\020\000\000\000\000\026'\010\020\000\000\000\000v'\221\017\000\000\000\000"
+ "v'\032\017\000\000\000\000\355&\324\015\000\000\000\000\253$k\015\000\000"
+ "\000\000\314%\363\013\000\000\000\0005%\240\013\000\000\000\0005%\303\011"
+ "\000\000\000\000v'\303\011\000\000\000\000v'f\007\000\000\000\000\264/\225"
+ "\010\000\000\000\000\2124\225\010\000\000\000\000\2124i\005\000\000\000\000"
+ "\264/\000\021\000\000\000\000t/\301\021\000\000\000\0004/\223\021\000\000"
+ "\000\0004/\001\022\000\000\000\0000+\020\031\000\000\000\000\337+\020\031"
+ "\000\000\000\000\032,\375\030\000\000\000\000\255,\375\030\000\000\000\000"
+ "\326,k\031\000\000\000\000\316-\260\031\000\000\000\000\316-K\032\000\000"
+ "\000\000\306.\241\032\000\000\000\000\375/c\032\000\000\000\000Y0,\032\000"
+ "\000\000\000\0321c\032\000\000\000\000\3101\241\032\000\000\000\000\0372"
+ "\033\033\000\000\000\000m2K\033\000\000\000\000\3222\276\032\000\000\000"
+ "\000\2372\343\031\000\000\000\000m2\216\031\000\000\000\000\27124\031\000"
+ "\000\000\000\3222\264\030\000\000\000\000F2\077\030\000\000\000\000q1\370"
+ "\027\000\000\000\000\3101\237\027\000\000\000\000H1s\027\000\000\000\000"
+ "\0321r\026\000\000\000\000Y0T\026\000\000\000\000\264/\033\026\000\000\000"
+ "\000T/\033\026\000\000\000\000\306.\304\025\000\000\000\000\015/Q\025\000"
+ "\000\000\000J.\325\024\000\000\000\000\032,\325\024\000\000\000\000Y0\020"
+ "\033\000\000\000\000+0\244\033\000\000\000\000\217/\322\033\000\000\000\000"
+ "X/\211\034\000\000\000\000!/\257\035\000\000\000\000\351.\312\035\000\000"
+ "\000\000\253.\035\036\000\000\000\000\0310\213\036\000\000\000\000B0\376"
+ "\036\000\000\000\000\306/\207\037\000\000\000\000\217/\305 \000\000\000\000"
+ "z.\305 \000\000\000\000d,H!\000\000\000\000o-\360!\000\000\000\000G-L\042"
+ "\000\000\000\000d,\305\042\000\000\000\000\032,1#\000\000\000\000d,v#\000"
+ "\000\000\000\032,\357#\000\000\000\000o-4$\000\000\000\000\251-\321#\000"
+ "\000\000\000\011.4$\000\000\000\000\351-\334$\000\000\000\000\312.5%\000"
+ "\000\000\000\015/\241%\000\000\000\000\306.7&\000\000\000\000\353.\313&\000"
+ "\000\000\000\2310\032'\000\000\000\000\3331\032'\000\000\000\000F2\355'\000"
+ "\000\000\000\27120(\000\000\000\000\2372v(\000\000\000\000\0212\252(\000"
+ "\000\000\000\3331\035)\000\000\000\000\0372k)\000\000\000\000\1772k)\000"
+ "\000\000\000\2372\035)\000\000\000\000\25740)\000\000\000\000]5\244)\000"
+ "\000\000\000\3365G*\000\000\000\000^60*\000\000\000\000\2476\036+\000\000"
+ "\000\000D8\036+\000\000\000\000{8\327*\000\000\000\000\3309\036+\000\000"
+ "\000\000j:\373*\000\000\000\000\017;>+\000\000\000\000\342;\373*\000\000"
+ "\000\000\021=\250+\000\000\000\000\276;\015,\000\000\000\000z<\177,\000\000"
+ "\000\000z<\367,\000\000\000\000\034<7-\000\000\000\000\021=\203-\000\000"
+ "\000\000\332<\374-\000\000\000\000\276;\034.\000\000\000\000\276;\252.\000"
+ "\000\000\000\017;\252.\000\000\000\000\275:\224/\000\000\000\000j:\224/\000"
+ "\000\000\000\3309\0100\000\000\000\000\224:A0\000\000\000\000\275:\2610\000"
+ "\000\000\000\3309/1\000\000\000\000{8/1\000\000\000\000\0268O1\000\000\000"
+ "\000\0268\2551\000\000\000\000)9\3741\000\000\000\000)9V2\000\000\000\000"
+ "D8\2222\000\000\000\000\3408\0003\000\000\000\000\2507S3\000\000\000\000"
+ "v7\2703\000\000\000\000v7\0234\000\000\000\0006:O4\000\000\000\0006:05\000"
+ "\000\000\000\275:05\000\000\000\000\017;\2255\000\000\000\000\017;\3605\000"
+ "\000\000\000\346:\0256\000\000\000\0006:\0256\000\000\000\0006:B;\000\000"
+ "\000\0003EB;\000\000\000\0003E\313\077\000\000\000\000\0075k)\000\000\000"
+ "\000\3365\252(\000\000\000\000\3365\277'\000\000\000\000/5T'\000\000\000"
+ "\000]5\362&\000\000\000\000\2355\244&\000\000\000\000\3365\032&\000\000\000"
+ "\000\2036e&\000\000\000\000v7z%\000\000\000\000\3518\321#\000\000\000\000"
+ "\2419\210$\000\000\000\000\3309\022$\000\000\000\000\017;\003$\000\000\000"
+ "\000y;\022$\000\000\000\000\342;\230#\000\000\000\000\034<v#\000\000\000"
+ "\000K<m#\000\000\000\000g<B#\000\000\000\000\177=1#\000\000\000\000\322="
+ "\305\042\000\000\000\000\177=L\042\000\000\000\000\226<L\042\000\000\000"
+ "\000\226<~!\000\000\000\000g<'!\000\000\000\000\275:S!\000\000\000\000j:"
+ "q \000\000\000\000\224:\356\037\000\000\000\000\2419\356\037\000\000\000"
+ "\000{8\356\037\000\000\000\000{8\273\037\000\000\000\000\3518\207\037\000"
+ "\000\000\000E9\247\036\000\000\000\000\3518T\036\000\000\000\000\3518\312"
+ "\035\000\000\000\000\2507<\035\000\000\000\000v7\001\035\000\000\000\000"
+ "\2476\001\035\000\000\000\00006\251\034\000\000\000\000\2355\211\034\000"
+ "\000\000\000]5\251\034\000\000\000\000\1344e\034\000\000\000\000\0344\310"
+ "\033\000\000\000\000\1344h\033\000\000\000\000\0075\033\033\000\000\000\000"
+ "/5Q\032\000\000\000\000\3365\343\031\000\000\000\000\3475a\031\000\000\000"
+ "\000\20364\031\000\000\000\000\0167\007\031\000\000\000\000\2036z\030\000"
+ "\000\000\000]5z\030\000\000\000\000\1344\206\030\000\000\000\000\2124s\027"
+ "\000\000\000\000\0065\363\026\000\000\000\000\2065\334\026\000\000\000\000"
+ "}5c\026\000\000\000\000\3354\237\026\000\000\000\000\3354\033\026\000\000"
+ "\000\000<4\325\024\000\000\000\000\3222\313\023\000\000\000\000F2\213\023"
+ "\000\000\000\000\3331\253\023\000\000\000\000:1=\023\000\000\000\000:1\304"
+ "\022\000\000\000\000\3101\277\022\000\000\000\000\3101,\022\000\000\000\000"
+ "\0372,\022\000\000\000\000m2`\021\000\000\000\000\3101%\021\000\000\000\000"
+ "\2101\000\021\000\000\000\000\2710%\021\000\000\000\000\2070\251\020\000"
+ "\000\000\000\0321-\020\000\000\000\000\2400\221\017\000\000\000\000\3101"
+ "w\016\000\000\000\000\3052w\016\000\000\000\000$3\032\017\000\000\000\000"
+ "\2073V\017\000\000\000\000\2073w\016\000\000\000\000\2073\020\016\000\000"
+ "\000\000\3563W\013\000\000\000\000\3354\214\011\000\000\000\000\0335\303"
+ "\010\000\000\000\000\3605f\007\000\000\000\00056@\006\000\000\000\000\311"
+ "6\256\005\000\000\000\000v7\256\005\000\000\000\000\2177@\006\000\000\000"
+ "\000\0048\212\006\000\000\000\000\2628@\006\000\000\000\000[8\256\005\000"
+ "\000\000\000\2078\244\004\000\000\000\000\2628H\004\000\000\000\000\2059"
+ "H\004\000\000\000\000\005:\310\004\000\000\000\000\005:)\005\000\000\000"
+ "\000\2059e\006\000\000\000\000\2078f\007\000\000\000\000\2078K\010\000\000"
+ "\000\000\0069'\011\000\000\000\000\3068\026\012\000\000\000\000\2628\262"
+ "\012\000\000\000\000\3468)\013\000\000\000\000\3059)\013\000\000\000\000"
+ "\3059W\013\000\000\000\000j:\240\013\000\000\000\000\354;\375\014\000\000"
+ "\000\000Z<\324\015\000\000\000\000\277=w\016\000\000\000\000\277=\004\017"
+ "\000\000\000\000[>V\017\000\000\000\000\034\0778\017\000\000\000\000\367"
+ ">R\020\000\000\000\000\274>%\021\000\000\000\000\211>\223\021\000\000\000"
+ "\000\331>\341\021\000\000\000\000\211>,\022\000\000\000\000\211>\230\022"
+ "\000\000\000\000\210=\304\022\000\000\000\000\354;\026\023\000\000\000\000"
+ "\354;=\023\000\000\000\000\375:t\023\000\000\000\000\3148P\024\000\000\000"
+ "\000\3148\325\024\000\000\000\000\3518\026\025\000\000\000\000\20593\025"
+ "\000\000\000\000\0048\033\026\000\000\000\000\2177\363\026\000\000\000\000"
+ "I8\363\026\000\000\000\000[8J\027\000\000\000\000\0048\237\027\000\000\000"
+ "\000\0048\077\030\000\000\000\000I8\034\030\000\000\000\000q8z\030\000\000"
+ "\000\000\3148\206\030\000\000\000\000\3338\020\031\000\000\000\000/8\216"
+ "\031\000\000\000\000\2507a\031\000\000\000\000\030:\213\025\000\000\000\000"
+ "\375:\366\024\000\000\000\000t;\223\024\000\000\000\000\272<\016\024\000"
+ "\000\000\000\011>\253\023\000\000\000\000[>\313\023\000\000\000\000\201\077"
+ "\313\023\000\000\000\000\357\077\016\024\000\000\000\000\002A\335\023\000"
+ "\000\000\000\214A\253\023\000\000\000\000\237BP\024\000\000\000\000\004C"
+ "\302\024\000\000\000\000\262C\223\024\000\000\000\000\016D\325\024\000\000"
+ "\000\000iDP\024\000\000\000\000;D\016\024\000\000\000\000jE\016\024\000\000"
+ "\000\000\323D\253\023\000\000\000\000\323D=\023\000\000\000\000\340C=\023"
+ "\000\000\000\000[C\256\022\000\000\000\000[C,\022\000\000\000\000\004C\272"
+ "\021\000\000\000\000\004C%\021\000\000\000\000\321B\347\020\000\000\000\000"
+ "LB\000\021\000\000\000\000LBR\020\000\000\000\000\025B\221\017\000\000\000"
+ "\000\214A\221\017\000\000\000\000\214A\251\020\000\000\000\000GA\251\020"
+ "\000\000\000\000\002A-\020\000\000\000\000x@\251\020\000\000\000\000\275"
+ "@C\021\000\000\000\000\025B\134\021\000\000\000\000\214A\363\021\000\000"
+ "\000\000\270\077\363\021\000\000\000\000\270\077v\022\000\000\000\000\214"
+ "A\276\016\000\000\000\000iAw\016\000\000\000\000\370\077\375\014\000\000"
+ "\000\000\370\077\262\012\000\000\000\000\370\077H\004\000\000\000\000\320"
+ "AH\004\000\000\000\000/CH\004\000\000\000\000/C\262\012\000\000\000\000\374"
+ "D\227\377\000\000\000\000\274O\2726\000\000\000\000\274O\313\077\000\000"
+ "\000\000\364P\0256\000\000\000\000\364P05\000\000\000\000\004O\2774\000\000"
+ "\000\000\004OO4\000\000\000\000qN\0234\000\000\000\000qN\2053\000\000\000"
+ "\000NO)3\000\000\000\000rO\2562\000\000\000\000\374Ow2\000\000\000\000\004"
+ "O)2\000\000\000\000\015N\0312\000\000\000\000\214M\2551\000\000\000\000\214"
+ "M\1771\000\000\000\000KLO1\000\000\000\000/K/1\000\000\000\000/K\3600\000"
+ "\000\000\000\275K\3500\000\000\000\000\275K\316/\000\000\000\000\370J\224"
+ "/\000\000\000\000\275Kc.\000\000\000\000\370J\277-\000\000\000\000\354L\203"
+ "-\000\000\000\000\275K7-\000\000\000\000ZK\273,\000\000\000\000\214KH,\000"
+ "\000\000\000/K\250+\000\000\000\000%J_+\000\000\000\000%J\327*\000\000\000"
+ "\000\370J\247*\000\000\000\000\370Jy*\000\000\000\000SJG*\000\000\000\000"
+ "\252J\365)\000\000\000\000%Jk)\000\000\000\000\344H0*\000\000\000\000vH\365"
+ ")\000\000\000\000vH\244)\000\000\000\000\276GD)\000\000\000\000uG\252(\000"
+ "\000\000\000\320FD)\000\000\000\000OF\012)\000\000\000\000jE\012)\000\000"
+ "\000\000\036Ev(\000\000\000\000DE\017(\000\000\000\000\227D\277'\000\000"
+ "\000\000\227D\244&\000\000\000\000\340C\201&\000\000\000\000\227D\032&\000"
+ "\000\000\000\036E\032&\000\000\000\000\335E\241%\000\000\000\000\220F\241"
+ "%\000\000\000\000\335E\011%\000\000\000\000\017F\334$\000\000\000\000jEM"
+ "$\000\000\000\000jE\003$\000\000\000\000~E\321#\000\000\000\000\275Er#\000"
+ "\000\000\000\356D1#\000\000\000\000\004Cv#\000\000\000\000\321B\325#\000"
+ "\000\000\000GA\022$\000\000\000\000\201\077X#\000\000\000\000S\0771#\000"
+ "\000\000\000\256>1#\000\000\000\000r>\305\042\000\000\000\000\354L\027-\000"
+ "\000\000\000\225M\367,\000\000\000\000\225MH,\000\000\000\000\361MF,\000"
+ "\000\000\000\361M\370+\000\000\000\000\303M\332+\000\000\000\000qNQ+\000"
+ "\000\000\000\225M\023*\000\000\000\000\032N\315)\000\000\000\000\240OG*\000"
+ "\000\000\000\340O\360)\000\000\000\000\217P\012*\000\000\000\000\317Py*\000"
+ "\000\000\0005R\373*\000\000\000\000\032S\262*\000\000\000\000\032S`*\000"
+ "\000\000\000\077TB*\000\000\000\000\200T')\000\000\000\000\255Sk)\000\000"
+ "\000\000HSI)\000\000\000\000\365R\300(\000\000\000\000zSv(\000\000\000\000"
+ "HSB(\000\000\000\000\331Q\134(\000\000\000\0005R1'\000\000\000\000\247R\000"
+ "'\000\000\000\000\365R\222&\000\000\000\000\331Q\201&\000\000\000\000\257"
+ "P\032&\000\000\000\000\317P\241%\000\000\000\000\317PU%\000\000\000\000r"
+ "O\011%\000\000\000\000qN\225$\000\000\000\000\354L\225$\000\000\000\000\247"
+ "L\352#\000\000\000\000\354L\265#\000\000\000\000\035Lr#\000\000\000\000@"
+ "M\305\042\000\000\000\000\335N\373\042\000\000\000\000!P\033#\000\000\000"
+ "\000\317P\230#\000\000\000\000\202Q\241#\000\000\000\000gR:#\000\000\000"
+ "\000\365RZ#\000\000\000\000aS:#\000\000\000\000\200Tv#\000\000\000\000\200"
+ "T\325#\000\000\000\000wU\317$\000\000\000\000wUU%\000\000\000\000%U{%\000"
+ "\000\000\000/V\336%\000\000\000\000\347W\032&\000\000\000\000\237Yh%\000"
+ "\000\000\000\227Z1#\000\000\000\000\241[\373\042\000\000\000\000\242\134"
+ "\210\042\000\000\000\000\331\134\345!\000\000\000\000\365]\345!\000\000\000"
+ "\0005^\345!\000\000\000\000\032_L\042\000\000\000\000v_L\042\000\000\000"
+ "\000v_\251!\000\000\000\000H_\251!\000\000\000\000\250^0 \000\000\000\000"
+ "~^\356\037\000\000\000\000g]\017 \000\000\000\000\331\134\273\037\000\000"
+ "\000\000 ]\247\036\000\000\000\000\275\134\017\036\000\000\000\000!\134["
+ "\036\000\000\000\000\241[\312\035\000\000\000\000\305Z\203\035\000\000\000"
+ "\000\305Z<\035\000\000\000\000WZ<\035\000\000\000\000\350Y\203\035\000\000"
+ "\000\000\237Y\023\035\000\000\000\000UX\200\034\000\000\000\000\014X\033"
+ "\034\000\000\000\000\014XJ\027\000\000\000\000\216ZJ\027\000\000\000\000"
+ "WZ\313\077\000\000\000\000WZ\2179\000\000\000\000\300O(7\000\000\000\000"
+ "\015e\313\077\000\000\000\000\015e(7\000\000\000\000]b(7\000\000\000\000"
+ "\242]^5\000\000\000\000\242]P2\000\000\000\000c^\244)\000\000\000\000g]'"
+ ")\000\000\000\000\242]\367(\000\000\000\000 ]\252(\000\000\000\000\205]B"
+ "(\000\000\000\000\374\134\347'\000\000\000\000\331\134n'\000\000\000\000"
+ "\025^n'\000\000\000\0005^1'\000\000\000\000o\134\201&\000\000\000\000o\134"
+ "N&\000\000\000\000R]\032&\000\000\000\000R]\336%\000\000\000\000~^\336%\000"
+ "\000\000\000\266_\374%\000\000\000\000\266_\011%\000\000\000\000~^U%\000"
+ "\000\000\000~^\363$\000\000\000\000\242]\317$\000\000\000\000\242\134($\000"
+ "\000\000\000\275\134\317#\000\000\000\000@]\230#\000\000\000\000R]\340\042"
+ "\000\000\000\000\216Zt\023\000\000\000\000\035Wt\023\000\000\000\000\035"
+ "W\251\020\000\000\000\000\216Z\251\020\000\000\000\000\216Z=\002\000\000"
+ "\000\000\317EY\023\000\000\000\000\030F=\023\000\000\000\000\030Fb\022\000"
+ "\000\000\000\036Eo\021\000\000\000\000jE\022\021\000\000\000\000\030F\022"
+ "\021\000\000\000\000FFk\020\000\000\000\000\253FR\020\000\000\000\000FF\305"
+ "\017\000\000\000\000\253F\221\017\000\000\000\000\007G8\017\000\000\000\000"
+ "\265G8\017\000\000\000\000^G\276\016\000\000\000\000/F\020\016\000\000\000"
+ "\000jE\324\015\000\000\000\000DE\375\014\000\000\000\000/FW\013\000\000\000"
+ "\000\235Er\012\000\000\000\000/F\350\011\000\000\000\000\253F\024\010\000"
+ "\000\000\000\030F\257\007\000\000\000\000\030F&\007\000\000\000\000\233E"
+ "\323\006\000\000\000\000WE}\007\000\000\000\000yE\342\007\000\000\000\000"
+ "yEK\010\000\000\000\000\374DK\010\000\000\000\000jE'\011\000\000\000\000"
+ "\233Es\011\000\000\000\0003E\026\012\000\000\000\0003E\240\013\000\000\000"
+ "\000\374D\340\013\000\000\000\000\262C\355\012\000\000\000\000\217B@\013"
+ "\000\000\000\000\004C*\014\000\000\000\000\311Bi\015\000\000\000\000UB\324"
+ "\015\000\000\000\0006H-\017\000\000\000\0006H\221\017\000\000\000\000\365"
+ "G\305\017\000\000\000\000\321HR\020\000\000\000\000@I\013\020\000\000\000"
+ "\000eJ\035\020\000\000\000\000\256Jk\020\000\000\000\000\201K/\020\000\000"
+ "\000\000\302K\221\017\000\000\000\000&L-\017\000\000\000\000\225L-\017\000"
+ "\000\000\000\225L\311\014\000\000\000\000(Nd\012\000\000\000\000\340Od\012"
+ "\000\000\000\000\340OH\004\000\000\000\000cHH\004\000\000\000\000cH\032\004"
+ "\000\000\000\000\265G\032\004\000\000\000\000\212Gv\004\000\000\000\000\331"
+ "F\244\004\000\000\000\000\253FH\004\000\000\000\000^GP\003\000\000\000\000"
+ "\212Gk\002\000\000\000\0006H\230\001\000\000\000\000mI\363\000\000\000\000"
+ "\000\322I\216\000\000\000\000\000\000J\301\000\000\000\000\000\212JF\001"
+ "\000\000\000\000\212J\207\003\000\000\000\000\214M\207\003\000\000\000\000"
+ "\214MF\001\000\000\000\0000M\301\000\000\000\000\000\347L<\000\000\000\000"
+ "\000\214M(\377\000\000\000\000\372M(\377\000\000\000\000\372M\325\375\000"
+ "\000\000\0002O\325\375\000\000\000\0002Op\375\000\000\000\000\227Op\375\000"
+ "\000\000\000\227OK\374\000\000\000\000\340OK\374\000\000\000\000\220RK\374"
+ "\000\000\000\000\220R\256\372\000\000\000\000\025X(\377\000\000\000\000\025"
+ "X\325\375\000\000\000\000\372X\325\375\000\000\000\000\372X\256\372\000\000"
+ "\000\000WZ\256\372\000\000\000\000WZ\006\366\000\000\000\000\362Za\365\000"
+ "\000\000\000\205[a\365\000\000\000\000\205[r\351\000\000\000\000\261o(7\000"
+ "\000\000\000\261o\313\077\000\000\000\000\361o(7\000\000\000\000{pC6\000"
+ "\000\000\000{p\2425\000\000\000\000\255j\2074\000\000\000\000Xg\0255\000"
+ "\000\000\000\015e\3674\000\000\000\000\015e\2074\000\000\000\0002f\0234\000"
+ "\000\000\000Cd\370+\000\000\000\000\326d\332+\000\000\000\000\240e\370+\000"
+ "\000\000\0002f\332+\000\000\000\000\240f\370+\000\000\000\000\206g\370+\000"
+ "\000\000\000\006h\332+\000\000\000\000\006hQ+\000\000\000\000\023g\373*\000"
+ "\000\000\000\023g\272*\000\000\000\000\006h\262*\000\000\000\000=hy*\000"
+ "\000\000\000=h\033*\000\000\000\000\326d\315)\000\000\000\000\014d\261 \000"
+ "\000\000\000\270a\261 \000\000\000\000\266_\324\036\000\000\000\000c^5\036"
+ "\000\000\000\000\242]\205\036\000\000\000\000\042]5\036\000\000\000\000F"
+ "g\225\037\000\000\000\000\215g\247\036\000\000\000\000\330f]\036\000\000"
+ "\000\0002f[\036\000\000\000\000\251e\247\035\000\000\000\000\026e\312\035"
+ "\000\000\000\000\026eL\024\000\000\000\000$`L\024\000\000\000\000$`\231\015"
+ "\000\000\000\000\026e\231\015\000\000\000\000Lz\2222\000\000\000\000Lz\313"
+ "\077\000\000\000\000rq\2222\000\000\000\000rq\3771\000\000\000\000\374q\244"
+ "1\000\000\000\000\375r\2441\000\000\000\000}s\0321\000\000\000\000=s\207"
+ "0\000\000\000\000|r\2070\000\000\000\000(pY0\000\000\000\000\361o\0060\000"
+ "\000\000\000(p\242/\000\000\000\000\262pk/\000\000\000\000{p\375.\000\000"
+ "\000\000\262p\375.\000\000\000\000\340p\206.\000\000\000\000\267qX.\000\000"
+ "\000\000\375r\372-\000\000\000\000\007t\316-\000\000\000\000\007ti-\000\000"
+ "\000\000\202s2-\000\000\000\000=s\226,\000\000\000\000_sD,\000\000\000\000"
+ "Ns\332+\000\000\000\000\374q\373*\000\000\000\000KqQ+\000\000\000\000\267"
+ "q\332+\000\000\000\000\261o\332+\000\000\000\000\261o\367(\000\000\000\000"
+ "\325nB(\000\000\000\000yn\347'\000\000\000\000yn\331&\000\000\000\000\003"
+ "o\022%\000\000\000\000Co\374#\000\000\000\000\224m\373\042\000\000\000\000"
+ "\224m\210\042\000\000\000\000\345k\354 \000\000\000\000Qj0 \000\000\000\000"
+ "th\273\037\000\000\000\000=h\324\036\000\000\000\000\261oR$\000\000\000\000"
+ "\261o\374#\000\000\000\000\261oy\010\000\000\000\000\026ey\010\000\000\000"
+ "\000gz\374#\000\000\000\000gz\276\016\000\000\000\000\340q\276\016\000\000"
+ "\000\000\335ay\010\000\000\000\000\034a\324\007\000\000\000\000\034a\301"
+ "\000\000\000\000\000\014d\340\377\000\000\000\000\014d\233\371\000\000\000"
+ "\000\014d\323\344\000\000\000\000\014d\232\355\000\000\000\000\335a\232\355"
+ "\000\000\000\000\335a \364\000\000\000\000\034a\362\364\000\000\000\000\245"
+ "`\362\364\000\000\000\000I`a\365\000\000\000\000\034a\263\365\000\000\000"
+ "\000\034a\006\366\000\000\000\000\340`\264\366\000\000\000\000\034a\042\367"
+ "\000\000\000\000\376`\007\370\000\000\000\000w`\225\367\000\000\000\000m"
+ "_\225\367\000\000\000\000\032^\007\370\000\000\000\000\230\134\007\370\000"
+ "\000\000\000F\134\316\367\000\000\000\000\230\134\225\367\000\000\000\000"
+ "\230\134\353\366\000\000\000\000F\1343\366\000\000\000\000ob \364\000\000"
+ "\000\000\364bW\364\000\000\000\0000c;\364\000\000\000\000\022c\237\363\000"
+ "\000\000\000\225c_\363\000\000\000\000CdI\364\000\000\000\000\177d\264\366"
+ "\000\000\000\000\315dZ\370\000\000\000\000\324m\345\372\000\000\000\000\214"
+ "o\312\373\000\000\000\000\214o\340\377\000\000\000\000\340qC\376\000\000"
+ "\000\000LzC\376\000\000\000\000\377\177\350)\000\000\000\000\257x\210%\000"
+ "\000\000\000\377\177\272!\000\000\000\000\377\177\011'\000\000\000\000${"
+ "\011'\000\000\000\000\377\177{#\000\000\000\000\262|{#\000\000\000\000\377"
+ "\177C\376\000\000\000\000\001\2005\300\000\000\000\000\001\200\225\333\000"
+ "\000\000\000)\205\006\340\000\000\000\000)\2055\300\000\000\000\000)\205"
+ "I\357\000\000\000\000\001\200I\357\000\000\000\000\001\200\201\360\000\000"
+ "\000\000\024\202\024\361\000\000\000\000\024\202a\365\000\000\000\000)\205"
+ "a\365\000\000\000\000\005\206a\365\000\000\000\000\005\206\364\366\000\000"
+ "\000\000 \205\331\367\000\000\000\000\253\207\331\367\000\000\000\000'\203"
+ "c\341\000\000\000\000\001\200c\341\000\000\000\000\001\200\341\336\000\000"
+ "\000\000'\203\341\336\000\000\000\000\001\200\0255\000\000\000\000\001\200"
+ "\313\077\000\000\000\000\253\20700\000\000\000\000\253\207o.\000\000\000"
+ "\000\001\200\304)\000\000\000\000\253\207\011'\000\000\000\000\001\200\011"
+ "'\000\000\000\000\253\207{#\000\000\000\000\001\200{#\000\000\000\000\001"
+ "\200\374!\000\000\000\000\001\200C\376\000\000\000\000\253\207\324\022\000"
+ "\000\000\000)\205\324\022\000\000\000\000)\205\355\017\000\000\000\000\225"
+ "\203\355\017\000\000\000\000\225\2031\012\000\000\000\000\253\2071\012\000"
+ "\000\000\000\253\207C\376\000\000\000\000\026\205\313\077\000\000\000\000"
+ "\026\205\3221\000\000\000\000\254\207\343\367\000\000\000\000X\025\362,\000"
+ "\000\000\000{8\207\037\000\000\000\000\024by\010\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\001\000\001\000\002\000\002\000\003\000"
+ "\001\000\004\000\004\000\005\000\006\000\007\000\007\000\010\000\010\000"
+ "\011\000\011\000\012\000\012\000\013\000\013\000\014\000\014\000\015\000"
+ "\015\000\016\000\016\000\017\000\020\000\021\000\021\000\022\000\022\000"
+ "\023\000\023\000\024\000\024\000\025\000\025\000\026\000\026\000\027\000"
+ "\027\000\030\000\030\000\031\000\031\000\032\000\032\000\033\000\033\000"
+ "\034\000\034\000\035\000\035\000\036\000\037\000 \000\037\000!\000!\000\042"
+ "\000\042\000#\000#\000$\000$\000%\000%\000&\000&\000'\000'\000(\000(\000"
+ ")\000)\000*\000*\000+\000+\000,\000-\000.\000.\000/\000/\0000\0001\0002\000"
+ "3\0004\0004\0005\0005\0006\0006\0007\0007\0008\0008\0009\0009\000:\000:\000"
+ ";\000;\000<\000<\000=\000=\000>\000>\000\077\000\077\000@\000@\000A\0001"
+ "\000B\000B\000C\000C\000D\000D\000E\000E\000F\000F\000G\000G\000H\000H\000"
+ "I\000I\000J\000J\000K\000K\000L\000L\000M\000M\000N\000N\000O\000O\000P\000"
+ "P\000Q\000Q\000R\000R\000S\000S\000T\000T\000U\000U\000V\000V\000W\000W\000"
+ "X\000X\000Y\000Y\000Z\000Z\000[\000[\000\134\000\134\000]\000]\000^\000^"
+ "\000_\000_\000`\000`\000a\000b\000c\000c\000d\000d\000e\000f\000g\000g\000"
+ "h\000i\000h\000j\000k\000k\000l\000l\000m\000m\000n\000n\000o\000o\000p\000"
+ "p\000q\000q\000r\000r\000s\000s\000t\000t\000u\000u\000v\000v\000w\000w\000"
+ "x\000y\000z\000{\000|\000}\000~\000\177\000\200\000\200\000\201\000\201\000"
+ "\202\000\202\000\203\000\204\000\205\000\205\000\206\000\206\000|\000\207"
+ "\000\204\000\210\000\211\000\212\000\213\000\214\000\215\000\216\000\217"
+ "\000\217\000\220\000\220\000\221\000\221\000\222\000\222\000\223\000\224"
+ "\000\225\000\226\000\227\000\227\000\230\000\230\000\231\000\231\000\232"
+ "\000\232\000\233\000\233\000\234\000\234\000\235\000\235\000\236\000\236"
+ "\000\237\000\240\000\241\000\242\000\243\000\244\000\245\000\246\000\247"
+ "\000\250\000\251\000\252\000\253\000\253\000\254\000\254\000\255\000\255"
+ "\000\252\000\256\000\257\000\260\000\261\000\262\000\263\000\263\000\264"
+ "\000\264\000\261\000\265\000\266\000\266\000\267\000\267\000\270\000\271"
+ "\000\272\000\273\000\274\000\275\000\276\000\277\000\300\000\300\000\301"
+ "\000\301\000\302\000\302\000\303\000\303\000\304\000\305\000\306\000\306"
+ "\000\307\000\307\000\310\000\310\000\305\000\311\000\312\000\312\000\313"
+ "\000\313\000\304\000\314\000\315\000\315\000\316\000\316\000\317\000\317"
+ "\000\320\000z\000\321\000\321\000\322\000\322\000\323\000\323\000\324\000"
+ "\324\000\325\000\326\000\327\000\327\000\330\000\330\000\331\000\331\000"
+ "\326\000\332\000\333\000a\000\334\000\334\000\335\000\335\000\336\000\336"
+ "\000\337\000\337\000\340\000\340\000\341\000\341\000\342\000\342\000\343"
+ "\000\343\000\344\000\344\000\345\000\345\000\346\000\346\000\347\000\347"
+ "\000\350\000\350\000\351\000\351\000\352\000\352\000~\000\007\000\353\000"
+ "\353\000\354\000\354\000D\000\036\000\355\000\355\000\356\000\356\000\357"
+ "\000\357\000\360\000\360\000\361\000\361\000\362\000\362\000\363\000\363"
+ "\000\364\000\364\000\365\000\365\000\366\000\366\000\367\000\367\000\370"
+ "\000\370\000\371\000\371\000\372\000\372\000\373\000\373\000\374\000\374"
+ "\000\375\000\375\000\376\000\376\000\377\000\377\000\000\001\000\001\001"
+ "\001\001\001\002\001\002\001\003\001\003\001\004\001\004\001\005\001\005"
+ "\001\006\001\006\001\007\001\007\001\010\001\010\001\011\001\011\001\012"
+ "\001\012\001\013\001\013\001\014\001\014\001\015\001\015\001\016\001\016"
+ "\001\017\001\017\001\020\001\020\001\021\001\022\001\023\001\023\001\024"
+ "\001\024\001\025\001\025\001\026\001\026\001\027\001\027\001\203\000,\000"
+ "\030\001\030\001\031\001\031\001\032\001\032\001\033\001\033\001\034\001"
+ "\034\001\035\001\035\001\036\001\036\001\037\001\037\001 \001 \001!\001!"
+ "\001\042\001\042\001#\001#\001$\001$\001%\001%\001&\001&\001'\001'\001(\001"
+ "(\001)\001)\001*\001*\001+\001+\001,\001,\001-\001-\001.\001.\001/\001/\001"
+ "0\0010\001\211\0000\0001\0011\0012\0012\0013\0013\0014\0014\0015\0015\001"
+ "6\0016\0017\0017\0018\0018\0019\0019\001:\001:\001;\001;\001<\001<\001=\001"
+ "=\001>\001>\001\077\001\077\001@\001@\001A\001A\001B\001B\001C\001C\001D"
+ "\001D\001E\001E\001F\001F\001G\001G\001H\001H\001I\001J\001K\001K\001L\001"
+ "L\001M\001M\001N\001N\001O\001O\001P\001P\001Q\001Q\001R\001R\001S\001S\001"
+ "T\001T\001U\001U\001V\001V\001W\001W\001X\001X\001Y\001Y\001Z\001Z\001[\001"
+ "[\001\134\001\134\001]\001]\001^\001^\001_\001_\001`\001a\001b\001b\001c"
+ "\001c\001d\001d\001e\001e\001f\001f\001g\001g\001h\001h\001i\001i\001j\001"
+ "j\001k\001k\001l\001l\001m\001m\001n\001n\001o\001o\001p\001p\001q\001q\001"
+ "r\001r\001a\001`\001s\001s\001t\001t\001u\001u\001v\001v\001w\001w\001x\001"
+ "x\001y\001y\001z\001z\001{\001{\001|\001|\001}\001}\001~\001~\001\177\001"
+ "\177\001\200\001\200\001\201\001\201\001\202\001\202\001\203\001\203\001"
+ "\204\001\204\001\205\001\205\001\206\001\206\001\207\001\207\001\210\001"
+ "\210\001\211\001\211\001\212\001\212\001\213\001\213\001\214\001\214\001"
+ "\215\001\215\001\216\001\216\001\217\001\217\001\220\001\220\001\221\001"
+ "\221\001\222\001\222\001\223\001\223\001\224\001\224\001\225\001\225\001"
+ "\226\001\226\001\227\001\227\001\230\001\230\001\231\001\231\001\232\001"
+ "\232\001\233\001\233\001\234\001\234\001\235\001\235\001\236\001\236\001"
+ "\237\001\237\001\240\001\240\001\241\001\241\001\242\001\242\001\243\001"
+ "\243\001\244\001\244\001\245\001\245\001\246\001\246\001\247\001\247\001"
+ "\250\001\250\001\251\001\251\001\252\001\252\001\253\001\253\001\254\001"
+ "\254\001\255\001\255\001\256\001\256\001\257\001\257\001\260\001\260\001"
+ "\261\001\261\001\262\001\262\001\263\001\263\001\264\001\264\001\265\001"
+ "\265\001\266\001\266\001\267\001\267\001\270\001\270\001\271\001\271\001"
+ "\272\001\272\001\273\001\273\001\213\000\274\001\275\001\275\001\276\001"
+ "\276\001\277\001\277\001\300\001\300\001\301\001\301\001\302\001\302\001"
+ "\303\001\303\001\304\001\304\001\305\001\305\001\306\001\306\001\307\001"
+ "\307\001\310\001\310\001\311\001\311\001\312\001\312\001\313\001\313\001"
+ "\314\001\314\001\315\001\315\001\316\001\316\001\317\001\317\001\320\001"
+ "\320\001\321\001\321\001\322\001\322\001\323\001\323\001\324\001\324\001"
+ "\325\001\325\001\326\001\326\001\327\001\327\001\330\001\330\001\331\001"
+ "\331\001\332\001\332\001\333\001\333\001\334\001\334\001\335\001\335\001"
+ "\215\000\274\001\336\001\336\001\337\001\337\001\340\001\340\001\341\001"
+ "\341\001\342\001\342\001\343\001\343\001\344\001\344\001\345\001\345\001"
+ "\346\001\346\001\347\001\347\001\350\001\350\001\351\001\351\001\352\001"
+ "\352\001\353\001\354\001\355\001\355\001\356\001\356\001\357\001\357\001"
+ "\360\001\360\001\361\001\361\001\362\001\362\001\363\001\363\001\364\001"
+ "\364\001\365\001\365\001\366\001\366\001\367\001\367\001\370\001\370\001"
+ "\371\001\371\001\372\001\372\001\373\001\373\001\374\001\374\001\375\001"
+ "\375\001\376\001\376\001\377\001\377\001\000\002\000\002\001\002\001\002"
+ "\002\002\002\002\003\002\003\002\004\002\004\002\005\002\005\002\006\002"
+ "\006\002\007\002\007\002\010\002\010\002\011\002\011\002\012\002\012\002"
+ "\013\002\013\002\014\002\015\002\016\002\016\002\017\002\017\002\020\002"
+ "\020\002\021\002\021\002\022\002\022\002\023\002\023\002\024\002\024\002"
+ "\025\002\025\002\026\002\026\002\027\002\027\002\030\002\030\002\031\002"
+ "\031\002\032\002\032\002\033\002\033\002\034\002\034\002\035\002\035\002"
+ "\036\002\036\002\037\002\037\002 \002 \002!\002!\002\042\002\042\002#\002"
+ "#\002$\002$\002%\002%\002&\002&\002'\002(\002)\002)\002*\002*\002+\002+\002"
+ ",\002,\002-\002-\002.\002.\002/\002/\0020\0020\0021\0021\0022\0022\0023\002"
+ "3\0024\0024\0025\0025\0026\0026\0027\0027\0028\0028\0029\0029\002:\002\223"
+ "\000;\002;\002<\002<\002=\002=\002>\002>\002\077\002\077\002@\002@\002A\002"
+ "A\002B\002:\002C\002C\002D\002D\002E\002E\002F\002F\002G\002G\002H\002H\002"
+ "I\002I\002J\002J\002K\002K\002L\002L\002M\002M\0029\0010\000N\002N\002O\002"
+ "P\002Q\002R\002S\002S\002T\002T\002Q\002S\002U\002U\002V\002V\002W\002W\002"
+ "X\002Y\002Z\002Z\002[\002[\002\134\002\134\002]\002]\002^\002^\002_\002_"
+ "\002`\002`\002a\002a\002b\002b\002c\002c\002d\002d\002e\002e\002f\002f\002"
+ "g\002g\002h\002h\002i\002j\002k\002k\002l\002l\002m\002m\002n\002o\002p\002"
+ "q\002r\002r\002s\002s\002t\002t\002u\002u\002v\002v\002w\002w\002x\002x\002"
+ "y\002y\002z\002z\002{\002{\002|\002n\002}\002}\002~\002~\002\177\002\177"
+ "\002\200\002\200\002\201\002\201\002\202\002\202\002\203\002\203\002\225"
+ "\000\237\000\204\002\204\002\205\002\205\002\206\002\206\002\207\002\207"
+ "\002\210\002\210\002\211\002\211\002\212\002\212\002\213\002\213\002\214"
+ "\002\214\002\215\002\215\002\216\002\216\002\217\002\217\002\220\002\220"
+ "\002\221\002\221\002\222\002\222\002\223\002\223\002\224\002\224\002\225"
+ "\002\225\002\226\002\226\002\227\002\227\002\230\002\230\002\231\002\231"
+ "\002\232\002\232\002\233\002\233\002\234\002\234\002\235\002\235\002\236"
+ "\002\236\002|\002\234\002\237\002\237\002\240\002\240\002\241\002\241\002"
+ "\242\002\242\002\243\002\243\002\244\002\244\002\245\002\245\002\246\002"
+ "\246\002\247\002\247\002\250\002\250\002\251\002\251\002\252\002\252\002"
+ "\253\002\253\002\254\002\254\002\255\002\255\002\256\002\256\002\257\002"
+ "\257\002\260\002\260\002\261\002\261\002\262\002\262\002\263\002\263\002"
+ "\264\002\264\002\265\002\265\002\266\002\266\002\267\002\267\002\270\002"
+ "\270\002\271\002\271\002\272\002\272\002\273\002\273\002\274\002\274\002"
+ "\275\002\275\002\276\002\276\002\277\002\277\002\300\002\300\002\301\002"
+ "\301\002\302\002\302\002\303\002\303\002\304\002\304\002\305\002\305\002"
+ "\306\002\306\002\307\002\307\002\310\002\310\002\311\002\311\002\312\002"
+ "\312\002\313\002\313\002\314\002\314\002\315\002\315\002\316\002\316\002"
+ "\317\002\317\002\320\002\320\002\321\002\321\002\322\002\322\002\323\002"
+ "\323\002\324\002\324\002\325\002\325\002\326\002\326\002\327\002\327\002"
+ "\330\002\330\002\331\002\332\002\241\000\333\002\334\002\334\002\335\002"
+ "\335\002\336\002\336\002\337\002\337\002\340\002\340\002\341\002\341\002"
+ "\342\002\342\002\343\002\343\002\344\002\344\002\345\002\345\002\346\002"
+ "\346\002\347\002\347\002\350\002\350\002\351\002\351\002\352\002\352\002"
+ "\353\002\353\002\354\002\354\002\355\002\355\002\356\002\356\002\357\002"
+ "\357\002\360\002\360\002\361\002\361\002\362\002\363\002\364\002\364\002"
+ "\365\002\365\002\366\002\366\002\367\002\367\002\370\002\370\002\371\002"
+ "\371\002\372\002\372\002\373\002\373\002\374\002\374\002|\002\375\002\376"
+ "\002\376\002\377\002\377\002\000\003\000\003\001\003\001\003\002\003\002"
+ "\003\003\003\003\003\004\003\004\003\005\003\005\003\006\003\006\003\007"
+ "\003\007\003\010\003\010\003\011\003\011\003\012\003\012\003\013\003\013"
+ "\003\014\003\014\003\015\003\015\003\016\003\017\003\020\003\020\003\021"
+ "\003\021\003\022\003\022\003\023\003\023\003\024\003\024\003\025\003\025"
+ "\003\026\003\026\003\027\003\027\003\030\003\030\003\031\003\031\003\032"
+ "\003\032\003\033\003\033\003\034\003\034\003\035\003\035\003\036\003\036"
+ "\003\037\003\037\003 \003 \003!\003!\003\042\003\042\003#\003#\003$\003$"
+ "\003%\003%\003&\003&\003'\003'\003(\003(\003)\003)\003*\003*\003+\003+\003"
+ ",\003,\003-\003-\003.\003.\003/\003/\0030\0030\0031\0031\0032\0032\0033\003"
+ "3\0034\0034\0035\0035\0036\0036\0037\0037\0038\0038\0039\0039\003:\003:\003"
+ ";\003;\003<\003<\003=\003=\003>\003>\003\077\003\077\003@\003@\003A\003\022"
+ "\003B\003B\003C\003C\003D\003D\003E\003E\003F\003F\003G\003G\003H\003H\003"
+ "I\003I\003J\003J\003K\003K\003L\003L\003M\003M\003N\003N\003O\003O\003P\003"
+ "P\003Q\003Q\003R\003R\003S\003S\003T\003T\003U\003U\003V\003V\003W\003W\003"
+ "X\003X\003Y\003Y\003Z\003Z\003[\003[\003\134\003\134\003]\003]\003^\003^"
+ "\003_\003_\003`\003`\003a\003a\003b\003b\003c\003c\003d\003d\003e\003e\003"
+ "f\003f\003g\003g\003h\003h\003i\003i\003j\003j\003k\003k\003l\003l\003m\003"
+ "m\003n\003n\003o\003o\003p\003p\003q\003q\003r\003r\003s\003s\003t\003t\003"
+ "u\003u\003v\003v\003w\003w\003x\003x\003y\003y\003z\003z\003{\003{\003|\003"
+ "|\003}\003}\003~\003~\003\177\003\177\003\200\003\200\003\201\003\201\003"
+ "\202\003\202\003\203\003\203\003\204\003\204\003\205\003\205\003\206\003"
+ "\206\003\207\003\207\003\210\003\210\003\211\003\211\003\212\003\212\003"
+ "\213\003\213\003\214\003\214\003\215\003\215\003\216\003\216\003\217\003"
+ "\217\003\220\003\220\003\221\003\221\003\222\003\222\003\223\003\223\003"
+ "\224\003\224\003\225\003\225\003\226\003\226\003\227\003\227\003\230\003"
+ "\230\003\231\003\231\003\232\003\232\003\233\003\234\003\235\003\235\003"
+ "\236\003\236\003\237\003\237\003\240\003\240\003\241\003\241\003\242\003"
+ "\242\003\243\003\243\003\244\003\244\003\245\003\245\003\246\003\246\003"
+ "\247\003\247\003\250\003\250\003\251\003\251\003\252\003\252\003\253\003"
+ "\253\003\254\003\254\003\255\003\255\003\256\003\256\003\257\003\257\003"
+ "\260\003\260\003\261\003\261\003\262\003\262\003\263\003\263\003\264\003"
+ "\264\003\265\003\265\003\266\003\266\003\267\003\270\003\271\003\271\003"
+ "\272\003\272\003\273\003\273\003\274\003\274\003\275\003\275\003\276\003"
+ "\276\003\277\003\277\003\300\003\300\003\301\003\301\003\302\003\302\003"
+ "\303\003\303\003\304\003\304\003\305\003\305\003\306\003\306\003\307\003"
+ "\307\003\310\003\310\003\311\003\311\003\312\003\312\003\313\003\313\003"
+ "\314\003\314\003\315\003\315\003\316\003\316\003\317\003\317\003\243\000"
+ "\245\000\320\003\320\003\321\003\321\003\322\003\322\003\323\003\323\003"
+ "\324\003\324\003\325\003\325\003\326\003\326\003\327\003\330\003\331\003"
+ "\331\003\332\003\332\003\333\003\333\003\334\003\334\003\335\003\335\003"
+ "\336\003\336\003\337\003\337\003\340\003\340\003\341\003\341\003\342\003"
+ "\342\003\343\003\343\003\344\003\344\003\345\003\345\003\346\003\346\003"
+ "\347\003\347\003\350\003\350\003\351\003\351\003\352\003\352\003\353\003"
+ "\353\003\354\003\354\003\355\003\355\003\356\003\356\003\357\003\357\003"
+ "\360\003\360\003\361\003\361\003\362\003\362\003\363\003\363\003\364\003"
+ "\364\003\365\003\365\003\366\003\366\003\367\003\367\003\370\003\370\003"
+ "\371\003\371\003\372\003\372\003\373\003\374\003\375\003\375\003\376\003"
+ "\376\003\377\003\377\003\000\004\000\004\001\004\001\004\002\004\002\004"
+ "\003\004\003\004\004\004\004\004\005\004\005\004\006\004\006\004\007\004"
+ "\007\004\010\004\010\004\011\004\011\004\012\004\012\004\013\004\013\004"
+ "\014\004\014\004\015\004\015\004\016\004\016\004\017\004\017\004\020\004"
+ "\020\004\021\004\021\004\022\004\022\004\023\004\023\004\024\004\024\004"
+ "\025\004\025\004\026\004\026\004\027\004\027\004\030\004\030\004\031\004"
+ "\031\004\032\004\032\004\033\004\033\004\034\004\034\004\035\004\035\004"
+ "\036\004\036\004\037\004\037\004 \004 \004!\004!\004A\003\042\004#\004$\004"
+ "%\004&\004'\004'\004(\004(\004)\004)\004*\004#\004%\004+\004,\004,\004-\004"
+ ".\004/\004/\0040\0040\0041\0041\0042\0042\0043\0043\0044\0044\0045\0045\004"
+ "6\0046\0047\0047\0048\0048\0049\0049\004:\004:\004;\004;\004<\004<\004=\004"
+ "=\004>\004>\004\077\004\077\004@\004@\004A\004A\004B\004B\004C\004C\004D"
+ "\004D\004E\004E\004F\004F\004G\004G\004H\004H\004I\004I\004J\004J\004K\004"
+ "K\004L\004L\004M\004M\004N\004N\004O\004O\004P\004P\004Q\004Q\004R\004R\004"
+ "S\004S\004T\004T\004U\004U\004V\004V\004W\004W\004X\004X\004Y\004Y\004Z\004"
+ "Z\004[\004[\004\134\004\134\004]\004]\004^\004^\004_\004_\004`\004`\004a"
+ "\004a\004b\004b\004c\004c\004d\004d\004e\004e\004f\004f\004g\004g\004h\004"
+ "h\004i\004U\004j\004j\004k\004k\004l\004l\004m\004m\004n\004n\004o\004o\004"
+ "p\004p\004q\004q\004r\004r\004s\004s\004t\004t\004u\004u\004v\004v\004w\004"
+ "w\004x\004x\004y\004y\004z\004z\004{\004{\004|\004|\004}\004}\004~\004~\004"
+ "\177\004\177\004\200\004\200\004\201\004\201\004\202\004\202\004\203\004"
+ "\203\004\204\004\204\004\205\004\205\004\206\004\206\004\207\004\207\004"
+ "\210\004\210\004\211\004\211\004\212\004\212\004\213\004\213\004\214\004"
+ "\214\004\215\004\215\004\216\004\216\004\217\004\217\004\220\004\220\004"
+ "\221\004\221\004\222\004\222\004\223\004\223\004\224\004\224\004\225\004"
+ "\225\004\226\004\226\004\227\004\227\004\230\004\230\004\231\004\231\004"
+ "\232\004\232\004\233\004\234\004\235\004\235\004\236\004\236\004m\004A\003"
+ "\237\004\237\004\240\004\240\004\241\004\241\004\242\004\242\004\243\004"
+ "\243\004\244\004\244\004\245\004\245\004\246\004\246\004\247\004\247\004"
+ "\250\004\250\004\251\004\251\004\252\004\252\004\253\004\253\004\254\004"
+ "\254\004\255\004\255\004\256\004\256\004~\004\251\004\257\004\257\004\260"
+ "\004\260\004\261\004\261\004\262\004\262\004\263\004\263\004\264\004\264"
+ "\004\265\004\265\004\266\004\266\004\037\004\035\004\267\004\267\004\270"
+ "\004\270\004\271\004\271\004\272\004\272\004\273\004\273\004\274\004\274"
+ "\004\275\004\275\004\276\004\276\004\277\004\277\004\300\004\300\004\301"
+ "\004\302\004\303\004\303\004\304\004\304\004\305\004\305\004\306\004\306"
+ "\004\307\004\307\004\310\004\310\004\311\004\311\004\312\004\312\004\313"
+ "\004\313\004\314\004\314\004\315\004\315\004\316\004\316\004\317\004\317"
+ "\004\320\004\320\004\321\004\321\004\322\004\322\004\323\004\323\004\324"
+ "\004\324\004\325\004\325\004\326\004\326\004\327\004\327\004\330\004\330"
+ "\004\331\004\331\004\332\004\332\004\333\004\333\004\334\004\334\004\335"
+ "\004\335\004\336\004\336\004\337\004\337\004\340\004\340\004\341\004\341"
+ "\004\342\004\342\004\261\004\343\004\344\004\344\004\345\004\345\004\346"
+ "\004\346\004\347\004\347\004\350\004\350\004\351\004\351\004\352\004\352"
+ "\004\353\004\353\004\354\004\354\004\355\004\355\004\356\004\356\004\357"
+ "\004\357\004\360\004\360\004\361\004\247\000\361\004\362\004\363\004\363"
+ "\004\364\004\364\004\251\000\365\004\366\004\366\004\367\004\367\004\370"
+ "\004\370\004\312\004\371\004\372\004\372\004\373\004\373\004\374\004\374"
+ "\004\375\004\375\004\376\004\376\004\377\004\377\004\000\005\000\005\001"
+ "\005\001\005\002\005\002\005\003\005\003\005\004\005\004\005\005\005\005"
+ "\005\006\005\006\005\007\005\007\005\010\005\010\005\011\005\011\005\012"
+ "\005\012\005\013\005\013\005\014\005\014\005\015\005\015\005\016\005\016"
+ "\005\017\005\017\005\020\005\020\005\021\005\021\005\022\005\022\005\023"
+ "\005\023\005\024\005\024\005\025\005\025\005\026\005\026\005\027\005\027"
+ "\005\321\004\001\005\030\005\030\005\031\005\031\005\032\005\032\005\033"
+ "\005\033\005\034\005\034\005\035\005\035\005\036\005\036\005\037\005\037"
+ "\005 \005 \005!\005!\005\042\005\042\005#\005#\005$\005$\005%\005%\005&\005"
+ "&\005'\005'\005(\005(\005)\005)\005*\005*\005+\005+\005,\005,\005-\005-\005"
+ ".\005.\005/\005/\0050\0050\0051\0051\0052\0052\0053\0053\0054\0054\0055\005"
+ "5\0056\0056\0057\0057\0058\0058\0059\0059\005:\005:\005;\005;\005<\005<\005"
+ "=\005=\005>\005>\005\077\005\077\005@\005@\005A\005A\005B\005B\005C\005C"
+ "\005D\005D\005E\005E\005F\005F\005G\005G\005H\005H\005I\005I\005J\005J\005"
+ "K\005K\005L\005L\005M\005M\005N\005N\005O\005O\005P\005P\005Q\005Q\005R\005"
+ "R\005S\005S\005T\005T\005U\005U\005V\005V\005W\005W\005X\005X\005Y\005Y\005"
+ "Z\005Z\005[\005[\005\134\005\134\005]\005]\005^\005^\005_\005_\005`\005`"
+ "\005a\005a\005b\005b\005*\004b\005c\005c\005d\005d\005e\005e\005f\005f\005"
+ "g\005g\005h\005h\005i\005i\005j\005j\005k\005l\005m\005m\005n\005n\005o\005"
+ "o\005p\005p\005q\005q\005r\005r\005s\005s\005t\005t\005u\005u\005v\005v\005"
+ "w\005w\005x\005x\005y\005y\005z\005{\005|\005|\005}\005}\005~\005~\005\177"
+ "\005\177\005\200\005\200\005\201\005\201\005\202\005\202\005\203\005\203"
+ "\005\204\005\204\005\205\005\205\005\206\005\206\005\207\005\207\005\210"
+ "\005\210\005\211\005\211\005\212\005\212\005\213\005\213\005\214\005\214"
+ "\005\215\005\215\005\216\005\216\005\217\005\217\005\220\005\220\005\221"
+ "\005\221\005\222\005\222\005\223\005\223\005\224\005\224\005\225\005\225"
+ "\005\226\005\226\005\227\005\227\005\230\005\230\005\231\005\231\005\232"
+ "\005\232\005\233\005\233\005\234\005\234\005\235\005\235\005\236\005\236"
+ "\005\237\005\237\005\240\005\240\005\241\005\241\005\242\005\242\005\243"
+ "\005\243\005\244\005\244\005\245\005\245\005\246\005\246\005\247\005\247"
+ "\005\250\005\250\005\251\005\251\005\252\005\252\005\253\005\253\005\254"
+ "\005\254\005\255\005\255\005\256\005\256\005\257\005\257\005\260\005\260"
+ "\005\261\005\261\005\262\005\262\005\263\005\263\005\264\005\264\005\265"
+ "\005\265\005\266\005\266\005\267\005\267\005\270\005\270\005\271\005\271"
+ "\005\272\005\272\005\273\005\273\005\274\005\274\005\275\005\275\005\276"
+ "\005\276\005\277\005\277\005\300\005\300\005\301\005\301\005\302\005\302"
+ "\005\303\005\303\005\304\005\304\005\305\005\305\005\306\005\306\005\307"
+ "\005\307\005\310\005\310\005\311\005\311\005\312\005\312\005\313\005\313"
+ "\005\314\005\314\005\315\005\315\005\316\005\316\005\317\005\317\005\320"
+ "\005\320\005\321\005\321\005\322\005\322\005\323\005\323\005\324\005\324"
+ "\005\325\005\325\005\326\005\326\005\327\005\327\005\330\005\330\005\331"
+ "\005\331\005\332\005\332\005\333\005\333\005\334\005\334\005\335\005\335"
+ "\005\336\005\336\005\337\005\337\005\340\005\340\005\341\005\341\005\342"
+ "\005\342\005\343\005\343\005\344\005\344\005\345\005\345\005\346\005\346"
+ "\005\347\005\347\005\350\005\350\005\351\005\351\005\352\005\352\005\353"
+ "\005\353\005\354\005\354\005\355\005\355\005\356\005\356\005\357\005\357"
+ "\005\360\005\360\005\361\005\361\005\362\005\362\005\363\005\363\005\364"
+ "\005\364\005\365\005\365\005\234\005\351\005\366\005\366\005\367\005\367"
+ "\005\370\005\370\005\371\005\371\005\372\005\372\005\373\005\373\005\341"
+ "\005\373\005\374\005\374\005\375\005\375\005\376\005\376\005\377\005\377"
+ "\005\000\006\000\006\001\006\001\006\002\006\002\006\003\006\003\006\004"
+ "\006\004\006\005\006\005\006\006\006\006\006\007\006\007\006\010\006\010"
+ "\006\011\006\011\006\012\006\012\006\013\006\013\006\014\006\014\006\015"
+ "\006\015\006\016\006\016\006\017\006\017\006\020\006\020\006\021\006\021"
+ "\006\022\006\022\006\023\006\023\006\024\006\024\006\025\006\025\006\026"
+ "\006\026\006\027\006\027\006\030\006\030\006\031\006\031\006\032\006\032"
+ "\006\033\006\033\006\341\005\022\006\034\006\034\006\035\006\035\006\036"
+ "\006\036\006\037\006 \006!\006\042\006#\006#\006\037\006$\006!\006%\006&"
+ "\006%\006'\006'\006(\006(\006)\006)\006*\006*\006+\006+\006,\006,\006-\006"
+ "-\006.\006.\006/\006/\0060\0060\0061\0061\0062\0062\0063\0063\0064\0064\006"
+ "5\0065\0066\0066\0067\0067\0068\0068\0069\0069\006:\006:\006;\006;\006<\006"
+ "<\006=\006=\006>\006>\006\077\006\077\006@\006@\006A\006A\006B\006B\006C"
+ "\006C\006D\006D\006E\006E\006F\006F\006G\006G\006H\006H\006I\006I\006J\006"
+ "J\006K\006K\006L\006L\006M\006M\006N\006N\006O\006O\006P\006P\006Q\006Q\006"
+ "R\006R\006S\006S\006T\006T\006U\006U\006V\006V\006W\006W\006X\006X\006Y\006"
+ "Y\006Z\006Z\006[\006[\006\134\006\134\006]\006]\006^\006^\006_\006_\006`"
+ "\006`\006a\006a\006b\006b\006c\006c\006d\006d\006e\006e\006f\006f\006\177"
+ "\005<\006g\006g\006h\006h\006i\006i\006j\006j\006k\006k\006l\006l\006m\006"
+ "m\006n\006n\006o\006o\006p\006p\006q\006q\006r\006r\006s\006s\006t\006t\006"
+ "u\006u\006v\006v\006w\006w\006x\006x\006y\006y\006z\006z\006{\006{\006|\006"
+ "|\006}\006}\006~\006~\006\177\006\177\006\200\006\200\006\201\006\201\006"
+ "\202\006\202\006\203\006\203\006\204\006\204\006\205\006\205\006\206\006"
+ "\206\006\207\006\207\006\210\006\210\006\211\006\211\006\212\006\212\006"
+ "\213\006\213\006\214\006\214\006\215\006\215\006\216\006\216\006\217\006"
+ "\217\006\220\006\220\006\221\006\221\006\222\006\222\006\223\006\223\006"
+ "\224\006\224\006\225\006\225\006\226\006\226\006\227\006\227\006\230\006"
+ "\230\006\231\006\231\006\232\006\232\006\233\006\233\006\234\006\234\006"
+ "\235\006\235\006\236\006\236\006\237\006\237\006\240\006\240\006\241\006"
+ "\241\006\242\006\242\006\243\006\243\006\244\006\244\006\245\006\245\006"
+ "\246\006\246\006\247\006\247\006\250\006\250\006\251\006\251\006\252\006"
+ "\252\006\253\006\253\006\254\006\254\006\255\006\255\006\256\006\256\006"
+ "\257\006\257\006\260\006\260\006\261\006\261\006\262\006\262\006\263\006"
+ "\263\006\264\006\264\006\265\006\265\006\266\006\267\006\270\006\270\006"
+ "\271\006\272\006\273\006\273\006\274\006\274\006\275\006\275\006\276\006"
+ "\276\006\277\006\277\006\300\006\300\006\301\006\301\006\302\006\302\006"
+ "\303\006\303\006\304\006\304\006\305\006\305\006\306\006\306\006\307\006"
+ "\307\006\310\006\310\006\311\006\311\006\312\006\312\006\313\006\313\006"
+ "\314\006\314\006\315\006\315\006\316\006\316\006\317\006\317\006\320\006"
+ "\320\006\321\006\321\006\322\006\322\006\323\006\323\006\324\006\324\006"
+ "\325\006\325\006\236\006\266\006\326\006\326\006\327\006\327\006\330\006"
+ "\330\006\331\006\331\006\332\006\006\006\333\006\333\006\334\006\334\006"
+ "\335\006\335\006\336\006\336\006\337\006\337\006\340\006\340\006\341\006"
+ "\341\006\342\006\342\006\343\006\343\006\344\006\344\006\345\006\345\006"
+ "\346\006\346\006\347\006\347\006\350\006\350\006\351\006\351\006\352\006"
+ "\352\006\353\006\353\006\354\006\354\006\355\006\355\006\356\006\356\006"
+ "\357\006\357\006\360\006\360\006\361\006\361\006\362\006\362\006\363\006"
+ "\363\006\364\006\364\006\365\006\365\006\366\006\366\006\367\006\367\006"
+ "\370\006\370\006\371\006\371\006\372\006\372\006\373\006\373\006\374\006"
+ "\374\006\375\006\375\006\376\006\376\006\377\006\377\006\034\006\346\006"
+ "\000\007\000\007\001\007\001\007\002\007\002\007\003\007\003\007\004\007"
+ "\004\007\005\007\005\007\006\007\006\007\007\007\007\007\010\007\010\007"
+ "\011\007\011\007\012\007\012\007\013\007\013\007\014\007\014\007\015\007"
+ "\015\007\016\007\016\007\017\007\017\007\020\007\020\007\021\007\021\007"
+ "\022\007\022\007\023\007\023\007\024\007\024\007\025\007\025\007\026\007"
+ "\026\007\027\007\027\007\030\007\030\007\031\007\032\007\033\007\033\007"
+ "\034\007\034\007\035\007\035\007\036\007\036\007\037\007\037\007 \007 \007"
+ "!\007!\007\042\007\042\007#\007#\007$\007$\007%\007%\007&\007&\007'\007("
+ "\007)\007)\007*\007*\007\270\000\332\006+\007+\007,\007,\007-\007-\007.\007"
+ ".\007/\007/\0070\0070\0071\0071\0072\0072\0073\0073\007\272\0004\0075\007"
+ "6\0077\0077\0078\0078\0079\0079\007:\007:\007;\007;\007<\007<\007=\007=\007"
+ ">\007>\007\077\007\077\007@\007@\007A\007A\007B\007B\007C\007C\007D\007D"
+ "\007E\007E\007F\007F\007G\007G\007H\007H\007I\007I\007J\007J\007K\007K\007"
+ "L\007L\007M\007M\007N\007N\007O\007O\007P\007P\007Q\007Q\007\253\006L\007"
+ "R\007R\007S\007S\007T\007T\007U\007U\007V\007V\007W\007W\007X\007X\007Y\007"
+ "Y\007Z\007Z\007[\007\134\007]\007\134\007^\007^\007_\007_\007`\007`\007a"
+ "\007a\007b\007b\007c\007c\007d\007d\007e\007e\007f\007f\007g\007g\007h\007"
+ "h\007i\007i\007j\007j\007k\007k\007l\007l\007m\007m\007n\007n\007o\007o\007"
+ "p\007p\007q\007q\007r\007r\007s\007s\007t\007t\007u\007u\007v\007v\007w\007"
+ "w\007x\007x\007y\007y\007z\007z\007{\007{\007|\007|\007}\007}\007~\007~\007"
+ "\177\007\177\007\200\007\200\007\201\007\201\007\202\007\202\007\203\007"
+ "\203\007S\007}\007\204\007\204\007\205\007\206\007\207\007[\007\207\007\205"
+ "\007\210\007\210\007\211\007\211\007\212\007\213\007\214\007\214\007\215"
+ "\007\215\007\216\007\216\007\217\007\274\000\220\007\220\007\221\007\221"
+ "\007\222\007\222\007\223\007\223\007\224\007\224\007\225\007\225\007\226"
+ "\007\226\007\227\007\227\007\230\007\230\007\231\007\231\007\232\007\232"
+ "\007\233\007\233\007\234\007\234\007\235\007\235\007\236\007\236\007\237"
+ "\007\237\007\240\007\240\007\241\007\241\007\242\007\242\007\243\007\243"
+ "\0072\007\223\007\244\007\244\007\245\007\245\007\246\007\246\007\247\007"
+ "\247\007\250\007\250\007\251\007\251\007\252\007\252\007\253\007\253\007"
+ "\217\007\276\000\254\007\254\007\255\007\255\007\256\007\256\007\216\007"
+ "\212\007\257\007\257\007\260\007\261\007\262\007\262\007\263\007\264\007"
+ "\265\007\266\007\267\007\263\007\270\007\271\007\272\007\272\007\273\007"
+ "\273\007\274\007\273\007\275\007\275\007\276\007\276\007\277\007\277\007"
+ "\300\007\300\007\301\007\301\007\302\007\303\007\304\007\304\007\305\007"
+ "\305\007\306\007\307\007\310\007\311\007\312\007\312\007\307\007\313\007"
+ "\314\007\313\007\315\007\316\007\317\007\320\007\321\007\320\007\322\007"
+ "\322\007\323\007\324\007\325\007\326\007\327\007\327\007\330\007\330\007"
+ "\331\007\331\007\332\007\332\007\333\007\325\007\334\007\335\007\336\007"
+ "\316\007\315\007c\000\325\000h\000j\000u\000\337\007|\000\207\000\251\000"
+ "\362\004\261\000\262\000\311\000\260\007\304\000\311\000n\002o\002\034\003"
+ "\340\007-\004&\004%\004-\004*\004.\004\211\005\341\007\037\006 \006!\006"
+ "\042\006\205\007\206\007\207\007\342\007\275\007\302\007\302\007\303\007"
+ "\362\004\365\004\262\000$\006"
+;
+const unsigned long timezones_size = 28212;
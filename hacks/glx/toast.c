@@ -1,190 +1,89 @@
-/* Generated from "toast.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toast.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toast_data[] = {
-	0,-1,0,0.391859,-0.5,0.047937,
-	0,-1,0,-0.3866,-0.5,-0.047937,
-	0,-1,0,0.391859,-0.5,-0.047937,
-	0,-1,0,-0.3866,-0.5,-0.047937,
-	0,-1,0,0.391859,-0.5,0.047937,
-	0,-1,0,-0.3866,-0.5,0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,-0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,-0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,-0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,0.047937,
-	1,0,0,0.448134,0.061584,-0.047937,
-	1,0,0,0.448134,-0.426425,0.047937,
-	1,0,0,0.448134,-0.426425,-0.047937,
-	1,0,0,0.448134,-0.426425,0.047937,
-	1,0,0,0.448134,0.061584,-0.047937,
-	1,0,0,0.448134,0.061584,0.047937,
-	-0.951883,0.306462,0,-0.3866,0.438467,0.047937,
-	-0.978441,0.206528,0,-0.448134,0.247342,-0.047937,
-	-0.994654,0.103264,0,-0.448134,0.247342,0.047937,
-	-0.978441,0.206528,0,-0.448134,0.247342,-0.047937,
-	-0.951883,0.306462,0,-0.3866,0.438467,0.047937,
-	-0.951883,0.306462,0,-0.3866,0.438467,-0.047937,
-	-0.994654,0.103264,0,-0.448134,0.247342,0.047937,
-	-1,0,0,-0.448134,0.184705,-0.047937,
-	-1,0,0,-0.448134,0.184705,0.047937,
-	-1,0,0,-0.448134,0.184705,-0.047937,
-	-0.994654,0.103264,0,-0.448134,0.247342,0.047937,
-	-0.978441,0.206528,0,-0.448134,0.247342,-0.047937,
-	-0.306512,0.951867,0,-0.3866,0.438467,0.047937,
-	-0.206563,0.978433,0,-0.195512,0.5,-0.047937,
-	-0.306512,0.951867,0,-0.3866,0.438467,-0.047937,
-	-0.206563,0.978433,0,-0.195512,0.5,-0.047937,
-	-0.306512,0.951867,0,-0.3866,0.438467,0.047937,
-	-0.103281,0.994652,0,-0.195512,0.5,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	1,0,0,0.448134,0.184705,0.047937,
-	1,0,0,0.448134,0.184705,-0.047937,
-	1,0,0,0.448134,0.184705,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,-0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,0.047937,
-	0,0,-1,-0.3866,0.438467,-0.047937,
-	0,0,-1,-0.448134,0.184705,-0.047937,
-	0,0,-1,-0.448134,0.247342,-0.047937,
-	0,0,-1,-0.448134,0.184705,-0.047937,
-	0,0,-1,-0.3866,0.438467,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,0.448134,0.247342,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.384905,0.438467,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.448134,0.247342,-0.047937,
-	0,0,-1,0.448134,0.184705,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.448134,-0.426425,-0.047937,
-	0,0,-1,-0.448134,0.061584,-0.047937,
-	0,0,-1,-0.448134,-0.426425,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.3866,0.438467,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.3866,0.438467,-0.047937,
-	0,0,-1,-0.195512,0.5,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.195512,0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,-0.195512,0.5,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.384905,0.438467,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.448134,0.061584,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.448134,0.061584,-0.047937,
-	0,0,-1,0.448134,-0.426425,-0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,-0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,-0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,0.047937,
-	-0.103281,0.994652,0,-0.195512,0.5,0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	-0.206563,0.978433,0,-0.195512,0.5,-0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	-0.103281,0.994652,0,-0.195512,0.5,0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,-0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,-0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,-0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,0.047937,
-	-1,0,0,-0.448134,0.061584,0.047937,
-	-1,0,0,-0.448134,-0.426425,-0.047937,
-	-1,0,0,-0.448134,-0.426425,0.047937,
-	-1,0,0,-0.448134,-0.426425,-0.047937,
-	-1,0,0,-0.448134,0.061584,0.047937,
-	-1,0,0,-0.448134,0.061584,-0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,-0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,-0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,-0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,-0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,-0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,-0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,0.047937,
-	-0.746008,0.665937,0,-0.394142,0.122068,0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,-0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,-0.047937,
-	-0.746008,0.665937,0,-0.394142,0.122068,0.047937,
-	-0.746008,0.665937,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,-0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.448134,0.061584,0.047937,
-	0,0,1,-0.448134,-0.426425,0.047937,
-	0,0,1,-0.448134,0.061584,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.448134,0.247342,0.047937,
-	0,0,1,-0.448134,0.184705,0.047937,
-	0,0,1,-0.448134,0.247342,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.3866,0.438467,0.047937,
-	0,0,1,-0.3866,0.438467,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.3866,0.438467,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,-0.3866,0.438467,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,-0.195512,0.5,0.047937,
-	0,0,1,-0.195512,0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.384905,0.438467,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.448134,0.061584,0.047937,
-	0,0,1,0.448134,0.061584,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.448134,-0.426425,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.448134,0.247342,0.047937,
-	0,0,1,0.384905,0.438467,0.047937,
-	0,0,1,0.448134,0.247342,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.448134,0.184705,0.047937
-};
-static const struct gllist toast_frame = { GL_N3F_V3F, GL_TRIANGLES, 180, toast_data, 0 };
-const struct gllist *toast = &toast_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toast[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000X\000\000\000\264\000\000\000Z\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\001\2007Pd\001\200F\014\000"
+ "\000\011\235\001\200\272\363\000\000Pd\001\200\272\363\000\000\011\235\001"
+ "\200F\014\000\000\270r\327\222\272\363\000\000Pd\001\200F\014\000\000Pd\001"
+ "\200\272\363\000\000\270r\327\222F\014\000\000\270r\304\017\272\363\000\000"
+ "\270r\327\222F\014\000\000\270r\327\222\272\363\000\000\270r\304\017F\014"
+ "\000\000\011\235\077pF\014\000\000H\215Q\077\272\363\000\000H\215Q\077F\014"
+ "\000\000\011\235\077p\272\363\000\000H\215H/\272\363\000\000H\215H/F\014"
+ "\000\000\011\235\077pF\014\000\000\363\315\377\177\272\363\000\000\011\235"
+ "\077p\272\363\000\000\363\315\377\177F\014\000\000\270rQ\077\272\363\000"
+ "\000\270rH/F\014\000\000\270rH/\272\363\000\000\270rQ\077F\014\000\000\210"
+ "b\077p\272\363\000\000\210b\077pF\014\000\000\011\235\077p\272\363\000\000"
+ "H\215H/\272\363\000\000H\215Q\077\272\363\000\000\032\233@\037\272\363\000"
+ "\000\270rQ\077\272\363\000\000\210b@\037\272\363\000\000\210b\077p\272\363"
+ "\000\000\270rH/\272\363\000\000H\215\327\222\272\363\000\000H\215\304\017"
+ "\272\363\000\000\011\235\001\200\272\363\000\000\363\315\377\177\272\363"
+ "\000\000Pd\001\200\272\363\000\000w1\377\177\272\363\000\000\270r\304\017"
+ "\272\363\000\000\270r\327\222\272\363\000\000w1\377\177F\014\000\000\210"
+ "b\077p\272\363\000\000w1\377\177\272\363\000\000\210b\077pF\014\000\000\210"
+ "b@\037F\014\000\000\270r\304\017\272\363\000\000\210b@\037\272\363\000\000"
+ "\270r\304\017F\014\000\000H\215\304\017F\014\000\000H\215\327\222\272\363"
+ "\000\000H\215\327\222F\014\000\000H\215\304\017\272\363\000\000H\215\327"
+ "\222F\014\000\000\011\235\001\200\272\363\000\000\011\235\001\200F\014\000"
+ "\000H\215\327\222\272\363\000\000\270rH/F\014\000\000\210b@\037\272\363\000"
+ "\000\270rH/\272\363\000\000\210b@\037F\014\000\000\032\233@\037F\014\000"
+ "\000H\215\304\017\272\363\000\000H\215\304\017F\014\000\000\032\233@\037"
+ "\272\363\000\000H\215H/F\014\000\000\032\233@\037\272\363\000\000\032\233"
+ "@\037F\014\000\000H\215H/\272\363\000\000\011\235\001\200F\014\000\000H\215"
+ "\304\017F\014\000\000H\215\327\222F\014\000\000\032\233@\037F\014\000\000"
+ "H\215Q\077F\014\000\000H\215H/F\014\000\000\011\235\077pF\014\000\000Pd\001"
+ "\200F\014\000\000\363\315\377\177F\014\000\000w1\377\177F\014\000\000\210"
+ "b@\037F\014\000\000\210b\077pF\014\000\000\270r\304\017F\014\000\000\270"
+ "r\327\222F\014\000\000\270rQ\077F\014\000\000\270rH/F\014\000\000\000\201"
+ "\000\201\000\201\000\201H\311H\311H\311H\311\177\000\177\000\177\000\177"
+ "\000\240\037\227\026\215\014\240\037\201\000\201\000\341`\352i\341`\364s"
+ "s\014\177\000\177\000h\027_ _ \177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\026i\037`\014s\037`>A>A>A>A\201\000\201\000\201\000\201\000"
+ "\273\306\273\306\273\306\273\306\077\300\077\300\077\300\077\300\275<\275"
+ "<\275<\275<\274\305\274\305\274\305\274\305\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\001\000\002\000\001\000\000\000\003\000"
+ "\004\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000\012\000"
+ "\011\000\010\000\013\000\014\000\015\000\016\000\015\000\014\000\017\000"
+ "\016\000\020\000\021\000\020\000\016\000\015\000\022\000\023\000\024\000"
+ "\023\000\022\000\025\000\026\000\027\000\030\000\027\000\026\000\031\000"
+ "\032\000\031\000\026\000\031\000\032\000\033\000\034\000\035\000\036\000"
+ "\035\000\034\000\037\000 \000!\000\042\000!\000 \000#\000\037\000$\000%\000"
+ "$\000\037\000&\000&\000\037\000\034\000&\000\034\000'\000&\000'\000(\000"
+ "(\000'\000)\000(\000)\000!\000!\000)\000\042\000(\000!\000*\000(\000*\000"
+ "+\000,\000-\000.\000-\000,\000/\000\025\000.\000\023\000.\000\025\000,\000"
+ "0\0001\0002\0001\0000\0003\0004\0005\0006\0005\0004\0007\0008\0009\000:\000"
+ "9\0008\000;\000<\000=\000>\000=\000<\000\077\000@\000A\000B\000A\000@\000"
+ "C\000D\000E\000F\000E\000D\000G\000H\000I\000J\000I\000H\000K\000K\000L\000"
+ "M\000L\000K\000N\000N\000K\000H\000N\000H\000O\000N\000O\000P\000P\000O\000"
+ "Q\000Q\000O\000R\000Q\000R\000S\000R\000O\000T\000T\000O\000U\000R\000V\000"
+ "S\000V\000R\000W\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\000\000\004\000\002\000\004\000\004\000\007"
+ "\000\000\000\007\000\007\000\010\000\004\000\010\000\010\000\013\000\007"
+ "\000\013\000\014\000\015\000\015\000\016\000\014\000\016\000\014\000\017"
+ "\000\015\000\017\000\016\000\020\000\020\000\021\000\016\000\021\000\015"
+ "\000\020\000\014\000\023\000\017\000\023\000\014\000\025\000\023\000\025"
+ "\000\026\000\027\000\027\000\030\000\026\000\030\000\026\000\031\000\027"
+ "\000\031\000\031\000\032\000\026\000\032\000\032\000\033\000\031\000\033"
+ "\000\017\000\020\000\017\000\037\000\020\000\037\000\026\000!\000\032\000"
+ "!\000\030\000!\000\037\000$\000$\000%\000\037\000%\000\001\000\037\000\001"
+ "\000$\000\001\000\017\000\001\000\023\000\002\000\023\000\023\000)\000\002"
+ "\000)\000!\000)\000\002\000!\000\032\000)\000\010\000!\000\002\000\010\000"
+ "\032\000,\000)\000,\000\033\000,\000\025\000)\000\025\000,\000\010\0000\000"
+ "!\0000\000\013\0000\000$\0004\000$\0006\0004\0006\000%\0004\000\001\0006"
+ "\000\003\0006\000\027\000!\000\027\0000\000%\000@\0004\000@\000\037\000@"
+ "\000\021\000\037\000\021\000@\000\003\0004\000\003\000@\000\016\000@\000"
+ "\014\000@\000\003\000\014\000\000\000\014\000\000\000\025\000\000\000,\000"
+ "\000\0000\000,\0000\000\033\0000\000\000\000\013\000\031\0000\000"
+;
+const unsigned long toast_size = 1680;
@@ -1,214 +1,100 @@
-/* Generated from "toast2.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toast2.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toast2_data[] = {
-	-0.746008,0.665937,0,-0.394142,0.122068,0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,-0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,0.047937,
-	-0.746008,0.665937,0,-0.448134,0.061584,-0.047937,
-	-0.746008,0.665937,0,-0.394142,0.122068,0.047937,
-	-0.746008,0.665937,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,0.047937,
-	-0.757441,-0.652904,0,-0.394142,0.122068,-0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,0.047937,
-	-0.757441,-0.652904,0,-0.448134,0.184705,-0.047937,
-	0,0,-1,0.448134,0.247342,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.384905,0.438467,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.448134,0.247342,-0.047937,
-	0,0,-1,0.448134,0.184705,-0.047937,
-	0,0,-1,-0.233894,0.20122,-0.047937,
-	0,0,-1,-0.448134,0.184705,-0.047937,
-	0,0,-1,-0.448134,0.247342,-0.047937,
-	0,0,-1,-0.448134,0.184705,-0.047937,
-	0,0,-1,-0.233894,0.20122,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.233894,0.20122,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,-1,-0.233894,0.20122,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,-0.233894,0.20122,-0.047937,
-	0,0,-1,-0.092355,0.236111,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,-0.092355,0.236111,-0.047937,
-	0,0,-1,-0.001143,0.324361,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,-0.001143,0.324361,-0.047937,
-	0,0,-1,0.039021,0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.039021,0.5,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.193226,0.5,-0.047937,
-	0,0,-1,0.384905,0.438467,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.384905,0.122068,-0.047937,
-	0,0,-1,0.448134,0.061584,-0.047937,
-	0,0,-1,0.391859,-0.5,-0.047937,
-	0,0,-1,0.448134,0.061584,-0.047937,
-	0,0,-1,0.448134,-0.426425,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.448134,-0.426425,-0.047937,
-	0,0,-1,-0.448134,0.061584,-0.047937,
-	0,0,-1,-0.448134,-0.426425,-0.047937,
-	0,0,-1,-0.394142,0.122068,-0.047937,
-	0,0,-1,-0.3866,-0.5,-0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.448134,0.061584,0.047937,
-	0,0,1,-0.448134,-0.426425,0.047937,
-	0,0,1,-0.448134,0.061584,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.448134,0.247342,0.047937,
-	0,0,1,-0.448134,0.184705,0.047937,
-	0,0,1,-0.448134,0.247342,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.233894,0.20122,0.047937,
-	0,0,1,-0.233894,0.20122,0.047937,
-	0,0,1,-0.394142,0.122068,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,-0.233894,0.20122,0.047937,
-	0,0,1,-0.3866,-0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,-0.233894,0.20122,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,-0.092355,0.236111,0.047937,
-	0,0,1,-0.092355,0.236111,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,-0.001143,0.324361,0.047937,
-	0,0,1,-0.001143,0.324361,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.039021,0.5,0.047937,
-	0,0,1,0.039021,0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.193226,0.5,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.384905,0.438467,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.448134,0.061584,0.047937,
-	0,0,1,0.448134,0.061584,0.047937,
-	0,0,1,0.391859,-0.5,0.047937,
-	0,0,1,0.448134,-0.426425,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.448134,0.247342,0.047937,
-	0,0,1,0.384905,0.438467,0.047937,
-	0,0,1,0.448134,0.247342,0.047937,
-	0,0,1,0.384905,0.122068,0.047937,
-	0,0,1,0.448134,0.184705,0.047937,
-	0.210457,0.977603,0,-0.448134,0.247342,0.047937,
-	0.061931,0.99808,0,-0.233894,0.20122,-0.047937,
-	0.210457,0.977603,0,-0.448134,0.247342,-0.047937,
-	0.061931,0.99808,0,-0.233894,0.20122,-0.047937,
-	0.210457,0.977603,0,-0.448134,0.247342,0.047937,
-	-0.091493,0.995806,0,-0.233894,0.20122,0.047937,
-	-0.974837,0.222918,0,0.039021,0.5,0.047937,
-	-0.974837,0.222918,0,-0.001143,0.324361,-0.047937,
-	-0.974837,0.222918,0,-0.001143,0.324361,0.047937,
-	-0.974837,0.222918,0,-0.001143,0.324361,-0.047937,
-	-0.974837,0.222918,0,0.039021,0.5,0.047937,
-	-0.974837,0.222918,0,0.039021,0.5,-0.047937,
-	-0.091493,0.995806,0,-0.233894,0.20122,0.047937,
-	-0.239346,0.970934,0,-0.092355,0.236111,-0.047937,
-	0.061931,0.99808,0,-0.233894,0.20122,-0.047937,
-	-0.239346,0.970934,0,-0.092355,0.236111,-0.047937,
-	-0.091493,0.995806,0,-0.233894,0.20122,0.047937,
-	-0.239346,0.970934,0,-0.092355,0.236111,0.047937,
-	-0.695338,0.718683,0,-0.092355,0.236111,0.047937,
-	-0.695338,0.718683,0,-0.001143,0.324361,-0.047937,
-	-0.695338,0.718683,0,-0.092355,0.236111,-0.047937,
-	-0.695338,0.718683,0,-0.001143,0.324361,-0.047937,
-	-0.695338,0.718683,0,-0.092355,0.236111,0.047937,
-	-0.695338,0.718683,0,-0.001143,0.324361,0.047937,
-	-1,0,0,-0.448134,0.247342,0.047937,
-	-1,0,0,-0.448134,0.184705,-0.047937,
-	-1,0,0,-0.448134,0.184705,0.047937,
-	-1,0,0,-0.448134,0.184705,-0.047937,
-	-1,0,0,-0.448134,0.247342,0.047937,
-	-1,0,0,-0.448134,0.247342,-0.047937,
-	0,1,0,0.039021,0.5,0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	0,1,0,0.039021,0.5,-0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	0,1,0,0.039021,0.5,0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,-0.047937,
-	0.102986,0.994683,0,0.193226,0.5,-0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,-0.047937,
-	0.205973,0.978558,0,0.193226,0.5,0.047937,
-	0.305656,0.952142,0,0.384905,0.438467,0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,-0.047937,
-	0.949396,0.314082,0,0.384905,0.438467,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	1,0,0,0.448134,0.184705,0.047937,
-	1,0,0,0.448134,0.184705,-0.047937,
-	1,0,0,0.448134,0.184705,0.047937,
-	0.994378,0.105891,0,0.448134,0.247342,-0.047937,
-	0.977317,0.211783,0,0.448134,0.247342,0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,-0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,-0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,-0.047937,
-	0.703773,-0.710425,0,0.448134,0.184705,0.047937,
-	0.703773,-0.710425,0,0.384905,0.122068,0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,-0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,-0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,-0.047937,
-	0.691249,0.722617,0,0.384905,0.122068,0.047937,
-	0.691249,0.722617,0,0.448134,0.061584,0.047937,
-	1,0,0,0.448134,0.061584,-0.047937,
-	1,0,0,0.448134,-0.426425,0.047937,
-	1,0,0,0.448134,-0.426425,-0.047937,
-	1,0,0,0.448134,-0.426425,0.047937,
-	1,0,0,0.448134,0.061584,-0.047937,
-	1,0,0,0.448134,0.061584,0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,-0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,-0.047937,
-	0.794299,-0.607527,0,0.391859,-0.5,0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,-0.047937,
-	0.794299,-0.607527,0,0.448134,-0.426425,0.047937,
-	0,-1,0,0.391859,-0.5,0.047937,
-	0,-1,0,-0.3866,-0.5,-0.047937,
-	0,-1,0,0.391859,-0.5,-0.047937,
-	0,-1,0,-0.3866,-0.5,-0.047937,
-	0,-1,0,0.391859,-0.5,0.047937,
-	0,-1,0,-0.3866,-0.5,0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,-0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,0.047937,
-	-0.767086,-0.641544,0,-0.3866,-0.5,-0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,0.047937,
-	-0.767086,-0.641544,0,-0.448134,-0.426425,-0.047937,
-	-1,0,0,-0.448134,0.061584,0.047937,
-	-1,0,0,-0.448134,-0.426425,-0.047937,
-	-1,0,0,-0.448134,-0.426425,0.047937,
-	-1,0,0,-0.448134,-0.426425,-0.047937,
-	-1,0,0,-0.448134,0.061584,0.047937,
-	-1,0,0,-0.448134,0.061584,-0.047937
-};
-static const struct gllist toast2_frame = { GL_N3F_V3F, GL_TRIANGLES, 204, toast2_data, 0 };
-const struct gllist *toast2 = &toast2_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toast2[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000f\000\000\000\314\000\000\000f\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\001\2007\032\233@\037F\014\000"
+ "\000H\215\304\017\272\363\000\000H\215\304\017F\014\000\000\032\233@\037"
+ "\272\363\000\000H\215H/F\014\000\000\032\233@\037\272\363\000\000\032\233"
+ "@\037F\014\000\000H\215H/\272\363\000\000\270rQ\077\272\363\000\000\210b"
+ "@\037\272\363\000\000\210b\077p\272\363\000\000\270rH/\272\363\000\000 \304"
+ "\2033\272\363\000\000H\215H/\272\363\000\000H\215Q\077\272\363\000\000\032"
+ "\233@\037\272\363\000\000\011\235\001\200\272\363\000\000Pd\001\200\272\363"
+ "\000\000\134\350q<\272\363\000\000\265\377\011S\272\363\000\000\375\011\377"
+ "\177\272\363\000\000w1\377\177\272\363\000\000\270r\304\017\272\363\000\000"
+ "\270r\327\222\272\363\000\000H\215\327\222\272\363\000\000H\215\304\017\272"
+ "\363\000\000\011\235\001\200F\014\000\000H\215\304\017F\014\000\000H\215"
+ "\327\222F\014\000\000\032\233@\037F\014\000\000H\215Q\077F\014\000\000H\215"
+ "H/F\014\000\000 \304\2033F\014\000\000Pd\001\200F\014\000\000\134\350q<F"
+ "\014\000\000\265\377\011SF\014\000\000\375\011\377\177F\014\000\000w1\377"
+ "\177F\014\000\000\210b@\037F\014\000\000\210b\077pF\014\000\000\270r\304"
+ "\017F\014\000\000\270r\327\222F\014\000\000\270rQ\077F\014\000\000\270rH"
+ "/F\014\000\000H\215Q\077F\014\000\000 \304\2033\272\363\000\000H\215Q\077"
+ "\272\363\000\000 \304\2033F\014\000\000\375\011\377\177F\014\000\000\265"
+ "\377\011S\272\363\000\000\265\377\011SF\014\000\000\375\011\377\177\272\363"
+ "\000\000\134\350q<\272\363\000\000\134\350q<F\014\000\000\134\350q<F\014"
+ "\000\000\265\377\011S\272\363\000\000\134\350q<\272\363\000\000\265\377\011"
+ "SF\014\000\000H\215Q\077F\014\000\000H\215H/\272\363\000\000H\215H/F\014"
+ "\000\000H\215Q\077\272\363\000\000\375\011\377\177F\014\000\000w1\377\177"
+ "\272\363\000\000\375\011\377\177\272\363\000\000w1\377\177F\014\000\000\210"
+ "b\077p\272\363\000\000\210b\077pF\014\000\000\210b\077p\272\363\000\000\270"
+ "rQ\077F\014\000\000\270rQ\077\272\363\000\000\210b\077pF\014\000\000\270"
+ "rH/F\014\000\000\270rH/\272\363\000\000\270rH/F\014\000\000\210b@\037\272"
+ "\363\000\000\270rH/\272\363\000\000\210b@\037F\014\000\000\210b@\037F\014"
+ "\000\000\270r\304\017\272\363\000\000\210b@\037\272\363\000\000\270r\304"
+ "\017F\014\000\000\270r\304\017\272\363\000\000\270r\327\222F\014\000\000"
+ "\270r\327\222\272\363\000\000\270r\304\017F\014\000\000\270r\327\222\272"
+ "\363\000\000Pd\001\200F\014\000\000Pd\001\200\272\363\000\000\270r\327\222"
+ "F\014\000\000Pd\001\200F\014\000\000\011\235\001\200\272\363\000\000Pd\001"
+ "\200\272\363\000\000\011\235\001\200F\014\000\000H\215\327\222F\014\000\000"
+ "\011\235\001\200\272\363\000\000\011\235\001\200F\014\000\000H\215\327\222"
+ "\272\363\000\000H\215\304\017F\014\000\000H\215\327\222\272\363\000\000H"
+ "\215\327\222F\014\000\000H\215\304\017\272\363\000\000\275<\275<\275<\275"
+ "<\274\305\274\305\274\305\274\305\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\026i\007x\026i\365t\231\030\231\030\231"
+ "\030\231\030\347f\347f\302A\302A\302A\302A\201\000\201\000\201\000\201\000"
+ "\000\177\014s\000\177\026i\037`\037`_ h\027s\014_ \177\000\177\000\077\300"
+ "\077\300\077\300\077\300>A>A>A>A\177\000\177\000\177\000\177\000H\311H\311"
+ "H\311H\311\000\201\000\201\000\201\000\201\273\306\273\306\273\306\273\306"
+ "\201\000\201\000\201\000\201\000\000\000\001\000\002\000\001\000\000\000"
+ "\003\000\004\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000"
+ "\012\000\011\000\010\000\013\000\014\000\015\000\016\000\015\000\014\000"
+ "\017\000\017\000\014\000\020\000\020\000\014\000\021\000\021\000\014\000"
+ "\022\000\021\000\022\000\023\000\021\000\023\000\024\000\021\000\024\000"
+ "\025\000\021\000\025\000\011\000\011\000\025\000\012\000\021\000\011\000"
+ "\026\000\021\000\026\000\027\000\017\000\030\000\031\000\030\000\017\000"
+ "\020\000\032\000\033\000\034\000\033\000\032\000\035\000\035\000\036\000"
+ "\037\000\036\000\035\000 \000 \000\035\000\032\000 \000\032\000!\000 \000"
+ "!\000\042\000\042\000!\000#\000#\000!\000$\000$\000!\000%\000%\000!\000&"
+ "\000%\000&\000'\000&\000!\000(\000(\000!\000)\000&\000*\000'\000*\000&\000"
+ "+\000,\000-\000.\000-\000,\000/\0000\0001\0002\0001\0000\0003\000/\0004\000"
+ "-\0004\000/\0005\0006\0007\0008\0007\0006\0009\000:\000;\000<\000;\000:\000"
+ "=\000>\000\077\000@\000\077\000>\000A\000A\000B\000\077\000B\000A\000C\000"
+ "D\000E\000F\000E\000D\000G\000F\000H\000I\000H\000F\000E\000J\000K\000L\000"
+ "K\000J\000M\000N\000O\000P\000O\000N\000Q\000R\000S\000T\000S\000R\000U\000"
+ "V\000W\000X\000W\000V\000Y\000Z\000[\000\134\000[\000Z\000]\000^\000_\000"
+ "`\000_\000^\000a\000b\000c\000d\000c\000b\000e\000\000\000\001\000\001\000"
+ "\002\000\000\000\002\000\000\000\003\000\001\000\003\000\003\000\004\000"
+ "\000\000\004\000\004\000\007\000\003\000\007\000\010\000\011\000\011\000"
+ "\012\000\010\000\012\000\010\000\013\000\011\000\013\000\007\000\014\000"
+ "\007\000\016\000\014\000\016\000\003\000\014\000\014\000\020\000\003\000"
+ "\020\000\014\000\021\000\020\000\021\000\014\000\022\000\021\000\022\000"
+ "\022\000\023\000\021\000\023\000\023\000\024\000\021\000\024\000\024\000"
+ "\025\000\021\000\025\000\011\000\025\000\011\000\021\000\012\000\025\000"
+ "\011\000\026\000\021\000\026\000\026\000\027\000\021\000\027\000\003\000"
+ "\030\000\001\000\030\000\020\000\030\000\002\000\032\000\002\000\034\000"
+ "\032\000\034\000\000\000\032\000\000\000\036\000\004\000\036\000\000\000"
+ " \000\036\000 \000\032\000 \000\032\000!\000 \000!\000!\000\042\000 \000"
+ "\042\000!\000#\000\042\000#\000!\000$\000#\000$\000!\000%\000$\000%\000!"
+ "\000&\000%\000&\000&\000'\000%\000'\000!\000(\000&\000(\000!\000)\000(\000"
+ ")\000&\000*\000'\000*\000&\000+\000*\000+\000\014\000\036\000\016\000\036"
+ "\000\014\000 \000\023\000$\000\023\000#\000\024\000$\000\022\000 \000\022"
+ "\000\042\000\023\000\042\000\007\000\036\000\025\000$\000\025\000%\000\012"
+ "\000%\000\012\000'\000\012\000*\000\010\000*\000\010\000+\000\013\000+\000"
+ "\011\000+\000\011\000&\000\026\000&\000\026\000(\000\026\000)\000\027\000"
+ ")\000\027\000!\000\021\000!\000\020\000!\000\020\000\032\000\020\000\034"
+ "\000\030\000\034\000\002\000\030\000"
+;
+const unsigned long toast2_size = 1916;
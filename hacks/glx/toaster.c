@@ -1,376 +1,159 @@
-/* Generated from "toaster.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_data[] = {
-	-0.316307,-0.948657,0,-0.283103,-0.467335,0.222248,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	-0.194699,-0.980863,0,-0.234168,-0.483652,0.222248,
-	-0.015849,0.992717,0.119421,-0.001224,0.5,0.222248,
-	-0.130021,0.991469,-0.009119,-0.234168,0.483652,-0.380912,
-	-0.197233,0.97209,0.127042,-0.234168,0.483652,0.222248,
-	-0.104394,-0.808168,0.579627,-0.17891,-0.455225,0.279296,
-	-0.132836,-0.912766,0.386282,-0.234168,-0.483652,0.222248,
-	-0.012111,-0.87373,0.486261,-0.001224,-0.5,0.222248,
-	-0.999999,0,-0.001399,-0.345926,0,-0.380912,
-	-0.974495,-0.224383,-0.003566,-0.299415,-0.418387,-0.380912,
-	-0.996185,-0.087205,0.003347,-0.331315,-0.208938,0.222248,
-	0.996185,0.087205,0.003347,0.331315,0.208938,0.222248,
-	0.996185,-0.087205,0.003347,0.331315,-0.208938,0.222248,
-	0.999999,0,-0.001399,0.345926,0,-0.380912,
-	-0.000242,0.999959,-0.009047,-0.001224,0.5,0.222248,
-	0.129779,0.991501,-0.009119,0.234168,0.483652,-0.380912,
-	-0.130021,0.991469,-0.009119,-0.234168,0.483652,-0.380912,
-	-0.154648,-0.973224,0.170058,-0.234168,-0.483652,0.222248,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	-0.010495,-0.997502,0.069855,-0.001224,-0.5,0.222248,
-	0.967433,0.253065,0.005626,0.292931,0.437844,-0.141156,
-	0.965122,0.261801,0,0.299415,0.418387,0.222248,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.965122,0.261801,0,0.299415,0.418387,0.222248,
-	0.967433,0.253065,0.005626,0.292931,0.437844,-0.141156,
-	0.977686,0.209863,0.009409,0.283103,0.467335,0.222248,
-	0.977686,0.209863,0.009409,0.283103,0.467335,0.222248,
-	0.967433,0.253065,0.005626,0.292931,0.437844,-0.141156,
-	0.977686,0.209863,0.009409,0.288017,0.45259,0.040546,
-	0.316307,0.948657,0,0.283103,0.467335,0.222248,
-	0.316307,0.948657,0,0.283103,0.467335,-0.380912,
-	0.235633,0.971842,0,0.234168,0.483652,0.222248,
-	0.94871,0.316149,-0,0.283103,0.467335,-0.380912,
-	0.967433,0.253065,0.005626,0.292931,0.437844,-0.141156,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.967433,0.253065,0.005626,0.292931,0.437844,-0.141156,
-	0.94871,0.316149,-0,0.283103,0.467335,-0.380912,
-	0.977686,0.209863,0.009409,0.288017,0.45259,0.040546,
-	0.977686,0.209863,0.009409,0.288017,0.45259,0.040546,
-	0.94871,0.316149,-0,0.283103,0.467335,-0.380912,
-	0.977686,0.209863,0.009409,0.283103,0.467335,0.222248,
-	0,0.227898,0.973685,0.054097,0.251982,0.357142,
-	0,0.227898,0.973685,-0.054097,0.251982,0.357142,
-	0,-0,1,0.05339,0,0.380912,
-	-0.743012,0.091749,0.66296,-0.257344,0.251982,0.320299,
-	-0.817604,0.124528,0.562153,-0.31207,0.335293,0.222248,
-	-0.809725,0.0624,0.583482,-0.331315,0.208938,0.222248,
-	-0.817604,0.124528,0.562153,-0.31207,0.335293,0.222248,
-	-0.743012,0.091749,0.66296,-0.257344,0.251982,0.320299,
-	-0.680969,0.208836,0.701903,-0.299415,0.418387,0.222248,
-	0,0,1,-0.31207,0.335293,0.222248,
-	0,0,1,-0.299415,0.418387,0.222248,
-	0,0,1,-0.305628,0.377591,0.222248,
-	0.490312,-0.197001,0.84899,0.257344,-0.251982,0.320299,
-	0.439235,-0,0.898372,0.166895,0,0.380912,
-	0.369417,-0.202622,0.906904,0.166895,-0.251982,0.357142,
-	0.479243,0.170617,0.860939,0.257344,0.251982,0.320299,
-	0.344013,0.237244,0.908499,0.166895,0.251982,0.357142,
-	0.439235,-0,0.898372,0.166895,0,0.380912,
-	0.806304,-0.04159,0.590037,0.331315,-0.208938,0.222248,
-	0.743012,0.091749,0.66296,0.257344,0.251982,0.320299,
-	0.726863,-0.090005,0.680859,0.257344,-0.251982,0.320299,
-	0.743012,0.091749,0.66296,0.257344,0.251982,0.320299,
-	0.806304,-0.04159,0.590037,0.331315,-0.208938,0.222248,
-	0.809725,0.062401,0.583482,0.331315,0.208938,0.222248,
-	0,-0,1,0.05339,0,0.380912,
-	0,0.227898,0.973685,-0.054097,0.251982,0.357142,
-	0,-0,1,-0.05339,0,0.380912,
-	-0.988599,0.150571,-0,-0.31207,0.335293,0.222248,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.996185,0.087204,0.003347,-0.331315,0.208938,0.222248,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.988599,0.150571,-0,-0.31207,0.335293,0.222248,
-	-0.988599,0.150572,-0,-0.305628,0.377591,0.222248,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.988599,0.150572,-0,-0.305628,0.377591,0.222248,
-	-0.965122,0.261802,0,-0.299415,0.418387,0.222248,
-	-0.594501,-0.161247,0.787761,-0.257344,-0.251982,0.320299,
-	-0.757873,-0.17819,0.627596,-0.299415,-0.418387,0.222248,
-	-0.563931,-0.285379,0.774946,-0.283103,-0.467335,0.222248,
-	-0.191789,-0.715866,0.671382,-0.17891,-0.455225,0.279296,
-	-0.34735,-0.55882,0.753039,-0.283103,-0.467335,0.222248,
-	-0.156515,-0.815104,0.55777,-0.234168,-0.483652,0.222248,
-	-0.353973,-0.479978,0.802698,-0.17891,-0.455225,0.279296,
-	-0.490312,-0.197001,0.84899,-0.257344,-0.251982,0.320299,
-	-0.476561,-0.458788,0.749935,-0.283103,-0.467335,0.222248,
-	-0.965122,0.261802,0,-0.299415,0.418387,0.222248,
-	-0.94871,0.316149,0,-0.286127,0.45826,0.110422,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.94871,0.316149,0,-0.286127,0.45826,0.110422,
-	-0.965122,0.261802,0,-0.299415,0.418387,0.222248,
-	-0.948709,0.316149,0,-0.283103,0.467335,0.222248,
-	0.812952,-0.581784,0.025229,-0.286127,0.45826,0.110422,
-	0.812952,-0.581784,0.025229,-0.283103,0.467335,0.222248,
-	0.812952,-0.581784,0.025229,-0.285423,0.460375,0.136473,
-	-0.94871,0.316149,0,-0.286127,0.45826,0.110422,
-	-0.94871,0.316149,-0,-0.283103,0.467335,-0.380912,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.94871,0.316149,-0,-0.283103,0.467335,-0.380912,
-	-0.94871,0.316149,0,-0.286127,0.45826,0.110422,
-	-0.94871,0.316149,-0,-0.285423,0.460375,0.136473,
-	-0.94871,0.316149,-0,-0.283103,0.467335,-0.380912,
-	-0.94871,0.316149,-0,-0.285423,0.460375,0.136473,
-	-0.948709,0.316149,0,-0.283103,0.467335,0.222248,
-	-0.38567,0.427053,0.817853,-0.231791,0.418387,0.27573,
-	-0.241461,0.701279,0.670749,-0.234168,0.483652,0.222248,
-	-0.205338,0.615841,0.760642,-0.283103,0.467335,0.222248,
-	0,0.78664,0.617411,0.054097,0.455225,0.279296,
-	-0.000123,0.822299,0.569056,-0.001224,0.5,0.222248,
-	0,0.78664,0.617411,-0.054097,0.455225,0.279296,
-	0,-0.78664,0.617411,0.054097,-0.455225,0.279296,
-	0,-0.78664,0.617411,-0.054097,-0.455225,0.279296,
-	-0.000123,-0.822299,0.569056,-0.001224,-0.5,0.222248,
-	0,-0.664991,0.746852,-0.054097,-0.455225,0.279296,
-	0,-0.593633,0.804736,0.054097,-0.455225,0.279296,
-	0,-0.357681,0.933844,0,-0.455225,0.279296,
-	0,-0.357681,0.933844,0,-0.455225,0.279296,
-	0,-0.254425,0.967093,-0.054097,-0.251982,0.357142,
-	0,-0.357681,0.933844,-0.054097,-0.455225,0.279296,
-	0,-0.254425,0.967093,-0.054097,-0.251982,0.357142,
-	0,-0.357681,0.933844,0,-0.455225,0.279296,
-	0,-0.357681,0.933844,0.054097,-0.455225,0.279296,
-	-0.369417,-0.202622,0.906904,-0.166895,-0.251982,0.357142,
-	-0.490312,-0.197001,0.84899,-0.257344,-0.251982,0.320299,
-	-0.390635,-0.324541,0.861439,-0.17891,-0.455225,0.279296,
-	0,0.78664,0.617411,-0.054097,0.455225,0.279296,
-	-0.000123,0.822299,0.569056,-0.001224,0.5,0.222248,
-	-0.171632,0.762512,0.623793,-0.17891,0.455225,0.279296,
-	-0.42641,0.391747,0.815297,-0.231791,0.418387,0.27573,
-	-0.680969,0.208836,0.701903,-0.299415,0.418387,0.222248,
-	-0.662215,0.119119,0.739785,-0.257344,0.251982,0.320299,
-	0.476561,-0.458788,0.749935,0.283103,-0.467335,0.222248,
-	0.490312,-0.197001,0.84899,0.257344,-0.251982,0.320299,
-	0.353972,-0.479978,0.802698,0.17891,-0.455225,0.279296,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.988599,0.150572,0,0.318731,0.29156,0.222248,
-	0.996185,0.087205,0.003347,0.331315,0.208938,0.222248,
-	0.988599,0.150572,0,0.318731,0.29156,0.222248,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.988599,0.150571,0,0.310276,0.347076,0.222248,
-	0.988599,0.150571,0,0.310276,0.347076,0.222248,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.965122,0.261801,0,0.299415,0.418387,0.222248,
-	-0.252774,0.582577,0.77247,-0.17891,0.455225,0.279296,
-	-0.323984,0.592558,0.737502,-0.234168,0.483652,0.222248,
-	-0.42641,0.391747,0.815297,-0.231791,0.418387,0.27573,
-	0,-0.227898,0.973685,0.054097,-0.251982,0.357142,
-	0,-0,1,0.05339,0,0.380912,
-	0,-0.254425,0.967093,-0.054097,-0.251982,0.357142,
-	0.979828,0.199828,-0.002375,0.299415,0.418387,-0.380912,
-	0.996185,0.087205,0.003347,0.331315,0.208938,0.222248,
-	0.999999,0,-0.001399,0.345926,0,-0.380912,
-	0.141954,-0.989813,-0.010959,0.234168,-0.483652,-0.380912,
-	0,-0.999633,-0.027095,0.008103,-0.487773,-0.228855,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	0,-0.999633,-0.027095,0.008103,-0.487773,-0.228855,
-	0.141954,-0.989813,-0.010959,0.234168,-0.483652,-0.380912,
-	0.027733,-0.999483,-0.016268,0.054066,-0.49616,0.080576,
-	0,-0.999633,-0.027095,0.008103,-0.487773,-0.228855,
-	0.027733,-0.999483,-0.016268,0.054066,-0.49616,0.080576,
-	0,-0.999633,-0.027095,0.008103,-0.49662,0.097563,
-	0,-0.999633,-0.027095,0.008103,-0.49662,0.097563,
-	0.027733,-0.999483,-0.016268,0.054066,-0.49616,0.080576,
-	-0.000145,-0.999868,-0.016274,-0.001224,-0.5,0.222248,
-	0,-0.999633,-0.027095,0.008103,-0.49662,0.097563,
-	-0.000145,-0.999868,-0.016274,-0.001224,-0.5,0.222248,
-	-0,-0.999633,-0.027095,-0.017747,-0.49662,0.097563,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	-0,-0.999633,-0.027095,-0.017747,-0.49662,0.097563,
-	-0.000145,-0.999868,-0.016274,-0.001224,-0.5,0.222248,
-	-0,-0.999633,-0.027095,-0.017747,-0.49662,0.097563,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	0,-0.999633,-0.027095,-0.017747,-0.487773,-0.228855,
-	0,-0.999633,-0.027095,-0.017747,-0.487773,-0.228855,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	0,-0.999633,-0.027095,0.008103,-0.487773,-0.228855,
-	-0.806304,-0.04159,0.590037,-0.331315,-0.208938,0.222248,
-	-0.757873,-0.17819,0.627596,-0.299415,-0.418387,0.222248,
-	-0.726863,-0.090005,0.680859,-0.257344,-0.251982,0.320299,
-	-0.104394,-0.808168,0.579627,-0.17891,-0.455225,0.279296,
-	-0.000123,-0.822299,0.569056,-0.001224,-0.5,0.222248,
-	0,-0.78664,0.617411,-0.054097,-0.455225,0.279296,
-	0,0.357681,0.933844,0.054097,0.455225,0.279296,
-	0,0.357681,0.933844,-0.054097,0.455225,0.279296,
-	0,0.227898,0.973685,-0.054097,0.251982,0.357142,
-	-0.344013,0.237244,0.908499,-0.166895,0.251982,0.357142,
-	-0.42641,0.391747,0.815297,-0.231791,0.418387,0.27573,
-	-0.479243,0.170617,0.860939,-0.257344,0.251982,0.320299,
-	-0.344013,0.237244,0.908499,-0.166895,0.251982,0.357142,
-	-0.368596,0.450419,0.813179,-0.17891,0.455225,0.279296,
-	-0.42641,0.391747,0.815297,-0.231791,0.418387,0.27573,
-	0.132836,-0.983007,0.126693,0.234168,-0.483652,0.222248,
-	0.027733,-0.999483,-0.016268,0.054066,-0.49616,0.080576,
-	0.141954,-0.989813,-0.010959,0.234168,-0.483652,-0.380912,
-	0.027733,-0.999483,-0.016268,0.054066,-0.49616,0.080576,
-	0.132836,-0.983007,0.126693,0.234168,-0.483652,0.222248,
-	0.010143,-0.997511,0.069776,-0.001224,-0.5,0.222248,
-	0,0,-1,-0.299415,0.418387,-0.380912,
-	0,0,-1,-0.299415,-0.418387,-0.380912,
-	0,0,-1,-0.345926,0,-0.380912,
-	0,0,-1,-0.299415,-0.418387,-0.380912,
-	0,0,-1,-0.299415,0.418387,-0.380912,
-	0,0,-1,-0.283103,0.467335,-0.380912,
-	0,0,-1,-0.299415,-0.418387,-0.380912,
-	0,0,-1,-0.283103,0.467335,-0.380912,
-	0,0,-1,-0.283103,-0.467335,-0.380912,
-	0,0,-1,-0.283103,-0.467335,-0.380912,
-	0,0,-1,-0.283103,0.467335,-0.380912,
-	0,0,-1,-0.234168,0.483652,-0.380912,
-	0,0,-1,-0.283103,-0.467335,-0.380912,
-	0,0,-1,-0.234168,0.483652,-0.380912,
-	0,0,-1,-0.234168,-0.483652,-0.380912,
-	0,0,-1,-0.234168,-0.483652,-0.380912,
-	0,0,-1,-0.234168,0.483652,-0.380912,
-	0,0,-1,0.234168,0.483652,-0.380912,
-	0,0,-1,-0.234168,-0.483652,-0.380912,
-	0,0,-1,0.234168,0.483652,-0.380912,
-	0,0,-1,0.234168,-0.483652,-0.380912,
-	0,0,-1,0.234168,-0.483652,-0.380912,
-	0,0,-1,0.234168,0.483652,-0.380912,
-	0,0,-1,0.283103,-0.467335,-0.380912,
-	0,0,-1,0.283103,-0.467335,-0.380912,
-	0,0,-1,0.234168,0.483652,-0.380912,
-	0,0,-1,0.283103,0.467335,-0.380912,
-	0,0,-1,0.283103,-0.467335,-0.380912,
-	0,0,-1,0.283103,0.467335,-0.380912,
-	0,0,-1,0.299415,-0.418387,-0.380912,
-	0,0,-1,0.299415,-0.418387,-0.380912,
-	0,0,-1,0.283103,0.467335,-0.380912,
-	0,0,-1,0.299415,0.418387,-0.380912,
-	0,0,-1,0.299415,-0.418387,-0.380912,
-	0,0,-1,0.299415,0.418387,-0.380912,
-	0,0,-1,0.345926,0,-0.380912,
-	-0.466133,0.34121,0.816269,-0.231791,0.418387,0.27573,
-	-0.60748,0.202437,0.768106,-0.283103,0.467335,0.222248,
-	-0.680969,0.208836,0.701903,-0.299415,0.418387,0.222248,
-	0.490312,-0.197001,0.84899,0.257344,-0.251982,0.320299,
-	0.369417,-0.202622,0.906904,0.166895,-0.251982,0.357142,
-	0.390635,-0.324541,0.861439,0.17891,-0.455225,0.279296,
-	0.191639,-0.715981,0.671301,0.17891,-0.455225,0.279296,
-	0.156214,-0.815296,0.557574,0.234168,-0.483652,0.222248,
-	0.34735,-0.55882,0.753039,0.283103,-0.467335,0.222248,
-	0.594501,-0.161247,0.787761,0.257344,-0.251982,0.320299,
-	0.563931,-0.285379,0.774946,0.283103,-0.467335,0.222248,
-	0.757873,-0.17819,0.627596,0.299415,-0.418387,0.222248,
-	0,0.357681,0.933844,0.054097,0.455225,0.279296,
-	0,0.227898,0.973685,-0.054097,0.251982,0.357142,
-	0,0.227898,0.973685,0.054097,0.251982,0.357142,
-	-0.974495,-0.224383,-0.003566,-0.299415,-0.418387,-0.380912,
-	-0.94871,-0.316149,0,-0.283103,-0.467335,0.222248,
-	-0.972186,-0.234211,0,-0.299415,-0.418387,0.222248,
-	-0.996185,-0.087205,0.003347,-0.331315,-0.208938,0.222248,
-	-0.974495,-0.224383,-0.003566,-0.299415,-0.418387,-0.380912,
-	-0.972186,-0.234211,0,-0.299415,-0.418387,0.222248,
-	0,-0,1,0.05339,0,0.380912,
-	0,-0,1,-0.05339,0,0.380912,
-	0,-0.254425,0.967093,-0.054097,-0.251982,0.357142,
-	0,-0.227898,0.973685,0.054097,-0.251982,0.357142,
-	0,-0.254425,0.967093,-0.054097,-0.251982,0.357142,
-	0,-0.357681,0.933844,0.054097,-0.455225,0.279296,
-	-0.235866,0.971786,0,-0.234168,0.483652,0.222248,
-	-0.316307,0.948657,0,-0.283103,0.467335,-0.380912,
-	-0.316307,0.948657,0,-0.283103,0.467335,0.222248,
-	0.974495,-0.224383,-0.003566,0.299415,-0.418387,-0.380912,
-	0.94871,-0.316149,0,0.283103,-0.467335,0.222248,
-	0.94871,-0.316149,0,0.283103,-0.467335,-0.380912,
-	0.196887,0.972176,0.126926,0.234168,0.483652,0.222248,
-	0.129779,0.991501,-0.009119,0.234168,0.483652,-0.380912,
-	0.015319,0.99274,0.119299,-0.001224,0.5,0.222248,
-	-0.030578,0.830318,0.55645,-0.17891,0.455225,0.279296,
-	-0.012111,0.87373,0.486261,-0.001224,0.5,0.222248,
-	-0.120094,0.886303,0.447263,-0.234168,0.483652,0.222248,
-	-0.235866,0.971786,0,-0.234168,0.483652,0.222248,
-	-0.130021,0.991469,-0.009119,-0.234168,0.483652,-0.380912,
-	-0.316307,0.948657,0,-0.283103,0.467335,-0.380912,
-	0.323984,0.592558,0.737502,0.234168,0.483652,0.222248,
-	0.252774,0.582577,0.77247,0.17891,0.455225,0.279296,
-	0.42641,0.391747,0.815297,0.231791,0.418387,0.27573,
-	-0.974495,-0.224383,-0.003566,-0.299415,-0.418387,-0.380912,
-	-0.94871,-0.316149,0,-0.283103,-0.467335,-0.380912,
-	-0.94871,-0.316149,0,-0.283103,-0.467335,0.222248,
-	-0.316307,-0.948657,0,-0.283103,-0.467335,0.222248,
-	-0.316307,-0.948657,0,-0.283103,-0.467335,-0.380912,
-	-0.101389,-0.994724,-0.015639,-0.234168,-0.483652,-0.380912,
-	0,-0.78664,0.617411,0.054097,-0.455225,0.279296,
-	-0.000123,-0.822299,0.569056,-0.001224,-0.5,0.222248,
-	0.104191,-0.80829,0.579493,0.17891,-0.455225,0.279296,
-	0.680969,0.208836,0.701903,0.299415,0.418387,0.222248,
-	0.42641,0.391747,0.815297,0.231791,0.418387,0.27573,
-	0.662215,0.119119,0.739785,0.257344,0.251982,0.320299,
-	0.680969,0.208836,0.701903,0.299415,0.418387,0.222248,
-	0.60748,0.202437,0.768106,0.283103,0.467335,0.222248,
-	0.466133,0.34121,0.816269,0.231791,0.418387,0.27573,
-	0.479243,0.170617,0.860939,0.257344,0.251982,0.320299,
-	0.42641,0.391747,0.815297,0.231791,0.418387,0.27573,
-	0.344013,0.237244,0.908499,0.166895,0.251982,0.357142,
-	0.662215,0.119119,0.739785,0.257344,0.251982,0.320299,
-	0.439235,-0,0.898372,0.166895,0,0.380912,
-	0.594501,-0.161247,0.787761,0.257344,-0.251982,0.320299,
-	0.999999,0,-0.001399,0.345926,0,-0.380912,
-	0.996185,-0.087205,0.003347,0.331315,-0.208938,0.222248,
-	0.974495,-0.224383,-0.003566,0.299415,-0.418387,-0.380912,
-	0.42641,0.391747,0.815297,0.231791,0.418387,0.27573,
-	0.368596,0.450419,0.813179,0.17891,0.455225,0.279296,
-	0.344013,0.237244,0.908499,0.166895,0.251982,0.357142,
-	0.972186,-0.234211,0,0.299415,-0.418387,0.222248,
-	0.94871,-0.316149,0,0.283103,-0.467335,0.222248,
-	0.974495,-0.224383,-0.003566,0.299415,-0.418387,-0.380912,
-	0.104191,-0.80829,0.579493,0.17891,-0.455225,0.279296,
-	0.011777,-0.873735,0.486259,-0.001224,-0.5,0.222248,
-	0.117871,-0.949523,0.29071,0.234168,-0.483652,0.222248,
-	0.806304,-0.04159,0.590037,0.331315,-0.208938,0.222248,
-	0.726863,-0.090005,0.680859,0.257344,-0.251982,0.320299,
-	0.757873,-0.17819,0.627596,0.299415,-0.418387,0.222248,
-	0.17143,0.762655,0.623674,0.17891,0.455225,0.279296,
-	-0.000123,0.822299,0.569056,-0.001224,0.5,0.222248,
-	0,0.78664,0.617411,0.054097,0.455225,0.279296,
-	0.235633,0.971842,0,0.234168,0.483652,0.222248,
-	0.316307,0.948657,0,0.283103,0.467335,-0.380912,
-	0.129779,0.991501,-0.009119,0.234168,0.483652,-0.380912,
-	0.817604,0.124528,0.562153,0.318731,0.29156,0.222248,
-	0.743012,0.091749,0.66296,0.257344,0.251982,0.320299,
-	0.809725,0.062401,0.583482,0.331315,0.208938,0.222248,
-	0.743012,0.091749,0.66296,0.257344,0.251982,0.320299,
-	0.817604,0.124528,0.562153,0.318731,0.29156,0.222248,
-	0.680969,0.208836,0.701903,0.299415,0.418387,0.222248,
-	0,0,-1,0.299415,0.418387,0.222248,
-	0,0,-1,0.318731,0.29156,0.222248,
-	0,0,-1,0.310276,0.347076,0.222248,
-	0.152705,-0.988272,-0,0.234168,-0.483652,0.222248,
-	0.141954,-0.989813,-0.010959,0.234168,-0.483652,-0.380912,
-	0.316307,-0.948657,0,0.283103,-0.467335,0.222248,
-	0.316307,-0.948657,0,0.283103,-0.467335,0.222248,
-	0.141954,-0.989813,-0.010959,0.234168,-0.483652,-0.380912,
-	0.316307,-0.948657,0,0.283103,-0.467335,-0.380912,
-	0.996185,-0.087205,0.003347,0.331315,-0.208938,0.222248,
-	0.972186,-0.234211,0,0.299415,-0.418387,0.222248,
-	0.974495,-0.224383,-0.003566,0.299415,-0.418387,-0.380912,
-	0.205338,0.615841,0.760642,0.283103,0.467335,0.222248,
-	0.24127,0.701439,0.670651,0.234168,0.483652,0.222248,
-	0.38567,0.427053,0.817853,0.231791,0.418387,0.27573,
-	-0.439235,-0,0.898372,-0.166895,0,0.380912,
-	-0.490312,-0.197001,0.84899,-0.257344,-0.251982,0.320299,
-	-0.369417,-0.202622,0.906904,-0.166895,-0.251982,0.357142,
-	-0.439235,-0,0.898372,-0.166895,0,0.380912,
-	-0.344013,0.237244,0.908499,-0.166895,0.251982,0.357142,
-	-0.479243,0.170617,0.860939,-0.257344,0.251982,0.320299,
-	0.030271,0.830475,0.556232,0.17891,0.455225,0.279296,
-	0.119619,0.886444,0.447112,0.234168,0.483652,0.222248,
-	0.011777,0.873735,0.486259,-0.001224,0.5,0.222248,
-	-0.979828,0.199828,-0.002375,-0.299415,0.418387,-0.380912,
-	-0.999999,0,-0.001399,-0.345926,0,-0.380912,
-	-0.996185,0.087204,0.003347,-0.331315,0.208938,0.222248,
-	-0.439235,-0,0.898372,-0.166895,0,0.380912,
-	-0.662215,0.119119,0.739785,-0.257344,0.251982,0.320299,
-	-0.594501,-0.161247,0.787761,-0.257344,-0.251982,0.320299,
-	-0.996185,0.087204,0.003347,-0.331315,0.208938,0.222248,
-	-0.999999,0,-0.001399,-0.345926,0,-0.380912,
-	-0.996185,-0.087205,0.003347,-0.331315,-0.208938,0.222248,
-	-0.743012,0.091749,0.66296,-0.257344,0.251982,0.320299,
-	-0.806304,-0.04159,0.590037,-0.331315,-0.208938,0.222248,
-	-0.726863,-0.090005,0.680859,-0.257344,-0.251982,0.320299,
-	-0.806304,-0.04159,0.590037,-0.331315,-0.208938,0.222248,
-	-0.743012,0.091749,0.66296,-0.257344,0.251982,0.320299,
-	-0.809725,0.0624,0.583482,-0.331315,0.208938,0.222248
-};
-static const struct gllist toaster_frame = { GL_N3F_V3F, GL_TRIANGLES, 366, toaster_data, 0 };
-const struct gllist *toaster = &toaster_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\261\000\000\000n\001\000\000\303\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\001\2007\207\267^\210\345"
+ "8\000\000\016\3040\204}\236\000\000\016\3040\204\3458\000\000\260\377\377"
+ "\177\3458\000\000\016\304\320{}\236\000\000\016\304\320{\3458\000\0003\322"
+ "w\213\177G\000\000\016\3040\204\3458\000\000\260\377\001\200\3458\000\000"
+ "r\247\000\000}\236\000\000Z\263\345\224}\236\000\0000\253\203\312\3458\000"
+ "\000\320T}5\3458\000\000\320T\203\312\3458\000\000\216X\000\000}\236\000"
+ "\000\260\377\377\177\3458\000\000\362;\320{}\236\000\000\016\3040\204\345"
+ "8\000\000\260\377\001\200\3458\000\000\375J\026p\336\333\000\000\246L\033"
+ "k\3458\000\000\246L\033k}\236\000\000yH\242w\3458\000\000\273I\334sa\012"
+ "\000\000yH\242w\3458\000\000yH\242w}\236\000\000\362;\320{\3458\000\000y"
+ "H\242w}\236\000\000\331\015\201@m[\000\000'\362\201@m[\000\000\253\015\000"
+ "\000\203a\000\000\037\276\201@\376Q\000\000\035\260\325U\3458\000\0000\253"
+ "}5\3458\000\000Z\263\033k\3458\000\000\035\260\325U\3458\000\000Z\263\033"
+ "k\3458\000\000\303\261\251`\3458\000\000\341A\177\277\376Q\000\000\271*\000"
+ "\000\203a\000\000\271*\177\277m[\000\000\341A\201@\376Q\000\000\271*\201"
+ "@m[\000\000\320T\203\312\3458\000\000\341A\201@\376Q\000\000\341A\177\277"
+ "\376Q\000\000\320T}5\3458\000\000U\362\000\000\203a\000\000\035\260\325U"
+ "\3458\000\000Z\263\033k}\236\000\0000\253}5\3458\000\000\303\261\251`\345"
+ "8\000\000Z\263\033k\3458\000\000\037\276\177\277\376Q\000\000Z\263\345\224"
+ "\3458\000\000\207\267^\210\3458\000\0003\322w\213\177G\000\000\207\267^\210"
+ "\3458\000\000\016\3040\204\3458\000\0003\322w\213\177G\000\000\037\276\177"
+ "\277\376Q\000\000\207\267^\210\3458\000\000\301\266PuD\034\000\000\207\267"
+ "\242w\3458\000\000\301\266PuD\034\000\000\207\267\242w\3458\000\000\357\266"
+ "\332u\360\042\000\000\207\267\242w}\236\000\000\357\266\332u\360\042\000"
+ "\000\252\304\033k\226F\000\000\016\304\320{\3458\000\000\207\267\242w\345"
+ "8\000\000\331\015\211t\177G\000\000\260\377\377\177\3458\000\000'\362\211"
+ "t\177G\000\000\331\015w\213\177G\000\000'\362w\213\177G\000\000\260\377\001"
+ "\200\3458\000\000'\362w\213\177G\000\000\331\015w\213\177G\000\000\000\000"
+ "w\213\177G\000\000'\362\177\277m[\000\000'\362w\213\177G\000\000\331\015"
+ "w\213\177G\000\000G\325\177\277m[\000\0003\322w\213\177G\000\0003\322\211"
+ "t\177G\000\000\252\304\033k\226F\000\000\037\276\201@\376Q\000\000yH^\210"
+ "\3458\000\000\315-w\213\177G\000\000\230Q\243J\3458\000\000nO\331X\3458\000"
+ "\0003\322\211t\177G\000\000\016\304\320{\3458\000\000\331\015\177\277m[\000"
+ "\000\362;0\204}\236\000\000\023\002\042\203j\305\000\000\327\015\375\200"
+ "\240\024\000\000\023\002\336\200\372\030\000\000\260\377\001\200\3458\000"
+ "\000u\373\336\200\372\030\000\000u\373\042\203j\305\000\0000\253\203\312"
+ "\3458\000\000\037\276\177\277\376Q\000\000\331\015\211t\177G\000\000'\362"
+ "\211t\177G\000\000G\325\201@m[\000\000\037\276\201@\376Q\000\0003\322\211"
+ "t\177G\000\000\362;0\204\3458\000\000\260\377\001\200\3458\000\000Z\263\033"
+ "k}\236\000\000Z\263\345\224}\236\000\000r\247\000\000}\236\000\000\207\267"
+ "\242w}\236\000\000\207\267^\210}\236\000\000\016\304\320{}\236\000\000\016"
+ "\3040\204}\236\000\000\362;\320{}\236\000\000\362;0\204}\236\000\000yH^\210"
+ "}\236\000\000yH\242w}\236\000\000\246L\345\224}\236\000\000\246L\033k}\236"
+ "\000\000\216X\000\000}\236\000\000\252\304\033k\226F\000\000\207\267\242"
+ "w\3458\000\000\315-w\213\177G\000\000\315-w\213\177G\000\000\362;0\204\345"
+ "8\000\000yH^\210\3458\000\000\341A\177\277\376Q\000\000yH^\210\3458\000\000"
+ "\246L\345\224\3458\000\000\207\267^\210\3458\000\000Z\263\345\224\3458\000"
+ "\000\016\304\320{\3458\000\000\207\267\242w}\236\000\000\207\267\242w\345"
+ "8\000\000\246L\345\224}\236\000\000yH^\210\3458\000\000yH^\210}\236\000\000"
+ "\362;\320{\3458\000\000\260\377\377\177\3458\000\0003\322\211t\177G\000\000"
+ "\260\377\377\177\3458\000\000\016\304\320{\3458\000\000\362;\320{\3458\000"
+ "\000\315-\211t\177G\000\000V;\033k\226F\000\000\207\267^\210}\236\000\000"
+ "\207\267^\210}\236\000\000\315-w\213\177G\000\000\246L\033k\3458\000\000"
+ "\341A\201@\376Q\000\000yH\242w\3458\000\000V;\033k\226F\000\000\315-\211"
+ "t\177G\000\000\246L\345\224\3458\000\000\260\377\001\200\3458\000\000\362"
+ ";0\204\3458\000\000\315-\211t\177G\000\000\230Q\243J\3458\000\000\246L\033"
+ "k\3458\000\000\230Q\243J\3458\000\000nO\331X\3458\000\000\362;0\204\3458"
+ "\000\000yH^\210\3458\000\000yH^\210}\236\000\000yH\242w\3458\000\000\362"
+ ";\320{\3458\000\000V;\033k\226F\000\000G\325\000\000\203a\000\000\315-\211"
+ "t\177G\000\000\362;\320{\3458\000\000\260\377\377\177\3458\000\000\340\241"
+ "\363\215\353\226\376p\360p\355_\367\273\364\257\377\257\201\000\231\350\214"
+ "\366t\012t\366\177\000\377\177\020p\361\241\377\212d\032d\033j\026h\026h"
+ "\026 _ _\031f_ \000\030\000\030\000\000\301\010\273\013\271\005\312\021\000"
+ "\000\000\000\000\000)\360*\000 \357(\016\035\024G\374\077\010>\370G\005\000"
+ "\000\222\021\226\026\214\012\222\021\234\033\317\363\302\362\324\352\361"
+ "\306\345\325\363\274\345\333\327\360\334\335\241 \241 I\314I\314I\314\241"
+ " \241 \342!\3557\3601\000G\000K\000G\000\271\000\271\000\265\000\304\000"
+ "\312\000\335\000\346\000\335\000\335\340\357\341\346\362>\337\036\311\012"
+ "$\335\033\333n\021n\021\354.\347-\000\350\021\221\003\201\005\204\003\201"
+ "\376\201\375\201\003\201\271\374\302\370\000#\000#\343\024\330\016\343#\016"
+ "\234\001\212\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\334\033\317\020\037"
+ "\346\017\306\015\274\033\3251\363,\352>\362\241\340\232\347\347f\340_\340"
+ "_g\350_\340_\340\023_\002p\375J\377Q\366M\031-\024.!\036\241\340\340\241"
+ "\011\2736\0217\0121\020$\033\035#f\347\001\257\013\247\016>E\013\177\177"
+ "\177\177\177\177\021\222 \241 \241\0201\0237\036!\326\000\003J\012M\001Q"
+ "\000\000\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000"
+ "\010\000\011\000\012\000\013\000\014\000\015\000\016\000\017\000\020\000"
+ "\004\000\021\000\001\000\022\000\023\000\024\000\025\000\024\000\023\000"
+ "\026\000\026\000\023\000\027\000\030\000\031\000\032\000\033\000\023\000"
+ "\025\000\023\000\033\000\027\000\027\000\033\000\026\000\034\000\035\000"
+ "\036\000\037\000 \000!\000 \000\037\000\042\000#\000$\000%\000&\000'\000"
+ "(\000)\000*\000'\000+\000,\000-\000,\000+\000.\000\036\000\035\000/\0000"
+ "\0001\0002\0001\0000\0003\0001\0003\0004\0005\0006\0007\0008\0009\000:\000"
+ ";\000<\000=\0004\000>\0001\000>\0004\000\077\000@\000A\000B\000>\000C\000"
+ "1\000C\000>\000D\000C\000D\000\077\000E\000F\000G\000H\000I\000J\000K\000"
+ "L\000M\000N\000O\000P\000P\000Q\000R\000Q\000P\000S\000T\000<\000U\000J\000"
+ "I\000V\000W\000\042\000X\000Y\000&\000Z\000\025\000[\000\014\000[\000\025"
+ "\000\134\000\134\000\025\000\024\000]\000^\000W\000_\000\036\000Q\000\025"
+ "\000\014\000\016\000`\000a\000\001\000a\000`\000b\000a\000b\000c\000c\000"
+ "b\000d\000c\000d\000e\000\001\000e\000d\000e\000\001\000f\000f\000\001\000"
+ "a\000g\0006\000h\000\006\000M\000L\000i\000j\000\035\000k\000W\000l\000k"
+ "\000m\000W\000n\000b\000`\000b\000n\000o\000p\000q\000r\000q\000p\000s\000"
+ "q\000s\000t\000t\000s\000u\000t\000u\000v\000v\000u\000w\000v\000w\000x\000"
+ "x\000w\000y\000y\000w\000z\000y\000z\000{\000{\000z\000|\000{\000|\000}\000"
+ "~\000\177\000\042\000&\000(\000\200\000\201\000\202\000\203\000\204\000\205"
+ "\000\206\000i\000\035\000\034\000\012\000\207\000\210\000\013\000\012\000"
+ "\210\000\036\000/\000Q\000_\000Q\000S\000\211\000\212\000\213\000\214\000"
+ "\215\000\216\000\217\000\020\000\220\000\221\000\222\000\223\000\211\000"
+ "\004\000\212\000\224\000\225\000\226\000\012\000\227\000\207\000\000\000"
+ "\230\000\001\000K\000M\000\231\000\232\000\226\000\233\000\232\000\234\000"
+ "\235\000)\000\226\000*\000\233\000'\000\204\000\016\000\015\000\214\000\226"
+ "\000\236\000*\000\237\000\215\000\214\000\231\000\240\000\241\000+\000-\000"
+ "\206\000\242\000I\000H\000\032\000\031\000\020\000\243\000,\000.\000,\000"
+ "\243\000\232\000\244\000\245\000\246\000\247\000`\000\250\000\250\000`\000"
+ "\251\000\015\000\237\000\214\000\252\000\253\000\254\000\255\000<\000T\000"
+ "\255\000k\000l\000\256\000\257\000\260\0001\000\011\0002\000\255\000X\000"
+ "5\0002\000\011\000\013\000\037\000g\000h\000g\000\037\000!\000\000\000\001"
+ "\000\001\000\002\000\000\000\002\000\003\000\004\000\004\000\005\000\003"
+ "\000\005\000\002\000\006\000\002\000\010\000\006\000\010\000\011\000\012"
+ "\000\012\000\013\000\011\000\013\000\014\000\015\000\015\000\016\000\014"
+ "\000\016\000\003\000\020\000\004\000\020\000\001\000\010\000\023\000\024"
+ "\000\024\000\025\000\023\000\025\000\023\000\026\000\024\000\026\000\023"
+ "\000\027\000\026\000\027\000\026\000\031\000\031\000\032\000\026\000\032"
+ "\000\023\000\031\000\025\000\031\000\027\000\031\000\034\000\035\000\035"
+ "\000\036\000\034\000\036\000\037\000 \000 \000!\000\037\000!\000\037\000"
+ "\042\000 \000\042\000\042\000%\000 \000%\000&\000'\000'\000(\000&\000(\000"
+ ")\000*\000'\000*\000'\000)\000\015\000)\000&\000)\000\015\000&\000\014\000"
+ ")\000\035\000/\000\036\000/\000 \0001\000!\0001\000%\0001\000\042\0001\000"
+ "5\0006\000\000\0006\000\000\0005\000\000\000\006\000\006\0005\000\042\000"
+ ">\0001\000>\000\042\000\077\000>\000\077\000\077\000B\000>\000B\000>\000"
+ "C\0001\000C\000B\000C\000\077\000C\000\005\000E\000\005\000\077\000\077\000"
+ "E\000\003\000H\000\003\000J\000H\000J\000K\000L\000\010\000L\000\010\000"
+ "K\000K\000P\000L\000P\000P\000Q\000L\000Q\000K\000Q\0005\000T\000\006\000"
+ "T\000\003\000V\000J\000V\000\042\000E\000\037\000E\000&\000Y\000&\000Z\000"
+ "Y\000Z\000\025\000[\000\014\000[\000\014\000\025\000\025\000\134\000[\000"
+ "\134\000\024\000\134\000\005\000V\000E\000V\000\036\000_\000\036\000Q\000"
+ "Q\000_\000\016\000\025\000`\000a\000\001\000a\000\001\000`\000`\000b\000"
+ "a\000b\000b\000c\000a\000c\000\010\000b\000\010\000c\000\010\000e\000c\000"
+ "e\000\001\000e\000\001\000f\000e\000f\000a\000f\000\013\0006\000\013\000"
+ "5\000\006\000L\000\035\000J\000\035\000H\000E\000k\000\037\000k\000V\000"
+ "k\000b\000n\000`\000n\000\010\000n\000\012\0001\000\011\0001\000\012\000"
+ "C\000C\000t\000\012\000t\000\004\000C\000\004\000t\000\001\000\004\000\001"
+ "\000t\000\001\000\020\000\020\000`\000\020\000y\000`\000y\000\020\000\031"
+ "\000\031\000y\000\031\000{\000y\000{\000\025\000{\000\016\000{\000(\000Z"
+ "\000Z\000n\000Y\000n\000Y\000\206\000&\000\206\000\034\000H\000\000\000\012"
+ "\000\012\0006\000/\000Q\000K\000_\000\005\000C\000Y\000{\000Y\000y\000\020"
+ "\000\032\000\003\000\032\000\032\000\225\000\225\000\226\000\032\000\226"
+ "\000\000\000t\000\010\000Z\000K\000Z\000\024\000\226\000)\000\226\000\024"
+ "\000)\000\026\000\226\000*\000\226\000\015\000{\000*\000\225\000{\000\206"
+ "\000\015\000\206\000\003\000\225\000H\000\225\000)\000[\000\024\000[\000"
+ "Y\000`\0005\000\255\000T\000\255\000k\000\255\000\037\000\255\000\011\000"
+ "!\000\037\0005\000\013\000!\000\013\000\037\000"
+;
+const unsigned long toaster_size = 3364;
@@ -1,130 +1,66 @@
-/* Generated from "toaster_base.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_base.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_base_data[] = {
-	-0.10666,0.994296,0,-0.242083,0.5,0.052679,
-	0.10666,0.994296,0,0.242083,0.5,-0.052679,
-	-0.21332,0.976982,0,-0.242083,0.5,-0.052679,
-	0.10666,0.994296,0,0.242083,0.5,-0.052679,
-	-0.10666,0.994296,0,-0.242083,0.5,0.052679,
-	0.213319,0.976983,0,0.242083,0.5,0.052679,
-	0.983679,0.17993,0,0.309535,0.432529,-0.052679,
-	0.999314,0.03703,0,0.357619,0,0.052679,
-	0.999314,-0.03703,0,0.357619,0,-0.052679,
-	0.999314,0.03703,0,0.357619,0,0.052679,
-	0.983679,0.17993,0,0.309535,0.432529,-0.052679,
-	0.968549,0.248824,0,0.309535,0.432529,0.052679,
-	0.10666,-0.994296,0,0.242083,-0.5,0.052679,
-	-0.10666,-0.994296,0,-0.242083,-0.5,-0.052679,
-	0.213319,-0.976983,0,0.242083,-0.5,-0.052679,
-	-0.10666,-0.994296,0,-0.242083,-0.5,-0.052679,
-	0.10666,-0.994296,0,0.242083,-0.5,0.052679,
-	-0.21332,-0.976982,0,-0.242083,-0.5,0.052679,
-	-0.983679,0.17993,0,-0.309535,0.432529,0.052679,
-	-0.999314,0.03703,0,-0.357619,0,-0.052679,
-	-0.999314,-0.03703,0,-0.357619,0,0.052679,
-	-0.999314,0.03703,0,-0.357619,0,-0.052679,
-	-0.983679,0.17993,0,-0.309535,0.432529,0.052679,
-	-0.968549,0.248824,0,-0.309535,0.432529,-0.052679,
-	0,0,-1,-0.309535,0.432529,-0.052679,
-	0,0,-1,-0.309535,-0.432529,-0.052679,
-	0,0,-1,-0.357619,0,-0.052679,
-	0,0,-1,-0.309535,-0.432529,-0.052679,
-	0,0,-1,-0.309535,0.432529,-0.052679,
-	0,0,-1,-0.292672,0.483132,-0.052679,
-	0,0,-1,-0.309535,-0.432529,-0.052679,
-	0,0,-1,-0.292672,0.483132,-0.052679,
-	0,0,-1,-0.292672,-0.483132,-0.052679,
-	0,0,-1,-0.292672,-0.483132,-0.052679,
-	0,0,-1,-0.292672,0.483132,-0.052679,
-	0,0,-1,-0.242083,0.5,-0.052679,
-	0,0,-1,-0.292672,-0.483132,-0.052679,
-	0,0,-1,-0.242083,0.5,-0.052679,
-	0,0,-1,-0.242083,-0.5,-0.052679,
-	0,0,-1,-0.242083,-0.5,-0.052679,
-	0,0,-1,-0.242083,0.5,-0.052679,
-	0,0,-1,0.242083,0.5,-0.052679,
-	0,0,-1,-0.242083,-0.5,-0.052679,
-	0,0,-1,0.242083,0.5,-0.052679,
-	0,0,-1,0.242083,-0.5,-0.052679,
-	0,0,-1,0.242083,-0.5,-0.052679,
-	0,0,-1,0.242083,0.5,-0.052679,
-	0,0,-1,0.292672,-0.483132,-0.052679,
-	0,0,-1,0.292672,-0.483132,-0.052679,
-	0,0,-1,0.242083,0.5,-0.052679,
-	0,0,-1,0.292672,0.483132,-0.052679,
-	0,0,-1,0.292672,-0.483132,-0.052679,
-	0,0,-1,0.292672,0.483132,-0.052679,
-	0,0,-1,0.309535,-0.432529,-0.052679,
-	0,0,-1,0.309535,-0.432529,-0.052679,
-	0,0,-1,0.292672,0.483132,-0.052679,
-	0,0,-1,0.309535,0.432529,-0.052679,
-	0,0,-1,0.309535,-0.432529,-0.052679,
-	0,0,-1,0.309535,0.432529,-0.052679,
-	0,0,-1,0.357619,0,-0.052679,
-	0.999314,-0.03703,0,0.357619,0,-0.052679,
-	0.983679,-0.17993,0,0.309535,-0.432529,0.052679,
-	0.968549,-0.248824,0,0.309535,-0.432529,-0.052679,
-	0.983679,-0.17993,0,0.309535,-0.432529,0.052679,
-	0.999314,-0.03703,0,0.357619,0,-0.052679,
-	0.999314,0.03703,0,0.357619,0,0.052679,
-	-0.999314,-0.03703,0,-0.357619,0,0.052679,
-	-0.983679,-0.17993,0,-0.309535,-0.432529,-0.052679,
-	-0.968549,-0.248824,0,-0.309535,-0.432529,0.052679,
-	-0.983679,-0.17993,0,-0.309535,-0.432529,-0.052679,
-	-0.999314,-0.03703,0,-0.357619,0,0.052679,
-	-0.999314,0.03703,0,-0.357619,0,-0.052679,
-	-0.968549,-0.248824,0,-0.309535,-0.432529,0.052679,
-	-0.948709,-0.316149,0,-0.292672,-0.483132,-0.052679,
-	-0.948709,-0.316149,0,-0.292672,-0.483132,0.052679,
-	-0.948709,-0.316149,0,-0.292672,-0.483132,-0.052679,
-	-0.968549,-0.248824,0,-0.309535,-0.432529,0.052679,
-	-0.983679,-0.17993,0,-0.309535,-0.432529,-0.052679,
-	-0.21332,-0.976982,0,-0.242083,-0.5,0.052679,
-	-0.316307,-0.948657,0,-0.292672,-0.483132,-0.052679,
-	-0.10666,-0.994296,0,-0.242083,-0.5,-0.052679,
-	-0.316307,-0.948657,0,-0.292672,-0.483132,-0.052679,
-	-0.21332,-0.976982,0,-0.242083,-0.5,0.052679,
-	-0.316307,-0.948657,0,-0.292672,-0.483132,0.052679,
-	0.316307,-0.948657,0,0.292672,-0.483132,0.052679,
-	0.213319,-0.976983,0,0.242083,-0.5,-0.052679,
-	0.316307,-0.948657,0,0.292672,-0.483132,-0.052679,
-	0.213319,-0.976983,0,0.242083,-0.5,-0.052679,
-	0.316307,-0.948657,0,0.292672,-0.483132,0.052679,
-	0.10666,-0.994296,0,0.242083,-0.5,0.052679,
-	0.968549,-0.248824,0,0.309535,-0.432529,-0.052679,
-	0.948709,-0.316149,0,0.292672,-0.483132,0.052679,
-	0.948709,-0.316149,0,0.292672,-0.483132,-0.052679,
-	0.948709,-0.316149,0,0.292672,-0.483132,0.052679,
-	0.968549,-0.248824,0,0.309535,-0.432529,-0.052679,
-	0.983679,-0.17993,0,0.309535,-0.432529,0.052679,
-	0.213319,0.976983,0,0.242083,0.5,0.052679,
-	0.316307,0.948657,0,0.292672,0.483132,-0.052679,
-	0.10666,0.994296,0,0.242083,0.5,-0.052679,
-	0.316307,0.948657,0,0.292672,0.483132,-0.052679,
-	0.213319,0.976983,0,0.242083,0.5,0.052679,
-	0.316307,0.948657,0,0.292672,0.483132,0.052679,
-	0.948709,0.316149,0,0.292672,0.483132,-0.052679,
-	0.968549,0.248824,0,0.309535,0.432529,0.052679,
-	0.983679,0.17993,0,0.309535,0.432529,-0.052679,
-	0.968549,0.248824,0,0.309535,0.432529,0.052679,
-	0.948709,0.316149,0,0.292672,0.483132,-0.052679,
-	0.948709,0.316149,0,0.292672,0.483132,0.052679,
-	-0.948709,0.316149,0,-0.292672,0.483132,0.052679,
-	-0.968549,0.248824,0,-0.309535,0.432529,-0.052679,
-	-0.983679,0.17993,0,-0.309535,0.432529,0.052679,
-	-0.968549,0.248824,0,-0.309535,0.432529,-0.052679,
-	-0.948709,0.316149,0,-0.292672,0.483132,0.052679,
-	-0.948709,0.316149,0,-0.292672,0.483132,-0.052679,
-	-0.316307,0.948657,0,-0.292672,0.483132,0.052679,
-	-0.21332,0.976982,0,-0.242083,0.5,-0.052679,
-	-0.316307,0.948657,0,-0.292672,0.483132,-0.052679,
-	-0.21332,0.976982,0,-0.242083,0.5,-0.052679,
-	-0.316307,0.948657,0,-0.292672,0.483132,0.052679,
-	-0.10666,0.994296,0,-0.242083,0.5,0.052679
-};
-static const struct gllist toaster_base_frame = { GL_N3F_V3F, GL_TRIANGLES, 120, toaster_base_data, 0 };
-const struct gllist *toaster_base = &toaster_base_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_base[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\0002\000\000\000x\000\000\000C\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\001\2007\007\302\377\177|\015\000"
+ "\000\371=\377\177\204\362\000\000\007\302\377\177\204\362\000\000\371=\377"
+ "\177|\015\000\000=O\271n\204\362\000\000\214[\000\000|\015\000\000\214[\000"
+ "\000\204\362\000\000=O\271n|\015\000\000\371=\001\200|\015\000\000\007\302"
+ "\001\200\204\362\000\000\371=\001\200\204\362\000\000\007\302\001\200|\015"
+ "\000\000\303\260\271n|\015\000\000t\244\000\000\204\362\000\000t\244\000"
+ "\000|\015\000\000\303\260\271n\204\362\000\000\303\260\271n\204\362\000\000"
+ "\303\260G\221\204\362\000\000t\244\000\000\204\362\000\000\024\265\256{\204"
+ "\362\000\000\024\265R\204\204\362\000\000\007\302\377\177\204\362\000\000"
+ "\007\302\001\200\204\362\000\000\371=\377\177\204\362\000\000\371=\001\200"
+ "\204\362\000\000\354JR\204\204\362\000\000\354J\256{\204\362\000\000=OG\221"
+ "\204\362\000\000=O\271n\204\362\000\000\214[\000\000\204\362\000\000=OG\221"
+ "|\015\000\000=OG\221\204\362\000\000\303\260G\221\204\362\000\000\303\260"
+ "G\221|\015\000\000\024\265R\204\204\362\000\000\024\265R\204|\015\000\000"
+ "\024\265R\204\204\362\000\000\024\265R\204|\015\000\000\354JR\204|\015\000"
+ "\000\354JR\204\204\362\000\000\354JR\204|\015\000\000\354JR\204\204\362\000"
+ "\000\354J\256{\204\362\000\000\354J\256{|\015\000\000\354J\256{\204\362\000"
+ "\000\354J\256{|\015\000\000\024\265\256{|\015\000\000\024\265\256{\204\362"
+ "\000\000\024\265\256{|\015\000\000\024\265\256{\204\362\000\000\364s\014"
+ "s\351h\027hk\024z\005z\373e\032\014\215\364\215\027\230\351\230\225\024\206"
+ "\005\206\373\233\032\177\177\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\177\177\177\177\177\177\177\177\177\177\177\177\177\177k\354e\346\225"
+ "\354\233\346\241\340\241\340\340\241\340\241 \241 \241_\340_\340 _ __ _ "
+ "\241 \241 \340_\340_\000\000\001\000\002\000\001\000\000\000\003\000\004"
+ "\000\005\000\006\000\005\000\004\000\007\000\010\000\011\000\012\000\011"
+ "\000\010\000\013\000\014\000\015\000\016\000\015\000\014\000\017\000\020"
+ "\000\021\000\022\000\021\000\020\000\023\000\021\000\023\000\024\000\024"
+ "\000\023\000\025\000\024\000\025\000\026\000\026\000\025\000\027\000\026"
+ "\000\027\000\030\000\030\000\027\000\031\000\031\000\027\000\032\000\031"
+ "\000\032\000\033\000\033\000\032\000\034\000\033\000\034\000\035\000\006"
+ "\000\036\000\037\000\036\000\006\000\005\000\016\000 \000!\000 \000\016\000"
+ "\015\000!\000\042\000#\000\042\000!\000 \000\013\000$\000\011\000$\000\013"
+ "\000%\000&\000\012\000'\000\012\000&\000\010\000\037\000(\000)\000(\000\037"
+ "\000\036\000\003\000*\000\001\000*\000\003\000+\000,\000\007\000\004\000"
+ "\007\000,\000-\000.\000\017\000\014\000\017\000.\000/\0000\000\002\0001\000"
+ "\002\0000\000\000\000\000\000\001\000\001\000\002\000\000\000\002\000\000"
+ "\000\003\000\001\000\003\000\004\000\005\000\005\000\006\000\004\000\006"
+ "\000\004\000\007\000\005\000\007\000\010\000\011\000\011\000\012\000\010"
+ "\000\012\000\010\000\013\000\011\000\013\000\014\000\015\000\015\000\016"
+ "\000\014\000\016\000\014\000\017\000\015\000\017\000\017\000\021\000\015"
+ "\000\021\000\017\000\023\000\021\000\023\000\023\000\024\000\021\000\024"
+ "\000\002\000\023\000\002\000\024\000\002\000\011\000\011\000\024\000\001"
+ "\000\011\000\001\000\012\000\001\000\031\000\012\000\031\000\001\000\032"
+ "\000\031\000\032\000\032\000\033\000\031\000\033\000\004\000\032\000\004"
+ "\000\033\000\006\000\033\000\006\000\036\000\033\000\036\000\005\000\036"
+ "\000\016\000\021\000\021\000!\000\016\000!\000\024\000!\000\024\000#\000"
+ "!\000#\000\013\000\024\000\013\000#\000\012\000&\000\031\000&\000\010\000"
+ "&\000\033\000&\000\036\000&\000\003\000\032\000\003\000+\000\032\000+\000"
+ "\007\000\032\000\007\000+\000\017\000.\000\014\000.\000\023\000.\000\002"
+ "\000.\000\000\000.\000"
+;
+const unsigned long toaster_base_size = 1088;
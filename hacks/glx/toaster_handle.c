@@ -1,64 +1,42 @@
-/* Generated from "toaster_handle.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_handle.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_handle_data[] = {
-	0,0,1,0.5,-0.094169,0.035224,
-	0,0,1,-0.356403,0.038624,0.035224,
-	0,0,1,-0.5,-0.094169,0.035224,
-	0,0,1,-0.356403,0.038624,0.035224,
-	0,0,1,0.5,-0.094169,0.035224,
-	0,0,1,-0.210084,0.094169,0.035224,
-	0,0,1,-0.210084,0.094169,0.035224,
-	0,0,1,0.5,-0.094169,0.035224,
-	0,0,1,0.210084,0.094169,0.035224,
-	0,0,1,0.210084,0.094169,0.035224,
-	0,0,1,0.5,-0.094169,0.035224,
-	0,0,1,0.356403,0.038624,0.035224,
-	-0.678947,0.734187,0,-0.5,-0.094169,0.035224,
-	-0.58038,0.814346,0,-0.356403,0.038624,-0.035224,
-	-0.678947,0.734187,0,-0.5,-0.094169,-0.035224,
-	-0.58038,0.814346,0,-0.356403,0.038624,-0.035224,
-	-0.678947,0.734187,0,-0.5,-0.094169,0.035224,
-	-0.47058,0.882357,0,-0.356403,0.038624,0.035224,
-	0,0,-1,-0.356403,0.038624,-0.035224,
-	0,0,-1,0.5,-0.094169,-0.035224,
-	0,0,-1,-0.5,-0.094169,-0.035224,
-	0,0,-1,0.5,-0.094169,-0.035224,
-	0,0,-1,-0.356403,0.038624,-0.035224,
-	0,0,-1,-0.210084,0.094169,-0.035224,
-	0,0,-1,0.5,-0.094169,-0.035224,
-	0,0,-1,-0.210084,0.094169,-0.035224,
-	0,0,-1,0.210084,0.094169,-0.035224,
-	0,0,-1,0.5,-0.094169,-0.035224,
-	0,0,-1,0.210084,0.094169,-0.035224,
-	0,0,-1,0.356403,0.038624,-0.035224,
-	0.58038,0.814346,0,0.356403,0.038624,0.035224,
-	0.678947,0.734187,0,0.5,-0.094169,-0.035224,
-	0.47058,0.882357,0,0.356403,0.038624,-0.035224,
-	0.678947,0.734187,0,0.5,-0.094169,-0.035224,
-	0.58038,0.814346,0,0.356403,0.038624,0.035224,
-	0.678947,0.734187,0,0.5,-0.094169,0.035224,
-	-0.120052,0.992768,0,-0.210084,0.094169,0.035224,
-	0.120052,0.992768,0,0.210084,0.094169,-0.035224,
-	-0.240104,0.970747,0,-0.210084,0.094169,-0.035224,
-	0.120052,0.992768,0,0.210084,0.094169,-0.035224,
-	-0.120052,0.992768,0,-0.210084,0.094169,0.035224,
-	0.240104,0.970747,0,0.210084,0.094169,0.035224,
-	0.240104,0.970747,0,0.210084,0.094169,0.035224,
-	0.47058,0.882357,0,0.356403,0.038624,-0.035224,
-	0.120052,0.992768,0,0.210084,0.094169,-0.035224,
-	0.47058,0.882357,0,0.356403,0.038624,-0.035224,
-	0.240104,0.970747,0,0.210084,0.094169,0.035224,
-	0.58038,0.814346,0,0.356403,0.038624,0.035224,
-	-0.47058,0.882357,0,-0.356403,0.038624,0.035224,
-	-0.240104,0.970747,0,-0.210084,0.094169,-0.035224,
-	-0.58038,0.814346,0,-0.356403,0.038624,-0.035224,
-	-0.240104,0.970747,0,-0.210084,0.094169,-0.035224,
-	-0.47058,0.882357,0,-0.356403,0.038624,0.035224,
-	-0.120052,0.992768,0,-0.210084,0.094169,0.035224
-};
-static const struct gllist toaster_handle_frame = { GL_N3F_V3F, GL_TRIANGLES, 54, toaster_handle_data, 0 };
-const struct gllist *toaster_handle = &toaster_handle_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_handle[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\030\000\000\0006\000\000\000\035\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\001\2007\377\177\345\347"
+ "\004\011\000\000\304\244\343\011\004\011\000\000\001\200\345\347\004\011"
+ "\000\0008\312\033\030\004\011\000\000\3105\033\030\004\011\000\000<[\343"
+ "\011\004\011\000\000\001\200\345\347\004\011\000\000\304\244\343\011\374"
+ "\366\000\000\001\200\345\347\374\366\000\000\304\244\343\011\004\011\000"
+ "\000\304\244\343\011\374\366\000\000\377\177\345\347\374\366\000\000\001"
+ "\200\345\347\374\366\000\0008\312\033\030\374\366\000\000\3105\033\030\374"
+ "\366\000\000<[\343\011\374\366\000\000<[\343\011\004\011\000\000\377\177"
+ "\345\347\374\366\000\000<[\343\011\374\366\000\000\377\177\345\347\004\011"
+ "\000\0008\312\033\030\004\011\000\000\3105\033\030\374\366\000\0008\312\033"
+ "\030\374\366\000\000\3105\033\030\004\011\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\303B\313J\303B\324S\177\177\177\177\177\177\177"
+ "\177\177\177\177\1775J=B,S=B\362q\016q\347f\031f\000\000\001\000\002\000"
+ "\001\000\000\000\003\000\003\000\000\000\004\000\004\000\000\000\005\000"
+ "\006\000\007\000\010\000\007\000\006\000\011\000\012\000\013\000\014\000"
+ "\013\000\012\000\015\000\013\000\015\000\016\000\013\000\016\000\017\000"
+ "\020\000\021\000\022\000\021\000\020\000\023\000\024\000\025\000\026\000"
+ "\025\000\024\000\027\000\027\000\022\000\025\000\022\000\027\000\020\000"
+ "\011\000\026\000\007\000\026\000\011\000\024\000\000\000\001\000\001\000"
+ "\002\000\000\000\002\000\000\000\003\000\001\000\003\000\000\000\004\000"
+ "\003\000\004\000\000\000\005\000\004\000\005\000\002\000\007\000\007\000"
+ "\010\000\002\000\010\000\001\000\007\000\007\000\013\000\010\000\013\000"
+ "\007\000\015\000\013\000\015\000\015\000\016\000\013\000\016\000\016\000"
+ "\017\000\013\000\017\000\005\000\013\000\005\000\017\000\000\000\013\000"
+ "\003\000\016\000\003\000\015\000\004\000\016\000\004\000\017\000\001\000"
+ "\015\000"
+;
+const unsigned long toaster_handle_size = 544;
@@ -1,40 +1,34 @@
-/* Generated from "toaster_handle2.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_handle2.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_handle2_data[] = {
-	0,-0.027094,0.999633,0.038934,-0.294903,-0.5,
-	0,-0.027094,0.999633,-0.038934,0.321555,-0.483291,
-	0,-0.027094,0.999633,-0.038934,-0.294903,-0.5,
-	0,-0.027094,0.999633,-0.038934,0.321555,-0.483291,
-	0,-0.027094,0.999633,0.038934,-0.294903,-0.5,
-	0,-0.027094,0.999633,0.038934,0.321555,-0.483291,
-	-1,0,0,0.038934,0.294903,0.5,
-	-1,0,0,0.038934,-0.294903,-0.5,
-	-1,0,0,0.038934,-0.321555,0.483291,
-	-1,0,0,0.038934,-0.294903,-0.5,
-	-1,0,0,0.038934,0.294903,0.5,
-	-1,0,0,0.038934,0.321555,-0.483291,
-	0,0.027094,-0.999633,0.038934,0.294903,0.5,
-	0,0.027094,-0.999633,-0.038934,-0.321555,0.483291,
-	0,0.027094,-0.999633,-0.038934,0.294903,0.5,
-	0,0.027094,-0.999633,-0.038934,-0.321555,0.483291,
-	0,0.027094,-0.999633,0.038934,0.294903,0.5,
-	0,0.027094,-0.999633,0.038934,-0.321555,0.483291,
-	1,0,0,-0.038934,-0.294903,-0.5,
-	1,0,0,-0.038934,0.294903,0.5,
-	1,0,0,-0.038934,-0.321555,0.483291,
-	1,0,0,-0.038934,0.294903,0.5,
-	1,0,0,-0.038934,-0.294903,-0.5,
-	1,0,0,-0.038934,0.321555,-0.483291,
-	0,-0.999633,-0.027095,0.038934,0.294903,0.5,
-	0,-0.999633,-0.027095,-0.038934,0.321555,-0.483291,
-	0,-0.999633,-0.027095,0.038934,0.321555,-0.483291,
-	0,-0.999633,-0.027095,-0.038934,0.321555,-0.483291,
-	0,-0.999633,-0.027095,0.038934,0.294903,0.5,
-	0,-0.999633,-0.027095,-0.038934,0.294903,0.5
-};
-static const struct gllist toaster_handle2_frame = { GL_N3F_V3F, GL_TRIANGLES, 30, toaster_handle2_data, 0 };
-const struct gllist *toaster_handle2 = &toaster_handle2_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_handle2[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\024\000\000\000\036\000\000\000\021\000\000\000"
+ "\031\354\0371\000\000\000\000\247m\0233\000\001\2007\370\011\202\264\001"
+ "\200\000\000\010\366QRH\204\000\000\010\366\202\264\001\200\000\000\370\011"
+ "QRH\204\000\000\370\011~K\377\177\000\000\370\011\202\264\001\200\000\000"
+ "\370\011\257\255\270{\000\000\370\011QRH\204\000\000\370\011~K\377\177\000"
+ "\000\010\366\257\255\270{\000\000\010\366~K\377\177\000\000\370\011\257\255"
+ "\270{\000\000\010\366\202\264\001\200\000\000\010\366~K\377\177\000\000\010"
+ "\366\257\255\270{\000\000\010\366QRH\204\000\000\370\011~K\377\177\000\000"
+ "\010\366QRH\204\000\000\370\011QRH\204\000\000\010\366~K\377\177\000\000"
+ "\000\375\000\375\000\375\000\375\201\000\201\000\201\000\201\000|\177|\177"
+ "|\177|\177\177\000\177\000\177\000\177\000\003\201\003\201\003\201\003\201"
+ "\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006\000"
+ "\005\000\004\000\007\000\010\000\011\000\012\000\011\000\010\000\013\000"
+ "\014\000\015\000\016\000\015\000\014\000\017\000\020\000\021\000\022\000"
+ "\021\000\020\000\023\000\000\000\001\000\001\000\002\000\000\000\002\000"
+ "\000\000\003\000\001\000\003\000\000\000\004\000\000\000\006\000\004\000"
+ "\006\000\003\000\004\000\004\000\011\000\011\000\012\000\004\000\012\000"
+ "\006\000\011\000\002\000\012\000\002\000\011\000\001\000\012\000\001\000"
+ "\004\000"
+;
+const unsigned long toaster_handle2_size = 408;
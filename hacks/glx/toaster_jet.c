@@ -1,178 +1,94 @@
-/* Generated from "toaster_jet.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_jet.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_jet_data[] = {
-	0.813787,-0.208368,0.542526,-0.002117,-0.240071,0.000396,
-	0.813787,-0.208368,0.542526,-0.061503,-0.5,-0.010357,
-	0.813787,-0.208368,0.542526,-0.031551,-0.5,-0.055285,
-	-0.351369,0.154576,0.923388,0.012946,0.394969,0.120155,
-	-0.354839,-0.067247,0.932506,-0.087986,-0.240071,0.081748,
-	-0.352413,-0.134494,0.92613,0.012946,-0.240071,0.120155,
-	-0.707849,-0.221865,0.670616,-0.002117,-0.240071,0.000396,
-	-0.707849,-0.221865,0.670616,0.022249,-0.5,-0.059879,
-	-0.707849,-0.221865,0.670616,0.059386,-0.5,-0.020681,
-	-0.905798,0.309152,0.289748,-0.120888,0.394969,-0.02111,
-	-0.950301,-0.067247,0.303983,-0.120888,-0.240071,-0.02111,
-	-0.941009,0.154576,0.301011,-0.087986,0.394969,0.081748,
-	-0.083052,-0.217721,-0.972471,0.022249,-0.5,-0.059879,
-	-0.083052,-0.217721,-0.972471,-0.031551,-0.5,-0.055285,
-	-0.084182,-0.145927,-0.985707,-0.060985,-0.240071,-0.110965,
-	-0.084866,-0.072964,-0.993717,0.046616,-0.240071,-0.120155,
-	-0.083916,0.165753,-0.98259,-0.060985,0.394969,-0.110965,
-	-0.080281,0.331506,-0.940031,0.046616,0.394969,-0.120155,
-	-0.080281,0.331506,-0.940031,0.046616,0.394969,-0.120155,
-	-0.074495,0.483301,-0.872279,-0.031551,0.5,-0.055285,
-	-0.074495,0.483301,-0.872279,0.022249,0.5,-0.059879,
-	0.987687,-0.072964,0.138384,0.105904,-0.240071,0.065189,
-	0.96657,-0.217721,0.135426,0.051893,-0.5,0.032792,
-	0.979726,-0.145927,0.137269,0.120888,-0.240071,-0.041759,
-	-0.084866,-0.072964,-0.993717,0.046616,-0.240071,-0.120155,
-	-0.084182,-0.145927,-0.985707,-0.060985,-0.240071,-0.110965,
-	-0.083916,0.165753,-0.98259,-0.060985,0.394969,-0.110965,
-	0.63255,0.49066,-0.599278,0.059386,0.5,-0.020681,
-	0.683508,0.336879,-0.647556,0.120888,0.394969,-0.041759,
-	0.63255,0.49066,-0.599278,0.022249,0.5,-0.059879,
-	0.933052,-0.200826,-0.298468,-0.002117,-0.240071,0.000396,
-	0.933052,-0.200826,-0.298468,-0.045051,-0.5,0.041072,
-	0.933052,-0.200826,-0.298468,-0.061503,-0.5,-0.010357,
-	-0.084866,-0.072964,-0.993717,0.046616,-0.240071,-0.120155,
-	-0.083052,-0.217721,-0.972471,0.022249,-0.5,-0.059879,
-	-0.084182,-0.145927,-0.985707,-0.060985,-0.240071,-0.110965,
-	0.502451,0.15961,0.849746,0.105904,0.394969,0.065189,
-	0.450231,0.466386,0.76143,0.051893,0.5,0.032792,
-	0.482347,0.31922,0.815745,0.012946,0.394969,0.120155,
-	0.934327,0.331506,0.130908,0.105904,0.394969,0.065189,
-	0.987687,-0.072964,0.138384,0.105904,-0.240071,0.065189,
-	0.976628,0.165753,0.136835,0.120888,0.394969,-0.041759,
-	0.083052,-0.217721,0.972471,0.022249,-0.5,-0.059879,
-	0.083052,-0.217721,0.972471,-0.002117,-0.240071,0.000396,
-	0.083052,-0.217721,0.972471,-0.031551,-0.5,-0.055285,
-	-0.950301,-0.067247,0.303983,-0.120888,-0.240071,-0.02111,
-	-0.933052,-0.200826,0.298467,-0.061503,-0.5,-0.010357,
-	-0.943803,-0.134494,0.301905,-0.087986,-0.240071,0.081748,
-	-0.788518,0.319219,-0.525679,-0.060985,0.394969,-0.110965,
-	-0.830021,-0.069797,-0.553347,-0.060985,-0.240071,-0.110965,
-	-0.821384,0.15961,-0.547589,-0.120888,0.394969,-0.02111,
-	0.503992,-0.139595,0.852353,0.105904,-0.240071,0.065189,
-	0.507735,-0.069797,0.858681,0.012946,-0.240071,0.120155,
-	0.497804,-0.208368,0.841887,0.005415,-0.5,0.060275,
-	0.074495,0.483301,0.872279,0.022249,0.5,-0.059879,
-	0.074495,0.483301,0.872279,-0.031551,0.5,-0.055285,
-	0.074495,0.483301,0.872279,-0.002117,0.394969,0.000396,
-	-0.497804,-0.208368,-0.841887,0.051893,-0.5,0.032792,
-	-0.497804,-0.208368,-0.841887,0.005415,-0.5,0.060275,
-	-0.497804,-0.208368,-0.841887,-0.002117,-0.240071,0.000396,
-	-0.943803,-0.134494,0.301905,-0.087986,-0.240071,0.081748,
-	-0.933052,-0.200826,0.298467,-0.061503,-0.5,-0.010357,
-	-0.933052,-0.200826,0.298468,-0.045051,-0.5,0.041072,
-	-0.96657,-0.217721,-0.135426,-0.002117,-0.240071,0.000396,
-	-0.96657,-0.217721,-0.135426,0.059386,-0.5,-0.020681,
-	-0.96657,-0.217721,-0.135426,0.051893,-0.5,0.032792,
-	0.736015,0.466386,0.490678,-0.031551,0.5,-0.055285,
-	0.736015,0.466386,0.490678,-0.061503,0.5,-0.010357,
-	0.736015,0.466386,0.490678,-0.002117,0.394969,0.000396,
-	0.979726,-0.145927,0.137269,0.120888,-0.240071,-0.041759,
-	0.96657,-0.217721,0.135426,0.051893,-0.5,0.032792,
-	0.96657,-0.217721,0.135426,0.059386,-0.5,-0.020681,
-	0.63255,0.49066,-0.599278,0.022249,0.5,-0.059879,
-	0.683508,0.336879,-0.647556,0.120888,0.394969,-0.041759,
-	0.715569,0.16844,-0.67793,0.046616,0.394969,-0.120155,
-	-0.736016,0.466386,-0.490678,-0.061503,0.5,-0.010357,
-	-0.788518,0.319219,-0.525679,-0.060985,0.394969,-0.110965,
-	-0.821384,0.15961,-0.547589,-0.120888,0.394969,-0.02111,
-	-0.788518,0.319219,-0.525679,-0.060985,0.394969,-0.110965,
-	-0.736016,0.466386,-0.490678,-0.061503,0.5,-0.010357,
-	-0.736015,0.466386,-0.490678,-0.031551,0.5,-0.055285,
-	-0.849396,0.452441,0.271706,-0.045051,0.5,0.041072,
-	-0.849396,0.45244,0.271707,-0.061503,0.5,-0.010357,
-	-0.905798,0.309152,0.289748,-0.120888,0.394969,-0.02111,
-	-0.45023,0.466386,-0.76143,0.051893,0.5,0.032792,
-	-0.45023,0.466386,-0.76143,-0.002117,0.394969,0.000396,
-	-0.45023,0.466386,-0.76143,0.005415,0.5,0.060275,
-	0.723931,-0.074368,-0.685852,0.120888,-0.240071,-0.041759,
-	0.707849,-0.221865,-0.670616,0.059386,-0.5,-0.020681,
-	0.717867,-0.148736,-0.680107,0.046616,-0.240071,-0.120155,
-	-0.63255,0.49066,0.599278,0.022249,0.5,-0.059879,
-	-0.63255,0.49066,0.599278,-0.002117,0.394969,0.000396,
-	-0.63255,0.49066,0.599278,0.059386,0.5,-0.020681,
-	-0.351369,0.154576,0.923388,0.012946,0.394969,0.120155,
-	-0.338222,0.309153,0.888837,-0.087986,0.394969,0.081748,
-	-0.354839,-0.067247,0.932506,-0.087986,-0.240071,0.081748,
-	0.849395,0.452441,-0.271707,-0.045051,0.5,0.041072,
-	0.849395,0.452441,-0.271707,-0.002117,0.394969,0.000396,
-	0.849395,0.452441,-0.271707,-0.061503,0.5,-0.010357,
-	0.502451,0.15961,0.849746,0.105904,0.394969,0.065189,
-	0.507735,-0.069797,0.858681,0.012946,-0.240071,0.120155,
-	0.503992,-0.139595,0.852353,0.105904,-0.240071,0.065189,
-	-0.317161,0.452441,0.83349,0.005415,0.5,0.060275,
-	-0.317162,0.452441,0.83349,-0.045051,0.5,0.041072,
-	-0.338222,0.309153,0.888837,-0.087986,0.394969,0.081748,
-	-0.080281,0.331506,-0.940031,0.046616,0.394969,-0.120155,
-	-0.083916,0.165753,-0.98259,-0.060985,0.394969,-0.110965,
-	-0.074495,0.483301,-0.872279,-0.031551,0.5,-0.055285,
-	0.715569,0.16844,-0.67793,0.046616,0.394969,-0.120155,
-	0.723931,-0.074368,-0.685852,0.120888,-0.240071,-0.041759,
-	0.717867,-0.148736,-0.680107,0.046616,-0.240071,-0.120155,
-	0.866986,0.483301,0.121473,0.059386,0.5,-0.020681,
-	0.934327,0.331506,0.130908,0.105904,0.394969,0.065189,
-	0.976628,0.165753,0.136835,0.120888,0.394969,-0.041759,
-	-0.866986,0.483301,-0.121473,0.059386,0.5,-0.020681,
-	-0.866986,0.483301,-0.121473,-0.002117,0.394969,0.000396,
-	-0.866986,0.483301,-0.121473,0.051893,0.5,0.032792,
-	-0.352413,-0.134494,0.92613,0.012946,-0.240071,0.120155,
-	-0.348399,-0.200826,0.91558,-0.045051,-0.5,0.041072,
-	-0.348399,-0.200826,0.91558,0.005415,-0.5,0.060275,
-	-0.821384,0.15961,-0.547589,-0.120888,0.394969,-0.02111,
-	-0.830021,-0.069797,-0.553347,-0.060985,-0.240071,-0.110965,
-	-0.823903,-0.139594,-0.549269,-0.120888,-0.240071,-0.02111,
-	-0.941009,0.154576,0.301011,-0.087986,0.394969,0.081748,
-	-0.950301,-0.067247,0.303983,-0.120888,-0.240071,-0.02111,
-	-0.943803,-0.134494,0.301905,-0.087986,-0.240071,0.081748,
-	-0.849396,0.452441,0.271706,-0.045051,0.5,0.041072,
-	-0.905798,0.309152,0.289748,-0.120888,0.394969,-0.02111,
-	-0.941009,0.154576,0.301011,-0.087986,0.394969,0.081748,
-	0.317162,0.452441,-0.83349,0.005415,0.5,0.060275,
-	0.317162,0.452441,-0.83349,-0.002117,0.394969,0.000396,
-	0.317162,0.452441,-0.83349,-0.045051,0.5,0.041072,
-	-0.823903,-0.139594,-0.549269,-0.120888,-0.240071,-0.02111,
-	-0.813787,-0.208368,-0.542525,-0.031551,-0.5,-0.055285,
-	-0.813787,-0.208368,-0.542526,-0.061503,-0.5,-0.010357,
-	-0.813787,-0.208368,-0.542525,-0.031551,-0.5,-0.055285,
-	-0.823903,-0.139594,-0.549269,-0.120888,-0.240071,-0.02111,
-	-0.830021,-0.069797,-0.553347,-0.060985,-0.240071,-0.110965,
-	0.348399,-0.200826,-0.91558,0.005415,-0.5,0.060275,
-	0.348399,-0.200826,-0.91558,-0.045051,-0.5,0.041072,
-	0.348399,-0.200826,-0.91558,-0.002117,-0.240071,0.000396,
-	-0.352413,-0.134494,0.92613,0.012946,-0.240071,0.120155,
-	-0.354839,-0.067247,0.932506,-0.087986,-0.240071,0.081748,
-	-0.348399,-0.200826,0.91558,-0.045051,-0.5,0.041072,
-	-0.351369,0.154576,0.923388,0.012946,0.394969,0.120155,
-	-0.317161,0.452441,0.83349,0.005415,0.5,0.060275,
-	-0.338222,0.309153,0.888837,-0.087986,0.394969,0.081748,
-	0.503992,-0.139595,0.852353,0.105904,-0.240071,0.065189,
-	0.497804,-0.208368,0.841887,0.005415,-0.5,0.060275,
-	0.497804,-0.208368,0.841887,0.051893,-0.5,0.032792,
-	0.683508,0.336879,-0.647556,0.120888,0.394969,-0.041759,
-	0.723931,-0.074368,-0.685852,0.120888,-0.240071,-0.041759,
-	0.715569,0.16844,-0.67793,0.046616,0.394969,-0.120155,
-	0.976628,0.165753,0.136835,0.120888,0.394969,-0.041759,
-	0.987687,-0.072964,0.138384,0.105904,-0.240071,0.065189,
-	0.979726,-0.145927,0.137269,0.120888,-0.240071,-0.041759,
-	0.502451,0.15961,0.849746,0.105904,0.394969,0.065189,
-	0.482347,0.31922,0.815745,0.012946,0.394969,0.120155,
-	0.507735,-0.069797,0.858681,0.012946,-0.240071,0.120155,
-	0.866986,0.483301,0.121473,0.051893,0.5,0.032792,
-	0.934327,0.331506,0.130908,0.105904,0.394969,0.065189,
-	0.866986,0.483301,0.121473,0.059386,0.5,-0.020681,
-	0.450231,0.466386,0.76143,0.051893,0.5,0.032792,
-	0.45023,0.466386,0.76143,0.005415,0.5,0.060275,
-	0.482347,0.31922,0.815745,0.012946,0.394969,0.120155,
-	0.717867,-0.148736,-0.680107,0.046616,-0.240071,-0.120155,
-	0.707849,-0.221865,-0.670616,0.059386,-0.5,-0.020681,
-	0.707849,-0.221865,-0.670616,0.022249,-0.5,-0.059879
-};
-static const struct gllist toaster_jet_frame = { GL_N3F_V3F, GL_TRIANGLES, 168, toaster_jet_data, 0 };
-const struct gllist *toaster_jet = &toaster_jet_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_jet[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000b\000\000\000\250\000\000\000T\000\000\000T'\341"
+ "\262\000\000\000\000u\345\2012\000\001\2007u\377\213\302\032\000\000\000"
+ "A\360\001\200Y\375\000\000\354\367\001\200\331\361\000\000P\003\034e\302"
+ "\036\000\000z\351\213\302\355\024\000\000P\003\213\302\302\036\000\000u\377"
+ "\213\302\032\000\000\000\262\005\001\200\254\360\000\0004\017\001\200\265"
+ "\372\000\000\016\341\034e\231\372\000\000\016\341\213\302\231\372\000\000"
+ "z\351\034e\355\024\000\000\262\005\001\200\254\360\000\000\354\367\001\200"
+ "\331\361\000\000c\360\213\302\230\343\000\000\357\013\213\302>\341\000\000"
+ "c\360\034e\230\343\000\000\357\013\034e>\341\000\000\354\367\377\177\331"
+ "\361\000\000\262\005\377\177\254\360\000\000\034\033\213\302\260\020\000"
+ "\000I\015\001\200e\010\000\000\362\036\213\302O\365\000\0004\017\377\177"
+ "\265\372\000\000\362\036\034eO\365\000\000\262\005\377\177\254\360\000\000"
+ "u\377\213\302\032\000\000\000x\364\001\200\204\012\000\000A\360\001\200Y"
+ "\375\000\000\034\033\034e\260\020\000\000I\015\377\177e\010\000\000P\003"
+ "\034e\302\036\000\000\034\033\034e\260\020\000\000\362\036\034eO\365\000"
+ "\000\262\005\001\200\254\360\000\000u\377\213\302\032\000\000\000\354\367"
+ "\001\200\331\361\000\000A\360\001\200Y\375\000\000z\351\213\302\355\024\000"
+ "\000c\360\034e\230\343\000\000c\360\213\302\230\343\000\000\016\341\034e"
+ "\231\372\000\000\034\033\213\302\260\020\000\000P\003\213\302\302\036\000"
+ "\000c\001\001\200n\017\000\000\262\005\377\177\254\360\000\000\354\367\377"
+ "\177\331\361\000\000u\377\034e\032\000\000\000I\015\001\200e\010\000\000"
+ "c\001\001\200n\017\000\000u\377\213\302\032\000\000\000x\364\001\200\204"
+ "\012\000\000u\377\213\302\032\000\000\0004\017\001\200\265\372\000\000I\015"
+ "\001\200e\010\000\000\354\367\377\177\331\361\000\000A\360\377\177Y\375\000"
+ "\000u\377\034e\032\000\000\0004\017\001\200\265\372\000\000\357\013\034e"
+ ">\341\000\000A\360\377\177Y\375\000\000\354\367\377\177\331\361\000\000x"
+ "\364\377\177\204\012\000\000A\360\377\177Y\375\000\000I\015\377\177e\010"
+ "\000\000u\377\034e\032\000\000\000c\001\377\177n\017\000\000\362\036\213"
+ "\302O\365\000\0004\017\001\200\265\372\000\000\357\013\213\302>\341\000\000"
+ "\262\005\377\177\254\360\000\000u\377\034e\032\000\000\0004\017\377\177\265"
+ "\372\000\000z\351\034e\355\024\000\000x\364\377\177\204\012\000\000u\377"
+ "\034e\032\000\000\000A\360\377\177Y\375\000\000c\001\377\177n\017\000\000"
+ "x\364\377\177\204\012\000\0004\017\377\177\265\372\000\0004\017\377\177\265"
+ "\372\000\000u\377\034e\032\000\000\000I\015\377\177e\010\000\000x\364\001"
+ "\200\204\012\000\000c\001\001\200n\017\000\000\016\341\213\302\231\372\000"
+ "\000c\001\377\177n\017\000\000u\377\034e\032\000\000\000x\364\377\177\204"
+ "\012\000\000\354\367\001\200\331\361\000\000A\360\001\200Y\375\000\000c\001"
+ "\001\200n\017\000\000x\364\001\200\204\012\000\000u\377\213\302\032\000\000"
+ "\000I\015\001\200e\010\000\000I\015\377\177e\010\000\000c\001\377\177n\017"
+ "\000\000\262\005\001\200\254\360\000\000B\357B\357B\357\341\016\337\372\340"
+ "\364\310\356\310\356\310\356\264\032\245\372\252\016\227\211\227\211\220"
+ "\212\211\212\222v\240w\254x\254xi\370]\353c\361[PeK[Pm\324m\324m\324*\015"
+ "\042#&\031U\036a\020\010\352\010\352\010\352\255\356\251\364\232B\207\312"
+ "\216;+\364-\372)\357\007+\007+\007+\222\252\222\252\222\252\255\356\226\336"
+ "\226\336\226\3367#7#7#]\353qE\244H\244H\273%\273%\244]\244]\244]y\277m\271"
+ "s\274\321$\321$\321$\344\032Z:Z:Z:\347$\347$K*\2534\2534\2534\342\357\342"
+ "\357\215\306[f[f[f\222\303\222\303n\237n\237n\237)\357K*\042#m\271\000\000"
+ "\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010\000\011\000"
+ "\012\000\013\000\014\000\015\000\016\000\017\000\020\000\021\000\021\000"
+ "\022\000\023\000\024\000\025\000\026\000\017\000\016\000\020\000\027\000"
+ "\030\000\031\000\032\000\033\000\034\000\017\000\014\000\016\000\035\000"
+ "\036\000\037\000 \000\024\000!\000\042\000#\000$\000\012\000%\000&\000'\000"
+ "(\000)\000*\000+\000,\000-\000.\000/\0000\0001\0002\000&\000%\0003\0004\000"
+ "5\0006\0007\0008\0009\000\026\000\025\000:\000\031\000\030\000;\000<\000"
+ "'\000)\000'\000<\000=\000>\000\077\000\011\000@\000A\000B\000C\000D\000E"
+ "\000F\000G\000H\000\003\000I\000\004\000J\000K\000L\000\035\000+\000*\000"
+ "M\000N\000I\000\021\000\020\000\022\000;\000C\000E\000O\000 \000!\000P\000"
+ "Q\000R\000\005\000S\000T\000)\000(\000U\000\013\000\012\000&\000>\000\011"
+ "\000\013\000V\000W\000X\000U\000Y\000Z\000Y\000U\000(\000[\000\134\000]\000"
+ "\005\000\004\000S\000\003\000M\000I\000*\000,\000^\000\030\000C\000;\000"
+ "!\000\024\000\026\000\035\000\037\000+\000_\000 \000O\000\036\000`\000\037"
+ "\000E\000D\000a\000\000\000\001\000\001\000\002\000\000\000\002\000\003\000"
+ "\004\000\004\000\005\000\003\000\005\000\000\000\007\000\007\000\010\000"
+ "\000\000\010\000\011\000\012\000\012\000\013\000\011\000\013\000\002\000"
+ "\007\000\002\000\016\000\007\000\016\000\017\000\020\000\020\000\021\000"
+ "\017\000\021\000\021\000\022\000\022\000\023\000\021\000\023\000\024\000"
+ "\025\000\025\000\026\000\024\000\026\000\016\000\017\000\016\000\020\000"
+ "\027\000\030\000\023\000\030\000\023\000\027\000\000\000\033\000\001\000"
+ "\033\000\007\000\017\000\035\000\036\000\003\000\036\000\003\000\035\000"
+ "\024\000\035\000\024\000\030\000\030\000\035\000\001\000\012\000\001\000"
+ "\004\000\004\000\012\000\011\000\016\000\011\000\020\000\005\000\024\000"
+ "\005\000,\000\024\000,\000\022\000/\000\023\000/\000\025\000,\000\000\000"
+ ",\000\000\000\025\000\004\000\033\000\010\000\025\000\022\0008\000/\0008"
+ "\000\010\000\026\000\021\000\030\000\020\0008\000\011\0008\000\020\000\022"
+ "\0008\000>\000\011\000>\000\036\000/\000/\000B\000\036\000B\000\010\000\017"
+ "\000\017\000\026\000\027\000/\000\003\000\013\000\004\000\013\000/\000>\000"
+ "\005\000\035\000>\000B\000\013\000>\000\013\000B\000\021\000\026\000\027"
+ "\000\035\000\027\000\036\000\005\000\033\000\033\000,\000\012\000\016\000"
+ "\002\000\012\000\003\000B\000\026\000\030\000"
+;
+const unsigned long toaster_jet_size = 1732;
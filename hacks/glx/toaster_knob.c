@@ -1,76 +1,51 @@
-/* Generated from "toaster_knob.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_knob.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_knob_data[] = {
-	0.894098,0.012135,-0.447706,0.220972,-0.2059,-0.429683,
-	0.894098,0.012135,-0.447706,0.372946,0.214524,-0.114788,
-	0.894098,0.012135,-0.447706,0.372946,-0.21412,-0.126406,
-	0.894098,0.012135,-0.447706,0.372946,0.214524,-0.114788,
-	0.894098,0.012135,-0.447706,0.220972,-0.2059,-0.429683,
-	0.894098,0.012135,-0.447706,0.220972,0.222744,-0.418065,
-	-0.999879,-0.000422,0.015577,-0.367658,0.209613,0.06637,
-	-0.999879,-0.000422,0.015577,-0.372946,-0.209838,-0.284406,
-	-0.999879,-0.000422,0.015577,-0.367658,-0.21903,0.054752,
-	-0.999879,-0.000422,0.015577,-0.372946,-0.209838,-0.284406,
-	-0.999879,-0.000422,0.015577,-0.367658,0.209613,0.06637,
-	-0.999879,-0.000422,0.015577,-0.372946,0.218806,-0.272788,
-	0.907621,-0.011374,0.419637,0.372946,-0.21412,-0.126406,
-	0.911978,-0.115261,0.393715,0.2305,0.206179,0.193077,
-	0.907621,-0.011374,0.419637,0.2305,-0.222464,0.181458,
-	0.911978,-0.115261,0.393715,0.2305,0.206179,0.193077,
-	0.907621,-0.011374,0.419637,0.372946,-0.21412,-0.126406,
-	0.907621,-0.011374,0.419637,0.372946,0.214524,-0.114788,
-	-0.611231,-0.021444,0.791162,-0.099099,-0.22465,0.262081,
-	-0.611231,-0.021444,0.791162,-0.367658,0.209613,0.06637,
-	-0.611231,-0.021444,0.791162,-0.367658,-0.21903,0.054752,
-	-0.611231,-0.021444,0.791162,-0.367658,0.209613,0.06637,
-	-0.611231,-0.021444,0.791162,-0.099099,-0.22465,0.262081,
-	-0.655778,-0.184059,0.732173,-0.099099,0.203994,0.2737,
-	-0,-0.999633,-0.027095,0.220972,-0.2059,-0.429683,
-	-0,-0.999633,-0.027095,-0.372946,-0.209838,-0.284406,
-	-0,-0.999633,-0.027096,-0.11098,-0.203994,-0.5,
-	-0,-0.999633,-0.027095,-0.372946,-0.209838,-0.284406,
-	-0,-0.999633,-0.027095,0.220972,-0.2059,-0.429683,
-	0,-0.999633,-0.027094,0.372946,-0.21412,-0.126406,
-	-0,-0.999633,-0.027095,-0.372946,-0.209838,-0.284406,
-	0,-0.999633,-0.027094,0.372946,-0.21412,-0.126406,
-	0,-0.999633,-0.027095,-0.367658,-0.21903,0.054752,
-	0,-0.999633,-0.027095,-0.367658,-0.21903,0.054752,
-	0,-0.999633,-0.027094,0.372946,-0.21412,-0.126406,
-	0,-0.999633,-0.027095,0.2305,-0.222464,0.181458,
-	0,-0.999633,-0.027095,-0.367658,-0.21903,0.054752,
-	0,-0.999633,-0.027095,0.2305,-0.222464,0.181458,
-	0,-0.999633,-0.027095,0.065701,-0.223557,0.22177,
-	0,-0.999633,-0.027095,-0.367658,-0.21903,0.054752,
-	0,-0.999633,-0.027095,0.065701,-0.223557,0.22177,
-	0,-0.999633,-0.027095,-0.099099,-0.22465,0.262081,
-	-0.635597,0.020918,-0.771737,-0.11098,0.22465,-0.488382,
-	-0.635597,0.020918,-0.771737,-0.372946,-0.209838,-0.284406,
-	-0.635597,0.020918,-0.771737,-0.372946,0.218806,-0.272788,
-	-0.635597,0.020918,-0.771737,-0.372946,-0.209838,-0.284406,
-	-0.635597,0.020918,-0.771737,-0.11098,0.22465,-0.488382,
-	-0.635597,0.020918,-0.771737,-0.11098,-0.203994,-0.5,
-	0.207302,0.026506,-0.977918,0.220972,0.222744,-0.418065,
-	0.207302,0.026506,-0.977918,-0.11098,-0.203994,-0.5,
-	0.207302,0.026506,-0.977918,-0.11098,0.22465,-0.488382,
-	0.207302,0.026506,-0.977918,-0.11098,-0.203994,-0.5,
-	0.207302,0.026506,-0.977918,0.220972,0.222744,-0.418065,
-	0.207302,0.026506,-0.977918,0.220972,-0.2059,-0.429683,
-	0.237686,-0.026318,0.970985,0.065701,-0.223557,0.22177,
-	0.237686,-0.026318,0.970985,-0.099099,0.203994,0.2737,
-	0.237686,-0.026318,0.970985,-0.099099,-0.22465,0.262081,
-	-0.6794,-0.340802,0.649823,0.116801,0.205086,0.5,
-	-0.655778,-0.184059,0.732173,-0.099099,0.203994,0.2737,
-	-0.6794,-0.340802,0.649823,0.065701,-0.223557,0.22177,
-	0.237686,-0.026318,0.970985,0.2305,0.206179,0.193077,
-	0.237686,-0.026318,0.970985,0.065701,-0.223557,0.22177,
-	0.237686,-0.026318,0.970985,0.2305,-0.222464,0.181458,
-	0.911978,-0.115261,0.393715,0.2305,0.206179,0.193077,
-	0.88909,-0.319042,0.328226,0.116801,0.205086,0.5,
-	0.88909,-0.319042,0.328226,0.065701,-0.223557,0.22177
-};
-static const struct gllist toaster_knob_frame = { GL_N3F_V3F, GL_TRIANGLES, 66, toaster_knob_data, 0 };
-const struct gllist *toaster_knob = &toaster_knob_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_knob[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000)\000\000\000B\000\000\000%\000\000\000\272\255\230"
+ "2\272\255\030\264\000\000\000\000\000\001\2007\2218K\313\001\222\000\000"
+ "y_\3536\236\342\000\000y_0\311\244\337\000\000\2218\0059\373\224\000\000"
+ "\342\241\2515\376\020\000\000\207\240I\3122\267\000\000\342\241\356\307\004"
+ "\016\000\000\207\240\0038+\272\000\000y_0\311\244\337\000\000\002;\3104m"
+ "1\000\000\002;\015\307t.\000\000y_\3536\236\342\000\000\242\346~\306\027"
+ "C\000\000\342\241\2515\376\020\000\000\342\241\356\307\004\016\000\000\242"
+ "\34694\021F\000\000\2218K\313\001\222\000\000\207\240I\3122\267\000\000\227"
+ "\343\307\313\001\200\000\000y_0\311\244\337\000\000\342\241\356\307\004\016"
+ "\000\000\002;\015\307t.\000\000\322\020\305\306\3058\000\000\242\346~\306"
+ "\027C\000\000\227\343\2029\372\202\000\000\207\240I\3122\267\000\000\207"
+ "\240\0038+\272\000\000\227\343\307\313\001\200\000\000\2218\0059\373\224"
+ "\000\000\227\343\307\313\001\200\000\000\227\343\2029\372\202\000\000\221"
+ "8K\313\001\222\000\000\322\020\305\306\3058\000\000\242\34694\021F\000\000"
+ "\242\346~\306\027C\000\000\346\035\2004\377\177\000\000\322\020\305\306\305"
+ "8\000\000\002;\3104m1\000\000\002;\015\307t.\000\000\346\035\2004\377\177"
+ "\000\000\322\020\305\306\3058\000\000~+~+~+~+\203\000\203\000\203\000\203"
+ "\000V\377R\366V\377V\377\311\376\311\376\311\376\313\361\375\201\375\201"
+ "\375\201\003\201\003\201\003\201\003\201\003\201\203F\203F\203F\203F|i|i"
+ "|i|i\030\375\030\375\030\375\314\346\314\346\030\375\030\375I\346I\346\000"
+ "\000\000\000\001\000\002\000\001\000\000\000\003\000\004\000\005\000\006"
+ "\000\005\000\004\000\007\000\010\000\011\000\012\000\011\000\010\000\013"
+ "\000\014\000\015\000\016\000\015\000\014\000\017\000\020\000\021\000\022"
+ "\000\021\000\020\000\023\000\021\000\023\000\024\000\024\000\023\000\025"
+ "\000\024\000\025\000\026\000\024\000\026\000\027\000\030\000\031\000\032"
+ "\000\031\000\030\000\033\000\034\000\035\000\036\000\035\000\034\000\037"
+ "\000 \000!\000\042\000#\000\017\000$\000%\000 \000&\000\011\000'\000(\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\001\000"
+ "\003\000\004\000\005\000\005\000\006\000\004\000\006\000\004\000\007\000"
+ "\005\000\007\000\002\000\011\000\011\000\012\000\002\000\012\000\001\000"
+ "\011\000\004\000\014\000\006\000\014\000\014\000\017\000\004\000\017\000"
+ "\000\000\005\000\005\000\022\000\000\000\022\000\002\000\005\000\002\000"
+ "\006\000\006\000\012\000\012\000\026\000\006\000\026\000\014\000\026\000"
+ "\005\000\030\000\007\000\030\000\022\000\030\000\003\000\022\000\003\000"
+ "\030\000\017\000\026\000\017\000#\000\026\000#\000\011\000\026\000\011\000"
+ "#\000"
+;
+const unsigned long toaster_knob_size = 772;
@@ -1,106 +1,64 @@
-/* Generated from "toaster_slots.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_slots.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_slots_data[] = {
-	0.999485,-0.028052,-0.015598,-0.18331,-0.276766,0.209005,
-	0.998257,-0.059011,0,-0.196507,-0.5,0.123502,
-	0.99963,-0.0187,-0.019753,-0.196507,-0.5,-0.235113,
-	0.999546,0,-0.030136,-0.18331,0,0.235113,
-	0.999485,-0.028052,-0.015598,-0.18331,-0.276766,0.209005,
-	0.99963,-0.0187,-0.019753,-0.196507,-0.5,-0.235113,
-	0,1,0,-0.059418,-0.5,0.123502,
-	0,1,0,-0.058641,-0.5,-0.235113,
-	0,1,0,-0.196507,-0.5,-0.235113,
-	0,1,0,-0.059418,-0.5,0.123502,
-	0,1,0,-0.196507,-0.5,-0.235113,
-	0,1,0,-0.196507,-0.5,0.123502,
-	0.998257,0.059011,0,-0.196507,0.5,0.123502,
-	0.999485,0.028052,-0.015598,-0.18331,0.276766,0.209005,
-	0.99963,0.0187,-0.019753,-0.196507,0.5,-0.235113,
-	0.99963,0.0187,-0.019753,-0.196507,0.5,-0.235113,
-	0.999485,0.028052,-0.015598,-0.18331,0.276766,0.209005,
-	0.999546,0,-0.030136,-0.18331,0,0.235113,
-	0,-1,0,-0.196507,0.5,0.123502,
-	0,-1,0,-0.196507,0.5,-0.235113,
-	0,-1,0,-0.059418,0.5,0.123502,
-	0.99963,0.0187,-0.019753,-0.196507,0.5,-0.235113,
-	0.999546,0,-0.030136,-0.18331,0,0.235113,
-	0.99963,-0.0187,-0.019753,-0.196507,-0.5,-0.235113,
-	-0.999997,-0.001316,-0.001828,-0.058641,0.5,-0.235113,
-	-0.999998,0,-0.002211,-0.058641,0,0.235113,
-	-0.999994,-0.001974,-0.002741,-0.059418,0.276766,0.209005,
-	-0.999994,0.001974,-0.002741,-0.059418,-0.276766,0.209005,
-	-0.999997,0.001316,-0.001828,-0.058641,-0.5,-0.235113,
-	-0.999997,0.00083,-0.002166,-0.059418,-0.5,0.123502,
-	-0.999998,0,-0.002211,-0.058641,0,0.235113,
-	-0.999997,0.001316,-0.001828,-0.058641,-0.5,-0.235113,
-	-0.999994,0.001974,-0.002741,-0.059418,-0.276766,0.209005,
-	-0.999997,-0.001316,-0.001828,-0.058641,0.5,-0.235113,
-	-0.999997,0.001316,-0.001828,-0.058641,-0.5,-0.235113,
-	-0.999998,0,-0.002211,-0.058641,0,0.235113,
-	0,0,1,-0.058641,-0.5,-0.235113,
-	0,0,1,-0.058641,0.5,-0.235113,
-	0,0,1,-0.196507,0.5,-0.235113,
-	0,0,1,-0.058641,-0.5,-0.235113,
-	0,0,1,-0.196507,0.5,-0.235113,
-	0,0,1,-0.196507,-0.5,-0.235113,
-	0,-1,0,-0.059418,0.5,0.123502,
-	0,-1,0,-0.196507,0.5,-0.235113,
-	0,-1,0,-0.058641,0.5,-0.235113,
-	-0.999997,-0.001316,-0.001828,-0.058641,0.5,-0.235113,
-	-0.999994,-0.001974,-0.002741,-0.059418,0.276766,0.209005,
-	-0.999997,-0.00083,-0.002166,-0.059418,0.5,0.123502,
-	0.999997,-0.001316,-0.001828,0.058641,0.5,-0.235113,
-	0.999998,0,-0.002211,0.058641,0,0.235113,
-	0.999997,0.001316,-0.001828,0.058641,-0.5,-0.235113,
-	0.999994,0.001974,-0.002741,0.059418,-0.276766,0.209005,
-	0.999997,0.00083,-0.002166,0.059418,-0.5,0.123502,
-	0.999997,0.001316,-0.001828,0.058641,-0.5,-0.235113,
-	0.999997,-0.001316,-0.001828,0.058641,0.5,-0.235113,
-	0.999994,-0.001974,-0.002741,0.059418,0.276766,0.209005,
-	0.999998,0,-0.002211,0.058641,0,0.235113,
-	0.999998,0,-0.002211,0.058641,0,0.235113,
-	0.999994,0.001974,-0.002741,0.059418,-0.276766,0.209005,
-	0.999997,0.001316,-0.001828,0.058641,-0.5,-0.235113,
-	-0.99963,0.0187,-0.019753,0.196507,0.5,-0.235113,
-	-0.999485,0.028052,-0.015598,0.18331,0.276766,0.209005,
-	-0.998257,0.059011,0,0.196507,0.5,0.123502,
-	-0.999546,0,-0.030136,0.18331,0,0.235113,
-	-0.99963,-0.0187,-0.019753,0.196507,-0.5,-0.235113,
-	-0.999485,-0.028052,-0.015598,0.18331,-0.276766,0.209005,
-	0,1,0,0.059418,-0.5,0.123502,
-	0,1,0,0.196507,-0.5,-0.235113,
-	0,1,0,0.058641,-0.5,-0.235113,
-	-0.999485,-0.028052,-0.015598,0.18331,-0.276766,0.209005,
-	-0.99963,-0.0187,-0.019753,0.196507,-0.5,-0.235113,
-	-0.998257,-0.059011,0,0.196507,-0.5,0.123502,
-	0,-1,0,0.059418,0.5,0.123502,
-	0,-1,0,0.196507,0.5,-0.235113,
-	0,-1,0,0.196507,0.5,0.123502,
-	0,1,0,0.196507,-0.5,0.123502,
-	0,1,0,0.196507,-0.5,-0.235113,
-	0,1,0,0.059418,-0.5,0.123502,
-	-0.99963,0.0187,-0.019753,0.196507,0.5,-0.235113,
-	-0.999546,0,-0.030136,0.18331,0,0.235113,
-	-0.999485,0.028052,-0.015598,0.18331,0.276766,0.209005,
-	-0.99963,0.0187,-0.019753,0.196507,0.5,-0.235113,
-	-0.99963,-0.0187,-0.019753,0.196507,-0.5,-0.235113,
-	-0.999546,0,-0.030136,0.18331,0,0.235113,
-	0,0,1,0.196507,0.5,-0.235113,
-	0,0,1,0.058641,-0.5,-0.235113,
-	0,0,1,0.196507,-0.5,-0.235113,
-	0,0,1,0.196507,0.5,-0.235113,
-	0,0,1,0.058641,0.5,-0.235113,
-	0,0,1,0.058641,-0.5,-0.235113,
-	0.999997,-0.00083,-0.002166,0.059418,0.5,0.123502,
-	0.999994,-0.001974,-0.002741,0.059418,0.276766,0.209005,
-	0.999997,-0.001316,-0.001828,0.058641,0.5,-0.235113,
-	0,-1,0,0.059418,0.5,0.123502,
-	0,-1,0,0.058641,0.5,-0.235113,
-	0,-1,0,0.196507,0.5,-0.235113
-};
-static const struct gllist toaster_slots_frame = { GL_N3F_V3F, GL_TRIANGLES, 96, toaster_slots_data, 0 };
-const struct gllist *toaster_slots = &toaster_slots_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_slots[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\0004\000\000\000`\000\000\000:\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\001\2007\023\321&\271\2015\000\000"
+ "\262\315\001\200\236\037\000\000\262\315\001\200\320\303\000\000\023\321"
+ "\000\0000<\000\000\312\360\001\200\236\037\000\000\375\360\001\200\320\303"
+ "\000\000\262\315\001\200\320\303\000\000\262\315\001\200\236\037\000\000"
+ "\262\315\377\177\236\037\000\000\023\321\332F\2015\000\000\262\315\377\177"
+ "\320\303\000\000\262\315\377\177\236\037\000\000\262\315\377\177\320\303"
+ "\000\000\312\360\377\177\236\037\000\000\375\360\377\177\320\303\000\000"
+ "\375\360\000\0000<\000\000\312\360\332F\2015\000\000\312\360&\271\2015\000"
+ "\000\375\360\001\200\320\303\000\000\312\360\001\200\236\037\000\000\375"
+ "\360\001\200\320\303\000\000\375\360\377\177\320\303\000\000\262\315\377"
+ "\177\320\303\000\000\262\315\001\200\320\303\000\000\375\360\377\177\320"
+ "\303\000\000\312\360\377\177\236\037\000\000\003\017\377\177\320\303\000"
+ "\000\003\017\000\0000<\000\000\003\017\001\200\320\303\000\0006\017&\271"
+ "\2015\000\0006\017\001\200\236\037\000\0006\017\332F\2015\000\000N2\377\177"
+ "\320\303\000\000\355.\332F\2015\000\000N2\377\177\236\037\000\000\355.\000"
+ "\0000<\000\000N2\001\200\320\303\000\000\355.&\271\2015\000\0006\017\001"
+ "\200\236\037\000\000N2\001\200\320\303\000\000\003\017\001\200\320\303\000"
+ "\000N2\001\200\236\037\000\0006\017\377\177\236\037\000\000N2\377\177\320"
+ "\303\000\000N2\377\177\236\037\000\000N2\001\200\236\037\000\000N2\377\177"
+ "\320\303\000\000\003\017\001\200\320\303\000\000N2\001\200\320\303\000\000"
+ "\003\017\377\177\320\303\000\0006\017\377\177\236\037\000\000\003\017\377"
+ "\177\320\303\000\000|\373x\371}\373\177\004\000\177\000\177\000\177\000\177"
+ "x\007|\005}\005\000\201\000\201\000\201\201\000\201\000\201\377\201\001\201"
+ "\000\201\000\000\000\000\000\000\000\000\000\000\201\201\000\177\000\177"
+ "\000\177\000\177\001\177\000\177\377\203\005\204\005\210\007\201\004\203"
+ "\373\204\373\000\177\000\177\000\177\210\371\000\201\000\201\000\201\000"
+ "\177\000\000\000\000\000\000\000\000\177\000\000\201\000\000\001\000\002"
+ "\000\003\000\000\000\002\000\004\000\005\000\006\000\004\000\006\000\007"
+ "\000\010\000\011\000\012\000\012\000\011\000\003\000\013\000\014\000\015"
+ "\000\012\000\003\000\002\000\016\000\017\000\020\000\021\000\022\000\023"
+ "\000\017\000\022\000\021\000\016\000\022\000\017\000\024\000\025\000\026"
+ "\000\024\000\026\000\027\000\015\000\014\000\030\000\016\000\020\000\031"
+ "\000\032\000\033\000\034\000\035\000\036\000\034\000\032\000\037\000\033"
+ "\000\033\000\035\000\034\000 \000!\000\042\000#\000$\000%\000&\000'\000("
+ "\000%\000$\000)\000*\000+\000,\000-\000'\000&\000 \000#\000!\000 \000$\000"
+ "#\000.\000/\0000\000.\0001\000/\0002\000\037\000\032\000*\0003\000+\000\000"
+ "\000\001\000\001\000\002\000\000\000\002\000\000\000\003\000\002\000\003"
+ "\000\004\000\005\000\002\000\005\000\002\000\004\000\001\000\004\000\010"
+ "\000\011\000\011\000\012\000\010\000\012\000\003\000\011\000\003\000\012"
+ "\000\012\000\015\000\010\000\015\000\002\000\012\000\016\000\017\000\017"
+ "\000\020\000\016\000\020\000\005\000\021\000\004\000\021\000\005\000\017"
+ "\000\017\000\021\000\005\000\016\000\012\000\016\000\005\000\012\000\015"
+ "\000\016\000\015\000\020\000\032\000\033\000\033\000\034\000\032\000\034"
+ "\000\035\000\036\000\034\000\036\000\034\000\035\000\032\000\037\000\033"
+ "\000\037\000\033\000\035\000 \000!\000!\000\042\000 \000\042\000#\000$\000"
+ "$\000%\000#\000%\000\036\000$\000\034\000$\000$\000)\000%\000)\000 \000*"
+ "\000\042\000*\000\036\000)\000 \000#\000!\000#\000 \000$\000\034\000 \000"
+ "\032\000 \000\037\000*\000\032\000*\000"
+;
+const unsigned long toaster_slots_size = 1024;
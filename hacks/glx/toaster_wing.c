@@ -1,43 +1,34 @@
-/* Generated from "toaster_wing.dxf" on Aug-22-2014.
-   Smoothed vertex normals. Normalized to unit bounding box.
+/* Generated from "toaster_wing.dxf" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Smoothed vertex normals at 30°. Normalized to unit bounding box.
  */
 
 #include "gllist.h"
 
-static const float toaster_wing_data[] = {
-	-0.0018,-0.000471,-0.999998,0.5,-0.248054,-0.034832,
-	-0.002699,-0.000707,-0.999996,-0.5,0.248054,-0.032483,
-	-0.001465,-0.000586,-0.999999,0.399306,0.003521,-0.034832,
-	0.301513,0.649532,0.697996,0.399306,0.003521,-0.034832,
-	0.159005,0.609129,0.776968,-0.5,0.248054,-0.032483,
-	0.244597,0.610231,0.753518,0.3827,-0.039065,0.01197,
-	0.172439,-0.122105,0.977423,0.5,-0.248054,-0.034832,
-	0.064485,-0.135273,0.988708,0.3827,-0.039065,0.01197,
-	-0.040003,-0.177228,0.983357,-0.466673,-0.094003,-0.032483,
-	-0.0018,-0.000471,-0.999998,0.5,-0.248054,-0.034832,
-	-0.002468,-0.00024,-0.999997,-0.466673,-0.094003,-0.032483,
-	-0.002699,-0.000707,-0.999996,-0.5,0.248054,-0.032483,
-	0.064485,-0.135273,0.988708,0.3827,-0.039065,0.01197,
-	-0.051938,-0.00506,0.998637,-0.5,0.248054,-0.032483,
-	-0.040003,-0.177228,0.983357,-0.466673,-0.094003,-0.032483,
-	0.064485,-0.135273,0.988708,0.3827,-0.039065,0.01197,
-	-0.031687,-0.285224,0.957937,-0.482606,0.13385,0.034832,
-	-0.040003,-0.177228,0.983357,-0.466673,-0.094003,-0.032483,
-	0.370589,0,0.928797,0.5,-0.065307,-0.034832,
-	0.064485,-0.135273,0.988708,0.3827,-0.039065,0.01197,
-	0.172439,-0.122105,0.977423,0.5,-0.248054,-0.034832,
-	0.244597,0.610231,0.753518,0.3827,-0.039065,0.01197,
-	0.159005,0.609129,0.776968,-0.5,0.248054,-0.032483,
-	0.125848,0.517903,0.846131,-0.482606,0.13385,0.034832,
-	-0.772167,-0.309062,-0.555193,0.399306,0.003521,-0.034832,
-	-0.772167,-0.309062,-0.555193,0.5,-0.248054,-0.034832,
-	-0.772167,-0.309062,-0.555193,0.3827,-0.039065,0.01197,
-	0.408832,0.598113,0.689287,0.5,-0.065307,-0.034832,
-	0.301513,0.649532,0.697996,0.399306,0.003521,-0.034832,
-	0.244597,0.610231,0.753518,0.3827,-0.039065,0.01197,
-	-0.0018,-0.000471,-0.999998,0.5,-0.248054,-0.034832,
-	-0.001465,-0.000586,-0.999999,0.399306,0.003521,-0.034832,
-	0,0,-1,0.5,-0.065307,-0.034832
-};
-static const struct gllist toaster_wing_frame = { GL_N3F_V3F, GL_TRIANGLES, 33, toaster_wing_data, 0 };
-const struct gllist *toaster_wing = &toaster_wing_frame;
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char toaster_wing[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\023\000\000\000!\000\000\000\017\000\000\000#\035"
+ "\220\262\000\000\000\000O\2136\262\000\001\2007\377\177\200\300\025\367\000"
+ "\000\001\200\200\077\257\367\000\0008f\347\000\025\367\000\0008f\347\000"
+ "\025\367\000\000\001\200\200\077\257\367\000\000\370a\000\366\020\003\000"
+ "\000\377\177\200\300\025\367\000\000\370a\000\366\020\003\000\000\211\210"
+ "\360\347\257\367\000\000\211\210\360\347\257\367\000\000\001\200\200\077"
+ "\257\367\000\000u\204D\042\353\010\000\000\377\177H\357\025\367\000\000u"
+ "\204D\042\353\010\000\0008f\347\000\025\367\000\000\377\177\200\300\025\367"
+ "\000\000\370a\000\366\020\003\000\000\377\177H\357\025\367\000\000\377\177"
+ "H\357\025\367\000\000\201\201\201\201\201\201\0272\0152\0230\021\364\007"
+ "\362\374\355\201\201\372\377\375\344$\000\013,\231\275\231\275\231\275\037"
+ "-\177\177\000\000\000\000\001\000\002\000\003\000\004\000\005\000\006\000"
+ "\007\000\010\000\000\000\011\000\001\000\007\000\012\000\010\000\007\000"
+ "\013\000\010\000\014\000\007\000\006\000\005\000\004\000\015\000\016\000"
+ "\017\000\020\000\021\000\003\000\005\000\000\000\002\000\022\000\000\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\001\000\005\000\002\000"
+ "\005\000\000\000\005\000\005\000\010\000\000\000\010\000\001\000\010\000"
+ "\005\000\013\000\010\000\013\000\005\000\014\000\000\000\014\000\001\000"
+ "\013\000\002\000\014\000"
+;
+const unsigned long toaster_wing_size = 400;
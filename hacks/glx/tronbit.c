@@ -28,10 +28,26 @@
 
 #include "gllist.h"
 
-extern const struct gllist *tronbit_idle1, *tronbit_idle2,
-  *tronbit_no, *tronbit_yes;
-static const struct gllist * const *all_objs[] = {
-  &tronbit_idle1, &tronbit_idle2, &tronbit_no, &tronbit_yes };
+/* Binary mesh containers, see gllist.h. */
+extern const unsigned char tronbit_idle1[], tronbit_idle2[],
+  tronbit_no[], tronbit_yes[];
+extern const unsigned long tronbit_idle1_size, tronbit_idle2_size,
+  tronbit_no_size, tronbit_yes_size;
+
+static const struct {
+  const unsigned char *data;
+  const unsigned long *size;
+} all_models[] = {
+  { tronbit_idle1, &tronbit_idle1_size }, { tronbit_idle2, &tronbit_idle2_size },
+  { tronbit_no,    &tronbit_no_size },    { tronbit_yes,   &tronbit_yes_size },
+};
+
+/* Loaded from all_models on first use. */
+static const struct gllist *tronbit_idle1_list, *tronbit_idle2_list,
+  *tronbit_no_list, *tronbit_yes_list;
+static const struct gllist **all_objs[] = {
+  &tronbit_idle1_list, &tronbit_idle2_list,
+  &tronbit_no_list, &tronbit_yes_list };
 
 
 #define DEF_SPIN        "True"
@@ -427,6 +443,18 @@ init_bit (ModeInfo *mi)
     bp->trackball = gltrackball_init (False);
   }
 
+  for (i = 0; i < countof(all_objs); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (all_models[i].data,
+                                         *all_models[i].size, "all");
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model %d\n", progname, i);
+            exit (1);
+          }
+      }
+
   for (i = 0; i < countof(bp->dlists); i++)
     {
       bp->dlists[i] = glGenLists (1);
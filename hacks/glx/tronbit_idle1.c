@@ -1,247 +1,109 @@
-/* odd parity = small triambic icosahedron */
+/* Generated from "tronbit_idle1.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
 
 #include "gllist.h"
-static const float data[]={
-	0,0,1,0.263523,-0.204124,0.372678,
-	0,0,1,0.263523,0.10775,0.372678,
-	0,0,1,0.045015,0.33028,0.372678,
-	0,0,1,0.263523,-0.204124,0.372678,
-	0,0,1,0.045015,0.33028,0.372678,
-	0,0,1,-0.225076,0.174343,0.372678,
-	0,0,1,0.263523,-0.204124,0.372678,
-	0,0,1,-0.225076,0.174343,0.372678,
-	0,0,1,-0.308538,-0.126156,0.372678,
-	0,0,1,0.263523,-0.204124,0.372678,
-	0,0,1,-0.308538,-0.126156,0.372678,
-	0,0,1,-0.038448,-0.282093,0.372678,
-	0.942809,0,0.333333,0.263523,-0.204124,0.372678,
-	0.942809,0,0.333333,0.36418,-0.282093,0.087977,
-	0.942809,0,0.333333,0.45421,-0.126156,-0.166667,
-	0.942809,0,0.333333,0.263523,-0.204124,0.372678,
-	0.942809,0,0.333333,0.45421,-0.126156,-0.166667,
-	0.942809,0,0.333333,0.426389,0.174343,-0.087977,
-	0.942809,0,0.333333,0.263523,-0.204124,0.372678,
-	0.942809,0,0.333333,0.426389,0.174343,-0.087977,
-	0.942809,0,0.333333,0.336359,0.33028,0.166667,
-	0.942809,0,0.333333,0.263523,-0.204124,0.372678,
-	0.942809,0,0.333333,0.336359,0.33028,0.166667,
-	0.942809,0,0.333333,0.263523,0.10775,0.372678,
-	0.672718,0.66056,0.333333,0.263523,0.10775,0.372678,
-	0.672718,0.66056,0.333333,0.471405,0,0.166667,
-	0.672718,0.66056,0.333333,0.426389,0.174343,-0.087977,
-	0.672718,0.66056,0.333333,0.263523,0.10775,0.372678,
-	0.672718,0.66056,0.333333,0.426389,0.174343,-0.087977,
-	0.672718,0.66056,0.333333,0.235702,0.408248,-0.166667,
-	0.672718,0.66056,0.333333,0.263523,0.10775,0.372678,
-	0.672718,0.66056,0.333333,0.235702,0.408248,-0.166667,
-	0.672718,0.66056,0.333333,0.062209,0.456436,0.087977,
-	0.672718,0.66056,0.333333,0.263523,0.10775,0.372678,
-	0.672718,0.66056,0.333333,0.062209,0.456436,0.087977,
-	0.672718,0.66056,0.333333,0.045015,0.33028,0.372678,
-	-0.471405,0.816497,0.333333,0.045015,0.33028,0.372678,
-	-0.471405,0.816497,0.333333,0.062209,0.456436,0.087977,
-	-0.471405,0.816497,0.333333,-0.117851,0.456436,-0.166667,
-	-0.471405,0.816497,0.333333,0.045015,0.33028,0.372678,
-	-0.471405,0.816497,0.333333,-0.117851,0.456436,-0.166667,
-	-0.471405,0.816497,0.333333,-0.36418,0.282093,-0.087977,
-	-0.471405,0.816497,0.333333,0.045015,0.33028,0.372678,
-	-0.471405,0.816497,0.333333,-0.36418,0.282093,-0.087977,
-	-0.471405,0.816497,0.333333,-0.45421,0.126156,0.166667,
-	-0.471405,0.816497,0.333333,0.045015,0.33028,0.372678,
-	-0.471405,0.816497,0.333333,-0.45421,0.126156,0.166667,
-	-0.471405,0.816497,0.333333,-0.225076,0.174343,0.372678,
-	-0.908421,0.252311,0.333333,-0.225076,0.174343,0.372678,
-	-0.908421,0.252311,0.333333,-0.235702,0.408248,0.166667,
-	-0.908421,0.252311,0.333333,-0.36418,0.282093,-0.087977,
-	-0.90842,0.252312,0.333333,-0.225076,0.174343,0.372678,
-	-0.90842,0.252312,0.333333,-0.36418,0.282093,-0.087977,
-	-0.90842,0.252312,0.333333,-0.471405,0,-0.166667,
-	-0.90842,0.252311,0.333334,-0.225076,0.174343,0.372678,
-	-0.90842,0.252311,0.333334,-0.471405,0,-0.166667,
-	-0.90842,0.252311,0.333334,-0.426389,-0.174343,0.087977,
-	-0.908421,0.252311,0.333333,-0.225076,0.174343,0.372678,
-	-0.908421,0.252311,0.333333,-0.426389,-0.174343,0.087977,
-	-0.908421,0.252311,0.333333,-0.308538,-0.126156,0.372678,
-	-0.471405,-0.816497,0.333333,-0.308538,-0.126156,0.372678,
-	-0.471405,-0.816497,0.333333,-0.426389,-0.174343,0.087977,
-	-0.471405,-0.816497,0.333333,-0.336359,-0.33028,-0.166667,
-	-0.471404,-0.816497,0.333333,-0.308538,-0.126156,0.372678,
-	-0.471404,-0.816497,0.333333,-0.336359,-0.33028,-0.166667,
-	-0.471404,-0.816497,0.333333,-0.062209,-0.456436,-0.087977,
-	-0.471405,-0.816497,0.333333,-0.308538,-0.126156,0.372678,
-	-0.471405,-0.816497,0.333333,-0.062209,-0.456436,-0.087977,
-	-0.471405,-0.816497,0.333333,0.117851,-0.456436,0.166667,
-	-0.471405,-0.816497,0.333333,-0.308538,-0.126156,0.372678,
-	-0.471405,-0.816497,0.333333,0.117851,-0.456436,0.166667,
-	-0.471405,-0.816497,0.333333,-0.038448,-0.282093,0.372678,
-	0.235702,-0.912871,0.333333,-0.038448,-0.282093,0.372678,
-	0.235702,-0.912871,0.333333,-0.235702,-0.408248,0.166667,
-	0.235702,-0.912871,0.333333,-0.062209,-0.456436,-0.087977,
-	0.235702,-0.912871,0.333333,-0.038448,-0.282093,0.372678,
-	0.235702,-0.912871,0.333333,-0.062209,-0.456436,-0.087977,
-	0.235702,-0.912871,0.333333,0.235702,-0.408248,-0.166667,
-	0.235702,-0.912871,0.333333,-0.038448,-0.282093,0.372678,
-	0.235702,-0.912871,0.333333,0.235702,-0.408248,-0.166667,
-	0.235702,-0.912871,0.333333,0.36418,-0.282093,0.087977,
-	0.235702,-0.912871,0.333333,-0.038448,-0.282093,0.372678,
-	0.235702,-0.912871,0.333333,0.36418,-0.282093,0.087977,
-	0.235702,-0.912871,0.333333,0.263523,-0.204124,0.372678,
-	0.09003,0.66056,0.745356,0.263523,0.10775,0.372678,
-	0.09003,0.66056,0.745356,0.336359,0.33028,0.166667,
-	0.09003,0.66056,0.745356,0.062209,0.456436,0.087977,
-	0.09003,0.66056,0.745356,0.263523,0.10775,0.372678,
-	0.09003,0.66056,0.745356,0.062209,0.456436,0.087977,
-	0.09003,0.66056,0.745356,-0.235702,0.408248,0.166667,
-	0.09003,0.66056,0.745356,0.263523,0.10775,0.372678,
-	0.09003,0.66056,0.745356,-0.235702,0.408248,0.166667,
-	0.09003,0.66056,0.745356,-0.225076,0.174343,0.372678,
-	0.09003,0.660559,0.745356,0.263523,0.10775,0.372678,
-	0.09003,0.660559,0.745356,-0.225076,0.174343,0.372678,
-	0.09003,0.660559,0.745356,0,0,0.5,
-	0.471405,0.816497,-0.333333,0.336359,0.33028,0.166667,
-	0.471405,0.816497,-0.333333,0.426389,0.174343,-0.087977,
-	0.471405,0.816497,-0.333333,0.308538,0.126156,-0.372678,
-	0.471405,0.816497,-0.333333,0.336359,0.33028,0.166667,
-	0.471405,0.816497,-0.333333,0.308538,0.126156,-0.372678,
-	0.471405,0.816497,-0.333333,0.038448,0.282093,-0.372678,
-	0.471405,0.816497,-0.333333,0.336359,0.33028,0.166667,
-	0.471405,0.816497,-0.333333,0.038448,0.282093,-0.372678,
-	0.471405,0.816497,-0.333333,-0.117851,0.456436,-0.166667,
-	0.471404,0.816497,-0.333333,0.336359,0.33028,0.166667,
-	0.471404,0.816497,-0.333333,-0.117851,0.456436,-0.166667,
-	0.471404,0.816497,-0.333333,0.062209,0.456436,0.087977,
-	0.617077,0.252311,-0.745356,0.426389,0.174343,-0.087977,
-	0.617077,0.252311,-0.745356,0.45421,-0.126156,-0.166667,
-	0.617077,0.252311,-0.745356,0.225076,-0.174343,-0.372678,
-	0.617076,0.252311,-0.745356,0.426389,0.174343,-0.087977,
-	0.617076,0.252311,-0.745356,0.225076,-0.174343,-0.372678,
-	0.617076,0.252311,-0.745356,0,0,-0.5,
-	0.617077,0.252311,-0.745356,0.426389,0.174343,-0.087977,
-	0.617077,0.252311,-0.745356,0,0,-0.5,
-	0.617077,0.252311,-0.745356,0.038448,0.282093,-0.372678,
-	0.617077,0.252311,-0.745356,0.426389,0.174343,-0.087977,
-	0.617077,0.252311,-0.745356,0.038448,0.282093,-0.372678,
-	0.617077,0.252311,-0.745356,0.235702,0.408248,-0.166667,
-	0.471405,-0.816497,-0.333333,0.45421,-0.126156,-0.166667,
-	0.471405,-0.816497,-0.333333,0.36418,-0.282093,0.087977,
-	0.471405,-0.816497,-0.333333,0.117851,-0.456436,0.166667,
-	0.471405,-0.816497,-0.333333,0.45421,-0.126156,-0.166667,
-	0.471405,-0.816497,-0.333333,0.117851,-0.456436,0.166667,
-	0.471405,-0.816497,-0.333333,-0.062209,-0.456436,-0.087977,
-	0.471405,-0.816497,-0.333333,0.45421,-0.126156,-0.166667,
-	0.471405,-0.816497,-0.333333,-0.062209,-0.456436,-0.087977,
-	0.471405,-0.816497,-0.333333,-0.045015,-0.33028,-0.372678,
-	0.471405,-0.816497,-0.333333,0.45421,-0.126156,-0.166667,
-	0.471405,-0.816497,-0.333333,-0.045015,-0.33028,-0.372678,
-	0.471405,-0.816497,-0.333333,0.225076,-0.174343,-0.372678,
-	-0.235702,0.912871,-0.333333,0.062209,0.456436,0.087977,
-	-0.235702,0.912871,-0.333333,0.235702,0.408248,-0.166667,
-	-0.235702,0.912871,-0.333333,0.038448,0.282093,-0.372678,
-	-0.235702,0.912871,-0.333333,0.062209,0.456436,0.087977,
-	-0.235702,0.912871,-0.333333,0.038448,0.282093,-0.372678,
-	-0.235702,0.912871,-0.333333,-0.263523,0.204124,-0.372678,
-	-0.235702,0.912871,-0.333333,0.062209,0.456436,0.087977,
-	-0.235702,0.912871,-0.333333,-0.263523,0.204124,-0.372678,
-	-0.235702,0.912871,-0.333333,-0.36418,0.282093,-0.087977,
-	-0.235702,0.912871,-0.333333,0.062209,0.456436,0.087977,
-	-0.235702,0.912871,-0.333333,-0.36418,0.282093,-0.087977,
-	-0.235702,0.912871,-0.333333,-0.235702,0.408248,0.166667,
-	0.90842,-0.252312,-0.333334,0.426389,0.174343,-0.087977,
-	0.90842,-0.252312,-0.333334,0.471405,0,0.166667,
-	0.90842,-0.252312,-0.333334,0.36418,-0.282093,0.087977,
-	0.908421,-0.252311,-0.333333,0.426389,0.174343,-0.087977,
-	0.908421,-0.252311,-0.333333,0.36418,-0.282093,0.087977,
-	0.908421,-0.252311,-0.333333,0.235702,-0.408248,-0.166667,
-	0.908421,-0.252311,-0.333333,0.426389,0.174343,-0.087977,
-	0.908421,-0.252311,-0.333333,0.235702,-0.408248,-0.166667,
-	0.908421,-0.252311,-0.333333,0.225076,-0.174343,-0.372678,
-	0.908421,-0.252311,-0.333333,0.426389,0.174343,-0.087977,
-	0.908421,-0.252311,-0.333333,0.225076,-0.174343,-0.372678,
-	0.908421,-0.252311,-0.333333,0.308538,0.126156,-0.372678,
-	0.527046,-0.408248,0.745356,0.471405,0,0.166667,
-	0.527046,-0.408248,0.745356,0.263523,0.10775,0.372678,
-	0.527046,-0.408248,0.745356,0,0,0.5,
-	0.527046,-0.408248,0.745356,0.471405,0,0.166667,
-	0.527046,-0.408248,0.745356,0,0,0.5,
-	0.527046,-0.408248,0.745356,-0.038448,-0.282093,0.372678,
-	0.527046,-0.408248,0.745356,0.471405,0,0.166667,
-	0.527046,-0.408248,0.745356,-0.038448,-0.282093,0.372678,
-	0.527046,-0.408248,0.745356,0.117851,-0.456436,0.166667,
-	0.527047,-0.408249,0.745356,0.471405,0,0.166667,
-	0.527047,-0.408249,0.745356,0.117851,-0.456436,0.166667,
-	0.527047,-0.408249,0.745356,0.36418,-0.282093,0.087977,
-	-0.617077,-0.252311,0.745356,-0.225076,0.174343,0.372678,
-	-0.617077,-0.252311,0.745356,-0.45421,0.126156,0.166667,
-	-0.617077,-0.252311,0.745356,-0.426389,-0.174343,0.087977,
-	-0.617077,-0.252311,0.745356,-0.225076,0.174343,0.372678,
-	-0.617077,-0.252311,0.745356,-0.426389,-0.174343,0.087977,
-	-0.617077,-0.252311,0.745356,-0.235702,-0.408248,0.166667,
-	-0.617077,-0.252311,0.745356,-0.225076,0.174343,0.372678,
-	-0.617077,-0.252311,0.745356,-0.235702,-0.408248,0.166667,
-	-0.617077,-0.252311,0.745356,-0.038448,-0.282093,0.372678,
-	-0.617076,-0.252311,0.745356,-0.225076,0.174343,0.372678,
-	-0.617076,-0.252311,0.745356,-0.038448,-0.282093,0.372678,
-	-0.617076,-0.252311,0.745356,0,0,0.5,
-	-0.942809,0,-0.333333,-0.45421,0.126156,0.166667,
-	-0.942809,0,-0.333333,-0.36418,0.282093,-0.087977,
-	-0.942809,0,-0.333333,-0.263523,0.204124,-0.372678,
-	-0.942809,0,-0.333333,-0.45421,0.126156,0.166667,
-	-0.942809,0,-0.333333,-0.263523,0.204124,-0.372678,
-	-0.942809,0,-0.333333,-0.263523,-0.10775,-0.372678,
-	-0.942809,0,-0.333333,-0.45421,0.126156,0.166667,
-	-0.942809,0,-0.333333,-0.263523,-0.10775,-0.372678,
-	-0.942809,0,-0.333333,-0.336359,-0.33028,-0.166667,
-	-0.942809,0,-0.333333,-0.45421,0.126156,0.166667,
-	-0.942809,0,-0.333333,-0.336359,-0.33028,-0.166667,
-	-0.942809,0,-0.333333,-0.426389,-0.174343,0.087977,
-	-0.527046,0.408248,-0.745356,-0.36418,0.282093,-0.087977,
-	-0.527046,0.408248,-0.745356,-0.117851,0.456436,-0.166667,
-	-0.527046,0.408248,-0.745356,0.038448,0.282093,-0.372678,
-	-0.527046,0.408248,-0.745356,-0.36418,0.282093,-0.087977,
-	-0.527046,0.408248,-0.745356,0.038448,0.282093,-0.372678,
-	-0.527046,0.408248,-0.745356,0,0,-0.5,
-	-0.527046,0.408248,-0.745356,-0.36418,0.282093,-0.087977,
-	-0.527046,0.408248,-0.745356,0,0,-0.5,
-	-0.527046,0.408248,-0.745356,-0.263523,-0.10775,-0.372678,
-	-0.527046,0.408249,-0.745356,-0.36418,0.282093,-0.087977,
-	-0.527046,0.408249,-0.745356,-0.263523,-0.10775,-0.372678,
-	-0.527046,0.408249,-0.745356,-0.471405,0,-0.166667,
-	-0.672718,-0.66056,-0.333333,-0.426389,-0.174343,0.087977,
-	-0.672718,-0.66056,-0.333333,-0.471405,0,-0.166667,
-	-0.672718,-0.66056,-0.333333,-0.263523,-0.10775,-0.372678,
-	-0.672718,-0.66056,-0.333333,-0.426389,-0.174343,0.087977,
-	-0.672718,-0.66056,-0.333333,-0.263523,-0.10775,-0.372678,
-	-0.672718,-0.66056,-0.333333,-0.045015,-0.33028,-0.372678,
-	-0.672718,-0.66056,-0.333333,-0.426389,-0.174343,0.087977,
-	-0.672718,-0.66056,-0.333333,-0.045015,-0.33028,-0.372678,
-	-0.672718,-0.66056,-0.333333,-0.062209,-0.456436,-0.087977,
-	-0.672718,-0.66056,-0.333333,-0.426389,-0.174343,0.087977,
-	-0.672718,-0.66056,-0.333333,-0.062209,-0.456436,-0.087977,
-	-0.672718,-0.66056,-0.333333,-0.235702,-0.408248,0.166667,
-	-0.09003,-0.66056,-0.745356,-0.062209,-0.456436,-0.087977,
-	-0.09003,-0.66056,-0.745356,-0.336359,-0.33028,-0.166667,
-	-0.09003,-0.66056,-0.745356,-0.263523,-0.10775,-0.372678,
-	-0.09003,-0.66056,-0.745356,-0.062209,-0.456436,-0.087977,
-	-0.09003,-0.66056,-0.745356,-0.263523,-0.10775,-0.372678,
-	-0.09003,-0.66056,-0.745356,0,0,-0.5,
-	-0.09003,-0.66056,-0.745356,-0.062209,-0.456436,-0.087977,
-	-0.09003,-0.66056,-0.745356,0,0,-0.5,
-	-0.09003,-0.66056,-0.745356,0.225076,-0.174343,-0.372678,
-	-0.09003,-0.66056,-0.745356,-0.062209,-0.456436,-0.087977,
-	-0.09003,-0.66056,-0.745356,0.225076,-0.174343,-0.372678,
-	-0.09003,-0.66056,-0.745356,0.235702,-0.408248,-0.166667,
-	0,0,-1,0.308538,0.126156,-0.372678,
-	0,0,-1,0.225076,-0.174343,-0.372678,
-	0,0,-1,-0.045015,-0.33028,-0.372678,
-	0,0,-1,0.308538,0.126156,-0.372678,
-	0,0,-1,-0.045015,-0.33028,-0.372678,
-	0,0,-1,-0.263523,-0.10775,-0.372678,
-	0,0,-1,0.308538,0.126156,-0.372678,
-	0,0,-1,-0.263523,-0.10775,-0.372678,
-	0,0,-1,-0.263523,0.204124,-0.372678,
-	0,0,-1,0.308538,0.126156,-0.372678,
-	0,0,-1,-0.263523,0.204124,-0.372678,
-	0,0,-1,0.038448,0.282093,-0.372678
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,240,data,NULL};
-const struct gllist *tronbit_idle1=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char tronbit_idle1[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000x\000\000\000\360\000\000\000u\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\001\2007vC\277\313g_\000\000"
+ "vC\225\033g_\000\000\206\013\215Tg_\000\000b\306\241,g_\000\000\004\261\264"
+ "\337g_\000\000(\366\311\267g_\000\000vC\277\313g_\000\000:]\311\267\205\026"
+ "\000\000Ft\264\337V\325\000\000'm\241,{\351\000\000\033V\215T\252*\000\000"
+ "vC\225\033g_\000\000vC\225\033g_\000\000\255x\000\000\252*\000\000'm\241"
+ ",{\351\000\000V<\202hV\325\000\000\355\017\330t\205\026\000\000\206\013\215"
+ "Tg_\000\000\206\013\215Tg_\000\000\355\017\330t\205\026\000\000\325\341\330"
+ "tV\325\000\000\306\2427H{\351\000\000\272\213L \252*\000\000b\306\241,g_"
+ "\000\000b\306\241,g_\000\000\252\303\202h\252*\000\000\306\2427H{\351\000"
+ "\000S\207\000\000V\325\000\000\331\222_\323\205\026\000\000\004\261\264\337"
+ "g_\000\000\004\261\264\337g_\000\000\331\222_\323\205\026\000\000\345\251"
+ "s\253V\325\000\000\023\360(\213{\351\000\000+\036(\213\252*\000\000(\366"
+ "\311\267g_\000\000(\366\311\267g_\000\000\252\303~\227\252*\000\000\023\360"
+ "(\213{\351\000\000V<~\227V\325\000\000:]\311\267\205\026\000\000vC\277\313"
+ "g_\000\000vC\225\033g_\000\000\033V\215T\252*\000\000\355\017\330t\205\026"
+ "\000\000\252\303\202h\252*\000\000b\306\241,g_\000\000\000\000\000\000\377"
+ "\177\000\000\033V\215T\252*\000\000'm\241,{\351\000\000\374NL \231\240\000"
+ "\000\330\0117H\231\240\000\000\325\341\330tV\325\000\000\355\017\330t\205"
+ "\026\000\000'm\241,{\351\000\000Ft\264\337V\325\000\000\2369_\323\231\240"
+ "\000\000\000\000\000\000\001\200\000\000\330\0117H\231\240\000\000V<\202"
+ "hV\325\000\000Ft\264\337V\325\000\000:]\311\267\205\026\000\000+\036(\213"
+ "\252*\000\000\023\360(\213{\351\000\000z\364s\253\231\240\000\000\2369_\323"
+ "\231\240\000\000\355\017\330t\205\026\000\000V<\202hV\325\000\000\330\011"
+ "7H\231\240\000\000\212\274A4\231\240\000\000\306\2427H{\351\000\000\252\303"
+ "\202h\252*\000\000'm\241,{\351\000\000\255x\000\000\252*\000\000:]\311\267"
+ "\205\026\000\000V<~\227V\325\000\000\2369_\323\231\240\000\000\374NL \231"
+ "\240\000\000\255x\000\000\252*\000\000vC\225\033g_\000\000\000\000\000\000"
+ "\377\177\000\000(\366\311\267g_\000\000+\036(\213\252*\000\000:]\311\267"
+ "\205\026\000\000b\306\241,g_\000\000\272\213L \252*\000\000\331\222_\323"
+ "\205\026\000\000\252\303~\227\252*\000\000(\366\311\267g_\000\000\000\000"
+ "\000\000\377\177\000\000\272\213L \252*\000\000\306\2427H{\351\000\000\212"
+ "\274A4\231\240\000\000\212\274k\344\231\240\000\000\345\251s\253V\325\000"
+ "\000\331\222_\323\205\026\000\000\306\2427H{\351\000\000\325\341\330tV\325"
+ "\000\000\330\0117H\231\240\000\000\000\000\000\000\001\200\000\000\212\274"
+ "k\344\231\240\000\000S\207\000\000V\325\000\000\331\222_\323\205\026\000"
+ "\000S\207\000\000V\325\000\000\212\274k\344\231\240\000\000z\364s\253\231"
+ "\240\000\000\023\360(\213{\351\000\000\252\303~\227\252*\000\000\023\360"
+ "(\213{\351\000\000\345\251s\253V\325\000\000\212\274k\344\231\240\000\000"
+ "\000\000\000\000\001\200\000\000\2369_\323\231\240\000\000V<~\227V\325\000"
+ "\000\374NL \231\240\000\000\2369_\323\231\240\000\000z\364s\253\231\240\000"
+ "\000\212\274k\344\231\240\000\000\212\274A4\231\240\000\000\330\0117H\231"
+ "\240\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\000^\000^\000"
+ "^\000^\000^\000323232323232\333@\333@\333@\333@\333@\333@\263\025\263\025"
+ "\263\025\263\025\263\025\263\025\333\300\333\300\333\300\333\300\333\300"
+ "\333\300\024\262\024\262\024\262\024\262\024\262\024\262\0108\0108\0108\010"
+ "8\0108\0108\077Z\077Z\077Z\077Z\077Z\077ZkNkNkNkNkNkN\077\246\077\246\077"
+ "\246\077\246\077\246\077\246\317k\317k\317k\317k\317k\317kj\316j\316j\316"
+ "j\316j\316j\316(\341(\341(\341(\341(\341(\341\317\354\317\354\317\354\317"
+ "\354\317\354\317\354\201!\201!\201!\201!\201!\201!\240W\240W\240W\240W\240"
+ "W\240W\263\264\263\264\263\264\263\264\263\264\263\264\271\211\271\211\271"
+ "\211\271\211\271\211\271\211\177\177\177\177\177\177\177\177\177\177\177"
+ "\177\000\000\001\000\002\000\000\000\002\000\003\000\000\000\003\000\004"
+ "\000\000\000\004\000\005\000\006\000\007\000\010\000\006\000\010\000\011"
+ "\000\006\000\011\000\012\000\006\000\012\000\013\000\014\000\015\000\016"
+ "\000\014\000\016\000\017\000\014\000\017\000\020\000\014\000\020\000\021"
+ "\000\022\000\023\000\024\000\022\000\024\000\025\000\022\000\025\000\026"
+ "\000\022\000\026\000\027\000\030\000\031\000\032\000\030\000\032\000\033"
+ "\000\030\000\033\000\034\000\030\000\034\000\035\000\036\000\037\000 \000"
+ "\036\000 \000!\000\036\000!\000\042\000\036\000\042\000#\000$\000%\000&\000"
+ "$\000&\000'\000$\000'\000(\000$\000(\000)\000*\000+\000,\000*\000,\000-\000"
+ "*\000-\000.\000*\000.\000/\0000\0001\0002\0000\0002\0003\0000\0003\0004\000"
+ "0\0004\0005\0006\0007\0008\0006\0008\0009\0006\0009\000:\0006\000:\000;\000"
+ "<\000=\000>\000<\000>\000\077\000<\000\077\000@\000<\000@\000A\000B\000C"
+ "\000D\000B\000D\000E\000B\000E\000F\000B\000F\000G\000H\000I\000J\000H\000"
+ "J\000K\000H\000K\000L\000H\000L\000M\000N\000O\000P\000N\000P\000Q\000N\000"
+ "Q\000R\000N\000R\000S\000T\000U\000V\000T\000V\000W\000T\000W\000X\000T\000"
+ "X\000Y\000Z\000[\000\134\000Z\000\134\000]\000Z\000]\000^\000Z\000^\000_"
+ "\000`\000a\000b\000`\000b\000c\000`\000c\000d\000`\000d\000e\000f\000g\000"
+ "h\000f\000h\000i\000f\000i\000j\000f\000j\000k\000l\000m\000n\000l\000n\000"
+ "o\000l\000o\000p\000l\000p\000q\000r\000s\000t\000r\000t\000u\000r\000u\000"
+ "v\000r\000v\000w\000\000\000\001\000\001\000\002\000\000\000\002\000\002"
+ "\000\003\000\000\000\003\000\003\000\004\000\000\000\004\000\004\000\005"
+ "\000\000\000\005\000\000\000\007\000\007\000\010\000\000\000\010\000\010"
+ "\000\011\000\000\000\011\000\011\000\012\000\000\000\012\000\001\000\012"
+ "\000\001\000\015\000\011\000\015\000\001\000\011\000\011\000\017\000\001"
+ "\000\017\000\017\000\020\000\001\000\020\000\002\000\020\000\020\000\024"
+ "\000\002\000\024\000\024\000\025\000\002\000\025\000\025\000\026\000\002"
+ "\000\026\000\003\000\026\000\003\000\031\000\025\000\031\000\003\000\025"
+ "\000\025\000\033\000\003\000\033\000\033\000\034\000\003\000\034\000\004"
+ "\000\034\000\034\000 \000\004\000 \000 \000!\000\004\000!\000!\000\042\000"
+ "\004\000\042\000\005\000\042\000\005\000%\000!\000%\000\005\000!\000!\000"
+ "'\000\005\000'\000\007\000'\000\005\000\007\000\012\000\020\000\020\000\031"
+ "\000\001\000\031\000\001\000\003\000\003\000/\000\001\000/\000\011\0002\000"
+ "\012\0002\0002\0003\000\012\0003\000\024\0003\000\012\000\024\000\010\000"
+ "8\000\011\0008\0008\0009\000\011\0009\0003\0009\000\011\0003\000\017\000"
+ "3\000\007\000\042\000\010\000\042\000\010\000!\000!\000@\000\010\000@\000"
+ "8\000@\000\020\0003\0003\000E\000\020\000E\000\025\000E\000\020\000\025\000"
+ "\007\000\015\000\007\000\011\000\011\000'\000'\0008\0002\0008\000\015\000"
+ "/\000\005\000/\000\005\000\015\000\015\000\042\000\026\000\034\000\034\000"
+ "%\000\003\000%\000\003\000\005\000\026\000E\000E\000]\000\026\000]\000 \000"
+ "]\000\026\000 \000\025\0003\000\025\0009\0009\000]\000\025\000]\000\033\000"
+ "]\000\034\000]\000@\000]\000\034\000@\000\034\000!\000!\000]\000!\0009\000"
+ "!\0008\0002\000@\0002\000]\0002\000E\000"
+;
+const unsigned long tronbit_idle1_size = 2228;
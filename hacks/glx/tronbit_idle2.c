@@ -1,175 +1,96 @@
-/* even parity = compound of icosahedron and dodecahedron */
+/* Generated from "tronbit_idle2.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
 
 #include "gllist.h"
-static const float data[]={
-	0.491123,0.356822,0.794655,0.138196,0.425326,0.223607,
-	0.491123,0.356822,0.794655,0,0,0.5,
-	0.491123,0.356822,0.794655,0.447213,0,0.223607,
-	-0.187593,0.57735,0.794655,-0.361804,0.262865,0.223607,
-	-0.187593,0.57735,0.794655,0,0,0.5,
-	-0.187593,0.57735,0.794655,0.138196,0.425326,0.223607,
-	-0.607062,0,0.794655,-0.361804,-0.262865,0.223607,
-	-0.607062,0,0.794655,0,0,0.5,
-	-0.607062,0,0.794655,-0.361804,0.262865,0.223607,
-	-0.187593,-0.57735,0.794655,0.138196,-0.425326,0.223607,
-	-0.187593,-0.57735,0.794655,0,0,0.5,
-	-0.187593,-0.57735,0.794655,-0.361804,-0.262865,0.223607,
-	0.491123,-0.356822,0.794655,0,0,0.5,
-	0.491123,-0.356822,0.794655,0.138196,-0.425326,0.223607,
-	0.491123,-0.356822,0.794655,0.447213,0,0.223607,
-	0.794655,-0.57735,0.187593,0.361804,-0.262865,-0.223607,
-	0.794655,-0.57735,0.187593,0.447213,0,0.223607,
-	0.794655,-0.57735,0.187593,0.138196,-0.425326,0.223607,
-	0.982247,0,-0.187592,0.447213,0,0.223607,
-	0.982247,0,-0.187592,0.361804,-0.262865,-0.223607,
-	0.982247,0,-0.187592,0.361804,0.262865,-0.223607,
-	0.794655,0.57735,0.187593,0.447213,0,0.223607,
-	0.794655,0.57735,0.187593,0.361804,0.262865,-0.223607,
-	0.794655,0.57735,0.187593,0.138196,0.425326,0.223607,
-	0.303531,0.934172,-0.187592,-0.138196,0.425326,-0.223607,
-	0.303531,0.934172,-0.187592,0.138196,0.425326,0.223607,
-	0.303531,0.934172,-0.187592,0.361804,0.262865,-0.223607,
-	-0.303531,0.934172,0.187592,0.138196,0.425326,0.223607,
-	-0.303531,0.934172,0.187592,-0.138196,0.425326,-0.223607,
-	-0.303531,0.934172,0.187592,-0.361804,0.262865,0.223607,
-	-0.794655,0.57735,-0.187593,-0.447213,0,-0.223607,
-	-0.794655,0.57735,-0.187593,-0.361804,0.262865,0.223607,
-	-0.794655,0.57735,-0.187593,-0.138196,0.425326,-0.223607,
-	-0.982247,0,0.187592,-0.361804,0.262865,0.223607,
-	-0.982247,0,0.187592,-0.447213,0,-0.223607,
-	-0.982247,0,0.187592,-0.361804,-0.262865,0.223607,
-	-0.794655,-0.57735,-0.187593,-0.138196,-0.425326,-0.223607,
-	-0.794655,-0.57735,-0.187593,-0.361804,-0.262865,0.223607,
-	-0.794655,-0.57735,-0.187593,-0.447213,0,-0.223607,
-	-0.303531,-0.934172,0.187592,-0.361804,-0.262865,0.223607,
-	-0.303531,-0.934172,0.187592,-0.138196,-0.425326,-0.223607,
-	-0.303531,-0.934172,0.187592,0.138196,-0.425326,0.223607,
-	0.303531,-0.934172,-0.187592,0.138196,-0.425326,0.223607,
-	0.303531,-0.934172,-0.187592,-0.138196,-0.425326,-0.223607,
-	0.303531,-0.934172,-0.187592,0.361804,-0.262865,-0.223607,
-	0.607062,0,-0.794655,0,0,-0.5,
-	0.607062,0,-0.794655,0.361804,0.262865,-0.223607,
-	0.607062,0,-0.794655,0.361804,-0.262865,-0.223607,
-	0.187593,0.57735,-0.794655,0.361804,0.262865,-0.223607,
-	0.187593,0.57735,-0.794655,0,0,-0.5,
-	0.187593,0.57735,-0.794655,-0.138196,0.425326,-0.223607,
-	0.187593,-0.57735,-0.794655,0,0,-0.5,
-	0.187593,-0.57735,-0.794655,0.361804,-0.262865,-0.223607,
-	0.187593,-0.57735,-0.794655,-0.138196,-0.425326,-0.223607,
-	-0.491123,0.356822,-0.794655,-0.138196,0.425326,-0.223607,
-	-0.491123,0.356822,-0.794655,0,0,-0.5,
-	-0.491123,0.356822,-0.794655,-0.447213,0,-0.223607,
-	-0.491123,-0.356822,-0.794655,-0.447213,0,-0.223607,
-	-0.491123,-0.356822,-0.794655,0,0,-0.5,
-	-0.491123,-0.356822,-0.794655,-0.138196,-0.425326,-0.223607,
-	0,0,1,0.223607,0.16246,0.361804,
-	0,0,1,-0.08541,0.262865,0.361804,
-	0,0,1,-0.276393,0,0.361804,
-	0,0,1,0.223607,0.16246,0.361804,
-	0,0,1,-0.276393,0,0.361804,
-	0,0,1,-0.08541,-0.262865,0.361804,
-	0,0,1,0.223607,0.16246,0.361804,
-	0,0,1,-0.08541,-0.262865,0.361804,
-	0,0,1,0.223607,-0.16246,0.361804,
-	0.894427,0,0.447214,0.361804,-0.262865,0.08541,
-	0.894427,0,0.447214,0.447213,0,-0.08541,
-	0.894427,0,0.447214,0.361804,0.262865,0.08541,
-	0.894428,0,0.447213,0.361804,-0.262865,0.08541,
-	0.894428,0,0.447213,0.361804,0.262865,0.08541,
-	0.894428,0,0.447213,0.223607,0.16246,0.361804,
-	0.894428,0,0.447213,0.361804,-0.262865,0.08541,
-	0.894428,0,0.447213,0.223607,0.16246,0.361804,
-	0.894428,0,0.447213,0.223607,-0.16246,0.361804,
-	0.276393,0.85065,0.447214,0.361804,0.262865,0.08541,
-	0.276393,0.85065,0.447214,0.138196,0.425326,-0.08541,
-	0.276393,0.85065,0.447214,-0.138196,0.425326,0.08541,
-	0.276393,0.850651,0.447213,0.361804,0.262865,0.08541,
-	0.276393,0.850651,0.447213,-0.138196,0.425326,0.08541,
-	0.276393,0.850651,0.447213,-0.08541,0.262865,0.361804,
-	0.276393,0.850652,0.447212,0.361804,0.262865,0.08541,
-	0.276393,0.850652,0.447212,-0.08541,0.262865,0.361804,
-	0.276393,0.850652,0.447212,0.223607,0.16246,0.361804,
-	-0.723606,0.525731,0.447215,-0.138196,0.425326,0.08541,
-	-0.723606,0.525731,0.447215,-0.361804,0.262865,-0.08541,
-	-0.723606,0.525731,0.447215,-0.447213,0,0.08541,
-	-0.723607,0.525731,0.447213,-0.138196,0.425326,0.08541,
-	-0.723607,0.525731,0.447213,-0.447213,0,0.08541,
-	-0.723607,0.525731,0.447213,-0.276393,0,0.361804,
-	-0.723607,0.525731,0.447214,-0.138196,0.425326,0.08541,
-	-0.723607,0.525731,0.447214,-0.276393,0,0.361804,
-	-0.723607,0.525731,0.447214,-0.08541,0.262865,0.361804,
-	-0.723606,-0.525731,0.447215,-0.447213,0,0.08541,
-	-0.723606,-0.525731,0.447215,-0.361804,-0.262865,-0.08541,
-	-0.723606,-0.525731,0.447215,-0.138196,-0.425326,0.08541,
-	-0.723607,-0.525731,0.447214,-0.447213,0,0.08541,
-	-0.723607,-0.525731,0.447214,-0.138196,-0.425326,0.08541,
-	-0.723607,-0.525731,0.447214,-0.08541,-0.262865,0.361804,
-	-0.723607,-0.525731,0.447213,-0.447213,0,0.08541,
-	-0.723607,-0.525731,0.447213,-0.08541,-0.262865,0.361804,
-	-0.723607,-0.525731,0.447213,-0.276393,0,0.361804,
-	0.276393,-0.85065,0.447214,-0.138196,-0.425326,0.08541,
-	0.276393,-0.85065,0.447214,0.138196,-0.425326,-0.08541,
-	0.276393,-0.85065,0.447214,0.361804,-0.262865,0.08541,
-	0.276394,-0.850651,0.447213,-0.138196,-0.425326,0.08541,
-	0.276394,-0.850651,0.447213,0.361804,-0.262865,0.08541,
-	0.276394,-0.850651,0.447213,0.223607,-0.16246,0.361804,
-	0.276393,-0.850651,0.447214,-0.138196,-0.425326,0.08541,
-	0.276393,-0.850651,0.447214,0.223607,-0.16246,0.361804,
-	0.276393,-0.850651,0.447214,-0.08541,-0.262865,0.361804,
-	0.723607,0.525731,-0.447213,0.447213,0,-0.08541,
-	0.723607,0.525731,-0.447213,0.276393,0,-0.361804,
-	0.723607,0.525731,-0.447213,0.08541,0.262865,-0.361804,
-	0.723607,0.525731,-0.447214,0.447213,0,-0.08541,
-	0.723607,0.525731,-0.447214,0.08541,0.262865,-0.361804,
-	0.723607,0.525731,-0.447214,0.138196,0.425326,-0.08541,
-	0.723606,0.525731,-0.447215,0.447213,0,-0.08541,
-	0.723606,0.525731,-0.447215,0.138196,0.425326,-0.08541,
-	0.723606,0.525731,-0.447215,0.361804,0.262865,0.08541,
-	0.723606,-0.525732,-0.447214,0.361804,-0.262865,0.08541,
-	0.723606,-0.525732,-0.447214,0.138196,-0.425326,-0.08541,
-	0.723606,-0.525732,-0.447214,0.08541,-0.262865,-0.361804,
-	0.723607,-0.525731,-0.447214,0.361804,-0.262865,0.08541,
-	0.723607,-0.525731,-0.447214,0.08541,-0.262865,-0.361804,
-	0.723607,-0.525731,-0.447214,0.276393,0,-0.361804,
-	0.723607,-0.52573,-0.447214,0.361804,-0.262865,0.08541,
-	0.723607,-0.52573,-0.447214,0.276393,0,-0.361804,
-	0.723607,-0.52573,-0.447214,0.447213,0,-0.08541,
-	-0.276393,0.850651,-0.447214,0.138196,0.425326,-0.08541,
-	-0.276393,0.850651,-0.447214,0.08541,0.262865,-0.361804,
-	-0.276393,0.850651,-0.447214,-0.223607,0.16246,-0.361804,
-	-0.276394,0.850651,-0.447213,0.138196,0.425326,-0.08541,
-	-0.276394,0.850651,-0.447213,-0.223607,0.16246,-0.361804,
-	-0.276394,0.850651,-0.447213,-0.361804,0.262865,-0.08541,
-	-0.276393,0.85065,-0.447214,0.138196,0.425326,-0.08541,
-	-0.276393,0.85065,-0.447214,-0.361804,0.262865,-0.08541,
-	-0.276393,0.85065,-0.447214,-0.138196,0.425326,0.08541,
-	-0.894428,0,-0.447213,-0.361804,0.262865,-0.08541,
-	-0.894428,0,-0.447213,-0.223607,0.16246,-0.361804,
-	-0.894428,0,-0.447213,-0.223607,-0.16246,-0.361804,
-	-0.894428,0,-0.447213,-0.361804,0.262865,-0.08541,
-	-0.894428,0,-0.447213,-0.223607,-0.16246,-0.361804,
-	-0.894428,0,-0.447213,-0.361804,-0.262865,-0.08541,
-	-0.894427,0,-0.447214,-0.361804,0.262865,-0.08541,
-	-0.894427,0,-0.447214,-0.361804,-0.262865,-0.08541,
-	-0.894427,0,-0.447214,-0.447213,0,0.08541,
-	-0.276393,-0.850652,-0.447212,-0.361804,-0.262865,-0.08541,
-	-0.276393,-0.850652,-0.447212,-0.223607,-0.16246,-0.361804,
-	-0.276393,-0.850652,-0.447212,0.08541,-0.262865,-0.361804,
-	-0.276393,-0.850651,-0.447213,-0.361804,-0.262865,-0.08541,
-	-0.276393,-0.850651,-0.447213,0.08541,-0.262865,-0.361804,
-	-0.276393,-0.850651,-0.447213,0.138196,-0.425326,-0.08541,
-	-0.276393,-0.85065,-0.447214,-0.361804,-0.262865,-0.08541,
-	-0.276393,-0.85065,-0.447214,0.138196,-0.425326,-0.08541,
-	-0.276393,-0.85065,-0.447214,-0.138196,-0.425326,0.08541,
-	0,0,-1,0.08541,-0.262865,-0.361804,
-	0,0,-1,-0.223607,-0.16246,-0.361804,
-	0,0,-1,-0.223607,0.16246,-0.361804,
-	0,0,-1,0.08541,-0.262865,-0.361804,
-	0,0,-1,-0.223607,0.16246,-0.361804,
-	0,0,-1,0.08541,0.262865,-0.361804,
-	0,0,-1,0.08541,-0.262865,-0.361804,
-	0,0,-1,0.08541,0.262865,-0.361804,
-	0,0,-1,0.276393,0,-0.361804
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,168,data,NULL};
-const struct gllist *tronbit_idle2=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char tronbit_idle2[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000x\000\000\000\250\000\000\000T\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\001\2007a#\341l>9\000\000\000"
+ "\000\000\000\377\177\000\000|r\000\000>9\000\000b\243KC>9\000\000\000\000"
+ "\000\000\377\177\000\000a#\341l>9\000\000b\243\265\274>9\000\000\000\000"
+ "\000\000\377\177\000\000b\243KC>9\000\000a#\037\223>9\000\000\000\000\000"
+ "\000\377\177\000\000b\243\265\274>9\000\000\000\000\000\000\377\177\000\000"
+ "a#\037\223>9\000\000|r\000\000>9\000\000\236\134\265\274\302\306\000\000"
+ "|r\000\000>9\000\000a#\037\223>9\000\000|r\000\000>9\000\000\236\134\265"
+ "\274\302\306\000\000\236\134KC\302\306\000\000|r\000\000>9\000\000\236\134"
+ "KC\302\306\000\000a#\341l>9\000\000\237\334\341l\302\306\000\000a#\341l>"
+ "9\000\000\236\134KC\302\306\000\000a#\341l>9\000\000\237\334\341l\302\306"
+ "\000\000b\243KC>9\000\000\204\215\000\000\302\306\000\000b\243KC>9\000\000"
+ "\237\334\341l\302\306\000\000b\243KC>9\000\000\204\215\000\000\302\306\000"
+ "\000b\243\265\274>9\000\000\237\334\037\223\302\306\000\000b\243\265\274"
+ ">9\000\000\204\215\000\000\302\306\000\000b\243\265\274>9\000\000\237\334"
+ "\037\223\302\306\000\000a#\037\223>9\000\000a#\037\223>9\000\000\237\334"
+ "\037\223\302\306\000\000\236\134\265\274\302\306\000\000\000\000\000\000"
+ "\001\200\000\000\236\134KC\302\306\000\000\236\134\265\274\302\306\000\000"
+ "\236\134KC\302\306\000\000\000\000\000\000\001\200\000\000\237\334\341l\302"
+ "\306\000\000\000\000\000\000\001\200\000\000\236\134\265\274\302\306\000"
+ "\000\237\334\037\223\302\306\000\000\237\334\341l\302\306\000\000\000\000"
+ "\000\000\001\200\000\000\204\215\000\000\302\306\000\000\204\215\000\000"
+ "\302\306\000\000\000\000\000\000\001\200\000\000\237\334\037\223\302\306"
+ "\000\000>9\227)\236\134\000\000#\352KC\236\134\000\000\077\271\000\000\236"
+ "\134\000\000#\352\265\274\236\134\000\000>9i\326\236\134\000\000\236\134"
+ "\265\274\335\025\000\000|r\000\000#\352\000\000\236\134KC\335\025\000\000"
+ ">9\227)\236\134\000\000>9i\326\236\134\000\000\236\134KC\335\025\000\000"
+ "a#\341l#\352\000\000\237\334\341l\335\025\000\000#\352KC\236\134\000\000"
+ ">9\227)\236\134\000\000\237\334\341l\335\025\000\000b\243KC#\352\000\000"
+ "\204\215\000\000\335\025\000\000\077\271\000\000\236\134\000\000#\352KC\236"
+ "\134\000\000\204\215\000\000\335\025\000\000b\243\265\274#\352\000\000\237"
+ "\334\037\223\335\025\000\000#\352\265\274\236\134\000\000\077\271\000\000"
+ "\236\134\000\000\237\334\037\223\335\025\000\000a#\037\223#\352\000\000\236"
+ "\134\265\274\335\025\000\000>9i\326\236\134\000\000#\352\265\274\236\134"
+ "\000\000|r\000\000#\352\000\000\301F\000\000b\243\000\000\335\025KCb\243"
+ "\000\000a#\341l#\352\000\000\236\134KC\335\025\000\000\236\134\265\274\335"
+ "\025\000\000a#\037\223#\352\000\000\335\025\265\274b\243\000\000\301F\000"
+ "\000b\243\000\000|r\000\000#\352\000\000a#\341l#\352\000\000\335\025KCb\243"
+ "\000\000\302\306\227)b\243\000\000b\243KC#\352\000\000\237\334\341l\335\025"
+ "\000\000b\243KC#\352\000\000\302\306\227)b\243\000\000\302\306i\326b\243"
+ "\000\000b\243\265\274#\352\000\000\204\215\000\000\335\025\000\000b\243\265"
+ "\274#\352\000\000\302\306i\326b\243\000\000\335\025\265\274b\243\000\000"
+ "a#\037\223#\352\000\000\237\334\037\223\335\025\000\000\335\025\265\274b"
+ "\243\000\000\302\306i\326b\243\000\000\302\306\227)b\243\000\000\335\025"
+ "KCb\243\000\000\301F\000\000b\243\000\000&\034&\034&\034\361/\361/\361/\311"
+ "\000\311\000\311\000\361\321\361\321\361\321&\344&\344&\344A\321A\321A\321"
+ "\177\024\177\024\177\024A/A/A/,d,d,d\345S\345S\345S\260>\260>\260>\225\000"
+ "\225\000\225\000\260\302\260\302\260\302\345\255\345\255\345\255,\234,\234"
+ ",\234\177H\177H\177HPpPpPpP\220P\220P\220\235Y\235Y\235Y\235\247\235\247"
+ "\235\247\000\000\000\000\000\000\000\000\000\000U\000U\000U\000U\000U\000"
+ "\026E\026E\026E\026E\026E\312'\312'\312'\312'\312'\312\331\312\331\312\331"
+ "\312\331\312\331\026\273\026\273\026\273\026\273\026\273XIXIXIXIXIX\267X"
+ "\267X\267X\267X\267\306i\306i\306i\306i\306i\201*\201*\201*\201*\201*\306"
+ "\227\306\227\306\227\306\227\306\227\177\177\177\177\177\177\177\177\177"
+ "\177\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000\010"
+ "\000\011\000\012\000\013\000\014\000\015\000\016\000\017\000\020\000\021"
+ "\000\022\000\023\000\024\000\025\000\026\000\027\000\030\000\031\000\032"
+ "\000\033\000\034\000\035\000\036\000\037\000 \000!\000\042\000#\000$\000"
+ "%\000&\000'\000(\000)\000*\000+\000,\000-\000.\000/\0000\0001\0002\0003\000"
+ "4\0005\0006\0007\0008\0009\000:\000;\000<\000=\000>\000<\000>\000\077\000"
+ "<\000\077\000@\000A\000B\000C\000A\000C\000D\000A\000D\000E\000F\000G\000"
+ "H\000F\000H\000I\000F\000I\000J\000K\000L\000M\000K\000M\000N\000K\000N\000"
+ "O\000P\000Q\000R\000P\000R\000S\000P\000S\000T\000U\000V\000W\000U\000W\000"
+ "X\000U\000X\000Y\000Z\000[\000\134\000Z\000\134\000]\000Z\000]\000^\000_"
+ "\000`\000a\000_\000a\000b\000_\000b\000c\000d\000e\000f\000d\000f\000g\000"
+ "d\000g\000h\000i\000j\000k\000i\000k\000l\000i\000l\000m\000n\000o\000p\000"
+ "n\000p\000q\000n\000q\000r\000s\000t\000u\000s\000u\000v\000s\000v\000w\000"
+ "\000\000\001\000\001\000\002\000\000\000\002\000\001\000\003\000\000\000"
+ "\003\000\001\000\006\000\003\000\006\000\001\000\011\000\006\000\011\000"
+ "\002\000\011\000\002\000\017\000\011\000\017\000\017\000\024\000\002\000"
+ "\024\000\000\000\024\000\000\000\030\000\024\000\030\000\003\000\030\000"
+ "\003\000\036\000\030\000\036\000\006\000\036\000\006\000$\000\036\000$\000"
+ "\011\000$\000\017\000$\000\024\000-\000\017\000-\000\030\000-\000$\000-\000"
+ "\036\000-\000<\000=\000=\000>\000<\000>\000>\000\077\000<\000\077\000\077"
+ "\000@\000<\000@\000A\000B\000B\000C\000A\000C\000<\000C\000<\000A\000@\000"
+ "A\000C\000G\000G\000H\000C\000H\000=\000H\000=\000C\000H\000L\000L\000M\000"
+ "H\000M\000>\000M\000>\000H\000M\000Q\000Q\000R\000M\000R\000\077\000R\000"
+ "\077\000M\000R\000V\000A\000V\000A\000R\000@\000R\000B\000[\000[\000\134"
+ "\000B\000\134\000G\000\134\000B\000G\000V\000a\000A\000a\000[\000a\000A\000"
+ "[\000\134\000f\000G\000f\000L\000f\000G\000L\000f\000k\000L\000k\000Q\000"
+ "k\000L\000Q\000a\000k\000Q\000a\000Q\000V\000a\000f\000\134\000a\000"
+;
+const unsigned long tronbit_idle2_size = 1952;
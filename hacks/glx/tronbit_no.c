@@ -1,1087 +1,521 @@
-/* no = second stellation of icosahedron */
+/* Generated from "tronbit_no.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
 
 #include "gllist.h"
-static const float data[]={
-	-0.491121,-0.356821,-0.794656,-0.072949,0.100406,-0.118034,
-	-0.491121,-0.356821,-0.794656,-0.11459,0.117557,-0.1,
-	-0.491121,-0.356821,-0.794656,-0.138196,0.425325,-0.223606,
-	-0.491129,-0.356821,-0.794652,-0.038197,0.117557,-0.147214,
-	-0.491129,-0.356821,-0.794652,-0.072949,0.100406,-0.118034,
-	-0.491129,-0.356821,-0.794652,-0.138196,0.425325,-0.223606,
-	-0.491121,-0.356826,-0.794654,-0.138196,-0.100406,0.012461,
-	-0.491121,-0.356826,-0.794654,-0.123606,-0.145308,0.023607,
-	-0.491121,-0.356826,-0.794654,-0.361803,-0.262865,0.223606,
-	-0.491119,-0.356829,-0.794654,-0.176394,-0.072654,0.023607,
-	-0.491119,-0.356829,-0.794654,-0.138196,-0.100406,0.012461,
-	-0.491119,-0.356829,-0.794654,-0.361803,-0.262865,0.223606,
-	-0.491125,-0.356827,-0.794651,0.072949,-0.100406,-0.118034,
-	-0.491125,-0.356827,-0.794651,0.1,-0.072654,-0.147214,
-	-0.491125,-0.356827,-0.794651,0.361803,-0.262865,-0.223606,
-	-0.491124,-0.356824,-0.794654,0.076393,-0.145308,-0.1,
-	-0.491124,-0.356824,-0.794654,0.072949,-0.100406,-0.118034,
-	-0.491124,-0.356824,-0.794654,0.361803,-0.262865,-0.223606,
-	-0.491124,-0.356822,-0.794654,-0.150658,0.062054,-0.052786,
-	-0.491124,-0.356822,-0.794654,-0.18541,0.044903,-0.023607,
-	-0.491124,-0.356822,-0.794654,-0.223606,0.162459,-0.052786,
-	-0.491128,-0.356819,-0.794653,-0.052786,-0.162459,-0.012461,
-	-0.491128,-0.356819,-0.794653,-0.01459,-0.190211,-0.023607,
-	-0.491128,-0.356819,-0.794653,-0.08541,-0.262865,0.052786,
-	-0.491122,-0.356835,-0.79465,0.065247,0,-0.158359,
-	-0.491122,-0.356835,-0.79465,0.061803,0.044903,-0.176394,
-	-0.491122,-0.356835,-0.79465,0.17082,0,-0.223606,
-	-0.491135,-0.356817,-0.79465,0.061803,0.044903,-0.176394,
-	-0.491135,-0.356817,-0.79465,0.020163,0.062054,-0.158359,
-	-0.491135,-0.356817,-0.79465,0.052786,0.162459,-0.223606,
-	-0.491124,-0.356824,-0.794654,-0.18541,0.044903,-0.023607,
-	-0.491124,-0.356824,-0.794654,-0.17082,0,-0.012461,
-	-0.491124,-0.356824,-0.794654,-0.276393,0,0.052786,
-	-0.49112,-0.35682,-0.794658,-0.01459,-0.190211,-0.023607,
-	-0.49112,-0.35682,-0.794658,0.012461,-0.162459,-0.052786,
-	-0.49112,-0.35682,-0.794658,0.08541,-0.262865,-0.052786,
-	-0.491124,-0.35682,-0.794655,-0.11459,0.117557,-0.1,
-	-0.491124,-0.35682,-0.794655,-0.111804,0.08123,-0.08541,
-	-0.491124,-0.35682,-0.794655,-0.223606,0.162459,-0.052786,
-	-0.491133,-0.356822,-0.794648,-0.123606,-0.145308,0.023607,
-	-0.491133,-0.356822,-0.794648,-0.095491,-0.131433,0,
-	-0.491133,-0.356822,-0.794648,-0.08541,-0.262865,0.052786,
-	-0.491129,-0.356813,-0.794655,0.1,-0.072654,-0.147214,
-	-0.491129,-0.356813,-0.794655,0.069098,-0.050203,-0.138196,
-	-0.491129,-0.356813,-0.794655,0.17082,0,-0.223606,
-	-0.491117,-0.35683,-0.794655,-0.026393,0.08123,-0.138196,
-	-0.491117,-0.35683,-0.794655,-0.038197,0.117557,-0.147214,
-	-0.491117,-0.35683,-0.794655,0.052786,0.162459,-0.223606,
-	-0.491122,-0.356812,-0.79466,-0.154508,-0.050203,0,
-	-0.491122,-0.356812,-0.79466,-0.176394,-0.072654,0.023607,
-	-0.491122,-0.356812,-0.79466,-0.276393,0,0.052786,
-	-0.491117,-0.356823,-0.794658,0.042705,-0.131433,-0.08541,
-	-0.491117,-0.356823,-0.794658,0.076393,-0.145308,-0.1,
-	-0.491117,-0.356823,-0.794658,0.08541,-0.262865,-0.052786,
-	-0.607065,0.000003,0.794652,0,0.124108,0.118034,
-	-0.607065,0.000003,0.794652,0.038197,0.117557,0.147214,
-	-0.607065,0.000003,0.794652,0.138196,0.425325,0.223606,
-	-0.607062,0,0.794655,-0.023607,0.162459,0.1,
-	-0.607062,0,0.794655,0,0.124108,0.118034,
-	-0.607062,0,0.794655,0.138196,0.425325,0.223606,
-	-0.607062,0,0.794655,0,-0.124108,0.118034,
-	-0.607062,0,0.794655,-0.023607,-0.162459,0.1,
-	-0.607062,0,0.794655,0.138196,-0.425325,0.223606,
-	-0.607065,-0.000003,0.794652,0.038197,-0.117557,0.147214,
-	-0.607065,-0.000003,0.794652,0,-0.124108,0.118034,
-	-0.607065,-0.000003,0.794652,0.138196,-0.425325,0.223606,
-	-0.607062,-0.000002,0.794654,-0.17082,0,-0.012461,
-	-0.607062,-0.000002,0.794654,-0.18541,0.044903,-0.023607,
-	-0.607062,-0.000002,0.794654,-0.447213,0,-0.223606,
-	-0.607062,0.000002,0.794654,-0.18541,-0.044903,-0.023607,
-	-0.607062,0.000002,0.794654,-0.17082,0,-0.012461,
-	-0.607062,0.000002,0.794654,-0.447213,0,-0.223606,
-	-0.607069,0.000012,0.794649,0.052786,0.038352,0.158359,
-	-0.607069,0.000012,0.794649,0.076393,0,0.176394,
-	-0.607069,0.000012,0.794649,0.138196,0.100406,0.223606,
-	-0.607066,0,0.794652,-0.08541,-0.138758,0.052786,
-	-0.607066,0,0.794652,-0.123606,-0.145308,0.023607,
-	-0.607066,0,0.794652,-0.08541,-0.262865,0.052786,
-	-0.607061,0.000001,0.794655,-0.138196,0.100406,0.012461,
-	-0.607061,0.000001,0.794655,-0.123606,0.145308,0.023607,
-	-0.607061,0.000001,0.794655,-0.223606,0.162459,-0.052786,
-	-0.607066,0,0.794652,-0.123606,0.145308,0.023607,
-	-0.607066,0,0.794652,-0.08541,0.138758,0.052786,
-	-0.607066,0,0.794652,-0.08541,0.262865,0.052786,
-	-0.607069,-0.000012,0.794649,0.076393,0,0.176394,
-	-0.607069,-0.000012,0.794649,0.052786,-0.038352,0.158359,
-	-0.607069,-0.000012,0.794649,0.138196,-0.100406,0.223606,
-	-0.607061,-0.000001,0.794655,-0.123606,-0.145308,0.023607,
-	-0.607061,-0.000001,0.794655,-0.138196,-0.100406,0.012461,
-	-0.607061,-0.000001,0.794655,-0.223606,-0.162459,-0.052786,
-	-0.607061,-0.00001,0.794655,0.038197,0.117557,0.147214,
-	-0.607061,-0.00001,0.794655,0.026393,0.08123,0.138196,
-	-0.607061,-0.00001,0.794655,0.138196,0.100406,0.223606,
-	-0.607061,0,0.794655,-0.023607,-0.162459,0.1,
-	-0.607061,0,0.794655,-0.042705,-0.131433,0.08541,
-	-0.607061,0,0.794655,-0.08541,-0.262865,0.052786,
-	-0.60706,0.000002,0.794656,-0.18541,0.044903,-0.023607,
-	-0.60706,0.000002,0.794656,-0.154508,0.050203,0,
-	-0.60706,0.000002,0.794656,-0.223606,0.162459,-0.052786,
-	-0.607061,0,0.794655,-0.042705,0.131433,0.08541,
-	-0.607061,0,0.794655,-0.023607,0.162459,0.1,
-	-0.607061,0,0.794655,-0.08541,0.262865,0.052786,
-	-0.607061,0.00001,0.794655,0.026393,-0.08123,0.138196,
-	-0.607061,0.00001,0.794655,0.038197,-0.117557,0.147214,
-	-0.607061,0.00001,0.794655,0.138196,-0.100406,0.223606,
-	-0.60706,-0.000002,0.794656,-0.154508,-0.050203,0,
-	-0.60706,-0.000002,0.794656,-0.18541,-0.044903,-0.023607,
-	-0.60706,-0.000002,0.794656,-0.223606,-0.162459,-0.052786,
-	0.303526,0.934174,-0.187592,0.020163,0.062054,-0.158359,
-	0.303526,0.934174,-0.187592,0.061803,0.044903,-0.176394,
-	0.303526,0.934174,-0.187592,0,0,-0.5,
-	0.303535,0.934171,-0.187592,-0.023607,0.072654,-0.176394,
-	0.303535,0.934171,-0.187592,0.020163,0.062054,-0.158359,
-	0.303535,0.934171,-0.187592,0,0,-0.5,
-	0.303532,0.934172,-0.187594,0.150658,0.062054,0.052786,
-	0.303532,0.934172,-0.187594,0.147214,0.072654,0.1,
-	0.303532,0.934172,-0.187594,0.447213,0,0.223606,
-	0.303531,0.934173,-0.187591,0.18541,0.044903,0.023607,
-	0.303531,0.934173,-0.187591,0.150658,0.062054,0.052786,
-	0.303531,0.934173,-0.187591,0.447213,0,0.223606,
-	0.303523,0.934173,-0.187603,-0.08541,0.138758,0.052786,
-	0.303523,0.934173,-0.187603,-0.123606,0.145308,0.023607,
-	0.303523,0.934173,-0.187603,-0.361803,0.262865,0.223606,
-	0.303538,0.934173,-0.187579,-0.076393,0.145308,0.1,
-	0.303538,0.934173,-0.187579,-0.08541,0.138758,0.052786,
-	0.303538,0.934173,-0.187579,-0.361803,0.262865,0.223606,
-	0.303529,0.934173,-0.187594,0.118034,0.038352,-0.118034,
-	0.303529,0.934173,-0.187594,0.161804,0.027751,-0.1,
-	0.303529,0.934173,-0.187594,0.17082,0,-0.223606,
-	0.30353,0.934173,-0.187591,0.072949,0.100406,0.118034,
-	0.30353,0.934173,-0.187591,0.038197,0.117557,0.147214,
-	0.30353,0.934173,-0.187591,0.138196,0.100406,0.223606,
-	0.303526,0.934172,-0.187599,-0.105573,0.124108,-0.052786,
-	0.303526,0.934172,-0.187599,-0.11459,0.117557,-0.1,
-	0.303526,0.934172,-0.187599,-0.223606,0.162459,-0.052786,
-	0.30353,0.934173,-0.187591,-0.11459,0.117557,-0.1,
-	0.30353,0.934173,-0.187591,-0.072949,0.100406,-0.118034,
-	0.30353,0.934173,-0.187591,-0.138196,0.100406,-0.223606,
-	0.303531,0.934173,-0.187588,0.161804,0.027751,-0.1,
-	0.303531,0.934173,-0.187588,0.158359,0.038352,-0.052786,
-	0.303531,0.934173,-0.187588,0.276393,0,-0.052786,
-	0.303534,0.934173,-0.187586,0.038197,0.117557,0.147214,
-	0.303534,0.934173,-0.187586,0,0.124108,0.118034,
-	0.303534,0.934173,-0.187586,-0.052786,0.162459,0.223606,
-	0.303535,0.934172,-0.187588,0.061803,0.044903,-0.176394,
-	0.303535,0.934172,-0.187588,0.069098,0.050203,-0.138196,
-	0.303535,0.934172,-0.187588,0.17082,0,-0.223606,
-	0.303531,0.934173,-0.187592,0.147214,0.072654,0.1,
-	0.303531,0.934173,-0.187592,0.111804,0.08123,0.08541,
-	0.303531,0.934173,-0.187592,0.138196,0.100406,0.223606,
-	0.303524,0.934177,-0.187583,-0.123606,0.145308,0.023607,
-	0.303524,0.934177,-0.187583,-0.095491,0.131433,0,
-	0.303524,0.934177,-0.187583,-0.223606,0.162459,-0.052786,
-	0.303529,0.934174,-0.187588,-0.026393,0.08123,-0.138196,
-	0.303529,0.934174,-0.187588,-0.023607,0.072654,-0.176394,
-	0.303529,0.934174,-0.187588,-0.138196,0.100406,-0.223606,
-	0.30353,0.934172,-0.187595,0.154508,0.050203,0,
-	0.30353,0.934172,-0.187595,0.18541,0.044903,0.023607,
-	0.30353,0.934172,-0.187595,0.276393,0,-0.052786,
-	0.303516,0.934178,-0.18759,-0.042705,0.131433,0.08541,
-	0.303516,0.934178,-0.18759,-0.076393,0.145308,0.1,
-	0.303516,0.934178,-0.18759,-0.052786,0.162459,0.223606,
-	0.794658,-0.577347,0.187587,0.012461,-0.162459,-0.052786,
-	0.794658,-0.577347,0.187587,-0.01459,-0.190211,-0.023607,
-	0.794658,-0.577347,0.187587,-0.138196,-0.425325,-0.223606,
-	0.794655,-0.577349,0.187593,0.023607,-0.162459,-0.1,
-	0.794655,-0.577349,0.187593,0.012461,-0.162459,-0.052786,
-	0.794655,-0.577349,0.187593,-0.138196,-0.425325,-0.223606,
-	0.794653,-0.577353,0.187592,0.052786,-0.038352,0.158359,
-	0.794653,-0.577353,0.187592,0.076393,0,0.176394,
-	0.794653,-0.577353,0.187592,0,0,0.5,
-	0.794657,-0.577347,0.187592,0.023607,-0.072654,0.176394,
-	0.794657,-0.577347,0.187592,0.052786,-0.038352,0.158359,
-	0.794657,-0.577347,0.187592,0,0,0.5,
-	0.794656,-0.577344,0.187604,0.158359,0.038352,-0.052786,
-	0.794656,-0.577344,0.187604,0.161804,0.027751,-0.1,
-	0.794656,-0.577344,0.187604,0.361803,0.262865,-0.223606,
-	0.794652,-0.577358,0.18758,0.176394,0.072654,-0.023607,
-	0.794652,-0.577358,0.18758,0.158359,0.038352,-0.052786,
-	0.794652,-0.577358,0.18758,0.361803,0.262865,-0.223606,
-	0.794654,-0.57735,0.187593,-0.012461,-0.162459,0.052786,
-	0.794654,-0.57735,0.187593,-0.023607,-0.162459,0.1,
-	0.794654,-0.57735,0.187593,-0.08541,-0.262865,0.052786,
-	0.794652,-0.577353,0.187596,0.118034,0.038352,0.118034,
-	0.794652,-0.577353,0.187596,0.147214,0.072654,0.1,
-	0.794652,-0.577353,0.187596,0.138196,0.100406,0.223606,
-	0.794654,-0.577351,0.187592,0.118034,-0.038352,-0.118034,
-	0.794654,-0.577351,0.187592,0.1,-0.072654,-0.147214,
-	0.794654,-0.577351,0.187592,0.17082,0,-0.223606,
-	0.794655,-0.57735,0.18759,0.1,-0.072654,-0.147214,
-	0.794655,-0.57735,0.18759,0.072949,-0.100406,-0.118034,
-	0.794655,-0.57735,0.18759,0.052786,-0.162459,-0.223606,
-	0.79465,-0.577356,0.187592,-0.023607,-0.162459,0.1,
-	0.79465,-0.577356,0.187592,0,-0.124108,0.118034,
-	0.79465,-0.577356,0.187592,-0.052786,-0.162459,0.223606,
-	0.794655,-0.577351,0.187588,0.147214,0.072654,0.1,
-	0.794655,-0.577351,0.187588,0.150658,0.062054,0.052786,
-	0.794655,-0.577351,0.187588,0.223606,0.162459,0.052786,
-	0.794655,-0.577346,0.187602,-0.01459,-0.190211,-0.023607,
-	0.794655,-0.577346,0.187602,0,-0.162459,0,
-	0.794655,-0.577346,0.187602,-0.08541,-0.262865,0.052786,
-	0.794657,-0.577348,0.18759,0.076393,0,0.176394,
-	0.794657,-0.577348,0.18759,0.08541,0,0.138196,
-	0.794657,-0.577348,0.18759,0.138196,0.100406,0.223606,
-	0.794646,-0.577362,0.187591,0.161804,0.027751,-0.1,
-	0.794646,-0.577362,0.187591,0.138196,0,-0.08541,
-	0.794646,-0.577362,0.187591,0.17082,0,-0.223606,
-	0.794649,-0.577358,0.187592,0.042705,-0.131433,-0.08541,
-	0.794649,-0.577358,0.187592,0.023607,-0.162459,-0.1,
-	0.794649,-0.577358,0.187592,0.052786,-0.162459,-0.223606,
-	0.794652,-0.577354,0.18759,0.026393,-0.08123,0.138196,
-	0.794652,-0.577354,0.18759,0.023607,-0.072654,0.176394,
-	0.794652,-0.577354,0.18759,-0.052786,-0.162459,0.223606,
-	0.794648,-0.577354,0.187607,0.154508,0.050203,0,
-	0.794648,-0.577354,0.187607,0.176394,0.072654,-0.023607,
-	0.794648,-0.577354,0.187607,0.223606,0.162459,0.052786,
-	-0.187591,0.577356,0.794651,0.118034,0.038352,0.118034,
-	-0.187591,0.577356,0.794651,0.123606,0,0.147214,
-	-0.187591,0.577356,0.794651,0.447213,0,0.223606,
-	-0.187592,0.577351,0.794654,0.147214,0.072654,0.1,
-	-0.187592,0.577351,0.794654,0.118034,0.038352,0.118034,
-	-0.187592,0.577351,0.794654,0.447213,0,0.223606,
-	-0.187591,0.577349,0.794656,-0.118034,-0.038352,0.118034,
-	-0.187591,0.577349,0.794656,-0.161804,-0.027751,0.1,
-	-0.187591,0.577349,0.794656,-0.361803,-0.262865,0.223606,
-	-0.187596,0.577353,0.794652,-0.1,-0.072654,0.147214,
-	-0.187596,0.577353,0.794652,-0.118034,-0.038352,0.118034,
-	-0.187596,0.577353,0.794652,-0.361803,-0.262865,0.223606,
-	-0.1876,0.577347,0.794655,-0.052786,0.162459,-0.012461,
-	-0.1876,0.577347,0.794655,-0.01459,0.190211,-0.023607,
-	-0.1876,0.577347,0.794655,-0.138196,0.425325,-0.223606,
-	-0.187593,0.577349,0.794655,-0.1,0.162459,-0.023607,
-	-0.187593,0.577349,0.794655,-0.052786,0.162459,-0.012461,
-	-0.187593,0.577349,0.794655,-0.138196,0.425325,-0.223606,
-	-0.187583,0.57736,0.79465,0.052786,-0.038352,0.158359,
-	-0.187583,0.57736,0.79465,0.023607,-0.072654,0.176394,
-	-0.187583,0.57736,0.79465,0.138196,-0.100406,0.223606,
-	-0.187592,0.577347,0.794657,-0.158359,0.038352,0.052786,
-	-0.187592,0.577347,0.794657,-0.176394,0.072654,0.023607,
-	-0.187592,0.577347,0.794657,-0.276393,0,0.052786,
-	-0.187593,0.57735,0.794654,0.052786,0.162459,0.012461,
-	-0.187593,0.57735,0.794654,0.1,0.162459,0.023607,
-	-0.187593,0.57735,0.794654,0.08541,0.262865,-0.052786,
-	-0.187592,0.577357,0.79465,0.1,0.162459,0.023607,
-	-0.187592,0.577357,0.79465,0.105573,0.124108,0.052786,
-	-0.187592,0.577357,0.79465,0.223606,0.162459,0.052786,
-	-0.187605,0.577354,0.794649,0.023607,-0.072654,0.176394,
-	-0.187605,0.577354,0.794649,-0.020163,-0.062054,0.158359,
-	-0.187605,0.577354,0.794649,-0.052786,-0.162459,0.223606,
-	-0.187591,0.577354,0.794652,-0.176394,0.072654,0.023607,
-	-0.187591,0.577354,0.794652,-0.138196,0.100406,0.012461,
-	-0.187591,0.577354,0.794652,-0.223606,0.162459,-0.052786,
-	-0.187604,0.577345,0.794656,0.123606,0,0.147214,
-	-0.187604,0.577345,0.794656,0.08541,0,0.138196,
-	-0.187604,0.577345,0.794656,0.138196,-0.100406,0.223606,
-	-0.187593,0.577352,0.794653,-0.161804,-0.027751,0.1,
-	-0.187593,0.577352,0.794653,-0.138196,0,0.08541,
-	-0.187593,0.577352,0.794653,-0.276393,0,0.052786,
-	-0.187583,0.577345,0.79466,-0.01459,0.190211,-0.023607,
-	-0.187583,0.577345,0.79466,0,0.162459,0,
-	-0.187583,0.577345,0.79466,0.08541,0.262865,-0.052786,
-	-0.187592,0.577351,0.794654,0.111804,0.08123,0.08541,
-	-0.187592,0.577351,0.794654,0.147214,0.072654,0.1,
-	-0.187592,0.577351,0.794654,0.223606,0.162459,0.052786,
-	-0.187584,0.577353,0.794655,-0.069098,-0.050203,0.138196,
-	-0.187584,0.577353,0.794655,-0.1,-0.072654,0.147214,
-	-0.187584,0.577353,0.794655,-0.052786,-0.162459,0.223606,
-	-0.187591,0.577359,0.794648,-0.095491,0.131433,0,
-	-0.187591,0.577359,0.794648,-0.1,0.162459,-0.023607,
-	-0.187591,0.577359,0.794648,-0.223606,0.162459,-0.052786,
-	-0.491124,0.356824,-0.794654,0.072949,0.100406,-0.118034,
-	-0.491124,0.356824,-0.794654,0.076393,0.145308,-0.1,
-	-0.491124,0.356824,-0.794654,0.361803,0.262865,-0.223606,
-	-0.491125,0.356827,-0.794651,0.1,0.072654,-0.147214,
-	-0.491125,0.356827,-0.794651,0.072949,0.100406,-0.118034,
-	-0.491125,0.356827,-0.794651,0.361803,0.262865,-0.223606,
-	-0.491119,0.356829,-0.794654,-0.138196,0.100406,0.012461,
-	-0.491119,0.356829,-0.794654,-0.176394,0.072654,0.023607,
-	-0.491119,0.356829,-0.794654,-0.361803,0.262865,0.223606,
-	-0.491121,0.356826,-0.794654,-0.123606,0.145308,0.023607,
-	-0.491121,0.356826,-0.794654,-0.138196,0.100406,0.012461,
-	-0.491121,0.356826,-0.794654,-0.361803,0.262865,0.223606,
-	-0.491129,0.356821,-0.794652,-0.072949,-0.100406,-0.118034,
-	-0.491129,0.356821,-0.794652,-0.038197,-0.117557,-0.147214,
-	-0.491129,0.356821,-0.794652,-0.138196,-0.425325,-0.223606,
-	-0.491121,0.356821,-0.794656,-0.11459,-0.117557,-0.1,
-	-0.491121,0.356821,-0.794656,-0.072949,-0.100406,-0.118034,
-	-0.491121,0.356821,-0.794656,-0.138196,-0.425325,-0.223606,
-	-0.49112,0.35682,-0.794658,0.012461,0.162459,-0.052786,
-	-0.49112,0.35682,-0.794658,-0.01459,0.190211,-0.023607,
-	-0.49112,0.35682,-0.794658,0.08541,0.262865,-0.052786,
-	-0.491124,0.356824,-0.794654,-0.17082,0,-0.012461,
-	-0.491124,0.356824,-0.794654,-0.18541,-0.044903,-0.023607,
-	-0.491124,0.356824,-0.794654,-0.276393,0,0.052786,
-	-0.491135,0.356817,-0.79465,0.020163,-0.062054,-0.158359,
-	-0.491135,0.356817,-0.79465,0.061803,-0.044903,-0.176394,
-	-0.491135,0.356817,-0.79465,0.052786,-0.162459,-0.223606,
-	-0.491122,0.356835,-0.79465,0.061803,-0.044903,-0.176394,
-	-0.491122,0.356835,-0.79465,0.065247,0,-0.158359,
-	-0.491122,0.356835,-0.79465,0.17082,0,-0.223606,
-	-0.491128,0.356819,-0.794653,-0.01459,0.190211,-0.023607,
-	-0.491128,0.356819,-0.794653,-0.052786,0.162459,-0.012461,
-	-0.491128,0.356819,-0.794653,-0.08541,0.262865,0.052786,
-	-0.491124,0.356822,-0.794654,-0.18541,-0.044903,-0.023607,
-	-0.491124,0.356822,-0.794654,-0.150658,-0.062054,-0.052786,
-	-0.491124,0.356822,-0.794654,-0.223606,-0.162459,-0.052786,
-	-0.491117,0.356823,-0.794658,0.076393,0.145308,-0.1,
-	-0.491117,0.356823,-0.794658,0.042705,0.131433,-0.08541,
-	-0.491117,0.356823,-0.794658,0.08541,0.262865,-0.052786,
-	-0.491122,0.356812,-0.79466,-0.176394,0.072654,0.023607,
-	-0.491122,0.356812,-0.79466,-0.154508,0.050203,0,
-	-0.491122,0.356812,-0.79466,-0.276393,0,0.052786,
-	-0.491117,0.35683,-0.794655,-0.038197,-0.117557,-0.147214,
-	-0.491117,0.35683,-0.794655,-0.026393,-0.08123,-0.138196,
-	-0.491117,0.35683,-0.794655,0.052786,-0.162459,-0.223606,
-	-0.491129,0.356813,-0.794655,0.069098,0.050203,-0.138196,
-	-0.491129,0.356813,-0.794655,0.1,0.072654,-0.147214,
-	-0.491129,0.356813,-0.794655,0.17082,0,-0.223606,
-	-0.491133,0.356822,-0.794648,-0.095491,0.131433,0,
-	-0.491133,0.356822,-0.794648,-0.123606,0.145308,0.023607,
-	-0.491133,0.356822,-0.794648,-0.08541,0.262865,0.052786,
-	-0.491124,0.35682,-0.794655,-0.111804,-0.08123,-0.08541,
-	-0.491124,0.35682,-0.794655,-0.11459,-0.117557,-0.1,
-	-0.491124,0.35682,-0.794655,-0.223606,-0.162459,-0.052786,
-	0.982247,0.000005,-0.187592,0.065247,0,-0.158359,
-	0.982247,0.000005,-0.187592,0.061803,-0.044903,-0.176394,
-	0.982247,0.000005,-0.187592,0,0,-0.5,
-	0.982247,-0.000005,-0.187592,0.061803,0.044903,-0.176394,
-	0.982247,-0.000005,-0.187592,0.065247,0,-0.158359,
-	0.982247,-0.000005,-0.187592,0,0,-0.5,
-	0.982245,-0.000005,-0.187601,0.105573,-0.124108,0.052786,
-	0.982245,-0.000005,-0.187601,0.11459,-0.117557,0.1,
-	0.982245,-0.000005,-0.187601,0.138196,-0.425325,0.223606,
-	0.982248,0.000002,-0.187589,0.1,-0.162459,0.023607,
-	0.982248,0.000002,-0.187589,0.105573,-0.124108,0.052786,
-	0.982248,0.000002,-0.187589,0.138196,-0.425325,0.223606,
-	0.982248,-0.000002,-0.187589,0.105573,0.124108,0.052786,
-	0.982248,-0.000002,-0.187589,0.1,0.162459,0.023607,
-	0.982248,-0.000002,-0.187589,0.138196,0.425325,0.223606,
-	0.982245,0.000005,-0.187601,0.11459,0.117557,0.1,
-	0.982245,0.000005,-0.187601,0.105573,0.124108,0.052786,
-	0.982245,0.000005,-0.187601,0.138196,0.425325,0.223606,
-	0.982247,-0.000001,-0.187593,0.072949,-0.100406,-0.118034,
-	0.982247,-0.000001,-0.187593,0.076393,-0.145308,-0.1,
-	0.982247,-0.000001,-0.187593,0.052786,-0.162459,-0.223606,
-	0.982248,0.000006,-0.187588,0.118034,-0.038352,0.118034,
-	0.982248,0.000006,-0.187588,0.123606,0,0.147214,
-	0.982248,0.000006,-0.187588,0.138196,-0.100406,0.223606,
-	0.982247,0,-0.187593,0.08541,0.138758,-0.052786,
-	0.982247,0,-0.187593,0.076393,0.145308,-0.1,
-	0.982247,0,-0.187593,0.08541,0.262865,-0.052786,
-	0.982247,0.000001,-0.187593,0.076393,0.145308,-0.1,
-	0.982247,0.000001,-0.187593,0.072949,0.100406,-0.118034,
-	0.982247,0.000001,-0.187593,0.052786,0.162459,-0.223606,
-	0.982247,0,-0.187593,0.076393,-0.145308,-0.1,
-	0.982247,0,-0.187593,0.08541,-0.138758,-0.052786,
-	0.982247,0,-0.187593,0.08541,-0.262865,-0.052786,
-	0.982248,-0.000006,-0.187588,0.123606,0,0.147214,
-	0.982248,-0.000006,-0.187588,0.118034,0.038352,0.118034,
-	0.982248,-0.000006,-0.187588,0.138196,0.100406,0.223606,
-	0.982248,-0.000003,-0.187589,0.061803,-0.044903,-0.176394,
-	0.982248,-0.000003,-0.187589,0.069098,-0.050203,-0.138196,
-	0.982248,-0.000003,-0.187589,0.052786,-0.162459,-0.223606,
-	0.982248,-0.000002,-0.187589,0.11459,-0.117557,0.1,
-	0.982248,-0.000002,-0.187589,0.111804,-0.08123,0.08541,
-	0.982248,-0.000002,-0.187589,0.138196,-0.100406,0.223606,
-	0.982247,0.000001,-0.187591,0.1,0.162459,0.023607,
-	0.982247,0.000001,-0.187591,0.095491,0.131433,0,
-	0.982247,0.000001,-0.187591,0.08541,0.262865,-0.052786,
-	0.982248,0.000003,-0.187589,0.069098,0.050203,-0.138196,
-	0.982248,0.000003,-0.187589,0.061803,0.044903,-0.176394,
-	0.982248,0.000003,-0.187589,0.052786,0.162459,-0.223606,
-	0.982247,-0.000001,-0.187591,0.095491,-0.131433,0,
-	0.982247,-0.000001,-0.187591,0.1,-0.162459,0.023607,
-	0.982247,-0.000001,-0.187591,0.08541,-0.262865,-0.052786,
-	0.982248,0.000002,-0.187589,0.111804,0.08123,0.08541,
-	0.982248,0.000002,-0.187589,0.11459,0.117557,0.1,
-	0.982248,0.000002,-0.187589,0.138196,0.100406,0.223606,
-	-0.303531,-0.934173,0.187591,-0.150658,-0.062054,-0.052786,
-	-0.303531,-0.934173,0.187591,-0.18541,-0.044903,-0.023607,
-	-0.303531,-0.934173,0.187591,-0.447213,0,-0.223606,
-	-0.303532,-0.934172,0.187594,-0.147214,-0.072654,-0.1,
-	-0.303532,-0.934172,0.187594,-0.150658,-0.062054,-0.052786,
-	-0.303532,-0.934172,0.187594,-0.447213,0,-0.223606,
-	-0.303535,-0.934171,0.187592,-0.020163,-0.062054,0.158359,
-	-0.303535,-0.934171,0.187592,0.023607,-0.072654,0.176394,
-	-0.303535,-0.934171,0.187592,0,0,0.5,
-	-0.303526,-0.934174,0.187592,-0.061803,-0.044903,0.176394,
-	-0.303526,-0.934174,0.187592,-0.020163,-0.062054,0.158359,
-	-0.303526,-0.934174,0.187592,0,0,0.5,
-	-0.303538,-0.934173,0.187579,0.08541,-0.138758,-0.052786,
-	-0.303538,-0.934173,0.187579,0.076393,-0.145308,-0.1,
-	-0.303538,-0.934173,0.187579,0.361803,-0.262865,-0.223606,
-	-0.303523,-0.934173,0.187603,0.123606,-0.145308,-0.023607,
-	-0.303523,-0.934173,0.187603,0.08541,-0.138758,-0.052786,
-	-0.303523,-0.934173,0.187603,0.361803,-0.262865,-0.223606,
-	-0.303531,-0.934173,0.187588,-0.158359,-0.038352,0.052786,
-	-0.303531,-0.934173,0.187588,-0.161804,-0.027751,0.1,
-	-0.303531,-0.934173,0.187588,-0.276393,0,0.052786,
-	-0.30353,-0.934173,0.187591,0.072949,-0.100406,0.118034,
-	-0.30353,-0.934173,0.187591,0.11459,-0.117557,0.1,
-	-0.30353,-0.934173,0.187591,0.138196,-0.100406,0.223606,
-	-0.303534,-0.934173,0.187586,0,-0.124108,-0.118034,
-	-0.303534,-0.934173,0.187586,-0.038197,-0.117557,-0.147214,
-	-0.303534,-0.934173,0.187586,0.052786,-0.162459,-0.223606,
-	-0.30353,-0.934173,0.187591,-0.038197,-0.117557,-0.147214,
-	-0.30353,-0.934173,0.187591,-0.072949,-0.100406,-0.118034,
-	-0.30353,-0.934173,0.187591,-0.138196,-0.100406,-0.223606,
-	-0.303529,-0.934173,0.187594,-0.161804,-0.027751,0.1,
-	-0.303529,-0.934173,0.187594,-0.118034,-0.038352,0.118034,
-	-0.303529,-0.934173,0.187594,-0.17082,0,0.223606,
-	-0.303526,-0.934172,0.187599,0.11459,-0.117557,0.1,
-	-0.303526,-0.934172,0.187599,0.105573,-0.124108,0.052786,
-	-0.303526,-0.934172,0.187599,0.223606,-0.162459,0.052786,
-	-0.30353,-0.934172,0.187595,-0.18541,-0.044903,-0.023607,
-	-0.30353,-0.934172,0.187595,-0.154508,-0.050203,0,
-	-0.30353,-0.934172,0.187595,-0.276393,0,0.052786,
-	-0.303529,-0.934174,0.187588,0.023607,-0.072654,0.176394,
-	-0.303529,-0.934174,0.187588,0.026393,-0.08123,0.138196,
-	-0.303529,-0.934174,0.187588,0.138196,-0.100406,0.223606,
-	-0.303516,-0.934178,0.18759,0.076393,-0.145308,-0.1,
-	-0.303516,-0.934178,0.18759,0.042705,-0.131433,-0.08541,
-	-0.303516,-0.934178,0.18759,0.052786,-0.162459,-0.223606,
-	-0.303531,-0.934173,0.187592,-0.111804,-0.08123,-0.08541,
-	-0.303531,-0.934173,0.187592,-0.147214,-0.072654,-0.1,
-	-0.303531,-0.934173,0.187592,-0.138196,-0.100406,-0.223606,
-	-0.303535,-0.934172,0.187588,-0.069098,-0.050203,0.138196,
-	-0.303535,-0.934172,0.187588,-0.061803,-0.044903,0.176394,
-	-0.303535,-0.934172,0.187588,-0.17082,0,0.223606,
-	-0.303524,-0.934177,0.187583,0.095491,-0.131433,0,
-	-0.303524,-0.934177,0.187583,0.123606,-0.145308,-0.023607,
-	-0.303524,-0.934177,0.187583,0.223606,-0.162459,0.052786,
-	0.187592,-0.577351,-0.794654,-0.118034,-0.038352,-0.118034,
-	0.187592,-0.577351,-0.794654,-0.147214,-0.072654,-0.1,
-	0.187592,-0.577351,-0.794654,-0.447213,0,-0.223606,
-	0.187591,-0.577356,-0.794651,-0.123606,0,-0.147214,
-	0.187591,-0.577356,-0.794651,-0.118034,-0.038352,-0.118034,
-	0.187591,-0.577356,-0.794651,-0.447213,0,-0.223606,
-	0.187593,-0.577349,-0.794655,0.052786,-0.162459,0.012461,
-	0.187593,-0.577349,-0.794655,0.1,-0.162459,0.023607,
-	0.187593,-0.577349,-0.794655,0.138196,-0.425325,0.223606,
-	0.1876,-0.577347,-0.794655,0.01459,-0.190211,0.023607,
-	0.1876,-0.577347,-0.794655,0.052786,-0.162459,0.012461,
-	0.1876,-0.577347,-0.794655,0.138196,-0.425325,0.223606,
-	0.187596,-0.577353,-0.794652,0.118034,0.038352,-0.118034,
-	0.187596,-0.577353,-0.794652,0.1,0.072654,-0.147214,
-	0.187596,-0.577353,-0.794652,0.361803,0.262865,-0.223606,
-	0.187591,-0.577349,-0.794656,0.161804,0.027751,-0.1,
-	0.187591,-0.577349,-0.794656,0.118034,0.038352,-0.118034,
-	0.187591,-0.577349,-0.794656,0.361803,0.262865,-0.223606,
-	0.187592,-0.577357,-0.79465,-0.105573,-0.124108,-0.052786,
-	0.187592,-0.577357,-0.79465,-0.1,-0.162459,-0.023607,
-	0.187592,-0.577357,-0.79465,-0.223606,-0.162459,-0.052786,
-	0.187591,-0.577354,-0.794652,0.138196,-0.100406,-0.012461,
-	0.187591,-0.577354,-0.794652,0.176394,-0.072654,-0.023607,
-	0.187591,-0.577354,-0.794652,0.223606,-0.162459,0.052786,
-	0.187605,-0.577354,-0.794649,0.020163,0.062054,-0.158359,
-	0.187605,-0.577354,-0.794649,-0.023607,0.072654,-0.176394,
-	0.187605,-0.577354,-0.794649,0.052786,0.162459,-0.223606,
-	0.187583,-0.57736,-0.79465,-0.023607,0.072654,-0.176394,
-	0.187583,-0.57736,-0.79465,-0.052786,0.038352,-0.158359,
-	0.187583,-0.57736,-0.79465,-0.138196,0.100406,-0.223606,
-	0.187593,-0.57735,-0.794654,-0.1,-0.162459,-0.023607,
-	0.187593,-0.57735,-0.794654,-0.052786,-0.162459,-0.012461,
-	0.187593,-0.57735,-0.794654,-0.08541,-0.262865,0.052786,
-	0.187592,-0.577347,-0.794657,0.176394,-0.072654,-0.023607,
-	0.187592,-0.577347,-0.794657,0.158359,-0.038352,-0.052786,
-	0.187592,-0.577347,-0.794657,0.276393,0,-0.052786,
-	0.187592,-0.577351,-0.794654,-0.147214,-0.072654,-0.1,
-	0.187592,-0.577351,-0.794654,-0.111804,-0.08123,-0.08541,
-	0.187592,-0.577351,-0.794654,-0.223606,-0.162459,-0.052786,
-	0.187591,-0.577359,-0.794648,0.1,-0.162459,0.023607,
-	0.187591,-0.577359,-0.794648,0.095491,-0.131433,0,
-	0.187591,-0.577359,-0.794648,0.223606,-0.162459,0.052786,
-	0.187584,-0.577353,-0.794655,0.1,0.072654,-0.147214,
-	0.187584,-0.577353,-0.794655,0.069098,0.050203,-0.138196,
-	0.187584,-0.577353,-0.794655,0.052786,0.162459,-0.223606,
-	0.187604,-0.577345,-0.794656,-0.08541,0,-0.138196,
-	0.187604,-0.577345,-0.794656,-0.123606,0,-0.147214,
-	0.187604,-0.577345,-0.794656,-0.138196,0.100406,-0.223606,
-	0.187583,-0.577345,-0.79466,0,-0.162459,0,
-	0.187583,-0.577345,-0.79466,0.01459,-0.190211,0.023607,
-	0.187583,-0.577345,-0.79466,-0.08541,-0.262865,0.052786,
-	0.187593,-0.577352,-0.794653,0.138196,0,-0.08541,
-	0.187593,-0.577352,-0.794653,0.161804,0.027751,-0.1,
-	0.187593,-0.577352,-0.794653,0.276393,0,-0.052786,
-	-0.187596,-0.577353,0.794652,-0.118034,0.038352,0.118034,
-	-0.187596,-0.577353,0.794652,-0.1,0.072654,0.147214,
-	-0.187596,-0.577353,0.794652,-0.361803,0.262865,0.223606,
-	-0.187591,-0.577349,0.794656,-0.161804,0.027751,0.1,
-	-0.187591,-0.577349,0.794656,-0.118034,0.038352,0.118034,
-	-0.187591,-0.577349,0.794656,-0.361803,0.262865,0.223606,
-	-0.187592,-0.577351,0.794654,0.118034,-0.038352,0.118034,
-	-0.187592,-0.577351,0.794654,0.147214,-0.072654,0.1,
-	-0.187592,-0.577351,0.794654,0.447213,0,0.223606,
-	-0.187591,-0.577356,0.794651,0.123606,0,0.147214,
-	-0.187591,-0.577356,0.794651,0.118034,-0.038352,0.118034,
-	-0.187591,-0.577356,0.794651,0.447213,0,0.223606,
-	-0.187593,-0.577349,0.794655,-0.052786,-0.162459,-0.012461,
-	-0.187593,-0.577349,0.794655,-0.1,-0.162459,-0.023607,
-	-0.187593,-0.577349,0.794655,-0.138196,-0.425325,-0.223606,
-	-0.1876,-0.577347,0.794655,-0.01459,-0.190211,-0.023607,
-	-0.1876,-0.577347,0.794655,-0.052786,-0.162459,-0.012461,
-	-0.1876,-0.577347,0.794655,-0.138196,-0.425325,-0.223606,
-	-0.187605,-0.577354,0.794649,-0.020163,0.062054,0.158359,
-	-0.187605,-0.577354,0.794649,0.023607,0.072654,0.176394,
-	-0.187605,-0.577354,0.794649,-0.052786,0.162459,0.223606,
-	-0.187592,-0.577357,0.79465,0.105573,-0.124108,0.052786,
-	-0.187592,-0.577357,0.79465,0.1,-0.162459,0.023607,
-	-0.187592,-0.577357,0.79465,0.223606,-0.162459,0.052786,
-	-0.187591,-0.577354,0.794652,-0.138196,-0.100406,0.012461,
-	-0.187591,-0.577354,0.794652,-0.176394,-0.072654,0.023607,
-	-0.187591,-0.577354,0.794652,-0.223606,-0.162459,-0.052786,
-	-0.187592,-0.577347,0.794657,-0.176394,-0.072654,0.023607,
-	-0.187592,-0.577347,0.794657,-0.158359,-0.038352,0.052786,
-	-0.187592,-0.577347,0.794657,-0.276393,0,0.052786,
-	-0.187583,-0.57736,0.79465,0.023607,0.072654,0.176394,
-	-0.187583,-0.57736,0.79465,0.052786,0.038352,0.158359,
-	-0.187583,-0.57736,0.79465,0.138196,0.100406,0.223606,
-	-0.187593,-0.57735,0.794654,0.1,-0.162459,0.023607,
-	-0.187593,-0.57735,0.794654,0.052786,-0.162459,0.012461,
-	-0.187593,-0.57735,0.794654,0.08541,-0.262865,-0.052786,
-	-0.187584,-0.577353,0.794655,-0.1,0.072654,0.147214,
-	-0.187584,-0.577353,0.794655,-0.069098,0.050203,0.138196,
-	-0.187584,-0.577353,0.794655,-0.052786,0.162459,0.223606,
-	-0.187592,-0.577351,0.794654,0.147214,-0.072654,0.1,
-	-0.187592,-0.577351,0.794654,0.111804,-0.08123,0.08541,
-	-0.187592,-0.577351,0.794654,0.223606,-0.162459,0.052786,
-	-0.187591,-0.577359,0.794648,-0.1,-0.162459,-0.023607,
-	-0.187591,-0.577359,0.794648,-0.095491,-0.131433,0,
-	-0.187591,-0.577359,0.794648,-0.223606,-0.162459,-0.052786,
-	-0.187593,-0.577352,0.794653,-0.138196,0,0.08541,
-	-0.187593,-0.577352,0.794653,-0.161804,0.027751,0.1,
-	-0.187593,-0.577352,0.794653,-0.276393,0,0.052786,
-	-0.187604,-0.577345,0.794656,0.08541,0,0.138196,
-	-0.187604,-0.577345,0.794656,0.123606,0,0.147214,
-	-0.187604,-0.577345,0.794656,0.138196,0.100406,0.223606,
-	-0.187583,-0.577345,0.79466,0,-0.162459,0,
-	-0.187583,-0.577345,0.79466,-0.01459,-0.190211,-0.023607,
-	-0.187583,-0.577345,0.79466,0.08541,-0.262865,-0.052786,
-	0.794652,0.577358,0.18758,0.158359,-0.038352,-0.052786,
-	0.794652,0.577358,0.18758,0.176394,-0.072654,-0.023607,
-	0.794652,0.577358,0.18758,0.361803,-0.262865,-0.223606,
-	0.794656,0.577344,0.187604,0.161804,-0.027751,-0.1,
-	0.794656,0.577344,0.187604,0.158359,-0.038352,-0.052786,
-	0.794656,0.577344,0.187604,0.361803,-0.262865,-0.223606,
-	0.794657,0.577347,0.187592,0.052786,0.038352,0.158359,
-	0.794657,0.577347,0.187592,0.023607,0.072654,0.176394,
-	0.794657,0.577347,0.187592,0,0,0.5,
-	0.794653,0.577353,0.187592,0.076393,0,0.176394,
-	0.794653,0.577353,0.187592,0.052786,0.038352,0.158359,
-	0.794653,0.577353,0.187592,0,0,0.5,
-	0.794655,0.577349,0.187593,0.012461,0.162459,-0.052786,
-	0.794655,0.577349,0.187593,0.023607,0.162459,-0.1,
-	0.794655,0.577349,0.187593,-0.138196,0.425325,-0.223606,
-	0.794658,0.577347,0.187587,-0.01459,0.190211,-0.023607,
-	0.794658,0.577347,0.187587,0.012461,0.162459,-0.052786,
-	0.794658,0.577347,0.187587,-0.138196,0.425325,-0.223606,
-	0.794655,0.577351,0.187588,0.150658,-0.062054,0.052786,
-	0.794655,0.577351,0.187588,0.147214,-0.072654,0.1,
-	0.794655,0.577351,0.187588,0.223606,-0.162459,0.052786,
-	0.79465,0.577356,0.187592,0,0.124108,0.118034,
-	0.79465,0.577356,0.187592,-0.023607,0.162459,0.1,
-	0.79465,0.577356,0.187592,-0.052786,0.162459,0.223606,
-	0.794655,0.57735,0.18759,0.072949,0.100406,-0.118034,
-	0.794655,0.57735,0.18759,0.1,0.072654,-0.147214,
-	0.794655,0.57735,0.18759,0.052786,0.162459,-0.223606,
-	0.794654,0.577351,0.187592,0.1,0.072654,-0.147214,
-	0.794654,0.577351,0.187592,0.118034,0.038352,-0.118034,
-	0.794654,0.577351,0.187592,0.17082,0,-0.223606,
-	0.794652,0.577353,0.187596,0.147214,-0.072654,0.1,
-	0.794652,0.577353,0.187596,0.118034,-0.038352,0.118034,
-	0.794652,0.577353,0.187596,0.138196,-0.100406,0.223606,
-	0.794654,0.57735,0.187593,-0.023607,0.162459,0.1,
-	0.794654,0.57735,0.187593,-0.012461,0.162459,0.052786,
-	0.794654,0.57735,0.187593,-0.08541,0.262865,0.052786,
-	0.794648,0.577354,0.187607,0.176394,-0.072654,-0.023607,
-	0.794648,0.577354,0.187607,0.154508,-0.050203,0,
-	0.794648,0.577354,0.187607,0.223606,-0.162459,0.052786,
-	0.794652,0.577354,0.18759,0.023607,0.072654,0.176394,
-	0.794652,0.577354,0.18759,0.026393,0.08123,0.138196,
-	0.794652,0.577354,0.18759,-0.052786,0.162459,0.223606,
-	0.794649,0.577358,0.187592,0.023607,0.162459,-0.1,
-	0.794649,0.577358,0.187592,0.042705,0.131433,-0.08541,
-	0.794649,0.577358,0.187592,0.052786,0.162459,-0.223606,
-	0.794646,0.577362,0.187591,0.138196,0,-0.08541,
-	0.794646,0.577362,0.187591,0.161804,-0.027751,-0.1,
-	0.794646,0.577362,0.187591,0.17082,0,-0.223606,
-	0.794657,0.577348,0.18759,0.08541,0,0.138196,
-	0.794657,0.577348,0.18759,0.076393,0,0.176394,
-	0.794657,0.577348,0.18759,0.138196,-0.100406,0.223606,
-	0.794655,0.577346,0.187602,0,0.162459,0,
-	0.794655,0.577346,0.187602,-0.01459,0.190211,-0.023607,
-	0.794655,0.577346,0.187602,-0.08541,0.262865,0.052786,
-	-0.794657,0.577347,-0.187592,-0.052786,0.038352,-0.158359,
-	-0.794657,0.577347,-0.187592,-0.023607,0.072654,-0.176394,
-	-0.794657,0.577347,-0.187592,0,0,-0.5,
-	-0.794653,0.577353,-0.187592,-0.076393,0,-0.176394,
-	-0.794653,0.577353,-0.187592,-0.052786,0.038352,-0.158359,
-	-0.794653,0.577353,-0.187592,0,0,-0.5,
-	-0.794655,0.577349,-0.187593,-0.012461,0.162459,0.052786,
-	-0.794655,0.577349,-0.187593,-0.023607,0.162459,0.1,
-	-0.794655,0.577349,-0.187593,0.138196,0.425325,0.223606,
-	-0.794658,0.577347,-0.187587,0.01459,0.190211,0.023607,
-	-0.794658,0.577347,-0.187587,-0.012461,0.162459,0.052786,
-	-0.794658,0.577347,-0.187587,0.138196,0.425325,0.223606,
-	-0.794652,0.577358,-0.18758,-0.158359,-0.038352,0.052786,
-	-0.794652,0.577358,-0.18758,-0.176394,-0.072654,0.023607,
-	-0.794652,0.577358,-0.18758,-0.361803,-0.262865,0.223606,
-	-0.794656,0.577344,-0.187604,-0.161804,-0.027751,0.1,
-	-0.794656,0.577344,-0.187604,-0.158359,-0.038352,0.052786,
-	-0.794656,0.577344,-0.187604,-0.361803,-0.262865,0.223606,
-	-0.79465,0.577356,-0.187592,0,0.124108,-0.118034,
-	-0.79465,0.577356,-0.187592,0.023607,0.162459,-0.1,
-	-0.79465,0.577356,-0.187592,0.052786,0.162459,-0.223606,
-	-0.794655,0.57735,-0.18759,-0.072949,0.100406,0.118034,
-	-0.794655,0.57735,-0.18759,-0.1,0.072654,0.147214,
-	-0.794655,0.57735,-0.18759,-0.052786,0.162459,0.223606,
-	-0.794655,0.577351,-0.187588,-0.150658,-0.062054,-0.052786,
-	-0.794655,0.577351,-0.187588,-0.147214,-0.072654,-0.1,
-	-0.794655,0.577351,-0.187588,-0.223606,-0.162459,-0.052786,
-	-0.794652,0.577353,-0.187596,-0.147214,-0.072654,-0.1,
-	-0.794652,0.577353,-0.187596,-0.118034,-0.038352,-0.118034,
-	-0.794652,0.577353,-0.187596,-0.138196,-0.100406,-0.223606,
-	-0.794654,0.57735,-0.187593,0.023607,0.162459,-0.1,
-	-0.794654,0.57735,-0.187593,0.012461,0.162459,-0.052786,
-	-0.794654,0.57735,-0.187593,0.08541,0.262865,-0.052786,
-	-0.794654,0.577351,-0.187592,-0.1,0.072654,0.147214,
-	-0.794654,0.577351,-0.187592,-0.118034,0.038352,0.118034,
-	-0.794654,0.577351,-0.187592,-0.17082,0,0.223606,
-	-0.794652,0.577354,-0.18759,-0.023607,0.072654,-0.176394,
-	-0.794652,0.577354,-0.18759,-0.026393,0.08123,-0.138196,
-	-0.794652,0.577354,-0.18759,0.052786,0.162459,-0.223606,
-	-0.794649,0.577358,-0.187592,-0.023607,0.162459,0.1,
-	-0.794649,0.577358,-0.187592,-0.042705,0.131433,0.08541,
-	-0.794649,0.577358,-0.187592,-0.052786,0.162459,0.223606,
-	-0.794648,0.577354,-0.187607,-0.176394,-0.072654,0.023607,
-	-0.794648,0.577354,-0.187607,-0.154508,-0.050203,0,
-	-0.794648,0.577354,-0.187607,-0.223606,-0.162459,-0.052786,
-	-0.794657,0.577348,-0.18759,-0.08541,0,-0.138196,
-	-0.794657,0.577348,-0.18759,-0.076393,0,-0.176394,
-	-0.794657,0.577348,-0.18759,-0.138196,-0.100406,-0.223606,
-	-0.794655,0.577346,-0.187602,0,0.162459,0,
-	-0.794655,0.577346,-0.187602,0.01459,0.190211,0.023607,
-	-0.794655,0.577346,-0.187602,0.08541,0.262865,-0.052786,
-	-0.794646,0.577362,-0.187591,-0.138196,0,0.08541,
-	-0.794646,0.577362,-0.187591,-0.161804,-0.027751,0.1,
-	-0.794646,0.577362,-0.187591,-0.17082,0,0.223606,
-	0.491129,0.356821,0.794652,0.072949,-0.100406,0.118034,
-	0.491129,0.356821,0.794652,0.038197,-0.117557,0.147214,
-	0.491129,0.356821,0.794652,0.138196,-0.425325,0.223606,
-	0.491121,0.356821,0.794656,0.11459,-0.117557,0.1,
-	0.491121,0.356821,0.794656,0.072949,-0.100406,0.118034,
-	0.491121,0.356821,0.794656,0.138196,-0.425325,0.223606,
-	0.491124,0.356824,0.794654,-0.072949,0.100406,0.118034,
-	0.491124,0.356824,0.794654,-0.076393,0.145308,0.1,
-	0.491124,0.356824,0.794654,-0.361803,0.262865,0.223606,
-	0.491125,0.356827,0.794651,-0.1,0.072654,0.147214,
-	0.491125,0.356827,0.794651,-0.072949,0.100406,0.118034,
-	0.491125,0.356827,0.794651,-0.361803,0.262865,0.223606,
-	0.491119,0.356829,0.794654,0.138196,0.100406,-0.012461,
-	0.491119,0.356829,0.794654,0.176394,0.072654,-0.023607,
-	0.491119,0.356829,0.794654,0.361803,0.262865,-0.223606,
-	0.491121,0.356826,0.794654,0.123606,0.145308,-0.023607,
-	0.491121,0.356826,0.794654,0.138196,0.100406,-0.012461,
-	0.491121,0.356826,0.794654,0.361803,0.262865,-0.223606,
-	0.491135,0.356817,0.79465,-0.020163,-0.062054,0.158359,
-	0.491135,0.356817,0.79465,-0.061803,-0.044903,0.176394,
-	0.491135,0.356817,0.79465,-0.052786,-0.162459,0.223606,
-	0.49112,0.35682,0.794658,-0.012461,0.162459,0.052786,
-	0.49112,0.35682,0.794658,0.01459,0.190211,0.023607,
-	0.49112,0.35682,0.794658,-0.08541,0.262865,0.052786,
-	0.491124,0.356824,0.794654,0.17082,0,0.012461,
-	0.491124,0.356824,0.794654,0.18541,-0.044903,0.023607,
-	0.491124,0.356824,0.794654,0.276393,0,-0.052786,
-	0.491124,0.356822,0.794654,0.18541,-0.044903,0.023607,
-	0.491124,0.356822,0.794654,0.150658,-0.062054,0.052786,
-	0.491124,0.356822,0.794654,0.223606,-0.162459,0.052786,
-	0.491122,0.356835,0.79465,-0.061803,-0.044903,0.176394,
-	0.491122,0.356835,0.79465,-0.065247,0,0.158359,
-	0.491122,0.356835,0.79465,-0.17082,0,0.223606,
-	0.491128,0.356819,0.794653,0.01459,0.190211,0.023607,
-	0.491128,0.356819,0.794653,0.052786,0.162459,0.012461,
-	0.491128,0.356819,0.794653,0.08541,0.262865,-0.052786,
-	0.491117,0.35683,0.794655,0.038197,-0.117557,0.147214,
-	0.491117,0.35683,0.794655,0.026393,-0.08123,0.138196,
-	0.491117,0.35683,0.794655,-0.052786,-0.162459,0.223606,
-	0.491117,0.356823,0.794658,-0.076393,0.145308,0.1,
-	0.491117,0.356823,0.794658,-0.042705,0.131433,0.08541,
-	0.491117,0.356823,0.794658,-0.08541,0.262865,0.052786,
-	0.491122,0.356812,0.79466,0.176394,0.072654,-0.023607,
-	0.491122,0.356812,0.79466,0.154508,0.050203,0,
-	0.491122,0.356812,0.79466,0.276393,0,-0.052786,
-	0.491124,0.35682,0.794655,0.111804,-0.08123,0.08541,
-	0.491124,0.35682,0.794655,0.11459,-0.117557,0.1,
-	0.491124,0.35682,0.794655,0.223606,-0.162459,0.052786,
-	0.491129,0.356813,0.794655,-0.069098,0.050203,0.138196,
-	0.491129,0.356813,0.794655,-0.1,0.072654,0.147214,
-	0.491129,0.356813,0.794655,-0.17082,0,0.223606,
-	0.491133,0.356822,0.794648,0.095491,0.131433,0,
-	0.491133,0.356822,0.794648,0.123606,0.145308,-0.023607,
-	0.491133,0.356822,0.794648,0.08541,0.262865,-0.052786,
-	0.187591,0.577349,-0.794656,0.118034,-0.038352,-0.118034,
-	0.187591,0.577349,-0.794656,0.161804,-0.027751,-0.1,
-	0.187591,0.577349,-0.794656,0.361803,-0.262865,-0.223606,
-	0.187596,0.577353,-0.794652,0.1,-0.072654,-0.147214,
-	0.187596,0.577353,-0.794652,0.118034,-0.038352,-0.118034,
-	0.187596,0.577353,-0.794652,0.361803,-0.262865,-0.223606,
-	0.1876,0.577347,-0.794655,0.052786,0.162459,0.012461,
-	0.1876,0.577347,-0.794655,0.01459,0.190211,0.023607,
-	0.1876,0.577347,-0.794655,0.138196,0.425325,0.223606,
-	0.187593,0.577349,-0.794655,0.1,0.162459,0.023607,
-	0.187593,0.577349,-0.794655,0.052786,0.162459,0.012461,
-	0.187593,0.577349,-0.794655,0.138196,0.425325,0.223606,
-	0.187591,0.577356,-0.794651,-0.118034,0.038352,-0.118034,
-	0.187591,0.577356,-0.794651,-0.123606,0,-0.147214,
-	0.187591,0.577356,-0.794651,-0.447213,0,-0.223606,
-	0.187592,0.577351,-0.794654,-0.147214,0.072654,-0.1,
-	0.187592,0.577351,-0.794654,-0.118034,0.038352,-0.118034,
-	0.187592,0.577351,-0.794654,-0.447213,0,-0.223606,
-	0.187592,0.577347,-0.794657,0.158359,0.038352,-0.052786,
-	0.187592,0.577347,-0.794657,0.176394,0.072654,-0.023607,
-	0.187592,0.577347,-0.794657,0.276393,0,-0.052786,
-	0.187593,0.57735,-0.794654,-0.052786,0.162459,-0.012461,
-	0.187593,0.57735,-0.794654,-0.1,0.162459,-0.023607,
-	0.187593,0.57735,-0.794654,-0.08541,0.262865,0.052786,
-	0.187583,0.57736,-0.79465,-0.052786,-0.038352,-0.158359,
-	0.187583,0.57736,-0.79465,-0.023607,-0.072654,-0.176394,
-	0.187583,0.57736,-0.79465,-0.138196,-0.100406,-0.223606,
-	0.187605,0.577354,-0.794649,-0.023607,-0.072654,-0.176394,
-	0.187605,0.577354,-0.794649,0.020163,-0.062054,-0.158359,
-	0.187605,0.577354,-0.794649,0.052786,-0.162459,-0.223606,
-	0.187591,0.577354,-0.794652,0.176394,0.072654,-0.023607,
-	0.187591,0.577354,-0.794652,0.138196,0.100406,-0.012461,
-	0.187591,0.577354,-0.794652,0.223606,0.162459,0.052786,
-	0.187592,0.577357,-0.79465,-0.1,0.162459,-0.023607,
-	0.187592,0.577357,-0.79465,-0.105573,0.124108,-0.052786,
-	0.187592,0.577357,-0.79465,-0.223606,0.162459,-0.052786,
-	0.187593,0.577352,-0.794653,0.161804,-0.027751,-0.1,
-	0.187593,0.577352,-0.794653,0.138196,0,-0.08541,
-	0.187593,0.577352,-0.794653,0.276393,0,-0.052786,
-	0.187583,0.577345,-0.79466,0.01459,0.190211,0.023607,
-	0.187583,0.577345,-0.79466,0,0.162459,0,
-	0.187583,0.577345,-0.79466,-0.08541,0.262865,0.052786,
-	0.187604,0.577345,-0.794656,-0.123606,0,-0.147214,
-	0.187604,0.577345,-0.794656,-0.08541,0,-0.138196,
-	0.187604,0.577345,-0.794656,-0.138196,-0.100406,-0.223606,
-	0.187584,0.577353,-0.794655,0.069098,-0.050203,-0.138196,
-	0.187584,0.577353,-0.794655,0.1,-0.072654,-0.147214,
-	0.187584,0.577353,-0.794655,0.052786,-0.162459,-0.223606,
-	0.187591,0.577359,-0.794648,0.095491,0.131433,0,
-	0.187591,0.577359,-0.794648,0.1,0.162459,0.023607,
-	0.187591,0.577359,-0.794648,0.223606,0.162459,0.052786,
-	0.187592,0.577351,-0.794654,-0.111804,0.08123,-0.08541,
-	0.187592,0.577351,-0.794654,-0.147214,0.072654,-0.1,
-	0.187592,0.577351,-0.794654,-0.223606,0.162459,-0.052786,
-	0.303535,-0.934171,-0.187592,0.020163,-0.062054,-0.158359,
-	0.303535,-0.934171,-0.187592,-0.023607,-0.072654,-0.176394,
-	0.303535,-0.934171,-0.187592,0,0,-0.5,
-	0.303526,-0.934174,-0.187592,0.061803,-0.044903,-0.176394,
-	0.303526,-0.934174,-0.187592,0.020163,-0.062054,-0.158359,
-	0.303526,-0.934174,-0.187592,0,0,-0.5,
-	0.303538,-0.934173,-0.187579,-0.08541,-0.138758,0.052786,
-	0.303538,-0.934173,-0.187579,-0.076393,-0.145308,0.1,
-	0.303538,-0.934173,-0.187579,-0.361803,-0.262865,0.223606,
-	0.303523,-0.934173,-0.187603,-0.123606,-0.145308,0.023607,
-	0.303523,-0.934173,-0.187603,-0.08541,-0.138758,0.052786,
-	0.303523,-0.934173,-0.187603,-0.361803,-0.262865,0.223606,
-	0.303531,-0.934173,-0.187591,0.150658,-0.062054,0.052786,
-	0.303531,-0.934173,-0.187591,0.18541,-0.044903,0.023607,
-	0.303531,-0.934173,-0.187591,0.447213,0,0.223606,
-	0.303532,-0.934172,-0.187594,0.147214,-0.072654,0.1,
-	0.303532,-0.934172,-0.187594,0.150658,-0.062054,0.052786,
-	0.303532,-0.934172,-0.187594,0.447213,0,0.223606,
-	0.30353,-0.934173,-0.187591,-0.072949,-0.100406,-0.118034,
-	0.30353,-0.934173,-0.187591,-0.11459,-0.117557,-0.1,
-	0.30353,-0.934173,-0.187591,-0.138196,-0.100406,-0.223606,
-	0.303534,-0.934173,-0.187586,0,-0.124108,0.118034,
-	0.303534,-0.934173,-0.187586,0.038197,-0.117557,0.147214,
-	0.303534,-0.934173,-0.187586,-0.052786,-0.162459,0.223606,
-	0.303531,-0.934173,-0.187588,0.158359,-0.038352,-0.052786,
-	0.303531,-0.934173,-0.187588,0.161804,-0.027751,-0.1,
-	0.303531,-0.934173,-0.187588,0.276393,0,-0.052786,
-	0.303529,-0.934173,-0.187594,0.161804,-0.027751,-0.1,
-	0.303529,-0.934173,-0.187594,0.118034,-0.038352,-0.118034,
-	0.303529,-0.934173,-0.187594,0.17082,0,-0.223606,
-	0.303526,-0.934172,-0.187599,-0.11459,-0.117557,-0.1,
-	0.303526,-0.934172,-0.187599,-0.105573,-0.124108,-0.052786,
-	0.303526,-0.934172,-0.187599,-0.223606,-0.162459,-0.052786,
-	0.30353,-0.934173,-0.187591,0.038197,-0.117557,0.147214,
-	0.30353,-0.934173,-0.187591,0.072949,-0.100406,0.118034,
-	0.30353,-0.934173,-0.187591,0.138196,-0.100406,0.223606,
-	0.303529,-0.934174,-0.187588,-0.023607,-0.072654,-0.176394,
-	0.303529,-0.934174,-0.187588,-0.026393,-0.08123,-0.138196,
-	0.303529,-0.934174,-0.187588,-0.138196,-0.100406,-0.223606,
-	0.303516,-0.934178,-0.18759,-0.076393,-0.145308,0.1,
-	0.303516,-0.934178,-0.18759,-0.042705,-0.131433,0.08541,
-	0.303516,-0.934178,-0.18759,-0.052786,-0.162459,0.223606,
-	0.30353,-0.934172,-0.187595,0.18541,-0.044903,0.023607,
-	0.30353,-0.934172,-0.187595,0.154508,-0.050203,0,
-	0.30353,-0.934172,-0.187595,0.276393,0,-0.052786,
-	0.303535,-0.934172,-0.187588,0.069098,-0.050203,-0.138196,
-	0.303535,-0.934172,-0.187588,0.061803,-0.044903,-0.176394,
-	0.303535,-0.934172,-0.187588,0.17082,0,-0.223606,
-	0.303524,-0.934177,-0.187583,-0.095491,-0.131433,0,
-	0.303524,-0.934177,-0.187583,-0.123606,-0.145308,0.023607,
-	0.303524,-0.934177,-0.187583,-0.223606,-0.162459,-0.052786,
-	0.303531,-0.934173,-0.187592,0.111804,-0.08123,0.08541,
-	0.303531,-0.934173,-0.187592,0.147214,-0.072654,0.1,
-	0.303531,-0.934173,-0.187592,0.138196,-0.100406,0.223606,
-	-0.982248,-0.000002,0.187589,-0.105573,0.124108,-0.052786,
-	-0.982248,-0.000002,0.187589,-0.1,0.162459,-0.023607,
-	-0.982248,-0.000002,0.187589,-0.138196,0.425325,-0.223606,
-	-0.982245,0.000005,0.187601,-0.11459,0.117557,-0.1,
-	-0.982245,0.000005,0.187601,-0.105573,0.124108,-0.052786,
-	-0.982245,0.000005,0.187601,-0.138196,0.425325,-0.223606,
-	-0.982247,0.000005,0.187592,-0.065247,0,0.158359,
-	-0.982247,0.000005,0.187592,-0.061803,-0.044903,0.176394,
-	-0.982247,0.000005,0.187592,0,0,0.5,
-	-0.982247,-0.000005,0.187592,-0.061803,0.044903,0.176394,
-	-0.982247,-0.000005,0.187592,-0.065247,0,0.158359,
-	-0.982247,-0.000005,0.187592,0,0,0.5,
-	-0.982245,-0.000005,0.187601,-0.105573,-0.124108,-0.052786,
-	-0.982245,-0.000005,0.187601,-0.11459,-0.117557,-0.1,
-	-0.982245,-0.000005,0.187601,-0.138196,-0.425325,-0.223606,
-	-0.982248,0.000002,0.187589,-0.1,-0.162459,-0.023607,
-	-0.982248,0.000002,0.187589,-0.105573,-0.124108,-0.052786,
-	-0.982248,0.000002,0.187589,-0.138196,-0.425325,-0.223606,
-	-0.982247,0,0.187593,-0.08541,0.138758,0.052786,
-	-0.982247,0,0.187593,-0.076393,0.145308,0.1,
-	-0.982247,0,0.187593,-0.08541,0.262865,0.052786,
-	-0.982247,-0.000001,0.187593,-0.072949,-0.100406,0.118034,
-	-0.982247,-0.000001,0.187593,-0.076393,-0.145308,0.1,
-	-0.982247,-0.000001,0.187593,-0.052786,-0.162459,0.223606,
-	-0.982248,0.000006,0.187588,-0.118034,-0.038352,-0.118034,
-	-0.982248,0.000006,0.187588,-0.123606,0,-0.147214,
-	-0.982248,0.000006,0.187588,-0.138196,-0.100406,-0.223606,
-	-0.982248,-0.000006,0.187588,-0.123606,0,-0.147214,
-	-0.982248,-0.000006,0.187588,-0.118034,0.038352,-0.118034,
-	-0.982248,-0.000006,0.187588,-0.138196,0.100406,-0.223606,
-	-0.982247,0.000001,0.187593,-0.076393,0.145308,0.1,
-	-0.982247,0.000001,0.187593,-0.072949,0.100406,0.118034,
-	-0.982247,0.000001,0.187593,-0.052786,0.162459,0.223606,
-	-0.982247,0,0.187593,-0.076393,-0.145308,0.1,
-	-0.982247,0,0.187593,-0.08541,-0.138758,0.052786,
-	-0.982247,0,0.187593,-0.08541,-0.262865,0.052786,
-	-0.982247,0.000001,0.187591,-0.1,0.162459,-0.023607,
-	-0.982247,0.000001,0.187591,-0.095491,0.131433,0,
-	-0.982247,0.000001,0.187591,-0.08541,0.262865,0.052786,
-	-0.982248,-0.000003,0.187589,-0.061803,-0.044903,0.176394,
-	-0.982248,-0.000003,0.187589,-0.069098,-0.050203,0.138196,
-	-0.982248,-0.000003,0.187589,-0.052786,-0.162459,0.223606,
-	-0.982248,-0.000002,0.187589,-0.11459,-0.117557,-0.1,
-	-0.982248,-0.000002,0.187589,-0.111804,-0.08123,-0.08541,
-	-0.982248,-0.000002,0.187589,-0.138196,-0.100406,-0.223606,
-	-0.982248,0.000002,0.187589,-0.111804,0.08123,-0.08541,
-	-0.982248,0.000002,0.187589,-0.11459,0.117557,-0.1,
-	-0.982248,0.000002,0.187589,-0.138196,0.100406,-0.223606,
-	-0.982248,0.000003,0.187589,-0.069098,0.050203,0.138196,
-	-0.982248,0.000003,0.187589,-0.061803,0.044903,0.176394,
-	-0.982248,0.000003,0.187589,-0.052786,0.162459,0.223606,
-	-0.982247,-0.000001,0.187591,-0.095491,-0.131433,0,
-	-0.982247,-0.000001,0.187591,-0.1,-0.162459,-0.023607,
-	-0.982247,-0.000001,0.187591,-0.08541,-0.262865,0.052786,
-	0.607062,0,-0.794655,0,-0.124108,-0.118034,
-	0.607062,0,-0.794655,0.023607,-0.162459,-0.1,
-	0.607062,0,-0.794655,-0.138196,-0.425325,-0.223606,
-	0.607065,-0.000003,-0.794652,-0.038197,-0.117557,-0.147214,
-	0.607065,-0.000003,-0.794652,0,-0.124108,-0.118034,
-	0.607065,-0.000003,-0.794652,-0.138196,-0.425325,-0.223606,
-	0.607062,-0.000002,-0.794654,0.17082,0,0.012461,
-	0.607062,-0.000002,-0.794654,0.18541,0.044903,0.023607,
-	0.607062,-0.000002,-0.794654,0.447213,0,0.223606,
-	0.607062,0.000002,-0.794654,0.18541,-0.044903,0.023607,
-	0.607062,0.000002,-0.794654,0.17082,0,0.012461,
-	0.607062,0.000002,-0.794654,0.447213,0,0.223606,
-	0.607065,0.000003,-0.794652,0,0.124108,-0.118034,
-	0.607065,0.000003,-0.794652,-0.038197,0.117557,-0.147214,
-	0.607065,0.000003,-0.794652,-0.138196,0.425325,-0.223606,
-	0.607062,0,-0.794655,0.023607,0.162459,-0.1,
-	0.607062,0,-0.794655,0,0.124108,-0.118034,
-	0.607062,0,-0.794655,-0.138196,0.425325,-0.223606,
-	0.607066,0,-0.794652,0.08541,-0.138758,-0.052786,
-	0.607066,0,-0.794652,0.123606,-0.145308,-0.023607,
-	0.607066,0,-0.794652,0.08541,-0.262865,-0.052786,
-	0.607061,0.000001,-0.794655,0.138196,0.100406,-0.012461,
-	0.607061,0.000001,-0.794655,0.123606,0.145308,-0.023607,
-	0.607061,0.000001,-0.794655,0.223606,0.162459,0.052786,
-	0.607069,0.000012,-0.794649,-0.052786,0.038352,-0.158359,
-	0.607069,0.000012,-0.794649,-0.076393,0,-0.176394,
-	0.607069,0.000012,-0.794649,-0.138196,0.100406,-0.223606,
-	0.607069,-0.000012,-0.794649,-0.076393,0,-0.176394,
-	0.607069,-0.000012,-0.794649,-0.052786,-0.038352,-0.158359,
-	0.607069,-0.000012,-0.794649,-0.138196,-0.100406,-0.223606,
-	0.607061,-0.000001,-0.794655,0.123606,-0.145308,-0.023607,
-	0.607061,-0.000001,-0.794655,0.138196,-0.100406,-0.012461,
-	0.607061,-0.000001,-0.794655,0.223606,-0.162459,0.052786,
-	0.607066,0,-0.794652,0.123606,0.145308,-0.023607,
-	0.607066,0,-0.794652,0.08541,0.138758,-0.052786,
-	0.607066,0,-0.794652,0.08541,0.262865,-0.052786,
-	0.607061,0,-0.794655,0.023607,-0.162459,-0.1,
-	0.607061,0,-0.794655,0.042705,-0.131433,-0.08541,
-	0.607061,0,-0.794655,0.08541,-0.262865,-0.052786,
-	0.60706,0.000002,-0.794656,0.18541,0.044903,0.023607,
-	0.60706,0.000002,-0.794656,0.154508,0.050203,0,
-	0.60706,0.000002,-0.794656,0.223606,0.162459,0.052786,
-	0.607061,-0.00001,-0.794655,-0.038197,0.117557,-0.147214,
-	0.607061,-0.00001,-0.794655,-0.026393,0.08123,-0.138196,
-	0.607061,-0.00001,-0.794655,-0.138196,0.100406,-0.223606,
-	0.607061,0.00001,-0.794655,-0.026393,-0.08123,-0.138196,
-	0.607061,0.00001,-0.794655,-0.038197,-0.117557,-0.147214,
-	0.607061,0.00001,-0.794655,-0.138196,-0.100406,-0.223606,
-	0.60706,-0.000002,-0.794656,0.154508,-0.050203,0,
-	0.60706,-0.000002,-0.794656,0.18541,-0.044903,0.023607,
-	0.60706,-0.000002,-0.794656,0.223606,-0.162459,0.052786,
-	0.607061,0,-0.794655,0.042705,0.131433,-0.08541,
-	0.607061,0,-0.794655,0.023607,0.162459,-0.1,
-	0.607061,0,-0.794655,0.08541,0.262865,-0.052786,
-	0.491125,-0.356827,0.794651,-0.072949,-0.100406,0.118034,
-	0.491125,-0.356827,0.794651,-0.1,-0.072654,0.147214,
-	0.491125,-0.356827,0.794651,-0.361803,-0.262865,0.223606,
-	0.491124,-0.356824,0.794654,-0.076393,-0.145308,0.1,
-	0.491124,-0.356824,0.794654,-0.072949,-0.100406,0.118034,
-	0.491124,-0.356824,0.794654,-0.361803,-0.262865,0.223606,
-	0.491121,-0.356821,0.794656,0.072949,0.100406,0.118034,
-	0.491121,-0.356821,0.794656,0.11459,0.117557,0.1,
-	0.491121,-0.356821,0.794656,0.138196,0.425325,0.223606,
-	0.491129,-0.356821,0.794652,0.038197,0.117557,0.147214,
-	0.491129,-0.356821,0.794652,0.072949,0.100406,0.118034,
-	0.491129,-0.356821,0.794652,0.138196,0.425325,0.223606,
-	0.491121,-0.356826,0.794654,0.138196,-0.100406,-0.012461,
-	0.491121,-0.356826,0.794654,0.123606,-0.145308,-0.023607,
-	0.491121,-0.356826,0.794654,0.361803,-0.262865,-0.223606,
-	0.491119,-0.356829,0.794654,0.176394,-0.072654,-0.023607,
-	0.491119,-0.356829,0.794654,0.138196,-0.100406,-0.012461,
-	0.491119,-0.356829,0.794654,0.361803,-0.262865,-0.223606,
-	0.491122,-0.356835,0.79465,-0.065247,0,0.158359,
-	0.491122,-0.356835,0.79465,-0.061803,0.044903,0.176394,
-	0.491122,-0.356835,0.79465,-0.17082,0,0.223606,
-	0.491124,-0.356822,0.794654,0.150658,0.062054,0.052786,
-	0.491124,-0.356822,0.794654,0.18541,0.044903,0.023607,
-	0.491124,-0.356822,0.794654,0.223606,0.162459,0.052786,
-	0.491128,-0.356819,0.794653,0.052786,-0.162459,0.012461,
-	0.491128,-0.356819,0.794653,0.01459,-0.190211,0.023607,
-	0.491128,-0.356819,0.794653,0.08541,-0.262865,-0.052786,
-	0.49112,-0.35682,0.794658,0.01459,-0.190211,0.023607,
-	0.49112,-0.35682,0.794658,-0.012461,-0.162459,0.052786,
-	0.49112,-0.35682,0.794658,-0.08541,-0.262865,0.052786,
-	0.491135,-0.356817,0.79465,-0.061803,0.044903,0.176394,
-	0.491135,-0.356817,0.79465,-0.020163,0.062054,0.158359,
-	0.491135,-0.356817,0.79465,-0.052786,0.162459,0.223606,
-	0.491124,-0.356824,0.794654,0.18541,0.044903,0.023607,
-	0.491124,-0.356824,0.794654,0.17082,0,0.012461,
-	0.491124,-0.356824,0.794654,0.276393,0,-0.052786,
-	0.491129,-0.356813,0.794655,-0.1,-0.072654,0.147214,
-	0.491129,-0.356813,0.794655,-0.069098,-0.050203,0.138196,
-	0.491129,-0.356813,0.794655,-0.17082,0,0.223606,
-	0.491124,-0.35682,0.794655,0.11459,0.117557,0.1,
-	0.491124,-0.35682,0.794655,0.111804,0.08123,0.08541,
-	0.491124,-0.35682,0.794655,0.223606,0.162459,0.052786,
-	0.491133,-0.356822,0.794648,0.123606,-0.145308,-0.023607,
-	0.491133,-0.356822,0.794648,0.095491,-0.131433,0,
-	0.491133,-0.356822,0.794648,0.08541,-0.262865,-0.052786,
-	0.491117,-0.356823,0.794658,-0.042705,-0.131433,0.08541,
-	0.491117,-0.356823,0.794658,-0.076393,-0.145308,0.1,
-	0.491117,-0.356823,0.794658,-0.08541,-0.262865,0.052786,
-	0.491117,-0.35683,0.794655,0.026393,0.08123,0.138196,
-	0.491117,-0.35683,0.794655,0.038197,0.117557,0.147214,
-	0.491117,-0.35683,0.794655,-0.052786,0.162459,0.223606,
-	0.491122,-0.356812,0.79466,0.154508,-0.050203,0,
-	0.491122,-0.356812,0.79466,0.176394,-0.072654,-0.023607,
-	0.491122,-0.356812,0.79466,0.276393,0,-0.052786,
-	-0.794653,-0.577353,-0.187592,-0.052786,-0.038352,-0.158359,
-	-0.794653,-0.577353,-0.187592,-0.076393,0,-0.176394,
-	-0.794653,-0.577353,-0.187592,0,0,-0.5,
-	-0.794657,-0.577347,-0.187592,-0.023607,-0.072654,-0.176394,
-	-0.794657,-0.577347,-0.187592,-0.052786,-0.038352,-0.158359,
-	-0.794657,-0.577347,-0.187592,0,0,-0.5,
-	-0.794656,-0.577344,-0.187604,-0.158359,0.038352,0.052786,
-	-0.794656,-0.577344,-0.187604,-0.161804,0.027751,0.1,
-	-0.794656,-0.577344,-0.187604,-0.361803,0.262865,0.223606,
-	-0.794652,-0.577358,-0.18758,-0.176394,0.072654,0.023607,
-	-0.794652,-0.577358,-0.18758,-0.158359,0.038352,0.052786,
-	-0.794652,-0.577358,-0.18758,-0.361803,0.262865,0.223606,
-	-0.794658,-0.577347,-0.187587,-0.012461,-0.162459,0.052786,
-	-0.794658,-0.577347,-0.187587,0.01459,-0.190211,0.023607,
-	-0.794658,-0.577347,-0.187587,0.138196,-0.425325,0.223606,
-	-0.794655,-0.577349,-0.187593,-0.023607,-0.162459,0.1,
-	-0.794655,-0.577349,-0.187593,-0.012461,-0.162459,0.052786,
-	-0.794655,-0.577349,-0.187593,0.138196,-0.425325,0.223606,
-	-0.794652,-0.577353,-0.187596,-0.118034,0.038352,-0.118034,
-	-0.794652,-0.577353,-0.187596,-0.147214,0.072654,-0.1,
-	-0.794652,-0.577353,-0.187596,-0.138196,0.100406,-0.223606,
-	-0.794654,-0.577351,-0.187592,-0.118034,-0.038352,0.118034,
-	-0.794654,-0.577351,-0.187592,-0.1,-0.072654,0.147214,
-	-0.794654,-0.577351,-0.187592,-0.17082,0,0.223606,
-	-0.794654,-0.57735,-0.187593,0.012461,-0.162459,-0.052786,
-	-0.794654,-0.57735,-0.187593,0.023607,-0.162459,-0.1,
-	-0.794654,-0.57735,-0.187593,0.08541,-0.262865,-0.052786,
-	-0.79465,-0.577356,-0.187592,0.023607,-0.162459,-0.1,
-	-0.79465,-0.577356,-0.187592,0,-0.124108,-0.118034,
-	-0.79465,-0.577356,-0.187592,0.052786,-0.162459,-0.223606,
-	-0.794655,-0.577351,-0.187588,-0.147214,0.072654,-0.1,
-	-0.794655,-0.577351,-0.187588,-0.150658,0.062054,-0.052786,
-	-0.794655,-0.577351,-0.187588,-0.223606,0.162459,-0.052786,
-	-0.794655,-0.57735,-0.18759,-0.1,-0.072654,0.147214,
-	-0.794655,-0.57735,-0.18759,-0.072949,-0.100406,0.118034,
-	-0.794655,-0.57735,-0.18759,-0.052786,-0.162459,0.223606,
-	-0.794657,-0.577348,-0.18759,-0.076393,0,-0.176394,
-	-0.794657,-0.577348,-0.18759,-0.08541,0,-0.138196,
-	-0.794657,-0.577348,-0.18759,-0.138196,0.100406,-0.223606,
-	-0.794646,-0.577362,-0.187591,-0.161804,0.027751,0.1,
-	-0.794646,-0.577362,-0.187591,-0.138196,0,0.08541,
-	-0.794646,-0.577362,-0.187591,-0.17082,0,0.223606,
-	-0.794655,-0.577346,-0.187602,0.01459,-0.190211,0.023607,
-	-0.794655,-0.577346,-0.187602,0,-0.162459,0,
-	-0.794655,-0.577346,-0.187602,0.08541,-0.262865,-0.052786,
-	-0.794652,-0.577354,-0.18759,-0.026393,-0.08123,-0.138196,
-	-0.794652,-0.577354,-0.18759,-0.023607,-0.072654,-0.176394,
-	-0.794652,-0.577354,-0.18759,0.052786,-0.162459,-0.223606,
-	-0.794648,-0.577354,-0.187607,-0.154508,0.050203,0,
-	-0.794648,-0.577354,-0.187607,-0.176394,0.072654,0.023607,
-	-0.794648,-0.577354,-0.187607,-0.223606,0.162459,-0.052786,
-	-0.794649,-0.577358,-0.187592,-0.042705,-0.131433,0.08541,
-	-0.794649,-0.577358,-0.187592,-0.023607,-0.162459,0.1,
-	-0.794649,-0.577358,-0.187592,-0.052786,-0.162459,0.223606,
-	-0.303523,0.934173,0.187603,0.08541,0.138758,-0.052786,
-	-0.303523,0.934173,0.187603,0.123606,0.145308,-0.023607,
-	-0.303523,0.934173,0.187603,0.361803,0.262865,-0.223606,
-	-0.303538,0.934173,0.187579,0.076393,0.145308,-0.1,
-	-0.303538,0.934173,0.187579,0.08541,0.138758,-0.052786,
-	-0.303538,0.934173,0.187579,0.361803,0.262865,-0.223606,
-	-0.303526,0.934174,0.187592,-0.020163,0.062054,0.158359,
-	-0.303526,0.934174,0.187592,-0.061803,0.044903,0.176394,
-	-0.303526,0.934174,0.187592,0,0,0.5,
-	-0.303535,0.934171,0.187592,0.023607,0.072654,0.176394,
-	-0.303535,0.934171,0.187592,-0.020163,0.062054,0.158359,
-	-0.303535,0.934171,0.187592,0,0,0.5,
-	-0.303532,0.934172,0.187594,-0.150658,0.062054,-0.052786,
-	-0.303532,0.934172,0.187594,-0.147214,0.072654,-0.1,
-	-0.303532,0.934172,0.187594,-0.447213,0,-0.223606,
-	-0.303531,0.934173,0.187591,-0.18541,0.044903,-0.023607,
-	-0.303531,0.934173,0.187591,-0.150658,0.062054,-0.052786,
-	-0.303531,0.934173,0.187591,-0.447213,0,-0.223606,
-	-0.303526,0.934172,0.187599,0.105573,0.124108,0.052786,
-	-0.303526,0.934172,0.187599,0.11459,0.117557,0.1,
-	-0.303526,0.934172,0.187599,0.223606,0.162459,0.052786,
-	-0.303529,0.934173,0.187594,-0.118034,0.038352,0.118034,
-	-0.303529,0.934173,0.187594,-0.161804,0.027751,0.1,
-	-0.303529,0.934173,0.187594,-0.17082,0,0.223606,
-	-0.30353,0.934173,0.187591,-0.072949,0.100406,-0.118034,
-	-0.30353,0.934173,0.187591,-0.038197,0.117557,-0.147214,
-	-0.30353,0.934173,0.187591,-0.138196,0.100406,-0.223606,
-	-0.303534,0.934173,0.187586,-0.038197,0.117557,-0.147214,
-	-0.303534,0.934173,0.187586,0,0.124108,-0.118034,
-	-0.303534,0.934173,0.187586,0.052786,0.162459,-0.223606,
-	-0.30353,0.934173,0.187591,0.11459,0.117557,0.1,
-	-0.30353,0.934173,0.187591,0.072949,0.100406,0.118034,
-	-0.30353,0.934173,0.187591,0.138196,0.100406,0.223606,
-	-0.303531,0.934173,0.187588,-0.161804,0.027751,0.1,
-	-0.303531,0.934173,0.187588,-0.158359,0.038352,0.052786,
-	-0.303531,0.934173,0.187588,-0.276393,0,0.052786,
-	-0.303524,0.934177,0.187583,0.123606,0.145308,-0.023607,
-	-0.303524,0.934177,0.187583,0.095491,0.131433,0,
-	-0.303524,0.934177,0.187583,0.223606,0.162459,0.052786,
-	-0.303535,0.934172,0.187588,-0.061803,0.044903,0.176394,
-	-0.303535,0.934172,0.187588,-0.069098,0.050203,0.138196,
-	-0.303535,0.934172,0.187588,-0.17082,0,0.223606,
-	-0.303531,0.934173,0.187592,-0.147214,0.072654,-0.1,
-	-0.303531,0.934173,0.187592,-0.111804,0.08123,-0.08541,
-	-0.303531,0.934173,0.187592,-0.138196,0.100406,-0.223606,
-	-0.303516,0.934178,0.18759,0.042705,0.131433,-0.08541,
-	-0.303516,0.934178,0.18759,0.076393,0.145308,-0.1,
-	-0.303516,0.934178,0.18759,0.052786,0.162459,-0.223606,
-	-0.303529,0.934174,0.187588,0.026393,0.08123,0.138196,
-	-0.303529,0.934174,0.187588,0.023607,0.072654,0.176394,
-	-0.303529,0.934174,0.187588,0.138196,0.100406,0.223606,
-	-0.30353,0.934172,0.187595,-0.154508,0.050203,0,
-	-0.30353,0.934172,0.187595,-0.18541,0.044903,-0.023607,
-	-0.30353,0.934172,0.187595,-0.276393,0,0.052786
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,1080,data,NULL};
-const struct gllist *tronbit_no=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char tronbit_no[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\257\002\000\0008\004\000\000\034\002\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\001\2007S\355\264\031\311"
+ "\341\000\000\252\342\030\036g\346\000\000\237\334\341l\302\306\000\0009\366"
+ "\030\036P\332\000\000\237\334L\3461\003\000\000\134\340\315\332\013\006\000"
+ "\000b\243\265\274>9\000\000\330\322g\355\013\006\000\000\255\022L\346\311"
+ "\341\000\000\231\031g\355P\332\000\000\236\134\265\274\302\306\000\000\216"
+ "\023\315\332g\346\000\000o\331\343\017}\362\000\000\211\320\177\013\365\371"
+ "\000\000\302\306\227)}\362\000\000}\362i\326\317\374\000\000D\374O\317\365"
+ "\371\000\000#\352\265\274\203\015\000\000\264\020\000\000v\327\000\000\322"
+ "\017\177\013\330\322\000\000\273+\000\000\302\306\000\000)\005\343\017v\327"
+ "\000\000\203\015\227)\302\306\000\000E\324\000\000\317\374\000\000\077\271"
+ "\000\000\203\015\000\0001\003i\326}\362\000\000\335\025\265\274}\362\000"
+ "\000a\343\313\024#\352\000\000\216\347[\336\000\000\000\000\260\021&\363"
+ "\237\334\000\000>\371\313\024\237\334\000\000r\330&\363\000\000\000\000\357"
+ "\012[\336#\352\000\000\000\000\305\0377\036\000\000\307\011\030\036\260%"
+ "\000\000a#\341l>9\000\000\365\371\227)\231\031\000\000\000\000;\3407\036"
+ "\000\000\365\371i\326\231\031\000\000a#\037\223>9\000\000\307\011\350\341"
+ "\260%\000\000E\324\000\000\317\374\000\000\211\320\177\013\365\371\000\000"
+ "\204\215\000\000\302\306\000\000\211\320\201\364\365\371\000\000\203\015"
+ "\321\011\212(\000\000\216\023\000\000(-\000\000a#\264\031>9\000\000#\352"
+ "{\334\203\015\000\000\134\340\315\332\013\006\000\000#\352\265\274\203\015"
+ "\000\000\237\334\264\0311\003\000\000\134\3403%\013\006\000\000\302\306\227"
+ ")}\362\000\000#\352\205#\203\015\000\000#\352KC\203\015\000\000\203\015/"
+ "\366\212(\000\000a#L\346>9\000\000\237\334L\3461\003\000\000\302\306i\326"
+ "}\362\000\000\302\006\313\024a#\000\000\021\365[\336\335\025\000\000r\330"
+ "\332\014\000\000\000\000\021\365\245!\335\025\000\000\302\0065\353a#\000"
+ "\000r\330&\363\000\000\000\000)\005\343\017v\327\000\000\322\017\177\013"
+ "\330\322\000\000\000\000\000\000\001\200\000\000\365\371\231\022\330\322"
+ "\000\000\221&\343\017\203\015\000\000\260%\231\022\231\031\000\000|r\000"
+ "\000>9\000\000w/\177\013\013\006\000\000#\352\205#\203\015\000\000\134\340"
+ "3%\013\006\000\000b\243KC>9\000\000r\3543%\231\031\000\0007\036\321\011\311"
+ "\341\000\000l)\033\007g\346\000\000\273+\000\000\302\306\000\000\255\022"
+ "\264\0317\036\000\000\307\011\030\036\260%\000\000a#\264\031>9\000\000\371"
+ "\344\305\037}\362\000\000\252\342\030\036g\346\000\000\302\306\227)}\362"
+ "\000\000S\355\264\031\311\341\000\000\237\334\264\031\302\306\000\000\212"
+ "(\321\011}\362\000\000\301F\000\000}\362\000\000\000\000\305\0377\036\000"
+ "\000}\362\227)>9\000\000\260\021\332\014\237\334\000\000\237\034\313\024"
+ "\335\025\000\000\216\347\245!\000\000\000\000>\371\313\024\237\334\000\000"
+ "\216'\332\014\000\000\000\000\021\365\245!\335\025\000\0001\003i\326}\362"
+ "\000\000D\374O\317\365\371\000\000\237\334\037\223\302\306\000\000\013\006"
+ "i\326g\346\000\000\203\015/\366\212(\000\000\216\023\000\000(-\000\000\000"
+ "\000\000\000\377\177\000\000\013\006g\355(-\000\000\212(\321\011}\362\000"
+ "\000l)\033\007g\346\000\000\236\134KC\302\306\000\000(-\231\022\365\371\000"
+ "\000\317\374i\326\203\015\000\000\365\371i\326\231\031\000\000#\352\265\274"
+ "\203\015\000\0007\036\321\0117\036\000\000\260%\231\022\231\031\000\000a"
+ "#\264\031>9\000\0007\036/\366\311\341\000\000\231\031g\355P\332\000\000\273"
+ "+\000\000\302\306\000\000\255\022L\346\311\341\000\000\203\015i\326\302\306"
+ "\000\000\000\000;\3407\036\000\000}\362i\326>9\000\000\221&\343\017\203\015"
+ "\000\000>9\227)\203\015\000\000\000\000i\326\000\000\000\000\335\025\000"
+ "\000a#\000\000a#\000\000#\352\000\000\357\012[\336#\352\000\000\302\0065"
+ "\353a#\000\000\216'\332\014\000\000\000\0007\036\321\0117\036\000\000\244"
+ "\037\000\000\260%\000\000|r\000\000>9\000\000\260%\231\022\231\031\000\000"
+ "\311\341/\3667\036\000\000\224\326\345\370\231\031\000\000b\243\265\274>"
+ "9\000\000g\346g\355\260%\000\000}\362\227)\317\374\000\000D\374\2610\365"
+ "\371\000\000\237\334\341l\302\306\000\000g\346\227)\365\371\000\000\203\015"
+ "/\366\212(\000\000\013\006g\355(-\000\000a#L\346>9\000\000v\327\321\011\203"
+ "\015\000\000\330\322\231\022\013\006\000\000\077\271\000\000\203\015\000"
+ "\000\203\015\227)1\003\000\000\231\031\227)\013\006\000\000\335\025KC}\362"
+ "\000\000\007\033\305\037\203\015\000\000>9\227)\203\015\000\000\327\372\035"
+ "\360\212(\000\000}\362i\326>9\000\000\237\334\264\0311\003\000\000\302\306"
+ "\227)}\362\000\000\335\025\000\000a#\000\000\237\334\000\000\335\025\000"
+ "\000\000\000\227)\000\000\000\000\237\034\313\024\335\025\000\000P\356&\363"
+ "a#\000\000\216\347\245!\000\000\000\000\255\022\264\031\311\341\000\000\216"
+ "\0233%g\346\000\000\236\134KC\302\306\000\000\231\031\231\022P\332\000\000"
+ "\237\334\264\0311\003\000\000\330\322\231\022\013\006\000\000b\243KC>9\000"
+ "\000\134\3403%\013\006\000\000S\355L\346\311\341\000\0009\366\350\341P\332"
+ "\000\000\237\334\037\223\302\306\000\000\252\342\350\341g\346\000\0001\003"
+ "\227)}\362\000\000D\374\2610\365\371\000\000\335\025KC}\362\000\000E\324"
+ "\000\000\317\374\000\000\211\320\201\364\365\371\000\000\077\271\000\000"
+ "\203\015\000\000)\005\035\360v\327\000\000\322\017\201\364\330\322\000\000"
+ "\203\015i\326\302\306\000\000\264\020\000\000v\327\000\000\273+\000\000\302"
+ "\306\000\000}\362\227)\317\374\000\000#\352KC\203\015\000\000o\331\035\360"
+ "}\362\000\000\302\306i\326}\362\000\000\357\012\245!#\352\000\000r\330\332"
+ "\014\000\000\000\000>\3715\353\237\334\000\000\260\021\332\014\237\334\000"
+ "\000\216\347\245!\000\000\000\000a\3435\353#\352\000\000\264\020\000\000"
+ "v\327\000\000\322\017\201\364\330\322\000\000\000\000\000\000\001\200\000"
+ "\000\322\017\177\013\330\322\000\000\264\020\000\000v\327\000\000\000\000"
+ "\000\000\001\200\000\000\007\033;\340\203\015\000\000V\035\350\341\231\031"
+ "\000\000a#\037\223>9\000\000\231\031i\326\013\006\000\000\007\033;\340\203"
+ "\015\000\000a#\037\223>9\000\000\007\033\305\037\203\015\000\000\231\031"
+ "\227)\013\006\000\000a#\341l>9\000\000V\035\030\036\231\031\000\000\007\033"
+ "\305\037\203\015\000\000a#\341l>9\000\000\255\022L\346\311\341\000\000\216"
+ "\023\315\332g\346\000\000\203\015i\326\302\306\000\0007\036/\3667\036\000"
+ "\000\244\037\000\000\260%\000\000a#L\346>9\000\000\335\025\205#}\362\000"
+ "\000\216\0233%g\346\000\000\335\025KC}\362\000\000\255\022\264\031\311\341"
+ "\000\000\203\015\227)\302\306\000\000\216\023\315\332g\346\000\000\335\025"
+ "{\334}\362\000\000\335\025\265\274}\362\000\000\244\037\000\000\260%\000"
+ "\0007\036\321\0117\036\000\000a#\264\031>9\000\000\322\017\201\364\330\322"
+ "\000\000\260\021&\363\237\334\000\000\237\0345\353\335\025\000\000a#L\346"
+ ">9\000\000\231\031\227)\013\006\000\000r\030\245!\000\000\000\000\260\021"
+ "\332\014\237\334\000\000\322\017\177\013\330\322\000\000r\030[\336\000\000"
+ "\000\000\231\031i\326\013\006\000\000\335\025\265\274}\362\000\000\237\034"
+ "\313\024\335\025\000\000a#\264\031>9\000\000o\331\035\360}\362\000\000\211"
+ "\320\201\364\365\371\000\000\204\215\000\000\302\306\000\000P\332g\355g\346"
+ "\000\000\327\372\035\360\212(\000\000\013\006g\355(-\000\000\000\000\000"
+ "\000\377\177\000\000.\360\201\364(-\000\000\335\025{\334}\362\000\000\216"
+ "\023\315\332g\346\000\000\236\134\265\274\302\306\000\000\244\037\315\332"
+ "\365\371\000\000v\327/\366\203\015\000\000\224\326\345\370\231\031\000\000"
+ "\077\271\000\000\203\015\000\000\255\022L\3467\036\000\000V\035\350\341\231"
+ "\031\000\000a#L\346>9\000\000\000\000;\340\311\341\000\0009\366\350\341P"
+ "\332\000\000\203\015i\326\302\306\000\000S\355L\346\311\341\000\000\237\334"
+ "L\346\302\306\000\000\311\341/\3667\036\000\000E\324\000\000>9\000\000\007"
+ "\033;\340\203\015\000\000>9i\326\203\015\000\000r\330&\363\000\000\000\000"
+ "\302\0065\353a#\000\000\357\012[\336#\352\000\000a\3435\353#\352\000\000"
+ "P\356&\363a#\000\000r\030[\336\000\000\000\000\311\341/\366\311\341\000\000"
+ "P\332g\355g\346\000\000\204\215\000\000\302\306\000\000\134\340\000\000P"
+ "\332\000\000\203\015i\3261\003\000\000\231\031i\326\013\006\000\000a#\037"
+ "\223>9\000\000\274\003O\317\013\006\000\0007\036\321\011\311\341\000\000"
+ "\231\031\231\022P\332\000\000\236\134KC\302\306\000\000l)\033\007g\346\000"
+ "\000\371\344;\340}\362\000\000g\346i\326\365\371\000\000\302\306i\326}\362"
+ "\000\000a#L\346\317\374\000\000(-g\355\365\371\000\000>9i\326\203\015\000"
+ "\000)\005\343\017v\327\000\000\365\371\231\022\330\322\000\000\203\015\227"
+ ")\302\306\000\000}\362\321\011v\327\000\000\237\334\264\031\302\306\000\000"
+ "}\362i\326\317\374\000\000#\352\265\274\203\015\000\000\212(/\366}\362\000"
+ "\000\301F\000\000}\362\000\000a\3435\353#\352\000\000r\030[\336\000\000\000"
+ "\000\260\021\332\014\237\334\000\000#\352\000\000\237\334\000\000\000\000"
+ "i\326\000\000\000\000a#\000\000#\352\000\000\311\341\321\0117\036\000\000"
+ "g\346\231\022\260%\000\000b\243KC>9\000\000\224\326\033\007\231\031\000\000"
+ "7\036/\3667\036\000\000\260%g\355\231\031\000\000|r\000\000>9\000\000\244"
+ "\037\000\000\260%\000\000}\362i\326\317\374\000\000g\346i\326\365\371\000"
+ "\000\237\334\037\223\302\306\000\000D\374O\317\365\371\000\000\327\372\343"
+ "\017\212(\000\000\013\006\231\022(-\000\000}\362\227)>9\000\000\007\033;"
+ "\340\203\015\000\000\231\031i\326\013\006\000\000>9i\326\203\015\000\000"
+ "\237\334L\3461\003\000\000\330\322g\355\013\006\000\000\302\306i\326}\362"
+ "\000\000v\327/\366\203\015\000\000\077\271\000\000\203\015\000\000\203\015"
+ "\321\011\212(\000\000a#\264\031>9\000\000\203\015i\3261\003\000\000\335\025"
+ "\265\274}\362\000\000P\356\332\014a#\000\000\237\0345\353\335\025\000\000"
+ "\216\347[\336\000\000\000\000\237\334\000\000\335\025\000\000\335\025\000"
+ "\000a#\000\000\000\000i\326\000\000\000\000\212(/\366}\362\000\000(-g\355"
+ "\365\371\000\000\236\134\265\274\302\306\000\000l)\345\370g\346\000\000\203"
+ "\015\321\011\212(\000\000\013\006\231\022(-\000\000\000\000\000\000\377\177"
+ "\000\000\216\023\000\000(-\000\0001\003\227)}\362\000\000\013\006\227)g\346"
+ "\000\000\237\334\341l\302\306\000\000D\374\2610\365\371\000\000\221&\035"
+ "\360\203\015\000\000\260%g\355\231\031\000\000>9i\326\203\015\000\000\000"
+ "\000\305\0377\036\000\000\365\371\227)\231\031\000\000}\362\227)>9\000\000"
+ "\255\022\264\031\311\341\000\000\231\031\231\022P\332\000\000\203\015\227"
+ ")\302\306\000\0007\036\321\011\311\341\000\000\273+\000\000\302\306\000\000"
+ "7\036/\3667\036\000\000a#L\346>9\000\000\317\374\227)\203\015\000\000#\352"
+ "KC\203\015\000\000\216'&\363\000\000\000\000\302\006\313\024a#\000\000\357"
+ "\012\245!#\352\000\000a#\000\000#\352\000\000\335\025\000\000a#\000\000\000"
+ "\000\227)\000\000\000\000}\362\321\011v\327\000\000\365\371\231\022\330\322"
+ "\000\000\000\000\000\000\001\200\000\000r\354\000\000\330\322\000\000\317"
+ "\374\227)\203\015\000\000\365\371\227)\231\031\000\000a#\341l>9\000\000\274"
+ "\003\2610\013\006\000\000v\327/\366\203\015\000\000\330\322g\355\013\006"
+ "\000\000b\243\265\274>9\000\000\224\326\345\370\231\031\000\000\000\000\305"
+ "\037\311\341\000\000\013\006\227)g\346\000\000\203\015\227)\302\306\000\000"
+ "S\355\264\0317\036\000\000g\346\231\022\260%\000\000}\362\227)>9\000\000"
+ "o\331\035\360}\362\000\000P\332g\355g\346\000\000\302\306i\326}\362\000\000"
+ "\311\341/\366\311\341\000\000\237\334L\346\302\306\000\0001\003\227)}\362"
+ "\000\000\335\025KC}\362\000\000\311\341\321\0117\036\000\000E\324\000\000"
+ ">9\000\000>\371\313\024\237\334\000\000\021\365\245!\335\025\000\000r\330"
+ "&\363\000\000\000\000#\352\000\000\237\334\000\000\000\000\227)\000\000\000"
+ "\000\237\334\000\000\335\025\000\000\255\022L\3467\036\000\000\307\011\350"
+ "\341\260%\000\000a#\037\223>9\000\000V\035\350\341\231\031\000\000S\355\264"
+ "\0317\036\000\000r\3543%\231\031\000\000b\243KC>9\000\000g\346\231\022\260"
+ "%\000\000a#\264\031\317\374\000\000(-\231\022\365\371\000\000\236\134KC\302"
+ "\306\000\000\244\0373%\365\371\000\000\327\372\035\360\212(\000\000.\360"
+ "\201\364(-\000\000}\362i\326>9\000\000\317\374\227)\203\015\000\000\274\003"
+ "\2610\013\006\000\000#\352KC\203\015\000\000\273+\000\0001\003\000\000w/"
+ "\201\364\013\006\000\000\301F\000\000}\362\000\000\221&\035\360\203\015\000"
+ "\000>9i\326\203\015\000\000L\357\000\000\212(\000\000E\324\000\000>9\000"
+ "\000\203\015\227)1\003\000\000\335\025KC}\362\000\000\302\0065\353a#\000"
+ "\000\021\365\245!\335\025\000\000\216'\332\014\000\000\000\000\237\0345\353"
+ "\335\025\000\000P\356\332\014a#\000\000r\030\245!\000\000\000\0007\036/\366"
+ "\311\341\000\000l)\345\370g\346\000\000\236\134\265\274\302\306\000\000\231"
+ "\031g\355P\332\000\000\203\015\227)1\003\000\000\274\003\2610\013\006\000"
+ "\000a#\341l>9\000\000\231\031\227)\013\006\000\000\311\341\321\011\311\341"
+ "\000\000\134\340\000\000P\332\000\000\204\215\000\000\302\306\000\000P\332"
+ "\231\022g\346\000\000\212(\321\011}\362\000\000(-\231\022\365\371\000\000"
+ "\301F\000\000}\362\000\000}\362\227)\317\374\000\000g\346\227)\365\371\000"
+ "\000#\352KC\203\015\000\000}\362/\366v\327\000\000\365\371g\355\330\322\000"
+ "\000\237\334L\346\302\306\000\000)\005\035\360v\327\000\000\203\015i\326"
+ "\302\306\000\000a#\264\031\317\374\000\000>9\227)\203\015\000\000\371\344"
+ "\305\037}\362\000\000\302\306\227)}\362\000\000a#\000\000#\352\000\000\000"
+ "\000\227)\000\000\000\000#\352\000\000\237\334\000\000\260\021&\363\237\334"
+ "\000\000r\030\245!\000\000\000\000a\343\313\024#\352\000\000)\005\035\360"
+ "v\327\000\000\365\371g\355\330\322\000\000\000\000\000\000\001\200\000\000"
+ "\322\017\201\364\330\322\000\000#\352{\334\203\015\000\000r\354\315\332\231"
+ "\031\000\000b\243\265\274>9\000\000\134\340\315\332\013\006\000\000\221&"
+ "\035\360\203\015\000\000w/\201\364\013\006\000\000|r\000\000>9\000\000\260"
+ "%g\355\231\031\000\000S\355L\346\311\341\000\000\252\342\350\341g\346\000"
+ "\000\237\334L\346\302\306\000\000\000\000;\3407\036\000\000\307\011\350\341"
+ "\260%\000\000}\362i\326>9\000\000\212(/\366}\362\000\000l)\345\370g\346\000"
+ "\000\301F\000\000}\362\000\0007\036/\366\311\341\000\000\273+\000\000\302"
+ "\306\000\000\371\344;\340}\362\000\000\302\306i\326}\362\000\000\255\022"
+ "L\3467\036\000\000a#L\346>9\000\000>\3715\353\237\334\000\000\021\365[\336"
+ "\335\025\000\000\216'&\363\000\000\000\000\260\021&\363\237\334\000\000\216"
+ "\347[\336\000\000\000\000\237\0345\353\335\025\000\000\371\344\305\037}\362"
+ "\000\000g\346\227)\365\371\000\000\237\334\341l\302\306\000\000\252\342\030"
+ "\036g\346\000\000L\357\000\000\212(\000\000.\360\201\364(-\000\000\000\000"
+ "\000\000\377\177\000\000.\360\177\013(-\000\000\371\344;\340}\362\000\000"
+ "\252\342\350\341g\346\000\000\237\334\037\223\302\306\000\000g\346i\326\365"
+ "\371\000\000#\352\205#\203\015\000\000r\3543%\231\031\000\000#\352KC\203"
+ "\015\000\000S\355L\3467\036\000\000r\354\315\332\231\031\000\000}\362i\326"
+ ">9\000\000\311\341/\366\311\341\000\000\134\340\000\000P\332\000\000\237"
+ "\334L\346\302\306\000\000\311\341\321\011\311\341\000\000\237\334\264\031"
+ "\302\306\000\000S\355\264\0317\036\000\000}\362\227)>9\000\000#\352{\334"
+ "\203\015\000\000#\352\265\274\203\015\000\000\216\347\245!\000\000\000\000"
+ "P\356&\363a#\000\000a\3435\353#\352\000\000a\343\313\024#\352\000\000P\356"
+ "\332\014a#\000\000\216\347[\336\000\000\000\000\000\000;\340\311\341\000"
+ "\000\013\006i\326g\346\000\000\237\334\037\223\302\306\000\0009\366\350\341"
+ "P\332\000\000\000\000;\340\311\341\000\000\237\334\037\223\302\306\000\000"
+ "\273+\000\0001\003\000\000w/\177\013\013\006\000\000|r\000\000>9\000\000"
+ "w/\201\364\013\006\000\000\273+\000\0001\003\000\000|r\000\000>9\000\000"
+ "\000\000\305\037\311\341\000\0009\366\030\036P\332\000\000\237\334\341l\302"
+ "\306\000\000\013\006\227)g\346\000\000\335\025{\334}\362\000\000\244\037"
+ "\315\332\365\371\000\000\335\025\265\274}\362\000\000a#\264\031\317\374\000"
+ "\000\244\0373%\365\371\000\000>9\227)\203\015\000\000}\362\321\011v\327\000"
+ "\000r\354\000\000\330\322\000\000\237\334\264\031\302\306\000\000r\354\000"
+ "\000\330\322\000\000}\362/\366v\327\000\000\237\334L\346\302\306\000\000"
+ "\244\037\315\332\365\371\000\000a#L\346\317\374\000\000>9i\326\203\015\000"
+ "\000\335\025\205#}\362\000\000\335\025KC}\362\000\000\357\012[\336#\352\000"
+ "\000w/\177\013\013\006\000\000\216'\332\014\000\000\000\0009\366\030\036"
+ "P\332\000\000>\371\313\024\237\334\000\000\237\334\264\031\302\306\000\000"
+ ">\3715\353\237\334\000\0009\366\350\341P\332\000\000\237\334L\346\302\306"
+ "\000\000\216'&\363\000\000\000\000w/\201\364\013\006\000\000\357\012\245"
+ "!#\352\000\000S\355L\3467\036\000\000g\346g\355\260%\000\000b\243\265\274"
+ ">9\000\000r\354\315\332\231\031\000\000\255\022\264\0317\036\000\000V\035"
+ "\030\036\231\031\000\000a#\341l>9\000\000\307\011\030\036\260%\000\000a#"
+ "L\346\317\374\000\000\244\037\315\332\365\371\000\000\236\134\265\274\302"
+ "\306\000\000(-g\355\365\371\000\000L\357\000\000\212(\000\000.\360\177\013"
+ "(-\000\000E\324\000\000>9\000\000\221&\343\017\203\015\000\000w/\177\013"
+ "\013\006\000\000>9\227)\203\015\000\000\203\015i\3261\003\000\000\274\003"
+ "O\317\013\006\000\000\335\025\265\274}\362\000\000\317\374i\326\203\015\000"
+ "\000#\352\265\274\203\015\000\000\327\372\343\017\212(\000\000}\362\227)"
+ ">9\000\000\273+\000\0001\003\000\000\301F\000\000}\362\000\000P\356&\363"
+ "a#\000\000\237\034\313\024\335\025\000\000r\030[\336\000\000\000\000\021"
+ "\365[\336\335\025\000\000\302\006\313\024a#\000\000\216'&\363\000\000\000"
+ "\000}\362/\366v\327\000\000r\354\000\000\330\322\000\000\000\000\000\000"
+ "\001\200\000\000\365\371g\355\330\322\000\000v\327\321\011\203\015\000\000"
+ "\224\326\033\007\231\031\000\000b\243KC>9\000\000\330\322\231\022\013\006"
+ "\000\000\317\374i\326\203\015\000\000\274\003O\317\013\006\000\000a#\037"
+ "\223>9\000\000\365\371i\326\231\031\000\000\311\341\321\011\311\341\000\000"
+ "P\332\231\022g\346\000\000\237\334\264\031\302\306\000\000\311\341/\3667"
+ "\036\000\000g\346g\355\260%\000\000E\324\000\000>9\000\0001\003i\326}\362"
+ "\000\000\013\006i\326g\346\000\000\335\025\265\274}\362\000\000\000\000;"
+ "\340\311\341\000\000\203\015i\326\302\306\000\000o\331\343\017}\362\000\000"
+ "\302\306\227)}\362\000\000S\355L\3467\036\000\000}\362i\326>9\000\000#\352"
+ "\000\000\237\334\000\000\237\334\000\000\335\025\000\000\000\000i\326\000"
+ "\000\000\000>\3715\353\237\334\000\000r\330\332\014\000\000\000\000\021\365"
+ "[\336\335\025\000\000\335\025\205#}\362\000\000\244\0373%\365\371\000\000"
+ "\236\134KC\302\306\000\000\216\0233%g\346\000\000\327\372\343\017\212(\000"
+ "\000.\360\177\013(-\000\000\000\000\000\000\377\177\000\000\013\006\231\022"
+ "(-\000\000o\331\343\017}\362\000\000P\332\231\022g\346\000\000\204\215\000"
+ "\000\302\306\000\000\211\320\177\013\365\371\000\000\007\033\305\037\203"
+ "\015\000\000V\035\030\036\231\031\000\000>9\227)\203\015\000\000\311\341"
+ "\321\0117\036\000\000\224\326\033\007\231\031\000\000E\324\000\000>9\000"
+ "\000S\355\264\031\311\341\000\0009\366\030\036P\332\000\000\237\334\264\031"
+ "\302\306\000\000\000\000\305\037\311\341\000\000\203\015\227)\302\306\000"
+ "\000\255\022\264\0317\036\000\000a#\264\031>9\000\000v\327\321\011\203\015"
+ "\000\000\077\271\000\000\203\015\000\000r\030\245!\000\000\000\000P\356\332"
+ "\014a#\000\000a\343\313\024#\352\000\000\357\012\245!#\352\000\000\302\006"
+ "\313\024a#\000\000r\330\332\014\000\000\000\000\235\247\235\247\235\247\235"
+ "\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235"
+ "\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235"
+ "\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235\247\235"
+ "\247\235\247\235\247\311\000\311\000\311\000\311\000\311\000\311\000\311"
+ "\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000\311"
+ "\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000\311"
+ "\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000\311\000,d,d"
+ ",d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,d,dA\321A\321"
+ "A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321"
+ "A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321A\321"
+ "A\321\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361"
+ "/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361/\361"
+ "/\361/\361/\361/\361/\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235"
+ "Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\235"
+ "Y\235Y\235Y\235Y\235Y\235Y\235Y\235Y\177\024\177\024\177\024\177\354\177"
+ "\354\177\354\177\354\177\354\177\354\177\024\177\024\177\024\177\354\177"
+ "\354\177\354\177\024\177\024\177\024\177\354\177\354\177\354\177\024\177"
+ "\024\177\024\177\024\177\024\177\024\177\024\177\024\177\024\177\024\177"
+ "\024\177\354\177\354\177\354\177\354\177\354\177\354\177\354\177\024\177"
+ "\024\177\024\177\024\177\354\177\354\177\354\177\024\177\024\345\255\345"
+ "\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345"
+ "\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345"
+ "\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345\255\345"
+ "\255\345\255\345\255\345\255\345\255P\220P\220P\220P\220P\220P\220P\220P"
+ "\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220"
+ "P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220P\220\361\321\361\321\361"
+ "\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361"
+ "\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361"
+ "\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361\321\361"
+ "\321\361\321\361\321\361\321A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/A/"
+ "A/A/A/A/A/A/A/A/A/A/A/\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>"
+ "\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>\260>\260"
+ ">\260>\260>\260>\260>\260>\260>\260>\260>&\034&\034&\034&\034&\034&\034&"
+ "\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034"
+ "&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034&\034PpPpPpPpPpPp"
+ "PpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPpPp,\234,\234,\234,\234"
+ ",\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234"
+ ",\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234,\234\225"
+ "\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225"
+ "\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225"
+ "\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225\000\225"
+ "\000\225\000\225\000\225\000\225\000\225\000\177H\177H\177H\177\270\177\270"
+ "\177\270\177\270\177\270\177\270\177H\177H\177H\177H\177H\177H\177H\177H"
+ "\177H\177H\177H\177H\177H\177H\177H\177H\177\270\177\270\177\270\177\270"
+ "\177\270\177\270\177H\177H\177H\177H\177H\177\270\177\270\177\270\177H\177"
+ "H\177H\177\270\177\270\177H&\344&\344&\344&\344&\344&\344&\344&\344&\344"
+ "&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344&\344"
+ "&\344&\344&\344&\344&\344&\344&\344&\344&\344\260\302\260\302\260\302\260"
+ "\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260"
+ "\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260"
+ "\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260\302\260"
+ "\302\260\302\260\302\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345"
+ "S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345S\345"
+ "S\345S\345S\345S\345S\345S\345S\345S\000\000\000\000\001\000\002\000\003"
+ "\000\000\000\002\000\004\000\005\000\006\000\007\000\004\000\006\000\010"
+ "\000\011\000\012\000\013\000\010\000\012\000\014\000\015\000\016\000\017"
+ "\000\020\000\021\000\022\000\023\000\024\000\023\000\025\000\026\000\015"
+ "\000\027\000\030\000\020\000\031\000\032\000\001\000\033\000\016\000\005"
+ "\000\034\000\021\000\011\000\035\000\024\000\036\000\003\000\026\000\037"
+ "\000\007\000\030\000 \000\013\000\032\000!\000\042\000#\000$\000!\000#\000"
+ "%\000&\000'\000(\000%\000'\000)\000*\000+\000,\000)\000+\000-\000.\000/\000"
+ "0\0001\0002\0003\0004\0005\0004\0006\0007\000.\0008\0009\0001\000:\000;\000"
+ "\042\000<\000/\000&\000=\0002\000*\000>\0005\000\077\000$\0007\000@\000("
+ "\0009\000A\000,\000;\000B\000C\000D\000E\000B\000D\000F\000G\000H\000I\000"
+ "F\000H\000J\000K\000L\000M\000J\000L\000N\000O\000P\000Q\000R\000S\000T\000"
+ "U\000V\000U\000W\000X\000O\000Y\000Z\000R\000[\000\134\000C\000]\000P\000"
+ "G\000^\000S\000K\000_\000V\000`\000E\000X\000a\000I\000Z\000b\000M\000\134"
+ "\000c\000d\000e\000f\000c\000e\000g\000h\000i\000j\000g\000i\000k\000l\000"
+ "m\000n\000k\000m\000o\000p\000q\000r\000s\000t\000u\000v\000w\000v\000x\000"
+ "y\000p\000z\000{\000s\000|\000}\000d\000~\000q\000h\000\177\000t\000l\000"
+ "\200\000w\000\201\000f\000y\000\202\000j\000{\000\203\000n\000}\000\204\000"
+ "\205\000\206\000\207\000\204\000\206\000\210\000\211\000\212\000\213\000"
+ "\210\000\212\000\214\000\215\000\216\000\217\000\214\000\216\000\220\000"
+ "\221\000\222\000\223\000\224\000\225\000\226\000\227\000\230\000\227\000"
+ "\231\000\232\000\221\000\233\000\234\000\224\000\235\000\236\000\205\000"
+ "\237\000\222\000\211\000\240\000\225\000\215\000\241\000\230\000\242\000"
+ "\207\000\232\000\243\000\213\000\234\000\244\000\217\000\236\000\245\000"
+ "\246\000\247\000\250\000\245\000\247\000\251\000\252\000\253\000\254\000"
+ "\251\000\253\000\255\000\256\000\257\000\260\000\255\000\257\000\261\000"
+ "\262\000\263\000\264\000\265\000\266\000\267\000\270\000\271\000\270\000"
+ "\272\000\273\000\262\000\274\000\275\000\265\000\276\000\277\000\246\000"
+ "\300\000\263\000\252\000\301\000\266\000\256\000\302\000\271\000\303\000"
+ "\250\000\273\000\304\000\254\000\275\000\305\000\260\000\277\000\306\000"
+ "\307\000\310\000\311\000\312\000\313\000\314\000\315\000\316\000\317\000"
+ "\320\000\321\000\322\000\323\000\324\000\325\000\326\000\327\000\330\000"
+ "\331\000\332\000\333\000\334\000\335\000\336\000\337\000\340\000\337\000"
+ "\341\000\342\000\343\000\344\000\345\000\346\000\347\000\350\000\351\000"
+ "\352\000\332\000\315\000\353\000\354\000\355\000\356\000\340\000\357\000"
+ "\360\000\342\000\361\000\362\000\363\000\364\000\325\000\365\000\366\000"
+ "\367\000\370\000\371\000\366\000\370\000\372\000\373\000\374\000\375\000"
+ "\372\000\374\000\376\000\377\000\000\001\001\001\376\000\000\001\002\001"
+ "\003\001\004\001\005\001\006\001\007\001\010\001\011\001\012\001\011\001"
+ "\013\001\014\001\003\001\015\001\016\001\006\001\017\001\020\001\367\000"
+ "\021\001\004\001\373\000\022\001\007\001\377\000\023\001\012\001\024\001"
+ "\371\000\014\001\025\001\375\000\016\001\026\001\001\001\020\001\027\001"
+ "\030\001\031\001\032\001\027\001\031\001\033\001\034\001\035\001\036\001"
+ "\033\001\035\001\037\001 \001!\001\042\001\037\001!\001#\001$\001%\001&\001"
+ "'\001(\001)\001*\001+\001*\001,\001-\001$\001.\001/\001'\0010\0011\001\030"
+ "\0012\001%\001\034\0013\001(\001 \0014\001+\0015\001\032\001-\0016\001\036"
+ "\001/\0017\001\042\0011\0018\0019\001:\001;\0018\001:\001<\001=\001>\001"
+ "\077\001<\001>\001@\001A\001B\001C\001@\001B\001D\001E\001F\001G\001H\001"
+ "I\001J\001K\001L\001K\001M\001N\001E\001O\001P\001H\001Q\001R\0019\001S\001"
+ "F\001=\001T\001I\001A\001U\001L\001V\001;\001N\001W\001\077\001P\001X\001"
+ "C\001R\001Y\001Z\001[\001\134\001Y\001[\001]\001^\001_\001`\001]\001_\001"
+ "a\001b\001c\001d\001a\001c\001e\001f\001g\001h\001i\001j\001k\001l\001m\001"
+ "l\001n\001o\001f\001p\001q\001i\001r\001s\001Z\001t\001g\001^\001u\001j\001"
+ "b\001v\001m\001w\001\134\001o\001x\001`\001q\001y\001d\001s\001z\001{\001"
+ "|\001}\001z\001|\001~\001\177\001\200\001\201\001~\001\200\001\202\001\203"
+ "\001\204\001\205\001\202\001\204\001\206\001\207\001\210\001\211\001\212"
+ "\001\213\001\214\001\215\001\216\001\215\001\217\001\220\001\207\001\221"
+ "\001\222\001\212\001\223\001\224\001{\001\225\001\210\001\177\001\226\001"
+ "\213\001\203\001\227\001\216\001\230\001}\001\220\001\231\001\201\001\222"
+ "\001\232\001\205\001\224\001\233\001\234\001\235\001\236\001\233\001\235"
+ "\001\237\001\240\001\241\001\242\001\237\001\241\001\243\001\244\001\245"
+ "\001\246\001\243\001\245\001\247\001\250\001\251\001\252\001\253\001\254"
+ "\001\255\001\256\001\257\001\256\001\260\001\261\001\250\001\262\001\263"
+ "\001\253\001\264\001\265\001\234\001\266\001\251\001\240\001\267\001\254"
+ "\001\244\001\270\001\257\001\271\001\236\001\261\001\272\001\242\001\263"
+ "\001\273\001\246\001\265\001\274\001\275\001\276\001\277\001\274\001\276"
+ "\001\300\001\301\001\302\001\303\001\300\001\302\001\304\001\305\001\306"
+ "\001\307\001\304\001\306\001\310\001\311\001\312\001\313\001\314\001\315"
+ "\001\316\001\317\001\320\001\317\001\321\001\322\001\311\001\323\001\324"
+ "\001\314\001\325\001\326\001\275\001\327\001\312\001\301\001\330\001\315"
+ "\001\305\001\331\001\320\001\332\001\277\001\322\001\333\001\303\001\324"
+ "\001\334\001\307\001\326\001\335\001\336\001\337\001\340\001\335\001\337"
+ "\001\341\001\342\001\343\001\344\001\341\001\343\001\345\001\346\001\347"
+ "\001\350\001\345\001\347\001\351\001\352\001\353\001\354\001\355\001\356"
+ "\001\357\001\360\001\361\001\360\001\362\001\363\001\352\001\364\001\365"
+ "\001\355\001\366\001\367\001\336\001\370\001\353\001\342\001\371\001\356"
+ "\001\346\001\372\001\361\001\373\001\340\001\363\001\374\001\344\001\365"
+ "\001\375\001\350\001\367\001\376\001\377\001\000\002\001\002\376\001\000"
+ "\002\002\002\003\002\004\002\005\002\002\002\004\002\006\002\007\002\010"
+ "\002\011\002\006\002\010\002\012\002\013\002\014\002\015\002\016\002\017"
+ "\002\020\002\021\002\022\002\021\002\023\002\024\002\013\002\025\002\026"
+ "\002\016\002\027\002\030\002\377\001\031\002\014\002\003\002\032\002\017"
+ "\002\007\002\033\002\022\002\034\002\001\002\024\002\035\002\005\002\026"
+ "\002\036\002\011\002\030\002\037\002 \002!\002\042\002#\002$\002%\002&\002"
+ "'\002(\002)\002*\002+\002,\002-\002.\002+\002-\002/\0020\0021\0022\0023\002"
+ "4\0025\0026\0027\0028\0029\002:\002;\002<\002=\0023\002>\002\077\002 \002"
+ "@\0021\002A\002B\0024\002C\002D\002E\002F\002G\002H\002I\002J\002=\002K\002"
+ ".\002\077\002L\002M\002N\002O\002L\002N\002P\002Q\002R\002S\002P\002R\002"
+ "T\002U\002V\002W\002T\002V\002X\002Y\002Z\002[\002\134\002]\002^\002_\002"
+ "`\002_\002a\002b\002Y\002c\002d\002\134\002e\002f\002M\002g\002Z\002Q\002"
+ "h\002]\002U\002i\002`\002j\002O\002b\002k\002S\002d\002l\002W\002f\002m\002"
+ "n\002o\002p\002m\002o\002q\002r\002s\002t\002q\002s\002u\002v\002w\002x\002"
+ "u\002w\002y\002z\002{\002|\002}\002~\002\177\002\200\002\201\002\200\002"
+ "\202\002\203\002z\002\204\002\205\002}\002\206\002\207\002n\002\210\002{"
+ "\002r\002\211\002~\002v\002\212\002\201\002\213\002p\002\203\002\214\002"
+ "t\002\205\002\215\002x\002\207\002\216\002\217\002\220\002\221\002\216\002"
+ "\220\002\222\002\223\002\224\002\225\002\222\002\224\002\226\002\227\002"
+ "\230\002\231\002\226\002\230\002\232\002\233\002\234\002\235\002\236\002"
+ "\237\002\240\002\241\002\242\002\241\002\243\002\244\002\233\002\245\002"
+ "\246\002\236\002\247\002\250\002\217\002\251\002\234\002\223\002\252\002"
+ "\237\002\227\002\253\002\242\002\254\002\221\002\244\002\255\002\225\002"
+ "\246\002\256\002\231\002\250\002\000\000\001\000\001\000\002\000\000\000"
+ "\002\000\000\000\003\000\002\000\003\000\004\000\005\000\005\000\006\000"
+ "\004\000\006\000\004\000\007\000\006\000\007\000\010\000\011\000\011\000"
+ "\012\000\010\000\012\000\010\000\013\000\012\000\013\000\014\000\015\000"
+ "\015\000\016\000\014\000\016\000\017\000\020\000\020\000\021\000\017\000"
+ "\021\000\022\000\023\000\023\000\024\000\022\000\024\000\023\000\025\000"
+ "\025\000\026\000\023\000\026\000\015\000\027\000\027\000\030\000\015\000"
+ "\030\000\020\000\031\000\031\000\032\000\020\000\032\000\001\000\033\000"
+ "\016\000\033\000\001\000\016\000\005\000\034\000\021\000\034\000\005\000"
+ "\021\000\011\000\035\000\024\000\035\000\011\000\024\000\003\000\036\000"
+ "\003\000\026\000\026\000\036\000\007\000\037\000\007\000\030\000\030\000"
+ "\037\000\013\000 \000\013\000\032\000\032\000 \000!\000\042\000\042\000#"
+ "\000!\000#\000!\000$\000#\000$\000%\000&\000&\000'\000%\000'\000%\000(\000"
+ "'\000(\000\015\000+\000\027\000+\000\027\000,\000+\000,\000-\000.\000.\000"
+ "/\000-\000/\000\005\0000\000\021\0000\0003\0004\000\016\0004\000\016\000"
+ "3\0004\0006\0006\0007\0004\0007\000.\0008\0008\0009\000.\0009\000\004\000"
+ ";\000\005\000;\000\042\000<\000/\000<\000\042\000/\000&\000=\000\021\000"
+ "=\000\021\000&\000\015\000>\000\016\000>\000$\000\077\000$\0007\0007\000"
+ "\077\000(\000@\000(\0009\0009\000@\000\037\000,\000,\000;\000\037\000;\000"
+ "\023\000D\000\025\000D\000\025\000E\000D\000E\000F\000G\000G\000H\000F\000"
+ "H\000F\000I\000H\000I\0004\000L\0006\000L\0006\000M\000L\000M\000N\000O\000"
+ "\024\000O\000\024\000N\000\042\000Q\000/\000Q\000\001\000T\000\016\000T\000"
+ "\000\000X\000\001\000X\000O\000Y\000Y\000Z\000O\000Z\000!\000\134\000\042"
+ "\000\134\000\023\000]\000\024\000]\000G\000^\000/\000^\000/\000G\0004\000"
+ "_\000\016\000_\000\036\000E\000E\000X\000\036\000X\000I\000a\000I\000Z\000"
+ "Z\000a\000\077\000M\000M\000\134\000\077\000\134\000\020\000e\000\031\000"
+ "e\000\031\000f\000e\000f\000.\000i\0008\000i\0008\000j\000i\000j\000O\000"
+ "m\000Y\000m\000Y\000n\000m\000n\000&\000o\000\021\000o\000G\000r\000/\000"
+ "r\000\011\000u\000\024\000u\000\010\000y\000\011\000y\000%\000{\000&\000"
+ "{\000F\000}\000G\000}\000\020\000~\000\021\000~\000.\000\177\000/\000\177"
+ "\000O\000\200\000\024\000\200\000 \000f\000f\000y\000 \000y\000@\000j\000"
+ "j\000{\000@\000{\000a\000n\000n\000}\000a\000}\000r\000\205\000H\000\205"
+ "\000H\000r\000\210\000\211\000\006\000\211\000\006\000\210\000\210\000\213"
+ "\000\006\000\213\000\214\000\215\000\002\000\215\000\002\000\214\000\214"
+ "\000\217\000\002\000\217\0009\000j\000\223\000\224\000\030\000\224\000\030"
+ "\000\223\000\226\000\227\000\227\000\230\000\226\000\230\000\227\000\231"
+ "\000}\000\231\000}\000\227\000j\000\233\000{\000\233\0003\000\224\000\016"
+ "\000\224\000\177\000\205\0009\000\177\0009\000\205\000\211\000\240\000\030"
+ "\000\240\000\030\000\211\000\215\000\241\000\230\000\241\000\215\000\230"
+ "\000^\000}\000\213\000\243\000{\000\213\000{\000\243\000_\000\217\000\016"
+ "\000\217\000\245\000\246\000m\000\246\000m\000\245\000\245\000\250\000m\000"
+ "\250\000L\000\224\0003\000L\000\255\000\256\000e\000\256\000e\000\255\000"
+ "\255\000\260\000e\000\260\000\215\000\261\000\230\000\261\000\030\000,\000"
+ "\267\000\270\000y\000\270\000y\000\267\000\022\000\270\000\024\000\270\000"
+ "7\000\214\0007\000\215\000,\000\276\000;\000\276\000\246\000\300\000\230"
+ "\000\300\000\230\000\246\000>\000\224\000\030\000>\000\256\000\302\000y\000"
+ "\302\000y\000\256\000]\000\250\000\024\000\250\0007\000_\000\260\000\305"
+ "\000;\000\260\000;\000\305\000D\000\270\000\022\000D\000\314\000\315\000"
+ "'\000\315\000'\000\314\000\314\000\317\000'\000\317\000#\000\227\000#\000"
+ "\231\000\231\000\325\000#\000\325\000\013\000y\000\205\000\333\0009\000\333"
+ "\000\246\000\336\000\230\000\336\000\026\000\245\000\026\000\246\000\013"
+ "\000\344\000\032\000\344\000/\000\205\000\035\000\270\000\035\000y\000\315"
+ "\000\353\0009\000\353\0009\000\315\000\227\000\356\000\230\000\356\000\026"
+ "\000]\000\317\000\361\000\032\000\317\000\032\000\361\000^\000\325\000/\000"
+ "\325\000+\000\276\000\276\000\371\000+\000\371\000i\000\233\000\233\000\375"
+ "\000i\000\375\000\012\000\344\000\344\000\001\001\012\000\001\001\211\000"
+ "\002\001\030\000\002\001\315\000\005\0019\000\005\001\256\000\010\001y\000"
+ "\010\001\255\000\014\001\256\000\014\001\210\000\016\001\211\000\016\001"
+ "\314\000\020\001\315\000\020\001\305\000\371\000\371\000\014\001\305\000"
+ "\014\001\243\000\375\000\375\000\016\001\243\000\016\001\361\000\001\001"
+ "\001\001\020\001\361\000\020\001\371\000\027\001+\000\027\001\027\001\032"
+ "\001+\000\032\001\317\000\033\001'\000\033\001\033\001\036\001'\000\036\001"
+ "N\000\250\000N\000m\000#\001$\001;\000$\001;\000#\001&\001'\001\020\001'"
+ "\001\020\001&\001\026\000E\000E\000,\001X\000,\001\017\000$\001\021\000$"
+ "\001'\0010\001Z\0000\001Z\000'\001;\000\371\000\317\000\020\001\026\000\250"
+ "\000\032\0015\001X\000\032\001X\0005\001~\000\036\001\021\000\036\001Z\000"
+ "\200\0008\0019\001L\0009\001L\0008\0018\001;\001L\000;\001\333\000=\001H"
+ "\000=\001H\000\333\000e\000$\001\017\000e\000D\001E\001\134\000E\001\134"
+ "\000D\001\007\000;\000\007\000\002\001-\000E\001/\000E\001\032\000\033\001"
+ "9\001S\001\134\000S\001\134\0009\001\353\000=\001\353\000\020\001\020\001"
+ "=\001\034\000$\001\034\000;\000\240\000;\001\030\000;\001\032\000~\000\012"
+ "\000'\001\012\0000\0010\001\134\001\012\000\134\001i\000E\001-\000i\000\261"
+ "\000b\001\002\000b\001\002\000\261\000=\001e\001\020\001e\001$\000\134\000"
+ "9\000=\001$\000r\0017\000r\001'\001t\001\020\001t\001<\000E\001<\000\134"
+ "\000\300\000b\001\026\000\300\000\026\000b\001\200\000\134\001\024\000\134"
+ "\0017\000\241\000D\000,\001,\001}\001D\000}\001#\000r\001r\001\201\001#\000"
+ "\201\001\006\000\002\001b\001\206\001\026\000\206\0019\001\211\001\134\000"
+ "\211\001\014\001\027\001\230\000b\001\016\0018\001\016\0019\0015\001}\001"
+ "\014\001}\001\014\0015\001\241\000\201\001\230\000\201\001\240\000\016\001"
+ "(\000\005\001'\000\005\001M\000\211\001L\000\211\001n\000\243\001m\000\243"
+ "\001\243\001\246\001m\000\246\001{\000\375\0007\000\201\001\255\001\256\001"
+ "Z\000\256\001Z\000\255\001e\001\256\001\020\001\256\001\375\000\262\001\016"
+ "\001\262\001\226\000\201\001(\000{\0007\000M\000Z\000n\000\016\001S\001\356"
+ "\000\246\001\230\000\246\001u\000\134\001\012\000u\000#\000\226\000\032\001"
+ "\304\001+\000\304\001\304\001\307\001+\000\307\0017\000\217\000\316\001\317"
+ "\001\014\001\317\001\014\001\316\001\267\000\317\001y\000\317\001}\000\243"
+ "\001T\000\217\000Z\000\134\001\014\001\032\001}\000\356\000\033\000\307\001"
+ "\016\000\307\001D\000\317\001D\000\267\0000\000\342\001\006\000\342\001\006"
+ "\0000\000H\000\256\001H\000e\001\260\000\014\001\260\000#\001\302\000\317"
+ "\001\302\000\014\001=\000\342\001=\000{\000{\000\342\001t\001\256\001Z\000"
+ "t\001\002\000T\000i\000\262\001\262\001\005\002i\000\005\002e\000#\001\342"
+ "\001\015\002{\000\015\002X\000\304\001\021\000\342\001\033\000X\000S\001"
+ "\005\002\134\000\005\002f\000\010\001e\000\010\001I\000\255\001H\000\255"
+ "\001\003\000\206\001\002\000\206\001\032\000\001\001}\000\246\001X\000}\001"
+ "}\001\316\001\001\001&\001\336\000\246\001\032\000f\000I\000}\000\003\000"
+ "X\000\213\000\015\002\006\000\015\002Q\000\325\000#\000Q\000\012\000&\001"
+ "\016\001\005\002\032\000\036\001o\000\036\001D\001\005\002\213\000\016\001"
+ "}\000\325\000D\000\316\001\223\000;\001L\000\223\000'\000o\000X\000\307\001"
+ "\014\000\307\001\016\001;\001m\000\336\000i\000D\001\014\000+\000"
+;
+const unsigned long tronbit_no_size = 11272;
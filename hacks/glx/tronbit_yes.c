@@ -1,31 +1,35 @@
-/* yes = tetrahedron */
+/* Generated from "tronbit_yes.c" on 18-Oct-2026.
+   Binary mesh container; see gllist.h.
+   Re-packed from its float arrays.
+ */
 
 #include "gllist.h"
-static const float data[]={
-	0.57735,0.57735,0.57735,0,0,0.5,
-	0.57735,0.57735,0.57735,0.5,0,0,
-	0.57735,0.57735,0.57735,0,0.5,0,
-	-0.57735,0.57735,0.57735,0,0,0.5,
-	-0.57735,0.57735,0.57735,0,0.5,0,
-	-0.57735,0.57735,0.57735,-0.5,0,0,
-	-0.57735,-0.57735,0.57735,0,0,0.5,
-	-0.57735,-0.57735,0.57735,-0.5,0,0,
-	-0.57735,-0.57735,0.57735,0,-0.5,0,
-	0.57735,-0.57735,0.57735,0,0,0.5,
-	0.57735,-0.57735,0.57735,0,-0.5,0,
-	0.57735,-0.57735,0.57735,0.5,0,0,
-	0.57735,-0.57735,-0.57735,0.5,0,0,
-	0.57735,-0.57735,-0.57735,0,-0.5,0,
-	0.57735,-0.57735,-0.57735,0,0,-0.5,
-	0.57735,0.57735,-0.57735,0.5,0,0,
-	0.57735,0.57735,-0.57735,0,0,-0.5,
-	0.57735,0.57735,-0.57735,0,0.5,0,
-	-0.57735,0.57735,-0.57735,0,0.5,0,
-	-0.57735,0.57735,-0.57735,0,0,-0.5,
-	-0.57735,0.57735,-0.57735,-0.5,0,0,
-	-0.57735,-0.57735,-0.57735,-0.5,0,0,
-	-0.57735,-0.57735,-0.57735,0,0,-0.5,
-	-0.57735,-0.57735,-0.57735,0,-0.5,0
-};
-static const struct gllist frame={GL_N3F_V3F,GL_TRIANGLES,24,data,NULL};
-const struct gllist *tronbit_yes=&frame;
+
+#ifdef __GNUC__
+__extension__
+#endif
+const unsigned char tronbit_yes[] =
+ "XSGLMSH1\001\000\000\000\000\000\000\000all\000\000\000\000\000\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000P\000"
+ "\000\000\004\000\000\000\030\000\000\000\030\000\000\000\014\000\000\000"
+ "\000\000\000\000\000\000\000\000\000\000\000\000\000\001\2007\000\000\000"
+ "\000\377\177\000\000\377\177\000\000\000\000\000\000\000\000\377\177\000"
+ "\000\000\000\000\000\000\000\377\177\000\000\000\000\377\177\000\000\000"
+ "\000\001\200\000\000\000\000\000\000\000\000\000\000\377\177\000\000\001"
+ "\200\000\000\000\000\000\000\000\000\001\200\000\000\000\000\000\000\000"
+ "\000\377\177\000\000\000\000\001\200\000\000\000\000\377\177\000\000\000"
+ "\000\000\000\377\177\000\000\000\000\000\000\000\000\001\200\000\000\000"
+ "\000\000\000\000\000\001\200\000\000\377\177\000\000\000\000\000\000\000"
+ "\000\000\000\001\200\000\000\000\000\377\177\000\000\000\000\000\000\377"
+ "\177\000\000\000\000\000\000\000\000\001\200\000\000\001\200\000\000\000"
+ "\000\000\000\001\200\000\000\000\000\000\000\000\000\000\000\001\200\000"
+ "\000\000\000\001\200\000\000\000\000******\326*\326*\326*\326\326\326\326"
+ "\326\326*\326*\326*\326U\253U\253U\253UUUUUU\253U\253U\253U\253\253\253\253"
+ "\253\253\000\000\001\000\002\000\003\000\004\000\005\000\006\000\007\000"
+ "\010\000\011\000\012\000\013\000\014\000\015\000\016\000\017\000\020\000"
+ "\021\000\022\000\023\000\024\000\025\000\026\000\027\000\000\000\001\000"
+ "\001\000\002\000\000\000\002\000\002\000\005\000\000\000\005\000\005\000"
+ "\010\000\000\000\010\000\001\000\010\000\010\000\016\000\001\000\016\000"
+ "\002\000\016\000\005\000\016\000"
+;
+const unsigned long tronbit_yes_size = 416;
@@ -47,13 +47,22 @@
 
 #include "gllist.h"
 
-extern const struct gllist
+/* A binary mesh container, see "seccam_dxf" in Makefile.in. */
+extern const unsigned char seccam[];
+extern const unsigned long seccam_size;
+
+/* Loaded from seccam on first use. */
+static const struct gllist
   *seccam_body, *seccam_cap, *seccam_hinge, *seccam_pipe, *seccam_lens;
 static struct gllist *ground = 0;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "body", "cap", "hinge", "pipe", "lens",
+};
+
+static const struct gllist **all_objs[] = {
   &seccam_body, &seccam_cap, &seccam_hinge, &seccam_pipe, &seccam_lens,
-  (const struct gllist * const *) &ground
+  (const struct gllist **) &ground
 };
 
 #define CAMERA_BODY	0
@@ -255,6 +264,18 @@ init_camera (ModeInfo *mi)
 
   bp->user_trackball = gltrackball_init (False);
 
+  for (i = 0; i < countof(all_layers); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (seccam, seccam_size, all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
@@ -102,20 +102,34 @@
 
 #include "gllist.h"
 
-extern const struct gllist
+/* A binary mesh container, see "winduprobot_dxf" in Makefile.in. */
+extern const unsigned char robot[];
+extern const unsigned long robot_size;
+
+extern const unsigned char robot_wireframe[];
+extern const unsigned long robot_wireframe_size;
+
+/* Loaded from robot and robot_wireframe on first use. */
+static const struct gllist
   *robot_arm_half, *robot_body_half_outside, *robot_body_half_inside,
   *robot_crank_full, *robot_gearbox_half, *robot_hand_half,
-  *robot_leg_half, *robot_rotator_half, *robot_wireframe;
+  *robot_leg_half, *robot_rotator_half, *robot_wireframe_list;
 
 static struct gllist *robot_dome = 0, *robot_gear = 0, *ground = 0;
 
-static const struct gllist * const *all_objs[] = {
+static const char * const all_layers[] = {
+  "arm_half", "body_half_outside", "body_half_inside",
+  "crank_full", "gearbox_half", "hand_half",
+  "leg_half", "rotator_half",
+};
+
+static const struct gllist **all_objs[] = {
   &robot_arm_half, &robot_body_half_outside, &robot_body_half_inside,
   &robot_crank_full, &robot_gearbox_half, &robot_hand_half,
-  &robot_leg_half, &robot_rotator_half, &robot_wireframe,
-  (const struct gllist * const *) &robot_dome,
-  (const struct gllist * const *) &robot_gear,
-  (const struct gllist * const *) &ground
+  &robot_leg_half, &robot_rotator_half, &robot_wireframe_list,
+  (const struct gllist **) &robot_dome,
+  (const struct gllist **) &robot_gear,
+  (const struct gllist **) &ground
 };
 
 #define ROBOT_ARM	0
@@ -385,31 +399,47 @@ init_robot (ModeInfo *mi)
 
   bp->user_trackball = gltrackball_init (False);
 
+  for (i = 0; i < countof(all_layers); i++)
+    if (! *all_objs[i])
+      {
+        *all_objs[i] = gllist_read_mesh (robot, robot_size, all_layers[i]);
+        if (! *all_objs[i])
+          {
+            fprintf (stderr, "%s: unable to load model \"%s\"\n",
+                     progname, all_layers[i]);
+            exit (1);
+          }
+      }
+
+  if (! robot_wireframe_list)
+    {
+      robot_wireframe_list = gllist_read_mesh (robot_wireframe,
+                                               robot_wireframe_size, "all");
+      if (! robot_wireframe_list)
+        {
+          fprintf (stderr, "%s: unable to load model \"wireframe\"\n",
+                   progname);
+          exit (1);
+        }
+    }
+
   bp->dlists = (GLuint *) calloc (countof(all_objs)+1, sizeof(GLuint));
   for (i = 0; i < countof(all_objs); i++)
     bp->dlists[i] = glGenLists (1);
 
   for (i = 0; i < countof(all_objs); i++)
     {
-      const struct gllist *gll = *all_objs[i];
       char *key = 0;
       GLfloat spec1[4] = {1.00, 1.00, 1.00, 1.0};
       GLfloat spec2[4] = {0.40, 0.40, 0.70, 1.0};
       GLfloat *spec = 0;
       GLfloat shiny = 20;
 
+      /* The models are not compiled in: render_component draws them, so
+         that they come from buffer objects.  The list just holds their
+         material, and the geometry of the procedural components. */
       glNewList (bp->dlists[i], GL_COMPILE);
 
-      glMatrixMode(GL_MODELVIEW);
-      glPushMatrix();
-      glMatrixMode(GL_TEXTURE);
-      glPushMatrix();
-      glMatrixMode(GL_MODELVIEW);
-
-      glRotatef (-90, 1, 0, 0);
-      glRotatef (180, 0, 0, 1);
-      glScalef (6, 6, 6);
-
       glBindTexture (GL_TEXTURE_2D, 0);
 
       switch (i) {
@@ -516,20 +546,11 @@ init_robot (ModeInfo *mi)
         break;
       case ROBOT_WIREFRAME:
         glLineWidth (0.3);
-        renderList (gll, True);
         break;
       default:
-        renderList (gll, wire);
-        /* glColor3f (1, 1, 1); renderListNormals (gll, 100, True); */
-        /* glColor3f (1, 1, 0); renderListNormals (gll, 100, False); */
         break;
       }
 
-      glMatrixMode(GL_TEXTURE);
-      glPopMatrix();
-      glMatrixMode(GL_MODELVIEW);
-      glPopMatrix();
-
       glEndList ();
     }
 
@@ -570,13 +591,32 @@ init_robot (ModeInfo *mi)
 }
 
 
+static void
+render_component (ModeInfo *mi, int i)
+{
+  robot_configuration *bp = &bps[MI_SCREEN(mi)];
+  glPushMatrix();
+  glRotatef (-90, 1, 0, 0);
+  glRotatef (180, 0, 0, 1);
+  glScalef (6, 6, 6);
+  glCallList (bp->dlists[i]);
+  if (i <= ROBOT_WIREFRAME)
+    {
+      const struct gllist *gll = *all_objs[i];
+      renderList (gll, i == ROBOT_WIREFRAME || MI_IS_WIREFRAME(mi));
+      /* glColor3f (1, 1, 1); renderListNormals (gll, 100, True); */
+      /* glColor3f (1, 1, 0); renderListNormals (gll, 100, False); */
+    }
+  glPopMatrix();
+}
+
 static int
 draw_component (ModeInfo *mi, int i)
 {
   robot_configuration *bp = &bps[MI_SCREEN(mi)];
   glMaterialfv (GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE,
                 bp->component_colors[i]);
-  glCallList (bp->dlists[i]);
+  render_component (mi, i);
   return (*all_objs[i])->points / 3;
 }
 
@@ -2322,7 +2362,7 @@ draw_robot (ModeInfo *mi)
 
   glPushMatrix();
   glScalef (1/robot_size, 1/robot_size, 1/robot_size);
-  glCallList (bp->dlists[GROUND]);
+  render_component (mi, GROUND);
   glPopMatrix();
 
 # ifdef WORDBUBBLES
@@ -58,6 +58,8 @@ static const char sccsid[] = "@(#)hop.c	5.00 2000/11/01 xlockmore";
 					"*ncolors: 200 \n" \
 					"*fpsSolid: true \n" \
 					"*ignoreRotation: True \n" \
+					"*useSHM: True \n" \
+					POINTCLOUD_DEFAULTS_XLOCK
 
 # define SMOOTH_COLORS
 # define reshape_hop 0
@@ -68,6 +70,8 @@ static const char sccsid[] = "@(#)hop.c	5.00 2000/11/01 xlockmore";
 # include "xlock.h"		/* in xlockmore distribution */
 #endif /* STANDALONE */
 
+#include "pointcloud.h"
+
 #ifdef MODE_hop
 
 #define DEF_MARTIN "False"
@@ -117,7 +121,8 @@ static XrmOptionDescRec opts[] =
 	{"-jong", ".hop.jong", XrmoptionNoArg, "on"},
 	{"+jong", ".hop.jong", XrmoptionNoArg, "off"},
 	{"-sine", ".hop.sine", XrmoptionNoArg, "on"},
-	{"+sine", ".hop.sine", XrmoptionNoArg, "off"}
+	{"+sine", ".hop.sine", XrmoptionNoArg, "off"},
+	POINTCLOUD_OPTIONS
 };
 static argtype vars[] =
 {
@@ -187,7 +192,9 @@ typedef struct {
 	int         count;
 	int         scale;
 	int         bufsize;
-	XRectangle *pointBuffer;
+	int        *xs, *ys;
+	pointcloud *cloud;
+	int         cloud_w, cloud_h;
 } hopstruct;
 
 static hopstruct *hops = (hopstruct *) NULL;
@@ -195,8 +202,6 @@ static hopstruct *hops = (hopstruct *) NULL;
 ENTRYPOINT void
 init_hop(ModeInfo * mi)
 {
-	Display    *display = MI_DISPLAY(mi);
-	GC          gc = MI_GC(mi);
 	double      range;
 	hopstruct  *hp;
 
@@ -382,15 +387,35 @@ init_hop(ModeInfo * mi)
 		hp->pix = NRAND(MI_NPIXELS(mi));
 	hp->bufsize = MI_COUNT(mi);
 
-	if (hp->pointBuffer == NULL) {
-		if ((hp->pointBuffer = (XRectangle *) malloc(hp->bufsize *
-				sizeof (*hp->pointBuffer))) == NULL)
+	if (hp->xs == NULL) {
+		if ((hp->xs = (int *) malloc(hp->bufsize * sizeof (*hp->xs))) == NULL)
+			return;
+	}
+	if (hp->ys == NULL) {
+		if ((hp->ys = (int *) malloc(hp->bufsize * sizeof (*hp->ys))) == NULL)
 			return;
 	}
 
 	MI_CLEARWINDOW(mi);
 
-	XSetForeground(display, gc, MI_WHITE_PIXEL(mi));
+	/* This is called again at the end of every cycle, and on resize: only
+	   the latter needs a new buffer. */
+	if (hp->cloud && hp->cloud_w == MI_WIDTH(mi) &&
+	    hp->cloud_h == MI_HEIGHT(mi))
+		pointcloud_clear(hp->cloud);
+	else {
+		pointcloud_free(hp->cloud);
+		hp->cloud = pointcloud_new(MI_DISPLAY(mi), MI_WINDOW(mi), hp->scale);
+		hp->cloud_w = MI_WIDTH(mi);
+		hp->cloud_h = MI_HEIGHT(mi);
+	}
+	if (MI_NPIXELS(mi) > 2)
+		pointcloud_colors(hp->cloud, MI_NPIXELS(mi), mi->pixels,
+						  MI_BLACK_PIXEL(mi));
+	else {
+		unsigned long white = MI_WHITE_PIXEL(mi);
+		pointcloud_colors(hp->cloud, 1, &white, MI_BLACK_PIXEL(mi));
+	}
 	hp->count = 0;
 }
 
@@ -399,8 +424,8 @@ ENTRYPOINT void
 draw_hop(ModeInfo * mi)
 {
 	double      oldj, oldi;
-	XRectangle *xp;
-	int         k;
+	int        *xp, *yp;
+	int         k, color = 0;
 	hopstruct  *hp;
 
 	if (hops == NULL)
@@ -408,15 +433,16 @@ draw_hop(ModeInfo * mi)
 	hp = &hops[MI_SCREEN(mi)];
 
 
-	if (hp->pointBuffer == NULL)
+	if (hp->xs == NULL || hp->ys == NULL || hp->cloud == NULL)
 		return;
-	xp = hp->pointBuffer;
+	xp = hp->xs;
+	yp = hp->ys;
 	k = hp->bufsize;
 
 	MI_IS_DRAWN(mi) = True;
 	hp->inc++;
 	if (MI_NPIXELS(mi) > 2) {
-		XSetForeground(MI_DISPLAY(mi), MI_GC(mi), MI_PIXEL(mi, hp->pix));
+		color = hp->pix;
 		if (++hp->pix >= MI_NPIXELS(mi))
 			hp->pix = 0;
 	}
@@ -429,63 +455,63 @@ draw_hop(ModeInfo * mi)
 				hp->i = oldj + ((hp->i < 0)
 					   ? sqrt(fabs(hp->b * oldi - hp->c))
 					: -sqrt(fabs(hp->b * oldi - hp->c)));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK1:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i > 0) ? (hp->b * oldi - hp->c) :
 						-(hp->b * oldi - hp->c));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK2:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i < 0) ? log(fabs(hp->b * oldi - hp->c)) :
 					   -log(fabs(hp->b * oldi - hp->c)));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK3:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i > 0) ? sin(hp->b * oldi) - hp->c :
 						-sin(hp->b * oldi) - hp->c);
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK4:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i > 0) ? sin(hp->b * oldi) - hp->c :
 					  -sqrt(fabs(hp->b * oldi - hp->c)));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK5:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i > 0) ? sin(hp->b * oldi) - hp->c :
 						-(hp->b * oldi - hp->c));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case EJK6:
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - asin((hp->b * oldi) - (long) (hp->b * oldi));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case RR:	/* RR1 */
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - ((hp->i < 0) ? -pow(fabs(hp->b * oldi - hp->c), hp->d) :
 				     pow(fabs(hp->b * oldi - hp->c), hp->d));
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 			case POPCORN:
 #define HVAL 0.05
@@ -506,8 +532,8 @@ draw_hop(ModeInfo * mi)
 					}
 					tempi = hp->i - HVAL * sin(hp->j + tan(3.0 * hp->j));
 					tempj = hp->j - HVAL * sin(hp->i + tan(3.0 * hp->i));
-					xp->x = hp->centerx + (int) (MI_WIDTH(mi) / 40 * tempi);
-					xp->y = hp->centery + (int) (MI_HEIGHT(mi) / 40 * tempj);
+					*xp = hp->centerx + (int) (MI_WIDTH(mi) / 40 * tempi);
+					*yp = hp->centery + (int) (MI_HEIGHT(mi) / 40 * tempj);
 					hp->i = tempi;
 					hp->j = tempj;
 				}
@@ -519,22 +545,22 @@ draw_hop(ModeInfo * mi)
 					oldi = hp->i;
 				hp->j = sin(hp->c * hp->i) - cos(hp->d * hp->j);
 				hp->i = sin(hp->a * oldj) - cos(hp->b * oldi);
-				xp->x = hp->centerx + (int) (hp->centerx * (hp->i + hp->j) / 4.0);
-				xp->y = hp->centery - (int) (hp->centery * (hp->i - hp->j) / 4.0);
+				*xp = hp->centerx + (int) (hp->centerx * (hp->i + hp->j) / 4.0);
+				*yp = hp->centery - (int) (hp->centery * (hp->i - hp->j) / 4.0);
 				break;
 			case SINE:	/* MARTIN2 */
 				oldi = hp->i + hp->inc;
 				hp->j = hp->a - hp->i;
 				hp->i = oldj - sin(oldi);
-				xp->x = hp->centerx + (int) (hp->i + hp->j);
-				xp->y = hp->centery - (int) (hp->i - hp->j);
+				*xp = hp->centerx + (int) (hp->i + hp->j);
+				*yp = hp->centery - (int) (hp->i - hp->j);
 				break;
 		}
-        xp->width = xp->height = hp->scale;
 		xp++;
+		yp++;
 	}
-	XFillRectangles(MI_DISPLAY(mi), MI_WINDOW(mi), MI_GC(mi),
-		    hp->pointBuffer, hp->bufsize);
+	pointcloud_add(hp->cloud, hp->bufsize, hp->xs, hp->ys, color);
+	pointcloud_render(hp->cloud, MI_WINDOW(mi), MI_GC(mi));
 	if (++hp->count > MI_CYCLES(mi)) {
 		init_hop(mi);
 	}
@@ -545,8 +571,11 @@ free_hop(ModeInfo * mi)
 {
 	hopstruct  *hp = &hops[MI_SCREEN(mi)];
 
-	if (hp->pointBuffer != NULL)
-		(void) free((void *) hp->pointBuffer);
+	if (hp->xs != NULL)
+		(void) free((void *) hp->xs);
+	if (hp->ys != NULL)
+		(void) free((void *) hp->ys);
+	pointcloud_free(hp->cloud);
 }
 
 #ifndef STANDALONE
@@ -36,6 +36,10 @@ Multi-coloured mode added by Jack Grahl <j.grahl@ucl.ac.uk>, Jan 2007
 #include <math.h>
 
 #include "screenhack.h"
+#include "pointcloud.h"
+#include "lanes.h"
+
+#define BATCH 4096	/* Points handed to the pointcloud at once. */
 
 typedef struct {
   float r, s, tx, ty;   /* Rotation, Scale, Translation X & Y */
@@ -52,18 +56,19 @@ struct state {
   Display *dpy;
   Window window;
   GC gc;
-  Drawable backbuffer;
   XColor *colours;
+  unsigned long *pixels;
   int ncolours;
   int ccolour;
   int blackColor, whiteColor;
 
-  int width, widthb, height;
-  int width8, height8;
-  unsigned int *board;
-  XRectangle pointbuf[1000];
+  int width, height;
+  pointcloud *cloud;
+  int colour;			/* of the points being added */
+  int xs[BATCH], ys[BATCH];
   int npoints;
-  int xmin, xmax, ymin, ymax;
+  int *tree[4];			/* x, y of two levels, for expand() */
+  int tree_depth;		/* lensnum^tree_depth <= BATCH */
   int x, y;
   int pscale;
 
@@ -78,9 +83,6 @@ struct state {
   Bool translate, scale, rotate;
 };
 
-#define getdot(x,y) (st->board[((y)*st->widthb)+((x)>>5)] &  (1<<((x) & 31)))
-#define setdot(x,y) (st->board[((y)*st->widthb)+((x)>>5)] |= (1<<((x) & 31)))
-
 static float
 myrandom(float up)
 {
@@ -101,11 +103,8 @@ static const char *ifs_defaults [] = {
   "*rotate:		True",
   "*recurse:		False",
   "*multi:              True",
-# ifdef HAVE_JWXYZ	/* Don't second-guess Quartz's double-buffering */
-  "*doubleBuffer:	False",
-#else
-  "*doubleBuffer:	True",
-#endif
+  "*useSHM:		True",
+  POINTCLOUD_DEFAULTS
 #ifdef HAVE_MOBILE
   "*ignoreRotation:     True",
 #endif
@@ -125,46 +124,32 @@ static XrmOptionDescRec ifs_options [] = {
   { "-iterate",		".recurse",	XrmoptionNoArg, "False" },
   { "-multi",           ".multi",       XrmoptionNoArg, "True" },
   { "-no-multi",        ".multi",       XrmoptionNoArg, "False" },
+  /* Every frame is put on the screen in one piece now, so these are no-ops. */
   { "-db",		".doubleBuffer",XrmoptionNoArg, "True" },
   { "-no-db",		".doubleBuffer",XrmoptionNoArg, "False" },
+  POINTCLOUD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
 
-/* Draw all the queued points on the backbuffer */
+/* Add all the queued points to the cloud */
 static void
 drawpoints(struct state *st)
 {
-  XFillRectangles(st->dpy, st->backbuffer, st->gc, st->pointbuf, st->npoints);
+  pointcloud_add(st->cloud, st->npoints, st->xs, st->ys, st->colour);
   st->npoints = 0;
 }
 
-/* Set a point to be drawn, if it hasn't been already.
+/* Set a point to be drawn.
  * Expects coordinates in 256ths of a pixel. */
 static void
 sp(struct state *st, int x, int y)
 {
-  if (x < 0 || x >= st->width8 || y < 0 || y >= st->height8)
-    return;
-
-  x >>= 8;
-  y >>= 8;
-
-  if (getdot(x, y)) return;
-  setdot(x, y);
-
-  if (x < st->xmin) st->xmin = x;
-  if (x > st->xmax) st->xmax = x;
-  if (y < st->ymin) st->ymin = y;
-  if (y > st->ymax) st->ymax = y;
-
-  st->pointbuf[st->npoints].x = x;
-  st->pointbuf[st->npoints].y = y;
-  st->pointbuf[st->npoints].width =
-    st->pointbuf[st->npoints].height = st->pscale;
+  st->xs[st->npoints] = x >> 8;
+  st->ys[st->npoints] = y >> 8;
   st->npoints++;
 
-  if (st->npoints >= countof(st->pointbuf)) {
+  if (st->npoints >= countof(st->xs)) {
     drawpoints(st);
   }
 }
@@ -270,6 +255,75 @@ mutate(struct state *st, Lens *l)
 #define STEPY(l,x,y) (((l)->uc * (x) + (l)->ud * (y) + (l)->uty) >> 10)
 /*#define STEPY(l,x,y) (((l)->ua * (y) - (l)->ub * (x) + (l)->uty) >> 10)*/
 
+/* The bottom of the recursion is done a level at a time instead: every
+ * lens applied to an array of points, which is a plain loop of integer
+ * arithmetic.  It's run LANES points at a time and then once more for the
+ * rest; see lanes.h.
+ */
+
+static INLINE void
+step_lanes(int ua, int ub, int utx, int uc, int ud, int uty, int n,
+           const int *RESTRICT x, const int *RESTRICT y,
+           int *RESTRICT nx, int *RESTRICT ny)
+{
+  int i;
+  for (i = 0; i < n; i++) {
+    nx[i] = (ua * x[i] + ub * y[i] + utx) >> 10;
+    ny[i] = (uc * x[i] + ud * y[i] + uty) >> 10;
+  }
+}
+
+static void
+step_points(const Lens *l, int n, const int *x, const int *y, int *nx, int *ny)
+{
+  int i;
+  for (i = 0; i + LANES <= n; i += LANES)
+    step_lanes(l->ua, l->ub, l->utx, l->uc, l->ud, l->uty, LANES,
+               x + i, y + i, nx + i, ny + i);
+  step_lanes(l->ua, l->ub, l->utx, l->uc, l->ud, l->uty, n - i,
+             x + i, y + i, nx + i, ny + i);
+}
+
+static INLINE void
+pixel_lanes(int n, int *RESTRICT x, int *RESTRICT y)
+{
+  int i;
+  for (i = 0; i < n; i++) {
+    x[i] >>= 8;
+    y[i] >>= 8;
+  }
+}
+
+/* Draws the <lensnum>^<length> points below x,y, which fit in a BATCH. */
+static void
+expand(struct state *st, int x, int y, int length, int p)
+{
+  int *x0 = st->tree[0], *y0 = st->tree[1];
+  int *x1 = st->tree[2], *y1 = st->tree[3];
+  int *t;
+  int i, n = 1;
+
+  x0[0] = x;
+  y0[0] = y;
+  for (; length > 0; length--) {
+    for (i = 0; i < st->lensnum; i++)
+      step_points(&st->lenses[i], n, x0, y0, x1 + i * n, y1 + i * n);
+    n *= st->lensnum;
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+  if (p != 0) {
+    step_points(&st->lenses[p], n, x0, y0, x1, y1);
+    x0 = x1;
+    y0 = y1;
+  }
+
+  for (i = 0; i + LANES <= n; i += LANES)
+    pixel_lanes(LANES, x0 + i, y0 + i);
+  pixel_lanes(n - i, x0 + i, y0 + i);
+  pointcloud_add(st->cloud, n, x0, y0, st->colour);
+}
+
 /* Calls itself <lensnum> times - with results from each lens/function.  *
  * After <length> calls to itself, it stops iterating and draws a point. */
 static void
@@ -278,14 +332,8 @@ recurse(struct state *st, int x, int y, int length, int p)
   int i;
   Lens *l;
 
-  if (length == 0) {
-    if (p == 0) 
-      sp(st, x, y);
-    else {
-      l = &st->lenses[p];
-      sp(st, STEPX(l, x, y), STEPY(l, x, y));
-    }
-  }
+  if (length <= st->tree_depth)
+    expand(st, x, y, length, p);
   else {
     for (i = 0; i < st->lensnum; i++) {
       l = &st->lenses[i];
@@ -341,21 +389,11 @@ ifs_draw (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
   int i;
-  int xmin = st->xmin, xmax = st->xmax, ymin = st->ymin, ymax = st->ymax;
   int partcolor, x, y;
-  
 
-  /* erase whatever was drawn in the previous frame */
-  if (xmin <= xmax && ymin <= ymax) {
-    XSetForeground(st->dpy, st->gc, st->blackColor);
-    XFillRectangle(st->dpy, st->backbuffer, st->gc,
-		   xmin, ymin,
-		   xmax - xmin + 1 * st->pscale,
-                   ymax - ymin + 1 * st->pscale);
-    st->xmin = st->width  + 1;
-    st->xmax = st->ymax =  -1;
-    st->ymin = st->height + 1;
-  }
+  /* start over from an empty cloud; whatever was drawn in the previous
+     frame is erased when this one is rendered */
+  pointcloud_clear(st->cloud);
 
   st->ccolour++;
   st->ccolour %= st->ncolours;
@@ -368,8 +406,7 @@ ifs_draw (Display *dpy, Window window, void *closure)
     for (i = 0; i < st->lensnum; i++) {  
       partcolor = st->ccolour * (i+1);
       partcolor %= st->ncolours;
-      XSetForeground(st->dpy, st->gc, st->colours[partcolor].pixel);
-      memset(st->board, 0, st->widthb * st->height * sizeof(*st->board));
+      st->colour = partcolor;
       if (st->recurse)   
 	recurse(st, x, y, st->length - 1, i);
       else
@@ -380,8 +417,7 @@ ifs_draw (Display *dpy, Window window, void *closure)
   } 
   else {
     
-    XSetForeground(st->dpy, st->gc, st->colours[st->ccolour].pixel);
-    memset(st->board, 0, st->widthb * st->height * sizeof(*st->board));
+    st->colour = st->ccolour;
     if (st->recurse)
       recurse(st, x, y, st->length, 0);
     else
@@ -389,21 +425,8 @@ ifs_draw (Display *dpy, Window window, void *closure)
     if (st->npoints)
       drawpoints(st);
   }
-  
-  /* if we just drew into a buffer, copy the changed area (including
-   * erased area) to screen */
-  if (st->backbuffer != st->window
-      && ((st->xmin <= st->xmax && st->ymin <= st->ymax)
-	  || (xmin <= xmax && ymin <= ymax))) {
-    if (st->xmin < xmin) xmin = st->xmin;
-    if (st->xmax > xmax) xmax = st->xmax;
-    if (st->ymin < ymin) ymin = st->ymin;
-    if (st->ymax > ymax) ymax = st->ymax;
-    XCopyArea(st->dpy, st->backbuffer, st->window, st->gc,
-	      xmin, ymin,
-	      xmax - xmin + 1, ymax - ymin + 1,
-	      xmin, ymin);
-  }
+
+  pointcloud_render(st->cloud, st->window, st->gc);
 
   for(i = 0; i < st->lensnum; i++) {
     mutate(st, &st->lenses[i]);
@@ -431,14 +454,16 @@ ifs_init (Display *d_arg, Window w_arg)
   st->gc = XCreateGC(st->dpy, st->window, 0, NULL);
 
   XGetWindowAttributes (st->dpy, st->window, &xgwa);
-  ifs_reshape(st->dpy, st->window, st, xgwa.width, xgwa.height);
-	
+
   st->pscale = 1;
   if (xgwa.width > 2560 || xgwa.height > 2560)
     st->pscale *= 3;  /* Retina displays */
   /* We aren't increasing the spacing between the pixels, just the size. */
 
 
+  st->lensnum = get_integer_resource(st->dpy, "lensnum", "Functions");
+  if (st->lensnum < 1) st->lensnum = 1;
+
   st->ncolours = get_integer_resource(st->dpy, "colors", "Colors");
   if (st->ncolours < st->lensnum)
     st->ncolours = st->lensnum;
@@ -449,6 +474,27 @@ ifs_init (Display *d_arg, Window w_arg)
   make_smooth_colormap (xgwa.screen, xgwa.visual, xgwa.colormap, 
                         st->colours, &st->ncolours,
                         True, 0, False);
+  if (st->ncolours < 1) {
+    /* no colors to be had: draw in white */
+    st->ncolours = 1;
+    st->colours[0].pixel = st->whiteColor;
+  }
+  st->pixels = (unsigned long *)calloc(st->ncolours, sizeof(*st->pixels));
+  if (!st->pixels) exit(1);
+  for (i = 0; i < st->ncolours; i++)
+    st->pixels[i] = st->colours[i].pixel;
+
+  /* how many levels of the recursion fit in one batch of points */
+  for (i = 0; i < 4; i++) {
+    st->tree[i] = (int *)malloc(BATCH * sizeof(*st->tree[i]));
+    if (!st->tree[i]) exit(1);
+  }
+  for (st->tree_depth = 0, i = st->lensnum;
+       i <= BATCH && st->tree_depth < 64;
+       i *= st->lensnum)
+    st->tree_depth++;
+
+  ifs_reshape(st->dpy, st->window, st, xgwa.width, xgwa.height);
 
   /* Initialize IFS data */
  
@@ -464,7 +510,6 @@ ifs_init (Display *d_arg, Window w_arg)
   st->recurse = get_boolean_resource(st->dpy, "recurse", "Boolean");
   st->multi = get_boolean_resource(st->dpy, "multi", "Boolean");
 
-  st->lensnum = get_integer_resource(st->dpy, "lensnum", "Functions");
   if (st->lenses) free (st->lenses);
   st->lenses = (Lens *)calloc(st->lensnum, sizeof(Lens));
   if (!st->lenses) exit(1);
@@ -487,39 +532,16 @@ ifs_reshape (Display *dpy, Window window, void *closure,
   struct state *st = (struct state *)closure;
   XWindowAttributes xgwa;
 
-  /* oh well, we need the screen depth anyway */
+  /* the window size, rather than trusting w and h */
   XGetWindowAttributes (st->dpy, st->window, &xgwa);
 
   st->width = xgwa.width;
-  st->widthb = ((xgwa.width + 31) >> 5);
   st->height = xgwa.height;
-  st->width8 = xgwa.width << 8;
-  st->height8 = xgwa.height << 8;
-
-  if (!st->xmax && !st->ymax && !st->xmin && !st->ymin) {
-    st->xmin = xgwa.width + 1;
-    st->xmax = st->ymax = -1;
-    st->ymin = xgwa.height + 1;
-  }
-
-  if (st->backbuffer != None && st->backbuffer != st->window) {
-    XFreePixmap(st->dpy, st->backbuffer);
-    st->backbuffer = None;
-  }
 
-  if (get_boolean_resource (st->dpy, "doubleBuffer", "Boolean")) {
-    st->backbuffer = XCreatePixmap(st->dpy, st->window, st->width, st->height, xgwa.depth);
-    XSetForeground(st->dpy, st->gc, st->blackColor);
-    XFillRectangle(st->dpy, st->backbuffer, st->gc,
-		   0, 0, st->width, st->height);
-  } else {
-    st->backbuffer = st->window;
-    XClearWindow(st->dpy, st->window);
-  }
-
-  if (st->board) free(st->board);
-  st->board = (unsigned int *)calloc(st->widthb * st->height, sizeof(unsigned int));
-  if (!st->board) exit(1);
+  if (st->cloud) pointcloud_free(st->cloud);
+  st->cloud = pointcloud_new(st->dpy, st->window, st->pscale);
+  pointcloud_colors(st->cloud, st->ncolours, st->pixels, st->blackColor);
+  XClearWindow(st->dpy, st->window);
 }
 
 static Bool
@@ -547,11 +569,14 @@ ifs_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
 
-  if (st->board) free(st->board);
+  int i;
+
+  if (st->cloud) pointcloud_free(st->cloud);
+  for (i = 0; i < 4; i++)
+    if (st->tree[i]) free(st->tree[i]);
   if (st->lenses) free(st->lenses);
   if (st->colours) free(st->colours);
-  if (st->backbuffer != None && st->backbuffer != st->window)
-    XFreePixmap(st->dpy, st->backbuffer);
+  if (st->pixels) free(st->pixels);
   XFreeGC (dpy, st->gc);
   free(st);
 }
@@ -44,6 +44,8 @@ static const char sccsid[] = "@(#)julia.c	4.03 97/04/10 xlockmore";
 					"*ncolors:		  200    \n" \
 					"*fpsSolid:		  true   \n" \
 					"*ignoreRotation: True   \n" \
+					"*useSHM:		  True   \n" \
+					POINTCLOUD_DEFAULTS_XLOCK
 
 # define UNIFORM_COLORS
 # define release_julia 0
@@ -53,13 +55,25 @@ static const char sccsid[] = "@(#)julia.c	4.03 97/04/10 xlockmore";
 # include "xlock.h"					/* in xlockmore distribution */
 #endif /* !STANDALONE */
 
+#include "pointcloud.h"
+
+#define LANES 8		/* of doubles */
+#include "lanes.h"
 
 #define DEF_MOUSE "False"
 
-ENTRYPOINT ModeSpecOpt julia_opts = { 0, };
+static XrmOptionDescRec opts[] =
+{
+	POINTCLOUD_OPTIONS
+};
+
+ENTRYPOINT ModeSpecOpt julia_opts =
+{sizeof opts / sizeof opts[0], opts, 0, (argtype *) NULL,
+ (OptionStruct *) NULL};
 
 
 #define numpoints ((0x2<<jp->depth)-1)
+#define MAXDEPTH 16
 
 typedef struct {
 	int         centerx;
@@ -72,16 +86,17 @@ typedef struct {
 	int         erase;
 	int         scale;
 	int         pix;
-	long        itree;
 	int         buffer;
 	int         nbuffers;
-	int         redrawing, redrawpos;
 	Pixmap      pixmap;
 #ifndef HAVE_JWXYZ
 	Cursor      cursor;
 #endif
 	GC          stippledGC;
-	XRectangle **pointBuffer;
+	unsigned  **pointBuffer;	/* cells of each of the last nbuffers sets */
+	double     *zr, *zi;	/* the tree, a level at a time */
+	int        *xs, *ys;
+	pointcloud *cloud;
     Bool        button_down_p;
     int         mouse_x, mouse_y;
 
@@ -89,40 +104,75 @@ typedef struct {
 
 static juliastruct *julias = NULL;
 
-/* How many segments to draw per cycle when redrawing */
-#define REDRAWSTEP 3
+/* The tree of preimages used to be walked recursively, taking atan2, sin
+   and cos of every point.  Instead, it's built breadth-first: each level is
+   the square roots of the previous one, less c, and their negations.  The
+   square root is the algebraic one, so a level is a plain loop over arrays,
+   which is run LANES points at a time and then once more for the rest
+   (see lanes.h), though GCC keeps the square roots scalar unless
+   -fno-math-errno.
+ */
 
-static void
-apply(juliastruct * jp, register double xr, register double xi, int d)
+static INLINE void
+preimage_lanes (const double *RESTRICT zr, const double *RESTRICT zi,
+				double cr, double ci, int n,
+				double *RESTRICT pr, double *RESTRICT pi,
+				double *RESTRICT nr, double *RESTRICT ni)
 {
-	double      theta, r;
-
-	jp->pointBuffer[jp->buffer][jp->itree].x =
-		(int) (0.5 * xr * jp->centerx + jp->centerx);
-	jp->pointBuffer[jp->buffer][jp->itree].y =
-		(int) (0.5 * xi * jp->centery + jp->centery);
-	jp->itree++;
-
-	if (d > 0) {
-		xi -= jp->ci;
-		xr -= jp->cr;
+	int         i;
 
-/* Avoid atan2: DOMAIN error message */
-		if (xi == 0.0 && xr == 0.0)
-			theta = 0.0;
-		else
-			theta = atan2(xi, xr) / 2.0;
+	for (i = 0; i < n; i++) {
+		double      xr = zr[i] - cr, xi = zi[i] - ci;
+		double      r = sqrt(xr * xr + xi * xi);
+		double      wr = sqrt((r + xr) * 0.5);
+		double      wi = sqrt((r - xr) * 0.5);
+
+		wi = (xi < 0 ? -wi : wi);
+		pr[i] = wr;
+		pi[i] = wi;
+		nr[i] = -wr;
+		ni[i] = -wi;
+	}
+}
 
-		/*r = pow(xi * xi + xr * xr, 0.25); */
-		r = sqrt(sqrt(xi * xi + xr * xr));	/* 3 times faster */
+static INLINE void
+screen_lanes (const double *RESTRICT zr, const double *RESTRICT zi,
+			  int cx, int cy, int n, int *RESTRICT xs, int *RESTRICT ys)
+{
+	int         i;
 
-		xr = r * cos(theta);
-		xi = r * sin(theta);
+	for (i = 0; i < n; i++) {
+		xs[i] = (int) (0.5 * zr[i] * cx + cx);
+		ys[i] = (int) (0.5 * zi[i] * cy + cy);
+	}
+}
 
-		d--;
-		apply(jp, xr, xi, d);
-		apply(jp, -xr, -xi, d);
+/* Fills in the tree below xr + i xi, and the pixels of all of it. */
+static void
+apply(juliastruct * jp, double xr, double xi)
+{
+	double     *zr = jp->zr, *zi = jp->zi;
+	int         level, j, n;
+
+	zr[0] = xr;
+	zi[0] = xi;
+	for (level = 0, n = 1; level < jp->depth; level++, n *= 2) {
+		double     *r = zr + n - 1, *i = zi + n - 1;	/* this level */
+		double     *nr = zr + 2 * n - 1, *ni = zi + 2 * n - 1;	/* next one */
+
+		for (j = 0; j + LANES <= n; j += LANES)
+			preimage_lanes(r + j, i + j, jp->cr, jp->ci, LANES,
+						   nr + j, ni + j, nr + n + j, ni + n + j);
+		preimage_lanes(r + j, i + j, jp->cr, jp->ci, n - j,
+					   nr + j, ni + j, nr + n + j, ni + n + j);
 	}
+
+	n = numpoints;
+	for (j = 0; j + LANES <= n; j += LANES)
+		screen_lanes(zr + j, zi + j, jp->centerx, jp->centery, LANES,
+					 jp->xs + j, jp->ys + j);
+	screen_lanes(zr + j, zi + j, jp->centerx, jp->centery, n - j,
+				 jp->xs + j, jp->ys + j);
 }
 
 static void
@@ -155,6 +205,28 @@ incr(ModeInfo * mi, juliastruct * jp)
 	  }
 }
 
+static void
+free_buffers(juliastruct * jp)
+{
+	int         buffer;
+
+	if (jp->pointBuffer) {
+		for (buffer = 0; buffer < jp->nbuffers; buffer++)
+			if (jp->pointBuffer[buffer])
+				(void) free((void *) jp->pointBuffer[buffer]);
+		(void) free((void *) jp->pointBuffer);
+		jp->pointBuffer = NULL;
+	}
+	if (jp->zr) free(jp->zr);
+	if (jp->zi) free(jp->zi);
+	if (jp->xs) free(jp->xs);
+	if (jp->ys) free(jp->ys);
+	jp->zr = jp->zi = NULL;
+	jp->xs = jp->ys = NULL;
+	pointcloud_free(jp->cloud);
+	jp->cloud = NULL;
+}
+
 ENTRYPOINT void
 init_julia(ModeInfo * mi)
 {
@@ -171,8 +243,10 @@ init_julia(ModeInfo * mi)
 	jp->centery = MI_WIN_HEIGHT(mi) / 2;
 
 	jp->depth = MI_BATCHCOUNT(mi);
-	if (jp->depth > 10)
-		jp->depth = 10;
+	if (jp->depth > MAXDEPTH)
+		jp->depth = MAXDEPTH;
+	if (jp->depth < 0)
+		jp->depth = 0;
 
     jp->scale = 1;
     if (MI_WIDTH(mi) > 2560 || MI_HEIGHT(mi) > 2560)
@@ -241,19 +315,36 @@ init_julia(ModeInfo * mi)
 	if (MI_NPIXELS(mi) > 2)
 		jp->pix = NRAND(MI_NPIXELS(mi));
 	jp->inc = ((LRAND() & 1) * 2 - 1) * NRAND(200);
+
+	free_buffers(jp);
 	jp->nbuffers = (MI_CYCLES(mi) + 1);
-	if (!jp->pointBuffer)
-		jp->pointBuffer = (XRectangle **)
-          calloc(jp->nbuffers, sizeof (*jp->pointBuffer));
+	jp->pointBuffer = (unsigned **)
+		calloc(jp->nbuffers, sizeof (*jp->pointBuffer));
+	jp->zr = (double *) malloc(numpoints * sizeof (*jp->zr));
+	jp->zi = (double *) malloc(numpoints * sizeof (*jp->zi));
+	jp->xs = (int *) malloc(numpoints * sizeof (*jp->xs));
+	jp->ys = (int *) malloc(numpoints * sizeof (*jp->ys));
+	if (!jp->pointBuffer || !jp->zr || !jp->zi || !jp->xs || !jp->ys) {
+		free_buffers(jp);
+		return;
+	}
 	for (i = 0; i < jp->nbuffers; ++i)
-		if (jp->pointBuffer[i])
-          memset(jp->pointBuffer[i], 0,
-                 numpoints * sizeof (**jp->pointBuffer));
-		else
-			jp->pointBuffer[i] = (XRectangle *)
-              calloc(numpoints, sizeof (**jp->pointBuffer));
+		if ((jp->pointBuffer[i] = (unsigned *)
+			 malloc(numpoints * sizeof (**jp->pointBuffer))) == NULL) {
+			free_buffers(jp);
+			return;
+		}
+
+	jp->cloud = pointcloud_new(display, window, jp->scale);
+	if (MI_NPIXELS(mi) > 2)
+		pointcloud_colors(jp->cloud, MI_NPIXELS(mi), mi->pixels,
+						  MI_WIN_BLACK_PIXEL(mi));
+	else {
+		unsigned long white = MI_WIN_WHITE_PIXEL(mi);
+		pointcloud_colors(jp->cloud, 1, &white, MI_WIN_BLACK_PIXEL(mi));
+	}
+
 	jp->buffer = 0;
-	jp->redrawing = 0;
 	jp->erase = 0;
 	XClearWindow(display, window);
 }
@@ -315,8 +406,11 @@ draw_julia (ModeInfo * mi)
 	juliastruct *jp = &julias[MI_SCREEN(mi)];
 	double      r, theta;
 	register double xr = 0.0, xi = 0.0;
-	int         k = 64, rnd = 0, i, j;
-	XRectangle *xp = jp->pointBuffer[jp->buffer], old_circle, new_circle;
+	int         k = 64, rnd = 0, color = 0;
+	XRectangle  old_circle, new_circle;
+
+	if (!jp->cloud)
+		return;
 
 	old_circle.x = (int) (jp->centerx * jp->cr / 2) + jp->centerx - 2;
 	old_circle.y = (int) (jp->centery * jp->ci / 2) + jp->centery - 2;
@@ -331,31 +425,17 @@ draw_julia (ModeInfo * mi)
              old_circle.y-jp->circsize/2-2,
              jp->circsize+4, jp->circsize+4,
              0, 360*64);
-	/* draw a circle at the c-parameter so you can see it's effect on the
-	   structure of the julia set */
-	XSetForeground(display, jp->stippledGC, MI_WIN_WHITE_PIXEL(mi));
-#ifndef HAVE_JWXYZ
-	XSetTSOrigin(display, jp->stippledGC, new_circle.x, new_circle.y);
-	XSetStipple(display, jp->stippledGC, jp->pixmap);
-	XSetFillStyle(display, jp->stippledGC, FillOpaqueStippled);
-#endif /* HAVE_JWXYZ */
-	XDrawArc(display, window, jp->stippledGC, 
-             new_circle.x-jp->circsize/2,
-             new_circle.y-jp->circsize/2,
-             jp->circsize, jp->circsize,
-             0, 360*64);
 
-	if (jp->erase == 1) {
-		XFillRectangles(display, window, gc,
-                        jp->pointBuffer[jp->buffer], numpoints);
-	}
+	if (jp->erase == 1)
+		pointcloud_unplot(jp->cloud, numpoints, jp->pointBuffer[jp->buffer]);
 	jp->inc++;
 	if (MI_NPIXELS(mi) > 2) {
-		XSetForeground(display, gc, MI_PIXEL(mi, jp->pix));
+		color = jp->pix;
 		if (++jp->pix >= MI_NPIXELS(mi))
 			jp->pix = 0;
-	} else
-		XSetForeground(display, gc, MI_WIN_WHITE_PIXEL(mi));
+	}
+
+	/* Wander to a random point near the set. */
 	while (k--) {
 
 		/* save calls to LRAND by using bit shifts over and over on the same
@@ -384,35 +464,33 @@ draw_julia (ModeInfo * mi)
 			xi = -xi;
 			xr = -xr;
 		}
-		xp->x = jp->centerx + (int) ((jp->centerx >> 1) * xr);
-		xp->y = jp->centery + (int) ((jp->centery >> 1) * xi);
-        xp->width = xp->height = jp->scale;
-		xp++;
 	}
 
-	jp->itree = 0;
-	apply(jp, xr, xi, jp->depth);
+	apply(jp, xr, xi);
+	pointcloud_cells(jp->cloud, numpoints, jp->xs, jp->ys,
+					 jp->pointBuffer[jp->buffer]);
+	pointcloud_plot(jp->cloud, numpoints, jp->pointBuffer[jp->buffer], color);
+	pointcloud_render(jp->cloud, window, gc);
 
-	XFillRectangles (display, window, gc,
-                     jp->pointBuffer[jp->buffer], numpoints);
+	/* draw a circle at the c-parameter so you can see it's effect on the
+	   structure of the julia set */
+	XSetForeground(display, jp->stippledGC, MI_WIN_WHITE_PIXEL(mi));
+#ifndef HAVE_JWXYZ
+	XSetTSOrigin(display, jp->stippledGC, new_circle.x, new_circle.y);
+	XSetStipple(display, jp->stippledGC, jp->pixmap);
+	XSetFillStyle(display, jp->stippledGC, FillOpaqueStippled);
+#endif /* HAVE_JWXYZ */
+	XDrawArc(display, window, jp->stippledGC, 
+             new_circle.x-jp->circsize/2,
+             new_circle.y-jp->circsize/2,
+             jp->circsize, jp->circsize,
+             0, 360*64);
 
 	jp->buffer++;
 	if (jp->buffer > jp->nbuffers - 1) {
 		jp->buffer -= jp->nbuffers;
 		jp->erase = 1;
 	}
-	if (jp->redrawing) {
-		for (i = 0; i < REDRAWSTEP; i++) {
-			j = (jp->buffer - jp->redrawpos + jp->nbuffers) % jp->nbuffers;
-			XFillRectangles (display, window, gc,
-                             jp->pointBuffer[j], numpoints);
-
-			if (++(jp->redrawpos) >= jp->nbuffers) {
-				jp->redrawing = 0;
-				break;
-			}
-		}
-	}
 }
 
 ENTRYPOINT void
@@ -420,14 +498,8 @@ free_julia (ModeInfo * mi)
 {
 	Display    *display = MI_DISPLAY(mi);
 	juliastruct *jp = &julias[MI_SCREEN(mi)];
-	int         buffer;
 
-	if (jp->pointBuffer) {
-		for (buffer = 0; buffer < jp->nbuffers; buffer++)
-			if (jp->pointBuffer[buffer])
-				(void) free((void *) jp->pointBuffer[buffer]);
-		(void) free((void *) jp->pointBuffer);
-	}
+	free_buffers(jp);
 	if (jp->stippledGC != None)
 		XFreeGC(display, jp->stippledGC);
 	if (jp->pixmap != None)
@@ -442,10 +514,7 @@ free_julia (ModeInfo * mi)
 ENTRYPOINT void
 refresh_julia (ModeInfo * mi)
 {
-	juliastruct *jp = &julias[MI_SCREEN(mi)];
-
-	jp->redrawing = 1;
-	jp->redrawpos = 0;
+	/* Every frame redraws all of the sets still on the screen. */
 }
 #endif
 
@@ -14,12 +14,38 @@
 #include "screenhack.h"
 #include "xshm.h"
 #include "xft.h"
+#include "rowwriter.h"
+#include "thread_util.h"
 #include <stdio.h>
 
 #ifndef HAVE_MOBILE
 # define READ_FILES
 #endif
 
+#ifdef READ_FILES
+# include <errno.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+
+/* How much of a file that isn't mapped is read at a time. */
+# define BLOCK_SIZE (256 * 1024)
+
+/* A file modified more recently than this is probably still being written,
+   so it is read rather than mapped. */
+# define SETTLE_SECS 10
+
+/* The next block of a file that can't be mapped, being read on a worker
+   thread while the current one is shown. */
+typedef struct {
+  struct io_thread io;
+  int fd;
+  unsigned char *buf;
+  ssize_t len;
+} read_ahead;
+#endif /* READ_FILES */
+
 typedef struct {
   int which;
   XRectangle rect;
@@ -30,6 +56,8 @@ typedef struct {
   unsigned int value;
   unsigned char *data;
   int count_zero;
+  row_writer writer;
+  unsigned long *pixels;	/* One per 'rez' rows of the column */
 } scroller;
 
 typedef struct {
@@ -46,7 +74,27 @@ typedef struct {
   enum { DRAW_COLOR, DRAW_MONO } draw_mode;
 
   char *filename;
-  FILE *in;
+
+# ifdef READ_FILES
+  /* SEED_FILE: regular files are mapped, and shown straight out of the
+     mapping.  Anything else (a pipe, a device, or a file that is changing)
+     is read in large blocks, and the next block is read on a worker
+     thread. */
+  unsigned char *map;
+  size_t map_size;
+  int map_fd;			/* Kept open to notice changes */
+  time_t map_mtime;
+  read_ahead *ra;		/* Owns the file descriptor, if not mapped */
+  Bool reading_p;		/* ra's thread is running */
+  unsigned char *buf;		/* The block being shown, if not mapped */
+  unsigned char *block;		/* The map, or buf */
+  size_t block_size, block_pos;
+# endif
+
+  /* Each byte's bits in the pixel, by channel.  rtab also has the bits
+     that are in none of the masks set, for the benefit of HAVE_JWXYZ
+     alpha. */
+  unsigned long rtab[256], gtab[256], btab[256];
 
   int nscrollers;
   scroller *scrollers;
@@ -61,6 +109,24 @@ typedef struct {
 static void reshape_memscroller (state *st);
 
 
+static void
+init_pack_tables (state *st)
+{
+  XImage *image = st->scrollers[0].image;
+  unsigned long amsk = 0xFFFFFFFFUL & ~(image->red_mask | image->green_mask |
+                                        image->blue_mask);
+  int i;
+  for (i = 0; i < 256; i++)
+    {
+      unsigned long v = (((unsigned long) i << 24) | (i << 16) |
+                         (i << 8) | i);
+      st->rtab[i] = (v & image->red_mask) | amsk;
+      st->gtab[i] =  v & image->green_mask;
+      st->btab[i] =  v & image->blue_mask;
+    }
+}
+
+
 static void *
 memscroller_init (Display *dpy, Window window)
 {
@@ -183,19 +249,27 @@ memscroller_init (Display *dpy, Window window)
       if (st->xgwa.width > 2560 || st->xgwa.height > 2560)
         sc->speed *= 2.5;  /* Retina displays */
 
+      /* The new column, as many pixels wide as it scrolls each frame,
+         so that it goes out in one XShmPutImage. */
       sc->image = create_xshm_image (st->dpy, st->xgwa.visual,
                                      st->xgwa.depth,
                                      ZPixmap, &st->shm_info,
-                                     1, max_height);
+                                     sc->speed, max_height);
 
       if (!sc->image)
         {
-          fprintf (stderr, "%s: out of memory (allocating 1x%d image)\n",
-                   progname, sc->image->height);
+          fprintf (stderr, "%s: out of memory (allocating %dx%d image)\n",
+                   progname, sc->speed, max_height);
           exit (1);
         }
+
+      init_row_writer (&sc->writer, sc->image);
+      sc->pixels = (unsigned long *)
+        malloc (max_height * sizeof(*sc->pixels));
+      if (!sc->pixels) abort();
     }
 
+  init_pack_tables (st);
   reshape_memscroller (st);
   return st;
 }
@@ -251,25 +325,191 @@ reshape_memscroller (state *st)
 
 
 # ifdef READ_FILES
+
 static void
-open_file (state *st)
+free_read_ahead (read_ahead *ra)
+{
+  if (ra->fd >= 0) close (ra->fd);
+  free (ra->buf);
+  free (ra);
+}
+
+
+static void
+read_block (read_ahead *ra)
+{
+  do {
+    ra->len = read (ra->fd, ra->buf, BLOCK_SIZE);
+  } while (ra->len < 0 && errno == EINTR);
+  if (ra->len < 0) ra->len = 0;
+}
+
+
+static void *
+read_ahead_thread (void *arg)
+{
+  read_ahead *ra = (read_ahead *) arg;
+  read_block (ra);
+  if (io_thread_return (&ra->io))
+    free_read_ahead (ra);	/* The file was closed meanwhile */
+  return 0;
+}
+
+
+static void
+close_file (state *st)
 {
-  if (st->in)
+  if (st->map)
     {
-      fclose (st->in);
-      st->in = 0;
+      munmap (st->map, st->map_size);
+      close (st->map_fd);
     }
+  st->map = 0;
+  st->map_size = 0;
+
+  if (st->ra && !(st->reading_p && !io_thread_cancel (&st->ra->io)))
+    free_read_ahead (st->ra);	/* Else the thread will free it. */
+  st->ra = 0;
+  st->reading_p = False;
+
+  st->block = 0;
+  st->block_size = st->block_pos = 0;
+}
+
+
+static void
+start_reading (state *st, int fd)
+{
+  st->ra = (read_ahead *) calloc (1, sizeof(*st->ra));
+  if (!st->ra) abort();
+  st->ra->fd = fd;
+  st->ra->buf = (unsigned char *) malloc (BLOCK_SIZE);
+  if (!st->buf)
+    st->buf = (unsigned char *) malloc (BLOCK_SIZE);
+  if (!st->ra->buf || !st->buf) abort();
+  st->block = st->buf;
+}
+
 
-  st->in = fopen (st->filename, "r");
-  if (!st->in)
+static void
+open_file (state *st)
+{
+  struct stat s;
+  int fd;
+
+  close_file (st);
+
+  fd = open (st->filename, O_RDONLY);
+  if (fd < 0)
     {
       char buf[1024];
       sprintf (buf, "%s: %s", progname, st->filename);
       perror (buf);
       exit (1);
     }
+
+  if (!fstat (fd, &s) &&
+      S_ISREG (s.st_mode) &&
+      s.st_size > 0 &&
+      (off_t) (size_t) s.st_size == s.st_size &&
+      s.st_mtime < time ((time_t *) 0) - SETTLE_SECS)
+    {
+      void *map = mmap (0, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map != MAP_FAILED)
+        {
+          st->map = (unsigned char *) map;
+          st->map_size = s.st_size;
+          st->map_fd = fd;
+          st->map_mtime = s.st_mtime;
+#  ifdef MADV_SEQUENTIAL
+          madvise (map, st->map_size, MADV_SEQUENTIAL);
+#  endif
+          st->block = st->map;
+          st->block_size = st->map_size;
+          return;
+        }
+    }
+
+  start_reading (st, fd);
 }
-#endif
+
+
+/* Touching a page past the end of a file that has since been truncated is
+   SIGBUS, so a mapped file is re-checked before each column's worth of it
+   is shown.  If it has changed at all, the rest of it is read instead, and
+   once it has been left alone for a while, the next pass maps it again at
+   whatever size it is by then.
+ */
+static void
+check_mapped_file (state *st)
+{
+  size_t pos = st->block_pos;
+  struct stat s;
+  int fd;
+
+  if (!fstat (st->map_fd, &s) &&
+      (size_t) s.st_size == st->map_size &&
+      s.st_mtime == st->map_mtime)
+    return;
+
+  /* Carry on from the same place.  If it is now shorter than that, the
+     read hits end of file and starts over. */
+  fd = st->map_fd;
+  munmap (st->map, st->map_size);
+  st->map = 0;
+  st->map_size = 0;
+  if (lseek (fd, pos, SEEK_SET) < 0)
+    lseek (fd, 0, SEEK_SET);
+  start_reading (st, fd);
+  st->block_size = st->block_pos = 0;
+}
+
+
+/* Called when the bytes in st->block have all been shown. */
+static void
+next_block (state *st)
+{
+  read_ahead *ra = st->ra;
+  unsigned char *swap;
+
+  if (st->map)			/* Start the file over. */
+    {
+      st->block_pos = 0;
+      return;
+    }
+
+  if (st->reading_p)
+    {
+      io_thread_finish (&ra->io);	/* Usually done long since. */
+      st->reading_p = False;
+    }
+  else
+    read_block (ra);
+
+  swap = st->buf;
+  st->buf = ra->buf;
+  ra->buf = swap;
+  st->block = st->buf;
+  st->block_size = ra->len;
+  st->block_pos = 0;
+
+  if (st->block_size == 0)
+    {
+      /* End of file: start it over.  Meanwhile return a null, or else we
+         hang on zero-length files. */
+      open_file (st);
+      if (!st->map)
+        {
+          st->block[0] = 0;
+          st->block_size = 1;
+        }
+      return;
+    }
+
+  if (io_thread_create (&ra->io, ra, read_ahead_thread, st->dpy, 0))
+    st->reading_p = True;
+}
+#endif /* READ_FILES */
 
 
 /* "The brk and sbrk functions are historical curiosities left over
@@ -284,34 +524,24 @@ open_file (state *st)
 #endif
 
 
-static unsigned int
-more_bits (state *st, scroller *sc)
+/* Fills 'out' with the next 'n' pixels of the scroller's column.
+ */
+static void
+more_bits (state *st, scroller *sc, unsigned long *out, int n)
 {
   static unsigned char *lomem = 0;
   static unsigned char *himem = 0;
   unsigned char r, g, b;
+  int i;
 
   /* vv: Each incoming byte rolls through all 4 bytes of this (it is sc->value)
          This is the number displayed at the top.
-     pv: the pixel color value.  incoming bytes land in R,G,B, or maybe just G.
+     Incoming bytes land in R,G,B, or maybe just G.
    */
-  unsigned int vv, pv;
+  unsigned int vv = sc->value;
 
-  unsigned int rmsk = st->scrollers[0].image->red_mask;
-  unsigned int gmsk = st->scrollers[0].image->green_mask;
-  unsigned int bmsk = st->scrollers[0].image->blue_mask;
-  unsigned int amsk = ~(rmsk | gmsk | bmsk);
-
-  vv = sc->value;
-
-  /* Pack RGB into a pixel according to the XImage component masks;
-     set the remaining bits to 1 for the benefit of HAVE_JWXYZ alpha.
-   */
 # undef PACK
-# define PACK() ((((r << 24) | (r << 16) | (r << 8) | r) & rmsk) | \
-                 (((g << 24) | (g << 16) | (g << 8) | g) & gmsk) | \
-                 (((b << 24) | (b << 16) | (b << 8) | b) & bmsk) | \
-                 amsk)
+# define PACK() (st->rtab[r] | st->gtab[g] | st->btab[b])
 
   switch (st->seed_mode)
     {
@@ -334,7 +564,8 @@ more_bits (state *st, scroller *sc)
         {
           /* bad craziness! give up! */
           st->seed_mode = SEED_RANDOM;
-          return 0;
+          more_bits (st, sc, out, n);
+          return;
         }
 
       /* I don't understand what's going on there, but on MacOS X, we're
@@ -351,105 +582,103 @@ more_bits (state *st, scroller *sc)
 
       if (lomem >= himem) abort();
 
-    RETRY:
-      if (sc->data >= himem)
-        sc->data = lomem;
-
-      switch (st->draw_mode)
+      for (i = 0; i < n; i++)
         {
-        case DRAW_COLOR:
-          r = *sc->data++;
-          g = *sc->data++;
-          b = *sc->data++;
-          vv = (vv << 24) | (r << 16) | (g << 8) | b;
-          break;
-        case DRAW_MONO:
-          r = 0;
-          g = *sc->data++;
-          b = 0;
-          vv = (vv << 8) | g;
-          break;
-        default:
-          abort();
-        }
+        RETRY:
+          if (sc->data >= himem)
+            sc->data = lomem;
 
-      pv = PACK();
+          switch (st->draw_mode)
+            {
+            case DRAW_COLOR:
+              r = *sc->data++;
+              g = *sc->data++;
+              b = *sc->data++;
+              vv = (vv << 24) | (r << 16) | (g << 8) | b;
+              break;
+            case DRAW_MONO:
+              r = 0;
+              g = *sc->data++;
+              b = 0;
+              vv = (vv << 8) | g;
+              break;
+            default:
+              abort();
+            }
 
-      /* avoid having many seconds of blackness: truncate zeros at 24K.
-       */
-      if (vv == 0)
-        sc->count_zero++;
-      else
-        sc->count_zero = 0;
-      if (sc->count_zero > 1024 * (st->draw_mode == DRAW_COLOR ? 24 : 8))
-        goto RETRY;
+          /* avoid having many seconds of blackness: truncate zeros at 24K.
+           */
+          if (vv == 0)
+            sc->count_zero++;
+          else
+            sc->count_zero = 0;
+          if (sc->count_zero > 1024 * (st->draw_mode == DRAW_COLOR ? 24 : 8))
+            goto RETRY;
 
+          out[i] = PACK();
+        }
       break;
 
     case SEED_RANDOM:
-      vv = random();
-      switch (st->draw_mode)
+      for (i = 0; i < n; i++)
         {
-        case DRAW_COLOR:
-          r = (vv >> 16) & 0xFF;
-          g = (vv >>  8) & 0xFF;
-          b = (vv      ) & 0xFF;
-          break;
-        case DRAW_MONO:
-          r = 0;
-          g = vv & 0xFF;
-          b = 0;
-          break;
-        default:
-          abort();
+          vv = random();
+          switch (st->draw_mode)
+            {
+            case DRAW_COLOR:
+              r = (vv >> 16) & 0xFF;
+              g = (vv >>  8) & 0xFF;
+              b = (vv      ) & 0xFF;
+              break;
+            case DRAW_MONO:
+              r = 0;
+              g = vv & 0xFF;
+              b = 0;
+              break;
+            default:
+              abort();
+            }
+          out[i] = PACK();
         }
-      pv = PACK();
       break;
 
 # ifdef READ_FILES
     case SEED_FILE:
-      {
-        int i;
 
-  /* this one returns only bytes from the file */
+      /* This returns a null at EOF -- else we hang on zero-length files. */
 # define GETC(V) \
-            do { \
-              i = fgetc (st->in); \
-            } while (i == EOF \
-                     ? (open_file (st), 1) \
-                     : 0); \
-            V = i
-
-  /* this one returns a null at EOF -- else we hang on zero-length files */
-# undef GETC
-# define GETC(V) \
-            i = fgetc (st->in); \
-            if (i == EOF) { i = 0; open_file (st); } \
-            V = i
-
-        if (!st->in)
-          open_file (st);
-
-        switch (st->draw_mode)
-          {
-          case DRAW_COLOR:
-            GETC(r);
-            GETC(g);
-            GETC(b);
-            vv = (vv << 24) | (r << 16) | (g << 8) | b;
-            break;
-          case DRAW_MONO:
-            r = 0;
-            GETC(g);
-            b = 0;
-            vv = (vv << 8) | g;
-            break;
-          default:
-            abort();
-          }
+          do { \
+            if (st->block_pos >= st->block_size) next_block (st); \
+            V = st->block[st->block_pos++]; \
+          } while (0)
+
+      if (!st->block)
+        open_file (st);
+      else if (st->map)
+        check_mapped_file (st);
+
+      for (i = 0; i < n; i++)
+        {
+          switch (st->draw_mode)
+            {
+            case DRAW_COLOR:
+              GETC(r);
+              GETC(g);
+              GETC(b);
+              vv = (vv << 24) | (r << 16) | (g << 8) | b;
+              break;
+            case DRAW_MONO:
+              r = 0;
+              GETC(g);
+              b = 0;
+              vv = (vv << 8) | g;
+              break;
+            default:
+              abort();
+            }
+          out[i] = PACK();
+        }
 # undef GETC
-        pv = PACK();
-      }
       break;
 # endif /* READ_FILES */
 
@@ -460,7 +689,6 @@ more_bits (state *st, scroller *sc)
 # undef PACK
 
   sc->value = vv;
-  return pv;
 }
 
 
@@ -514,6 +742,8 @@ memscroller_draw (Display *dpy, Window window, void *closure)
   for (i = 0; i < st->nscrollers; i++)
     {
       scroller *sc = &st->scrollers[i];
+      int rows = (sc->rect.height < sc->image->height
+                  ? sc->rect.height : sc->image->height);
       int j;
 
       XCopyArea (st->dpy, st->window, st->window, st->draw_gc,
@@ -523,15 +753,15 @@ memscroller_draw (Display *dpy, Window window, void *closure)
 
       if (sc->scroll_tick == 0)
         {
-          int top = ((sc->image->bytes_per_line * sc->rect.height) /
-                     (4 * sc->rez));
-          unsigned int *out = (unsigned int *) sc->image->data;
-          for (j = 0; j < top; j++)
+          int n = (rows + sc->rez - 1) / sc->rez;
+          int y = 0;
+          more_bits (st, sc, sc->pixels, n);
+          for (j = 0; j < n; j++)
             {
-              unsigned int v = more_bits(st, sc);
               int k;
-              for (k = 0; k < sc->rez; k++)
-                *out++ = v;
+              for (k = 0; k < sc->rez && y < rows; k++, y++)
+                sc->writer.fill (&sc->writer, 0, y, sc->speed,
+                                 sc->pixels[j]);
             }
         }
 
@@ -539,15 +769,12 @@ memscroller_draw (Display *dpy, Window window, void *closure)
       if (sc->scroll_tick * sc->speed >= sc->rez)
         sc->scroll_tick = 0;
 
-      for (j = 0; j < sc->speed; j++)
-        {
-          put_xshm_image (st->dpy, st->window, st->draw_gc, sc->image,
-                          0, 0,
-                          sc->rect.x + sc->rect.width - sc->image->width - j,
-                          sc->rect.y,
-                          sc->rect.width, sc->rect.height,
-                          &st->shm_info);
-        }
+      put_xshm_image (st->dpy, st->window, st->draw_gc, sc->image,
+                      0, 0,
+                      sc->rect.x + sc->rect.width - sc->speed,
+                      sc->rect.y,
+                      sc->speed, rows,
+                      &st->shm_info);
     }
 
   return st->delay;
@@ -576,8 +803,15 @@ memscroller_free (Display *dpy, Window window, void *closure)
   state *st = (state *) closure;
   int i;
   for (i = 0; i < st->nscrollers; i++)
-    destroy_xshm_image (dpy, st->scrollers[i].image, &st->shm_info);
+    {
+      destroy_xshm_image (dpy, st->scrollers[i].image, &st->shm_info);
+      free (st->scrollers[i].pixels);
+    }
   free (st->scrollers);
+# ifdef READ_FILES
+  close_file (st);
+  if (st->buf) free (st->buf);
+# endif
   for (i = 0; i < countof (st->fonts); i++)
     if (st->fonts[i]) XftFontClose (st->dpy, st->fonts[i]);
   if (st->filename) free (st->filename);
@@ -608,6 +842,7 @@ static const char *memscroller_defaults [] = {
 
   "*delay:		   10000",
   "*offset:		   0",
+  THREAD_DEFAULTS
   0
 };
 
@@ -619,6 +854,7 @@ static XrmOptionDescRec memscroller_options [] = {
   { "-mono",		".drawMode",		XrmoptionNoArg, "mono"     },
   { "-ram",		".filename",		XrmoptionNoArg, "(RAM)"    },
   { "-random",		".filename",		XrmoptionNoArg, "(RANDOM)" },
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
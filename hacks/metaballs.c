@@ -17,6 +17,9 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "rowwriter.h"
+#include "thread_util.h"
+#include "lanes.h"
 
 /*#define VERBOSE*/ 
 
@@ -34,18 +37,26 @@ struct state {
   char *sColor;
 
   unsigned int nBlobCount;
-  unsigned char radius;
+  int radius;
   unsigned char delta;
-  unsigned char dradius;
-  unsigned short sradius;
+  int dradius;
+  unsigned int sradius;
   unsigned char **blob;
+  short *blob_span;	/* First and last+1 nonzero column of each blob row */
   BLOB *blobs;
-  unsigned char **blub;
+  int *visible;		/* Blobs on screen this frame, in blob order */
+  int nVisible;
+
+  struct threadpool threadpool;
+  unsigned char *rows;	/* One row of the field per thread */
+  int *bands;		/* Visible blobs overlapping each thread's rows */
 
   int delay, cycles;
   signed short iColorCount;
   unsigned long *aiColorVals;
+  unsigned long pixels[256];	/* aiColorVals, saturating at the last one */
   XImage *pImage;
+  row_writer writer;
   GC gc;
   int draw_i;
 };
@@ -60,13 +71,91 @@ static void init_blob(struct state *st, BLOB *blob)
   blob->ypos = st->iWinHeight/4 + BELLRAND(st->iWinHeight/2) - st->radius;
 }
 
-static void Execute( struct state *st )
+/* The field is the sum of the blobs covering each pixel, saturating at
+   the last colour.  Since that doesn't depend on the order the blobs are
+   added in, each thread builds its own rows of the screen from scratch:
+   clear a row, add in the clipped rows of every blob that crosses it,
+   and write it through the palette.  The row never leaves the cache.
+
+   The sum saturates at 255 here, and at iColorCount-1 in st->pixels,
+   which repeats the last colour through the rest of its 256 entries.
+   Rows are added LANES pixels at a time, then once more for the rest,
+   which the compiler turns into saturating vector adds; see lanes.h.
+ */
+
+static INLINE void
+add_cells (unsigned char *RESTRICT acc, const unsigned char *RESTRICT b,
+           int n)
 {
-	int i, j, k;
+  int j;
+  for (j = 0; j < n; j++)
+    {
+      unsigned int v = acc[j] + b[j];
+      acc[j] = (v > 255 ? 255 : v);
+    }
+}
+
+static void
+add_row (unsigned char *acc, const unsigned char *b, int n)
+{
+  int j;
+  for (j = 0; j + LANES <= n; j += LANES)
+    add_cells (acc + j, b + j, LANES);
+  add_cells (acc + j, b + j, n - j);
+}
+
 
-	/* clear st->blub array */
-	for (i = 0; i < st->iWinHeight; ++i)
-	  memset(st->blub[i], 0, st->iWinWidth * sizeof(unsigned char));
+struct metaballs_thread {
+  struct state *st;
+  unsigned id;
+};
+
+static void
+metaballs_thread_run (void *self)
+{
+  const struct metaballs_thread *t = (const struct metaballs_thread *) self;
+  struct state *st = t->st;
+  unsigned n = st->threadpool.count;
+  int y0 = st->iWinHeight * t->id / n;
+  int y1 = st->iWinHeight * (t->id + 1) / n;
+  int w = st->iWinWidth;
+  unsigned char *row = st->rows + w * t->id;
+  int *band = st->bands + st->nBlobCount * t->id;
+  int nband = 0;
+  int y, k;
+
+  for (k = 0; k < st->nVisible; k++)
+    {
+      const BLOB *b = &st->blobs[st->visible[k]];
+      if (b->ypos < y1 && b->ypos + st->dradius > y0)
+        band[nband++] = st->visible[k];
+    }
+
+  for (y = y0; y < y1; y++)
+    {
+      memset (row, 0, w);
+      for (k = 0; k < nband; k++)
+        {
+          const BLOB *b = &st->blobs[band[k]];
+          int i = y - b->ypos;
+          int x0, x1;
+          if (i < 0 || i >= st->dradius)
+            continue;
+          x0 = b->xpos + st->blob_span[i * 2];
+          x1 = b->xpos + st->blob_span[i * 2 + 1];
+          if (x0 < 0) x0 = 0;
+          if (x1 > w) x1 = w;
+          if (x0 < x1)
+            add_row (row + x0, st->blob[i] + (x0 - b->xpos), x1 - x0);
+        }
+      st->writer.indexed (&st->writer, 0, y, w, row, st->pixels);
+    }
+}
+
+
+static void Execute( struct state *st )
+{
+	int i, k;
 
 	/* move st->blobs */
 	for (i = 0; i < st->nBlobCount; i++)
@@ -75,46 +164,19 @@ static void Execute( struct state *st )
 	  st->blobs[i].ypos += -st->delta + (int)((st->delta + .5f) * frand(2.0));
 	}
 
-	/* draw st->blobs to st->blub array */
+	/* pick out the visible st->blobs, and restart the others */
+	st->nVisible = 0;
 	for (k = 0; k < st->nBlobCount; ++k)
 	  { 
 	    if (st->blobs[k].ypos > -st->dradius && st->blobs[k].xpos > -st->dradius && st->blobs[k].ypos < st->iWinHeight && st->blobs[k].xpos < st->iWinWidth)
-	      {
-		for (i = 0; i < st->dradius; ++i)
-		  {
-		    if (st->blobs[k].ypos + i >= 0 && st->blobs[k].ypos + i < st->iWinHeight)
-		      {
-			for (j = 0; j < st->dradius; ++j)
-			  {
-			    if (st->blobs[k].xpos + j >= 0 && st->blobs[k].xpos + j < st->iWinWidth)
-			      {
-				if (st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] < st->iColorCount-1)
-				  {
-				    if (st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] + st->blob[i][j] > st->iColorCount-1)
-				      st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] = st->iColorCount-1;
-				    else 
-				      st->blub[st->blobs[k].ypos + i][st->blobs[k].xpos + j] += st->blob[i][j];     
-				  }
-			      }
-			  }
-		      }
-		  }
-	      }
+	      st->visible[st->nVisible++] = k;
 	    else
 	      init_blob(st, st->blobs + k);
 	  }
 
-	memset( st->pImage->data, 0, st->pImage->bytes_per_line * st->pImage->height);
-
-	/* draw st->blub array to screen */
-	for (i = 0; i < st->iWinHeight; ++i)
-	  {
-	    for (j = 0; j < st->iWinWidth; ++j)
-	      {
-		if (st->aiColorVals[st->blub[i][j]] > 0)
-		  XPutPixel( st->pImage, j, i, st->aiColorVals[st->blub[i][j]] );
-	      }
-	  }
+	/* sum them up and draw, in bands of rows */
+	threadpool_run( &st->threadpool, metaballs_thread_run );
+	threadpool_wait( &st->threadpool );
 
 	XPutImage( st->dpy, st->window, st->gc, st->pImage,
 		   0, 0, 0, 0, st->iWinWidth, st->iWinHeight );
@@ -190,6 +252,9 @@ static unsigned long * SetPalette(struct state *st )
 
 	free( aColors );
 
+	for( iColor=0; iColor < 256; iColor++ )
+		st->pixels[ iColor ] = st->aiColorVals[ iColor < st->iColorCount ? iColor : st->iColorCount-1 ];
+
 	XSetWindowBackground( st->dpy, st->window, st->aiColorVals[ 0 ] );
 
 	return st->aiColorVals;
@@ -229,6 +294,7 @@ static void Initialize( struct state *st )
 	st->pImage = XCreateImage( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap, 0, NULL,
 							  XWinAttribs.width, XWinAttribs.height, BitmapPad( st->dpy ), 0 );
 	(st->pImage)->data = calloc((st->pImage)->bytes_per_line, (st->pImage)->height);
+	init_row_writer( &st->writer, st->pImage );
 
 	st->iWinWidth = XWinAttribs.width;
 	st->iWinHeight = XWinAttribs.height;
@@ -251,8 +317,6 @@ static void Initialize( struct state *st )
 	  st->radius = 100;
 	
 	st->radius = (st->radius / 100.0) * (st->iWinHeight >> 3);
-        if (st->radius >= 128) /* should use UCHAR_MAX? */
-          st->radius = 127; /* st->dradius should fit in u_char */
 
         if (st->iWinWidth < 100 || st->iWinHeight < 100) /* tiny window */
           if (st->radius < 20)
@@ -266,10 +330,17 @@ static void Initialize( struct state *st )
 	for (i = 0; i < st->dradius; ++i)
 	  st->blob[i] = malloc( st->dradius * sizeof(unsigned char));
 
-	/* create st->blub array */
-	st->blub = malloc( st->iWinHeight * sizeof(unsigned char*));
-	for (i = 0; i < st->iWinHeight; ++i)
-	  st->blub[i] = malloc( st->iWinWidth * sizeof(unsigned char));
+	st->blob_span = malloc ( st->dradius * 2 * sizeof(short));
+
+	/* one row of the field, and a list of blobs, for each thread */
+	st->rows = malloc( st->iWinWidth * st->threadpool.count );
+	st->bands = malloc( st->nBlobCount * st->threadpool.count * sizeof(int));
+	st->visible = malloc( st->nBlobCount * sizeof(int));
+	if (!st->rows || !st->bands || !st->visible)
+	  {
+	    fprintf( stderr, "%s: out of memory\n", progname );
+	    exit(1);
+	  }
 
 	/* create st->blob */
 	for (i = -st->radius; i < st->radius; ++i)
@@ -289,6 +360,16 @@ static void Initialize( struct state *st )
 		  }
 	      }    
 	  }
+
+	/* only the nonzero part of each row needs adding in */
+	for (i = 0; i < st->dradius; ++i)
+	  {
+	    int x0 = 0, x1 = st->dradius;
+	    while (x0 < x1 && !st->blob[i][x0]) x0++;
+	    while (x1 > x0 && !st->blob[i][x1-1]) x1--;
+	    st->blob_span[i * 2]     = x0;
+	    st->blob_span[i * 2 + 1] = x1;
+	  }
 	
 	for (i = 0; i < st->nBlobCount; i++)
 	  {
@@ -296,10 +377,26 @@ static void Initialize( struct state *st )
 	  }
 }
 
+static int
+metaballs_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct metaballs_thread *t = (struct metaballs_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
 static void *
 metaballs_init (Display *dpy, Window window)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct metaballs_thread),
+    metaballs_thread_create,
+    0
+  };
+
   struct state *st = (struct state *) calloc (1, sizeof(*st));
+  int err;
 #ifdef VERBOSE
   time_t nTime = time( NULL );
   unsigned short iFrame = 0;
@@ -309,7 +406,7 @@ metaballs_init (Display *dpy, Window window)
   st->window = window;
 
   st->nBlobCount = get_integer_resource(st->dpy,  "count", "Integer" );
-  if( st->nBlobCount > 255 ) st->nBlobCount = 255;
+  if( st->nBlobCount > 1000 ) st->nBlobCount = 1000;
   if( st->nBlobCount <  2 ) st->nBlobCount = 2;
 
   if( ( st->blobs = calloc( st->nBlobCount, sizeof(BLOB) ) ) == NULL )
@@ -321,6 +418,11 @@ metaballs_init (Display *dpy, Window window)
   printf( "%s: Allocated %d Blobs\n", progname, st->nBlobCount );
 #endif  /*  VERBOSE */
 
+  err = threadpool_create (&st->threadpool, &cls, dpy,
+                           hardware_concurrency (dpy));
+  if (err)
+    threadpool_fatal (progname, err);
+
   Initialize( st );
 
   st->delay = get_integer_resource(st->dpy,  "delay", "Integer" );
@@ -388,12 +490,14 @@ metaballs_free (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
   int i;
+  threadpool_destroy (&st->threadpool);
   if (st->pImage) XDestroyImage (st->pImage);
   free (st->aiColorVals);
   free (st->blobs);
-  for (i = 0; i < st->iWinHeight; ++i)
-    free (st->blub[i]);
-  free (st->blub);
+  free (st->visible);
+  free (st->rows);
+  free (st->bands);
+  free (st->blob_span);
   for (i = 0; i < st->dradius; ++i)
     free (st->blob[i]);
   if (st->sColor) free (st->sColor);
@@ -413,6 +517,7 @@ static const char *metaballs_defaults [] = {
   "*delay:    10000",
   "*radius:   100",
   "*delta:   3",
+  THREAD_DEFAULTS
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
@@ -427,6 +532,7 @@ static XrmOptionDescRec metaballs_options [] = {
   { "-cycles",  ".cycles",  XrmoptionSepArg, 0 },
   { "-radius",  ".radius",  XrmoptionSepArg, 0 },
   { "-delta",  ".delta",  XrmoptionSepArg, 0 },
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -0,0 +1,476 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * Accumulating point clouds into an image: see pointcloud.h.
+ */
+
+#include <limits.h>
+#include <math.h>
+
+#include "screenhackI.h"
+#include "rowwriter.h"
+#include "xshm.h"
+#include "pointcloud.h"
+#include "lanes.h"
+
+#undef MIN
+#undef MAX
+#define MIN(A,B) ((A) < (B) ? (A) : (B))
+#define MAX(A,B) ((A) > (B) ? (A) : (B))
+
+#define CHUNK 1024	/* Points converted at once by pointcloud_add. */
+#define GAMMA 0.5	/* Lifts sparse pixels in -log-density mode. */
+
+struct pointcloud {
+  Display *dpy;
+  int width, height, dot;
+  unsigned size;		/* Also the cell that off-window points go to. */
+
+  unsigned short *density;	/* size + 1 of each */
+  unsigned short *color;
+
+  int ncolors;
+  unsigned long *pixels;
+  unsigned char *rgb;		/* 3 per color */
+  unsigned long background;
+  unsigned char background_rgb[3];
+  Colormap cmap;
+
+  Bool log_density;
+  unsigned saturation;		/* Drawn at full brightness; a power of 2. */
+  unsigned char *levels;	/* saturation + 1 of them */
+
+  /* Inclusive bounds of every point since the last clear, and of what was
+     drawn the last time.  Empty when x0 > x1. */
+  int extent[4], painted[4];
+
+  XImage *image;
+  XShmSegmentInfo shm_info;
+  row_writer writer;
+  unsigned long *row_pixels;
+  unsigned char *row_rgb;
+
+  unsigned cells[CHUNK];
+};
+
+
+static void
+empty_box (int *box)
+{
+  box[0] = box[1] = INT_MAX;
+  box[2] = box[3] = -1;
+}
+
+
+static void *
+alloc_or_die (size_t size)
+{
+  void *p = calloc (1, size);
+  if (!p)
+    {
+      fprintf (stderr, "%s: out of memory\n", progname);
+      exit (1);
+    }
+  return p;
+}
+
+
+pointcloud *
+pointcloud_new (Display *dpy, Window window, int dot)
+{
+  pointcloud *pc = (pointcloud *) alloc_or_die (sizeof(*pc));
+  XWindowAttributes xgwa;
+  unsigned long white;
+
+  XGetWindowAttributes (dpy, window, &xgwa);
+
+  pc->dpy = dpy;
+  pc->width  = xgwa.width  > 0 ? xgwa.width  : 1;
+  pc->height = xgwa.height > 0 ? xgwa.height : 1;
+  pc->dot = dot < 1 ? 1 : dot;
+  pc->size = pc->width * pc->height;
+  pc->cmap = xgwa.colormap;
+
+  pc->density = (unsigned short *)
+    alloc_or_die ((pc->size + 1) * sizeof(*pc->density));
+  pc->color = (unsigned short *)
+    alloc_or_die ((pc->size + 1) * sizeof(*pc->color));
+
+  pc->log_density = (get_boolean_resource (dpy, "logDensity", "Boolean") &&
+                     visual_class (xgwa.screen, xgwa.visual) == TrueColor);
+
+  pc->image = create_xshm_image (dpy, xgwa.visual, xgwa.depth, ZPixmap,
+                                 &pc->shm_info, pc->width, pc->height);
+  if (!pc->image)
+    {
+      fprintf (stderr, "%s: out of memory\n", progname);
+      exit (1);
+    }
+  init_row_writer (&pc->writer, pc->image);
+  pc->row_pixels = (unsigned long *)
+    alloc_or_die (pc->width * sizeof(*pc->row_pixels));
+  pc->row_rgb = (unsigned char *) alloc_or_die (pc->width * 3);
+
+  empty_box (pc->extent);
+  empty_box (pc->painted);
+
+  white = WhitePixelOfScreen (xgwa.screen);
+  pointcloud_colors (pc, 1, &white, BlackPixelOfScreen (xgwa.screen));
+  return pc;
+}
+
+
+void
+pointcloud_free (pointcloud *pc)
+{
+  if (!pc) return;
+  destroy_xshm_image (pc->dpy, pc->image, &pc->shm_info);
+  free (pc->density);
+  free (pc->color);
+  free (pc->pixels);
+  free (pc->rgb);
+  free (pc->levels);
+  free (pc->row_pixels);
+  free (pc->row_rgb);
+  free (pc);
+}
+
+
+void
+pointcloud_colors (pointcloud *pc, int count, const unsigned long *pixels,
+                   unsigned long background)
+{
+  XColor *colors;
+  int i;
+
+  if (count < 1) abort();
+
+  free (pc->pixels);
+  free (pc->rgb);
+  pc->ncolors = count;
+  pc->pixels = (unsigned long *) alloc_or_die (count * sizeof(*pc->pixels));
+  pc->rgb = (unsigned char *) alloc_or_die (count * 3);
+  memcpy (pc->pixels, pixels, count * sizeof(*pc->pixels));
+  pc->background = background;
+
+  /* Only -log-density needs the RGB values, and it's one round trip. */
+  if (pc->log_density)
+    {
+      colors = (XColor *) alloc_or_die ((count + 1) * sizeof(*colors));
+      for (i = 0; i < count; i++)
+        colors[i].pixel = pixels[i];
+      colors[count].pixel = background;
+      XQueryColors (pc->dpy, pc->cmap, colors, count + 1);
+      for (i = 0; i < count; i++)
+        {
+          pc->rgb[i*3]   = colors[i].red   >> 8;
+          pc->rgb[i*3+1] = colors[i].green >> 8;
+          pc->rgb[i*3+2] = colors[i].blue  >> 8;
+        }
+      pc->background_rgb[0] = colors[count].red   >> 8;
+      pc->background_rgb[1] = colors[count].green >> 8;
+      pc->background_rgb[2] = colors[count].blue  >> 8;
+      free (colors);
+    }
+}
+
+
+void
+pointcloud_clear (pointcloud *pc)
+{
+  int *e = pc->extent;
+  int y;
+  if (e[0] > e[2]) return;
+  for (y = e[1]; y <= e[3]; y++)
+    memset (pc->density + y * pc->width + e[0], 0,
+            (e[2] - e[0] + 1) * sizeof(*pc->density));
+  empty_box (e);
+}
+
+
+/* The cell of each point, or 'size' if it's off the window, and the bounds
+   of the ones that aren't.  There are no branches, and like the other
+   loops over arrays here, it's run LANES at a time and then once more for
+   the rest; see lanes.h.
+ */
+
+static INLINE void
+cell_lanes (unsigned width, unsigned height, unsigned size, int count,
+            const int *RESTRICT x, const int *RESTRICT y,
+            unsigned *RESTRICT cells, int *RESTRICT box)
+{
+  int x0 = box[0], y0 = box[1], x1 = box[2], y1 = box[3];
+  int i;
+  for (i = 0; i < count; i++)
+    {
+      /* All ones if off the window: masks rather than ?: keep GCC happy. */
+      int xi = x[i], yi = y[i];
+      int out = -(((unsigned) xi >= width) | ((unsigned) yi >= height));
+      cells[i] = (((unsigned) yi * width + xi) & ~out) | (size & out);
+      x0 = MIN (x0, (xi & ~out) | (INT_MAX & out));
+      y0 = MIN (y0, (yi & ~out) | (INT_MAX & out));
+      x1 = MAX (x1, xi | out);
+      y1 = MAX (y1, yi | out);
+    }
+  box[0] = x0; box[1] = y0; box[2] = x1; box[3] = y1;
+}
+
+static void
+find_cells (unsigned width, unsigned height, unsigned size, int count,
+            const int *x, const int *y, unsigned *cells, int *box)
+{
+  int i;
+  for (i = 0; i + LANES <= count; i += LANES)
+    cell_lanes (width, height, size, LANES, x + i, y + i, cells + i, box);
+  cell_lanes (width, height, size, count - i, x + i, y + i, cells + i, box);
+}
+
+
+void
+pointcloud_cells (pointcloud *pc, int count, const int *x, const int *y,
+                  unsigned *cells)
+{
+  int *e = pc->extent;
+  int box[4];
+
+  empty_box (box);
+  find_cells (pc->width, pc->height, pc->size, count, x, y, cells, box);
+  if (box[0] > box[2]) return;
+
+  box[2] = MIN (box[2] + pc->dot - 1, pc->width - 1);
+  box[3] = MIN (box[3] + pc->dot - 1, pc->height - 1);
+  e[0] = MIN (e[0], box[0]);
+  e[1] = MIN (e[1], box[1]);
+  e[2] = MAX (e[2], box[2]);
+  e[3] = MAX (e[3], box[3]);
+}
+
+
+/* Adds 'delta' to the dot x dot block at each cell: the slow path for
+   Retina displays. */
+static void
+plot_dots (pointcloud *pc, int count, const unsigned *cells, int color,
+           int delta)
+{
+  int i, dx, dy;
+  for (i = 0; i < count; i++)
+    {
+      unsigned c = cells[i];
+      int cx, cy;
+      if (c == pc->size) continue;
+      cx = c % pc->width;
+      cy = c / pc->width;
+      for (dy = 0; dy < pc->dot && cy + dy < pc->height; dy++)
+        for (dx = 0; dx < pc->dot && cx + dx < pc->width; dx++)
+          {
+            unsigned k = c + dy * pc->width + dx;
+            unsigned short d = pc->density[k];
+            if (delta > 0)
+              {
+                pc->density[k] = d + (d != USHRT_MAX);
+                pc->color[k] = color;
+              }
+            else
+              pc->density[k] = d - (d != 0);
+          }
+    }
+}
+
+
+void
+pointcloud_plot (pointcloud *pc, int count, const unsigned *cells, int color)
+{
+  unsigned short *RESTRICT density = pc->density;
+  unsigned short *RESTRICT colors = pc->color;
+  int i;
+
+  if (pc->dot > 1)
+    {
+      plot_dots (pc, count, cells, color, 1);
+      return;
+    }
+
+  /* Off-window points all land on the spare cell at the end. */
+  for (i = 0; i < count; i++)
+    {
+      unsigned c = cells[i];
+      unsigned short d = density[c];
+      density[c] = d + (d != USHRT_MAX);
+      colors[c] = color;
+    }
+}
+
+
+void
+pointcloud_unplot (pointcloud *pc, int count, const unsigned *cells)
+{
+  unsigned short *RESTRICT density = pc->density;
+  int i;
+
+  if (pc->dot > 1)
+    {
+      plot_dots (pc, count, cells, 0, -1);
+      return;
+    }
+
+  /* A saturated pixel stays lit a little longer than it should. */
+  for (i = 0; i < count; i++)
+    {
+      unsigned c = cells[i];
+      unsigned short d = density[c];
+      density[c] = d - (d != 0);
+    }
+}
+
+
+void
+pointcloud_add (pointcloud *pc, int count, const int *x, const int *y,
+                int color)
+{
+  while (count > 0)
+    {
+      int n = count < CHUNK ? count : CHUNK;
+      pointcloud_cells (pc, n, x, y, pc->cells);
+      pointcloud_plot (pc, n, pc->cells, color);
+      x += n;
+      y += n;
+      count -= n;
+    }
+}
+
+
+static INLINE unsigned
+max_lanes (const unsigned short *RESTRICT density, int count, unsigned m)
+{
+  int i;
+  for (i = 0; i < count; i++)
+    m = MAX (m, density[i]);
+  return m;
+}
+
+static unsigned
+max_density (const unsigned short *density, int count)
+{
+  unsigned m = 0;
+  int i;
+  for (i = 0; i + LANES <= count; i += LANES)
+    m = max_lanes (density + i, LANES, m);
+  return max_lanes (density + i, count - i, m);
+}
+
+
+/* Pixels in the color of the last point to land on them. */
+static INLINE void
+flat_lanes (const unsigned short *RESTRICT density,
+            const unsigned short *RESTRICT color,
+            const unsigned long *RESTRICT pixels, unsigned long background,
+            int count, unsigned long *RESTRICT out)
+{
+  int i;
+  for (i = 0; i < count; i++)
+    out[i] = density[i] ? pixels[color[i]] : background;
+}
+
+static void
+flat_row (const unsigned short *density, const unsigned short *color,
+          const unsigned long *pixels, unsigned long background,
+          int count, unsigned long *out)
+{
+  int i;
+  for (i = 0; i + LANES <= count; i += LANES)
+    flat_lanes (density + i, color + i, pixels, background, LANES, out + i);
+  flat_lanes (density + i, color + i, pixels, background, count - i, out + i);
+}
+
+
+/* The same, faded towards the background by log density. */
+static void
+shaded_row (const unsigned short *RESTRICT density,
+            const unsigned short *RESTRICT color,
+            const unsigned char *RESTRICT rgb,
+            const unsigned char *RESTRICT background,
+            const unsigned char *RESTRICT levels,
+            int count, unsigned char *RESTRICT out)
+{
+  int i, k;
+  for (i = 0; i < count; i++)
+    {
+      unsigned level = levels[density[i]];
+      const unsigned char *c = rgb + color[i] * 3;
+      for (k = 0; k < 3; k++)
+        out[i*3+k] = (c[k] * level + background[k] * (255 - level)) / 255;
+    }
+}
+
+
+static void
+update_levels (pointcloud *pc, unsigned max)
+{
+  unsigned sat = 1;
+  unsigned i;
+  while (sat < max)
+    sat <<= 1;
+  if (sat == pc->saturation) return;
+
+  free (pc->levels);
+  pc->levels = (unsigned char *) alloc_or_die (sat + 1);
+  pc->saturation = sat;
+  for (i = 1; i <= sat; i++)
+    pc->levels[i] = 255 * pow (log (1.0 + i) / log (1.0 + sat), GAMMA) + 0.5;
+}
+
+
+void
+pointcloud_render (pointcloud *pc, Drawable d, GC gc)
+{
+  const int *e = pc->extent, *p = pc->painted;
+  int x0, y0, x1, y1, w, y;
+
+  if (e[0] > e[2] && p[0] > p[2])
+    return;
+  x0 = MIN (e[0], p[0]);
+  y0 = MIN (e[1], p[1]);
+  x1 = MAX (e[2], p[2]);
+  y1 = MAX (e[3], p[3]);
+  w = x1 - x0 + 1;
+
+  if (pc->log_density)
+    {
+      unsigned max = 0;
+      for (y = y0; y <= y1; y++)
+        {
+          unsigned m = max_density (pc->density + y * pc->width + x0, w);
+          if (m > max) max = m;
+        }
+      update_levels (pc, max);
+    }
+
+  for (y = y0; y <= y1; y++)
+    {
+      const unsigned short *density = pc->density + y * pc->width + x0;
+      const unsigned short *color = pc->color + y * pc->width + x0;
+      if (pc->log_density)
+        {
+          shaded_row (density, color, pc->rgb, pc->background_rgb,
+                      pc->levels, w, pc->row_rgb);
+          pc->writer.rgb (&pc->writer, x0, y, w, pc->row_rgb);
+        }
+      else
+        {
+          flat_row (density, color, pc->pixels, pc->background, w,
+                    pc->row_pixels);
+          pc->writer.pixels (&pc->writer, x0, y, w, pc->row_pixels);
+        }
+    }
+
+  put_xshm_image (pc->dpy, d, gc, pc->image, x0, y0, x0, y0, w, y1 - y0 + 1,
+                  &pc->shm_info);
+  memcpy (pc->painted, pc->extent, sizeof(pc->painted));
+}
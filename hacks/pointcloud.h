@@ -0,0 +1,75 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* Accumulating point clouds into an image.
+
+   Hacks like julia, hopalong, ifs, flame and thornbird compute thousands of
+   points per frame and used to hand them to XFillRectangles a few at a
+   time, which made the X server the bottleneck long before the math was.
+   Instead, they add their points to a pointcloud: a density buffer the
+   size of the window, one counter and one color index per pixel.  Points
+   are added in batches; the coordinate checks are plain loops over arrays
+   that the compiler vectorizes, leaving only the increments themselves as
+   scattered stores.  Once per frame, pointcloud_render() converts the part
+   of the buffer that has been drawn on into pixels and puts it on the
+   window with a single XPutImage (or XShmPutImage).
+
+   By default a pixel is drawn in the color of the last point that landed on
+   it, which looks exactly like the rectangles did.  With -log-density, it
+   is shaded by how many points landed on it instead, on a log scale, so
+   that plotting many more points shows the structure of the attractor
+   rather than just a solid blob.
+ */
+
+#ifndef __XSCREENSAVER_POINTCLOUD_H__
+#define __XSCREENSAVER_POINTCLOUD_H__
+
+typedef struct pointcloud pointcloud;
+
+#define POINTCLOUD_DEFAULTS       "*logDensity: False",
+#define POINTCLOUD_DEFAULTS_XLOCK "*logDensity: False\n"
+#define POINTCLOUD_OPTIONS \
+	{"-log-density",    ".logDensity", XrmoptionNoArg, "True"}, \
+	{"-no-log-density", ".logDensity", XrmoptionNoArg, "False"},
+
+/* Creates a density buffer the size of the window.  Each point covers
+   dot x dot pixels, for the benefit of Retina displays. */
+extern pointcloud *pointcloud_new (Display *, Window, int dot);
+extern void pointcloud_free (pointcloud *);
+
+/* The colors that points can be drawn in, and the color of empty pixels.
+   Color arguments below are indexes into 'pixels'. */
+extern void pointcloud_colors (pointcloud *, int count,
+                               const unsigned long *pixels,
+                               unsigned long background);
+
+/* Removes all points.  The window is repainted at the next render. */
+extern void pointcloud_clear (pointcloud *);
+
+/* Adds 'count' points at the given window coordinates.  Points outside
+   the window are ignored. */
+extern void pointcloud_add (pointcloud *, int count,
+                            const int *x, const int *y, int color);
+
+/* The same in two steps, for hacks that take their points away again
+   later: pointcloud_cells() turns coordinates into cell numbers, which
+   can be saved and passed to pointcloud_plot() and pointcloud_unplot(). */
+extern void pointcloud_cells (pointcloud *, int count,
+                              const int *x, const int *y, unsigned *cells);
+extern void pointcloud_plot (pointcloud *, int count, const unsigned *cells,
+                             int color);
+extern void pointcloud_unplot (pointcloud *, int count,
+                               const unsigned *cells);
+
+/* Draws everything that changed since the last call. */
+extern void pointcloud_render (pointcloud *, Drawable, GC);
+
+#endif /* __XSCREENSAVER_POINTCLOUD_H__ */
@@ -21,6 +21,9 @@
 
 #include "screenhack.h"
 #include "xshm.h"
+#include "rowwriter.h"
+#include "thread_util.h"
+#include "lanes.h"
 
 /* costs ~6% speed */
 #define dither_when_mapped 1
@@ -37,7 +40,9 @@ struct state {
 #endif
   Colormap cmap;
   int mapped;
-  int pdepth;
+  Bool dither;
+  Bool tile;
+  unsigned long pixels[256];
 
   int frame, epoch_time;
   unsigned short *r1, *r2, *r1b, *r2b;
@@ -46,10 +51,13 @@ struct state {
   int reaction;
   int diffusion;
 
-  char *pd;
   int array_width, array_height;
 
   XShmSegmentInfo shm_info;
+  row_writer writer;
+
+  struct threadpool threadpool;
+  unsigned char *indexes;	/* One row per thread. */
 
   GC gc;
   XImage *image;
@@ -59,13 +67,18 @@ struct state {
   int delay;
 };
 
+struct rd_thread {
+  struct state *st;
+  unsigned id;
+};
+
 static void random_colors(struct state *st);
 
 /* -----------------------------------------------------------
    pixel hack, 8-bit pixel grid, first/next frame interface
 
    pixack_init(int *size_h, int *size_v)
-   pixack_frame(char *pix_buf)
+   pixack_frame()
    */
 
 
@@ -85,8 +98,13 @@ static void random_colors(struct state *st);
 static void
 pixack_init(struct state *st, int *size_h, int *size_v) 
 {
-  st->width  = get_integer_resource (st->dpy, "width",  "Integer");
-  st->height = get_integer_resource (st->dpy, "height", "Integer");
+  if (st->tile) {
+    st->width  = get_integer_resource (st->dpy, "width",  "Integer");
+    st->height = get_integer_resource (st->dpy, "height", "Integer");
+  } else {
+    st->width  = st->xgwa.width;
+    st->height = st->xgwa.height;
+  }
 
   if (st->width <= 0 && st->height <= 0 && (R & 1))
     st->width = st->height = 64 + BELLRAND(512);
@@ -122,20 +140,136 @@ pixack_init(struct state *st, int *size_h, int *size_v)
   *size_v = st->height;
 }
 
-#define test_pattern_hyper 0
+/* The diffusion and reaction steps, each in three flavors.  r1 and r2 are
+   ints so that the sums don't overflow.
+ */
+#define DIFFUSE_0							\
+  r1 = (i1[j] + i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2]) / 5;		\
+  r2 = ((i2[j]<<3) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) / 12
+#define DIFFUSE_1							\
+  r1 = (i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2]) >> 2;			\
+  r2 = ((i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) >> 3
+#define DIFFUSE_2							\
+  r1 = ((i1[j]<<1) + (i1[j+1]<<1) + (i1[j-1]<<1) +			\
+        i1[j+w2] + i1[j-w2]) >> 3;					\
+  r2 = ((i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2]) >> 3
+
+/* John E. Pearson "Complex Patterns in a Simple System"
+   Science, July 1993 */
+#define REACT_0								\
+  r1 += 4 * (((28 * (mx-r1)) >> 10) - uvv);				\
+  r2 += 4 * (uvv - ((80 * r2) >> 10))
+#define REACT_1								\
+  r1 += 3 * (((27 * (mx-r1)) >> 10) - uvv);				\
+  r2 += 3 * (uvv - ((80 * r2) >> 10))
+#define REACT_2								\
+  r1 += 2 * (((28 * (mx-r1)) >> 10) - uvv);				\
+  r2 += 3 * (uvv - ((80 * r2) >> 10))
+
+/* The rows are handed to rd_cells LANES cells at a time, then once more
+   for the remainder; see lanes.h.  That needs the switches on diffusion
+   and reaction to be out of the loop.
+ */
+
+#define RD_ROW(D,R)							\
+static INLINE void							\
+rd_cells_##D##R (unsigned short *RESTRICT o1,				\
+                 unsigned short *RESTRICT o2,				\
+                 const unsigned short *RESTRICT i1,			\
+                 const unsigned short *RESTRICT i2, int w2, int n)	\
+{									\
+  int j;								\
+  for (j = 0; j < n; j++) {						\
+    int uvv, r1, r2;							\
+    DIFFUSE_##D;							\
+    /* uvv = (((r1 * r2) >> bps) * r2) >> bps; */			\
+    /* avoid signed integer overflow */					\
+    uvv = ((((r1 >> 1)* r2) >> bps) * r2) >> (bps - 1);		\
+    REACT_##R;								\
+    o1[j] = (r1 < 0 ? 0 : r1 > mx ? mx : r1);				\
+    o2[j] = (r2 < 0 ? 0 : r2 > mx ? mx : r2);				\
+  }									\
+}									\
+									\
+static void								\
+rd_row_##D##R (unsigned short *o1, unsigned short *o2,			\
+               const unsigned short *i1, const unsigned short *i2,	\
+               int w2, int n)						\
+{									\
+  int j;								\
+  for (j = 0; j + LANES <= n; j += LANES)				\
+    rd_cells_##D##R (o1 + j, o2 + j, i1 + j, i2 + j, w2, LANES);	\
+  rd_cells_##D##R (o1 + j, o2 + j, i1 + j, i2 + j, w2, n - j);		\
+}
+
+RD_ROW (0,0) RD_ROW (0,1) RD_ROW (0,2)
+RD_ROW (1,0) RD_ROW (1,1) RD_ROW (1,2)
+RD_ROW (2,0) RD_ROW (2,1) RD_ROW (2,2)
+
+typedef void (*rd_row_fn) (unsigned short *, unsigned short *,
+                           const unsigned short *, const unsigned short *,
+                           int, int);
+
+static const rd_row_fn rd_rows[3][3] = {	/* [diffusion][reaction] */
+  { rd_row_00, rd_row_01, rd_row_02 },
+  { rd_row_10, rd_row_11, rd_row_12 },
+  { rd_row_20, rd_row_21, rd_row_22 },
+};
+
+
+/* Computes rows y0 through y1-1 of the next generation into r1b and r2b,
+   and draws them.  Only reads r1 and r2, so bands of rows can go on
+   different threads.
+ */
+static void
+pixack_rows (struct state *st, int y0, int y1, unsigned char *idx)
+{
+  int i, j;
+  int w2 = st->width + 2;
+  rd_row_fn row = rd_rows[st->diffusion][st->reaction];
+
+  for (i = y0; i < y1; i++) {
+    int ii = i + 1;
+    unsigned short *i1 = st->r1 + 1 + w2 * ii;
+    unsigned short *i2 = st->r2 + 1 + w2 * ii;
+    unsigned short *o1 = st->r1b + 1 + w2 * ii;
+    unsigned short *o2 = st->r2b + 1 + w2 * ii;
+
+    row (o1, o2, i1, i2, w2, st->width);
+
+    /* this is terrible.  here i want to assume ncolors = 256. */
+    if (st->dither)
+      for (j = 0; j < st->width; j++)
+        idx[j] = st->mc[o1[j]];
+    else
+      for (j = 0; j < st->width; j++)
+        idx[j] = o1[j] >> 8;
+
+    st->writer.indexed (&st->writer, 0, i, st->width, idx, st->pixels);
+  }
+}
+
+
+static void
+pixack_thread_run (void *self)
+{
+  const struct rd_thread *t = (const struct rd_thread *) self;
+  struct state *st = t->st;
+  unsigned n = st->threadpool.count;
+  pixack_rows (st,
+               st->height * t->id / n,
+               st->height * (t->id + 1) / n,
+               st->indexes + st->width * t->id);
+}
 
 
 /* returns the pixels.  called many times. */
 static void
-pixack_frame(struct state *st, char *pix_buf) 
+pixack_frame(struct state *st)
 {
   int i, j;
   int w2 = st->width + 2;
   unsigned short *t;
-#if test_pattern_hyper
-  if (st->frame&0x100)
-    sleep(1);
-#endif
 
   if (!(st->frame%st->epoch_time)) {
     int s;
@@ -147,6 +281,8 @@ pixack_frame(struct state *st, char *pix_buf)
     }
 
     random_colors(st);
+    for (i = 0; i < countof(st->pixels); i++)
+      st->pixels[i] = st->colors[i % st->ncolors].pixel;
 
     XSetWindowBackground(st->dpy, st->window, st->colors[255 % st->ncolors].pixel);
     XClearWindow(st->dpy, st->window);
@@ -185,97 +321,10 @@ pixack_frame(struct state *st, char *pix_buf)
     st->r1[w2 * i + st->width + 1] = st->r1[w2 * i + 1];
     st->r2[w2 * i + st->width + 1] = st->r2[w2 * i + 1];
   }
-  for (i = 0; i < st->height; i++) {
-    int ii = i + 1;
-    char *q = pix_buf + st->width * i;
-    short *qq = ((short *) pix_buf) + st->width * i;
-/*  long  *qqq = ((long *) pix_buf) + st->width * i;  -- crashes on Alpha */
-    int   *qqq = ((int  *) pix_buf) + st->width * i;
-    unsigned short *i1 = st->r1 + 1 + w2 * ii;
-    unsigned short *i2 = st->r2 + 1 + w2 * ii;
-    unsigned short *o1 = st->r1b + 1 + w2 * ii;
-    unsigned short *o2 = st->r2b + 1 + w2 * ii;
-    for (j = 0; j < st->width; j++) {
-#if test_pattern_hyper
-      int r1 = (i * j + (st->frame&127)*frame)&65535;
-#else
-      int uvv, r1 = 0, r2 = 0;
-      switch (st->diffusion) {
-      case 0:
-	r1 = i1[j] + i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2];
-	r1 = r1 / 5;
-	r2 = (i2[j]<<3) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 / 12;
-	break;
-      case 1:
-	r1 = i1[j+1] + i1[j-1] + i1[j+w2] + i1[j-w2];
-	r1 = r1 >> 2;
-	r2 = (i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 >> 3;
-	break;
-      case 2:
-	r1 = (i1[j]<<1) + (i1[j+1]<<1) + (i1[j-1]<<1) + i1[j+w2] + i1[j-w2];
-	r1 = r1 >> 3;
-	r2 = (i2[j]<<2) + i2[j+1] + i2[j-1] + i2[j+w2] + i2[j-w2];
-	r2 = r2 >> 3;
-	break;
-      }
-
-      /* John E. Pearson "Complex Patterns in a Simple System"
-	 Science, July 1993 */
-
-      /* uvv = (((r1 * r2) >> bps) * r2) >> bps; */
-      /* avoid signed integer overflow */
-      uvv = ((((r1 >> 1)* r2) >> bps) * r2) >> (bps - 1);
-      switch (st->reaction) {  /* costs 4% */
-      case 0:
-	r1 += 4 * (((28 * (mx-r1)) >> 10) - uvv);
-	r2 += 4 * (uvv - ((80 * r2) >> 10));
-	break;
-      case 1:
-	r1 += 3 * (((27 * (mx-r1)) >> 10) - uvv);
-	r2 += 3 * (uvv - ((80 * r2) >> 10));
-	break;
-      case 2:
-	r1 += 2 * (((28 * (mx-r1)) >> 10) - uvv);
-	r2 += 3 * (uvv - ((80 * r2) >> 10));
-	break;
-      }
-      if (r1 > mx) r1 = mx;
-      if (r2 > mx) r2 = mx;
-      if (r1 < 0) r1 = 0;
-      if (r2 < 0) r2 = 0;
-      o1[j] = r1;
-      o2[j] = r2;
-#endif
 
-      /* this is terrible.  here i want to assume ncolors = 256.
-	 should lose double indirection */
+  threadpool_run (&st->threadpool, pixack_thread_run);
+  threadpool_wait (&st->threadpool);
 
-      if (st->mapped)
-#if dither_when_mapped
-	q[j] = st->colors[st->mc[r1]  % st->ncolors].pixel;
-#else
-      q[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else if (st->pdepth == 8)
-	q[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-      else if (st->pdepth == 16)
-#if dither_when_mapped
-	qq[j] = st->colors[st->mc[r1] % st->ncolors].pixel;
-#else
-	qq[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else if (st->pdepth == 32)
-#if dither_when_mapped
-	qqq[j] = st->colors[st->mc[r1] % st->ncolors].pixel;
-#else
-	qqq[j] = st->colors[(r1>>8) % st->ncolors].pixel;
-#endif
-      else
-	abort();
-    }
-  }
   t = st->r1; st->r1 = st->r1b; st->r1b = t;
   t = st->r2; st->r2 = st->r2b; st->r2b = t;  
 }
@@ -297,6 +346,7 @@ static const char *rd_defaults [] = {
   "*size:	1.0",
   "*delay:	30000",
   "*colors:	255",
+  "*tile:	True",
 #ifdef HAVE_XSHM_EXTENSION
   "*useSHM:	True",
 #else
@@ -305,6 +355,7 @@ static const char *rd_defaults [] = {
 #ifdef HAVE_MOBILE
   "*ignoreRotation: True",
 #endif
+  THREAD_DEFAULTS
   0
 };
 
@@ -321,6 +372,9 @@ static XrmOptionDescRec rd_options [] = {
   { "-ncolors",		".colors",	XrmoptionSepArg, 0 },
   { "-shm",		".useSHM",	XrmoptionNoArg, "True" },
   { "-no-shm",		".useSHM",	XrmoptionNoArg, "False" },
+  { "-tile",		".tile",	XrmoptionNoArg, "True" },
+  { "-no-tile",		".tile",	XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -360,13 +414,28 @@ random_colors(struct state *st)
 }
 
 
+static int
+rd_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct rd_thread *t = (struct rd_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
 /* should factor into RD-specfic and compute-every-pixel general */
 static void *
 rd_init (Display *dpy, Window win)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct rd_thread),
+    rd_thread_create,
+    0
+  };
+
   struct state *st = (struct state *) calloc (1, sizeof(*st));
   XGCValues gcv;
-  int vdepth;
+  int vdepth, err;
 
   st->dpy = dpy;
   st->window = win;
@@ -375,11 +444,12 @@ rd_init (Display *dpy, Window win)
 
   XGetWindowAttributes (st->dpy, win, &st->xgwa);
   st->visual = st->xgwa.visual;
+  st->tile = get_boolean_resource (st->dpy, "tile", "Boolean");
   pixack_init(st, &st->width, &st->height);
   {
     double s = get_float_resource (st->dpy, "size", "Float");
     double p = get_float_resource (st->dpy, "speed", "Float");
-    if (s < 0.0 || s > 1.0)
+    if (s < 0.0 || s > 1.0 || !st->tile)
       s = 1.0;
     s = sqrt(s);
     st->array_width = st->xgwa.width * s;
@@ -405,50 +475,6 @@ rd_init (Display *dpy, Window win)
   st->gc = XCreateGC(st->dpy, win, 0 /*GCFunction*/, &gcv);
   vdepth = visual_depth(DefaultScreenOfDisplay(st->dpy), st->xgwa.visual);
 
-  /* This code only deals with pixmap depths of 1, 8, 16, and 32.
-     Therefore, we assume that those depths will be supported by the
-     coresponding visual depths (that depth-24 dpys accept depth-32
-     pixmaps, and that depth-12 dpys accept depth-16 pixmaps.) */
-  st->pdepth = (vdepth == 1 ? 1 :
-	    vdepth <= 8 ? 8 :
-	    vdepth <= 16 ? 16 :
-	    32);
-
-  /* Ok, this like, sucks and stuff.  There are some XFree86 systems
-     that have depth-24 visuals, that do not accept depth-32 XImages!
-     Which if you ask me is just absurd, since all it would take is
-     for the server to truncate the bits in that case.  So, this crap
-     here detects the specific case of: we have chosen depth 32;
-     and the server does not support depth 32.  In that case, we
-     try and use depth 16 instead.
-
-     The real fix would be to rewrite this program to deal with
-     depth 24 directly (or even better, arbitrary depths, but that
-     would mean going through the XImage routines instead of messing
-     with the XImage->data directly.)
-
-     jwz, 18-Mar-99: well, the X servers I have access to these days do
-     support 32-deep images on deep visuals, so I no longer have the
-     ability to test this code -- but it was causing problems on the
-     visuals that I do have, and I think that's because I mistakenly
-     wrote `pfv[i].depth' when I meant to write `pfv[i].bits_per_pixel'.
-     The symptom I was seeing was that the grid was 64x64, but the
-     images were being drawn 32x32 -- so there was a black stripe on
-     every other row.  Wow, this code sucks so much.
-  */
-  if (st->pdepth == 32)
-    {
-      int i, pfvc = 0;
-      Bool ok = False;
-      XPixmapFormatValues *pfv = XListPixmapFormats (st->dpy, &pfvc);
-      for (i = 0; i < pfvc; i++)
-        if (pfv[i].bits_per_pixel == st->pdepth)
-          ok = True;
-      if (!ok)
-        st->pdepth = 16;
-      free (pfv);
-    }
-
   st->cmap = st->xgwa.colormap;
   st->ncolors = get_integer_resource (st->dpy, "colors", "Integer");
 
@@ -465,6 +491,7 @@ rd_init (Display *dpy, Window win)
 
   st->mapped = (vdepth <= 8 &&
                 has_writable_cells(st->xgwa.screen, st->xgwa.visual));
+  st->dither = (st->mapped || vdepth > 8);
 
   {
     int i, di;
@@ -478,7 +505,17 @@ rd_init (Display *dpy, Window win)
 
   st->image = create_xshm_image(st->dpy, st->xgwa.visual, vdepth,
                                 ZPixmap, &st->shm_info, st->width, st->height);
-  st->pd = st->image->data;
+  init_row_writer (&st->writer, st->image);
+
+  err = threadpool_create (&st->threadpool, &cls, dpy,
+                           hardware_concurrency (dpy));
+  if (err)
+    threadpool_fatal (progname, err);
+  st->indexes = (unsigned char *) malloc (st->width * st->threadpool.count);
+  if (!st->indexes) {
+    fprintf (stderr, "%s: out of memory\n", progname);
+    exit (1);
+  }
 
   return st;
 }
@@ -497,7 +534,7 @@ rd_draw (Display *dpy, Window win, void *closure)
   for (ii = 0; ii < chunk; ii++) {
 
   int i, j;
-  pixack_frame(st, st->pd);
+  pixack_frame(st);
   if (ii == chunk-1) {  /* Only need to putimage on the final frame */
   for (i = 0; i < st->array_width; i += st->width)
     for (j = 0; j < st->array_height; j += st->height)
@@ -562,6 +599,8 @@ rd_free (Display *dpy, Window window, void *closure)
   free (st->r2b);
   free (st->colors);
   free (st->mc);
+  free (st->indexes);
+  threadpool_destroy (&st->threadpool);
   XFreeGC (dpy, st->gc);
   destroy_xshm_image (dpy, st->image, &st->shm_info);
   free (st);
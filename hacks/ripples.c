@@ -49,6 +49,7 @@
 typedef enum {ripple_drop, ripple_blob, ripple_box, ripple_stir} ripple_mode;
 
 #include "xshm.h"
+#include "rowwriter.h"
 
 #define TABLE 256
 
@@ -59,6 +60,8 @@ struct state {
   Visual *visual;
 
   XImage *orig_map, *buffer_map;
+  row_writer writer;		/* for buffer_map */
+  unsigned long *row_pixels;	/* two rows of buffer_map */
   int ctab[256];
   Colormap colormap;
   Screen *screen;
@@ -141,13 +144,30 @@ map_color(struct state *st, int grey)
 }
 
 
+/* Writes the 2x2 blocks of columns [from, to) of a pair of rows.
+ */
+static void
+flush_ripple_span(struct state *st, int down, int from, int to)
+{
+  unsigned long *top = st->row_pixels;
+  unsigned long *bot = st->row_pixels + st->bigwidth;
+  if (from >= to) return;
+  st->writer.pixels (&st->writer, from<<1, down<<1, (to - from)<<1,
+                     top + (from<<1));
+  st->writer.pixels (&st->writer, from<<1, (down<<1)+1, (to - from)<<1,
+                     bot + (from<<1));
+}
+
 static void
 draw_ripple(struct state *st, short *src)
 {
   int across, down;
   char *dirty = st->dirty_buffer;
+  unsigned long *top = st->row_pixels;
+  unsigned long *bot = st->row_pixels + st->bigwidth;
 
-  for (down = 0; down < st->height - 1; down++, src += 1, dirty += 1)
+  for (down = 0; down < st->height - 1; down++, src += 1, dirty += 1) {
+    int span = 0;  /* first dirty column not yet written */
     for (across = 0; across < st->width - 1; across++, src++, dirty++) {
       int v1, v2, v3, v4;
       v1 = (int)*src;
@@ -166,12 +186,17 @@ draw_ripple(struct state *st, short *src)
           dx = ((v3 - v1) + (v4 - v2)) << st->light; /* light from top */
         } else
           dx = 0;
-        XPutPixel(st->buffer_map,(across<<1),  (down<<1),  map_color(st, dx + v1));
-        XPutPixel(st->buffer_map,(across<<1)+1,(down<<1),  map_color(st, dx + ((v1 + v2) >> 1)));
-        XPutPixel(st->buffer_map,(across<<1),  (down<<1)+1,map_color(st, dx + ((v1 + v3) >> 1)));
-        XPutPixel(st->buffer_map,(across<<1)+1,(down<<1)+1,map_color(st, dx + ((v1 + v4) >> 1)));
+        top[(across<<1)]   = map_color(st, dx + v1);
+        top[(across<<1)+1] = map_color(st, dx + ((v1 + v2) >> 1));
+        bot[(across<<1)]   = map_color(st, dx + ((v1 + v3) >> 1));
+        bot[(across<<1)+1] = map_color(st, dx + ((v1 + v4) >> 1));
+      } else {
+        flush_ripple_span(st, down, span, across);
+        span = across + 1;
       }
     }
+    flush_ripple_span(st, down, span, across);
+  }
 }
 
 
@@ -540,6 +565,9 @@ setup_X(struct state *st)
 
   st->buffer_map = create_xshm_image(st->dpy, xgwa.visual, depth,
                                      ZPixmap, &st->shm_info, st->bigwidth, st->bigheight);
+  init_row_writer(&st->writer, st->buffer_map);
+  st->row_pixels = (unsigned long *)
+    calloc(st->bigwidth * 2, sizeof(*st->row_pixels));
 }
 
 
@@ -813,12 +841,11 @@ init_ripples(struct state *st, int ndrops, int splash)
            st->bigheight * st->buffer_map->bytes_per_line);
     }
   } else {
-    int across, down, color;
+    int down, color;
 
     color = map_color(st, 0); /* background colour */
     for (down = 0; down < st->bigheight; down++)
-      for (across = 0; across < st->bigwidth; across++)
-        XPutPixel(st->buffer_map,across,  down,  color);
+      st->writer.fill(&st->writer, 0, down, st->bigwidth, color);
   }
 
   DisplayImage(st);
@@ -1069,6 +1096,7 @@ ripples_free (Display *dpy, Window window, void *closure)
   if (st->bufferB) free (st->bufferB);
   if (st->temp) free (st->temp);
   if (st->dirty_buffer) free (st->dirty_buffer);
+  if (st->row_pixels) free (st->row_pixels);
   if (st->orig_map) XDestroyImage (st->orig_map);
   if (st->buffer_map) destroy_xshm_image (dpy, st->buffer_map, &st->shm_info);
   XFreeGC (dpy, st->gc);
@@ -29,6 +29,7 @@
 #include <math.h>
 #include "screenhack.h"
 #include "xshm.h"
+#include "rowwriter.h"
 
 struct zoom_area {
   int w, h;		/* rectangle width and height */
@@ -50,6 +51,9 @@ struct state {
   GC gc;
   Visual *visual;
   XImage *orig_map, *buffer_map;
+  row_writer orig_writer, buffer_writer;
+  int *xs, *ys;			/* one row of source coordinates */
+  unsigned long *row;		/* and the pixels found there */
   Colormap colormap;
 
   int width, height;
@@ -80,13 +84,13 @@ rotzoom (struct state *st, struct zoom_area *za)
 
   z = 8100 * sin (M_PI * za->a2 / 8192);
   zoom = 8192 + z;
+  c = zoom * cos (M_PI * za->a1 / 8192);
+  s = zoom * sin (M_PI * za->a1 / 8192);
 
   for (y = za->y; y <= y2; y++) {
+    int n = 0, x0 = za->x;
     for (x = za->x; x <= x2; x++) {
       Bool copyp = True;
-      double a = M_PI * za->a1 / 8192;
-      c = zoom * cos (a);
-      s = zoom * sin (a);
       if (st->circle) {
         int cx = za->x + za->w / 2;
         int cy = za->y + za->h / 2;
@@ -120,9 +124,18 @@ rotzoom (struct state *st, struct zoom_area *za)
         while (oy >= st->height)
           oy -= st->height;
 
-        XPutPixel (st->buffer_map, x, y, XGetPixel (st->orig_map, ox, oy));
+        /* The part of a row inside the circle is a single run. */
+        if (n == 0) x0 = x;
+        st->xs[n] = ox;
+        st->ys[n] = oy;
+        n++;
       }
     }
+
+    if (n) {
+      st->orig_writer.gather (&st->orig_writer, n, st->xs, st->ys, st->row);
+      st->buffer_writer.pixels (&st->buffer_writer, x0, y, n, st->row);
+    }
   }
 
   za->a1 += za->inc1;		/* Rotation angle */
@@ -143,14 +156,28 @@ rotzoom (struct state *st, struct zoom_area *za)
       int cy = za->y + za->h / 2;
       int w2 = (za->w/2) * (za->w/2);
       for (y = za->y; y < za->y + za->h; y++)
-        for (x = za->x; x < za->x + za->w; x++)
-          {
-            int dx = x - cx;
-            int dy = y - cy;
-            int d2 = (dx*dx) + (dy*dy);
-            if (d2 <= w2)
-              XPutPixel (st->orig_map, x, y, XGetPixel (st->buffer_map, x, y));
-          }
+        {
+          int n = 0, x0 = za->x;
+          for (x = za->x; x < za->x + za->w; x++)
+            {
+              int dx = x - cx;
+              int dy = y - cy;
+              int d2 = (dx*dx) + (dy*dy);
+              if (d2 <= w2)
+                {
+                  if (n == 0) x0 = x;
+                  st->xs[n] = x;
+                  st->ys[n] = y;
+                  n++;
+                }
+            }
+          if (n)
+            {
+              st->buffer_writer.gather (&st->buffer_writer, n,
+                                        st->xs, st->ys, st->row);
+              st->orig_writer.pixels (&st->orig_writer, x0, y, n, st->row);
+            }
+        }
     }
 
   za->count++;
@@ -407,6 +434,7 @@ rotzoomer_draw (Display *disp, Window win, void *closure)
 	st->orig_map = XGetImage (st->dpy, st->pm,
                                   0, 0, st->width, st->height,
                                   ~0L, ZPixmap);
+        init_row_writer (&st->orig_writer, st->orig_map);
         init_hack (st);
       }
       return st->delay;
@@ -484,6 +512,15 @@ setup_X (struct state *st)
 
   st->buffer_map = create_xshm_image(st->dpy, xgwa.visual, depth,
                                      ZPixmap, &st->shm_info, st->width, st->height);
+  init_row_writer (&st->buffer_writer, st->buffer_map);
+
+  st->xs  = (int *) calloc (st->width, sizeof(*st->xs));
+  st->ys  = (int *) calloc (st->width, sizeof(*st->ys));
+  st->row = (unsigned long *) calloc (st->width, sizeof(*st->row));
+  if (!st->xs || !st->ys || !st->row) {
+    fprintf (stderr, "%s: out of memory\n", progname);
+    exit (1);
+  }
 }
 
 
@@ -555,6 +592,9 @@ rotzoomer_free (Display *dpy, Window window, void *closure)
       if (st->zoom_box[i]) free (st->zoom_box[i]);
     free (st->zoom_box);
   }
+  if (st->xs) free (st->xs);
+  if (st->ys) free (st->ys);
+  if (st->row) free (st->row);
   free (st);
 }
 
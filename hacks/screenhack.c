@@ -166,6 +166,8 @@ Bool mono_p;		/* used by hacks */
 static time_t exit_after;	/* Exit gracefully after N seconds */
 #endif
 
+static struct timeval start_time;  /* See screenhack_first_frame() */
+
 static XrmOptionDescRec default_options [] = {
   { "-root",	".root",		XrmoptionNoArg, "True" },
   { "-window",	".root",		XrmoptionNoArg, "False" },
@@ -573,6 +575,46 @@ screenhack_do_fps (Display *dpy, Window w, fps_state *fpst, void *closure)
 }
 
 
+static void
+get_time (struct timeval *tv)
+{
+# ifdef GETTIMEOFDAY_TWO_ARGS
+  struct timezone tzp;
+  gettimeofday (tv, &tzp);
+# else
+  gettimeofday (tv);
+# endif
+}
+
+
+/* Under xscreensaver, tell it when the first frame has been drawn, by
+   putting the times at which main() started and at which the frame was
+   done on a property of our window.  It keeps track of how long each hack
+   takes to get going, and suspends hacks that it launched early until it
+   is time to show them.
+ */
+static void
+screenhack_first_frame (Display *dpy, Window window)
+{
+  struct timeval now;
+  long data[4];
+
+  if (! getenv ("XSCREENSAVER_WINDOW"))
+    return;
+
+  get_time (&now);
+  data[0] = start_time.tv_sec;
+  data[1] = start_time.tv_usec;
+  data[2] = now.tv_sec;
+  data[3] = now.tv_usec;
+  XChangeProperty (dpy, window,
+                   XInternAtom (dpy, "_SCREENSAVER_FIRST_FRAME", False),
+                   XA_INTEGER, 32, PropModeReplace,
+                   (unsigned char *) data, countof(data));
+  XFlush (dpy);
+}
+
+
 static void
 run_screenhack_table (Display *dpy, 
                       Window window,
@@ -597,6 +639,7 @@ run_screenhack_table (Display *dpy,
   void *closure = init_cb (dpy, window, ft->setup_arg);
   fps_state *fpst = fps_init (dpy, window);
   unsigned long delay = 0;
+  Bool first_frame_p = True;
 
 #ifdef DEBUG_PAIR
   void *closure2 = 0;
@@ -634,6 +677,12 @@ run_screenhack_table (Display *dpy,
 #ifdef DEBUG_PAIR
       if (fpst2) fps_cb (dpy, window2, fpst2, closure2);
 #endif
+
+      if (first_frame_p)
+        {
+          screenhack_first_frame (dpy, window);
+          first_frame_p = False;
+        }
     }
 
 #ifdef HAVE_RECORD_ANIM
@@ -763,6 +812,7 @@ main (int argc, char **argv)
   Boolean dont_clear;
   char version[255];
 
+  get_time (&start_time);
   fix_fds();
 
   progname = argv[0];   /* reset later */
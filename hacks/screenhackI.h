@@ -141,6 +141,14 @@
 # ifdef HAVE_JWZGLES
 #  include "jwzgles.h"
 # endif
+# ifdef HAVE_GLBATCH
+#  ifdef HAVE_GLPROF
+#   include "glprofI.h"	/* Counted in glbatch.c instead */
+#  endif
+#  include "glbatch.h"
+# elif defined(HAVE_GLPROF)
+#  include "glprof.h"
+# endif
 
 #endif /* HAVE_GL */
 
@@ -39,6 +39,7 @@
 
 #include <math.h>
 #include "screenhack.h"
+#include "rowwriter.h"
 
 /* #define VERBOSE */
 
@@ -93,6 +94,8 @@ struct state {
   signed short iColorCount;
   int cycles;
   XImage *pImage;
+  row_writer writer;
+  unsigned char *aiShades;	/* palette index of each pixel in pImage */
   unsigned char nShadeBobCount, iShadeBob;
   SShadeBob *aShadeBobs;
   GC gc;
@@ -176,36 +179,44 @@ static void MoveShadeBob( struct state *st, SShadeBob *pShadeBob )
 
 static void Execute( struct state *st, SShadeBob *pShadeBob )
 {
-	unsigned long iColor;
 	short iColorVal;
-	int iPixelX, iPixelY;
+	int iPixelX, iPixelY, iLeft, iRun;
 	unsigned int iWidth, iHeight;
+	unsigned char *pShades;
 
 	MoveShadeBob( st, pShadeBob );
-	
+
+	/* The palette index of each pixel is kept in aiShades, rather than
+	   reading the pixel back and searching the palette for it. */
+	iLeft = pShadeBob->nPosX;
+	iRun = st->iWinWidth - iLeft;
+	if( iRun > st->iBobDiameter ) iRun = st->iBobDiameter;
+
 	for( iHeight=0; iHeight<st->iBobDiameter; iHeight++ )
 	{
 		iPixelY = pShadeBob->nPosY + iHeight;
 		if( iPixelY >= st->iWinHeight )	iPixelY -= st->iWinHeight;
+		pShades = st->aiShades + iPixelY * st->iWinWidth;
 
 		for( iWidth=0; iWidth<st->iBobDiameter; iWidth++ )
 		{
-			iPixelX = pShadeBob->nPosX + iWidth;
+			iPixelX = iLeft + iWidth;
 			if( iPixelX >= st->iWinWidth )	iPixelX -= st->iWinWidth;
 
-			iColor = XGetPixel( st->pImage, iPixelX, iPixelY );
-
-			/*  FIXME: Here is a loop I'd love to take out. */
-			for( iColorVal=0; iColorVal<st->iColorCount; iColorVal++ )
-				if( st->aiColorVals[ iColorVal ] == iColor )
-					break;
-
+			iColorVal = pShades[ iPixelX ];
 			iColorVal += pShadeBob->anDeltaMap[ iWidth * st->iBobDiameter + iHeight ];
 			if( iColorVal >= st->iColorCount ) iColorVal = st->iColorCount - 1;
 			if( iColorVal < 0 )			   iColorVal = 0;
-
-			XPutPixel( st->pImage, iPixelX, iPixelY, st->aiColorVals[ iColorVal ] );
+			pShades[ iPixelX ] = iColorVal;
 		}
+
+		/* The bob wraps around the right edge in at most two runs. */
+		st->writer.indexed( &st->writer, iLeft, iPixelY, iRun,
+		                    pShades + iLeft, st->aiColorVals );
+		if( iRun < st->iBobDiameter )
+			st->writer.indexed( &st->writer, 0, iPixelY,
+			                    st->iBobDiameter - iRun,
+			                    pShades, st->aiColorVals );
 	}
 
 	/* FIXME: if it's next to the top or left sides of screen this will break. However, it's not noticable. */
@@ -329,10 +340,18 @@ static void Initialize( struct state *st )
 	st->pImage = XCreateImage( st->dpy, XWinAttribs.visual, XWinAttribs.depth, ZPixmap, 0, NULL,
 							  XWinAttribs.width, XWinAttribs.height, 8 /*BitmapPad( st->dpy )*/, 0 );
 	st->pImage->data = calloc((st->pImage)->bytes_per_line, (st->pImage)->height);
+	init_row_writer( &st->writer, st->pImage );
 
 	st->iWinWidth = XWinAttribs.width;
 	st->iWinHeight = XWinAttribs.height;
 
+	st->aiShades = calloc( st->iWinWidth, st->iWinHeight );
+	if( !st->pImage->data || !st->aiShades )
+	{
+		fprintf( stderr, "%s: out of memory\n", progname );
+		exit( 1 );
+	}
+
 	/*  These are precalculations used in Execute(). */
 	st->iBobDiameter = ( ( st->iWinWidth < st->iWinHeight ) ? st->iWinWidth : st->iWinHeight ) / 25;
 	st->iBobRadius = st->iBobDiameter / 2;
@@ -415,10 +434,9 @@ shadebobs_draw (Display *dpy, Window window, void *closure)
       {
         /* fill the image with the actual value of the black pixel, not 0. */
         unsigned long black = BlackPixelOfScreen (XWinAttribs.screen);
-        int x, y;
-        for (y = 0; y < XWinAttribs.height; y++)
-          for (x = 0; x < XWinAttribs.width; x++)
-            XPutPixel (st->pImage, x, y, black);
+        int y;
+        for (y = 0; y < st->iWinHeight; y++)
+          st->writer.fill (&st->writer, 0, y, st->iWinWidth, black);
       }
 #endif
 
@@ -427,6 +445,17 @@ shadebobs_draw (Display *dpy, Window window, void *closure)
       XFreeColors( st->dpy, XWinAttribs.colormap, st->aiColorVals, st->iColorCount, 0 );
       free( st->aiColorVals );
       st->aiColorVals = SetPalette( st );
+
+      {
+        /* Black's place in the new palette, or one past the end if it has
+           none, which is what searching the palette for it used to find. */
+        unsigned long black = BlackPixelOfScreen (XWinAttribs.screen);
+        int i;
+        for (i = 0; i < st->iColorCount; i++)
+          if (st->aiColorVals[i] == black)
+            break;
+        memset (st->aiShades, i, st->iWinWidth * st->iWinHeight);
+      }
       XClearWindow( st->dpy, st->window );
     }
 
@@ -457,6 +486,7 @@ shadebobs_free (Display *dpy, Window window, void *closure)
         if (st->sColor) free (st->sColor);
         XFreeGC (dpy, st->gc);
 	XDestroyImage( st->pImage );
+	free( st->aiShades );
 	for( st->iShadeBob=0; st->iShadeBob<st->nShadeBobCount; st->iShadeBob++ )
 		free( st->aShadeBobs[ st->iShadeBob ].anDeltaMap );
 	free( st->aShadeBobs );
@@ -84,6 +84,8 @@ static const char sccsid[] = "@(#)strange.c	5.00 2000/11/01 xlockmore";
 #define DEF_ZOOM        "0.9" /* approx. 1 / 1.1 */
 #define DEF_BRIGHTNESS  "1.0"
 #define DEF_MOTION_BLUR "3.0" /* Formerly MERGE_FRAMES, but it's IIR now. */
+#define DEF_FRAME_BUDGET "0"  /* Milliseconds; 0 leaves -points alone. */
+#define DEF_TIMINGS     "False"
 
 static int curve;
 static int points;
@@ -91,6 +93,8 @@ static int pointSize;
 static float zoom;
 static float brightness;
 static float motionBlur;
+static float frameBudget;
+static Bool timings;
 
 static XrmOptionDescRec opts[] =
 {
@@ -100,6 +104,9 @@ static XrmOptionDescRec opts[] =
 		{"-zoom",         ".strange.zoom",       XrmoptionSepArg, 0},
 		{"-brightness",   ".strange.brightness", XrmoptionSepArg, 0},
 		{"-motion-blur",  ".strange.motionBlur", XrmoptionSepArg, 0},
+		{"-frame-budget", ".strange.frameBudget", XrmoptionSepArg, 0},
+		{"-timings",      ".strange.timings",    XrmoptionNoArg, "True"},
+		{"-no-timings",   ".strange.timings",    XrmoptionNoArg, "False"},
 		THREAD_OPTIONS
 };
 static argtype vars[] =
@@ -110,6 +117,8 @@ static argtype vars[] =
 		{&zoom,       "zoom",       "Zoom",       DEF_ZOOM,        t_Float},
 		{&brightness, "brightness", "Brightness", DEF_BRIGHTNESS,  t_Float},
 		{&motionBlur, "motionBlur", "MotionBlur", DEF_MOTION_BLUR, t_Float},
+		{&frameBudget, "frameBudget", "FrameBudget", DEF_FRAME_BUDGET, t_Float},
+		{&timings,    "timings",    "Timings",    DEF_TIMINGS,     t_Bool},
 };
 static OptionStruct desc[] =
 {
@@ -119,6 +128,8 @@ static OptionStruct desc[] =
 		{"-zoom", "zoom in or out"},
 		{"-brightness", "adjust the brightness for accumulator mode"},
 		{"-motion-blur", "adds motion blur"},
+		{"-frame-budget", "adjust the number of points to take this many ms"},
+		{"-timings", "print how long each part of a frame takes"},
 };
 ENTRYPOINT ModeSpecOpt strange_opts =
 {sizeof opts / sizeof opts[0], opts,
@@ -235,6 +246,11 @@ typedef struct _ATTRACTOR {
 		XShmSegmentInfo shmInfo;
 		struct _THREAD **threads;
 		struct threadpool pool;
+		unsigned *rowBand; /* Which thread rasterizes each row. */
+		int numPt;         /* Max_Pt, or as tuned by -frame-budget. */
+		double tPoints, tRaster, tPut; /* For -timings. */
+		unsigned frames;
+		double lastReport;
 	#endif
 } ATTRACTOR;
 
@@ -244,9 +260,20 @@ static ATTRACTOR *Root = (ATTRACTOR *) NULL;
 typedef struct _THREAD {
 	const ATTRACTOR *Attractor;
 	unsigned long Rnd;
+	unsigned id;
 	size_t y0, y1, y2;
 
-	PIXEL0 **accMap;
+	/* Each thread iterates its share of the points into 'cells', then sorts
+	 * them by the band of rows they land in.  The points for band b are
+	 * sorted[bandStart[b]] up to sorted[bandStart[b+1]], so the thread that
+	 * rasterizes that band only has to read its own rows of everyone's
+	 * points, instead of a whole-window accumulator per thread.
+	 */
+	unsigned *cells, *sorted;
+	size_t cellsSize;
+	unsigned *bandStart;
+
+	PIXEL0 *accBand; /* Rows y0 to y2. */
 	PIXEL0 *bloomRows;
 	PIXEL1 *colorRow;
 	PIXEL0 *motionBlur;
@@ -269,22 +296,20 @@ static DBL  Mid_Prm[MAX_PRM] =
 	0.0, 1.5, -1.0, -.5, 2.5,
 };
 
-#if 0
-
-static inline uint64_t frq(void)
+static double
+double_time (void)
 {
-	return 1000000;
-}
+	struct timeval now;
+# ifdef GETTIMEOFDAY_TWO_ARGS
+	struct timezone tzp;
+	gettimeofday(&now, &tzp);
+# else
+	gettimeofday(&now);
+# endif
 
-static inline uint64_t tick(void)
-{
-	struct timeval tv;
-	gettimeofday(&tv, NULL);
-	return tv.tv_sec * frq() + tv.tv_usec;
+	return (now.tv_sec + ((double) now.tv_usec * 0.000001));
 }
 
-#endif
-
 static      DBL
 Old_Gauss_Rand(DBL c, DBL A, DBL S)
 {
@@ -456,6 +481,9 @@ free_strange(ModeInfo *mi)
 		free (A->threads);
 		A->threads = NULL;
 
+		free (A->rowBand);
+		A->rowBand = NULL;
+
 		if (A->accImage) {
 			destroy_xshm_image (display, A->accImage, &A->shmInfo);
 			A->accImage = NULL;
@@ -542,8 +570,10 @@ thread_destroy (void *Self_Raw)
 {
 	THREAD     *T = (THREAD *)Self_Raw;
 
-	aligned_free (T->accMap[0]);
-	(void) free((void *) T->accMap);
+	free (T->cells);
+	free (T->sorted);
+	free (T->bandStart);
+	aligned_free (T->accBand);
 	aligned_free (T->bloomRows);
 	aligned_free (T->colorRow);
 	aligned_free (T->motionBlur);
@@ -553,12 +583,12 @@ static int
 thread_create (void *Self_Raw, struct threadpool *pool, unsigned id)
 {
 	THREAD     *T = (THREAD *)Self_Raw;
-	int         i;
 	const ATTRACTOR *A = GET_PARENT_OBJ(ATTRACTOR, pool, pool);
 
 	memset (T, 0, sizeof(*T));
 
 	T->Attractor = A;
+	T->id = id;
 	A->threads[id] = T;
 
 	T->Rnd = random();
@@ -568,19 +598,20 @@ thread_create (void *Self_Raw, struct threadpool *pool, unsigned id)
 	T->y2 = A->Height * (id + 1) / pool->count;
 	T->y0 = T->y1 < pointSize ? 0 : T->y1 - pointSize;
 
-	T->accMap = (PIXEL0**)calloc(A->Height,sizeof(PIXEL0*));
-	if (!T->accMap) {
+	T->cellsSize = A->numPt / pool->count;
+	T->cells = malloc (T->cellsSize * sizeof(*T->cells));
+	T->sorted = malloc (T->cellsSize * sizeof(*T->sorted));
+	T->bandStart = malloc ((pool->count + 1) * sizeof(*T->bandStart));
+	if (!T->cells || !T->sorted || !T->bandStart) {
 		thread_destroy (T);
 		return ENOMEM;
 	}
-	T->accMap[0] = NULL;
-	if (aligned_malloc ((void **)&T->accMap[0], __BIGGEST_ALIGNMENT__,
-		A->alignedWidth * A->Height * sizeof(PIXEL0))) {
+
+	if (aligned_malloc ((void **)&T->accBand, __BIGGEST_ALIGNMENT__,
+		A->alignedWidth * (T->y2 - T->y0) * sizeof(*T->accBand))) {
 		thread_destroy (T);
 		return ENOMEM;
 	}
-	for (i=0;i<A->Height;i++)
-		T->accMap[i] = T->accMap[0] + A->alignedWidth * i;
 
 	if (aligned_malloc ((void **)&T->bloomRows, __BIGGEST_ALIGNMENT__,
 		A->alignedWidth * (pointSize + 2) * sizeof(*T->bloomRows))) {
@@ -620,12 +651,14 @@ points_thread (void *Self_Raw)
 	void        (*Iterate) (const ATTRACTOR *, PRM, PRM, PRM *, PRM *);
 	unsigned    Rnd;
 	PRM         xmax, xmin, ymax, ymin;
+	unsigned   *cells = T->cells, *start = T->bandStart;
+	unsigned    b, bands = A->pool.count, aw = A->alignedWidth;
+	size_t      m = 0, k;
 
 	Iterate = A->Iterate;
 
-	if (useAccumulator) {
-		memset (T->accMap[0], 0, sizeof(PIXEL0) * A->alignedWidth * A->Height);
-	}
+	/* start[b + 1] counts the points in band b, for now. */
+	memset (start, 0, (bands + 1) * sizeof(*start));
 
 	/* Using CHEAPRND() by itself occasionally gets stuck at 0 mod 8, so seed it
 	 * from GOODRND().
@@ -642,14 +675,16 @@ points_thread (void *Self_Raw)
 	if (!iLy)
 		iLy = 1;
 
-	for (n = T->Attractor->Max_Pt / A->pool.count; n; --n) {
+	for (n = A->numPt / A->pool.count; n; --n) {
 		unsigned mx,my;
 		(*Iterate) (T->Attractor, x, y, &xo, &yo);
 		mx = ((iLx * x) >> L_Bits) + cx;
 		my = ((iLy * y) >> L_Bits) + cy;
 		/* Fun trick: making m[x|y] unsigned means we can skip mx<0 && my<0. */
-		if (mx<A->Width && my<A->Height)
-			T->accMap[my][mx]++;
+		if (mx<A->Width && my<A->Height) {
+			cells[m++] = my * aw + mx;
+			start[A->rowBand[my] + 1]++;
+		}
 
 		#ifdef AUTO_ZOOM
 		if (xo > xmax)
@@ -670,6 +705,19 @@ points_thread (void *Self_Raw)
 		x = xo + (CHEAPRND(Rnd) >> (sizeof(Rnd) * 8 - 3)) - 4;
 		y = yo + (CHEAPRND(Rnd) >> (sizeof(Rnd) * 8 - 3)) - 4;
 	}
+
+	/* Counting sort by band.  The scatter leaves start[b] at the end of band
+	 * b, which is where band b + 1 starts, so shift it back up by one.
+	 */
+	for (b = 1; b <= bands; b++)
+		start[b] += start[b - 1];
+	for (k = 0; k != m; k++) {
+		unsigned c = cells[k];
+		T->sorted[start[A->rowBand[c / aw]]++] = c;
+	}
+	for (b = bands; b; b--)
+		start[b] = start[b - 1];
+	start[0] = 0;
 }
 
 static void
@@ -677,7 +725,7 @@ rasterize_thread (void *Self_Raw)
 {
 	THREAD     *T = (THREAD *)Self_Raw;
 	const ATTRACTOR *A = T->Attractor;
-	unsigned    i, j, k;
+	unsigned    i, j, k, b;
 	PRM         xmax = 0, xmin = A->Width, ymax = 0, ymin = A->Height;
 	unsigned long colorScale =
 		(double)A->Width * A->Height
@@ -687,7 +735,7 @@ rasterize_thread (void *Self_Raw)
 		/ 640.0 / 480.0
 		/ (pointSize * pointSize)
 		* 800000.0
-		/ (float)A->Max_Pt
+		/ (float)A->numPt
 		* (float)A->numCols/256;
 	#ifdef VARY_SPEED_TO_AVOID_BOREDOM
 	unsigned    pixelCount = 0;
@@ -698,10 +746,30 @@ rasterize_thread (void *Self_Raw)
 
 	/* Clang needs these for loop-vectorizing; A->Width doesn't work. */
 	unsigned    w = A->Width, aw = A->alignedWidth;
+	size_t      base = T->y0 * aw, size = (T->y2 - T->y0) * aw;
 
 	if (A->numCols == 2) /* Brighter for monochrome. */
 		colorScale *= 4;
 
+	/* Combine everyone's points for this band, including the rows above it
+	 * that preheat the blur, which belong to the band (or bands) before.
+	 */
+	memset (T->accBand, 0, size * sizeof(*T->accBand));
+	for (k=0;k<A->pool.count;k++) {
+		const THREAD *P = A->threads[k];
+		for (b = T->id; ; b--) {
+			const unsigned *c = P->sorted + P->bandStart[b];
+			const unsigned *end = P->sorted + P->bandStart[b + 1];
+			for (; c != end; c++) {
+				/* Lots of cache misses. Such is life. */
+				if (*c - base < size)
+					T->accBand[*c - base]++;
+			}
+			if (!b || A->threads[b]->y1 <= T->y0)
+				break;
+		}
+	}
+
 	/* bloomRows: row ring buffer, bloom accumulator, in that order. */
 	memset (T->bloomRows, 0, (pointSize + 1) * aw * sizeof(*T->bloomRows));
 
@@ -718,19 +786,13 @@ rasterize_thread (void *Self_Raw)
 			ALIGN_HINT(T->bloomRows + A->alignedWidth * pointSize);
 		PIXEL1 *colRow = T->colorRow;
 
+		const PIXEL0 *inRow = ALIGN_HINT(T->accBand + aw * (j - T->y0));
+
 		/* Moderately fast bloom.  */
 
 		for (i=0;i<aw;i++) {
 			accumRow[i] -= bloomRow[i];
-			bloomRow[i] = 0;
-		}
-
-		for (k=0;k<A->pool.count;k++) {
-			const PIXEL0 *inRow = ALIGN_HINT(A->threads[k]->accMap[j]);
-			for (i=0;i<aw;i++) {
-				/* Lots of last-level cache misses. Such is life. */
-				bloomRow[i] += inRow[i];
-			}
+			bloomRow[i] = inRow[i];
 		}
 
 		/* Hardware prefetching works better going forwards than going backwards.
@@ -835,15 +897,6 @@ rasterize_thread (void *Self_Raw)
 		}
 	}
 
-	/*
-	uint64_t dt = 0;
-	uint64_t t0 = tick();
-	dt += tick() - t0;
-
-	printf("B %g\t(%d,%d)\t%dx%d\t%d\n", 1000.0 * dt / frq(),
-		xmin, ymin, xmax - xmin, ymax - ymin, pixelCount);
-	*/
-
 	T->xmax = xmax;
 	T->xmin = xmin;
 	T->ymax = ymax;
@@ -873,6 +926,72 @@ ramp_color (const XColor *color_in, XColor *color_out, unsigned i, unsigned n)
 	}
 }
 
+/* Picks the number of points for the next frame so that it takes about
+ * -frame-budget milliseconds.  Only iterating the points costs more with
+ * more points; the rest of the frame is per-pixel.
+ */
+static void
+tune_points (ATTRACTOR *A, double tPoints, double tRest)
+{
+	double want = A->numPt * (frameBudget / 1000 - tRest) / tPoints;
+	double lo = A->pool.count * 256.0, hi = A->Max_Pt * 16.0;
+	size_t per;
+	unsigned i;
+
+	/* Ease towards it, so one slow frame doesn't throw the count off. */
+	want = (3.0 * A->numPt + want) / 4;
+	if (want < lo) want = lo;
+	if (want > hi) want = hi;
+	A->numPt = want;
+
+	per = A->numPt / A->pool.count;
+	for (i = 0; i != A->pool.count; i++) {
+		THREAD *T = A->threads[i];
+		if (T->cellsSize < per) {
+			unsigned *cells = malloc (per * sizeof(*cells));
+			unsigned *sorted = malloc (per * sizeof(*sorted));
+			if (!cells || !sorted) {
+				/* Make do with what we have. */
+				free (cells);
+				free (sorted);
+				A->numPt = T->cellsSize * A->pool.count;
+				per = T->cellsSize;
+				continue;
+			}
+			free (T->cells);
+			free (T->sorted);
+			T->cells = cells;
+			T->sorted = sorted;
+			T->cellsSize = per;
+		}
+	}
+}
+
+static void
+report_timings (ATTRACTOR *A, double tPoints, double tRaster, double tPut)
+{
+	double now = double_time();
+
+	A->tPoints += tPoints;
+	A->tRaster += tRaster;
+	A->tPut += tPut;
+	A->frames++;
+
+	if (now - A->lastReport < 1)
+		return;
+	if (A->lastReport)
+		fprintf (stderr,
+			"%s: %d points, %u threads: points %.2f ms, "
+			"combine/bloom/blur %.2f ms, put %.2f ms\n",
+			progname, A->numPt, A->pool.count,
+			1000 * A->tPoints / A->frames,
+			1000 * A->tRaster / A->frames,
+			1000 * A->tPut / A->frames);
+	A->tPoints = A->tRaster = A->tPut = 0;
+	A->frames = 0;
+	A->lastReport = now;
+}
+
 #endif
 
 static void
@@ -932,7 +1051,9 @@ draw_strange(ModeInfo * mi)
 	#ifdef useAccumulator
 	if (useAccumulator) {
 		int pixelCount = 0;
+		double t0, t1, t2, t3;
 
+		t0 = double_time();
 		threadpool_run (&A->pool, points_thread);
 
 		if (A->visualClass == TrueColor) {
@@ -948,9 +1069,11 @@ draw_strange(ModeInfo * mi)
 			}
 		}
 		threadpool_wait (&A->pool);
+		t1 = double_time();
 
 		threadpool_run(&A->pool, rasterize_thread);
 		threadpool_wait(&A->pool);
+		t2 = double_time();
 
 		for (i=0; i!=A->pool.count; ++i) {
 			THREAD *T = A->threads[i];
@@ -973,6 +1096,12 @@ draw_strange(ModeInfo * mi)
 		if (A->dbuf != None) {
 			XCopyArea(display, A->dbuf, window, gc, 0, 0, A->Width, A->Height, 0, 0);
 		}
+		t3 = double_time();
+
+		if (frameBudget > 0 && t1 > t0)
+			tune_points (A, t1 - t0, t3 - t1);
+		if (timings)
+			report_timings (A, t1 - t0, t2 - t1, t3 - t2);
 		#ifdef VARY_SPEED_TO_AVOID_BOREDOM
 			/* Increase the rate of change of the parameters if the attractor has become visually boring. */
 			if ((xmax - xmin < Lx * DBL_To_PRM(.2)) && (ymax - ymin < Ly * DBL_To_PRM(.2))) {
@@ -1121,6 +1250,9 @@ init_strange(ModeInfo * mi)
 	}
 
 	Attractor->Max_Pt = points;
+#ifdef useAccumulator
+	Attractor->numPt = points;
+#endif
 
 	if (Attractor->Buffer1 == NULL)
 		if ((Attractor->Buffer1 = calloc(Attractor->Max_Pt,
@@ -1324,11 +1456,27 @@ init_strange(ModeInfo * mi)
 
 		if (A->pool.count)
 			threadpool_destroy (&A->pool);
+		/* The threads need this to sort their points, but not before the
+		 * first frame.
+		 */
+		free (A->rowBand);
+		A->rowBand = malloc (A->Height * sizeof(*A->rowBand));
+		if (!A->rowBand) {
+			free_strange (mi);
+			return;
+		}
+
 		if (threadpool_create (&A->pool, &threadClass, display, threadCount)) {
 			A->pool.count = 0;
 			free_strange (mi);
 			return;
 		}
+
+		for (i = 0; i < (int) A->pool.count; i++) {
+			unsigned y;
+			for (y = A->threads[i]->y1; y != A->threads[i]->y2; y++)
+				A->rowBand[y] = i;
+		}
 	}
 	#undef A
 #endif
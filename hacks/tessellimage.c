@@ -11,6 +11,9 @@
 
 #include "screenhack.h"
 #include "delaunay.h"
+#include "rowwriter.h"
+#include "thread_util.h"
+#include "lanes.h"
 
 #ifndef HAVE_JWXYZ
 # define XK_MISCELLANY
@@ -30,8 +33,22 @@ struct state {
   int max_depth, max_resolution;
   double start_time, start_time2;
 
-  XImage *img, *delta;
+  XImage *img;
   Pixmap image, output, deltap;
+
+  /* Everything the thresholds need, worked out once per image. */
+  struct threadpool threadpool;
+  int dw, dh;			/* Size of img, and of the delta map */
+  unsigned long mask[3];	/* Red, green and blue fields of a pixel */
+  unsigned int shift[3];
+  unsigned char *planes;	/* img as rows of R, G and B, in a black frame */
+  int red_sq[256], green_sq[256], blue_sq[256];
+  unsigned char *cube_root;
+  unsigned char *delta;		/* Colour distance from each pixel to its
+				   neighbours, dw x dh */
+  XYZ *features;		/* Pixels at or above the lowest threshold,
+				   highest delta first */
+
   int nthreshes, threshes[256], vsizes[256];
   int thresh, dthresh;
   Pixmap cache[256];
@@ -48,11 +65,6 @@ typedef struct {
   XPoint *p;
 } voronoi_polygon;
 
-typedef struct {
-  XPoint p;
-  double slope;
-} voronoi_pa;
-
 
 /* Returns the current time in seconds as a double.
  */
@@ -71,10 +83,254 @@ double_time (void)
 }
 
 
+/* Given a bitmask, returns the position and width of the field.
+ */
+static void
+decode_mask (unsigned int mask, unsigned int *pos_ret, unsigned int *size_ret)
+{
+  int i;
+  for (i = 0; i < 32; i++)
+    if (mask & (1L << i))
+      {
+        int j = 0;
+        *pos_ret = i;
+        for (; i < 32; i++, j++)
+          if (! (mask & (1L << i)))
+            break;
+        *size_ret = j;
+        return;
+      }
+}
+
+
+static int
+bigendian (void)
+{
+  union { int i; char c[sizeof(int)]; } u;
+  u.i = 1;
+  return !u.c[0];
+}
+
+
+/* The distance between two colours, in luminance-weighted RGB space:
+   the cube root of the sum of the squared differences, with red and blue
+   counting .2989/.5870 and .1140/.5870 as much as green.
+
+   (Plain RGB distance, and brightness-weighted HSV distance, were also
+   tried; HSV was slower, and neither looked any better.)
+
+   Each channel's weighted square only depends on the difference, so
+   those come from tables, as do the cube roots of their sums, rather
+   than doing the floating point for every pair of pixels.
+ */
+static void
+init_distance_tables (struct state *st)
+{
+  int i, n;
+  for (i = 0; i < 256; i++)
+    {
+      int rd = i * 0.2989 * (1 / 0.5870);
+      int gd = i * 0.5870 * (1 / 0.5870);
+      int bd = i * 0.1140 * (1 / 0.5870);
+      st->red_sq[i]   = rd * rd;
+      st->green_sq[i] = gd * gd;
+      st->blue_sq[i]  = bd * bd;
+    }
+
+  n = st->red_sq[255] + st->green_sq[255] + st->blue_sq[255] + 1;
+  st->cube_root = (unsigned char *) malloc (n);
+  if (! st->cube_root)
+    {
+      fprintf (stderr, "%s: out of memory\n", progname);
+      abort();
+    }
+  for (i = 0; i < n; i++)
+    st->cube_root[i] = cbrt (i);
+}
+
+static INLINE int
+color_distance (const struct state *st,
+                int r1, int g1, int b1, int r2, int g2, int b2)
+{
+  return st->cube_root[st->red_sq  [abs (r2 - r1)] +
+                       st->green_sq[abs (g2 - g1)] +
+                       st->blue_sq [abs (b2 - b1)]];
+}
+
+
+/* Each pixel of the delta map is the average distance from that pixel
+   to its neighbours above-left, above, left, and below-left.  Maybe
+   running a Sobel filter on this would be a better idea.  That might be
+   a bit faster, but I think it would make no visual difference.
+
+   r0, r1 and r2 are the red channels of the rows above, at and below
+   this one, and so on; the pixel to the left of each row is black, so
+   that there are no special cases at the edges.
+ */
+static void
+delta_row (const struct state *st, unsigned char *RESTRICT out,
+           const unsigned char *RESTRICT r0,
+           const unsigned char *RESTRICT g0,
+           const unsigned char *RESTRICT b0,
+           const unsigned char *RESTRICT r1,
+           const unsigned char *RESTRICT g1,
+           const unsigned char *RESTRICT b1,
+           const unsigned char *RESTRICT r2,
+           const unsigned char *RESTRICT g2,
+           const unsigned char *RESTRICT b2,
+           int n)
+{
+  int j;
+  for (j = 0; j < n; j++)
+    {
+      int r = r1[j+1], g = g1[j+1], b = b1[j+1];
+      int d = (color_distance (st, r, g, b, r0[j],   g0[j],   b0[j]) +
+               color_distance (st, r, g, b, r0[j+1], g0[j+1], b0[j+1]) +
+               color_distance (st, r, g, b, r1[j],   g1[j],   b1[j]) +
+               color_distance (st, r, g, b, r2[j],   g2[j],   b2[j]));
+      out[j] = d / 4;
+    }
+}
+
+
+/* The planes hold each channel of img as dh+2 rows of dw+1 bytes: a row
+   of black above and below, and a black pixel on the left of each row.
+   Returns the address of pixel 0 of row y, which may be -1 or dh.
+ */
+static unsigned char *
+plane_row (const struct state *st, int channel, int y)
+{
+  return (st->planes +
+          ((size_t) channel * (st->dh + 2) + y + 1) * (st->dw + 1) + 1);
+}
+
+
+struct analyze_thread {
+  struct state *st;
+  unsigned id;
+};
+
+static void
+analyze_band (const struct analyze_thread *t, int *y0, int *y1)
+{
+  unsigned n = t->st->threadpool.count;
+  *y0 = t->st->dh * t->id / n;
+  *y1 = t->st->dh * (t->id + 1) / n;
+}
+
+
+/* Splits this thread's rows of img into the planes.  Most images are 32
+   bits per pixel in our own byte order, and that's just masks and shifts,
+   LANES pixels at a time and then once more for the rest (see lanes.h);
+   anything else goes through XGetPixel.
+ */
+
+static INLINE void
+decode_cells (unsigned char *RESTRICT r, unsigned char *RESTRICT g,
+              unsigned char *RESTRICT b, const unsigned int *RESTRICT p,
+              const unsigned int *mask, const unsigned int *shift, int n)
+{
+  unsigned int rm = mask[0], gm = mask[1], bm = mask[2];
+  unsigned int rs = shift[0], gs = shift[1], bs = shift[2];
+  int j;
+  for (j = 0; j < n; j++)
+    {
+      r[j] = (p[j] & rm) >> rs;
+      g[j] = (p[j] & gm) >> gs;
+      b[j] = (p[j] & bm) >> bs;
+    }
+}
+
+static void
+decode_thread_run (void *self)
+{
+  const struct analyze_thread *t = (const struct analyze_thread *) self;
+  const struct state *st = t->st;
+  const XImage *img = st->img;
+  unsigned long rm = st->mask[0], gm = st->mask[1], bm = st->mask[2];
+  unsigned int rs = st->shift[0], gs = st->shift[1], bs = st->shift[2];
+  Bool fast_p = (img->bits_per_pixel == 32 &&
+                 img->byte_order == (bigendian() ? MSBFirst : LSBFirst));
+  unsigned int mask32[3];
+  int w = st->dw;
+  int x, y, y0, y1;
+
+  mask32[0] = rm;
+  mask32[1] = gm;
+  mask32[2] = bm;
+
+  analyze_band (t, &y0, &y1);
+  for (y = y0; y < y1; y++)
+    {
+      unsigned char *r = plane_row (st, 0, y);
+      unsigned char *g = plane_row (st, 1, y);
+      unsigned char *b = plane_row (st, 2, y);
+      if (fast_p)
+        {
+          const unsigned int *p = (const unsigned int *)
+            (img->data + (size_t) y * img->bytes_per_line);
+          for (x = 0; x + LANES <= w; x += LANES)
+            decode_cells (r + x, g + x, b + x, p + x, mask32, st->shift,
+                          LANES);
+          decode_cells (r + x, g + x, b + x, p + x, mask32, st->shift, w - x);
+        }
+      else
+        for (x = 0; x < w; x++)
+          {
+            unsigned long p = XGetPixel ((XImage *) img, x, y);
+            r[x] = (p & rm) >> rs;
+            g[x] = (p & gm) >> gs;
+            b[x] = (p & bm) >> bs;
+          }
+    }
+}
+
+
+static void
+delta_thread_run (void *self)
+{
+  const struct analyze_thread *t = (const struct analyze_thread *) self;
+  const struct state *st = t->st;
+  int y, y0, y1;
+
+  analyze_band (t, &y0, &y1);
+  for (y = y0; y < y1; y++)
+    {
+      unsigned char *out = st->delta + (size_t) y * st->dw;
+      const unsigned char *r0 = plane_row (st, 0, y-1) - 1;
+      const unsigned char *g0 = plane_row (st, 1, y-1) - 1;
+      const unsigned char *b0 = plane_row (st, 2, y-1) - 1;
+      const unsigned char *r1 = plane_row (st, 0, y)   - 1;
+      const unsigned char *g1 = plane_row (st, 1, y)   - 1;
+      const unsigned char *b1 = plane_row (st, 2, y)   - 1;
+      const unsigned char *r2 = plane_row (st, 0, y+1) - 1;
+      const unsigned char *g2 = plane_row (st, 1, y+1) - 1;
+      const unsigned char *b2 = plane_row (st, 2, y+1) - 1;
+      delta_row (st, out, r0, g0, b0, r1, g1, b1, r2, g2, b2, st->dw);
+    }
+}
+
+
+static int
+analyze_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct analyze_thread *t = (struct analyze_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
 static void *
 tessellimage_init (Display *dpy, Window window)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct analyze_thread),
+    analyze_thread_create,
+    0
+  };
+
   struct state *st = (struct state *) calloc (1, sizeof(*st));
+  int err;
 
   st->dpy = dpy;
   st->window = window;
@@ -101,107 +357,16 @@ tessellimage_init (Display *dpy, Window window)
   st->duration2 = get_float_resource (st->dpy, "duration2", "Seconds");
   if (st->duration2 < 0.001) st->duration = 0.001;
 
-  XClearWindow(st->dpy, st->window);
+  init_distance_tables (st);
 
-  return st;
-}
-
-
-/* Given a bitmask, returns the position and width of the field.
- */
-static void
-decode_mask (unsigned int mask, unsigned int *pos_ret, unsigned int *size_ret)
-{
-  int i;
-  for (i = 0; i < 32; i++)
-    if (mask & (1L << i))
-      {
-        int j = 0;
-        *pos_ret = i;
-        for (; i < 32; i++, j++)
-          if (! (mask & (1L << i)))
-            break;
-        *size_ret = j;
-        return;
-      }
-}
-
-
-static unsigned long
-pixel_distance (Screen *s, Visual *v, unsigned long p1, unsigned long p2)
-{
-  static int initted_p = 0;
-  static unsigned long rmsk=0, gmsk=0, bmsk=0;
-  static unsigned int rpos=0, gpos=0, bpos=0;
-  static unsigned int rsiz=0, gsiz=0, bsiz=0;
-
-  unsigned char r1, g1, b1;
-  unsigned char r2, g2, b2;
-  long distance;
-
-  if (!p1 && !p2) return 0;
-
-  if (! initted_p) {
-    visual_rgb_masks (s, v, &rmsk, &gmsk, &bmsk);
-    decode_mask (rmsk, &rpos, &rsiz);
-    decode_mask (gmsk, &gpos, &gsiz);
-    decode_mask (bmsk, &bpos, &bsiz);
-    initted_p = 1;
-  }
-
-  r1 = (p1 & rmsk) >> rpos;
-  g1 = (p1 & gmsk) >> gpos;
-  b1 = (p1 & bmsk) >> bpos;
+  err = threadpool_create (&st->threadpool, &cls, dpy,
+                           hardware_concurrency (dpy));
+  if (err)
+    threadpool_fatal (progname, err);
 
-  r2 = (p2 & rmsk) >> rpos;
-  g2 = (p2 & gmsk) >> gpos;
-  b2 = (p2 & bmsk) >> bpos;
-
-#if 0
-  /* Compute the distance in linear RGB space.
-   */
-  distance = cbrt (((r2 - r1) * (r2 - r1)) +
-                   ((g2 - g1) * (g2 - g1)) +
-                   ((b2 - b1) * (b2 - b1)));
-
-# elif 1
-  /* Compute the distance in luminance-weighted RGB space.
-   */
-  {
-    int rd = (r2 - r1) * 0.2989 * (1 / 0.5870);
-    int gd = (g2 - g1) * 0.5870 * (1 / 0.5870);
-    int bd = (b2 - b1) * 0.1140 * (1 / 0.5870);
-    distance = cbrt ((rd * rd) + (gd * gd) + (bd * bd));
-  }
-# else
-  /* Compute the distance in brightness-weighted HSV space.
-     (Slower, and doesn't seem to look better than luminance RGB.)
-   */
-  {
-    int h1, h2;
-    double s1, s2;
-    double v1, v2;
-    double hd, sd, vd, dd;
-    rgb_to_hsv (r1, g1, b1, &h1, &s1, &v1);
-    rgb_to_hsv (r2, g2, b2, &h2, &s2, &v2);
-
-    hd = abs (h2 - h1);
-    if (hd >= 180) hd -= 180;
-    hd /= 180.0;
-    sd = fabs (s2 - s1);
-    vd = fabs (v2 - v1);
-
-    /* [hsv]d are now the distance as 0.0 - 1.0. */
-    /* Compute the overall distance, giving more weight to V. */
-    dd = (hd * 0.25 + sd * 0.25 + vd * 0.5);
-
-    if (dd < 0 || dd > 1.0) abort();
-    distance = dd * 255;
-  }
-# endif
+  XClearWindow(st->dpy, st->window);
 
-  if (distance < 0) distance = -distance;
-  return distance;
+  return st;
 }
 
 
@@ -320,52 +485,39 @@ analyze (struct state *st)
   if (st->fill_p) scale_image (st);
 
   /* Create the delta map: color space distance between each pixel.
-     Maybe doing running a Sobel Filter matrix on this would be a
-     better idea.  That might be a bit faster, but I think it would
-     make no visual difference.
+     Unpack the image into channels first, since every pixel gets looked
+     at five times.
    */
-  if (st->delta)
+  st->dw = w;
+  st->dh = h;
+  free (st->planes);
+  free (st->delta);
+  st->planes = (unsigned char *) calloc (3 * (h + 2), w + 1);
+  st->delta = (unsigned char *) malloc ((size_t) w * h);
+  if (!st->planes || !st->delta)
     {
-      free (st->delta->data);
-      st->delta->data = 0;
-      XDestroyImage (st->delta);
+      fprintf (stderr, "%s: out of memory (%u x %u)\n", progname, w, h);
+      abort();
     }
-  st->delta = XCreateImage (st->dpy, st->xgwa.visual, d, ZPixmap, 0, NULL,
-                            w, h, 32, 0);
-  st->delta->data = (char *)
-    calloc (st->delta->height, st->delta->bytes_per_line);
 
-  for (y = 0; y < st->delta->height; y++)
+  visual_rgb_masks (st->xgwa.screen, st->xgwa.visual,
+                    &st->mask[0], &st->mask[1], &st->mask[2]);
+  for (i = 0; i < 3; i++)
     {
-      for (x = 0; x < st->delta->width; x++)
-        {
-          unsigned long pixels[5];
-          int i = 0;
-          int distance = 0;
-          pixels[i++] =                     XGetPixel (st->img, x,   y);
-          pixels[i++] = (x > 0 && y > 0   ? XGetPixel (st->img, x-1, y-1) : 0);
-          pixels[i++] = (         y > 0   ? XGetPixel (st->img, x,   y-1) : 0);
-          pixels[i++] = (x > 0            ? XGetPixel (st->img, x-1, y)   : 0);
-          pixels[i++] = (x > 0 && y < h-1 ? XGetPixel (st->img, x-1, y+1) : 0);
-
-          for (i = 1; i < countof(pixels); i++)
-            distance += pixel_distance (st->xgwa.screen, st->xgwa.visual,
-                                        pixels[0], pixels[i]);
-          distance /= countof(pixels)-1;
-          XPutPixel (st->delta, x, y, distance);
-        }
+      unsigned int size = 0;
+      decode_mask (st->mask[i], &st->shift[i], &size);
     }
 
+  threadpool_run (&st->threadpool, decode_thread_run);
+  threadpool_wait (&st->threadpool);
+  threadpool_run (&st->threadpool, delta_thread_run);
+  threadpool_wait (&st->threadpool);
+
   /* Collect a histogram of every distance value.
    */
   memset (histo, 0, sizeof(histo));
-  for (y = 0; y < st->delta->height; y++)
-    for (x = 0; x < st->delta->width; x++)
-      {
-        unsigned long p = XGetPixel (st->delta, x, y);
-        if (p > countof(histo)) abort();
-        histo[p]++;
-      }
+  for (i = 0; i < w * h; i++)
+    histo[st->delta[i]]++;
 
   /* Convert that from "occurrences of N" to ">= N".
    */
@@ -412,6 +564,39 @@ analyze (struct state *st)
           }
       }
   }
+
+  /* Sort the pixels at or above the lowest threshold by delta, highest
+     first, so that the control points for any threshold are just the
+     first vsize of them.  histo[i+1] is where those with delta i start.
+   */
+  free (st->features);
+  st->features = 0;
+  if (st->nthreshes)
+    {
+      unsigned long start[countof(histo)];
+      int lowest = st->threshes[st->nthreshes-1];
+      st->features = (XYZ *)
+        malloc (st->vsizes[st->nthreshes-1] * sizeof(*st->features));
+      if (! st->features)
+        {
+          fprintf (stderr, "%s: out of memory\n", progname);
+          abort();
+        }
+      for (i = 0; i < countof(histo); i++)
+        start[i] = (i + 1 < countof(histo) ? histo[i+1] : 0);
+      for (y = 0; y < h; y++)
+        {
+          const unsigned char *row = st->delta + (size_t) y * w;
+          for (x = 0; x < w; x++)
+            if (row[x] >= lowest)
+              {
+                XYZ *f = &st->features[start[row[x]]++];
+                f->x = x;
+                f->y = y;
+                f->z = row[x];
+              }
+        }
+    }
   
   st->thresh = 0;   /* startup */
   st->dthresh = 1;  /* forward */
@@ -458,66 +643,23 @@ small_cell_p (const voronoi_polygon *p)
 }
 
 
-static int
-cmp_ccw (const void *v1, const void *v2)
-{
-  const voronoi_pa *p1,*p2;
-  p1 = v1;
-  p2 = v2;
-  if      (p1->slope < p2->slope) return -1;
-  else if (p1->slope > p2->slope) return  1;
-  return 0;
-}
-
-static void
-sort_ccw (XPoint *ctr, XPoint *p, int npoints)
-{
-  voronoi_pa *pa = (void *) malloc (npoints * sizeof(*pa));
-  int i;
-  for (i = 0; i < npoints; i++)
-    {
-      pa[i].p = p[i];
-      pa[i].slope = atan2 (p[i].x - ctr->x, p[i].y - ctr->y);
-    }
-  qsort (pa, npoints, sizeof(*pa), cmp_ccw);
-  for (i = 0; i < npoints; i++)
-    p[i] = pa[i].p;
-  free (pa);
-}
-
-
+/* The corners of each cell are the centers of the triangles around its
+   point, which the mesh hands us in order.
+ */
 static voronoi_polygon *
-delaunay_to_voronoi (int np, XYZ *p, int nv, ITRIANGLE *v, double scale)
+delaunay_to_voronoi (int np, const XYZ *p, const DELAUNAY_MESH *m,
+                     double scale)
 {
-  struct tri_list {
-    int count, size;
-    int *tri;
-  };
-
   int i, j;
-  struct tri_list *vert_to_tri = (struct tri_list *)
-    calloc (np + 1, sizeof(*vert_to_tri));
   voronoi_polygon *out = (voronoi_polygon *) calloc (np + 1, sizeof(*out));
+  XPoint *centers = (XPoint *) malloc ((m->ntri + 1) * sizeof(*centers));
+  if (!out || !centers) abort();
 
-  /* Iterate the triangles to construct a map of vertices to the
-     triangles that contain them.
-   */
-  for (i = 0; i < nv; i++)
+  for (i = 0; i < m->ntri; i++)
     {
-      for (j = 0; j < 3; j++)	/* iterate points in each triangle */
-        {
-          int p = *((&v[i].p1) + j);
-          struct tri_list *t = &vert_to_tri[p];
-          if (p < 0 || p >= np) abort();
-          if (t->size <= t->count + 1)
-            {
-              t->size += 3;
-              t->size *= 1.3;
-              t->tri = realloc (t->tri, t->size * sizeof(*t->tri));
-              if (! t->tri) abort();
-            }
-          t->tri[t->count++] = i;
-        }
+      const int *v = m->vertex + 3 * i;
+      centers[i].x = scale * (p[v[0]].x + p[v[1]].x + p[v[2]].x) / 3;
+      centers[i].y = scale * (p[v[0]].y + p[v[1]].y + p[v[2]].y) / 3;
     }
 
   /* For every vertex, compose a polygon whose corners are the centers
@@ -529,35 +671,34 @@ delaunay_to_voronoi (int np, XYZ *p, int nv, ITRIANGLE *v, double scale)
   for (i = 0; i < np; i++)
     {
       long ctr_x = 0, ctr_y = 0;
-      struct tri_list *t = &vert_to_tri[i];
-      int n = t->count;
-      if (n < 3) n = 0;
+      int e0 = m->edge[i], e, n = 0;
+      if (e0 < 0) continue;
+
+      e = e0;
+      do {
+        n++;
+        e = m->twin[DELAUNAY_PREV (e)];
+      } while (e >= 0 && e != e0);
+      if (n < 3) continue;
+
       out[i].npoints = n;
-      if (n == 0) continue;
-      out[i].ctr.x = out[i].ctr.y = 0;
-      out[i].p = (n > 0
-                  ? (XPoint *) calloc (out[i].npoints + 1, sizeof (*out[i].p))
-                  : 0);
-      for (j = 0; j < out[i].npoints; j++)
+      out[i].p = (XPoint *) calloc (n + 1, sizeof (*out[i].p));
+      if (! out[i].p) abort();
+      e = e0;
+      for (j = 0; j < n; j++)
         {
-          ITRIANGLE *tt = &v[t->tri[j]];
-          out[i].p[j].x = scale * (p[tt->p1].x + p[tt->p2].x + p[tt->p3].x) / 3;
-          out[i].p[j].y = scale * (p[tt->p1].y + p[tt->p2].y + p[tt->p3].y) / 3;
+          out[i].p[j] = centers[e / 3];
           ctr_x += out[i].p[j].x;
           ctr_y += out[i].p[j].y;
+          e = m->twin[DELAUNAY_PREV (e)];
         }
       out[i].ctr.x = ctr_x / out[i].npoints;  /* long -> short */
       out[i].ctr.y = ctr_y / out[i].npoints;
       if (out[i].ctr.x < 0) abort();
       if (out[i].ctr.y < 0) abort();
-      sort_ccw (&out[i].ctr, out[i].p, out[i].npoints);
     }
 
-  for (i = 0; i < np+1; i++)
-    if (vert_to_tri[i].tri)
-      free (vert_to_tri[i].tri);
-  free (vert_to_tri);
-
+  free (centers);
   return out;
 }
 
@@ -619,28 +760,24 @@ tessellate (struct state *st)
     }
   else if (ticked_p)
     {
-      int threshold = st->threshes[st->thresh];
       int vsize = st->vsizes[st->thresh];
-      ITRIANGLE *v;
+      DELAUNAY_MESH m;
       XYZ *p = 0;
       int nv = 0;
-      int ntri = 0;
       int x, y, i;
-      double wscale = st->xgwa.width / (double) st->delta->width;
+      double wscale = st->xgwa.width / (double) st->dw;
 
 #if 0
       fprintf(stderr, "%s: thresh %d/%d = %d=%d\n", 
-              progname, st->thresh, st->nthreshes, threshold, vsize);
+              progname, st->thresh, st->nthreshes, st->threshes[st->thresh],
+              vsize);
 #endif
 
       /* Create a control point at every pixel where the delta is above
          the current threshold.  Triangulate from those. */
 
-      vsize += 8;  /* corners of screen + corners of image */
-
-      p = (XYZ *) calloc (vsize+4, sizeof(*p));
-      v = (ITRIANGLE *) calloc (3*(vsize+4), sizeof(*v));
-      if (!p || !v)
+      p = (XYZ *) calloc (vsize + 8, sizeof(*p));
+      if (!p)
         {
           fprintf (stderr, "%s: out of memory (%d)\n", progname, vsize);
           abort();
@@ -649,42 +786,32 @@ tessellate (struct state *st)
       /* Add control points for the corners of the screen, and for the
          corners of the image.
        */
-      if (st->geom.width  <= 0) st->geom.width  = st->delta->width;
-      if (st->geom.height <= 0) st->geom.height = st->delta->height;
+      if (st->geom.width  <= 0) st->geom.width  = st->dw;
+      if (st->geom.height <= 0) st->geom.height = st->dh;
 
       for (y = 0; y <= 1; y++)
         for (x = 0; x <= 1; x++)
           {
-            p[nv].x = x ? st->delta->width-1  : 0;
-            p[nv].y = y ? st->delta->height-1 : 0;
-            p[nv].z = XGetPixel (st->delta, (int) p[nv].x, (int) p[nv].y);
+            p[nv].x = x ? st->dw-1 : 0;
+            p[nv].y = y ? st->dh-1 : 0;
+            p[nv].z = st->delta[(int) p[nv].y * st->dw + (int) p[nv].x];
             nv++;
             p[nv].x = st->geom.x + (x ? st->geom.width-1  : 0);
             p[nv].y = st->geom.y + (y ? st->geom.height-1 : 0);
-            p[nv].z = XGetPixel (st->delta, (int) p[nv].x, (int) p[nv].y);
+            p[nv].z = st->delta[(int) p[nv].y * st->dw + (int) p[nv].x];
             nv++;
           }
 
-      /* Add control points for every pixel that exceeds the threshold.
+      /* The pixels that exceed the threshold are the first vsize of
+         the features.
        */
-      for (y = 0; y < st->delta->height; y++)
-        for (x = 0; x < st->delta->width; x++)
-          {
-            unsigned long px = XGetPixel (st->delta, x, y);
-            if (px >= threshold)
-              {
-                if (nv >= vsize) abort();
-                p[nv].x = x;
-                p[nv].y = y;
-                p[nv].z = px;
-                nv++;
-              }
-          }
+      memcpy (p + nv, st->features, vsize * sizeof(*p));
+      nv += vsize;
+      vsize += 8;  /* corners of screen + corners of image */
 
       if (nv != vsize) abort();
 
-      qsort (p, nv, sizeof(*p), delaunay_xyzcompare);
-      if (delaunay (nv, p, v, &ntri))
+      if (delaunay_mesh (nv, p, &m))
         {
           fprintf (stderr, "%s: out of memory\n", progname);
           abort();
@@ -704,7 +831,7 @@ tessellate (struct state *st)
       case VORONOI:
         {
           voronoi_polygon *polys =
-            delaunay_to_voronoi (nv, p, ntri, v, wscale);
+            delaunay_to_voronoi (nv, p, &m, wscale);
           for (i = 0; i < nv; i++)
             {
               if (polys[i].npoints >= 3)
@@ -746,13 +873,14 @@ tessellate (struct state *st)
         break;
 
       case DELAUNAY:
-        for (i = 0; i < ntri; i++)
+        for (i = 0; i < m.ntri; i++)
           {
+            const int *v = m.vertex + 3 * i;
             XPoint xp[3];
             unsigned long color;
-            xp[0].x = p[v[i].p1].x * wscale; xp[0].y = p[v[i].p1].y * wscale;
-            xp[1].x = p[v[i].p2].x * wscale; xp[1].y = p[v[i].p2].y * wscale;
-            xp[2].x = p[v[i].p3].x * wscale; xp[2].y = p[v[i].p3].y * wscale;
+            xp[0].x = p[v[0]].x * wscale; xp[0].y = p[v[0]].y * wscale;
+            xp[1].x = p[v[1]].x * wscale; xp[1].y = p[v[1]].y * wscale;
+            xp[2].x = p[v[2]].x * wscale; xp[2].y = p[v[2]].y * wscale;
 
             /* Set the color of this triangle to the pixel at its midpoint. */
             color = XGetPixel (st->img,
@@ -788,7 +916,7 @@ tessellate (struct state *st)
       }
 
       free (p);
-      free (v);
+      delaunay_mesh_free (&m);
 
       if (st->cache_p && !st->cache[st->thresh])
         {
@@ -820,11 +948,15 @@ tessellate (struct state *st)
 static Pixmap
 get_deltap (struct state *st)
 {
-  int x, y;
+  int x, y, i;
   int w = st->xgwa.width;
   int h = st->xgwa.height;
-  double wscale = st->xgwa.width / (double) st->delta->width;
+  double wscale = st->xgwa.width / (double) st->dw;
   XImage *dimg;
+  row_writer writer;
+  unsigned long palette[256];
+  unsigned char *row;
+  int *cols;
 
   Visual *v = st->xgwa.visual;
   unsigned long rmsk=0, gmsk=0, bmsk=0;
@@ -838,21 +970,43 @@ get_deltap (struct state *st)
   decode_mask (gmsk, &gpos, &gsiz);
   decode_mask (bmsk, &bpos, &bsiz);
 
+  for (i = 0; i < countof(palette); i++)
+    {
+      unsigned long c = (unsigned long) i << 5;
+      palette[i] = (((c << rpos) & rmsk) |
+                    ((c << gpos) & gmsk) |
+                    ((c << bpos) & bmsk));
+    }
+
   dimg = XCreateImage (st->dpy, st->xgwa.visual, st->xgwa.depth,
                        ZPixmap, 0, NULL, w, h, 8, 0);
   if (! dimg) abort();
   dimg->data = (char *) calloc (dimg->height, dimg->bytes_per_line);
   if (! dimg->data) abort();
+  init_row_writer (&writer, dimg);
+
+  /* Each row of the window is a row of the delta map, stretched. */
+  row  = (unsigned char *) malloc (w);
+  cols = (int *) malloc (w * sizeof(*cols));
+  if (!row || !cols) abort();
+  for (x = 0; x < w; x++)
+    {
+      cols[x] = x / wscale;
+      if (cols[x] >= st->dw) cols[x] = st->dw - 1;
+    }
 
   for (y = 0; y < h; y++)
-    for (x = 0; x < w; x++)
-      {
-        unsigned long v = XGetPixel (st->delta, x / wscale, y / wscale) << 5;
-        unsigned long p = (((v << rpos) & rmsk) |
-                           ((v << gpos) & gmsk) |
-                           ((v << bpos) & bmsk));
-        XPutPixel (dimg, x, y, p);
-      }
+    {
+      int dy = y / wscale;
+      const unsigned char *d;
+      if (dy >= st->dh) dy = st->dh - 1;
+      d = st->delta + (size_t) dy * st->dw;
+      for (x = 0; x < w; x++)
+        row[x] = d[cols[x]];
+      writer.indexed (&writer, 0, y, w, row, palette);
+    }
+  free (row);
+  free (cols);
 
   st->deltap = XCreatePixmap (st->dpy, st->window, w, h, st->xgwa.depth);
   XPutImage (st->dpy, st->deltap, st->pgc, dimg, 0, 0, 0, 0, w, h);
@@ -964,8 +1118,12 @@ tessellimage_free (Display *dpy, Window window, void *closure)
   if (st->pgc) XFreeGC (dpy, st->pgc);
   if (st->image)  XFreePixmap (dpy, st->image);
   if (st->output) XFreePixmap (dpy, st->output);
-  if (st->delta)  XDestroyImage (st->delta);
   if (st->img)    XDestroyImage (st->img);
+  threadpool_destroy (&st->threadpool);
+  free (st->planes);
+  free (st->delta);
+  free (st->features);
+  free (st->cube_root);
   free (st);
 }
 
@@ -987,6 +1145,7 @@ static const char *tessellimage_defaults [] = {
   "*outline:			True",
   "*fillScreen:			True",
   "*cache:			True",
+  THREAD_DEFAULTS
 #ifdef HAVE_MOBILE
   "*ignoreRotation:             True",
   "*rotateImages:               True",
@@ -1007,6 +1166,7 @@ static XrmOptionDescRec tessellimage_options [] = {
   { "-no-fill-screen",	".fillScreen",		XrmoptionNoArg, "False" },
   { "-cache",		".cache",		XrmoptionNoArg, "True"  },
   { "-no-cache",	".cache",		XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -37,6 +37,8 @@ static const char sccsid[] = "@(#)thornbird.c	5.00 2000/11/01 xlockmore";
 					 "*ncolors: 64    \n" \
 					 "*fpsSolid: true    \n" \
 					"*ignoreRotation: True \n" \
+					"*useSHM: True \n" \
+					POINTCLOUD_DEFAULTS_XLOCK
 
 /*				    "*lowrez: True \n" \ */
 
@@ -49,10 +51,18 @@ static const char sccsid[] = "@(#)thornbird.c	5.00 2000/11/01 xlockmore";
 # include "xlock.h"		/* in xlockmore distribution */
 #endif /* STANDALONE */
 
+#include "pointcloud.h"
+
 #ifdef MODE_thornbird
 
+static XrmOptionDescRec opts[] =
+{
+	POINTCLOUD_OPTIONS
+};
+
 ENTRYPOINT ModeSpecOpt thornbird_opts =
-{0, (XrmOptionDescRec *) NULL, 0, (argtype *) NULL, (OptionStruct *) NULL};
+{sizeof opts / sizeof opts[0], opts, 0, (argtype *) NULL,
+ (OptionStruct *) NULL};
 
 #ifdef USE_MODULES
 ModStruct   thornbird_description =
@@ -89,8 +99,11 @@ typedef struct {
 	int         pix;
 	int         count;
 	int         nbuffers;
+	int         nplotted;	/* how many of those have been drawn yet */
 	int         scale;
-	XRectangle **pointBuffer;
+	unsigned  **pointBuffer;	/* cells of each of the last nbuffers batches */
+	int        *xs, *ys;
+	pointcloud *cloud;
 } thornbirdstruct;
 
 static thornbirdstruct *thornbirds = (thornbirdstruct *) NULL;
@@ -108,6 +121,13 @@ free_thornbird(ModeInfo * mi)
 		(void) free((void *) hp->pointBuffer);
 		hp->pointBuffer = NULL;
 	}
+	if (hp->xs != NULL)
+		(void) free((void *) hp->xs);
+	if (hp->ys != NULL)
+		(void) free((void *) hp->ys);
+	hp->xs = hp->ys = NULL;
+	pointcloud_free(hp->cloud);
+	hp->cloud = NULL;
 }
 
 ENTRYPOINT void
@@ -134,19 +154,31 @@ init_thornbird (ModeInfo * mi)
 
 	hp->nbuffers = MI_CYCLES(mi);
 
-	if (hp->pointBuffer == NULL)
-		if ((hp->pointBuffer = (XRectangle **) calloc(MI_CYCLES(mi),
-				sizeof (*hp->pointBuffer))) == NULL) {
-			free_thornbird(mi);
-			return;
-		}
+	if (MI_COUNT(mi) < 1) MI_COUNT(mi) = 1;
+	free_thornbird(mi);
+	if ((hp->pointBuffer = (unsigned **) calloc(MI_CYCLES(mi),
+			sizeof (*hp->pointBuffer))) == NULL) {
+		free_thornbird(mi);
+		return;
+	}
 
-	if (hp->pointBuffer[0] == NULL)
-		if ((hp->pointBuffer[0] = (XRectangle *) malloc(MI_COUNT(mi) *
-				sizeof (**hp->pointBuffer))) == NULL) {
-			free_thornbird(mi);
-			return;
-		}
+	hp->nplotted = 0;
+	if ((hp->pointBuffer[0] = (unsigned *) malloc(MI_COUNT(mi) *
+			sizeof (**hp->pointBuffer))) == NULL ||
+		(hp->xs = (int *) malloc(MI_COUNT(mi) * sizeof (*hp->xs))) == NULL ||
+		(hp->ys = (int *) malloc(MI_COUNT(mi) * sizeof (*hp->ys))) == NULL) {
+		free_thornbird(mi);
+		return;
+	}
+
+	hp->cloud = pointcloud_new(MI_DISPLAY(mi), MI_WINDOW(mi), hp->scale);
+	if (MI_NPIXELS(mi) > 2)
+		pointcloud_colors(hp->cloud, MI_NPIXELS(mi), mi->pixels,
+						  MI_BLACK_PIXEL(mi));
+	else {
+		unsigned long white = MI_WHITE_PIXEL(mi);
+		pointcloud_colors(hp->cloud, 1, &white, MI_BLACK_PIXEL(mi));
+	}
 
 	/* select frequencies for parameter variation */
 	hp->liss.f1 = LRAND() % 5000;
@@ -168,15 +200,13 @@ init_thornbird (ModeInfo * mi)
 ENTRYPOINT void
 draw_thornbird(ModeInfo * mi)
 {
-	Display    *dsp = MI_DISPLAY(mi);
-	Window      win = MI_WINDOW(mi);
 	double      oldj, oldi;
 	int         batchcount = MI_COUNT(mi);
 	int         k;
-	XRectangle *xp;
-	GC          gc = MI_GC(mi);
+	int        *xp, *yp;
 	int         erase;
 	int         current;
+	int         color = 0;
 
 	double      sint, cost, sinp, cosp;
 	thornbirdstruct *hp;
@@ -192,7 +222,8 @@ draw_thornbird(ModeInfo * mi)
 	k = batchcount;
 
 
-	xp = hp->pointBuffer[current];
+	xp = hp->xs;
+	yp = hp->ys;
 
 	/* vary papameters */
 	hp->a = 1.99 + (0.4 * sin(hp->inc / hp->liss.f1) +
@@ -216,31 +247,28 @@ draw_thornbird(ModeInfo * mi)
 		hp->i = (1 - hp->c) * cos(M_PI * hp->a * oldj) + hp->c * hp->b;
 		hp->b = oldj;
 
-		xp->x = (short)
+		*xp++ = (int)
 		  (hp->maxx / 2 * (1
 						   + sint*hp->j + cost*cosp*hp->i - cost*sinp*hp->b));
-		xp->y = (short)
+		*yp++ = (int)
 		  (hp->maxy / 2 * (1
 						   - cost*hp->j + sint*cosp*hp->i - sint*sinp*hp->b));
-		xp->width = xp->height = hp->scale;
-		xp++;
 	}
 
 	MI_IS_DRAWN(mi) = True;
 
-    if (MI_COUNT(mi) < 1) MI_COUNT(mi) = 1;
 	if (hp->pointBuffer[erase] == NULL) {
-		if ((hp->pointBuffer[erase] = (XRectangle *) malloc(MI_COUNT(mi) *
+		if ((hp->pointBuffer[erase] = (unsigned *) malloc(MI_COUNT(mi) *
 				sizeof (**hp->pointBuffer))) == NULL) {
 			free_thornbird(mi);
 			return;
 		}
-	} else {
-		XSetForeground(dsp, gc, MI_BLACK_PIXEL(mi));
-		XFillRectangles(dsp, win, gc, hp->pointBuffer[erase], batchcount);
 	}
+	/* Batches are filled in order, so only the first nplotted hold points. */
+	if (erase < hp->nplotted)
+		pointcloud_unplot(hp->cloud, batchcount, hp->pointBuffer[erase]);
 	if (MI_NPIXELS(mi) > 2) {
-		XSetForeground(dsp, gc, MI_PIXEL(mi, hp->pix));
+		color = hp->pix;
 #if 0
 		if (erase == 0) /* change colours after "cycles" cycles */
 #else
@@ -248,10 +276,14 @@ draw_thornbird(ModeInfo * mi)
 #endif
 			if (++hp->pix >= MI_NPIXELS(mi))
 				hp->pix = 0;
-	} else
-		XSetForeground(dsp, gc, MI_WHITE_PIXEL(mi));
+	}
 
-	XFillRectangles(dsp, win, gc, hp->pointBuffer[current], batchcount);
+	pointcloud_cells(hp->cloud, batchcount, hp->xs, hp->ys,
+					 hp->pointBuffer[current]);
+	pointcloud_plot(hp->cloud, batchcount, hp->pointBuffer[current], color);
+	if (hp->nplotted <= current)
+		hp->nplotted = current + 1;
+	pointcloud_render(hp->cloud, MI_WINDOW(mi), MI_GC(mi));
 	hp->inc++;
 }
 
@@ -16,6 +16,7 @@
 #include <math.h>
 #include "screenhack.h"
 #include "xshm.h"
+#include "rowwriter.h"
 
 #define FLOAT double
 
@@ -59,6 +60,10 @@ struct state {
   Screen *screen;       	   /* the screen to draw on */
   XImage *sourceImage;  	   /* image source of stuff to draw */
   XImage *workImage;    	   /* work area image, used when rendering */
+  row_writer sourceWriter;
+  row_writer workWriter;
+  int *rowXs, *rowYs;		   /* source coordinates for one row */
+  unsigned long *rowPixels;	   /* and the pixels for that row */
 
   GC backgroundGC;        	 /* GC for the background color */
   GC foregroundGC;        	 /* GC for the foreground color */
@@ -131,6 +136,22 @@ grabImage_done (struct state *st)
     st->workImage = create_xshm_image (st->dpy, xwa.visual, xwa.depth,
                                        ZPixmap, &st->shmInfo,
                                        st->windowWidth, st->windowHeight);
+
+    init_row_writer (&st->sourceWriter, st->sourceImage);
+    init_row_writer (&st->workWriter, st->workImage);
+
+    if (! st->rowXs)
+    {
+	st->rowXs = (int *) calloc (st->windowWidth, sizeof (int));
+	st->rowYs = (int *) calloc (st->windowWidth, sizeof (int));
+	st->rowPixels = (unsigned long *)
+	    calloc (st->windowWidth, sizeof (unsigned long));
+	if (!st->rowXs || !st->rowYs || !st->rowPixels)
+	{
+	    fprintf (stderr, "%s: out of memory\n", progname);
+	    exit (1);
+	}
+    }
 }
 
 /* set up the system */
@@ -469,11 +490,16 @@ static void renderTile (struct state *st, Tile *t)
     sinAng /= zoom;
     cosAng /= zoom;
 
+    /* The tile and its inside are both convex, so each row crosses the
+     * tile in one run of pixels, and the inside in one run within that:
+     * gather the inside from the source, and write the whole run at once. */
     for (y = minY, prey = y - ty; y < maxY; y++, prey++)
     {
 	FLOAT prex = minX - tx;
 	FLOAT srcx = prex * cosAng - prey * sinAng;
 	FLOAT srcy = prex * sinAng + prey * cosAng;
+	int n = 0, x0 = minX;
+	int m = 0, i0 = 0;
 
 	for (x = minX; 
 	     x < maxX; 
@@ -487,15 +513,25 @@ static void renderTile (struct state *st, Tile *t)
 		{
 		    continue;
 		}
-		XPutPixel (st->workImage, x, y, st->borderPixel);
+		if (n == 0) x0 = x;
+		st->rowPixels[n++] = st->borderPixel;
 	    }
 	    else
 	    {
-		unsigned long p = 
-		    XGetPixel (st->sourceImage, srcx + tx, srcy + ty);
-		XPutPixel (st->workImage, x, y, p);
+		if (n == 0) x0 = x;
+		if (m == 0) i0 = n;
+		st->rowXs[m] = srcx + tx;
+		st->rowYs[m] = srcy + ty;
+		m++;
+		n++;
 	    }
 	}
+
+	if (m)
+	    st->sourceWriter.gather (&st->sourceWriter, m,
+				     st->rowXs, st->rowYs, st->rowPixels + i0);
+	if (n)
+	    st->workWriter.pixels (&st->workWriter, x0, y, n, st->rowPixels);
     }
 }
 
@@ -635,6 +671,9 @@ twang_free (Display *dpy, Window window, void *closure)
   if (st->workImage) destroy_xshm_image (st->dpy, st->workImage, &st->shmInfo);
   if (st->tiles) free (st->tiles);
   if (st->sortedTiles) free (st->sortedTiles);
+  if (st->rowXs) free (st->rowXs);
+  if (st->rowYs) free (st->rowYs);
+  if (st->rowPixels) free (st->rowPixels);
 
   free (st);
 }
@@ -58,11 +58,20 @@
 # define MIN(A,B) ((A)<(B)?(A):(B))
 
 #include "xshm.h"
+#include "rowwriter.h"
+#include "thread_util.h"
+#include "lanes.h"
 
 #include "images/gen/bob_png.h"
 
 #define MAX_VAL             255
 
+/* How many rows each threaded pass of FlameAdvance works through.  Fire
+   spreads sideways by one column per row, so each thread also recomputes
+   this many of its neighbors' columns on either side of its own.
+ */
+#define BAND_ROWS           32
+
 struct state {
   Display *dpy;
   Window window;
@@ -76,7 +85,17 @@ struct state {
   XImage          *xim;
   XShmSegmentInfo shminfo;
   GC              gc;
-  int             ctab[256];
+  unsigned long   ctab[256];
+  row_writer      writer;
+  int             scale;
+
+  struct threadpool threadpool;
+  unsigned char  *rows;         /* Per thread: Flame2Image's index rows. */
+  unsigned short *spread;       /* Per thread: sideways spread of a row. */
+  unsigned char  *band;         /* Per thread: BAND_ROWS+1 rows of flame. */
+  int            *used;         /* Per thread: top-most burning row. */
+  unsigned char  *edge;         /* Two rows passed between passes. */
+  int             pass, pass_top, pass_rows, prev_top, prev_rows;
 
   unsigned char  *flame;
   unsigned char  *theim;
@@ -98,6 +117,11 @@ struct state {
   int theimx, theimy;
 };
 
+struct thread {
+  struct state *st;
+  unsigned id;
+};
+
 static void
 GetXInfo(struct state *st)
 {
@@ -133,6 +157,16 @@ MakeImage(struct state *st)
       fprintf(stderr,"%s: out of memory.\n", progname);
       exit(1);
     }
+  init_row_writer (&st->writer, st->xim);
+
+  if (st->rows) free (st->rows);
+  st->rows = (unsigned char *) malloc (st->width * 2 *
+                                      st->threadpool.count);
+  if (!st->rows)
+    {
+      fprintf(stderr,"%s: out of memory.\n", progname);
+      exit(1);
+    }
 
   if (! st->gc)
     st->gc = XCreateGC(st->dpy,st->window,0,&gcv);
@@ -178,7 +212,7 @@ InitColors(struct state *st)
 
       XAllocColor(st->dpy,st->colormap,&xcl);
 
-      st->ctab[j++] = (int)xcl.pixel;
+      st->ctab[j++] = xcl.pixel;
     }
 }
 
@@ -186,23 +220,35 @@ InitColors(struct state *st)
 static void
 DisplayImage(struct state *st)
 {
-  put_xshm_image(st->dpy, st->window, st->gc, st->xim, 0,(st->top - 1) << 1, 0,
-                 (st->top - 1) << 1, st->width, st->height - ((st->top - 1) << 1),
-                 &st->shminfo);
+  int y = (st->top - 1) * st->scale;
+  put_xshm_image(st->dpy, st->window, st->gc, st->xim, 0, y, 0, y,
+                 st->width, st->height - y, &st->shminfo);
 }
 
 
 static void
 InitFlame(struct state *st)
 {
-  st->fwidth  = st->width / 2;
-  st->fheight = st->height / 2;
+  int n = st->threadpool.count;
 
-  if (st->flame) free (st->flame);
+  st->fwidth  = st->width / st->scale;
+  st->fheight = st->height / st->scale;
+
+  if (st->flame)  free (st->flame);
+  if (st->spread) free (st->spread);
+  if (st->band)   free (st->band);
+  if (st->used)   free (st->used);
+  if (st->edge)   free (st->edge);
   st->flame   = (unsigned char *) calloc((st->fwidth + 2) * (st->fheight + 2),
                                          sizeof(unsigned char));
-
-  if (!st->flame)
+  st->spread  = (unsigned short *) calloc ((st->fwidth + 2) * n,
+                                           sizeof(*st->spread));
+  st->band    = (unsigned char *) malloc ((st->fwidth + 2) *
+                                          (BAND_ROWS + 1) * n);
+  st->used    = (int *) malloc (n * sizeof(*st->used));
+  st->edge    = (unsigned char *) malloc ((st->fwidth + 2) * 2);
+
+  if (!st->flame || !st->spread || !st->band || !st->used || !st->edge)
     {
       fprintf(stderr,"%s: out of memory\n", progname);
       exit(1);
@@ -244,195 +290,72 @@ InitFlame(struct state *st)
 }
 
 
+/* Writes flame rows y0 through y1-1 into the image.  At the default scale,
+   each flame cell becomes a 2x2 block of pixels: the cell itself, and its
+   averages with the neighbors to the right, below, and below-right.
+ */
 static void
-Flame2Image16(struct state *st)
+flame_to_image (struct state *st, unsigned char *rows, int y0, int y1)
 {
   int x,y;
-  unsigned short *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
+  int fw = st->fwidth + 2;
+  unsigned char *ptr1 = st->flame + 1 + (y0 * fw);
+  unsigned char *upper = rows;
+  unsigned char *lower = rows + st->width;
 
-  ptr  = (unsigned short *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
-
-  for(y = st->top; y < st->fheight; y++)
+  if (st->scale == 1)
     {
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned short)st->ctab[v1];
-          *ptr   = (unsigned short)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned short)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned short)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
-        }
-      ptr  += st->width;
-      ptr1 += 2;
+      for (y = y0; y < y1; y++, ptr1 += fw)
+        st->writer.indexed (&st->writer, 0, y, st->fwidth, ptr1, st->ctab);
+      return;
     }
-}
 
-static void
-Flame2Image32(struct state *st)
-{
-  int x,y;
-  unsigned int *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
-
-  ptr  = (unsigned int *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
-
-  for( y = st->top; y < st->fheight; y++)
+  for (y = y0; y < y1; y++)
     {
-      for( x = 0; x < st->fwidth; x++)
+      for (x = 0; x < st->fwidth; x++)
         {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned int)st->ctab[v1];
-          *ptr   = (unsigned int)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned int)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned int)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
+          int v1 = ptr1[x];
+          int v2 = ptr1[x + 1];
+          int v3 = ptr1[x + fw];
+          int v4 = ptr1[x + fw + 1];
+          upper[(x << 1)]     = v1;
+          upper[(x << 1) + 1] = (v1 + v2) >> 1;
+          lower[(x << 1)]     = (v1 + v3) >> 1;
+          lower[(x << 1) + 1] = (v1 + v4) >> 1;
         }
-      ptr  += st->width;
-      ptr1 += 2;
+      st->writer.indexed (&st->writer, 0, (y << 1),     st->fwidth << 1,
+                          upper, st->ctab);
+      st->writer.indexed (&st->writer, 0, (y << 1) + 1, st->fwidth << 1,
+                          lower, st->ctab);
+      ptr1 += fw;
     }
 }
 
-static void
-Flame2Image24(struct state *st)
-{
-  int x,y;
-  unsigned char *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
-
-  ptr  = (unsigned char *)st->xim->data;
-  ptr += (st->top << 1) * st->xim->bytes_per_line;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
-
-  for( y = st->top; y < st->fheight; y++)
-    {
-      unsigned char *last_ptr = ptr;
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-
-          ptr[2] = ((unsigned int)st->ctab[v1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[v1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[v1] & 0x000000FF);
-          ptr += 3;
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v2) >> 1] & 0x000000FF);
-          ptr += ((st->width - 1) * 3);
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v3) >> 1] & 0x000000FF);
-          ptr += 3;
-
-          ptr[2] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x00FF0000) >> 16;
-          ptr[1] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x0000FF00) >> 8;
-          ptr[0] = ((unsigned int)st->ctab[(v1 + v4) >> 1] & 0x000000FF);
-          ptr -= ((st->width - 1) * 3);
-        }
-
-      ptr = last_ptr + (st->xim->bytes_per_line << 1);
-      ptr1 += 2;
-    }
-}
 
+/* Each thread renders a band of rows; the row below each band is only read.
+ */
 static void
-Flame2Image8(struct state *st)
+flame_to_image_thread (void *self)
 {
-  int x,y;
-  unsigned char *ptr;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
-
-  ptr  = (unsigned char *)st->xim->data;
-  ptr += (st->top << 1) * st->width;
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
-
-  for(y=st->top;y<st->fheight;y++)
-    {
-      for(x=0;x<st->fwidth;x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          *ptr++ = (unsigned char)st->ctab[v1];
-          *ptr   = (unsigned char)st->ctab[(v1 + v2) >> 1];
-          ptr   += st->width - 1;
-          *ptr++ = (unsigned char)st->ctab[(v1 + v3) >> 1];
-          *ptr   = (unsigned char)st->ctab[(v1 + v4) >> 1];
-          ptr   -= st->width - 1;
-        }
-      ptr  += st->width;
-      ptr1 += 2;
-    }
+  const struct thread *t = (const struct thread *) self;
+  struct state *st = t->st;
+  int n = st->threadpool.count;
+  int h = st->fheight - st->top;
+  flame_to_image (st, st->rows + t->id * st->width * 2,
+                  st->top + h * t->id / n,
+                  st->top + h * (t->id + 1) / n);
 }
 
-static void
-Flame2Image1234567(struct state *st)
-{
-  int x,y;
-  unsigned char *ptr1;
-  int v1,v2,v3,v4;
-
-  ptr1 = st->flame + 1 + (st->top * (st->fwidth + 2));
-
-  for( y = st->top; y < st->fheight; y++)
-    {
-      for( x = 0; x < st->fwidth; x++)
-        {
-          v1 = (int)*ptr1;
-          v2 = (int)*(ptr1 + 1);
-          v3 = (int)*(ptr1 + st->fwidth + 2);
-          v4 = (int)*(ptr1 + st->fwidth + 2 + 1);
-          ptr1++;
-          XPutPixel(st->xim,(x << 1),    (y << 1),    st->ctab[v1]);
-          XPutPixel(st->xim,(x << 1) + 1,(y << 1),    st->ctab[(v1 + v2) >> 1]);
-          XPutPixel(st->xim,(x << 1),    (y << 1) + 1,st->ctab[(v1 + v3) >> 1]);
-          XPutPixel(st->xim,(x << 1) + 1,(y << 1) + 1,st->ctab[(v1 + v4) >> 1]);
-        }
-    }
-}
 
 static void
 Flame2Image(struct state *st)
 {
-  switch (st->xim->bits_per_pixel)
+  if (st->threadpool.count <= 1)
+    flame_to_image (st, st->rows, st->top, st->fheight);
+  else
     {
-    case 32: Flame2Image32(st); break;
-    case 24: Flame2Image24(st); break;
-    case 16: Flame2Image16(st); break;
-    case 8:  Flame2Image8(st);  break;
-    default:
-      if (st->xim->bits_per_pixel <= 7)
-        Flame2Image1234567(st);
-      else
-        abort();
-      break;
+      threadpool_run (&st->threadpool, flame_to_image_thread);
+      threadpool_wait (&st->threadpool);
     }
 }
 
@@ -469,63 +392,205 @@ FlameActive(struct state *st)
 }
 
 
+/* The row kernels below are called on LANES cells at a time, and then once
+   more on whatever is left over; see lanes.h.
+
+   This one is how much of each cell spreads to the cells above-left and
+   above-right.
+ */
+static void
+spread_cells (unsigned short *RESTRICT spread, const unsigned char *RESTRICT src,
+              int n, int hspread)
+{
+  int i;
+  for (i = 0; i < n; i++)
+    spread[i] = (src[i] * hspread) >> 8;
+}
+
+/* Every cell of 'dst' only ever has things added to it, so clipping the
+   sum once gives the same result as clipping after each addition.
+ */
+static int
+rise_cells (unsigned char *RESTRICT dst, const unsigned char *RESTRICT src,
+            const unsigned short *RESTRICT spread, int n, int vspread)
+{
+  int i, used = 0;
+  for (i = 0; i < n; i++)
+    {
+      int v = (dst[i] + ((src[i] * vspread) >> 8) +
+               spread[i - 1] + spread[i + 1]);
+      dst[i] = (v > MAX_VAL ? MAX_VAL : v);
+      used |= src[i];
+    }
+  return used;
+}
+
+static void
+cool_cells (unsigned char *RESTRICT src, int n, int residual)
+{
+  int i;
+  for (i = 0; i < n; i++)
+    src[i] = (src[i] * residual) >> 8;
+}
+
+
+/* Lets the fire in row 'src' rise into row 'dst' over columns lo through
+   hi-1 of the flame buffer, counting the gutter columns at either end, and
+   then lets 'src' die down.  This reads columns lo-1 through hi of 'src'.
+   Returns non-zero if any of the cells in 'src' were burning.
+ */
+static int
+advance_row (const struct state *st, unsigned char *src, unsigned char *dst,
+             unsigned short *spread, int lo, int hi, Bool decay)
+{
+  int fw = st->fwidth + 2;
+  int a = MAX (lo, 1), b = MIN (hi, fw - 1);
+  int c, used = 0;
+
+  spread[0] = spread[fw - 1] = 0;
+  for (c = MAX (lo - 1, 1); c + LANES <= MIN (hi + 1, fw - 1); c += LANES)
+    spread_cells (spread + c, src + c, LANES, st->hspread);
+  spread_cells (spread + c, src + c, MIN (hi + 1, fw - 1) - c, st->hspread);
+
+  for (c = a; c + LANES <= b; c += LANES)
+    used |= rise_cells (dst + c, src + c, spread + c, LANES, st->vspread);
+  used |= rise_cells (dst + c, src + c, spread + c, b - c, st->vspread);
+
+  if (lo == 0)
+    dst[0] = MIN (MAX_VAL, dst[0] + spread[1]);
+
+  if (hi == fw)
+    {
+      dst[fw - 1] = MIN (MAX_VAL, dst[fw - 1] + spread[fw - 2]);
+      cool_cells (src + fw - 1, 1, st->residual);    /* the right gutter */
+    }
+
+  /* The bottom row keeps burning. */
+  if (decay)
+    {
+      for (c = a; c + LANES <= b; c += LANES)
+        cool_cells (src + c, LANES, st->residual);
+      cool_cells (src + c, b - c, st->residual);
+    }
+
+  return used;
+}
+
+
+/* The columns of the flame buffer that this thread is responsible for.
+ */
+static void
+band_columns (const struct state *st, unsigned id, int *a, int *b)
+{
+  int fw = st->fwidth + 2;
+  *a = fw * id / st->threadpool.count;
+  *b = fw * (id + 1) / st->threadpool.count;
+}
+
+
+/* Each row of the flame depends on the whole of the row below it, which
+   was only just updated, so the rows can't be split between threads.
+   Instead each thread takes a band of columns and a scratch copy of the
+   next BAND_ROWS rows, with enough columns on either side to compute its
+   own columns all the way up without looking at anyone else's.
+
+   Other threads are still reading the rows that this pass starts from, so
+   this thread's results for the previous pass are written out at the start
+   of this one; and the row that the next pass starts from goes through
+   st->edge.
+ */
+static void
+advance_thread (void *self)
+{
+  const struct thread *t = (const struct thread *) self;
+  struct state *st = t->st;
+  int fw = st->fwidth + 2;
+  int y0 = st->pass_top, rows = st->pass_rows;
+  unsigned char *band = st->band + t->id * fw * (BAND_ROWS + 1);
+  unsigned short *spread = st->spread + t->id * fw;
+  const unsigned char *top;
+  int a, b, lo, hi, k;
+
+  band_columns (st, t->id, &a, &b);
+  if (a == b) return;
+
+  for (k = 0; k < st->prev_rows; k++)
+    memcpy (st->flame + (st->prev_top - k) * fw + a, band + k * fw + a, b - a);
+
+  lo = MAX (0, a - rows);
+  hi = MIN (fw, b + rows);
+
+  top = (st->prev_rows
+         ? st->edge + ((st->pass - 1) & 1) * fw
+         : st->flame + y0 * fw);
+  memcpy (band + lo, top + lo, hi - lo);
+  for (k = 1; k <= rows; k++)
+    memcpy (band + k * fw + lo, st->flame + (y0 - k) * fw + lo, hi - lo);
+
+  for (k = 0; k < rows; k++)
+    {
+      int y = y0 - k;
+      int grow = rows - 1 - k;
+      if (advance_row (st, band + k * fw, band + (k + 1) * fw, spread,
+                       MAX (0, a - grow), MIN (fw, b + grow),
+                       y < st->fheight + 1))
+        st->used[t->id] = y;
+    }
+
+  memcpy (st->edge + (st->pass & 1) * fw + a, band + rows * fw + a, b - a);
+}
+
+
 static void
 FlameAdvance(struct state *st)
 {
-  int x,y;
-  unsigned char *ptr2;
+  int fw = st->fwidth + 2;
   int newtop = st->top;
+  int y;
 
-  for (y = st->fheight + 1; y >= st->top; y--)
+  if (st->threadpool.count <= 1)
     {
-      int used = 0;
-      unsigned char *ptr1 = st->flame + 1 + (y * (st->fwidth + 2));
-      for (x = 0; x < st->fwidth; x++)
+      for (y = st->fheight + 1; y >= st->top; y--)
+        if (advance_row (st, st->flame + y * fw, st->flame + (y - 1) * fw,
+                         st->spread, 0, fw, y < st->fheight + 1))
+          newtop = y - 1;
+    }
+  else
+    {
+      unsigned i;
+      int k, used = INT_MAX;
+
+      for (i = 0; i < st->threadpool.count; i++)
+        st->used[i] = INT_MAX;
+
+      st->prev_rows = 0;
+      for (st->pass = 0, y = st->fheight + 1;
+           y >= st->top;
+           st->pass++, y -= st->pass_rows)
         {
-          int v1 = (int)*ptr1;
-          int v2, v3;
-          if (v1 > 0)
-            {
-              used = 1;
-              ptr2 = ptr1 - st->fwidth - 2;
-              v3   = (v1 * st->vspread) >> 8;
-              v2   = (int)*(ptr2);
-              v2  += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-
-              *(ptr2) = (unsigned char)v2;
-              v3  = (v1 * st->hspread) >> 8;
-              v2  = (int)*(ptr2 + 1);
-              v2 += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-          
-              *(ptr2 + 1) = (unsigned char)v2;
-              v2          = (int)*(ptr2 - 1);
-              v2         += v3;
-              if (v2 > MAX_VAL) 
-                v2 = MAX_VAL;
-          
-              *(ptr2 - 1) = (unsigned char)v2;
-        
-              if (y < st->fheight + 1)
-                {
-                  v1    = (v1 * st->residual) >> 8;
-                  *ptr1 = (unsigned char)v1;
-                }
-            }
-          ptr1++;
-          if (used) 
-            newtop = y - 1;
+          st->pass_top  = y;
+          st->pass_rows = MIN (BAND_ROWS, y - st->top + 1);
+          threadpool_run (&st->threadpool, advance_thread);
+          threadpool_wait (&st->threadpool);
+          st->prev_top  = st->pass_top;
+          st->prev_rows = st->pass_rows;
         }
- 
-      /* clean up the right gutter */
-      {
-        int v1 = (int)*ptr1;
-        v1 = (v1 * st->residual) >> 8;
-        *ptr1 = (unsigned char)v1;
-      }
+
+      /* Write out the last pass, including the row it rose into. */
+      for (i = 0; i < st->threadpool.count; i++)
+        {
+          unsigned char *band = st->band + i * fw * (BAND_ROWS + 1);
+          int a, b;
+          band_columns (st, i, &a, &b);
+          for (k = 0; k <= st->prev_rows; k++)
+            memcpy (st->flame + (st->prev_top - k) * fw + a,
+                    band + k * fw + a, b - a);
+          if (st->used[i] < used)
+            used = st->used[i];
+        }
+
+      if (used != INT_MAX)
+        newtop = used - 1;
     }
 
   st->top = newtop - 1;
@@ -707,10 +772,27 @@ loadBitmap (struct state *st)
 }
 
 
+static int
+xflame_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct thread *t = (struct thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  return 0;
+}
+
+
 static void *
 xflame_init (Display *dpy, Window win)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct thread),
+    xflame_thread_create,
+    0
+  };
+
   struct state *st = (struct state *) calloc (1, sizeof(*st));
+  int err;
   st->dpy = dpy;
   st->window = win;
   st->baseline = get_integer_resource (dpy, "bitmapBaseline", "Integer");
@@ -718,6 +800,12 @@ xflame_init (Display *dpy, Window win)
   st->xim      = NULL;
   st->top      = 1;
   st->flame    = NULL;
+  st->scale    = (get_boolean_resource (dpy, "native", "Boolean") ? 1 : 2);
+
+  err = threadpool_create (&st->threadpool, &cls, dpy,
+                           hardware_concurrency (dpy));
+  if (err)
+    threadpool_fatal (progname, err);
 
   GetXInfo(st);
   InitColors(st);
@@ -773,6 +861,12 @@ xflame_free (Display *dpy, Window window, void *closure)
     destroy_xshm_image (dpy, st->xim, &st->shminfo);
   free (st->theim);
   free (st->flame);
+  free (st->rows);
+  free (st->spread);
+  free (st->band);
+  free (st->used);
+  free (st->edge);
+  threadpool_destroy (&st->threadpool);
   XFreeGC (dpy, st->gc);
   free (st);
 }
@@ -794,6 +888,8 @@ static const char *xflame_defaults [] = {
   "*variance:       50",
   "*vartrend:       20",
   "*bloom:          True",   
+  "*native:         False",
+  THREAD_DEFAULTS
 
 #ifdef HAVE_XSHM_EXTENSION
   "*useSHM: False",   /* xshm turns out not to help. */
@@ -814,6 +910,9 @@ static XrmOptionDescRec xflame_options [] = {
   { "-vartrend",  ".vartrend",       XrmoptionSepArg, 0 },
   { "-bloom",     ".bloom",          XrmoptionNoArg, "True" },
   { "-no-bloom",  ".bloom",          XrmoptionNoArg, "False" },
+  { "-native",    ".native",         XrmoptionNoArg, "True" },
+  { "-no-native", ".native",         XrmoptionNoArg, "False" },
+  THREAD_OPTIONS
 #ifdef HAVE_XSHM_EXTENSION
   { "-shm",       ".useSHM",         XrmoptionNoArg, "True" },
   { "-no-shm",    ".useSHM",         XrmoptionNoArg, "False" },
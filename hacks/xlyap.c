@@ -34,11 +34,17 @@
 #define LYAP_VERSION "#(@) lyap 2.3 2/20/92"
 
 #include <assert.h>
+#include <errno.h>
 #include <math.h>
 
 #include "screenhack.h"
 #include "yarandom.h"
 #include "hsv.h"
+#include "rowwriter.h"
+#include "thread_util.h"
+
+#define LANES 8		/* of doubles */
+#include "lanes.h"
 
 #ifndef HAVE_JWXYZ
 # include <X11/cursorfont.h> 
@@ -76,6 +82,7 @@ static const char *xlyap_defaults [] = {
   "*delay:              10000",
   "*linger:             5",
   "*colors:             200",
+  THREAD_DEFAULTS
 #ifdef HAVE_MOBILE
   "*ignoreRotation:     True",
 #endif
@@ -108,6 +115,7 @@ static XrmOptionDescRec xlyap_options [] = {
   { "-w", ".aRange",            XrmoptionSepArg, 0 },   /* r */
   { "-delay", ".delay",         XrmoptionSepArg, 0 },   /* delay */
   { "-linger", ".linger",       XrmoptionSepArg, 0 },   /* linger */
+  THREAD_OPTIONS
   { 0, 0, 0, 0 }
 };
 
@@ -117,7 +125,6 @@ static XrmOptionDescRec xlyap_options [] = {
 #define Max(x,y) ((x > y)?x:y)
 
 #ifdef SIXTEEN_COLORS
-# define MAXPOINTS  128
 # ifdef BIGMEM
 #  define MAXFRAMES 4
 # else  /* !BIGMEM */
@@ -125,7 +132,6 @@ static XrmOptionDescRec xlyap_options [] = {
 # endif /* !BIGMEM */
 # define MAXCOLOR 16
 #else  /* !SIXTEEN_COLORS */
-# define MAXPOINTS  256
 # ifdef BIGMEM
 #  define MAXFRAMES 8
 # else  /* !BIGMEM */
@@ -141,6 +147,17 @@ static XrmOptionDescRec xlyap_options [] = {
 #define NUMMAPS 5
 #define NBUILTINS 22
 
+/* The picture is computed in passes over tiles of TILE x TILE pixels.  The
+ * first pass computes one pixel in each 8x8 block and fills the block with
+ * it; each later pass halves the block size, computing only the pixels that
+ * the earlier passes haven't.  So the whole picture shows up quickly, then
+ * sharpens, and no pixel is computed twice.  One pass over one tile is a
+ * "unit": the threads take units from a shared counter until the batch runs
+ * out, so the cheap and the expensive parts of the picture even out.
+ */
+#define TILE 64
+#define PASSES 4
+
 #ifndef TRUE
 # define TRUE 1
 # define FALSE 0
@@ -166,11 +183,6 @@ typedef struct {
 /*  rubber_band_data_t rubber_band;*/
 } image_data_t;
 
-typedef struct points_t {
-  XPoint data[MAXCOLOR][MAXPOINTS];
-  int npoints[MAXCOLOR];
-} points_t;
-
 
 typedef double (*PFD)(double,double);
 
@@ -194,10 +206,12 @@ struct state {
   int dwell, settle;
   int width, height, xposition, yposition;
 
-  points_t Points;
 /*  image_data_t rubber_data;*/
 
-  GC Data_GC[MAXCOLOR]/*, RubberGC*/;
+  GC gc/*, RubberGC*/;
+  unsigned long pixels[MAXCOLOR];
+  XImage *image;
+  row_writer writer;
   PFD map, deriv;
 
   int aflag, bflag, wflag, hflag, Rflag;
@@ -206,25 +220,30 @@ struct state {
   int   funcmaxindex;
   double  min_a, min_b, a_range, b_range, minlyap;
   double  max_a, max_b;
-  double  start_x, lyapunov, a_inc, b_inc, a, b;
+  double  start_x, a_inc, b_inc;
   int   numcolors, numfreecols, lowrange;
-  xy_t  point;
 #ifdef BACKING_PIXMAP
   Pixmap  pixmap;
 #endif
 /*  XColor  Colors[MAXCOLOR];*/
-  double  *exponents[MAXFRAMES];
+  double  *exponents[MAXFRAMES];	/* by pixel, filled in unit order */
   double  a_minimums[MAXFRAMES], b_minimums[MAXFRAMES];
   double  a_maximums[MAXFRAMES], b_maximums[MAXFRAMES];
   double  minexp, maxexp, prob;
-  int     expind[MAXFRAMES], resized[MAXFRAMES];
+  int     expind[MAXFRAMES], resized[MAXFRAMES];	/* units done */
   int     numwheels, force, Force, negative;
   int     rgb_max, nostart, stripe_interval;
-  int     save, show, useprod, spinlength;
+  int     show, useprod, spinlength;
   int     maxframe, frame, dorecalc, mapindex, run;
   char    *outname;
 
-  int sendpoint_index;
+  int tiles_x, nunits;
+  int unit_next, unit_end;	/* the units of the current batch */
+  Bool recompute;		/* else the batch is redrawn from exponents */
+  struct threadpool threadpool;
+# if HAVE_PTHREAD
+  pthread_mutex_t lock;		/* guards unit_next */
+# endif
 
   int   forcing[MAXINDEX];
   int   Forcing[FUNCMAXINDEX];
@@ -277,17 +296,14 @@ static void show_defaults(struct state *);
 static void TrackRubberBand(struct state *, image_data_t *, XEvent *);
 static void EndRubberBand(struct state *, image_data_t *, XEvent *);*/
 /*static void CreateXorGC(struct state *);*/
-static void InitBuffer(struct state *);
-static void BufferPoint(struct state *, int color, int x, int y);
-static void FlushBuffer(struct state *);
 static void init_data(struct state *);
 static void init_color(struct state *);
 static void parseargs(struct state *);
 static void Clear(struct state *);
 static void setupmem(struct state *);
-static int complyap(struct state *);
+static Bool complyap(struct state *);
 static Bool Getkey(struct state *, XKeyEvent *);
-static int sendpoint(struct state *, double expo);
+static int colour_index(const struct state *, double expo);
 /*static void save_to_file(struct state *);*/
 static void setforcing(struct state *);
 static void check_params(struct state *, int mapnum, int parnum);
@@ -295,7 +311,7 @@ static void usage(struct state *);
 static void Destroy_frame(struct state *);
 static void freemem(struct state *);
 static void Redraw(struct state *);
-static void redraw(struct state *, double *exparray, int index, int cont);
+static void redraw(struct state *, int index);
 static void recalc(struct state *);
 /*static void SetupCorners(XPoint *, image_data_t *);
 static void set_new_params(struct state *, image_data_t *);*/
@@ -310,66 +326,69 @@ static void print_values(struct state *);
 /****************************************************************************/
 
 
-/* complyap() is the guts of the program. This is where the Lyapunov exponent
- * is calculated. For each iteration (past some large number of iterations)
- * calculate the logarithm of the absolute value of the derivative at that
- * point. Then average them over some large number of iterations. Some small
- * speed up is achieved by utilizing the fact that log(a*b) = log(a) + log(b).
+static double
+double_time (void)
+{
+  struct timeval now;
+# ifdef GETTIMEOFDAY_TWO_ARGS
+  struct timezone tzp;
+  gettimeofday(&now, &tzp);
+# else
+  gettimeofday(&now);
+# endif
+
+  return (now.tv_sec + ((double) now.tv_usec * 0.000001));
+}
+
+
+struct lyap_thread {
+  struct state *st;
+  unsigned id;
+  int forcing[MAXINDEX];	/* changed by -randomForce */
+  unsigned int seed;
+  xy_t *points;			/* TILE * TILE */
+};
+
+/* The thread's own version of setforcing(), for -randomForce. */
+static void
+random_forcing(struct lyap_thread *t)
+{
+  int i;
+  for (i=0;i<MAXINDEX;i++) {
+    t->seed = t->seed * 1103515245 + 12345;
+    t->forcing[i] = ((t->seed >> 1) > t->st->prob) ? 0 : 1;
+  }
+}
+
+
+/* lyap_point() is the guts of the program. This is where the Lyapunov
+ * exponent is calculated. For each iteration (past some large number of
+ * iterations) calculate the logarithm of the absolute value of the
+ * derivative at that point. Then average them over some large number of
+ * iterations. Some small speed up is achieved by utilizing the fact that
+ * log(a*b) = log(a) + log(b).
  */
-static int
-complyap(struct state *st)
+static double
+lyap_point(struct lyap_thread *t, double a, double b)
 {
+  const struct state *st = t->st;
   int i, bindex;
   double total, prod, x, dx, r;
 
-  if (st->maxcolor > MAXCOLOR)
-    abort();
-
-  if (!st->run)
-    return TRUE;
-  st->a += st->a_inc;
-  if (st->a >= st->max_a) {
-    if (sendpoint(st, st->lyapunov) == TRUE)
-      return FALSE;
-    else {
-      FlushBuffer(st);
-      /*      if (savefile)
-              save_to_file(); */
-      return TRUE;
-    }
-  }
-  if (st->b >= st->max_b) {
-    FlushBuffer(st);
-    /*    if (savefile)
-          save_to_file();*/
-    return TRUE;
-  }
   prod = 1.0;
   total = 0.0;
   bindex = 0;
   x = st->start_x;
-  r = (st->forcing[bindex]) ? st->b : st->a;
-#ifdef MAPS
-  findex = 0;
-  map = Maps[st->Forcing[findex]];
-#endif
+  r = (t->forcing[bindex]) ? b : a;
   for (i=0;i<st->settle;i++) {     /* Here's where we let the thing */
     x = st->map (x, r);  /* "settle down". There is usually */
     if (++bindex >= st->maxindex) { /* some initial "noise" in the */
       bindex = 0;    /* iterations. How can we optimize */
       if (st->Rflag)      /* the value of settle ??? */
-        setforcing(st);
+        random_forcing(t);
     }
-    r = (st->forcing[bindex]) ? st->b : st->a;
-#ifdef MAPS
-    if (++findex >= funcmaxindex)
-      findex = 0;
-    map = Maps[st->Forcing[findex]];
-#endif
+    r = (t->forcing[bindex]) ? b : a;
   }
-#ifdef MAPS
-  deriv = Derivs[st->Forcing[findex]];
-#endif
   if (st->useprod) {      /* using log(a*b) */
     for (i=0;i<st->dwell;i++) {
       x = st->map (x, r);
@@ -389,18 +408,11 @@ complyap(struct state *st)
       if (++bindex >= st->maxindex) {
         bindex = 0;
         if (st->Rflag)
-          setforcing(st);
+          random_forcing(t);
       }
-      r = (st->forcing[bindex]) ? st->b : st->a;
-#ifdef MAPS
-      if (++findex >= funcmaxindex)
-        findex = 0;
-      map = Maps[st->Forcing[findex]];
-      deriv = Derivs[st->Forcing[findex]];
-#endif
+      r = (t->forcing[bindex]) ? b : a;
     }
     total += log(prod);
-    st->lyapunov = (total * M_LOG2E) / (double)i;   
   }
   else {        /* use log(a) + log(b) */
     for (i=0;i<st->dwell;i++) {
@@ -416,27 +428,276 @@ complyap(struct state *st)
       if (++bindex >= st->maxindex) {
         bindex = 0;
         if (st->Rflag)
-          setforcing(st);
+          random_forcing(t);
       }
-      r = (st->forcing[bindex]) ? st->b : st->a;
-#ifdef MAPS
-      if (++findex >= funcmaxindex)
-        findex = 0;
-      map = Maps[st->Forcing[findex]];
-      deriv = Derivs[st->Forcing[findex]];
-#endif
+      r = (t->forcing[bindex]) ? b : a;
     }
-    st->lyapunov = (total * M_LOG2E) / (double)i;
   }
+  return (total * M_LOG2E) / (double)i;
+}
 
-  if (sendpoint(st, st->lyapunov) == TRUE)
-    return FALSE;
-  else {
-    FlushBuffer(st);
-    /*    if (savefile)
-          save_to_file();*/
+
+/* The same thing for LANES points of one row at once, for log(a*b).  All
+ * of them see the same forcing sequence, so each step is the same
+ * operation on every lane: with the map written out inline and a constant
+ * number of lanes, the compiler turns it into vector code.  A lane whose
+ * derivative hits 0 stops counting and multiplying, as above.  Instead of
+ * taking the log of the product whenever it gets out of range, it is
+ * scaled by 2^40 (which is exact) and the scaling is added up in 'total'.
+ * That can't cope with derivatives so small that the product underflows,
+ * as happens when x is sucked into 0; those few points go the slow way.
+ */
+#define MAP_logistic(x,r)    ((r) * (x) * (1.0 - (x)))
+#define DERIV_logistic(x,r)  ((r) - (2.0 * (r) * (x)))
+#define MAP_circle(x,r)      ((r) * sin(M_PI * (x)))
+#define DERIV_circle(x,r)    ((r) * M_PI * cos(M_PI * (x)))
+#define MAP_leftlog(x,r)     ((r) * (x) * (1.0 - (x)) * (1.0 - (x)))
+#define DERIV_leftlog(x,r)   ((r) * (1.0 - (4.0 * (x)) + (3.0 * (x) * (x))))
+#define MAP_rightlog(x,r)    ((r) * (x) * (x) * (1.0 - (x)))
+#define DERIV_rightlog(x,r)  ((r) * ((2.0 * (x)) - (3.0 * (x) * (x))))
+#define MAP_doublelog(x,r)   \
+  ((r) * (x) * (x) * (1.0 - (x)) * (1.0 - (x)))
+#define DERIV_doublelog(x,r) \
+  ((r) * ((2.0 * (x)) - (6.0 * (x) * (x)) + (4.0 * (x) * (x) * (x))))
+
+#define BIG   1099511627776.0	/* 2^40, about 1e12 */
+#define SMALL (1.0 / BIG)
+#define LOG_BIG (40 * M_LN2)
+#define TINY  1.0e-280
+
+#define LYAP_LANES(NAME)						\
+static INLINE void							\
+NAME##_settle (double *RESTRICT x, const double *RESTRICT r, int n)	\
+{									\
+  int j;								\
+  for (j = 0; j < n; j++)						\
+    x[j] = MAP_##NAME (x[j], r[j]);					\
+}									\
+									\
+static INLINE void							\
+NAME##_dwell (double *RESTRICT x, double *RESTRICT prod,		\
+              double *RESTRICT total, double *RESTRICT count,		\
+              double *RESTRICT done, double *RESTRICT lost,		\
+              const double *RESTRICT r, int n)				\
+{									\
+  int j;								\
+  for (j = 0; j < n; j++) {						\
+    double y = MAP_##NAME (x[j], r[j]);				\
+    double d = fabs (DERIV_##NAME (y, r[j]));				\
+    double stop = (d == 0.0 ? 1.0 : done[j]);				\
+    double p = (stop != 0.0 ? prod[j] : prod[j] * d);			\
+    lost[j] = (p < TINY ? 1.0 : lost[j]);				\
+    count[j] += 1.0 - done[j];						\
+    total[j] += (p > BIG ? LOG_BIG : p < SMALL ? -LOG_BIG : 0.0);	\
+    prod[j] = (p > BIG ? p * SMALL : p < SMALL ? p * BIG : p);		\
+    done[j] = stop;							\
+    x[j] = y;								\
+  }									\
+}									\
+									\
+static void								\
+NAME##_lanes (struct lyap_thread *t, const double *a, double b,	\
+              double *expo)						\
+{									\
+  const struct state *st = t->st;					\
+  double x[LANES], prod[LANES], count[LANES], done[LANES];		\
+  double total[LANES], lost[LANES], bs[LANES];				\
+  int i, j, bindex = 0;							\
+  for (j = 0; j < LANES; j++) {						\
+    x[j] = st->start_x;							\
+    prod[j] = 1.0;							\
+    count[j] = done[j] = total[j] = lost[j] = 0.0;			\
+    bs[j] = b;								\
+  }									\
+  for (i = 0; i < st->settle; i++) {					\
+    NAME##_settle (x, t->forcing[bindex] ? bs : a, LANES);		\
+    if (++bindex >= st->maxindex) {					\
+      bindex = 0;							\
+      if (st->Rflag)							\
+        random_forcing (t);						\
+    }									\
+  }									\
+  for (i = 0; i < st->dwell; i++) {					\
+    NAME##_dwell (x, prod, total, count, done, lost,			\
+                  t->forcing[bindex] ? bs : a, LANES);		\
+    if (++bindex >= st->maxindex) {					\
+      bindex = 0;							\
+      if (st->Rflag)							\
+        random_forcing (t);						\
+    }									\
+  }									\
+  for (j = 0; j < LANES; j++)						\
+    expo[j] = (lost[j] != 0.0						\
+               ? lyap_point (t, a[j], b)				\
+               : ((total[j] + log(prod[j])) * M_LOG2E) / count[j]);	\
+}
+
+LYAP_LANES (logistic)
+LYAP_LANES (circle)
+LYAP_LANES (leftlog)
+LYAP_LANES (rightlog)
+LYAP_LANES (doublelog)
+
+typedef void (*lanes_fn) (struct lyap_thread *, const double *, double,
+                          double *);
+
+static const lanes_fn Lanes[NUMMAPS] = { logistic_lanes, circle_lanes,
+                                         leftlog_lanes, rightlog_lanes,
+                                         doublelog_lanes };
+
+
+/* The pixels that pass 'unit / ntiles' computes in tile 'unit % ntiles',
+ * and the size of the blocks they are drawn as.
+ */
+static int
+unit_points(const struct state *st, int unit, xy_t *points, int *size_ret)
+{
+  int ntiles = st->nunits / PASSES;
+  int tile = unit % ntiles;
+  int pass = unit / ntiles;
+  int size = 1 << (PASSES - 1 - pass);
+  int x0 = (tile % st->tiles_x) * TILE;
+  int y0 = (tile / st->tiles_x) * TILE;
+  int x1 = Min(x0 + TILE, st->width);
+  int y1 = Min(y0 + TILE, st->height);
+  int x, y, n = 0;
+
+  for (y = y0; y < y1; y += size)
+    for (x = x0; x < x1; x += size)
+      if (pass == 0 || (x & size) || (y & size)) {
+        points[n].x = x;
+        points[n].y = y;
+        n++;
+      }
+  *size_ret = size;
+  return n;
+}
+
+static void
+draw_unit(struct lyap_thread *t, int unit)
+{
+  struct state *st = t->st;
+  double *exps = st->exponents[st->frame];
+  int n, i, y, size;
+
+  n = unit_points(st, unit, t->points, &size);
+
+  if (st->recompute) {
+    double a[LANES], expo[LANES];
+    lanes_fn lanes = 0;
+    for (i=0;i<NUMMAPS;i++)
+      if (st->map == Maps[i])
+        lanes = Lanes[i];
+    if (!st->useprod)
+      lanes = 0;
+
+    memcpy(t->forcing, st->forcing, sizeof(t->forcing));
+    for (i = 0; i < n; ) {
+      /* A run of points on one row, padded out to LANES. */
+      int py = t->points[i].y;
+      int j, k = 0;
+      while (k < LANES && i + k < n && t->points[i + k].y == py)
+        k++;
+      if (lanes) {
+        for (j = 0; j < LANES; j++)
+          a[j] = st->min_a + st->a_inc * t->points[i + Min(j, k - 1)].x;
+        lanes(t, a, st->min_b + st->b_inc * py, expo);
+      } else {
+        for (j = 0; j < k; j++)
+          expo[j] = lyap_point(t, st->min_a + st->a_inc * t->points[i+j].x,
+                               st->min_b + st->b_inc * py);
+      }
+      for (j = 0; j < k; j++)
+        exps[py * st->width + t->points[i+j].x] = expo[j];
+      i += k;
+    }
+  }
+
+  for (i = 0; i < n; i++) {
+    int x = t->points[i].x;
+    int w = Min(size, st->width - x);
+    int h = Min(size, st->height - t->points[i].y);
+    unsigned long p =
+      st->pixels[colour_index(st, exps[t->points[i].y * st->width + x])];
+    for (y = t->points[i].y; y < t->points[i].y + h; y++)
+      st->writer.fill(&st->writer, x, y, w, p);
+  }
+}
+
+static void
+lyap_thread_run(void *self)
+{
+  struct lyap_thread *t = (struct lyap_thread *) self;
+  struct state *st = t->st;
+
+  for (;;) {
+    int unit;
+# if HAVE_PTHREAD
+    pthread_mutex_lock(&st->lock);
+# endif
+    unit = st->unit_next;
+    if (unit < st->unit_end)
+      st->unit_next++;
+# if HAVE_PTHREAD
+    pthread_mutex_unlock(&st->lock);
+# endif
+    if (unit >= st->unit_end)
+      break;
+    draw_unit(t, unit);
+  }
+}
+
+/* Hands units first through last-1, all from one pass, to the threads,
+ * then puts up their tiles.  (Units of different passes over the same tile
+ * mustn't run at once: the coarse blocks would land on the fine ones.)
+ */
+static void
+run_units(struct state *st, int first, int last)
+{
+  int ntiles = st->nunits / PASSES;
+  int unit;
+
+  if (first >= last)
+    return;
+  st->unit_next = first;
+  st->unit_end = last;
+  threadpool_run(&st->threadpool, lyap_thread_run);
+  threadpool_wait(&st->threadpool);
+
+  for (unit = first; unit < last; unit++) {
+    int tile = unit % ntiles;
+    int x = (tile % st->tiles_x) * TILE;
+    int y = (tile / st->tiles_x) * TILE;
+    XPutImage(st->dpy, st->canvas, st->gc, st->image, x, y, x, y,
+              Min(TILE, st->width - x), Min(TILE, st->height - y));
+  }
+}
+
+
+/* Computes more of the picture, for about a frame's worth of time.
+ * Returns True when it's done.
+ */
+static Bool
+complyap(struct state *st)
+{
+  double start = double_time();
+  int *done = &st->expind[st->frame];
+
+  if (st->maxcolor > MAXCOLOR)
+    abort();
+
+  if (!st->run)
     return TRUE;
+
+  st->recompute = True;
+  while (*done < st->nunits && double_time() - start < 1.0 / 30) {
+    int ntiles = st->nunits / PASSES;
+    int end = (*done / ntiles + 1) * ntiles;	/* end of this pass */
+    int n = Min(end - *done, st->threadpool.count * 2);
+    run_units(st, *done, *done + n);
+    *done += n;
   }
+  return (*done >= st->nunits);
 }
 
 static double
@@ -520,15 +781,12 @@ init_data(struct state *st)
   st->lowrange = st->mincolindex - st->startcolor;
   st->a_inc = st->a_range / (double)st->width;
   st->b_inc = st->b_range / (double)st->height;
-  st->point.x = -1;
-  st->point.y = 0;
-  st->a = /*st->rubber_data.p_min = */st->min_a;
-  st->b = /*st->rubber_data.q_min = */st->min_b;
-/*  st->rubber_data.p_max = st->max_a;
+/*  st->rubber_data.p_min = st->min_a;
+  st->rubber_data.q_min = st->min_b;
+  st->rubber_data.p_max = st->max_a;
   st->rubber_data.q_max = st->max_b;*/
   if (st->show)
     show_defaults(st);
-  InitBuffer(st);
 }
 
 #if 0
@@ -558,16 +816,9 @@ init_color(struct state *st)
   make_smooth_colormap(st->screen, st->visual, st->cmap,
                        st->colors, &st->ncolors, True, NULL, True);
 
-  for (i = 0; i < st->maxcolor; i++) {
-    if (! st->Data_GC[i]) {
-      XGCValues gcv;
-      gcv.background = BlackPixelOfScreen(st->screen);
-      st->Data_GC[i] = XCreateGC(st->dpy, st->canvas, GCBackground, &gcv);
-    }
-    XSetForeground(st->dpy, st->Data_GC[i],
-                   st->colors[((int) ((i / ((float)st->maxcolor)) *
-                                      st->ncolors))].pixel);
-  }
+  for (i = 0; i < st->maxcolor; i++)
+    st->pixels[i] = st->colors[((int) ((i / ((float)st->maxcolor)) *
+                                       st->ncolors))].pixel;
 }
 
 
@@ -796,9 +1047,12 @@ usage(struct state *st)
 static void
 Cycle_frames(struct state *st)
 {
-  int i;
-  for (i=0;i<=st->maxframe;i++)
-    redraw(st, st->exponents[i], st->expind[i], 1);
+  int i, frame = st->frame;
+  for (i=0;i<=st->maxframe;i++) {
+    st->frame = i;
+    redraw(st, st->expind[i]);
+  }
+  st->frame = frame;
 }
 
 #if 0
@@ -844,16 +1098,18 @@ Getkey(struct state *st, XKeyEvent *event)
     case '[': st->settle /= 2; if (st->settle < 1) st->settle = 1; return True;
     case ']': st->settle *= 2; return True;
     case 'd': go_down(st); return True;
-    case 'D': FlushBuffer(st); return True;
+    case 'D': XPutImage(st->dpy, st->canvas, st->gc, st->image,
+                        0, 0, 0, 0, st->width, st->height);
+      return True;
     case 'e':
-    case 'E': FlushBuffer(st);
+    case 'E':
       st->dorecalc = (!st->dorecalc);
       if (st->dorecalc)
         recalc(st);
       else {
         st->maxexp = st->minlyap; st->minexp = -1.0 * st->minlyap;
       }
-      redraw(st, st->exponents[st->frame], st->expind[st->frame], 1);
+      redraw(st, st->expind[st->frame]);
       return True;
     case 'f':
       /*  case 'F': save_to_file(); return True;*/
@@ -896,13 +1152,12 @@ Getkey(struct state *st, XKeyEvent *event)
       st->a_maximums[0] = st->max_a; st->b_maximums[0] = st->max_b;
       st->a_inc = st->a_range / (double)st->width;
       st->b_inc = st->b_range / (double)st->height;
-      st->point.x = -1;
-      st->point.y = 0;
-      st->a = /*st->rubber_data.p_min = */st->min_a;
-      st->b = /*st->rubber_data.q_min = */st->min_b;
-/*      st->rubber_data.p_max = st->max_a;
+/*      st->rubber_data.p_min = st->min_a;
+      st->rubber_data.q_min = st->min_b;
+      st->rubber_data.p_max = st->max_a;
       st->rubber_data.q_max = st->max_b;*/
       Clear(st);
+      Redraw(st);
       return True;
     case 'M': if (st->minlyap > 0.005)
         st->minlyap -= 0.005;
@@ -911,13 +1166,11 @@ Getkey(struct state *st, XKeyEvent *event)
       return True;
     case 'p':
     case 'P': st->negative = (!st->negative);
-      FlushBuffer(st); redraw(st, st->exponents[st->frame], 
-                              st->expind[st->frame], 1);
+      redraw(st, st->expind[st->frame]);
       return True;
-    case 'r': FlushBuffer(st); redraw(st, st->exponents[st->frame], 
-                                      st->expind[st->frame], 1);
+    case 'r': redraw(st, st->expind[st->frame]);
       return True;
-    case 'R': FlushBuffer(st); Redraw(st); return True;
+    case 'R': Redraw(st); return True;
     case 's':
       st->spinlength=st->spinlength/2;
 #if 0
@@ -947,12 +1200,11 @@ Getkey(struct state *st, XKeyEvent *event)
       return True;
     case 'x': Clear(st); return True;
     case 'X': Destroy_frame(st); return True;
-    case 'z': Cycle_frames(st); redraw(st, st->exponents[st->frame], 
-                                       st->expind[st->frame], 1);
+    case 'z': Cycle_frames(st); redraw(st, st->expind[st->frame]);
       return True;
 #if 0
     case 'Z': while (!XPending(st->dpy)) Cycle_frames(st);
-      redraw(st, st->exponents[st->frame], st->expind[st->frame], 1); 
+      redraw(st, st->expind[st->frame]);
       return True;
 #endif
     case 'q':
@@ -982,12 +1234,10 @@ Getkey(struct state *st, XKeyEvent *event)
  * also greatly effect what details are seen. Play around with this.
  */
 static int
-sendpoint(struct state *st, double expo)
+colour_index(const struct state *st, double expo)
 {
   double tmpexpo;
-
-  if (st->maxcolor > MAXCOLOR)
-    abort();
+  int index;
 
 #if 0
   /* The relationship st->minexp <= expo <= maxexp should always be true. This
@@ -998,45 +1248,55 @@ sendpoint(struct state *st, double expo)
     expo = maxexp;
 #endif
 
-  st->point.x++;
   tmpexpo = (st->negative) ? expo : -1.0 * expo;
   if (tmpexpo > 0) {
     if (!mono_p) {
-      st->sendpoint_index = (int)(tmpexpo*st->lowrange/st->maxexp);
-      st->sendpoint_index = ((st->sendpoint_index % st->lowrange) + 
-                             st->startcolor);
+      index = (int)(tmpexpo*st->lowrange/st->maxexp);
+      index = ((index % st->lowrange) + st->startcolor);
     }
     else
-      st->sendpoint_index = 0;
+      index = 0;
   }
   else {
     if (!mono_p) {
-      st->sendpoint_index = (int)(tmpexpo*st->numfreecols/st->minexp);
-      st->sendpoint_index = ((st->sendpoint_index % st->numfreecols)
-                             + st->mincolindex);
+      index = (int)(tmpexpo*st->numfreecols/st->minexp);
+      index = ((index % st->numfreecols) + st->mincolindex);
     }
     else
-      st->sendpoint_index = 1;
+      index = 1;
   }
-  BufferPoint(st, st->sendpoint_index, st->point.x, st->point.y);
-  if (st->save) {
-    if (st->frame > MAXFRAMES)
-      abort();
-    st->exponents[st->frame][st->expind[st->frame]++] = expo;
-  }
-  if (st->point.x >= st->width) {
-    st->point.y++;
-    st->point.x = 0;
-    if (st->save) {
-      st->b += st->b_inc;
-      st->a = st->min_a;
-    }
-    if (st->point.y >= st->height)
-      return FALSE;
-    else
-      return TRUE;
+
+  /* Guard against bogus color values. Shouldn't be necessary but paranoia
+     is good. */
+  if (index < 0)
+    index = 0;
+  else if (index >= st->maxcolor)
+    index = st->maxcolor - 1;
+  return index;
+}
+
+
+/* The image that the tiles are drawn into, and the units that cover it.
+ */
+static void
+setup_image(struct state *st)
+{
+  XWindowAttributes xgwa;
+  XGetWindowAttributes (st->dpy, st->canvas, &xgwa);
+  if (st->image)
+    XDestroyImage (st->image);
+  st->image = XCreateImage (st->dpy, xgwa.visual, xgwa.depth, ZPixmap, 0, 0,
+                            st->width, st->height, 8, 0);
+  st->image->data = (char *) calloc (st->image->height,
+                                     st->image->bytes_per_line);
+  if (!st->image->data) {
+    fprintf(stderr,"Error malloc'ing image.\n");
+    exit(-1);
   }
-  return TRUE;
+  init_row_writer (&st->writer, st->image);
+
+  st->tiles_x = (st->width + TILE - 1) / TILE;
+  st->nunits = PASSES * st->tiles_x * ((st->height + TILE - 1) / TILE);
 }
 
 
@@ -1059,59 +1319,39 @@ resize(struct state *st)
 #endif
   st->a_inc = st->a_range / (double)st->width;
   st->b_inc = st->b_range / (double)st->height;
-  st->point.x = -1;
-  st->point.y = 0;
   st->run = 1;
-  st->a = /*st->rubber_data.p_min = */st->min_a;
-  st->b = /*st->rubber_data.q_min = */st->min_b;
-/*  st->rubber_data.p_max = st->max_a;
+/*  st->rubber_data.p_min = st->min_a;
+  st->rubber_data.q_min = st->min_b;
+  st->rubber_data.p_max = st->max_a;
   st->rubber_data.q_max = st->max_b;*/
   freemem(st);
   setupmem(st);
+  setup_image(st);
   for (n=0;n<MAXFRAMES;n++)
     if ((n <= st->maxframe) && (n != st->frame))
       st->resized[n] = 1;
-  InitBuffer(st);
   Clear(st);
   Redraw(st);
 }
 
+/* Draws the first 'index' units of the current frame again, from the
+ * exponents already computed: nothing is recalculated.
+ */
 static void
-redraw(struct state *st, double *exparray, int index, int cont)
+redraw(struct state *st, int index)
 {
-  int i, x_sav, y_sav;
-
-  x_sav = st->point.x;
-  y_sav = st->point.y;
+  int ntiles = st->nunits / PASSES;
+  int pass;
 
-  st->point.x = -1;
-  st->point.y = 0;
-
-  st->save=0;
-  for (i=0;i<index;i++)
-    sendpoint(st, exparray[i]);
-  st->save=1;
-
-  if (cont) {
-    st->point.x = x_sav;
-    st->point.y = y_sav;
-  }
-  else {
-    st->a = st->point.x * st->a_inc + st->min_a;
-    st->b = st->point.y * st->b_inc + st->min_b;
-  }
-  FlushBuffer(st);
+  st->recompute = False;
+  for (pass = 0; pass < PASSES; pass++)
+    run_units(st, pass * ntiles, Min(index, (pass + 1) * ntiles));
 }
 
 static void
 Redraw(struct state *st)
 {
-  FlushBuffer(st);
-  st->point.x = -1;
-  st->point.y = 0;
   st->run = 1;
-  st->a = st->min_a;
-  st->b = st->min_b;
   st->expind[st->frame] = 0;
   st->resized[st->frame] = 0;
 }
@@ -1119,15 +1359,22 @@ Redraw(struct state *st)
 static void
 recalc(struct state *st)
 {
-  int i;
+  xy_t *points = (xy_t *) malloc(TILE * TILE * sizeof(*points));
+  const double *exps = st->exponents[st->frame];
+  int unit, i, n, size;
 
   st->minexp = st->maxexp = 0.0;
-  for (i=0;i<st->expind[st->frame];i++) {
-    if (st->exponents[st->frame][i] < st->minexp)
-      st->minexp = st->exponents[st->frame][i];
-    if (st->exponents[st->frame][i] > st->maxexp)
-      st->maxexp = st->exponents[st->frame][i];
+  for (unit=0;unit<st->expind[st->frame];unit++) {
+    n = unit_points(st, unit, points, &size);
+    for (i=0;i<n;i++) {
+      double e = exps[points[i].y * st->width + points[i].x];
+      if (e < st->minexp)
+        st->minexp = e;
+      if (e > st->maxexp)
+        st->maxexp = e;
+    }
   }
+  free(points);
 }
 
 static void
@@ -1135,10 +1382,9 @@ Clear(struct state *st)
 {
   XClearWindow(st->dpy, st->canvas);
 #ifdef BACKING_PIXMAP
-  XCopyArea(st->dpy, st->canvas, st->pixmap, st->Data_GC[0],
+  XCopyArea(st->dpy, st->canvas, st->pixmap, st->gc,
             0, 0, st->width, st->height, 0, 0);
 #endif
-  InitBuffer(st);
 }
 
 static void
@@ -1262,11 +1508,7 @@ set_new_params(struct state *st, image_data_t *data)
   st->b_minimums[st->frame] = st->min_b = data->q_min;
   st->a_inc = st->a_range / (double)st->width;
   st->b_inc = st->b_range / (double)st->height;
-  st->point.x = -1;
-  st->point.y = 0;
   st->run = 1;
-  st->a = st->min_a;
-  st->b = st->min_b;
   st->a_maximums[st->frame] = st->max_a = data->p_max;
   st->b_maximums[st->frame] = st->max_b = data->q_max;
   st->expind[st->frame] = 0;
@@ -1303,15 +1545,11 @@ jumpwin(struct state *st)
   st->b_range = st->max_b - st->min_b;
   st->a_inc = st->a_range / (double)st->width;
   st->b_inc = st->b_range / (double)st->height;
-  st->point.x = -1;
-  st->point.y = 0;
-  st->a = st->min_a;
-  st->b = st->min_b;
   Clear(st);
   if (st->resized[st->frame])
     Redraw(st);
   else
-    redraw(st, st->exponents[st->frame], st->expind[st->frame], 0);
+    redraw(st, st->expind[st->frame]);
 }
 
 static void
@@ -1338,65 +1576,6 @@ Destroy_frame(struct state *st)
   go_back(st);
 }
 
-static void
-InitBuffer(struct state *st)
-{
-  int i;
-
-  for (i = 0 ; i < st->maxcolor; ++i)
-    st->Points.npoints[i] = 0;
-}
-
-static void
-BufferPoint(struct state *st, int color, int x, int y)
-{
-  if (st->maxcolor > MAXCOLOR)
-    abort();
-
-  /* Guard against bogus color values. Shouldn't be necessary but paranoia
-     is good. */
-  if (color < 0)
-    color = 0;
-  else if (color >= st->maxcolor)
-    color = st->maxcolor - 1;
-
-  if (st->Points.npoints[color] == MAXPOINTS)
-    {
-      XDrawPoints(st->dpy, st->canvas, st->Data_GC[color],
-                  st->Points.data[color], st->Points.npoints[color], 
-                  CoordModeOrigin);
-#ifdef BACKING_PIXMAP
-      XDrawPoints(st->dpy, st->pixmap, st->Data_GC[color],
-                  st->Points.data[color], st->Points.npoints[color], 
-                  CoordModeOrigin);
-#endif
-      st->Points.npoints[color] = 0;
-    }
-  st->Points.data[color][st->Points.npoints[color]].x = x;
-  st->Points.data[color][st->Points.npoints[color]].y = y;
-  ++st->Points.npoints[color];
-}
-
-static void
-FlushBuffer(struct state *st)
-{
-  int color;
-
-  for (color = 0; color < st->maxcolor; ++color)
-    if (st->Points.npoints[color])
-      {
-        XDrawPoints(st->dpy, st->canvas, st->Data_GC[color],
-                    st->Points.data[color], st->Points.npoints[color],
-                    CoordModeOrigin);
-#ifdef BACKING_PIXMAP
-        XDrawPoints(st->dpy, st->pixmap, st->Data_GC[color],
-                    st->Points.data[color], st->Points.npoints[color],
-                    CoordModeOrigin);
-#endif
-        st->Points.npoints[color] = 0;
-      }
-}
-
 static void
 print_help(struct state *st)
 {
@@ -1536,7 +1715,6 @@ do_defaults (struct state *st)
   st->rgb_max=65000;
   st->nostart=1;
   st->stripe_interval=7;
-  st->save=1;
   st->useprod=1;
   st->spinlength=256;
   st->run=1;
@@ -1781,12 +1959,38 @@ do_preset (struct state *st, int builtin)
 }
 
 
+static int
+lyap_thread_create (void *self, struct threadpool *pool, unsigned id)
+{
+  struct lyap_thread *t = (struct lyap_thread *) self;
+  t->st = GET_PARENT_OBJ (struct state, threadpool, pool);
+  t->id = id;
+  t->seed = random();
+  t->points = (xy_t *) malloc (TILE * TILE * sizeof(*t->points));
+  return t->points ? 0 : ENOMEM;
+}
+
+static void
+lyap_thread_destroy (void *self)
+{
+  struct lyap_thread *t = (struct lyap_thread *) self;
+  free (t->points);
+}
+
+
 static void *
 xlyap_init (Display *d, Window window)
 {
+  static const struct threadpool_class cls = {
+    sizeof (struct lyap_thread),
+    lyap_thread_create,
+    lyap_thread_destroy
+  };
+
   struct state *st = (struct state *) calloc (1, sizeof(*st));
   XWindowAttributes xgwa;
-  int builtin = -1;
+  XGCValues gcv;
+  int builtin = -1, err;
   XGetWindowAttributes (d, window, &xgwa);
   st->dpy = d;
   st->width = xgwa.width;
@@ -1824,6 +2028,18 @@ xlyap_init (Display *d, Window window)
   st->canvas = window;
   init_color(st);
 
+  gcv.background = BlackPixelOfScreen(st->screen);
+  st->gc = XCreateGC(st->dpy, st->canvas, GCBackground, &gcv);
+  setup_image(st);
+
+  err = threadpool_create (&st->threadpool, &cls, st->dpy,
+                           hardware_concurrency (st->dpy));
+  if (err)
+    threadpool_fatal (progname, err);
+# if HAVE_PTHREAD
+  pthread_mutex_init (&st->lock, NULL);
+# endif
+
 #ifdef BACKING_PIXMAP
   st->pixmap = XCreatePixmap(st->dpy, window, st->width, st->height, 
                              xgwa.depth);
@@ -1844,7 +2060,6 @@ static unsigned long
 xlyap_draw (Display *dpy, Window window, void *closure)
 {
   struct state *st = (struct state *) closure;
-  int i;
 
   if (!st->run && st->reset_countdown) {
     st->reset_countdown--;
@@ -1862,13 +2077,11 @@ xlyap_draw (Display *dpy, Window window, void *closure)
     }
   }
 
-  for (i = 0; i < 2000; i++)
-    if (complyap(st) == TRUE)
-      {
-        st->run = 0;
-        st->reset_countdown = st->linger;
-        break;
-      }
+  if (complyap(st) == TRUE)
+    {
+      st->run = 0;
+      st->reset_countdown = st->linger;
+    }
   return st->delay;
 }
 
@@ -1918,17 +2131,20 @@ xlyap_event (Display *dpy, Window window, void *closure, XEvent *event)
 static void
 xlyap_free (Display *dpy, Window window, void *closure)
 {
-  int i;
   struct state *st = (struct state *) closure;
 
+  threadpool_destroy (&st->threadpool);
+# if HAVE_PTHREAD
+  pthread_mutex_destroy (&st->lock);
+# endif
   freemem (st);
+  XDestroyImage (st->image);
 
 #ifdef BACKING_PIXMAP
   XFreePixmap (st->dpy, st->pixmap);
 #endif
 /*  XFreeGC (st->dpy, st->RubberGC);*/
-  for (i = 0; i < st->maxcolor; i++)
-    XFreeGC (st->dpy, st->Data_GC[i]);
+  XFreeGC (st->dpy, st->gc);
   if (st->outname) free (st->outname);
 
   free (st);
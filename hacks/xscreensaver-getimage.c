@@ -17,7 +17,10 @@
    invoke this program, "xscreensaver-getimage", as a sub-process.
    Loading files is straightforward, and the camera thing is file-like.
    File names are produced by "xscreensaver-getimage-file" and/or
-   "xscreensaver-getimage-video".
+   "xscreensaver-getimage-video".  If imageDirectory is a local directory,
+   file names instead come from the index in "utils/imageindex.c", without
+   a sub-process; "xscreensaver-getimage-file" is only used for URLs, or
+   until the index has been built.
 
    On macOS, iOS or Android systems, each saver's "utils/grabclient.c"
    instead links against "OSX/grabclient-osx.m", "OSX/grabclient-ios.m"
@@ -74,6 +77,7 @@
 #include "visual.h"
 #include "xmu.h"
 #include "vroot.h"
+#include "imageindex.h"
 #include "../driver/prefs.h"
 
 #include "../driver/blurb.c"	/* Eh, this is awful but so what */
@@ -108,6 +112,7 @@
 #ifdef HAVE_JPEGLIB
 # undef HAVE_GDK_PIXBUF
 # include <jpeglib.h>
+# include <setjmp.h>
 #endif
 
 
@@ -134,6 +139,16 @@ typedef enum {
 #define GETIMAGE_FILE_PROGRAM    "xscreensaver-getimage-file"
 #define GETIMAGE_SCREEN_PROGRAM  "screencapture"
 
+/* How often the index of imageDirectory re-reads directories whose
+   modification time has changed. */
+#define IMAGE_INDEX_MAX_AGE (10 * 60)
+
+/* Like xscreensaver-getimage-file, don't choose images smaller than this.
+   The index remembers their sizes once we have looked. */
+#define MIN_IMAGE_SIZE 500
+
+static image_index *image_idx = 0;
+
 
 static int
 x_ehandler (Display *dpy, XErrorEvent *error)
@@ -1034,6 +1049,62 @@ display_file (Screen *screen, Window window, Drawable drawable,
 }
 
 
+#ifdef HAVE_JPEGLIB
+
+typedef struct {
+  struct jpeg_error_mgr pub;
+  jmp_buf jmp;
+} jpg_size_error_mgr;
+
+static void
+jpg_size_error_exit (j_common_ptr cinfo)
+{
+  longjmp (((jpg_size_error_mgr *) cinfo->err)->jmp, 1);
+}
+
+static void
+jpg_size_output_message (j_common_ptr cinfo)
+{
+}
+
+#endif /* HAVE_JPEGLIB */
+
+
+/* Reads just enough of the image file to find its size.
+   Returns False if it isn't an image we can load.
+ */
+static Bool
+image_file_size (const char *filename, int *w_ret, int *h_ret)
+{
+# if defined(HAVE_GDK_PIXBUF)
+  return !!gdk_pixbuf_get_file_info (filename, w_ret, h_ret);
+# elif defined(HAVE_JPEGLIB)
+  struct jpeg_decompress_struct cinfo;
+  jpg_size_error_mgr jerr;
+  FILE *in = fopen (filename, "rb");
+  Bool ok = False;
+  if (!in) return False;
+  cinfo.err = jpeg_std_error (&jerr.pub);
+  jerr.pub.error_exit = jpg_size_error_exit;
+  jerr.pub.output_message = jpg_size_output_message;
+  jpeg_create_decompress (&cinfo);
+  if (! setjmp (jerr.jmp))
+    {
+      jpeg_stdio_src (&cinfo, in);
+      jpeg_read_header (&cinfo, TRUE);
+      *w_ret = cinfo.image_width;
+      *h_ret = cinfo.image_height;
+      ok = True;
+    }
+  jpeg_destroy_decompress (&cinfo);
+  fclose (in);
+  return ok;
+# else  /* !(HAVE_GDK_PIXBUF || HAVE_JPEGLIB) */
+  return False;
+# endif /* !(HAVE_GDK_PIXBUF || HAVE_JPEGLIB) */
+}
+
+
 /* Invokes a sub-process and returns its output (presumably, a file to
    load.)  Free the string when done.  'grab_type' controls which program
    to run.  Returned pathname may be relative to 'directory', or absolute.
@@ -1209,10 +1280,99 @@ get_filename_1 (Screen *screen, const char *directory, grab_type type,
 static char *
 get_filename (Screen *screen, const char *directory, Bool verbose_p)
 {
+  if (directory && *directory == '/')
+    {
+      int n, tries;
+      Bool dirty_p = False;
+      char *ret = 0;
+      if (! image_idx)
+        image_idx = image_index_open (directory, verbose_p);
+      n = image_index_count (image_idx);
+
+      /* The index may be a few minutes behind, so the file might be gone. */
+      for (tries = 0; n > 0 && tries < 5; tries++)
+        {
+          int i = random() % n;
+          const char *file = image_index_file (image_idx, i);
+          struct stat st;
+          int w, h;
+          if (!file || stat (file, &st))
+            continue;
+
+          /* Look at the sizes of new files, and save them for next time.
+             Files that aren't images at all are saved as 1x1. */
+          image_index_size (image_idx, i, &w, &h);
+          if (!w)
+            {
+              if (! image_file_size (file, &w, &h) || w <= 0 || h <= 0)
+                w = h = 1;
+              image_index_set_size (image_idx, i, w, h);
+              dirty_p = True;
+            }
+          if (w < MIN_IMAGE_SIZE || h < MIN_IMAGE_SIZE)
+            {
+              if (verbose_p)
+                fprintf (stderr, "%s: skipping %s: %dx%d\n",
+                         blurb(), file, w, h);
+              continue;
+            }
+
+          if (verbose_p)
+            fprintf (stderr, "%s: chose %s from index of %d\n",
+                     blurb(), file, n);
+          ret = strdup (file);
+          break;
+        }
+
+      if (dirty_p)
+        image_index_save (image_idx);
+      if (ret)
+        return ret;
+    }
+
   return get_filename_1 (screen, directory, GRAB_FILE, verbose_p);
 }
 
 
+/* If the index of imageDirectory is missing or old, bring it up to date
+   in a detached process, so that the hack that is waiting for our image
+   does not also wait for the disk.  A directory that has not changed
+   costs one stat() to check.
+ */
+static void
+refresh_image_index (Display *dpy, const char *directory, Bool verbose_p)
+{
+  if (!directory || *directory != '/')
+    return;
+  if (! image_idx)
+    image_idx = image_index_open (directory, verbose_p);
+  if (! image_index_stale_p (image_idx, IMAGE_INDEX_MAX_AGE))
+    return;
+
+  switch ((int) fork ())
+    {
+    case -1:
+      {
+        char buf[255];
+        sprintf (buf, "%s: couldn't fork", blurb());
+        perror (buf);
+        break;
+      }
+    case 0:
+      /* grabclient.c reads our stdout until it is closed. */
+      close (ConnectionNumber (dpy));
+      close (0);
+      close (1);
+      setsid ();
+      image_index_update (image_idx, IMAGE_INDEX_MAX_AGE);
+      _exit (0);
+      break;
+    default:
+      break;
+    }
+}
+
+
 /* Grabs a video frame to a file, and returns a pathname to that file.
    Delete that file when you are done with it (and free the string.)
  */
@@ -2333,5 +2493,7 @@ main (int argc, char **argv)
              grab_desktop_p, grab_video_p, random_image_p,
              image_directory, file);
   XSync (dpy, False);
+  if (random_image_p && !file)
+    refresh_image_index (dpy, image_directory, verbose_p);
   exit (0);
 }
@@ -0,0 +1,734 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* Many of the older GL hacks (atlantis, dnalogo, maze3d, circuit...)
+   draw everything with glBegin, glNormal3f and glVertex3f, every frame.
+   Desktop OpenGL still allows that, but it is a lot of tiny calls into
+   the driver, each of which the driver has to buffer up itself.
+
+   So this does what jwzgles.c does for OpenGLES: it shadows the functions
+   that are allowed inside glBegin and collects the vertexes into an array.
+   But instead of drawing each block at glEnd, it keeps collecting as long
+   as nothing but more glBegin/glEnd blocks come along, with only glColor,
+   glNormal and glTexCoord between them.  Then:
+
+     - Strips, fans, quads and polygons are unrolled into independent
+       triangles, and line strips and loops into lines, so that a run of
+       blocks can be drawn with one glDrawElements.  The last vertex of
+       each primitive (the first, for GL_POLYGON) stays the last one, so
+       that flat shading comes out the same.
+
+     - The vertexes are streamed into a VBO with glBufferSubData, which is
+       orphaned when it fills up, rather than being sent with each call.
+
+     - The prevailing color, normal and texture coordinate are copied into
+       every vertex, so blocks that only differ in those still merge.  An
+       array is only enabled for those that actually vary in the batch.
+
+   Any other GL call draws the batch first.  That is why every source file
+   in a hack that uses this must be compiled with it: see glbatch.h.
+
+   Things that are not batched:
+
+     - Anything inside glNewList: the real display list records it.
+
+     - A block that calls glMaterial or glCallList inside glBegin: it
+       falls back to real immediate mode from that point on.
+
+     - With glPolygonMode other than GL_FILL, GL_QUADS, GL_QUAD_STRIP and
+       GL_POLYGON blocks are drawn on their own, as-is, since triangulating
+       them would draw their diagonals.
+
+     - glEdgeFlag, glArrayElement, glEvalCoord and friends: don't.
+
+   It is selected per hack at compile time: see 'glbatch' in
+   wayland/meson.build.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#ifdef HAVE_GLBATCH	/* whole file */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef  GL_GLEXT_PROTOTYPES
+# define GL_GLEXT_PROTOTYPES /* for glBindBuffer */
+#endif
+#include <GL/gl.h>
+#include <GL/glu.h>
+
+#include "glbatchI.h"
+
+#ifdef HAVE_GLPROF	/* Count what actually gets sent */
+# include "glprof.h"
+#endif
+
+#undef  Assert
+#define Assert(C,S) do { \
+    if (!(C)) { \
+      fprintf (stderr, "glbatch: %s\n", S); \
+      abort(); \
+    }} while(0)
+
+#define STREAM_SIZE (1024 * 1024)	/* Initial size of each VBO */
+#define MAX_VERTS   65536		/* Draw when a batch gets this big */
+
+
+typedef struct {		/* One vertex, with everything */
+  GLfloat v[4];			/* x y z w */
+  GLfloat n[3];			/* normal */
+  GLfloat t[4];			/* s t r q */
+  GLfloat c[4];			/* r g b a */
+} vertex;
+
+typedef struct {		/* One glBegin/glEnd block in the batch */
+  GLenum mode;
+  int first, count;
+} block;
+
+typedef struct {		/* A VBO being streamed into */
+  GLenum target;
+  GLuint name;
+  GLsizeiptr size, used;
+} stream;
+
+static struct {
+  int begun;			/* Inside glBegin */
+  int immediate;		/* ...but gave up: forwarding until glEnd */
+  int compiling;		/* Inside glNewList: forwarding everything */
+
+  vertex cur;			/* Prevailing normal, texture and color */
+  int cur_known;		/* Whether 'cur' is up to date */
+  int fill_p;			/* glPolygonMode is GL_FILL for both faces */
+  int fill_known;		/* Whether 'fill_p' is up to date */
+
+  vertex *verts;		/* The batch, plus the block being built */
+  int nverts, verts_size;
+  block *blocks;
+  int nblocks, blocks_size;
+  GLuint *indexes;
+  int indexes_size;
+
+  GLenum begin_mode;		/* Of the block being built */
+  int begin_first;		/* Its first vertex */
+
+  stream vbo, ibo;
+} state = { 0, };
+
+
+static void
+grow (void **array, int span, int count, int *size)
+{
+  if (count >= *size)
+    {
+      int new_size = (count + 1024) * 2;
+      *array = realloc (*array, new_size * span);
+      Assert (*array, "out of memory");
+      *size = new_size;
+    }
+}
+
+
+/* The current color etc. can change behind our back in glCallList and
+   glPopAttrib, so after those, ask for them again.
+ */
+static void
+sync_current (void)
+{
+  if (state.cur_known) return;
+  glGetFloatv (GL_CURRENT_NORMAL,         state.cur.n);
+  glGetFloatv (GL_CURRENT_TEXTURE_COORDS, state.cur.t);
+  glGetFloatv (GL_CURRENT_COLOR,          state.cur.c);
+  state.cur_known = 1;
+}
+
+
+static int
+fill_p (void)
+{
+  if (! state.fill_known)
+    {
+      GLint m[2];
+      glGetIntegerv (GL_POLYGON_MODE, m);
+      state.fill_p = (m[0] == GL_FILL && m[1] == GL_FILL);
+      state.fill_known = 1;
+    }
+  return state.fill_p;
+}
+
+
+/* Which independent primitive a glBegin mode unrolls into, or 0 if it
+   has to be drawn as-is.
+ */
+static GLenum
+unrolled (GLenum mode)
+{
+  switch (mode) {
+  case GL_TRIANGLES:
+  case GL_TRIANGLE_STRIP:
+  case GL_TRIANGLE_FAN:
+    return GL_TRIANGLES;
+  case GL_QUADS:
+  case GL_QUAD_STRIP:
+  case GL_POLYGON:
+    return fill_p() ? GL_TRIANGLES : 0;
+  case GL_LINES:
+  case GL_LINE_STRIP:
+  case GL_LINE_LOOP:
+    return GL_LINES;
+  case GL_POINTS:
+    return GL_POINTS;
+  default:
+    return 0;
+  }
+}
+
+
+/* Writes the indexes of the unrolled primitives of one block, offset by
+   'base'.  Returns how many there are; 'out' may be null.
+ */
+static int
+unroll (GLenum mode, int count, GLuint base, GLuint *out)
+{
+  int i, n = 0;
+# define PUSH(I) do { if (out) out[n] = base + (I); n++; } while(0)
+  switch (mode) {
+  case GL_TRIANGLE_STRIP:
+    for (i = 0; i < count - 2; i++)
+      {
+        /* Every other one is wound backwards. */
+        if (i & 1) { PUSH (i+1); PUSH (i);   }
+        else       { PUSH (i);   PUSH (i+1); }
+        PUSH (i+2);
+      }
+    break;
+  case GL_TRIANGLE_FAN:
+    for (i = 0; i < count - 2; i++)
+      { PUSH (0); PUSH (i+1); PUSH (i+2); }
+    break;
+  case GL_QUADS:
+    for (i = 0; i + 3 < count; i += 4)
+      { PUSH (i);   PUSH (i+1); PUSH (i+3);
+        PUSH (i+1); PUSH (i+2); PUSH (i+3); }
+    break;
+  case GL_QUAD_STRIP:
+    for (i = 0; i + 3 < count; i += 2)
+      { PUSH (i);   PUSH (i+1); PUSH (i+3);
+        PUSH (i+2); PUSH (i);   PUSH (i+3); }
+    break;
+  case GL_POLYGON:
+    for (i = 0; i < count - 2; i++)
+      { PUSH (i+1); PUSH (i+2); PUSH (0); }
+    break;
+  case GL_LINE_STRIP:
+  case GL_LINE_LOOP:
+    for (i = 0; i < count - 1; i++)
+      { PUSH (i); PUSH (i+1); }
+    if (mode == GL_LINE_LOOP && count > 1)
+      { PUSH (count-1); PUSH (0); }
+    break;
+  case GL_TRIANGLES:
+    for (i = 0; i < count - count % 3; i++) PUSH (i);
+    break;
+  case GL_LINES:
+    for (i = 0; i < count - count % 2; i++) PUSH (i);
+    break;
+  default:
+    for (i = 0; i < count; i++) PUSH (i);
+    break;
+  }
+# undef PUSH
+  return n;
+}
+
+
+/* Appends the data to the VBO and returns its offset in there.
+ */
+static const char *
+stream_data (stream *s, const void *data, GLsizeiptr bytes)
+{
+  GLsizeiptr offset;
+
+  if (! s->name)
+    glGenBuffers (1, &s->name);
+  glBindBuffer (s->target, s->name);
+
+  if (s->used + bytes > s->size)
+    {
+      /* Rather than waiting for the GPU to finish with the old contents,
+         let the driver hand us a fresh buffer. */
+      if (s->size < STREAM_SIZE) s->size = STREAM_SIZE;
+      while (s->size < bytes) s->size *= 2;
+      glBufferData (s->target, s->size, NULL, GL_STREAM_DRAW);
+      s->used = 0;
+    }
+
+  offset = s->used;
+  glBufferSubData (s->target, offset, bytes, data);
+  s->used += (bytes + 15) & ~15;
+  return (const char *) 0 + offset;
+}
+
+
+/* Draws the completed blocks, and keeps the one being built, if any.
+ */
+void
+glbatch_flush (void)
+{
+  const vertex *v0 = state.verts;
+  const char *base;
+  int v4_p = 0, t4_p = 0, n_p = 0, t_p = 0, c_p = 0;
+  int nverts, i;
+
+  if (state.nblocks == 0) return;
+
+  nverts = (state.blocks[state.nblocks-1].first +
+            state.blocks[state.nblocks-1].count);
+
+  for (i = 0; i < nverts; i++)
+    {
+      const vertex *v = &state.verts[i];
+      if (v->v[3] != 1) v4_p = 1;
+      if (v->t[2] != 0 || v->t[3] != 1) t4_p = 1;
+      if (!n_p && memcmp (v->n, v0->n, sizeof(v->n))) n_p = 1;
+      if (!t_p && memcmp (v->t, v0->t, sizeof(v->t))) t_p = 1;
+      if (!c_p && memcmp (v->c, v0->c, sizeof(v->c))) c_p = 1;
+    }
+
+  glPushClientAttrib (GL_CLIENT_VERTEX_ARRAY_BIT);
+
+  state.vbo.target = GL_ARRAY_BUFFER;
+  base = stream_data (&state.vbo, state.verts, nverts * sizeof(*state.verts));
+
+  glVertexPointer (v4_p ? 4 : 3, GL_FLOAT, sizeof(vertex),
+                   base + offsetof (vertex, v));
+  glEnableClientState (GL_VERTEX_ARRAY);
+
+  if (n_p)
+    {
+      glNormalPointer (GL_FLOAT, sizeof(vertex), base + offsetof (vertex, n));
+      glEnableClientState (GL_NORMAL_ARRAY);
+    }
+  else
+    {
+      glDisableClientState (GL_NORMAL_ARRAY);
+      glNormal3fv (v0->n);
+    }
+
+  if (t_p)
+    {
+      glTexCoordPointer (t4_p ? 4 : 2, GL_FLOAT, sizeof(vertex),
+                         base + offsetof (vertex, t));
+      glEnableClientState (GL_TEXTURE_COORD_ARRAY);
+    }
+  else
+    {
+      glDisableClientState (GL_TEXTURE_COORD_ARRAY);
+      glTexCoord4fv (v0->t);
+    }
+
+  if (c_p)
+    {
+      glColorPointer (4, GL_FLOAT, sizeof(vertex),
+                      base + offsetof (vertex, c));
+      glEnableClientState (GL_COLOR_ARRAY);
+    }
+  else
+    {
+      glDisableClientState (GL_COLOR_ARRAY);
+      glColor4fv (v0->c);
+    }
+
+  glDisableClientState (GL_EDGE_FLAG_ARRAY);
+  glDisableClientState (GL_SECONDARY_COLOR_ARRAY);
+  glDisableClientState (GL_FOG_COORD_ARRAY);
+
+  if (state.nblocks == 1)
+    glDrawArrays (state.blocks[0].mode, 0, nverts);
+  else
+    {
+      int nindexes = 0;
+      for (i = 0; i < state.nblocks; i++)
+        nindexes += unroll (state.blocks[i].mode, state.blocks[i].count, 0, 0);
+      grow ((void **) &state.indexes, sizeof(*state.indexes),
+            nindexes, &state.indexes_size);
+
+      nindexes = 0;
+      for (i = 0; i < state.nblocks; i++)
+        nindexes += unroll (state.blocks[i].mode, state.blocks[i].count,
+                            state.blocks[i].first, state.indexes + nindexes);
+
+      state.ibo.target = GL_ELEMENT_ARRAY_BUFFER;
+      glDrawElements (unrolled (state.blocks[0].mode), nindexes,
+                      GL_UNSIGNED_INT,
+                      stream_data (&state.ibo, state.indexes,
+                                   nindexes * sizeof(*state.indexes)));
+    }
+
+  glPopClientAttrib ();
+
+  /* Drawing with arrays leaves the current values undefined, and the
+     ones set inside glBegin were never sent at all. */
+  if (state.cur_known)
+    {
+      glNormal3fv (state.cur.n);
+      glTexCoord4fv (state.cur.t);
+      glColor4fv (state.cur.c);
+    }
+
+  /* Keep the block in progress. */
+  state.nverts -= nverts;
+  if (state.nverts)
+    memmove (state.verts, state.verts + nverts,
+             state.nverts * sizeof(*state.verts));
+  state.begin_first -= nverts;
+  state.nblocks = 0;
+}
+
+
+/* Something inside glBegin that we can't collect: draw what we have, and
+   send the rest of this block to the real glBegin.
+ */
+static void
+go_immediate (void)
+{
+  int i;
+  glbatch_flush ();
+  glBegin (state.begin_mode);
+  for (i = state.begin_first; i < state.nverts; i++)
+    {
+      const vertex *v = &state.verts[i];
+      glNormal3fv (v->n);
+      glTexCoord4fv (v->t);
+      glColor4fv (v->c);
+      glVertex4fv (v->v);
+    }
+  glNormal3fv (state.cur.n);
+  glTexCoord4fv (state.cur.t);
+  glColor4fv (state.cur.c);
+  state.nverts = state.begin_first;
+  state.immediate = 1;
+}
+
+
+void
+glbatch_glBegin (GLenum mode)
+{
+  if (state.compiling)
+    {
+      glBegin (mode);
+      return;
+    }
+
+  Assert (!state.begun, "nested glBegin");
+  sync_current();
+  state.begun = 1;
+  state.begin_mode = mode;
+  state.begin_first = state.nverts;
+}
+
+
+void
+glbatch_glEnd (void)
+{
+  block *b;
+  GLenum class;
+  int count;
+
+  if (state.compiling)
+    {
+      glEnd ();
+      return;
+    }
+
+  Assert (state.begun, "glEnd without glBegin");
+  state.begun = 0;
+
+  if (state.immediate)
+    {
+      state.immediate = 0;
+      glEnd ();
+      return;
+    }
+
+  count = state.nverts - state.begin_first;
+  if (count == 0) return;
+
+  /* If this block can't be merged with the ones before it, draw those
+     first and start a new batch. */
+  class = unrolled (state.begin_mode);
+  if (state.nblocks &&
+      (!class || class != unrolled (state.blocks[0].mode)))
+    glbatch_flush ();
+
+  grow ((void **) &state.blocks, sizeof(*state.blocks),
+        state.nblocks, &state.blocks_size);
+  b = &state.blocks[state.nblocks++];
+  b->mode  = state.begin_mode;
+  b->first = state.begin_first;
+  b->count = count;
+
+  if (!class || state.nverts >= MAX_VERTS)
+    glbatch_flush ();
+}
+
+
+static void
+vertex4 (GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  vertex *v;
+
+  if (state.compiling || state.immediate || !state.begun)
+    {
+      glVertex4f (x, y, z, w);
+      return;
+    }
+
+  grow ((void **) &state.verts, sizeof(*state.verts),
+        state.nverts, &state.verts_size);
+  v = &state.verts[state.nverts++];
+  *v = state.cur;
+  v->v[0] = x;
+  v->v[1] = y;
+  v->v[2] = z;
+  v->v[3] = w;
+}
+
+
+/* glNormal, glTexCoord and glColor go straight through outside of glBegin,
+   so that GL always knows the current values unless we are inside a block
+   that we are collecting.  But not while compiling a display list: then
+   they don't change anything until the list is called.
+ */
+static void
+normal3 (GLfloat x, GLfloat y, GLfloat z)
+{
+  if (state.compiling)
+    {
+      glNormal3f (x, y, z);
+      return;
+    }
+  state.cur.n[0] = x;
+  state.cur.n[1] = y;
+  state.cur.n[2] = z;
+  if (state.immediate || !state.begun)
+    glNormal3f (x, y, z);
+}
+
+
+static void
+texcoord4 (GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+  if (state.compiling)
+    {
+      glTexCoord4f (s, t, r, q);
+      return;
+    }
+  state.cur.t[0] = s;
+  state.cur.t[1] = t;
+  state.cur.t[2] = r;
+  state.cur.t[3] = q;
+  if (state.immediate || !state.begun)
+    glTexCoord4f (s, t, r, q);
+}
+
+
+static void
+color4 (GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+  if (state.compiling)
+    {
+      glColor4f (r, g, b, a);
+      return;
+    }
+  state.cur.c[0] = r;
+  state.cur.c[1] = g;
+  state.cur.c[2] = b;
+  state.cur.c[3] = a;
+  if (state.immediate || !state.begun)
+    glColor4f (r, g, b, a);
+}
+
+
+void glbatch_glVertex2d (GLdouble x, GLdouble y) { vertex4 (x, y, 0, 1); }
+void glbatch_glVertex2f (GLfloat x, GLfloat y)   { vertex4 (x, y, 0, 1); }
+void glbatch_glVertex2fv (const GLfloat *v)      { vertex4 (v[0], v[1], 0, 1); }
+void glbatch_glVertex2i (GLint x, GLint y)       { vertex4 (x, y, 0, 1); }
+void glbatch_glVertex3d (GLdouble x, GLdouble y, GLdouble z)
+{ vertex4 (x, y, z, 1); }
+void glbatch_glVertex3dv (const GLdouble *v)  { vertex4 (v[0], v[1], v[2], 1); }
+void glbatch_glVertex3f (GLfloat x, GLfloat y, GLfloat z)
+{ vertex4 (x, y, z, 1); }
+void glbatch_glVertex3fv (const GLfloat *v)   { vertex4 (v[0], v[1], v[2], 1); }
+void glbatch_glVertex3i (GLint x, GLint y, GLint z) { vertex4 (x, y, z, 1); }
+void glbatch_glVertex4f (GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{ vertex4 (x, y, z, w); }
+void glbatch_glVertex4fv (const GLfloat *v)
+{ vertex4 (v[0], v[1], v[2], v[3]); }
+
+void glbatch_glNormal3d (GLdouble x, GLdouble y, GLdouble z)
+{ normal3 (x, y, z); }
+void glbatch_glNormal3dv (const GLdouble *v)  { normal3 (v[0], v[1], v[2]); }
+void glbatch_glNormal3f (GLfloat x, GLfloat y, GLfloat z)
+{ normal3 (x, y, z); }
+void glbatch_glNormal3fv (const GLfloat *v)   { normal3 (v[0], v[1], v[2]); }
+
+void glbatch_glColor3d (GLdouble r, GLdouble g, GLdouble b)
+{ color4 (r, g, b, 1); }
+void glbatch_glColor3f (GLfloat r, GLfloat g, GLfloat b)
+{ color4 (r, g, b, 1); }
+void glbatch_glColor3fv (const GLfloat *v)    { color4 (v[0], v[1], v[2], 1); }
+void glbatch_glColor3ub (GLubyte r, GLubyte g, GLubyte b)
+{ color4 (r / 255.0, g / 255.0, b / 255.0, 1); }
+void glbatch_glColor3ubv (const GLubyte *v)
+{ color4 (v[0] / 255.0, v[1] / 255.0, v[2] / 255.0, 1); }
+void glbatch_glColor4d (GLdouble r, GLdouble g, GLdouble b, GLdouble a)
+{ color4 (r, g, b, a); }
+void glbatch_glColor4f (GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{ color4 (r, g, b, a); }
+void glbatch_glColor4fv (const GLfloat *v)
+{ color4 (v[0], v[1], v[2], v[3]); }
+void glbatch_glColor4ub (GLubyte r, GLubyte g, GLubyte b, GLubyte a)
+{ color4 (r / 255.0, g / 255.0, b / 255.0, a / 255.0); }
+void glbatch_glColor4ubv (const GLubyte *v)
+{ color4 (v[0] / 255.0, v[1] / 255.0, v[2] / 255.0, v[3] / 255.0); }
+
+void glbatch_glTexCoord1f (GLfloat s)          { texcoord4 (s, 0, 0, 1); }
+void glbatch_glTexCoord2d (GLdouble s, GLdouble t) { texcoord4 (s, t, 0, 1); }
+void glbatch_glTexCoord2f (GLfloat s, GLfloat t)   { texcoord4 (s, t, 0, 1); }
+void glbatch_glTexCoord2fv (const GLfloat *v)  { texcoord4 (v[0], v[1], 0, 1); }
+void glbatch_glTexCoord3f (GLfloat s, GLfloat t, GLfloat r)
+{ texcoord4 (s, t, r, 1); }
+void glbatch_glTexCoord3fv (const GLfloat *v)
+{ texcoord4 (v[0], v[1], v[2], 1); }
+void glbatch_glTexCoord4f (GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{ texcoord4 (s, t, r, q); }
+void glbatch_glTexCoord4fv (const GLfloat *v)
+{ texcoord4 (v[0], v[1], v[2], v[3]); }
+
+
+/* glMaterial is allowed inside glBegin, but we can't record it there.
+ */
+static void
+material (void)
+{
+  if (state.compiling)
+    ;
+  else if (state.begun && !state.immediate)
+    go_immediate();
+  else
+    glbatch_flush();
+}
+
+void
+glbatch_glMaterialf (GLenum face, GLenum pname, GLfloat param)
+{
+  material();
+  glMaterialf (face, pname, param);
+}
+
+void
+glbatch_glMaterialfv (GLenum face, GLenum pname, const GLfloat *params)
+{
+  material();
+  glMaterialfv (face, pname, params);
+}
+
+void
+glbatch_glMateriali (GLenum face, GLenum pname, GLint param)
+{
+  material();
+  glMateriali (face, pname, param);
+}
+
+void
+glbatch_glMaterialiv (GLenum face, GLenum pname, const GLint *params)
+{
+  material();
+  glMaterialiv (face, pname, params);
+}
+
+
+void
+glbatch_glNewList (GLuint list, GLenum mode)
+{
+  glbatch_flush();
+  glNewList (list, mode);
+  state.compiling = 1;
+}
+
+void
+glbatch_glEndList (void)
+{
+  glEndList ();
+  state.compiling = 0;
+  state.cur_known = 0;		/* In case of GL_COMPILE_AND_EXECUTE */
+  state.fill_known = 0;
+}
+
+void
+glbatch_glCallList (GLuint list)
+{
+  material();			/* Also allowed inside glBegin */
+  glCallList (list);
+  if (! state.compiling)
+    {
+      state.cur_known = 0;
+      state.fill_known = 0;
+    }
+}
+
+void
+glbatch_glCallLists (GLsizei n, GLenum type, const GLvoid *lists)
+{
+  material();
+  glCallLists (n, type, lists);
+  if (! state.compiling)
+    {
+      state.cur_known = 0;
+      state.fill_known = 0;
+    }
+}
+
+void
+glbatch_glPopAttrib (void)
+{
+  glbatch_flush();
+  glPopAttrib ();
+  state.cur_known = 0;
+  state.fill_known = 0;
+}
+
+void
+glbatch_glPolygonMode (GLenum face, GLenum mode)
+{
+  glbatch_flush();
+  glPolygonMode (face, mode);
+  state.fill_known = 0;
+}
+
+
+/* Everything else.
+ */
+#define V(NAME,ARGS,VARS) \
+  void glbatch_##NAME ARGS { glbatch_flush(); NAME VARS; }
+#define R(RET,NAME,ARGS,VARS) \
+  RET glbatch_##NAME ARGS { glbatch_flush(); return NAME VARS; }
+GLBATCH_FLUSHING_WRAPPERS
+#undef V
+#undef R
+
+#endif /* HAVE_GLBATCH - whole file */
@@ -0,0 +1,242 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or 
+ * implied warranty.
+ */
+
+/* An opt-in shim that collects glBegin/glEnd drawing into streaming VBOs,
+   merging consecutive blocks into a single draw call, on desktop OpenGL.
+   See glbatch.c for details.
+
+   Every OpenGL call that a hack makes has to go through this, or it might
+   run before vertexes that were specified earlier but not yet drawn.  So
+   every source file linked into the hack -- including fps-gl.c, texfont.c
+   and the rest -- must be compiled with HAVE_GLBATCH, and a hack that uses
+   a GL function that isn't listed here can't use it.
+ */
+
+#ifndef __GLBATCH_H__
+#define __GLBATCH_H__
+
+#ifndef HAVE_GLBATCH
+# error: do not include this without HAVE_GLBATCH
+#endif
+
+#ifdef HAVE_JWZGLES
+# error: HAVE_GLBATCH and HAVE_JWZGLES are mutually exclusive
+#endif
+
+#include "glbatchI.h"
+
+#define glActiveTexture				glbatch_glActiveTexture
+#define glAlphaFunc				glbatch_glAlphaFunc
+#define glAttachShader				glbatch_glAttachShader
+#define glBegin					glbatch_glBegin
+#define glBindBuffer				glbatch_glBindBuffer
+#define glBindFramebuffer			glbatch_glBindFramebuffer
+#define glBindRenderbuffer			glbatch_glBindRenderbuffer
+#define glBindTexture				glbatch_glBindTexture
+#define glBlendColor				glbatch_glBlendColor
+#define glBlendEquation				glbatch_glBlendEquation
+#define glBlendFunc				glbatch_glBlendFunc
+#define glBlitNamedFramebuffer			glbatch_glBlitNamedFramebuffer
+#define glBufferData				glbatch_glBufferData
+#define glBufferSubData				glbatch_glBufferSubData
+#define glCallList				glbatch_glCallList
+#define glCallLists				glbatch_glCallLists
+#define glClear					glbatch_glClear
+#define glClearColor				glbatch_glClearColor
+#define glClearDepth				glbatch_glClearDepth
+#define glClearIndex				glbatch_glClearIndex
+#define glClearStencil				glbatch_glClearStencil
+#define glClientActiveTexture			glbatch_glClientActiveTexture
+#define glClipPlane				glbatch_glClipPlane
+#define glColor3d				glbatch_glColor3d
+#define glColor3f				glbatch_glColor3f
+#define glColor3fv				glbatch_glColor3fv
+#define glColor3ub				glbatch_glColor3ub
+#define glColor3ubv				glbatch_glColor3ubv
+#define glColor4d				glbatch_glColor4d
+#define glColor4f				glbatch_glColor4f
+#define glColor4fv				glbatch_glColor4fv
+#define glColor4ub				glbatch_glColor4ub
+#define glColor4ubv				glbatch_glColor4ubv
+#define glColorMask				glbatch_glColorMask
+#define glColorMaterial				glbatch_glColorMaterial
+#define glColorPointer				glbatch_glColorPointer
+#define glCompileShader				glbatch_glCompileShader
+#define glCopyTexImage2D			glbatch_glCopyTexImage2D
+#define glCopyTexSubImage2D			glbatch_glCopyTexSubImage2D
+#define glCreateProgram				glbatch_glCreateProgram
+#define glCreateShader				glbatch_glCreateShader
+#define glCullFace				glbatch_glCullFace
+#define glDeleteBuffers				glbatch_glDeleteBuffers
+#define glDeleteFramebuffers			glbatch_glDeleteFramebuffers
+#define glDeleteLists				glbatch_glDeleteLists
+#define glDeleteProgram				glbatch_glDeleteProgram
+#define glDeleteRenderbuffers			glbatch_glDeleteRenderbuffers
+#define glDeleteShader				glbatch_glDeleteShader
+#define glDeleteTextures			glbatch_glDeleteTextures
+#define glDepthFunc				glbatch_glDepthFunc
+#define glDepthMask				glbatch_glDepthMask
+#define glDisable				glbatch_glDisable
+#define glDisableClientState			glbatch_glDisableClientState
+#define glDisableVertexAttribArray		glbatch_glDisableVertexAttribArray
+#define glDrawArrays				glbatch_glDrawArrays
+#define glDrawBuffer				glbatch_glDrawBuffer
+#define glDrawElements				glbatch_glDrawElements
+#define glDrawPixels				glbatch_glDrawPixels
+#define glEnable				glbatch_glEnable
+#define glEnableClientState			glbatch_glEnableClientState
+#define glEnableVertexAttribArray		glbatch_glEnableVertexAttribArray
+#define glEnd					glbatch_glEnd
+#define glEndList				glbatch_glEndList
+#define glEvalMesh2				glbatch_glEvalMesh2
+#define glFinish				glbatch_glFinish
+#define glFlush					glbatch_glFlush
+#define glFogf					glbatch_glFogf
+#define glFogfv					glbatch_glFogfv
+#define glFogi					glbatch_glFogi
+#define glFramebufferRenderbuffer		glbatch_glFramebufferRenderbuffer
+#define glFramebufferTexture2D			glbatch_glFramebufferTexture2D
+#define glFrontFace				glbatch_glFrontFace
+#define glFrustum				glbatch_glFrustum
+#define glGenBuffers				glbatch_glGenBuffers
+#define glGenFramebuffers			glbatch_glGenFramebuffers
+#define glGenLists				glbatch_glGenLists
+#define glGenRenderbuffers			glbatch_glGenRenderbuffers
+#define glGenTextures				glbatch_glGenTextures
+#define glGenerateMipmap			glbatch_glGenerateMipmap
+#define glGetAttribLocation			glbatch_glGetAttribLocation
+#define glGetBooleanv				glbatch_glGetBooleanv
+#define glGetDoublev				glbatch_glGetDoublev
+#define glGetError				glbatch_glGetError
+#define glGetFloatv				glbatch_glGetFloatv
+#define glGetIntegerv				glbatch_glGetIntegerv
+#define glGetProgramBinary			glbatch_glGetProgramBinary
+#define glGetProgramInfoLog			glbatch_glGetProgramInfoLog
+#define glGetProgramiv				glbatch_glGetProgramiv
+#define glGetShaderInfoLog			glbatch_glGetShaderInfoLog
+#define glGetShaderiv				glbatch_glGetShaderiv
+#define glGetString				glbatch_glGetString
+#define glGetUniformLocation			glbatch_glGetUniformLocation
+#define glHint					glbatch_glHint
+#define glIndexi				glbatch_glIndexi
+#define glInitNames				glbatch_glInitNames
+#define glInterleavedArrays			glbatch_glInterleavedArrays
+#define glIsEnabled				glbatch_glIsEnabled
+#define glIsList				glbatch_glIsList
+#define glLightModelf				glbatch_glLightModelf
+#define glLightModelfv				glbatch_glLightModelfv
+#define glLightModeli				glbatch_glLightModeli
+#define glLightModeliv				glbatch_glLightModeliv
+#define glLightf				glbatch_glLightf
+#define glLightfv				glbatch_glLightfv
+#define glLighti				glbatch_glLighti
+#define glLineWidth				glbatch_glLineWidth
+#define glLinkProgram				glbatch_glLinkProgram
+#define glLoadIdentity				glbatch_glLoadIdentity
+#define glLogicOp				glbatch_glLogicOp
+#define glMap2f					glbatch_glMap2f
+#define glMapGrid2f				glbatch_glMapGrid2f
+#define glMaterialf				glbatch_glMaterialf
+#define glMaterialfv				glbatch_glMaterialfv
+#define glMateriali				glbatch_glMateriali
+#define glMaterialiv				glbatch_glMaterialiv
+#define glMatrixMode				glbatch_glMatrixMode
+#define glMultMatrixf				glbatch_glMultMatrixf
+#define glNewList				glbatch_glNewList
+#define glNormal3d				glbatch_glNormal3d
+#define glNormal3dv				glbatch_glNormal3dv
+#define glNormal3f				glbatch_glNormal3f
+#define glNormal3fv				glbatch_glNormal3fv
+#define glNormalPointer				glbatch_glNormalPointer
+#define glOrtho					glbatch_glOrtho
+#define glPixelStorei				glbatch_glPixelStorei
+#define glPixelZoom				glbatch_glPixelZoom
+#define glPointSize				glbatch_glPointSize
+#define glPolygonMode				glbatch_glPolygonMode
+#define glPolygonOffset				glbatch_glPolygonOffset
+#define glPopAttrib				glbatch_glPopAttrib
+#define glPopMatrix				glbatch_glPopMatrix
+#define glPopName				glbatch_glPopName
+#define glProgramBinary				glbatch_glProgramBinary
+#define glProgramParameteri			glbatch_glProgramParameteri
+#define glPushAttrib				glbatch_glPushAttrib
+#define glPushMatrix				glbatch_glPushMatrix
+#define glPushName				glbatch_glPushName
+#define glRasterPos2f				glbatch_glRasterPos2f
+#define glRasterPos2i				glbatch_glRasterPos2i
+#define glReadBuffer				glbatch_glReadBuffer
+#define glReadPixels				glbatch_glReadPixels
+#define glRectd					glbatch_glRectd
+#define glRectf					glbatch_glRectf
+#define glRenderMode				glbatch_glRenderMode
+#define glRenderbufferStorage			glbatch_glRenderbufferStorage
+#define glRotated				glbatch_glRotated
+#define glRotatef				glbatch_glRotatef
+#define glScaled				glbatch_glScaled
+#define glScalef				glbatch_glScalef
+#define glSelectBuffer				glbatch_glSelectBuffer
+#define glShadeModel				glbatch_glShadeModel
+#define glShaderSource				glbatch_glShaderSource
+#define glStencilFunc				glbatch_glStencilFunc
+#define glStencilOp				glbatch_glStencilOp
+#define glTexCoord1f				glbatch_glTexCoord1f
+#define glTexCoord2d				glbatch_glTexCoord2d
+#define glTexCoord2f				glbatch_glTexCoord2f
+#define glTexCoord2fv				glbatch_glTexCoord2fv
+#define glTexCoord3f				glbatch_glTexCoord3f
+#define glTexCoord3fv				glbatch_glTexCoord3fv
+#define glTexCoord4f				glbatch_glTexCoord4f
+#define glTexCoord4fv				glbatch_glTexCoord4fv
+#define glTexCoordPointer			glbatch_glTexCoordPointer
+#define glTexEnvf				glbatch_glTexEnvf
+#define glTexEnvfv				glbatch_glTexEnvfv
+#define glTexEnvi				glbatch_glTexEnvi
+#define glTexGenfv				glbatch_glTexGenfv
+#define glTexGeni				glbatch_glTexGeni
+#define glTexImage1D				glbatch_glTexImage1D
+#define glTexImage2D				glbatch_glTexImage2D
+#define glTexParameterf				glbatch_glTexParameterf
+#define glTexParameteri				glbatch_glTexParameteri
+#define glTexSubImage2D				glbatch_glTexSubImage2D
+#define glTranslated				glbatch_glTranslated
+#define glTranslatef				glbatch_glTranslatef
+#define glUniform1f				glbatch_glUniform1f
+#define glUniform1i				glbatch_glUniform1i
+#define glUniform3fv				glbatch_glUniform3fv
+#define glUniform4f				glbatch_glUniform4f
+#define glUniform4fv				glbatch_glUniform4fv
+#define glUniformMatrix4fv			glbatch_glUniformMatrix4fv
+#define glUseProgram				glbatch_glUseProgram
+#define glVertex2d				glbatch_glVertex2d
+#define glVertex2f				glbatch_glVertex2f
+#define glVertex2fv				glbatch_glVertex2fv
+#define glVertex2i				glbatch_glVertex2i
+#define glVertex3d				glbatch_glVertex3d
+#define glVertex3dv				glbatch_glVertex3dv
+#define glVertex3f				glbatch_glVertex3f
+#define glVertex3fv				glbatch_glVertex3fv
+#define glVertex3i				glbatch_glVertex3i
+#define glVertex4f				glbatch_glVertex4f
+#define glVertex4fv				glbatch_glVertex4fv
+#define glVertexAttrib4f			glbatch_glVertexAttrib4f
+#define glVertexAttrib4fv			glbatch_glVertexAttrib4fv
+#define glVertexAttribPointer			glbatch_glVertexAttribPointer
+#define glVertexPointer				glbatch_glVertexPointer
+#define glViewport				glbatch_glViewport
+#define gluBuild2DMipmaps			glbatch_gluBuild2DMipmaps
+#define gluCylinder				glbatch_gluCylinder
+#define gluDisk					glbatch_gluDisk
+#define gluLookAt				glbatch_gluLookAt
+#define gluPerspective				glbatch_gluPerspective
+#define gluPickMatrix				glbatch_gluPickMatrix
+#define gluSphere				glbatch_gluSphere
+
+#endif /* __GLBATCH_H__ */
@@ -0,0 +1,350 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or 
+ * implied warranty.
+ */
+
+/* Batches glBegin/glEnd drawing into streaming VBOs on desktop OpenGL.
+   See glbatch.c for details.
+ */
+
+#ifndef __GLBATCH_I_H__
+#define __GLBATCH_I_H__
+
+extern void glbatch_flush (void);
+
+extern void glbatch_glBegin (GLenum);
+extern void glbatch_glEnd (void);
+
+extern void glbatch_glVertex2d (GLdouble, GLdouble);
+extern void glbatch_glVertex2f (GLfloat, GLfloat);
+extern void glbatch_glVertex2fv (const GLfloat *);
+extern void glbatch_glVertex2i (GLint, GLint);
+extern void glbatch_glVertex3d (GLdouble, GLdouble, GLdouble);
+extern void glbatch_glVertex3dv (const GLdouble *);
+extern void glbatch_glVertex3f (GLfloat, GLfloat, GLfloat);
+extern void glbatch_glVertex3fv (const GLfloat *);
+extern void glbatch_glVertex3i (GLint, GLint, GLint);
+extern void glbatch_glVertex4f (GLfloat, GLfloat, GLfloat, GLfloat);
+extern void glbatch_glVertex4fv (const GLfloat *);
+
+extern void glbatch_glNormal3d (GLdouble, GLdouble, GLdouble);
+extern void glbatch_glNormal3dv (const GLdouble *);
+extern void glbatch_glNormal3f (GLfloat, GLfloat, GLfloat);
+extern void glbatch_glNormal3fv (const GLfloat *);
+
+extern void glbatch_glColor3d (GLdouble, GLdouble, GLdouble);
+extern void glbatch_glColor3f (GLfloat, GLfloat, GLfloat);
+extern void glbatch_glColor3fv (const GLfloat *);
+extern void glbatch_glColor3ub (GLubyte, GLubyte, GLubyte);
+extern void glbatch_glColor3ubv (const GLubyte *);
+extern void glbatch_glColor4d (GLdouble, GLdouble, GLdouble, GLdouble);
+extern void glbatch_glColor4f (GLfloat, GLfloat, GLfloat, GLfloat);
+extern void glbatch_glColor4fv (const GLfloat *);
+extern void glbatch_glColor4ub (GLubyte, GLubyte, GLubyte, GLubyte);
+extern void glbatch_glColor4ubv (const GLubyte *);
+
+extern void glbatch_glTexCoord1f (GLfloat);
+extern void glbatch_glTexCoord2d (GLdouble, GLdouble);
+extern void glbatch_glTexCoord2f (GLfloat, GLfloat);
+extern void glbatch_glTexCoord2fv (const GLfloat *);
+extern void glbatch_glTexCoord3f (GLfloat, GLfloat, GLfloat);
+extern void glbatch_glTexCoord3fv (const GLfloat *);
+extern void glbatch_glTexCoord4f (GLfloat, GLfloat, GLfloat, GLfloat);
+extern void glbatch_glTexCoord4fv (const GLfloat *);
+
+/* These may be called inside glBegin, or change state behind our back. */
+extern void glbatch_glMaterialf (GLenum, GLenum, GLfloat);
+extern void glbatch_glMaterialfv (GLenum, GLenum, const GLfloat *);
+extern void glbatch_glMateriali (GLenum, GLenum, GLint);
+extern void glbatch_glMaterialiv (GLenum, GLenum, const GLint *);
+extern void glbatch_glNewList (GLuint, GLenum);
+extern void glbatch_glEndList (void);
+extern void glbatch_glCallList (GLuint);
+extern void glbatch_glCallLists (GLsizei, GLenum, const GLvoid *);
+extern void glbatch_glPopAttrib (void);
+extern void glbatch_glPolygonMode (GLenum, GLenum);
+
+
+/* Everything else just draws any pending batch, then calls the real
+   function.  This list is used both for the prototypes and, in glbatch.c,
+   for the definitions: V is a function returning void, R one that doesn't.
+ */
+#define GLBATCH_FLUSHING_WRAPPERS \
+  V (glActiveTexture, (GLenum a), (a)) \
+  V (glAlphaFunc, (GLenum a, GLclampf b), (a, b)) \
+  V (glAttachShader, (GLuint a, GLuint b), (a, b)) \
+  V (glBindBuffer, (GLenum a, GLuint b), (a, b)) \
+  V (glBindFramebuffer, (GLenum a, GLuint b), (a, b)) \
+  V (glBindRenderbuffer, (GLenum a, GLuint b), (a, b)) \
+  V (glBindTexture, (GLenum a, GLuint b), (a, b)) \
+  V (glBlendColor, \
+     (GLclampf a, GLclampf b, GLclampf c, GLclampf d), \
+     (a, b, c, d)) \
+  V (glBlendEquation, (GLenum a), (a)) \
+  V (glBlendFunc, (GLenum a, GLenum b), (a, b)) \
+  V (glBlitNamedFramebuffer, \
+     (GLuint a, GLuint b, GLint c, GLint d, GLint e, GLint f, GLint g, \
+      GLint h, GLint i, GLint j, GLbitfield k, GLenum l), \
+     (a, b, c, d, e, f, g, h, i, j, k, l)) \
+  V (glBufferData, \
+     (GLenum a, GLsizeiptr b, const void *c, GLenum d), \
+     (a, b, c, d)) \
+  V (glBufferSubData, \
+     (GLenum a, GLintptr b, GLsizeiptr c, const void *d), \
+     (a, b, c, d)) \
+  V (glClear, (GLbitfield a), (a)) \
+  V (glClearColor, \
+     (GLclampf a, GLclampf b, GLclampf c, GLclampf d), \
+     (a, b, c, d)) \
+  V (glClearDepth, (GLclampd a), (a)) \
+  V (glClearIndex, (GLfloat a), (a)) \
+  V (glClearStencil, (GLint a), (a)) \
+  V (glClientActiveTexture, (GLenum a), (a)) \
+  V (glClipPlane, (GLenum a, const GLdouble *b), (a, b)) \
+  V (glColorMask, \
+     (GLboolean a, GLboolean b, GLboolean c, GLboolean d), \
+     (a, b, c, d)) \
+  V (glColorMaterial, (GLenum a, GLenum b), (a, b)) \
+  V (glColorPointer, \
+     (GLint a, GLenum b, GLsizei c, const GLvoid *d), \
+     (a, b, c, d)) \
+  V (glCompileShader, (GLuint a), (a)) \
+  V (glCopyTexImage2D, \
+     (GLenum a, GLint b, GLenum c, GLint d, GLint e, GLsizei f, \
+      GLsizei g, GLint h), \
+     (a, b, c, d, e, f, g, h)) \
+  V (glCopyTexSubImage2D, \
+     (GLenum a, GLint b, GLint c, GLint d, GLint e, GLint f, GLsizei g, \
+      GLsizei h), \
+     (a, b, c, d, e, f, g, h)) \
+  R (GLuint, glCreateProgram, (void), ()) \
+  R (GLuint, glCreateShader, (GLenum a), (a)) \
+  V (glCullFace, (GLenum a), (a)) \
+  V (glDeleteBuffers, (GLsizei a, const GLuint *b), (a, b)) \
+  V (glDeleteFramebuffers, (GLsizei a, const GLuint *b), (a, b)) \
+  V (glDeleteLists, (GLuint a, GLsizei b), (a, b)) \
+  V (glDeleteProgram, (GLuint a), (a)) \
+  V (glDeleteRenderbuffers, (GLsizei a, const GLuint *b), (a, b)) \
+  V (glDeleteShader, (GLuint a), (a)) \
+  V (glDeleteTextures, (GLsizei a, const GLuint *b), (a, b)) \
+  V (glDepthFunc, (GLenum a), (a)) \
+  V (glDepthMask, (GLboolean a), (a)) \
+  V (glDisable, (GLenum a), (a)) \
+  V (glDisableClientState, (GLenum a), (a)) \
+  V (glDisableVertexAttribArray, (GLuint a), (a)) \
+  V (glDrawArrays, (GLenum a, GLint b, GLsizei c), (a, b, c)) \
+  V (glDrawBuffer, (GLenum a), (a)) \
+  V (glDrawElements, \
+     (GLenum a, GLsizei b, GLenum c, const GLvoid *d), \
+     (a, b, c, d)) \
+  V (glDrawPixels, \
+     (GLsizei a, GLsizei b, GLenum c, GLenum d, const GLvoid *e), \
+     (a, b, c, d, e)) \
+  V (glEnable, (GLenum a), (a)) \
+  V (glEnableClientState, (GLenum a), (a)) \
+  V (glEnableVertexAttribArray, (GLuint a), (a)) \
+  V (glEvalMesh2, \
+     (GLenum a, GLint b, GLint c, GLint d, GLint e), \
+     (a, b, c, d, e)) \
+  V (glFinish, (void), ()) \
+  V (glFlush, (void), ()) \
+  V (glFogf, (GLenum a, GLfloat b), (a, b)) \
+  V (glFogfv, (GLenum a, const GLfloat *b), (a, b)) \
+  V (glFogi, (GLenum a, GLint b), (a, b)) \
+  V (glFramebufferRenderbuffer, \
+     (GLenum a, GLenum b, GLenum c, GLuint d), \
+     (a, b, c, d)) \
+  V (glFramebufferTexture2D, \
+     (GLenum a, GLenum b, GLenum c, GLuint d, GLint e), \
+     (a, b, c, d, e)) \
+  V (glFrontFace, (GLenum a), (a)) \
+  V (glFrustum, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d, GLdouble e, \
+      GLdouble f), \
+     (a, b, c, d, e, f)) \
+  V (glGenBuffers, (GLsizei a, GLuint *b), (a, b)) \
+  V (glGenFramebuffers, (GLsizei a, GLuint *b), (a, b)) \
+  R (GLuint, glGenLists, (GLsizei a), (a)) \
+  V (glGenRenderbuffers, (GLsizei a, GLuint *b), (a, b)) \
+  V (glGenTextures, (GLsizei a, GLuint *b), (a, b)) \
+  V (glGenerateMipmap, (GLenum a), (a)) \
+  R (GLint, glGetAttribLocation, (GLuint a, const GLchar *b), (a, b)) \
+  V (glGetBooleanv, (GLenum a, GLboolean *b), (a, b)) \
+  V (glGetDoublev, (GLenum a, GLdouble *b), (a, b)) \
+  R (GLenum, glGetError, (void), ()) \
+  V (glGetFloatv, (GLenum a, GLfloat *b), (a, b)) \
+  V (glGetIntegerv, (GLenum a, GLint *b), (a, b)) \
+  V (glGetProgramBinary, \
+     (GLuint a, GLsizei b, GLsizei *c, GLenum *d, void *e), \
+     (a, b, c, d, e)) \
+  V (glGetProgramInfoLog, \
+     (GLuint a, GLsizei b, GLsizei *c, GLchar *d), \
+     (a, b, c, d)) \
+  V (glGetProgramiv, (GLuint a, GLenum b, GLint *c), (a, b, c)) \
+  V (glGetShaderInfoLog, \
+     (GLuint a, GLsizei b, GLsizei *c, GLchar *d), \
+     (a, b, c, d)) \
+  V (glGetShaderiv, (GLuint a, GLenum b, GLint *c), (a, b, c)) \
+  R (const GLubyte *, glGetString, (GLenum a), (a)) \
+  R (GLint, glGetUniformLocation, (GLuint a, const GLchar *b), (a, b)) \
+  V (glHint, (GLenum a, GLenum b), (a, b)) \
+  V (glIndexi, (GLint a), (a)) \
+  V (glInitNames, (void), ()) \
+  V (glInterleavedArrays, \
+     (GLenum a, GLsizei b, const GLvoid *c), \
+     (a, b, c)) \
+  R (GLboolean, glIsEnabled, (GLenum a), (a)) \
+  R (GLboolean, glIsList, (GLuint a), (a)) \
+  V (glLightModelf, (GLenum a, GLfloat b), (a, b)) \
+  V (glLightModelfv, (GLenum a, const GLfloat *b), (a, b)) \
+  V (glLightModeli, (GLenum a, GLint b), (a, b)) \
+  V (glLightModeliv, (GLenum a, const GLint *b), (a, b)) \
+  V (glLightf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  V (glLightfv, (GLenum a, GLenum b, const GLfloat *c), (a, b, c)) \
+  V (glLighti, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  V (glLineWidth, (GLfloat a), (a)) \
+  V (glLinkProgram, (GLuint a), (a)) \
+  V (glLoadIdentity, (void), ()) \
+  V (glLogicOp, (GLenum a), (a)) \
+  V (glMap2f, \
+     (GLenum a, GLfloat b, GLfloat c, GLint d, GLint e, GLfloat f, \
+      GLfloat g, GLint h, GLint i, const GLfloat *j), \
+     (a, b, c, d, e, f, g, h, i, j)) \
+  V (glMapGrid2f, \
+     (GLint a, GLfloat b, GLfloat c, GLint d, GLfloat e, GLfloat f), \
+     (a, b, c, d, e, f)) \
+  V (glMatrixMode, (GLenum a), (a)) \
+  V (glMultMatrixf, (const GLfloat *a), (a)) \
+  V (glNormalPointer, (GLenum a, GLsizei b, const GLvoid *c), (a, b, c)) \
+  V (glOrtho, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d, GLdouble e, \
+      GLdouble f), \
+     (a, b, c, d, e, f)) \
+  V (glPixelStorei, (GLenum a, GLint b), (a, b)) \
+  V (glPixelZoom, (GLfloat a, GLfloat b), (a, b)) \
+  V (glPointSize, (GLfloat a), (a)) \
+  V (glPolygonOffset, (GLfloat a, GLfloat b), (a, b)) \
+  V (glPopMatrix, (void), ()) \
+  V (glPopName, (void), ()) \
+  V (glProgramBinary, \
+     (GLuint a, GLenum b, const void *c, GLsizei d), \
+     (a, b, c, d)) \
+  V (glProgramParameteri, (GLuint a, GLenum b, GLint c), (a, b, c)) \
+  V (glPushAttrib, (GLbitfield a), (a)) \
+  V (glPushMatrix, (void), ()) \
+  V (glPushName, (GLuint a), (a)) \
+  V (glRasterPos2f, (GLfloat a, GLfloat b), (a, b)) \
+  V (glRasterPos2i, (GLint a, GLint b), (a, b)) \
+  V (glReadBuffer, (GLenum a), (a)) \
+  V (glReadPixels, \
+     (GLint a, GLint b, GLsizei c, GLsizei d, GLenum e, GLenum f, \
+      GLvoid *g), \
+     (a, b, c, d, e, f, g)) \
+  V (glRectd, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d), \
+     (a, b, c, d)) \
+  V (glRectf, (GLfloat a, GLfloat b, GLfloat c, GLfloat d), (a, b, c, d)) \
+  R (GLint, glRenderMode, (GLenum a), (a)) \
+  V (glRenderbufferStorage, \
+     (GLenum a, GLenum b, GLsizei c, GLsizei d), \
+     (a, b, c, d)) \
+  V (glRotated, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d), \
+     (a, b, c, d)) \
+  V (glRotatef, \
+     (GLfloat a, GLfloat b, GLfloat c, GLfloat d), \
+     (a, b, c, d)) \
+  V (glScaled, (GLdouble a, GLdouble b, GLdouble c), (a, b, c)) \
+  V (glScalef, (GLfloat a, GLfloat b, GLfloat c), (a, b, c)) \
+  V (glSelectBuffer, (GLsizei a, GLuint *b), (a, b)) \
+  V (glShadeModel, (GLenum a), (a)) \
+  V (glShaderSource, \
+     (GLuint a, GLsizei b, const GLchar *const*c, const GLint *d), \
+     (a, b, c, d)) \
+  V (glStencilFunc, (GLenum a, GLint b, GLuint c), (a, b, c)) \
+  V (glStencilOp, (GLenum a, GLenum b, GLenum c), (a, b, c)) \
+  V (glTexCoordPointer, \
+     (GLint a, GLenum b, GLsizei c, const GLvoid *d), \
+     (a, b, c, d)) \
+  V (glTexEnvf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  V (glTexEnvfv, (GLenum a, GLenum b, const GLfloat *c), (a, b, c)) \
+  V (glTexEnvi, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  V (glTexGenfv, (GLenum a, GLenum b, const GLfloat *c), (a, b, c)) \
+  V (glTexGeni, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  V (glTexImage1D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLint e, GLenum f, \
+      GLenum g, const GLvoid *h), \
+     (a, b, c, d, e, f, g, h)) \
+  V (glTexImage2D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLsizei e, GLint f, \
+      GLenum g, GLenum h, const GLvoid *i), \
+     (a, b, c, d, e, f, g, h, i)) \
+  V (glTexParameterf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  V (glTexParameteri, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  V (glTexSubImage2D, \
+     (GLenum a, GLint b, GLint c, GLint d, GLsizei e, GLsizei f, \
+      GLenum g, GLenum h, const GLvoid *i), \
+     (a, b, c, d, e, f, g, h, i)) \
+  V (glTranslated, (GLdouble a, GLdouble b, GLdouble c), (a, b, c)) \
+  V (glTranslatef, (GLfloat a, GLfloat b, GLfloat c), (a, b, c)) \
+  V (glUniform1f, (GLint a, GLfloat b), (a, b)) \
+  V (glUniform1i, (GLint a, GLint b), (a, b)) \
+  V (glUniform3fv, (GLint a, GLsizei b, const GLfloat *c), (a, b, c)) \
+  V (glUniform4f, \
+     (GLint a, GLfloat b, GLfloat c, GLfloat d, GLfloat e), \
+     (a, b, c, d, e)) \
+  V (glUniform4fv, (GLint a, GLsizei b, const GLfloat *c), (a, b, c)) \
+  V (glUniformMatrix4fv, \
+     (GLint a, GLsizei b, GLboolean c, const GLfloat *d), \
+     (a, b, c, d)) \
+  V (glUseProgram, (GLuint a), (a)) \
+  V (glVertexAttrib4f, \
+     (GLuint a, GLfloat b, GLfloat c, GLfloat d, GLfloat e), \
+     (a, b, c, d, e)) \
+  V (glVertexAttrib4fv, (GLuint a, const GLfloat *b), (a, b)) \
+  V (glVertexAttribPointer, \
+     (GLuint a, GLint b, GLenum c, GLboolean d, GLsizei e, \
+      const void *f), \
+     (a, b, c, d, e, f)) \
+  V (glVertexPointer, \
+     (GLint a, GLenum b, GLsizei c, const GLvoid *d), \
+     (a, b, c, d)) \
+  V (glViewport, (GLint a, GLint b, GLsizei c, GLsizei d), (a, b, c, d)) \
+  V (gluPerspective, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d), \
+     (a, b, c, d)) \
+  V (gluLookAt, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d, GLdouble e, \
+      GLdouble f, GLdouble g, GLdouble h, GLdouble i), \
+     (a, b, c, d, e, f, g, h, i)) \
+  V (gluPickMatrix, \
+     (GLdouble a, GLdouble b, GLdouble c, GLdouble d, GLint *e), \
+     (a, b, c, d, e)) \
+  R (GLint, gluBuild2DMipmaps, \
+     (GLenum a, GLint b, GLsizei c, GLsizei d, GLenum e, GLenum f, \
+      const void *g), \
+     (a, b, c, d, e, f, g)) \
+  V (gluSphere, \
+     (GLUquadric *a, GLdouble b, GLint c, GLint d), \
+     (a, b, c, d)) \
+  V (gluCylinder, \
+     (GLUquadric *a, GLdouble b, GLdouble c, GLdouble d, GLint e, \
+      GLint f), \
+     (a, b, c, d, e, f)) \
+  V (gluDisk, \
+     (GLUquadric *a, GLdouble b, GLdouble c, GLint d, GLint e), \
+     (a, b, c, d, e))
+
+#define V(NAME,ARGS,VARS)     extern void glbatch_##NAME ARGS;
+#define R(RET,NAME,ARGS,VARS) extern RET glbatch_##NAME ARGS;
+GLBATCH_FLUSHING_WRAPPERS
+#undef V
+#undef R
+
+#endif /* __GLBATCH_I_H__ */
@@ -0,0 +1,571 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* There are a lot of GL hacks, written over 30 years against every
+   version of OpenGL, and it is hard to tell from the source which ones
+   are slow because of how many calls they make, how much they upload, or
+   how long they wait for the GPU.  This counts, for each frame:
+
+     - draw calls: glBegin, glDrawArrays, glDrawElements, glCallList...;
+     - vertexes: glVertex, and the counts passed to glDraw*, but not what
+       is inside display lists;
+     - state changes: glEnable, glBindTexture, glMaterial and the like;
+     - bytes uploaded with glTexImage, glTexSubImage, gluBuild2DMipmaps,
+       glDrawPixels, glBufferData and glBufferSubData;
+     - stalls: glFinish, glReadPixels and glGetTexImage, and the bytes
+       read back;
+     - GPU time, with GL_TIME_ELAPSED queries on OpenGL 3.3 or with
+       GL_ARB_timer_query.  Results are picked up whenever they're ready,
+       a few frames later, and a frame goes untimed rather than wait.
+
+   Calls made while compiling a display list are in the per-function
+   table, but not in the totals, since nothing was drawn yet.
+
+   Every function listed in glprofI.h is renamed by glprof.h to a wrapper
+   here that counts it and then calls the real one.  A frame is from
+   glprof_frame_begin() to glprof_frame_end(), which wayland/screenhack.c
+   calls around the hack's draw function; so the FPS display itself is
+   counted too.
+
+   The averages per frame are added to the FPS display, and if
+   $XSCREENSAVER_GLPROF is set, each frame is written to that file ("-"
+   for stdout) as one line of JSON, with the calls to each function.
+
+   It is compiled in with the 'glprof' option in wayland/meson.build.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#ifdef HAVE_GLPROF	/* whole file */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifndef  GL_GLEXT_PROTOTYPES
+# define GL_GLEXT_PROTOTYPES /* for glBufferData and glBeginQuery */
+#endif
+#include <GL/gl.h>
+#include <GL/glu.h>
+
+#include "glprofI.h"
+
+#define GPU_QUERIES 4		/* Frames in flight before we skip one */
+
+enum {
+#define W(KIND,NAME,ARGS,VARS) GLPROF_##NAME,
+  GLPROF_WRAPPERS
+#undef W
+  GLPROF_FUNCTIONS
+};
+
+static const char * const function_names[] = {
+#define W(KIND,NAME,ARGS,VARS) #NAME,
+  GLPROF_WRAPPERS
+#undef W
+};
+
+enum { DRAWS, VERTEXES, STATE, UPLOAD, READBACK, STALLS, COUNTS };
+
+static const char * const count_names[] = {
+  "draws", "vertexes", "state_changes", "upload_bytes", "readback_bytes",
+  "stalls"
+};
+
+static struct {
+  int initted;
+  int compiling;		/* Inside glNewList with GL_COMPILE */
+  unsigned long frame;
+  unsigned long cur[COUNTS];	/* This frame */
+  unsigned long calls[GLPROF_FUNCTIONS];
+  unsigned long total[COUNTS];	/* Since the last glprof_fps_string */
+  unsigned long frames;
+  FILE *json;
+
+  int timer_p;			/* GL_TIME_ELAPSED works */
+  GLuint queries[GPU_QUERIES];	/* A ring of those in flight */
+  unsigned long query_frames[GPU_QUERIES];
+  int query_head, query_count, query_open;
+  double gpu_ms;		/* Since the last glprof_fps_string */
+  unsigned long gpu_frames;
+} prof;
+
+
+/* Counts a call, and returns whether it does anything right now.
+ */
+static int
+count (int fn)
+{
+  prof.calls[fn]++;
+  return !prof.compiling;
+}
+
+
+static unsigned long
+pixel_size (GLenum format, GLenum type)
+{
+  unsigned long n;
+  switch (type) {
+  case GL_UNSIGNED_BYTE_3_3_2:
+  case GL_UNSIGNED_BYTE_2_3_3_REV:
+    return 1;
+  case GL_UNSIGNED_SHORT_5_6_5:
+  case GL_UNSIGNED_SHORT_5_6_5_REV:
+  case GL_UNSIGNED_SHORT_4_4_4_4:
+  case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+  case GL_UNSIGNED_SHORT_5_5_5_1:
+  case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+    return 2;
+  case GL_UNSIGNED_INT_8_8_8_8:
+  case GL_UNSIGNED_INT_8_8_8_8_REV:
+  case GL_UNSIGNED_INT_10_10_10_2:
+  case GL_UNSIGNED_INT_2_10_10_10_REV:
+    return 4;
+  case GL_UNSIGNED_BYTE:
+  case GL_BYTE:
+    n = 1;
+    break;
+  case GL_UNSIGNED_SHORT:
+  case GL_SHORT:
+# ifdef GL_HALF_FLOAT
+  case GL_HALF_FLOAT:
+# endif
+    n = 2;
+    break;
+  default:
+    n = 4;
+    break;
+  }
+
+  switch (format) {
+  case GL_RGBA: case GL_BGRA:		return n * 4;
+  case GL_RGB:  case GL_BGR:		return n * 3;
+  case GL_LUMINANCE_ALPHA:		return n * 2;
+# ifdef GL_RG
+  case GL_RG:				return n * 2;
+# endif
+  default:				return n;
+  }
+}
+
+
+/* Whether GL_TIME_ELAPSED queries are there.
+ */
+static int
+timer_query_p (void)
+{
+  const char *version = (const char *) glGetString (GL_VERSION);
+  const char *ext = (const char *) glGetString (GL_EXTENSIONS);
+  int major = 0, minor = 0;
+  if (version &&
+      2 == sscanf (version, "%d.%d", &major, &minor) &&
+      (major > 3 || (major == 3 && minor >= 3)))
+    return 1;
+  return (ext && strstr (ext, "GL_ARB_timer_query") != 0);
+}
+
+
+static void
+glprof_init (void)
+{
+  const char *file = getenv ("XSCREENSAVER_GLPROF");
+  prof.initted = 1;
+
+  if (file && *file)
+    {
+      prof.json = (!strcmp (file, "-") ? stdout : fopen (file, "w"));
+      if (prof.json)
+        setvbuf (prof.json, 0, _IOLBF, 0);
+      else
+        fprintf (stderr, "glprof: %s: %s\n", file, strerror (errno));
+    }
+
+  prof.timer_p = timer_query_p();
+  if (prof.timer_p)
+    glGenQueries (GPU_QUERIES, prof.queries);
+}
+
+
+void
+glprof_frame_begin (void)
+{
+  if (! prof.initted)
+    glprof_init();
+
+  memset (prof.cur, 0, sizeof(prof.cur));
+  memset (prof.calls, 0, sizeof(prof.calls));
+
+  if (prof.timer_p && prof.query_count < GPU_QUERIES)
+    {
+      int i = (prof.query_head + prof.query_count) % GPU_QUERIES;
+      prof.query_frames[i] = prof.frame;
+      glBeginQuery (GL_TIME_ELAPSED, prof.queries[i]);
+      prof.query_open = 1;
+    }
+}
+
+
+void
+glprof_frame_end (void)
+{
+  unsigned long gpu_frames[GPU_QUERIES];
+  double gpu_ms[GPU_QUERIES];
+  int i, ngpu = 0;
+
+  if (prof.query_open)
+    {
+      glEndQuery (GL_TIME_ELAPSED);
+      prof.query_open = 0;
+      prof.query_count++;
+    }
+
+  /* Pick up whichever timings are in, oldest first, without waiting. */
+  while (prof.query_count)
+    {
+      GLuint q = prof.queries[prof.query_head];
+      GLint done = 0;
+      GLuint64 ns = 0;
+      glGetQueryObjectiv (q, GL_QUERY_RESULT_AVAILABLE, &done);
+      if (! done) break;
+      glGetQueryObjectui64v (q, GL_QUERY_RESULT, &ns);
+      gpu_frames[ngpu] = prof.query_frames[prof.query_head];
+      gpu_ms[ngpu] = ns / 1000000.0;
+      prof.gpu_ms += gpu_ms[ngpu];
+      prof.gpu_frames++;
+      ngpu++;
+      prof.query_head = (prof.query_head + 1) % GPU_QUERIES;
+      prof.query_count--;
+    }
+
+  for (i = 0; i < COUNTS; i++)
+    prof.total[i] += prof.cur[i];
+  prof.frames++;
+
+  if (prof.json)
+    {
+      const char *sep = "";
+      fprintf (prof.json, "{\"frame\":%lu", prof.frame);
+      for (i = 0; i < COUNTS; i++)
+        fprintf (prof.json, ",\"%s\":%lu", count_names[i], prof.cur[i]);
+      if (ngpu)
+        {
+          fprintf (prof.json, ",\"gpu\":[");
+          for (i = 0; i < ngpu; i++)
+            fprintf (prof.json, "%s{\"frame\":%lu,\"ms\":%.3f}",
+                     (i ? "," : ""), gpu_frames[i], gpu_ms[i]);
+          fprintf (prof.json, "]");
+        }
+      fprintf (prof.json, ",\"calls\":{");
+      for (i = 0; i < GLPROF_FUNCTIONS; i++)
+        if (prof.calls[i])
+          {
+            fprintf (prof.json, "%s\"%s\":%lu", sep,
+                     function_names[i], prof.calls[i]);
+            sep = ",";
+          }
+      fprintf (prof.json, "}}\n");
+    }
+
+  prof.frame++;
+}
+
+
+static void
+format_bytes (char *out, double bytes)
+{
+  if (bytes >= 1024 * 1024)
+    sprintf (out, "%.1f MB", bytes / (1024 * 1024));
+  else if (bytes >= 1024)
+    sprintf (out, "%.1f KB", bytes / 1024);
+  else
+    sprintf (out, "%.0f B", bytes);
+}
+
+
+void
+glprof_fps_string (char *out, size_t size)
+{
+  double n = (prof.frames ? prof.frames : 1);
+  char upload[40], gpu[40];
+  int i;
+
+  format_bytes (upload, prof.total[UPLOAD] / n);
+  if (prof.gpu_frames)
+    sprintf (gpu, "\nGPU:    %.2f ms ", prof.gpu_ms / prof.gpu_frames);
+  else
+    *gpu = 0;
+
+  snprintf (out, size,
+            "\nDraws:  %.0f \nVerts:  %.0f \nState:  %.0f "
+            "\nUpload: %s \nStalls: %.1f %s",
+            prof.total[DRAWS] / n, prof.total[VERTEXES] / n,
+            prof.total[STATE] / n, upload, prof.total[STALLS] / n, gpu);
+
+  for (i = 0; i < COUNTS; i++)
+    prof.total[i] = 0;
+  prof.frames = 0;
+  prof.gpu_ms = 0;
+  prof.gpu_frames = 0;
+}
+
+
+/* The generated wrappers.
+ */
+#define W(KIND,NAME,ARGS,VARS) GLPROF_DEFINE_##KIND (NAME, ARGS, VARS)
+#define GLPROF_DEFINE_CUSTOM(NAME,ARGS,VARS)	 /* below */
+#define GLPROF_DEFINE_CUSTOM_INT(NAME,ARGS,VARS) /* below */
+#define GLPROF_DEFINE_VERTEX(NAME,ARGS,VARS) \
+  void glprof_##NAME ARGS { \
+    if (count (GLPROF_##NAME)) prof.cur[VERTEXES]++; \
+    NAME VARS; \
+  }
+#define GLPROF_DEFINE_STATE(NAME,ARGS,VARS) \
+  void glprof_##NAME ARGS { \
+    if (count (GLPROF_##NAME)) prof.cur[STATE]++; \
+    NAME VARS; \
+  }
+GLPROF_WRAPPERS
+#undef W
+
+
+/* Drawing.
+ */
+void
+glprof_glBegin (GLenum mode)
+{
+  if (count (GLPROF_glBegin)) prof.cur[DRAWS]++;
+  glBegin (mode);
+}
+
+void
+glprof_glEnd (void)
+{
+  count (GLPROF_glEnd);
+  glEnd();
+}
+
+void
+glprof_glNewList (GLuint list, GLenum mode)
+{
+  count (GLPROF_glNewList);
+  prof.compiling = (mode == GL_COMPILE);
+  glNewList (list, mode);
+}
+
+void
+glprof_glEndList (void)
+{
+  prof.compiling = 0;
+  count (GLPROF_glEndList);
+  glEndList();
+}
+
+void
+glprof_glCallList (GLuint list)
+{
+  if (count (GLPROF_glCallList)) prof.cur[DRAWS]++;
+  glCallList (list);
+}
+
+void
+glprof_glCallLists (GLsizei n, GLenum type, const GLvoid *lists)
+{
+  if (count (GLPROF_glCallLists)) prof.cur[DRAWS] += n;
+  glCallLists (n, type, lists);
+}
+
+void
+glprof_glDrawArrays (GLenum mode, GLint first, GLsizei n)
+{
+  if (count (GLPROF_glDrawArrays))
+    {
+      prof.cur[DRAWS]++;
+      prof.cur[VERTEXES] += n;
+    }
+  glDrawArrays (mode, first, n);
+}
+
+void
+glprof_glDrawElements (GLenum mode, GLsizei n, GLenum type,
+                       const GLvoid *indices)
+{
+  if (count (GLPROF_glDrawElements))
+    {
+      prof.cur[DRAWS]++;
+      prof.cur[VERTEXES] += n;
+    }
+  glDrawElements (mode, n, type, indices);
+}
+
+void
+glprof_glDrawRangeElements (GLenum mode, GLuint start, GLuint end,
+                            GLsizei n, GLenum type, const GLvoid *indices)
+{
+  if (count (GLPROF_glDrawRangeElements))
+    {
+      prof.cur[DRAWS]++;
+      prof.cur[VERTEXES] += n;
+    }
+  glDrawRangeElements (mode, start, end, n, type, indices);
+}
+
+void
+glprof_glDrawPixels (GLsizei w, GLsizei h, GLenum format, GLenum type,
+                     const GLvoid *pixels)
+{
+  if (count (GLPROF_glDrawPixels))
+    {
+      prof.cur[DRAWS]++;
+      prof.cur[UPLOAD] += w * h * pixel_size (format, type);
+    }
+  glDrawPixels (w, h, format, type, pixels);
+}
+
+
+/* Uploads.  A null 'pixels' or 'data' just allocates.
+ */
+void
+glprof_glTexImage1D (GLenum target, GLint level, GLint internal,
+                     GLsizei w, GLint border, GLenum format, GLenum type,
+                     const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexImage1D) && pixels)
+    prof.cur[UPLOAD] += w * pixel_size (format, type);
+  glTexImage1D (target, level, internal, w, border, format, type, pixels);
+}
+
+void
+glprof_glTexImage2D (GLenum target, GLint level, GLint internal,
+                     GLsizei w, GLsizei h, GLint border, GLenum format,
+                     GLenum type, const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexImage2D) && pixels)
+    prof.cur[UPLOAD] += w * h * pixel_size (format, type);
+  glTexImage2D (target, level, internal, w, h, border, format, type,
+                pixels);
+}
+
+void
+glprof_glTexImage3D (GLenum target, GLint level, GLint internal,
+                     GLsizei w, GLsizei h, GLsizei d, GLint border,
+                     GLenum format, GLenum type, const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexImage3D) && pixels)
+    prof.cur[UPLOAD] += w * h * d * pixel_size (format, type);
+  glTexImage3D (target, level, internal, w, h, d, border, format, type,
+                pixels);
+}
+
+void
+glprof_glTexSubImage1D (GLenum target, GLint level, GLint x, GLsizei w,
+                        GLenum format, GLenum type, const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexSubImage1D))
+    prof.cur[UPLOAD] += w * pixel_size (format, type);
+  glTexSubImage1D (target, level, x, w, format, type, pixels);
+}
+
+void
+glprof_glTexSubImage2D (GLenum target, GLint level, GLint x, GLint y,
+                        GLsizei w, GLsizei h, GLenum format, GLenum type,
+                        const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexSubImage2D))
+    prof.cur[UPLOAD] += w * h * pixel_size (format, type);
+  glTexSubImage2D (target, level, x, y, w, h, format, type, pixels);
+}
+
+void
+glprof_glTexSubImage3D (GLenum target, GLint level, GLint x, GLint y,
+                        GLint z, GLsizei w, GLsizei h, GLsizei d,
+                        GLenum format, GLenum type, const GLvoid *pixels)
+{
+  if (count (GLPROF_glTexSubImage3D))
+    prof.cur[UPLOAD] += w * h * d * pixel_size (format, type);
+  glTexSubImage3D (target, level, x, y, z, w, h, d, format, type, pixels);
+}
+
+/* It uploads every level, which comes to about 4/3 of the image.
+ */
+GLint
+glprof_gluBuild2DMipmaps (GLenum target, GLint internal, GLsizei w,
+                          GLsizei h, GLenum format, GLenum type,
+                          const void *pixels)
+{
+  if (count (GLPROF_gluBuild2DMipmaps))
+    prof.cur[UPLOAD] += w * h * pixel_size (format, type) * 4 / 3;
+  return gluBuild2DMipmaps (target, internal, w, h, format, type, pixels);
+}
+
+/* Not compiled into display lists, so always counted.
+ */
+void
+glprof_glBufferData (GLenum target, GLsizeiptr size, const void *data,
+                     GLenum usage)
+{
+  count (GLPROF_glBufferData);
+  if (data)
+    prof.cur[UPLOAD] += size;
+  glBufferData (target, size, data, usage);
+}
+
+void
+glprof_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size,
+                        const void *data)
+{
+  count (GLPROF_glBufferSubData);
+  prof.cur[UPLOAD] += size;
+  glBufferSubData (target, offset, size, data);
+}
+
+
+/* Stalls: these wait for everything before them to be drawn.  Also not
+   compiled into display lists.
+ */
+void
+glprof_glFinish (void)
+{
+  count (GLPROF_glFinish);
+  prof.cur[STALLS]++;
+  glFinish();
+}
+
+void
+glprof_glReadPixels (GLint x, GLint y, GLsizei w, GLsizei h,
+                     GLenum format, GLenum type, GLvoid *pixels)
+{
+  count (GLPROF_glReadPixels);
+  prof.cur[STALLS]++;
+  prof.cur[READBACK] += w * h * pixel_size (format, type);
+  glReadPixels (x, y, w, h, format, type, pixels);
+}
+
+void
+glprof_glGetTexImage (GLenum target, GLint level, GLenum format,
+                      GLenum type, GLvoid *pixels)
+{
+  GLint w = 0, h = 1, d = 1;
+  glGetTexLevelParameteriv (target, level, GL_TEXTURE_WIDTH, &w);
+  if (target != GL_TEXTURE_1D)
+    glGetTexLevelParameteriv (target, level, GL_TEXTURE_HEIGHT, &h);
+  if (target == GL_TEXTURE_3D)
+    glGetTexLevelParameteriv (target, level, GL_TEXTURE_DEPTH, &d);
+
+  count (GLPROF_glGetTexImage);
+  prof.cur[STALLS]++;
+  prof.cur[READBACK] += (unsigned long) w * h * d * pixel_size (format, type);
+  glGetTexImage (target, level, format, type, pixels);
+}
+
+#endif /* HAVE_GLPROF */
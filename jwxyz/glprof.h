@@ -0,0 +1,104 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* An opt-in shim that counts the draw calls, vertexes, state changes,
+   uploads and stalls of each frame of a GL hack, for the FPS display and
+   for a JSON log.  See glprof.c for details.
+
+   Unlike glbatch.h, only the functions that are counted go through here,
+   so a hack that calls something else is still fine.  Source files that
+   are compiled without it just don't get counted.
+ */
+
+#ifndef __GLPROF_H__
+#define __GLPROF_H__
+
+#ifndef HAVE_GLPROF
+# error: do not include this without HAVE_GLPROF
+#endif
+
+#ifdef HAVE_JWZGLES
+# error: HAVE_GLPROF and HAVE_JWZGLES are mutually exclusive
+#endif
+
+#include "glprofI.h"
+
+#define glActiveTexture				glprof_glActiveTexture
+#define glAlphaFunc				glprof_glAlphaFunc
+#define glBegin					glprof_glBegin
+#define glBindBuffer				glprof_glBindBuffer
+#define glBindFramebuffer			glprof_glBindFramebuffer
+#define glBindTexture				glprof_glBindTexture
+#define glBlendFunc				glprof_glBlendFunc
+#define glBufferData				glprof_glBufferData
+#define glBufferSubData				glprof_glBufferSubData
+#define glCallList				glprof_glCallList
+#define glCallLists				glprof_glCallLists
+#define glColorMask				glprof_glColorMask
+#define glColorMaterial				glprof_glColorMaterial
+#define glCullFace				glprof_glCullFace
+#define glDepthFunc				glprof_glDepthFunc
+#define glDepthMask				glprof_glDepthMask
+#define glDisable				glprof_glDisable
+#define glDisableClientState			glprof_glDisableClientState
+#define glDrawArrays				glprof_glDrawArrays
+#define glDrawElements				glprof_glDrawElements
+#define glDrawPixels				glprof_glDrawPixels
+#define glDrawRangeElements			glprof_glDrawRangeElements
+#define glEnable				glprof_glEnable
+#define glEnableClientState			glprof_glEnableClientState
+#define glEnd					glprof_glEnd
+#define glEndList				glprof_glEndList
+#define glFinish				glprof_glFinish
+#define glFogf					glprof_glFogf
+#define glFogfv					glprof_glFogfv
+#define glFogi					glprof_glFogi
+#define glFrontFace				glprof_glFrontFace
+#define glGetTexImage				glprof_glGetTexImage
+#define glLightModelfv				glprof_glLightModelfv
+#define glLightModeli				glprof_glLightModeli
+#define glLightf				glprof_glLightf
+#define glLightfv				glprof_glLightfv
+#define glLineWidth				glprof_glLineWidth
+#define glMaterialf				glprof_glMaterialf
+#define glMaterialfv				glprof_glMaterialfv
+#define glNewList				glprof_glNewList
+#define glPointSize				glprof_glPointSize
+#define glPolygonMode				glprof_glPolygonMode
+#define glPopAttrib				glprof_glPopAttrib
+#define glPushAttrib				glprof_glPushAttrib
+#define glReadPixels				glprof_glReadPixels
+#define glShadeModel				glprof_glShadeModel
+#define glTexEnvf				glprof_glTexEnvf
+#define glTexEnvi				glprof_glTexEnvi
+#define glTexImage1D				glprof_glTexImage1D
+#define glTexImage2D				glprof_glTexImage2D
+#define glTexImage3D				glprof_glTexImage3D
+#define glTexParameterf				glprof_glTexParameterf
+#define glTexParameteri				glprof_glTexParameteri
+#define glTexSubImage1D				glprof_glTexSubImage1D
+#define glTexSubImage2D				glprof_glTexSubImage2D
+#define glTexSubImage3D				glprof_glTexSubImage3D
+#define glUseProgram				glprof_glUseProgram
+#define glVertex2d				glprof_glVertex2d
+#define glVertex2f				glprof_glVertex2f
+#define glVertex2fv				glprof_glVertex2fv
+#define glVertex2i				glprof_glVertex2i
+#define glVertex3d				glprof_glVertex3d
+#define glVertex3dv				glprof_glVertex3dv
+#define glVertex3f				glprof_glVertex3f
+#define glVertex3fv				glprof_glVertex3fv
+#define glVertex3i				glprof_glVertex3i
+#define glVertex4f				glprof_glVertex4f
+#define glVertex4fv				glprof_glVertex4fv
+#define gluBuild2DMipmaps			glprof_gluBuild2DMipmaps
+
+#endif /* __GLPROF_H__ */
@@ -0,0 +1,155 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* Counts what a GL hack does per frame.  See glprof.c for details.
+ */
+
+#ifndef __GLPROF_I_H__
+#define __GLPROF_I_H__
+
+/* Called around each call to the hack's draw function. */
+extern void glprof_frame_begin (void);
+extern void glprof_frame_end (void);
+
+/* Appends lines for the FPS display to 'out': the averages per frame
+   since the last call. */
+extern void glprof_fps_string (char *out, size_t size);
+
+
+/* Every function that is counted.  This list is used for the prototypes,
+   for the table of calls, and in glprof.c for the definitions, which are
+   generated for the first two kinds:
+
+     VERTEX:  one vertex, in immediate mode;
+     STATE:   a state change;
+     CUSTOM:  draws, uploads, readbacks and stalls, written out by hand;
+     CUSTOM_INT:  the same, but returning GLint.
+ */
+#define GLPROF_WRAPPERS \
+  W (CUSTOM, glBegin, (GLenum a), (a)) \
+  W (CUSTOM, glEnd, (void), ()) \
+  W (CUSTOM, glNewList, (GLuint a, GLenum b), (a, b)) \
+  W (CUSTOM, glEndList, (void), ()) \
+  W (CUSTOM, glCallList, (GLuint a), (a)) \
+  W (CUSTOM, glCallLists, (GLsizei a, GLenum b, const GLvoid *c), (a, b, c)) \
+  W (CUSTOM, glDrawArrays, (GLenum a, GLint b, GLsizei c), (a, b, c)) \
+  W (CUSTOM, glDrawElements, \
+     (GLenum a, GLsizei b, GLenum c, const GLvoid *d), \
+     (a, b, c, d)) \
+  W (CUSTOM, glDrawRangeElements, \
+     (GLenum a, GLuint b, GLuint c, GLsizei d, GLenum e, const GLvoid *f), \
+     (a, b, c, d, e, f)) \
+  W (CUSTOM, glDrawPixels, \
+     (GLsizei a, GLsizei b, GLenum c, GLenum d, const GLvoid *e), \
+     (a, b, c, d, e)) \
+  W (CUSTOM, glTexImage1D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLint e, GLenum f, GLenum g, \
+      const GLvoid *h), \
+     (a, b, c, d, e, f, g, h)) \
+  W (CUSTOM, glTexImage2D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLsizei e, GLint f, GLenum g, \
+      GLenum h, const GLvoid *i), \
+     (a, b, c, d, e, f, g, h, i)) \
+  W (CUSTOM, glTexImage3D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLsizei e, GLsizei f, \
+      GLint g, GLenum h, GLenum i, const GLvoid *j), \
+     (a, b, c, d, e, f, g, h, i, j)) \
+  W (CUSTOM, glTexSubImage1D, \
+     (GLenum a, GLint b, GLint c, GLsizei d, GLenum e, GLenum f, \
+      const GLvoid *g), \
+     (a, b, c, d, e, f, g)) \
+  W (CUSTOM, glTexSubImage2D, \
+     (GLenum a, GLint b, GLint c, GLint d, GLsizei e, GLsizei f, GLenum g, \
+      GLenum h, const GLvoid *i), \
+     (a, b, c, d, e, f, g, h, i)) \
+  W (CUSTOM, glTexSubImage3D, \
+     (GLenum a, GLint b, GLint c, GLint d, GLint e, GLsizei f, GLsizei g, \
+      GLsizei h, GLenum i, GLenum j, const GLvoid *k), \
+     (a, b, c, d, e, f, g, h, i, j, k)) \
+  W (CUSTOM_INT, gluBuild2DMipmaps, \
+     (GLenum a, GLint b, GLsizei c, GLsizei d, GLenum e, GLenum f, \
+      const void *g), \
+     (a, b, c, d, e, f, g)) \
+  W (CUSTOM, glBufferData, \
+     (GLenum a, GLsizeiptr b, const void *c, GLenum d), \
+     (a, b, c, d)) \
+  W (CUSTOM, glBufferSubData, \
+     (GLenum a, GLintptr b, GLsizeiptr c, const void *d), \
+     (a, b, c, d)) \
+  W (CUSTOM, glFinish, (void), ()) \
+  W (CUSTOM, glReadPixels, \
+     (GLint a, GLint b, GLsizei c, GLsizei d, GLenum e, GLenum f, \
+      GLvoid *g), \
+     (a, b, c, d, e, f, g)) \
+  W (CUSTOM, glGetTexImage, \
+     (GLenum a, GLint b, GLenum c, GLenum d, GLvoid *e), \
+     (a, b, c, d, e)) \
+  W (VERTEX, glVertex2d, (GLdouble a, GLdouble b), (a, b)) \
+  W (VERTEX, glVertex2f, (GLfloat a, GLfloat b), (a, b)) \
+  W (VERTEX, glVertex2fv, (const GLfloat *a), (a)) \
+  W (VERTEX, glVertex2i, (GLint a, GLint b), (a, b)) \
+  W (VERTEX, glVertex3d, (GLdouble a, GLdouble b, GLdouble c), (a, b, c)) \
+  W (VERTEX, glVertex3dv, (const GLdouble *a), (a)) \
+  W (VERTEX, glVertex3f, (GLfloat a, GLfloat b, GLfloat c), (a, b, c)) \
+  W (VERTEX, glVertex3fv, (const GLfloat *a), (a)) \
+  W (VERTEX, glVertex3i, (GLint a, GLint b, GLint c), (a, b, c)) \
+  W (VERTEX, glVertex4f, \
+     (GLfloat a, GLfloat b, GLfloat c, GLfloat d), \
+     (a, b, c, d)) \
+  W (VERTEX, glVertex4fv, (const GLfloat *a), (a)) \
+  W (STATE, glActiveTexture, (GLenum a), (a)) \
+  W (STATE, glAlphaFunc, (GLenum a, GLclampf b), (a, b)) \
+  W (STATE, glBindBuffer, (GLenum a, GLuint b), (a, b)) \
+  W (STATE, glBindFramebuffer, (GLenum a, GLuint b), (a, b)) \
+  W (STATE, glBindTexture, (GLenum a, GLuint b), (a, b)) \
+  W (STATE, glBlendFunc, (GLenum a, GLenum b), (a, b)) \
+  W (STATE, glColorMask, \
+     (GLboolean a, GLboolean b, GLboolean c, GLboolean d), \
+     (a, b, c, d)) \
+  W (STATE, glColorMaterial, (GLenum a, GLenum b), (a, b)) \
+  W (STATE, glCullFace, (GLenum a), (a)) \
+  W (STATE, glDepthFunc, (GLenum a), (a)) \
+  W (STATE, glDepthMask, (GLboolean a), (a)) \
+  W (STATE, glDisable, (GLenum a), (a)) \
+  W (STATE, glDisableClientState, (GLenum a), (a)) \
+  W (STATE, glEnable, (GLenum a), (a)) \
+  W (STATE, glEnableClientState, (GLenum a), (a)) \
+  W (STATE, glFogf, (GLenum a, GLfloat b), (a, b)) \
+  W (STATE, glFogfv, (GLenum a, const GLfloat *b), (a, b)) \
+  W (STATE, glFogi, (GLenum a, GLint b), (a, b)) \
+  W (STATE, glFrontFace, (GLenum a), (a)) \
+  W (STATE, glLightModelfv, (GLenum a, const GLfloat *b), (a, b)) \
+  W (STATE, glLightModeli, (GLenum a, GLint b), (a, b)) \
+  W (STATE, glLightf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  W (STATE, glLightfv, (GLenum a, GLenum b, const GLfloat *c), (a, b, c)) \
+  W (STATE, glLineWidth, (GLfloat a), (a)) \
+  W (STATE, glMaterialf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  W (STATE, glMaterialfv, (GLenum a, GLenum b, const GLfloat *c), (a, b, c)) \
+  W (STATE, glPointSize, (GLfloat a), (a)) \
+  W (STATE, glPolygonMode, (GLenum a, GLenum b), (a, b)) \
+  W (STATE, glPopAttrib, (void), ()) \
+  W (STATE, glPushAttrib, (GLbitfield a), (a)) \
+  W (STATE, glShadeModel, (GLenum a), (a)) \
+  W (STATE, glTexEnvf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  W (STATE, glTexEnvi, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  W (STATE, glTexParameterf, (GLenum a, GLenum b, GLfloat c), (a, b, c)) \
+  W (STATE, glTexParameteri, (GLenum a, GLenum b, GLint c), (a, b, c)) \
+  W (STATE, glUseProgram, (GLuint a), (a))
+
+#define W(KIND,NAME,ARGS,VARS) GLPROF_DECLARE_##KIND (NAME, ARGS)
+#define GLPROF_DECLARE_VERTEX(NAME,ARGS)     extern void glprof_##NAME ARGS;
+#define GLPROF_DECLARE_STATE(NAME,ARGS)      extern void glprof_##NAME ARGS;
+#define GLPROF_DECLARE_CUSTOM(NAME,ARGS)     extern void glprof_##NAME ARGS;
+#define GLPROF_DECLARE_CUSTOM_INT(NAME,ARGS) extern GLint glprof_##NAME ARGS;
+GLPROF_WRAPPERS
+#undef W
+
+#endif /* __GLPROF_I_H__ */
@@ -105,6 +105,10 @@
 # include "jwzglesI.h"
 #endif
 
+#ifdef HAVE_GLBATCH
+# include "glbatch.h"	/* Same as the hack's GL calls, or we draw first. */
+#endif
+
 #include "jwxyzI.h"
 #include "jwxyz-timers.h"
 #include "yarandom.h"
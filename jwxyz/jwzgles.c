@@ -298,7 +298,8 @@ typedef enum {			/* shorthand describing arglist signature */
   PROTO_IIIV,	/* int, int, int[4] */
   PROTO_IIFV,	/* int, int, float[4] */
   PROTO_FV16,	/* float[16] */
-  PROTO_ARRAYS	/* glDrawArrays */
+  PROTO_ARRAYS,	/* glDrawArrays */
+  PROTO_ELEMENTS	/* glDrawElements, from coalesce_arrays() */
 } fn_proto;
 
 typedef struct {		/* A single element of a display list */
@@ -307,6 +308,7 @@ typedef struct {		/* A single element of a display list */
   fn_proto proto;		/* arglist prototype */
   draw_array *arrays;		/* args for glDrawArrays */
   void_int argv[16];		/* args for everything else */
+  GLuint buffers[2];		/* vertex and index VBOs of glDrawElements */
 } list_fn;
 
 
@@ -761,6 +763,7 @@ jwzgles_glNewList (int id, int mode)
 static void save_arrays (list_fn *, int);
 static void restore_arrays (list_fn *, int);
 static void copy_array_data (draw_array *, int, const char *);
+static void coalesce_arrays (void);
 static void optimize_arrays (void);
 static void generate_texture_coords (GLuint, GLuint);
 
@@ -772,6 +775,7 @@ jwzgles_glEndList (void)
   Assert (state->set.count == 0, "missing glEnd");
   Assert (!state->compiling_verts, "glEndList not allowed inside glBegin");
   LOG1("glEndList %d", state->compiling_list);
+  coalesce_arrays();
   optimize_arrays();
   state->compiling_list = 0;
   state->list_enabled = state->enabled;
@@ -990,6 +994,8 @@ jwzgles_glDeleteLists (int id0, int range)
                       free (lf->arrays[j].data);
                   free (lf->arrays);
                 }
+              if (lf->buffers[0])
+                glDeleteBuffers (2, lf->buffers);
             }
           if (L->fns) 
             free (L->fns);
@@ -1894,7 +1900,7 @@ void
 jwzgles_glEnd (void)
 {
   vert_set *s = &state->set;
-  int was_norm, was_tex, was_color, was_mat;
+  int was_norm, was_tex, was_color;
   int  is_norm,  is_tex,  is_color,  is_mat;
 
   Assert (state->compiling_verts == 1, "missing glBegin");
@@ -1944,7 +1950,6 @@ jwzgles_glEnd (void)
   was_norm  = jwzgles_glIsEnabled (GL_NORMAL_ARRAY);
   was_tex   = jwzgles_glIsEnabled (GL_TEXTURE_COORD_ARRAY);
   was_color = jwzgles_glIsEnabled (GL_COLOR_ARRAY);
-  was_mat   = jwzgles_glIsEnabled (GL_COLOR_MATERIAL);
 
   /* If we're executing glEnd in immediate mode, not from inside a display
      list (which is the only way it happens, because glEnd doesn't go into
@@ -2024,9 +2029,14 @@ jwzgles_glEnd (void)
   RESET (norm,  EnableClientState, DisableClientState, GL_NORMAL_ARRAY);
   RESET (tex,   EnableClientState, DisableClientState, GL_TEXTURE_COORD_ARRAY);
   RESET (color, EnableClientState, DisableClientState, GL_COLOR_ARRAY);
-  RESET (mat,   Enable,            Disable,            GL_COLOR_MATERIAL);
 # undef RESET
 
+  /* is_mat only means that we turned it on, so don't re-enable it if it
+     was already on: inside a list that would be a redundant glEnable
+     after every glEnd, and coalesce_arrays() can't merge across those. */
+  if (is_mat)
+    jwzgles_glDisable (GL_COLOR_MATERIAL);
+
   s->count  = 0;
   s->ncount = 0;
   s->tcount = 0;
@@ -2035,6 +2045,521 @@ jwzgles_glEnd (void)
 }
 
 
+/* Most display lists are a long series of glBegin/glEnd blocks, each of
+   which glEnd recorded as a few glEnableClientState / glNormal3f /
+   glColor4f calls followed by a glDrawArrays with its own saved copy of
+   the arrays.  Replaying that means one draw call per block.
+
+   So at glEndList, this looks for runs of those draws that have nothing
+   but client-array enablement and the current normal and color between
+   them, and that draw the same kind of primitive.  Each such run becomes
+   a single interleaved VBO plus an index buffer of GL_TRIANGLES, GL_LINES
+   or GL_POINTS, and one call to glDrawElements.  Strips, fans and loops
+   are unrolled into their independent primitives, keeping the last
+   vertex of each so that flat shading comes out the same.  If one block
+   set the normal or color once but a neighbor used an array (or a
+   different constant), the constant is copied into every vertex.
+
+   Anything else -- matrix or material changes, glEnable, glCallList,
+   texture coordinates outside of glBegin, or a current value that was
+   set before the list began -- ends the run.
+ */
+
+typedef struct {		/* one client array while walking a list */
+  int enabled;			/* 1, 0, or -1 if unknown */
+  int known;			/* whether 'value' holds the current value */
+  GLfloat value[4];		/* from glNormal3f or glColor4f */
+} coalesce_attr;
+
+typedef struct {		/* one glDrawArrays that might be merged */
+  int fn;			/* its index in the list */
+  coalesce_attr attr[4];	/* vertex, normal, texture, color */
+} coalesce_draw;
+
+typedef struct {		/* one client array across a run of draws */
+  int array_p;			/* some draw used an array */
+  int size;			/* of that many components */
+  int const_p;			/* some draw used the current value */
+  coalesce_attr value;		/* which was this */
+  int varies_p;			/* and some other draw used another */
+  int unknown_p;		/* or one that was set outside the list */
+} coalesce_summary;
+
+typedef struct {		/* a run of draws being collected */
+  int start;			/* index in the list where the run begins */
+  int count, size;
+  coalesce_draw *draws;
+  int nverts;
+  coalesce_summary sum[4];
+} coalesce_run;
+
+
+/* Which independent primitive a glDrawArrays mode unrolls into.
+ */
+static int
+coalesce_class (int mode)
+{
+  switch (mode) {
+  case GL_TRIANGLES:
+  case GL_TRIANGLE_STRIP:
+  case GL_TRIANGLE_FAN:	return GL_TRIANGLES;
+  case GL_LINES:
+  case GL_LINE_STRIP:
+  case GL_LINE_LOOP:	return GL_LINES;
+  case GL_POINTS:	return GL_POINTS;
+  default:		return 0;
+  }
+}
+
+
+/* Writes the indexes of the unrolled primitives of one glDrawArrays,
+   offset by 'base'.  Returns how many there are; 'out' may be null.
+ */
+static int
+coalesce_indexes (int mode, int count, int base, GLushort *out)
+{
+  int i, n = 0;
+# define PUSH(I) do { if (out) out[n] = base + (I); n++; } while(0)
+  switch (mode) {
+  case GL_TRIANGLE_STRIP:
+    for (i = 0; i < count - 2; i++)
+      {
+        /* Every other triangle is wound backwards; keep the last vertex
+           of each in place since that one is the provoking vertex. */
+        if (i & 1) { PUSH (i+1); PUSH (i);   }
+        else       { PUSH (i);   PUSH (i+1); }
+        PUSH (i+2);
+      }
+    break;
+  case GL_TRIANGLE_FAN:
+    for (i = 0; i < count - 2; i++)
+      { PUSH (0); PUSH (i+1); PUSH (i+2); }
+    break;
+  case GL_LINE_STRIP:
+  case GL_LINE_LOOP:
+    for (i = 0; i < count - 1; i++)
+      { PUSH (i); PUSH (i+1); }
+    if (mode == GL_LINE_LOOP && count > 1)
+      { PUSH (count-1); PUSH (0); }
+    break;
+  case GL_TRIANGLES:
+    count -= count % 3;
+    for (i = 0; i < count; i++) PUSH (i);
+    break;
+  case GL_LINES:
+    count -= count % 2;
+    for (i = 0; i < count; i++) PUSH (i);
+    break;
+  default:
+    for (i = 0; i < count; i++) PUSH (i);
+    break;
+  }
+# undef PUSH
+  return n;
+}
+
+
+/* Whether this glDrawArrays could be merged with anything at all.
+ */
+static int
+coalesce_usable_p (const list_fn *F, const coalesce_attr *attr)
+{
+  const draw_array *A = F->arrays;
+  int k;
+
+  if (!coalesce_class (F->argv[0].i))
+    return 0;
+  if (attr[0].enabled != 1)
+    return 0;
+  for (k = 0; k < 4; k++)
+    {
+      if (attr[k].enabled < 0)
+        return 0;
+      if (attr[k].enabled &&
+          (!A[k].size || A[k].type != GL_FLOAT ||
+           A[k].binding || !A[k].data))
+        return 0;
+    }
+  return 1;
+}
+
+
+/* Adds a draw to the run, if it is compatible with those already there.
+ */
+static int
+coalesce_add (list *L, coalesce_run *R, const coalesce_draw *D)
+{
+  const list_fn *F = &L->fns[D->fn];
+  coalesce_summary sum[4];
+  int k;
+
+  if (R->count > 0 &&
+      coalesce_class (F->argv[0].i) !=
+      coalesce_class (L->fns[R->draws[0].fn].argv[0].i))
+    return 0;
+  if (R->nverts + F->argv[2].i > 0xFFFF)	/* GLushort indexes */
+    return 0;
+
+  memcpy (sum, R->sum, sizeof(sum));
+  for (k = 0; k < 4; k++)
+    {
+      const coalesce_attr *a = &D->attr[k];
+      coalesce_summary *s = &sum[k];
+
+      if (a->enabled)
+        {
+          if (s->array_p && s->size != F->arrays[k].size)
+            return 0;
+          s->array_p = 1;
+          s->size = F->arrays[k].size;
+        }
+      else if (!s->const_p)
+        {
+          s->const_p = 1;
+          s->value = *a;
+        }
+      else if (a->known != s->value.known ||
+               (a->known && memcmp (a->value, s->value.value,
+                                    sizeof(a->value))))
+        s->varies_p = 1;
+
+      if (!a->enabled && !a->known)
+        s->unknown_p = 1;
+
+      if (s->array_p && s->const_p && (k == 0 || k == 2))
+        return 0;	/* Only normals and colors can be filled in. */
+      if ((s->array_p || s->varies_p) && s->unknown_p)
+        return 0;
+    }
+
+  make_room ("coalesce_arrays",
+             (void **) &R->draws, sizeof(*R->draws),
+             &R->count, &R->size);
+  R->draws[R->count++] = *D;
+  R->nverts += F->argv[2].i;
+  memcpy (R->sum, sum, sizeof(sum));
+  return 1;
+}
+
+
+static list_fn *
+coalesce_push (list_fn **fns, int *count, int *size,
+               const char *name, list_fn_cb fn, fn_proto proto)
+{
+  list_fn *F;
+  make_room ("coalesce_arrays", (void **) fns, sizeof(**fns), count, size);
+  F = *fns + (*count)++;
+  memset (F, 0, sizeof(*F));
+  F->name  = name;
+  F->fn    = fn;
+  F->proto = proto;
+  return F;
+}
+
+
+static void
+coalesce_push_enable (list_fn **fns, int *count, int *size,
+                      GLuint cap, int on)
+{
+  list_fn *F = (on
+                ? coalesce_push (fns, count, size, "glEnableClientState",
+                                 (list_fn_cb) &jwzgles_glEnableClientState,
+                                 PROTO_I)
+                : coalesce_push (fns, count, size, "glDisableClientState",
+                                 (list_fn_cb) &jwzgles_glDisableClientState,
+                                 PROTO_I));
+  F->argv[0].i = cap;
+}
+
+
+static void
+coalesce_push_value (list_fn **fns, int *count, int *size,
+                     int k, const GLfloat *v)
+{
+  list_fn *F = (k == 1
+                ? coalesce_push (fns, count, size, "glNormal3f",
+                                 (list_fn_cb) &jwzgles_glNormal3f, PROTO_FFF)
+                : coalesce_push (fns, count, size, "glColor4f",
+                                 (list_fn_cb) &jwzgles_glColor4f, PROTO_FFFF));
+  int i;
+  for (i = 0; i < 4; i++)
+    F->argv[i].f = v[i];
+}
+
+
+/* Replaces the run with one glDrawElements, appending it to 'out'.
+   Returns false if that couldn't be done, leaving the list alone.
+ */
+static int
+coalesce_flush (list *L, coalesce_run *R,
+                list_fn **out, int *out_count, int *out_size)
+{
+  static const GLuint caps[4] = { GL_VERTEX_ARRAY, GL_NORMAL_ARRAY,
+                                  GL_TEXTURE_COORD_ARRAY, GL_COLOR_ARRAY };
+  const coalesce_draw *last = &R->draws[R->count-1];
+  int mode = coalesce_class (L->fns[R->draws[0].fn].argv[0].i);
+  int has[4], size[4], offset[4];
+  int stride = 0, nindexes = 0, nverts = 0;
+  GLfloat *verts, *v;
+  GLushort *indexes;
+  GLuint buffers[2] = { 0, 0 };
+  draw_array *A;
+  list_fn *F;
+  int i, j, k;
+
+  for (k = 0; k < 4; k++)
+    {
+      const coalesce_summary *s = &R->sum[k];
+      has[k] = s->array_p || s->varies_p;
+      size[k] = (s->array_p ? s->size : k == 1 ? 3 : 4);
+      offset[k] = stride;
+      if (has[k]) stride += size[k];
+    }
+
+  for (i = 0; i < R->count; i++)
+    {
+      const void_int *av = L->fns[R->draws[i].fn].argv;
+      nindexes += coalesce_indexes (av[0].i, av[2].i, 0, 0);
+    }
+
+  glGenBuffers (2, buffers);
+  CHECK("glGenBuffers");
+  if (!buffers[0] || !buffers[1])
+    {
+      if (buffers[0] || buffers[1])
+        glDeleteBuffers (2, buffers);
+      return 0;
+    }
+
+  verts = (GLfloat *) malloc (R->nverts * stride * sizeof(*verts));
+  indexes = (GLushort *) malloc ((nindexes + 1) * sizeof(*indexes));
+  Assert (verts && indexes, "out of memory");
+
+  v = verts;
+  nindexes = 0;
+  for (i = 0; i < R->count; i++)
+    {
+      const coalesce_draw *D = &R->draws[i];
+      list_fn *G = &L->fns[D->fn];
+      int first = G->argv[1].i;
+      int count = G->argv[2].i;
+
+      nindexes += coalesce_indexes (G->argv[0].i, count, nverts,
+                                    indexes + nindexes);
+      for (j = first; j < first + count; j++)
+        for (k = 0; k < 4; k++)
+          if (has[k])
+            {
+              const GLfloat *in = (D->attr[k].enabled
+                                   ? ((const GLfloat *) G->arrays[k].data +
+                                      j * size[k])
+                                   : D->attr[k].value);
+              memcpy (v, in, size[k] * sizeof(*v));
+              v += size[k];
+            }
+      nverts += count;
+
+      for (k = 0; k < 4; k++)	/* The saved arrays are ours now. */
+        if (G->arrays[k].data)
+          free (G->arrays[k].data);
+      free (G->arrays);
+      G->arrays = 0;
+    }
+  Assert (nverts == R->nverts, "coalesce_arrays corrupted");
+
+  glBindBuffer (GL_ARRAY_BUFFER, buffers[0]);
+  glBufferData (GL_ARRAY_BUFFER, nverts * stride * sizeof(*verts), verts,
+                GL_STATIC_DRAW);
+  glBindBuffer (GL_ARRAY_BUFFER, 0);    /* Keep out of others' hands */
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+  glBufferData (GL_ELEMENT_ARRAY_BUFFER, nindexes * sizeof(*indexes),
+                indexes, GL_STATIC_DRAW);
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+  CHECK("glBufferData");
+  free (verts);
+  free (indexes);
+
+  LOG4 ("  coalesced %d draws of list %d into %d verts, %d indexes",
+        R->count, state->compiling_list, nverts, nindexes);
+
+  /* Set up the arrays and the current values that the merged draw needs.
+     Those that weren't merged were set the same way by every draw. */
+  for (k = 0; k < 4; k++)
+    coalesce_push_enable (out, out_count, out_size, caps[k], has[k]);
+  for (k = 1; k < 4; k += 2)
+    if (!has[k] && R->sum[k].const_p && R->sum[k].value.known)
+      coalesce_push_value (out, out_count, out_size, k,
+                           R->sum[k].value.value);
+
+  F = coalesce_push (out, out_count, out_size, "glDrawElements",
+                     (list_fn_cb) &jwzgles_glDrawElements, PROTO_ELEMENTS);
+  F->argv[0].i = mode;
+  F->argv[1].i = nindexes;
+  F->argv[2].i = nverts;
+  F->buffers[0] = buffers[0];
+  F->buffers[1] = buffers[1];
+  A = (draw_array *) calloc (4, sizeof (*A));
+  Assert (A, "out of memory");
+  for (k = 0; k < 4; k++)
+    if (has[k])
+      {
+        /* 'data' is the byte offset into the VBO, as in optimize_arrays. */
+        A[k].binding = buffers[0];
+        A[k].size    = size[k];
+        A[k].type    = GL_FLOAT;
+        A[k].stride  = stride * sizeof(GLfloat);
+        A[k].data    = (void *) (offset[k] * sizeof(GLfloat));
+      }
+  F->arrays = A;
+
+  /* Leave things as the last of the original draws did. */
+  for (k = 1; k < 4; k++)
+    if (last->attr[k].enabled != has[k])
+      coalesce_push_enable (out, out_count, out_size, caps[k],
+                            last->attr[k].enabled);
+  for (k = 1; k < 4; k += 2)
+    if (has[k] && last->attr[k].known)
+      coalesce_push_value (out, out_count, out_size, k,
+                           last->attr[k].value);
+
+  return 1;
+}
+
+
+/* Moves the list's calls before 'upto' into 'out'.
+ */
+static void
+coalesce_copy (list *L, int upto, int *copied,
+               list_fn **out, int *out_count, int *out_size)
+{
+  for (; *copied < upto; (*copied)++)
+    {
+      make_room ("coalesce_arrays", (void **) out, sizeof(**out),
+                 out_count, out_size);
+      (*out)[(*out_count)++] = L->fns[*copied];
+    }
+}
+
+
+/* Merges the run if there is anything to merge, and empties it.
+ */
+static void
+coalesce_end_run (list *L, coalesce_run *R, int *copied, int *merged,
+                  list_fn **out, int *out_count, int *out_size)
+{
+  if (R->count > 1)
+    {
+      coalesce_copy (L, R->start, copied, out, out_count, out_size);
+      if (coalesce_flush (L, R, out, out_count, out_size))
+        {
+          /* The calls in the run were replaced, not copied. */
+          *copied = R->draws[R->count-1].fn + 1;
+          (*merged)++;
+        }
+    }
+  R->count = 0;
+  R->nverts = 0;
+  memset (R->sum, 0, sizeof(R->sum));
+}
+
+
+static void
+coalesce_arrays (void)
+{
+  list *L = &state->lists.lists[state->compiling_list-1];
+  coalesce_attr attr[4];
+  coalesce_run R;
+  list_fn *out = 0;
+  int out_count = 0, out_size = 0;
+  int copied = 0;	/* how much of L->fns has been moved to 'out' */
+  int merged = 0;
+  int i, k;
+
+  Assert (state->compiling_list, "not compiling a list");
+
+  memset (&R, 0, sizeof(R));
+  memset (attr, 0, sizeof(attr));
+  for (k = 0; k < 4; k++)
+    attr[k].enabled = -1;
+
+  /* i == L->count flushes the last run. */
+  for (i = 0; i <= L->count; i++)
+    {
+      list_fn *F = (i < L->count ? &L->fns[i] : 0);
+
+      if (F &&
+          (F->fn == (list_fn_cb) &jwzgles_glEnableClientState ||
+           F->fn == (list_fn_cb) &jwzgles_glDisableClientState) &&
+          (F->argv[0].i == GL_VERTEX_ARRAY ||
+           F->argv[0].i == GL_NORMAL_ARRAY ||
+           F->argv[0].i == GL_TEXTURE_COORD_ARRAY ||
+           F->argv[0].i == GL_COLOR_ARRAY))
+        {
+          k = (F->argv[0].i == GL_VERTEX_ARRAY ? 0 :
+               F->argv[0].i == GL_NORMAL_ARRAY ? 1 :
+               F->argv[0].i == GL_TEXTURE_COORD_ARRAY ? 2 : 3);
+          attr[k].enabled =
+            (F->fn == (list_fn_cb) &jwzgles_glEnableClientState);
+          continue;
+        }
+
+      if (F &&
+          (F->fn == (list_fn_cb) &jwzgles_glNormal3f ||
+           F->fn == (list_fn_cb) &jwzgles_glColor4f))
+        {
+          k = (F->fn == (list_fn_cb) &jwzgles_glNormal3f ? 1 : 3);
+          attr[k].known = 1;
+          attr[k].value[0] = F->argv[0].f;
+          attr[k].value[1] = F->argv[1].f;
+          attr[k].value[2] = F->argv[2].f;
+          attr[k].value[3] = (k == 3 ? F->argv[3].f : 0);
+          continue;
+        }
+
+      if (F && F->proto == PROTO_ARRAYS && coalesce_usable_p (F, attr))
+        {
+          coalesce_draw D;
+          D.fn = i;
+          memcpy (D.attr, attr, sizeof(attr));
+          if (coalesce_add (L, &R, &D))
+            continue;
+
+          /* Doesn't fit: finish the previous run, and start a new one
+             from just after its last draw. */
+          if (R.count > 0)
+            {
+              k = R.draws[R.count-1].fn + 1;
+              coalesce_end_run (L, &R, &copied, &merged,
+                                &out, &out_count, &out_size);
+              R.start = k;
+              if (coalesce_add (L, &R, &D))
+                continue;
+            }
+        }
+
+      /* Anything else ends the run, and might have changed anything. */
+      coalesce_end_run (L, &R, &copied, &merged, &out, &out_count, &out_size);
+      R.start = i + 1;
+      memset (attr, 0, sizeof(attr));
+      for (k = 0; k < 4; k++)
+        attr[k].enabled = -1;
+    }
+
+  if (merged)
+    {
+      coalesce_copy (L, L->count, &copied, &out, &out_count, &out_size);
+      free (L->fns);
+      L->fns   = out;
+      L->count = out_count;
+      L->size  = out_size;
+    }
+  else if (out)
+    free (out);
+
+  if (R.draws) free (R.draws);
+}
+
+
 /* The display list is full of calls to glDrawArrays(), plus saved arrays
    of the values we need to restore before calling it.  "Restore" means
    "ship them off to the GPU before each call".
@@ -2093,6 +2618,9 @@ optimize_arrays (void)
           if (! A->data)	/* No array. */
             continue;
 
+          if (A->binding)	/* Already in a VBO, from coalesce_arrays. */
+            continue;
+
           Assert (A->bytes > 0, "no bytes in draw_array");
           Assert (((unsigned long) A->data > 0xFFFF),
                   "buffer data not a pointer");
@@ -2326,6 +2854,16 @@ jwzgles_glCallList (int id)
             goto III;
             break;
 
+          case PROTO_ELEMENTS:
+            LOG4 ("  call %-12s %s %d %d", F->name,
+                  mode_desc (av[0].i), av[1].i, av[2].i);
+            restore_arrays (F, av[2].i);
+            glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, F->buffers[1]);
+            glDrawElements (av[0].i, av[1].i, GL_UNSIGNED_SHORT, 0);
+            CHECK("glDrawElements");
+            glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);
+            break;
+
           case PROTO_FV16:
             {
               GLfloat m[16];
@@ -829,11 +829,7 @@ load_random_image_cocoa (Screen *screen, Window window, Drawable drawable,
 }
 #elif defined(HAVE_WAYLAND)
 
-void load_random_image_wayland (Screen *screen, Window window, Drawable drawable,
-                           void (*callback) (Screen *, Window, Drawable,
-                                             const char *name,
-                                             XRectangle *geom, void *closure),
-                           void *closure);
+/* load_random_image_wayland() is in wayland/grabimage.c. */
 
 #elif defined(HAVE_ANDROID)
 
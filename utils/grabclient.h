@@ -84,6 +84,17 @@ extern void ios_load_random_image (void (*callback) (void *uiimage,
                                    int width, int height);
 #endif /* HAVE_IPHONE */
 
+#ifdef HAVE_WAYLAND
+/* In wayland/grabimage.c */
+extern void load_random_image_wayland (Screen *, Window, Drawable,
+                                       void (*callback) (Screen *, Window,
+                                                         Drawable,
+                                                         const char *name,
+                                                         XRectangle *geom,
+                                                         void *closure),
+                                       void *closure);
+#endif /* HAVE_WAYLAND */
+
 #ifdef HAVE_ANDROID
 char *jwxyz_draw_random_image (Display *dpy, Drawable drawable, GC gc);
 #endif
@@ -0,0 +1,1208 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * A persistent index of the images under a directory: see imageindex.h.
+ *
+ * The saved index is a header, an array of file records, an array of
+ * directory records, and the strings they point into, in native byte order.
+ * It is only a cache: if it doesn't look right, it is rebuilt.  Until
+ * something needs to change it, it is used where it is mapped, so opening
+ * it and picking a file from it touches two or three pages.
+ *
+ * To change it, it is first copied into "live" arrays with hash tables of
+ * the path names.  Strings stay in the mapping until they are replaced.
+ * A re-scan builds a new set of arrays, and for each directory whose
+ * modification time is what it was last time, carries the old entries over
+ * without reading it.  The result is written to a temporary file and
+ * renamed over the old one, so readers in other processes never see a
+ * half-written index.
+ */
+
+#include "utils.h"
+
+#ifdef HAVE_INTTYPES_H
+# include <inttypes.h>
+#endif
+
+#include <strings.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/file.h>
+
+#ifdef HAVE_UNISTD_H
+# include <unistd.h>
+#endif
+
+#ifdef HAVE_SYS_INOTIFY_H
+# include <sys/inotify.h>
+#endif
+
+#include "imageindex.h"
+
+#undef countof
+#define countof(x) (sizeof((x))/sizeof((*x)))
+
+/* Don't descend forever into symlink loops. */
+#define MAX_DEPTH 32
+
+/* Changes that came from inotify are written out at most this often, in
+   seconds.  The results of a re-scan are written right away. */
+#define SAVE_INTERVAL 60
+
+#define INDEX_MAGIC "XSIMGIX1"
+
+extern const char *progname;
+
+
+struct saved_header {
+  char magic[8];
+  uint32_t nfiles, ndirs;
+  uint32_t strings_size;
+  uint32_t root;		/* Offset of the directory name */
+  int64_t saved;		/* When the directories were last checked */
+};
+
+struct saved_file {
+  int64_t mtime;
+  uint32_t path;		/* Offset into the strings */
+  uint32_t dir;			/* Index into the directories */
+  uint16_t width, height;	/* 0 if not known */
+  uint32_t pad;
+};
+
+struct saved_dir {
+  int64_t mtime;
+  uint32_t path;
+  int32_t parent;		/* -1 for the top */
+};
+
+
+typedef struct {
+  const char *path;		/* In the mapping, or malloced */
+  time_t mtime;
+  int dir;
+  unsigned short width, height;
+} index_file;
+
+typedef struct {
+  const char *path;
+  time_t mtime;
+  int parent;
+  int depth;
+  int wd;			/* inotify watch, or -1 */
+  Bool dead_p;			/* Deleted or moved away */
+} index_dir;
+
+/* Path name to array index, chained through 'next'. */
+typedef struct {
+  int mask;
+  int *heads;
+  int *next;
+  int count, next_size;
+} path_table;
+
+typedef struct {
+  index_file *files;
+  int nfiles, files_size;
+  index_dir *dirs;
+  int ndirs, dirs_size;
+  path_table ftab, dtab;
+} index_data;
+
+struct image_index {
+  char *dir;
+  char *file;			/* Where it is saved */
+  Bool verbose_p;
+
+  char *map;			/* The saved index, read-only */
+  size_t map_size;
+  const struct saved_header *hdr;
+
+  Bool live_p;			/* 'data' is current, not 'hdr' */
+  index_data data;
+
+  time_t saved;			/* When the index file was last written */
+  time_t scanned;		/* When the directories were last checked */
+  Bool dirty_p;
+
+  Bool watch_p;
+  int inotify_fd;
+};
+
+
+static Bool
+image_file_p (const char *name)
+{
+  static const char * const exts[] = {
+    "jpg", "jpeg", "jpe", "png", "gif", "bmp", "tif", "tiff", "webp",
+    "xpm", "xbm", "pbm", "pgm", "ppm", "tga", "heic", "avif",
+  };
+  const char *dot = strrchr (name, '.');
+  int i;
+  if (!dot) return False;
+  for (i = 0; i < countof(exts); i++)
+    if (!strcasecmp (dot + 1, exts[i]))
+      return True;
+  return False;
+}
+
+
+static unsigned long
+hash_path (const char *s)
+{
+  unsigned long h = 2166136261UL;	/* FNV-1a */
+  while (*s) {
+    h ^= (unsigned char) *s++;
+    h *= 16777619UL;
+  }
+  return h & 0xFFFFFFFFUL;
+}
+
+
+static void *
+grow (void *array, int *size, int want, size_t elt)
+{
+  if (want <= *size) return array;
+  *size = (*size ? *size * 2 : 1024);
+  if (*size < want) *size = want;
+  array = realloc (array, *size * elt);
+  if (!array) abort();
+  return array;
+}
+
+
+/* Hash tables.
+ */
+
+typedef const char *(*path_fn) (const index_data *, int);
+
+static const char *
+file_path (const index_data *d, int i)
+{
+  return d->files[i].path;
+}
+
+static const char *
+dir_path (const index_data *d, int i)
+{
+  return d->dirs[i].path;
+}
+
+
+static void
+table_link (path_table *t, int i, unsigned long h)
+{
+  int b = (int) (h & t->mask);
+  t->next[i] = t->heads[b];
+  t->heads[b] = i;
+  t->count++;
+}
+
+
+static void
+table_rehash (path_table *t, const index_data *d, path_fn get, int size)
+{
+  int *oheads = t->heads;
+  int omask = t->mask;
+  int b;
+
+  t->heads = (int *) malloc (size * sizeof(*t->heads));
+  if (!t->heads) abort();
+  memset (t->heads, -1, size * sizeof(*t->heads));
+  t->mask = size - 1;
+  t->count = 0;
+
+  if (oheads) {
+    for (b = 0; b <= omask; b++) {
+      int e = oheads[b];
+      while (e >= 0) {
+        int n = t->next[e];
+        table_link (t, e, hash_path (get (d, e)));
+        e = n;
+      }
+    }
+    free (oheads);
+  }
+}
+
+
+static void
+table_insert (path_table *t, const index_data *d, path_fn get, int i)
+{
+  t->next = (int *) grow (t->next, &t->next_size, i + 1, sizeof(*t->next));
+  if (!t->heads)
+    table_rehash (t, d, get, 1024);
+  else if (t->count * 2 >= t->mask + 1)
+    table_rehash (t, d, get, (t->mask + 1) * 2);
+  table_link (t, i, hash_path (get (d, i)));
+}
+
+
+static void
+table_remove (path_table *t, int i, const char *path)
+{
+  int *e;
+  if (!t->heads) return;
+  for (e = &t->heads[hash_path (path) & t->mask]; *e >= 0; e = &t->next[*e])
+    if (*e == i) {
+      *e = t->next[i];
+      t->count--;
+      return;
+    }
+}
+
+
+static int
+table_find (const path_table *t, const index_data *d, path_fn get,
+            const char *path)
+{
+  int e;
+  if (!t->heads) return -1;
+  for (e = t->heads[hash_path (path) & t->mask]; e >= 0; e = t->next[e])
+    if (!strcmp (get (d, e), path))
+      return e;
+  return -1;
+}
+
+
+static void
+table_free (path_table *t)
+{
+  if (t->heads) free (t->heads);
+  if (t->next) free (t->next);
+  memset (t, 0, sizeof(*t));
+}
+
+
+/* The live arrays.
+ */
+
+/* Does not copy 'path'. */
+static int
+add_file (index_data *d, const char *path, time_t mtime, int dir)
+{
+  index_file *f;
+  d->files = (index_file *)
+    grow (d->files, &d->files_size, d->nfiles + 1, sizeof(*d->files));
+  f = &d->files[d->nfiles];
+  f->path   = path;
+  f->mtime  = mtime;
+  f->dir    = dir;
+  f->width  = 0;
+  f->height = 0;
+  table_insert (&d->ftab, d, file_path, d->nfiles);
+  return d->nfiles++;
+}
+
+
+/* Does not copy 'path'. */
+static int
+add_dir (index_data *d, const char *path, time_t mtime, int parent, int depth)
+{
+  index_dir *dd;
+  d->dirs = (index_dir *)
+    grow (d->dirs, &d->dirs_size, d->ndirs + 1, sizeof(*d->dirs));
+  dd = &d->dirs[d->ndirs];
+  dd->path   = path;
+  dd->mtime  = mtime;
+  dd->parent = parent;
+  dd->depth  = depth;
+  dd->wd     = -1;
+  dd->dead_p = False;
+  table_insert (&d->dtab, d, dir_path, d->ndirs);
+  return d->ndirs++;
+}
+
+
+static Bool
+owned_p (const image_index *idx, const char *s)
+{
+  return !(idx->map && s >= idx->map && s < idx->map + idx->map_size);
+}
+
+
+static void
+free_string (const image_index *idx, const char *s)
+{
+  if (s && owned_p (idx, s))
+    free ((char *) s);
+}
+
+
+static void
+remove_file (image_index *idx, int i)
+{
+  index_data *d = &idx->data;
+  int last = d->nfiles - 1;
+
+  table_remove (&d->ftab, i, d->files[i].path);
+  free_string (idx, d->files[i].path);
+  if (i != last) {
+    table_remove (&d->ftab, last, d->files[last].path);
+    d->files[i] = d->files[last];
+    table_insert (&d->ftab, d, file_path, i);
+  }
+  d->nfiles--;
+}
+
+
+static void
+free_data (image_index *idx, index_data *d, const char *file_moved,
+           const char *dir_moved)
+{
+  int i;
+  for (i = 0; i < d->nfiles; i++)
+    if (!file_moved || !file_moved[i])
+      free_string (idx, d->files[i].path);
+  for (i = 0; i < d->ndirs; i++)
+    if (!dir_moved || !dir_moved[i])
+      free_string (idx, d->dirs[i].path);
+  if (d->files) free (d->files);
+  if (d->dirs)  free (d->dirs);
+  table_free (&d->ftab);
+  table_free (&d->dtab);
+  memset (d, 0, sizeof(*d));
+}
+
+
+/* The saved file.
+ */
+
+static char *
+index_file_name (const char *dir)
+{
+  const char *xdg  = getenv ("XDG_CACHE_HOME");
+  const char *home = getenv ("HOME");
+  char *base, *file;
+
+  if (xdg && *xdg == '/') {
+    base = strdup (xdg);
+  } else {
+    if (!home || !*home) home = "/tmp";
+    base = (char *) malloc (strlen (home) + 20);
+    if (!base) abort();
+    sprintf (base, "%s/.cache", home);
+  }
+
+  file = (char *) malloc (strlen (base) + 40);
+  if (!file) abort();
+  mkdir (base, 0700);
+  sprintf (file, "%s/xscreensaver", base);
+  mkdir (file, 0700);
+  sprintf (file, "%s/xscreensaver/imageindex-%08lx", base, hash_path (dir));
+  free (base);
+  return file;
+}
+
+
+static const struct saved_file *
+saved_files (const image_index *idx)
+{
+  return (const struct saved_file *) (idx->hdr + 1);
+}
+
+static const struct saved_dir *
+saved_dirs (const image_index *idx)
+{
+  return (const struct saved_dir *) (saved_files (idx) + idx->hdr->nfiles);
+}
+
+static const char *
+saved_strings (const image_index *idx)
+{
+  return (const char *) (saved_dirs (idx) + idx->hdr->ndirs);
+}
+
+
+/* Maps the saved index, if it is there and is for this directory.
+   Only the header is checked here: records are checked as they are used,
+   so that opening it doesn't read the whole thing. */
+static void
+map_index (image_index *idx)
+{
+  const struct saved_header *h;
+  struct stat st;
+  size_t want;
+  int fd = open (idx->file, O_RDONLY);
+
+  if (fd < 0) return;
+  if (fstat (fd, &st) || st.st_size < (off_t) sizeof(*h)) {
+    close (fd);
+    return;
+  }
+
+  idx->map_size = st.st_size;
+  idx->map = (char *) mmap (0, idx->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (idx->map == (char *) MAP_FAILED) {
+    idx->map = 0;
+    return;
+  }
+
+  h = (const struct saved_header *) idx->map;
+  want = (sizeof(*h) +
+          (size_t) h->nfiles * sizeof(struct saved_file) +
+          (size_t) h->ndirs  * sizeof(struct saved_dir) +
+          h->strings_size);
+  idx->hdr = h;
+
+  if (memcmp (h->magic, INDEX_MAGIC, sizeof(h->magic)) ||
+      h->nfiles > idx->map_size ||
+      h->ndirs  > idx->map_size ||
+      want != idx->map_size ||
+      h->strings_size == 0 ||
+      saved_strings (idx)[h->strings_size - 1] != 0 ||
+      h->root >= h->strings_size ||
+      strcmp (saved_strings (idx) + h->root, idx->dir)) {
+    if (idx->verbose_p)
+      fprintf (stderr, "%s: %s: ignoring bad image index\n",
+               progname, idx->file);
+    munmap (idx->map, idx->map_size);
+    idx->map = 0;
+    idx->map_size = 0;
+    idx->hdr = 0;
+    return;
+  }
+
+  idx->saved   = st.st_mtime;
+  idx->scanned = (time_t) h->saved;
+}
+
+
+static void
+unmap_index (image_index *idx)
+{
+  if (idx->map)
+    munmap (idx->map, idx->map_size);
+  idx->map = 0;
+  idx->map_size = 0;
+  idx->hdr = 0;
+}
+
+
+/* Copies the mapped index into the live arrays.  The strings stay where
+   they are. */
+static void
+load_live (image_index *idx)
+{
+  index_data *d = &idx->data;
+  const struct saved_file *sf;
+  const struct saved_dir *sd;
+  const char *strings;
+  uint32_t i, nfiles, ndirs, ssize;
+
+  if (idx->live_p) return;
+  idx->live_p = True;
+  if (!idx->hdr) return;
+
+  sf = saved_files (idx);
+  sd = saved_dirs (idx);
+  strings = saved_strings (idx);
+  nfiles = idx->hdr->nfiles;
+  ndirs  = idx->hdr->ndirs;
+  ssize  = idx->hdr->strings_size;
+
+  for (i = 0; i < ndirs; i++) {
+    int parent = sd[i].parent;
+    if (sd[i].path >= ssize || parent >= (int) i)
+      break;	/* Parents are always written before their children. */
+    add_dir (d, strings + sd[i].path, (time_t) sd[i].mtime, parent,
+             parent < 0 ? 0 : d->dirs[parent].depth + 1);
+  }
+
+  for (i = 0; i < nfiles; i++) {
+    int f;
+    if (sf[i].path >= ssize || sf[i].dir >= (uint32_t) d->ndirs)
+      continue;
+    f = add_file (d, strings + sf[i].path, (time_t) sf[i].mtime, sf[i].dir);
+    d->files[f].width  = sf[i].width;
+    d->files[f].height = sf[i].height;
+  }
+}
+
+
+static void
+save_index (image_index *idx)
+{
+  index_data *d = &idx->data;
+  struct saved_header h;
+  FILE *out;
+  char *tmp;
+  int *remap;
+  uint32_t off;
+  int i, n;
+  Bool ok;
+
+  remap = (int *) malloc ((d->ndirs + 1) * sizeof(*remap));
+  if (!remap) abort();
+
+  memset (&h, 0, sizeof(h));
+  memcpy (h.magic, INDEX_MAGIC, sizeof(h.magic));
+  h.root  = 0;
+  h.saved = idx->scanned;
+  off = strlen (idx->dir) + 1;
+
+  for (i = 0, n = 0; i < d->ndirs; i++) {
+    int p = d->dirs[i].parent;
+    remap[i] = (d->dirs[i].dead_p || (p >= 0 && remap[p] < 0)) ? -1 : n++;
+    if (remap[i] >= 0)
+      off += strlen (d->dirs[i].path) + 1;
+  }
+  h.ndirs = n;
+  for (i = 0, n = 0; i < d->nfiles; i++)
+    if (remap[d->files[i].dir] >= 0) {
+      off += strlen (d->files[i].path) + 1;
+      n++;
+    }
+  h.nfiles = n;
+  h.strings_size = off;
+
+  tmp = (char *) malloc (strlen (idx->file) + 20);
+  if (!tmp) abort();
+  sprintf (tmp, "%s.%lu", idx->file, (unsigned long) getpid());
+
+  out = fopen (tmp, "wb");
+  if (!out) {
+    if (idx->verbose_p) {
+      char buf[1024];
+      sprintf (buf, "%.100s: %.800s", progname, tmp);
+      perror (buf);
+    }
+    free (tmp);
+    free (remap);
+    return;
+  }
+
+  fwrite (&h, sizeof(h), 1, out);
+
+  off = strlen (idx->dir) + 1;
+  for (i = 0; i < d->ndirs; i++)	/* Skip past the directories' names */
+    if (remap[i] >= 0)
+      off += strlen (d->dirs[i].path) + 1;
+  for (i = 0; i < d->nfiles; i++) {
+    const index_file *f = &d->files[i];
+    struct saved_file sf;
+    if (remap[f->dir] < 0) continue;
+    memset (&sf, 0, sizeof(sf));
+    sf.mtime  = f->mtime;
+    sf.path   = off;
+    sf.dir    = remap[f->dir];
+    sf.width  = f->width;
+    sf.height = f->height;
+    fwrite (&sf, sizeof(sf), 1, out);
+    off += strlen (f->path) + 1;
+  }
+
+  off = strlen (idx->dir) + 1;
+  for (i = 0; i < d->ndirs; i++) {
+    const index_dir *dd = &d->dirs[i];
+    struct saved_dir sd;
+    if (remap[i] < 0) continue;
+    memset (&sd, 0, sizeof(sd));
+    sd.mtime  = dd->mtime;
+    sd.path   = off;
+    sd.parent = dd->parent < 0 ? -1 : remap[dd->parent];
+    fwrite (&sd, sizeof(sd), 1, out);
+    off += strlen (dd->path) + 1;
+  }
+
+  fwrite (idx->dir, strlen (idx->dir) + 1, 1, out);
+  for (i = 0; i < d->ndirs; i++)
+    if (remap[i] >= 0)
+      fwrite (d->dirs[i].path, strlen (d->dirs[i].path) + 1, 1, out);
+  for (i = 0; i < d->nfiles; i++)
+    if (remap[d->files[i].dir] >= 0)
+      fwrite (d->files[i].path, strlen (d->files[i].path) + 1, 1, out);
+
+  ok = !ferror (out);
+  if (fclose (out)) ok = False;
+  if (ok && rename (tmp, idx->file)) ok = False;
+
+  if (ok) {
+    idx->saved = time ((time_t *) 0);
+    idx->dirty_p = False;
+  } else {
+    if (idx->verbose_p) {
+      char buf[1024];
+      sprintf (buf, "%.100s: %.800s", progname, idx->file);
+      perror (buf);
+    }
+    unlink (tmp);
+  }
+
+  free (tmp);
+  free (remap);
+}
+
+
+/* inotify.
+ */
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+static void
+add_watch (image_index *idx, int i)
+{
+  index_dir *d = &idx->data.dirs[i];
+  if (idx->inotify_fd < 0 || d->dead_p || d->wd >= 0) return;
+  /* If we are out of watches, it will only be kept fresh by re-scans. */
+  d->wd = inotify_add_watch (idx->inotify_fd, d->path,
+                             (IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO |
+                              IN_MOVED_FROM | IN_DELETE | IN_ONLYDIR));
+}
+
+
+static void
+watch_all (image_index *idx)
+{
+  int i;
+  if (idx->inotify_fd >= 0)
+    close (idx->inotify_fd);
+  for (i = 0; i < idx->data.ndirs; i++)
+    idx->data.dirs[i].wd = -1;
+
+  idx->inotify_fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+  for (i = 0; i < idx->data.ndirs; i++)
+    add_watch (idx, i);
+}
+
+
+static int
+watch_dir (image_index *idx, int wd)
+{
+  int i;
+  for (i = 0; i < idx->data.ndirs; i++)
+    if (idx->data.dirs[i].wd == wd && !idx->data.dirs[i].dead_p)
+      return i;
+  return -1;
+}
+
+#else  /* !HAVE_SYS_INOTIFY_H */
+# define add_watch(idx,i)
+#endif /* !HAVE_SYS_INOTIFY_H */
+
+
+/* Reading directories.
+ */
+
+/* Adds the files and subdirectories of directory N.  If 'old' is given,
+   dimensions of files that have not changed are carried over from it. */
+static int
+read_dir (index_data *d, int n, const index_data *old)
+{
+  DIR *dir = opendir (d->dirs[n].path);
+  struct dirent *de;
+  size_t L;
+  int depth = d->dirs[n].depth;
+  int count = 0;
+
+  if (!dir) return 0;
+  L = strlen (d->dirs[n].path);
+
+  while ((de = readdir (dir))) {
+    struct stat st;
+    char *path;
+    Bool maybe_dir_p = True;
+
+    if (de->d_name[0] == '.')	/* ".", "..", and dot-files */
+      continue;
+
+# ifdef _DIRENT_HAVE_D_TYPE
+    if (de->d_type == DT_REG)
+      maybe_dir_p = False;
+    else if (de->d_type != DT_DIR &&
+             de->d_type != DT_LNK &&
+             de->d_type != DT_UNKNOWN)
+      continue;
+# endif
+    if (!maybe_dir_p && !image_file_p (de->d_name))
+      continue;
+
+    path = (char *) malloc (L + strlen (de->d_name) + 2);
+    if (!path) abort();
+    sprintf (path, "%s/%s", d->dirs[n].path, de->d_name);
+
+    if (stat (path, &st)) {
+      free (path);
+      continue;
+    }
+
+    if (S_ISDIR (st.st_mode)) {
+      if (depth < MAX_DEPTH)
+        add_dir (d, path, 0, n, depth + 1);	/* mtime is set when read */
+      else
+        free (path);
+    } else if (S_ISREG (st.st_mode) && image_file_p (de->d_name)) {
+      int f = add_file (d, path, st.st_mtime, n);
+      int o = (old ? table_find (&old->ftab, old, file_path, path) : -1);
+      if (o >= 0 && old->files[o].mtime == st.st_mtime) {
+        d->files[f].width  = old->files[o].width;
+        d->files[f].height = old->files[o].height;
+      }
+      count++;
+    } else {
+      free (path);
+    }
+  }
+
+  closedir (dir);
+  return count;
+}
+
+
+/* Counting sort: returns the indexes 0 .. n-1 in order of their keys,
+   and the index into that of the first one with each key.  Negative
+   keys are left out. */
+static int *
+group_by (int nkeys, int n, const int *keys, int **first_ret)
+{
+  int *first = (int *) calloc (nkeys + 1, sizeof(*first));
+  int *next  = (int *) malloc ((nkeys + 1) * sizeof(*next));
+  int *out   = (int *) malloc ((n + 1) * sizeof(*out));
+  int i;
+
+  if (!first || !next || !out) abort();
+  for (i = 0; i < n; i++)
+    if (keys[i] >= 0)
+      first[keys[i] + 1]++;
+  for (i = 0; i < nkeys; i++)
+    first[i + 1] += first[i];
+  memcpy (next, first, (nkeys + 1) * sizeof(*next));
+  for (i = 0; i < n; i++)
+    if (keys[i] >= 0)
+      out[next[keys[i]]++] = i;
+
+  free (next);
+  *first_ret = first;
+  return out;
+}
+
+
+/* Checks every directory, and re-reads the ones that have changed since
+   the last time.  Builds a new set of live arrays. */
+static void
+rescan (image_index *idx)
+{
+  index_data *old = &idx->data;
+  index_data new;
+  int *keys, *ffirst, *flist, *dfirst, *dlist;
+  char *fmoved, *dmoved;
+  int i, j, od, reread = 0;
+  time_t now = time ((time_t *) 0);
+
+  memset (&new, 0, sizeof(new));
+
+  keys = (int *) malloc ((old->nfiles + old->ndirs + 1) * sizeof(*keys));
+  fmoved = (char *) calloc (old->nfiles + 1, 1);
+  dmoved = (char *) calloc (old->ndirs + 1, 1);
+  if (!keys || !fmoved || !dmoved) abort();
+
+  for (i = 0; i < old->nfiles; i++)
+    keys[i] = old->files[i].dir;
+  flist = group_by (old->ndirs, old->nfiles, keys, &ffirst);
+  for (i = 0; i < old->ndirs; i++)
+    keys[i] = (old->dirs[i].dead_p ? -1 : old->dirs[i].parent);
+  dlist = group_by (old->ndirs, old->ndirs, keys, &dfirst);
+  free (keys);
+
+  od = table_find (&old->dtab, old, dir_path, idx->dir);
+  if (od >= 0 && !old->dirs[od].dead_p && old->dirs[od].parent < 0) {
+    add_dir (&new, old->dirs[od].path, 0, -1, 0);
+    dmoved[od] = 1;
+  } else {
+    add_dir (&new, strdup (idx->dir), 0, -1, 0);
+  }
+
+  /* Breadth first, so that the array ends up with parents first. */
+  for (i = 0; i < new.ndirs; i++) {
+    struct stat st;
+
+    if (stat (new.dirs[i].path, &st) || !S_ISDIR (st.st_mode)) {
+      table_remove (&new.dtab, i, new.dirs[i].path);
+      new.dirs[i].dead_p = True;
+      continue;
+    }
+    new.dirs[i].mtime = st.st_mtime;
+
+    od = table_find (&old->dtab, old, dir_path, new.dirs[i].path);
+    if (od >= 0 && old->dirs[od].dead_p)
+      od = -1;
+
+    if (od >= 0 && old->dirs[od].mtime == st.st_mtime) {
+      /* Unchanged: it holds the same entries as last time.  Files inside
+         it may have been rewritten, but that only changes their own
+         modification times, which are checked when they are loaded. */
+      for (j = ffirst[od]; j < ffirst[od + 1]; j++) {
+        const index_file *of = &old->files[flist[j]];
+        int f = add_file (&new, of->path, of->mtime, i);
+        new.files[f].width  = of->width;
+        new.files[f].height = of->height;
+        fmoved[flist[j]] = 1;
+      }
+      for (j = dfirst[od]; j < dfirst[od + 1]; j++) {
+        int c = dlist[j];
+        if (new.dirs[i].depth >= MAX_DEPTH) break;
+        add_dir (&new, old->dirs[c].path, 0, i, new.dirs[i].depth + 1);
+        dmoved[c] = 1;
+      }
+    } else {
+      read_dir (&new, i, old);
+      reread++;
+    }
+  }
+
+  if (idx->verbose_p)
+    fprintf (stderr, "%s: %s: %d images in %d directories (%d re-read)\n",
+             progname, idx->dir, new.nfiles, new.ndirs, reread);
+
+  free_data (idx, old, fmoved, dmoved);
+  free (ffirst);
+  free (flist);
+  free (dfirst);
+  free (dlist);
+  free (fmoved);
+  free (dmoved);
+
+  idx->data = new;
+  idx->scanned = now;
+  idx->dirty_p = True;
+
+# ifdef HAVE_SYS_INOTIFY_H
+  if (idx->watch_p)
+    watch_all (idx);
+# endif
+}
+
+
+#ifdef HAVE_SYS_INOTIFY_H
+
+static void
+touch_dir (index_data *d, int i)
+{
+  struct stat st;
+  if (!stat (d->dirs[i].path, &st))
+    d->dirs[i].mtime = st.st_mtime;
+}
+
+
+static Bool
+under_dir_p (const char *file, const char *dir, size_t L)
+{
+  return (!strncmp (file, dir, L) && (file[L] == '/' || file[L] == 0));
+}
+
+
+static void
+remove_tree (image_index *idx, const char *path)
+{
+  index_data *d = &idx->data;
+  size_t L = strlen (path);
+  int i;
+
+  for (i = 0; i < d->ndirs; i++) {
+    index_dir *dd = &d->dirs[i];
+    if (dd->dead_p || !under_dir_p (dd->path, path, L)) continue;
+    table_remove (&d->dtab, i, dd->path);
+    dd->dead_p = True;
+    if (dd->wd >= 0)
+      inotify_rm_watch (idx->inotify_fd, dd->wd);
+    dd->wd = -1;
+  }
+
+  for (i = d->nfiles - 1; i >= 0; i--)
+    if (under_dir_p (d->files[i].path, path, L))
+      remove_file (idx, i);
+}
+
+
+static void
+inotify_event_1 (image_index *idx, const struct inotify_event *ev)
+{
+  index_data *d = &idx->data;
+  char *path;
+  int n, i;
+
+  if (ev->mask & IN_Q_OVERFLOW) {	/* Lost track: re-check everything */
+    idx->scanned = 0;
+    return;
+  }
+
+  n = watch_dir (idx, ev->wd);
+  if (n < 0) return;
+
+  if (ev->mask & IN_IGNORED) {		/* Directory is gone */
+    d->dirs[n].wd = -1;
+    return;
+  }
+
+  if (!ev->len || ev->name[0] == '.')
+    return;
+
+  path = (char *) malloc (strlen (d->dirs[n].path) + strlen (ev->name) + 2);
+  if (!path) abort();
+  sprintf (path, "%s/%s", d->dirs[n].path, ev->name);
+
+  if (ev->mask & IN_ISDIR) {
+    if (ev->mask & (IN_CREATE | IN_MOVED_TO)) {
+      if (d->dirs[n].depth < MAX_DEPTH &&
+          table_find (&d->dtab, d, dir_path, path) < 0) {
+        int first = add_dir (d, path, 0, n, d->dirs[n].depth + 1);
+        path = 0;
+        for (i = first; i < d->ndirs; i++) {	/* and what it holds */
+          touch_dir (d, i);
+          read_dir (d, i, 0);
+          add_watch (idx, i);
+        }
+      }
+    } else if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+      remove_tree (idx, path);
+    }
+
+  } else if (image_file_p (ev->name)) {
+    i = table_find (&d->ftab, d, file_path, path);
+    if (ev->mask & (IN_DELETE | IN_MOVED_FROM)) {
+      if (i >= 0) remove_file (idx, i);
+    } else if (ev->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+      /* Not on IN_CREATE: the file is not all there yet. */
+      struct stat st;
+      if (!stat (path, &st) && S_ISREG (st.st_mode)) {
+        if (i < 0) {
+          add_file (d, path, st.st_mtime, n);
+          path = 0;
+        } else {
+          d->files[i].mtime  = st.st_mtime;
+          d->files[i].width  = 0;
+          d->files[i].height = 0;
+        }
+      }
+    }
+  }
+
+  touch_dir (d, n);
+  idx->dirty_p = True;
+  if (path) free (path);
+}
+
+
+static void
+read_inotify (image_index *idx)
+{
+  union {
+    struct inotify_event ev;
+    char buf[4096];
+  } u;
+
+  while (idx->inotify_fd >= 0) {
+    ssize_t n = read (idx->inotify_fd, &u, sizeof(u));
+    char *p = u.buf;
+    if (n <= 0) break;	/* EAGAIN: nothing more to read */
+    while (p < u.buf + n) {
+      struct inotify_event *ev = (struct inotify_event *) p;
+      p += sizeof(*ev) + ev->len;
+      inotify_event_1 (idx, ev);
+    }
+  }
+}
+
+#endif /* HAVE_SYS_INOTIFY_H */
+
+
+/* Drops everything in memory and maps the saved index again, after some
+   other process has written a newer one. */
+static void
+reload (image_index *idx)
+{
+  free_data (idx, &idx->data, 0, 0);
+  idx->live_p = False;
+  unmap_index (idx);
+  idx->saved = idx->scanned = 0;
+  map_index (idx);
+  load_live (idx);
+  idx->dirty_p = False;
+# ifdef HAVE_SYS_INOTIFY_H
+  if (idx->watch_p)
+    watch_all (idx);
+# endif
+}
+
+
+/* Interface.
+ */
+
+image_index *
+image_index_open (const char *dir, Bool verbose_p)
+{
+  image_index *idx;
+  size_t L;
+
+  if (!dir || *dir != '/') return 0;
+
+  idx = (image_index *) calloc (1, sizeof(*idx));
+  if (!idx) abort();
+  idx->dir = strdup (dir);
+  L = strlen (idx->dir);
+  while (L > 1 && idx->dir[L-1] == '/')
+    idx->dir[--L] = 0;
+  idx->file = index_file_name (idx->dir);
+  idx->verbose_p = verbose_p;
+  idx->inotify_fd = -1;
+
+  map_index (idx);
+  return idx;
+}
+
+
+void
+image_index_close (image_index *idx)
+{
+  if (!idx) return;
+  free_data (idx, &idx->data, 0, 0);
+  unmap_index (idx);
+  if (idx->inotify_fd >= 0)
+    close (idx->inotify_fd);
+  free (idx->dir);
+  free (idx->file);
+  free (idx);
+}
+
+
+void
+image_index_watch (image_index *idx)
+{
+  idx->watch_p = True;
+}
+
+
+void
+image_index_update (image_index *idx, int max_age)
+{
+  time_t now = time ((time_t *) 0);
+  Bool rescanned_p = False;
+
+  load_live (idx);
+
+# ifdef HAVE_SYS_INOTIFY_H
+  read_inotify (idx);
+# endif
+
+  if (now - idx->scanned >= max_age) {
+    /* Only one process re-scans at a time.  Whoever waited for the lock
+       will usually find that the other one has just written a fresh index,
+       and use that instead. */
+    char *lock = (char *) malloc (strlen (idx->file) + 10);
+    int fd;
+    struct stat st;
+    if (!lock) abort();
+    sprintf (lock, "%s.lock", idx->file);
+    fd = open (lock, O_RDWR | O_CREAT, 0600);
+    if (fd >= 0)
+      flock (fd, LOCK_EX);
+
+    if (!stat (idx->file, &st) && st.st_mtime > idx->saved)
+      reload (idx);
+    if (now - idx->scanned >= max_age) {
+      rescan (idx);
+      rescanned_p = True;
+    }
+    if (rescanned_p || (idx->dirty_p && now - idx->saved >= SAVE_INTERVAL))
+      save_index (idx);
+
+    if (fd >= 0)
+      close (fd);	/* and unlock */
+    free (lock);
+    return;
+  }
+
+# ifdef HAVE_SYS_INOTIFY_H
+  if (idx->watch_p && idx->inotify_fd < 0)
+    watch_all (idx);
+# endif
+
+  if (idx->dirty_p && now - idx->saved >= SAVE_INTERVAL)
+    save_index (idx);
+}
+
+
+Bool
+image_index_stale_p (image_index *idx, int max_age)
+{
+  return (time ((time_t *) 0) - idx->scanned >= max_age);
+}
+
+
+int
+image_index_count (image_index *idx)
+{
+  if (idx->live_p) return idx->data.nfiles;
+  if (idx->hdr) return idx->hdr->nfiles;
+  return 0;
+}
+
+
+const char *
+image_index_file (image_index *idx, int n)
+{
+  if (n < 0 || n >= image_index_count (idx)) return 0;
+  if (idx->live_p) return idx->data.files[n].path;
+  if (saved_files (idx)[n].path >= idx->hdr->strings_size) return 0;
+  return saved_strings (idx) + saved_files (idx)[n].path;
+}
+
+
+time_t
+image_index_mtime (image_index *idx, int n)
+{
+  if (n < 0 || n >= image_index_count (idx)) return 0;
+  if (idx->live_p) return idx->data.files[n].mtime;
+  return (time_t) saved_files (idx)[n].mtime;
+}
+
+
+void
+image_index_size (image_index *idx, int n, int *w, int *h)
+{
+  *w = *h = 0;
+  if (n < 0 || n >= image_index_count (idx)) return;
+  if (idx->live_p) {
+    *w = idx->data.files[n].width;
+    *h = idx->data.files[n].height;
+  } else {
+    *w = saved_files (idx)[n].width;
+    *h = saved_files (idx)[n].height;
+  }
+}
+
+
+void
+image_index_set_size (image_index *idx, int n, int w, int h)
+{
+  index_file *f;
+  load_live (idx);
+  if (n < 0 || n >= idx->data.nfiles) return;
+  if (w < 0 || w > 0xFFFF || h < 0 || h > 0xFFFF) w = h = 0;
+  f = &idx->data.files[n];
+  if (f->width == w && f->height == h) return;
+  f->width  = w;
+  f->height = h;
+  idx->dirty_p = True;
+}
+
+
+void
+image_index_save (image_index *idx)
+{
+  if (idx->live_p && idx->dirty_p)
+    save_index (idx);
+}
@@ -0,0 +1,65 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* A persistent index of the image files under imageDirectory.
+
+   The index is saved in ~/.cache/xscreensaver/ as a flat file that is
+   mapped into memory, so that choosing a random image is one lookup, with
+   no directory walk, no lock, and no sub-process.  It records each file's
+   modification time and, once something has loaded it, its dimensions.
+
+   image_index_update() brings it up to date incrementally: it stats each
+   directory, and only re-reads the ones whose modification time changed
+   since the index was saved.  After that, as long as the process lives,
+   inotify reports changes as they happen (where there is inotify: it
+   doesn't see changes made on the far side of a network mount, which is
+   why the directories are also re-checked every 'max_age' seconds.)
+
+   None of this is thread-safe: callers that share an index must lock.
+ */
+
+#ifndef __XSCREENSAVER_IMAGEINDEX_H__
+#define __XSCREENSAVER_IMAGEINDEX_H__
+
+typedef struct image_index image_index;
+
+/* Maps the saved index for this directory, if there is one.  Never walks
+   the directory; returns 0 only if 'dir' is not an absolute path. */
+extern image_index *image_index_open (const char *dir, Bool verbose_p);
+extern void image_index_close (image_index *);
+
+/* Re-reads changed directories if the last check is more than 'max_age'
+   seconds old, applies whatever inotify has reported, and writes the
+   index back out if it changed. */
+extern void image_index_update (image_index *, int max_age);
+
+/* Long-lived processes call this once so that image_index_update() hears
+   about changes from inotify, rather than only from re-reading. */
+extern void image_index_watch (image_index *);
+
+/* Whether image_index_update() would need to re-read directories. */
+extern Bool image_index_stale_p (image_index *, int max_age);
+
+/* The number of images, and the Nth of them, for 0 <= N < count.
+   Returned strings are valid until the next image_index_update(). */
+extern int image_index_count (image_index *);
+extern const char *image_index_file (image_index *, int n);
+extern time_t image_index_mtime (image_index *, int n);
+
+/* Dimensions are 0 until something has set them.  Setting them is saved
+   by the next image_index_update() or image_index_save(). */
+extern void image_index_size (image_index *, int n, int *w, int *h);
+extern void image_index_set_size (image_index *, int n, int w, int h);
+
+/* Writes the index out now, if it has changed. */
+extern void image_index_save (image_index *);
+
+#endif /* __XSCREENSAVER_IMAGEINDEX_H__ */
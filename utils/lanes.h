@@ -0,0 +1,38 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* For loops that the compiler should vectorize, without intrinsics.
+
+   The inner loop is written as a small INLINE kernel over plain arrays,
+   and called LANES elements at a time and then once more on whatever is
+   left over.  A constant trip count, and RESTRICT to say that the arrays
+   don't overlap, is what lets GCC and clang turn the fixed-size calls into
+   vector code even at -O2.
+ */
+
+#ifndef __XSCREENSAVER_LANES_H__
+#define __XSCREENSAVER_LANES_H__
+
+#if defined __GNUC__ || defined __clang__
+# define INLINE __inline__
+# define RESTRICT __restrict
+#else
+# define INLINE
+# define RESTRICT
+#endif
+
+/* Enough bytes or shorts to fill a vector register or two.  Code that
+   works on doubles defines it as 8 before including this. */
+#ifndef LANES
+# define LANES 16
+#endif
+
+#endif /* __XSCREENSAVER_LANES_H__ */
@@ -0,0 +1,210 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+#include "utils.h"
+
+#ifdef HAVE_INTTYPES_H
+# include <inttypes.h>
+#endif
+
+#include "rowwriter.h"
+
+static Bool
+bigendian (void)
+{
+  union { int i; char c[sizeof(int)]; } u;
+  u.i = 1;
+  return !u.c[0];
+}
+
+
+#define ROW(W,Y) \
+  ((unsigned char *) (W)->image->data + (Y) * (W)->image->bytes_per_line)
+
+#define SWAP16(P) ((uint16_t) ((((P) >> 8) & 0xFF) | (((P) & 0xFF) << 8)))
+#define SWAP32(P) ((uint32_t) ((((P) >> 24) & 0xFF)     | \
+                               (((P) >>  8) & 0xFF00)   | \
+                               (((P) & 0xFF00)   <<  8) | \
+                               (((P) & 0xFF)     << 24)))
+
+#define STORE_32(ROW,X,Y,P)  (((uint32_t *) (ROW))[X] = (uint32_t) (P))
+#define STORE_32S(ROW,X,Y,P) (((uint32_t *) (ROW))[X] = SWAP32 (P))
+#define STORE_16(ROW,X,Y,P)  (((uint16_t *) (ROW))[X] = (uint16_t) (P))
+#define STORE_16S(ROW,X,Y,P) (((uint16_t *) (ROW))[X] = SWAP16 (P))
+#define STORE_8(ROW,X,Y,P)   ((ROW)[X] = (unsigned char) (P))
+#define STORE_24L(ROW,X,Y,P) do {					\
+    unsigned char *b = (ROW) + (X) * 3;					\
+    unsigned long p = (P);						\
+    b[0] = p; b[1] = p >> 8; b[2] = p >> 16;				\
+  } while (0)
+#define STORE_24M(ROW,X,Y,P) do {					\
+    unsigned char *b = (ROW) + (X) * 3;					\
+    unsigned long p = (P);						\
+    b[0] = p >> 16; b[1] = p >> 8; b[2] = p;				\
+  } while (0)
+#define STORE_ANY(ROW,X,Y,P) ((void) (ROW), XPutPixel (w->image, (X), (Y), (P)))
+
+#define LOAD_32(ROW,X,Y)  (((const uint32_t *) (ROW))[X])
+#define LOAD_32S(ROW,X,Y) SWAP32 (((const uint32_t *) (ROW))[X])
+#define LOAD_16(ROW,X,Y)  (((const uint16_t *) (ROW))[X])
+#define LOAD_16S(ROW,X,Y) SWAP16 (((const uint16_t *) (ROW))[X])
+#define LOAD_8(ROW,X,Y)   ((ROW)[X])
+#define LOAD_24L(ROW,X,Y) \
+  ((unsigned long) (ROW)[(X)*3] | ((unsigned long) (ROW)[(X)*3+1] << 8) | \
+   ((unsigned long) (ROW)[(X)*3+2] << 16))
+#define LOAD_24M(ROW,X,Y) \
+  (((unsigned long) (ROW)[(X)*3] << 16) | \
+   ((unsigned long) (ROW)[(X)*3+1] << 8) | (unsigned long) (ROW)[(X)*3+2])
+#define LOAD_ANY(ROW,X,Y) ((void) (ROW), XGetPixel (w->image, (X), (Y)))
+
+#define PACK(W,RGB) \
+  (((((uint32_t) (RGB)[0]) << 24 >> (W)->rgb_shift[0]) & (W)->rgb_mask[0]) | \
+   ((((uint32_t) (RGB)[1]) << 24 >> (W)->rgb_shift[1]) & (W)->rgb_mask[1]) | \
+   ((((uint32_t) (RGB)[2]) << 24 >> (W)->rgb_shift[2]) & (W)->rgb_mask[2]))
+
+
+/* Defines the four writers, and the reader, for one pixel format.
+ */
+#define WRITERS(NAME,STORE,LOAD)					\
+static void								\
+NAME##_indexed (const row_writer *w, int x, int y, int count,		\
+                const unsigned char *indexes,				\
+                const unsigned long *palette)				\
+{									\
+  unsigned char *row = ROW (w, y);					\
+  int i;								\
+  for (i = 0; i < count; i++)						\
+    STORE (row, x + i, y, palette[indexes[i]]);				\
+}									\
+									\
+static void								\
+NAME##_pixels (const row_writer *w, int x, int y, int count,		\
+               const unsigned long *pixels)				\
+{									\
+  unsigned char *row = ROW (w, y);					\
+  int i;								\
+  for (i = 0; i < count; i++)						\
+    STORE (row, x + i, y, pixels[i]);					\
+}									\
+									\
+static void								\
+NAME##_fill (const row_writer *w, int x, int y, int count,		\
+             unsigned long pixel)					\
+{									\
+  unsigned char *row = ROW (w, y);					\
+  int i;								\
+  for (i = 0; i < count; i++)						\
+    STORE (row, x + i, y, pixel);					\
+}									\
+									\
+static void								\
+NAME##_rgb (const row_writer *w, int x, int y, int count,		\
+            const unsigned char *rgb)					\
+{									\
+  unsigned char *row = ROW (w, y);					\
+  int i;								\
+  for (i = 0; i < count; i++)						\
+    STORE (row, x + i, y, PACK (w, rgb + i * 3));			\
+}									\
+									\
+static void								\
+NAME##_gather (const row_writer *w, int count,				\
+               const int *xs, const int *ys, unsigned long *pixels)	\
+{									\
+  int i;								\
+  for (i = 0; i < count; i++)						\
+    {									\
+      const unsigned char *row = ROW (w, ys[i]);			\
+      pixels[i] = LOAD (row, xs[i], ys[i]);				\
+    }									\
+}
+
+WRITERS (native32,  STORE_32,  LOAD_32)
+WRITERS (swapped32, STORE_32S, LOAD_32S)
+WRITERS (lsb24,     STORE_24L, LOAD_24L)
+WRITERS (msb24,     STORE_24M, LOAD_24M)
+WRITERS (native16,  STORE_16,  LOAD_16)
+WRITERS (swapped16, STORE_16S, LOAD_16S)
+WRITERS (bytes8,    STORE_8,   LOAD_8)
+WRITERS (generic,   STORE_ANY, LOAD_ANY)
+
+
+/* Where the 8 bits of a channel go, to fill the top of its mask.
+   A channel with no mask (e.g., a PseudoColor image) gets shift 0 and
+   mask 0, so that it contributes nothing, rather than a 32-bit shift.
+ */
+static void
+decode_mask (unsigned long mask, unsigned long *mask_ret, int *shift_ret)
+{
+  int pos = 0, size = 0;
+  mask &= 0xFFFFFFFFUL;
+  *mask_ret = mask;
+  *shift_ret = 0;
+  if (! mask) return;
+  while (! (mask & (1UL << pos)))
+    pos++;
+  while (pos + size < 32 && (mask & (1UL << (pos + size))))
+    size++;
+  *shift_ret = 32 - pos - size;
+}
+
+
+void
+init_row_writer (row_writer *w, XImage *image)
+{
+  int native = (bigendian() ? MSBFirst : LSBFirst);
+  int bpp = image->bits_per_pixel;
+
+  memset (w, 0, sizeof(*w));
+  w->image = image;
+
+  decode_mask (image->red_mask,   &w->rgb_mask[0], &w->rgb_shift[0]);
+  decode_mask (image->green_mask, &w->rgb_mask[1], &w->rgb_shift[1]);
+  decode_mask (image->blue_mask,  &w->rgb_mask[2], &w->rgb_shift[2]);
+
+# define USE(NAME) do {				\
+    w->indexed = NAME##_indexed;		\
+    w->pixels  = NAME##_pixels;			\
+    w->fill    = NAME##_fill;			\
+    w->rgb     = NAME##_rgb;			\
+    w->gather  = NAME##_gather;			\
+  } while (0)
+
+  if (image->format != ZPixmap)
+    USE (generic);
+  else if (bpp == 32)
+    {
+      if (image->byte_order == native)
+        USE (native32);
+      else
+        USE (swapped32);
+    }
+  else if (bpp == 24)
+    {
+      if (image->byte_order == LSBFirst)
+        USE (lsb24);
+      else
+        USE (msb24);
+    }
+  else if (bpp == 16)
+    {
+      if (image->byte_order == native)
+        USE (native16);
+      else
+        USE (swapped16);
+    }
+  else if (bpp == 8)
+    USE (bytes8);
+  else
+    USE (generic);
+
+# undef USE
+}
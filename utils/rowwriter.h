@@ -0,0 +1,63 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ */
+
+/* Writing whole rows of pixels into an XImage, and reading them back.
+
+   XPutPixel is a call through a function pointer for every pixel, and
+   under jwxyz it is yet another one.  That adds up when a hack rebuilds a
+   full-screen image every frame.  init_row_writer() picks an implementation
+   for the image's format once; each call then writes a span of pixels.
+   For the usual ZPixmap with 32 bits per pixel in the client's byte order,
+   those are plain loops of stores that the compiler vectorizes.
+ */
+
+#ifndef __XSCREENSAVER_ROWWRITER_H__
+#define __XSCREENSAVER_ROWWRITER_H__
+
+typedef struct row_writer row_writer;
+
+struct row_writer {
+  XImage *image;
+
+  /* Writes 'count' pixels starting at x,y, looked up in 'palette' by the
+     bytes in 'indexes'. */
+  void (*indexed) (const row_writer *, int x, int y, int count,
+                   const unsigned char *indexes,
+                   const unsigned long *palette);
+
+  /* Writes 'count' pixel values starting at x,y. */
+  void (*pixels) (const row_writer *, int x, int y, int count,
+                  const unsigned long *pixels);
+
+  /* Writes 'count' copies of one pixel value starting at x,y. */
+  void (*fill) (const row_writer *, int x, int y, int count,
+                unsigned long pixel);
+
+  /* Writes 'count' pixels starting at x,y from R,G,B byte triples, packed
+     according to the image's red_mask, green_mask and blue_mask.  Only
+     meaningful for TrueColor images. */
+  void (*rgb) (const row_writer *, int x, int y, int count,
+               const unsigned char *rgb);
+
+  /* Reads the 'count' pixel values at xs[i],ys[i], which must all be
+     inside the image.  This is the other half of copying an image through
+     a warp: gather a row from the source, and write it with 'pixels'. */
+  void (*gather) (const row_writer *, int count,
+                  const int *xs, const int *ys, unsigned long *pixels);
+
+  /* Private: how to move each 8-bit channel into its mask. */
+  unsigned long rgb_mask[3];
+  int rgb_shift[3];
+};
+
+extern void init_row_writer (row_writer *, XImage *);
+
+#endif /* __XSCREENSAVER_ROWWRITER_H__ */
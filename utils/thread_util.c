@@ -21,7 +21,7 @@ implied warranty.
 #include <errno.h>
 #include <limits.h>
 #include <stdlib.h>
-#include <stdio.h> /* Only used by thread_memory_alignment(). */
+#include <stdio.h>
 #include <string.h>
 
 #if HAVE_ALLOCA_H
@@ -276,10 +276,13 @@ static void _serial_destroy(struct threadpool *self)
 	void *thread = self->serial_threads;
 	unsigned i, count = _threadpool_count_serial(self);
 
-	for(i = 0; i != count; ++i)
+	if(self->thread_destroy)
 	{
-		self->thread_destroy(thread);
-		thread = (char *)thread + self->thread_size;
+		for(i = 0; i != count; ++i)
+		{
+			self->thread_destroy(thread);
+			thread = (char *)thread + self->thread_size;
+		}
 	}
 
 	free(self->serial_threads);
@@ -339,7 +342,8 @@ static void *_thread_free_and_unlock(struct threadpool *self, void *thread)
 
 static void *_thread_destroy_and_unlock(struct threadpool *self, void *thread)
 {
-	self->thread_destroy(thread);
+	if(self->thread_destroy)
+		self->thread_destroy(thread);
 	return _thread_free_and_unlock(self, thread);
 }
 
@@ -586,6 +590,12 @@ void threadpool_destroy(struct threadpool *self)
 	_serial_destroy(self);
 }
 
+void threadpool_fatal(const char *progname, int error)
+{
+	fprintf(stderr, "%s: couldn't create threads: %s\n", progname, strerror(error));
+	exit(1);
+}
+
 void threadpool_run(struct threadpool *self, void (*func)(void *))
 {
 #if HAVE_PTHREAD
@@ -294,7 +294,7 @@ struct threadpool_class
 /*	Destroys the thread private object. Called in sequence (though not always
 	the same sequence as create).  Warning: During shutdown, it is possible
 	for destroy() to be called while other threads are still in
-	threadpool_run(). */
+	threadpool_run().  May be NULL if the thread object owns nothing. */
 	void (*destroy)(void *self);
 };
 
@@ -303,6 +303,10 @@ struct threadpool_class
 int threadpool_create(struct threadpool *self, const struct threadpool_class *cls, Display *dpy, unsigned count);
 void threadpool_destroy(struct threadpool *self);
 
+/* For callers that can't go on without their threads: prints the error
+   returned by threadpool_create, and exits. */
+void threadpool_fatal(const char *progname, int error);
+
 void threadpool_run(struct threadpool *self, void (*func)(void *));
 void threadpool_wait(struct threadpool *self);
 
@@ -0,0 +1,557 @@
+/* xscreensaver, Copyright © 2026 by the xscreensaver authors.
+ *
+ * Permission to use, copy, modify, distribute, and sell this software and its
+ * documentation for any purpose is hereby granted without fee, provided that
+ * the above copyright notice appear in all copies and that both that
+ * copyright notice and this permission notice appear in supporting
+ * documentation.  No representations are made about the suitability of this
+ * software for any purpose.  It is provided "as is" without express or
+ * implied warranty.
+ *
+ * Random images from imageDirectory for the Wayland runner, loaded in
+ * process rather than by forking xscreensaver-getimage.
+ *
+ * File names come from the index in utils/imageindex.c, which is shared with
+ * xscreensaver-getimage and which inotify keeps current while we run.  Each
+ * request picks a file from it and decodes it with
+ * gdk-pixbuf on a one-shot io_thread, scaled to fit the drawable as it is
+ * decoded (so that JPEG loaders can use their DCT scaling) and packed into
+ * the visual's pixel format.  The worker writes a byte to a pipe when it is
+ * done, and the main loop notices that through XtAppAddInput: so the image
+ * is drawn and the hack's callback is run between two frames of the output
+ * that asked for it, with its GL context current, and the render loop never
+ * waits for the disk.
+ *
+ * Decoded images are kept in a small LRU cache shared by all outputs, keyed
+ * by file name, modification time, and the size they were scaled to fit:
+ * copies of files that have since changed are never matched, and age out.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef HAVE_PTHREAD
+# include <pthread.h>
+#endif
+
+#include <gdk-pixbuf/gdk-pixbuf.h>
+
+#include "screenhackI.h"
+#include "colorbars.h"
+#include "grabclient.h"
+#include "imageindex.h"
+#include "thread_util.h"
+
+/* How much memory decoded images may use, across all outputs. */
+#define CACHE_BYTES (128L * 1024 * 1024)
+
+/* How many files to try if they won't decode, before giving up. */
+#define MAX_TRIES 5
+
+/* How often the index re-reads directories that have changed, for the
+   changes that inotify doesn't see. */
+#define INDEX_MAX_AGE (10 * 60)
+
+
+typedef struct cached_image cached_image;
+struct cached_image {
+  char *file;
+  time_t mtime;			/* Of the file that was decoded */
+  int max_width, max_height;	/* The box it was scaled to fit */
+  int width, height;
+  uint32_t *pixels;		/* In the visual's pixel format */
+  int refcount;			/* Requests that are still drawing it */
+  cached_image *prev, *next;	/* Most recently used first */
+};
+
+typedef struct grab_request grab_request;
+struct grab_request {
+  struct io_thread io;
+  Bool threaded_p;
+
+  Screen *screen;
+  Window window;
+  Drawable drawable;
+  void (*callback) (Screen *, Window, Drawable,
+                    const char *name, XRectangle *geom, void *closure);
+  void *closure;
+
+  int width, height;
+  unsigned long masks[4];	/* red, green, blue, alpha */
+  unsigned long seed;
+
+  int fds[2];
+  XtInputId pipe_id;
+
+  cached_image *image;		/* The result, or 0 */
+};
+
+/* Everything here is shared between the worker threads.  'index' is
+   protected by index_lock, which only the workers take: updating the
+   index can mean re-reading directories, and the main thread must not
+   wait for that.  The cache is protected by grab_lock, which the main
+   thread takes only to release an image.  Neither is held while taking
+   the other.  'dir' is only written by the main thread before the first
+   worker is started.
+ */
+static struct {
+  char *dir;
+  image_index *index;
+
+  cached_image *cache;
+  long cache_bytes;
+} grab = { 0, };
+
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t grab_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t index_lock = PTHREAD_MUTEX_INITIALIZER;
+# define LOCK()   pthread_mutex_lock (&grab_lock)
+# define UNLOCK() pthread_mutex_unlock (&grab_lock)
+# define INDEX_LOCK()   pthread_mutex_lock (&index_lock)
+# define INDEX_UNLOCK() pthread_mutex_unlock (&index_lock)
+#else
+# define LOCK()
+# define UNLOCK()
+# define INDEX_LOCK()
+# define INDEX_UNLOCK()
+#endif
+
+
+/* The cache of decoded images.  All of these are called with the lock held.
+ */
+
+static void
+cache_unlink (cached_image *img)
+{
+  if (img->prev) img->prev->next = img->next;
+  else grab.cache = img->next;
+  if (img->next) img->next->prev = img->prev;
+  img->prev = img->next = 0;
+}
+
+
+static void
+cache_push (cached_image *img)
+{
+  img->prev = 0;
+  img->next = grab.cache;
+  if (grab.cache) grab.cache->prev = img;
+  grab.cache = img;
+}
+
+
+static void
+free_image (cached_image *img)
+{
+  grab.cache_bytes -= (long) img->width * img->height * 4;
+  free (img->file);
+  free (img->pixels);
+  free (img);
+}
+
+
+/* Returns a decoded copy of the file at this size, holding a reference. */
+static cached_image *
+cache_find (const char *file, time_t mtime, int max_width, int max_height)
+{
+  cached_image *img;
+  for (img = grab.cache; img; img = img->next)
+    if (img->mtime      == mtime &&
+        img->max_width  == max_width &&
+        img->max_height == max_height &&
+        !strcmp (img->file, file)) {
+      cache_unlink (img);
+      cache_push (img);
+      img->refcount++;
+      return img;
+    }
+  return 0;
+}
+
+
+static void
+cache_add (cached_image *img)
+{
+  cached_image *tail, *prev;
+
+  img->refcount = 1;
+  cache_push (img);
+  grab.cache_bytes += (long) img->width * img->height * 4;
+
+  for (tail = grab.cache; tail->next; tail = tail->next)
+    ;
+  for (; tail && grab.cache_bytes > CACHE_BYTES; tail = prev) {
+    prev = tail->prev;
+    if (tail->refcount == 0) {
+      cache_unlink (tail);
+      free_image (tail);
+    }
+  }
+}
+
+
+static void
+release_image (cached_image *img)
+{
+  LOCK();
+  img->refcount--;
+  UNLOCK();
+}
+
+
+/* Decoding.  This is the slow part, and runs without the lock.
+ */
+
+static int
+mask_shift (unsigned long mask)
+{
+  int i = 0;
+  if (!mask) return 0;
+  while (!(mask & 1)) {
+    mask >>= 1;
+    i++;
+  }
+  return i;
+}
+
+
+/* Also returns the size of the image in the file, or 0 if unknown. */
+static cached_image *
+decode_image (const char *file, int max_width, int max_height,
+              const unsigned long *masks, int *file_w, int *file_h)
+{
+  GError *error = 0;
+  GdkPixbuf *pb;
+  cached_image *img;
+  const guchar *row;
+  int rowstride, channels, w, h, x, y;
+  int rs = mask_shift (masks[0]);
+  int gs = mask_shift (masks[1]);
+  int bs = mask_shift (masks[2]);
+  uint32_t a = (uint32_t) masks[3];
+  uint32_t *out;
+
+  *file_w = *file_h = 0;
+  if (! gdk_pixbuf_get_file_info (file, file_w, file_h))
+    *file_w = *file_h = 0;
+
+  pb = gdk_pixbuf_new_from_file_at_scale (file, max_width, max_height,
+                                          TRUE, &error);
+  if (!pb) {
+    if (error) {
+      fprintf (stderr, "%s: %s\n", progname, error->message);
+      g_error_free (error);
+    }
+    return 0;
+  }
+
+  /* Rotate it upright, if the camera said which way that was.  That might
+     have swapped the width and height, so it might need to shrink again. */
+  {
+    GdkPixbuf *pb2 = gdk_pixbuf_apply_embedded_orientation (pb);
+    if (pb2) {
+      g_object_unref (pb);
+      pb = pb2;
+    }
+  }
+
+  w = gdk_pixbuf_get_width (pb);
+  h = gdk_pixbuf_get_height (pb);
+  if (w > max_width || h > max_height) {
+    GdkPixbuf *pb2;
+    double r = ((double) max_width / w < (double) max_height / h
+                ? (double) max_width / w
+                : (double) max_height / h);
+    w = w * r;
+    h = h * r;
+    if (w < 1) w = 1;
+    if (h < 1) h = 1;
+    pb2 = gdk_pixbuf_scale_simple (pb, w, h, GDK_INTERP_BILINEAR);
+    g_object_unref (pb);
+    if (!pb2) return 0;
+    pb = pb2;
+  }
+
+  img = (cached_image *) calloc (1, sizeof(*img));
+  if (!img) abort();
+  img->max_width  = max_width;
+  img->max_height = max_height;
+  img->width  = w;
+  img->height = h;
+  img->pixels = (uint32_t *) malloc ((size_t) w * h * 4);
+  if (!img->pixels) abort();
+
+  rowstride = gdk_pixbuf_get_rowstride (pb);
+  channels  = gdk_pixbuf_get_n_channels (pb);
+  row = gdk_pixbuf_read_pixels (pb);
+  out = img->pixels;
+
+  /* Pack into the visual's format, compositing any alpha onto black. */
+  for (y = 0; y < h; y++) {
+    const guchar *in = row;
+    if (channels == 4)
+      for (x = 0; x < w; x++) {
+        unsigned int alpha = in[3];
+        *out++ = (((uint32_t) (in[0] * alpha / 255) << rs) |
+                  ((uint32_t) (in[1] * alpha / 255) << gs) |
+                  ((uint32_t) (in[2] * alpha / 255) << bs) |
+                  a);
+        in += 4;
+      }
+    else
+      for (x = 0; x < w; x++) {
+        *out++ = (((uint32_t) in[0] << rs) |
+                  ((uint32_t) in[1] << gs) |
+                  ((uint32_t) in[2] << bs) |
+                  a);
+        in += channels;
+      }
+    row += rowstride;
+  }
+
+  g_object_unref (pb);
+  return img;
+}
+
+
+/* Picks a file and returns it decoded, holding a reference, or 0 if there
+   are no images, or none that would load.
+ */
+static cached_image *
+pick_image (grab_request *req)
+{
+  unsigned long seed = req->seed;
+  int tries;
+
+  for (tries = 0; tries < MAX_TRIES; tries++) {
+    cached_image *img;
+    const char *f;
+    char *file;
+    time_t mtime;
+    int n, i, w, h;
+
+    INDEX_LOCK();
+    if (!grab.index) {
+      grab.index = image_index_open (grab.dir, False);
+      if (grab.index)
+        image_index_watch (grab.index);
+    }
+    if (grab.index)
+      image_index_update (grab.index, INDEX_MAX_AGE);
+    n = (grab.index ? image_index_count (grab.index) : 0);
+    if (n == 0) {
+      INDEX_UNLOCK();
+      return 0;
+    }
+    i = seed % n;
+    seed = seed * 1103515245 + 12345;	/* random() is not thread-safe */
+    f = image_index_file (grab.index, i);
+    if (!f) {
+      INDEX_UNLOCK();
+      continue;
+    }
+    file  = strdup (f);
+    mtime = image_index_mtime (grab.index, i);
+    INDEX_UNLOCK();
+
+    LOCK();
+    img = cache_find (file, mtime, req->width, req->height);
+    UNLOCK();
+
+    if (img) {
+      free (file);
+      return img;
+    }
+
+    img = decode_image (file, req->width, req->height, req->masks, &w, &h);
+
+    /* Remember its size, unless the index has moved on since. */
+    if (w) {
+      INDEX_LOCK();
+      if (i < image_index_count (grab.index) &&
+          (f = image_index_file (grab.index, i)) &&
+          !strcmp (f, file))
+        image_index_set_size (grab.index, i, w, h);
+      INDEX_UNLOCK();
+    }
+
+    if (img) {
+      img->file  = file;
+      img->mtime = mtime;
+      LOCK();
+      cache_add (img);
+      UNLOCK();
+    }
+
+    if (img) return img;
+    free (file);
+  }
+
+  return 0;
+}
+
+
+static void
+wake (grab_request *req)
+{
+  if (write (req->fds[1], "", 1) != 1) {
+    char buf[255];
+    sprintf (buf, "%s: writing image pipe", progname);
+    perror (buf);
+  }
+}
+
+
+static void *
+grab_thread (void *arg)
+{
+  grab_request *req = (grab_request *) arg;
+  req->image = pick_image (req);
+  wake (req);
+  /* Requests are never cancelled: grab_done_cb always joins. */
+  io_thread_return (&req->io);
+  return 0;
+}
+
+
+/* Runs on the main thread, from the output's XtAppProcessEvent. */
+static void
+grab_done_cb (XtPointer closure, int *fd, XtInputId *id)
+{
+  grab_request *req = (grab_request *) closure;
+  Display *dpy = DisplayOfScreen (req->screen);
+  cached_image *img;
+  XRectangle geom;
+  XGCValues gcv;
+  GC gc;
+  char c;
+
+  if (read (req->fds[0], &c, 1) < 0) {
+    /* Nothing useful to do: the worker is done either way. */
+  }
+  XtRemoveInput (*id);
+  close (req->fds[0]);
+  close (req->fds[1]);
+  if (req->threaded_p)
+    io_thread_finish (&req->io);
+
+  img = req->image;
+  geom.x = 0;
+  geom.y = 0;
+  geom.width  = req->width;
+  geom.height = req->height;
+
+  gcv.foreground = BlackPixelOfScreen (req->screen);
+  gc = XCreateGC (dpy, req->drawable, GCForeground, &gcv);
+  XFillRectangle (dpy, req->drawable, gc, 0, 0, req->width, req->height);
+
+  if (img) {
+    XImage *ximage = XCreateImage (dpy, NULL, visual_depth (NULL, NULL),
+                                   ZPixmap, 0, (char *) img->pixels,
+                                   img->width, img->height, 32,
+                                   img->width * 4);
+    geom.x = (req->width  - img->width)  / 2;
+    geom.y = (req->height - img->height) / 2;
+    geom.width  = img->width;
+    geom.height = img->height;
+    XPutImage (dpy, req->drawable, gc, ximage, 0, 0, geom.x, geom.y,
+               img->width, img->height);
+    ximage->data = 0;
+    XDestroyImage (ximage);
+  } else {
+    XWindowAttributes xgwa;
+    XGetWindowAttributes (dpy, req->window, &xgwa);
+    draw_colorbars (req->screen, xgwa.visual, req->drawable, xgwa.colormap,
+                    0, 0, req->width, req->height, 0, 0); /* #### logo */
+  }
+  XFreeGC (dpy, gc);
+
+  req->callback (req->screen, req->window, req->drawable,
+                 (img ? img->file : 0), &geom, req->closure);
+
+  if (img) release_image (img);
+  free (req);
+}
+
+
+/* Called from utils/grabclient.c.  Returns right away: the image is drawn
+   and the callback is run from the main loop, some frames later.
+ */
+void
+load_random_image_wayland (Screen *screen, Window window, Drawable drawable,
+                           void (*callback) (Screen *, Window, Drawable,
+                                             const char *name,
+                                             XRectangle *geom, void *closure),
+                           void *closure)
+{
+  Display *dpy = DisplayOfScreen (screen);
+  Bool filep = get_boolean_resource (dpy, "chooseRandomImages", "Boolean");
+  grab_request *req;
+  XWindowAttributes xgwa;
+
+  if (!drawable) abort();
+
+  req = (grab_request *) calloc (1, sizeof(*req));
+  if (!req) abort();
+  req->screen   = screen;
+  req->window   = window;
+  req->drawable = drawable;
+  req->callback = callback;
+  req->closure  = closure;
+  req->seed     = random();
+
+  XGetWindowAttributes (dpy, window, &xgwa);
+  {
+    Window r;
+    int x, y;
+    unsigned int w, h, bbw, d;
+    XGetGeometry (dpy, drawable, &r, &x, &y, &w, &h, &bbw, &d);
+    req->width  = w;
+    req->height = h;
+  }
+  visual_rgb_masks (screen, xgwa.visual,
+                    &req->masks[0], &req->masks[1], &req->masks[2]);
+  req->masks[3] = 0xFFFFFFFFUL & ~(req->masks[0] | req->masks[1] |
+                                   req->masks[2]);
+
+  if (filep && !grab.dir) {
+    char *dir = get_string_resource (dpy, "imageDirectory", "ImageDirectory");
+    if (dir && dir[0] == '~' && dir[1] == '/' && getenv ("HOME")) {
+      const char *home = getenv ("HOME");
+      char *d2 = (char *) malloc (strlen (home) + strlen (dir));
+      sprintf (d2, "%s%s", home, dir + 1);
+      free (dir);
+      dir = d2;
+    }
+    if (dir && !*dir) {
+      free (dir);
+      dir = 0;
+    }
+    grab.dir = dir;
+  }
+
+  if (pipe (req->fds)) {
+    char buf[255];
+    sprintf (buf, "%s: creating pipe", progname);
+    perror (buf);
+    exit (1);
+  }
+
+  req->pipe_id =
+    XtAppAddInput (XtDisplayToApplicationContext (dpy), req->fds[0],
+                   (XtPointer) (XtInputReadMask | XtInputExceptMask),
+                   grab_done_cb, (XtPointer) req);
+
+  if (!filep || !grab.dir)
+    wake (req);		/* No images: colorbars. */
+  else if (io_thread_create (&req->io, req, grab_thread, dpy, 0))
+    req->threaded_p = True;
+  else {
+    /* No threads: load it now, but still call back from the main loop. */
+    req->image = pick_image (req);
+    wake (req);
+  }
+}
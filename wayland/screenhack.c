@@ -519,16 +519,6 @@ jwxyz_get_pos (Window w, XPoint *xvpos, XPoint *xp)
   }
 }
 
-void
-load_random_image_wayland (Screen *screen, Window window, Drawable drawable,
-                           void (*callback) (Screen *, Window, Drawable,
-                                             const char *name,
-                                             XRectangle *geom, void *closure),
-                           void *closure)
-{
-    fprintf(stderr, "Call to unimplemented load_random_image_wayland\n");
-}
-
 struct resource_kv {
   /* null key values signify wild card */
   char *progname;
@@ -782,6 +772,7 @@ static char *default_defaults[] = {
   "*visualID:		default",
   "*windowID:		",
   "*desktopGrabber:	xscreensaver-getimage %s",
+  "*useThreads:		True",	/* images are decoded off the main loop */
   0
 };
 static XrmOptionDescRec *merged_options;
@@ -1411,8 +1402,17 @@ ya_rand_init (0);
 
           glBindFramebuffer(GL_FRAMEBUFFER, output->frameBuffer);
 
+# ifdef HAVE_GLPROF
+          glprof_frame_begin ();
+# endif
           delay = ft->draw_cb (output->display, window, output->closure);
 
+# ifdef HAVE_GLBATCH
+          glbatch_flush ();
+# endif
+# ifdef HAVE_GLPROF
+          glprof_frame_end ();
+# endif
           jwxyz_gl_flush (output->display);
           glFinish();
           glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -1468,7 +1468,21 @@ ya_rand_init (0);
             fprintf(stderr, "Reshape %d %d\n", output->width, output->height);
           }
 
+          /* Run the hack's timers and input callbacks, e.g. for images
+             that have finished loading (wayland/grabimage.c). */
+          XtAppProcessEvent (XtDisplayToApplicationContext (output->display),
+                             XtIMTimer | XtIMAlternateInput);
+
+# ifdef HAVE_GLPROF
+          glprof_frame_begin ();
+# endif
           delay = ft->draw_cb (output->display, &output->window, output->closure);
+# ifdef HAVE_GLBATCH
+          glbatch_flush ();
+# endif
+# ifdef HAVE_GLPROF
+          glprof_frame_end ();
+# endif
           jwxyz_gl_flush (output->display);
 
           glFinish();